@@ -34,10 +34,14 @@ extern AppData g;  // ensure what "g" means
 
 const quint16 RadioOutputsWidget::m_savedViewStateVersion = 2;
 
+#define OUTPUTS_REFRESH_PERIOD  40  // ms
+
 RadioOutputsWidget::RadioOutputsWidget(SimulatorInterface * simulator, Firmware * firmware, QWidget *parent) :
   QWidget(parent),
   m_simulator(simulator),
   m_firmware(firmware),
+  m_lastOutputsSerial(0),
+  m_refreshAll(true),
   m_radioProfileId(g.sessionId()),
   ui(new Ui::RadioOutputsWidget)
 {
@@ -49,11 +53,12 @@ RadioOutputsWidget::RadioOutputsWidget(SimulatorInterface * simulator, Firmware
   connect(ui->channelsScroll->horizontalScrollBar(), &QScrollBar::sliderMoved, ui->mixersScroll->horizontalScrollBar(), &QScrollBar::setValue);
   connect(ui->mixersScroll->horizontalScrollBar(), &QScrollBar::sliderMoved, ui->channelsScroll->horizontalScrollBar(), &QScrollBar::setValue);
 
-  connect(m_simulator, &SimulatorInterface::channelOutValueChange, this, &RadioOutputsWidget::onChannelOutValueChange);
-  connect(m_simulator, &SimulatorInterface::channelMixValueChange, this, &RadioOutputsWidget::onChannelMixValueChange);
-  connect(m_simulator, &SimulatorInterface::virtualSwValueChange, this, &RadioOutputsWidget::onVirtSwValueChange);
-  connect(m_simulator, &SimulatorInterface::gVarValueChange, this, &RadioOutputsWidget::onGVarValueChange);
   connect(m_simulator, &SimulatorInterface::phaseChanged, this, &RadioOutputsWidget::onPhaseChanged);
+
+  // one batched refresh per frame from the outputs snapshot
+  m_refreshTimer.setInterval(OUTPUTS_REFRESH_PERIOD);
+  connect(&m_refreshTimer, &QTimer::timeout, this, &RadioOutputsWidget::refreshOutputs);
+  m_refreshTimer.start();
 }
 
 RadioOutputsWidget::~RadioOutputsWidget()
@@ -81,6 +86,7 @@ void RadioOutputsWidget::start()
   setupChannelsDisplay(true);
   setupGVarsDisplay();
   setupLsDisplay();
+  m_refreshAll = true;
 }
 
 //void RadioOutputsWidget::stop()
@@ -301,33 +307,55 @@ QWidget * RadioOutputsWidget::createLogicalSwitch(QWidget * parent, int switchNo
   return swtch;
 }
 
-void RadioOutputsWidget::onChannelOutValueChange(quint8 index, qint32 value, qint32 limit)
+void RadioOutputsWidget::refreshOutputs()
 {
-  if (m_channelsMap.contains(index)) {
-    QPair<QLabel *, QSlider *> ch = m_channelsMap.value(index);
-    if (ch.second->maximum() != limit) {
-      ch.second->setMaximum(limit);
-      ch.second->setMinimum(-limit);
+  SimulatorInterface::TxOutputs outputs;
+  quint32 serial;
+
+  if (!m_simulator->getOutputs(outputs, serial))
+    return;
+  if (serial == m_lastOutputsSerial && !m_refreshAll)
+    return;
+  m_lastOutputsSerial = serial;
+
+  const bool all = m_refreshAll;
+  const bool chansLimit = all || outputs.chansLimit != m_lastOutputs.chansLimit;
+  const bool mixesLimit = all || outputs.mixesLimit != m_lastOutputs.mixesLimit;
+
+  for (int i = 0; i < CPN_MAX_CHNOUT; i++) {
+    if ((chansLimit || outputs.chans[i] != m_lastOutputs.chans[i]) && m_channelsMap.contains(i))
+      setChannelValue(m_channelsMap.value(i), outputs.chans[i], outputs.chansLimit);
+    if ((mixesLimit || outputs.ex_chans[i] != m_lastOutputs.ex_chans[i]) && m_mixesMap.contains(i))
+      setChannelValue(m_mixesMap.value(i), outputs.ex_chans[i], outputs.mixesLimit);
+  }
+
+  for (int i = 0; i < CPN_MAX_LOGICAL_SWITCHES; i++) {
+    if (all || outputs.vsw[i] != m_lastOutputs.vsw[i])
+      setVirtSwValue(i, outputs.vsw[i]);
+  }
+
+  for (int fm = 0; fm < CPN_MAX_FLIGHT_MODES; fm++) {
+    for (int gv = 0; gv < CPN_MAX_GVARS; gv++) {
+      if (all || outputs.gvars[fm][gv] != m_lastOutputs.gvars[fm][gv])
+        setGVarValue(gv, outputs.gvars[fm][gv]);
     }
-    ch.first->setText(QString("%1%").arg(calcRESXto100(value)));
-    ch.second->setValue(qMin(limit, qMax(-limit, value)));
   }
+
+  m_lastOutputs = outputs;
+  m_refreshAll = false;
 }
 
-void RadioOutputsWidget::onChannelMixValueChange(quint8 index, qint32 value, qint32 limit)
+void RadioOutputsWidget::setChannelValue(const QPair<QLabel *, QSlider *> & ch, qint32 value, qint32 limit)
 {
-  if (m_mixesMap.contains(index)) {
-    QPair<QLabel *, QSlider *> ch = m_mixesMap.value(index);
-    if (ch.second->maximum() != limit) {
-      ch.second->setMaximum(limit);
-      ch.second->setMinimum(-limit);
-    }
-    ch.first->setText(QString("%1%").arg(calcRESXto100(value)));
-    ch.second->setValue(qMin(limit, qMax(-limit, value)));
+  if (ch.second->maximum() != limit) {
+    ch.second->setMaximum(limit);
+    ch.second->setMinimum(-limit);
   }
+  ch.first->setText(QString("%1%").arg(calcRESXto100(value)));
+  ch.second->setValue(qMin(limit, qMax(-limit, value)));
 }
 
-void RadioOutputsWidget::onVirtSwValueChange(quint8 index, qint32 value)
+void RadioOutputsWidget::setVirtSwValue(quint8 index, qint32 value)
 {
   if (!m_logicSwitchMap.contains(index))
     return;
@@ -342,7 +370,7 @@ void RadioOutputsWidget::onVirtSwValueChange(quint8 index, qint32 value)
   //qDebug() << index << value;
 }
 
-void RadioOutputsWidget::onGVarValueChange(quint8 index, qint32 value)
+void RadioOutputsWidget::setGVarValue(quint8 index, qint32 value)
 {
   if (!m_globalVarsMap.contains(index))
     return;
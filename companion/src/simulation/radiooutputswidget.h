@@ -56,10 +56,7 @@ class RadioOutputsWidget : public QWidget
   protected slots:
     void saveState();
     void restoreState();
-    void onChannelOutValueChange(quint8 index, qint32 value, qint32 limit);
-    void onChannelMixValueChange(quint8 index, qint32 value, qint32 limit);
-    void onVirtSwValueChange(quint8 index, qint32 value);
-    void onGVarValueChange(quint8 index, qint32 value);
+    void refreshOutputs();
     void onPhaseChanged(qint32 phase, const QString &);
 
   protected:
@@ -68,6 +65,9 @@ class RadioOutputsWidget : public QWidget
     void setupLsDisplay();
     void setupGVarsDisplay();
     QWidget * createLogicalSwitch(QWidget * parent, int switchNo);
+    void setChannelValue(const QPair<QLabel *, QSlider *> & ch, qint32 value, qint32 limit);
+    void setVirtSwValue(quint8 index, qint32 value);
+    void setGVarValue(quint8 index, qint32 value);
 
     SimulatorInterface * m_simulator;
     Firmware * m_firmware;
@@ -77,6 +77,11 @@ class RadioOutputsWidget : public QWidget
     QHash<int, QLabel *> m_logicSwitchMap;                  // m_logicSwitchMap[lsIndex] = QLabel*
     QHash<int, QHash<int, QLabel *> > m_globalVarsMap;      // m_globalVarsMap[gvarIndex][fmodeIndex] = QLabel*
 
+    QTimer m_refreshTimer;
+    SimulatorInterface::TxOutputs m_lastOutputs;
+    quint32 m_lastOutputsSerial;
+    bool m_refreshAll;
+
     int m_radioProfileId;
     int m_dataUpdateFreq;
 
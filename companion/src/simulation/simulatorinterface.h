@@ -133,6 +133,8 @@ class SimulatorInterface : public QObject
       bool vsw[CPN_MAX_LOGICAL_SWITCHES];  // virtual/logic switches
       int8_t phase;
       qint16 trimRange;                  // TRIM_MAX or TRIM_EXTENDED_MAX
+      qint32 chansLimit;                 // range of chans[]
+      qint32 mixesLimit;                 // range of ex_chans[]
       // bool beep;
     };
 
@@ -145,6 +147,10 @@ class SimulatorInterface : public QObject
     virtual uint8_t getSensorInstance(uint16_t id, uint8_t defaultValue = 0) = 0;
     virtual uint16_t getSensorRatio(uint16_t id) = 0;
     virtual const int getCapability(Capability cap) = 0;
+    // Latest outputs snapshot, lock-free (can be called from any thread).
+    // 'serial' is incremented for each new snapshot, returns false if no
+    // consistent snapshot could be read.
+    virtual bool getOutputs(TxOutputs & outputs, quint32 & serial) = 0;
 
   public slots:
 
@@ -180,13 +186,8 @@ class SimulatorInterface : public QObject
     void runtimeError(const QString & error);
     void lcdChange(bool backlightEnable);
     void phaseChanged(qint8 phase, const QString & name);
-    void channelOutValueChange(quint8 index, qint32 value, qint32 limit);
-    void channelMixValueChange(quint8 index, qint32 value, qint32 limit);
-    void virtualSwValueChange(quint8 index, qint32 value);
     void trimValueChange(quint8 index, qint32 value);
     void trimRangeChange(quint8 index, qint32 min, qint16 max);
-    void gVarValueChange(quint8 index, qint32 value);
-    void outputValueChange(int type, quint8 index, qint32 value);
     void auxSerialSendData(const quint8 port_num, const QByteArray & data);
     void auxSerialSetEncoding(const quint8 port_num, const quint8 encoding);
     void auxSerialSetBaudrate(const quint8 port_num, const quint32 baudrate);
@@ -205,6 +205,7 @@ void referenceSystemAudioFiles()
   DIR dir;
 
   sdAvailableSystemAudioFiles.reset();
+  promptCache.invalidate();
 
 #if defined(SIMU)
   // f_readdir does an f_stat call on every file when running in the simulator
@@ -365,6 +366,7 @@ AudioQueue::AudioQueue()
 }
 
 #define CODEC_ID_PCM_S16LE  1
+#define CODEC_ID_IMA_ADPCM  0x11
 
 
 static void _audio_lock()
@@ -389,101 +391,575 @@ static void _audio_unlock()
   #define _sat_u16(x) __USAT((x), 16)
 #endif
 
-inline void mixSample(audio_data_t * result, int16_t sample, unsigned int fade)
+void AudioGain::mix(int32_t * accu, const int16_t * samples, int count,
+                    int32_t target)
 {
-  int32_t tmp = (int32_t)*result + ((int32_t)sample >> fade);
-#if AUDIO_SAMPLE_FMT == AUDIO_SAMPLE_FMT_S16
-  *result = (audio_data_t)_sat_s16(tmp);
-#elif AUDIO_SAMPLE_FMT == AUDIO_SAMPLE_FMT_U16
-  *result = (audio_data_t)_sat_u16((uint32_t)tmp);
-#endif
+  int i = 0;
+
+  if (gain != target) {
+    int32_t step = (target - gain) / AUDIO_GAIN_RAMP;
+    int ramp = min<int>(count, AUDIO_GAIN_RAMP);
+    for (; i < ramp; i++) {
+      gain += step;
+      accu[i] += (samples[i] * gain) >> 15;
+    }
+    if (ramp == AUDIO_GAIN_RAMP) gain = target;
+  }
+
+  for (; i < count; i++) {
+    accu[i] += (samples[i] * target) >> 15;
+  }
+}
+
+static inline int32_t getShiftGain(int shift)
+{
+  return shift <= 0 ? AUDIO_GAIN_ONE : (shift >= 15 ? 0 : AUDIO_GAIN_ONE >> shift);
+}
+
+bool AudioResampler::init(uint32_t freq)
+{
+  if (freq < 1000 || freq > AUDIO_RESAMPLER_MAX_FREQ) return false;
+
+  step = (((uint64_t)freq) << 16) / AUDIO_SAMPLE_RATE;
+  // the first output sample ends on the first input sample
+  pos = 1 << 16;
+  memclear(history, sizeof(history));
+  if (isBypassed()) return true;
+
+  // windowed sinc (Blackman), cut at the lowest Nyquist frequency
+  // (normalized to the input rate), with some margin for the short filter
+  float fc = 0.45f * min<uint32_t>(freq, AUDIO_SAMPLE_RATE) / freq;
+  const float center = AUDIO_RESAMPLER_TAPS / 2 - 1;
+  for (int p = 0; p < AUDIO_RESAMPLER_PHASES; p++) {
+    float h[AUDIO_RESAMPLER_TAPS];
+    float sum = 0;
+    for (int k = 0; k < AUDIO_RESAMPLER_TAPS; k++) {
+      float t = k - center - float(p) / AUDIO_RESAMPLER_PHASES;
+      float x = 2.0f * float(M_PI) * fc * t;
+      float sinc = (t == 0) ? 1.0f : sinf(x) / x;
+      float w = 2.0f * float(M_PI) * (t / AUDIO_RESAMPLER_TAPS + 0.5f);
+      float window = 0.42f - 0.5f * cosf(w) + 0.08f * cosf(2 * w);
+      h[k] = sinc * window;
+      sum += h[k];
+    }
+    // unity gain for each phase
+    for (int k = 0; k < AUDIO_RESAMPLER_TAPS; k++) {
+      coefs[p][k] = lroundf(h[k] * (1 << 14) / sum);
+    }
+  }
+
+  return true;
+}
+
+uint32_t AudioResampler::inputNeeded(uint32_t count) const
+{
+  if (!count) return 0;
+  return (pos + (int64_t)(count - 1) * step) >> 16;
+}
+
+// The input is seen as history (last TAPS samples of the previous call)
+// followed by 'in': output sample at 'pos' uses the TAPS samples from
+// pos (integer part), the phase is given by the fractional part.
+// The next position after a call may still be in the history: the last
+// output samples of a call may not need all the samples of 'in' yet.
+int AudioResampler::process(const int16_t * in, uint32_t inCount, int16_t * out,
+                            uint32_t count)
+{
+  constexpr uint32_t HISTORY = AUDIO_RESAMPLER_TAPS;
+  constexpr uint32_t PHASE_SHIFT = 16 - 5;
+  static_assert(AUDIO_RESAMPLER_PHASES == 1 << 5, "");
+
+  if (isBypassed()) {
+    if (count > inCount) count = inCount;
+    memcpy(out, in, count * sizeof(int16_t));
+    return count;
+  }
+
+  auto sample = [&](uint32_t idx) {
+    return idx < HISTORY ? history[idx] : in[idx - HISTORY];
+  };
+
+  uint32_t done = 0;
+  for (; done < count && uint32_t(pos >> 16) <= inCount; done++) {
+    uint32_t idx = pos >> 16;
+    const int16_t * c = coefs[(pos >> PHASE_SHIFT) & (AUDIO_RESAMPLER_PHASES - 1)];
+    int32_t acc = 0;
+    if (idx >= HISTORY) {
+      const int16_t * x = &in[idx - HISTORY];
+      for (uint32_t k = 0; k < AUDIO_RESAMPLER_TAPS; k++) acc += c[k] * x[k];
+    } else {
+      for (uint32_t k = 0; k < AUDIO_RESAMPLER_TAPS; k++) acc += c[k] * sample(idx + k);
+    }
+    out[done] = _sat_s16(acc >> 14);
+    pos += step;
+  }
+
+  // keep the last samples for the next call
+  uint32_t total = HISTORY + inCount;
+  int16_t last[HISTORY];
+  for (uint32_t k = 0; k < HISTORY; k++) {
+    last[k] = sample(total - HISTORY + k);
+  }
+  memcpy(history, last, sizeof(history));
+  pos -= int32_t(inCount << 16);
+  // more input than inputNeeded(count): the samples before the history
+  // are lost
+  if (pos < 0) pos = 0;
+
+  return done;
+}
+
+static const int16_t adpcmStepTable[89] = {
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41,
+  45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209,
+  230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876,
+  963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749,
+  3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+  9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385,
+  24623, 27086, 29794, 32767
+};
+
+static const int8_t adpcmIndexTable[16] = {
+  -1, -1, -1, -1, 2, 4, 6, 8,
+  -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+bool AdpcmDecoder::init(uint32_t blockSize, uint32_t samplesPerBlock)
+{
+  if (blockSize < ADPCM_MIN_BLOCK_SIZE || blockSize > UINT16_MAX / 2 ||
+      samplesPerBlock != (blockSize - 4) * 2 + 1)
+    return false;
+
+  this->blockSize = blockSize;
+  blockLeft = 0;
+  predictor = 0;
+  stepIndex = 0;
+  nibble = ADPCM_NO_NIBBLE;
+  return true;
+}
+
+uint32_t AdpcmDecoder::bytesNeeded(uint32_t count) const
+{
+  uint32_t bytes = 0;
+  uint32_t left = blockLeft;
+
+  if (count > 0 && nibble != ADPCM_NO_NIBBLE) {
+    count--;
+    left--;
+  }
+
+  while (count > 0) {
+    if (left == 0) {
+      bytes += 4;
+      count--;
+      left = (blockSize - 4) * 2;
+    }
+    else {
+      uint32_t n = min(count, left);
+      bytes += (n + 1) / 2;
+      count -= n;
+      left -= n;
+    }
+  }
+
+  return bytes;
+}
+
+inline int16_t AdpcmDecoder::decodeSample(uint8_t code)
+{
+  int32_t step = adpcmStepTable[stepIndex];
+  int32_t diff = step >> 3;
+  if (code & 4) diff += step;
+  if (code & 2) diff += step >> 1;
+  if (code & 1) diff += step >> 2;
+
+  predictor = _sat_s16(predictor + (code & 8 ? -diff : diff));
+  stepIndex = limit<int>(0, stepIndex + adpcmIndexTable[code], DIM(adpcmStepTable) - 1);
+  return predictor;
+}
+
+uint32_t AdpcmDecoder::decode(const uint8_t * in, uint32_t size, int16_t * out,
+                              uint32_t count)
+{
+  const uint8_t * end = in + size;
+  uint32_t done = 0;
+
+  while (done < count) {
+    uint8_t code;
+    if (nibble != ADPCM_NO_NIBBLE) {
+      code = nibble;
+      nibble = ADPCM_NO_NIBBLE;
+    }
+    else if (blockLeft == 0) {
+      if (end - in < 4) break;
+      predictor = (int16_t)(in[0] | (in[1] << 8));
+      stepIndex = min<uint8_t>(in[2], DIM(adpcmStepTable) - 1);
+      in += 4;
+      blockLeft = (blockSize - 4) * 2;
+      out[done++] = predictor;
+      continue;
+    }
+    else {
+      if (in == end) break;
+      code = *in & 0x0F;
+      nibble = *in++ >> 4;
+    }
+    blockLeft--;
+    out[done++] = decodeSample(code);
+  }
+
+  return done;
+}
+
+PromptCache promptCache;
+
+uint32_t PromptCache::getKey(const char * filename)
+{
+  // FNV-1a, not case sensitive (like the file system), never 0 (free head)
+  uint32_t hash = 2166136261u;
+  while (*filename) {
+    hash ^= (uint8_t)toupper(*filename++);
+    hash *= 16777619u;
+  }
+  return hash ? hash : 1;
+}
+
+void PromptCache::checkValid()
+{
+  if (invalidated) {
+    invalidated = false;
+    count = 0;
+    for (auto & head : heads) {
+      head.key = 0;
+      head.size = 0;
+    }
+  }
+}
+
+PromptCache::Entry * PromptCache::getEntry(uint32_t key)
+{
+  for (uint8_t i = 0; i < count; i++) {
+    if (entries[i].key == key) return &entries[i];
+  }
+  return nullptr;
+}
+
+void PromptCache::remove(Entry * entry)
+{
+  for (auto & head : heads) {
+    if (head.key == entry->key) {
+      head.key = 0;
+      head.size = 0;
+    }
+  }
+  *entry = entries[--count];
+}
+
+const PromptInfo * PromptCache::find(uint32_t key, const PromptStamp & stamp)
+{
+  checkValid();
+
+  Entry * entry = getEntry(key);
+  if (!entry) return nullptr;
+
+  if (!(entry->stamp == stamp)) {
+    // file replaced (or hash collision)
+    remove(entry);
+    return nullptr;
+  }
+
+  entry->lastUse = ++uses;
+  if (entry->hits < UINT8_MAX) entry->hits++;
+  return &entry->info;
+}
+
+void PromptCache::add(uint32_t key, const PromptStamp & stamp, const PromptInfo & info)
+{
+  checkValid();
+
+  Entry * entry = getEntry(key);
+  if (entry) {
+    remove(entry);
+  }
+
+  if (count < PROMPT_CACHE_ENTRIES) {
+    entry = &entries[count++];
+  }
+  else {
+    // least recently used
+    entry = &entries[0];
+    for (auto & e : entries) {
+      if ((uint16_t)(uses - e.lastUse) > (uint16_t)(uses - entry->lastUse))
+        entry = &e;
+    }
+  }
+
+  entry->key = key;
+  entry->lastUse = ++uses;
+  entry->hits = 1;
+  entry->stamp = stamp;
+  entry->info = info;
+}
+
+uint8_t PromptCache::getHead(uint32_t key, bool & fill)
+{
+  fill = false;
+
+  Entry * entry = getEntry(key);
+  if (!entry || entry->hits < 2) return PROMPT_CACHE_NO_HEAD;
+
+  // a free slot, or the least recently used
+  uint8_t index = 0;
+  for (uint8_t i = 0; i < PROMPT_CACHE_HEADS; i++) {
+    Head & head = heads[i];
+    if (head.key == key) {
+      head.lastUse = uses;
+      fill = (head.size == 0);
+      return i;
+    }
+    if (heads[index].key != 0 &&
+        (head.key == 0 || (uint16_t)(uses - head.lastUse) >
+                              (uint16_t)(uses - heads[index].lastUse)))
+      index = i;
+  }
+
+  Head & head = heads[index];
+  head.key = key;
+  head.lastUse = uses;
+  head.size = 0;
+  fill = true;
+  return index;
 }
 
+uint8_t * PromptCache::getHeadData(uint8_t index, uint32_t key, uint16_t & size)
+{
+  Head & head = heads[index];
+  if (head.key != key) return nullptr;
+  size = head.size;
+  return head.data;
+}
+
+// Scratch buffers, used by one voice at a time (audio task only)
+#define WAV_BUFFER_SAMPLES (AUDIO_BUFFER_SIZE * AUDIO_RESAMPLER_MAX_FREQ / AUDIO_SAMPLE_RATE + 1)
+static int16_t wavBuffer[WAV_BUFFER_SAMPLES] __DMA;
+static int16_t voiceBuffer[AUDIO_BUFFER_SIZE];
+static int32_t mixAccu[AUDIO_BUFFER_SIZE];
+
 #define RIFF_CHUNK_SIZE 12
-uint8_t wavBuffer[AUDIO_BUFFER_SIZE * 2] __DMA;
 
-int WavContext::mixBuffer(AudioBuffer *buffer, int volume, unsigned int fade)
+FRESULT WavContext::parseHeader(PromptInfo & info)
 {
-  FRESULT result = FR_OK;
+  uint8_t * header = (uint8_t *)wavBuffer;
   UINT read = 0;
 
-  if(fragment.fragmentVolume != USE_SETTINGS_VOLUME)
-    volume = fragment.fragmentVolume;
+  FRESULT result = f_read(&state.file, header, RIFF_CHUNK_SIZE+8, &read);
+  if (result != FR_OK) return result;
+  if (read != RIFF_CHUNK_SIZE+8 || memcmp(header, "RIFF", 4) || memcmp(header+8, "WAVEfmt ", 8))
+    return FR_DENIED;
+
+  uint32_t size = *((uint32_t *)(header+16));
+  if (size >= 256) return FR_DENIED;
+  result = f_read(&state.file, header, size+8, &read);
+  if (result != FR_OK) return result;
+  if (read != size+8) return FR_DENIED;
+
+  memclear(&info, sizeof(info));
+  uint16_t * fmt = (uint16_t *)header;
+  info.codec = fmt[0];
+  info.freq = ((uint32_t *)header)[1];
+  if (info.codec == CODEC_ID_IMA_ADPCM) {
+    // mono, 4 bits, samples per block in the extra format bytes
+    if (size < 20 || fmt[1] != 1 || fmt[7] != 4) return FR_DENIED;
+    info.blockSize = fmt[6];
+    info.samplesPerBlock = fmt[9];
+  }
+  else if (info.codec != CODEC_ID_PCM_S16LE) {
+    return FR_DENIED;
+  }
+
+  uint32_t * chunk = (uint32_t *)(header + size);
+  size = chunk[1];
+  while (memcmp(chunk, "data", 4) != 0) {
+    result = f_lseek(&state.file, f_tell(&state.file)+size);
+    if (result == FR_OK) result = f_read(&state.file, header, 8, &read);
+    if (result != FR_OK) return result;
+    if (read != 8) return FR_DENIED;
+    chunk = (uint32_t *)header;
+    size = chunk[1];
+  }
+
+  info.dataOffset = f_tell(&state.file);
+  info.dataSize = size;
+  return FR_OK;
+}
+
+FRESULT WavContext::openFile()
+{
+  // a previous file may have been stopped while playing
+  closeFile();
+
+  state.key = PromptCache::getKey(fragment.file);
+  state.pos = 0;
+
+  // directory entry only, much cheaper than parsing the header again
+  FILINFO fno;
+  FRESULT result = f_stat(fragment.file, &fno);
+  if (result != FR_OK) return result;
+  PromptStamp stamp = {(uint32_t)fno.fsize, fno.fdate, fno.ftime};
 
-  if (fragment.file[1]) {
+  const PromptInfo * info = promptCache.find(state.key, stamp);
+  if (info) {
+    state.info = *info;
+  }
+  else {
     result = f_open(&state.file, fragment.file, FA_OPEN_EXISTING | FA_READ);
-    fragment.file[1] = 0;
+    if (result != FR_OK) return result;
+    state.fileOpen = true;
+    result = parseHeader(state.info);
+    if (result != FR_OK) return result;
+  }
+
+  if (state.info.codec == CODEC_ID_IMA_ADPCM &&
+      !state.adpcm.init(state.info.blockSize, state.info.samplesPerBlock))
+    return FR_DENIED;
+  if (!state.resampler.init(state.info.freq))
+    return FR_DENIED;
+
+  if (!info) promptCache.add(state.key, stamp, state.info);
+  state.size = state.info.dataSize;
+
+  bool fill;
+  state.head = promptCache.getHead(state.key, fill);
+  if (fill) {
+    uint16_t size;
+    uint8_t * head = promptCache.getHeadData(state.head, state.key, size);
+    UINT read = 0;
+    result = seekData();
     if (result == FR_OK) {
-      result = f_read(&state.file, wavBuffer, RIFF_CHUNK_SIZE+8, &read);
-      if (result == FR_OK && read == RIFF_CHUNK_SIZE+8 && !memcmp(wavBuffer, "RIFF", 4) && !memcmp(wavBuffer+8, "WAVEfmt ", 8)) {
-        uint32_t size = *((uint32_t *)(wavBuffer+16));
-        result = (size < 256 ? f_read(&state.file, wavBuffer, size+8, &read) : FR_DENIED);
-        if (result == FR_OK && read == size+8) {
-          state.codec = ((uint16_t *)wavBuffer)[0];
-          state.freq = ((uint16_t *)wavBuffer)[2];
-          uint32_t *wavSamplesPtr = (uint32_t *)(wavBuffer + size);
-          uint32_t size = wavSamplesPtr[1];
-          if (state.freq != 0 && state.freq * (AUDIO_SAMPLE_RATE / state.freq) == AUDIO_SAMPLE_RATE) {
-            state.resampleRatio = (AUDIO_SAMPLE_RATE / state.freq);
-            state.readSize = (state.codec == CODEC_ID_PCM_S16LE ? 2*AUDIO_BUFFER_SIZE : AUDIO_BUFFER_SIZE) / state.resampleRatio;
-          }
-          else {
-            result = FR_DENIED;
-          }
-          while (result == FR_OK && memcmp(wavSamplesPtr, "data", 4) != 0) {
-            result = f_lseek(&state.file, f_tell(&state.file)+size);
-            if (result == FR_OK) {
-              result = f_read(&state.file, wavBuffer, 8, &read);
-              if (read != 8) result = FR_DENIED;
-              wavSamplesPtr = (uint32_t *)wavBuffer;
-              size = wavSamplesPtr[1];
-            }
-          }
-          state.size = size;
-        }
-        else {
-          result = FR_DENIED;
-        }
-      }
-      else {
-        result = FR_DENIED;
-      }
+      result = f_read(&state.file, head, min<uint32_t>(PROMPT_CACHE_HEAD_SIZE, state.size), &read);
     }
+    if (result != FR_OK) return result;
+    promptCache.setHeadSize(state.head, read);
   }
 
-  if (result == FR_OK) {
-    read = 0;
-    result = f_read(&state.file, wavBuffer, state.readSize, &read);
-    if (result == FR_OK) {
-      if (read > state.size) {
-        read = state.size;
-      }
-      state.size -= read;
+  return FR_OK;
+}
 
-      if (read != state.readSize) {
-        f_close(&state.file);
-        fragment.clear();
-      }
+// Opens the file if only its head has been played so far, and moves to
+// the current position in the data
+FRESULT WavContext::seekData()
+{
+  if (!state.fileOpen) {
+    FRESULT result = f_open(&state.file, fragment.file, FA_OPEN_EXISTING | FA_READ);
+    if (result != FR_OK) return result;
+    state.fileOpen = true;
+  }
 
-      audio_data_t * samples = buffer->data;
-      if (state.codec == CODEC_ID_PCM_S16LE) {
-        read /= 2;
-        for (uint32_t i=0; i<read; i++) {
-          for (uint8_t j=0; j<state.resampleRatio; j++) {
-            mixSample(samples++, ((int16_t *)wavBuffer)[i], fade+2-volume);
-          }
-        }
-      }
+  uint32_t offset = state.info.dataOffset + state.pos;
+  if (f_tell(&state.file) != offset) {
+    return f_lseek(&state.file, offset);
+  }
+  return FR_OK;
+}
 
-      return samples - buffer->data;
+FRESULT WavContext::readData(uint8_t * data, uint32_t size, UINT * read)
+{
+  *read = 0;
+
+  if (state.head != PROMPT_CACHE_NO_HEAD) {
+    uint16_t headSize;
+    const uint8_t * head = promptCache.getHeadData(state.head, state.key, headSize);
+    if (!head) {
+      // given to another file
+      state.head = PROMPT_CACHE_NO_HEAD;
+    }
+    else if (state.pos < headSize) {
+      uint32_t count = min<uint32_t>(size, headSize - state.pos);
+      memcpy(data, head + state.pos, count);
+      state.pos += count;
+      *read = count;
+      data += count;
+      size -= count;
     }
   }
 
-  if (result != FR_OK) {
+  if (size > 0) {
+    FRESULT result = seekData();
+    if (result != FR_OK) return result;
+    UINT count = 0;
+    result = f_read(&state.file, data, size, &count);
+    state.pos += count;
+    *read += count;
+    return result;
+  }
+
+  return FR_OK;
+}
+
+void WavContext::closeFile()
+{
+  if (state.fileOpen) {
     f_close(&state.file);
+    state.fileOpen = false;
+  }
+}
+
+int WavContext::mixBuffer(int32_t * accu, int volume, unsigned int fade)
+{
+  if(fragment.fragmentVolume != USE_SETTINGS_VOLUME)
+    volume = fragment.fragmentVolume;
+
+  if (!fragment.file[0]) {
+    // stopped
+    closeFile();
+    state.playing = false;
+    return 0;
+  }
+
+  if (!state.playing) {
+    state.gain.reset();
+    if (openFile() != FR_OK) {
+      closeFile();
+      clear();
+      return 0;
+    }
+    state.playing = true;
+  }
+
+  uint32_t samples = state.resampler.inputNeeded(AUDIO_BUFFER_SIZE);
+  uint8_t * data = (uint8_t *)wavBuffer;
+  uint32_t readSize = samples * sizeof(int16_t);
+  if (state.info.codec == CODEC_ID_IMA_ADPCM) {
+    // voiceBuffer is free until the resampler writes to it
+    data = (uint8_t *)voiceBuffer;
+    readSize = min<uint32_t>(state.adpcm.bytesNeeded(samples), sizeof(voiceBuffer));
+  }
+  readSize = min(readSize, state.size);
+
+  UINT read = 0;
+  if (readData(data, readSize, &read) != FR_OK) {
+    closeFile();
     clear();
+    state.playing = false;
+    return 0;
+  }
+
+  state.size -= read;
+  if (read != readSize || state.size == 0) {
+    closeFile();
+    fragment.clear();
+    state.playing = false;
   }
-  return 0;
+
+  if (state.info.codec == CODEC_ID_IMA_ADPCM)
+    samples = state.adpcm.decode(data, read, wavBuffer, samples);
+  else
+    samples = read / sizeof(int16_t);
+
+  int count = state.resampler.process(wavBuffer, samples, voiceBuffer,
+                                      AUDIO_BUFFER_SIZE);
+  state.gain.mix(accu, voiceBuffer, count, getShiftGain(fade + 2 - volume));
+  return count;
 }
 
 const uint8_t toneVolumes[] = { 10, 8, 6, 4, 2 };
@@ -496,7 +972,7 @@ inline float evalVolumeRatio(int freq, int volume)
   return result;
 }
 
-int ToneContext::mixBuffer(AudioBuffer * buffer, int volume, unsigned int fade)
+int ToneContext::mixBuffer(int32_t * accu, int volume, unsigned int fade)
 {
   int duration = 0;
   int result = 0;
@@ -565,13 +1041,14 @@ int ToneContext::mixBuffer(AudioBuffer * buffer, int volume, unsigned int fade)
         sineVal = -sineValues[sineIdx - SINE_INDEX_Q2];
       else
         sineVal = -sineValues[MAX_SINE_INDEX - sineIdx];
-      int16_t sample = sineVal * state.volume;
-      mixSample(&buffer->data[i], sample, fade);
+      voiceBuffer[i] = sineVal * state.volume;
       toneIdx += state.step;
       if ((unsigned int)toneIdx >= MAX_SINE_INDEX)
         toneIdx -= MAX_SINE_INDEX;
     }
 
+    state.gain.mix(accu, voiceBuffer, points, getShiftGain(fade));
+
     if (remainingDuration > AUDIO_BUFFER_DURATION) {
       state.duration += AUDIO_BUFFER_DURATION;
       state.idx = toneIdx;
@@ -594,6 +1071,19 @@ int ToneContext::mixBuffer(AudioBuffer * buffer, int volume, unsigned int fade)
   return result;
 }
 
+// Saturates the mixed voices into the output format
+static void audioConvertBuffer(audio_data_t * data, const int32_t * accu,
+                               uint32_t count)
+{
+  for (uint32_t i = 0; i < count; i++) {
+#if AUDIO_SAMPLE_FMT == AUDIO_SAMPLE_FMT_S16
+    data[i] = (audio_data_t)_sat_s16(accu[i]);
+#elif AUDIO_SAMPLE_FMT == AUDIO_SAMPLE_FMT_U16
+    data[i] = (audio_data_t)(_sat_s16(accu[i]) + AUDIO_DATA_SILENCE);
+#endif
+  }
+}
+
 void AudioQueue::wakeup()
 {
   DEBUG_TIMER_START(debugTimerAudioConsume);
@@ -606,13 +1096,10 @@ void AudioQueue::wakeup()
     unsigned int fade = 0;
     int size = 0;
 
-    // write silence in the buffer
-    for (uint32_t i=0; i<AUDIO_BUFFER_SIZE; i++) {
-      buffer->data[i] = AUDIO_DATA_SILENCE; /* silence */
-    }
+    memclear(mixAccu, sizeof(mixAccu));
 
     // mix the priority context (only tones)
-    result = priorityContext.mixBuffer(buffer, g_eeGeneral.beepVolume, fade);
+    result = priorityContext.mixBuffer(mixAccu, g_eeGeneral.beepVolume, fade);
     if (result > 0) {
       size = result;
       fade += 1;
@@ -624,14 +1111,14 @@ void AudioQueue::wakeup()
       normalContext.setFragment(fragmentsFifo.get());
       _audio_unlock();
     }
-    result = normalContext.mixBuffer(buffer, g_eeGeneral.beepVolume, g_eeGeneral.wavVolume, fade);
+    result = normalContext.mixBuffer(mixAccu, g_eeGeneral.beepVolume, g_eeGeneral.wavVolume, fade);
     if (result > 0) {
       size = max(size, result);
       fade += 1;
     }
 
     // mix the vario context
-    result = varioContext.mixBuffer(buffer, g_eeGeneral.varioVolume, fade);
+    result = varioContext.mixBuffer(mixAccu, g_eeGeneral.varioVolume, fade);
     if (result > 0) {
       size = max(size, result);
       fade += 1;
@@ -639,7 +1126,7 @@ void AudioQueue::wakeup()
 
     // mix the background context
     if (isFunctionActive(FUNCTION_BACKGND_MUSIC) && !isFunctionActive(FUNCTION_BACKGND_MUSIC_PAUSE)) {
-      result = backgroundContext.mixBuffer(buffer, g_eeGeneral.backgroundVolume, fade);
+      result = backgroundContext.mixBuffer(mixAccu, g_eeGeneral.backgroundVolume, fade);
       if (result > 0) {
         size = max(size, result);
       }
@@ -648,6 +1135,7 @@ void AudioQueue::wakeup()
     // push the buffer if needed
     if (size > 0) {
       // TRACE("pushing buffer %p", buffer);
+      audioConvertBuffer(buffer->data, mixAccu, AUDIO_BUFFER_SIZE);
       buffer->size = size;
 
 #if defined(SOFTWARE_VOLUME)
@@ -774,6 +1262,7 @@ void AudioQueue::stopPlay(uint8_t id)
 void AudioQueue::stopSD()
 {
   sdAvailableSystemAudioFiles.reset();
+  promptCache.invalidate();
   stopAll();
   playTone(0, 0, 100, PLAY_NOW);        // insert a 100ms pause
 }
@@ -180,6 +180,170 @@ struct AudioFragment {
   }
 };
 
+// Voices are mixed into 32-bit accumulators (saturated once per buffer)
+// with a Q15 gain. Gain changes (e.g. a voice starting or stopping
+// attenuates the others) are ramped over AUDIO_GAIN_RAMP samples, so
+// that they do not click.
+#define AUDIO_GAIN_ONE    (1 << 15)
+#define AUDIO_GAIN_RAMP   (AUDIO_BUFFER_SIZE / 4)
+
+class AudioGain {
+  public:
+    void reset() { gain = 0; }
+
+    void mix(int32_t * accu, const int16_t * samples, int count, int32_t target);
+
+  private:
+    int32_t gain;
+};
+
+// Polyphase resampler: converts any rate up to 2 * AUDIO_SAMPLE_RATE to
+// AUDIO_SAMPLE_RATE, using a windowed sinc low pass at the lowest Nyquist
+// frequency of both rates (a phase is picked for each output sample)
+#define AUDIO_RESAMPLER_TAPS    8
+#define AUDIO_RESAMPLER_PHASES  32
+#define AUDIO_RESAMPLER_MAX_FREQ  (2 * AUDIO_SAMPLE_RATE)
+
+class AudioResampler {
+  public:
+    // false if the rate is not supported
+    bool init(uint32_t freq);
+
+    bool isBypassed() const { return step == (1 << 16); }
+
+    // number of input samples needed for 'count' output samples
+    uint32_t inputNeeded(uint32_t count) const;
+
+    // consumes all input samples (at most inputNeeded(count), more are
+    // dropped), returns the number of output samples
+    int process(const int16_t * in, uint32_t inCount, int16_t * out, uint32_t count);
+
+  private:
+    uint32_t step;   // input samples per output sample, Q16
+    int32_t pos;     // next output sample position in history + input, Q16
+    int16_t history[AUDIO_RESAMPLER_TAPS];
+    int16_t coefs[AUDIO_RESAMPLER_PHASES][AUDIO_RESAMPLER_TAPS];  // Q14
+};
+
+// IMA-ADPCM (WAVE_FORMAT_IMA_ADPCM, mono, 4 bits per sample), decoded
+// as a stream: each block starts with a 4 bytes header (first sample,
+// step index) followed by the samples, low nibble first. Prompts are
+// read from the SD card a few samples at a time, so the decoder keeps its
+// position in the current block between calls.
+#define ADPCM_MIN_BLOCK_SIZE  36
+#define ADPCM_NO_NIBBLE       0x10
+
+class AdpcmDecoder {
+  public:
+    // false if the block format is not supported
+    bool init(uint32_t blockSize, uint32_t samplesPerBlock);
+
+    // number of input bytes needed for 'count' samples
+    uint32_t bytesNeeded(uint32_t count) const;
+
+    // returns the number of samples decoded (less than 'count' only at the
+    // end of the input)
+    uint32_t decode(const uint8_t * in, uint32_t size, int16_t * out, uint32_t count);
+
+  private:
+    uint16_t blockSize;
+    uint16_t blockLeft;   // samples left in the current block, 0: header next
+    int16_t  predictor;
+    uint8_t  stepIndex;
+    uint8_t  nibble;      // high nibble of the last byte not decoded yet
+
+    int16_t decodeSample(uint8_t code);
+};
+
+// Prompt cache: keeps the parsed header of the last played files, so
+// that they are not parsed again, and the first bytes of the audio data
+// of the ones played more than once (numbers, units, timers...). Those
+// start playing from RAM, the file is only opened once these bytes have
+// been played (never for short prompts), so that sequences built by
+// playNumber() play back to back.
+#if !defined(PROMPT_CACHE_ENTRIES)
+  #if defined(COLORLCD)
+    #define PROMPT_CACHE_ENTRIES     64
+    #define PROMPT_CACHE_HEADS       16
+    #define PROMPT_CACHE_HEAD_SIZE   1024
+  #else
+    #define PROMPT_CACHE_ENTRIES     24
+    #define PROMPT_CACHE_HEADS       4
+    #define PROMPT_CACHE_HEAD_SIZE   512
+  #endif
+#endif
+
+#define PROMPT_CACHE_NO_HEAD  0xFF
+
+struct PromptInfo {
+  uint32_t dataOffset;
+  uint32_t dataSize;
+  uint32_t freq;
+  uint16_t blockSize;        // ADPCM only
+  uint16_t samplesPerBlock;  // ADPCM only
+  uint16_t codec;
+};
+
+// What the file looked like when it was cached (FatFs FILINFO fields)
+struct PromptStamp {
+  uint32_t size;
+  uint16_t date;
+  uint16_t time;
+
+  bool operator==(const PromptStamp & other) const
+  {
+    return size == other.size && date == other.date && time == other.time;
+  }
+};
+
+class PromptCache {
+  public:
+    // may be called from any task, the cache is emptied on next use
+    void invalidate() { invalidated = true; }
+
+    static uint32_t getKey(const char * filename);
+
+    // returns nullptr if the file is not in the cache, or if it was
+    // replaced since (the entry and its head are then dropped)
+    const PromptInfo * find(uint32_t key, const PromptStamp & stamp);
+    void add(uint32_t key, const PromptStamp & stamp, const PromptInfo & info);
+
+    // head slot of a file played more than once, allocated if needed
+    // ('fill' then tells that the data has to be read into it)
+    uint8_t getHead(uint32_t key, bool & fill);
+    void setHeadSize(uint8_t head, uint16_t size) { heads[head].size = size; }
+
+    // nullptr if the slot was given to another file meanwhile
+    uint8_t * getHeadData(uint8_t head, uint32_t key, uint16_t & size);
+
+  private:
+    struct Entry {
+      uint32_t key;
+      uint16_t lastUse;
+      uint8_t  hits;
+      PromptStamp stamp;
+      PromptInfo info;
+    };
+    struct Head {
+      uint32_t key;
+      uint16_t lastUse;
+      uint16_t size;
+      uint8_t  data[PROMPT_CACHE_HEAD_SIZE];
+    };
+
+    Entry entries[PROMPT_CACHE_ENTRIES];
+    Head heads[PROMPT_CACHE_HEADS];
+    uint8_t count;
+    uint16_t uses;
+    volatile bool invalidated;
+
+    void checkValid();
+    Entry * getEntry(uint32_t key);
+    void remove(Entry * entry);
+};
+
+extern PromptCache promptCache;
+
 class ToneContext {
   public:
 
@@ -195,7 +359,7 @@ class ToneContext {
       return fragment.type == FRAGMENT_EMPTY;
     }
 
-    int mixBuffer(AudioBuffer *buffer, int volume, unsigned int fade);
+    int mixBuffer(int32_t * accu, int volume, unsigned int fade);
 
     void setFragment(uint16_t freq, uint16_t duration, uint16_t pause, uint8_t repeat, int8_t freqIncr, bool reset, int8_t fragmentVolume, uint8_t id = 0)
     {
@@ -212,6 +376,7 @@ class ToneContext {
       uint16_t freq;
       uint16_t duration;
       uint16_t pause;
+      AudioGain gain;
     } state;
 
 };
@@ -221,12 +386,13 @@ class WavContext {
 
     inline void clear() { fragment.clear(); };
 
-    int mixBuffer(AudioBuffer *buffer, int volume, unsigned int fade);
+    int mixBuffer(int32_t * accu, int volume, unsigned int fade);
     bool hasPromptId(uint8_t id) const { return fragment.id == id; };
 
     void setFragment(const char * filename, uint8_t repeat, int8_t fragmentVolume, uint8_t id)
     {
       fragment = AudioFragment(filename, repeat, fragmentVolume, id);
+      state.playing = false;
     }
 
     void stop(uint8_t id)
@@ -239,13 +405,24 @@ class WavContext {
   private:
     AudioFragment fragment;
 
+    FRESULT openFile();
+    FRESULT parseHeader(PromptInfo & info);
+    FRESULT seekData();
+    FRESULT readData(uint8_t * data, uint32_t size, UINT * read);
+    void closeFile();
+
     struct {
       FIL      file;
-      uint8_t  codec;
-      uint32_t freq;
-      uint32_t size;
-      uint8_t  resampleRatio;
-      uint16_t readSize;
+      bool     fileOpen;
+      bool     playing;
+      PromptInfo info;
+      uint32_t key;
+      uint32_t pos;   // data bytes read
+      uint32_t size;  // data bytes left
+      uint8_t  head;
+      AdpcmDecoder adpcm;
+      AudioResampler resampler;
+      AudioGain gain;
     } state;
 };
 
@@ -263,13 +440,15 @@ class MixedContext {
     void setFragment(const AudioFragment * frag)
     {
       if (frag) {
+        clear();  // tone state overlaps the previous wav state
         fragment = *frag;
       }
     }
 
     inline void clear()
     {
-      tone.clear();   // the biggest member of the uninon
+      memset(reinterpret_cast<void*>(this), 0, sizeof(MixedContext));
+      fragment.fragmentVolume = USE_SETTINGS_VOLUME;
     }
 
     bool isEmpty() const { return fragment.type == FRAGMENT_EMPTY; };
@@ -277,12 +456,12 @@ class MixedContext {
     bool isFile() const { return fragment.type == FRAGMENT_FILE; };
     bool hasPromptId(uint8_t id) const { return fragment.id == id; };
 
-    int mixBuffer(AudioBuffer *buffer, int toneVolume, int wavVolume, unsigned int fade)
+    int mixBuffer(int32_t * accu, int toneVolume, int wavVolume, unsigned int fade)
     {
       if (isTone())
-        return tone.mixBuffer(buffer, toneVolume, fade);
+        return tone.mixBuffer(accu, toneVolume, fade);
       else if (isFile())
-        return wav.mixBuffer(buffer, wavVolume, fade);
+        return wav.mixBuffer(accu, wavVolume, fade);
       return 0;
     }
 
@@ -135,13 +135,15 @@ char * Bluetooth::readline(bool error_reset)
 
 void Bluetooth::processTrainerFrame(const uint8_t * buffer)
 {
+  int16_t channels[BLUETOOTH_TRAINER_CHANNELS];
   for (uint8_t channel=0, i=1; channel<BLUETOOTH_TRAINER_CHANNELS; channel+=2, i+=3) {
     // +-500 != 512, but close enough.
-    trainerInput[channel] = buffer[i] + ((buffer[i+1] & 0xf0) << 4) - 1500;
-    trainerInput[channel+1] = ((buffer[i+1] & 0x0f) << 4) + ((buffer[i+2] & 0xf0) >> 4) + ((buffer[i+2] & 0x0f) << 8) - 1500;
+    channels[channel] = buffer[i] + ((buffer[i+1] & 0xf0) << 4) - 1500;
+    channels[channel+1] = ((buffer[i+1] & 0x0f) << 4) + ((buffer[i+2] & 0xf0) >> 4) + ((buffer[i+2] & 0x0f) << 8) - 1500;
   }
 
-  trainerResetTimer();
+  trainerPushChannels(TRAINER_SOURCE_BLUETOOTH, 0, channels,
+                      BLUETOOTH_TRAINER_CHANNELS, timersGetMsTick());
 }
 
 void Bluetooth::appendTrainerByte(uint8_t data)
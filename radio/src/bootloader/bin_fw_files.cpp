@@ -30,6 +30,7 @@
 #include "strhelpers.h"
 #include "hal/storage.h"
 #include "flash_driver.h"
+#include "hal/flash_writer.h"
 
 // Size of the block read when checking / writing BIN files
 #define BLOCK_LEN 4096
@@ -53,23 +54,17 @@ static FWFileInfo  fwFiles[MAX_FW_FILES];
 static uint8_t     Block_buffer[BLOCK_LEN];
 static UINT        BlockCount;
 
-static void flashWriteBlock()
+static FlashWriter flashWriter;
+
+static int flashWriteBlock()
 {
-  // TODO: use some board provided driver instead
-  uint32_t blockOffset = 0;
 #if !defined(SIMU)
-  while (BlockCount) {
-    flashWrite((uint32_t *)firmwareAddress, (uint32_t *)&Block_buffer[blockOffset]);
-    blockOffset += FLASH_PAGESIZE;
-    firmwareAddress += FLASH_PAGESIZE;
-    if (BlockCount > FLASH_PAGESIZE) {
-      BlockCount -= FLASH_PAGESIZE;
-    }
-    else {
-      BlockCount = 0;
-    }
-  }
+  if (flashWriter.write(firmwareAddress, Block_buffer, BlockCount) < 0)
+    return -1;
+  firmwareAddress += BlockCount;
+  BlockCount = 0;
 #endif // SIMU
+  return 0;
 }
 
 void sdInit(void)
@@ -265,19 +260,30 @@ void firmwareInitWrite(uint32_t index)
   firmwareSize = fwFiles[index].size - BOOTLOADER_SIZE;
   firmwareAddress = FIRMWARE_ADDRESS + BOOTLOADER_SIZE;
   firmwareWritten = 0;
+
+#if !defined(SIMU)
+  // targets with only the internal flash do not register it
+  if (!flashFindDriver(firmwareAddress)) {
+    flashRegisterDriver(FIRMWARE_ADDRESS, FLASHSIZE, &stm32_flash_driver);
+  }
+#endif
+  flashWriter.begin(firmwareAddress, firmwareSize);
 }
 
-bool firmwareWriteBlock(uint32_t* progress)
+int firmwareWriteBlock(uint32_t* progress)
 {
-  flashWriteBlock();
+  if (flashWriteBlock() < 0) return -1;
   firmwareWritten += sizeof(Block_buffer);
   *progress = (100 * firmwareWritten) / firmwareSize;
 
   readFirmwareFile();
   if (BlockCount == 0 || firmwareWritten >= FLASHSIZE - BOOTLOADER_SIZE) {
-    return true;
+#if !defined(SIMU)
+    if (flashWriter.flush() < 0) return -1;
+#endif
+    return 1;
   }
 
-  return false;
+  return 0;
 }
 
@@ -244,9 +244,11 @@ void bootloaderMenu()
         }
       } else if (state == ST_FLASHING) {
         uint32_t progress = 0;
-        bool done = firmwareWriteBlock(&progress);
+        int result = firmwareWriteBlock(&progress);
         bootloaderDrawScreen(state, progress);
-        if(done) {
+        if (result < 0) {
+          state = ST_FLASH_FAILED;
+        } else if (result > 0) {
           state = ST_FLASH_DONE;
         }
 #if defined(SPI_FLASH)
@@ -278,13 +280,13 @@ void bootloaderMenu()
         }
       }
 
-      if (state == ST_FLASH_DONE) {
+      if (state == ST_FLASH_DONE || state == ST_FLASH_FAILED) {
         if (event == EVT_KEY_BREAK(KEY_EXIT) || event == EVT_KEY_BREAK(KEY_ENTER)) {
           state = ST_START;
           vpos = 0;
         }
 
-        bootloaderDrawScreen(state, 100);
+        bootloaderDrawScreen(state, state == ST_FLASH_DONE ? 100 : 0);
       }
 
       if (event == EVT_KEY_LONG(KEY_EXIT)) {
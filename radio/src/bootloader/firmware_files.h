@@ -71,5 +71,7 @@ FlashCheckRes checkFirmwareFile(unsigned int index, FlashCheckRes res);
 
 void firmwareInitWrite(uint32_t index);
 bool firmwareEraseBlock(uint32_t* progress);
-bool firmwareWriteBlock(uint32_t* progress);
+// Returns 1 once the whole file is written, 0 while in progress,
+// < 0 if programming the flash failed
+int firmwareWriteBlock(uint32_t* progress);
 
@@ -45,6 +45,7 @@
 #include "tasks/mixer_task.h"
 
 #include "cli.h"
+#include "serial_stream.h"
 
 #include <ctype.h>
 #include <malloc.h>
@@ -52,6 +53,11 @@
 #include <stdarg.h>
 
 #include "lua/lua_states.h"
+#include "lua/custom_allocator.h"
+#include "lua/lua_gc.h"
+#if defined(LUA_COMPILER)
+#include "lua/lua_cache.h"
+#endif
 
 #define CLI_COMMAND_MAX_ARGS           8
 #define CLI_COMMAND_MAX_LEN            256
@@ -137,6 +143,7 @@ void cliSetSerialDriver(void* ctx, const etx_serial_driver_t* drv)
       cliEnableDbg();
     }
   } else {
+    serialStreamStop();
     cliSetSendCb(nullptr, nullptr);
     cliDisableDbg();
   }
@@ -982,6 +989,41 @@ extern int _heap_start;
 extern int _heap_end;
 extern unsigned char *heap;
 
+#if defined(LUA) && defined(USE_CUSTOM_ALLOCATOR)
+static void printLuaMemStats(lua_State * L, const LuaMemStats & stats)
+{
+  if (!L) return;
+
+  cliSerialPrint("\t  slabs %u bytes, used %u, fragmentation %u%%",
+                 stats.slabBytes, stats.slabUsed, stats.fragmentation);
+  cliSerialPrint("\t  heap %u bytes, peak %u, free slabs %u",
+                 stats.heapBytes, stats.peakBytes, stats.freeSlabs);
+
+  void * ud;
+  lua_getallocf(L, &ud);
+  for (uint8_t cls = 0; cls < custom_l_classes(); cls++) {
+    uint16_t size, slabs, used;
+    custom_l_class_stats(ud, cls, size, slabs, used);
+    if (slabs > 0) {
+      cliSerialPrint("\t  [%3u] slabs %u, used %u", size, slabs, used);
+    }
+  }
+
+#if defined(DEBUG)
+  const uint16_t * histogram;
+  uint8_t buckets = custom_l_histogram(ud, &histogram);
+  for (uint8_t i = 0; i < buckets; i++) {
+    if (histogram[i] > 0) {
+      if (i == buckets - 1)
+        cliSerialPrint("\t  >%u: %u", i * 8, histogram[i]);
+      else
+        cliSerialPrint("\t  <=%u: %u", (i + 1) * 8, histogram[i]);
+    }
+  }
+#endif
+}
+#endif
+
 int cliMemoryInfo(const char ** argv)
 {
   // struct mallinfo {
@@ -1013,12 +1055,19 @@ int cliMemoryInfo(const char ** argv)
 
 #if defined(LUA)
   cliSerialPrint("\nLua:");
-  uint32_t s = luaGetMemUsed(lsScripts);
+  LuaMemStats stats;
+  uint32_t s = luaGetMemUsed(lsScripts, &stats);
   cliSerialPrint("\tScripts %u", s);
+#if defined(USE_CUSTOM_ALLOCATOR)
+  printLuaMemStats(lsScripts, stats);
+#endif
 #if defined(COLORLCD)
-  uint32_t w = luaGetMemUsed(lsWidgets);
+  uint32_t w = luaGetMemUsed(lsWidgets, &stats);
   uint32_t e = luaExtraMemoryUsage;
   cliSerialPrint("\tWidgets %u", w);
+#if defined(USE_CUSTOM_ALLOCATOR)
+  printLuaMemStats(lsWidgets, stats);
+#endif
   cliSerialPrint("\tExtra   %u", e);
   cliSerialPrint("------------");
   cliSerialPrint("\tTotal   %u", s + w + e);
@@ -1429,6 +1478,23 @@ void printAudioVars()
 #include "disk_cache.h"
 #endif
 
+#if defined(LUA)
+static void printLuaGcStats(const char * name, lua_State * L)
+{
+  const LuaGcStats * stats = luaGcGetStats(L);
+  cliSerialPrint("%s: alloc %u B/frame, %u us/KB, %u steps, %u cycles, max pause %u us",
+                 name, stats->allocRate, stats->usPerKB, stats->steps,
+                 stats->cycles, stats->maxPause);
+  for (uint8_t i = 0; i < LUA_GC_PAUSE_BUCKETS; i++) {
+    uint16_t limit = luaGcPauseBucketLimit(i);
+    if (limit)
+      cliSerialPrint("\t< %5u us: %u", limit, stats->pauses[i]);
+    else
+      cliSerialPrint("\t>=%5u us: %u", luaGcPauseBucketLimit(i - 1), stats->pauses[i]);
+  }
+}
+#endif
+
 int cliDisplay(const char ** argv)
 {
   long long int address = 0;
@@ -1543,6 +1609,31 @@ int cliDisplay(const char ** argv)
     printAudioVars();
   }
 #endif
+#if defined(LUA)
+  else if (!strcmp(argv[1], "luagc")) {
+    printLuaGcStats("Scripts", lsScripts);
+#if defined(COLORLCD)
+    printLuaGcStats("Widgets", lsWidgets);
+#endif
+  }
+#endif
+#if defined(LUA_COMPILER)
+  else if (!strcmp(argv[1], "luac")) {
+    cliSerialPrint("Lua bytecode cache: %u entries", luaCacheGetEntriesCount());
+    for (uint8_t i = 0; i < luaCacheGetEntriesCount(); i++) {
+      const LuaCacheEntry * entry = luaCacheGetEntry(i);
+      cliSerialPrint("%-20s %c last: %u ms, max: %u ms, loads: %u",
+                     entry->name, entry->srcHash ? 'c' : '-',
+                     entry->lastLoadMs, entry->maxLoadMs, entry->loads);
+    }
+  }
+#endif
+  else if (!strcmp(argv[1], "yaml")) {
+    const YamlWriteStats& stats = getYamlWriteStats();
+    cliSerialPrint("YAML writer: %u files, last: %u bytes in %u writes, %u ms (max %u ms)",
+                   stats.files, stats.bytes, stats.writeCalls, stats.duration,
+                   stats.maxDuration);
+  }
 #if defined(DISK_CACHE)
   else if (!strcmp(argv[1], "dc")) {
     DiskCacheStats stats = diskCache.getStats();
@@ -1598,6 +1689,37 @@ int cliRepeat(const char ** argv)
 }
 #endif
 
+// Hands the port over to the binary streaming service, until the
+// host sends the STOP command
+int cliStream(const char ** argv)
+{
+  auto drv = cliSerialDriver;
+  auto ctx = cliSerialDriverCtx;
+  if (!drv) return -1;
+
+  bool traces = cliTracesEnabled;
+  if (traces) cliDisableDbg();
+
+  // the service runs on the CLI task, at its low priority
+  serialStreamStart(ctx, drv);
+  while (serialStreamActive()) {
+    serialStreamWakeup(time_get_ms());
+    sleep_ms(1);
+    if (!mixerTaskRunning()) {
+      WDG_RESET();
+    }
+  }
+
+  // serialStreamStart() took over the RX callback
+  if (cliSerialDriver == drv && drv->setReceiveCb) {
+    drv->setReceiveCb(ctx, cliReceiveData);
+  }
+  xStreamBufferReset(cliRxBuffer);
+
+  if (traces) cliEnableDbg();
+  return 0;
+}
+
 #if defined(JITTER_MEASURE)
 int cliShowJitter(const char ** argv)
 {
@@ -1617,6 +1739,28 @@ int cliShowJitter(const char ** argv)
 }
 #endif
 
+#if defined(PXX2)
+int cliOta(const char ** argv)
+{
+  const auto& stats = otaTransferStats;
+  if (!stats.startTime) {
+    cliSerialPrint("No OTA transfer");
+    return 0;
+  }
+
+  uint32_t elapsed = stats.running ? time_get_ms() - stats.startTime : stats.elapsed;
+  uint32_t percent = stats.size ? (uint64_t)stats.acked * 100 / stats.size : 0;
+  uint32_t speed = elapsed ? (uint64_t)stats.acked * 1000 / elapsed : 0;
+
+  cliSerialPrint("%s: %u/%u bytes (%u%%)", stats.running ? "running" : "done",
+                 (unsigned)stats.acked, (unsigned)stats.size, (unsigned)percent);
+  cliSerialPrint("%u frames, %u retries, %u resumes", (unsigned)stats.frames,
+                 (unsigned)stats.retries, stats.resumes);
+  cliSerialPrint("%u ms, %u bytes/s", (unsigned)elapsed, (unsigned)speed);
+  return 0;
+}
+#endif
+
 #if defined(INTERNAL_GPS)
 int cliGps(const char ** argv)
 {
@@ -1793,9 +1937,13 @@ const CliCommand cliCommands[] = {
   { "testfatfs", cliTestFatFsSD, "" },
 #endif
   { "help", cliHelp, "[<command>]" },
+  { "stream", cliStream, "" },
 #if defined(JITTER_MEASURE)
   { "jitter", cliShowJitter, "" },
 #endif
+#if defined(PXX2)
+  { "ota", cliOta, "" },
+#endif
 #if defined(INTERNAL_GPS)
   { "gps", cliGps, "<baudrate>|$<command>|trace" },
 #endif
@@ -109,7 +109,8 @@ bool DiskCacheBlock::empty() const
   return (endSector == 0);
 }
 
-DiskCache::DiskCache() : lastBlock(0), blocks(nullptr), diskDrv(nullptr)
+DiskCache::DiskCache() :
+  lastBlock(0), blocks(nullptr), diskDrv(nullptr), sectors(0)
 {
   stats.noHits = 0;
   stats.noMisses = 0;
@@ -122,6 +123,7 @@ void DiskCache::initialize(const diskio_driver_t* drv)
 {
   blocks = _cache_blocks;
   diskDrv = drv;
+  sectors = 0;
 }
 
 void DiskCache::clear()
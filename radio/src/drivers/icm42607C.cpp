@@ -28,11 +28,26 @@
 #include "hal/i2c_driver.h"
 #include "stm32_i2c_driver.h"
 #include "icm42607C.h"
-#include "imu_filter.h"
 #include "stm32_gpio.h"
 #include "inactivity_timer.h"
 #include "hal.h"
 
+// ODR codes 5 to 12
+static constexpr uint16_t odrRates[] = {1600, 800, 400, 200, 100, 50, 25, 12};
+
+static constexpr uint8_t odrIndex(uint8_t i = DIM(odrRates) - 1)
+{
+  return (i == 0 || odrRates[i] >= IMU_SAMPLE_RATE) ? i : odrIndex(i - 1);
+}
+
+#define IMU_ODR  (odrIndex() + 5)
+
+static const ImuSensorInfo sensorInfo = {
+  odrRates[odrIndex()],
+  2000,  // dps
+  8192,  // +/-4 g
+};
+
 int16_t getGyroTemperature()
 {
   uint8_t reg = TEMP_DATA_X0_REG;
@@ -103,20 +118,28 @@ int gyroInit(void)
   }
   delay_ms(10);
 
-  // Set gyro to 2000 dps, 1kHz ODR
-  if(write_cmd(GYRO_CONFIG0_REG, GYRO_ODR_1KHZ) < 0) {
+  // Set gyro to 2000 dps, ODR closest to IMU_SAMPLE_RATE
+  if(write_cmd(GYRO_CONFIG0_REG, GYRO_FS_2000DPS | IMU_ODR) < 0) {
     TRACE("ICM426xx ERROR: GYRO_CONFIG0_REG error");
     return -1;
   }
   delay_ms(1);
 
-  // Set accel to ±4g, 1kHz ODR
-  if (write_cmd(ACCEL_CONFIG0_REG, ACCEL_ODR_1KHZ) < 0) {
+  // Set accel to ±4g, same ODR
+  if (write_cmd(ACCEL_CONFIG0_REG, ACCEL_FS_4G | IMU_ODR) < 0) {
     TRACE("ICM426xx ERROR: ACCEL_CONFIG0_REG error");
     return -1;
   }
   delay_ms(1);
 
+  // accel + gyro packets in the FIFO, stream mode
+  if (write_mreg1(FIFO_CONFIG5_MREG1, FIFO_ACCEL_GYRO_EN) < 0 ||
+      write_cmd(FIFO_CONFIG1_REG, FIFO_STREAM_MODE) < 0) {
+    TRACE("ICM426xx ERROR: FIFO config error");
+    return -1;
+  }
+  delay_ms(1);
+
 
   if (write_cmd(INT_CONFIG_REG, 0x00) < 0) {
     TRACE("ICM426xx ERROR: INT_CONFIG_REG error");
@@ -146,37 +169,56 @@ int gyroInit(void)
   return 0;
 }
 
-int gyroRead(uint8_t buffer[IMU_BUFFER_LENGTH])
+const ImuSensorInfo& gyroSensorInfo() { return sensorInfo; }
+
+static int16_t readBE16(const uint8_t* buf)
+{
+  return (int16_t)((buf[0] << 8) | buf[1]);
+}
+
+int gyroReadSamples(int16_t samples[][IMU_VALUES_COUNT], uint8_t count)
 {
-  IMU_RawData_t imu_raw;
-  IMU_FilteredData_t *filtered;
+  static uint8_t buf[IMU_FIFO_SAMPLES * FIFO_PACKET_SIZE];
 
-  uint8_t buf[6];
-  uint8_t reg = GYRO_DATA_X0_REG;
-  if (stm32_i2c_read(IMU_I2C_BUS, ICM426xx_I2C_ADDR, reg, 1, buf, 6, 1000) < 0) {
+  uint8_t cnt[2];
+  if (stm32_i2c_read(IMU_I2C_BUS, ICM426xx_I2C_ADDR, FIFO_COUNTH_REG, 1, cnt,
+                     2, 1000) < 0) {
     TRACE("ICM426xx ERROR: i2c read error");
     return -1;
   }
-  imu_raw.gyro_x = -((int16_t)(buf[0] << 8) | buf[1]); // x
-  imu_raw.gyro_y = -((int16_t)(buf[2] << 8) | buf[3]); // y
-  imu_raw.gyro_z = ((int16_t)(buf[4] << 8) | buf[5]); // z
 
-  reg = ACCEL_DATA_X0_REG;
-  if (stm32_i2c_read(IMU_I2C_BUS, ICM426xx_I2C_ADDR, reg, 1, buf, 6, 1000) < 0) {
+  // FIFO count in bytes, big endian
+  uint16_t packets = ((cnt[0] << 8) | cnt[1]) / FIFO_PACKET_SIZE;
+  if (packets > count) packets = count;
+  if (packets > IMU_FIFO_SAMPLES) packets = IMU_FIFO_SAMPLES;
+  if (packets == 0) return 0;
+
+  if (stm32_i2c_read(IMU_I2C_BUS, ICM426xx_I2C_ADDR, FIFO_DATA_REG, 1, buf,
+                     packets * FIFO_PACKET_SIZE, 1000) < 0) {
     TRACE("ICM426xx ERROR: i2c read error");
     return -1;
   }
-  imu_raw.accel_x = ((int16_t)(buf[0] << 8) | buf[1]); // x
-  imu_raw.accel_y = ((int16_t)(buf[2] << 8) | buf[3]); // y
-  imu_raw.accel_z = ((int16_t)(buf[4] << 8) | buf[5]); // z
-
-  // Process through filters
-  process_imu_data(&imu_raw);
-  filtered = get_filtered_imu_data();
 
-  *(int16_t*)&buffer[6] = -(int16_t)filtered->accel_x; // x
-  *(int16_t*)&buffer[8] = -(int16_t)filtered->accel_y; // y
-  *(int16_t*)&buffer[10] = (int16_t)filtered->accel_z; // z
+  int n = 0;
+  for (uint16_t i = 0; i < packets; i++) {
+    const uint8_t* packet = &buf[i * FIFO_PACKET_SIZE];
+    uint8_t header = packet[0];
+    if (header & FIFO_HEADER_EMPTY) break;
+    if ((header & (FIFO_HEADER_ACCEL | FIFO_HEADER_GYRO)) !=
+        (FIFO_HEADER_ACCEL | FIFO_HEADER_GYRO))
+      continue;
+
+    // x and y are mirrored
+    const uint8_t* accel = packet + FIFO_PACKET_ACCEL;
+    const uint8_t* gyro = packet + FIFO_PACKET_GYRO;
+    int16_t* sample = samples[n++];
+    sample[0] = -readBE16(gyro);
+    sample[1] = -readBE16(gyro + 2);
+    sample[2] = readBE16(gyro + 4);
+    sample[3] = -readBE16(accel);
+    sample[4] = -readBE16(accel + 2);
+    sample[5] = readBE16(accel + 4);
+  }
 
-  return 0;
+  return n;
 }
@@ -41,8 +41,8 @@
 #define SOFT_RESET_CMD        0x10
 
 #define PWR_MGMT0_ENABLE      0x0F  // ACCEL_LNM + GYRO_LNM
-#define ACCEL_ODR_1KHZ        0x45  // Accel 1 kHz ±4g
-#define GYRO_ODR_1KHZ         0x05  // Gyro 1 kHz  ±2000 dps
+#define ACCEL_FS_4G           0x40  // Accel ±4g
+#define GYRO_FS_2000DPS       0x00  // Gyro ±2000 dps
 
 #define GYRO_DATA_X0_REG      0x11
 #define ACCEL_DATA_X0_REG     0x0B
@@ -58,6 +58,23 @@
 #define INT_CONFIG_REG        0x06
 #define INT_STATUS2_REG       0x3B
 
+// FIFO
+#define FIFO_CONFIG1_REG      0x28
+#define FIFO_COUNTH_REG       0x3D
+#define FIFO_DATA_REG         0x3F
+#define FIFO_CONFIG5_MREG1    0x01
+
+#define FIFO_STREAM_MODE      0x00  // FIFO_BYPASS = 0, FIFO_MODE = stream
+#define FIFO_ACCEL_GYRO_EN    0x03
+#define FIFO_HEADER_EMPTY     0x80
+#define FIFO_HEADER_ACCEL     0x40
+#define FIFO_HEADER_GYRO      0x20
+
+// header, accel x/y/z, gyro x/y/z, temperature, timestamp
+#define FIFO_PACKET_SIZE      16
+#define FIFO_PACKET_ACCEL     1
+#define FIFO_PACKET_GYRO      7
+
 typedef struct {
   float fTemperatureDegC; //°C
   float fAccX, fAccY, fAccZ; // m/s^2
@@ -67,4 +84,3 @@ typedef struct {
 extern sIMUoutput IMUoutput;
 
 int gyroInit(void);
-int gyroRead(unsigned char*);
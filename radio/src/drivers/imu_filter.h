@@ -34,5 +34,8 @@ typedef struct {
   float gyro_x, gyro_y, gyro_z;       // Filtered gyroscope
 } IMU_FilteredData_t;
 
+// Float reference of the fixed-point fusion (imu_fusion.h), used by the
+// tests: 200 Hz samples, gyro in rad/s
 void process_imu_data(IMU_RawData_t *raw_data);
-IMU_FilteredData_t* get_filtered_imu_data(void);
\ No newline at end of file
+IMU_FilteredData_t* get_filtered_imu_data(void);
+void reset_imu_filter(void);
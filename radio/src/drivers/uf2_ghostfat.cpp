@@ -29,6 +29,7 @@
 #include "io/uf2.h"
 
 #include "hal/flash_driver.h"
+#include "hal/flash_writer.h"
 #include "fw_desc.h"
 
 #include "debug.h"
@@ -233,12 +234,17 @@ static uint32_t _flash_sz;
 static uint32_t _written_mask[UF2_MAX_BLOCKS / sizeof(uint32_t)];
 static uint32_t _erased_mask[UF2_ERASE_BLOCKS / sizeof(uint32_t)];
 
+// UF2 payloads are staged and programmed in bursts, sectors are erased
+// below as blocks may come in any order
+static FlashWriter _uf2_writer;
+
 void uf2_fat_reset_state()
 {
   _flash_sz = 0;
   memset(&_uf2_write_state, 0, sizeof(_uf2_write_state));
   memset(_written_mask, 0, sizeof(_written_mask));
   memset(_erased_mask, 0, sizeof(_erased_mask));
+  _uf2_writer.begin(BOOTLOADER_ADDRESS, 0, nullptr, false);
 }
 
 const uf2_fat_write_state_t* uf2_fat_get_state()
@@ -471,11 +477,10 @@ int uf2_fat_write_block(uint32_t block_no, uint8_t *data)
 
         TRACE_DEBUG("[UF2] write 0x%08x\n", bl->targetAddr);
 
-        auto drv = flashFindDriver(addr);
-        if (drv) {
+        if (flashFindDriver(addr)) {
           uint32_t len = bl->payloadSize;
           uint8_t* data = (uint8_t*)bl->data;
-          if (drv->program(addr, data, len) < 0) return -1;
+          if (_uf2_writer.write(addr, data, len) < 0) return -1;
         }
     }
 
@@ -492,6 +497,12 @@ int uf2_fat_write_block(uint32_t block_no, uint8_t *data)
             uint32_t pos = bl->blockNo >> 5;
             if (!(_written_mask[pos] & mask)) {
                 _written_mask[pos] |= mask;
+                // program what is still staged before the transfer is
+                // reported complete
+                if (wr_st->num_written + 1 >= wr_st->num_blocks &&
+                    _uf2_writer.flush() < 0) {
+                    return -1;
+                }
                 wr_st->num_written++;
                 TRACE_DEBUG("[UF2] wr #%d (%d / %d)\n", bl->blockNo,
                             wr_st->num_written, bl->numBlocks);
@@ -337,6 +337,7 @@ void flightReset(uint8_t check=true);
 #endif
 
 void checkLowEEPROM();
+bool isThrottleWarningAlertNeeded();
 void checkThrottleStick();
 void checkSwitches();
 void checkAlarm();
@@ -21,95 +21,245 @@
 
 #pragma once
 
+#include <atomic>
 #include <inttypes.h>
+#include <string.h>
 
-template <class T, int N>
-class Fifo
+// Single producer / single consumer ring buffer
+//
+// The producer (e.g. an ISR) only moves the write index, the consumer
+// (e.g. a task) only moves the read index. Each side publishes its index
+// with release semantics and reads the other one with acquire semantics,
+// so that the elements are visible before the index that covers them:
+// no lock or IRQ masking is needed as long as there is only one producer
+// and one consumer.
+//
+// The buffer is not owned (see Fifo below for a ring with its storage).
+// Its length must be a power of two, one element is kept free to tell a
+// full ring from an empty one. clear() must only be called while the
+// producer is stopped.
+template <class T>
+class SpscRing
 {
-  static_assert((N > 1) & !(N & (N - 1)), "Fifo size must be a power of two!");
-
   public:
-    Fifo():
-      widx(0),
-      ridx(0)
+    void init(T * buffer, uint32_t length)
     {
+      buf = buffer;
+      mask = length - 1;
+      overflowCount.store(0, std::memory_order_relaxed);
+      clear();
     }
 
     void clear()
     {
-      widx = ridx = 0;
+      ridx.store(0, std::memory_order_relaxed);
+      widx.store(0, std::memory_order_release);
     }
 
-    void push(T element)
+    // Producer side
+
+    bool push(T element)
     {
-      uint32_t next = nextIndex(widx);
-      if (next != ridx) {
-        fifo[widx] = element;
-        widx = next;
+      uint32_t w = widx.load(std::memory_order_relaxed);
+      uint32_t next = (w + 1) & mask;
+      if (next == ridx.load(std::memory_order_acquire)) {
+        overflow(1);
+        return false;
       }
+      buf[w] = element;
+      widx.store(next, std::memory_order_release);
+      return true;
     }
 
-    void skip()
+    // Pushes as many elements as possible, returns the number pushed
+    uint32_t push(const T * data, uint32_t count)
     {
-      ridx = nextIndex(ridx);
+      uint32_t done = 0;
+      while (done < count) {
+        T * span;
+        uint32_t len = writeSpan(span);
+        if (!len) break;
+        if (len > count - done) len = count - done;
+        memcpy(span, data + done, len * sizeof(T));
+        commitWrite(len);
+        done += len;
+      }
+      if (done < count) overflow(count - done);
+      return done;
     }
 
+    // Pushes all elements or none (e.g. a whole packet)
+    bool pushAll(const T * data, uint32_t count)
+    {
+      if (!hasSpace(count)) {
+        overflow(count);
+        return false;
+      }
+      push(data, count);
+      return true;
+    }
+
+    // Contiguous free space at the write index (for memcpy or DMA), to be
+    // published with commitWrite() once written
+    uint32_t writeSpan(T * & span) const
+    {
+      uint32_t w = widx.load(std::memory_order_relaxed);
+      uint32_t r = ridx.load(std::memory_order_acquire);
+      span = &buf[w];
+      uint32_t free = (r - w - 1) & mask;
+      uint32_t end = mask + 1 - w;
+      return free < end ? free : end;
+    }
+
+    void commitWrite(uint32_t count)
+    {
+      uint32_t w = widx.load(std::memory_order_relaxed);
+      widx.store((w + count) & mask, std::memory_order_release);
+    }
+
+    // For a producer writing the buffer on its own (e.g. circular DMA):
+    // publishes its current position
+    uint32_t writeIndex() const
+    {
+      return widx.load(std::memory_order_acquire);
+    }
+
+    void setWriteIndex(uint32_t idx)
+    {
+      widx.store(idx & mask, std::memory_order_release);
+    }
+
+    // Consumer side
+
     bool pop(T & element)
     {
-      if (isEmpty()) {
+      uint32_t r = ridx.load(std::memory_order_relaxed);
+      if (r == widx.load(std::memory_order_acquire)) {
         return false;
       }
-      else {
-        element = fifo[ridx];
-        ridx = nextIndex(ridx);
-        return true;
+      element = buf[r];
+      ridx.store((r + 1) & mask, std::memory_order_release);
+      return true;
+    }
+
+    // Pops up to 'count' elements, returns the number popped
+    uint32_t pop(T * data, uint32_t count)
+    {
+      uint32_t done = 0;
+      while (done < count) {
+        const T * span;
+        uint32_t len = readSpan(span);
+        if (!len) break;
+        if (len > count - done) len = count - done;
+        memcpy(data + done, span, len * sizeof(T));
+        commitRead(len);
+        done += len;
+      }
+      return done;
+    }
+
+    bool probe(T & element) const
+    {
+      uint32_t r = ridx.load(std::memory_order_relaxed);
+      if (r == widx.load(std::memory_order_acquire)) {
+        return false;
       }
+      element = buf[r];
+      return true;
+    }
+
+    void skip()
+    {
+      if (!isEmpty()) commitRead(1);
     }
 
+    // Contiguous data at the read index, to be released with commitRead()
+    // once consumed
+    uint32_t readSpan(const T * & span) const
+    {
+      uint32_t r = ridx.load(std::memory_order_relaxed);
+      uint32_t w = widx.load(std::memory_order_acquire);
+      span = &buf[r];
+      uint32_t used = (w - r) & mask;
+      uint32_t end = mask + 1 - r;
+      return used < end ? used : end;
+    }
+
+    void commitRead(uint32_t count)
+    {
+      uint32_t r = ridx.load(std::memory_order_relaxed);
+      ridx.store((r + count) & mask, std::memory_order_release);
+    }
+
+    // Either side
+
     bool isEmpty() const
     {
-      return (ridx == widx);
+      return ridx.load(std::memory_order_acquire) ==
+             widx.load(std::memory_order_acquire);
     }
 
     bool isFull() const
     {
-      uint32_t next = nextIndex(widx);
-      return (next == ridx);
+      return size() == mask;
     }
 
     uint32_t size() const
     {
-      return (N + widx - ridx) & (N - 1);
+      return (widx.load(std::memory_order_acquire) -
+              ridx.load(std::memory_order_acquire)) & mask;
+    }
+
+    uint32_t capacity() const
+    {
+      return mask;
     }
 
     bool hasSpace(uint32_t n) const
     {
-      return (N > (size() + n));
+      return (mask + 1 > (size() + n));
     }
 
-    bool probe(T & element) const
+    // Elements dropped because the ring was full
+    uint32_t overflows() const
     {
-      if (isEmpty()) {
-        return false;
-      }
-      else {
-        element = fifo[ridx];
-        return true;
-      }
+      return overflowCount.load(std::memory_order_relaxed);
     }
 
     T * buffer()
     {
-      return fifo;
+      return buf;
     }
 
   protected:
-    T fifo[N];
-    volatile uint32_t widx;
-    volatile uint32_t ridx;
+    T * buf;
+    uint32_t mask;
+    std::atomic<uint32_t> widx;
+    std::atomic<uint32_t> ridx;
+    std::atomic<uint32_t> overflowCount;
+
+    // only the producer writes the counter: no read-modify-write needed
+    void overflow(uint32_t count)
+    {
+      overflowCount.store(overflowCount.load(std::memory_order_relaxed) + count,
+                          std::memory_order_relaxed);
+    }
+};
+
+template <class T, int N>
+class Fifo : public SpscRing<T>
+{
+  static_assert((N > 1) & !(N & (N - 1)), "Fifo size must be a power of two!");
 
-    static inline uint32_t nextIndex(uint32_t idx)
+  public:
+    Fifo()
     {
-      return (idx + 1) & (N - 1);
+      this->init(fifo, N);
     }
+
+    Fifo(const Fifo &) = delete;
+    Fifo & operator=(const Fifo &) = delete;
+
+  protected:
+    T fifo[N];
 };
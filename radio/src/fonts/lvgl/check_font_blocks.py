@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+
+# Checks LZ4 fonts generated in the block format (see lz4_font.cpp):
+#  - every glyph bitmap block decompresses to its size,
+#  - blocks follow each other and no glyph is split between two blocks,
+#  - with --ref, the glyph bitmaps and the other font data are the same as
+#    in the font generated at that git revision (any format).
+#
+# Usage:
+#   check_font_blocks.py [--ref <git revision>] lrg/lv_font_cn_[LX]*.c ...
+
+import argparse
+import os
+import re
+import struct
+import subprocess
+import sys
+
+# lz4_fonts.h
+ETX_FONT_BLOCK_SIZE = 4096
+# lv_font_fmt_txt_glyph_dsc_t
+GLYPH_DSC_SIZE = 8
+
+
+def lz4_decompress(src, size):
+    """LZ4 block format decoder"""
+    dst = bytearray()
+    pos = 0
+    while pos < len(src):
+        token = src[pos]
+        pos += 1
+
+        length = token >> 4
+        if length == 15:
+            while True:
+                b = src[pos]
+                pos += 1
+                length += b
+                if b != 255:
+                    break
+        dst += src[pos:pos + length]
+        pos += length
+        if pos >= len(src):
+            break
+
+        offset = src[pos] | (src[pos + 1] << 8)
+        pos += 2
+        if offset == 0 or offset > len(dst):
+            raise ValueError("invalid match offset")
+
+        length = token & 0x0F
+        if length == 15:
+            while True:
+                b = src[pos]
+                pos += 1
+                length += b
+                if b != 255:
+                    break
+        length += 4
+        for _ in range(length):
+            dst.append(dst[-offset])
+
+    if len(dst) != size:
+        raise ValueError("decompressed %d bytes instead of %d" % (len(dst), size))
+    return bytes(dst)
+
+
+def parse_font(text):
+    m = re.search(r"const etxLz4Font \w+ = \{(.*?)\};", text, re.S)
+    if not m:
+        return None
+    font = {}
+    for k, v in re.findall(r"^\.(\w+) = (-?\d+),", m.group(1), re.M):
+        font[k] = int(v)
+
+    def array(name):
+        m = re.search(r"\b%s\[\] =\{(.*?)\};" % name, text, re.S)
+        return bytes(int(v, 16) for v in re.findall(r"0x[0-9a-f]{2}", m.group(1))) if m else None
+
+    font["compressed"] = array("lz4FontData")
+    font["compressed_bitmap"] = array("lz4BitmapData")
+    font["blocks"] = [
+        {k: int(v) for k, v in re.findall(r"\.(\w+) = (-?\d+)", line)}
+        for line in re.findall(r"\{ \.bitmap_index = .*?\}", text)
+    ]
+    font["cmaps"] = [
+        {k: int(v) for k, v in re.findall(r"\.(\w+) = (-?\d+)", line)}
+        for line in re.findall(r"\{ \.range_start = .*?\}", text)
+    ]
+    return font
+
+
+def glyph_count(font):
+    # glyph_dsc is at offset 0, followed by the cmap lists, the glyph
+    # bitmap (flat format only) and the kerning data
+    ends = [font["uncomp_size"]]
+    for cmap in font["cmaps"]:
+        ends += [cmap["unicode_list"], cmap["glyph_id_ofs_list"]]
+    ends += [font["glyph_bitmap"], font["class_pair_values"]]
+    return min(e for e in ends if e > 0) // GLYPH_DSC_SIZE
+
+
+def glyph_bitmap_indexes(data, count):
+    indexes = []
+    for i in range(count):
+        (dsc,) = struct.unpack_from("<I", data, i * GLYPH_DSC_SIZE)
+        indexes.append(dsc & 0xFFFFF)
+    return indexes
+
+
+def check_font(path, text, ref_text):
+    font = parse_font(text)
+    if font is None:
+        return ["not an LZ4 font"]
+    if font["compressed_bitmap"] is None:
+        return ["not in the block format"]
+
+    errors = []
+    data = lz4_decompress(font["compressed"], font["uncomp_size"])
+
+    bitmap = bytearray()
+    for i, block in enumerate(font["blocks"]):
+        if block["bitmap_index"] != len(bitmap):
+            errors.append("block %d: bitmap_index %d instead of %d" %
+                          (i, block["bitmap_index"], len(bitmap)))
+        if block["size"] > ETX_FONT_BLOCK_SIZE:
+            errors.append("block %d: %d bytes" % (i, block["size"]))
+        comp = font["compressed_bitmap"][block["comp_offset"]:
+                                         block["comp_offset"] + block["comp_size"]]
+        try:
+            bitmap += lz4_decompress(comp, block["size"])
+        except (ValueError, IndexError) as e:
+            errors.append("block %d: %s" % (i, e))
+            return errors
+    if len(font["blocks"]) != font["block_count"]:
+        errors.append("%d blocks instead of %d" % (len(font["blocks"]), font["block_count"]))
+
+    starts = [b["bitmap_index"] for b in font["blocks"]] + [len(bitmap)]
+    indexes = glyph_bitmap_indexes(data, glyph_count(font)) + [len(bitmap)]
+    for g in range(len(indexes) - 1):
+        start, end = indexes[g], max(indexes[g], indexes[g + 1])
+        block = max(i for i, s in enumerate(starts) if s <= start)
+        if end > starts[min(block + 1, len(starts) - 1)]:
+            errors.append("glyph %d split between blocks" % g)
+
+    if ref_text is None:
+        return errors
+
+    ref = parse_font(ref_text)
+    if ref is None:
+        return errors + ["reference is not an LZ4 font"]
+    ref_data = lz4_decompress(ref["compressed"], ref["uncomp_size"])
+    if ref["compressed_bitmap"] is None:
+        ref_bitmap = ref_data[ref["glyph_bitmap"]:ref["glyph_bitmap"] + len(bitmap)]
+        ref_data = ref_data[:ref["glyph_bitmap"]] + ref_data[ref["glyph_bitmap"] + len(bitmap):]
+    else:
+        ref_bitmap = b"".join(
+            lz4_decompress(ref["compressed_bitmap"][b["comp_offset"]:b["comp_offset"] + b["comp_size"]],
+                           b["size"]) for b in ref["blocks"])
+
+    ref_indexes = glyph_bitmap_indexes(ref_data, glyph_count(ref)) + [len(ref_bitmap)]
+    if len(ref_indexes) != len(indexes):
+        errors.append("%d glyphs instead of %d" % (len(indexes) - 1, len(ref_indexes) - 1))
+    else:
+        for g in range(len(indexes) - 1):
+            if (bitmap[indexes[g]:indexes[g + 1]] !=
+                    ref_bitmap[ref_indexes[g]:ref_indexes[g + 1]]):
+                errors.append("glyph %d: bitmap differs" % g)
+    if bytes(data) != bytes(ref_data):
+        errors.append("glyph descriptors, cmaps or kerning differ")
+    if font["cmaps"] != ref["cmaps"]:
+        errors.append("cmaps differ")
+
+    return errors
+
+
+def git_show(rev, path):
+    try:
+        return subprocess.run(["git", "show", "%s:./%s" % (rev, os.path.basename(path))],
+                              cwd=os.path.dirname(os.path.abspath(path)),
+                              capture_output=True, text=True, check=True).stdout
+    except subprocess.CalledProcessError:
+        return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check LZ4 block format fonts")
+    parser.add_argument("--ref", help="git revision of the reference fonts")
+    parser.add_argument("fonts", nargs="+")
+    args = parser.parse_args()
+
+    failed = 0
+    for path in args.fonts:
+        with open(path) as f:
+            text = f.read()
+        ref_text = None
+        if args.ref:
+            ref_text = git_show(args.ref, path)
+            if ref_text is None:
+                print("%s: not found at %s" % (path, args.ref))
+                failed += 1
+                continue
+        errors = check_font(path, text, ref_text)
+        for error in errors[:10]:
+            print("%s: %s" % (path, error))
+        if errors:
+            failed += 1
+        else:
+            print("%s: OK" % path)
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
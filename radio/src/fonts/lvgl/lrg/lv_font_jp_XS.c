@@ -211,7 +211,7 @@ static const uint8_t lz4FontData[] ={
 0x2b,0x08,0x00,0x13,0xa7,0x08,0x00,0x22,0x43,0x2c,0x08,0x00,0x22,0xdf,0x2c,0xa8,
 0x00,0xa2,0x9f,0x2d,0xa1,0x10,0x0f,0x14,0x01,0xfd,0x35,0x2e,0x60,0x00,0x22,0xdf,
 0x2e,0xa8,0x00,0xa2,0xa7,0x2f,0xc1,0x17,0x18,0x0f,0x00,0x00,0x5b,0x30,0x60,0x00,
-0x60,0xf1,0x30,0x21,0x13,0x14,0x0d,0x20,0x12,0xf1,0xff,0xff,0xff,0x81,0x72,0x1f,
+0x60,0xf1,0x30,0x21,0x13,0x14,0x0d,0x20,0x12,0xf8,0xff,0xff,0xff,0x3e,0x72,0x1f,
 0xb5,0x21,0x51,0x2f,0x52,0x2f,0x92,0x2f,0x94,0x2f,0x98,0x2f,0x9a,0x2f,0x9b,0x2f,
 0x9c,0x2f,0x9d,0x2f,0x9e,0x2f,0x9f,0x2f,0xa1,0x2f,0xa3,0x2f,0xa5,0x2f,0xa7,0x2f,
 0xa8,0x2f,0xa9,0x2f,0xaa,0x2f,0xab,0x2f,0xad,0x2f,0xaf,0x2f,0xb0,0x2f,0xb3,0x2f,
@@ -264,354 +264,470 @@ static const uint8_t lz4FontData[] ={
 0xbf,0x8c,0xbf,0xa4,0xbf,0xa6,0xbf,0xd5,0xbf,0xd6,0xbf,0xd8,0xbf,0xda,0xbf,0xf1,
 0xbf,0xf8,0xbf,0xfb,0xbf,0x04,0xc0,0x2d,0xc0,0x35,0xc0,0x6c,0xc0,0xfc,0xc0,0x51,
 0xc1,0x52,0xc1,0x53,0xc1,0x54,0xc1,0x55,0xc1,0x98,0xc1,0xa4,0xc1,0xfe,0xc1,0x15,
-0xc2,0x6b,0xc4,0xd3,0xc6,0xb3,0xc7,0x7f,0x56,0xf5,0x6f,0x46,0xf4,0x6f,0x46,0xf4,
-0x5f,0x45,0xf3,0x5f,0x32,0x71,0x00,0x04,0xd4,0x5f,0x50,0xb9,0x3f,0x1b,0x83,0xf0,
-0xb7,0x3f,0x0b,0x63,0xe0,0x52,0x16,0x00,0x00,0x00,0xe6,0x02,0xf3,0x00,0x00,0x2f,
-0x20,0x6e,0x00,0x00,0x06,0xe0,0x0a,0xb0,0x03,0xff,0xff,0xff,0xff,0xf7,0x04,0x4e,
-0x94,0x4f,0x64,0x10,0x00,0xf5,0x03,0xf1,0x00,0x00,0x3f,0x1b,0x00,0xf0,0x0f,0xf0,
-0x09,0xc0,0x00,0xef,0xff,0xff,0xff,0xfc,0x03,0x3c,0xa3,0x3f,0x73,0x20,0x00,0xe6,
-0x02,0xf2,0x00,0x00,0x2f,0x30,0x5f,0x00,0x00,0x05,0xf0,0x08,0xc0,0xb4,0x03,0xf0,
-0x43,0x61,0x00,0x00,0x00,0x2f,0x40,0x00,0x00,0x16,0xf7,0x00,0x00,0x4f,0xff,0xff,
-0x40,0x1f,0xd3,0x04,0xee,0x05,0xf5,0x00,0x06,0xf5,0x6f,0x50,0x00,0x3d,0x63,0xfc,
-0x00,0x00,0x00,0x09,0xfe,0x71,0x00,0x00,0x06,0xef,0xfa,0x10,0x00,0x00,0x4b,0xfe,
-0x10,0x00,0x00,0x08,0xf7,0xca,0x00,0x00,0x1f,0x9c,0xf1,0x00,0x04,0xf8,0x5f,0xc4,
-0x36,0xef,0x20,0x6f,0xff,0xfe,0x40,0x00,0x06,0xf3,0x00,0x00,0x00,0x4f,0x10,0x00,
-0x02,0xbf,0xe7,0x56,0x00,0xf1,0x12,0x0d,0xa2,0x4f,0x40,0x04,0x30,0x00,0x0f,0x40,
-0x0c,0x70,0x1e,0x40,0x00,0x0e,0x80,0x2f,0x50,0xaa,0x00,0x00,0x04,0xef,0xf9,0x05,
-0xe1,0x00,0x00,0x00,0x01,0x00,0x1e,0x50,0x50,0x16,0x11,0xaa,0x06,0x00,0xf1,0x07,
-0x05,0xe1,0x4c,0xea,0x10,0x00,0x00,0x1e,0x52,0xf6,0x3b,0xc0,0x00,0x00,0xaa,0x06,
-0xd0,0x03,0xf0,0x00,0x05,0xe1,0x07,0x00,0x51,0x06,0x50,0x02,0xf6,0x2a,0xa7,0x00,
-0xf3,0x64,0x5d,0xfb,0x20,0x00,0x07,0xdf,0xd5,0x00,0x00,0x00,0x8f,0xa6,0xcf,0x40,
-0x00,0x00,0xdd,0x00,0x0f,0x90,0x00,0x00,0xed,0x00,0x3f,0x60,0x00,0x00,0x8f,0x65,
-0xec,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x00,0x4e,0xff,0x30,0x00,0x10,0x05,
-0xfb,0x2e,0xe1,0x0a,0xe0,0x0e,0xe0,0x03,0xfd,0x0d,0xc0,0x0f,0xb0,0x00,0x5f,0xdf,
-0x70,0x0e,0xe0,0x00,0x08,0xff,0x10,0x05,0xfc,0x53,0x6e,0xff,0x70,0x00,0x3b,0xef,
-0xe9,0x2b,0xf5,0x0f,0x50,0xf5,0x0f,0x40,0xf3,0x05,0x00,0x00,0x01,0x90,0x00,0x0d,
-0xb0,0x00,0xad,0x00,0x04,0xf4,0x00,0x0b,0xd0,0x00,0x1f,0x80,0x00,0x6f,0x40,0x00,
-0x9f,0x10,0x00,0xbf,0x00,0x03,0x00,0x50,0xaf,0x00,0x00,0x7f,0x30,0x68,0x00,0x90,
-0x0e,0xb0,0x00,0x07,0xf2,0x00,0x00,0xda,0x00,0x0d,0x00,0xa1,0x04,0xe0,0x00,0x00,
-0x00,0x65,0x00,0x00,0x4f,0x50,0x15,0x00,0xf2,0x1e,0xdc,0x00,0x00,0x6f,0x30,0x00,
-0x1f,0x90,0x00,0x0c,0xd0,0x00,0x09,0xf1,0x00,0x08,0xf2,0x00,0x07,0xf3,0x00,0x08,
-0xf3,0x00,0x09,0xf2,0x00,0x0b,0xf0,0x00,0x0f,0xb0,0x00,0x3f,0x50,0x00,0x9e,0x00,
-0x02,0xf5,0x00,0x1d,0xa0,0x00,0x8a,0x4d,0x17,0xf0,0x14,0x09,0xc0,0x00,0x00,0x08,
-0xc0,0x00,0x69,0x38,0xc1,0x77,0x6d,0xff,0xff,0xf9,0x00,0x4f,0xf6,0x00,0x00,0xcb,
-0xbd,0x00,0x08,0xf2,0x1e,0x90,0x01,0x40,0x04,0x20,0x00,0x00,0x5a,0x20,0xee,0x00,
-0x17,0x30,0x05,0x00,0x60,0x29,0x99,0xcf,0xa9,0x99,0x4f,0xeb,0x01,0x0b,0x19,0x00,
-0x01,0x05,0x00,0xf2,0x0c,0x0d,0xd0,0xdd,0x0f,0xa7,0xf3,0x25,0x00,0x01,0x11,0x1a,
-0xff,0xfe,0x24,0x44,0x30,0x6e,0x46,0xf4,0x00,0x00,0x06,0xf1,0x00,0x00,0x0c,0xb0,
-0xe3,0x01,0xf0,0x10,0x8e,0x00,0x00,0x00,0xe8,0x00,0x00,0x05,0xf2,0x00,0x00,0x0b,
-0xc0,0x00,0x00,0x1f,0x50,0x00,0x00,0x7e,0x00,0x00,0x00,0xe9,0x00,0x00,0x04,0xf3,
-0x00,0x00,0x0a,0x13,0x00,0xf0,0x1c,0x60,0x00,0x00,0x7f,0x10,0x00,0x00,0x55,0x00,
-0x00,0x00,0x02,0xae,0xfd,0x80,0x01,0xef,0x97,0xbf,0xa0,0x7f,0x50,0x00,0xaf,0x2c,
-0xf0,0x00,0x04,0xf6,0xed,0x00,0x00,0x2f,0x8e,0xc0,0x00,0x02,0xf9,0xfc,0x00,0x00,
-0x2f,0x9e,0x09,0x00,0x00,0x12,0x00,0xff,0x11,0x8b,0xf0,0x00,0x05,0xf6,0x7f,0x50,
-0x00,0xbf,0x20,0xef,0x96,0xbf,0x90,0x01,0xae,0xfd,0x70,0x00,0x00,0x04,0xab,0x29,
-0xef,0xfc,0x6e,0x93,0xfc,0x10,0x00,0xfc,0x00,0x03,0x00,0x08,0xf0,0x06,0x3b,0xef,
-0xd7,0x00,0x04,0xfe,0x87,0xbf,0xb0,0x0d,0xe1,0x00,0x0b,0xf3,0x1f,0xa0,0x00,0x06,
-0xf5,0x00,0x00,0x3d,0x01,0xc0,0x00,0x00,0x1e,0xa0,0x00,0x00,0x00,0xce,0x10,0x00,
-0x00,0x0b,0x59,0x02,0xf1,0x04,0xbf,0x40,0x00,0x00,0x0a,0xf4,0x00,0x00,0x00,0xaf,
-0x40,0x00,0x00,0x09,0xfa,0x66,0x66,0x65,0x0e,0x06,0x01,0xf0,0x01,0x4b,0xef,0xd7,
-0x00,0x06,0xfc,0x76,0xaf,0xb0,0x0e,0xd0,0x00,0x0a,0xf2,0x01,0x10,0x70,0x01,0xf0,
-0x04,0x00,0x12,0x7f,0x90,0x00,0x06,0xff,0xf9,0x00,0x00,0x01,0x45,0xaf,0x80,0x00,
-0x00,0x00,0x0a,0xf2,0x65,0x02,0x60,0xf6,0x1e,0x90,0x00,0x05,0xf6,0x69,0x00,0xa0,
-0xf2,0x05,0xfe,0x76,0xbf,0x90,0x00,0x4b,0xff,0xd6,0x87,0x01,0x70,0xcf,0x60,0x00,
-0x00,0x00,0x6f,0xf6,0x06,0x03,0xf0,0x15,0xdf,0x60,0x00,0x00,0x0b,0xd6,0xf6,0x00,
-0x00,0x06,0xf4,0x5f,0x60,0x00,0x01,0xfa,0x05,0xf6,0x00,0x00,0xbe,0x10,0x5f,0x60,
-0x00,0x5f,0x50,0x05,0xf6,0x00,0x1e,0xc1,0x11,0x6f,0x61,0x07,0x77,0x00,0x70,0xf4,
-0x24,0x44,0x44,0x8f,0x84,0x10,0x55,0x00,0x00,0x42,0x00,0x30,0x5f,0x60,0x00,0x17,
-0x00,0x60,0x80,0x9f,0x88,0x88,0x84,0x0b,0x17,0x02,0xf0,0x02,0xcc,0x00,0x00,0x00,
-0x0e,0xdc,0xff,0xa2,0x00,0xff,0xa8,0xbf,0xe1,0x03,0x30,0x00,0x8f,0x99,0x02,0x10,
-0xfd,0x16,0x03,0xf0,0x3f,0xe5,0xb1,0x00,0x00,0xed,0x3f,0x80,0x00,0x5f,0x80,0xaf,
-0xa6,0x8f,0xe1,0x00,0x7d,0xfe,0xa1,0x00,0x00,0x05,0xbe,0xd0,0x00,0x0b,0xfc,0x96,
-0x00,0x09,0xf5,0x00,0x00,0x02,0xf7,0x01,0x00,0x00,0x7f,0x7d,0xff,0xc2,0x0a,0xff,
-0x95,0x8f,0xe0,0xbf,0x50,0x00,0x7f,0x7c,0xf0,0x00,0x01,0xfb,0xbf,0x00,0x00,0x0f,
-0xb9,0xf3,0x00,0x01,0xfa,0x3f,0xb0,0x00,0x8f,0x50,0x9f,0xb6,0xaf,0xc0,0x00,0x7d,
-0xfe,0x90,0x00,0x0a,0x02,0x64,0xfd,0x16,0x66,0x66,0x67,0xf9,0x36,0x01,0x10,0x0e,
-0x36,0x01,0x10,0x7f,0x10,0x02,0x20,0xeb,0x00,0xc7,0x00,0x00,0x13,0x00,0x10,0xc0,
-0xe0,0x00,0x20,0x50,0x00,0x33,0x03,0x03,0xb2,0x00,0x20,0x0d,0xe0,0xac,0x03,0x12,
-0x70,0xe3,0x01,0xa0,0x02,0xfe,0x86,0xaf,0xc0,0x9f,0x40,0x00,0x9f,0x39,0xb4,0x02,
-0xf1,0x03,0x2f,0xc3,0x25,0xfc,0x00,0x3f,0xff,0xfc,0x00,0x1d,0xe7,0x59,0xf9,0x09,
-0xf2,0x00,0x08,0xf4,0xf5,0x01,0x90,0xd0,0x00,0x02,0xf9,0xbf,0x30,0x00,0x8f,0x52,
-0x2d,0x00,0x00,0x36,0x00,0xf2,0x1d,0x00,0x00,0x3b,0xef,0xc4,0x00,0x03,0xfe,0x87,
-0xdf,0x40,0x0b,0xf2,0x00,0x1e,0xd0,0x0f,0xb0,0x00,0x07,0xf3,0x0f,0xa0,0x00,0x05,
-0xf5,0x0e,0xe0,0x00,0x07,0xf6,0x07,0xfb,0x32,0x8f,0xf6,0x00,0x8f,0xff,0xc7,0xf4,
-0x00,0x01,0x32,0x9a,0x00,0xf5,0x04,0xd0,0x00,0x00,0x00,0x9f,0x50,0x00,0x16,0x8d,
-0xf9,0x00,0x00,0x2f,0xea,0x40,0x00,0x8f,0x38,0xe3,0x60,0x1a,0x87,0x8e,0x38,0xf3,
-0x0b,0xd0,0x0b,0xd0,0x00,0x01,0x00,0x90,0x0b,0xf0,0x0b,0xe0,0x0e,0xb0,0x5f,0x40,
-0x15,0x0d,0x00,0xf1,0x12,0x2a,0x30,0x00,0x04,0xbf,0xf3,0x00,0x5c,0xfe,0x82,0x03,
-0xef,0xb5,0x00,0x00,0x4f,0xe6,0x10,0x00,0x00,0x29,0xff,0xa3,0x00,0x00,0x01,0x8e,
-0xfd,0x20,0x00,0x00,0x07,0xe4,0x33,0x00,0xda,0x12,0x22,0x22,0x22,0x09,0xff,0xff,
-0xff,0xf2,0x35,0x55,0x55,0x55,0x12,0x00,0x10,0x25,0x12,0x00,0x10,0x97,0x0c,0x02,
-0xd0,0xff,0x92,0x00,0x00,0x03,0x9f,0xfb,0x40,0x00,0x00,0x06,0xcf,0xd1,0x46,0x00,
-0xb5,0x20,0x06,0xcf,0xe8,0x10,0x7f,0xfc,0x60,0x00,0x0b,0xa3,0x7d,0x00,0xe2,0x8d,
-0xfd,0x80,0x00,0xbf,0xb8,0xbf,0xa0,0x3f,0x90,0x00,0xbf,0x10,0x31,0x5b,0x01,0x10,
-0xde,0xc0,0x00,0xa1,0x60,0x00,0x00,0x9f,0x80,0x00,0x00,0x5f,0x90,0x00,0x6a,0x02,
-0x24,0x00,0x34,0x32,0x00,0x10,0x7d,0x18,0x05,0x20,0xe2,0x00,0x37,0x03,0x30,0x9d,
-0xff,0xd9,0x81,0x01,0x40,0x07,0xfb,0x63,0x35,0x2c,0x00,0x10,0x09,0x9d,0x00,0x70,
-0x2d,0x90,0x00,0x05,0xf3,0x00,0x00,0x7b,0x05,0xf3,0x40,0x00,0xe8,0x00,0x06,0xde,
-0xb3,0x00,0x99,0x00,0x4f,0x10,0x08,0xf6,0x3c,0xc0,0x04,0xe0,0x09,0xc0,0x02,0xf6,
-0x00,0xba,0x00,0x2f,0x00,0xc9,0x00,0x8e,0x00,0x0c,0x90,0x01,0xf1,0x0e,0x70,0x0c,
-0xb0,0x00,0xe7,0x00,0x1f,0x10,0xd7,0x00,0xd9,0x00,0x0f,0x60,0x03,0xe0,0x0c,0x80,
-0x0d,0xa0,0x03,0xf5,0x00,0x9a,0x00,0xab,0x00,0x8f,0x43,0xce,0xb2,0x6f,0x20,0x05,
-0xf1,0x01,0xbf,0xc3,0x3d,0xfc,0x40,0x00,0x0e,0x90,0x80,0x00,0x24,0x4f,0x70,0x09,
-0x00,0x40,0xc6,0x32,0x47,0x60,0x09,0x00,0x41,0x18,0xcf,0xfd,0xb4,0x12,0x00,0x21,
-0x0c,0xf2,0x97,0x00,0x11,0xff,0x2b,0x00,0x30,0x9f,0xae,0x00,0x8d,0x01,0x20,0x93,
-0xf5,0x0c,0x02,0x20,0xf3,0x0d,0x1c,0x02,0xf1,0x03,0xcd,0x00,0x6f,0x20,0x00,0x00,
-0x2f,0x70,0x01,0xf8,0x00,0x00,0x08,0xf3,0x22,0x2b,0xe0,0x00,0x32,0x06,0xa0,0x50,
-0x00,0x5f,0x75,0x55,0x55,0xec,0x00,0x0b,0xe0,0x5c,0x02,0x10,0x02,0x63,0x02,0x41,
-0x3f,0x80,0x8f,0x40,0x0a,0x01,0xf0,0x04,0x7f,0xff,0xff,0xd8,0x00,0x7f,0xa7,0x77,
-0xcf,0xc0,0x7f,0x50,0x00,0x0b,0xf3,0x7f,0x50,0x00,0x07,0x02,0x04,0xf0,0x38,0x09,
-0xf3,0x7f,0x61,0x12,0x7f,0xb0,0x7f,0xff,0xff,0xfd,0x10,0x7f,0x84,0x44,0x7e,0xd1,
-0x7f,0x50,0x00,0x04,0xf9,0x7f,0x50,0x00,0x01,0xfb,0x7f,0x50,0x00,0x06,0xf9,0x7f,
-0x96,0x67,0xaf,0xe2,0x7f,0xff,0xff,0xd9,0x10,0x00,0x29,0xef,0xea,0x30,0x00,0x4f,
-0xf9,0x79,0xef,0x50,0x1e,0xe1,0x00,0x01,0xee,0x07,0xf6,0x00,0x00,0x08,0xf5,0xbf,
-0x10,0x00,0x00,0x14,0x2d,0xf0,0xa2,0x00,0x24,0xee,0x00,0xa8,0x02,0x71,0x00,0xcf,
-0x00,0x00,0x00,0x13,0x18,0x21,0x00,0x10,0x1f,0x2c,0x00,0x80,0x00,0x5f,0xe9,0x79,
-0xef,0x50,0x00,0x3a,0x42,0x00,0xb0,0x7f,0xff,0xfd,0xa3,0x00,0x07,0xfa,0x77,0x9e,
-0xf7,0x00,0x8a,0x00,0x30,0xf4,0x07,0xf5,0x6a,0x02,0xb0,0x7f,0x50,0x00,0x00,0x9f,
-0x27,0xf5,0x00,0x00,0x07,0xf4,0x0b,0x00,0x25,0x6f,0x57,0x0b,0x00,0x10,0xaf,0x16,
-0x00,0x20,0x1f,0xd0,0x2c,0x00,0x62,0xf5,0x07,0xf9,0x66,0x9e,0xf7,0x42,0x00,0x00,
-0xd1,0x00,0x80,0xff,0xf1,0x7f,0xa7,0x77,0x77,0x70,0x7f,0x2a,0x03,0x07,0x05,0x00,
-0x31,0x61,0x11,0x11,0x1e,0x00,0x6c,0x30,0x7f,0x84,0x44,0x44,0x00,0x1e,0x00,0x50,
-0x96,0x66,0x66,0x61,0x7f,0x61,0x02,0x10,0x7f,0x7f,0x07,0x40,0xfa,0x77,0x77,0x76,
-0x18,0x00,0x23,0x07,0xf5,0x21,0x00,0x50,0x07,0xf6,0x11,0x11,0x10,0x1b,0x00,0x5a,
-0x07,0xf8,0x44,0x44,0x40,0x1b,0x00,0x14,0xf5,0x45,0x00,0xf0,0x09,0x00,0x3a,0xef,
-0xeb,0x40,0x00,0x5f,0xe9,0x78,0xef,0x70,0x1f,0xe1,0x00,0x00,0xcf,0x28,0xf5,0x00,
-0x00,0x03,0x94,0xbf,0x10,0x01,0x01,0xf0,0x01,0xf0,0x00,0x01,0x11,0x10,0xee,0x00,
-0x05,0xff,0xff,0x8d,0xf0,0x00,0x14,0x47,0xf8,0x16,0x00,0xf1,0x08,0x3f,0x86,0xf7,
-0x00,0x00,0x03,0xf8,0x0e,0xf3,0x00,0x00,0x5f,0x80,0x3e,0xfa,0x77,0xaf,0xe2,0x00,
-0x18,0xdf,0xfd,0x81,0x4d,0x00,0x20,0x0d,0xf7,0x57,0x00,0x1d,0xdf,0x0b,0x00,0x61,
-0xf6,0x11,0x11,0x11,0xdf,0x7f,0x24,0x08,0x5f,0xf8,0x44,0x44,0x44,0xef,0x2c,0x00,
-0x08,0x4c,0xf0,0x4f,0x74,0xf7,0x03,0x00,0x10,0x70,0x47,0x02,0x1f,0xf0,0x05,0x00,
-0x15,0xf0,0x04,0x5c,0x30,0x00,0x0d,0xf0,0x5f,0x90,0x00,0x3f,0xc0,0x0c,0xfb,0x79,
-0xff,0x30,0x00,0x8d,0xff,0xb3,0x9d,0x00,0xf0,0x07,0x02,0xee,0x27,0xf5,0x00,0x02,
-0xee,0x20,0x7f,0x50,0x01,0xdf,0x30,0x07,0xf5,0x01,0xdf,0x40,0x00,0x7f,0x50,0xcf,
-0x3b,0x02,0xf0,0x04,0xcf,0x70,0x00,0x00,0x7f,0xef,0xfc,0x00,0x00,0x07,0xff,0x78,
-0xf9,0x00,0x00,0x7f,0x80,0x0c,0xf5,0x20,0x01,0x20,0x1e,0xf3,0x37,0x00,0x20,0x3f,
-0xd1,0x2b,0x01,0x21,0x6f,0xb0,0xd5,0x01,0x1e,0x80,0x44,0x01,0x0f,0x09,0x00,0x0d,
-0x00,0x2d,0x06,0x00,0xfa,0x00,0x30,0xc0,0x7f,0xf1,0x26,0x05,0x30,0xff,0x07,0xff,
-0xce,0x00,0x40,0xef,0xf0,0x7f,0xfe,0xbb,0x05,0xf0,0x25,0xff,0x07,0xf9,0xf5,0x00,
-0x00,0x0c,0xea,0xf0,0x7f,0x4f,0xb0,0x00,0x02,0xf8,0xaf,0x07,0xf4,0x9f,0x20,0x00,
-0x9f,0x2b,0xf0,0x7f,0x42,0xf9,0x00,0x0f,0xb0,0xbf,0x07,0xf5,0x0b,0xf0,0x06,0xf4,
-0x0c,0xf0,0x7f,0x50,0x4f,0x60,0xdd,0x00,0xcf,0x07,0xf5,0x00,0xdd,0x4f,0x60,0x0f,
-0x00,0x31,0x07,0xfd,0xf0,0x0f,0x00,0x30,0x1f,0xf9,0x00,0x0f,0x00,0x80,0x00,0x9f,
-0x20,0x00,0xcf,0x00,0x7f,0xb0,0x4b,0x01,0x20,0xff,0x50,0x4b,0x01,0x70,0xff,0x10,
-0x00,0x0d,0xf7,0xfa,0xfb,0x0b,0x00,0x20,0x59,0xf6,0x61,0x01,0x20,0x0e,0xf2,0x61,
-0x01,0x20,0x4f,0xc0,0x6c,0x01,0x20,0x9f,0x60,0x6c,0x01,0x70,0xdf,0x2d,0xf7,0xf5,
-0x00,0x03,0xfc,0x0b,0x00,0x20,0x08,0xff,0x82,0x01,0x20,0x0d,0xff,0xb2,0x00,0xf0,
-0x09,0x3f,0xf0,0x00,0x29,0xdf,0xe9,0x20,0x00,0x3f,0xfa,0x8a,0xff,0x40,0x1e,0xe2,
-0x00,0x02,0xee,0x17,0xf6,0x00,0x00,0x05,0xf7,0xfc,0x01,0x30,0x0f,0xcd,0xe0,0x81,
-0x03,0x10,0xed,0x1c,0x02,0x20,0xfd,0xe0,0x28,0x03,0x01,0x16,0x00,0x20,0xc7,0xf7,
-0x21,0x00,0xf0,0x01,0x1e,0xe2,0x00,0x01,0xdf,0x10,0x3f,0xfa,0x89,0xff,0x50,0x00,
-0x29,0xdf,0xea,0x20,0xb8,0x02,0x80,0xeb,0x30,0x07,0xfa,0x77,0x79,0xff,0x50,0x80,
-0x01,0x10,0xfe,0x15,0x01,0x20,0x09,0xf3,0x64,0x00,0x20,0x8f,0x47,0x6f,0x00,0x80,
-0xf1,0x7f,0x61,0x11,0x3b,0xfa,0x07,0xff,0x7e,0x08,0x42,0x7f,0x84,0x44,0x30,0x36,
-0x01,0x02,0x96,0x02,0x06,0x0b,0x00,0x00,0x80,0x05,0x50,0xef,0xd9,0x20,0x00,0x4f,
-0x90,0x00,0x10,0x1f,0x90,0x00,0x60,0x18,0xf5,0x00,0x00,0x06,0xf6,0x98,0x03,0x20,
-0x1f,0xbe,0xb5,0x05,0x20,0xed,0xfc,0x54,0x04,0x20,0xee,0xd0,0xe6,0x06,0x10,0xdf,
-0x16,0x00,0x20,0xb8,0xf6,0xfc,0x02,0xf1,0x01,0x1f,0xe1,0x00,0x02,0xee,0x10,0x4f,
-0xf9,0x8a,0xfe,0x30,0x00,0x2a,0xef,0xef,0xd2,0x2c,0x07,0x01,0x32,0x07,0x12,0x2c,
-0x57,0x00,0x01,0x0b,0x04,0x61,0x07,0xfa,0x77,0x7b,0xfe,0x20,0x20,0x04,0x10,0x07,
-0x9d,0x03,0x00,0xe9,0x01,0xf0,0x04,0x03,0xf9,0x07,0xf6,0x11,0x26,0xef,0x20,0x7f,
-0xff,0xff,0xfc,0x30,0x07,0xf8,0x44,0x8f,0x70,0x00,0x30,0x01,0x60,0x10,0x07,0xf5,
-0x00,0x05,0xf8,0x0b,0x00,0x40,0x0d,0xf1,0x07,0xf5,0x87,0x05,0x00,0xa0,0x00,0xd0,
-0xcf,0x10,0x00,0x18,0xdf,0xeb,0x40,0x00,0x2e,0xfa,0x78,0xdf,0x80,0x25,0x08,0x90,
-0xbf,0x30,0xcf,0x00,0x00,0x04,0xe6,0x09,0xf7,0x64,0x00,0x30,0x1d,0xfc,0x61,0x0a,
-0x07,0x20,0xdf,0xfc,0x73,0x00,0x40,0x27,0xdf,0xa0,0x00,0x45,0x08,0x80,0x52,0xe8,
-0x00,0x00,0x04,0xf8,0x0e,0xe2,0xd2,0x05,0xc0,0x4f,0xfa,0x78,0xbf,0xd0,0x00,0x19,
-0xdf,0xec,0x70,0x00,0x8f,0x21,0x03,0x90,0xe3,0x77,0x78,0xfc,0x77,0x76,0x00,0x00,
-0x3f,0x30,0x05,0x10,0x03,0xf7,0x04,0x0f,0x0b,0x00,0x1e,0x00,0x94,0x01,0x7f,0xbf,
-0x1b,0xf1,0x00,0x00,0x0b,0xf1,0x0b,0x00,0x13,0x30,0x19,0xf3,0x00,0x33,0x03,0xf0,
-0x09,0xa0,0x00,0x05,0xfb,0x00,0xbf,0xc8,0x7a,0xfe,0x20,0x00,0x6c,0xff,0xd8,0x00,
-0x00,0x8f,0x60,0x00,0x00,0x04,0xfa,0x2f,0xb0,0xfc,0x08,0xe1,0x0c,0xf1,0x00,0x00,
-0x0f,0xd0,0x06,0xf6,0x00,0x00,0x5f,0x70,0x00,0xfc,0x64,0x00,0x90,0x9f,0x20,0x01,
-0xfb,0x00,0x00,0x3f,0x70,0x06,0xcc,0x01,0xd1,0xd0,0x0c,0xe0,0x00,0x00,0x07,0xf3,
-0x1f,0x90,0x00,0x00,0x01,0xf8,0x02,0x08,0x26,0xbe,0xdc,0x71,0x01,0x21,0x0e,0xf1,
-0x38,0x00,0xf0,0x04,0x05,0xf7,0x00,0x00,0x7f,0x51,0xfb,0x00,0x00,0xaf,0xb0,0x00,
-0x0b,0xf1,0x0d,0xe0,0x00,0x0e,0xff,0x44,0x0b,0xf0,0x2a,0x8f,0x20,0x03,0xf9,0xf4,
-0x00,0x2f,0x90,0x04,0xf6,0x00,0x8f,0x1e,0x90,0x06,0xf5,0x00,0x1f,0xa0,0x0d,0xb0,
-0xae,0x00,0xaf,0x10,0x00,0xce,0x01,0xf6,0x05,0xf2,0x0e,0xc0,0x00,0x08,0xf2,0x6f,
-0x20,0x1f,0x71,0xf8,0x00,0x00,0x4f,0x6b,0xd0,0x00,0xcb,0x5f,0x40,0x00,0x01,0xf9,
-0xf8,0x00,0x07,0xf9,0x5c,0x0a,0x50,0xef,0x30,0x00,0x3f,0xec,0x81,0x0a,0x00,0x38,
-0x06,0xb0,0x80,0x00,0x00,0x04,0xf9,0x00,0x00,0x09,0xf4,0x00,0x00,0xcc,0x04,0xd0,
-0x2f,0xe1,0x06,0xfa,0x00,0x00,0xbf,0x50,0x00,0xbf,0x50,0x06,0xfa,0x13,0x00,0x80,
-0x1e,0xe1,0x00,0x00,0x06,0xf9,0xaf,0x50,0xd3,0x09,0x11,0xfa,0xaf,0x06,0x11,0xf3,
-0xe3,0x05,0x10,0xfb,0x72,0x02,0xf0,0x15,0xf9,0xaf,0x60,0x00,0x00,0x2f,0xe0,0x1e,
-0xf1,0x00,0x00,0xcf,0x40,0x05,0xfb,0x00,0x07,0xf9,0x00,0x00,0xaf,0x60,0x2f,0xe1,
-0x00,0x00,0x1e,0xf1,0x9f,0x70,0x00,0x00,0x1f,0xe0,0x1e,0xe0,0xb2,0x01,0xf1,0x02,
-0x06,0xf8,0x00,0x02,0xfc,0x00,0x00,0xdf,0x10,0x0a,0xf3,0x00,0x00,0x4f,0x80,0x2f,
-0xa0,0x48,0x01,0x61,0x20,0x00,0x00,0x02,0xfc,0xf8,0xe4,0x06,0x15,0xe0,0x94,0x01,
-0x0f,0x06,0x00,0x04,0x20,0x1f,0xff,0xe1,0x06,0x40,0x77,0x77,0x77,0x7f,0x1c,0x07,
-0x01,0x29,0x02,0x20,0x04,0xfb,0x99,0x0c,0x23,0xee,0x10,0x6d,0x0a,0x30,0x00,0x7f,
-0x90,0x2c,0x00,0x10,0xd0,0x69,0x03,0x01,0x24,0x00,0x10,0xf6,0x31,0x07,0x10,0xfa,
-0x24,0x00,0x60,0xef,0x76,0x66,0x66,0x64,0x3f,0x42,0x00,0x9f,0xa0,0x01,0x11,0xaf,
-0xfd,0xaf,0x53,0xaf,0x10,0x02,0x00,0x08,0x90,0x21,0xaf,0xfd,0x24,0x43,0x6f,0x30,
-0x00,0x00,0x9a,0x01,0x50,0x0a,0xe0,0x00,0x00,0x04,0x59,0x03,0x10,0xdb,0x62,0x00,
-0x20,0x20,0x00,0x6e,0x0c,0x01,0x61,0x07,0x23,0x05,0xf4,0xb3,0x09,0x20,0x8f,0x10,
-0x8b,0x07,0x10,0x00,0x47,0x0c,0x02,0xbf,0x09,0x8f,0x74,0x11,0x10,0xef,0xf9,0x45,
-0xf9,0x02,0x02,0x00,0x08,0x90,0x13,0xf9,0xef,0xf9,0x44,0x42,0x00,0x05,0x50,0x23,
-0x01,0xf0,0x0e,0x00,0x00,0x7f,0xf6,0x00,0x00,0xe9,0xbd,0x00,0x05,0xf3,0x4f,0x30,
-0x0c,0xc0,0x0e,0xa0,0x3f,0x60,0x07,0xf1,0x11,0x11,0x11,0x11,0x0f,0xff,0xff,0xff,
-0xfc,0x05,0xf1,0x07,0x44,0x20,0x17,0x60,0x00,0x8f,0x40,0x00,0x8e,0x10,0x03,0xbe,
-0xfd,0x60,0x03,0xfd,0x76,0xcf,0x60,0x9d,0x10,0x00,0x41,0x0d,0xf1,0x0e,0xe0,0x04,
-0xbe,0xff,0xff,0x07,0xfb,0x53,0x3c,0xf0,0xed,0x00,0x00,0xcf,0x0e,0xd0,0x00,0x2e,
-0xf0,0x8f,0xc8,0x9f,0xff,0x00,0x7d,0xfd,0x58,0xd2,0xbf,0x94,0x09,0x00,0x1e,0x01,
-0x05,0x09,0x00,0xf0,0x02,0x3c,0xfe,0xa1,0x0b,0xff,0x97,0xbf,0xd0,0xbf,0x40,0x00,
-0x9f,0x6b,0xf0,0x00,0x01,0xfa,0xa7,0x0a,0xf0,0x1c,0xcb,0xf0,0x00,0x00,0xfc,0xbf,
-0x00,0x00,0x2f,0xab,0xf5,0x00,0x09,0xf5,0xbf,0xf9,0x7b,0xfc,0x0b,0xe3,0xcf,0xea,
-0x10,0x00,0x19,0xef,0xc6,0x00,0x01,0xef,0x86,0xbf,0x90,0x0a,0xf3,0x00,0x0a,0xf1,
-0x0f,0xc0,0x00,0x02,0x72,0x12,0x01,0x01,0x17,0x01,0x00,0x20,0x0d,0x30,0x01,0x31,
-0x0a,0x2e,0x0d,0x91,0x02,0xef,0x86,0xaf,0x80,0x00,0x2a,0xef,0xd6,0x19,0x0e,0x1c,
-0xf5,0x05,0x00,0xf4,0x06,0x3b,0xfe,0xa7,0xf5,0x02,0xff,0x97,0xbf,0xf5,0x0a,0xf4,
-0x00,0x09,0xf5,0x0f,0xd0,0x00,0x05,0xf5,0x1f,0xa0,0x05,0x00,0xf0,0x19,0x0f,0xc0,
-0x00,0x05,0xf5,0x0a,0xf2,0x00,0x08,0xf5,0x02,0xfe,0x64,0x9f,0xf5,0x00,0x2b,0xff,
-0xb6,0xf5,0x00,0x19,0xef,0xd6,0x00,0x01,0xdf,0x86,0xbf,0x70,0x09,0xf3,0x00,0x0b,
-0xf0,0x0e,0xc1,0x11,0x17,0xf4,0xfe,0x01,0x80,0xf5,0x1f,0xb4,0x44,0x44,0x41,0x0f,
-0xc0,0x13,0x0a,0xe0,0xf5,0x00,0x02,0x70,0x01,0xef,0x96,0x8f,0xd0,0x00,0x19,0xef,
-0xe9,0x10,0x9f,0x0e,0x70,0x00,0x9f,0xf9,0x00,0x7f,0xa5,0x30,0xd0,0x06,0x10,0xdd,
-0xdc,0x0b,0x71,0xf0,0x24,0xee,0x44,0x00,0x0d,0xd0,0x43,0x0b,0x0f,0x07,0x00,0x02,
-0x50,0x00,0x3b,0xfe,0xa5,0xf6,0x99,0x00,0x10,0xf6,0x99,0x00,0x10,0xf6,0x99,0x00,
-0x34,0xf6,0x1f,0xa0,0x05,0x00,0x01,0x0f,0x00,0x01,0x19,0x00,0x01,0x23,0x00,0x01,
-0xc6,0x00,0x10,0x00,0x93,0x08,0xe7,0x01,0x80,0x00,0x0d,0xf1,0x05,0xfc,0x77,0xcf,
-0x80,0x00,0x3b,0xef,0xc6,0x5b,0x01,0x05,0x09,0x00,0xfe,0x0b,0x2b,0xfe,0xa1,0x0b,
-0xfe,0xa7,0xaf,0xb0,0xbf,0x60,0x00,0xbf,0x0b,0xf0,0x00,0x08,0xf2,0xbf,0x00,0x00,
-0x8f,0x3b,0xf0,0x00,0x08,0xf3,0x09,0x00,0x87,0x7f,0x26,0xe2,0x00,0x08,0xf2,0x8f,
-0x28,0x03,0x00,0x60,0x20,0x00,0x9e,0x10,0x08,0xd1,0xe5,0x00,0x4f,0xf1,0x00,0xaf,
-0x10,0x05,0x00,0x05,0x5f,0x04,0x8f,0xd0,0x8f,0xc3,0x7e,0x00,0x01,0x50,0x00,0x06,
-0xfa,0x0b,0xf0,0x94,0x04,0xf9,0x14,0x05,0xfc,0x00,0x0b,0xf4,0xfd,0x10,0x00,0xbf,
-0xef,0x80,0x00,0x0b,0xfd,0xcf,0x40,0x00,0xbf,0x22,0xee,0x10,0x0b,0xf0,0x04,0xfb,
-0x00,0xbf,0x00,0x08,0xf7,0x0b,0xf0,0x00,0x0c,0xf3,0x78,0x00,0x04,0x03,0x00,0xf1,
-0x10,0xbe,0x3b,0xff,0xa1,0x2b,0xfe,0xb2,0x0b,0xfe,0x87,0xbf,0xcf,0xa7,0x9f,0xd0,
-0xbf,0x30,0x00,0xcf,0x80,0x00,0x9f,0x3b,0xf0,0x00,0x09,0xf3,0x00,0x06,0xf5,0xbf,
-0xb7,0x0e,0x30,0x5f,0x5b,0xf0,0x2a,0x0f,0x1f,0x05,0x0f,0x00,0x0d,0x0f,0x0b,0x01,
-0x19,0xf0,0x00,0x00,0x19,0xef,0xd8,0x00,0x01,0xdf,0x96,0xaf,0xc0,0x09,0xf4,0x00,
-0x07,0xf7,0xe8,0x01,0x60,0xfc,0x1f,0xa0,0x00,0x00,0xcf,0x6f,0x02,0x11,0xdf,0x0f,
-0x00,0x10,0x0a,0x19,0x00,0xfb,0x0c,0x01,0xef,0x96,0xaf,0xc0,0x00,0x19,0xef,0xd7,
-0x00,0xbe,0x5c,0xfe,0x91,0x0b,0xfe,0x64,0x9f,0xc0,0xbf,0x20,0x00,0x8f,0x5b,0xf0,
-0x00,0x02,0xce,0x02,0xdd,0xf3,0x00,0x0a,0xf5,0xbf,0xe8,0x6b,0xfc,0x0b,0xf4,0xcf,
-0xea,0x10,0x2b,0x01,0x00,0x01,0x02,0xb0,0xa6,0xf5,0x02,0xff,0x86,0xaf,0xf5,0x0b,
-0xf4,0x00,0x08,0x9a,0x02,0x10,0x06,0x95,0x02,0x02,0x05,0x00,0x00,0x9a,0x02,0x10,
-0x06,0xb3,0x02,0x12,0x08,0x23,0x00,0x31,0x00,0x3b,0xff,0x01,0x02,0x2e,0x06,0xf5,
-0x05,0x00,0x86,0xbf,0x5d,0xf2,0xbf,0xf9,0x71,0xbf,0x40,0x80,0x10,0x08,0x03,0x00,
-0xe0,0x00,0x4c,0xfe,0xb4,0x00,0x5f,0xc6,0x7e,0xf4,0x0b,0xf0,0x00,0x2f,0xb0,0x48,
-0x05,0xf0,0x11,0x01,0xcf,0xea,0x50,0x00,0x00,0x38,0xcf,0xe3,0x02,0x10,0x00,0x3f,
-0xb0,0xfc,0x00,0x00,0xec,0x07,0xfc,0x66,0xcf,0x60,0x05,0xcf,0xfc,0x50,0x00,0x85,
-0x00,0x01,0xfa,0x03,0x00,0x62,0xef,0xff,0xf8,0x45,0xfb,0x42,0x0c,0x00,0x08,0x03,
-0x00,0x60,0x00,0xef,0x74,0x00,0x4d,0xf7,0x35,0x01,0x14,0x2b,0x50,0x01,0x0e,0x09,
-0x00,0xf0,0x27,0x29,0xf3,0x00,0x0c,0xf2,0x3f,0xe7,0x8d,0xff,0x20,0x5d,0xfe,0x98,
-0xf2,0x8f,0x30,0x00,0x1f,0xa2,0xf9,0x00,0x06,0xf4,0x0c,0xe0,0x00,0xbe,0x00,0x6f,
-0x30,0x1f,0x90,0x01,0xf9,0x06,0xf3,0x00,0x0b,0xe0,0xbd,0x00,0x00,0x5f,0x5f,0x80,
-0x00,0x00,0xfe,0xf2,0x00,0x00,0x09,0xfc,0x00,0x24,0x11,0x00,0x89,0x0e,0xf1,0x2b,
+0xc2,0x6b,0xc4,0xd3,0xc6,0xb3,0xc7,0x00,0x01,0x00,0x2f,0xfa,0x00,0x01,0x00,0x56,
+0x13,0xf0,0x08,0x00,0x17,0xee,0x14,0x00,0xbf,0xf9,0xf7,0x00,0xfd,0xf7,0x00,0xf4,
+0x00,0x00,0x00,0x02,0x85,0x00,0x53,0x4f,0x03,0x03,0x00,0x03,0x69,0x00,0x52,0x2f,
+0xe7,0x00,0x01,0x00,0x68,0x1f,0xdf,0x71,0x00,0x5d,0x03,0xd4,0x01,0xb1,0xf7,0x00,
+0xfe,0x00,0x00,0xed,0xfd,0xf3,0xf6,0x00,0xf2,0x11,0x00,0x00,0x0f,0x00,0x4f,0xfd,
+0xfe,0xf9,0xfb,0xde,0x01,0x51,0x6f,0xfc,0x00,0xfc,0x00,0x00,0xf8,0xf0,0x00,0x54,
+0x1c,0xfc,0x0a,0x00,0x19,0xfe,0x1f,0x00,0x1f,0xfd,0x79,0x00,0x46,0x13,0xf1,0x5e,
+0x00,0x7f,0xfc,0x00,0xfd,0x00,0xfd,0xfa,0xfd,0xe8,0x01,0x5d,0x15,0x03,0xe2,0x00,
+0x11,0xfd,0x87,0x00,0x2f,0xfd,0xfc,0x83,0x00,0x4a,0x11,0xdd,0x49,0x03,0x15,0xd9,
+0x77,0x00,0x20,0xfb,0xfd,0x73,0x00,0x02,0x04,0x00,0x0f,0xea,0x00,0x50,0x10,0xfc,
+0x08,0x00,0x1f,0xfc,0x61,0x01,0x5a,0x1f,0xfd,0x2e,0x04,0x60,0x10,0xf7,0x5a,0x01,
+0x09,0xdd,0x02,0x01,0x60,0x01,0x3f,0xfd,0xfa,0xf7,0x72,0x00,0x45,0x14,0xce,0x65,
+0x01,0x97,0xf6,0x00,0x00,0xd7,0xf8,0xe6,0xeb,0x00,0xdd,0x13,0x06,0x2f,0xec,0xf2,
+0xed,0x00,0x49,0x72,0xd0,0x00,0x00,0x00,0xec,0x00,0xe2,0x4f,0x02,0x51,0x00,0xfc,
+0x00,0xfe,0xfe,0xbd,0x03,0x1f,0x02,0x81,0x06,0x54,0x6f,0xfa,0x00,0xfc,0xfd,0x00,
+0xfb,0xe3,0x01,0x5e,0x10,0xf4,0x59,0x02,0x1f,0xf9,0xe1,0x00,0x53,0x00,0xcc,0x1d,
+0xa1,0xde,0x00,0x00,0xf4,0xfc,0xdc,0xfe,0x02,0x00,0x02,0x59,0x01,0xdf,0xef,0xf1,
+0x00,0xf0,0xf1,0xf5,0xef,0x00,0xf2,0xf5,0xf8,0xf5,0xf7,0xb2,0x03,0x47,0x66,0xdf,
+0xfb,0x00,0x00,0xf5,0xfe,0x11,0x00,0x90,0xf9,0xf9,0x00,0x00,0xf9,0xfc,0x00,0x00,
+0xfc,0x14,0x00,0x0f,0xf7,0x07,0x45,0x42,0x02,0x00,0xee,0xf7,0xf7,0x00,0x13,0x02,
+0x11,0x00,0x23,0xfb,0xfb,0xaa,0x04,0x1f,0x00,0xd8,0x08,0x4b,0x14,0xf9,0x7f,0x06,
+0x15,0x02,0x8b,0x06,0x01,0x94,0x05,0x1f,0xfb,0xf8,0x06,0x48,0xf0,0x0a,0x03,0xf9,
+0xe1,0xf8,0x00,0x00,0xf2,0xfc,0xf2,0xfe,0x03,0xf2,0x03,0x03,0x02,0x03,0x00,0x03,
+0xf5,0xf6,0xfd,0xfa,0xf6,0xfa,0xf7,0x8d,0x06,0x3f,0xfd,0xfc,0x03,0x64,0x02,0x4a,
+0x2a,0x02,0xfc,0x2a,0x05,0x02,0x82,0x06,0x1f,0xfc,0x96,0x05,0x52,0x0f,0x99,0x05,
+0x57,0x1f,0xf6,0x1d,0x00,0x09,0x1f,0xfe,0xd3,0x08,0x50,0x0f,0x77,0x00,0x02,0x1f,
+0xfe,0x7a,0x00,0x44,0x1f,0xfe,0x22,0x0b,0x63,0x1f,0xfe,0x94,0x00,0x63,0x1e,0x02,
+0x87,0x04,0x19,0x03,0x7a,0x01,0x1f,0x03,0x36,0x0a,0x46,0x0f,0x01,0x00,0x75,0x0f,
+0x49,0x03,0x4f,0x1f,0xec,0xdc,0x01,0x0b,0x2f,0xfd,0xfe,0xdc,0x01,0x45,0x0a,0xdc,
+0x0e,0x01,0x0e,0x07,0x20,0xfd,0x02,0xf1,0x00,0x10,0x07,0x78,0x0e,0x0f,0x68,0x01,
+0xbb,0x17,0x02,0xd2,0x0f,0x05,0x5c,0x01,0x2f,0xfe,0x02,0xd0,0x03,0x51,0x1f,0xee,
+0xca,0x02,0x77,0x1f,0xfd,0xbb,0x04,0x63,0x1f,0xfe,0xe3,0x00,0xcc,0x0f,0x6f,0x0a,
+0x18,0x1f,0xfa,0xc1,0x00,0x0c,0x1f,0xfd,0xef,0x12,0x42,0x2f,0xf7,0xf7,0x9f,0x0d,
+0x58,0x05,0x6d,0x00,0x21,0xf7,0xf1,0x0a,0x00,0x13,0xeb,0xb4,0x0d,0x0c,0xc4,0x0d,
+0x0f,0x1d,0x01,0x01,0x3f,0xfa,0xfa,0xfa,0x54,0x01,0x34,0x1f,0xf4,0xcb,0x01,0x6d,
+0x0f,0x01,0x00,0x44,0x2e,0xeb,0xf1,0xe7,0x00,0x0f,0x1d,0x15,0x50,0x13,0xf1,0x77,
+0x00,0x1f,0x06,0x5e,0x01,0x54,0x0f,0xca,0x02,0x0d,0x1f,0x0c,0xee,0x00,0x52,0x0f,
+0x1e,0x04,0x5d,0x0a,0x5c,0x02,0x1f,0xeb,0x9e,0x04,0x64,0x1e,0xee,0x2f,0x04,0x0f,
+0x63,0x02,0x41,0x2b,0xe8,0xe2,0xca,0x02,0x02,0x75,0x08,0x1f,0xeb,0x2b,0x04,0x11,
+0x03,0x54,0x07,0x3f,0xe5,0xeb,0xe5,0x41,0x03,0x1f,0x1e,0xe2,0x77,0x08,0x0f,0x74,
+0x0a,0x15,0x13,0xeb,0x07,0x00,0x2f,0xeb,0xeb,0xce,0x12,0x3a,0x0f,0x30,0x03,0x50,
+0x0f,0xc9,0x01,0x49,0x0f,0xd3,0x0b,0x15,0x1f,0x09,0x38,0x12,0x4f,0x0f,0x98,0x04,
+0x63,0x52,0xf1,0xf7,0xf7,0x00,0xf7,0xf9,0x06,0x00,0xd0,0x01,0x23,0xee,0xfa,0x63,
+0x01,0x10,0xf1,0xf7,0x00,0x1f,0xfa,0xee,0x00,0x48,0x0f,0xed,0x08,0x62,0x16,0xf4,
+0xe9,0x07,0x00,0xee,0x00,0x20,0xf7,0xf4,0x08,0x00,0x1f,0xfd,0xb5,0x0d,0x4e,0x13,
+0xf7,0xb7,0x02,0x3f,0xfa,0x03,0x03,0xbe,0x02,0x5e,0x0f,0xa6,0x03,0x4d,0x0f,0x6b,
+0x08,0x83,0x02,0xeb,0x04,0x1f,0xf1,0x64,0x02,0x62,0x1f,0xf4,0x66,0x00,0x5c,0x1f,
+0xf7,0xd5,0x08,0x58,0x18,0xf7,0xea,0x07,0x01,0x87,0x00,0x2f,0xf4,0xfa,0x4f,0x02,
+0x5b,0x1f,0xfa,0x16,0x0c,0x58,0x0c,0xdc,0x00,0x0f,0x5a,0x10,0x5e,0x0f,0xb2,0x0a,
+0x18,0x1f,0xfa,0x46,0x0c,0x2e,0x0c,0x39,0x11,0x1f,0xfa,0x7b,0x0d,0x59,0x0f,0x4e,
+0x13,0x67,0x1f,0xfa,0x39,0x0b,0x5a,0x2f,0xe2,0xe2,0xba,0x01,0x0c,0x17,0xf1,0x8d,
+0x00,0x18,0xf4,0x1d,0x00,0x32,0xfa,0x00,0xe5,0x6d,0x03,0x10,0xfa,0x6d,0x0e,0x23,
+0xeb,0xf1,0x04,0x0a,0x2f,0xf4,0xee,0x87,0x05,0x34,0x00,0x50,0x0a,0x07,0x5e,0x03,
+0x00,0x62,0x04,0x13,0xfa,0xb7,0x06,0x18,0xfa,0xf4,0x03,0x1f,0xf7,0xc3,0x06,0x18,
+0x1f,0xf7,0xfe,0x05,0x63,0x2f,0xee,0xee,0x9c,0x06,0x33,0x1f,0xf7,0x04,0x0d,0x24,
+0x0f,0x71,0x06,0x89,0x1e,0xf7,0x16,0x0c,0x0f,0xf7,0x00,0x23,0x2f,0xe5,0xe8,0x19,
+0x15,0x12,0x26,0xf4,0xf4,0x0a,0x02,0x05,0xaa,0x00,0x26,0xee,0xf1,0x6e,0x03,0x2f,
+0xe8,0xf4,0x6c,0x01,0x1a,0x2f,0xeb,0xe8,0xdc,0x01,0x1d,0x1e,0x03,0xa1,0x01,0x0f,
+0xad,0x01,0x1f,0x2f,0xe8,0xe5,0xfd,0x01,0x21,0x02,0x86,0x00,0x44,0xee,0xf4,0xf4,
+0xf4,0x75,0x0a,0x24,0xeb,0xf7,0x5d,0x05,0x0f,0x77,0x00,0x13,0x1f,0xe8,0x61,0x03,
+0x0e,0x1f,0xfa,0x1c,0x00,0x07,0x05,0x05,0x01,0x2f,0xfd,0xf1,0xcb,0x05,0x3d,0x0f,
+0x71,0x08,0x42,0x2f,0xe5,0xe5,0x6f,0x03,0x27,0x12,0xfa,0x65,0x01,0x0f,0xdc,0x01,
+0x22,0x1f,0xeb,0xee,0x17,0x27,0x0e,0x53,0x02,0x0f,0x1b,0x0b,0x53,0x06,0xab,0x14,
+0x0f,0x51,0x15,0x50,0x05,0xaa,0x00,0x28,0xfa,0xee,0x5b,0x05,0x1f,0xf1,0xe7,0x11,
+0x5b,0x00,0xbc,0x10,0x1f,0xf7,0xdb,0x12,0x66,0x1f,0xfa,0xce,0x17,0x1b,0x1f,0xfd,
+0xb1,0x0d,0x2e,0x1f,0xfd,0xf9,0x06,0x47,0x0f,0x19,0x06,0x0e,0x1f,0xfa,0x77,0x00,
+0x63,0x0f,0x1b,0x18,0x58,0x1f,0xf7,0x84,0x00,0x27,0x0f,0x4c,0x05,0x1a,0x1f,0x06,
+0x77,0x00,0x36,0x2f,0xee,0xf1,0xdc,0x01,0x35,0x1f,0xfd,0xca,0x02,0x55,0x0f,0x62,
+0x15,0x29,0x1f,0xf7,0x98,0x16,0x3c,0x0f,0x53,0x02,0x33,0x1f,0xee,0xed,0x0a,0x14,
+0x1f,0xf7,0x77,0x00,0x3b,0x1f,0xeb,0xee,0x00,0x43,0x0f,0xbc,0x0f,0x29,0x1f,0xfa,
+0xa3,0x18,0x63,0x1f,0xf1,0xda,0x12,0x51,0x1f,0xfa,0x02,0x13,0x57,0x12,0xfa,0xe5,
+0x0d,0x1f,0xf7,0x80,0x00,0x13,0x1f,0xfa,0xe5,0x00,0x4f,0x1f,0x09,0xc5,0x0c,0x63,
+0x1f,0x09,0x78,0x00,0x05,0x1f,0x0f,0xd2,0x01,0x7f,0x0f,0x7b,0x0d,0x17,0x1f,0xfa,
+0x23,0x22,0x14,0x1e,0xf7,0x2f,0x06,0x0f,0x2f,0x04,0x29,0x0f,0x19,0x03,0x44,0x0f,
+0x77,0x00,0x39,0x0f,0x2c,0x0f,0x46,0x2f,0x06,0x06,0x1a,0x19,0x36,0x0f,0x74,0x17,
+0xa2,0x09,0xa2,0x0b,0x0f,0x41,0x13,0x17,0x2f,0xe8,0xe8,0xb1,0x01,0x27,0x17,0xe8,
+0x21,0x12,0x0f,0xf2,0x11,0x1c,0x1f,0xfa,0x26,0x02,0x3c,0x1f,0xfa,0x7b,0x0d,0x40,
+0x0b,0xd9,0x21,0x4f,0xfa,0xfd,0xfd,0xfd,0x82,0x0a,0x24,0x2f,0xee,0xf4,0xe0,0x23,
+0x88,0x1f,0xf7,0x3f,0x01,0x0e,0x1f,0xfa,0xe9,0x12,0x63,0x0f,0x8d,0x0c,0x3c,0x1f,
+0xf7,0xf4,0x03,0x09,0x1e,0xfd,0x95,0x0f,0x0f,0x04,0x0d,0x42,0x19,0xfa,0x38,0x10,
+0x17,0xf1,0xd1,0x0f,0x2f,0xfa,0xf7,0x69,0x0e,0x2b,0x2e,0xee,0xee,0xa1,0x06,0x05,
+0xc8,0x02,0x28,0xf1,0xf1,0x52,0x01,0x44,0xee,0xfa,0xfd,0xfd,0x2f,0x04,0x26,0xf7,
+0xf4,0x32,0x04,0x12,0x01,0xe7,0x2e,0x30,0x02,0x03,0x00,0x7b,0x3b,0x2e,0x04,0x05,
+0x64,0x05,0x03,0xbc,0x3b,0x00,0xbd,0x3b,0x30,0x0c,0x0c,0x09,0xdf,0x3c,0x22,0x13,
+0x0d,0xc1,0x3b,0x01,0x20,0x00,0xff,0x0c,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,
+0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,
+0x24,0x27,0x28,0xcb,0x00,0x08,0xf0,0x4e,0x29,0x2a,0x2b,0x00,0x2c,0x2d,0x2e,0x2f,
+0x30,0x31,0x32,0x00,0x33,0x00,0x34,0x35,0x00,0x00,0x36,0x37,0x38,0x39,0x3a,0x3b,
+0x3c,0x00,0x3d,0x3e,0x3f,0x40,0x41,0x42,0x00,0x00,0x00,0x43,0x44,0x45,0x46,0x47,
+0x48,0x00,0x49,0x31,0x4a,0x00,0x4b,0x4c,0x00,0x00,0x31,0x4d,0x4e,0x4e,0x4f,0x50,
+0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x00,0x5a,0x5b,0x5c,0x5d,0x5e,0x5f,
+0x60,0x61,0x62,0x63,0x64,0x2d,0x65,0x66,0x00,0x67,0x68,0x69,0x6a,0x6a,0x6b,0x00,
+0x6c,0x6d,0x6e,0x00,0x6f,0x61,0x00,0xff,0x05,0x70,0x00,0x71,0x00,0x00,0x2d,0x72,
+0x73,0x00,0x00,0x00,0x74,0x75,0x76,0x77,0x00,0x78,0x79,0x7a,0x00,0x01,0x00,0xff,
+0x48,0x02,0x46,0x02,0x20,0x03,0x02,0x41,0x02,0x4d,0x06,0x07,0x06,0x08,0x68,0x0a,
+0x70,0x0a,0x00,0x0b,0x00,0x00,0x00,0x0b,0x11,0x25,0x01,0x08,0x00,0x20,0x0b,0x00,
+0x0c,0x3e,0x00,0x0b,0x3e,0xd1,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,
+0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,
+0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,0x00,0x02,0xf1,0x03,0x24,0x00,0x25,
+0x26,0x27,0x28,0x00,0x29,0x00,0x2a,0x2b,0x2c,0x2d,0x00,0x2a,0x2a,0x00,0x00,0x4e,
+0x02,0x30,0x33,0x34,0x35,0x4a,0x02,0xf3,0x01,0x00,0x3a,0x3b,0x3c,0x3c,0x3d,0x3e,
+0x00,0x00,0x3f,0x00,0x00,0x40,0x41,0x00,0x42,0x4e,0x02,0x91,0x49,0x4a,0x00,0x4b,
+0x4b,0x00,0x4c,0x4d,0x00,0x4b,0x02,0x00,0x4c,0x02,0x01,0x4d,0x02,0x22,0x55,0x43,
+0x4e,0x02,0x11,0x55,0x4f,0x02,0x40,0x00,0x00,0x65,0x66,0x4f,0x02,0x41,0x00,0x00,
+0x00,0x6b,0x50,0x02,0xdf,0x70,0x71,0x72,0x00,0x00,0x73,0x00,0x74,0x75,0x00,0x00,
+0x76,0x77,0x40,0x02,0xff,0x43,0x50,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const uint8_t lz4BitmapData[] ={
+0xf1,0x35,0x7f,0x56,0xf5,0x6f,0x46,0xf4,0x6f,0x46,0xf4,0x5f,0x45,0xf3,0x5f,0x32,
+0x71,0x00,0x04,0xd4,0x5f,0x50,0xb9,0x3f,0x1b,0x83,0xf0,0xb7,0x3f,0x0b,0x63,0xe0,
+0x52,0x16,0x00,0x00,0x00,0xe6,0x02,0xf3,0x00,0x00,0x2f,0x20,0x6e,0x00,0x00,0x06,
+0xe0,0x0a,0xb0,0x03,0xff,0xff,0xff,0xff,0xf7,0x04,0x4e,0x94,0x4f,0x64,0x10,0x00,
+0xf5,0x03,0xf1,0x00,0x00,0x3f,0x1b,0x00,0xf0,0x65,0xf0,0x09,0xc0,0x00,0xef,0xff,
+0xff,0xff,0xfc,0x03,0x3c,0xa3,0x3f,0x73,0x20,0x00,0xe6,0x02,0xf2,0x00,0x00,0x2f,
+0x30,0x5f,0x00,0x00,0x05,0xf0,0x08,0xc0,0x00,0x00,0x00,0x00,0x61,0x00,0x00,0x00,
+0x2f,0x40,0x00,0x00,0x16,0xf7,0x00,0x00,0x4f,0xff,0xff,0x40,0x1f,0xd3,0x04,0xee,
+0x05,0xf5,0x00,0x06,0xf5,0x6f,0x50,0x00,0x3d,0x63,0xfc,0x00,0x00,0x00,0x09,0xfe,
+0x71,0x00,0x00,0x06,0xef,0xfa,0x10,0x00,0x00,0x4b,0xfe,0x10,0x00,0x00,0x08,0xf7,
+0xca,0x00,0x00,0x1f,0x9c,0xf1,0x00,0x04,0xf8,0x5f,0xc4,0x36,0xef,0x20,0x6f,0xff,
+0xfe,0x40,0x00,0x06,0xf3,0x00,0x00,0x00,0x4f,0x10,0x00,0x02,0xbf,0xe7,0x56,0x00,
+0xf0,0x13,0x0d,0xa2,0x4f,0x40,0x04,0x30,0x00,0x0f,0x40,0x0c,0x70,0x1e,0x40,0x00,
+0x0e,0x80,0x2f,0x50,0xaa,0x00,0x00,0x04,0xef,0xf9,0x05,0xe1,0x00,0x00,0x00,0x01,
+0x00,0x1e,0x50,0x00,0x01,0x00,0x11,0xaa,0x06,0x00,0xf1,0x07,0x05,0xe1,0x4c,0xea,
+0x10,0x00,0x00,0x1e,0x52,0xf6,0x3b,0xc0,0x00,0x00,0xaa,0x06,0xd0,0x03,0xf0,0x00,
+0x05,0xe1,0x07,0x00,0x51,0x06,0x50,0x02,0xf6,0x2a,0xa7,0x00,0xf3,0x64,0x5d,0xfb,
+0x20,0x00,0x07,0xdf,0xd5,0x00,0x00,0x00,0x8f,0xa6,0xcf,0x40,0x00,0x00,0xdd,0x00,
+0x0f,0x90,0x00,0x00,0xed,0x00,0x3f,0x60,0x00,0x00,0x8f,0x65,0xec,0x00,0x00,0x00,
+0x0c,0xff,0x90,0x00,0x00,0x00,0x4e,0xff,0x30,0x00,0x10,0x05,0xfb,0x2e,0xe1,0x0a,
+0xe0,0x0e,0xe0,0x03,0xfd,0x0d,0xc0,0x0f,0xb0,0x00,0x5f,0xdf,0x70,0x0e,0xe0,0x00,
+0x08,0xff,0x10,0x05,0xfc,0x53,0x6e,0xff,0x70,0x00,0x3b,0xef,0xe9,0x2b,0xf5,0x0f,
+0x50,0xf5,0x0f,0x40,0xf3,0x05,0x00,0x00,0x01,0x90,0x00,0x0d,0xb0,0x00,0xad,0x00,
+0x04,0xf4,0x00,0x0b,0xd0,0x00,0x1f,0x80,0x00,0x6f,0x40,0x00,0x9f,0x10,0x00,0xbf,
+0x00,0x03,0x00,0x50,0xaf,0x00,0x00,0x7f,0x30,0x68,0x00,0x90,0x0e,0xb0,0x00,0x07,
+0xf2,0x00,0x00,0xda,0x00,0x0d,0x00,0xa1,0x04,0xe0,0x00,0x00,0x00,0x65,0x00,0x00,
+0x4f,0x50,0x15,0x00,0xf1,0x1f,0xdc,0x00,0x00,0x6f,0x30,0x00,0x1f,0x90,0x00,0x0c,
+0xd0,0x00,0x09,0xf1,0x00,0x08,0xf2,0x00,0x07,0xf3,0x00,0x08,0xf3,0x00,0x09,0xf2,
+0x00,0x0b,0xf0,0x00,0x0f,0xb0,0x00,0x3f,0x50,0x00,0x9e,0x00,0x02,0xf5,0x00,0x1d,
+0xa0,0x00,0x8a,0x00,0x01,0x00,0xf0,0x14,0x09,0xc0,0x00,0x00,0x08,0xc0,0x00,0x69,
+0x38,0xc1,0x77,0x6d,0xff,0xff,0xf9,0x00,0x4f,0xf6,0x00,0x00,0xcb,0xbd,0x00,0x08,
+0xf2,0x1e,0x90,0x01,0x40,0x04,0x20,0x00,0x00,0x5a,0x20,0xee,0x00,0x17,0x30,0x05,
+0x00,0x60,0x29,0x99,0xcf,0xa9,0x99,0x4f,0xeb,0x01,0x0b,0x19,0x00,0x01,0x05,0x00,
+0xf2,0x0c,0x0d,0xd0,0xdd,0x0f,0xa7,0xf3,0x25,0x00,0x01,0x11,0x1a,0xff,0xfe,0x24,
+0x44,0x30,0x6e,0x46,0xf4,0x00,0x00,0x06,0xf1,0x00,0x00,0x0c,0xb0,0xe3,0x01,0xf0,
+0x10,0x8e,0x00,0x00,0x00,0xe8,0x00,0x00,0x05,0xf2,0x00,0x00,0x0b,0xc0,0x00,0x00,
+0x1f,0x50,0x00,0x00,0x7e,0x00,0x00,0x00,0xe9,0x00,0x00,0x04,0xf3,0x00,0x00,0x0a,
+0x13,0x00,0xf0,0x1c,0x60,0x00,0x00,0x7f,0x10,0x00,0x00,0x55,0x00,0x00,0x00,0x02,
+0xae,0xfd,0x80,0x01,0xef,0x97,0xbf,0xa0,0x7f,0x50,0x00,0xaf,0x2c,0xf0,0x00,0x04,
+0xf6,0xed,0x00,0x00,0x2f,0x8e,0xc0,0x00,0x02,0xf9,0xfc,0x00,0x00,0x2f,0x9e,0x09,
+0x00,0x00,0x12,0x00,0xff,0x11,0x8b,0xf0,0x00,0x05,0xf6,0x7f,0x50,0x00,0xbf,0x20,
+0xef,0x96,0xbf,0x90,0x01,0xae,0xfd,0x70,0x00,0x00,0x04,0xab,0x29,0xef,0xfc,0x6e,
+0x93,0xfc,0x10,0x00,0xfc,0x00,0x03,0x00,0x08,0xf0,0x06,0x3b,0xef,0xd7,0x00,0x04,
+0xfe,0x87,0xbf,0xb0,0x0d,0xe1,0x00,0x0b,0xf3,0x1f,0xa0,0x00,0x06,0xf5,0x00,0x00,
+0x3d,0x01,0xc0,0x00,0x00,0x1e,0xa0,0x00,0x00,0x00,0xce,0x10,0x00,0x00,0x0b,0x59,
+0x02,0xf1,0x04,0xbf,0x40,0x00,0x00,0x0a,0xf4,0x00,0x00,0x00,0xaf,0x40,0x00,0x00,
+0x09,0xfa,0x66,0x66,0x65,0x0e,0x06,0x01,0xf0,0x01,0x4b,0xef,0xd7,0x00,0x06,0xfc,
+0x76,0xaf,0xb0,0x0e,0xd0,0x00,0x0a,0xf2,0x01,0x10,0x70,0x01,0xf0,0x04,0x00,0x12,
+0x7f,0x90,0x00,0x06,0xff,0xf9,0x00,0x00,0x01,0x45,0xaf,0x80,0x00,0x00,0x00,0x0a,
+0xf2,0x65,0x02,0x60,0xf6,0x1e,0x90,0x00,0x05,0xf6,0x69,0x00,0xa0,0xf2,0x05,0xfe,
+0x76,0xbf,0x90,0x00,0x4b,0xff,0xd6,0x87,0x01,0x70,0xcf,0x60,0x00,0x00,0x00,0x6f,
+0xf6,0x06,0x03,0xf0,0x15,0xdf,0x60,0x00,0x00,0x0b,0xd6,0xf6,0x00,0x00,0x06,0xf4,
+0x5f,0x60,0x00,0x01,0xfa,0x05,0xf6,0x00,0x00,0xbe,0x10,0x5f,0x60,0x00,0x5f,0x50,
+0x05,0xf6,0x00,0x1e,0xc1,0x11,0x6f,0x61,0x07,0x77,0x00,0x70,0xf4,0x24,0x44,0x44,
+0x8f,0x84,0x10,0x55,0x00,0x00,0x42,0x00,0x30,0x5f,0x60,0x00,0x17,0x00,0x60,0x80,
+0x9f,0x88,0x88,0x84,0x0b,0x17,0x02,0xf0,0x02,0xcc,0x00,0x00,0x00,0x0e,0xdc,0xff,
+0xa2,0x00,0xff,0xa8,0xbf,0xe1,0x03,0x30,0x00,0x8f,0x99,0x02,0x10,0xfd,0x16,0x03,
+0xf0,0x3f,0xe5,0xb1,0x00,0x00,0xed,0x3f,0x80,0x00,0x5f,0x80,0xaf,0xa6,0x8f,0xe1,
+0x00,0x7d,0xfe,0xa1,0x00,0x00,0x05,0xbe,0xd0,0x00,0x0b,0xfc,0x96,0x00,0x09,0xf5,
+0x00,0x00,0x02,0xf7,0x01,0x00,0x00,0x7f,0x7d,0xff,0xc2,0x0a,0xff,0x95,0x8f,0xe0,
+0xbf,0x50,0x00,0x7f,0x7c,0xf0,0x00,0x01,0xfb,0xbf,0x00,0x00,0x0f,0xb9,0xf3,0x00,
+0x01,0xfa,0x3f,0xb0,0x00,0x8f,0x50,0x9f,0xb6,0xaf,0xc0,0x00,0x7d,0xfe,0x90,0x00,
+0x0a,0x02,0x64,0xfd,0x16,0x66,0x66,0x67,0xf9,0x36,0x01,0x10,0x0e,0x36,0x01,0x10,
+0x7f,0x10,0x02,0x20,0xeb,0x00,0xc7,0x00,0x00,0x13,0x00,0x10,0xc0,0xe0,0x00,0x20,
+0x50,0x00,0x33,0x03,0x03,0xb2,0x00,0x20,0x0d,0xe0,0xac,0x03,0x12,0x70,0xe3,0x01,
+0xa0,0x02,0xfe,0x86,0xaf,0xc0,0x9f,0x40,0x00,0x9f,0x39,0xb4,0x02,0xf1,0x03,0x2f,
+0xc3,0x25,0xfc,0x00,0x3f,0xff,0xfc,0x00,0x1d,0xe7,0x59,0xf9,0x09,0xf2,0x00,0x08,
+0xf4,0xf5,0x01,0x90,0xd0,0x00,0x02,0xf9,0xbf,0x30,0x00,0x8f,0x52,0x2d,0x00,0x00,
+0x36,0x00,0xf2,0x1d,0x00,0x00,0x3b,0xef,0xc4,0x00,0x03,0xfe,0x87,0xdf,0x40,0x0b,
+0xf2,0x00,0x1e,0xd0,0x0f,0xb0,0x00,0x07,0xf3,0x0f,0xa0,0x00,0x05,0xf5,0x0e,0xe0,
+0x00,0x07,0xf6,0x07,0xfb,0x32,0x8f,0xf6,0x00,0x8f,0xff,0xc7,0xf4,0x00,0x01,0x32,
+0x9a,0x00,0xf4,0x05,0xd0,0x00,0x00,0x00,0x9f,0x50,0x00,0x16,0x8d,0xf9,0x00,0x00,
+0x2f,0xea,0x40,0x00,0x8f,0x38,0xe3,0x00,0x01,0x00,0x87,0x8e,0x38,0xf3,0x0b,0xd0,
+0x0b,0xd0,0x00,0x01,0x00,0x90,0x0b,0xf0,0x0b,0xe0,0x0e,0xb0,0x5f,0x40,0x15,0x0d,
+0x00,0xf1,0x12,0x2a,0x30,0x00,0x04,0xbf,0xf3,0x00,0x5c,0xfe,0x82,0x03,0xef,0xb5,
+0x00,0x00,0x4f,0xe6,0x10,0x00,0x00,0x29,0xff,0xa3,0x00,0x00,0x01,0x8e,0xfd,0x20,
+0x00,0x00,0x07,0xe4,0x33,0x00,0xda,0x12,0x22,0x22,0x22,0x09,0xff,0xff,0xff,0xf2,
+0x35,0x55,0x55,0x55,0x12,0x00,0x10,0x25,0x12,0x00,0x10,0x97,0x0c,0x02,0xd0,0xff,
+0x92,0x00,0x00,0x03,0x9f,0xfb,0x40,0x00,0x00,0x06,0xcf,0xd1,0x46,0x00,0xb5,0x20,
+0x06,0xcf,0xe8,0x10,0x7f,0xfc,0x60,0x00,0x0b,0xa3,0x7d,0x00,0xe2,0x8d,0xfd,0x80,
+0x00,0xbf,0xb8,0xbf,0xa0,0x3f,0x90,0x00,0xbf,0x10,0x31,0x5b,0x01,0x10,0xde,0xc0,
+0x00,0xa1,0x60,0x00,0x00,0x9f,0x80,0x00,0x00,0x5f,0x90,0x00,0x6a,0x02,0x24,0x00,
+0x34,0x32,0x00,0x10,0x7d,0x18,0x05,0x20,0xe2,0x00,0x37,0x03,0x30,0x9d,0xff,0xd9,
+0x81,0x01,0x40,0x07,0xfb,0x63,0x35,0x2c,0x00,0x10,0x09,0x9d,0x00,0x70,0x2d,0x90,
+0x00,0x05,0xf3,0x00,0x00,0x7b,0x05,0xf3,0x40,0x00,0xe8,0x00,0x06,0xde,0xb3,0x00,
+0x99,0x00,0x4f,0x10,0x08,0xf6,0x3c,0xc0,0x04,0xe0,0x09,0xc0,0x02,0xf6,0x00,0xba,
+0x00,0x2f,0x00,0xc9,0x00,0x8e,0x00,0x0c,0x90,0x01,0xf1,0x0e,0x70,0x0c,0xb0,0x00,
+0xe7,0x00,0x1f,0x10,0xd7,0x00,0xd9,0x00,0x0f,0x60,0x03,0xe0,0x0c,0x80,0x0d,0xa0,
+0x03,0xf5,0x00,0x9a,0x00,0xab,0x00,0x8f,0x43,0xce,0xb2,0x6f,0x20,0x05,0xf1,0x01,
+0xbf,0xc3,0x3d,0xfc,0x40,0x00,0x0e,0x90,0x80,0x00,0x24,0x4f,0x70,0x09,0x00,0x40,
+0xc6,0x32,0x47,0x60,0x09,0x00,0x41,0x18,0xcf,0xfd,0xb4,0x12,0x00,0x21,0x0c,0xf2,
+0x97,0x00,0x11,0xff,0x2b,0x00,0x30,0x9f,0xae,0x00,0x8d,0x01,0x20,0x93,0xf5,0x0c,
+0x02,0x20,0xf3,0x0d,0x1c,0x02,0xf1,0x03,0xcd,0x00,0x6f,0x20,0x00,0x00,0x2f,0x70,
+0x01,0xf8,0x00,0x00,0x08,0xf3,0x22,0x2b,0xe0,0x00,0x32,0x06,0xa0,0x50,0x00,0x5f,
+0x75,0x55,0x55,0xec,0x00,0x0b,0xe0,0x5c,0x02,0x10,0x02,0x63,0x02,0x41,0x3f,0x80,
+0x8f,0x40,0x0a,0x01,0xf0,0x04,0x7f,0xff,0xff,0xd8,0x00,0x7f,0xa7,0x77,0xcf,0xc0,
+0x7f,0x50,0x00,0x0b,0xf3,0x7f,0x50,0x00,0x07,0x02,0x04,0xf0,0x38,0x09,0xf3,0x7f,
+0x61,0x12,0x7f,0xb0,0x7f,0xff,0xff,0xfd,0x10,0x7f,0x84,0x44,0x7e,0xd1,0x7f,0x50,
+0x00,0x04,0xf9,0x7f,0x50,0x00,0x01,0xfb,0x7f,0x50,0x00,0x06,0xf9,0x7f,0x96,0x67,
+0xaf,0xe2,0x7f,0xff,0xff,0xd9,0x10,0x00,0x29,0xef,0xea,0x30,0x00,0x4f,0xf9,0x79,
+0xef,0x50,0x1e,0xe1,0x00,0x01,0xee,0x07,0xf6,0x00,0x00,0x08,0xf5,0xbf,0x10,0x00,
+0x00,0x14,0x2d,0xf0,0xa2,0x00,0x24,0xee,0x00,0xa8,0x02,0x71,0x00,0xcf,0x00,0x00,
+0x00,0x13,0x18,0x21,0x00,0x10,0x1f,0x2c,0x00,0x80,0x00,0x5f,0xe9,0x79,0xef,0x50,
+0x00,0x3a,0x42,0x00,0xb0,0x7f,0xff,0xfd,0xa3,0x00,0x07,0xfa,0x77,0x9e,0xf7,0x00,
+0x8a,0x00,0x30,0xf4,0x07,0xf5,0x6a,0x02,0xb0,0x7f,0x50,0x00,0x00,0x9f,0x27,0xf5,
+0x00,0x00,0x07,0xf4,0x0b,0x00,0x25,0x6f,0x57,0x0b,0x00,0x10,0xaf,0x16,0x00,0x20,
+0x1f,0xd0,0x2c,0x00,0x62,0xf5,0x07,0xf9,0x66,0x9e,0xf7,0x42,0x00,0x00,0xd1,0x00,
+0x80,0xff,0xf1,0x7f,0xa7,0x77,0x77,0x70,0x7f,0x2a,0x03,0x07,0x05,0x00,0x31,0x61,
+0x11,0x11,0x1e,0x00,0x6c,0x30,0x7f,0x84,0x44,0x44,0x00,0x1e,0x00,0x50,0x96,0x66,
+0x66,0x61,0x7f,0x61,0x02,0x10,0x7f,0x7f,0x07,0x40,0xfa,0x77,0x77,0x76,0x18,0x00,
+0x23,0x07,0xf5,0x21,0x00,0x50,0x07,0xf6,0x11,0x11,0x10,0x1b,0x00,0x5a,0x07,0xf8,
+0x44,0x44,0x40,0x1b,0x00,0x14,0xf5,0x45,0x00,0xf0,0x09,0x00,0x3a,0xef,0xeb,0x40,
+0x00,0x5f,0xe9,0x78,0xef,0x70,0x1f,0xe1,0x00,0x00,0xcf,0x28,0xf5,0x00,0x00,0x03,
+0x94,0xbf,0x10,0x01,0x01,0xf0,0x01,0xf0,0x00,0x01,0x11,0x10,0xee,0x00,0x05,0xff,
+0xff,0x8d,0xf0,0x00,0x14,0x47,0xf8,0x16,0x00,0xf1,0x08,0x3f,0x86,0xf7,0x00,0x00,
+0x03,0xf8,0x0e,0xf3,0x00,0x00,0x5f,0x80,0x3e,0xfa,0x77,0xaf,0xe2,0x00,0x18,0xdf,
+0xfd,0x81,0x4d,0x00,0x20,0x0d,0xf7,0x57,0x00,0x1d,0xdf,0x0b,0x00,0x61,0xf6,0x11,
+0x11,0x11,0xdf,0x7f,0x24,0x08,0x5f,0xf8,0x44,0x44,0x44,0xef,0x2c,0x00,0x08,0x4c,
+0xf0,0x4f,0x74,0xf7,0x03,0x00,0x10,0x70,0x47,0x02,0x1f,0xf0,0x05,0x00,0x15,0xf0,
+0x04,0x5c,0x30,0x00,0x0d,0xf0,0x5f,0x90,0x00,0x3f,0xc0,0x0c,0xfb,0x79,0xff,0x30,
+0x00,0x8d,0xff,0xb3,0x9d,0x00,0xf0,0x07,0x02,0xee,0x27,0xf5,0x00,0x02,0xee,0x20,
+0x7f,0x50,0x01,0xdf,0x30,0x07,0xf5,0x01,0xdf,0x40,0x00,0x7f,0x50,0xcf,0x3b,0x02,
+0xf0,0x04,0xcf,0x70,0x00,0x00,0x7f,0xef,0xfc,0x00,0x00,0x07,0xff,0x78,0xf9,0x00,
+0x00,0x7f,0x80,0x0c,0xf5,0x20,0x01,0x20,0x1e,0xf3,0x37,0x00,0x20,0x3f,0xd1,0x2b,
+0x01,0x21,0x6f,0xb0,0xd5,0x01,0x1e,0x80,0x44,0x01,0x0f,0x09,0x00,0x0d,0x00,0x2d,
+0x06,0x00,0xfa,0x00,0x30,0xc0,0x7f,0xf1,0x26,0x05,0x30,0xff,0x07,0xff,0xce,0x00,
+0x40,0xef,0xf0,0x7f,0xfe,0xbb,0x05,0xf0,0x25,0xff,0x07,0xf9,0xf5,0x00,0x00,0x0c,
+0xea,0xf0,0x7f,0x4f,0xb0,0x00,0x02,0xf8,0xaf,0x07,0xf4,0x9f,0x20,0x00,0x9f,0x2b,
+0xf0,0x7f,0x42,0xf9,0x00,0x0f,0xb0,0xbf,0x07,0xf5,0x0b,0xf0,0x06,0xf4,0x0c,0xf0,
+0x7f,0x50,0x4f,0x60,0xdd,0x00,0xcf,0x07,0xf5,0x00,0xdd,0x4f,0x60,0x0f,0x00,0x31,
+0x07,0xfd,0xf0,0x0f,0x00,0x30,0x1f,0xf9,0x00,0x0f,0x00,0x80,0x00,0x9f,0x20,0x00,
+0xcf,0x00,0x7f,0xb0,0x4b,0x01,0x20,0xff,0x50,0x4b,0x01,0x70,0xff,0x10,0x00,0x0d,
+0xf7,0xfa,0xfb,0x0b,0x00,0x20,0x59,0xf6,0x61,0x01,0x20,0x0e,0xf2,0x61,0x01,0x20,
+0x4f,0xc0,0x6c,0x01,0x20,0x9f,0x60,0x6c,0x01,0x70,0xdf,0x2d,0xf7,0xf5,0x00,0x03,
+0xfc,0x0b,0x00,0x20,0x08,0xff,0x82,0x01,0x20,0x0d,0xff,0xb2,0x00,0xf0,0x09,0x3f,
+0xf0,0x00,0x29,0xdf,0xe9,0x20,0x00,0x3f,0xfa,0x8a,0xff,0x40,0x1e,0xe2,0x00,0x02,
+0xee,0x17,0xf6,0x00,0x00,0x05,0xf7,0xfc,0x01,0x30,0x0f,0xcd,0xe0,0x81,0x03,0x10,
+0xed,0x1c,0x02,0x20,0xfd,0xe0,0x28,0x03,0x01,0x16,0x00,0x20,0xc7,0xf7,0x21,0x00,
+0xf0,0x01,0x1e,0xe2,0x00,0x01,0xdf,0x10,0x3f,0xfa,0x89,0xff,0x50,0x00,0x29,0xdf,
+0xea,0x20,0xb8,0x02,0x80,0xeb,0x30,0x07,0xfa,0x77,0x79,0xff,0x50,0x80,0x01,0x10,
+0xfe,0x15,0x01,0x20,0x09,0xf3,0x64,0x00,0x20,0x8f,0x47,0x6f,0x00,0x80,0xf1,0x7f,
+0x61,0x11,0x3b,0xfa,0x07,0xff,0x7e,0x08,0x42,0x7f,0x84,0x44,0x30,0x36,0x01,0x02,
+0x96,0x02,0x06,0x0b,0x00,0x00,0x80,0x05,0x50,0xef,0xd9,0x20,0x00,0x4f,0x90,0x00,
+0x10,0x1f,0x90,0x00,0x60,0x18,0xf5,0x00,0x00,0x06,0xf6,0x98,0x03,0x20,0x1f,0xbe,
+0xb5,0x05,0x20,0xed,0xfc,0x54,0x04,0x20,0xee,0xd0,0xe6,0x06,0x10,0xdf,0x16,0x00,
+0x20,0xb8,0xf6,0xfc,0x02,0xf1,0x01,0x1f,0xe1,0x00,0x02,0xee,0x10,0x4f,0xf9,0x8a,
+0xfe,0x30,0x00,0x2a,0xef,0xef,0xd2,0x2c,0x07,0x01,0x32,0x07,0x12,0x2c,0x57,0x00,
+0x01,0x0b,0x04,0x61,0x07,0xfa,0x77,0x7b,0xfe,0x20,0x20,0x04,0x10,0x07,0x9d,0x03,
+0x00,0xe9,0x01,0xf0,0x04,0x03,0xf9,0x07,0xf6,0x11,0x26,0xef,0x20,0x7f,0xff,0xff,
+0xfc,0x30,0x07,0xf8,0x44,0x8f,0x70,0x00,0x30,0x01,0x60,0x10,0x07,0xf5,0x00,0x05,
+0xf8,0x0b,0x00,0x40,0x0d,0xf1,0x07,0xf5,0x87,0x05,0x00,0xa0,0x00,0xd0,0xcf,0x10,
+0x00,0x18,0xdf,0xeb,0x40,0x00,0x2e,0xfa,0x78,0xdf,0x80,0x25,0x08,0x90,0xbf,0x30,
+0xcf,0x00,0x00,0x04,0xe6,0x09,0xf7,0x64,0x00,0x30,0x1d,0xfc,0x61,0x0a,0x07,0x20,
+0xdf,0xfc,0x73,0x00,0x40,0x27,0xdf,0xa0,0x00,0x45,0x08,0x80,0x52,0xe8,0x00,0x00,
+0x04,0xf8,0x0e,0xe2,0xd2,0x05,0xc0,0x4f,0xfa,0x78,0xbf,0xd0,0x00,0x19,0xdf,0xec,
+0x70,0x00,0x8f,0x21,0x03,0x90,0xe3,0x77,0x78,0xfc,0x77,0x76,0x00,0x00,0x3f,0x30,
+0x05,0x10,0x03,0xf7,0x04,0x0f,0x0b,0x00,0x1e,0x00,0x94,0x01,0x7f,0xbf,0x1b,0xf1,
+0x00,0x00,0x0b,0xf1,0x0b,0x00,0x13,0x30,0x19,0xf3,0x00,0x33,0x03,0xf0,0x09,0xa0,
+0x00,0x05,0xfb,0x00,0xbf,0xc8,0x7a,0xfe,0x20,0x00,0x6c,0xff,0xd8,0x00,0x00,0x8f,
+0x60,0x00,0x00,0x04,0xfa,0x2f,0xb0,0xfc,0x08,0xe1,0x0c,0xf1,0x00,0x00,0x0f,0xd0,
+0x06,0xf6,0x00,0x00,0x5f,0x70,0x00,0xfc,0x64,0x00,0x90,0x9f,0x20,0x01,0xfb,0x00,
+0x00,0x3f,0x70,0x06,0xcc,0x01,0xd1,0xd0,0x0c,0xe0,0x00,0x00,0x07,0xf3,0x1f,0x90,
+0x00,0x00,0x01,0xf8,0x02,0x08,0x26,0xbe,0xdc,0x71,0x01,0x21,0x0e,0xf1,0x38,0x00,
+0xf0,0x04,0x05,0xf7,0x00,0x00,0x7f,0x51,0xfb,0x00,0x00,0xaf,0xb0,0x00,0x0b,0xf1,
+0x0d,0xe0,0x00,0x0e,0xff,0x44,0x0b,0xf0,0x2a,0x8f,0x20,0x03,0xf9,0xf4,0x00,0x2f,
+0x90,0x04,0xf6,0x00,0x8f,0x1e,0x90,0x06,0xf5,0x00,0x1f,0xa0,0x0d,0xb0,0xae,0x00,
+0xaf,0x10,0x00,0xce,0x01,0xf6,0x05,0xf2,0x0e,0xc0,0x00,0x08,0xf2,0x6f,0x20,0x1f,
+0x71,0xf8,0x00,0x00,0x4f,0x6b,0xd0,0x00,0xcb,0x5f,0x40,0x00,0x01,0xf9,0xf8,0x00,
+0x07,0xf9,0x5c,0x0a,0x50,0xef,0x30,0x00,0x3f,0xec,0x81,0x0a,0x00,0x38,0x06,0xb0,
+0x80,0x00,0x00,0x04,0xf9,0x00,0x00,0x09,0xf4,0x00,0x00,0xcc,0x04,0xd0,0x2f,0xe1,
+0x06,0xfa,0x00,0x00,0xbf,0x50,0x00,0xbf,0x50,0x06,0xfa,0x13,0x00,0x80,0x1e,0xe1,
+0x00,0x00,0x06,0xf9,0xaf,0x50,0xd3,0x09,0x11,0xfa,0xaf,0x06,0x11,0xf3,0xe3,0x05,
+0x10,0xfb,0x72,0x02,0xf0,0x15,0xf9,0xaf,0x60,0x00,0x00,0x2f,0xe0,0x1e,0xf1,0x00,
+0x00,0xcf,0x40,0x05,0xfb,0x00,0x07,0xf9,0x00,0x00,0xaf,0x60,0x2f,0xe1,0x00,0x00,
+0x1e,0xf1,0x9f,0x70,0x00,0x00,0x1f,0xe0,0x1e,0xe0,0xb2,0x01,0xf1,0x02,0x06,0xf8,
+0x00,0x02,0xfc,0x00,0x00,0xdf,0x10,0x0a,0xf3,0x00,0x00,0x4f,0x80,0x2f,0xa0,0x48,
+0x01,0x61,0x20,0x00,0x00,0x02,0xfc,0xf8,0xe4,0x06,0x15,0xe0,0x94,0x01,0x0f,0x06,
+0x00,0x04,0x20,0x1f,0xff,0xe1,0x06,0x40,0x77,0x77,0x77,0x7f,0x1c,0x07,0x01,0x29,
+0x02,0x20,0x04,0xfb,0x99,0x0c,0x23,0xee,0x10,0x6d,0x0a,0x30,0x00,0x7f,0x90,0x2c,
+0x00,0x10,0xd0,0x69,0x03,0x01,0x24,0x00,0x10,0xf6,0x31,0x07,0x10,0xfa,0x24,0x00,
+0x60,0xef,0x76,0x66,0x66,0x64,0x3f,0x42,0x00,0x9f,0xa0,0x01,0x11,0xaf,0xfd,0xaf,
+0x53,0xaf,0x10,0x02,0x00,0x08,0x90,0x21,0xaf,0xfd,0x24,0x43,0x6f,0x30,0x00,0x00,
+0x9a,0x01,0x50,0x0a,0xe0,0x00,0x00,0x04,0x59,0x03,0x10,0xdb,0x62,0x00,0x20,0x20,
+0x00,0x6e,0x0c,0x01,0x61,0x07,0x23,0x05,0xf4,0xb3,0x09,0x20,0x8f,0x10,0x8b,0x07,
+0x10,0x00,0x47,0x0c,0x02,0xbf,0x09,0x8f,0x74,0x11,0x10,0xef,0xf9,0x45,0xf9,0x02,
+0x02,0x00,0x08,0x90,0x13,0xf9,0xef,0xf9,0x44,0x42,0x00,0x05,0x50,0x23,0x01,0xf0,
+0x0e,0x00,0x00,0x7f,0xf6,0x00,0x00,0xe9,0xbd,0x00,0x05,0xf3,0x4f,0x30,0x0c,0xc0,
+0x0e,0xa0,0x3f,0x60,0x07,0xf1,0x11,0x11,0x11,0x11,0x0f,0xff,0xff,0xff,0xfc,0x05,
+0xf1,0x07,0x44,0x20,0x17,0x60,0x00,0x8f,0x40,0x00,0x8e,0x10,0x03,0xbe,0xfd,0x60,
+0x03,0xfd,0x76,0xcf,0x60,0x9d,0x10,0x00,0x41,0x0d,0xf1,0x0e,0xe0,0x04,0xbe,0xff,
+0xff,0x07,0xfb,0x53,0x3c,0xf0,0xed,0x00,0x00,0xcf,0x0e,0xd0,0x00,0x2e,0xf0,0x8f,
+0xc8,0x9f,0xff,0x00,0x7d,0xfd,0x58,0xd2,0xbf,0x94,0x09,0x00,0x1e,0x01,0x05,0x09,
+0x00,0xf0,0x02,0x3c,0xfe,0xa1,0x0b,0xff,0x97,0xbf,0xd0,0xbf,0x40,0x00,0x9f,0x6b,
+0xf0,0x00,0x01,0xfa,0xa7,0x0a,0xf0,0x1c,0xcb,0xf0,0x00,0x00,0xfc,0xbf,0x00,0x00,
+0x2f,0xab,0xf5,0x00,0x09,0xf5,0xbf,0xf9,0x7b,0xfc,0x0b,0xe3,0xcf,0xea,0x10,0x00,
+0x19,0xef,0xc6,0x00,0x01,0xef,0x86,0xbf,0x90,0x0a,0xf3,0x00,0x0a,0xf1,0x0f,0xc0,
+0x00,0x02,0x72,0x12,0x01,0x01,0x17,0x01,0x00,0x20,0x0d,0x30,0x01,0x31,0x0a,0x2e,
+0x0d,0x91,0x02,0xef,0x86,0xaf,0x80,0x00,0x2a,0xef,0xd6,0x19,0x0e,0x1c,0xf5,0x05,
+0x00,0xf4,0x06,0x3b,0xfe,0xa7,0xf5,0x02,0xff,0x97,0xbf,0xf5,0x0a,0xf4,0x00,0x09,
+0xf5,0x0f,0xd0,0x00,0x05,0xf5,0x1f,0xa0,0x05,0x00,0xf0,0x19,0x0f,0xc0,0x00,0x05,
+0xf5,0x0a,0xf2,0x00,0x08,0xf5,0x02,0xfe,0x64,0x9f,0xf5,0x00,0x2b,0xff,0xb6,0xf5,
+0x00,0x19,0xef,0xd6,0x00,0x01,0xdf,0x86,0xbf,0x70,0x09,0xf3,0x00,0x0b,0xf0,0x0e,
+0xc1,0x11,0x17,0xf4,0xfe,0x01,0x80,0xf5,0x1f,0xb4,0x44,0x44,0x41,0x0f,0xc0,0x13,
+0x0a,0xe0,0xf5,0x00,0x02,0x70,0x01,0xef,0x96,0x8f,0xd0,0x00,0x19,0xef,0xe9,0x10,
+0x9f,0x0e,0x70,0x00,0x9f,0xf9,0x00,0x7f,0xa5,0x30,0xd0,0x06,0x10,0xdd,0xdc,0x0b,
+0x71,0xf0,0x24,0xee,0x44,0x00,0x0d,0xd0,0x43,0x0b,0x0f,0x07,0x00,0x02,0x50,0x00,
+0x3b,0xfe,0xa5,0xf6,0x99,0x00,0x10,0xf6,0x99,0x00,0x10,0xf6,0x99,0x00,0x34,0xf6,
+0x1f,0xa0,0x05,0x00,0x01,0x0f,0x00,0x01,0x19,0x00,0x01,0x23,0x00,0x01,0xc6,0x00,
+0x10,0x00,0x93,0x08,0xf0,0x00,0x01,0x80,0x00,0x0d,0xf1,0x05,0xfc,0x77,0xcf,0x80,
+0x00,0x3b,0xef,0xc6,0x00,0x96,0xbf,0x00,0x00,0x00,0x0b,0xf0,0x00,0x00,0x00,0x09,
+0x00,0xfe,0x0b,0x2b,0xfe,0xa1,0x0b,0xfe,0xa7,0xaf,0xb0,0xbf,0x60,0x00,0xbf,0x0b,
+0xf0,0x00,0x08,0xf2,0xbf,0x00,0x00,0x8f,0x3b,0xf0,0x00,0x08,0xf3,0x09,0x00,0x87,
+0x7f,0x26,0xe2,0x00,0x08,0xf2,0x8f,0x28,0x03,0x00,0xef,0x20,0x00,0x9e,0x10,0x08,
+0xd1,0x00,0x00,0x00,0x0a,0xf1,0x00,0xaf,0x10,0x05,0x00,0x05,0x57,0x04,0x8f,0xd0,
+0x8f,0xc3,0x75,0x00,0x06,0x09,0x00,0xf9,0x1c,0x06,0xfa,0x0b,0xf0,0x05,0xfb,0x00,
+0xbf,0x05,0xfc,0x00,0x0b,0xf4,0xfd,0x10,0x00,0xbf,0xef,0x80,0x00,0x0b,0xfd,0xcf,
+0x40,0x00,0xbf,0x22,0xee,0x10,0x0b,0xf0,0x04,0xfb,0x00,0xbf,0x00,0x08,0xf7,0x0b,
+0xf0,0x00,0x0c,0xf3,0x78,0x00,0x04,0x03,0x00,0xf0,0x0f,0xbe,0x3b,0xff,0xa1,0x2b,
+0xfe,0xb2,0x0b,0xfe,0x87,0xbf,0xcf,0xa7,0x9f,0xd0,0xbf,0x30,0x00,0xcf,0x80,0x00,
+0x9f,0x3b,0xf0,0x00,0x09,0xf3,0x00,0x06,0xf5,0xba,0x00,0x40,0x30,0x00,0x5f,0x5b,
+0xbd,0x00,0x2f,0x00,0x05,0x0f,0x00,0x0d,0x0f,0x0b,0x01,0x19,0xf1,0x0f,0x00,0x19,
+0xef,0xd8,0x00,0x01,0xdf,0x96,0xaf,0xc0,0x09,0xf4,0x00,0x07,0xf7,0x0f,0xc0,0x00,
+0x00,0xfc,0x1f,0xa0,0x00,0x00,0xcf,0x1f,0x90,0x00,0x00,0xdf,0x0f,0x00,0x10,0x0a,
+0x19,0x00,0xfe,0x28,0x01,0xef,0x96,0xaf,0xc0,0x00,0x19,0xef,0xd7,0x00,0xbe,0x5c,
+0xfe,0x91,0x0b,0xfe,0x64,0x9f,0xc0,0xbf,0x20,0x00,0x8f,0x5b,0xf0,0x00,0x02,0xfa,
+0xbf,0x00,0x00,0x0f,0xcb,0xf0,0x00,0x00,0xfc,0xbf,0x00,0x00,0x2f,0xab,0xf3,0x00,
+0x0a,0xf5,0xbf,0xe8,0x6b,0xfc,0x0b,0xf4,0xcf,0xea,0x10,0x2b,0x01,0xf4,0x07,0x00,
+0x3b,0xfe,0xa6,0xf5,0x02,0xff,0x86,0xaf,0xf5,0x0b,0xf4,0x00,0x08,0xf5,0x0f,0xd0,
+0x00,0x06,0xf5,0x1f,0xa0,0x05,0x00,0x60,0x0f,0xc0,0x00,0x06,0xf5,0x0a,0x19,0x00,
+0x01,0x23,0x00,0xae,0x00,0x3b,0xff,0xa7,0xf5,0x00,0x00,0x00,0x06,0xf5,0x05,0x00,
+0x80,0xbf,0x5d,0xf2,0xbf,0xf9,0x71,0xbf,0x40,0x5b,0x00,0x0e,0x03,0x00,0xf0,0x23,
+0x00,0x4c,0xfe,0xb4,0x00,0x5f,0xc6,0x7e,0xf4,0x0b,0xf0,0x00,0x2f,0xb0,0xaf,0x50,
+0x00,0x00,0x01,0xcf,0xea,0x50,0x00,0x00,0x38,0xcf,0xe3,0x02,0x10,0x00,0x3f,0xb0,
+0xfc,0x00,0x00,0xec,0x07,0xfc,0x66,0xcf,0x60,0x05,0xcf,0xfc,0x50,0x00,0x85,0x00,
+0x01,0xfa,0x03,0x00,0x62,0xef,0xff,0xf8,0x45,0xfb,0x42,0x0c,0x00,0x08,0x03,0x00,
+0x60,0x00,0xef,0x74,0x00,0x4d,0xf7,0x35,0x01,0x14,0x2b,0x50,0x01,0x0e,0x09,0x00,
+0xf0,0x6e,0x29,0xf3,0x00,0x0c,0xf2,0x3f,0xe7,0x8d,0xff,0x20,0x5d,0xfe,0x98,0xf2,
+0x8f,0x30,0x00,0x1f,0xa2,0xf9,0x00,0x06,0xf4,0x0c,0xe0,0x00,0xbe,0x00,0x6f,0x30,
+0x1f,0x90,0x01,0xf9,0x06,0xf3,0x00,0x0b,0xe0,0xbd,0x00,0x00,0x5f,0x5f,0x80,0x00,
+0x00,0xfe,0xf2,0x00,0x00,0x09,0xfc,0x00,0x00,0x00,0x3f,0x60,0x00,0x7f,0x30,0x00,
 0xbe,0x00,0x00,0xfa,0x2f,0x80,0x01,0xff,0x40,0x04,0xf6,0x0d,0xc0,0x05,0xfe,0x90,
 0x08,0xf1,0x09,0xf0,0x0a,0xb9,0xe0,0x0c,0xc0,0x04,0xf4,0x0f,0x64,0xf3,0x0f,0x80,
 0x00,0xf8,0x4f,0x10,0xe8,0x4f,0x30,0x00,0xbd,0x9c,0x00,0x9d,0x8e,0x00,0x00,0x6f,
-0xf7,0x00,0x4f,0xea,0x00,0x00,0x1f,0xf2,0x00,0x0f,0xd5,0x06,0x00,0xb8,0x02,0xf0,
-0x06,0x3f,0xc0,0x00,0x6f,0x80,0x8f,0x60,0x1f,0xd0,0x00,0xde,0x1a,0xf3,0x00,0x03,
-0xfc,0xf9,0x00,0x00,0x08,0xfd,0xe7,0x05,0xf0,0x27,0xe1,0x00,0x00,0x4f,0xaf,0xa0,
-0x00,0x0e,0xe0,0x8f,0x50,0x09,0xf4,0x00,0xee,0x14,0xfa,0x00,0x04,0xfa,0x9f,0x30,
-0x00,0x3f,0x94,0xf9,0x00,0x08,0xf3,0x0e,0xe0,0x00,0xde,0x00,0x8f,0x40,0x3f,0x80,
-0x02,0xf9,0x08,0xf2,0x00,0x0c,0xe0,0xdd,0x00,0x00,0x7f,0x6f,0x70,0x00,0x01,0xff,
-0xfd,0x10,0x12,0xfc,0xb6,0x0f,0x32,0x00,0x07,0xf1,0x8c,0x05,0x72,0x18,0xcf,0x30,
-0x00,0x03,0xfd,0x50,0x19,0x06,0xd3,0x80,0x66,0x66,0x6e,0xf4,0x00,0x00,0x07,0xf8,
-0x00,0x00,0x03,0xfb,0x14,0x06,0x20,0xbf,0x40,0x97,0x0a,0xb0,0x00,0x00,0x3f,0xb0,
-0x00,0x00,0x1e,0xf7,0x66,0x66,0x43,0x53,0x13,0xd1,0x00,0x00,0x02,0x00,0x00,0x1b,
-0xf1,0x00,0x0c,0xe2,0x00,0x03,0xf8,0x64,0x0f,0x60,0x07,0xf4,0x00,0x00,0x7f,0x40,
-0x30,0x0e,0x92,0x04,0xed,0x00,0x06,0xff,0x20,0x00,0x17,0xfb,0x29,0x0e,0x20,0x7f,
-0x40,0x1c,0x00,0x00,0x5a,0x12,0x22,0x04,0xf7,0x35,0x04,0x7a,0x2e,0xd1,0x00,0x00,
-0x05,0x00,0x6f,0x01,0x00,0x60,0x38,0x10,0x00,0x00,0xae,0x40,0xb1,0x10,0x30,0x01,
-0xf9,0x00,0x94,0x05,0x10,0xed,0x5e,0x04,0x00,0x02,0x0d,0xa1,0x6f,0x81,0x00,0x09,
-0xfd,0x00,0x4f,0xb4,0x00,0xbf,0x12,0x00,0x11,0xed,0x1e,0x00,0xa1,0xfa,0x00,0x08,
-0xf4,0x00,0x8f,0x70,0x00,0x31,0x00,0xb5,0x04,0xf1,0x01,0x01,0x10,0x8f,0xfd,0x50,
-0x00,0xc9,0x6f,0x86,0xdf,0x93,0x7f,0x5b,0xc0,0x00,0x9f,0xf2,0x0d,0x28,0x14,0x20,
-0x56,0x0f,0x01,0x86,0x00,0x11,0x00,0x25,0x07,0x13,0xf4,0x86,0x12,0xc1,0xfe,0xf3,
-0x00,0x00,0x18,0x88,0x88,0x88,0xcf,0x2e,0xf3,0x00,0xde,0x10,0x31,0xd0,0x2e,0xf3,
-0x04,0x12,0x40,0x00,0x00,0x2e,0xf3,0x21,0x01,0x00,0x09,0x00,0x12,0xe1,0x11,0x00,
-0x41,0x01,0xef,0x27,0xf1,0x08,0x00,0x30,0xdf,0x40,0x7f,0x02,0x01,0xb2,0x01,0xdf,
-0x40,0x02,0x9a,0xaa,0xaa,0xad,0xf1,0xdf,0x40,0x55,0x00,0x03,0x08,0x00,0x32,0x09,
-0xff,0x50,0x5e,0x00,0x23,0x8f,0x50,0x6f,0x00,0x29,0x10,0x00,0x01,0x00,0x23,0x04,
-0xf6,0x08,0x00,0x22,0xff,0x80,0x08,0x00,0x21,0xfe,0xf8,0x08,0x00,0xc0,0x03,0xfd,
-0x3f,0xc8,0x88,0x88,0x87,0x10,0x03,0xfe,0x20,0xef,0xad,0x0c,0x21,0x03,0xfe,0xbf,
-0x00,0x41,0x1f,0x71,0xee,0x20,0x78,0x00,0x41,0xf7,0x2f,0xd1,0x00,0x11,0x00,0x32,
-0x70,0x4f,0xd1,0x11,0x00,0x40,0x00,0x4f,0xd1,0x0d,0xb6,0x00,0xe2,0x70,0x00,0x5f,
-0xd2,0xfd,0xaa,0xaa,0xaa,0x92,0x00,0x00,0x5f,0xdf,0x80,0x5e,0x00,0x12,0x5f,0x55,
-0x00,0x01,0xfb,0x08,0x0a,0x87,0x00,0x31,0x3b,0x30,0x00,0x0c,0x08,0x21,0xff,0x30,
-0x85,0x08,0x30,0xe4,0xef,0x40,0x07,0x00,0x20,0xd2,0x02,0xc0,0x00,0x20,0x4f,0xd1,
-0xe0,0x00,0x00,0x07,0x00,0x00,0x08,0x00,0xf1,0x07,0x4f,0xfa,0x81,0x00,0x02,0x8a,
-0xff,0x47,0xff,0xff,0x80,0x00,0x8f,0xff,0xf7,0x00,0x01,0xf8,0x00,0x08,0xf1,0x00,
-0xba,0x07,0x00,0xac,0x07,0x0f,0x0f,0x00,0x0c,0x50,0xfc,0x99,0x9c,0xf1,0x00,0xd9,
-0x0b,0x21,0xff,0xfd,0xe8,0x08,0x30,0xff,0xff,0xc0,0x1e,0x00,0x5f,0xda,0xaa,0xdf,
-0x10,0x00,0x4b,0x00,0x1a,0xf0,0x0b,0x6f,0xff,0xf8,0x00,0x08,0xff,0xff,0x64,0xff,
-0xb9,0x20,0x00,0x29,0xbf,0xf4,0x05,0xfd,0x10,0x00,0x00,0x1d,0xf5,0x00,0x05,0xfd,
-0x10,0x07,0x00,0x00,0x08,0x00,0x20,0x1d,0xf5,0x48,0x01,0x32,0xfd,0x3d,0xf4,0x58,
-0x01,0x12,0xf4,0x58,0x01,0x13,0xc4,0xf1,0x00,0x04,0x88,0x01,0x23,0x3f,0x30,0x5f,
-0x11,0x14,0xfb,0x81,0x01,0x03,0x08,0x02,0x32,0xcf,0xdf,0xc0,0x2b,0x01,0x31,0xe1,
-0xef,0x50,0x7c,0x0f,0x31,0xf6,0x06,0xfd,0x84,0x07,0x31,0xfd,0x00,0x0d,0x0b,0x0c,
-0x50,0xdf,0x50,0x00,0x5f,0xd0,0x4b,0x12,0x12,0xc0,0x34,0x13,0x20,0x0e,0xf4,0xb7,
-0x01,0x00,0xe8,0x10,0x00,0x4f,0x00,0xa1,0xf7,0x00,0x01,0xff,0x63,0x33,0x33,0x33,
-0x6f,0xf1,0x46,0x0b,0x00,0x47,0x03,0x22,0x1f,0xff,0x01,0x00,0x11,0x10,0x7f,0x10,
-0x21,0x89,0x50,0xe0,0x01,0xf0,0x19,0xff,0xff,0xb0,0x00,0x00,0x02,0x40,0xdf,0x30,
-0x9f,0x50,0x00,0x4d,0xff,0x4f,0xa0,0x02,0xf9,0x00,0x7f,0xf9,0x44,0xfe,0x10,0x6f,
-0x70,0x5f,0xd1,0x00,0x7f,0xfe,0xcf,0xe1,0x0e,0xf1,0x00,0x0a,0xff,0xff,0xd2,0xaa,
-0x0a,0xf1,0x0e,0xdf,0xff,0x93,0xf4,0x8f,0x20,0x00,0x0f,0xfe,0x40,0x2f,0x8a,0xf0,
-0x00,0x03,0xfb,0x10,0x00,0xfa,0x8f,0x20,0x00,0x57,0x00,0x00,0x2f,0x85,0xf7,0x00,
-0xa3,0x0c,0x21,0x0e,0xe1,0xb5,0x09,0x30,0x00,0x6f,0xc1,0x09,0x05,0x60,0x60,0x00,
-0x8f,0xe7,0x32,0x37,0x84,0x0a,0x50,0x5e,0xff,0xff,0xfe,0x50,0xde,0x00,0x21,0x78,
-0x74,0xd5,0x00,0x40,0x1a,0xbb,0xbb,0xb7,0x08,0x00,0xf1,0x13,0x40,0x6f,0xff,0xff,
-0x23,0x60,0x00,0x00,0x6f,0x90,0xaf,0xff,0x72,0xef,0x30,0x00,0x13,0xec,0x00,0xcf,
-0xc0,0x1d,0x86,0x30,0x0b,0xf8,0x10,0x02,0xe2,0x00,0x0c,0xfb,0x00,0x9f,0x29,0x02,
-0x41,0x6a,0x20,0x3a,0xa0,0x38,0x00,0x41,0xef,0x56,0xff,0x00,0x3f,0x0b,0x22,0xd5,
-0x04,0x69,0x11,0x41,0xa7,0x12,0xff,0x40,0x47,0x01,0x31,0xf3,0x0b,0x87,0xe9,0x02,
-0x40,0x66,0x00,0x0b,0xf7,0x26,0x01,0xf0,0x02,0xff,0x30,0x00,0xcd,0x8b,0x10,0x00,
-0x0a,0xb6,0xb0,0x00,0x00,0x1d,0xf8,0xe7,0xeb,0xdf,0x7f,0x00,0x51,0x8a,0x8f,0x6f,
-0xe3,0x80,0x66,0x01,0x21,0x92,0x76,0x07,0x00,0x14,0x60,0x75,0x01,0x40,0x99,0xdf,
-0xec,0x70,0x3f,0x01,0xf0,0x02,0xbf,0xfd,0xbb,0xef,0xe5,0x00,0x02,0xfe,0x20,0xbf,
-0xa0,0x00,0x4e,0xf6,0x00,0x5f,0xc0,0x9a,0x0b,0xf0,0x08,0x1d,0xf3,0x00,0x9f,0xc1,
-0x00,0xaf,0x80,0x00,0x1f,0xc0,0x08,0xff,0xd1,0x1e,0xf4,0x00,0x00,0x8f,0x20,0xcd,
-0x6f,0xdd,0x17,0x10,0x41,0xf6,0x0e,0xb0,0x5f,0xab,0x14,0x21,0x80,0xec,0x7c,0x12,
-0x10,0x02,0x7c,0x07,0x01,0xb7,0x01,0x11,0x50,0xe3,0x13,0x00,0x8d,0x06,0x00,0xc4,
-0x0a,0x00,0x27,0x0d,0x41,0x04,0xfc,0x10,0x00,0x21,0x02,0x50,0x06,0xff,0x84,0x23,
-0x5b,0x28,0x13,0x42,0x03,0xcf,0xff,0xff,0x13,0x03,0x22,0x26,0x77,0xa9,0x03,0x62,
-0xbd,0xdd,0xdd,0xdd,0xdd,0x40,0x10,0x0b,0xe0,0xe0,0x00,0x06,0xfe,0x21,0x11,0x13,
-0xf9,0x00,0x00,0xbf,0x80,0x00,0x00,0x79,0x01,0x11,0xf2,0x3e,0x14,0x61,0x04,0xfd,
-0x00,0x00,0x08,0xf6,0x44,0x0c,0x90,0x0a,0xf9,0x00,0x00,0x02,0xcf,0x60,0x1d,0xe4,
-0x50,0x12,0x11,0xec,0x58,0x15,0x50,0xdf,0x4c,0x90,0xff,0x80,0x87,0x0b,0xf0,0x05,
-0xf4,0x6d,0xde,0x00,0x00,0x06,0xf3,0x3f,0x0c,0x59,0xf1,0x00,0x00,0x6f,0x53,0x60,
-0x10,0xaf,0x00,0x00,0xa0,0x0c,0x00,0xbf,0x0c,0x51,0x09,0xfb,0x31,0x5e,0xf3,0x7e,
-0x13,0x21,0xff,0xf5,0x07,0x02,0x31,0x89,0x71,0x00,0x16,0x02,0x40,0x77,0x77,0x60,
-0x00,0x77,0x18,0xf1,0x02,0xfe,0x00,0x00,0x01,0x15,0xff,0xff,0xe2,0x33,0x0e,0xff,
-0xff,0xfe,0xee,0xee,0xf4,0xf2,0xb9,0x12,0x11,0x4f,0xf5,0x03,0xe1,0xc4,0xe2,0x0e,
-0xff,0xff,0xf2,0x0c,0x5e,0x20,0x9a,0xaa,0xaa,0x10,0xc5,0x35,0x14,0x32,0x0c,0x5e,
-0x30,0x0d,0x00,0x02,0x1a,0x00,0x01,0xd4,0x02,0x03,0x1a,0x00,0x30,0x5d,0xee,0xee,
-0xdf,0x09,0x63,0x12,0x26,0xff,0xff,0xe1,0x10,0x5b,0x00,0x43,0x00,0x01,0x55,0x55,
-0x01,0x03,0x30,0x03,0x44,0x10,0x10,0x00,0xf0,0x08,0x9f,0xff,0xff,0xc2,0xa3,0x00,
-0x04,0xef,0xff,0xee,0xff,0x5e,0xf8,0x03,0xff,0xe6,0x00,0x01,0x40,0xe5,0xbe,0xef,
-0xc1,0xeb,0x01,0x21,0x30,0x5e,0x93,0x0c,0x12,0xe3,0x17,0x0c,0x60,0x0e,0x30,0x00,
-0x03,0xcc,0x20,0x0f,0x00,0x31,0x00,0x2d,0xb1,0x0f,0x00,0x21,0x6f,0x70,0x1e,0x00,
-0x20,0xae,0x30,0x1e,0x00,0x40,0x32,0xdf,0xe1,0x00,0x42,0x17,0x30,0xf8,0xef,0xb0,
-0x0f,0x00,0x82,0xe4,0x04,0xff,0xd6,0x00,0x02,0x40,0x91,0x5a,0x00,0x12,0x50,0x69,
-0x00,0x11,0xc1,0x78,0x00,0x50,0x54,0x10,0x00,0x0d,0xee,0x01,0x00,0xa0,0xed,0x01,
-0xf2,0x4f,0xfa,0x22,0x22,0x22,0xe1,0x1f,0x93,0x13,0xf2,0x1a,0x79,0xaf,0x11,0xf0,
-0x03,0x31,0x02,0xcf,0xff,0xf1,0x1f,0x00,0x12,0x04,0xff,0xff,0xff,0x11,0xf0,0x1f,
-0xfa,0x05,0xdf,0xff,0xf1,0x1f,0x02,0xff,0xb0,0x00,0x7a,0x9f,0x11,0xf0,0x09,0xa5,
-0x00,0x00,0x00,0xe1,0x1f,0x88,0x02,0x41,0x11,0xf0,0x1f,0xf9,0x0f,0x00,0x00,0x1e,
-0x00,0x00,0x0f,0x00,0x22,0x1b,0xc7,0x1e,0x00,0x22,0x67,0x40,0x1e,0x00,0x11,0xfb,
-0x0f,0x00,0x12,0x01,0x1e,0x00,0x90,0xfe,0xef,0xff,0xee,0xee,0xee,0xf0,0x01,0x22,
-0x01,0x00,0x10,0x21,0xf8,0x00,0x41,0x58,0x98,0x51,0x00,0x06,0x11,0x02,0x09,0x02,
-0xf0,0x00,0x1d,0xfc,0x7f,0x3e,0x5b,0xfc,0x10,0x00,0x0c,0xf7,0x02,0xf3,0xe0,0x07,
-0xfc,0xf4,0x06,0xf0,0x35,0x2f,0x3e,0x00,0x07,0xf7,0x00,0xed,0x00,0x02,0xf3,0xe0,
-0x00,0x0d,0xe0,0x3f,0x70,0x00,0x2f,0xfd,0x00,0x00,0x6f,0x35,0xf4,0x00,0x00,0x22,
-0x15,0x20,0x03,0xf5,0x6f,0x30,0x07,0xf4,0x04,0xff,0x60,0x2f,0x65,0xf5,0x09,0xe8,
-0xf2,0xdb,0x4e,0xb6,0xf5,0x1f,0xab,0xd3,0xcc,0x03,0xcd,0x39,0xff,0x10,0xbf,0xb3,
-0xea,0x00,0x00,0x7f,0x8f,0xb0,0x02,0xfd,0xf8,0x21,0x03,0x90,0xf2,0x00,0x05,0xfe,
-0x40,0x00,0x00,0x4d,0xf5,0xf7,0x19,0x41,0xd9,0x89,0xdf,0xe4,0x26,0x15,0x38,0xff,
-0xfd,0x70,0x89,0x05,0x33,0x03,0x89,0x60,0x30,0x06,0x10,0xff,0x3c,0x15,0x00,0xf2,
-0x0d,0x11,0x4e,0x06,0x16,0x10,0xeb,0xd2,0x02,0x01,0xe8,0x05,0xf0,0x05,0x00,0x00,
-0xf8,0x1b,0xff,0x80,0x00,0xf8,0x00,0x00,0x1f,0x8c,0xff,0xff,0x90,0x0c,0xe1,0x00,
-0x08,0xf7,0x55,0x04,0xd0,0x4f,0xd6,0x5a,0xfa,0x6f,0xff,0xff,0xf3,0x00,0x4d,0xff,
-0xff,0x64,0x0b,0x18,0x30,0x03,0xef,0xdb,0x33,0x06,0x60,0x60,0x01,0xed,0x20,0x7f,
-0xff,0x67,0x04,0x31,0xaf,0x10,0x6f,0xe7,0x0d,0x40,0x0f,0x80,0x2f,0xff,0xad,0x06,
-0x31,0x02,0xf5,0x0b,0x90,0x04,0x32,0xf1,0x3f,0x75,0x99,0x04,0x13,0x22,0xa1,0x04,
-0x36,0xf2,0x03,0x33,0x25,0x07,0x13,0x60,0x28,0x05,0x13,0x90,0x4f,0x15,0x13,0xa0,
+0xf7,0x00,0x4f,0xea,0x00,0x00,0x1f,0xf2,0x00,0x0f,0xf5,0x00,0x00,0x0d,0xd0,0xb8,
+0x02,0xf0,0x44,0x3f,0xc0,0x00,0x6f,0x80,0x8f,0x60,0x1f,0xd0,0x00,0xde,0x1a,0xf3,
+0x00,0x03,0xfc,0xf9,0x00,0x00,0x08,0xfd,0x00,0x00,0x00,0x9f,0xe1,0x00,0x00,0x4f,
+0xaf,0xa0,0x00,0x0e,0xe0,0x8f,0x50,0x09,0xf4,0x00,0xee,0x14,0xfa,0x00,0x04,0xfa,
+0x9f,0x30,0x00,0x3f,0x94,0xf9,0x00,0x08,0xf3,0x0e,0xe0,0x00,0xde,0x00,0x8f,0x40,
+0x3f,0x80,0x02,0xf9,0x08,0xf2,0x00,0x0c,0xe0,0xdd,0x00,0x00,0x7f,0x6f,0x70,0x00,
+0x01,0xff,0xf2,0x00,0x00,0x0b,0xa0,0x00,0xf1,0x5c,0x5f,0x60,0x00,0x00,0x07,0xf1,
+0x00,0x00,0x00,0xdb,0x00,0x00,0x18,0xcf,0x30,0x00,0x03,0xfd,0x50,0x00,0x00,0x1f,
+0xff,0xff,0xff,0x80,0x66,0x66,0x6e,0xf4,0x00,0x00,0x07,0xf8,0x00,0x00,0x03,0xfb,
+0x00,0x00,0x01,0xee,0x10,0x00,0x00,0xbf,0x40,0x00,0x00,0x7f,0x80,0x00,0x00,0x3f,
+0xb0,0x00,0x00,0x1e,0xf7,0x66,0x66,0x43,0xff,0xff,0xff,0xfc,0x00,0x00,0x02,0x00,
+0x00,0x1b,0xf1,0x00,0x0c,0xe2,0x00,0x03,0xf8,0x00,0x00,0x6f,0x50,0x00,0x07,0xf4,
+0x00,0x00,0x7f,0x40,0x00,0x08,0xf2,0x00,0x04,0xed,0x00,0x06,0xff,0x20,0x00,0x17,
+0xfb,0x00,0x00,0x09,0xf2,0x15,0x00,0x00,0x1c,0x00,0x51,0x6f,0x40,0x00,0x04,0xf7,
+0xd8,0x00,0x8a,0x00,0x2e,0xd1,0x00,0x00,0x05,0x00,0x6f,0x01,0x00,0xf1,0x15,0x38,
+0x10,0x00,0x00,0xae,0x40,0x00,0x0a,0xf2,0x00,0x01,0xf9,0x00,0x00,0xec,0x00,0x00,
+0xed,0x00,0x00,0xdd,0x00,0x00,0xcf,0x00,0x00,0x6f,0x81,0x00,0x09,0xfd,0x00,0x4f,
+0xb4,0x00,0xbf,0x12,0x00,0x11,0xed,0x1e,0x00,0xf8,0x18,0xfa,0x00,0x08,0xf4,0x00,
+0x8f,0x70,0x00,0x31,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x10,0x8f,0xfd,0x50,0x00,
+0xc9,0x6f,0x86,0xdf,0x93,0x7f,0x5b,0xc0,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x14,
+0x20,0x00,0x01,0x00,0x23,0x07,0xf4,0x09,0x00,0x13,0x9f,0x09,0x00,0xf0,0x09,0x09,
+0xfe,0xf3,0x00,0x00,0x18,0x88,0x88,0x88,0xcf,0x2e,0xf3,0x00,0x07,0xff,0xff,0xff,
+0xff,0xd0,0x2e,0xf3,0x00,0x7f,0x10,0x1c,0x00,0x20,0x2e,0xf3,0x21,0x01,0x00,0x09,
+0x00,0x12,0xe1,0x11,0x00,0x41,0x01,0xef,0x27,0xf1,0x08,0x00,0x30,0xdf,0x40,0x7f,
+0x02,0x01,0xb2,0x01,0xdf,0x40,0x02,0x9a,0xaa,0xaa,0xad,0xf1,0xdf,0x40,0x55,0x00,
+0x03,0x08,0x00,0x32,0x09,0xff,0x50,0x5e,0x00,0x23,0x8f,0x50,0x6f,0x00,0x29,0x10,
+0x00,0x01,0x00,0x23,0x04,0xf6,0x08,0x00,0x22,0xff,0x80,0x08,0x00,0x21,0xfe,0xf8,
+0x08,0x00,0xf1,0x03,0x03,0xfd,0x3f,0xc8,0x88,0x88,0x87,0x10,0x03,0xfe,0x20,0xef,
+0xff,0xff,0xff,0xf7,0x03,0xfe,0xbf,0x00,0x41,0x1f,0x71,0xee,0x20,0x78,0x00,0x41,
+0xf7,0x2f,0xd1,0x00,0x11,0x00,0x32,0x70,0x4f,0xd1,0x11,0x00,0x40,0x00,0x4f,0xd1,
+0x0d,0xb6,0x00,0xe2,0x70,0x00,0x5f,0xd2,0xfd,0xaa,0xaa,0xaa,0x92,0x00,0x00,0x5f,
+0xdf,0x80,0x5e,0x00,0x33,0x5f,0xf8,0x00,0x09,0x00,0x1b,0x70,0x87,0x00,0x21,0x3b,
+0x30,0x07,0x00,0x21,0x3f,0xff,0x08,0x00,0x40,0x4f,0xe4,0xef,0x40,0x07,0x00,0x20,
+0xd2,0x02,0xc0,0x00,0x20,0x4f,0xd1,0xe0,0x00,0x00,0x07,0x00,0x00,0x08,0x00,0xf0,
+0x06,0x4f,0xfa,0x81,0x00,0x02,0x8a,0xff,0x47,0xff,0xff,0x80,0x00,0x8f,0xff,0xf7,
+0x00,0x01,0xf8,0x00,0x08,0xf1,0x82,0x00,0x5f,0x80,0x00,0x8f,0x10,0x00,0x0f,0x00,
+0x0d,0x30,0xfc,0x99,0x9c,0x0f,0x00,0x40,0x0d,0xff,0xff,0xfd,0x69,0x00,0x40,0xcf,
+0xff,0xff,0xc0,0x1e,0x00,0x5f,0xda,0xaa,0xdf,0x10,0x00,0x4b,0x00,0x1a,0xf0,0x0b,
+0x6f,0xff,0xf8,0x00,0x08,0xff,0xff,0x64,0xff,0xb9,0x20,0x00,0x29,0xbf,0xf4,0x05,
+0xfd,0x10,0x00,0x00,0x1d,0xf5,0x00,0x05,0xfd,0x10,0x07,0x00,0x00,0x08,0x00,0x20,
+0x1d,0xf5,0x48,0x01,0x32,0xfd,0x3d,0xf4,0x58,0x01,0x12,0xf4,0x58,0x01,0x13,0xc4,
+0xf1,0x00,0x04,0x88,0x01,0x22,0x3f,0x30,0x08,0x00,0x24,0x0b,0xfb,0x81,0x01,0x03,
+0x08,0x02,0x32,0xcf,0xdf,0xc0,0x2b,0x01,0x21,0xe1,0xef,0x2c,0x00,0x31,0x0d,0xf6,
+0x06,0xb3,0x00,0x50,0x05,0xfd,0x00,0x0d,0xf5,0x09,0x00,0xf0,0x03,0xdf,0x50,0x00,
+0x5f,0xd0,0x00,0x00,0x00,0x6f,0xc0,0x00,0x00,0xcf,0x60,0x00,0x00,0x0e,0xf4,0xb7,
+0x01,0x40,0x00,0x00,0x07,0xfb,0x4f,0x00,0xd1,0xf7,0x00,0x01,0xff,0x63,0x33,0x33,
+0x33,0x6f,0xf1,0x00,0x8f,0xff,0x01,0x00,0x32,0x80,0x1f,0xff,0x01,0x00,0x01,0x74,
+0x01,0x31,0x02,0x89,0x50,0xe0,0x01,0xf1,0x39,0xff,0xff,0xb0,0x00,0x00,0x02,0x40,
+0xdf,0x30,0x9f,0x50,0x00,0x4d,0xff,0x4f,0xa0,0x02,0xf9,0x00,0x7f,0xf9,0x44,0xfe,
+0x10,0x6f,0x70,0x5f,0xd1,0x00,0x7f,0xfe,0xcf,0xe1,0x0e,0xf1,0x00,0x0a,0xff,0xff,
+0xd2,0x05,0xf7,0x00,0x00,0xdf,0xff,0x93,0xf4,0x8f,0x20,0x00,0x0f,0xfe,0x40,0x2f,
+0x8a,0xf0,0x00,0x03,0xfb,0x10,0x00,0xfa,0x8f,0x20,0x00,0x57,0x00,0x00,0x2f,0x85,
+0xf7,0xcc,0x02,0x40,0xf5,0x0e,0xe1,0x00,0xa1,0x03,0x30,0x00,0x6f,0xc1,0x09,0x05,
+0xe0,0x60,0x00,0x8f,0xe7,0x32,0x37,0xef,0x80,0x00,0x00,0x5e,0xff,0xff,0xfe,0x70,
+0x00,0x31,0x04,0x78,0x74,0xd5,0x00,0x40,0x1a,0xbb,0xbb,0xb7,0x08,0x00,0xf1,0x13,
+0x40,0x6f,0xff,0xff,0x23,0x60,0x00,0x00,0x6f,0x90,0xaf,0xff,0x72,0xef,0x30,0x00,
+0x13,0xec,0x00,0xcf,0xc0,0x1d,0x86,0x30,0x0b,0xf8,0x10,0x02,0xe2,0x00,0x0c,0xfb,
+0x00,0x9f,0x29,0x02,0x41,0x6a,0x20,0x3a,0xa0,0x38,0x00,0x31,0xef,0x56,0xff,0x08,
+0x00,0x41,0x0e,0xd5,0x04,0x90,0x09,0x00,0x41,0xa7,0x12,0xff,0x40,0x47,0x01,0x31,
+0xf3,0x0b,0x87,0xe9,0x02,0x40,0x66,0x00,0x0b,0xf7,0x26,0x01,0xf0,0x02,0xff,0x30,
+0x00,0xcd,0x8b,0x10,0x00,0x0a,0xb6,0xb0,0x00,0x00,0x1d,0xf8,0xe7,0xeb,0xdf,0x7f,
+0x00,0x51,0x8a,0x8f,0x6f,0xe3,0x80,0x66,0x01,0x21,0x92,0x76,0x07,0x00,0x14,0x60,
+0x75,0x01,0x40,0x99,0xdf,0xec,0x70,0x3f,0x01,0xf0,0x25,0xbf,0xfd,0xbb,0xef,0xe5,
+0x00,0x02,0xfe,0x20,0xbf,0xa0,0x00,0x4e,0xf6,0x00,0x5f,0xc0,0x00,0xaf,0xb0,0x00,
+0x1d,0xf3,0x00,0x9f,0xc1,0x00,0xaf,0x80,0x00,0x1f,0xc0,0x08,0xff,0xd1,0x1e,0xf4,
+0x00,0x00,0x8f,0x20,0xcd,0x6f,0xdd,0xf5,0x00,0x00,0x03,0xf6,0x0e,0xb0,0x5f,0x3b,
+0x03,0x50,0x2f,0x80,0xec,0x00,0x34,0x57,0x01,0x00,0x7c,0x07,0x01,0xb7,0x01,0x42,
+0x50,0x6f,0x50,0x00,0x8d,0x06,0x20,0xee,0x10,0x91,0x00,0x61,0xf8,0x00,0x04,0xfc,
+0x10,0x00,0x21,0x02,0xd2,0x06,0xff,0x84,0x23,0x5b,0xfd,0x20,0x00,0x00,0x03,0xcf,
+0xff,0xff,0x13,0x03,0x22,0x26,0x77,0xa9,0x03,0x71,0xbd,0xdd,0xdd,0xdd,0xdd,0x40,
+0x00,0xab,0x01,0xe0,0xe0,0x00,0x06,0xfe,0x21,0x11,0x13,0xf9,0x00,0x00,0xbf,0x80,
+0x00,0x00,0x79,0x01,0xe0,0xf2,0x00,0x00,0x0e,0xc0,0x00,0x04,0xfd,0x00,0x00,0x08,
+0xf6,0x00,0x00,0x9a,0x01,0xf0,0x00,0xf9,0x00,0x00,0x02,0xcf,0x60,0x1d,0xe4,0x00,
+0x00,0x02,0xff,0xec,0x0a,0xf2,0x17,0x02,0x20,0x4c,0x90,0xc4,0x03,0xf0,0x16,0x4f,
+0x80,0xf4,0x6d,0xde,0x00,0x00,0x06,0xf3,0x3f,0x0c,0x59,0xf1,0x00,0x00,0x6f,0x53,
+0x60,0x10,0xaf,0x00,0x00,0x01,0xfb,0x00,0x00,0x2f,0xb0,0x00,0x00,0x09,0xfb,0x31,
+0x5e,0xf3,0x00,0x00,0xda,0x01,0x11,0xf5,0x07,0x02,0x31,0x89,0x71,0x00,0x16,0x02,
+0x30,0x77,0x77,0x60,0x79,0x03,0xf0,0x03,0xff,0xfe,0x00,0x00,0x01,0x15,0xff,0xff,
+0xe2,0x33,0x0e,0xff,0xff,0xfe,0xee,0xee,0xf4,0xf2,0x1e,0x00,0x21,0x0c,0x4f,0xf5,
+0x03,0xf1,0x00,0xc4,0xe2,0x0e,0xff,0xff,0xf2,0x0c,0x5e,0x20,0x9a,0xaa,0xaa,0x10,
+0xc5,0xe3,0x1a,0x00,0x22,0x5e,0x30,0x0d,0x00,0x02,0x1a,0x00,0x01,0xd4,0x02,0x03,
+0x1a,0x00,0xd3,0x5d,0xee,0xee,0xff,0xff,0xff,0xf5,0x12,0x26,0xff,0xff,0xe1,0x10,
+0x5b,0x00,0x43,0x00,0x01,0x55,0x55,0x01,0x03,0x30,0x03,0x44,0x10,0x10,0x00,0xf0,
+0x08,0x9f,0xff,0xff,0xc2,0xa3,0x00,0x04,0xef,0xff,0xee,0xff,0x5e,0xf8,0x03,0xff,
+0xe6,0x00,0x01,0x40,0xe5,0xbe,0xef,0xc1,0xeb,0x01,0x11,0x30,0xaa,0x00,0x51,0x00,
+0xe3,0x00,0x09,0xf7,0x0f,0x00,0x40,0x00,0x03,0xcc,0x20,0x0f,0x00,0x31,0x00,0x2d,
+0xb1,0x0f,0x00,0x21,0x6f,0x70,0x1e,0x00,0x20,0xae,0x30,0x1e,0x00,0x30,0x32,0xdf,
+0xe1,0x2d,0x00,0x40,0xe9,0xf8,0xef,0xb0,0x0f,0x00,0x82,0xe4,0x04,0xff,0xd6,0x00,
+0x02,0x40,0x91,0x5a,0x00,0x12,0x50,0x69,0x00,0x11,0xc1,0x78,0x00,0x50,0x54,0x10,
+0x00,0x0d,0xee,0x01,0x00,0xf2,0x28,0xed,0x01,0xf2,0x4f,0xfa,0x22,0x22,0x22,0xe1,
+0x1f,0x02,0xff,0x90,0x00,0x79,0xaf,0x11,0xf0,0x03,0x31,0x02,0xcf,0xff,0xf1,0x1f,
+0x00,0x12,0x04,0xff,0xff,0xff,0x11,0xf0,0x1f,0xfa,0x05,0xdf,0xff,0xf1,0x1f,0x02,
+0xff,0xb0,0x00,0x7a,0x9f,0x11,0xf0,0x09,0xa5,0x00,0x00,0x00,0xe1,0x1f,0x88,0x02,
+0x41,0x11,0xf0,0x1f,0xf9,0x0f,0x00,0x00,0x1e,0x00,0x00,0x0f,0x00,0x22,0x1b,0xc7,
+0x1e,0x00,0x22,0x67,0x40,0x1e,0x00,0x11,0xfb,0x0f,0x00,0x12,0x01,0x1e,0x00,0x90,
+0xfe,0xef,0xff,0xee,0xee,0xee,0xf0,0x01,0x22,0x01,0x00,0x10,0x21,0xf8,0x00,0x30,
+0x58,0x98,0x51,0x48,0x00,0x22,0x08,0xff,0x09,0x02,0xf0,0x00,0x1d,0xfc,0x7f,0x3e,
+0x5b,0xfc,0x10,0x00,0x0c,0xf7,0x02,0xf3,0xe0,0x07,0xfc,0xf4,0x06,0xf0,0x35,0x2f,
+0x3e,0x00,0x07,0xf7,0x00,0xed,0x00,0x02,0xf3,0xe0,0x00,0x0d,0xe0,0x3f,0x70,0x00,
+0x2f,0xfd,0x00,0x00,0x6f,0x35,0xf4,0x00,0x00,0x22,0x15,0x20,0x03,0xf5,0x6f,0x30,
+0x07,0xf4,0x04,0xff,0x60,0x2f,0x65,0xf5,0x09,0xe8,0xf2,0xdb,0x4e,0xb6,0xf5,0x1f,
+0xab,0xd3,0xcc,0x03,0xcd,0x39,0xff,0x10,0xbf,0xb3,0xea,0x00,0x00,0x7f,0x8f,0xb0,
+0x02,0xfd,0xf8,0x21,0x03,0xf0,0x02,0xf2,0x00,0x05,0xfe,0x40,0x00,0x00,0x4d,0xf5,
+0x00,0x00,0x04,0xef,0xd9,0x89,0xdf,0xe4,0x78,0x00,0x48,0x7d,0xff,0xfd,0x70,0x89,
+0x05,0x33,0x03,0x89,0x60,0x30,0x06,0x21,0xff,0xe2,0xd2,0x03,0x40,0xf9,0x00,0x4e,
+0xd0,0x09,0x00,0x10,0xeb,0xd2,0x02,0x01,0xe8,0x05,0xf0,0x05,0x00,0x00,0xf8,0x1b,
+0xff,0x80,0x00,0xf8,0x00,0x00,0x1f,0x8c,0xff,0xff,0x90,0x0c,0xe1,0x00,0x08,0xf7,
+0x55,0x04,0xa0,0x4f,0xd6,0x5a,0xfa,0x6f,0xff,0xff,0xf3,0x00,0x4d,0x16,0x05,0x60,
+0xff,0xff,0x00,0x03,0xef,0xdb,0x33,0x06,0x60,0x60,0x01,0xed,0x20,0x7f,0xff,0x67,
+0x04,0x30,0xaf,0x10,0x6f,0xd7,0x02,0x50,0x50,0x0f,0x80,0x2f,0xff,0xad,0x06,0x31,
+0x02,0xf5,0x0b,0x90,0x04,0x32,0xf1,0x3f,0x75,0x99,0x04,0x13,0x22,0xa1,0x04,0x36,
+0xf2,0x03,0x33,0x25,0x07,0x13,0x60,0x28,0x05,0x12,0x90,0x08,0x00,0x23,0x4f,0xa0,
 0x10,0x00,0x13,0xb0,0x08,0x00,0xa2,0xc1,0x00,0x09,0x99,0x98,0x88,0x88,0xbf,0xd1,
 0x00,0x3d,0x00,0xb1,0xd2,0x0b,0xbb,0xbb,0xbb,0xbc,0xcc,0xcc,0xa0,0x16,0x66,0x01,
 0x00,0x22,0x60,0x6f,0x18,0x00,0xa4,0x00,0x5f,0xfe,0xde,0xee,0xff,0xff,0xf0,0x00,
@@ -620,2978 +736,3278 @@ static const uint8_t lz4FontData[] ={
 0x41,0x20,0x03,0xbf,0x70,0x8d,0x04,0x41,0xfb,0x50,0x3d,0xb0,0x12,0x00,0x40,0x8e,
 0xd4,0x05,0x00,0xb9,0x08,0x31,0x71,0x06,0xd2,0xa3,0x05,0x32,0x7c,0xf8,0x00,0xdd,
 0x01,0x20,0x43,0x80,0xdd,0x01,0x40,0xf9,0x20,0x4c,0xd3,0x0b,0x04,0x50,0xf8,0x00,
-0x00,0x0c,0xf4,0xed,0x01,0xf0,0x0f,0x01,0xcf,0x80,0x4f,0xf1,0x00,0x00,0xff,0xd0,
+0x00,0x0c,0xf4,0xed,0x01,0xf0,0x0e,0x01,0xcf,0x80,0x4f,0xf1,0x00,0x00,0xff,0xd0,
 0x6f,0xff,0x11,0xff,0x70,0x00,0x0b,0xfe,0x04,0xff,0xe0,0x3f,0xf3,0x00,0x00,0x1e,
-0xf5,0x04,0x72,0x0a,0xf9,0x9f,0x16,0x31,0xf5,0x00,0x08,0xbe,0x10,0x40,0x06,0xcd,
-0xcd,0xa4,0xf0,0x11,0x40,0xaa,0xaa,0xaa,0x80,0x26,0x02,0x00,0x48,0x01,0xf0,0x0d,
-0x8f,0x00,0x00,0x15,0x6f,0xb0,0x08,0xf0,0x00,0x02,0xe0,0x8f,0xb0,0x8f,0x00,0x00,
-0x2f,0x33,0xcf,0x78,0xf0,0x00,0x02,0xdd,0xd6,0xf8,0x8f,0x00,0xbc,0x0d,0x11,0x88,
-0x82,0x04,0x0f,0x0d,0x00,0x16,0x61,0x88,0x88,0x88,0x88,0x8f,0x86,0x24,0x01,0x15,
-0xf6,0xf6,0x00,0x32,0x01,0x31,0x00,0xa9,0x05,0x31,0xfe,0xfc,0x20,0x7e,0x06,0xf0,
-0x08,0x91,0x00,0x8f,0x23,0x10,0x00,0x00,0x07,0xb0,0x00,0x00,0x9f,0xef,0x90,0x00,
-0x00,0xc5,0x00,0x00,0x01,0x30,0x2c,0x90,0x81,0x03,0x00,0xff,0x04,0xf2,0x15,0x10,
-0x06,0xe2,0x00,0x00,0x02,0x6a,0x00,0xd4,0x01,0xf3,0x00,0x26,0xae,0xff,0xf2,0x0d,
-0x40,0x7b,0x04,0xef,0xff,0xc8,0x40,0x01,0xf1,0x0b,0x60,0x2c,0x84,0x38,0x00,0x00,
-0x2d,0x70,0xb5,0x3b,0x1a,0xf0,0x0f,0x3f,0x09,0x70,0x00,0x05,0xff,0xd0,0x00,0x00,
-0xd3,0x4d,0x00,0x01,0xef,0xff,0x60,0x00,0x0e,0x30,0xc8,0x00,0x14,0x44,0x43,0x00,
-0x03,0xf0,0x02,0xea,0x20,0x4e,0x01,0x90,0xd7,0x00,0x01,0x9f,0xfe,0xff,0xff,0xff,
-0xe6,0x88,0x00,0x34,0x22,0x11,0x11,0x24,0x08,0x13,0x49,0x33,0x04,0x14,0x06,0x46,
-0x08,0x42,0x6f,0x80,0x8d,0x10,0x11,0x00,0x20,0x0e,0xd0,0x71,0x09,0x40,0x05,0xef,
-0xe5,0x96,0x71,0x1c,0x30,0x93,0xfd,0x8d,0x8b,0x1d,0x90,0xe7,0x8b,0x8f,0x20,0x2f,
-0x80,0x00,0x0a,0xf2,0x2f,0x17,0x31,0xf8,0x00,0x00,0xe8,0x18,0x40,0xef,0x20,0x00,
-0x4f,0x07,0x03,0x51,0xfe,0x40,0x00,0x07,0xf0,0x44,0x00,0x33,0x00,0x00,0xac,0x55,
-0x00,0x23,0x0c,0xa0,0x11,0x00,0x13,0xe8,0x11,0x00,0x22,0x0f,0x70,0x11,0x00,0x28,
-0x01,0xf6,0x77,0x00,0x10,0x00,0x39,0x05,0xf0,0x0a,0xeb,0x18,0xc3,0xb9,0xc6,0x04,
-0xd9,0xa0,0x8b,0x1d,0xfe,0x20,0x01,0x00,0x2c,0xe6,0x0a,0xff,0xf0,0xaf,0xff,0x03,
-0xdf,0x70,0x10,0xe9,0x01,0x30,0xc5,0x00,0x00,0x1c,0x19,0x70,0x00,0x00,0x02,0x7d,
-0xfc,0x50,0x00,0x79,0x0a,0xa3,0x01,0x7d,0xfc,0x60,0x5c,0xff,0x93,0x00,0x0c,0xc6,
-0x6c,0x03,0x10,0x04,0x9b,0x02,0x10,0xcf,0x39,0x1c,0x00,0x0f,0x00,0x90,0x9e,0x20,
-0x00,0x04,0xfe,0x30,0x00,0x03,0xfe,0x08,0x00,0x41,0x20,0x00,0x05,0xc1,0x65,0x00,
-0xf6,0x05,0x7c,0xa3,0x00,0xaa,0x35,0xe3,0x1e,0x00,0x06,0xa1,0xd0,0x00,0x5a,0x0c,
-0x70,0x2d,0x40,0x1a,0xed,0x60,0x34,0x09,0x23,0x0a,0xd0,0x3a,0x08,0xf1,0x04,0xa0,
-0x00,0x25,0x81,0x00,0x2e,0xdc,0xcf,0xee,0xff,0xff,0xe1,0x00,0x07,0x88,0x8f,0xa6,
-0x54,0x20,0xe1,0x01,0x31,0x40,0x00,0x95,0x9b,0x09,0x42,0x31,0x35,0xf8,0x00,0xd5,
-0x05,0x20,0xff,0xa1,0xdb,0x03,0xf0,0x1a,0x61,0x0b,0xb4,0xde,0x20,0x00,0xcd,0x6f,
-0x20,0x4f,0x20,0x0e,0xb0,0x0b,0xd1,0x1f,0x30,0xd9,0x00,0x07,0xf0,0x4f,0x30,0x0f,
-0x5b,0xe1,0x00,0x07,0xf1,0xab,0x00,0x0e,0xef,0x40,0x00,0x0a,0xe0,0xca,0x00,0x2e,
-0xf5,0x46,0x06,0xe2,0xaf,0xac,0xff,0xe0,0x00,0x07,0xfd,0x00,0x1a,0xda,0x54,0xa1,
-0x5b,0xef,0x85,0x03,0x53,0x4b,0x72,0x00,0x00,0x23,0x86,0x00,0x01,0xda,0x12,0x21,
-0x18,0x30,0xb3,0x18,0x00,0x54,0x1a,0x22,0x6f,0x20,0xd5,0x1a,0x00,0x08,0x00,0x00,
-0x1a,0x0b,0x21,0x5f,0x30,0xaa,0x01,0x41,0x40,0x4f,0x30,0x00,0x5d,0x10,0x12,0x2f,
-0xcd,0x08,0xf0,0x04,0xd0,0x0f,0x80,0x00,0x03,0x00,0x00,0x08,0xf1,0x0d,0xb0,0x00,
-0x3e,0x20,0x00,0x06,0xf3,0x09,0xf1,0xe4,0x1d,0x71,0x03,0xd3,0x02,0xfa,0x03,0xfa,
-0x00,0x14,0x14,0x22,0xdf,0xf1,0xe7,0x00,0x29,0xfe,0x40,0x90,0x03,0x41,0x01,0xda,
-0x85,0x31,0x08,0x00,0x42,0x9b,0xef,0xff,0xf5,0x13,0x00,0x29,0x24,0x61,0x22,0x00,
-0x20,0x12,0x35,0x1f,0x1f,0x12,0xee,0x53,0x05,0x62,0x04,0xa8,0x76,0x43,0x9f,0x80,
-0x6b,0x0b,0x13,0xf7,0xb3,0x00,0x12,0x60,0x0f,0x00,0x23,0xfb,0x10,0xf5,0x14,0x12,
-0xf1,0xeb,0x04,0x00,0x34,0x0c,0x01,0x68,0x12,0x20,0xcd,0x00,0xa7,0x16,0x01,0x25,
-0x0c,0xa0,0x20,0x6f,0xb0,0x00,0x00,0x1f,0xfe,0xef,0xf2,0x07,0x1e,0x07,0x63,0x79,
-0x98,0x60,0x00,0x00,0x11,0x67,0x00,0x13,0xf9,0x08,0x00,0x14,0xe8,0x08,0x00,0xf1,
-0x08,0x01,0x42,0x0a,0x70,0x00,0x79,0x89,0xfe,0xef,0xf5,0x07,0xfd,0x40,0x9d,0xdd,
-0xfc,0x85,0x20,0x00,0x1b,0xf8,0x00,0x00,0x76,0x00,0x44,0x67,0x00,0x00,0xf6,0x38,
-0x00,0x40,0x7b,0xde,0xc9,0x20,0x15,0x02,0x80,0xd9,0x76,0x8d,0xf5,0x00,0x02,0xdf,
-0xf7,0xed,0x00,0x40,0x10,0x2e,0xc2,0xe7,0x94,0x04,0x40,0x40,0xbd,0x00,0xe7,0xac,
-0x01,0x21,0x40,0xda,0x58,0x00,0xf1,0x09,0xcf,0x10,0x8f,0x73,0xf7,0x00,0x23,0x7e,
-0xf5,0x00,0x09,0xff,0xf4,0x06,0xff,0xfb,0x30,0x00,0x00,0x26,0x50,0x00,0x54,0x10,
-0xb1,0x00,0x23,0xd3,0x00,0x32,0x0c,0x02,0x29,0x01,0x02,0xb9,0x12,0x11,0x29,0xa7,
-0x18,0xf1,0x06,0xb0,0x10,0x00,0x2f,0xa0,0x00,0x4a,0xab,0xdf,0xff,0xff,0xa0,0x07,
-0xf3,0x00,0x5e,0xca,0xaf,0x74,0x47,0xf7,0xd0,0x12,0x41,0x7f,0x00,0x00,0xcb,0xb5,
-0x01,0x90,0xcb,0x00,0x00,0xbc,0x00,0x1f,0xa0,0x00,0x02,0xe6,0x1e,0x00,0x44,0x00,
-0x20,0x07,0xf1,0x4b,0x1f,0x20,0x03,0x50,0x7d,0x1f,0x22,0x00,0xe8,0xc4,0x08,0x02,
-0xfa,0x02,0x52,0x00,0xce,0x00,0x00,0x06,0xb4,0x1d,0x41,0x02,0x31,0x3e,0xd0,0xe9,
-0x01,0x21,0x05,0xff,0x79,0x09,0x6e,0x02,0x30,0x00,0x46,0x51,0x00,0x01,0x00,0x32,
-0x02,0x0d,0x40,0x51,0x1f,0x33,0x0e,0x56,0xe0,0x3d,0x13,0x22,0xe0,0xb3,0x0f,0x1d,
-0x31,0x15,0x81,0x00,0x5a,0x03,0x00,0x4d,0x10,0xf1,0x00,0x69,0x9a,0xcf,0xff,0xfe,
-0x60,0x0d,0xd0,0x00,0x9f,0xdb,0xdf,0x65,0x5b,0xf3,0x56,0x12,0x10,0xbc,0x45,0x0c,
-0x21,0xcd,0x00,0x39,0x01,0x10,0xf8,0x84,0x00,0x00,0x1f,0x1f,0x10,0xf7,0xed,0x1f,
-0x20,0x0b,0xd0,0x90,0x00,0x20,0x07,0x60,0x86,0x06,0x32,0x02,0xf4,0x00,0x9e,0x13,
-0x11,0x05,0x9b,0x08,0x60,0xea,0x00,0x00,0x09,0xe0,0x00,0x30,0x1b,0x40,0x03,0x10,
-0x4f,0x90,0x92,0x04,0x31,0xa0,0x0a,0xff,0xac,0x0c,0x59,0x04,0x20,0x02,0x57,0x51,
-0x6e,0x0c,0x22,0x04,0xf7,0x0b,0x00,0xf1,0x00,0xcc,0x48,0xcb,0x00,0xaf,0xfe,0xef,
-0xff,0xfe,0xb6,0x00,0x25,0x56,0x65,0x5e,0x59,0x06,0x00,0x06,0x01,0x90,0x20,0x11,
-0x00,0x00,0x13,0xfa,0x9d,0xf2,0xcf,0x13,0x05,0x82,0xc8,0x40,0x34,0x55,0x55,0x32,
-0x3f,0x60,0x61,0x01,0x10,0xd0,0xd7,0x0d,0x30,0x03,0x46,0xf5,0xab,0x1f,0x10,0x07,
-0x23,0x20,0x10,0x20,0x07,0x05,0x22,0x00,0x5f,0x33,0x06,0x22,0x2f,0xb1,0x43,0x00,
-0xd3,0xff,0xba,0xaa,0xce,0x70,0x00,0x00,0x28,0xbd,0xdc,0xb9,0x30,0x00,0xe7,0x08,
-0x10,0x80,0x4d,0x05,0x50,0x70,0x00,0x4b,0x1e,0x40,0xe2,0x1b,0xf3,0x04,0x01,0x53,
-0xd6,0x6c,0x05,0xa9,0x88,0x9c,0xfd,0xff,0x85,0xb0,0x10,0x4a,0xbc,0xcb,0xbe,0xd5,
-0x20,0xd3,0x04,0x13,0x20,0xe6,0x02,0x20,0xeb,0x7b,0xf4,0x01,0xc4,0xfe,0xff,0xff,
-0xfd,0x95,0x10,0x00,0x24,0x55,0x65,0x43,0x2e,0x5a,0x1c,0x22,0x8f,0x10,0x22,0x00,
-0x22,0x44,0xf8,0x7d,0x02,0x23,0x5f,0xff,0x3b,0x20,0x33,0x02,0x42,0x00,0x17,0x01,
-0x00,0x61,0x01,0x14,0xc0,0x25,0x05,0x41,0xea,0x87,0x89,0xb9,0xd6,0x1a,0x20,0xdf,
-0xff,0xe4,0x0a,0x07,0xc4,0x04,0x10,0xb0,0x05,0x00,0x10,0xfb,0xd3,0x1f,0x01,0x74,
-0x06,0x10,0xf6,0x0d,0x07,0x30,0xe3,0x00,0x00,0xbe,0x0b,0x00,0xe1,0x19,0x00,0x46,
-0x00,0x01,0xba,0x15,0x21,0xbf,0x60,0x91,0x0c,0x02,0xb0,0x1c,0x11,0xb1,0x25,0x03,
-0x02,0x3c,0x18,0x11,0xe3,0x58,0x04,0x11,0xf5,0x4e,0x07,0x01,0x06,0x00,0x22,0x3d,
-0x30,0x41,0x22,0x00,0xe5,0x00,0x20,0x28,0x30,0xb4,0x01,0x10,0x00,0x69,0x21,0x01,
-0x48,0x05,0x61,0x2f,0x50,0x00,0x3f,0x40,0x00,0xab,0x00,0xf1,0x02,0x5f,0x10,0x04,
-0x98,0x77,0x8f,0xcc,0xe6,0x6f,0x00,0x06,0xef,0xff,0xef,0xeb,0x93,0x7d,0xb2,0x00,
-0x33,0x60,0x00,0x8c,0x08,0x00,0x11,0x9c,0x08,0x00,0x42,0x50,0x00,0xac,0x2a,0x38,
-0x00,0x40,0x8e,0x78,0x00,0x00,0x6c,0x01,0x40,0x7f,0xd3,0x00,0x00,0xff,0x06,0x22,
-0x5f,0xe0,0x93,0x08,0x00,0xcb,0x0a,0x30,0x0b,0xf4,0x00,0x76,0x1d,0x75,0x03,0xcf,
-0x80,0x00,0x00,0x02,0x10,0xe5,0x03,0x01,0xec,0x01,0x81,0x02,0x32,0x11,0x11,0x22,
-0x42,0x00,0x7f,0xff,0x0c,0x7f,0x02,0x45,0x66,0x76,0x65,0x42,0x00,0x01,0x00,0x0d,
-0x23,0x4c,0x20,0x07,0x02,0x01,0xee,0x00,0x12,0x00,0xd8,0x0c,0x02,0x21,0x08,0x70,
-0xfa,0x53,0x23,0x44,0x69,0x90,0x2b,0x4e,0x00,0x69,0xfa,0x00,0x01,0x35,0x65,0x44,
-0x2a,0x08,0x01,0xc9,0x1d,0x03,0x1a,0x15,0x00,0x84,0x03,0xf2,0x00,0xb1,0x59,0xb0,
-0x0d,0xcb,0xaa,0xbb,0xef,0xff,0xeb,0x00,0x9a,0xbc,0xcb,0xa9,0x48,0x07,0x02,0x43,
-0x0e,0x02,0x46,0x0e,0x02,0x62,0x00,0x02,0x8e,0x0d,0xf3,0x05,0x33,0xf8,0x00,0x02,
-0xe4,0x00,0x00,0xaf,0xff,0xd0,0x00,0x5f,0x10,0x00,0x00,0x13,0x52,0x00,0x08,0xf0,
-0xae,0x04,0x12,0x20,0x51,0x03,0xb1,0xfd,0x40,0x00,0x00,0x23,0x00,0x00,0x05,0xef,
-0xfe,0xde,0xb4,0x0e,0x81,0x57,0x9a,0x98,0x63,0x00,0x00,0x5a,0x30,0xa1,0x00,0x17,
-0xf3,0x3d,0x02,0x22,0x06,0xf2,0x0d,0x00,0x02,0x25,0x04,0x12,0xf0,0x45,0x00,0x02,
-0x7c,0x00,0x12,0xf0,0x41,0x02,0x08,0x0d,0x00,0x11,0x9f,0x5d,0x00,0x20,0x09,0xf0,
-0x52,0x02,0x10,0xe8,0x55,0x10,0xf5,0x09,0x02,0xdf,0x44,0xf9,0x00,0x00,0x07,0xef,
-0x50,0x0b,0xfd,0x9a,0xcf,0xfd,0x30,0x00,0x07,0xdf,0xec,0xa4,0x00,0x00,0x69,0x10,
-0x6a,0x04,0x10,0xc4,0x41,0x00,0x30,0x5d,0x06,0xe0,0x41,0x00,0x40,0xe7,0x0d,0x80,
-0x8f,0xd3,0x22,0x30,0x21,0x09,0xe0,0xdc,0x27,0x22,0x00,0x9e,0x59,0x02,0x11,0xe0,
-0x07,0x00,0x18,0xad,0xa7,0x06,0x11,0xbd,0x68,0x00,0x01,0x53,0x20,0x30,0x02,0xf6,
-0x9f,0x12,0x03,0xf3,0x04,0xef,0x36,0xf7,0x00,0x00,0x17,0xff,0x40,0x0c,0xfc,0x9a,
-0xcf,0xfc,0x20,0x00,0x18,0xdf,0xec,0x93,0xed,0x1f,0x03,0x51,0x01,0x10,0x9e,0xd0,
-0x1f,0x60,0x45,0x55,0x66,0xbf,0x77,0x77,0x21,0x0a,0x71,0xfe,0xff,0xee,0xee,0xfb,
-0x32,0x10,0x36,0x23,0x00,0x01,0x00,0x22,0x46,0xae,0xbf,0x09,0x12,0xff,0x13,0x0e,
-0x10,0xdb,0xf3,0x1b,0x00,0x01,0x03,0x00,0x02,0x24,0x10,0x00,0x29,0x04,0x21,0x6f,
-0x60,0x48,0x06,0x12,0xa8,0x22,0x0e,0x33,0x07,0xcc,0xdf,0xe4,0x0a,0x13,0xf8,0x59,
-0x01,0x11,0xc0,0x93,0x00,0x13,0x9e,0x79,0x0f,0x17,0x9b,0x67,0x06,0x21,0x10,0x45,
-0x28,0x04,0x51,0xc3,0x0d,0x65,0xf1,0x00,0x8e,0x05,0xc3,0x5f,0x1a,0x61,0x33,0x44,
-0x45,0x58,0xf8,0x66,0xb6,0x60,0xaf,0xa5,0x0a,0x63,0x02,0x43,0x21,0x00,0x03,0xf3,
-0x81,0x06,0x22,0x5f,0x30,0x4d,0x01,0x02,0xbd,0x0f,0x00,0xef,0x06,0x13,0x70,0x62,
-0x03,0x11,0xcb,0x11,0x00,0x11,0xac,0x6f,0x21,0x00,0xb1,0x18,0x22,0x49,0xfb,0x53,
-0x02,0x14,0xef,0x14,0x11,0x13,0x0a,0x11,0x02,0x22,0x1b,0xf6,0x9d,0x04,0x23,0x9f,
-0xf6,0xb8,0x03,0x1b,0xa2,0x99,0x02,0x51,0x01,0x10,0x00,0x00,0x7c,0x19,0x03,0x13,
-0x80,0x04,0x01,0x00,0x09,0x00,0x1a,0x7e,0x09,0x00,0xf2,0x05,0x93,0x57,0x89,0xdf,
-0xde,0xf6,0x0c,0xce,0xff,0xff,0xff,0xdc,0xdf,0x87,0x73,0x0d,0xb9,0x7f,0x92,0x10,
-0x51,0x01,0x00,0x84,0x03,0x14,0x9c,0x09,0x00,0x12,0xab,0x09,0x00,0x33,0x03,0xa8,
-0xe9,0x09,0x00,0x21,0xbc,0xc2,0xcf,0x0c,0x03,0x94,0x00,0x01,0x03,0x06,0x02,0x26,
-0x02,0x50,0xfb,0x65,0x66,0x78,0xa4,0x48,0x01,0x00,0xf8,0x00,0x03,0xd7,0x21,0x11,
-0x11,0x39,0x01,0x61,0x11,0x23,0x35,0x65,0x00,0x00,0x76,0x0b,0x82,0xe1,0x00,0x00,
-0x05,0x43,0x21,0x4e,0xd2,0xfa,0x0e,0x12,0xa0,0x66,0x02,0x11,0x70,0xb5,0x00,0x21,
-0xbe,0x40,0xd6,0x00,0xf2,0x02,0xef,0x77,0x89,0xbb,0xcd,0x8b,0xdf,0xff,0xff,0xff,
-0xc9,0x88,0x85,0xa9,0x74,0x21,0xbc,0xd6,0x02,0x13,0x9d,0x0d,0x03,0x12,0x60,0x9a,
-0x01,0x13,0xf4,0xbc,0x04,0x03,0x87,0x00,0x23,0xbf,0x71,0x08,0x00,0x12,0xfd,0x46,
-0x01,0x46,0x27,0xab,0xa0,0x00,0x80,0x07,0x02,0x60,0x0f,0x02,0x1f,0x25,0x01,0x2f,
-0x02,0x20,0x47,0xa5,0x8f,0x00,0x40,0xef,0xff,0xff,0xd4,0x71,0x07,0x21,0x78,0xf9,
-0x63,0x00,0x00,0x46,0x26,0x70,0x23,0x45,0x43,0x20,0x00,0x08,0xf0,0xee,0x11,0x91,
-0xd0,0x00,0x0d,0xc0,0x00,0x22,0x10,0x12,0x30,0xca,0x0c,0x05,0xc1,0x08,0x01,0xe4,
-0x06,0x20,0x08,0x60,0xd7,0x00,0x12,0xf9,0x06,0x01,0x21,0x08,0xf3,0x87,0x00,0x00,
-0xb8,0x01,0xe0,0x0c,0xf7,0x32,0x35,0x71,0x7f,0x70,0x00,0x01,0xbf,0xff,0xff,0xf2,
-0x16,0x0a,0x12,0x10,0x24,0x87,0x02,0x10,0x09,0x1f,0x00,0x31,0x38,0x00,0x00,0xe6,
-0x04,0x30,0x5b,0x1e,0x40,0x48,0x01,0xf7,0x05,0x14,0x00,0x1e,0x56,0xd0,0x48,0x77,
-0x9f,0xde,0xfe,0x00,0x06,0xa0,0x10,0x6e,0xff,0xff,0xb8,0x53,0x00,0x0c,0x03,0x01,
-0xdc,0x25,0x20,0x4f,0xff,0x26,0x02,0x76,0x03,0xf5,0x00,0x27,0x65,0x56,0x72,0x11,
-0x04,0x23,0x00,0x0d,0xb2,0x05,0x00,0xfa,0x21,0x12,0x60,0x43,0x01,0x22,0x20,0x05,
-0xa5,0x03,0x13,0xed,0xc8,0x03,0x20,0x05,0xf7,0x48,0x10,0x30,0x00,0x22,0x00,0x7d,
-0x1c,0x60,0xbf,0xfe,0xff,0xf9,0x00,0x08,0xf6,0x04,0x30,0x68,0x87,0x62,0x6b,0x01,
-0x30,0x46,0x75,0x20,0x79,0x16,0xd3,0xff,0xef,0xf9,0x00,0x8e,0xff,0xa6,0x20,0x00,
-0x8f,0x70,0x7b,0x50,0x16,0x08,0x06,0xd2,0x04,0x01,0xea,0x03,0x00,0x1f,0x07,0x01,
-0x50,0x00,0x00,0x22,0x07,0x40,0x24,0x69,0xef,0xc2,0xdf,0x05,0x11,0xfe,0x7f,0x03,
-0x14,0x23,0xa9,0x00,0x21,0x13,0x42,0xc0,0x01,0xf1,0x03,0x6a,0xef,0xff,0xff,0x91,
-0x00,0x03,0x7c,0xff,0xd9,0x53,0x24,0x8f,0xe1,0x05,0xff,0xd7,0x20,0x85,0x0d,0x11,
-0x09,0x36,0x01,0x00,0x4e,0x16,0x09,0xd6,0x04,0x00,0x9c,0x27,0x02,0x19,0x0f,0x13,
-0xd0,0xde,0x02,0x03,0xce,0x02,0x21,0x3c,0xfa,0x34,0x02,0x32,0x48,0xdf,0xf7,0x28,
-0x03,0x21,0xfd,0x60,0x10,0x00,0x24,0x96,0x41,0xdd,0x02,0x70,0x24,0x56,0x78,0x97,
-0x28,0x9b,0xce,0xe8,0x03,0x72,0xd9,0x3f,0xec,0xa8,0x64,0x4d,0xe6,0xe1,0x14,0x13,
-0xdc,0x48,0x00,0x13,0xd1,0x1c,0x01,0x27,0x60,0x00,0xc4,0x04,0x00,0x2d,0x08,0x02,
-0x01,0x00,0x19,0xcc,0x85,0x05,0x00,0x89,0x21,0x03,0x13,0x09,0x04,0xb5,0x0b,0x32,
-0xcf,0xe8,0x42,0x9f,0x05,0x23,0xdf,0xff,0xa2,0x08,0x13,0x45,0x78,0x00,0x50,0x79,
-0x96,0x03,0x89,0xbc,0xaa,0x0e,0x82,0xed,0x70,0x5f,0xec,0xa8,0x64,0x5e,0xd5,0x20,
-0x00,0x61,0x1e,0xb0,0x00,0x06,0x20,0x00,0xbc,0x08,0x22,0xa2,0x8b,0x48,0x02,0x32,
-0x08,0xc0,0xe5,0x63,0x00,0x32,0x0e,0x32,0x10,0xc5,0x27,0x13,0x10,0x7c,0x08,0x22,
-0x00,0x00,0x2a,0x00,0x0a,0x65,0x15,0x24,0x01,0xdf,0x09,0x00,0x32,0xef,0xc6,0x20,
-0x09,0x00,0x33,0x8f,0xff,0xe0,0x73,0x12,0x15,0x75,0x7f,0x12,0x16,0xbf,0x82,0x15,
-0x10,0x34,0x8b,0x16,0x70,0x01,0x9f,0xc0,0x00,0x5f,0x50,0x08,0xc6,0x11,0x40,0xdd,
-0x6e,0xf8,0x10,0x2b,0x0a,0x11,0xa1,0xf9,0x13,0x10,0x30,0x27,0x00,0x02,0x1e,0x0b,
-0x12,0xec,0xe6,0x00,0x02,0xda,0x04,0x18,0xf2,0x72,0x24,0x81,0xcf,0xa4,0x21,0x22,
-0x35,0x85,0x01,0xaf,0xf4,0x06,0x50,0x00,0x04,0x56,0x65,0x53,0xa5,0x00,0x14,0x31,
-0x6f,0x14,0x13,0x70,0x44,0x0d,0x14,0xf3,0x77,0x16,0x50,0x59,0xa0,0x05,0x00,0x00,
-0x8c,0x1c,0x80,0xc7,0x04,0xfd,0x50,0x00,0x56,0x68,0xf5,0x97,0x12,0x11,0xb1,0xb2,
-0x02,0x10,0x01,0x64,0x03,0x20,0x2f,0x60,0x7d,0x02,0x11,0x20,0xd5,0x05,0x13,0x6f,
-0x3f,0x05,0x22,0x06,0xf0,0x15,0x0a,0x01,0xac,0x06,0x60,0x8f,0x60,0x02,0x9c,0xcc,
-0xf3,0xed,0x04,0x41,0x03,0xfc,0x77,0xbf,0x24,0x0f,0x61,0xbb,0x00,0x03,0xfa,0xfe,
-0x30,0x23,0x01,0x30,0x6f,0x23,0xed,0xac,0x03,0x40,0xa6,0x8f,0xd0,0x01,0xbf,0x00,
-0x30,0x6c,0xfe,0xa2,0x44,0x00,0x19,0x40,0xae,0x01,0xf2,0x02,0x0d,0xa0,0x00,0x4b,
-0xa9,0x99,0xab,0x50,0xf7,0x00,0x03,0xde,0xee,0xee,0xd5,0x1f,0x50,0x0e,0x04,0x13,
-0xf2,0xcb,0x01,0x03,0xb2,0x00,0x03,0x10,0x07,0x13,0x7e,0x72,0x02,0x31,0xd1,0x70,
-0x02,0xaa,0x26,0x21,0x79,0x00,0xbb,0x1b,0x21,0xfd,0x40,0x4a,0x15,0x42,0x6f,0xe0,
-0x02,0xf7,0x26,0x01,0xe5,0x0b,0xfd,0xa9,0xab,0xdf,0x2f,0x70,0x00,0x06,0xac,0xdd,
-0xca,0x80,0x94,0x46,0x05,0x52,0x37,0x88,0x73,0x00,0x00,0x7a,0x13,0x20,0xfb,0x10,
-0xe0,0x04,0xf1,0x00,0x52,0xf7,0x05,0xef,0x40,0x00,0x09,0xf8,0x00,0x4f,0x40,0x01,
-0xce,0x00,0x04,0xe5,0x15,0x20,0x02,0xf9,0xda,0x02,0x10,0xbd,0xca,0x06,0x21,0x1f,
-0x80,0xb5,0x0a,0x60,0x8f,0x13,0xf5,0x00,0x03,0xf6,0x5d,0x07,0x21,0x3f,0x40,0x34,
-0x07,0x60,0x9f,0x01,0xf7,0x00,0x1f,0xa0,0xb6,0x03,0x40,0x0c,0xd1,0x0a,0xf2,0x5e,
-0x21,0x30,0x00,0x4f,0xec,0x1b,0x01,0x92,0xfc,0x00,0x00,0x6e,0xf8,0x00,0x01,0x5c,
-0xfb,0x80,0x07,0x02,0xd4,0x28,0x12,0x00,0x4c,0x02,0x10,0x07,0xf1,0x01,0x13,0x59,
-0x16,0x28,0x13,0x8f,0x60,0x0e,0x10,0x7f,0x0c,0x2a,0x90,0x01,0x22,0x11,0x8f,0x46,
-0x82,0x5f,0x10,0x06,0xb7,0x01,0xa3,0xe2,0x7f,0x00,0x01,0x44,0x55,0xaf,0x20,0x00,
-0x8d,0xbc,0x07,0x11,0x9b,0xf0,0x04,0x02,0x9f,0x2b,0x00,0x74,0x01,0x40,0xba,0x34,
-0x00,0x00,0x75,0x0a,0x40,0xbb,0x97,0x00,0x6d,0x19,0x26,0xf0,0x0d,0xad,0xf1,0x07,
-0xf7,0x33,0x8f,0xfb,0x20,0x9f,0xc0,0x0c,0x90,0x00,0x4f,0x7e,0xf4,0x7f,0x70,0x0b,
-0xd3,0x00,0xbf,0x10,0xb9,0x4f,0x40,0x02,0xef,0x05,0x0d,0x69,0x19,0x20,0x00,0x05,
-0x76,0x30,0x4e,0x06,0x23,0x5e,0xd3,0x11,0x02,0x22,0xef,0xf3,0xef,0x02,0x31,0xd1,
-0x2e,0xe1,0xc5,0x02,0x43,0xf3,0x00,0x3f,0xd1,0xb9,0x03,0x32,0x5f,0xb0,0x00,0x87,
-0x10,0x51,0x7f,0xa0,0x00,0x08,0xfc,0xdf,0x03,0x41,0x90,0x00,0x2d,0x20,0xb4,0x02,
+0xf5,0x04,0x72,0x0a,0x50,0x02,0x60,0x2d,0xf5,0x00,0x08,0xf9,0x00,0x83,0x0a,0xb0,
+0xcd,0xcd,0xa4,0x00,0x00,0x00,0x2a,0xaa,0xaa,0xaa,0x80,0x26,0x02,0x00,0x48,0x01,
+0xf0,0x0c,0x8f,0x00,0x00,0x15,0x6f,0xb0,0x08,0xf0,0x00,0x02,0xe0,0x8f,0xb0,0x8f,
+0x00,0x00,0x2f,0x33,0xcf,0x78,0xf0,0x00,0x02,0xdd,0xd6,0xf8,0x8f,0x33,0x00,0x21,
+0x0f,0x88,0x82,0x04,0x0f,0x0d,0x00,0x16,0x61,0x88,0x88,0x88,0x88,0x8f,0x86,0x24,
+0x01,0x15,0xf6,0xf6,0x00,0x32,0x01,0x31,0x00,0xa9,0x05,0x31,0xfe,0xfc,0x20,0x7e,
+0x06,0xf0,0x08,0x91,0x00,0x8f,0x23,0x10,0x00,0x00,0x07,0xb0,0x00,0x00,0x9f,0xef,
+0x90,0x00,0x00,0xc5,0x00,0x00,0x01,0x30,0x2c,0x90,0x81,0x03,0x00,0xff,0x04,0xf0,
+0x39,0x10,0x06,0xe2,0x00,0x00,0x02,0x6a,0x00,0xd4,0x01,0xf3,0x00,0x26,0xae,0xff,
+0xf2,0x0d,0x40,0x7b,0x04,0xef,0xff,0xc8,0x40,0x01,0xf1,0x0b,0x60,0x2c,0x84,0x38,
+0x00,0x00,0x2d,0x70,0xb5,0x00,0x00,0x0b,0xf3,0x00,0x00,0x3f,0x09,0x70,0x00,0x05,
+0xff,0xd0,0x00,0x00,0xd3,0x4d,0x00,0x01,0xef,0xff,0x60,0x00,0x0e,0x30,0xc8,0x00,
+0x14,0x44,0x43,0x00,0x03,0xf0,0x02,0xea,0x20,0x4e,0x01,0x90,0xd7,0x00,0x01,0x9f,
+0xfe,0xff,0xff,0xff,0xe6,0x88,0x00,0x34,0x22,0x11,0x11,0x24,0x08,0x13,0x49,0x33,
+0x04,0x14,0x06,0x46,0x08,0x42,0x6f,0x80,0x8d,0x10,0x11,0x00,0x20,0x0e,0xd0,0x71,
+0x09,0xf0,0x06,0x05,0xef,0xe5,0x96,0x00,0x00,0x4e,0xff,0x93,0xfd,0x8d,0xf3,0x00,
+0x00,0x2f,0xe7,0x8b,0x8f,0x20,0x2f,0x80,0xbd,0x09,0xf0,0x00,0x08,0xf2,0x02,0xf8,
+0x00,0x00,0xf9,0x00,0x00,0x2f,0xea,0xef,0x20,0x00,0x4f,0x07,0x03,0x51,0xfe,0x40,
+0x00,0x07,0xf0,0x44,0x00,0x33,0x00,0x00,0xac,0x55,0x00,0x23,0x0c,0xa0,0x11,0x00,
+0x13,0xe8,0x11,0x00,0x22,0x0f,0x70,0x11,0x00,0x28,0x01,0xf6,0x77,0x00,0x10,0x00,
+0x39,0x05,0xf0,0x0a,0xeb,0x18,0xc3,0xb9,0xc6,0x04,0xd9,0xa0,0x8b,0x1d,0xfe,0x20,
+0x01,0x00,0x2c,0xe6,0x0a,0xff,0xf0,0xaf,0xff,0x03,0xdf,0x70,0x10,0xe9,0x01,0xe0,
+0xc5,0x00,0x00,0x00,0x5c,0xfe,0x82,0x00,0x00,0x02,0x7d,0xfc,0x50,0x00,0x79,0x0a,
+0xa3,0x01,0x7d,0xfc,0x60,0x5c,0xff,0x93,0x00,0x0c,0xc6,0x6c,0x03,0x10,0x04,0x9b,
+0x02,0x10,0xcf,0x98,0x02,0x00,0x0f,0x00,0x90,0x9e,0x20,0x00,0x04,0xfe,0x30,0x00,
+0x03,0xfe,0x08,0x00,0x41,0x20,0x00,0x05,0xc1,0x65,0x00,0xf6,0x05,0x7c,0xa3,0x00,
+0xaa,0x35,0xe3,0x1e,0x00,0x06,0xa1,0xd0,0x00,0x5a,0x0c,0x70,0x2d,0x40,0x1a,0xed,
+0x60,0x34,0x09,0x23,0x0a,0xd0,0x3a,0x08,0xf1,0x04,0xa0,0x00,0x25,0x81,0x00,0x2e,
+0xdc,0xcf,0xee,0xff,0xff,0xe1,0x00,0x07,0x88,0x8f,0xa6,0x54,0x20,0xe1,0x01,0x31,
+0x40,0x00,0x95,0x9b,0x09,0x42,0x31,0x35,0xf8,0x00,0xd5,0x05,0x20,0xff,0xa1,0xdb,
+0x03,0xf0,0x1a,0x61,0x0b,0xb4,0xde,0x20,0x00,0xcd,0x6f,0x20,0x4f,0x20,0x0e,0xb0,
+0x0b,0xd1,0x1f,0x30,0xd9,0x00,0x07,0xf0,0x4f,0x30,0x0f,0x5b,0xe1,0x00,0x07,0xf1,
+0xab,0x00,0x0e,0xef,0x40,0x00,0x0a,0xe0,0xca,0x00,0x2e,0xf5,0x46,0x06,0xe2,0xaf,
+0xac,0xff,0xe0,0x00,0x07,0xfd,0x00,0x1a,0xda,0x54,0xa1,0x5b,0xef,0x85,0x03,0x53,
+0x4b,0x72,0x00,0x00,0x23,0x86,0x00,0x10,0x7f,0x00,0x02,0x50,0x18,0x30,0x00,0x6f,
+0x20,0x0f,0x05,0x12,0xd0,0x08,0x00,0x21,0x05,0xf6,0x08,0x00,0x00,0x1a,0x0b,0x21,
+0x5f,0x30,0xaa,0x01,0x31,0x40,0x4f,0x30,0x8c,0x00,0x22,0x90,0x2f,0xcd,0x08,0xf1,
+0x0e,0xd0,0x0f,0x80,0x00,0x03,0x00,0x00,0x08,0xf1,0x0d,0xb0,0x00,0x3e,0x20,0x00,
+0x06,0xf3,0x09,0xf1,0x00,0x9f,0x10,0x00,0x03,0xd3,0x02,0xfa,0x03,0xfa,0x59,0x00,
+0x32,0xaf,0xdf,0xf1,0xe7,0x00,0x23,0xfe,0x40,0x74,0x01,0x50,0x00,0x00,0x00,0x00,
+0x00,0xf1,0x00,0x00,0x01,0xda,0x85,0x31,0x00,0x00,0x00,0x00,0x01,0x9b,0xef,0xff,
+0xf5,0x00,0x01,0x00,0x38,0x24,0x61,0x00,0x01,0x00,0xf1,0x04,0x12,0x35,0x71,0x00,
+0x00,0x06,0xee,0xff,0xff,0xff,0xf8,0x00,0x00,0x04,0xa8,0x76,0x43,0x9f,0x80,0x18,
+0x00,0x22,0x07,0xf7,0x20,0x00,0x22,0x7f,0x60,0x0f,0x00,0x22,0xfb,0x10,0x0f,0x00,
+0x21,0xff,0xf1,0x0f,0x00,0x31,0xf9,0x03,0xf8,0x0f,0x00,0x30,0x90,0x00,0xcd,0x0f,
+0x00,0xf3,0x0b,0xfa,0x00,0x00,0x7f,0x40,0x00,0x20,0x6f,0xb0,0x00,0x00,0x1f,0xfe,
+0xef,0xf2,0x07,0x00,0x00,0x00,0x02,0x79,0x98,0x60,0x00,0x00,0x11,0x67,0x00,0x13,
+0xf9,0x08,0x00,0x14,0xe8,0x08,0x00,0xf1,0x08,0x01,0x42,0x0a,0x70,0x00,0x79,0x89,
+0xfe,0xef,0xf5,0x07,0xfd,0x40,0x9d,0xdd,0xfc,0x85,0x20,0x00,0x1b,0xf8,0x00,0x00,
+0x76,0x00,0x44,0x67,0x00,0x00,0xf6,0x38,0x00,0xf0,0x00,0x7b,0xde,0xc9,0x20,0x00,
+0x00,0x06,0xff,0xd9,0x76,0x8d,0xf5,0x00,0x02,0xdf,0x20,0x00,0xc0,0xaf,0x10,0x2e,
+0xc2,0xe7,0x00,0x00,0x00,0x3f,0x40,0xbd,0x00,0x08,0x00,0x31,0x4f,0x40,0xda,0x58,
+0x00,0xf1,0x09,0xcf,0x10,0x8f,0x73,0xf7,0x00,0x23,0x7e,0xf5,0x00,0x09,0xff,0xf4,
+0x06,0xff,0xfb,0x30,0x00,0x00,0x26,0x50,0x00,0x54,0x10,0xb1,0x00,0x13,0xd3,0x51,
+0x00,0x23,0x09,0xf1,0x09,0x00,0x50,0x0b,0xe0,0x00,0x00,0x29,0x1c,0x00,0xf0,0x09,
+0x0d,0xb0,0x10,0x00,0x2f,0xa0,0x00,0x4a,0xab,0xdf,0xff,0xff,0xa0,0x07,0xf3,0x00,
+0x5e,0xca,0xaf,0x74,0x47,0xf7,0x00,0xeb,0xdf,0x00,0x60,0x00,0x00,0xcb,0x00,0x7f,
+0x30,0x06,0x00,0xb0,0x00,0xbc,0x00,0x1f,0xa0,0x00,0x02,0xf6,0x00,0x00,0xcb,0x44,
+0x00,0xb3,0x07,0xf1,0x00,0x00,0xda,0x00,0x03,0x50,0x00,0x0d,0xb0,0xd5,0x00,0x41,
+0x5f,0x50,0x00,0x01,0xb6,0x00,0xf0,0x08,0xce,0x00,0x00,0x06,0xf2,0x00,0x00,0x00,
+0x05,0xf6,0x02,0x31,0x3e,0xd0,0x00,0x00,0x00,0x0e,0xd0,0x05,0xff,0xff,0x40,0x13,
+0x01,0x5e,0x30,0x00,0x46,0x51,0x00,0x01,0x00,0xf0,0x2a,0x02,0x0d,0x40,0x00,0x00,
+0x09,0xc0,0x00,0x00,0x0e,0x56,0xe0,0x00,0x00,0x0c,0xd0,0x00,0x00,0x06,0xe0,0xb3,
+0x00,0x00,0x0e,0xa0,0x00,0x00,0x15,0x81,0x00,0x00,0x00,0x0f,0x70,0x00,0x00,0x8f,
+0x30,0x00,0x69,0x9a,0xcf,0xff,0xfe,0x60,0x0d,0xd0,0x00,0x9f,0xdb,0xdf,0x65,0x5b,
+0xf3,0x05,0xf5,0x00,0x96,0x00,0x20,0x01,0xf7,0x83,0x01,0x00,0x39,0x01,0x10,0xf8,
+0x84,0x00,0x20,0x05,0xf2,0x0c,0x00,0x50,0x0e,0xb0,0x00,0x0b,0xd0,0x90,0x00,0x80,
+0x07,0x60,0x00,0x1f,0x70,0x00,0x02,0xf4,0x67,0x00,0x21,0x8f,0x10,0x1e,0x00,0xf4,
+0x11,0x00,0x00,0xea,0x00,0x00,0x09,0xe0,0x00,0x00,0x00,0x08,0xf3,0x03,0x10,0x4f,
+0x90,0x00,0x00,0x00,0x2f,0xa0,0x0a,0xff,0xfe,0x20,0x00,0x00,0x00,0x04,0x20,0x02,
+0x57,0xa2,0x00,0x02,0xf1,0x01,0x22,0x04,0xf7,0x0b,0x00,0xf2,0x01,0xcc,0x48,0xcb,
+0x00,0xaf,0xfe,0xef,0xff,0xfe,0xb6,0x00,0x25,0x56,0x65,0x5e,0xa0,0x16,0x02,0xf2,
+0x07,0xf1,0x00,0x20,0x11,0x00,0x00,0x13,0xfa,0x9d,0xf2,0xcf,0xff,0xff,0xff,0xff,
+0xc8,0x40,0x34,0x55,0x55,0x32,0x3f,0x33,0x02,0x00,0x81,0x00,0xf1,0x07,0x00,0x00,
+0x03,0x46,0xf5,0x00,0x1f,0x50,0x00,0x07,0xff,0xf9,0x00,0x4f,0x20,0x00,0x00,0x01,
+0x30,0x00,0x5f,0x20,0x1f,0x00,0x22,0x2f,0xb1,0x43,0x00,0xc3,0xff,0xba,0xaa,0xce,
+0x70,0x00,0x00,0x28,0xbd,0xdc,0xb9,0x30,0x7a,0x00,0x10,0x03,0x83,0x02,0x50,0x1a,
+0x70,0x00,0x4b,0x1e,0x36,0x01,0xf2,0x05,0xcd,0x01,0x53,0xd6,0x6c,0x05,0xa9,0x88,
+0x9c,0xfd,0xff,0x85,0xb0,0x10,0x4a,0xbc,0xcb,0xbe,0xd5,0x20,0x28,0x00,0x13,0x6f,
+0x08,0x00,0x30,0x01,0xeb,0x7b,0xf4,0x01,0xc0,0xfe,0xff,0xff,0xfd,0x95,0x10,0x00,
+0x24,0x55,0x65,0x43,0x2e,0xd6,0x00,0x03,0xf4,0x00,0x01,0x22,0x00,0x22,0x44,0xf8,
+0x7d,0x02,0x40,0x5f,0xff,0xc0,0x00,0x90,0x00,0x43,0x00,0x02,0x42,0x00,0x17,0x01,
+0x00,0x61,0x01,0x23,0xc0,0x00,0x52,0x00,0x40,0xea,0x87,0x89,0xb9,0x09,0x00,0x58,
+0x3a,0xdf,0xff,0xec,0x70,0xa4,0x01,0x20,0x0a,0xb0,0x05,0x00,0x00,0x06,0x03,0x10,
+0x0b,0xcc,0x02,0x10,0x2d,0xeb,0x01,0x20,0x3e,0xe3,0x33,0x00,0x10,0xc1,0x05,0x00,
+0x10,0xb0,0x46,0x00,0x10,0xe0,0x29,0x00,0x11,0xbf,0xfe,0x00,0x11,0xcf,0x81,0x00,
+0x21,0x9f,0xb1,0x25,0x03,0x11,0xd2,0x20,0x02,0x20,0xe3,0x00,0xac,0x02,0x01,0x86,
+0x03,0x11,0x3f,0x06,0x00,0x12,0x3d,0xf0,0x00,0x10,0x05,0xe5,0x00,0x50,0x28,0x30,
+0x00,0x0e,0xb0,0x1a,0x00,0x11,0x50,0xee,0x01,0x71,0x00,0x2f,0x50,0x00,0x3f,0x40,
+0x00,0xab,0x00,0xf1,0x02,0x5f,0x10,0x04,0x98,0x77,0x8f,0xcc,0xe6,0x6f,0x00,0x06,
+0xef,0xff,0xef,0xeb,0x93,0x7d,0xb2,0x00,0x33,0x60,0x00,0x8c,0x08,0x00,0x11,0x9c,
+0x08,0x00,0x42,0x50,0x00,0xac,0x2a,0x38,0x00,0x40,0x8e,0x78,0x00,0x00,0x6c,0x01,
+0x20,0x7f,0xd3,0x00,0x01,0x60,0x00,0x00,0x5f,0xe0,0x00,0x00,0xce,0x02,0xf5,0x03,
+0x2f,0xb0,0x00,0x00,0x0b,0xf4,0x00,0x00,0x0e,0x90,0x00,0x03,0xcf,0x80,0x00,0x00,
+0x02,0x10,0xe5,0x03,0x01,0xec,0x01,0x80,0x02,0x32,0x11,0x11,0x22,0x42,0x00,0x7f,
+0xc9,0x01,0x8f,0x80,0x02,0x45,0x66,0x76,0x65,0x42,0x00,0x01,0x00,0x0d,0x23,0x4c,
+0x20,0x07,0x02,0x01,0xee,0x00,0x02,0xd1,0x01,0x02,0x68,0x04,0x80,0x2e,0xfa,0x53,
+0x23,0x44,0x69,0x90,0x2b,0x4e,0x00,0x78,0xfa,0x00,0x01,0x35,0x65,0x44,0x20,0x39,
+0x00,0x22,0xae,0x00,0xfc,0x00,0x03,0x95,0x04,0xf2,0x02,0x0d,0xb1,0x59,0xb0,0x0d,
+0xcb,0xaa,0xbb,0xef,0xff,0xeb,0x00,0x9a,0xbc,0xcb,0xa9,0xfc,0x2d,0x00,0x13,0x08,
+0xad,0x03,0x32,0x1f,0x80,0x00,0x62,0x00,0x11,0x10,0x2f,0x03,0xf3,0x05,0x33,0xf8,
+0x00,0x02,0xe4,0x00,0x00,0xaf,0xff,0xd0,0x00,0x5f,0x10,0x00,0x00,0x13,0x52,0x00,
+0x08,0xf0,0xae,0x04,0x12,0x20,0x51,0x03,0xc0,0xfd,0x40,0x00,0x00,0x23,0x00,0x00,
+0x05,0xef,0xfe,0xde,0xff,0xdc,0x01,0x81,0x57,0x9a,0x98,0x63,0x00,0x00,0x5a,0x30,
+0xa1,0x00,0x17,0xf3,0x3d,0x02,0x22,0x06,0xf2,0x0d,0x00,0x02,0x25,0x04,0x12,0xf0,
+0x45,0x00,0x02,0x7c,0x00,0x12,0xf0,0x41,0x02,0x08,0x0d,0x00,0x11,0x9f,0x5d,0x00,
+0x20,0x09,0xf0,0x52,0x02,0xf5,0x0e,0xe8,0x7f,0x10,0x00,0x00,0x02,0xdf,0x44,0xf9,
+0x00,0x00,0x07,0xef,0x50,0x0b,0xfd,0x9a,0xcf,0xfd,0x30,0x00,0x07,0xdf,0xec,0xa4,
+0x00,0x00,0x69,0x10,0x6a,0x04,0x10,0xc4,0x41,0x00,0x30,0x5d,0x06,0xe0,0x41,0x00,
+0x90,0xe7,0x0d,0x80,0x8f,0x00,0x00,0x06,0xf1,0x21,0x7d,0x03,0x42,0x04,0x00,0x00,
+0x9e,0x59,0x02,0x11,0xe0,0x07,0x00,0x12,0xad,0x0d,0x00,0x11,0xd0,0x07,0x00,0x11,
+0xbd,0x68,0x00,0x20,0x0b,0xd0,0x06,0x00,0x20,0xf6,0x9f,0x12,0x03,0xf2,0x04,0xef,
+0x36,0xf7,0x00,0x00,0x17,0xff,0x40,0x0c,0xfc,0x9a,0xcf,0xfc,0x20,0x00,0x18,0xdf,
+0xec,0x93,0xf2,0x00,0x13,0x8d,0x51,0x01,0x00,0x4d,0x00,0xf2,0x06,0x34,0x45,0x55,
+0x66,0xbf,0x77,0x77,0x75,0xff,0xff,0xff,0xfe,0xff,0xee,0xee,0xfb,0x32,0x10,0x00,
+0x00,0x8e,0x1f,0x00,0x12,0x46,0x71,0x01,0x31,0x3e,0xff,0xff,0x08,0x00,0x51,0xdb,
+0x00,0x9f,0x20,0x00,0x01,0x03,0x40,0x4f,0x50,0x00,0x00,0x29,0x04,0x11,0x6f,0xb7,
+0x02,0x41,0xaf,0xa8,0xff,0x40,0x0a,0x01,0x32,0xcc,0xdf,0x10,0x8b,0x03,0x13,0xf8,
+0x59,0x01,0x11,0xc0,0x93,0x00,0x22,0x9e,0xfb,0x0f,0x00,0x26,0x9b,0x40,0xcb,0x01,
+0x21,0x10,0x45,0x28,0x04,0x51,0xc3,0x0d,0x65,0xf1,0x00,0x8e,0x05,0xd2,0x5f,0x1a,
+0x61,0x33,0x44,0x45,0x58,0xf8,0x66,0xb6,0x60,0xaf,0xff,0x01,0x00,0x63,0x02,0x43,
+0x21,0x00,0x03,0xf3,0x81,0x06,0x22,0x5f,0x30,0x4d,0x01,0x22,0xff,0xf4,0x7c,0x01,
+0x33,0x40,0x4f,0x70,0x62,0x03,0x11,0xcb,0x11,0x00,0x41,0xac,0x00,0x0e,0xd0,0x1d,
+0x02,0x32,0xfa,0x49,0xfb,0x53,0x02,0x33,0xef,0xdf,0x80,0x86,0x03,0x03,0x11,0x02,
+0x22,0x1b,0xf6,0x9d,0x04,0x23,0x9f,0xf6,0xb8,0x03,0x1b,0xa2,0x99,0x02,0x51,0x01,
+0x10,0x00,0x00,0x7c,0x19,0x03,0x13,0x80,0x04,0x01,0x00,0x09,0x00,0x1a,0x7e,0x09,
+0x00,0xf2,0x05,0x93,0x57,0x89,0xdf,0xde,0xf6,0x0c,0xce,0xff,0xff,0xff,0xdc,0xdf,
+0x87,0x73,0x0d,0xb9,0x7f,0x92,0x10,0x51,0x01,0x00,0x84,0x03,0x14,0x9c,0x09,0x00,
+0x12,0xab,0x09,0x00,0x33,0x03,0xa8,0xe9,0x09,0x00,0x30,0xbc,0xc2,0x00,0xd7,0x05,
+0x03,0x94,0x00,0x01,0x03,0x06,0x02,0x26,0x02,0x50,0xfb,0x65,0x66,0x78,0xa4,0x48,
+0x01,0x00,0xf8,0x00,0x12,0xe4,0x60,0x07,0x11,0x11,0x39,0x01,0x70,0x11,0x23,0x35,
+0x65,0x00,0x00,0x00,0x0c,0x01,0x91,0xe1,0x00,0x00,0x05,0x43,0x21,0x4e,0xd2,0x00,
+0x16,0x04,0x12,0xa0,0x66,0x02,0x11,0x70,0xb5,0x00,0x21,0xbe,0x40,0xd6,0x00,0xf2,
+0x02,0xef,0x77,0x89,0xbb,0xcd,0x8b,0xdf,0xff,0xff,0xff,0xc9,0x88,0x85,0xa9,0x74,
+0x21,0xbc,0xd6,0x02,0x13,0x9d,0x0d,0x03,0x12,0x60,0x9a,0x01,0x13,0xf4,0xbc,0x04,
+0x03,0x87,0x00,0x23,0xbf,0x71,0x08,0x00,0x12,0xfd,0x46,0x01,0x46,0x27,0xab,0xa0,
+0x00,0x80,0x07,0x23,0x6f,0x50,0xc8,0x01,0x13,0x10,0x2f,0x02,0x20,0x47,0xa5,0x8f,
+0x00,0x40,0xef,0xff,0xff,0xd4,0x71,0x07,0x32,0x78,0xf9,0x20,0x51,0x01,0x60,0xf4,
+0x00,0x23,0x45,0x43,0x20,0xf0,0x02,0xe3,0xcf,0xff,0xff,0xd0,0x00,0x0d,0xc0,0x00,
+0x22,0x10,0x12,0x30,0x00,0x1f,0x0c,0x05,0x00,0x0c,0x07,0x02,0xe4,0x06,0x20,0x08,
+0x60,0xd7,0x00,0x12,0xf9,0x06,0x01,0x21,0x08,0xf3,0x87,0x00,0x00,0xb8,0x01,0xf0,
+0x04,0x0c,0xf7,0x32,0x35,0x71,0x7f,0x70,0x00,0x01,0xbf,0xff,0xff,0xf2,0x16,0x10,
+0x00,0x00,0x01,0x24,0x87,0x02,0x10,0x09,0x1f,0x00,0x31,0x38,0x00,0x00,0xe6,0x04,
+0x30,0x5b,0x1e,0x40,0x48,0x01,0xf6,0x05,0x14,0x00,0x1e,0x56,0xd0,0x48,0x77,0x9f,
+0xde,0xfe,0x00,0x06,0xa0,0x10,0x6e,0xff,0xff,0xb8,0x53,0x00,0x0c,0x03,0x00,0x01,
+0x00,0x40,0xe9,0x00,0x4f,0xff,0x26,0x02,0x76,0x03,0xf5,0x00,0x27,0x65,0x56,0x72,
+0x11,0x04,0x24,0x00,0x0d,0xb2,0x05,0x42,0x2f,0x70,0x01,0x60,0x43,0x01,0x22,0x20,
+0x05,0xa5,0x03,0x13,0xed,0xc8,0x03,0xf0,0x04,0x05,0xf7,0x00,0x05,0xf8,0x00,0x00,
+0x22,0x00,0x0c,0xf1,0x00,0x00,0xbf,0xfe,0xff,0xf9,0x00,0x08,0xf6,0x04,0x30,0x68,
+0x87,0x62,0x6b,0x01,0xf3,0x05,0x46,0x75,0x20,0x00,0x00,0x38,0xcf,0xff,0xef,0xf9,
+0x00,0x8e,0xff,0xa6,0x20,0x00,0x8f,0x70,0x7b,0x50,0x16,0x08,0x06,0xd2,0x04,0x01,
+0xea,0x03,0x00,0x1f,0x07,0x01,0x50,0x00,0x00,0x22,0x07,0x40,0x24,0x69,0xef,0xc2,
+0xdf,0x05,0x11,0xfe,0x7f,0x03,0x14,0x23,0xa9,0x00,0x21,0x13,0x42,0xc0,0x01,0xf0,
+0x03,0x6a,0xef,0xff,0xff,0x91,0x00,0x03,0x7c,0xff,0xd9,0x53,0x24,0x8f,0xe1,0x05,
+0xff,0xd7,0x20,0x11,0x03,0x22,0xa0,0x09,0x36,0x01,0x14,0xbe,0x27,0x02,0x04,0xc5,
+0x00,0x13,0xaf,0x08,0x00,0x23,0x0e,0xd0,0xde,0x02,0x03,0xce,0x02,0x21,0x3c,0xfa,
+0x34,0x02,0x32,0x48,0xdf,0xf7,0x28,0x03,0x21,0xfd,0x60,0x10,0x00,0x24,0x96,0x41,
+0xdd,0x02,0x70,0x24,0x56,0x78,0x97,0x28,0x9b,0xce,0xe8,0x03,0x81,0xd9,0x3f,0xec,
+0xa8,0x64,0x4d,0xe6,0x10,0x18,0x00,0x13,0xdc,0x48,0x00,0x13,0xd1,0x1c,0x01,0x27,
+0x60,0x00,0xc4,0x04,0x00,0x2d,0x08,0x02,0x01,0x00,0x1a,0xcc,0x85,0x05,0x33,0x00,
+0x5f,0x80,0x13,0x09,0x13,0xf8,0x11,0x00,0x32,0xcf,0xe8,0x42,0x9f,0x05,0x23,0xdf,
+0xff,0xa2,0x08,0x13,0x45,0x78,0x00,0xf2,0x02,0x79,0x96,0x03,0x89,0xbc,0xef,0xff,
+0xff,0xff,0xed,0x70,0x5f,0xec,0xa8,0x64,0x5e,0xd5,0x20,0x00,0x61,0x1e,0xb0,0x00,
+0x06,0x20,0x00,0xbc,0x08,0x22,0xa2,0x8b,0x48,0x02,0x32,0x08,0xc0,0xe5,0x63,0x00,
+0x10,0x0e,0x00,0x02,0x23,0x0c,0xb0,0x51,0x08,0x13,0xea,0x63,0x00,0x24,0x0c,0xd0,
+0xa2,0x07,0x13,0x50,0xd5,0x00,0x14,0xdf,0x09,0x00,0x32,0xef,0xc6,0x20,0x09,0x00,
+0x42,0x8f,0xff,0xe0,0x00,0x97,0x02,0x52,0x75,0x00,0x00,0x04,0x60,0xdf,0x02,0x02,
+0x11,0x00,0x10,0xf6,0xef,0x04,0xf0,0x04,0x00,0x0d,0xd0,0x00,0x01,0x9f,0xc0,0x00,
+0x5f,0x50,0x08,0xff,0x80,0x00,0x00,0xdd,0x6e,0xf8,0x10,0x2b,0x0a,0x10,0xa1,0xba,
+0x00,0x20,0xfd,0x30,0x27,0x00,0x11,0xfa,0x2e,0x00,0x12,0xec,0xe6,0x00,0x02,0xda,
+0x04,0x02,0xf1,0x05,0x22,0x4f,0x70,0xe9,0x00,0x71,0xa4,0x21,0x22,0x35,0x85,0x01,
+0xaf,0xf4,0x06,0x50,0x00,0x04,0x56,0x65,0x53,0xa5,0x00,0x13,0x31,0x9b,0x00,0x13,
+0x3f,0xf6,0x02,0x33,0x06,0xf3,0x00,0x80,0x06,0xf1,0x07,0x59,0xa0,0x05,0x00,0x00,
+0x0f,0xff,0xff,0xff,0xc7,0x04,0xfd,0x50,0x00,0x56,0x68,0xf5,0x00,0x00,0x03,0xcf,
+0xb1,0xb2,0x02,0x10,0x01,0x64,0x03,0x20,0x2f,0x60,0x7d,0x02,0x11,0x20,0xd5,0x05,
+0x13,0x6f,0x3f,0x05,0x22,0x06,0xf0,0x15,0x0a,0x01,0xac,0x06,0x60,0x8f,0x60,0x02,
+0x9c,0xcc,0xf3,0xed,0x04,0x50,0x03,0xfc,0x77,0xbf,0xf9,0x6e,0x00,0x61,0xbb,0x00,
+0x03,0xfa,0xfe,0x30,0x23,0x01,0x30,0x6f,0x23,0xed,0xac,0x03,0x40,0xa6,0x8f,0xd0,
+0x01,0xbf,0x00,0x30,0x6c,0xfe,0xa2,0x44,0x00,0x19,0x40,0xae,0x01,0xf2,0x02,0x0d,
+0xa0,0x00,0x4b,0xa9,0x99,0xab,0x50,0xf7,0x00,0x03,0xde,0xee,0xee,0xd5,0x1f,0x50,
+0x0e,0x04,0x13,0xf2,0xcb,0x01,0x03,0xb2,0x00,0x03,0x10,0x07,0x13,0x7e,0x72,0x02,
+0x30,0xd1,0x70,0x02,0x08,0x00,0x40,0x8e,0x79,0x00,0xf5,0x04,0x01,0x40,0xfd,0x40,
+0x3f,0x30,0x69,0x00,0x32,0xe0,0x02,0xf7,0x26,0x01,0xe5,0x0b,0xfd,0xa9,0xab,0xdf,
+0x2f,0x70,0x00,0x06,0xac,0xdd,0xca,0x80,0x94,0x46,0x05,0x31,0x37,0x88,0x73,0x5d,
+0x00,0x50,0xcf,0xff,0xff,0xfb,0x10,0xe0,0x04,0xf0,0x01,0x52,0xf7,0x05,0xef,0x40,
+0x00,0x09,0xf8,0x00,0x4f,0x40,0x01,0xce,0x00,0x04,0xf8,0xcc,0x02,0x20,0x02,0xf9,
+0xda,0x02,0x10,0xbd,0xca,0x06,0x21,0x1f,0x80,0xb5,0x0a,0x60,0x8f,0x13,0xf5,0x00,
+0x03,0xf6,0x5d,0x07,0x21,0x3f,0x40,0x34,0x07,0x60,0x9f,0x01,0xf7,0x00,0x1f,0xa0,
+0xb6,0x03,0xb0,0x0c,0xd1,0x0a,0xf2,0x00,0x00,0x07,0xf6,0x00,0x4f,0xec,0x1b,0x01,
+0xa2,0xfc,0x00,0x00,0x6e,0xf8,0x00,0x01,0x5c,0xfb,0x10,0x0c,0x0a,0x13,0xd6,0xbf,
+0x00,0x10,0x20,0x0e,0x00,0x00,0xf1,0x01,0x12,0x59,0x07,0x0b,0x22,0x00,0x8f,0x8b,
+0x05,0x00,0x9c,0x07,0xb0,0x2f,0x40,0x01,0x22,0x11,0x8f,0x46,0x82,0x5f,0x10,0x06,
+0xb7,0x01,0xa3,0xe2,0x7f,0x00,0x01,0x44,0x55,0xaf,0x20,0x00,0x8d,0xbc,0x07,0x31,
+0x9b,0x00,0x00,0x7d,0x01,0x22,0xaa,0x00,0x74,0x01,0x40,0xba,0x34,0x00,0x00,0x75,
+0x0a,0xf0,0x15,0xbb,0x97,0x00,0x6d,0xff,0xff,0x50,0x00,0xad,0xf1,0x07,0xf7,0x33,
+0x8f,0xfb,0x20,0x9f,0xc0,0x0c,0x90,0x00,0x4f,0x7e,0xf4,0x7f,0x70,0x0b,0xd3,0x00,
+0xbf,0x10,0xb9,0x4f,0x40,0x02,0xef,0x05,0x0d,0x69,0x19,0x20,0x00,0x05,0x76,0x30,
+0x4e,0x06,0x23,0x5e,0xd3,0x11,0x02,0x22,0xef,0xf3,0xef,0x02,0x31,0xd1,0x2e,0xe1,
+0xc5,0x02,0x43,0xf3,0x00,0x3f,0xd1,0xb9,0x03,0x60,0x5f,0xb0,0x00,0x00,0x08,0xf9,
+0x83,0x00,0x41,0xa0,0x00,0x08,0xfc,0xdf,0x03,0x41,0x90,0x00,0x2d,0x20,0xb4,0x02,
 0x14,0x90,0x58,0x03,0x13,0x90,0xe3,0x02,0x05,0x09,0x00,0x1c,0xd6,0x52,0x09,0x13,
-0x29,0x08,0x00,0x30,0x75,0x1e,0x70,0x0e,0x00,0xf1,0x07,0x60,0x00,0x7e,0x15,0xf1,
-0x00,0x00,0x02,0xef,0xfa,0x00,0x0d,0x80,0x82,0x00,0x00,0x0d,0xe3,0x8f,0x80,0x04,
-0x60,0xe7,0x1f,0x02,0x2e,0x04,0x20,0x08,0xf7,0x70,0x20,0x00,0xf2,0x00,0x20,0xa0,
-0x00,0x7c,0x15,0x10,0x00,0xf9,0x16,0x00,0xa9,0x24,0x02,0xe3,0x27,0x65,0x00,0x3f,
-0xe2,0x00,0x00,0x30,0xbf,0x04,0x02,0x0c,0x06,0x01,0xae,0x12,0x09,0xa5,0x0f,0x16,
-0x40,0x2b,0x06,0x12,0xbd,0x8f,0x19,0xf3,0x04,0xac,0x00,0x13,0x20,0x0f,0xfd,0xdc,
-0xef,0xef,0xff,0x90,0x05,0x67,0x88,0xdd,0x65,0x42,0x10,0x00,0x0a,0x07,0x00,0x07,
-0x00,0xf1,0x01,0x12,0x40,0x6f,0xed,0xcc,0xef,0xef,0xff,0xf0,0x26,0x78,0x89,0xde,
-0x76,0x53,0x20,0xb6,0x07,0x05,0xa5,0x06,0xd0,0x01,0x7b,0xdd,0xef,0x30,0x00,0x00,
-0x0d,0xe8,0x66,0xcf,0xfc,0x50,0x83,0x01,0xf4,0x07,0x7f,0x3c,0xfc,0x20,0x6f,0x10,
-0x00,0xaf,0x00,0x4e,0xf2,0x1e,0xe9,0x8b,0xf9,0x00,0x02,0x90,0x01,0x8b,0xdb,0x70,
-0xfe,0x0c,0x02,0x38,0x00,0x22,0xde,0xef,0xc4,0x11,0x43,0x98,0x76,0xbf,0x20,0x17,
-0x05,0x03,0xbe,0x12,0x02,0x7c,0x28,0x02,0xec,0x1a,0x10,0x7d,0x6d,0x05,0xf1,0x0b,
-0x8f,0x81,0x00,0x08,0xe0,0x00,0x02,0xaf,0xff,0xff,0xfe,0x93,0x9d,0x00,0x03,0xfc,
-0x44,0xf6,0x15,0x8e,0xff,0xb0,0x01,0xea,0x00,0xae,0xff,0x03,0x11,0x5f,0x84,0x20,
-0x60,0x5f,0xaf,0xc8,0xe0,0x0b,0xf1,0x3e,0x0f,0x50,0x45,0x5f,0x9a,0xf7,0x00,0x6d,
-0x1a,0x72,0x00,0xaf,0xf8,0x00,0x00,0x09,0xf9,0xf0,0x0a,0x3a,0x4d,0xf8,0x00,0x65,
-0x18,0x18,0x00,0xea,0x09,0x04,0x06,0x0a,0x80,0x01,0x76,0x49,0xf8,0xbe,0x90,0x1d,
-0x80,0x65,0x16,0x93,0xeb,0x94,0x00,0x8f,0xa0,0x00,0x00,0x17,0xf0,0x6e,0x01,0x12,
-0x7f,0x12,0x07,0x21,0x08,0xff,0x33,0x00,0x33,0x20,0x06,0xe4,0x90,0x0c,0x13,0xd7,
-0xbe,0x0e,0x41,0x0f,0x50,0x1f,0x50,0x4c,0x01,0x11,0xda,0x4f,0x06,0x12,0xe9,0xd7,
-0x2b,0x00,0xc1,0x03,0x11,0x04,0xf0,0x07,0x12,0xfa,0x04,0x00,0x30,0x02,0xbf,0x60,
-0x5c,0x16,0x31,0xed,0xef,0xff,0x88,0x23,0x34,0x78,0x88,0x75,0xc4,0x11,0x10,0xb6,
-0x10,0x00,0x12,0xa1,0x48,0x14,0x00,0x89,0x11,0x21,0x04,0xf3,0x3b,0x0f,0x40,0x06,
-0xbd,0xff,0xc6,0x53,0x07,0x40,0xee,0xfa,0x7e,0xca,0x19,0x17,0xf0,0x16,0xbf,0x91,
-0x02,0xf5,0x02,0xde,0x10,0x00,0xaf,0xe9,0x00,0x8f,0x00,0x02,0xf8,0x00,0x5f,0x57,
-0xf1,0x0e,0xa0,0x00,0x0a,0xe0,0x0c,0xb0,0x1f,0x86,0xf3,0x00,0x00,0x7f,0x01,0xf4,
-0x00,0x8f,0xeb,0xd4,0x06,0xf0,0x07,0x4f,0x10,0x01,0xff,0x20,0x00,0x00,0xae,0x03,
-0xf3,0x00,0x6f,0xf9,0x00,0x00,0x1f,0xa0,0x1f,0xa3,0x8f,0x88,0xa0,0x63,0x29,0x10,
-0x6f,0x57,0x26,0xa2,0x6e,0xf5,0x00,0x00,0x24,0x10,0x00,0x2d,0xff,0xc2,0x7f,0x00,
-0x21,0x87,0x30,0xfd,0x03,0x03,0x20,0x01,0x02,0x7d,0x00,0x10,0x01,0x93,0x2d,0x00,
-0xf2,0x02,0x40,0xfc,0xac,0xf8,0x89,0x4f,0x07,0x53,0x58,0xbe,0xfe,0xdc,0x80,0x5a,
-0x11,0x16,0x00,0x17,0x09,0xf1,0x09,0x08,0x41,0x0f,0x60,0x00,0x10,0xad,0x00,0x1d,
-0xff,0xff,0xee,0xff,0x90,0x1e,0x90,0x00,0x02,0x7f,0x97,0x65,0x30,0x07,0xf1,0x9a,
-0x0c,0x00,0x4a,0x2e,0x01,0x07,0x0e,0x21,0x02,0xf6,0xf2,0x0c,0x01,0x93,0x0b,0x22,
-0x0e,0xd1,0x66,0x0a,0x60,0x05,0xff,0xca,0xcf,0xfc,0x10,0xfc,0x02,0x10,0xcd,0x11,
-0x0e,0x10,0x08,0xaa,0x2c,0x00,0x20,0x01,0x21,0xfe,0xb8,0x43,0x0f,0x64,0x69,0xcf,
-0x70,0x00,0x06,0x70,0x61,0x0e,0x03,0x11,0x05,0x03,0x78,0x00,0xf1,0x05,0x35,0x64,
-0x00,0x00,0x0f,0x61,0x9f,0xff,0xff,0xf7,0x00,0x2f,0xaf,0xc5,0x10,0x01,0x9f,0x60,
-0x5f,0xf6,0x1a,0x22,0x21,0x7f,0x60,0x77,0x07,0x13,0x04,0x64,0x18,0x06,0x79,0x09,
-0xe6,0x3a,0xfe,0x10,0x00,0x2e,0xdd,0xef,0xff,0x91,0x00,0x00,0x08,0x9a,0x98,0x9c,
-0x0f,0x00,0x95,0x00,0x00,0xa3,0x00,0xf0,0x03,0x3b,0xec,0x60,0x00,0x7f,0x07,0xfa,
-0x7b,0xf7,0x00,0x9d,0x5f,0x40,0x00,0x9f,0x20,0xbb,0xe4,0x8d,0x0c,0x80,0xcf,0xa0,
-0x00,0x00,0x0c,0xc0,0xdf,0x30,0xf3,0x04,0x11,0xee,0x27,0x08,0x11,0xeb,0xc9,0x0b,
-0x11,0xda,0x99,0x08,0x11,0x87,0x6c,0x2a,0x10,0x00,0xea,0x26,0x10,0x10,0xab,0x0a,
-0x00,0x72,0x05,0x10,0x17,0x60,0x01,0x11,0x6d,0x59,0x01,0x24,0x3b,0x62,0xc6,0x07,
-0x12,0x21,0x79,0x11,0x00,0xe5,0x06,0x42,0x38,0x76,0x55,0x5d,0x30,0x0a,0x22,0x1c,
-0xd2,0x3f,0x0d,0x12,0xb0,0xa7,0x06,0x12,0x80,0xb2,0x03,0x30,0xda,0xcc,0x93,0x47,
-0x05,0x42,0xfa,0x76,0x8d,0xfa,0xe1,0x18,0x50,0x06,0xf8,0x02,0xde,0x40,0x75,0x00,
-0x50,0xf0,0x8e,0x30,0x01,0x42,0xab,0x00,0xe0,0x20,0x09,0xfe,0xfb,0x10,0x06,0xf0,
-0x00,0x03,0xf4,0x02,0xdc,0x00,0xcd,0x68,0x01,0x91,0x04,0xf4,0xaf,0x30,0x00,0x00,
-0xcf,0xb8,0x9f,0x4e,0x1a,0x39,0x7b,0xdc,0x96,0xe9,0x02,0x04,0xcb,0x09,0x03,0xfc,
-0x0c,0x02,0xf2,0x02,0xa0,0x13,0x10,0x00,0x00,0x38,0x9b,0xef,0x60,0x4c,0xff,0xd2,
-0x04,0x61,0xdb,0xde,0x19,0xf9,0x44,0xde,0x93,0x0b,0x22,0xce,0x30,0x46,0x08,0x22,
-0xdf,0xd1,0xf8,0x02,0x32,0x07,0xfc,0x10,0xec,0x03,0x20,0x3f,0xf8,0xc3,0x06,0x00,
-0x9d,0x03,0x00,0x8b,0x11,0x10,0xd9,0xb0,0x2e,0x30,0xe7,0x00,0x00,0x98,0x11,0x20,
-0x6f,0x60,0x09,0x00,0x10,0xf6,0x91,0x05,0x11,0xe8,0xec,0x1c,0x30,0x94,0x01,0x00,
-0x2d,0x00,0x32,0xfe,0xae,0xf3,0x10,0x12,0x5a,0x6f,0xeb,0x20,0x00,0x00,0x95,0x00,
-0x06,0x9f,0x0d,0x06,0x98,0x00,0x03,0x96,0x0d,0x00,0x97,0x00,0x92,0x00,0x34,0x20,
-0x00,0x05,0xfd,0xad,0xe0,0x3a,0xf0,0x14,0x60,0xab,0x9f,0xb5,0x21,0x4b,0xf7,0x4d,
-0x28,0x11,0x40,0x28,0x2f,0x00,0x95,0x00,0x00,0xf6,0x08,0x12,0x03,0x98,0x1d,0x11,
-0xf8,0x94,0x00,0x00,0x3f,0x03,0x31,0xaf,0x2e,0x70,0xa6,0x0a,0x02,0x93,0x00,0x40,
-0x05,0xfa,0x09,0xb0,0xa6,0x02,0x30,0x19,0xfd,0x00,0x92,0x00,0x50,0x07,0xcf,0xf8,
-0x00,0x00,0x90,0x31,0x48,0x8c,0x72,0x00,0x00,0x91,0x00,0x04,0x18,0x01,0x02,0xb3,
-0x08,0x00,0xb5,0x02,0x70,0x23,0x50,0x00,0x0a,0xdc,0xcd,0xfe,0xb3,0x01,0x72,0x05,
-0x89,0x9f,0xc8,0x76,0x42,0x10,0x6b,0x0f,0x02,0xd3,0x12,0xf0,0x05,0x13,0x00,0x00,
-0x01,0x83,0x00,0x0a,0xfc,0xff,0xf6,0x02,0x9f,0xf6,0x00,0x7f,0xd5,0x10,0xaf,0xbf,
-0xc6,0x14,0x27,0x30,0x02,0xbf,0xb3,0x30,0x02,0x40,0x00,0x6f,0xcf,0x30,0x56,0x00,
-0x42,0x08,0xf6,0x2f,0x30,0x64,0x02,0x22,0x2f,0x30,0x9e,0x09,0x27,0x16,0x10,0xbc,
-0x0e,0xe1,0x00,0x2e,0xea,0x87,0x89,0xbd,0x60,0x00,0x00,0x02,0x8c,0xde,0xdd,0xca,
-0xc6,0x08,0x14,0xb3,0x3f,0x06,0x1a,0x20,0x11,0x1e,0x13,0x0d,0x44,0x09,0x01,0x6b,
-0x25,0x06,0xe9,0x08,0x01,0xcd,0x31,0x02,0x14,0x03,0x32,0xca,0xff,0x80,0x59,0x07,
-0x12,0x96,0x3c,0x00,0xa0,0xef,0x40,0x03,0xf5,0x00,0x00,0x21,0x00,0x6f,0x70,0x5a,
-0x10,0x40,0x09,0xc0,0x0e,0xc0,0xfc,0x0d,0x41,0x01,0xf8,0x05,0xf5,0x58,0x0c,0x20,
-0xaf,0x20,0xa8,0x08,0x50,0xfc,0x12,0x9f,0x70,0x3f,0x24,0x2e,0x00,0x14,0x09,0x10,
-0x53,0x31,0x01,0x50,0x87,0x20,0x00,0x45,0x44,0x01,0x00,0x12,0x40,0xd1,0x0d,0x20,
-0xf3,0x11,0x01,0x00,0x61,0x3f,0xa0,0x00,0x00,0x05,0xa0,0xe7,0x30,0x41,0x08,0xf0,
-0x1c,0xf3,0x3d,0x05,0x21,0xbf,0x40,0xc6,0x0e,0x11,0x02,0x7e,0x00,0x13,0x90,0xdd,
-0x1b,0x01,0xee,0x02,0x12,0xec,0x81,0x0e,0x12,0xf2,0x8c,0x06,0x02,0xa1,0x00,0x02,
-0xda,0x08,0x21,0x69,0x88,0x01,0x00,0x30,0x91,0xaf,0xfe,0x62,0x1a,0x23,0xef,0xf7,
-0x53,0x0a,0x12,0xc0,0x61,0x0b,0x21,0xcf,0x20,0xf9,0x0f,0x12,0x0b,0xc3,0x12,0x10,
-0x01,0xec,0x06,0x00,0xc5,0x48,0x19,0xe3,0xc2,0x0a,0x13,0xeb,0xa3,0x01,0x13,0xf7,
-0x01,0x0b,0x04,0x0e,0x09,0x03,0xa7,0x12,0x12,0xfd,0x24,0x09,0x22,0xdf,0xc1,0x17,
-0x00,0x17,0x86,0x6f,0x02,0x02,0x9c,0x0b,0x21,0x0a,0xf8,0x91,0x11,0x11,0xf7,0x88,
-0x01,0x11,0xe4,0xfa,0x0a,0x11,0xc1,0x91,0x16,0x10,0xf8,0xb7,0x03,0x98,0xb3,0x0f,
-0x80,0x00,0x04,0xd7,0x10,0x00,0xf8,0x71,0x0d,0x09,0x0d,0x00,0x02,0xdf,0x14,0x00,
-0xd4,0x33,0x03,0x92,0x01,0x13,0x50,0x89,0x01,0x12,0xd0,0x55,0x06,0x12,0xfc,0xb9,
-0x10,0x00,0x39,0x04,0x03,0xb0,0x31,0x00,0x15,0x34,0x11,0xff,0x84,0x0f,0x31,0x7d,
-0xfd,0xcf,0xdd,0x29,0x30,0xfc,0x40,0x8f,0x16,0x02,0x12,0xe8,0x6a,0x03,0x17,0x03,
-0xb8,0x0b,0x0e,0x08,0x00,0x08,0x0f,0x11,0x06,0x08,0x00,0x02,0x78,0x10,0x04,0x96,
-0x0c,0x27,0x09,0xf2,0x03,0x13,0x11,0x10,0x76,0x0c,0x22,0x10,0x7f,0x8f,0x0f,0x82,
-0x77,0xf6,0x55,0x55,0x55,0x55,0x59,0xf6,0x63,0x03,0x42,0x8f,0x26,0xf1,0x00,0x27,
-0x05,0x01,0x5e,0x1c,0x31,0xfa,0x06,0xe1,0x07,0x01,0x18,0x40,0x9c,0x0c,0x00,0xdf,
-0x31,0x03,0xe9,0x15,0x00,0x9c,0x13,0x11,0xfb,0x50,0x01,0x31,0x9f,0xf9,0x00,0x1f,
-0x20,0x12,0xc3,0xa1,0x03,0x18,0x20,0x23,0x21,0x02,0x9c,0x1a,0x76,0x02,0x77,0x66,
-0xbf,0x76,0x67,0x71,0x79,0x0e,0x0f,0x07,0x00,0x0d,0x82,0x16,0x65,0x55,0xaf,0x65,
-0x55,0x66,0x3f,0xa8,0x00,0x21,0x01,0x11,0x01,0x00,0x21,0x04,0x98,0x21,0x02,0xa8,
-0x92,0x00,0x6f,0xfe,0xee,0xff,0xfe,0xee,0xff,0x40,0x45,0x0d,0x03,0xe2,0x13,0x0f,
-0x11,0x00,0x1e,0x93,0x58,0x88,0x88,0x8c,0xf8,0x88,0x88,0x89,0x28,0xa3,0x10,0x19,
-0xf3,0x92,0x15,0x12,0xb4,0xa3,0x05,0x12,0xf4,0x07,0x00,0x41,0xf5,0x00,0x00,0x2f,
-0x25,0x00,0x80,0xf5,0x17,0x66,0x66,0x6e,0xf9,0x66,0x72,0x45,0x00,0x11,0xf5,0x11,
-0x01,0x21,0xf6,0xf6,0x52,0x00,0x20,0x80,0xf6,0xbc,0x05,0x30,0xf7,0x00,0xf6,0x6c,
-0x36,0x10,0x40,0x07,0x00,0x21,0x6f,0xb2,0x95,0x15,0x51,0x03,0x00,0x05,0x55,0xf7,
-0x78,0x06,0x2a,0xff,0xe2,0xf5,0x15,0x14,0xd7,0x7d,0x14,0x04,0x09,0x09,0x10,0xf7,
-0xa9,0x12,0x87,0x76,0x66,0x66,0x6f,0xb6,0x67,0x80,0x09,0x7f,0x20,0x33,0x01,0xef,
-0x80,0x76,0x0f,0x13,0xf8,0xe3,0x0f,0x22,0x3e,0x80,0x08,0x00,0x21,0x50,0xe9,0x4a,
-0x00,0x21,0xdf,0x50,0x6b,0x03,0x00,0xb3,0x1c,0x00,0x11,0x00,0x31,0x2b,0xfc,0x10,
-0x7c,0x03,0x22,0x1e,0xf7,0x1f,0x35,0x26,0x00,0x32,0x4d,0x09,0x23,0x3f,0xff,0x23,
-0x03,0x22,0x77,0x85,0xdb,0x00,0x1a,0xf9,0x46,0x10,0x01,0x0f,0x20,0x82,0x77,0x66,
-0x7f,0xb6,0x66,0x67,0x50,0x9f,0x83,0x00,0x11,0x30,0xe3,0x04,0x22,0x06,0xf2,0x1c,
-0x09,0x00,0x33,0x02,0x12,0xbc,0x95,0x05,0x12,0x1f,0x5b,0x11,0x21,0x07,0xf2,0xb8,
-0x12,0x10,0x01,0x84,0x03,0x11,0xcb,0xe4,0x34,0x00,0x7e,0x00,0x20,0x8f,0x80,0x8f,
-0x03,0x00,0x11,0x20,0xb0,0x16,0x44,0xbf,0x30,0x9f,0xa0,0x00,0x02,0xff,0xff,0xa0,
-0xf1,0x03,0x16,0x02,0xaf,0x1c,0x10,0x35,0x2a,0x03,0x52,0xb2,0x00,0x06,0x73,0xf1,
-0xfe,0x01,0x32,0x3f,0x2a,0xa0,0x5a,0x00,0xa3,0x98,0x12,0x04,0x43,0x33,0x9f,0x33,
-0x33,0x35,0x00,0xa8,0x1c,0xa3,0xfb,0x00,0x04,0x33,0x33,0xcc,0x33,0x33,0x3d,0xa0,
-0x58,0x04,0x12,0xda,0x91,0x05,0x02,0x64,0x04,0x00,0x3a,0x05,0x13,0xf8,0x15,0x10,
-0x22,0x0f,0x60,0x27,0x34,0x23,0x02,0xf5,0x88,0x31,0x21,0x5f,0x30,0x21,0x0b,0x00,
-0xbd,0x00,0xd0,0x01,0xcf,0x70,0x00,0x22,0x12,0xec,0x00,0x01,0xef,0x70,0x00,0x0a,
-0x0b,0x0c,0x69,0x04,0x50,0x00,0x00,0x36,0x67,0xec,0x0b,0x04,0x29,0x1a,0x25,0x09,
-0xf0,0x7d,0x0a,0xf4,0x08,0x25,0x92,0x00,0x00,0x01,0x38,0xfc,0xdf,0xff,0xf4,0x00,
-0xad,0xef,0xff,0xfe,0x97,0x42,0x00,0x00,0xac,0x96,0x41,0xcc,0x85,0x03,0x15,0x00,
-0x8d,0x16,0x11,0x14,0x0f,0x20,0xf0,0x01,0xa9,0xcf,0xff,0xf0,0x35,0x7a,0xcf,0xff,
-0xfd,0xb8,0x63,0x10,0xdf,0xfd,0xa8,0x5d,0xc8,0x04,0x16,0x43,0x51,0x00,0x23,0x06,
-0xf2,0xe5,0x16,0x04,0xe3,0x18,0x13,0xfa,0x08,0x00,0x13,0xb8,0x17,0x08,0x04,0xe2,
-0x10,0x1a,0xe0,0x9d,0x0f,0x51,0xdf,0x76,0x66,0x67,0x70,0x95,0x05,0x01,0x7b,0x1c,
-0x21,0x6f,0x80,0xcb,0x08,0x22,0x06,0xfa,0x86,0x2a,0x21,0x8f,0xb0,0xd3,0x07,0x01,
-0xc2,0x0f,0x41,0x01,0xfc,0x00,0x02,0xcc,0x10,0x19,0xf2,0x42,0x00,0x23,0x03,0xfd,
-0x0f,0x00,0x12,0xe2,0x0e,0x03,0x12,0xfd,0x01,0x15,0x22,0xef,0xb1,0xc4,0x1e,0x12,
-0xd4,0xb8,0x03,0x18,0xb5,0x0d,0x01,0x11,0x2c,0x56,0x04,0x52,0x20,0x00,0x3e,0x1c,
-0x80,0x44,0x34,0x50,0x0a,0x92,0xd0,0x00,0x00,0xc7,0x2d,0x20,0x03,0xa0,0xa3,0x05,
-0x01,0xbb,0x24,0x00,0x99,0x06,0x40,0x65,0x55,0x55,0xaf,0x7f,0x36,0x01,0xe5,0x36,
-0x03,0x05,0x17,0x00,0x5b,0x02,0x22,0x3d,0xf5,0x1e,0x12,0x30,0x00,0x5d,0x30,0x7d,
-0x02,0x03,0x23,0x0a,0x02,0x19,0x09,0x04,0x98,0x2c,0x01,0x40,0x03,0x13,0xa0,0xd8,
-0x13,0x13,0xfa,0x25,0x01,0x03,0xf3,0x02,0x33,0x17,0xdf,0xd4,0x9c,0x08,0x19,0xd6,
-0x2e,0x0c,0x09,0xeb,0x13,0x14,0xf8,0x3d,0x34,0x1a,0x60,0x25,0x14,0x20,0x01,0xfd,
-0xd3,0x1e,0x43,0x77,0x30,0x00,0x9f,0xb0,0x1d,0x20,0x4f,0xa0,0x71,0x16,0x42,0x01,
-0x00,0x2e,0xe1,0xff,0x15,0x22,0x2e,0xf4,0x97,0x01,0x23,0x04,0xe5,0x60,0x36,0x01,
-0x22,0x03,0x0b,0x6b,0x14,0x03,0x44,0x10,0x00,0x0d,0x30,0x02,0x47,0x01,0x22,0xef,
-0x40,0x0b,0x05,0x04,0x6b,0x1b,0x29,0x08,0x20,0xd7,0x03,0x01,0xe9,0x12,0x63,0x30,
-0x00,0x00,0x4b,0x1e,0x50,0xb1,0x26,0x24,0xe6,0x5e,0xbf,0x36,0x23,0xb0,0x10,0x60,
-0x00,0x00,0xa7,0x1d,0x14,0x0a,0xe2,0x03,0xb0,0x04,0xfa,0x66,0x66,0xbf,0x76,0x66,
-0x70,0x00,0x01,0xee,0xd1,0x09,0x02,0xa2,0x26,0x03,0xa6,0x11,0x00,0x49,0x01,0x23,
-0x0f,0xa0,0x2c,0x07,0x02,0xb1,0x37,0x03,0x64,0x1a,0x03,0xf4,0x00,0x04,0x73,0x06,
-0x23,0x1e,0xe1,0x09,0x00,0x14,0x1d,0x0d,0x08,0x24,0x6e,0xf6,0xd3,0x0c,0x1f,0xe4,
-0xbd,0x17,0x03,0x20,0xbf,0xfe,0x6f,0x07,0x88,0xf1,0x79,0x99,0x99,0x99,0x99,0x9d,
-0xf0,0xfe,0x0c,0x0f,0x07,0x00,0x19,0x01,0x9c,0x05,0x22,0x8c,0xf0,0xcd,0x00,0x27,
-0xf0,0x10,0x64,0x1b,0x53,0x01,0x20,0x00,0x00,0xc8,0x11,0x0c,0x23,0x0e,0x90,0x32,
-0x07,0x13,0xe9,0x6c,0x04,0x03,0x11,0x00,0x13,0xdf,0xe8,0x04,0x9a,0x57,0x87,0x7f,
-0xc7,0x77,0x77,0xfc,0x77,0x83,0x22,0x00,0x13,0xf7,0x33,0x00,0x01,0xca,0x12,0x20,
-0x0f,0xa0,0x58,0x12,0x02,0x4e,0x03,0x04,0x3b,0x13,0x13,0x1f,0x39,0x02,0x13,0x1c,
-0xbf,0x05,0x23,0x3d,0xf5,0xdc,0x00,0x13,0xf5,0x66,0x03,0x1c,0x81,0xf6,0x00,0x71,
-0x52,0x00,0x00,0x16,0x33,0x2a,0x50,0x56,0x0d,0x51,0x03,0xf6,0x7a,0x4c,0x00,0xb7,
-0x1b,0x41,0x2f,0x61,0xf1,0xa0,0x03,0x09,0xf3,0x08,0x02,0xf5,0x04,0x00,0x00,0x98,
-0x78,0xfb,0x77,0x77,0x9f,0xa7,0x88,0x10,0x0f,0xfe,0xff,0xfe,0xee,0xef,0xff,0xef,
-0xf2,0x26,0x00,0x13,0x50,0x81,0x15,0x02,0x7d,0x15,0x00,0x13,0x00,0x03,0xab,0x1d,
-0x13,0x70,0xd8,0x03,0x26,0x01,0xb5,0x95,0x08,0x05,0x9d,0x00,0x02,0xfd,0x39,0x05,
-0x68,0x08,0x00,0x01,0x00,0x24,0x6d,0xfa,0x08,0x13,0x2b,0xe6,0x00,0x5d,0x28,0x04,
-0xfe,0x0e,0x13,0xf7,0x51,0x02,0x23,0xbf,0xd2,0x8a,0x04,0x13,0xe8,0x95,0x0a,0x11,
-0x10,0xfa,0x08,0x02,0x56,0x09,0x42,0xb0,0x4d,0xfb,0x20,0xeb,0x03,0x21,0x7f,0xc0,
-0x88,0x06,0x00,0x65,0x1c,0x02,0xd6,0x26,0x00,0x9c,0x04,0x12,0xb0,0x56,0x03,0x12,
-0xf9,0x55,0x03,0x02,0xd8,0x28,0x11,0x17,0xc2,0x14,0x42,0x02,0x7b,0xff,0xd6,0xbe,
-0x07,0x12,0xb5,0x29,0x01,0x1c,0x50,0x29,0x01,0x11,0x03,0xb6,0x06,0xc0,0x70,0x00,
-0x02,0xfc,0x30,0x00,0x03,0xe1,0x4f,0x20,0x00,0x05,0x3f,0x2d,0xb2,0xa0,0xaa,0x00,
-0x00,0x01,0xaf,0x50,0x00,0x2f,0x21,0x10,0x95,0x02,0x42,0x10,0x00,0x0c,0xa1,0x00,
-0x08,0x33,0x00,0x8f,0xf7,0xb9,0x04,0x23,0x2c,0xf8,0x15,0x11,0x23,0x06,0x10,0x15,
-0x11,0x00,0x10,0x00,0x13,0xfa,0xab,0x01,0x13,0xf8,0x31,0x05,0x12,0xe4,0x96,0x00,
-0x02,0x96,0x09,0x41,0x15,0x9e,0xfe,0x70,0xb4,0x14,0x22,0xff,0xc5,0x1f,0x00,0x14,
-0x66,0x7f,0x0b,0x60,0x48,0x77,0x77,0x77,0x77,0x86,0xc5,0x0a,0x02,0xe8,0x25,0x01,
-0x22,0x05,0x14,0x05,0xba,0x1a,0x1b,0xbe,0x43,0x38,0x14,0x1e,0x4c,0x15,0x03,0x11,
-0x02,0x04,0x0b,0x01,0x13,0x06,0xa4,0x29,0x21,0x08,0xfa,0x34,0x22,0x00,0x6d,0x1e,
-0x01,0x91,0x00,0x30,0x5e,0xf7,0x00,0x19,0x26,0x30,0x05,0xcf,0xd3,0x8d,0x01,0x11,
-0xf7,0x21,0x39,0x01,0xc0,0x3b,0x1e,0x10,0xfa,0x29,0x01,0xea,0x15,0x14,0x3d,0x14,
-0x12,0x23,0x0b,0x90,0x36,0x15,0x22,0x82,0xb0,0xc7,0x02,0xba,0xfa,0x40,0x00,0x00,
-0x89,0x88,0x88,0x88,0x8d,0xf5,0x00,0xa0,0x0b,0x03,0x03,0x0b,0x05,0x05,0x0b,0x06,
-0xa1,0x0a,0x01,0xc7,0x05,0x11,0x00,0x83,0x27,0x13,0xa0,0x2b,0x00,0x23,0xb9,0xfa,
-0xa8,0x00,0x02,0xd4,0x05,0x60,0x02,0xbf,0x90,0x00,0x08,0xfb,0x02,0x05,0x10,0xf7,
-0xd1,0x01,0x41,0xa0,0x00,0x2e,0xfc,0xf1,0x01,0x32,0xf6,0x00,0x07,0x02,0x02,0x10,
-0x90,0x90,0x09,0x1a,0x60,0x28,0x1b,0x26,0x1f,0x70,0x5b,0x08,0xf2,0x0f,0x26,0xa4,
-0x00,0x00,0x0f,0x82,0x69,0xcf,0xff,0xfa,0x01,0x36,0x9f,0xff,0xfe,0xb7,0x4a,0xf1,
-0x9f,0xff,0xef,0xb4,0x10,0x00,0x3f,0x70,0x58,0x41,0x1f,0x70,0x34,0x16,0x20,0x0f,
-0x70,0x07,0x2c,0x01,0x08,0x00,0x22,0x6f,0x40,0x08,0x00,0x18,0x02,0x9b,0x08,0x04,
-0x1e,0x08,0x60,0x0e,0xe5,0x22,0x23,0x46,0x91,0xae,0x00,0x00,0x8a,0x24,0x00,0x24,
-0x02,0x35,0x55,0x44,0x32,0x30,0x02,0x00,0xaf,0x00,0x10,0x36,0x5a,0x11,0x23,0x0d,
-0x70,0xd1,0x3b,0x23,0xc8,0x3d,0xd7,0x09,0x24,0x03,0x90,0x55,0x17,0x12,0x36,0xea,
-0x09,0x21,0x36,0x9c,0x90,0x20,0xd0,0x3a,0xfd,0xff,0xfd,0xa7,0xfd,0x00,0x00,0xbd,
-0xff,0xff,0xa7,0x41,0xb7,0x0c,0x83,0x0d,0xb7,0x48,0xf1,0x00,0x00,0x2f,0x90,0x10,
-0x0a,0x23,0x1d,0xd0,0x8e,0x17,0x24,0x0c,0xf2,0x23,0x0a,0x18,0x34,0xa1,0x17,0x07,
-0xd2,0x18,0x81,0x00,0x06,0xf7,0x00,0x00,0x01,0x34,0x00,0x98,0x06,0x41,0xee,0xef,
-0xff,0xb0,0x57,0x01,0x72,0x89,0x98,0x87,0x52,0x00,0x00,0x07,0xb7,0x12,0x22,0x05,
-0xf9,0xd2,0x0a,0x22,0x0c,0xf3,0xfa,0x08,0x22,0x2f,0xc0,0x9c,0x01,0x21,0x9f,0x50,
-0x78,0x05,0x22,0x01,0xfd,0xf4,0x27,0x25,0x04,0x10,0x1e,0x0f,0x33,0x1f,0xb0,0x00,
-0xe8,0x13,0x01,0xd8,0x04,0x12,0xf8,0x07,0x00,0x12,0xfb,0x56,0x03,0x12,0xfc,0x67,
-0x05,0x12,0xf9,0x6b,0x03,0x1a,0xe5,0xab,0x2a,0x07,0x3e,0x02,0x23,0x06,0x25,0x06,
-0x0c,0x22,0xc0,0xc8,0xdd,0x07,0x31,0xe5,0x37,0x9e,0x71,0x1d,0x11,0x92,0x8b,0x3b,
-0x00,0xd7,0x05,0x22,0x0b,0xf3,0xb1,0x0b,0x23,0x02,0xfc,0x37,0x02,0x20,0x9f,0x50,
-0x27,0x29,0x73,0x00,0x00,0x1d,0x40,0x00,0x00,0x9f,0xd5,0x1c,0x03,0x40,0x03,0x04,
-0xd7,0x07,0x01,0xe4,0x33,0x02,0x44,0x15,0x01,0x43,0x07,0x12,0xd1,0xb3,0x07,0x13,
-0xfc,0x30,0x11,0x12,0x80,0x1e,0x00,0x15,0xb3,0x58,0x0f,0x13,0x50,0x1c,0x02,0x13,
-0xc0,0x1c,0x04,0x23,0x30,0x00,0xd4,0x2a,0x01,0x63,0x19,0xa1,0x1e,0xd6,0x66,0x66,
-0x6c,0xf2,0x00,0x00,0xce,0x20,0x37,0x29,0x21,0x0c,0xf4,0x51,0x07,0xf0,0x00,0x03,
-0xdf,0x40,0x78,0x10,0x00,0xce,0x00,0x1e,0xd2,0x00,0x9f,0xe6,0x06,0xf6,0x57,0x1b,
-0x43,0x02,0xcf,0xde,0xc0,0x4f,0x04,0x12,0xb0,0x90,0x00,0x22,0xfc,0xfd,0xd4,0x14,
-0x21,0x70,0x66,0x18,0x03,0x12,0xf5,0x1a,0x1e,0x21,0xfd,0x30,0xcd,0x0e,0x38,0xfe,
-0x60,0x00,0x3d,0x2a,0x0b,0xf9,0x20,0x20,0x2e,0x10,0x0c,0x05,0x53,0x30,0x00,0x3f,
-0x1b,0xa0,0x61,0x08,0xb3,0xa2,0xc0,0x00,0x00,0x06,0xfa,0x44,0x44,0x58,0xa0,0x00,
-0x75,0x0b,0x22,0xc0,0x00,0x96,0x00,0x22,0x5f,0x70,0x4f,0x3f,0x00,0xda,0x35,0x41,
-0x01,0xbf,0x50,0x10,0x04,0x30,0xe3,0x4e,0xe4,0x06,0xf9,0x10,0x09,0xf3,0x00,0x00,
-0x5c,0x20,0x01,0x9f,0xe6,0xf8,0x26,0x20,0x02,0xcf,0xe9,0x41,0x02,0xde,0x04,0x04,
-0x1e,0x1b,0x12,0x8c,0x83,0x05,0x32,0x2d,0xf7,0x00,0x07,0x18,0x03,0xe4,0x2d,0x33,
-0x28,0xef,0xb2,0x0f,0x01,0x1f,0xc4,0x61,0x08,0x02,0x80,0x45,0x00,0x00,0x02,0x23,
-0x35,0x67,0xad,0x79,0x2f,0x00,0x70,0x14,0x20,0x96,0x30,0x67,0x25,0x15,0x10,0xba,
-0x3c,0x01,0x81,0x0b,0x04,0xec,0x0e,0x20,0x28,0x87,0xc3,0x06,0xb2,0x77,0x88,0x34,
-0xfe,0xee,0xee,0xef,0xfe,0xee,0xee,0xf5,0xe4,0x2d,0x03,0xa1,0x04,0x13,0x50,0x8e,
-0x07,0x13,0xf2,0x0c,0x04,0x14,0xfb,0x06,0x1a,0x13,0x40,0x08,0x00,0x03,0x4d,0x2e,
-0x23,0xef,0x90,0x4e,0x26,0x14,0x50,0xaa,0x22,0x50,0x50,0x00,0x03,0x10,0x5d,0x67,
-0x1c,0x20,0x0c,0xe0,0x10,0x35,0xf0,0x04,0x00,0x1f,0x90,0x0c,0xc0,0x01,0xf7,0x00,
-0x5f,0x40,0x06,0xf3,0x00,0x72,0x00,0xbe,0x00,0x01,0xa2,0x11,0x38,0x08,0x36,0x0a,
-0x26,0x9f,0x50,0xb0,0x02,0x30,0x02,0xcf,0x80,0x06,0x00,0x02,0x2b,0x1d,0x22,0x1e,
-0xfa,0x8a,0x0e,0x1b,0x20,0xee,0x00,0x00,0x07,0x09,0x41,0x05,0x30,0x0c,0xa0,0x45,
-0x09,0x10,0xde,0x63,0x01,0x10,0xdc,0x58,0x0a,0x50,0x03,0xf7,0x00,0x08,0xf2,0xe0,
-0x35,0x20,0x0c,0xd0,0xfd,0x06,0x11,0xbe,0x05,0x30,0x10,0x10,0xa0,0x03,0x27,0x01,
-0x61,0x4d,0x23,0x04,0x26,0x1e,0x24,0x01,0xde,0xaa,0x10,0x22,0x40,0x00,0x9a,0x0c,
-0x18,0x60,0x7a,0x06,0x42,0x00,0x5d,0xfd,0x30,0x1f,0x00,0x04,0x30,0x00,0x1b,0x71,
-0x11,0x02,0x01,0x46,0x22,0x00,0xa0,0x39,0x10,0x77,0x01,0x00,0x1e,0x20,0x32,0x02,
-0x21,0x43,0x33,0x01,0x00,0x14,0x32,0x9f,0x2d,0x97,0x70,0x44,0x33,0x33,0x3d,0xd3,
-0x33,0x33,0x42,0x06,0x10,0x05,0x88,0x0f,0x2b,0x04,0xf6,0x69,0x1b,0x14,0x5f,0x65,
-0x05,0x12,0xd1,0x7f,0x00,0x23,0xbf,0xc2,0x94,0x01,0x19,0x80,0x96,0x02,0x04,0x51,
-0x04,0x23,0x0d,0x70,0xa4,0x07,0x40,0x73,0xf1,0x00,0x3f,0xd4,0x01,0x50,0xd3,0xf1,
-0x72,0x00,0x18,0x9a,0x00,0x1a,0x60,0x67,0x25,0x0a,0x90,0x0a,0x24,0x00,0x7f,0xbd,
-0x0d,0xa3,0x36,0x66,0x66,0x68,0xfa,0x66,0x66,0x67,0x00,0x00,0x3a,0x37,0x09,0xcf,
-0x16,0x05,0x8b,0x24,0x14,0x0f,0x41,0x1e,0x02,0xb7,0x01,0x06,0x33,0x07,0x33,0x02,
-0xcf,0xb0,0xca,0x00,0x0c,0x26,0x08,0x21,0xae,0x10,0xfd,0x13,0x05,0x81,0x0c,0x17,
-0x09,0x0b,0x00,0x21,0xfa,0x50,0x36,0x1c,0xe0,0xf9,0x40,0x00,0x09,0xf0,0x5b,0xff,
-0xd7,0x00,0x9f,0x00,0x01,0x8e,0xfe,0x21,0x00,0x2d,0x06,0x80,0x2c,0x00,0x22,0xf0,
-0x00,0x51,0x03,0x04,0x01,0x08,0x50,0x14,0x30,0x00,0x00,0x04,0xe0,0x01,0x80,0x15,
-0x0d,0x90,0x1f,0x80,0x00,0x2f,0x43,0xe6,0x32,0x30,0x08,0xd0,0x85,0x02,0x06,0x13,
-0xa1,0x59,0x01,0x30,0x0f,0xfe,0x83,0x06,0x00,0xf0,0x03,0xcc,0xff,0xd7,0x10,0x00,
-0x0f,0x80,0x28,0xef,0xfa,0x20,0x0f,0x80,0x00,0x05,0xcf,0x60,0x0f,0x40,0x39,0x03,
-0x2c,0x06,0x26,0x0f,0x80,0x90,0x06,0x01,0x25,0x37,0x03,0xd4,0x05,0x08,0x7f,0x1c,
-0x2c,0x0c,0xd0,0x11,0x00,0x10,0xc0,0x9f,0x08,0x83,0x77,0x77,0x77,0xee,0x77,0x77,
-0x77,0x42,0x45,0x01,0x01,0x2b,0x02,0x03,0xd9,0x1c,0x03,0x0b,0x0b,0x06,0xb7,0x0e,
-0x05,0xd8,0x1e,0x14,0x0c,0x5e,0x0d,0x13,0xf9,0x31,0x01,0x13,0xfd,0xf6,0x04,0x03,
-0xf6,0x18,0x23,0x09,0xfc,0x4d,0x02,0x01,0x7c,0x2a,0x03,0x82,0x0b,0x00,0xf3,0x18,
-0x02,0xf0,0x2f,0xaf,0x50,0x00,0x48,0x87,0x77,0x77,0x77,0x88,0x30,0x00,0x01,0x00,
-0x24,0x21,0x2f,0xfe,0x1f,0x2d,0x32,0xfe,0x2c,0xbb,0x01,0x00,0x2e,0x00,0x00,0x47,
-0x1c,0x11,0x02,0x8f,0x02,0x70,0x16,0x55,0x55,0x6f,0x95,0x55,0x60,0x10,0x0f,0x02,
-0x3f,0x0d,0x10,0x02,0xe3,0x10,0x23,0x6f,0xc0,0x26,0x04,0x13,0xc0,0xdd,0x05,0x12,
-0xc1,0xe8,0x00,0x23,0xaf,0xa0,0x10,0x0d,0x20,0x90,0x25,0x0f,0x00,0xf2,0x0a,0x7e,
-0xfc,0xf5,0x0a,0xfc,0x30,0x01,0x7c,0xff,0xb3,0x2f,0x50,0x06,0xef,0x80,0x1f,0xd7,
-0x20,0x02,0xf5,0x00,0x01,0xaf,0x40,0x10,0x9c,0x0a,0x21,0x30,0x00,0x2c,0x1f,0x03,
-0x77,0x00,0x13,0x60,0x9d,0x03,0x1c,0xc5,0xad,0x00,0x28,0x0c,0xd1,0xf6,0x24,0x18,
-0x5f,0x59,0x1d,0x28,0x02,0xf9,0xa0,0x08,0x26,0x3f,0x90,0xaf,0x0d,0x00,0x73,0x08,
-0x03,0xd6,0x1a,0x00,0xc5,0x09,0x12,0xfa,0xd8,0x03,0x11,0x80,0xc2,0x09,0x11,0xe4,
-0x56,0x00,0x1d,0xf9,0x33,0x09,0x13,0x01,0xb7,0x19,0x23,0x0c,0xd0,0x08,0x02,0x23,
-0x5f,0x60,0x0a,0x03,0x13,0xed,0x88,0x11,0x23,0x07,0xf4,0xf1,0x06,0x00,0x6a,0x07,
-0x00,0x78,0x2a,0x01,0xee,0x06,0x22,0x7f,0x30,0x91,0x3c,0x22,0x0e,0xe0,0xd3,0x04,
-0x23,0x06,0xf6,0x92,0x12,0x21,0xde,0x00,0xa2,0x12,0x03,0x30,0x21,0x42,0x0d,0xf0,
-0x2f,0xd0,0xfc,0x06,0x22,0x52,0x93,0xeb,0x00,0x13,0x92,0x79,0x00,0x14,0x15,0x4e,
-0x1b,0x03,0xab,0x47,0x02,0x5a,0x27,0x71,0x0a,0x40,0x01,0xb7,0x06,0xd0,0x40,0x2d,
-0x0a,0x32,0xcf,0x10,0x10,0x05,0x17,0x02,0x39,0x0a,0x10,0xaf,0x00,0x13,0x03,0x44,
-0x04,0x24,0x06,0xf6,0x3c,0x04,0x14,0xec,0xa6,0x03,0x23,0x8f,0x30,0x8b,0x44,0x23,
-0x2f,0x90,0x57,0x3e,0x00,0x69,0x05,0x13,0xed,0xf0,0x24,0x23,0x08,0xf6,0xa0,0x07,
-0x22,0x2f,0xc0,0xab,0x0f,0x04,0x81,0x15,0x2e,0x8d,0x20,0x1d,0x04,0x03,0xa8,0x02,
-0x23,0xed,0x90,0x99,0x00,0xb1,0x10,0xd2,0x00,0x00,0x09,0x40,0x01,0xa6,0x0d,0x42,
-0xe1,0x2b,0x02,0x4a,0xce,0x03,0xcc,0x50,0x99,0x00,0x15,0x0d,0x99,0x00,0x14,0xf5,
-0x99,0x00,0x14,0xfc,0x99,0x00,0x12,0x9f,0xaf,0x07,0x02,0x57,0x0e,0x0b,0x99,0x00,
-0x1f,0xf4,0x99,0x00,0x07,0x1c,0x8c,0x99,0x00,0x20,0x60,0x01,0x12,0x00,0x31,0x19,
-0x0d,0x70,0x1c,0x13,0x31,0xc8,0x3f,0x18,0xde,0x09,0x21,0xf1,0x40,0xe4,0x1a,0x10,
-0x42,0x95,0x11,0x00,0xe2,0x03,0xb1,0x00,0x7f,0x00,0x04,0x9e,0xfd,0x71,0x00,0x07,
-0xf8,0xbf,0x01,0x21,0x37,0x7f,0xfc,0x83,0x54,0x1f,0x29,0x00,0x7f,0xb1,0x17,0x05,
-0x0f,0x00,0x13,0xf1,0xab,0x03,0x83,0xa3,0x10,0x11,0x23,0x57,0x30,0x00,0xcf,0xc2,
-0x10,0x5a,0x35,0x77,0x76,0x65,0x43,0x2a,0x09,0x31,0x01,0xdc,0xd2,0xcc,0x14,0x40,
-0x86,0x06,0x98,0xf1,0x3a,0x00,0x31,0x91,0x97,0x7f,0x82,0x10,0x10,0xd9,0x53,0x00,
-0x20,0x16,0xdf,0x80,0x00,0xa1,0x15,0xbf,0xfc,0x60,0x00,0x07,0xf9,0xcf,0xfd,0x82,
-0x80,0x00,0x18,0x72,0x62,0x00,0x0f,0x80,0x00,0x22,0x21,0x29,0x87,0x60,0x0c,0x19,
-0x03,0x06,0x14,0x19,0xcf,0x99,0x05,0x04,0x48,0x06,0x01,0x28,0x05,0x05,0xc7,0x10,
-0x03,0x15,0x0a,0x01,0x82,0x11,0x02,0xab,0x32,0x01,0x56,0x11,0x11,0x10,0xe9,0x06,
-0x01,0x86,0x09,0x13,0x28,0xcc,0x16,0x1d,0xde,0x85,0x0e,0x06,0x27,0x03,0x23,0x47,
-0x0e,0x2b,0x07,0x32,0xf2,0x5e,0x00,0x3d,0x0f,0x34,0x90,0x71,0x8f,0xf4,0x12,0x01,
-0x9b,0x00,0x2a,0x7f,0xc0,0x65,0x07,0x04,0x9a,0x15,0x04,0xca,0x1a,0x03,0xbb,0x3f,
-0x08,0x20,0x18,0x04,0xf7,0x2f,0x03,0x14,0x10,0x23,0x4e,0xf3,0x50,0x21,0x12,0xe3,
-0xa9,0x0d,0x22,0xef,0xc1,0x48,0x00,0x13,0xfd,0x1d,0x03,0x19,0x74,0x01,0x1d,0x13,
-0xc8,0xa2,0x02,0x22,0xa1,0xa6,0x12,0x1e,0x32,0x95,0x05,0x99,0x1c,0x01,0x30,0xd7,
-0xd4,0x58,0x90,0x00,0x48,0x78,0xfd,0x73,0x00,0x9d,0x1a,0x01,0x5a,0x1d,0x09,0x96,
-0x10,0x04,0x19,0x00,0x2a,0x0d,0xf2,0x95,0x05,0x10,0x03,0xce,0x32,0x07,0x8b,0x1e,
-0x22,0x19,0xfe,0x62,0x1c,0x32,0x8f,0xfb,0x10,0xd8,0x31,0x13,0xd5,0x51,0x00,0x0e,
-0x87,0x05,0x24,0x4e,0xc3,0x82,0x1f,0x13,0xf4,0xef,0x10,0x23,0x2d,0xf4,0x85,0x01,
-0x22,0x1d,0xf4,0x07,0x3d,0x00,0x72,0x43,0x02,0xde,0x1d,0x22,0x2e,0xf3,0x82,0x1f,
-0x00,0xfd,0x1e,0x27,0x1c,0x10,0xf1,0x07,0x04,0xc8,0x26,0x02,0x4a,0x0d,0x02,0x01,
-0x00,0x1c,0xb4,0xf7,0x0e,0x03,0x19,0x00,0x20,0x85,0x1e,0x63,0x48,0x62,0x95,0x00,
-0x06,0xe1,0x5f,0x10,0x80,0x1f,0x91,0x90,0x71,0x00,0x00,0xde,0x38,0xfb,0x00,0x34,
-0x7f,0x1f,0x23,0x06,0xfb,0xb9,0x25,0x23,0x07,0xfa,0x10,0x1e,0x10,0x08,0xfe,0x43,
-0x12,0xd0,0x78,0x09,0x02,0x13,0x03,0x23,0x0b,0xf7,0x4d,0x08,0x14,0x0d,0x95,0x05,
-0x2c,0x2e,0xf4,0xf3,0x46,0x13,0x30,0x24,0x01,0x13,0xb9,0x10,0x00,0x20,0x5c,0x49,
-0x81,0x00,0x60,0x39,0x40,0x00,0x95,0x01,0xe0,0x9f,0x0b,0x40,0xf8,0x00,0x6b,0x28,
-0xb8,0x39,0x60,0xd2,0x9f,0x90,0x08,0xda,0x10,0xe5,0x01,0x02,0x1e,0x08,0x22,0x0a,
-0xf5,0xce,0x47,0x01,0x6a,0x15,0x23,0x0a,0xf7,0x97,0x0c,0x00,0x31,0x12,0x11,0x09,
-0xf7,0x01,0x00,0x52,0x37,0x11,0x20,0x5a,0x02,0x14,0xef,0x4f,0x01,0x00,0x0c,0x20,
-0x0a,0x31,0x1a,0x02,0x7e,0x00,0x1b,0xc7,0x38,0x09,0x02,0xaa,0x11,0xf7,0x02,0x88,
-0x77,0x77,0x7f,0xc7,0x77,0x78,0x81,0x0d,0xfe,0xee,0xee,0xff,0xee,0xee,0xef,0x20,
-0x09,0x0e,0x03,0xfe,0x18,0x61,0x19,0x20,0x0f,0x80,0x04,0x80,0x2f,0x06,0x10,0xf8,
-0x42,0x28,0x20,0x04,0xf8,0x22,0x00,0x40,0xbf,0x20,0x01,0xed,0x22,0x00,0x50,0x01,
-0xfb,0x01,0xcf,0x20,0x11,0x00,0x41,0x07,0xf5,0x1b,0x40,0x33,0x00,0x26,0x0b,0x30,
-0x44,0x00,0x33,0x0d,0xef,0xf6,0x2b,0x32,0x08,0x8f,0x19,0x11,0x24,0xc2,0x36,0x42,
-0x10,0x08,0x73,0xf1,0xba,0x03,0x32,0x3f,0x29,0xb0,0xe4,0x0d,0xa1,0x96,0x12,0x26,
-0x55,0x55,0x5a,0xf6,0x55,0x55,0x54,0x7d,0x0e,0x02,0xc0,0x40,0x30,0x11,0x18,0xf2,
-0xdc,0x62,0x05,0x06,0x0e,0x10,0x04,0x62,0x1e,0x11,0x51,0x2d,0x05,0x40,0x7f,0x10,
-0x1e,0xc0,0x1f,0x05,0x20,0x07,0xf1,0x39,0x0c,0x20,0x5f,0x80,0x22,0x00,0x40,0xaf,
-0x10,0x2f,0xc0,0x55,0x00,0x41,0x02,0xfa,0x09,0xe1,0x33,0x00,0x35,0x08,0xc0,0x01,
-0x20,0x04,0x33,0x04,0xa9,0xdf,0x7e,0x25,0x2e,0xdd,0x70,0xa7,0x03,0x31,0x01,0xdd,
-0xc1,0x14,0x03,0x41,0x00,0x87,0x07,0x80,0x6f,0x00,0x32,0x08,0x70,0x87,0xa2,0x00,
-0x50,0x1b,0xeb,0x12,0x65,0x55,0xb5,0x18,0x52,0x55,0x40,0x5f,0xff,0xff,0xef,0x2a,
-0x52,0x11,0x11,0x11,0x8f,0x21,0x8c,0x31,0x03,0x5e,0x00,0x60,0x43,0x00,0x7f,0x10,
-0x05,0x10,0xff,0x26,0x41,0x07,0xf1,0x01,0xec,0xec,0x0d,0x21,0x7f,0x10,0xa2,0x26,
-0x00,0x22,0x00,0x41,0x0a,0xf2,0x02,0xfc,0x91,0x00,0x41,0x2f,0xc0,0x9e,0x10,0x33,
-0x00,0x35,0x8d,0x10,0x10,0xdb,0x0e,0x13,0x4a,0x9d,0x13,0x38,0x03,0xcd,0xd7,0x43,
-0x06,0x13,0x00,0x08,0x01,0x31,0xe4,0x08,0x87,0x97,0x03,0x23,0xff,0x20,0xda,0x02,
-0x13,0x70,0x06,0x04,0x03,0x3c,0x0a,0x00,0x83,0x42,0x20,0x01,0xa2,0x16,0x03,0x00,
-0x80,0x1b,0x41,0xf5,0x00,0x2d,0xf3,0x1f,0x02,0x42,0xf7,0x4e,0xe3,0x00,0x98,0x18,
-0x03,0x60,0x12,0x02,0x18,0x11,0x08,0x07,0x26,0x2c,0x0c,0xf7,0x54,0x14,0x11,0x27,
-0x88,0x00,0x12,0x30,0xba,0x06,0x30,0xff,0xda,0x73,0x8f,0x00,0x52,0x47,0xad,0xff,
-0xfb,0x71,0xc3,0x11,0x03,0xf0,0x03,0x14,0x20,0x83,0x1a,0x30,0xbf,0xfc,0x96,0x95,
-0x00,0x61,0x25,0x8b,0xef,0xfe,0x94,0x00,0x75,0x12,0x17,0xfe,0x5c,0x12,0x01,0xeb,
-0x03,0x21,0xa7,0x41,0x7c,0x00,0x40,0xef,0xff,0xd9,0x51,0x4d,0x00,0x51,0x48,0xbf,
-0xff,0xc7,0x10,0xf6,0x11,0x22,0xdf,0xa0,0x2a,0x00,0x01,0x0b,0x24,0x29,0x30,0x00,
-0x03,0x0f,0x2b,0x00,0x6f,0x03,0x05,0x2b,0x00,0xfa,0x6a,0x11,0x17,0x0a,0x19,0x00,
-0x13,0x59,0x19,0x00,0x23,0x07,0xf5,0x19,0x00,0x01,0xea,0x07,0x13,0xfa,0xa9,0x04,
-0x20,0x5f,0x50,0xa8,0x0c,0xa0,0x10,0x01,0x2c,0xf6,0x79,0xbc,0xef,0xff,0xf9,0x08,
-0xdc,0x26,0x78,0xb9,0x75,0x3c,0xf1,0x39,0x75,0x32,0x7f,0x17,0x38,0x00,0x71,0x00,
-0x39,0x0d,0x00,0x5a,0x1f,0x03,0x9f,0x4c,0x12,0x60,0x99,0x07,0x22,0x6f,0xd2,0x66,
-0x4b,0x22,0x5e,0xf7,0x65,0x37,0x42,0x1b,0xfb,0x2e,0xd0,0xd6,0x04,0x18,0xf5,0x56,
-0x3c,0x41,0x06,0xfd,0xef,0x70,0x8f,0x12,0x30,0x12,0xef,0x90,0x07,0x00,0x80,0x20,
-0x01,0xdf,0x90,0x00,0x0a,0xfd,0x20,0x00,0x27,0x11,0x5e,0xa2,0x43,0x23,0x80,0x8f,
-0xed,0x0b,0x13,0x61,0x2e,0x05,0x01,0x9a,0x35,0x22,0x64,0x00,0x00,0x36,0x17,0xf9,
-0xd2,0x06,0x0a,0x08,0x00,0x02,0x39,0x02,0x05,0x17,0x02,0x9f,0xf0,0x77,0x66,0x6b,
-0xf7,0x66,0x66,0x66,0x70,0x30,0x00,0x05,0x06,0xb8,0x07,0x72,0x05,0xfd,0x75,0x67,
-0x78,0x40,0x00,0x0d,0x0b,0x12,0x60,0x7b,0x4c,0x00,0xba,0x29,0x19,0x63,0xfe,0x11,
-0x00,0x1a,0x24,0xf0,0x06,0x03,0x68,0x10,0x00,0x06,0xf4,0x69,0xcf,0xff,0xf2,0x05,
-0x7a,0xdf,0xfe,0xb7,0x43,0xf8,0x00,0xee,0xb8,0xea,0x85,0x4b,0x10,0x01,0x52,0x30,
-0x21,0xaf,0x20,0x70,0x19,0x02,0xc6,0x0c,0x35,0xf7,0x01,0x40,0xd4,0x0b,0x06,0x85,
-0x1b,0x2a,0x03,0xf5,0xc9,0x0b,0x19,0x75,0x7c,0x05,0x2b,0x2d,0x80,0xc9,0x1e,0x20,
-0x09,0xf1,0x61,0x02,0xf2,0x10,0x90,0x00,0x00,0x5f,0x51,0x47,0xbe,0xff,0xff,0x20,
-0x02,0x59,0xff,0xff,0xeb,0x85,0x5f,0x80,0x9f,0xff,0xee,0xf5,0x20,0x00,0x0d,0xd0,
-0x05,0x95,0x20,0x7f,0x20,0xec,0x13,0x00,0xab,0x0e,0x02,0x2e,0x46,0x33,0xb0,0x08,
-0xf8,0xf6,0x0d,0x1a,0x15,0xee,0x04,0x14,0x2f,0x5f,0x00,0x1c,0xdd,0x82,0x0d,0x03,
-0x04,0x0b,0x01,0xbf,0x15,0x00,0x22,0x07,0x40,0x77,0x77,0x77,0x84,0xdf,0x0a,0x02,
-0x71,0x14,0x07,0x92,0x00,0x03,0x23,0x05,0x29,0x01,0xf7,0xd5,0x0f,0x25,0x06,0xf3,
-0x99,0x1d,0x10,0x19,0x01,0x14,0x32,0xf8,0x88,0x22,0x10,0x0c,0x30,0xf4,0x00,0x1a,
-0x5e,0x17,0x41,0xb7,0x00,0x00,0x02,0x6d,0x17,0x04,0x96,0x02,0x1b,0xed,0xfa,0x0d,
-0x1c,0x02,0xc4,0x18,0x06,0x73,0x28,0x1a,0x10,0xea,0x02,0x00,0x89,0x00,0x10,0x3a,
-0x54,0x00,0x61,0x9f,0xd9,0x9a,0x84,0xff,0xee,0x01,0x00,0x15,0xfc,0x41,0x01,0x10,
-0x05,0xd8,0x1d,0x25,0x53,0x0e,0x38,0x0d,0x28,0x00,0xe8,0x06,0x00,0x11,0x07,0x18,
-0x00,0x10,0x03,0x4f,0x02,0x09,0x1e,0x00,0x01,0x82,0x0c,0x21,0xe8,0x1f,0x1e,0x00,
-0x10,0x05,0xe7,0x1f,0x30,0xf8,0x07,0x77,0x25,0x00,0x23,0x74,0x0e,0xd0,0x04,0x08,
-0x07,0x21,0x0b,0x07,0x00,0x11,0x06,0x84,0x00,0x21,0xfa,0x03,0xa2,0x1d,0x0f,0x2a,
-0x00,0x0a,0x12,0x3f,0x4d,0x00,0x11,0x18,0xae,0x04,0x23,0xfa,0x00,0x17,0x05,0x12,
-0x11,0xad,0x2d,0x13,0x0d,0x0c,0x19,0x10,0x56,0xc1,0x00,0x0c,0x2c,0x12,0x12,0x05,
-0x21,0x20,0x21,0x80,0x7e,0xee,0x00,0x28,0xff,0x40,0x5d,0x15,0x13,0x03,0x8a,0x01,
-0x01,0x72,0x4c,0x00,0x75,0x22,0x08,0xfc,0x04,0x35,0x8f,0xc1,0x00,0x38,0x49,0x10,
-0x03,0x8c,0x26,0x00,0x01,0x04,0x05,0xba,0x2b,0x20,0x05,0x3b,0x54,0x01,0x20,0xfb,
-0xbe,0x34,0x02,0x20,0xaa,0xe0,0xa3,0x00,0x1a,0xae,0x0b,0x00,0x11,0x0f,0x0b,0x00,
-0x20,0xf9,0xbe,0xbc,0x0c,0x14,0x7b,0xfd,0x46,0x02,0x92,0x01,0x23,0x2f,0xb0,0xcd,
-0x20,0x30,0x01,0x7f,0xe3,0xdc,0x03,0x10,0xc1,0xcd,0x14,0x01,0x99,0x00,0x12,0x22,
-0xb3,0x04,0x00,0x61,0x04,0x03,0xe5,0x02,0x14,0xea,0x7d,0x1d,0x14,0xea,0x13,0x21,
-0x1d,0xe9,0x09,0x00,0x13,0xf8,0x09,0x00,0x23,0x01,0xf7,0x09,0x00,0x20,0x02,0xf5,
-0x09,0x00,0x20,0x01,0x20,0x0a,0x02,0x11,0x0e,0x99,0x53,0x20,0x0c,0xe0,0x09,0x00,
-0x20,0xbf,0x60,0x3b,0x08,0x41,0x0e,0x90,0x1b,0xf7,0x3c,0x4a,0x41,0x0e,0xa5,0xef,
-0x60,0x9a,0x0d,0x32,0x0e,0xff,0xd3,0xe5,0x41,0x01,0x38,0x18,0x14,0x03,0xab,0x04,
-0x19,0x12,0xba,0x0a,0x2f,0x9f,0x00,0x07,0x00,0x13,0x31,0x04,0xb0,0x9f,0x30,0x08,
-0x21,0xd1,0x9f,0xb2,0x04,0x20,0x10,0x9f,0x8a,0x0e,0x10,0xc1,0x1c,0x00,0x90,0x7e,
-0xf8,0x00,0x00,0x9f,0x02,0x7e,0xfc,0x30,0x2f,0x41,0x11,0xfc,0x34,0x04,0x29,0xd8,
-0x20,0xd2,0x05,0x02,0x20,0x03,0x02,0x84,0x04,0x30,0xf7,0x1f,0xc8,0xb9,0x01,0x32,
-0x9f,0x70,0xf7,0xdc,0x00,0x02,0x50,0x16,0x1f,0x1f,0x0f,0x00,0x1a,0x21,0x71,0xfb,
-0x0c,0x12,0x13,0xf7,0xf2,0x11,0x00,0xc7,0x49,0x03,0x6a,0x52,0x01,0x0c,0x07,0x11,
-0x34,0x98,0x22,0x32,0x54,0x08,0xff,0xe4,0x1b,0x20,0x8f,0x32,0x2e,0x3c,0x32,0x9f,
-0x38,0xf1,0x05,0x06,0x02,0x76,0x04,0x32,0xdd,0x08,0xf1,0x74,0x04,0x01,0x0f,0x00,
-0x20,0x06,0xf6,0xec,0x0c,0x00,0x82,0x49,0x08,0x42,0x1b,0x03,0x40,0x1b,0x02,0x56,
-0x0a,0x03,0xc5,0x14,0x31,0x04,0xcf,0xe3,0xfe,0x06,0x03,0x45,0x14,0x12,0x37,0x3b,
-0x13,0x14,0xb2,0xc5,0x0a,0x13,0x40,0x13,0x3b,0x18,0xf7,0xd5,0x29,0x12,0x80,0x0a,
-0x27,0x14,0x03,0xd9,0x32,0x23,0xe1,0x00,0xab,0x1f,0x09,0x00,0x1a,0x03,0xd7,0x0f,
-0x22,0x2d,0xf9,0x05,0x07,0x02,0x75,0x05,0x30,0x28,0xff,0xb2,0x46,0x07,0x31,0x9d,
+0x29,0x08,0x00,0x30,0x75,0x1e,0x70,0x0e,0x00,0xf1,0x05,0x60,0x00,0x7e,0x15,0xf1,
+0x00,0x00,0x02,0xef,0xfa,0x00,0x0d,0x80,0x82,0x00,0x00,0x0d,0xe3,0x8f,0x80,0x0a,
+0x03,0x22,0xbf,0x40,0x2e,0x04,0x60,0x08,0xf7,0x00,0x00,0xcf,0x40,0xf2,0x00,0x90,
+0xa0,0x00,0x00,0x1d,0xf3,0x00,0x00,0x06,0xfd,0xb0,0x03,0x51,0xee,0x20,0x00,0x09,
+0xf2,0xb3,0x00,0x45,0xe2,0x00,0x00,0x30,0xbf,0x04,0x02,0x0c,0x06,0x23,0xe2,0x00,
+0x67,0x01,0x14,0xf8,0x76,0x00,0x16,0x40,0x2b,0x06,0x10,0xbd,0x97,0x00,0x00,0x85,
+0x07,0xf3,0x02,0x13,0x20,0x0f,0xfd,0xdc,0xef,0xef,0xff,0x90,0x05,0x67,0x88,0xdd,
+0x65,0x42,0x10,0x00,0x0a,0x07,0x00,0x07,0x00,0xf1,0x01,0x12,0x40,0x6f,0xed,0xcc,
+0xef,0xef,0xff,0xf0,0x26,0x78,0x89,0xde,0x76,0x53,0x20,0xb6,0x07,0x05,0xa5,0x06,
+0xd0,0x01,0x7b,0xdd,0xef,0x30,0x00,0x00,0x0d,0xe8,0x66,0xcf,0xfc,0x50,0x83,0x01,
+0xf4,0x07,0x7f,0x3c,0xfc,0x20,0x6f,0x10,0x00,0xaf,0x00,0x4e,0xf2,0x1e,0xe9,0x8b,
+0xf9,0x00,0x02,0x90,0x01,0x8b,0xdb,0x70,0xfe,0x0c,0x02,0x38,0x00,0x31,0xde,0xef,
+0xf9,0x94,0x00,0x43,0x98,0x76,0xbf,0x20,0x17,0x05,0x13,0xa0,0x25,0x0a,0x04,0x7f,
+0x03,0x40,0xdb,0x00,0x00,0x7d,0x6d,0x05,0xf1,0x0b,0x8f,0x81,0x00,0x08,0xe0,0x00,
+0x02,0xaf,0xff,0xff,0xfe,0x93,0x9d,0x00,0x03,0xfc,0x44,0xf6,0x15,0x8e,0xff,0xb0,
+0x01,0xea,0x00,0xae,0xff,0x03,0xf2,0x11,0x5f,0x00,0x2f,0x70,0x00,0x00,0x5f,0xaf,
+0xc8,0xe0,0x0b,0xf1,0x00,0x00,0x0d,0xd0,0x45,0x5f,0x9a,0xf7,0x00,0x00,0x08,0xf4,
+0x00,0x00,0xaf,0xf8,0x00,0x00,0x09,0xf9,0xf0,0x0a,0x23,0x4d,0xf8,0x5c,0x04,0x19,
+0xc4,0x80,0x01,0x04,0x4a,0x0a,0x03,0x06,0x0a,0xf3,0x06,0x01,0x76,0x49,0xf8,0xbe,
+0x90,0x1d,0x80,0x00,0x1f,0xff,0xff,0xeb,0x94,0x00,0x8f,0xa0,0x00,0x00,0x17,0xf0,
+0x6e,0x01,0x12,0x7f,0x12,0x07,0x21,0x08,0xff,0x33,0x00,0x33,0x20,0x06,0xe4,0x90,
+0x0c,0x13,0xd7,0xbe,0x0e,0x41,0x0f,0x50,0x1f,0x50,0x4c,0x01,0x31,0xda,0x07,0xf1,
+0xcd,0x06,0x32,0x06,0xff,0xf9,0xc1,0x03,0x11,0x04,0xf0,0x07,0x12,0xfa,0x04,0x00,
+0x10,0x02,0x32,0x0c,0xf0,0x01,0x0a,0xff,0xed,0xef,0xff,0x90,0x00,0x00,0x00,0x03,
+0x78,0x88,0x75,0x10,0x00,0x00,0x10,0x00,0x01,0x00,0xf0,0x03,0xb6,0x00,0x00,0x00,
+0x03,0xa1,0x00,0x00,0x1f,0x70,0x00,0x00,0x00,0x4f,0x40,0x00,0x04,0xf3,0x16,0x00,
+0xf1,0x55,0xe8,0x06,0xbd,0xff,0xc6,0x10,0x00,0x00,0x09,0xee,0xfa,0x7e,0xca,0xfd,
+0x20,0x00,0x00,0xbf,0x91,0x02,0xf5,0x02,0xde,0x10,0x00,0xaf,0xe9,0x00,0x8f,0x00,
+0x02,0xf8,0x00,0x5f,0x57,0xf1,0x0e,0xa0,0x00,0x0a,0xe0,0x0c,0xb0,0x1f,0x86,0xf3,
+0x00,0x00,0x7f,0x01,0xf4,0x00,0x8f,0xeb,0x00,0x00,0x07,0xf1,0x4f,0x10,0x01,0xff,
+0x20,0x00,0x00,0xae,0x03,0xf3,0x00,0x6f,0xf9,0x00,0x00,0x1f,0xa0,0x1f,0xa3,0x8f,
+0x88,0xa0,0x00,0x0c,0xf2,0x00,0x6f,0xff,0x70,0x00,0x00,0x6e,0xf5,0x00,0x00,0x24,
+0x10,0x00,0x2d,0xff,0xc2,0x00,0x01,0x00,0x30,0x87,0x30,0x00,0x81,0x00,0x12,0xc4,
+0x0e,0x00,0x02,0x7d,0x00,0x40,0x01,0x00,0x06,0xf1,0x08,0x00,0xe0,0x0a,0xfc,0xac,
+0xf8,0x89,0x80,0x00,0x00,0x02,0x58,0xbe,0xfe,0xdc,0x80,0x12,0x00,0x22,0x0b,0xa0,
+0x28,0x00,0x11,0x0e,0x0e,0x00,0xf0,0x14,0x08,0x41,0x0f,0x60,0x00,0x10,0xad,0x00,
+0x1d,0xff,0xff,0xee,0xff,0x90,0x1e,0x90,0x00,0x02,0x7f,0x97,0x65,0x30,0x07,0xf1,
+0x00,0x00,0x4f,0x20,0x00,0x00,0x02,0xf5,0x00,0x00,0x5f,0x08,0x00,0xf1,0x16,0xf6,
+0x00,0x00,0x3f,0x50,0x00,0x00,0x07,0xf3,0x00,0x00,0x0e,0xd1,0x00,0x00,0x7f,0xc0,
+0x00,0x00,0x05,0xff,0xca,0xcf,0xfc,0x10,0x00,0x00,0x00,0x29,0xcd,0xb9,0x30,0x00,
+0x00,0x08,0x84,0x10,0x70,0x00,0xe1,0xff,0xfe,0xb8,0x40,0x00,0x00,0x00,0x02,0x69,
+0xcf,0x70,0x00,0x06,0x70,0x6a,0x00,0x21,0x0b,0xd0,0x07,0x00,0x24,0x0d,0xa0,0x78,
+0x00,0xf0,0x0c,0x35,0x64,0x00,0x00,0x0f,0x61,0x9f,0xff,0xff,0xf7,0x00,0x2f,0xaf,
+0xc5,0x10,0x01,0x9f,0x60,0x5f,0xf6,0x00,0x00,0x00,0x0c,0xe0,0x7f,0x60,0x93,0x00,
+0x21,0xf1,0x04,0x36,0x00,0x11,0xf0,0x2f,0x00,0x11,0x5f,0x36,0x00,0xf4,0x01,0x3a,
+0xfe,0x10,0x00,0x2e,0xdd,0xef,0xff,0x91,0x00,0x00,0x08,0x9a,0x98,0x51,0x00,0x01,
+0x00,0x00,0x95,0x00,0x00,0xa3,0x00,0xf0,0x1b,0x3b,0xec,0x60,0x00,0x7f,0x07,0xfa,
+0x7b,0xf7,0x00,0x9d,0x5f,0x40,0x00,0x9f,0x20,0xbb,0xe4,0x00,0x00,0x1f,0x80,0xcf,
+0xa0,0x00,0x00,0x0c,0xc0,0xdf,0x30,0x00,0x00,0x0a,0xe0,0xee,0x00,0x00,0x00,0x09,
+0xf0,0xeb,0x00,0x0c,0x00,0x10,0xda,0x8e,0x00,0x20,0xc0,0x87,0x40,0x00,0x01,0x05,
+0x01,0x10,0xde,0xbb,0x00,0x60,0x1b,0xf5,0x00,0x00,0x00,0x17,0x60,0x01,0x11,0x6d,
+0x59,0x01,0x23,0x3b,0x62,0x64,0x00,0xf1,0x02,0x01,0x21,0x00,0x00,0x06,0xee,0xff,
+0xff,0xff,0xe0,0x00,0x00,0x38,0x76,0x55,0x5d,0xe4,0x16,0x00,0x21,0x1c,0xd2,0x07,
+0x00,0x21,0x2e,0xb0,0x07,0x00,0x21,0x4f,0x80,0x07,0x00,0xf0,0x08,0x6f,0xda,0xcc,
+0x93,0x00,0x00,0x00,0x9f,0xfa,0x76,0x8d,0xfa,0x00,0x00,0xbf,0x80,0x00,0x00,0x06,
+0xf8,0x02,0xde,0x40,0x75,0x00,0x50,0xf0,0x8e,0x30,0x01,0x42,0xab,0x00,0xe0,0x20,
+0x09,0xfe,0xfb,0x10,0x06,0xf0,0x00,0x03,0xf4,0x02,0xdc,0x00,0xcd,0x68,0x01,0xa0,
+0x04,0xf4,0xaf,0x30,0x00,0x00,0xcf,0xb8,0x9f,0xfe,0xce,0x00,0x48,0x7b,0xdc,0x96,
+0x00,0x01,0x00,0x23,0x7f,0x30,0x09,0x00,0x24,0x6f,0x10,0x12,0x00,0xf0,0x07,0x00,
+0x00,0x13,0x10,0x00,0x00,0x38,0x9b,0xef,0x60,0x4c,0xff,0xf6,0x00,0x00,0x5f,0xdb,
+0xde,0x19,0xf9,0x44,0xde,0x1b,0x00,0x50,0xac,0xce,0x30,0x00,0x8f,0x09,0x00,0x21,
+0xdf,0xd1,0x28,0x00,0x20,0x00,0x07,0xa3,0x01,0x10,0x9d,0xea,0x00,0xf0,0x03,0xf8,
+0x00,0x00,0x00,0xbb,0x00,0x00,0x00,0xdb,0xe7,0x00,0x00,0x00,0xd9,0x00,0x00,0x0a,
+0xf2,0x09,0x00,0x50,0xe7,0x00,0x00,0x6f,0x60,0x09,0x00,0xe0,0xf6,0x00,0x00,0x9b,
+0x00,0xe8,0x00,0x00,0x01,0xf7,0x00,0x94,0x01,0x00,0x2d,0x00,0x60,0xfe,0xae,0xf3,
+0x00,0x00,0xf9,0x79,0x00,0x4a,0xeb,0x20,0x00,0x00,0x95,0x00,0x12,0x00,0x0c,0x02,
+0x09,0x98,0x00,0x12,0x07,0xb1,0x01,0x00,0x97,0x00,0xf0,0x0b,0x00,0x34,0x20,0x00,
+0x05,0xfd,0xad,0xe0,0x3a,0xff,0xff,0xe6,0x00,0x00,0x00,0xab,0x9f,0xb5,0x21,0x4b,
+0xf7,0x00,0x00,0x0d,0xfd,0x40,0x78,0x00,0x02,0x95,0x00,0x51,0x00,0x2f,0x60,0x03,
+0xff,0x37,0x01,0x11,0xf8,0x94,0x00,0x00,0x3f,0x03,0x30,0xaf,0x2e,0x70,0x01,0x02,
+0x12,0xf3,0x93,0x00,0x40,0x05,0xfa,0x09,0xb0,0xa6,0x02,0x30,0x19,0xfd,0x00,0x92,
+0x00,0x20,0x07,0xcf,0x96,0x00,0x78,0x0f,0x90,0x00,0x8c,0x72,0x00,0x00,0x91,0x00,
+0x04,0x18,0x01,0x11,0xea,0x07,0x00,0x00,0xb5,0x02,0x70,0x23,0x50,0x00,0x0a,0xdc,
+0xcd,0xfe,0xb3,0x01,0x82,0x05,0x89,0x9f,0xc8,0x76,0x42,0x10,0x00,0xd1,0x02,0x01,
+0x98,0x03,0xf0,0x0c,0x13,0x00,0x00,0x01,0x83,0x00,0x0a,0xfc,0xff,0xf6,0x02,0x9f,
+0xf6,0x00,0x7f,0xd5,0x10,0xaf,0xbf,0xc6,0x00,0x05,0xfb,0x00,0x02,0xbf,0xb3,0x30,
+0x02,0x40,0x00,0x6f,0xcf,0x30,0x56,0x00,0x42,0x08,0xf6,0x2f,0x30,0x64,0x02,0x02,
+0x08,0x00,0x41,0x8f,0x00,0x16,0x10,0x7f,0x01,0x03,0x48,0x00,0xe0,0x2e,0xea,0x87,
+0x89,0xbd,0x60,0x00,0x00,0x02,0x8c,0xde,0xdd,0xca,0x30,0x7a,0x03,0x13,0xb3,0x89,
+0x00,0x13,0xcf,0x22,0x00,0x32,0x5f,0x70,0x00,0xfa,0x02,0x12,0xd0,0x08,0x00,0x23,
+0x06,0xf4,0x21,0x00,0x14,0xec,0x3b,0x01,0x13,0x30,0x8c,0x03,0x12,0xca,0x0a,0x01,
+0x32,0x07,0xff,0x96,0x3c,0x00,0xf0,0x24,0xef,0x40,0x03,0xf5,0x00,0x00,0x21,0x00,
+0x6f,0x70,0x00,0x1f,0x50,0x00,0x09,0xc0,0x0e,0xc0,0x00,0x01,0xf6,0x00,0x01,0xf8,
+0x05,0xf5,0x00,0x00,0x1f,0x60,0x00,0xaf,0x20,0xce,0x00,0x00,0x00,0xfc,0x12,0x9f,
+0x70,0x3f,0x90,0x00,0x00,0x09,0xff,0xff,0x80,0x00,0x53,0x31,0x01,0x50,0x87,0x20,
+0x00,0x45,0x44,0x01,0x00,0x30,0x40,0xaf,0xff,0x01,0x00,0x20,0xf3,0x11,0x01,0x00,
+0xe0,0x3f,0xa0,0x00,0x00,0x05,0xa0,0x00,0xce,0x10,0x00,0x00,0x08,0xf0,0x1c,0xb7,
+0x01,0x31,0x08,0xf0,0xbf,0x95,0x02,0x21,0xd0,0x02,0x7e,0x00,0x12,0x90,0xae,0x00,
+0x11,0x50,0xee,0x02,0x02,0x9c,0x00,0x30,0x3e,0xf2,0x00,0x51,0x00,0x12,0xfe,0xa1,
+0x00,0x11,0x40,0x06,0x00,0x21,0x69,0x88,0x01,0x00,0x92,0x91,0xaf,0xfe,0xee,0xee,
+0xee,0xee,0xef,0xf7,0xbc,0x00,0x63,0x1e,0xc0,0x00,0x00,0x00,0x23,0xf5,0x00,0x41,
+0x9f,0x10,0x0b,0xf4,0x2c,0x01,0x21,0x01,0xcf,0x34,0x00,0x31,0x9f,0x06,0xe3,0x25,
+0x00,0x13,0xae,0xf1,0x00,0x13,0xeb,0xa3,0x01,0x02,0x3c,0x00,0x00,0x0c,0x02,0x07,
+0xe5,0x03,0x41,0x00,0x07,0xfd,0x00,0xca,0x04,0x22,0xdf,0xc1,0x17,0x00,0x17,0x86,
+0x6f,0x02,0x21,0x09,0x30,0x31,0x00,0x10,0xf8,0x06,0x00,0x21,0x3d,0xf7,0x88,0x01,
+0x10,0xe4,0xa2,0x00,0x00,0x2c,0x00,0x40,0x02,0x7d,0xfc,0xf8,0xb7,0x03,0x70,0xb3,
+0x0f,0x80,0x00,0x04,0xd7,0x10,0xbe,0x02,0x00,0x2a,0x02,0x02,0x94,0x03,0x09,0x0d,
+0x00,0x12,0xf9,0x0d,0x00,0x14,0x90,0x56,0x00,0x23,0x06,0x50,0x89,0x01,0x02,0xa2,
+0x01,0x31,0x08,0xfc,0x10,0x9f,0x00,0x22,0xcf,0xa0,0x16,0x00,0x11,0xf6,0x07,0x00,
+0x40,0x5d,0xff,0x20,0x00,0x65,0x00,0xa0,0xfd,0xcf,0x00,0x00,0x00,0x27,0xdf,0xfc,
+0x40,0x8f,0x16,0x02,0x12,0xe8,0x6a,0x03,0x32,0x03,0x00,0x00,0x72,0x03,0x0f,0x08,
+0x00,0x08,0x2a,0x9f,0x10,0x08,0x00,0x12,0x69,0x08,0x00,0x13,0x23,0xda,0x00,0x13,
+0xf2,0x2e,0x00,0x11,0x10,0xcc,0x02,0x71,0x08,0xf1,0x00,0x00,0x10,0x7f,0xff,0x01,
+0x00,0x82,0x77,0xf6,0x55,0x55,0x55,0x55,0x59,0xf6,0x63,0x03,0x42,0x8f,0x26,0xf1,
+0x00,0x27,0x05,0x10,0x10,0xa9,0x01,0x31,0xfa,0x06,0xe1,0x07,0x01,0x12,0x40,0x43,
+0x02,0x12,0xd0,0x4d,0x00,0x12,0xf5,0x4a,0x01,0x11,0xfa,0x07,0x00,0x21,0x1a,0xfb,
+0x50,0x01,0x21,0x9f,0xf9,0x86,0x02,0x22,0xff,0xc3,0xa1,0x03,0x17,0x20,0x57,0x01,
+0x11,0x04,0x68,0x00,0x80,0xf2,0x02,0x77,0x66,0xbf,0x76,0x67,0x71,0x4f,0x00,0x02,
+0x9c,0x00,0x0f,0x07,0x00,0x0d,0x82,0x16,0x65,0x55,0xaf,0x65,0x55,0x66,0x3f,0xa8,
+0x00,0x21,0x01,0x11,0x01,0x00,0x21,0x04,0x98,0x21,0x02,0xa1,0x92,0x00,0x6f,0xfe,
+0xee,0xff,0xfe,0xee,0xff,0x40,0xce,0x05,0x17,0x00,0xdf,0x00,0x0f,0x11,0x00,0x20,
+0xb2,0x58,0x88,0x88,0x8c,0xf8,0x88,0x88,0x89,0x28,0xff,0xff,0xd4,0x02,0x08,0x85,
+0x04,0x22,0x02,0xb4,0xa3,0x05,0x12,0xf4,0x07,0x00,0x41,0xf5,0x00,0x00,0x2f,0x25,
+0x00,0x80,0xf5,0x17,0x66,0x66,0x6e,0xf9,0x66,0x72,0x45,0x00,0x11,0xf5,0x11,0x01,
+0x21,0xf6,0xf6,0x52,0x00,0x20,0x80,0xf6,0xbc,0x05,0x10,0xf7,0xef,0x04,0x30,0x06,
+0xef,0x40,0x07,0x00,0x50,0x6f,0xb2,0x00,0x00,0xf7,0xc8,0x01,0x31,0x05,0x55,0xf7,
+0x78,0x06,0x39,0xff,0xe2,0x00,0x63,0x00,0x13,0xd7,0x09,0x00,0x23,0x0f,0x70,0x09,
+0x00,0x00,0x27,0x00,0x93,0x57,0x76,0x66,0x66,0x6f,0xb6,0x67,0x80,0x09,0x96,0x00,
+0x01,0x92,0x01,0x22,0xef,0x80,0x21,0x00,0x22,0xce,0xf8,0x08,0x00,0x32,0xbf,0x3e,
+0x80,0x08,0x00,0x21,0x50,0xe9,0x4a,0x00,0x41,0xdf,0x50,0x0e,0x90,0x56,0x03,0x20,
+0x40,0x00,0x11,0x00,0x31,0x2b,0xfc,0x10,0x7c,0x03,0x10,0x1e,0x51,0x00,0x00,0x11,
+0x00,0x10,0x32,0xc8,0x01,0x12,0xa0,0xd9,0x06,0x13,0xff,0x23,0x03,0x22,0x77,0x85,
+0xdb,0x00,0x28,0xf9,0x00,0xc8,0x02,0x01,0x84,0x00,0x92,0x05,0x77,0x66,0x7f,0xb6,
+0x66,0x67,0x50,0x9f,0x83,0x00,0x11,0x30,0xe3,0x04,0x20,0x06,0xf2,0xdf,0x03,0x02,
+0x96,0x05,0x12,0xbc,0x95,0x05,0x90,0x1f,0x80,0x00,0x00,0x8e,0x00,0x00,0x07,0xf2,
+0xf2,0x03,0x20,0x00,0x01,0x84,0x03,0x51,0xcb,0x00,0x00,0xaf,0x40,0xfa,0x03,0x21,
+0x8f,0x80,0x8f,0x03,0xe0,0xaf,0xb0,0x00,0x16,0x44,0xbf,0x30,0x9f,0xa0,0x00,0x02,
+0xff,0xff,0xa0,0xf1,0x03,0x25,0x02,0x33,0x28,0x02,0x10,0x35,0x2a,0x03,0x52,0xb2,
+0x00,0x06,0x73,0xf1,0xfe,0x01,0x32,0x3f,0x2a,0xa0,0x5a,0x00,0xb2,0x98,0x12,0x04,
+0x43,0x33,0x9f,0x33,0x33,0x35,0x00,0x00,0x84,0x00,0xa3,0xfb,0x00,0x04,0x33,0x33,
+0xcc,0x33,0x33,0x3d,0xa0,0x58,0x04,0x12,0xda,0x91,0x05,0x02,0x64,0x04,0x00,0x3a,
+0x05,0x11,0xf8,0x7c,0x07,0x82,0x00,0x00,0x0f,0x60,0x00,0x00,0x05,0xf6,0x1d,0x00,
+0x20,0x00,0xee,0x04,0x04,0x00,0x04,0x07,0x11,0x40,0xbd,0x00,0xf8,0x09,0x01,0xcf,
+0x70,0x00,0x22,0x12,0xec,0x00,0x01,0xef,0x70,0x00,0x0a,0xff,0xff,0x50,0x00,0x04,
+0x50,0x00,0x00,0x36,0x67,0x30,0x97,0x01,0x23,0x0a,0xd0,0x3e,0x03,0x12,0xf0,0x08,
+0x00,0xf4,0x0b,0x05,0xf3,0x00,0x25,0x92,0x00,0x00,0x01,0x38,0xfc,0xdf,0xff,0xf4,
+0x00,0xad,0xef,0xff,0xfe,0x97,0x42,0x00,0x00,0xac,0x96,0x41,0xcc,0x85,0x03,0x04,
+0x74,0x05,0x40,0x20,0x00,0x14,0x60,0x0f,0x06,0xf0,0x01,0xa9,0xcf,0xff,0xf0,0x35,
+0x7a,0xcf,0xff,0xfd,0xb8,0x63,0x10,0xdf,0xfd,0xa8,0x5d,0xc8,0x04,0x16,0x43,0x51,
+0x00,0x13,0x06,0x97,0x03,0x23,0x03,0xf6,0x39,0x00,0x13,0xfa,0x08,0x00,0x13,0xb8,
+0x17,0x08,0x13,0x00,0xdd,0x05,0x13,0xe0,0xc4,0x04,0x03,0x9a,0x01,0x71,0xdf,0x76,
+0x66,0x67,0x70,0x00,0x00,0x19,0x02,0x00,0x5f,0x02,0x11,0x80,0xcb,0x08,0x20,0x06,
+0xfa,0xe1,0x06,0x41,0x90,0x00,0x8f,0xb0,0xd3,0x07,0x20,0x0b,0xf8,0x42,0x00,0x40,
+0xfc,0x00,0x02,0x50,0x72,0x02,0x19,0xf2,0x42,0x00,0x23,0x03,0xfd,0x0f,0x00,0x12,
+0xe2,0x0e,0x03,0x00,0x3b,0x0a,0x00,0xae,0x02,0x11,0xb1,0xef,0x00,0x22,0xff,0xd4,
+0xb8,0x03,0x18,0xb5,0x0d,0x01,0x11,0x2c,0x56,0x04,0x50,0x20,0x00,0x3e,0x1c,0x80,
+0xcf,0x08,0xd0,0x00,0x00,0x0a,0x92,0xd0,0x00,0x00,0x06,0xf6,0x00,0x00,0x03,0xa0,
+0xa3,0x05,0x00,0x8c,0x00,0x10,0x70,0x99,0x06,0x71,0x65,0x55,0x55,0xaf,0x60,0x00,
+0x00,0xa5,0x05,0x10,0xaf,0x9a,0x02,0x12,0x60,0x5b,0x02,0x21,0x3d,0xf5,0x78,0x07,
+0x40,0x00,0x00,0x5d,0x30,0x7d,0x02,0x03,0x23,0x0a,0x02,0x19,0x09,0x00,0x76,0x00,
+0x14,0xf6,0x92,0x03,0x03,0x1a,0x00,0x23,0x1b,0xfa,0x25,0x01,0x03,0xf3,0x02,0x33,
+0x17,0xdf,0xd4,0x9c,0x08,0x14,0xd6,0x37,0x03,0x1c,0x00,0x01,0x00,0x23,0x01,0xf8,
+0x09,0x00,0x23,0x4f,0x60,0xc3,0x01,0x13,0xf1,0x19,0x00,0xa2,0xfd,0x66,0x66,0x66,
+0x66,0x77,0x30,0x00,0x9f,0xff,0x35,0x01,0xa1,0x4f,0xa0,0x00,0x05,0xf5,0x00,0x01,
+0x00,0x2e,0xe1,0xaf,0x01,0x32,0x00,0x2e,0xf4,0x97,0x01,0x64,0x04,0xe5,0x00,0x00,
+0x00,0xdd,0xfb,0x09,0x1a,0x80,0x46,0x00,0x23,0x04,0xfa,0x79,0x00,0x22,0xee,0x10,
+0x47,0x01,0x22,0xef,0x40,0x0b,0x05,0x23,0xfe,0x40,0x57,0x04,0x19,0x20,0xd7,0x03,
+0x10,0x80,0x0b,0x05,0x50,0x30,0x00,0x00,0x4b,0x1e,0xd9,0x0a,0x00,0x11,0x01,0x23,
+0xe6,0x5e,0x5f,0x00,0x33,0x05,0xb0,0x10,0x60,0x00,0x20,0x11,0x10,0xd3,0x0a,0x03,
+0xe2,0x03,0xb0,0x04,0xfa,0x66,0x66,0xbf,0x76,0x66,0x70,0x00,0x01,0xee,0xd1,0x09,
+0x00,0xba,0x00,0x63,0xdf,0x40,0x00,0x00,0xcc,0x00,0x49,0x01,0x23,0x0f,0xa0,0x2c,
+0x07,0x00,0xd8,0x02,0x03,0x0a,0x04,0x14,0x00,0xf4,0x00,0x04,0x73,0x06,0x23,0x1e,
+0xe1,0x09,0x00,0x14,0x1d,0x0d,0x08,0x14,0x6e,0x2e,0x00,0x2d,0x08,0xe4,0x34,0x01,
+0x02,0x3f,0x04,0x10,0xfe,0x6f,0x07,0x82,0xf1,0x79,0x99,0x99,0x99,0x99,0x9d,0xf0,
+0x2b,0x00,0x0f,0x07,0x00,0x1f,0x01,0x9c,0x05,0x22,0x8c,0xf0,0xcd,0x00,0x21,0xf0,
+0x10,0xd7,0x01,0x12,0xf1,0x80,0x01,0x43,0x20,0x00,0x00,0xc8,0x11,0x0c,0x23,0x0e,
+0x90,0x32,0x07,0x13,0xe9,0x6c,0x04,0x03,0x11,0x00,0x13,0xdf,0xe8,0x04,0x9a,0x57,
+0x87,0x7f,0xc7,0x77,0x77,0xfc,0x77,0x83,0x22,0x00,0x13,0xf7,0x33,0x00,0x31,0x2f,
+0x60,0x00,0x08,0x01,0x11,0x04,0xdd,0x00,0x12,0x43,0x65,0x02,0x01,0xdc,0x09,0x03,
+0x39,0x02,0x13,0x1c,0xbf,0x05,0x23,0x3d,0xf5,0xdc,0x00,0x13,0xf5,0x66,0x03,0x1c,
+0x81,0xf6,0x00,0x71,0x52,0x00,0x00,0x16,0x33,0x2a,0x50,0x56,0x0d,0x50,0x03,0xf6,
+0x7a,0x4c,0x00,0x02,0x09,0x51,0x00,0x2f,0x61,0xf1,0xa0,0x03,0x09,0xf3,0x08,0x02,
+0xf5,0x04,0x00,0x00,0x98,0x78,0xfb,0x77,0x77,0x9f,0xa7,0x88,0x10,0x0f,0xfe,0xff,
+0xfe,0xee,0xef,0xff,0xef,0xf2,0x26,0x00,0x00,0xd7,0x07,0x00,0x26,0x00,0x11,0x03,
+0x88,0x00,0x00,0x13,0x00,0x22,0x4f,0x30,0x63,0x0a,0x03,0xd8,0x03,0x26,0x01,0xb5,
+0x95,0x08,0x05,0x9d,0x00,0x34,0x00,0x0a,0xf4,0x09,0x00,0x04,0xac,0x02,0x14,0x6d,
+0xf6,0x03,0x2b,0x0c,0xe6,0xa0,0x00,0x23,0x04,0x20,0xbc,0x09,0x13,0xf7,0x51,0x02,
+0x23,0xbf,0xd2,0x8a,0x04,0x13,0xe8,0x95,0x0a,0x11,0x10,0xfa,0x08,0x02,0x56,0x09,
+0x42,0xb0,0x4d,0xfb,0x20,0xeb,0x03,0x00,0x3c,0x0d,0x00,0x76,0x05,0x63,0x02,0x30,
+0x00,0x00,0x07,0xfb,0x9c,0x04,0x12,0xb0,0x56,0x03,0x12,0xf9,0x55,0x03,0x21,0xff,
+0x50,0x54,0x03,0x20,0xef,0xc2,0x57,0x00,0x32,0x7b,0xff,0xd6,0xbe,0x07,0x12,0xb5,
+0x29,0x01,0x1c,0x50,0x29,0x01,0x11,0x03,0xb6,0x06,0xf2,0x0c,0x70,0x00,0x02,0xfc,
+0x30,0x00,0x03,0xe1,0x4f,0x20,0x00,0x05,0xef,0x80,0x00,0x0b,0xa0,0xaa,0x00,0x00,
+0x01,0xaf,0x50,0x00,0x2f,0x21,0x10,0x95,0x02,0x42,0x10,0x00,0x0c,0xa1,0x00,0x08,
+0x33,0x00,0x8f,0xf7,0xb9,0x04,0x20,0x2c,0xf8,0xec,0x00,0x00,0x0c,0x07,0x00,0x1c,
+0x0a,0x13,0xf9,0xfc,0x00,0x13,0xfa,0xab,0x01,0x13,0xf8,0x31,0x05,0x12,0xe4,0x96,
+0x00,0x02,0x96,0x09,0x31,0x15,0x9e,0xfe,0x08,0x07,0x32,0x2f,0xff,0xc5,0x1f,0x00,
+0x14,0x66,0x7f,0x0b,0x60,0x48,0x77,0x77,0x77,0x77,0x86,0xc5,0x0a,0x12,0xff,0x2d,
+0x0d,0x10,0x01,0x0d,0x01,0x13,0xf7,0x1e,0x00,0x14,0xbe,0x09,0x03,0x13,0x70,0x08,
+0x03,0x13,0xd0,0x6e,0x00,0x03,0x11,0x02,0x04,0x0b,0x01,0x32,0x06,0xfe,0xf8,0xb1,
+0x02,0x31,0xfa,0x0a,0xf9,0x14,0x01,0x12,0xf8,0x91,0x00,0xa0,0x5e,0xf7,0x00,0x00,
+0x0a,0xf9,0x00,0x05,0xcf,0xd3,0x8d,0x01,0x41,0xf7,0x00,0x9f,0x80,0x46,0x00,0xa0,
+0xa0,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x1a,0x00,0x01,0x00,0x23,0x13,
+0x3d,0x09,0x00,0x32,0x5e,0x0b,0x90,0x09,0x00,0xf3,0x04,0x0b,0x82,0xb0,0x00,0xdf,
+0xff,0xff,0xff,0xff,0xfa,0x40,0x00,0x00,0x89,0x88,0x88,0x88,0x8d,0xf5,0x23,0x00,
+0x23,0x0d,0xd0,0x09,0x00,0x22,0x5f,0x50,0x08,0x00,0x23,0x01,0xec,0x11,0x00,0x23,
+0x0a,0xf2,0x09,0x00,0x22,0x6f,0x80,0x08,0x00,0x33,0x05,0xff,0xa0,0x2b,0x00,0x21,
+0xb9,0xfa,0x08,0x00,0xf0,0x0d,0x08,0xfa,0x00,0x8f,0xb0,0x00,0x00,0x00,0x02,0xbf,
+0x90,0x00,0x08,0xfb,0x00,0x00,0x00,0x7f,0xf7,0x00,0x00,0x00,0x9f,0xa0,0x00,0x2e,
+0xfc,0x20,0x75,0x00,0x41,0xf6,0x00,0x07,0x50,0x53,0x00,0x00,0x86,0x00,0x22,0x1a,
+0x60,0x3d,0x00,0x23,0x1f,0x80,0x08,0x00,0x12,0x70,0x08,0x00,0xf2,0x16,0x0f,0x70,
+0x00,0x00,0x26,0xa4,0x00,0x00,0x0f,0x82,0x69,0xcf,0xff,0xfa,0x01,0x36,0x9f,0xff,
+0xfe,0xb7,0x4a,0xf1,0x9f,0xff,0xef,0xb4,0x10,0x00,0x3f,0x70,0x58,0x41,0x1f,0x70,
+0x00,0x01,0xdc,0x28,0x00,0x22,0x0c,0xe2,0x08,0x00,0x22,0x6f,0x40,0x08,0x00,0x14,
+0x02,0x40,0x00,0x01,0x08,0x00,0x03,0x58,0x00,0x90,0x0e,0xe5,0x22,0x23,0x46,0x91,
+0x00,0x00,0x05,0xef,0x00,0x84,0xf1,0x00,0x00,0x00,0x03,0x55,0x44,0x32,0x1a,0x01,
+0x10,0x03,0xaf,0x00,0xa0,0x36,0x10,0x00,0x00,0x4d,0x0d,0x70,0x00,0x00,0x08,0xe2,
+0x00,0x20,0xc8,0x3d,0xb9,0x00,0x40,0x10,0x00,0x00,0x03,0xa6,0x00,0x20,0x07,0xf1,
+0x21,0x00,0x11,0x00,0x13,0x00,0x30,0x36,0x9c,0xff,0x26,0x01,0xf2,0x0b,0x3a,0xfd,
+0xff,0xfd,0xa7,0xfd,0x00,0x00,0xbd,0xff,0xff,0xa7,0x41,0x00,0x6f,0x30,0x00,0x0d,
+0xb7,0x48,0xf1,0x00,0x00,0x2f,0x90,0x00,0x39,0x00,0x32,0x1d,0xd0,0x00,0x39,0x00,
+0x33,0x0c,0xf2,0x00,0x13,0x00,0x34,0x34,0x00,0x00,0x4c,0x00,0x04,0x13,0x00,0x02,
+0x01,0x00,0x51,0x06,0xf7,0x00,0x00,0x01,0x1e,0x00,0x61,0x1e,0xff,0xee,0xef,0xff,
+0xb0,0x57,0x01,0x71,0x89,0x98,0x87,0x52,0x00,0x00,0x07,0x21,0x00,0x31,0xab,0x05,
+0xf9,0xc5,0x00,0x30,0xd0,0x0c,0xf3,0x39,0x01,0x42,0xf9,0x00,0x2f,0xc0,0x9c,0x01,
+0xf2,0x06,0x9f,0x50,0x00,0x00,0x0a,0xf0,0x00,0x01,0xfd,0x00,0x00,0x01,0xfb,0x00,
+0x00,0x04,0x10,0x00,0x00,0x7f,0x30,0x49,0x01,0x11,0xb0,0x07,0x00,0x21,0x0c,0xf3,
+0x07,0x00,0x22,0x09,0xf8,0x07,0x00,0x11,0xfb,0x07,0x00,0x21,0x1b,0xfc,0x07,0x00,
+0x21,0x6e,0xf9,0x07,0x00,0x22,0x9f,0xe5,0x86,0x00,0x18,0x50,0x2d,0x02,0x12,0x10,
+0x99,0x00,0x22,0x25,0xd0,0xd3,0x01,0x31,0xc0,0xc8,0x01,0x09,0x00,0x40,0xe5,0x37,
+0x9e,0x10,0xdb,0x01,0x40,0x92,0x00,0x5f,0x90,0xa5,0x00,0x40,0xf6,0x00,0x0b,0xf3,
+0x58,0x00,0x43,0xf2,0x00,0x02,0xfc,0x37,0x02,0x00,0x93,0x00,0xa1,0x2f,0x80,0x00,
+0x00,0x1d,0x40,0x00,0x00,0x9f,0x20,0x36,0x00,0x23,0x02,0xfa,0x70,0x02,0x13,0xf2,
+0xf9,0x00,0x12,0x90,0x5e,0x00,0x12,0xfc,0x0f,0x00,0x21,0x8f,0xd1,0x07,0x00,0x31,
+0x2c,0xfc,0x10,0x61,0x02,0x22,0xff,0x80,0x1e,0x00,0x14,0xb3,0x8c,0x00,0x23,0x07,
+0x50,0x1c,0x02,0x22,0xc0,0x00,0xb1,0x00,0x12,0x30,0xb6,0x01,0x00,0xcb,0x01,0xf2,
+0x21,0xf4,0x00,0x00,0x1e,0xd6,0x66,0x66,0x6c,0xf2,0x00,0x00,0xce,0x20,0x00,0x00,
+0x0e,0xc0,0x00,0x0c,0xf4,0x00,0x00,0x00,0x4f,0x60,0x03,0xdf,0x40,0x78,0x10,0x00,
+0xce,0x00,0x1e,0xd2,0x00,0x9f,0xe6,0x06,0xf6,0x00,0x01,0x10,0x00,0x02,0xcf,0xde,
+0xc0,0x5b,0x00,0x22,0xff,0xb0,0x90,0x00,0x21,0xfc,0xfd,0x89,0x02,0x31,0xcf,0x70,
+0x66,0x18,0x03,0x02,0xfe,0x02,0x21,0x4c,0xfd,0x60,0x00,0x22,0x2e,0xfe,0x9b,0x02,
+0x2b,0x04,0x60,0x48,0x03,0x02,0xd3,0x00,0x10,0x2e,0xad,0x00,0x50,0x6d,0x30,0x00,
+0x3f,0x1b,0xff,0x02,0xd0,0xde,0x00,0x00,0x0a,0xa2,0xc0,0x00,0x00,0x06,0xfa,0x44,
+0x44,0x58,0x11,0x00,0x10,0x2f,0x9d,0x00,0x22,0xc0,0x00,0x96,0x00,0x32,0x5f,0x70,
+0x00,0x28,0x01,0xf2,0x0d,0xaf,0x10,0x00,0x01,0xbf,0x50,0x10,0x00,0x01,0xfa,0x00,
+0x00,0x4e,0xe4,0x06,0xf9,0x10,0x09,0xf3,0x00,0x00,0x5c,0x20,0x01,0x9f,0xe6,0x3f,
+0x90,0x57,0x00,0x33,0xcf,0xfe,0x10,0x82,0x03,0x13,0xff,0xba,0x02,0x31,0xbf,0x8c,
+0xf4,0x08,0x00,0x41,0x2d,0xf7,0x00,0x40,0x0e,0x01,0x12,0xff,0x0f,0x01,0x33,0x28,
+0xef,0xb2,0x0f,0x01,0x14,0xc4,0x94,0x00,0x09,0xa2,0x00,0xf3,0x0a,0x45,0x00,0x00,
+0x02,0x23,0x35,0x67,0xad,0xff,0xf2,0x00,0x00,0xaf,0xff,0xff,0xfe,0x96,0x30,0x00,
+0x00,0x01,0x22,0x10,0x0e,0x90,0x20,0x00,0x13,0xe9,0x08,0x00,0x01,0x11,0x00,0xf0,
+0x02,0x28,0x87,0x77,0x77,0xfc,0x77,0x77,0x88,0x34,0xfe,0xee,0xee,0xef,0xfe,0xee,
+0xee,0xf5,0x17,0x01,0x13,0xf7,0x22,0x00,0x13,0x4f,0x80,0x01,0x23,0x08,0xf2,0x0c,
+0x04,0x13,0xfb,0x19,0x00,0x23,0xaf,0x40,0x08,0x00,0x12,0x80,0x2a,0x01,0x13,0xef,
+0x5c,0x00,0x14,0x1a,0x4b,0x02,0xf2,0x18,0x0b,0x50,0x00,0x03,0x10,0x5d,0x00,0x0d,
+0xb0,0x00,0x0c,0xe0,0x3f,0x60,0x07,0xf1,0x00,0x1f,0x90,0x0c,0xc0,0x01,0xf7,0x00,
+0x5f,0x40,0x06,0xf3,0x00,0x72,0x00,0xbe,0x00,0x01,0xa2,0x00,0x00,0x04,0xf8,0xf1,
+0x00,0x12,0xe0,0xce,0x00,0x16,0x50,0xb0,0x02,0x30,0x02,0xcf,0x80,0x06,0x00,0x21,
+0x9f,0xf6,0x1b,0x03,0x21,0xfa,0x10,0x14,0x00,0x1b,0x20,0xee,0x00,0xe0,0x09,0xf0,
+0x00,0x00,0x05,0x30,0x0c,0xa0,0x00,0x4f,0x60,0x00,0x00,0xde,0x63,0x01,0x70,0xdc,
+0x00,0x00,0x1f,0x90,0x03,0xf7,0xb0,0x00,0xb0,0x05,0xf4,0x00,0x0c,0xd0,0x00,0x2f,
+0x50,0x00,0xbe,0x00,0x20,0x04,0x10,0x10,0xa0,0x03,0x20,0x01,0x61,0x36,0x00,0x13,
+0xf1,0xfb,0x03,0x13,0xf8,0xd4,0x00,0x13,0xde,0x4f,0x00,0x22,0xcf,0x40,0x5e,0x00,
+0x23,0xdf,0x60,0x2b,0x02,0x02,0xcc,0x00,0x32,0x5d,0xfd,0x30,0x1f,0x00,0x04,0x30,
+0x00,0x1b,0x71,0x11,0x02,0x40,0xcf,0xff,0xff,0xff,0x19,0x04,0x20,0x06,0x77,0x01,
+0x00,0x1e,0x20,0x32,0x02,0x21,0x43,0x33,0x01,0x00,0x32,0x32,0x1f,0xff,0x01,0x00,
+0x90,0x70,0x44,0x33,0x33,0x3d,0xd3,0x33,0x33,0x42,0x1d,0x00,0x23,0xeb,0x00,0xaf,
+0x04,0x03,0x42,0x01,0x24,0x04,0xf6,0x63,0x01,0x04,0x88,0x05,0x04,0x65,0x05,0x12,
+0xd1,0x7f,0x00,0x23,0xbf,0xc2,0x94,0x01,0x19,0x80,0x96,0x02,0x04,0x51,0x04,0x13,
+0x0d,0xff,0x04,0x50,0x0c,0x73,0xf1,0x00,0x3f,0xd4,0x01,0x50,0xd3,0xf1,0x72,0x00,
+0x18,0x9a,0x00,0x3f,0x60,0x40,0x00,0x01,0x00,0x06,0x33,0x01,0x00,0x7f,0x9d,0x00,
+0x91,0x10,0x36,0x66,0x66,0x68,0xfa,0x66,0x66,0x67,0x8d,0x00,0x04,0x16,0x06,0x24,
+0x05,0xf3,0x74,0x01,0x14,0xf1,0xb0,0x00,0x23,0xb0,0x00,0x85,0x02,0x04,0x24,0x02,
+0x23,0xf9,0x00,0xc9,0x02,0x13,0xb0,0xca,0x00,0x1b,0xe6,0x65,0x00,0x31,0xae,0x10,
+0x00,0xb4,0x04,0x00,0x35,0x00,0x04,0xc0,0x01,0x04,0x0b,0x00,0x20,0xfa,0x50,0x0b,
+0x00,0xf0,0x00,0xff,0xf9,0x40,0x00,0x09,0xf0,0x5b,0xff,0xd7,0x00,0x9f,0x00,0x01,
+0x8e,0xfe,0x21,0x00,0x2d,0x06,0x80,0x2c,0x00,0x21,0xf0,0x00,0x51,0x03,0x00,0xc4,
+0x01,0x01,0x7c,0x00,0x50,0x14,0x30,0x00,0x00,0x04,0xe0,0x01,0xf0,0x00,0x15,0x0d,
+0x90,0x1f,0x80,0x00,0x2f,0x43,0xf3,0x0f,0x80,0x00,0x08,0xd0,0x85,0x02,0x06,0x13,
+0xa1,0x59,0x01,0x30,0x0f,0xfe,0x83,0x06,0x00,0xf0,0x02,0xcc,0xff,0xd7,0x10,0x00,
+0x0f,0x80,0x28,0xef,0xfa,0x20,0x0f,0x80,0x00,0x05,0xcf,0x60,0x24,0x00,0x13,0x04,
+0x2c,0x06,0x26,0x0f,0x80,0x90,0x06,0x11,0x1f,0x36,0x00,0x24,0x2f,0x90,0xbc,0x00,
+0x23,0xcc,0x00,0x57,0x01,0x1c,0xd0,0x11,0x00,0x00,0xeb,0x03,0x93,0x17,0x77,0x77,
+0x77,0xee,0x77,0x77,0x77,0x42,0x45,0x01,0x01,0x2b,0x02,0x14,0xdc,0x2a,0x01,0x13,
+0xa0,0x64,0x01,0x14,0xf9,0x40,0x07,0x13,0x50,0x3b,0x00,0x13,0xf0,0xb4,0x01,0x13,
+0xf9,0x31,0x01,0x13,0xfd,0xf6,0x04,0x22,0xfe,0x20,0x6c,0x01,0x23,0xfc,0x20,0x7e,
+0x01,0x03,0x39,0x00,0x20,0x11,0x10,0x05,0x00,0x31,0x00,0x00,0x8f,0x65,0x00,0xaf,
+0x50,0x00,0x48,0x87,0x77,0x77,0x77,0x88,0x30,0x00,0x01,0x00,0x24,0x30,0x2f,0xfe,
+0xee,0x01,0x00,0x32,0xfe,0x2c,0xbb,0x01,0x00,0x00,0x14,0x00,0x13,0x31,0x1c,0x00,
+0x23,0x3f,0x70,0xce,0x01,0x01,0x8f,0x02,0x93,0x16,0x55,0x55,0x6f,0x95,0x55,0x60,
+0x00,0x02,0xc1,0x02,0x83,0x00,0x02,0x11,0x11,0x11,0x11,0x6f,0xc0,0x26,0x04,0x13,
+0xc0,0xdd,0x05,0x12,0xc1,0xe8,0x00,0x22,0xaf,0xa0,0xd7,0x00,0x30,0xef,0x90,0x25,
+0x0f,0x00,0xf0,0x0b,0x7e,0xfc,0xf5,0x0a,0xfc,0x30,0x01,0x7c,0xff,0xb3,0x2f,0x50,
+0x06,0xef,0x80,0x1f,0xd7,0x20,0x02,0xf5,0x00,0x01,0xaf,0x40,0x10,0x00,0x9f,0x03,
+0x20,0x00,0x30,0xc8,0x01,0x14,0xf5,0x77,0x00,0x13,0x60,0x9d,0x03,0x1c,0xc5,0xad,
+0x00,0x22,0x0c,0xd1,0x4d,0x01,0x12,0xc0,0x0d,0x03,0x12,0x60,0x22,0x05,0x02,0xa4,
+0x00,0x18,0xf9,0xa0,0x08,0x03,0x50,0x05,0x32,0xde,0x10,0x00,0x73,0x08,0x01,0x2d,
+0x02,0x01,0x14,0x00,0x22,0x1c,0xfa,0xd8,0x03,0x10,0x80,0x06,0x00,0x21,0xdf,0xe4,
+0x56,0x00,0x27,0xf9,0x10,0xf5,0x06,0x03,0x0b,0x03,0x00,0x01,0x00,0x13,0xdb,0xea,
+0x01,0x22,0x1f,0x90,0x6c,0x00,0x00,0x0a,0x03,0x11,0xed,0xb3,0x06,0x43,0x10,0x00,
+0x07,0xf4,0xf1,0x06,0x00,0x6a,0x07,0x32,0x02,0xf8,0x00,0xee,0x06,0x00,0x7e,0x07,
+0x62,0x03,0xf9,0x00,0x00,0x0e,0xe0,0xd3,0x04,0x21,0x06,0xf6,0x14,0x01,0x20,0x40,
+0x00,0x60,0x04,0x00,0xf8,0x05,0x21,0x8f,0x70,0xed,0x04,0x32,0xf0,0x2f,0xd0,0xfc,
+0x06,0x22,0x52,0x93,0xeb,0x00,0x13,0x92,0x79,0x00,0x13,0x15,0x08,0x00,0x33,0x29,
+0x1e,0x50,0xa0,0x05,0xf1,0x05,0x56,0xe0,0x00,0x00,0x0a,0x40,0x01,0xb7,0x06,0xd0,
+0x40,0x00,0x00,0x4f,0x70,0x00,0xcf,0x10,0x10,0x00,0x69,0x00,0x23,0x4f,0x70,0x22,
+0x04,0x23,0x0c,0xe0,0x44,0x04,0x24,0x06,0xf6,0x3c,0x04,0x14,0xec,0xa6,0x03,0x21,
+0x8f,0x30,0x16,0x07,0x02,0xc6,0x02,0x23,0x7f,0x50,0x69,0x05,0x11,0xed,0x62,0x02,
+0x43,0xf5,0x00,0x08,0xf6,0xa0,0x07,0x12,0x2f,0x52,0x01,0x32,0xdf,0x00,0x6f,0x49,
+0x02,0x2e,0x8d,0x20,0x1d,0x04,0x03,0xa8,0x02,0x23,0xed,0x90,0x99,0x00,0xb1,0x10,
+0xd2,0x00,0x00,0x09,0x40,0x01,0xa6,0x0d,0x42,0xe1,0x2b,0x02,0x4a,0xce,0x03,0xcc,
+0x50,0x99,0x00,0x15,0x0d,0x99,0x00,0x14,0xf5,0x99,0x00,0x14,0xfc,0x99,0x00,0x23,
+0x9f,0x20,0x99,0x00,0x2d,0x3f,0x80,0x99,0x00,0x1f,0xf4,0x99,0x00,0x07,0x1c,0x8c,
+0x99,0x00,0x20,0x60,0x01,0x12,0x00,0x50,0x19,0x0d,0x70,0x8f,0x10,0xb8,0x09,0x21,
+0x3f,0x18,0xde,0x09,0x30,0xf1,0x40,0x7f,0x1d,0x00,0x50,0x42,0x00,0x07,0xf0,0x00,
+0xe2,0x03,0xd0,0x00,0x7f,0x00,0x04,0x9e,0xfd,0x71,0x00,0x07,0xf8,0xbf,0xfe,0x93,
+0x3f,0x01,0x21,0xfc,0x83,0x6a,0x00,0x04,0x92,0x08,0x03,0x74,0x03,0x1a,0xf0,0x0f,
+0x00,0x13,0xf1,0xab,0x03,0x62,0xa3,0x10,0x11,0x23,0x57,0x30,0xe4,0x05,0x8a,0xf6,
+0x00,0x00,0x35,0x77,0x76,0x65,0x43,0x2a,0x09,0x40,0x01,0xdc,0xd2,0x9f,0x0a,0x00,
+0x40,0x86,0x06,0x98,0xf1,0x3a,0x00,0x21,0x91,0x97,0x44,0x00,0x20,0x69,0xd9,0x53,
+0x00,0x20,0x16,0xdf,0x80,0x00,0xa1,0x15,0xbf,0xfc,0x60,0x00,0x07,0xf9,0xcf,0xfd,
+0x82,0x80,0x00,0x18,0x72,0x62,0x00,0x0f,0x80,0x00,0x22,0x20,0x29,0x87,0xd1,0x05,
+0x22,0x86,0x03,0x8f,0x03,0x13,0xf3,0x88,0x06,0x09,0x99,0x05,0x04,0x48,0x06,0x22,
+0xaf,0x10,0x16,0x03,0x18,0xa0,0x15,0x0a,0x22,0x06,0xfa,0x58,0x04,0x21,0xfd,0x10,
+0xba,0x05,0x02,0x07,0x00,0x31,0x5d,0xfc,0x10,0x5d,0x08,0x12,0xf7,0x40,0x03,0x1e,
+0x81,0x32,0x04,0x04,0x27,0x03,0x23,0x47,0x0e,0x2b,0x07,0x22,0xf2,0x5e,0x13,0x00,
+0x32,0x09,0x90,0x71,0x94,0x04,0x31,0xfb,0x00,0x04,0x9b,0x00,0x2a,0x7f,0xc0,0x65,
+0x07,0x00,0x08,0x03,0x02,0x18,0x08,0x13,0xf0,0x19,0x00,0x14,0xf9,0x3e,0x07,0x1a,
+0x20,0xe7,0x06,0x22,0x3f,0xe1,0x08,0x00,0x22,0x4e,0xf3,0x5e,0x01,0x21,0x8f,0xe3,
+0x08,0x00,0x32,0x38,0xef,0xc1,0x48,0x00,0x13,0xfd,0x1d,0x03,0x18,0x74,0x98,0x00,
+0x23,0x08,0xc8,0xa2,0x02,0x31,0xa1,0xa6,0x11,0x09,0x00,0x32,0x95,0x05,0x99,0x1c,
+0x01,0x30,0xd7,0xd4,0x58,0x90,0x00,0x33,0x78,0xfd,0x73,0xac,0x04,0x13,0x80,0x32,
+0x00,0x13,0xf4,0x3b,0x00,0x2a,0xce,0x00,0x19,0x00,0x2a,0x0d,0xf2,0x95,0x05,0x23,
+0x03,0xfe,0x84,0x05,0x03,0x95,0x05,0x31,0x19,0xfe,0x30,0x17,0x00,0x22,0x8f,0xfb,
+0x3c,0x01,0x23,0xff,0xd5,0x51,0x00,0x0e,0x87,0x05,0x23,0x4e,0xc3,0xd3,0x00,0x12,
+0xef,0x6d,0x00,0x43,0x1e,0xe1,0x2d,0xf4,0x85,0x01,0x20,0x1d,0xf4,0xb1,0x04,0x90,
+0xf5,0x00,0x00,0x1e,0xf3,0x00,0x00,0x09,0xf9,0x75,0x0a,0x41,0xf3,0x00,0x08,0xfc,
+0x2e,0x00,0x47,0xe2,0x00,0x1c,0x10,0xf1,0x07,0x24,0x00,0x00,0x4d,0x01,0x00,0x4a,
+0x0d,0x02,0x01,0x00,0x1b,0xb4,0x6a,0x00,0x13,0x03,0x19,0x00,0xf1,0x0a,0x85,0x1e,
+0x70,0x00,0x00,0x02,0x95,0x00,0x06,0xe1,0x5f,0x10,0x00,0x02,0xef,0xfa,0x00,0x0d,
+0x90,0x71,0x00,0x00,0xde,0x38,0xfb,0x82,0x0c,0x30,0xbf,0x40,0x06,0xc0,0x09,0x00,
+0x89,0x04,0x20,0x07,0xfa,0x5d,0x02,0x12,0xa0,0xb6,0x07,0x22,0x7f,0xd0,0x78,0x09,
+0x02,0x13,0x03,0x23,0x0b,0xf7,0x4d,0x08,0x14,0x0d,0x95,0x05,0x24,0x2e,0xf4,0x24,
+0x01,0x13,0x70,0x09,0x00,0x13,0x30,0x24,0x01,0x13,0xb9,0x10,0x00,0x20,0x5c,0x49,
+0x81,0x00,0x60,0x39,0x40,0x00,0x95,0x01,0xe0,0x9f,0x0b,0xe0,0xf8,0x00,0x6b,0x28,
+0xb0,0x00,0x00,0x1e,0xd2,0x9f,0x90,0x08,0xda,0x10,0xe5,0x01,0x02,0x1e,0x08,0x00,
+0xf2,0x00,0x20,0x9f,0x80,0x83,0x00,0x54,0x80,0x00,0x00,0x0a,0xf7,0x97,0x0c,0x41,
+0xbf,0x60,0x00,0x09,0xf7,0x01,0x51,0x1d,0xf5,0x00,0x00,0x20,0x5a,0x02,0x24,0xef,
+0x30,0x12,0x06,0x14,0xe2,0x7e,0x04,0x28,0xf4,0x00,0x7e,0x00,0x1b,0xc7,0x38,0x09,
+0x11,0x00,0x6a,0x02,0xf7,0x02,0x88,0x77,0x77,0x7f,0xc7,0x77,0x78,0x81,0x0d,0xfe,
+0xee,0xee,0xff,0xee,0xee,0xef,0x20,0x09,0x0e,0x22,0x00,0xf8,0xc1,0x01,0x51,0x20,
+0x0f,0x80,0x04,0x80,0x2f,0x06,0x70,0xf8,0x00,0x6f,0x60,0x00,0x04,0xf8,0x22,0x00,
+0x40,0xbf,0x20,0x01,0xed,0x22,0x00,0x50,0x01,0xfb,0x01,0xcf,0x20,0x11,0x00,0x41,
+0x07,0xf5,0x1b,0x40,0x33,0x00,0x26,0x0b,0x30,0x44,0x00,0x23,0x0d,0xef,0x56,0x03,
+0x27,0x57,0x86,0x7e,0x01,0x10,0x24,0x05,0x00,0x52,0x6a,0x10,0x08,0x73,0xf1,0xba,
+0x03,0x32,0x3f,0x29,0xb0,0xe4,0x0d,0xb3,0x96,0x12,0x26,0x55,0x55,0x5a,0xf6,0x55,
+0x55,0x54,0x05,0x19,0x08,0x96,0xa0,0x01,0x11,0x11,0x18,0xf2,0x11,0x11,0x11,0x06,
+0x0e,0x61,0x04,0x30,0x07,0xf1,0x00,0x51,0x2d,0x05,0x40,0x7f,0x10,0x1e,0xc0,0x1f,
+0x05,0x20,0x07,0xf1,0x39,0x0c,0x20,0x5f,0x80,0x22,0x00,0x40,0xaf,0x10,0x2f,0xc0,
+0x55,0x00,0x41,0x02,0xfa,0x09,0xe1,0x33,0x00,0x35,0x08,0xc0,0x01,0x20,0x04,0x32,
+0x04,0xa9,0xdf,0x83,0x00,0x70,0x3c,0xdd,0x70,0x00,0x00,0x00,0x00,0x12,0x00,0x01,
+0x00,0x12,0x10,0x07,0x00,0xf1,0x18,0x01,0xdd,0xc1,0x00,0x00,0x00,0x06,0xa1,0x00,
+0x87,0x07,0x80,0x00,0x00,0x00,0x7f,0x10,0x08,0x70,0x87,0x00,0x00,0x00,0x07,0xf1,
+0x00,0x1b,0xeb,0x12,0x65,0x55,0x55,0xaf,0x65,0x55,0x55,0x40,0x5f,0xff,0x01,0x00,
+0xa2,0xfa,0x00,0x11,0x11,0x11,0x8f,0x21,0x11,0x11,0x10,0x22,0x00,0x00,0x01,0x00,
+0xf0,0x03,0x43,0x00,0x7f,0x10,0x05,0x10,0x00,0x00,0x0e,0xb0,0x07,0xf1,0x01,0xec,
+0x00,0x00,0x09,0xf2,0x11,0x00,0x40,0xf7,0x00,0x05,0xf8,0x22,0x00,0x40,0x0a,0xf2,
+0x02,0xfc,0x55,0x00,0x51,0x00,0x2f,0xc0,0x9e,0x10,0x33,0x00,0x31,0x8d,0x10,0x10,
+0x11,0x00,0x00,0x01,0x00,0x31,0x4a,0x9d,0xf0,0x08,0x00,0x31,0x03,0xcd,0xd7,0x8b,
+0x00,0x13,0x00,0x01,0x00,0x12,0xff,0x01,0x00,0xa2,0xe4,0x08,0x87,0x77,0x77,0x77,
+0x77,0x78,0xff,0x20,0x17,0x00,0x22,0x9f,0x70,0x08,0x00,0x22,0x5f,0xb0,0x08,0x00,
+0xf0,0x03,0x2f,0xe1,0x00,0x00,0x01,0xa2,0x00,0x00,0x2e,0xf3,0x00,0x00,0x00,0x3e,
+0xf5,0x00,0x2d,0xf3,0x16,0x00,0x41,0x1d,0xf7,0x4e,0xe3,0x1f,0x00,0x32,0x0b,0xff,
+0xd2,0x28,0x00,0x23,0x0a,0xf9,0x58,0x00,0x23,0x0b,0xf8,0x09,0x00,0x23,0x0c,0xf7,
+0x09,0x00,0x23,0x1d,0xf4,0x09,0x00,0x11,0x27,0x88,0x00,0x11,0x30,0x0c,0x00,0x40,
+0x0e,0xff,0xda,0x73,0x8f,0x00,0x50,0x47,0xad,0xff,0xfb,0x71,0x11,0x00,0x32,0x15,
+0x9e,0xf2,0x26,0x00,0x32,0x20,0x00,0x23,0x09,0x00,0x30,0xbf,0xfc,0x96,0x95,0x00,
+0x50,0x25,0x8b,0xef,0xfe,0x94,0x10,0x00,0x42,0x02,0x7b,0xfe,0x00,0xcb,0x00,0x04,
+0xc4,0x00,0x31,0x08,0xa7,0x41,0x7c,0x00,0x40,0xef,0xff,0xd9,0x51,0x4d,0x00,0x41,
+0x48,0xbf,0xff,0xc7,0xf6,0x00,0x32,0x48,0xdf,0xa0,0x2a,0x00,0x10,0x20,0x45,0x01,
+0x12,0x30,0x2e,0x00,0x23,0x02,0xfa,0x37,0x00,0x23,0x6f,0x40,0xab,0x00,0x13,0xf0,
+0x11,0x00,0x04,0x19,0x00,0x23,0x5f,0x50,0xcd,0x00,0x07,0x19,0x00,0x13,0x59,0x19,
+0x00,0x23,0x07,0xf5,0x19,0x00,0x23,0x0c,0xe0,0x32,0x00,0x22,0x4f,0x80,0x32,0x00,
+0xf1,0x08,0x02,0xdf,0x10,0x01,0x2c,0xf6,0x79,0xbc,0xef,0xff,0xf9,0x08,0xff,0xff,
+0xff,0xed,0xb9,0x75,0x3c,0xf1,0x39,0x75,0x32,0x38,0x00,0x13,0x80,0x49,0x00,0x12,
+0x71,0x82,0x00,0x03,0x65,0x01,0x13,0xaf,0x04,0x01,0xf0,0x07,0xc0,0x00,0x00,0x60,
+0x00,0x00,0x06,0xf5,0x00,0x00,0x6f,0xd2,0x00,0x00,0xde,0x00,0x00,0x00,0x5e,0xf7,
+0x00,0x6f,0x82,0x01,0x41,0x1b,0xfb,0x2e,0xd0,0xe2,0x00,0x21,0xff,0xf5,0x2b,0x00,
+0x21,0x09,0xff,0x9b,0x00,0x40,0x06,0xfd,0xef,0x70,0x07,0x00,0x40,0xfe,0x12,0xef,
+0x90,0x07,0x00,0xe0,0x20,0x01,0xdf,0x90,0x00,0x0a,0xfd,0x20,0x00,0x01,0xdf,0x50,
+0x5e,0xfa,0x03,0x01,0x32,0x80,0x8f,0xe6,0x64,0x00,0x12,0x61,0x07,0x00,0x20,0x05,
+0x66,0x01,0x00,0x31,0x64,0x00,0x0b,0xee,0x01,0x16,0xf9,0x54,0x02,0x0b,0x08,0x00,
+0x02,0x39,0x02,0x05,0x17,0x02,0x9e,0xf0,0x77,0x66,0x6b,0xf7,0x66,0x66,0x66,0x70,
+0x30,0x00,0x05,0x08,0x00,0x13,0xf2,0x62,0x00,0x40,0xfd,0x75,0x67,0x78,0x52,0x01,
+0x50,0x8f,0xff,0xff,0xff,0x60,0x12,0x00,0x72,0x12,0x22,0x10,0x00,0x00,0x01,0x63,
+0x1f,0x00,0x13,0x0f,0x03,0x01,0xf0,0x14,0xbd,0x00,0x00,0x03,0x68,0x10,0x00,0x06,
+0xf4,0x69,0xcf,0xff,0xf2,0x05,0x7a,0xdf,0xfe,0xb7,0x43,0xf8,0x00,0xee,0xb8,0xea,
+0x00,0x00,0xcd,0x00,0x01,0x00,0x09,0xe0,0x00,0xaf,0x20,0x31,0x01,0x21,0x30,0x9f,
+0xe9,0x00,0x31,0xf7,0x01,0x40,0x44,0x02,0x12,0xc0,0x3d,0x00,0x22,0x8f,0x10,0xcf,
+0x01,0x13,0xf5,0x54,0x00,0x12,0xa0,0x08,0x00,0x28,0x75,0x00,0x01,0x00,0x14,0x2d,
+0x6d,0x01,0x13,0xec,0x08,0x00,0x20,0x09,0xf1,0x61,0x02,0xf0,0x13,0x90,0x00,0x00,
+0x5f,0x51,0x47,0xbe,0xff,0xff,0x20,0x02,0x59,0xff,0xff,0xeb,0x85,0x5f,0x80,0x9f,
+0xff,0xee,0xf5,0x20,0x00,0x0d,0xd0,0x05,0x95,0x20,0x7f,0x20,0x00,0x0a,0xf3,0x5a,
+0x00,0x41,0xf7,0x00,0x08,0xf6,0x94,0x01,0x32,0xb0,0x08,0xf8,0xa4,0x01,0x31,0x00,
+0x15,0x00,0x73,0x01,0x04,0xbe,0x02,0x14,0x2f,0x5f,0x00,0x17,0xdd,0x5f,0x00,0x02,
+0x37,0x02,0x13,0x60,0xe7,0x03,0x11,0xb5,0x07,0x00,0x80,0x38,0x77,0x77,0x77,0x84,
+0x00,0x00,0x06,0x48,0x01,0x19,0xe0,0x92,0x00,0x22,0x0f,0x90,0x28,0x00,0x03,0x1a,
+0x03,0x22,0x4f,0x50,0x62,0x00,0x13,0xf3,0xe5,0x00,0xc0,0x00,0x00,0x19,0x88,0x88,
+0x88,0x8d,0xf8,0x88,0x22,0xfe,0xee,0x01,0x00,0xb0,0xf4,0x00,0x1a,0x99,0x99,0x99,
+0x99,0xb7,0x00,0x00,0x02,0x11,0x00,0x14,0xef,0x96,0x02,0x23,0xed,0x00,0x4f,0x00,
+0x13,0xb0,0xd9,0x02,0x04,0x73,0x03,0x39,0x4f,0x60,0x00,0x52,0x00,0x3a,0x00,0x9f,
+0x10,0xea,0x02,0x00,0x89,0x00,0x10,0x3a,0x54,0x00,0x61,0x9f,0xd9,0x9a,0x84,0xff,
+0xee,0x01,0x00,0x15,0xfc,0x41,0x01,0x70,0x05,0x55,0x55,0x55,0x55,0x53,0x0e,0xb8,
+0x00,0x02,0x52,0x00,0x18,0xe8,0x06,0x00,0x11,0x07,0x18,0x00,0x10,0x03,0x4f,0x02,
+0x09,0x1e,0x00,0x71,0x02,0x11,0x11,0x11,0x11,0xe8,0x1f,0x1e,0x00,0x80,0x05,0x44,
+0x44,0x44,0x44,0xf8,0x07,0x77,0x25,0x00,0x23,0x74,0x0e,0xd0,0x04,0x01,0x01,0x00,
+0x1f,0xea,0x07,0x00,0x02,0x11,0x06,0x84,0x00,0x30,0xfa,0x03,0x88,0x01,0x00,0x0f,
+0x2a,0x00,0x0a,0x12,0x3f,0x4d,0x00,0x11,0x18,0xae,0x04,0x23,0xfa,0x00,0x17,0x05,
+0x10,0x11,0x4e,0x01,0x31,0x10,0x00,0x0d,0x1d,0x00,0x30,0x10,0x00,0x56,0xc1,0x00,
+0x03,0x04,0x01,0x06,0xd6,0x00,0x11,0x88,0x01,0x00,0x21,0x80,0x7e,0xee,0x00,0x12,
+0xff,0xfc,0x03,0x22,0x0d,0xd0,0x51,0x02,0x13,0xf7,0x6b,0x04,0x12,0x10,0x19,0x04,
+0x18,0x60,0xfc,0x04,0x21,0x8f,0xc1,0xb5,0x04,0x01,0x4b,0x04,0x41,0x03,0xcf,0xfc,
+0x50,0x1a,0x04,0x10,0x93,0x06,0x00,0x10,0x23,0x57,0x00,0x10,0x3b,0x54,0x01,0x20,
+0xfb,0xbe,0x34,0x02,0x20,0xaa,0xe0,0xa3,0x00,0x1a,0xae,0x0b,0x00,0x11,0x0f,0x0b,
+0x00,0x10,0xf9,0x21,0x00,0x75,0x1f,0x7b,0xe0,0x00,0x00,0x04,0xf5,0x92,0x01,0x20,
+0x2f,0xb0,0x4d,0x05,0x60,0xf2,0x00,0x00,0x01,0x7f,0xe3,0xdc,0x03,0x00,0x69,0x00,
+0x11,0x3a,0x99,0x00,0x12,0x22,0xb3,0x04,0x00,0x61,0x04,0x23,0x0f,0xa0,0x01,0x01,
+0x15,0x0e,0x09,0x00,0x02,0x3f,0x02,0x1d,0xe9,0x09,0x00,0x13,0xf8,0x09,0x00,0x23,
+0x01,0xf7,0x09,0x00,0x20,0x02,0xf5,0x09,0x00,0x50,0x01,0x20,0x00,0x06,0xf3,0x09,
+0x00,0x50,0x0c,0xd0,0x00,0x0c,0xe0,0x09,0x00,0xf0,0x07,0xbf,0x60,0x00,0x4f,0x70,
+0x00,0x0e,0x90,0x1b,0xf7,0x00,0x00,0xcf,0x10,0x00,0x0e,0xa5,0xef,0x60,0x00,0x0b,
+0xf6,0x8e,0x05,0x93,0xd3,0x00,0x00,0x7f,0x80,0x00,0x00,0x0e,0xf7,0x60,0x05,0x01,
+0xab,0x04,0x13,0x12,0xaf,0x04,0x12,0x10,0x4d,0x02,0x1f,0x00,0x07,0x00,0x13,0x21,
+0x04,0xb0,0x07,0x00,0x31,0x3f,0xd1,0x9f,0xb2,0x04,0x70,0x10,0x9f,0x00,0x00,0x01,
+0xaf,0xc1,0x1c,0x00,0xe1,0x7e,0xf8,0x00,0x00,0x9f,0x02,0x7e,0xfc,0x30,0x00,0x00,
+0x9f,0xdf,0xfc,0x34,0x04,0x29,0xd8,0x20,0xd2,0x05,0x02,0x20,0x03,0x02,0x84,0x04,
+0x30,0xf7,0x1f,0xc8,0xb9,0x01,0x32,0x9f,0x70,0xf7,0xdc,0x00,0x11,0x0f,0x9b,0x06,
+0x1f,0x1f,0x0f,0x00,0x1a,0x30,0x71,0xfb,0x77,0x01,0x00,0x22,0xf7,0x1f,0x53,0x00,
+0x21,0x71,0xf8,0x1e,0x01,0x32,0xf7,0x01,0x00,0x0c,0x07,0x20,0x34,0x44,0x01,0x00,
+0x22,0x54,0x08,0x1e,0x00,0xa2,0xf6,0x8f,0x32,0x22,0x22,0x22,0x22,0x9f,0x38,0xf1,
+0x05,0x06,0x02,0x76,0x04,0x32,0xdd,0x08,0xf1,0x74,0x04,0x01,0x0f,0x00,0x31,0x06,
+0xf6,0x01,0xb2,0x00,0x22,0xdf,0x10,0x72,0x03,0x02,0x81,0x01,0x22,0x1e,0xe1,0x82,
+0x04,0x02,0x2c,0x04,0x21,0x5e,0xf5,0x07,0x01,0x21,0xcf,0xe3,0xfe,0x06,0x12,0xff,
+0x38,0x04,0x21,0x37,0x10,0x7b,0x00,0x13,0xb2,0x95,0x02,0x13,0xfe,0x84,0x06,0x23,
+0x3e,0xf7,0xf4,0x00,0x10,0xcf,0x4a,0x00,0x56,0x80,0x00,0x00,0x0b,0xa0,0xe8,0x04,
+0x23,0x0d,0xe1,0x9f,0x02,0x12,0x50,0x97,0x06,0x13,0xf8,0x90,0x01,0x12,0xa0,0x6e,
+0x00,0x12,0xf9,0x05,0x07,0x02,0x75,0x05,0x30,0x28,0xff,0xb2,0x46,0x07,0x31,0x9d,
 0xff,0xc4,0x3a,0x00,0x29,0xfe,0x94,0x72,0x06,0x0c,0xf7,0x07,0x40,0xf0,0x0b,0xba,
-0xaa,0x01,0x00,0x1c,0xab,0x76,0x01,0x00,0x78,0x21,0x23,0x07,0x77,0x01,0x00,0x10,
-0x10,0xe6,0x04,0x04,0x50,0x03,0x14,0xd9,0x98,0x18,0x1f,0x90,0x11,0x00,0x0e,0x04,
-0xf7,0x03,0x5e,0xdc,0x77,0x77,0x77,0x40,0x33,0x00,0x0f,0x11,0x00,0x16,0x13,0x0e,
-0x92,0x00,0x23,0xfe,0x67,0x91,0x00,0x14,0x70,0x09,0x00,0x14,0x6c,0x1a,0x00,0x13,
-0x00,0x8e,0x36,0x04,0xc6,0x32,0x18,0x00,0x11,0x00,0x23,0x9f,0xd6,0x11,0x00,0x13,
-0xfa,0xad,0x0c,0x43,0x9e,0x03,0xcf,0xc2,0x22,0x00,0x23,0x5e,0xf7,0x33,0x00,0x2e,
-0x1a,0x40,0x44,0x00,0x0f,0x11,0x00,0x0e,0x13,0x06,0x88,0x00,0x23,0x72,0x0c,0x89,
-0x00,0x11,0xf5,0xaf,0x06,0x1b,0xe1,0x97,0x2e,0x24,0x05,0xff,0x9a,0x05,0x22,0xff,
-0x3c,0x9e,0x31,0x42,0xfb,0x8f,0x1a,0xf9,0xb4,0x1e,0xa0,0x7f,0x00,0x6f,0xd3,0x00,
-0x00,0x2b,0xf9,0x00,0x7f,0xea,0x14,0x50,0x08,0xfe,0x40,0x00,0x7f,0x3e,0x09,0x22,
-0x0d,0x90,0x7c,0x0e,0x17,0x94,0x85,0x0e,0x0f,0x09,0x00,0x0f,0x22,0x56,0x66,0x01,
-0x00,0x17,0x5b,0x18,0x01,0x24,0x03,0xf1,0xba,0x0b,0x10,0x10,0x9c,0x00,0x30,0xee,
-0xee,0xee,0x46,0x06,0xb1,0x00,0xdb,0x66,0x66,0x9f,0x86,0x66,0x6a,0xf0,0x0d,0x80,
-0x22,0x00,0xf9,0x0a,0x5f,0x00,0xd8,0x07,0x50,0x3f,0x10,0x46,0x05,0xf0,0x0d,0x80,
-0xb7,0x03,0xf1,0x08,0xb0,0x5f,0x00,0xd8,0x0b,0x70,0x3f,0x10,0x8b,0x11,0x00,0x40,
-0x92,0x6f,0x42,0x9b,0x11,0x00,0x40,0xbf,0xff,0xff,0xff,0x11,0x00,0x02,0xde,0x00,
-0x00,0x44,0x00,0x00,0x1f,0x37,0x12,0x9f,0x11,0x00,0x21,0x1f,0xfe,0x0f,0x00,0x13,
-0x51,0x45,0x13,0x2e,0xf2,0x00,0x08,0x00,0x84,0x06,0x66,0x66,0x69,0xf8,0x66,0x66,
-0x66,0x82,0x15,0x21,0x1f,0x40,0x18,0x00,0x1f,0x7f,0x08,0x00,0x06,0x75,0x51,0x11,
-0x15,0xf4,0x11,0x11,0x8f,0x30,0x00,0x91,0x74,0x44,0x47,0xf6,0x44,0x44,0x9f,0x08,
-0x20,0x20,0x00,0x1e,0x37,0x68,0x00,0x0d,0x08,0x00,0x00,0x0a,0x01,0xf2,0x02,0x64,
-0x00,0x00,0x03,0x56,0x78,0x9a,0xbd,0xff,0xfe,0xb1,0x00,0x00,0x8e,0xdc,0xba,0xbf,
-0xd9,0x3a,0x05,0xfa,0x2e,0x13,0xcf,0x16,0x03,0x91,0x00,0x03,0x48,0xf4,0x47,0xf6,
-0x44,0xf8,0x44,0x0d,0x2f,0x91,0x3f,0x20,0x0f,0x50,0x00,0x00,0x34,0x48,0xf5,0x13,
-0x00,0x26,0x40,0x0c,0x5c,0x01,0x41,0x05,0xf0,0x03,0xf2,0x0d,0x2f,0xa3,0x11,0x6f,
-0x11,0x4f,0x31,0x1f,0x61,0x10,0x00,0x0f,0x1d,0x00,0xa0,0x40,0x00,0x22,0x22,0x3d,
-0xff,0xfd,0x32,0x22,0x20,0xde,0x19,0x40,0xb4,0xf4,0xce,0x60,0x9c,0x03,0xa0,0xee,
-0x60,0x3f,0x20,0x7f,0xd8,0x20,0x00,0xbf,0xd6,0x72,0x00,0x50,0x18,0xef,0xc0,0x03,
-0x40,0xa6,0x5a,0x00,0x6d,0x58,0x12,0x06,0xb9,0x01,0x13,0x71,0xe2,0x00,0x19,0xf9,
-0xd3,0x20,0x23,0x1b,0xf7,0xf0,0x11,0x12,0x30,0xe5,0x30,0x14,0x70,0x4c,0x28,0x02,
-0x08,0x00,0x1f,0xf4,0x08,0x00,0x22,0x32,0x65,0x58,0xf3,0xf5,0x00,0x11,0xfd,0x75,
-0x03,0x00,0x67,0x2e,0x22,0x04,0xf1,0xbe,0x22,0x10,0x36,0xc7,0x5a,0x00,0x61,0x00,
-0x42,0x06,0xf0,0x04,0xf1,0x4d,0x33,0x60,0x6f,0x00,0x4f,0x11,0x7e,0x40,0x6b,0x4f,
-0xf0,0x17,0xf0,0x04,0xfb,0xff,0xf5,0x00,0x0d,0xf7,0x00,0x6f,0x17,0xef,0xd6,0x0f,
-0x50,0x0b,0xef,0x70,0x08,0xff,0xfc,0xf1,0x00,0xf5,0x06,0xf4,0xe7,0x6d,0xff,0x61,
-0x4f,0x10,0x0f,0x50,0x16,0x0e,0x76,0x99,0x39,0x00,0x40,0xf4,0x00,0x00,0xe7,0x39,
-0x00,0x60,0x10,0x1f,0x40,0x00,0x0e,0x70,0x4c,0x00,0x23,0x04,0xf2,0x13,0x00,0x33,
-0x3f,0xfc,0x00,0x13,0x00,0x22,0x43,0x00,0x13,0x00,0x41,0x02,0x00,0x02,0xa1,0x13,
-0x00,0x02,0x71,0x2f,0xf0,0x02,0xe7,0x00,0x3f,0xb8,0x77,0x77,0x8d,0xc0,0x00,0x0e,
-0x70,0x00,0x6b,0xcc,0xcc,0xcc,0xa2,0xcb,0x01,0x00,0x3c,0x03,0x14,0x54,0xa5,0x17,
-0x24,0x0c,0xa0,0xa5,0x28,0x13,0xca,0x13,0x34,0x01,0x13,0x00,0xd0,0x06,0xf4,0x37,
-0x77,0x77,0x77,0xed,0x77,0x00,0x02,0xff,0x06,0xee,0x43,0x19,0x52,0xe0,0x00,0xcf,
-0xf0,0x00,0x26,0x00,0x32,0xbf,0xbf,0x00,0x26,0x00,0x51,0x0d,0x66,0xf0,0x00,0xe7,
-0x13,0x00,0x20,0x10,0x6f,0xc2,0x0a,0x01,0x39,0x00,0x10,0xf0,0x68,0x0a,0x12,0xca,
-0xf8,0x2f,0x23,0x3f,0x70,0x13,0x00,0x24,0x00,0x84,0x13,0x00,0x03,0x5f,0x00,0x04,
-0x4c,0x00,0x00,0x13,0x00,0x42,0x04,0x44,0x4e,0x90,0x13,0x00,0x3a,0xaf,0xff,0xd3,
-0x85,0x12,0x03,0x74,0x02,0x00,0x54,0x2b,0x21,0x0a,0xb0,0xa0,0x16,0x41,0x01,0xf5,
-0x0a,0xb0,0xbd,0x0a,0x22,0x05,0xf1,0x08,0x3a,0x51,0xe0,0x09,0xe0,0x0a,0xb0,0x76,
-0x13,0x12,0x0d,0x0b,0x1d,0xc1,0xcf,0x60,0x3f,0x75,0x5c,0xd5,0x55,0x50,0x08,0xff,
-0x60,0xad,0x2c,0x3a,0x41,0x4f,0x9e,0x61,0xe5,0x09,0x00,0x42,0x1b,0x0e,0x60,0x10,
-0x3e,0x3a,0xb1,0x0e,0x60,0x66,0x66,0x6c,0xd6,0x66,0x66,0x00,0x0e,0x61,0x29,0x02,
-0x43,0xfd,0x00,0x0e,0x60,0x59,0x3a,0x0f,0x09,0x00,0x1a,0x0f,0x01,0x00,0x01,0x13,
-0x9a,0xad,0x1a,0x00,0xfb,0x1d,0x40,0x25,0x8b,0xff,0xe2,0xf6,0x21,0x50,0xad,0xff,
-0xff,0xa6,0x20,0x2c,0x07,0x44,0x29,0x75,0x29,0xd0,0xd6,0x12,0x11,0x8d,0x9c,0x02,
-0x50,0xf0,0x00,0x00,0x08,0xd0,0xe3,0x00,0x13,0xef,0x13,0x00,0x23,0x4f,0xb6,0x13,
-0x00,0x43,0x01,0xb0,0x6f,0x2f,0x0a,0x13,0xb4,0x06,0xf1,0x66,0x66,0x6b,0xe6,0x66,
-0x66,0x10,0x00,0x6f,0x39,0x00,0x14,0x06,0x39,0x00,0x0f,0x13,0x00,0x0c,0x11,0x26,
-0x39,0x00,0x41,0x00,0x00,0x6f,0x06,0xb3,0x09,0x11,0xd0,0xce,0x31,0x24,0x0c,0x50,
-0x06,0x17,0x14,0xcb,0x87,0x05,0x22,0x07,0xf0,0xf3,0x07,0xa2,0x66,0x66,0x89,0x66,
-0x66,0x20,0x00,0x09,0xf0,0x0e,0x8f,0x1c,0x00,0x9b,0x47,0x03,0x0d,0x34,0xd0,0xe0,
-0x00,0x68,0x00,0x00,0x6d,0x10,0x00,0xde,0x9e,0x00,0x08,0xd0,0xf8,0x2f,0x30,0x0c,
-0x37,0xe0,0xe7,0x32,0x11,0xab,0xdf,0x32,0x30,0x02,0xf3,0x00,0xc2,0x04,0x20,0x07,
-0xe0,0xf9,0x25,0x12,0xf5,0xf2,0x32,0x10,0xc9,0x98,0x03,0x00,0x13,0x00,0x42,0x0a,
-0xb0,0x06,0xe0,0x13,0x00,0x10,0x8d,0x2f,0x00,0x00,0x13,0x00,0x21,0x04,0x50,0xd5,
-0x19,0xc1,0x7e,0x05,0x77,0x77,0x77,0xf9,0x77,0x70,0x00,0x07,0xe0,0xae,0xa2,0x00,
-0x13,0x10,0xdc,0x0e,0x21,0x37,0x10,0x28,0x06,0x31,0x14,0x7a,0xef,0xb4,0x2c,0x51,
-0x0b,0xef,0xfd,0xfb,0x30,0xbe,0x0c,0x41,0xf9,0x30,0x0c,0x80,0xc4,0x16,0x42,0x0f,
-0x50,0x00,0xb9,0xde,0x20,0x40,0xf5,0x00,0x0a,0xa0,0x21,0x06,0x50,0x60,0x0f,0x50,
-0x00,0x9b,0x6f,0x4b,0x30,0xe6,0x00,0xf9,0xf8,0x00,0xf2,0x00,0x50,0x6d,0x1e,0x60,
-0x0f,0xfe,0xee,0xff,0xee,0xec,0x00,0x20,0xe6,0x00,0xf5,0x9b,0x03,0x10,0x0e,0x26,
-0x00,0x01,0xf1,0x2b,0x10,0xe6,0xa8,0x00,0x14,0xf6,0x13,0x00,0x23,0x0c,0xa0,0x13,
-0x00,0x40,0xd1,0x7f,0x00,0xe1,0x13,0x00,0xfc,0x09,0x51,0x49,0xa2,0xf8,0x2e,0x00,
-0x00,0xe6,0x05,0xfe,0xfe,0x2f,0x28,0xfe,0xa0,0x00,0x0e,0x60,0x8c,0x72,0x00,0x73,
-0x09,0xc2,0xa7,0x12,0x22,0x10,0x00,0xd2,0x00,0x24,0x00,0xf5,0x89,0x1c,0x00,0xeb,
-0x04,0x02,0xf0,0x26,0x12,0xf5,0x1f,0x2f,0x30,0x11,0x11,0x1f,0x01,0x58,0x33,0x03,
-0xf8,0x4f,0x1c,0x05,0x81,0xcf,0x61,0x44,0x45,0xff,0xf9,0x44,0x44,0x66,0x51,0xf2,
-0x07,0x6d,0xfc,0xc0,0x00,0x00,0x2f,0xae,0x60,0x00,0x0c,0x5f,0x6e,0x30,0x00,0x00,
-0xb0,0xe6,0x00,0x05,0xd0,0xf5,0x7b,0x69,0x02,0x41,0xd6,0x0f,0x51,0xf4,0x98,0x00,
-0x50,0x8e,0x00,0xf5,0x09,0xe1,0x13,0x00,0xf0,0x05,0x4f,0x40,0x0f,0x50,0x1e,0xb0,
-0x00,0x00,0xe6,0x3f,0xa5,0x55,0xf9,0x55,0x6f,0xa0,0x00,0x0e,0x7c,0xb1,0x71,0x09,
-0x51,0x6f,0x20,0x00,0xe6,0x10,0x72,0x00,0x11,0x10,0xa2,0x02,0x02,0x85,0x00,0x10,
-0xe6,0xe6,0x1e,0x0b,0xb2,0x00,0x14,0xb8,0x2d,0x44,0x44,0x3f,0x50,0x09,0xf0,0xc1,
-0x2f,0x14,0xf9,0x0c,0x27,0x12,0x7f,0x7b,0x05,0xe1,0xcf,0x00,0x1e,0xb6,0xfa,0x66,
-0x66,0x61,0x00,0x7f,0xe0,0x09,0xe1,0x0f,0x50,0x27,0x32,0xfe,0x05,0xf5,0x2f,0x01,
-0xf1,0x03,0xc8,0xe0,0xd9,0x00,0x0f,0xed,0xdd,0xdb,0x00,0x71,0x7e,0x01,0x00,0x00,
-0xfa,0x66,0x66,0x50,0x00,0x01,0x24,0x0f,0x60,0xea,0x34,0x14,0xf6,0x13,0x01,0x42,
-0x0f,0xa5,0x55,0x55,0x13,0x00,0x01,0x9d,0x03,0x0e,0x26,0x00,0x0e,0x13,0x00,0x0f,
-0x01,0x00,0x03,0x00,0xb4,0x3a,0x14,0xd8,0xa4,0x1a,0x21,0x0d,0x80,0x08,0x08,0x13,
-0x6f,0x4d,0x01,0x81,0x0c,0xd0,0x55,0x55,0x5e,0xb5,0x55,0x55,0x79,0x20,0x21,0x00,
-0xd8,0xa6,0x5a,0xf0,0x06,0x70,0x7d,0xdd,0xdf,0xed,0xdd,0xd5,0x01,0xed,0xe7,0x08,
-0xd5,0x55,0xeb,0x55,0x5f,0x50,0x9e,0x2e,0x70,0x8c,0x39,0x00,0x80,0xf5,0x02,0x30,
-0xe7,0x08,0xc0,0x00,0xd8,0x20,0x01,0x60,0x0e,0x70,0x8f,0xdd,0xdf,0xed,0x12,0x49,
-0xd0,0xe7,0x03,0x75,0x55,0xf9,0x55,0x55,0x20,0x00,0x0e,0x70,0x3f,0x40,0xb5,0x02,
-0x00,0x50,0x05,0x31,0x7f,0x4a,0xd0,0xc7,0x0e,0x14,0x70,0x28,0x2c,0x60,0xe7,0x00,
-0x08,0xfe,0xfa,0x40,0x13,0x00,0xf5,0x06,0x73,0x8e,0xf5,0x04,0xbf,0xeb,0x85,0x00,
-0x00,0xe7,0x5d,0x61,0x00,0x00,0x15,0x9c,0xa0,0x00,0x00,0x1b,0x30,0xde,0x08,0x10,
-0xef,0x54,0x04,0x00,0xf0,0x03,0x40,0x0e,0x94,0x44,0x44,0x45,0x00,0x11,0xae,0x88,
-0x01,0x10,0x8d,0xa7,0x04,0x20,0x0e,0x60,0xa6,0x03,0x00,0x13,0x2a,0xa1,0xe9,0x44,
-0x44,0x44,0xad,0x00,0x0c,0xff,0x70,0x0e,0x2f,0x4d,0x20,0x08,0xf4,0x13,0x2f,0x10,
-0xc9,0xa6,0x11,0x10,0x0e,0xba,0x53,0x11,0x90,0x72,0x00,0xf1,0x01,0x4d,0xdd,0xdd,
-0xff,0xdd,0xdd,0xc0,0x00,0x0e,0x72,0x66,0x66,0xef,0xfc,0x66,0x66,0xd1,0x2f,0x33,
-0x8e,0xec,0xf5,0x98,0x00,0x32,0x4c,0x96,0xf2,0xfb,0x05,0xc0,0x60,0xc9,0x0a,0xe3,
-0x00,0x00,0x0e,0x71,0xaf,0x70,0x0c,0x90,0x86,0x0c,0x50,0xe7,0x8e,0x50,0x00,0xc9,
-0xdd,0x12,0x30,0x0e,0x70,0x10,0x4c,0x00,0x1f,0x01,0x56,0x01,0x02,0x13,0x6c,0x9c,
-0x3b,0x23,0x00,0xd9,0xda,0x25,0x10,0x04,0x77,0x4f,0x10,0x70,0x12,0x02,0x13,0xa1,
-0xa0,0x07,0x22,0x2f,0x60,0xe9,0x1d,0x02,0xe1,0x5e,0x01,0xb1,0x1f,0x11,0x60,0x01,
-0x11,0x41,0x60,0x3f,0x7e,0x60,0x17,0x2c,0x50,0x00,0x2b,0x0e,0x60,0x02,0x23,0x00,
-0x00,0x78,0x02,0x02,0x1b,0x00,0x01,0x81,0x02,0x02,0x98,0x11,0x20,0x60,0x0d,0x1c,
-0x4a,0x10,0x80,0x51,0x03,0x50,0x75,0x55,0x55,0x5c,0x90,0x09,0x00,0x00,0xb0,0x31,
-0x0a,0x09,0x00,0x41,0x63,0x33,0x33,0x3b,0x09,0x00,0x00,0x03,0x04,0x07,0x04,0x1e,
-0x00,0x8d,0x00,0x23,0x08,0xb0,0xe3,0x25,0x03,0x55,0x2e,0x12,0x7f,0xd6,0x3b,0x10,
-0x50,0x85,0x0d,0x50,0x7f,0xd3,0x33,0x39,0xd0,0x4c,0x28,0x30,0x5f,0x8d,0x90,0xfd,
-0x54,0x70,0xef,0x42,0xd8,0x80,0x2d,0xb8,0xf4,0x98,0x4e,0xf1,0x11,0x2f,0x00,0x00,
-0x7f,0xfa,0x00,0x00,0x5f,0x6f,0x42,0xf1,0x48,0xee,0x76,0xef,0x95,0x02,0xa1,0xf4,
-0x2f,0xae,0xa5,0x01,0x61,0x5a,0xd1,0x00,0x0f,0x42,0xf1,0x00,0x05,0x92,0x30,0xf1,
-0x01,0xf4,0x2f,0x01,0x8e,0xc3,0x04,0x70,0x00,0x00,0x0f,0x42,0xf0,0x08,0x30,0x08,
-0xf5,0x13,0x00,0x60,0x00,0x04,0x9e,0xb2,0x05,0x50,0x13,0x00,0xe1,0x0c,0xd7,0x20,
-0x19,0xf5,0x00,0x00,0xf4,0x04,0x00,0x10,0x02,0x8f,0xb3,0x9d,0x44,0x21,0x36,0x9d,
-0x02,0x02,0x5a,0xf4,0x00,0x0b,0xc8,0x50,0x4c,0x1a,0x22,0x02,0xe2,0x6f,0x03,0x01,
-0x85,0x38,0x02,0x20,0x06,0x32,0x1f,0x65,0xff,0xd1,0x38,0x80,0x08,0xe0,0x14,0x86,
-0x44,0x44,0x79,0x52,0x24,0x29,0x21,0x0c,0x80,0x24,0x61,0x40,0xaf,0x60,0x00,0x6e,
-0xf1,0x02,0x00,0x5d,0x02,0x41,0x01,0xf3,0x00,0x6f,0x03,0x04,0xa2,0x55,0x5a,0x65,
-0x5c,0xc5,0x55,0x00,0xc0,0xe6,0x1f,0x3f,0x0c,0x05,0x49,0x01,0x00,0x5b,0x00,0x00,
-0x7e,0x5e,0x10,0x52,0x53,0x01,0x13,0x07,0xef,0x29,0x11,0xe6,0x86,0x35,0x11,0xe7,
+0xaa,0x01,0x00,0x1d,0xab,0x76,0x01,0x53,0xff,0xff,0xf2,0x07,0x77,0x01,0x00,0x10,
+0x10,0xe6,0x04,0x04,0x50,0x03,0x23,0xd9,0x00,0x95,0x00,0x1f,0x90,0x11,0x00,0x0e,
+0x04,0xf7,0x03,0x5e,0xdc,0x77,0x77,0x77,0x40,0x33,0x00,0x0f,0x11,0x00,0x16,0x13,
+0x0e,0x92,0x00,0x23,0xfe,0x67,0x91,0x00,0x14,0x70,0x09,0x00,0x14,0x6c,0x1a,0x00,
+0x00,0xa2,0x00,0x13,0xe0,0x34,0x00,0x14,0x9e,0x99,0x05,0x14,0xe0,0xff,0x04,0x13,
+0xd6,0x11,0x00,0x32,0xfa,0xfd,0x50,0x22,0x00,0x33,0x03,0xcf,0xc2,0x22,0x00,0x23,
+0x5e,0xf7,0x33,0x00,0x2e,0x1a,0x40,0x44,0x00,0x0f,0x11,0x00,0x0e,0x13,0x06,0x88,
+0x00,0x23,0x72,0x0c,0x89,0x00,0x11,0xf5,0xaf,0x06,0x23,0xe1,0x00,0xcb,0x05,0x13,
+0x50,0xe7,0x01,0x14,0xff,0x9a,0x05,0x31,0xff,0x3c,0x40,0x15,0x02,0x41,0xfb,0x8f,
+0x1a,0xf9,0x22,0x00,0xf0,0x05,0xa0,0x7f,0x00,0x6f,0xd3,0x00,0x00,0x2b,0xf9,0x00,
+0x7f,0x00,0x02,0xdf,0x60,0x08,0xfe,0x40,0x00,0x7f,0x3e,0x09,0x30,0x0d,0x90,0x00,
+0x09,0x00,0x11,0x00,0xc0,0x01,0x14,0x7f,0x9d,0x01,0x0f,0x09,0x00,0x0d,0x22,0x56,
+0x66,0x01,0x00,0x17,0x5b,0x18,0x01,0x14,0x03,0xa0,0x06,0x20,0x3f,0x10,0x9c,0x00,
+0x30,0xee,0xee,0xee,0x46,0x06,0xb1,0x00,0xdb,0x66,0x66,0x9f,0x86,0x66,0x6a,0xf0,
+0x0d,0x80,0x22,0x00,0xf9,0x0a,0x5f,0x00,0xd8,0x07,0x50,0x3f,0x10,0x46,0x05,0xf0,
+0x0d,0x80,0xb7,0x03,0xf1,0x08,0xb0,0x5f,0x00,0xd8,0x0b,0x70,0x3f,0x10,0x8b,0x11,
+0x00,0x40,0x92,0x6f,0x42,0x9b,0x11,0x00,0x40,0xbf,0xff,0xff,0xff,0x11,0x00,0x01,
+0xde,0x00,0x00,0x11,0x00,0x00,0x39,0x02,0x22,0x44,0x9f,0x11,0x00,0x21,0x1f,0xfe,
+0x0f,0x00,0x12,0x51,0x76,0x00,0x3e,0x04,0xf2,0x00,0x08,0x00,0x93,0x06,0x66,0x66,
+0x69,0xf8,0x66,0x66,0x66,0x1f,0xa8,0x00,0x21,0x1f,0x40,0x18,0x00,0x1f,0x7f,0x08,
+0x00,0x06,0x75,0x51,0x11,0x15,0xf4,0x11,0x11,0x8f,0x30,0x00,0x91,0x74,0x44,0x47,
+0xf6,0x44,0x44,0x9f,0x08,0x20,0x20,0x00,0x1e,0x37,0x68,0x00,0x0d,0x08,0x00,0x00,
+0x0a,0x01,0xf3,0x04,0x64,0x00,0x00,0x03,0x56,0x78,0x9a,0xbd,0xff,0xfe,0xb1,0x00,
+0x00,0x8e,0xdc,0xba,0xbf,0x85,0x31,0x1a,0x00,0x02,0x25,0x00,0x13,0xcf,0x16,0x03,
+0xa0,0x00,0x03,0x48,0xf4,0x47,0xf6,0x44,0xf8,0x44,0x00,0x19,0x01,0x91,0x3f,0x20,
+0x0f,0x50,0x00,0x00,0x34,0x48,0xf5,0x13,0x00,0x26,0x40,0x0c,0x5c,0x01,0x50,0x05,
+0xf0,0x03,0xf2,0x00,0xf3,0x01,0xa3,0x11,0x6f,0x11,0x4f,0x31,0x1f,0x61,0x10,0x00,
+0x0f,0x1d,0x00,0x90,0x40,0x00,0x22,0x22,0x3d,0xff,0xfd,0x32,0x22,0x79,0x03,0x50,
+0x6e,0xb4,0xf4,0xce,0x60,0x9c,0x03,0xa0,0xee,0x60,0x3f,0x20,0x7f,0xd8,0x20,0x00,
+0xbf,0xd6,0x72,0x00,0xe2,0x18,0xef,0xc0,0x03,0x40,0x00,0x00,0x3f,0x20,0x00,0x00,
+0x55,0x00,0x06,0xb9,0x01,0x13,0x71,0xe2,0x00,0x13,0xf9,0x41,0x02,0x02,0xe3,0x03,
+0x22,0x1b,0xf7,0xd0,0x07,0x21,0xed,0x30,0xa2,0x03,0x33,0xdf,0x70,0x00,0xde,0x05,
+0x02,0x08,0x00,0x1f,0xf4,0x08,0x00,0x22,0x32,0x65,0x58,0xf3,0xf5,0x00,0x22,0xfd,
+0x90,0x48,0x04,0x32,0x20,0x00,0x04,0xf2,0x04,0x51,0xd0,0x36,0x00,0x4f,0x10,0x61,
+0x00,0x22,0x06,0xf0,0x13,0x00,0xf0,0x23,0xad,0x00,0x6f,0x00,0x4f,0x11,0x7e,0x40,
+0x00,0x3f,0x70,0x06,0xf0,0x04,0xfb,0xff,0xf5,0x00,0x0d,0xf7,0x00,0x6f,0x17,0xef,
+0xd6,0x0f,0x50,0x0b,0xef,0x70,0x08,0xff,0xfc,0xf1,0x00,0xf5,0x06,0xf4,0xe7,0x6d,
+0xff,0x61,0x4f,0x10,0x0f,0x50,0x16,0x0e,0x76,0x99,0x39,0x00,0x40,0xf4,0x00,0x00,
+0xe7,0x39,0x00,0x60,0x10,0x1f,0x40,0x00,0x0e,0x70,0x4c,0x00,0x23,0x04,0xf2,0x13,
+0x00,0x33,0x3f,0xfc,0x00,0x13,0x00,0x22,0x43,0x00,0x13,0x00,0x41,0x02,0x00,0x02,
+0xa1,0x13,0x00,0x00,0x74,0x01,0xf0,0x04,0x10,0x00,0xe7,0x00,0x3f,0xb8,0x77,0x77,
+0x8d,0xc0,0x00,0x0e,0x70,0x00,0x6b,0xcc,0xcc,0xcc,0xa2,0xcb,0x01,0x00,0x3c,0x03,
+0x10,0x54,0x90,0x00,0x10,0xeb,0xca,0x02,0x10,0xa0,0xab,0x07,0x00,0x12,0x01,0x11,
+0xca,0xb1,0x09,0x03,0x13,0x00,0xc0,0x06,0xf4,0x37,0x77,0x77,0x77,0xed,0x77,0x00,
+0x02,0xff,0x06,0x2e,0x09,0x62,0xfe,0xe0,0x00,0xcf,0xf0,0x00,0x26,0x00,0x32,0xbf,
+0xbf,0x00,0x26,0x00,0x51,0x0d,0x66,0xf0,0x00,0xe7,0x13,0x00,0x20,0x10,0x6f,0xc2,
+0x0a,0x01,0x39,0x00,0x10,0xf0,0x68,0x0a,0x10,0xca,0x55,0x00,0x43,0x00,0x00,0x3f,
+0x70,0x13,0x00,0x24,0x00,0x84,0x13,0x00,0x03,0x5f,0x00,0x04,0x4c,0x00,0x00,0x13,
+0x00,0x42,0x04,0x44,0x4e,0x90,0x13,0x00,0x39,0xaf,0xff,0xd3,0xec,0x0d,0x05,0x69,
+0x05,0x41,0x5f,0x20,0x20,0x0a,0x48,0x08,0x51,0xcc,0x01,0xf5,0x0a,0xb0,0xbd,0x0a,
+0x21,0x05,0xf1,0x09,0x00,0x41,0x0a,0xe0,0x09,0xe0,0x09,0x00,0x21,0x3f,0x80,0xb9,
+0x08,0xf0,0x00,0xf1,0x00,0xcf,0x60,0x3f,0x75,0x5c,0xd5,0x55,0x50,0x08,0xff,0x60,
+0xad,0x00,0x1b,0x00,0x41,0x4f,0x9e,0x61,0xe5,0x09,0x00,0x51,0x1b,0x0e,0x60,0x10,
+0x00,0x2d,0x00,0xb1,0x0e,0x60,0x66,0x66,0x6c,0xd6,0x66,0x66,0x00,0x0e,0x61,0x29,
+0x02,0x54,0xfd,0x00,0x0e,0x60,0x00,0x1b,0x00,0x0f,0x09,0x00,0x18,0x0f,0x01,0x00,
+0x01,0x10,0x9a,0x05,0x00,0x11,0x45,0x3f,0x07,0xe0,0x00,0x25,0x8b,0xff,0xe2,0x00,
+0x00,0x08,0xe4,0xad,0xff,0xff,0xa6,0x20,0x2c,0x07,0x41,0x29,0x75,0x29,0xd0,0x2f,
+0x02,0x41,0x00,0x00,0x00,0x8d,0x9c,0x02,0x50,0xf0,0x00,0x00,0x08,0xd0,0xe3,0x00,
+0x13,0xef,0x13,0x00,0x23,0x4f,0xb6,0x13,0x00,0x41,0x01,0xb0,0x6f,0x2f,0x9e,0x00,
+0xd4,0xf3,0x00,0x06,0xf1,0x66,0x66,0x6b,0xe6,0x66,0x66,0x10,0x00,0x6f,0x39,0x00,
+0x14,0x06,0x39,0x00,0x0f,0x13,0x00,0x0c,0x11,0x26,0x39,0x00,0x41,0x00,0x00,0x6f,
+0x06,0xb3,0x09,0x81,0xd0,0x00,0x00,0x07,0x60,0x00,0x0c,0x50,0xc3,0x02,0x44,0xf6,
+0x00,0x00,0xcb,0x87,0x05,0x22,0x07,0xf0,0xf3,0x07,0x91,0x66,0x66,0x89,0x66,0x66,
+0x20,0x00,0x09,0xf0,0x30,0x06,0x44,0xf4,0x00,0x04,0xfe,0xd3,0x06,0xb0,0xef,0xe0,
+0x00,0x68,0x00,0x00,0x6d,0x10,0x00,0xde,0x9e,0x67,0x00,0xa0,0x08,0xe0,0x00,0x0c,
+0x37,0xe0,0x00,0x5f,0x00,0x00,0xf8,0x06,0x50,0x7e,0x00,0x02,0xf3,0x00,0xc2,0x04,
+0x71,0x07,0xe0,0x00,0x0f,0x60,0x00,0xf5,0x13,0x00,0x20,0x00,0xc9,0x98,0x03,0x00,
+0x13,0x00,0x42,0x0a,0xb0,0x06,0xe0,0x13,0x00,0x10,0x8d,0x2f,0x00,0x00,0x13,0x00,
+0x40,0x04,0x50,0x0d,0x70,0x13,0x00,0xf0,0x02,0x05,0x77,0x77,0x77,0xf9,0x77,0x70,
+0x00,0x07,0xe0,0xae,0xee,0xee,0xee,0xee,0xee,0x10,0xf0,0x52,0x00,0x00,0x27,0x00,
+0x00,0x00,0x00,0x37,0x10,0x00,0x00,0x09,0xe0,0x00,0x14,0x7a,0xef,0xe8,0x00,0x00,
+0x01,0xf7,0x0b,0xef,0xfd,0xfb,0x30,0x00,0x00,0x00,0x8f,0x10,0xf9,0x30,0x0c,0x80,
+0x00,0x00,0x00,0x1f,0x90,0x0f,0x50,0x00,0xb9,0x00,0x00,0x00,0x0a,0xf6,0x00,0xf5,
+0x00,0x0a,0xa0,0x00,0x00,0x05,0xff,0x60,0x0f,0x50,0x00,0x9b,0x00,0x00,0x03,0xfb,
+0xe6,0x00,0xf9,0x66,0x6b,0xe6,0x66,0x50,0x6d,0x1e,0x60,0x0f,0xfe,0xee,0xff,0xee,
+0xec,0x00,0x20,0xe6,0x00,0xf5,0x00,0x04,0xf1,0x00,0x00,0x00,0x0e,0x26,0x00,0x10,
+0x2f,0x4c,0x00,0x00,0x13,0x00,0x24,0x00,0xf6,0x13,0x00,0x23,0x0c,0xa0,0x13,0x00,
+0x40,0xd1,0x7f,0x00,0xe1,0x13,0x00,0xfa,0x0a,0x51,0x49,0xa2,0xf8,0x2e,0x00,0x00,
+0xe6,0x05,0xfe,0xfe,0x2f,0x28,0xfe,0xa0,0x00,0x0e,0x60,0x8c,0x72,0x00,0x73,0x09,
+0xc2,0x00,0x01,0x00,0x20,0x03,0x10,0x06,0x00,0x51,0x07,0xe0,0x00,0x00,0xf5,0x10,
+0x00,0x50,0xe9,0x00,0x00,0x0f,0x50,0x09,0x00,0x23,0x5f,0x30,0x13,0x00,0xd0,0x0b,
+0xd0,0x11,0x11,0x1f,0x61,0x11,0x11,0x00,0x03,0xf8,0x4f,0xff,0x01,0x00,0xf1,0x16,
+0xf0,0x00,0xcf,0x61,0x44,0x45,0xff,0xf9,0x44,0x44,0x00,0x7f,0xf6,0x00,0x00,0x6d,
+0xfc,0xc0,0x00,0x00,0x2f,0xae,0x60,0x00,0x0c,0x5f,0x6e,0x30,0x00,0x00,0xb0,0xe6,
+0x00,0x05,0xd0,0xf5,0x7b,0x98,0x00,0x51,0x00,0xd6,0x0f,0x51,0xf4,0x98,0x00,0x50,
+0x8e,0x00,0xf5,0x09,0xe1,0x13,0x00,0xf1,0x0e,0x4f,0x40,0x0f,0x50,0x1e,0xb0,0x00,
+0x00,0xe6,0x3f,0xa5,0x55,0xf9,0x55,0x6f,0xa0,0x00,0x0e,0x7c,0xb1,0xff,0xff,0xff,
+0xf6,0x6f,0x20,0x00,0xe6,0x10,0x72,0x00,0x10,0x10,0x39,0x00,0x03,0x85,0x00,0x5b,
+0xe6,0x00,0x00,0x00,0xe5,0xb2,0x00,0x41,0xb8,0x00,0x2c,0x20,0x09,0x00,0x52,0x3f,
+0x50,0x09,0xf0,0x00,0xa2,0x00,0x22,0x00,0xf9,0xcd,0x00,0x30,0xf6,0x00,0x7f,0xa2,
+0x00,0xf2,0x09,0x40,0x00,0xcf,0x00,0x1e,0xb6,0xfa,0x66,0x66,0x61,0x00,0x7f,0xe0,
+0x09,0xe1,0x0f,0x60,0x00,0x00,0x00,0x4f,0xfe,0x05,0xf5,0x2f,0x01,0xf1,0x03,0xc8,
+0xe0,0xd9,0x00,0x0f,0xed,0xdd,0xdb,0x00,0x71,0x7e,0x01,0x00,0x00,0xfa,0x66,0x66,
+0x50,0x00,0x01,0x01,0x26,0x00,0x32,0x00,0x7e,0x00,0x55,0x01,0x02,0x13,0x00,0x32,
+0xa5,0x55,0x55,0x13,0x00,0x4f,0xff,0xff,0xff,0xf1,0x26,0x00,0x06,0x0a,0x13,0x00,
+0x0f,0x01,0x00,0x01,0x51,0x03,0xf3,0x00,0x00,0xd8,0x0a,0x00,0x60,0xcc,0x00,0x00,
+0x0d,0x80,0x00,0x90,0x00,0x13,0x6f,0x4d,0x01,0xc2,0x0c,0xd0,0x55,0x55,0x5e,0xb5,
+0x55,0x55,0x00,0x06,0xf7,0x00,0x26,0x00,0xf0,0x08,0x02,0xff,0x70,0x7d,0xdd,0xdf,
+0xed,0xdd,0xd5,0x01,0xed,0xe7,0x08,0xd5,0x55,0xeb,0x55,0x5f,0x50,0x9e,0x2e,0x70,
+0x8c,0x39,0x00,0x80,0xf5,0x02,0x30,0xe7,0x08,0xc0,0x00,0xd8,0x20,0x01,0x30,0x0e,
+0x70,0x8f,0x26,0x00,0xf1,0x02,0xf5,0x00,0x00,0xe7,0x03,0x75,0x55,0xf9,0x55,0x55,
+0x20,0x00,0x0e,0x70,0x3f,0x40,0x3f,0x1e,0x01,0x60,0xe7,0x00,0x7f,0x4a,0xd0,0x00,
+0xef,0x00,0x52,0x70,0x00,0x6f,0xf6,0x00,0x13,0x00,0x40,0x08,0xfe,0xfa,0x40,0x13,
+0x00,0xf3,0x06,0x73,0x8e,0xf5,0x04,0xbf,0xeb,0x85,0x00,0x00,0xe7,0x5d,0x61,0x00,
+0x00,0x15,0x9c,0xa0,0x00,0x00,0x1b,0x30,0xab,0x00,0xf0,0x00,0x09,0xe0,0xef,0xff,
+0xff,0xff,0xfd,0x00,0x00,0x02,0xf7,0x0e,0x94,0x44,0x44,0x45,0x00,0x11,0xae,0x88,
+0x01,0x50,0x8d,0x00,0x00,0x3f,0x80,0x9b,0x01,0xf0,0x01,0x08,0xd0,0x00,0x1e,0xf7,
+0x00,0xe9,0x44,0x44,0x44,0xad,0x00,0x0c,0xff,0x70,0x0e,0xc7,0x00,0xf1,0x03,0xd0,
+0x08,0xf4,0xe7,0x00,0x00,0x00,0xc9,0x00,0x00,0x00,0x25,0x0e,0x70,0x00,0x00,0x0c,
+0x90,0x72,0x00,0xf0,0x01,0x4d,0xdd,0xdd,0xff,0xdd,0xdd,0xc0,0x00,0x0e,0x72,0x66,
+0x66,0xef,0xfc,0x66,0x66,0x85,0x00,0x43,0x00,0x8e,0xec,0xf5,0x98,0x00,0x31,0x4c,
+0x96,0xf2,0x98,0x00,0xf0,0x0e,0x6f,0x60,0xc9,0x0a,0xe3,0x00,0x00,0x0e,0x71,0xaf,
+0x70,0x0c,0x90,0x0b,0xf6,0x00,0x00,0xe7,0x8e,0x50,0x00,0xc9,0x00,0x09,0xf2,0x00,
+0x0e,0x70,0x10,0x4c,0x00,0x1f,0x01,0x56,0x01,0x02,0x41,0x6c,0x00,0x00,0x7c,0x09,
+0x00,0x40,0xd9,0x00,0x00,0x2f,0x85,0x01,0x60,0x04,0xf2,0x00,0x00,0x09,0x70,0x12,
+0x02,0x11,0xa1,0x5d,0x01,0x51,0xfe,0x00,0x2f,0x60,0x33,0x01,0x00,0x32,0x00,0xcf,
+0x60,0x34,0x00,0x40,0x07,0xff,0x60,0x0b,0x1b,0x00,0xe0,0x60,0x3f,0x7e,0x60,0x01,
+0x11,0x11,0x11,0x11,0x00,0x2b,0x0e,0x60,0x02,0x23,0x00,0x00,0x78,0x02,0x02,0x1b,
+0x00,0x22,0x00,0x0e,0x2d,0x00,0x00,0xb0,0x02,0x60,0x0d,0xdd,0xdd,0xdd,0xdd,0x80,
+0x51,0x03,0x50,0x75,0x55,0x55,0x5c,0x90,0x09,0x00,0x4a,0x30,0x00,0x00,0x0a,0x09,
+0x00,0x41,0x63,0x33,0x33,0x3b,0x09,0x00,0x56,0xee,0xee,0xee,0xee,0x80,0xa2,0x00,
+0x00,0x8d,0x00,0x20,0x08,0xb0,0x09,0x00,0x51,0x01,0xf6,0x00,0x02,0xf7,0x13,0x00,
+0xf0,0x39,0x7f,0x00,0x00,0xaf,0xff,0xff,0xff,0x50,0x00,0x0e,0x90,0x00,0x7f,0xd3,
+0x33,0x39,0xd0,0x00,0x05,0xf5,0x00,0x5f,0x8d,0x90,0x05,0xf4,0x00,0x00,0xef,0x42,
+0xd8,0x80,0x2d,0xb8,0xf4,0x00,0x00,0x9f,0xf4,0x2f,0x00,0x00,0x7f,0xfa,0x00,0x00,
+0x5f,0x6f,0x42,0xf1,0x48,0xee,0x76,0xef,0x95,0x02,0xa1,0xf4,0x2f,0xae,0xa5,0x01,
+0x61,0x5a,0xd1,0x00,0x0f,0x42,0xf1,0x00,0x05,0xe7,0x4c,0x00,0xf1,0x01,0xf4,0x2f,
+0x01,0x8e,0xc3,0x04,0x70,0x00,0x00,0x0f,0x42,0xf0,0x08,0x30,0x08,0xf5,0x13,0x00,
+0x60,0x00,0x04,0x9e,0xb2,0x05,0x50,0x13,0x00,0xf1,0x06,0x0c,0xd7,0x20,0x19,0xf5,
+0x00,0x00,0xf4,0x04,0x00,0x10,0x02,0x8f,0xb3,0x00,0x00,0x0f,0x40,0x00,0x36,0x9d,
+0x02,0x02,0x54,0xf4,0x00,0x0b,0xc8,0x50,0xa5,0x00,0x02,0x5d,0x01,0x22,0x02,0xe2,
+0x6f,0x03,0x61,0x00,0x00,0xad,0x00,0x00,0x0a,0xb5,0x00,0x21,0x1f,0x65,0x46,0x01,
+0xf0,0x0a,0x80,0x00,0x08,0xe0,0x14,0x86,0x44,0x44,0x79,0x52,0x00,0x01,0xf8,0x00,
+0x0c,0x80,0x00,0x0a,0xc0,0x00,0x00,0xaf,0x60,0x00,0x6e,0xf1,0x02,0x00,0x5d,0x02,
+0x41,0x01,0xf3,0x00,0x6f,0x03,0x04,0xa1,0x55,0x5a,0x65,0x5c,0xc5,0x55,0x00,0xc0,
+0xe6,0x1f,0x39,0x00,0x15,0xf2,0x49,0x01,0x00,0x5b,0x00,0x50,0x25,0x55,0x55,0x55,
+0x52,0x53,0x01,0x10,0x07,0x1c,0x00,0x10,0x70,0x13,0x00,0x11,0x7d,0xfe,0x01,0x00,
 0x13,0x00,0x11,0xd0,0x11,0x02,0x09,0x13,0x00,0x42,0xfd,0xdd,0xdd,0xdf,0x13,0x00,
-0x52,0x66,0x66,0x66,0xd7,0x00,0xc4,0x22,0x11,0xe5,0xe8,0x0c,0x12,0xe0,0x7c,0x41,
-0x00,0x0a,0x4f,0x01,0x67,0x48,0x00,0x40,0x2c,0x61,0x44,0x44,0x7f,0x54,0x44,0x40,
-0x2b,0x1e,0x11,0x05,0x82,0x5b,0x30,0xf6,0x00,0x00,0x63,0x03,0x00,0x16,0x0d,0xf1,
-0x07,0x5d,0x06,0xe1,0x11,0x17,0xf0,0x05,0xf8,0xe6,0x06,0xe0,0x6e,0x11,0x11,0x7f,
-0x00,0x3b,0x0e,0x60,0x6e,0x06,0xfe,0x47,0x11,0x00,0x13,0x00,0x01,0xef,0x38,0x00,
-0x13,0x00,0x01,0x90,0x03,0x03,0x13,0x00,0x12,0x6f,0x13,0x00,0x32,0xe2,0x22,0x27,
-0x13,0x00,0x01,0x4c,0x00,0x00,0x13,0x00,0x04,0xd1,0x00,0x20,0x06,0xf6,0xea,0x48,
-0x00,0x2d,0x02,0x20,0x5d,0xdd,0x01,0x00,0x07,0xe3,0x25,0x00,0xa7,0x3c,0x23,0x0e,
-0x50,0x3b,0x3b,0x02,0x0a,0x2c,0x21,0x9e,0x0e,0xc9,0x0e,0x90,0x00,0x02,0xf7,0x0f,
-0x73,0x33,0x33,0x33,0xf7,0xff,0x55,0x11,0x50,0xec,0x00,0x40,0x5f,0xe0,0x0f,0x83,
-0x12,0x00,0x41,0x02,0xef,0xe0,0x0f,0x24,0x00,0x42,0x0d,0xe9,0xe0,0x0f,0x63,0x10,
-0x41,0x36,0xe0,0x0f,0xbf,0xc2,0x19,0xf3,0x07,0x06,0xe0,0x1f,0xaa,0x2e,0x32,0xe2,
-0x7b,0x00,0x06,0xe0,0x2f,0x99,0x0e,0x10,0xe0,0x6b,0x00,0x06,0xe0,0x4f,0x7a,0x09,
-0x00,0x23,0x6e,0x7f,0x24,0x00,0x50,0x9b,0x6a,0x1e,0x22,0xe1,0x24,0x00,0x22,0xd8,
-0x69,0x1b,0x00,0xf2,0x07,0xe2,0xf3,0x69,0x0e,0x10,0xe1,0x8b,0x00,0x06,0xe1,0xb0,
-0x69,0x0e,0x10,0xd8,0xd6,0x00,0x00,0x2b,0x10,0x00,0x3d,0x1f,0x1a,0xa2,0xe2,0x22,
-0x23,0xfa,0x22,0x22,0x20,0x00,0x01,0xf7,0xf3,0x0a,0x07,0x48,0x0c,0x31,0x1e,0x80,
-0x06,0x08,0x03,0x00,0xae,0x2f,0x11,0x6c,0xd7,0x04,0xf1,0x08,0x05,0xff,0x50,0x06,
-0xc2,0x22,0x22,0x2f,0x60,0x01,0xfc,0xf5,0x00,0x6d,0xdd,0xdd,0xdd,0xd6,0x00,0x0b,
-0x1e,0x50,0x22,0x01,0x00,0x43,0x00,0x00,0xe5,0x1f,0xcb,0x04,0x31,0x0e,0x51,0xf2,
-0xdb,0x04,0x50,0x00,0x00,0xe5,0x1e,0x45,0x82,0x11,0xa2,0xe0,0x00,0x0e,0x50,0x05,
-0xcc,0xcf,0xec,0xcc,0x30,0xbb,0x01,0x11,0xe7,0x55,0x03,0x12,0x50,0xed,0x01,0x00,
-0x13,0x00,0x33,0x02,0x44,0xf7,0x13,0x00,0x3a,0x5f,0xec,0x20,0x2f,0x17,0x11,0xe7,
-0x09,0x00,0x70,0xd6,0x00,0x04,0xf3,0xef,0xff,0xfe,0x09,0x00,0xe0,0x0a,0xe0,0xe9,
-0x66,0x9e,0x0e,0x50,0xd6,0x00,0x1f,0x80,0xe4,0x00,0x5e,0x09,0x00,0xf2,0x05,0x7f,
-0x40,0xe7,0x33,0x8e,0x0e,0x50,0xd6,0x01,0xff,0x40,0xee,0xdd,0xee,0x0e,0x50,0xd6,
-0x0a,0xff,0x40,0x1b,0x00,0x23,0x5f,0x8f,0x09,0x00,0x60,0x4b,0x1f,0x40,0xed,0xcc,
-0xde,0x24,0x00,0x50,0x0f,0x40,0xe8,0x44,0x8e,0x36,0x00,0x23,0x0f,0x40,0x3f,0x00,
-0x07,0x12,0x00,0x32,0xde,0xee,0xed,0x09,0x00,0x50,0x0a,0x20,0x90,0x02,0x00,0x09,
-0x00,0x40,0x8e,0x10,0xb9,0x00,0x09,0x00,0xe2,0x47,0xf4,0x00,0x2f,0x20,0x44,0xf5,
-0x00,0x0f,0x48,0x40,0x00,0x04,0x00,0xc8,0x4c,0x0c,0x01,0x00,0x61,0xa8,0x00,0x0f,
-0x50,0x07,0xd0,0xe6,0x03,0x02,0x09,0x00,0x32,0x07,0xf0,0xdf,0x1e,0x1c,0x80,0x0d,
-0x90,0x45,0x5f,0x95,0x5a,0xe5,0x52,0xe2,0x13,0x02,0x1b,0x00,0x22,0xcf,0x46,0x9b,
-0x04,0x50,0x06,0xff,0x42,0x56,0xfc,0x24,0x01,0x42,0x1f,0xaf,0x40,0x0b,0xea,0x4d,
-0x32,0x1f,0x41,0xbf,0x48,0x01,0xf1,0x05,0x0f,0x7e,0xef,0x82,0x29,0xc2,0x26,0xf0,
-0x00,0x0f,0x59,0x2e,0x81,0x19,0xc1,0x15,0xf0,0x00,0x0f,0x40,0x40,0x02,0x01,0x09,
-0x00,0x41,0x70,0x08,0xb0,0x04,0x09,0x00,0x41,0xa4,0x4a,0xd4,0x48,0x09,0x00,0x44,
-0xdb,0xbe,0xeb,0xbd,0x1b,0x00,0x14,0x26,0x09,0x00,0x10,0x8e,0x05,0x2f,0x33,0x10,
-0x08,0x30,0xab,0x15,0x41,0x07,0xf6,0x44,0x40,0xa6,0x13,0x31,0x03,0xfc,0xcc,0xca,
-0x19,0x60,0x7f,0x14,0xf8,0x00,0x1e,0x60,0x7d,0x01,0x13,0x96,0xbf,0x01,0x80,0x09,
-0xf6,0xb9,0xf3,0x11,0xb8,0x11,0x6f,0x8c,0x08,0xa2,0x2f,0x10,0x1f,0x30,0x04,0xf0,
-0x02,0xfa,0xe6,0x02,0x1e,0x02,0x90,0x0a,0x0e,0x60,0x01,0x3d,0xf4,0x11,0x11,0x20,
-0x74,0x67,0xe0,0x8f,0xaa,0xc0,0x01,0xad,0x00,0x00,0x0e,0x63,0xe9,0x30,0x8f,0x97,
-0xfa,0x13,0x00,0x50,0x00,0x05,0xd8,0x4f,0xad,0x10,0x51,0x60,0x61,0x8e,0xb2,0x1c,
-0xf4,0x5e,0x20,0x03,0x60,0x18,0x20,0x6e,0x7d,0x70,0xd9,0x33,0x03,0xf3,0x05,0x17,
-0xed,0x20,0xe7,0x03,0xfa,0x10,0x00,0xe6,0x5f,0xc5,0x12,0x6f,0x30,0x04,0xb0,0x00,
-0x0e,0x60,0x30,0x5c,0x35,0x05,0x01,0x00,0x02,0xfc,0x0c,0x14,0x62,0x97,0x10,0x1f,
-0xf5,0x25,0x21,0x09,0x13,0x11,0x01,0x00,0x23,0x10,0xbf,0x6b,0x0d,0xa1,0xe0,0x23,
-0x33,0x3f,0xa3,0x33,0xea,0x33,0x33,0x30,0x8e,0x07,0x01,0x3a,0x10,0x00,0xf8,0x44,
-0x14,0xd9,0xda,0x27,0x02,0x09,0x00,0x10,0xda,0x2a,0x06,0x21,0x01,0x60,0xc9,0x15,
-0x41,0xd9,0x00,0x02,0xf2,0xb4,0x11,0x60,0xd9,0x00,0x04,0xf0,0x18,0xfb,0x20,0x46,
-0x31,0x65,0x5b,0xd0,0x3c,0x25,0x4f,0x5e,0xff,0xfe,0x50,0x71,0x06,0x02,0x14,0x06,
-0xd5,0x0f,0x01,0xa4,0x30,0x02,0x2e,0x4a,0x10,0x10,0xb1,0x0a,0x04,0x87,0x00,0x40,
-0x26,0x66,0x6a,0xfa,0xc7,0x00,0x11,0x50,0xd9,0x13,0x21,0x1c,0x40,0xf1,0x19,0x11,
-0x10,0x5c,0x3b,0x32,0x00,0x1c,0xd1,0x6c,0x27,0x51,0x02,0xef,0xdc,0xdd,0xef,0xde,
-0x0d,0x81,0xdb,0xab,0xf9,0x65,0xfa,0x32,0x7f,0x40,0x9f,0x66,0x32,0xe9,0x00,0x03,
-0x5b,0x10,0x14,0xe9,0xb4,0x3a,0x10,0xe9,0x56,0x1b,0x00,0xde,0x0c,0x10,0xe9,0xb0,
-0x05,0x20,0x05,0xfb,0x9c,0x09,0x30,0x02,0xf3,0x02,0x8c,0x2b,0x41,0xdd,0x55,0x59,
-0xf0,0xd7,0x53,0x6e,0x6e,0xff,0xff,0x70,0x05,0x00,0x10,0x27,0x33,0x71,0x01,0xf5,
-0x57,0x2d,0x23,0x01,0xf5,0x5c,0x42,0x03,0x09,0x00,0x14,0x2f,0x0d,0x23,0x70,0xbe,
-0x66,0x67,0xf9,0x66,0x66,0x63,0x8d,0x14,0x23,0x01,0xf5,0x8a,0x67,0x24,0x01,0xf5,
-0xe1,0x00,0x02,0xa2,0x14,0x04,0xd8,0x00,0x60,0x46,0x66,0x6d,0xd6,0x66,0xcd,0xed,
-0x04,0x00,0x86,0x2d,0x14,0xab,0x3f,0x42,0x14,0xab,0x5f,0x01,0x11,0xab,0x34,0x00,
-0x10,0xea,0x4d,0x0b,0x50,0x02,0xe1,0x00,0x1d,0xe2,0x09,0x00,0x30,0x03,0xf1,0x05,
-0x67,0x02,0x61,0x9e,0x55,0x5a,0xe0,0x9f,0xb2,0x93,0x68,0x37,0xfe,0x60,0x13,0xa4,
-0x00,0x05,0x9c,0x1d,0x06,0xd1,0x23,0x14,0x7f,0x4c,0x1d,0x02,0xfa,0x18,0x02,0xb9,
-0x11,0x15,0x20,0x15,0x43,0x04,0x13,0x00,0x15,0xdf,0x88,0x17,0x24,0x7c,0xc0,0x81,
-0x18,0x24,0x4f,0x50,0xc1,0x35,0x14,0xbe,0xdd,0x1e,0x24,0x03,0xf8,0x7b,0x29,0x03,
-0x5f,0x03,0x13,0xf2,0x6f,0x15,0x01,0xf1,0x3c,0x23,0x6f,0x90,0x46,0x13,0x00,0x89,
-0x22,0x22,0x4e,0xf9,0x5d,0x13,0x34,0xd1,0x0b,0xe5,0x7e,0x3c,0x0f,0x72,0x08,0x03,
-0x03,0xc5,0x09,0x00,0x36,0x00,0x05,0xe1,0x11,0x23,0x4b,0xd1,0xaa,0x00,0x32,0x40,
-0x0b,0xe3,0x0e,0x26,0x12,0x50,0xe4,0x22,0x30,0x04,0xee,0x30,0xb7,0x00,0x51,0x20,
-0x00,0x2b,0xfb,0x10,0x91,0x27,0x32,0x70,0x0d,0xe5,0xbc,0x16,0x51,0xaf,0x60,0x20,
-0x05,0x55,0xb2,0x09,0x13,0x30,0x7d,0x47,0x03,0x01,0x00,0x13,0xf6,0xd8,0x30,0x00,
-0xf7,0x27,0x10,0xe8,0x34,0x00,0x12,0x55,0xd8,0x09,0x0d,0x26,0x00,0x00,0x6c,0x11,
-0x71,0x44,0x44,0x4f,0x94,0x44,0x44,0x43,0x01,0x67,0x02,0xe1,0x28,0x00,0x73,0x2a,
-0x14,0x25,0x00,0x18,0x02,0x7b,0x2a,0x13,0xbd,0xe4,0x42,0x23,0x05,0xf4,0xdc,0x27,
-0x21,0x1e,0xc0,0xac,0x00,0x00,0x21,0x60,0x02,0x15,0x01,0x20,0x09,0xf6,0xb4,0x65,
-0x51,0x01,0xee,0x20,0x9f,0x90,0x3e,0x23,0x41,0x3f,0xe0,0x28,0x00,0x83,0x19,0x25,
-0x04,0x50,0x0f,0x28,0x01,0x27,0x17,0x23,0x1b,0x40,0xf0,0x29,0x23,0x0c,0xe1,0xd1,
-0x49,0x23,0x01,0xec,0x63,0x3a,0x81,0x12,0x7f,0x80,0x00,0x03,0xef,0xcc,0xde,0xf0,
-0x0d,0x85,0x01,0xfd,0xca,0x98,0x76,0x54,0x22,0xed,0xf6,0x3e,0x08,0x87,0x1f,0x13,
-0x79,0xa2,0x09,0x23,0x00,0x9c,0xbf,0x0f,0x0d,0x09,0x00,0x13,0x3f,0xcf,0x00,0xaf,
-0x60,0x16,0x66,0xce,0x66,0x66,0x6e,0xc6,0x66,0x20,0x2d,0x00,0x08,0x01,0x30,0x3e,
-0x00,0x09,0x00,0x04,0xb3,0x14,0x23,0xf1,0x55,0x01,0x00,0x11,0x50,0x36,0x2e,0x14,
-0x16,0x1b,0x29,0x20,0x6f,0xb1,0x45,0x11,0x00,0x04,0x44,0x60,0xee,0x30,0x00,0x05,
-0xee,0x30,0x92,0x03,0x42,0xf6,0x00,0x7f,0xa1,0x20,0x00,0x23,0x50,0x04,0x2a,0x12,
-0x04,0xfd,0x14,0x10,0xf4,0x3a,0x02,0x60,0x62,0x22,0x22,0x22,0x4f,0x40,0xd7,0x05,
-0x41,0x22,0x22,0x22,0x24,0x13,0x00,0x03,0xda,0x11,0x02,0xd2,0x35,0x11,0x02,0x13,
-0x00,0x60,0x84,0x44,0x44,0x44,0x6f,0x40,0x27,0x32,0x41,0xcc,0xcc,0xcc,0xcc,0x13,
-0x00,0x13,0x40,0x4e,0x6c,0x07,0x4c,0x00,0x10,0x51,0xe9,0x38,0x05,0x39,0x00,0x12,
-0xf5,0x5e,0x66,0x01,0x77,0x05,0xa1,0x04,0x44,0x45,0xa4,0x44,0x44,0xb6,0x44,0x44,
-0x00,0x98,0x00,0x10,0x2d,0x43,0x45,0x21,0x5c,0xf9,0x3c,0x38,0x43,0x91,0x00,0xcf,
-0xa3,0x6f,0x20,0x04,0xbf,0x15,0x02,0x07,0x46,0x14,0xa2,0x02,0x03,0x04,0xd1,0x1c,
-0x13,0xf3,0x44,0x05,0x54,0x8f,0x86,0x66,0x66,0x60,0x82,0x12,0x21,0x00,0xf5,0x8d,
-0x6c,0x41,0x04,0xf0,0x0f,0x50,0x5f,0x0f,0x31,0x4f,0x00,0xf5,0xf7,0x01,0x01,0x11,
-0x00,0x31,0x1f,0xdf,0x40,0x11,0x00,0x40,0x0c,0xe0,0x8f,0x60,0x11,0x00,0x90,0x09,
-0xf3,0x00,0x7f,0x70,0x4f,0x00,0xf5,0x1b,0x84,0x1c,0x50,0x84,0xf0,0x0f,0x5d,0xd3,
-0xed,0x3b,0x32,0x5f,0x00,0xf5,0x12,0x1f,0x12,0xf0,0x93,0x08,0x01,0x44,0x00,0x00,
-0x6d,0x1f,0x12,0x6a,0x11,0x00,0x53,0x06,0xee,0xc7,0x00,0x16,0x72,0x14,0x14,0x23,
-0x01,0x15,0x21,0x3f,0x20,0x4e,0x13,0x31,0x1f,0x53,0xf2,0xdb,0x12,0x1f,0x01,0x11,
-0x00,0x08,0x84,0xf8,0x77,0x77,0x9f,0x87,0x77,0x77,0xf5,0xf5,0x01,0x12,0x53,0x86,
-0x13,0x01,0x22,0x00,0x01,0xbe,0x03,0x0f,0x11,0x00,0x0c,0x51,0x02,0x66,0x8f,0x43,
-0xf2,0xb4,0x08,0x22,0xed,0xa0,0xd9,0x2f,0x00,0x65,0x09,0x00,0x30,0x29,0x00,0xb4,
-0x1c,0x02,0xd8,0x58,0x02,0x99,0x09,0x41,0x55,0x55,0x58,0xf7,0x16,0x02,0x20,0x0e,
-0xfe,0x87,0x20,0x11,0xfe,0x94,0x0a,0x12,0x04,0xd5,0x0d,0x20,0x0e,0x60,0x26,0x00,
-0x24,0x7e,0x00,0x96,0x01,0x10,0xe0,0x1d,0x68,0x57,0x33,0x7f,0x53,0x33,0x9e,0x26,
-0x00,0xb5,0x15,0x5f,0xa5,0x55,0x8f,0x75,0x55,0xaf,0x55,0x12,0xff,0xeb,0x37,0x15,
-0x0e,0xfb,0x0d,0x01,0x3b,0x0b,0x02,0x4c,0x00,0x00,0xcf,0x2e,0x13,0xbe,0x13,0x00,
-0x12,0x6f,0x74,0x45,0x20,0x6e,0x10,0xcf,0x1e,0x00,0xe8,0x05,0x40,0x01,0x20,0x1f,
-0x50,0xfd,0x36,0x30,0x6f,0x11,0xf5,0x0f,0x00,0x2d,0x06,0xf1,0x0f,0x00,0x00,0x51,
-0x05,0x23,0x7f,0x11,0xce,0x02,0x12,0x05,0x13,0x20,0x21,0x0d,0x80,0x30,0x3f,0x21,
-0x9b,0xf9,0x39,0x37,0x31,0x0b,0xdf,0x90,0x0f,0x00,0x1e,0xbd,0x0f,0x00,0x10,0x7f,
-0x0f,0x00,0x12,0xff,0x17,0x12,0x02,0x08,0x03,0x10,0x5c,0x7f,0x0a,0x44,0x93,0x00,
-0x02,0x90,0xf1,0x1e,0x24,0x2f,0x60,0xf9,0x46,0x23,0x9e,0x10,0x56,0x35,0x01,0xd0,
-0x06,0x01,0x03,0x50,0x00,0xf0,0x03,0x10,0x02,0xba,0x03,0x00,0x05,0x1d,0x33,0x02,
-0xdf,0x20,0x7e,0x22,0x12,0xcf,0xb0,0x3b,0x40,0x5c,0xc0,0x01,0x32,0x92,0x03,0x33,
-0x68,0xf4,0x01,0xe5,0x37,0x23,0x3f,0x30,0x6b,0x07,0x24,0x03,0xf2,0x08,0x2a,0x23,
-0x5f,0x10,0x4d,0x35,0x02,0x28,0x13,0x14,0xcf,0x3d,0x4a,0x22,0xbf,0x40,0x71,0x6d,
-0x70,0x06,0xef,0x50,0x00,0x46,0x57,0xf8,0xf2,0x24,0x67,0x20,0x00,0x06,0xff,0xfc,
-0x10,0x2b,0x13,0x02,0xe0,0x13,0x01,0x4b,0x01,0x10,0xe1,0xe7,0x07,0x00,0xfb,0x20,
-0x22,0xd9,0x01,0xd6,0x6f,0xc0,0x55,0x87,0x51,0x44,0x4f,0x84,0x44,0xf7,0x0d,0xff,
-0xff,0xf6,0xff,0x0b,0x10,0xf6,0x09,0x0c,0x00,0x02,0x03,0x11,0xf5,0x67,0x0b,0x20,
-0x3f,0x20,0x09,0x00,0xd0,0xcb,0x09,0x10,0x5f,0x10,0x01,0xf4,0x00,0x0a,0xf8,0xbb,
-0x00,0x8e,0x6d,0x03,0xf0,0x08,0x9f,0xff,0xd0,0x00,0xbb,0x00,0x02,0xf3,0x0b,0xf7,
-0xf7,0xf7,0x00,0xe7,0x00,0x03,0xf2,0x0c,0x42,0xf4,0x5c,0x04,0xf4,0xd4,0x01,0x11,
-0x02,0xeb,0x6e,0x20,0x06,0xf0,0x09,0x00,0x21,0x3f,0x50,0x0b,0x42,0x10,0xf4,0xfc,
-0x00,0xa0,0x0b,0xb0,0x00,0x02,0xf4,0x1e,0xe2,0x03,0x76,0x8f,0xf2,0x4e,0x5e,0x1c,
-0x30,0x02,0xde,0xd9,0x09,0x06,0x60,0x61,0x02,0xee,0xee,0xee,0xe4,0xd0,0x03,0x90,
-0x02,0xf7,0x55,0x55,0xf5,0x07,0x30,0x01,0xf4,0x55,0x70,0x3f,0xf5,0x0e,0x70,0x09,
-0x00,0x02,0x00,0x17,0x03,0x00,0x09,0x00,0x51,0x00,0x45,0xf7,0x44,0x41,0x09,0x00,
-0x00,0xb3,0x03,0x01,0x09,0x00,0x41,0x04,0xfb,0xbb,0xb5,0x09,0x00,0x41,0x07,0xf9,
-0x99,0xf6,0x09,0x00,0x22,0x0a,0xc0,0x36,0x00,0x00,0x6d,0x07,0xa1,0xf4,0x0e,0x60,
-0x01,0xf4,0x00,0x5f,0x20,0x01,0xf3,0x3c,0x04,0x11,0xdb,0xaa,0x17,0xfa,0x05,0x01,
-0xf4,0x0b,0xf2,0x13,0x2a,0xe0,0x00,0x35,0x57,0xf3,0x1c,0x40,0x2f,0xfe,0x60,0x00,
-0x5f,0xff,0xa0,0x00,0x08,0x00,0x87,0x74,0x51,0x00,0x03,0x69,0xdf,0xe7,0x2d,0x00,
-0xf0,0x00,0xff,0xdf,0xb3,0x00,0x01,0x71,0x01,0xf4,0x03,0x20,0x0e,0x70,0x00,0x02,
-0xf3,0x84,0x04,0x0c,0x09,0x00,0x01,0x5f,0x0a,0xa1,0x52,0xf3,0x01,0xf4,0x04,0x44,
-0x9f,0xa4,0x44,0x12,0x1b,0x00,0x22,0xdf,0xf3,0x24,0x00,0x41,0x05,0xff,0xdf,0x40,
-0x09,0x00,0x41,0x0d,0x7e,0x78,0xf4,0x09,0x00,0x40,0x8d,0x0e,0x70,0x9e,0x09,0x00,
-0x50,0x05,0xf4,0x0e,0x70,0x03,0x09,0x00,0x41,0x1f,0x60,0x0e,0x70,0xe9,0x3a,0x23,
-0x05,0x00,0x09,0x00,0x02,0xe4,0x0b,0x32,0x27,0x68,0xf3,0x09,0x00,0x10,0x2f,0xa9,
-0x28,0x22,0xa6,0x00,0x85,0x21,0x02,0x42,0x19,0xa0,0xe7,0x56,0x66,0x8f,0x96,0x66,
-0x22,0x80,0x0e,0x7d,0xef,0x06,0x41,0xe5,0x4f,0x10,0xe7,0x72,0x48,0xf0,0x0a,0x04,
-0xf1,0x0e,0x70,0x06,0xf2,0x00,0x67,0x00,0x4f,0x10,0xe7,0x04,0xf5,0x00,0x1f,0x70,
-0x04,0xf1,0x0e,0x73,0xff,0xdd,0xef,0xc0,0x11,0x00,0x41,0x09,0x76,0x5d,0xe2,0x22,
-0x00,0x50,0x00,0x0b,0xf3,0x09,0xe0,0x33,0x00,0x40,0x2c,0xe3,0x04,0xf5,0x11,0x00,
-0x40,0x8f,0xc1,0x04,0xf9,0x22,0x00,0x41,0x6f,0x70,0x05,0xfd,0x22,0x00,0x41,0x10,
-0x08,0xfd,0xf5,0x73,0x0c,0x20,0x4d,0xf7,0xa1,0x44,0xb2,0x0e,0x74,0xcf,0xc2,0x00,
-0x04,0xe4,0x04,0x45,0xf6,0x5c,0xc8,0x06,0x02,0xe1,0x30,0x09,0xb2,0x15,0x30,0x20,
-0x0f,0x50,0x44,0x3f,0x50,0xb3,0xac,0x00,0xf5,0x07,0x6a,0x66,0xf0,0x18,0x53,0xf3,
+0x93,0x66,0x66,0x66,0xd7,0x00,0x00,0x00,0x1d,0x40,0x0d,0x04,0x70,0x08,0xe0,0x00,
+0x00,0x1f,0x50,0x00,0x59,0x05,0x11,0x2f,0x69,0x00,0xf0,0x01,0x00,0x00,0x8e,0x00,
+0x44,0x44,0x7f,0x54,0x44,0x40,0x00,0x1f,0x80,0x00,0x00,0x05,0x17,0x04,0x10,0x0c,
+0x9c,0x00,0x00,0x1c,0x00,0xf0,0x0f,0x08,0xff,0x60,0x5d,0x06,0xe1,0x11,0x17,0xf0,
+0x05,0xf8,0xe6,0x06,0xe0,0x6e,0x11,0x11,0x7f,0x00,0x3b,0x0e,0x60,0x6e,0x06,0xfe,
+0xee,0xef,0xf0,0x00,0x00,0x13,0x00,0x50,0x00,0x00,0x5f,0x00,0x00,0x13,0x00,0x01,
+0x90,0x03,0x03,0x13,0x00,0x12,0x6f,0x13,0x00,0x32,0xe2,0x22,0x27,0x13,0x00,0x01,
+0x4c,0x00,0x00,0x13,0x00,0x04,0xd1,0x00,0x60,0x06,0xf6,0x66,0x66,0x66,0x66,0x2d,
+0x02,0x20,0x5d,0xdd,0x01,0x00,0x18,0x10,0xf8,0x01,0x30,0x80,0x00,0x0e,0x60,0x01,
+0x00,0x97,0x02,0x11,0x0a,0x87,0x03,0x11,0x9e,0x27,0x03,0xd1,0xf7,0x00,0x02,0xf7,
+0x0f,0x73,0x33,0x33,0x33,0xf7,0x00,0x0a,0xf1,0xe3,0x04,0x60,0xe7,0x00,0x5f,0xe0,
+0x0f,0x83,0x12,0x00,0x41,0x02,0xef,0xe0,0x0f,0x24,0x00,0x32,0x0d,0xe9,0xe0,0xfe,
+0x04,0xf3,0x11,0x0a,0x36,0xe0,0x0f,0xbf,0xff,0xff,0xff,0xfb,0x00,0x06,0xe0,0x1f,
+0xaa,0x2e,0x32,0xe2,0x7b,0x00,0x06,0xe0,0x2f,0x99,0x0e,0x10,0xe0,0x6b,0x00,0x06,
+0xe0,0x4f,0x7a,0x09,0x00,0x23,0x6e,0x7f,0x24,0x00,0x50,0x9b,0x6a,0x1e,0x22,0xe1,
+0x24,0x00,0x22,0xd8,0x69,0x1b,0x00,0xf1,0x08,0xe2,0xf3,0x69,0x0e,0x10,0xe1,0x8b,
+0x00,0x06,0xe1,0xb0,0x69,0x0e,0x10,0xd8,0xd6,0x00,0x00,0x2b,0x10,0x00,0x3d,0x10,
+0xa2,0x00,0xb3,0xe2,0x22,0x23,0xfa,0x22,0x22,0x20,0x00,0x01,0xf7,0xcf,0x44,0x01,
+0x14,0x7f,0xbe,0x00,0x32,0x1e,0x80,0x06,0x08,0x03,0x41,0x09,0xf5,0x00,0x6c,0xd7,
+0x04,0xf1,0x08,0x05,0xff,0x50,0x06,0xc2,0x22,0x22,0x2f,0x60,0x01,0xfc,0xf5,0x00,
+0x6d,0xdd,0xdd,0xdd,0xd6,0x00,0x0b,0x1e,0x50,0x22,0x01,0x00,0x43,0x00,0x00,0xe5,
+0x1f,0xcb,0x04,0x31,0x0e,0x51,0xf2,0xdb,0x04,0xf2,0x04,0x00,0x00,0xe5,0x1e,0x45,
+0x55,0x55,0x55,0x55,0xe0,0x00,0x0e,0x50,0x05,0xcc,0xcf,0xec,0xcc,0x30,0xbb,0x01,
+0x11,0xe7,0x55,0x03,0x12,0x50,0xed,0x01,0x00,0x13,0x00,0x33,0x02,0x44,0xf7,0x13,
+0x00,0x37,0x5f,0xec,0x20,0x41,0x01,0x13,0x10,0x2c,0x00,0x80,0x00,0xd6,0x00,0x04,
+0xf3,0xef,0xff,0xfe,0x09,0x00,0xe0,0x0a,0xe0,0xe9,0x66,0x9e,0x0e,0x50,0xd6,0x00,
+0x1f,0x80,0xe4,0x00,0x5e,0x09,0x00,0xf2,0x05,0x7f,0x40,0xe7,0x33,0x8e,0x0e,0x50,
+0xd6,0x01,0xff,0x40,0xee,0xdd,0xee,0x0e,0x50,0xd6,0x0a,0xff,0x40,0x1b,0x00,0x23,
+0x5f,0x8f,0x09,0x00,0x60,0x4b,0x1f,0x40,0xed,0xcc,0xde,0x24,0x00,0x50,0x0f,0x40,
+0xe8,0x44,0x8e,0x36,0x00,0x23,0x0f,0x40,0x3f,0x00,0x07,0x12,0x00,0x32,0xde,0xee,
+0xed,0x09,0x00,0x50,0x0a,0x20,0x90,0x02,0x00,0x09,0x00,0x40,0x8e,0x10,0xb9,0x00,
+0x09,0x00,0xff,0x01,0x47,0xf4,0x00,0x2f,0x20,0x44,0xf5,0x00,0x0f,0x48,0x40,0x00,
+0x04,0x00,0xff,0xc1,0x89,0x04,0x01,0x61,0xa8,0x00,0x0f,0x50,0x07,0xd0,0xe6,0x03,
+0x02,0x09,0x00,0x40,0x07,0xf0,0xdf,0xff,0xd6,0x06,0xc3,0x00,0x0d,0x90,0x45,0x5f,
+0x95,0x5a,0xe5,0x52,0x00,0x4f,0x50,0x1b,0x00,0x22,0xcf,0x46,0x9b,0x04,0x50,0x06,
+0xff,0x42,0x56,0xfc,0x24,0x01,0x41,0x1f,0xaf,0x40,0x0b,0x37,0x01,0x42,0x0c,0x1f,
+0x41,0xbf,0x48,0x01,0xf1,0x05,0x0f,0x7e,0xef,0x82,0x29,0xc2,0x26,0xf0,0x00,0x0f,
+0x59,0x2e,0x81,0x19,0xc1,0x15,0xf0,0x00,0x0f,0x40,0x40,0x02,0x01,0x09,0x00,0x41,
+0x70,0x08,0xb0,0x04,0x09,0x00,0x41,0xa4,0x4a,0xd4,0x48,0x09,0x00,0x44,0xdb,0xbe,
+0xeb,0xbd,0x1b,0x00,0x14,0x26,0x09,0x00,0x82,0x8e,0xa0,0x00,0x00,0x07,0x10,0x08,
+0x30,0xf7,0x04,0x50,0xf1,0x07,0xf6,0x44,0x40,0x0a,0x00,0x60,0xe8,0x03,0xfc,0xcc,
+0xef,0x30,0x89,0x04,0x50,0x14,0xf8,0x00,0x1e,0x60,0x7d,0x01,0x13,0x96,0xbf,0x01,
+0x80,0x09,0xf6,0xb9,0xf3,0x11,0xb8,0x11,0x6f,0x8c,0x08,0xa2,0x2f,0x10,0x1f,0x30,
+0x04,0xf0,0x02,0xfa,0xe6,0x02,0x1e,0x02,0xf0,0x0d,0x0a,0x0e,0x60,0x01,0x3d,0xf4,
+0x11,0x11,0x20,0x00,0x00,0xe6,0x02,0x8f,0xaa,0xc0,0x01,0xad,0x00,0x00,0x0e,0x63,
+0xe9,0x30,0x8f,0x97,0xfa,0x20,0xa5,0x03,0xe0,0x05,0xd8,0x4f,0xad,0x60,0x00,0x00,
+0x0e,0x61,0x8e,0xb2,0x1c,0xf4,0x5e,0x20,0x03,0x60,0x18,0x20,0x6e,0x7d,0x70,0xd9,
+0x33,0x03,0xf9,0x08,0x17,0xed,0x20,0xe7,0x03,0xfa,0x10,0x00,0xe6,0x5f,0xc5,0x12,
+0x6f,0x30,0x04,0xb0,0x00,0x0e,0x60,0x30,0x03,0xff,0x80,0x43,0x01,0x11,0x66,0x01,
+0x00,0x10,0x62,0x6a,0x07,0x00,0x01,0x00,0x2f,0xf5,0x00,0x01,0x00,0x08,0x13,0x11,
+0x01,0x00,0x32,0x10,0xbf,0xff,0x01,0x00,0xa1,0xe0,0x23,0x33,0x3f,0xa3,0x33,0xea,
+0x33,0x33,0x30,0x8e,0x07,0x12,0xd9,0x1f,0x08,0x13,0x40,0x09,0x00,0x23,0x7f,0x10,
+0x09,0x00,0x10,0xda,0x2a,0x06,0x50,0x01,0x60,0x00,0x06,0xf4,0x09,0x00,0x50,0x02,
+0xf2,0x00,0x4f,0x90,0x09,0x00,0xc0,0x04,0xf0,0x18,0xfb,0x00,0x00,0x00,0xcd,0x65,
+0x5b,0xd0,0xaf,0x95,0x00,0x4f,0x5e,0xff,0xfe,0x50,0x71,0x06,0x02,0x24,0x06,0xe1,
+0x32,0x05,0x14,0xeb,0x13,0x00,0x10,0x7c,0x4d,0x03,0x14,0x6f,0x87,0x00,0x60,0x26,
+0x66,0x6a,0xfa,0x66,0x66,0x51,0x08,0x60,0x00,0x2f,0xb0,0x00,0x1c,0x40,0x2b,0x00,
+0x40,0xdd,0x10,0x00,0x08,0xe4,0x02,0x20,0x1c,0xd1,0x8b,0x00,0xf1,0x0e,0x90,0x00,
+0x02,0xef,0xdc,0xdd,0xef,0xff,0xff,0xf9,0x00,0x00,0xdb,0xab,0xf9,0x65,0xfa,0x32,
+0x7f,0x40,0x00,0x00,0x06,0xf1,0x00,0xe9,0x00,0x03,0x00,0x33,0x0a,0x12,0xe9,0x79,
+0x06,0x10,0xa0,0x09,0x00,0x70,0x30,0x00,0x00,0x6f,0x30,0x00,0xe9,0xb0,0x05,0x20,
+0x05,0xfb,0x9c,0x09,0xfe,0x06,0x02,0xf3,0x02,0x9f,0xb0,0x00,0x00,0xdd,0x55,0x59,
+0xf0,0x5f,0xf8,0x00,0x00,0x00,0x6e,0xff,0xff,0x70,0x05,0xa9,0x00,0x32,0x02,0x71,
+0x01,0x41,0x01,0x23,0x08,0xf0,0x09,0x00,0x23,0x0d,0xb0,0x09,0x00,0x02,0x31,0x05,
+0xe2,0xf8,0x00,0x00,0xbe,0x66,0x67,0xf9,0x66,0x66,0x63,0x00,0x04,0xf5,0x00,0x1b,
+0x00,0x44,0x09,0xc0,0x00,0x01,0x77,0x01,0x02,0x09,0x00,0x14,0x9f,0xd8,0x00,0x80,
+0x46,0x66,0x6d,0xd6,0x66,0xcd,0x66,0x66,0xe1,0x01,0x41,0x80,0x00,0xab,0x00,0x1d,
+0x06,0x34,0x60,0x00,0xab,0x5f,0x01,0x11,0xab,0x34,0x00,0xa0,0xea,0x00,0x00,0xab,
+0x00,0x02,0xe1,0x00,0x1d,0xe2,0x09,0x00,0x30,0x03,0xf1,0x05,0x67,0x02,0xe7,0x9e,
+0x55,0x5a,0xe0,0x9f,0xb2,0x00,0x00,0x00,0x4e,0xff,0xfe,0x60,0x13,0xa4,0x00,0x14,
+0x30,0x09,0x00,0x24,0x2f,0x90,0x0a,0x00,0x24,0x7f,0xa0,0x0a,0x00,0x24,0x6f,0x70,
+0x0a,0x00,0x14,0x9f,0x16,0x04,0x24,0x08,0xfb,0x13,0x00,0x24,0xdf,0xf4,0x3a,0x00,
+0x23,0x7c,0xc0,0xd5,0x07,0x23,0xf2,0x4f,0xce,0x06,0x33,0xeb,0x00,0xbe,0x4c,0x00,
+0x32,0x40,0x03,0xf8,0xa8,0x00,0x23,0xb0,0x00,0x5f,0x03,0x11,0xf2,0x96,0x01,0x00,
+0x73,0x0b,0x00,0x62,0x00,0x41,0x90,0x00,0x00,0x0a,0x22,0x00,0x42,0xaf,0x90,0x00,
+0x4e,0x3f,0x0a,0x33,0xbf,0xd1,0x0b,0x6d,0x0a,0x1f,0x9d,0x72,0x08,0x04,0x03,0xc5,
+0x09,0x00,0x36,0x00,0x04,0x0c,0x02,0x33,0x8f,0x4b,0xd1,0xaa,0x00,0x31,0x40,0x0b,
+0xe3,0x08,0x01,0x50,0xbf,0x50,0x00,0x0b,0xf6,0x8e,0x08,0x20,0xee,0x30,0xb7,0x00,
+0x50,0x20,0x00,0x2b,0xfb,0x10,0x0f,0x00,0x41,0xef,0x70,0x0d,0xe5,0x50,0x01,0x61,
+0xfa,0xaf,0x60,0x20,0x05,0x55,0xb2,0x09,0x01,0x06,0x01,0x15,0x0f,0x26,0x07,0x03,
+0x41,0x0a,0x60,0xde,0xee,0xef,0xfe,0xee,0xe8,0x34,0x00,0x12,0x55,0xd8,0x09,0x1e,
+0x00,0x26,0x00,0xb3,0x01,0x44,0x44,0x44,0x4f,0x94,0x44,0x44,0x43,0x00,0x4f,0xa7,
+0x01,0x81,0xc0,0x00,0x00,0x04,0x10,0x00,0x25,0x00,0x83,0x05,0x31,0x60,0x00,0x7f,
+0x5c,0x00,0x40,0xbd,0x00,0x00,0x0d,0x26,0x01,0x00,0x5f,0x08,0x20,0x04,0xf8,0xdd,
+0x05,0x11,0xc0,0xac,0x00,0x42,0x00,0x00,0xbf,0x30,0x15,0x01,0xb0,0x09,0xf6,0x00,
+0x08,0xe2,0x00,0x01,0xee,0x20,0x9f,0x90,0x2d,0x01,0xc3,0x00,0x3f,0xe0,0x28,0x00,
+0x00,0xaf,0x20,0x00,0x00,0x04,0x50,0x33,0x00,0x01,0x41,0x02,0x41,0xd0,0x00,0x1b,
+0x40,0xe7,0x00,0x40,0x30,0x00,0x0c,0xe1,0x9b,0x00,0xf4,0x12,0xf7,0x00,0x00,0x01,
+0xec,0x00,0x00,0x00,0x2e,0xb0,0x00,0x00,0x12,0x7f,0x80,0x00,0x03,0xef,0xcc,0xde,
+0xff,0xff,0xff,0xf3,0x00,0x01,0xfd,0xca,0x98,0x76,0x54,0x22,0xed,0xaf,0x00,0x27,
+0x5e,0x30,0x41,0x01,0x13,0x79,0xa2,0x09,0x32,0x00,0x9c,0x00,0xb4,0x0c,0x0d,0x09,
+0x00,0x13,0x3f,0xcf,0x00,0xae,0x60,0x16,0x66,0xce,0x66,0x66,0x6e,0xc6,0x66,0x20,
+0x2d,0x00,0x07,0x09,0x00,0x12,0xac,0x09,0x00,0x13,0xff,0x01,0x00,0x23,0xf1,0x55,
+0x01,0x00,0x72,0x50,0x00,0x00,0x06,0x10,0x00,0x16,0xad,0x01,0xf0,0x03,0x40,0x00,
+0x6f,0xb1,0x00,0x00,0x00,0x1b,0xf4,0x00,0x00,0x03,0xee,0x30,0x00,0x05,0xee,0x30,
+0x92,0x03,0x42,0xf6,0x00,0x7f,0xa1,0x20,0x00,0x22,0x50,0x04,0x9e,0x00,0x41,0x04,
+0x00,0x00,0x01,0x47,0x00,0x10,0xf4,0x3a,0x02,0x60,0x62,0x22,0x22,0x22,0x4f,0x40,
+0xd7,0x05,0x41,0x22,0x22,0x22,0x24,0x13,0x00,0x01,0x1d,0x00,0x00,0x13,0x00,0x10,
+0xf4,0x67,0x03,0x01,0x13,0x00,0x50,0x84,0x44,0x44,0x44,0x6f,0x13,0x00,0x51,0xfd,
+0xcc,0xcc,0xcc,0xcc,0x13,0x00,0x10,0x40,0x9d,0x02,0x19,0x40,0x4c,0x00,0x55,0x51,
+0x11,0x11,0x11,0x3f,0x39,0x00,0x43,0xf5,0x00,0x00,0xef,0xb1,0x00,0xb1,0xf0,0x04,
+0x44,0x45,0xa4,0x44,0x44,0xb6,0x44,0x44,0x00,0x98,0x00,0x70,0x2d,0xf9,0x20,0x00,
+0x00,0x5c,0xf9,0xb3,0x01,0x52,0xdf,0x91,0x00,0xcf,0xa3,0xce,0x02,0x33,0xc0,0x02,
+0x20,0xfc,0x04,0x01,0xe0,0x03,0x14,0xa2,0x02,0x03,0x13,0x30,0xf1,0x03,0x13,0xf3,
+0x44,0x05,0x63,0x8f,0x86,0x66,0x66,0x60,0x0f,0x5b,0x00,0x00,0x4e,0x0d,0xa0,0x4f,
+0x10,0x00,0x04,0xf0,0x0f,0x50,0x00,0x06,0xf0,0x98,0x07,0x11,0xf5,0xf7,0x01,0x01,
+0x11,0x00,0x31,0x1f,0xdf,0x40,0x11,0x00,0x40,0x0c,0xe0,0x8f,0x60,0x11,0x00,0xf1,
+0x0a,0x09,0xf3,0x00,0x7f,0x70,0x4f,0x00,0xf5,0x1b,0xf5,0x00,0x00,0x6f,0x84,0xf0,
+0x0f,0x5d,0xd3,0x00,0x00,0x00,0x7b,0x5f,0x00,0xf5,0x2f,0x08,0x01,0x33,0x00,0x02,
+0xdc,0x07,0x01,0x1b,0x04,0x22,0x57,0x6a,0x11,0x00,0x62,0x06,0xee,0xc7,0x00,0x16,
+0x66,0x01,0x00,0x23,0x23,0xff,0xbc,0x05,0xff,0x01,0x3f,0x20,0x00,0x03,0xf2,0x00,
+0x00,0x1f,0x53,0xf2,0x00,0x00,0x3f,0x20,0x00,0x01,0x11,0x00,0x08,0x84,0xf8,0x77,
+0x77,0x9f,0x87,0x77,0x77,0xf5,0xf5,0x01,0x11,0x53,0xab,0x03,0x02,0x22,0x00,0x01,
+0xbe,0x03,0x0f,0x11,0x00,0x0c,0xc0,0x02,0x66,0x8f,0x43,0xf2,0x00,0x00,0x00,0x00,
+0x1e,0xed,0xa0,0x22,0x07,0xff,0x01,0x00,0xf0,0x03,0xf7,0x00,0x36,0x66,0x66,0x68,
+0xf7,0x66,0x66,0x66,0x30,0x00,0x00,0x00,0x00,0x4f,0x10,0x00,0x01,0x00,0xf0,0x0f,
+0x55,0x55,0x58,0xf7,0x55,0x55,0x50,0x00,0x00,0x0e,0xfe,0xee,0xff,0xee,0xee,0xfe,
+0x00,0x00,0x00,0xe6,0x00,0x04,0xf1,0x00,0x07,0xe0,0x00,0x00,0x0e,0x60,0x26,0x00,
+0x51,0x7e,0x00,0x00,0x00,0xef,0x42,0x00,0x00,0x13,0x00,0x67,0x93,0x33,0x7f,0x53,
+0x33,0x9e,0x26,0x00,0xb3,0x15,0x5f,0xa5,0x55,0x8f,0x75,0x55,0xaf,0x55,0x12,0xff,
+0x01,0x00,0x10,0xf3,0x39,0x00,0x21,0x00,0x00,0x39,0x00,0x10,0xe6,0x09,0x00,0x03,
+0x4c,0x00,0x43,0x00,0x03,0x55,0xbe,0x13,0x00,0x21,0x6f,0xfd,0x22,0x00,0x10,0x6e,
+0x84,0x00,0xf0,0x01,0x20,0x00,0x06,0xf1,0x00,0x01,0x20,0x1f,0x50,0x00,0x6f,0x10,
+0x00,0x6f,0x11,0xf5,0x0f,0x00,0x2e,0x06,0xf1,0x0f,0x00,0x52,0x7f,0x10,0x00,0x7f,
+0x11,0x62,0x00,0xa0,0xf1,0x05,0x55,0x55,0xaf,0x65,0x55,0x55,0x0d,0x80,0x1e,0x00,
+0x40,0x00,0x9b,0xf9,0x00,0x2d,0x00,0x31,0x0b,0xdf,0x90,0x0f,0x00,0x1e,0xbd,0x0f,
+0x00,0x10,0x7f,0x0f,0x00,0x02,0x3c,0x00,0x21,0xfd,0x55,0x01,0x00,0x91,0x5c,0xd0,
+0x00,0x00,0x00,0x93,0x00,0x02,0x90,0x06,0x01,0x41,0x6f,0x40,0x00,0x2f,0x92,0x00,
+0x50,0x0d,0xc0,0x00,0x00,0x9e,0x96,0x00,0xf0,0x06,0x08,0xf3,0x00,0x00,0x01,0xeb,
+0x00,0x00,0x00,0x03,0xfa,0x00,0x00,0x00,0x04,0xf8,0x00,0x00,0x02,0xed,0x00,0x18,
+0x00,0x50,0xf6,0x00,0x02,0xdf,0x20,0x0a,0x00,0x51,0x0b,0xf7,0x00,0xcf,0xaf,0x53,
+0x00,0xb0,0x5c,0xc0,0x01,0x32,0x66,0x6e,0xc6,0x66,0x68,0xf4,0x01,0x19,0x00,0x41,
+0xf7,0x00,0x00,0x3f,0x63,0x01,0x50,0x3f,0x40,0x00,0x03,0xf2,0x09,0x00,0x50,0x09,
+0xf0,0x00,0x00,0x5f,0x56,0x00,0x60,0x01,0xf8,0x00,0x00,0x06,0xf0,0x13,0x00,0x50,
+0xcf,0x10,0x00,0x00,0x8e,0x09,0x00,0xe0,0xbf,0x40,0x00,0x00,0x0b,0xc0,0x00,0x00,
+0x06,0xef,0x50,0x00,0x46,0x57,0x20,0x00,0xb4,0xfa,0x20,0x00,0x06,0xff,0xfc,0x10,
+0x00,0x00,0x01,0x00,0x01,0x00,0x23,0x04,0x40,0x09,0x00,0xc1,0x07,0xe1,0x00,0x11,
+0x11,0x11,0x11,0x10,0x00,0x00,0xd9,0x01,0xd5,0x01,0xf0,0x0d,0x04,0x55,0x87,0x51,
+0x44,0x4f,0x84,0x44,0xf7,0x0d,0xff,0xff,0xf6,0x00,0x1f,0x50,0x00,0xf6,0x00,0x00,
+0x08,0xe0,0x00,0x2f,0x30,0x00,0xf5,0x00,0xd4,0x00,0x20,0x3f,0x20,0x09,0x00,0xf0,
+0x19,0xcb,0x09,0x10,0x5f,0x10,0x01,0xf4,0x00,0x0a,0xf8,0xbb,0x00,0x8e,0x00,0x01,
+0xf4,0x00,0x9f,0xff,0xd0,0x00,0xbb,0x00,0x02,0xf3,0x0b,0xf7,0xf7,0xf7,0x00,0xe7,
+0x00,0x03,0xf2,0x0c,0x42,0xf4,0x5c,0x04,0xf4,0xd4,0x01,0x80,0x02,0xf4,0x00,0x0b,
+0xd0,0x00,0x06,0xf0,0x09,0x00,0x20,0x3f,0x50,0x4d,0x00,0x20,0x02,0xf4,0xfc,0x00,
+0xfd,0x05,0x0b,0xb0,0x00,0x02,0xf4,0x1e,0xe2,0x03,0x76,0x8f,0x70,0x00,0x02,0xf4,
+0x1c,0x30,0x02,0xde,0xd9,0x00,0x01,0x00,0xff,0x0b,0x61,0x02,0xee,0xee,0xee,0xe4,
+0x00,0x00,0x01,0xf4,0x02,0xf7,0x55,0x55,0xf5,0x07,0x30,0x01,0xf4,0x02,0xf2,0x00,
+0x00,0xf5,0x0e,0x70,0x09,0x00,0x02,0x31,0xff,0xff,0xff,0x09,0x00,0x51,0x00,0x45,
+0xf7,0x44,0x41,0x09,0x00,0x41,0x02,0xf3,0x00,0x00,0x09,0x00,0x41,0x04,0xfb,0xbb,
+0xb5,0x09,0x00,0x41,0x07,0xf9,0x99,0xf6,0x09,0x00,0x32,0x0a,0xc0,0x00,0x2d,0x00,
+0xe0,0x0e,0x80,0x00,0xf4,0x0e,0x60,0x01,0xf4,0x00,0x5f,0x20,0x01,0xf3,0x00,0xcf,
+0x00,0x40,0xdb,0x00,0x03,0xf1,0x09,0x00,0xf8,0x03,0x0b,0xf2,0x13,0x2a,0xe0,0x00,
+0x35,0x57,0xf3,0x1c,0x40,0x2f,0xfe,0x60,0x00,0x5f,0xff,0xa0,0x9d,0x00,0xb1,0x02,
+0x71,0x00,0x00,0x00,0x72,0x00,0x03,0x69,0xdf,0xe7,0x2d,0x00,0xfc,0x04,0xff,0xdf,
+0xb3,0x00,0x01,0x71,0x01,0xf4,0x03,0x20,0x0e,0x70,0x00,0x02,0xf3,0x01,0xf4,0x00,
+0x00,0x09,0x00,0x10,0x0e,0x65,0x01,0xa1,0x52,0xf3,0x01,0xf4,0x04,0x44,0x9f,0xa4,
+0x44,0x12,0x1b,0x00,0x22,0xdf,0xf3,0x24,0x00,0x41,0x05,0xff,0xdf,0x40,0x09,0x00,
+0x41,0x0d,0x7e,0x78,0xf4,0x09,0x00,0x40,0x8d,0x0e,0x70,0x9e,0x09,0x00,0x50,0x05,
+0xf4,0x0e,0x70,0x03,0x09,0x00,0x50,0x1f,0x60,0x0e,0x70,0x00,0x6c,0x00,0x23,0x05,
+0x00,0x09,0x00,0x11,0x00,0x09,0x00,0x32,0x27,0x68,0xf3,0x09,0x00,0x61,0x2f,0xed,
+0x90,0x00,0x00,0xa6,0xda,0x01,0x40,0x30,0x00,0x09,0xe0,0x09,0x00,0xf0,0x21,0xe7,
+0x56,0x66,0x8f,0x96,0x66,0x22,0x80,0x0e,0x7d,0xee,0xef,0xfe,0xee,0xe5,0x4f,0x10,
+0xe7,0x00,0x0a,0xd1,0x00,0x00,0x04,0xf1,0x0e,0x70,0x06,0xf2,0x00,0x67,0x00,0x4f,
+0x10,0xe7,0x04,0xf5,0x00,0x1f,0x70,0x04,0xf1,0x0e,0x73,0xff,0xdd,0xef,0xc0,0x11,
+0x00,0x41,0x09,0x76,0x5d,0xe2,0x22,0x00,0x50,0x00,0x0b,0xf3,0x09,0xe0,0x33,0x00,
+0x40,0x2c,0xe3,0x04,0xf5,0x11,0x00,0x40,0x8f,0xc1,0x04,0xf9,0x22,0x00,0x41,0x6f,
+0x70,0x05,0xfd,0x22,0x00,0x40,0x10,0x08,0xfd,0xf5,0x66,0x00,0xf1,0x03,0x00,0x4d,
+0xf7,0x06,0xf8,0x00,0x00,0x0e,0x74,0xcf,0xc2,0x00,0x04,0xe4,0x04,0x45,0xf6,0x5c,
+0x64,0x02,0x36,0x9f,0xfc,0x10,0x31,0x01,0x02,0x0b,0x00,0xf0,0x29,0x01,0x20,0x0f,
+0x50,0x16,0x10,0x00,0x00,0xb3,0xac,0x00,0xf5,0x07,0xf1,0x00,0x00,0x0f,0x53,0xf3,
 0x0f,0x50,0xda,0x04,0xd0,0x00,0xf5,0x0d,0x80,0xf5,0x3f,0x20,0x5f,0x00,0x0f,0x50,
 0x54,0x0f,0x53,0x70,0x05,0xf0,0x00,0xf5,0x3e,0xee,0xfe,0xee,0x60,0x5f,0x00,0x0f,
-0x54,0xf7,0x66,0x66,0xf6,0x11,0x00,0x10,0x4f,0x3f,0x10,0x00,0x11,0x00,0x32,0xf5,
-0x44,0x44,0x11,0x00,0x00,0xc3,0x06,0x00,0x11,0x00,0x10,0xf1,0x85,0x13,0x00,0x11,
-0x00,0x31,0x54,0x44,0x4f,0x11,0x00,0x00,0x19,0x0c,0x23,0x04,0xc0,0x33,0x00,0x13,
-0x00,0x22,0x00,0x20,0x00,0x00,0x11,0x00,0xe3,0x15,0x5f,0x60,0x01,0x44,0x6f,0x44,
-0xf1,0x00,0xee,0xc1,0x00,0x2f,0xff,0xde,0x08,0x1c,0x11,0xa1,0x15,0x22,0x08,0xb0,
-0x7f,0x07,0x23,0x02,0xf8,0x8e,0x1a,0x16,0xbd,0x4f,0x06,0x14,0xe5,0x00,0x07,0x03,
-0x30,0x00,0xf1,0x10,0x33,0x00,0xbe,0xee,0xee,0xe2,0x06,0x90,0x0b,0xa0,0x0b,0xb4,
-0x44,0x6f,0x20,0x8c,0x00,0xba,0x00,0xb9,0x00,0x02,0xf2,0x08,0xc0,0x0b,0xa0,0x0b,
-0xfd,0xdd,0xdf,0x11,0x00,0x32,0xbb,0x44,0x46,0x11,0x00,0x31,0x90,0x00,0x2f,0x11,
-0x00,0x32,0xbf,0xdd,0xdd,0x11,0x00,0x08,0x33,0x00,0x20,0x00,0x00,0x22,0x00,0x80,
-0x23,0x6f,0x20,0x02,0x54,0xda,0x00,0xb9,0x69,0x34,0x39,0x4f,0xfd,0x40,0x05,0x0d,
-0x00,0x50,0x08,0x40,0x31,0x11,0x18,0xf2,0xb6,0x03,0x11,0xf4,0x91,0x00,0xf0,0x0f,
-0x51,0x40,0x0f,0x4e,0x50,0x02,0x60,0x00,0xf5,0x5e,0x00,0xf4,0xb6,0x22,0x6e,0x22,
-0x2c,0x35,0xe0,0x0f,0x40,0xce,0xef,0xfe,0xee,0x30,0x5e,0x00,0xf4,0x00,0x42,0x10,
-0x50,0x05,0xe0,0x0f,0x40,0x6f,0xbf,0x0e,0x01,0x11,0x00,0x11,0x5e,0x11,0x00,0x11,
-0x4d,0x3d,0x10,0x80,0x5e,0x00,0xf4,0x11,0x11,0x6e,0x11,0x11,0x22,0x00,0x40,0x23,
-0x37,0xf3,0x33,0x22,0x00,0x10,0x0c,0x19,0x00,0xf0,0x02,0x05,0xd0,0x0f,0x40,0xc7,
-0x00,0x00,0x1f,0x20,0x00,0x00,0xf4,0x0c,0x60,0x00,0x00,0xf2,0xda,0x10,0xf4,0x00,
-0xce,0xdd,0xdd,0xdf,0x20,0x04,0x57,0xf4,0x0c,0x93,0x33,0x34,0xd2,0x00,0x7f,0x1f,
-0x4a,0x09,0xf6,0x18,0x01,0x94,0x07,0x0e,0x11,0x00,0x14,0x05,0xee,0x1c,0x12,0x27,
-0x8d,0x06,0x22,0xaf,0x10,0xbc,0x04,0x23,0x06,0xf0,0xe4,0x1b,0x13,0x7f,0x9d,0x4d,
-0x23,0x08,0xe0,0x6f,0x3b,0x13,0x9d,0xe1,0x1e,0x23,0x0b,0xb0,0xd5,0x4b,0x10,0xca,
-0x7d,0x67,0x02,0x3d,0x44,0x22,0x09,0xf6,0xef,0x11,0x22,0x0a,0xf8,0x46,0x15,0x20,
-0x2d,0xf7,0x78,0x56,0x21,0x7e,0xd0,0x3e,0x39,0x15,0x4f,0x24,0x18,0x0d,0xf1,0x04,
-0x00,0x73,0x11,0x00,0x6f,0x1d,0x01,0x55,0x00,0x41,0x0d,0xde,0xfe,0xdd,0x0a,0x45,
-0x00,0x27,0x04,0x00,0x7d,0x0b,0x10,0x65,0x09,0x00,0x01,0xc3,0x74,0x01,0x39,0x04,
-0x20,0x0d,0x80,0x6b,0x0b,0x11,0xf3,0x15,0x0a,0x10,0xba,0x09,0x00,0x00,0x74,0x08,
-0x11,0xc9,0x09,0x00,0x20,0x5f,0x20,0xdc,0x0c,0x40,0xf3,0x15,0x20,0xad,0x98,0x21,
-0xc0,0x05,0xfd,0xff,0x40,0xe8,0x00,0x00,0xf7,0x1c,0xff,0xd9,0x40,0x12,0x43,0x31,
-0xf5,0x09,0x61,0x72,0x0b,0x11,0x02,0x87,0x08,0x22,0xde,0x00,0x87,0x45,0x60,0x5e,
-0xe3,0x00,0x76,0x6d,0xd0,0xda,0x4b,0x48,0x20,0x00,0xdf,0xfd,0xaf,0x09,0x19,0xd4,
-0x11,0x0c,0x02,0xd9,0x03,0x00,0x5b,0x2f,0xb2,0x72,0x05,0x67,0xf9,0x66,0x62,0x3f,
-0xed,0xde,0xf4,0x0b,0xf2,0x07,0x21,0x02,0xf4,0x2c,0x04,0x01,0x09,0x00,0x40,0x04,
-0xf1,0x02,0xf3,0x09,0x00,0x00,0x1d,0x1b,0x02,0x09,0x00,0x41,0x06,0xf0,0x04,0xf2,
-0x09,0x00,0x41,0x09,0xc0,0x05,0xf1,0x09,0x00,0x41,0x0c,0x90,0x06,0xf0,0x09,0x00,
-0x41,0x0e,0x70,0x07,0xe0,0x09,0x00,0x41,0x4f,0x20,0x09,0xd0,0x09,0x00,0x40,0x9d,
-0x00,0x0b,0xb0,0x09,0x00,0xf1,0x08,0x01,0xe8,0x00,0x0e,0x90,0x3f,0x86,0x68,0xf4,
-0x09,0xf1,0x56,0xaf,0x40,0x3f,0xff,0xff,0xf4,0x0e,0x60,0x7f,0xe9,0x00,0x1b,0x00,
-0x06,0x60,0x31,0x10,0x76,0x56,0x1b,0x04,0xbb,0x27,0x11,0x5f,0xdb,0x06,0x11,0x50,
-0x09,0x00,0x01,0x18,0x3b,0x00,0x52,0x02,0xd0,0x02,0x34,0x43,0x34,0x33,0x45,0x9f,
-0x55,0x53,0x00,0x0c,0x80,0x0e,0x7a,0x42,0xc0,0xfa,0x00,0x6f,0x10,0x07,0xe1,0x00,
-0x7d,0x00,0xa9,0x03,0xf6,0x75,0x44,0xf0,0x04,0x9b,0x00,0xb9,0x0b,0x92,0x00,0x4f,
-0x3e,0x20,0xaa,0x00,0xb8,0x01,0x0a,0xc0,0xaa,0x00,0x00,0xc8,0xcc,0x28,0x20,0xcc,
-0xf4,0x79,0x0d,0x80,0xd7,0x00,0x00,0x1e,0xf0,0x00,0x04,0xf0,0xa3,0x03,0x21,0x5f,
-0xf9,0x9c,0x05,0xf0,0x05,0x00,0x03,0xf7,0x3f,0x60,0x2f,0x40,0x00,0xf4,0x00,0x3e,
-0xa0,0x07,0x50,0xbd,0x00,0x03,0xf2,0x07,0xf9,0x54,0x34,0x30,0x14,0x4a,0xe0,0xcf,
-0x4e,0x58,0x3e,0x40,0x0f,0xfe,0x60,0x1b,0x57,0xd0,0x46,0x94,0x00,0x58,0x00,0x00,
-0x0b,0xef,0xff,0xda,0x84,0x00,0x8c,0xa7,0x22,0x21,0x0f,0x30,0xc1,0x0a,0xf1,0x27,
-0x1e,0xee,0xef,0xee,0xee,0x40,0x9c,0x00,0x00,0x03,0x33,0x3f,0x63,0x33,0xba,0xde,
-0xaa,0xa7,0x01,0x22,0x3f,0x52,0x22,0xef,0xff,0xff,0xfa,0x09,0xec,0xdf,0xdc,0xdd,
-0x00,0xba,0x00,0xba,0x09,0x90,0x0f,0x30,0x4d,0x00,0xc8,0x00,0xb9,0x09,0xfe,0xef,
-0xfe,0xfd,0x00,0xf7,0x00,0xc9,0x12,0x00,0xf0,0x17,0x01,0xf5,0x00,0xc8,0x09,0xec,
-0xcf,0xdc,0xdd,0x03,0xf1,0x00,0xd7,0x01,0x11,0x2f,0x51,0x11,0x08,0xd0,0x00,0xe7,
-0x07,0xcc,0xcf,0xdc,0xcb,0x0d,0x90,0x00,0xf6,0x02,0x44,0x5f,0x74,0x44,0x7f,0x20,
-0x53,0x03,0xf0,0x03,0x2f,0x76,0x89,0xf9,0x00,0x03,0xf3,0x0d,0xff,0xfe,0xca,0xbf,
-0xc1,0x15,0x4b,0xe0,0x05,0x31,0x36,0x15,0x19,0x0e,0xa2,0x00,0x33,0x04,0xd2,0x01,
-0xf7,0x71,0x14,0xcd,0x24,0x03,0x20,0x5f,0x50,0x23,0x02,0x11,0x10,0x29,0x08,0x20,
-0x2f,0x40,0x05,0x30,0x20,0x08,0xf7,0x36,0x02,0xe0,0x1e,0xe2,0x00,0x04,0xff,0x70,
-0x00,0x2f,0x40,0x0c,0xf3,0x00,0x03,0xed,0x13,0x00,0xa0,0x0c,0xf5,0x00,0x00,0xee,
-0x2f,0x70,0x00,0x2f,0x6d,0x71,0x33,0x63,0x30,0xf7,0x00,0x02,0xff,0xe3,0xf5,0x37,
-0x22,0x8f,0xc1,0x0d,0x40,0x32,0x04,0xdf,0xf5,0xc3,0x0c,0x41,0x78,0xfc,0x6f,0x40,
-0x54,0x51,0x41,0xf7,0x15,0x02,0xf4,0x0c,0x0a,0x20,0x0f,0x70,0x5f,0x00,0x20,0x05,
-0xf1,0x4e,0x08,0x00,0x17,0x0b,0x11,0x7f,0x39,0x00,0x51,0x0f,0xc6,0x66,0x6e,0xb0,
-0x61,0x08,0x40,0x7e,0xff,0xff,0xc2,0x03,0x31,0x20,0x18,0x10,0xfc,0x35,0x20,0x0c,
-0xc0,0x0e,0x0f,0x10,0xdc,0x83,0x25,0x20,0x06,0xf1,0x9e,0x5f,0xf0,0x04,0x05,0xbb,
-0x55,0x6e,0x75,0x6f,0xb5,0x10,0x02,0xfe,0xdd,0xde,0xfe,0xdd,0xde,0xf4,0x00,0x2f,
-0x30,0x66,0x40,0x70,0x1f,0x40,0x02,0xf6,0x22,0x26,0xf4,0xb5,0x0b,0x13,0x2f,0x8e,
-0x1d,0x50,0x02,0xf3,0x00,0x04,0xf2,0xbf,0x02,0xa5,0x2f,0x62,0x22,0x6f,0x42,0x22,
-0x4f,0x40,0x02,0xff,0x9e,0x0b,0x02,0x7c,0x45,0x94,0x33,0x33,0x33,0x37,0xf5,0x33,
-0x33,0x33,0x3e,0xe0,0x09,0x05,0xae,0x48,0x07,0x9e,0x45,0x05,0x4c,0x1e,0x27,0x03,
-0xe3,0xdc,0x17,0x07,0x09,0x00,0x14,0x06,0xbe,0x1d,0x12,0x03,0xe1,0x1e,0x1e,0x64,
-0x24,0x00,0x06,0x09,0x00,0x05,0x05,0x0c,0x10,0x67,0x70,0x6d,0x00,0xd7,0x20,0x01,
-0x05,0x2b,0x14,0x05,0xc4,0x0d,0x11,0x3f,0x47,0x1f,0x04,0xb3,0x2f,0x23,0x0b,0xd1,
-0x70,0x37,0x72,0x9f,0x31,0x23,0x45,0x78,0x9f,0xd0,0xcb,0x3a,0x86,0xec,0xba,0xf8,
-0x00,0x03,0x97,0x64,0x31,0xda,0x51,0x0b,0x77,0x2a,0xf1,0x06,0x01,0x23,0x46,0x89,
-0xce,0xf6,0x00,0x1c,0xde,0xff,0xff,0xfe,0xca,0x86,0x30,0x00,0x06,0x7a,0x32,0x14,
-0xb0,0x80,0x22,0x40,0x3f,0x40,0x01,0xf5,0xa0,0x14,0x00,0x74,0x04,0x10,0xc9,0xfa,
-0x31,0x95,0x14,0x49,0xc4,0x44,0x98,0x44,0xbe,0x44,0x40,0xd3,0x10,0x13,0x6e,0x8f,
-0x09,0x06,0x09,0x00,0x12,0x38,0x5f,0x0c,0xa2,0x44,0x80,0x00,0x05,0xf9,0x44,0x44,
-0x44,0xde,0x10,0x57,0x0a,0x23,0x09,0xf4,0x8a,0x3f,0x22,0xaf,0x60,0x6a,0x0a,0x22,
-0xbd,0xe4,0x31,0x04,0x31,0x6d,0xff,0xc5,0xdf,0x29,0xa0,0xbf,0xe9,0x35,0xbf,0xfa,
-0x63,0x00,0x7f,0xfd,0xa5,0x94,0x46,0x20,0xff,0xe1,0x1f,0x39,0x04,0x06,0x2a,0x3a,
-0x01,0xd4,0x00,0xd6,0x40,0x03,0x36,0x15,0x50,0x03,0x55,0x55,0x5e,0xc5,0xce,0x06,
-0x17,0x08,0xce,0x20,0x25,0xad,0x00,0x49,0x47,0x0a,0x6c,0x41,0x31,0x00,0x4f,0xa4,
-0xdb,0x6b,0x00,0xe3,0x5c,0x02,0xb9,0x16,0x31,0x0c,0xed,0xa0,0x96,0x05,0x32,0x01,
-0xbf,0x3b,0x09,0x00,0x32,0x0d,0xf4,0x0b,0x09,0x00,0x43,0x05,0x20,0x0b,0xa0,0x66,
-0x4a,0x06,0x09,0x00,0x03,0x36,0x00,0x83,0x00,0x0b,0xc6,0x66,0x66,0x66,0x6d,0x70,
-0x69,0x12,0x03,0x2d,0x41,0x00,0xd4,0x2f,0x10,0x9d,0xf1,0x14,0x21,0x5f,0x30,0x65,
-0x59,0x01,0xc3,0x01,0x10,0x9d,0x71,0x00,0x26,0x7f,0x30,0x22,0x00,0x08,0x41,0x27,
-0x00,0xf1,0x16,0x14,0xef,0x61,0x36,0x03,0x0c,0x4a,0x07,0x1a,0x4c,0x13,0xef,0x33,
-0x00,0x10,0x15,0x29,0x00,0x1c,0xaf,0xcc,0x00,0x02,0x08,0x12,0x42,0x34,0x44,0x9f,
-0x30,0x56,0x02,0x2f,0xfe,0x70,0x0f,0x13,0x05,0x24,0xbb,0x00,0x8b,0x10,0x14,0xb0,
-0x09,0x00,0x04,0x96,0x2e,0x42,0xaf,0x60,0x3e,0xc2,0xb3,0x46,0x40,0x50,0x00,0x2c,
-0xf7,0xc9,0x32,0x00,0xae,0x41,0x61,0x08,0xfe,0x70,0x00,0xaf,0xfb,0x56,0x0b,0x41,
-0xcf,0xe1,0x08,0xa1,0x80,0x00,0x28,0x10,0x57,0x53,0x00,0x05,0x2c,0x61,0x12,0x3f,
-0xbd,0x00,0x00,0x27,0x54,0x00,0x0b,0x01,0x22,0xf7,0x00,0xad,0x20,0x01,0xd2,0x3b,
-0x02,0xf3,0x0b,0x0a,0x13,0x00,0x02,0x81,0x0d,0x00,0x13,0x00,0x65,0x75,0x55,0x55,
-0x55,0x5e,0x60,0x9d,0x10,0x21,0x44,0xf7,0x24,0x0e,0x23,0x67,0xf4,0x8f,0x0d,0x31,
-0x1f,0x44,0xf1,0x24,0x01,0x50,0x21,0xf4,0x4f,0x11,0xdd,0x51,0x16,0x33,0x1f,0x44,
-0xf1,0x61,0x06,0x30,0x4f,0x10,0x03,0x8f,0x19,0x40,0x1f,0x44,0xf1,0x01,0x4d,0x00,
-0x00,0x11,0x00,0x50,0x1f,0x20,0x00,0x0d,0x70,0x11,0x00,0x49,0xf2,0x00,0x00,0xd7,
-0x11,0x00,0x41,0xf7,0x55,0x55,0xe7,0x11,0x00,0x43,0xdd,0xdd,0xdd,0x60,0x22,0x00,
-0x01,0x44,0x00,0x10,0x02,0xf4,0x0d,0x32,0x7f,0x44,0xf1,0xcf,0x5c,0x10,0xa0,0x9c,
-0x02,0x03,0xbc,0x15,0x04,0xf4,0x3d,0x12,0x05,0x1e,0x31,0x20,0x00,0x08,0xc7,0x02,
-0x12,0x8f,0x21,0x01,0x00,0x22,0x12,0x50,0x4f,0xd3,0x58,0x00,0x00,0x75,0x2b,0x61,
-0x50,0x06,0xfc,0x10,0x4e,0xd1,0x40,0x01,0x33,0xee,0x9f,0xb0,0x63,0x25,0x02,0x62,
-0x55,0x83,0x8e,0xff,0x75,0x55,0x55,0x50,0x03,0x8c,0xa1,0x37,0x30,0xbe,0xa7,0xf3,
-0x51,0x00,0x13,0xf1,0x92,0x0f,0x00,0xea,0x2f,0x0d,0x11,0x00,0x13,0xff,0xed,0x3c,
-0x10,0x2f,0x1a,0x01,0x27,0x9f,0x10,0x2f,0x38,0x29,0x01,0xfa,0x4c,0x4b,0x84,0x66,
-0x66,0x6d,0xe6,0x66,0x66,0x66,0x61,0xc7,0x0f,0x23,0x20,0xf5,0xa1,0x22,0x03,0x83,
-0x0f,0x40,0x3f,0x20,0xf5,0x02,0xb1,0x61,0x00,0x11,0x00,0x50,0x2f,0x65,0x55,0x6f,
-0x20,0x11,0x00,0x32,0xf1,0x00,0x01,0x11,0x00,0x3a,0x10,0x00,0x1f,0x11,0x00,0x00,
-0x42,0x00,0x00,0x11,0x00,0x40,0xf6,0x44,0x44,0x40,0x11,0x00,0x22,0x1a,0x10,0x44,
-0x00,0x01,0xcf,0x57,0x12,0x69,0x86,0x18,0x20,0x07,0xff,0x56,0x4e,0x03,0x38,0x0e,
-0x01,0xaa,0x19,0x23,0xaf,0xb5,0x2e,0x64,0x15,0x5f,0x55,0x38,0x31,0xf6,0x29,0x20,
-0x37,0x01,0x50,0xee,0x5f,0x64,0xcf,0xa2,0x9d,0x32,0xa0,0xfa,0x10,0xf6,0x00,0x4c,
-0xf9,0x10,0x08,0xef,0xb3,0x88,0x08,0x51,0x06,0xfe,0x10,0x5a,0x20,0x9d,0x12,0x02,
-0x4a,0x55,0x22,0x0a,0x40,0xfe,0x11,0x04,0xba,0x1f,0x11,0x05,0x2d,0x48,0x14,0xbf,
-0x5d,0x52,0x00,0x07,0x03,0x02,0x6a,0x55,0x19,0x8f,0x13,0x00,0x11,0xff,0x9c,0x29,
-0x00,0x13,0x00,0x00,0x2f,0x00,0x2b,0x5a,0xe0,0xf8,0x34,0x15,0xe8,0x06,0x14,0x13,
-0xc1,0x06,0x04,0x33,0xde,0x3c,0xd2,0x7e,0x2c,0x32,0x20,0x0b,0xf6,0xf7,0x54,0xf1,
-0x0c,0x2d,0x70,0x08,0xfd,0x50,0x00,0x06,0xcf,0xc4,0x00,0x4e,0xc1,0x03,0xbf,0xe8,
-0x10,0xbc,0x40,0x00,0x00,0x19,0x10,0x00,0x4a,0xb0,0x00,0x04,0x8e,0x00,0x22,0xb0,
-0x00,0x76,0x03,0x3a,0x5c,0xf4,0x00,0x13,0x02,0x03,0x04,0x33,0x15,0x07,0x32,0x38,
-0x20,0x7f,0x44,0x67,0x13,0x02,0x1a,0x20,0x03,0xe9,0x2a,0x14,0x7e,0x9e,0x4e,0x11,
-0x07,0x9c,0x2b,0x05,0x26,0x00,0x10,0x4e,0xb7,0x38,0x13,0x91,0x8e,0x03,0x10,0xbd,
-0xc7,0x09,0x00,0x68,0x01,0x30,0x92,0x22,0xcc,0x4a,0x03,0x13,0x0a,0x0f,0x68,0x80,
-0x05,0xf6,0x11,0x11,0xcc,0x11,0x11,0x11,0x20,0x37,0x01,0x22,0x00,0x13,0x06,0xc1,
-0x03,0x14,0x0a,0xe1,0x04,0x16,0x45,0xc0,0x12,0x27,0x00,0x00,0x42,0x01,0x00,0x43,
-0x6f,0x00,0x42,0x03,0x13,0xdb,0x2d,0x01,0x23,0x0b,0xb0,0x3f,0x01,0x17,0xbb,0x11,
-0x00,0x13,0xff,0xd3,0x02,0x20,0x5f,0x65,0xde,0x00,0x00,0x8a,0x42,0x03,0x7e,0x04,
-0xb2,0x01,0xf8,0x55,0x55,0xd8,0x55,0x55,0xf7,0x00,0x1f,0x30,0x3b,0x1e,0xb0,0x01,
-0xf3,0x4d,0xdd,0xfe,0xdd,0xc0,0xe7,0x00,0x1f,0x31,0x56,0x0f,0x30,0x0e,0x70,0x02,
-0x1e,0x0a,0x00,0x2f,0x0d,0x20,0x2f,0x3c,0x8f,0x0d,0x40,0x4e,0x70,0x02,0xf3,0x14,
-0x29,0x21,0x41,0xe7,0xde,0x03,0x00,0xc5,0x0d,0x30,0x05,0xf0,0x0d,0xd4,0x0c,0xd0,
-0xe7,0x00,0x7e,0x00,0xe7,0x22,0x22,0xe6,0x0e,0x70,0x0b,0xb0,0x0e,0xff,0x1a,0xd1,
-0xe7,0x00,0xf7,0x00,0xe7,0x11,0x11,0xe6,0x0e,0x70,0x6f,0x20,0x0e,0x22,0x00,0x20,
-0x0e,0xb0,0x2e,0x09,0x42,0x45,0x5f,0x61,0xd2,0x34,0x03,0x16,0xc1,0xc0,0x01,0x40,
-0x11,0x11,0x10,0x01,0x00,0x01,0x00,0x0d,0x01,0xf3,0x29,0xef,0xff,0xff,0xf4,0x2f,
-0x30,0x00,0xb8,0x0e,0x70,0x00,0x2f,0x42,0xf4,0x11,0x1c,0x80,0xe8,0x11,0x13,0xf4,
-0x2f,0xee,0xee,0xf8,0x0e,0xfe,0xee,0xef,0x42,0xf2,0x00,0x0b,0x80,0xe7,0x00,0x01,
-0xf4,0x2f,0xdc,0xcc,0xf8,0x0e,0xec,0xcc,0xcf,0x42,0xf7,0x55,0x55,0x20,0x45,0x55,
-0x56,0xf4,0x2f,0x0a,0x12,0x30,0x42,0xf2,0x01,0xf6,0x14,0x81,0x01,0xf4,0x2f,0x20,
-0x1f,0x63,0x33,0xac,0x11,0x00,0x32,0xf2,0x00,0x08,0x11,0x00,0x31,0x20,0x00,0x8c,
-0x11,0x00,0x32,0xf6,0x33,0x3a,0x11,0x00,0x00,0x3b,0x0b,0x00,0x11,0x00,0x81,0xb2,
-0x00,0x00,0x37,0x68,0xf3,0x2f,0x20,0xb4,0x3e,0x07,0xd9,0x0f,0x00,0xc3,0x05,0x21,
-0xf5,0x09,0x99,0x17,0xe0,0x9b,0x22,0x2f,0x50,0x9c,0x22,0x2d,0x90,0x00,0x09,0xa0,
-0x00,0xf5,0x09,0x1b,0x07,0x01,0x13,0x00,0x11,0x9b,0x13,0x00,0x32,0xff,0xff,0xf6,
-0x26,0x00,0x00,0x0c,0x0c,0x33,0x02,0xd7,0x10,0x37,0x09,0x22,0x04,0xcc,0xd1,0x55,
-0x02,0x39,0x08,0xf0,0x02,0x33,0x34,0xdf,0x53,0x33,0x9f,0x93,0x33,0x30,0x00,0x03,
-0xde,0x30,0x00,0x00,0x8f,0xb2,0x23,0x50,0xf1,0x08,0x64,0x42,0x03,0x44,0x8f,0xfb,
-0x60,0x1f,0xef,0xff,0xff,0x80,0xaf,0xff,0xff,0xdc,0x00,0x14,0xf0,0x00,0xc8,0x0a,
-0x90,0xa6,0x13,0x40,0x00,0x0c,0x80,0xa9,0x99,0x01,0x81,0x04,0xf4,0x33,0xd8,0x0a,
-0xb3,0x33,0xf5,0x3a,0x62,0x20,0x70,0xaf,0x54,0x80,0x13,0x01,0xee,0x18,0x04,0xa7,
-0x0c,0x31,0xf6,0x5f,0x54,0xac,0x2a,0x42,0x5f,0x65,0xf0,0x00,0x5b,0x1e,0x13,0x5f,
-0x92,0x3f,0x30,0x65,0xf0,0x03,0x63,0x04,0x00,0x11,0x00,0x70,0x3f,0x64,0x44,0x7f,
-0x10,0x1f,0x65,0x9d,0x26,0x12,0x04,0x11,0x00,0x3a,0x20,0x00,0x4f,0x11,0x00,0x48,
-0x42,0x22,0x6f,0x10,0x33,0x00,0x10,0x01,0xeb,0x06,0x1e,0x1f,0x55,0x00,0x05,0x77,
-0x00,0x11,0x65,0x98,0x02,0x15,0x6f,0x39,0x0a,0x0f,0x91,0x00,0x01,0x10,0x1b,0xf7,
-0x03,0x50,0xf6,0x5f,0x00,0x02,0xf1,0x3c,0x1b,0xb1,0x65,0xf0,0x23,0x5f,0x43,0x3e,
-0x83,0x30,0xf6,0x5f,0x0a,0xdc,0x02,0x88,0x0f,0x65,0xf0,0x00,0x2f,0x10,0x0d,0x60,
-0x22,0x00,0xe0,0xde,0xff,0xfe,0xef,0xfe,0xe0,0xf6,0x5f,0x03,0x3a,0xd3,0x33,0xe8,
-0x33,0x22,0x00,0x22,0xe7,0x00,0x22,0x00,0x22,0x8f,0x10,0x22,0x00,0x23,0x6f,0x50,
-0x11,0x00,0x10,0x20,0x73,0x4e,0x32,0x0f,0x65,0xfe,0xae,0x2e,0x0e,0x91,0x00,0x14,
-0x03,0x91,0x00,0x22,0x3f,0x64,0x91,0x00,0x10,0x63,0x53,0x4a,0x70,0x30,0x00,0x00,
-0xf6,0x3f,0x20,0x00,0x0c,0x0b,0x40,0x0f,0x63,0xf2,0x7e,0xfa,0x4b,0xb1,0xd0,0xf6,
-0x3f,0x22,0x33,0x34,0xf7,0x33,0x33,0x0f,0x63,0x3d,0x0e,0x01,0x22,0x00,0x90,0x02,
-0x23,0xf6,0x22,0x10,0x0f,0x63,0xf2,0x04,0x43,0x03,0x00,0x11,0x00,0x50,0x4f,0x00,
-0x00,0x09,0xb0,0x11,0x00,0x10,0xf0,0x7c,0x50,0x00,0x11,0x00,0x30,0x44,0x44,0x4b,
-0x11,0x00,0x52,0x03,0xcc,0xcc,0xcc,0xc9,0x55,0x00,0x10,0x00,0x55,0x00,0x04,0x91,
-0x00,0x21,0x3f,0x76,0xe4,0x06,0x06,0x91,0x00,0x14,0x04,0x92,0x14,0x12,0x4f,0x22,
-0x01,0x41,0x4f,0x74,0xf1,0x01,0xd6,0x12,0x31,0xf7,0x4f,0x12,0x62,0x04,0xc2,0x0f,
+0x54,0xf7,0x66,0x66,0xf6,0x11,0x00,0x41,0x4f,0x10,0x00,0x0e,0x11,0x00,0x32,0xf5,
+0x44,0x44,0x11,0x00,0x31,0xff,0xff,0xff,0x11,0x00,0x41,0xf1,0x00,0x00,0xe6,0x11,
+0x00,0x31,0x54,0x44,0x4f,0x11,0x00,0x63,0xff,0xff,0xff,0xf6,0x04,0xc0,0x33,0x00,
+0x13,0x00,0x22,0x00,0x20,0x00,0x00,0x11,0x00,0xf2,0x00,0x15,0x5f,0x60,0x01,0x44,
+0x6f,0x44,0xf1,0x00,0xee,0xc1,0x00,0x2f,0xff,0xc0,0x9d,0x00,0x18,0x11,0xdb,0x01,
+0x10,0x9a,0x9b,0x03,0xb1,0xb0,0x00,0x00,0x04,0xf7,0x00,0x00,0x02,0xf8,0x00,0x00,
+0x4c,0x01,0x14,0xbd,0xb9,0x04,0x43,0xff,0xff,0xe5,0x55,0x01,0x00,0x03,0x30,0x00,
+0xf1,0x10,0x33,0x00,0xbe,0xee,0xee,0xe2,0x06,0x90,0x0b,0xa0,0x0b,0xb4,0x44,0x6f,
+0x20,0x8c,0x00,0xba,0x00,0xb9,0x00,0x02,0xf2,0x08,0xc0,0x0b,0xa0,0x0b,0xfd,0xdd,
+0xdf,0x11,0x00,0x32,0xbb,0x44,0x46,0x11,0x00,0x31,0x90,0x00,0x2f,0x11,0x00,0x32,
+0xbf,0xdd,0xdd,0x11,0x00,0x08,0x33,0x00,0x20,0x00,0x00,0x22,0x00,0xf7,0x00,0x23,
+0x6f,0x20,0x02,0x54,0xda,0x00,0xb9,0x05,0xff,0xa0,0x00,0x4f,0xfd,0x40,0x9a,0x00,
+0x10,0xa8,0x05,0x00,0x50,0x0c,0x31,0x11,0x18,0xf2,0xb6,0x03,0x11,0xf4,0x91,0x00,
+0xf1,0x1c,0x51,0x40,0x0f,0x4e,0x50,0x02,0x60,0x00,0xf5,0x5e,0x00,0xf4,0xb6,0x22,
+0x6e,0x22,0x2c,0x35,0xe0,0x0f,0x40,0xce,0xef,0xfe,0xee,0x30,0x5e,0x00,0xf4,0x00,
+0x00,0x6e,0x00,0x00,0x05,0xe0,0x0f,0x40,0x6f,0xff,0xff,0xfb,0x00,0x11,0x00,0x11,
+0x5e,0x11,0x00,0x10,0x4d,0x3b,0x00,0x90,0xf2,0x5e,0x00,0xf4,0x11,0x11,0x6e,0x11,
+0x11,0x22,0x00,0x40,0x23,0x37,0xf3,0x33,0x22,0x00,0x10,0x0c,0x19,0x00,0xf9,0x16,
+0x05,0xd0,0x0f,0x40,0xc7,0x00,0x00,0x1f,0x20,0x00,0x00,0xf4,0x0c,0x60,0x00,0x00,
+0xf2,0x00,0x00,0x0f,0x40,0xce,0xdd,0xdd,0xdf,0x20,0x04,0x57,0xf4,0x0c,0x93,0x33,
+0x34,0xd2,0x00,0x7f,0xea,0x0f,0x03,0x13,0xf4,0x09,0x00,0x2f,0x2f,0x40,0x11,0x00,
+0x01,0x13,0x05,0x3b,0x01,0xa2,0xf2,0x27,0x77,0x77,0x9f,0x87,0x77,0x77,0xaf,0x10,
+0xbc,0x04,0x01,0xc0,0x04,0x00,0x02,0x06,0x10,0x7f,0x30,0x05,0x11,0xb0,0x6f,0x04,
+0x70,0x00,0x03,0xf6,0x00,0x00,0x00,0x9d,0x40,0x02,0x11,0x00,0x2a,0x04,0x20,0x00,
+0x2f,0x7a,0x03,0x70,0xca,0x00,0x00,0x0b,0xf1,0x00,0x00,0xb1,0x03,0x20,0x09,0xf6,
+0x4a,0x02,0x40,0xf6,0x00,0x0a,0xf8,0x61,0x00,0xc0,0x5f,0x30,0x2d,0xf7,0x00,0x00,
+0x04,0x66,0x7e,0xd0,0x08,0xe4,0x8c,0x06,0x2b,0xff,0xd3,0x48,0x04,0x05,0xf1,0x04,
+0x81,0x0a,0xb0,0x00,0x00,0x07,0x77,0x77,0x77,0x55,0x00,0x90,0x0d,0xde,0xfe,0xdd,
+0x00,0x0b,0xa0,0x00,0x00,0x27,0x04,0x50,0x66,0x6d,0xd6,0x66,0x65,0x09,0x00,0x00,
+0x53,0x01,0x11,0xfc,0x39,0x04,0x41,0x0d,0x80,0x00,0xab,0x09,0x00,0x41,0x0f,0x60,
+0x00,0xba,0x09,0x00,0x41,0x1f,0x40,0x00,0xc9,0x09,0x00,0xf2,0x16,0x5f,0x20,0x00,
+0xd9,0x00,0x02,0xf3,0x15,0x20,0xad,0x00,0x00,0xe8,0x00,0x05,0xfd,0xff,0x40,0xe8,
+0x00,0x00,0xf7,0x1c,0xff,0xd9,0x40,0x07,0xf3,0x00,0x00,0xf5,0x09,0x61,0x00,0x00,
+0x2f,0x90,0x02,0x01,0x31,0x02,0xde,0x00,0x39,0x06,0x60,0x00,0x5e,0xe3,0x00,0x76,
+0x6d,0x28,0x06,0x67,0xbc,0x20,0x00,0xdf,0xfd,0x30,0x9f,0x00,0x13,0xd4,0x08,0x00,
+0x23,0x01,0xf5,0x09,0x00,0x00,0xd9,0x03,0xe0,0x17,0x77,0x77,0x72,0x05,0x67,0xf9,
+0x66,0x62,0x3f,0xed,0xde,0xf4,0x0b,0xdb,0x04,0x41,0x3f,0x20,0x02,0xf4,0x2c,0x04,
+0x01,0x09,0x00,0x41,0x04,0xf1,0x02,0xf3,0x09,0x00,0x32,0x05,0xf0,0x03,0x09,0x00,
+0x41,0x06,0xf0,0x04,0xf2,0x09,0x00,0x41,0x09,0xc0,0x05,0xf1,0x09,0x00,0x41,0x0c,
+0x90,0x06,0xf0,0x09,0x00,0x41,0x0e,0x70,0x07,0xe0,0x09,0x00,0x41,0x4f,0x20,0x09,
+0xd0,0x09,0x00,0x40,0x9d,0x00,0x0b,0xb0,0x09,0x00,0xf1,0x08,0x01,0xe8,0x00,0x0e,
+0x90,0x3f,0x86,0x68,0xf4,0x09,0xf1,0x56,0xaf,0x40,0x3f,0xff,0xff,0xf4,0x0e,0x60,
+0x7f,0xe9,0x00,0x1b,0x00,0x01,0xc6,0x01,0x01,0x91,0x00,0x71,0x76,0x00,0x00,0x00,
+0x28,0x00,0x00,0xfb,0x06,0x21,0x00,0x5f,0xdb,0x06,0x11,0x50,0x09,0x00,0x10,0x0a,
+0xd4,0x01,0x00,0x52,0x02,0xf0,0x0c,0x02,0x34,0x43,0x34,0x33,0x45,0x9f,0x55,0x53,
+0x00,0x0c,0x80,0x0e,0x40,0xaf,0xff,0xff,0xfa,0x00,0x6f,0x10,0x07,0xe1,0x00,0x7d,
+0x00,0xa9,0xce,0x01,0xf0,0x18,0xbb,0x00,0x9b,0x00,0xb9,0x0b,0x92,0x00,0x4f,0x3e,
+0x20,0xaa,0x00,0xb8,0x01,0x0a,0xc0,0xaa,0x00,0x00,0xc8,0x00,0xc7,0x00,0x00,0xcc,
+0xf4,0x00,0x00,0xf4,0x00,0xd7,0x00,0x00,0x1e,0xf0,0x00,0x04,0xf0,0xa3,0x03,0x21,
+0x5f,0xf9,0x9c,0x05,0xf7,0x15,0x00,0x03,0xf7,0x3f,0x60,0x2f,0x40,0x00,0xf4,0x00,
+0x3e,0xa0,0x07,0x50,0xbd,0x00,0x03,0xf2,0x07,0xf9,0x00,0x00,0x0b,0xf3,0x14,0x4a,
+0xe0,0x08,0x60,0x00,0x00,0x3e,0x40,0x0f,0xfe,0x60,0x44,0x01,0xf1,0x40,0x12,0x46,
+0x94,0x00,0x58,0x00,0x00,0x0b,0xef,0xff,0xda,0x84,0x00,0x8c,0x00,0x00,0x01,0x10,
+0x0f,0x30,0x00,0x00,0x9c,0x00,0x00,0x1e,0xee,0xef,0xee,0xee,0x40,0x9c,0x00,0x00,
+0x03,0x33,0x3f,0x63,0x33,0xba,0xde,0xaa,0xa7,0x01,0x22,0x3f,0x52,0x22,0xef,0xff,
+0xff,0xfa,0x09,0xec,0xdf,0xdc,0xdd,0x00,0xba,0x00,0xba,0x09,0x90,0x0f,0x30,0x4d,
+0x00,0xc8,0x00,0xb9,0x09,0xfe,0xef,0xfe,0xfd,0x00,0xf7,0x00,0xc9,0x12,0x00,0xf0,
+0x17,0x01,0xf5,0x00,0xc8,0x09,0xec,0xcf,0xdc,0xdd,0x03,0xf1,0x00,0xd7,0x01,0x11,
+0x2f,0x51,0x11,0x08,0xd0,0x00,0xe7,0x07,0xcc,0xcf,0xdc,0xcb,0x0d,0x90,0x00,0xf6,
+0x02,0x44,0x5f,0x74,0x44,0x7f,0x20,0x53,0x03,0xf9,0x08,0x2f,0x76,0x89,0xf9,0x00,
+0x03,0xf3,0x0d,0xff,0xfe,0xca,0xbf,0xc1,0x15,0x4b,0xe0,0x05,0x31,0x00,0x00,0x7c,
+0x00,0x0e,0xa2,0x00,0x42,0x04,0xd2,0x01,0xa3,0x0a,0x00,0x14,0xcd,0x24,0x03,0x20,
+0x5f,0x50,0x23,0x02,0x10,0x10,0x29,0x08,0x00,0x13,0x00,0x50,0x3f,0x60,0x00,0x08,
+0xf7,0x36,0x02,0xe0,0x1e,0xe2,0x00,0x04,0xff,0x70,0x00,0x2f,0x40,0x0c,0xf3,0x00,
+0x03,0xed,0x13,0x00,0xf0,0x05,0x0c,0xf5,0x00,0x00,0xee,0x2f,0x70,0x00,0x2f,0x6d,
+0xf5,0x00,0x00,0x06,0x30,0xf7,0x00,0x02,0xff,0xe3,0x42,0x00,0x61,0x0f,0x70,0x00,
+0x8f,0xc1,0x00,0x28,0x08,0x22,0x04,0xdf,0x3f,0x02,0xc0,0x0f,0x78,0xfc,0x6f,0x40,
+0x00,0x01,0x10,0x00,0x00,0xf7,0x15,0x5f,0x00,0x50,0x3f,0x20,0x00,0x0f,0x70,0x5f,
+0x00,0x20,0x05,0xf1,0x4e,0x08,0x20,0x02,0xf5,0x6c,0x03,0x00,0x13,0x00,0x51,0x0f,
+0xc6,0x66,0x6e,0xb0,0x61,0x08,0xf0,0x20,0x7e,0xff,0xff,0xc2,0x00,0x00,0x31,0x00,
+0x18,0x10,0x00,0x04,0x60,0x00,0x0c,0xc0,0x00,0xe9,0x00,0x00,0xdc,0x00,0x00,0x2f,
+0x80,0x06,0xf1,0x00,0x8f,0x20,0x00,0x05,0xbb,0x55,0x6e,0x75,0x6f,0xb5,0x10,0x02,
+0xfe,0xdd,0xde,0xfe,0xdd,0xde,0xf4,0x10,0x08,0xf2,0x00,0x4f,0x20,0x00,0x1f,0x40,
+0x02,0xf6,0x22,0x26,0xf4,0x22,0x24,0xf4,0x00,0x2f,0xdd,0x03,0x60,0x40,0x02,0xf3,
+0x00,0x04,0xf2,0xbf,0x02,0x92,0x2f,0x62,0x22,0x6f,0x42,0x22,0x4f,0x40,0x02,0x19,
+0x00,0x11,0xf4,0x24,0x0a,0x10,0x20,0x2b,0x05,0x84,0x33,0x33,0x37,0xf5,0x33,0x33,
+0x33,0x3e,0xe0,0x09,0x00,0x1a,0x01,0x13,0xf3,0x23,0x01,0x23,0x4f,0x20,0x2b,0x01,
+0x13,0xf2,0x11,0x00,0x24,0x03,0xe3,0x09,0x00,0x19,0xf3,0x09,0x00,0x12,0x06,0x3c,
+0x00,0xae,0xf9,0x00,0x03,0x66,0x66,0x69,0xf8,0x66,0x66,0x64,0x24,0x00,0x06,0x09,
+0x00,0x04,0xb6,0x05,0xf2,0x01,0xf0,0x67,0x77,0x78,0xfc,0x77,0x77,0x77,0x77,0x70,
+0x00,0x00,0x0a,0xf2,0x00,0x05,0x73,0x00,0x52,0x60,0x00,0x3f,0x80,0x00,0x9e,0x09,
+0x20,0x06,0xf5,0x6f,0x04,0x10,0xd1,0x78,0x04,0xb1,0x30,0x00,0x00,0x9f,0x31,0x23,
+0x45,0x78,0x9f,0xd0,0x00,0xf2,0x0a,0x83,0xec,0xba,0xf8,0x00,0x03,0x97,0x64,0x31,
+0x98,0x04,0x0a,0x01,0x00,0x01,0x8c,0x09,0xf0,0x08,0x23,0x46,0x89,0xce,0xf6,0x00,
+0x1c,0xde,0xff,0xff,0xfe,0xca,0x86,0x30,0x00,0x06,0x7a,0x32,0x14,0xb0,0x00,0x02,
+0xb2,0xb8,0x09,0x51,0x01,0xf5,0x00,0x0a,0xd0,0xc9,0x04,0xd0,0xc9,0x00,0x2f,0x50,
+0x00,0x14,0x49,0xc4,0x44,0x98,0x44,0xbe,0x44,0x93,0x05,0x02,0x0a,0x0b,0x13,0x6e,
+0x8f,0x09,0x06,0x09,0x00,0x21,0x38,0x0f,0x1a,0x00,0xa2,0x44,0x80,0x00,0x05,0xf9,
+0x44,0x44,0x44,0xde,0x10,0x57,0x0a,0x10,0x09,0x49,0x01,0x00,0xfe,0x04,0x22,0xaf,
+0x60,0x6a,0x0a,0x22,0xbd,0xe4,0x31,0x04,0x30,0x6d,0xff,0xc5,0x07,0x00,0xf2,0x04,
+0x47,0xbf,0xe9,0x35,0xbf,0xfa,0x63,0x00,0x7f,0xfd,0xa5,0x00,0x00,0x02,0x8c,0xff,
+0xe1,0x04,0x10,0x09,0x01,0x10,0x30,0x1e,0x00,0x04,0x68,0x04,0x14,0x06,0x5f,0x01,
+0x00,0x96,0x00,0x00,0x49,0x0b,0x30,0x55,0x5e,0xc5,0xce,0x06,0x13,0x08,0x90,0x00,
+0x00,0xb7,0x0b,0x14,0xad,0xd7,0x05,0x19,0xf5,0x2c,0x00,0x00,0x32,0x01,0x82,0xa4,
+0x44,0x44,0x44,0x44,0x20,0x00,0x01,0x58,0x01,0x51,0x80,0x00,0x0c,0xed,0xa0,0x96,
+0x05,0x32,0x01,0xbf,0x3b,0x09,0x00,0x32,0x0d,0xf4,0x0b,0x09,0x00,0x23,0x05,0x20,
+0x09,0x00,0x26,0x00,0x00,0x09,0x00,0x03,0x36,0x00,0xa1,0x00,0x0b,0xc6,0x66,0x66,
+0x66,0x6d,0x70,0x00,0x11,0x01,0x00,0x33,0x00,0x00,0x09,0xef,0x0b,0xb3,0x00,0x9d,
+0x22,0x22,0x22,0x22,0x5f,0x30,0x00,0x09,0xc0,0xc3,0x01,0x10,0x9d,0x71,0x00,0x26,
+0x7f,0x30,0x22,0x00,0x03,0x01,0x00,0x13,0x05,0x86,0x07,0x14,0x52,0xe2,0x01,0x10,
+0x70,0x63,0x0a,0x11,0x00,0x59,0x0b,0x13,0xf0,0x24,0x00,0x13,0xef,0x33,0x00,0x10,
+0x15,0x29,0x00,0x1c,0xaf,0xcc,0x00,0x11,0xe9,0x06,0x00,0x42,0x34,0x44,0x9f,0x30,
+0x56,0x02,0x3f,0xfe,0x70,0x00,0x01,0x00,0x04,0x14,0xbb,0x09,0x00,0x24,0x8f,0xb0,
+0x09,0x00,0x13,0x9f,0x0f,0x0a,0x41,0xaf,0x60,0x3e,0xc2,0x48,0x01,0xf1,0x04,0xdf,
+0x50,0x00,0x2c,0xf7,0x00,0x00,0x00,0x29,0xfd,0x20,0x00,0x00,0x08,0xfe,0x70,0x00,
+0xaf,0xfb,0x56,0x0b,0x41,0xcf,0xe1,0x08,0xa1,0x80,0x00,0x28,0x10,0x57,0x53,0x00,
+0x10,0x22,0x01,0x00,0x10,0x21,0xda,0x0b,0x03,0xbd,0x00,0x30,0x00,0x03,0xf4,0x0b,
+0x01,0x21,0xf7,0x00,0xb5,0x03,0x01,0xa4,0x03,0x03,0xf3,0x0b,0x0a,0x13,0x00,0x02,
+0x81,0x0d,0x00,0x13,0x00,0x83,0x75,0x55,0x55,0x55,0x5e,0x60,0x00,0x4f,0x00,0x01,
+0x30,0x44,0xf7,0x66,0x01,0x00,0x23,0x67,0xf4,0x8f,0x0d,0x31,0x1f,0x44,0xf1,0x24,
+0x01,0xc3,0x21,0xf4,0x4f,0x11,0xdd,0xdd,0xdd,0xdd,0xd6,0x1f,0x44,0xf1,0x61,0x06,
+0xb0,0x4f,0x10,0x03,0x33,0x33,0x33,0x10,0x1f,0x44,0xf1,0x01,0x4d,0x00,0x00,0x11,
+0x00,0x50,0x1f,0x20,0x00,0x0d,0x70,0x11,0x00,0x49,0xf2,0x00,0x00,0xd7,0x11,0x00,
+0x41,0xf7,0x55,0x55,0xe7,0x11,0x00,0x43,0xdd,0xdd,0xdd,0x60,0x22,0x00,0x01,0x44,
+0x00,0x10,0x02,0xf4,0x0d,0x12,0x7f,0x55,0x00,0x30,0x0a,0xfe,0xa0,0x9c,0x02,0x13,
+0xc1,0x9c,0x01,0x00,0xa0,0x00,0x04,0xf8,0x07,0x40,0xfb,0x00,0x00,0x08,0xc7,0x02,
+0x13,0x8f,0x21,0x01,0xf1,0x03,0x2f,0xb0,0x00,0x4f,0xd3,0x58,0x00,0x00,0x2e,0xd0,
+0x00,0x00,0x50,0x06,0xfc,0x10,0x4e,0xd1,0x40,0x01,0x32,0xee,0x9f,0xb0,0xbd,0x01,
+0x21,0xff,0x70,0xa5,0x00,0x82,0x8e,0xff,0x75,0x55,0x55,0x50,0x03,0x8c,0xdd,0x00,
+0x60,0x10,0xbe,0xa7,0xf3,0x00,0x00,0xc6,0x04,0x00,0x80,0x04,0x01,0x03,0x0d,0x1d,
+0x02,0x11,0x00,0x01,0xd1,0x0d,0x00,0x11,0x00,0x00,0x1a,0x01,0x11,0x9f,0x7b,0x0d,
+0x13,0x80,0x54,0x07,0x13,0xfa,0x77,0x01,0x11,0x7f,0xec,0x01,0x93,0x66,0x66,0x6d,
+0xe6,0x66,0x66,0x66,0x61,0x0f,0x3b,0x01,0x22,0x20,0xf5,0x29,0x03,0x22,0xf2,0x0f,
+0x42,0x02,0x40,0x3f,0x20,0xf5,0x02,0xaf,0x08,0x00,0x11,0x00,0x50,0x2f,0x65,0x55,
+0x6f,0x20,0x11,0x00,0x32,0xf1,0x00,0x01,0x11,0x00,0x3a,0x10,0x00,0x1f,0x11,0x00,
+0x00,0x42,0x00,0x00,0x11,0x00,0x40,0xf6,0x44,0x44,0x40,0x11,0x00,0x22,0x1a,0x10,
+0x44,0x00,0x00,0x4b,0x00,0x31,0x46,0x69,0xf1,0x55,0x00,0x34,0x07,0xff,0xe9,0xb9,
+0x04,0x40,0xff,0xfd,0x00,0x25,0x90,0x02,0x10,0xb5,0x2d,0x0f,0x00,0xbb,0x00,0x04,
+0x55,0x02,0x41,0x9f,0xf6,0x29,0x20,0x37,0x01,0xf0,0x04,0xee,0x5f,0x64,0xcf,0xa2,
+0x00,0x00,0x00,0x5d,0xfa,0x10,0xf6,0x00,0x4c,0xf9,0x10,0x08,0xef,0xb3,0x88,0x08,
+0x60,0x06,0xfe,0x10,0x5a,0x20,0x00,0x97,0x0d,0x21,0x01,0x60,0x75,0x01,0x02,0x49,
+0x06,0x20,0x5e,0xee,0x01,0x00,0x50,0xd0,0x00,0x00,0x05,0xf6,0xf0,0x01,0x10,0xbf,
+0x53,0x00,0x04,0x07,0x03,0x21,0x05,0xf0,0xae,0x02,0x09,0x13,0x00,0x10,0xff,0x2f,
+0x00,0x00,0x7b,0x05,0x80,0x5f,0x55,0x55,0x55,0x55,0x5a,0xe0,0x00,0x18,0x00,0x01,
+0x00,0x24,0x01,0xe8,0x0a,0x00,0x22,0xdf,0xc1,0x08,0x00,0x41,0x02,0xde,0x3c,0xd2,
+0x09,0x00,0x50,0x05,0xfd,0x20,0x0b,0xf6,0x09,0x00,0xf0,0x0f,0x3c,0xfa,0x2d,0x70,
+0x08,0xfd,0x50,0x00,0x06,0xcf,0xc4,0x00,0x4e,0xc1,0x03,0xbf,0xe8,0x10,0xbc,0x40,
+0x00,0x00,0x19,0x10,0x00,0x4a,0xb0,0x00,0x04,0xee,0x01,0x00,0xa3,0xb0,0x00,0x00,
+0x00,0x15,0x55,0x55,0x55,0x5c,0xf4,0x4d,0x00,0x23,0x05,0xf7,0x09,0x00,0x20,0x03,
+0xf9,0x06,0x00,0x20,0x07,0xff,0x01,0x00,0xf0,0x00,0xf8,0x00,0x00,0x00,0x7f,0x44,
+0x44,0x44,0x44,0x4f,0x80,0x00,0x00,0x07,0xe0,0x19,0x00,0x00,0x7e,0x00,0x10,0x7e,
+0x09,0x00,0x10,0x0e,0x13,0x00,0x10,0xfe,0x4c,0x00,0x05,0x26,0x00,0x81,0x4e,0x80,
+0x00,0x00,0x04,0x91,0x00,0xbb,0x48,0x00,0x40,0xbd,0x00,0x0b,0xb0,0x08,0x00,0xa1,
+0x3f,0x92,0x22,0xcc,0x22,0x22,0x21,0x00,0x0a,0xff,0x01,0x00,0xc2,0x80,0x05,0xf6,
+0x11,0x11,0xcc,0x11,0x11,0x11,0x02,0xf9,0x00,0x22,0x00,0x31,0x06,0x00,0x00,0x33,
+0x00,0x03,0x21,0x00,0x42,0xff,0xfe,0x45,0x55,0x01,0x00,0x15,0x50,0xf4,0x00,0x11,
+0x5e,0xb4,0x00,0xe1,0xa0,0x00,0x05,0xf6,0x66,0x66,0x66,0x66,0xdb,0x00,0x00,0x5f,
+0x00,0x00,0x3e,0x00,0x32,0x05,0xf0,0x00,0x3e,0x00,0x05,0x11,0x00,0x01,0x43,0x00,
+0x50,0xfb,0x00,0x00,0x5f,0x65,0xde,0x00,0x42,0xa0,0x00,0x00,0x1f,0x56,0x00,0xf1,
+0x30,0x70,0x01,0xf8,0x55,0x55,0xd8,0x55,0x55,0xf7,0x00,0x1f,0x30,0x00,0x0f,0x50,
+0x00,0x0e,0x70,0x01,0xf3,0x4d,0xdd,0xfe,0xdd,0xc0,0xe7,0x00,0x1f,0x31,0x44,0x4f,
+0x84,0x44,0x0e,0x70,0x02,0xf3,0x00,0x00,0xf5,0x00,0x00,0xe7,0x00,0x2f,0x3c,0xee,
+0xef,0xfe,0xee,0x4e,0x70,0x02,0xf3,0x34,0x44,0x44,0x44,0x41,0xe7,0x00,0x3f,0x20,
+0xf2,0x00,0xf1,0x17,0x70,0x05,0xf0,0x0d,0xff,0xff,0xff,0x60,0xe7,0x00,0x7e,0x00,
+0xe7,0x22,0x22,0xe6,0x0e,0x70,0x0b,0xb0,0x0e,0x60,0x00,0x0e,0x60,0xe7,0x00,0xf7,
+0x00,0xe7,0x11,0x11,0xe6,0x0e,0x70,0x6f,0x20,0x0e,0x22,0x00,0x91,0x0e,0xb0,0x00,
+0xe6,0x00,0x00,0x45,0x5f,0x61,0x9a,0x01,0x36,0x08,0xff,0xc1,0xc0,0x01,0x40,0x11,
+0x11,0x10,0x01,0x00,0x01,0x00,0x0d,0x01,0xf1,0x2a,0xef,0xff,0xff,0xf4,0x2f,0x30,
+0x00,0xb8,0x0e,0x70,0x00,0x2f,0x42,0xf4,0x11,0x1c,0x80,0xe8,0x11,0x13,0xf4,0x2f,
+0xee,0xee,0xf8,0x0e,0xfe,0xee,0xef,0x42,0xf2,0x00,0x0b,0x80,0xe7,0x00,0x01,0xf4,
+0x2f,0xdc,0xcc,0xf8,0x0e,0xec,0xcc,0xcf,0x42,0xf7,0x55,0x55,0x20,0x45,0x55,0x56,
+0xf4,0x2f,0x20,0x4b,0x00,0xf1,0x01,0x1f,0x42,0xf2,0x01,0xff,0xff,0xff,0xc0,0x01,
+0xf4,0x2f,0x20,0x1f,0x63,0x33,0xac,0x11,0x00,0x32,0xf2,0x00,0x08,0x11,0x00,0x31,
+0x20,0x00,0x8c,0x11,0x00,0x32,0xf6,0x33,0x3a,0x11,0x00,0x31,0xff,0xff,0xfc,0x11,
+0x00,0x61,0xb2,0x00,0x00,0x37,0x68,0xf3,0x44,0x00,0x37,0x03,0xff,0xd9,0x5b,0x02,
+0xf2,0x0c,0x09,0xff,0xff,0xf5,0x09,0xff,0xff,0xf9,0x00,0x00,0x9b,0x22,0x2f,0x50,
+0x9c,0x22,0x2d,0x90,0x00,0x09,0xa0,0x00,0xf5,0x09,0xb0,0x00,0xc9,0x13,0x00,0x11,
+0x9b,0x13,0x00,0x31,0xff,0xff,0xf6,0x26,0x00,0x00,0x40,0x00,0x41,0xf6,0x02,0xd7,
+0x10,0x3c,0x00,0x83,0xcd,0x00,0x04,0xcc,0x00,0x00,0x0f,0xff,0x01,0x00,0xf0,0x1e,
+0x00,0x33,0x34,0xdf,0x53,0x33,0x9f,0x93,0x33,0x30,0x00,0x03,0xde,0x30,0x00,0x00,
+0x8f,0xb2,0x00,0x00,0x3a,0xfe,0x64,0x42,0x03,0x44,0x8f,0xfb,0x60,0x1f,0xef,0xff,
+0xff,0x80,0xaf,0xff,0xff,0xdc,0x00,0x14,0xf0,0x00,0xc8,0x0a,0x90,0x76,0x01,0x50,
+0x4f,0x00,0x0c,0x80,0xa9,0x99,0x01,0x70,0x04,0xf4,0x33,0xd8,0x0a,0xb3,0x33,0x13,
+0x00,0x70,0xff,0xfe,0x70,0xaf,0xff,0xfe,0x40,0x33,0x01,0x01,0x01,0x00,0x13,0x05,
+0x5d,0x00,0x40,0xf6,0x5f,0x54,0x44,0x01,0x00,0x32,0x5f,0x65,0xf0,0x53,0x01,0x32,
+0xf6,0x5f,0x00,0x11,0x01,0x70,0x65,0xf0,0x03,0xff,0xff,0xff,0xf1,0x11,0x00,0x50,
+0x3f,0x64,0x44,0x7f,0x10,0x11,0x00,0x32,0xf2,0x00,0x04,0x11,0x00,0x3a,0x20,0x00,
+0x4f,0x11,0x00,0x48,0x42,0x22,0x6f,0x10,0x33,0x00,0x00,0x68,0x00,0x2e,0x00,0x1f,
+0x55,0x00,0x05,0x77,0x00,0x11,0x65,0x98,0x02,0x24,0x6f,0x60,0x31,0x01,0x0f,0x91,
+0x00,0x01,0xf1,0x0a,0x1b,0x00,0x0a,0x40,0x00,0xf6,0x5f,0x00,0x02,0xf1,0x00,0xd6,
+0x00,0x0f,0x65,0xf0,0x23,0x5f,0x43,0x3e,0x83,0x30,0xf6,0x5f,0x0a,0xdc,0x02,0x88,
+0x0f,0x65,0xf0,0x00,0x2f,0x10,0x0d,0x60,0x22,0x00,0xe0,0xde,0xff,0xfe,0xef,0xfe,
+0xe0,0xf6,0x5f,0x03,0x3a,0xd3,0x33,0xe8,0x33,0x22,0x00,0x22,0xe7,0x00,0x22,0x00,
+0x22,0x8f,0x10,0x22,0x00,0x23,0x6f,0x50,0x11,0x00,0x91,0x20,0x00,0x00,0x21,0x00,
+0x0f,0x65,0xfe,0xee,0x01,0x00,0x0e,0x91,0x00,0x14,0x03,0x91,0x00,0x22,0x3f,0x64,
+0x91,0x00,0x90,0x63,0xf2,0x00,0x00,0x0a,0x30,0x00,0x00,0xf6,0xc3,0x02,0xf0,0x06,
+0xf4,0x00,0x00,0x0f,0x63,0xf2,0x7e,0xee,0xff,0xfe,0xee,0xd0,0xf6,0x3f,0x22,0x33,
+0x34,0xf7,0x33,0x33,0x0f,0x22,0x00,0x21,0x0f,0x40,0x22,0x00,0x90,0x02,0x23,0xf6,
+0x22,0x10,0x0f,0x63,0xf2,0x04,0x43,0x03,0x00,0x11,0x00,0x50,0x4f,0x00,0x00,0x09,
+0xb0,0x11,0x00,0x41,0xf0,0x00,0x00,0x9b,0x11,0x00,0x30,0x44,0x44,0x4b,0x11,0x00,
+0x52,0x03,0xcc,0xcc,0xcc,0xc9,0x55,0x00,0x10,0x00,0x55,0x00,0x04,0x91,0x00,0x30,
+0x3f,0x76,0x66,0x01,0x00,0x06,0x91,0x00,0x13,0x04,0x91,0x00,0x22,0xf7,0x4f,0x22,
+0x01,0x31,0x4f,0x74,0xf1,0xce,0x01,0x41,0x10,0xf7,0x4f,0x12,0x62,0x04,0xc2,0x0f,
 0x74,0xf1,0x02,0x22,0x3f,0x62,0x22,0x10,0xf7,0x4f,0x10,0xa2,0x00,0x30,0x74,0xf1,
-0x01,0x11,0x00,0x50,0x00,0xf7,0x4f,0x10,0x9f,0x19,0x0a,0x92,0x0f,0x74,0xf1,0x00,
-0x00,0x1f,0x43,0x71,0x00,0x22,0x00,0x21,0x1c,0x80,0x11,0x00,0x72,0x0f,0x40,0x1a,
-0x10,0xf7,0x4f,0x16,0x55,0x01,0x30,0x74,0xf1,0x13,0xc0,0x20,0x23,0x30,0xf7,0x5b,
-0x07,0x25,0x0f,0x74,0x77,0x00,0x02,0x22,0x01,0x53,0x5f,0x70,0x00,0x26,0x66,0xfe,
-0x31,0x02,0x60,0x05,0x00,0x03,0x05,0x14,0x5f,0x03,0x46,0x24,0x05,0xf1,0x90,0x1d,
-0x14,0x5f,0x77,0x1d,0x0a,0x13,0x00,0x12,0xf7,0x8d,0x25,0x01,0xb0,0x08,0x00,0x08,
-0x69,0x71,0x04,0x44,0x44,0xfa,0x44,0x44,0x40,0x10,0x0f,0x14,0x0e,0xcd,0x17,0x24,
-0x00,0xe7,0x20,0x27,0x24,0x0e,0x70,0x18,0x08,0x14,0xe7,0x6d,0x6d,0x01,0x13,0x00,
-0x50,0x0a,0xe1,0x66,0x66,0x66,0x20,0x1b,0x33,0x01,0xf7,0x3f,0xdf,0x14,0x28,0x04,
-0x10,0xb2,0x51,0x2a,0xa0,0x00,0xb1,0x55,0x03,0x33,0x09,0x14,0x09,0x1b,0x05,0x40,
-0x03,0x66,0x68,0xf9,0xc6,0x00,0x11,0x65,0xf3,0x23,0x23,0x04,0x90,0x8e,0x59,0x23,
-0x07,0xe0,0x25,0x0b,0x01,0x09,0x00,0x22,0x1c,0xf4,0x09,0x00,0x41,0x01,0xdf,0xf4,
-0x0c,0xd6,0x0f,0xd3,0x0d,0xf6,0xf4,0x04,0x55,0x5a,0xf5,0x55,0x51,0x07,0x31,0xf4,
-0x00,0x2d,0x00,0x0f,0x09,0x00,0x09,0xa2,0x25,0x55,0x5a,0xe5,0x55,0x54,0x00,0x01,
-0xf4,0x7f,0x71,0x0a,0x00,0x40,0x58,0x14,0x5b,0x9a,0x54,0x13,0xdb,0x09,0x00,0x23,
+0x01,0x11,0x00,0xf2,0x03,0x00,0xf7,0x4f,0x10,0x9f,0xff,0xff,0xff,0xf0,0x0f,0x74,
+0xf1,0x00,0x00,0x1f,0x43,0x71,0x00,0x22,0x00,0x21,0x1c,0x80,0x11,0x00,0x72,0x0f,
+0x40,0x1a,0x10,0xf7,0x4f,0x16,0x55,0x01,0x81,0x74,0xf1,0x13,0x33,0x33,0x33,0x33,
+0x30,0x22,0x00,0x10,0x00,0x44,0x00,0x05,0x77,0x00,0x02,0x22,0x01,0x51,0x5f,0x70,
+0x00,0x26,0x66,0x01,0x00,0x53,0x64,0x00,0x05,0xff,0xee,0x03,0x05,0x51,0x5f,0x10,
+0x00,0x00,0x10,0xc8,0x01,0x10,0xf1,0xde,0x03,0x00,0x0a,0x00,0x00,0x13,0x00,0x1e,
+0xe7,0x13,0x00,0x01,0x1d,0x05,0x30,0x06,0xf0,0xef,0x54,0x00,0xe4,0xfd,0x00,0x00,
+0x6f,0x04,0x44,0x44,0xfa,0x44,0x44,0x40,0x00,0x08,0xe0,0x26,0x00,0x23,0x9c,0x00,
+0x39,0x00,0x24,0x0c,0xa0,0x13,0x00,0x14,0xf7,0x13,0x00,0x23,0x3f,0x30,0x13,0x00,
+0xc2,0x0a,0xe1,0x66,0x66,0x66,0xfa,0x66,0x66,0x66,0x01,0xf7,0x3f,0xa1,0x00,0x37,
+0xf1,0x04,0x10,0x81,0x03,0x23,0x07,0xa0,0x09,0x00,0x14,0x0e,0x09,0x00,0x23,0x3f,
+0x50,0x99,0x03,0x02,0x1b,0x05,0x40,0x03,0x66,0x68,0xf9,0xc6,0x00,0x81,0x65,0x00,
+0x00,0x0b,0xd0,0x00,0x04,0x90,0xa0,0x00,0x12,0x40,0x9b,0x05,0x23,0x01,0xeb,0xa4,
+0x05,0x22,0x1c,0xf4,0x09,0x00,0x40,0x01,0xdf,0xf4,0x0c,0x36,0x00,0xe3,0xf2,0x0d,
+0xf6,0xf4,0x04,0x55,0x5a,0xf5,0x55,0x51,0x07,0x31,0xf4,0x00,0x2d,0x00,0x0f,0x09,
+0x00,0x09,0xa1,0x25,0x55,0x5a,0xe5,0x55,0x54,0x00,0x01,0xf4,0x7f,0x75,0x00,0x61,
+0x00,0x07,0x60,0x00,0x00,0x5b,0x61,0x05,0x43,0xa0,0x00,0x00,0xdb,0x09,0x00,0x23,
 0x04,0xf3,0x09,0x00,0xf0,0x03,0x0c,0xfd,0xdd,0xdd,0xd8,0x05,0x5d,0xc5,0x50,0x7f,
-0x77,0x77,0x77,0xd9,0x1f,0xff,0xff,0xe4,0xf9,0x00,0x70,0xb9,0x00,0x0b,0xa0,0x0e,
-0xb2,0x40,0x49,0x0e,0x30,0x0b,0xa0,0x03,0x5e,0x06,0x11,0xc7,0x3f,0x00,0x41,0x3e,
-0xa0,0x00,0xd7,0x09,0x00,0xf0,0x19,0x02,0xd4,0x00,0xe6,0x00,0x0b,0xa0,0x33,0x00,
-0x00,0x17,0xe1,0xf5,0x00,0x0b,0xcc,0xf5,0x00,0x07,0xed,0x50,0xf4,0x01,0x7e,0xf9,
-0x10,0x07,0xee,0x60,0x01,0xf3,0x1f,0xf8,0x10,0x01,0xfe,0x70,0x00,0x03,0xf1,0xf9,
-0x46,0x15,0x50,0x8b,0x3a,0x43,0x03,0x54,0x5d,0xa0,0x7b,0x03,0x27,0xfc,0x20,0x6b,
-0x39,0x05,0x71,0x02,0x12,0xc9,0x8c,0x1c,0x10,0x40,0x5f,0x0f,0x50,0xf4,0x48,0xf5,
-0x45,0xf4,0x13,0x00,0xf7,0x12,0x6e,0x00,0x4f,0x00,0x1f,0x40,0x05,0x5d,0xc5,0x46,
-0xf5,0x58,0xf6,0x56,0xf4,0x00,0xff,0xff,0xfc,0x6f,0xdd,0xef,0xdd,0xdf,0x40,0x00,
-0x0c,0xa0,0x06,0xe0,0x04,0xf0,0x01,0x26,0x00,0x00,0x39,0x00,0x03,0x16,0x0d,0xc3,
-0xc9,0x00,0x25,0x55,0x9f,0x75,0x55,0x10,0x00,0x0c,0x92,0x60,0x98,0x0b,0xc1,0xcf,
-0xfd,0x46,0x66,0xaf,0x76,0x66,0x30,0x17,0xdf,0xd6,0x09,0xe5,0x0c,0x33,0x01,0xfc,
-0x50,0x03,0x61,0x17,0x02,0xbe,0x0b,0x20,0x05,0x55,0x39,0x00,0x15,0x51,0x49,0x2e,
-0x11,0x30,0xa8,0x23,0x02,0xce,0x15,0x21,0x07,0xc0,0x94,0x06,0x10,0x30,0x63,0x07,
-0xe1,0xa1,0xf6,0x33,0x34,0xf3,0x00,0x24,0x4a,0xd4,0x42,0x1f,0x20,0x00,0x1f,0x26,
-0x00,0x51,0x01,0xf2,0x02,0x34,0xf3,0xcd,0x19,0xb1,0x4f,0x20,0xaf,0xfb,0x00,0x04,
-0x98,0x44,0x6d,0x52,0xf2,0x5b,0x00,0xf0,0x02,0xd0,0x09,0xb0,0x1f,0xcb,0xbb,0xbb,
-0x50,0x00,0x0e,0x11,0xf3,0x01,0xfd,0xd7,0x78,0xf6,0x9f,0x1c,0x30,0xfc,0x1f,0x7e,
-0x10,0x10,0x82,0x44,0xad,0x44,0x31,0xf2,0xe6,0x08,0xd0,0x5f,0x00,0xe0,0x27,0xe2,
-0xf6,0x00,0x0d,0xdd,0xef,0xdd,0xd4,0xf2,0x0d,0xee,0x00,0x00,0xce,0x01,0x20,0x3f,
-0x20,0xd2,0x30,0x01,0x5f,0x00,0x32,0x4f,0xdf,0x60,0x26,0x00,0x41,0x8f,0x90,0x8f,
-0xa1,0x13,0x00,0x4e,0xfd,0x70,0x00,0x5b,0x57,0x0b,0x02,0x50,0x63,0x23,0x0b,0xd0,
-0x98,0x1c,0x31,0x0a,0xdd,0xa0,0x21,0x2b,0x50,0x30,0x3d,0xb1,0x1b,0xe6,0x36,0x27,
-0xf6,0x09,0x03,0xaf,0xa1,0x11,0x18,0xfe,0x83,0x00,0xbf,0x83,0xfa,0x7f,0xff,0xff,
-0xfb,0x7d,0xb0,0x00,0x4c,0x11,0x00,0x00,0x6d,0x00,0x65,0x1d,0x00,0x93,0x57,0xe0,
-0xa0,0x24,0x32,0x8e,0x22,0x52,0x10,0x00,0x00,0xc8,0x01,0xd8,0x06,0xd0,0x95,0x33,
-0xf5,0x05,0x7d,0x02,0xdb,0x00,0x6d,0x00,0x3e,0x70,0x00,0x3f,0x30,0xb9,0x07,0xdf,
-0xa0,0x00,0x3c,0x10,0x03,0x80,0xa0,0x72,0x40,0x22,0x22,0x25,0xf4,0x94,0x21,0x04,
-0x4a,0x06,0x16,0x50,0x99,0x2c,0x10,0x02,0x79,0x0c,0x10,0x52,0x6f,0x21,0x14,0xff,
-0x34,0x0e,0x00,0x1e,0x52,0x20,0x1b,0x20,0xba,0x25,0x20,0x0b,0x90,0xaa,0x00,0xe1,
+0x77,0x77,0x77,0xd9,0x1f,0xff,0xff,0xe4,0xf9,0x00,0xe0,0xb9,0x00,0x0b,0xa0,0x0e,
+0xb2,0x40,0x00,0x00,0xc8,0x00,0x0b,0xa0,0x03,0x5e,0x06,0x11,0xc7,0x3f,0x00,0x41,
+0x3e,0xa0,0x00,0xd7,0x09,0x00,0xf2,0x22,0x02,0xd4,0x00,0xe6,0x00,0x0b,0xa0,0x33,
+0x00,0x00,0x17,0xe1,0xf5,0x00,0x0b,0xcc,0xf5,0x00,0x07,0xed,0x50,0xf4,0x01,0x7e,
+0xf9,0x10,0x07,0xee,0x60,0x01,0xf3,0x1f,0xf8,0x10,0x01,0xfe,0x70,0x00,0x03,0xf1,
+0x06,0x10,0x00,0x00,0x50,0x00,0x00,0x07,0xf0,0xe1,0x02,0x33,0x54,0x5d,0xa0,0x7b,
+0x03,0x26,0xfc,0x20,0x39,0x01,0x15,0x08,0x71,0x02,0x30,0xc9,0x00,0x6f,0xb5,0x00,
+0xa0,0x40,0x00,0x0c,0x90,0x06,0xf4,0x48,0xf5,0x45,0xf4,0x13,0x00,0xf7,0x12,0x6e,
+0x00,0x4f,0x00,0x1f,0x40,0x05,0x5d,0xc5,0x46,0xf5,0x58,0xf6,0x56,0xf4,0x00,0xff,
+0xff,0xfc,0x6f,0xdd,0xef,0xdd,0xdf,0x40,0x00,0x0c,0xa0,0x06,0xe0,0x04,0xf0,0x01,
+0x26,0x00,0x00,0x39,0x00,0x00,0x42,0x00,0x01,0x13,0x00,0xd0,0x25,0x55,0x9f,0x75,
+0x55,0x10,0x00,0x0c,0x92,0x60,0x00,0x06,0xf2,0x5f,0x00,0xb1,0xcf,0xfd,0x46,0x66,
+0xaf,0x76,0x66,0x30,0x17,0xdf,0xd6,0x95,0x01,0x30,0xf9,0x01,0xfc,0xa2,0x01,0x51,
+0x6f,0x20,0x00,0x00,0x02,0x24,0x02,0x12,0xf2,0x9e,0x00,0x10,0x55,0x39,0x00,0x42,
+0x51,0x00,0x00,0x01,0xb9,0x01,0x60,0x30,0x00,0x00,0x7c,0x00,0x00,0xf8,0x02,0x41,
+0x00,0x00,0x07,0xc0,0x94,0x06,0x10,0x30,0x63,0x07,0xe1,0xa1,0xf6,0x33,0x34,0xf3,
+0x00,0x24,0x4a,0xd4,0x42,0x1f,0x20,0x00,0x1f,0x26,0x00,0x60,0x01,0xf2,0x02,0x34,
+0xf3,0x00,0x35,0x00,0xb1,0x4f,0x20,0xaf,0xfb,0x00,0x04,0x98,0x44,0x6d,0x52,0xf2,
+0x5b,0x00,0xf2,0x15,0xd0,0x09,0xb0,0x1f,0xcb,0xbb,0xbb,0x50,0x00,0x0e,0x11,0xf3,
+0x01,0xfd,0xd7,0x78,0xf6,0x00,0x9f,0xff,0xff,0xfc,0x1f,0x7e,0x00,0x3f,0x20,0x02,
+0x44,0xad,0x44,0x31,0xf2,0xe6,0x08,0xd0,0x5f,0x00,0xe0,0x27,0xe2,0xf6,0x00,0x0d,
+0xdd,0xef,0xdd,0xd4,0xf2,0x0d,0xee,0x00,0x00,0xce,0x01,0x52,0x3f,0x20,0x7f,0x80,
+0x00,0x5f,0x00,0x32,0x4f,0xdf,0x60,0x26,0x00,0x41,0x8f,0x90,0x8f,0xa1,0x13,0x00,
+0x22,0xfd,0x70,0xdf,0x01,0x0c,0x01,0x00,0x21,0x05,0x40,0x67,0x02,0x00,0xdf,0x07,
+0x41,0xa0,0x00,0x0a,0xdd,0x79,0x01,0xf2,0x12,0x2d,0x30,0x3d,0xb1,0x1b,0xe6,0x00,
+0x00,0x03,0x10,0x03,0xaf,0xa1,0x11,0x18,0xfe,0x83,0x00,0xbf,0x83,0xfa,0x7f,0xff,
+0xff,0xfb,0x7d,0xb0,0x00,0x4c,0x11,0x00,0x00,0x6d,0x3b,0x00,0x10,0x2f,0xc1,0x00,
+0xf2,0x1e,0xfa,0x00,0x00,0x02,0xa0,0x24,0x32,0x8e,0x22,0x52,0x10,0x00,0x00,0xc8,
+0x01,0xd8,0x06,0xd0,0x4f,0x60,0x00,0x00,0x7d,0x02,0xdb,0x00,0x6d,0x00,0x3e,0x70,
+0x00,0x3f,0x30,0xb9,0x07,0xdf,0xa0,0x00,0x3c,0x10,0x03,0x80,0x00,0x00,0x14,0xce,
+0x01,0x75,0x22,0x22,0x25,0xf4,0x22,0x22,0x20,0x4a,0x06,0x11,0x50,0xf5,0x01,0x11,
+0xf2,0xe7,0x08,0x94,0x22,0x22,0x22,0x5f,0x52,0x22,0x22,0x22,0x00,0x65,0x06,0xd0,
+0xf0,0x00,0x06,0x50,0x00,0x1b,0x20,0x00,0x1b,0x30,0x00,0x0b,0x90,0xaa,0x00,0xe1,
 0x8e,0x10,0x00,0x0b,0x90,0x01,0x24,0xe4,0x22,0xe8,0x21,0x00,0x0b,0x90,0xfd,0x02,
-0x50,0xf9,0x05,0x5d,0xb5,0x3c,0xb1,0x14,0xa0,0xb9,0x0c,0xdf,0xed,0x8c,0xec,0xcd,
-0xfc,0xcc,0xf9,0x1b,0x00,0x50,0xa4,0x48,0xf4,0x44,0xc9,0x09,0x00,0x55,0x81,0x17,
-0xf1,0x11,0xc9,0x2d,0x00,0x00,0x48,0x00,0x03,0x26,0x34,0x22,0x90,0x40,0xb6,0x09,
-0xd0,0x0c,0xef,0xf0,0xf8,0x44,0x44,0x49,0xe0,0x06,0xcf,0xf9,0x20,0xf6,0x23,0x03,
-0x22,0x1f,0xd6,0x6c,0x1b,0x22,0xe0,0x03,0x89,0x1c,0x02,0x18,0x09,0x54,0xf7,0x33,
-0x33,0x38,0xe0,0x55,0x30,0x11,0xd0,0xf2,0x18,0x02,0x68,0x6e,0x30,0x44,0x44,0x9f,
-0x45,0x08,0x09,0x1c,0x2f,0x12,0x7f,0x5e,0x52,0x10,0x33,0x9a,0x4f,0x33,0x33,0x20,
-0x00,0xdc,0x61,0x07,0x0f,0x20,0x10,0x14,0x2d,0x05,0x00,0x10,0x1b,0x41,0x3f,0xee,
-0xee,0xef,0x32,0x3a,0x11,0x3f,0x3c,0x2a,0x01,0xc4,0x06,0x03,0x09,0x00,0x20,0x5f,
-0x54,0x5a,0x00,0x24,0x7f,0x20,0x25,0x43,0x33,0x20,0x00,0xab,0x1d,0x0b,0x2d,0x01,
-0xf6,0x96,0x35,0x04,0x4c,0x09,0x1f,0x17,0xe8,0x01,0x02,0x01,0x60,0x01,0x00,0x43,
-0x05,0x10,0xeb,0x90,0x00,0x13,0x5f,0xab,0x00,0x11,0xd0,0x1b,0x61,0x11,0xd9,0x60,
-0x03,0x50,0x62,0xf3,0x00,0xc9,0x39,0x60,0x0e,0xf0,0x05,0x42,0xf3,0x00,0xc9,0x2d,
-0xc0,0x00,0x01,0xda,0x02,0xf3,0x00,0xc9,0x01,0xdc,0x00,0x1d,0xc0,0x02,0xf3,0x3a,
-0x0f,0x71,0x80,0x05,0x10,0x01,0xc5,0x00,0x75,0x06,0x03,0x14,0x02,0x7c,0x14,0x00,
-0x99,0x84,0x00,0xc7,0x3d,0xc1,0x19,0xff,0x53,0x33,0x36,0xf9,0x00,0x00,0x18,0xfc,
-0x4a,0xd1,0xf9,0x6c,0x73,0x0a,0x50,0x00,0xae,0x58,0xf9,0x00,0x4a,0x63,0x01,0x38,
-0x4f,0x70,0x25,0x8e,0xfc,0x79,0xff,0xb6,0x31,0x2d,0x84,0x82,0x20,0x00,0x06,0xbe,
-0xff,0xf2,0x25,0x20,0x0b,0x01,0x10,0x50,0xf4,0x06,0x02,0x88,0x4f,0x01,0xfd,0x5e,
-0x14,0x6f,0x37,0x36,0x24,0x06,0xf0,0xc1,0x38,0x22,0x6f,0x00,0x40,0x0a,0x12,0xfd,
-0x13,0x00,0x53,0xfb,0x55,0x5d,0xb0,0x6f,0x4a,0x50,0x32,0xf8,0x06,0xf1,0x19,0x2d,
-0x40,0x3f,0x40,0x6f,0xf7,0x7e,0x53,0xe1,0x40,0x07,0xf0,0x06,0xf7,0xfa,0x00,0x00,
-0xc7,0x7f,0x80,0xdb,0x00,0x6f,0x1d,0x71,0x80,0x4e,0xdf,0x50,0x06,0xf0,0x03,0xec,
-0x00,0x13,0x82,0x21,0x00,0x6f,0x35,0x67,0x23,0x06,0xf5,0x5f,0x00,0x23,0x02,0xfa,
-0x5f,0x00,0x23,0x02,0xed,0x72,0x00,0x10,0x06,0x74,0x3d,0x11,0x6f,0xaf,0x47,0x13,
-0x10,0x13,0x00,0x14,0x67,0xb5,0x2b,0x00,0x87,0x00,0x13,0xa0,0x08,0x00,0x40,0xf7,
-0x33,0x34,0x10,0x8e,0x05,0x12,0xff,0xf5,0x73,0x21,0x6e,0xc2,0xba,0x10,0x41,0x04,
-0xdf,0x85,0x10,0xd1,0x7d,0x43,0x3a,0x11,0xce,0x41,0xcc,0x32,0x31,0x9f,0xec,0x30,
-0x62,0x00,0xf1,0x0d,0x8e,0xf8,0x1c,0xe1,0x00,0x00,0x04,0x8c,0xfe,0x70,0x1c,0xf9,
-0x55,0x56,0x22,0xfe,0x94,0x00,0x3d,0xfe,0xee,0xee,0xfa,0x01,0x00,0x00,0x8f,0xa1,
-0x98,0x35,0x31,0x17,0xee,0x63,0xdb,0x44,0x70,0x0d,0xe6,0x04,0xf9,0x01,0xaf,0x60,
-0xbe,0x06,0x41,0x04,0xec,0xee,0x40,0x3d,0x00,0x11,0x7e,0x90,0x46,0x21,0x14,0x7d,
-0x4f,0x40,0x42,0x4c,0xff,0xfe,0xa4,0xa9,0x72,0x17,0x41,0x14,0x38,0x1c,0x50,0x37,
-0x10,0x03,0x87,0x4d,0x08,0xe6,0x11,0x03,0x55,0x68,0x50,0x57,0x77,0x77,0x7a,0xf8,
-0x9f,0x45,0x05,0x96,0x0b,0x02,0xcd,0x32,0x14,0x00,0x3f,0x3a,0x14,0xf6,0xb1,0x0d,
-0x23,0x1c,0xc0,0xb3,0x06,0x34,0xb0,0x5f,0x50,0x77,0x58,0x12,0xde,0xac,0x05,0x12,
-0xfa,0x52,0x1b,0x01,0xf1,0x4f,0x21,0x08,0xf9,0x45,0x0e,0x12,0x20,0x1e,0x3b,0x11,
-0x18,0x33,0x51,0x33,0x0a,0xfd,0x50,0x22,0x3b,0x24,0x05,0xed,0x60,0x35,0x02,0x52,
-0x34,0x24,0x4e,0x10,0x98,0x00,0x13,0xf1,0xaf,0x71,0x00,0xdc,0x26,0x24,0x44,0x00,
-0xe7,0x4e,0x10,0xf0,0x1b,0x6e,0x51,0x11,0x5f,0x31,0x11,0x8f,0x92,0x20,0x00,0x9f,
-0x1c,0x11,0xf0,0x14,0x16,0x00,0x23,0x5d,0x01,0x13,0x00,0x24,0x06,0xf0,0x13,0x00,
-0x11,0x8f,0x70,0x03,0x05,0x34,0x04,0x63,0x05,0x55,0x55,0x56,0xff,0xf6,0x1f,0x18,
-0x14,0x7f,0x52,0x44,0x23,0x3f,0xa0,0x35,0x58,0x21,0x2e,0xd1,0x23,0x49,0x01,0x6c,
-0x68,0x30,0x01,0xde,0x60,0x94,0x43,0x11,0xa0,0x3e,0x33,0x41,0x10,0x0d,0xfa,0x30,
-0x86,0x6c,0x23,0xff,0x20,0x30,0x31,0x00,0x5a,0x60,0x43,0x44,0x00,0x3c,0x10,0x47,
-0x63,0x04,0xab,0x00,0x14,0xf6,0x70,0x1d,0x75,0x9f,0x87,0x79,0xf8,0x77,0x77,0x72,
-0x83,0x0c,0x10,0x50,0xcf,0x29,0x02,0x26,0x00,0x23,0x05,0xf8,0x26,0x1c,0x24,0x00,
-0x4a,0xc8,0x02,0x00,0x9d,0x3a,0x10,0xbf,0xdc,0x07,0x05,0x13,0x13,0x01,0x8d,0x07,
-0x15,0xfe,0x66,0x21,0x24,0x2e,0x80,0x8b,0x70,0x03,0xb4,0x3b,0x42,0x3e,0xd0,0x00,
-0xbf,0xf8,0x58,0x30,0xd2,0x00,0x00,0x3c,0x83,0x11,0x17,0xf1,0x48,0x35,0x9f,0xd7,
-0x20,0xab,0x00,0x26,0x10,0x32,0xab,0x00,0xf0,0x12,0x6c,0x00,0x01,0x23,0x57,0xac,
-0x50,0x00,0x44,0x07,0xd1,0xff,0xfe,0xcb,0x97,0x62,0x00,0x05,0xe1,0x7d,0x05,0x30,
-0x59,0x00,0x0d,0x70,0x00,0x0d,0x77,0xd0,0x6d,0x01,0xf2,0xd3,0x11,0x70,0x68,0x7d,
-0x00,0xd6,0x0b,0x56,0xf4,0xc7,0x01,0xb2,0xd0,0x25,0x32,0x22,0x2e,0x92,0x20,0x00,
-0x00,0xad,0x3f,0xd3,0x0b,0x50,0x18,0xff,0xd0,0x07,0xa0,0x52,0x01,0x60,0x0e,0xc4,
-0x7d,0x00,0x1c,0xc0,0x0a,0x22,0x90,0x20,0x07,0xd0,0x00,0x1a,0x23,0x4e,0x70,0x00,
-0x50,0x5e,0x41,0x4d,0x20,0xcd,0xb2,0xc2,0x01,0x02,0x25,0x36,0x05,0xb1,0x34,0x01,
-0xc5,0x3d,0x22,0x8f,0x61,0xc6,0x3d,0x22,0x7f,0x80,0xd5,0x3a,0x10,0x38,0x84,0x42,
-0x60,0xc7,0x30,0x00,0x0d,0xff,0xd7,0xc5,0x87,0x33,0xef,0xfd,0x00,0xc2,0x42,0x11,
-0x25,0x94,0x56,0x28,0x90,0x00,0xef,0x6c,0x00,0x4a,0x14,0x21,0x9f,0x96,0x1d,0x01,
-0x16,0x8f,0x1d,0x01,0x05,0xa0,0x45,0x02,0x94,0x08,0x02,0xfa,0x59,0x10,0xcf,0xac,
-0x70,0x00,0x5e,0x2e,0x52,0x04,0x55,0x55,0x5d,0xf3,0xc9,0x5f,0x30,0x00,0x2c,0xd3,
-0x88,0x03,0x12,0x20,0xab,0x18,0xd3,0x0e,0xe6,0xf2,0x01,0x11,0x14,0xf4,0x11,0x11,
-0x00,0x81,0x3f,0x27,0x01,0x15,0x60,0x03,0xf2,0x13,0x33,0x36,0xf6,0x02,0x2b,0x23,
-0x3f,0x20,0xd3,0x1d,0x23,0x03,0xf2,0xa3,0x14,0x00,0x51,0x05,0x00,0x67,0x05,0x01,
-0x13,0x00,0x3e,0x1f,0xff,0xb0,0x89,0x44,0x08,0x75,0x47,0x07,0x6f,0x05,0x31,0x6e,
-0xee,0xee,0x79,0x73,0x12,0x30,0x28,0x29,0x21,0x66,0x68,0x25,0x2a,0x02,0xb5,0x20,
-0x30,0x06,0xf0,0x35,0x98,0x0a,0x52,0x32,0xf3,0x00,0x13,0x0a,0x4c,0x3a,0x0e,0x99,
-0x05,0x06,0x43,0x01,0xb1,0xfb,0x00,0x56,0x66,0x6e,0xb6,0x66,0xf9,0x66,0x66,0x40,
-0x58,0x0a,0x24,0x0f,0x50,0xbc,0x19,0x13,0xf5,0x90,0x35,0x00,0x13,0x00,0x12,0x37,
-0xc6,0x0f,0x10,0xf5,0x16,0x0f,0x20,0x4b,0xfa,0xbc,0x2d,0x51,0x45,0xbc,0x00,0xdf,
-0xc5,0x8e,0x3c,0x4e,0xfe,0x50,0x02,0x10,0xb5,0x00,0x08,0x6e,0x13,0x03,0x82,0x3b,
-0x04,0xfd,0x05,0x13,0x50,0xb5,0x00,0x24,0x66,0xf5,0xb5,0x00,0x44,0x0f,0x50,0x06,
-0xf0,0x0a,0x19,0x22,0x02,0x0f,0x8d,0x68,0x20,0x00,0x00,0x76,0x2a,0x39,0x64,0x44,
-0x40,0xdb,0x15,0x13,0xc9,0x5f,0x78,0x00,0xe2,0x67,0x11,0xf8,0x0c,0x26,0x20,0x03,
-0xf5,0xf7,0x49,0x01,0x1f,0x82,0x13,0xc0,0x26,0x00,0x52,0x0e,0xbf,0x80,0x3f,0x30,
-0xc7,0x4b,0x33,0x5f,0xb6,0xf3,0x15,0x03,0x60,0x5e,0xff,0xa8,0x76,0x66,0x66,0xe9,
-0x3a,0x30,0x06,0x9d,0xef,0xda,0x0e,0x09,0x7d,0x26,0x28,0xc0,0x00,0xf1,0x55,0x14,
-0x6f,0xaa,0x00,0xa2,0x6f,0x33,0x33,0x34,0x53,0x33,0x33,0x4f,0x50,0x6f,0x30,0x04,
-0x41,0x0f,0x50,0x49,0x44,0x1a,0x35,0x40,0x59,0x30,0x00,0xbd,0x15,0x17,0x27,0xdd,
-0xd0,0x4b,0x04,0x11,0x7e,0xfb,0x35,0xa4,0x90,0x00,0x00,0x24,0x44,0x48,0xf4,0x44,
-0x44,0x30,0x4f,0x2b,0x02,0x95,0x2c,0x01,0xf8,0x06,0x61,0x34,0x44,0x44,0xbf,0x9f,
-0x74,0x1c,0x00,0x42,0x07,0xf7,0x0b,0xe2,0x3c,0x52,0x30,0x70,0x01,0xbf,0x11,0x57,
-0x20,0xbf,0xc3,0x3e,0x14,0x41,0x84,0x00,0x9f,0xb4,0x5d,0x89,0x23,0xdf,0xb0,0xa3,
-0x00,0x0a,0x5f,0x01,0x03,0x52,0x00,0x10,0x00,0xb3,0x08,0x10,0x82,0xd0,0x08,0x05,
-0x57,0x01,0x21,0x05,0xf2,0x5a,0x14,0xf1,0x0c,0x23,0xf5,0x00,0x5f,0x00,0x4d,0x30,
-0x00,0x5b,0x10,0x0f,0x50,0x01,0x40,0x4f,0x90,0x02,0x01,0xbf,0x60,0x41,0x00,0x00,
-0x8f,0x90,0x04,0xf7,0x05,0x26,0xf2,0x02,0xdf,0x60,0x02,0xee,0xe3,0x00,0x3e,0xb0,
-0x00,0x05,0x20,0x04,0xea,0x09,0xe4,0x00,0x23,0x16,0x75,0x21,0x07,0xf9,0xdf,0x11,
-0x10,0xf5,0xd0,0x14,0x44,0x81,0x00,0x04,0xbf,0xd9,0x49,0xc3,0xdc,0x4e,0xa5,0x55,
-0x55,0x55,0xae,0x19,0x90,0x01,0x00,0xe7,0x86,0x21,0x02,0x72,0x0c,0x01,0xab,0x11,
-0x00,0xa9,0x2e,0x24,0x4a,0xe0,0x50,0x02,0x10,0xfd,0xc3,0x01,0x11,0x81,0x3b,0x53,
-0x04,0x73,0x69,0x24,0x06,0xf0,0x0a,0x1c,0x00,0xee,0x63,0x40,0xaa,0xda,0xaa,0x10,
-0x13,0x00,0x91,0x09,0x99,0x99,0xab,0xa5,0x55,0x55,0x9f,0x55,0xf5,0x17,0x11,0xaf,
-0xcf,0x2c,0x11,0x50,0x52,0x00,0x10,0x6f,0xd8,0x51,0x31,0x0b,0xb0,0x01,0x39,0x00,
-0x42,0x3f,0x90,0xf6,0x03,0xda,0x02,0x50,0x5f,0xbf,0x10,0x0b,0xc0,0x4c,0x00,0x00,
-0x02,0x87,0x31,0x2f,0x40,0x6f,0xd1,0x7b,0x50,0x10,0x00,0xba,0x06,0xf0,0x9e,0x0c,
-0x31,0xec,0x00,0x02,0x26,0x00,0x31,0xae,0x14,0xf6,0x72,0x00,0x00,0x79,0x63,0x00,
-0x84,0x79,0x02,0xa4,0x55,0x42,0x00,0x26,0x6b,0xe0,0x01,0x56,0x3f,0x02,0xff,0xd6,
-0x11,0x4c,0x06,0x15,0xf6,0x11,0x54,0x1f,0x60,0x13,0x00,0x05,0x62,0x18,0x30,0x01,
-0xf6,0x00,0x29,0xf0,0x25,0x31,0x1f,0x60,0x02,0xe7,0x70,0x01,0x8e,0x1c,0x11,0xf1,
-0x57,0x0d,0x20,0x1f,0x60,0xbd,0x3e,0x21,0x03,0xf6,0x39,0x00,0x10,0xaf,0x4a,0x63,
-0x01,0xac,0x54,0x32,0xf7,0x00,0x2f,0x70,0x73,0x42,0x0c,0xe0,0x0c,0xe1,0x4c,0x00,
-0x32,0x6f,0x30,0x95,0x5f,0x00,0x24,0x02,0xf5,0x5f,0x00,0x18,0x01,0x72,0x00,0x24,
-0x04,0x66,0xda,0x38,0x3e,0x5f,0xfe,0xa1,0xac,0x00,0x15,0x7e,0xd5,0x0d,0x1b,0xe0,
-0x13,0x00,0x62,0x0c,0x60,0x07,0xe0,0x00,0x5b,0x4a,0x19,0x12,0x7e,0x15,0x2f,0x10,
-0xcb,0x26,0x00,0x21,0x07,0xf2,0x05,0x55,0x11,0x7e,0x95,0x01,0x21,0x1e,0xa0,0x39,
-0x00,0x20,0x4f,0x40,0x7d,0x5c,0x11,0x7e,0x73,0x68,0x12,0x34,0x4c,0x00,0x02,0x08,
-0x25,0x14,0x7e,0xf7,0x58,0x44,0x04,0x90,0x03,0xfb,0xc8,0x09,0x04,0xed,0x3f,0x23,
-0x3c,0xf9,0x65,0x42,0x21,0xcf,0xc3,0x0b,0x44,0x20,0x79,0xdf,0xf4,0x2e,0x00,0x89,
-0x06,0x13,0xc9,0xb3,0x00,0x17,0x32,0xaa,0x00,0x15,0x3b,0xcf,0x64,0x04,0x12,0x00,
-0x14,0x9d,0x2f,0x41,0x11,0xdd,0x93,0x2a,0x16,0x0d,0xbc,0x0a,0x05,0xfd,0x19,0x14,
-0x09,0x38,0x04,0x05,0xbd,0x6b,0x23,0x4f,0x86,0xf9,0x29,0x22,0xbc,0xcf,0x3e,0x0a,
-0x00,0xe0,0x1a,0x14,0x9d,0x5f,0x62,0x14,0x9d,0x63,0x04,0x13,0x9d,0x29,0x29,0x01,
-0x09,0x00,0x23,0x1d,0xd0,0x09,0x00,0xc4,0x5e,0x20,0x45,0x55,0x55,0xbe,0x55,0x55,
-0x54,0x02,0x00,0xcf,0xc3,0x13,0x14,0x39,0xa1,0x7d,0x00,0xf7,0x4c,0x10,0xcd,0xcd,
-0x16,0x87,0x5b,0xf6,0x55,0x58,0xf8,0x55,0x50,0x01,0x21,0x07,0x03,0x26,0x18,0x41,
-0x04,0x44,0x45,0xf9,0x31,0x0b,0x15,0x2f,0xb9,0x1a,0x01,0x6b,0x23,0x01,0x8b,0x0d,
-0x25,0x6f,0xa5,0xcc,0x3f,0x02,0x56,0x38,0x24,0x05,0xf5,0x00,0x09,0x01,0x0a,0x10,
-0x70,0x30,0x00,0x01,0xeb,0x26,0x66,0xce,0xa0,0x35,0x13,0x6e,0xab,0x00,0x23,0x1b,
-0xfb,0x96,0x61,0x31,0x0b,0x60,0xce,0xb5,0x45,0x14,0xe8,0xa1,0x2b,0x90,0x63,0x00,
-0x48,0x00,0x01,0xe4,0x00,0x08,0x50,0x81,0x20,0x21,0x1f,0x50,0x4c,0x89,0x55,0xc0,
-0x01,0xf5,0x00,0xd7,0xec,0x10,0x14,0xf6,0xec,0x10,0x30,0x64,0xf0,0x02,0xec,0x03,
-0x40,0x10,0xe6,0x4f,0x06,0x21,0x11,0x40,0xf7,0x0e,0x60,0x10,0x63,0x01,0x00,0xd2,
-0x31,0x20,0x06,0xf3,0x03,0x2f,0x00,0x43,0x16,0x00,0xc1,0x32,0x15,0x60,0x32,0x5c,
-0x24,0x00,0x0f,0x3b,0x39,0x70,0xf8,0x55,0x55,0xfa,0x55,0x57,0xf4,0xd9,0x05,0x02,
-0x22,0x1c,0x11,0xf5,0x21,0x1c,0x03,0x11,0x00,0xb4,0x55,0x8f,0x30,0x00,0xc4,0x00,
-0x00,0xf7,0x09,0xed,0x90,0x36,0x39,0x05,0x39,0x08,0x12,0xd0,0x5b,0x02,0x10,0x01,
-0xfd,0x72,0x00,0xb6,0x1b,0x10,0xf8,0xbd,0x02,0x21,0x04,0xf2,0xa5,0x0e,0x60,0x9d,
-0x00,0x4f,0x20,0x0d,0xa0,0xf0,0x09,0x21,0x04,0xf2,0xf7,0x0b,0x51,0x07,0x10,0x4f,
-0x20,0x46,0xdc,0x00,0x01,0x8c,0x3a,0x17,0x6e,0xef,0x09,0x2e,0x04,0xf2,0xfa,0x1b,
-0x0f,0x11,0x00,0x0c,0x00,0x58,0x0e,0x0a,0xf9,0x63,0x04,0xc2,0x17,0x32,0x05,0xf5,
-0x44,0xf8,0x60,0x20,0x00,0x5f,0x97,0x00,0x20,0x07,0xe0,0xbf,0x4f,0xf0,0x01,0x55,
-0x9f,0x55,0x55,0xaf,0x55,0x50,0x00,0x5f,0x7d,0xde,0xfd,0xdd,0xde,0xfd,0xdd,0xba,
-0x06,0x23,0x6e,0x00,0x63,0x04,0x51,0x06,0xe2,0x22,0x29,0xe0,0x2a,0x04,0x12,0x6f,
-0x90,0x00,0x15,0x7e,0xa8,0x14,0x14,0xc3,0x37,0x78,0x72,0xba,0x01,0x3f,0x81,0x11,
-0x13,0xdc,0x4c,0x33,0x41,0x80,0x03,0xdd,0x10,0x75,0x02,0x31,0x4e,0xeb,0xf9,0x55,
-0x17,0xf2,0x03,0x02,0x6a,0xef,0xef,0xa6,0x20,0x00,0x0d,0x90,0xdf,0xfd,0x95,0x00,
-0x49,0xef,0xfe,0x20,0x12,0x51,0x40,0x1b,0x14,0xa2,0x57,0x01,0x00,0x72,0x06,0xf6,
-0x60,0x15,0x0c,0x5f,0x0e,0x14,0xdb,0x4a,0x22,0x80,0x0d,0x80,0x02,0x50,0x0a,0x60,
-0x04,0x20,0x5a,0x0a,0x50,0x9c,0x00,0xd8,0x00,0xe7,0x5a,0x0a,0x50,0x0e,0x80,0x0d,
-0x80,0x4f,0x13,0x00,0x50,0x03,0xfd,0x10,0xd8,0x0a,0x3e,0x63,0xf0,0x12,0x70,0xdc,
-0xbd,0x1d,0x86,0xf7,0xe9,0x00,0x00,0xe7,0xbf,0x20,0xb9,0xdb,0xf9,0x02,0xea,0x00,
-0x0f,0x69,0x40,0x01,0x0d,0x86,0x00,0x02,0x70,0x00,0xf4,0x04,0x44,0x44,0xea,0x00,
-0x01,0x23,0x3f,0x31,0x65,0x18,0x01,0x2a,0x05,0x13,0xd8,0xc2,0x29,0x02,0x14,0x35,
-0x40,0x0f,0x71,0x33,0x33,0xc6,0x2d,0x43,0x33,0x04,0xf1,0x5f,0x85,0x00,0x1c,0x02,
-0x49,0x35,0xf4,0x04,0x7b,0xc0,0x02,0xee,0xee,0xd0,0x26,0x8a,0xdf,0xfe,0xa5,0x00,
-0x15,0x56,0xf8,0x06,0xdb,0x96,0xf7,0xe5,0x63,0x24,0x0e,0x70,0x91,0x03,0x12,0xe7,
-0x41,0x26,0x40,0x0c,0x50,0x0e,0x70,0x6f,0x03,0xf0,0x02,0x34,0x10,0xe6,0x00,0xed,
-0xcc,0xc6,0x00,0x8f,0xff,0xf9,0x0e,0x60,0x0e,0xc8,0x88,0x40,0xa6,0x27,0x11,0xe6,
-0x26,0x00,0x41,0x35,0x01,0xf3,0x0e,0xbb,0x24,0x42,0x06,0xe0,0x5f,0x00,0x13,0x00,
-0x42,0x0e,0x6b,0xa0,0x0e,0xce,0x24,0xc1,0x6f,0xf4,0x00,0xee,0xdd,0xfe,0xdd,0xd9,
-0x00,0x00,0xef,0x30,0xad,0x1a,0x54,0x40,0x00,0x6f,0xef,0x71,0x88,0x0a,0xd0,0x8f,
-0xfc,0x97,0x65,0x55,0x55,0x50,0x3f,0xc0,0x00,0x16,0xad,0xef,0xef,0x0f,0x19,0x60,
-0xa9,0x00,0x33,0xc3,0x18,0x10,0x60,0x6f,0x24,0x1c,0xd2,0x69,0x6f,0x20,0xbd,0x00,
-0x46,0x00,0x68,0x57,0xf9,0x55,0x68,0x50,0xdf,0xc6,0x03,0x02,0xfd,0x02,0x04,0x61,
-0x18,0x00,0x37,0x03,0x23,0x20,0xca,0x7d,0x1b,0x30,0xf1,0xac,0x00,0x20,0x20,0x44,
-0xda,0x33,0x30,0x7f,0x81,0x2c,0x02,0x6f,0x02,0x14,0xd8,0x9f,0x57,0x11,0xd8,0x7c,
-0x09,0xf0,0x07,0x70,0x00,0x00,0xd9,0x25,0x87,0x07,0xf2,0x00,0xf3,0x02,0x58,0xff,
-0xfe,0xb5,0x00,0xeb,0x02,0xf1,0xaf,0xfc,0x95,0xef,0x54,0x32,0xbb,0xd0,0x23,0x41,
-0x08,0x60,0xde,0x50,0x14,0x44,0x44,0x42,0x5c,0x1b,0x00,0xba,0x15,0x22,0x90,0xef,
-0xb0,0x1c,0x13,0xc9,0xa3,0x13,0x20,0x0c,0x90,0xc3,0x08,0xf3,0x02,0x05,0x55,0x55,
-0xd9,0x02,0x55,0x55,0x8f,0x30,0xef,0xee,0xee,0x80,0x7f,0xee,0xee,0xe2,0xf1,0x35,
-0x02,0x0c,0x38,0x12,0x9c,0x03,0x2b,0x20,0xfb,0x0a,0xe6,0x17,0xf0,0x2d,0x54,0x44,
-0x4c,0xb0,0x34,0x44,0x44,0xf5,0x0e,0xc7,0x10,0xb9,0x06,0xe9,0x30,0x0f,0x50,0x16,
-0xcf,0x2d,0x80,0x03,0x9f,0x91,0xf4,0x00,0x00,0x89,0xf7,0x00,0x00,0x39,0xcf,0x21,
-0x5a,0xfe,0x9f,0x50,0x38,0xdf,0xa8,0xf1,0xce,0x93,0x03,0xf3,0x1f,0xc6,0x10,0x6f,
-0x01,0x00,0x43,0xbf,0x00,0x10,0x10,0x1b,0xc0,0x00,0x21,0x21,0x14,0x0e,0x75,0x81,
-0x17,0x12,0xcb,0x12,0x31,0x9f,0xff,0xfc,0xad,0x0c,0x60,0x90,0x24,0x44,0xac,0x00,
-0xf7,0x3f,0x04,0x00,0xa1,0x02,0x00,0x09,0x00,0x01,0xaa,0x02,0x82,0xff,0xee,0xee,
-0xec,0x00,0x3b,0xbb,0xec,0xfa,0x09,0x41,0x4f,0x44,0x43,0x00,0x4c,0x02,0x10,0x4f,
-0x8c,0x10,0x00,0x24,0x00,0x14,0x5e,0xa1,0x06,0x41,0x5e,0x55,0x54,0xaf,0x41,0x02,
-0xf0,0x01,0x6e,0xee,0xfc,0x29,0xe4,0x8f,0x44,0x45,0x40,0x00,0x00,0x9b,0x06,0xe0,
-0x0d,0x80,0xe1,0x0d,0x60,0xba,0x06,0xe0,0x04,0xf9,0xe4,0xa0,0x4e,0x31,0x06,0xe0,
-0x00,0xcd,0x91,0xfb,0x09,0xf6,0x07,0xe0,0x38,0x0a,0xf5,0x00,0x15,0x58,0xf3,0x0b,
-0xfe,0xe8,0x00,0x8f,0xc1,0x0e,0xff,0x90,0x0b,0xa4,0x00,0x00,0x03,0x74,0x1d,0x21,
-0x2b,0x30,0x22,0x3e,0x50,0xfe,0x00,0x0a,0xd0,0x01,0x9d,0x2d,0x42,0x59,0xf0,0x04,
-0xf4,0xe5,0x14,0x32,0x5f,0x01,0xe8,0x55,0x5c,0xf0,0x06,0x05,0xf1,0xcf,0x89,0xac,
-0xdf,0xe1,0x00,0x26,0x66,0xaf,0x1f,0xdb,0xab,0x75,0x4c,0xa0,0x06,0xff,0xff,0xe0,
-0x0e,0x1c,0x30,0x32,0x00,0x8b,0xc9,0x01,0x30,0x5f,0x63,0x33,0x35,0x36,0xf0,0x0a,
+0xf0,0x04,0xf9,0x05,0x5d,0xb5,0x3c,0x70,0x05,0xf0,0x00,0xb9,0x0c,0xdf,0xed,0x8c,
+0xec,0xcd,0xfc,0xcc,0xf9,0x1b,0x00,0x50,0xa4,0x48,0xf4,0x44,0xc9,0x09,0x00,0x55,
+0x81,0x17,0xf1,0x11,0xc9,0x2d,0x00,0x00,0x48,0x00,0x02,0x01,0x00,0x30,0x0b,0x90,
+0x40,0x25,0x04,0xf0,0x00,0xd0,0x00,0x0c,0xef,0xf0,0xf8,0x44,0x44,0x49,0xe0,0x06,
+0xcf,0xf9,0x20,0xf6,0x23,0x03,0x31,0x1f,0xd6,0x00,0x82,0x00,0x64,0xe0,0x03,0x00,
+0x00,0x00,0xf6,0x18,0x09,0x41,0xf7,0x33,0x33,0x38,0x09,0x00,0x00,0x1b,0x00,0x01,
+0x34,0x01,0x11,0x6e,0xbb,0x00,0x40,0x44,0x44,0x44,0x9f,0x45,0x08,0x13,0x0c,0xb4,
+0x00,0x11,0xf5,0x4f,0x01,0x01,0x63,0x00,0xa3,0x23,0x33,0x33,0x9f,0x33,0x33,0x33,
+0x20,0x00,0xaf,0x1b,0x09,0x06,0x7a,0x01,0x21,0x14,0x44,0x01,0x00,0xf2,0x01,0x00,
+0x00,0x3f,0xee,0xee,0xef,0xee,0xee,0xef,0x20,0x00,0x3f,0x10,0x00,0x6f,0x00,0xc4,
+0x06,0x03,0x09,0x00,0x20,0x5f,0x54,0x5a,0x00,0x42,0x7f,0x20,0x00,0x7f,0x3f,0x00,
+0x32,0x20,0x00,0xab,0x33,0x04,0x34,0x20,0x01,0xf6,0xd1,0x07,0x13,0xf1,0x09,0x00,
+0x14,0x5f,0x4c,0x09,0x1f,0x17,0xe8,0x01,0x02,0x01,0x60,0x01,0x00,0x43,0x05,0x10,
+0xeb,0x90,0x00,0x12,0x5f,0xab,0x00,0x00,0xc6,0x00,0x41,0x03,0xf4,0x00,0xd9,0x60,
+0x03,0xf0,0x0c,0x62,0xf3,0x00,0xc9,0x39,0x00,0x00,0x00,0x4f,0x42,0xf3,0x00,0xc9,
+0x2d,0xc0,0x00,0x01,0xda,0x02,0xf3,0x00,0xc9,0x01,0xdc,0x00,0x1d,0xc0,0x09,0x00,
+0x91,0x00,0x2f,0x80,0x05,0x10,0x01,0xc5,0x00,0x75,0x06,0x03,0x23,0x02,0xea,0x59,
+0x00,0x10,0x4f,0x2f,0x05,0xf2,0x0b,0x10,0x00,0x00,0x19,0xff,0x53,0x33,0x36,0xf9,
+0x00,0x00,0x18,0xfc,0x4a,0xd1,0x00,0x3e,0xc0,0x00,0x00,0x0a,0x50,0x00,0xae,0x58,
+0xf9,0x25,0x00,0x30,0x3e,0xff,0xb1,0x07,0x00,0xf2,0x04,0x25,0x8e,0xfc,0x79,0xff,
+0xb6,0x31,0x00,0x8f,0xff,0xc7,0x20,0x00,0x06,0xbe,0xff,0xf2,0x25,0x20,0x0b,0x01,
+0x10,0x50,0xf4,0x06,0x31,0x00,0x02,0x50,0x5d,0x05,0x41,0xb0,0x00,0x00,0x6f,0x9e,
+0x07,0x10,0xf7,0x90,0x05,0x10,0x00,0x7b,0x03,0x12,0x40,0x13,0x00,0x00,0x40,0x0a,
+0x12,0xfd,0x13,0x00,0x62,0xfb,0x55,0x5d,0xb0,0x6f,0x00,0x97,0x03,0x30,0xf8,0x06,
+0xf1,0x50,0x05,0xf0,0x15,0xb0,0x00,0x3f,0x40,0x6f,0xf7,0x00,0x00,0x09,0xf5,0x40,
+0x07,0xf0,0x06,0xf7,0xfa,0x00,0x00,0xc7,0x7f,0x80,0xdb,0x00,0x6f,0x04,0xfc,0x10,
+0x00,0x00,0x4e,0xdf,0x50,0x06,0xf0,0x03,0xec,0xec,0x07,0x40,0xd0,0x00,0x6f,0x00,
+0x8f,0x02,0x23,0x06,0xf5,0x5f,0x00,0x23,0x02,0xfa,0x5f,0x00,0x23,0x02,0xed,0x72,
+0x00,0x32,0x06,0xfe,0x20,0x13,0x00,0x33,0x0b,0xfc,0x10,0x13,0x00,0x11,0x67,0x6d,
+0x00,0x02,0xcf,0x00,0x23,0x0a,0xa0,0x08,0x00,0x40,0xf7,0x33,0x34,0x10,0x8e,0x05,
+0x02,0x33,0x06,0xf2,0x07,0x00,0x6e,0xc2,0x00,0x00,0x9f,0x30,0x00,0x04,0xdf,0x85,
+0x10,0x00,0x8f,0x60,0x00,0x00,0x3a,0x11,0xce,0x41,0xbf,0x97,0x01,0x31,0x9f,0xec,
+0x30,0x62,0x00,0xf0,0x0b,0x8e,0xf8,0x1c,0xe1,0x00,0x00,0x04,0x8c,0xfe,0x70,0x1c,
+0xf9,0x55,0x56,0x22,0xfe,0x94,0x00,0x3d,0xfe,0xee,0xee,0xfa,0x01,0x00,0x00,0xa9,
+0x03,0xf0,0x03,0xbf,0x10,0x00,0x17,0xee,0x63,0x00,0x00,0x9f,0x50,0x00,0x0d,0xe6,
+0x04,0xf9,0x01,0xaf,0x60,0xbe,0x06,0x41,0x04,0xec,0xee,0x40,0x3d,0x00,0x30,0x7e,
+0xfa,0x10,0x2e,0x01,0xa1,0x7d,0xfe,0x93,0x00,0x00,0x00,0x4c,0xff,0xfe,0xa4,0x5b,
+0x00,0x26,0xa7,0x41,0xe7,0x01,0x14,0x2d,0x05,0x02,0x24,0x02,0xf5,0x13,0x00,0x14,
+0x2f,0x13,0x00,0x02,0xce,0x05,0x01,0x2b,0x02,0x01,0x77,0x01,0x95,0x57,0x77,0x77,
+0x7a,0xf8,0x77,0x77,0x77,0x60,0x96,0x0b,0x00,0x16,0x00,0x24,0x0d,0xff,0x42,0x00,
+0x14,0xfa,0x63,0x02,0x33,0x7f,0x1c,0xc0,0xb3,0x06,0x13,0xb0,0x65,0x02,0x42,0x07,
+0xf3,0x00,0xde,0xac,0x05,0x10,0xfa,0x03,0x00,0x00,0x2e,0x00,0x50,0xee,0x10,0x00,
+0x08,0xf9,0x12,0x00,0x50,0xee,0x20,0x00,0x00,0x0a,0x09,0x02,0x20,0xfd,0x20,0x23,
+0x01,0x42,0xfd,0x50,0x0b,0xf8,0x82,0x02,0x33,0xed,0x00,0x12,0x1f,0x0b,0x01,0x7f,
+0x00,0x24,0x4e,0x10,0x98,0x00,0x23,0xf1,0x00,0x47,0x03,0x40,0x7f,0x54,0x44,0x44,
+0xf5,0x0c,0x03,0xfa,0x03,0xc0,0x00,0x0d,0x91,0x11,0x5f,0x31,0x11,0x8f,0x00,0x00,
+0x00,0xd8,0x26,0x00,0x10,0x07,0x13,0x00,0x10,0x80,0xad,0x07,0x11,0x7f,0x13,0x00,
+0x24,0x06,0xf0,0x13,0x00,0x11,0x8f,0x70,0x03,0x05,0x34,0x04,0x91,0x05,0x55,0x55,
+0x56,0xff,0xf6,0x55,0x55,0x55,0xbe,0x00,0x23,0x3f,0x70,0x68,0x07,0x22,0xa0,0x7f,
+0x6f,0x02,0x51,0x2e,0xd1,0x00,0xce,0x20,0x1b,0x00,0xa0,0xd2,0x00,0x01,0xde,0x60,
+0x00,0x00,0x06,0xdf,0xa0,0xa3,0x01,0x41,0xd6,0x10,0x0d,0xfa,0xa6,0x01,0x43,0x4b,
+0xff,0x20,0x31,0xab,0x00,0x62,0x30,0x00,0x00,0x44,0x00,0x3c,0xab,0x00,0x24,0x0d,
+0xc0,0xab,0x00,0x23,0xf6,0x00,0x86,0x08,0x75,0x9f,0x87,0x79,0xf8,0x77,0x77,0x72,
+0x83,0x0c,0x43,0x50,0x00,0x09,0xf2,0xd1,0x00,0x22,0x05,0xf8,0x58,0x08,0x34,0x00,
+0x00,0x4a,0xc8,0x02,0x50,0x05,0x66,0x66,0x66,0xbf,0xdc,0x07,0x23,0x00,0xef,0xab,
+0x00,0x01,0x8d,0x07,0x23,0xfe,0xe1,0x0a,0x01,0x33,0x8f,0x2e,0x80,0x55,0x03,0x32,
+0xa0,0x6f,0x40,0x39,0x03,0x41,0xd0,0x00,0xbf,0x30,0x1b,0x00,0xa0,0xd2,0x00,0x00,
+0xcf,0x70,0x00,0x00,0x17,0xef,0x90,0x77,0x00,0x25,0xd7,0x20,0xab,0x00,0x26,0x10,
+0x32,0xab,0x00,0xf0,0x1d,0x6c,0x00,0x01,0x23,0x57,0xac,0x50,0x00,0x44,0x07,0xd1,
+0xff,0xfe,0xcb,0x97,0x62,0x00,0x05,0xe1,0x7d,0x05,0x30,0x59,0x00,0x0d,0x70,0x00,
+0x0d,0x77,0xd0,0x6d,0x01,0xf2,0x09,0xc0,0x00,0x00,0x68,0x7d,0x00,0xd6,0x0b,0x56,
+0xf4,0xc7,0x01,0xb2,0xd0,0x25,0x32,0x22,0x2e,0x92,0x20,0x00,0x00,0xad,0x3f,0xd3,
+0x0b,0x50,0x18,0xff,0xd0,0x07,0xa0,0x52,0x01,0xf0,0x02,0x0e,0xc4,0x7d,0x00,0x1c,
+0xc0,0x00,0xd8,0x00,0x00,0x20,0x07,0xd0,0x00,0x1a,0x23,0x4e,0x45,0x01,0x61,0x7d,
+0x00,0x4d,0x20,0xcd,0xb2,0xc2,0x01,0x21,0x08,0xf1,0x11,0x02,0x04,0x3a,0x02,0x00,
+0xf8,0x06,0x31,0x8f,0x8f,0x61,0xfd,0x06,0x41,0x00,0x7f,0x80,0x9f,0x27,0x02,0xa0,
+0x38,0xdf,0x60,0x00,0x7f,0xc7,0x30,0x00,0x0d,0xff,0x41,0x0c,0x52,0x29,0xef,0xfd,
+0x00,0x43,0xab,0x00,0x20,0x25,0x40,0x70,0x04,0x14,0x90,0x8f,0x02,0x12,0xf9,0x55,
+0x01,0x41,0x66,0x66,0x9f,0x96,0x1d,0x01,0x16,0x8f,0x1d,0x01,0x15,0x03,0xc7,0x02,
+0x24,0xdb,0x00,0x8e,0x02,0xf0,0x03,0x20,0xcf,0xff,0xff,0xff,0xb0,0x00,0x00,0x1f,
+0x90,0x04,0x55,0x55,0x5d,0xf3,0x00,0x00,0x1d,0xd9,0x02,0x20,0x2c,0xd3,0x88,0x03,
+0x40,0x20,0x00,0x00,0x2f,0x9d,0x09,0xd2,0xe6,0xf2,0x01,0x11,0x14,0xf4,0x11,0x11,
+0x00,0x81,0x3f,0x27,0xff,0xeb,0x07,0x91,0x03,0xf2,0x13,0x33,0x36,0xf6,0x33,0x33,
+0x10,0xeb,0x0d,0x23,0x3f,0x30,0x75,0x06,0x23,0x03,0xf3,0x51,0x05,0x00,0x67,0x05,
+0x01,0x13,0x00,0x33,0x1f,0xff,0xb0,0x6b,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x63,
+0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x24,0x0c,0xc0,0x0a,0x00,0x20,0x5f,0x50,
+0x06,0x00,0xc0,0x6e,0xee,0xee,0xef,0xff,0xee,0xee,0xee,0x30,0x06,0xf6,0x66,0x01,
+0x00,0x42,0x68,0xf3,0x00,0x6f,0x20,0x00,0xfe,0x07,0x2f,0x30,0x06,0xf0,0x35,0x55,
+0x55,0x55,0x55,0x32,0xf3,0x00,0x13,0x0a,0xff,0xff,0xff,0xff,0xf8,0x03,0x00,0x00,
+0x01,0x00,0x22,0x0e,0xff,0x01,0x00,0xf2,0x03,0xfb,0x00,0x56,0x66,0x6e,0xb6,0x66,
+0xf9,0x66,0x66,0x40,0x00,0x00,0x00,0xf7,0x00,0x0f,0x50,0x47,0x00,0x31,0x40,0x00,
+0xf5,0x09,0x00,0x20,0x09,0xe0,0x13,0x00,0xf8,0x11,0x37,0x00,0x00,0x05,0xf7,0x00,
+0x00,0xf5,0x00,0x05,0xf0,0x00,0x4b,0xfa,0x00,0x00,0x0f,0xa5,0x45,0xbc,0x00,0xdf,
+0xc5,0x00,0x00,0x00,0x8f,0xff,0xfe,0x50,0x02,0x10,0x5a,0x00,0x05,0xb5,0x00,0x24,
+0x0a,0xd0,0x0a,0x00,0x21,0x4f,0x50,0xbb,0x00,0x03,0x73,0x00,0x13,0x50,0xb5,0x00,
+0x24,0x66,0xf5,0xb5,0x00,0x42,0x0f,0x50,0x06,0xf0,0x3c,0x00,0x41,0xf5,0x00,0x02,
+0x0f,0x25,0x00,0xa1,0x02,0x00,0x00,0x00,0x44,0x44,0x7f,0x64,0x44,0x40,0x19,0x00,
+0x22,0x03,0xf3,0x2a,0x00,0x42,0xc9,0x00,0x3f,0x30,0x33,0x00,0xf0,0x00,0x70,0x03,
+0xf8,0x66,0x66,0x50,0x00,0x00,0x03,0xf5,0x00,0x3f,0xfe,0xee,0xec,0x8b,0x00,0x13,
+0xc0,0x26,0x00,0x32,0x0e,0xbf,0x80,0x26,0x00,0x41,0x08,0xf2,0x5f,0xb6,0x13,0x00,
+0xf8,0x05,0x05,0xf8,0x00,0x5e,0xff,0xa8,0x76,0x66,0x66,0x00,0xea,0x00,0x00,0x06,
+0x9d,0xef,0xff,0xff,0xc0,0x01,0xb4,0x00,0x14,0x06,0x60,0x01,0x20,0x03,0xf6,0x06,
+0x00,0x14,0x6f,0xaa,0x00,0xe0,0x6f,0x33,0x33,0x34,0x53,0x33,0x33,0x4f,0x50,0x6f,
+0x00,0x00,0x04,0xf1,0xa9,0x00,0xf1,0x01,0x49,0x44,0x44,0x47,0xf6,0x44,0x44,0x59,
+0x30,0x00,0xbd,0xdd,0xde,0xfe,0xdd,0xdd,0xe4,0x00,0x21,0x04,0xf1,0x3d,0x00,0xf2,
+0x00,0x7e,0xee,0xee,0xfe,0xee,0xee,0x90,0x00,0x00,0x24,0x44,0x48,0xf4,0x44,0x44,
+0x83,0x00,0x10,0xe0,0x06,0x00,0x13,0xaf,0x51,0x00,0x71,0xd0,0x34,0x44,0x44,0xbf,
+0x9f,0x74,0x1c,0x00,0x40,0x07,0xf7,0x0b,0xe2,0x1c,0x00,0xf0,0x04,0x02,0xbf,0x70,
+0x01,0xbf,0x60,0x00,0x00,0x05,0xbf,0xc3,0x00,0x00,0x08,0xfe,0x84,0x00,0x9f,0xb4,
+0x17,0x00,0x33,0x18,0xdf,0xb0,0xa3,0x00,0x0a,0x5f,0x01,0x03,0x52,0x00,0x96,0x00,
+0x22,0x22,0x22,0x5f,0x82,0x22,0x22,0x20,0x57,0x01,0x30,0x05,0xf2,0x22,0x01,0x00,
+0xf0,0x2a,0x23,0xf5,0x00,0x5f,0x00,0x4d,0x30,0x00,0x5b,0x10,0x0f,0x50,0x01,0x40,
+0x4f,0x90,0x02,0x01,0xbf,0x60,0x41,0x00,0x00,0x8f,0x90,0x04,0xf7,0x00,0x7f,0xa0,
+0x00,0x00,0xdf,0x60,0x02,0xee,0xe3,0x00,0x3e,0xb0,0x00,0x05,0x20,0x04,0xea,0x09,
+0xe4,0x00,0x23,0x00,0x00,0x00,0x07,0xf9,0x00,0x07,0xf9,0x56,0x00,0xa2,0x3c,0xf5,
+0x00,0x00,0x03,0xdf,0x81,0x00,0x04,0xbf,0x55,0x00,0xe0,0xf8,0x00,0xdc,0x4e,0xa5,
+0x55,0x55,0x55,0xae,0x19,0x90,0x01,0x00,0xe7,0x2a,0x00,0x10,0xe0,0x61,0x01,0x10,
+0x70,0xee,0x00,0x00,0x30,0x00,0x64,0xe9,0x44,0x44,0x44,0x4a,0xe0,0x50,0x02,0x10,
+0xfd,0xc3,0x01,0x10,0x81,0x18,0x00,0x60,0x6d,0x00,0x00,0x00,0x0d,0xb0,0x5a,0x01,
+0x12,0xf0,0x4e,0x02,0x10,0x00,0xec,0x01,0x50,0xaa,0xaa,0xda,0xaa,0x10,0x13,0x00,
+0x90,0x09,0x99,0x99,0xab,0xa5,0x55,0x55,0x9f,0x55,0x3d,0x01,0x10,0xf2,0x1e,0x01,
+0x52,0xf2,0x00,0x50,0x00,0x7e,0x26,0x00,0x51,0x1e,0xa0,0x0b,0xb0,0x01,0x39,0x00,
+0x42,0x3f,0x90,0xf6,0x03,0xda,0x02,0x51,0x5f,0xbf,0x10,0x0b,0xc0,0x4c,0x00,0x60,
+0x7f,0xb0,0x00,0x2f,0x40,0x6f,0x38,0x00,0x40,0xfe,0x10,0x00,0xba,0x13,0x00,0x51,
+0x01,0xeb,0xec,0x00,0x02,0x26,0x00,0x32,0xae,0x14,0xf6,0x72,0x00,0x40,0xbf,0x40,
+0x0a,0x60,0x4c,0x00,0x20,0x01,0xdf,0x7a,0x00,0x60,0x26,0x6b,0xe0,0x00,0x08,0x20,
+0x4a,0x01,0x2e,0xff,0xd6,0x0c,0x03,0x03,0xb6,0x02,0x14,0xf6,0x0a,0x00,0x2f,0x1f,
+0x60,0x13,0x00,0x05,0x60,0x18,0x30,0x01,0xf6,0x00,0x29,0x4f,0x02,0x60,0xf4,0x00,
+0x1f,0x60,0x02,0xf7,0xd9,0x01,0x00,0x26,0x00,0x60,0x0a,0xf1,0x00,0x00,0x0e,0xa0,
+0x26,0x00,0x20,0x2f,0x80,0x42,0x02,0x00,0x39,0x00,0x41,0xaf,0x10,0x00,0xaf,0x39,
+0x00,0x20,0x02,0xf7,0x16,0x00,0x00,0x13,0x00,0x42,0x0c,0xe0,0x0c,0xe1,0x4c,0x00,
+0x32,0x6f,0x30,0x95,0x5f,0x00,0x24,0x02,0xf5,0x5f,0x00,0x18,0x01,0x72,0x00,0x43,
+0x04,0x66,0x8f,0x50,0xef,0x03,0x2e,0xfe,0xa1,0xac,0x00,0x14,0x7e,0x09,0x00,0x2b,
+0x07,0xe0,0x13,0x00,0x61,0x0c,0x60,0x07,0xe0,0x00,0x5b,0x55,0x01,0x31,0x00,0x7e,
+0x00,0xa2,0x00,0x10,0xcb,0x26,0x00,0x81,0x07,0xf2,0x00,0x00,0x4f,0x30,0x00,0x7e,
+0x95,0x01,0x21,0x1e,0xa0,0x39,0x00,0x42,0x4f,0x40,0x09,0xf2,0x39,0x00,0x32,0xbc,
+0x00,0x34,0x4c,0x00,0x22,0x02,0x20,0x4c,0x00,0x22,0x03,0xf6,0x87,0x00,0x33,0x90,
+0x03,0xfb,0x60,0x00,0x23,0x05,0xec,0x09,0x00,0x22,0x3c,0xf9,0x08,0x00,0x30,0x27,
+0xcf,0xc3,0x07,0x00,0x51,0x24,0x79,0xdf,0xfa,0x40,0xc4,0x00,0x23,0xff,0xc9,0xb3,
+0x00,0x17,0x32,0xaa,0x00,0x23,0x3b,0x20,0x09,0x00,0x14,0x6f,0x12,0x00,0x12,0x9d,
+0x4f,0x00,0x30,0x66,0x66,0xdd,0x02,0x04,0x23,0x62,0x0d,0xbd,0x02,0x11,0xf5,0xb3,
+0x00,0x12,0x00,0x73,0x04,0x14,0xd0,0xa4,0x04,0x14,0x80,0x40,0x04,0x31,0x86,0x66,
+0x66,0xed,0x03,0x21,0xbc,0xcf,0x46,0x03,0x33,0x00,0x02,0xf4,0x4a,0x00,0x23,0x0b,
+0xd0,0x09,0x00,0x22,0x4f,0x50,0x09,0x00,0x23,0x01,0xea,0x65,0x00,0x23,0x1d,0xd0,
+0x09,0x00,0xc3,0x5e,0x20,0x45,0x55,0x55,0xbe,0x55,0x55,0x54,0x02,0x00,0xcf,0xf3,
+0x04,0x20,0x00,0x39,0x9c,0x00,0x10,0x30,0xb7,0x00,0xf3,0x01,0x90,0x00,0x00,0xcd,
+0x00,0x00,0x00,0x55,0x5b,0xf6,0x55,0x58,0xf8,0x55,0x50,0x01,0x90,0x00,0x11,0xe0,
+0xdd,0x02,0x02,0x06,0x01,0x92,0x44,0x45,0xf9,0x44,0x44,0x44,0x00,0x00,0x2f,0x1b,
+0x00,0x01,0x77,0x00,0x11,0xc0,0xc6,0x00,0x30,0x55,0x55,0x6f,0x1d,0x03,0x14,0x53,
+0x4d,0x05,0x63,0xf9,0x00,0x00,0x05,0xf5,0x00,0x89,0x05,0x20,0xee,0xee,0xa1,0x05,
+0xb3,0x00,0x01,0xeb,0x26,0x66,0xce,0x66,0x66,0x10,0x00,0x6e,0xab,0x00,0x32,0x1b,
+0xfb,0x10,0x09,0x00,0xb2,0x0b,0x60,0xce,0xee,0xee,0xff,0xee,0xee,0xe8,0x00,0x00,
+0x10,0x05,0xf3,0x0c,0x63,0x00,0x48,0x00,0x01,0xe4,0x00,0x08,0x50,0x00,0x04,0xf7,
+0x00,0x1f,0x50,0x07,0xf5,0x00,0x00,0x09,0xc0,0x01,0xf5,0x00,0xd7,0x00,0x04,0x61,
+0x00,0x40,0xf6,0x4f,0x54,0x44,0x01,0x00,0x40,0x4f,0x64,0xf0,0x02,0xec,0x03,0xd1,
+0x10,0xe6,0x4f,0x06,0xfe,0xee,0xee,0xee,0xf7,0x0e,0x60,0x10,0x6f,0x99,0x03,0x70,
+0x10,0x00,0x06,0xf3,0x33,0x33,0x33,0xfa,0x01,0x52,0x5d,0xdd,0xdf,0xed,0xdd,0xba,
+0x02,0x11,0xf7,0x33,0x05,0x02,0x44,0x00,0x90,0x40,0x00,0xf8,0x55,0x55,0xfa,0x55,
+0x57,0xf4,0xd9,0x05,0x23,0x0f,0x70,0xeb,0x05,0x33,0xf7,0x00,0x02,0x11,0x00,0xe2,
+0x55,0x8f,0x30,0x00,0xc4,0x00,0x00,0xf7,0x09,0xed,0x90,0x00,0x06,0x66,0x01,0x00,
+0x23,0x00,0xef,0xc0,0x04,0x01,0x5b,0x02,0x00,0xad,0x02,0x70,0x06,0xe0,0x00,0x4f,
+0x20,0x00,0xf8,0xbd,0x02,0x50,0x04,0xf2,0x00,0x6f,0x20,0xd3,0x00,0xc0,0x4f,0x20,
+0x0d,0xa0,0x00,0x00,0x04,0xf3,0x04,0xf2,0x05,0xf2,0x9e,0x02,0x41,0x10,0x4f,0x20,
+0x46,0xdc,0x00,0x63,0x69,0xf8,0x66,0x66,0x66,0x6e,0xc4,0x00,0x27,0xfe,0x00,0xec,
+0x01,0x13,0x4f,0x21,0x02,0x0f,0x11,0x00,0x0f,0x25,0x00,0x07,0x04,0x07,0x19,0x3f,
+0x4f,0x06,0x41,0x20,0x05,0xf5,0x44,0x01,0x00,0x30,0x40,0x00,0x5f,0x97,0x00,0x00,
+0xc9,0x02,0xf0,0x03,0x05,0xf3,0x55,0x9f,0x55,0x55,0xaf,0x55,0x50,0x00,0x5f,0x7d,
+0xde,0xfd,0xdd,0xde,0xfd,0xdd,0xba,0x06,0x23,0x6e,0x00,0x63,0x04,0x51,0x06,0xe2,
+0x22,0x29,0xe0,0x2a,0x04,0x12,0x6f,0x90,0x00,0x05,0x52,0x03,0x22,0x09,0xc3,0x68,
+0x01,0x91,0x00,0x00,0xba,0x01,0x3f,0x81,0x11,0x13,0xdc,0xed,0x04,0x51,0x6f,0x80,
+0x03,0xdd,0x10,0x75,0x02,0x30,0x4e,0xeb,0xf9,0x6a,0x06,0xf1,0x05,0x00,0x02,0x6a,
+0xef,0xef,0xa6,0x20,0x00,0x0d,0x90,0xdf,0xfd,0x95,0x00,0x49,0xef,0xfe,0x20,0x12,
+0x03,0xa8,0x00,0x2a,0x14,0x50,0xab,0x03,0x14,0x8c,0x09,0x00,0x21,0x02,0xf7,0xa0,
+0x03,0x03,0xb4,0x00,0x42,0xf0,0x00,0xdb,0x55,0x01,0x00,0xf0,0x01,0x00,0x0d,0x80,
+0x02,0x50,0x0a,0x60,0x04,0x20,0x00,0x00,0xd8,0x00,0x9c,0x00,0xd8,0x65,0x05,0x70,
+0x0d,0x80,0x0e,0x80,0x0d,0x80,0x4f,0x13,0x00,0xf0,0x1b,0x03,0xfd,0x10,0xd8,0x0a,
+0xf7,0x00,0x00,0x0d,0x70,0xdc,0xbd,0x1d,0x86,0xf7,0xe9,0x00,0x00,0xe7,0xbf,0x20,
+0xb9,0xdb,0xf9,0x02,0xea,0x00,0x0f,0x69,0x40,0x01,0x0d,0x86,0x00,0x02,0x70,0x00,
+0xf4,0x04,0x44,0x44,0xea,0x00,0x01,0x32,0x3f,0x31,0xff,0x87,0x05,0x01,0x2a,0x05,
+0x10,0xd8,0x72,0x00,0x20,0xac,0x00,0x50,0x00,0x00,0xfe,0x01,0xb3,0x71,0x33,0x33,
+0x33,0xea,0x33,0x33,0x33,0x04,0xf1,0x5f,0x85,0x00,0x1b,0x02,0x58,0x04,0xf1,0x05,
+0x03,0x7b,0xc0,0x02,0xee,0xee,0xd0,0x26,0x8a,0xdf,0xfe,0xa5,0x00,0x15,0x56,0xf8,
+0x06,0xdb,0x96,0xf7,0xbd,0x03,0x13,0x10,0xf3,0x05,0x01,0x91,0x03,0x01,0x06,0x06,
+0x60,0xe1,0x00,0x0c,0x50,0x0e,0x70,0x6f,0x03,0xf1,0x07,0x34,0x10,0xe6,0x00,0xed,
+0xcc,0xc6,0x00,0x8f,0xff,0xf9,0x0e,0x60,0x0e,0xc8,0x88,0x40,0x00,0x00,0x0e,0x60,
+0xe6,0x26,0x00,0x70,0x35,0x01,0xf3,0x0e,0x60,0x0e,0x70,0x2d,0x02,0x22,0x5f,0x00,
+0x13,0x00,0x32,0x0e,0x6b,0xa0,0x13,0x00,0xe0,0x00,0x6f,0xf4,0x00,0xee,0xdd,0xfe,
+0xdd,0xd9,0x00,0x00,0xef,0x30,0x05,0x0a,0x01,0x53,0x40,0x00,0x6f,0xef,0x71,0xf4,
+0x01,0xf9,0x04,0xa0,0x8f,0xfc,0x97,0x65,0x55,0x55,0x50,0x3f,0xc0,0x00,0x16,0xad,
+0xef,0xff,0xff,0xfa,0x00,0x60,0xa9,0x00,0x32,0xc3,0x18,0x10,0x09,0x00,0x33,0xf4,
+0x1c,0xd2,0x09,0x00,0x30,0x00,0xbd,0x00,0x46,0x00,0x68,0x57,0xf9,0x55,0x68,0x50,
+0xdf,0xc6,0x03,0x24,0x00,0xf7,0x37,0x00,0x40,0xe8,0x00,0x00,0x00,0x37,0x03,0x20,
+0x20,0xca,0x45,0x02,0x50,0xff,0xff,0xff,0xf1,0xac,0x3b,0x00,0x51,0x33,0xda,0x33,
+0x30,0x7f,0x21,0x00,0x13,0xd8,0x6f,0x02,0x00,0x09,0x00,0x22,0x1f,0x70,0x09,0x00,
+0x00,0x7c,0x09,0xf2,0x0e,0x70,0x00,0x00,0xd9,0x25,0x87,0x07,0xf2,0x00,0xf3,0x02,
+0x58,0xff,0xfe,0xb5,0x00,0xeb,0x02,0xf1,0xaf,0xfc,0x95,0x20,0x00,0x00,0x5f,0xbb,
+0xd0,0x23,0x41,0x08,0xf1,0x04,0xde,0x50,0x14,0x44,0x44,0x42,0x03,0x33,0x33,0x33,
+0x05,0xff,0xff,0xff,0x90,0xef,0xff,0xff,0xf3,0xaf,0x08,0x11,0x00,0xb1,0x08,0x20,
+0x0c,0x90,0xc3,0x08,0xf0,0x07,0x05,0x55,0x55,0xd9,0x02,0x55,0x55,0x8f,0x30,0xef,
+0xee,0xee,0x80,0x7f,0xee,0xee,0xe2,0x0e,0x60,0x00,0x00,0x08,0x54,0x03,0x00,0x35,
+0x04,0x11,0x9c,0x46,0x05,0x20,0xff,0xfb,0xb5,0x09,0xf2,0x35,0x60,0x54,0x44,0x4c,
+0xb0,0x34,0x44,0x44,0xf5,0x0e,0xc7,0x10,0xb9,0x06,0xe9,0x30,0x0f,0x50,0x16,0xcf,
+0x2d,0x80,0x03,0x9f,0x91,0xf4,0x00,0x00,0x89,0xf7,0x00,0x00,0x39,0xcf,0x21,0x5a,
+0xfe,0x9f,0x50,0x38,0xdf,0xa8,0xf1,0xce,0x93,0x03,0xf3,0x1f,0xc6,0x10,0x6f,0x01,
+0x00,0x43,0xbf,0x00,0x10,0x10,0x1b,0xc0,0x00,0x0f,0xfe,0x60,0x00,0x0e,0xff,0xf4,
+0xf4,0x00,0x26,0x12,0x20,0x37,0x01,0x50,0x9f,0xff,0xfc,0x00,0xff,0x9e,0x00,0x50,
+0x24,0x44,0xac,0x00,0xf7,0x3f,0x04,0x00,0xa1,0x02,0x00,0x09,0x00,0x01,0xaa,0x02,
+0x82,0xff,0xee,0xee,0xec,0x00,0x3b,0xbb,0xec,0xfa,0x09,0x41,0x4f,0x44,0x43,0x00,
+0x4c,0x02,0x50,0x4f,0x00,0x00,0x00,0xf6,0x24,0x00,0x14,0x5e,0xa1,0x06,0x41,0x5e,
+0x55,0x54,0xaf,0x41,0x02,0xf0,0x14,0x6e,0xee,0xfc,0x29,0xe4,0x8f,0x44,0x45,0x40,
+0x00,0x00,0x9b,0x06,0xe0,0x0d,0x80,0x5f,0x20,0x00,0x00,0xba,0x06,0xe0,0x04,0xf9,
+0xe4,0x00,0x00,0x00,0xc8,0x06,0xe0,0x00,0x8f,0x40,0x3d,0x00,0xfa,0x09,0x07,0xe0,
+0x38,0x0a,0xf5,0x00,0x15,0x58,0xf3,0x0b,0xfe,0xe8,0x00,0x8f,0xc1,0x0e,0xff,0x90,
+0x0b,0xa4,0x00,0x00,0x03,0x70,0x7e,0x02,0x10,0x2b,0x90,0x05,0xf1,0x02,0xcf,0xff,
+0xfe,0x00,0x0a,0xd0,0x01,0x00,0x00,0x04,0x55,0x59,0xf0,0x04,0xf4,0x00,0xe7,0xea,
+0x03,0x50,0x01,0xe8,0x00,0x04,0xf4,0x71,0x05,0xf0,0x02,0xf1,0xcf,0x89,0xac,0xdf,
+0xe1,0x00,0x26,0x66,0xaf,0x1f,0xdb,0xab,0x75,0x4c,0xa0,0x06,0xe4,0x01,0x60,0x02,
+0xf3,0x00,0x32,0x00,0x8b,0xc9,0x01,0xf0,0x11,0x5f,0x63,0x33,0x00,0x0a,0x90,0x00,
 0x00,0xff,0xee,0xff,0xee,0xf2,0x00,0xda,0x55,0x55,0x0f,0x40,0x2f,0x30,0x2f,0x20,
 0x0b,0xbb,0xbd,0xf1,0xf4,0x02,0xf3,0x02,0xf2,0x4c,0x00,0x60,0x0f,0xed,0xef,0xed,
-0xef,0x20,0x94,0x02,0x52,0x44,0x46,0xf7,0x47,0x40,0x7c,0x37,0x43,0x2f,0x31,0xf7,
-0x00,0x9c,0x28,0x90,0x18,0xf2,0x00,0x03,0x45,0xf7,0x7b,0xcd,0xef,0xed,0x0b,0x97,
-0x7f,0xfc,0x16,0x98,0x76,0x43,0x21,0x4f,0x10,0xf3,0x1f,0x00,0x70,0x2a,0x30,0x01,
-0x07,0xc0,0xdd,0x23,0x40,0x04,0xf4,0x2f,0x80,0x1e,0x03,0x60,0xcd,0x00,0x7f,0x20,
-0x06,0xf1,0x84,0x06,0xd0,0xe9,0x00,0x6f,0x10,0x0d,0xb0,0x00,0x07,0x70,0x06,0xf1,
-0x02,0xc2,0xf8,0x10,0x53,0x8f,0x43,0x33,0x33,0x08,0x0d,0x21,0x21,0x12,0x22,0xe2,
-0x1e,0x13,0x40,0x27,0x25,0x02,0x7c,0x18,0x22,0x4f,0x40,0x5c,0x05,0x00,0xc5,0x03,
-0x03,0xed,0x2c,0x07,0x45,0x25,0x23,0x2f,0x4d,0x3c,0x00,0x02,0x88,0x05,0x13,0x8f,
-0xd1,0x24,0x00,0x0c,0x1b,0x10,0xce,0xea,0x7f,0xc1,0x00,0x03,0xe9,0x00,0x05,0x6c,
-0xc6,0x68,0xf7,0x50,0x05,0xfa,0xee,0x98,0x41,0x4f,0x10,0x1a,0xf9,0x2b,0x10,0x53,
-0x04,0xf1,0x0c,0xe5,0x00,0x13,0x00,0x32,0x11,0x00,0x02,0x13,0x00,0x01,0xa1,0x4e,
-0x50,0x55,0xcc,0x55,0x8f,0x65,0x8d,0x2a,0x11,0x2f,0xc3,0x15,0x21,0x08,0xf8,0x54,
-0x15,0x40,0x4f,0x10,0x3d,0xe5,0xa2,0x04,0x50,0x80,0x04,0xf1,0x06,0xa1,0xe2,0x05,
-0x02,0x6d,0x0e,0x70,0x0a,0xe1,0x00,0x2f,0x30,0x04,0xf1,0x1b,0x93,0x00,0x7a,0x0a,
-0x21,0x4f,0x10,0x84,0x25,0x10,0xe8,0xf3,0x0a,0x21,0x3d,0xf5,0xe3,0x54,0xce,0x4f,
-0x13,0xbf,0xb1,0x00,0x00,0x0c,0x40,0x00,0x04,0xf1,0x5c,0x72,0x55,0x00,0x62,0x27,
-0x21,0x0f,0xfe,0xca,0x1b,0x11,0xdc,0x5d,0x0c,0x42,0xd8,0x00,0x1d,0xd1,0x12,0x00,
-0x32,0x05,0xec,0x10,0x12,0x00,0x20,0x8f,0x80,0xdc,0x8f,0x41,0xef,0xee,0xe7,0x14,
-0xa8,0x31,0x12,0xaa,0xe8,0x0c,0x10,0xde,0x1c,0x07,0x32,0x20,0x07,0xf6,0x30,0x1f,
-0x31,0x02,0xcf,0x60,0x3e,0x05,0x40,0xf4,0x7f,0xd3,0x00,0x27,0x37,0x43,0x02,0xf4,
-0x28,0x00,0x09,0x00,0x00,0xdd,0x16,0x01,0x1b,0x00,0x00,0x23,0x48,0x50,0x04,0x80,
-0x8d,0x08,0x10,0x35,0x6d,0xf1,0x06,0x1d,0x80,0x8d,0x08,0xc0,0x01,0xaf,0x70,0x00,
-0xac,0x12,0x9d,0x00,0xd6,0x8f,0xe4,0x00,0x00,0x11,0x2f,0xf8,0xec,0x5e,0x09,0x4d,
-0x0b,0x13,0xa0,0x44,0x74,0x22,0x05,0xf4,0xde,0x79,0x00,0x7b,0x07,0x32,0x45,0x55,
-0xcd,0x32,0x3a,0x12,0x0b,0x56,0x1e,0x10,0xc5,0xd4,0x0a,0x13,0x9c,0x8c,0x1a,0x02,
-0x26,0x00,0x33,0x00,0x7f,0x3d,0x73,0x1e,0x40,0x5f,0xe0,0x55,0x55,0x49,0x30,0x33,
-0x00,0x6f,0xfe,0x49,0x30,0x42,0x3f,0xb7,0xe0,0x35,0x13,0x00,0x22,0x80,0x7e,0xe4,
-0x10,0x01,0x95,0x06,0x12,0x51,0x5c,0x30,0x10,0x7e,0x51,0x04,0x21,0x0f,0x60,0x71,
-0x09,0x23,0x1e,0x90,0x13,0x00,0x23,0x00,0x5c,0x13,0x00,0x00,0xf9,0x02,0x13,0xf5,
-0x91,0x06,0x11,0x8f,0x45,0x29,0x53,0x6a,0x00,0x00,0x2a,0x20,0x2b,0x54,0x21,0x1e,
-0xb0,0x9d,0x0f,0x61,0x90,0x00,0x1d,0xb0,0x00,0xab,0x3a,0x80,0xd2,0x2d,0xa0,0x01,
-0xcd,0x30,0x00,0x09,0x80,0x1e,0x5f,0xfe,0xff,0xfa,0x11,0x09,0x51,0x44,0x4b,0xe5,
-0x09,0xb0,0x2c,0x11,0xc0,0x6e,0x80,0x00,0x2e,0x90,0x00,0x05,0xfe,0x05,0xef,0xed,
-0xef,0x77,0x0d,0xf2,0x08,0xfe,0xe0,0x29,0x76,0xfb,0x21,0x00,0x7f,0x10,0xda,0x6e,
-0x00,0x00,0xbf,0x31,0x11,0x10,0x50,0x02,0x06,0xe0,0x00,0xaf,0x50,0x4a,0x61,0x6e,
-0x03,0xdf,0xf4,0x00,0x0a,0xd7,0x7a,0x50,0xec,0x15,0xe4,0x09,0xe3,0xe9,0x02,0x61,
-0x01,0x00,0x05,0xfd,0xe2,0x00,0xed,0x07,0x21,0x03,0xaf,0xd5,0x24,0xf2,0x06,0x6e,
-0x05,0x9d,0xfa,0x30,0x6e,0xfa,0x61,0x00,0x06,0xe0,0xdb,0x61,0x00,0x00,0x04,0x9d,
-0x20,0x00,0x00,0x89,0x62,0x78,0x00,0x2f,0x18,0x23,0x0b,0xd0,0xe1,0x47,0x12,0x03,
-0x9b,0x07,0x50,0x9f,0x50,0x00,0xdc,0x32,0x72,0x05,0x40,0x08,0x30,0x3f,0xdf,0xc2,
-0x2f,0x00,0x7f,0x27,0x70,0xc6,0x6d,0x83,0x33,0x33,0x8e,0x00,0xa1,0x8b,0xf0,0x05,
-0xd7,0x11,0x11,0x17,0xe0,0x00,0x08,0xfe,0x00,0x0d,0xed,0xdd,0xdd,0xee,0x00,0x09,
-0xfd,0xe0,0x00,0xd6,0x6f,0x00,0xa0,0x02,0xf7,0x6e,0x00,0x0d,0xef,0xfe,0xee,0xed,
-0x00,0xa2,0x00,0x03,0x68,0x49,0x11,0x6e,0x15,0x1b,0x10,0xfa,0x20,0x00,0x31,0x08,
-0xfe,0x91,0x51,0x64,0x60,0x6e,0x09,0xd2,0x1d,0xa2,0x9e,0xe5,0x33,0x00,0xd1,0x0a,
-0x01,0x75,0x48,0xf0,0x0b,0x6e,0x03,0x69,0xdf,0xa6,0xbf,0xd8,0x51,0x00,0x06,0xe0,
-0xac,0x95,0x00,0x00,0x26,0xad,0x20,0x00,0x05,0xb1,0x00,0x77,0x00,0x05,0xa0,0x39,
-0x55,0x51,0x05,0x08,0x80,0x50,0x8b,0x85,0x73,0xf0,0x08,0xf0,0x88,0x1e,0x0a,0x90,
-0x00,0x02,0xec,0x10,0x0f,0x08,0x81,0xe0,0xc7,0x00,0x00,0x1a,0x01,0xe6,0xf0,0x88,
-0x1e,0x0f,0xed,0x14,0xf0,0x18,0x9e,0x0f,0xff,0xff,0xe3,0xf4,0x3c,0x90,0x00,0x3f,
-0x40,0x22,0x22,0x22,0x7f,0x00,0xd5,0x00,0x1e,0xf2,0x14,0x44,0x44,0x3d,0xf3,0x0f,
-0x20,0x0d,0xff,0x25,0xff,0xff,0xfe,0xfc,0x73,0xf0,0x06,0xf5,0xf2,0xa7,0x03,0xc0,
-0x7a,0x7c,0x00,0x02,0x2f,0x20,0x8f,0xff,0xf4,0x03,0xdb,0x60,0xfa,0x29,0x50,0xb1,
-0x1d,0x40,0x0e,0xf1,0x35,0x9d,0x50,0x9a,0x00,0xd5,0x60,0xbc,0x32,0x52,0x60,0x0b,
-0x70,0x0f,0xfa,0x4f,0xf2,0x13,0x00,0xf0,0x05,0xf5,0x03,0xe4,0x2e,0x8b,0xc0,0x00,
-0x02,0xf2,0x9e,0x00,0x01,0x4e,0xb0,0x1e,0xc1,0x00,0x2f,0x29,0x50,0xcd,0x38,0x1f,
-0x2b,0x92,0x0c,0x03,0x14,0x0b,0xfa,0x0b,0x00,0x42,0x28,0x42,0x00,0x5d,0x20,0x00,
-0xbd,0x66,0x03,0x55,0x75,0x22,0x08,0xf5,0x84,0x6b,0x31,0x19,0x30,0x04,0x0f,0x56,
-0x10,0x14,0x45,0x28,0x11,0xdd,0x71,0x0d,0xf0,0x11,0x1f,0x50,0x00,0x9f,0x37,0x60,
-0x00,0x00,0xac,0x01,0xf5,0x00,0x7f,0x60,0x9f,0x10,0x00,0x0e,0x80,0x1f,0x50,0x6f,
-0x70,0x01,0xea,0x00,0x03,0xf3,0x01,0xf5,0x6f,0x90,0x50,0x01,0x50,0xae,0x00,0x1f,
-0xbf,0x90,0xb6,0x0c,0x51,0x1f,0x60,0x02,0xff,0x70,0x3d,0x3f,0x20,0x20,0x03,0x12,
-0x3a,0x41,0x5a,0x02,0xa1,0x00,0xdc,0x2b,0x00,0x43,0x08,0x31,0x7e,0xe5,0x1f,0x57,
-0x0b,0x00,0x68,0x03,0x52,0xfc,0x66,0x66,0x7f,0x90,0xe9,0x77,0x33,0xff,0xff,0xb1,
-0xdf,0x0b,0x05,0x3e,0x0d,0x23,0xea,0x00,0x1f,0x45,0x20,0x6a,0xf7,0x43,0x1a,0x04,
-0xd7,0x0b,0x01,0xca,0x11,0x01,0x99,0x34,0x00,0x85,0x08,0x24,0x08,0xfa,0x5d,0x07,
-0x01,0x6b,0x00,0x00,0x13,0x00,0x21,0x15,0x10,0x5b,0x9c,0x10,0xd8,0xc5,0x05,0x11,
-0x10,0xc1,0x0a,0x22,0x94,0x2f,0x02,0x24,0x40,0xf6,0x0f,0x52,0xf3,0xfd,0x2e,0x00,
-0x58,0x1e,0x00,0xe7,0x21,0x00,0x0a,0x28,0xf0,0x15,0x6f,0x02,0xf3,0x00,0x03,0x13,
-0xf5,0x00,0x6f,0x0b,0xb0,0x2f,0x30,0x00,0x7c,0x0d,0xb0,0x0a,0xc2,0xf5,0x02,0xf3,
-0x00,0x09,0xb0,0x7f,0x01,0xf7,0x06,0x00,0x2f,0x84,0x44,0xd8,0x02,0x40,0xfc,0x12,
-0x11,0xaf,0x1b,0x16,0x17,0x20,0xde,0x0d,0x14,0xa4,0x94,0x10,0x32,0xf5,0x33,0x33,
-0x84,0x13,0x00,0x56,0x63,0x03,0x43,0x7f,0x01,0x73,0x4c,0xa1,0x9f,0xb3,0x33,0x33,
-0xce,0x43,0x31,0x00,0x0b,0xed,0xb9,0x0b,0x11,0xf7,0x4a,0x27,0x02,0xef,0x08,0x02,
-0x20,0x41,0x00,0x93,0x33,0x01,0xef,0x3c,0x05,0x50,0x08,0x14,0xe7,0x54,0x0b,0x10,
-0xf7,0x7d,0x06,0xc0,0x33,0xa6,0x33,0x33,0x31,0x00,0x00,0x33,0x09,0x40,0xae,0x30,
-0x08,0x3a,0xf0,0x06,0xbb,0x0f,0x60,0x0a,0xe1,0x02,0x0d,0xb0,0x04,0xf4,0x0f,0x60,
-0x00,0xc4,0x0d,0x64,0xf4,0x0d,0xb0,0x0f,0xb4,0xe1,0x05,0x50,0xcb,0x05,0x20,0x07,
-0xef,0x87,0x0c,0x20,0x21,0x00,0x6e,0x50,0x11,0x04,0xa4,0x25,0x04,0x2e,0x08,0xd1,
-0x00,0x1f,0x30,0x12,0x22,0x2d,0xa2,0x22,0x21,0x00,0x01,0xf3,0x09,0x1f,0x0c,0xe2,
-0x80,0x01,0x2f,0x97,0x01,0x11,0x1d,0xa1,0x11,0x10,0x00,0xa8,0xf5,0xe3,0x13,0x23,
-0x42,0x0c,0x6f,0x3b,0x20,0x07,0x3e,0xd2,0xe4,0xf3,0x2c,0xcc,0xcc,0xfe,0xcc,0xcc,
-0xc1,0x3f,0x1f,0x30,0x22,0x2a,0x05,0x80,0x71,0xf3,0x00,0xbc,0xcc,0xcc,0xcc,0xc8,
-0x4c,0x00,0x60,0x0d,0x94,0x44,0x44,0x4c,0xa0,0x5f,0x00,0x51,0xd8,0x11,0x11,0x11,
-0xba,0x13,0x00,0x01,0x98,0x51,0x00,0x13,0x00,0x11,0xd7,0x6d,0x05,0x00,0x13,0x00,
-0x41,0xec,0xcc,0xcc,0xce,0x13,0x00,0x51,0xd9,0x44,0x44,0x44,0xca,0x13,0x00,0x44,
-0x70,0x00,0x03,0x3c,0x26,0x00,0x10,0xef,0x42,0x26,0x04,0x9c,0x3b,0x01,0xfb,0x0b,
-0x00,0x85,0x00,0x90,0x02,0x22,0x8e,0x22,0x24,0xf3,0x22,0x25,0xf1,0x3a,0x15,0x60,
-0xfe,0x4f,0x11,0x11,0x4f,0x10,0x1e,0x65,0x11,0x04,0x8a,0x23,0x00,0x0b,0x61,0x20,
-0x4f,0x10,0x03,0x00,0xf0,0x09,0x1f,0xbf,0xdb,0x14,0xf3,0x22,0x26,0xf1,0x00,0x0c,
-0xa6,0xe1,0xcd,0x4f,0xee,0xee,0xef,0x10,0x0b,0xd1,0x6e,0x00,0x34,0xf0,0x6d,0x2f,
-0x10,0xa2,0x4c,0x00,0x40,0x54,0x44,0x7f,0x10,0x5f,0x00,0x53,0x13,0xdd,0xdd,0xdd,
-0xd1,0xe8,0x1c,0x00,0x01,0x5e,0x50,0x7b,0x07,0xb0,0x2e,0xa0,0xf7,0x04,0xf2,0x13,
-0x0d,0x90,0x8c,0x00,0x3f,0x30,0x40,0x9e,0x10,0x05,0xf3,0x08,0xc0,0x00,0x10,0x1f,
-0x31,0xf9,0x00,0xda,0x00,0x8e,0x54,0x44,0x48,0xf0,0x08,0x90,0x01,0x10,0x02,0xdf,
-0xff,0xff,0xcf,0x3a,0x03,0xf7,0x49,0xf2,0x01,0x24,0x44,0x44,0x4e,0xc4,0x44,0x44,
-0x40,0x06,0xdd,0xde,0xdd,0xdd,0xde,0xed,0xdc,0x1e,0x04,0x10,0x8e,0x87,0x18,0x92,
-0x5f,0x73,0x33,0x3e,0xa3,0x33,0x35,0xee,0xee,0x28,0x87,0x03,0xff,0x1f,0x40,0x10,
-0x00,0x02,0xfe,0x27,0x25,0x13,0xfa,0x51,0x24,0x10,0x0b,0x09,0x69,0x01,0x32,0x4d,
-0x1e,0x00,0x11,0x00,0x40,0x11,0x13,0x1a,0xc3,0xf5,0x14,0xf0,0x0d,0x0b,0xa1,0xf4,
-0x07,0xf6,0x00,0x5f,0x30,0x05,0xf2,0x1f,0x40,0x04,0x14,0xc0,0x8e,0x12,0xf8,0x01,
-0xf8,0x32,0x23,0xad,0x00,0xda,0x17,0x00,0x0a,0x1c,0x8a,0x08,0x5d,0x0b,0x00,0x76,
-0x06,0x10,0x4b,0x54,0x07,0xf0,0x01,0x0b,0xc1,0x5b,0x00,0x6e,0x03,0x9f,0x80,0x02,
-0xcc,0x11,0x3e,0xb0,0x6f,0xed,0x93,0x29,0x03,0xf0,0x00,0xed,0xe9,0x6f,0x20,0x00,
-0xa3,0x02,0x21,0x00,0x00,0x35,0x5f,0x43,0x34,0xf4,0x6b,0x0d,0x20,0xe0,0x1c,0x1b,
-0x61,0x51,0xe5,0x00,0x05,0xe0,0x4b,0xaa,0x9a,0x62,0xee,0xee,0xe0,0x6e,0x00,0x5c,
-0x12,0x00,0x41,0x6f,0xaf,0xd7,0x10,0x12,0x00,0xf0,0x04,0x6f,0x62,0x00,0x41,0x00,
-0xe5,0x00,0x06,0xe0,0x6f,0x00,0x00,0xc6,0x00,0xe5,0x02,0xef,0xb0,0x2f,0x47,0x11,
-0xf1,0x15,0x51,0x02,0x20,0x6d,0x11,0x33,0x38,0x30,0x00,0xe7,0x0e,0x60,0x0b,0xb0,
-0x00,0x0d,0xa0,0x06,0xf1,0x0e,0x60,0x01,0x60,0x6b,0x06,0xf2,0x1f,0x70,0x0e,0xa3,
-0x22,0x23,0xca,0x00,0xe8,0x04,0xc4,0x03,0x13,0xd3,0x26,0x38,0x34,0x59,0x05,0x10,
-0x59,0x12,0x24,0xbf,0x70,0xec,0x48,0xc0,0x5e,0xa0,0x00,0x03,0x77,0x77,0x77,0x7b,
-0xf7,0x77,0x9a,0x70,0x2c,0x03,0x10,0xee,0x34,0x89,0x01,0xf7,0x16,0x02,0xec,0x12,
-0x11,0x7f,0x6b,0x14,0x40,0x09,0x70,0x00,0x07,0xfb,0x21,0x20,0xf5,0x01,0xf6,0x95,
-0x70,0x55,0x5b,0xc0,0x0f,0x70,0x6f,0x10,0x27,0x08,0x50,0x9c,0x00,0xca,0x0e,0xa0,
-0xe0,0x2d,0x42,0x0a,0xb0,0x08,0xe7,0x0c,0xa0,0x12,0xab,0x2c,0x8d,0x10,0xca,0x80,
-0x9c,0xf1,0x09,0xfe,0x00,0x02,0x00,0x0f,0x73,0x67,0xf7,0x01,0xbf,0xc0,0x01,0xf1,
-0x04,0xf2,0x4d,0xdb,0x13,0xdf,0x9f,0x60,0x4f,0x00,0xcd,0x6e,0x56,0xcb,0xaf,0x9b,
-0xc0,0x1d,0x50,0x00,0x01,0xc8,0x00,0x00,0x8e,0xe3,0x13,0x05,0xf9,0x03,0x14,0x7b,
-0x70,0x00,0x03,0x56,0x89,0xab,0xdf,0xff,0xea,0x60,0x00,0x08,0xed,0xcb,0xaa,0xf7,
-0xa3,0x35,0x04,0x09,0x00,0x00,0x8b,0x84,0x10,0x68,0x73,0x0e,0x04,0xf9,0x23,0x1e,
-0xfe,0x24,0x00,0x00,0x3a,0x16,0x20,0x14,0xf5,0xfd,0x01,0x05,0xbf,0x17,0x51,0x44,
-0x44,0x44,0x46,0xf7,0x48,0x0e,0x0d,0x2d,0x00,0x06,0x09,0x00,0x43,0x01,0x66,0x69,
-0xf2,0x62,0x28,0x2b,0xfd,0x90,0x43,0x12,0x05,0xfe,0x08,0x03,0xbd,0x20,0x01,0xd7,
-0x15,0x12,0x5f,0x20,0x04,0x41,0x3f,0x20,0x05,0xf6,0x2d,0x20,0x21,0x04,0xf2,0x52,
-0x24,0x10,0xe7,0x5d,0x0b,0x20,0xb5,0xf0,0xf2,0x04,0x42,0x04,0x46,0xf5,0x43,0x13,
-0x00,0x00,0x26,0x00,0x01,0x13,0x00,0x01,0x39,0x00,0x30,0x66,0x66,0x66,0x39,0x00,
-0x22,0x21,0x35,0x26,0x28,0x60,0x48,0xfe,0xfb,0x6f,0x00,0x6f,0xc5,0x12,0x50,0xef,
-0x61,0x08,0xe0,0x02,0x73,0x38,0x42,0x03,0xf2,0x00,0xbc,0x5b,0x73,0x10,0x3f,0xdf,
-0x5d,0x20,0x6f,0x20,0x72,0x00,0x00,0xbb,0x5e,0x11,0xec,0x13,0x00,0x11,0xcd,0x19,
-0x69,0x50,0x03,0x38,0xf1,0x8f,0x40,0x0d,0x72,0x31,0x20,0x9f,0xfa,0x18,0x55,0x28,
-0x05,0xd1,0xbf,0x2f,0x18,0x20,0x3c,0x81,0x02,0x09,0x00,0x11,0x04,0xd4,0x04,0x00,
-0x09,0x00,0xf1,0x03,0xf6,0x56,0xf8,0x55,0xf7,0x01,0x1a,0xb1,0x14,0xf0,0x00,0xf4,
-0x00,0xe7,0x0f,0xff,0xff,0xc4,0x09,0x00,0x81,0x06,0x6c,0xd6,0x54,0xf6,0x66,0xf8,
-0x66,0x24,0x00,0x00,0xf2,0x35,0x01,0x09,0x00,0x01,0x1b,0x00,0x41,0x00,0x0a,0xb2,
-0x44,0x09,0x00,0x41,0x01,0x5d,0xff,0xc4,0x3f,0x00,0x32,0x1f,0xff,0xd3,0x51,0x00,
-0x92,0x03,0x1a,0xb0,0x03,0xc0,0x00,0xf4,0x00,0xa5,0x6c,0x00,0x01,0x12,0x58,0x0c,
-0x09,0x00,0x32,0x02,0x3c,0xa0,0x09,0x00,0x11,0x07,0x10,0x73,0x19,0xf4,0x6b,0x2b,
-0x2b,0x20,0x00,0x4e,0x12,0x00,0xa5,0x06,0x03,0x4d,0x26,0xd4,0x6f,0x00,0x0f,0xa6,
-0x66,0x66,0x66,0x40,0x01,0x17,0xf1,0x10,0xf6,0x83,0x4d,0x02,0x5e,0x5d,0x61,0x05,
-0x5a,0xf5,0x51,0xf9,0x55,0xea,0x39,0x11,0x6f,0xb1,0x05,0x02,0x25,0x14,0x12,0xf6,
-0x4f,0x36,0x20,0x6f,0x16,0xb4,0x35,0x10,0xe6,0xd3,0x18,0x11,0xe4,0x13,0x00,0xc2,
-0x02,0xff,0xff,0x30,0x0f,0x95,0x55,0x55,0xf6,0x00,0x07,0x27,0x5f,0x00,0x11,0x60,
-0x39,0x00,0x14,0x60,0x72,0x00,0x04,0xcf,0x7e,0x03,0x13,0x00,0x52,0x03,0x4a,0xe0,
-0x00,0xfa,0x41,0x18,0x12,0xe8,0x10,0x06,0x18,0xf0,0xab,0x6c,0x00,0xf2,0x1b,0x21,
-0x40,0x00,0x63,0x0b,0x04,0xb4,0x12,0x13,0x90,0x67,0x5e,0x41,0x11,0xba,0x10,0x8f,
-0x1f,0x0a,0x51,0x1f,0xff,0xff,0x98,0xd3,0x4a,0x43,0x71,0x33,0xcb,0x32,0x8c,0x00,
-0x05,0x30,0x26,0x00,0x42,0x08,0xc0,0x00,0xe8,0x39,0x00,0x13,0x8c,0x87,0x04,0x51,
-0xb7,0x59,0xb0,0x07,0xf0,0x1d,0x5a,0xf0,0x0a,0xe6,0xab,0x00,0xba,0x04,0x30,0x00,
-0x3f,0xde,0xa0,0x0c,0x90,0x0f,0x60,0x9c,0x00,0x00,0x20,0xb9,0x00,0xe7,0x05,0xf0,
-0x02,0xf3,0x39,0x00,0x31,0x1f,0x40,0xba,0x08,0x21,0x50,0xb9,0x06,0xf0,0x2f,0x40,
-0xd2,0x0e,0xf0,0x08,0x0b,0x90,0xca,0x0b,0xf5,0x79,0xbd,0xf8,0x00,0x45,0xd8,0x5f,
-0x20,0xef,0xfc,0xa8,0x69,0xe0,0x08,0xfd,0x33,0x80,0x03,0x1e,0x19,0x08,0x5c,0x16,
-0x12,0xaa,0x64,0x87,0x03,0x69,0x1c,0x12,0xf4,0x13,0x00,0xa1,0x05,0x55,0x6f,0x85,
-0x55,0x10,0x00,0x0a,0xa0,0x01,0xa8,0x13,0x11,0x01,0x82,0x09,0x10,0x0f,0x24,0x6e,
-0x35,0x2b,0xb2,0x10,0x26,0x00,0x03,0xa2,0x2b,0x20,0x0a,0xa0,0xcb,0x0f,0x71,0xbd,
-0x55,0x10,0x00,0xab,0x55,0x00,0x7c,0xa4,0x41,0x01,0x6e,0xff,0x84,0x13,0x00,0x52,
-0x03,0xff,0xec,0x10,0xcf,0x98,0x22,0x20,0x0a,0xa0,0x85,0x2d,0x11,0x8c,0x39,0x00,
-0x40,0x02,0xe8,0x00,0x08,0xb6,0x1d,0x01,0xf6,0x21,0x12,0x8c,0x85,0x00,0x80,0x0a,
-0x70,0x08,0xc0,0x00,0x03,0x5d,0xa0,0x56,0x8d,0x51,0xcb,0x00,0x00,0x7f,0xd4,0xd0,
-0x60,0x19,0x50,0x76,0x32,0x15,0x40,0x49,0xa1,0x00,0xef,0x1e,0x20,0x68,0xba,0x49,
-0x0f,0x60,0x09,0xef,0xff,0xfe,0xca,0x70,0x13,0x00,0x30,0x23,0x21,0x4f,0x31,0x02,
-0xc2,0x19,0xd1,0x13,0x33,0x36,0xf3,0x33,0x33,0x01,0xff,0xff,0xfb,0xe4,0x03,0x34,
-0x03,0x3a,0xe3,0x87,0x4b,0xc3,0x8d,0x00,0x13,0x33,0x6f,0x43,0x33,0x10,0x00,0x08,
-0xd0,0x07,0xf4,0x11,0x50,0x8d,0x02,0x7c,0x00,0x3f,0x16,0x02,0xf1,0x09,0x2b,0xff,
+0xef,0x20,0x94,0x02,0x40,0x44,0x46,0xf7,0x47,0xa0,0x00,0x60,0x8d,0x00,0x00,0x2f,
+0x31,0xf7,0x91,0x05,0xf5,0x0a,0xb0,0x00,0x02,0xf4,0x18,0xf2,0x00,0x03,0x45,0xf7,
+0x7b,0xcd,0xef,0xff,0xff,0xb0,0x00,0x7f,0xfc,0x16,0x98,0x76,0x43,0x21,0x4f,0x82,
+0x09,0x10,0x10,0x7d,0x0b,0xd0,0x10,0x00,0x01,0x07,0xc0,0x00,0x06,0xf1,0x00,0x04,
+0xf4,0x2f,0x80,0x1e,0x03,0x60,0xcd,0x00,0x7f,0x20,0x06,0xf1,0x84,0x06,0xf2,0x07,
+0xe9,0x00,0x6f,0x10,0x0d,0xb0,0x00,0x07,0x70,0x06,0xf1,0x02,0xc2,0x00,0x13,0x33,
+0x33,0x8f,0x43,0x33,0x33,0x08,0x8e,0x02,0x21,0xf4,0x12,0xa0,0x09,0x22,0x5f,0x40,
+0x11,0x04,0x30,0xf4,0x01,0x11,0x01,0x00,0x32,0x4f,0x40,0xef,0x1e,0x00,0x11,0x04,
+0xc5,0x04,0x14,0x6f,0x1e,0x00,0x03,0x46,0x06,0x13,0x4d,0x3c,0x00,0x02,0x88,0x05,
+0x01,0x50,0x01,0x01,0x1f,0x05,0xf0,0x0d,0x91,0x00,0xce,0xee,0xee,0xee,0xed,0x00,
+0x03,0xe9,0x00,0x05,0x6c,0xc6,0x68,0xf7,0x50,0x05,0xfa,0x00,0x00,0x00,0xaa,0x00,
+0x4f,0x10,0x1a,0xf9,0x7c,0x0b,0x63,0xa0,0x04,0xf1,0x0c,0xe5,0x00,0x13,0x00,0x32,
+0x11,0x00,0x02,0x13,0x00,0xd2,0x00,0x00,0x03,0xf8,0x00,0x55,0xcc,0x55,0x8f,0x65,
+0x00,0x04,0xf8,0xd1,0x06,0xc0,0xf2,0x08,0xf8,0x00,0x00,0x00,0xb9,0x00,0x4f,0x10,
+0x3d,0xe5,0xa2,0x04,0x50,0x80,0x04,0xf1,0x06,0xa1,0xe2,0x05,0x20,0xf6,0x00,0xf7,
+0x00,0x50,0x0a,0xe1,0x00,0x2f,0x30,0x39,0x00,0x50,0x08,0xf5,0x00,0x08,0xe0,0x13,
+0x00,0x50,0x09,0xf6,0x00,0x00,0xe8,0xf3,0x0a,0xfe,0x06,0x3d,0xf5,0x00,0x00,0xae,
+0x10,0x00,0x4f,0x13,0xbf,0xb1,0x00,0x00,0x0c,0x40,0x00,0x04,0xf1,0x5c,0x40,0x00,
+0x01,0x00,0xa1,0x11,0x00,0x0f,0xfe,0xee,0xee,0xf8,0x00,0x00,0xdc,0x5d,0x0c,0x42,
+0xd8,0x00,0x1d,0xd1,0x12,0x00,0x32,0x05,0xec,0x10,0x12,0x00,0xc1,0x8f,0x80,0x00,
+0x00,0x0e,0xee,0xef,0xee,0xe7,0x14,0x00,0x03,0xb2,0x00,0x01,0xe8,0x0c,0x10,0xde,
+0x1c,0x07,0x41,0x20,0x07,0xf6,0x00,0x36,0x01,0x31,0x02,0xcf,0x60,0x3e,0x05,0x30,
+0xf4,0x7f,0xd3,0xa5,0x00,0x41,0x00,0x02,0xf4,0x28,0xae,0x00,0x01,0x2a,0x01,0x21,
+0x07,0xa0,0x1b,0x00,0xfa,0x17,0x00,0x00,0x5f,0x60,0x04,0x80,0x8d,0x08,0x10,0x00,
+0x06,0xf8,0x00,0x1d,0x80,0x8d,0x08,0xc0,0x01,0xaf,0x70,0x00,0xac,0x12,0x9d,0x00,
+0xd6,0x8f,0xe4,0x00,0x00,0x11,0x2f,0xf8,0x00,0x00,0xc8,0x00,0x4d,0x0b,0x11,0xa0,
+0x79,0x03,0x00,0xd3,0x09,0x00,0x6d,0x07,0x20,0x00,0x00,0x7b,0x07,0xb0,0x45,0x55,
+0xcd,0x55,0x55,0x00,0x06,0xf7,0x00,0x0b,0xff,0x25,0x04,0x43,0x00,0xc5,0x01,0x81,
+0x26,0x00,0x23,0x00,0xcd,0x26,0x00,0x42,0x00,0x7f,0x3d,0xff,0x1d,0x00,0x20,0x5f,
+0xe0,0x77,0x04,0x51,0xf9,0x55,0x00,0x6f,0xfe,0x65,0x07,0x62,0x60,0x00,0x3f,0xb7,
+0xe0,0x35,0x13,0x00,0x32,0x80,0x7e,0x0a,0x88,0x04,0x00,0x95,0x06,0x10,0x51,0x53,
+0x01,0x00,0x6b,0x06,0x20,0x0c,0xc0,0x26,0x00,0x00,0x13,0x00,0x23,0x1e,0x90,0x13,
+0x00,0x23,0x00,0x5c,0x13,0x00,0x00,0xf9,0x02,0x13,0xf5,0x91,0x06,0x20,0x8f,0xfc,
+0x6e,0x02,0x51,0x6a,0x00,0x00,0x2a,0x20,0xf6,0x06,0x40,0x60,0x00,0x1e,0xb0,0x09,
+0x00,0x70,0x3e,0x90,0x00,0x1d,0xb0,0x00,0xab,0x27,0x05,0xe2,0x00,0x2d,0xa0,0x01,
+0xcd,0x30,0x00,0x09,0x80,0x1e,0x5f,0xfe,0xff,0xfa,0x11,0x09,0xf0,0x07,0x44,0x4b,
+0xe5,0x09,0xb0,0x00,0x00,0x07,0xf3,0x00,0x6e,0x80,0x00,0x2e,0x90,0x00,0x05,0xfe,
+0x05,0xef,0xed,0xef,0x77,0x0d,0xf1,0x06,0xfe,0xe0,0x29,0x76,0xfb,0x21,0x00,0x7f,
+0x10,0xda,0x6e,0x00,0x00,0xbf,0x31,0x11,0x10,0x50,0x02,0x06,0xe0,0x9c,0x0c,0x71,
+0x60,0x00,0x00,0x6e,0x03,0xdf,0xf4,0xb3,0x0d,0x70,0x06,0xe0,0xec,0x15,0xe4,0x09,
+0xe3,0xe9,0x02,0x61,0x01,0x00,0x05,0xfd,0xe2,0x00,0xed,0x07,0x40,0x03,0xaf,0xfe,
+0x60,0x13,0x00,0xf2,0x08,0x05,0x9d,0xfa,0x30,0x6e,0xfa,0x61,0x00,0x06,0xe0,0xdb,
+0x61,0x00,0x00,0x04,0x9d,0x20,0x00,0x00,0x89,0x00,0x4c,0x20,0xad,0x0a,0x32,0x40,
+0x0b,0xd0,0xee,0x09,0x22,0x60,0x03,0x9b,0x07,0x50,0x9f,0x50,0x00,0xdc,0x32,0x72,
+0x05,0xf0,0x1c,0x08,0x30,0x3f,0xdf,0xcc,0xcc,0xcc,0xcc,0xb0,0x00,0x00,0x0d,0xc6,
+0x6d,0x83,0x33,0x33,0x8e,0x00,0x00,0x09,0xf3,0x00,0xd7,0x11,0x11,0x17,0xe0,0x00,
+0x08,0xfe,0x00,0x0d,0xed,0xdd,0xdd,0xee,0x00,0x09,0xfd,0xe0,0x00,0xd6,0x6f,0x00,
+0xa0,0x02,0xf7,0x6e,0x00,0x0d,0xef,0xfe,0xee,0xed,0x00,0xa2,0x00,0x12,0x06,0xd7,
+0x0d,0x20,0x6e,0x00,0x5b,0x05,0x10,0xfa,0x20,0x00,0xf1,0x00,0x08,0xfe,0x91,0x00,
+0x7f,0x20,0x00,0x00,0x6e,0x09,0xd2,0x1d,0xa2,0x9e,0x40,0xa2,0x00,0x50,0x00,0x4f,
+0xff,0x40,0x00,0xc8,0x00,0xf0,0x59,0x69,0xdf,0xa6,0xbf,0xd8,0x51,0x00,0x06,0xe0,
+0xac,0x95,0x00,0x00,0x26,0xad,0x20,0x00,0x05,0xb1,0x00,0x77,0x00,0x05,0xa0,0x00,
+0x00,0x02,0xf9,0x05,0x08,0x80,0x50,0x8b,0x00,0x00,0x01,0xdc,0x00,0xf0,0x88,0x1e,
+0x0a,0x90,0x00,0x02,0xec,0x10,0x0f,0x08,0x81,0xe0,0xc7,0x00,0x00,0x1a,0x01,0xe6,
+0xf0,0x88,0x1e,0x0f,0xff,0xff,0x20,0x00,0x9e,0x0f,0xff,0xff,0xe3,0xf4,0x3c,0x90,
+0x00,0x3f,0x40,0x22,0x22,0x22,0x7f,0x00,0xd5,0x00,0x1e,0xf2,0x14,0x44,0x44,0x3d,
+0xf3,0x0f,0x20,0x0d,0xff,0x25,0xff,0xff,0xfe,0xfc,0x73,0xf0,0x06,0xf5,0xf2,0xa7,
+0x03,0xf0,0x19,0x7a,0x7c,0x00,0x02,0x2f,0x20,0x8f,0xff,0xf4,0x03,0xdb,0x60,0x00,
+0x02,0xf2,0x08,0xb1,0x1d,0x40,0x0e,0xf1,0x00,0x00,0x2f,0x20,0x9a,0x00,0xd5,0x60,
+0xbc,0x00,0x00,0x02,0xf2,0x0b,0x70,0x0f,0xfa,0x4f,0xf2,0x13,0x00,0xf0,0x14,0xf5,
+0x03,0xe4,0x2e,0x8b,0xc0,0x00,0x02,0xf2,0x9e,0x00,0x01,0x4e,0xb0,0x1e,0xc1,0x00,
+0x2f,0x29,0x50,0x00,0x09,0x80,0x00,0x2b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x17,0x00,0x01,0x00,0x24,0x0b,0xa1,0x0a,0x00,0x60,0x5e,0xe3,0x00,0x00,
+0x5d,0x20,0x0a,0x00,0x51,0x1c,0xf7,0x00,0x0d,0xc0,0x14,0x00,0x40,0x08,0xf5,0x07,
+0xf3,0x08,0x00,0xf0,0x48,0x19,0x30,0x04,0x02,0xf9,0x00,0x00,0x00,0x14,0x01,0xf5,
+0x00,0x00,0xdd,0x00,0x00,0x00,0x06,0xf0,0x1f,0x50,0x00,0x9f,0x37,0x60,0x00,0x00,
+0xac,0x01,0xf5,0x00,0x7f,0x60,0x9f,0x10,0x00,0x0e,0x80,0x1f,0x50,0x6f,0x70,0x01,
+0xea,0x00,0x03,0xf3,0x01,0xf5,0x6f,0x90,0x00,0x06,0xf3,0x00,0xae,0x00,0x1f,0xbf,
+0x90,0x00,0x00,0x0e,0xa0,0x1f,0x60,0x02,0xff,0x70,0x00,0x00,0x00,0x8f,0x10,0x20,
+0x03,0xdf,0x70,0x00,0x00,0x5a,0x02,0xa1,0x00,0x08,0xfd,0xf5,0x48,0x00,0xf0,0x04,
+0x00,0x00,0x7e,0xe5,0x1f,0x50,0x00,0x00,0x9d,0x00,0x00,0x0c,0x80,0x00,0xfc,0x66,
+0x66,0x7f,0x90,0x72,0x00,0x52,0x07,0xef,0xff,0xff,0xb1,0x99,0x00,0x14,0x3b,0xa2,
+0x00,0x21,0x01,0xea,0x07,0x00,0xb2,0x56,0x66,0x66,0x6a,0xf7,0x66,0x66,0x65,0x00,
+0x0d,0xff,0x01,0x00,0x61,0xc0,0x00,0xd8,0x00,0x00,0x13,0x1c,0x00,0x50,0x0d,0x80,
+0x00,0x08,0xfa,0xc5,0x00,0x00,0x13,0x00,0x01,0x6b,0x00,0x00,0x13,0x00,0x41,0x15,
+0x10,0x8f,0x30,0x13,0x00,0xf6,0x45,0x02,0xf3,0x00,0x10,0x00,0x00,0x00,0x0e,0x70,
+0x94,0x2f,0x30,0x00,0x09,0xc0,0x00,0x00,0xf6,0x0f,0x52,0xf3,0x00,0x00,0x3f,0x40,
+0x00,0x1f,0x42,0xf2,0x2f,0x30,0x00,0x00,0xbd,0x00,0x03,0xf2,0x6f,0x02,0xf3,0x00,
+0x03,0x13,0xf5,0x00,0x6f,0x0b,0xb0,0x2f,0x30,0x00,0x7c,0x0d,0xb0,0x0a,0xc2,0xf5,
+0x02,0xf3,0x00,0x09,0xb0,0x7f,0x01,0xf7,0x06,0x00,0x2f,0x84,0x44,0xd8,0x02,0x40,
+0x5f,0x10,0x00,0x00,0xaf,0xff,0xfd,0x10,0x00,0x00,0x20,0x4c,0x01,0x23,0x01,0xa4,
+0x09,0x00,0x41,0x0a,0xf5,0x33,0x33,0x18,0x00,0x50,0x7f,0xee,0xee,0xef,0xf1,0xce,
+0x00,0xf0,0x04,0xf7,0x00,0x00,0x2f,0x80,0x00,0x00,0x00,0x9f,0xb3,0x33,0x33,0xce,
+0x43,0x31,0x00,0x0b,0xed,0xee,0x01,0x00,0x41,0xf7,0x00,0x01,0x10,0x32,0x00,0x43,
+0xe7,0x00,0x00,0x06,0x12,0x00,0x30,0x00,0x01,0x33,0x01,0x00,0x13,0xf7,0x56,0x00,
+0x00,0x1b,0x00,0x11,0x0f,0xe7,0x00,0xf0,0x22,0xf7,0x00,0x00,0x03,0x33,0x33,0xa6,
+0x33,0x33,0x31,0x00,0x00,0x33,0x09,0x40,0xae,0x30,0x00,0x3d,0x10,0x00,0xbb,0x0f,
+0x60,0x0a,0xe1,0x02,0x0d,0xb0,0x04,0xf4,0x0f,0x60,0x00,0xc4,0x0d,0x64,0xf4,0x0d,
+0xb0,0x0f,0xb4,0x44,0x44,0x6f,0x40,0xcb,0x05,0x20,0x44,0x01,0xa0,0xfb,0x00,0x21,
+0x00,0x05,0x10,0x00,0x00,0x04,0x30,0xa1,0x00,0x00,0xcd,0x01,0x10,0xc9,0x55,0x00,
+0xf1,0x10,0x1f,0x30,0x12,0x22,0x2d,0xa2,0x22,0x21,0x00,0x01,0xf3,0x09,0xee,0xee,
+0xff,0xee,0xee,0x80,0x01,0x2f,0x97,0x01,0x11,0x1d,0xa1,0x11,0x10,0x00,0xa8,0xf5,
+0xe3,0x70,0x00,0x70,0x10,0x0c,0x6f,0x3b,0x20,0x00,0x0c,0x8f,0x01,0xd1,0xe4,0xf3,
+0x2c,0xcc,0xcc,0xfe,0xcc,0xcc,0xc1,0x3f,0x1f,0x30,0x22,0x01,0x00,0x90,0x02,0x71,
+0xf3,0x00,0xbc,0xcc,0xcc,0xcc,0xc8,0x4c,0x00,0x60,0x0d,0x94,0x44,0x44,0x4c,0xa0,
+0x5f,0x00,0x51,0xd8,0x11,0x11,0x11,0xba,0x13,0x00,0x00,0x42,0x00,0x01,0x13,0x00,
+0x51,0xd7,0x00,0x00,0x00,0xaa,0x13,0x00,0x41,0xec,0xcc,0xcc,0xce,0x13,0x00,0x51,
+0xd9,0x44,0x44,0x44,0xca,0x13,0x00,0x44,0x70,0x00,0x03,0x3c,0x26,0x00,0x64,0xef,
+0xd4,0x00,0x00,0x00,0x6e,0xf7,0x00,0x40,0x06,0xe0,0x00,0x4f,0x85,0x00,0xf0,0x14,
+0x02,0x22,0x8e,0x22,0x24,0xf3,0x22,0x25,0xf1,0x00,0xdf,0xff,0xff,0xfe,0x4f,0x11,
+0x11,0x4f,0x10,0x00,0x01,0xee,0x00,0x04,0xff,0xff,0xff,0xf1,0x00,0x00,0x7f,0xf7,
+0x00,0x4f,0x10,0x03,0x00,0xf0,0x0e,0x1f,0xbf,0xdb,0x14,0xf3,0x22,0x26,0xf1,0x00,
+0x0c,0xa6,0xe1,0xcd,0x4f,0xee,0xee,0xef,0x10,0x0b,0xd1,0x6e,0x00,0x34,0xf0,0x00,
+0x03,0xf1,0x00,0xa2,0x4c,0x00,0x40,0x54,0x44,0x7f,0x10,0x5f,0x00,0x50,0x13,0xdd,
+0xdd,0xdd,0xd1,0x61,0x00,0xf2,0x24,0x0c,0xa0,0x00,0x00,0x40,0x00,0x00,0x7b,0x07,
+0xb0,0x2e,0xa0,0x00,0x3f,0x60,0x00,0x0d,0x90,0x8c,0x00,0x3f,0x30,0x40,0x9e,0x10,
+0x05,0xf3,0x08,0xc0,0x00,0x10,0x1f,0x31,0xf9,0x00,0xda,0x00,0x8e,0x54,0x44,0x48,
+0xf0,0x08,0x90,0x01,0x10,0x02,0xdf,0xff,0xff,0xe7,0x9a,0x00,0x20,0x02,0xb2,0x06,
+0x00,0xf1,0x01,0x24,0x44,0x44,0x4e,0xc4,0x44,0x44,0x40,0x06,0xdd,0xde,0xdd,0xdd,
+0xde,0xed,0xdc,0xb2,0x00,0xe2,0x00,0x8e,0x00,0x00,0x13,0x33,0x5f,0x73,0x33,0x3e,
+0xa3,0x33,0x35,0xee,0x01,0x00,0x40,0xed,0x00,0x01,0x11,0x01,0x00,0xd0,0x10,0x00,
+0x02,0xfe,0xdd,0xdd,0xdd,0xdd,0xfa,0x00,0x00,0x2f,0x30,0x7a,0x03,0x40,0xa0,0x00,
+0x02,0xff,0x21,0x00,0x0f,0x11,0x00,0x01,0xf8,0x1a,0x11,0x13,0x1a,0xc3,0x00,0x01,
+0x30,0x00,0x0b,0xa1,0xf4,0x07,0xf6,0x00,0x5f,0x30,0x05,0xf2,0x1f,0x40,0x04,0x14,
+0xc0,0x8e,0x12,0xf8,0x01,0xf8,0x32,0x23,0xad,0x00,0xda,0x17,0x00,0x0a,0xff,0xff,
+0xfe,0x50,0x02,0xcc,0x03,0xf0,0x09,0xc8,0x00,0x00,0x4b,0x00,0x01,0x00,0x00,0x0b,
+0xc1,0x5b,0x00,0x6e,0x03,0x9f,0x80,0x02,0xcc,0x11,0x3e,0xb0,0x6f,0xed,0x93,0x29,
+0x03,0xf0,0x0f,0xed,0xe9,0x6f,0x20,0x00,0xa3,0x02,0x21,0x00,0x00,0x35,0x5f,0x43,
+0x34,0xf4,0x00,0xef,0xff,0xff,0xe0,0x1c,0xef,0xff,0xb0,0x00,0xe5,0x00,0x05,0xe0,
+0x4b,0x3e,0x00,0x72,0xee,0xee,0xee,0xe0,0x6e,0x00,0x5c,0x12,0x00,0x41,0x6f,0xaf,
+0xd7,0x10,0x12,0x00,0xf1,0x2c,0x6f,0x62,0x00,0x41,0x00,0xe5,0x00,0x06,0xe0,0x6f,
+0x00,0x00,0xc6,0x00,0xe5,0x02,0xef,0xb0,0x2f,0xff,0xff,0xf2,0x00,0x51,0x02,0x20,
+0x6d,0x11,0x33,0x38,0x30,0x00,0xe7,0x0e,0x60,0x0b,0xb0,0x00,0x0d,0xa0,0x06,0xf1,
+0x0e,0x60,0x01,0x60,0x6b,0x06,0xf2,0x1f,0x70,0x0e,0xa3,0x22,0x23,0xca,0x00,0xe8,
+0x04,0xc4,0x03,0x31,0xd3,0x00,0x30,0x9c,0x00,0x10,0x59,0x85,0x02,0x01,0x53,0x04,
+0x32,0xe0,0xbf,0x70,0x0a,0x00,0xe0,0x7f,0x00,0x5e,0xa0,0x00,0x03,0x77,0x77,0x77,
+0x7b,0xf7,0x77,0x9a,0x70,0x2c,0x03,0xc2,0xee,0xff,0xfe,0xee,0xee,0x00,0x07,0xf0,
+0x00,0x00,0x04,0xf1,0x22,0x00,0x00,0x1b,0x01,0xfa,0x53,0x09,0x70,0x00,0x07,0xff,
+0xff,0xfc,0x00,0xf5,0x01,0xf7,0x00,0x00,0x7f,0x55,0x5b,0xc0,0x0f,0x70,0x6f,0x10,
+0x00,0x08,0xe0,0x00,0x9c,0x00,0xca,0x0e,0xa0,0x00,0x00,0x9e,0x00,0x0a,0xb0,0x08,
+0xe7,0xf2,0x00,0x00,0x0b,0xc0,0x00,0xab,0x00,0x5f,0xf8,0x00,0x00,0x00,0xca,0x00,
+0x0c,0x90,0x01,0xfe,0x00,0x02,0x00,0x0f,0x73,0x67,0xf7,0x01,0xbf,0xc0,0x01,0xf1,
+0x04,0xf2,0x4d,0xdb,0x13,0xdf,0x9f,0x60,0x4f,0x00,0xcd,0x00,0x00,0x19,0xfe,0x30,
+0xaf,0x9b,0xc0,0x1d,0x50,0x00,0x01,0xc8,0x00,0x00,0x8e,0xe3,0x00,0x01,0x00,0xf2,
+0x03,0x14,0x7b,0x70,0x00,0x03,0x56,0x89,0xab,0xdf,0xff,0xea,0x60,0x00,0x08,0xed,
+0xcb,0xaa,0xf7,0xc3,0x00,0x00,0x3e,0x04,0x08,0x09,0x00,0xa2,0x04,0x66,0x66,0x68,
+0xf8,0x66,0x66,0x66,0x00,0x0a,0x87,0x04,0x2e,0xfe,0x00,0x24,0x00,0x50,0x11,0x11,
+0x11,0x14,0xf5,0xfd,0x01,0x13,0xff,0x01,0x00,0xae,0xf0,0x44,0x44,0x44,0x46,0xf7,
+0x44,0x44,0x44,0x40,0x2d,0x00,0x06,0x09,0x00,0x42,0x01,0x66,0x69,0xf2,0x11,0x00,
+0x3a,0xef,0xfd,0x90,0x9e,0x00,0x24,0x01,0x40,0x0a,0x00,0x14,0x3f,0x7b,0x04,0x42,
+0x03,0xf2,0x00,0x5f,0x20,0x04,0xd1,0x3f,0x20,0x05,0xf6,0x55,0x55,0x5f,0x70,0x00,
+0x04,0xf2,0x00,0x5f,0x3c,0x04,0x50,0xff,0xff,0xff,0xb5,0xf0,0xf2,0x04,0x42,0x04,
+0x46,0xf5,0x43,0x13,0x00,0x00,0x26,0x00,0x01,0x13,0x00,0x01,0x39,0x00,0x30,0x66,
+0x66,0x66,0x39,0x00,0x20,0x21,0x35,0x9e,0x00,0xf1,0x0d,0x70,0x00,0x48,0xfe,0xfb,
+0x6f,0x00,0x6f,0x00,0x00,0x02,0xff,0xef,0x61,0x08,0xe0,0x02,0xf4,0x00,0x00,0x04,
+0x03,0xf2,0x00,0xbc,0x00,0x0d,0xa0,0x72,0x00,0x50,0x0f,0x80,0x00,0x6f,0x20,0x72,
+0x00,0x51,0x05,0xf3,0x00,0x00,0xec,0x13,0x00,0xf0,0x04,0xcd,0x00,0x00,0x04,0xfa,
+0x00,0x03,0x38,0xf1,0x8f,0x40,0x00,0x00,0x07,0xfc,0x20,0x9f,0xfa,0x07,0xea,0x04,
+0x27,0x05,0xd1,0xb5,0x00,0x24,0x02,0x20,0x1a,0x05,0x15,0xb0,0x09,0x00,0x11,0x04,
+0xd4,0x04,0x00,0x09,0x00,0xf1,0x03,0xf6,0x56,0xf8,0x55,0xf7,0x01,0x1a,0xb1,0x14,
+0xf0,0x00,0xf4,0x00,0xe7,0x0f,0xff,0xff,0xc4,0x09,0x00,0x81,0x06,0x6c,0xd6,0x54,
+0xf6,0x66,0xf8,0x66,0x24,0x00,0x41,0xfe,0xee,0xff,0xee,0x09,0x00,0x01,0x1b,0x00,
+0x41,0x00,0x0a,0xb2,0x44,0x09,0x00,0x41,0x01,0x5d,0xff,0xc4,0x3f,0x00,0x32,0x1f,
+0xff,0xd3,0x51,0x00,0x92,0x03,0x1a,0xb0,0x03,0xc0,0x00,0xf4,0x00,0xa5,0x6c,0x00,
+0x3e,0xf4,0x00,0x00,0x09,0x00,0x32,0x02,0x3c,0xa0,0x09,0x00,0x33,0x07,0xfe,0x50,
+0x1b,0x00,0x01,0x01,0x00,0x10,0x10,0x60,0x01,0x05,0xd1,0x05,0x15,0x6f,0x8b,0x04,
+0x20,0xf0,0x00,0x5b,0x00,0x10,0xf8,0x13,0x00,0xb0,0x0f,0xa6,0x66,0x66,0x66,0x40,
+0x01,0x17,0xf1,0x10,0xf6,0x1c,0x00,0x00,0x19,0x00,0x30,0x3f,0x60,0x00,0xf0,0x00,
+0x80,0x5a,0xf5,0x51,0xf9,0x55,0x55,0x55,0x20,0x26,0x00,0x00,0xb1,0x05,0x11,0xf6,
+0x39,0x00,0xf1,0x04,0xf6,0x00,0x00,0x0e,0x60,0x00,0x00,0x6f,0x16,0x2f,0x60,0x00,
+0x00,0xe6,0x00,0x00,0x4b,0xff,0xe4,0x13,0x00,0xc2,0x02,0xff,0xff,0x30,0x0f,0x95,
+0x55,0x55,0xf6,0x00,0x07,0x27,0x5f,0x00,0x11,0x60,0x39,0x00,0x14,0x60,0x72,0x00,
+0x02,0x5f,0x00,0x05,0x13,0x00,0x60,0x03,0x4a,0xe0,0x00,0xfa,0x66,0x6e,0x02,0x22,
+0x8f,0xe8,0x10,0x06,0x17,0xf0,0x60,0x01,0x51,0x0a,0x80,0x00,0x00,0x06,0x19,0x02,
+0x20,0xb9,0x00,0x4b,0x07,0x00,0x4e,0x04,0x50,0x90,0x00,0x00,0x02,0xf6,0x83,0x02,
+0x30,0xba,0x10,0x8f,0x30,0x00,0x60,0xe0,0x1f,0xff,0xff,0x98,0xd3,0x5b,0x06,0x81,
+0x00,0x33,0xcb,0x32,0x8c,0x00,0x05,0x30,0x26,0x00,0x42,0x08,0xc0,0x00,0xe8,0x39,
+0x00,0x13,0x8c,0x87,0x04,0x40,0xb7,0x59,0xb0,0x07,0x5d,0x00,0xf0,0x0c,0x38,0xef,
+0xe6,0xab,0x00,0xba,0x04,0x30,0x00,0x3f,0xde,0xa0,0x0c,0x90,0x0f,0x60,0x9c,0x00,
+0x00,0x20,0xb9,0x00,0xe7,0x05,0xf0,0x02,0xf3,0x39,0x00,0x30,0x1f,0x40,0xba,0xb3,
+0x04,0xf6,0x17,0x00,0xb9,0x06,0xf0,0x2f,0x40,0x00,0x4f,0x20,0x00,0x0b,0x90,0xca,
+0x0b,0xf5,0x79,0xbd,0xf8,0x00,0x45,0xd8,0x5f,0x20,0xef,0xfc,0xa8,0x69,0xe0,0x08,
+0xfd,0x33,0x80,0x03,0x10,0x00,0x00,0x29,0x10,0xac,0x00,0x00,0x0c,0x06,0x30,0x00,
+0x0f,0x40,0xb5,0x00,0x03,0x85,0x01,0x00,0x13,0x00,0xa0,0x05,0x55,0x6f,0x85,0x55,
+0x10,0x00,0x0a,0xa0,0x01,0xab,0x00,0x52,0xf5,0x01,0xff,0xff,0xfa,0x26,0x00,0x45,
+0x02,0x2b,0xb2,0x10,0x26,0x00,0x01,0x42,0x03,0xe0,0xf3,0x00,0x0a,0xa0,0x05,0x55,
+0x55,0x55,0xbd,0x55,0x10,0x00,0xab,0x55,0x52,0x04,0x61,0xc0,0x00,0x01,0x6e,0xff,
+0x84,0x13,0x00,0x60,0x03,0xff,0xec,0x10,0xcf,0xff,0x1c,0x06,0x81,0x04,0x0a,0xa0,
+0x00,0x05,0x00,0x00,0x8c,0x39,0x00,0x20,0x02,0xe8,0x26,0x00,0x00,0x72,0x00,0x23,
+0x04,0xf3,0x13,0x00,0xf0,0x03,0x00,0x0a,0x70,0x08,0xc0,0x00,0x03,0x5d,0xa0,0x00,
+0x00,0x01,0x55,0xcb,0x00,0x00,0x7f,0xd4,0x98,0x00,0x01,0x10,0x02,0x06,0xb7,0x02,
+0x05,0x6c,0x03,0xf0,0x02,0x8d,0x00,0x00,0x00,0x23,0x68,0xba,0x00,0x00,0x08,0xd0,
+0x09,0xef,0xff,0xfe,0xca,0x70,0x13,0x00,0x30,0x23,0x21,0x4f,0x31,0x02,0xc2,0x19,
+0xd1,0x13,0x33,0x36,0xf3,0x33,0x33,0x01,0xff,0xff,0xfb,0xe4,0x03,0x43,0x03,0x3a,
+0xe3,0x20,0xc3,0x04,0xd2,0x8d,0x00,0x13,0x33,0x6f,0x43,0x33,0x10,0x00,0x08,0xd0,
+0x07,0xff,0x16,0x02,0x50,0x8d,0x02,0x7c,0x00,0x3f,0x16,0x02,0xf0,0x0c,0x2b,0xff,
 0xc7,0xd3,0x36,0xf4,0x33,0xf6,0x03,0xdf,0xfe,0x50,0x7f,0xee,0xff,0xee,0xef,0x60,
-0x18,0x38,0xd0,0x07,0xc0,0x03,0xa9,0x30,0x88,0x8d,0x00,0x7d,0x33,0x6f,0x43,0x3f,
-0x60,0x39,0x00,0x90,0x00,0x59,0x00,0x3f,0x00,0x09,0x40,0x03,0x5b,0xda,0x1e,0x01,
-0xa7,0x16,0x10,0xe6,0x83,0x03,0x0a,0xd3,0x5f,0x00,0x5c,0x49,0x23,0x2a,0x10,0x26,
-0x4a,0x22,0x0d,0x90,0x03,0x45,0x00,0x10,0x28,0xe1,0xe4,0x01,0x1e,0x71,0x04,0x69,
-0x55,0x55,0x97,0x51,0x2f,0xff,0xff,0x40,0x66,0x1f,0x80,0x03,0x3e,0x83,0x10,0x0b,
-0xa0,0x08,0xc0,0x24,0x00,0x82,0x14,0x47,0x94,0x5f,0x84,0x43,0x00,0x0e,0xf9,0x8b,
-0x70,0xfc,0x00,0x0e,0x63,0x00,0x00,0x8b,0xe0,0x00,0x50,0x6f,0xff,0x42,0x24,0xf8,
-0x48,0x3b,0x22,0xff,0x91,0x4f,0x3e,0x30,0x04,0x0e,0x60,0x66,0x1d,0x11,0xe8,0xc8,
-0x02,0x10,0xfa,0x44,0x56,0x00,0x09,0x00,0x43,0x8d,0xfa,0x7f,0x60,0xed,0x02,0xf7,
-0x06,0xff,0x81,0x00,0x04,0x5f,0x60,0x37,0x9d,0xf9,0x26,0xdf,0x81,0x09,0xfc,0x10,
-0x8d,0x96,0x10,0x00,0x07,0xd2,0xa7,0x27,0x52,0xa0,0x00,0x08,0x60,0x57,0x90,0x03,
+0x18,0x38,0xd0,0x07,0xc0,0x03,0xf0,0x00,0xe6,0x39,0x00,0x68,0x7d,0x33,0x6f,0x43,
+0x3f,0x60,0x39,0x00,0xe0,0x00,0x59,0x00,0x3f,0x00,0x09,0x40,0x03,0x5b,0xd0,0x00,
+0x00,0x03,0xf0,0x21,0x05,0x10,0xe6,0x83,0x03,0x0a,0x21,0x04,0x72,0x0c,0x50,0x00,
+0x00,0x2a,0x10,0x00,0x78,0x02,0x21,0x0d,0x90,0x09,0x00,0xf0,0x11,0x0d,0xee,0xef,
+0xfe,0xee,0xe4,0x01,0x1e,0x71,0x04,0x69,0x55,0x55,0x97,0x51,0x2f,0xff,0xff,0x40,
+0x3f,0x20,0x01,0xf6,0x00,0x03,0x3e,0x83,0x10,0x0b,0xa0,0x08,0xc0,0x24,0x00,0xc0,
+0x14,0x47,0x94,0x5f,0x84,0x43,0x00,0x0e,0x60,0x6f,0xff,0xff,0x6f,0x05,0x50,0x0e,
+0x63,0x00,0x00,0x8b,0xe0,0x00,0xc1,0x6f,0xff,0x42,0x24,0xf8,0x22,0x22,0x22,0x4f,
+0xff,0x91,0x9f,0xe0,0x00,0x81,0x04,0x0e,0x60,0x00,0x5f,0x20,0x00,0xe8,0xc8,0x02,
+0x41,0xfa,0x00,0x07,0xf1,0x09,0x00,0x43,0x8d,0xfa,0x7f,0x60,0xed,0x02,0xf6,0x06,
+0xff,0x81,0x00,0x04,0x5f,0x60,0x37,0x9d,0xf9,0x26,0xdf,0x81,0x09,0xfc,0x10,0x8d,
+0x96,0x10,0x00,0x07,0xd2,0xa2,0x00,0x62,0x09,0xa0,0x00,0x08,0x60,0x57,0x90,0x03,
 0x41,0x1f,0x70,0x5f,0x20,0x09,0x00,0xf1,0x0f,0x7f,0x10,0x0d,0x90,0x00,0x01,0x1b,
 0xb1,0x10,0xed,0x88,0x8c,0xa8,0x85,0x1f,0xff,0xff,0xd5,0xfe,0xcc,0xdf,0xdc,0xc8,
-0x02,0x2b,0xc2,0x3e,0xf7,0x00,0x2f,0x24,0x00,0x13,0xae,0x09,0x00,0x31,0xb1,0xe4,
-0xef,0x89,0x0d,0xd0,0x0a,0xc7,0xa0,0xea,0x55,0x7f,0x65,0x51,0x02,0x7e,0xff,0x90,
-0xe7,0x1b,0x00,0x00,0x70,0x35,0x01,0x09,0x00,0x31,0x05,0x1a,0xb0,0x4d,0x14,0x10,
-0xf3,0x5a,0x00,0x50,0xe9,0x44,0x6f,0x64,0x41,0x09,0x00,0x13,0xe7,0x48,0x00,0x92,
-0x00,0xe8,0x22,0x4f,0x42,0x22,0x04,0x5d,0xa0,0x71,0x14,0x52,0x08,0xfd,0x40,0x00,
-0xe8,0x07,0x43,0x0a,0x53,0x49,0x20,0x00,0x00,0x5c,0x1c,0x11,0x8b,0x9b,0x12,0x20,
-0x0d,0x70,0x6c,0x1e,0x11,0xda,0x12,0x00,0xd0,0x09,0xd0,0x05,0xf2,0x00,0x01,0x1d,
-0x81,0x36,0x68,0xc7,0x6d,0xd6,0xfe,0x4e,0x02,0x39,0x4a,0x35,0x03,0x3d,0x93,0x36,
-0x00,0x60,0x1d,0xdd,0xdc,0x03,0x10,0xe5,0xe1,0x2c,0xf1,0x15,0x65,0x8e,0x0d,0x50,
-0xe5,0x00,0x0d,0x98,0x4f,0x10,0x4e,0x0d,0x50,0xe5,0x04,0x9f,0xfd,0x4f,0xcc,0xde,
-0x0d,0x50,0xe5,0x1f,0xce,0x80,0x1f,0x54,0x7e,0x0d,0x50,0xe5,0x01,0x0d,0x70,0x1f,
-0x1b,0x00,0x00,0x2d,0x00,0x23,0xdc,0xde,0x09,0x00,0x32,0x43,0x6e,0x0c,0x09,0x00,
-0xf7,0x08,0x10,0x4e,0x00,0x00,0xe5,0x03,0x4e,0x70,0x1f,0x13,0x7e,0x00,0x34,0xf5,
-0x0a,0xfd,0x20,0x1f,0x1a,0xe8,0x00,0xef,0xc1,0xfb,0x03,0x32,0x20,0x00,0x00,0xec,
-0x60,0x00,0xe1,0x79,0x11,0x43,0x57,0x5b,0x61,0x30,0x00,0x0e,0xfe,0xef,0xa0,0x13,
-0x00,0x20,0x0a,0xd0,0x08,0x1c,0xc2,0x2e,0xef,0xee,0x08,0xf6,0x33,0xcb,0x33,0x30,
-0x01,0x66,0xf8,0x0e,0x28,0x00,0x26,0x00,0x60,0x05,0xf0,0x03,0x03,0x03,0xf0,0x26,
-0x00,0xf2,0x21,0x1f,0x05,0xa0,0xe2,0x3f,0x00,0x00,0x0f,0x45,0x01,0xf1,0xd4,0x05,
-0xb3,0xf0,0x00,0x16,0xff,0xe0,0x1f,0x8a,0x00,0x0d,0x7f,0x00,0x4f,0xff,0x60,0x01,
-0xf3,0x15,0xe0,0x23,0xf0,0x01,0x51,0xf3,0x02,0x4f,0x43,0x9d,0x33,0x6f,0x30,0x00,
-0x0f,0x30,0xcf,0xb0,0x21,0x00,0x72,0x00,0x32,0x03,0xfc,0x90,0x72,0x00,0xfe,0x0a,
-0x04,0xe8,0x1e,0x90,0x00,0x00,0x57,0xf2,0x02,0x5b,0xf7,0x00,0x1c,0xf9,0x51,0x0a,
-0xfb,0x01,0xec,0x81,0x00,0x00,0x04,0x9c,0x10,0x56,0x01,0x01,0x09,0x05,0x01,0x4c,
-0x24,0x00,0x2f,0x02,0x12,0x3f,0x60,0x52,0x10,0xe6,0xd2,0x02,0x22,0x0a,0xa0,0x13,
-0x00,0x01,0xa1,0x03,0x00,0x20,0x2d,0x01,0x45,0x0a,0x61,0x04,0x4f,0x94,0x01,0x12,
-0x21,0x89,0x58,0x70,0xe6,0x01,0xff,0xff,0x94,0xff,0xff,0xaa,0x47,0xf4,0x21,0x1f,
-0x00,0x89,0x4c,0x00,0x99,0x00,0x00,0xe8,0x83,0xf0,0x08,0x94,0xc0,0x09,0x90,0x16,
-0x9f,0xd8,0x3f,0xff,0xfc,0x9f,0xff,0xf9,0x01,0xfe,0xf6,0x00,0x11,0x11,0x8d,0x11,
-0x11,0x00,0x06,0x0e,0x60,0x13,0x33,0x39,0xd3,0x33,0x33,0x00,0x00,0xe6,0x07,0xe1,
-0x44,0x10,0x60,0x42,0x2c,0x11,0x70,0x72,0x00,0xf7,0x07,0x3a,0xf5,0x7d,0x2d,0xc4,
-0x00,0x01,0x4f,0x64,0xdf,0xa2,0x07,0xd0,0x08,0xfd,0x10,0x4f,0xd2,0x18,0x20,0x00,
-0x7d,0x63,0x07,0x02,0x02,0x1b,0x00,0xfb,0x6c,0x01,0xcb,0x13,0x32,0xf5,0x01,0xf6,
-0x8b,0x51,0x42,0x0f,0x50,0x5f,0x20,0x8c,0x51,0xf0,0x04,0xf5,0x0a,0xf8,0x88,0x88,
-0x81,0x03,0xfd,0xdd,0xdf,0x50,0xed,0xbb,0xbe,0xeb,0x20,0x3f,0x43,0x33,0xfd,0x0c,
-0x11,0xe8,0x26,0x00,0x21,0x6d,0xfd,0x79,0x33,0x71,0x21,0x11,0xfd,0xf7,0xf1,0x05,
-0xf1,0xdd,0x28,0x41,0xe8,0x0f,0x70,0xad,0x39,0x00,0x52,0xf6,0x00,0xad,0x1f,0x70,
-0x4c,0x00,0x20,0x04,0xfa,0xe7,0xaa,0x60,0xdc,0xcc,0xf5,0x00,0x0c,0xf9,0xff,0x8e,
-0x60,0x55,0x75,0x20,0x00,0xaf,0x70,0xd7,0x22,0x60,0x1f,0x70,0x00,0x8f,0xef,0x40,
-0xf7,0x42,0x60,0x6f,0x20,0x8f,0x90,0xde,0x30,0x30,0x33,0x60,0xcb,0xdf,0x90,0x01,
-0xdf,0x80,0xf7,0x43,0x20,0x7e,0x40,0x01,0x3c,0x02,0xd4,0x75,0x00,0x04,0x00,0x60,
-0x50,0x1f,0x30,0x51,0x01,0xa1,0xf1,0x03,0x20,0x51,0xf3,0x1b,0xab,0x00,0x30,0x25,
-0x31,0x1f,0x3b,0x90,0x1f,0xab,0xf1,0x00,0x68,0x97,0xf9,0x97,0x60,0xcb,0x44,0x44,
-0x40,0x0b,0xbb,0xef,0xeb,0xbb,0x1f,0xae,0x08,0x50,0x4f,0xff,0xa1,0x04,0xf6,0x10,
-0x0c,0xf1,0x17,0x5f,0x7f,0x4a,0xe3,0xaf,0x90,0x0e,0x60,0x00,0xbf,0x61,0xf3,0x06,
-0x3f,0xad,0x01,0xf2,0x00,0x07,0x20,0x37,0x10,0x0a,0xc1,0xf2,0x5f,0x00,0x00,0x12,
-0x2e,0x92,0x22,0x13,0x0d,0x7a,0xa0,0x00,0x09,0x50,0x03,0x21,0x7d,0xf4,0xc2,0x2d,
-0x41,0x8d,0x00,0x01,0xfe,0xee,0x2e,0x40,0x3f,0x50,0x00,0x2f,0x8e,0x04,0x51,0xaf,
-0xbd,0xa0,0x00,0x0d,0x9c,0x85,0xf1,0x05,0x6f,0xfa,0x10,0x0b,0xe1,0x6f,0x40,0x00,
-0x05,0xbf,0x73,0xd6,0x3d,0xe2,0x00,0xaf,0x80,0x0d,0xe9,0x20,0xe3,0x89,0x33,0x8f,
-0x20,0x20,0xe9,0x77,0x01,0x08,0x02,0x1d,0x89,0xcb,0x97,0x02,0xff,0x4f,0x01,0xa7,
-0x18,0x10,0xba,0x98,0x47,0x16,0x0e,0xc6,0x33,0x24,0x0c,0xb0,0x1d,0x66,0x24,0x4f,
-0x30,0xea,0x1d,0x14,0xcb,0x38,0x66,0x24,0x05,0xf5,0x98,0x61,0x24,0x0a,0xf2,0x58,
-0x6d,0x43,0x0d,0xd1,0xce,0x10,0xdd,0x12,0x24,0xef,0x40,0x96,0x55,0x04,0x3f,0x6f,
-0x32,0xee,0x7e,0xf7,0x5a,0x0e,0x50,0xfb,0x10,0x1a,0xfc,0x30,0x50,0x62,0x10,0xe6,
-0xd5,0x3c,0x32,0xd7,0x20,0x0e,0x19,0x58,0x33,0x5b,0xfe,0x10,0xcd,0x1f,0x00,0x43,
-0x6f,0x14,0x9a,0xb6,0x6a,0x00,0x94,0x18,0x50,0x58,0xbf,0xfb,0x20,0x0b,0x0d,0x08,
-0xb2,0x7f,0xa7,0x40,0x00,0x00,0x26,0xa3,0x33,0xc6,0x17,0xd0,0x97,0x53,0x31,0x3f,
-0x20,0x7d,0x33,0x00,0x41,0xe4,0x09,0xb0,0x07,0x6f,0x9f,0xf0,0x03,0xde,0xdd,0xfe,
-0xdb,0x7f,0xbb,0xbb,0xbb,0x10,0x55,0x57,0xf6,0x55,0x47,0xe9,0x9b,0xf9,0x91,0xf1,
-0x8f,0x20,0x00,0x7c,0xec,0x14,0x50,0x44,0x46,0xf5,0x44,0x29,0xcd,0x08,0x10,0x0e,
-0xd1,0x19,0x30,0xaa,0x00,0x4f,0x34,0x16,0x40,0xf1,0x40,0x0b,0x90,0xaa,0x2a,0x50,
-0xc8,0x2f,0x2d,0x60,0xc7,0x13,0x00,0x70,0x4f,0x12,0xf1,0x4e,0x1f,0x40,0x04,0xb5,
-0x02,0x40,0x2f,0x10,0xa7,0xf0,0x13,0x00,0x50,0x10,0x26,0xf1,0x00,0xc9,0xcc,0x36,
-0x00,0xe5,0x5f,0x21,0x1c,0x20,0x38,0x15,0x00,0xa6,0x26,0x0c,0xd8,0x5a,0x10,0xae,
-0x5a,0x3f,0x00,0x15,0x19,0x10,0xb6,0xcf,0x2a,0x06,0xaa,0x16,0x2a,0x6f,0x20,0x1a,
-0x63,0x21,0x00,0x9f,0x12,0x08,0x03,0x3a,0x33,0x00,0x2a,0x02,0x00,0xd4,0x93,0x13,
-0xbb,0x00,0x19,0x22,0x0c,0xa0,0x2c,0x77,0x00,0x4e,0x0f,0x23,0x01,0xe9,0xc2,0x42,
-0x22,0xaf,0x20,0x3a,0x14,0x21,0x8f,0x60,0xb6,0x17,0xb0,0x02,0xbf,0x80,0x00,0x05,
-0x55,0x6d,0xc0,0x00,0x7e,0x50,0xa9,0x1f,0x15,0xd3,0xf7,0x65,0x00,0xa7,0x08,0xf2,
-0x10,0xf1,0x3b,0xbb,0xbb,0xbb,0x90,0x0f,0x84,0x47,0xf1,0x28,0x88,0xcd,0x88,0x60,
-0x0f,0x40,0x03,0xf1,0x00,0x10,0x9a,0x00,0x00,0x0f,0x62,0x25,0xf1,0x09,0xa0,0xaa,
-0x24,0x00,0x50,0x0c,0x70,0xb9,0x00,0x00,0x1b,0x00,0x32,0x1f,0x30,0xd7,0x09,0x00,
-0x10,0x7f,0xa3,0x53,0x00,0x1b,0x00,0x91,0xaf,0xef,0xfe,0xee,0xe1,0x0f,0x84,0x44,
-0x40,0x2a,0x10,0x32,0x0f,0x40,0x05,0xf5,0x9a,0x70,0x0f,0x40,0x1f,0x50,0x00,0x2f,
-0xac,0x09,0x00,0x50,0x09,0xd0,0x00,0xac,0x6c,0x83,0x3b,0xf0,0x03,0xbf,0xf4,0x04,
-0xf5,0x6c,0x00,0x72,0x2f,0xef,0xa2,0xb8,0x1e,0xc0,0x6c,0x00,0xa4,0x7f,0xa2,0x22,
-0x61,0x41,0x5e,0x44,0xe2,0x13,0xc8,0xa1,0x35,0x2d,0xff,0xa0,0xb4,0x44,0x12,0x36,
-0xc9,0x32,0x02,0xb6,0x0b,0x11,0x7e,0x96,0x0c,0x21,0xe7,0xe0,0x16,0x83,0x0a,0x0d,
-0x00,0x00,0xb7,0x0d,0x22,0x19,0xe7,0x27,0x00,0x01,0x21,0x30,0x1e,0x4b,0x27,0x00,
-0x05,0x0d,0x00,0x01,0x6f,0x20,0x12,0xbe,0xcc,0x26,0x02,0x1a,0x00,0x14,0x8d,0x0a,
-0x27,0x51,0x26,0xee,0xee,0xe5,0x05,0x23,0x4f,0xb0,0x55,0x5f,0x50,0x5f,0x00,0x00,
-0x0f,0x66,0xe0,0x00,0xf5,0x84,0x0b,0x46,0xf6,0x6e,0x00,0x0f,0x11,0x00,0xf4,0x02,
-0xfa,0xaa,0xaa,0xf6,0x6f,0xff,0xff,0x50,0x5f,0xaa,0xaa,0xaf,0x66,0xf5,0x55,0xf5,
-0x06,0x22,0x00,0x13,0x6f,0x22,0x00,0x23,0x07,0xe0,0x11,0x00,0x00,0x4e,0x13,0xe2,
-0x66,0xff,0xff,0xf5,0x0d,0xb3,0x33,0x33,0xf6,0x6f,0x55,0x55,0x12,0xf6,0x22,0x00,
-0x01,0x92,0x5a,0x13,0xf6,0x04,0x66,0x21,0x0f,0x60,0x04,0x33,0x20,0x05,0x56,0x58,
-0x99,0x5a,0xd2,0x00,0x00,0xdf,0xeb,0xe3,0x1f,0x00,0xab,0x07,0x32,0x4c,0xcc,0xcc,
-0x29,0x00,0x41,0x5f,0x66,0x9f,0x0c,0xca,0x1b,0xc2,0x5e,0x00,0x5f,0x05,0x66,0x6f,
-0xa6,0x66,0x30,0x5e,0x00,0x5f,0x1b,0x00,0x01,0x09,0x00,0x00,0x1b,0x34,0x41,0x5e,
-0x22,0x6f,0xbf,0x9f,0x09,0xc1,0x5f,0xff,0xff,0x34,0x44,0x44,0x49,0xe4,0x41,0x5e,
-0x11,0x6f,0x21,0x1e,0x00,0x24,0x00,0xa0,0x35,0x55,0x55,0x5a,0xf5,0x50,0x5e,0x00,
-0x5f,0x8e,0xb0,0x53,0x10,0xe1,0x36,0x00,0x01,0xd9,0x2b,0x51,0x5f,0x44,0x8f,0x03,
-0xf8,0x09,0x00,0x00,0x4d,0x94,0x11,0x50,0x2d,0x00,0x00,0x7f,0x1d,0x41,0x07,0xe0,
-0x00,0x14,0x49,0x0f,0x24,0x4a,0xe0,0x39,0x69,0x18,0x70,0xc7,0x08,0x13,0xfe,0x0b,
-0x0f,0x02,0x88,0x4e,0x1f,0xba,0x12,0x00,0x0a,0x04,0x04,0x1b,0x92,0x0b,0xcc,0xcc,
-0xcc,0xdf,0xdc,0xcc,0xcc,0xc9,0xe7,0x16,0x00,0x5b,0x45,0x20,0x04,0xcc,0x01,0x00,
-0x10,0xc3,0x7c,0x15,0x53,0x33,0x33,0x33,0x35,0xf4,0xb3,0x32,0x10,0x01,0x09,0x00,
-0x05,0x3e,0x38,0x60,0x27,0x31,0x5f,0x31,0x42,0x10,0xc7,0x25,0xf0,0x05,0x30,0x3f,
-0x20,0xaf,0xa4,0x00,0x08,0xee,0x70,0x11,0x6f,0x20,0x01,0x8f,0xc3,0x05,0x60,0x00,
-0x7f,0xfb,0x6f,0x20,0x15,0x0e,0x9a,0x42,0x51,0x44,0x44,0x44,0x48,0xf6,0xa4,0x36,
-0x14,0x00,0x04,0x25,0x06,0x88,0x38,0x80,0x2f,0x42,0x22,0x7f,0x42,0x22,0x3f,0x40,
-0x6d,0x3d,0x21,0x05,0xf1,0x66,0x00,0x14,0x2f,0x11,0x1d,0x80,0x02,0xf4,0x22,0x27,
-0xf4,0x22,0x23,0xf4,0xa6,0x13,0x00,0x39,0x00,0x27,0x1f,0x40,0x39,0x00,0x42,0x05,
-0xb3,0x33,0xcd,0x89,0x03,0x34,0x1e,0x90,0x2f,0xd4,0x25,0x23,0xbe,0xc0,0x86,0x04,
-0x22,0xaf,0xfb,0x71,0x58,0xfa,0x03,0x7b,0xfe,0x65,0xbf,0xfd,0xa8,0x76,0x55,0x00,
-0xdf,0xb5,0x00,0x00,0x14,0x8a,0xce,0xff,0xc0,0x35,0x48,0x11,0xb1,0xdb,0x03,0x90,
-0x88,0x88,0xaf,0x98,0x88,0x85,0x00,0x00,0x34,0x45,0x22,0x32,0x4d,0x90,0x0a,0x15,
-0x01,0x41,0xfe,0xcb,0x34,0x44,0x11,0x00,0xf1,0x05,0xb4,0x30,0x02,0x22,0x22,0x5f,
-0x42,0x22,0xd9,0x00,0x00,0xcc,0xcc,0xcd,0xfd,0xcc,0xcc,0x70,0x00,0x12,0x11,0x00,
-0x32,0x22,0x10,0x07,0x11,0x00,0x20,0xc8,0x01,0x33,0x18,0x54,0x31,0x11,0x11,0x11,
-0xcf,0x3a,0x04,0x05,0x7c,0x97,0x10,0x7f,0x4f,0x01,0x12,0xcf,0xdd,0x1f,0x01,0x85,
-0x01,0x11,0x7f,0xab,0x7d,0x08,0x11,0x00,0x02,0x94,0x63,0x08,0x99,0x00,0x14,0x9f,
-0x13,0x00,0x23,0x09,0xb0,0x25,0x00,0x0f,0x13,0x00,0x01,0x31,0x9e,0xcc,0xcc,0x22,
-0x12,0x15,0x00,0x6d,0x00,0x13,0xdd,0x01,0x00,0x61,0xc0,0x05,0x7f,0x65,0x5a,0xe5,
-0xca,0x1c,0x40,0x02,0xf3,0x11,0x8e,0xea,0x29,0x01,0x59,0x01,0x10,0xe5,0x94,0x06,
-0x00,0x88,0x30,0x51,0x7e,0x05,0xe0,0x00,0x9b,0x13,0x00,0xf1,0x12,0xe0,0x0c,0xa0,
-0x4f,0x30,0x00,0x02,0xf2,0x11,0x8e,0x00,0x1e,0xaf,0x50,0x00,0x03,0x6f,0x89,0xbe,
-0xfe,0x00,0xaf,0xe2,0x00,0x00,0xed,0xba,0x86,0xae,0x27,0xec,0x4a,0xfa,0x2d,0x35,
-0x51,0xe4,0xc5,0x00,0x03,0x9b,0x6a,0x0d,0x05,0xbb,0x8b,0x13,0xa0,0xae,0x38,0x20,
-0x7f,0x95,0x68,0x00,0x05,0xb2,0x2e,0x07,0x9f,0x79,0x15,0x0d,0xa9,0x88,0x03,0x1d,
-0x2c,0x50,0x04,0xff,0x95,0x55,0x55,0x3d,0x0c,0x31,0x6f,0xbf,0x60,0x0d,0x85,0x30,
-0x07,0xfc,0x0f,0x93,0x02,0xa4,0xfb,0x00,0x0b,0xa0,0x0f,0x94,0x44,0x44,0x44,0xcb,
-0xf5,0x47,0x00,0xda,0x2a,0x06,0x12,0x00,0x02,0x24,0x00,0x08,0x1b,0x00,0x52,0x60,
-0x00,0x04,0x55,0xda,0x09,0x00,0x30,0x08,0xff,0xc4,0x42,0x75,0x22,0x06,0x60,0x96,
-0x15,0xf3,0x02,0x00,0x0a,0xa0,0x0d,0xdd,0xdd,0xd6,0x04,0x8f,0x44,0x4c,0xc4,0x0f,
-0x96,0x66,0xf7,0x0e,0x6a,0x59,0x11,0xe7,0x1b,0x00,0x20,0x0f,0x40,0x7f,0x4e,0x30,
-0x33,0x3b,0xa0,0x1b,0x00,0x9b,0x00,0x5f,0xee,0xef,0xa0,0x0f,0xed,0xdd,0xf7,0x1b,
-0x00,0x00,0x09,0x00,0x00,0x1b,0x00,0x05,0x36,0x00,0x50,0x2f,0xff,0xff,0xf7,0x14,
-0x51,0x00,0x41,0x4f,0x42,0x22,0xe7,0x1d,0x27,0x10,0x6e,0x19,0x10,0x51,0x09,0x50,
-0x55,0x00,0x9c,0xcd,0x51,0xf0,0x01,0x30,0x5f,0x50,0xe8,0x00,0x00,0xe7,0x05,0xf7,
-0x00,0x08,0xe6,0xf1,0x02,0x56,0xf6,0xf1,0x54,0x3b,0x26,0xa0,0x03,0x3b,0x4d,0x2c,
-0x15,0x10,0x9e,0x3f,0x05,0x9f,0x3f,0x04,0x13,0x00,0x03,0x3c,0x38,0x10,0x90,0x8c,
-0x06,0x23,0x68,0xf9,0x4b,0x3b,0x0c,0x26,0x00,0x01,0x6e,0x02,0x00,0x5e,0x47,0x05,
-0xc2,0x24,0x72,0xe0,0x02,0x33,0x33,0x37,0xff,0xf9,0x11,0x03,0x42,0x02,0xec,0xfb,
-0xf3,0x2e,0x00,0x42,0xe9,0x3f,0x49,0xf4,0x89,0x79,0x20,0x02,0xf4,0xa5,0x3f,0x00,
-0xe4,0x67,0x90,0x2f,0x40,0x08,0xfb,0x10,0x00,0x7e,0xf5,0x00,0xb6,0x3e,0x41,0xef,
-0x81,0x0a,0x91,0x5f,0x00,0x2a,0x01,0x8b,0x98,0x00,0x1f,0x05,0xab,0x00,0x0e,0xb3,
-0x04,0x77,0x77,0x77,0x8f,0xa7,0x77,0x77,0x76,0x00,0x9e,0x5d,0x5b,0x1e,0xd0,0xd1,
-0x00,0x07,0x39,0x00,0x15,0x0a,0x9c,0x08,0x41,0x46,0x66,0x68,0xff,0x83,0x54,0x00,
-0x4e,0x49,0x04,0xab,0x00,0x32,0xdb,0x3f,0x48,0x57,0x00,0x51,0xeb,0x02,0xf4,0x08,
-0xf7,0xb7,0x5c,0x90,0x00,0x2f,0x40,0x07,0xfc,0x20,0x00,0x7e,0xf6,0x4c,0x00,0x52,
-0x03,0xef,0x91,0x09,0xa1,0x4c,0x00,0x0c,0xab,0x00,0x1b,0x20,0x4b,0x4a,0x0e,0x5e,
-0x4a,0x05,0x13,0x00,0x05,0x4d,0x28,0x91,0x03,0x77,0x77,0x7f,0xcf,0xcf,0x87,0x77,
-0x76,0x56,0x70,0x13,0xf6,0x15,0x35,0x43,0xda,0x0f,0x66,0xf1,0x57,0x28,0x32,0xf6,
-0x0d,0xb0,0x24,0x8d,0x42,0x0f,0x60,0x3f,0x60,0xb9,0x22,0x10,0xf6,0x44,0x4a,0x00,
-0xee,0x75,0x20,0x0f,0x60,0x88,0x29,0xc1,0x2c,0xf6,0x77,0x77,0xfa,0x77,0x76,0xdf,
-0x70,0x0b,0xe2,0x7f,0x0c,0x08,0x33,0xaf,0x20,0x11,0x72,0x00,0x1f,0x20,0x85,0x00,
-0x03,0x24,0x2d,0x60,0xac,0x05,0x32,0xf3,0x22,0x22,0x3a,0x18,0x04,0x07,0x2e,0x60,
-0x3d,0xfd,0x20,0x00,0x2d,0xc0,0x38,0x9c,0x70,0xa1,0xad,0x30,0x3d,0xd1,0x00,0x00,
-0x7b,0x4a,0x14,0x7f,0xfe,0x88,0x40,0x5a,0xfe,0xfb,0x51,0x1b,0x07,0xf2,0x05,0x7a,
-0xff,0xb4,0x04,0xbf,0xfb,0x86,0x30,0x1f,0xff,0xd9,0x20,0x3d,0x20,0x28,0xcf,0xfe,
-0x00,0x65,0x10,0xb8,0x28,0x31,0x30,0x00,0x04,0x98,0x27,0x15,0x44,0x5d,0x05,0x11,
-0xf1,0x02,0x66,0x41,0x3f,0x20,0x21,0x00,0x28,0x75,0x42,0x03,0xf2,0x0a,0xe4,0x8d,
-0x80,0x30,0x3f,0x20,0x07,0xfa,0xac,0x41,0xd3,0x00,0x36,0xf2,0x17,0x4e,0x43,0x20,
-0x00,0x0e,0xfb,0x85,0x60,0x14,0x51,0x44,0x79,0x23,0x1f,0x30,0xa9,0x20,0x13,0x01,
-0xcc,0x44,0x00,0x13,0x00,0x51,0x08,0xcc,0xfd,0xcc,0xb0,0x13,0x00,0x41,0x69,0xaf,
-0xa9,0xbe,0xcd,0x3b,0xf3,0x21,0xa0,0x07,0xf0,0x05,0xe0,0x00,0x05,0x59,0xf7,0x53,
-0x01,0xe9,0x00,0x5e,0x08,0x20,0x00,0xaf,0x30,0x01,0xcf,0x10,0x05,0xe0,0xc3,0x00,
-0x0f,0xfd,0x04,0xff,0x30,0x52,0x3f,0xee,0x10,0x05,0xef,0xdb,0x07,0x10,0x0f,0x70,
-0x14,0x10,0x00,0xb8,0xf4,0xe7,0x3c,0x3b,0xb2,0x2f,0x35,0x31,0x11,0x1f,0x81,0x11,
-0x10,0x0b,0x91,0xf3,0x94,0x18,0xb1,0x33,0xf2,0x1f,0x30,0x33,0x33,0x3f,0x93,0x33,
-0x30,0x05,0x74,0x17,0x14,0xf7,0x85,0x00,0x01,0xca,0x60,0x0f,0x13,0x00,0x01,0x14,
-0x50,0x4f,0x4d,0x13,0x5f,0x92,0x47,0x00,0xa7,0x06,0x41,0x0a,0xe3,0x22,0x23,0x13,
-0x41,0x11,0x01,0x24,0x1f,0x90,0x03,0x37,0xf4,0x30,0xbf,0x43,0x33,0x5f,0x60,0x09,
-0x11,0x20,0x8f,0xea,0xfe,0x0a,0x80,0x01,0x1b,0xf2,0x1d,0x72,0xe7,0x0a,0xe2,0x8a,
-0x12,0x41,0xb0,0x20,0x03,0xfc,0xbd,0xb6,0x40,0xfd,0x70,0x00,0x4e,0xa0,0x2c,0xf1,
-0x10,0x09,0xdf,0x4f,0x13,0xbf,0xa4,0xbf,0x93,0x00,0x00,0xe8,0xf0,0xbd,0xfd,0x40,
-0x00,0x5d,0xfd,0x00,0x6d,0x5f,0x04,0xb8,0x44,0x44,0x44,0x45,0x70,0x0e,0x65,0xf0,
-0xfe,0x0e,0x41,0x70,0x03,0xd0,0x5f,0x0a,0x08,0x41,0xe7,0x00,0x02,0x05,0x79,0x10,
-0x00,0x1f,0x01,0x04,0x13,0x00,0x23,0x00,0x05,0x26,0x00,0x00,0x13,0x00,0x00,0x4c,
-0x56,0x19,0xe7,0x8b,0x14,0x14,0x50,0x1c,0x02,0x14,0x4f,0x92,0xa1,0x10,0x04,0x54,
-0x67,0x02,0x11,0xab,0x00,0x32,0xb2,0x11,0xea,0x13,0x00,0x00,0x0f,0xa9,0xf0,0x0b,
-0xea,0x10,0x00,0xcc,0xdf,0xcc,0x3b,0xf8,0x44,0x47,0xfe,0x50,0x09,0x9c,0xf9,0xaf,
-0xcd,0xff,0xff,0xff,0xaf,0x20,0x00,0xbf,0x40,0x30,0x0d,0x0d,0xf0,0x0b,0x10,0x00,
-0x1f,0xfe,0x11,0x33,0x36,0xf4,0x33,0x31,0x00,0x06,0xff,0xa9,0x4f,0xee,0xef,0xee,
-0xef,0x40,0x00,0xca,0xf2,0xd4,0xf0,0x03,0x80,0x5c,0xd1,0x4e,0x5f,0x00,0x4f,0x00,
-0x3f,0x10,0x0f,0x40,0x0d,0x84,0xf0,0x04,0x30,0x07,0x92,0x01,0xc0,0x4f,0x00,0x02,
-0x22,0xbf,0xd3,0x22,0x72,0x00,0x21,0x4f,0x6f,0x17,0x89,0x00,0x49,0xad,0x20,0x5f,
-0x80,0x13,0x00,0xb0,0x05,0xbf,0x70,0x00,0x5e,0xf8,0x10,0x00,0x4f,0x03,0xe9,0x00,
-0x5a,0x08,0x26,0x07,0x06,0xb0,0x34,0x03,0x63,0x6c,0x00,0x6e,0x42,0x22,0x6f,0xff,
-0x76,0x2b,0x10,0xd5,0x93,0x4d,0x60,0x7e,0xd2,0x00,0x04,0x4e,0x94,0xbc,0x02,0x00,
-0xe5,0x1f,0x00,0x68,0x13,0x21,0xfb,0x20,0x00,0x03,0x50,0x6b,0xbb,0x1f,0x2f,0xff,
-0xee,0x47,0xf1,0x3a,0x08,0x95,0xe1,0xf2,0x22,0x2f,0x20,0x00,0x8f,0xf4,0x86,0x0e,
+0x02,0x2b,0xc2,0x3e,0xf7,0x00,0x2f,0x24,0x00,0x13,0xae,0x09,0x00,0xf0,0x06,0xb1,
+0xe4,0xef,0xff,0xff,0xff,0xf4,0x00,0x0a,0xc7,0xa0,0xea,0x55,0x7f,0x65,0x51,0x02,
+0x7e,0xff,0x90,0xe7,0x1b,0x00,0x41,0x2f,0xff,0xc0,0x00,0x09,0x00,0x52,0x05,0x1a,
+0xb0,0x00,0xef,0x2c,0x02,0x70,0xb0,0x00,0xe9,0x44,0x6f,0x64,0x41,0x09,0x00,0x13,
+0xe7,0x48,0x00,0x91,0x00,0xe8,0x22,0x4f,0x42,0x22,0x04,0x5d,0xa0,0x24,0x00,0x60,
+0xff,0x08,0xfd,0x40,0x00,0xe8,0xd4,0x08,0x06,0xa2,0x00,0x14,0x03,0xb1,0x02,0x20,
+0x0d,0x70,0x04,0x01,0x20,0x6f,0x10,0x09,0x00,0x41,0x2f,0x50,0x00,0xda,0x12,0x00,
+0xf1,0x03,0x09,0xd0,0x05,0xf2,0x00,0x01,0x1d,0x81,0x36,0x68,0xc7,0x6d,0xd6,0x66,
+0x1f,0xff,0xff,0xae,0xe9,0x07,0x35,0x03,0x3d,0x93,0x36,0x00,0xf1,0x1f,0x1d,0xdd,
+0xdc,0x03,0x10,0xe5,0x00,0x0d,0x70,0x1f,0x65,0x8e,0x0d,0x50,0xe5,0x00,0x0d,0x98,
+0x4f,0x10,0x4e,0x0d,0x50,0xe5,0x04,0x9f,0xfd,0x4f,0xcc,0xde,0x0d,0x50,0xe5,0x1f,
+0xce,0x80,0x1f,0x54,0x7e,0x0d,0x50,0xe5,0x01,0x0d,0x70,0x1f,0x1b,0x00,0x00,0x2d,
+0x00,0x23,0xdc,0xde,0x09,0x00,0x32,0x43,0x6e,0x0c,0x09,0x00,0xf7,0x08,0x10,0x4e,
+0x00,0x00,0xe5,0x03,0x4e,0x70,0x1f,0x13,0x7e,0x00,0x34,0xf5,0x0a,0xfd,0x20,0x1f,
+0x1a,0xe8,0x00,0xef,0xc1,0xfb,0x03,0x41,0x20,0x00,0x00,0x92,0x0a,0x00,0x60,0xf3,
+0x00,0x00,0x7f,0x43,0x30,0xc6,0x02,0x61,0x30,0x00,0x0e,0xfe,0xef,0xa0,0x13,0x00,
+0xf1,0x04,0x0a,0xd0,0x03,0xf2,0x00,0x00,0x2e,0xef,0xee,0x08,0xf6,0x33,0xcb,0x33,
+0x30,0x01,0x66,0xf8,0x65,0xc4,0x01,0x00,0x26,0x00,0x60,0x05,0xf0,0x03,0x03,0x03,
+0xf0,0x26,0x00,0xf1,0x21,0x1f,0x05,0xa0,0xe2,0x3f,0x00,0x00,0x0f,0x45,0x01,0xf1,
+0xd4,0x05,0xb3,0xf0,0x00,0x16,0xff,0xe0,0x1f,0x8a,0x00,0x0d,0x7f,0x00,0x4f,0xff,
+0x60,0x01,0xf3,0x15,0xe0,0x23,0xf0,0x01,0x51,0xf3,0x02,0x4f,0x43,0x9d,0x33,0x6f,
+0x30,0x00,0x0f,0x30,0xcf,0x43,0x00,0x10,0x20,0x72,0x00,0x32,0x03,0xfc,0x90,0x72,
+0x00,0xfe,0x0a,0x04,0xe8,0x1e,0x90,0x00,0x00,0x57,0xf2,0x02,0x5b,0xf7,0x00,0x1c,
+0xf9,0x51,0x0a,0xfb,0x01,0xec,0x81,0x00,0x00,0x04,0x9c,0x10,0x56,0x01,0x01,0x09,
+0x05,0x01,0x12,0x09,0x00,0x2f,0x02,0x11,0x3f,0xec,0x03,0x20,0x00,0xe6,0xd2,0x02,
+0x22,0x0a,0xa0,0x13,0x00,0x01,0xa1,0x03,0x41,0xff,0xff,0xf2,0x03,0x45,0x0a,0xf2,
+0x37,0x04,0x4f,0x94,0x01,0x12,0x21,0x12,0x22,0x10,0x00,0x00,0xe6,0x01,0xff,0xff,
+0x94,0xff,0xff,0x90,0x00,0x0e,0x60,0x1f,0x00,0x89,0x4c,0x00,0x99,0x00,0x00,0xe8,
+0x83,0xf0,0x08,0x94,0xc0,0x09,0x90,0x16,0x9f,0xd8,0x3f,0xff,0xfc,0x9f,0xff,0xf9,
+0x01,0xfe,0xf6,0x00,0x11,0x11,0x8d,0x11,0x11,0x00,0x06,0x0e,0x60,0x13,0x33,0x39,
+0xd3,0x33,0x33,0x00,0x00,0xe6,0x07,0x9b,0x03,0x00,0x5f,0x00,0x41,0x04,0xee,0xee,
+0x70,0x72,0x00,0xf6,0x07,0x3a,0xf5,0x7d,0x2d,0xc4,0x00,0x01,0x4f,0x64,0xdf,0xa2,
+0x07,0xd0,0x08,0xfd,0x10,0x4f,0xd2,0x18,0x20,0x00,0x7d,0x63,0x07,0x00,0x01,0x00,
+0x00,0x18,0x02,0x20,0x0b,0x70,0x67,0x03,0x00,0x98,0x04,0x30,0xf6,0x00,0x00,0x52,
+0x0a,0x40,0x0f,0x50,0x5f,0x20,0x13,0x00,0xf0,0x06,0x10,0x00,0xf5,0x0a,0xf8,0x88,
+0x88,0x81,0x03,0xfd,0xdd,0xdf,0x50,0xed,0xbb,0xbe,0xeb,0x20,0x3f,0x43,0x33,0xfd,
+0x0c,0x11,0xe8,0x26,0x00,0xf0,0x00,0x6d,0xfd,0x00,0x2f,0x40,0x00,0x3f,0x21,0x11,
+0xfd,0xf7,0xf1,0x05,0xf1,0x00,0xce,0x00,0x41,0xe8,0x0f,0x70,0xad,0x39,0x00,0x52,
+0xf6,0x00,0xad,0x1f,0x70,0x4c,0x00,0xf0,0x2f,0x04,0xfa,0xf1,0x00,0x00,0x3f,0xdc,
+0xcc,0xf5,0x00,0x0c,0xf9,0x00,0x00,0x01,0x58,0x55,0x75,0x20,0x00,0xaf,0x70,0x00,
+0x00,0x05,0xf2,0x1f,0x70,0x00,0x8f,0xef,0x40,0x00,0x00,0xda,0x00,0x6f,0x20,0x8f,
+0x90,0xde,0x30,0x00,0x8f,0x20,0x00,0xcb,0xdf,0x90,0x01,0xdf,0x80,0x1e,0x60,0x00,
+0x00,0x7e,0x40,0x00,0x00,0x9e,0x10,0x55,0x01,0x02,0x04,0x00,0x60,0x50,0x1f,0x30,
+0x51,0x01,0xa1,0xf1,0x03,0x50,0x51,0xf3,0x2f,0x30,0x5f,0xbe,0x00,0x50,0x7c,0x1f,
+0x3b,0x90,0x08,0xcc,0x0d,0xf1,0x00,0x68,0x97,0xf9,0x97,0x60,0xcb,0x44,0x44,0x40,
+0x0b,0xbb,0xef,0xeb,0xbb,0x1f,0xae,0x08,0x50,0x4f,0xff,0xa1,0x04,0xf6,0x10,0x0c,
+0xf1,0x17,0x5f,0x7f,0x4a,0xe3,0xaf,0x90,0x0e,0x60,0x00,0xbf,0x61,0xf3,0x06,0x3f,
+0xad,0x01,0xf2,0x00,0x07,0x20,0x37,0x10,0x0a,0xc1,0xf2,0x5f,0x00,0x00,0x12,0x2e,
+0x92,0x22,0x13,0x0d,0x7a,0xa0,0x00,0x09,0x50,0x03,0xb0,0x7d,0xf4,0x00,0x00,0x01,
+0xe8,0x00,0x8d,0x00,0x01,0xfe,0x80,0x04,0x50,0x30,0x3f,0x50,0x00,0x2f,0x8e,0x04,
+0x70,0xaf,0xbd,0xa0,0x00,0x0d,0xdf,0x80,0xb2,0x06,0xf0,0x0b,0xfa,0x10,0x0b,0xe1,
+0x6f,0x40,0x00,0x05,0xbf,0x73,0xd6,0x3d,0xe2,0x00,0xaf,0x80,0x0d,0xe9,0x20,0x00,
+0x2f,0xb1,0x00,0x00,0x8f,0x20,0x34,0x01,0x13,0x40,0xaf,0x00,0x24,0x00,0x89,0x62,
+0x01,0x15,0x07,0x80,0x07,0x11,0x0e,0x1e,0x08,0x00,0xe6,0x06,0x64,0xba,0x66,0x66,
+0x66,0x60,0x0e,0x35,0x09,0x30,0x00,0x00,0x0c,0x1a,0x00,0x10,0xcc,0x1e,0x00,0x51,
+0x4f,0x30,0x00,0x00,0x4f,0xa6,0x05,0x51,0xcb,0x00,0x00,0x0c,0xd0,0x7b,0x07,0x42,
+0xf5,0x00,0x04,0xf6,0x0d,0x03,0x33,0xf2,0x01,0xec,0x83,0x03,0x23,0xd1,0xce,0x6e,
+0x02,0x33,0x2f,0xef,0x40,0x3a,0x09,0x13,0xcf,0x84,0x04,0x42,0x05,0xee,0x7e,0xf7,
+0x5a,0x0e,0xf1,0x03,0xfb,0x10,0x1a,0xfc,0x30,0x00,0x00,0x16,0xdf,0xe6,0x00,0x00,
+0x06,0xef,0xd7,0x20,0x0e,0xfc,0x5a,0x00,0x43,0x5b,0xfe,0x10,0x43,0x02,0x06,0x41,
+0x30,0x00,0x00,0x9a,0xed,0x09,0x20,0x60,0x00,0x55,0x09,0x60,0x01,0x58,0xbf,0xfb,
+0x20,0x0b,0x0d,0x08,0xc1,0x7f,0xa7,0x40,0x00,0x00,0x26,0xa3,0x33,0xc6,0x17,0xd0,
+0x00,0x0b,0x02,0x31,0x3f,0x20,0x7d,0x33,0x00,0x50,0xe4,0x09,0xb0,0x07,0xd0,0x82,
+0x00,0xf0,0x12,0xde,0xdd,0xfe,0xdb,0x7f,0xbb,0xbb,0xbb,0x10,0x55,0x57,0xf6,0x55,
+0x47,0xe9,0x9b,0xf9,0x91,0x00,0x00,0x2f,0x10,0x00,0x7c,0x00,0x4f,0x00,0x00,0x44,
+0x46,0xf5,0x44,0x29,0xcd,0x08,0x00,0xe4,0x00,0x20,0xf9,0xaa,0x13,0x00,0xf0,0x00,
+0x02,0x22,0xf1,0x40,0x0b,0x90,0x04,0xf0,0x00,0x00,0xc8,0x2f,0x2d,0x60,0xc7,0x13,
+0x00,0x70,0x4f,0x12,0xf1,0x4e,0x1f,0x40,0x04,0xb5,0x02,0x40,0x2f,0x10,0xa7,0xf0,
+0x13,0x00,0x60,0x10,0x26,0xf1,0x00,0xc9,0x00,0x26,0x00,0x90,0x09,0xfb,0x00,0x1c,
+0x20,0x00,0x4f,0x00,0x00,0x62,0x00,0x00,0x00,0x02,0xa0,0x00,0x01,0x00,0x23,0x2f,
+0x80,0x09,0x00,0x10,0xae,0x16,0x00,0xa2,0x66,0x66,0x66,0x69,0xb6,0x66,0x66,0x66,
+0x6f,0xff,0x01,0x00,0x52,0xe0,0x00,0x00,0x6f,0x20,0x20,0x00,0x23,0x07,0xf0,0x29,
+0x00,0x90,0x9f,0x33,0x33,0x33,0x33,0x00,0x00,0x00,0x0b,0x21,0x00,0xf3,0x38,0xc0,
+0x00,0x00,0x00,0xfa,0x22,0x22,0x22,0xbb,0x00,0x00,0x00,0x3f,0x50,0x00,0x00,0x0c,
+0xa0,0x00,0x00,0x08,0xf1,0x00,0x00,0x00,0xd8,0x00,0x00,0x01,0xe9,0x00,0x00,0x00,
+0x0f,0x60,0x00,0x00,0xaf,0x20,0x00,0x00,0x02,0xf4,0x00,0x00,0x8f,0x60,0x00,0x00,
+0x00,0x6f,0x10,0x02,0xbf,0x80,0x00,0x05,0x55,0x6d,0xc0,0x00,0x7e,0x50,0x00,0x00,
+0x8f,0xff,0xd3,0x00,0x00,0x10,0x5b,0x00,0xf2,0x13,0x0f,0xff,0xff,0xf1,0x3b,0xbb,
+0xbb,0xbb,0x90,0x0f,0x84,0x47,0xf1,0x28,0x88,0xcd,0x88,0x60,0x0f,0x40,0x03,0xf1,
+0x00,0x10,0x9a,0x00,0x00,0x0f,0x62,0x25,0xf1,0x09,0xa0,0xaa,0x24,0x00,0x50,0x0c,
+0x70,0xb9,0x00,0x00,0x1b,0x00,0x32,0x1f,0x30,0xd7,0x09,0x00,0x50,0x7f,0x44,0xf8,
+0x44,0x40,0x1b,0x00,0xc0,0xaf,0xef,0xfe,0xee,0xe1,0x0f,0x84,0x44,0x40,0x00,0x06,
+0xf0,0x1b,0x00,0x50,0x05,0x00,0x00,0x0b,0xfc,0x09,0x00,0x50,0x1f,0x50,0x00,0x2f,
+0xac,0x09,0x00,0xf1,0x1b,0x09,0xd0,0x00,0xac,0x6c,0x00,0x00,0x0f,0x54,0xbf,0xf4,
+0x04,0xf5,0x6c,0x00,0x72,0x2f,0xef,0xa2,0xb8,0x1e,0xc0,0x6c,0x00,0xa4,0x7f,0xa2,
+0x00,0x00,0xcf,0x20,0x5e,0x44,0xe2,0x13,0x00,0x00,0x09,0xf4,0x00,0x2d,0xff,0x24,
+0x01,0x10,0x30,0x05,0x00,0x20,0x36,0x66,0x01,0x00,0x11,0x67,0x14,0x01,0x20,0xfe,
+0x7e,0x12,0x00,0x30,0x08,0xe7,0xe0,0x07,0x00,0x1a,0x8e,0x0d,0x00,0x62,0x11,0x11,
+0x11,0x11,0x19,0xe7,0x27,0x00,0x6e,0x7f,0x44,0x44,0x44,0x44,0x4b,0x27,0x00,0x05,
+0x0d,0x00,0x10,0xf6,0x54,0x00,0x21,0xbe,0x7f,0x2e,0x00,0x02,0x1a,0x00,0x10,0x8d,
+0x05,0x00,0xf6,0x12,0x14,0x44,0x44,0x44,0x26,0xee,0xee,0xe5,0x05,0xff,0xff,0xff,
+0xf6,0x6f,0x55,0x5f,0x50,0x5f,0x00,0x00,0x0f,0x66,0xe0,0x00,0xf5,0x05,0xf0,0x00,
+0x00,0xf6,0x6e,0x00,0x0f,0x11,0x00,0xf4,0x02,0xfa,0xaa,0xaa,0xf6,0x6f,0xff,0xff,
+0x50,0x5f,0xaa,0xaa,0xaf,0x66,0xf5,0x55,0xf5,0x06,0x22,0x00,0x13,0x6f,0x22,0x00,
+0x23,0x07,0xe0,0x11,0x00,0xf2,0x03,0xaf,0xff,0xff,0xff,0x66,0xff,0xff,0xf5,0x0d,
+0xb3,0x33,0x33,0xf6,0x6f,0x55,0x55,0x12,0xf6,0x22,0x00,0x60,0x00,0x9f,0x10,0x00,
+0x00,0xf6,0xbd,0x01,0x12,0x80,0xac,0x01,0xe4,0x2e,0xd0,0x00,0x05,0x56,0xf5,0x00,
+0x00,0x05,0xd2,0x00,0x00,0xdf,0xeb,0x99,0x01,0x02,0x01,0x00,0x72,0x0e,0x60,0x00,
+0x00,0x4c,0xcc,0xcc,0x29,0x00,0xf2,0x06,0x5f,0x66,0x9f,0x0c,0xdd,0xdf,0xed,0xdd,
+0x60,0x5e,0x00,0x5f,0x05,0x66,0x6f,0xa6,0x66,0x30,0x5e,0x00,0x5f,0x1b,0x00,0x02,
+0x09,0x00,0x70,0x70,0x00,0x00,0x5e,0x22,0x6f,0xbf,0xde,0x00,0xd0,0xf5,0x5f,0xff,
+0xff,0x34,0x44,0x44,0x49,0xe4,0x41,0x5e,0x11,0x6f,0x4c,0x02,0x10,0xe0,0x24,0x00,
+0xf0,0x00,0x35,0x55,0x55,0x5a,0xf5,0x50,0x5e,0x00,0x5f,0x8e,0xee,0xee,0xef,0xfe,
+0xe1,0x36,0x00,0x10,0x40,0x1b,0x00,0x51,0x5f,0x44,0x8f,0x03,0xf8,0x09,0x00,0x51,
+0xff,0xff,0x00,0x5f,0x50,0x2d,0x00,0x80,0x00,0x00,0x09,0xd0,0x07,0xe0,0x00,0x14,
+0x87,0x00,0x33,0x24,0x4a,0xe0,0xbc,0x02,0x27,0xfe,0x70,0x9e,0x00,0xb0,0x0c,0xfe,
+0xee,0xee,0xee,0xee,0xfa,0x00,0x00,0x0c,0x90,0x0f,0x00,0x1f,0xba,0x12,0x00,0x09,
+0x00,0x01,0x00,0x20,0x8c,0x00,0xc5,0x02,0xa2,0xcc,0xcc,0xcc,0xdf,0xdc,0xcc,0xcc,
+0xc9,0x04,0x44,0x01,0x00,0x40,0x43,0x00,0x04,0xcc,0x01,0x00,0xd0,0xc3,0x00,0x00,
+0x05,0xf4,0x33,0x33,0x33,0x35,0xf4,0x00,0x00,0x05,0xfb,0x02,0x10,0x01,0x09,0x00,
+0x01,0xac,0x01,0xf3,0x18,0xf4,0x00,0x00,0x00,0x27,0x31,0x5f,0x31,0x42,0x10,0x00,
+0x00,0x05,0xed,0x30,0x3f,0x20,0xaf,0xa4,0x00,0x08,0xee,0x70,0x11,0x6f,0x20,0x01,
+0x8f,0xc3,0x05,0x60,0x00,0x7f,0xfb,0x00,0x00,0x01,0x81,0x0e,0x43,0x03,0xa1,0xf7,
+0x00,0x44,0x44,0x44,0x48,0xf6,0x44,0x44,0x44,0x49,0x03,0x11,0x5f,0x53,0x01,0x24,
+0x02,0xff,0x4a,0x00,0xe1,0x2f,0x42,0x22,0x7f,0x42,0x22,0x3f,0x40,0x00,0x02,0xf2,
+0x00,0x05,0xf1,0x66,0x00,0x12,0x2f,0x1d,0x00,0x90,0x40,0x00,0x02,0xf4,0x22,0x27,
+0xf4,0x22,0x23,0x13,0x00,0x10,0x20,0x39,0x00,0x27,0x1f,0x40,0x39,0x00,0x42,0x05,
+0xb3,0x33,0xcd,0x89,0x03,0x33,0x1e,0x90,0x2f,0x08,0x01,0x32,0x3f,0xbe,0xc0,0x09,
+0x00,0x40,0x02,0xaf,0xfb,0x40,0x08,0x00,0xf9,0x04,0x04,0x7b,0xfe,0x65,0xbf,0xfd,
+0xa8,0x76,0x55,0x00,0xdf,0xb5,0x00,0x00,0x14,0x8a,0xce,0xff,0xc0,0xd2,0x01,0x21,
+0x02,0xb1,0xdb,0x03,0xf2,0x01,0x88,0x88,0xaf,0x98,0x88,0x85,0x00,0x00,0x34,0x44,
+0x47,0xf6,0x44,0x4d,0x90,0x0a,0x15,0x01,0x41,0xfe,0xcb,0x34,0x44,0x11,0x00,0xf1,
+0x05,0xb4,0x30,0x02,0x22,0x22,0x5f,0x42,0x22,0xd9,0x00,0x00,0xcc,0xcc,0xcd,0xfd,
+0xcc,0xcc,0x70,0x00,0x12,0x11,0x00,0x32,0x22,0x10,0x07,0x11,0x00,0xb4,0xc8,0x01,
+0x11,0x11,0x11,0x4f,0x31,0x11,0x11,0x11,0xcf,0x3a,0x04,0x20,0x01,0x22,0x01,0x00,
+0x40,0x21,0x00,0x00,0x7f,0x4f,0x01,0x20,0xcf,0xa0,0xd1,0x01,0x02,0x85,0x01,0x10,
+0x7f,0x84,0x01,0x18,0xef,0x11,0x00,0x01,0x32,0x00,0x18,0xa0,0x99,0x00,0x14,0x9f,
+0x13,0x00,0x23,0x09,0xb0,0x25,0x00,0x0f,0x13,0x00,0x01,0x10,0x9e,0x5b,0x00,0x45,
+0xce,0xa0,0x00,0x00,0x6d,0x00,0x13,0xdd,0x01,0x00,0xf0,0x01,0xc0,0x05,0x7f,0x65,
+0x5a,0xe5,0x55,0x55,0x55,0x55,0x00,0x02,0xf3,0x11,0x8e,0x13,0x2a,0x01,0x00,0x59,
+0x01,0xe1,0xe5,0xff,0xff,0xff,0xf3,0x00,0x02,0xf1,0x00,0x7e,0x05,0xe0,0x00,0x9b,
+0x13,0x00,0xf0,0x13,0xe0,0x0c,0xa0,0x4f,0x30,0x00,0x02,0xf2,0x11,0x8e,0x00,0x1e,
+0xaf,0x50,0x00,0x03,0x6f,0x89,0xbe,0xfe,0x00,0xaf,0xe2,0x00,0x00,0xed,0xba,0x86,
+0xae,0x27,0xec,0x4a,0xfa,0x50,0x23,0x01,0x50,0xe4,0xc5,0x00,0x03,0x9b,0x78,0x00,
+0x14,0x06,0x31,0x05,0x11,0x0d,0xb1,0x00,0x50,0x03,0x55,0x55,0x7f,0x95,0x68,0x00,
+0x13,0x09,0xf9,0x00,0x54,0xfe,0x00,0x00,0x03,0xf6,0x23,0x00,0x13,0xd0,0x09,0x00,
+0x10,0x8f,0x1a,0x00,0x50,0xfa,0x00,0x00,0x04,0xff,0x2c,0x00,0x50,0xcb,0x00,0x00,
+0x6f,0xbf,0x0c,0x05,0x50,0xab,0x00,0x07,0xfc,0x0f,0x93,0x02,0xa3,0xfb,0x00,0x0b,
+0xa0,0x0f,0x94,0x44,0x44,0x44,0xcb,0x33,0x05,0x20,0x00,0xab,0x09,0x00,0x05,0x12,
+0x00,0x02,0x24,0x00,0x08,0x1b,0x00,0x52,0x60,0x00,0x04,0x55,0xda,0x09,0x00,0x80,
+0x08,0xff,0xc4,0x00,0x00,0x38,0x00,0x06,0x1c,0x00,0x00,0x7d,0x03,0xf1,0x00,0x0a,
+0xa0,0x0d,0xdd,0xdd,0xd6,0x04,0x8f,0x44,0x4c,0xc4,0x0f,0x96,0x66,0xf7,0x89,0x02,
+0x41,0x1f,0x40,0x00,0xe7,0x1b,0x00,0x10,0x0f,0x09,0x00,0x40,0x5f,0x33,0x3b,0xa0,
+0x1b,0x00,0x9b,0x00,0x5f,0xee,0xef,0xa0,0x0f,0xed,0xdd,0xf7,0x1b,0x00,0x00,0x09,
+0x00,0x00,0x1b,0x00,0x05,0x36,0x00,0x50,0x2f,0xff,0xff,0xf7,0x14,0x51,0x00,0x50,
+0x4f,0x42,0x22,0xe7,0x3f,0x51,0x00,0xa0,0x6e,0x00,0x00,0xe7,0x00,0x09,0x50,0x55,
+0x00,0x9c,0x09,0x00,0xf9,0x0b,0x6f,0x30,0x5f,0x50,0xe8,0x00,0x00,0xe7,0x05,0xf7,
+0x00,0x08,0xe6,0xf1,0x02,0x56,0xf6,0x0c,0x80,0x00,0x00,0x26,0xa0,0x03,0xff,0xc1,
+0x6f,0x02,0x14,0x15,0x50,0x04,0x00,0x0e,0x06,0x03,0xc4,0x03,0x1a,0x40,0x13,0x00,
+0x12,0x4f,0x46,0x01,0x10,0x90,0x8c,0x06,0x5f,0x68,0xf9,0x66,0x66,0x64,0x26,0x00,
+0x01,0x01,0x6e,0x02,0x64,0x51,0x11,0x11,0x11,0x00,0xaf,0x6f,0x02,0x62,0x02,0x33,
+0x33,0x37,0xff,0xf9,0x11,0x03,0x42,0x02,0xec,0xfb,0xf3,0x2e,0x00,0x41,0xe9,0x3f,
+0x49,0xf4,0x08,0x03,0x50,0xfa,0x02,0xf4,0x09,0xf6,0x46,0x04,0xa0,0xf9,0x00,0x2f,
+0x40,0x08,0xfb,0x10,0x00,0x7e,0xf5,0x4c,0x00,0x51,0x04,0xef,0x81,0x0a,0x91,0x5f,
+0x00,0x2a,0x01,0x8b,0x98,0x00,0x1f,0x05,0xab,0x00,0x0e,0xe0,0x04,0x77,0x77,0x77,
+0x8f,0xa7,0x77,0x77,0x76,0x00,0x9e,0xee,0xee,0xee,0xa2,0x01,0x1e,0xd0,0xd1,0x00,
+0x07,0x39,0x00,0x13,0x0a,0xab,0x00,0xa0,0x00,0x00,0x46,0x66,0x68,0xff,0xfa,0x66,
+0x66,0x50,0xca,0x00,0x05,0xab,0x00,0x32,0xdb,0x3f,0x48,0x57,0x00,0x50,0xeb,0x02,
+0xf4,0x08,0xf7,0xab,0x00,0xa0,0xfa,0x00,0x2f,0x40,0x07,0xfc,0x20,0x00,0x7e,0xf6,
+0x4c,0x00,0x52,0x03,0xef,0x91,0x09,0xa1,0x4c,0x00,0x0c,0xab,0x00,0x14,0x20,0x0a,
+0x00,0x04,0x78,0x02,0x02,0x28,0x02,0x0f,0x13,0x00,0x01,0x14,0x8f,0x30,0x01,0x90,
+0x03,0x77,0x77,0x7f,0xcf,0xcf,0x87,0x77,0x76,0x41,0x00,0x32,0xf3,0xf6,0xd9,0x25,
+0x00,0x41,0xda,0x0f,0x66,0xf1,0x09,0x00,0x51,0x7f,0x20,0xf6,0x0d,0xb0,0xbc,0x00,
+0x40,0x70,0x0f,0x60,0x3f,0x3b,0x00,0xb0,0x1d,0xd0,0x00,0xf6,0x00,0x9f,0x40,0x00,
+0x00,0x0c,0xe2,0x4c,0x00,0xe1,0xbf,0x30,0x00,0x2c,0xf6,0x77,0x77,0xfa,0x77,0x76,
+0xdf,0x70,0x0b,0xe2,0xc2,0x03,0x43,0xc0,0xaf,0x20,0x11,0x72,0x00,0x1f,0x20,0x85,
+0x00,0x03,0x24,0x2d,0x60,0xac,0x05,0x31,0xf3,0x22,0x22,0x24,0x00,0x10,0x1c,0x39,
+0x00,0x00,0x52,0x03,0xf2,0x09,0x3d,0xfd,0x20,0x00,0x2d,0xc0,0x00,0x00,0x01,0x9f,
+0xa1,0xad,0x30,0x3d,0xd1,0x00,0x00,0x00,0x1b,0x40,0x00,0x7f,0xbf,0x90,0x30,0x00,
+0x40,0x5a,0xfe,0xfb,0x51,0x1b,0x07,0xf5,0x14,0x7a,0xff,0xb4,0x04,0xbf,0xfb,0x86,
+0x30,0x1f,0xff,0xd9,0x20,0x3d,0x20,0x28,0xcf,0xfe,0x00,0x65,0x10,0x00,0x03,0xf2,
+0x00,0x00,0x03,0x30,0x00,0x04,0x44,0x44,0x7f,0x64,0x44,0x44,0x5d,0x05,0x10,0xf1,
+0x9e,0x03,0x41,0x20,0x3f,0x20,0x21,0x24,0x01,0x50,0xf6,0x03,0xf2,0x0a,0xe4,0x56,
+0x01,0xf0,0x01,0xf5,0x00,0x3f,0x20,0x07,0xf5,0x00,0x00,0x0c,0xd3,0x00,0x36,0xf2,
+0x00,0x06,0xf4,0xad,0x00,0x50,0x0e,0xfb,0x00,0x00,0x03,0x27,0x00,0x41,0x51,0x00,
+0x00,0x04,0x98,0x00,0x20,0x1f,0x30,0xc3,0x08,0x00,0xa1,0x01,0x52,0xf3,0x00,0x00,
+0x0e,0x70,0x13,0x00,0x51,0x08,0xcc,0xfd,0xcc,0xb0,0x13,0x00,0xf0,0x2d,0x69,0xaf,
+0xa9,0xbe,0x00,0x00,0xef,0xff,0xff,0xa0,0x07,0xf0,0x05,0xe0,0x00,0x05,0x59,0xf7,
+0x53,0x01,0xe9,0x00,0x5e,0x08,0x20,0x00,0xaf,0x30,0x01,0xcf,0x10,0x05,0xe0,0xc3,
+0x00,0x0f,0xfd,0x04,0xff,0x30,0x52,0x3f,0xee,0x10,0x05,0xef,0xdb,0x07,0x10,0x0f,
+0x70,0x14,0x10,0x00,0xb8,0xf4,0xe7,0x00,0x00,0xf7,0xa8,0x05,0xc1,0x2f,0x35,0x31,
+0x11,0x1f,0x81,0x11,0x10,0x0b,0x91,0xf3,0x0d,0xad,0x00,0xc0,0x33,0xf2,0x1f,0x30,
+0x33,0x33,0x3f,0x93,0x33,0x30,0x05,0x01,0x11,0x02,0x14,0xf7,0x85,0x00,0x23,0x0f,
+0x70,0x85,0x00,0x0c,0x13,0x00,0x13,0x50,0x9b,0x08,0x00,0x6c,0x07,0x10,0x3f,0x0a,
+0x00,0x00,0xa7,0x06,0x50,0x0a,0xe3,0x22,0x23,0x10,0x13,0x00,0xf0,0x1b,0x01,0xff,
+0xff,0xff,0xfd,0x00,0x03,0x37,0xf4,0x30,0xbf,0x43,0x33,0x5f,0x60,0x00,0xff,0xff,
+0xff,0x8f,0xea,0x00,0x0c,0xd0,0x00,0x01,0x1b,0xf2,0x1d,0x72,0xe7,0x0a,0xe2,0x00,
+0x00,0x00,0xff,0xb0,0x20,0x03,0xfc,0xf3,0x74,0x03,0xf0,0x18,0xfd,0x70,0x00,0x4e,
+0xfd,0x20,0x00,0x00,0x09,0xdf,0x4f,0x13,0xbf,0xa4,0xbf,0x93,0x00,0x00,0xe8,0xf0,
+0xbd,0xfd,0x40,0x00,0x5d,0xfd,0x00,0x6d,0x5f,0x04,0xb8,0x44,0x44,0x44,0x45,0x70,
+0x0e,0x65,0xf0,0xf1,0x00,0x51,0xff,0x70,0x03,0xd0,0x5f,0x0a,0x08,0x72,0xe7,0x00,
+0x02,0x05,0xf0,0x00,0xe6,0x1f,0x01,0x04,0x13,0x00,0x23,0x00,0x05,0x26,0x00,0x01,
+0x13,0x00,0x48,0x94,0x44,0x44,0xe7,0x00,0x04,0x24,0x01,0x50,0x1c,0x02,0x23,0x4f,
+0x00,0xb6,0x00,0x63,0x04,0xf0,0x00,0x00,0x0c,0xfa,0x13,0x00,0x32,0x09,0xe4,0xea,
+0x13,0x00,0xf1,0x3d,0x09,0xf2,0x02,0xea,0x10,0x00,0xcc,0xdf,0xcc,0x3b,0xf8,0x44,
+0x47,0xfe,0x50,0x09,0x9c,0xf9,0xaf,0xcd,0xff,0xff,0xff,0xaf,0x20,0x00,0xbf,0x40,
+0x30,0x00,0x3f,0x10,0x00,0x10,0x00,0x1f,0xfe,0x11,0x33,0x36,0xf4,0x33,0x31,0x00,
+0x06,0xff,0xa9,0x4f,0xee,0xef,0xee,0xef,0x40,0x00,0xca,0xf2,0xd4,0xf0,0x03,0xf1,
+0x00,0xf4,0x00,0x4e,0x5f,0x00,0x4f,0x00,0x3f,0x10,0x0f,0x40,0x0d,0x84,0xf0,0x04,
+0x30,0x07,0x92,0x01,0xc0,0x4f,0x00,0x02,0x22,0xbf,0xd3,0x22,0x72,0x00,0x32,0x4f,
+0x6f,0x70,0x72,0x00,0x40,0x5f,0x90,0x5f,0x80,0x13,0x00,0xf8,0x00,0x05,0xbf,0x70,
+0x00,0x5e,0xf8,0x10,0x00,0x4f,0x03,0xe9,0x20,0x00,0x00,0x07,0x26,0x07,0x15,0x04,
+0x05,0x09,0x24,0xd5,0x00,0xd8,0x05,0x11,0x50,0x21,0x0b,0xe0,0xb0,0x00,0x00,0xd5,
+0x01,0x44,0x44,0x44,0x7e,0xd2,0x00,0x04,0x4e,0x94,0xbc,0x02,0xa1,0x90,0x00,0x00,
+0xff,0xff,0xf0,0x00,0x00,0xfb,0x20,0x00,0x03,0xf1,0x43,0x6b,0xbb,0x1f,0x2f,0xff,
+0xf4,0x00,0x04,0xfb,0x08,0x95,0xe1,0xf2,0x22,0x2f,0x20,0x00,0x8f,0xf4,0x86,0x0e,
 0x1f,0x28,0x13,0xf0,0x00,0x0c,0xfa,0xd8,0x60,0xe1,0xf2,0x9b,0x7b,0x00,0x02,0xed,
 0x6b,0x96,0x0e,0x1f,0x20,0xdf,0x50,0x00,0x89,0xd5,0x08,0x71,0xe1,0xf2,0x06,0xf3,
 0x00,0x1f,0x4d,0x50,0x8f,0xfe,0x1f,0x21,0xed,0xc0,0x03,0xc0,0xd5,0x08,0x60,0x71,
 0xf3,0xcb,0x0e,0x50,0x02,0x0d,0x50,0x00,0x17,0x8f,0x5b,0x00,0x43,0x85,0x00,0x21,
-0x98,0x40,0x85,0x00,0x12,0x56,0x2f,0x18,0x43,0x00,0x00,0xd5,0x25,0x3e,0x3a,0x05,
-0xb5,0x04,0x06,0x41,0x59,0x51,0x0e,0x50,0x5f,0xff,0xf2,0x5d,0x26,0xf0,0x14,0xe5,
-0x05,0xd3,0x4f,0x03,0x36,0xf3,0x20,0x00,0x0e,0x50,0x5c,0x01,0xf0,0x34,0x3e,0x00,
-0x00,0xbb,0xfd,0xb5,0xd3,0x4f,0x09,0x84,0xe0,0x00,0x09,0xaf,0xc9,0x5f,0xdd,0xf0,
-0xb6,0x5c,0x13,0x65,0xf0,0x11,0x05,0xc0,0x1f,0x0e,0x37,0xb0,0x00,0x00,0x7f,0xf2,
-0x5d,0x01,0xf2,0xf4,0xbb,0x44,0x00,0x0b,0xfc,0xc5,0xff,0xff,0x6f,0xff,0xfe,0xe0,
-0x00,0xef,0x5c,0x6d,0x22,0x20,0xcd,0x03,0x50,0x5b,0xe5,0x05,0xc0,0xb3,0x26,0x3c,
-0xf0,0x0d,0x0c,0x5e,0x50,0x5c,0x06,0xb0,0x0b,0xeb,0x00,0x03,0xe0,0xe5,0x05,0xc2,
-0xcf,0x22,0xf7,0xb0,0x00,0x03,0x0e,0x50,0x8f,0xf7,0xa6,0xb8,0x6b,0x06,0x24,0x54,
-0xf1,0x00,0xc2,0x00,0x5e,0x16,0xb0,0xc0,0x00,0x0e,0x50,0x40,0x00,0x3e,0x30,0x6c,
-0x2e,0x98,0x00,0x59,0x0c,0x50,0x02,0xef,0x90,0x15,0x02,0x00,0x03,0x00,0x12,0x42,
-0x90,0x01,0x01,0xe7,0x12,0x00,0xa3,0x01,0x50,0x15,0xf2,0x11,0xe7,0x11,0x13,0x00,
-0x10,0x6e,0x2c,0x38,0x40,0xb0,0x00,0x04,0xf0,0x20,0x13,0x20,0xe6,0x00,0x15,0x02,
-0x11,0x2f,0x7a,0x16,0x41,0x06,0x6b,0xf6,0x61,0xfa,0x12,0x00,0x9d,0x5c,0x12,0xdf,
-0x7c,0x56,0xf2,0x18,0x1f,0xf9,0x01,0x22,0x24,0xf4,0x22,0x22,0x00,0x06,0xff,0xf3,
-0x04,0x44,0x6f,0x64,0x44,0x00,0x00,0xcb,0xf8,0xd0,0xed,0xcc,0xfc,0xcc,0xf2,0x00,
-0x3f,0x5f,0x0d,0x1e,0x60,0x3f,0x30,0x3f,0x20,0x0b,0x94,0xa4,0x02,0xf3,0x00,0xf2,
-0x02,0xf1,0x4f,0x00,0x0e,0x50,0x2f,0x20,0x2f,0x20,0x04,0x04,0xf0,0x3f,0xb2,0x2e,
-0x41,0x4f,0x00,0x2e,0x72,0x03,0x4e,0x20,0x04,0xf0,0xae,0x00,0x10,0x25,0xa3,0x28,
-0x00,0xac,0x54,0x23,0x3f,0xfb,0xc0,0x02,0x03,0x13,0x4d,0x04,0x1e,0x02,0x12,0xf0,
-0x42,0x40,0x00,0x13,0x00,0x50,0x11,0x18,0xb1,0xa9,0x11,0x7c,0x4d,0x60,0x02,0xaa,
-0xde,0xad,0xda,0xa5,0x65,0x00,0xf0,0x00,0x5f,0x59,0xc5,0xba,0x5c,0x80,0x05,0x5b,
-0xf5,0x54,0xe0,0x6a,0x09,0x70,0xa8,0xab,0x00,0xa2,0x3e,0x17,0xa1,0xa8,0x1b,0x80,
-0x00,0x1f,0xf7,0x03,0x24,0x16,0x15,0x06,0xdd,0x83,0x41,0xba,0xf7,0xc0,0xcf,0xb9,
-0x04,0x41,0x2f,0x5f,0x0d,0x11,0x60,0x12,0x41,0x0a,0x94,0xf0,0x13,0xdd,0x1b,0x50,
-0x02,0xf2,0x4f,0x00,0xce,0x19,0x33,0x91,0xe0,0x06,0x04,0xf0,0x00,0x2a,0x12,0xf2,
-0x18,0x85,0x00,0xd0,0x3e,0x80,0x2f,0x20,0xbd,0x20,0x00,0x04,0xf0,0x3f,0x70,0x25,
-0xf2,0x25,0x41,0x50,0x4f,0x00,0x20,0x1f,0xfc,0x64,0x03,0x23,0x05,0x10,0x2d,0x45,
-0x00,0xd0,0xa1,0x40,0x31,0xf1,0x05,0x80,0xc3,0xa1,0x51,0x02,0xf1,0x0f,0x20,0xb6,
-0x13,0x00,0xf0,0x13,0x98,0x10,0xf3,0x2e,0x09,0x10,0x03,0x3f,0x63,0x3e,0x1a,0x6e,
-0x4c,0x97,0xc0,0x00,0xff,0xff,0xcc,0xfe,0xd0,0xe6,0xec,0xf3,0x00,0x01,0x4f,0x40,
-0x32,0xd6,0x1d,0x60,0x89,0x70,0x69,0x8f,0xf2,0x16,0x98,0x77,0xb7,0x3d,0x2b,0x50,
-0x00,0xbf,0xe0,0x7f,0xbd,0xd9,0x9e,0xfd,0xcb,0x00,0x0e,0xfc,0x84,0x78,0x29,0x7b,
-0x2b,0x70,0x40,0x05,0xae,0x5a,0x16,0xe2,0x27,0xe2,0x4d,0x71,0x00,0xb5,0xe3,0xc1,
-0x04,0xf0,0x04,0xb0,0x3e,0x0e,0x30,0x06,0xe0,0x00,0xf5,0x08,0x60,0x02,0x80,0xe3,
-0x00,0x9f,0xc1,0x0a,0xa5,0xf4,0x72,0x00,0x50,0x0e,0x49,0xe2,0x4f,0xf7,0x72,0x00,
-0xfb,0x0a,0x09,0xd0,0x05,0x18,0xfc,0x00,0xc2,0x00,0x0e,0x38,0xf3,0x00,0x6e,0xb5,
-0xea,0x5f,0x00,0x00,0xe4,0xb4,0x00,0x2b,0x40,0x02,0xae,0x6f,0x23,0x1a,0x7d,0x4f,
-0x2c,0x05,0x85,0x96,0x03,0x11,0x00,0x13,0x4c,0x11,0x00,0x22,0x05,0xf0,0x11,0x00,
-0x00,0xfe,0x04,0x10,0x8f,0xe5,0x16,0x00,0x11,0x00,0x02,0xf9,0x20,0x0e,0x22,0x00,
-0x0f,0x11,0x00,0x14,0x14,0x0f,0xc2,0x09,0x23,0x66,0x66,0xd2,0xa0,0x0d,0xe6,0x4e,
-0x08,0x7b,0x41,0x28,0x0b,0xb0,0x8c,0x41,0x22,0x04,0xd1,0x11,0x00,0x00,0xa8,0x0b,
-0x10,0xbb,0xaa,0x12,0x21,0x05,0xf1,0x22,0x0f,0x10,0x90,0x11,0x00,0x10,0xbc,0x58,
-0x0c,0x27,0x05,0xf1,0x22,0x00,0x03,0x71,0x39,0x0f,0x11,0x00,0x03,0x04,0x0f,0x31,
-0x14,0xe6,0x89,0x00,0x02,0xca,0x03,0x41,0x61,0x50,0x00,0x00,0x85,0x00,0xd2,0xe6,
-0x4e,0xc2,0x00,0x04,0x4b,0xc4,0x44,0x10,0x0e,0x70,0x09,0x60,0xfa,0x26,0xd0,0xd8,
-0x24,0x79,0x20,0x00,0x2f,0x62,0x20,0x58,0xbf,0xff,0xfd,0xa3,0xd7,0x3f,0x21,0xa8,
-0xc9,0xe4,0x9f,0x30,0xab,0x22,0xd7,0x24,0x13,0xf0,0x14,0x01,0x00,0x1f,0x40,0x1f,
-0x30,0x00,0x9d,0x69,0xcf,0xc0,0x09,0xe0,0x04,0xf1,0x8b,0xdf,0xfd,0xa7,0x41,0x01,
-0xf6,0xe8,0x9c,0x0c,0x96,0x7f,0x10,0x06,0x50,0x05,0x03,0xef,0x60,0x00,0xd9,0x4b,
-0x03,0x05,0x3a,0x00,0x67,0xb5,0x01,0x26,0x85,0x40,0xaf,0xf6,0x00,0x00,0x63,0x36,
-0x50,0x00,0x5e,0xf6,0x00,0x10,0x30,0x77,0x50,0x05,0xcf,0x9d,0xc0,0x0e,0x36,0x70,
-0xe9,0x8f,0xfa,0x20,0x4f,0xa8,0xe0,0x0a,0x70,0x00,0x04,0x71,0x00,0x00,0x5d,0x04,
-0x5d,0x2d,0x0c,0x80,0x2a,0x70,0x14,0xef,0x2a,0x43,0x14,0xbf,0xe6,0x35,0x24,0xaf,
-0x50,0xc0,0x30,0x22,0x78,0xff,0x4b,0x05,0x91,0x01,0x50,0xac,0x33,0x3d,0xa3,0x33,
-0xca,0x00,0xaf,0x0d,0x12,0xd7,0xb4,0x0d,0x01,0xf9,0x2f,0x16,0xd8,0xcc,0x32,0xa0,
-0xf3,0x05,0x58,0xf6,0x55,0x7f,0x65,0x55,0xf9,0x55,0x14,0x36,0x20,0x05,0xf0,0xa9,
-0x23,0x00,0x99,0x2b,0x12,0x7d,0x08,0x1b,0x84,0xcc,0x44,0x4b,0xc4,0x44,0x7f,0x64,
-0x30,0x47,0x30,0x12,0xfa,0x61,0x04,0x24,0x02,0xdb,0xff,0x66,0x19,0xfc,0x68,0x88,
-0x10,0xa0,0xed,0x2a,0x03,0x36,0x1c,0x13,0xe8,0xe3,0x10,0x26,0x0e,0x80,0x11,0x00,
-0x13,0x20,0x11,0x00,0x31,0x9f,0x40,0x7f,0x77,0x9e,0x10,0xbf,0x6f,0x50,0xd2,0xfa,
-0x0e,0x85,0xef,0x50,0x00,0x7f,0x55,0x55,0x30,0xee,0xfa,0x10,0x33,0x00,0x1f,0xd4,
-0x44,0x00,0x08,0x13,0x54,0x11,0x00,0xf0,0x0f,0x09,0xc0,0x7f,0x00,0x01,0x30,0xe8,
-0x00,0x00,0xab,0x07,0xf2,0x6b,0xfa,0x0e,0x80,0x00,0x0c,0x90,0xcf,0xff,0xc6,0x10,
-0xcd,0x65,0x57,0xf5,0x1f,0xd7,0x10,0x37,0xa5,0x16,0xfa,0x1a,0x20,0x00,0x28,0x2f,
-0x0b,0xbb,0x6b,0x15,0x02,0xcb,0x2b,0x12,0x9f,0xc8,0x7a,0x43,0x20,0x00,0x3f,0x82,
-0x8c,0x59,0x23,0x1d,0xe1,0x06,0x2b,0x15,0x0d,0xd4,0x34,0x14,0x56,0x69,0x01,0x02,
-0x4a,0x40,0x04,0x3d,0x6c,0x30,0x3a,0x10,0x5f,0x90,0x39,0x30,0xd5,0x00,0x1e,0x76,
-0x25,0x00,0x5d,0x8a,0x32,0x4c,0xd0,0x00,0x55,0x51,0x23,0xbf,0xf3,0x53,0x0a,0xf1,
-0x0d,0x3d,0xde,0xe4,0x00,0x0f,0x60,0x60,0x00,0x01,0x8f,0xa0,0x1c,0xf7,0x00,0xcb,
-0x0d,0x20,0x18,0xfe,0x50,0x00,0x09,0xe1,0x05,0xf8,0xf0,0x04,0xe8,0x48,0x31,0x27,
-0x09,0xf9,0x45,0x01,0x14,0x86,0x68,0x30,0x42,0x07,0xee,0x50,0x24,0x08,0x34,0x64,
-0x01,0x9c,0x07,0xe0,0x04,0xf1,0x01,0x2e,0x41,0x4f,0x10,0x4b,0x30,0xf3,0x0f,0x60,
-0x04,0xf9,0xef,0xf6,0x00,0x74,0x40,0x61,0xf0,0x06,0xcf,0xe9,0x2f,0x60,0x0b,0xfc,
-0x20,0x07,0xfe,0xfd,0xf1,0x00,0xf6,0x00,0x03,0xdc,0x4b,0xff,0x82,0x4f,0x10,0xca,
-0x01,0x20,0x16,0xba,0x39,0x00,0x14,0xf5,0x39,0x00,0x00,0xcf,0x19,0x10,0x57,0x4c,
-0x00,0x20,0x03,0xf3,0x6f,0x0d,0x50,0x7e,0x00,0x4f,0x3e,0xfe,0xf9,0x55,0x00,0x13,
-0x00,0x50,0x65,0x10,0x00,0x01,0xe9,0x4d,0x2e,0x50,0x00,0x01,0xa1,0x00,0x9f,0xbd,
-0x8e,0x00,0xf6,0x51,0xa0,0x3f,0x70,0x00,0x4f,0x75,0x44,0x44,0x5c,0xe0,0x01,0xe7,
-0x1d,0x10,0xff,0xa2,0x98,0x24,0x04,0x60,0xb8,0x24,0x13,0xd3,0x9a,0x2e,0x23,0x3d,
-0xf3,0x5a,0x2b,0x61,0x06,0x03,0x66,0x6b,0xf6,0x66,0x20,0x00,0x00,0xd2,0x20,0x23,
-0x22,0x20,0xbc,0x2e,0x23,0x9f,0xa2,0x33,0x00,0x23,0x3c,0xf1,0x33,0x00,0x24,0x03,
-0x05,0x0f,0x13,0x40,0x26,0x66,0x8f,0xa6,0x8d,0x3c,0x13,0x90,0x7d,0x9b,0x61,0x7f,
-0x10,0x03,0xf6,0x01,0x70,0xaf,0x7a,0x10,0xbd,0x9d,0x29,0x20,0x09,0xe1,0x46,0x61,
-0xc0,0x5f,0x30,0x03,0xf7,0x00,0x1e,0x91,0x35,0x78,0xfd,0x00,0xdd,0x20,0x26,0x82,
-0xec,0xa9,0xf6,0x1d,0x40,0x00,0x67,0x52,0x6c,0xbe,0x03,0x80,0x26,0x20,0x41,0x00,
-0x04,0x8d,0x00,0xf0,0x02,0x14,0xf8,0xec,0x2b,0x60,0x05,0xfa,0x02,0x22,0x28,0xe2,
-0xd4,0x01,0x22,0x01,0x13,0x4f,0x5d,0x00,0x28,0x09,0x70,0x32,0x28,0xe2,0x22,0xbc,
-0x00,0x51,0xfc,0x15,0xf0,0x07,0x7e,0x00,0x0f,0x60,0x0d,0xf8,0x00,0x3f,0x10,0x07,
-0xe0,0x04,0xd0,0x00,0x07,0xfb,0x04,0xf6,0x55,0xaf,0x55,0x53,0x00,0x0b,0x14,0x4f,
-0x8f,0x13,0x32,0x04,0xf3,0xf4,0x72,0x0b,0x42,0x40,0x6f,0x0a,0xd0,0x12,0x1f,0x60,
-0x48,0xd0,0x2f,0x70,0x1e,0x80,0xfb,0x32,0x41,0xab,0x00,0x6f,0x4c,0xb5,0x5a,0x51,
-0x0e,0x70,0x00,0xaf,0xf2,0x14,0x69,0x50,0xf2,0x00,0x2c,0xff,0x70,0xe9,0x0b,0xf1,
-0x07,0xbd,0x01,0x8f,0xd3,0x7f,0xc5,0x00,0x08,0xe0,0x4f,0x49,0xfe,0x80,0x00,0x3c,
-0xfe,0x30,0x02,0x00,0x60,0x36,0x00,0x12,0x29,0x11,0x60,0x82,0x86,0x90,0x00,0x10,
-0x00,0x2e,0xe4,0x03,0xf3,0x00,0x7e,0xe0,0x2e,0x71,0x1a,0xf5,0x0c,0xd0,0x07,0xe0,
-0x03,0xa9,0x83,0x33,0x3f,0x50,0x7e,0x67,0x7b,0x50,0xa5,0x07,0xe0,0x2b,0x30,0xbe,
-0x3c,0x00,0xe7,0x2c,0x62,0x55,0x20,0x1e,0xe6,0x00,0x0e,0x39,0x05,0x21,0x08,0xf8,
-0xa8,0x04,0x00,0xef,0x40,0x20,0x20,0x0e,0xb9,0x02,0x14,0xf5,0x19,0x04,0x00,0xf2,
-0x3a,0x70,0x70,0x0e,0x81,0x11,0x11,0x11,0xf5,0x59,0x23,0x03,0x26,0x00,0x23,0x0c,
-0xc0,0x39,0x00,0x21,0x04,0xf4,0xce,0x31,0x42,0x4f,0x50,0x00,0xdb,0x89,0x0b,0x40,
-0xf5,0x00,0x8f,0x20,0x4c,0x00,0x50,0x77,0x7f,0x40,0x02,0x70,0x13,0x00,0x33,0x0a,
-0xdd,0x90,0x31,0x69,0x70,0x6b,0x3b,0x10,0x00,0x1a,0xfb,0x10,0xb5,0x01,0x51,0x9e,
-0x30,0x00,0x04,0xe4,0x1f,0x22,0x15,0x77,0xc4,0x55,0x10,0xe0,0xf9,0x00,0xd0,0x44,
-0x44,0x8f,0x54,0x44,0x00,0x63,0x00,0x1f,0x21,0x11,0x14,0xf1,0x7c,0x0a,0xf0,0x0b,
-0x01,0xf3,0xff,0xff,0x6f,0x20,0xa6,0x00,0x06,0xf7,0x2f,0x20,0x00,0x01,0xf3,0x0f,
-0x40,0x00,0x02,0x02,0xf1,0x44,0x44,0x1f,0x55,0xf0,0x7c,0x01,0xd0,0x1f,0xcc,0xf2,
-0xe7,0xba,0x00,0x00,0x04,0x34,0xf0,0xe0,0x0d,0x2c,0x7d,0x36,0xf0,0x01,0xca,0x5e,
-0x0e,0x00,0xd2,0x9f,0xc0,0x00,0x00,0x3f,0x38,0xc0,0xf4,0x4e,0x27,0xf4,0x56,0x01,
-0xf5,0x13,0xc8,0x0f,0xcc,0xc4,0xef,0x30,0x72,0x02,0xf5,0x1f,0x40,0xd0,0x03,0xec,
-0xeb,0x0d,0x40,0xbe,0x09,0xd0,0x00,0x09,0xf7,0x07,0xfc,0xf1,0x02,0x40,0x95,0x00,
-0x00,0xa3,0x00,0x09,0x9d,0x23,0x04,0xcb,0x66,0x02,0x09,0x93,0x32,0x30,0xdf,0xff,
-0xa5,0x9a,0x32,0xcd,0x0d,0x81,0x2c,0x56,0x34,0x00,0x20,0xd7,0x3c,0x8c,0x12,0x0d,
-0x06,0x12,0x20,0x41,0x00,0x25,0x23,0x80,0x12,0xf4,0x00,0x0d,0xf9,0x00,0x0d,0x70,
-0xf6,0x4d,0x00,0xf7,0x30,0x03,0x39,0x00,0x34,0x01,0x30,0x02,0x89,0x1a,0x23,0x01,
-0x33,0x99,0x15,0x23,0x63,0x7f,0xed,0x00,0x70,0x1f,0x77,0xc0,0x5b,0x06,0xb0,0x6e,
-0x3c,0x07,0xa3,0x7c,0x05,0xb0,0x6b,0x06,0xe0,0x00,0x01,0xf7,0x07,0x13,0x00,0x23,
-0x9e,0x00,0x13,0x00,0xb3,0x3f,0x60,0x39,0xd3,0x8c,0x38,0xc3,0x9f,0x30,0x06,0xd0,
-0xb6,0x37,0x07,0x0c,0x4e,0x05,0x9d,0x07,0x33,0x3e,0xe4,0x0c,0x3a,0x25,0xd4,0x1b,
-0xf3,0xcb,0x44,0x45,0x96,0x44,0x43,0x00,0x00,0x05,0x0c,0x90,0x27,0x9a,0xf1,0x06,
-0xc9,0x14,0x48,0xf5,0x44,0x40,0x00,0x30,0x00,0x0c,0x94,0xfc,0xcc,0xcc,0xdf,0x00,
-0x2e,0xd5,0x00,0xc9,0x4f,0xc8,0x09,0x42,0x07,0xf4,0x0d,0x84,0x20,0x09,0x80,0x01,
-0x00,0xd8,0x4f,0x11,0x11,0x15,0xf0,0xe0,0x01,0x21,0x64,0xf0,0x43,0x09,0x42,0x03,
-0x31,0xf4,0x4f,0x99,0x1e,0x32,0xbc,0x3f,0x20,0x59,0x55,0xfa,0x1d,0x3f,0x48,0xe0,
-0x0d,0x50,0xe6,0x1e,0x50,0x00,0x0a,0xd0,0xca,0x08,0xe0,0x0e,0x60,0x7e,0x10,0x03,
-0xf5,0x3f,0x45,0xf4,0x00,0xe6,0x00,0xda,0x00,0xcd,0x0b,0xc0,0x67,0x03,0x3f,0x60,
-0x04,0x60,0x04,0x40,0x94,0x00,0x00,0xef,0xd2,0xd3,0x3b,0x51,0xa3,0x00,0x0e,0x70,
-0x86,0xe5,0x04,0x32,0xfa,0x08,0xf1,0x91,0x37,0x22,0x03,0x42,0x78,0x1a,0xf0,0x01,
-0x06,0x40,0x02,0xef,0x42,0x27,0xf2,0x22,0x20,0x00,0xcf,0xd5,0xdf,0xf4,0x11,0x7f,
-0x49,0x1a,0x61,0x3b,0x3a,0x5f,0xed,0xde,0xfd,0xb0,0x75,0x23,0x13,0xf2,0xbb,0x1f,
-0x22,0xb9,0x3f,0x7c,0x10,0x24,0x00,0x9e,0x13,0x00,0x81,0x8f,0x30,0x3f,0x75,0x59,
-0xf5,0x55,0x52,0x3c,0x28,0x10,0xfe,0x70,0x48,0x42,0x00,0x60,0x00,0x01,0x8e,0x2d,
-0x00,0xd7,0x2d,0x10,0xf7,0x78,0x0b,0x07,0x77,0x18,0x06,0x4e,0x99,0x0a,0x6f,0x21,
-0x00,0x01,0x00,0x14,0x53,0x75,0x14,0x60,0xbf,0xa1,0x11,0x11,0x5f,0x51,0x24,0x08,
-0x14,0xe6,0xa7,0x06,0x11,0x01,0x6b,0x49,0x10,0xba,0x6b,0x36,0x00,0xd0,0x01,0x32,
-0xba,0x05,0x10,0x60,0x17,0x43,0x20,0x0c,0xfa,0x10,0xfe,0x1e,0x30,0x4b,0x10,0x6d,
-0x70,0x15,0x10,0xc0,0x25,0x09,0x51,0x33,0x4f,0x73,0x38,0xe0,0xde,0x3e,0x20,0x0f,
-0x40,0xd7,0x01,0x23,0xa0,0x7f,0xd0,0x29,0x60,0xf1,0x7d,0x11,0x2f,0x51,0x17,0xee,
-0x6f,0x92,0x7d,0x22,0x3f,0x62,0x27,0xe0,0x00,0x5f,0x30,0x1b,0x00,0x00,0xa0,0x03,
-0x40,0x49,0x20,0x0a,0x80,0x52,0x2a,0xb1,0x3a,0xf8,0x00,0x04,0xde,0x60,0x05,0xc0,
-0x0a,0xfb,0x30,0x64,0x35,0x01,0x2d,0x39,0x00,0x35,0x0a,0x20,0x73,0x00,0xe6,0x1e,
-0x01,0x42,0x86,0x40,0x10,0x9e,0xee,0xff,0x03,0x32,0x80,0x02,0xeb,0x0a,0x90,0x0c,
-0x90,0x0a,0x90,0xe8,0x20,0x51,0xa9,0x00,0xc9,0x00,0xa9,0xb9,0x02,0x00,0x1e,0x1e,
-0x30,0x80,0x00,0x41,0x5f,0x26,0x83,0xda,0x33,0x33,0x30,0x0d,0xf9,0x03,0xff,0x6a,
-0x01,0x16,0xfc,0x0b,0x1f,0x10,0x0c,0xf7,0x80,0x11,0xd0,0x68,0x24,0x40,0x11,0x11,
-0x11,0x8d,0x0d,0x7c,0x10,0x0c,0xd2,0x25,0x10,0xd0,0xf3,0x82,0x50,0xca,0x55,0x55,
-0x55,0xad,0xa4,0x5e,0x60,0x0c,0xa6,0x66,0x66,0x6b,0xd0,0x3d,0x56,0x50,0xcd,0xaa,
-0xaa,0xaa,0xdd,0xbc,0x2b,0xf0,0x04,0x02,0x4c,0xa3,0x3b,0xb4,0x20,0x00,0x4f,0x60,
-0x02,0x8f,0xc3,0x00,0x3b,0xf9,0x10,0x03,0xa0,0x07,0xcf,0x14,0x25,0x03,0xdd,0xc7,
-0x37,0x1e,0x10,0x79,0x36,0x06,0x09,0x73,0x00,0x63,0x9d,0x03,0xe6,0x32,0xf0,0x0b,
-0xbf,0xf5,0x5f,0x75,0xbc,0x56,0xf7,0x51,0x00,0xbf,0xae,0x00,0xf3,0x08,0xa0,0x1f,
-0x30,0x00,0x08,0x55,0xe0,0x0f,0x30,0x8a,0x01,0xf3,0x0b,0x98,0x65,0x33,0xf6,0x3a,
-0xb3,0x5f,0x63,0x05,0x49,0x10,0xf3,0x0a,0x0a,0x30,0xf3,0x09,0xa0,0x64,0x0f,0x14,
-0x05,0x26,0x00,0x23,0x00,0x5e,0x39,0x00,0x04,0xe5,0x01,0x22,0xfc,0x00,0x2a,0x16,
-0x00,0x2d,0x37,0x70,0x0c,0x40,0x36,0x00,0x47,0x00,0x6c,0xc7,0x00,0x60,0x05,0xf0,
-0x05,0xf2,0x01,0xfa,0x84,0x00,0x80,0x3f,0x20,0x0e,0x70,0x05,0xf4,0x00,0xcc,0x93,
-0x08,0x10,0xab,0x73,0x0f,0x16,0x10,0x2c,0x22,0x14,0x15,0x60,0x10,0x00,0x20,0x07,
-0x11,0xe7,0x0b,0x00,0x00,0x12,0x54,0x51,0x70,0xbc,0x00,0x00,0x43,0x13,0x00,0x50,
-0x01,0xf8,0x00,0x0b,0xe1,0x13,0x00,0x00,0x0f,0x55,0x20,0x1e,0xa4,0x13,0x00,0x00,
-0x2f,0x48,0x60,0x5f,0x8f,0x34,0x44,0x4f,0xa4,0xd0,0x07,0x24,0x85,0xf5,0xcb,0x04,
-0x21,0x4f,0x20,0x49,0x1b,0x01,0xb4,0x09,0x31,0x04,0xff,0x20,0x7b,0x44,0x12,0x10,
-0xe1,0x1f,0x70,0x06,0xfb,0xf1,0x00,0x0c,0xb8,0xd0,0x9b,0x4d,0xd2,0x4f,0x10,0x02,
-0xf6,0x2f,0x50,0x00,0x01,0xe5,0x04,0xf1,0x00,0xbe,0x47,0x4d,0x30,0x4f,0x10,0x5f,
-0x86,0x1f,0x00,0x85,0x00,0x22,0x3e,0xb0,0xc9,0x99,0x50,0x4f,0x5e,0xd1,0x00,0x00,
-0x17,0x13,0x21,0x04,0xf7,0xac,0x78,0x09,0xf3,0x39,0x13,0x6d,0x51,0xc2,0x64,0x24,
-0xf9,0x22,0x22,0x22,0x29,0x07,0x01,0xf0,0x12,0x02,0x11,0x11,0x2e,0x71,0x31,0x11,
-0x21,0x11,0xe9,0x00,0x0b,0xa0,0x1e,0x80,0x2e,0x80,0x02,0xcd,0x2b,0xfc,0xce,0xa0,
-0x4e,0xa0,0x00,0x00,0x70,0x67,0x7f,0xa0,0x06,0x60,0x61,0x09,0xf0,0x08,0x2d,0x83,
-0xd1,0x75,0x00,0x00,0x6c,0xe8,0x6f,0xa6,0x7e,0xc6,0xeb,0x20,0x9e,0x70,0x2f,0xdc,
-0xa9,0x7e,0x61,0xbf,0x31,0x51,0x04,0x44,0x30,0x31,0x00,0x50,0x42,0x39,0x05,0x39,
-0x3b,0x20,0x55,0x55,0xef,0x34,0x02,0x09,0x49,0x2b,0x3f,0x30,0x3f,0x4f,0x04,0x11,
-0x00,0x01,0xff,0x13,0x10,0x10,0x14,0x0a,0x11,0x76,0xaf,0x04,0xa2,0x05,0x59,0xf5,
-0x52,0x6e,0x11,0x11,0x13,0xf3,0x00,0x6a,0x33,0x00,0x96,0x22,0x11,0x05,0x44,0x33,
-0x01,0xd3,0x01,0x00,0x57,0x33,0x81,0x22,0x4f,0x30,0x07,0x9b,0xf9,0x92,0x6e,0x30,
-0x25,0x42,0x8b,0xdf,0xbb,0x36,0xe8,0x04,0x00,0x7d,0x33,0x3f,0x22,0x22,0x25,0x39,
-0x00,0x04,0xf0,0x04,0x48,0x91,0x3e,0x83,0xf9,0x33,0x00,0x03,0x8d,0xff,0xb6,0x01,
-0xf2,0x0e,0x60,0x00,0x03,0xfd,0x84,0xa3,0x19,0x41,0xe6,0x00,0x20,0x01,0x0a,0x2e,
-0x30,0x0e,0x60,0x0c,0x2e,0x5d,0x60,0xaf,0x70,0x00,0xe9,0x33,0xe4,0x84,0xbb,0x55,
-0x40,0x00,0x08,0xff,0xfc,0x6b,0x3a,0x00,0xa6,0x34,0x10,0x53,0xa1,0x16,0xb0,0xc5,
-0x00,0xee,0xff,0xec,0x3f,0x76,0x7f,0x86,0x6f,0x60,0x1a,0x44,0x50,0xf0,0x00,0xf2,
-0x00,0xe6,0xc0,0x16,0x51,0x3f,0x43,0x4f,0x53,0x3f,0x13,0x00,0x01,0xaf,0x21,0x00,
-0x78,0x23,0xa6,0x3f,0x00,0x0f,0x20,0x0e,0x60,0x0d,0xff,0xff,0x83,0x26,0x00,0x02,
-0xeb,0x23,0x30,0x0b,0xa0,0x01,0x07,0x26,0x12,0x41,0xf9,0x16,0x21,0x2f,0x40,0xff,
-0x27,0x40,0x02,0x55,0x56,0xf8,0xfe,0x07,0x32,0xbb,0x68,0x7f,0xd6,0x7a,0x31,0x6e,
-0xff,0xb0,0xc6,0x09,0x11,0x02,0x0a,0x79,0x10,0x2f,0x60,0x25,0x22,0x20,0x00,0x40,
-0x26,0x00,0x3c,0x1f,0x04,0xfc,0x3b,0x33,0x40,0x02,0xb3,0x99,0x68,0x22,0x2f,0x40,
-0xb2,0x64,0x22,0x02,0xf4,0x8e,0x7d,0x30,0x33,0x6f,0x73,0x52,0x61,0x13,0xef,0xd0,
-0x04,0xa2,0x9f,0x32,0x22,0x5f,0x62,0x22,0x22,0x20,0x4f,0x60,0x1d,0x0a,0x2c,0x08,
-0xb0,0x51,0x55,0x12,0x0c,0xaf,0x86,0x31,0x50,0x00,0x56,0xaf,0x15,0x1e,0x62,0x73,
-0x55,0x0c,0x11,0x00,0x00,0x8b,0x23,0x66,0x7f,0x85,0x55,0x55,0x55,0xdf,0xd5,0x42,
-0x22,0x66,0x66,0x4a,0x37,0x04,0x43,0x17,0x00,0xac,0x5c,0x01,0x0c,0x1a,0x10,0xf5,
-0x0c,0x07,0x00,0xf6,0x08,0x76,0x72,0x22,0x4f,0x62,0x22,0x28,0xe0,0x22,0x00,0x04,
-0x11,0x00,0x04,0x22,0x00,0x22,0x1f,0x40,0x33,0x00,0x00,0x2d,0x77,0x10,0xfe,0xec,
-0x5b,0xa3,0x4f,0x77,0x77,0x8f,0x97,0x77,0x7b,0xe0,0x06,0xe0,0x22,0x00,0x22,0xba,
-0x00,0x22,0x00,0x22,0x2f,0x60,0x11,0x00,0x20,0x0b,0xe0,0x11,0x00,0x40,0x44,0x3a,
-0xe1,0xe5,0x80,0x05,0x25,0x0c,0xff,0x18,0x74,0x05,0xde,0x5c,0x13,0x12,0x4e,0x18,
-0x17,0xd3,0x93,0x20,0x02,0x65,0x07,0x21,0x15,0x11,0xba,0x00,0xf0,0x0a,0x17,0x13,
-0xf3,0x1f,0x10,0x2f,0x00,0x3f,0x02,0xf3,0x3f,0x31,0xf1,0x02,0xf0,0x03,0xf0,0x2f,
-0x33,0xf3,0x1f,0x65,0x7f,0x65,0x7f,0x11,0x00,0x41,0xfd,0xcd,0xfc,0xcd,0x11,0x00,
-0x0d,0x22,0x00,0x01,0x4a,0x3c,0x31,0xf3,0x3f,0x30,0xc3,0x47,0x33,0x2f,0x33,0xf3,
-0xca,0x27,0x04,0x11,0x5d,0x12,0x31,0x84,0x35,0x12,0x57,0x36,0x9b,0x60,0x34,0x69,
-0xcb,0x00,0x00,0x04,0xf9,0x31,0x10,0xec,0x42,0x1e,0x71,0x15,0x88,0x33,0x4f,0x40,
-0x03,0xb2,0x94,0x94,0x10,0x02,0x67,0x04,0x01,0x8b,0x18,0x30,0x2f,0x40,0x8e,0xbf,
-0x37,0xe1,0xdd,0xfe,0xde,0xfe,0xdf,0xfd,0xdd,0xc0,0x03,0x55,0x55,0x9f,0xbf,0xbf,
-0xca,0x6a,0x71,0x00,0x8f,0x82,0xf4,0x6f,0xa1,0x00,0x84,0x81,0xf2,0x02,0x2f,0x40,
-0x4d,0xe8,0x10,0x00,0x7e,0xfa,0x10,0x01,0xa2,0x00,0x07,0xff,0xb0,0x07,0x98,0x98,
-0x35,0xa0,0x77,0x00,0x00,0x6f,0x22,0x24,0xf5,0x22,0x2b,0xc0,0x49,0x26,0x00,0xae,
-0x01,0x15,0xbc,0x6e,0x3c,0x02,0x13,0x00,0x21,0x1f,0x30,0xb2,0x35,0x33,0x6f,0x22,
-0x23,0x26,0x00,0x01,0x1c,0x00,0x11,0xeb,0xee,0x20,0x51,0x23,0x12,0xb1,0x00,0x72,
-0x5d,0x02,0x60,0xfe,0x0c,0xa0,0xae,0x30,0x00,0xe4,0x87,0xc1,0x60,0x4f,0xcb,0x10,
-0x41,0x00,0x09,0xd3,0x0d,0xd0,0x00,0x8f,0xe2,0xc0,0x81,0xfc,0xe2,0x00,0x00,0xbd,
-0xbd,0x20,0x00,0x3c,0x47,0x10,0xde,0xe3,0x87,0x75,0x2d,0xe2,0x45,0x55,0x55,0x50,
-0xbf,0x31,0x54,0x51,0x9f,0xe3,0x0b,0x60,0xdf,0xc7,0x0c,0x11,0x39,0x8a,0x5d,0x33,
-0x33,0x33,0xbd,0xcd,0x2c,0x02,0x7a,0x39,0x06,0x13,0x00,0x15,0xdf,0x71,0x44,0x11,
-0x4c,0x65,0x8e,0x02,0x7b,0x5c,0x21,0x04,0xf3,0x61,0x44,0x20,0x3b,0xa3,0xec,0x93,
-0x27,0x30,0x0b,0xd6,0x37,0x18,0x01,0xa1,0x37,0x13,0xad,0x38,0xa7,0x11,0x04,0xe4,
-0x93,0x20,0xef,0xfe,0x03,0x00,0x30,0x90,0x00,0x33,0x0c,0x3f,0x00,0x54,0x0d,0x41,
-0x02,0x22,0x29,0xf2,0x49,0x1a,0x14,0x2f,0x94,0x39,0x04,0x4b,0x7d,0x10,0x0c,0xd7,
-0x6a,0x00,0xb5,0x50,0x43,0x02,0x22,0x3d,0xd3,0x6e,0x1a,0x20,0x8f,0xec,0x16,0x4a,
-0x00,0x79,0x05,0x12,0x74,0xaa,0x19,0x20,0x4f,0xcf,0x40,0x60,0xe2,0xcb,0x00,0x06,
-0xfc,0x1f,0xdb,0xbb,0xbb,0xbb,0xeb,0x00,0x4f,0xb1,0x0f,0x12,0x00,0x32,0x05,0x00,
-0x0f,0x12,0x00,0x23,0x00,0x00,0x12,0x00,0x03,0x71,0x10,0x04,0x08,0x50,0x10,0xc5,
-0x37,0x7f,0x31,0x88,0x88,0x20,0x37,0x08,0x42,0x0b,0xbe,0xeb,0xb8,0xc4,0x25,0x00,
-0x81,0x19,0xe0,0x35,0xf7,0x43,0x3e,0x60,0x00,0x2f,0x30,0x05,0xe0,0xbc,0x4e,0x00,
-0xd6,0xa3,0x04,0xb0,0x14,0x5f,0x40,0xe7,0x03,0x10,0x00,0x9d,0x11,0x10,0x4f,0xd2,
-0x03,0x00,0x7d,0x01,0xe0,0x5f,0xf8,0x33,0xf8,0x33,0x10,0x04,0xfa,0x15,0xfd,0xbf,
-0x60,0x0e,0x60,0x30,0xa0,0x30,0x4f,0x10,0xef,0xe6,0x04,0xf1,0x00,0x3f,0xc9,0x04,
-0xf0,0x0e,0x72,0x2e,0x72,0x20,0x00,0x59,0x90,0x4f,0x00,0xe6,0x31,0x13,0x30,0x99,
-0x04,0xf0,0xda,0x32,0xa0,0xe3,0x00,0x09,0xc7,0x9f,0x00,0xe8,0x33,0xf8,0x33,0x4c,
-0x1b,0x21,0xb0,0x0e,0x39,0x00,0x10,0x09,0x5e,0xcc,0xa1,0xcc,0xfd,0xcc,0xc0,0x00,
-0x33,0x00,0x00,0x0e,0xa6,0x7f,0x10,0x03,0xa1,0x03,0x05,0xe9,0x72,0x0f,0xec,0x86,
-0x09,0x05,0x40,0x43,0x10,0x04,0x1a,0x34,0x13,0xa6,0xbf,0x10,0x03,0x6c,0xa2,0x60,
-0x88,0x00,0x1f,0x50,0x06,0x70,0xac,0x07,0x00,0x09,0x00,0x10,0xf4,0x8b,0x01,0x00,
-0x1b,0x00,0x50,0xbe,0x10,0x00,0x5f,0x60,0x09,0x00,0x20,0x1f,0xa0,0x8f,0xc0,0x00,
-0xf5,0xab,0x32,0xf3,0x0d,0xd1,0x36,0x00,0x41,0xe9,0x00,0x10,0x02,0x79,0x3c,0x10,
-0x20,0xd8,0x04,0x22,0xea,0x10,0x2d,0x03,0x12,0x74,0x9e,0x36,0x10,0x47,0x75,0xcb,
-0x01,0x05,0x10,0x23,0xb9,0xf7,0xb1,0x36,0x00,0x78,0x18,0x41,0x86,0x0f,0x51,0xd2,
-0x78,0x18,0xf0,0x09,0x0d,0x70,0xf5,0x0c,0xa0,0x01,0xaa,0xaf,0xca,0xa1,0xf4,0x0f,
-0x50,0x4f,0x20,0x1a,0xac,0xfd,0xaa,0x5f,0x10,0xf5,0x00,0xe8,0x97,0x3f,0x80,0x09,
-0xc0,0x0f,0x50,0x09,0xd0,0x00,0x0e,0x0c,0x26,0xf0,0x0a,0xf5,0x00,0x25,0x00,0x06,
-0xcf,0x8e,0x63,0x10,0x0f,0x50,0x38,0x00,0x00,0xe5,0xf6,0x6a,0x00,0x00,0xf5,0x0c,
-0xc0,0x00,0x8d,0x0f,0x9a,0x94,0x63,0x45,0xf3,0x00,0x2f,0x30,0xf6,0xc5,0x42,0x33,
-0x60,0x0f,0x60,0x96,0x82,0x00,0x65,0x0d,0x22,0x5d,0xf7,0x72,0x00,0x32,0x5a,0xef,
-0xa1,0xea,0x18,0x33,0x0a,0xb6,0x10,0x29,0x04,0x12,0x82,0x1f,0x82,0x41,0x37,0xbe,
-0xfc,0x50,0xd9,0x0b,0x51,0x07,0xb8,0xf5,0x00,0x07,0x87,0x43,0x00,0xd0,0x09,0x12,
-0xbf,0xc5,0x07,0xd0,0xf4,0x00,0x2f,0x50,0x7e,0x00,0xc8,0x00,0x55,0x5f,0x95,0x4a,
-0xe0,0x15,0x59,0x90,0x0e,0xff,0xff,0xfd,0xf6,0x00,0x7e,0x01,0x40,0xaf,0x32,0x50,
-0x18,0x25,0x07,0xe0,0x62,0x09,0x0c,0xd0,0x30,0x08,0xe0,0x7e,0x0b,0x90,0x00,0x05,
-0xcf,0x9e,0x20,0xc9,0x07,0x5a,0x2d,0xf2,0x16,0xd4,0xf4,0x87,0x1f,0x40,0x7e,0x00,
-0xf5,0x00,0x8c,0x0f,0x40,0x09,0xe0,0x07,0xe0,0x0b,0x90,0x2f,0x20,0xf4,0x02,0xf8,
-0x00,0x7e,0x00,0x7e,0x00,0x40,0x0f,0x40,0x4d,0x00,0x07,0xe0,0x03,0xa0,0x07,0x29,
-0x13,0x7e,0xa4,0xb0,0x21,0x05,0x6c,0x29,0x09,0x00,0xfa,0x04,0x12,0xc6,0x32,0x0b,
-0x40,0x80,0x00,0x03,0xd3,0x2f,0x7f,0xc0,0xcf,0xfb,0x10,0x01,0xeb,0x11,0x10,0x00,
-0x07,0xb9,0xf2,0x00,0xb7,0x2e,0x10,0xd0,0x71,0x1e,0x50,0x06,0xfa,0x21,0x15,0xf5,
-0x2a,0x32,0x50,0x07,0xf6,0x94,0x02,0xea,0x58,0x53,0x51,0x75,0x21,0x08,0xf9,0xe9,
-0xb6,0x02,0x13,0xf7,0xef,0x9a,0x61,0xbf,0x50,0x27,0xcf,0x93,0xd5,0xfc,0x75,0xd0,
-0x24,0xc6,0x10,0xcf,0x44,0x42,0x00,0x07,0xdf,0x9d,0x10,0x01,0xcf,0xdb,0x00,0xf1,
-0x0e,0xe6,0xf2,0xc3,0x04,0xec,0x10,0x01,0xe5,0x00,0x8c,0x3f,0x20,0x2b,0xf8,0x50,
-0x00,0xac,0x00,0x2f,0x42,0xf2,0x00,0x82,0x1c,0xd3,0xae,0x20,0x00,0x70,0x57,0x27,
-0x00,0x72,0x18,0x00,0xfd,0x36,0x21,0x29,0xfb,0x16,0x7b,0x42,0x20,0x37,0xbf,0xb3,
-0xce,0x84,0x2d,0x0c,0xc7,0xfc,0x86,0x05,0x76,0x1d,0x00,0x97,0x42,0x00,0xad,0x52,
-0x63,0x56,0xfb,0x55,0x55,0x55,0x27,0x86,0x4d,0x23,0xf7,0x7e,0xed,0x16,0xa0,0x77,
-0xe0,0x00,0x5b,0x10,0x0a,0x60,0x00,0xe7,0x6c,0xe0,0x82,0x60,0x7f,0xd5,0x06,0x30,
-0x07,0xee,0x08,0x52,0x51,0xfc,0x30,0x1e,0xf8,0x10,0xc9,0x7b,0x31,0x20,0x54,0x55,
-0xe8,0x7c,0x00,0x42,0xc9,0x03,0xed,0x0b,0x0e,0x6b,0x08,0x0a,0x11,0x00,0x10,0x02,
-0xef,0x55,0x6d,0x74,0x44,0x44,0x42,0x7f,0xff,0xb7,0x48,0x08,0x7f,0x0a,0x18,0xf7,
-0xa4,0x41,0x50,0x70,0x6f,0x44,0x45,0x54,0xb8,0x0e,0x20,0x70,0x6f,0xbf,0x34,0xf0,
-0x01,0xb8,0x00,0x0f,0x70,0x4a,0x02,0xce,0x20,0x00,0x4d,0xe5,0x08,0x40,0x01,0x9f,
-0xc1,0xca,0x00,0xa2,0xb1,0x00,0x08,0xe5,0x00,0x02,0xe3,0x58,0x03,0xd3,0xc6,0x09,
-0x21,0x2d,0xb0,0xe5,0x26,0x65,0x18,0xf1,0x12,0xd4,0x11,0x10,0x48,0x1f,0x50,0x33,
-0x33,0x33,0x5f,0xee,0x28,0x06,0x00,0xad,0x0f,0x01,0x8c,0x9e,0x00,0x87,0x7a,0x02,
-0xd6,0x88,0x00,0x60,0xcd,0x20,0x7f,0x91,0x18,0xb5,0x01,0x3c,0x9a,0x41,0x94,0x00,
-0x8f,0xe8,0x64,0x54,0x3a,0xdf,0xd0,0x13,0x47,0x2d,0x11,0x10,0xae,0x84,0x00,0xdf,
-0x2e,0x30,0x60,0x02,0x10,0x50,0x05,0x00,0x17,0x71,0x10,0xe6,0xf1,0x08,0xa2,0x0f,
-0x50,0x0f,0x60,0x0e,0x60,0x08,0x88,0xa8,0x83,0x13,0x00,0xe1,0xbb,0xbb,0xbb,0x4f,
-0xfe,0xef,0xfe,0xef,0x60,0x00,0x20,0x03,0x30,0x55,0xbf,0x6d,0x33,0x4d,0x00,0x9a,
-0x4e,0x00,0x32,0xf0,0x0b,0x8d,0x18,0x08,0x31,0x0f,0x20,0xd5,0xe8,0x41,0xe2,0x20,
-0x00,0xd4,0x0f,0x30,0x11,0x16,0xf3,0x11,0x10,0x00,0x0b,0x61,0xf0,0x1b,0xc4,0xf1,
-0x12,0x00,0xa7,0x4c,0x03,0xf3,0x4e,0x25,0xe2,0xaa,0x00,0x06,0x57,0xa4,0x6f,0x12,
-0xe0,0x3e,0x09,0xa0,0x04,0x8b,0xff,0xf9,0xf1,0x2e,0x03,0xe0,0x9a,0x00,0xfe,0xa6,
-0x30,0x3f,0x13,0x00,0x00,0xdf,0xaf,0x00,0x13,0x00,0x11,0xaa,0x6f,0x01,0x48,0x12,
-0xc0,0x2b,0x9f,0x4b,0x3b,0x00,0x32,0x31,0x21,0x0a,0x60,0xb3,0x6c,0x60,0x11,0x11,
-0x2f,0x71,0x11,0x11,0x90,0x05,0x20,0xf9,0x9f,0xd0,0x05,0xe0,0xdc,0x09,0xd0,0x04,
-0xf6,0x09,0xd0,0x00,0x0b,0xe2,0x03,0xf3,0x0e,0xc0,0x06,0x28,0x80,0x55,0x55,0x75,
-0x57,0x75,0x55,0x75,0x20,0xa5,0x6c,0x12,0xef,0x41,0x6e,0x03,0x57,0x0b,0x24,0x00,
-0x0b,0x12,0x00,0x71,0x0f,0x95,0x55,0x8f,0x65,0x55,0x55,0x73,0x4c,0x02,0x37,0x39,
-0x50,0x4f,0xed,0xdd,0xef,0xed,0x29,0x43,0x80,0x25,0x55,0x5d,0xff,0x65,0x55,0x5a,
-0xf0,0x08,0x2d,0x21,0x7f,0x10,0x6d,0x06,0x40,0x1c,0xb0,0x4f,0x10,0x42,0x26,0xa0,
-0x06,0xd6,0x00,0x4f,0x10,0x56,0x7f,0x70,0x02,0xc6,0x51,0x00,0x28,0x8d,0xda,0x6f,
-0x0e,0x10,0xc0,0xd7,0x40,0x01,0x8b,0x45,0x70,0x11,0x11,0x05,0xf4,0x11,0x11,0x10,
-0xfb,0x01,0x20,0xf5,0xcf,0x21,0x0c,0xf0,0x00,0x2f,0x81,0xe8,0x11,0x9f,0x32,0xea,
-0x11,0x10,0x0d,0xc0,0x07,0xe0,0x09,0x50,0x22,0x4d,0x73,0x41,0x00,0x15,0x09,0xf6,
-0x00,0x05,0x90,0x7a,0x13,0xf8,0x71,0x96,0x41,0xe3,0x04,0xee,0x60,0xae,0x21,0x90,
-0xe4,0x33,0x34,0xbf,0xe8,0x20,0x00,0x4b,0xfd,0xd0,0x1e,0x52,0x99,0xff,0xb2,0x0c,
-0xd6,0x8b,0x08,0x32,0x8a,0x00,0x10,0x99,0x22,0x05,0x2d,0x11,0x13,0xf0,0x88,0x23,
-0x24,0x00,0x5f,0x2c,0x73,0x11,0x05,0x13,0x00,0x10,0x95,0x61,0x56,0x01,0x26,0x00,
-0x00,0x11,0x03,0x01,0xa2,0xb1,0x12,0x50,0x51,0x40,0xf0,0x18,0x00,0x3f,0x84,0x44,
-0x40,0xce,0x44,0x44,0x43,0x01,0xdf,0xff,0xee,0xea,0xfe,0xff,0xee,0xea,0x0c,0xd1,
-0x2f,0x40,0x6f,0x60,0x1e,0x90,0x00,0x07,0x26,0x9d,0xb9,0xad,0x99,0x9b,0xc8,0x00,
-0x00,0x0a,0xc3,0x8c,0x08,0x10,0xad,0x94,0x10,0x00,0xb3,0x0a,0x50,0xed,0x00,0x00,
-0x0a,0xc2,0xe5,0x06,0x18,0x9d,0x12,0x00,0x10,0xc1,0xa4,0x0e,0x10,0x9d,0x94,0xb5,
-0x00,0xa7,0x8c,0x10,0xed,0x66,0x5d,0x10,0xf7,0xbd,0x3d,0x03,0x1e,0x23,0x16,0xe8,
-0xc9,0x0b,0x51,0xfd,0x03,0x33,0x4e,0xc3,0xd8,0x3d,0x41,0x00,0x28,0xec,0x10,0x1b,
-0x00,0x37,0x04,0xea,0x40,0xc4,0xb3,0x02,0x09,0x01,0x12,0x40,0x04,0x00,0x10,0x00,
-0x0d,0x0f,0x00,0xd0,0x1f,0x00,0x68,0x3b,0xf0,0x05,0xe2,0xcf,0xff,0xfe,0xeb,0x07,
-0xf3,0x0b,0x90,0x06,0xf3,0x09,0xc0,0x00,0x09,0x50,0x02,0x80,0x5e,0x30,0xb0,0x2a,
-0x03,0xa9,0x23,0x31,0xc3,0x00,0xf8,0x11,0x01,0x42,0x46,0xf4,0x00,0xf5,0x24,0x53,
-0x32,0xf4,0x00,0x41,0x1a,0x01,0x12,0x41,0x2e,0x08,0x01,0x10,0x01,0x63,0xee,0xdd,
-0xdd,0xdd,0xde,0xf0,0x0a,0x44,0x11,0x44,0x7a,0x00,0x03,0x2d,0x15,0x03,0xdc,0x0a,
-0x04,0xaa,0x50,0x14,0x6f,0x1b,0x00,0x17,0x7f,0x1b,0x00,0x10,0x08,0xae,0x4a,0x01,
-0xc0,0x69,0xa3,0xf9,0x33,0x33,0x1b,0xe3,0x33,0x33,0x30,0x02,0xef,0xac,0x2d,0x80,
-0x00,0xdd,0x14,0xf2,0x08,0xd3,0x02,0xe7,0x9d,0x2a,0x13,0x2e,0x06,0x45,0x50,0x23,
-0x36,0xf3,0x33,0x24,0x74,0x90,0x60,0x0a,0xdd,0xef,0xdd,0xd8,0x9f,0x11,0x68,0x00,
-0xac,0x13,0x20,0x09,0xc0,0x80,0x26,0x50,0xfd,0xef,0xdd,0xf3,0x9c,0x77,0x05,0x51,
-0x5d,0x02,0xf0,0x0f,0x39,0x13,0x00,0x38,0xfe,0xef,0xee,0x13,0x00,0x40,0x4a,0xbf,
-0x30,0x05,0x73,0x0c,0x40,0x9c,0x01,0x87,0x30,0x65,0x03,0x01,0x68,0x36,0x01,0xd1,
-0x67,0x20,0xfd,0x9c,0x2a,0x2b,0xf1,0x00,0x22,0x25,0xf2,0x22,0x28,0xe4,0x44,0x48,
-0xf0,0x00,0x00,0x2f,0x00,0x00,0x2d,0xb8,0x31,0x01,0xb2,0x0f,0x21,0x41,0x00,0x03,
-0x10,0x03,0xb9,0x9c,0xd1,0x07,0xc0,0x72,0x11,0x11,0xf7,0x11,0x11,0x00,0xb5,0x7c,
-0x0f,0x2e,0x8a,0x03,0xe2,0x06,0xb7,0xc4,0xd0,0x01,0x11,0xf7,0x11,0x10,0x00,0x2e,
-0x7c,0x97,0x06,0xb8,0x07,0x32,0x98,0xc8,0x10,0xb0,0x57,0x31,0xaa,0xde,0x98,0x8a,
-0x41,0x52,0xd1,0x19,0x9e,0xe9,0x81,0x1c,0x01,0x30,0x01,0xff,0x20,0xe7,0x52,0x00,
-0x9f,0x22,0xf1,0x07,0xfc,0x00,0x3f,0x54,0x44,0x49,0xe0,0x00,0x0c,0xed,0xc7,0x03,
-0xf2,0x11,0x11,0x7e,0x00,0x03,0xf8,0xc4,0xf1,0x3f,0xb4,0x06,0x50,0xc9,0x7c,0x05,
-0x03,0xf1,0x59,0x13,0xf1,0x03,0x3f,0x27,0xc0,0x00,0x3f,0xdd,0xdd,0xde,0xe0,0x00,
-0x50,0x7c,0x00,0x03,0xf3,0x22,0x22,0x8e,0x3a,0x1d,0x80,0x3f,0x10,0x01,0x28,0xe0,
-0x00,0x00,0x7c,0x03,0x01,0x19,0x5f,0xf0,0x01,0x05,0x14,0x11,0x12,0x44,0xab,0x1f,
-0x14,0x40,0xd5,0x01,0x10,0xc1,0xd3,0x0d,0x20,0x5f,0x41,0x77,0x5b,0x16,0x0d,0x1a,
-0x33,0x02,0x2d,0x00,0x14,0x0d,0x4f,0x08,0x70,0x02,0x22,0x22,0x4d,0xf4,0x22,0x33,
-0xc4,0x01,0x51,0x28,0xf8,0x10,0x17,0xfa,0xb4,0x57,0x31,0xfe,0xff,0xfe,0x42,0x03,
-0x41,0x43,0x4a,0xfd,0x60,0xcc,0x17,0x50,0x5b,0xfa,0x40,0x01,0x29,0xe9,0xa4,0xf2,
-0x1c,0xff,0xee,0xff,0xfe,0xdd,0xce,0xc0,0x00,0x66,0x59,0x52,0x1e,0x70,0x12,0x01,
-0x92,0x00,0x02,0xce,0x50,0x0e,0x70,0x6f,0xb4,0x00,0x05,0xbf,0x91,0x34,0x4e,0x70,
-0x00,0x7f,0xc3,0x05,0x92,0x00,0x6f,0xfc,0x20,0x00,0x01,0x92,0x3d,0x36,0x00,0x5f,
-0x9e,0x02,0xa0,0x4e,0x14,0x30,0x64,0x6e,0x13,0x30,0xd5,0x31,0x00,0x27,0x5e,0x10,
-0x39,0xc0,0x42,0x14,0x1e,0xd5,0x25,0x13,0xe6,0x3f,0x8d,0xf0,0x09,0x7e,0x60,0x03,
-0xdb,0x10,0x06,0xe3,0x00,0xe7,0x42,0x3a,0xf8,0x34,0x5b,0xc4,0x00,0x04,0x20,0x0a,
-0xfe,0xce,0xfc,0x50,0x27,0x13,0x03,0xf0,0x06,0x6b,0x93,0x00,0x01,0xbc,0x10,0x01,
-0x8c,0xff,0xbb,0xcd,0xef,0xff,0xee,0x20,0x0b,0xa8,0x76,0x55,0xf5,0x10,0x6c,0x31,
-0xf2,0x0a,0x4c,0x30,0x1f,0x30,0xb9,0x10,0x10,0x00,0x8f,0x70,0x01,0xf3,0x02,0xbf,
-0x70,0x06,0xed,0x40,0x44,0x6f,0x30,0x00,0x5e,0xd2,0x37,0xb5,0x5a,0x00,0xb2,0x4e,
-0x14,0xb3,0xf8,0x06,0x11,0xf1,0xaa,0x33,0x10,0xf6,0xfa,0x13,0xf1,0x03,0x5f,0x77,
-0xaf,0x77,0xf7,0x00,0x6e,0x05,0xd0,0x5e,0x00,0x5e,0x00,0xe7,0x01,0xe5,0x0d,0x90,
-0x09,0x00,0x41,0x0b,0xd6,0x9e,0x10,0x09,0x00,0x41,0x1f,0xdc,0xf5,0x00,0x09,0x00,
-0xe1,0x00,0x0b,0xa3,0x70,0x5f,0x00,0x6e,0x00,0xe7,0x00,0x7d,0x02,0xf1,0x5f,0x49,
-0x67,0xc1,0xf6,0x57,0xe6,0x5f,0x44,0x8f,0x44,0xe7,0x0f,0xfe,0xc9,0xaa,0x24,0x00,
-0x41,0x04,0x10,0x00,0x30,0x09,0x00,0x41,0x05,0x63,0x82,0xf0,0x09,0x00,0x41,0x09,
-0x83,0xd0,0xc5,0x09,0x00,0xd1,0x0c,0x51,0xf0,0x89,0x5f,0x55,0x9f,0x55,0xe7,0x0f,
-0x10,0xf1,0x36,0x3f,0x00,0x52,0x2a,0x00,0x40,0x00,0x5e,0x55,0xa8,0x12,0xc4,0x94,
-0x73,0x01,0xe3,0x2e,0x23,0x09,0xe0,0xac,0x7f,0x11,0x02,0xc2,0x19,0xf0,0x00,0x06,
-0xe1,0x3d,0x11,0xdf,0x54,0x45,0xf7,0x00,0x01,0xe5,0x0c,0xc0,0xce,0xd9,0x47,0x63,
-0xf1,0x00,0xbe,0x69,0xf2,0x7f,0x33,0xf5,0x6f,0x40,0x00,0x0f,0xdc,0xf7,0x00,0x20,
-0x06,0xd3,0x39,0x51,0xbc,0x65,0x00,0x00,0x7f,0x4d,0x3c,0x50,0x16,0xc0,0x02,0xcf,
-0x67,0xd0,0x68,0xf0,0x04,0x86,0xaf,0x3a,0xfc,0x20,0x04,0xee,0x80,0x0f,0xfd,0xb8,
-0xe6,0xa5,0x0b,0x81,0x01,0x8c,0x00,0x30,0xb9,0x0e,0x10,0x4c,0x47,0x63,0x50,0x83,
-0x93,0xd0,0x00,0x00,0xf5,0xba,0x52,0x8a,0x2e,0x0e,0x30,0x42,0x58,0x9a,0x50,0xf1,
-0xa7,0x0c,0xfd,0x72,0xcc,0x08,0x92,0x0f,0x23,0x20,0x02,0x7d,0xfb,0x40,0x00,0x1c,
-0x4c,0x10,0x05,0x2d,0xab,0x01,0x40,0x91,0x16,0xc4,0x24,0x4b,0x10,0x1f,0x41,0x02,
-0x10,0x20,0x7f,0x75,0xc0,0x4c,0xb4,0x44,0x4d,0xd0,0x00,0x07,0xf1,0x2e,0x30,0x5f,
-0x20,0x07,0x6f,0xf0,0x05,0xf6,0x0b,0xd0,0x00,0xcc,0x02,0xeb,0x00,0x01,0xcf,0x79,
-0xf3,0x00,0x01,0xeb,0xdd,0x00,0x00,0x1f,0xed,0x68,0xc5,0x00,0x96,0x16,0xf1,0x11,
-0x10,0xbc,0x47,0x00,0x4c,0xf9,0xbf,0xa3,0x00,0x00,0x7e,0x13,0xf4,0xef,0xa2,0x43,
-0x4c,0xfe,0x20,0x7f,0xa8,0xaf,0x66,0x10,0x0b,0xa0,0x02,0x50,0x0e,0xfc,0xa7,0xaa,
-0x8c,0x0f,0x00,0x6c,0x1d,0x11,0x05,0x2d,0x02,0xe1,0x06,0x84,0xb1,0xf1,0x15,0x55,
-0xdc,0x55,0x51,0x00,0xa9,0x3f,0x0c,0x60,0xeb,0x32,0x42,0x0c,0x61,0xf1,0x7a,0x26,
-0x00,0xc3,0xf3,0x0f,0x23,0x64,0x44,0x4d,0xb4,0x44,0x40,0x3f,0x00,0x92,0x5f,0x71,
-0x07,0xe5,0x08,0x14,0xa3,0xe2,0x08,0x22,0x5f,0x20,0x23,0x28,0x00,0x5e,0x26,0x00,
-0x0f,0x45,0x62,0x54,0x00,0x05,0xf2,0x1a,0x3f,0x51,0x27,0x10,0xe7,0x2c,0x0b,0xf0,
-0x04,0x80,0x12,0x00,0x00,0xbe,0x67,0xf4,0x00,0x0c,0xc0,0x08,0xd0,0x00,0x1f,0xed,
-0xfa,0x00,0x08,0xf2,0x5a,0xd7,0x60,0x10,0xad,0x47,0x0b,0xfe,0xcd,0x2f,0x16,0xf0,
-0x01,0x6f,0x23,0xf1,0xaa,0x86,0x43,0x10,0x9c,0x00,0x5f,0x86,0x8f,0x60,0x0b,0x30,
-0x68,0x3e,0x26,0x60,0xc9,0xcb,0x01,0xf4,0x09,0xb0,0x16,0x01,0xd0,0x04,0x30,0x2f,
-0x30,0x9b,0x00,0x00,0x04,0x73,0x76,0xa0,0x05,0xf1,0x13,0x00,0xf6,0x16,0x89,0x4c,
-0x1f,0x00,0x9c,0x00,0x9b,0x00,0x91,0x0a,0x71,0xf0,0xc4,0x2f,0x80,0x09,0xb0,0x0f,
-0x20,0xe3,0x0f,0x12,0x3d,0xd0,0x00,0x9d,0x35,0xf1,0x1e,0x00,0x70,0x3f,0xc2,0x00,
-0x04,0xef,0xfa,0x70,0xa5,0x00,0x54,0xaa,0x00,0x55,0x10,0x00,0x35,0x34,0x00,0x61,
-0x07,0x12,0xe5,0x28,0x48,0xf1,0x2b,0xe7,0x77,0x0e,0x50,0xe6,0x00,0x07,0xd0,0x69,
-0x0e,0x74,0xe0,0xe5,0x5f,0x10,0x01,0xf5,0x0e,0x70,0xe7,0x0e,0x4e,0x5c,0x80,0x00,
-0xbd,0x59,0xd0,0x0e,0x70,0x85,0xe6,0xd0,0x00,0x1f,0xfe,0xf5,0x00,0xe7,0x66,0x6f,
-0x96,0x65,0x00,0x10,0xba,0x32,0x0e,0x7c,0xde,0xfe,0xdd,0xa0,0x00,0x6e,0x16,0xa0,
-0xe7,0x14,0x92,0xf0,0x1e,0x3f,0x76,0xaf,0x0e,0x70,0x2f,0xff,0x70,0x00,0x0f,0xfe,
-0xb8,0xd4,0xe7,0x0a,0x8e,0x7f,0x50,0x00,0x41,0x00,0x04,0x1e,0x74,0xf1,0xe5,0x5f,
-0x30,0x01,0x91,0x85,0xa0,0xe9,0xe7,0x0e,0x50,0xa5,0x00,0x5c,0x1f,0x1f,0x0e,0x8a,
-0x00,0xe5,0x2c,0x4d,0x31,0xf1,0xc4,0xe7,0x53,0x74,0xc2,0xc5,0x0d,0x34,0x1e,0x94,
-0x44,0x55,0x44,0x40,0x0e,0x10,0x61,0xbe,0x05,0x08,0x3e,0x30,0x00,0x0e,0x02,0x12,
-0x98,0x6e,0x44,0x93,0x02,0x22,0x2b,0xb2,0x22,0x20,0x00,0x1f,0x50,0x7c,0x01,0x42,
-0x08,0xd0,0x5a,0x00,0x95,0x55,0xb2,0xf4,0x0d,0x80,0x13,0x33,0xcb,0x33,0x31,0x00,
-0xcd,0x59,0x38,0x33,0x35,0x40,0x1e,0xcc,0xb9,0x1c,0x32,0xb9,0x63,0x0f,0x6d,0x0e,
-0x30,0x7c,0x07,0x90,0x27,0x62,0xf6,0x3e,0x8d,0x00,0x5f,0x89,0xcf,0x1f,0x24,0x60,
-0x18,0x06,0xd0,0x0f,0xfb,0x85,0xd4,0x61,0x8c,0x02,0xf1,0x26,0x00,0x20,0x00,0x14,
-0x00,0x09,0xb0,0x2f,0x10,0x00,0x03,0xb3,0xa4,0xc0,0x00,0xc9,0x02,0xf1,0x00,0x00,
-0x6b,0x2e,0x0e,0x20,0x2f,0x40,0x2f,0x10,0x40,0x09,0x80,0xf0,0x97,0x0c,0xd0,0x02,
-0xf1,0x0c,0x50,0xe4,0x0f,0x22,0x3b,0xf3,0x00,0x2f,0x53,0xe3,0x1b,0x00,0x30,0x0b,
-0xe4,0x00,0x00,0xcf,0xfc,0x96,0x4c,0x01,0x87,0x59,0x04,0xfe,0x26,0x00,0x5a,0x76,
-0xb0,0x20,0x4f,0x00,0xd4,0x00,0x07,0xf5,0x55,0x9e,0x00,0x4f,0xe2,0x21,0x30,0xd6,
-0x00,0xd7,0x2f,0x17,0xa1,0x3e,0x00,0x4f,0x39,0xc0,0x00,0x4f,0xcc,0xdd,0xde,0x9c,
-0x94,0x10,0x4f,0xaa,0x65,0x31,0x3c,0xef,0x91,0x36,0x00,0x40,0x8c,0xf9,0x03,0xdf,
-0x09,0x29,0x31,0x5b,0x15,0x10,0x10,0xcd,0x41,0x4b,0xb3,0x01,0x8d,0x9e,0x3e,0x50,
-0xfe,0xcd,0xde,0x81,0x30,0x36,0x2b,0x60,0x48,0xcb,0x50,0x00,0xac,0x20,0x6d,0x51,
-0xf0,0x15,0xaa,0xbc,0xcd,0xef,0xf5,0x00,0x0a,0xa9,0x97,0x65,0xe9,0x22,0x20,0x4d,
-0x10,0x00,0x08,0xe3,0x00,0xd7,0x06,0xfa,0x30,0x00,0x29,0xea,0x11,0x11,0xe7,0x00,
-0x17,0xeb,0x20,0x17,0x20,0x08,0x97,0x2d,0x11,0x16,0xf3,0x03,0x12,0x02,0x92,0x43,
-0x23,0x3f,0x40,0xe7,0x3e,0x02,0xb4,0x1e,0x00,0x1a,0x35,0x30,0xf2,0x0c,0x40,0xac,
-0x16,0x61,0x00,0x00,0xd7,0x08,0xf1,0x0e,0xfb,0x09,0x32,0xbf,0x67,0xf6,0x79,0x35,
-0x40,0x1f,0xfd,0xfb,0x00,0xff,0x2c,0x62,0xc4,0x00,0x10,0x8e,0x37,0x2f,0xb9,0x08,
-0x41,0x5f,0x20,0xf2,0x01,0xcd,0x35,0xf0,0x2e,0x6f,0x96,0x8e,0x66,0xe2,0x0a,0xa0,
-0x0c,0xb0,0x0f,0xfd,0xa8,0xaa,0x08,0xe2,0xac,0x1c,0xa0,0x00,0x20,0x00,0x15,0x30,
-0x08,0x3c,0xff,0x70,0x00,0x05,0x94,0xb4,0xc0,0x00,0x5e,0xfc,0xe6,0x00,0x00,0x89,
-0x2e,0x0f,0x12,0xbe,0x5a,0xa3,0xf8,0x00,0x0b,0x60,0xf0,0xb8,0xfb,0x10,0xaa,0x03,
-0xde,0x10,0xf2,0x0f,0x20,0x03,0x8b,0x37,0x30,0x50,0x18,0x00,0xe3,0x8c,0x11,0xe5,
-0x3c,0x01,0x14,0xc3,0xa3,0x3c,0x22,0x7f,0x10,0x13,0x7a,0x00,0x6f,0x1d,0x12,0x5f,
-0x86,0x7e,0x40,0xe1,0x5d,0x16,0xf2,0xfd,0x13,0x51,0x01,0xe5,0x0d,0xb0,0x6f,0x23,
-0x14,0x32,0xbe,0x6a,0xf1,0x0a,0x07,0x42,0x1f,0xfe,0xf7,0x00,0x10,0x14,0x41,0x20,
-0xbb,0x53,0x06,0x26,0x00,0x42,0x00,0x8e,0x18,0xa0,0x39,0x00,0x30,0x8f,0x86,0xaf,
-0xf8,0x10,0xf1,0x2d,0x06,0x30,0x0e,0xeb,0x86,0xf4,0xdd,0xdd,0x7f,0x55,0xf5,0x00,
-0x10,0x00,0x36,0x14,0x4d,0xb6,0xfe,0xe3,0x00,0x06,0xa6,0xa7,0x90,0x05,0xf4,0x6e,
-0xc7,0x00,0x00,0x98,0x4c,0x2e,0x02,0xea,0x06,0xe3,0xf4,0x00,0x0c,0x63,0xe0,0x86,
-0xfb,0x00,0x6e,0x07,0xf7,0x01,0xf2,0x1d,0x00,0xb9,0x03,0x4a,0xe0,0x06,0xd0,0x17,
-0xd4,0x10,0x1a,0xe7,0xc9,0x46,0x00,0x59,0xc7,0x23,0xf1,0x00,0x05,0x1c,0x11,0xb7,
-0x16,0x0f,0x12,0x02,0x93,0x13,0xd0,0x7d,0x08,0xa2,0xf3,0x22,0x22,0x22,0xf4,0x01,
-0xf5,0x0e,0x62,0xf0,0xda,0x04,0xc1,0x0a,0xd3,0x8c,0x02,0xf4,0x33,0x33,0x34,0xf4,
-0x1f,0xff,0xf3,0x07,0x3c,0x52,0xd4,0x02,0x1b,0x77,0x22,0xc7,0x1d,0x40,0x7b,0x09,
-0x82,0xfd,0xa8,0x07,0xf0,0x08,0x06,0xf9,0x9d,0xd3,0xff,0x44,0xe3,0xe4,0x5e,0x0e,
-0xeb,0x86,0xf5,0xff,0x11,0xd0,0xd1,0x1e,0x01,0x00,0x05,0x46,0xdf,0x09,0x00,0xe0,
-0x06,0x98,0x7c,0x48,0xbf,0xee,0xfe,0xfe,0xee,0x09,0x86,0x97,0x8a,0x9f,0x24,0x00,
-0x50,0x0b,0x64,0xb3,0xae,0x5f,0x1b,0x00,0xfd,0x03,0x0f,0x23,0xc0,0x4f,0x1f,0x11,
-0xd0,0xd1,0x2e,0x1a,0x00,0x00,0x16,0x0f,0x10,0x50,0x54,0xfb,0x66,0x75,0x04,0x57,
-0x29,0x40,0xf0,0x0a,0xa0,0x05,0x06,0x23,0xe0,0x6f,0x00,0xab,0x33,0x7f,0x33,0x3f,
-0x83,0x38,0xf0,0x08,0xcc,0xcc,0xcd,0x10,0x0a,0x00,0x71,0x2b,0x10,0x8f,0x05,0x11,
-0x15,0x9f,0xec,0x62,0x04,0xc5,0x42,0x02,0xc2,0x29,0x01,0x40,0x23,0x02,0x6f,0x0e,
-0x10,0x4f,0x37,0x11,0x1f,0xdf,0x11,0x00,0x11,0x22,0x05,0xf1,0x6d,0x4f,0x05,0xfd,
-0x0c,0x04,0x09,0x5d,0x14,0x10,0x13,0x00,0x11,0xe0,0xb6,0x58,0x10,0x0f,0x15,0x2e,
-0xa7,0xc9,0x11,0x7e,0x11,0x1f,0x61,0x18,0xe0,0x00,0xbf,0x56,0x47,0x11,0xb9,0xf6,
-0x8d,0x11,0x0f,0x84,0x0a,0x20,0x7f,0x60,0xbc,0x02,0x41,0xca,0x22,0x4d,0xf4,0xb6,
-0x13,0x67,0xcb,0x36,0xef,0x63,0x33,0x0d,0x18,0x12,0x23,0x39,0xed,0x7b,0x8e,0x02,
-0xbb,0x18,0x40,0x0d,0xfd,0x9f,0x71,0x58,0x2a,0x50,0x20,0x03,0x10,0x0e,0xed,0x90,
-0x00,0x00,0xe0,0x07,0x10,0x82,0xc7,0x36,0x00,0x09,0x00,0x02,0x1b,0x00,0x04,0xe2,
-0x0a,0x12,0x20,0xa7,0x78,0x05,0x71,0x3f,0x00,0x19,0x15,0x80,0x0a,0xdd,0xdd,0xfe,
-0xdd,0xd7,0x7f,0x30,0xbb,0x53,0x43,0xf9,0x44,0x49,0xf5,0x1b,0x00,0x21,0x8f,0x50,
-0xb7,0x73,0x68,0xf9,0x4a,0xf9,0x44,0x43,0x06,0x96,0x12,0x23,0x9f,0x90,0x6c,0xa3,
-0x03,0xea,0x46,0x12,0x6d,0x5a,0x00,0x42,0x02,0x8f,0xf8,0xae,0x48,0x21,0x40,0xe7,
-0x10,0xf8,0x22,0x27,0x29,0x12,0x02,0x9c,0x60,0x1c,0xf2,0x66,0xb0,0x03,0x81,0x22,
-0x33,0x34,0x33,0x6f,0x7e,0x65,0x05,0x4c,0x12,0x0d,0x3e,0x0f,0x00,0x8f,0x4e,0x03,
-0x09,0x00,0x00,0xd8,0x0c,0x82,0x14,0x44,0x49,0xf4,0x44,0x43,0x9e,0x20,0xac,0x01,
-0x23,0xfe,0xf3,0x1b,0x00,0x22,0x8e,0x30,0x09,0x00,0x27,0x2c,0xd2,0xca,0x0b,0x94,
-0x04,0x55,0x55,0x57,0xef,0x85,0x55,0x55,0x54,0xdf,0xaa,0x00,0x9f,0x20,0x00,0x0a,
-0x63,0x10,0x53,0xb3,0x00,0x00,0x29,0x01,0x40,0xf8,0x00,0x1e,0xfc,0x05,0x8d,0x00,
-0x7b,0x6a,0x11,0x20,0xb4,0x2c,0x10,0xe8,0x94,0x0a,0x02,0x1b,0x00,0x03,0x07,0x2a,
-0x01,0x12,0x00,0x00,0xf3,0x7a,0x01,0x09,0x00,0x05,0x64,0x8c,0x10,0xc6,0x6c,0x7a,
-0x00,0xbe,0x2d,0x00,0x61,0x60,0x30,0x4b,0x90,0x0a,0xdc,0x0a,0x42,0x7f,0xae,0xfa,
-0x40,0xcd,0x7e,0x11,0x84,0x35,0x03,0x10,0xe7,0xc2,0x10,0xf1,0x01,0x56,0x08,0xbd,
-0xfe,0xf7,0x00,0x7f,0x42,0x23,0xbc,0x0a,0x84,0x10,0xe7,0x00,0x2e,0x8c,0x23,0x64,
-0x22,0x54,0x22,0x22,0x23,0x31,0x04,0x5e,0x13,0xf5,0xaf,0x0f,0x10,0x01,0x09,0x00,
-0x00,0x20,0x03,0x10,0xcd,0x38,0xc8,0x00,0xd7,0x13,0x19,0x34,0x1b,0x00,0x05,0x2d,
-0x00,0x00,0x73,0x1b,0x13,0x12,0x1b,0x00,0x23,0x03,0x35,0x09,0x00,0x1f,0x0a,0xee,
-0x79,0x03,0x51,0x4d,0x20,0x00,0x06,0xd0,0x33,0x17,0xf0,0x09,0x1a,0x20,0x07,0xe0,
-0x00,0x23,0x00,0x05,0xf3,0x0b,0xc0,0x07,0xe0,0x4b,0xfc,0x00,0x3e,0x80,0x14,0xf7,
-0x07,0xfe,0xe9,0x30,0x87,0x02,0x30,0xef,0x17,0xf4,0x91,0x01,0xf0,0x01,0x31,0x00,
-0x1a,0x27,0xe0,0x00,0x03,0xc0,0x03,0x33,0x33,0x31,0x06,0xf0,0x00,0x06,0xe4,0x7b,
-0x01,0xee,0x25,0x10,0x90,0x5a,0x2d,0x40,0x03,0x94,0x55,0x54,0x04,0x14,0x11,0xe7,
-0x5a,0x20,0x00,0x1b,0x00,0x50,0x07,0xe0,0x00,0x5a,0x00,0x1b,0x00,0xa0,0x07,0xe1,
-0x7d,0xf9,0x10,0x0f,0x74,0x44,0xf7,0x07,0xc0,0x17,0x40,0x0f,0xdc,0xcc,0xf7,0x22,
-0x4f,0x00,0x08,0x21,0x00,0x2d,0x00,0xf2,0x04,0x01,0xf2,0x0f,0x40,0x45,0xf7,0x06,
-0xf7,0x66,0x6a,0xf0,0x0f,0x40,0xcf,0xc2,0x00,0xad,0xdd,0xdc,0xd8,0x5a,0x05,0x49,
-0xba,0x63,0x44,0x44,0x5f,0x94,0x44,0x44,0xba,0x47,0x22,0xf1,0xe8,0x41,0x0a,0x12,
-0xe7,0x07,0x00,0x01,0xe5,0x0c,0x23,0x27,0xf1,0x1c,0x00,0x10,0xe9,0x0e,0x00,0x15,
-0x28,0x1c,0x00,0x02,0x07,0x00,0x03,0x1c,0x00,0x20,0xea,0x44,0xb2,0x30,0x04,0x1c,
-0x00,0x1a,0xe7,0x1c,0x00,0x01,0xfd,0xab,0x18,0xe1,0x46,0x23,0x13,0xf2,0x3a,0x04,
-0x35,0x2f,0x81,0x11,0x14,0x9b,0x40,0xe0,0x00,0x08,0xe2,0x62,0x00,0x12,0x9e,0x6b,
-0x25,0x00,0xca,0x17,0x40,0x08,0xfd,0xdd,0xdd,0x4d,0x45,0x32,0x00,0x8f,0x44,0x9d,
-0x51,0x23,0x08,0xe0,0x22,0x50,0x20,0x8f,0x33,0x5f,0x0b,0x00,0xa7,0xe0,0x03,0x1c,
-0x03,0x11,0x8e,0x5c,0x2f,0x40,0x56,0x00,0x08,0xe0,0xb3,0x15,0x20,0x9f,0xa0,0x44,
-0x00,0x32,0x8f,0x54,0xde,0x7d,0x5e,0x21,0x8f,0xf9,0x15,0x26,0x40,0x15,0x40,0x7f,
-0xd4,0x50,0xbf,0xa0,0xdf,0xf8,0x00,0x2c,0xfc,0x72,0x03,0xff,0xd9,0x40,0x8b,0x19,
-0x27,0xe0,0x05,0x88,0x85,0x15,0xa7,0x9d,0x54,0x32,0x73,0x33,0x32,0xeb,0x56,0x03,
-0x17,0x2c,0x33,0x00,0x1d,0xc0,0xfd,0x8d,0x23,0x1d,0xe1,0xd9,0x79,0xb1,0x3d,0xfa,
-0x66,0x66,0xcf,0x86,0x66,0x60,0x00,0x2f,0xef,0x19,0x10,0x72,0xef,0x10,0x00,0x81,
-0xe7,0x00,0x02,0xbf,0x56,0x00,0xad,0x62,0x01,0x88,0x5a,0x00,0x4e,0x72,0x12,0xf3,
-0x13,0x00,0x05,0x64,0xab,0x01,0x62,0x0e,0x15,0x47,0x3d,0x5f,0x14,0x15,0x5a,0x0e,
-0x00,0x46,0x1b,0x24,0x0e,0x70,0x5e,0x50,0x20,0xbe,0x65,0x46,0x2b,0x51,0x7f,0x80,
-0x00,0x02,0xae,0xe6,0x00,0x18,0x90,0x91,0xa5,0x21,0x00,0x6f,0xfd,0x82,0x00,0x6e,
-0x48,0x02,0x31,0x95,0x11,0x00,0x44,0x5b,0x42,0x5f,0x87,0x84,0x40,0x6a,0x10,0x32,
-0x51,0x4f,0x50,0x7a,0x18,0x44,0x3f,0x73,0x89,0x10,0xf9,0xa6,0x11,0xf7,0x0f,0x20,
-0x02,0x0e,0x10,0xf0,0x1d,0xd7,0x7d,0xdd,0xdd,0xd2,0xc7,0x07,0x70,0x00,0x0d,0x79,
-0x81,0x8a,0x11,0x0a,0x90,0xe7,0x00,0x00,0xd7,0x99,0x18,0xa1,0x10,0x9a,0x5f,0x10,
-0x00,0x0f,0x59,0xec,0xcc,0xcf,0x06,0xdb,0xb0,0x00,0x00,0xf4,0x98,0x00,0x01,0xf0,
-0x3f,0x3a,0x6e,0x60,0x39,0xfe,0xee,0xff,0x01,0xfa,0x03,0x1c,0x40,0x98,0x07,0x90,
-0x00,0x8b,0x04,0xf1,0x05,0x8c,0x09,0xdb,0xde,0xbb,0x8f,0x9f,0x20,0xc3,0x1f,0x60,
-0x24,0x44,0x47,0xee,0x30,0xcd,0x7f,0x30,0x90,0x32,0x24,0x38,0x01,0xbf,0xa0,0x4b,
-0x04,0x14,0xe2,0xf8,0x01,0x11,0xf8,0x79,0x05,0x10,0xf8,0x1c,0xd6,0x20,0x04,0x66,
-0x79,0x75,0x03,0xe1,0xad,0x01,0xf9,0x35,0x14,0x69,0x0f,0x9f,0x15,0x3f,0x65,0xa8,
-0x22,0xd0,0x36,0x3c,0x7f,0x32,0x0c,0xf3,0x08,0x3b,0x01,0x32,0x1d,0xff,0x10,0x6b,
-0x13,0x33,0x2e,0xf9,0xf1,0x6c,0x13,0x23,0xb2,0x4f,0x13,0x00,0x02,0x54,0x24,0x01,
-0xb5,0x03,0x0f,0x13,0x00,0x0d,0x32,0x47,0x79,0xf2,0x13,0x00,0x2a,0x05,0xee,0x46,
-0x49,0x51,0xba,0x13,0x46,0x8a,0xd7,0x5e,0x01,0xa0,0x38,0xed,0xde,0x75,0x29,0xff,
-0xfb,0x00,0x4f,0x70,0x95,0x01,0x60,0x24,0x44,0x30,0x2f,0x90,0x2a,0x2d,0x5e,0x00,
-0x74,0x8d,0x53,0x4f,0x54,0x49,0xc4,0x44,0x72,0x0b,0x13,0x6b,0xb8,0x26,0xf0,0x0d,
-0x6f,0xef,0xfe,0xfb,0xbd,0xdd,0xd1,0x03,0xff,0x26,0x90,0x6b,0x05,0xb5,0x6e,0xa6,
-0x02,0xee,0xf2,0x6f,0xde,0xfd,0xeb,0x00,0xe6,0x00,0x5d,0x3f,0x13,0x00,0x20,0xb0,
-0x0e,0x56,0x47,0x00,0x26,0x00,0x01,0x45,0x13,0x10,0x20,0x39,0x00,0x01,0x13,0x00,
-0x41,0x5c,0xcd,0xec,0xc9,0x13,0x00,0x51,0x22,0x44,0x9c,0x44,0x30,0x13,0x00,0x41,
-0x00,0x07,0xc3,0x46,0x13,0x00,0x60,0x2d,0xff,0xfe,0xcb,0x94,0x4f,0x13,0x00,0x10,
-0x33,0x58,0xd1,0x0a,0xbe,0x20,0x04,0x47,0x5e,0x13,0x03,0x69,0x0e,0x26,0x00,0x02,
-0x93,0x5c,0x06,0x0b,0x60,0x02,0x9f,0x0e,0x05,0xf5,0x62,0x07,0x73,0xc0,0x00,0x6d,
-0x09,0x20,0x49,0xf4,0x65,0x34,0x40,0x0d,0xee,0xee,0xef,0x16,0x43,0x11,0xe6,0xa5,
-0xb7,0x00,0x83,0x3f,0x01,0xf4,0xbe,0xf0,0x06,0x01,0xf4,0x00,0x4e,0x90,0x00,0x02,
-0x9f,0xf4,0x00,0x09,0xe1,0x7f,0x80,0x00,0x2b,0xfe,0xaf,0x20,0x00,0x0d,0x1c,0x15,
-0x34,0xa5,0x04,0xf2,0x51,0xc3,0x61,0x4f,0x20,0x16,0x90,0x3e,0xe4,0x75,0x99,0x40,
-0xcf,0xe9,0x00,0x1c,0xc7,0x76,0x20,0xdf,0xe9,0x66,0x01,0x13,0xb8,0x6a,0xc2,0x13,
-0x00,0xc2,0xbf,0x04,0x2c,0x08,0x10,0x16,0x5e,0xdd,0x05,0xa2,0x0f,0x09,0x06,0x28,
-0x05,0xd0,0x66,0x30,0x2f,0xdc,0xcc,0x12,0x22,0x41,0x00,0x02,0x24,0xf4,0xb6,0x7b,
-0x15,0x21,0xcd,0x27,0x12,0x90,0xcd,0x01,0x24,0x06,0xf0,0x26,0x00,0x11,0xef,0x39,
-0x00,0x51,0x5e,0xf9,0xf7,0x55,0x52,0x74,0x05,0x40,0xd2,0x0d,0xc0,0x05,0x5a,0xc6,
-0xf1,0x0a,0xbf,0xc0,0x00,0x4f,0x8a,0xe5,0x00,0x01,0x8e,0xfa,0xd9,0x00,0x00,0x7f,
-0xd1,0x00,0x00,0x1b,0x71,0x0c,0x90,0x04,0x71,0x8f,0xb2,0x86,0x44,0xa0,0xdf,0xfb,
-0x20,0x4e,0xfc,0x60,0x00,0x00,0x3f,0xb7,0xb8,0x1f,0x18,0xb8,0xac,0x48,0x00,0x82,
-0xa8,0x20,0xe3,0x00,0x07,0x13,0x12,0xc8,0x33,0x45,0x70,0x02,0xcd,0x1c,0x83,0x44,
-0x46,0xf7,0xbe,0x22,0x33,0xb3,0xc8,0xaf,0x50,0x34,0x23,0x0d,0x80,0x46,0x43,0x22,
-0x6d,0xf8,0x26,0x00,0x31,0x08,0xee,0x7d,0xc1,0x4b,0x00,0xa0,0x06,0x12,0xc8,0x32,
-0xd9,0x00,0xd7,0x28,0x21,0x59,0x33,0x4a,0x47,0x01,0xa2,0xbc,0x09,0xee,0x59,0xf0,
-0x00,0x33,0x33,0x35,0xed,0x8f,0x43,0x33,0x64,0x30,0x00,0x00,0x29,0xf9,0x00,0xcc,
-0xd9,0x99,0xf1,0x02,0x48,0xdf,0xf6,0x00,0x02,0xeb,0xea,0x10,0x00,0x0b,0xa5,0x1f,
-0x50,0x00,0x22,0xee,0x40,0x20,0x9f,0x40,0x8c,0xfe,0x01,0x9f,0x7f,0xb7,0x30,0xdf,
-0xea,0x63,0x7f,0x08,0x05,0xe1,0x3c,0x12,0x10,0x75,0xc0,0x02,0x35,0x04,0x10,0xa8,
-0x37,0x03,0xf0,0x0c,0x5d,0x00,0x00,0xce,0xbe,0xeb,0xba,0x00,0xf4,0x05,0xe0,0x00,
-0x5e,0x33,0xba,0x33,0x30,0x0f,0x40,0x5e,0x00,0x05,0x82,0x2b,0xa2,0x22,0x10,0x13,
-0x00,0x00,0x8c,0x1a,0x10,0xd7,0x13,0x00,0x51,0x00,0x22,0x2b,0x92,0x22,0x26,0x00,
-0x51,0x0f,0xdc,0xfe,0xcd,0xf1,0x13,0x00,0x60,0xf2,0x0a,0x80,0x1f,0x10,0x51,0x13,
-0x00,0x70,0x20,0xa8,0x5e,0xe0,0x00,0x89,0xdd,0x61,0xb8,0x61,0x50,0x3f,0x40,0x04,
-0x76,0x10,0xf7,0xce,0x11,0xfe,0x20,0x35,0x80,0x55,0x55,0x7e,0xfb,0xf6,0x55,0x58,
-0x85,0x8c,0xb1,0xf1,0x08,0xb2,0x0c,0xb0,0x08,0xf7,0x00,0x05,0xae,0xff,0x50,0x00,
-0x2e,0xbe,0xa2,0x00,0x00,0x99,0x43,0xf2,0x00,0x22,0x2d,0xe5,0x3c,0x03,0x60,0xab,
-0xfe,0x60,0x18,0xfd,0x94,0x2a,0xde,0x10,0x62,0x9e,0xb9,0x1e,0xb0,0xd8,0xa8,0x01,
-0x28,0x01,0x02,0x80,0xc8,0x00,0xb0,0x10,0x21,0x0c,0xe3,0xa4,0x02,0x31,0x0b,0x20,
-0x05,0xb6,0x08,0x42,0x0a,0xcc,0xcc,0xa2,0x3b,0x7f,0x40,0x78,0x88,0xcc,0xcf,0xe7,
-0x01,0x00,0x8a,0x1e,0x60,0x46,0xbf,0x33,0x33,0x36,0xf2,0x1e,0x41,0xf1,0x06,0x05,
-0xf1,0x11,0x11,0x5f,0x20,0x00,0x03,0xf5,0x34,0x5f,0xcc,0xcc,0xcd,0xf2,0x00,0x01,
-0xdf,0x4e,0x55,0xf0,0xde,0x20,0xc2,0xbf,0xff,0x60,0x5e,0xef,0xfe,0xee,0xe2,0x00,
-0xbf,0x9e,0x9c,0x99,0x9a,0x51,0x0d,0x44,0xe0,0xd5,0x08,0x5f,0x06,0xf0,0x02,0x10,
-0x4e,0x01,0x1a,0xfe,0x31,0x15,0xf6,0x00,0x00,0x04,0xe0,0x0d,0xc3,0x9d,0x36,0xf7,
-0x43,0x5d,0x41,0x00,0x10,0x00,0xcf,0x95,0xbc,0xfe,0x02,0xe0,0x03,0x6a,0xfd,0x7a,
-0xfc,0x74,0x10,0x00,0x4e,0x03,0xfb,0x83,0x00,0x02,0x7b,0xe2,0xb2,0x00,0x14,0x09,
-0x1c,0x55,0xf4,0x03,0x12,0x22,0x29,0xe2,0x24,0xf6,0x22,0x22,0x10,0x23,0x33,0x9e,
-0x33,0x4f,0x63,0x33,0x20,0x0a,0xe8,0x21,0xf2,0x0b,0xaa,0x00,0x7d,0x00,0x1f,0x40,
-0x08,0xc0,0x0a,0xa0,0x07,0xd0,0x01,0xf4,0x00,0x8c,0x00,0xac,0x44,0xae,0x44,0x5f,
-0x74,0x4a,0xc0,0x09,0xef,0x33,0x11,0xeb,0x1f,0x33,0x01,0x7f,0x4d,0x21,0xdd,0xdf,
-0xaa,0x47,0x41,0xc5,0x55,0x5d,0xf6,0xbd,0x79,0x01,0x70,0x55,0x20,0x2f,0x90,0x0e,
-0x63,0x22,0xc9,0x52,0x4e,0x6b,0xf1,0x01,0x36,0xaf,0xff,0xf6,0x10,0x00,0x00,0x24,
-0x58,0xcf,0xfa,0x6a,0xff,0xd8,0x20,0x9f,0x94,0xb8,0x35,0x49,0xee,0x21,0xa2,0x17,
-0x02,0xc0,0x25,0x24,0x31,0x00,0x10,0x37,0x14,0x70,0x49,0x57,0x15,0xe7,0x81,0x6a,
-0x00,0x13,0x00,0x05,0x6e,0x6d,0x10,0x7e,0x61,0x07,0x19,0x2e,0x26,0x00,0x06,0x39,
-0x00,0x14,0xf3,0x12,0x4a,0x06,0x39,0x00,0x12,0xfe,0x2e,0x4a,0x00,0x45,0xc3,0x52,
-0xa4,0x48,0xf6,0x44,0x20,0x9f,0x52,0x03,0xc8,0x54,0x11,0xbe,0xac,0x3c,0x11,0xb1,
-0x6c,0x5f,0x10,0x4f,0x7c,0x61,0xc1,0x38,0xef,0x60,0x00,0x03,0xf8,0x55,0x5a,0xe0,
-0x0c,0xe9,0x20,0xec,0x3b,0x09,0x46,0xa4,0x12,0x93,0xb1,0x52,0x01,0xb6,0x06,0x12,
-0xef,0x10,0x0b,0x10,0xf5,0x24,0x0b,0x81,0x14,0xf2,0x00,0x8b,0xbf,0xdb,0xb0,0xe6,
-0x33,0x46,0x42,0x88,0xfb,0x88,0x0e,0xb8,0x0a,0x20,0x0f,0x50,0x3e,0x6a,0x12,0x5f,
-0x26,0x00,0x01,0x15,0x05,0x41,0x55,0x5f,0x85,0x51,0xe7,0x61,0x00,0x5f,0x03,0x21,
-0x5e,0x83,0x0c,0x02,0x22,0x1f,0x30,0x4e,0x05,0x00,0x49,0xdd,0x03,0x39,0x00,0xe0,
-0x7e,0xe7,0x00,0x47,0xf6,0x9f,0x44,0x00,0x00,0x0c,0x84,0xf5,0x00,0x5f,0xa5,0x13,
-0x71,0x03,0xf2,0x07,0xf2,0x0c,0xb0,0x6e,0xbd,0x20,0xf7,0x0a,0x06,0x06,0xf3,0x06,
-0xe0,0x08,0x10,0xaf,0x20,0x00,0x18,0xf7,0x00,0x5f,0x44,0xf3,0x0b,0x50,0x00,0x0d,
-0xd5,0x00,0x02,0xef,0xfc,0x23,0x24,0x03,0x16,0x37,0x02,0x37,0x61,0x03,0xbb,0x0b,
-0x40,0xaa,0x00,0x0f,0x51,0xab,0x00,0x41,0x9a,0xab,0xaa,0x50,0x92,0x72,0x53,0x09,
-0xaa,0xaa,0xf8,0x0f,0x63,0x0b,0x32,0x7f,0x10,0xf5,0xea,0x0b,0x31,0x2f,0x60,0x0f,
-0x96,0x39,0x00,0xd6,0x4e,0x02,0x39,0x00,0x32,0x1d,0xfe,0x20,0x39,0x00,0x41,0x2d,
-0xff,0xce,0x20,0x96,0x39,0x42,0x3f,0xc4,0xf3,0xbd,0x39,0x00,0x82,0x80,0x2f,0x30,
-0x30,0x27,0xe2,0x8e,0x22,0x92,0x47,0x32,0x8b,0x06,0xe0,0xaa,0x7d,0x60,0x0e,0x70,
-0x6e,0x00,0x30,0x00,0x0d,0x4c,0xf8,0x08,0xe0,0x06,0xe0,0x0e,0x40,0x00,0x2f,0x30,
-0x4b,0xf3,0x00,0x6f,0x55,0xf2,0x00,0x02,0xf3,0x1d,0x92,0x00,0x02,0xde,0xea,0x5b,
-0x07,0x05,0xbe,0x12,0x40,0xda,0x22,0x10,0x4e,0x56,0x88,0x00,0xfd,0x21,0xa1,0x01,
-0x44,0xda,0x44,0xc8,0x00,0x09,0xc0,0x0b,0x90,0x54,0xea,0x91,0x03,0xf6,0x13,0xf4,
-0x10,0x07,0xd0,0x00,0xe6,0x06,0x08,0xf0,0x07,0x05,0xe3,0x14,0x5f,0x30,0x1a,0xf5,
-0x0f,0x04,0xf5,0xc3,0x03,0xfe,0x90,0x00,0x0d,0x50,0xf0,0x3f,0x00,0xf3,0x6e,0x24,
-0x1f,0x60,0xef,0xee,0xf0,0x4f,0x16,0xe0,0x19,0x18,0x31,0xf5,0x8f,0x09,0xe8,0x04,
-0xe1,0xe5,0x0f,0x03,0xf1,0xf7,0x49,0xf4,0x42,0x00,0x0f,0x50,0xf1,0x4f,0x6d,0x38,
-0x4b,0x00,0x0f,0x09,0xa0,0x54,0x49,0xf4,0x44,0x00,0x2f,0x31,0xf2,0x5f,0x4f,0xc8,
-0x00,0x40,0x06,0xd0,0x0f,0x03,0xb2,0x0a,0x00,0x73,0x8b,0x21,0xf3,0x6f,0x5e,0x4b,
-0x52,0x1e,0x10,0x07,0xaf,0x90,0x21,0x15,0x0b,0x41,0x46,0x09,0x46,0xa5,0x01,0xb0,
-0x58,0x05,0x0a,0x27,0x13,0x22,0x01,0x00,0x10,0x20,0x3b,0x15,0x01,0xbd,0x1a,0x1c,
-0x2f,0x39,0x1e,0x13,0x03,0xb0,0x28,0x1c,0x02,0x43,0xb5,0x11,0x01,0xe1,0x17,0x14,
-0x41,0x4b,0x57,0x13,0x60,0xf4,0x6c,0x00,0x56,0xba,0x03,0xdf,0x1d,0x20,0x05,0xf5,
-0x5e,0x06,0x00,0x11,0x00,0x01,0x39,0x0e,0x17,0x60,0x43,0x96,0x23,0x4f,0x30,0x70,
-0x27,0x23,0x0b,0xb0,0x09,0x00,0x22,0x03,0x80,0x09,0x00,0x10,0xae,0xab,0x8d,0x00,
-0x09,0x00,0x00,0xe3,0x6c,0x00,0x12,0x00,0x00,0xc4,0x02,0x01,0x94,0x7e,0x00,0xc2,
-0x06,0x10,0xf4,0xcc,0x27,0x01,0xcb,0x00,0x00,0x40,0x5d,0x5a,0xd1,0x0d,0xee,0xee,
-0xe3,0x24,0x00,0x05,0x09,0x00,0x12,0x0b,0x3f,0x5f,0x01,0x5e,0x06,0x0f,0x09,0x00,
-0x06,0x05,0x24,0x00,0x01,0x10,0x6c,0x06,0x8c,0x92,0x09,0xc8,0x40,0x20,0x03,0xf5,
-0x35,0x0e,0x20,0xdd,0xd0,0x71,0x18,0x00,0x80,0x62,0x11,0xaf,0xa8,0x2a,0x11,0x70,
-0xc3,0x18,0x03,0x0b,0x04,0x10,0x5f,0x62,0x21,0x12,0x21,0xd6,0x18,0x12,0x2f,0x66,
-0x0f,0x12,0x5f,0x80,0x1a,0xd0,0xaa,0xaa,0xac,0xf0,0x00,0x7d,0xdd,0xdd,0xc0,0x7f,
-0x77,0x77,0xaf,0xa4,0x1c,0x60,0x43,0x07,0xe0,0x00,0x02,0x70,0x32,0x0f,0x23,0x00,
-0x7e,0x89,0x6a,0x12,0xf9,0x1b,0x04,0x50,0x4f,0x11,0x1b,0x90,0x7e,0xcb,0x3e,0x51,
-0x04,0xf0,0x00,0xb9,0x07,0xe8,0x24,0x50,0x4f,0x00,0x0b,0x90,0x7e,0x40,0x09,0x00,
-0x26,0x00,0xc0,0x06,0xf6,0x55,0x55,0xbd,0x00,0x4f,0x33,0x33,0x20,0x1c,0xff,0x7e,
-0x6c,0x00,0xad,0x81,0x02,0x7f,0x00,0x20,0x6f,0x20,0x83,0x02,0x11,0x60,0xa2,0x14,
-0x41,0x03,0xf2,0x11,0xe6,0xf5,0x4b,0x20,0xe1,0x4f,0x14,0x43,0x00,0x98,0x1a,0x41,
-0x08,0xe0,0x00,0xe6,0x1a,0x01,0xa0,0x11,0xe9,0x00,0x0e,0x71,0x10,0x03,0xee,0xee,
-0xe7,0x4c,0xbe,0x11,0xfb,0x51,0x0b,0x10,0x20,0xe4,0x2c,0xc1,0x02,0x88,0x88,0x83,
-0x65,0x55,0x55,0x56,0x40,0x00,0x29,0x99,0xc0,0xeb,0x11,0xfb,0xd1,0x00,0x00,0x8d,
-0x3f,0x10,0x40,0x5b,0x00,0x20,0x50,0x8e,0x85,0x4b,0x10,0x03,0x65,0x10,0x31,0xdb,
-0x09,0xe2,0x00,0x34,0x52,0x50,0x02,0xee,0xf4,0x00,0x13,0x00,0x31,0x3d,0xfe,0x50,
-0x47,0x43,0xe1,0x55,0xbf,0xb3,0x9f,0xd7,0x20,0x03,0xf3,0x33,0x38,0xfb,0x40,0x00,
-0x39,0xb1,0x41,0x0d,0xac,0x83,0x04,0x7d,0xb4,0x00,0xb8,0x47,0x10,0x8d,0x17,0x02,
-0xb2,0x00,0x00,0x2d,0x00,0x04,0x77,0x7a,0xf7,0x77,0x70,0x1f,0x20,0x6f,0x02,0xc8,
-0x17,0x12,0x20,0x4f,0x02,0x62,0x22,0x22,0x20,0x02,0x00,0x5f,0xb8,0x67,0x23,0x20,
-0xe6,0xff,0xc5,0x00,0xcf,0x7b,0x20,0x65,0x54,0xe4,0x3e,0xc3,0x20,0xe6,0x05,0xfe,
-0xdd,0xb0,0x01,0x55,0x55,0x51,0x0e,0x60,0x16,0x6d,0x01,0xd2,0x7b,0x00,0x7b,0x09,
-0x12,0xf3,0x13,0x00,0x42,0x3f,0x33,0x3f,0x30,0x13,0x00,0x24,0xf0,0x00,0x13,0x00,
-0x23,0x00,0x0f,0x13,0x00,0xdc,0xf6,0x56,0xf5,0x5f,0x95,0x8f,0x55,0x55,0x10,0x3f,
-0xdc,0xcc,0x7f,0xdd,0x86,0x14,0xc7,0x26,0x31,0x11,0x05,0xbd,0xb6,0x02,0x95,0x45,
-0xb0,0x05,0x88,0x89,0xf9,0x88,0x81,0x1e,0xee,0xee,0xed,0x8c,0x62,0x11,0x11,0x10,
-0x61,0x28,0x22,0xca,0x00,0xab,0x00,0x41,0x00,0x6f,0x10,0x03,0x5a,0x11,0x52,0x30,
-0x1e,0x70,0x09,0xe1,0x92,0x2b,0x20,0xf8,0x9a,0xf9,0x59,0x71,0xee,0xee,0x33,0xb9,
-0x8b,0xf8,0x01,0x26,0x00,0x00,0x3f,0x2e,0x10,0xf6,0x8f,0x01,0x00,0xd5,0x29,0x10,
-0xcd,0x01,0x02,0x30,0xf3,0x2c,0xf6,0x83,0x65,0x80,0x4e,0x00,0x0e,0x3b,0xb2,0x00,
-0x9f,0x50,0xbc,0xed,0x60,0xe3,0x00,0x01,0xbf,0xe2,0x00,0x13,0x00,0x50,0x30,0x05,
-0xed,0x4a,0xf4,0x26,0x00,0x30,0xf4,0x5d,0xf8,0xf1,0x40,0x53,0x4e,0x33,0x33,0xce,
-0x81,0x20,0x61,0x1d,0x01,0x64,0x01,0x11,0xb8,0x4c,0x15,0x20,0x6e,0x10,0x29,0x06,
-0x20,0x05,0xf2,0x70,0x0e,0x00,0x67,0x6d,0x20,0x0d,0x90,0xa8,0x28,0x80,0xee,0xee,
-0xea,0x36,0xbb,0x66,0xac,0x66,0x86,0x0a,0x12,0x38,0x00,0x0e,0x01,0x1e,0x06,0x12,
-0x9c,0x0f,0x12,0x13,0x10,0x9d,0x54,0x00,0xfc,0x25,0x30,0xbd,0x55,0x51,0xb5,0x00,
-0x10,0x10,0xea,0x0c,0x15,0x40,0x26,0x00,0x00,0xf5,0x40,0x02,0x26,0x00,0x00,0x8f,
-0x00,0x01,0x13,0x00,0x00,0xa2,0x00,0x11,0x4d,0x1a,0x04,0x40,0x04,0xe0,0x00,0xe4,
-0xab,0x49,0x6c,0x55,0x10,0x4e,0x00,0x0e,0x40,0x26,0x00,0x00,0xc3,0x62,0x1a,0x09,
-0xd6,0x3e,0x12,0xc3,0xcd,0x74,0x01,0xa1,0x18,0x13,0x6f,0xb5,0x14,0xf0,0x01,0x20,
-0x00,0x53,0x1b,0xa1,0x1b,0xa0,0x1e,0xee,0xee,0xe9,0x0d,0x30,0xe6,0x00,0xb9,0xab,
-0x00,0x60,0x25,0xd0,0x4f,0x20,0x0c,0x80,0x85,0x00,0x50,0xd5,0x0b,0xb0,0x00,0xe6,
-0xab,0x00,0x31,0x01,0x07,0xf3,0xcb,0x83,0x00,0x0c,0x81,0x30,0x06,0xad,0xe0,0xab,
-0x00,0x52,0x08,0xe4,0x00,0x25,0x51,0x60,0x01,0x01,0xae,0x6c,0x00,0x60,0x01,0x40,
-0x04,0x3f,0x50,0x12,0x85,0x00,0xf0,0x0a,0xf2,0x96,0xe4,0x6e,0x07,0xc0,0x00,0x4d,
-0x00,0x0f,0x2c,0x4e,0x40,0xc2,0x0e,0x50,0x04,0xd0,0x00,0xf4,0xf1,0xe4,0x00,0x03,
-0x7c,0x13,0x00,0x60,0x9c,0x0e,0x40,0x00,0xd5,0xf3,0x61,0x03,0x50,0x50,0xe8,0x33,
-0x4f,0x24,0xab,0x00,0x00,0x77,0x08,0x19,0xb0,0x3e,0x20,0x03,0x71,0x76,0x00,0xfa,
-0x17,0x13,0x0d,0x70,0x25,0xf0,0x01,0xa4,0x00,0x11,0x1c,0xa1,0x11,0x11,0x01,0xee,
-0xee,0xee,0xc0,0x22,0xf8,0x22,0x20,0x6b,0x03,0x21,0x43,0x5f,0x0a,0x05,0x00,0x7c,
-0x00,0x41,0x26,0xf3,0x22,0xe6,0xdc,0x01,0x23,0x00,0x8d,0x8c,0x82,0xa3,0x01,0x1c,
-0xa1,0x11,0xe7,0x10,0x04,0xee,0xee,0xe8,0x43,0x12,0x22,0x22,0x22,0x73,0x6e,0x00,
-0x6b,0x03,0x10,0x15,0x88,0x0b,0x00,0xdb,0x00,0x50,0x53,0xfe,0xdd,0xdd,0xef,0x02,
-0x02,0x20,0xe5,0x3f,0x4f,0x04,0x00,0x60,0x01,0x20,0x53,0xf0,0x17,0x03,0x33,0x04,
-0xf1,0x11,0x13,0x00,0x00,0x26,0x00,0x11,0xfd,0x26,0x00,0x00,0xe6,0x60,0x4b,0x66,
-0x66,0x69,0xe0,0x02,0x02,0x10,0x8a,0xfd,0x0b,0x00,0x02,0x02,0x10,0x03,0xc5,0x7b,
-0x01,0x02,0x02,0x41,0x0b,0xb0,0x05,0xf1,0x02,0x02,0x50,0x14,0x8a,0x44,0xdb,0x40,
-0x57,0x01,0x12,0x34,0xe9,0x05,0x00,0x37,0x28,0x00,0x14,0x75,0x00,0x56,0x00,0x10,
-0x14,0xf3,0xb9,0x02,0x9a,0x83,0x00,0xce,0x3a,0x00,0x57,0x01,0x52,0x14,0xf5,0x55,
-0x55,0x7f,0x26,0x00,0x02,0x94,0x3f,0x22,0x22,0x22,0x72,0x78,0x01,0xdb,0x00,0x40,
-0x9c,0x06,0xe0,0x00,0x44,0x01,0x30,0x30,0x0d,0x80,0x13,0x00,0x81,0xd0,0x00,0xf3,
-0x03,0xf3,0x06,0xe0,0x03,0x13,0x00,0x50,0xcb,0x00,0x6e,0x00,0xf3,0x02,0x02,0xd1,
-0xbe,0x10,0x06,0xf3,0x4f,0x10,0x4e,0x33,0x33,0xcc,0x20,0x00,0x2e,0x40,0x40,0x1d,
-0x01,0x40,0x61,0x12,0xd2,0x7d,0x8c,0x00,0xec,0x4f,0x40,0x01,0x44,0x44,0xf9,0xfa,
-0x0b,0x30,0x2a,0x00,0x3d,0xf9,0x1c,0x51,0x90,0x2e,0xee,0xee,0xe1,0x2a,0x31,0x00,
-0xb5,0x00,0x50,0x05,0x77,0x7f,0xa7,0x77,0x8a,0x12,0x30,0x10,0xae,0xee,0x18,0x00,
-0x36,0x7f,0xff,0xf8,0xaa,0x06,0x00,0x4f,0x04,0x60,0xda,0x00,0x6e,0xee,0xe8,0x3e,
-0xa0,0x21,0xa0,0xb0,0x01,0x33,0x33,0x23,0xe0,0x65,0x04,0x70,0x7b,0x16,0x2b,0x70,
-0x28,0x0b,0x80,0x7d,0x04,0x60,0x07,0xd8,0x01,0x30,0xc7,0x07,0xd0,0xf8,0x1c,0x50,
-0x8b,0x00,0x0f,0x50,0x7d,0x99,0x11,0x71,0x08,0xb0,0x05,0xf1,0x07,0xd0,0x03,0x13,
-0x00,0xf1,0x08,0xe9,0x00,0x7d,0x00,0xf1,0x07,0xff,0xff,0xb1,0xce,0x00,0x06,0xe4,
-0x6f,0x00,0x7d,0x33,0x32,0xcd,0x20,0x00,0x2d,0xff,0xec,0x79,0x0d,0x3a,0x92,0x10,
-0xe1,0xe0,0x03,0x22,0x10,0x00,0xb9,0x42,0x21,0x0d,0xf4,0x94,0xd5,0x60,0x00,0x00,
-0x0b,0xe9,0xe2,0x00,0x6a,0x01,0x50,0x90,0x09,0xe2,0x0c,0xe3,0xb5,0x00,0x60,0x42,
-0x0b,0xf3,0x00,0x0c,0xf6,0xb5,0x00,0xf7,0x00,0x5e,0xfe,0xbb,0xbb,0xcf,0xfd,0x10,
-0x6f,0xff,0xf9,0xc2,0x89,0x99,0x99,0x56,0xb1,0x0f,0x41,0x6e,0xee,0xe2,0x6f,0x15,
-0x02,0xf2,0x11,0x01,0x22,0x22,0x06,0xc2,0xa8,0x2d,0x52,0xf2,0x00,0x24,0x44,0x41,
-0x6b,0x09,0x70,0xd3,0x0f,0x20,0x08,0xff,0xff,0x46,0xc0,0x98,0x0d,0x41,0xf2,0x00,
-0x8a,0x00,0xd4,0x26,0x00,0x81,0x08,0xa0,0x0d,0x46,0xc1,0xa8,0x1d,0x52,0x13,0x00,
-0x06,0x26,0x00,0xf0,0x05,0xb0,0x97,0x0d,0x45,0xf2,0x00,0x8b,0x33,0x31,0x6b,0x07,
-0x60,0xb3,0xda,0x00,0x04,0x80,0x00,0x02,0x90,0x60,0x1b,0x20,0x01,0xe4,0xd3,0x39,
-0xf4,0x1b,0xe5,0x94,0x00,0x00,0x65,0x03,0xff,0xff,0xf8,0xd6,0x8c,0x00,0xde,0xee,
-0xe4,0x58,0x03,0xa0,0xd6,0x1f,0x30,0x44,0x44,0x41,0x4d,0x06,0xb0,0xc7,0x07,0x30,
-0x02,0x22,0x21,0x3f,0x2a,0x81,0xc8,0x11,0x10,0x5f,0xff,0xd8,0xa9,0x15,0x00,0xf5,
-0x02,0xf0,0x3d,0xaa,0x11,0x10,0x4e,0xee,0xc0,0xcf,0xff,0xf3,0x9b,0x0b,0x60,0x13,
-0x33,0x30,0xc6,0x00,0xe3,0x7c,0x2f,0x30,0x01,0x11,0x10,0xc7,0x11,0xf3,0x5e,0x8c,
-0x00,0x5f,0xff,0xe0,0xcf,0xee,0xf3,0x3f,0xe4,0x00,0x5b,0x03,0xe0,0xc6,0x00,0xe3,
-0x1f,0xb0,0x00,0x5b,0x02,0xe0,0xca,0x55,0xf3,0x5f,0x60,0x60,0x5b,0x02,0xe0,0xcc,
-0x99,0xf7,0xfd,0xb0,0xf0,0x5f,0xff,0xe0,0xc6,0x00,0x7e,0x44,0xfa,0xc0,0x5c,0x47,
-0x04,0x15,0xc3,0x03,0xaf,0x20,0x00,0x01,0x71,0x88,0x40,0x5b,0x00,0x02,0xc0,0x58,
-0x89,0x50,0xff,0xee,0xfe,0xe0,0xad,0x6d,0x1e,0xf0,0x14,0x2c,0x40,0x37,0x00,0x3f,
-0xcb,0xbf,0xda,0x00,0x0b,0xfd,0xdd,0xdd,0x5e,0xec,0x03,0xf3,0x00,0x0a,0xf7,0x66,
-0x41,0xf6,0x80,0xd9,0xd9,0x00,0x00,0x8c,0x74,0x8a,0x2f,0x00,0x06,0xff,0xa1,0xbc,
-0xe1,0xac,0xa7,0xe0,0x6d,0xe7,0xbf,0x94,0x00,0x09,0x41,0x1c,0xfb,0x6a,0x91,0x20,
-0x61,0x20,0x00,0x11,0xde,0x0c,0x11,0x12,0xe9,0x3f,0x03,0xef,0x91,0x02,0xde,0x08,
-0x00,0x21,0x11,0x01,0x4a,0x9d,0x00,0x5c,0x0e,0x10,0x99,0x01,0x00,0x13,0x92,0x58,
-0x6c,0x01,0x8a,0x31,0x11,0x07,0xf4,0x12,0x0a,0x87,0x0b,0x05,0x13,0x00,0x22,0x00,
-0x02,0xeb,0x34,0x30,0x0d,0xee,0xef,0x19,0x5c,0x14,0xea,0x12,0x00,0x50,0x9a,0x00,
-0x01,0xee,0xee,0xbe,0x50,0x40,0xfa,0x00,0x03,0xf1,0x45,0x82,0x01,0x82,0x6b,0x11,
-0xef,0xc2,0x86,0xf3,0x06,0xc0,0x00,0x03,0xce,0x20,0x00,0xf5,0x01,0x3b,0xa0,0x48,
-0xdf,0xfc,0xaa,0xaa,0xfc,0xac,0xf9,0x20,0x7d,0xcf,0x3f,0x13,0x00,0xcb,0x2c,0x11,
-0x22,0x41,0x60,0x10,0x6f,0x9f,0x21,0x10,0xbd,0x12,0x00,0x10,0x11,0xb0,0x02,0x00,
-0x12,0x00,0x01,0x29,0x43,0x00,0x12,0x00,0x04,0xb3,0x24,0x20,0x6d,0xde,0x1b,0x23,
-0x10,0xc0,0xfe,0x0d,0x90,0x70,0x00,0x5e,0xd8,0x30,0x00,0x6b,0xfe,0x92,0x67,0x02,
-0x42,0xfd,0x60,0x28,0x30,0x8e,0x0a,0x07,0xab,0x09,0x01,0xfc,0x08,0x10,0x0e,0xb8,
-0xdd,0x01,0xa0,0x13,0x01,0x39,0xd5,0x00,0x12,0x0a,0x01,0x13,0x00,0x01,0xc1,0x60,
-0x01,0x13,0x00,0x00,0x62,0x00,0x10,0x0e,0xde,0x88,0x87,0xf4,0x44,0x9e,0x00,0x00,
-0xea,0x44,0x44,0x26,0x00,0x33,0xf3,0x33,0x8e,0x26,0x00,0x26,0xee,0xef,0x39,0x00,
-0x11,0x0e,0xfd,0x18,0x00,0x26,0x00,0x10,0xe9,0x83,0x56,0x50,0x04,0xf3,0x33,0x9e,
-0x0e,0x9e,0x2b,0x00,0x21,0x04,0x21,0xd0,0xe6,0xb0,0x2b,0x32,0x4a,0x02,0x90,0x13,
-0x00,0x41,0x0c,0xa0,0x0d,0x90,0x13,0x00,0x90,0x08,0xf2,0x00,0x3f,0x3e,0xfe,0xee,
-0xef,0xf4,0x42,0x7c,0x6e,0x30,0xe9,0x55,0x55,0x6e,0x30,0x0b,0x08,0x07,0x63,0x5f,
-0x41,0x46,0x66,0x66,0xfb,0xc8,0x8c,0x15,0x9f,0x18,0x40,0x07,0x7e,0x5f,0x01,0x09,
-0x00,0x00,0x2b,0x73,0x10,0xfb,0x9e,0x12,0x17,0x5f,0xa3,0x5f,0x32,0xf6,0x00,0x9e,
-0x34,0x37,0x30,0xf6,0x00,0x9e,0xb4,0x28,0xf0,0x0c,0xbd,0x01,0xf5,0x00,0x9e,0x04,
-0xf5,0x00,0x05,0xf4,0x04,0xf3,0x00,0x9e,0x00,0x9e,0x10,0x3f,0x80,0x09,0xe0,0x00,
-0x9e,0x00,0x0e,0xa0,0x9a,0x3f,0x47,0x10,0x9e,0x0b,0x71,0x21,0x01,0xdd,0x3f,0x82,
-0x73,0x10,0x00,0x4e,0xe3,0x01,0x66,0xcd,0xe7,0xd2,0x22,0xef,0xd6,0xc2,0xb2,0x07,
-0x8f,0x17,0x00,0x2e,0x2b,0x01,0xf1,0x14,0x11,0xf0,0x6b,0x5a,0x10,0x24,0x85,0x0b,
-0x04,0x07,0x62,0x02,0x30,0x15,0x00,0xac,0x67,0x11,0x20,0xfb,0x2c,0x00,0x66,0x13,
-0x11,0xaf,0x93,0x00,0x00,0xc4,0x93,0x10,0xc4,0x0d,0x24,0x31,0x71,0x0f,0x40,0x56,
-0x1e,0x00,0x98,0x28,0xc0,0x33,0x1b,0xa0,0x00,0x02,0x30,0x03,0xf2,0x0f,0xff,0xf5,
-0xba,0x47,0x12,0x30,0x4f,0x40,0xf4,0xb3,0x4e,0xf2,0x08,0x09,0xb0,0x05,0xfb,0x0f,
-0x40,0x00,0x7f,0xfe,0xef,0xf6,0x00,0x6e,0xf6,0xf4,0x00,0x00,0x35,0x55,0x53,0x00,
-0x09,0xa7,0x02,0xa3,0x00,0xb3,0x1b,0xb1,0xfe,0xa7,0x66,0x55,0x55,0x55,0x61,0x4f,
-0x20,0x02,0x8c,0xdd,0x15,0x08,0xcc,0x60,0x15,0x7a,0xa0,0x06,0x11,0xb0,0x0c,0x1a,
-0xf1,0x02,0x90,0x03,0x66,0xbd,0x66,0x43,0x46,0xf7,0x44,0xe8,0x00,0x8d,0xdf,0xfd,
-0xda,0x00,0x5f,0xc2,0x01,0x11,0x8b,0x66,0x0b,0x10,0xf6,0x73,0x09,0x00,0x9a,0xb2,
-0x21,0x3f,0x30,0x9c,0x4a,0xa1,0xf7,0x08,0xff,0xc0,0x00,0x33,0x37,0xf3,0x33,0xa5,
-0x7f,0x26,0x21,0x50,0x4f,0xbc,0x23,0xf1,0x01,0xc2,0x00,0x2f,0x24,0xf0,0x00,0x0f,
-0x85,0x55,0x7f,0x20,0x03,0xf1,0x4f,0xff,0xe0,0x1f,0x0b,0x60,0x4f,0x24,0xf2,0x22,
-0x0f,0x40,0x2c,0x0e,0xc1,0xf8,0x4f,0x00,0x00,0xf5,0x22,0x25,0xf2,0x00,0x6f,0xf7,
-0xf0,0xf2,0x00,0x34,0x20,0x09,0xa9,0x7b,0x6d,0x41,0xd7,0x0a,0xfd,0x97,0xab,0x00,
-0x51,0x3f,0x10,0x03,0x8c,0xef,0x72,0x11,0x18,0x40,0xb2,0x1a,0x05,0x7a,0x6f,0x01,
-0xa5,0x16,0x70,0xc0,0x04,0xe1,0x11,0x4f,0x1e,0xb6,0xef,0x59,0x31,0x4e,0x00,0x03,
-0xbf,0x16,0x00,0xf5,0x06,0x22,0x3f,0x1e,0x17,0x26,0x40,0x55,0x57,0xf1,0xea,0x1c,
-0x00,0x51,0x04,0xee,0xff,0xee,0x1e,0xe9,0x01,0x00,0xa3,0x02,0x10,0xe7,0x1a,0x03,
-0x60,0x01,0x40,0x6e,0x00,0x0e,0x70,0x0f,0x00,0x41,0x4e,0x06,0xf8,0x83,0x13,0x00,
-0x80,0x04,0xe0,0x6f,0xaa,0x4e,0xa5,0x55,0x59,0x13,0x00,0x30,0xe0,0x00,0xef,0x7b,
-0x00,0x32,0x04,0xe0,0x6e,0xd7,0x15,0x00,0x13,0x00,0x12,0x53,0x5f,0x00,0x51,0xe3,
-0xaf,0xff,0x5e,0x70,0x31,0x4c,0xb1,0xfd,0x84,0x00,0xeb,0x77,0x77,0x77,0x71,0x0a,
-0x61,0x00,0xf6,0xde,0x00,0xff,0x6d,0x00,0xed,0xa9,0x01,0x34,0x6d,0x12,0xa9,0x02,
-0x4e,0x10,0x0f,0xe7,0x07,0x00,0x09,0x00,0x40,0x04,0x44,0xcb,0x44,0xce,0x40,0x00,
-0x73,0x53,0x60,0x11,0x08,0xee,0xef,0xee,0xe5,0xde,0x0f,0xf2,0x03,0x79,0xd7,0x9f,
-0x87,0xe6,0x07,0x90,0x97,0x0a,0x79,0xa0,0x2f,0x00,0xd6,0x07,0xa3,0xa9,0x3b,0x09,
-0x00,0x32,0xec,0xee,0xce,0x09,0x00,0x00,0x1b,0x00,0xf0,0x03,0xd8,0xaf,0x98,0xf6,
-0x07,0xfe,0xff,0xef,0x79,0xd8,0x9f,0x88,0xe6,0x01,0x22,0xba,0x22,0x19,0x1b,0x00,
-0x00,0x51,0x00,0x10,0x49,0x09,0x00,0x10,0x2f,0x89,0x01,0x00,0x09,0x00,0x00,0x12,
-0x1b,0x12,0x09,0x09,0x00,0x11,0xa9,0xf4,0x10,0x10,0xf6,0x09,0x00,0x51,0x08,0xb5,
-0x55,0x55,0xc5,0x28,0x09,0x02,0x69,0x22,0x13,0x0f,0xf7,0x72,0x00,0xc0,0x01,0xa2,
-0x64,0x44,0x6c,0x54,0x44,0x00,0x34,0x4f,0x74,0x48,0x08,0x03,0x80,0x11,0xf6,0x11,
-0x01,0x23,0x11,0x24,0x11,0xda,0x17,0xc0,0xf0,0x08,0xe0,0x06,0xf2,0x00,0x08,0x90,
-0xd3,0x3f,0x02,0xf6,0x30,0x5e,0x50,0x8a,0x2e,0x55,0xf0,0xcc,0x44,0x4c,0xf3,0x16,
-0x08,0xfe,0xfe,0xef,0x7f,0x66,0x00,0x48,0x7f,0x10,0x89,0x0d,0x33,0xf0,0x45,0xf1,
-0x0b,0xa0,0x20,0x08,0xb4,0xe7,0x7f,0x00,0x0e,0x81,0xf5,0x00,0x00,0x6c,0xcf,0xdc,
-0xb0,0x00,0x6f,0xad,0x00,0xbd,0x53,0x41,0xdf,0x40,0x00,0x01,0x11,0x0b,0x20,0x4f,
-0xfb,0x05,0x0e,0x71,0xf7,0x33,0x10,0x6f,0x94,0xfc,0x10,0xc7,0x4b,0x50,0xcf,0x70,
-0x02,0xdf,0x81,0x26,0x00,0x67,0xba,0x20,0x00,0x00,0x6c,0x10,0x81,0x04,0x22,0xb0,
-0x00,0xa3,0x24,0x41,0x51,0x3f,0x02,0x5b,0x27,0x09,0xf1,0x09,0x0c,0x53,0xf0,0x8a,
-0xb8,0x00,0x25,0x00,0x6c,0x00,0x89,0x3f,0x0c,0x58,0x60,0x05,0xe0,0x05,0x90,0x04,
-0xc3,0xf1,0xf0,0x5f,0x5a,0x00,0xf0,0x04,0x1e,0x3f,0x6a,0x01,0x33,0x38,0xf3,0x33,
-0x10,0x05,0x57,0xf5,0x55,0x06,0x66,0xaf,0x66,0x61,0x01,0xdd,0x0e,0xf4,0x0b,0xf9,
-0x8b,0xf8,0x8f,0x40,0x00,0x99,0x0f,0x30,0x0f,0x20,0x5e,0x00,0xe4,0x00,0x09,0x90,
-0xf3,0x00,0xff,0xef,0xfe,0xef,0x40,0x00,0xa8,0x13,0x00,0x51,0x0c,0x70,0xf3,0x00,
-0xfe,0x13,0x00,0x32,0xe5,0x0f,0x33,0x2e,0x05,0x40,0x1f,0x22,0xfc,0xf4,0x8c,0x03,
-0x52,0x40,0x05,0xd0,0x8f,0x92,0xb9,0x16,0x30,0xd8,0x01,0x20,0x22,0x34,0x33,0x00,
-0x00,0x1b,0x72,0x47,0x02,0x1f,0x21,0x14,0x01,0xf1,0xd1,0x24,0x01,0xf7,0xec,0xaf,
-0x03,0x76,0xbf,0x03,0x2b,0xf9,0x02,0x4e,0x4c,0x05,0xfc,0x90,0x24,0x06,0xfe,0xdf,
-0x00,0x10,0xad,0x5d,0x11,0x00,0x19,0x2c,0x20,0x0e,0x88,0x87,0xc2,0x00,0x12,0x31,
-0x12,0xf3,0x44,0x7e,0x00,0xea,0x6d,0x12,0xca,0xff,0x0d,0x21,0x8f,0x30,0x71,0x5e,
-0x10,0x5f,0x7a,0xaa,0x20,0x0c,0xe2,0x13,0x00,0x00,0x3a,0xd8,0x51,0x2e,0xf6,0x00,
-0x00,0x7f,0x19,0x55,0x64,0x2c,0xa0,0x00,0x8f,0xed,0x30,0x63,0xaa,0xf5,0x00,0x7f,
-0xd8,0x65,0x45,0x56,0x67,0x91,0x0c,0x40,0x00,0x17,0xce,0xff,0xfe,0xed,0x30,0x6e,
-0x0d,0x13,0x6d,0x14,0xe8,0x5f,0x6c,0x02,0xa5,0x2c,0x14,0xf6,0xff,0x32,0x20,0x08,
-0xf1,0xb2,0x67,0x20,0x5f,0x30,0x8e,0x14,0x13,0x6e,0x83,0x44,0x03,0x4b,0x33,0x32,
-0x00,0x44,0x44,0x26,0x00,0x00,0xab,0x00,0x04,0x19,0x10,0x12,0x6f,0x80,0x06,0x00,
-0x98,0x00,0x04,0xfc,0xa8,0x11,0x5f,0x41,0x01,0x11,0x7e,0x13,0x00,0x00,0xa4,0xef,
-0x0b,0x13,0x00,0x02,0x26,0x00,0x41,0x03,0xcf,0x70,0x13,0x2f,0x07,0xe1,0x06,0xfb,
-0x7e,0xe9,0x53,0x32,0x33,0x44,0x67,0x20,0xba,0x00,0x06,0xbf,0xee,0xd4,0x12,0x01,
-0xe2,0x03,0x03,0xd1,0xaa,0x10,0x85,0xb2,0x9a,0x00,0x81,0xb4,0x11,0x08,0x3d,0x1a,
-0x00,0x77,0x60,0x41,0x0e,0x80,0x02,0xf5,0x84,0x60,0x40,0x55,0xa8,0x55,0xbe,0x4a,
-0x57,0x24,0x30,0x1f,0x1f,0x13,0x03,0x99,0x3f,0x33,0x06,0x77,0x70,0x2a,0x1d,0x80,
-0xac,0xee,0x03,0x55,0x55,0xcc,0x55,0x55,0xfa,0x9b,0x13,0xbf,0xe9,0x27,0x10,0x7e,
-0xc3,0x8f,0x04,0xf7,0x3b,0x32,0x8f,0xbe,0x20,0x9c,0x00,0x41,0x4f,0x70,0xbe,0x30,
-0x13,0x00,0x21,0x6f,0xa0,0xad,0xab,0x20,0x8e,0x03,0xa8,0x50,0x71,0xbf,0x20,0x00,
-0xaf,0xfb,0x39,0x20,0x2a,0xe1,0x40,0xbf,0x42,0xcf,0xc7,0x60,0x01,0x51,0x84,0x0d,
-0x50,0x00,0x4a,0x93,0x04,0x21,0x30,0x10,0xc8,0x21,0x03,0x9e,0x2e,0x02,0x1d,0x08,
-0x32,0x6d,0x20,0x00,0x31,0x02,0x90,0x01,0xce,0x20,0x00,0x05,0x20,0x02,0xbe,0x30,
-0x8e,0xba,0x31,0x01,0x9f,0xc9,0xee,0xb4,0x61,0xa2,0x02,0x22,0x39,0xfe,0x62,0x7f,
-0x13,0x04,0xf9,0x75,0x00,0x1d,0x28,0xf0,0x02,0xe0,0x00,0xf5,0x01,0xaa,0xa9,0x00,
-0xf6,0x22,0x7e,0x22,0x2f,0x50,0x1b,0xbd,0xe0,0x0f,0xa6,0x38,0x10,0xf5,0x98,0x00,
-0x30,0xf4,0x00,0x5e,0x4a,0x13,0x17,0x07,0x13,0x00,0x51,0xf7,0x33,0x8f,0x33,0x3f,
-0x13,0x00,0x01,0x39,0x00,0x03,0x26,0x00,0xf0,0x0c,0x04,0x4f,0x50,0x00,0x4d,0xf7,
-0x1d,0x30,0x04,0xb0,0xcd,0xa1,0x00,0x7f,0x41,0x9e,0x95,0x32,0x22,0x33,0x45,0x72,
-0x0d,0x50,0x00,0x28,0xdf,0xab,0x00,0x25,0x10,0x10,0xc5,0xb6,0x02,0x9d,0x6b,0x01,
-0x8e,0x6a,0x04,0xb7,0x1a,0x20,0xce,0x20,0x8a,0x92,0x00,0xba,0x6e,0x50,0xcd,0x14,
-0x44,0x44,0xf9,0x39,0x09,0x61,0x01,0xa1,0x01,0x11,0x1e,0x81,0x31,0x00,0x03,0x3f,
-0x23,0x80,0x02,0x22,0x20,0x2f,0x10,0x0e,0x70,0x05,0x89,0x58,0x20,0x12,0xf1,0x2e,
-0x4a,0xa0,0x00,0x02,0x26,0xf1,0x2f,0xa9,0x9f,0xc9,0x9b,0xf0,0x70,0x10,0x51,0x88,
-0x8e,0xff,0xa8,0x88,0x9f,0x19,0x41,0x06,0xff,0xee,0x40,0x9f,0x19,0x50,0x05,0xf4,
-0xe7,0x7f,0x80,0x13,0x00,0x50,0x08,0xf6,0x0e,0x70,0x3e,0xe6,0xa0,0xc2,0x1d,0xe4,
-0x00,0xe7,0x00,0x2d,0x40,0x00,0x3c,0xfa,0x41,0x00,0x7c,0x67,0xc2,0x93,0xaf,0xa6,
-0x43,0x33,0x34,0x45,0x61,0x0d,0x80,0x00,0x39,0x92,0x9c,0x08,0xab,0x00,0x03,0xd4,
-0x0c,0x32,0x08,0x10,0x02,0xe7,0x14,0x43,0x03,0xde,0x40,0x2f,0xb7,0x00,0x33,0xaf,
-0x52,0xf5,0x0d,0x15,0x71,0x83,0x2f,0xed,0xed,0xdd,0xee,0xd6,0x48,0x2e,0x40,0x2e,
-0x10,0x06,0xe0,0xab,0x00,0xb2,0x3f,0x31,0xc9,0x12,0xe7,0x10,0x00,0xdf,0xfe,0x04,
-0xf9,0xa1,0xda,0x33,0x28,0xe0,0x5f,0xbe,0x8f,0x21,0x7e,0x06,0x3c,0x3f,0x00,0xee,
-0x01,0x40,0x9c,0x01,0x11,0xe7,0x6a,0x00,0xc1,0x7e,0x0c,0x83,0x33,0x3e,0x83,0x33,
-0x30,0x00,0x07,0xe2,0xf4,0x2d,0x17,0x43,0x00,0x00,0x7e,0x8d,0x67,0x1b,0x33,0x3c,
-0xf9,0x30,0xe4,0x8f,0xc2,0x95,0xcf,0xa6,0x43,0x35,0x44,0x56,0x61,0x0c,0x90,0x00,
-0x49,0x94,0x06,0x06,0xab,0x00,0x32,0x62,0x00,0x00,0x0b,0x03,0x21,0x0b,0xe3,0x1d,
-0x19,0x11,0xe0,0x0a,0x00,0x12,0xd9,0x0c,0x1d,0x53,0x0b,0x60,0x0d,0xec,0xc7,0x35,
-0x2e,0x43,0xda,0x26,0x90,0x8e,0xf0,0xa6,0xf1,0x02,0x49,0x08,0xe0,0x00,0x04,0x44,
-0x40,0x02,0xda,0x26,0xb2,0xae,0x21,0x00,0xef,0xfe,0x04,0xf4,0xab,0x00,0xdb,0x01,
-0x13,0x4e,0xd0,0x45,0x71,0x7e,0x04,0xe0,0x3f,0xff,0xf3,0x0e,0x13,0x00,0x42,0x03,
-0xd0,0x0d,0x30,0x13,0x00,0x33,0x3d,0x00,0xd3,0x13,0x00,0x20,0xfe,0xef,0x13,0x00,
-0xc0,0x8e,0x04,0xe0,0x29,0x11,0x13,0x2f,0x50,0x00,0xaf,0xf8,0x5e,0xfe,0x0a,0xf1,
-0x00,0xc1,0x00,0xbf,0x55,0xef,0xa6,0x54,0x44,0x55,0x66,0x74,0x1e,0x50,0x00,0x6b,
-0xb1,0x18,0x15,0x40,0xac,0x02,0x10,0x01,0xbe,0x06,0x12,0xb1,0xfb,0x87,0x30,0x22,
-0x24,0xfb,0x12,0x63,0x22,0xf6,0x0f,0x26,0x09,0x00,0x00,0xb1,0x40,0xc0,0x00,0x0d,
-0x60,0xf7,0xb8,0x64,0x24,0xf4,0x22,0x7f,0x32,0x10,0x00,0x4f,0x11,0x60,0x8f,0x04,
-0xf0,0x04,0xa9,0x00,0x0e,0x60,0x79,0x98,0x05,0xf7,0xee,0xff,0xee,0x6e,0x60,0x9b,
-0xde,0x05,0xf0,0x00,0xaa,0x24,0x01,0x62,0x6e,0x05,0xf0,0x8b,0xee,0xb8,0x09,0x00,
-0x32,0xb6,0x22,0x6c,0x09,0x00,0x32,0xb8,0x44,0x7c,0x09,0x00,0xf1,0x03,0xbb,0x99,
-0x97,0x0e,0x60,0x00,0x9f,0x15,0xf0,0x41,0x00,0x08,0xdf,0x40,0x09,0xec,0xe4,0x30,
-0x4e,0xdd,0x30,0x7f,0x30,0x7f,0xf9,0x01,0x60,0x56,0x73,0x97,0x00,0x02,0x9d,0xa2,
-0x00,0x0d,0xb1,0x17,0x00,0x53,0x94,0x00,0x5f,0x08,0x10,0x0d,0x5a,0x22,0xf0,0x00,
-0xbf,0x30,0xe3,0x00,0xe0,0xd4,0x00,0xe4,0x00,0x00,0xce,0x2e,0xfe,0xef,0x0d,0xaf,
-0x05,0x61,0x01,0x80,0xe4,0x00,0x30,0xd5,0xd4,0x61,0x70,0x0e,0x84,0x4b,0x7d,0x94,
-0x47,0xd0,0x0c,0x2a,0xa1,0xbe,0xa1,0x5e,0xdb,0xa4,0x00,0x8b,0xba,0x00,0x00,0x30,
-0x60,0x43,0x07,0x8c,0xe0,0xbf,0x02,0x0a,0x72,0x7e,0x01,0x22,0xf5,0x22,0xe8,0x22,
-0xfe,0xa1,0x12,0x30,0xd8,0xa1,0x13,0x6f,0x71,0x1b,0x80,0x07,0xe0,0x11,0x3c,0x61,
-0x4d,0x62,0x11,0x4e,0x03,0x50,0x6e,0xa0,0x00,0x5e,0xc2,0x5c,0xc6,0x20,0xbd,0x50,
-0x8d,0x2e,0x90,0x00,0x5f,0xc5,0xaf,0xb6,0x43,0x23,0x33,0x46,0xc4,0x5e,0x23,0x38,
-0xdf,0x5c,0x70,0x05,0xa3,0x02,0x17,0x10,0x31,0x8b,0x11,0x01,0xb8,0x04,0x11,0xbb,
-0x7c,0x3e,0xf0,0x0d,0xc0,0x5d,0xdd,0xef,0xdd,0xd6,0x1f,0x53,0x3e,0x90,0x26,0xa6,
-0x66,0x6b,0x83,0x1f,0x20,0x3f,0x30,0x01,0xf5,0x00,0x0f,0x60,0x1f,0x20,0x8d,0x00,
-0x82,0x5e,0x40,0x10,0x1f,0x20,0xe7,0x1c,0x05,0xf1,0x00,0xba,0x00,0x1f,0x24,0xf1,
-0x00,0x55,0x6c,0x65,0xf9,0x55,0x1f,0x29,0xc0,0x00,0x0d,0x60,0x33,0x1f,0x22,0xe7,
-0xee,0x6f,0x40,0x20,0x4f,0x20,0x04,0xcd,0x0f,0x50,0x1f,0x20,0x0d,0x80,0x0d,0xca,
-0x9c,0xd2,0x1f,0x20,0x09,0xb0,0x0d,0x70,0x00,0x05,0xf0,0x1f,0x20,0x0a,0xa0,0x09,
-0x00,0x32,0x48,0x9f,0x60,0x09,0x00,0x21,0x3a,0xa6,0x7b,0x02,0x10,0xf0,0x32,0x8d,
-0x79,0x0d,0xa4,0x44,0x48,0xd0,0x1f,0x20,0x09,0x73,0x02,0x57,0x23,0x00,0xa4,0x24,
-0x01,0x9f,0x4f,0x00,0xaf,0xfb,0x10,0xd5,0x55,0x15,0x10,0xe8,0xaf,0x1e,0x10,0x55,
-0xc8,0x85,0x00,0x13,0x00,0x01,0xfb,0x2d,0x42,0xf8,0x00,0x00,0x11,0x24,0x68,0x26,
-0x11,0x10,0xeb,0x3c,0x05,0x91,0x99,0x24,0x00,0x0e,0x31,0x1f,0x00,0x8d,0x2f,0x03,
-0x31,0x1f,0x10,0xed,0x78,0x2f,0x09,0x13,0x00,0x21,0x0c,0xdd,0x70,0x2f,0x17,0x10,
-0x11,0x3d,0x12,0x7e,0xc0,0x5f,0x11,0x70,0xf5,0x5e,0x10,0xf3,0x4c,0x00,0x17,0x0f,
-0x4a,0x3d,0x14,0xc3,0x7a,0x26,0x32,0x8f,0x70,0x02,0x69,0x01,0x10,0x3f,0x14,0xdf,
-0x00,0x88,0x21,0xe0,0x3f,0x80,0x2d,0xd1,0x12,0x22,0x22,0x7d,0x00,0x2f,0xd1,0x11,
-0x3a,0x0c,0xb5,0x01,0x00,0x74,0x32,0x03,0x46,0x1d,0xd0,0x23,0xf2,0x20,0x66,0x66,
-0x66,0x6a,0xe6,0x10,0x00,0x1f,0x00,0x0b,0x72,0x1a,0xf0,0x1f,0xc1,0x0e,0xff,0xff,
-0xf9,0x03,0x00,0xe5,0x00,0x12,0x00,0x44,0x5f,0x54,0x26,0xf3,0x0e,0x50,0x1d,0xc0,
-0x04,0x51,0xf0,0x94,0x07,0xe2,0xe9,0x4e,0x90,0x00,0x5a,0x1f,0x0e,0x10,0x06,0x5f,
-0xff,0x50,0x00,0x01,0xe1,0xf3,0xc0,0x00,0x9f,0xf9,0x6b,0xb4,0xf3,0x0e,0x1f,0x35,
-0x14,0xec,0x2e,0x54,0xfa,0x10,0x00,0x26,0xfc,0xfd,0xf9,0x00,0xe5,0x03,0xcf,0x40,
-0xff,0xda,0x62,0x03,0x02,0x3f,0x50,0x00,0x50,0x04,0x10,0x7f,0x76,0x04,0x75,0x50,
-0x14,0x20,0x4c,0x1a,0x17,0xf1,0x23,0x70,0x22,0x09,0xd3,0x5e,0xa0,0x03,0x1b,0x00,
-0x18,0x70,0x1b,0x00,0x01,0x54,0x01,0x00,0x68,0x35,0x01,0x9f,0x50,0x16,0x20,0x1b,
-0x00,0x05,0x06,0x77,0x90,0x44,0x4e,0xb4,0x47,0xf8,0x44,0x44,0x87,0x40,0x9b,0x1c,
-0x10,0xbd,0x49,0x78,0x00,0x09,0x00,0x41,0x2f,0xa4,0xdd,0x30,0x09,0x00,0x02,0x47,
-0x9b,0x70,0x0e,0x80,0x14,0x87,0x3e,0xe7,0x00,0x04,0x17,0x90,0xff,0xb5,0x01,0x9f,
-0xea,0x50,0x00,0x8f,0xb7,0x4e,0x03,0x47,0x8d,0xe1,0x00,0x01,0x28,0x3b,0x00,0x5c,
-0x01,0x10,0x03,0x22,0x01,0x12,0x7f,0xa5,0x95,0xf0,0x0f,0x7d,0x07,0xd0,0x00,0x0f,
-0x53,0xf5,0x33,0x39,0xd0,0x7e,0x33,0x34,0xf5,0x3f,0xcc,0xcc,0xed,0x07,0xfc,0xcc,
-0xcf,0x53,0xf2,0x00,0x07,0xd0,0x7d,0x00,0x00,0x94,0x95,0xf1,0x01,0xfd,0x07,0xfe,
-0xee,0xef,0x53,0xf4,0x22,0x22,0x10,0x12,0x22,0x23,0xf5,0x3f,0x20,0x05,0x32,0x90,
-0x0f,0x53,0xf2,0x0c,0xdf,0xed,0xdf,0xdd,0x50,0x44,0x00,0xf1,0x01,0xe4,0x00,0xf3,
-0x00,0x0f,0x53,0xf2,0x13,0x3f,0x73,0x4f,0x63,0x30,0xf5,0x3f,0x25,0x2f,0x1b,0xe2,
-0x0f,0x53,0xf2,0x00,0x2f,0x20,0x0f,0x30,0x00,0xf5,0x3f,0x20,0x08,0xd0,0x22,0x00,
-0xf5,0x00,0x05,0xf4,0x00,0x0f,0x33,0x78,0xf4,0x3f,0x20,0xb5,0x00,0x00,0xf3,0x4e,
-0xea,0x0a,0x84,0x13,0x03,0x0a,0x84,0x00,0x4d,0x00,0x00,0x0a,0x84,0xf3,0x04,0x1f,
-0x53,0xf5,0x22,0x2c,0x80,0xe8,0x22,0x24,0xf5,0x3f,0xed,0xdd,0xf8,0x0e,0xed,0xdd,
-0xdf,0x53,0x0a,0x84,0x23,0xf5,0x3f,0x1b,0x84,0x60,0x53,0xf5,0x22,0x22,0x10,0x22,
-0x22,0x00,0x00,0xdf,0x12,0x11,0x21,0x14,0x96,0x01,0xf9,0x01,0x20,0xf5,0x3f,0x75,
-0x00,0x11,0x8d,0x11,0x00,0x32,0xf4,0x11,0x19,0x11,0x00,0x00,0x2f,0x02,0x00,0x11,
-0x00,0x32,0xf3,0x00,0x08,0x11,0x00,0x32,0x63,0x33,0xad,0x33,0x00,0x70,0xee,0xee,
-0xe7,0x68,0xf4,0x3f,0x20,0x05,0x5b,0x37,0xef,0xea,0x00,0xa4,0x84,0x12,0x20,0xd4,
-0x18,0x32,0x5f,0xff,0xfd,0x00,0x87,0xa0,0x5e,0x22,0xd8,0x00,0x04,0xf7,0xda,0x00,
-0x00,0x5e,0xa9,0x0c,0x60,0x70,0x1d,0xb1,0x00,0x5e,0x09,0x1e,0xb2,0xf0,0x01,0x02,
-0xde,0x50,0x5e,0x0f,0x41,0xde,0x61,0x11,0x11,0x2b,0xf4,0x5e,0x3f,0x30,0x62,0x54,
-0x0b,0x51,0x40,0x5e,0x07,0xe0,0x00,0x3b,0x78,0x32,0x5e,0x00,0xd6,0xd9,0x6e,0xd2,
-0x5e,0x00,0x9a,0x45,0x55,0x5e,0xa5,0x55,0x50,0x5e,0x00,0x7c,0xcf,0xdc,0x90,0xf0,
-0x01,0x24,0xda,0x00,0x10,0x0d,0x80,0x20,0x00,0x5e,0x8f,0xc2,0x05,0xf2,0x0d,0x82,
-0xf6,0x39,0x0a,0x10,0x1e,0x52,0x6f,0x20,0x40,0x5e,0xce,0x1a,0xe0,0x0d,0x80,0x08,
-0xe1,0x5e,0x00,0x02,0xb1,0x13,0x4e,0x70,0x00,0x81,0x5e,0xd6,0x08,0x1e,0xfd,0x67,
-0x37,0x04,0x87,0x8c,0x12,0xc6,0x0a,0x00,0x14,0xdc,0x7f,0x34,0x14,0x7f,0xaf,0x38,
-0x50,0x4f,0xc2,0x22,0x2b,0xb2,0x96,0x02,0x50,0x4f,0xfc,0x33,0x33,0xcb,0x7a,0x19,
-0x60,0x1f,0xbb,0xec,0xcc,0xce,0xec,0xb7,0x55,0x24,0x40,0xab,0xbe,0x48,0x05,0x40,
-0xca,0x00,0x4d,0x52,0x17,0xaa,0x13,0x00,0x00,0x20,0x0c,0x30,0x57,0x22,0x26,0x4e,
-0x07,0x01,0x92,0x89,0x20,0x6f,0x53,0x9b,0x09,0x08,0xa0,0x79,0x41,0x7f,0xbf,0xbe,
-0x70,0x6a,0x73,0xf2,0x03,0xec,0x33,0xf2,0x3c,0xe8,0x20,0x00,0x17,0xcf,0xb5,0x00,
-0x3f,0x20,0x04,0xaf,0xd8,0x10,0x97,0x8b,0x4f,0x21,0x06,0x70,0xca,0x1a,0xe0,0x2a,
-0x26,0x00,0x00,0x33,0x37,0xf4,0x33,0x20,0x7b,0x2f,0x20,0x00,0xde,0xcd,0x86,0xf1,
-0x03,0xd6,0x0b,0x90,0x00,0x06,0x02,0x04,0x26,0x03,0xf6,0x48,0x74,0x40,0x1f,0x2c,
-0x8d,0x4f,0x0b,0x65,0x60,0xd1,0x05,0xf9,0x3f,0x4f,0xf0,0x0e,0x40,0x00,0x1f,0x4e,
-0x3c,0x8f,0x8e,0x09,0x00,0xd0,0x34,0x12,0x5f,0x16,0xf3,0x3f,0x73,0x20,0x1e,0xee,
-0xfe,0xee,0x04,0xbc,0x1a,0x00,0x15,0x31,0x10,0x04,0x1b,0x00,0x50,0xaf,0xef,0xfe,
-0xef,0x84,0x09,0x00,0xf2,0x07,0xa7,0x0d,0x44,0x09,0x84,0xfe,0xef,0xee,0x80,0xa7,
-0x4d,0x0c,0x19,0x84,0xf5,0x5f,0x85,0x30,0xa7,0xdc,0xae,0x79,0x1b,0x00,0x32,0x98,
-0x53,0xc9,0x09,0x00,0x40,0x00,0x02,0x4b,0x84,0x99,0x03,0x60,0xa7,0x00,0x03,0xcb,
-0x34,0xf5,0xfa,0x09,0x04,0xb3,0x04,0x17,0x04,0x20,0xc0,0x02,0x6d,0x43,0x13,0x4d,
-0x19,0x1f,0x30,0x80,0x5e,0x22,0xe5,0x3a,0xd1,0x22,0x2b,0x90,0x5e,0x1d,0xdd,0xc1,
-0xf3,0xad,0xdd,0x4a,0x90,0x4c,0xfe,0x0a,0x00,0x13,0x69,0x62,0x6e,0xee,0xd1,0xf3,
-0xae,0xee,0xc1,0x15,0x12,0x82,0x3f,0x9c,0x04,0x89,0x21,0x41,0xba,0x11,0x13,0xf3,
-0xdd,0x42,0xa0,0xbe,0xbb,0xbc,0xfc,0xbb,0xbc,0xf0,0x00,0x00,0xbb,0x54,0x3a,0x10,
-0x37,0x1b,0x00,0x00,0xe8,0x20,0x25,0x05,0xf0,0x2d,0x00,0x70,0xa2,0x00,0x76,0x00,
-0x02,0xf5,0x11,0x49,0x1c,0x03,0x84,0x77,0x04,0x0d,0x24,0x06,0x87,0xdb,0x20,0x09,
-0xdd,0x1e,0x72,0x20,0xdd,0xd9,0x36,0x66,0x11,0x8f,0x3c,0x56,0x64,0x11,0x11,0x17,
-0xf2,0x11,0x11,0x82,0x39,0x13,0xfd,0xc1,0x4a,0x06,0x73,0x1b,0x14,0xfa,0x73,0x1b,
-0x12,0x10,0x40,0x1b,0x00,0xab,0xbe,0x01,0x7b,0x21,0x02,0x2c,0xad,0x01,0x9b,0x01,
-0x02,0x9b,0x29,0x03,0x6a,0x60,0x01,0x11,0x00,0x00,0xa5,0x27,0x40,0xef,0x20,0x00,
-0x04,0x7d,0x2a,0x22,0x25,0xf2,0x5a,0x23,0x22,0x33,0x6f,0x22,0x00,0x23,0x0d,0xed,
-0x01,0x59,0x14,0x31,0xc6,0x42,0x19,0xf6,0x09,0x00,0x00,0x58,0x00,0x12,0xf7,0xf3,
-0x36,0x01,0x8c,0x03,0x70,0xc0,0x25,0x55,0x58,0xf2,0x00,0xfa,0x33,0x71,0x0d,0x2d,
-0x00,0x13,0x2f,0x24,0x00,0x50,0x60,0x06,0x66,0x68,0xf2,0x98,0x62,0x1e,0x20,0x24,
-0x00,0x31,0x56,0x66,0x69,0x1b,0x00,0x23,0x60,0xdf,0x2d,0x00,0x1e,0xf1,0x75,0x00,
-0x0e,0x09,0x00,0x05,0x01,0x00,0x05,0x05,0xaf,0x03,0x17,0x66,0x16,0xed,0x21,0xe3,
-0x03,0x34,0x75,0x14,0x0e,0x5d,0x06,0xf0,0x09,0xea,0x55,0xea,0x55,0x5b,0xd5,0x5a,
-0xf0,0x0e,0x60,0x0d,0x60,0x00,0x8b,0x00,0x6f,0x00,0xe6,0x00,0xd9,0x44,0x4a,0xb0,
-0x06,0x11,0x00,0x31,0xed,0xdd,0xfb,0x11,0x00,0x32,0xd6,0x00,0x08,0x11,0x00,0x52,
-0x83,0x33,0xab,0x00,0x6f,0x70,0x1d,0x28,0xb0,0x06,0x33,0x00,0x03,0x22,0x00,0x06,
-0x55,0x00,0x01,0xbd,0x8a,0x11,0xf0,0xe0,0x19,0x23,0x02,0xd3,0x0d,0x60,0x41,0x25,
-0x8f,0x75,0x54,0x79,0x00,0xe1,0x75,0xbd,0xfb,0xbd,0xc0,0x00,0x44,0x4e,0xa4,0x42,
-0x00,0x7e,0x00,0x6c,0x79,0x0d,0x60,0x1b,0xbe,0xfb,0xbd,0xfb,0x10,0x3f,0x01,0x10,
-0x77,0x34,0x10,0xf1,0x09,0x06,0xd1,0x11,0x4f,0x10,0xaa,0xaa,0xaa,0xa3,0x00,0x6d,
-0x33,0x36,0xf1,0x1f,0xa8,0x88,0x8f,0x50,0x06,0xfc,0xcc,0xdf,0x11,0xa5,0x89,0xf1,
-0x03,0x6c,0x00,0x02,0xf1,0x1f,0xba,0xaa,0xaf,0x50,0x06,0xfe,0xee,0xff,0x10,0x22,
-0x28,0xe2,0x20,0x5f,0x00,0xe0,0xce,0xee,0xff,0xee,0xe1,0x05,0x55,0xea,0x55,0x33,
-0x95,0x38,0xf3,0x33,0xe6,0x0e,0x40,0xfa,0x0f,0x40,0x6e,0x58,0x0f,0x40,0xe9,0x33,
-0x20,0xf6,0x56,0x12,0x00,0x26,0x00,0x30,0x2d,0xdd,0xef,0xc3,0x68,0x14,0xd7,0xe9,
-0x32,0x0f,0x01,0x00,0x01,0x13,0x8d,0xb9,0x0c,0x11,0x25,0x8f,0x2a,0x14,0xdf,0xc6,
-0x57,0x72,0x12,0xc4,0x11,0x11,0x15,0xd4,0x11,0x51,0x5d,0x13,0xbe,0xf9,0x31,0x26,
-0x2f,0x60,0x20,0x2a,0x04,0x7c,0x96,0x06,0x93,0x11,0x05,0xb7,0x1d,0x10,0xf4,0x88,
-0x02,0x08,0xb7,0x1d,0x01,0xfc,0x14,0x00,0x11,0x00,0x01,0x2d,0x76,0x08,0xd9,0x1d,
-0x04,0x11,0x00,0x04,0x84,0x04,0x13,0x10,0xc5,0x06,0x00,0xf2,0x34,0x11,0xf2,0xd1,
-0x57,0xe1,0x02,0xf0,0x92,0x0f,0x26,0x66,0x8f,0x86,0x65,0x00,0x2f,0x0c,0x30,0xf2,
-0x36,0x24,0x91,0x02,0xf0,0xc3,0x0f,0x24,0xcc,0xef,0xcc,0xc5,0x13,0x00,0x10,0x5f,
-0x42,0x00,0x00,0x13,0x00,0x20,0x25,0xe0,0x77,0x08,0x01,0x13,0x00,0x00,0x1d,0x1e,
-0x01,0x13,0x00,0xa0,0xe2,0x22,0x22,0xe6,0x00,0x3e,0x0c,0x30,0xf2,0x5e,0xca,0x0b,
+0x98,0x40,0x85,0x00,0x21,0x56,0xee,0x01,0x00,0x50,0x00,0x00,0xd5,0x25,0x55,0x01,
+0x00,0x16,0x50,0xb5,0x04,0x25,0x00,0xe5,0xb4,0x09,0xf0,0x41,0x50,0x5f,0xff,0xf2,
+0xff,0xff,0xfb,0x00,0x00,0xe5,0x05,0xd3,0x4f,0x03,0x36,0xf3,0x20,0x00,0x0e,0x50,
+0x5c,0x01,0xf0,0x34,0x3e,0x00,0x00,0xbb,0xfd,0xb5,0xd3,0x4f,0x09,0x84,0xe0,0x00,
+0x09,0xaf,0xc9,0x5f,0xdd,0xf0,0xb6,0x5c,0x00,0x00,0x03,0xf7,0x05,0xc0,0x1f,0x0e,
+0x37,0xb0,0x00,0x00,0x7f,0xf2,0x5d,0x01,0xf2,0xf4,0xbb,0x44,0x00,0x0b,0xfc,0xc5,
+0xff,0xff,0x6f,0xff,0xfe,0xe0,0x00,0xef,0x5c,0x6d,0x22,0x20,0xcd,0x03,0xf1,0x29,
+0x5b,0xe5,0x05,0xc0,0xb3,0x00,0x5f,0xb0,0x00,0x0c,0x5e,0x50,0x5c,0x06,0xb0,0x0b,
+0xeb,0x00,0x03,0xe0,0xe5,0x05,0xc2,0xcf,0x22,0xf7,0xb0,0x00,0x03,0x0e,0x50,0x8f,
+0xf7,0xa6,0xb8,0x6b,0x06,0x00,0x00,0xe5,0x1f,0xc2,0x00,0x5e,0x16,0xb0,0xc0,0x00,
+0x0e,0x50,0x40,0x00,0x3e,0x30,0x6c,0x2e,0x98,0x00,0x59,0x0c,0x50,0x02,0xef,0x90,
+0x15,0x02,0x00,0x03,0x00,0x12,0x42,0x90,0x01,0x10,0x3f,0x48,0x02,0x00,0xa3,0x01,
+0x50,0x15,0xf2,0x11,0xe7,0x11,0x13,0x00,0x60,0x6e,0xff,0xfe,0xef,0xfe,0xb0,0x13,
+0x00,0x50,0x04,0xf1,0x00,0xe6,0x00,0x15,0x02,0x01,0x21,0x09,0x61,0x70,0x06,0x6b,
+0xf6,0x61,0x03,0x81,0x02,0x40,0x00,0xcf,0x00,0xdf,0x13,0x00,0xf2,0x1a,0xf2,0x00,
+0x1f,0xf9,0x01,0x22,0x24,0xf4,0x22,0x22,0x00,0x06,0xff,0xf3,0x04,0x44,0x6f,0x64,
+0x44,0x00,0x00,0xcb,0xf8,0xd0,0xed,0xcc,0xfc,0xcc,0xf2,0x00,0x3f,0x5f,0x0d,0x1e,
+0x60,0x3f,0x30,0x3f,0x20,0x0b,0x94,0xa4,0x02,0xe1,0xf2,0x02,0xf1,0x4f,0x00,0x0e,
+0x50,0x2f,0x20,0x2f,0x20,0x04,0x04,0xf0,0xd6,0x06,0xe0,0xff,0x50,0x00,0x4f,0x00,
+0x2e,0x72,0x22,0x22,0x4f,0x40,0x00,0x04,0xf0,0xae,0x00,0x40,0x25,0xf2,0x00,0x00,
+0x26,0x00,0x33,0x00,0x3f,0xfb,0xc0,0x02,0x02,0xa7,0x06,0x05,0x1e,0x02,0x23,0xf0,
+0x0b,0xd6,0x05,0xf0,0x02,0x4f,0x00,0x11,0x18,0xb1,0xa9,0x11,0x10,0x00,0x04,0xf0,
+0x02,0xaa,0xde,0xad,0xda,0xa5,0x65,0x00,0xf0,0x00,0x5f,0x59,0xc5,0xba,0x5c,0x80,
+0x05,0x5b,0xf5,0x54,0xe0,0x6a,0x09,0x70,0xa8,0xab,0x00,0xa0,0x3e,0x17,0xa1,0xa8,
+0x1b,0x80,0x00,0x1f,0xf7,0x03,0x38,0x00,0x53,0xf8,0x00,0x06,0xff,0xe2,0x4c,0x00,
+0x41,0xba,0xf7,0xc0,0xcf,0xb9,0x04,0x40,0x2f,0x5f,0x0d,0x11,0xd1,0x08,0x60,0x00,
+0x0a,0x94,0xf0,0x13,0x33,0x01,0x00,0xf1,0x03,0x02,0xf2,0x4f,0x00,0xce,0xee,0xef,
+0xee,0xee,0xe0,0x06,0x04,0xf0,0x00,0x2a,0x12,0xf2,0x18,0x85,0x00,0xf0,0x00,0x3e,
+0x80,0x2f,0x20,0xbd,0x20,0x00,0x04,0xf0,0x3f,0x70,0x25,0xf2,0x00,0xad,0x13,0x00,
+0x30,0x20,0x1f,0xfc,0x64,0x03,0x00,0x0b,0x02,0x11,0x02,0x56,0x00,0xf1,0x01,0xe3,
+0x00,0x09,0x31,0xf1,0x05,0x80,0x00,0x00,0x0e,0x30,0x02,0xf1,0x0f,0x20,0xb6,0x13,
+0x00,0xf2,0x3c,0x98,0x10,0xf3,0x2e,0x09,0x10,0x03,0x3f,0x63,0x3e,0x1a,0x6e,0x4c,
+0x97,0xc0,0x00,0xff,0xff,0xcc,0xfe,0xd0,0xe6,0xec,0xf3,0x00,0x01,0x4f,0x40,0x32,
+0xd6,0x1d,0x60,0x89,0x70,0x00,0x07,0xf6,0x00,0x98,0x77,0xb7,0x3d,0x2b,0x50,0x00,
+0xbf,0xe0,0x7f,0xbd,0xd9,0x9e,0xfd,0xcb,0x00,0x0e,0xfc,0x84,0x78,0x29,0x7b,0x2b,
+0x70,0x40,0x05,0xae,0x5a,0x16,0xe2,0x27,0xe2,0x4d,0x71,0x00,0xb5,0xe3,0xc1,0x04,
+0xf0,0x04,0xb0,0x3e,0x0e,0x30,0x06,0xe0,0x00,0xf5,0x08,0x60,0x02,0x80,0xe3,0x00,
+0x9f,0xc1,0x0a,0xa5,0xf4,0x72,0x00,0x50,0x0e,0x49,0xe2,0x4f,0xf7,0x72,0x00,0xf9,
+0x0c,0x09,0xd0,0x05,0x18,0xfc,0x00,0xc2,0x00,0x0e,0x38,0xf3,0x00,0x6e,0xb5,0xea,
+0x5f,0x00,0x00,0xe4,0xb4,0x00,0x2b,0x40,0x02,0xae,0x70,0x00,0x01,0x00,0x13,0x7d,
+0x08,0x00,0x23,0x08,0xe0,0x09,0x00,0x19,0x8e,0x11,0x00,0x13,0x4c,0x11,0x00,0x22,
+0x05,0xf0,0x11,0x00,0x00,0xfe,0x04,0x41,0x8f,0x66,0x66,0x66,0x11,0x00,0x01,0x3c,
+0x01,0x1e,0x5f,0x22,0x00,0x0f,0x11,0x00,0x14,0x14,0x0f,0xc2,0x09,0x13,0x66,0x01,
+0x00,0x23,0x60,0x16,0x09,0x00,0x13,0x23,0x1a,0x00,0x10,0xf5,0x2e,0x00,0x13,0xbb,
+0x91,0x00,0x11,0x0b,0x20,0x07,0x04,0x11,0x00,0x22,0x04,0xd1,0x11,0x00,0x00,0xa8,
+0x0b,0x40,0xbb,0x11,0x11,0x10,0xcd,0x0b,0x10,0x0b,0xc9,0x08,0x00,0x11,0x00,0x10,
+0xbc,0x58,0x0c,0x27,0x05,0xf1,0x22,0x00,0x01,0x80,0x00,0x0f,0x11,0x00,0x05,0x13,
+0xef,0x6f,0x00,0x90,0xe6,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x10,0x00,0x01,
+0x00,0xf7,0x8e,0x0e,0x61,0x50,0x00,0x00,0xff,0xff,0xff,0xf5,0x00,0xe6,0x4e,0xc2,
+0x00,0x04,0x4b,0xc4,0x44,0x10,0x0e,0x70,0x09,0x60,0x00,0x00,0xe7,0x00,0x00,0x00,
+0xd8,0x24,0x79,0x20,0x00,0x2f,0x62,0x20,0x58,0xbf,0xff,0xfd,0xa3,0x00,0x06,0xff,
+0xff,0xa8,0xc9,0xea,0x20,0x00,0x00,0x00,0xab,0x22,0xd7,0x00,0x0a,0xa0,0x00,0x01,
+0x00,0x1f,0x40,0x1f,0x30,0x00,0x9d,0x69,0xcf,0xc0,0x09,0xe0,0x04,0xf1,0x8b,0xdf,
+0xfd,0xa7,0x41,0x01,0xf6,0xe8,0x9c,0x0c,0x96,0x7f,0x10,0x06,0x50,0x05,0x03,0xef,
+0x60,0x00,0x01,0xf4,0x05,0xf4,0x00,0x00,0x05,0xf1,0x00,0x00,0x0e,0x86,0xf7,0x00,
+0x00,0x00,0xda,0x00,0x00,0x00,0xaf,0xf6,0x00,0x00,0x00,0x8e,0x10,0x00,0x00,0x5e,
+0xf6,0x00,0x10,0x00,0x6f,0x50,0x00,0x05,0xcf,0x9d,0xc0,0x0e,0x00,0x8f,0x80,0x00,
+0x8f,0xfa,0x20,0x4f,0xa8,0xe0,0x0a,0x70,0x00,0x04,0x71,0x00,0x00,0x5d,0xf6,0x00,
+0x01,0x00,0x23,0x0c,0x80,0x09,0x00,0x24,0x06,0xf4,0x13,0x00,0x20,0xef,0xff,0x01,
+0x00,0x51,0xf3,0x00,0x00,0xbf,0x44,0x01,0x00,0x43,0x00,0x00,0xaf,0x50,0x1b,0x00,
+0x21,0x7f,0x78,0x1c,0x00,0xa0,0xb0,0x00,0x01,0x50,0xac,0x33,0x3d,0xa3,0x33,0xca,
+0x42,0x00,0x30,0x90,0x00,0xd7,0x05,0x00,0x81,0x00,0x00,0xf7,0x00,0x0f,0x50,0x00,
+0xd8,0xf7,0x00,0x02,0x43,0x00,0xf0,0x00,0x05,0x58,0xf6,0x55,0x7f,0x65,0x55,0xf9,
+0x55,0x10,0x00,0x6f,0x00,0x05,0xf0,0x1f,0x00,0xf2,0x06,0x00,0x09,0xd0,0x00,0x7d,
+0x00,0x02,0xf3,0x00,0x00,0x00,0xcc,0x44,0x4b,0xc4,0x44,0x7f,0x64,0x30,0x00,0x0e,
+0x2f,0x00,0x11,0xfa,0x63,0x00,0x33,0x01,0x02,0xdb,0x6d,0x00,0x37,0xff,0xfc,0x20,
+0xa9,0x00,0x60,0x04,0xa0,0x00,0x00,0x0b,0x60,0x84,0x00,0xd6,0x00,0x00,0x00,0xe8,
+0x00,0x00,0x00,0x07,0xf0,0x00,0x00,0x0e,0x80,0x11,0x00,0x13,0x20,0x11,0x00,0x21,
+0x9f,0x40,0x11,0x00,0xf2,0x04,0x01,0xbf,0xa0,0x07,0xff,0xff,0xfa,0x0e,0x85,0xef,
+0x50,0x00,0x7f,0x55,0x55,0x30,0xee,0xfa,0x10,0x33,0x00,0x1f,0xd4,0x44,0x00,0x08,
+0x13,0x54,0x11,0x00,0xf6,0x15,0x09,0xc0,0x7f,0x00,0x01,0x30,0xe8,0x00,0x00,0xab,
+0x07,0xf2,0x6b,0xfa,0x0e,0x80,0x00,0x0c,0x90,0xcf,0xff,0xc6,0x10,0xcd,0x65,0x57,
+0xf5,0x1f,0xd7,0x10,0x00,0x04,0xef,0xff,0xfa,0x00,0x9d,0x00,0x23,0x4d,0x30,0x09,
+0x00,0x23,0x0b,0xf0,0x09,0x00,0x12,0x02,0xd2,0x00,0x60,0xf9,0x00,0x00,0x9f,0x43,
+0x33,0x01,0x00,0x50,0x20,0x00,0x3f,0x82,0x22,0x01,0x00,0x41,0x00,0x00,0x1d,0xe1,
+0x1c,0x00,0x44,0xd0,0x00,0x0d,0xf3,0x41,0x00,0x14,0x56,0x69,0x01,0x73,0x00,0x5e,
+0xee,0xee,0xee,0xee,0xef,0x47,0x00,0xf0,0x08,0x3a,0x10,0x5f,0x10,0x00,0x00,0x07,
+0xd5,0x00,0x1e,0xa0,0x04,0xf1,0x00,0x00,0x00,0x08,0xfc,0x4c,0xd0,0x00,0x3f,0x20,
+0x60,0x00,0x41,0xbf,0xf3,0x00,0x02,0xb1,0x01,0xf0,0x0d,0x3d,0xde,0xe4,0x00,0x0f,
+0x60,0x60,0x00,0x01,0x8f,0xa0,0x1c,0xf7,0x00,0xcb,0x0d,0x20,0x18,0xfe,0x50,0x00,
+0x09,0xe1,0x05,0xf8,0xf0,0x04,0xe8,0x4e,0x01,0x37,0x00,0x09,0xf9,0x45,0x01,0x10,
+0x86,0x49,0x01,0x10,0xf1,0xf9,0x00,0x60,0xee,0x50,0x24,0x00,0x4f,0x10,0x22,0x00,
+0x52,0x9c,0x07,0xe0,0x04,0xf1,0x1f,0x00,0x60,0x7e,0x00,0x4f,0x10,0x4b,0x30,0x1f,
+0x00,0xf0,0x11,0xe0,0x04,0xf9,0xef,0xf6,0x00,0x74,0x00,0x00,0x7e,0x05,0xcf,0xe9,
+0x2f,0x60,0x0b,0xfc,0x20,0x07,0xfe,0xfd,0xf1,0x00,0xf6,0x00,0x03,0xdc,0x4b,0xff,
+0x82,0x4f,0x10,0xca,0x01,0x20,0x16,0xba,0x39,0x00,0x14,0xf5,0x39,0x00,0x50,0x0f,
+0x40,0x00,0x00,0x57,0x4c,0x00,0xf0,0x00,0x03,0xf3,0x00,0x00,0x0d,0xa0,0x7e,0x00,
+0x4f,0x3e,0xfe,0x00,0x00,0x07,0xf2,0x13,0x00,0xf0,0x01,0x65,0x10,0x00,0x01,0xe9,
+0x00,0x7e,0x00,0x02,0x00,0x01,0xa1,0x00,0x9f,0x10,0x06,0xe1,0x00,0xf1,0x08,0x4f,
+0x10,0x3f,0x70,0x00,0x4f,0x75,0x44,0x44,0x5c,0xe0,0x01,0xa0,0x00,0x00,0x9e,0xff,
+0xff,0xff,0xd4,0x00,0x04,0x60,0x4e,0x00,0x40,0x00,0x00,0x8f,0xd3,0x86,0x00,0x00,
+0xe1,0x00,0x12,0xf3,0x11,0x00,0x71,0x00,0x06,0x03,0x66,0x6b,0xf6,0x66,0x20,0x00,
+0x72,0xee,0xff,0xee,0xee,0x22,0x20,0x00,0x22,0x00,0x23,0x9f,0xa2,0x33,0x00,0x23,
+0x3c,0xf1,0x33,0x00,0x21,0x03,0x05,0x62,0x01,0xf1,0x00,0xe0,0x00,0x00,0x26,0x66,
+0x8f,0xa6,0x66,0x65,0x00,0x00,0x90,0x00,0x0a,0xe0,0xc0,0x02,0xf3,0x22,0x10,0x03,
+0xf6,0x01,0x70,0x00,0x00,0x1f,0x80,0x00,0xbd,0x00,0x1f,0x70,0x00,0x09,0xe1,0x00,
+0x5f,0x30,0x00,0x5f,0x30,0x03,0xf7,0x00,0x1e,0x91,0x35,0x78,0xfd,0x00,0xdd,0x00,
+0x0c,0xff,0xff,0xec,0xa9,0xf6,0x1d,0x40,0x00,0x67,0x52,0x00,0x00,0x0a,0xc0,0x39,
+0x01,0x80,0x11,0x00,0x41,0x00,0x00,0x00,0x05,0xa0,0xf0,0x02,0x23,0xf8,0x00,0x92,
+0x00,0x60,0x05,0xfa,0x02,0x22,0x28,0xe2,0xd4,0x01,0x21,0x01,0x13,0x72,0x00,0xf0,
+0x1c,0xf2,0x00,0x00,0x00,0x3f,0x32,0x28,0xe2,0x22,0xbc,0x00,0x51,0x00,0x03,0xf1,
+0x00,0x7e,0x00,0x0f,0x60,0x0d,0xf8,0x00,0x3f,0x10,0x07,0xe0,0x04,0xd0,0x00,0x07,
+0xfb,0x04,0xf6,0x55,0xaf,0x55,0x53,0x00,0x00,0x03,0x30,0x4f,0x2f,0x00,0x10,0xc0,
+0x8e,0x01,0x40,0xf3,0xf4,0x00,0x00,0x92,0x03,0x41,0x40,0x6f,0x0a,0xd0,0x87,0x02,
+0xf0,0x09,0x2f,0x48,0xd0,0x2f,0x70,0x1e,0x80,0x00,0x00,0x0a,0xd0,0xab,0x00,0x6f,
+0x4c,0xd0,0x00,0x00,0x01,0xf6,0x0e,0x70,0x00,0xaf,0x5d,0x00,0xf0,0x11,0x9e,0x03,
+0xf2,0x00,0x2c,0xff,0x70,0x00,0x00,0x2f,0x70,0xbd,0x01,0x8f,0xd3,0x7f,0xc5,0x00,
+0x08,0xe0,0x4f,0x49,0xfe,0x80,0x00,0x3c,0xfe,0x30,0x02,0x00,0x60,0x36,0xfd,0x00,
+0x30,0x70,0x00,0x60,0x9c,0x00,0xf1,0x10,0xb0,0x00,0x10,0x00,0x2e,0xe4,0x03,0xf3,
+0x00,0x7e,0x00,0x0b,0xd0,0x00,0x1a,0xf5,0x0c,0xd0,0x07,0xe0,0x03,0xf6,0x00,0x00,
+0x06,0x10,0x3f,0x50,0x7e,0x00,0xdc,0xd6,0x00,0xf2,0x02,0xa5,0x07,0xe0,0x2b,0x30,
+0x00,0x50,0x00,0x00,0x55,0x55,0xaf,0x55,0x55,0x20,0x1e,0xe6,0x8b,0x03,0x40,0xf5,
+0x00,0x08,0xf8,0xa8,0x04,0x00,0xb0,0x03,0x30,0x04,0x20,0x0e,0xb9,0x02,0x15,0xf5,
+0x19,0x04,0xe3,0x50,0x00,0x00,0x70,0x0e,0x81,0x11,0x11,0x11,0xf5,0x00,0x00,0x3f,
+0x40,0x26,0x00,0x23,0x0c,0xc0,0x39,0x00,0xf0,0x06,0x04,0xf4,0x00,0xe9,0x44,0x44,
+0x44,0x4f,0x50,0x00,0xdb,0x00,0x0e,0x70,0x00,0x00,0x00,0xf5,0x00,0x8f,0x20,0x4c,
+0x00,0x50,0x77,0x7f,0x40,0x02,0x70,0x13,0x00,0x60,0x0a,0xdd,0x90,0x00,0x00,0x94,
+0x4f,0x00,0x70,0x6b,0x3b,0x10,0x00,0x1a,0xfb,0x10,0xb5,0x01,0xf4,0x00,0x9e,0x30,
+0x00,0x04,0xe4,0x00,0x00,0x00,0x6e,0x00,0x77,0x00,0x00,0x00,0x1f,0xbf,0x01,0xf0,
+0x1e,0x01,0xf6,0x44,0x44,0x8f,0x54,0x44,0x00,0x63,0x00,0x1f,0x21,0x11,0x14,0xf1,
+0x00,0x00,0x0c,0xfa,0x01,0xf3,0xff,0xff,0x6f,0x20,0xa6,0x00,0x06,0xf7,0x2f,0x20,
+0x00,0x01,0xf3,0x0f,0x40,0x00,0x02,0x02,0xf1,0x44,0x44,0x1f,0x55,0xf0,0x7c,0x01,
+0xf0,0x12,0x1f,0xcc,0xf2,0xe7,0xba,0x00,0x00,0x04,0x34,0xf0,0xe0,0x0d,0x2c,0xbf,
+0x30,0x00,0x00,0xca,0x5e,0x0e,0x00,0xd2,0x9f,0xc0,0x00,0x00,0x3f,0x38,0xc0,0xf4,
+0x4e,0x27,0xf4,0x56,0x01,0xf7,0x14,0xc8,0x0f,0xcc,0xc4,0xef,0x30,0x72,0x02,0xf5,
+0x1f,0x40,0xd0,0x03,0xec,0xeb,0x0d,0x40,0xbe,0x09,0xd0,0x00,0x09,0xf7,0x07,0xfc,
+0xf1,0x02,0x40,0x95,0x00,0x00,0xa3,0x00,0x09,0xf7,0x33,0x03,0x14,0x54,0x09,0x00,
+0xf1,0x0b,0x0a,0xfc,0x30,0xdf,0xff,0xff,0xff,0xf4,0x00,0x00,0x03,0xcd,0x0d,0x81,
+0x11,0x11,0x3f,0x40,0x00,0x00,0x00,0x20,0xd7,0x00,0x00,0x01,0x89,0x03,0x10,0x0d,
+0xb4,0x00,0x10,0x40,0x27,0x02,0xa0,0xd8,0x11,0x11,0x12,0xf4,0x00,0x0d,0xf9,0x00,
+0x0d,0x6a,0x02,0x53,0x40,0x00,0x05,0xec,0x00,0x39,0x00,0x31,0x01,0x30,0x02,0x04,
+0x04,0x00,0x77,0x03,0x01,0x17,0x04,0x53,0x00,0x00,0x00,0x63,0x7f,0xed,0x00,0xf3,
+0x06,0x1f,0x77,0xc0,0x5b,0x06,0xb0,0x6e,0x00,0x00,0x08,0xe0,0x7c,0x05,0xb0,0x6b,
+0x06,0xe0,0x00,0x01,0xf7,0x07,0x13,0x00,0x23,0x9e,0x00,0x13,0x00,0xc2,0x3f,0x60,
+0x39,0xd3,0x8c,0x38,0xc3,0x9f,0x30,0x06,0xd0,0x1f,0x64,0x04,0x16,0x30,0xab,0x00,
+0x14,0x70,0x09,0x00,0x42,0x3e,0xe4,0x0c,0xff,0x61,0x02,0xf1,0x01,0x1b,0xf3,0xcb,
+0x44,0x45,0x96,0x44,0x43,0x00,0x00,0x05,0x0c,0x90,0x00,0x2f,0x60,0x1f,0x00,0xf0,
+0x0f,0xc9,0x14,0x48,0xf5,0x44,0x40,0x00,0x30,0x00,0x0c,0x94,0xfc,0xcc,0xcc,0xdf,
+0x00,0x2e,0xd5,0x00,0xc9,0x4f,0x00,0x00,0x04,0xf0,0x00,0x07,0xf4,0x0d,0x84,0x39,
+0x00,0x00,0x39,0x04,0x60,0xd8,0x4f,0x11,0x11,0x15,0xf0,0xe0,0x01,0xa0,0x64,0xf0,
+0x00,0x00,0x4f,0x00,0x00,0x03,0x31,0xf4,0xb7,0x02,0x90,0xf0,0x00,0x00,0xbc,0x3f,
+0x20,0x00,0x0e,0x60,0x71,0x01,0xf8,0x1d,0x48,0xe0,0x0d,0x50,0xe6,0x1e,0x50,0x00,
+0x0a,0xd0,0xca,0x08,0xe0,0x0e,0x60,0x7e,0x10,0x03,0xf5,0x3f,0x45,0xf4,0x00,0xe6,
+0x00,0xda,0x00,0xcd,0x0b,0xc0,0x67,0x03,0x3f,0x60,0x04,0x60,0x04,0x40,0x94,0x00,
+0x00,0xef,0xd2,0x00,0x01,0x00,0x61,0x05,0xa3,0x00,0x0e,0x70,0x86,0xe5,0x04,0x41,
+0xfa,0x08,0xf1,0x08,0x80,0x04,0x21,0x03,0x42,0xb5,0x00,0xf0,0x0d,0x20,0x06,0x40,
+0x02,0xef,0x42,0x27,0xf2,0x22,0x20,0x00,0xcf,0xd5,0xdf,0xf4,0x11,0x7f,0x11,0x10,
+0x00,0x00,0x3b,0x3a,0x5f,0xed,0xde,0xfd,0xdd,0xe2,0x00,0x41,0x13,0xf2,0x00,0x6f,
+0x44,0x00,0x20,0xb9,0x3f,0x2f,0x00,0x44,0x90,0x00,0x00,0x9e,0x13,0x00,0xf1,0x08,
+0x8f,0x30,0x3f,0x75,0x59,0xf5,0x55,0x52,0x00,0x6f,0x60,0x03,0xff,0xfe,0xdd,0xdd,
+0xdd,0x60,0x00,0x60,0x00,0x01,0x4f,0xaa,0x05,0xa4,0x55,0x55,0x55,0x57,0xf7,0x55,
+0x55,0x55,0x50,0x0e,0x9f,0x06,0x01,0x74,0x00,0x14,0xf2,0x92,0x00,0x01,0x58,0x05,
+0x07,0x13,0x00,0x50,0x53,0x00,0x00,0x00,0x8c,0x09,0x00,0xb4,0xbf,0xa1,0x11,0x11,
+0x5f,0x51,0x11,0x10,0x00,0x05,0xe6,0xa7,0x06,0xb0,0x01,0xf4,0x11,0x11,0x11,0x11,
+0xba,0x00,0x00,0x01,0xf5,0xd0,0x01,0x51,0xba,0x05,0x10,0x00,0x0b,0xbb,0x00,0x60,
+0x0c,0xfa,0x10,0x00,0x00,0x0f,0x19,0x02,0x70,0x4b,0x10,0x6d,0xdd,0xdf,0xed,0xdd,
+0xe3,0x03,0x50,0x7d,0x33,0x4f,0x73,0x38,0x7f,0x04,0x40,0x7c,0x00,0x0f,0x40,0xd7,
+0x01,0x13,0xa0,0xf3,0x01,0xf2,0x05,0x07,0xf1,0x7d,0x11,0x2f,0x51,0x17,0xe0,0x00,
+0x0e,0x90,0x7d,0x22,0x3f,0x62,0x27,0xe0,0x00,0x5f,0x30,0x1b,0x00,0x00,0xa0,0x03,
+0xf0,0x08,0x49,0x20,0x0a,0x80,0x00,0x05,0xf4,0x00,0x3a,0xf8,0x00,0x04,0xde,0x60,
+0x05,0xc0,0x0a,0xfb,0x30,0x00,0x00,0x07,0xf9,0x46,0x02,0x10,0x00,0x7a,0x02,0x20,
+0x00,0x73,0x95,0x02,0x10,0x70,0x18,0x06,0xf1,0x0b,0xfa,0x10,0x9e,0xee,0xff,0xee,
+0xe8,0x00,0x00,0x02,0xeb,0x0a,0x90,0x0c,0x90,0x0a,0x90,0x00,0x00,0x01,0x20,0xa9,
+0x00,0xc9,0x00,0xa9,0xb9,0x02,0xf3,0x04,0xee,0xef,0xfe,0xee,0x80,0x00,0x41,0x00,
+0x03,0x33,0x33,0xda,0x33,0x33,0x30,0x0d,0xf9,0x03,0xff,0x6a,0x01,0x24,0xfc,0x00,
+0xb1,0x06,0x70,0x40,0x0c,0xfe,0xee,0xee,0xef,0xd0,0x0c,0x00,0xf1,0x39,0xc8,0x11,
+0x11,0x11,0x8d,0x00,0x00,0x00,0x42,0x0c,0xec,0xcc,0xcc,0xce,0xd0,0x00,0x00,0x0e,
+0x90,0xca,0x55,0x55,0x55,0xad,0x00,0x00,0x07,0xf1,0x0c,0xa6,0x66,0x66,0x6b,0xd0,
+0x00,0x01,0xf8,0x00,0xcd,0xaa,0xaa,0xaa,0xdd,0x00,0x00,0xae,0x10,0x02,0x4c,0xa3,
+0x3b,0xb4,0x20,0x00,0x4f,0x60,0x02,0x8f,0xc3,0x00,0x3b,0xf9,0x10,0x03,0xa0,0x07,
+0xfb,0x40,0x00,0x00,0x03,0xdd,0x7f,0x06,0x00,0x01,0x00,0x17,0x10,0xf9,0x01,0x24,
+0x08,0xe0,0x72,0x00,0x14,0xf8,0x13,0x00,0x30,0xcf,0xfe,0xee,0x01,0x00,0xf0,0x17,
+0x30,0x00,0xbf,0xf5,0x5f,0x75,0xbc,0x56,0xf7,0x51,0x00,0xbf,0xae,0x00,0xf3,0x08,
+0xa0,0x1f,0x30,0x00,0x08,0x55,0xe0,0x0f,0x30,0x8a,0x01,0xf3,0x00,0x00,0x13,0x8f,
+0x33,0xf6,0x3a,0xb3,0x5f,0x63,0x2e,0x09,0x04,0xa0,0x08,0x40,0x5f,0x00,0xf3,0x09,
+0x26,0x00,0x24,0x00,0x05,0x26,0x00,0x23,0x00,0x5e,0x39,0x00,0x04,0xe5,0x01,0x33,
+0xfc,0x00,0x44,0x01,0x00,0x90,0x30,0x00,0x0c,0x40,0x36,0x00,0x47,0x00,0x6c,0xc7,
+0x00,0x60,0x05,0xf0,0x05,0xf2,0x01,0xfa,0x84,0x00,0x80,0x3f,0x20,0x0e,0x70,0x05,
+0xf4,0x00,0xcc,0x93,0x08,0x44,0xab,0x00,0x0c,0xd0,0xad,0x00,0x00,0x07,0x00,0x63,
+0x15,0x00,0x00,0x04,0x20,0x00,0x33,0x07,0x10,0xe7,0x0b,0x00,0x00,0x33,0x07,0x61,
+0x0e,0x70,0xbc,0x00,0x00,0x43,0x13,0x00,0x51,0x01,0xf8,0x00,0x0b,0xe1,0x13,0x00,
+0x60,0x06,0xf2,0x00,0x1e,0xa4,0xf1,0xde,0x09,0x90,0x06,0x00,0x00,0x5f,0x8f,0x34,
+0x44,0x4f,0xa4,0xd0,0x07,0x24,0x85,0xf5,0xcb,0x04,0x40,0x4f,0x20,0x00,0x2f,0x5e,
+0x01,0x00,0xb4,0x09,0x30,0x04,0xff,0x20,0x55,0x00,0x50,0xff,0x10,0x00,0x7f,0xe6,
+0xd9,0x06,0xf1,0x0b,0xfb,0xf1,0x00,0x0c,0xb8,0xd0,0x00,0x00,0x09,0xf6,0x4f,0x10,
+0x02,0xf6,0x2f,0x50,0x00,0x01,0xe5,0x04,0xf1,0x00,0xbe,0x00,0xad,0x00,0x72,0x00,
+0x41,0x5f,0x60,0x02,0xfa,0x85,0x00,0x50,0x3e,0xb0,0x00,0x06,0xf8,0x13,0x00,0xb0,
+0x5e,0xd1,0x00,0x00,0x08,0xfb,0x10,0x00,0x04,0xf7,0xc1,0x40,0x00,0x18,0xb0,0x5a,
+0x03,0x10,0x6d,0x05,0x00,0x94,0x12,0x22,0x22,0x24,0xf9,0x22,0x22,0x22,0x29,0x07,
+0x01,0xf0,0x12,0x02,0x11,0x11,0x2e,0x71,0x31,0x11,0x21,0x11,0xe9,0x00,0x0b,0xa0,
+0x1e,0x80,0x2e,0x80,0x02,0xcd,0x2b,0xfc,0xce,0xa0,0x4e,0xa0,0x00,0x00,0x70,0x67,
+0x7f,0xa0,0x06,0x60,0x61,0x09,0xf0,0x08,0x2d,0x83,0xd1,0x75,0x00,0x00,0x6c,0xe8,
+0x6f,0xa6,0x7e,0xc6,0xeb,0x20,0x9e,0x70,0x2f,0xdc,0xa9,0x7e,0x61,0xbf,0x31,0x51,
+0x04,0x30,0x30,0x31,0x00,0x04,0x0a,0x00,0xdb,0x07,0x05,0x5c,0x01,0x60,0xfe,0x55,
+0x55,0x55,0x58,0xf8,0x53,0x03,0x00,0x3f,0x03,0x13,0x30,0x3e,0x03,0x14,0xf3,0x50,
+0x03,0x04,0x99,0x04,0x50,0x01,0x11,0x11,0x11,0x10,0x14,0x0a,0x11,0x76,0xaf,0x04,
+0x81,0x05,0x59,0xf5,0x52,0x6e,0x11,0x11,0x13,0xc0,0x01,0x60,0x06,0xe0,0x00,0x00,
+0x2f,0x30,0x1b,0x0a,0x14,0x6f,0xd3,0x01,0xc0,0x06,0xe2,0x22,0x22,0x4f,0x30,0x07,
+0x9b,0xf9,0x92,0x6e,0x00,0x95,0x01,0x41,0x8b,0xdf,0xbb,0x36,0xe8,0x04,0x00,0x26,
+0x00,0x4f,0x6e,0x22,0x22,0x25,0x39,0x00,0x04,0xf0,0x0b,0x48,0x91,0x3e,0x83,0xf9,
+0x33,0x00,0x03,0x8d,0xff,0xb6,0x01,0xf2,0x0e,0x60,0x00,0x03,0xfd,0x84,0x00,0x00,
+0x8d,0x00,0xe6,0x00,0x20,0x85,0x02,0xf5,0x09,0x5f,0x50,0x0e,0x60,0x0c,0x50,0x00,
+0x00,0x04,0xaf,0x70,0x00,0xe9,0x33,0xe4,0x00,0x00,0x02,0xfc,0x40,0x00,0x08,0xff,
+0xfc,0xa4,0x02,0xf1,0x17,0x00,0x06,0x66,0x66,0x53,0xcc,0xcc,0xcc,0xcc,0xc5,0x00,
+0xee,0xff,0xec,0x3f,0x76,0x7f,0x86,0x6f,0x60,0x00,0x0b,0xa0,0x03,0xf0,0x00,0xf2,
+0x00,0xe6,0x00,0x00,0xba,0x00,0x3f,0x43,0x4f,0x53,0x3f,0x13,0x00,0x00,0x8e,0x00,
+0xf6,0x00,0xf6,0x00,0x11,0xba,0x10,0x3f,0x00,0x0f,0x20,0x0e,0x60,0x0d,0xff,0xff,
+0x83,0x26,0x00,0x00,0x1d,0x00,0x00,0x26,0x00,0x90,0x01,0x44,0x46,0xf7,0x44,0x41,
+0x00,0x00,0xba,0xd2,0x07,0x10,0x40,0x1c,0x0a,0x50,0xa0,0x02,0x55,0x56,0xf8,0xfe,
+0x07,0x21,0xbb,0x68,0xe5,0x03,0x51,0xa0,0x01,0x6e,0xff,0xb0,0xc6,0x09,0x42,0x02,
+0xff,0xc7,0x10,0x26,0x00,0x40,0x07,0x20,0x00,0x44,0x39,0x00,0x24,0x44,0x10,0x67,
+0x01,0x61,0xf4,0x00,0x03,0x40,0x02,0xb3,0xa2,0x00,0x12,0xcc,0x49,0x00,0x32,0x00,
+0x2f,0x60,0xfb,0x09,0xa3,0x08,0xf4,0x33,0x6f,0x73,0x33,0x33,0x30,0x00,0xef,0xd0,
+0x04,0xa2,0x9f,0x32,0x22,0x5f,0x62,0x22,0x22,0x20,0x4f,0x60,0x1d,0x0a,0x33,0x08,
+0xb0,0x00,0x33,0x00,0x13,0x00,0x2e,0x0a,0x20,0x0c,0xee,0x0c,0x04,0xcc,0xee,0x50,
+0x00,0x56,0x66,0x68,0xf9,0x66,0x66,0x62,0x00,0x00,0x22,0x00,0x0c,0x11,0x00,0xa3,
+0x05,0x55,0x55,0x55,0x7f,0x85,0x55,0x55,0x55,0xdf,0xf6,0x01,0x10,0xf0,0x2a,0x01,
+0x00,0x01,0x00,0x23,0x50,0x00,0x07,0x02,0x00,0x01,0x08,0x20,0x1f,0x40,0x7b,0x09,
+0x10,0xf5,0x0c,0x07,0x00,0xf6,0x08,0x76,0x72,0x22,0x4f,0x62,0x22,0x28,0xe0,0x22,
+0x00,0x04,0x11,0x00,0x04,0x22,0x00,0x22,0x1f,0x40,0x33,0x00,0x40,0x02,0xfe,0xee,
+0xee,0x03,0x00,0xb3,0x00,0x4f,0x77,0x77,0x8f,0x97,0x77,0x7b,0xe0,0x06,0xe0,0x22,
+0x00,0x22,0xba,0x00,0x22,0x00,0x22,0x2f,0x60,0x11,0x00,0x20,0x0b,0xe0,0x11,0x00,
+0x40,0x44,0x3a,0xe1,0xe5,0x80,0x05,0x31,0x0c,0xff,0xf7,0xb8,0x01,0x00,0xbe,0x01,
+0x22,0x16,0x66,0x01,0x00,0x22,0x12,0xdd,0x01,0x00,0x16,0xd3,0x0d,0x03,0x12,0x03,
+0x65,0x07,0x21,0x15,0x11,0xba,0x00,0xf0,0x0a,0x17,0x13,0xf3,0x1f,0x10,0x2f,0x00,
+0x3f,0x02,0xf3,0x3f,0x31,0xf1,0x02,0xf0,0x03,0xf0,0x2f,0x33,0xf3,0x1f,0x65,0x7f,
+0x65,0x7f,0x11,0x00,0x41,0xfd,0xcd,0xfc,0xcd,0x11,0x00,0x0d,0x22,0x00,0x00,0x3c,
+0x00,0x40,0x02,0xf3,0x3f,0x30,0x4c,0x00,0x42,0x30,0x2f,0x33,0xf3,0x1d,0x01,0x23,
+0xf3,0x3f,0x11,0x01,0x21,0x31,0x55,0x01,0x00,0x21,0x57,0xf3,0x8f,0x00,0xf0,0x07,
+0x34,0x69,0xcb,0x00,0x00,0x04,0xcd,0xef,0xff,0xff,0xec,0xa7,0x40,0x00,0x00,0x15,
+0x88,0x33,0x4f,0x40,0x03,0xb2,0x8d,0x01,0x20,0xf1,0x02,0x67,0x04,0x10,0x00,0x1c,
+0x0b,0x20,0x2f,0x40,0xa7,0x0d,0xf0,0x03,0x9d,0xdd,0xfe,0xde,0xfe,0xdf,0xfd,0xdd,
+0xc0,0x03,0x55,0x55,0x9f,0xbf,0xbf,0xa5,0x55,0x55,0xc3,0x06,0x40,0x82,0xf4,0x6f,
+0xa1,0x78,0x01,0xf1,0x04,0xcf,0x60,0x2f,0x40,0x4d,0xe8,0x10,0x00,0x7e,0xfa,0x10,
+0x01,0xa2,0x00,0x07,0xff,0xb0,0x07,0x98,0x6f,0x00,0xf0,0x00,0xfd,0x77,0x00,0x00,
+0x6f,0x22,0x24,0xf5,0x22,0x2b,0xc0,0x00,0x00,0x06,0xf0,0xae,0x01,0x53,0xbc,0x00,
+0x00,0x00,0x6f,0xf1,0x07,0x00,0x13,0x00,0x50,0x1f,0x30,0x00,0xac,0x00,0x26,0x00,
+0x13,0x23,0x26,0x00,0x01,0x1c,0x00,0xb1,0xeb,0x00,0x00,0x00,0x22,0x22,0x23,0x12,
+0xb1,0x00,0x72,0x5d,0x02,0x50,0xfe,0x0c,0xa0,0xae,0x30,0xe9,0x04,0xf1,0x20,0x2f,
+0x60,0x4f,0xcb,0x10,0x41,0x00,0x09,0xd3,0x0d,0xd0,0x00,0x8f,0x20,0x7f,0x50,0x00,
+0x06,0xfc,0xe2,0x00,0x00,0xbd,0xbd,0x20,0x00,0x00,0x0c,0xfd,0xdd,0xdd,0xde,0xcf,
+0x40,0x00,0x00,0x2d,0xe2,0x45,0x55,0x55,0x50,0xbf,0x70,0x00,0x8f,0xc1,0xff,0x00,
+0x51,0x9f,0xe3,0x0b,0x60,0xdf,0xc7,0x0c,0xb1,0x39,0x00,0x00,0x0e,0x93,0x33,0x33,
+0x33,0xbd,0x00,0x00,0xdd,0x0e,0x00,0xe1,0x0d,0x08,0x13,0x00,0x02,0x26,0x00,0x00,
+0x0a,0x00,0x40,0x4c,0x00,0x00,0x0b,0xa3,0x08,0x00,0x3e,0x06,0x10,0x04,0x2e,0x01,
+0xa4,0x23,0x33,0x3b,0xa3,0x33,0xcc,0x33,0x33,0x30,0x0b,0x52,0x04,0x05,0x8f,0x03,
+0x00,0x41,0x04,0x21,0x50,0x00,0x02,0x05,0x00,0xbb,0x0b,0x10,0x04,0x80,0x0a,0x30,
+0xee,0xef,0xfe,0x03,0x00,0x61,0x90,0x00,0x33,0x33,0x36,0xf6,0x54,0x0d,0xa1,0x02,
+0x22,0x29,0xf2,0x22,0x22,0x21,0x00,0x00,0x2f,0x3f,0x00,0x12,0xfb,0xe3,0x0b,0x01,
+0xe9,0x02,0x30,0xdd,0xdd,0xff,0x0c,0x02,0x71,0xd6,0x02,0x22,0x3d,0xd3,0x22,0x22,
+0x25,0x00,0x60,0x8f,0xec,0xcc,0xcc,0xcc,0xc9,0x79,0x05,0xf2,0x0c,0x74,0x44,0x44,
+0x44,0xcb,0x00,0x00,0x4f,0xcf,0x62,0x22,0x22,0x22,0xcb,0x00,0x06,0xfc,0x1f,0xdb,
+0xbb,0xbb,0xbb,0xeb,0x00,0x4f,0xb1,0x0f,0x12,0x00,0x32,0x05,0x00,0x0f,0x12,0x00,
+0x23,0x00,0x00,0x12,0x00,0x90,0x00,0x00,0x0f,0xff,0xff,0xff,0xff,0xfa,0x00,0x11,
+0x00,0x01,0x00,0xf1,0x75,0xc5,0x00,0x00,0x00,0x88,0x88,0x88,0x20,0x00,0x3f,0x20,
+0x00,0x00,0x0b,0xbe,0xeb,0xb8,0xff,0xff,0xff,0xff,0xf6,0x00,0x00,0xe7,0x00,0x5e,
+0x35,0xf7,0x43,0x3e,0x60,0x00,0x2f,0x30,0x05,0xe0,0xbc,0x4e,0x00,0xd6,0x00,0x05,
+0xf0,0x00,0x14,0x5f,0x40,0xe7,0x03,0x10,0x00,0x9d,0x11,0x10,0x4f,0xff,0xff,0xff,
+0xf4,0x00,0x0e,0xff,0xff,0x5f,0xf8,0x33,0xf8,0x33,0x10,0x04,0xfa,0x15,0xfd,0xbf,
+0x60,0x0e,0x60,0x00,0x00,0xcf,0x90,0x4f,0x10,0xef,0xff,0xff,0xff,0x30,0x3f,0xc9,
+0x04,0xf0,0x0e,0x72,0x2e,0x72,0x20,0x00,0x59,0x90,0x4f,0x00,0xe6,0x00,0xe6,0x00,
+0x00,0x00,0x99,0x04,0xf0,0x0e,0xee,0xef,0xee,0xe3,0x00,0x09,0xc7,0x9f,0x00,0xe8,
+0x33,0xf8,0x33,0x00,0x00,0x9e,0xcc,0xb0,0x0e,0x39,0x00,0xf1,0x07,0x09,0x90,0x00,
+0x00,0xed,0xcc,0xfd,0xcc,0xc0,0x00,0x33,0x00,0x00,0x0e,0xa6,0x66,0x66,0x66,0x00,
+0x00,0x06,0x66,0x01,0x00,0x41,0x10,0x00,0x0f,0xff,0x01,0x00,0x2f,0x30,0x00,0x01,
+0x00,0x07,0x22,0x0a,0xff,0x01,0x00,0x62,0xfe,0x04,0x66,0x66,0x66,0x8f,0x40,0x00,
+0x41,0x00,0x00,0x1f,0x50,0x1d,0x00,0xa0,0x88,0x00,0x1f,0x50,0x06,0x70,0x00,0x00,
+0x02,0xf8,0x09,0x00,0x50,0xf4,0x00,0x00,0x0a,0xe0,0x1b,0x00,0x50,0xbe,0x10,0x00,
+0x5f,0x60,0x09,0x00,0x41,0x1f,0xa0,0x04,0xfb,0x2d,0x00,0x42,0x07,0xf3,0x0d,0xd1,
+0x36,0x00,0xf1,0x01,0xe9,0x00,0x10,0x02,0x66,0x8f,0x50,0x00,0x00,0x20,0x00,0x00,
+0x02,0xff,0xea,0x10,0x48,0x00,0xf2,0x06,0x02,0x74,0x00,0x00,0xf5,0x00,0x00,0x00,
+0x47,0xae,0xfd,0x70,0x00,0x0f,0x50,0x00,0x00,0x09,0xb9,0xf7,0x00,0x13,0x00,0xf0,
+0x51,0x00,0x0f,0x60,0x00,0x86,0x0f,0x51,0xd2,0x00,0x00,0x00,0xf6,0x00,0x0d,0x70,
+0xf5,0x0c,0xa0,0x01,0xaa,0xaf,0xca,0xa1,0xf4,0x0f,0x50,0x4f,0x20,0x1a,0xac,0xfd,
+0xaa,0x5f,0x10,0xf5,0x00,0xe8,0x00,0x00,0x8f,0xc0,0x09,0xc0,0x0f,0x50,0x09,0xd0,
+0x00,0x0e,0xff,0x90,0xe7,0x00,0xf5,0x00,0x25,0x00,0x06,0xcf,0x8e,0x63,0x10,0x0f,
+0x50,0x38,0x00,0x00,0xe5,0xf6,0x6a,0x00,0x00,0xf5,0x0c,0xc0,0x00,0x8d,0x0f,0x60,
+0x00,0x00,0x0b,0x45,0xf3,0x00,0x2f,0x30,0xf6,0x00,0x00,0x00,0x05,0xf8,0x00,0x00,
+0x60,0x13,0x00,0x31,0x06,0xf9,0x00,0x5f,0x00,0x32,0x00,0x5d,0xf7,0x72,0x00,0x41,
+0x5a,0xef,0xa1,0x00,0x13,0x00,0x32,0x0a,0xb6,0x10,0x07,0x01,0x40,0x03,0x82,0x00,
+0xb4,0x08,0x00,0xf0,0x6c,0x37,0xbe,0xfc,0x50,0x3f,0x40,0x00,0x00,0x00,0x07,0xb8,
+0xf5,0x00,0x07,0xf6,0x55,0x55,0x55,0x00,0x00,0x0f,0x40,0x00,0xbf,0xff,0xff,0xff,
+0xe0,0x00,0x00,0xf4,0x00,0x2f,0x50,0x7e,0x00,0xc8,0x00,0x55,0x5f,0x95,0x4a,0xe0,
+0x07,0xe0,0x3f,0x20,0x0e,0xff,0xff,0xfd,0xf6,0x00,0x7e,0x01,0x40,0x00,0x00,0x6f,
+0x60,0x18,0x25,0x07,0xe0,0x62,0x00,0x00,0x0d,0xff,0x30,0x08,0xe0,0x7e,0x0b,0x90,
+0x00,0x05,0xcf,0x9e,0x20,0xc9,0x07,0xe0,0x6f,0x00,0x00,0xd4,0xf4,0x87,0x1f,0x40,
+0x7e,0x00,0xf5,0x00,0x8c,0x0f,0x40,0x09,0xe0,0x07,0xe0,0x0b,0x90,0x2f,0x20,0xf4,
+0x02,0xf8,0x00,0x7e,0x00,0x7e,0x00,0x40,0x0f,0x40,0x4d,0x00,0x07,0xe0,0x03,0xa0,
+0x5f,0x00,0x51,0x00,0x00,0x7e,0x00,0x00,0x72,0x00,0x51,0x05,0x6c,0xe0,0x00,0x00,
+0x13,0x00,0x21,0x7e,0xc6,0xa2,0x00,0xf0,0x27,0x05,0x80,0x00,0x03,0xd3,0x00,0x00,
+0x00,0x48,0xcf,0xfb,0x10,0x01,0xeb,0x11,0x10,0x00,0x07,0xb9,0xf2,0x00,0x02,0xdf,
+0xff,0xff,0xd0,0x00,0x00,0x2f,0x20,0x06,0xfa,0x21,0x15,0xf5,0x00,0x00,0x02,0xf2,
+0x07,0xf6,0x94,0x02,0xea,0x00,0x00,0x55,0x7f,0x75,0x21,0x08,0xf9,0xe9,0x00,0x03,
+0x02,0x31,0xf7,0x00,0x3d,0xf8,0x00,0x60,0xbf,0x50,0x27,0xcf,0x93,0xd5,0xde,0x01,
+0xe0,0xfe,0x24,0xc6,0x10,0xcf,0x44,0x42,0x00,0x07,0xdf,0x9d,0x10,0x01,0xcf,0xdb,
+0x00,0xf0,0x15,0xe6,0xf2,0xc3,0x04,0xec,0x10,0x01,0xe5,0x00,0x8c,0x3f,0x20,0x2b,
+0xf8,0x50,0x00,0xac,0x00,0x2f,0x42,0xf2,0x00,0x82,0x1c,0xd3,0xae,0x20,0x00,0x70,
+0x2f,0x20,0x00,0x00,0x0a,0xfd,0x20,0x5f,0x00,0x60,0x00,0x00,0x29,0xfb,0x10,0x00,
+0x72,0x00,0x31,0x37,0xbf,0xb3,0xdb,0x01,0x4c,0xf2,0x0c,0xc7,0x20,0x55,0x02,0x23,
+0x06,0x80,0x09,0x00,0x10,0x7f,0x1b,0x00,0xb1,0x25,0x55,0x55,0x56,0xfb,0x55,0x55,
+0x55,0x27,0xfe,0xee,0x01,0x00,0x22,0xf7,0x7e,0x1d,0x00,0xf0,0x0f,0x0e,0x77,0xe0,
+0x00,0x5b,0x10,0x0a,0x60,0x00,0xe7,0x6c,0x00,0x9f,0x80,0x00,0x7f,0xd5,0x06,0x30,
+0x07,0xee,0x40,0x00,0x00,0x19,0xfc,0x30,0x1e,0xf8,0x10,0x95,0x01,0x40,0xcf,0x20,
+0x54,0x55,0x01,0x00,0x41,0x53,0x30,0x00,0x7f,0xa6,0x02,0x10,0x90,0x38,0x00,0x23,
+0x3f,0x30,0xb4,0x01,0x13,0xf3,0x66,0x00,0x09,0x11,0x00,0xa3,0x02,0x44,0x44,0x44,
+0x7f,0x74,0x44,0x44,0x42,0x7f,0xda,0x02,0x18,0x80,0x9a,0x00,0x23,0x08,0xe0,0x09,
+0x00,0x11,0x02,0x13,0x01,0x13,0x6f,0x24,0x00,0xf0,0x10,0x70,0x6f,0x44,0x45,0x54,
+0x44,0x44,0x44,0x4f,0x70,0x6f,0x00,0x0a,0xd0,0x00,0xb8,0x00,0x0f,0x70,0x4a,0x02,
+0xce,0x20,0x00,0x4d,0xe5,0x08,0x40,0x01,0x9f,0xc1,0xca,0x00,0xa1,0xb1,0x00,0x08,
+0xe5,0x00,0x02,0xe3,0x58,0x03,0xd3,0x8e,0x01,0xf3,0x00,0xf1,0x2d,0xb0,0x00,0x00,
+0x11,0x11,0x11,0x18,0xf1,0x12,0xd4,0x11,0x10,0xcf,0x48,0x00,0x90,0xe0,0x33,0x33,
+0x33,0x5f,0xee,0x33,0x33,0x33,0x92,0x00,0x32,0x9e,0x2e,0x70,0x0e,0x01,0x31,0xf6,
+0x06,0xf6,0x09,0x00,0xf0,0x04,0x8f,0x90,0x00,0x7f,0x91,0x00,0x00,0x03,0x8e,0xf6,
+0x00,0x00,0x06,0xef,0x94,0x00,0x8f,0xe8,0x10,0x93,0x00,0x33,0xdf,0xd0,0x13,0x94,
+0x00,0x03,0x49,0x01,0x01,0x94,0x02,0xf0,0x00,0xb4,0x00,0x02,0x00,0x0f,0x60,0x02,
+0x10,0x00,0x09,0xd0,0x00,0xf5,0x00,0xf6,0x09,0x04,0xc2,0x2f,0x30,0x0f,0x50,0x0f,
+0x60,0x0e,0x60,0x08,0x88,0xa8,0x83,0x13,0x00,0xd0,0xbb,0xbb,0xbb,0x4f,0xfe,0xef,
+0xfe,0xef,0x60,0x00,0x20,0x03,0x30,0x2a,0x01,0x53,0x52,0x00,0x4d,0x00,0x9a,0x4e,
+0x00,0x31,0xf0,0x0b,0x8d,0x95,0x00,0xf0,0x09,0x00,0x0f,0x20,0xd5,0x22,0x22,0x5f,
+0x82,0x22,0x20,0x00,0xd4,0x0f,0x30,0x11,0x16,0xf3,0x11,0x10,0x00,0x0b,0x61,0xf0,
+0x3f,0x1c,0x00,0xf1,0x13,0xa0,0x00,0xa7,0x4c,0x03,0xf3,0x4e,0x25,0xe2,0xaa,0x00,
+0x06,0x57,0xa4,0x6f,0x12,0xe0,0x3e,0x09,0xa0,0x04,0x8b,0xff,0xf9,0xf1,0x2e,0x03,
+0xe0,0x9a,0x00,0xfe,0xa6,0x30,0x3f,0x13,0x00,0x40,0x01,0x00,0x00,0x03,0x13,0x00,
+0x11,0xaa,0x6f,0x01,0x57,0x12,0xc0,0x2b,0x9f,0x60,0x55,0x01,0x50,0x02,0xb2,0x00,
+0x00,0x0a,0x11,0x00,0xf1,0x25,0x09,0xe2,0x11,0x11,0x2f,0x71,0x11,0x11,0x00,0x2f,
+0xff,0xff,0xf9,0x9f,0xff,0xff,0xfe,0x00,0xdc,0x09,0xd0,0x04,0xf6,0x09,0xd0,0x00,
+0x0b,0xe2,0x03,0xf3,0x0e,0xc0,0x00,0xe6,0x00,0x03,0x55,0x55,0x75,0x57,0x75,0x55,
+0x75,0x20,0x00,0x6d,0xdd,0xdd,0xef,0xdd,0xdd,0xdf,0x24,0x01,0x74,0x4f,0x10,0x00,
+0x0e,0x70,0x00,0x0b,0x12,0x00,0xb0,0x0f,0x95,0x55,0x8f,0x65,0x55,0x55,0x20,0x00,
+0x1f,0x30,0x1b,0x00,0x00,0x21,0x00,0xf1,0x06,0xed,0xdd,0xef,0xed,0xdd,0xdd,0xd0,
+0x00,0x25,0x55,0x5d,0xff,0x65,0x55,0x5a,0xf0,0x00,0x00,0x00,0x9d,0x7f,0x1d,0x01,
+0xf0,0x04,0x00,0x1c,0xb0,0x4f,0x10,0x00,0x0c,0xb0,0x00,0x06,0xd6,0x00,0x4f,0x10,
+0x56,0x7f,0x70,0x02,0xc6,0x51,0x00,0x27,0x8d,0xda,0xa2,0x00,0x51,0x05,0xc0,0x00,
+0x00,0x0c,0xb3,0x00,0x80,0xdb,0x11,0x11,0x05,0xf4,0x11,0x11,0x10,0xfb,0x01,0xf1,
+0x11,0xf5,0xcf,0xff,0xff,0xfc,0x00,0x2f,0x81,0xe8,0x11,0x9f,0x32,0xea,0x11,0x10,
+0x0d,0xc0,0x07,0xe0,0x09,0x50,0x06,0xf2,0x00,0x00,0x41,0x00,0x15,0x09,0xf6,0x00,
+0x05,0x3b,0x00,0x32,0x09,0xfa,0xf8,0x44,0x00,0x50,0x3d,0xe3,0x04,0xee,0x60,0xee,
+0x00,0xf1,0x04,0xaf,0xe4,0x33,0x34,0xbf,0xe8,0x20,0x00,0x4b,0xfd,0xaf,0xff,0xff,
+0xff,0x99,0xff,0xb2,0x0c,0xd6,0x21,0x00,0x60,0x01,0x8a,0x00,0x10,0x04,0x44,0x01,
+0x00,0x00,0x0e,0x00,0x10,0xef,0x5f,0x01,0x10,0xf0,0xe7,0x02,0x00,0x35,0x00,0x10,
+0x5f,0x13,0x00,0x10,0xe6,0x8a,0x00,0x01,0x13,0x00,0x51,0x95,0x55,0x55,0x55,0x9f,
+0x26,0x00,0x00,0x11,0x03,0x10,0xe0,0x06,0x02,0x41,0x50,0x00,0x00,0x39,0x5e,0x01,
+0xf8,0x2d,0x84,0x44,0x40,0xce,0x44,0x44,0x43,0x01,0xdf,0xff,0xee,0xea,0xfe,0xff,
+0xee,0xea,0x0c,0xd1,0x2f,0x40,0x6f,0x60,0x1e,0x90,0x00,0x07,0x26,0x9d,0xb9,0xad,
+0x99,0x9b,0xc8,0x00,0x00,0x0a,0xc3,0x33,0x33,0x33,0x33,0xad,0x00,0x00,0x0a,0xfc,
+0xcc,0xcc,0xcc,0xcc,0xed,0x00,0x00,0x0a,0xc2,0x22,0x22,0x22,0x22,0x9d,0x12,0x00,
+0x50,0xc1,0x11,0x11,0x11,0x11,0x12,0x00,0xf0,0x00,0xeb,0xbb,0xbb,0xbb,0xbb,0xed,
+0x00,0x00,0x02,0x34,0xf7,0x33,0x33,0xea,0x33,0xaa,0x00,0x20,0xf4,0x00,0x55,0x05,
+0x13,0x0e,0xb6,0x02,0x50,0xfd,0x03,0x33,0x4e,0xc3,0x1b,0x00,0x51,0x33,0x00,0x28,
+0xec,0x10,0x1b,0x00,0x20,0x04,0xea,0x05,0x05,0x18,0xe8,0x3b,0x03,0x22,0x09,0x40,
+0x04,0x00,0xf1,0x20,0x00,0x5f,0x51,0x11,0x10,0x4f,0x51,0x11,0x11,0x00,0xcf,0xff,
+0xfe,0xe2,0xcf,0xff,0xfe,0xeb,0x07,0xf3,0x0b,0x90,0x06,0xf3,0x09,0xc0,0x00,0x09,
+0x50,0x02,0x80,0x5e,0x30,0x00,0x92,0x00,0x00,0xcc,0xcc,0xcc,0xdf,0xdc,0xcc,0xcc,
+0xc3,0x00,0xf8,0x11,0x01,0x51,0x46,0xf4,0x00,0xf5,0x11,0x01,0x00,0x32,0xf4,0x00,
+0x41,0x1a,0x01,0x10,0x41,0x2d,0x07,0x03,0x10,0x01,0x50,0xee,0xdd,0xdd,0xdd,0xde,
+0x09,0x00,0x10,0xe9,0x2d,0x00,0x01,0x7a,0x00,0x10,0x22,0x01,0x00,0x04,0x47,0x01,
+0x22,0xff,0x00,0x2d,0x00,0x24,0x00,0x6f,0x1b,0x00,0x17,0x7f,0x1b,0x00,0x50,0x08,
+0x60,0x00,0x00,0x3a,0x26,0x02,0xe1,0x04,0xf9,0x33,0x33,0x1b,0xe3,0x33,0x33,0x30,
+0x02,0xef,0xff,0xff,0xfb,0x1d,0x00,0xc0,0xdd,0x14,0xf2,0x08,0xd3,0x02,0xe7,0x00,
+0x00,0x03,0x10,0x2e,0xbc,0x01,0xf0,0x06,0x10,0x00,0x00,0x23,0x36,0xf3,0x33,0x24,
+0x77,0x77,0x77,0x20,0x0a,0xdd,0xef,0xdd,0xd8,0x9f,0xcc,0xcc,0xf4,0xdd,0x02,0xc0,
+0x00,0x09,0xc0,0x00,0x0f,0x40,0x05,0xfd,0xef,0xdd,0xf3,0x9c,0x77,0x05,0x51,0x5d,
+0x02,0xf0,0x0f,0x39,0x13,0x00,0x38,0xfe,0xef,0xee,0x13,0x00,0xc0,0x4a,0xbf,0x30,
+0x05,0xff,0xff,0xff,0xf3,0x9c,0x01,0x87,0x30,0x65,0x03,0x30,0x00,0x09,0xc0,0x67,
+0x06,0x00,0x47,0x01,0xf0,0x05,0x9c,0x00,0x00,0x0f,0x30,0x22,0x25,0xf2,0x22,0x28,
+0xe4,0x44,0x48,0xf0,0x00,0x00,0x2f,0x00,0x00,0x2d,0x7f,0x05,0x20,0x00,0x01,0x0f,
+0x04,0x10,0x41,0xc1,0x00,0x12,0x7c,0xf2,0x06,0xf1,0x00,0x00,0x05,0x07,0xc0,0x72,
+0x11,0x11,0xf7,0x11,0x11,0x00,0xb5,0x7c,0x0f,0x2e,0x8a,0x03,0xe2,0x06,0xb7,0xc4,
+0xd0,0x01,0x11,0xf7,0x11,0x10,0x00,0x2e,0x7c,0x97,0x06,0xb8,0x07,0x31,0x98,0xc8,
+0x10,0xb9,0x06,0xe2,0x01,0xaa,0xde,0x98,0x5d,0xdd,0xdf,0xed,0xdd,0xd1,0x19,0x9e,
+0xe9,0x81,0x1c,0x01,0xf1,0x12,0x01,0xff,0x20,0x03,0xcc,0xcc,0xcc,0xcb,0x00,0x00,
+0x6f,0xfc,0x00,0x3f,0x54,0x44,0x49,0xe0,0x00,0x0c,0xed,0xc7,0x03,0xf2,0x11,0x11,
+0x7e,0x00,0x03,0xf8,0xc4,0xf1,0x3f,0xb4,0x06,0xf0,0x19,0xc9,0x7c,0x05,0x03,0xf1,
+0x00,0x00,0x6e,0x00,0x3f,0x27,0xc0,0x00,0x3f,0xdd,0xdd,0xde,0xe0,0x00,0x50,0x7c,
+0x00,0x03,0xf3,0x22,0x22,0x8e,0x00,0x00,0x07,0xc0,0x00,0x3f,0x10,0x01,0x28,0xe0,
+0x00,0x00,0x7c,0x03,0x01,0x2b,0x5f,0xe8,0xc8,0x05,0x11,0x3f,0x91,0x04,0x00,0x51,
+0x05,0x10,0x64,0x97,0x01,0x03,0xd5,0x01,0x90,0xc1,0x00,0x01,0x11,0x11,0x5f,0x41,
+0x11,0x11,0xec,0x06,0x01,0x3c,0x08,0x06,0x2d,0x00,0x14,0x0d,0x4f,0x08,0x70,0x02,
+0x22,0x22,0x4d,0xf4,0x22,0x33,0xc4,0x01,0x50,0x28,0xf8,0x10,0x17,0xfa,0x53,0x07,
+0x41,0xff,0xfe,0xff,0xfe,0x42,0x03,0x50,0x43,0x4a,0xfd,0x60,0x0b,0x0a,0x00,0xf0,
+0x25,0x5b,0xfa,0x40,0x01,0x29,0xfa,0x00,0x00,0xbf,0xff,0xee,0xff,0xfe,0xdd,0xce,
+0xc0,0x00,0x66,0x59,0x52,0x1e,0x70,0x12,0x01,0x92,0x00,0x02,0xce,0x50,0x0e,0x70,
+0x6f,0xb4,0x00,0x05,0xbf,0x91,0x34,0x4e,0x70,0x00,0x7f,0xc3,0x05,0x92,0x00,0x6f,
+0xfc,0x20,0x00,0x01,0x92,0x52,0x05,0x10,0xe0,0x46,0x00,0x40,0x33,0x33,0x33,0x9f,
+0x6b,0x05,0x26,0xbf,0xff,0xe7,0x08,0x10,0x6f,0x8a,0x00,0x93,0x33,0x33,0x33,0x39,
+0xf3,0x33,0x33,0x33,0x1e,0x19,0x00,0xf0,0x12,0xf7,0xe6,0x00,0x00,0x9f,0x20,0x00,
+0x00,0x0e,0x7e,0x60,0x03,0xdb,0x10,0x06,0xe3,0x00,0xe7,0x42,0x3a,0xf8,0x34,0x5b,
+0xc4,0x00,0x04,0x20,0x0a,0xfe,0xce,0xfc,0x50,0x27,0x13,0x03,0xf4,0x2e,0x6b,0x93,
+0x00,0x01,0xbc,0x10,0x01,0x8c,0xff,0xbb,0xcd,0xef,0xff,0xee,0x20,0x0b,0xa8,0x76,
+0x55,0xf5,0x10,0x00,0x9d,0x00,0x00,0x4c,0x30,0x1f,0x30,0xb9,0x10,0x10,0x00,0x8f,
+0x70,0x01,0xf3,0x02,0xbf,0x70,0x06,0xed,0x40,0x44,0x6f,0x30,0x00,0x5e,0xd2,0x37,
+0x00,0x0a,0xfe,0xa0,0x00,0x00,0x17,0x00,0x00,0x00,0xb3,0xf8,0x06,0x31,0xf1,0x00,
+0x5f,0x08,0x0a,0xf1,0x06,0x0d,0x70,0x00,0x5f,0x77,0xaf,0x77,0xf7,0x00,0x6e,0x05,
+0xd0,0x5e,0x00,0x5e,0x00,0xe7,0x01,0xe5,0x0d,0x90,0x09,0x00,0x41,0x0b,0xd6,0x9e,
+0x10,0x09,0x00,0x41,0x1f,0xdc,0xf5,0x00,0x09,0x00,0xe0,0x00,0x0b,0xa3,0x70,0x5f,
+0x00,0x6e,0x00,0xe7,0x00,0x7d,0x02,0xf1,0x5f,0xaf,0x00,0xd1,0x04,0xf6,0x57,0xe6,
+0x5f,0x44,0x8f,0x44,0xe7,0x0f,0xfe,0xc9,0xaa,0x24,0x00,0x41,0x04,0x10,0x00,0x30,
+0x09,0x00,0x41,0x05,0x63,0x82,0xf0,0x09,0x00,0x41,0x09,0x83,0xd0,0xc5,0x09,0x00,
+0xd1,0x0c,0x51,0xf0,0x89,0x5f,0x55,0x9f,0x55,0xe7,0x0f,0x10,0xf1,0x36,0x3f,0x00,
+0xf1,0x01,0x2a,0x00,0x40,0x00,0x5e,0x00,0x00,0x00,0xb6,0x00,0x00,0xc4,0x00,0x00,
+0x1d,0x40,0x39,0x03,0x31,0x10,0x00,0x09,0xfb,0x06,0xf0,0x1d,0x0d,0x90,0x00,0x02,
+0xff,0xff,0xff,0xb0,0x00,0x06,0xe1,0x3d,0x11,0xdf,0x54,0x45,0xf7,0x00,0x01,0xe5,
+0x0c,0xc0,0xce,0xd9,0x00,0x9e,0x00,0x00,0xbe,0x69,0xf2,0x7f,0x33,0xf5,0x6f,0x40,
+0x00,0x0f,0xdc,0xf7,0x00,0x20,0x06,0xff,0x9b,0x05,0x60,0xbc,0x65,0x00,0x00,0x7f,
+0xf5,0x99,0x08,0xf0,0x24,0x16,0xc0,0x02,0xcf,0x67,0xf9,0x00,0x00,0x6f,0x86,0xaf,
+0x3a,0xfc,0x20,0x04,0xee,0x80,0x0f,0xfd,0xb8,0xe6,0xa5,0x0b,0x81,0x01,0x8c,0x00,
+0x30,0x00,0x07,0x20,0x00,0x4c,0xf7,0x00,0x00,0x04,0x83,0x93,0xd0,0x00,0x00,0x06,
+0xe2,0x00,0x00,0x8a,0x2e,0x0e,0x30,0x42,0x71,0x00,0x70,0x0b,0x70,0xf1,0xa7,0x0c,
+0xfd,0x72,0xcc,0x08,0xb0,0x0f,0x23,0x20,0x02,0x7d,0xfb,0x40,0x00,0x1c,0x00,0x50,
+0xae,0x07,0x24,0xbf,0x90,0x68,0x02,0x21,0x31,0x00,0xab,0x00,0x04,0x34,0x08,0x10,
+0x1f,0x41,0x02,0xf0,0x46,0x20,0x00,0x0e,0x90,0x00,0x4c,0xb4,0x44,0x4d,0xd0,0x00,
+0x07,0xf1,0x2e,0x30,0x5f,0x20,0x04,0xf5,0x00,0x01,0xf6,0x0b,0xd0,0x00,0xcc,0x02,
+0xeb,0x00,0x01,0xcf,0x79,0xf3,0x00,0x01,0xeb,0xdd,0x00,0x00,0x1f,0xed,0xf9,0x00,
+0x00,0x08,0xff,0x50,0x00,0x00,0x10,0xbc,0x47,0x00,0x4c,0xf9,0xbf,0xa3,0x00,0x00,
+0x7e,0x13,0xf4,0xef,0xa2,0x43,0x4c,0xfe,0x20,0x7f,0xa8,0xaf,0x66,0x10,0x0b,0xa0,
+0x02,0x50,0x0e,0xfc,0xa7,0xaa,0x00,0x00,0xba,0x00,0x97,0x0a,0x21,0x05,0x05,0x2d,
+0x02,0xf2,0x08,0x06,0x84,0xb1,0xf1,0x15,0x55,0xdc,0x55,0x51,0x00,0xa9,0x3f,0x0c,
+0x60,0x00,0x0b,0xa0,0x00,0x00,0x0c,0x61,0xf1,0x7a,0x26,0x00,0xd2,0xf3,0x0f,0x23,
+0x64,0x44,0x4d,0xb4,0x44,0x40,0x3f,0x00,0x92,0x02,0x67,0x04,0x07,0xe5,0x08,0x14,
+0xa3,0xe2,0x08,0x60,0x5f,0x20,0x00,0x00,0x5f,0x10,0x56,0x01,0xc1,0xa0,0x00,0x55,
+0x55,0xfa,0x55,0x54,0x00,0x05,0xf2,0x1a,0x3f,0x09,0x08,0x20,0x01,0xe7,0x2c,0x0b,
+0xf0,0x2c,0x80,0x12,0x00,0x00,0xbe,0x67,0xf4,0x00,0x0c,0xc0,0x08,0xd0,0x00,0x1f,
+0xed,0xfa,0x00,0x08,0xf2,0x00,0x1d,0xa0,0x00,0x10,0xad,0x47,0x0b,0xfe,0xcd,0xff,
+0xff,0x40,0x00,0x6f,0x23,0xf1,0xaa,0x86,0x43,0x10,0x9c,0x00,0x5f,0x86,0x8f,0x60,
+0x0b,0x30,0x68,0x00,0x00,0x0f,0xfe,0xc9,0xcb,0x01,0xf4,0x09,0xb0,0x16,0x01,0xd0,
+0x04,0x30,0x2f,0x30,0x9b,0x00,0x00,0x04,0x73,0x76,0xa0,0x05,0xf1,0x13,0x00,0xf0,
+0x16,0x89,0x4c,0x1f,0x00,0x9c,0x00,0x9b,0x00,0x91,0x0a,0x71,0xf0,0xc4,0x2f,0x80,
+0x09,0xb0,0x0f,0x20,0xe3,0x0f,0x12,0x3d,0xd0,0x00,0x9d,0x35,0xf1,0x1e,0x00,0x70,
+0x3f,0xc2,0x00,0x04,0xef,0xfa,0x9a,0x00,0x13,0x40,0x12,0x09,0x10,0xa1,0x78,0x03,
+0x10,0x20,0x2d,0x07,0x00,0x61,0x07,0x10,0xe5,0xfd,0x09,0xf0,0x5d,0x60,0x00,0xe7,
+0x77,0x0e,0x50,0xe6,0x00,0x07,0xd0,0x69,0x0e,0x74,0xe0,0xe5,0x5f,0x10,0x01,0xf5,
+0x0e,0x70,0xe7,0x0e,0x4e,0x5c,0x80,0x00,0xbd,0x59,0xd0,0x0e,0x70,0x85,0xe6,0xd0,
+0x00,0x1f,0xfe,0xf5,0x00,0xe7,0x66,0x6f,0x96,0x65,0x00,0x10,0xba,0x32,0x0e,0x7c,
+0xde,0xfe,0xdd,0xa0,0x00,0x6e,0x16,0xa0,0xe7,0x00,0xaf,0x90,0x00,0x00,0x3f,0x76,
+0xaf,0x0e,0x70,0x2f,0xff,0x70,0x00,0x0f,0xfe,0xb8,0xd4,0xe7,0x0a,0x8e,0x7f,0x50,
+0x00,0x41,0x00,0x04,0x1e,0x74,0xf1,0xe5,0x5f,0x30,0x01,0x91,0x85,0xa0,0xe9,0xe7,
+0x0e,0x50,0xa5,0x00,0x5c,0x1f,0x1f,0x0e,0x8a,0x72,0x00,0xf2,0x07,0x08,0x90,0xf1,
+0xc4,0xe7,0x00,0x0e,0x50,0x00,0x00,0xc5,0x0d,0x34,0x1e,0x94,0x44,0x55,0x44,0x40,
+0x0e,0x10,0x61,0xbe,0x05,0x16,0x10,0x55,0x01,0x10,0x03,0x0e,0x02,0x10,0x98,0x0a,
+0x00,0xb3,0xac,0x00,0x02,0x22,0x2b,0xb2,0x22,0x20,0x00,0x1f,0x50,0x7c,0x01,0x41,
+0x08,0xd0,0x5a,0x00,0xa2,0x01,0xe0,0x02,0xf4,0x0d,0x80,0x13,0x33,0xcb,0x33,0x31,
+0x00,0xcd,0x59,0xd0,0x07,0x1c,0x00,0x44,0x40,0x1e,0xcc,0xf4,0x43,0x00,0x21,0xb9,
+0x63,0xf1,0x0c,0xf1,0x47,0xd0,0x00,0x7c,0x07,0x90,0xf5,0x33,0x33,0x33,0x8d,0x00,
+0x5f,0x89,0xcf,0x1f,0x24,0x60,0x18,0x06,0xd0,0x0f,0xfb,0x85,0xd4,0x61,0x8c,0x02,
+0xf1,0x26,0x00,0x20,0x00,0x14,0x00,0x09,0xb0,0x2f,0x10,0x00,0x03,0xb3,0xa4,0xc0,
+0x00,0xc9,0x02,0xf1,0x00,0x00,0x6b,0x2e,0x0e,0x20,0x2f,0x40,0x2f,0x10,0x40,0x09,
+0x80,0xf0,0x97,0x0c,0xd0,0x02,0xf1,0x0c,0x50,0xe4,0x0f,0x22,0x3b,0xf3,0x00,0x2f,
+0x53,0xe3,0x1b,0x00,0x30,0x0b,0xe4,0x00,0x00,0xcf,0xfc,0xe2,0x07,0x02,0xe8,0x07,
+0x31,0x11,0x11,0x11,0x09,0x00,0x00,0xce,0x0d,0xf0,0x1a,0x5d,0xdd,0xdd,0xdd,0x20,
+0x4f,0x00,0xd4,0x00,0x07,0xf5,0x55,0x9e,0x00,0x4f,0xee,0xee,0xee,0x00,0xd6,0x00,
+0xd7,0x00,0x4f,0x00,0x00,0x3e,0x00,0x4f,0x39,0xc0,0x00,0x4f,0xcc,0xdd,0xde,0x00,
+0x07,0xfe,0x20,0x00,0x24,0x00,0x41,0x00,0x3c,0xef,0x91,0x36,0x00,0xf0,0x05,0x8c,
+0xf9,0x03,0xdf,0xa0,0x00,0x00,0x01,0x5b,0x15,0x10,0x00,0x05,0x50,0x00,0x00,0x4b,
+0xb3,0x01,0x8d,0x52,0x00,0x50,0x6e,0xfe,0xcd,0xde,0x81,0xc8,0x04,0xf1,0x25,0x24,
+0x48,0xcb,0x50,0x00,0xac,0x20,0x00,0x04,0x8c,0xfe,0xaa,0xbc,0xcd,0xef,0xf5,0x00,
+0x0a,0xa9,0x97,0x65,0xe9,0x22,0x20,0x4d,0x10,0x00,0x08,0xe3,0x00,0xd7,0x06,0xfa,
+0x30,0x00,0x29,0xea,0x11,0x11,0xe7,0x00,0x17,0xeb,0x20,0x17,0x20,0x08,0xff,0xd3,
+0x00,0x00,0x16,0xf3,0x03,0x90,0x02,0x22,0x22,0x22,0x10,0x00,0x00,0x3f,0x40,0xe6,
+0x02,0x51,0xfa,0x00,0x00,0x0b,0xb0,0xe6,0x0d,0xf1,0x01,0xa0,0x00,0x04,0xf2,0x0c,
+0x40,0x22,0x22,0x22,0xba,0x00,0x00,0xd7,0x08,0xf1,0x0e,0xfb,0x09,0x21,0xbf,0x67,
+0x98,0x0a,0x50,0xaa,0x00,0x1f,0xfd,0xfb,0xe6,0x05,0x72,0x4b,0xc4,0x00,0x10,0x8e,
+0x37,0x2f,0xb9,0x08,0x60,0x5f,0x20,0xf2,0x01,0x00,0xaa,0x3b,0x04,0xf0,0x33,0x96,
+0x8e,0x66,0xe2,0x0a,0xa0,0x0c,0xb0,0x0f,0xfd,0xa8,0xaa,0x08,0xe2,0xac,0x1c,0xa0,
+0x00,0x20,0x00,0x15,0x30,0x08,0x3c,0xff,0x70,0x00,0x05,0x94,0xb4,0xc0,0x00,0x5e,
+0xfc,0xe6,0x00,0x00,0x89,0x2e,0x0f,0x12,0xbe,0x5a,0xa3,0xf8,0x00,0x0b,0x60,0xf0,
+0xb8,0xfb,0x10,0xaa,0x03,0xde,0x10,0xf2,0x0f,0x20,0x03,0x02,0x3c,0xa0,0x00,0x50,
+0x18,0xd2,0x0a,0x21,0x7f,0xe5,0x3c,0x01,0x51,0xc3,0x00,0x00,0x00,0xc9,0xe7,0x03,
+0x50,0x10,0x00,0x00,0x2f,0x60,0x0d,0x09,0x11,0x80,0x35,0x05,0xf2,0x09,0xf3,0x00,
+0x06,0xe1,0x5d,0x16,0xf2,0x22,0x22,0x4f,0x30,0x01,0xe5,0x0d,0xb0,0x6f,0x11,0x11,
+0x13,0xf3,0x00,0xbe,0x6a,0xf1,0x0a,0x07,0xe1,0x1f,0xfe,0xf7,0x00,0x6e,0x00,0x00,
+0x02,0xf3,0x00,0x20,0xbb,0x53,0x06,0x26,0x00,0x42,0x00,0x8e,0x18,0xa0,0x39,0x00,
+0xf0,0x3d,0x8f,0x86,0xaf,0x00,0x00,0x06,0xf0,0x06,0x30,0x0e,0xeb,0x86,0xf4,0xdd,
+0xdd,0x7f,0x55,0xf5,0x00,0x10,0x00,0x36,0x14,0x4d,0xb6,0xfe,0xe3,0x00,0x06,0xa6,
+0xa7,0x90,0x05,0xf4,0x6e,0xc7,0x00,0x00,0x98,0x4c,0x2e,0x02,0xea,0x06,0xe3,0xf4,
+0x00,0x0c,0x63,0xe0,0x86,0xfb,0x00,0x6e,0x07,0xf7,0x01,0xf2,0x1d,0x00,0xb9,0x03,
+0x4a,0xe0,0x06,0xd0,0x17,0x00,0x00,0x00,0x00,0x9f,0xe7,0x00,0x00,0x00,0x15,0x00,
+0x01,0x00,0xf1,0x34,0x03,0xd1,0x00,0x00,0x01,0xf1,0x00,0x00,0x00,0x0a,0xc0,0x00,
+0x00,0x00,0xb7,0x00,0x00,0x00,0x1f,0x50,0x02,0xff,0xff,0xff,0xff,0xf4,0x00,0x7d,
+0x08,0xa2,0xf3,0x22,0x22,0x22,0xf4,0x01,0xf5,0x0e,0x62,0xf0,0x00,0x00,0x00,0xf4,
+0x0a,0xd3,0x8c,0x02,0xf4,0x33,0x33,0x34,0xf4,0x1f,0xff,0xf3,0x02,0xfe,0xdd,0xdd,
+0xdd,0xd4,0x02,0x1b,0x77,0x22,0xf0,0x48,0x00,0xf0,0x10,0x7b,0x09,0x82,0xfd,0xcc,
+0xcc,0xcc,0xcb,0x06,0xf9,0x9d,0xd3,0xff,0x44,0xe3,0xe4,0x5e,0x0e,0xeb,0x86,0xf5,
+0xff,0x11,0xd0,0xd1,0x1e,0x01,0x00,0x05,0x46,0xdf,0x09,0x00,0xe0,0x06,0x98,0x7c,
+0x48,0xbf,0xee,0xfe,0xfe,0xee,0x09,0x86,0x97,0x8a,0x9f,0x24,0x00,0x50,0x0b,0x64,
+0xb3,0xae,0x5f,0x1b,0x00,0xf6,0x03,0x0f,0x23,0xc0,0x4f,0x1f,0x11,0xd0,0xd1,0x2e,
+0x1a,0x00,0x00,0x16,0x0f,0x10,0x50,0x54,0xfb,0xa2,0x00,0x12,0x11,0x01,0x00,0x31,
+0x00,0xaf,0xff,0x01,0x00,0xf2,0x16,0xf0,0x0a,0xa0,0x05,0xf0,0x00,0xe5,0x00,0x6f,
+0x00,0xab,0x33,0x7f,0x33,0x3f,0x83,0x38,0xf0,0x08,0xcc,0xcc,0xcd,0xfc,0xcc,0xcc,
+0xcc,0x01,0x22,0x22,0x22,0x8f,0x22,0x22,0x22,0x21,0x9f,0xff,0x01,0x00,0x51,0x70,
+0x00,0x00,0x00,0xc8,0x44,0x00,0x11,0x4f,0x10,0x00,0x31,0x40,0x00,0x04,0xad,0x00,
+0x9f,0xf4,0x00,0x00,0x4f,0xdd,0xdd,0xdd,0xdd,0xdf,0x11,0x00,0x11,0x10,0x05,0x1d,
+0x01,0x43,0x01,0xf5,0x00,0xcf,0x55,0x00,0x32,0xe0,0x00,0x01,0x91,0x00,0x34,0x10,
+0x00,0xcf,0x12,0x00,0xf3,0x04,0xc9,0x00,0x6e,0x00,0x0f,0x50,0x07,0xe0,0x00,0xc9,
+0x11,0x7e,0x11,0x1f,0x61,0x18,0xe0,0x00,0xbf,0x1b,0x00,0x00,0x4d,0x00,0x70,0xb9,
+0x00,0x00,0x03,0x20,0x00,0x0f,0x10,0x00,0xf3,0x07,0xfd,0x7f,0x60,0x00,0x02,0x22,
+0x22,0xca,0x22,0x4d,0xf4,0x00,0x03,0x33,0x33,0x33,0xcb,0x36,0xef,0x63,0x33,0x0d,
+0x5a,0x00,0x70,0xfe,0x00,0x00,0x00,0x39,0xed,0x71,0x33,0x00,0x21,0x15,0x9e,0x12,
+0x00,0xe0,0x20,0x0d,0xfd,0x9f,0x71,0x11,0x11,0x11,0x4f,0x20,0x03,0x10,0x0e,0xed,
+0x90,0x00,0x90,0x20,0x00,0x00,0x0e,0x82,0x22,0x22,0x22,0x4f,0x09,0x00,0x01,0x1b,
+0x00,0x00,0x09,0x00,0x02,0x2d,0x00,0x00,0x39,0x00,0x14,0xd6,0x36,0x01,0xf3,0x07,
+0xe7,0x00,0x00,0x08,0xb0,0x00,0x0a,0xdd,0xdd,0xfe,0xdd,0xd7,0x7f,0x30,0x00,0x03,
+0x44,0x44,0xf9,0x44,0x49,0xf5,0x1b,0x00,0xd7,0x8f,0x50,0x00,0x01,0x44,0x44,0x44,
+0xf9,0x4a,0xf9,0x44,0x43,0x06,0x7e,0x00,0x32,0x01,0x9f,0x90,0x3e,0x00,0x92,0x6e,
+0xf7,0x22,0x22,0x22,0x00,0x00,0x00,0x6d,0x5a,0x00,0x41,0x02,0x8f,0xf8,0xae,0x18,
+0x00,0xc0,0x0c,0xe7,0x10,0xf8,0x22,0x22,0x22,0x20,0x00,0x02,0x00,0x07,0x1a,0x00,
+0x13,0xf2,0x6e,0x00,0x23,0x08,0xf0,0x09,0x00,0x21,0x0b,0xb0,0x07,0x00,0x41,0x34,
+0x33,0x6f,0x60,0x09,0x00,0x4f,0x6f,0xff,0xfa,0x00,0x01,0x00,0x03,0x54,0x06,0xf0,
+0x00,0x00,0x01,0x09,0x00,0xb2,0x0c,0xb0,0x00,0x14,0x44,0x49,0xf4,0x44,0x43,0x9e,
+0x20,0xac,0x01,0x23,0xfe,0xf3,0x1b,0x00,0x22,0x8e,0x30,0x09,0x00,0x23,0x2c,0xd2,
+0xe8,0x00,0x00,0x46,0x01,0xe2,0x04,0x55,0x55,0x57,0xef,0x85,0x55,0x55,0x54,0x00,
+0x00,0x00,0x7f,0xe4,0x50,0x00,0x60,0x4d,0xff,0x75,0x55,0x55,0x53,0xb3,0x00,0x00,
+0x29,0x01,0x50,0xf8,0x00,0x1e,0xfc,0x5f,0x83,0x00,0xe1,0xe8,0x00,0x05,0x20,0x0f,
+0x94,0x44,0x44,0x44,0xe8,0x00,0x00,0x00,0x0f,0x1b,0x00,0x00,0x09,0x00,0x01,0x1b,
+0x00,0x00,0x09,0x00,0x41,0x83,0x33,0x33,0x33,0x09,0x00,0x00,0x59,0x00,0x10,0xf8,
+0x49,0x00,0x30,0xc6,0x00,0x6c,0x0b,0x01,0xf1,0x02,0x22,0x22,0xe7,0x00,0x7e,0x00,
+0x4b,0x90,0x0a,0xff,0xff,0xf7,0x00,0x7f,0xae,0xfa,0x40,0x3a,0x01,0x21,0x7f,0x84,
+0x35,0x03,0x00,0x1b,0x00,0xf0,0x10,0x00,0x56,0x08,0xbd,0xfe,0xf7,0x00,0x7f,0x42,
+0x23,0xbc,0x0a,0x84,0x10,0xe7,0x00,0x2e,0xff,0xff,0xf5,0x00,0x00,0x22,0x54,0x22,
+0x22,0x23,0x31,0x00,0x00,0x03,0xaa,0x00,0x00,0x11,0x00,0x22,0x03,0xf3,0x40,0x02,
+0x20,0x00,0x03,0x20,0x03,0x10,0xcd,0x09,0x00,0x59,0xf6,0x33,0x33,0x33,0x34,0x1b,
+0x00,0x05,0x2d,0x00,0x53,0xf4,0x11,0x11,0x11,0x12,0x1b,0x00,0x23,0x03,0x35,0x09,
+0x00,0x3f,0x0a,0xff,0xc1,0x42,0x01,0x01,0x50,0x4d,0x20,0x00,0x06,0xd0,0x09,0x00,
+0xf0,0x0a,0xcc,0x1a,0x20,0x07,0xe0,0x00,0x23,0x00,0x05,0xf3,0x0b,0xc0,0x07,0xe0,
+0x4b,0xfc,0x00,0x3e,0x80,0x14,0xf7,0x07,0xfe,0xe9,0x30,0x87,0x02,0x30,0xef,0x17,
+0xf4,0x91,0x01,0xf0,0x06,0x31,0x00,0x1a,0x27,0xe0,0x00,0x03,0xc0,0x03,0x33,0x33,
+0x31,0x06,0xf0,0x00,0x06,0xe0,0x0f,0xff,0xff,0xf7,0x78,0x00,0xf2,0x01,0x90,0x0f,
+0x40,0x00,0xe7,0x03,0x94,0x55,0x54,0x00,0x0f,0x62,0x22,0xe7,0x07,0xe0,0x0c,0x01,
+0x60,0xf7,0x07,0xe0,0x00,0x5a,0x00,0x1b,0x00,0xf1,0x08,0x07,0xe1,0x7d,0xf9,0x10,
+0x0f,0x74,0x44,0xf7,0x07,0xff,0xc7,0x10,0x00,0x0f,0xdc,0xcc,0xf7,0x07,0xf2,0x00,
+0x00,0x10,0x1b,0x00,0xf1,0x0b,0xe0,0x00,0x01,0xf2,0x0f,0x40,0x45,0xf7,0x06,0xf7,
+0x66,0x6a,0xf0,0x0f,0x40,0xcf,0xc2,0x00,0xad,0xdd,0xdc,0x60,0x00,0x00,0x07,0xc0,
+0xa1,0x00,0x10,0x0d,0x0d,0x02,0x81,0x44,0x44,0x5f,0x94,0x44,0x44,0x40,0xef,0xe3,
+0x00,0x21,0xf1,0xe8,0xce,0x01,0x22,0xf1,0xe7,0x07,0x00,0x73,0xe8,0x22,0x22,0x22,
+0x22,0x27,0xf1,0x1c,0x00,0x10,0xe9,0x0e,0x00,0x15,0x28,0x1c,0x00,0x02,0x07,0x00,
+0x03,0x1c,0x00,0x64,0xea,0x44,0x44,0x44,0x44,0x48,0x1c,0x00,0x1a,0xe7,0x1c,0x00,
+0x67,0x55,0x55,0x55,0x55,0x59,0xe1,0x1a,0x01,0x23,0x04,0xf2,0x3a,0x04,0x73,0x2f,
+0x81,0x11,0x11,0x00,0x00,0x8f,0x8c,0x03,0x20,0x08,0xe2,0x62,0x00,0x40,0x9e,0x00,
+0x00,0x8e,0x1e,0x00,0x50,0x07,0xe0,0x00,0x08,0xfd,0xe5,0x03,0x40,0xee,0x00,0x00,
+0x8f,0x5f,0x00,0x40,0x4a,0xe0,0x00,0x08,0xb1,0x03,0x00,0xdc,0x01,0x94,0x8f,0x33,
+0x33,0x33,0x33,0x39,0xe0,0x00,0x08,0x1c,0x03,0x70,0x8e,0x00,0x0d,0xa0,0x00,0x00,
+0x56,0x22,0x00,0x50,0x3f,0x50,0x00,0x9f,0xa0,0x44,0x00,0x41,0x8f,0x54,0xde,0x40,
+0x33,0x00,0x30,0x8f,0xf9,0x00,0x22,0x00,0xf1,0x0a,0x15,0x40,0x7f,0xd4,0x00,0x00,
+0x0b,0xf9,0xdf,0xf8,0x00,0x2c,0xfc,0x72,0x03,0xff,0xd9,0x40,0x00,0x00,0x04,0xaf,
+0xe0,0x05,0x10,0x8e,0x00,0x01,0xed,0x02,0x14,0xa7,0xa3,0x00,0x41,0x5f,0x73,0x33,
+0x32,0x09,0x00,0x10,0x2e,0xc3,0x00,0x00,0x09,0x00,0x51,0x1d,0xc0,0x00,0x03,0xf7,
+0x09,0x00,0x40,0xe1,0x00,0x01,0xeb,0x09,0x00,0xd0,0x3d,0xfa,0x66,0x66,0xcf,0x86,
+0x66,0x60,0x00,0x2f,0xef,0xed,0xdd,0x03,0x00,0xf0,0x05,0x10,0x00,0x81,0xe7,0x00,
+0x02,0xf2,0x00,0x04,0xf1,0x00,0x00,0x0e,0x70,0x00,0x2f,0x20,0x00,0x4f,0x10,0x96,
+0x02,0x22,0x03,0xf3,0x13,0x00,0x02,0x1f,0x03,0x40,0x10,0x00,0x00,0xe9,0xd0,0x00,
+0x12,0x47,0x26,0x00,0x00,0x4f,0x04,0x02,0x11,0x04,0x00,0x35,0x01,0x13,0xb0,0x13,
+0x00,0xf1,0x00,0x00,0x9d,0x00,0x00,0xbe,0x65,0x44,0x44,0x44,0x45,0x7f,0x80,0x00,
+0x02,0xae,0xe6,0x00,0x01,0xfd,0x03,0x11,0x10,0x03,0x00,0x00,0xbb,0x03,0xf1,0x13,
+0x00,0x00,0x0f,0x50,0x00,0x00,0x0e,0xee,0xef,0xfe,0xee,0xee,0xff,0xee,0xee,0x00,
+0x44,0x44,0x9f,0x44,0x44,0x5f,0x87,0x84,0x40,0x00,0x00,0x05,0xc0,0x00,0x00,0x51,
+0x4f,0x50,0xc4,0x04,0x72,0x33,0x3f,0x73,0x89,0x10,0x00,0xdf,0x7c,0x00,0x30,0xf7,
+0x00,0x0d,0x5f,0x00,0x10,0x0e,0x60,0x03,0xf0,0x2f,0xd7,0x7d,0xdd,0xdd,0xd2,0xc7,
+0x07,0x70,0x00,0x0d,0x79,0x81,0x8a,0x11,0x0a,0x90,0xe7,0x00,0x00,0xd7,0x99,0x18,
+0xa1,0x10,0x9a,0x5f,0x10,0x00,0x0f,0x59,0xec,0xcc,0xcf,0x06,0xdb,0xb0,0x00,0x00,
+0xf4,0x98,0x00,0x01,0xf0,0x3f,0xf3,0x00,0x00,0x1f,0x39,0xfe,0xee,0xff,0x01,0xfa,
+0x00,0x00,0x04,0xf1,0x98,0x07,0x90,0x00,0x8b,0x04,0xf0,0x04,0x8c,0x09,0xdb,0xde,
+0xbb,0x8f,0x9f,0x20,0xc3,0x1f,0x60,0x24,0x44,0x47,0xee,0x30,0xcd,0x7f,0x30,0xa4,
+0x00,0x58,0x3a,0x10,0x01,0xbf,0xa0,0x4b,0x04,0x14,0xe2,0xf8,0x01,0x31,0xf8,0x00,
+0xbf,0xc7,0x03,0xa4,0x05,0xfa,0x00,0x04,0x66,0x66,0x66,0x66,0x30,0x07,0x7f,0x04,
+0x42,0x01,0xe9,0x00,0x69,0x0a,0x00,0x43,0x02,0x00,0x3f,0x90,0x15,0x00,0x30,0x1e,
+0xd0,0x36,0x26,0x00,0x52,0x60,0x00,0x0c,0xf3,0x08,0x3b,0x01,0x20,0x1d,0xff,0xfd,
+0x00,0x72,0x3f,0x30,0x00,0x2e,0xf9,0xf1,0x00,0x7e,0x03,0x23,0xb2,0x4f,0x13,0x00,
+0x01,0x64,0x01,0x02,0xb5,0x03,0x0f,0x13,0x00,0x0d,0x32,0x47,0x79,0xf2,0x13,0x00,
+0x39,0x05,0xee,0xc8,0xb4,0x03,0x51,0xba,0x13,0x46,0x8a,0xd7,0x5e,0x01,0xa0,0x38,
+0xed,0xde,0x75,0x29,0xff,0xfb,0x00,0x4f,0x70,0x95,0x01,0xf0,0x07,0x24,0x44,0x30,
+0x2f,0x90,0x2a,0xdd,0xef,0xdd,0xd4,0x00,0x00,0x00,0x80,0x4f,0x54,0x49,0xc4,0x44,
+0x10,0x00,0x00,0x74,0x02,0x12,0x6b,0xe3,0x00,0xf0,0x0e,0xf4,0x6f,0xef,0xfe,0xfb,
+0xbd,0xdd,0xd1,0x03,0xff,0x26,0x90,0x6b,0x05,0xb5,0x6e,0xa6,0x02,0xee,0xf2,0x6f,
+0xde,0xfd,0xeb,0x00,0xe6,0x00,0x5d,0x3f,0x13,0x00,0x60,0xb0,0x0e,0x60,0x00,0x02,
+0xf2,0x26,0x00,0x60,0x00,0xe6,0x00,0x00,0x2f,0x20,0x39,0x00,0x01,0x13,0x00,0x41,
+0x5c,0xcd,0xec,0xc9,0x13,0x00,0x51,0x22,0x44,0x9c,0x44,0x30,0x13,0x00,0x41,0x00,
+0x07,0xc3,0x46,0x13,0x00,0x60,0x2d,0xff,0xfe,0xcb,0x94,0x4f,0x13,0x00,0x6b,0x33,
+0x10,0x00,0x00,0xbf,0xd2,0x62,0x04,0x12,0x6d,0x23,0x08,0x93,0x33,0x33,0x39,0xf3,
+0x33,0x33,0x33,0x00,0x02,0x80,0x05,0x11,0xd0,0x3f,0x03,0x14,0xf0,0x1d,0x00,0x10,
+0x9f,0x1c,0x00,0x03,0xc4,0x04,0x12,0xff,0x16,0x00,0x31,0x7f,0x00,0x00,0xfb,0x03,
+0x00,0xd4,0x05,0xc0,0x44,0x44,0x20,0x0d,0xee,0xee,0xef,0xff,0xfe,0xee,0xee,0xe6,
+0xca,0x00,0x40,0xf8,0x9c,0x00,0x00,0xac,0x06,0xf0,0x0d,0x1b,0xf6,0x01,0xf4,0x00,
+0x4e,0x90,0x00,0x02,0x9f,0xf4,0x00,0x09,0xe1,0x7f,0x80,0x00,0x2b,0xfe,0xaf,0x20,
+0x00,0x0d,0xee,0x40,0x00,0x00,0xa5,0xc1,0x03,0x21,0x2f,0xb1,0xba,0x07,0x50,0x20,
+0x16,0x90,0x3e,0xe4,0x38,0x00,0xb0,0xf9,0xcf,0xe9,0x00,0x1c,0xfd,0x60,0x00,0x00,
+0xdf,0xe9,0x66,0x01,0x56,0xb8,0x00,0x00,0x05,0x40,0xab,0x00,0x14,0x9b,0x2c,0x08,
+0x20,0x16,0xf6,0x2d,0x08,0x04,0x54,0x07,0x18,0xf6,0xcf,0x00,0x10,0x55,0x01,0x00,
+0xe0,0x50,0x00,0x00,0x00,0x2f,0xdc,0xcc,0xcc,0xcc,0xdf,0x00,0x00,0x02,0x24,0x1c,
+0x05,0x53,0x07,0xf2,0x21,0x00,0xff,0x01,0x00,0x12,0x90,0xcd,0x01,0x24,0x06,0xf0,
+0x26,0x00,0x11,0xef,0x39,0x00,0x51,0x5e,0xf9,0xf7,0x55,0x52,0x74,0x05,0xf0,0x12,
+0xd2,0x0d,0xc0,0x05,0xf8,0x00,0x00,0x04,0xbf,0xc0,0x00,0x4f,0x8a,0xe5,0x00,0x01,
+0x8e,0xfa,0xd9,0x00,0x00,0x7f,0xd1,0x00,0x00,0x1b,0x71,0x0c,0x90,0x04,0x71,0x8f,
+0xb2,0x26,0x00,0xf8,0x01,0xee,0xdf,0xfb,0x20,0x4e,0xfc,0x60,0x00,0x00,0x3f,0xb7,
+0x30,0x00,0x00,0x05,0xb8,0x85,0x00,0x50,0x0b,0x70,0x00,0x02,0xe3,0xea,0x07,0x00,
+0x9b,0x08,0xf1,0x02,0x2f,0x30,0x00,0x00,0x02,0xcd,0x1c,0x83,0x44,0x46,0xf7,0x44,
+0x43,0x00,0x00,0xb3,0xc8,0xe5,0x08,0x81,0xa0,0x00,0x00,0x0d,0x80,0x00,0x02,0xf3,
+0x83,0x01,0x12,0xf8,0x26,0x00,0x71,0x08,0xee,0x7d,0x80,0x00,0x02,0xf4,0xa0,0x06,
+0x20,0xc8,0x1f,0x26,0x00,0xa1,0x50,0x00,0x00,0x0c,0x80,0x59,0x33,0x33,0x33,0x31,
+0xfb,0x02,0x20,0xf4,0x00,0x78,0x03,0x05,0xcd,0x07,0xf0,0x15,0x33,0x33,0x35,0xed,
+0x8f,0x43,0x33,0x64,0x30,0x00,0x00,0x29,0xf9,0x00,0xcc,0x00,0x8f,0x70,0x00,0x48,
+0xdf,0xf6,0x00,0x02,0xeb,0xea,0x10,0x00,0x0b,0xa5,0x1f,0x50,0x00,0x22,0xee,0x40,
+0x0d,0x03,0xc0,0xf9,0x8c,0xfe,0x01,0x9f,0xc6,0x10,0x00,0x00,0xdf,0xea,0x63,0x7f,
+0x08,0x53,0x00,0x00,0x03,0x10,0x00,0x08,0x04,0x33,0x01,0x10,0x00,0x35,0x04,0x10,
+0xa8,0x37,0x03,0xf0,0x0c,0x5d,0x00,0x00,0xce,0xbe,0xeb,0xba,0x00,0xf4,0x05,0xe0,
+0x00,0x5e,0x33,0xba,0x33,0x30,0x0f,0x40,0x5e,0x00,0x05,0x82,0x2b,0xa2,0x22,0x10,
+0x13,0x00,0x50,0xdd,0xdd,0xff,0xdd,0xd7,0x13,0x00,0x51,0x00,0x22,0x2b,0x92,0x22,
+0x26,0x00,0x51,0x0f,0xdc,0xfe,0xcd,0xf1,0x13,0x00,0x60,0xf2,0x0a,0x80,0x1f,0x10,
+0x51,0x13,0x00,0xf0,0x07,0x20,0xa8,0x5e,0xe0,0x00,0x89,0xdd,0x00,0x00,0x20,0x06,
+0x50,0x3f,0x40,0x04,0x76,0x10,0x00,0xbd,0xdd,0xdd,0xdd,0x4e,0x0a,0xf1,0x16,0xc0,
+0x05,0x55,0x55,0x7e,0xfb,0xf6,0x55,0x58,0x85,0x00,0x00,0x03,0x9f,0xb2,0x0c,0xb0,
+0x08,0xf7,0x00,0x05,0xae,0xff,0x50,0x00,0x2e,0xbe,0xa2,0x00,0x00,0x99,0x43,0xf2,
+0x00,0x22,0x2d,0xe5,0x3c,0x03,0xf4,0x01,0xab,0xfe,0x60,0x18,0xfd,0x94,0x00,0x00,
+0x0c,0xea,0x62,0x00,0x00,0x01,0x7b,0xb0,0xb3,0x04,0x09,0x01,0x00,0x52,0xc6,0x00,
+0x00,0x5f,0x30,0x29,0x06,0x31,0x00,0x0c,0xe3,0xa4,0x02,0x31,0x0b,0x20,0x05,0xb6,
+0x08,0x51,0x0a,0xcc,0xcc,0xa2,0xeb,0x25,0x00,0x40,0x78,0x88,0xcc,0xcf,0xe7,0x01,
+0xf0,0x14,0x10,0x00,0x00,0x0e,0x46,0xbf,0x33,0x33,0x36,0xf2,0x00,0x00,0x08,0xd0,
+0x05,0xf1,0x11,0x11,0x5f,0x20,0x00,0x03,0xf5,0x34,0x5f,0xcc,0xcc,0xcd,0xf2,0x00,
+0x01,0xdf,0x4e,0x55,0xf0,0x8c,0x02,0xf0,0x01,0x00,0xbf,0xff,0x60,0x5e,0xef,0xfe,
+0xee,0xe2,0x00,0xbf,0x9e,0x9c,0x00,0x09,0xe1,0xa3,0x03,0x41,0x44,0xe0,0xd5,0x08,
+0x5f,0x06,0xf0,0x01,0x10,0x4e,0x01,0x1a,0xfe,0x31,0x15,0xf6,0x00,0x00,0x04,0xe0,
+0x0d,0xc3,0x9d,0x36,0xcd,0x05,0x70,0x4e,0x00,0x10,0x00,0xcf,0xf7,0x00,0x13,0x00,
+0xfe,0x01,0x03,0x6a,0xfd,0x7a,0xfc,0x74,0x10,0x00,0x4e,0x03,0xfb,0x83,0x00,0x02,
+0x7b,0xe2,0xb2,0x00,0x13,0x09,0xbe,0x01,0xf2,0x04,0xf9,0x12,0x22,0x29,0xe2,0x24,
+0xf6,0x22,0x22,0x10,0x23,0x33,0x9e,0x33,0x4f,0x63,0x33,0x20,0x0a,0x19,0x00,0xf0,
+0x14,0xfc,0x00,0xaa,0x00,0x7d,0x00,0x1f,0x40,0x08,0xc0,0x0a,0xa0,0x07,0xd0,0x01,
+0xf4,0x00,0x8c,0x00,0xac,0x44,0xae,0x44,0x5f,0x74,0x4a,0xc0,0x09,0xee,0xee,0xfe,
+0xee,0xee,0xee,0xeb,0xb8,0x02,0x01,0xe1,0x05,0x40,0xcd,0xdd,0xdf,0xfe,0xde,0x06,
+0xf1,0x08,0xc5,0x55,0x5d,0xf6,0x55,0x55,0xaf,0x65,0x55,0x00,0x05,0xf5,0x00,0x00,
+0x2f,0x90,0x00,0x00,0x01,0xff,0xc9,0x52,0x5f,0xa8,0x09,0xf3,0x0b,0x36,0xaf,0xff,
+0xf6,0x10,0x00,0x00,0x24,0x58,0xcf,0xfa,0x6a,0xff,0xd8,0x20,0x9f,0xfe,0xb8,0x40,
+0x00,0x00,0x49,0xee,0x21,0x20,0x00,0x03,0x02,0x33,0x01,0x33,0x33,0x61,0x02,0x14,
+0x7f,0x52,0x0b,0x23,0x07,0xe0,0x5f,0x0a,0x00,0x27,0x07,0x02,0x61,0x06,0x12,0x07,
+0xfb,0x05,0x00,0x13,0x00,0x00,0x61,0x07,0x19,0x2e,0x26,0x00,0x06,0x39,0x00,0x10,
+0xf3,0x4c,0x00,0x19,0xf7,0x39,0x00,0x00,0xb3,0x00,0x10,0xee,0x13,0x00,0x80,0x24,
+0x5f,0xa4,0x48,0xf6,0x44,0x20,0x00,0x03,0x09,0x22,0x00,0x4f,0x80,0x00,0x10,0xbe,
+0xc8,0x07,0x60,0x01,0xb1,0x00,0x00,0x9f,0x50,0x13,0x00,0xf8,0x05,0x3f,0x10,0x38,
+0xef,0x60,0x00,0x03,0xf8,0x55,0x5a,0xe0,0x0c,0xe9,0x20,0x00,0x00,0x0b,0xff,0xff,
+0xe6,0x3e,0x01,0x31,0x93,0x00,0x02,0x9b,0x0a,0x00,0xb6,0x06,0x12,0xef,0x10,0x0b,
+0x10,0xf5,0x24,0x0b,0xf1,0x02,0x14,0xf2,0x00,0x8b,0xbf,0xdb,0xb0,0xe6,0x00,0x00,
+0x3f,0x20,0x05,0x88,0xfb,0x88,0x0e,0xb8,0x0a,0x00,0x26,0x00,0x42,0xe7,0x22,0x22,
+0x5f,0x26,0x00,0x01,0x15,0x05,0x90,0x55,0x5f,0x85,0x51,0xef,0xee,0xee,0xef,0x20,
+0x5f,0x03,0x21,0x5e,0x83,0x0c,0x02,0x23,0x1f,0x30,0x4e,0x05,0x33,0x04,0xf9,0x00,
+0x39,0x00,0xf0,0x0a,0x7e,0xe7,0x00,0x47,0xf6,0x9f,0x44,0x00,0x00,0x0c,0x84,0xf5,
+0x00,0x5f,0x06,0xe0,0x00,0x00,0x03,0xf2,0x07,0xf2,0x0c,0xb0,0x6e,0x8a,0x09,0xf3,
+0x0b,0x00,0x06,0x06,0xf3,0x06,0xe0,0x08,0x10,0xaf,0x20,0x00,0x18,0xf7,0x00,0x5f,
+0x44,0xf3,0x0b,0x50,0x00,0x0d,0xd5,0x00,0x02,0xef,0xfc,0x54,0x03,0x01,0x91,0x02,
+0x14,0x60,0xb4,0x00,0x33,0x6f,0x40,0x00,0xbb,0x0b,0x40,0xaa,0x00,0x0f,0x51,0xab,
+0x00,0x50,0x9a,0xab,0xaa,0x50,0xf4,0xab,0x00,0x53,0x09,0xaa,0xaa,0xf8,0x0f,0x63,
+0x0b,0x32,0x7f,0x10,0xf5,0xea,0x0b,0x40,0x2f,0x60,0x0f,0x40,0xab,0x00,0x33,0x00,
+0x1d,0xb0,0x39,0x00,0x32,0x1d,0xfe,0x20,0x39,0x00,0x50,0x2d,0xff,0xce,0x20,0xf4,
+0xab,0x00,0x42,0x3f,0xc4,0xf3,0xbd,0x39,0x00,0x91,0x80,0x2f,0x30,0x30,0x27,0xe2,
+0x8e,0x22,0x00,0x4c,0x04,0x10,0x8b,0xab,0x00,0x00,0x4c,0x04,0x50,0x0e,0x70,0x6e,
+0x00,0x30,0x13,0x00,0xf8,0x09,0x09,0xe0,0x06,0xe0,0x0e,0x40,0x00,0x2f,0x30,0x4b,
+0xf3,0x00,0x6f,0x55,0xf2,0x00,0x02,0xf3,0x1d,0x92,0x00,0x02,0xde,0xea,0x5b,0x07,
+0x14,0x90,0x0a,0x00,0xf1,0x15,0xda,0x22,0x10,0x4e,0xee,0xee,0xee,0x80,0x00,0x3f,
+0xff,0xff,0x01,0x44,0xda,0x44,0xc8,0x00,0x09,0xc0,0x0b,0x90,0x00,0x0f,0x40,0x0c,
+0x70,0x03,0xf6,0x13,0xf4,0x10,0x07,0xd0,0x00,0xe6,0x06,0x08,0xf0,0x06,0x05,0xe3,
+0x14,0x5f,0x30,0x1a,0xf5,0x0f,0x04,0xf5,0xc3,0x03,0xfe,0x90,0x00,0x0d,0x50,0xf0,
+0x3f,0x00,0xf3,0x1d,0x01,0xe1,0xdf,0xef,0xee,0xf0,0x4f,0x16,0xe0,0x00,0x00,0x0e,
+0x95,0xf5,0x8f,0x09,0xe8,0x04,0xf0,0x00,0xe5,0x0f,0x03,0xf1,0xf7,0x49,0xf4,0x42,
+0x00,0x0f,0x50,0xf1,0x4f,0x6d,0x00,0x26,0x00,0x00,0x0f,0x09,0xa0,0x54,0x49,0xf4,
+0x44,0x00,0x2f,0x31,0xf2,0x5f,0x4f,0xc8,0x00,0x60,0x06,0xd0,0x0f,0x03,0xf0,0x00,
+0xbe,0x00,0x50,0xb8,0x00,0xf3,0x6f,0x00,0x26,0x00,0x51,0x1e,0x10,0x07,0xaf,0x90,
+0x13,0x00,0x08,0x01,0x00,0x24,0x0a,0x80,0x57,0x01,0x13,0x50,0x09,0x00,0x17,0xcd,
+0x14,0x05,0x23,0xff,0x22,0x01,0x00,0x21,0x20,0x00,0xd6,0x02,0x41,0x30,0x00,0x00,
+0x2f,0x18,0x00,0x17,0x30,0x0e,0x0f,0x01,0x1a,0x00,0x13,0x00,0xea,0x06,0x16,0xf3,
+0x19,0x00,0x20,0x01,0x44,0x01,0x00,0x41,0x41,0x00,0x00,0x5f,0x1a,0x00,0x31,0x60,
+0x00,0x05,0xe9,0x06,0x52,0xf6,0x00,0x00,0x5f,0x00,0x50,0x0c,0x20,0x05,0xf5,0x5e,
+0x06,0xb0,0xf6,0x00,0x00,0x5f,0xdd,0xdd,0xdd,0xdd,0xdf,0x60,0x00,0x33,0x00,0x03,
+0x00,0x01,0x00,0xb3,0x4f,0x30,0x00,0x00,0x03,0xf2,0x00,0x00,0x00,0x0b,0xb0,0x09,
+0x00,0x22,0x03,0x80,0x09,0x00,0x50,0xae,0xee,0xee,0xee,0x10,0x09,0x00,0x41,0x34,
+0x44,0x44,0x44,0x12,0x00,0x41,0x02,0x22,0x22,0x20,0x09,0x00,0x90,0x0d,0xff,0xff,
+0xf4,0x55,0x57,0xf7,0x55,0x50,0x42,0x00,0x9a,0xdd,0xde,0xfe,0xdd,0xd1,0x0d,0xee,
+0xee,0xe3,0x24,0x00,0x05,0x09,0x00,0x42,0x0b,0xff,0xff,0xf4,0x09,0x00,0x2f,0x70,
+0x00,0x09,0x00,0x06,0x05,0x24,0x00,0x32,0x93,0x33,0x30,0x87,0x00,0x06,0x01,0x00,
+0x14,0x89,0x09,0x00,0xf1,0x1b,0x03,0xf5,0x00,0x0a,0xdd,0xdd,0xdd,0xd0,0x00,0x00,
+0x08,0x60,0x00,0x57,0x77,0x77,0xaf,0x00,0x1f,0xff,0xff,0xff,0x70,0x00,0x00,0x05,
+0xf0,0x00,0x33,0x33,0x33,0x31,0x00,0x00,0x00,0x5f,0x00,0x00,0x22,0x22,0x21,0x00,
+0x13,0x00,0x11,0x2f,0x1c,0x00,0x00,0x13,0x00,0x00,0x10,0x00,0xa0,0xaa,0xaa,0xac,
+0xf0,0x00,0x7d,0xdd,0xdd,0xc0,0x7f,0x39,0x00,0xf0,0x00,0x02,0x44,0x44,0x43,0x07,
+0xe0,0x00,0x02,0x70,0x00,0x01,0x11,0x11,0x00,0x7e,0x22,0x00,0x61,0x04,0xff,0xff,
+0xf9,0x07,0xe0,0x14,0x01,0x30,0x11,0x1b,0x90,0x13,0x00,0x50,0x30,0x04,0xf0,0x00,
+0xb9,0x13,0x00,0x50,0x2f,0x30,0x4f,0x00,0x0b,0x13,0x00,0x20,0x04,0xf1,0x26,0x00,
+0xf2,0x05,0x06,0xf6,0x55,0x55,0xbd,0x00,0x4f,0x33,0x33,0x20,0x1c,0xff,0xff,0xfe,
+0x40,0x00,0x09,0x70,0x00,0x00,0x7f,0x00,0xf1,0x14,0x6f,0x20,0x00,0x3f,0xff,0xff,
+0x60,0x00,0x00,0x00,0xa3,0x00,0x03,0xf2,0x11,0xe6,0x00,0x00,0xee,0xee,0xee,0xe1,
+0x4f,0x00,0x0e,0x60,0x00,0x04,0x44,0x44,0x44,0x08,0xe0,0x00,0xe6,0x1a,0x01,0xf0,
+0x00,0x11,0xe9,0x00,0x0e,0x71,0x10,0x03,0xee,0xee,0xe7,0xde,0x10,0x00,0xaf,0xfb,
+0x75,0x00,0xf1,0x09,0x3d,0x20,0x00,0x00,0x11,0x00,0x02,0x88,0x88,0x83,0x65,0x55,
+0x55,0x56,0x40,0x00,0x29,0x99,0x99,0x4f,0xff,0xff,0xff,0xfb,0xd1,0x00,0x50,0x1f,
+0x50,0x00,0x2f,0x40,0x5b,0x00,0xf2,0x09,0x50,0x8e,0x00,0x0b,0xc0,0x00,0x03,0xf0,
+0x00,0xe5,0x00,0xdb,0x09,0xe2,0x00,0x00,0x3f,0x00,0x0e,0x50,0x02,0xee,0xf4,0x00,
+0x13,0x00,0x40,0x3d,0xfe,0x50,0x00,0x26,0x00,0xf0,0x00,0x55,0xbf,0xb3,0x9f,0xd7,
+0x20,0x03,0xf3,0x33,0x38,0xfb,0x40,0x00,0x39,0xec,0x5f,0x00,0x2b,0x01,0x00,0x01,
+0x00,0x14,0xb5,0x09,0x00,0xf0,0x04,0x08,0xc0,0x00,0x8d,0xdd,0xdd,0xdd,0xdd,0x00,
+0x00,0x2d,0x00,0x04,0x77,0x7a,0xf7,0x77,0x70,0x1f,0x77,0x00,0x00,0x38,0x01,0x00,
+0x56,0x01,0x10,0x20,0x4b,0x01,0x00,0x85,0x00,0x20,0x20,0x02,0x13,0x00,0x00,0x56,
+0x01,0x42,0x20,0xe6,0x05,0xf0,0x3c,0x00,0xf3,0x07,0x0e,0x60,0x5f,0x65,0x54,0x00,
+0x4c,0xcc,0xcc,0x20,0xe6,0x05,0xfe,0xdd,0xb0,0x01,0x55,0x55,0x51,0x0e,0x60,0x5f,
+0x59,0x00,0x01,0x26,0x00,0x42,0x03,0xff,0xff,0xf3,0x13,0x00,0x42,0x3f,0x33,0x3f,
+0x30,0x13,0x00,0x24,0xf0,0x00,0x13,0x00,0x23,0x00,0x0f,0x13,0x00,0xf7,0x03,0xf6,
+0x56,0xf5,0x5f,0x95,0x8f,0x55,0x55,0x10,0x3f,0xdc,0xcc,0x7f,0xff,0xff,0xff,0xff,
+0xf5,0xab,0x00,0x60,0xc7,0x00,0x00,0x00,0x0c,0x80,0xc5,0x01,0x50,0xf1,0x00,0x00,
+0x00,0x7f,0x13,0x00,0xf2,0x0a,0x0a,0x20,0x05,0x88,0x89,0xf9,0x88,0x81,0x1e,0xee,
+0xee,0xed,0x8c,0xcd,0xfc,0xcc,0xcc,0x10,0x44,0x44,0x44,0x30,0x00,0xca,0x00,0xab,
+0x00,0xe1,0x00,0x6f,0x10,0x03,0x00,0x00,0x4f,0xff,0xff,0x30,0x1e,0x70,0x09,0xe1,
+0x45,0x00,0xe2,0x3e,0xf8,0x9a,0xf4,0x00,0x00,0x4e,0xee,0xee,0x33,0xb9,0x8b,0xf8,
+0x01,0x26,0x00,0x40,0x05,0xfa,0x02,0xf6,0x8f,0x01,0x50,0x00,0x07,0xf9,0x00,0xcd,
+0x01,0x02,0xf0,0x0a,0xf3,0x2c,0xf6,0x00,0x9f,0x30,0x00,0x4e,0x00,0x0e,0x3b,0xb2,
+0x00,0x9f,0x50,0x00,0x04,0xe0,0x00,0xe3,0x00,0x01,0xbf,0xe2,0x00,0x13,0x00,0x50,
+0x30,0x05,0xed,0x4a,0xf4,0x26,0x00,0xf4,0x01,0xf4,0x5d,0xf8,0x00,0x09,0xf4,0x00,
+0x4e,0x33,0x33,0xce,0x81,0x00,0x00,0x0a,0xd0,0x5f,0x01,0x09,0x64,0x01,0xf0,0x1a,
+0xb8,0x00,0x00,0x98,0x00,0x00,0x6e,0x10,0x00,0x04,0xf2,0x00,0x05,0xf2,0x00,0x0d,
+0xb0,0x00,0x00,0x0a,0x30,0x00,0x0d,0x90,0x06,0xf2,0x00,0x1e,0xee,0xee,0xea,0x36,
+0xbb,0x66,0xac,0x66,0x00,0x44,0x44,0x44,0x38,0xee,0x00,0x11,0xe0,0x8f,0x00,0x31,
+0x00,0x9c,0x00,0xb5,0x00,0x52,0x10,0x00,0x09,0xc0,0x00,0xb6,0x02,0x40,0x55,0xbd,
+0x55,0x51,0xb5,0x00,0x66,0x10,0xee,0xef,0xfe,0xee,0x40,0x26,0x00,0x32,0x14,0x44,
+0x44,0x26,0x00,0x00,0x8f,0x00,0x01,0x13,0x00,0x00,0xa2,0x00,0x10,0x4d,0x4c,0x00,
+0xfc,0x00,0xf3,0x04,0xe0,0x00,0xe4,0x55,0x55,0xbd,0x55,0x55,0x10,0x4e,0x00,0x0e,
+0x40,0x26,0x00,0x26,0x33,0x33,0x5f,0x00,0x03,0x01,0x00,0x10,0xc3,0x0e,0x01,0xf0,
+0x10,0x22,0x22,0x10,0x00,0x09,0xe0,0x00,0x6f,0xff,0xff,0xff,0xfa,0x00,0x00,0x0b,
+0x20,0x00,0x53,0x1b,0xa1,0x1b,0xa0,0x1e,0xee,0xee,0xe9,0x0d,0x30,0xe6,0x00,0xb9,
+0xab,0x00,0x60,0x25,0xd0,0x4f,0x20,0x0c,0x80,0x85,0x00,0x50,0xd5,0x0b,0xb0,0x00,
+0xe6,0xab,0x00,0x61,0x01,0x07,0xf3,0x00,0x1f,0x40,0x47,0x02,0x40,0xf6,0x06,0xad,
+0xe0,0xab,0x00,0x52,0x08,0xe4,0x00,0x25,0x51,0x60,0x01,0x41,0x07,0xa0,0x00,0x00,
+0x60,0x01,0x40,0x04,0x3f,0x50,0x12,0x85,0x00,0xf0,0x0a,0xf2,0x96,0xe4,0x6e,0x07,
+0xc0,0x00,0x4d,0x00,0x0f,0x2c,0x4e,0x40,0xc2,0x0e,0x50,0x04,0xd0,0x00,0xf4,0xf1,
+0xe4,0x00,0x03,0x7c,0x13,0x00,0x60,0x9c,0x0e,0x40,0x00,0xd5,0xf3,0x61,0x03,0x50,
+0x50,0xe8,0x33,0x4f,0x24,0xab,0x00,0x58,0x00,0x09,0xff,0xff,0xb0,0xab,0x00,0x40,
+0x08,0x70,0x00,0x11,0x01,0x00,0x50,0x00,0x00,0x5f,0x20,0x0d,0xee,0x00,0xf0,0x04,
+0xc0,0x00,0x00,0xa4,0x00,0x11,0x1c,0xa1,0x11,0x11,0x01,0xee,0xee,0xee,0xc0,0x22,
+0xf8,0x22,0x20,0x6b,0x03,0x30,0x43,0x5f,0xff,0x88,0x03,0x00,0x7c,0x00,0x41,0x26,
+0xf3,0x22,0xe6,0xdc,0x01,0x20,0x00,0x8d,0x88,0x03,0x00,0xa8,0x01,0xa0,0x1c,0xa1,
+0x11,0xe7,0x10,0x04,0xee,0xee,0xe8,0xff,0x01,0x00,0x50,0x20,0x02,0x22,0x22,0x01,
+0x55,0x00,0x10,0x10,0x6b,0x03,0x50,0x15,0x55,0x55,0x55,0x50,0xdb,0x00,0x50,0x53,
+0xfe,0xdd,0xdd,0xef,0x02,0x02,0x20,0xe5,0x3f,0x4f,0x04,0x00,0x60,0x01,0x20,0x53,
+0xf0,0x17,0x03,0x33,0x04,0xf1,0x11,0x13,0x00,0x00,0x26,0x00,0x11,0xfd,0x26,0x00,
+0x8b,0xf0,0x00,0x00,0x3f,0x66,0x66,0x69,0xe0,0x02,0x02,0x50,0x8a,0x00,0x00,0x9b,
+0x00,0x02,0x02,0x51,0x03,0xf4,0x00,0x0e,0x70,0x02,0x02,0x41,0x0b,0xb0,0x05,0xf1,
+0x02,0x02,0x50,0x14,0x8a,0x44,0xdb,0x40,0x57,0x01,0x10,0x34,0x85,0x00,0x10,0x30,
+0x31,0x01,0x50,0x4f,0x10,0x00,0x02,0xf3,0x56,0x00,0x61,0x14,0xf0,0x00,0x00,0x1f,
+0x30,0x8c,0x04,0x40,0x00,0x00,0x01,0xf3,0x57,0x01,0x52,0x14,0xf5,0x55,0x55,0x7f,
+0x26,0x00,0x00,0xe5,0x01,0x02,0xb7,0x02,0x32,0xe0,0x6e,0x00,0xdb,0x00,0x40,0x9c,
+0x06,0xe0,0x00,0x44,0x01,0x30,0x30,0x0d,0x80,0x13,0x00,0x81,0xd0,0x00,0xf3,0x03,
+0xf3,0x06,0xe0,0x03,0x13,0x00,0x50,0xcb,0x00,0x6e,0x00,0xf3,0x02,0x02,0xe0,0xbe,
+0x10,0x06,0xf3,0x4f,0x10,0x4e,0x33,0x33,0xcc,0x20,0x00,0x2e,0xff,0x9c,0x01,0x0d,
+0x16,0x04,0x20,0x01,0xd2,0xd6,0x03,0x10,0x50,0x10,0x06,0xf0,0x0b,0xc0,0x01,0x44,
+0x44,0xf9,0x44,0x43,0x00,0x00,0x2a,0x00,0x3d,0xdd,0xdf,0xed,0xdd,0x90,0x2e,0xee,
+0xee,0xe1,0x00,0x00,0xf6,0x00,0x00,0xb5,0x00,0xc0,0x05,0x77,0x7f,0xa7,0x77,0x00,
+0x01,0x22,0x22,0x10,0xae,0xee,0x18,0x00,0x45,0x7f,0xff,0xf8,0x00,0xa8,0x05,0x00,
+0x4f,0x04,0xf0,0x10,0xda,0x00,0x6e,0xee,0xe8,0x3e,0x11,0x11,0x11,0x18,0xb0,0x01,
+0x33,0x33,0x23,0xe0,0x65,0x04,0x70,0x7b,0x00,0x12,0x22,0x22,0x28,0x0b,0x80,0x7d,
+0x04,0x60,0x07,0xd8,0x01,0xf1,0x08,0xc7,0x07,0xd0,0x00,0x00,0x7c,0x00,0x8b,0x00,
+0x0f,0x50,0x7d,0x00,0x00,0x07,0xc0,0x08,0xb0,0x05,0xf1,0x07,0xd0,0x03,0x13,0x00,
+0xff,0x09,0xe9,0x00,0x7d,0x00,0xf1,0x07,0xff,0xff,0xb1,0xce,0x00,0x06,0xe4,0x6f,
+0x00,0x7d,0x33,0x32,0xcd,0x20,0x00,0x2d,0xff,0x80,0xb5,0x00,0x01,0x20,0x03,0xe1,
+0xe0,0x03,0x10,0x10,0x26,0x04,0x50,0x90,0x00,0x00,0x0d,0xf4,0x14,0x00,0x70,0x49,
+0x00,0x00,0x0b,0xe9,0xe2,0x00,0x6a,0x01,0x50,0x90,0x09,0xe2,0x0c,0xe3,0xb5,0x00,
+0x60,0x42,0x0b,0xf3,0x00,0x0c,0xf6,0xb5,0x00,0xf6,0x01,0x5e,0xfe,0xbb,0xbb,0xcf,
+0xfd,0x10,0x6f,0xff,0xf9,0xc2,0x89,0x99,0x99,0x56,0xa0,0x4c,0x00,0x41,0x6e,0xee,
+0xe2,0x6f,0x15,0x02,0xf2,0x11,0x01,0x22,0x22,0x06,0xc2,0xa8,0x2d,0x52,0xf2,0x00,
+0x24,0x44,0x41,0x6b,0x09,0x70,0xd3,0x0f,0x20,0x08,0xff,0xff,0x46,0xc0,0x98,0x0d,
+0x41,0xf2,0x00,0x8a,0x00,0xd4,0x26,0x00,0x81,0x08,0xa0,0x0d,0x46,0xc1,0xa8,0x1d,
+0x52,0x13,0x00,0x06,0x26,0x00,0xf2,0x3a,0xb0,0x97,0x0d,0x45,0xf2,0x00,0x8b,0x33,
+0x31,0x6b,0x07,0x60,0xb3,0xda,0x00,0x04,0x80,0x00,0x02,0x90,0x00,0xc4,0x00,0x00,
+0x01,0xe4,0x00,0x00,0xe5,0x00,0xe5,0x94,0x00,0x00,0x65,0x03,0xff,0xff,0xf8,0xd6,
+0x8c,0x00,0xde,0xee,0xe4,0x58,0x03,0xa0,0xd6,0x1f,0x30,0x44,0x44,0x41,0x4d,0x06,
+0xb0,0xc7,0x07,0x30,0x02,0x22,0x21,0x3f,0x2a,0x81,0xc8,0x11,0x10,0x5f,0xff,0xd8,
+0xff,0x1d,0x04,0x10,0x00,0xf5,0x02,0xf0,0x3f,0xaa,0x11,0x10,0x4e,0xee,0xc0,0xcf,
+0xff,0xf3,0x9b,0x0b,0x60,0x13,0x33,0x30,0xc6,0x00,0xe3,0x7c,0x2f,0x30,0x01,0x11,
+0x10,0xc7,0x11,0xf3,0x5e,0x8c,0x00,0x5f,0xff,0xe0,0xcf,0xee,0xf3,0x3f,0xe4,0x00,
+0x5b,0x03,0xe0,0xc6,0x00,0xe3,0x1f,0xb0,0x00,0x5b,0x02,0xe0,0xca,0x55,0xf3,0x5f,
+0x60,0x60,0x5b,0x02,0xe0,0xcc,0x99,0xf7,0xfd,0xb0,0xf0,0x5f,0xff,0xe0,0xc6,0x00,
+0x7e,0x44,0xfa,0xc0,0x5c,0x22,0x20,0xf6,0x03,0x11,0x9f,0xc0,0x07,0x02,0x52,0x01,
+0x50,0x09,0x70,0x5b,0x00,0x02,0x17,0x04,0xf0,0x33,0xde,0xff,0xee,0xfe,0xe0,0xad,
+0x44,0x44,0x40,0x00,0x2c,0x40,0x37,0x00,0x3f,0xcb,0xbf,0xda,0x00,0x0b,0xfd,0xdd,
+0xdd,0x5e,0xec,0x03,0xf3,0x00,0x0a,0xf7,0x66,0x41,0xf6,0x80,0xd9,0xd9,0x00,0x00,
+0x8c,0x74,0x8a,0x2f,0x00,0x06,0xff,0x10,0x00,0x00,0xbc,0xac,0xa7,0xe0,0x6d,0xe7,
+0xbf,0x94,0x00,0x09,0x41,0x1c,0xfb,0x6a,0x91,0x00,0x6e,0xd0,0xaf,0x00,0x82,0x5f,
+0x30,0x00,0x00,0x12,0x00,0x9e,0xee,0x01,0x00,0x12,0x80,0x61,0x04,0x00,0x76,0x00,
+0x30,0x00,0x3a,0xaa,0x01,0x00,0x50,0x30,0x00,0x00,0x02,0x99,0x01,0x00,0x60,0x92,
+0x00,0x00,0x00,0x13,0x33,0x01,0x00,0x50,0x00,0x00,0x00,0x07,0xfd,0x3a,0x02,0x32,
+0xf7,0x00,0x00,0x92,0x07,0x28,0x0e,0x70,0x13,0x00,0x40,0x00,0x02,0xf1,0x00,0x16,
+0x06,0x84,0x0d,0xee,0xef,0xff,0xee,0xff,0xee,0xea,0x12,0x00,0xf1,0x00,0x9a,0x00,
+0x01,0xee,0xee,0xfe,0xee,0xff,0xee,0xfa,0x00,0x03,0xf1,0x05,0xf0,0x24,0x00,0x30,
+0x06,0xfe,0xef,0x12,0x00,0xf0,0x07,0xee,0xc0,0x00,0x03,0xce,0x20,0x00,0xf5,0x01,
+0x3b,0xa0,0x48,0xdf,0xfc,0xaa,0xaa,0xfc,0xac,0xf9,0x20,0x7d,0xcf,0x6d,0x00,0x50,
+0x39,0xe0,0x00,0x00,0x6e,0x93,0x00,0xa0,0x29,0xe0,0x00,0x00,0x6f,0xbb,0xbb,0xbb,
+0xbb,0xbd,0x12,0x00,0x10,0x11,0xb0,0x02,0x00,0x12,0x00,0x50,0xcc,0xcc,0xcc,0xcc,
+0xce,0x12,0x00,0x01,0x75,0x04,0xf0,0x08,0xe0,0x00,0x00,0x6d,0xde,0xdd,0xdd,0xef,
+0xdd,0xc0,0x00,0x00,0x03,0x9f,0x70,0x00,0x5e,0xd8,0x30,0x00,0x6b,0xfe,0x92,0x67,
+0x02,0x41,0xfd,0x60,0x28,0x30,0x44,0x01,0x26,0x06,0x30,0x45,0x02,0x01,0xfc,0x08,
+0x21,0x0e,0x70,0x9c,0x03,0x41,0xfe,0x00,0x00,0xe7,0xc8,0x03,0x22,0x06,0xe0,0x13,
+0x00,0x33,0xf0,0x00,0x6e,0x13,0x00,0x00,0x62,0x00,0xd7,0x0e,0xff,0xff,0xf0,0x04,
+0xf4,0x44,0x9e,0x00,0x00,0xea,0x44,0x44,0x26,0x00,0x33,0xf3,0x33,0x8e,0x26,0x00,
+0x26,0xee,0xef,0x39,0x00,0x20,0x0e,0xff,0xc9,0x05,0x00,0x26,0x00,0xe0,0xe9,0x44,
+0x44,0x6f,0x40,0x04,0xf3,0x33,0x9e,0x0e,0x60,0x00,0x01,0xf4,0x21,0x04,0x30,0xd0,
+0xe6,0x00,0x8b,0x05,0x32,0x4a,0x02,0x90,0x13,0x00,0x41,0x0c,0xa0,0x0d,0x90,0x13,
+0x00,0xff,0x04,0x08,0xf2,0x00,0x3f,0x3e,0xfe,0xee,0xef,0xf4,0x01,0xd4,0x00,0x00,
+0x30,0xe9,0x55,0x55,0x6e,0x30,0x0b,0x08,0x04,0x11,0xf7,0x06,0x00,0xa1,0x46,0x66,
+0x66,0xfb,0x66,0x66,0x60,0x00,0x00,0x9f,0x7f,0x02,0x17,0xf1,0x1b,0x00,0x04,0x09,
+0x00,0x21,0x26,0x66,0x24,0x00,0x20,0x66,0x60,0x67,0x05,0x04,0xa4,0x02,0x40,0xf6,
+0x00,0x9e,0x00,0xe1,0x01,0xf0,0x20,0x10,0xf6,0x00,0x9e,0x06,0x70,0x00,0x00,0xbd,
+0x01,0xf5,0x00,0x9e,0x04,0xf5,0x00,0x05,0xf4,0x04,0xf3,0x00,0x9e,0x00,0x9e,0x10,
+0x3f,0x80,0x09,0xe0,0x00,0x9e,0x00,0x0e,0xa0,0x9a,0x00,0x3f,0x80,0x00,0x9e,0x00,
+0x06,0xf2,0x00,0x01,0xdd,0x00,0x36,0x00,0x70,0x10,0x00,0x4e,0xe3,0x01,0x66,0xcd,
+0x3f,0x00,0x51,0x4c,0x20,0x00,0xef,0xd6,0x6a,0x00,0x14,0x5d,0x73,0x00,0x40,0x06,
+0xf0,0x00,0x0e,0x49,0x01,0xe3,0x08,0xff,0xff,0xff,0xf0,0x11,0x11,0x17,0xe0,0x00,
+0x24,0x49,0xf4,0x44,0x26,0x02,0x20,0x6f,0x00,0x39,0x02,0x70,0xe0,0x00,0x44,0x48,
+0xf4,0x44,0x20,0x13,0x00,0x62,0x0f,0xff,0xff,0xff,0xf8,0xaf,0x93,0x00,0xe0,0xf4,
+0x00,0x0b,0xc4,0x44,0x44,0x00,0x00,0x71,0x0f,0x40,0x00,0xba,0x00,0xbe,0x08,0xf2,
+0x23,0x30,0xf6,0x33,0x1b,0xa0,0x00,0x02,0x30,0x03,0xf2,0x0f,0xff,0xf5,0xba,0x00,
+0x00,0x6d,0x00,0x4f,0x40,0xf4,0x00,0x0a,0xb0,0x00,0x09,0xb0,0x05,0xfb,0x0f,0x40,
+0x00,0x7f,0xfe,0xef,0xf6,0x00,0x6e,0xf6,0xf4,0x00,0x00,0x35,0x55,0x53,0x00,0x09,
+0xa7,0xff,0x40,0x84,0x00,0xe0,0xd7,0x08,0xfe,0xa7,0x66,0x55,0x55,0x55,0x61,0x4f,
+0x20,0x02,0x8c,0xef,0xf3,0x00,0x26,0x00,0x60,0x42,0x01,0x15,0x7a,0xa0,0x06,0xf1,
+0x08,0xb0,0x00,0xaf,0xff,0xff,0xff,0x90,0x03,0x66,0xbd,0x66,0x43,0x46,0xf7,0x44,
+0xe8,0x00,0x8d,0xdf,0xfd,0xda,0x00,0x5f,0xc2,0x01,0x11,0x8b,0x66,0x0b,0x11,0xf6,
+0x73,0x09,0x50,0x05,0xf3,0x00,0x3f,0x30,0xcf,0x01,0xf1,0x18,0xf9,0xf7,0x08,0xff,
+0xc0,0x00,0x33,0x37,0xf3,0x33,0xa5,0x00,0x02,0x20,0x00,0x00,0x50,0x4f,0x00,0x00,
+0xcc,0xcc,0xcc,0xc2,0x00,0x2f,0x24,0xf0,0x00,0x0f,0x85,0x55,0x7f,0x20,0x03,0xf1,
+0x4f,0xff,0xe0,0x1f,0x0b,0xf1,0x07,0x4f,0x24,0xf2,0x22,0x0f,0x40,0x00,0x3f,0x20,
+0x05,0xf8,0x4f,0x00,0x00,0xf5,0x22,0x25,0xf2,0x00,0x6f,0xf7,0xf0,0xf2,0x00,0x53,
+0x20,0x09,0xa9,0xff,0x00,0xab,0x00,0x31,0x0a,0xfd,0x97,0xab,0x00,0x31,0x3f,0x10,
+0x03,0xab,0x00,0x35,0xfe,0x00,0x40,0xaa,0x00,0x01,0x3c,0x07,0x12,0x00,0x68,0x08,
+0x20,0xf1,0xef,0x41,0x07,0xe0,0x04,0xe1,0x11,0x4f,0x1e,0xb6,0x66,0x66,0x65,0x00,
+0x4e,0x00,0x03,0xf1,0x73,0x02,0x00,0xf5,0x06,0x31,0x3f,0x1e,0x70,0x26,0x00,0x40,
+0x55,0x57,0xf1,0xea,0x1c,0x00,0x51,0x04,0xee,0xff,0xee,0x1e,0xe9,0x01,0x00,0xa3,
+0x02,0x10,0xe7,0x1a,0x03,0x60,0x01,0x40,0x6e,0x00,0x0e,0x70,0x0f,0x00,0x41,0x4e,
+0x06,0xf8,0x83,0x13,0x00,0x80,0x04,0xe0,0x6f,0xaa,0x4e,0xa5,0x55,0x59,0x13,0x00,
+0x30,0xe0,0x00,0xef,0x7b,0x00,0x31,0x04,0xe0,0x6e,0xfd,0x00,0x10,0x00,0x13,0x00,
+0x12,0x53,0x5f,0x00,0x50,0xe3,0xaf,0xff,0x5e,0x70,0x78,0x04,0xe0,0xcf,0xfd,0x84,
+0x00,0xeb,0x77,0x77,0x77,0x71,0x0a,0x61,0x00,0x00,0x0d,0x2b,0x04,0x80,0x20,0x00,
+0x00,0x87,0x00,0x00,0x00,0x3c,0xce,0x05,0x10,0xa9,0x23,0x0a,0x11,0x10,0xdf,0x00,
+0x10,0xc0,0x09,0x00,0x50,0x04,0x44,0xcb,0x44,0x30,0x09,0x00,0xf2,0x10,0x00,0x11,
+0xba,0x11,0x08,0xee,0xef,0xee,0xe5,0x07,0xff,0xff,0xff,0x79,0xd7,0x9f,0x87,0xe6,
+0x07,0x90,0x97,0x0a,0x79,0xa0,0x2f,0x00,0xd6,0x07,0xa3,0xa9,0x3b,0x09,0x00,0x32,
+0xec,0xee,0xce,0x09,0x00,0x00,0x1b,0x00,0xf0,0x03,0xd8,0xaf,0x98,0xf6,0x07,0xfe,
+0xff,0xef,0x79,0xd8,0x9f,0x88,0xe6,0x01,0x22,0xba,0x22,0x19,0x1b,0x00,0x00,0x51,
+0x00,0x10,0x49,0x09,0x00,0x10,0x2f,0x89,0x01,0x00,0x09,0x00,0x52,0x00,0x00,0xb9,
+0x00,0x09,0x09,0x00,0x10,0xa9,0x7d,0x08,0x20,0xff,0xf6,0x09,0x00,0x51,0x08,0xb5,
+0x55,0x55,0xc5,0x28,0x09,0x20,0x00,0xb3,0xc1,0x00,0x80,0x0f,0x40,0x00,0x00,0x0b,
+0xd0,0x00,0x00,0xc0,0x01,0xa2,0x64,0x44,0x6c,0x54,0x44,0x00,0x34,0x4f,0x74,0x48,
+0x08,0x03,0xf0,0x3a,0x11,0xf6,0x11,0x01,0x23,0x11,0x24,0x11,0x00,0x8f,0xff,0xff,
+0xf0,0x08,0xe0,0x06,0xf2,0x00,0x08,0x90,0xd3,0x3f,0x02,0xf6,0x00,0x0c,0xc0,0x00,
+0x8a,0x2e,0x55,0xf0,0xcc,0x00,0x00,0x2f,0x80,0x08,0xfe,0xfe,0xef,0x7f,0x66,0x00,
+0x48,0x7f,0x10,0x89,0x0d,0x33,0xf0,0x45,0xf1,0x0b,0xa0,0x20,0x08,0xb4,0xe7,0x7f,
+0x00,0x0e,0x81,0xf5,0x00,0x00,0x6c,0xcf,0xdc,0xb0,0x00,0x6f,0xad,0x69,0x00,0x00,
+0xcb,0x06,0x41,0xdf,0x40,0x00,0x01,0x11,0x0b,0xd0,0x4f,0xfb,0x00,0x00,0x03,0x33,
+0xf7,0x33,0x10,0x6f,0x94,0xfc,0x10,0x85,0x00,0x60,0x03,0xcf,0x70,0x02,0xdf,0x81,
+0x26,0x00,0x67,0xba,0x20,0x00,0x00,0x6c,0x10,0x81,0x04,0x12,0xb0,0x71,0x05,0x51,
+0x00,0x51,0x3f,0x02,0x5b,0x27,0x09,0xf1,0x09,0x0c,0x53,0xf0,0x8a,0xb8,0x00,0x25,
+0x00,0x6c,0x00,0x89,0x3f,0x0c,0x58,0x60,0x05,0xe0,0x05,0x90,0x04,0xc3,0xf1,0xf0,
+0x5f,0x5a,0x00,0xf0,0x03,0x1e,0x3f,0x6a,0x01,0x33,0x38,0xf3,0x33,0x10,0x05,0x57,
+0xf5,0x55,0x06,0x66,0xaf,0x66,0x61,0x72,0x00,0xf4,0x0c,0xf2,0xf9,0x8b,0xf8,0x8f,
+0x40,0x00,0x99,0x0f,0x30,0x0f,0x20,0x5e,0x00,0xe4,0x00,0x09,0x90,0xf3,0x00,0xff,
+0xef,0xfe,0xef,0x40,0x00,0xa8,0x13,0x00,0x51,0x0c,0x70,0xf3,0x00,0xfe,0x13,0x00,
+0x32,0xe5,0x0f,0x33,0x2e,0x05,0x40,0x1f,0x22,0xfc,0xf4,0x8c,0x03,0x51,0x40,0x05,
+0xd0,0x8f,0x92,0x1c,0x04,0xb1,0x10,0xd8,0x01,0x20,0x00,0x00,0x05,0xe0,0x00,0x00,
+0x1b,0x9d,0x00,0x10,0x5e,0x05,0x00,0x14,0x40,0xc8,0x07,0x42,0x2f,0xa0,0x00,0x01,
+0x5d,0x04,0x52,0x3f,0xa0,0x00,0x05,0xf6,0x9c,0x02,0x32,0x50,0x00,0x07,0x04,0x0e,
+0x54,0x30,0x00,0x00,0x2f,0x90,0x07,0x04,0x14,0xfe,0xdf,0x00,0xf2,0x07,0xad,0xe6,
+0x00,0x00,0x00,0x55,0x55,0x00,0x00,0x0e,0x88,0xc0,0x00,0x00,0x0f,0xff,0xf0,0x00,
+0x06,0xf3,0x2f,0x30,0xec,0x0d,0x32,0xdb,0x00,0xca,0xff,0x0d,0x41,0x8f,0x30,0x06,
+0xf3,0x13,0x00,0x50,0x4f,0x80,0x00,0x0c,0xe2,0x13,0x00,0xa0,0x6f,0xb0,0x00,0x00,
+0x2e,0xf6,0x00,0x00,0x7f,0x0a,0xf1,0x07,0x53,0x2c,0xa0,0x00,0x8f,0xed,0x0a,0x05,
+0xfc,0x03,0xaf,0x30,0x7f,0xd8,0x65,0x45,0x56,0x67,0x91,0x0c,0x40,0x00,0x17,0xce,
+0xff,0xfe,0xed,0xdb,0x64,0x08,0x05,0xe0,0x0b,0x20,0xe8,0x00,0xaf,0x0c,0x00,0xaf,
+0x00,0x10,0x40,0x79,0x04,0x31,0xf6,0x00,0x6f,0x8f,0x09,0x80,0x00,0x08,0xf1,0x06,
+0xf3,0x33,0x33,0x5f,0xd9,0x06,0x21,0x00,0x6e,0xb5,0x09,0x00,0xb3,0x00,0x82,0xe2,
+0x22,0x22,0x4f,0x30,0x00,0x44,0x44,0x26,0x00,0x00,0xab,0x00,0x13,0x06,0x24,0x0a,
+0x12,0x6f,0x80,0x06,0x00,0x98,0x00,0x13,0x06,0x42,0x05,0x32,0x5f,0x00,0x6e,0xd5,
+0x04,0x11,0x05,0x26,0x00,0x1b,0x07,0x13,0x00,0x02,0x26,0x00,0x41,0x03,0xcf,0x70,
+0x13,0x2f,0x07,0xe0,0x06,0xfb,0x7e,0xe9,0x53,0x32,0x33,0x44,0x67,0x20,0xba,0x00,
+0x06,0xbf,0x1d,0x00,0xb0,0xe1,0x01,0x00,0x00,0x00,0x00,0x11,0x11,0x00,0x00,0x00,
+0xf0,0x00,0x00,0x61,0x00,0x00,0x85,0x00,0x00,0x1b,0x30,0x00,0x0c,0xd1,0x00,0x08,
+0xe0,0x03,0x00,0xf1,0x0e,0x00,0x1e,0xb0,0x00,0x0e,0x80,0x02,0xf5,0x00,0x00,0x00,
+0x3f,0x60,0x55,0xa8,0x55,0xbe,0x55,0x20,0x00,0x00,0x30,0x1f,0xff,0xff,0xff,0xff,
+0xf7,0x00,0x01,0x00,0xf0,0x0d,0xbb,0x00,0x00,0x00,0x06,0x77,0x70,0x00,0x00,0x0b,
+0xb0,0x00,0x00,0x00,0xac,0xee,0x03,0x55,0x55,0xcc,0x55,0x55,0x50,0x00,0x07,0xe0,
+0xbf,0xff,0x01,0x00,0xf1,0x04,0x00,0x00,0x7e,0x00,0x00,0x01,0xfd,0x20,0x00,0x00,
+0x00,0x07,0xe0,0x00,0x00,0x8f,0xbe,0x20,0x00,0x13,0x00,0x41,0x4f,0x70,0xbe,0x30,
+0x13,0x00,0xf0,0x04,0x6f,0xa0,0x00,0xaf,0x30,0x00,0x00,0x8e,0x03,0xdf,0x80,0x00,
+0x00,0xbf,0x20,0x00,0xaf,0xfb,0x39,0x23,0x00,0xf1,0x0d,0x60,0x00,0xbf,0x42,0xcf,
+0xc7,0x65,0x45,0x56,0x67,0x84,0x0d,0x50,0x00,0x4a,0xef,0xff,0xff,0xff,0xfe,0x30,
+0x10,0x00,0x00,0x00,0x01,0x11,0x10,0x79,0x00,0xa1,0x02,0x22,0x22,0x22,0x22,0x20,
+0x00,0x6d,0x20,0x00,0x68,0x00,0x80,0x10,0x01,0xce,0x20,0x00,0x05,0x20,0x02,0x56,
+0x00,0x60,0xce,0x20,0x01,0x9f,0xc9,0xf9,0x27,0x00,0x60,0xa2,0x02,0x22,0x39,0xfe,
+0x62,0x50,0x00,0x02,0x26,0x00,0xf0,0x0e,0x50,0x00,0x00,0x00,0x0f,0x40,0x05,0xe0,
+0x00,0xf5,0x01,0xaa,0xa9,0x00,0xf6,0x22,0x7e,0x22,0x2f,0x50,0x1b,0xbd,0xe0,0x0f,
+0xed,0xde,0xfd,0xdd,0xf5,0x98,0x00,0x50,0xf4,0x00,0x5e,0x00,0x0f,0xbe,0x00,0x06,
+0x13,0x00,0x51,0xf7,0x33,0x8f,0x33,0x3f,0x13,0x00,0x01,0x39,0x00,0x03,0x26,0x00,
+0xf0,0x0c,0x04,0x4f,0x50,0x00,0x4d,0xf7,0x1d,0x30,0x04,0xb0,0xcd,0xa1,0x00,0x7f,
+0x41,0x9e,0x95,0x32,0x22,0x33,0x45,0x72,0x0d,0x50,0x00,0x28,0xdf,0xab,0x00,0x11,
+0x10,0xa5,0x00,0x03,0xab,0x00,0x80,0x00,0x00,0x0c,0x60,0x00,0x00,0x00,0x5e,0x88,
+0x00,0x30,0xe7,0x00,0x00,0xa1,0x00,0xf1,0x08,0xde,0xee,0xef,0xfe,0xee,0xec,0x00,
+0x00,0xcd,0x14,0x44,0x44,0xf9,0x44,0x44,0x40,0x00,0x01,0xa1,0x01,0x11,0x1e,0x81,
+0x31,0x00,0x12,0x02,0x39,0x01,0xf0,0x29,0x02,0x22,0x20,0x2f,0x10,0x0e,0x70,0x05,
+0xf0,0x00,0xff,0xff,0x12,0xf1,0x00,0xe7,0x00,0x5f,0x00,0x02,0x26,0xf1,0x2f,0xa9,
+0x9f,0xc9,0x9b,0xf0,0x00,0x00,0x4f,0x11,0x88,0x8e,0xff,0xa8,0x88,0x00,0x00,0x04,
+0xf1,0x00,0x06,0xff,0xee,0x40,0x00,0x00,0x00,0x4f,0x10,0x05,0xf4,0xe7,0x7f,0x80,
+0x13,0x00,0xf0,0x18,0x08,0xf6,0x0e,0x70,0x3e,0xb0,0x00,0x00,0x4f,0x1d,0xe4,0x00,
+0xe7,0x00,0x2d,0x40,0x00,0x3c,0xfa,0x41,0x00,0x0e,0x70,0x00,0x00,0x00,0x6f,0x93,
+0xaf,0xa6,0x43,0x33,0x34,0x45,0x61,0x0d,0x80,0x00,0x39,0x56,0x01,0x28,0xfd,0x00,
+0xab,0x00,0x92,0x01,0x11,0x11,0x11,0x11,0x10,0x00,0x08,0x10,0x85,0x00,0x53,0x70,
+0x03,0xde,0x40,0x2f,0xb7,0x00,0xf0,0x02,0xaf,0x52,0xf5,0x22,0x22,0x22,0x2e,0x70,
+0x00,0x00,0x83,0x2f,0xed,0xed,0xdd,0xee,0xd6,0xab,0x00,0x50,0xf2,0x2e,0x10,0x06,
+0xe0,0xab,0x00,0xb0,0x3f,0x31,0xc9,0x12,0xe7,0x10,0x00,0xdf,0xfe,0x04,0xf9,0x39,
+0x00,0x90,0x80,0x02,0x28,0xe0,0x5f,0x00,0x00,0xe6,0x00,0xee,0x01,0x22,0x06,0xe1,
+0x0a,0x02,0x60,0x07,0xe0,0x9c,0x01,0x11,0xe7,0x6a,0x00,0xf0,0x09,0x7e,0x0c,0x83,
+0x33,0x3e,0x83,0x33,0x30,0x00,0x07,0xe2,0xf4,0xdd,0xdd,0xfe,0xdd,0xdd,0x00,0x00,
+0x7e,0x8d,0x00,0x00,0x0e,0x27,0x01,0x32,0x3c,0xf9,0x30,0x39,0x00,0xd1,0x6f,0x95,
+0xcf,0xa6,0x43,0x35,0x44,0x56,0x61,0x0c,0x90,0x00,0x49,0x01,0x02,0x07,0xab,0x00,
+0x30,0x62,0x00,0x00,0x01,0x02,0xa1,0x00,0x00,0x0b,0xe3,0x00,0x0d,0xff,0xff,0xff,
+0xe0,0x0a,0x00,0xe1,0xd9,0x00,0x00,0x8e,0x00,0x00,0x00,0x0b,0x60,0x0d,0xec,0xc7,
+0x08,0xe0,0xd2,0x00,0x41,0xda,0x26,0x90,0x8e,0x09,0x00,0xf0,0x09,0x0d,0x90,0x49,
+0x08,0xe0,0x00,0x04,0x44,0x40,0x02,0xda,0x26,0xb2,0xae,0x21,0x00,0xef,0xfe,0x04,
+0xfe,0xee,0xee,0xee,0xef,0xdb,0x01,0x10,0x4e,0x21,0x00,0xa1,0xe5,0x00,0x00,0x7e,
+0x04,0xe0,0x3f,0xff,0xf3,0x0e,0x13,0x00,0x42,0x03,0xd0,0x0d,0x30,0x13,0x00,0x33,
+0x3d,0x00,0xd3,0x13,0x00,0x20,0xfe,0xef,0x13,0x00,0xf0,0x11,0x8e,0x04,0xe0,0x29,
+0x11,0x13,0x2f,0x50,0x00,0xaf,0xf8,0x5e,0x00,0x00,0x00,0xde,0xc1,0x00,0xbf,0x55,
+0xef,0xa6,0x54,0x44,0x55,0x66,0x74,0x1e,0x50,0x00,0x6b,0xff,0xab,0x00,0x15,0x40,
+0xac,0x02,0xf1,0x06,0x01,0x00,0x00,0x00,0x04,0xb1,0x00,0x00,0x00,0x5f,0x50,0x02,
+0x22,0x24,0xfb,0x22,0x22,0x20,0x08,0xf6,0x0f,0x5e,0x01,0xf1,0x07,0xf1,0x00,0x9f,
+0x20,0x07,0xc0,0x00,0x0d,0x60,0x00,0x00,0x05,0x00,0x24,0xf4,0x22,0x7f,0x32,0x10,
+0x00,0x00,0x05,0x1b,0x00,0x00,0x13,0x00,0xf0,0x06,0xf0,0x00,0xa9,0x00,0x0e,0x60,
+0x79,0x98,0x05,0xf7,0xee,0xff,0xee,0x6e,0x60,0x9b,0xde,0x05,0xf0,0x00,0xaa,0x24,
+0x01,0x62,0x6e,0x05,0xf0,0x8b,0xee,0xb8,0x09,0x00,0x32,0xb6,0x22,0x6c,0x09,0x00,
+0x32,0xb8,0x44,0x7c,0x09,0x00,0xf0,0x0b,0xbb,0x99,0x97,0x0e,0x60,0x00,0x9f,0x15,
+0xf0,0x41,0x00,0x08,0xdf,0x40,0x09,0xec,0xe4,0x30,0x00,0x00,0x02,0x42,0x00,0x7f,
+0x30,0x7f,0xf9,0x01,0x60,0x56,0x73,0x97,0x00,0x02,0x9d,0xa2,0x00,0x2e,0xe2,0x00,
+0x01,0x00,0xf2,0x37,0x5e,0x30,0x0e,0xff,0xff,0x0d,0xff,0xff,0x40,0x00,0xbf,0x30,
+0xe3,0x00,0xe0,0xd4,0x00,0xe4,0x00,0x00,0xce,0x2e,0xfe,0xef,0x0d,0xfe,0xef,0x40,
+0x00,0x01,0x80,0xe4,0x00,0x30,0xd5,0x00,0x13,0x00,0x00,0x00,0x0e,0x84,0x4b,0x7d,
+0x94,0x47,0xd0,0x00,0x00,0x00,0x5b,0xbe,0xa1,0x5e,0xdb,0xa4,0x00,0x8b,0xba,0x00,
+0x00,0xf3,0x00,0xd7,0x00,0x00,0x07,0x8c,0xe0,0xbf,0xdc,0x00,0x81,0x00,0x7e,0x01,
+0x22,0xf5,0x22,0xe8,0x22,0xe6,0x03,0x40,0x0f,0x30,0x0d,0x70,0x0b,0x02,0x11,0x6f,
+0xde,0x00,0xa0,0xd0,0x00,0x07,0xe0,0x11,0x3c,0x61,0x4d,0x62,0x11,0x4e,0x03,0xf1,
+0x0f,0x6e,0xa0,0x00,0x5e,0xc2,0x00,0x00,0x1b,0xfa,0xbd,0x50,0x00,0x00,0x09,0xe2,
+0x00,0x5f,0xc5,0xaf,0xb6,0x43,0x23,0x33,0x46,0x60,0x0b,0xb0,0x00,0x38,0xdf,0xa3,
+0x02,0x16,0x00,0xa3,0x02,0x04,0x53,0x03,0x21,0x01,0xf4,0xae,0x02,0x02,0x83,0x04,
+0xf2,0x33,0x1f,0xff,0xff,0xc0,0x5d,0xdd,0xef,0xdd,0xd6,0x1f,0x53,0x3e,0x90,0x26,
+0xa6,0x66,0x6b,0x83,0x1f,0x20,0x3f,0x30,0x01,0xf5,0x00,0x0f,0x60,0x1f,0x20,0x8d,
+0x00,0x00,0xab,0x00,0x5f,0x10,0x1f,0x20,0xe7,0x00,0x00,0x5f,0x00,0xba,0x00,0x1f,
+0x24,0xf1,0x00,0x55,0x6c,0x65,0xf9,0x55,0x1f,0x29,0xc0,0x00,0xee,0xee,0xee,0xee,
+0xed,0x1f,0x22,0xe7,0x55,0x00,0xf2,0x10,0x1f,0x20,0x4f,0x20,0x04,0x55,0x55,0x55,
+0x50,0x1f,0x20,0x0d,0x80,0x0d,0xfe,0xee,0xef,0xf0,0x1f,0x20,0x09,0xb0,0x0d,0x70,
+0x00,0x05,0xf0,0x1f,0x20,0x0a,0xa0,0x09,0x00,0x32,0x48,0x9f,0x60,0x09,0x00,0x21,
+0x3a,0xa6,0x7b,0x02,0xc4,0xf0,0x1f,0x20,0x00,0x00,0x0d,0xa4,0x44,0x48,0xd0,0x1f,
+0x20,0x9d,0x00,0x02,0xb1,0x00,0x02,0x4d,0x03,0xf0,0x07,0x00,0x00,0x9f,0xcc,0xcc,
+0xcc,0xcc,0xcf,0x80,0x00,0x00,0x09,0xd5,0x55,0x55,0x55,0x55,0xe8,0x00,0x00,0x00,
+0x9d,0x09,0x00,0x10,0x5e,0x13,0x00,0x10,0xfc,0x1d,0x00,0x60,0xf8,0x00,0x00,0x11,
+0x12,0x22,0x01,0x00,0x43,0x11,0x10,0x0e,0xff,0x01,0x00,0x02,0x41,0x00,0x01,0x44,
+0x00,0x80,0x0e,0xed,0xdd,0xef,0xed,0xdd,0xef,0x10,0x1a,0x03,0x20,0x03,0xf2,0xf5,
+0x03,0x01,0x13,0x00,0x1a,0xdd,0x13,0x00,0x20,0x0c,0xdd,0x26,0x00,0x10,0xdd,0x23,
+0x01,0x00,0x13,0x00,0x01,0x7d,0x03,0x70,0xee,0xee,0xff,0xfe,0xee,0xee,0x70,0x4c,
+0x00,0x20,0x14,0xf3,0x4c,0x00,0x15,0x0f,0x5f,0x00,0x31,0x00,0x00,0xc3,0x47,0x05,
+0x62,0x10,0x00,0x00,0x8f,0x70,0x02,0x69,0x01,0x30,0x3f,0x9f,0xb1,0xd2,0x05,0xf0,
+0x01,0xd0,0x00,0x3f,0x80,0x2d,0xd1,0x12,0x22,0x22,0x7d,0x00,0x2f,0xd1,0x11,0x3a,
+0x0c,0xb5,0x01,0x21,0x01,0xcf,0x34,0x00,0xf0,0x54,0x00,0x6d,0x00,0x00,0x23,0xf2,
+0x20,0x66,0x66,0x66,0x6a,0xe6,0x10,0x00,0x1f,0x00,0x0b,0xcc,0xcf,0xdc,0xcc,0xc1,
+0x0e,0xff,0xff,0xf9,0x03,0x00,0xe5,0x00,0x12,0x00,0x44,0x5f,0x54,0x26,0xf3,0x0e,
+0x50,0x1d,0xc0,0x04,0x51,0xf0,0x94,0x07,0xe2,0xe9,0x4e,0x90,0x00,0x5a,0x1f,0x0e,
+0x10,0x06,0x5f,0xff,0x50,0x00,0x01,0xe1,0xf3,0xc0,0x00,0x9f,0xf9,0xf8,0x00,0x00,
+0x0b,0x1f,0x35,0x14,0xec,0x2e,0x54,0xfa,0x10,0x00,0x26,0xfc,0xfd,0xf9,0x00,0xe5,
+0x03,0xcf,0x40,0xff,0xda,0x62,0x03,0x02,0x3f,0x50,0x00,0x50,0x04,0xc1,0x00,0x21,
+0x8f,0xd2,0x49,0x01,0x12,0x22,0xe7,0x05,0x33,0x00,0x09,0xff,0x56,0x02,0x23,0x09,
+0xd0,0x64,0x01,0x74,0x09,0xd3,0x33,0x33,0x33,0x33,0x10,0x1b,0x00,0x18,0x70,0x1b,
+0x00,0x01,0x54,0x01,0x50,0x60,0x00,0x00,0x09,0xe5,0x67,0x01,0x16,0x20,0x1b,0x00,
+0x13,0xef,0xfc,0x00,0xf0,0x04,0xe0,0x44,0x4e,0xb4,0x47,0xf8,0x44,0x44,0x87,0x40,
+0x00,0x0d,0x80,0x00,0xbd,0x00,0x08,0xf9,0x00,0x09,0x00,0x41,0x2f,0xa4,0xdd,0x30,
+0x09,0x00,0x30,0x03,0xff,0x80,0xe7,0x02,0x50,0x80,0x14,0x87,0x3e,0xe7,0xbb,0x03,
+0xa0,0xdd,0xff,0xb5,0x01,0x9f,0xea,0x50,0x00,0x8f,0xb7,0x4e,0x03,0x23,0x8d,0xe1,
+0xe2,0x01,0x02,0x31,0x05,0x00,0x5c,0x01,0x10,0x03,0x22,0x01,0xf0,0x2a,0x7f,0xff,
+0xff,0xf5,0x3f,0x20,0x00,0x7d,0x07,0xd0,0x00,0x0f,0x53,0xf5,0x33,0x39,0xd0,0x7e,
+0x33,0x34,0xf5,0x3f,0xcc,0xcc,0xed,0x07,0xfc,0xcc,0xcf,0x53,0xf2,0x00,0x07,0xd0,
+0x7d,0x00,0x00,0xf5,0x3f,0xff,0xff,0xfd,0x07,0xfe,0xee,0xef,0x53,0xf4,0x22,0x22,
+0x10,0x12,0x22,0x23,0xf5,0x3f,0x20,0xa6,0x00,0xa0,0x52,0x0f,0x53,0xf2,0x0c,0xdf,
+0xed,0xdf,0xdd,0x50,0x44,0x00,0xf0,0x01,0xe4,0x00,0xf3,0x00,0x0f,0x53,0xf2,0x13,
+0x3f,0x73,0x4f,0x63,0x30,0xf5,0x3f,0x25,0xb5,0x00,0xf2,0x00,0xfc,0x0f,0x53,0xf2,
+0x00,0x2f,0x20,0x0f,0x30,0x00,0xf5,0x3f,0x20,0x08,0xd0,0x22,0x00,0xf0,0x00,0x05,
+0xf4,0x00,0x0f,0x33,0x78,0xf4,0x3f,0x20,0xb5,0x00,0x00,0xf3,0x4e,0xea,0x91,0x00,
+0x23,0x10,0x01,0x91,0x00,0x22,0x80,0xef,0x91,0x00,0xf0,0x15,0xb8,0x0e,0x70,0x00,
+0x1f,0x53,0xf5,0x22,0x2c,0x80,0xe8,0x22,0x24,0xf5,0x3f,0xed,0xdd,0xf8,0x0e,0xed,
+0xdd,0xdf,0x53,0xf2,0x00,0x0b,0x80,0xe7,0x00,0x01,0xf5,0x3f,0xee,0xee,0xf8,0x0e,
+0x91,0x00,0x50,0xf5,0x22,0x22,0x10,0x22,0x22,0x00,0xa1,0x20,0x02,0x22,0x22,0x21,
+0x00,0x1f,0x53,0xf2,0x00,0xf9,0x01,0x20,0xf5,0x3f,0x75,0x00,0x11,0x8d,0x11,0x00,
+0x32,0xf4,0x11,0x19,0x11,0x00,0x00,0x2f,0x02,0x00,0x11,0x00,0x32,0xf3,0x00,0x08,
+0x11,0x00,0x32,0x63,0x33,0xad,0x33,0x00,0xd6,0xee,0xee,0xe7,0x68,0xf4,0x3f,0x20,
+0x0a,0x20,0x00,0x00,0xef,0xea,0x5d,0x04,0xa0,0x01,0x11,0x20,0x00,0x00,0x0a,0x80,
+0x00,0x00,0x5f,0x69,0x02,0xf1,0x2e,0x5f,0xb0,0x00,0x00,0x5e,0x22,0xd8,0x00,0x04,
+0xf7,0xda,0x00,0x00,0x5e,0x03,0xf2,0x00,0x4f,0x70,0x1d,0xb1,0x00,0x5e,0x09,0xb0,
+0x08,0xf8,0x00,0x02,0xde,0x50,0x5e,0x0f,0x41,0xde,0x61,0x11,0x11,0x2b,0xf4,0x5e,
+0x3f,0x30,0x62,0xff,0xff,0xff,0xf6,0x40,0x5e,0x07,0xe0,0x00,0x22,0x2e,0x92,0x20,
+0x00,0x5e,0x00,0xd6,0xa4,0x01,0xe0,0x00,0x5e,0x00,0x9a,0x45,0x55,0x5e,0xa5,0x55,
+0x50,0x5e,0x00,0x7c,0xcf,0x21,0x01,0xf0,0x20,0xf2,0x5e,0x24,0xda,0x00,0x10,0x0d,
+0x80,0x20,0x00,0x5e,0x8f,0xc2,0x05,0xf2,0x0d,0x82,0xf6,0x00,0x5e,0x00,0x00,0x1e,
+0x80,0x0d,0x80,0x4f,0x40,0x5e,0x00,0x00,0xcc,0x00,0x0d,0x80,0x08,0xe1,0x5e,0x00,
+0x02,0xb1,0x13,0x4e,0x70,0x00,0x81,0x5e,0xd6,0x08,0x2e,0xfd,0x30,0x07,0x05,0x01,
+0x3f,0x03,0x32,0xe3,0x00,0xc6,0x0a,0x00,0x23,0xdc,0x00,0x4a,0x06,0x11,0x7f,0x3a,
+0x02,0x80,0xfb,0x00,0x00,0x4f,0xc2,0x22,0x2b,0xb2,0x96,0x02,0xf2,0x06,0x4f,0xfc,
+0x33,0x33,0xcb,0x33,0x33,0x30,0x00,0x1f,0xbb,0xec,0xcc,0xce,0xec,0xcc,0xcc,0x00,
+0x00,0x40,0xab,0x14,0x09,0x42,0x00,0x00,0x0a,0xff,0x99,0x08,0x00,0x7e,0x04,0x28,
+0x00,0xaa,0x13,0x00,0x70,0xf6,0x00,0x00,0x57,0x22,0x26,0xf5,0x7a,0x03,0x96,0x03,
+0x33,0x33,0x33,0x6f,0x53,0x33,0x33,0x33,0x9a,0x02,0x00,0x6a,0x00,0x30,0xbf,0xbe,
+0x70,0x30,0x00,0xf1,0x05,0x27,0xec,0x33,0xf2,0x3c,0xe8,0x20,0x00,0x17,0xcf,0xb5,
+0x00,0x3f,0x20,0x04,0xaf,0xd8,0x10,0x97,0x10,0xd9,0x03,0xf0,0x1c,0x06,0x70,0x00,
+0x06,0x90,0x00,0x00,0x2a,0x26,0x00,0x00,0x33,0x37,0xf4,0x33,0x20,0x7b,0x2f,0x20,
+0x00,0xde,0xee,0xee,0xee,0xa0,0xd6,0x0b,0x90,0x00,0x06,0x02,0x04,0x26,0x03,0xf6,
+0x48,0x74,0x40,0x1f,0x2c,0x8d,0x4f,0x0b,0x53,0x00,0xe1,0x1f,0x05,0xf9,0x3f,0x4f,
+0xf0,0x0e,0x40,0x00,0x1f,0x4e,0x3c,0x8f,0x8e,0x09,0x00,0xf0,0x07,0x34,0x12,0x5f,
+0x16,0xf3,0x3f,0x73,0x20,0x1e,0xee,0xfe,0xee,0x04,0xff,0xff,0xff,0xa0,0x00,0x02,
+0xf0,0x00,0x04,0x1b,0x00,0x50,0xaf,0xef,0xfe,0xef,0x84,0x09,0x00,0xf2,0x07,0xa7,
+0x0d,0x44,0x09,0x84,0xfe,0xef,0xee,0x80,0xa7,0x4d,0x0c,0x19,0x84,0xf5,0x5f,0x85,
+0x30,0xa7,0xdc,0xae,0x79,0x1b,0x00,0x32,0x98,0x53,0xc9,0x09,0x00,0x40,0x00,0x02,
+0x4b,0x84,0x99,0x03,0x60,0xa7,0x00,0x03,0xcb,0x34,0xf5,0xfa,0x09,0x04,0xb3,0x04,
+0x12,0x04,0xd0,0x00,0x14,0xf8,0xad,0x05,0x41,0x00,0x00,0x4d,0xdd,0xec,0x07,0xf1,
+0x16,0xdd,0x80,0x5e,0x22,0x22,0x23,0xf5,0x22,0x22,0x2b,0x90,0x5e,0x1d,0xdd,0xc1,
+0xf3,0xad,0xdd,0x4a,0x90,0x4c,0x00,0x00,0x01,0xf3,0x00,0x00,0x09,0x80,0x00,0x6e,
+0xee,0xd1,0xf3,0xae,0xee,0xb0,0x30,0x01,0x11,0x82,0x06,0x00,0x02,0x49,0x0a,0xf0,
+0x0c,0xf0,0x00,0x00,0xba,0x11,0x13,0xf3,0x11,0x15,0xf0,0x00,0x00,0xbe,0xbb,0xbc,
+0xfc,0xbb,0xbc,0xf0,0x00,0x00,0xbb,0x33,0x36,0xf6,0x33,0x37,0x1b,0x00,0x30,0x00,
+0x03,0xf3,0x32,0x07,0x04,0x2d,0x00,0x91,0xa2,0x00,0x76,0x00,0x02,0xf5,0x11,0x11,
+0x14,0x06,0x05,0x58,0xaf,0xff,0xff,0xff,0x90,0x3d,0x06,0x11,0x5f,0x26,0x04,0xf0,
+0x06,0xdd,0xdd,0xde,0xfd,0xdd,0xdd,0xd9,0x00,0x24,0x44,0x44,0x8f,0x44,0x44,0x44,
+0x20,0x00,0x11,0x11,0x17,0xf2,0xbb,0x00,0x02,0x23,0x05,0x01,0x77,0x06,0x00,0x54,
+0x00,0x14,0x00,0x92,0x05,0x23,0xfa,0x22,0x01,0x00,0x50,0x10,0x01,0x44,0x44,0x44,
+0xb7,0x09,0xb3,0x00,0x4f,0xdc,0xcc,0xcc,0xcc,0xdf,0x20,0x00,0x04,0xf2,0x74,0x05,
+0x11,0x4f,0x2a,0x00,0x11,0x20,0x90,0x05,0x02,0x11,0x00,0xe0,0xed,0xdd,0xdd,0xdd,
+0xef,0x20,0x00,0x04,0xf3,0x22,0x22,0x22,0x25,0xf2,0xa8,0x09,0x42,0x00,0x00,0x33,
+0x6f,0x22,0x00,0x30,0x0d,0xed,0xa0,0x66,0x00,0x43,0x30,0x00,0x31,0x00,0xb5,0x05,
+0x19,0xf6,0x09,0x00,0x00,0x58,0x00,0x10,0xf7,0x0c,0x09,0x21,0xff,0xff,0x8c,0x03,
+0xae,0xc0,0x25,0x55,0x58,0xf2,0x00,0xfa,0x55,0x55,0x40,0x2d,0x00,0x13,0x2f,0x24,
+0x00,0xae,0x60,0x06,0x66,0x68,0xf2,0x00,0xfa,0x66,0x66,0x20,0x24,0x00,0x31,0x56,
+0x66,0x69,0x1b,0x00,0x23,0x60,0xdf,0x2d,0x00,0x1e,0xf1,0x75,0x00,0x0e,0x09,0x00,
+0x05,0x01,0x00,0x22,0x56,0x66,0x01,0x00,0x22,0x5b,0xee,0x57,0x06,0x10,0xed,0xd5,
+0x02,0x13,0xe0,0x1d,0x00,0x27,0xe9,0x00,0x2b,0x01,0xf0,0x0a,0x00,0xea,0x55,0xea,
+0x55,0x5b,0xd5,0x5a,0xf0,0x0e,0x60,0x0d,0x60,0x00,0x8b,0x00,0x6f,0x00,0xe6,0x00,
+0xd9,0x44,0x4a,0xb0,0x06,0x11,0x00,0x31,0xed,0xdd,0xfb,0x11,0x00,0x32,0xd6,0x00,
+0x08,0x11,0x00,0x31,0x83,0x33,0xab,0x11,0x00,0x58,0xdf,0xff,0xff,0xb0,0x06,0x33,
+0x00,0x03,0x22,0x00,0x06,0x55,0x00,0x00,0x01,0x00,0x91,0x5a,0xf0,0x00,0x00,0xc7,
+0x00,0x00,0x02,0xd3,0xd7,0x09,0x61,0x70,0x00,0x25,0x8f,0x75,0x54,0x79,0x00,0xf0,
+0x0a,0x75,0xbd,0xfb,0xbd,0xc0,0x00,0x44,0x4e,0xa4,0x42,0x00,0x7e,0x00,0x6c,0x00,
+0x00,0x00,0xe8,0x00,0x1b,0xbe,0xfb,0xbd,0xfb,0x10,0x3f,0x01,0xf1,0x25,0x77,0x77,
+0x77,0x77,0x71,0x06,0xd1,0x11,0x4f,0x10,0xaa,0xaa,0xaa,0xa3,0x00,0x6d,0x33,0x36,
+0xf1,0x1f,0xa8,0x88,0x8f,0x50,0x06,0xfc,0xcc,0xdf,0x11,0xf3,0x00,0x00,0xf5,0x00,
+0x6c,0x00,0x02,0xf1,0x1f,0xba,0xaa,0xaf,0x50,0x06,0xfe,0xee,0xff,0x10,0x22,0x28,
+0xe2,0x20,0x5f,0x00,0xf0,0x00,0xce,0xee,0xff,0xee,0xe1,0x05,0x55,0xea,0x55,0x33,
+0x95,0x38,0xf3,0x33,0x01,0x08,0x02,0xe1,0x0f,0x40,0x6e,0x00,0x00,0x03,0x33,0xe9,
+0x33,0x20,0xf6,0x49,0xf4,0x44,0x26,0x00,0x80,0x2d,0xdd,0xef,0xdd,0xd1,0x00,0x00,
+0xd7,0x3e,0x07,0x04,0x12,0x01,0x0c,0x01,0x00,0x13,0x8d,0xb9,0x0c,0x20,0x25,0xf7,
+0xbb,0x0a,0x13,0xdf,0xf1,0x03,0xf0,0x01,0x01,0x12,0xc4,0x11,0x11,0x15,0xd4,0x11,
+0x00,0x00,0x0c,0xb0,0x00,0x00,0xbe,0x00,0xef,0x01,0x45,0x10,0x00,0x2f,0x60,0x4c,
+0x01,0x23,0xfd,0x55,0x01,0x00,0x15,0x40,0x4a,0x00,0x13,0x5f,0x26,0x0a,0x20,0x05,
+0xf4,0x88,0x02,0x13,0xf6,0xd2,0x02,0x90,0x0f,0x60,0x00,0x05,0xfd,0xdd,0xdd,0xdd,
+0xdd,0x11,0x00,0x00,0x19,0x00,0x22,0x4f,0x60,0xc1,0x02,0x18,0x00,0x11,0x00,0x04,
+0x84,0x04,0x14,0x10,0xc5,0x06,0x40,0x2f,0x00,0x00,0xf2,0x36,0x00,0xf1,0x0e,0xc0,
+0x02,0xf0,0x92,0x0f,0x26,0x66,0x8f,0x86,0x65,0x00,0x2f,0x0c,0x30,0xf2,0x00,0x06,
+0xf0,0x00,0x00,0x02,0xf0,0xc3,0x0f,0x24,0xcc,0xef,0xcc,0xc5,0x13,0x00,0x10,0x5f,
+0x42,0x00,0x00,0x13,0x00,0x20,0x25,0xe0,0x77,0x08,0x01,0x13,0x00,0x32,0xdd,0xdd,
+0xdf,0x13,0x00,0xa0,0xe2,0x22,0x22,0xe6,0x00,0x3e,0x0c,0x30,0xf2,0x5e,0xca,0x0b,
 0x51,0x04,0xe0,0xc3,0x0f,0x25,0x69,0x00,0x14,0x4d,0x13,0x00,0xb0,0x05,0xc0,0xc3,
 0x0f,0x25,0xe1,0x11,0x11,0xe6,0x00,0x7b,0x39,0x00,0x00,0xc1,0x00,0x81,0x0a,0x80,
-0xb3,0x0f,0x20,0x06,0x20,0x15,0x7e,0x0b,0x60,0xf2,0x1a,0xf5,0x05,0xfb,0x10,0xf3,
-0x60,0x60,0x8e,0xd3,0x00,0x02,0xdd,0x10,0x6b,0x07,0x11,0x60,0xf7,0x8c,0x04,0x82,
-0x12,0x00,0x65,0x9c,0x21,0xf5,0xaf,0x26,0x05,0x10,0xe5,0x61,0x20,0xf0,0x04,0x5f,
-0x21,0x11,0x00,0x0e,0xa7,0x77,0xf5,0x03,0x39,0xd3,0x33,0x00,0x00,0xeb,0x88,0x8f,
-0x50,0xfd,0xe0,0x22,0x60,0x0e,0x72,0x22,0xf5,0x0f,0x40,0xe7,0x20,0x45,0xcd,0xdd,
-0xdd,0x40,0xd8,0x2b,0x00,0xe2,0xab,0x11,0x20,0x06,0x66,0x01,0x26,0x00,0xf1,0x23,
-0x11,0x15,0xe1,0x11,0x0f,0x73,0x33,0x5f,0x20,0x00,0xa5,0x4e,0x00,0x00,0xf9,0x55,
-0x57,0xf2,0x00,0x0d,0x54,0xfd,0xdd,0x1a,0xaa,0xaa,0xaa,0x10,0x00,0xf7,0x4f,0x33,
-0x30,0x1c,0x60,0x6c,0x20,0x00,0x1f,0xf7,0xe0,0x00,0x3d,0xb0,0x00,0x9e,0x30,0x05,
-0xe6,0xfe,0xc2,0x5b,0xfb,0x01,0x8d,0x00,0xb9,0x06,0xed,0x95,0x63,0x32,0x23,0x33,
-0x40,0x1f,0x20,0x00,0x6a,0xde,0x68,0x32,0x11,0xef,0xf5,0x04,0x20,0x04,0xb0,0x64,
-0xa0,0x50,0x56,0x55,0x5c,0xa4,0xe5,0x54,0xc4,0xf0,0x0d,0xc3,0xd8,0x00,0x7f,0xf9,
-0x00,0x00,0x27,0xbf,0xe8,0x2d,0x80,0x04,0xf7,0xde,0x40,0x06,0xba,0xf0,0x00,0xd8,
-0x00,0x0e,0x70,0x62,0x00,0x00,0x4f,0xcb,0x06,0x60,0x8e,0x30,0xa0,0x00,0x04,0xf0,
-0x86,0x4d,0x23,0xaf,0xce,0xbc,0x25,0xc0,0xb0,0x38,0x40,0x05,0x59,0xf5,0x55,0xeb,
-0x55,0xac,0x03,0xc2,0x26,0x0b,0x51,0x0d,0x80,0x06,0xe4,0xe7,0x83,0x70,0x41,0xd8,
-0x00,0x5f,0xfb,0xf0,0x37,0x40,0x0d,0x80,0x03,0xf6,0x70,0xb6,0x10,0x30,0x4c,0x00,
-0x50,0x60,0x42,0x00,0x0d,0xb0,0x4c,0x00,0x41,0x9d,0x00,0x71,0x0a,0x17,0xab,0x52,
-0x01,0xeb,0x2d,0x21,0xd4,0xce,0x08,0x15,0xdf,0x90,0x7d,0x19,0x21,0xdc,0x45,0x14,
-0x9d,0x65,0x26,0x00,0xe8,0x37,0x14,0x1e,0xaf,0x23,0x04,0x77,0x0a,0x02,0xeb,0x59,
-0x00,0x3c,0x1f,0x01,0x5c,0xa7,0x13,0x9f,0xfd,0x3d,0x24,0x08,0xf0,0xc8,0x4f,0x07,
-0x74,0x36,0x03,0x3c,0x00,0x21,0x03,0xf5,0x98,0x17,0x40,0x38,0xf0,0x3f,0x10,0x03,
-0x20,0xe0,0x10,0x6f,0x03,0xf1,0x0b,0xec,0xcc,0xcc,0xf3,0x06,0xf0,0x3f,0x10,0xb8,
-0x69,0x37,0x00,0x11,0x00,0x31,0xfd,0xdd,0xde,0x11,0x00,0x20,0xba,0x22,0xe2,0x2e,
-0x20,0x03,0xf1,0x8e,0xd7,0x34,0x05,0xdc,0x80,0x7a,0x07,0x22,0x7c,0x80,0xc8,0x1c,
-0x12,0x9e,0x61,0x00,0x22,0x26,0xbf,0xfe,0x05,0x12,0x38,0x30,0x03,0x05,0xbc,0x5b,
-0x12,0xf0,0x62,0x06,0x31,0xfe,0xaa,0xff,0x75,0x05,0x40,0xfd,0x83,0x00,0x6f,0x13,
-0x00,0x50,0xfb,0x61,0x00,0x00,0x06,0x13,0x00,0x11,0xf2,0x49,0x03,0x13,0xf0,0xb8,
-0x45,0x0f,0x13,0x00,0x08,0x32,0x18,0xde,0xef,0x13,0x00,0x10,0x0d,0x33,0x42,0x31,
-0x78,0x9f,0xf2,0x3c,0x13,0x10,0xf6,0xc6,0x05,0x00,0x65,0x20,0x12,0xf8,0x26,0x05,
-0x44,0x05,0xac,0xa4,0x0c,0x35,0x37,0x44,0x00,0x1a,0xff,0xfb,0xf2,0x01,0x06,0x08,
-0x00,0x01,0x13,0x06,0x42,0x42,0x00,0x2e,0x41,0x9d,0x03,0x90,0xb1,0x4e,0xff,0xff,
-0xfd,0x88,0x88,0x88,0x8a,0x01,0x9c,0x01,0x48,0xce,0x61,0x2f,0xb2,0x5f,0xf3,0x03,
-0xf8,0xe9,0x82,0x41,0x03,0xff,0xa8,0xaf,0x13,0x00,0x51,0xd8,0xaf,0xfc,0xbc,0xf9,
-0x7c,0xc1,0x42,0xbc,0xff,0x30,0x3f,0x7f,0x5b,0x40,0x3f,0xf3,0x04,0xfe,0x5c,0x2d,
-0x23,0xfa,0x03,0x09,0x3d,0x00,0x1b,0x5a,0x11,0x47,0x39,0x00,0x61,0xfc,0x46,0xff,
-0x30,0x3f,0x80,0x03,0x13,0x41,0x3f,0xf8,0x69,0xf8,0x4c,0xe9,0x50,0x68,0xff,0xed,
-0xef,0xfc,0x86,0x06,0x42,0xfd,0xef,0xc3,0x03,0xa8,0x06,0x61,0x03,0xc0,0x7a,0xaa,
-0xa2,0x09,0x36,0x19,0x54,0x7f,0xff,0xff,0x84,0xff,0xac,0xc7,0x04,0x36,0x92,0x04,
-0x13,0x00,0x42,0xdf,0xff,0xf6,0x2f,0x85,0x04,0x23,0x11,0x11,0xfc,0x0f,0x41,0x8b,
-0xbb,0xb3,0x0a,0x23,0xc7,0x1f,0x8f,0x39,0x00,0x12,0x15,0xd0,0x03,0x02,0x0f,0x39,
-0x00,0x26,0x1b,0x00,0x4a,0x01,0x01,0x05,0xf8,0x03,0x6e,0x2f,0x14,0xb0,0x09,0x00,
-0x15,0xfd,0x09,0x00,0x24,0x10,0x26,0x09,0x00,0x23,0x2e,0xfa,0x09,0x00,0x32,0x0e,
-0xff,0xfa,0x09,0x00,0x41,0x00,0xaf,0xff,0xfa,0x09,0x00,0x00,0x09,0x08,0x12,0xfa,
-0x09,0x00,0x01,0x13,0x08,0x02,0xf7,0xc3,0x14,0xbf,0x09,0x00,0x23,0x00,0xbf,0x09,
-0x00,0x00,0x90,0xe7,0x14,0x10,0x22,0x14,0x12,0x10,0x12,0xb4,0x10,0xb1,0xd4,0x51,
-0x30,0x10,0xcf,0xfc,0x63,0x22,0xf2,0x02,0xd0,0xef,0xff,0xc0,0x00,0xbf,0xff,0xe0,
-0x3e,0xff,0xfc,0x1b,0xff,0xff,0x30,0x03,0xef,0xb9,0x13,0x12,0x3e,0x67,0x23,0x12,
-0x03,0xa9,0x5e,0x11,0x0b,0xaf,0xfb,0x01,0x68,0x00,0x10,0xc0,0x8a,0x4e,0xf1,0x05,
+0xb3,0x0f,0x20,0x06,0x20,0x15,0x7e,0x0b,0xf0,0x01,0xf2,0x1a,0xf5,0x05,0xfb,0x10,
+0x3f,0x00,0x00,0x0f,0x8e,0xd3,0x00,0x02,0xdd,0x10,0x6b,0x07,0x50,0x60,0x00,0x00,
+0x01,0x60,0x54,0x04,0x02,0xab,0x00,0x51,0x0e,0xfe,0xee,0xf5,0xaf,0x26,0x05,0xf0,
+0x1c,0xe5,0x00,0x0f,0x51,0x11,0x5f,0x21,0x11,0x00,0x0e,0xa7,0x77,0xf5,0x03,0x39,
+0xd3,0x33,0x00,0x00,0xeb,0x88,0x8f,0x50,0xfd,0xcc,0xcd,0xf2,0x00,0x0e,0x72,0x22,
+0xf5,0x0f,0x40,0x00,0x2f,0x20,0x00,0xcd,0xdd,0xdd,0x40,0xff,0xeb,0x02,0x01,0x1f,
+0x01,0x10,0x50,0x3e,0x07,0x00,0x94,0x00,0x01,0x26,0x00,0xf0,0x26,0x11,0x15,0xe1,
+0x11,0x0f,0x73,0x33,0x5f,0x20,0x00,0xa5,0x4e,0x00,0x00,0xf9,0x55,0x57,0xf2,0x00,
+0x0d,0x54,0xfd,0xdd,0x1a,0xaa,0xaa,0xaa,0x10,0x00,0xf7,0x4f,0x33,0x30,0x1c,0x60,
+0x6c,0x20,0x00,0x1f,0xf7,0xe0,0x00,0x3d,0xb0,0x00,0x9e,0x30,0x05,0xe6,0xfe,0x00,
+0x3f,0x80,0xc5,0x01,0xe1,0xb9,0x06,0xed,0x95,0x63,0x32,0x23,0x33,0x40,0x1f,0x20,
+0x00,0x6a,0xde,0x99,0x02,0x04,0xf9,0x09,0x03,0x62,0x08,0xf0,0x1d,0xf8,0x04,0xb0,
+0x00,0x04,0x55,0x55,0x56,0x55,0x5c,0xa4,0xe5,0x00,0x00,0x00,0x16,0xc3,0xd8,0x00,
+0x7f,0xf9,0x00,0x00,0x27,0xbf,0xe8,0x2d,0x80,0x04,0xf7,0xde,0x40,0x06,0xba,0xf0,
+0x00,0xd8,0x00,0x0e,0x70,0x62,0x00,0x00,0x4f,0xcb,0x06,0x50,0x8e,0x30,0xa0,0x00,
+0x04,0x13,0x00,0x42,0x00,0xaf,0xce,0x00,0xf5,0x01,0xc0,0xb0,0x38,0x40,0x05,0x59,
+0xf5,0x55,0xeb,0x55,0xac,0x03,0xc2,0x26,0x0b,0xf0,0x00,0x0d,0x80,0x06,0xe4,0xe7,
+0x00,0x00,0x09,0xc0,0x00,0xd8,0x00,0x5f,0xfb,0x10,0xdc,0x02,0x90,0x0d,0x80,0x03,
+0xf6,0xbf,0x60,0x00,0x4f,0x30,0x4c,0x00,0x50,0x60,0x42,0x00,0x0d,0xb0,0x4c,0x00,
+0xe2,0x9d,0x00,0x71,0x0a,0xf3,0x00,0x00,0xd8,0x00,0x01,0xeb,0x2d,0x21,0xd4,0xce,
+0x08,0xc0,0xdf,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x62,0x00,
+0x00,0x00,0x00,0x10,0x00,0x01,0x00,0x10,0x9d,0x05,0x00,0xa2,0x11,0x11,0x11,0x16,
+0xf5,0x11,0x11,0x11,0x1e,0xff,0x01,0x00,0x23,0xf9,0x11,0x01,0x00,0x30,0x00,0x00,
+0xdd,0x01,0x00,0xf1,0x06,0xd0,0x00,0x00,0x0f,0x73,0x33,0x33,0x33,0x9f,0x00,0x00,
+0x00,0xf5,0x00,0x00,0x00,0x08,0xf0,0x00,0x00,0x0f,0x2a,0x00,0x15,0x00,0x01,0x00,
+0x13,0x3f,0x3c,0x00,0x30,0x03,0xf5,0x33,0x01,0x00,0xf0,0x0b,0x38,0xf0,0x3f,0x10,
+0x34,0x44,0x44,0x44,0x10,0x6f,0x03,0xf1,0x0b,0xec,0xcc,0xcc,0xf3,0x06,0xf0,0x3f,
+0x10,0xb8,0x00,0x00,0x0f,0x30,0x11,0x00,0x31,0xfd,0xdd,0xde,0x11,0x00,0xf3,0x00,
+0xba,0x22,0x22,0x22,0x22,0x8f,0x03,0xf1,0x06,0x50,0x00,0x00,0x05,0xdc,0x80,0x4b,
+0x00,0x22,0x03,0x7c,0x0a,0x00,0x22,0x05,0x9e,0x61,0x00,0xa3,0x26,0xbf,0xff,0xff,
+0xff,0xf0,0x00,0x00,0x38,0xdf,0x74,0x00,0x12,0x2f,0x6b,0x00,0x30,0xf0,0x00,0x04,
+0x07,0x00,0xc0,0xfe,0xaa,0xff,0x00,0x00,0x4f,0xff,0xff,0xfd,0x83,0x00,0x6f,0x13,
+0x00,0x50,0xfb,0x61,0x00,0x00,0x06,0x13,0x00,0x10,0xf2,0x3d,0x00,0x01,0x13,0x00,
+0x2f,0x20,0x00,0x13,0x00,0x0a,0x32,0x18,0xde,0xef,0x13,0x00,0xf2,0x15,0x0d,0xff,
+0xff,0xff,0x02,0x78,0x9f,0xf2,0x00,0x01,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0x20,
+0x00,0x0b,0xff,0xff,0xf8,0xff,0xff,0xff,0xf1,0x00,0x00,0x05,0xac,0xa4,0x0c,0xff,
+0xff,0xfe,0xa4,0x00,0x43,0x1a,0xff,0xfb,0x20,0xaf,0x00,0x06,0x08,0x00,0x10,0x44,
+0x01,0x00,0x51,0x42,0x00,0x2e,0x41,0x5f,0xa0,0x00,0xe0,0xb1,0x4e,0xff,0xff,0xfd,
+0x88,0x88,0x88,0x8a,0xff,0xff,0xff,0x52,0x6f,0xd4,0x00,0xf1,0x00,0x2f,0xb2,0x5f,
+0xf3,0x03,0xf8,0x00,0x00,0x00,0x02,0xfa,0x03,0xff,0xa8,0xaf,0x13,0x00,0x50,0xd8,
+0xaf,0xfc,0xbc,0xf9,0xf6,0x00,0x42,0xfe,0xbc,0xff,0x30,0x46,0x01,0xe1,0xa0,0x3f,
+0xf3,0x04,0xfe,0xcc,0xcc,0xcc,0xcd,0xfa,0x03,0xff,0xff,0xff,0x26,0x00,0x41,0xff,
+0xff,0xf7,0x47,0x39,0x00,0x51,0xfc,0x46,0xff,0x30,0x3f,0x13,0x00,0x41,0xa0,0x3f,
+0xf8,0x69,0x13,0x00,0xe1,0xfd,0x68,0xff,0xed,0xef,0xfc,0xcc,0xcc,0xcc,0xdf,0xfd,
+0xef,0xc3,0x03,0x42,0x00,0x80,0xfa,0x03,0xc0,0x7a,0xaa,0xa2,0x09,0xaa,0x01,0x00,
+0x53,0x7f,0xff,0xff,0x84,0xff,0x01,0x00,0x24,0xf8,0x4f,0x0a,0x00,0x03,0x13,0x00,
+0x32,0xdf,0xff,0xf6,0x4e,0x01,0x50,0xe0,0x11,0x11,0x00,0x01,0xf4,0x01,0x60,0x10,
+0x8b,0xbb,0xb3,0x0a,0xbb,0x01,0x00,0x1f,0x8f,0x39,0x00,0x12,0x15,0xd0,0x03,0x02,
+0x0f,0x39,0x00,0x26,0x1b,0x00,0x4a,0x01,0x34,0x00,0x6f,0xc0,0x09,0x00,0x24,0xff,
+0xb0,0x09,0x00,0x15,0xfd,0x09,0x00,0x24,0x10,0x26,0x09,0x00,0x23,0x2e,0xfa,0x09,
+0x00,0x32,0x0e,0xff,0xfa,0x09,0x00,0x42,0x00,0xaf,0xff,0xfa,0x09,0x00,0x42,0x00,
+0xbf,0xff,0xfa,0x09,0x00,0x10,0x00,0x40,0x02,0x11,0xfd,0xf2,0x02,0x14,0xbf,0x09,
+0x00,0x24,0x00,0xbf,0x09,0x00,0x34,0x00,0xbf,0xfd,0x0d,0x03,0x12,0xad,0x09,0x00,
+0xf0,0x22,0x1b,0xb1,0x00,0x00,0x00,0xab,0x10,0xcf,0xfc,0x00,0x00,0x0b,0xff,0xd0,
+0xef,0xff,0xc0,0x00,0xbf,0xff,0xe0,0x3e,0xff,0xfc,0x1b,0xff,0xff,0x30,0x03,0xef,
+0xff,0xff,0xff,0xf3,0x00,0x00,0x3e,0xff,0xff,0xff,0x30,0x00,0x00,0x03,0xff,0xff,
+0xf4,0x00,0x00,0x25,0x02,0x13,0xfc,0x68,0x00,0xf0,0x11,0xc0,0x00,0x0c,0xff,0xff,
 0x6e,0xff,0xfc,0x10,0xbf,0xff,0xf3,0x03,0xef,0xff,0xc0,0xef,0xff,0x30,0x00,0x3e,
-0xff,0xf0,0x4f,0xf3,0x99,0xd4,0x25,0x01,0x10,0x77,0x9c,0x25,0x7a,0x60,0x90,0x61,
-0x02,0xcf,0x12,0x60,0xb3,0x00,0xff,0xf0,0x04,0xb1,0x54,0x00,0xf0,0x09,0xd0,0x0f,
-0xff,0x00,0xef,0xe2,0x00,0x01,0xef,0xfe,0x00,0xff,0xf0,0x1e,0xff,0xd0,0x00,0x9f,
-0xfe,0x20,0x0f,0xff,0x00,0x3e,0xf5,0xf8,0x20,0x40,0x00,0xe5,0x33,0x10,0xff,0xdc,
-0xcd,0x00,0x39,0x00,0x50,0xcf,0xf5,0x9f,0xf6,0x00,0x13,0x00,0x51,0x07,0xff,0x8b,
-0xff,0x40,0x13,0x00,0x30,0x5f,0xfa,0xbf,0x63,0x9e,0x50,0xc0,0x00,0x05,0xff,0x99,
-0x15,0x0d,0x00,0xdd,0x0d,0x33,0xf8,0x5f,0xfd,0x37,0xb8,0x32,0x40,0xff,0xf6,0x89,
-0x91,0x41,0xe0,0x07,0xff,0xf5,0x04,0x03,0x80,0xf6,0x00,0x0b,0xff,0xfa,0x30,0x00,
-0x3b,0xd9,0x0a,0x00,0x9b,0x22,0x02,0xcc,0x00,0x14,0x09,0x2a,0xb5,0x00,0x2d,0x10,
-0x2c,0xfd,0x82,0xd5,0x14,0x25,0x34,0x31,0xed,0xb8,0x14,0xb0,0xc7,0x00,0x12,0xfb,
-0x76,0x96,0x10,0x29,0x1b,0x14,0x41,0x61,0x00,0x01,0xef,0x77,0x01,0x44,0xdf,0xb0,
-0x00,0xbf,0x78,0xa4,0x15,0x2f,0xef,0x30,0x00,0xa4,0x8a,0xb0,0x03,0xdf,0xff,0xff,
-0xd1,0x01,0xdf,0xff,0xc0,0x00,0x01,0x7e,0x0a,0x10,0x0b,0x51,0x14,0x01,0x05,0x00,
-0x30,0xbf,0xff,0x80,0x0d,0x78,0x10,0x60,0x30,0xa8,0x00,0x59,0x04,0x10,0xfc,0x3b,
-0x88,0x30,0xfd,0x53,0x7f,0xbf,0xf6,0x14,0xff,0x5d,0x72,0x24,0x08,0xff,0xa5,0x5f,
-0x20,0x0d,0xe7,0x18,0x04,0x20,0xa9,0xf9,0x59,0x01,0x20,0x6f,0xff,0x51,0x4f,0x09,
-0x98,0x00,0x3e,0x0d,0xff,0xf9,0xc7,0xa7,0x44,0x85,0x00,0x07,0x98,0x48,0x07,0x43,
-0x90,0x0d,0xff,0x10,0x9c,0x92,0x22,0xfb,0x1d,0x0b,0x00,0x62,0xaf,0xfd,0x3a,0xff,
-0xde,0xff,0x67,0x87,0x10,0xb1,0xdc,0x4b,0x10,0x10,0xbe,0x01,0x41,0xf9,0x08,0xfc,
-0x14,0x0b,0x00,0x60,0x6f,0xff,0x60,0xbf,0xff,0xe3,0xbb,0x62,0x40,0x08,0xff,0xe4,
-0x2d,0x8e,0x9d,0x70,0xbf,0xfc,0x10,0xbf,0xfd,0x24,0xef,0xf0,0x02,0x62,0x09,0xff,
-0xe2,0x9f,0xb0,0x6f,0xc2,0x05,0x43,0x6f,0xe1,0x06,0x05,0x6b,0x83,0x44,0x03,0x20,
-0x00,0x07,0x07,0x94,0x01,0x6c,0x00,0x34,0xf5,0x44,0xcf,0x0b,0x00,0x3f,0xe0,0x00,
-0x8f,0x0b,0x00,0x08,0x10,0x05,0x2b,0x03,0x12,0x7f,0x5e,0x01,0x09,0xe1,0x9c,0x24,
-0x88,0x84,0xb2,0x93,0x24,0xff,0xd0,0xd9,0x83,0x15,0xfe,0x85,0x06,0x1f,0xe0,0x13,
-0x00,0x0e,0x74,0x36,0x66,0xef,0xff,0xe6,0x66,0x30,0x9a,0x7c,0x11,0xfc,0x4a,0xbb,
-0x04,0x2b,0x03,0x15,0x1d,0x34,0x03,0x15,0x1d,0x34,0x03,0x10,0x1d,0x09,0x00,0x00,
-0x93,0x5d,0x70,0x74,0x1c,0xfc,0x14,0x77,0x77,0x74,0x05,0x16,0x24,0x17,0x17,0x4d,
-0x84,0x3e,0x7b,0xff,0xff,0x01,0x00,0x20,0x1c,0x66,0xc3,0xea,0x03,0xe8,0x08,0x06,
-0xb0,0x26,0x22,0x00,0x03,0x07,0x62,0x06,0x20,0x83,0x16,0xe2,0xe2,0x99,0x10,0xfc,
-0xde,0x04,0x10,0xfc,0x29,0x00,0x10,0x26,0xc0,0x02,0x11,0xbf,0xbc,0x07,0x00,0x07,
-0x00,0x32,0x06,0xff,0x60,0xa5,0x11,0x53,0xfc,0x00,0x2f,0xfc,0x00,0xb9,0xce,0x51,
-0x70,0xbf,0xf4,0x22,0x20,0xc1,0x23,0x22,0xcf,0xf2,0x9e,0x0d,0x10,0x05,0x9f,0x18,
-0x02,0x1f,0x21,0x13,0x0d,0xc8,0x05,0x44,0xff,0xec,0xcc,0xcf,0x0b,0x00,0x03,0x83,
-0x0d,0x0f,0x0b,0x00,0x02,0x25,0xf5,0x6f,0x0b,0x00,0x14,0xb0,0xc7,0x11,0xb0,0x6b,
-0xa0,0x00,0x00,0x3a,0xef,0xff,0xd8,0x20,0x09,0xff,0x35,0xeb,0x00,0x4a,0x0c,0xe0,
-0x8f,0xf0,0x02,0xef,0xff,0xda,0x8a,0xef,0xff,0xd9,0xff,0x00,0xdf,0xfd,0x81,0xf5,
-0x31,0xff,0xff,0xf0,0xf8,0xa0,0x00,0x0b,0x04,0x21,0x1f,0xfe,0x1a,0xfa,0x53,0xef,
-0xff,0xf6,0xff,0x60,0xcf,0x13,0x40,0x49,0x91,0x00,0x00,0x9d,0x25,0x2f,0x99,0x80,
-0x8e,0x85,0x03,0x10,0xf3,0xf3,0x00,0x13,0xf6,0xa1,0x16,0x70,0x09,0xff,0x4f,0xff,
-0xfa,0x99,0xa2,0x0a,0x04,0x41,0xe0,0xff,0xff,0xd2,0x22,0xc6,0x10,0xf6,0xc3,0x32,
-0xf3,0x03,0x10,0x00,0x07,0xff,0xfb,0x00,0xff,0x9b,0xff,0xff,0xca,0xbf,0xff,0xfc,
-0x00,0x0f,0xf9,0x07,0x60,0x0d,0x41,0xff,0x90,0x01,0x6c,0xa5,0x03,0x29,0x04,0x52,
-0x4b,0xa3,0x01,0x64,0xa4,0x00,0x3c,0x01,0x10,0xf8,0x99,0x00,0x41,0xf8,0xbe,0xee,
-0xef,0xcd,0x06,0x0f,0x05,0x00,0x03,0x01,0xbe,0x02,0x50,0x13,0x33,0x4e,0xff,0xf8,
-0x71,0x00,0x10,0xf8,0xca,0x31,0x12,0xf7,0x98,0x04,0x02,0xb4,0x5d,0x01,0xac,0x01,
-0x12,0x70,0x07,0x00,0x03,0xc0,0xc1,0x00,0xa9,0x03,0x10,0xae,0x55,0x00,0x03,0x10,
-0x08,0x31,0x80,0x9e,0x20,0x4b,0x00,0x22,0x06,0xfd,0x0f,0x00,0x22,0x0a,0xf2,0xa1,
-0x00,0x21,0xbf,0x2f,0x0f,0x00,0x21,0x8f,0xc0,0x64,0x00,0x62,0x07,0xb1,0x01,0x44,
-0x44,0xef,0xe1,0x43,0x02,0x69,0x00,0x00,0x08,0x00,0x14,0x70,0x06,0x05,0x0f,0x10,
-0x77,0x02,0x15,0xd1,0xd2,0x00,0x12,0x08,0x94,0xc8,0x01,0xd8,0x00,0x32,0x7f,0xe1,
-0x00,0xde,0x00,0x51,0x08,0xe3,0x08,0xfa,0x00,0xe4,0x00,0x00,0x2c,0xfd,0x32,0xcf,
-0x30,0xbe,0x95,0x00,0x51,0x5f,0xd0,0x4f,0xa0,0xff,0x95,0x03,0x52,0xe3,0x0a,0xf5,
-0x0e,0xf0,0x40,0xc1,0x34,0xfd,0x02,0xfa,0x98,0x00,0x52,0xaf,0x20,0xfc,0x09,0xf3,
-0x0b,0x00,0x33,0xcf,0x20,0xfb,0x0b,0x00,0x63,0x08,0xfb,0x04,0xf9,0x0b,0xf1,0xaa,
-0x00,0x43,0x0c,0xf3,0x0f,0xe0,0x14,0x01,0x42,0x9f,0xb0,0x6f,0x90,0xb1,0x00,0x52,
-0x08,0xfe,0x10,0xef,0x20,0x20,0x01,0x45,0x06,0xa1,0x0a,0xf8,0xb8,0x00,0x25,0xaf,
-0xc0,0xb0,0x00,0x06,0x04,0xa3,0x23,0x08,0x90,0xc5,0x12,0x00,0xc9,0x37,0x15,0x07,
-0x17,0x07,0x06,0x74,0x02,0x34,0xfc,0x10,0x8f,0xce,0x80,0x04,0x12,0x0c,0x10,0xf3,
-0x15,0x02,0x10,0xf7,0x8c,0x02,0x20,0xc2,0x19,0x4e,0x05,0x14,0x5f,0x8c,0x32,0x01,
-0x0a,0x00,0x32,0xb3,0xef,0xf7,0x8d,0x10,0x32,0xb0,0x02,0xe7,0x36,0x03,0x12,0xb0,
-0xc9,0x0b,0x13,0x6f,0x1e,0x30,0x00,0x13,0x00,0x12,0x96,0xa8,0x0d,0x16,0x9f,0x68,
-0x00,0x05,0xdb,0x02,0x00,0x52,0x0b,0x12,0x82,0x8f,0x10,0x13,0xfb,0xbb,0x05,0x12,
-0x10,0x3f,0x00,0x16,0x70,0x28,0x04,0x12,0x07,0xb9,0x0f,0x12,0x2f,0xe8,0x06,0x11,
-0xcf,0xb0,0x07,0x12,0x08,0x14,0x06,0x12,0x2f,0xad,0x00,0x12,0x8f,0x60,0x30,0x12,
-0xdf,0xdc,0x03,0x21,0xff,0xab,0x93,0x09,0x21,0xff,0x75,0x07,0x00,0x30,0xcf,0xb0,
-0xdf,0x32,0x00,0xd1,0x6f,0xf5,0x19,0xdf,0xff,0xff,0x70,0x0d,0xff,0x82,0x0f,0xff,
-0xfd,0xf6,0x46,0x20,0xff,0xe2,0xb7,0x8d,0x21,0xff,0xfa,0xf8,0x41,0x00,0xfa,0xf5,
-0x20,0x49,0x80,0x56,0x0e,0x20,0x0a,0xff,0xf1,0x13,0x30,0xf3,0xaf,0xf0,0x40,0x20,
-0x20,0x4a,0xff,0x04,0x06,0x21,0xf4,0xaf,0xe3,0xee,0x20,0x4a,0xff,0x76,0x14,0x50,
-0xf4,0xaf,0xf2,0xdf,0xff,0x0d,0x00,0x01,0x63,0x6e,0x02,0x32,0x04,0x12,0x4a,0x00,
-0x06,0x22,0xaf,0xf9,0x0d,0x00,0x11,0x07,0x0d,0x00,0x21,0xf0,0x05,0x0d,0x00,0x00,
-0xbc,0x26,0x00,0x41,0x00,0x21,0x03,0xef,0x4e,0x00,0x40,0x02,0xef,0xf3,0x9f,0xcb,
-0x0c,0x04,0xd7,0xdc,0x24,0x28,0x60,0x1c,0x06,0x14,0xd4,0xc6,0x06,0x12,0xfa,0x4e,
-0x61,0x04,0x79,0x46,0x01,0xf2,0xa3,0x04,0x46,0x37,0x00,0xeb,0x09,0x04,0x95,0x46,
-0x13,0x0f,0x0e,0xa4,0x14,0x00,0xbe,0x01,0x1c,0x1f,0xd2,0x01,0x05,0xc1,0x46,0x03,
-0x18,0x05,0x01,0x71,0x0c,0x01,0xc7,0xef,0x04,0xa7,0x14,0x23,0x0f,0xff,0x02,0x01,
-0x02,0x17,0x00,0x01,0x11,0x00,0x03,0x59,0x03,0x25,0xf9,0x10,0x05,0xdb,0x02,0x77,
-0x86,0x70,0x99,0x98,0x20,0x00,0x38,0x99,0x97,0x7a,0x0a,0x00,0xe5,0x16,0x11,0xfa,
-0x45,0x71,0x00,0x47,0x09,0x00,0x83,0x01,0x00,0xf6,0x0a,0x00,0xdd,0x0c,0x0f,0x11,
-0x00,0x4a,0x20,0x10,0x3f,0xd8,0x92,0x00,0xfc,0x00,0x12,0xaf,0x26,0xf7,0x03,0x99,
-0x00,0x01,0x01,0x00,0x2c,0x96,0x0c,0x45,0x05,0x14,0x9f,0x2b,0x11,0x04,0x11,0x00,
-0x1f,0xaf,0x11,0x00,0x49,0x23,0xf9,0x6f,0x55,0x07,0x05,0x3c,0x0a,0x10,0x28,0xa3,
-0x06,0x20,0x98,0x0b,0x4e,0x8f,0x40,0x9f,0xf1,0xcf,0xfe,0x42,0x9e,0x40,0x1c,0xff,
-0xff,0x40,0x0d,0x00,0x31,0xff,0xff,0x50,0x0d,0x00,0x21,0xff,0x60,0x0d,0x00,0x31,
-0xff,0x79,0xff,0x1a,0x63,0x32,0xef,0xf1,0xcf,0xac,0x06,0x02,0x62,0x16,0x00,0x0d,
-0x00,0x11,0xdb,0x0d,0x00,0x11,0xc1,0x27,0x00,0x11,0xb0,0x34,0x00,0x11,0xa0,0x41,
-0x00,0x11,0x90,0x4e,0x00,0x10,0x80,0x5b,0x00,0x20,0x8f,0x70,0xc1,0x40,0x07,0xa4,
-0x04,0x14,0x59,0xc4,0x6b,0x04,0x6b,0x5e,0x12,0x6f,0xb3,0xf7,0x01,0x02,0x06,0x14,
-0xd1,0xb5,0x3b,0x15,0xfc,0x4f,0x97,0x12,0xb0,0x2b,0x37,0x01,0x7e,0xf5,0x13,0xef,
-0xad,0x33,0x05,0x4e,0x01,0x14,0x0f,0xe0,0x00,0x04,0x32,0x04,0x16,0xe2,0xc2,0x2e,
-0x03,0xc2,0xd2,0x15,0xa2,0x24,0x00,0x14,0x0f,0x1e,0x01,0x05,0x12,0x00,0x18,0x0b,
-0x4c,0x5d,0x09,0xb4,0xa0,0x20,0x1d,0xf4,0xc2,0x95,0x10,0xfc,0xcd,0x07,0x69,0xf4,
-0x00,0x01,0xdf,0xff,0x40,0x09,0x00,0x00,0x4c,0x08,0x10,0x40,0xd9,0x05,0x00,0x77,
-0x28,0x01,0xe2,0x1d,0x0f,0x0b,0x00,0x04,0x11,0xfb,0xc6,0xf0,0x11,0x02,0x42,0x09,
-0x10,0xc0,0x35,0x04,0x11,0xfc,0x4c,0x09,0x01,0x1f,0xea,0x0f,0x0b,0x00,0x01,0x10,
-0x06,0x99,0x07,0x11,0x09,0x47,0x05,0x01,0x45,0x01,0x1b,0xf9,0x09,0x00,0x37,0x00,
-0xdf,0xf9,0x5f,0xc8,0x24,0x06,0x74,0xc8,0x04,0x04,0x2a,0xd0,0x23,0xff,0x10,0x5c,
-0x01,0x1f,0xf1,0x11,0x00,0x09,0x14,0x0a,0x72,0xcb,0x0c,0x8d,0x02,0xaf,0xf9,0x59,
-0x99,0x99,0xcf,0xff,0xa9,0x99,0x99,0x10,0x44,0x00,0x0e,0x08,0x11,0x00,0x24,0x4f,
-0xfd,0x6a,0xa4,0x07,0xc9,0x8b,0x24,0xfe,0x4f,0x55,0x00,0x04,0x66,0x00,0x22,0x95,
-0x99,0x01,0x00,0x1a,0x91,0x56,0xa8,0x52,0x5b,0xef,0xff,0xfc,0x71,0x56,0x1b,0x32,
-0xff,0xfc,0xab,0xf1,0x06,0x30,0x0a,0xff,0xfb,0x09,0x0a,0x01,0x16,0xec,0xa0,0xff,
-0xa0,0x01,0xcb,0x50,0x4f,0xff,0xe3,0x00,0x0a,0x91,0x09,0x90,0xff,0xf7,0x09,0xff,
-0xfe,0x10,0x5f,0xff,0xf8,0xbc,0x04,0xf0,0x04,0x02,0xff,0xff,0xb0,0xef,0xff,0xf6,
-0x0b,0xcf,0xff,0xff,0x30,0xff,0xff,0xf4,0xdf,0xff,0xf6,0x0c,0x9b,0x03,0x70,0xff,
-0xff,0xf3,0x3f,0xff,0xf9,0x06,0x4f,0x0a,0xd0,0xff,0xff,0xa0,0x08,0xff,0xff,0x10,
-0x7f,0xff,0xb1,0x0a,0xff,0xfd,0x44,0x01,0x70,0xb0,0x01,0x32,0x00,0x6f,0xff,0xd2,
-0xbe,0x00,0x51,0xfc,0x40,0x00,0x19,0xff,0x82,0x06,0x53,0x3b,0xff,0xfe,0xcd,0xff,
-0x92,0xa4,0x50,0x27,0xce,0xff,0xda,0x50,0x8c,0x10,0x08,0x62,0xe0,0x07,0x88,0x3b,
-0x20,0xaf,0xfe,0x3b,0xd9,0x04,0x02,0x01,0x10,0xf7,0x83,0x9f,0x22,0xd8,0x20,0x4a,
-0x93,0x41,0xef,0xff,0xda,0xbe,0xb2,0x04,0x00,0x01,0x09,0x10,0xd3,0xd0,0x00,0x12,
-0xe4,0x80,0x9c,0x70,0xf6,0x09,0x94,0x02,0xef,0xff,0x50,0x8e,0x1d,0xf1,0x05,0x4e,
-0xff,0xac,0xff,0x70,0x6f,0xff,0xf3,0x00,0x03,0xff,0x40,0x02,0xcf,0xff,0xff,0xf2,
-0x0f,0xff,0xfe,0x91,0x07,0x00,0xd9,0x9b,0x51,0x0d,0xff,0xff,0x70,0x0a,0xa8,0x5f,
-0x71,0xff,0xf5,0x0d,0xff,0xff,0x60,0x01,0xc9,0x89,0x50,0xdf,0xfc,0x3f,0xff,0xfc,
-0x21,0x02,0x12,0xf4,0xbb,0x01,0x11,0xe1,0x8f,0xa1,0x10,0x10,0x89,0x01,0x21,0xfe,
-0x30,0x3a,0x02,0x10,0xe5,0x78,0x0b,0x21,0xfc,0x10,0x69,0xd5,0x72,0xff,0xfd,0xd5,
-0x00,0x1b,0xff,0xd3,0xa7,0xcc,0x53,0xef,0xfd,0x40,0x00,0x8f,0x0f,0x0a,0x02,0x95,
-0xd9,0x07,0xd0,0xfe,0x18,0x1c,0xb3,0x14,0x12,0x40,0x16,0x04,0x06,0x42,0x76,0x36,
-0x1e,0xff,0x50,0xa0,0x34,0x15,0xfe,0x13,0x0c,0x04,0x91,0xc9,0x02,0xc8,0x0d,0x05,
-0x82,0x88,0x06,0x34,0x6b,0x03,0x2a,0x5a,0x04,0x21,0x02,0x24,0xbf,0xfd,0xd3,0xc5,
-0x43,0x10,0x0b,0xff,0xf6,0x50,0x6b,0x53,0xf2,0x00,0xcf,0xff,0xe1,0x0f,0x11,0x00,
-0x6d,0x7d,0x12,0x90,0xf8,0x87,0x01,0xd9,0x7b,0x12,0x20,0x0a,0x04,0x00,0x74,0x48,
-0x13,0xfb,0x27,0x12,0x12,0xbe,0x60,0x5a,0x10,0x8f,0x59,0x00,0x11,0x0d,0x63,0x07,
-0x11,0x1f,0xd8,0x10,0x10,0xaf,0x28,0x06,0x01,0xcd,0x02,0x21,0x92,0x5f,0x43,0x18,
-0x07,0xa2,0x0a,0x04,0xe4,0x02,0x00,0x64,0x20,0x24,0x04,0x55,0x01,0x00,0x18,0x10,
-0x9f,0xcf,0x07,0x0d,0xd6,0x00,0xa8,0x57,0x00,0x4d,0x04,0x01,0xd5,0x03,0x01,0xa5,
-0x05,0x11,0x30,0x6f,0x00,0x70,0xed,0xee,0xff,0xff,0x20,0x7f,0xff,0x75,0xfe,0xf2,
-0x02,0x01,0xdf,0xd1,0x6f,0xff,0x80,0xcf,0xf5,0x00,0x00,0x01,0xc2,0x5f,0xff,0x90,
-0x0b,0xf5,0xf8,0x00,0x12,0xa0,0xf5,0x02,0x10,0x3f,0xed,0x54,0x11,0x40,0xd7,0x3b,
-0x21,0xc0,0x8b,0xee,0xe2,0x80,0x2e,0xff,0xd1,0x6f,0xfa,0x0c,0xff,0x60,0xb1,0x01,
-0x13,0x06,0x59,0x08,0x11,0xe2,0xdd,0x0c,0x40,0xfe,0xde,0xee,0xe3,0xa4,0x5e,0x24,
-0xff,0xff,0xf5,0xd7,0x05,0x6b,0x01,0x03,0x93,0x94,0x08,0xc9,0x79,0x07,0xe5,0xdc,
-0x00,0x3b,0x01,0x14,0x30,0x93,0x6c,0x14,0x30,0x9b,0x6c,0x11,0x30,0x08,0x00,0x41,
-0x92,0xdf,0xff,0x30,0x24,0x04,0x10,0x01,0x09,0x00,0x00,0x2c,0x04,0x00,0x09,0x00,
-0x40,0x8f,0xff,0x90,0x00,0x09,0x00,0x31,0x29,0xff,0x90,0xb6,0xc3,0x37,0xf3,0x09,
-0x80,0x1f,0xcc,0x02,0xab,0xd4,0x12,0x10,0xeb,0xd2,0x31,0xbf,0xfc,0x10,0xd1,0x00,
-0x31,0x55,0xff,0xfc,0x98,0x0b,0x50,0xd1,0x05,0xff,0xfc,0x10,0x08,0x00,0x10,0x00,
-0x09,0x00,0x00,0x08,0x00,0x00,0x09,0x00,0x38,0x5f,0xff,0xd1,0xab,0x05,0x13,0x05,
-0x08,0x00,0x23,0x00,0x05,0x08,0x00,0x00,0x49,0x82,0x0c,0x16,0x59,0x33,0x05,0xfc,
-0x10,0x27,0x57,0x00,0xed,0x05,0x22,0xc1,0x07,0xef,0x19,0x00,0x7e,0x09,0x23,0xfd,
-0x14,0x89,0x33,0x10,0x6f,0x51,0x00,0xc1,0x35,0x55,0x55,0x57,0xff,0x30,0x00,0xcf,
-0xc7,0xff,0x5f,0xf4,0xff,0x05,0x73,0x30,0x00,0x27,0x17,0xff,0x04,0x60,0x0c,0x00,
-0x22,0x00,0x07,0x47,0x06,0x0f,0x0c,0x00,0x04,0x53,0x19,0x43,0xff,0x34,0x91,0x0c,
-0x00,0x80,0x9f,0xf6,0xff,0x6f,0xf9,0x00,0x07,0xff,0x3f,0x8d,0x23,0x2e,0xff,0x78,
-0x01,0x00,0x0a,0x34,0x10,0xef,0x6c,0x06,0x12,0x03,0x25,0x23,0x17,0x2e,0x2d,0x06,
-0x19,0x01,0x3e,0xbb,0x01,0x78,0x0d,0x15,0x43,0x9b,0x37,0x15,0xf7,0xaf,0xc8,0x06,
-0x24,0x8c,0x00,0x12,0x21,0x15,0xd4,0x63,0x02,0x2f,0xef,0xff,0x01,0x00,0x41,0x08,
-0x8a,0x0a,0x07,0x90,0x04,0x24,0x1c,0xfb,0x09,0x00,0x24,0xff,0xfb,0x09,0x00,0x03,
-0x0a,0x00,0x14,0x1c,0x27,0x54,0x14,0x1c,0x31,0x54,0x15,0x0b,0x7c,0x62,0x72,0x69,
-0x99,0xff,0xff,0xe9,0x99,0x50,0x4b,0x0d,0x15,0xfd,0xed,0x0e,0x05,0x13,0x0f,0x0f,
-0x13,0x00,0x03,0x00,0xc7,0x0e,0x51,0x60,0xef,0xff,0xd0,0x67,0xc7,0x0e,0x42,0x25,
-0x99,0x84,0x2f,0x54,0x03,0x3f,0x76,0x66,0x7e,0xc7,0x0e,0x18,0x02,0x8d,0xce,0x25,
-0x51,0x00,0x89,0x0f,0x16,0xe8,0xa0,0x9e,0x05,0xa9,0x53,0x13,0xfe,0x5b,0x20,0x05,
-0xc8,0x20,0x15,0x5f,0x91,0x54,0x14,0x09,0x47,0x25,0x00,0x41,0x02,0x15,0xf2,0x4b,
-0x15,0x15,0xd0,0x6e,0xdd,0x05,0x5d,0xbf,0x15,0xfd,0x91,0x04,0x00,0xc1,0x07,0x40,
-0x7d,0xd1,0x00,0x06,0x92,0x09,0x60,0x02,0x9f,0xff,0xfb,0x01,0x9f,0x11,0x01,0x12,
-0x0e,0x4f,0x04,0x14,0xb0,0xce,0x0f,0x14,0xf9,0xc4,0x11,0x24,0xfe,0x60,0x52,0xa0,
-0x13,0x91,0xb0,0x04,0x23,0xfb,0x61,0x3b,0xdf,0x05,0x3f,0xfe,0x23,0x46,0x40,0xf9,
-0x04,0x00,0x98,0x41,0x41,0x03,0xac,0x80,0x9f,0xe0,0x77,0x51,0xff,0xff,0x7e,0xfa,
-0x08,0x4b,0x0b,0x50,0xa0,0xff,0x70,0x5f,0xf1,0x08,0x00,0x50,0x0c,0xfe,0x9e,0xff,
-0x04,0x1d,0x00,0x00,0x14,0x0a,0x01,0x1a,0x05,0x24,0x3a,0xdf,0x22,0x05,0x13,0x4f,
-0x08,0x00,0x22,0x05,0xff,0x27,0x10,0x12,0xce,0x42,0x10,0x10,0x04,0x99,0x00,0x00,
-0x09,0x00,0xd0,0xcf,0xe7,0xdf,0xf0,0x2e,0xff,0xfd,0x10,0x0f,0xf6,0x04,0xff,0x10,
-0x09,0x00,0x91,0xef,0xc3,0xbf,0xf0,0x00,0x2e,0xff,0xfd,0x17,0xae,0x00,0x41,0x2e,
-0xff,0xf7,0x08,0xb6,0x00,0x24,0x17,0x84,0xa5,0x16,0x00,0x63,0x06,0x43,0x99,0x99,
-0x98,0x07,0x33,0x09,0x22,0xe0,0xfb,0x59,0x05,0x51,0xfe,0x0f,0xfb,0x00,0x11,0x11,
-0x00,0x40,0xef,0xf8,0xdf,0xf9,0x33,0x15,0x00,0xb1,0x1b,0x13,0x93,0x94,0x07,0x23,
-0xf9,0x3f,0x21,0x0a,0x13,0x93,0x32,0x0a,0x0f,0x11,0x00,0x27,0x40,0x9f,0xff,0xb0,
-0xab,0x6a,0x09,0x23,0xb4,0xff,0x88,0x01,0x14,0x0f,0xa1,0x1d,0x05,0x85,0x70,0x01,
-0x65,0x0d,0x14,0x20,0x04,0xd2,0x34,0x30,0x00,0x0b,0xd9,0x02,0x04,0xe2,0x02,0x22,
-0x0f,0xf6,0xb8,0x9c,0x32,0x60,0xff,0x60,0x7e,0x01,0x22,0x5f,0xf6,0x0d,0x02,0x14,
-0xfa,0x11,0x00,0x21,0xaf,0xf9,0x6d,0xa1,0x0f,0xed,0x0a,0x03,0x22,0xd4,0x16,0x11,
-0x00,0x32,0xf2,0x00,0x08,0x11,0x00,0x01,0x3e,0x02,0x10,0xaf,0x23,0x0e,0x12,0x09,
-0x11,0x00,0x28,0xe6,0x38,0x33,0x00,0x14,0x8f,0x24,0xc9,0x12,0x23,0x87,0xdf,0x32,
-0x10,0x8a,0xaa,0x01,0x00,0x14,0x4f,0x22,0x00,0x1e,0xef,0x60,0x53,0x0b,0x01,0x00,
-0x0f,0x33,0x00,0x42,0x04,0xce,0xcb,0x34,0x76,0x0b,0xff,0x31,0x12,0x06,0x02,0x0f,
-0x05,0x09,0x00,0x05,0x31,0x3c,0x23,0x09,0x05,0xef,0x06,0x31,0x06,0xfd,0x22,0x62,
-0x0e,0x41,0xd2,0x1a,0xff,0xff,0xf1,0xec,0x20,0x90,0x3e,0x05,0x00,0x00,0x4b,0xbc,
-0x11,0x7f,0x18,0x00,0x23,0x1b,0xfa,0x0f,0x73,0x10,0xe5,0xe0,0x65,0x02,0x47,0x00,
-0x19,0x9c,0xbd,0x03,0x1f,0xfe,0x79,0x04,0x01,0x42,0x5a,0xaa,0xaa,0x90,0xe7,0x58,
-0x12,0xf3,0x04,0x05,0x12,0xe0,0x78,0x27,0x12,0x90,0xbd,0x03,0x12,0x40,0x8e,0x12,
-0x01,0xe5,0x08,0x43,0xff,0xfe,0xbb,0xbb,0xb1,0x9a,0x12,0xc0,0x5d,0x03,0x02,0x34,
-0xbe,0x12,0xfa,0x13,0x08,0x02,0xc1,0x9f,0x03,0x37,0x0e,0x12,0xfe,0xfe,0x03,0x12,
-0xf5,0x1f,0x09,0x12,0xc0,0x05,0x07,0x02,0x8c,0xba,0x12,0xfa,0xdd,0x03,0x18,0xf1,
-0x88,0xbb,0x13,0x04,0xb4,0x0c,0x12,0x81,0xec,0x70,0x51,0x7e,0xff,0xd7,0x76,0x30,
-0x63,0x7b,0x31,0x4f,0xff,0xfd,0x6f,0x02,0x18,0x9a,0x6f,0x02,0x00,0x11,0x00,0x11,
-0xa3,0xae,0x23,0x40,0xff,0xff,0xe0,0x79,0x19,0x03,0x41,0x0f,0xff,0xfc,0x0f,0x19,
-0x03,0x31,0xff,0xff,0xc1,0x19,0x03,0x10,0x0f,0x91,0x0e,0x00,0x19,0x03,0x01,0x11,
-0x00,0x01,0x19,0x03,0x23,0xfc,0x1f,0xad,0x0a,0x13,0xc1,0x5e,0x02,0x02,0x11,0x00,
-0x14,0xfa,0x11,0x00,0x44,0xa9,0xcc,0xc9,0x1f,0x21,0x61,0x04,0xfe,0x73,0x14,0x1f,
-0x5d,0x05,0x04,0xbf,0x55,0x10,0x03,0xa4,0x02,0x10,0x51,0x28,0x09,0x04,0x74,0x09,
-0x04,0xf8,0xc3,0x11,0x5e,0x80,0xc7,0x01,0x7c,0x01,0x14,0xb1,0x9a,0xa3,0x14,0xd0,
-0x07,0x1b,0x13,0x80,0xa9,0x1c,0x14,0xfe,0xa5,0x23,0x14,0xf2,0x47,0x0b,0x13,0x40,
-0x2b,0x03,0x04,0xb1,0xb9,0x00,0xfb,0xae,0x03,0xfe,0x13,0x13,0x08,0x36,0xb2,0x04,
-0xf9,0x92,0x14,0xd1,0x4d,0x02,0x14,0x89,0xdf,0x0b,0x07,0x7a,0x02,0x14,0x0f,0xdf,
-0x15,0x14,0x7f,0x3f,0xf9,0x23,0x25,0x10,0x21,0x9f,0x03,0x6b,0x76,0x06,0x03,0x11,
-0x17,0xe1,0x47,0x09,0xf0,0x12,0xff,0x82,0x6f,0x22,0xf6,0x24,0xf3,0x27,0xe2,0x2f,
-0xf6,0xff,0x60,0x4f,0x00,0xe4,0x02,0xf1,0x05,0xd0,0x0f,0xf6,0xff,0x94,0x8f,0x44,
-0xf8,0x46,0xf6,0x49,0xe4,0x5f,0xf6,0x38,0x02,0x10,0xef,0xba,0x2c,0x00,0x36,0x09,
-0x7b,0x20,0x89,0x01,0xf4,0x04,0xf0,0x0c,0x0b,0x00,0x06,0x41,0x14,0x30,0x93,0x7f,
-0x43,0xf5,0x1a,0x21,0xe3,0x4f,0x4d,0x00,0x00,0x05,0x05,0x00,0x4d,0x00,0x31,0xa6,
-0x9f,0x66,0x25,0x25,0x1f,0x6f,0x62,0x14,0x08,0x01,0x3e,0x9f,0x14,0x81,0xae,0x07,
-0x14,0x8f,0x3b,0x76,0x14,0x2a,0x37,0x06,0x24,0x04,0xbf,0xbb,0x20,0x14,0x5c,0x58,
-0x31,0x24,0x06,0xdf,0xaf,0x01,0x14,0x8e,0x42,0x51,0x15,0x19,0x53,0x00,0x15,0x0c,
-0x18,0x17,0x05,0xa2,0x10,0x04,0xd0,0x3e,0x01,0x97,0x09,0x00,0xed,0x1b,0x15,0xbf,
-0x7d,0x19,0x16,0x0b,0x51,0x42,0x15,0xbf,0x0c,0x0b,0x16,0x0b,0xb7,0x03,0x35,0xbf,
-0xff,0xf1,0x15,0x00,0x15,0xf9,0x29,0x0c,0x03,0xc9,0xd8,0x00,0x23,0x03,0x05,0x4e,
-0x3d,0x02,0x05,0xfd,0x61,0xad,0xdd,0xdd,0xdd,0x48,0x40,0x28,0x05,0x22,0xf5,0xaf,
-0x0b,0x3e,0x32,0x5a,0xff,0x40,0x0f,0x00,0x20,0xff,0x40,0x0f,0x00,0x43,0x59,0xee,
-0xed,0x0f,0x71,0x08,0x03,0x6f,0x08,0x13,0x1f,0x4a,0x72,0x04,0x7f,0xce,0x0f,0x0f,
-0x00,0x30,0x04,0x5a,0x5f,0x04,0x48,0xc3,0x0b,0xbd,0x18,0x43,0x58,0x9a,0xa9,0x74,
-0x58,0x07,0x11,0xcf,0x8a,0x04,0x02,0xaa,0xab,0x03,0x4a,0x10,0x20,0x50,0x00,0x9a,
-0x18,0x40,0xb8,0x65,0x57,0x9d,0x55,0xfd,0x33,0x5f,0xff,0xfd,0x95,0xeb,0x44,0xff,
-0xe2,0xdf,0xff,0x6a,0xae,0xd0,0xff,0xf9,0x2e,0xc2,0x00,0x00,0x37,0x9a,0xa9,0x62,
-0x00,0x00,0x4e,0x4f,0x9a,0x20,0x5d,0xff,0x99,0x13,0x01,0x87,0x13,0x14,0x1b,0x79,
-0x43,0x01,0x40,0x01,0x65,0xe9,0x64,0x46,0xaf,0xff,0xf7,0x87,0xd2,0x34,0x01,0xaf,
-0xd1,0xc1,0x7c,0x07,0xf5,0x70,0x36,0x28,0x71,0x00,0x88,0x0c,0x16,0xfd,0xb8,0xa5,
-0x07,0xcb,0x3d,0x18,0x05,0x76,0x4f,0x2d,0xaf,0xf6,0x73,0x9b,0x04,0xf1,0x02,0x00,
-0xd4,0x3d,0x07,0xf5,0x13,0x17,0x30,0x08,0x05,0x34,0x80,0xff,0x71,0xd9,0x1d,0x43,
-0xaf,0xf9,0xff,0x64,0x47,0x10,0x54,0xb0,0xaf,0xfe,0xff,0x67,0x25,0x60,0x17,0x7d,
-0x0c,0x00,0x1f,0x07,0x0c,0x00,0x04,0x46,0x8e,0xfe,0xff,0x60,0x34,0x0e,0x24,0xff,
-0xa6,0x40,0x6d,0x27,0xcf,0xd5,0x2e,0x0a,0x27,0x70,0x5e,0xe0,0x14,0x0f,0x9c,0x00,
-0x1e,0x11,0x62,0x9a,0x00,0x11,0xb7,0x60,0x00,0x14,0x63,0xe9,0x09,0x17,0x7d,0x0c,
-0x00,0x1f,0x07,0x0c,0x00,0x04,0x0f,0x9c,0x00,0x50,0x00,0x38,0x01,0x13,0xba,0x60,
-0x00,0x14,0x66,0x46,0x55,0x17,0x7d,0x0c,0x00,0x1f,0x07,0x0c,0x00,0x04,0x0f,0x9c,
-0x00,0x50,0x44,0x67,0xbb,0xbb,0x10,0x60,0x00,0x14,0x6a,0x31,0x02,0x17,0x7d,0x0c,
-0x00,0x1f,0x07,0x0c,0x00,0x04,0x0f,0x9c,0x00,0x1f,0x05,0x9b,0x2a,0x16,0x11,0x8f,
-0x5b,0x00,0x87,0x13,0x09,0x9c,0x00,0x14,0x95,0x9f,0x0e,0x29,0xcf,0xd6,0x60,0x00,
-0x15,0x60,0x89,0x70,0x07,0x0c,0x00,0x1e,0x07,0x0c,0x00,0x0f,0x9c,0x00,0x25,0x1c,
-0x00,0x59,0x3d,0x16,0x8f,0xc8,0x77,0x35,0xcd,0xff,0xfc,0xb4,0x20,0x25,0xa8,0xef,
-0x56,0x1b,0x41,0xcb,0x00,0x3b,0xa1,0xd9,0x1f,0x32,0xec,0x30,0x04,0x29,0xf0,0x72,
-0x70,0x00,0xaf,0xff,0xe0,0x1d,0x90,0x9a,0xf3,0x17,0x40,0xd8,0x00,0x80,0xf8,0xdf,
-0xff,0xf6,0x55,0x5a,0xf7,0x55,0xd6,0x0d,0x43,0xa1,0x3e,0xff,0x70,0x5d,0x96,0x48,
-0xd3,0x00,0x01,0x42,0x35,0xd4,0x01,0x3f,0x2a,0x03,0x54,0x17,0x01,0x76,0x6c,0x16,
-0xcf,0x0e,0x09,0x27,0x5a,0xdf,0x4d,0x09,0x2d,0x6f,0xff,0x82,0xb2,0x50,0x5a,0xcd,
-0xc9,0x40,0x00,0x31,0x17,0x30,0xef,0xff,0xa0,0x1e,0x14,0x11,0xe3,0x81,0x14,0x60,
-0xff,0xfe,0x05,0xff,0xff,0x30,0xf1,0x07,0xf0,0x0e,0x06,0xff,0xf9,0x05,0xff,0xea,
-0xfe,0x09,0x08,0xff,0xd0,0x8f,0xf7,0x0a,0xe0,0xe7,0x0d,0xff,0x0a,0xff,0xf5,0x08,
-0x09,0x08,0xff,0xf2,0xbf,0xff,0xf5,0x38,0x04,0x40,0x3b,0xff,0xff,0xf4,0x04,0x17,
-0x00,0xe7,0x1e,0x10,0x1d,0x12,0x17,0xf0,0x05,0xfd,0x11,0x02,0x1d,0xff,0xf3,0x9f,
-0xfd,0x12,0xd0,0xd3,0x2e,0xff,0x26,0xff,0x72,0xef,0x0d,0x41,0xdf,0x4c,0x5c,0x40,
-0xf0,0x30,0xcf,0xfc,0x06,0x09,0xb0,0x00,0xcf,0xff,0x70,0x04,0xff,0xff,0xf0,0xbf,
-0xff,0xe0,0x40,0x00,0x11,0xbf,0x31,0x6b,0x44,0xaf,0xff,0xff,0xa3,0x0a,0xfd,0x00,
-0xb0,0x04,0x00,0xe3,0x12,0x00,0xeb,0x0a,0x64,0xef,0xff,0xff,0xa6,0x66,0x62,0x10,
-0x01,0x15,0x9d,0x85,0x7d,0x08,0x26,0xea,0x00,0x66,0x09,0x14,0x0d,0x19,0x00,0x60,
-0xdf,0xf9,0xef,0xe9,0xff,0xad,0x0a,0x18,0xdf,0x2a,0xfb,0x1f,0xf4,0x8f,0xf7,0x00,
-0xdf,0xf2,0xaf,0xb1,0xff,0x48,0x11,0x00,0x24,0x65,0x4b,0xfc,0x3f,0xf6,0xaf,0xf7,
-0x66,0x00,0x04,0x30,0x08,0x02,0x22,0x4b,0x15,0x66,0x03,0x1b,0x05,0x35,0xea,0x12,
-0x01,0xb0,0xfe,0x02,0x3f,0x0e,0x13,0xc1,0x32,0xdf,0x05,0x5b,0x0e,0x10,0x71,0xfe,
-0x00,0x01,0x26,0x00,0x43,0xf7,0x1d,0xff,0xf8,0x26,0x00,0x31,0x71,0xdf,0x90,0x13,
-0x00,0x00,0xe2,0x1c,0x05,0x78,0x0e,0x13,0x40,0x13,0x00,0x25,0xff,0xf9,0x13,0x00,
-0x1f,0x90,0x13,0x00,0x0d,0x15,0x08,0x0c,0x06,0x15,0x0a,0x7b,0xd4,0x14,0x0c,0x13,
-0x00,0x10,0x00,0x35,0x2d,0x05,0x96,0x81,0x13,0x90,0xca,0x05,0x18,0x53,0x5f,0x55,
-0x04,0xc6,0x08,0x00,0xc5,0x18,0x06,0x0b,0x16,0x05,0x4a,0xb7,0x11,0xf9,0xf5,0x0f,
-0x10,0xfd,0xc5,0xff,0x21,0xff,0xfb,0x17,0x00,0x71,0x80,0x7f,0xfd,0x12,0xef,0xff,
-0xfc,0x0c,0x10,0x82,0x40,0x07,0xd1,0x00,0xcf,0xff,0xfc,0x3f,0xfc,0x43,0x00,0x82,
-0x00,0x22,0xfc,0xef,0x32,0x08,0x00,0x86,0x09,0x22,0xfc,0xcf,0xee,0x1d,0x00,0x4b,
-0x1a,0x31,0xfc,0x1d,0xff,0xfb,0x10,0x10,0x20,0xd4,0x8d,0x20,0x01,0xdf,0x23,0x00,
-0x30,0x0a,0xf3,0x00,0x66,0x1c,0x10,0x1c,0xca,0x22,0x30,0xaf,0xff,0x44,0x49,0x08,
-0x14,0x01,0x34,0x52,0x03,0x2c,0x20,0x05,0xe1,0x29,0x24,0x01,0xaf,0xf4,0xe1,0x02,
-0xc7,0x81,0x13,0x40,0x07,0x29,0x13,0xa0,0xbb,0x1a,0xf2,0x02,0x20,0x5f,0xf2,0x1f,
-0x21,0xf1,0x2f,0xf4,0x6f,0xff,0x21,0xf2,0x1f,0x12,0xff,0x4f,0xff,0x0f,0x00,0x83,
-0xff,0xff,0xee,0xfe,0xef,0xee,0xff,0x4f,0xb3,0x08,0x03,0x44,0x00,0x0f,0x0f,0x00,
-0x29,0x13,0x3d,0x02,0x08,0x13,0x3e,0xe4,0x26,0x18,0x02,0xa9,0x0f,0x00,0x3d,0xd3,
-0x05,0x6d,0x10,0x23,0xf1,0x00,0xaa,0xf0,0x10,0xbf,0xda,0x69,0x02,0x22,0x10,0x00,
-0x08,0x5a,0x02,0x0a,0x00,0x00,0xc0,0x54,0x01,0x42,0x0d,0x35,0xef,0xf1,0x7f,0x02,
-0xc5,0x15,0xdf,0x0a,0x00,0x41,0x2e,0xff,0xff,0xcc,0x01,0x00,0x00,0x96,0x12,0x05,
-0x53,0x00,0x06,0x0e,0x18,0x1f,0xbd,0x8d,0xea,0x0b,0x2f,0xfa,0x00,0x01,0x00,0x56,
-0x04,0xc8,0x52,0x17,0xee,0x14,0x00,0x61,0xf9,0xf7,0x00,0xfd,0xf7,0x00,0xa9,0xbc,
-0x0f,0x85,0x00,0x53,0x4f,0x03,0x03,0x00,0x03,0x69,0x00,0x52,0x2f,0xe7,0x00,0x01,
-0x00,0x68,0x1f,0xdf,0x71,0x00,0x5d,0x14,0xee,0x5d,0x3d,0x82,0xfe,0x00,0x00,0xed,
-0xfd,0xf3,0xf6,0x00,0x42,0x12,0x00,0x0f,0x00,0x4f,0xfd,0xfe,0xf9,0xfb,0xde,0x01,
-0x51,0x34,0xfc,0x00,0xfc,0x6c,0xe6,0x0f,0x6d,0x00,0x51,0x0b,0x0a,0x00,0x19,0xfe,
-0x1f,0x00,0x1f,0xfd,0x79,0x00,0x46,0x13,0xf1,0x5e,0x00,0x7f,0xfc,0x00,0xfd,0x00,
-0xfd,0xfa,0xfd,0xe8,0x01,0x5d,0x15,0x03,0xe2,0x00,0x11,0xfd,0x87,0x00,0x2f,0xfd,
-0xfc,0x83,0x00,0x4a,0x11,0xdd,0x49,0x03,0x15,0xd9,0x77,0x00,0x20,0xfb,0xfd,0x73,
-0x00,0x02,0x04,0x00,0x0f,0xea,0x00,0x50,0x01,0x22,0x1d,0x1f,0xfc,0x61,0x01,0x5a,
-0x0f,0xd2,0x01,0x5e,0x03,0x13,0x41,0x19,0xfb,0xdd,0x02,0x01,0x60,0x01,0x3f,0xfd,
-0xfa,0xf7,0x72,0x00,0x45,0x17,0xce,0xe8,0xa8,0x67,0xd7,0xf8,0xe6,0xeb,0x00,0xdd,
-0x13,0x06,0x2f,0xec,0xf2,0xed,0x00,0x49,0x11,0xd0,0x18,0xe5,0x12,0xe2,0x4f,0x02,
-0x51,0x00,0xfc,0x00,0xfe,0xfe,0xbd,0x03,0x1f,0x02,0x81,0x06,0x54,0x6f,0xfa,0x00,
-0xfc,0xfd,0x00,0xfb,0xe3,0x01,0x5e,0x10,0xf4,0x59,0x02,0x1f,0xf9,0xe1,0x00,0x52,
-0x00,0x05,0x00,0xb0,0xe0,0xde,0x00,0x00,0xf4,0xfc,0xdc,0xfe,0x02,0x00,0x02,0x59,
-0x01,0x00,0xcf,0x08,0xaf,0xf0,0xf1,0xf5,0xef,0x00,0xf2,0xf5,0xf8,0xf5,0xf7,0xb2,
-0x03,0x47,0x66,0xdf,0xfb,0x00,0x00,0xf5,0xfe,0x11,0x00,0x91,0xf9,0xf9,0x00,0x00,
-0xf9,0xfc,0x00,0x00,0xfc,0x21,0xe1,0x0f,0x77,0x00,0x44,0x20,0x02,0x00,0x66,0x51,
-0x16,0xfa,0xc3,0x08,0x33,0x02,0xfb,0xfb,0xaa,0x04,0x1f,0x00,0xd8,0x08,0x4b,0x14,
-0xf9,0x7f,0x06,0x15,0x02,0x8b,0x06,0x01,0x94,0x05,0x1f,0xfb,0xf8,0x06,0x48,0xf0,
-0x0a,0x03,0xf9,0xe1,0xf8,0x00,0x00,0xf2,0xfc,0xf2,0xfe,0x03,0xf2,0x03,0x03,0x02,
-0x03,0x00,0x03,0xf5,0xf6,0xfd,0xfa,0xf6,0xfa,0xf7,0x8d,0x06,0x3f,0xfd,0xfc,0x03,
-0x64,0x02,0x4a,0x2a,0x02,0xfc,0x2a,0x05,0x02,0x82,0x06,0x1f,0xfc,0x96,0x05,0x52,
-0x0f,0x99,0x05,0x57,0x1f,0xf6,0x1d,0x00,0x09,0x1f,0xfe,0xd3,0x08,0x50,0x0f,0x77,
-0x00,0x02,0x1f,0xfe,0x7a,0x00,0x44,0x1f,0xfe,0x22,0x0b,0x63,0x1f,0xfe,0x94,0x00,
-0x63,0x1e,0x02,0x87,0x04,0x19,0x03,0x7a,0x01,0x1f,0x03,0x36,0x0a,0x46,0x0f,0x01,
-0x00,0x75,0x0f,0x49,0x03,0x4f,0x1f,0xec,0xdc,0x01,0x0b,0x2f,0xfd,0xfe,0xdc,0x01,
-0x45,0x0a,0xdc,0x0e,0x01,0x0e,0x07,0x20,0xfd,0x02,0xf1,0x00,0x10,0x07,0x78,0x0e,
-0x0f,0x68,0x01,0xbb,0x17,0x02,0xd2,0x0f,0x05,0x5c,0x01,0x2f,0xfe,0x02,0xd0,0x03,
-0x51,0x1f,0xee,0xca,0x02,0x77,0x1f,0xfd,0xbb,0x04,0x63,0x1f,0xfe,0xe3,0x00,0xcc,
-0x0f,0x6f,0x0a,0x18,0x1f,0xfa,0xc1,0x00,0x0c,0x1f,0xfd,0xef,0x12,0x42,0x2f,0xf7,
-0xf7,0x9f,0x0d,0x58,0x05,0x6d,0x00,0x34,0xf7,0xf1,0xf7,0x17,0xe9,0x1e,0xf7,0xc4,
-0x0d,0x0f,0x1d,0x01,0x02,0x3f,0xfa,0xfa,0xfa,0x54,0x01,0x34,0x1f,0xf4,0xcb,0x01,
-0x6d,0x0f,0x01,0x00,0x44,0x2e,0xeb,0xf1,0xe7,0x00,0x0f,0x1d,0x15,0x50,0x23,0xf1,
-0xf1,0xb9,0x1e,0x0f,0x5e,0x01,0x54,0x0f,0xca,0x02,0x0d,0x1f,0x0c,0xee,0x00,0x52,
-0x0f,0x1e,0x04,0x5d,0x0a,0x5c,0x02,0x1f,0xeb,0x9e,0x04,0x64,0x3f,0xee,0xf7,0xf7,
-0x80,0x17,0x51,0x2b,0xe8,0xe2,0xca,0x02,0x02,0x75,0x08,0x1f,0xeb,0x2b,0x04,0x11,
-0x13,0xee,0x48,0x90,0x2f,0xeb,0xe5,0x41,0x03,0x1f,0x1e,0xe2,0x77,0x08,0x0f,0x74,
-0x0a,0x15,0x13,0xeb,0x07,0x00,0x2f,0xeb,0xeb,0xce,0x12,0x3a,0x0f,0x30,0x03,0x50,
-0x0f,0x49,0x19,0x68,0x05,0x5f,0x01,0x1f,0x09,0x38,0x12,0x4f,0x0f,0x98,0x04,0x63,
-0x52,0xf1,0xf7,0xf7,0x00,0xf7,0xf9,0x06,0x00,0xd0,0x01,0x23,0xee,0xfa,0x63,0x01,
-0x10,0xf1,0xf7,0x00,0x1f,0xfa,0xee,0x00,0x48,0x0f,0xed,0x08,0x62,0x16,0xf4,0xe9,
-0x07,0x00,0xee,0x00,0x20,0xf7,0xf4,0x08,0x00,0x1f,0xfd,0xb5,0x0d,0x4e,0x13,0xf7,
-0xb7,0x02,0x3f,0xfa,0x03,0x03,0xbe,0x02,0x5e,0x0f,0xa6,0x03,0x4d,0x0f,0x6b,0x08,
-0x83,0x02,0xeb,0x04,0x1f,0xf1,0x64,0x02,0x62,0x1f,0xf4,0x66,0x00,0x5c,0x1f,0xf7,
-0xd5,0x08,0x58,0x18,0xf7,0xea,0x07,0x01,0x87,0x00,0x2f,0xf4,0xfa,0x4f,0x02,0x5b,
-0x1f,0xfa,0x16,0x0c,0x58,0x0c,0xdc,0x00,0x0f,0x5a,0x10,0x5e,0x0f,0xb2,0x0a,0x18,
-0x1f,0xfa,0x46,0x0c,0x2e,0x0c,0x39,0x11,0x1f,0xfa,0x7b,0x0d,0x59,0x0f,0x4e,0x13,
-0x67,0x1f,0xfa,0x39,0x0b,0x5a,0x2f,0xe2,0xe2,0xba,0x01,0x0c,0x17,0xf1,0x8d,0x00,
-0x18,0xf4,0x1d,0x00,0x32,0xfa,0x00,0xe5,0x6d,0x03,0x10,0xfa,0x6d,0x0e,0x23,0xeb,
-0xf1,0x04,0x0a,0x2f,0xf4,0xee,0x87,0x05,0x34,0x00,0x50,0x0a,0x07,0x5e,0x03,0x00,
-0x62,0x04,0x13,0xfa,0xb7,0x06,0x18,0xfa,0xf4,0x03,0x1f,0xf7,0xc3,0x06,0x18,0x1f,
-0xf7,0xfe,0x05,0x63,0x2f,0xee,0xee,0x9c,0x06,0x33,0x1f,0xf7,0x04,0x0d,0x24,0x0f,
-0x71,0x06,0x89,0x1e,0xf7,0x16,0x0c,0x0f,0xf7,0x00,0x23,0x2f,0xe5,0xe8,0x19,0x15,
-0x12,0x26,0xf4,0xf4,0x0a,0x02,0x05,0xaa,0x00,0x26,0xee,0xf1,0x6e,0x03,0x2f,0xe8,
-0xf4,0x6c,0x01,0x1a,0x2f,0xeb,0xe8,0xdc,0x01,0x1d,0x1e,0x03,0xa1,0x01,0x0f,0xad,
-0x01,0x1f,0x2f,0xe8,0xe5,0xfd,0x01,0x21,0x02,0x86,0x00,0x44,0xee,0xf4,0xf4,0xf4,
-0x75,0x0a,0x24,0xeb,0xf7,0x5d,0x05,0x0f,0x77,0x00,0x13,0x1f,0xe8,0x61,0x03,0x0e,
-0x1f,0xfa,0x1c,0x00,0x07,0x05,0x05,0x01,0x2f,0xfd,0xf1,0xcb,0x05,0x3d,0x0f,0x71,
-0x08,0x42,0x2f,0xe5,0xe5,0x6f,0x03,0x27,0x12,0xfa,0x65,0x01,0x0f,0xdc,0x01,0x22,
-0x1f,0xeb,0xee,0x17,0x27,0x0e,0x53,0x02,0x0f,0x1b,0x0b,0x53,0x06,0xab,0x14,0x0f,
-0x51,0x15,0x50,0x05,0xaa,0x00,0x28,0xfa,0xee,0x5b,0x05,0x1f,0xf1,0xe7,0x11,0x5b,
-0x00,0xbc,0x10,0x1f,0xf7,0xdb,0x12,0x66,0x1f,0xfa,0xce,0x17,0x1b,0x1f,0xfd,0xb1,
-0x0d,0x2e,0x1f,0xfd,0xf9,0x06,0x47,0x0f,0x19,0x06,0x0e,0x1f,0xfa,0x77,0x00,0x63,
-0x0f,0x1b,0x18,0x58,0x1f,0xf7,0x84,0x00,0x27,0x0f,0x4c,0x05,0x1a,0x1f,0x06,0x77,
-0x00,0x36,0x2f,0xee,0xf1,0xdc,0x01,0x35,0x1f,0xfd,0xca,0x02,0x55,0x0f,0x62,0x15,
-0x29,0x1f,0xf7,0x98,0x16,0x3c,0x0f,0x53,0x02,0x33,0x1f,0xee,0xed,0x0a,0x14,0x1f,
-0xf7,0x77,0x00,0x3b,0x1f,0xeb,0xee,0x00,0x43,0x0f,0xbc,0x0f,0x29,0x1f,0xfa,0xa3,
-0x18,0x63,0x1f,0xf1,0xda,0x12,0x51,0x1f,0xfa,0x02,0x13,0x57,0x12,0xfa,0xe5,0x0d,
-0x1f,0xf7,0x80,0x00,0x13,0x1f,0xfa,0xe5,0x00,0x4f,0x1f,0x09,0xc5,0x0c,0x63,0x1f,
-0x09,0x78,0x00,0x05,0x1f,0x0f,0xd2,0x01,0x7f,0x0f,0x7b,0x0d,0x17,0x1f,0xfa,0x23,
-0x22,0x14,0x1e,0xf7,0x2f,0x06,0x0f,0x2f,0x04,0x29,0x0f,0x19,0x03,0x44,0x0f,0x77,
-0x00,0x39,0x0f,0x2c,0x0f,0x46,0x2f,0x06,0x06,0x1a,0x19,0x36,0x0f,0x74,0x17,0xa2,
-0x09,0xa2,0x0b,0x0f,0x41,0x13,0x17,0x2f,0xe8,0xe8,0xb1,0x01,0x27,0x17,0xe8,0x21,
-0x12,0x0f,0xf2,0x11,0x1c,0x1f,0xfa,0x26,0x02,0x3c,0x1f,0xfa,0x7b,0x0d,0x40,0x0b,
-0xd9,0x21,0x4f,0xfa,0xfd,0xfd,0xfd,0x82,0x0a,0x24,0x2f,0xee,0xf4,0xe0,0x23,0x88,
-0x1f,0xf7,0x3f,0x01,0x0e,0x1f,0xfa,0xe9,0x12,0x63,0x0f,0x8d,0x0c,0x3c,0x1f,0xf7,
-0xf4,0x03,0x09,0x1e,0xfd,0x95,0x0f,0x0f,0x04,0x0d,0x42,0x19,0xfa,0x38,0x10,0x17,
-0xf1,0xd1,0x0f,0x2f,0xfa,0xf7,0x69,0x0e,0x2b,0x2e,0xee,0xee,0xa1,0x06,0x05,0xc8,
-0x02,0x28,0xf1,0xf1,0x52,0x01,0x44,0xee,0xfa,0xfd,0xfd,0x2f,0x04,0x26,0xf7,0xf4,
-0x32,0x04,0x12,0x01,0xe7,0x2e,0x21,0x02,0x03,0xad,0x44,0x2e,0x04,0x05,0x64,0x05,
-0xf2,0x0b,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,
-0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x29,0x5d,0x70,0x1b,
-0x1c,0x00,0x1d,0x1e,0x00,0x1f,0xde,0x5b,0xff,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,
-0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0xcb,0x00,0x08,0xf0,0x10,0x29,0x2a,
-0x2b,0x00,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x00,0x33,0x00,0x34,0x35,0x00,0x00,
-0x36,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x00,0x3d,0x3e,0x3f,0x40,0x41,0x68,0x3d,0xf2,
-0x2b,0x43,0x44,0x45,0x46,0x47,0x48,0x00,0x49,0x31,0x4a,0x00,0x4b,0x4c,0x00,0x00,
-0x31,0x4d,0x4e,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x00,
-0x5a,0x5b,0x5c,0x5d,0x5e,0x5f,0x60,0x61,0x62,0x63,0x64,0x2d,0x65,0x66,0x00,0x67,
-0x68,0x69,0x6a,0x6a,0x6b,0x00,0x6c,0x6d,0x6e,0x00,0x6f,0x74,0xa7,0x50,0x71,0x00,
-0x00,0x2d,0x72,0x8c,0xa5,0x9f,0x74,0x75,0x76,0x77,0x00,0x78,0x79,0x7a,0x00,0x01,
-0x00,0xff,0x48,0x02,0x46,0x02,0x20,0x03,0x02,0x41,0x02,0x4d,0x06,0x07,0x06,0x08,
-0x68,0x0a,0x30,0x0a,0x00,0x0b,0x64,0x44,0x00,0x11,0x25,0x01,0x08,0x00,0xa2,0x0b,
-0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0xec,0x89,0x62,0x16,0x00,0x17,0x17,
-0x17,0x18,0x66,0xe4,0xfe,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,
-0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,0x00,0x01,0x09,0x4f,0xf1,0x01,0x25,0x26,
-0x27,0x28,0x00,0x29,0x00,0x2a,0x2b,0x2c,0x2d,0x00,0x2a,0x2a,0x00,0x00,0x4e,0x02,
-0x30,0x33,0x34,0x35,0x4a,0x02,0x71,0x00,0x3a,0x3b,0x3c,0x3c,0x3d,0x3e,0xa6,0xc5,
-0x43,0x40,0x41,0x00,0x42,0x4e,0x02,0x91,0x49,0x4a,0x00,0x4b,0x4b,0x00,0x4c,0x4d,
-0x00,0x4b,0x02,0x00,0x4c,0x02,0x01,0x4d,0x02,0x22,0x55,0x43,0x4e,0x02,0x11,0x55,
-0x4f,0x02,0x40,0x00,0x00,0x65,0x66,0x4f,0x02,0x00,0x1b,0x5a,0x01,0x50,0x02,0xdf,
-0x70,0x71,0x72,0x00,0x00,0x73,0x00,0x74,0x75,0x00,0x00,0x76,0x77,0x40,0x02,0xff,
-0x43,0x50,0x00,0x00,0x00,0x00,0x00,
+0xff,0xf0,0x4f,0xf3,0x00,0x00,0x03,0xef,0x40,0x01,0x10,0x6f,0x03,0x01,0x66,0x00,
+0x23,0x7a,0x60,0x76,0x00,0x12,0x0f,0x46,0x03,0x70,0x02,0xb3,0x00,0xff,0xf0,0x04,
+0xb1,0x54,0x00,0xf1,0x17,0xd0,0x0f,0xff,0x00,0xef,0xe2,0x00,0x01,0xef,0xfe,0x00,
+0xff,0xf0,0x1e,0xff,0xd0,0x00,0x9f,0xfe,0x20,0x0f,0xff,0x00,0x3e,0xff,0x80,0x1f,
+0xff,0x40,0x00,0xff,0xf0,0x00,0x5f,0xff,0x06,0xff,0xb0,0x39,0x00,0x50,0xcf,0xf5,
+0x9f,0xf6,0x00,0x13,0x00,0x51,0x07,0xff,0x8b,0xff,0x40,0x13,0x00,0xe1,0x5f,0xfa,
+0xbf,0xf4,0x00,0x00,0xdf,0xc0,0x00,0x05,0xff,0x99,0xff,0x70,0xeb,0x03,0x32,0x8f,
+0xf8,0x5f,0x3f,0x01,0x50,0x0d,0xff,0x40,0xff,0xf6,0x09,0x00,0x61,0x07,0xff,0xe0,
+0x07,0xff,0xf5,0x04,0x03,0xf2,0x01,0xf6,0x00,0x0b,0xff,0xfa,0x30,0x00,0x3b,0xff,
+0xfb,0x00,0x00,0x1c,0xff,0xff,0xfe,0xcc,0x00,0x11,0x09,0x09,0x04,0x01,0x99,0x00,
+0x4b,0x9d,0xff,0xfd,0x82,0xaa,0x01,0x33,0x01,0x34,0x31,0x0a,0x00,0x34,0xff,0xff,
+0xb0,0xc7,0x00,0x11,0xfb,0xbd,0x03,0xa1,0x30,0x29,0xff,0xff,0xf7,0x00,0x61,0x00,
+0x01,0xef,0x77,0x01,0x43,0xdf,0xb0,0x00,0xbf,0x01,0x02,0x23,0x60,0x2f,0x09,0x00,
+0x10,0xfd,0xb8,0x03,0xa0,0xa1,0x03,0xdf,0xff,0xff,0xd1,0x01,0xdf,0xff,0xc0,0x6e,
+0x03,0x62,0xa0,0x00,0x0b,0xff,0xf7,0x00,0x05,0x00,0x10,0xbf,0xf3,0x02,0x70,0xcf,
+0xff,0x60,0x00,0x5e,0xff,0xfe,0x59,0x04,0xc4,0xfc,0x20,0x5f,0xff,0xff,0xfd,0x53,
+0x7f,0xff,0xff,0xff,0x11,0x4d,0x02,0x23,0xc0,0x08,0x09,0x00,0x40,0xf4,0x00,0x0d,
+0xe7,0x18,0x04,0x20,0xa9,0xf9,0x59,0x01,0x5a,0x6f,0xff,0xfe,0x30,0x02,0x98,0x00,
+0x3d,0x0d,0xff,0xf9,0x69,0x02,0x52,0x02,0x85,0x00,0x07,0x98,0x0b,0x00,0x62,0x5f,
+0xff,0x90,0x0d,0xff,0x10,0x13,0x01,0x32,0xff,0xfb,0x1d,0x0b,0x00,0x51,0xaf,0xfd,
+0x3a,0xff,0xde,0x0b,0x00,0x80,0x1c,0xff,0xb1,0x30,0x7f,0xff,0xff,0x10,0xbe,0x01,
+0x41,0xf9,0x08,0xfc,0x14,0x0b,0x00,0xf0,0x0a,0x6f,0xff,0x60,0xbf,0xff,0xe3,0x2d,
+0xff,0xa0,0x00,0x08,0xff,0xe4,0x2d,0xff,0xff,0xff,0x51,0xbf,0xfc,0x10,0xbf,0xfd,
+0x24,0xef,0xf0,0x02,0x61,0x09,0xff,0xe2,0x9f,0xb0,0x6f,0x9c,0x00,0x52,0xb0,0x6f,
+0xe1,0x06,0x05,0xa7,0x00,0x53,0xfb,0x03,0x20,0x00,0x07,0xfe,0x00,0x02,0x6c,0x00,
+0x34,0xf5,0x44,0xcf,0x0b,0x00,0x3f,0xe0,0x00,0x8f,0x0b,0x00,0x08,0x10,0x05,0x2b,
+0x03,0x3c,0x7f,0xff,0xfb,0xc5,0x00,0x33,0x04,0x88,0x84,0x0a,0x00,0x14,0xdf,0x4c,
+0x03,0x14,0x0e,0x9f,0x04,0x4f,0x00,0xef,0xff,0xe0,0x13,0x00,0x0e,0x80,0x36,0x66,
+0xef,0xff,0xe6,0x66,0x30,0x00,0xb2,0x02,0x12,0xff,0xf6,0x01,0x24,0x1d,0xff,0x2b,
+0x03,0x15,0x1d,0x34,0x03,0x15,0x1d,0x34,0x03,0x11,0x1d,0x09,0x00,0xf3,0x02,0x04,
+0x77,0x77,0x74,0x1c,0xfc,0x14,0x77,0x77,0x74,0xff,0xff,0xff,0xf7,0x17,0x17,0xff,
+0xe2,0x00,0x3e,0x7b,0xff,0xff,0x01,0x00,0x44,0x1c,0x66,0xff,0xef,0x0c,0x00,0x23,
+0xe0,0x22,0x01,0x00,0x40,0x20,0x00,0x00,0x03,0x2b,0x05,0x21,0x43,0x00,0x6d,0x01,
+0x01,0x1d,0x00,0x11,0xe2,0x8c,0x02,0x05,0x89,0x00,0x20,0x2f,0xfc,0x29,0x00,0x10,
+0x26,0xc0,0x02,0x11,0xbf,0xb5,0x05,0x00,0x07,0x00,0x22,0x06,0xff,0x34,0x03,0x40,
+0x1f,0xfc,0x00,0x2f,0x25,0x00,0x01,0x33,0x00,0x40,0x70,0xbf,0xf4,0x22,0x39,0x04,
+0x40,0x22,0x22,0xcf,0xf2,0x87,0x00,0x01,0x31,0x01,0x31,0xff,0xf5,0xff,0xa1,0x03,
+0x13,0x0d,0xc8,0x05,0x44,0xff,0xec,0xcc,0xcf,0x0b,0x00,0x02,0x01,0x00,0x0f,0x0b,
+0x00,0x03,0x25,0xf5,0x6f,0x0b,0x00,0x11,0xb0,0xe8,0x02,0xf1,0x01,0x00,0x00,0x00,
+0x6b,0xa0,0x00,0x00,0x3a,0xef,0xff,0xd8,0x20,0x09,0xff,0x00,0x01,0xcc,0x02,0xf2,
+0x0a,0x90,0x8f,0xf0,0x02,0xef,0xff,0xda,0x8a,0xef,0xff,0xd9,0xff,0x00,0xdf,0xfd,
+0x40,0x00,0x00,0x4d,0xff,0xff,0xf0,0x9f,0xfc,0x10,0x0b,0x04,0x30,0x1f,0xfe,0x10,
+0x91,0x06,0x30,0xef,0xff,0xf6,0xb0,0x00,0x01,0x01,0x02,0xbd,0x49,0x91,0x00,0x00,
+0x00,0x29,0x99,0x99,0x99,0x80,0x00,0x01,0x00,0x12,0x0e,0x52,0x04,0x21,0x00,0x2f,
+0x88,0x00,0x10,0x50,0x7b,0x03,0x50,0x4f,0xff,0xfa,0x99,0xa2,0x0a,0x04,0x40,0xe0,
+0xff,0xff,0xd2,0xb0,0x02,0xf1,0x09,0xef,0xf6,0x0f,0xff,0xff,0xf7,0x10,0x00,0x07,
+0xff,0xfb,0x00,0xff,0x9b,0xff,0xff,0xca,0xbf,0xff,0xfc,0x00,0x0f,0xf9,0x07,0x62,
+0x05,0x61,0x00,0x00,0xff,0x90,0x01,0x6c,0xa5,0x03,0x28,0x04,0x52,0x5a,0x00,0x10,
+0x61,0x90,0x00,0x10,0xf7,0x3c,0x01,0x10,0xf8,0x99,0x00,0x41,0xf8,0xbe,0xee,0xef,
+0xcd,0x06,0x0f,0x05,0x00,0x03,0x01,0xbe,0x02,0x50,0x13,0x33,0x4e,0xff,0xf8,0x71,
+0x00,0x00,0x5a,0x06,0x21,0x2e,0xf7,0x98,0x04,0x00,0x4b,0x00,0x22,0x51,0x00,0xac,
+0x01,0x12,0x70,0x07,0x00,0x12,0xf8,0xba,0x01,0x00,0xa9,0x03,0x10,0xae,0x55,0x00,
+0x03,0x10,0x08,0x31,0x80,0x9e,0x20,0x4b,0x00,0x22,0x06,0xfd,0x0f,0x00,0x22,0x0a,
+0xf2,0xa1,0x00,0x21,0xbf,0x2f,0x0f,0x00,0x21,0x8f,0xc0,0x64,0x00,0x61,0x07,0xb1,
+0x01,0x44,0x44,0xef,0xd8,0x06,0x03,0x69,0x00,0x00,0x08,0x00,0x14,0x70,0x06,0x05,
+0x0f,0x01,0x00,0x01,0x25,0x0b,0xd1,0xd2,0x00,0x44,0x08,0xfe,0x30,0x00,0xd8,0x00,
+0x32,0x7f,0xe1,0x00,0xde,0x00,0x51,0x08,0xe3,0x08,0xfa,0x00,0xe4,0x00,0x72,0x00,
+0x05,0xff,0x30,0xcf,0x30,0xbe,0x95,0x00,0x51,0x5f,0xd0,0x4f,0xa0,0xff,0x95,0x03,
+0x51,0xe3,0x0a,0xf5,0x0e,0xf0,0x0b,0x00,0x44,0x05,0xfd,0x02,0xfa,0x98,0x00,0x52,
+0xaf,0x20,0xfc,0x09,0xf3,0x0b,0x00,0x33,0xcf,0x20,0xfb,0x0b,0x00,0x63,0x08,0xfb,
+0x04,0xf9,0x0b,0xf1,0xaa,0x00,0x43,0x0c,0xf3,0x0f,0xe0,0x14,0x01,0x42,0x9f,0xb0,
+0x6f,0x90,0xb1,0x00,0x52,0x08,0xfe,0x10,0xef,0x20,0x20,0x01,0x45,0x06,0xa1,0x0a,
+0xf8,0xb8,0x00,0x25,0xaf,0xc0,0xb0,0x00,0x24,0xfc,0x10,0x0b,0x00,0x53,0x08,0x90,
+0x00,0x00,0x01,0xf9,0x02,0x25,0x21,0x07,0x17,0x07,0x06,0x74,0x02,0x33,0xfc,0x10,
+0x8f,0x0a,0x00,0x32,0x20,0x00,0xdf,0x09,0x00,0x10,0xf3,0x15,0x02,0x10,0xf7,0x8c,
+0x02,0x20,0xc2,0x19,0x4e,0x05,0x02,0x50,0x08,0x00,0x1c,0x05,0x00,0x0a,0x00,0x21,
+0xb3,0xef,0xfc,0x00,0x52,0xff,0xff,0xb0,0x02,0xe7,0x36,0x03,0x32,0xb0,0x00,0x01,
+0x13,0x07,0x14,0xf6,0x16,0x03,0x31,0xff,0x96,0x66,0x01,0x00,0x16,0x9f,0x68,0x00,
+0x04,0xdb,0x02,0x00,0x95,0x02,0x12,0x01,0xd1,0x05,0x23,0x0a,0xfb,0xbb,0x05,0x12,
+0x10,0x3f,0x00,0x16,0x70,0x28,0x04,0x11,0x07,0x59,0x02,0x22,0x00,0x2f,0xe8,0x06,
+0x11,0xcf,0xb0,0x07,0x12,0x08,0x14,0x06,0x12,0x2f,0xad,0x00,0x02,0xb6,0x00,0x22,
+0x90,0xdf,0xdc,0x03,0x21,0xff,0xab,0x93,0x09,0x21,0xff,0x75,0x07,0x00,0x30,0xcf,
+0xb0,0xdf,0x32,0x00,0xf2,0x01,0x6f,0xf5,0x19,0xdf,0xff,0xff,0x70,0x0d,0xff,0x82,
+0x0f,0xff,0xfd,0x00,0x02,0xdf,0xe8,0x03,0x50,0x19,0xff,0xff,0xfa,0x10,0xc1,0x04,
+0x50,0x54,0x10,0x00,0x00,0x49,0x07,0x02,0x20,0x56,0x0a,0x04,0x07,0xa0,0x8f,0xf3,
+0xaf,0xf0,0x00,0x00,0x9f,0xff,0x4a,0xff,0x04,0x06,0x30,0xf4,0xaf,0xf0,0x77,0x00,
+0x90,0x4a,0xff,0x01,0xcf,0xff,0xff,0xf4,0xaf,0xf2,0x3d,0x00,0x11,0x4a,0x4d,0x04,
+0x12,0xf4,0x32,0x04,0x12,0x4a,0x00,0x06,0x22,0xaf,0xf9,0x0d,0x00,0x11,0x07,0x0d,
+0x00,0x21,0xf0,0x05,0x0d,0x00,0x00,0x1a,0x0a,0x00,0x41,0x00,0x21,0x03,0xef,0x4e,
+0x00,0x93,0x02,0xef,0xf3,0x9f,0xf0,0x00,0x00,0x02,0xde,0x96,0x01,0x24,0x28,0x60,
+0x1c,0x06,0x14,0xd4,0xc6,0x06,0x22,0xfa,0x20,0x0a,0x01,0x12,0xff,0x98,0x02,0x00,
+0x54,0x00,0x13,0xe5,0x11,0x00,0x01,0xeb,0x09,0x02,0x3b,0x01,0x12,0x80,0xf8,0x0a,
+0x00,0x1c,0x00,0x04,0xbe,0x01,0x1c,0x1f,0xd2,0x01,0x23,0x7f,0xff,0x2c,0x00,0x03,
+0x18,0x05,0x12,0x20,0x33,0x00,0x13,0xd4,0x44,0x00,0x12,0x70,0x55,0x00,0x01,0x02,
+0x01,0x02,0x17,0x00,0x01,0x11,0x00,0x03,0x59,0x03,0x13,0xf9,0xa2,0x00,0x04,0xc8,
+0x03,0x81,0x18,0x99,0x98,0x20,0x00,0x38,0x99,0x97,0x7a,0x0a,0x40,0x1f,0xff,0xff,
+0xfa,0x8c,0x0a,0x10,0x04,0x47,0x09,0x00,0x83,0x01,0x00,0xf6,0x0a,0x4f,0xff,0xff,
+0xff,0xf2,0x11,0x00,0x4a,0x90,0x10,0x3f,0xff,0xff,0xfc,0x6f,0xff,0xff,0x80,0xaa,
+0x05,0x25,0x40,0x00,0x99,0x00,0x01,0x01,0x00,0x2c,0x96,0x0c,0x45,0x05,0x04,0x72,
+0x02,0x14,0xfa,0x11,0x00,0x1f,0xaf,0x11,0x00,0x49,0x23,0xf9,0x6f,0x55,0x07,0x05,
+0x3c,0x0a,0x10,0x28,0xa3,0x06,0xf0,0x03,0x98,0x0b,0xfe,0x20,0x00,0x00,0x9f,0xf1,
+0xcf,0xfe,0x30,0x00,0x09,0xff,0x1c,0xff,0xff,0x40,0x0d,0x00,0x31,0xff,0xff,0x50,
+0x0d,0x00,0x21,0xff,0x60,0x0d,0x00,0x21,0xff,0x79,0x0d,0x00,0x42,0xff,0xef,0xf1,
+0xcf,0xac,0x06,0x01,0x06,0x00,0x01,0x0d,0x00,0x11,0xdb,0x0d,0x00,0x11,0xc1,0x27,
+0x00,0x11,0xb0,0x34,0x00,0x11,0xa0,0x41,0x00,0x11,0x90,0x4e,0x00,0x10,0x80,0x5b,
+0x00,0x67,0x8f,0x70,0x00,0x00,0x08,0xff,0xa4,0x04,0x13,0x59,0x83,0x00,0x34,0x07,
+0xff,0xe2,0xab,0x0a,0x00,0x85,0x00,0x02,0x02,0x06,0x01,0xc0,0x04,0x13,0x4f,0xdd,
+0x06,0x14,0x03,0x61,0x06,0x12,0x2e,0xd5,0x00,0x23,0x00,0x01,0x24,0x07,0x15,0x90,
+0x4e,0x01,0x14,0x0f,0xe0,0x00,0x04,0x32,0x04,0x15,0xe2,0x68,0x00,0x22,0x06,0xbb,
+0x01,0x00,0x15,0xa2,0x24,0x00,0x14,0x0f,0x1e,0x01,0x05,0x12,0x00,0x14,0x0b,0xd0,
+0x06,0x09,0x46,0x05,0x01,0xd8,0x07,0x60,0xf4,0x00,0x00,0x01,0xdf,0xfc,0xcd,0x07,
+0x6a,0xf4,0x00,0x01,0xdf,0xff,0x40,0x09,0x00,0x20,0x00,0xdf,0xe3,0x01,0x10,0xaf,
+0x8f,0x02,0x10,0x0a,0x70,0x04,0x0f,0x0b,0x00,0x05,0x10,0xfb,0x3e,0x04,0x21,0xd1,
+0x02,0x42,0x09,0x10,0xc0,0x35,0x04,0x11,0xfc,0x4c,0x09,0x10,0xc0,0xee,0x00,0x0f,
+0x0b,0x00,0x01,0x10,0x06,0x99,0x07,0x11,0x09,0x47,0x05,0x01,0x45,0x01,0x1b,0xf9,
+0x09,0x00,0x20,0x00,0xdf,0xa6,0x09,0x23,0x2d,0x80,0xe3,0x00,0x14,0x74,0xc8,0x04,
+0x12,0xf0,0x09,0x00,0x33,0x7f,0xff,0x10,0x5c,0x01,0x1f,0xf1,0x11,0x00,0x09,0x13,
+0x0a,0xf7,0x00,0x1c,0xe4,0x8d,0x02,0xaf,0xf9,0x59,0x99,0x99,0xcf,0xff,0xa9,0x99,
+0x99,0x10,0x44,0x00,0x0e,0x08,0x11,0x00,0x23,0x4f,0xfd,0x3a,0x01,0x16,0x12,0xa9,
+0x08,0x34,0xff,0xfe,0x4f,0x55,0x00,0x04,0x66,0x00,0x22,0x95,0x99,0x01,0x00,0x21,
+0x91,0x00,0x4e,0x0f,0x04,0x6f,0x01,0x51,0x5b,0xef,0xff,0xfc,0x71,0x0a,0x00,0x42,
+0x5e,0xff,0xfc,0xab,0xf1,0x06,0x10,0x0a,0x4d,0x04,0x11,0x07,0xaf,0x02,0xb0,0xbf,
+0xff,0xa0,0x01,0xcb,0x50,0x4f,0xff,0xe3,0x00,0x0a,0x91,0x09,0x90,0xff,0xf7,0x09,
+0xff,0xfe,0x10,0x5f,0xff,0xf8,0xbc,0x04,0xf0,0x04,0x02,0xff,0xff,0xb0,0xef,0xff,
+0xf6,0x0b,0xcf,0xff,0xff,0x30,0xff,0xff,0xf4,0xdf,0xff,0xf6,0x0c,0x9b,0x03,0x70,
+0xff,0xff,0xf3,0x3f,0xff,0xf9,0x06,0x4f,0x0a,0xd0,0xff,0xff,0xa0,0x08,0xff,0xff,
+0x10,0x7f,0xff,0xb1,0x0a,0xff,0xfd,0x44,0x01,0x70,0xb0,0x01,0x32,0x00,0x6f,0xff,
+0xd2,0xbe,0x00,0x51,0xfc,0x40,0x00,0x19,0xff,0x82,0x06,0x62,0x3b,0xff,0xfe,0xcd,
+0xff,0xfe,0xee,0x04,0x80,0x27,0xce,0xff,0xda,0x50,0x00,0x00,0x00,0x26,0x16,0x00,
+0x01,0x00,0x26,0xbf,0xc1,0x0c,0x00,0x71,0xaf,0xfe,0x30,0x00,0x00,0x01,0x10,0x0c,
+0x00,0x90,0x07,0xff,0xf7,0x03,0x8c,0xff,0xff,0xd8,0x20,0x0d,0x00,0x80,0x3e,0xff,
+0xef,0xff,0xda,0xbe,0xff,0xfa,0x1b,0x00,0x90,0x01,0xbf,0xff,0xd3,0x00,0x00,0x5e,
+0xff,0xe4,0x19,0x00,0xf0,0x4f,0x08,0xff,0xf6,0x09,0x94,0x02,0xef,0xff,0x50,0x00,
+0x00,0x62,0x00,0x4e,0xff,0xac,0xff,0x70,0x6f,0xff,0xf3,0x00,0x03,0xff,0x40,0x02,
+0xcf,0xff,0xff,0xf2,0x0f,0xff,0xfe,0x00,0x0b,0xff,0xf8,0x00,0x09,0xff,0xff,0xf6,
+0x0d,0xff,0xff,0x70,0x0a,0xff,0xff,0x90,0x00,0x5f,0xff,0xf5,0x0d,0xff,0xff,0x60,
+0x01,0xff,0xff,0xd0,0x00,0x02,0xdf,0xfc,0x3f,0xff,0xfc,0x00,0x00,0x5f,0xff,0xf4,
+0x00,0x00,0x0a,0xff,0xff,0xff,0xe1,0x00,0x00,0x06,0xff,0xfe,0x10,0x00,0x00,0x7f,
+0xff,0xfe,0x30,0x00,0x19,0x00,0x61,0xe5,0x00,0x00,0x03,0xef,0xfc,0x79,0x00,0x80,
+0xaf,0xff,0xfd,0xd5,0x00,0x1b,0xff,0xd3,0x79,0x00,0x95,0x02,0x7b,0xef,0xfd,0x40,
+0x00,0x8f,0xff,0x60,0xbd,0x00,0x36,0x04,0xef,0xf8,0xca,0x00,0x27,0x1c,0xf6,0xe3,
+0x00,0x11,0x40,0x06,0x00,0x25,0x28,0x50,0x11,0x00,0x25,0x1e,0xff,0x0c,0x00,0x34,
+0x09,0xff,0xfe,0x0b,0x00,0x45,0x02,0xff,0xff,0xf8,0x16,0x01,0x33,0xff,0xff,0xf2,
+0x0b,0x00,0x52,0x4f,0xff,0xff,0xff,0xa0,0x0b,0x00,0x63,0x0d,0xff,0xff,0xff,0xff,
+0x40,0x1f,0x01,0x41,0xf1,0x00,0xbf,0xfd,0x0b,0x00,0x62,0x01,0xff,0xff,0x10,0x0b,
+0xff,0x71,0x00,0x70,0x9f,0xff,0xf2,0x00,0xcf,0xff,0xe1,0x0b,0x00,0x50,0x3f,0xff,
+0xff,0x30,0x0d,0xf1,0x00,0xf0,0x09,0x00,0x00,0x0c,0xff,0xff,0xf4,0x00,0xef,0xff,
+0xff,0x20,0x00,0x00,0x05,0xff,0xff,0xff,0x60,0x0f,0xff,0xff,0xfb,0x00,0x00,0x12,
+0x00,0x40,0xff,0xbe,0xff,0xff,0xfc,0x00,0x10,0x8f,0x59,0x00,0x20,0x0d,0xff,0x14,
+0x01,0x82,0x1f,0xff,0xff,0xff,0xf0,0x00,0xaf,0xff,0x30,0x01,0x40,0xff,0xff,0x92,
+0x5f,0x06,0x00,0x25,0x10,0xff,0x01,0x00,0x25,0xf5,0x0a,0x0b,0x00,0x44,0xfe,0x10,
+0x04,0x55,0x01,0x00,0x13,0x10,0xb0,0x00,0x14,0x24,0xc4,0x00,0x15,0x0b,0x04,0x01,
+0x30,0xcf,0xf6,0x0f,0xb8,0x00,0x00,0x55,0x00,0x51,0xf6,0xff,0xff,0xff,0x30,0x6f,
+0x00,0xf2,0x0d,0xed,0xee,0xff,0xff,0x20,0x7f,0xff,0xef,0xff,0xf5,0x00,0x01,0xdf,
+0xd1,0x6f,0xff,0x80,0xcf,0xf5,0x00,0x00,0x01,0xc2,0x5f,0xff,0x90,0x0b,0xf5,0xf8,
+0x00,0x32,0xa0,0x00,0x12,0xc9,0x00,0x30,0xb0,0x00,0x02,0xf6,0x00,0x70,0x2e,0xff,
+0xc0,0x8b,0x00,0xbf,0x60,0x09,0x00,0x60,0xd1,0x6f,0xfa,0x0c,0xff,0x60,0xb1,0x01,
+0x10,0x06,0x88,0x00,0x60,0x6f,0xff,0xff,0xe2,0x00,0x07,0x91,0x00,0x84,0xde,0xee,
+0xe3,0x00,0x00,0x07,0xee,0xff,0x62,0x01,0x15,0x0c,0x6b,0x01,0x14,0xbf,0x09,0x00,
+0x38,0x01,0x20,0x00,0x01,0x00,0x33,0x9f,0x30,0x00,0x3b,0x01,0x13,0x30,0x08,0x00,
+0x02,0x09,0x00,0x11,0x9f,0xaa,0x00,0x00,0x08,0x00,0x40,0x92,0xdf,0xff,0x30,0x08,
+0x00,0x50,0x90,0x01,0xdf,0xff,0x30,0x08,0x00,0x10,0x00,0x09,0x00,0x40,0x8f,0xff,
+0x90,0x00,0x09,0x00,0x11,0x29,0x63,0x01,0x51,0x01,0xdf,0xf3,0x09,0x80,0x5e,0x00,
+0x15,0xb5,0x5a,0x00,0x31,0x01,0xdc,0x10,0xc9,0x00,0x41,0x80,0xbf,0xfc,0x10,0xd1,
+0x00,0x40,0x55,0xff,0xfc,0x10,0x08,0x00,0x50,0xd1,0x05,0xff,0xfc,0x10,0x08,0x00,
+0x10,0x00,0x09,0x00,0x00,0x08,0x00,0x00,0x09,0x00,0x10,0x5f,0x08,0x00,0x01,0xa1,
+0x01,0x22,0xd1,0x00,0x09,0x00,0x22,0xd1,0x00,0x09,0x00,0x22,0xd1,0x00,0x09,0x00,
+0x12,0xb1,0x08,0x00,0x16,0x10,0xbd,0x00,0x80,0x05,0xfc,0x10,0x00,0x01,0x11,0x11,
+0x11,0x13,0x00,0x51,0x6f,0xff,0xc1,0x07,0xff,0xac,0x01,0x81,0x00,0x06,0xff,0xff,
+0xfd,0x14,0xff,0xff,0xc2,0x00,0x10,0x6f,0x51,0x00,0xf2,0x09,0x35,0x55,0x55,0x57,
+0xff,0x30,0x00,0xcf,0xc7,0xff,0x5f,0xf4,0x00,0x00,0x00,0x03,0xff,0x30,0x00,0x27,
+0x17,0xff,0x04,0x60,0x0c,0x00,0x00,0x4f,0x02,0x2f,0x00,0x00,0x0c,0x00,0x07,0x53,
+0x19,0x43,0xff,0x34,0x91,0x0c,0x00,0xe4,0x9f,0xf6,0xff,0x6f,0xf9,0x00,0x07,0xff,
+0x66,0x66,0x66,0x62,0x2e,0xff,0x78,0x01,0xa0,0xff,0xff,0x22,0xef,0xff,0xfe,0x20,
+0x00,0x03,0xef,0x85,0x01,0x46,0x30,0x2e,0xff,0xe2,0x06,0x01,0x29,0xdd,0x10,0x70,
+0x01,0x43,0x03,0x44,0x44,0x43,0xfb,0x02,0x31,0xff,0xff,0xf7,0x0a,0x00,0x14,0xff,
+0x0a,0x00,0x11,0x0f,0x55,0x02,0x45,0xee,0xee,0xee,0xd4,0x63,0x02,0x2f,0xef,0xff,
+0x01,0x00,0x41,0x14,0x6f,0x09,0x00,0x01,0xc0,0x03,0x15,0x16,0xb7,0x03,0x14,0xfb,
+0x09,0x00,0x24,0xff,0xfb,0x09,0x00,0x24,0xff,0xfb,0x09,0x00,0x24,0xff,0xfb,0x09,
+0x00,0x01,0x0a,0x00,0x11,0x0b,0x41,0x00,0xa1,0xfa,0x00,0x00,0x00,0x69,0x99,0xff,
+0xff,0xe9,0x99,0x60,0x02,0x22,0x0e,0xff,0x95,0x03,0x00,0x5e,0x03,0x3f,0xd0,0x00,
+0x00,0x13,0x00,0x0a,0xf2,0x02,0x04,0x77,0x77,0x60,0xef,0xff,0xd0,0x67,0x77,0x74,
+0xff,0xff,0xff,0x25,0x99,0x84,0x2f,0x54,0x03,0x4e,0x76,0x66,0x7e,0xff,0x01,0x00,
+0x26,0x1c,0x66,0x0b,0x01,0x23,0xe0,0x22,0x01,0x00,0x04,0xca,0x02,0x24,0x38,0x51,
+0xc2,0x00,0x33,0xdf,0xff,0xe8,0x8f,0x04,0x22,0xff,0xff,0xc8,0x01,0x00,0xd8,0x04,
+0x03,0x64,0x04,0x24,0x1f,0xff,0x8b,0x00,0x12,0x5f,0xb9,0x00,0x02,0x86,0x01,0x13,
+0xf7,0x3c,0x00,0x15,0x6f,0x74,0x04,0x34,0x3f,0xff,0xd0,0xbb,0x03,0x04,0xe2,0x04,
+0x15,0x07,0xc6,0x00,0x10,0x4f,0x31,0x04,0x30,0x01,0x7d,0xd1,0x66,0x02,0x80,0x80,
+0x00,0x02,0x9f,0xff,0xfb,0x01,0x9f,0x11,0x01,0x12,0x0e,0x4f,0x04,0x10,0xb0,0x70,
+0x04,0x00,0x01,0x00,0x13,0xf9,0xe4,0x01,0x33,0xff,0xfe,0x60,0xd8,0x02,0x23,0xff,
+0x91,0xb0,0x04,0x22,0xfb,0x61,0x4b,0x00,0x24,0x45,0x42,0xb8,0x00,0x24,0x46,0x40,
+0xf9,0x04,0xa0,0xc1,0x00,0x00,0x03,0xac,0x80,0x9f,0xff,0xff,0xa0,0xc4,0x00,0x40,
+0x7e,0xfa,0x08,0xff,0x08,0x00,0x50,0xa0,0xff,0x70,0x5f,0xf1,0x08,0x00,0x40,0x0c,
+0xfe,0x9e,0xff,0x08,0x00,0x00,0xe0,0x04,0x11,0xfc,0x1a,0x05,0x24,0x3a,0xdf,0x22,
+0x05,0x12,0x4f,0x08,0x00,0x00,0x6c,0x00,0x71,0xfd,0x10,0x00,0x00,0x04,0xce,0xff,
+0x09,0x00,0x10,0x04,0x99,0x00,0x00,0x09,0x00,0xd0,0xcf,0xe7,0xdf,0xf0,0x2e,0xff,
+0xfd,0x10,0x0f,0xf6,0x04,0xff,0x10,0x09,0x00,0x91,0xef,0xc3,0xbf,0xf0,0x00,0x2e,
+0xff,0xfd,0x17,0xae,0x00,0x41,0x2e,0xff,0xf7,0x08,0xb6,0x00,0x54,0x17,0x84,0x00,
+0x00,0x21,0x9a,0x00,0x50,0x08,0x99,0x99,0x98,0x07,0x10,0x03,0x00,0x79,0x01,0x12,
+0xfb,0x59,0x05,0x51,0xfe,0x0f,0xfb,0x00,0x11,0x11,0x00,0x51,0xef,0xf8,0xdf,0xf9,
+0x3f,0x74,0x03,0x32,0x0f,0xff,0x93,0xf7,0x00,0x31,0xff,0xf9,0x3f,0x09,0x00,0x13,
+0xaf,0x11,0x00,0x1f,0xfa,0x11,0x00,0x28,0xa3,0x9f,0xff,0xb0,0xab,0xbb,0xbb,0xbb,
+0xbb,0xb4,0xff,0x88,0x01,0x12,0x0f,0x01,0x02,0x02,0x34,0x03,0x00,0xd8,0x01,0x20,
+0x03,0x66,0x01,0x00,0x00,0xda,0x05,0x01,0x09,0x00,0x34,0x30,0x00,0x0b,0xd9,0x02,
+0x04,0xe2,0x02,0x11,0x0f,0x88,0x05,0x52,0x2f,0xff,0x60,0xff,0x60,0x7e,0x01,0x22,
+0x5f,0xf6,0x0d,0x02,0x14,0xfa,0x11,0x00,0x20,0xaf,0xf9,0xc1,0x05,0x34,0x6f,0xff,
+0xfa,0x61,0x02,0x13,0xaf,0x08,0x00,0x00,0x11,0x00,0x22,0xd4,0x16,0x11,0x00,0x32,
+0xf2,0x00,0x08,0x11,0x00,0x00,0x3e,0x02,0x00,0x11,0x00,0x32,0xf3,0x00,0x09,0x11,
+0x00,0x28,0xe6,0x38,0x33,0x00,0x13,0x8f,0x09,0x00,0x30,0x40,0x23,0x33,0x01,0x00,
+0x42,0x32,0x10,0x8a,0xaa,0x01,0x00,0x14,0x4f,0x22,0x00,0x04,0xc8,0x02,0x2f,0x80,
+0x00,0x01,0x00,0x05,0x0f,0x33,0x00,0x42,0x22,0x06,0x77,0x01,0x00,0x24,0x76,0x0b,
+0xe7,0x00,0x15,0xfb,0x5e,0x03,0x15,0xfc,0x09,0x00,0x13,0x09,0x09,0x00,0x33,0xf9,
+0x09,0x05,0xef,0x06,0x40,0x06,0xfd,0x22,0xdf,0x09,0x00,0x50,0xd2,0x1a,0xff,0xff,
+0x50,0x16,0x06,0x20,0x90,0x3e,0x05,0x00,0x51,0x5e,0xff,0xfe,0x50,0x7f,0x18,0x00,
+0x41,0x1b,0xfa,0x11,0xcf,0x2b,0x00,0x43,0xe5,0x00,0x04,0xef,0x47,0x00,0x19,0x9c,
+0xbd,0x03,0x1f,0xfe,0x79,0x04,0x01,0x41,0x5a,0xaa,0xaa,0x90,0xb2,0x03,0x22,0xff,
+0xf3,0x04,0x05,0x11,0xe0,0x04,0x08,0x00,0x4f,0x06,0x12,0x04,0xe8,0x07,0x11,0x06,
+0xc4,0x03,0x00,0x78,0x01,0x42,0xfe,0xbb,0xbb,0x60,0x77,0x07,0x22,0xc0,0x0c,0x5e,
+0x01,0x12,0x0e,0x7d,0x04,0x01,0x13,0x08,0x12,0xf2,0xaa,0x03,0x11,0x80,0x4c,0x05,
+0x12,0xfe,0xfe,0x03,0x12,0xf5,0x1f,0x09,0x12,0xc0,0x05,0x07,0x11,0x30,0x3c,0x02,
+0x12,0xfa,0xdd,0x03,0x12,0xf1,0xee,0x03,0x12,0x70,0x28,0x04,0x12,0x00,0x9e,0x08,
+0x21,0x81,0x00,0x92,0x04,0x50,0x7e,0xff,0xd7,0x76,0x30,0x8e,0x00,0x41,0xf2,0x4f,
+0xff,0xfd,0x6f,0x02,0x18,0x9a,0x6f,0x02,0x00,0x11,0x00,0x40,0xa3,0x22,0x22,0x10,
+0x11,0x00,0x20,0xe0,0x79,0x19,0x03,0x41,0x0f,0xff,0xfc,0x0f,0x19,0x03,0x31,0xff,
+0xff,0xc1,0x19,0x03,0x41,0x0f,0xff,0xfc,0x1f,0x19,0x03,0x01,0x11,0x00,0x01,0x19,
+0x03,0x22,0xfc,0x1f,0x19,0x03,0x23,0xff,0xc1,0x5e,0x02,0x02,0x11,0x00,0x14,0xfa,
+0x11,0x00,0x32,0xa9,0xcc,0xc9,0x11,0x00,0x01,0x8e,0x02,0x02,0xce,0x03,0x04,0x11,
+0x00,0x01,0x7a,0x00,0x00,0x14,0x01,0x10,0x03,0xa4,0x02,0x10,0x51,0x28,0x09,0x14,
+0x60,0x9c,0x04,0x03,0x09,0x00,0x21,0x5e,0xfb,0xdf,0x00,0x00,0x7c,0x01,0x13,0xb1,
+0xfa,0x04,0x01,0xc0,0x04,0x13,0xef,0xff,0x01,0x13,0x5f,0xbc,0x00,0x23,0x09,0xff,
+0x2d,0x01,0x12,0xaf,0x43,0x01,0x03,0x2b,0x03,0x13,0xf5,0x2a,0x00,0x42,0xff,0x70,
+0x00,0x2f,0xbd,0x01,0x00,0x72,0x01,0x01,0x2b,0x00,0x13,0x04,0xad,0x01,0x14,0xd1,
+0x4d,0x02,0x13,0x89,0x08,0x00,0x17,0xe4,0x7a,0x02,0x32,0x0f,0xff,0xf9,0x09,0x00,
+0x23,0x7f,0xfe,0x90,0x05,0x22,0x25,0x10,0xe8,0x06,0x02,0x01,0x00,0x35,0x43,0x00,
+0x9f,0xff,0x01,0x17,0xe1,0x47,0x09,0xf0,0x12,0xff,0x82,0x6f,0x22,0xf6,0x24,0xf3,
+0x27,0xe2,0x2f,0xf6,0xff,0x60,0x4f,0x00,0xe4,0x02,0xf1,0x05,0xd0,0x0f,0xf6,0xff,
+0x94,0x8f,0x44,0xf8,0x46,0xf6,0x49,0xe4,0x5f,0xf6,0x38,0x02,0x50,0xef,0xff,0xef,
+0xfe,0xef,0x36,0x09,0x7b,0x20,0x89,0x01,0xf4,0x04,0xf0,0x0c,0x0b,0x00,0x04,0x01,
+0x00,0xb1,0xf6,0xff,0x93,0x7f,0x43,0x33,0x33,0x33,0x38,0xe3,0x4f,0x4d,0x00,0x00,
+0x05,0x05,0x00,0x4d,0x00,0x20,0xa6,0x9f,0x15,0x04,0x47,0x6a,0xe6,0x6f,0xf6,0x79,
+0x00,0x15,0x6f,0x0b,0x00,0x14,0xb0,0xc4,0x00,0x24,0x17,0x81,0xae,0x07,0x32,0x8f,
+0xff,0xc0,0x0a,0x00,0x14,0x2a,0x37,0x06,0x32,0x04,0xbf,0xff,0x47,0x0a,0x20,0x00,
+0x5c,0x34,0x00,0x10,0xf1,0x4b,0x03,0x14,0xdf,0xaf,0x01,0x23,0x8e,0xff,0x67,0x08,
+0x15,0x19,0x53,0x00,0x02,0xa1,0x02,0x01,0x57,0x0a,0x04,0x55,0x03,0x13,0x00,0x25,
+0x08,0x02,0x97,0x09,0x42,0x11,0x11,0x11,0xbf,0xa2,0x01,0x02,0x46,0x07,0x15,0xf6,
+0xf5,0x0a,0x25,0xfe,0x00,0x15,0x00,0x15,0x80,0x15,0x00,0x15,0xf1,0x15,0x00,0x15,
+0xf9,0x29,0x0c,0x24,0xff,0x20,0xd5,0x03,0x25,0xff,0x90,0x59,0x08,0x01,0x43,0x06,
+0x61,0xad,0xdd,0xdd,0xdd,0x48,0x40,0x28,0x05,0x31,0xf5,0xaf,0x40,0x82,0x00,0x32,
+0x5a,0xff,0x40,0x0f,0x00,0x20,0xff,0x40,0x0f,0x00,0x43,0x59,0xee,0xed,0x0f,0x71,
+0x08,0x03,0x6f,0x08,0x12,0x1f,0x9c,0x00,0x13,0xf1,0xa4,0x00,0x0f,0x0f,0x00,0x31,
+0x03,0x31,0x02,0x12,0x00,0xa8,0x07,0x0c,0xad,0x04,0x53,0x01,0x58,0x9a,0xa9,0x74,
+0x58,0x07,0x11,0xcf,0x8a,0x04,0x26,0x50,0x00,0x24,0x01,0xf0,0x01,0xfd,0x50,0x00,
+0x03,0xdf,0xff,0xff,0xb8,0x65,0x57,0x9d,0xff,0xff,0xfb,0x10,0x5f,0x11,0x00,0x00,
+0xa4,0x01,0x44,0xef,0xff,0xe2,0xdf,0xcf,0x0a,0xf0,0x04,0x08,0xff,0xf9,0x2e,0xc2,
+0x00,0x00,0x37,0x9a,0xa9,0x62,0x00,0x00,0x4e,0xc0,0x01,0x00,0x00,0x5d,0x3b,0x00,
+0x84,0xb3,0x00,0x01,0x00,0x00,0x00,0x1b,0xff,0x35,0x03,0x00,0x40,0x01,0x42,0xe9,
+0x64,0x46,0xaf,0xe4,0x07,0x21,0x3e,0xf7,0xc7,0x0c,0x11,0xd1,0x6e,0x0c,0x02,0x34,
+0x03,0x04,0x9c,0x09,0x36,0x28,0x71,0x00,0x88,0x0c,0x15,0xfd,0x0c,0x00,0x13,0x07,
+0x0d,0x0b,0x03,0x56,0x07,0x16,0x10,0xab,0x0d,0x17,0xf6,0xce,0x00,0x05,0xd9,0x09,
+0x03,0x01,0x00,0x17,0x41,0xf2,0x02,0x27,0xff,0x30,0x08,0x05,0x43,0x80,0xff,0x71,
+0x11,0x01,0x00,0x52,0xaf,0xf9,0xff,0x64,0xbb,0x01,0x00,0x53,0xb0,0xaf,0xfe,0xff,
+0x67,0x22,0x00,0x27,0xf0,0x7d,0x0c,0x00,0x1f,0x07,0x0c,0x00,0x04,0x46,0x8e,0xfe,
+0xff,0x60,0x34,0x0e,0x33,0xff,0xa6,0x66,0x01,0x00,0x27,0xcf,0xd5,0x2e,0x0a,0x26,
+0x70,0x5e,0xde,0x05,0x1f,0x10,0x9c,0x00,0x1e,0x11,0x62,0x9a,0x00,0x11,0xb7,0x60,
+0x00,0x14,0x63,0xe9,0x09,0x17,0x7d,0x0c,0x00,0x1f,0x07,0x0c,0x00,0x04,0x0f,0x9c,
+0x00,0x50,0x00,0x38,0x01,0x13,0xba,0x60,0x00,0x23,0x66,0xff,0xa7,0x03,0x17,0x7d,
+0x0c,0x00,0x1f,0x07,0x0c,0x00,0x04,0x0f,0x9c,0x00,0x1a,0x50,0xff,0xff,0xff,0xfc,
+0x10,0x24,0x03,0x44,0x01,0x00,0x45,0x41,0x00,0x9f,0xff,0x01,0x00,0x26,0x30,0xff,
+0x01,0x00,0x43,0x80,0xff,0x71,0x11,0x01,0x00,0x80,0xaf,0xf9,0xff,0x67,0xbb,0xbb,
+0x10,0x00,0x01,0x00,0x62,0xaf,0xfe,0xff,0x6a,0xff,0xff,0x0c,0x00,0x17,0x7d,0x0c,
+0x00,0x1f,0x07,0x0c,0x00,0x04,0x41,0x8e,0xfe,0xff,0x60,0x09,0x00,0x02,0x3c,0x00,
+0x23,0xa6,0x66,0x01,0x00,0x36,0xcf,0xd5,0xef,0x6c,0x00,0x25,0x70,0x5e,0x0b,0x00,
+0x44,0xfc,0x10,0x00,0x11,0x01,0x00,0x35,0x00,0x00,0x6f,0x18,0x00,0x29,0xfd,0x20,
+0x9c,0x00,0x23,0x95,0x55,0x01,0x00,0x29,0xcf,0xd6,0x60,0x00,0x05,0x0c,0x00,0x17,
+0x7d,0x0c,0x00,0x1e,0x07,0x0c,0x00,0x0f,0x9c,0x00,0x25,0x01,0x01,0x00,0x26,0x01,
+0x00,0x01,0x00,0x24,0x8f,0xf4,0x0a,0x00,0x44,0x05,0xcd,0xff,0xfc,0x0c,0x00,0x44,
+0x3f,0xa8,0xef,0xfb,0x0c,0x00,0x40,0xcb,0x00,0x3b,0xa1,0x08,0x00,0x51,0x1a,0xec,
+0x30,0x04,0xf2,0x3f,0x00,0x70,0x70,0x00,0xaf,0xff,0xe0,0x1d,0x90,0x0c,0x00,0x37,
+0x03,0xfd,0x40,0xd8,0x00,0xf7,0x10,0xf8,0xdf,0xff,0xf6,0x55,0x5a,0xf7,0x55,0x55,
+0x55,0x57,0xff,0xa1,0x3e,0xff,0x70,0x00,0x00,0xe8,0x00,0x00,0x00,0x02,0xd3,0x00,
+0x01,0x42,0x00,0x00,0x00,0x7f,0x77,0x00,0x54,0x0e,0x80,0x6f,0xff,0x70,0x79,0x00,
+0x44,0xfa,0xcf,0xff,0x80,0x19,0x00,0x26,0x5a,0xdf,0x0c,0x00,0x16,0x00,0x24,0x00,
+0x15,0x00,0x20,0x00,0xf0,0x6d,0xcd,0xc9,0x40,0x00,0x00,0x02,0xdf,0xff,0xef,0xff,
+0xa0,0x00,0x01,0xef,0xff,0xe3,0xff,0xff,0xa0,0x00,0x9f,0xff,0xfe,0x05,0xff,0xff,
+0x30,0x0f,0xff,0xff,0xe0,0x06,0xff,0xf9,0x05,0xff,0xea,0xfe,0x09,0x08,0xff,0xd0,
+0x8f,0xf7,0x0a,0xe0,0xe7,0x0d,0xff,0x0a,0xff,0xf5,0x08,0x09,0x08,0xff,0xf2,0xbf,
+0xff,0xf5,0x00,0x07,0xff,0xff,0x3b,0xff,0xff,0xf4,0x04,0xff,0xff,0xf4,0xbf,0xff,
+0xfd,0x10,0x1d,0xff,0xff,0x4a,0xff,0xfd,0x11,0x02,0x1d,0xff,0xf3,0x9f,0xfd,0x12,
+0xd0,0xd3,0x2e,0xff,0x26,0xff,0x72,0xef,0x0d,0x41,0xdf,0xf0,0x3f,0xff,0xff,0xf0,
+0x30,0xcf,0xfc,0x00,0xdf,0xff,0xff,0x00,0xcf,0xff,0x70,0x04,0xff,0xff,0xf0,0xbf,
+0xff,0xe0,0x40,0x00,0xa1,0xbf,0xff,0xf4,0x00,0x00,0x03,0xaf,0xff,0xff,0xa3,0x0c,
+0x01,0x11,0x21,0x96,0x00,0xf4,0x00,0x04,0x99,0x99,0x91,0x00,0x00,0x05,0x66,0x66,
+0xef,0xff,0xff,0xa6,0x66,0x62,0x10,0x01,0x13,0x9d,0x08,0x00,0x15,0xf7,0xbf,0x00,
+0x12,0xcf,0x11,0x00,0x24,0x60,0x0d,0x19,0x00,0xff,0x08,0xdf,0xf9,0xef,0xe9,0xff,
+0xad,0xff,0x70,0x0d,0xff,0x2a,0xfb,0x1f,0xf4,0x8f,0xf7,0x00,0xdf,0xf2,0xaf,0xb1,
+0xff,0x48,0x11,0x00,0x24,0x65,0x4b,0xfc,0x3f,0xf6,0xaf,0xf7,0x66,0x00,0x12,0x08,
+0x08,0x00,0x31,0xf2,0x00,0x04,0x18,0x02,0x14,0x52,0x86,0x00,0x14,0x08,0x63,0x01,
+0x24,0x01,0xcf,0x14,0x02,0x42,0x1c,0xff,0xff,0xc1,0x0a,0x00,0x42,0x1d,0xff,0xff,
+0xfb,0x13,0x00,0x10,0x71,0xfe,0x00,0x01,0x26,0x00,0x43,0xf7,0x1d,0xff,0xf8,0x26,
+0x00,0x31,0x71,0xdf,0x90,0x13,0x00,0x43,0xff,0xff,0xf7,0x17,0x13,0x00,0x33,0xff,
+0xff,0x40,0x13,0x00,0x25,0xff,0xf9,0x13,0x00,0x1f,0x90,0x13,0x00,0x0d,0x14,0x08,
+0x13,0x00,0x24,0x00,0x0a,0x13,0x00,0x24,0x00,0x0c,0x13,0x00,0x24,0x00,0x0e,0x13,
+0x00,0x24,0x00,0x0f,0x13,0x00,0x46,0x00,0x03,0x53,0x10,0x09,0x02,0x03,0x03,0x04,
+0x10,0x43,0x61,0x02,0x04,0xef,0x02,0x44,0xe2,0x00,0x00,0x3e,0x7c,0x01,0xa0,0xf9,
+0x00,0x03,0xef,0xff,0xff,0xfd,0xff,0xff,0xee,0xd0,0x00,0x10,0x3e,0x76,0x03,0x80,
+0x7f,0xfd,0x12,0xef,0xff,0xfc,0x03,0xef,0xb1,0x00,0x70,0x07,0xd1,0x00,0xcf,0xff,
+0xfc,0x3f,0x2a,0x00,0x11,0xf3,0x82,0x00,0x22,0xfc,0xef,0x43,0x04,0x61,0x00,0xaf,
+0xff,0xff,0xfc,0xcf,0xb3,0x03,0x70,0x10,0x00,0x7f,0xff,0xff,0xfc,0x1d,0x0c,0x00,
+0x90,0xd1,0x00,0x20,0x07,0xff,0xff,0xfc,0x01,0xdf,0x23,0x00,0x61,0x0a,0xf3,0x00,
+0xbf,0xff,0xfc,0xd4,0x00,0x93,0xb1,0xaf,0xff,0x44,0xff,0xff,0xfc,0x00,0x01,0x73,
+0x01,0x01,0x3c,0x01,0x15,0x1c,0x10,0x03,0x43,0x00,0x00,0x01,0xaf,0x0c,0x00,0xb2,
+0xa0,0x00,0x00,0x36,0x66,0x66,0x66,0x40,0x00,0x00,0x4f,0x0f,0x00,0x11,0x5f,0x17,
+0x00,0xf2,0x02,0x20,0x5f,0xf2,0x1f,0x21,0xf1,0x2f,0xf4,0x6f,0xff,0x21,0xf2,0x1f,
+0x12,0xff,0x4f,0xff,0x0f,0x00,0x82,0xff,0xff,0xee,0xfe,0xef,0xee,0xff,0x4f,0x3c,
+0x00,0x13,0xf4,0x44,0x00,0x0f,0x0f,0x00,0x29,0x12,0x3d,0x07,0x00,0x12,0xf1,0x21,
+0x01,0x85,0xf6,0x00,0x02,0x22,0x22,0x22,0x22,0x20,0x4f,0x01,0x24,0x01,0xb0,0x0a,
+0x00,0x51,0x1c,0xf1,0x00,0x00,0x34,0x0a,0x00,0x51,0xbf,0xf1,0x00,0x04,0xff,0x0a,
+0x00,0x44,0xef,0xf1,0x00,0x5f,0x0a,0x00,0x40,0x06,0xff,0xff,0x33,0x01,0x00,0x34,
+0xef,0xf1,0x7f,0xe8,0x00,0x25,0xf1,0xdf,0x0a,0x00,0x41,0x2e,0xff,0xff,0xcc,0x01,
+0x00,0x45,0x90,0x01,0xdf,0xff,0x53,0x00,0x15,0xff,0x68,0x00,0x18,0xbd,0xcd,0x03,
+0x50,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const etxFontBlock blocks[] = {
+{ .bitmap_index = 0, .comp_offset = 0, .size = 4086, .comp_size = 3349 },
+{ .bitmap_index = 4086, .comp_offset = 3349, .size = 3987, .comp_size = 3132 },
+{ .bitmap_index = 8073, .comp_offset = 6481, .size = 4026, .comp_size = 2965 },
+{ .bitmap_index = 12099, .comp_offset = 9446, .size = 3978, .comp_size = 2692 },
+{ .bitmap_index = 16077, .comp_offset = 12138, .size = 4088, .comp_size = 2531 },
+{ .bitmap_index = 20165, .comp_offset = 14669, .size = 4079, .comp_size = 2509 },
+{ .bitmap_index = 24244, .comp_offset = 17178, .size = 3963, .comp_size = 2921 },
+{ .bitmap_index = 28207, .comp_offset = 20099, .size = 4055, .comp_size = 3066 },
+{ .bitmap_index = 32262, .comp_offset = 23165, .size = 3994, .comp_size = 2994 },
+{ .bitmap_index = 36256, .comp_offset = 26159, .size = 4085, .comp_size = 3155 },
+{ .bitmap_index = 40341, .comp_offset = 29314, .size = 4047, .comp_size = 3331 },
+{ .bitmap_index = 44388, .comp_offset = 32645, .size = 4017, .comp_size = 3016 },
+{ .bitmap_index = 48405, .comp_offset = 35661, .size = 4062, .comp_size = 3298 },
+{ .bitmap_index = 52467, .comp_offset = 38959, .size = 4063, .comp_size = 3551 },
+{ .bitmap_index = 56530, .comp_offset = 42510, .size = 3940, .comp_size = 3071 },
+{ .bitmap_index = 60470, .comp_offset = 45581, .size = 4065, .comp_size = 3299 },
+{ .bitmap_index = 64535, .comp_offset = 48880, .size = 4071, .comp_size = 3342 },
+{ .bitmap_index = 68606, .comp_offset = 52222, .size = 4095, .comp_size = 2495 },
+{ .bitmap_index = 72701, .comp_offset = 54717, .size = 4010, .comp_size = 2212 },
+{ .bitmap_index = 76711, .comp_offset = 56929, .size = 1484, .comp_size = 853 },
 };
 
 static const etxFontCmap cmaps[] = {
@@ -3604,11 +4020,11 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 12527, .range_length = 51124, .glyph_id_start = 233, .list_length = 349, .type = 3, .unicode_list = 4801, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[99736] __SDRAMFONTS;
+static uint8_t etxUncompBuf[21541] __SDRAMFONTS;
 
 const etxLz4Font lv_font_jp_XS = {
-.uncomp_size = 99376,
-.comp_size = 57431,
+.uncomp_size = 21181,
+.comp_size = 5884,
 .line_height = 22,
 .base_line = 5,
 .subpx = 0,
@@ -3621,12 +4037,15 @@ const etxLz4Font lv_font_jp_XS = {
 .bitmap_format = 0,
 .left_class_cnt = 122,
 .right_class_cnt = 119,
-.glyph_bitmap = 5499,
-.class_pair_values = 83694,
-.left_class_mapping = 98212,
-.right_class_mapping = 98794,
+.glyph_bitmap = 0,
+.class_pair_values = 5499,
+.left_class_mapping = 20017,
+.right_class_mapping = 20599,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 99736,
+.lvglFontBufSize = 21541,
+.block_count = 20,
+.blocks = blocks,
+.compressed_bitmap = lz4BitmapData,
 };
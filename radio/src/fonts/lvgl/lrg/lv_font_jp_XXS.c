@@ -207,2100 +207,2234 @@ static const uint8_t lz4FontData[] ={
 0xb4,0x2f,0xb6,0x2f,0xb7,0x2f,0xb8,0x2f,0xba,0x2f,0xbb,0x2f,0xbe,0x2f,0xbf,0x2f,
 0xc8,0x2f,0xc9,0x2f,0xce,0x2f,0xcf,0x2f,0xd0,0x2f,0xd1,0x2f,0xd2,0x2f,0xd9,0x2f,
 0xda,0x2f,0xdb,0x2f,0xdc,0x2f,0xdf,0x2f,0xe2,0x2f,0xe3,0x2f,0x00,0x01,0x02,0x03,
-0x00,0x04,0x05,0x06,0x07,0x08,0xe7,0x01,0xf0,0xff,0xff,0xff,0xa3,0x0c,0x0d,0x0e,
-0x0f,0x10,0x00,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x1d,
-0x00,0x1e,0x1f,0x00,0x20,0x21,0x22,0x23,0x24,0x25,0x00,0x26,0x27,0x28,0x29,0x2a,
-0x00,0x00,0x04,0x00,0x0d,0x00,0x11,0x1d,0x1b,0x1d,0x1c,0x1d,0x1e,0x1d,0x32,0x1d,
-0x3e,0x1d,0x68,0x1d,0x97,0x1d,0xe7,0x1d,0xe9,0x1d,0x07,0x1e,0x0c,0x1e,0x5e,0x1e,
-0x5f,0x1e,0x64,0x1e,0x6d,0x1e,0x90,0x1e,0xee,0x1e,0xf2,0x1e,0xff,0x1e,0x1e,0x1f,
-0x35,0x1f,0x60,0x1f,0x6d,0x1f,0x85,0x1f,0xaa,0x1f,0xe0,0x1f,0x54,0x20,0x56,0x20,
-0x59,0x20,0x76,0x20,0x79,0x20,0x7d,0x20,0x82,0x20,0x88,0x20,0x96,0x20,0x97,0x20,
-0x9e,0x20,0x0b,0x21,0x17,0x21,0x2e,0x21,0x36,0x21,0x3a,0x21,0x4c,0x21,0x5b,0x21,
-0x5e,0x21,0x83,0x21,0xac,0x21,0xb0,0x21,0xb1,0x21,0xca,0x21,0xe6,0x21,0x27,0x22,
-0x69,0x22,0xcc,0x22,0xe8,0x22,0x04,0x23,0x08,0x23,0x19,0x23,0x1d,0x23,0x1e,0x23,
-0x22,0x23,0x37,0x23,0x3c,0x23,0x5b,0x23,0x79,0x23,0x60,0x24,0x79,0x25,0xef,0x25,
-0x03,0x26,0x0b,0x26,0x0e,0x26,0x38,0x26,0x39,0x26,0x58,0x26,0xdc,0x26,0x42,0x27,
-0x68,0x27,0xa8,0x27,0x01,0x28,0x1a,0x28,0x27,0x28,0x2b,0x28,0x38,0x28,0x3f,0x28,
-0x42,0x28,0x79,0x28,0x69,0x2a,0x9d,0x2a,0xab,0x2a,0xb0,0x2a,0xca,0x2a,0x0f,0x2b,
-0x20,0x2b,0x22,0x2b,0xf7,0x2c,0xff,0x2c,0x49,0x2d,0x84,0x2d,0xb7,0x2d,0xb8,0x2d,
-0x07,0x2e,0x20,0x2e,0x42,0x2e,0x46,0x2e,0x48,0x2e,0x64,0x2e,0x73,0x2e,0x82,0x2e,
-0x96,0x2e,0x9d,0x2e,0xba,0x2e,0xbf,0x2e,0xd6,0x2e,0xed,0x2e,0x36,0x2f,0xd6,0x2f,
-0x04,0x30,0x20,0x30,0x5c,0x30,0x21,0x31,0x5c,0x31,0xaf,0x31,0xcd,0x31,0xe3,0x31,
-0xf2,0x31,0x12,0x32,0x50,0x32,0xb6,0x32,0xb9,0x32,0xd4,0x32,0xec,0x32,0xde,0x33,
-0x68,0x34,0x81,0x34,0x98,0x34,0xc1,0x34,0xca,0x34,0xf3,0x34,0xf6,0x34,0x1f,0x35,
-0x53,0x35,0x80,0x35,0x05,0x36,0x09,0x36,0x11,0x36,0x1a,0x36,0x30,0x36,0x3b,0x36,
-0x3c,0x36,0x3d,0x36,0x72,0x36,0xb1,0x36,0x4d,0x37,0x2d,0x38,0x86,0x38,0x93,0x38,
-0xdc,0x38,0x2a,0x39,0x70,0x39,0x73,0x3a,0x74,0x3a,0x9c,0x3a,0xdf,0x3a,0xe5,0x3a,
-0x28,0x3b,0x71,0x3b,0xe6,0x3b,0xf3,0x3b,0x99,0x3c,0x2c,0x3d,0x3a,0x3d,0xa1,0x3d,
-0xa7,0x3d,0x25,0x3e,0x81,0x3e,0x32,0x40,0xc7,0x41,0x98,0x42,0x0f,0x43,0x17,0x43,
-0x30,0x44,0x39,0x44,0x4c,0x44,0x7b,0x44,0x8c,0x45,0x51,0x46,0xcb,0x47,0x4b,0x48,
-0xe3,0x48,0x01,0x49,0x0c,0x49,0x8b,0x49,0x92,0x49,0x00,0x4a,0x3d,0x4a,0x65,0x4a,
-0xa8,0x4a,0xb2,0x4a,0xd5,0x4a,0xcf,0x4b,0x31,0x4c,0x33,0x4c,0x41,0x4c,0x53,0x4c,
-0x5d,0x4c,0x82,0x4c,0xaa,0x4c,0xab,0x4c,0xdb,0x4c,0xe2,0x4c,0xeb,0x4c,0xf9,0x4c,
-0x7f,0x4e,0x83,0x4e,0x14,0x4f,0x16,0x4f,0xdd,0x4f,0x0e,0x50,0xfb,0x50,0x80,0x51,
-0x83,0x51,0x46,0x54,0x5d,0x57,0x6e,0x57,0x79,0x57,0x81,0x57,0xd6,0x57,0x0e,0x58,
-0x18,0x58,0x92,0x58,0x9c,0x58,0xa0,0x58,0xa7,0x58,0xf4,0x58,0x11,0x59,0x19,0x59,
-0x29,0x59,0x3e,0x59,0x4d,0x59,0x83,0x59,0x84,0x59,0x9e,0x59,0xaf,0x59,0xbd,0x59,
-0xbe,0x59,0xe7,0x59,0x69,0x5a,0x77,0x5a,0xcc,0x5b,0xcd,0x5b,0x75,0x5c,0x88,0x5c,
-0x96,0x5c,0xee,0x5c,0x09,0x5e,0x14,0x5e,0x2e,0x5e,0xcd,0x5e,0x0e,0x5f,0x12,0x5f,
-0x2b,0x5f,0x30,0x5f,0x56,0x5f,0x5f,0x5f,0x7a,0x5f,0x89,0x5f,0xf9,0x5f,0xe0,0x60,
-0x43,0x62,0x88,0x64,0x9c,0x64,0xa4,0x64,0x75,0x65,0xd7,0x65,0xf3,0x65,0x0c,0x66,
-0x63,0x66,0x6f,0x66,0x73,0x66,0xe4,0x66,0x04,0x67,0x17,0x67,0x5d,0x67,0xec,0x67,
-0xe9,0x69,0x12,0xbf,0x19,0xbf,0x1c,0xbf,0x1d,0xbf,0x1e,0xbf,0x22,0xbf,0x24,0xbf,
-0x26,0xbf,0x2a,0xbf,0x2d,0xbf,0x32,0xbf,0x37,0xbf,0x38,0xbf,0x39,0xbf,0x4f,0xbf,
-0x54,0xbf,0x59,0xbf,0x5c,0xbf,0x5d,0xbf,0x5e,0xbf,0x62,0xbf,0x63,0xbf,0x64,0xbf,
-0x65,0xbf,0x78,0xbf,0x79,0xbf,0x7f,0xbf,0x81,0xbf,0x82,0xbf,0x85,0xbf,0x88,0xbf,
-0x89,0xbf,0x8a,0xbf,0x8c,0xbf,0xa4,0xbf,0xa6,0xbf,0xd5,0xbf,0xd6,0xbf,0xd8,0xbf,
-0xda,0xbf,0xf1,0xbf,0xf8,0xbf,0xfb,0xbf,0x04,0xc0,0x2d,0xc0,0x35,0xc0,0x6c,0xc0,
-0xfc,0xc0,0x51,0xc1,0x52,0xc1,0x53,0xc1,0x54,0xc1,0x55,0xc1,0x98,0xc1,0xa4,0xc1,
-0xfe,0xc1,0x15,0xc2,0x6b,0xc4,0xd3,0xc6,0xb3,0xc7,0xe4,0xe4,0xe4,0xe3,0xe3,0xd3,
-0x82,0x30,0xd4,0x2c,0x67,0x2b,0x66,0x29,0x65,0x01,0x00,0x00,0x09,0x50,0xe0,0x00,
-0x0d,0x13,0xa0,0x0a,0xef,0xef,0xec,0x00,0x3a,0x0a,0x40,0x00,0x77,0x0d,0x00,0x3d,
-0xfe,0xdf,0xd4,0x00,0xd1,0x3a,0x00,0x00,0xe0,0x68,0x00,0x02,0xc0,0x95,0x00,0x00,
-0x0a,0x40,0x00,0x05,0xda,0x20,0x08,0xd7,0xae,0x10,0xe4,0x00,0xc6,0x0d,0x70,0x03,
-0x20,0x5f,0xa4,0x00,0x00,0x28,0xeb,0x00,0x00,0x01,0xd7,0x3f,0x00,0x09,0x80,0xd9,
-0x46,0xf4,0x01,0x9f,0xb4,0x00,0x00,0xc2,0x00,0x0a,0xcb,0x00,0x00,0x04,0xa0,0x86,
-0x09,0x10,0x4a,0x08,0x64,0x90,0x00,0x8c,0xa1,0xc0,0x00,0x00,0x00,0xa4,0x00,0x00,
-0x00,0x4a,0x3b,0xb4,0x00,0x1c,0x1c,0x21,0xd0,0x09,0x50,0xc2,0x0d,0x00,0x00,0x04,
-0xcc,0x50,0x00,0xbf,0xd4,0x00,0x00,0x7c,0x06,0xd0,0x00,0x08,0xb0,0x7b,0x00,0x00,
-0x1e,0xbc,0x10,0x00,0x03,0xef,0x40,0x22,0x01,0xf4,0x4e,0x2a,0x60,0x5d,0x00,0x7d,
-0xe2,0x01,0xf3,0x01,0xee,0x00,0x04,0xcd,0xd8,0xc9,0x00,0x59,0x58,0x58,0x00,0x00,
-0x02,0x00,0x02,0xd1,0x00,0xd3,0x00,0x6b,0x00,0x0c,0x60,0x00,0xf2,0x00,0x1f,0x00,
-0x02,0xf0,0x00,0x1f,0x20,0x00,0xe3,0x00,0x09,0x80,0x00,0x2d,0x17,0x16,0xf0,0x0e,
-0x00,0xa1,0x20,0x00,0x88,0x00,0x0c,0x40,0x05,0xd0,0x00,0xe3,0x00,0xb6,0x00,0x98,
-0x00,0x99,0x00,0xa8,0x00,0xc5,0x01,0xf1,0x07,0x90,0x2d,0x10,0x83,0x82,0x00,0xf2,
-0x12,0x42,0xa4,0x31,0x6d,0xfe,0xc3,0x04,0xdc,0x00,0x0e,0x2a,0x70,0x01,0x01,0x10,
-0x00,0x0a,0x20,0x00,0x00,0xe4,0x00,0x00,0x0e,0x40,0x07,0xff,0xff,0xfc,0x12,0x2e,
-0x52,0x10,0x0e,0x00,0xf0,0x30,0x00,0x3f,0x4d,0x96,0x00,0xbf,0xf5,0x04,0x00,0xe3,
-0x00,0x03,0xc0,0x00,0x96,0x00,0x0e,0x00,0x06,0xa0,0x00,0xc3,0x00,0x2d,0x00,0x08,
-0x70,0x00,0xe1,0x00,0x5b,0x00,0x0b,0x50,0x00,0x02,0xcf,0xd5,0x00,0xc8,0x04,0xf2,
-0x2f,0x00,0x0b,0x63,0xe0,0x00,0xa8,0x4e,0x00,0x09,0x93,0xe0,0x00,0xa8,0x2f,0x00,
-0x0b,0x60,0xc8,0x03,0xf1,0x1c,0x00,0x77,0x04,0xa9,0xdc,0xca,0x10,0x8a,0x00,0x02,
-0x00,0xf0,0x19,0x04,0xcf,0xd6,0x01,0xf5,0x04,0xf3,0x4a,0x00,0x0d,0x50,0x00,0x01,
-0xf1,0x00,0x00,0xc7,0x00,0x00,0xba,0x00,0x00,0xaa,0x00,0x00,0x9b,0x00,0x00,0x3f,
-0xff,0xff,0xc0,0x04,0xcf,0xd4,0x01,0xf5,0x04,0xf1,0x26,0x80,0x00,0xf0,0x25,0x05,
-0xe1,0x00,0x8f,0xf5,0x00,0x00,0x04,0xf3,0x25,0x00,0x0c,0x62,0xf3,0x03,0xf3,0x05,
-0xdf,0xd5,0x00,0x00,0x00,0xdb,0x00,0x00,0x08,0xfb,0x00,0x00,0x3e,0x8b,0x00,0x00,
-0xc5,0x7b,0x00,0x07,0xa0,0x7b,0x00,0x2e,0x10,0x7b,0x00,0x9f,0xff,0xff,0xf0,0x00,
-0x00,0x7b,0x00,0x04,0x00,0xf1,0x50,0x04,0xff,0xff,0x80,0x6c,0x11,0x10,0x07,0x90,
-0x00,0x00,0x9d,0xdd,0x70,0x05,0x72,0x4e,0x60,0x00,0x00,0x7b,0x07,0x10,0x07,0xb0,
-0xb9,0x01,0xd6,0x01,0xae,0xe8,0x00,0x00,0x3b,0xf5,0x00,0x3f,0x71,0x00,0x0b,0x70,
-0x00,0x00,0xf9,0xee,0x70,0x2f,0x90,0x3e,0x52,0xf0,0x00,0x99,0x0f,0x20,0x08,0x90,
-0xab,0x02,0xe4,0x00,0xae,0xe6,0x00,0x7f,0xff,0xff,0xb0,0x00,0x00,0xc5,0x00,0x00,
-0x3d,0x00,0x00,0x0b,0x60,0x00,0x03,0xe0,0x00,0x00,0xa8,0x00,0x00,0x2f,0x10,0x00,
-0x09,0x90,0x00,0x01,0xf2,0x00,0xf6,0x00,0xf1,0x30,0xd8,0x04,0xf2,0x0f,0x20,0x0d,
-0x50,0xc8,0x04,0xe1,0x02,0xff,0xf6,0x00,0xe6,0x03,0xe3,0x3e,0x00,0x0a,0x81,0xf5,
-0x02,0xe5,0x04,0xcf,0xe7,0x00,0x03,0xcf,0xc2,0x00,0xe6,0x07,0xe0,0x4e,0x00,0x0d,
-0x44,0xd0,0x00,0xb6,0x1f,0x60,0x5f,0x60,0x4d,0xf9,0xd5,0x00,0x00,0x1f,0x10,0x00,
-0x3c,0x90,0x01,0xfd,0x70,0x00,0x0e,0x30,0x50,0xe8,0x17,0x51,0x40,0x1e,0x30,0x2e,
-0x10,0x0b,0x00,0xf0,0x11,0x01,0x90,0x2f,0x06,0xb0,0x41,0x00,0x00,0x00,0x68,0x01,
-0x8e,0xc4,0x6e,0x92,0x00,0x4d,0xc5,0x00,0x00,0x4c,0xe6,0x00,0x00,0x36,0x0e,0xee,
-0xee,0x30,0x11,0x11,0x10,0x24,0x00,0xf0,0x33,0xee,0xee,0xe3,0x01,0x11,0x11,0x00,
-0x2a,0x30,0x00,0x00,0x7d,0xc5,0x00,0x00,0x04,0xae,0x20,0x02,0x8e,0xa1,0x1b,0xf9,
-0x20,0x01,0x71,0x00,0x00,0x08,0xee,0xa0,0x5e,0x21,0xd7,0x12,0x00,0x99,0x00,0x02,
-0xe4,0x00,0x1e,0x70,0x00,0x9a,0x00,0x00,0x43,0x00,0x00,0x21,0x00,0x00,0xa7,0x00,
-0x00,0x03,0xbd,0xdc,0x70,0x00,0x00,0x6b,0x20,0x00,0x7b,0xc7,0x01,0xf1,0x1a,0x00,
-0x07,0x60,0x0a,0x30,0x2b,0xd9,0x00,0xb0,0x0e,0x00,0xd4,0x0e,0x00,0xc0,0x2b,0x04,
-0xb0,0x0e,0x00,0xc0,0x3a,0x07,0x80,0x1c,0x00,0xc0,0x2b,0x06,0x90,0x6c,0x04,0x90,
-0x0e,0x01,0xcb,0x5b,0xca,0x10,0x09,0x60,0x97,0x00,0xf0,0x21,0xd6,0x00,0x02,0x00,
-0x00,0x00,0x18,0xcc,0xda,0x00,0x00,0x00,0x07,0xf0,0x00,0x00,0x00,0xdc,0x50,0x00,
-0x00,0x4b,0x4c,0x00,0x00,0x0a,0x50,0xd2,0x00,0x01,0xd0,0x07,0x80,0x00,0x7f,0xee,
-0xee,0x00,0x0d,0x31,0x11,0xb5,0x03,0xe0,0x00,0x06,0xb0,0xa9,0xe5,0x00,0xf0,0x21,
-0xef,0xff,0xc3,0x0e,0x40,0x18,0xe0,0xe4,0x00,0x2f,0x1e,0x40,0x09,0xc0,0xef,0xff,
-0xf4,0x0e,0x40,0x05,0xf1,0xe4,0x00,0x0e,0x5e,0x40,0x05,0xf2,0xef,0xff,0xd4,0x00,
-0x00,0x7d,0xfd,0x60,0x08,0xe4,0x04,0xe5,0x0f,0x40,0x00,0x7b,0x3f,0x00,0x00,0x00,
-0x04,0x00,0xf2,0x27,0x2f,0x00,0x00,0x00,0x0f,0x40,0x00,0x7a,0x07,0xd3,0x03,0xe5,
-0x00,0x7e,0xfd,0x60,0xef,0xfe,0x91,0x0e,0x40,0x2a,0xd0,0xe4,0x00,0x0d,0x6e,0x40,
-0x00,0x8a,0xe4,0x00,0x07,0xbe,0x40,0x00,0x9a,0xe4,0x00,0x0d,0x7e,0x40,0x2a,0xd0,
-0xef,0xfe,0x91,0x00,0xef,0xff,0xfe,0xe4,0x00,0x00,0x03,0x00,0x37,0xef,0xff,0xf4,
-0x0c,0x00,0x47,0xff,0xef,0xff,0xfc,0x0f,0x00,0x15,0xf2,0x0c,0x00,0x20,0xe4,0x00,
-0x7a,0x00,0xb0,0x70,0x07,0xd4,0x03,0xd8,0x0f,0x40,0x00,0x36,0x2f,0x10,0x7a,0x00,
-0xf8,0x07,0x7f,0xfe,0x2f,0x10,0x00,0x5e,0x0e,0x50,0x00,0x5e,0x06,0xe4,0x01,0xad,
-0x00,0x6d,0xfe,0xa2,0xe4,0x00,0x00,0xf2,0x04,0x00,0x4c,0xef,0xff,0xff,0xf2,0x14,
-0x00,0x14,0xd6,0x01,0x00,0x10,0x00,0x79,0x03,0x2a,0x01,0xf2,0x07,0x00,0xf8,0x20,
-0x55,0x00,0x1f,0x26,0xe2,0x09,0xd0,0x08,0xef,0xb2,0x00,0xe4,0x00,0x2e,0x60,0xe4,
-0x01,0xd7,0x00,0xe4,0x1d,0x90,0x00,0xe5,0xca,0x00,0x00,0xee,0xfa,0x00,0x00,0xeb,
-0x2e,0x60,0x00,0xe4,0x04,0xf3,0x00,0xe4,0x00,0x7e,0x10,0xe4,0x00,0x0a,0xb0,0xa1,
-0x00,0x08,0x03,0x00,0xf0,0x22,0xef,0xff,0xfa,0xed,0x00,0x00,0x08,0xf4,0xef,0x40,
-0x00,0x0e,0xf4,0xeb,0xa0,0x00,0x5d,0xd4,0xe5,0xf1,0x00,0xc6,0xe4,0xe4,0xa7,0x02,
-0xf0,0xe4,0xe4,0x4e,0x09,0x90,0xf4,0xe4,0x0d,0x5e,0x20,0xf4,0xe4,0x06,0xfc,0x00,
-0xf4,0xe4,0x00,0xf5,0x00,0xf4,0xea,0xad,0x00,0xf0,0x27,0x40,0x00,0xf2,0xeb,0xe1,
-0x00,0xf2,0xe4,0xba,0x00,0xf2,0xe4,0x1f,0x50,0xf2,0xe4,0x06,0xe1,0xf2,0xe4,0x00,
-0xba,0xf2,0xe4,0x00,0x1f,0xf2,0xe4,0x00,0x06,0xf2,0x00,0x6d,0xfd,0x60,0x00,0x7e,
-0x41,0x5e,0x60,0x0f,0x50,0x00,0x6e,0x02,0xf0,0x00,0x01,0xf1,0x3f,0x00,0x00,0x0f,
-0x22,0x09,0x00,0x91,0x0f,0x50,0x00,0x5e,0x00,0x7e,0x41,0x4e,0x60,0x24,0x00,0xf3,
-0x04,0xef,0xff,0xd7,0x0e,0x40,0x03,0xe6,0xe4,0x00,0x08,0xae,0x40,0x02,0xd7,0xef,
-0xff,0xd8,0x0e,0x40,0x23,0x04,0x01,0x49,0x01,0x00,0x4a,0x01,0xf0,0x05,0x50,0x00,
-0x8e,0x41,0x5f,0x50,0x0f,0x40,0x00,0x7d,0x03,0xf0,0x00,0x02,0xf0,0x4e,0x00,0x00,
-0x1f,0x13,0x09,0x00,0xc0,0x0f,0x40,0x00,0x6d,0x00,0x8d,0x41,0x5e,0x50,0x00,0x7d,
-0xff,0xf1,0x04,0x10,0x1c,0x05,0x00,0xf0,0x21,0x03,0x00,0xff,0xff,0xc4,0x0f,0x40,
-0x06,0xf2,0xf4,0x00,0x0e,0x5f,0x40,0x06,0xf2,0xff,0xff,0xe3,0x0f,0x40,0x4e,0x00,
-0xf4,0x00,0xc8,0x0f,0x40,0x04,0xf1,0xf4,0x00,0x0c,0x80,0x02,0xbf,0xfa,0x10,0x0e,
-0x81,0x19,0xd0,0x2f,0x10,0x00,0xb1,0x0c,0xb3,0x62,0x00,0xf1,0x07,0xe8,0x00,0x00,
-0x00,0x2b,0xd0,0x48,0x00,0x00,0xf2,0x2f,0x60,0x07,0xf0,0x03,0xbf,0xfb,0x30,0xbf,
-0xff,0xff,0xf7,0xb6,0x03,0x0f,0x04,0x00,0x07,0x00,0x65,0x03,0x1f,0xa9,0x04,0x00,
-0x01,0xf0,0x1b,0x0f,0x20,0x00,0xb7,0x0b,0xb2,0x05,0xf2,0x01,0x9e,0xfc,0x40,0xaa,
-0x00,0x00,0x6e,0x04,0xf0,0x00,0x0c,0x80,0x0d,0x50,0x01,0xf2,0x00,0x8b,0x00,0x7c,
-0x00,0x01,0xf1,0x0c,0x60,0x00,0x0b,0x62,0xf0,0x00,0x00,0x5b,0x7a,0x6b,0x03,0x50,
-0x30,0x00,0x00,0x09,0xd0,0x4b,0x04,0x20,0x0d,0x70,0x24,0x01,0xf5,0x5e,0x1f,0xc0,
-0x05,0xe0,0x0f,0x30,0x6b,0xf1,0x08,0xa0,0x0b,0x60,0xb6,0xb5,0x0c,0x60,0x07,0xa0,
-0xf1,0x6a,0x0f,0x20,0x03,0xe4,0xc0,0x1e,0x4e,0x00,0x00,0xfa,0x70,0x0d,0xaa,0x00,
-0x00,0xcf,0x20,0x08,0xf6,0x00,0x00,0x8e,0x00,0x03,0xf2,0x00,0x3f,0x30,0x01,0xe6,
-0x09,0xc0,0x0a,0xb0,0x00,0xe6,0x4f,0x20,0x00,0x4f,0xd7,0x00,0x00,0x0c,0xf0,0x00,
-0x00,0x5f,0xd7,0x00,0x01,0xe6,0x4f,0x20,0x0a,0xc0,0x09,0xc0,0x4f,0x20,0x01,0xe7,
-0xab,0x00,0x00,0xe6,0x1f,0x40,0x07,0xd0,0x07,0xc0,0x1e,0x40,0x00,0xe4,0x8b,0x00,
-0x00,0x5d,0xe2,0x00,0x00,0x0d,0x90,0x00,0x00,0x0b,0x80,0x04,0x00,0xf0,0x08,0x6f,
-0xff,0xff,0xf1,0x00,0x00,0x0b,0xa0,0x00,0x00,0x7d,0x00,0x00,0x03,0xf3,0x00,0x00,
-0x0d,0x70,0x00,0x00,0x9c,0x00,0x17,0x05,0x40,0x00,0x1e,0x50,0x00,0xa7,0x04,0x5f,
-0xf4,0x1f,0xf4,0x1f,0x10,0x02,0x00,0x02,0xf0,0x00,0xf4,0x89,0x00,0x00,0x2e,0x00,
-0x00,0x0c,0x50,0x00,0x06,0xb0,0x00,0x00,0xf1,0x0a,0x04,0x00,0xcf,0x04,0xca,0x0d,
-0x40,0x00,0x07,0xa0,0x00,0x01,0xf1,0xef,0x70,0xb7,0x0b,0x03,0x00,0xf1,0x22,0xef,
-0x70,0x00,0x61,0x00,0x2f,0x80,0x08,0x9e,0x00,0xe1,0xa5,0x6b,0x04,0xc0,0xef,0xff,
-0xfc,0x4f,0x20,0x06,0xb0,0x02,0xcf,0xd4,0x00,0xf5,0x06,0xf0,0x02,0x00,0x1f,0x10,
-0x4b,0xdd,0xf2,0x2f,0x30,0x1f,0x23,0xf3,0x17,0xf2,0x08,0xee,0x7d,0x30,0x1f,0x10,
-0xbf,0x05,0x00,0x07,0x00,0xe0,0xf8,0xee,0x70,0x1f,0x80,0x3f,0x41,0xf1,0x00,0x99,
-0x1f,0x10,0x07,0xa1,0x07,0x00,0x60,0x80,0x3f,0x41,0xf7,0xee,0x70,0x3c,0x00,0xf0,
-0x02,0xe7,0x04,0xf1,0x4e,0x00,0x05,0x26,0xc0,0x00,0x00,0x4e,0x00,0x03,0x10,0xe6,
-0x03,0xe2,0x15,0x00,0x10,0x00,0xba,0x06,0x20,0x00,0xc6,0x07,0x00,0xd0,0x3c,0xfa,
-0xd6,0x0e,0x80,0x4f,0x64,0xe0,0x00,0xc6,0x5c,0x00,0x0c,0x07,0x00,0xd0,0x0e,0x60,
-0x3f,0x60,0x3c,0xeb,0xc6,0x02,0xbf,0xd3,0x00,0xd7,0x05,0x43,0x05,0x60,0x46,0xff,
-0xff,0xf6,0x4d,0x00,0x77,0x1c,0xf6,0x05,0x91,0x02,0xbf,0xe7,0x00,0x00,0x9d,0x60,
-0x5d,0x20,0x08,0xa0,0x09,0xff,0xe1,0x08,0xa0,0x00,0x8a,0x00,0x05,0x00,0xf0,0x02,
-0x03,0xcf,0xac,0x60,0xe7,0x04,0xf6,0x4e,0x00,0x0c,0x65,0xd0,0x00,0xc6,0x4e,0x00,
-0x0c,0x0e,0x00,0xe7,0x03,0xcf,0xad,0x60,0x00,0x00,0xd5,0x0c,0x30,0x6f,0x10,0x4d,
-0xfc,0x40,0xb4,0x00,0xe6,0xf7,0xde,0x70,0x1f,0x90,0x4f,0x21,0xf1,0x00,0xe4,0x1f,
-0x10,0x0e,0x41,0x07,0x00,0x64,0x0e,0x20,0x30,0x0f,0x20,0xf2,0x03,0x00,0x6a,0x01,
-0xe1,0x00,0x40,0x01,0xf1,0x02,0x00,0x47,0x04,0xf0,0x5f,0x80,0x49,0x00,0xf7,0x09,
-0xf1,0x09,0xc0,0x1f,0x18,0xd1,0x01,0xf8,0xe1,0x00,0x1f,0xfe,0x10,0x01,0xf3,0xab,
-0x00,0x1f,0x10,0xd7,0x01,0xf1,0x03,0xf3,0x46,0x00,0x00,0x03,0x00,0xfc,0x07,0x2f,
-0x7e,0xf7,0x5e,0xfa,0x02,0xf8,0x04,0xfb,0x12,0xe5,0x2f,0x10,0x0e,0x40,0x0a,0x82,
-0xf1,0x00,0xe4,0x00,0xa8,0x0b,0x00,0x89,0x80,0x1f,0x6d,0xe7,0x01,0xf9,0x04,0xf2,
-0x94,0x00,0x00,0x07,0x00,0xf5,0x23,0x40,0x02,0xbf,0xd5,0x00,0xd8,0x03,0xe4,0x4e,
-0x00,0x08,0xa6,0xc0,0x00,0x6c,0x4e,0x00,0x08,0xb0,0xd7,0x03,0xe5,0x02,0xbf,0xd6,
-0x00,0x1f,0x8d,0xe7,0x01,0xf6,0x02,0xf4,0x1f,0x10,0x09,0x91,0xf1,0x00,0x8a,0x1f,
-0x10,0x0a,0x91,0xf7,0x03,0xf3,0x1f,0x9e,0xe7,0xa0,0x00,0x54,0x00,0x00,0x03,0xcf,
-0xbc,0x1a,0x01,0x13,0xc0,0x1a,0x01,0x54,0x03,0xf6,0x03,0xcf,0xbd,0x84,0x01,0x01,
-0x07,0x00,0xa4,0x01,0xf9,0xf3,0x1f,0x81,0x01,0xf1,0x00,0x1f,0x10,0x05,0x00,0xf2,
-0x12,0x05,0xdf,0xc3,0x00,0xf4,0x08,0xd0,0x0f,0x60,0x01,0x00,0x3b,0xeb,0x30,0x12,
-0x00,0x7e,0x03,0xf3,0x05,0xe0,0x06,0xdf,0xd4,0x00,0x05,0x30,0x0b,0x70,0xdf,0xfb,
-0x0b,0x70,0x02,0x00,0xb3,0x0a,0x90,0x04,0xeb,0x2f,0x00,0x0e,0x42,0xf0,0x00,0xe4,
-0x07,0x00,0xf0,0x63,0x1f,0x00,0x0e,0x40,0xf6,0x06,0xf4,0x05,0xee,0x9e,0x40,0x99,
-0x00,0x4e,0x04,0xe0,0x0a,0x80,0x0e,0x30,0xe2,0x00,0x89,0x4d,0x00,0x03,0xe9,0x70,
-0x00,0x0d,0xf2,0x00,0x00,0x7c,0x00,0x00,0x99,0x00,0xc7,0x00,0xd5,0x4d,0x01,0xfc,
-0x01,0xf0,0x0f,0x15,0x9e,0x15,0xc0,0x0b,0x5a,0x49,0x69,0x70,0x07,0xae,0x04,0xbd,
-0x20,0x02,0xfa,0x00,0xee,0x00,0x00,0xe5,0x00,0xa9,0x00,0x5e,0x10,0x9c,0x00,0xb9,
-0x3f,0x20,0x01,0xed,0x70,0x00,0x09,0xf0,0x00,0x02,0xfc,0x80,0x00,0xb8,0x2f,0x30,
-0x6e,0x00,0x8c,0x00,0xb9,0x00,0x6d,0x5e,0x00,0xb7,0x0f,0x40,0xf2,0x0a,0x95,0xd0,
-0x04,0xea,0x70,0x00,0xef,0x20,0x16,0x03,0xb1,0x97,0x00,0x03,0xe1,0x00,0x6e,0x60,
-0x00,0x6f,0xff,0xfd,0x1f,0x03,0x50,0x0c,0x90,0x00,0x08,0xd0,0x8f,0x03,0x30,0x01,
-0xe6,0x00,0x4b,0x03,0xf0,0x05,0x00,0x00,0x08,0x10,0x0b,0x80,0x02,0xf0,0x00,0x3e,
-0x00,0x04,0xe0,0x00,0x9b,0x00,0x9f,0x30,0x00,0x8b,0x0a,0x00,0x40,0x3e,0x00,0x02,
-0xf0,0x6e,0x03,0x36,0x08,0x10,0xe1,0x01,0x00,0xf5,0x18,0x72,0x00,0x3e,0x20,0x0a,
-0x80,0x08,0x90,0x08,0xa0,0x05,0xd1,0x00,0xcf,0x05,0xd1,0x08,0xa0,0x08,0x90,0x0a,
-0x80,0x3e,0x20,0x73,0x00,0x03,0xdc,0x20,0x0d,0x00,0xe5,0x6e,0x25,0xb0,0x1c,0x00,
-0x6f,0xe3,0xb9,0x1f,0x00,0x05,0x00,0x10,0x4f,0xca,0x07,0xf0,0x10,0x04,0xee,0x40,
-0x0c,0xff,0xff,0xfc,0x3e,0x40,0xe4,0x22,0x22,0x00,0x4e,0x3e,0x20,0x00,0x00,0x00,
-0x8d,0xe3,0x11,0x11,0x00,0x3e,0x4d,0xff,0xff,0xfb,0x3e,0x40,0x21,0x00,0x10,0x50,
-0x2c,0x00,0x10,0x60,0x5e,0x07,0x15,0x40,0x3c,0x00,0x10,0x5f,0x0b,0x00,0x20,0x4e,
-0xe4,0x05,0x00,0x11,0x3c,0x3f,0x00,0xf1,0x07,0x02,0x22,0x24,0xed,0x80,0x00,0x00,
-0x00,0x2e,0x4e,0x30,0x01,0x11,0x13,0xe0,0x4e,0x3b,0xff,0xff,0xfd,0x00,0x5e,0x7b,
-0x05,0x21,0x6f,0x40,0x3c,0x08,0x01,0x79,0x00,0x20,0x2b,0x20,0x24,0x00,0xf0,0x0d,
-0xee,0x20,0x00,0x00,0x2e,0xa0,0xae,0x20,0x00,0x1d,0xa0,0x00,0xad,0x10,0x1d,0xd4,
-0x00,0x04,0xdd,0x13,0xcc,0xf2,0x02,0xfc,0xc3,0x00,0x0f,0x20,0x5a,0x07,0x43,0xf2,
-0x02,0xf0,0x00,0x0b,0x00,0x80,0xf3,0x13,0xf0,0x00,0x00,0x0d,0xff,0xfd,0x84,0x03,
-0x20,0xff,0xfc,0x11,0x00,0x3d,0x23,0xf0,0x00,0x27,0x00,0xf0,0x0a,0x33,0xf2,0x02,
-0xf3,0x30,0x3f,0xfd,0x10,0x1d,0xff,0x30,0x6e,0x30,0x00,0x3e,0x60,0x00,0x5e,0x40,
-0x4e,0x50,0x00,0x00,0x4e,0x8e,0x76,0x00,0x26,0x3c,0x30,0xb2,0x20,0x11,0xa0,0x91,
-0x00,0x00,0xd2,0x00,0xf0,0x5c,0x0e,0xfe,0x00,0x00,0x00,0x06,0xf4,0xf6,0x00,0x00,
-0x00,0xe9,0x09,0xe0,0x00,0x00,0x7f,0x10,0x1f,0x70,0x00,0x1f,0x80,0x00,0x8f,0x10,
-0x08,0xe0,0x00,0x00,0xe8,0x01,0xfc,0x88,0x88,0x8c,0xf1,0x9f,0xff,0xff,0xff,0xff,
-0x90,0x00,0x00,0x00,0x3b,0xc5,0x00,0x00,0x02,0x1e,0x86,0xf2,0x00,0x4d,0xf7,0xf0,
-0x0d,0x50,0x4f,0x60,0x7f,0xb9,0xf1,0x0e,0x60,0x09,0xff,0xe6,0x04,0xe0,0x00,0xcf,
-0xa1,0xd4,0x5c,0x00,0x0e,0x60,0x0c,0x63,0xe0,0x01,0x20,0x00,0xe4,0x0e,0x60,0x00,
-0x00,0x6e,0x00,0x4f,0x70,0x00,0x7f,0x50,0x00,0x4d,0xfe,0xfd,0x40,0x00,0x00,0x02,
-0x42,0x3b,0x01,0x01,0x13,0x09,0xf0,0x06,0xbf,0xff,0x72,0x00,0x08,0xc1,0xdf,0xc3,
-0xf5,0x04,0x98,0x02,0xe2,0x07,0xb4,0x5d,0x00,0x01,0x00,0x1b,0x4d,0x5f,0x00,0xf0,
-0x12,0xbe,0x68,0x00,0x00,0x00,0x09,0x6a,0xd0,0x00,0x00,0x00,0xb9,0x1a,0xa0,0x00,
-0x00,0x9d,0x00,0x88,0xc4,0x25,0xb9,0x60,0x00,0x69,0xe9,0xf6,0x70,0x00,0x00,0x05,
-0x25,0x00,0xf6,0x20,0xf0,0x19,0x32,0x00,0x00,0x01,0xee,0xef,0xef,0xd5,0x00,0x0d,
-0x90,0xbc,0x10,0x5f,0x70,0x0b,0xc1,0x0b,0xd0,0x03,0xf3,0x07,0xfd,0x1a,0xc0,0x00,
-0x99,0x0b,0x7a,0xfc,0x10,0x00,0x5c,0x0b,0x60,0x61,0x00,0x00,0x5c,0x08,0xe4,0x00,
-0xf3,0x04,0x89,0x01,0xf4,0x00,0x00,0x02,0xf3,0x00,0x6f,0x60,0x00,0x5e,0x70,0x00,
-0x04,0xdf,0xef,0xd5,0x00,0x8a,0x00,0xf0,0x2a,0x0c,0xee,0xee,0xee,0x10,0x01,0xfa,
-0x66,0x6b,0xb0,0x00,0x6f,0x10,0x00,0xd5,0x00,0x0b,0xb0,0x00,0x5e,0x00,0x00,0x7e,
-0x00,0x6d,0x40,0x00,0x2d,0xf3,0x7b,0x10,0x00,0x0d,0x8b,0x3d,0xd0,0x00,0x03,0xf0,
-0xd4,0x8e,0x30,0x00,0x3f,0x15,0x10,0xf3,0x00,0x00,0xd8,0x00,0x8d,0x00,0x00,0x02,
-0xdf,0xfd,0xba,0x01,0x20,0x33,0x00,0xa8,0x00,0xf0,0x24,0xaa,0x60,0x00,0x00,0xef,
-0xfa,0x10,0xcb,0xbb,0xba,0xaa,0xbc,0x00,0x00,0x00,0x0b,0xc0,0x5f,0xff,0xd0,0xbc,
-0x00,0x22,0x21,0x0c,0xc0,0x13,0x33,0x20,0xcc,0x05,0xee,0xec,0x0c,0xb0,0x00,0x00,
-0x00,0xc9,0xcb,0xde,0xed,0xb9,0x00,0x0e,0xff,0xa0,0x00,0x00,0x56,0x63,0x38,0x00,
-0xf0,0x08,0x57,0x62,0x04,0x00,0x06,0xef,0xff,0xf1,0xad,0x47,0xfb,0x30,0x24,0x0a,
-0x39,0xfa,0x00,0x00,0x00,0xa2,0x03,0xc5,0x00,0xce,0x0b,0xf0,0x0f,0xc8,0x00,0x00,
-0xa2,0x00,0x98,0x00,0x00,0x0a,0x22,0xc6,0x00,0x00,0x00,0xa7,0xcf,0xb0,0x00,0x00,
-0x0a,0xa0,0x5f,0xc5,0x23,0x50,0x20,0x00,0x4d,0xff,0xff,0x90,0x07,0xf0,0x19,0x54,
-0x00,0x89,0x99,0x99,0x99,0x8c,0x2f,0xd1,0x11,0x2b,0xb0,0x65,0x06,0xef,0xfb,0x0b,
-0x93,0xdf,0xff,0xb0,0xfd,0x00,0x69,0xdb,0x02,0x20,0x00,0x0b,0xb0,0xeb,0x00,0x00,
-0xbb,0x0f,0xd0,0x00,0x0b,0xb0,0x76,0x09,0x00,0x81,0xe0,0x00,0x0b,0xea,0xff,0xaa,
-0xaa,0xe0,0xf2,0x01,0xf0,0x2b,0x18,0xde,0xd8,0x10,0x00,0x3e,0xad,0x6a,0xbe,0x30,
-0x1e,0x70,0xc5,0x70,0x7e,0x18,0xb0,0x0c,0x57,0x00,0xb8,0xc5,0x00,0xbd,0x60,0x05,
-0xce,0x30,0x24,0x06,0x90,0x2e,0xd4,0x4b,0xe3,0xe7,0xc7,0xd9,0xcb,0x8b,0x04,0xc6,
-0xd9,0x2f,0xa9,0x00,0x00,0xbf,0x20,0x5f,0x71,0x01,0x7e,0x50,0x00,0x3b,0xff,0xfb,
-0x37,0x02,0x10,0x20,0x8f,0x0a,0x70,0x80,0x00,0x00,0x03,0xe6,0x4b,0xb0,0x93,0x06,
-0xf2,0x22,0x0f,0x12,0x62,0x0a,0x60,0x00,0xe7,0xff,0xf4,0x6d,0x10,0x6d,0xbf,0xff,
-0xb0,0x9f,0xef,0x7a,0xff,0xfa,0x07,0xe9,0xcf,0xff,0xfe,0x23,0xe1,0x4f,0xff,0xff,
-0xe1,0x96,0x1e,0xff,0xff,0xff,0x8c,0x38,0xff,0xff,0xff,0xfb,0xcf,0xfd,0xdd,0xdd,
-0xdd,0x90,0x11,0x77,0x02,0x20,0x61,0x00,0x6b,0x03,0x11,0xd2,0x06,0x00,0xf1,0x05,
-0xe3,0x00,0x02,0x43,0x33,0x37,0xe3,0x00,0xaf,0xff,0xff,0xff,0xf4,0x03,0x66,0x66,
-0x66,0x66,0x60,0x09,0x67,0x02,0x90,0x08,0xf9,0x88,0x88,0x95,0x00,0x07,0xd1,0x00,
-0x99,0x02,0x01,0x06,0x00,0x25,0x05,0x90,0xb9,0x02,0x20,0x68,0x50,0xc1,0x01,0xf0,
-0x24,0x48,0xc9,0x10,0x00,0x00,0x8c,0xa4,0x4c,0x30,0x00,0x03,0x22,0x8b,0x20,0x00,
-0x00,0x5a,0xc5,0x10,0x00,0x06,0x86,0x97,0x30,0x00,0x1c,0xb0,0x10,0xab,0x00,0x0a,
-0xf2,0x7f,0x82,0xf9,0x00,0xaf,0x29,0xfa,0x1f,0x90,0x01,0xda,0x04,0x09,0xd1,0x00,
-0x01,0x8b,0x9a,0x81,0x76,0x02,0xfa,0x0a,0xfd,0x10,0x0d,0x63,0x36,0x9d,0x10,0xd3,
-0x00,0xb0,0xbd,0x0d,0x30,0x0a,0xc9,0xe3,0xd3,0x00,0x00,0x0d,0x3d,0x30,0x00,0x00,
-0xd3,0x09,0x00,0x91,0x40,0x00,0x00,0xd3,0xcf,0xff,0xff,0xff,0x20,0x72,0x00,0x20,
-0x03,0x53,0x06,0x00,0xf0,0x2b,0xa9,0x6a,0x90,0x00,0x00,0x06,0x70,0x00,0x8d,0xc7,
-0x00,0x0a,0x10,0x00,0x00,0x09,0x40,0x1d,0x10,0x00,0x47,0x33,0x90,0xa3,0x38,0xcf,
-0xda,0x33,0x80,0xc0,0x68,0x58,0x00,0x04,0xb0,0xb0,0x00,0x4f,0x90,0x00,0xa2,0xa1,
-0x00,0xdf,0xf3,0x00,0x83,0x2c,0x20,0x00,0x00,0x01,0xc0,0x02,0xbb,0xbb,0xbb,0xbb,
-0x3f,0x01,0x11,0x4d,0xf2,0x00,0xf0,0x1b,0xf0,0x87,0x00,0x00,0x00,0x7f,0x2f,0x40,
-0x19,0xd8,0x6e,0xae,0x30,0x0a,0xb3,0x7b,0x60,0xd4,0x01,0xf1,0x00,0x9b,0x4f,0x20,
-0x5b,0x00,0x01,0xbf,0x60,0x08,0x70,0x00,0x04,0xf0,0x00,0xa5,0x00,0x00,0x4f,0x00,
-0x0c,0x30,0x0b,0x00,0x10,0xe2,0x0b,0x00,0x02,0x01,0x00,0xe0,0x08,0xd7,0x01,0xc0,
-0xd0,0x09,0xd7,0x00,0x08,0xa1,0x1f,0xf7,0x0c,0xe3,0x01,0x01,0xf1,0x00,0xc5,0x00,
-0x00,0x05,0xae,0x82,0x00,0x00,0x09,0xf3,0x02,0x8d,0xb4,0x02,0xe7,0x68,0x0c,0xf3,
-0x09,0x02,0xff,0xff,0xf2,0x1a,0x10,0x00,0x9e,0x20,0x00,0x9e,0x10,0x00,0x71,0x1b,
-0xb6,0x08,0x30,0xb0,0x83,0x0b,0x01,0xbb,0x60,0x45,0x00,0x10,0x4b,0xbf,0x03,0xf0,
-0x21,0xac,0xec,0xdd,0xd4,0x00,0x23,0x97,0x10,0x51,0x00,0x00,0x09,0xa9,0xcf,0x70,
-0x00,0x08,0xf8,0x48,0xaa,0xc0,0x09,0xba,0x40,0xe1,0x09,0x74,0xc0,0x86,0xa7,0x00,
-0x5b,0x95,0x07,0xea,0x00,0x08,0x8a,0x73,0xcd,0x00,0x05,0xf2,0x3c,0xb6,0xb0,0x7c,
-0xd3,0x83,0x01,0x02,0x37,0x04,0x00,0x73,0x05,0x20,0x00,0x18,0x8b,0x08,0x90,0x00,
-0xd5,0x03,0xd0,0x00,0x00,0x04,0xd0,0x2e,0x3e,0x04,0x10,0x31,0x5d,0x0c,0xf2,0x01,
-0xa6,0x0e,0x20,0x06,0x00,0x07,0xa0,0xb6,0x03,0xe0,0x00,0x4a,0x04,0xe4,0xc7,0x00,
-0xe9,0x0d,0x04,0x01,0x00,0x11,0x05,0x41,0x00,0x21,0xac,0xfe,0xcb,0x01,0x31,0x13,
-0x00,0x00,0x4f,0x02,0x90,0x07,0xcc,0xde,0xff,0x20,0x00,0x23,0x21,0x3d,0x9a,0x04,
-0x20,0x3e,0x30,0x4f,0x0c,0x10,0xc3,0x46,0x05,0xf1,0x07,0x66,0xd0,0x00,0x00,0x4e,
-0x40,0x0e,0x30,0x00,0x2f,0x40,0x00,0x6f,0xdd,0xb0,0x10,0x00,0x00,0x12,0x20,0x00,
-0x0e,0xe0,0x00,0xf0,0x04,0x0e,0x34,0x41,0x91,0x00,0x8f,0xff,0xca,0x50,0x7e,0x70,
-0x00,0x0f,0x00,0x00,0x02,0x90,0x00,0x0f,0x2a,0x0d,0xf0,0x0e,0x00,0x1f,0xde,0xbd,
+0x00,0x04,0x05,0x06,0x07,0x08,0xe7,0x01,0xf8,0xff,0xff,0xd1,0x0c,0x0d,0x0e,0x0f,
+0x10,0x00,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x1d,0x00,
+0x1e,0x1f,0x00,0x20,0x21,0x22,0x23,0x24,0x25,0x00,0x26,0x27,0x28,0x29,0x2a,0x00,
+0x00,0x04,0x00,0x0d,0x00,0x11,0x1d,0x1b,0x1d,0x1c,0x1d,0x1e,0x1d,0x32,0x1d,0x3e,
+0x1d,0x68,0x1d,0x97,0x1d,0xe7,0x1d,0xe9,0x1d,0x07,0x1e,0x0c,0x1e,0x5e,0x1e,0x5f,
+0x1e,0x64,0x1e,0x6d,0x1e,0x90,0x1e,0xee,0x1e,0xf2,0x1e,0xff,0x1e,0x1e,0x1f,0x35,
+0x1f,0x60,0x1f,0x6d,0x1f,0x85,0x1f,0xaa,0x1f,0xe0,0x1f,0x54,0x20,0x56,0x20,0x59,
+0x20,0x76,0x20,0x79,0x20,0x7d,0x20,0x82,0x20,0x88,0x20,0x96,0x20,0x97,0x20,0x9e,
+0x20,0x0b,0x21,0x17,0x21,0x2e,0x21,0x36,0x21,0x3a,0x21,0x4c,0x21,0x5b,0x21,0x5e,
+0x21,0x83,0x21,0xac,0x21,0xb0,0x21,0xb1,0x21,0xca,0x21,0xe6,0x21,0x27,0x22,0x69,
+0x22,0xcc,0x22,0xe8,0x22,0x04,0x23,0x08,0x23,0x19,0x23,0x1d,0x23,0x1e,0x23,0x22,
+0x23,0x37,0x23,0x3c,0x23,0x5b,0x23,0x79,0x23,0x60,0x24,0x79,0x25,0xef,0x25,0x03,
+0x26,0x0b,0x26,0x0e,0x26,0x38,0x26,0x39,0x26,0x58,0x26,0xdc,0x26,0x42,0x27,0x68,
+0x27,0xa8,0x27,0x01,0x28,0x1a,0x28,0x27,0x28,0x2b,0x28,0x38,0x28,0x3f,0x28,0x42,
+0x28,0x79,0x28,0x69,0x2a,0x9d,0x2a,0xab,0x2a,0xb0,0x2a,0xca,0x2a,0x0f,0x2b,0x20,
+0x2b,0x22,0x2b,0xf7,0x2c,0xff,0x2c,0x49,0x2d,0x84,0x2d,0xb7,0x2d,0xb8,0x2d,0x07,
+0x2e,0x20,0x2e,0x42,0x2e,0x46,0x2e,0x48,0x2e,0x64,0x2e,0x73,0x2e,0x82,0x2e,0x96,
+0x2e,0x9d,0x2e,0xba,0x2e,0xbf,0x2e,0xd6,0x2e,0xed,0x2e,0x36,0x2f,0xd6,0x2f,0x04,
+0x30,0x20,0x30,0x5c,0x30,0x21,0x31,0x5c,0x31,0xaf,0x31,0xcd,0x31,0xe3,0x31,0xf2,
+0x31,0x12,0x32,0x50,0x32,0xb6,0x32,0xb9,0x32,0xd4,0x32,0xec,0x32,0xde,0x33,0x68,
+0x34,0x81,0x34,0x98,0x34,0xc1,0x34,0xca,0x34,0xf3,0x34,0xf6,0x34,0x1f,0x35,0x53,
+0x35,0x80,0x35,0x05,0x36,0x09,0x36,0x11,0x36,0x1a,0x36,0x30,0x36,0x3b,0x36,0x3c,
+0x36,0x3d,0x36,0x72,0x36,0xb1,0x36,0x4d,0x37,0x2d,0x38,0x86,0x38,0x93,0x38,0xdc,
+0x38,0x2a,0x39,0x70,0x39,0x73,0x3a,0x74,0x3a,0x9c,0x3a,0xdf,0x3a,0xe5,0x3a,0x28,
+0x3b,0x71,0x3b,0xe6,0x3b,0xf3,0x3b,0x99,0x3c,0x2c,0x3d,0x3a,0x3d,0xa1,0x3d,0xa7,
+0x3d,0x25,0x3e,0x81,0x3e,0x32,0x40,0xc7,0x41,0x98,0x42,0x0f,0x43,0x17,0x43,0x30,
+0x44,0x39,0x44,0x4c,0x44,0x7b,0x44,0x8c,0x45,0x51,0x46,0xcb,0x47,0x4b,0x48,0xe3,
+0x48,0x01,0x49,0x0c,0x49,0x8b,0x49,0x92,0x49,0x00,0x4a,0x3d,0x4a,0x65,0x4a,0xa8,
+0x4a,0xb2,0x4a,0xd5,0x4a,0xcf,0x4b,0x31,0x4c,0x33,0x4c,0x41,0x4c,0x53,0x4c,0x5d,
+0x4c,0x82,0x4c,0xaa,0x4c,0xab,0x4c,0xdb,0x4c,0xe2,0x4c,0xeb,0x4c,0xf9,0x4c,0x7f,
+0x4e,0x83,0x4e,0x14,0x4f,0x16,0x4f,0xdd,0x4f,0x0e,0x50,0xfb,0x50,0x80,0x51,0x83,
+0x51,0x46,0x54,0x5d,0x57,0x6e,0x57,0x79,0x57,0x81,0x57,0xd6,0x57,0x0e,0x58,0x18,
+0x58,0x92,0x58,0x9c,0x58,0xa0,0x58,0xa7,0x58,0xf4,0x58,0x11,0x59,0x19,0x59,0x29,
+0x59,0x3e,0x59,0x4d,0x59,0x83,0x59,0x84,0x59,0x9e,0x59,0xaf,0x59,0xbd,0x59,0xbe,
+0x59,0xe7,0x59,0x69,0x5a,0x77,0x5a,0xcc,0x5b,0xcd,0x5b,0x75,0x5c,0x88,0x5c,0x96,
+0x5c,0xee,0x5c,0x09,0x5e,0x14,0x5e,0x2e,0x5e,0xcd,0x5e,0x0e,0x5f,0x12,0x5f,0x2b,
+0x5f,0x30,0x5f,0x56,0x5f,0x5f,0x5f,0x7a,0x5f,0x89,0x5f,0xf9,0x5f,0xe0,0x60,0x43,
+0x62,0x88,0x64,0x9c,0x64,0xa4,0x64,0x75,0x65,0xd7,0x65,0xf3,0x65,0x0c,0x66,0x63,
+0x66,0x6f,0x66,0x73,0x66,0xe4,0x66,0x04,0x67,0x17,0x67,0x5d,0x67,0xec,0x67,0xe9,
+0x69,0x12,0xbf,0x19,0xbf,0x1c,0xbf,0x1d,0xbf,0x1e,0xbf,0x22,0xbf,0x24,0xbf,0x26,
+0xbf,0x2a,0xbf,0x2d,0xbf,0x32,0xbf,0x37,0xbf,0x38,0xbf,0x39,0xbf,0x4f,0xbf,0x54,
+0xbf,0x59,0xbf,0x5c,0xbf,0x5d,0xbf,0x5e,0xbf,0x62,0xbf,0x63,0xbf,0x64,0xbf,0x65,
+0xbf,0x78,0xbf,0x79,0xbf,0x7f,0xbf,0x81,0xbf,0x82,0xbf,0x85,0xbf,0x88,0xbf,0x89,
+0xbf,0x8a,0xbf,0x8c,0xbf,0xa4,0xbf,0xa6,0xbf,0xd5,0xbf,0xd6,0xbf,0xd8,0xbf,0xda,
+0xbf,0xf1,0xbf,0xf8,0xbf,0xfb,0xbf,0x04,0xc0,0x2d,0xc0,0x35,0xc0,0x6c,0xc0,0xfc,
+0xc0,0x51,0xc1,0x52,0xc1,0x53,0xc1,0x54,0xc1,0x55,0xc1,0x98,0xc1,0xa4,0xc1,0xfe,
+0xc1,0x15,0xc2,0x6b,0xc4,0xd3,0xc6,0xb3,0xc7,0x00,0x01,0x00,0x2f,0xfc,0x00,0x01,
+0x00,0x56,0x13,0xf5,0x08,0x00,0x17,0xf4,0x14,0x00,0xbf,0xfb,0xfa,0x00,0xfe,0xfa,
+0x00,0xf8,0x00,0x00,0x00,0x01,0x85,0x00,0x53,0x4f,0x02,0x02,0x00,0x02,0x69,0x00,
+0x52,0x2f,0xef,0x00,0x01,0x00,0x68,0x1f,0xe9,0x71,0x00,0x5d,0x03,0xd4,0x01,0xb1,
+0xfa,0x00,0xff,0x00,0x00,0xf3,0xfe,0xf7,0xf9,0x00,0xf6,0x11,0x00,0x00,0x0f,0x00,
+0x4f,0xfe,0xff,0xfb,0xfd,0xde,0x01,0x51,0x30,0xfd,0x00,0xfe,0x81,0x00,0x0f,0x01,
+0x00,0x53,0x1c,0xfd,0x0a,0x00,0x19,0xff,0x1f,0x00,0x1f,0xfe,0x79,0x00,0x46,0x13,
+0xf6,0x5e,0x00,0x00,0xee,0x00,0x3f,0xfe,0xfc,0xfe,0xe8,0x01,0x5d,0x15,0x02,0xe2,
+0x00,0x11,0xfe,0x87,0x00,0x2f,0xfe,0xfd,0x83,0x00,0x4a,0x11,0xe8,0x49,0x03,0x15,
+0xe5,0x77,0x00,0x20,0xfd,0xfe,0x73,0x00,0x01,0x7e,0x00,0x0f,0xea,0x00,0x51,0x10,
+0xfd,0x08,0x00,0x1f,0xfd,0x61,0x01,0x5a,0x1f,0xfe,0x2e,0x04,0x60,0x19,0xfa,0xd1,
+0x02,0x01,0x5c,0x02,0x10,0xfd,0x8b,0x00,0x1f,0xfc,0x4e,0x03,0x46,0x14,0xde,0x65,
+0x01,0x97,0xf9,0x00,0x00,0xe4,0xfb,0xee,0xf1,0x00,0xe8,0x92,0x06,0x2f,0xf2,0xf7,
+0xed,0x00,0x49,0x73,0xdf,0x00,0x00,0x00,0xf2,0x00,0xec,0xe9,0x00,0x41,0xfd,0x00,
+0xff,0xff,0xbd,0x03,0x1f,0x01,0x17,0x06,0x54,0x10,0xfc,0xc4,0x02,0x1f,0xfc,0xe3,
+0x01,0x5e,0x10,0xf8,0x59,0x02,0x1f,0xfb,0xe1,0x00,0x52,0x00,0x05,0x00,0x93,0xea,
+0xe8,0x00,0x00,0xf8,0xfd,0xe8,0xfe,0x02,0x70,0x07,0xdf,0xf5,0xf6,0x00,0xf5,0xf6,
+0xf8,0xf4,0x00,0xf6,0xf9,0xfa,0xf8,0xfa,0xb2,0x03,0x47,0x66,0xe9,0xfc,0x00,0x00,
+0xf8,0xff,0x11,0x00,0xa8,0xfb,0xfc,0x00,0x00,0xfb,0xfd,0x00,0x00,0xfd,0xff,0xbb,
+0x04,0x0f,0x77,0x00,0x3e,0x22,0xf4,0xfa,0xf7,0x00,0x03,0xe5,0x06,0x33,0x01,0xfd,
+0xfd,0xaa,0x04,0x1f,0x00,0xd8,0x08,0x4b,0x14,0xfb,0xb8,0x03,0x15,0x01,0x8b,0x06,
+0x02,0x94,0x05,0x0f,0xf8,0x06,0x48,0xf0,0x0a,0x02,0xfb,0xeb,0xfb,0x00,0x00,0xf6,
+0xfd,0xf6,0xfe,0x02,0xf6,0x02,0x02,0x01,0x02,0x00,0x02,0xf9,0xf9,0xfe,0xfc,0xf9,
+0xfc,0xfa,0x8d,0x06,0x3f,0xfe,0xfd,0x02,0x64,0x02,0x4a,0x2a,0x01,0xfd,0x2a,0x05,
+0x02,0xee,0x00,0x1f,0xfd,0x96,0x05,0x52,0x0f,0x99,0x05,0x57,0x1f,0xf9,0x20,0x06,
+0x63,0x0f,0x47,0x01,0x0a,0x1f,0xff,0x73,0x07,0x46,0x1f,0xff,0x22,0x0b,0x63,0x1f,
+0xff,0x94,0x00,0x63,0x1e,0x02,0x87,0x04,0x19,0x02,0xd4,0x01,0x1f,0x02,0x7b,0x0d,
+0x4a,0x0f,0x01,0x00,0x71,0x0f,0x49,0x03,0x4f,0x1f,0xf2,0x7f,0x00,0x0b,0x2f,0xfe,
+0xfe,0x32,0x0a,0x47,0x1c,0xf4,0x0e,0x07,0x11,0xfe,0xdf,0x01,0x10,0x05,0x08,0x07,
+0x0f,0x68,0x01,0xbb,0x1d,0x02,0x57,0x02,0x00,0xeb,0x0d,0x1f,0x01,0x28,0x05,0x51,
+0x1f,0xf3,0xca,0x02,0x77,0x1f,0xfe,0x77,0x00,0xcc,0x0f,0xe3,0x00,0x64,0x0f,0x6f,
+0x0a,0x18,0x1f,0xfc,0xc1,0x00,0x0c,0x1f,0xfe,0xef,0x12,0x42,0x2f,0xfa,0xfa,0x9f,
+0x0d,0x58,0x05,0x6d,0x00,0x21,0xfa,0xf6,0x0a,0x00,0x2e,0xf1,0x00,0xe9,0x10,0x1f,
+0xfa,0x1d,0x01,0x04,0x3f,0xfc,0xfc,0xfc,0x54,0x01,0x34,0x1f,0xf8,0xcb,0x01,0x6d,
+0x0f,0x01,0x00,0x44,0x2e,0xf1,0xf6,0xe7,0x00,0x0f,0x1d,0x15,0x50,0x13,0xf6,0x77,
+0x00,0x1f,0x04,0x5e,0x01,0x54,0x0f,0xca,0x02,0x0d,0x1f,0x08,0xee,0x00,0x52,0x0f,
+0x1e,0x04,0x5d,0x0a,0x5c,0x02,0x1f,0xf1,0x9e,0x04,0x64,0x1e,0xf4,0x2f,0x04,0x0f,
+0x63,0x02,0x41,0x2b,0xef,0xeb,0xca,0x02,0x02,0x75,0x08,0x1f,0xf1,0x2b,0x04,0x11,
+0x03,0xb9,0x08,0x3f,0xed,0xf1,0xed,0x41,0x03,0x1f,0x1f,0xeb,0x77,0x08,0x02,0x1f,
+0xf6,0x3c,0x00,0x12,0x03,0x07,0x00,0x2f,0xf1,0xf1,0xce,0x12,0x3a,0x0f,0x30,0x03,
+0x50,0x0f,0xc9,0x01,0x49,0x0f,0x09,0x16,0x15,0x1f,0x06,0x38,0x12,0x4f,0x0f,0x98,
+0x04,0x63,0x52,0xf6,0xfa,0xfa,0x00,0xfa,0xf9,0x06,0x00,0xd0,0x01,0x23,0xf4,0xfc,
+0x63,0x01,0x10,0xf6,0xf7,0x00,0x1f,0xfc,0xee,0x00,0x48,0x0f,0xed,0x08,0x62,0x16,
+0xf8,0xe9,0x07,0x00,0xee,0x00,0x20,0xfa,0xf8,0x08,0x00,0x3f,0xfe,0x00,0xf6,0xf7,
+0x15,0x50,0x00,0x4d,0x01,0x3f,0xfc,0x02,0x02,0x92,0x14,0x5f,0x1f,0xfa,0x36,0x0a,
+0x8a,0x0f,0x6f,0x08,0x49,0x2f,0xf1,0xf6,0x64,0x02,0x62,0x1f,0xf8,0x66,0x00,0x5c,
+0x1f,0xfa,0xd5,0x08,0x58,0x18,0xfa,0xea,0x07,0x01,0x87,0x00,0x2f,0xf8,0xfc,0x4f,
+0x02,0x5b,0x1f,0xfc,0x16,0x0c,0x58,0x0c,0xdc,0x00,0x0f,0x5a,0x10,0x5e,0x0f,0xb2,
+0x0a,0x18,0x1f,0xfc,0x46,0x0c,0x2e,0x0c,0x39,0x11,0x1e,0xfc,0x7b,0x0d,0x0f,0x9e,
+0x06,0x5e,0x0f,0xba,0x0a,0x58,0x0f,0x39,0x0b,0x53,0x2f,0xeb,0xeb,0xba,0x01,0x0c,
+0x17,0xf6,0x8d,0x00,0x18,0xf8,0x1d,0x00,0x32,0xfc,0x00,0xed,0x6d,0x03,0x10,0xfc,
+0x6d,0x0e,0x23,0xf1,0xf6,0x04,0x0a,0x2f,0xf8,0xf4,0x87,0x05,0x34,0x00,0x50,0x0a,
+0x07,0x5e,0x03,0x00,0x62,0x04,0x13,0xfc,0xb7,0x06,0x18,0xfc,0xf4,0x03,0x1f,0xfa,
+0xc3,0x06,0x18,0x1f,0xfa,0xfe,0x05,0x63,0x2f,0xf4,0xf4,0x9c,0x06,0x33,0x1f,0xfa,
+0x04,0x0d,0x24,0x0f,0x71,0x06,0x89,0x1e,0xfa,0x16,0x0c,0x0f,0xf7,0x00,0x23,0x2f,
+0xed,0xef,0x19,0x15,0x12,0x26,0xf8,0xf8,0x0a,0x02,0x05,0xaa,0x00,0x26,0xf4,0xf6,
+0x6e,0x03,0x2f,0xef,0xf8,0x6c,0x01,0x1a,0x2f,0xf1,0xef,0xdc,0x01,0x1d,0x1e,0x02,
+0xa1,0x01,0x0f,0xad,0x01,0x1f,0x2f,0xef,0xed,0xfd,0x01,0x21,0x02,0x86,0x00,0x44,
+0xf4,0xf8,0xf8,0xf8,0x75,0x0a,0x24,0xf1,0xfa,0x5d,0x05,0x0f,0x77,0x00,0x13,0x1f,
+0xef,0x61,0x03,0x0e,0x1f,0xfc,0x1c,0x00,0x07,0x05,0x05,0x01,0x2f,0xfe,0xf6,0xcb,
+0x05,0x3d,0x0f,0x71,0x08,0x42,0x2f,0xed,0xed,0x6f,0x03,0x27,0x12,0xfc,0x65,0x01,
+0x0f,0xdc,0x01,0x22,0x1f,0xf1,0xee,0x17,0x27,0x0e,0x53,0x02,0x0f,0x1b,0x0b,0x53,
+0x06,0xab,0x14,0x0f,0x51,0x15,0x50,0x05,0xaa,0x00,0x28,0xfc,0xf4,0x5b,0x05,0x1f,
+0xf6,0xe7,0x11,0x5b,0x00,0xbc,0x10,0x1f,0xfa,0xdb,0x12,0x66,0x1f,0xfc,0xce,0x17,
+0x1b,0x1f,0xfe,0xb1,0x0d,0x2e,0x1f,0xfe,0xf9,0x06,0x47,0x0f,0x19,0x06,0x0e,0x1f,
+0xfc,0x77,0x00,0x63,0x0f,0x1b,0x18,0x58,0x1f,0xfa,0x84,0x00,0x27,0x0f,0x4c,0x05,
+0x1a,0x1f,0x04,0x77,0x00,0x36,0x2f,0xf4,0xf6,0xdc,0x01,0x35,0x1f,0xfe,0xca,0x02,
+0x55,0x0f,0x62,0x15,0x29,0x1f,0xfa,0x98,0x16,0x3c,0x0f,0x53,0x02,0x33,0x1f,0xf4,
+0xed,0x0a,0x14,0x1f,0xfa,0x77,0x00,0x3b,0x1f,0xf1,0xee,0x00,0x43,0x0f,0xbc,0x0f,
+0x29,0x1f,0xfc,0xa3,0x18,0x63,0x1f,0xf6,0xda,0x12,0x51,0x1f,0xfc,0x02,0x13,0x57,
+0x12,0xfc,0xe5,0x0d,0x1f,0xfa,0x80,0x00,0x13,0x1f,0xfc,0xe5,0x00,0x4f,0x1f,0x06,
+0xc5,0x0c,0x63,0x1f,0x06,0x78,0x00,0x05,0x1f,0x0a,0xd2,0x01,0x7f,0x0f,0x7b,0x0d,
+0x17,0x1f,0xfc,0x23,0x22,0x14,0x1e,0xfa,0x2f,0x06,0x0f,0x2f,0x04,0x29,0x0f,0x19,
+0x03,0x44,0x0f,0x77,0x00,0x39,0x0f,0x2c,0x0f,0x46,0x2f,0x04,0x04,0x1a,0x19,0x36,
+0x0f,0x74,0x17,0xa2,0x09,0xa2,0x0b,0x0f,0x41,0x13,0x17,0x2f,0xef,0xef,0xb1,0x01,
+0x27,0x17,0xef,0x21,0x12,0x0f,0xf2,0x11,0x1c,0x1f,0xfc,0x26,0x02,0x3c,0x1f,0xfc,
+0x7b,0x0d,0x40,0x0b,0xd9,0x21,0x4f,0xfc,0xfe,0xfe,0xfe,0x82,0x0a,0x24,0x2f,0xf4,
+0xf8,0xe0,0x23,0x88,0x1f,0xfa,0x3f,0x01,0x0e,0x1f,0xfc,0xe9,0x12,0x63,0x0f,0x8d,
+0x0c,0x3c,0x1f,0xfa,0xf4,0x03,0x09,0x1e,0xfe,0x95,0x0f,0x0f,0x04,0x0d,0x42,0x19,
+0xfc,0x38,0x10,0x17,0xf6,0xd1,0x0f,0x2f,0xfc,0xfa,0x69,0x0e,0x2b,0x2e,0xf4,0xf4,
+0xa1,0x06,0x05,0xc8,0x02,0x28,0xf6,0xf6,0x52,0x01,0x44,0xf4,0xfc,0xfe,0xfe,0x2f,
+0x04,0x26,0xfa,0xf8,0x32,0x04,0x03,0xa2,0x31,0x21,0x02,0x03,0x91,0x06,0x2e,0x04,
+0x05,0xad,0x07,0x03,0xbc,0x3b,0x00,0xbd,0x3b,0x92,0x0c,0x0c,0x09,0x10,0x11,0x12,
+0x00,0x13,0x0d,0xc1,0x3b,0x01,0x20,0x00,0xff,0x0c,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,
+0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,
+0x25,0x26,0x24,0x27,0x28,0xcb,0x00,0x08,0xf0,0x4e,0x29,0x2a,0x2b,0x00,0x2c,0x2d,
+0x2e,0x2f,0x30,0x31,0x32,0x00,0x33,0x00,0x34,0x35,0x00,0x00,0x36,0x37,0x38,0x39,
+0x3a,0x3b,0x3c,0x00,0x3d,0x3e,0x3f,0x40,0x41,0x42,0x00,0x00,0x00,0x43,0x44,0x45,
+0x46,0x47,0x48,0x00,0x49,0x31,0x4a,0x00,0x4b,0x4c,0x00,0x00,0x31,0x4d,0x4e,0x4e,
+0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x00,0x5a,0x5b,0x5c,0x5d,
+0x5e,0x5f,0x60,0x61,0x62,0x63,0x64,0x2d,0x65,0x66,0x00,0x67,0x68,0x69,0x6a,0x6a,
+0x6b,0x00,0x6c,0x6d,0x6e,0x00,0x6f,0x61,0x00,0xff,0x05,0x70,0x00,0x71,0x00,0x00,
+0x2d,0x72,0x73,0x00,0x00,0x00,0x74,0x75,0x76,0x77,0x00,0x78,0x79,0x7a,0x00,0x01,
+0x00,0xff,0x48,0x02,0x46,0x02,0x20,0x03,0x02,0x41,0x02,0x4b,0x06,0x07,0x06,0x08,
+0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,
+0x00,0x20,0x0b,0x00,0x0c,0x3e,0x00,0x0b,0x3e,0xd1,0x00,0x00,0x15,0x00,0x00,0x00,
+0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,
+0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,0x00,0x02,0xf1,
+0x03,0x24,0x00,0x25,0x26,0x27,0x28,0x00,0x29,0x00,0x2a,0x2b,0x2c,0x2d,0x00,0x2a,
+0x2a,0x00,0x00,0x4e,0x02,0x30,0x33,0x34,0x35,0x4a,0x02,0xf3,0x01,0x00,0x3a,0x3b,
+0x3c,0x3c,0x3d,0x3e,0x00,0x00,0x3f,0x00,0x00,0x40,0x41,0x00,0x42,0x4e,0x02,0x91,
+0x49,0x4a,0x00,0x4b,0x4b,0x00,0x4c,0x4d,0x00,0x4b,0x02,0x00,0x4c,0x02,0x01,0x4d,
+0x02,0x22,0x55,0x43,0x4e,0x02,0x11,0x55,0x4f,0x02,0x40,0x00,0x00,0x65,0x66,0x4f,
+0x02,0x41,0x00,0x00,0x00,0x6b,0x50,0x02,0xdf,0x70,0x71,0x72,0x00,0x00,0x73,0x00,
+0x74,0x75,0x00,0x00,0x76,0x77,0x40,0x02,0xff,0x43,0x50,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const uint8_t lz4BitmapData[] ={
+0xf0,0xe4,0xe4,0xe4,0xe4,0xe3,0xe3,0xd3,0x82,0x30,0xd4,0x2c,0x67,0x2b,0x66,0x29,
+0x65,0x01,0x00,0x00,0x09,0x50,0xe0,0x00,0x0d,0x13,0xa0,0x0a,0xef,0xef,0xec,0x00,
+0x3a,0x0a,0x40,0x00,0x77,0x0d,0x00,0x3d,0xfe,0xdf,0xd4,0x00,0xd1,0x3a,0x00,0x00,
+0xe0,0x68,0x00,0x02,0xc0,0x95,0x00,0x00,0x0a,0x40,0x00,0x05,0xda,0x20,0x08,0xd7,
+0xae,0x10,0xe4,0x00,0xc6,0x0d,0x70,0x03,0x20,0x5f,0xa4,0x00,0x00,0x28,0xeb,0x00,
+0x00,0x01,0xd7,0x3f,0x00,0x09,0x80,0xd9,0x46,0xf4,0x01,0x9f,0xb4,0x00,0x00,0xc2,
+0x00,0x0a,0xcb,0x00,0x00,0x04,0xa0,0x86,0x09,0x10,0x4a,0x08,0x64,0x90,0x00,0x8c,
+0xa1,0xc0,0x00,0x00,0x00,0xa4,0x00,0x00,0x00,0x4a,0x3b,0xb4,0x00,0x1c,0x1c,0x21,
+0xd0,0x09,0x50,0xc2,0x0d,0x00,0x00,0x04,0xcc,0x50,0x00,0xbf,0xd4,0x00,0x00,0x7c,
+0x06,0xd0,0x00,0x08,0xb0,0x7b,0x00,0x00,0x1e,0xbc,0x10,0x00,0x03,0xef,0x40,0x22,
+0x01,0xf4,0x4e,0x2a,0x60,0x5d,0x00,0x7d,0xe2,0x01,0xf3,0x01,0xee,0x00,0x04,0xcd,
+0xd8,0xc9,0x00,0x59,0x58,0x58,0x00,0x00,0x02,0x00,0x02,0xd1,0x00,0xd3,0x00,0x6b,
+0x00,0x0c,0x60,0x00,0xf2,0x00,0x1f,0x00,0x02,0xf0,0x00,0x1f,0x20,0x00,0xe3,0x00,
+0x09,0x80,0x00,0x2d,0x00,0x00,0x88,0x00,0x00,0xa1,0x20,0x00,0x88,0x00,0x0c,0x40,
+0x05,0xd0,0x00,0xe3,0x00,0xb6,0x00,0x98,0x00,0x99,0x00,0xa8,0x00,0xc5,0x01,0xf1,
+0x07,0x90,0x2d,0x10,0x83,0x82,0x00,0xf2,0x12,0x42,0xa4,0x31,0x6d,0xfe,0xc3,0x04,
+0xdc,0x00,0x0e,0x2a,0x70,0x01,0x01,0x10,0x00,0x0a,0x20,0x00,0x00,0xe4,0x00,0x00,
+0x0e,0x40,0x07,0xff,0xff,0xfc,0x12,0x2e,0x52,0x10,0x0e,0x00,0xf0,0x30,0x00,0x3f,
+0x4d,0x96,0x00,0xbf,0xf5,0x04,0x00,0xe3,0x00,0x03,0xc0,0x00,0x96,0x00,0x0e,0x00,
+0x06,0xa0,0x00,0xc3,0x00,0x2d,0x00,0x08,0x70,0x00,0xe1,0x00,0x5b,0x00,0x0b,0x50,
+0x00,0x02,0xcf,0xd5,0x00,0xc8,0x04,0xf2,0x2f,0x00,0x0b,0x63,0xe0,0x00,0xa8,0x4e,
+0x00,0x09,0x93,0xe0,0x00,0xa8,0x2f,0x00,0x0b,0x60,0xc8,0x03,0xf1,0x1c,0x00,0x77,
+0x04,0xa9,0xdc,0xca,0x10,0x8a,0x00,0x02,0x00,0xf0,0x19,0x04,0xcf,0xd6,0x01,0xf5,
+0x04,0xf3,0x4a,0x00,0x0d,0x50,0x00,0x01,0xf1,0x00,0x00,0xc7,0x00,0x00,0xba,0x00,
+0x00,0xaa,0x00,0x00,0x9b,0x00,0x00,0x3f,0xff,0xff,0xc0,0x04,0xcf,0xd4,0x01,0xf5,
+0x04,0xf1,0x26,0x80,0x00,0xf0,0x25,0x05,0xe1,0x00,0x8f,0xf5,0x00,0x00,0x04,0xf3,
+0x25,0x00,0x0c,0x62,0xf3,0x03,0xf3,0x05,0xdf,0xd5,0x00,0x00,0x00,0xdb,0x00,0x00,
+0x08,0xfb,0x00,0x00,0x3e,0x8b,0x00,0x00,0xc5,0x7b,0x00,0x07,0xa0,0x7b,0x00,0x2e,
+0x10,0x7b,0x00,0x9f,0xff,0xff,0xf0,0x00,0x00,0x7b,0x00,0x04,0x00,0xf1,0x50,0x04,
+0xff,0xff,0x80,0x6c,0x11,0x10,0x07,0x90,0x00,0x00,0x9d,0xdd,0x70,0x05,0x72,0x4e,
+0x60,0x00,0x00,0x7b,0x07,0x10,0x07,0xb0,0xb9,0x01,0xd6,0x01,0xae,0xe8,0x00,0x00,
+0x3b,0xf5,0x00,0x3f,0x71,0x00,0x0b,0x70,0x00,0x00,0xf9,0xee,0x70,0x2f,0x90,0x3e,
+0x52,0xf0,0x00,0x99,0x0f,0x20,0x08,0x90,0xab,0x02,0xe4,0x00,0xae,0xe6,0x00,0x7f,
+0xff,0xff,0xb0,0x00,0x00,0xc5,0x00,0x00,0x3d,0x00,0x00,0x0b,0x60,0x00,0x03,0xe0,
+0x00,0x00,0xa8,0x00,0x00,0x2f,0x10,0x00,0x09,0x90,0x00,0x01,0xf2,0x00,0xf6,0x00,
+0xf0,0x31,0xd8,0x04,0xf2,0x0f,0x20,0x0d,0x50,0xc8,0x04,0xe1,0x02,0xff,0xf6,0x00,
+0xe6,0x03,0xe3,0x3e,0x00,0x0a,0x81,0xf5,0x02,0xe5,0x04,0xcf,0xe7,0x00,0x03,0xcf,
+0xc2,0x00,0xe6,0x07,0xe0,0x4e,0x00,0x0d,0x44,0xd0,0x00,0xb6,0x1f,0x60,0x5f,0x60,
+0x4d,0xf9,0xd5,0x00,0x00,0x1f,0x10,0x00,0x3c,0x90,0x01,0xfd,0x70,0x00,0x0e,0x30,
+0x50,0x00,0x01,0x00,0x51,0x40,0x1e,0x30,0x2e,0x10,0x0b,0x00,0xf0,0x11,0x01,0x90,
+0x2f,0x06,0xb0,0x41,0x00,0x00,0x00,0x68,0x01,0x8e,0xc4,0x6e,0x92,0x00,0x4d,0xc5,
+0x00,0x00,0x4c,0xe6,0x00,0x00,0x36,0x0e,0xee,0xee,0x30,0x11,0x11,0x10,0x24,0x00,
+0xf0,0x33,0xee,0xee,0xe3,0x01,0x11,0x11,0x00,0x2a,0x30,0x00,0x00,0x7d,0xc5,0x00,
+0x00,0x04,0xae,0x20,0x02,0x8e,0xa1,0x1b,0xf9,0x20,0x01,0x71,0x00,0x00,0x08,0xee,
+0xa0,0x5e,0x21,0xd7,0x12,0x00,0x99,0x00,0x02,0xe4,0x00,0x1e,0x70,0x00,0x9a,0x00,
+0x00,0x43,0x00,0x00,0x21,0x00,0x00,0xa7,0x00,0x00,0x03,0xbd,0xdc,0x70,0x00,0x00,
+0x6b,0x20,0x00,0x7b,0xc7,0x01,0xf1,0x1a,0x00,0x07,0x60,0x0a,0x30,0x2b,0xd9,0x00,
+0xb0,0x0e,0x00,0xd4,0x0e,0x00,0xc0,0x2b,0x04,0xb0,0x0e,0x00,0xc0,0x3a,0x07,0x80,
+0x1c,0x00,0xc0,0x2b,0x06,0x90,0x6c,0x04,0x90,0x0e,0x01,0xcb,0x5b,0xca,0x10,0x09,
+0x60,0x97,0x00,0xf0,0x21,0xd6,0x00,0x02,0x00,0x00,0x00,0x18,0xcc,0xda,0x00,0x00,
+0x00,0x07,0xf0,0x00,0x00,0x00,0xdc,0x50,0x00,0x00,0x4b,0x4c,0x00,0x00,0x0a,0x50,
+0xd2,0x00,0x01,0xd0,0x07,0x80,0x00,0x7f,0xee,0xee,0x00,0x0d,0x31,0x11,0xb5,0x03,
+0xe0,0x00,0x06,0xb0,0xa9,0xe5,0x00,0xf0,0x21,0xef,0xff,0xc3,0x0e,0x40,0x18,0xe0,
+0xe4,0x00,0x2f,0x1e,0x40,0x09,0xc0,0xef,0xff,0xf4,0x0e,0x40,0x05,0xf1,0xe4,0x00,
+0x0e,0x5e,0x40,0x05,0xf2,0xef,0xff,0xd4,0x00,0x00,0x7d,0xfd,0x60,0x08,0xe4,0x04,
+0xe5,0x0f,0x40,0x00,0x7b,0x3f,0x00,0x00,0x00,0x04,0x00,0xf2,0x27,0x2f,0x00,0x00,
+0x00,0x0f,0x40,0x00,0x7a,0x07,0xd3,0x03,0xe5,0x00,0x7e,0xfd,0x60,0xef,0xfe,0x91,
+0x0e,0x40,0x2a,0xd0,0xe4,0x00,0x0d,0x6e,0x40,0x00,0x8a,0xe4,0x00,0x07,0xbe,0x40,
+0x00,0x9a,0xe4,0x00,0x0d,0x7e,0x40,0x2a,0xd0,0xef,0xfe,0x91,0x00,0xef,0xff,0xfe,
+0xe4,0x00,0x00,0x03,0x00,0x37,0xef,0xff,0xf4,0x0c,0x00,0x47,0xff,0xef,0xff,0xfc,
+0x0f,0x00,0x15,0xf2,0x0c,0x00,0x20,0xe4,0x00,0x7a,0x00,0xb0,0x70,0x07,0xd4,0x03,
+0xd8,0x0f,0x40,0x00,0x36,0x2f,0x10,0x7a,0x00,0xf8,0x07,0x7f,0xfe,0x2f,0x10,0x00,
+0x5e,0x0e,0x50,0x00,0x5e,0x06,0xe4,0x01,0xad,0x00,0x6d,0xfe,0xa2,0xe4,0x00,0x00,
+0xf2,0x04,0x00,0x4c,0xef,0xff,0xff,0xf2,0x14,0x00,0x14,0xd6,0x01,0x00,0x10,0x00,
+0x79,0x03,0x2a,0x01,0xf2,0x07,0x00,0xf8,0x20,0x55,0x00,0x1f,0x26,0xe2,0x09,0xd0,
+0x08,0xef,0xb2,0x00,0xe4,0x00,0x2e,0x60,0xe4,0x01,0xd7,0x00,0xe4,0x1d,0x90,0x00,
+0xe5,0xca,0x00,0x00,0xee,0xfa,0x00,0x00,0xeb,0x2e,0x60,0x00,0xe4,0x04,0xf3,0x00,
+0xe4,0x00,0x7e,0x10,0xe4,0x00,0x0a,0xb0,0xa1,0x00,0x08,0x03,0x00,0xf0,0x22,0xef,
+0xff,0xfa,0xed,0x00,0x00,0x08,0xf4,0xef,0x40,0x00,0x0e,0xf4,0xeb,0xa0,0x00,0x5d,
+0xd4,0xe5,0xf1,0x00,0xc6,0xe4,0xe4,0xa7,0x02,0xf0,0xe4,0xe4,0x4e,0x09,0x90,0xf4,
+0xe4,0x0d,0x5e,0x20,0xf4,0xe4,0x06,0xfc,0x00,0xf4,0xe4,0x00,0xf5,0x00,0xf4,0xea,
+0xad,0x00,0xf0,0x27,0x40,0x00,0xf2,0xeb,0xe1,0x00,0xf2,0xe4,0xba,0x00,0xf2,0xe4,
+0x1f,0x50,0xf2,0xe4,0x06,0xe1,0xf2,0xe4,0x00,0xba,0xf2,0xe4,0x00,0x1f,0xf2,0xe4,
+0x00,0x06,0xf2,0x00,0x6d,0xfd,0x60,0x00,0x7e,0x41,0x5e,0x60,0x0f,0x50,0x00,0x6e,
+0x02,0xf0,0x00,0x01,0xf1,0x3f,0x00,0x00,0x0f,0x22,0x09,0x00,0x91,0x0f,0x50,0x00,
+0x5e,0x00,0x7e,0x41,0x4e,0x60,0x24,0x00,0xf3,0x04,0xef,0xff,0xd7,0x0e,0x40,0x03,
+0xe6,0xe4,0x00,0x08,0xae,0x40,0x02,0xd7,0xef,0xff,0xd8,0x0e,0x40,0x23,0x04,0x01,
+0x49,0x01,0x00,0x4a,0x01,0xf0,0x05,0x50,0x00,0x8e,0x41,0x5f,0x50,0x0f,0x40,0x00,
+0x7d,0x03,0xf0,0x00,0x02,0xf0,0x4e,0x00,0x00,0x1f,0x13,0x09,0x00,0xc0,0x0f,0x40,
+0x00,0x6d,0x00,0x8d,0x41,0x5e,0x50,0x00,0x7d,0xff,0xf1,0x04,0x10,0x1c,0x05,0x00,
+0xf0,0x21,0x03,0x00,0xff,0xff,0xc4,0x0f,0x40,0x06,0xf2,0xf4,0x00,0x0e,0x5f,0x40,
+0x06,0xf2,0xff,0xff,0xe3,0x0f,0x40,0x4e,0x00,0xf4,0x00,0xc8,0x0f,0x40,0x04,0xf1,
+0xf4,0x00,0x0c,0x80,0x02,0xbf,0xfa,0x10,0x0e,0x81,0x19,0xd0,0x2f,0x10,0x00,0xb1,
+0x0c,0xb3,0x62,0x00,0xf1,0x07,0xe8,0x00,0x00,0x00,0x2b,0xd0,0x48,0x00,0x00,0xf2,
+0x2f,0x60,0x07,0xf0,0x03,0xbf,0xfb,0x30,0xbf,0xff,0xff,0xf7,0xb6,0x03,0x0f,0x04,
+0x00,0x07,0x00,0x65,0x03,0x1f,0xa9,0x04,0x00,0x01,0xf0,0x1b,0x0f,0x20,0x00,0xb7,
+0x0b,0xb2,0x05,0xf2,0x01,0x9e,0xfc,0x40,0xaa,0x00,0x00,0x6e,0x04,0xf0,0x00,0x0c,
+0x80,0x0d,0x50,0x01,0xf2,0x00,0x8b,0x00,0x7c,0x00,0x01,0xf1,0x0c,0x60,0x00,0x0b,
+0x62,0xf0,0x00,0x00,0x5b,0x7a,0x6b,0x03,0x50,0x30,0x00,0x00,0x09,0xd0,0x4b,0x04,
+0x20,0x0d,0x70,0x24,0x01,0xf5,0x5e,0x1f,0xc0,0x05,0xe0,0x0f,0x30,0x6b,0xf1,0x08,
+0xa0,0x0b,0x60,0xb6,0xb5,0x0c,0x60,0x07,0xa0,0xf1,0x6a,0x0f,0x20,0x03,0xe4,0xc0,
+0x1e,0x4e,0x00,0x00,0xfa,0x70,0x0d,0xaa,0x00,0x00,0xcf,0x20,0x08,0xf6,0x00,0x00,
+0x8e,0x00,0x03,0xf2,0x00,0x3f,0x30,0x01,0xe6,0x09,0xc0,0x0a,0xb0,0x00,0xe6,0x4f,
+0x20,0x00,0x4f,0xd7,0x00,0x00,0x0c,0xf0,0x00,0x00,0x5f,0xd7,0x00,0x01,0xe6,0x4f,
+0x20,0x0a,0xc0,0x09,0xc0,0x4f,0x20,0x01,0xe7,0xab,0x00,0x00,0xe6,0x1f,0x40,0x07,
+0xd0,0x07,0xc0,0x1e,0x40,0x00,0xe4,0x8b,0x00,0x00,0x5d,0xe2,0x00,0x00,0x0d,0x90,
+0x00,0x00,0x0b,0x80,0x04,0x00,0xf0,0x08,0x6f,0xff,0xff,0xf1,0x00,0x00,0x0b,0xa0,
+0x00,0x00,0x7d,0x00,0x00,0x03,0xf3,0x00,0x00,0x0d,0x70,0x00,0x00,0x9c,0x00,0x17,
+0x05,0x40,0x00,0x1e,0x50,0x00,0xa7,0x04,0x5f,0xf4,0x1f,0xf4,0x1f,0x10,0x02,0x00,
+0x02,0xf0,0x00,0xf4,0x89,0x00,0x00,0x2e,0x00,0x00,0x0c,0x50,0x00,0x06,0xb0,0x00,
+0x00,0xf1,0x0a,0x04,0x00,0xcf,0x04,0xca,0x0d,0x40,0x00,0x07,0xa0,0x00,0x01,0xf1,
+0xef,0x70,0xb7,0x0b,0x03,0x00,0xf1,0x22,0xef,0x70,0x00,0x61,0x00,0x2f,0x80,0x08,
+0x9e,0x00,0xe1,0xa5,0x6b,0x04,0xc0,0xef,0xff,0xfc,0x4f,0x20,0x06,0xb0,0x02,0xcf,
+0xd4,0x00,0xf5,0x06,0xf0,0x02,0x00,0x1f,0x10,0x4b,0xdd,0xf2,0x2f,0x30,0x1f,0x23,
+0xf3,0x17,0xf2,0x08,0xee,0x7d,0x30,0x1f,0x10,0xbf,0x05,0x00,0x07,0x00,0xe0,0xf8,
+0xee,0x70,0x1f,0x80,0x3f,0x41,0xf1,0x00,0x99,0x1f,0x10,0x07,0xa1,0x07,0x00,0x60,
+0x80,0x3f,0x41,0xf7,0xee,0x70,0x3c,0x00,0xf0,0x02,0xe7,0x04,0xf1,0x4e,0x00,0x05,
+0x26,0xc0,0x00,0x00,0x4e,0x00,0x03,0x10,0xe6,0x03,0xe2,0x15,0x00,0x10,0x00,0xba,
+0x06,0x20,0x00,0xc6,0x07,0x00,0xd0,0x3c,0xfa,0xd6,0x0e,0x80,0x4f,0x64,0xe0,0x00,
+0xc6,0x5c,0x00,0x0c,0x07,0x00,0xd0,0x0e,0x60,0x3f,0x60,0x3c,0xeb,0xc6,0x02,0xbf,
+0xd3,0x00,0xd7,0x05,0x43,0x05,0xf6,0x0f,0x46,0xff,0xff,0xf6,0x4d,0x00,0x00,0x00,
+0xd7,0x01,0x91,0x02,0xbf,0xe7,0x00,0x00,0x9d,0x60,0x5d,0x20,0x08,0xa0,0x09,0xff,
+0xe1,0x08,0xa0,0x00,0x8a,0x00,0x05,0x00,0xf0,0x02,0x03,0xcf,0xac,0x60,0xe7,0x04,
+0xf6,0x4e,0x00,0x0c,0x65,0xd0,0x00,0xc6,0x4e,0x00,0x0c,0x0e,0x00,0xe7,0x03,0xcf,
+0xad,0x60,0x00,0x00,0xd5,0x0c,0x30,0x6f,0x10,0x4d,0xfc,0x40,0xb4,0x00,0xe6,0xf7,
+0xde,0x70,0x1f,0x90,0x4f,0x21,0xf1,0x00,0xe4,0x1f,0x10,0x0e,0x41,0x07,0x00,0x64,
+0x0e,0x20,0x30,0x0f,0x20,0xf2,0x03,0x00,0x6a,0x01,0xe1,0x00,0x40,0x01,0xf1,0x02,
+0x00,0x47,0x04,0xf0,0x5f,0x80,0x49,0x00,0xf7,0x09,0xf1,0x09,0xc0,0x1f,0x18,0xd1,
+0x01,0xf8,0xe1,0x00,0x1f,0xfe,0x10,0x01,0xf3,0xab,0x00,0x1f,0x10,0xd7,0x01,0xf1,
+0x03,0xf3,0x46,0x00,0x00,0x03,0x00,0xfc,0x07,0x2f,0x7e,0xf7,0x5e,0xfa,0x02,0xf8,
+0x04,0xfb,0x12,0xe5,0x2f,0x10,0x0e,0x40,0x0a,0x82,0xf1,0x00,0xe4,0x00,0xa8,0x0b,
+0x00,0x89,0x80,0x1f,0x6d,0xe7,0x01,0xf9,0x04,0xf2,0x94,0x00,0x00,0x07,0x00,0xf5,
+0x23,0x40,0x02,0xbf,0xd5,0x00,0xd8,0x03,0xe4,0x4e,0x00,0x08,0xa6,0xc0,0x00,0x6c,
+0x4e,0x00,0x08,0xb0,0xd7,0x03,0xe5,0x02,0xbf,0xd6,0x00,0x1f,0x8d,0xe7,0x01,0xf6,
+0x02,0xf4,0x1f,0x10,0x09,0x91,0xf1,0x00,0x8a,0x1f,0x10,0x0a,0x91,0xf7,0x03,0xf3,
+0x1f,0x9e,0xe7,0xa0,0x00,0x54,0x00,0x00,0x03,0xcf,0xbc,0x1a,0x01,0x13,0xc0,0x1a,
+0x01,0x54,0x03,0xf6,0x03,0xcf,0xbd,0x84,0x01,0x01,0x07,0x00,0xa4,0x01,0xf9,0xf3,
+0x1f,0x81,0x01,0xf1,0x00,0x1f,0x10,0x05,0x00,0xf2,0x12,0x05,0xdf,0xc3,0x00,0xf4,
+0x08,0xd0,0x0f,0x60,0x01,0x00,0x3b,0xeb,0x30,0x12,0x00,0x7e,0x03,0xf3,0x05,0xe0,
+0x06,0xdf,0xd4,0x00,0x05,0x30,0x0b,0x70,0xdf,0xfb,0x0b,0x70,0x02,0x00,0xb3,0x0a,
+0x90,0x04,0xeb,0x2f,0x00,0x0e,0x42,0xf0,0x00,0xe4,0x07,0x00,0xf0,0x63,0x1f,0x00,
+0x0e,0x40,0xf6,0x06,0xf4,0x05,0xee,0x9e,0x40,0x99,0x00,0x4e,0x04,0xe0,0x0a,0x80,
+0x0e,0x30,0xe2,0x00,0x89,0x4d,0x00,0x03,0xe9,0x70,0x00,0x0d,0xf2,0x00,0x00,0x7c,
+0x00,0x00,0x99,0x00,0xc7,0x00,0xd5,0x4d,0x01,0xfc,0x01,0xf0,0x0f,0x15,0x9e,0x15,
+0xc0,0x0b,0x5a,0x49,0x69,0x70,0x07,0xae,0x04,0xbd,0x20,0x02,0xfa,0x00,0xee,0x00,
+0x00,0xe5,0x00,0xa9,0x00,0x5e,0x10,0x9c,0x00,0xb9,0x3f,0x20,0x01,0xed,0x70,0x00,
+0x09,0xf0,0x00,0x02,0xfc,0x80,0x00,0xb8,0x2f,0x30,0x6e,0x00,0x8c,0x00,0xb9,0x00,
+0x6d,0x5e,0x00,0xb7,0x0f,0x40,0xf2,0x0a,0x95,0xd0,0x04,0xea,0x70,0x00,0xef,0x20,
+0x16,0x03,0xb1,0x97,0x00,0x03,0xe1,0x00,0x6e,0x60,0x00,0x6f,0xff,0xfd,0x1f,0x03,
+0x50,0x0c,0x90,0x00,0x08,0xd0,0x8f,0x03,0x30,0x01,0xe6,0x00,0x4b,0x03,0xf0,0x05,
+0x00,0x00,0x08,0x10,0x0b,0x80,0x02,0xf0,0x00,0x3e,0x00,0x04,0xe0,0x00,0x9b,0x00,
+0x9f,0x30,0x00,0x8b,0x0a,0x00,0x40,0x3e,0x00,0x02,0xf0,0x6e,0x03,0x36,0x08,0x10,
+0xe1,0x01,0x00,0xf3,0x19,0x72,0x00,0x3e,0x20,0x0a,0x80,0x08,0x90,0x08,0xa0,0x05,
+0xd1,0x00,0xcf,0x05,0xd1,0x08,0xa0,0x08,0x90,0x0a,0x80,0x3e,0x20,0x73,0x00,0x03,
+0xdc,0x20,0x0d,0x00,0xe5,0x6e,0x25,0xb0,0x1c,0x00,0x6f,0xe3,0x00,0x01,0x00,0x10,
+0x30,0x05,0x00,0x10,0x4f,0xca,0x07,0xf0,0x10,0x04,0xee,0x40,0x0c,0xff,0xff,0xfc,
+0x3e,0x40,0xe4,0x22,0x22,0x00,0x4e,0x3e,0x20,0x00,0x00,0x00,0x8d,0xe3,0x11,0x11,
+0x00,0x3e,0x4d,0xff,0xff,0xfb,0x3e,0x40,0x21,0x00,0x10,0x50,0x2c,0x00,0x10,0x60,
+0x5e,0x07,0x15,0x40,0x3c,0x00,0x10,0x5f,0x0b,0x00,0x20,0x4e,0xe4,0x05,0x00,0x11,
+0x3c,0x3f,0x00,0xf1,0x07,0x02,0x22,0x24,0xed,0x80,0x00,0x00,0x00,0x2e,0x4e,0x30,
+0x01,0x11,0x13,0xe0,0x4e,0x3b,0xff,0xff,0xfd,0x00,0x5e,0x7b,0x05,0x21,0x6f,0x40,
+0x3c,0x08,0x01,0x79,0x00,0x20,0x2b,0x20,0x24,0x00,0xf0,0x0d,0xee,0x20,0x00,0x00,
+0x2e,0xa0,0xae,0x20,0x00,0x1d,0xa0,0x00,0xad,0x10,0x1d,0xd4,0x00,0x04,0xdd,0x13,
+0xcc,0xf2,0x02,0xfc,0xc3,0x00,0x0f,0x20,0x5a,0x07,0x43,0xf2,0x02,0xf0,0x00,0x0b,
+0x00,0x80,0xf3,0x13,0xf0,0x00,0x00,0x0d,0xff,0xfd,0x84,0x03,0x20,0xff,0xfc,0x11,
+0x00,0x3d,0x23,0xf0,0x00,0x27,0x00,0xf0,0x0a,0x33,0xf2,0x02,0xf3,0x30,0x3f,0xfd,
+0x10,0x1d,0xff,0x30,0x6e,0x30,0x00,0x3e,0x60,0x00,0x5e,0x40,0x4e,0x50,0x00,0x00,
+0x4e,0x8e,0x76,0x00,0x35,0x3c,0x30,0x00,0x01,0x00,0x11,0xa0,0x91,0x00,0x00,0xd2,
+0x00,0xf0,0x5c,0x0e,0xfe,0x00,0x00,0x00,0x06,0xf4,0xf6,0x00,0x00,0x00,0xe9,0x09,
+0xe0,0x00,0x00,0x7f,0x10,0x1f,0x70,0x00,0x1f,0x80,0x00,0x8f,0x10,0x08,0xe0,0x00,
+0x00,0xe8,0x01,0xfc,0x88,0x88,0x8c,0xf1,0x9f,0xff,0xff,0xff,0xff,0x90,0x00,0x00,
+0x00,0x3b,0xc5,0x00,0x00,0x02,0x1e,0x86,0xf2,0x00,0x4d,0xf7,0xf0,0x0d,0x50,0x4f,
+0x60,0x7f,0xb9,0xf1,0x0e,0x60,0x09,0xff,0xe6,0x04,0xe0,0x00,0xcf,0xa1,0xd4,0x5c,
+0x00,0x0e,0x60,0x0c,0x63,0xe0,0x01,0x20,0x00,0xe4,0x0e,0x60,0x00,0x00,0x6e,0x00,
+0x4f,0x70,0x00,0x7f,0x50,0x00,0x4d,0xfe,0xfd,0x40,0x00,0x00,0x02,0x42,0x3b,0x01,
+0x01,0x13,0x09,0xf0,0x06,0xbf,0xff,0x72,0x00,0x08,0xc1,0xdf,0xc3,0xf5,0x04,0x98,
+0x02,0xe2,0x07,0xb4,0x5d,0x00,0x01,0x00,0x1b,0x4d,0x5f,0x00,0xf0,0x3e,0xbe,0x68,
+0x00,0x00,0x00,0x09,0x6a,0xd0,0x00,0x00,0x00,0xb9,0x1a,0xa0,0x00,0x00,0x9d,0x00,
+0x88,0xc4,0x25,0xb9,0x60,0x00,0x69,0xe9,0xf6,0x70,0x00,0x00,0x05,0x25,0x00,0x00,
+0x00,0x28,0x01,0x32,0x00,0x00,0x01,0xee,0xef,0xef,0xd5,0x00,0x0d,0x90,0xbc,0x10,
+0x5f,0x70,0x0b,0xc1,0x0b,0xd0,0x03,0xf3,0x07,0xfd,0x1a,0xc0,0x00,0x99,0x0b,0x7a,
+0xfc,0x10,0x00,0x5c,0x0b,0x60,0x61,0x00,0x00,0x5c,0x08,0xe4,0x00,0xf3,0x04,0x89,
+0x01,0xf4,0x00,0x00,0x02,0xf3,0x00,0x6f,0x60,0x00,0x5e,0x70,0x00,0x04,0xdf,0xef,
+0xd5,0x00,0x8a,0x00,0xf0,0x2a,0x0c,0xee,0xee,0xee,0x10,0x01,0xfa,0x66,0x6b,0xb0,
+0x00,0x6f,0x10,0x00,0xd5,0x00,0x0b,0xb0,0x00,0x5e,0x00,0x00,0x7e,0x00,0x6d,0x40,
+0x00,0x2d,0xf3,0x7b,0x10,0x00,0x0d,0x8b,0x3d,0xd0,0x00,0x03,0xf0,0xd4,0x8e,0x30,
+0x00,0x3f,0x15,0x10,0xf3,0x00,0x00,0xd8,0x00,0x8d,0x00,0x00,0x02,0xdf,0xfd,0xba,
+0x01,0x20,0x33,0x00,0xa8,0x00,0xf0,0x24,0xaa,0x60,0x00,0x00,0xef,0xfa,0x10,0xcb,
+0xbb,0xba,0xaa,0xbc,0x00,0x00,0x00,0x0b,0xc0,0x5f,0xff,0xd0,0xbc,0x00,0x22,0x21,
+0x0c,0xc0,0x13,0x33,0x20,0xcc,0x05,0xee,0xec,0x0c,0xb0,0x00,0x00,0x00,0xc9,0xcb,
+0xde,0xed,0xb9,0x00,0x0e,0xff,0xa0,0x00,0x00,0x56,0x63,0x38,0x00,0xf0,0x08,0x57,
+0x62,0x04,0x00,0x06,0xef,0xff,0xf1,0xad,0x47,0xfb,0x30,0x24,0x0a,0x39,0xfa,0x00,
+0x00,0x00,0xa2,0x03,0xc5,0x00,0xce,0x0b,0xf0,0x0f,0xc8,0x00,0x00,0xa2,0x00,0x98,
+0x00,0x00,0x0a,0x22,0xc6,0x00,0x00,0x00,0xa7,0xcf,0xb0,0x00,0x00,0x0a,0xa0,0x5f,
+0xc5,0x23,0x50,0x20,0x00,0x4d,0xff,0xff,0x90,0x07,0xf0,0x19,0x54,0x00,0x89,0x99,
+0x99,0x99,0x8c,0x2f,0xd1,0x11,0x2b,0xb0,0x65,0x06,0xef,0xfb,0x0b,0x93,0xdf,0xff,
+0xb0,0xfd,0x00,0x69,0xdb,0x02,0x20,0x00,0x0b,0xb0,0xeb,0x00,0x00,0xbb,0x0f,0xd0,
+0x00,0x0b,0xb0,0x76,0x09,0x00,0x81,0xe0,0x00,0x0b,0xea,0xff,0xaa,0xaa,0xe0,0xf2,
+0x01,0xf0,0x2b,0x18,0xde,0xd8,0x10,0x00,0x3e,0xad,0x6a,0xbe,0x30,0x1e,0x70,0xc5,
+0x70,0x7e,0x18,0xb0,0x0c,0x57,0x00,0xb8,0xc5,0x00,0xbd,0x60,0x05,0xce,0x30,0x24,
+0x06,0x90,0x2e,0xd4,0x4b,0xe3,0xe7,0xc7,0xd9,0xcb,0x8b,0x04,0xc6,0xd9,0x2f,0xa9,
+0x00,0x00,0xbf,0x20,0x5f,0x71,0x01,0x7e,0x50,0x00,0x3b,0xff,0xfb,0x37,0x02,0x10,
+0x20,0x8f,0x0a,0x70,0x80,0x00,0x00,0x03,0xe6,0x4b,0xb0,0x93,0x06,0xf2,0x22,0x0f,
+0x12,0x62,0x0a,0x60,0x00,0xe7,0xff,0xf4,0x6d,0x10,0x6d,0xbf,0xff,0xb0,0x9f,0xef,
+0x7a,0xff,0xfa,0x07,0xe9,0xcf,0xff,0xfe,0x23,0xe1,0x4f,0xff,0xff,0xe1,0x96,0x1e,
+0xff,0xff,0xff,0x8c,0x38,0xff,0xff,0xff,0xfb,0xcf,0xfd,0xdd,0xdd,0xdd,0x90,0x11,
+0x77,0x02,0x20,0x61,0x00,0x6b,0x03,0x11,0xd2,0x06,0x00,0xf1,0x05,0xe3,0x00,0x02,
+0x43,0x33,0x37,0xe3,0x00,0xaf,0xff,0xff,0xff,0xf4,0x03,0x66,0x66,0x66,0x66,0x60,
+0x09,0x67,0x02,0x90,0x08,0xf9,0x88,0x88,0x95,0x00,0x07,0xd1,0x00,0x99,0x02,0x01,
+0x06,0x00,0x25,0x05,0x90,0xb9,0x02,0x20,0x68,0x50,0xc1,0x01,0xf0,0x24,0x48,0xc9,
+0x10,0x00,0x00,0x8c,0xa4,0x4c,0x30,0x00,0x03,0x22,0x8b,0x20,0x00,0x00,0x5a,0xc5,
+0x10,0x00,0x06,0x86,0x97,0x30,0x00,0x1c,0xb0,0x10,0xab,0x00,0x0a,0xf2,0x7f,0x82,
+0xf9,0x00,0xaf,0x29,0xfa,0x1f,0x90,0x01,0xda,0x04,0x09,0xd1,0x00,0x01,0x8b,0x9a,
+0x81,0x76,0x02,0xfa,0x0a,0xfd,0x10,0x0d,0x63,0x36,0x9d,0x10,0xd3,0x00,0xb0,0xbd,
+0x0d,0x30,0x0a,0xc9,0xe3,0xd3,0x00,0x00,0x0d,0x3d,0x30,0x00,0x00,0xd3,0x09,0x00,
+0x91,0x40,0x00,0x00,0xd3,0xcf,0xff,0xff,0xff,0x20,0x72,0x00,0x20,0x03,0x53,0x06,
+0x00,0xf0,0x2b,0xa9,0x6a,0x90,0x00,0x00,0x06,0x70,0x00,0x8d,0xc7,0x00,0x0a,0x10,
+0x00,0x00,0x09,0x40,0x1d,0x10,0x00,0x47,0x33,0x90,0xa3,0x38,0xcf,0xda,0x33,0x80,
+0xc0,0x68,0x58,0x00,0x04,0xb0,0xb0,0x00,0x4f,0x90,0x00,0xa2,0xa1,0x00,0xdf,0xf3,
+0x00,0x83,0x2c,0x20,0x00,0x00,0x01,0xc0,0x02,0xbb,0xbb,0xbb,0xbb,0x3f,0x01,0x11,
+0x4d,0xf2,0x00,0xf0,0x1b,0xf0,0x87,0x00,0x00,0x00,0x7f,0x2f,0x40,0x19,0xd8,0x6e,
+0xae,0x30,0x0a,0xb3,0x7b,0x60,0xd4,0x01,0xf1,0x00,0x9b,0x4f,0x20,0x5b,0x00,0x01,
+0xbf,0x60,0x08,0x70,0x00,0x04,0xf0,0x00,0xa5,0x00,0x00,0x4f,0x00,0x0c,0x30,0x0b,
+0x00,0x10,0xe2,0x0b,0x00,0x02,0x01,0x00,0xe0,0x08,0xd7,0x01,0xc0,0xd0,0x09,0xd7,
+0x00,0x08,0xa1,0x1f,0xf7,0x0c,0xe3,0x01,0x01,0xf1,0x00,0xc5,0x00,0x00,0x05,0xae,
+0x82,0x00,0x00,0x09,0xf3,0x02,0x8d,0xb4,0x02,0xe7,0x68,0x0c,0xf3,0x09,0x02,0xff,
+0xff,0xf2,0x1a,0x10,0x00,0x9e,0x20,0x00,0x9e,0x10,0x00,0x71,0x1b,0xb6,0x08,0x30,
+0xb0,0x83,0x0b,0x01,0xbb,0x60,0x45,0x00,0x10,0x4b,0xbf,0x03,0xf0,0x21,0xac,0xec,
+0xdd,0xd4,0x00,0x23,0x97,0x10,0x51,0x00,0x00,0x09,0xa9,0xcf,0x70,0x00,0x08,0xf8,
+0x48,0xaa,0xc0,0x09,0xba,0x40,0xe1,0x09,0x74,0xc0,0x86,0xa7,0x00,0x5b,0x95,0x07,
+0xea,0x00,0x08,0x8a,0x73,0xcd,0x00,0x05,0xf2,0x3c,0xb6,0xb0,0x7c,0xd3,0x83,0x01,
+0x02,0x37,0x04,0x00,0x73,0x05,0x20,0x00,0x18,0x8b,0x08,0x90,0x00,0xd5,0x03,0xd0,
+0x00,0x00,0x04,0xd0,0x2e,0x3e,0x04,0x10,0x31,0x5d,0x0c,0xf2,0x01,0xa6,0x0e,0x20,
+0x06,0x00,0x07,0xa0,0xb6,0x03,0xe0,0x00,0x4a,0x04,0xe4,0xc7,0x00,0xe9,0x0d,0x04,
+0x01,0x00,0x11,0x05,0x41,0x00,0x21,0xac,0xfe,0xcb,0x01,0x31,0x13,0x00,0x00,0x4f,
+0x02,0x90,0x07,0xcc,0xde,0xff,0x20,0x00,0x23,0x21,0x3d,0x9a,0x04,0x20,0x3e,0x30,
+0x4f,0x0c,0x10,0xc3,0x46,0x05,0xf0,0x05,0x66,0xd0,0x00,0x00,0x4e,0x40,0x0e,0x30,
+0x00,0x2f,0x40,0x00,0x6f,0xdd,0xb0,0x10,0x00,0x00,0x12,0x20,0xf0,0x30,0x00,0x0e,
+0x10,0x00,0x00,0x00,0x00,0x0e,0x34,0x41,0x91,0x00,0x8f,0xff,0xca,0x50,0x7e,0x70,
+0x00,0x0f,0x00,0x00,0x02,0x90,0x00,0x0f,0x00,0x21,0x00,0x00,0x00,0x1f,0xde,0xbd,
 0xd3,0x00,0x07,0xcf,0x10,0x00,0x4d,0x00,0x7a,0x0e,0x00,0x00,0x1f,0x00,0xa8,0x0e,
-0x00,0x03,0xba,0x00,0x1c,0xfe,0x07,0xee,0x80,0x6b,0x00,0x10,0x10,0xc5,0x01,0x11,
-0x30,0xb2,0x03,0x00,0x9a,0x05,0x00,0x1a,0x0e,0xf1,0x20,0x76,0x00,0x67,0x8e,0xcc,
-0x91,0x2e,0x10,0x87,0x7e,0x33,0xa9,0x09,0x80,0x00,0x6a,0x00,0x4b,0x02,0xe0,0x00,
-0xb5,0x00,0x5a,0x00,0xc4,0x01,0xe0,0x00,0x69,0x00,0x00,0x08,0x80,0x00,0x97,0x00,
-0x00,0x1e,0x10,0x00,0xe3,0x00,0x00,0x79,0x07,0xef,0x7f,0x02,0x14,0x11,0xd0,0x00,
-0x10,0x10,0x4e,0x00,0x20,0x25,0xa3,0x4e,0x00,0x20,0x0c,0x38,0x4e,0x00,0x10,0x67,
-0x4e,0x00,0xe0,0xa1,0x3e,0x00,0x88,0x7f,0x33,0xa9,0x0a,0x70,0x00,0x5a,0x00,0x4b,
-0x03,0x4e,0x00,0x31,0x4b,0x00,0xc5,0x4e,0x00,0x00,0xd0,0x0e,0x07,0x4e,0x00,0x21,
-0xff,0x90,0xa2,0x0d,0x01,0x4b,0x00,0x20,0x14,0x00,0xc0,0x00,0xf0,0x06,0x24,0x60,
-0x0d,0xee,0xdf,0xfb,0x70,0x00,0x11,0x13,0xd0,0x00,0x02,0x11,0x12,0xd8,0xab,0x0c,
-0xcd,0xcb,0xbe,0x18,0x01,0xe0,0x0d,0x30,0x03,0x20,0x00,0x8b,0xb0,0x09,0x50,0x00,
-0x47,0x50,0x0b,0x50,0x4b,0x01,0x85,0xe7,0x44,0x68,0x00,0x00,0x39,0xbb,0xa9,0x5d,
-0x01,0xf0,0x05,0x22,0x00,0x43,0x90,0x00,0x00,0x6b,0x15,0x78,0x92,0x4e,0xdd,0xdf,
-0xd9,0x25,0x00,0x00,0x11,0x08,0x80,0x5e,0x00,0x81,0x03,0xe6,0xa7,0x00,0x4d,0xee,
-0xdc,0xdb,0x6f,0x06,0x11,0x3d,0x7c,0x10,0x80,0x6e,0x40,0x00,0x0e,0x00,0x02,0x8a,
-0x40,0x3d,0x01,0x00,0x5d,0x00,0x11,0x91,0x4a,0x05,0x33,0xae,0xff,0xe8,0x93,0x01,
-0xf0,0x09,0x00,0x0a,0xd0,0x00,0x00,0xbc,0x10,0x00,0x1d,0x90,0x00,0x03,0xe7,0x00,
-0x00,0x1f,0x40,0x00,0x00,0x1f,0x50,0x00,0x00,0x03,0x20,0x00,0xa0,0x2d,0xa0,0x00,
-0x00,0x01,0xcc,0x10,0x00,0x00,0x0b,0xc6,0x01,0x10,0x80,0xa2,0x02,0x30,0xd0,0x00,
-0xf0,0x5a,0x00,0xf0,0x01,0x2d,0x00,0x22,0x14,0xd4,0x63,0xb0,0x0b,0xde,0xef,0xb9,
-0x4a,0x00,0x00,0x02,0xd0,0xac,0x03,0xf0,0x00,0x2d,0x00,0x59,0x90,0x00,0x03,0xc0,
-0x04,0xd9,0x00,0x00,0x69,0x00,0x2f,0x50,0xbd,0x0a,0x91,0xf2,0x00,0x1b,0xb0,0x00,
-0x02,0x00,0x06,0x90,0xfb,0x00,0x67,0x01,0x00,0xff,0xff,0xff,0xe0,0x54,0x01,0x03,
-0x01,0x00,0x10,0x97,0x9f,0x01,0x00,0xe9,0x00,0xd0,0x8c,0x20,0x00,0x01,0x30,0x9f,
-0xed,0xef,0xfa,0x00,0x02,0x32,0x10,0xdc,0x02,0x00,0x05,0x00,0x20,0x0a,0x80,0xd9,
-0x00,0x72,0xe5,0x89,0x0e,0xff,0xfe,0xfd,0x73,0xd7,0x00,0x01,0x29,0x0b,0x91,0x00,
-0x00,0x58,0xd0,0x08,0x70,0x00,0x8a,0xb0,0x3b,0x00,0x20,0x09,0xa0,0x5f,0x01,0x81,
-0xbe,0xcc,0xdf,0x50,0x00,0x01,0x34,0x31,0xf6,0x0c,0x10,0x0d,0xfe,0x01,0x10,0xe2,
-0x43,0x02,0x00,0xd3,0x03,0x10,0xe1,0xb4,0x0e,0x00,0x50,0x00,0x00,0xbb,0x02,0x00,
-0x0c,0x01,0xf2,0x13,0x71,0xe2,0x00,0x00,0x7f,0x3a,0xb3,0x14,0xae,0x40,0x1a,0xef,
-0xc8,0x10,0x00,0x0f,0x30,0x00,0x06,0x00,0x0f,0x20,0x09,0x2b,0x30,0x0f,0x10,0x04,
-0xb2,0x70,0x0f,0x10,0x00,0x50,0x33,0x01,0x0a,0x05,0x00,0xf1,0x02,0x71,0x0f,0x10,
-0x00,0x08,0xf2,0x0b,0xa3,0x14,0xbe,0x30,0x01,0xae,0xfc,0x71,0x00,0x00,0xae,0x0b,
-0xf0,0x01,0x46,0x77,0x88,0xf9,0x88,0x80,0x46,0x55,0x44,0xf4,0x44,0x40,0x00,0x01,
-0x8a,0xf1,0xd1,0x00,0x21,0x83,0xe2,0x33,0x00,0x10,0xb6,0x8a,0x00,0x20,0x63,0xe6,
-0x8e,0x02,0x30,0xbc,0xf3,0x00,0xd0,0x00,0x10,0xb0,0x2a,0x03,0x27,0xeb,0x00,0x65,
-0x03,0xf0,0x0a,0x00,0x22,0x40,0x00,0x00,0x03,0xe0,0xb4,0xc1,0x12,0x23,0x35,0xe3,
-0x69,0x50,0xcd,0xcb,0xbb,0xfa,0xab,0x90,0x00,0x00,0x13,0xe0,0x2a,0x00,0x20,0xed,
-0xe0,0x35,0x08,0x01,0xc0,0x00,0x30,0x1e,0x12,0xf4,0xda,0x0f,0x21,0xed,0xf1,0xd1,
-0x02,0x00,0x48,0x00,0x30,0x17,0xdc,0x10,0xfd,0x00,0x01,0x96,0x10,0x50,0x07,0x20,
-0x00,0x84,0x00,0x47,0x04,0x11,0xa4,0x06,0x00,0xd1,0xa5,0x22,0x25,0x6e,0xbb,0xce,
-0xfe,0xd9,0x59,0x7d,0x63,0x10,0xb3,0x12,0x00,0x10,0xc2,0x06,0x00,0x21,0x8e,0xf0,
-0x0c,0x00,0x00,0x89,0x00,0x11,0x70,0xe9,0x04,0x94,0xee,0xde,0xff,0x40,0x00,0x00,
-0x01,0x22,0x10,0xb9,0x03,0x10,0xdd,0xf8,0x0e,0x40,0x12,0x10,0xab,0x00,0x90,0x07,
-0x00,0x86,0x01,0xd0,0xd7,0x00,0x00,0x01,0x47,0xed,0xac,0xdd,0xe7,0x5b,0x97,0x7d,
-0x51,0x7d,0x01,0x20,0x20,0x00,0xf4,0x01,0x01,0xc6,0x02,0x01,0x36,0x00,0x20,0x8e,
-0x85,0x71,0x02,0x24,0x38,0xa7,0xd1,0x01,0x11,0x6c,0x8f,0x00,0xf1,0x07,0x93,0x50,
-0x00,0x07,0xdd,0xff,0xc9,0x00,0x00,0x01,0x2f,0x10,0x12,0x21,0x00,0x02,0xd0,0x0c,
-0xdc,0xd7,0x00,0x89,0x85,0x02,0x80,0x40,0x10,0x00,0x00,0x02,0xe0,0x0a,0x50,0x5a,
-0x0a,0xa7,0xb7,0x00,0x00,0x1f,0x30,0x03,0xde,0xdf,0xb0,0x30,0x1a,0x02,0x00,0xbb,
-0x0e,0xf1,0x03,0x53,0xa0,0x00,0x00,0xf2,0x42,0x06,0x79,0x10,0xed,0xef,0xdb,0x40,
-0x04,0x00,0x01,0x28,0x90,0xa5,0x00,0x52,0xa6,0x05,0xdc,0xde,0x20,0xcb,0x01,0x31,
-0x00,0x05,0xc0,0x52,0x03,0x31,0xa7,0x02,0xd0,0x8c,0x00,0x10,0x3d,0xa4,0x05,0x72,
-0xb0,0x00,0x9f,0xde,0xf5,0x00,0x12,0x3e,0x02,0xa0,0x15,0x8b,0xb5,0x00,0x6c,0xea,
-0x53,0x4d,0x70,0x65,0x71,0x00,0x13,0x00,0x05,0x00,0x00,0x25,0x08,0x81,0x03,0xad,
-0x10,0x00,0x1d,0xfd,0x71,0x00,0x33,0x11,0x00,0x00,0x01,0xe0,0x00,0x00,0x04,0x9d,
-0xec,0xde,0x50,0x9f,0xc7,0x20,0x00,0x3e,0x44,0x20,0x46,0x08,0x01,0xa3,0x01,0x10,
-0xb0,0x06,0x00,0x10,0xb8,0x05,0x00,0xb2,0xad,0x10,0x00,0x13,0x5a,0xeb,0x10,0x00,
-0x07,0xdb,0x82,0xa4,0x00,0xb0,0x12,0x15,0x89,0xbc,0xdf,0xff,0xe5,0x78,0x64,0x27,
-0xc3,0x2a,0x05,0x01,0x11,0x01,0x15,0xc4,0x2e,0x02,0x21,0x00,0xf1,0xa9,0x02,0x01,
-0x65,0x01,0x11,0x3e,0x32,0x00,0x33,0x2a,0xfe,0x30,0x74,0x03,0x00,0x3d,0x00,0x82,
-0x00,0x67,0x9a,0xcd,0xef,0xfe,0x40,0x88,0x3e,0x00,0xe0,0x00,0x4c,0x00,0x67,0x60,
-0x00,0x00,0xc3,0x00,0x94,0x90,0x00,0x00,0xf0,0x09,0x01,0x21,0x01,0xf0,0x28,0x00,
-0x11,0xd6,0x06,0x00,0x21,0x3f,0x81,0xac,0x01,0x26,0xaf,0xe2,0xc1,0x0a,0x01,0xe9,
-0x12,0x00,0x98,0x13,0xf0,0x05,0x28,0x00,0x6c,0x01,0x9e,0x70,0x00,0xda,0xe8,0x10,
-0x00,0x1d,0xa1,0x00,0x00,0x1d,0x70,0x00,0x00,0x08,0x6e,0x04,0x10,0xb5,0x85,0x01,
-0xf6,0x01,0xd2,0x00,0x00,0x22,0x08,0xee,0xee,0xff,0x60,0x00,0x12,0x21,0x00,0x00,
-0x01,0x20,0xd4,0x00,0xa0,0x09,0x97,0x30,0x20,0x00,0x9e,0xef,0xb8,0x23,0xe9,0x7d,
-0x00,0xf0,0x02,0x00,0x1a,0xd0,0x00,0xb5,0x00,0x1d,0x00,0x20,0x03,0xe0,0x00,0x0e,
-0x00,0x00,0x0d,0x60,0xc5,0x00,0xf4,0x07,0x7c,0x01,0xbe,0xef,0x50,0x00,0x02,0x0a,
-0x70,0x0f,0xdc,0x10,0x00,0x0a,0x70,0x5f,0x09,0x60,0x00,0x02,0xae,0xe5,0xa3,0x01,
-0x11,0x96,0xe0,0x00,0xb1,0x30,0x1e,0xdd,0xde,0x20,0xe1,0x00,0x22,0x32,0x20,0x0e,
-0x48,0x01,0x01,0x06,0x01,0x11,0x2c,0xa0,0x00,0x30,0xc9,0x05,0x30,0xea,0x0a,0xf2,
-0x02,0xa4,0x00,0x00,0x01,0xf6,0x09,0xb4,0x24,0x64,0x0e,0x20,0x08,0xcd,0xdb,0x50,
-0x40,0x00,0x05,0x05,0xf5,0x24,0x30,0x00,0x00,0x03,0xdd,0xfc,0xe9,0x00,0x05,0xe3,
-0x0f,0x10,0x9b,0x02,0xe1,0x03,0xe0,0x00,0xc5,0x88,0x00,0x6a,0x00,0x07,0x9b,0x40,
-0x0a,0x60,0x00,0x5b,0xb4,0x01,0xf1,0x00,0x08,0x98,0xa0,0xa9,0x00,0x01,0xe4,0x1d,
-0xfd,0x10,0x04,0xd9,0x00,0x04,0x00,0x5e,0xd6,0x3e,0x01,0x00,0x8f,0x05,0x20,0x09,
-0x70,0xcd,0x01,0x20,0x0c,0x30,0x8a,0x02,0xf1,0x04,0x0e,0x00,0x7c,0xbc,0xfe,0xf0,
-0x0e,0x00,0x13,0x35,0xe1,0x00,0x1c,0x00,0x00,0x01,0xe0,0x00,0x3b,0x41,0x01,0xf0,
-0x08,0x3c,0xa0,0x07,0xaa,0xf1,0x00,0x2e,0xa0,0xa9,0x34,0xfe,0x60,0x1f,0x60,0xd4,
-0x03,0xf3,0xd4,0x0e,0x20,0x5e,0xdf,0x70,0xf4,0x01,0x02,0x3d,0x07,0x11,0x00,0x4a,
-0x03,0x11,0xfa,0x10,0x01,0x20,0xb2,0xd8,0x1c,0x01,0x30,0xe1,0x01,0xe6,0xc4,0x14,
-0x50,0x00,0x03,0xf5,0x00,0x00,0x0a,0x00,0x11,0xf4,0x25,0x00,0x31,0x05,0xf4,0x00,
-0x3a,0x01,0x12,0xf1,0x7a,0x01,0x25,0x00,0x00,0xd5,0x0b,0xf0,0x16,0x06,0x3b,0x40,
-0x00,0x00,0x9e,0x40,0x3c,0x2a,0x00,0x00,0x8c,0x6e,0x30,0x60,0x00,0x00,0x5e,0x10,
-0x5e,0x20,0x00,0x00,0x3f,0x40,0x00,0x7d,0x10,0x00,0x1f,0x70,0x00,0x00,0x9d,0x10,
-0x00,0x50,0x0a,0x07,0x02,0x60,0x03,0x13,0xbd,0x34,0x2c,0x00,0xeb,0x01,0x90,0x00,
-0x5c,0xbb,0xec,0xde,0x70,0x01,0x23,0xd4,0x8e,0x00,0x81,0xc3,0x12,0x30,0x9e,0xfe,
-0xff,0xec,0x80,0x19,0x00,0xf0,0x08,0x00,0x01,0xb4,0x00,0x00,0x2c,0xdc,0xfc,0x50,
-0x00,0xa7,0x00,0xa8,0xbd,0x30,0x8b,0x45,0xf3,0x05,0xb0,0x06,0xaa,0x50,0xac,0x00,
-0x20,0xbb,0xcc,0x40,0x00,0x31,0x43,0x2a,0x80,0x6e,0x01,0x11,0xe1,0x4e,0x00,0xf0,
-0x14,0x79,0x00,0x1e,0x00,0x00,0x29,0xdf,0xea,0x52,0xd0,0x00,0x3d,0x57,0xb1,0x5a,
-0xfd,0x00,0x0c,0x30,0xd3,0x00,0x09,0xed,0x10,0xe0,0x6b,0x00,0x01,0xe1,0x60,0x09,
-0xee,0x20,0x01,0xc7,0xec,0x00,0x35,0x04,0xe8,0x00,0x8d,0x07,0x10,0x6a,0xc7,0x00,
+0x00,0x03,0xba,0x00,0x1c,0xfe,0x07,0xee,0x80,0x00,0x00,0x20,0x00,0x3d,0x00,0x20,
+0x03,0x30,0x42,0x00,0x20,0x09,0x80,0x06,0x00,0xf0,0x24,0x0b,0x60,0x00,0x76,0x00,
+0x67,0x8e,0xcc,0x91,0x2e,0x10,0x87,0x7e,0x33,0xa9,0x09,0x80,0x00,0x6a,0x00,0x4b,
+0x02,0xe0,0x00,0xb5,0x00,0x5a,0x00,0xc4,0x01,0xe0,0x00,0x69,0x00,0x00,0x08,0x80,
+0x00,0x97,0x00,0x00,0x1e,0x10,0x00,0xe3,0x00,0x00,0x79,0x07,0xef,0x90,0x37,0x00,
+0x23,0x11,0x00,0x01,0x00,0x10,0x10,0x4e,0x00,0x20,0x25,0xa3,0x4e,0x00,0x20,0x0c,
+0x38,0x4e,0x00,0x10,0x67,0x4e,0x00,0xe0,0xa1,0x3e,0x00,0x88,0x7f,0x33,0xa9,0x0a,
+0x70,0x00,0x5a,0x00,0x4b,0x03,0x4e,0x00,0x31,0x4b,0x00,0xc5,0x4e,0x00,0x38,0x10,
+0x07,0x90,0x4e,0x00,0x11,0xff,0x4e,0x00,0x11,0x01,0x4b,0x00,0x20,0x14,0x00,0xc0,
+0x00,0xf4,0x25,0x24,0x60,0x0d,0xee,0xdf,0xfb,0x70,0x00,0x11,0x13,0xd0,0x00,0x02,
+0x11,0x12,0xd8,0xab,0x0c,0xcd,0xcb,0xbe,0x40,0x00,0x00,0x00,0x0d,0x30,0x03,0x20,
+0x00,0x8b,0xb0,0x09,0x50,0x00,0x47,0x50,0x0b,0x50,0x00,0x00,0x00,0x05,0xe7,0x44,
+0x68,0x00,0x00,0x39,0xbb,0xa9,0x00,0x01,0x00,0xf0,0x05,0x22,0x00,0x43,0x90,0x00,
+0x00,0x6b,0x15,0x78,0x92,0x4e,0xdd,0xdf,0xd9,0x25,0x00,0x00,0x11,0x08,0x80,0x5e,
+0x00,0x90,0x03,0xe6,0xa7,0x00,0x4d,0xee,0xdc,0xdb,0x40,0x25,0x00,0xe0,0x3d,0x00,
+0x00,0x02,0x00,0x02,0x6e,0x40,0x00,0x0e,0x00,0x02,0x8a,0x40,0x3d,0x01,0x00,0x5d,
+0x00,0x91,0x91,0x01,0x32,0x00,0x00,0x01,0xae,0xff,0xe8,0x0f,0x00,0xf0,0x0b,0x20,
+0x00,0x00,0x0a,0xd0,0x00,0x00,0xbc,0x10,0x00,0x1d,0x90,0x00,0x03,0xe7,0x00,0x00,
+0x1f,0x40,0x00,0x00,0x1f,0x50,0x00,0x00,0x03,0x20,0x00,0xf0,0x07,0x2d,0xa0,0x00,
+0x00,0x01,0xcc,0x10,0x00,0x00,0x0b,0xd1,0x00,0x00,0x00,0x80,0x0c,0x30,0x00,0x04,
+0xd0,0x00,0xf0,0x5a,0x00,0xf1,0x21,0x2d,0x00,0x22,0x14,0xd4,0x63,0xb0,0x0b,0xde,
+0xef,0xb9,0x4a,0x00,0x00,0x02,0xd0,0x05,0x90,0x00,0x00,0x2d,0x00,0x59,0x90,0x00,
+0x03,0xc0,0x04,0xd9,0x00,0x00,0x69,0x00,0x2f,0x50,0x00,0x0d,0x40,0x00,0xf2,0x00,
+0x1b,0xb0,0x00,0x02,0x00,0x06,0x90,0xfb,0x00,0x67,0x01,0x00,0xff,0xff,0xff,0xe0,
+0x54,0x01,0x03,0x01,0x00,0x10,0x97,0x9f,0x01,0x00,0xe9,0x00,0xc0,0x8c,0x20,0x00,
+0x01,0x30,0x9f,0xed,0xef,0xfa,0x00,0x02,0x32,0xc0,0x01,0x10,0x02,0x05,0x00,0x20,
+0x0a,0x80,0xd9,0x00,0x72,0xe5,0x89,0x0e,0xff,0xfe,0xfd,0x73,0xd7,0x00,0x30,0x00,
+0x00,0x0c,0x2f,0x00,0x71,0x58,0xd0,0x08,0x70,0x00,0x8a,0xb0,0x3b,0x00,0x20,0x09,
+0xa0,0x5f,0x01,0xa0,0xbe,0xcc,0xdf,0x50,0x00,0x01,0x34,0x31,0x00,0xe4,0x48,0x01,
+0x00,0xfe,0x01,0x10,0xe2,0x43,0x02,0xc0,0x20,0x00,0x00,0x00,0xe1,0x00,0x00,0x00,
+0x0f,0x10,0x00,0x00,0xc0,0x00,0x01,0x0c,0x01,0xf2,0x13,0x71,0xe2,0x00,0x00,0x7f,
+0x3a,0xb3,0x14,0xae,0x40,0x1a,0xef,0xc8,0x10,0x00,0x0f,0x30,0x00,0x06,0x00,0x0f,
+0x20,0x09,0x2b,0x30,0x0f,0x10,0x04,0xb2,0x70,0x0f,0x10,0x00,0x50,0x33,0x01,0x0a,
+0x05,0x00,0xf0,0x00,0x71,0x0f,0x10,0x00,0x08,0xf2,0x0b,0xa3,0x14,0xbe,0x30,0x01,
+0xae,0xfc,0x71,0x17,0x00,0xf0,0x04,0xf1,0x00,0x00,0x46,0x77,0x88,0xf9,0x88,0x80,
+0x46,0x55,0x44,0xf4,0x44,0x40,0x00,0x01,0x8a,0xf1,0xd1,0x00,0x21,0x83,0xe2,0x33,
+0x00,0x10,0xb6,0x8a,0x00,0x20,0x63,0xe6,0x8e,0x02,0x30,0xbc,0xf3,0x00,0xd0,0x00,
+0x60,0xb0,0x00,0x00,0x00,0x08,0xeb,0x0b,0x00,0x24,0x06,0x30,0xd0,0x01,0xf0,0x08,
+0x40,0x00,0x00,0x03,0xe0,0xb4,0xc1,0x12,0x23,0x35,0xe3,0x69,0x50,0xcd,0xcb,0xbb,
+0xfa,0xab,0x90,0x00,0x00,0x13,0xe0,0x2a,0x00,0x10,0xed,0x06,0x00,0x11,0x2e,0xc0,
+0x00,0x91,0x1e,0x12,0xf4,0x00,0x00,0x00,0x07,0xed,0xf1,0xd1,0x02,0x00,0x48,0x00,
+0x30,0x17,0xdc,0x10,0xfd,0x00,0x20,0x50,0x00,0x18,0x00,0x91,0x20,0x00,0x84,0x00,
+0x00,0x0c,0x30,0x00,0xa4,0x06,0x00,0xd1,0xa5,0x22,0x25,0x6e,0xbb,0xce,0xfe,0xd9,
+0x59,0x7d,0x63,0x10,0xb3,0x12,0x00,0x10,0xc2,0x06,0x00,0x21,0x8e,0xf0,0x0c,0x00,
+0x00,0x89,0x00,0x20,0x70,0x00,0x96,0x00,0x93,0xee,0xde,0xff,0x40,0x00,0x00,0x01,
+0x22,0x10,0x8c,0x00,0x90,0x05,0xdd,0xee,0xfa,0x00,0x00,0x12,0x10,0xab,0x0d,0x00,
+0x10,0xb9,0x86,0x01,0xd0,0xd7,0x00,0x00,0x01,0x47,0xed,0xac,0xdd,0xe7,0x5b,0x97,
+0x7d,0x51,0x7d,0x01,0x20,0x20,0x00,0xf4,0x01,0x01,0xc6,0x02,0x01,0x36,0x00,0x20,
+0x8e,0x85,0x71,0x02,0x24,0x38,0xa7,0xd1,0x01,0x11,0x6c,0x8f,0x00,0xf1,0x07,0x93,
+0x50,0x00,0x07,0xdd,0xff,0xc9,0x00,0x00,0x01,0x2f,0x10,0x12,0x21,0x00,0x02,0xd0,
+0x0c,0xdc,0xd7,0x00,0x89,0x85,0x02,0xf8,0x07,0x40,0x10,0x00,0x00,0x02,0xe0,0x0a,
+0x50,0x00,0x00,0x99,0x00,0xb7,0x00,0x00,0x1f,0x30,0x03,0xde,0xdf,0xb0,0x30,0x1a,
+0x02,0xf1,0x06,0x0e,0x40,0x00,0x53,0xa0,0x00,0x00,0xf2,0x42,0x06,0x79,0x10,0xed,
+0xef,0xdb,0x40,0x04,0x00,0x01,0x28,0x90,0xa5,0x00,0x52,0xa6,0x05,0xdc,0xde,0x20,
+0xcb,0x01,0x31,0x00,0x05,0xc0,0x52,0x03,0x31,0xa7,0x02,0xd0,0x8c,0x00,0xc2,0x3d,
+0x10,0x00,0x00,0x09,0xb0,0x00,0x9f,0xde,0xf5,0x00,0x12,0x3e,0x02,0xa0,0x15,0x8b,
+0xb5,0x00,0x6c,0xea,0x53,0x4d,0x70,0x65,0x71,0x00,0x13,0x00,0x05,0x00,0xb0,0x08,
+0xa0,0x00,0x00,0x03,0xad,0x10,0x00,0x1d,0xfd,0x71,0x24,0x03,0x01,0x9a,0x03,0xe0,
+0x22,0x00,0x00,0x04,0x9d,0xec,0xde,0x50,0x9f,0xc7,0x20,0x00,0x3e,0x44,0xe2,0x00,
+0x11,0x89,0xa3,0x01,0x10,0xb0,0x06,0x00,0x10,0xb8,0x05,0x00,0xb2,0xad,0x10,0x00,
+0x13,0x5a,0xeb,0x10,0x00,0x07,0xdb,0x82,0xa4,0x00,0xf1,0x00,0x12,0x15,0x89,0xbc,
+0xdf,0xff,0xe5,0x78,0x64,0x27,0xc3,0x00,0x00,0x00,0x04,0x11,0x01,0x15,0xc4,0x2e,
+0x02,0x21,0x00,0xf1,0xa9,0x02,0x01,0x65,0x01,0x11,0x3e,0x32,0x00,0x33,0x2a,0xfe,
+0x30,0x74,0x03,0x00,0x3d,0x00,0x82,0x00,0x67,0x9a,0xcd,0xef,0xfe,0x40,0x88,0x3e,
+0x00,0xe0,0x00,0x4c,0x00,0x67,0x60,0x00,0x00,0xc3,0x00,0x94,0x90,0x00,0x00,0xf0,
+0x09,0x01,0x21,0x01,0xf0,0x28,0x00,0x11,0xd6,0x06,0x00,0x21,0x3f,0x81,0xac,0x01,
+0x21,0xaf,0xe2,0x0e,0x00,0x02,0x37,0x02,0x20,0x03,0xe0,0x4b,0x01,0xf0,0x07,0x50,
+0x00,0x28,0x00,0x6c,0x01,0x9e,0x70,0x00,0xda,0xe8,0x10,0x00,0x1d,0xa1,0x00,0x00,
+0x1d,0x70,0x00,0x00,0x08,0x6e,0x04,0x10,0xb5,0x85,0x01,0xf6,0x01,0xd2,0x00,0x00,
+0x22,0x08,0xee,0xee,0xff,0x60,0x00,0x12,0x21,0x00,0x00,0x01,0x20,0xd4,0x00,0xa0,
+0x09,0x97,0x30,0x20,0x00,0x9e,0xef,0xb8,0x23,0xe9,0x7d,0x00,0xf0,0x02,0x00,0x1a,
+0xd0,0x00,0xb5,0x00,0x1d,0x00,0x20,0x03,0xe0,0x00,0x0e,0x00,0x00,0x0d,0x60,0xc5,
+0x00,0xf4,0x07,0x7c,0x01,0xbe,0xef,0x50,0x00,0x02,0x0a,0x70,0x0f,0xdc,0x10,0x00,
+0x0a,0x70,0x5f,0x09,0x60,0x00,0x02,0xae,0xe5,0xa3,0x01,0x11,0x96,0xe0,0x00,0xb1,
+0x30,0x1e,0xdd,0xde,0x20,0xe1,0x00,0x22,0x32,0x20,0x0e,0x48,0x01,0x01,0x06,0x01,
+0x11,0x2c,0xa0,0x00,0xf2,0x09,0xc9,0x05,0x30,0x00,0x00,0x2e,0xa0,0xa4,0x00,0x00,
+0x01,0xf6,0x09,0xb4,0x24,0x64,0x0e,0x20,0x08,0xcd,0xdb,0x50,0x40,0x00,0x05,0x05,
+0xf5,0x24,0x30,0x00,0x00,0x03,0xdd,0xfc,0xe9,0x00,0x05,0xe3,0x0f,0x10,0x9b,0x02,
+0xe1,0x03,0xe0,0x00,0xc5,0x88,0x00,0x6a,0x00,0x07,0x9b,0x40,0x0a,0x60,0x00,0x5b,
+0xb4,0x01,0xf1,0x00,0x08,0x98,0xa0,0xa9,0x00,0x01,0xe4,0x1d,0xfd,0x10,0x04,0xd9,
+0x00,0x04,0x00,0x5e,0xd6,0x3e,0x01,0x00,0x8f,0x05,0x20,0x09,0x70,0xcd,0x01,0x20,
+0x0c,0x30,0x8a,0x02,0xf1,0x04,0x0e,0x00,0x7c,0xbc,0xfe,0xf0,0x0e,0x00,0x13,0x35,
+0xe1,0x00,0x1c,0x00,0x00,0x01,0xe0,0x00,0x3b,0x41,0x01,0xf0,0x08,0x3c,0xa0,0x07,
+0xaa,0xf1,0x00,0x2e,0xa0,0xa9,0x34,0xfe,0x60,0x1f,0x60,0xd4,0x03,0xf3,0xd4,0x0e,
+0x20,0x5e,0xdf,0x70,0xf4,0x01,0x01,0x40,0x02,0x02,0xfc,0x01,0x21,0x0b,0xfa,0x10,
+0x01,0x20,0xb2,0xd8,0x1c,0x01,0xc0,0xe1,0x01,0xe6,0x00,0x00,0x04,0xf3,0x00,0x03,
+0xf5,0x00,0x00,0x0a,0x00,0x11,0xf4,0x25,0x00,0x31,0x05,0xf4,0x00,0x3a,0x01,0x12,
+0xf1,0x7a,0x01,0x02,0x84,0x00,0x11,0x40,0x13,0x00,0xf0,0x14,0x3b,0x40,0x00,0x00,
+0x9e,0x40,0x3c,0x2a,0x00,0x00,0x8c,0x6e,0x30,0x60,0x00,0x00,0x5e,0x10,0x5e,0x20,
+0x00,0x00,0x3f,0x40,0x00,0x7d,0x10,0x00,0x1f,0x70,0x00,0x00,0x9d,0x10,0x00,0x9f,
+0x03,0x12,0xac,0x60,0x03,0x12,0xbd,0x3b,0x00,0x01,0xeb,0x01,0x90,0x00,0x5c,0xbb,
+0xec,0xde,0x70,0x01,0x23,0xd4,0x8e,0x00,0x81,0xc3,0x12,0x30,0x9e,0xfe,0xff,0xec,
+0x80,0x19,0x00,0xf0,0x08,0x00,0x01,0xb4,0x00,0x00,0x2c,0xdc,0xfc,0x50,0x00,0xa7,
+0x00,0xa8,0xbd,0x30,0x8b,0x45,0xf3,0x05,0xb0,0x06,0xaa,0x50,0xac,0x00,0x20,0xbb,
+0xcc,0x40,0x00,0x31,0x43,0x2a,0x80,0x6e,0x01,0x11,0xe1,0x4e,0x00,0xf0,0x14,0x79,
+0x00,0x1e,0x00,0x00,0x29,0xdf,0xea,0x52,0xd0,0x00,0x3d,0x57,0xb1,0x5a,0xfd,0x00,
+0x0c,0x30,0xd3,0x00,0x09,0xed,0x10,0xe0,0x6b,0x00,0x01,0xe1,0x60,0x09,0xee,0x20,
+0x01,0xc7,0xec,0x00,0x12,0x04,0xf4,0x05,0x10,0x13,0x05,0x00,0x10,0x6a,0xc7,0x00,
 0xb0,0x37,0xb6,0x92,0x08,0x00,0x7b,0xdd,0x86,0x10,0x9c,0x10,0xa3,0x05,0x30,0x8b,
 0x0b,0xea,0x53,0x04,0x10,0x81,0x58,0x02,0xd0,0x95,0x3d,0x00,0x00,0x24,0x04,0xdd,
 0x50,0x00,0x04,0xc0,0x01,0xc4,0xa7,0x03,0x51,0x07,0xec,0xbc,0xed,0x20,0x5c,0x05,
-0x23,0x00,0x00,0xc1,0x02,0x20,0x07,0x90,0x03,0x00,0xf0,0x1e,0xa6,0x00,0x00,0x1e,
+0x23,0x00,0x00,0xc1,0x02,0x20,0x07,0x90,0x03,0x00,0xf1,0x23,0xa6,0x00,0x00,0x1e,
 0x7d,0xdf,0xea,0x10,0x01,0xfa,0x13,0xc0,0x8d,0x00,0xbb,0xa0,0x87,0x00,0xa6,0x6a,
 0x0e,0x2e,0x10,0x05,0xab,0x40,0x8e,0x90,0x00,0x5b,0xc2,0x04,0xf6,0x00,0x09,0x89,
-0xa7,0xe6,0x80,0x05,0xe1,0x1a,0x92,0x01,0x6b,0xc7,0x08,0x12,0x19,0x4f,0x15,0x03,
-0x85,0x00,0x90,0x24,0x28,0x80,0x10,0x00,0x03,0xac,0xff,0xed,0xdd,0x00,0x00,0x14,
-0x02,0xf1,0x03,0x20,0xd1,0x00,0x07,0x10,0x7d,0xef,0xdd,0xd0,0x8a,0x00,0x01,0xe2,
-0x10,0x00,0xf1,0x00,0x2d,0xcb,0x05,0xe3,0xf1,0x00,0x02,0xf1,0x00,0x0a,0xc5,0x58,
-0xe6,0x00,0x00,0x06,0xab,0x82,0x41,0x00,0x91,0xbe,0xa7,0x41,0x00,0x00,0x02,0x58,
-0xb2,0x00,0x7c,0x02,0x11,0x2e,0x48,0x03,0xf2,0x00,0x05,0x9b,0xa5,0x00,0x6c,0xc9,
-0x53,0x6c,0x80,0x8e,0x40,0x00,0x02,0xe0,0x33,0xc3,0x08,0xb3,0x00,0x2d,0x80,0x00,
-0xaa,0xad,0xe8,0x00,0x00,0x56,0x64,0x3b,0x00,0xf1,0x11,0xc4,0x19,0xb6,0x00,0x0e,
-0x3d,0x64,0xd6,0x00,0xec,0x20,0x03,0xe0,0x1f,0x70,0x00,0x0e,0x22,0xf1,0x00,0x00,
-0xd3,0x2e,0x00,0x00,0x0f,0x11,0xb0,0x00,0x03,0xf0,0x00,0xec,0x16,0x63,0x03,0xcb,
-0x00,0x00,0x6e,0xe6,0x38,0x03,0xa0,0xab,0xcc,0xde,0x70,0x00,0x03,0x32,0x1a,0xb0,
-0x00,0xa0,0x0b,0x00,0x2c,0x13,0x10,0x80,0x59,0x00,0xb0,0xfc,0xdc,0x60,0x00,0x3e,
-0x92,0x00,0x2c,0x80,0x3e,0x40,0x87,0x08,0xf6,0x05,0x30,0x7d,0xd5,0x01,0xf0,0x00,
-0x1e,0x01,0xe2,0x7c,0x00,0x00,0xe8,0x4b,0xde,0x20,0x00,0x01,0x8a,0x96,0xeb,0x06,
-0x12,0x6b,0x47,0x02,0xf1,0x0b,0x90,0x00,0x10,0x00,0x01,0xac,0xec,0x09,0xee,0xc0,
-0x00,0x04,0x29,0x9d,0x60,0x0e,0x30,0x00,0x00,0xce,0x20,0x00,0xd2,0x00,0x00,0x8f,
-0xa8,0x07,0x20,0x4d,0xc3,0xc3,0x02,0xf7,0x07,0x1e,0x3b,0x30,0x00,0x2d,0x00,0x02,
-0x70,0xc3,0x00,0x03,0xe2,0x77,0x00,0x0c,0x40,0x00,0x0b,0xfa,0x10,0x00,0x83,0x38,
-0x07,0x02,0xc8,0x03,0x20,0x07,0x90,0x1a,0x06,0xe0,0xff,0xb0,0x69,0xb8,0x10,0x01,
-0x09,0x9d,0x94,0x38,0xe1,0x00,0x0d,0xd3,0xb1,0x01,0xf5,0x12,0x8f,0x30,0x00,0x00,
-0x4c,0x03,0xdc,0x30,0x00,0x00,0x7a,0x1e,0x4b,0x30,0x00,0x01,0xe5,0x39,0x0c,0x30,
-0x00,0x5d,0x90,0x00,0x0c,0x40,0x2f,0xc5,0x00,0x00,0x08,0x30,0x01,0xc3,0x02,0xd0,
-0x0f,0x00,0x01,0x00,0x2c,0xbc,0xfd,0xee,0xa0,0x00,0x22,0xd6,0x10,0x8b,0x04,0x00,
-0x23,0x1c,0xe0,0x1e,0xcb,0xe6,0x4c,0xd2,0x0c,0xb1,0x06,0xfa,0x30,0x02,0x90,0x09,
-0xbe,0xf3,0x00,0x20,0x71,0xe0,0x3e,0x07,0x10,0x03,0x75,0x04,0x80,0x84,0x45,0x74,
-0x00,0x00,0x18,0xab,0xa9,0x22,0x0f,0x01,0x8b,0x00,0x11,0x4e,0xde,0x02,0x11,0xc6,
-0x94,0x05,0x12,0xd0,0xe3,0x05,0x01,0x09,0x06,0x10,0x8a,0x39,0x01,0x30,0xdd,0x59,
-0xb0,0x07,0x13,0xf4,0x07,0x02,0xd0,0x00,0x92,0x0d,0x50,0x02,0xe0,0x01,0xf1,0x4e,
-0x00,0x01,0xf1,0x1b,0x80,0xa8,0x00,0x00,0xaf,0xf9,0x00,0xe7,0x07,0x01,0x21,0x0e,
-0x01,0x43,0x13,0xc3,0x20,0x0a,0x80,0x00,0x03,0xd0,0x9b,0x00,0x00,0x04,0xc2,0x90,
-0xdf,0x00,0x01,0x4e,0x00,0x10,0xaa,0x85,0x00,0x15,0x90,0x7f,0x02,0xc2,0x11,0x11,
-0x11,0x11,0x10,0x5e,0xee,0xee,0xee,0xef,0xe0,0x00,0x09,0x05,0x21,0x00,0x3c,0xb0,
-0x06,0x30,0x3d,0x1d,0x90,0xc5,0x00,0x12,0x04,0x1a,0x03,0x10,0x00,0xbb,0x0a,0x01,
-0x4f,0x0b,0x10,0xc0,0x6b,0x00,0x11,0xbd,0xbc,0x06,0x13,0x81,0x45,0x00,0x20,0x02,
-0x90,0x9d,0x05,0x00,0x31,0x05,0xe1,0xe5,0x00,0x00,0x07,0xef,0x30,0x00,0x3b,0xfa,
-0x2e,0x20,0x00,0x16,0x10,0x32,0x08,0x07,0x05,0x00,0x07,0x44,0x0f,0x20,0x03,0xe2,
-0xec,0x05,0x10,0xe7,0x51,0x00,0x00,0x65,0x08,0xd1,0x7e,0xf1,0x00,0x00,0x49,0xeb,
-0x6e,0x00,0x00,0x7e,0x82,0x03,0xe0,0xeb,0x05,0x05,0x9b,0x05,0x08,0x0b,0x00,0x14,
-0x16,0x2d,0x07,0x00,0xab,0x11,0x20,0x10,0x2f,0xb6,0x00,0x10,0x61,0x19,0x00,0x20,
-0xe3,0x1e,0x4f,0x17,0x00,0xca,0x0f,0x11,0x08,0xcd,0x01,0x01,0x33,0x10,0x10,0xcb,
-0x37,0x00,0x00,0x77,0x09,0x20,0x5b,0xe7,0x0a,0x00,0x00,0xcb,0x0b,0x00,0xe8,0x00,
-0x53,0x60,0x01,0x01,0xf0,0x01,0xc1,0x08,0x0a,0x05,0x00,0x00,0x41,0x0d,0x02,0x2e,
-0x06,0xb0,0x1e,0xdd,0xdd,0xdd,0xdd,0x30,0x32,0x23,0xf2,0x22,0x30,0x8d,0x02,0x14,
-0x00,0x47,0x06,0x0a,0x0b,0x00,0x70,0x0c,0xdd,0xdd,0xfd,0xdd,0xdc,0x33,0x01,0x00,
-0x00,0x3b,0x15,0x20,0x20,0x00,0x75,0x04,0xf3,0x0f,0x9f,0xee,0xff,0xfe,0xe0,0x00,
-0x09,0xf3,0x00,0x00,0x07,0xcb,0x40,0x00,0x09,0xd1,0xa4,0x00,0x3d,0xa1,0x0a,0x40,
-0x09,0x60,0x00,0xb4,0x00,0x00,0x08,0xef,0x77,0x05,0x03,0x7a,0x09,0xe1,0x00,0x0b,
-0x40,0x00,0x09,0xfe,0xee,0xef,0xfe,0xf7,0x00,0x00,0x00,0x8f,0xa4,0x0a,0x10,0xdb,
-0x06,0x00,0xf0,0x06,0x6d,0x2a,0x50,0x00,0x00,0x1b,0xc1,0x0a,0x60,0x00,0x06,0xe8,
-0x00,0x0a,0x60,0x00,0x08,0x30,0x00,0x0a,0x60,0x9d,0x01,0x20,0xdf,0x40,0x80,0x00,
-0x10,0x21,0x3b,0x00,0x13,0xc5,0x27,0x07,0x50,0x8f,0xee,0xff,0xee,0xfc,0x26,0x07,
-0x10,0x3d,0xc2,0x05,0x10,0x3c,0xe9,0x01,0x10,0x4b,0x6a,0x01,0xf4,0x02,0x69,0x00,
-0xab,0x00,0x00,0x87,0x07,0xe1,0x00,0x00,0xd4,0x7e,0x20,0x08,0xff,0xd0,0x01,0x37,
-0x0b,0x80,0x02,0x40,0x00,0x00,0xe3,0x00,0x84,0xb1,0xcc,0x09,0xf0,0x05,0x07,0x10,
-0xae,0xee,0xfe,0xee,0xec,0x00,0x11,0x13,0xe1,0x11,0x4d,0x00,0x00,0x05,0xb0,0x00,
-0x3c,0x00,0x12,0x06,0x10,0x4b,0x72,0x0b,0x00,0xcc,0x0b,0x40,0xa9,0x00,0x00,0x87,
-0x52,0x12,0x80,0x00,0xd4,0x00,0x9d,0x20,0x0a,0xee,0xd0,0x52,0x07,0x15,0x22,0x3c,
-0x07,0x21,0x0f,0x20,0x8a,0x00,0xc1,0x25,0x84,0x02,0x68,0xbe,0xfd,0xb8,0x30,0x5a,
-0x85,0x7b,0x00,0x1c,0x08,0x00,0x6a,0x00,0xd5,0x2f,0x79,0xcf,0x85,0xac,0xfd,0xea,
-0x63,0x10,0x36,0x30,0x09,0x70,0xb4,0x03,0x02,0xc7,0x01,0x10,0x07,0x05,0x00,0x11,
-0x46,0x01,0x01,0x10,0x80,0xf5,0x00,0xf0,0x01,0xfc,0xbb,0xcc,0x10,0x02,0xe5,0x22,
-0x26,0xe0,0x03,0xe5,0x00,0x00,0x99,0x05,0xe5,0x54,0x18,0x13,0x02,0x1d,0x00,0x20,
-0x08,0xd0,0x55,0x06,0x10,0xd2,0x83,0x11,0x66,0xd1,0x00,0x00,0x01,0xce,0x70,0x39,
-0x06,0x03,0x11,0x02,0xf0,0x01,0xc3,0x00,0x85,0xb2,0x00,0x00,0x6d,0x00,0x01,0x91,
-0x10,0x00,0x1e,0xee,0xee,0xf9,0x2e,0x08,0x00,0xc8,0x02,0x20,0x1c,0x90,0x6f,0x00,
-0x23,0x0d,0x70,0x78,0x08,0x21,0x00,0x6d,0x06,0x00,0x25,0x5e,0x30,0x4f,0x12,0x30,
-0x04,0xcd,0x30,0x61,0x00,0x19,0xe7,0x46,0x0b,0x00,0x98,0x01,0x00,0x24,0x05,0x02,
-0xe0,0x08,0x00,0xb6,0x02,0x10,0xff,0x86,0x12,0x70,0x9b,0x00,0x0c,0x60,0x11,0x07,
-0xe1,0xc9,0x02,0x41,0x0a,0x30,0x00,0x2f,0x2b,0x00,0x11,0x8a,0x2b,0x00,0x01,0x8e,
-0x0a,0x20,0x1d,0x80,0x97,0x00,0x17,0xe9,0x57,0x08,0x23,0x00,0x00,0x1a,0x07,0x20,
-0x42,0x90,0x08,0x05,0xf0,0x09,0x06,0x7a,0x20,0x00,0x99,0x00,0x00,0x06,0x00,0x00,
-0x0e,0xdc,0xcc,0xcc,0xc9,0x00,0x09,0xb3,0x33,0xe6,0x33,0x20,0x07,0xe1,0x82,0x09,
-0x23,0x01,0xd3,0x18,0x01,0x00,0x22,0x00,0x00,0xc9,0x02,0x15,0x20,0x53,0x00,0x36,
-0x00,0x4e,0xa0,0x96,0x00,0x01,0x01,0x00,0xa4,0xcf,0xee,0xee,0xee,0xf0,0x11,0x11,
-0x11,0x13,0xf0,0x8b,0x02,0x0d,0x05,0x00,0x91,0xde,0xdd,0xdd,0xde,0xf0,0x32,0x22,
-0x22,0x24,0xcd,0x02,0x00,0xd0,0x03,0x50,0x04,0xc0,0x00,0x00,0x3d,0x06,0x00,0xc0,
-0x33,0x5d,0x33,0x36,0xd3,0x31,0xbc,0xdf,0xcc,0xcd,0xfc,0xc4,0x12,0x00,0x10,0xb0,
-0x18,0x00,0x20,0x06,0xa0,0x06,0x00,0x11,0x08,0x5e,0x0c,0x11,0x0e,0x71,0x04,0x20,
-0x8c,0x00,0xf0,0x0e,0x01,0x74,0x0e,0x17,0x77,0xce,0x00,0xf1,0x0c,0x91,0x00,0x1b,
-0x44,0xa0,0x00,0x0e,0x20,0x02,0xe1,0xa7,0x01,0x10,0xe3,0x00,0x3e,0x02,0x00,0x8e,
-0xef,0xee,0xee,0xfe,0xe7,0x00,0x00,0xd2,0x36,0x06,0x41,0x0d,0x20,0x03,0xd0,0x2d,
-0x0c,0x11,0x5b,0xa5,0x01,0x02,0x1a,0x0b,0x21,0x04,0xf2,0xf3,0x01,0x11,0xf5,0x0c,
-0x00,0x10,0xb2,0x06,0x00,0x30,0x69,0x10,0x00,0x3c,0x0d,0x01,0x6a,0x00,0x40,0x44,
-0x00,0x00,0x06,0x15,0x00,0x91,0x27,0x07,0xf6,0x00,0x00,0x0d,0x80,0x02,0x30,0xfb,
-0x17,0x30,0x00,0x2c,0xc0,0x20,0x14,0xa7,0x80,0x00,0x00,0x16,0xde,0x40,0x00,0x00,
-0xbf,0xc5,0xdf,0x04,0x01,0xc8,0x02,0xf0,0x03,0x76,0x00,0x02,0x56,0x80,0x00,0x3c,
-0xc2,0x00,0xd1,0xb1,0x00,0x00,0x83,0x00,0x43,0x00,0x78,0x72,0x00,0xd0,0x40,0x2a,
-0xe4,0x00,0x00,0x1e,0x60,0x00,0x53,0x00,0x00,0xc9,0x00,0x55,0x06,0x10,0xb0,0x5e,
-0x02,0x10,0xf8,0x05,0x00,0x00,0x47,0x00,0x30,0x0c,0xfd,0x60,0x84,0x00,0x21,0x20,
-0x00,0x4c,0x13,0x90,0x11,0x11,0x20,0x00,0x8f,0xff,0xff,0xff,0x30,0x9e,0x00,0x15,
-0xc0,0x36,0x04,0x11,0x9b,0x9a,0x14,0x00,0x6c,0x00,0x20,0x6e,0xcb,0x99,0x04,0xa0,
-0x30,0xcb,0x00,0x03,0xcd,0x20,0x00,0xcb,0x06,0xf7,0x1a,0x1c,0x15,0x01,0x7e,0x0e,
-0x02,0x01,0x00,0x11,0x62,0x9f,0x01,0x20,0x58,0x92,0x11,0x13,0x10,0xe4,0x55,0x00,
-0x21,0x1b,0x90,0xc2,0x01,0x15,0x10,0xef,0x0a,0x11,0x07,0xc8,0x05,0x20,0x7e,0xe5,
-0x50,0x02,0x30,0xd2,0x4f,0x50,0x92,0x04,0xb1,0x04,0xf5,0x00,0x9f,0x70,0x00,0x00,
-0x5f,0x20,0x21,0x00,0xf9,0x05,0x12,0x01,0x0f,0x09,0x12,0xf0,0x06,0x00,0xc1,0x14,
-0x7b,0xe4,0x03,0x58,0xfe,0xea,0x78,0xd0,0x1e,0xa7,0xf1,0xb2,0x05,0x11,0xf0,0x8f,
-0x05,0x35,0xf0,0x01,0x90,0x24,0x00,0x10,0xf4,0x4a,0x07,0x00,0xfa,0x03,0x10,0xd0,
-0x5b,0x0f,0x18,0x10,0xbf,0x02,0x20,0x42,0xb0,0xda,0x15,0x30,0x04,0x97,0x40,0x91,
-0x01,0x10,0x05,0xc4,0x09,0xf1,0x04,0x14,0x8b,0xe3,0x00,0x35,0x9f,0xed,0xa7,0x9d,
-0x00,0x3e,0xb9,0xe1,0x00,0x1e,0x30,0x00,0x00,0x1e,0x4f,0x0b,0x21,0x01,0xe0,0xb7,
-0x05,0x00,0x3a,0x05,0x02,0x83,0x00,0x00,0xa1,0x0e,0x30,0xec,0xce,0xfd,0x6b,0x01,
-0x22,0x33,0x31,0xd5,0x09,0x30,0x26,0x02,0xf2,0x8a,0x06,0x20,0x09,0xc0,0x9b,0x02,
-0x11,0x1e,0x8c,0x0e,0x45,0x67,0x00,0x05,0xe0,0x51,0x0b,0x11,0x9d,0xdc,0x00,0x00,
-0x86,0x0c,0x10,0xbe,0x74,0x08,0x11,0xfa,0x6e,0x0e,0x0a,0x96,0x0e,0x11,0x73,0x11,
-0x01,0x20,0x95,0x91,0x13,0x02,0x20,0x66,0x00,0xda,0x14,0x11,0xb7,0x42,0x00,0x10,
-0xf2,0xe8,0x06,0x00,0xe5,0x06,0x10,0x10,0x74,0x06,0x00,0x32,0x16,0x01,0x8c,0x07,
-0x01,0x9a,0x0b,0x20,0x7f,0x40,0xf7,0x11,0x20,0xd3,0x00,0x18,0x02,0x02,0x46,0x00,
-0x23,0x57,0x00,0x40,0x19,0xf0,0x0c,0x00,0x07,0xfe,0xee,0xef,0x20,0x04,0xe2,0x00,
-0x04,0xe0,0x04,0xe3,0x00,0x00,0xa8,0x06,0xe3,0x1e,0x80,0x3f,0x10,0x11,0x00,0x1a,
-0xed,0x70,0x22,0x00,0xa0,0xfb,0x10,0x00,0x00,0x1c,0xb1,0x91,0x00,0x00,0x6e,0x9c,
-0x0c,0x28,0xec,0x40,0x2d,0x04,0x30,0x01,0x17,0x00,0xc8,0x04,0xf0,0x03,0x76,0xb2,
-0x00,0x00,0x6e,0x33,0x34,0xa1,0x00,0x00,0x2e,0xbb,0xbb,0xec,0x00,0x00,0x1d,0x60,
-0x59,0x00,0xb0,0x2d,0x81,0x20,0x03,0xf0,0x00,0x0d,0x60,0x5e,0x91,0xc7,0x2c,0x00,
-0x21,0x1a,0xfe,0x33,0x00,0x21,0x6e,0xea,0x98,0x0d,0x52,0x21,0x30,0x00,0x00,0x06,
-0x23,0x0e,0x18,0xc4,0xdc,0x00,0xa3,0x01,0x23,0x69,0xd3,0x00,0xae,0xdc,0xfa,0x63,
-0x00,0x0d,0x0e,0x00,0x75,0x0a,0x60,0xdf,0xee,0xef,0xfe,0xef,0xd1,0x64,0x05,0x13,
-0x01,0x31,0x06,0x01,0x48,0x04,0x20,0x05,0xe2,0x3f,0x00,0x01,0x63,0x02,0x12,0x31,
-0x1b,0x04,0xf0,0x05,0x20,0x00,0x05,0x50,0x6a,0x00,0x4c,0x4d,0x00,0xf0,0x08,0x90,
-0xd3,0x06,0x10,0xd3,0x03,0x10,0x00,0x7c,0xef,0x06,0x10,0x20,0xc5,0x11,0x20,0x00,
-0x03,0x20,0x03,0x22,0xb8,0x10,0x77,0x03,0xf4,0x04,0x01,0x07,0x70,0x0a,0x70,0x00,
-0xb8,0x3e,0x00,0x4d,0x00,0x0f,0x30,0xc5,0x00,0xd1,0x03,0xe0,0x06,0xd7,0x04,0x11,
-0x4e,0xb3,0x09,0x13,0x60,0x81,0x07,0x84,0x01,0x8f,0x60,0x00,0x00,0x05,0xfb,0x30,
-0xf8,0x00,0xc4,0x02,0xcc,0xcc,0xcc,0xc6,0x00,0x03,0x33,0x33,0x33,0x10,0x00,0xf7,
-0x02,0x83,0x11,0x11,0xae,0xee,0xef,0xfe,0xee,0xd0,0x66,0x0d,0x25,0x0e,0x30,0x98,
-0x05,0x10,0xc8,0x32,0x00,0x11,0xbb,0x2a,0x14,0x04,0xe3,0x00,0xd8,0x11,0x90,0x01,
-0x33,0x33,0x33,0x5a,0x67,0x04,0xcb,0xbb,0xbc,0x67,0x6a,0x02,0x00,0x76,0x1e,0x01,
-0x32,0x20,0x02,0x43,0x0e,0x16,0x1f,0xb2,0x0e,0x21,0x01,0xd5,0x37,0x11,0x15,0x90,
-0xdd,0x0c,0x12,0xe4,0x45,0x10,0x00,0x1f,0x14,0xe2,0x81,0x00,0x00,0xdd,0xfb,0x60,
-0x0d,0x31,0x7d,0xe6,0xd3,0x00,0x05,0x5d,0x15,0x00,0x00,0x73,0x04,0x34,0x62,0x00,
-0x00,0x88,0x02,0xc0,0x35,0x70,0x0f,0x10,0x0c,0x2c,0x10,0xf0,0x00,0x46,0x00,0x0f,
-0x19,0x02,0xe4,0xfd,0xfa,0x30,0x00,0x0f,0x13,0x9f,0xd4,0x00,0xf0,0x00,0x07,0x30,
-0x0f,0x29,0x03,0x01,0x76,0x00,0x01,0x38,0x10,0x03,0x3f,0x02,0x13,0xc5,0x56,0x07,
-0x10,0x0c,0x97,0x00,0x14,0xfe,0x3a,0x09,0x15,0xf2,0x41,0x08,0x20,0x0b,0x90,0x8a,
-0x01,0x10,0xd1,0x25,0x00,0x15,0xd2,0xb3,0x09,0xcf,0x02,0x22,0x22,0x22,0x31,0x00,
-0xbe,0xee,0xee,0xee,0x40,0x00,0x01,0x00,0x07,0x10,0x0e,0x53,0x00,0x20,0xf6,0x22,
-0x01,0x00,0x12,0x10,0xf5,0x06,0xb1,0x04,0x33,0x3f,0x43,0x31,0x00,0x0c,0xcb,0xbb,
-0xbc,0xf7,0x5c,0x00,0x01,0x36,0x11,0x11,0xca,0x32,0x02,0xf0,0x01,0x81,0x00,0x00,
-0x01,0x6d,0xcf,0x16,0xe6,0x00,0xaf,0xa4,0x0f,0x10,0x3d,0xb0,0x10,0xaa,0x00,0x14,
-0x30,0x26,0x01,0x13,0x0c,0x42,0x01,0x10,0x82,0x73,0x01,0x23,0xf1,0x00,0xaf,0x08,
-0x01,0x74,0x05,0x10,0x7d,0x43,0x00,0x10,0xf3,0xb5,0x04,0xec,0x90,0x00,0x00,0x02,
-0xe9,0x00,0x00,0x01,0x9f,0x80,0x00,0x00,0x0d,0xc3,0x8d,0x00,0x32,0x0b,0x30,0x4d,
-0x16,0x0f,0x21,0xd5,0x00,0xbc,0x05,0x11,0xc0,0xa7,0x0e,0x20,0x0f,0x30,0x67,0x01,
-0x00,0x02,0x21,0x20,0x5d,0x00,0x6f,0x06,0x00,0x5f,0x08,0x50,0x0e,0x50,0x06,0xd0,
-0x00,0x14,0x00,0x10,0x94,0x6e,0x00,0x02,0xf2,0x09,0x11,0x15,0x06,0x00,0xb1,0x85,
-0xb1,0x00,0x00,0x91,0x05,0x70,0xa2,0x10,0x00,0x2f,0xab,0x04,0x40,0x05,0xc0,0x00,
-0xa8,0x00,0x10,0x01,0x07,0x02,0x20,0x0f,0x20,0xb7,0x0e,0x00,0x9a,0x03,0x11,0x7c,
-0xf3,0x09,0x41,0x02,0xf2,0x00,0x7c,0x82,0x0f,0x01,0x52,0x01,0x18,0x7a,0xdd,0x06,
-0xe0,0x99,0x20,0x00,0x05,0x00,0x43,0x73,0x46,0x00,0x04,0xe0,0x07,0xc0,0x66,0x1d,
-0x00,0x21,0x0e,0x40,0x23,0x14,0x11,0x7c,0xca,0x01,0x00,0xcf,0x00,0x11,0x6b,0xe5,
-0x0b,0x00,0x17,0x00,0x30,0x4f,0x10,0x07,0xed,0x00,0x31,0xe6,0x01,0xf3,0xbe,0x11,
-0x12,0x02,0x7f,0x0e,0x00,0xf6,0x00,0xf0,0x10,0x44,0x04,0xa0,0x00,0x00,0xb3,0xc0,
-0x4c,0x00,0x00,0x03,0x72,0x04,0xc0,0x00,0x04,0xb1,0x00,0x4c,0x04,0x8e,0xc6,0x00,
-0x04,0xff,0xc7,0x20,0x00,0x00,0x4d,0x10,0x25,0x05,0x12,0xc0,0xdc,0x0f,0x03,0xaa,
-0x02,0xe0,0x01,0x00,0x0b,0xfd,0xcd,0xef,0xd0,0x00,0x01,0x23,0x32,0x10,0x00,0x13,
-0x89,0x00,0xf5,0x09,0x24,0xc0,0x00,0x00,0x73,0x37,0x4c,0x00,0x00,0x18,0x76,0x04,
-0xc0,0x15,0xbe,0x91,0x00,0x4e,0xce,0xa5,0x00,0x00,0x04,0xd3,0x37,0x00,0x02,0x42,
-0x00,0x11,0x3e,0x74,0x00,0xc0,0xcf,0xdc,0xde,0xfd,0x00,0x00,0x12,0x33,0x21,0x00,
-0x00,0x02,0x0f,0x03,0x51,0x01,0xff,0xee,0xee,0xef,0x84,0x05,0x11,0x5d,0xc2,0x0e,
-0x01,0x2b,0x01,0x01,0xe7,0x1a,0x11,0x8b,0xe3,0x1a,0x10,0x30,0x12,0x06,0xbb,0x50,
-0x00,0x00,0x02,0xaf,0x50,0x00,0x00,0x09,0xfa,0x20,0x04,0x06,0x00,0xd0,0x01,0x01,
-0x5e,0x00,0x71,0x49,0x54,0x4f,0xff,0xff,0xff,0xfc,0x65,0x03,0x11,0x8b,0x18,0x00,
-0x14,0xb6,0x5c,0x05,0x04,0x73,0x0b,0x24,0x4f,0x10,0x06,0x0f,0x30,0x01,0x9f,0x40,
-0xac,0x0b,0x01,0x11,0x07,0x15,0x21,0x8b,0x0c,0x11,0x95,0x81,0x00,0x20,0x09,0x2f,
-0x72,0x02,0x10,0x96,0x48,0x00,0x02,0xb5,0x08,0x25,0x98,0x00,0x93,0x00,0x21,0x08,
-0xc0,0xc9,0x10,0x10,0x30,0xd4,0x00,0x10,0xf6,0x48,0x00,0x01,0x38,0x0a,0x22,0x9f,
-0xb3,0x4c,0x0e,0x1d,0x00,0x8f,0x0f,0x21,0xc2,0xcb,0x8f,0x0f,0x91,0x00,0xca,0x00,
-0x00,0x05,0xf3,0x00,0x01,0xd9,0x8f,0x0f,0x21,0x01,0xe8,0xc2,0x00,0x22,0x02,0xf6,
-0x9d,0x16,0x17,0xf1,0x37,0x00,0x0a,0x8f,0x0f,0x70,0x29,0x00,0x00,0x7c,0x6e,0x50,
-0x50,0x8f,0x0f,0x21,0x3e,0x50,0x77,0x00,0x21,0x3f,0x40,0x8f,0x0f,0x21,0x5f,0x30,
-0x29,0x00,0x12,0x7e,0xd1,0x0a,0x17,0x9e,0x3c,0x09,0x21,0x06,0x60,0x06,0x00,0xf1,
-0x0b,0x55,0x60,0x00,0x00,0xad,0x30,0x72,0x27,0x00,0x00,0xab,0x6e,0x41,0x88,0x10,
-0x00,0x7d,0x00,0x4f,0x40,0x00,0x00,0x5e,0x20,0x00,0x5f,0x44,0x00,0x31,0x00,0x6e,
-0x20,0x41,0x00,0x12,0x8e,0x41,0x00,0x16,0xad,0x41,0x00,0x01,0xb3,0x03,0x01,0xb6,
-0x16,0x10,0x0a,0x06,0x01,0x14,0xf9,0x3e,0x0c,0xb0,0x03,0x00,0xe1,0x03,0x00,0x00,
-0x03,0xe1,0x0e,0x10,0xc7,0x98,0x02,0xe0,0xe1,0x01,0xe2,0x00,0xb9,0x00,0x0e,0x10,
-0x07,0xc0,0x03,0x00,0x00,0xf1,0xbd,0x00,0x23,0x0c,0xdf,0x51,0x0f,0x04,0x4c,0x04,
-0x11,0x14,0x98,0x04,0x20,0x94,0xc1,0x14,0x09,0x40,0x01,0x51,0x00,0xcf,0x4f,0x00,
-0x14,0x70,0xc0,0x0b,0x20,0x10,0x1f,0x7e,0x02,0xf1,0x0e,0x3e,0x01,0xf0,0x1e,0x20,
-0x00,0x0c,0x60,0x1f,0x00,0x6c,0x00,0x08,0xc0,0x01,0xf0,0x00,0xd6,0x00,0xb2,0x00,
-0x1f,0x00,0x04,0x70,0x00,0x00,0x45,0xf0,0x46,0x01,0x14,0xc7,0xd0,0x13,0x10,0x97,
-0x3a,0x00,0x20,0x09,0x09,0x06,0x00,0x21,0x02,0x83,0x66,0x04,0x14,0xf7,0x72,0x09,
-0x01,0x51,0x0c,0x02,0x4b,0x00,0x51,0xc6,0x01,0xf0,0x06,0xc0,0x4a,0x00,0x40,0xd5,
-0x0b,0x20,0x01,0xc5,0x04,0x03,0x49,0x00,0x24,0xbc,0x70,0x98,0x00,0x10,0xaf,0xb7,
-0x0c,0x31,0xc0,0x10,0x00,0xab,0x08,0x00,0x11,0x0f,0x00,0x8e,0x11,0xd6,0x09,0xd1,
-0x00,0x00,0x9d,0x20,0x9d,0x10,0x00,0x00,0x07,0xeb,0xc1,0xf1,0x1c,0x31,0x06,0xf3,
-0x00,0x63,0x07,0x04,0x30,0x11,0x30,0x05,0xb8,0x52,0x8e,0x13,0xf1,0x05,0xee,0xa3,
-0x00,0x00,0x00,0x37,0x20,0x52,0x00,0x00,0x00,0x1b,0xef,0xb7,0x30,0x00,0x00,0x15,
-0x9e,0x80,0x2f,0x00,0x10,0x63,0x0f,0x10,0x21,0xdf,0xc8,0x12,0x00,0x13,0xd0,0xd4,
-0x01,0x26,0x08,0x80,0xbe,0x0d,0x03,0xba,0x0a,0x01,0x8a,0x03,0x00,0x81,0x07,0x11,
-0x01,0x50,0x0d,0x21,0x07,0xc0,0x13,0x00,0x20,0x0d,0x50,0x47,0x05,0xe2,0x01,0x7e,
+0xa7,0xe6,0x80,0x05,0xe1,0x1a,0x92,0x01,0x6b,0xe3,0x00,0x00,0x00,0x19,0xae,0x04,
+0x04,0x85,0x00,0x90,0x24,0x28,0x80,0x10,0x00,0x03,0xac,0xff,0xed,0xdd,0x00,0x00,
+0x14,0x02,0xf1,0x03,0x20,0xd1,0x00,0x07,0x10,0x7d,0xef,0xdd,0xd0,0x8a,0x00,0x01,
+0xe2,0x10,0x00,0xf1,0x00,0x2d,0xcb,0x05,0xe3,0xf1,0x00,0x02,0xf1,0x00,0x0a,0xc5,
+0x58,0xe6,0x00,0x00,0x06,0xab,0x82,0x41,0x00,0x91,0xbe,0xa7,0x41,0x00,0x00,0x02,
+0x58,0xb2,0x00,0x7c,0x02,0x11,0x2e,0x48,0x03,0xf0,0x04,0x05,0x9b,0xa5,0x00,0x6c,
+0xc9,0x53,0x6c,0x80,0x8e,0x40,0x00,0x02,0xe0,0x33,0x00,0x00,0x04,0xe0,0xcb,0x06,
+0x93,0x80,0x00,0xaa,0xad,0xe8,0x00,0x00,0x56,0x64,0x3b,0x00,0xf0,0x0f,0xc4,0x19,
+0xb6,0x00,0x0e,0x3d,0x64,0xd6,0x00,0xec,0x20,0x03,0xe0,0x1f,0x70,0x00,0x0e,0x22,
+0xf1,0x00,0x00,0xd3,0x2e,0x00,0x00,0x0f,0x11,0xb0,0x00,0x03,0x7c,0x03,0x93,0xc7,
+0x00,0x00,0x03,0xcb,0x00,0x00,0x6e,0xe6,0x38,0x03,0x90,0xab,0xcc,0xde,0x70,0x00,
+0x03,0x32,0x1a,0xb0,0x3c,0x05,0x00,0x6f,0x06,0x20,0x1c,0x80,0x59,0x00,0xb0,0xfc,
+0xdc,0x60,0x00,0x3e,0x92,0x00,0x2c,0x80,0x3e,0x40,0x87,0x08,0xf6,0x05,0x30,0x7d,
+0xd5,0x01,0xf0,0x00,0x1e,0x01,0xe2,0x7c,0x00,0x00,0xe8,0x4b,0xde,0x20,0x00,0x01,
+0x8a,0x96,0xeb,0x06,0x12,0x6b,0x47,0x02,0xf1,0x0b,0x90,0x00,0x10,0x00,0x01,0xac,
+0xec,0x09,0xee,0xc0,0x00,0x04,0x29,0x9d,0x60,0x0e,0x30,0x00,0x00,0xce,0x20,0x00,
+0xd2,0x00,0x00,0x8f,0xa8,0x07,0x20,0x4d,0xc3,0xc3,0x02,0xf7,0x07,0x1e,0x3b,0x30,
+0x00,0x2d,0x00,0x02,0x70,0xc3,0x00,0x03,0xe2,0x77,0x00,0x0c,0x40,0x00,0x0b,0xfa,
+0x10,0x00,0x83,0x38,0x07,0x02,0xc8,0x03,0x20,0x07,0x90,0x1a,0x06,0xe0,0xff,0xb0,
+0x69,0xb8,0x10,0x01,0x09,0x9d,0x94,0x38,0xe1,0x00,0x0d,0xd3,0xb1,0x01,0xf5,0x12,
+0x8f,0x30,0x00,0x00,0x4c,0x03,0xdc,0x30,0x00,0x00,0x7a,0x1e,0x4b,0x30,0x00,0x01,
+0xe5,0x39,0x0c,0x30,0x00,0x5d,0x90,0x00,0x0c,0x40,0x2f,0xc5,0x00,0x00,0x08,0x30,
+0x01,0xc3,0x02,0xe1,0x0f,0x00,0x01,0x00,0x2c,0xbc,0xfd,0xee,0xa0,0x00,0x22,0xd6,
+0x10,0x00,0x0e,0x04,0xf0,0x01,0x04,0x00,0x1e,0xcb,0xe6,0x4c,0xd2,0x0c,0xb1,0x06,
+0xfa,0x30,0x02,0x90,0x09,0xbe,0xf3,0x00,0x20,0x71,0xe0,0x3e,0x07,0x10,0x03,0x75,
+0x04,0x90,0x84,0x45,0x74,0x00,0x00,0x18,0xab,0xa9,0x40,0x2a,0x00,0x00,0x01,0x00,
+0x11,0x4e,0xde,0x02,0x11,0xc6,0x94,0x05,0x12,0xd0,0xe3,0x05,0x01,0x09,0x06,0x10,
+0x8a,0x39,0x01,0xf1,0x0d,0xdd,0x59,0xb0,0x00,0x00,0x05,0xe1,0x02,0xd0,0x00,0x92,
+0x0d,0x50,0x02,0xe0,0x01,0xf1,0x4e,0x00,0x01,0xf1,0x1b,0x80,0xa8,0x00,0x00,0xaf,
+0xf9,0x86,0x03,0x03,0x7b,0x06,0xf3,0x04,0xbf,0xff,0xff,0xff,0xf1,0x00,0x00,0x20,
+0x0a,0x80,0x00,0x03,0xd0,0x9b,0x00,0x00,0x04,0xc2,0x90,0xdf,0x00,0x01,0x4e,0x00,
+0x10,0xaa,0x85,0x00,0x15,0x90,0x7f,0x02,0xc2,0x11,0x11,0x11,0x11,0x10,0x5e,0xee,
+0xee,0xee,0xef,0xe0,0x00,0x09,0x05,0x21,0x00,0x3c,0xb0,0x06,0x30,0x3d,0x1d,0x90,
+0xc5,0x00,0x12,0x04,0x1a,0x03,0x00,0x01,0x00,0x20,0xd5,0x00,0xf5,0x05,0x10,0xc0,
+0x6b,0x00,0x11,0xbd,0xbc,0x06,0x13,0x81,0x45,0x00,0x20,0x02,0x90,0x9d,0x05,0x00,
+0x31,0x05,0xe1,0xe5,0x00,0x00,0x07,0xef,0x30,0x00,0x3b,0xfa,0x2e,0x20,0x00,0x16,
+0x10,0x32,0x08,0x07,0x05,0x00,0x16,0x30,0x75,0x01,0x20,0x03,0xe2,0xec,0x05,0x10,
+0xe7,0x51,0x00,0x00,0x65,0x08,0xd1,0x7e,0xf1,0x00,0x00,0x49,0xeb,0x6e,0x00,0x00,
+0x7e,0x82,0x03,0xe0,0xeb,0x05,0x05,0x9b,0x05,0x08,0x0b,0x00,0x14,0x16,0x2d,0x07,
+0x60,0x10,0x01,0xf1,0x00,0x10,0x2f,0xb6,0x00,0x10,0x61,0x19,0x00,0xb1,0xe3,0x1e,
+0x00,0x00,0x00,0x2f,0x02,0xf0,0x00,0x00,0x08,0xcd,0x01,0x10,0xe4,0x05,0x00,0x10,
+0xcb,0x37,0x00,0x00,0x77,0x09,0x20,0x5b,0xe7,0x0a,0x00,0x40,0x60,0x00,0x00,0x00,
+0xe8,0x00,0x53,0x60,0x01,0x01,0xf0,0x01,0xc1,0x08,0x09,0x05,0x00,0x00,0x57,0x09,
+0x12,0xff,0x2e,0x06,0xb0,0x1e,0xdd,0xdd,0xdd,0xdd,0x30,0x32,0x23,0xf2,0x22,0x30,
+0x8d,0x02,0x14,0x00,0x47,0x06,0x0a,0x0b,0x00,0x70,0x0c,0xdd,0xdd,0xfd,0xdd,0xdc,
+0x33,0x01,0x00,0x60,0x30,0x00,0x00,0x09,0x20,0x00,0x75,0x04,0xf3,0x0f,0x9f,0xee,
+0xff,0xfe,0xe0,0x00,0x09,0xf3,0x00,0x00,0x07,0xcb,0x40,0x00,0x09,0xd1,0xa4,0x00,
+0x3d,0xa1,0x0a,0x40,0x09,0x60,0x00,0xb4,0x00,0x00,0x08,0xef,0x77,0x05,0x03,0x7a,
+0x09,0xe1,0x00,0x0b,0x40,0x00,0x09,0xfe,0xee,0xef,0xfe,0xf7,0x00,0x00,0x00,0x8f,
+0xa4,0x0a,0x10,0xdb,0x06,0x00,0xf0,0x06,0x6d,0x2a,0x50,0x00,0x00,0x1b,0xc1,0x0a,
+0x60,0x00,0x06,0xe8,0x00,0x0a,0x60,0x00,0x08,0x30,0x00,0x0a,0x60,0x9d,0x01,0x20,
+0xdf,0x40,0x80,0x00,0x10,0x21,0x3b,0x00,0x13,0xc5,0x27,0x07,0x50,0x8f,0xee,0xff,
+0xee,0xfc,0x26,0x07,0x10,0x3d,0xc2,0x05,0x10,0x3c,0xe9,0x01,0x10,0x4b,0x6a,0x01,
+0xf4,0x02,0x69,0x00,0xab,0x00,0x00,0x87,0x07,0xe1,0x00,0x00,0xd4,0x7e,0x20,0x08,
+0xff,0xd0,0x01,0x37,0x0b,0x80,0x02,0x40,0x00,0x00,0xe3,0x00,0x84,0xb1,0xcc,0x09,
+0xf0,0x05,0x07,0x10,0xae,0xee,0xfe,0xee,0xec,0x00,0x11,0x13,0xe1,0x11,0x4d,0x00,
+0x00,0x05,0xb0,0x00,0x3c,0x00,0x12,0x06,0x10,0x4b,0x72,0x0b,0x00,0xcc,0x0b,0xf0,
+0x01,0xa9,0x00,0x00,0x87,0x00,0x08,0xd0,0x00,0x00,0xd4,0x00,0x9d,0x20,0x0a,0xee,
+0xd0,0x52,0x07,0x15,0x22,0x3c,0x07,0x21,0x0f,0x20,0x8a,0x00,0xc1,0x25,0x84,0x02,
+0x68,0xbe,0xfd,0xb8,0x30,0x5a,0x85,0x7b,0x00,0x1c,0x08,0x00,0x6a,0x00,0xd5,0x2f,
+0x79,0xcf,0x85,0xac,0xfd,0xea,0x63,0x10,0x36,0x30,0x09,0x70,0xb4,0x03,0x02,0xc7,
+0x01,0x10,0x07,0x05,0x00,0x11,0x46,0x01,0x01,0x10,0x80,0xf5,0x00,0xf3,0x06,0xfc,
+0xbb,0xcc,0x10,0x02,0xe5,0x22,0x26,0xe0,0x03,0xe5,0x00,0x00,0x99,0x05,0xe5,0x00,
+0x00,0x1f,0x20,0x02,0x1d,0x00,0x20,0x08,0xd0,0x55,0x06,0xb6,0xd2,0x00,0x00,0x00,
+0x3c,0xd1,0x00,0x00,0x01,0xce,0x70,0x39,0x06,0x03,0x11,0x02,0xf0,0x01,0xc3,0x00,
+0x85,0xb2,0x00,0x00,0x6d,0x00,0x01,0x91,0x10,0x00,0x1e,0xee,0xee,0xf9,0x2e,0x08,
+0x00,0xc8,0x02,0x20,0x1c,0x90,0x6f,0x00,0x23,0x0d,0x70,0x78,0x08,0x21,0x00,0x6d,
+0x06,0x00,0x11,0x5e,0xba,0x00,0x20,0x6f,0x40,0x7f,0x02,0x20,0xcd,0x30,0x61,0x00,
+0x19,0xe7,0x46,0x0b,0x00,0x98,0x01,0x00,0x24,0x05,0x02,0xe0,0x08,0x00,0xb6,0x02,
+0xc0,0xff,0xff,0xff,0xfd,0x00,0x9b,0x00,0x0c,0x60,0x11,0x07,0xe1,0xc9,0x02,0x41,
+0x0a,0x30,0x00,0x2f,0x2b,0x00,0x11,0x8a,0x2b,0x00,0x01,0x8e,0x0a,0x20,0x1d,0x80,
+0x97,0x00,0x17,0xe9,0x57,0x08,0x23,0x00,0x00,0x1a,0x07,0x20,0x42,0x90,0x08,0x05,
+0xf0,0x09,0x06,0x7a,0x20,0x00,0x99,0x00,0x00,0x06,0x00,0x00,0x0e,0xdc,0xcc,0xcc,
+0xc9,0x00,0x09,0xb3,0x33,0xe6,0x33,0x20,0x07,0xe1,0x82,0x09,0x23,0x01,0xd3,0x18,
+0x01,0x00,0x22,0x00,0x00,0xc9,0x02,0x15,0x20,0x53,0x00,0x36,0x00,0x4e,0xa0,0x96,
+0x00,0x01,0x01,0x00,0xa4,0xcf,0xee,0xee,0xee,0xf0,0x11,0x11,0x11,0x13,0xf0,0x8b,
+0x02,0x0d,0x05,0x00,0x91,0xde,0xdd,0xdd,0xde,0xf0,0x32,0x22,0x22,0x24,0xcd,0x02,
+0x00,0xd0,0x03,0x50,0x04,0xc0,0x00,0x00,0x3d,0x06,0x00,0xc0,0x33,0x5d,0x33,0x36,
+0xd3,0x31,0xbc,0xdf,0xcc,0xcd,0xfc,0xc4,0x12,0x00,0x10,0xb0,0x18,0x00,0x20,0x06,
+0xa0,0x06,0x00,0x11,0x08,0x5e,0x0c,0x11,0x0e,0x71,0x04,0x10,0x8c,0x05,0x00,0x20,
+0x3b,0xd1,0x06,0x00,0x17,0x77,0xce,0x00,0xf1,0x0c,0x91,0x00,0x1b,0x44,0xa0,0x00,
+0x0e,0x20,0x02,0xe1,0xa7,0x01,0x10,0xe3,0x00,0x3e,0x02,0x00,0x8e,0xef,0xee,0xee,
+0xfe,0xe7,0x00,0x00,0xd2,0x36,0x06,0x41,0x0d,0x20,0x03,0xd0,0x2d,0x0c,0x11,0x5b,
+0xa5,0x01,0x02,0x1a,0x0b,0x21,0x04,0xf2,0xf3,0x01,0x11,0xf5,0x0c,0x00,0x10,0xb2,
+0x06,0x00,0x30,0x69,0x10,0x00,0x3c,0x0d,0x01,0x6a,0x00,0x40,0x44,0x00,0x00,0x06,
+0x15,0x00,0xc0,0x27,0x07,0xf6,0x00,0x00,0x0d,0x80,0x02,0x30,0x00,0x0b,0xa0,0xfa,
+0x08,0x00,0x66,0x04,0xb7,0x5f,0x80,0x00,0x00,0x16,0xde,0x40,0x00,0x00,0xbf,0xc5,
+0xdf,0x04,0x01,0xc8,0x02,0xf0,0x03,0x76,0x00,0x02,0x56,0x80,0x00,0x3c,0xc2,0x00,
+0xd1,0xb1,0x00,0x00,0x83,0x00,0x43,0x00,0x78,0x72,0x00,0xd0,0x40,0x2a,0xe4,0x00,
+0x00,0x1e,0x60,0x00,0x53,0x00,0x00,0xc9,0x00,0x55,0x06,0x10,0xb0,0x5e,0x02,0x10,
+0xf8,0x05,0x00,0x00,0x47,0x00,0x30,0x0c,0xfd,0x60,0x84,0x00,0x11,0x20,0x44,0x00,
+0xa0,0x11,0x11,0x11,0x20,0x00,0x8f,0xff,0xff,0xff,0x30,0x9e,0x00,0x15,0xc0,0x36,
+0x04,0x20,0x9b,0x00,0x7a,0x00,0x00,0x6c,0x00,0x20,0x6e,0xcb,0x99,0x04,0xe0,0x30,
+0xcb,0x00,0x03,0xcd,0x20,0x00,0xcb,0x06,0xf7,0x00,0x00,0x01,0xd6,0x43,0x03,0x17,
+0x01,0x12,0x01,0x11,0x62,0x9f,0x01,0x70,0x58,0x92,0x0c,0xee,0xee,0xee,0xe4,0x55,
+0x00,0x21,0x1b,0x90,0xc2,0x01,0x15,0x10,0xef,0x0a,0x11,0x07,0xc8,0x05,0x20,0x7e,
+0xe5,0x50,0x02,0x30,0xd2,0x4f,0x50,0x92,0x04,0xb1,0x04,0xf5,0x00,0x9f,0x70,0x00,
+0x00,0x5f,0x20,0x21,0x00,0xf9,0x05,0x12,0x01,0x0f,0x09,0x12,0xf0,0x06,0x00,0xc1,
+0x14,0x7b,0xe4,0x03,0x58,0xfe,0xea,0x78,0xd0,0x1e,0xa7,0xf1,0xb2,0x05,0x11,0xf0,
+0x8f,0x05,0x35,0xf0,0x01,0x90,0x24,0x00,0x11,0xf4,0x4a,0x07,0xa0,0x8f,0xee,0xff,
+0xd0,0x00,0x00,0x00,0x11,0x10,0x00,0x16,0x00,0x01,0x00,0xf0,0x19,0x42,0xb0,0x00,
+0x02,0xf0,0x00,0x04,0x97,0x40,0x00,0x2e,0x00,0x00,0x05,0x00,0x00,0x01,0xe0,0x14,
+0x8b,0xe3,0x00,0x35,0x9f,0xed,0xa7,0x9d,0x00,0x3e,0xb9,0xe1,0x00,0x1e,0x30,0x00,
+0x00,0x1e,0x00,0x0c,0x70,0x1a,0x00,0x30,0x02,0x90,0x00,0x0d,0x00,0x00,0x01,0x00,
+0xf0,0x1f,0x01,0xf1,0x00,0x00,0x10,0x00,0x00,0x0b,0xec,0xce,0xfd,0x00,0x00,0x00,
+0x02,0x33,0x31,0x00,0x00,0x02,0x00,0x00,0x00,0x26,0x02,0xf2,0x00,0x00,0x05,0xd0,
+0x09,0xc0,0x00,0x00,0x99,0x00,0x1e,0x50,0x00,0x0d,0x40,0x00,0x67,0x00,0x05,0xe0,
+0x32,0x00,0x10,0xd6,0x05,0x00,0x10,0x9d,0x05,0x00,0xd2,0x7e,0x10,0x00,0x00,0x02,
+0xbe,0x30,0x00,0x00,0x03,0xfa,0x10,0x00,0x38,0x00,0x07,0x01,0x00,0x20,0x73,0x90,
+0x06,0x00,0xd1,0x95,0x91,0x5b,0x00,0x00,0x00,0x66,0x00,0x0e,0x60,0x00,0x00,0xb7,
+0x42,0x00,0x70,0xf2,0x00,0x00,0xc6,0x00,0x05,0xd0,0x77,0x00,0x20,0x0d,0x50,0x23,
+0x00,0x10,0x8d,0x05,0x00,0x20,0x06,0xe2,0x06,0x00,0x70,0x7f,0x40,0x00,0x00,0x00,
+0x4d,0xd3,0x0b,0x00,0x12,0x27,0x46,0x00,0x10,0x57,0x05,0x00,0xf0,0x10,0x0c,0x60,
+0x00,0x00,0x00,0x07,0xfe,0xee,0xef,0x20,0x04,0xe2,0x00,0x04,0xe0,0x04,0xe3,0x00,
+0x00,0xa8,0x06,0xe3,0x1e,0x80,0x3f,0x10,0x11,0x00,0x1a,0xed,0x70,0x22,0x00,0xf0,
+0x00,0xfb,0x10,0x00,0x00,0x1c,0xb1,0x91,0x00,0x00,0x6e,0xa0,0x00,0x00,0x03,0xec,
+0x48,0x00,0x14,0x03,0x8a,0x00,0xf0,0x0a,0x01,0x17,0x00,0x00,0x00,0xd4,0x00,0x76,
+0xb2,0x00,0x00,0x6e,0x33,0x34,0xa1,0x00,0x00,0x2e,0xbb,0xbb,0xec,0x00,0x00,0x1d,
+0x60,0x59,0x00,0xb0,0x2d,0x81,0x20,0x03,0xf0,0x00,0x0d,0x60,0x5e,0x91,0xc7,0x2c,
+0x00,0x21,0x1a,0xfe,0x33,0x00,0x20,0x6e,0xea,0x06,0x00,0x70,0x8e,0x21,0x30,0x00,
+0x00,0x06,0xdc,0xdd,0x00,0x28,0x09,0xc4,0xdc,0x00,0x90,0x01,0x23,0x69,0xd3,0x00,
+0xae,0xdc,0xfa,0x63,0x7b,0x00,0x10,0x30,0x12,0x00,0xf0,0x02,0xc3,0x00,0x00,0xdf,
+0xee,0xef,0xfe,0xef,0xd1,0x00,0x00,0xe3,0x00,0x01,0x00,0x00,0x1f,0x15,0x00,0x70,
+0x08,0xa0,0x00,0x00,0x00,0x05,0xe2,0x3f,0x00,0x10,0xe4,0x10,0x00,0x11,0x31,0x3d,
+0x00,0xf0,0x17,0x02,0x20,0x00,0x05,0x50,0x6a,0x00,0x4c,0x4d,0x00,0xf0,0x08,0x90,
+0xd3,0x06,0x10,0xd3,0x03,0x10,0x00,0x7c,0x00,0x00,0x00,0x3e,0x20,0x00,0x00,0x4e,
+0x40,0x00,0x03,0xae,0x40,0x00,0x00,0xb8,0x10,0x2a,0x00,0xf0,0x0a,0x91,0x00,0x01,
+0x07,0x70,0x0a,0x70,0x00,0xb8,0x3e,0x00,0x4d,0x00,0x0f,0x30,0xc5,0x00,0xd1,0x03,
+0xe0,0x06,0x70,0x00,0x00,0xb8,0x1d,0x00,0x10,0x4e,0x05,0x00,0x20,0x2e,0x60,0x39,
+0x00,0x00,0xd5,0x01,0x74,0x8f,0x60,0x00,0x00,0x05,0xfb,0x30,0xf8,0x00,0xb2,0x02,
+0xcc,0xcc,0xcc,0xc6,0x00,0x03,0x33,0x33,0x33,0x10,0xb2,0x00,0x10,0x11,0x01,0x00,
+0x81,0xae,0xee,0xef,0xfe,0xee,0xd0,0x00,0x00,0xcd,0x00,0x11,0x0e,0x2d,0x00,0x01,
+0xd4,0x01,0x10,0xc8,0x32,0x00,0x10,0xbb,0x0a,0x00,0x14,0x68,0xe3,0x00,0xe8,0x11,
+0x90,0x01,0x33,0x33,0x33,0x5a,0x67,0x04,0xcb,0xbb,0xbc,0x67,0x10,0xfd,0x00,0x91,
+0xef,0xff,0xff,0xff,0xff,0xb0,0x00,0x00,0x0f,0x16,0x00,0x11,0x1f,0x14,0x00,0x11,
+0x6c,0x64,0x00,0x10,0xd5,0x06,0x00,0x11,0x3d,0xf8,0x01,0x10,0x96,0x05,0x00,0xf2,
+0x0a,0xe4,0x00,0x00,0x0d,0x30,0x00,0x00,0xd3,0x00,0x00,0x0d,0x81,0x00,0x00,0xdd,
+0xfb,0x60,0x0d,0x31,0x7d,0xe6,0xd3,0x00,0x05,0x5d,0x15,0x00,0x74,0x0e,0x40,0x00,
+0x00,0x62,0x00,0x00,0x88,0x02,0xc0,0x35,0x70,0x0f,0x10,0x0c,0x2c,0x10,0xf0,0x00,
+0x46,0x00,0x0f,0x19,0x02,0xe0,0xfd,0xfa,0x30,0x00,0x0f,0x13,0x9f,0xd4,0x00,0xf0,
+0x00,0x07,0x30,0x0f,0x25,0x00,0x23,0xf0,0x00,0x76,0x00,0x11,0x71,0x34,0x00,0x02,
+0x3f,0x02,0x11,0xc5,0x22,0x02,0x30,0x50,0x00,0x0c,0x97,0x00,0x20,0xfe,0x00,0xab,
+0x02,0x10,0x00,0x66,0x02,0x00,0x19,0x01,0x00,0x05,0x00,0x20,0x0b,0x90,0x8a,0x01,
+0x10,0xd1,0x25,0x00,0x10,0xd2,0x10,0x00,0x11,0x40,0x1f,0x01,0xbf,0x22,0x22,0x22,
+0x31,0x00,0xbe,0xee,0xee,0xee,0x40,0x00,0x01,0x00,0x07,0x10,0x0e,0x53,0x00,0x20,
+0xf6,0x22,0x01,0x00,0xf1,0x03,0x10,0x00,0x00,0x0f,0x20,0x00,0x00,0x04,0x33,0x3f,
+0x43,0x31,0x00,0x0c,0xcb,0xbb,0xbc,0xf7,0x5c,0x00,0x10,0xa0,0xbb,0x00,0x11,0xca,
+0x32,0x02,0xf0,0x01,0x81,0x00,0x00,0x01,0x6d,0xcf,0x16,0xe6,0x00,0xaf,0xa4,0x0f,
+0x10,0x3d,0xb0,0x10,0xaa,0x00,0x14,0x30,0x26,0x01,0x13,0x0c,0x42,0x01,0x10,0x82,
+0x73,0x01,0x10,0xf1,0x91,0x00,0x22,0xb0,0x00,0x01,0x01,0x20,0x00,0x7d,0x43,0x00,
+0xfc,0x04,0xf3,0x00,0x00,0x00,0x2d,0x90,0x00,0x00,0x02,0xe9,0x00,0x00,0x01,0x9f,
+0x80,0x00,0x00,0x0d,0xc3,0x8d,0x00,0x30,0x0b,0x30,0x4d,0x07,0x00,0x30,0xf1,0x00,
+0xd5,0x65,0x01,0xa1,0x00,0x06,0xc0,0x00,0x00,0x08,0x90,0x00,0x0f,0x30,0x67,0x01,
+0x80,0x9a,0x00,0x00,0x5d,0x00,0x00,0x03,0xf0,0x09,0x01,0x60,0x00,0x0e,0x50,0x06,
+0xd0,0x00,0x14,0x00,0x10,0x94,0x6e,0x00,0x11,0x90,0x3e,0x00,0x11,0x15,0x06,0x00,
+0xf0,0x09,0x85,0xb1,0x00,0x00,0x91,0x05,0x70,0xa2,0x10,0x00,0x2f,0x00,0x2f,0x10,
+0x00,0x00,0x05,0xc0,0x00,0xa8,0x00,0x00,0x00,0xa7,0x07,0x02,0x00,0xe0,0x00,0x21,
+0x0d,0x60,0x9a,0x03,0x20,0x7c,0x00,0x65,0x00,0x21,0x02,0xf2,0x97,0x02,0x21,0x0c,
+0x70,0x52,0x01,0x17,0x7a,0x8b,0x00,0xf0,0x00,0x02,0x99,0x20,0x00,0x05,0x00,0x43,
+0x73,0x46,0x00,0x04,0xe0,0x07,0xc0,0x66,0x1d,0x00,0x00,0xcb,0x00,0x41,0x0b,0x60,
+0x00,0x7c,0xca,0x01,0x00,0xcf,0x00,0x51,0x6b,0x00,0x00,0x0a,0xa0,0x17,0x00,0x30,
+0x4f,0x10,0x07,0xed,0x00,0x11,0xe6,0xe5,0x00,0x21,0x0a,0xb0,0x27,0x04,0x11,0x10,
+0xf4,0x01,0xf0,0x0f,0x44,0x04,0xa0,0x00,0x00,0xb3,0xc0,0x4c,0x00,0x00,0x03,0x72,
+0x04,0xc0,0x00,0x04,0xb1,0x00,0x4c,0x04,0x8e,0xc6,0x00,0x04,0xff,0xc7,0x20,0x00,
+0x00,0x4d,0x24,0x00,0x20,0x04,0xc0,0x29,0x00,0x23,0x4c,0x00,0xaa,0x02,0xe0,0x01,
+0x00,0x0b,0xfd,0xcd,0xef,0xd0,0x00,0x01,0x23,0x32,0x10,0x00,0x13,0x89,0x00,0xf5,
+0x09,0x24,0xc0,0x00,0x00,0x73,0x37,0x4c,0x00,0x00,0x18,0x76,0x04,0xc0,0x15,0xbe,
+0x91,0x00,0x4e,0xce,0xa5,0x00,0x00,0x04,0xd3,0x37,0x00,0x02,0x42,0x00,0x11,0x3e,
+0x74,0x00,0xc0,0xcf,0xdc,0xde,0xfd,0x00,0x00,0x12,0x33,0x21,0x00,0x00,0x02,0x0f,
+0x03,0x80,0x01,0xff,0xee,0xee,0xef,0xf1,0x00,0x00,0x3d,0x01,0x00,0xa5,0x03,0x01,
+0x2b,0x01,0x10,0xe3,0x05,0x00,0x10,0x8b,0x05,0x00,0x10,0x4f,0x21,0x03,0xc0,0x5f,
+0x50,0x00,0x00,0x02,0xaf,0x50,0x00,0x00,0x09,0xfa,0x20,0xb4,0x00,0x0a,0x95,0x01,
+0x11,0x82,0x5e,0x00,0x71,0x49,0x54,0x4f,0xff,0xff,0xff,0xfc,0x65,0x03,0x11,0x8b,
+0x18,0x00,0x13,0xb6,0x5c,0x05,0x00,0xf2,0x00,0x11,0x90,0x4c,0x00,0x10,0x10,0x0b,
+0x04,0x20,0xf4,0x00,0xdf,0x01,0x00,0x4f,0x01,0x20,0xbf,0xb2,0x16,0x00,0x14,0x21,
+0x48,0x00,0x21,0x06,0x95,0x81,0x00,0x20,0x09,0x2f,0x72,0x02,0x10,0x96,0x48,0x00,
+0x11,0x6d,0x18,0x00,0x25,0x98,0x00,0x93,0x00,0x11,0x08,0x6b,0x00,0x20,0x3f,0x30,
+0xd4,0x00,0x20,0xf6,0x00,0xf2,0x03,0x00,0xff,0x02,0x20,0x9f,0xb3,0x16,0x00,0x13,
+0x12,0x98,0x01,0x02,0x29,0x02,0x11,0xfa,0x4c,0x00,0x20,0xc2,0xcb,0x58,0x00,0xf1,
+0x02,0xe1,0x00,0xca,0x00,0x00,0x05,0xf3,0x00,0x01,0xd9,0x00,0x00,0xe6,0x00,0x00,
+0x01,0xe8,0xc2,0x00,0x31,0x02,0xf6,0x00,0x1c,0x01,0x17,0xf1,0x37,0x00,0x02,0x19,
+0x03,0xf1,0x06,0x06,0x3b,0x40,0x00,0x00,0x9e,0x40,0x3c,0x29,0x00,0x00,0x7c,0x6e,
+0x50,0x50,0x00,0x00,0x5e,0x10,0x3e,0x50,0x77,0x00,0x91,0x3f,0x40,0x00,0x1f,0x70,
+0x00,0x00,0x5f,0x30,0x29,0x00,0x21,0x7e,0x20,0x34,0x00,0x12,0x9e,0x3b,0x00,0x11,
+0x50,0x3b,0x00,0x11,0x60,0x06,0x00,0xf1,0x0b,0x55,0x60,0x00,0x00,0xad,0x30,0x72,
+0x27,0x00,0x00,0xab,0x6e,0x41,0x88,0x10,0x00,0x7d,0x00,0x4f,0x40,0x00,0x00,0x5e,
+0x20,0x00,0x5f,0x44,0x00,0x31,0x00,0x6e,0x20,0x41,0x00,0x12,0x8e,0x41,0x00,0x16,
+0xad,0x41,0x00,0x12,0xf2,0x74,0x03,0x40,0x10,0x00,0x00,0x0a,0x06,0x01,0x10,0xf9,
+0x0d,0x00,0x11,0x20,0xd0,0x04,0x90,0xe1,0x03,0x00,0x00,0x03,0xe1,0x0e,0x10,0xc7,
+0x98,0x02,0xe0,0xe1,0x01,0xe2,0x00,0xb9,0x00,0x0e,0x10,0x07,0xc0,0x03,0x00,0x00,
+0xf1,0xbd,0x00,0x36,0x0c,0xdf,0x00,0x05,0x01,0x00,0x1a,0x01,0x11,0x14,0x98,0x04,
+0xa0,0x94,0xc1,0x00,0x00,0x01,0xf0,0x01,0x51,0x00,0xcf,0x4f,0x00,0x10,0x70,0x0d,
+0x00,0x01,0x7b,0x02,0x10,0x1f,0x7e,0x02,0xf1,0x0e,0x3e,0x01,0xf0,0x1e,0x20,0x00,
+0x0c,0x60,0x1f,0x00,0x6c,0x00,0x08,0xc0,0x01,0xf0,0x00,0xd6,0x00,0xb2,0x00,0x1f,
+0x00,0x04,0x70,0x00,0x00,0x45,0xf0,0x46,0x01,0x13,0xc7,0x4e,0x00,0x20,0x05,0x97,
+0x3a,0x00,0x20,0x09,0x09,0x06,0x00,0x21,0x02,0x83,0x66,0x04,0x13,0xf7,0x4c,0x00,
+0x44,0x01,0x01,0xf0,0x01,0x4b,0x00,0x51,0xc6,0x01,0xf0,0x06,0xc0,0x4a,0x00,0x40,
+0xd5,0x0b,0x20,0x01,0xc5,0x04,0x03,0x49,0x00,0x24,0xbc,0x70,0x98,0x00,0x70,0xaf,
+0xee,0xee,0xee,0xef,0xc0,0x10,0x7c,0x07,0x01,0x2b,0x01,0xf0,0x03,0xab,0x00,0x00,
+0x20,0x00,0x09,0xd1,0x00,0x00,0x9d,0x20,0x9d,0x10,0x00,0x00,0x07,0xeb,0xc1,0x16,
+0x00,0x12,0x6f,0x88,0x01,0x21,0xf3,0x00,0x63,0x07,0x22,0x00,0x00,0xd2,0x05,0xf1,
+0x0c,0x05,0xb8,0x52,0x00,0x00,0x15,0x8b,0xee,0xa3,0x00,0x00,0x00,0x37,0x20,0x52,
+0x00,0x00,0x00,0x1b,0xef,0xb7,0x30,0x00,0x00,0x15,0x9e,0x80,0x2f,0x00,0x00,0x8a,
+0x06,0x31,0x6a,0xdf,0xc8,0x12,0x00,0x13,0xd0,0xd4,0x01,0x21,0x08,0x80,0x3e,0x00,
+0x11,0xd5,0x06,0x00,0x11,0x2f,0x06,0x00,0x01,0x8a,0x03,0x00,0x81,0x07,0x10,0x01,
+0x23,0x01,0x31,0x10,0x07,0xc0,0x13,0x00,0x20,0x0d,0x50,0x47,0x05,0xe2,0x01,0x7e,
 0x00,0x06,0x8f,0xab,0xdf,0xfd,0xe7,0x00,0xa9,0x86,0x43,0x10,0xed,0x07,0x03,0x45,
-0x07,0x13,0x94,0x7f,0x0d,0x10,0x96,0xd3,0x06,0x30,0x03,0xdb,0x11,0x9d,0x00,0x21,
-0xae,0xba,0xd4,0x00,0x10,0x70,0x24,0x03,0x20,0x7f,0x70,0xb8,0x00,0xa8,0x3f,0x80,
-0x01,0xbe,0x40,0x00,0x3e,0x23,0xfa,0x10,0xab,0x0b,0x00,0xbb,0x0a,0x42,0xef,0xfe,
-0xef,0x90,0x4c,0x16,0x01,0xd3,0x01,0xb7,0x34,0x33,0xf5,0x33,0x34,0x28,0xbb,0xbf,
-0xcb,0xbb,0xb7,0x16,0x00,0x00,0x08,0x1f,0x00,0xb6,0x00,0x30,0xfd,0xee,0xf3,0x50,
-0x14,0x14,0x11,0x36,0x05,0xf0,0x03,0xa5,0x00,0x25,0x80,0x00,0x3a,0xdc,0xeb,0xcc,
-0x00,0xdc,0x9f,0x20,0x1d,0x30,0x00,0x00,0xd2,0x10,0x08,0x20,0x09,0x71,0x44,0x01,
-0x16,0x5b,0x41,0x09,0x25,0x0c,0x40,0x00,0x02,0x15,0x10,0xce,0x03,0x00,0x56,0x14,
-0xf1,0x02,0x15,0x87,0x00,0x03,0xf9,0xbe,0xda,0xe8,0x0d,0xfd,0xea,0x30,0x06,0xd0,
-0x03,0x10,0x7a,0x6a,0x07,0x31,0x3e,0x02,0xe5,0x04,0x07,0x15,0x10,0xca,0x15,0x26,
-0x06,0xc0,0xb5,0x03,0x01,0x62,0x06,0x96,0x34,0x33,0x34,0x00,0x00,0x0a,0xbb,0xbb,
-0xe7,0xb8,0x0d,0x12,0xe3,0x9f,0x14,0x00,0xce,0x18,0x40,0xe0,0x10,0x0f,0xee,0x0e,
-0x1d,0xb3,0x07,0xed,0xdd,0xde,0xd1,0x00,0x01,0x22,0x22,0x25,0xf0,0x71,0x00,0x06,
-0x23,0x14,0x13,0x90,0x3a,0x19,0x02,0xec,0x05,0x00,0x6e,0x04,0x30,0xfe,0xf0,0x21,
-0x7a,0x04,0x02,0x8b,0x0a,0x44,0xfe,0xee,0xee,0xf0,0xef,0x14,0x55,0xf0,0x0c,0xee,
-0xee,0xef,0xe5,0x06,0x24,0x03,0xee,0x1b,0x00,0x10,0x11,0x95,0x08,0x00,0x69,0x00,
-0x04,0x7d,0x15,0x69,0x2e,0x01,0x11,0x11,0x13,0xe4,0x12,0x00,0x92,0x22,0x11,0x11,
-0x14,0xec,0xed,0xdd,0xdd,0xee,0xc7,0x03,0x41,0xed,0xdd,0xdd,0xd6,0xe2,0x06,0x12,
-0x10,0xdf,0x03,0x00,0xd4,0x0e,0x10,0xd3,0x10,0x00,0x15,0x4f,0x95,0x08,0x02,0x86,
-0x0f,0x00,0x02,0x01,0x20,0x29,0xe4,0x8e,0x04,0x17,0x91,0xdb,0x04,0x00,0xdc,0x02,
-0x60,0x01,0xf0,0x1f,0x00,0x00,0x0f,0xe5,0x02,0x04,0x09,0x00,0x01,0x12,0x00,0x21,
-0x2e,0x00,0x51,0x23,0x41,0x00,0x01,0xe3,0x00,0x0e,0x13,0x23,0x0c,0xe6,0x52,0x14,
-0x31,0x39,0x00,0xb1,0x71,0x05,0x11,0xe2,0x33,0x1b,0x06,0x06,0x00,0x31,0x5a,0x00,
-0xe2,0x46,0x10,0xf0,0x05,0xe2,0x00,0x20,0x00,0xb6,0x00,0xe2,0x01,0xe5,0x02,0xf1,
-0x00,0xe2,0x2d,0x70,0x0c,0x80,0x00,0xe9,0xf6,0x72,0x0b,0x23,0xfb,0x20,0x0e,0x06,
+0x07,0x21,0x94,0x00,0x2f,0x00,0x20,0x00,0x96,0xd3,0x06,0x30,0x03,0xdb,0x11,0x9d,
+0x00,0x21,0xae,0xba,0xd4,0x00,0x10,0x70,0x24,0x03,0x20,0x7f,0x70,0xb8,0x00,0x81,
+0x3f,0x80,0x01,0xbe,0x40,0x00,0x3e,0x23,0x0e,0x08,0x17,0x03,0x26,0x03,0x93,0xcf,
+0xef,0xfe,0xef,0x90,0x00,0x00,0xe2,0x00,0xd3,0x01,0xb7,0x34,0x33,0xf5,0x33,0x34,
+0x28,0xbb,0xbf,0xcb,0xbb,0xb7,0x16,0x00,0x31,0x00,0x00,0xe5,0xe8,0x02,0x84,0xfd,
+0xee,0xf3,0x00,0x00,0x01,0x22,0x11,0x36,0x05,0xf0,0x03,0xa5,0x00,0x25,0x80,0x00,
+0x3a,0xdc,0xeb,0xcc,0x00,0xdc,0x9f,0x20,0x1d,0x30,0x00,0x00,0xd2,0x10,0x08,0x20,
+0x09,0x71,0x44,0x01,0x24,0x5b,0x00,0x18,0x06,0x35,0x00,0x0c,0x40,0x00,0x02,0x16,
+0x10,0xce,0x03,0xf1,0x05,0x04,0xd0,0x00,0x15,0x87,0x00,0x03,0xf9,0xbe,0xda,0xe8,
+0x0d,0xfd,0xea,0x30,0x06,0xd0,0x03,0x10,0x7a,0x6a,0x07,0x31,0x3e,0x02,0xe5,0x04,
+0x07,0x10,0x10,0xa3,0x03,0x11,0x70,0x44,0x01,0x16,0xc0,0xb5,0x03,0x01,0x62,0x06,
+0x93,0x34,0x33,0x34,0x00,0x00,0x0a,0xbb,0xbb,0xe7,0x62,0x06,0x04,0x8a,0x03,0x10,
+0x0f,0x4c,0x04,0xf3,0x05,0x03,0xe0,0x10,0x0f,0xee,0xee,0xee,0xee,0x10,0x07,0xed,
+0xdd,0xde,0xd1,0x00,0x01,0x22,0x22,0x25,0xf0,0x71,0x00,0x00,0x4c,0x00,0x15,0xb0,
+0x83,0x00,0x00,0x17,0x05,0x02,0xec,0x05,0x00,0x6e,0x04,0x30,0xfe,0xf0,0x21,0x7a,
+0x04,0x11,0x20,0x6b,0x00,0x31,0xfe,0xee,0xee,0xd3,0x06,0x01,0xc4,0x00,0x45,0x0c,
+0xee,0xee,0xef,0xe5,0x06,0x24,0x03,0xee,0x1b,0x00,0x10,0x11,0x95,0x08,0x00,0x69,
+0x00,0x00,0xd5,0x01,0x10,0xe0,0xf3,0x07,0x59,0x01,0x11,0x11,0x13,0xe4,0x12,0x00,
+0x92,0x22,0x11,0x11,0x14,0xec,0xed,0xdd,0xdd,0xee,0xc7,0x03,0x41,0xed,0xdd,0xdd,
+0xd6,0xe2,0x06,0x12,0x10,0xdf,0x03,0x50,0xdd,0xdd,0xdd,0xdd,0xd3,0x10,0x00,0x15,
+0x4f,0x95,0x08,0x20,0x03,0xe2,0xab,0x00,0x00,0x02,0x01,0x20,0x29,0xe4,0x8e,0x04,
+0x17,0x91,0xdb,0x04,0x00,0xdc,0x02,0x60,0x01,0xf0,0x1f,0x00,0x00,0x0f,0xe5,0x02,
+0x04,0x09,0x00,0x01,0x12,0x00,0xf0,0x06,0x2e,0x00,0x40,0x00,0x07,0xa0,0x00,0x00,
+0x01,0xe3,0x00,0x00,0x04,0xe8,0x00,0x00,0x0c,0xe6,0x00,0x00,0x00,0xcc,0x00,0x31,
+0x39,0x00,0xb1,0x71,0x05,0x00,0x57,0x00,0x17,0x4b,0x06,0x00,0x11,0x5a,0x06,0x00,
+0xf3,0x0d,0x79,0x00,0xe2,0x00,0x20,0x00,0xb6,0x00,0xe2,0x01,0xe5,0x02,0xf1,0x00,
+0xe2,0x2d,0x70,0x0c,0x80,0x00,0xe9,0xf6,0x00,0x9b,0x00,0x00,0xfb,0x20,0x0e,0x06,
 0x24,0x0a,0x10,0xdc,0x07,0x0a,0x05,0x00,0x10,0x02,0x05,0x00,0xf3,0x04,0xc8,0x0f,
 0x10,0x00,0x2d,0xa0,0x0f,0x10,0x18,0xf7,0x00,0x0f,0x59,0xfa,0x20,0x00,0x0f,0xe8,
 0x20,0xaf,0x00,0x10,0x1f,0x53,0x03,0x70,0x21,0xf1,0x11,0x11,0x11,0xe2,0x1f,0x65,
-0x01,0x10,0x21,0x35,0x01,0x0e,0x0b,0x00,0xa2,0xfe,0xee,0xee,0xee,0xf2,0x1f,0x11,
-0x11,0x11,0x1f,0x76,0x04,0x01,0xce,0x0b,0x20,0x03,0xff,0x44,0x1d,0x20,0x2e,0x00,
-0x14,0x26,0x60,0xe0,0x00,0x00,0x02,0xf0,0x2e,0xc9,0x08,0x23,0x01,0x50,0x70,0x0a,
-0x01,0x01,0x03,0x20,0x03,0xe3,0x05,0x1e,0x10,0xf4,0xa6,0x0f,0x10,0xa2,0x4b,0x01,
-0x12,0x30,0xc0,0x09,0x04,0x07,0x20,0x21,0x00,0x4e,0x2c,0x1b,0x22,0x2b,0x10,0x56,
-0x19,0x20,0x1d,0x50,0xd6,0x12,0x10,0x90,0x93,0x01,0x00,0x65,0x01,0x00,0x16,0x03,
-0x10,0x48,0x8b,0x0a,0x25,0xdf,0xa5,0x5f,0x01,0x10,0x55,0x01,0x00,0x80,0x2b,0xcc,
-0xcc,0xcc,0xcc,0xc5,0x2c,0xcc,0x01,0x00,0x11,0x80,0x47,0x10,0x42,0x32,0x00,0x00,
-0x05,0xf1,0x0d,0x12,0x5a,0x75,0x04,0x09,0x0d,0x00,0x3e,0xfe,0xee,0xe5,0x1a,0x00,
-0x0b,0x0d,0x00,0x71,0x0c,0xcc,0xcd,0xec,0xcc,0xcc,0x60,0xad,0x08,0x30,0x21,0x3e,
-0xee,0x01,0x00,0x13,0x30,0x03,0x07,0x03,0x04,0x07,0x31,0x00,0x4f,0x81,0x0d,0x00,
-0x21,0xd9,0xe7,0x1d,0x07,0x31,0x02,0xcd,0x20,0x1a,0x00,0x2b,0x72,0x00,0x27,0x00,
-0x07,0x0d,0x00,0x20,0x0f,0xff,0x01,0x00,0x05,0xc5,0x06,0x12,0x05,0xe2,0x02,0x20,
-0xef,0x56,0x06,0x00,0xf1,0x03,0xe4,0xf1,0xbb,0x10,0x00,0x07,0xe3,0x0f,0x00,0x7e,
-0x30,0x1d,0xb1,0x00,0xf0,0x00,0x4f,0x20,0xf1,0x19,0x15,0x20,0xad,0x0c,0x25,0x0f,
-0x00,0x9d,0x03,0x14,0x2e,0x90,0x00,0x11,0x0e,0x5b,0x0a,0xf1,0x0e,0x12,0xe1,0x11,
-0x10,0x00,0x8e,0xdd,0xdf,0xdd,0xde,0x90,0x08,0x50,0x00,0xe0,0x00,0x59,0x00,0x85,
-0x66,0x0e,0x07,0x55,0x90,0x08,0x56,0x60,0xe0,0x85,0x0d,0x00,0xb0,0x08,0x55,0x90,
-0x08,0x55,0xdd,0xdd,0xd4,0x59,0x00,0x85,0xca,0x1e,0x00,0x27,0x00,0x33,0x00,0x2d,
-0xe5,0xb6,0x0c,0x00,0xdd,0x13,0xf2,0x08,0x00,0xac,0xcc,0xcf,0xcc,0xcc,0x8d,0x32,
-0x23,0xe2,0x22,0x6b,0xd1,0x00,0x1e,0x00,0x04,0xbd,0x10,0x01,0xe0,0x00,0x4b,0x0b,
-0x00,0x10,0xff,0x43,0x1f,0x61,0x50,0x00,0x1e,0x00,0x01,0x30,0x2c,0x00,0x06,0x37,
-0x00,0x00,0x01,0x00,0x81,0x23,0x58,0x80,0x00,0x4d,0xdd,0xcf,0xa8,0x57,0x20,0x11,
-0xe0,0xde,0x27,0xf2,0x02,0xdf,0xdd,0xfd,0x80,0x00,0x0c,0x10,0xe0,0x2c,0x00,0x03,
-0xdd,0xfe,0xdf,0xde,0xfd,0xd3,0x0d,0x00,0xf0,0x0d,0x00,0x7b,0xfb,0xbf,0xbb,0xfb,
-0x80,0x01,0x22,0x7e,0xfe,0x62,0x21,0x00,0x01,0x9c,0x2e,0x2d,0x81,0x00,0x1a,0xe8,
-0x00,0xe0,0x09,0xe9,0x10,0x71,0x16,0x1c,0x02,0x60,0x05,0x10,0x0a,0xdc,0x00,0x01,
-0xda,0x07,0x10,0xd8,0x18,0x01,0x10,0xd6,0x13,0x00,0x15,0xc2,0x97,0x04,0x2f,0x0f,
-0x00,0x0b,0x00,0x05,0x40,0x07,0xee,0xa0,0x00,0xc0,0x20,0x00,0x84,0x00,0x40,0x03,
-0xd0,0x70,0x0e,0x13,0x1e,0xf0,0x1c,0x0d,0x10,0xe0,0x27,0x00,0x4f,0x10,0xd1,0x0f,
-0xcd,0xe0,0x1e,0xf0,0x0e,0xae,0xf3,0x0e,0x08,0x8d,0x4c,0xf7,0x0e,0x00,0xd0,0x10,
-0xd2,0x3d,0x10,0xe0,0x1d,0x00,0x0d,0x00,0xd1,0x0e,0x14,0xb0,0x00,0xd0,0x0d,0x10,
-0xe5,0xa4,0x0d,0x00,0xf4,0x00,0x00,0x00,0x75,0x00,0xd0,0x0d,0x40,0x00,0x0b,0x40,
-0x0d,0x00,0x5c,0xdd,0xdd,0xdd,0x13,0x00,0x11,0x1f,0x11,0x86,0xd0,0x15,0x21,0x08,
-0x60,0xbf,0x1d,0x40,0x86,0x00,0x03,0xf3,0x1e,0x14,0x30,0x11,0xef,0x30,0x0d,0x00,
-0xc0,0x8a,0xc3,0x06,0x10,0x08,0x60,0x01,0x0c,0x30,0x7a,0x00,0x86,0xbb,0x0c,0x91,
-0xd3,0x08,0x60,0x00,0x0c,0x30,0x05,0x80,0x86,0xc8,0x0c,0x01,0x0d,0x00,0x01,0xc2,
-0x0b,0x5b,0xc3,0x00,0x3e,0xee,0x20,0x87,0x0a,0x30,0xc2,0x21,0x3b,0x80,0x0a,0x30,
-0x0a,0x53,0xb0,0x38,0x05,0x20,0xd2,0x3c,0xd0,0x0a,0xf0,0x13,0x2f,0xef,0xfe,0xea,
-0x00,0xdf,0x19,0x70,0x3b,0x00,0x00,0x7b,0xd1,0xa0,0x03,0xb0,0x00,0x01,0x1d,0x13,
-0x33,0x6c,0x33,0x30,0x00,0xd1,0xab,0xbc,0xeb,0xbb,0x30,0x0d,0x10,0x00,0x34,0x00,
-0x69,0xd1,0x00,0x03,0xb0,0x00,0x00,0x0d,0x00,0x06,0xec,0x1e,0x00,0x2b,0x0b,0xe0,
-0xe2,0x24,0x7a,0xec,0x40,0x00,0x8a,0x9b,0x9b,0xa0,0x00,0x00,0x2f,0x30,0x8b,0x0c,
-0xf1,0x07,0x1d,0xf2,0x00,0x06,0x80,0x00,0x0a,0xac,0x32,0x22,0x89,0x22,0x20,0x30,
-0xc6,0xcc,0xce,0xec,0xcc,0x20,0x0c,0x20,0xa5,0x0c,0x10,0xc2,0x1a,0x00,0x14,0x00,
-0x0d,0x00,0xa5,0x23,0x38,0xa3,0x33,0x00,0x0c,0x28,0xbb,0xbb,0xbb,0x56,0x00,0x32,
-0xb3,0x00,0xb4,0x29,0x0b,0x00,0x67,0x28,0xf0,0x0f,0x54,0xbb,0xcc,0xbb,0x70,0x06,
-0xf1,0x12,0x32,0x23,0x31,0x03,0xee,0x10,0x66,0x00,0x4b,0x00,0x75,0xd1,0x04,0x90,
-0x07,0x80,0x00,0x0d,0x10,0x1d,0x00,0x95,0x8f,0x00,0x90,0xe0,0x0c,0x20,0x00,0x0d,
-0x10,0x0c,0x20,0xe0,0x0d,0x00,0xc0,0x71,0x3a,0x00,0x00,0x0d,0x1a,0xaa,0xac,0xda,
-0xa1,0x00,0xd1,0x9f,0x03,0x10,0x00,0x8a,0x13,0xf0,0x19,0x26,0xb5,0x00,0x02,0xe0,
-0x9c,0xdf,0x94,0x00,0x00,0x96,0x0e,0x10,0xa3,0x00,0x00,0x3f,0x10,0xe0,0x09,0x50,
-0x00,0x1e,0xf1,0x0e,0x00,0x86,0x00,0x08,0x8d,0x10,0xfe,0xef,0xfe,0xe6,0x10,0xd1,
-0x0e,0x00,0x59,0xe4,0x00,0x91,0xe0,0x02,0xc0,0x00,0x00,0xd1,0x0e,0x00,0x0e,0x0d,
-0x00,0xf5,0x01,0x54,0xa4,0x37,0x00,0xd1,0x0e,0x68,0xb4,0xd9,0x60,0x0d,0x16,0xc7,
-0x28,0x07,0xc1,0x0c,0x14,0x00,0xb2,0x17,0x00,0x86,0x11,0x11,0xb3,0xc8,0x0c,0x00,
-0x0d,0x00,0xf2,0x22,0x5f,0x3e,0xee,0xff,0xee,0xe1,0x0e,0xf0,0x00,0x9f,0xe2,0x00,
+0x01,0x10,0x21,0x35,0x01,0x0e,0x0b,0x00,0xb2,0xfe,0xee,0xee,0xee,0xf2,0x1f,0x11,
+0x11,0x11,0x1f,0x20,0xe2,0x00,0x00,0x04,0x00,0x10,0x03,0xcb,0x03,0x20,0xf4,0x2e,
+0x69,0x00,0x70,0x22,0xe0,0x00,0x00,0x02,0xf0,0x2e,0xc9,0x08,0x23,0x01,0x50,0x70,
+0x0a,0x01,0x01,0x03,0x10,0x03,0xf1,0x01,0x10,0x18,0xb7,0x05,0x20,0x8f,0xa2,0x4b,
+0x01,0x12,0x30,0xc0,0x09,0x00,0xa7,0x03,0x11,0x50,0x85,0x09,0x10,0x80,0x00,0x01,
+0x40,0x2b,0x10,0x00,0x3d,0x0e,0x00,0x10,0x1d,0x14,0x00,0x20,0x1c,0x90,0x93,0x01,
+0x00,0x65,0x01,0x00,0x16,0x03,0x10,0x48,0x8b,0x0a,0x25,0xdf,0xa5,0x5f,0x01,0x10,
+0x55,0x01,0x00,0x80,0x2b,0xcc,0xcc,0xcc,0xcc,0xc5,0x2c,0xcc,0x01,0x00,0x20,0x80,
+0x33,0x01,0x00,0x51,0x32,0x00,0x00,0x05,0xa0,0x21,0x00,0x12,0x5a,0x75,0x04,0x09,
+0x0d,0x00,0x3e,0xfe,0xee,0xe5,0x1a,0x00,0x0b,0x0d,0x00,0x71,0x0c,0xcc,0xcd,0xec,
+0xcc,0xcc,0x60,0xad,0x08,0x30,0x21,0x3e,0xee,0x01,0x00,0x13,0x30,0x03,0x07,0x03,
+0x04,0x07,0x31,0x00,0x4f,0x81,0x0d,0x00,0x21,0xd9,0xe7,0x1d,0x07,0x31,0x02,0xcd,
+0x20,0x1a,0x00,0x2b,0x72,0x00,0x27,0x00,0x07,0x0d,0x00,0x20,0x0f,0xff,0x01,0x00,
+0x05,0xc5,0x06,0x12,0x05,0xe2,0x02,0x20,0xef,0x56,0x06,0x00,0xf0,0x04,0xe4,0xf1,
+0xbb,0x10,0x00,0x07,0xe3,0x0f,0x00,0x7e,0x30,0x1d,0xb1,0x00,0xf0,0x00,0x4f,0x20,
+0x50,0xca,0x02,0x14,0x20,0x90,0x03,0x02,0xd7,0x02,0x02,0x0d,0x00,0x14,0x2e,0x90,
+0x00,0x11,0x0e,0x5b,0x0a,0xf1,0x0e,0x12,0xe1,0x11,0x10,0x00,0x8e,0xdd,0xdf,0xdd,
+0xde,0x90,0x08,0x50,0x00,0xe0,0x00,0x59,0x00,0x85,0x66,0x0e,0x07,0x55,0x90,0x08,
+0x56,0x60,0xe0,0x85,0x0d,0x00,0xb0,0x08,0x55,0x90,0x08,0x55,0xdd,0xdd,0xd4,0x59,
+0x00,0x85,0x78,0x00,0x00,0x27,0x00,0x34,0x00,0x2d,0xe5,0xb6,0x0c,0xf2,0x0b,0x01,
+0xe0,0x00,0x00,0xac,0xcc,0xcf,0xcc,0xcc,0x8d,0x32,0x23,0xe2,0x22,0x6b,0xd1,0x00,
+0x1e,0x00,0x04,0xbd,0x10,0x01,0xe0,0x00,0x4b,0x0b,0x00,0x00,0xb5,0x00,0x71,0xfb,
+0x50,0x00,0x1e,0x00,0x01,0x30,0x2c,0x00,0x06,0x37,0x00,0x00,0x01,0x00,0x90,0x23,
+0x58,0x80,0x00,0x4d,0xdd,0xcf,0xa8,0x63,0x0d,0x00,0x10,0xe0,0x82,0x09,0xf2,0x03,
+0xfd,0xdf,0xdd,0xfd,0x80,0x00,0x0c,0x10,0xe0,0x2c,0x00,0x03,0xdd,0xfe,0xdf,0xde,
+0xfd,0xd3,0x0d,0x00,0xf2,0x11,0x00,0x7b,0xfb,0xbf,0xbb,0xfb,0x80,0x01,0x22,0x7e,
+0xfe,0x62,0x21,0x00,0x01,0x9c,0x2e,0x2d,0x81,0x00,0x1a,0xe8,0x00,0xe0,0x09,0xe9,
+0x10,0x71,0x00,0x0e,0x00,0x02,0x60,0x05,0x10,0x0a,0xdc,0x00,0x01,0xda,0x07,0x10,
+0xd8,0x18,0x01,0x10,0xd6,0x13,0x00,0x15,0xc2,0x97,0x04,0x2f,0x0f,0x00,0x0b,0x00,
+0x05,0x30,0x07,0xee,0xa0,0x2b,0x00,0x10,0x20,0x84,0x00,0x30,0x03,0xd0,0x70,0x1b,
+0x01,0xf0,0x1d,0xa6,0x0d,0x10,0xe0,0x27,0x00,0x4f,0x10,0xd1,0x0f,0xcd,0xe0,0x1e,
+0xf0,0x0e,0xae,0xf3,0x0e,0x08,0x8d,0x4c,0xf7,0x0e,0x00,0xd0,0x10,0xd2,0x3d,0x10,
+0xe0,0x1d,0x00,0x0d,0x00,0xd1,0x0e,0x14,0xb0,0x00,0xd0,0x0d,0x10,0xe5,0xa4,0x0d,
+0x00,0xf2,0x00,0x00,0x00,0x75,0x00,0xd0,0x0d,0x40,0x00,0x0b,0x40,0x0d,0x00,0x5c,
+0xdd,0xdd,0xeb,0x09,0x01,0x33,0x05,0x30,0x00,0x86,0x00,0x09,0x0e,0x50,0x08,0x60,
+0x00,0x09,0x80,0x0d,0x00,0x90,0x03,0xf3,0xbf,0xff,0xff,0xff,0x11,0xef,0x30,0x0d,
+0x00,0xc0,0x8a,0xc3,0x06,0x10,0x08,0x60,0x01,0x0c,0x30,0x7a,0x00,0x86,0xbb,0x0c,
+0x91,0xd3,0x08,0x60,0x00,0x0c,0x30,0x05,0x80,0x86,0xc8,0x0c,0x01,0x0d,0x00,0x01,
+0xc2,0x0b,0x5b,0xc3,0x00,0x3e,0xee,0x20,0x87,0x0a,0x30,0xc2,0x21,0x3b,0x80,0x0a,
+0x30,0x0a,0x53,0xb0,0x38,0x05,0x20,0xd2,0x3c,0xd0,0x0a,0xf0,0x13,0x2f,0xef,0xfe,
+0xea,0x00,0xdf,0x19,0x70,0x3b,0x00,0x00,0x7b,0xd1,0xa0,0x03,0xb0,0x00,0x01,0x1d,
+0x13,0x33,0x6c,0x33,0x30,0x00,0xd1,0xab,0xbc,0xeb,0xbb,0x30,0x0d,0x10,0x00,0x34,
+0x00,0x69,0xd1,0x00,0x03,0xb0,0x00,0x00,0x0d,0x00,0x04,0x63,0x07,0x20,0x30,0x00,
+0x2b,0x0b,0xe0,0xe2,0x24,0x7a,0xec,0x40,0x00,0x8a,0x9b,0x9b,0xa0,0x00,0x00,0x2f,
+0x30,0x8b,0x0c,0xf1,0x07,0x1d,0xf2,0x00,0x06,0x80,0x00,0x0a,0xac,0x32,0x22,0x89,
+0x22,0x20,0x30,0xc6,0xcc,0xce,0xec,0xcc,0x20,0x0c,0x20,0xa5,0x0c,0x10,0xc2,0x1a,
+0x00,0x14,0x00,0x0d,0x00,0xa5,0x23,0x38,0xa3,0x33,0x00,0x0c,0x28,0xbb,0xbb,0xbb,
+0x56,0x00,0x32,0xb3,0x00,0xb4,0x29,0x0b,0xf0,0x13,0x90,0x00,0x00,0x0b,0x54,0xbb,
+0xcc,0xbb,0x70,0x06,0xf1,0x12,0x32,0x23,0x31,0x03,0xee,0x10,0x66,0x00,0x4b,0x00,
+0x75,0xd1,0x04,0x90,0x07,0x80,0x00,0x0d,0x10,0x1d,0x00,0x95,0x8f,0x00,0x90,0xe0,
+0x0c,0x20,0x00,0x0d,0x10,0x0c,0x20,0xe0,0x0d,0x00,0xc0,0x71,0x3a,0x00,0x00,0x0d,
+0x1a,0xaa,0xac,0xda,0xa1,0x00,0xd1,0x9f,0x03,0xf0,0x1e,0x00,0x00,0x08,0x30,0x00,
+0x26,0xb5,0x00,0x02,0xe0,0x9c,0xdf,0x94,0x00,0x00,0x96,0x0e,0x10,0xa3,0x00,0x00,
+0x3f,0x10,0xe0,0x09,0x50,0x00,0x1e,0xf1,0x0e,0x00,0x86,0x00,0x08,0x8d,0x10,0xfe,
+0xef,0xfe,0xe6,0x10,0xd1,0x0e,0x00,0x59,0xe4,0x00,0x91,0xe0,0x02,0xc0,0x00,0x00,
+0xd1,0x0e,0x00,0x0e,0x0d,0x00,0xf0,0x08,0x54,0xa4,0x37,0x00,0xd1,0x0e,0x68,0xb4,
+0xd9,0x60,0x0d,0x16,0xc7,0x28,0x07,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,
+0x00,0x00,0x0c,0x00,0x0b,0x30,0x00,0x00,0x06,0xa0,0x00,0xb3,0x00,0x00,0x00,0xc5,
+0x0d,0x00,0xf1,0x20,0x5f,0x3e,0xee,0xff,0xee,0xe1,0x0e,0xf0,0x00,0x9f,0xe2,0x00,
 0x07,0xbe,0x00,0x1c,0xb8,0x90,0x00,0x11,0xe0,0x08,0x5b,0x3c,0x10,0x00,0x0e,0x02,
 0xc0,0xb3,0x5b,0x00,0x00,0xe0,0xc4,0x0c,0x41,0xb8,0x00,0x0e,0x77,0xac,0xfd,0xc5,
-0xc1,0x00,0xe0,0x00,0x0b,0x55,0x03,0x16,0xb3,0xa1,0x01,0x30,0xc3,0x0a,0x20,0xf8,
-0x00,0x21,0x01,0xe0,0x16,0x1e,0xf0,0x08,0x8f,0xee,0xee,0xe1,0x05,0xf1,0x2d,0x0e,
-0x10,0x00,0x02,0xff,0x1b,0x60,0xe1,0x00,0x00,0x88,0xd3,0x90,0x0e,0xee,0xeb,0x87,
-0x01,0x11,0xe1,0x87,0x01,0x21,0x0e,0x10,0x94,0x01,0x36,0xee,0xee,0xe0,0x0d,0x00,
-0x06,0x1a,0x00,0x0b,0xfc,0x01,0x01,0x6d,0x01,0x20,0x5c,0x33,0x6d,0x01,0xf1,0x0c,
-0x0d,0x5a,0xaa,0xcd,0xaa,0xa2,0x09,0xf0,0x00,0x07,0x80,0x00,0x06,0xff,0x0a,0xdb,
-0xde,0xbc,0xd0,0x94,0xe0,0xa4,0x06,0x80,0x1d,0x00,0x0e,0x0d,0x00,0x50,0x00,0xe0,
-0x45,0x09,0x60,0x9c,0x00,0x20,0xc4,0xd2,0x67,0x03,0x20,0x01,0xed,0x89,0x05,0xe2,
-0x03,0xab,0x8e,0x94,0x10,0x00,0xe3,0xc6,0x00,0x16,0xad,0x20,0x00,0x05,0x05,0x07,
-0x80,0xe1,0xfd,0xdd,0xdf,0x30,0x00,0xa6,0x0d,0xc5,0x00,0xf1,0x00,0x5f,0x00,0xd0,
-0x00,0x0b,0x30,0x4e,0xf0,0x0d,0xde,0xfd,0xd3,0x09,0x3e,0x00,0x2a,0x02,0xf6,0x15,
-0xe1,0xcc,0xcd,0xfc,0xcb,0x00,0x0e,0x01,0x14,0xff,0x81,0x10,0x00,0xe0,0x01,0xd7,
-0xbc,0x20,0x00,0x0e,0x02,0xc6,0x3b,0x3d,0x20,0x00,0xe3,0xe6,0x03,0xb0,0x5e,0x10,
-0x0e,0x02,0x00,0x3b,0x7b,0x13,0x32,0x0b,0x00,0x0b,0x21,0x18,0x10,0x86,0x0b,0x01,
-0x71,0xcc,0xcd,0xdc,0xcc,0x10,0x6f,0x00,0x2a,0x0f,0x72,0xf0,0x1c,0xcc,0xcc,0xc1,
-0x08,0x6e,0x27,0x00,0x10,0xe0,0x0d,0x00,0x23,0x00,0x0e,0x0d,0x00,0xf4,0x09,0x5e,
-0xcc,0xcc,0xe3,0x00,0x0e,0x05,0x80,0x00,0x09,0x30,0x00,0xe0,0x58,0x11,0x11,0xa3,
-0x00,0x0e,0x05,0xdb,0xbb,0xbd,0x30,0x10,0x07,0x40,0xc0,0x00,0xd1,0x00,0x10,0x15,
-0xf0,0x34,0x7e,0xaa,0xa9,0x00,0x0e,0x10,0x2e,0x91,0x19,0x80,0x07,0xf0,0x3d,0x4b,
-0x46,0xc0,0x02,0xff,0x0d,0x10,0x2e,0xf2,0x00,0x87,0xe0,0xd6,0xbc,0x56,0xdc,0x31,
-0x0e,0x0d,0x41,0x1a,0x50,0x31,0x00,0xe0,0xd0,0x9b,0x32,0x70,0x00,0x0e,0x0d,0x00,
-0x28,0xa1,0x30,0x00,0xe0,0xc0,0x89,0x30,0x8b,0x00,0x0e,0x00,0x01,0x59,0xd6,0x00,
-0x00,0xe0,0x05,0xc7,0x30,0x9d,0x00,0x20,0x10,0x04,0x54,0x0c,0xf1,0x10,0xe2,0x33,
-0x6b,0x33,0x30,0x00,0xa6,0x5a,0xba,0xaa,0xca,0x00,0x4f,0x00,0x58,0x00,0x5a,0x00,
-0x1e,0xf0,0x00,0xc0,0x0c,0x20,0x06,0x7e,0x0d,0xde,0xde,0xfd,0xd5,0x9a,0x04,0x00,
-0x40,0x01,0x61,0xcd,0xdd,0xdd,0x30,0x00,0xe0,0xe4,0x01,0x12,0x0e,0xf1,0x01,0xb5,
-0xe0,0x0e,0xaa,0xaa,0xe3,0x00,0x0e,0x00,0xe3,0x33,0x3b,0xf8,0x00,0x10,0xd0,0xb8,
-0x01,0xfb,0x19,0x00,0x79,0x7a,0xaa,0xfa,0xaa,0x50,0x0d,0x32,0x22,0x4e,0x22,0x21,
-0x07,0xf0,0x00,0x9c,0xfb,0xb9,0x03,0xef,0x09,0x0c,0x20,0x02,0xc0,0x95,0xe0,0xd0,
-0xcb,0xbb,0xbc,0x00,0x0e,0x0d,0x0c,0x10,0x01,0xc0,0x00,0x0d,0x00,0xf4,0x01,0x9b,
-0xbb,0xb9,0x00,0x0e,0x0d,0x43,0x33,0x33,0x31,0x00,0xe0,0x8a,0xaa,0xaa,0xaa,0xfc,
-0x22,0x40,0x0d,0x10,0x0a,0x40,0x23,0x2c,0xf0,0x21,0xad,0xea,0xa7,0x00,0xd4,0xa4,
-0x11,0x11,0x5b,0x07,0xf1,0xa8,0x55,0x55,0x8b,0x3e,0xe1,0xb8,0x66,0x66,0x64,0x74,
-0xd1,0xb8,0xaa,0xaa,0xa9,0x00,0xd1,0xcb,0x4b,0x1b,0x1c,0x00,0xd1,0xda,0x2a,0x0a,
-0x0c,0x00,0xd1,0xd9,0xde,0xce,0xcd,0x00,0xd3,0xa9,0x0c,0x00,0x21,0xd6,0x79,0x06,
-0x00,0x70,0x39,0x2a,0x0a,0x89,0x00,0x06,0x10,0x84,0x17,0xf0,0x24,0x01,0xe6,0x88,
-0x9f,0x88,0x81,0x00,0x97,0x34,0x44,0x44,0x44,0x00,0x2f,0x10,0xcb,0xbb,0xbf,0x10,
-0x0d,0xf0,0x0c,0x64,0x44,0xe1,0x05,0x9e,0x00,0x45,0x55,0x55,0x00,0x00,0xe0,0xdc,
-0xcc,0xcc,0xce,0x20,0x0e,0x0d,0x00,0x00,0x00,0xb2,0x00,0xe0,0x2a,0xcd,0xfc,0xc2,
-0xa1,0x01,0x11,0x1d,0xa5,0x05,0x20,0x01,0xd0,0x0b,0x01,0x60,0x0c,0xd9,0x00,0x00,
-0x00,0x3a,0x9a,0x00,0xf0,0x19,0x00,0x97,0xdc,0xcf,0x07,0x0d,0x00,0xe1,0xd0,0x0d,
-0x0d,0x0d,0x07,0xf0,0xd9,0x9f,0x0d,0x0d,0x2f,0xe0,0xd1,0x1e,0x0d,0x0d,0x97,0xe0,
-0xd4,0x4e,0x0d,0x0d,0x20,0xe0,0xd7,0x7e,0x0d,0x0d,0x00,0xe0,0xd0,0x0d,0x06,0x00,
-0x20,0xbc,0xcd,0x06,0x00,0xf9,0x01,0x47,0x36,0x00,0x0d,0x00,0xe0,0xd3,0x0d,0x10,
-0x0e,0x00,0xe5,0x60,0x04,0x15,0xdb,0xd9,0x02,0x30,0x02,0xc0,0x0d,0xde,0x1f,0xf0,
-0x1d,0x88,0xac,0xfc,0xcf,0xcb,0x00,0x0e,0x21,0x1e,0x21,0xc4,0x10,0x06,0xf0,0x22,
+0xc1,0x00,0xe0,0x34,0x00,0x21,0x0e,0x00,0x41,0x00,0x03,0x01,0x00,0xf0,0x23,0xc3,
+0x0a,0x20,0x00,0x00,0x00,0x3d,0x01,0xe0,0x00,0x00,0x00,0x0b,0x50,0x8f,0xee,0xee,
+0xe1,0x05,0xf1,0x2d,0x0e,0x10,0x00,0x02,0xff,0x1b,0x60,0xe1,0x00,0x00,0x88,0xd3,
+0x90,0x0e,0xee,0xeb,0x00,0x0d,0x10,0x00,0xe1,0x00,0x00,0x00,0xd1,0x00,0x0e,0x10,
+0x00,0x0d,0x00,0x36,0xee,0xee,0xe0,0x0d,0x00,0x06,0x1a,0x00,0x0a,0x01,0x00,0xf1,
+0x18,0xc2,0x00,0x68,0x00,0x00,0x00,0x5c,0x33,0x38,0xa3,0x33,0x00,0x0d,0x5a,0xaa,
+0xcd,0xaa,0xa2,0x09,0xf0,0x00,0x07,0x80,0x00,0x06,0xff,0x0a,0xdb,0xde,0xbc,0xd0,
+0x94,0xe0,0xa4,0x06,0x80,0x1d,0x00,0x0e,0x0d,0x00,0x50,0x00,0xe0,0x45,0x09,0x60,
+0x9c,0x00,0xf0,0x0c,0xc4,0xd2,0x00,0x00,0x00,0xe0,0x01,0xed,0x00,0x00,0x00,0x0e,
+0x03,0xab,0x8e,0x94,0x10,0x00,0xe3,0xc6,0x00,0x16,0xad,0x20,0x00,0x05,0x20,0x54,
+0x00,0x90,0x01,0xe1,0xfd,0xdd,0xdf,0x30,0x00,0xa6,0x0d,0xc5,0x00,0xf4,0x2b,0x5f,
+0x00,0xd0,0x00,0x0b,0x30,0x4e,0xf0,0x0d,0xde,0xfd,0xd3,0x09,0x3e,0x00,0x00,0x3b,
+0x00,0x00,0x00,0xe1,0xcc,0xcd,0xfc,0xcb,0x00,0x0e,0x01,0x14,0xff,0x81,0x10,0x00,
+0xe0,0x01,0xd7,0xbc,0x20,0x00,0x0e,0x02,0xc6,0x3b,0x3d,0x20,0x00,0xe3,0xe6,0x03,
+0xb0,0x5e,0x10,0x0e,0x02,0x00,0x3b,0x00,0x30,0xa3,0x00,0xa0,0x0b,0x00,0x0b,0x00,
+0x00,0x00,0x06,0x90,0x00,0x86,0x0b,0x01,0x61,0xcc,0xcd,0xdc,0xcc,0x10,0x6f,0x19,
+0x00,0x82,0x2e,0xf0,0x1c,0xcc,0xcc,0xc1,0x08,0x6e,0x27,0x00,0x10,0xe0,0x0d,0x00,
+0x23,0x00,0x0e,0x0d,0x00,0xf4,0x08,0x5e,0xcc,0xcc,0xe3,0x00,0x0e,0x05,0x80,0x00,
+0x09,0x30,0x00,0xe0,0x58,0x11,0x11,0xa3,0x00,0x0e,0x05,0xdb,0xbb,0xbd,0x55,0x00,
+0xf0,0x3d,0x01,0xc0,0x00,0xd1,0x00,0x00,0x00,0x87,0x00,0x7e,0xaa,0xa9,0x00,0x0e,
+0x10,0x2e,0x91,0x19,0x80,0x07,0xf0,0x3d,0x4b,0x46,0xc0,0x02,0xff,0x0d,0x10,0x2e,
+0xf2,0x00,0x87,0xe0,0xd6,0xbc,0x56,0xdc,0x31,0x0e,0x0d,0x41,0x1a,0x50,0x31,0x00,
+0xe0,0xd0,0x9b,0x32,0x70,0x00,0x0e,0x0d,0x00,0x28,0xa1,0x30,0x00,0xe0,0xc0,0x89,
+0x30,0x8b,0x00,0x0e,0x00,0x01,0x59,0xd6,0x00,0x00,0xe0,0x05,0xc7,0x30,0x9d,0x00,
+0xf0,0x17,0x10,0x04,0x50,0x00,0x00,0x02,0xe2,0x33,0x6b,0x33,0x30,0x00,0xa6,0x5a,
+0xba,0xaa,0xca,0x00,0x4f,0x00,0x58,0x00,0x5a,0x00,0x1e,0xf0,0x00,0xc0,0x0c,0x20,
+0x06,0x7e,0x0d,0xde,0xde,0xfd,0xd5,0x00,0xc0,0x01,0x00,0x40,0x01,0x61,0xcd,0xdd,
+0xdd,0x30,0x00,0xe0,0xe4,0x01,0x12,0x0e,0xf1,0x01,0xb5,0xe0,0x0e,0xaa,0xaa,0xe3,
+0x00,0x0e,0x00,0xe3,0x33,0x3b,0xf8,0x00,0x10,0xd0,0xb8,0x01,0xfb,0x19,0x00,0x79,
+0x7a,0xaa,0xfa,0xaa,0x50,0x0d,0x32,0x22,0x4e,0x22,0x21,0x07,0xf0,0x00,0x9c,0xfb,
+0xb9,0x03,0xef,0x09,0x0c,0x20,0x02,0xc0,0x95,0xe0,0xd0,0xcb,0xbb,0xbc,0x00,0x0e,
+0x0d,0x0c,0x10,0x01,0xc0,0x00,0x0d,0x00,0xf3,0x02,0x9b,0xbb,0xb9,0x00,0x0e,0x0d,
+0x43,0x33,0x33,0x31,0x00,0xe0,0x8a,0xaa,0xaa,0xaa,0x60,0x54,0x00,0xf0,0x29,0x0d,
+0x10,0x0a,0x40,0x00,0x00,0x5b,0x7a,0xad,0xea,0xa7,0x00,0xd4,0xa4,0x11,0x11,0x5b,
+0x07,0xf1,0xa8,0x55,0x55,0x8b,0x3e,0xe1,0xb8,0x66,0x66,0x64,0x74,0xd1,0xb8,0xaa,
+0xaa,0xa9,0x00,0xd1,0xcb,0x4b,0x1b,0x1c,0x00,0xd1,0xda,0x2a,0x0a,0x0c,0x00,0xd1,
+0xd9,0xde,0xce,0xcd,0x00,0xd3,0xa9,0x0c,0x00,0x21,0xd6,0x79,0x06,0x00,0xf0,0x2f,
+0x39,0x2a,0x0a,0x89,0x00,0x06,0x10,0x03,0x60,0x00,0x00,0x01,0xe6,0x88,0x9f,0x88,
+0x81,0x00,0x97,0x34,0x44,0x44,0x44,0x00,0x2f,0x10,0xcb,0xbb,0xbf,0x10,0x0d,0xf0,
+0x0c,0x64,0x44,0xe1,0x05,0x9e,0x00,0x45,0x55,0x55,0x00,0x00,0xe0,0xdc,0xcc,0xcc,
+0xce,0x20,0x0e,0x0d,0x00,0x00,0x00,0xb2,0x00,0xe0,0x2a,0xcd,0xfc,0xc2,0xa1,0x01,
+0x10,0x1d,0xa1,0x01,0x30,0x00,0x01,0xd0,0x0b,0x01,0x60,0x0c,0xd9,0x00,0x00,0x00,
+0x3a,0x9a,0x00,0xf0,0x19,0x00,0x97,0xdc,0xcf,0x07,0x0d,0x00,0xe1,0xd0,0x0d,0x0d,
+0x0d,0x07,0xf0,0xd9,0x9f,0x0d,0x0d,0x2f,0xe0,0xd1,0x1e,0x0d,0x0d,0x97,0xe0,0xd4,
+0x4e,0x0d,0x0d,0x20,0xe0,0xd7,0x7e,0x0d,0x0d,0x00,0xe0,0xd0,0x0d,0x06,0x00,0x20,
+0xbc,0xcd,0x06,0x00,0xf9,0x01,0x47,0x36,0x00,0x0d,0x00,0xe0,0xd3,0x0d,0x10,0x0e,
+0x00,0xe5,0x60,0x04,0x15,0xdb,0xd9,0x02,0xf0,0x24,0x02,0xc0,0x0d,0x00,0xc2,0x00,
+0x00,0x88,0xac,0xfc,0xcf,0xcb,0x00,0x0e,0x21,0x1e,0x21,0xc4,0x10,0x06,0xf0,0x22,
 0xe3,0x2c,0x52,0x01,0xef,0x2b,0xde,0xbb,0xbb,0xb2,0x6a,0xf0,0x4f,0x86,0x66,0x64,
 0x00,0x0e,0x8d,0xd4,0x6c,0x47,0xa0,0x00,0xe1,0x2f,0xbc,0xeb,0xca,0x90,0x03,0x59,
-0x2b,0x04,0xa0,0x00,0xe0,0x0d,0x00,0x40,0x2c,0x02,0xb1,0xc7,0x2d,0x04,0x11,0xa2,
-0x6f,0x06,0xf6,0x34,0x6e,0xcc,0xd0,0x00,0x00,0x97,0x4e,0x10,0x96,0x00,0x00,0x3f,
-0x5f,0xeb,0xcf,0xbc,0xd0,0x0d,0xf0,0x3b,0x04,0x90,0x1d,0x06,0xae,0x01,0xbd,0xfb,
-0xbb,0x90,0x00,0xe0,0x17,0xdc,0x10,0x37,0x00,0x0e,0x0a,0x62,0xbc,0x9c,0x20,0x00,
-0xe0,0x29,0xa2,0xd5,0xc0,0x00,0x0e,0x08,0x35,0xba,0x57,0x90,0x00,0xe0,0x7d,0x90,
-0x95,0x0a,0x70,0x0e,0x06,0x12,0xdc,0x96,0x09,0x00,0x66,0x06,0x1e,0xe1,0xa6,0x10,
-0x00,0x5d,0x07,0x91,0xfe,0xef,0xfe,0xee,0x20,0x00,0x0f,0x00,0x68,0x76,0x00,0x21,
-0x06,0x80,0x1b,0x1c,0x10,0x68,0x61,0x13,0xfc,0x02,0x40,0x06,0x80,0x08,0x50,0x1b,
-0x90,0x00,0x69,0x00,0xa4,0x1e,0x70,0x00,0x03,0xee,0xed,0x3d,0x00,0x12,0x3c,0x07,
-0x00,0x10,0xb4,0x1e,0x28,0x21,0xee,0xef,0x62,0x00,0x31,0xd6,0x00,0x40,0x92,0x16,
-0x20,0x0c,0x90,0x10,0x16,0xf0,0x01,0x01,0x3e,0x90,0x00,0x3f,0xff,0xfd,0xed,0xbd,
-0x70,0x00,0x20,0xa6,0x08,0x70,0x13,0xd3,0x11,0x11,0x87,0xe8,0x0a,0xf4,0x01,0x08,
-0x70,0x07,0x40,0x04,0xe4,0x00,0x87,0x00,0xa4,0x0c,0xd4,0x00,0x04,0xee,0xed,0x5b,
-0x1e,0x31,0x08,0x10,0xf0,0x9a,0x0a,0x11,0x0f,0xd2,0x13,0x82,0xee,0xfe,0xee,0xe3,
-0x00,0x0e,0x10,0x0f,0x96,0x03,0x11,0xf0,0x7a,0x1a,0xa0,0x1f,0x11,0x11,0x10,0x2d,
-0xdd,0xfd,0xde,0xfd,0xdd,0xa6,0x24,0x11,0x5a,0x2e,0x00,0x21,0x05,0xa0,0xca,0x22,
-0xb0,0x5a,0x00,0x62,0x00,0x8c,0x00,0x04,0xa0,0x0a,0x41,0xea,0xd5,0x17,0x29,0xd0,
-0x01,0x9f,0x17,0x46,0x00,0x0c,0xa0,0x00,0x23,0x17,0x22,0x00,0x3f,0x8f,0x1f,0x12,
-0xeb,0x73,0x0f,0x11,0xd4,0xe7,0x0c,0x21,0x05,0xd0,0xf4,0x22,0x21,0x0c,0x60,0xc2,
-0x09,0x20,0x4e,0x10,0x8c,0x1e,0x50,0x00,0x8c,0x10,0x08,0xf5,0x6d,0x0e,0x21,0x21,
-0xb2,0x51,0x38,0x10,0x00,0x47,0x4a,0x01,0x5f,0x25,0x11,0xb0,0xa6,0x26,0x00,0x5b,
-0x0f,0xfa,0x04,0x02,0xc9,0x00,0x07,0xd3,0x00,0x07,0xe5,0x00,0x00,0x04,0xe9,0x04,
-0xa7,0xdd,0xdf,0xdd,0xd8,0xa5,0xca,0x08,0x5a,0x4d,0xdd,0xfd,0xdd,0x60,0xd7,0x08,
-0x10,0xde,0x32,0x01,0x10,0xe0,0xf4,0x08,0x10,0x30,0x64,0x10,0x31,0x10,0x1e,0x30,
-0x95,0x2f,0x12,0x5c,0x34,0x1d,0xf1,0x04,0xb8,0x00,0x03,0xe3,0x01,0x80,0x01,0xe6,
-0x01,0xe5,0x00,0xaa,0x00,0x03,0xf3,0x02,0x00,0x3e,0x10,0xae,0x0e,0x30,0x60,0x08,
-0x10,0x76,0x0d,0x00,0x34,0x13,0xf5,0x00,0x04,0xd1,0x00,0x12,0xc8,0x00,0x01,0xff,
-0xef,0xed,0xcb,0xe3,0x00,0x04,0x21,0xd1,0x09,0x02,0x09,0x20,0x10,0x68,0xea,0x00,
-0x01,0xe7,0x06,0x02,0x0d,0x00,0x7e,0x8e,0xff,0xee,0xef,0xfe,0xe1,0x00,0x1a,0x00,
-0x11,0x01,0x5f,0x09,0x10,0xe8,0x89,0x00,0x10,0x20,0x95,0x0a,0x30,0x20,0x0b,0xb1,
-0xa2,0x0f,0x00,0xbe,0x20,0x10,0x9a,0xe6,0x11,0x05,0x37,0x02,0xf1,0x09,0x1f,0xcc,
-0xcc,0xcd,0xa0,0x00,0x01,0xe4,0x44,0x44,0x8a,0x00,0x00,0x1e,0x55,0x55,0x58,0xa0,
-0x00,0x01,0xfb,0xbb,0xbb,0xda,0x67,0x03,0x1a,0x05,0x0d,0x00,0xf0,0x07,0x01,0xee,
-0xfe,0xee,0xee,0xef,0xe7,0x00,0x03,0xb1,0x00,0x98,0x10,0x00,0x3a,0xd3,0x00,0x00,
-0x7e,0x70,0x0a,0x50,0x80,0x1e,0x13,0x30,0xa1,0x20,0x00,0xe4,0x06,0xf0,0x19,0xcd,
-0xdd,0xef,0xdd,0xdd,0x6d,0x21,0x14,0xb1,0x11,0x87,0xd1,0x00,0x69,0x00,0x07,0x7d,
-0x10,0x0b,0xe4,0x00,0x77,0xd1,0x04,0xc2,0xd5,0x07,0x7d,0x13,0xe3,0x02,0xe4,0x77,
-0xd5,0xe4,0x00,0x03,0xd8,0x7d,0x11,0x51,0x18,0x10,0xd1,0x1d,0x02,0xf8,0x07,0x7d,
-0x10,0x00,0x00,0xae,0xd3,0xef,0xee,0xff,0xee,0xef,0xbe,0x10,0x01,0xd0,0x00,0x4b,
-0xe1,0x00,0x1d,0x00,0x04,0x0b,0x00,0x00,0xad,0x0b,0x40,0xfb,0xe1,0x00,0x00,0x16,
-0x00,0x00,0x49,0x0c,0x0a,0x0b,0x00,0x50,0x05,0xee,0x60,0x0a,0xee,0x9b,0x00,0x13,
-0x20,0x49,0x23,0x00,0xc9,0x1a,0xf0,0x0e,0xe1,0x00,0x0a,0x40,0x0c,0x20,0x0d,0x10,
-0x00,0xac,0xaa,0xfb,0xaa,0xf1,0x00,0x0a,0x62,0x2d,0x42,0x2d,0x10,0x00,0xa4,0x00,
-0xc2,0x00,0xd1,0x03,0xef,0x23,0x0c,0x31,0xe9,0x00,0xa4,0xd4,0x06,0x20,0x0a,0x40,
-0xe1,0x06,0x00,0x0d,0x00,0x22,0xce,0xc0,0x17,0x0a,0xf2,0x02,0x01,0x60,0x01,0xe0,
-0x01,0x70,0x3c,0x00,0x1e,0x00,0x1e,0x03,0xc0,0x01,0xe0,0x01,0xe0,0x0b,0x00,0x10,
-0xff,0x6b,0x25,0xf1,0x02,0x51,0x00,0x1e,0x00,0x03,0x2c,0x30,0x01,0xe0,0x00,0x96,
-0xc3,0x00,0x1e,0x00,0x09,0x6c,0x0b,0x00,0x10,0xcf,0xbc,0x00,0x12,0x60,0xe5,0x14,
-0x41,0x01,0x70,0x01,0x60,0x6b,0x13,0x21,0x0d,0x40,0xbf,0x19,0x12,0x3d,0xb2,0x22,
-0x22,0x9a,0x00,0xc5,0x2a,0x20,0x04,0xbb,0x41,0x14,0x40,0xa0,0x00,0x00,0x5a,0xf2,
-0x1b,0x00,0x4a,0x36,0x11,0xc3,0x27,0x19,0x21,0x0d,0x20,0xb3,0x13,0x70,0xf0,0x00,
-0x01,0x9c,0x00,0x00,0x2e,0x96,0x11,0x3b,0x0a,0xef,0x70,0x9a,0x03,0x22,0x06,0x70,
-0xf2,0x02,0xf0,0x19,0x05,0xef,0xfe,0xef,0x20,0xbc,0xdc,0x30,0x3c,0x00,0xc2,0x01,
-0x12,0xd0,0x04,0xb0,0x0d,0x10,0x00,0xa5,0x10,0x59,0x00,0xd1,0x00,0x4f,0x5a,0x07,
-0x70,0x0e,0x00,0x3f,0xfe,0x00,0xa4,0x00,0xf0,0x0e,0x6c,0x98,0xda,0x04,0xf0,0x01,
-0x22,0xc0,0x24,0xc0,0x01,0xd0,0x00,0x2c,0x00,0xb5,0x00,0x3c,0x00,0x02,0xc0,0x9c,
-0x15,0x1c,0x58,0x2c,0x1c,0x10,0x9e,0xd2,0x59,0x00,0xc4,0x1d,0x0e,0xdd,0xdf,0x30,
-0x20,0x1d,0x0e,0x00,0x0b,0x33,0xa0,0x06,0x00,0x50,0xcc,0xcf,0x33,0xa0,0x1d,0x55,
-0x2e,0xf0,0x01,0xa0,0x1d,0x00,0xab,0x88,0x23,0xa0,0x1d,0x00,0xd6,0x5c,0x43,0xa0,
-0x1d,0x00,0xd0,0x1e,0x00,0x80,0x05,0xa0,0x0c,0x10,0x00,0x1d,0x1d,0x30,0x8e,0x05,
-0x79,0x67,0x0b,0xd9,0x00,0x3e,0xe9,0x00,0x0d,0x17,0xf0,0x03,0x6d,0x70,0x00,0x1d,
-0x1a,0xdf,0xc5,0x00,0x20,0x1d,0x04,0x28,0x60,0x00,0xe0,0x1d,0x00,0x08,0x06,0x00,
-0x90,0x3c,0xce,0xec,0xc1,0xe0,0x1d,0x01,0x1e,0xa1,0xb9,0x0a,0xf0,0x05,0x7f,0xe8,
-0x00,0xe0,0x1d,0x01,0xd9,0x6a,0x80,0xe0,0x1d,0x0c,0x58,0x60,0x50,0xd0,0x1d,0x59,
-0x08,0x60,0x68,0x02,0x00,0x06,0x00,0x10,0x2d,0x06,0x00,0x23,0x4f,0xe7,0x15,0x14,
-0x01,0x72,0x29,0xf4,0x39,0xd1,0x01,0x12,0xe3,0x11,0x02,0x0d,0x11,0xcc,0xed,0xcc,
-0xb2,0xb0,0xd1,0x00,0x2d,0x10,0x30,0x2b,0x0d,0x10,0x1c,0x31,0x6a,0x02,0xb0,0xd1,
-0x09,0xed,0xee,0x10,0x2b,0x0d,0x10,0x00,0x3e,0x34,0x82,0xb0,0xd1,0x00,0x7c,0x21,
-0xd2,0x2b,0x0d,0x10,0xb9,0x01,0xd4,0x02,0xb0,0xd1,0x00,0x04,0xdb,0xa0,0x00,0x0d,
-0x10,0x19,0xd3,0x09,0xb0,0x00,0xe1,0x0b,0x70,0x00,0x03,0x0a,0xec,0x2d,0x1c,0xf0,
-0x12,0x0d,0x10,0xa0,0x00,0x1d,0x0e,0x0d,0x12,0xc0,0x60,0x1d,0x0a,0x4d,0x18,0x61,
-0xd0,0x1d,0x04,0x3e,0x26,0x11,0xd0,0x1d,0x0e,0xdd,0xdd,0xa1,0xd0,0x1d,0x0e,0x00,
-0x03,0xa1,0x0c,0x00,0x18,0xde,0x0c,0x00,0x20,0xa0,0xa0,0x0c,0x00,0x00,0x36,0x00,
-0x20,0x00,0x04,0x06,0x00,0x53,0x02,0xed,0x60,0x4e,0xe9,0x3b,0x0e,0x21,0x0b,0x30,
-0xce,0x01,0x10,0x4d,0x24,0x0d,0x62,0x1e,0xee,0xfe,0xee,0xff,0xee,0x3f,0x36,0xf5,
-0x04,0x20,0x04,0xec,0xce,0x70,0xc0,0x59,0x00,0x4a,0x00,0x77,0x0e,0x05,0x90,0x04,
-0xeb,0xbd,0x70,0xe0,0x0d,0x00,0x23,0xec,0xce,0x0d,0x00,0xf6,0x00,0x05,0x05,0x90,
-0x04,0xa0,0x07,0x70,0x00,0x69,0x00,0x4a,0x0c,0xd4,0x02,0xee,0xe0,0x1b,0x04,0x52,
-0x03,0xf0,0x1f,0x0e,0xbb,0xbf,0xbb,0xa0,0x20,0xed,0x00,0x60,0x1e,0x0d,0x0e,0x7b,
-0xbf,0xbc,0x30,0xd0,0xe0,0x33,0xe3,0x20,0x0d,0x0e,0x06,0x6e,0x64,0x00,0xd0,0xeb,
-0xbb,0xfb,0xb9,0x0d,0x0e,0x00,0x0d,0x00,0x00,0xd0,0xe3,0xdd,0xfd,0xe0,0x0c,0x0e,
-0x39,0x0c,0x00,0xb2,0xe3,0xda,0xaa,0xf0,0x00,0x0e,0x3a,0x11,0x1c,0x00,0x6e,0x61,
-0x0b,0x01,0xbc,0x07,0x04,0x57,0x11,0x10,0x3e,0xa5,0x04,0x11,0xf5,0xb8,0x04,0x20,
-0xa5,0x00,0x0d,0x22,0x11,0xb4,0xd7,0x1f,0x11,0xc2,0x83,0x17,0x11,0xe1,0x57,0x14,
-0x10,0xf0,0x28,0x05,0x40,0x02,0xd0,0x07,0xf4,0x8d,0x0a,0x56,0x5d,0x30,0x00,0x0e,
-0xee,0xcb,0x1c,0x00,0x88,0x08,0xb0,0x88,0x88,0x50,0x1e,0x00,0x00,0x08,0x9e,0x85,
-0x01,0xe0,0xa4,0x00,0xf0,0x1a,0x4e,0xff,0xee,0xe5,0x00,0x2c,0x00,0x02,0xc0,0x0a,
-0x40,0x02,0xc0,0x00,0x4a,0x00,0xa4,0x00,0x2c,0x00,0x07,0x80,0x0b,0x30,0x02,0xc4,
-0x70,0xc3,0x00,0xc2,0x17,0xcf,0xa5,0x2e,0x00,0x0e,0x11,0x84,0x00,0x0b,0x60,0x25,
-0x05,0x40,0x0a,0xc0,0x00,0x4c,0x75,0x10,0x16,0x08,0xeb,0x00,0x13,0x3b,0x06,0x00,
-0xf0,0x20,0x05,0x77,0x76,0x2b,0xce,0xbb,0x4b,0x97,0x8e,0x03,0x7b,0x3b,0x5b,0x20,
-0x0e,0x00,0x68,0x0a,0x4b,0x20,0x0e,0x00,0x86,0x0b,0x3b,0x20,0x0e,0x00,0xa4,0x0c,
-0x2b,0x20,0x0e,0x00,0xc2,0x0d,0x1b,0x20,0x0e,0x00,0xe0,0x0e,0x0b,0x20,0x0e,0x05,
-0xa0,0x06,0x00,0xa1,0x0d,0x50,0x4c,0x0b,0xfe,0xfe,0x4b,0x0d,0xe5,0x0b,0x2f,0x25,
-0x07,0x96,0x1b,0x10,0xd1,0xae,0x01,0xfa,0x39,0x02,0x29,0x62,0x20,0x3a,0x00,0x01,
-0xcc,0xcc,0xcb,0x03,0xa0,0x00,0x00,0x81,0x16,0x0c,0xef,0xee,0x10,0x4b,0x00,0xb4,
-0x05,0x80,0xc1,0x1d,0x20,0x36,0xd0,0x67,0x0d,0x00,0x39,0x4a,0x41,0x08,0x50,0xd0,
-0x00,0x1d,0xd0,0x00,0xc2,0x0e,0x00,0x00,0x9e,0x10,0x1d,0x00,0xe0,0x00,0x5c,0x6c,
-0x08,0x70,0x0d,0x00,0x6d,0x10,0x43,0xd1,0x03,0xb0,0x1b,0x10,0x00,0xc3,0x0d,0xe5,
-0x00,0x95,0x01,0xf6,0x3c,0x47,0xb8,0x0a,0x30,0x00,0x1b,0xad,0x95,0x20,0xa3,0x00,
-0x03,0x99,0xdb,0x99,0x0a,0x30,0x00,0x02,0x2a,0x62,0x3e,0xfe,0xee,0x20,0xe7,0xc9,
-0x8c,0x0c,0x20,0xc1,0x0e,0xad,0xba,0xc0,0xe0,0x0d,0x10,0xc1,0xa5,0x1c,0x0e,0x00,
-0xd0,0x09,0x9d,0xb9,0x72,0xc0,0x0e,0x00,0xaa,0xdb,0xa8,0x88,0x00,0xe0,0x01,0x1a,
-0x51,0x1e,0x20,0x1d,0x02,0x68,0xdd,0xdf,0xa0,0x04,0xb0,0x27,0x64,0x22,0xc0,0x4d,
-0x5b,0x00,0x12,0x10,0x70,0x20,0x21,0x11,0xe0,0x62,0x2b,0xf0,0x0d,0x1e,0x00,0x01,
-0x00,0x02,0xf1,0x01,0xe0,0x02,0xe3,0x00,0xce,0x00,0x1e,0x00,0xc8,0x00,0xad,0xe0,
-0x01,0xe0,0xbb,0x00,0x1d,0x2e,0x00,0x1f,0xca,0xd4,0x07,0x20,0x04,0xf8,0x2d,0x00,
-0x30,0x19,0xfe,0x00,0x7c,0x11,0x60,0x92,0xe0,0x00,0x26,0x00,0x1e,0xea,0x0e,0xd4,
-0xa0,0x01,0xe0,0x00,0xf0,0x00,0x78,0x00,0x1e,0x00,0x0b,0xfe,0xfd,0xaa,0x0d,0xc0,
-0x09,0x50,0x69,0x00,0x2e,0x10,0x00,0x2e,0x10,0xe2,0x0b,0x70,0xd9,0x1b,0xf0,0x13,
-0xdd,0xfd,0x40,0x00,0xd1,0x00,0xd2,0x00,0xa5,0x00,0x0d,0xa9,0x9f,0xa9,0x9d,0x50,
-0x00,0xd3,0x22,0xd4,0x22,0xb5,0x00,0x0d,0x10,0x0d,0x20,0x0a,0x50,0x00,0xbc,0xcc,
-0xfd,0xcc,0x0f,0x1a,0x00,0x93,0x04,0x11,0x1e,0x59,0x05,0x12,0x60,0x0d,0x00,0x10,
-0x00,0xdd,0x1d,0x03,0xf7,0x0b,0x14,0x00,0xb6,0x28,0x00,0x17,0x05,0x14,0xf8,0x0d,
-0x00,0x02,0x1a,0x00,0xf0,0x02,0x33,0x33,0x3d,0x53,0x33,0x31,0x0b,0xbb,0xcf,0xcb,
-0xbb,0xbb,0x60,0x00,0x07,0xb0,0x05,0xb6,0x11,0x11,0xe1,0x9c,0x3a,0x11,0xc4,0x4a,
-0x3a,0xa7,0xbc,0x89,0xab,0xce,0xf3,0x00,0x0a,0x86,0x54,0x21,0xde,0x06,0xf0,0x0a,
-0x23,0x56,0x8b,0xc1,0x00,0xac,0xba,0xab,0x65,0x33,0x00,0x00,0x95,0x02,0xc0,0x05,
-0xb0,0x00,0x02,0xb0,0x0b,0x10,0xd2,0x00,0x0f,0xad,0x12,0x12,0xdf,0xfd,0x0a,0x70,
-0xd0,0x09,0x6e,0xee,0xee,0xee,0x38,0xa0,0x18,0x01,0xd1,0x18,0x21,0xc8,0x06,0x91,
-0x00,0x10,0xce,0x0f,0x20,0xc6,0x48,0xda,0x5a,0xe9,0x52,0x00,0xc9,0x61,0x00,0x01,
-0x69,0xc1,0xfb,0x0c,0x14,0x00,0x92,0x1a,0xa1,0x01,0xaa,0xac,0xea,0xaa,0xaa,0xa1,
-0x03,0x34,0xd7,0xbe,0x0d,0x25,0x4d,0x00,0x47,0x1c,0x20,0x00,0x07,0x87,0x13,0xa0,
-0x30,0x07,0xea,0x70,0x00,0x00,0xc3,0x04,0xd1,0x77,0xc1,0x1b,0x31,0x01,0x07,0x70,
-0x3d,0x00,0x20,0x7e,0xdd,0x8b,0x0c,0x21,0x07,0x70,0x50,0x0d,0x51,0x8e,0xdd,0xdd,
-0xde,0x80,0xa1,0x04,0x14,0x68,0x0d,0x00,0x03,0x40,0x05,0x10,0xdd,0x01,0x00,0x32,
-0x10,0x00,0xa7,0xa1,0x0b,0x10,0x52,0x68,0x13,0x23,0x02,0xbb,0x27,0x14,0x01,0x1a,
-0x04,0x03,0x6b,0x10,0x3d,0x01,0xdd,0xd7,0xad,0x09,0x21,0x08,0x90,0xdc,0x05,0x21,
-0xdd,0x40,0x04,0x1a,0xf6,0x02,0x3e,0x60,0x00,0x00,0x4d,0x80,0x00,0x1b,0xc4,0x00,
-0xce,0xbd,0xdd,0xdd,0xe7,0xe9,0x04,0x1b,0x02,0x00,0xdf,0x08,0x41,0xdd,0xdd,0xdd,
-0xe0,0xc6,0x3a,0x10,0x1e,0xa9,0x09,0x00,0x55,0x00,0x21,0x03,0xfd,0xe6,0x13,0x02,
-0x0d,0x00,0x10,0xde,0xf6,0x07,0x20,0xdd,0x10,0x93,0x00,0x53,0xd1,0xcd,0xdd,0xdd,
-0x81,0x0b,0x00,0xf0,0x0e,0x3d,0xdd,0xdc,0x01,0xdd,0x14,0x90,0x00,0xe0,0x1d,0xd1,
-0x49,0x00,0x0e,0x01,0xdd,0x14,0xea,0xaa,0xe0,0x1d,0xd1,0x4a,0x22,0x22,0x01,0xdd,
-0x10,0x20,0x21,0x00,0x00,0xb5,0x2a,0x04,0xcd,0x00,0x01,0x2f,0x09,0xf0,0x05,0x03,
-0xfe,0xcc,0xcc,0x80,0x07,0xd3,0x11,0x12,0xe4,0x0c,0xc4,0x20,0x00,0xb9,0x00,0x40,
-0x4e,0x41,0xba,0xd1,0x08,0x10,0xe7,0xee,0x0d,0xb0,0xf6,0x33,0x32,0x29,0xef,0xbb,
-0xbb,0xbb,0xe1,0x41,0xd1,0x89,0x00,0x20,0x0d,0x10,0x7b,0x00,0xa9,0xdd,0xcc,0xcc,
-0xde,0x00,0x0d,0x21,0x11,0x12,0xe0,0xd8,0x00,0x10,0xe3,0x1c,0x23,0xb1,0xdf,0xdd,
-0xdd,0xda,0xd2,0x11,0x11,0x11,0x14,0xbd,0x10,0x4d,0x20,0xf0,0x08,0x0f,0xdd,0xde,
-0x03,0xbd,0x10,0xd0,0x00,0xe0,0x3b,0xd1,0x0d,0x00,0x0e,0x03,0xbd,0x10,0xfc,0xcc,
-0xe0,0x3b,0xd1,0x0e,0x1c,0x31,0x22,0x10,0x20,0x6e,0x20,0xe1,0x09,0xfe,0x60,0x1e,
-0xee,0xee,0xff,0xee,0xee,0x10,0x00,0x00,0x2d,0x60,0x4f,0x1b,0x20,0xf2,0xa3,0x15,
-0x23,0xe0,0x1f,0x05,0xcb,0x10,0x3e,0xc4,0x00,0xf0,0x00,0x6e,0x20,0x30,0x00,0x0d,
-0x1b,0x01,0x51,0x9d,0xdd,0xdd,0xdd,0xa0,0xc8,0x07,0x10,0x4c,0x5f,0x3e,0x00,0x84,
-0x05,0x30,0x0a,0xcb,0xbb,0xd6,0x27,0x50,0xa6,0x22,0x22,0x25,0xb0,0xce,0x00,0x11,
-0xa0,0xb6,0x03,0x11,0xdc,0x57,0x23,0x10,0xd3,0xba,0x12,0xf1,0x03,0x4b,0xc2,0xb7,
-0x07,0xe8,0x20,0x6c,0x40,0x00,0x83,0x01,0x8b,0x00,0x0a,0xdd,0xdd,0xde,0x90,0xdb,
-0x16,0x10,0xd1,0x08,0x1c,0xa0,0x23,0xe6,0x20,0x00,0x00,0xdb,0xaa,0xaa,0xae,0x30,
-0x34,0x05,0x00,0x06,0x02,0xf1,0x01,0xdb,0xbb,0xbb,0xbf,0x30,0x00,0x0d,0x32,0x22,
-0x22,0xd3,0x00,0x00,0x0b,0x10,0xb4,0x28,0x2b,0x01,0xd7,0x01,0x11,0xce,0xcd,0x0a,
-0x11,0x8b,0xe4,0x01,0x20,0x06,0x10,0x49,0x05,0x11,0x02,0x7a,0x09,0x14,0xe2,0x05,
-0x01,0x41,0xee,0xee,0xee,0xe9,0x7b,0x11,0x21,0x04,0xa0,0x3a,0x02,0xe0,0x4a,0x00,
-0x00,0x8d,0xbb,0xbb,0xbd,0xa0,0x00,0x08,0x82,0x22,0x22,0x6a,0xc4,0x0b,0x60,0xfe,
-0xee,0xeb,0x00,0xe0,0x00,0x60,0x29,0x53,0xe2,0xcc,0xfc,0xc5,0x3b,0x0c,0x00,0x51,
-0xe6,0xcc,0xdc,0xcb,0x3b,0xf5,0x02,0xf0,0x0b,0x3b,0x01,0xd0,0xec,0xcc,0xf0,0x3b,
-0x03,0xb0,0xe0,0x00,0xe0,0x3b,0x07,0x70,0xea,0xaa,0xf0,0x3b,0x0d,0x20,0xe1,0x11,
-0x10,0x4b,0x3a,0xfc,0x00,0x12,0xd6,0x68,0x00,0xf0,0x08,0xdc,0xcc,0xd0,0xfc,0xcc,
-0xed,0xba,0xbd,0x0f,0xaa,0xbe,0xd1,0x01,0xd0,0xe0,0x01,0xed,0xcc,0xcd,0x0f,0xbb,
-0xce,0xd1,0x73,0x02,0xf0,0x0e,0xed,0x10,0xcc,0xcc,0xa0,0x1e,0xd1,0x0d,0x00,0x1d,
-0x01,0xed,0x10,0xd0,0x01,0xd0,0x1e,0xd1,0x0f,0xdd,0xdd,0x01,0xed,0x10,0xa0,0x00,
-0x00,0x2e,0xd1,0xea,0x01,0xf0,0x05,0x80,0x02,0xfd,0xde,0x0a,0xdd,0xe8,0x00,0x2b,
-0x00,0xe0,0xa3,0x05,0x80,0x02,0xfd,0xdf,0x0a,0xdd,0xe8,0xad,0x2b,0xf2,0x21,0x07,
-0x91,0x00,0x0b,0xbb,0xbf,0xcb,0xbe,0xdb,0x50,0x22,0x8d,0x32,0x2b,0xa2,0x21,0x01,
-0x9c,0x10,0x00,0x09,0xc5,0x01,0xef,0xdd,0xf0,0xbd,0xde,0xd7,0x00,0xe0,0x0d,0x0b,
-0x20,0x86,0x00,0x0e,0x00,0xd0,0xb2,0x08,0x60,0x00,0xed,0xde,0x0b,0xdd,0xe6,0x07,
-0x1e,0x11,0xee,0xce,0x18,0xf0,0x14,0xe1,0x02,0x22,0x22,0x01,0xee,0x10,0xfb,0xbb,
-0xf0,0x1e,0xe1,0x0e,0x00,0x0f,0x01,0xee,0x10,0xe0,0x00,0xf0,0x1e,0xe1,0x0f,0xbb,
-0xbf,0x01,0xee,0x10,0x11,0x11,0x10,0x1e,0xe1,0x00,0x60,0x0c,0x00,0x37,0x03,0x21,
-0xde,0xe2,0xee,0x0b,0x21,0xee,0xee,0x3c,0x17,0xf2,0x00,0x06,0x01,0x50,0x1e,0xe1,
-0x01,0xb0,0x2a,0x01,0xee,0x1c,0xdf,0xcd,0xfc,0x4e,0x0b,0x00,0xf0,0x07,0x2d,0xdf,
-0xdd,0xfd,0x5e,0xe1,0x08,0x60,0x2a,0x01,0xee,0x13,0xe1,0x02,0xa0,0x1e,0xe1,0x93,
-0x00,0x17,0x01,0xee,0x15,0x32,0x71,0xbe,0xe4,0x22,0x22,0x22,0x24,0xe0,0xf8,0x02,
-0xf0,0x05,0xed,0x10,0x00,0xb0,0x00,0x1e,0xd1,0x11,0x1e,0x11,0x11,0xed,0x1a,0xaa,
-0xfa,0xaa,0x1e,0xd1,0x00,0x0e,0xff,0x00,0x40,0xfc,0xcc,0xf0,0x1e,0x68,0x02,0xd1,
-0x01,0xed,0x10,0xe7,0x77,0xf0,0x1e,0xd1,0x03,0x33,0x33,0x01,0xed,0x3d,0x00,0x53,
-0xd4,0x33,0x33,0x33,0x34,0x3d,0x00,0x10,0x11,0x96,0x00,0x60,0xd1,0xbc,0xdf,0xcc,
-0x91,0xed,0x04,0x0f,0xf2,0x08,0x1e,0xd1,0x7c,0xdf,0xcc,0x41,0xed,0x10,0x02,0xc2,
-0x70,0x1e,0xd1,0x00,0x1c,0x09,0x41,0xed,0x2c,0xcc,0xfc,0xcc,0x1e,0x52,0x01,0x00,
-0xa6,0x15,0x20,0xce,0xd3,0x7a,0x23,0x30,0xe0,0x00,0xfe,0x3e,0x00,0x15,0x50,0xe7,
-0x14,0x12,0x0e,0x10,0x0c,0x10,0xe0,0x5a,0x36,0xb1,0xbb,0xbf,0xbb,0xb8,0x00,0x1e,
-0x13,0x33,0xe4,0x33,0x20,0x52,0x2b,0x01,0xe8,0x06,0x20,0xe0,0x00,0x20,0x11,0x10,
-0x0e,0x0c,0x05,0x70,0x22,0x22,0xe3,0x22,0x21,0x1d,0x2b,0x8b,0x00,0x14,0x60,0x0e,
-0x04,0x12,0x1c,0xea,0x09,0x11,0xa0,0xc6,0x0d,0x20,0xff,0xee,0xd5,0x0a,0x12,0x5c,
-0x18,0x06,0x30,0x30,0x03,0xa0,0x41,0x1d,0x00,0x44,0x00,0x91,0x0b,0xf7,0x2e,0xee,
-0xfe,0xe9,0x04,0xb7,0x70,0x39,0x07,0x11,0x77,0x39,0x13,0x19,0x07,0x0d,0x00,0x55,
-0x79,0xee,0xef,0xee,0xe2,0xfe,0x05,0x01,0xf8,0x12,0x31,0x95,0x00,0x2d,0x0d,0x00,
-0xf1,0x22,0x0b,0xee,0xee,0xf3,0x3e,0xff,0xd7,0xb0,0x00,0x0b,0x30,0x09,0x50,0xc4,
-0x50,0x00,0xb2,0x00,0x95,0x00,0x0b,0x80,0x0c,0x20,0x09,0x50,0x00,0x0b,0x30,0xc1,
-0x00,0x96,0x73,0x00,0x2a,0x6d,0x00,0x1b,0xf8,0x12,0xac,0x40,0xe0,0x2e,0x91,0x04,
-0xe6,0x00,0x0e,0xda,0x00,0x11,0x04,0x18,0x0d,0x24,0xde,0xe4,0xa8,0x00,0x12,0x85,
-0xdf,0x02,0xe6,0x50,0xae,0xdf,0xdd,0xf0,0x00,0x85,0x0a,0x40,0xe0,0x0e,0x01,0xff,
-0xfc,0x0d,0x00,0x40,0x00,0x08,0x50,0xa5,0xca,0x06,0x80,0x85,0x07,0xcc,0xfc,0xcc,
-0x00,0x08,0x99,0xba,0x17,0x84,0x17,0xed,0x4b,0xee,0xfe,0xee,0x31,0xd5,0x02,0x1f,
-0x11,0x00,0xd5,0x2f,0x10,0xee,0x2a,0x14,0x11,0x1c,0x22,0x05,0xf0,0x2a,0xcc,0xfc,
-0x96,0xfd,0xde,0xd0,0x01,0x2c,0x10,0x68,0x00,0x1d,0x01,0x24,0xd2,0x26,0x80,0x68,
-0xc0,0x5c,0xba,0xdb,0x78,0x06,0x62,0x00,0x57,0x0c,0x16,0xeb,0xaa,0xc0,0x3d,0xee,
-0xeb,0x6a,0xd0,0x3c,0x00,0x01,0xc0,0x06,0x8a,0x6a,0x70,0x5b,0xbe,0xbb,0x78,0x2d,
-0xe0,0x01,0x13,0xc1,0x16,0x80,0xdc,0x37,0x01,0xaa,0x68,0xc9,0x9b,0x10,0x01,0xc0,
-0x06,0xe8,0x00,0x84,0x5f,0x05,0x40,0x2a,0x10,0x01,0xd7,0x11,0x17,0xf0,0x20,0x04,
-0xc3,0x8a,0x20,0x00,0x71,0x3c,0xe7,0x66,0xae,0xc3,0x05,0xd3,0x32,0x5b,0x85,0x14,
-0x10,0x00,0x09,0xbb,0xed,0xbb,0x70,0x00,0x47,0x06,0x18,0x53,0x40,0x00,0x0c,0x17,
-0xa0,0x85,0x0b,0x50,0x09,0x51,0x80,0xbc,0x20,0x07,0x00,0x10,0x00,0x05,0xa2,0x00,
-0x53,0x9c,0xcc,0xfd,0xcc,0xc5,0xdb,0x06,0x74,0x1c,0xcc,0xcc,0xfd,0xcc,0xcc,0x70,
-0xd7,0x03,0xf0,0x30,0x50,0x0a,0x50,0x0a,0x70,0x00,0x85,0x00,0x2b,0x01,0xe0,0x00,
-0x08,0x50,0xdc,0xbf,0xbb,0xe6,0x09,0xdb,0x6d,0x00,0xe0,0x08,0x60,0x6b,0x94,0xdb,
-0xbf,0xbb,0xd6,0x00,0x85,0x0d,0x44,0xe4,0x4a,0x60,0x08,0x50,0x56,0x66,0x66,0x62,
-0x00,0x86,0x64,0xdc,0xcc,0xcd,0x00,0x4d,0xe8,0x59,0x00,0x00,0xe0,0x2c,0x60,0x04,
-0xeb,0xbb,0xbe,0x22,0x1e,0x01,0x0b,0x02,0x03,0x0d,0x00,0x01,0x3c,0x0e,0x10,0xdd,
-0x28,0x05,0x13,0xd0,0x0d,0x00,0x10,0x3d,0x0d,0x00,0x05,0x77,0x11,0x00,0x28,0x03,
-0xf0,0x00,0x20,0x00,0xf0,0x00,0xe0,0x00,0xb3,0x00,0x0f,0x00,0x0e,0x00,0x0b,0x30,
-0x02,0x0f,0x36,0x30,0xf3,0x00,0x69,0x8b,0x04,0x31,0x10,0x0d,0x30,0xb9,0x05,0x04,
-0xc2,0x05,0x0a,0x51,0x08,0x12,0x2e,0x41,0x00,0x80,0xfe,0xdd,0xdd,0x00,0x00,0x17,
-0x70,0x77,0x14,0x12,0xf4,0x02,0x77,0x07,0x7a,0x70,0x00,0x3d,0x07,0x70,0x77,0x0b,
-0x70,0x08,0x20,0x57,0x06,0x50,0x07,0x4c,0x1e,0xf4,0x11,0x09,0xec,0xcc,0xdf,0x10,
-0x00,0x5d,0x9c,0x30,0x0c,0x60,0x00,0x06,0x20,0x1d,0x8d,0x50,0x00,0x00,0x01,0x49,
-0xdb,0xe9,0x41,0x00,0x1d,0xd9,0x50,0x00,0x5a,0xde,0x20,0xf0,0x06,0x01,0xbc,0x00,
-0x21,0x06,0xa0,0xc7,0x02,0x40,0xbf,0xee,0xa0,0xe0,0x07,0x06,0x20,0x68,0x0e,0x60,
-0x1c,0xf0,0x09,0x0a,0x50,0xfb,0x10,0x02,0xe8,0x40,0xe1,0x0e,0x6d,0x20,0x03,0x2d,
-0xbb,0x00,0xe0,0x5e,0x20,0x00,0x0e,0x40,0x0e,0x00,0x51,0x61,0x00,0x11,0xe0,0x79,
-0x0e,0x00,0x27,0x00,0x10,0xe3,0x41,0x00,0x34,0x02,0xb1,0x00,0x70,0x13,0x14,0x00,
-0x1d,0x30,0x70,0x09,0xfe,0xdd,0xd1,0x00,0x04,0xd8,0xa3,0x32,0x41,0x3c,0x3b,0x40,
-0xaa,0x6e,0x03,0xc0,0x72,0x00,0x00,0x02,0x7d,0xa3,0xaa,0x00,0x00,0xad,0x82,0x1b,
-0x5d,0x0f,0xa0,0x06,0xe6,0x00,0x0b,0x60,0x01,0xd9,0x2c,0x30,0xaa,0xb3,0x05,0xc7,
-0xed,0x60,0x00,0x00,0x14,0xae,0xa2,0x00,0x00,0xae,0xda,0x50,0x2a,0x07,0x09,0x72,
-0x18,0x03,0xf9,0x2f,0x11,0x3d,0x55,0x03,0x21,0xef,0xff,0x78,0x18,0x21,0x8f,0x80,
-0x5a,0x01,0x12,0x5e,0xf3,0x06,0x20,0xb7,0x00,0x11,0x24,0x30,0x02,0xe2,0x00,0x2f,
-0x26,0x50,0x07,0xe2,0x00,0x03,0xda,0xc2,0x2a,0x20,0x02,0xd5,0x1d,0x00,0x07,0x2b,
-0x0d,0x13,0xd1,0x06,0x13,0x01,0xbb,0x1d,0x60,0xff,0xee,0xf2,0x00,0x0a,0x40,0x35,
-0x09,0x21,0x00,0xa4,0x4f,0x09,0x83,0x0a,0x40,0x0f,0x00,0x0d,0x20,0x1f,0xff,0x5d,
-0x1e,0x21,0x8b,0xd0,0x68,0x20,0x20,0x29,0x80,0x81,0x0f,0xc0,0x50,0x0c,0x80,0x00,
-0x03,0xad,0x30,0x00,0x0a,0xd6,0x10,0xa5,0xb7,0x00,0x51,0x95,0x00,0x0a,0x10,0xd1,
-0xc4,0x20,0x01,0x4e,0x00,0xb0,0x9f,0xdd,0xfd,0xdd,0xd4,0x00,0x2e,0x22,0x2e,0x32,
-0x22,0x2f,0x0e,0x11,0xe1,0x45,0x1b,0x00,0xbd,0x00,0x02,0x4e,0x00,0x51,0x60,0x00,
-0x00,0x7c,0xc0,0xcd,0x01,0x30,0x2b,0x60,0x00,0x11,0x07,0xb0,0x1d,0x60,0x00,0x01,
-0x8e,0x60,0x00,0x2d,0xb3,0x00,0xd8,0x3b,0x10,0x15,0xd7,0xed,0x14,0xf0,0x2e,0x20,
-0x12,0x35,0x83,0x00,0x80,0xb4,0xba,0xb8,0x66,0x30,0x06,0x8b,0x2a,0x37,0x61,0xc2,
-0x00,0x03,0xb2,0x25,0x04,0x5b,0x00,0x00,0x3d,0x5b,0xdb,0xbc,0xfb,0x61,0xba,0xd2,
-0x0b,0x40,0x2c,0x00,0x02,0x0b,0x20,0x27,0x47,0xb0,0x00,0x00,0x51,0x0f,0x12,0x41,
-0x00,0x1c,0xcc,0xcd,0xfc,0xcc,0xcc,0x50,0x00,0x01,0xc6,0xd2,0x65,0x25,0xe6,0xe6,
-0x03,0xd8,0x30,0x01,0xdb,0x71,0x00,0x00,0x6b,0xd5,0x00,0x00,0x08,0x54,0x1a,0x13,
-0x1e,0x8e,0x04,0x12,0x4c,0x03,0x01,0x40,0x27,0xdd,0xdd,0xe4,0x96,0x29,0x50,0x01,
-0xb7,0x00,0x1c,0xe7,0xe7,0x07,0xf1,0x01,0x04,0x78,0x76,0xaa,0xbf,0xaa,0xa4,0x00,
-0x77,0x23,0x33,0xf3,0x33,0x10,0x07,0x70,0xdb,0x01,0x12,0x77,0xf0,0x04,0x47,0x70,
-0x0d,0xea,0x00,0xf0,0x2b,0x10,0x70,0xa0,0x33,0xd1,0x22,0x3f,0x32,0x22,0x20,0x0d,
-0xcb,0xbb,0xbb,0xbb,0xcd,0x00,0xd0,0xfe,0x32,0x65,0x09,0x0e,0xee,0xee,0xee,0x19,
-0xc3,0x12,0x11,0xee,0x6f,0x00,0x31,0x0d,0x20,0x77,0xce,0x01,0x21,0x07,0x70,0xdc,
-0x1d,0xf5,0x02,0x77,0x00,0x53,0x00,0x4e,0x30,0x07,0x70,0x0a,0x42,0xdb,0x30,0x00,
-0x4e,0xee,0xd1,0x01,0x93,0x0b,0x03,0x55,0x00,0x40,0x42,0x22,0x20,0x0e,0x51,0x05,
-0x31,0xce,0x00,0xe0,0x75,0x09,0x10,0x08,0xf9,0x1a,0x14,0x58,0x0a,0x02,0x31,0x2c,
-0x00,0xf0,0x5e,0x05,0x61,0x0f,0xee,0xec,0x00,0x00,0xae,0x0d,0x00,0x31,0x0e,0x99,
-0x0f,0xad,0x08,0x21,0xbb,0xf1,0x00,0x08,0x4b,0x5b,0xef,0xff,0xf3,0xd2,0x21,0x01,
-0x38,0x05,0x02,0xe1,0x2b,0x80,0x00,0xf0,0x00,0x16,0x00,0x01,0xe0,0x0a,0xd7,0x00,
-0x74,0x09,0x00,0x0b,0xcc,0xdf,0xcc,0xcb,0xdb,0x09,0x50,0x08,0xcc,0xcf,0xcc,0xc8,
-0xde,0x00,0x11,0xc0,0x6b,0x25,0x90,0xff,0xec,0xcc,0xc2,0x00,0x00,0x6d,0x2d,0x20,
-0xa6,0x34,0xc4,0x10,0x3d,0x72,0x00,0x1c,0xc5,0x00,0x00,0x18,0xed,0x10,0x10,0x72,
-0x31,0x07,0x9d,0x03,0x03,0x04,0x08,0xf0,0x23,0x04,0x00,0x02,0x02,0xd0,0x06,0x09,
+0x2b,0x04,0xa0,0x00,0xe0,0x0d,0x00,0x90,0x2c,0x02,0xb1,0xc7,0x00,0x00,0x08,0x30,
+0xa2,0x37,0x02,0xf4,0x37,0xe0,0x6e,0xcc,0xd0,0x00,0x00,0x97,0x4e,0x10,0x96,0x00,
+0x00,0x3f,0x5f,0xeb,0xcf,0xbc,0xd0,0x0d,0xf0,0x3b,0x04,0x90,0x1d,0x06,0xae,0x01,
+0xbd,0xfb,0xbb,0x90,0x00,0xe0,0x17,0xdc,0x10,0x37,0x00,0x0e,0x0a,0x62,0xbc,0x9c,
+0x20,0x00,0xe0,0x29,0xa2,0xd5,0xc0,0x00,0x0e,0x08,0x35,0xba,0x57,0x90,0x00,0xe0,
+0x7d,0x90,0x95,0x0a,0x70,0x0e,0x06,0x12,0xdc,0x00,0x01,0xa4,0x00,0x5c,0xee,0xee,
+0xee,0xee,0xe1,0x92,0x03,0x01,0xda,0x02,0xa1,0xee,0xfe,0xef,0xfe,0xee,0x20,0x00,
+0x0f,0x00,0x68,0x76,0x00,0xfc,0x0e,0x06,0x80,0x00,0x00,0x00,0x6a,0x00,0x68,0x00,
+0x10,0x00,0x0d,0x40,0x06,0x80,0x08,0x50,0x1b,0x90,0x00,0x69,0x00,0xa4,0x1e,0x70,
+0x00,0x03,0xee,0xed,0x3d,0x00,0x12,0x3c,0x07,0x00,0x71,0xb4,0x00,0x00,0x01,0xee,
+0xee,0xef,0x62,0x00,0xf2,0x2b,0xd6,0x00,0x40,0x00,0x00,0x00,0x99,0x00,0x0c,0x90,
+0x00,0x00,0x8c,0x00,0x01,0x3e,0x90,0x00,0x3f,0xff,0xfd,0xed,0xbd,0x70,0x00,0x20,
+0xa6,0x08,0x70,0x13,0x00,0x00,0x0d,0x30,0x87,0x00,0x00,0x00,0x04,0xd0,0x08,0x70,
+0x07,0x40,0x04,0xe4,0x00,0x87,0x00,0xa4,0x0c,0xd4,0x00,0x04,0xee,0xed,0x00,0x20,
+0x4c,0x00,0x30,0x08,0x10,0xf0,0x53,0x01,0x20,0xe0,0x0f,0x0d,0x00,0x92,0x7f,0xee,
+0xfe,0xee,0xe3,0x00,0x0e,0x10,0x0f,0x96,0x03,0x00,0x1a,0x00,0xf1,0x02,0x12,0x11,
+0x1f,0x11,0x11,0x10,0x2d,0xdd,0xfd,0xde,0xfd,0xdd,0x20,0x00,0x0e,0x10,0x5a,0x2e,
+0x00,0xf5,0x08,0x05,0xa0,0x00,0x00,0x00,0x97,0x00,0x5a,0x00,0x62,0x00,0x8c,0x00,
+0x04,0xa0,0x0a,0x41,0xea,0x10,0x00,0x1e,0xee,0xd0,0xff,0x00,0x11,0x50,0x06,0x00,
+0x21,0x0c,0xa0,0x07,0x00,0x21,0x1d,0x80,0x07,0x00,0x11,0x3f,0x72,0x00,0x21,0x06,
+0xeb,0x0d,0x00,0x20,0xb6,0xd4,0x06,0x00,0xf0,0x11,0x2f,0x05,0xd0,0x00,0x00,0x00,
+0x0a,0x80,0x0c,0x60,0x00,0x00,0x05,0xe0,0x00,0x4e,0x10,0x00,0x04,0xf3,0x00,0x00,
+0x8c,0x10,0x08,0xf5,0x00,0x00,0x00,0xad,0x21,0xb2,0x24,0x00,0x51,0x72,0x00,0x00,
+0x00,0xb1,0x34,0x00,0x20,0xac,0xb0,0x06,0x00,0xf1,0x0d,0xa9,0x08,0xc0,0x00,0x00,
+0x02,0xc9,0x00,0x07,0xd3,0x00,0x07,0xe5,0x00,0x00,0x04,0xe9,0x04,0xa7,0xdd,0xdf,
+0xdd,0xd8,0xa5,0x00,0x00,0x00,0xf0,0x27,0x00,0x01,0xca,0x00,0x54,0x4d,0xdd,0xfd,
+0xdd,0x60,0x0d,0x00,0x02,0x1a,0x00,0x30,0xde,0xee,0xef,0x38,0x05,0x21,0x00,0x20,
+0x80,0x04,0xf1,0x35,0x3e,0x10,0x1e,0x30,0x00,0x00,0x0b,0x70,0x00,0x5c,0x00,0x00,
+0x04,0xe0,0x00,0x00,0xb8,0x00,0x03,0xe3,0x01,0x80,0x01,0xe6,0x01,0xe5,0x00,0xaa,
+0x00,0x03,0xf3,0x02,0x00,0x3e,0x10,0x00,0x02,0x00,0x00,0x0c,0x60,0x08,0x10,0x00,
+0x00,0x07,0xb0,0x00,0x6c,0x00,0x00,0x04,0xd1,0x00,0x12,0xc8,0x00,0x01,0xff,0xef,
+0xed,0xcb,0xe3,0x00,0x04,0x21,0x00,0x00,0x06,0x01,0x02,0x75,0x04,0x11,0xd0,0xcf,
+0x01,0x44,0x1d,0x00,0x06,0x80,0x0d,0x00,0x7e,0x8e,0xff,0xee,0xef,0xfe,0xe1,0x00,
+0x1a,0x00,0x20,0x01,0xee,0x01,0x00,0x10,0xe8,0x89,0x00,0x00,0x12,0x01,0xf5,0x02,
+0x4e,0x20,0x0b,0xb1,0x00,0x00,0x7e,0x20,0x00,0x07,0xd2,0x00,0x9a,0x10,0x00,0x00,
+0x05,0x37,0x02,0xf1,0x09,0x1f,0xcc,0xcc,0xcd,0xa0,0x00,0x01,0xe4,0x44,0x44,0x8a,
+0x00,0x00,0x1e,0x55,0x55,0x58,0xa0,0x00,0x01,0xfb,0xbb,0xbb,0xda,0x67,0x03,0x1a,
+0x05,0x0d,0x00,0xf0,0x06,0x01,0xee,0xfe,0xee,0xee,0xef,0xe7,0x00,0x03,0xb1,0x00,
+0x98,0x10,0x00,0x3a,0xd3,0x00,0x00,0x7e,0x70,0x0a,0x86,0x01,0x52,0x19,0x30,0x00,
+0x00,0x2c,0x36,0x03,0xf0,0x20,0x00,0x00,0xcd,0xdd,0xef,0xdd,0xdd,0x6d,0x21,0x14,
+0xb1,0x11,0x87,0xd1,0x00,0x69,0x00,0x07,0x7d,0x10,0x0b,0xe4,0x00,0x77,0xd1,0x04,
+0xc2,0xd5,0x07,0x7d,0x13,0xe3,0x02,0xe4,0x77,0xd5,0xe4,0x00,0x03,0xd8,0x7d,0x11,
+0x00,0x00,0x00,0x77,0xd1,0x1d,0x02,0xf8,0x07,0x7d,0x10,0x00,0x00,0xae,0xd3,0xef,
+0xee,0xff,0xee,0xef,0xbe,0x10,0x01,0xd0,0x00,0x4b,0xe1,0x00,0x1d,0x00,0x04,0x0b,
+0x00,0x60,0xfe,0xee,0xee,0xee,0xfb,0xe1,0x63,0x02,0x10,0xbe,0x82,0x06,0x1a,0x4b,
+0x0b,0x00,0x50,0x05,0xee,0x60,0x0a,0xee,0x9b,0x00,0x40,0x20,0x00,0x00,0x0c,0xee,
+0x00,0xf1,0x19,0xae,0xee,0xfe,0xee,0xe1,0x00,0x0a,0x40,0x0c,0x20,0x0d,0x10,0x00,
+0xac,0xaa,0xfb,0xaa,0xf1,0x00,0x0a,0x62,0x2d,0x42,0x2d,0x10,0x00,0xa4,0x00,0xc2,
+0x00,0xd1,0x03,0xef,0xee,0xee,0xee,0xef,0xe9,0x00,0xa4,0xd4,0x06,0x20,0x0a,0x40,
+0xe1,0x06,0x00,0x0d,0x00,0xf2,0x0a,0xce,0xc0,0x00,0x00,0x00,0x1e,0x00,0x00,0x01,
+0x60,0x01,0xe0,0x01,0x70,0x3c,0x00,0x1e,0x00,0x1e,0x03,0xc0,0x01,0xe0,0x01,0xe0,
+0x0b,0x00,0xf1,0x07,0xff,0xff,0xff,0xff,0xe0,0x51,0x00,0x1e,0x00,0x03,0x2c,0x30,
+0x01,0xe0,0x00,0x96,0xc3,0x00,0x1e,0x00,0x09,0x6c,0x0b,0x00,0x10,0xcf,0xbc,0x00,
+0x01,0x24,0x05,0x50,0x96,0x00,0x01,0x70,0x01,0x0a,0x00,0xe0,0x9a,0x00,0x0d,0x40,
+0x00,0x00,0x2f,0x20,0x00,0x3d,0x00,0x00,0x0c,0x70,0x10,0x00,0x10,0x0c,0x5a,0x02,
+0xf0,0x0f,0xc9,0x04,0xbb,0xff,0xff,0xff,0xf6,0xa0,0x00,0x00,0x5a,0x00,0x0b,0x40,
+0x00,0x00,0x08,0x70,0x00,0xc3,0x00,0x00,0x00,0xe2,0x00,0x0d,0x20,0x00,0x00,0x9a,
+0x44,0x02,0xcb,0x01,0x9c,0x00,0x00,0x2e,0x00,0x01,0xe8,0x00,0x0a,0xef,0x70,0x9a,
+0x03,0x22,0x06,0x70,0xf2,0x02,0xf0,0x19,0x05,0xef,0xfe,0xef,0x20,0xbc,0xdc,0x30,
+0x3c,0x00,0xc2,0x01,0x12,0xd0,0x04,0xb0,0x0d,0x10,0x00,0xa5,0x10,0x59,0x00,0xd1,
+0x00,0x4f,0x5a,0x07,0x70,0x0e,0x00,0x3f,0xfe,0x00,0xa4,0x00,0xf0,0x0e,0x6c,0x98,
+0xda,0x04,0xf8,0x0a,0x22,0xc0,0x24,0xc0,0x01,0xd0,0x00,0x2c,0x00,0xb5,0x00,0x3c,
+0x00,0x02,0xc0,0x9c,0x00,0x07,0x90,0x00,0x2c,0x1c,0x10,0x9e,0xd2,0x59,0x00,0xc4,
+0x1d,0x0e,0xdd,0xdf,0x30,0x20,0x1d,0x0e,0x00,0x0b,0x33,0xa0,0x06,0x00,0xf0,0x0a,
+0xcc,0xcf,0x33,0xa0,0x1d,0x00,0x97,0x00,0x03,0xa0,0x1d,0x00,0xab,0x88,0x23,0xa0,
+0x1d,0x00,0xd6,0x5c,0x43,0xa0,0x1d,0x00,0xd0,0x1e,0x00,0x80,0x05,0xa0,0x0c,0x10,
+0x00,0x1d,0x1d,0x30,0x8e,0x05,0x69,0x67,0x0b,0xd9,0x00,0x3e,0xe9,0xa9,0x00,0xf0,
+0x04,0x01,0x6d,0x70,0x00,0x1d,0x1a,0xdf,0xc5,0x00,0x20,0x1d,0x04,0x28,0x60,0x00,
+0xe0,0x1d,0x00,0x08,0x06,0x00,0xf0,0x12,0x3c,0xce,0xec,0xc1,0xe0,0x1d,0x01,0x1e,
+0xa1,0x10,0xe0,0x1d,0x00,0x7f,0xe8,0x00,0xe0,0x1d,0x01,0xd9,0x6a,0x80,0xe0,0x1d,
+0x0c,0x58,0x60,0x50,0xd0,0x1d,0x59,0x08,0x60,0x68,0x02,0x00,0x06,0x00,0x10,0x2d,
+0x06,0x00,0x42,0x4f,0xe7,0x00,0x00,0x70,0x08,0x10,0x4b,0xa9,0x01,0xf3,0x38,0x01,
+0x12,0xe3,0x11,0x02,0x0d,0x11,0xcc,0xed,0xcc,0xb2,0xb0,0xd1,0x00,0x2d,0x10,0x30,
+0x2b,0x0d,0x10,0x1c,0x31,0x6a,0x02,0xb0,0xd1,0x09,0xed,0xee,0x10,0x2b,0x0d,0x10,
+0x00,0x3e,0x34,0x82,0xb0,0xd1,0x00,0x7c,0x21,0xd2,0x2b,0x0d,0x10,0xb9,0x01,0xd4,
+0x02,0xb0,0xd1,0x00,0x04,0xdb,0xa0,0x00,0x0d,0x10,0x19,0xd3,0x09,0xb0,0x00,0xe1,
+0x0b,0x70,0x00,0x03,0x0a,0xec,0xa2,0x00,0xf0,0x13,0x16,0x0d,0x10,0xa0,0x00,0x1d,
+0x0e,0x0d,0x12,0xc0,0x60,0x1d,0x0a,0x4d,0x18,0x61,0xd0,0x1d,0x04,0x3e,0x26,0x11,
+0xd0,0x1d,0x0e,0xdd,0xdd,0xa1,0xd0,0x1d,0x0e,0x00,0x03,0xa1,0x0c,0x00,0x18,0xde,
+0x0c,0x00,0x20,0xa0,0xa0,0x0c,0x00,0x00,0x36,0x00,0x20,0x00,0x04,0x06,0x00,0x51,
+0x02,0xed,0x60,0x4e,0xe9,0xee,0x00,0x10,0x00,0x83,0x07,0x00,0xce,0x01,0xc1,0x4d,
+0x00,0x04,0xc0,0x00,0x1e,0xee,0xfe,0xee,0xff,0xee,0x60,0x1a,0x00,0xf5,0x04,0x20,
+0x04,0xec,0xce,0x70,0xc0,0x59,0x00,0x4a,0x00,0x77,0x0e,0x05,0x90,0x04,0xeb,0xbd,
+0x70,0xe0,0x0d,0x00,0x23,0xec,0xce,0x0d,0x00,0xfb,0x01,0x05,0x05,0x90,0x04,0xa0,
+0x07,0x70,0x00,0x69,0x00,0x4a,0x0c,0xd4,0x02,0xee,0x50,0x88,0x06,0xf0,0x21,0x00,
+0x00,0x0e,0xbb,0xbf,0xbb,0xa0,0x20,0xed,0x00,0x60,0x1e,0x0d,0x0e,0x7b,0xbf,0xbc,
+0x30,0xd0,0xe0,0x33,0xe3,0x20,0x0d,0x0e,0x06,0x6e,0x64,0x00,0xd0,0xeb,0xbb,0xfb,
+0xb9,0x0d,0x0e,0x00,0x0d,0x00,0x00,0xd0,0xe3,0xdd,0xfd,0xe0,0x0c,0x0e,0x39,0x0c,
+0x00,0xd1,0xe3,0xda,0xaa,0xf0,0x00,0x0e,0x3a,0x11,0x1c,0x00,0x6e,0xb0,0x00,0x08,
+0x08,0x04,0x06,0x00,0x50,0x0e,0x20,0x00,0x00,0x3e,0xa5,0x04,0x11,0xf5,0xb8,0x04,
+0x10,0xa5,0x6d,0x01,0x00,0xec,0x05,0x20,0x79,0x00,0xef,0x06,0x50,0xd3,0x00,0x00,
+0xe1,0x00,0xfc,0x04,0x10,0xf0,0x28,0x05,0x40,0x02,0xd0,0x07,0xf4,0x8d,0x0a,0x65,
+0x5d,0x30,0x00,0x0e,0xee,0x30,0x94,0x00,0x00,0x88,0x08,0xb0,0x88,0x88,0x50,0x1e,
+0x00,0x00,0x08,0x9e,0x85,0x01,0xe0,0xa4,0x00,0xf0,0x1a,0x4e,0xff,0xee,0xe5,0x00,
+0x2c,0x00,0x02,0xc0,0x0a,0x40,0x02,0xc0,0x00,0x4a,0x00,0xa4,0x00,0x2c,0x00,0x07,
+0x80,0x0b,0x30,0x02,0xc4,0x70,0xc3,0x00,0xc2,0x17,0xcf,0xa5,0x2e,0x00,0x0e,0x11,
+0x84,0x00,0x0b,0x60,0x25,0x05,0x96,0x0a,0xc0,0x00,0x4c,0x00,0x00,0x08,0xa0,0x08,
+0xeb,0x00,0x13,0x3b,0x06,0x00,0xf0,0x20,0x05,0x77,0x76,0x2b,0xce,0xbb,0x4b,0x97,
+0x8e,0x03,0x7b,0x3b,0x5b,0x20,0x0e,0x00,0x68,0x0a,0x4b,0x20,0x0e,0x00,0x86,0x0b,
+0x3b,0x20,0x0e,0x00,0xa4,0x0c,0x2b,0x20,0x0e,0x00,0xc2,0x0d,0x1b,0x20,0x0e,0x00,
+0xe0,0x0e,0x0b,0x20,0x0e,0x05,0xa0,0x06,0x00,0xc2,0x0d,0x50,0x4c,0x0b,0xfe,0xfe,
+0x4b,0x0d,0xe5,0x0b,0x20,0x0e,0x8d,0x01,0x04,0x21,0x07,0x10,0xd1,0xae,0x01,0xfa,
+0x39,0x02,0x29,0x62,0x20,0x3a,0x00,0x01,0xcc,0xcc,0xcb,0x03,0xa0,0x00,0x00,0x81,
+0x16,0x0c,0xef,0xee,0x10,0x4b,0x00,0xb4,0x05,0x80,0xc1,0x1d,0x20,0x36,0xd0,0x67,
+0x0d,0x00,0x39,0x4a,0x41,0x08,0x50,0xd0,0x00,0x1d,0xd0,0x00,0xc2,0x0e,0x00,0x00,
+0x9e,0x10,0x1d,0x00,0xe0,0x00,0x5c,0x6c,0x08,0x70,0x0d,0x00,0x6d,0x10,0x43,0xd1,
+0x03,0xb0,0x1b,0x10,0x00,0xc3,0x0d,0xe5,0x00,0x95,0x01,0xf6,0x3c,0x47,0xb8,0x0a,
+0x30,0x00,0x1b,0xad,0x95,0x20,0xa3,0x00,0x03,0x99,0xdb,0x99,0x0a,0x30,0x00,0x02,
+0x2a,0x62,0x3e,0xfe,0xee,0x20,0xe7,0xc9,0x8c,0x0c,0x20,0xc1,0x0e,0xad,0xba,0xc0,
+0xe0,0x0d,0x10,0xc1,0xa5,0x1c,0x0e,0x00,0xd0,0x09,0x9d,0xb9,0x72,0xc0,0x0e,0x00,
+0xaa,0xdb,0xa8,0x88,0x00,0xe0,0x01,0x1a,0x51,0x1e,0x20,0x1d,0x02,0x68,0xdd,0xdf,
+0xa0,0x04,0xb0,0x27,0x64,0x22,0xc0,0x4d,0x5b,0x00,0x02,0xed,0x02,0x20,0x1e,0x11,
+0xe7,0x09,0xf0,0x0f,0x09,0x80,0x1e,0x00,0x01,0x00,0x02,0xf1,0x01,0xe0,0x02,0xe3,
+0x00,0xce,0x00,0x1e,0x00,0xc8,0x00,0xad,0xe0,0x01,0xe0,0xbb,0x00,0x1d,0x2e,0x00,
+0x1f,0xca,0xd4,0x07,0x20,0x04,0xf8,0x2d,0x00,0x20,0x19,0xfe,0xf0,0x00,0x50,0xe3,
+0x92,0xe0,0x00,0x26,0xa5,0x04,0xf3,0x01,0x00,0x04,0xa0,0x01,0xe0,0x00,0xf0,0x00,
+0x78,0x00,0x1e,0x00,0x0b,0xfe,0xfd,0x20,0x5a,0x00,0xf1,0x26,0x09,0x50,0x69,0x00,
+0x2e,0x10,0x00,0x2e,0x10,0xe2,0x0b,0x70,0x00,0x0b,0xec,0xce,0xdd,0xfd,0x40,0x00,
+0xd1,0x00,0xd2,0x00,0xa5,0x00,0x0d,0xa9,0x9f,0xa9,0x9d,0x50,0x00,0xd3,0x22,0xd4,
+0x22,0xb5,0x00,0x0d,0x10,0x0d,0x20,0x0a,0x50,0x00,0xbc,0xcc,0xfd,0xcc,0xc4,0x00,
+0x00,0x93,0x04,0x11,0x1e,0x59,0x05,0x11,0x60,0x0d,0x00,0x00,0x01,0x00,0x14,0xd2,
+0xf7,0x0b,0x23,0x00,0x00,0x6d,0x05,0x00,0x17,0x05,0x14,0xf8,0x0d,0x00,0x02,0x1a,
+0x00,0xf7,0x1c,0x33,0x33,0x3d,0x53,0x33,0x31,0x0b,0xbb,0xcf,0xcb,0xbb,0xbb,0x60,
+0x00,0x07,0xb0,0x05,0x10,0x00,0x00,0x02,0xe1,0x00,0x7b,0x00,0x00,0x00,0xc4,0x00,
+0x00,0xa8,0x00,0x00,0xbc,0x89,0xab,0xce,0xf3,0x00,0x0a,0x86,0x54,0x21,0xde,0x06,
+0xf2,0x0f,0x23,0x56,0x8b,0xc1,0x00,0xac,0xba,0xab,0x65,0x33,0x00,0x00,0x95,0x02,
+0xc0,0x05,0xb0,0x00,0x02,0xb0,0x0b,0x10,0xd2,0x00,0x0f,0xdd,0xdd,0xdd,0xdd,0xdf,
+0xfd,0x0a,0xc0,0xd0,0x09,0x6e,0xee,0xee,0xee,0x38,0x00,0x00,0xa7,0x00,0x06,0xd6,
+0x07,0x21,0xc8,0x06,0x91,0x00,0xf6,0x02,0xce,0xd1,0x00,0x00,0x01,0x48,0xda,0x5a,
+0xe9,0x52,0x00,0xc9,0x61,0x00,0x01,0x69,0xc1,0xfb,0x0c,0x02,0xe5,0x06,0x00,0x60,
+0x00,0xc0,0xaa,0xac,0xea,0xaa,0xaa,0xa1,0x03,0x34,0xd7,0x33,0x33,0x33,0xab,0x03,
+0x01,0xc2,0x00,0x01,0xa7,0x03,0xf1,0x07,0x07,0xff,0xee,0xee,0xef,0x30,0x07,0xea,
+0x70,0x00,0x00,0xc3,0x04,0xd1,0x77,0x00,0x00,0x0c,0x30,0x01,0x07,0x70,0x3d,0x00,
+0x20,0x7e,0xdd,0x8b,0x0c,0x21,0x07,0x70,0x50,0x0d,0x51,0x8e,0xdd,0xdd,0xde,0x80,
+0xa1,0x04,0x14,0x68,0x0d,0x00,0x03,0x40,0x05,0x10,0xdd,0x01,0x00,0x32,0x10,0x00,
+0xa7,0xa1,0x0b,0xa2,0x52,0x22,0x22,0x10,0x00,0x02,0xbb,0xbb,0xbb,0xe7,0x81,0x0c,
+0x21,0x40,0x00,0x86,0x09,0x00,0x05,0x00,0x2d,0xdd,0xd7,0xad,0x09,0x21,0x08,0x90,
+0xdc,0x05,0x20,0xdd,0x40,0x0c,0x00,0xf6,0x03,0xb0,0x3e,0x60,0x00,0x00,0x4d,0x80,
+0x00,0x1b,0xc4,0x00,0xce,0xbd,0xdd,0xdd,0xe7,0xe9,0x04,0x1b,0x02,0x00,0xdf,0x08,
+0x71,0xdd,0xdd,0xdd,0xe0,0x00,0x03,0xc0,0xa8,0x06,0x11,0x3c,0x55,0x00,0x54,0x03,
+0xfd,0xdd,0xdd,0xee,0x0d,0x00,0x10,0xde,0xf6,0x07,0x20,0xdd,0x10,0x93,0x00,0x53,
+0xd1,0xcd,0xdd,0xdd,0x81,0x0b,0x00,0xf0,0x0e,0x3d,0xdd,0xdc,0x01,0xdd,0x14,0x90,
+0x00,0xe0,0x1d,0xd1,0x49,0x00,0x0e,0x01,0xdd,0x14,0xea,0xaa,0xe0,0x1d,0xd1,0x4a,
+0x22,0x22,0x01,0xdd,0x10,0x20,0x21,0x00,0x44,0x00,0x00,0x03,0xee,0xcd,0x00,0x01,
+0x2f,0x09,0xf0,0x05,0x03,0xfe,0xcc,0xcc,0x80,0x07,0xd3,0x11,0x12,0xe4,0x0c,0xc4,
+0x20,0x00,0xb9,0x00,0x40,0x4e,0x41,0xba,0xd1,0x08,0x10,0xe7,0xee,0x0d,0xb0,0xf6,
+0x33,0x32,0x29,0xef,0xbb,0xbb,0xbb,0xe1,0x41,0xd1,0x89,0x00,0x20,0x0d,0x10,0x7b,
+0x00,0xa9,0xdd,0xcc,0xcc,0xde,0x00,0x0d,0x21,0x11,0x12,0xe0,0xd8,0x00,0xf0,0x01,
+0xe3,0x00,0x00,0x0c,0xdd,0xdf,0xdd,0xdd,0xda,0xd2,0x11,0x11,0x11,0x14,0xbd,0x10,
+0xe7,0x03,0xf0,0x0f,0xd1,0x0f,0xdd,0xde,0x03,0xbd,0x10,0xd0,0x00,0xe0,0x3b,0xd1,
+0x0d,0x00,0x0e,0x03,0xbd,0x10,0xfc,0xcc,0xe0,0x3b,0xd1,0x0e,0x00,0x00,0x03,0xbd,
+0x10,0x20,0x21,0x00,0xf1,0x00,0x00,0x00,0x09,0xfe,0x60,0x1e,0xee,0xee,0xff,0xee,
+0xee,0x10,0x00,0x00,0x2d,0xa6,0x01,0xf0,0x06,0x6e,0xf2,0xa3,0x00,0x00,0x05,0xdb,
+0x1f,0x05,0xcb,0x10,0x3e,0xc4,0x00,0xf0,0x00,0x6e,0x20,0x30,0x00,0x0d,0x1b,0x01,
+0x50,0x9d,0xdd,0xdd,0xdd,0xa0,0xc8,0x07,0x00,0x57,0x04,0x20,0xa4,0x00,0x84,0x05,
+0xc0,0x0a,0xcb,0xbb,0xbb,0xcc,0x00,0x00,0xa6,0x22,0x22,0x25,0xb0,0xce,0x00,0x11,
+0xa0,0xb6,0x03,0x20,0xdc,0x50,0xdf,0x00,0xf1,0x07,0xd3,0x0a,0x90,0x00,0x00,0x4b,
+0xc2,0xb7,0x07,0xe8,0x20,0x6c,0x40,0x00,0x83,0x01,0x8b,0x00,0x0a,0xdd,0xdd,0xde,
+0xad,0x00,0xf0,0x01,0x03,0xd1,0x00,0x00,0x02,0x22,0x23,0xe6,0x20,0x00,0x00,0xdb,
+0xaa,0xaa,0xae,0x30,0x34,0x05,0x00,0x06,0x02,0xf0,0x01,0xdb,0xbb,0xbb,0xbf,0x30,
+0x00,0x0d,0x32,0x22,0x22,0xd3,0x00,0x00,0x0b,0x10,0xb4,0x47,0x00,0x11,0xc0,0xd7,
+0x01,0x11,0xce,0xcd,0x0a,0x11,0x8b,0xe4,0x01,0x20,0x06,0x10,0x49,0x05,0x11,0x02,
+0x7a,0x09,0x14,0xe2,0x05,0x01,0x50,0xee,0xee,0xee,0xe9,0x00,0x7b,0x0e,0x21,0x04,
+0xa0,0x3a,0x02,0xf0,0x00,0x4a,0x00,0x00,0x8d,0xbb,0xbb,0xbd,0xa0,0x00,0x08,0x82,
+0x22,0x22,0x6a,0x00,0xf3,0x03,0x00,0xee,0xee,0xfe,0xee,0xeb,0x00,0xe0,0x00,0xe0,
+0x00,0x3b,0x00,0xe2,0xcc,0xfc,0xc5,0x3b,0x0c,0x00,0x40,0xe6,0xcc,0xdc,0xcb,0x0c,
+0x00,0xf1,0x13,0x00,0x00,0x3b,0x01,0xd0,0xec,0xcc,0xf0,0x3b,0x03,0xb0,0xe0,0x00,
+0xe0,0x3b,0x07,0x70,0xea,0xaa,0xf0,0x3b,0x0d,0x20,0xe1,0x11,0x10,0x4b,0x3a,0x00,
+0x10,0x00,0x9d,0xd6,0x00,0x01,0x00,0xf0,0x3e,0xdc,0xcc,0xd0,0xfc,0xcc,0xed,0xba,
+0xbd,0x0f,0xaa,0xbe,0xd1,0x01,0xd0,0xe0,0x01,0xed,0xcc,0xcd,0x0f,0xbb,0xce,0xd1,
+0x00,0x00,0x00,0x01,0xed,0x10,0xcc,0xcc,0xa0,0x1e,0xd1,0x0d,0x00,0x1d,0x01,0xed,
+0x10,0xd0,0x01,0xd0,0x1e,0xd1,0x0f,0xdd,0xdd,0x01,0xed,0x10,0xa0,0x00,0x00,0x2e,
+0xd1,0x00,0x00,0x03,0xfe,0x80,0x02,0xfd,0xde,0x0a,0xdd,0xe8,0x00,0x2b,0x00,0xe0,
+0xa3,0x05,0x80,0x02,0xfd,0xdf,0x0d,0x00,0xf0,0x52,0x00,0x00,0x89,0x07,0x91,0x00,
+0x0b,0xbb,0xbf,0xcb,0xbe,0xdb,0x50,0x22,0x8d,0x32,0x2b,0xa2,0x21,0x01,0x9c,0x10,
+0x00,0x09,0xc5,0x01,0xef,0xdd,0xf0,0xbd,0xde,0xd7,0x00,0xe0,0x0d,0x0b,0x20,0x86,
+0x00,0x0e,0x00,0xd0,0xb2,0x08,0x60,0x00,0xed,0xde,0x0b,0xdd,0xe6,0x00,0xef,0xff,
+0xff,0xff,0xff,0xee,0x10,0x00,0x00,0x00,0x1e,0xe1,0x02,0x22,0x22,0x01,0xee,0x10,
+0xfb,0xbb,0xf0,0x1e,0xe1,0x0e,0x00,0x0f,0x01,0xee,0x10,0xe0,0x00,0xf0,0x1e,0xe1,
+0x0f,0xbb,0xbf,0x01,0xee,0x10,0x11,0x11,0x10,0x1e,0xe1,0x9b,0x00,0xd1,0xee,0xdd,
+0xdd,0xdd,0xdd,0xde,0xe2,0x00,0x00,0x00,0x02,0xe0,0xee,0x01,0x00,0xf2,0x01,0x10,
+0x06,0x01,0x50,0x1e,0xe1,0x01,0xb0,0x2a,0x01,0xee,0x1c,0xdf,0xcd,0xfc,0x4e,0x0b,
+0x00,0xf0,0x13,0x2d,0xdf,0xdd,0xfd,0x5e,0xe1,0x08,0x60,0x2a,0x01,0xee,0x13,0xe1,
+0x02,0xa0,0x1e,0xe1,0x93,0x00,0x17,0x01,0xee,0xbb,0xbb,0xbb,0xbb,0xbe,0xe4,0x22,
+0x22,0x22,0x24,0xe0,0xde,0x3c,0x00,0xf0,0x05,0xed,0x10,0x00,0xb0,0x00,0x1e,0xd1,
+0x11,0x1e,0x11,0x11,0xed,0x1a,0xaa,0xfa,0xaa,0x1e,0xd1,0x00,0x0e,0xff,0x00,0x30,
+0xfc,0xcc,0xf0,0xff,0x00,0xe1,0x0e,0x01,0xed,0x10,0xe7,0x77,0xf0,0x1e,0xd1,0x03,
+0x33,0x33,0x01,0xed,0x3d,0x00,0x53,0xd4,0x33,0x33,0x33,0x34,0x3d,0x00,0x10,0x11,
+0x96,0x00,0xf2,0x12,0xd1,0xbc,0xdf,0xcc,0x91,0xed,0x10,0x01,0xc0,0x00,0x1e,0xd1,
+0x7c,0xdf,0xcc,0x41,0xed,0x10,0x02,0xc2,0x70,0x1e,0xd1,0x00,0x1c,0x09,0x41,0xed,
+0x2c,0xcc,0xfc,0xcc,0x1e,0x52,0x01,0xd0,0xcc,0xcc,0xcc,0xcc,0xce,0xd3,0x11,0x11,
+0x11,0x13,0xe0,0x00,0xfe,0x3e,0x00,0xf1,0x01,0x50,0x0f,0x00,0x00,0x20,0x00,0x00,
+0x00,0xf0,0x00,0x0e,0x00,0x00,0x00,0x0f,0x00,0xb9,0x01,0xe1,0xf3,0xbb,0xbf,0xbb,
+0xb8,0x00,0x1e,0x13,0x33,0xe4,0x33,0x20,0x02,0xd0,0x1a,0x00,0x11,0x3b,0x1a,0x00,
+0x21,0x07,0x80,0x0d,0x00,0x80,0xc4,0x22,0x22,0xe3,0x22,0x21,0x1d,0x2b,0x8b,0x00,
+0x23,0x60,0x00,0x01,0x00,0x11,0x1c,0x06,0x00,0xe1,0x06,0xa0,0x00,0x00,0x00,0x2e,
+0xee,0xff,0xee,0xee,0xee,0x20,0x00,0x5c,0x13,0x00,0x80,0x1e,0x30,0x03,0xa0,0x00,
+0x00,0x0a,0xa0,0x44,0x00,0x90,0x0b,0xf7,0x2e,0xee,0xfe,0xe9,0x04,0xb7,0x70,0x0d,
+0x00,0x89,0x00,0x77,0x00,0x03,0xb0,0x00,0x00,0x07,0x0d,0x00,0x53,0x79,0xee,0xef,
+0xee,0xe2,0x53,0x00,0xa1,0x09,0x50,0x00,0xb4,0x00,0x00,0x00,0x95,0x00,0x2d,0x0d,
+0x00,0xf1,0x22,0x0b,0xee,0xee,0xf3,0x3e,0xff,0xd7,0xb0,0x00,0x0b,0x30,0x09,0x50,
+0xc4,0x50,0x00,0xb2,0x00,0x95,0x00,0x0b,0x80,0x0c,0x20,0x09,0x50,0x00,0x0b,0x30,
+0xc1,0x00,0x96,0x73,0x00,0x2a,0x6d,0x00,0x1b,0xf8,0x12,0xac,0x40,0xe0,0x2e,0x91,
+0x04,0xe6,0x00,0x0e,0xda,0x00,0x20,0x04,0xb0,0x4b,0x00,0x24,0xde,0xe4,0xa8,0x00,
+0x11,0x85,0x06,0x00,0xf6,0x00,0x08,0x50,0xae,0xdf,0xdd,0xf0,0x00,0x85,0x0a,0x40,
+0xe0,0x0e,0x01,0xff,0xfc,0x0d,0x00,0xf0,0x0e,0x00,0x08,0x50,0xa5,0x1e,0x11,0xe0,
+0x00,0x85,0x07,0xcc,0xfc,0xcc,0x00,0x08,0x99,0x00,0x0f,0x10,0x00,0x17,0xed,0x4b,
+0xee,0xfe,0xee,0x31,0xd5,0x00,0x0d,0x00,0x00,0x01,0x00,0x92,0xf1,0x00,0x00,0x00,
+0x0b,0xee,0xef,0xfe,0xea,0xf6,0x00,0xf0,0x2b,0x01,0xcc,0xfc,0x96,0xfd,0xde,0xd0,
+0x01,0x2c,0x10,0x68,0x00,0x1d,0x01,0x24,0xd2,0x26,0x80,0x68,0xc0,0x5c,0xba,0xdb,
+0x78,0x06,0x62,0x00,0x57,0x0c,0x16,0xeb,0xaa,0xc0,0x3d,0xee,0xeb,0x6a,0xd0,0x3c,
+0x00,0x01,0xc0,0x06,0x8a,0x6a,0x70,0x5b,0xbe,0xbb,0x78,0x2d,0xe0,0x01,0x13,0xc1,
+0x16,0x80,0xdc,0x37,0x01,0xb9,0x68,0xc9,0x9b,0x10,0x01,0xc0,0x06,0xe8,0x00,0x84,
+0x00,0x01,0x00,0xf0,0x28,0x2a,0x10,0x01,0xd7,0x00,0x00,0x00,0x5a,0x04,0xc3,0x8a,
+0x20,0x00,0x71,0x3c,0xe7,0x66,0xae,0xc3,0x05,0xd3,0x32,0x5b,0x85,0x14,0x10,0x00,
+0x09,0xbb,0xed,0xbb,0x70,0x00,0x47,0x06,0x18,0x53,0x40,0x00,0x0c,0x17,0xa0,0x85,
+0x0b,0x50,0x09,0x51,0x80,0xbc,0x20,0x07,0x00,0x10,0x00,0x05,0xa2,0x00,0xf3,0x06,
+0x9c,0xcc,0xfd,0xcc,0xc5,0x00,0x00,0x00,0x0c,0x20,0x00,0x00,0x1c,0xcc,0xcc,0xfd,
+0xcc,0xcc,0x70,0x00,0x00,0xf8,0x00,0xf1,0x33,0x0a,0x50,0x0a,0x70,0x00,0x85,0x00,
+0x2b,0x01,0xe0,0x00,0x08,0x50,0xdc,0xbf,0xbb,0xe6,0x09,0xdb,0x6d,0x00,0xe0,0x08,
+0x60,0x6b,0x94,0xdb,0xbf,0xbb,0xd6,0x00,0x85,0x0d,0x44,0xe4,0x4a,0x60,0x08,0x50,
+0x56,0x66,0x66,0x62,0x00,0x86,0x64,0xdc,0xcc,0xcd,0x00,0x4d,0xe8,0x59,0x00,0x00,
+0xe0,0x2c,0x60,0x04,0xeb,0xbb,0xbe,0x00,0x00,0x00,0x49,0x0b,0x02,0x02,0x0d,0x00,
+0x00,0x39,0x02,0x83,0x00,0x00,0xdd,0xdd,0xdf,0xdd,0xdd,0xd0,0x0d,0x00,0x10,0x3d,
+0x0d,0x00,0x04,0x16,0x02,0x10,0x0d,0x28,0x03,0xf0,0x0f,0x20,0x00,0xf0,0x00,0xe0,
+0x00,0xb3,0x00,0x0f,0x00,0x0e,0x00,0x0b,0x30,0x02,0xfd,0xdd,0xdd,0xdd,0xf3,0x00,
+0x69,0x00,0x00,0x00,0x05,0x10,0x0d,0x30,0x00,0x08,0x00,0x2a,0x80,0x00,0x01,0x00,
+0x02,0x66,0x01,0x12,0x2e,0x41,0x00,0xf1,0x12,0xfe,0xdd,0xdd,0x00,0x00,0x17,0x70,
+0x77,0x10,0x00,0x00,0x79,0x77,0x07,0x7a,0x70,0x00,0x3d,0x07,0x70,0x77,0x0b,0x70,
+0x08,0x20,0x57,0x06,0x50,0x07,0x00,0x00,0x08,0xc0,0x2b,0x02,0xf3,0x10,0xec,0xcc,
+0xdf,0x10,0x00,0x5d,0x9c,0x30,0x0c,0x60,0x00,0x06,0x20,0x1d,0x8d,0x50,0x00,0x00,
+0x01,0x49,0xdb,0xe9,0x41,0x00,0x1d,0xd9,0x50,0x00,0x5a,0xde,0x20,0x59,0x00,0x11,
+0x1d,0xbc,0x00,0x21,0x06,0xa0,0xc7,0x02,0xf0,0x1a,0xbf,0xee,0xa0,0xe0,0x00,0x00,
+0x1e,0x00,0x68,0x0e,0x00,0x00,0x08,0x80,0x0a,0x50,0xfb,0x10,0x02,0xe8,0x40,0xe1,
+0x0e,0x6d,0x20,0x03,0x2d,0xbb,0x00,0xe0,0x5e,0x20,0x00,0x0e,0x40,0x0e,0x00,0x51,
+0x00,0x08,0xc0,0x34,0x00,0x30,0x05,0xe1,0x00,0x27,0x00,0x10,0xe3,0x41,0x00,0x56,
+0x02,0xb1,0x00,0x00,0x0e,0xae,0x00,0x11,0x89,0x81,0x00,0xe1,0xfe,0xdd,0xd1,0x00,
+0x04,0xd8,0x00,0x0a,0x80,0x00,0x3c,0x3b,0x40,0xaa,0x6e,0x03,0xf0,0x0a,0x72,0x00,
+0x00,0x02,0x7d,0xa3,0xaa,0x00,0x00,0xad,0x82,0x1b,0xee,0xee,0xe0,0x00,0x06,0xe6,
+0x00,0x0b,0x60,0x01,0xd9,0x2c,0x30,0x1f,0x00,0xd5,0x03,0xed,0x60,0x00,0x00,0x14,
+0xae,0xa2,0x00,0x00,0xae,0xda,0x50,0xf4,0x00,0x03,0x45,0x01,0x01,0x8b,0x03,0x00,
+0x44,0x00,0x02,0x0d,0x00,0x11,0x3d,0x55,0x03,0x91,0xef,0xff,0xee,0xee,0x30,0x00,
+0x00,0x8f,0x80,0x5a,0x01,0x11,0x5e,0x3a,0x01,0x20,0xd0,0xb7,0x07,0x00,0x20,0xd4,
+0x02,0x33,0x03,0xd0,0xc9,0x00,0x07,0xe2,0x00,0x03,0xda,0x00,0x00,0x08,0xe5,0x02,
+0xd5,0x1d,0x00,0x16,0xd2,0xa4,0x00,0x12,0xd1,0x8f,0x01,0x00,0x65,0x00,0xf0,0x0c,
+0xaf,0xee,0xff,0xee,0xf2,0x00,0x0a,0x40,0x0d,0x10,0x0d,0x20,0x00,0xa4,0x00,0xd1,
+0x00,0xd2,0x00,0x0a,0x40,0x0f,0x00,0x0d,0x20,0x1f,0xff,0x01,0x00,0x50,0x70,0x00,
+0x00,0x8b,0xd0,0x2d,0x00,0x20,0x3e,0x29,0x69,0x00,0xd0,0x4e,0x50,0x0c,0x80,0x00,
+0x03,0xad,0x30,0x00,0x0a,0xd6,0x10,0xa5,0xb7,0x00,0x50,0x95,0x00,0x0a,0x10,0xd1,
+0x09,0x00,0x11,0xe0,0x4e,0x00,0xf0,0x00,0x9f,0xdd,0xfd,0xdd,0xd4,0x00,0x2e,0x22,
+0x2e,0x32,0x22,0x00,0x0c,0x70,0x00,0x1e,0x05,0x11,0x20,0xbd,0x00,0x02,0x4e,0x00,
+0x51,0x60,0x00,0x00,0x7c,0xc0,0xcd,0x01,0x10,0x2b,0x14,0x02,0xf4,0x03,0x2d,0x60,
+0x1d,0x60,0x00,0x01,0x8e,0x60,0x00,0x2d,0xb3,0x00,0xd8,0x10,0x00,0x00,0x07,0xd7,
+0xa1,0x00,0xf0,0x2e,0x0b,0x20,0x12,0x35,0x83,0x00,0x80,0xb4,0xba,0xb8,0x66,0x30,
+0x06,0x8b,0x2a,0x37,0x61,0xc2,0x00,0x03,0xb2,0x25,0x04,0x5b,0x00,0x00,0x3d,0x5b,
+0xdb,0xbc,0xfb,0x61,0xba,0xd2,0x0b,0x40,0x2c,0x00,0x02,0x0b,0x20,0x27,0x47,0xb0,
+0x00,0x00,0x51,0x0f,0x12,0x41,0x00,0x1c,0xcc,0xcd,0xfc,0xcc,0xcc,0x50,0x00,0x01,
+0xc6,0xe9,0x00,0xf1,0x01,0x27,0xe6,0x03,0xd8,0x30,0x01,0xdb,0x71,0x00,0x00,0x6b,
+0xd5,0x00,0x00,0x08,0x00,0x1f,0x01,0x10,0xa0,0x80,0x04,0x03,0x8e,0x04,0x12,0x4c,
+0x03,0x01,0xf1,0x12,0x27,0xdd,0xdd,0xe4,0x00,0x0b,0x80,0x00,0x01,0xb7,0x00,0x1c,
+0xe7,0x00,0x00,0xe3,0x00,0x04,0x78,0x76,0xaa,0xbf,0xaa,0xa4,0x00,0x77,0x23,0x33,
+0xf3,0x33,0x10,0x07,0x70,0xdb,0x01,0x12,0x77,0xf0,0x04,0x37,0x70,0x0d,0xea,0x97,
+0x02,0x10,0x03,0x46,0x03,0xe0,0x22,0x22,0x3f,0x32,0x22,0x20,0x0d,0xcb,0xbb,0xbb,
+0xbb,0xcd,0x00,0xd0,0x02,0x06,0x73,0xd0,0x09,0x0e,0xee,0xee,0xee,0x19,0x25,0x00,
+0x31,0x2e,0xee,0xee,0x6f,0x00,0x31,0x0d,0x20,0x77,0xce,0x01,0x10,0x07,0x35,0x00,
+0xf4,0x04,0x5b,0x00,0x77,0x00,0x53,0x00,0x4e,0x30,0x07,0x70,0x0a,0x42,0xdb,0x30,
+0x00,0x4e,0xee,0xd1,0x01,0x55,0x00,0x13,0x02,0x55,0x00,0x40,0x42,0x22,0x20,0x0e,
+0x51,0x05,0x11,0xce,0x83,0x05,0x84,0x01,0xe0,0x08,0x3e,0xee,0xee,0xee,0x58,0x0a,
+0x02,0x31,0x2c,0x00,0xf0,0x5e,0x05,0x61,0x0f,0xee,0xec,0x00,0x00,0xae,0x0d,0x00,
+0x30,0x0e,0x99,0x0f,0xd1,0x03,0xdb,0x90,0xbb,0xf1,0x00,0x00,0x03,0xd1,0x00,0x5b,
+0xef,0xff,0xf3,0x01,0x48,0x03,0x10,0x2d,0x04,0x04,0xd0,0xdd,0xdd,0xfd,0xdd,0xdc,
+0x00,0xf0,0x00,0x16,0x00,0x01,0xe0,0x0a,0xd7,0x00,0x71,0x09,0x00,0x0b,0xcc,0xdf,
+0xcc,0xcb,0x66,0x00,0x00,0x42,0x00,0x40,0xcc,0xcf,0xcc,0xc8,0xde,0x00,0xf1,0x0f,
+0xc0,0x00,0x00,0x02,0xcc,0xcc,0xff,0xec,0xcc,0xc2,0x00,0x00,0x6d,0x2d,0x20,0x00,
+0x00,0x03,0xbc,0x10,0x3d,0x72,0x00,0x1c,0xc5,0x00,0x00,0x18,0xed,0x10,0xa0,0x02,
+0x1a,0x20,0x9d,0x03,0x03,0x04,0x08,0xf0,0x27,0x04,0x00,0x02,0x02,0xd0,0x06,0x09,
 0xa0,0x02,0xd7,0x16,0x00,0x1b,0xb0,0x2f,0x20,0xaa,0x00,0x08,0x80,0x1d,0x9d,0x20,
 0x94,0x00,0x00,0x2d,0x40,0x6e,0x30,0x00,0x00,0x7f,0x61,0x11,0x6f,0xa1,0x03,0xec,
-0xfb,0xbb,0xbb,0xfa,0xf2,0x03,0x2c,0x00,0x00,0x0e,0x11,0x1e,0x0e,0x00,0x2c,0x02,
-0x81,0x2f,0xdd,0xdd,0xdf,0x10,0x00,0x00,0x65,0xfd,0x11,0x20,0x01,0xd1,0xa1,0x03,
-0x40,0x7d,0xde,0xdd,0x10,0x23,0x15,0x80,0x08,0x5c,0xee,0xef,0xe5,0x06,0x00,0xc3,
-0x1a,0x00,0xa0,0x8a,0x1f,0x04,0x40,0x1d,0x00,0x00,0xbb,0xa0,0x2d,0x27,0x00,0xf0,
-0x09,0xe7,0x00,0xa5,0x1d,0x00,0x00,0x4e,0xe1,0x03,0x41,0xd0,0x00,0x1d,0x39,0x80,
-0x00,0x1d,0x00,0x2d,0x70,0x15,0x00,0x02,0xd0,0xb5,0x21,0x27,0x1f,0xf8,0xff,0x00,
-0x02,0xff,0x1e,0x07,0xb4,0x05,0x50,0x06,0x70,0x0f,0x10,0x94,0x0e,0x33,0xf0,0x03,
-0xf1,0x04,0xd0,0x00,0x0f,0x10,0x0f,0x10,0x0c,0x50,0x06,0xc0,0x00,0xf1,0x00,0x5c,
-0x00,0xe3,0x27,0x00,0x20,0xf2,0x4b,0x27,0x00,0x21,0x0a,0x70,0x34,0x00,0x14,0x20,
-0x41,0x00,0x29,0x4f,0xfb,0x22,0x10,0x13,0xd0,0x49,0x04,0x00,0xc4,0x3d,0x80,0x01,
-0xd0,0x08,0x40,0x00,0x09,0x60,0x1d,0x9c,0x2f,0x70,0xd0,0x01,0xd0,0x00,0x79,0x00,
-0xc5,0x1a,0x00,0x71,0xe2,0x05,0x00,0x01,0xd0,0x01,0x13,0x27,0x00,0x11,0xc7,0xe4,
-0x01,0x01,0xca,0x29,0x80,0x28,0xe5,0x00,0x00,0x03,0x69,0xdc,0x71,0x10,0x00,0x18,
-0x62,0x54,0x00,0x02,0xa3,0x06,0x01,0xff,0x29,0xd4,0x00,0xcc,0xce,0xdc,0xcc,0xcc,
-0xc0,0x02,0x23,0xf3,0x22,0x22,0x22,0xc0,0x1c,0x12,0x09,0x20,0x05,0x50,0xec,0xee,
-0xff,0xee,0xa0,0xbe,0x47,0x11,0x30,0x1a,0x26,0x11,0xb3,0x00,0x1f,0x11,0x0b,0x89,
-0x37,0x00,0x0d,0x00,0x20,0x12,0x0e,0x12,0x27,0x10,0x40,0xce,0x09,0x11,0x28,0x73,
-0x02,0x20,0x0b,0x60,0xc6,0x09,0x10,0xfe,0xc7,0x09,0x01,0x6f,0x05,0x63,0x00,0xdd,
-0xdf,0xed,0xdd,0xd0,0xf6,0x01,0x04,0xa4,0x07,0x21,0x3f,0x10,0xce,0x01,0x10,0xbe,
-0x76,0x07,0x20,0x7f,0x60,0x34,0x0a,0x81,0x2b,0x3a,0xaa,0xae,0xca,0xaa,0x10,0x00,
-0x13,0x2e,0xf1,0x02,0x08,0x40,0x0f,0x00,0x66,0x00,0x3d,0x00,0xf0,0x1d,0x10,0xcd,
-0xed,0xdf,0xdd,0xdd,0xce,0xfd,0x00,0x62,0xd0,0xeb,0xbb,0xbb,0xd1,0xc0,0xd2,0x16,
-0xf1,0x12,0xab,0xbf,0xbb,0xa0,0x00,0x11,0x11,0xe2,0x11,0x10,0x1f,0xcc,0xcf,0xdc,
-0xcf,0x11,0xe0,0x00,0xe1,0x00,0xe1,0x1e,0x00,0x0e,0x12,0x2f,0x10,0x90,0x00,0xe1,
-0x6a,0x80,0x06,0xc2,0x1c,0x60,0x00,0x02,0x20,0x0d,0x20,0x15,0x92,0x02,0x10,0xd2,
-0xc6,0x2f,0xd0,0xb4,0x0d,0x20,0xd1,0x00,0x00,0x04,0x30,0xd2,0x25,0x00,0x00,0xbb,
-0x3d,0x21,0x51,0xb5,0x03,0x33,0x33,0xd5,0xe1,0x27,0x09,0xb0,0x0d,0x0a,0xbd,0x0d,
-0x03,0x16,0x08,0x20,0x70,0x00,0x17,0x0f,0xd0,0xdf,0xcc,0xcc,0x30,0x1d,0x11,0x61,
-0x11,0x61,0x10,0x01,0xd0,0x0e,0xe1,0x19,0x81,0x1d,0xac,0xfc,0xcc,0xfd,0xc2,0x02,
-0xc0,0x0d,0x00,0xf6,0x17,0x3b,0x00,0x99,0x99,0x90,0x00,0x04,0xa7,0xaa,0xaa,0xaa,
-0xa1,0x00,0x69,0x15,0xc2,0x12,0xa9,0x00,0x09,0x50,0x04,0xc6,0xc8,0x00,0x00,0xe2,
-0x47,0xad,0xce,0xa7,0x30,0x17,0x09,0x74,0x00,0x05,0x8b,0x11,0x1c,0x10,0x0c,0xd3,
-0x12,0x70,0xbb,0xbb,0xde,0xbb,0xbb,0x00,0xb5,0x77,0x1e,0xf1,0x1d,0x20,0x0b,0x30,
-0x60,0x37,0x04,0x20,0x00,0xb3,0x0e,0x05,0x90,0xc2,0x00,0x0b,0x36,0xe5,0x59,0x3f,
-0x70,0x00,0xc5,0xc1,0xb8,0xbd,0x18,0xa0,0x0d,0x32,0x00,0x59,0x10,0x03,0x00,0xe0,
-0xcd,0xde,0xfd,0xdd,0x30,0x1d,0x00,0x00,0x59,0x68,0x04,0x00,0xf6,0x38,0x20,0xa4,
-0x9d,0x42,0x14,0x17,0x11,0x6f,0x0f,0xd0,0x5a,0x21,0xdd,0xf5,0x4a,0xde,0xf8,0x40,
-0x00,0x2d,0x01,0x10,0x1d,0xc4,0x08,0xf0,0x0c,0x06,0x01,0xd0,0x00,0x02,0xd1,0x11,
-0xc0,0x1e,0x88,0x50,0x7c,0xcd,0x1c,0x01,0xe7,0x74,0x03,0x04,0xa1,0xc0,0x1d,0x00,
-0x00,0x78,0xa6,0x1c,0x5a,0x02,0x80,0xde,0x01,0xeb,0xbf,0xbb,0x80,0x09,0xe3,0x36,
-0x25,0x40,0x02,0xe8,0xe8,0x31,0x6b,0x18,0x56,0x02,0x8b,0xde,0xee,0xeb,0x83,0x22,
-0x31,0x07,0x85,0x80,0x2d,0x02,0x90,0x0b,0x80,0x03,0x33,0x33,0x39,0xa3,0x47,0x10,
-0x34,0x04,0x23,0xbb,0xb4,0x47,0x02,0x91,0x8c,0xcc,0xcc,0x3d,0x00,0x00,0x01,0x16,
-0xa1,0xb9,0x16,0x10,0x4a,0xb4,0x28,0x00,0xc1,0x0b,0xf1,0x0d,0x87,0x01,0x20,0x00,
-0x4b,0x58,0x54,0xd0,0x39,0x07,0xae,0xd9,0x51,0x0c,0x77,0x70,0x64,0x10,0x00,0x00,
-0x2c,0xe2,0x1e,0xee,0xeb,0x1d,0xdd,0xeb,0xdd,0x09,0x91,0x3b,0x0b,0xee,0xea,0x0e,
-0xee,0xeb,0x0c,0x20,0xe7,0x1b,0xf2,0x1a,0x32,0x21,0x1d,0x22,0x22,0x09,0xaa,0xbc,
-0x0a,0xaa,0xbe,0x09,0x92,0x3b,0x0b,0x82,0x1d,0x00,0x4a,0x7a,0x00,0x5a,0x5c,0x04,
-0x9c,0xc8,0x05,0xac,0xaa,0x39,0x30,0x96,0x28,0x30,0x78,0x00,0x6d,0xd1,0x00,0xbb,
-0xd3,0x17,0x3b,0x30,0xdd,0xea,0x0f,0x83,0x1a,0x80,0x3a,0x0f,0xaa,0xaa,0x70,0x78,
-0xaa,0x0e,0xf3,0x43,0xf0,0x11,0x74,0x0f,0xbb,0xbb,0x70,0xd0,0x00,0x1e,0x11,0x11,
-0x10,0xeb,0xb8,0xce,0xcd,0xbb,0xb4,0x22,0x6a,0x49,0x0c,0x13,0x90,0x00,0x59,0x49,
-0x04,0xbc,0x20,0x00,0x77,0x49,0x4d,0x0f,0xb8,0xa5,0x4b,0x99,0x0c,0xa1,0xae,0xc1,
-0x7a,0x40,0x00,0x84,0x3f,0x1d,0x60,0x02,0xee,0xec,0x02,0xd0,0x23,0x9d,0x11,0xf0,
-0x13,0xc3,0x01,0xc3,0x00,0x12,0x4c,0x9e,0xbb,0xba,0xd1,0x0e,0xbb,0x81,0x00,0xe0,
-0x03,0x00,0xd0,0x00,0x6c,0xcf,0xdc,0xb0,0x2c,0x55,0x47,0x50,0xe0,0x0e,0x03,0xaa,
-0xbd,0x75,0x0e,0x8d,0x07,0x40,0xc6,0xcc,0xfd,0xcb,0xeb,0x00,0xf5,0x01,0x0e,0x08,
-0x40,0x00,0x07,0x82,0x34,0xe6,0x9e,0x00,0x4d,0xd2,0xbb,0xa8,0x76,0x97,0x9c,0x34,
-0xf0,0x0b,0x0f,0x00,0x04,0x03,0xd0,0x00,0xf0,0x02,0xe0,0x0a,0x70,0x0f,0x00,0x96,
-0x00,0x2d,0x00,0xf0,0x2d,0x00,0x01,0x21,0x1f,0x11,0x31,0x05,0x9e,0x08,0x12,0xf1,
-0xaa,0x25,0x50,0xaa,0xaa,0xaa,0xaa,0xf1,0x64,0x2a,0x02,0x11,0x03,0x70,0xe1,0x7b,
-0xbb,0xbb,0xbb,0xbf,0x12,0x04,0x03,0x13,0xf1,0xa5,0x2f,0xf0,0x04,0xef,0xfe,0xff,
-0x90,0x1d,0x50,0x00,0x86,0x08,0x60,0x6d,0x50,0x00,0x08,0x60,0x86,0x18,0x10,0x00,
-0x0d,0x00,0xfc,0x1f,0x00,0x3d,0x22,0xef,0xfe,0xff,0xc0,0x4e,0x30,0x00,0x94,0x08,
-0x60,0xac,0x20,0x00,0x0b,0x20,0x86,0x04,0x00,0x44,0x00,0xd1,0x08,0x60,0x00,0x2d,
-0x20,0x2d,0x00,0x86,0x00,0x3d,0x30,0x0a,0x70,0x08,0x61,0x9d,0x40,0x01,0xc0,0x00,
-0x86,0x88,0x44,0x0f,0xc0,0x6d,0xaa,0xad,0x50,0x0b,0x70,0x06,0xb7,0x77,0xc5,0x4c,
-0x60,0x0d,0x00,0x90,0x68,0x20,0x10,0x02,0x24,0xb2,0x22,0x00,0x4d,0x91,0x00,0xf0,
-0x1a,0x80,0x5d,0x10,0x03,0xaa,0xaa,0xa3,0xbb,0x10,0x00,0x49,0x00,0x0b,0x33,0x00,
-0x21,0x04,0xcb,0xda,0xc3,0x00,0x2e,0x20,0x2a,0x0e,0x37,0x00,0x1d,0x40,0x0c,0x50,
-0xe0,0xc2,0x6e,0x50,0x00,0x52,0xcb,0x02,0x5b,0x10,0x4a,0x1a,0x00,0x81,0x02,0x20,
-0x1d,0x20,0x8e,0x02,0xb0,0x2c,0x30,0x2e,0xee,0xfe,0xe8,0x03,0x21,0xb0,0x00,0x59,
-0x40,0x1f,0x70,0xde,0xee,0xfe,0xee,0x30,0x8f,0x20,0xcc,0x0d,0xf0,0x02,0x8c,0xd2,
-0x11,0x11,0x19,0x71,0x04,0x1c,0x29,0xcc,0xcc,0xed,0xc1,0x00,0xc2,0x07,0x50,0x20,
-0x1f,0x40,0x20,0x1d,0x20,0x86,0xff,0x10,0x11,0x42,0x0d,0x00,0x61,0x00,0x5e,0xd3,
-0x00,0x00,0x36,0xde,0x30,0xf0,0x2a,0x1d,0x30,0x0b,0x60,0x22,0x00,0x2d,0x40,0x1b,
-0x50,0x4d,0x30,0x04,0x32,0xc8,0xdc,0xfa,0x41,0x00,0x00,0xc4,0x05,0xb4,0x04,0xc0,
-0x00,0xbf,0x0c,0xfd,0xec,0xbb,0xa0,0x8a,0xe0,0x00,0xc5,0x00,0x08,0x01,0x0e,0x01,
-0xbd,0xbb,0xdc,0x00,0x00,0xe2,0xd8,0xd2,0x2d,0x40,0x00,0x0e,0x02,0x02,0xdd,0x50,
-0x1f,0x1c,0xc1,0xbb,0xab,0x50,0x00,0x0e,0x3d,0x93,0x00,0x39,0xd1,0x00,0x66,0x4e,
-0x27,0xf1,0x19,0x4d,0x10,0xea,0x88,0x88,0x70,0x5d,0x21,0x7a,0x33,0x33,0x33,0x03,
-0x14,0xdd,0xda,0xaa,0xae,0x00,0x01,0xe3,0x0d,0x55,0x55,0xe0,0x02,0xdf,0x00,0xd4,
-0x44,0x4e,0x00,0xb7,0xd0,0x0b,0xcc,0xaa,0xd0,0x01,0x0d,0xde,0x2d,0xf5,0x0b,0x00,
-0xd0,0x1c,0xea,0xad,0xb0,0x00,0x0d,0x0c,0x5a,0x85,0xd2,0x00,0x00,0xd0,0x03,0x7f,
-0xf8,0x30,0x00,0x0d,0x1d,0xa6,0x11,0x7b,0xb0,0x42,0x2a,0xf0,0x0a,0x38,0x00,0xa2,
-0x00,0x08,0xa0,0xa3,0x87,0x3d,0x00,0x05,0xa2,0x4a,0x38,0x73,0xe6,0x62,0x00,0x96,
-0xec,0xed,0x6c,0x6e,0x20,0x3e,0x17,0x05,0x80,0xc0,0x1d,0xd3,0xdd,0xdd,0xec,0x1a,
-0x08,0xb1,0x41,0xf5,0x14,0xa5,0x70,0x10,0xd0,0xad,0xcc,0x07,0xc3,0x00,0x0d,0x0b,
-0x20,0xc1,0x3e,0x00,0x00,0xd0,0xc0,0x1f,0x98,0xe1,0x00,0x0d,0x2d,0x02,0x66,0xb5,
-0xb0,0x00,0xd6,0x50,0x02,0xb1,0x08,0x40,0x0a,0x2f,0x02,0x8f,0x05,0x11,0xe6,0xd7,
-0x0b,0x20,0x01,0xc9,0x0a,0x06,0xf0,0x19,0x09,0x00,0x24,0xc0,0x00,0x02,0x90,0xf0,
-0x01,0xd3,0x20,0x00,0x69,0x0f,0x01,0xd7,0x2e,0x10,0x0a,0x50,0xf1,0xc7,0x00,0x89,
-0x01,0xe0,0x0f,0xc7,0x00,0x01,0xe1,0x36,0x03,0xf6,0x00,0x02,0x0a,0x50,0x19,0xef,
-0x8c,0x14,0x30,0x3e,0x80,0xf1,0x7c,0x04,0x22,0x20,0x09,0x2b,0x43,0x00,0x18,0x30,
-0x03,0x1e,0x3b,0x11,0x02,0x6d,0x0d,0x21,0x80,0x2c,0x1f,0x20,0x21,0x02,0xc0,0x59,
-0x2c,0xf1,0x1c,0x2c,0x00,0x05,0x09,0x70,0x00,0x03,0xb0,0x31,0xd0,0x00,0x51,0x00,
-0x4a,0x2d,0x1d,0x00,0x07,0x90,0x05,0x95,0xa1,0xd0,0x00,0x0e,0x10,0x86,0xb5,0x1d,
-0x00,0x38,0x96,0x0d,0x3c,0x01,0xe0,0x05,0x84,0x92,0xc0,0x00,0x0c,0xed,0x87,0x2d,
-0x06,0x60,0x0d,0x50,0x00,0x2f,0xdc,0xcd,0x70,0xf3,0x24,0xa2,0x1d,0x10,0x00,0x6e,
-0xed,0xdd,0xee,0xdd,0x20,0x11,0xed,0x0b,0x52,0xbc,0xcc,0xcc,0xcf,0x20,0xe1,0x12,
-0xf1,0x11,0x05,0xcc,0xcd,0xcc,0xcc,0x20,0x00,0x01,0x09,0x50,0x02,0x40,0x0d,0x2c,
-0x21,0xd3,0x12,0xe1,0x6b,0x0c,0x30,0x33,0x77,0x88,0x63,0x07,0xee,0xde,0xe2,0x15,
-0x00,0xe0,0x30,0x02,0xf0,0x21,0x0e,0x07,0xbb,0xde,0xbb,0xb0,0x04,0xea,0x14,0x48,
-0xb4,0x43,0x01,0x9e,0x84,0x55,0x9c,0x55,0x40,0x47,0xe0,0xbb,0xbd,0xeb,0xbb,0x47,
-0x4e,0x00,0x44,0x44,0x44,0x20,0x00,0xe0,0x1e,0x66,0x66,0xb6,0x00,0x0e,0x01,0xea,
-0xaa,0xad,0x60,0x00,0xe0,0x1c,0x44,0x02,0x56,0x0e,0x01,0xfb,0xbb,0xbd,0x0d,0x00,
-0x45,0xc0,0x00,0xcd,0x30,0x7d,0x1e,0xf0,0x13,0x04,0xec,0xcc,0xe0,0x3c,0xcf,0xcc,
-0x69,0x00,0x0e,0x00,0x16,0xf2,0x15,0xeb,0xbb,0xe0,0x00,0xcf,0xc2,0x49,0x00,0x0e,
-0x00,0x97,0xe3,0xd5,0xeb,0xbb,0xe0,0x4a,0x0e,0x00,0x4a,0x2b,0x00,0xf0,0x10,0x70,
-0x05,0xcc,0xcc,0xb0,0x02,0x31,0x34,0xd1,0x00,0x94,0x00,0x87,0x4a,0x05,0xa0,0x23,
-0xd0,0x0e,0x14,0xa0,0x00,0x1d,0x0b,0x51,0x50,0x0d,0xed,0xde,0x70,0x10,0xa5,0x1e,
-0x00,0xad,0x11,0x80,0xcd,0xcd,0xdd,0xdc,0x50,0x00,0x04,0xb0,0xbd,0x3a,0xf4,0x2a,
-0xcc,0xcf,0xcc,0xcf,0xcc,0xc1,0x00,0x36,0x66,0x66,0x66,0x30,0x00,0x07,0x94,0x44,
-0x44,0x89,0x00,0x00,0x7c,0xaa,0xaa,0xac,0x90,0x00,0x07,0x71,0x11,0x11,0x69,0x00,
-0x00,0x49,0x9c,0xc9,0x99,0x50,0x00,0x0b,0x2b,0x1a,0x80,0x1c,0x00,0x07,0x71,0xd0,
-0x02,0x75,0x6a,0x00,0x80,0x0c,0xdc,0xdc,0x20,0xa9,0x15,0xf0,0x08,0xa6,0x40,0x0e,
-0x01,0x71,0x0a,0x92,0x9b,0x0e,0xbb,0x50,0x4c,0xa9,0x8a,0x6e,0x00,0x19,0x07,0xaa,
-0xaa,0x0a,0xdc,0xd6,0x8d,0x15,0xf0,0x1d,0x00,0x00,0x0b,0x98,0x8e,0x0e,0x38,0xb2,
-0x0b,0xa9,0x9e,0x0e,0x73,0x04,0x0b,0x20,0x0e,0x0e,0x10,0x2b,0x08,0x13,0xa8,0x37,
-0xcc,0xb4,0x09,0x1b,0x11,0xc2,0x00,0xc2,0x3b,0x0d,0x10,0x20,0x93,0x69,0x42,0x08,
-0xdc,0xcc,0xd0,0x06,0x7a,0x02,0x11,0x4a,0xdd,0x0c,0x41,0xa4,0x09,0x80,0x00,0x66,
-0x1c,0x00,0xed,0x22,0x11,0x97,0x5c,0x16,0xf6,0x22,0x06,0x80,0x46,0x00,0x1f,0xee,
-0xf3,0x4a,0x0c,0x50,0x01,0xe0,0x0b,0x32,0xd4,0xe0,0x00,0x2c,0x00,0xc2,0x0e,0xd5,
-0x00,0x03,0xb0,0x0d,0x10,0xbb,0x01,0x20,0x79,0x8e,0xc0,0x6e,0xc0,0x49,0x0c,0x50,
-0x00,0x8b,0x1d,0x57,0x61,0xd0,0x00,0x5a,0x00,0x2d,0xe1,0x55,0x08,0x92,0x24,0x69,
-0xb0,0x00,0x1d,0xee,0xdf,0xb7,0x51,0xee,0x21,0x14,0x00,0x01,0x39,0x00,0x49,0x12,
-0x13,0xec,0x0d,0x00,0x02,0x1a,0x00,0x24,0x01,0xff,0xb8,0x14,0x06,0x27,0x00,0x04,
-0x2f,0x14,0x14,0x5f,0x25,0x18,0x04,0xe8,0x28,0x00,0xa7,0x42,0xe0,0x4f,0xee,0xee,
-0xd0,0x00,0x95,0x04,0xb0,0x00,0x1d,0x07,0xdf,0xed,0x5b,0xc0,0x08,0x10,0x94,0x0d,
-0x00,0x30,0x00,0x09,0x41,0x1a,0x00,0xa0,0x26,0xde,0xd7,0xa0,0x88,0x00,0x07,0x9c,
-0x50,0x77,0x94,0x2c,0x90,0x94,0x09,0x50,0x0d,0x40,0x00,0x09,0x40,0xe1,0xd1,0x1b,
-0x91,0x94,0x7b,0x00,0x00,0xca,0x03,0xdd,0x2b,0x10,0x82,0x3a,0x02,0x01,0x00,0x12,
-0x76,0x83,0x06,0xf1,0x26,0x60,0x8e,0xef,0xee,0xf1,0x01,0x87,0x18,0x50,0xd1,0x0d,
-0x11,0xde,0xec,0x85,0x0d,0x10,0xe1,0x00,0x76,0x08,0xed,0xfd,0xdf,0x10,0x07,0x60,
-0x85,0x0d,0x10,0xd1,0x00,0x9c,0xb8,0x62,0xd3,0x2e,0x11,0xed,0x91,0x8d,0xbf,0xcb,
-0xf1,0x00,0x76,0x03,0x10,0xd1,0x04,0x00,0x07,0x60,0x7e,0x0c,0x11,0x76,0x8b,0x0c,
-0x23,0xae,0x40,0xd5,0x17,0x01,0x4d,0x0a,0x12,0x86,0x9a,0x0e,0xe1,0x60,0x8f,0xff,
-0xff,0xf0,0x01,0x97,0x18,0x60,0x00,0x00,0x04,0xde,0xec,0x15,0x00,0xf1,0x0a,0x86,
-0x08,0xfe,0xee,0xf2,0x00,0x08,0x62,0x86,0x00,0x0b,0x20,0x16,0xce,0xa8,0x60,0x00,
-0xb2,0x03,0x8a,0x60,0x8f,0xee,0xef,0x20,0x79,0x05,0x00,0x34,0x00,0x03,0x27,0x00,
-0xc1,0x83,0x33,0x33,0x10,0xdd,0x30,0x6b,0xbb,0xbb,0xb4,0x00,0x95,0xcc,0x24,0x21,
-0x09,0x50,0x62,0x00,0xf0,0x02,0x95,0x09,0xcc,0xed,0xcc,0x32,0xde,0xe9,0xb5,0x22,
-0x22,0x20,0x00,0x95,0x0b,0x20,0x85,0x1a,0x00,0xf0,0x1c,0xb2,0x0d,0x20,0x00,0x01,
-0xbd,0x9d,0x11,0xd0,0x10,0x03,0xdd,0x70,0xe0,0x59,0x1c,0x00,0x00,0x95,0x0d,0x0b,
-0x30,0xa4,0x00,0x09,0x54,0xa1,0xd0,0x03,0xb0,0x00,0x95,0xb5,0x9d,0xac,0xde,0x10,
-0xcd,0x3a,0x04,0x53,0x00,0x64,0x2e,0x10,0x10,0xd0,0x36,0x0f,0x00,0xb1,0x13,0xb0,
-0x01,0x96,0x06,0xee,0xfe,0xeb,0x01,0x9c,0xb7,0x00,0x0d,0x48,0x10,0x00,0x2f,0x19,
-0x30,0x60,0x08,0x50,0xc9,0x03,0xf0,0x0a,0x01,0xae,0xb1,0x11,0x14,0xc1,0x03,0xed,
-0x80,0xbc,0xcc,0xcf,0xc4,0x00,0x85,0x00,0xa1,0x02,0xb0,0x00,0x08,0x50,0x05,0xa0,
-0x2b,0x6f,0x10,0x96,0x06,0x02,0xb0,0x00,0xbe,0x20,0x00,0x0c,0xe8,0xc3,0x44,0xf0,
-0x1f,0x00,0x12,0x36,0x86,0x00,0x06,0x80,0x9b,0xaf,0x75,0x20,0x05,0x9a,0x46,0x66,
+0xfb,0xbb,0xbb,0xfa,0xf2,0x03,0x2c,0x00,0x00,0x0e,0x11,0x00,0x02,0xc0,0x00,0x2c,
+0x02,0xf0,0x00,0x2f,0xdd,0xdd,0xdf,0x10,0x00,0x00,0x65,0x00,0x00,0x01,0xd0,0x00,
+0x01,0xd1,0xa1,0x03,0xf0,0x01,0x7d,0xde,0xdd,0x10,0x01,0xd0,0x00,0x00,0x08,0x5c,
+0xee,0xef,0xe5,0x06,0x00,0xc3,0x1a,0x00,0xa0,0x8a,0x1f,0x04,0x40,0x1d,0x00,0x00,
+0xbb,0xa0,0x2d,0x27,0x00,0xf7,0x0f,0xe7,0x00,0xa5,0x1d,0x00,0x00,0x4e,0xe1,0x03,
+0x41,0xd0,0x00,0x1d,0x39,0x80,0x00,0x1d,0x00,0x2d,0x70,0x15,0x00,0x02,0xd0,0x06,
+0x60,0x00,0x00,0x1f,0xf8,0xff,0x00,0x00,0xa7,0x05,0x09,0xb4,0x05,0xf0,0x0c,0x06,
+0x70,0x0f,0x10,0x94,0x00,0x00,0xb5,0x00,0xf1,0x04,0xd0,0x00,0x0f,0x10,0x0f,0x10,
+0x0c,0x50,0x06,0xc0,0x00,0xf1,0x00,0x5c,0x00,0xe3,0x27,0x00,0x20,0xf2,0x4b,0x27,
+0x00,0x21,0x0a,0x70,0x34,0x00,0x14,0x20,0x41,0x00,0x28,0x4f,0xfb,0x53,0x01,0x24,
+0x01,0xd0,0x49,0x04,0xf0,0x07,0x00,0x00,0x2b,0x01,0xd0,0x08,0x40,0x00,0x09,0x60,
+0x1d,0x00,0x2d,0x00,0x02,0xd0,0x01,0xd0,0x00,0x79,0x00,0xc5,0x1a,0x00,0x71,0xe2,
+0x05,0x00,0x01,0xd0,0x01,0x13,0x27,0x00,0x11,0xc7,0xe4,0x01,0x10,0xc9,0x06,0x00,
+0x80,0x28,0xe5,0x00,0x00,0x03,0x69,0xdc,0x71,0x10,0x00,0x18,0x62,0x54,0x00,0x02,
+0xa3,0x06,0x20,0x00,0x78,0x05,0x00,0xd3,0xcc,0xce,0xdc,0xcc,0xcc,0xc0,0x02,0x23,
+0xf3,0x22,0x22,0x22,0x00,0xb4,0x02,0x12,0x09,0x20,0x05,0xf0,0x05,0xec,0xee,0xff,
+0xee,0xa0,0x00,0x5b,0x00,0x0b,0x30,0x00,0x00,0x0d,0x40,0x00,0xb3,0x00,0x00,0x08,
+0xa0,0x0d,0x00,0x30,0x04,0xd0,0x00,0x0d,0x00,0xc1,0x12,0x0e,0xee,0xef,0xfe,0xee,
+0x40,0x00,0x06,0x10,0x00,0x28,0x73,0x02,0x40,0x0b,0x60,0x00,0x08,0xa2,0x01,0x31,
+0xe9,0x00,0x00,0x6f,0x05,0x63,0x00,0xdd,0xdf,0xed,0xdd,0xd0,0xf6,0x01,0x04,0xa4,
+0x07,0x21,0x3f,0x10,0xce,0x01,0x10,0xbe,0x76,0x07,0xf1,0x15,0x7f,0x60,0x00,0xc3,
+0x00,0x00,0x2b,0x3a,0xaa,0xae,0xca,0xaa,0x10,0x00,0x33,0x33,0x33,0x33,0x30,0x08,
+0x40,0x0f,0x00,0x66,0x00,0x3d,0x00,0xf0,0x1d,0x10,0xcd,0xed,0xdf,0xdd,0xdd,0xce,
+0xfd,0x00,0x71,0xd0,0xeb,0xbb,0xbb,0xd1,0xc0,0x0e,0x07,0x01,0xf0,0x12,0xab,0xbf,
+0xbb,0xa0,0x00,0x11,0x11,0xe2,0x11,0x10,0x1f,0xcc,0xcf,0xdc,0xcf,0x11,0xe0,0x00,
+0xe1,0x00,0xe1,0x1e,0x00,0x0e,0x12,0x2f,0x10,0x90,0x00,0xe1,0x6a,0x80,0x06,0x07,
+0x04,0x70,0xfb,0x00,0x02,0x20,0x0d,0x20,0x15,0x92,0x02,0xf2,0x12,0xd2,0x07,0x90,
+0x00,0x00,0xb4,0x0d,0x20,0xd1,0x00,0x00,0x04,0x30,0xd2,0x25,0x00,0x00,0xbb,0xbb,
+0xbf,0xcb,0xbb,0xb5,0x03,0x33,0x33,0xd5,0x33,0x33,0x10,0x00,0x00,0x0d,0xac,0x05,
+0x02,0xbc,0x04,0x09,0x0d,0x00,0x04,0x16,0x08,0x10,0x70,0x72,0x07,0xf1,0x0b,0xcc,
+0xdf,0xcc,0xcc,0x30,0x1d,0x11,0x61,0x11,0x61,0x10,0x01,0xd0,0x0e,0x00,0x0e,0x10,
+0x00,0x1d,0xac,0xfc,0xcc,0xfd,0xc2,0x02,0xc0,0x0d,0x00,0xf5,0x18,0x3b,0x00,0x99,
+0x99,0x90,0x00,0x04,0xa7,0xaa,0xaa,0xaa,0xa1,0x00,0x69,0x15,0xc2,0x12,0xa9,0x00,
+0x09,0x50,0x04,0xc6,0xc8,0x00,0x00,0xe2,0x47,0xad,0xce,0xa7,0x30,0x17,0x09,0x74,
+0x00,0x05,0x8b,0x20,0x55,0x00,0xf1,0x2d,0x0c,0x40,0x00,0x00,0x08,0xbb,0xbb,0xde,
+0xbb,0xbb,0x00,0xb5,0x22,0x22,0x22,0x22,0x20,0x0b,0x30,0x60,0x37,0x04,0x20,0x00,
+0xb3,0x0e,0x05,0x90,0xc2,0x00,0x0b,0x36,0xe5,0x59,0x3f,0x70,0x00,0xc5,0xc1,0xb8,
+0xbd,0x18,0xa0,0x0d,0x32,0x00,0x59,0x10,0x03,0x00,0xe0,0xcd,0xde,0xfd,0xdd,0x30,
+0x1d,0x00,0x00,0x59,0x68,0x04,0xb6,0x05,0x90,0x00,0x00,0xa4,0x9d,0xdd,0xef,0xdd,
+0xdd,0x11,0xab,0x00,0xe0,0x02,0x5a,0x21,0xdd,0xf5,0x4a,0xde,0xf8,0x40,0x00,0x2d,
+0x01,0x10,0x1d,0xc4,0x08,0xf0,0x0c,0x06,0x01,0xd0,0x00,0x02,0xd1,0x11,0xc0,0x1e,
+0x88,0x50,0x7c,0xcd,0x1c,0x01,0xe7,0x74,0x03,0x04,0xa1,0xc0,0x1d,0x00,0x00,0x78,
+0xa6,0x1c,0x5a,0x02,0xf5,0x0b,0xde,0x01,0xeb,0xbf,0xbb,0x80,0x09,0xe3,0x01,0x11,
+0x11,0x11,0x02,0xe8,0xe8,0x31,0x00,0x00,0x01,0xe6,0x02,0x8b,0xde,0xee,0xeb,0x03,
+0x54,0x00,0x31,0x07,0x85,0x80,0x2d,0x02,0x90,0x0b,0x80,0x03,0x33,0x33,0x39,0xa3,
+0x47,0x10,0x34,0x04,0x23,0xbb,0xb4,0x47,0x02,0xa0,0x8c,0xcc,0xcc,0x3d,0x00,0x00,
+0x01,0x16,0xa1,0x10,0x23,0x04,0x20,0x4a,0x00,0x61,0x07,0xf1,0x10,0x04,0xa0,0x00,
+0x87,0x01,0x20,0x00,0x4b,0x58,0x54,0xd0,0x39,0x07,0xae,0xd9,0x51,0x0c,0x77,0x70,
+0x64,0x10,0x00,0x00,0x2c,0xe2,0x1e,0xee,0xeb,0x1d,0xdd,0xeb,0xdd,0x09,0x90,0x3b,
+0x0b,0xee,0xea,0x0e,0xee,0xeb,0x0c,0x20,0xfe,0x04,0xf0,0x1b,0x0d,0x32,0x21,0x1d,
+0x22,0x22,0x09,0xaa,0xbc,0x0a,0xaa,0xbe,0x09,0x92,0x3b,0x0b,0x82,0x1d,0x00,0x4a,
+0x7a,0x00,0x5a,0x5c,0x04,0x9c,0xc8,0x05,0xac,0xaa,0x39,0x30,0x96,0x28,0x30,0x78,
+0x00,0x6d,0xd1,0x00,0xbb,0xd3,0x8a,0x00,0xf0,0x01,0x11,0x00,0xdd,0xea,0x0f,0xcc,
+0xcc,0xc1,0x00,0x3a,0x0f,0xaa,0xaa,0x70,0x78,0xaa,0x3f,0x05,0xf7,0x1f,0xd7,0x74,
+0x0f,0xbb,0xbb,0x70,0xd0,0x00,0x1e,0x11,0x11,0x10,0xeb,0xb8,0xce,0xcd,0xbb,0xb4,
+0x22,0x6a,0x49,0x0c,0x13,0x90,0x00,0x59,0x49,0x04,0xbc,0x20,0x00,0x77,0x49,0x00,
+0xa8,0x00,0x00,0xa5,0x4b,0x99,0x0c,0xa1,0xae,0xc1,0x7a,0x40,0xfa,0x08,0xf0,0x20,
+0x05,0x30,0x00,0x02,0xee,0xec,0x02,0xd0,0x23,0x00,0x00,0x02,0xc0,0xc3,0x01,0xc3,
+0x00,0x12,0x4c,0x9e,0xbb,0xba,0xd1,0x0e,0xbb,0x81,0x00,0xe0,0x03,0x00,0xd0,0x00,
+0x6c,0xcf,0xdc,0xb0,0x2c,0x55,0x47,0x50,0xe0,0x0e,0x03,0xaa,0xbd,0x75,0x0e,0x8d,
+0x07,0x40,0xc6,0xcc,0xfd,0xcb,0xeb,0x00,0xf3,0x01,0x0e,0x08,0x40,0x00,0x07,0x82,
+0x34,0xe6,0x9e,0x00,0x4d,0xd2,0xbb,0xa8,0x76,0x97,0x52,0x00,0xf0,0x0d,0x12,0x00,
+0x0f,0x00,0x04,0x03,0xd0,0x00,0xf0,0x02,0xe0,0x0a,0x70,0x0f,0x00,0x96,0x00,0x2d,
+0x00,0xf0,0x2d,0x00,0x01,0x21,0x1f,0x11,0x31,0x05,0x9e,0x08,0x01,0xe4,0x03,0xb2,
+0x0e,0x10,0xaa,0xaa,0xaa,0xaa,0xf1,0x03,0x33,0x33,0x33,0x11,0x03,0x70,0xe1,0x7b,
+0xbb,0xbb,0xbb,0xbf,0x12,0x04,0x03,0x02,0x46,0x04,0xf0,0x06,0x16,0x00,0xef,0xfe,
+0xff,0x90,0x1d,0x50,0x00,0x86,0x08,0x60,0x6d,0x50,0x00,0x08,0x60,0x86,0x18,0x10,
+0x00,0x0d,0x00,0xfb,0x20,0x00,0x3d,0x22,0xef,0xfe,0xff,0xc0,0x4e,0x30,0x00,0x94,
+0x08,0x60,0xac,0x20,0x00,0x0b,0x20,0x86,0x04,0x00,0x44,0x00,0xd1,0x08,0x60,0x00,
+0x2d,0x20,0x2d,0x00,0x86,0x00,0x3d,0x30,0x0a,0x70,0x08,0x61,0x9d,0x40,0x01,0xc0,
+0x00,0x86,0x88,0x00,0x01,0x00,0xc0,0x6d,0xaa,0xad,0x50,0x0b,0x70,0x06,0xb7,0x77,
+0xc5,0x4c,0x60,0x0d,0x00,0x90,0x68,0x20,0x10,0x02,0x24,0xb2,0x22,0x00,0x4d,0x91,
+0x00,0xf1,0x1d,0x80,0x5d,0x10,0x03,0xaa,0xaa,0xa3,0xbb,0x10,0x00,0x49,0x00,0x0b,
+0x33,0x00,0x21,0x04,0xcb,0xda,0xc3,0x00,0x2e,0x20,0x2a,0x0e,0x37,0x00,0x1d,0x40,
+0x0c,0x50,0xe0,0xc2,0x6e,0x50,0x00,0x52,0xcb,0x02,0x5b,0x10,0x00,0x00,0x3a,0x81,
+0x02,0x20,0x1d,0x20,0x8e,0x02,0x90,0x2c,0x30,0x2e,0xee,0xfe,0xe8,0x03,0x21,0xb0,
+0x0d,0x00,0xf1,0x1c,0x00,0xa5,0xde,0xee,0xfe,0xee,0x30,0x8f,0x20,0x00,0x00,0x86,
+0x00,0x8c,0xd2,0x11,0x11,0x19,0x71,0x04,0x1c,0x29,0xcc,0xcc,0xed,0xc1,0x00,0xc2,
+0x07,0x50,0x08,0x60,0x00,0x0c,0x20,0x1d,0x20,0x86,0x00,0x00,0xc2,0x00,0x42,0x0d,
+0x00,0x80,0x00,0x5e,0xd3,0x00,0x00,0x36,0x00,0x07,0xe7,0x03,0xf0,0x3a,0x30,0x0b,
+0x60,0x22,0x00,0x2d,0x40,0x1b,0x50,0x4d,0x30,0x04,0x32,0xc8,0xdc,0xfa,0x41,0x00,
+0x00,0xc4,0x05,0xb4,0x04,0xc0,0x00,0xbf,0x0c,0xfd,0xec,0xbb,0xa0,0x8a,0xe0,0x00,
+0xc5,0x00,0x08,0x01,0x0e,0x01,0xbd,0xbb,0xdc,0x00,0x00,0xe2,0xd8,0xd2,0x2d,0x40,
+0x00,0x0e,0x02,0x02,0xdd,0x50,0x00,0x00,0xe0,0x05,0xbb,0xab,0x50,0x00,0x0e,0x3d,
+0x93,0x00,0x39,0xd1,0x00,0x66,0x06,0xfb,0x07,0xf0,0x1b,0x4d,0x10,0xea,0x88,0x88,
+0x70,0x5d,0x21,0x7a,0x33,0x33,0x33,0x03,0x14,0xdd,0xda,0xaa,0xae,0x00,0x01,0xe3,
+0x0d,0x55,0x55,0xe0,0x02,0xdf,0x00,0xd4,0x44,0x4e,0x00,0xb7,0xd0,0x0b,0xcc,0xaa,
+0xd0,0x01,0x0d,0x00,0x1e,0x14,0x0a,0xf4,0x0a,0xd0,0x1c,0xea,0xad,0xb0,0x00,0x0d,
+0x0c,0x5a,0x85,0xd2,0x00,0x00,0xd0,0x03,0x7f,0xf8,0x30,0x00,0x0d,0x1d,0xa6,0x11,
+0x7b,0xb0,0x2f,0x08,0xf0,0x0b,0x30,0x38,0x00,0xa2,0x00,0x08,0xa0,0xa3,0x87,0x3d,
+0x00,0x05,0xa2,0x4a,0x38,0x73,0xe6,0x62,0x00,0x96,0xec,0xed,0x6c,0x6e,0x20,0x3e,
+0x17,0x05,0xf4,0x20,0xc0,0x1d,0xd3,0xdd,0xdd,0xec,0x1a,0x08,0x8d,0x00,0x00,0x02,
+0xa5,0x70,0x10,0xd0,0xad,0xcc,0x07,0xc3,0x00,0x0d,0x0b,0x20,0xc1,0x3e,0x00,0x00,
+0xd0,0xc0,0x1f,0x98,0xe1,0x00,0x0d,0x2d,0x02,0x66,0xb5,0xb0,0x00,0xd6,0x50,0x02,
+0xb1,0x08,0x40,0x8e,0x01,0x12,0x62,0x8f,0x05,0x11,0xe6,0xd7,0x0b,0x20,0x01,0xc9,
+0x0a,0x06,0xf0,0x20,0x09,0x00,0x24,0xc0,0x00,0x02,0x90,0xf0,0x01,0xd3,0x20,0x00,
+0x69,0x0f,0x01,0xd7,0x2e,0x10,0x0a,0x50,0xf1,0xc7,0x00,0x89,0x01,0xe0,0x0f,0xc7,
+0x00,0x01,0xe1,0x36,0x03,0xf6,0x00,0x02,0x0a,0x50,0x19,0xef,0x00,0x00,0xb4,0x00,
+0x3e,0x80,0xf1,0x7c,0x04,0x50,0x20,0x09,0xff,0xff,0x90,0x49,0x00,0x12,0x44,0x05,
+0x04,0x41,0xd0,0x00,0x00,0x02,0x6d,0x0d,0x20,0x80,0x2c,0xe0,0x02,0x00,0xfc,0x06,
+0x20,0x3d,0x90,0xd3,0x07,0xf4,0x1c,0x05,0x09,0x70,0x00,0x03,0xb0,0x31,0xd0,0x00,
+0x51,0x00,0x4a,0x2d,0x1d,0x00,0x07,0x90,0x05,0x95,0xa1,0xd0,0x00,0x0e,0x10,0x86,
+0xb5,0x1d,0x00,0x38,0x96,0x0d,0x3c,0x01,0xe0,0x05,0x84,0x92,0xc0,0x00,0x0c,0xed,
+0xe3,0x00,0xda,0x07,0x01,0x60,0x0d,0xf2,0x04,0x00,0x2f,0xdc,0xcd,0x70,0x00,0x04,
+0xe5,0x00,0x1d,0x10,0x00,0x6e,0xed,0xdd,0xee,0xdd,0x20,0x11,0xed,0x0b,0x61,0xbc,
+0xcc,0xcc,0xcf,0x20,0x00,0x0c,0x00,0xf0,0x0f,0x05,0xcc,0xcd,0xcc,0xcc,0x20,0x00,
+0x01,0x09,0x50,0x02,0x40,0x0d,0x2c,0x21,0xd3,0x12,0xe1,0x6b,0x0c,0x30,0x33,0x77,
+0x88,0x63,0x07,0xee,0xde,0xe2,0x15,0xf6,0x31,0x00,0xe0,0x00,0x05,0x90,0x00,0x00,
+0x0e,0x07,0xbb,0xde,0xbb,0xb0,0x04,0xea,0x14,0x48,0xb4,0x43,0x01,0x9e,0x84,0x55,
+0x9c,0x55,0x40,0x47,0xe0,0xbb,0xbd,0xeb,0xbb,0x47,0x4e,0x00,0x44,0x44,0x44,0x20,
+0x00,0xe0,0x1e,0x66,0x66,0xb6,0x00,0x0e,0x01,0xea,0xaa,0xad,0x60,0x00,0xe0,0x1c,
+0x00,0x00,0x86,0x00,0x0e,0x01,0xfb,0xbb,0xbd,0x0d,0x00,0x71,0xc0,0x00,0xcd,0x30,
+0x00,0x0e,0x00,0x01,0x00,0xf0,0x14,0xe0,0x04,0xec,0xcc,0xe0,0x3c,0xcf,0xcc,0x69,
+0x00,0x0e,0x00,0x16,0xf2,0x15,0xeb,0xbb,0xe0,0x00,0xcf,0xc2,0x49,0x00,0x0e,0x00,
+0x97,0xe3,0xd5,0xeb,0xbb,0xe0,0x4a,0x0e,0x00,0x4a,0x2b,0x00,0xf2,0x5f,0x70,0x05,
+0xcc,0xcc,0xb0,0x02,0x31,0x34,0xd1,0x00,0x94,0x00,0x87,0x4a,0x05,0xa0,0x23,0xd0,
+0x0e,0x14,0xa0,0x00,0x1d,0x0b,0x51,0x50,0x0d,0xed,0xde,0x70,0x10,0x00,0x00,0x01,
+0xc0,0x00,0x00,0x00,0x5c,0xcd,0xcd,0xdd,0xdc,0x50,0x00,0x04,0xb0,0x00,0xb5,0x00,
+0x00,0xcc,0xcf,0xcc,0xcf,0xcc,0xc1,0x00,0x36,0x66,0x66,0x66,0x30,0x00,0x07,0x94,
+0x44,0x44,0x89,0x00,0x00,0x7c,0xaa,0xaa,0xac,0x90,0x00,0x07,0x71,0x11,0x11,0x69,
+0x00,0x00,0x49,0x9c,0xc9,0x99,0x50,0x00,0x0b,0x2b,0x1a,0x80,0x1c,0x00,0x07,0x71,
+0xd0,0x02,0x75,0x6a,0x00,0x80,0x0c,0xdc,0xdc,0x20,0x50,0x00,0x01,0x00,0xf0,0x3e,
+0xa6,0x40,0x0e,0x01,0x71,0x0a,0x92,0x9b,0x0e,0xbb,0x50,0x4c,0xa9,0x8a,0x6e,0x00,
+0x19,0x07,0xaa,0xaa,0x0a,0xdc,0xd6,0x0b,0x20,0x0e,0x05,0x00,0x00,0x0b,0x98,0x8e,
+0x0e,0x38,0xb2,0x0b,0xa9,0x9e,0x0e,0x73,0x04,0x0b,0x20,0x0e,0x0e,0x10,0x2b,0x08,
+0x13,0xa8,0x37,0xcc,0xb4,0x09,0x1b,0x11,0xc2,0x00,0xc2,0x3b,0x0d,0x10,0x20,0x93,
+0x69,0x42,0x08,0xdc,0xcc,0xd0,0x06,0x00,0x00,0x00,0x0b,0x4a,0x60,0x51,0x00,0xe0,
+0xa4,0x09,0x80,0x00,0xee,0xee,0xef,0xee,0xee,0x70,0x0e,0x00,0x00,0x97,0xfd,0x00,
+0xf4,0x24,0x00,0x06,0x80,0x46,0x00,0x1f,0xee,0xf3,0x4a,0x0c,0x50,0x01,0xe0,0x0b,
+0x32,0xd4,0xe0,0x00,0x2c,0x00,0xc2,0x0e,0xd5,0x00,0x03,0xb0,0x0d,0x10,0xbb,0x01,
+0x20,0x79,0x8e,0xc0,0x6e,0xc0,0x49,0x0c,0x50,0x00,0x8b,0x1d,0x57,0x61,0xd0,0x00,
+0x5a,0x00,0x2d,0xe1,0x00,0x01,0x00,0xa0,0x01,0x24,0x69,0xb0,0x00,0x1d,0xee,0xdf,
+0xb7,0x51,0x0e,0x00,0x11,0xb3,0x14,0x00,0xa3,0x0b,0x30,0x00,0x00,0x03,0xee,0xee,
+0xff,0xee,0xec,0x0d,0x00,0x02,0x1a,0x00,0x20,0x01,0xff,0x01,0x00,0x18,0xf8,0x27,
+0x00,0x00,0x01,0x00,0x10,0xc3,0x05,0x00,0x36,0x5f,0xec,0x00,0x01,0x00,0x11,0x94,
+0x06,0x00,0xf0,0x06,0x09,0x40,0x4f,0xee,0xee,0xd0,0x00,0x95,0x04,0xb0,0x00,0x1d,
+0x07,0xdf,0xed,0x5b,0x00,0x01,0xd0,0x00,0x94,0x0d,0x00,0x30,0x00,0x09,0x41,0x1a,
+0x00,0xf4,0x18,0x26,0xde,0xd7,0xa0,0x88,0x00,0x07,0x9c,0x50,0x77,0x03,0xe0,0x00,
+0x00,0x94,0x09,0x50,0x0d,0x40,0x00,0x09,0x40,0xe1,0x00,0x6c,0x00,0x00,0x94,0x7b,
+0x00,0x00,0xca,0x03,0xdd,0x2b,0x10,0x00,0x01,0xb4,0x55,0x00,0x11,0x76,0x06,0x00,
+0xf1,0x2a,0x07,0x60,0x8e,0xef,0xee,0xf1,0x01,0x87,0x18,0x50,0xd1,0x0d,0x11,0xde,
+0xec,0x85,0x0d,0x10,0xe1,0x00,0x76,0x08,0xed,0xfd,0xdf,0x10,0x07,0x60,0x85,0x0d,
+0x10,0xd1,0x00,0x9c,0xb8,0x62,0xd3,0x2e,0x11,0xed,0x91,0x8d,0xbf,0xcb,0xf1,0x00,
+0x76,0x03,0x10,0xd1,0x04,0x00,0x07,0x60,0x00,0x0d,0x10,0x41,0x00,0x50,0xd1,0x00,
+0x00,0xae,0x40,0x0d,0x00,0x00,0x01,0x00,0x00,0x06,0x00,0x11,0x86,0x0a,0x00,0xf1,
+0x00,0x08,0x60,0x8f,0xff,0xff,0xf0,0x01,0x97,0x18,0x60,0x00,0x00,0x04,0xde,0xec,
+0x15,0x00,0xf1,0x0e,0x86,0x08,0xfe,0xee,0xf2,0x00,0x08,0x62,0x86,0x00,0x0b,0x20,
+0x16,0xce,0xa8,0x60,0x00,0xb2,0x03,0x8a,0x60,0x8f,0xee,0xef,0x20,0x00,0x86,0x08,
+0x60,0x34,0x00,0x03,0x27,0x00,0xf1,0x04,0x83,0x33,0x33,0x10,0xdd,0x30,0x6b,0xbb,
+0xbb,0xb4,0x00,0x95,0x00,0x02,0x80,0x00,0x00,0x09,0x50,0x62,0x00,0xf0,0x02,0x95,
+0x09,0xcc,0xed,0xcc,0x32,0xde,0xe9,0xb5,0x22,0x22,0x20,0x00,0x95,0x0b,0x20,0x85,
+0x1a,0x00,0xf0,0x32,0xb2,0x0d,0x20,0x00,0x01,0xbd,0x9d,0x11,0xd0,0x10,0x03,0xdd,
+0x70,0xe0,0x59,0x1c,0x00,0x00,0x95,0x0d,0x0b,0x30,0xa4,0x00,0x09,0x54,0xa1,0xd0,
+0x03,0xb0,0x00,0x95,0xb5,0x9d,0xac,0xde,0x10,0xcd,0x3a,0x04,0x53,0x00,0x64,0x00,
+0x85,0x00,0x00,0xd0,0x00,0x00,0x08,0x50,0x00,0x0d,0x00,0x00,0x01,0x96,0x06,0xee,
+0xfe,0xeb,0x01,0x9c,0xb7,0x0d,0x00,0xf5,0x24,0x00,0x85,0x1e,0xee,0xfe,0xee,0x60,
+0x08,0x50,0x00,0x00,0x2c,0x00,0x01,0xae,0xb1,0x11,0x14,0xc1,0x03,0xed,0x80,0xbc,
+0xcc,0xcf,0xc4,0x00,0x85,0x00,0xa1,0x02,0xb0,0x00,0x08,0x50,0x05,0xa0,0x2b,0x00,
+0x00,0x85,0x00,0x06,0x02,0xb0,0x00,0xbe,0x20,0x00,0x0c,0xe8,0x9b,0x01,0xf0,0x20,
+0x68,0x00,0x12,0x36,0x86,0x00,0x06,0x80,0x9b,0xaf,0x75,0x20,0x05,0x9a,0x46,0x66,
 0xe6,0x66,0x21,0x7b,0xc6,0x66,0x6e,0x66,0x62,0x00,0x68,0x07,0xaa,0xfa,0xaa,0x00,
 0x06,0x93,0xa4,0x2e,0x22,0xe0,0x17,0xde,0x8a,0xba,0xfa,0xaf,0x03,0xa9,0x80,0x0d,
-0x00,0xf1,0x00,0x00,0x68,0x0a,0x41,0xe1,0x1e,0x00,0x06,0x80,0x8b,0xaf,0xaa,0xb0,
-0x00,0x68,0x9e,0x0c,0x26,0xbe,0x40,0x86,0x0e,0x00,0x34,0x03,0x00,0xc8,0x04,0xf0,
-0x13,0x1c,0x02,0xbb,0xde,0xbb,0x90,0x48,0xe7,0x13,0x91,0x16,0x61,0x04,0x7e,0x60,
-0x0b,0x20,0xd1,0x00,0x01,0xc0,0x7b,0xcb,0xce,0xbb,0x10,0x1c,0x01,0x12,0xc2,0x11,
-0x10,0x04,0xff,0x71,0x15,0xf6,0x12,0x0a,0xdd,0x1a,0xdf,0xdc,0xee,0xc3,0x01,0xc0,
-0x06,0xa0,0x09,0x60,0x00,0x1c,0x00,0x7c,0xa8,0xc0,0x00,0x01,0xc0,0x01,0x5d,0xcd,
-0x70,0x04,0xe8,0x0b,0xc8,0x20,0x19,0x90,0x2d,0x11,0x20,0x67,0x38,0xff,0x00,0xf0,
-0x06,0x0d,0x40,0xe0,0x00,0x01,0x96,0x13,0xf6,0x6b,0x76,0x02,0xde,0xeb,0xce,0x88,
-0xf8,0x80,0x00,0x85,0x7e,0xc0,0x10,0x0f,0xf0,0x0f,0x5a,0x5f,0xdd,0xfd,0xc0,0x02,
-0xbe,0xb2,0xc0,0x0e,0x00,0x03,0xee,0x70,0x2d,0x33,0xf3,0x20,0x00,0x85,0x02,0xea,
-0xaf,0xa9,0x00,0x08,0x50,0x2c,0x00,0xe0,0x10,0x17,0x87,0xfe,0xef,0xee,0x50,0xce,
-0x20,0x2c,0x00,0x86,0x19,0xf1,0x1e,0x04,0x60,0x01,0xc0,0x00,0x0e,0x00,0x0d,0x10,
-0x79,0x00,0x00,0xe0,0x34,0xa7,0x4e,0x64,0x16,0xdf,0xd8,0x99,0x99,0x99,0x93,0x00,
-0xe0,0x38,0x88,0x01,0x09,0x00,0x0e,0x06,0x83,0xd0,0xc0,0xd0,0x15,0xfe,0x8a,0x7e,
-0x0c,0x0d,0x06,0xae,0x0d,0x00,0x61,0x00,0xe0,0x6a,0x7d,0x0c,0x0d,0x1a,0x00,0xe5,
-0x90,0xd0,0x00,0xe0,0x66,0x0c,0x00,0x0d,0x03,0xda,0x06,0x6a,0xa0,0x5d,0xaa,0x00,
-0x02,0x49,0x1e,0xf5,0x37,0x0d,0x00,0x0d,0xdc,0xd1,0x00,0x14,0xe4,0x09,0x70,0x5a,
-0x00,0x04,0x9f,0x96,0xfc,0xcf,0xdc,0xa0,0x00,0xd0,0x2c,0x04,0x14,0x0c,0x00,0x0d,
-0x10,0xc1,0xb0,0xb1,0xc0,0x05,0xfd,0x0c,0x93,0x23,0x7c,0x06,0x9d,0x00,0xc0,0x1d,
-0x00,0xc0,0x00,0xd0,0x9d,0xcd,0xfc,0xcd,0x70,0x0d,0x00,0x00,0xca,0x90,0x00,0x00,
-0xd0,0x02,0xb8,0x09,0xa3,0x02,0xe9,0x0b,0xb4,0x00,0x04,0xbd,0x40,0x04,0xb8,0x22,
-0xf0,0x1a,0x3e,0xbb,0xd7,0x00,0x01,0xe1,0x03,0xa1,0x17,0x70,0x04,0xbf,0xb2,0x28,
-0x88,0x84,0x00,0x00,0xe0,0x7c,0xba,0x8c,0xbb,0x00,0x0e,0x19,0x31,0xb8,0x30,0xc0,
-0x05,0xfd,0xac,0xbb,0x8c,0xbc,0x05,0xaf,0x00,0x00,0x58,0x34,0x00,0xf7,0x08,0xad,
-0xdf,0xfd,0xdd,0x10,0x0e,0x00,0x0b,0xcc,0xc1,0x00,0x00,0xe0,0x6d,0x65,0x83,0xd7,
-0x00,0xcc,0x19,0x10,0x58,0x00,0x14,0x1d,0x00,0x98,0x29,0x40,0xec,0xcd,0xd0,0x79,
-0x5b,0x00,0xf4,0x30,0x1d,0x0c,0x95,0x55,0x30,0xeb,0xbc,0xd3,0xf7,0x6b,0xb3,0x0e,
-0x00,0x1d,0xcf,0x20,0xa4,0x00,0xeb,0xbc,0xfc,0x76,0x0e,0x10,0x0e,0x00,0x1d,0x02,
-0xc3,0xc0,0x00,0xe0,0x01,0xd0,0x0d,0xc6,0x00,0x0b,0xcc,0xca,0x00,0x7f,0x00,0x00,
-0x3a,0x0a,0x20,0x1d,0xe7,0x00,0x0b,0x50,0x3c,0x3d,0x71,0xe7,0x05,0xa0,0x00,0x4e,
-0x50,0x02,0xc6,0x37,0x09,0xf0,0x16,0x09,0x44,0x30,0xb0,0x00,0x00,0x76,0x94,0xc1,
-0x1d,0x00,0x00,0x15,0x9b,0x89,0x45,0xb2,0x22,0x02,0x8a,0xfe,0x98,0x9d,0xbe,0xd3,
-0x03,0xcc,0x8b,0x3e,0x90,0xa3,0x03,0xc2,0x62,0x07,0x9d,0x0d,0xab,0x02,0xd0,0x42,
-0xa4,0xc0,0x00,0xdf,0xdd,0xf4,0x05,0xe6,0x00,0x02,0xd0,0x2d,0x08,0x2d,0xf8,0x04,
-0x2a,0xbc,0x30,0x0b,0xca,0x00,0x00,0x5d,0xb9,0x0a,0x90,0xc8,0x02,0xd8,0x10,0x1d,
-0x70,0x01,0xb5,0x8e,0x10,0x06,0xda,0x41,0x20,0x00,0xa8,0x78,0x0b,0x00,0x87,0x24,
-0x70,0xc7,0x02,0x2e,0x42,0x22,0x2c,0x62,0x5d,0x39,0x01,0x2c,0x37,0x00,0xac,0x54,
-0x00,0x01,0x20,0x11,0x7b,0x1d,0x04,0x21,0xde,0x10,0x2d,0x21,0x20,0xd2,0x00,0x34,
-0x3d,0xc0,0x16,0xe7,0x00,0x00,0x6d,0xd5,0x00,0x02,0xbf,0xa3,0x09,0x40,0x51,0x3e,
-0x16,0x30,0xe0,0x18,0xf3,0x39,0x01,0x49,0x90,0x0b,0xbd,0xdb,0x89,0xc8,0x50,0x00,
-0x1a,0x11,0xc0,0x93,0x00,0x00,0x00,0xc1,0x59,0x09,0x30,0x00,0x01,0xce,0xce,0xdc,
-0x9c,0xbb,0xb5,0x00,0x08,0x60,0x0a,0x52,0xe3,0x10,0x22,0x97,0x22,0xa2,0x0d,0x10,
-0x0a,0xad,0xca,0x8b,0x10,0xd1,0x00,0x38,0x76,0x90,0xc0,0x0d,0x10,0x0b,0x47,0x69,
-0x5d,0x00,0xd1,0x00,0x80,0x76,0x18,0x90,0x0d,0x10,0x00,0x6d,0x30,0x82,0xdc,0x10,
-0x02,0x6c,0x14,0x03,0xee,0x05,0x01,0x95,0x12,0xb1,0xde,0xdd,0xdd,0xd1,0x01,0x11,
-0x98,0x11,0x11,0x11,0x00,0x7b,0x3a,0x00,0xf6,0x16,0x20,0xdd,0xdd,0xee,0x33,0x30,
-0x21,0x11,0x4b,0xa8,0x28,0x00,0x1a,0x0b,0x00,0xfb,0x18,0x10,0x69,0xf1,0x20,0x00,
-0xe5,0x16,0x20,0x3e,0x40,0x4a,0x1c,0x65,0x1e,0x40,0x00,0x9e,0xea,0x00,0xc2,0x12,
-0xf2,0x37,0xf1,0x8d,0xdd,0xdc,0x00,0xd0,0x0c,0x10,0x31,0xc0,0x00,0x0d,0xcc,0xf1,
-0x3a,0x1c,0x00,0x00,0xd0,0x0c,0x17,0x73,0xa0,0x00,0x0d,0x32,0xd1,0xc9,0xac,0x77,
-0x10,0xda,0xaa,0x06,0x6c,0x96,0x60,0x0d,0x01,0x20,0x00,0xeb,0x00,0x00,0xd0,0x2b,
-0x00,0x6b,0xc0,0x00,0x0e,0x29,0xf2,0x0d,0x3c,0x03,0x11,0xfd,0x54,0x4b,0x90,0xc0,
-0x63,0x06,0x00,0x08,0xc0,0x0b,0xdd,0x10,0xdd,0x1b,0x62,0xdf,0xff,0xff,0xff,0xcd,
-0x10,0x07,0x3a,0x11,0x03,0x09,0x00,0x95,0xdc,0xbb,0xbb,0xbc,0xcd,0x43,0x33,0x33,
-0x6c,0x12,0x00,0x01,0x09,0x00,0x00,0x84,0x31,0x00,0x09,0x00,0xf0,0x11,0xb0,0xee,
-0xef,0x03,0xfe,0xee,0xee,0x00,0xe0,0x3b,0x00,0x0e,0xe0,0x0e,0x03,0xd4,0x45,0xee,
-0xee,0xf0,0x3e,0x88,0x9e,0xe0,0x0e,0x03,0xb0,0x00,0xee,0x00,0xe0,0x4b,0x16,0x00,
-0xa0,0x06,0xfe,0xee,0xee,0xdd,0xd0,0x96,0x00,0x1e,0xc0,0x00,0x01,0x10,0xe0,0xdd,
-0x10,0x10,0x1e,0xdb,0x2c,0x02,0x1b,0x18,0x03,0xf8,0x11,0xe0,0xfd,0xde,0x01,0x1e,
-0x21,0x10,0xd0,0x0e,0x4b,0xbf,0xcb,0xa0,0xd0,0x0e,0x12,0x00,0x80,0xe4,0x4e,0xcd,
-0xdf,0xdd,0xd6,0xe7,0x7e,0x16,0x02,0xf0,0x08,0xd0,0x0e,0x9b,0xbb,0xcf,0xb3,0xd0,
-0x0e,0x13,0x22,0x4c,0x20,0xe3,0x3e,0x0d,0x30,0x2c,0x00,0xea,0xa9,0x03,0xd0,0x2c,
-0xb5,0x02,0x21,0x50,0x2c,0x42,0x00,0xe4,0xd8,0x00,0x00,0xcb,0xaa,0xaa,0xab,0xb0,
-0x00,0x0c,0x87,0x77,0x77,0x8b,0x0d,0x00,0x80,0x22,0x22,0x4c,0x22,0x22,0x20,0x29,
-0x99,0x01,0x00,0x60,0x10,0x05,0xbb,0xbb,0xbb,0xb5,0x3b,0x11,0x00,0x28,0x16,0x50,
-0x07,0xdb,0xbb,0xbb,0xd8,0xd7,0x44,0xf0,0x01,0xf0,0x53,0x00,0x00,0x4c,0x90,0x0f,
-0x03,0xac,0x30,0x19,0x20,0x6c,0xc0,0x00,0x39,0x74,0x1a,0x10,0xfd,0x74,0x1a,0x02,
-0x95,0x27,0x90,0xec,0xcc,0xfd,0xcc,0xe4,0x00,0x0e,0x00,0x0e,0xa1,0x25,0x36,0xec,
-0xcc,0xfc,0x0d,0x00,0x91,0xbd,0xcd,0xfc,0xcc,0xc3,0x00,0x03,0xc0,0x5b,0x56,0x02,
-0x11,0xce,0xe2,0x35,0xc7,0x9e,0xdb,0x73,0x10,0x00,0x1e,0xc6,0x00,0x27,0xbd,0xef,
-0x40,0xd6,0x1d,0x00,0x8b,0x4b,0xf1,0x16,0xaf,0xaa,0xca,0x00,0x18,0x88,0x89,0xf8,
-0x8b,0xd8,0x20,0x33,0x33,0x3f,0x33,0x7b,0x30,0x00,0xaa,0xaa,0xfa,0xaa,0x60,0x00,
-0x39,0x99,0x9f,0x99,0x99,0x30,0x02,0x22,0x23,0xe2,0x22,0x22,0x02,0xa9,0x00,0xd0,
-0x92,0x00,0x8a,0x88,0x88,0x8a,0x90,0x00,0x09,0xc9,0x99,0x99,0xbb,0x5f,0x16,0x00,
-0x7a,0x16,0xf4,0x3f,0x09,0xca,0xaa,0xaa,0xbb,0x00,0x00,0xeb,0xaa,0xaa,0xad,0x80,
-0x00,0x0e,0xaa,0xaa,0xaa,0xc8,0x00,0x00,0xe5,0x44,0x44,0x49,0x80,0x00,0x05,0x55,
-0x55,0x55,0x53,0x00,0x6d,0xdc,0xde,0xcc,0xcc,0xcc,0x10,0x4b,0x44,0xd3,0x55,0x55,
-0x30,0x04,0xc6,0x7d,0x4e,0x76,0xc6,0x00,0x4e,0xbb,0xd0,0x78,0x3d,0x00,0x04,0x90,
-0x2e,0x20,0xcd,0x30,0x05,0xdf,0xdc,0xf5,0x7d,0xcb,0x30,0x11,0x00,0x0d,0x87,0x00,
-0x4c,0x10,0x81,0x12,0x01,0x7a,0x2c,0x00,0x29,0x06,0x06,0x81,0x12,0x20,0x1e,0xed,
-0xdd,0x2a,0x20,0x1c,0xe4,0xb3,0x0c,0x91,0x2e,0x6a,0xed,0xdd,0xde,0xa0,0x01,0x50,
-0xa5,0x5f,0x19,0xb1,0x0a,0x62,0x22,0x26,0xa0,0x00,0x00,0xab,0xaa,0xaa,0xba,0xab,
-0x58,0x20,0x04,0xa0,0x16,0x1a,0x50,0x4e,0xe6,0x00,0x02,0xb0,0xe8,0x05,0x00,0xe7,
-0x18,0x90,0x6f,0xee,0xf0,0x3e,0xfd,0xdf,0xc6,0x70,0x0d,0x0d,0x00,0x90,0x68,0x11,
-0xe0,0x02,0xfc,0xcf,0x06,0xdb,0xbf,0x0d,0x00,0x90,0x77,0x00,0xd0,0x02,0xfc,0xcf,
-0x07,0x82,0x2e,0x0d,0x00,0xf0,0x05,0x8c,0xaa,0xf0,0x5d,0xdd,0xdd,0xca,0x30,0x0d,
-0x00,0x0a,0x16,0x30,0xd1,0x00,0xd0,0x07,0xa0,0x2d,0x3c,0xd8,0x25,0x42,0x00,0x47,
-0x60,0x7e,0x19,0x2d,0x0b,0x6a,0x14,0x02,0x40,0x2e,0x09,0x12,0x24,0x20,0x01,0xcc,
-0x96,0x2c,0xc1,0xc2,0x02,0x22,0x3e,0xfe,0x32,0x22,0x00,0x00,0x0b,0x8f,0x7b,0x3c,
-0x2d,0xf2,0x03,0xf0,0x9a,0x00,0x00,0x2c,0x90,0x0f,0x00,0xac,0x20,0x3e,0x50,0x00,
-0xf0,0x00,0x7f,0x30,0x10,0x44,0x30,0x08,0x4e,0x00,0x14,0x2e,0xd5,0x22,0x07,0x60,
-0x24,0xf3,0x01,0x5a,0xaa,0xbf,0xaa,0xaa,0x50,0x01,0x33,0x4e,0xfe,0x43,0x32,0x00,
-0x00,0x0b,0x7f,0x4e,0x00,0x12,0x9b,0x4e,0x00,0x21,0x9d,0x30,0x4e,0x00,0x29,0x4e,
-0x30,0x34,0x00,0x09,0x8f,0x00,0x40,0xee,0xef,0xff,0xfe,0x1a,0x18,0x30,0x87,0xf8,
-0x70,0xda,0x12,0x30,0x0f,0x0d,0x10,0x8f,0x30,0x20,0xf0,0x6a,0xed,0x30,0xfc,0x02,
+0x00,0xf0,0x00,0x00,0x68,0x0a,0x41,0xe1,0x1e,0x00,0x06,0x80,0x8b,0xaf,0xaa,0xb0,
+0x00,0x68,0x6f,0x02,0x34,0x00,0xbe,0x40,0x79,0x03,0x11,0x00,0x34,0x03,0xf4,0x3c,
+0x08,0x40,0x00,0x00,0x1c,0x02,0xbb,0xde,0xbb,0x90,0x48,0xe7,0x13,0x91,0x16,0x61,
+0x04,0x7e,0x60,0x0b,0x20,0xd1,0x00,0x01,0xc0,0x7b,0xcb,0xce,0xbb,0x10,0x1c,0x01,
+0x12,0xc2,0x11,0x10,0x04,0xff,0x00,0x3c,0x00,0x00,0x0a,0xdd,0x1a,0xdf,0xdc,0xee,
+0xc3,0x01,0xc0,0x06,0xa0,0x09,0x60,0x00,0x1c,0x00,0x7c,0xa8,0xc0,0x00,0x01,0xc0,
+0x01,0x5d,0xcd,0x70,0x04,0xe8,0x0b,0xc8,0x20,0x19,0x90,0x56,0x00,0x40,0x85,0x00,
+0x67,0x38,0xff,0x00,0xf0,0x26,0x0d,0x40,0xe0,0x00,0x01,0x96,0x13,0xf6,0x6b,0x76,
+0x02,0xde,0xeb,0xce,0x88,0xf8,0x80,0x00,0x85,0x7e,0xc0,0x0e,0x00,0x00,0x08,0x5a,
+0x5f,0xdd,0xfd,0xc0,0x02,0xbe,0xb2,0xc0,0x0e,0x00,0x03,0xee,0x70,0x2d,0x33,0xf3,
+0x20,0x00,0x85,0x02,0xea,0xaf,0xa9,0x00,0x08,0x50,0x2c,0xa4,0x00,0x97,0x95,0x02,
+0xfe,0xef,0xee,0x50,0xce,0x20,0x2c,0x9a,0x02,0xf1,0x1f,0xe0,0x04,0x60,0x01,0xc0,
+0x00,0x0e,0x00,0x0d,0x10,0x79,0x00,0x00,0xe0,0x34,0xa7,0x4e,0x64,0x16,0xdf,0xd8,
+0x99,0x99,0x99,0x93,0x00,0xe0,0x38,0x88,0x01,0x09,0x00,0x0e,0x06,0x83,0xd0,0xc0,
+0xd0,0x15,0xfe,0x8a,0x7e,0x0c,0x0d,0x06,0xae,0x0d,0x00,0x61,0x00,0xe0,0x6a,0x7d,
+0x0c,0x0d,0x1a,0x00,0xe5,0x90,0xd0,0x00,0xe0,0x66,0x0c,0x00,0x0d,0x03,0xda,0x06,
+0x6a,0xa0,0x5d,0xaa,0x00,0x10,0xd0,0x15,0x01,0xf5,0x39,0x00,0x0d,0x00,0x0d,0xdc,
+0xd1,0x00,0x14,0xe4,0x09,0x70,0x5a,0x00,0x04,0x9f,0x96,0xfc,0xcf,0xdc,0xa0,0x00,
+0xd0,0x2c,0x04,0x14,0x0c,0x00,0x0d,0x10,0xc1,0xb0,0xb1,0xc0,0x05,0xfd,0x0c,0x93,
+0x23,0x7c,0x06,0x9d,0x00,0xc0,0x1d,0x00,0xc0,0x00,0xd0,0x9d,0xcd,0xfc,0xcd,0x70,
+0x0d,0x00,0x00,0xca,0x90,0x00,0x00,0xd0,0x02,0xb8,0x09,0xa3,0x02,0xe9,0x0b,0xb4,
+0x00,0x04,0xa7,0xaa,0x00,0x01,0x06,0x00,0xf0,0x1c,0x0e,0x00,0x3e,0xbb,0xd7,0x00,
+0x01,0xe1,0x03,0xa1,0x17,0x70,0x04,0xbf,0xb2,0x28,0x88,0x84,0x00,0x00,0xe0,0x7c,
+0xba,0x8c,0xbb,0x00,0x0e,0x19,0x31,0xb8,0x30,0xc0,0x05,0xfd,0xac,0xbb,0x8c,0xbc,
+0x05,0xaf,0x00,0x00,0x58,0x34,0x00,0xf6,0x0a,0xad,0xdf,0xfd,0xdd,0x10,0x0e,0x00,
+0x0b,0xcc,0xc1,0x00,0x00,0xe0,0x6d,0x65,0x83,0xd7,0x00,0xcc,0x19,0x10,0x58,0x00,
+0x70,0x00,0xac,0x01,0x70,0x50,0x00,0x00,0xec,0xcd,0xd0,0x79,0x5b,0x00,0xf3,0x30,
+0x1d,0x0c,0x95,0x55,0x30,0xeb,0xbc,0xd3,0xf7,0x6b,0xb3,0x0e,0x00,0x1d,0xcf,0x20,
+0xa4,0x00,0xeb,0xbc,0xfc,0x76,0x0e,0x10,0x0e,0x00,0x1d,0x02,0xc3,0xc0,0x00,0xe0,
+0x01,0xd0,0x0d,0xc6,0x00,0x0b,0xcc,0xca,0x00,0x7f,0x00,0x00,0x3a,0x0a,0x20,0x1d,
+0xe7,0x00,0x0b,0x50,0x3c,0x3d,0x71,0xe7,0x05,0xa0,0x00,0x4e,0x50,0x02,0xc6,0x52,
+0x00,0xf0,0x17,0x05,0x09,0x44,0x30,0xb0,0x00,0x00,0x76,0x94,0xc1,0x1d,0x00,0x00,
+0x15,0x9b,0x89,0x45,0xb2,0x22,0x02,0x8a,0xfe,0x98,0x9d,0xbe,0xd3,0x03,0xcc,0x8b,
+0x3e,0x90,0xa3,0x03,0xc2,0x62,0x07,0x9d,0x0d,0xab,0x02,0xf3,0x15,0x42,0xa4,0xc0,
+0x00,0xdf,0xdd,0xf4,0x05,0xe6,0x00,0x02,0xd0,0x2d,0x00,0x1f,0x10,0x00,0x2a,0xbc,
+0x30,0x0b,0xca,0x00,0x00,0x5d,0xb9,0x0a,0x90,0xc8,0x02,0xd8,0x10,0x1d,0x70,0x01,
+0xb5,0x98,0x03,0x05,0x01,0x00,0x12,0x1f,0x0e,0x00,0xf1,0x13,0xa8,0x00,0x00,0x01,
+0xcc,0xcc,0xcd,0xdc,0xcc,0xc7,0x02,0x2e,0x42,0x22,0x2c,0x62,0x10,0x00,0x69,0x00,
+0x03,0xd0,0x00,0x00,0x00,0xe3,0x00,0xb6,0x00,0x00,0x00,0x04,0xd1,0x7b,0x1d,0x04,
+0x11,0xde,0x2e,0x00,0xf2,0x08,0x7f,0xd2,0x00,0x00,0x00,0x03,0xcb,0x16,0xe7,0x00,
+0x00,0x6d,0xd5,0x00,0x02,0xbf,0xa3,0x09,0x40,0x00,0x00,0x00,0x17,0xae,0x04,0x01,
+0xb1,0x04,0xf6,0x3b,0x01,0x49,0x90,0x0b,0xbd,0xdb,0x89,0xc8,0x50,0x00,0x1a,0x11,
+0xc0,0x93,0x00,0x00,0x00,0xc1,0x59,0x09,0x30,0x00,0x01,0xce,0xce,0xdc,0x9c,0xbb,
+0xb5,0x00,0x08,0x60,0x0a,0x52,0xe3,0x10,0x22,0x97,0x22,0xa2,0x0d,0x10,0x0a,0xad,
+0xca,0x8b,0x10,0xd1,0x00,0x38,0x76,0x90,0xc0,0x0d,0x10,0x0b,0x47,0x69,0x5d,0x00,
+0xd1,0x00,0x80,0x76,0x18,0x90,0x0d,0x10,0x00,0x6d,0x30,0x82,0x00,0xd1,0xaa,0x00,
+0x13,0x1e,0xee,0x05,0xf1,0x04,0x00,0x00,0x00,0xdd,0xdd,0xde,0xdd,0xdd,0xd1,0x01,
+0x11,0x98,0x11,0x11,0x11,0x00,0x00,0x0a,0x60,0x19,0x00,0xb0,0xce,0xdd,0xdd,0xb0,
+0x00,0x00,0x0f,0x21,0x11,0x4b,0x00,0xbb,0x00,0xf4,0x0c,0x04,0xa0,0x00,0x00,0xa7,
+0x00,0x00,0x69,0x00,0x00,0x3e,0x10,0x00,0x08,0x60,0x00,0x3e,0x40,0x00,0x00,0xd3,
+0x00,0x1e,0x40,0x00,0x9e,0xea,0x52,0x00,0xf0,0x38,0x0d,0xdd,0xf1,0x8d,0xdd,0xdc,
+0x00,0xd0,0x0c,0x10,0x31,0xc0,0x00,0x0d,0xcc,0xf1,0x3a,0x1c,0x00,0x00,0xd0,0x0c,
+0x17,0x73,0xa0,0x00,0x0d,0x32,0xd1,0xc9,0xac,0x77,0x10,0xda,0xaa,0x06,0x6c,0x96,
+0x60,0x0d,0x01,0x20,0x00,0xeb,0x00,0x00,0xd0,0x2b,0x00,0x6b,0xc0,0x00,0x0e,0x29,
+0xf2,0x0d,0x3c,0x03,0x11,0xfd,0x54,0x4b,0x90,0xc0,0x63,0x06,0x00,0x08,0xc0,0x0b,
+0xdd,0xd6,0x06,0xf1,0x01,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xcd,0x10,0x00,0x00,
+0x3c,0xd1,0x00,0x00,0x03,0x09,0x00,0x95,0xdc,0xbb,0xbb,0xbc,0xcd,0x43,0x33,0x33,
+0x6c,0x12,0x00,0x01,0x09,0x00,0x40,0xff,0xff,0xff,0xfc,0x09,0x00,0xf0,0x11,0xb0,
+0xee,0xef,0x03,0xfe,0xee,0xee,0x00,0xe0,0x3b,0x00,0x0e,0xe0,0x0e,0x03,0xd4,0x45,
+0xee,0xee,0xf0,0x3e,0x88,0x9e,0xe0,0x0e,0x03,0xb0,0x00,0xee,0x00,0xe0,0x4b,0x16,
+0x00,0xc0,0x06,0xfe,0xee,0xee,0xdd,0xd0,0x96,0x00,0x1e,0xc0,0x00,0x1e,0xb4,0x02,
+0x94,0x0b,0x80,0x00,0x1e,0x00,0x07,0xa0,0x00,0xde,0x1d,0x03,0x00,0x0b,0x05,0xe0,
+0xfd,0xde,0x01,0x1e,0x21,0x10,0xd0,0x0e,0x4b,0xbf,0xcb,0xa0,0xd0,0x0e,0x12,0x00,
+0x80,0xe4,0x4e,0xcd,0xdf,0xdd,0xd6,0xe7,0x7e,0x16,0x02,0xf0,0x08,0xd0,0x0e,0x9b,
+0xbb,0xcf,0xb3,0xd0,0x0e,0x13,0x22,0x4c,0x20,0xe3,0x3e,0x0d,0x30,0x2c,0x00,0xea,
+0xa9,0x03,0xd0,0x2c,0xb5,0x02,0x21,0x50,0x2c,0x42,0x00,0xe4,0xd8,0x00,0x00,0xcb,
+0xaa,0xaa,0xab,0xb0,0x00,0x0c,0x87,0x77,0x77,0x8b,0x0d,0x00,0x80,0x22,0x22,0x4c,
+0x22,0x22,0x20,0x29,0x99,0x01,0x00,0xf0,0x1e,0x10,0x05,0xbb,0xbb,0xbb,0xb5,0x00,
+0x00,0x77,0x00,0x00,0x07,0x80,0x00,0x07,0xdb,0xbb,0xbb,0xd8,0x00,0x00,0x06,0x30,
+0xf0,0x53,0x00,0x00,0x4c,0x90,0x0f,0x03,0xac,0x30,0x19,0x20,0x6c,0xc0,0x00,0x39,
+0x00,0x1d,0xdd,0xdd,0xfd,0xdd,0x11,0x01,0x10,0x0e,0x29,0x02,0xf6,0x01,0xec,0xcc,
+0xfd,0xcc,0xe4,0x00,0x0e,0x00,0x0e,0x10,0x0a,0x40,0x00,0xec,0xcc,0xfc,0x0d,0x00,
+0x91,0xbd,0xcd,0xfc,0xcc,0xc3,0x00,0x03,0xc0,0x5b,0x56,0x02,0x20,0xce,0x30,0x50,
+0x02,0xd8,0x9e,0xdb,0x73,0x10,0x00,0x1e,0xc6,0x00,0x27,0xbd,0xef,0x40,0x00,0xa6,
+0x03,0xf1,0x18,0x09,0xaa,0xaf,0xaa,0xca,0x00,0x18,0x88,0x89,0xf8,0x8b,0xd8,0x20,
+0x33,0x33,0x3f,0x33,0x7b,0x30,0x00,0xaa,0xaa,0xfa,0xaa,0x60,0x00,0x39,0x99,0x9f,
+0x99,0x99,0x30,0x02,0x22,0x23,0xe2,0x22,0x22,0x02,0xa9,0x00,0xf0,0x01,0x92,0x00,
+0x8a,0x88,0x88,0x8a,0x90,0x00,0x09,0xc9,0x99,0x99,0xbb,0x00,0x00,0x95,0x67,0x01,
+0xf1,0x43,0x00,0x09,0xca,0xaa,0xaa,0xbb,0x00,0x00,0xeb,0xaa,0xaa,0xad,0x80,0x00,
+0x0e,0xaa,0xaa,0xaa,0xc8,0x00,0x00,0xe5,0x44,0x44,0x49,0x80,0x00,0x05,0x55,0x55,
+0x55,0x53,0x00,0x6d,0xdc,0xde,0xcc,0xcc,0xcc,0x10,0x4b,0x44,0xd3,0x55,0x55,0x30,
+0x04,0xc6,0x7d,0x4e,0x76,0xc6,0x00,0x4e,0xbb,0xd0,0x78,0x3d,0x00,0x04,0x90,0x2e,
+0x20,0xcd,0x30,0x05,0xdf,0xdc,0xf5,0x7d,0xcb,0x30,0x11,0x00,0x0d,0x87,0x00,0x4c,
+0x10,0x00,0x00,0x08,0x9b,0x00,0x10,0x04,0xca,0x08,0x00,0x29,0x06,0x52,0xee,0xee,
+0x20,0x00,0x4c,0xa3,0x02,0xf0,0x05,0xed,0xdd,0xdd,0x90,0x00,0x1c,0xe4,0x00,0x00,
+0x4a,0x00,0x2e,0x6a,0xed,0xdd,0xde,0xa0,0x01,0x50,0xa5,0x0d,0x00,0xf1,0x01,0x00,
+0x0a,0x62,0x22,0x26,0xa0,0x00,0x00,0xab,0xaa,0xaa,0xba,0x00,0x00,0x0a,0x40,0x9e,
+0x02,0x71,0xa4,0x00,0x4e,0xe6,0x00,0x02,0xb0,0xe8,0x05,0xc0,0x2b,0x00,0xe0,0x6f,
+0xee,0xf0,0x3e,0xfd,0xdf,0xc6,0x70,0x0d,0x0d,0x00,0x90,0x68,0x11,0xe0,0x02,0xfc,
+0xcf,0x06,0xdb,0xbf,0x0d,0x00,0x90,0x77,0x00,0xd0,0x02,0xfc,0xcf,0x07,0x82,0x2e,
+0x0d,0x00,0xf6,0x0e,0x8c,0xaa,0xf0,0x5d,0xdd,0xdd,0xca,0x30,0x0d,0x00,0x0a,0x16,
+0x30,0xd1,0x00,0xd0,0x07,0xa0,0x2d,0x3c,0x00,0x0e,0x02,0xc0,0x00,0x47,0x60,0x7e,
+0xc0,0x2e,0x03,0x11,0xf0,0x06,0x00,0x10,0x0f,0x59,0x01,0x00,0x55,0x08,0x13,0xf4,
+0x0d,0x00,0x01,0x1a,0x00,0x00,0xeb,0x03,0xe0,0xcf,0xcc,0xcc,0xc2,0x02,0x22,0x3e,
+0xfe,0x32,0x22,0x00,0x00,0x0b,0x8f,0xde,0x03,0xf0,0x05,0x0a,0x90,0xf0,0x9a,0x00,
+0x00,0x2c,0x90,0x0f,0x00,0xac,0x20,0x3e,0x50,0x00,0xf0,0x00,0x7f,0x30,0x10,0x34,
+0x00,0x19,0x10,0x4e,0x00,0x20,0x2e,0xee,0xf2,0x00,0x18,0x20,0x4e,0x00,0xf3,0x02,
+0x00,0x5a,0xaa,0xbf,0xaa,0xaa,0x50,0x01,0x33,0x4e,0xfe,0x43,0x32,0x00,0x00,0x0b,
+0x7f,0x4e,0x00,0x12,0x9b,0x4e,0x00,0x21,0x9d,0x30,0x4e,0x00,0x29,0x4e,0x30,0x34,
+0x00,0x09,0x8f,0x00,0xa0,0xee,0xef,0xff,0xfe,0xee,0xe2,0x00,0x00,0x87,0xf8,0x4a,
+0x05,0x20,0x2d,0x0f,0xdf,0x07,0xfc,0x0a,0x0b,0x60,0xf0,0x6a,0x00,0x00,0x06,0xc0,
 0x0f,0x00,0xd6,0x00,0x06,0xe4,0x22,0xf2,0x24,0xe6,0x03,0xd2,0xcc,0xcf,0xcc,0xc2,
-0xd3,0x41,0x00,0x16,0x00,0x0b,0x3d,0x40,0x05,0xfe,0xdd,0xdb,0x4b,0x47,0x81,0x20,
-0x1d,0x60,0x00,0x0b,0xa0,0x5e,0x5e,0x8c,0x3d,0x00,0xdb,0x52,0xe0,0x15,0x8d,0xb5,
-0x15,0xbd,0xa6,0x12,0x84,0x10,0x0f,0x00,0x04,0x71,0x00,0xa5,0x02,0x60,0xd0,0x00,
-0x00,0x22,0x0f,0x03,0xc8,0x1b,0xf0,0x00,0x30,0xf0,0x6c,0x10,0x00,0x4d,0x40,0x0f,
-0x00,0x5c,0x00,0x02,0x20,0x2d,0xb0,0xc2,0x25,0x11,0x86,0x7b,0x09,0xf0,0x14,0x08,
-0x60,0x13,0xd5,0x33,0x00,0x00,0x86,0x04,0xaf,0xab,0xc0,0x06,0xef,0xee,0x14,0xb0,
-0x1c,0x10,0x00,0xd6,0x00,0xc5,0x01,0xc9,0x10,0x2f,0xe2,0xb7,0x16,0x0b,0xb0,0x08,
-0xb8,0xc0,0xae,0x55,0xf1,0x02,0xc8,0x63,0xaa,0xbf,0xaa,0xa0,0x94,0x86,0x03,0x35,
-0xf3,0x33,0x01,0x08,0x60,0x00,0x2f,0xf7,0x08,0x01,0xec,0x3f,0x02,0x0d,0x00,0x04,
-0x28,0x23,0x10,0x02,0xe1,0x0c,0xf0,0x21,0x67,0x00,0x9c,0x88,0x83,0x00,0x28,0x92,
-0x2f,0x77,0x7f,0x30,0x2b,0xed,0xbd,0xb9,0x09,0xa0,0x00,0x0c,0xd1,0x40,0xab,0xb0,
-0x00,0x02,0xfb,0xb0,0x6c,0xbb,0x40,0x00,0x8a,0x79,0xea,0x20,0x17,0xc2,0x1c,0x67,
-0x15,0xdd,0xdd,0xd3,0x05,0x56,0x70,0x49,0x8a,0x00,0xb0,0x67,0x04,0x90,0x00,0xb3,
-0x00,0x06,0x70,0x4e,0xcc,0xcf,0x0d,0x00,0x3b,0x91,0x11,0xc3,0x83,0x23,0x11,0x80,
-0x0e,0x18,0xf0,0x07,0x68,0x00,0x09,0xbc,0x00,0x00,0x27,0x92,0x1a,0x90,0x5c,0x30,
+0xd3,0x41,0x00,0x02,0x62,0x08,0x11,0xa0,0x2b,0x05,0xf0,0x01,0xfe,0xdd,0xdb,0x00,
+0x00,0x08,0xed,0x20,0x1d,0x60,0x00,0x0b,0xa0,0x5e,0x5e,0x70,0xff,0x00,0xf0,0x03,
+0xcf,0xd4,0x00,0x00,0x15,0x8d,0xb5,0x15,0xbd,0xa6,0x12,0x84,0x10,0x0f,0x00,0x04,
+0x71,0x00,0xa5,0x02,0xf0,0x0c,0xd0,0x00,0x00,0x22,0x0f,0x03,0x10,0x00,0x00,0x2d,
+0x30,0xf0,0x6c,0x10,0x00,0x4d,0x40,0x0f,0x00,0x5c,0x00,0x02,0x20,0x2d,0xb0,0x00,
+0x50,0xb6,0x08,0x20,0x0b,0x30,0x82,0x08,0xf1,0x27,0x13,0xd5,0x33,0x00,0x00,0x86,
+0x04,0xaf,0xab,0xc0,0x06,0xef,0xee,0x14,0xb0,0x1c,0x10,0x00,0xd6,0x00,0xc5,0x01,
+0xc9,0x10,0x2f,0xe2,0xb7,0x16,0x0b,0xb0,0x08,0xb8,0xc0,0x02,0xf0,0x00,0x01,0xc8,
+0x63,0xaa,0xbf,0xaa,0xa0,0x94,0x86,0x03,0x35,0xf3,0x33,0x01,0x08,0x60,0x00,0x2f,
+0xf7,0x08,0x43,0x02,0xf0,0x00,0x00,0x0d,0x00,0x02,0x01,0x00,0xf0,0x28,0x06,0x70,
+0x02,0xb0,0x00,0x00,0x00,0x67,0x00,0x9c,0x88,0x83,0x00,0x28,0x92,0x2f,0x77,0x7f,
+0x30,0x2b,0xed,0xbd,0xb9,0x09,0xa0,0x00,0x0c,0xd1,0x40,0xab,0xb0,0x00,0x02,0xfb,
+0xb0,0x6c,0xbb,0x40,0x00,0x8a,0x79,0xea,0x20,0x17,0xc2,0x1c,0x67,0x15,0xdd,0xdd,
+0xd3,0x05,0x56,0x70,0x49,0x8a,0x00,0xb0,0x67,0x04,0x90,0x00,0xb3,0x00,0x06,0x70,
+0x4e,0xcc,0xcf,0x0d,0x00,0x49,0x91,0x11,0xc3,0x00,0x01,0x00,0x50,0x06,0x80,0x00,
+0x0c,0x20,0x7b,0x08,0xf0,0x05,0x09,0xbc,0x00,0x00,0x27,0x92,0x1a,0x90,0x5c,0x30,
 0x2b,0xee,0xcd,0xed,0xdd,0xfd,0x50,0x0b,0xc0,0x20,0xd0,0x08,0xf0,0x0f,0xfe,0x68,
 0xcc,0xfc,0xcb,0x00,0x5c,0x8a,0xa3,0x0d,0x00,0xe0,0x0c,0x78,0x0a,0x30,0xd0,0x0e,
 0x04,0x96,0x80,0x7c,0xcf,0xdc,0xb0,0x01,0x68,0x00,0x07,0xbc,0x41,0x00,0xb5,0x08,
 0xc0,0x5c,0x40,0x00,0x68,0x3d,0x70,0x00,0x3b,0x50,0x75,0x07,0x01,0x1c,0x04,0xf0,
-0x2c,0x06,0xdd,0xdd,0xef,0x50,0x26,0xe6,0x00,0x01,0x89,0x20,0x01,0x4f,0x45,0x97,
+0x34,0x06,0xdd,0xdd,0xef,0x50,0x26,0xe6,0x00,0x01,0x89,0x20,0x01,0x4f,0x45,0x97,
 0x86,0xbb,0x90,0x03,0xf5,0x93,0xa8,0x51,0x1b,0x00,0x7f,0xba,0x0a,0x85,0xc6,0x70,
 0x0b,0xd4,0xa0,0xa8,0x43,0xf2,0x03,0x9d,0x09,0xbb,0x84,0x4e,0x50,0x63,0xd0,0x60,
-0x38,0x7c,0x1c,0x00,0x0d,0x00,0x0b,0xc3,0x10,0x10,0x00,0xd2,0x77,0x0f,0x30,0x30,
-0x0d,0x02,0x72,0x11,0x04,0x4e,0x00,0xf4,0x37,0x0c,0xcc,0xb9,0xcf,0xc3,0x03,0xe3,
-0xc0,0x0b,0x44,0xc0,0x03,0xcf,0xcd,0xbb,0xb7,0x4b,0x00,0x01,0xf2,0xc0,0x0b,0xa3,
-0xa0,0x00,0x5f,0xac,0xbb,0xbe,0xde,0xc6,0x09,0xe9,0xd1,0x11,0x08,0x50,0x00,0xbd,
-0x0c,0x07,0x30,0xdb,0x00,0x57,0xd0,0xc0,0x6a,0x2d,0xb0,0x03,0x1d,0x0d,0xca,0xb9,
-0x6b,0x03,0x00,0xd0,0xb3,0x02,0xc1,0xb0,0x80,0x0d,0x00,0x00,0xb2,0x0d,0xc5,0xf8,
-0x00,0xf0,0x35,0x66,0x00,0x1c,0x01,0xc0,0x00,0x06,0x60,0x8b,0xfb,0xcf,0xb4,0x00,
-0x66,0x01,0x4d,0x24,0xd2,0x03,0xef,0xfd,0x49,0xe8,0x9e,0x81,0x00,0xb7,0x08,0x9e,
-0x89,0xe8,0x50,0x1f,0xd1,0x33,0x3b,0x63,0x32,0x06,0xdb,0x95,0xeb,0xec,0xbf,0x00,
-0xc7,0x66,0x5c,0x6c,0x96,0xe0,0x58,0x66,0x05,0xb3,0xb6,0x3e,0x01,0x16,0x64,0xde,
-0xcd,0xcc,0xf9,0x00,0x66,0x05,0x90,0x40,0x5b,0x73,0x60,0x59,0x00,0x4c,0xb0,0x00,
-0x67,0xa7,0x01,0xf7,0x83,0xcc,0xfc,0xfd,0xc4,0x00,0x67,0x04,0x6e,0x6d,0x76,0x03,
-0xef,0xfd,0x95,0xc3,0xc3,0xe0,0x00,0xb7,0x09,0x3b,0x0b,0x0d,0x00,0x0f,0xd0,0x6b,
-0xbb,0xbb,0xb0,0x05,0xdb,0x92,0x99,0x99,0x96,0x00,0xc7,0x76,0x01,0x11,0x11,0x10,
-0x49,0x67,0x0c,0xcc,0xfc,0xcc,0x41,0x16,0x70,0x1a,0x0d,0x19,0x20,0x00,0x67,0x2c,
-0x40,0xd1,0x3d,0x10,0x06,0x71,0x32,0xcd,0x00,0x41,0x00,0xc0,0x04,0x28,0x30,0x60,
-0x00,0x0c,0x00,0xa0,0x84,0x65,0x10,0x02,0xd2,0x46,0x88,0x6c,0x68,0x03,0xcf,0xbb,
-0xc7,0x78,0x9d,0x00,0x03,0xf0,0x09,0x76,0x77,0x59,0x00,0x7f,0x79,0xcb,0x9a,0xda,
-0xb0,0x0a,0xca,0x1a,0x03,0xb2,0xb1,0x02,0x9c,0x09,0xfc,0xcf,0xcc,0xc0,0x73,0xc0,
-0x0f,0x50,0xa3,0xb3,0x00,0x0c,0x04,0x9b,0x65,0xe6,0x00,0x00,0xc0,0xc2,0x04,0xbe,
-0x36,0x50,0x0c,0x74,0x04,0xa2,0x2c,0x05,0x07,0x02,0x64,0x44,0x01,0x08,0x5a,0x11,
-0x21,0x0d,0x00,0x01,0xbb,0x41,0x00,0x4c,0x04,0x30,0x9d,0xbb,0xb8,0x0d,0x00,0x20,
-0x83,0x33,0xf9,0x17,0x09,0x1a,0x00,0x06,0x0d,0x00,0x81,0x6c,0xfd,0xcc,0xee,0xcc,
-0xcc,0x11,0x11,0x54,0x43,0x11,0x08,0xcd,0x16,0x04,0x4e,0x00,0x02,0x5b,0x00,0x21,
-0x04,0x80,0x0d,0x00,0xe1,0x59,0x00,0x9d,0xbb,0xb4,0x00,0x05,0x90,0x09,0x83,0x33,
-0x10,0x00,0x59,0x1a,0x00,0x23,0x05,0x90,0x1a,0x00,0x10,0x96,0xde,0x46,0x31,0xeb,
-0xbe,0xdb,0xd7,0x13,0x03,0xb8,0x3b,0xf0,0x22,0x01,0xd2,0x40,0x01,0xde,0xed,0xc0,
-0x0d,0x2b,0x80,0x00,0x94,0x00,0x02,0xe5,0x79,0x10,0x0e,0xdd,0x6c,0xaf,0x63,0x10,
-0x02,0xa0,0x94,0x00,0xe0,0x14,0x30,0xa4,0x0d,0x24,0x7e,0xed,0xa4,0x2d,0x96,0xd4,
-0xa6,0xb4,0x05,0x30,0x11,0xc8,0x00,0x07,0x74,0xe1,0xfd,0x13,0x20,0x3d,0xd3,0x6a,
-0x29,0xfb,0x00,0x19,0xf3,0x02,0x05,0xe1,0x02,0x8d,0x68,0xa1,0xa0,0xc2,0x00,0x86,
-0x00,0x0a,0xd4,0x22,0x03,0xcf,0x39,0x80,0x1e,0xec,0xcc,0xcc,0xcc,0x00,0x0c,0x71,
-0xb7,0x00,0xc0,0x0a,0x98,0xcc,0xcc,0xcc,0xc0,0x00,0x20,0xd3,0x18,0x71,0x1e,0x04,
-0x04,0x70,0x95,0x01,0xd0,0x02,0xee,0xfe,0xef,0x3c,0x27,0x81,0x4a,0x00,0xc1,0x03,
-0xb0,0x00,0x07,0x80,0xdd,0x2e,0x10,0xae,0xb9,0x29,0x12,0x40,0x35,0x2a,0x00,0x4c,
-0x0d,0x1a,0xcc,0x84,0x1a,0x11,0x1e,0xa4,0x16,0x06,0x06,0x00,0x20,0x01,0x50,0x06,
-0x00,0x70,0x1d,0xb0,0x1f,0xff,0xf1,0xe6,0xe8,0x12,0x00,0x2d,0xec,0x30,0x24,0x00,
-0xfa,0x05,0x00,0x93,0x1e,0x00,0x30,0xe1,0x00,0xb3,0x2f,0x8e,0xd1,0xe2,0x00,0xd1,
-0x6e,0x82,0x00,0x8f,0xee,0x90,0xaf,0x00,0x12,0xc4,0x11,0x21,0x70,0xba,0xaa,0xaa,
-0xaa,0x10,0x0b,0x82,0xfa,0x02,0x82,0x08,0xd7,0xcc,0xcc,0xcc,0xb0,0x03,0xe2,0x65,
-0x18,0x00,0x95,0x12,0x01,0x91,0x54,0x70,0x70,0x96,0x00,0x00,0x7d,0x41,0xd2,0xea,
-0x0c,0x20,0x3c,0xe7,0x1e,0x16,0xf5,0x04,0x02,0xdb,0xe3,0x04,0xa1,0x40,0x07,0xe4,
-0x05,0xe3,0x1e,0x48,0x0c,0x91,0x00,0x03,0x00,0x7e,0x30,0x60,0x27,0x00,0x06,0x07,
-0x40,0x2b,0xc0,0x60,0x0e,0x39,0x00,0x40,0x0d,0x10,0xe0,0x15,0xf4,0x19,0xe0,0x0f,
-0xae,0xd0,0x3c,0x40,0x0d,0x8e,0xf5,0x1d,0x00,0x3c,0x5b,0xf8,0x2e,0x3b,0x17,0x10,
-0x4e,0xc1,0x26,0xd1,0x00,0x70,0xd1,0x0e,0x04,0xb0,0x00,0x5b,0x0d,0x10,0xe6,0xc4,
-0x00,0x89,0x15,0xf0,0x01,0x74,0x08,0xa0,0x0d,0x20,0x00,0x0a,0x40,0xa1,0x00,0x7e,
-0xee,0xee,0xc0,0x06,0x81,0x7b,0x06,0x00,0xf5,0x3f,0x11,0x4a,0x91,0x03,0x51,0xde,
-0xfd,0xd7,0x00,0x20,0xa0,0x36,0x21,0x3e,0x80,0x1a,0x00,0xf1,0x02,0x1b,0x31,0x22,
-0x6b,0x22,0x20,0x00,0x00,0x7b,0xbf,0xdb,0xbb,0x00,0x00,0x70,0x02,0xe1,0x6a,0x33,
-0x70,0xa7,0x09,0x20,0x00,0x0c,0x40,0x3d,0xbf,0x43,0xc4,0xb0,0x1d,0xa9,0xac,0xf7,
-0x00,0xb2,0x01,0xa7,0x52,0x01,0xd0,0xe4,0x16,0x11,0x90,0xa3,0x00,0x21,0x08,0xd1,
-0xb4,0x0c,0x70,0x03,0x2f,0xee,0xfe,0xef,0x70,0x10,0xad,0x15,0xf1,0x37,0xd1,0x0c,
-0xa1,0x2c,0x00,0xe0,0x17,0x00,0x06,0x33,0xfd,0xef,0xde,0x70,0x00,0x00,0x4a,0xa3,
-0x00,0xb4,0x00,0x01,0x95,0x83,0xc0,0x3d,0x00,0x00,0x78,0x76,0x09,0x9d,0x30,0x00,
-0x1e,0x1b,0x30,0x2f,0xc0,0x00,0x08,0x92,0xd1,0x7e,0x69,0xd5,0x00,0x71,0x65,0xa9,
-0x10,0x04,0xb6,0x07,0x50,0x14,0x01,0xd0,0x05,0x10,0x2c,0x91,0xe1,0x1d,0x03,0xe0,
-0x00,0x04,0x08,0x81,0x08,0x1b,0xd2,0x12,0x1d,0x04,0x00,0x2d,0x50,0x0f,0xee,0xee,
-0xed,0x00,0x1b,0x20,0x69,0x2d,0x00,0x84,0x23,0x31,0x00,0x01,0x80,0x0d,0x00,0x11,
-0x96,0x0d,0x00,0x11,0x1e,0x83,0x2d,0x30,0x0a,0x70,0x0e,0x8d,0x16,0x53,0x90,0x00,
-0xe0,0x00,0xdd,0x7e,0x1c,0x00,0xa1,0x3a,0x30,0x01,0xb9,0x50,0x2f,0x44,0x30,0x0c,
-0x0b,0x10,0x7a,0x1c,0xf8,0x2f,0xfd,0xd3,0x01,0x00,0xd0,0x00,0x0c,0x00,0x03,0xe8,
-0x0d,0x6c,0xc8,0xc0,0x90,0x01,0x90,0xd0,0x00,0x0c,0x2b,0x00,0x00,0x0d,0x6d,0xca,
-0xa9,0x60,0x00,0x94,0xb6,0x40,0xa8,0xe0,0x00,0x1e,0x3a,0x6b,0xaa,0x89,0x01,0x07,
-0x86,0x76,0x61,0x4e,0xb2,0x80,0xe2,0xc2,0x11,0x4d,0x2d,0x76,0x17,0x1a,0x00,0x0a,
-0x20,0x5e,0x10,0x00,0x90,0x3a,0xa1,0x7e,0x65,0xed,0xdd,0xde,0x00,0x00,0x15,0x59,
-0x00,0x4c,0x1c,0x70,0xec,0xcc,0xce,0x00,0x6a,0x20,0x58,0x0d,0x00,0x20,0x4d,0x04,
-0xb7,0x02,0x04,0x30,0x16,0xf0,0x05,0x5b,0xde,0xde,0xde,0x50,0x00,0xa5,0xb1,0x91,
-0x92,0x85,0x00,0x2d,0x0b,0x19,0x19,0x28,0x50,0x0b,0x60,0x0d,0x00,0x74,0x02,0xc0,
-0xbf,0xdf,0xef,0xef,0xe3,0x4c,0x01,0x02,0x07,0x00,0x21,0x8d,0x4c,0x47,0x2d,0x40,
-0x22,0xc2,0x00,0xc0,0xf3,0x11,0xf0,0x05,0x2d,0xcd,0xbb,0xb0,0x5d,0x40,0xd2,0xd0,
-0x00,0x1c,0x00,0x29,0x0e,0x0f,0xbb,0xbb,0xc0,0x00,0x00,0xe0,0x0d,0x00,0xf7,0x52,
-0x06,0x1e,0x0b,0xbf,0xbb,0x90,0x00,0xe4,0xc0,0x60,0xe0,0x52,0x00,0x79,0x77,0x5c,
-0x0e,0x04,0xa0,0x1e,0x2d,0x3e,0x30,0xe0,0x0a,0x12,0x72,0x80,0x01,0xdc,0x00,0x00,
-0x01,0xa3,0x06,0x72,0x70,0x00,0x00,0x03,0xb2,0xf9,0x8f,0x87,0x50,0x07,0x21,0xdc,
-0x44,0xe4,0x43,0x00,0x5c,0x7a,0xea,0xaf,0xaa,0x30,0x00,0x04,0x3c,0x33,0xe3,0x31,
-0x00,0x06,0xb3,0xd5,0x5f,0x55,0x20,0x06,0xc0,0x3e,0xbb,0xfb,0xba,0x00,0x51,0x03,
-0xa6,0x11,0x11,0x10,0x03,0x33,0x33,0xe3,0x33,0x33,0x10,0xaa,0xaa,0xaf,0xba,0xaa,
-0xa5,0x29,0x0d,0x07,0xe3,0x0e,0x01,0x0b,0x1c,0x52,0x89,0xcc,0xcf,0xdc,0xcc,0x20,
-0x12,0x92,0xa4,0x02,0x00,0x4d,0xdd,0xdd,0xd6,0x13,0xe8,0xc7,0x10,0xf0,0x06,0x50,
-0x7c,0xcf,0xcc,0xca,0x00,0x00,0x08,0x40,0xb2,0x02,0xb0,0x00,0x55,0x8c,0xbe,0xcb,
-0xcb,0x00,0x0c,0x38,0x0d,0x00,0xe0,0x03,0xd0,0x6b,0xcb,0xbc,0xb8,0x00,0xb6,0x01,
-0x99,0x00,0xc9,0x10,0x0a,0x83,0x34,0x25,0x5d,0x20,0xe6,0x02,0x20,0x05,0x90,0xe6,
-0x02,0xf0,0x04,0xfa,0xcd,0xad,0x50,0x00,0x03,0x0e,0x58,0xb5,0xa5,0x00,0x10,0x00,
-0x55,0x8b,0x55,0x10,0x3d,0x92,0xd9,0x20,0xf5,0x1f,0x50,0x07,0x11,0xa8,0x88,0x89,
-0x50,0x00,0x00,0x1e,0x88,0x88,0xb8,0x00,0x02,0xb1,0xd3,0x33,0x38,0x80,0x00,0x96,
-0x1e,0x77,0x77,0xb8,0x00,0x2e,0x01,0xda,0x99,0xab,0x70,0x0b,0x60,0x06,0xd3,0x0a,
-0x92,0x00,0x80,0x2c,0x71,0x00,0x04,0xc2,0x50,0x17,0x11,0x10,0x5c,0x00,0x10,0xd2,
-0x89,0x03,0xf1,0x1a,0x03,0xed,0xbe,0xbf,0xbd,0xd9,0x02,0xeb,0x62,0xa0,0xc0,0x77,
-0x00,0x03,0x87,0x3b,0x1d,0x18,0x81,0x00,0xad,0xdc,0xec,0xfc,0xdd,0xa0,0x00,0x76,
-0x2a,0x0c,0x07,0x70,0x00,0x07,0x72,0xb0,0xd0,0x77,0x00,0x2d,0xdd,0xd7,0x1e,0xf3,
-0x05,0x07,0x02,0x20,0x40,0x08,0x00,0x05,0xb0,0x68,0x09,0x60,0x98,0x01,0xe2,0x04,
-0xa0,0x4b,0x00,0xe2,0x01,0x57,0x29,0x50,0x0d,0x10,0x03,0xb0,0x40,0xeb,0x10,0x40,
-0x3b,0x0d,0x30,0x3d,0x0d,0x00,0xb1,0x3c,0x00,0x88,0xd1,0x00,0x3b,0x00,0x10,0x00,
-0x7d,0x8f,0x16,0x1d,0x31,0xd1,0x00,0x6f,0xa3,0x43,0x00,0x4d,0x41,0xf4,0x0e,0x7c,
-0xe1,0x00,0xe5,0xa0,0x00,0x6b,0x0d,0x10,0x6b,0x0b,0x20,0x01,0x00,0xd1,0x1e,0x30,
-0x4c,0x00,0x00,0x0d,0x2d,0x70,0x00,0x9b,0x10,0x00,0xd9,0x80,0xcf,0x05,0x13,0x00,
-0xc6,0x50,0x11,0x0b,0x5c,0x24,0xf0,0x1a,0x50,0x22,0x00,0x78,0x06,0x02,0x30,0x02,
-0xd6,0x5e,0x8c,0x63,0xd3,0x00,0x00,0x54,0x6d,0x80,0x51,0x00,0x00,0x29,0x39,0x75,
-0x99,0x60,0x00,0x9c,0x4b,0xfd,0xce,0x5a,0xa0,0x02,0x00,0x21,0x92,0x11,0x04,0x01,
-0xdd,0xf3,0x19,0x15,0xd6,0x75,0x04,0x16,0x0c,0x2d,0x12,0x00,0xb9,0x17,0xf5,0x13,
-0x11,0x11,0x04,0xdf,0xed,0x6e,0xbb,0xbc,0xc0,0x00,0x86,0x04,0x90,0x00,0x2c,0x00,
-0x08,0x60,0x4e,0xcc,0xcc,0xc0,0x16,0xba,0x64,0x90,0x00,0x2c,0x01,0x7b,0xa7,0x4e,
-0xcc,0xcd,0x1a,0x00,0xf0,0x03,0x61,0x4d,0xfc,0xfc,0xa0,0x03,0xbe,0xd2,0x4a,0x0e,
-0x00,0x06,0xc7,0x20,0x09,0x60,0xe0,0x11,0x71,0x44,0x94,0x0e,0x04,0x80,0x00,0x0d,
-0xa1,0x00,0xad,0xe4,0xfc,0x1c,0xf0,0x06,0xff,0xc8,0xed,0xfd,0xdf,0x00,0x08,0x60,
-0x84,0x0d,0x00,0xe0,0x00,0x86,0x08,0xdc,0xfc,0xcf,0x00,0x29,0x71,0x0d,0x00,0xf1,
-0x00,0x0d,0xee,0x98,0x61,0xd1,0x1e,0x00,0x08,0x60,0x5b,0xbf,0xbb,0xb0,0x00,0x86,
-0x1e,0x02,0xf2,0x00,0x08,0x86,0x9e,0xef,0xee,0xe2,0x06,0xdf,0x90,0x00,0xe1,0x00,
-0x02,0xd6,0x10,0x10,0x0c,0xa0,0x8e,0xee,0xfe,0xee,0x80,0x00,0x09,0x10,0xc2,0x00,
-0xc7,0x38,0x01,0x9c,0x27,0x70,0x8b,0x22,0xd4,0x22,0x22,0x00,0x1f,0x4b,0x02,0x31,
-0xa0,0x0b,0x90,0xa9,0x27,0x12,0x60,0xb6,0x27,0x11,0x8c,0xf1,0x27,0x5b,0x01,0x11,
-0x1d,0x41,0x11,0xdd,0x27,0x01,0x0d,0x00,0x02,0x07,0x30,0x11,0xe6,0xab,0x24,0x11,
-0xea,0x85,0x20,0x13,0x3b,0x06,0x00,0x11,0xfe,0xb9,0x1c,0x07,0x12,0x00,0x10,0x01,
-0x12,0x00,0x30,0xfb,0x03,0xb0,0x0c,0x00,0x20,0x07,0x70,0x06,0x00,0x10,0x0d,0xcd,
-0x36,0x10,0x4b,0xb1,0x03,0x13,0x8d,0x5d,0x47,0x10,0xce,0x0c,0x07,0x03,0x3f,0x0b,
-0xf8,0x06,0xad,0xdd,0xdd,0x80,0x0b,0x0d,0x00,0xd0,0x2a,0x1c,0xe1,0xd0,0x0d,0x02,
-0xa1,0xee,0x1d,0xcc,0xfc,0xda,0x1e,0x0b,0x00,0x01,0x26,0x24,0x01,0x6f,0x23,0x11,
-0x11,0x6f,0x23,0x00,0x6d,0x4d,0x80,0x57,0x70,0x00,0x3c,0xcc,0xcf,0x97,0x72,0xf6,
-0x21,0xf0,0x1a,0xf0,0x1e,0x30,0x00,0x11,0x97,0x1f,0x19,0x81,0x10,0x2c,0xcc,0xdf,
-0xff,0xdc,0xcc,0x20,0x00,0x6c,0x2f,0x3c,0x60,0x00,0x16,0xc8,0x00,0xd0,0x07,0xc7,
-0x11,0x7a,0xdc,0xcf,0xcc,0xdc,0x60,0x00,0x95,0x00,0xe0,0x04,0x9b,0x0c,0x44,0xaf,
-0xaa,0xcb,0x00,0x0d,0x00,0x41,0xdc,0xcc,0xcc,0xda,0xbb,0x4d,0xf0,0x1a,0x01,0x10,
-0x00,0x8d,0xdd,0xe2,0xd2,0xc4,0x00,0x04,0x40,0xa7,0x07,0xe2,0x3a,0x00,0x0a,0xbc,
-0x00,0x0b,0xab,0x10,0x00,0x9b,0xbc,0xcc,0xab,0xb2,0x03,0xd9,0x22,0x22,0x22,0x28,
-0xe4,0x12,0x4e,0xaa,0xaa,0xaf,0x12,0xb4,0x05,0x00,0x70,0x01,0x50,0x3d,0xdc,0xcc,
-0xdd,0x10,0x47,0x0c,0x11,0x0b,0x05,0x53,0xf0,0x1f,0x03,0xc0,0x00,0x02,0xdd,0xde,
-0xdd,0xee,0xdd,0xd2,0x00,0x05,0x40,0x00,0x36,0x00,0x00,0x12,0x5e,0x22,0x2d,0x62,
-0x10,0x04,0x99,0x9d,0xc9,0x99,0x95,0x00,0x08,0x88,0xdb,0x88,0x88,0x00,0x00,0x22,
-0x7b,0x22,0x22,0x20,0x01,0xcc,0xdf,0xcc,0xe1,0x19,0xf5,0x16,0x0a,0xd7,0x77,0x77,
-0x60,0x00,0x08,0xf9,0x33,0x33,0x5e,0x00,0x09,0xb8,0xc9,0x99,0x9a,0xe0,0x04,0xa0,
-0x7c,0x88,0x88,0x9e,0x00,0x00,0x07,0x82,0x22,0x23,0xe0,0x00,0x00,0x7d,0xbb,0xbb,
-0xbd,0x98,0x54,0x10,0x22,0x6f,0x02,0x30,0x3b,0xeb,0xb9,0x48,0x23,0xf0,0x14,0x0e,
-0x00,0xc1,0xc7,0x40,0xe0,0x02,0xc0,0x05,0x5c,0x1d,0x05,0x00,0x6b,0x32,0x2e,0xec,
-0xfd,0xb0,0x0c,0xc9,0xde,0xf0,0x0e,0x00,0x03,0xf7,0x1c,0x2e,0xbb,0xfb,0x80,0x5a,
-0x71,0xc0,0x17,0x34,0x81,0x57,0x1c,0x0e,0xbb,0xfb,0x80,0x05,0xec,0x0d,0x00,0xc8,
-0x58,0x11,0x0e,0x99,0xf9,0x92,0x00,0x10,0x00,0xe3,0x33,0x33,0xd8,0x4a,0x05,0x2d,
-0x05,0x05,0xb0,0x26,0x01,0xc0,0x3e,0x40,0x80,0x0f,0x00,0x80,0x8c,0x21,0xb0,0xf0,
-0x0a,0x80,0x00,0x1e,0x10,0x0f,0x00,0x1e,0x20,0x0d,0xb5,0x2b,0x30,0x7a,0x02,0x80,
-0xd5,0x4c,0x51,0xa0,0x00,0x01,0xff,0xb0,0x3c,0x05,0x10,0x94,0x1a,0x02,0xf1,0x20,
-0xbe,0xf6,0x10,0x0c,0x20,0x00,0x01,0x0e,0x00,0x42,0xc2,0x81,0x00,0x00,0xf0,0x0a,
-0x3c,0x27,0x80,0x2e,0xef,0xea,0xc0,0xc2,0x1e,0x00,0x06,0xf4,0x1b,0x0c,0x20,0xa3,
-0x00,0xcf,0xb5,0x40,0xc2,0x24,0x00,0x86,0xe2,0x40,0x0c,0x2a,0x60,0x2d,0x0e,0x5c,
-0x28,0x21,0x20,0xe0,0xda,0x45,0x40,0x0e,0x01,0x6d,0xb1,0xf2,0x04,0x20,0xca,0x40,
-0x84,0x00,0x10,0x71,0x01,0x31,0x30,0x9d,0xe7,0x12,0xd1,0x41,0xf0,0x24,0x1c,0x00,
+0x38,0x7c,0x1c,0x00,0x0d,0x00,0x0b,0xc3,0x10,0x10,0x00,0xd2,0xaa,0xaa,0xaa,0xaa,
+0x30,0x0d,0x02,0x22,0xa0,0x09,0x03,0x4e,0x00,0xf4,0x37,0x0c,0xcc,0xb9,0xcf,0xc3,
+0x03,0xe3,0xc0,0x0b,0x44,0xc0,0x03,0xcf,0xcd,0xbb,0xb7,0x4b,0x00,0x01,0xf2,0xc0,
+0x0b,0xa3,0xa0,0x00,0x5f,0xac,0xbb,0xbe,0xde,0xc6,0x09,0xe9,0xd1,0x11,0x08,0x50,
+0x00,0xbd,0x0c,0x07,0x30,0xdb,0x00,0x57,0xd0,0xc0,0x6a,0x2d,0xb0,0x03,0x1d,0x0d,
+0xca,0xb9,0x6b,0x03,0x00,0xd0,0xb3,0x02,0xc1,0xb0,0x80,0x0d,0x00,0x00,0xb2,0x0d,
+0xc5,0xf8,0x00,0xf3,0x40,0x66,0x00,0x1c,0x01,0xc0,0x00,0x06,0x60,0x8b,0xfb,0xcf,
+0xb4,0x00,0x66,0x01,0x4d,0x24,0xd2,0x03,0xef,0xfd,0x49,0xe8,0x9e,0x81,0x00,0xb7,
+0x08,0x9e,0x89,0xe8,0x50,0x1f,0xd1,0x33,0x3b,0x63,0x32,0x06,0xdb,0x95,0xeb,0xec,
+0xbf,0x00,0xc7,0x66,0x5c,0x6c,0x96,0xe0,0x58,0x66,0x05,0xb3,0xb6,0x3e,0x01,0x16,
+0x64,0xde,0xcd,0xcc,0xf9,0x00,0x66,0x05,0x90,0x00,0x0e,0x00,0x06,0x60,0x59,0x00,
+0x4c,0xb0,0x00,0x67,0xa7,0x01,0xf7,0x83,0xcc,0xfc,0xfd,0xc4,0x00,0x67,0x04,0x6e,
+0x6d,0x76,0x03,0xef,0xfd,0x95,0xc3,0xc3,0xe0,0x00,0xb7,0x09,0x3b,0x0b,0x0d,0x00,
+0x0f,0xd0,0x6b,0xbb,0xbb,0xb0,0x05,0xdb,0x92,0x99,0x99,0x96,0x00,0xc7,0x76,0x01,
+0x11,0x11,0x10,0x49,0x67,0x0c,0xcc,0xfc,0xcc,0x41,0x16,0x70,0x1a,0x0d,0x19,0x20,
+0x00,0x67,0x2c,0x40,0xd1,0x3d,0x10,0x06,0x71,0x32,0xcd,0x00,0x41,0x00,0xc0,0x04,
+0x28,0x30,0x60,0x00,0x0c,0x00,0xa0,0x84,0x65,0x10,0x02,0xd2,0x46,0x88,0x6c,0x68,
+0x03,0xcf,0xbb,0xc7,0x78,0x9d,0x00,0x03,0xf0,0x09,0x76,0x77,0x59,0x00,0x7f,0x79,
+0xcb,0x9a,0xda,0xb0,0x0a,0xca,0x1a,0x03,0xb2,0xb1,0x02,0x9c,0x09,0xfc,0xcf,0xcc,
+0xc0,0x73,0xc0,0x0f,0x50,0xa3,0xb3,0x00,0x0c,0x04,0x9b,0x65,0xe6,0x00,0x00,0xc0,
+0xc2,0x04,0xbe,0x36,0x50,0x0c,0x74,0x04,0xa2,0x2c,0x05,0x07,0x12,0x96,0xfa,0x0b,
+0x00,0xf2,0x06,0x11,0x21,0x0d,0x00,0x21,0x0a,0x40,0x0d,0x00,0x50,0xa4,0x00,0x9d,
+0xbb,0xb8,0x0d,0x00,0x5a,0x83,0x33,0x20,0x00,0xa4,0x1a,0x00,0x06,0x0d,0x00,0x71,
+0x6c,0xfd,0xcc,0xee,0xcc,0xcc,0x11,0x01,0x00,0x30,0x10,0x08,0xee,0x01,0x00,0x04,
+0x4e,0x00,0x02,0x5b,0x00,0x21,0x04,0x80,0x0d,0x00,0xe1,0x59,0x00,0x9d,0xbb,0xb4,
+0x00,0x05,0x90,0x09,0x83,0x33,0x10,0x00,0x59,0x1a,0x00,0x23,0x05,0x90,0x1a,0x00,
+0x00,0x0d,0x00,0x80,0xbd,0xeb,0xbe,0xdb,0xbb,0xb5,0x03,0x33,0x01,0x00,0x10,0x10,
+0xf5,0x08,0xfa,0x3c,0xd2,0x40,0x01,0xde,0xed,0xc0,0x0d,0x2b,0x80,0x00,0x94,0x00,
+0x02,0xe5,0x79,0x10,0x0e,0xdd,0x6c,0xaf,0x63,0x10,0x02,0xa0,0x94,0x00,0xe0,0x14,
+0x30,0xa4,0x0d,0x24,0x7e,0xed,0xa4,0x2d,0x96,0xd4,0xa6,0xb4,0x05,0x30,0x11,0xc8,
+0x00,0x07,0x74,0xe1,0x00,0x0d,0x20,0x00,0x3d,0xd3,0x00,0x06,0x90,0x00,0x19,0xf3,
+0x02,0x05,0xe1,0x02,0x8d,0x68,0xa1,0xa0,0xc2,0x00,0x86,0x00,0x0a,0xe5,0x00,0x01,
+0x00,0x12,0x7a,0x58,0x05,0x70,0xec,0xcc,0xcc,0xcc,0x00,0x0c,0x71,0xb7,0x00,0xc0,
+0x0a,0x98,0xcc,0xcc,0xcc,0xc0,0x00,0x20,0xd3,0x18,0x71,0x1e,0x04,0x04,0xf1,0x0e,
+0x95,0x01,0xd0,0x02,0xee,0xfe,0xef,0xee,0xef,0xe9,0x00,0x4a,0x00,0xc1,0x03,0xb0,
+0x00,0x07,0x80,0x0e,0x00,0x59,0x00,0x00,0xae,0xdd,0xfd,0xde,0xfd,0x49,0x06,0x11,
+0xb4,0x4c,0x0d,0x17,0xcc,0x56,0x00,0x11,0x10,0x4e,0x08,0x18,0xe1,0x06,0x00,0x20,
+0x01,0x50,0x06,0x00,0x70,0x1d,0xb0,0x1f,0xff,0xf1,0xe6,0xe8,0x12,0x00,0x2d,0xec,
+0x30,0x24,0x00,0xfa,0x05,0x00,0x93,0x1e,0x00,0x30,0xe1,0x00,0xb3,0x2f,0x8e,0xd1,
+0xe2,0x00,0xd1,0x6e,0x82,0x00,0x8f,0xee,0x90,0xaf,0x00,0x11,0xc4,0x06,0x00,0x80,
+0x3f,0xba,0xaa,0xaa,0xaa,0x10,0x0b,0x82,0xfa,0x02,0x81,0x08,0xd7,0xcc,0xcc,0xcc,
+0xb0,0x03,0xe2,0x19,0x00,0x60,0x03,0xdd,0xdd,0xdd,0xdd,0x50,0x68,0x01,0x70,0x70,
+0x96,0x00,0x00,0x7d,0x41,0xd2,0xea,0x0c,0xf0,0x10,0x3c,0xe7,0x00,0x78,0x00,0x00,
+0x02,0xdb,0xe3,0x04,0xa1,0x40,0x07,0xe4,0x05,0xe3,0x1e,0x48,0x0c,0x91,0x00,0x03,
+0x00,0x7e,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0x5b,0x06,0x70,0x00,0x00,0xe0,
+0x00,0x00,0x2b,0xc0,0x60,0x0e,0x00,0x00,0x00,0x04,0x0d,0x10,0xe0,0x15,0x00,0x00,
+0x00,0xd1,0x0f,0xae,0xd0,0x3c,0x40,0x0d,0x8e,0xf5,0x1d,0x00,0x3c,0x5b,0xf8,0x2e,
+0x01,0xd0,0x00,0x01,0x4e,0x10,0xe0,0x1d,0x00,0x00,0x70,0xd1,0x0e,0x04,0xb0,0x00,
+0x5b,0x0d,0x10,0xe6,0xc4,0x00,0x0d,0x20,0xd1,0x00,0x00,0x74,0x08,0xa0,0x0d,0x20,
+0x00,0x0a,0x40,0xa1,0x00,0x7e,0xee,0xee,0xc0,0x06,0x81,0x00,0x04,0xa0,0x00,0x00,
+0x07,0xd0,0x00,0x4a,0x00,0x00,0x00,0x00,0x0d,0xde,0xfd,0xd7,0x00,0x20,0x00,0x00,
+0x5b,0x00,0x00,0x3e,0x80,0x1a,0x00,0xf2,0x1f,0x1b,0x31,0x22,0x6b,0x22,0x20,0x00,
+0x00,0x7b,0xbf,0xdb,0xbb,0x00,0x00,0x70,0x02,0xe1,0x00,0x00,0x00,0x4c,0x00,0xa7,
+0x09,0x20,0x00,0x0c,0x40,0x3d,0x00,0x3c,0x00,0x07,0xb0,0x1d,0xa9,0xac,0xf7,0x00,
+0xb2,0x01,0xa7,0x52,0x01,0xd0,0x00,0x01,0x00,0x21,0x04,0x90,0xa3,0x00,0x30,0x08,
+0xd1,0x00,0xa3,0x00,0xf0,0x56,0x03,0x2f,0xee,0xfe,0xef,0x70,0x10,0x02,0xc0,0x0e,
+0x00,0xd1,0x0c,0xa1,0x2c,0x00,0xe0,0x17,0x00,0x06,0x33,0xfd,0xef,0xde,0x70,0x00,
+0x00,0x4a,0xa3,0x00,0xb4,0x00,0x01,0x95,0x83,0xc0,0x3d,0x00,0x00,0x78,0x76,0x09,
+0x9d,0x30,0x00,0x1e,0x1b,0x30,0x2f,0xc0,0x00,0x08,0x92,0xd1,0x7e,0x69,0xd5,0x00,
+0x71,0x65,0xa9,0x10,0x04,0xb6,0x07,0x50,0x14,0x01,0xd0,0x05,0x10,0x2c,0x91,0xe1,
+0x1d,0x03,0xe0,0x00,0x04,0x08,0x81,0xd0,0xb7,0x00,0x00,0x00,0x12,0x1d,0x04,0x00,
+0x2d,0x50,0x0f,0xee,0xee,0xed,0x00,0x1b,0x20,0xe0,0x00,0x7c,0x00,0x71,0x0f,0xdd,
+0xdd,0xdd,0x00,0x01,0x80,0x0d,0x00,0x11,0x96,0x0d,0x00,0x20,0x1e,0x00,0x0d,0x00,
+0xd3,0x0a,0x70,0x0e,0x00,0x00,0x2d,0x00,0x90,0x00,0xe0,0x00,0xdd,0x80,0xa3,0x00,
+0xf2,0x3f,0x98,0x00,0x00,0x01,0xb9,0x50,0x00,0xa9,0x00,0x00,0x0c,0x0b,0x10,0x00,
+0x0d,0xdd,0xdd,0xfd,0xd3,0x01,0x00,0xd0,0x00,0x0c,0x00,0x03,0xe8,0x0d,0x6c,0xc8,
+0xc0,0x90,0x01,0x90,0xd0,0x00,0x0c,0x2b,0x00,0x00,0x0d,0x6d,0xca,0xa9,0x60,0x00,
+0x94,0xb6,0x40,0xa8,0xe0,0x00,0x1e,0x3a,0x6b,0xaa,0x89,0x01,0x07,0x86,0x76,0x61,
+0x4e,0xb2,0x80,0xe2,0xc2,0x11,0x4d,0x2d,0x76,0x17,0x1a,0x00,0x0a,0x20,0x5e,0x10,
+0x54,0x00,0x12,0x02,0x07,0x00,0x91,0x7e,0x65,0xed,0xdd,0xde,0x00,0x00,0x15,0x59,
+0x05,0x01,0x80,0x05,0xec,0xcc,0xce,0x00,0x6a,0x20,0x58,0x0d,0x00,0x73,0x4d,0x04,
+0xcc,0xcc,0xcc,0x00,0x00,0x2e,0x00,0xf0,0x05,0x5b,0xde,0xde,0xde,0x50,0x00,0xa5,
+0xb1,0x91,0x92,0x85,0x00,0x2d,0x0b,0x19,0x19,0x28,0x50,0x0b,0x60,0x0d,0x00,0x74,
+0x02,0xc0,0xbf,0xdf,0xef,0xef,0xe3,0x4c,0x01,0x02,0x07,0x00,0xf0,0x14,0x8d,0x4c,
+0xee,0xee,0xee,0xe1,0x00,0x22,0xc2,0x00,0xc0,0x00,0x00,0x00,0x0c,0x2d,0xcd,0xbb,
+0xb0,0x5d,0x40,0xd2,0xd0,0x00,0x1c,0x00,0x29,0x0e,0x0f,0xbb,0xbb,0xc0,0x00,0x00,
+0xe0,0x0d,0x00,0xf1,0x53,0x06,0x1e,0x0b,0xbf,0xbb,0x90,0x00,0xe4,0xc0,0x60,0xe0,
+0x52,0x00,0x79,0x77,0x5c,0x0e,0x04,0xa0,0x1e,0x2d,0x3e,0x30,0xe0,0x0a,0x12,0x72,
+0x80,0x01,0xdc,0x00,0x00,0x01,0xa3,0x06,0x72,0x70,0x00,0x00,0x03,0xb2,0xf9,0x8f,
+0x87,0x50,0x07,0x21,0xdc,0x44,0xe4,0x43,0x00,0x5c,0x7a,0xea,0xaf,0xaa,0x30,0x00,
+0x04,0x3c,0x33,0xe3,0x31,0x00,0x06,0xb3,0xd5,0x5f,0x55,0x20,0x06,0xc0,0x3e,0xbb,
+0xfb,0xba,0x00,0x51,0x03,0xa6,0x11,0x11,0x10,0x03,0x33,0x33,0xe3,0x33,0x33,0x10,
+0xaa,0xaa,0xaf,0xba,0xaa,0xa5,0x00,0xd5,0x00,0x21,0x00,0x00,0xda,0x01,0x03,0x01,
+0x00,0x30,0x68,0x00,0x00,0x16,0x02,0x61,0x89,0xcc,0xcf,0xdc,0xcc,0x30,0x19,0x00,
+0xf0,0x15,0xa4,0x02,0x00,0x4d,0xdd,0xdd,0xd6,0x13,0xe8,0x00,0x00,0xb3,0x00,0x00,
+0x01,0x50,0x7c,0xcf,0xcc,0xca,0x00,0x00,0x08,0x40,0xb2,0x02,0xb0,0x00,0x55,0x8c,
+0xbe,0xcb,0xcb,0x00,0x0c,0x38,0x0d,0x00,0xf2,0x05,0x03,0xd0,0x6b,0xcb,0xbc,0xb8,
+0x00,0xb6,0x01,0x99,0x00,0xc9,0x10,0x0a,0x04,0xd6,0x00,0x00,0x5d,0x20,0x54,0x00,
+0x50,0x06,0x70,0x00,0x05,0x90,0xe6,0x02,0xf4,0x36,0xfa,0xcd,0xad,0x50,0x00,0x03,
+0x0e,0x58,0xb5,0xa5,0x00,0x10,0x00,0x55,0x8b,0x55,0x10,0x3d,0x92,0xcc,0xcc,0xcc,
+0xcc,0x50,0x07,0x11,0xa8,0x88,0x89,0x50,0x00,0x00,0x1e,0x88,0x88,0xb8,0x00,0x02,
+0xb1,0xd3,0x33,0x38,0x80,0x00,0x96,0x1e,0x77,0x77,0xb8,0x00,0x2e,0x01,0xda,0x99,
+0xab,0x70,0x0b,0x60,0x06,0xd3,0x0a,0x92,0x00,0x80,0x2c,0x71,0x00,0x04,0xc2,0xaa,
+0x00,0x21,0x07,0x10,0x5c,0x00,0xf0,0x1f,0xd2,0x22,0x22,0x22,0x20,0x03,0xed,0xbe,
+0xbf,0xbd,0xd9,0x02,0xeb,0x62,0xa0,0xc0,0x77,0x00,0x03,0x87,0x3b,0x1d,0x18,0x81,
+0x00,0xad,0xdc,0xec,0xfc,0xdd,0xa0,0x00,0x76,0x2a,0x0c,0x07,0x70,0x00,0x07,0x72,
+0xb0,0xd0,0x77,0x00,0x2d,0xdd,0x01,0x00,0xf0,0x06,0x20,0x07,0x02,0x20,0x40,0x08,
+0x00,0x05,0xb0,0x68,0x09,0x60,0x98,0x01,0xe2,0x04,0xa0,0x4b,0x00,0xe2,0x01,0x4c,
+0x00,0xf0,0x01,0x01,0x00,0x00,0x0d,0x10,0x03,0xb0,0x40,0x00,0x00,0xd1,0x00,0x3b,
+0x0d,0x30,0x3d,0x0d,0x00,0xf5,0x2d,0x3c,0x00,0x88,0xd1,0x00,0x3b,0x00,0x10,0x00,
+0x7d,0x8f,0xff,0xff,0xff,0x60,0x00,0xd1,0x00,0x6f,0x00,0x00,0x00,0x5f,0x10,0x09,
+0xe4,0x00,0x00,0x7c,0xe1,0x00,0xe5,0xa0,0x00,0x6b,0x0d,0x10,0x6b,0x0b,0x20,0x01,
+0x00,0xd1,0x1e,0x30,0x4c,0x00,0x00,0x0d,0x2d,0x70,0x00,0x9b,0x10,0x00,0xd9,0x80,
+0x00,0x00,0x96,0x55,0x01,0xf1,0x2d,0x0d,0x30,0x00,0x00,0x0b,0xee,0xee,0xff,0xee,
+0xee,0x50,0x22,0x00,0x78,0x06,0x02,0x30,0x02,0xd6,0x5e,0x8c,0x63,0xd3,0x00,0x00,
+0x54,0x6d,0x80,0x51,0x00,0x00,0x29,0x39,0x75,0x99,0x60,0x00,0x9c,0x4b,0xfd,0xce,
+0x5a,0xa0,0x02,0x00,0x21,0x92,0x11,0x04,0x01,0xdd,0xdd,0xdf,0xed,0xdd,0xd6,0x00,
+0x00,0x00,0xc4,0x41,0x00,0x21,0x0c,0x30,0x07,0x00,0x12,0xc3,0x4f,0x00,0xf5,0x14,
+0x11,0x11,0x11,0x04,0xdf,0xed,0x6e,0xbb,0xbc,0xc0,0x00,0x86,0x04,0x90,0x00,0x2c,
+0x00,0x08,0x60,0x4e,0xcc,0xcc,0xc0,0x16,0xba,0x64,0x90,0x00,0x2c,0x01,0x7b,0xa7,
+0x4e,0xcc,0xcd,0x1a,0x00,0xf3,0x10,0x61,0x4d,0xfc,0xfc,0xa0,0x03,0xbe,0xd2,0x4a,
+0x0e,0x00,0x06,0xc7,0x20,0x09,0x60,0xe0,0x11,0x00,0x00,0x07,0xc0,0x0e,0x04,0x80,
+0x00,0x0d,0xa1,0x00,0xad,0xe4,0xa1,0x00,0xf0,0x07,0x2e,0xff,0xc8,0xed,0xfd,0xdf,
+0x00,0x08,0x60,0x84,0x0d,0x00,0xe0,0x00,0x86,0x08,0xdc,0xfc,0xcf,0x00,0x29,0x71,
+0x0d,0x00,0xf1,0x00,0x0d,0xee,0x98,0x61,0xd1,0x1e,0x00,0x08,0x60,0x5b,0xbf,0xbb,
+0xb0,0x00,0x86,0x1e,0x02,0xf0,0x02,0x08,0x86,0x9e,0xef,0xee,0xe2,0x06,0xdf,0x90,
+0x00,0xe1,0x00,0x02,0xd6,0x10,0x00,0x0e,0x8a,0x01,0x90,0x8e,0xee,0xfe,0xee,0x80,
+0x00,0x09,0x10,0xc2,0x0f,0x03,0x20,0xf0,0x0c,0xfb,0x01,0x70,0x8b,0x22,0xd4,0x22,
+0x22,0x00,0x1f,0x4b,0x02,0x40,0xa0,0x0b,0x90,0x00,0x1a,0x00,0x21,0x60,0x00,0x1a,
+0x00,0xb0,0x8c,0xcc,0xfd,0xcc,0xc4,0x00,0x01,0x11,0x1d,0x41,0x11,0x7f,0x00,0x02,
+0xd4,0x01,0x01,0x1a,0x00,0x01,0x0d,0x00,0xf3,0x04,0x01,0xee,0xee,0xef,0xee,0xee,
+0xe6,0x00,0xee,0xee,0xfe,0xee,0xea,0x00,0xf0,0x00,0xe0,0x00,0x3b,0x06,0x00,0x58,
+0xfe,0xee,0xfe,0xee,0xeb,0x12,0x00,0x10,0x01,0x12,0x00,0x30,0xfb,0x03,0xb0,0x0c,
+0x00,0x20,0x07,0x70,0x06,0x00,0x60,0x0d,0x20,0x00,0xe0,0x00,0x4b,0xb1,0x03,0x22,
+0x8d,0xe7,0xde,0x00,0x62,0xce,0xee,0xee,0xee,0xee,0xc0,0x0c,0x00,0xf8,0x06,0xad,
+0xdd,0xdd,0x80,0x0b,0x0d,0x00,0xd0,0x2a,0x1c,0xe1,0xd0,0x0d,0x02,0xa1,0xee,0x1d,
+0xcc,0xfc,0xda,0x1e,0x0b,0x00,0x10,0x00,0x7f,0x00,0x00,0x96,0x02,0x60,0xce,0x11,
+0x11,0x11,0x11,0x13,0x21,0x03,0xf4,0x2f,0x13,0x57,0x70,0x00,0x3c,0xcc,0xcf,0x97,
+0x72,0x00,0x00,0x1c,0x00,0xf0,0x1e,0x30,0x00,0x11,0x97,0x1f,0x19,0x81,0x10,0x2c,
+0xcc,0xdf,0xff,0xdc,0xcc,0x20,0x00,0x6c,0x2f,0x3c,0x60,0x00,0x16,0xc8,0x00,0xd0,
+0x07,0xc7,0x11,0x7a,0xdc,0xcf,0xcc,0xdc,0x60,0x00,0x95,0x00,0xe0,0x04,0xb0,0x00,
+0x09,0xca,0xaf,0xaa,0xcb,0x00,0x0d,0x00,0x50,0xdc,0xcc,0xcc,0xda,0x00,0x4e,0x00,
+0xf0,0x1a,0x01,0x10,0x00,0x8d,0xdd,0xe2,0xd2,0xc4,0x00,0x04,0x40,0xa7,0x07,0xe2,
+0x3a,0x00,0x0a,0xbc,0x00,0x0b,0xab,0x10,0x00,0x9b,0xbc,0xcc,0xab,0xb2,0x03,0xd9,
+0x22,0x22,0x22,0x28,0xe4,0x12,0x4e,0xaa,0xaa,0xaf,0x12,0xb4,0x05,0x00,0x70,0x01,
+0xa0,0x3d,0xdc,0xcc,0xdd,0x10,0x00,0x00,0x2b,0x00,0x0b,0x22,0x01,0xf4,0x49,0xe1,
+0x03,0xc0,0x00,0x02,0xdd,0xde,0xdd,0xee,0xdd,0xd2,0x00,0x05,0x40,0x00,0x36,0x00,
+0x00,0x12,0x5e,0x22,0x2d,0x62,0x10,0x04,0x99,0x9d,0xc9,0x99,0x95,0x00,0x08,0x88,
+0xdb,0x88,0x88,0x00,0x00,0x22,0x7b,0x22,0x22,0x20,0x01,0xcc,0xdf,0xcc,0xcc,0xcc,
+0xc1,0x00,0x0a,0xd7,0x77,0x77,0x60,0x00,0x08,0xf9,0x33,0x33,0x5e,0x00,0x09,0xb8,
+0xc9,0x99,0x9a,0xe0,0x04,0xa0,0x7c,0x88,0x88,0x9e,0x00,0x00,0x07,0x82,0x22,0x23,
+0xe0,0x00,0x00,0x7d,0xbb,0xbb,0xbd,0xad,0x02,0x20,0x22,0x22,0x6f,0x02,0xf1,0x27,
+0x3b,0xeb,0xb9,0xcc,0xfc,0xcc,0x00,0x0e,0x00,0xc1,0xc7,0x40,0xe0,0x02,0xc0,0x05,
+0x5c,0x1d,0x05,0x00,0x6b,0x32,0x2e,0xec,0xfd,0xb0,0x0c,0xc9,0xde,0xf0,0x0e,0x00,
+0x03,0xf7,0x1c,0x2e,0xbb,0xfb,0x80,0x5a,0x71,0xc0,0xe0,0x0e,0x00,0x00,0x57,0x1c,
+0x0e,0xbb,0xfb,0x80,0x05,0xec,0x0d,0x00,0xf8,0x05,0x58,0x11,0x0e,0x99,0xf9,0x92,
+0x00,0x10,0x00,0xe3,0x33,0x33,0x00,0x00,0xff,0xff,0xff,0xff,0xf0,0x00,0x01,0x00,
+0x20,0x02,0xee,0x01,0x00,0x50,0xe2,0x00,0x00,0x00,0xf0,0x6d,0x01,0xf1,0x14,0x80,
+0x0f,0x00,0x80,0x00,0x00,0x89,0x00,0xf0,0x0a,0x80,0x00,0x1e,0x10,0x0f,0x00,0x1e,
+0x20,0x0d,0x60,0x00,0xf0,0x00,0x7a,0x02,0x80,0x00,0x0f,0x00,0x01,0xa0,0x00,0x01,
+0xff,0xb0,0x3c,0x05,0x10,0x94,0x1a,0x02,0xf0,0x30,0xbe,0xf6,0x10,0x0c,0x20,0x00,
+0x01,0x0e,0x00,0x42,0xc2,0x81,0x00,0x00,0xf0,0x0a,0x3c,0x27,0x80,0x2e,0xef,0xea,
+0xc0,0xc2,0x1e,0x00,0x06,0xf4,0x1b,0x0c,0x20,0xa3,0x00,0xcf,0xb5,0x40,0xc2,0x24,
+0x00,0x86,0xe2,0x40,0x0c,0x2a,0x60,0x2d,0x0e,0x00,0x00,0x05,0xd0,0x00,0x20,0xe0,
+0x00,0x06,0xe2,0x00,0x00,0x0e,0x01,0x6d,0xb1,0xf2,0x04,0x20,0xca,0x40,0x84,0x00,
+0xf0,0x32,0x71,0x08,0x10,0x00,0x00,0x9d,0xe7,0x12,0xe0,0x00,0x00,0x01,0x1c,0x00,
 0x6f,0xef,0xef,0x90,0x01,0xc0,0x0d,0x31,0xd0,0xb3,0x1e,0xef,0xed,0xa0,0x1d,0x06,
 0x00,0x07,0xe1,0x23,0x71,0xd3,0x60,0x00,0xce,0xb0,0x69,0x1d,0x1d,0x00,0x67,0xc5,
 0x3b,0x41,0xd0,0xb3,0x2c,0x1c,0x03,0xd0,0x1d,0x07,0x70,0x31,0xc0,0x65,0x01,0xd0,
-0x36,0x69,0x18,0x11,0x2d,0xbd,0x13,0x15,0x9e,0x04,0x23,0x20,0x15,0xaa,0xf0,0x21,
-0xf0,0x0f,0x1b,0xca,0x00,0x2e,0xed,0xd6,0x00,0x06,0x80,0x6d,0x30,0x2d,0x10,0x00,
-0x68,0x07,0x3d,0x4c,0x40,0x04,0xef,0xfe,0x10,0x8d,0x30,0x00,0x00,0xdc,0x09,0xc6,
-0x8c,0x07,0xf0,0x0e,0xb9,0x00,0x4e,0xdd,0xf3,0x0b,0x88,0x61,0xab,0x10,0x5c,0x04,
-0xa6,0x80,0x76,0x6a,0x3e,0x30,0x21,0x68,0x00,0x00,0xaf,0x40,0x00,0x06,0x80,0x04,
-0xbb,0xeb,0x0b,0x27,0x1d,0x94,0x2e,0x01,0x10,0x37,0x38,0x45,0x50,0x12,0xf3,0x11,
-0x11,0xfc,0x95,0x02,0xfc,0x0d,0xfe,0x00,0x21,0x01,0x20,0x0f,0xc0,0x7d,0x30,0x3b,
-0xa2,0x76,0xe8,0x00,0x00,0x03,0xb7,0x28,0xaa,0xaa,0xaa,0xa7,0x00,0x12,0x23,0xf2,
-0x22,0x20,0xdd,0x39,0x11,0x0d,0xce,0x0d,0x09,0xf9,0x1f,0xf0,0x11,0x0b,0xbb,0xbb,
-0xfc,0xbb,0xba,0x00,0xf2,0x25,0x42,0x34,0x23,0xe0,0x0b,0x05,0xd2,0x03,0xd7,0x09,
-0x00,0x2b,0xb1,0x02,0x01,0xac,0x10,0x01,0x50,0x00,0xf1,0xc1,0x50,0xa1,0x0d,0x20,
-0x04,0x90,0xaf,0x2d,0x11,0xfe,0xb3,0x22,0x11,0xd9,0x7a,0x0d,0x10,0x9a,0xe9,0x61,
-0x80,0x04,0xcb,0x00,0x0b,0xb4,0x00,0x0d,0xb5,0x08,0x31,0x04,0x7f,0x1d,0x00,0xe7,
-0x52,0x00,0x63,0x0a,0xf1,0x04,0x94,0x0f,0x00,0xe0,0x16,0x89,0x69,0x40,0xf0,0x0e,
-0x02,0x77,0x77,0x8d,0xdd,0xdd,0xd0,0x09,0x04,0x16,0x01,0x90,0xb1,0x68,0xdd,0xdf,
-0xdd,0xd5,0x09,0x38,0x40,0x4b,0x19,0xf0,0x09,0x75,0xa1,0xbd,0xfd,0xfd,0xf1,0x05,
-0x5b,0x0b,0x1c,0x0c,0x0c,0x11,0x6a,0xfd,0xc1,0xc0,0xc0,0xc1,0x39,0x51,0x0b,0x1c,
-0x0c,0x61,0x3f,0x46,0xb1,0xb0,0xa6,0xd0,0xbb,0x14,0x01,0x10,0x20,0xf0,0x04,0xcc,
-0xb7,0xdd,0xcb,0xb0,0x0b,0x45,0xa0,0x6a,0x0d,0x10,0x03,0x80,0x08,0x08,0x20,0x53,
-0x00,0x05,0x37,0x22,0x11,0xf1,0xaf,0x06,0x00,0x18,0x11,0x71,0xdd,0xfd,0xdd,0xd1,
-0x00,0x3c,0x00,0x39,0x09,0xfc,0x09,0xdd,0xdf,0xfd,0xdd,0xe7,0x00,0x00,0x0a,0x9e,
-0x00,0x0a,0x50,0x00,0x5c,0x50,0xe0,0x23,0xd2,0x00,0xb7,0x10,0x0e,0x06,0xa6,0xf9,
-0x2a,0x30,0x70,0x00,0x86,0xf3,0x3e,0xf0,0x07,0xdd,0x6e,0xdd,0xdd,0x10,0xb6,0x59,
-0x08,0x71,0xe0,0x00,0x17,0x00,0x81,0xc1,0x06,0x20,0x00,0x00,0x02,0xd9,0xc3,0x66,
-0x3d,0xe0,0xe4,0x02,0xda,0x30,0x00,0x8e,0xad,0xcc,0xcd,0x8e,0xc3,0x08,0x20,0x00,
-0xc5,0x48,0x20,0x01,0xfd,0xf6,0x24,0x21,0x00,0x1d,0xb2,0x17,0xc0,0x01,0xe2,0x22,
-0x22,0xc3,0x00,0x00,0x1f,0xaa,0xaa,0xad,0x30,0xc0,0x33,0xf1,0x21,0x0a,0x30,0x00,
-0x00,0x6e,0xec,0xc9,0xfd,0xec,0xc2,0x3d,0x18,0x51,0xd2,0x0c,0x10,0x00,0x1a,0xb9,
-0x9a,0x99,0xae,0x00,0x00,0xab,0x99,0x99,0x9a,0xe0,0x00,0x0a,0x73,0x33,0x33,0x4e,
-0x00,0x00,0xa9,0x66,0x66,0x67,0xe0,0x00,0x09,0xbc,0xaa,0xab,0xbc,0x72,0x07,0xc0,
-0xa4,0x00,0x02,0xcc,0xdf,0xcc,0xce,0xdc,0xc3,0x00,0x3d,0x50,0x3e,0x2a,0x21,0xab,
-0x30,0x4b,0x2a,0x03,0xab,0x22,0x10,0xa0,0x01,0x38,0xf1,0x11,0x09,0xdc,0xbb,0x2f,
-0xcc,0xba,0x4d,0x08,0x61,0xa5,0x1d,0x10,0x16,0x45,0x57,0xc4,0x46,0x42,0x0d,0x87,
-0x77,0x77,0x77,0xa9,0x0c,0x6b,0xbb,0xbb,0xbb,0x58,0x00,0x68,0xb3,0x07,0x44,0x6d,
-0xbb,0xbb,0xbe,0x2d,0x47,0x40,0x6e,0xcc,0xcc,0xcd,0x5f,0x16,0x00,0x12,0x11,0x71,
-0x6e,0xbb,0xbb,0xbc,0xb0,0x00,0x93,0x52,0x56,0xf0,0x24,0x4f,0xed,0xca,0xfd,0xdc,
-0xc6,0x1e,0x29,0x51,0xd2,0x1d,0x10,0x00,0x42,0x85,0x22,0x34,0x75,0x40,0x09,0x9d,
-0xb9,0x7b,0xa8,0x8f,0x00,0x7a,0xdb,0xa5,0xb3,0x00,0xe0,0x0b,0x4a,0x67,0x7b,0x30,
-0x0e,0x00,0xb7,0xb9,0xa7,0xb3,0x24,0xe0,0x0a,0xad,0xbc,0x7b,0x34,0x95,0xb1,0x04,
-0xf5,0x01,0xb3,0x00,0x24,0x2b,0xbd,0xcb,0xab,0x30,0x05,0x90,0x00,0x84,0x00,0x6e,
-0xdd,0xe3,0x0f,0x32,0x00,0xa5,0x05,0x90,0x0a,0x67,0xa5,0xbb,0xfc,0xbb,0x50,0xa7,
-0x7b,0x28,0x04,0xf0,0x22,0x08,0xaa,0x70,0xaa,0xeb,0xaa,0x11,0x69,0xa5,0x57,0x7e,
-0x87,0x75,0x28,0xdc,0x82,0x33,0x33,0x33,0x20,0x0e,0xe1,0x0e,0xbb,0xbb,0xe0,0x05,
-0xeb,0xb0,0xe5,0x55,0x5e,0x00,0xd8,0x77,0x0e,0x44,0x44,0xe0,0x3a,0x67,0x00,0xea,
-0xaa,0xae,0x00,0x16,0x70,0x0e,0x02,0x01,0x5a,0x67,0x00,0xe0,0x08,0xca,0xe4,0x24,
-0x10,0x5b,0x4d,0x20,0xf1,0x02,0xa0,0x00,0x45,0x55,0xe7,0x55,0x50,0x00,0x04,0x66,
-0x6e,0x76,0x66,0x00,0x0c,0xcc,0xcc,0x27,0x24,0xa0,0x07,0xb3,0x05,0x40,0x00,0x00,
-0x5f,0xeb,0xcd,0x92,0xa1,0x56,0xf3,0x0f,0xb7,0x10,0xb7,0x00,0x04,0xdf,0xeb,0xdc,
-0xba,0xba,0x00,0x11,0x55,0x09,0x53,0x70,0x30,0x02,0x9b,0x10,0x95,0x07,0xd4,0x00,
-0xa5,0x05,0xdd,0x20,0x02,0xa1,0x25,0x58,0x10,0xbd,0xcc,0x26,0x13,0xc0,0x0d,0x00,
-0x01,0xe6,0x26,0xf0,0x04,0xd1,0x0e,0x00,0x2c,0x50,0x20,0x0d,0x10,0x80,0x6b,0x20,
-0x7c,0x10,0x70,0x00,0x6c,0xae,0xe6,0x16,0x17,0x4e,0xf1,0x0f,0x70,0x01,0xb8,0x00,
+0x36,0x00,0x1c,0x86,0x06,0x64,0x00,0x01,0xc0,0x00,0x9e,0x80,0xd8,0x00,0xf0,0x15,
+0x15,0xaa,0x00,0x3d,0x00,0x00,0x1b,0xca,0x00,0x2e,0xed,0xd6,0x00,0x06,0x80,0x6d,
+0x30,0x2d,0x10,0x00,0x68,0x07,0x3d,0x4c,0x40,0x04,0xef,0xfe,0x10,0x8d,0x30,0x00,
+0x00,0xdc,0x09,0xc6,0x8c,0x07,0xf7,0x14,0xb9,0x00,0x4e,0xdd,0xf3,0x0b,0x88,0x61,
+0xab,0x10,0x5c,0x04,0xa6,0x80,0x76,0x6a,0x3e,0x30,0x21,0x68,0x00,0x00,0xaf,0x40,
+0x00,0x06,0x80,0x04,0xbb,0x20,0x00,0x00,0x68,0x1d,0x94,0x2e,0x01,0xa0,0x37,0x00,
+0x00,0x01,0x11,0x12,0xf3,0x11,0x11,0xfc,0x95,0x02,0xf0,0x0b,0xfe,0x00,0x21,0x01,
+0x20,0x0f,0xc0,0x7d,0x30,0x3b,0xa2,0x76,0xe8,0x00,0x00,0x03,0xb7,0x28,0xaa,0xaa,
+0xaa,0xa7,0x00,0x12,0x23,0xf2,0xd8,0x07,0x33,0x0f,0x00,0x00,0x56,0x01,0x00,0x0b,
+0x00,0x10,0x0d,0x3f,0x03,0x52,0xee,0x00,0x00,0x00,0x10,0xe4,0x03,0xf0,0x26,0x00,
+0x00,0x00,0x0b,0xbb,0xbb,0xfc,0xbb,0xba,0x00,0xf2,0x25,0x42,0x34,0x23,0xe0,0x0b,
+0x05,0xd2,0x03,0xd7,0x09,0x00,0x2b,0xb1,0x02,0x01,0xac,0x10,0x01,0x50,0x00,0xf1,
+0xc1,0x50,0x00,0x00,0x00,0x2d,0x04,0x90,0x00,0x3e,0xee,0xef,0xfe,0xee,0xee,0x30,
+0x00,0x00,0xd9,0xa0,0x3a,0x00,0xf3,0x03,0x9a,0x0b,0x70,0x00,0x00,0x04,0xcb,0x00,
+0x0b,0xb4,0x00,0x0d,0xb5,0x00,0x00,0x04,0xbe,0x20,0x9c,0x00,0x11,0x90,0x6d,0x00,
+0xf1,0x06,0x09,0x60,0x94,0x0f,0x00,0xe0,0x16,0x89,0x69,0x40,0xf0,0x0e,0x02,0x77,
+0x77,0x8d,0xdd,0xdd,0xd0,0x09,0x04,0x16,0x01,0xf0,0x13,0xb1,0x68,0xdd,0xdf,0xdd,
+0xd5,0x09,0x38,0x40,0x02,0xd0,0x00,0x00,0x75,0xa1,0xbd,0xfd,0xfd,0xf1,0x05,0x5b,
+0x0b,0x1c,0x0c,0x0c,0x11,0x6a,0xfd,0xc1,0xc0,0xc0,0xc1,0x39,0x51,0x0d,0x00,0x74,
+0x10,0x00,0x00,0xb1,0xb0,0xa6,0xd0,0xf1,0x00,0xf1,0x10,0x85,0x00,0x06,0x60,0x00,
+0x00,0x1f,0xcc,0xb7,0xdd,0xcb,0xb0,0x0b,0x45,0xa0,0x6a,0x0d,0x10,0x03,0x80,0x08,
+0x08,0x20,0x53,0x00,0x05,0xcc,0xcd,0xfc,0xcc,0xf1,0xaf,0x06,0xb1,0x0d,0x10,0x00,
+0xfd,0xdd,0xfd,0xdd,0xd1,0x00,0x3c,0x00,0x39,0x09,0xfa,0x0a,0xdd,0xdf,0xfd,0xdd,
+0xe7,0x00,0x00,0x0a,0x9e,0x00,0x0a,0x50,0x00,0x5c,0x50,0xe0,0x23,0xd2,0x00,0xb7,
+0x10,0x0e,0x06,0xa6,0x00,0x01,0x00,0x20,0x08,0x70,0xc2,0x04,0xf0,0x08,0x01,0xfe,
+0xdd,0x6e,0xdd,0xdd,0x10,0xb6,0x59,0x08,0x71,0xe0,0x00,0x17,0x00,0x81,0xc1,0x06,
+0x20,0x00,0x00,0x02,0xd9,0x5d,0x05,0xd0,0x18,0xe4,0x02,0xda,0x30,0x00,0x8e,0xad,
+0xcc,0xcd,0x8e,0xc3,0x08,0xe6,0x00,0xf1,0x40,0x05,0x00,0x01,0xfd,0xdd,0xdd,0xf3,
+0x00,0x00,0x1d,0x00,0x00,0x0b,0x30,0x00,0x01,0xe2,0x22,0x22,0xc3,0x00,0x00,0x1f,
+0xaa,0xaa,0xad,0x30,0x00,0x00,0xb1,0x00,0x0a,0x30,0x00,0x00,0x6e,0xec,0xc9,0xfd,
+0xec,0xc2,0x3d,0x18,0x51,0xd2,0x0c,0x10,0x00,0x1a,0xb9,0x9a,0x99,0xae,0x00,0x00,
+0xab,0x99,0x99,0x9a,0xe0,0x00,0x0a,0x73,0x33,0x33,0x4e,0x00,0x00,0xa9,0x66,0x66,
+0x67,0xe0,0x00,0x09,0xbc,0xaa,0xab,0xbc,0x72,0x07,0xf4,0x06,0xa4,0x00,0x02,0xcc,
+0xdf,0xcc,0xce,0xdc,0xc3,0x00,0x3d,0x50,0x00,0xa4,0x00,0x00,0xab,0x30,0x00,0x0a,
+0x40,0xa3,0x00,0xf1,0x17,0x03,0xa0,0x00,0x09,0x30,0x00,0x09,0xdc,0xbb,0x2f,0xcc,
+0xba,0x4d,0x08,0x61,0xa5,0x1d,0x10,0x16,0x45,0x57,0xc4,0x46,0x42,0x0d,0x87,0x77,
+0x77,0x77,0xa9,0x0c,0x6b,0xbb,0xbb,0xbb,0x58,0x00,0x68,0xb3,0x07,0x40,0x6d,0xbb,
+0xbb,0xbe,0xb1,0x07,0x00,0x01,0x00,0x50,0x6e,0xcc,0xcc,0xcd,0xb0,0x0c,0x00,0xf0,
+0x33,0x03,0xb0,0x00,0x6e,0xbb,0xbb,0xbc,0xb0,0x00,0x93,0x00,0x09,0x50,0x00,0x00,
+0x4f,0xed,0xca,0xfd,0xdc,0xc6,0x1e,0x29,0x51,0xd2,0x1d,0x10,0x00,0x42,0x85,0x22,
+0x34,0x75,0x40,0x09,0x9d,0xb9,0x7b,0xa8,0x8f,0x00,0x7a,0xdb,0xa5,0xb3,0x00,0xe0,
+0x0b,0x4a,0x67,0x7b,0x30,0x0e,0x00,0xb7,0xb9,0xa7,0xb3,0x24,0xe0,0x0a,0xad,0xbc,
+0x7b,0x34,0x95,0xb1,0x04,0xf4,0x02,0xb3,0x00,0x24,0x2b,0xbd,0xcb,0xab,0x30,0x05,
+0x90,0x00,0x84,0x00,0x6e,0xdd,0xe3,0x00,0xc9,0x07,0x00,0xa5,0x05,0x90,0x0a,0x67,
+0xa5,0xbb,0xfc,0xbb,0x50,0xa7,0x7b,0x28,0x04,0xf0,0x22,0x08,0xaa,0x70,0xaa,0xeb,
+0xaa,0x11,0x69,0xa5,0x57,0x7e,0x87,0x75,0x28,0xdc,0x82,0x33,0x33,0x33,0x20,0x0e,
+0xe1,0x0e,0xbb,0xbb,0xe0,0x05,0xeb,0xb0,0xe5,0x55,0x5e,0x00,0xd8,0x77,0x0e,0x44,
+0x44,0xe0,0x3a,0x67,0x00,0xea,0xaa,0xae,0x00,0x16,0x70,0x0e,0x02,0x01,0x56,0x67,
+0x00,0xe0,0x08,0xca,0x97,0x01,0xf2,0x3d,0xd1,0x00,0x00,0x00,0x5b,0xbb,0xbf,0xcb,
+0xbb,0xa0,0x00,0x45,0x55,0xe7,0x55,0x50,0x00,0x04,0x66,0x6e,0x76,0x66,0x00,0x0c,
+0xcc,0xcc,0xfc,0xcc,0xcc,0x50,0x00,0x07,0xb3,0x05,0x40,0x00,0x00,0x5f,0xeb,0xcd,
+0x92,0x00,0x00,0x00,0x38,0xb7,0x10,0xb7,0x00,0x04,0xdf,0xeb,0xdc,0xba,0xba,0x00,
+0x11,0x55,0x09,0x53,0x70,0x30,0x02,0x9b,0x10,0x95,0x07,0xd4,0x00,0xa5,0x05,0xdd,
+0x20,0x02,0xa1,0x00,0xbf,0x08,0x63,0xbd,0xdd,0xdf,0xdd,0xdd,0xc0,0x0d,0x00,0x10,
+0xdd,0x0d,0x00,0xf2,0x28,0xd1,0x0e,0x00,0x2c,0x50,0x20,0x0d,0x10,0x80,0x6b,0x20,
+0x7c,0x10,0x70,0x00,0x6c,0xae,0xe6,0x16,0x00,0x00,0x00,0x6b,0x70,0x01,0xb8,0x00,
 0x05,0xff,0xcb,0xec,0x98,0xb6,0x00,0x00,0x64,0x0b,0x34,0x60,0x30,0x02,0xaa,0x00,
-0xb3,0x07,0xc3,0x00,0x84,0x06,0xdd,0x10,0x03,0x80,0x2c,0x4e,0x00,0x4e,0x24,0xf0,
-0x05,0x0e,0xff,0xff,0xf1,0x01,0xb0,0x90,0xe0,0x1c,0x0d,0x10,0xb5,0x88,0x0e,0x01,
+0xb3,0x07,0xc3,0x00,0x84,0x06,0xdd,0x10,0x03,0x80,0x00,0x07,0x6a,0x08,0xf0,0x06,
+0x70,0x0e,0xff,0xff,0xf1,0x01,0xb0,0x90,0xe0,0x1c,0x0d,0x10,0xb5,0x88,0x0e,0x01,
 0xc0,0xd1,0x1a,0xbd,0x10,0x0d,0x00,0xf0,0x07,0x0c,0x2b,0x0e,0xbb,0xfb,0xf1,0x0a,
 0xb9,0xd4,0xe2,0x4d,0x2d,0x10,0x96,0x33,0x3e,0x01,0xc0,0xd1,0x07,0x24,0xb0,0x1a,
-0x00,0xe0,0xc3,0x98,0x4e,0x01,0xc0,0xd1,0x1b,0x1b,0x35,0xee,0xef,0xef,0x12,0x60,
-0xb7,0x32,0x02,0xee,0x35,0x01,0xaf,0x23,0x11,0x88,0x1f,0x3d,0xf0,0x1e,0x1f,0xcb,
-0xb7,0x00,0x3c,0x1d,0x1c,0xd1,0x1c,0x40,0x1d,0x7a,0x79,0x88,0x87,0xb0,0x01,0x9b,
-0xc1,0x00,0x0d,0xe0,0x00,0x01,0xd3,0xb0,0x19,0xcb,0x90,0x01,0xcb,0x9f,0x6e,0x71,
-0x08,0xe4,0x08,0x52,0x63,0x12,0xc9,0x12,0x10,0x83,0x5b,0x11,0x0f,0xe0,0x0d,0x29,
-0x93,0x79,0x40,0x00,0x02,0xb0,0xb2,0x10,0x49,0xd8,0x10,0x13,0x3c,0x05,0x42,0x75,
-0x00,0x00,0x26,0x00,0x3e,0xf0,0x19,0x50,0xaf,0xdd,0xdf,0x70,0x02,0xc1,0x70,0xb4,
-0x01,0xe1,0x00,0xb3,0x87,0x02,0xd2,0xb7,0x00,0x5f,0xdd,0x00,0x06,0xfa,0x00,0x00,
-0x1b,0x55,0x17,0xd8,0xd9,0x20,0x09,0x83,0xca,0x60,0x91,0x6b,0x24,0xeb,0x9c,0x3c,
-0x26,0x90,0x03,0x22,0x63,0xcc,0xfd,0xc7,0x00,0xc6,0x6c,0x48,0x03,0xd5,0x39,0x47,
-0xa1,0x00,0xd1,0x00,0x07,0x62,0x60,0xbd,0xdf,0xed,0xd1,0x29,0x03,0x31,0x00,0x02,
-0x60,0x7b,0x10,0x00,0xdb,0x07,0x20,0xc0,0x79,0x25,0x37,0xfa,0x2b,0x86,0x59,0x00,
-0xb5,0x26,0x00,0x2f,0xef,0x10,0x7a,0x00,0xc2,0x00,0x18,0x67,0x6f,0xdd,0xdc,0xc0,
-0x04,0xb1,0xd3,0x45,0x03,0x07,0x11,0xfd,0xbc,0x44,0xa0,0xe0,0x00,0x03,0x12,0x50,
-0x58,0x0e,0x00,0x00,0xb4,0x7a,0x09,0x50,0xe0,0x32,0x0c,0x1a,0x72,0xd1,0x0e,0x07,
-0x52,0x90,0x73,0xd4,0x00,0xad,0xe2,0xb1,0x46,0x20,0x07,0x80,0x7f,0x10,0x00,0xbe,
-0x26,0xf0,0x2b,0x0d,0x05,0x10,0x58,0x19,0x1d,0x56,0xd1,0xd0,0x1e,0x5a,0x70,0xd0,
-0x9d,0x75,0x02,0x9b,0xc0,0x0d,0x8b,0xfb,0xb6,0x01,0xc2,0xb0,0xd1,0x6f,0x42,0x11,
-0xdb,0xbe,0x3d,0x0b,0xec,0x20,0x06,0x30,0x43,0xd5,0x8d,0x2d,0x10,0x94,0x5b,0x1d,
-0xc1,0xd0,0x41,0x0b,0x28,0x94,0xd1,0x0c,0x00,0x00,0xb1,0xa4,0x3d,0x08,0x02,0x10,
-0x07,0x08,0x2b,0x25,0xa0,0x00,0xa2,0x4b,0x10,0x2b,0xa1,0x03,0x70,0x2d,0xdd,0xfd,
-0xd9,0x02,0xb0,0xc0,0x0d,0x00,0x90,0xb4,0x88,0x09,0xcd,0xfc,0xc3,0x2d,0xce,0x00,
-0xc2,0x69,0xfa,0x1e,0x0b,0x58,0x2e,0xcc,0xcc,0xd9,0x08,0x94,0xe2,0xa1,0x10,0x13,
-0x91,0xd9,0x69,0x33,0x67,0x2b,0x13,0x03,0x23,0x80,0x08,0x62,0xb0,0x00,0xb4,0x89,
-0x40,0xd2,0x2b,0x03,0x0c,0x1a,0x47,0x8b,0x02,0xb0,0xc1,0x80,0x50,0x8c,0x10,0x0d,
-0xda,0x34,0x04,0xf0,0x35,0xeb,0xce,0xb6,0xfd,0xde,0x90,0x0e,0x9a,0xad,0x06,0x70,
-0xc3,0x00,0xe6,0x66,0xc0,0x0b,0xb8,0x00,0x0e,0x35,0xb3,0x02,0xbe,0x81,0x00,0xab,
-0xbb,0xc7,0xb3,0x06,0xd1,0x00,0x03,0x99,0x15,0x70,0x00,0x00,0x06,0xaa,0xfc,0x52,
-0x80,0x00,0x02,0x7b,0xfa,0x89,0xad,0xc2,0x00,0x46,0x76,0x3e,0x23,0x32,0x50,0x01,
-0x8c,0x20,0xd1,0x3a,0xa1,0x00,0x85,0x03,0xbd,0x00,0x52,0x13,0x06,0x58,0x14,0x10,
-0x1c,0x9d,0x09,0xf5,0x2f,0xc2,0x43,0x11,0x11,0x3c,0x00,0x77,0x1e,0x28,0xaa,0xab,
-0xc0,0x1f,0xdf,0x60,0x22,0x22,0x5c,0x20,0x08,0x98,0x2a,0xac,0xda,0xa8,0x06,0xc3,
-0xa5,0x80,0x69,0x05,0x51,0xeb,0x98,0x96,0xa6,0xb7,0xb0,0x04,0x23,0x80,0x04,0xcf,
-0xb0,0x00,0xc3,0x8a,0x26,0xc8,0x9a,0x90,0x0c,0x1a,0x47,0x80,0x69,0x07,0xa1,0x60,
-0x40,0x00,0xad,0xbb,0x2b,0x00,0x11,0x0f,0x10,0x90,0x4b,0x02,0x70,0xab,0xed,0xbb,
-0x00,0x2c,0x1d,0x0e,0xc2,0x43,0x81,0x7a,0x70,0xeb,0xbb,0xbf,0x01,0xcc,0xd0,0x69,
-0x03,0xf5,0x1c,0xc4,0xa0,0xec,0xcc,0xcf,0x00,0xab,0x6e,0x00,0x01,0xe0,0x30,0x0b,
-0x86,0xa7,0xcd,0x6f,0x6c,0x10,0x53,0x48,0x01,0xd2,0xfd,0x10,0x0c,0x47,0xc0,0xa7,
-0x1d,0x95,0x00,0xc2,0x93,0xb8,0x01,0xd0,0xc6,0x15,0x02,0x02,0x09,0xe9,0x3a,0x18,
-0x40,0xb2,0x00,0x00,0xc0,0x1c,0x27,0xf0,0x09,0xaa,0xeb,0xa6,0x08,0x68,0x5d,0x11,
-0x11,0x68,0x1c,0x0d,0x0d,0x00,0x00,0x58,0x9e,0xf6,0x0d,0xcc,0xcc,0xc6,0x03,0xb7,
-0x1d,0x24,0x06,0xf3,0x14,0x49,0x6e,0xeb,0xee,0xbe,0x59,0x76,0x8e,0xb0,0xaa,0x0b,
-0x17,0x89,0x1d,0xeb,0xee,0xbe,0x48,0xb7,0x9b,0xb0,0xaa,0x0b,0x75,0xa2,0xa7,0xb0,
-0xaa,0x0b,0x81,0x30,0x72,0xb0,0x66,0x5b,0x32,0x04,0xf0,0x0e,0xdb,0xdd,0xbd,0xdb,
-0xc9,0x00,0x69,0x49,0x94,0x99,0x48,0x90,0x02,0x55,0x56,0xe5,0x55,0x53,0x00,0xcc,
-0xcc,0xde,0xcc,0xcc,0xb0,0x00,0x36,0x6a,0xb6,0x14,0x1e,0xf5,0x02,0x93,0x33,0x33,
-0x97,0x00,0x00,0x7c,0x99,0x99,0x9c,0x70,0x00,0x07,0xb7,0x77,0x77,0xb7,0x0d,0x00,
-0x10,0x60,0x93,0x16,0x82,0x2b,0xdd,0xbb,0xbb,0xbd,0xdb,0x20,0x07,0x48,0x00,0xf0,
-0x04,0x79,0x39,0x83,0x98,0x37,0x90,0x03,0x66,0x6a,0xc6,0x66,0x74,0x00,0x0b,0xcc,
-0xde,0xcc,0x8c,0x30,0xbe,0x10,0x60,0x7d,0x20,0x02,0xcc,0xcc,0xdf,0x76,0x16,0xf0,
-0x03,0x04,0x9f,0xd6,0x55,0x50,0x03,0xbe,0xd9,0x55,0x55,0x5e,0x00,0x03,0x08,0xca,
-0xaa,0xaa,0xf0,0xa7,0x1c,0x00,0xf8,0x1b,0x54,0x08,0xdb,0xbb,0xbb,0xf0,0x68,0x5b,
-0xc0,0x01,0x11,0x97,0x11,0x1c,0x40,0x00,0x9a,0xad,0xca,0xbd,0x50,0xa9,0x2c,0x20,
-0x1c,0x50,0x37,0x0e,0x10,0xff,0xf3,0x2a,0x30,0x02,0xba,0x10,0x92,0x44,0x10,0xfe,
-0xeb,0x1e,0x21,0xbc,0x5d,0xea,0x48,0x42,0x04,0xfc,0xcc,0xcd,0x81,0x0b,0x15,0xe1,
-0x9e,0x27,0x21,0x00,0x3d,0xec,0x0f,0x06,0xf1,0x2c,0x10,0x12,0xd4,0x03,0x00,0xbb,
-0x25,0x41,0xcd,0xde,0xed,0xde,0x55,0x00,0xc1,0x1b,0x50,0x00,0x1d,0xdd,0xdf,0xef,
-0xfd,0xdd,0x50,0x00,0x03,0x55,0x00,0xf1,0x09,0x3a,0xfe,0xbb,0xbb,0x90,0x01,0xdc,
-0xa9,0x11,0x11,0x3d,0x00,0x02,0x05,0xd9,0x99,0x9a,0xd0,0x00,0x00,0x5a,0x22,0x22,
-0x4d,0x27,0x61,0x00,0x23,0x07,0x40,0x5e,0xdd,0xdd,0xdc,0x61,0x14,0xa0,0x0d,0x10,
-0x03,0x00,0xbc,0xce,0x60,0xd7,0xad,0x80,0x0d,0x00,0xf0,0x00,0x72,0x00,0x01,0x69,
-0xbd,0x60,0xc4,0x22,0x78,0x16,0x30,0x64,0x04,0xaa,0xa9,0xec,0x00,0x00,0x82,0x0d,
-0x11,0x2c,0x11,0x26,0x21,0x02,0xfb,0x06,0x06,0x0e,0x0d,0x00,0x00,0xae,0x20,0x2c,
-0x4d,0xd9,0xc0,0x4b,0x30,0x51,0x00,0xd0,0x82,0x04,0xf0,0x13,0xc3,0x0d,0x05,0xc3,
+0x00,0xf0,0x01,0xc3,0x98,0x4e,0x01,0xc0,0xd1,0x1b,0x1b,0x35,0xee,0xef,0xef,0x12,
+0x60,0x30,0x0e,0x2e,0x02,0x03,0xe2,0x01,0xf0,0x38,0xc0,0x00,0x88,0x00,0x00,0x00,
+0xa5,0x00,0x1f,0xcb,0xb7,0x00,0x3c,0x1d,0x1c,0xd1,0x1c,0x40,0x1d,0x7a,0x79,0x88,
+0x87,0xb0,0x01,0x9b,0xc1,0x00,0x0d,0xe0,0x00,0x01,0xd3,0xb0,0x19,0xcb,0x90,0x01,
+0xcb,0x9f,0x6e,0x71,0x08,0xe4,0x08,0x52,0x63,0x12,0xc9,0x12,0x10,0x83,0x5b,0x00,
+0x00,0x66,0x00,0x0d,0x29,0x93,0x79,0x40,0x00,0x02,0xb0,0xb2,0x10,0x49,0xd8,0x10,
+0x13,0x3c,0x05,0x41,0x75,0x00,0x00,0x26,0x55,0x00,0xf0,0x27,0x0a,0x50,0xaf,0xdd,
+0xdf,0x70,0x02,0xc1,0x70,0xb4,0x01,0xe1,0x00,0xb3,0x87,0x02,0xd2,0xb7,0x00,0x5f,
+0xdd,0x00,0x06,0xfa,0x00,0x00,0x1b,0x55,0x17,0xd8,0xd9,0x20,0x09,0x83,0xca,0x60,
+0x91,0x6b,0x24,0xeb,0x9c,0x10,0x0d,0x20,0x00,0x03,0x22,0x63,0xcc,0xfd,0xc7,0x00,
+0xc6,0x6c,0x48,0x03,0xd5,0x39,0x47,0xa1,0x00,0xd1,0x00,0x07,0x62,0x60,0xbd,0xdf,
+0xed,0xd1,0x29,0x03,0x71,0x00,0x02,0x60,0x00,0x00,0x06,0x80,0xdb,0x07,0xf1,0x31,
+0xc0,0x79,0xde,0xfd,0xdd,0x20,0x86,0x59,0x00,0xb5,0x26,0x00,0x2f,0xef,0x10,0x7a,
+0x00,0xc2,0x00,0x18,0x67,0x6f,0xdd,0xdc,0xc0,0x04,0xb1,0xd3,0x45,0x03,0x07,0x11,
+0xfd,0xbc,0x44,0xa0,0xe0,0x00,0x03,0x12,0x50,0x58,0x0e,0x00,0x00,0xb4,0x7a,0x09,
+0x50,0xe0,0x32,0x0c,0x1a,0x72,0xd1,0x0e,0x07,0x52,0x90,0x73,0xd4,0x00,0xad,0xe2,
+0x59,0x09,0x15,0x00,0xb7,0x09,0x40,0x80,0x00,0x00,0xd0,0xf4,0x01,0xf0,0x2c,0xd2,
+0x0d,0x05,0x10,0x58,0x19,0x1d,0x56,0xd1,0xd0,0x1e,0x5a,0x70,0xd0,0x9d,0x75,0x02,
+0x9b,0xc0,0x0d,0x8b,0xfb,0xb6,0x01,0xc2,0xb0,0xd1,0x6f,0x42,0x11,0xdb,0xbe,0x3d,
+0x0b,0xec,0x20,0x06,0x30,0x43,0xd5,0x8d,0x2d,0x10,0x94,0x5b,0x1d,0xc1,0xd0,0x41,
+0x0b,0x28,0x94,0xd1,0x0c,0x00,0x00,0xb1,0xa4,0x3d,0x08,0x02,0x63,0x07,0x00,0xfe,
+0xee,0xee,0xa0,0x55,0x00,0x40,0x57,0x00,0x00,0x2b,0xa1,0x03,0x70,0x2d,0xdd,0xfd,
+0xd9,0x02,0xb0,0xc0,0x0d,0x00,0xfa,0x2b,0xb4,0x88,0x09,0xcd,0xfc,0xc3,0x2d,0xce,
+0x00,0x01,0x11,0x11,0x00,0x0b,0x58,0x2e,0xcc,0xcc,0xd9,0x08,0x94,0xe2,0xa1,0x10,
+0x13,0x91,0xd9,0x69,0x33,0x67,0x2b,0x13,0x03,0x23,0x80,0x08,0x62,0xb0,0x00,0xb4,
+0x89,0x40,0xd2,0x2b,0x03,0x0c,0x1a,0x47,0x8b,0x02,0xb0,0xc1,0x80,0x50,0x8c,0x10,
+0x0d,0xda,0x34,0x04,0xf2,0x3a,0xeb,0xce,0xb6,0xfd,0xde,0x90,0x0e,0x9a,0xad,0x06,
+0x70,0xc3,0x00,0xe6,0x66,0xc0,0x0b,0xb8,0x00,0x0e,0x35,0xb3,0x02,0xbe,0x81,0x00,
+0xab,0xbb,0xc7,0xb3,0x06,0xd1,0x00,0x03,0x99,0x15,0x70,0x00,0x00,0x06,0xaa,0xfc,
+0x52,0x80,0x00,0x02,0x7b,0xfa,0x89,0xad,0xc2,0x00,0x46,0x76,0x3e,0x23,0x32,0x50,
+0x01,0x8c,0x20,0xd1,0x3a,0xa1,0x00,0x85,0x03,0xbd,0x00,0x03,0x60,0x00,0x06,0x02,
+0x0c,0x20,0xc0,0x1c,0x9d,0x09,0xf5,0x30,0xc2,0x43,0x11,0x11,0x3c,0x00,0x77,0x1e,
+0x28,0xaa,0xab,0xc0,0x1f,0xdf,0x60,0x22,0x22,0x5c,0x20,0x08,0x98,0x2a,0xac,0xda,
+0xa8,0x06,0xc3,0xa5,0x80,0x69,0x05,0x51,0xeb,0x98,0x96,0xa6,0xb7,0xb0,0x04,0x23,
+0x80,0x04,0xcf,0xb0,0x00,0xc3,0x8a,0x26,0xc8,0x9a,0x90,0x0c,0x1a,0x47,0x80,0x69,
+0x07,0xa1,0x60,0x40,0x00,0xad,0x60,0x2d,0x04,0x40,0xb0,0x00,0x07,0x90,0x4b,0x02,
+0xf1,0x04,0xab,0xed,0xbb,0x00,0x2c,0x1d,0x0e,0x00,0x00,0xf0,0x0c,0x7a,0x70,0xeb,
+0xbb,0xbf,0x01,0xcc,0xd0,0x69,0x03,0xf3,0x1e,0xc4,0xa0,0xec,0xcc,0xcf,0x00,0xab,
+0x6e,0x00,0x01,0xe0,0x30,0x0b,0x86,0xa7,0xcd,0x6f,0x6c,0x10,0x53,0x48,0x01,0xd2,
+0xfd,0x10,0x0c,0x47,0xc0,0xa7,0x1d,0x95,0x00,0xc2,0x93,0xb8,0x01,0xd0,0xc6,0x15,
+0x02,0x02,0x09,0xe9,0x00,0x10,0x55,0x00,0xf0,0x11,0xb2,0x00,0x00,0xc0,0x00,0x02,
+0xd0,0x09,0xaa,0xeb,0xa6,0x08,0x68,0x5d,0x11,0x11,0x68,0x1c,0x0d,0x0d,0x00,0x00,
+0x58,0x9e,0xf6,0x0d,0xcc,0xcc,0xc6,0x03,0xb7,0x1d,0x24,0x06,0xf3,0x14,0x49,0x6e,
+0xeb,0xee,0xbe,0x59,0x76,0x8e,0xb0,0xaa,0x0b,0x17,0x89,0x1d,0xeb,0xee,0xbe,0x48,
+0xb7,0x9b,0xb0,0xaa,0x0b,0x75,0xa2,0xa7,0xb0,0xaa,0x0b,0x81,0x30,0x72,0xb0,0x66,
+0x5b,0x32,0x04,0xf5,0x23,0xdb,0xdd,0xbd,0xdb,0xc9,0x00,0x69,0x49,0x94,0x99,0x48,
+0x90,0x02,0x55,0x56,0xe5,0x55,0x53,0x00,0xcc,0xcc,0xde,0xcc,0xcc,0xb0,0x00,0x36,
+0x6a,0xb6,0x66,0x30,0x00,0x07,0x93,0x33,0x33,0x97,0x00,0x00,0x7c,0x99,0x99,0x9c,
+0x70,0x00,0x07,0xb7,0x77,0x77,0xb7,0x0d,0x00,0xd2,0x60,0x00,0x00,0x77,0x00,0x2b,
+0xdd,0xbb,0xbb,0xbd,0xdb,0x20,0x07,0x48,0x00,0xf0,0x25,0x79,0x39,0x83,0x98,0x37,
+0x90,0x03,0x66,0x6a,0xc6,0x66,0x74,0x00,0x0b,0xcc,0xde,0xcc,0x8c,0x30,0x00,0x00,
+0x05,0x90,0x7d,0x20,0x02,0xcc,0xcc,0xdf,0xfc,0xcc,0xc3,0x00,0x04,0x9f,0xd6,0x55,
+0x50,0x03,0xbe,0xd9,0x55,0x55,0x5e,0x00,0x03,0x08,0xca,0xaa,0xaa,0xf0,0x00,0xf3,
+0x05,0xa0,0x0d,0x00,0x00,0x08,0xdb,0xbb,0xbb,0xf0,0x00,0x00,0x16,0x05,0x00,0x52,
+0x07,0x90,0x97,0x11,0x1c,0x40,0x00,0x9a,0xad,0xca,0xbd,0x0f,0x00,0x30,0x95,0x1c,
+0x50,0x37,0x0e,0x70,0xff,0xdd,0xdd,0x20,0x00,0x02,0xba,0x09,0x01,0x90,0x29,0xfe,
+0xcc,0xcc,0xb0,0x02,0xbc,0x5d,0x30,0xb4,0x01,0x42,0x04,0xfc,0xcc,0xcd,0x81,0x0b,
+0x11,0xe1,0x06,0x00,0x10,0x2d,0x05,0x00,0xb0,0x3d,0xdd,0x50,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0xf0,0x4c,0x00,0x00,0x09,0x50,0x00,0x12,0x00,0x00,0x00,0xa5,
+0x00,0x0b,0x60,0x00,0xcd,0xde,0xed,0xde,0x50,0x00,0x00,0x00,0x95,0x1b,0x50,0x00,
+0x1d,0xdd,0xdf,0xef,0xfd,0xdd,0x50,0x00,0x03,0xba,0x10,0x00,0x00,0x00,0x3a,0xfe,
+0xbb,0xbb,0x90,0x01,0xdc,0xa9,0x11,0x11,0x3d,0x00,0x02,0x05,0xd9,0x99,0x9a,0xd0,
+0x00,0x00,0x5a,0x22,0x22,0x4d,0x00,0x00,0x05,0x90,0x00,0x02,0xd0,0x00,0x00,0x5e,
+0xdd,0xdd,0xdc,0x00,0x00,0x00,0x86,0x0d,0x10,0x03,0x00,0xbc,0xce,0x60,0xd7,0xad,
+0x80,0x0d,0x00,0xff,0x13,0x72,0x00,0x01,0x69,0xbd,0x60,0xc4,0x22,0x78,0x16,0x30,
+0x64,0x04,0xaa,0xa9,0x20,0x02,0xcc,0xcc,0xcc,0xca,0x00,0x00,0x2c,0x00,0x00,0x01,
+0xe0,0x00,0x02,0xfb,0xbb,0xbb,0xbe,0x0d,0x00,0x03,0x5a,0xc0,0x00,0x4d,0xd9,0x00,
+0x01,0x00,0xf1,0x5a,0x0b,0x51,0x00,0xd0,0x00,0x00,0x03,0xc0,0xc3,0x0d,0x05,0xc3,
 0x01,0xd5,0x37,0xc1,0xfd,0x93,0x00,0x3b,0xa8,0x7b,0x4e,0x00,0x04,0x00,0x33,0x33,
-0x30,0xe0,0x00,0xd1,0x0d,0x99,0xad,0x0a,0xdd,0xd9,0x00,0xd6,0x67,0xd0,0xc5,0x35,
-0xf3,0x10,0x54,0x5d,0x0e,0x28,0xd4,0x00,0xda,0x9a,0xd0,0xf9,0x40,0x00,0x0d,0x21,
+0x30,0xe0,0x00,0xd1,0x0d,0x99,0xad,0x0a,0xdd,0xd9,0x00,0xd6,0x67,0xd0,0xb0,0x00,
+0x00,0x0d,0x54,0x5d,0x0e,0x28,0xd4,0x00,0xda,0x9a,0xd0,0xf9,0x40,0x00,0x0d,0x21,
 0x3d,0x0e,0x00,0x07,0x20,0xd0,0x01,0xd0,0xe0,0x00,0xc2,0x0d,0x07,0xe9,0x0a,0xdd,
-0xda,0x7b,0x55,0x12,0x78,0x17,0x3c,0x10,0xfe,0x9e,0x4c,0x10,0xe1,0x90,0x14,0x41,
-0xed,0xdd,0xdd,0xdf,0x09,0x00,0x81,0xba,0xaa,0xaa,0xaf,0xe4,0x33,0x33,0x33,0x1b,
-0x00,0x61,0xed,0xdd,0xdd,0xdd,0xfe,0x20,0xb9,0x06,0x15,0x01,0xe3,0x43,0x00,0xa9,
-0x31,0x11,0xda,0xf1,0x1d,0x11,0x3b,0x33,0x26,0x20,0x4b,0x00,0xa0,0x29,0x14,0xcb,
-0x12,0x00,0x21,0xdd,0xed,0x1e,0x00,0xfa,0x0d,0x89,0x00,0x1a,0x40,0x0d,0x10,0x0c,
-0x75,0xd6,0x00,0x0d,0x10,0x01,0xcf,0x20,0x00,0x0f,0x7a,0xd4,0x08,0xe8,0x30,0x4d,
-0x94,0x00,0x00,0x17,0xb1,0xe0,0x00,0x22,0x0c,0x20,0xbe,0x47,0x21,0xdd,0xc0,0x05,
-0x47,0x10,0xa7,0x20,0x65,0xd1,0x11,0x6c,0x11,0x10,0x05,0xff,0xdd,0xdf,0xdd,0xdf,
-0x00,0x12,0xd1,0xec,0x30,0x21,0x0d,0x10,0x15,0x41,0x11,0xde,0xe0,0x46,0x12,0x0d,
-0xf4,0x17,0x01,0x18,0x3a,0x31,0x30,0x0c,0x30,0xb5,0x26,0x12,0x5d,0xca,0x3a,0x20,
-0x04,0xa0,0xa6,0x54,0x60,0xdd,0xef,0xdd,0xdf,0xdd,0xd1,0x08,0x11,0xf0,0x2f,0xd2,
-0xa2,0x00,0x9c,0xcc,0xcc,0xcf,0xcd,0xc0,0x0b,0x43,0x33,0x32,0xc3,0x21,0x00,0xb5,
-0xc8,0xe8,0x4a,0x3a,0x50,0x0c,0x5d,0x8e,0x83,0x86,0xe0,0x00,0xd4,0xa0,0x05,0x66,
-0xe9,0x00,0x0e,0x2e,0xab,0xc6,0x3f,0x10,0x00,0xe2,0x90,0xb0,0x0b,0xf0,0x00,0x59,
-0x1a,0xaa,0xbe,0x88,0x85,0x46,0x20,0x00,0x07,0x60,0x0c,0xd1,0x00,0x50,0x08,0x00,
-0xe4,0x5e,0x62,0x5e,0xee,0xee,0xe0,0x0b,0x90,0x50,0x3c,0x21,0x6a,0x00,0xb1,0x2b,
-0xd1,0x1a,0xbb,0xbb,0xbb,0x40,0x3e,0xb0,0x22,0x22,0xa8,0x21,0x2e,0x9b,0x5b,0x16,
-0x21,0x34,0xb0,0xb8,0x02,0x11,0x4b,0x0d,0x00,0x15,0x04,0x0d,0x00,0x11,0x09,0x0d,
-0x00,0x50,0xbe,0xd2,0x00,0x00,0x73,0x95,0x0c,0xf0,0x03,0x00,0x4c,0x19,0x8e,0x41,
-0xbd,0xd1,0x3c,0x23,0x88,0xe8,0x80,0x00,0x01,0x18,0x82,0x2d,0x22,0xd8,0x30,0xf1,
-0x1c,0xe9,0xe9,0xdd,0xdd,0x51,0xdd,0x0d,0x7e,0x7d,0x0a,0x30,0x77,0xd0,0xb2,0xd2,
-0xc0,0xa3,0x00,0x0d,0x0b,0x9e,0x9a,0x0a,0x30,0x00,0xd0,0x77,0xe7,0x70,0xa3,0x00,
-0x0d,0x02,0x2d,0x22,0x0a,0x30,0x00,0xd4,0xcc,0xed,0xc0,0xb3,0x11,0x1f,0x2a,0xce,
-0x10,0x5a,0x18,0x10,0x8d,0x30,0x07,0x04,0xf0,0x51,0x10,0x0b,0x4d,0x18,0x13,0x10,
-0xcb,0x17,0x02,0x4a,0x07,0xf0,0x09,0x00,0x00,0x8b,0x6a,0x00,0x22,0x00,0x04,0xca,
-0x00,0xd3,0x4d,0x30,0x2d,0xbc,0x50,0x04,0xeb,0x10,0x00,0x30,0x95,0x01,0x26,0xaa,
-0x32,0x81,0xbc,0xd5,0x04,0xeb,0x20,0x00,0xc8,0x20,0x2c,0x3d,0x01,0x05,0x33,0x01,
-0x6b,0x10,0x21,0xa0,0x02,0x14,0x46,0xf0,0x09,0x00,0x03,0xdb,0xbb,0xbb,0xd4,0x00,
-0x05,0x8c,0x44,0x44,0x4b,0x85,0x10,0x69,0xc5,0x55,0x55,0xc9,0x61,0x00,0x4e,0xbb,
-0xbb,0x33,0x61,0xf0,0x01,0x18,0xc5,0xd1,0x06,0x40,0x00,0x5c,0xb0,0x0a,0x9a,0x80,
-0x03,0xe9,0x89,0x00,0x1c,0x54,0x30,0xe0,0xdb,0xd7,0x08,0xe8,0x20,0x00,0x67,0x20,
-0x00,0x01,0x71,0x00,0x05,0x80,0x4e,0x28,0x21,0x98,0x58,0x28,0x02,0x80,0x96,0x8c,
-0xdd,0xfe,0xdd,0x40,0x00,0x88,0x0d,0x00,0x21,0x07,0xdb,0x1a,0x00,0x32,0x71,0x58,
-0x7e,0xcc,0x2e,0x00,0x04,0x00,0x00,0x0e,0x2b,0x00,0x7b,0x50,0x70,0xc7,0x1d,0x11,
-0xa5,0x00,0x9c,0xd7,0x8d,0x59,0xa0,0x03,0x08,0x95,0x95,0x3d,0x93,0x00,0x00,0xda,
-0x73,0xb8,0x87,0x06,0xcd,0x53,0x00,0x1d,0x21,0x10,0x85,0xc7,0x2c,0xf0,0x1c,0x0d,
+0xda,0x00,0x00,0x02,0x90,0x00,0x00,0x00,0x78,0x00,0x00,0xee,0xee,0xee,0xee,0xfe,
+0x10,0x00,0x00,0x0f,0xe1,0x00,0x00,0x00,0xfe,0xed,0xdd,0xdd,0xdf,0x09,0x00,0x81,
+0xba,0xaa,0xaa,0xaf,0xe4,0x33,0x33,0x33,0x1b,0x00,0xc1,0xed,0xdd,0xdd,0xdd,0xfe,
+0x20,0x00,0x00,0x0e,0x00,0x00,0x01,0x8c,0x00,0xf4,0x0c,0x4c,0x00,0x00,0x00,0x0c,
+0xdd,0xdf,0xdd,0xda,0x00,0x0d,0x10,0x00,0x00,0x3b,0x00,0x0d,0x20,0x00,0x00,0x4b,
+0x00,0x0d,0xcb,0xbb,0xbb,0xcb,0x12,0x00,0x21,0xdd,0xed,0x1e,0x00,0xfa,0x0d,0x89,
+0x00,0x1a,0x40,0x0d,0x10,0x0c,0x75,0xd6,0x00,0x0d,0x10,0x01,0xcf,0x20,0x00,0x0f,
+0x7a,0xd4,0x08,0xe8,0x30,0x4d,0x94,0x00,0x00,0x17,0xb1,0xe0,0x00,0x20,0x0c,0x20,
+0x06,0x00,0xf0,0x14,0x08,0xfd,0xdd,0xc0,0x00,0x00,0x04,0xd0,0x00,0xa7,0x00,0x00,
+0x06,0xf4,0x11,0x6c,0x11,0x10,0x05,0xff,0xdd,0xdf,0xdd,0xdf,0x00,0x12,0xd1,0x00,
+0xe0,0x00,0xe0,0x00,0x0d,0x10,0x0e,0x87,0x00,0x51,0xde,0xee,0xee,0xee,0xf0,0x6b,
+0x00,0x40,0x08,0x00,0x00,0xd1,0x38,0x00,0xf1,0x4f,0x30,0x0c,0x30,0x00,0x00,0x00,
+0xd2,0x00,0x5d,0xee,0xee,0xee,0xe8,0x00,0x00,0x04,0xa0,0x00,0xe1,0x00,0x07,0xdd,
+0xef,0xdd,0xdf,0xdd,0xd1,0x00,0x04,0x90,0x00,0xd2,0xa2,0x00,0x9c,0xcc,0xcc,0xcf,
+0xcd,0xc0,0x0b,0x43,0x33,0x32,0xc3,0x21,0x00,0xb5,0xc8,0xe8,0x4a,0x3a,0x50,0x0c,
+0x5d,0x8e,0x83,0x86,0xe0,0x00,0xd4,0xa0,0x05,0x66,0xe9,0x00,0x0e,0x2e,0xab,0xc6,
+0x3f,0x10,0x00,0xe2,0x90,0xb0,0x0b,0xf0,0x00,0x59,0x1a,0xaa,0xbe,0x88,0x85,0x46,
+0x20,0x00,0x07,0x60,0x0c,0xd1,0x00,0x08,0x9c,0x00,0x81,0x09,0xa0,0x5e,0xee,0xee,
+0xe0,0x0b,0x90,0xaf,0x00,0x21,0x50,0x6a,0x07,0x00,0xf0,0x09,0x3e,0x1a,0xbb,0xbb,
+0xbb,0x40,0x3e,0xb0,0x22,0x22,0xa8,0x21,0x2e,0x9b,0x00,0x00,0x08,0x60,0x00,0x34,
+0xb0,0x00,0x00,0x86,0x10,0x01,0x00,0x0d,0x00,0x15,0x04,0x0d,0x00,0x11,0x09,0x0d,
+0x00,0xf6,0x42,0xbe,0xd2,0x00,0x00,0x73,0x13,0x57,0x70,0x00,0x00,0x4c,0x19,0x8e,
+0x41,0xbd,0xd1,0x3c,0x23,0x88,0xe8,0x80,0x00,0x01,0x18,0x82,0x2d,0x22,0x00,0x00,
+0x02,0xe0,0xe9,0xe9,0xdd,0xdd,0x51,0xdd,0x0d,0x7e,0x7d,0x0a,0x30,0x77,0xd0,0xb2,
+0xd2,0xc0,0xa3,0x00,0x0d,0x0b,0x9e,0x9a,0x0a,0x30,0x00,0xd0,0x77,0xe7,0x70,0xa3,
+0x00,0x0d,0x02,0x2d,0x22,0x0a,0x30,0x00,0xd4,0xcc,0xed,0xc0,0xb3,0x00,0x0d,0x00,
+0x00,0x00,0xce,0x10,0x41,0x01,0xa3,0xf0,0x00,0x00,0x00,0x8d,0xdd,0xdf,0xdd,0xdd,
+0x90,0x0d,0x00,0x62,0x0b,0xcc,0xcf,0xcc,0xcc,0x10,0x0d,0x00,0x20,0x01,0xdd,0x1a,
+0x00,0xf0,0x28,0xd1,0x00,0x00,0x8b,0x6a,0x00,0x22,0x00,0x04,0xca,0x00,0xd3,0x4d,
+0x30,0x2d,0xbc,0x50,0x04,0xeb,0x10,0x00,0x30,0x95,0x01,0x26,0xd3,0x00,0x00,0x0b,
+0xbc,0xd5,0x04,0xeb,0x20,0x00,0xc8,0x20,0x00,0x00,0x50,0x00,0x00,0x03,0xa0,0x00,
+0x00,0x00,0xaa,0xaa,0xaf,0xba,0xaa,0xa0,0x02,0x22,0x01,0x00,0xf1,0x35,0x00,0x03,
+0xdb,0xbb,0xbb,0xd4,0x00,0x05,0x8c,0x44,0x44,0x4b,0x85,0x10,0x69,0xc5,0x55,0x55,
+0xc9,0x61,0x00,0x4e,0xbb,0xbb,0xbe,0x40,0x00,0x00,0x18,0xc5,0xd1,0x06,0x40,0x00,
+0x5c,0xb0,0x0a,0x9a,0x80,0x03,0xe9,0x89,0x00,0x1c,0xb0,0x00,0x00,0x07,0xdb,0xd7,
+0x08,0xe8,0x20,0x00,0x67,0x20,0x00,0x01,0x71,0x00,0x05,0x80,0x00,0xd2,0x00,0x00,
+0x98,0x58,0x28,0x02,0x80,0x96,0x8c,0xdd,0xfe,0xdd,0x40,0x00,0x88,0x0d,0x00,0x21,
+0x07,0xdb,0x1a,0x00,0x90,0x71,0x58,0x7e,0xdd,0xdd,0xd0,0x00,0x00,0x00,0x04,0x00,
+0xf4,0x11,0xcc,0xcc,0xff,0xec,0xcc,0xc6,0x00,0x03,0xc7,0x1d,0x11,0xa5,0x00,0x9c,
+0xd7,0x00,0x4d,0xc3,0x00,0x03,0x08,0x95,0x95,0x3d,0x93,0x00,0x00,0xda,0x73,0x00,
+0x06,0xb5,0xef,0x00,0x02,0x8a,0x02,0xfb,0x3e,0x76,0x85,0x00,0x00,0x0b,0x20,0x0d,
 0xbd,0xca,0x60,0xd0,0xb2,0x03,0xb6,0xb9,0x66,0x0d,0x0b,0x20,0x14,0x4a,0x84,0x40,
 0xd0,0xb2,0x00,0xca,0xdc,0xab,0x0d,0x0b,0x20,0x0c,0x08,0x55,0xb0,0x33,0xc2,0x00,
-0x20,0x32,0x3c,0x00,0x54,0x00,0x4c,0xcc,0xcd,0xfd,0x84,0x2b,0xfb,0x09,0x4b,0x86,
+0x20,0x32,0x3c,0x00,0x54,0x00,0x4c,0xcc,0xcd,0xfd,0xcc,0xcb,0x00,0x00,0x4b,0x86,
 0xa0,0x3a,0x00,0x3a,0xdf,0x30,0x0a,0xca,0x10,0x01,0x30,0xe5,0x7a,0x08,0xd6,0x10,
-0x00,0x3d,0x84,0x10,0x02,0x89,0x72,0x03,0x12,0x2b,0x82,0x15,0xf0,0x2e,0x0a,0x20,
-0x2f,0xdc,0xcc,0xa0,0x0a,0xcc,0xc6,0xd9,0x22,0x22,0x00,0x01,0x11,0xd5,0xcd,0x88,
-0x8e,0x20,0x00,0x07,0x81,0x3e,0x99,0x9e,0x20,0x00,0x3f,0x6b,0x4b,0x11,0x1c,0x20,
-0x03,0xef,0xe2,0x29,0xf9,0x88,0x10,0x0d,0x4d,0x4a,0x08,0xe9,0x99,0x00,0x00,0x0d,
-0x02,0x9f,0x81,0x9a,0x00,0x00,0x0d,0x04,0x91,0xca,0xc0,0xc0,0x04,0x20,0x38,0xdd,
-0xc5,0x84,0x54,0x09,0xc8,0x10,0x4b,0xc0,0xec,0x02,0x20,0xdd,0xef,0xc9,0x28,0xf3,
-0x0a,0x02,0x27,0x92,0x6a,0x22,0x10,0x03,0xea,0xcd,0xac,0xda,0xbb,0x00,0x3a,0x05,
-0x80,0x59,0x03,0xb0,0x03,0xec,0xde,0xcd,0xec,0xdb,0x30,0x2a,0x40,0x1d,0xdd,0xee,
-0xdd,0xd8,0x2f,0x11,0x7b,0x35,0x49,0x40,0x1d,0xd9,0x58,0xc1,0x5b,0x53,0xa1,0xde,
-0xcd,0x94,0x00,0x0b,0xdb,0x84,0x00,0x15,0xbb,0x5c,0x1d,0x20,0xdf,0x20,0x3b,0x03,
-0x00,0x61,0x0d,0x11,0xcd,0x8a,0x24,0x0f,0x0d,0x00,0x01,0x50,0xbd,0xed,0xde,0xde,
-0x20,0xd3,0x2e,0x11,0xe1,0xda,0x2a,0xf5,0x01,0x0e,0x10,0x07,0x10,0x19,0xd0,0x00,
-0xe1,0x00,0xc2,0x5e,0x80,0x00,0x0a,0xfe,0xfb,0xec,0x10,0x03,0x62,0x18,0xf0,0x13,
-0x09,0xee,0xee,0xb0,0x06,0x7e,0x64,0x93,0x00,0x3b,0x00,0x56,0xe5,0x39,0xdc,0xcd,
-0xb0,0x00,0x0d,0x00,0x93,0x00,0x3b,0x01,0x99,0xf9,0x89,0xdc,0xcd,0xb0,0x04,0x6d,
-0x43,0x93,0x7e,0x39,0xf4,0x10,0xf3,0x08,0xee,0xfe,0xa0,0x00,0x87,0xd1,0x09,0x4b,
-0x20,0x00,0x0d,0x15,0xa0,0xd1,0xb2,0x00,0x07,0x90,0x02,0x89,0x0b,0x24,0x51,0xb0,
-0x00,0xb9,0x00,0x7e,0xd3,0x55,0x00,0x22,0x32,0x00,0xd7,0x4a,0xf0,0x01,0x0d,0xdc,
-0xcd,0xf0,0x16,0x6b,0x71,0xd0,0x00,0x1f,0x01,0x77,0x7e,0x2d,0xcb,0xbc,0xfa,0x43,
-0x10,0xd0,0x33,0x4d,0xf4,0x1d,0xf2,0x0d,0xcb,0xbc,0xf0,0x07,0xfe,0xb0,0xd0,0x00,
-0x1f,0x06,0xc4,0xc7,0x6b,0xfd,0xfd,0xc0,0x00,0x2c,0x00,0x0d,0x1b,0x30,0x00,0x02,
-0xc0,0x01,0xc0,0xb3,0x03,0x00,0x2c,0x01,0xc5,0x0b,0x32,0xb0,0x02,0xc1,0xd5,0x00,
-0x6d,0xe6,0x55,0x00,0x12,0x80,0x94,0x4c,0xf7,0x36,0xcc,0x27,0xcf,0xdd,0xd0,0x09,
-0x50,0xd1,0x01,0xc0,0x1c,0x03,0xf9,0xbd,0x80,0x96,0x04,0xa0,0x6e,0x3c,0x2d,0x89,
-0x09,0xb3,0x00,0xc5,0xc5,0xd0,0xa1,0xe0,0x00,0x0c,0x6c,0x5d,0x1f,0xdf,0xdc,0x00,
-0xc0,0xb0,0xd8,0x60,0xe0,0x00,0x0d,0xbe,0xbe,0x42,0x1e,0x11,0x00,0xd2,0xb2,0xd6,
-0xbb,0xfb,0xb2,0x5a,0x0b,0x0d,0x00,0x0e,0x00,0x08,0x30,0x3b,0xa0,0x00,0xe0,0xde,
-0x0e,0x24,0xa0,0x00,0x99,0x61,0x02,0xa5,0x37,0x04,0xae,0x07,0x26,0x2c,0xcc,0xce,
-0x31,0x0a,0x0d,0x00,0x20,0x5e,0xdd,0xde,0x1e,0x10,0x05,0x25,0x36,0x01,0x11,0x06,
-0x51,0x26,0xb0,0x00,0x05,0xda,0xd6,0x1c,0x05,0x03,0x1a,0x20,0x01,0xe0,0xaa,0x45,
-0x20,0x00,0x1e,0xde,0x1b,0x34,0xc2,0x01,0xe0,0x34,0x1f,0xf0,0x07,0x7d,0xdd,0x92,
-0x23,0xe2,0x21,0x01,0x11,0x11,0x9c,0xcf,0xcc,0x60,0x47,0x77,0x40,0x01,0xe0,0x00,
-0x05,0xcc,0xc8,0x1a,0x00,0x20,0x76,0x03,0x98,0x39,0x30,0x07,0x60,0x2a,0x0d,0x00,
-0x22,0x7e,0xcd,0x0d,0x00,0x02,0x68,0x1f,0x13,0x53,0xe7,0x3b,0x73,0x07,0xee,0xee,
-0xd0,0x3c,0xcc,0xcb,0x14,0x2d,0x00,0x5c,0x72,0x20,0xbb,0xb2,0x0d,0x00,0xf0,0x01,
-0x33,0x33,0x15,0xee,0xee,0xd0,0x06,0x77,0x73,0x59,0x00,0x08,0x00,0x7a,0xaa,0x35,
-0xbc,0x46,0xf2,0x0a,0x31,0x94,0x59,0x00,0x01,0x30,0xb2,0x09,0x45,0x90,0x00,0x49,
-0x0b,0xcb,0xe4,0x5b,0x11,0x18,0x70,0xb3,0x11,0x01,0xbd,0xdd,0xb1,0x50,0x54,0x00,
-0xab,0x3f,0x60,0xfe,0xee,0x00,0x06,0x6a,0x64,0x3d,0x22,0xf4,0x2b,0x44,0x44,0x36,
-0x80,0x0e,0x00,0x06,0xcc,0xc7,0xd2,0x00,0xad,0x60,0x35,0x55,0x55,0x33,0x33,0x30,
-0x03,0x55,0x54,0xda,0x99,0xbc,0x00,0x7c,0xcc,0x35,0x90,0x0c,0x40,0x09,0x40,0x93,
-0x0b,0x79,0xa0,0x00,0x94,0x09,0x30,0x2f,0xe1,0x00,0x09,0xdc,0xe6,0x8f,0x8a,0xe8,
-0x20,0x94,0x00,0x9c,0x40,0x06,0xd7,0x97,0x03,0x22,0x80,0x00,0xb1,0x52,0x76,0x7e,
-0xef,0xee,0xc0,0x7c,0xdc,0xc0,0x21,0x12,0x51,0x0c,0xcc,0x70,0xd0,0xc2,0xb3,0x14,
-0xd0,0x0c,0xa8,0x60,0x1c,0xcc,0x80,0xe0,0xc8,0x75,0x00,0x22,0x21,0x0e,0xff,0x2a,
-0x81,0xab,0xa0,0xe0,0xc2,0x00,0x00,0xc0,0x2a,0x0d,0x00,0xc0,0x9a,0xa9,0xf9,0xea,
-0x99,0x00,0xd2,0x22,0x44,0x44,0x44,0x40,0x1e,0x28,0x10,0x45,0x2d,0x09,0x00,0x13,
-0x07,0x30,0x18,0x8a,0x87,0xa9,0x12,0xf6,0x2b,0x33,0x33,0x20,0x3c,0x00,0x00,0x07,
-0xcc,0xc2,0x0c,0x20,0xd1,0x00,0x35,0x55,0x1c,0xeb,0xe6,0x00,0x03,0x55,0x51,0x00,
-0xb7,0x0c,0x10,0x7c,0xcc,0x24,0xc4,0x09,0x60,0x09,0x30,0xa4,0xa1,0x09,0xa0,0x00,
-0x93,0x09,0x20,0x2c,0xbd,0x10,0x09,0xdc,0xe5,0x9f,0x60,0x7d,0x10,0x93,0x00,0xda,
-0x20,0x00,0x96,0x88,0x6b,0x11,0x90,0x64,0x0d,0xf2,0x05,0x09,0x60,0x2d,0x00,0x6a,
-0xba,0xa3,0x7b,0x59,0x94,0x01,0x11,0x11,0x48,0x8f,0x98,0x70,0x0c,0xcc,0x70,0xda,
-0x20,0xd0,0x17,0x7e,0x87,0x30,0x0b,0xbb,0x71,0x88,0xf8,0x84,0x00,0x88,0x86,0x68,
-0x06,0x90,0x1c,0x12,0xba,0xee,0xfe,0xee,0x11,0xb0,0x1b,0x0d,0x00,0x72,0x1f,0xcd,
-0xb0,0x00,0xd1,0x00,0x01,0x2d,0x3d,0x23,0x01,0x50,0xb8,0x39,0xa0,0x1d,0xde,0xed,
-0xe0,0x6c,0xdc,0xc0,0xc1,0xa2,0x0d,0xfc,0x2d,0xf0,0x22,0x0c,0x01,0xc0,0x0c,0xcc,
-0x81,0x09,0x60,0x3a,0x00,0x44,0x42,0x1b,0x90,0xbd,0x50,0x06,0x66,0x40,0x31,0x70,
-0x00,0x00,0xcc,0xc8,0x25,0xaa,0x47,0x20,0x0c,0x01,0xb7,0x6d,0x16,0x3b,0x00,0xc0,
-0x1b,0xc2,0xd0,0x08,0xc2,0x0f,0xcd,0xca,0x0d,0x00,0xc5,0x10,0x0d,0x41,0x06,0xc0,
-0x0a,0x13,0x60,0x55,0x00,0xf0,0x05,0x8c,0xee,0xcc,0xc0,0x47,0x98,0x71,0x0a,0x50,
-0x00,0x02,0x33,0x33,0x4a,0xfb,0xaf,0x00,0x0c,0xcc,0x80,0x82,0x2b,0x81,0x55,0x54,
-0x79,0xd7,0x7f,0x71,0x05,0x55,0x0e,0x45,0xf0,0x17,0xcc,0xc9,0x3d,0xdd,0xdd,0x50,
-0x1c,0x01,0xc3,0xa0,0x00,0x86,0x01,0xc0,0x0c,0x3a,0x00,0x08,0x60,0x1f,0xcd,0xc3,
-0xda,0xaa,0xd6,0x01,0xc0,0x00,0x3b,0x33,0x39,0x60,0x00,0xa0,0x00,0x91,0x00,0x90,
-0x0a,0x2d,0xfb,0x35,0x90,0x2c,0x00,0x6a,0xba,0xa1,0x4c,0x49,0x91,0x01,0x11,0x11,
-0x4d,0x99,0x9c,0x50,0x0c,0xcc,0x74,0x90,0x00,0x75,0x00,0x55,0x53,0x49,0x00,0x07,
-0x50,0x05,0x55,0x33,0xcf,0xcf,0xc4,0x00,0xcc,0xc8,0x01,0xe0,0xe0,0x00,0x0c,0x02,
-0xb0,0x5b,0x0e,0x00,0x00,0xb0,0x1b,0x0b,0x60,0xe0,0x80,0x0f,0xcd,0xb8,0xd0,0x0e,
-0x0c,0x00,0xb0,0x03,0xd2,0x00,0xbd,0xb0,0xb7,0x07,0x11,0x10,0x7c,0x4d,0x82,0x76,
-0x08,0xcc,0xfd,0xcc,0x14,0xcd,0xcb,0x89,0x4d,0x71,0x02,0xdd,0xfe,0xd8,0x00,0xcd,
-0xd7,0xe8,0x0a,0xf6,0x1e,0x33,0x19,0xdc,0xcc,0xcf,0x10,0x9a,0xa5,0x93,0x20,0x20,
+0x00,0x3d,0x84,0x10,0x02,0x89,0x72,0x03,0x10,0x2b,0xb4,0x01,0xf4,0x3f,0x00,0x00,
+0x0a,0x20,0x2f,0xdc,0xcc,0xa0,0x0a,0xcc,0xc6,0xd9,0x22,0x22,0x00,0x01,0x11,0xd5,
+0xcd,0x88,0x8e,0x20,0x00,0x07,0x81,0x3e,0x99,0x9e,0x20,0x00,0x3f,0x6b,0x4b,0x11,
+0x1c,0x20,0x03,0xef,0xe2,0x29,0xf9,0x88,0x10,0x0d,0x4d,0x4a,0x08,0xe9,0x99,0x00,
+0x00,0x0d,0x02,0x9f,0x81,0x9a,0x00,0x00,0x0d,0x04,0x91,0xca,0xc0,0x00,0x00,0x0d,
+0x00,0x38,0xdd,0xc6,0x10,0x00,0x0d,0x09,0xc8,0x10,0x4b,0xc0,0xec,0x02,0xf1,0x10,
+0xdd,0xef,0xde,0xfd,0xdd,0x30,0x02,0x27,0x92,0x6a,0x22,0x10,0x03,0xea,0xcd,0xac,
+0xda,0xbb,0x00,0x3a,0x05,0x80,0x59,0x03,0xb0,0x03,0xec,0xde,0xcd,0xec,0xdb,0x05,
+0x04,0xf1,0x1a,0x00,0x00,0x1d,0xdd,0xee,0xdd,0xdd,0xdd,0x60,0x00,0x7b,0x00,0x07,
+0xa0,0x00,0x00,0x1d,0xd9,0x58,0xc1,0x00,0x00,0x00,0x26,0xde,0xcd,0x94,0x00,0x0b,
+0xdb,0x84,0x00,0x15,0xbb,0x00,0x00,0xce,0xdd,0xdd,0xdf,0x20,0x3b,0x03,0x7f,0xc2,
+0x00,0x00,0xcd,0xcc,0xcc,0xcf,0x0d,0x00,0x03,0xa0,0xbd,0xed,0xde,0xde,0x20,0x00,
+0x00,0x3d,0x00,0xe1,0xc7,0x02,0xf4,0x02,0x80,0x0e,0x10,0x07,0x10,0x19,0xd0,0x00,
+0xe1,0x00,0xc2,0x5e,0x80,0x00,0x0a,0xfe,0xfb,0xf1,0x00,0x12,0x0d,0x07,0x00,0xf0,
+0x13,0xd0,0x09,0xee,0xee,0xb0,0x06,0x7e,0x64,0x93,0x00,0x3b,0x00,0x56,0xe5,0x39,
+0xdc,0xcd,0xb0,0x00,0x0d,0x00,0x93,0x00,0x3b,0x01,0x99,0xf9,0x89,0xdc,0xcd,0xb0,
+0x04,0x6d,0x43,0x1a,0x00,0xf4,0x11,0x05,0xf3,0x08,0xee,0xfe,0xa0,0x00,0x87,0xd1,
+0x09,0x4b,0x20,0x00,0x0d,0x15,0xa0,0xd1,0xb2,0x00,0x07,0x90,0x02,0x89,0x0b,0x24,
+0x51,0xb0,0x00,0xb9,0x00,0x7e,0xd3,0x55,0x00,0x11,0x32,0x06,0x00,0xf4,0x38,0x04,
+0xd0,0x0d,0xdc,0xcd,0xf0,0x16,0x6b,0x71,0xd0,0x00,0x1f,0x01,0x77,0x7e,0x2d,0xcb,
+0xbc,0xf0,0x00,0x07,0x80,0xd0,0x00,0x1f,0x00,0x04,0xf2,0x0d,0xcb,0xbc,0xf0,0x07,
+0xfe,0xb0,0xd0,0x00,0x1f,0x06,0xc4,0xc7,0x6b,0xfd,0xfd,0xc0,0x00,0x2c,0x00,0x0d,
+0x1b,0x30,0x00,0x02,0xc0,0x01,0xc0,0xb3,0x03,0x00,0x2c,0x01,0xc5,0x0b,0x32,0xb0,
+0x02,0xc1,0xd5,0x00,0x6d,0xe6,0x55,0x00,0x11,0x80,0x06,0x00,0xf6,0x37,0x2f,0xcc,
+0x27,0xcf,0xdd,0xd0,0x09,0x50,0xd1,0x01,0xc0,0x1c,0x03,0xf9,0xbd,0x80,0x96,0x04,
+0xa0,0x6e,0x3c,0x2d,0x89,0x09,0xb3,0x00,0xc5,0xc5,0xd0,0xa1,0xe0,0x00,0x0c,0x6c,
+0x5d,0x1f,0xdf,0xdc,0x00,0xc0,0xb0,0xd8,0x60,0xe0,0x00,0x0d,0xbe,0xbe,0x42,0x1e,
+0x11,0x00,0xd2,0xb2,0xd6,0xbb,0xfb,0xb2,0x5a,0x0b,0x0d,0x00,0x0e,0x00,0x08,0x30,
+0x3b,0xa0,0x00,0xe0,0xf1,0x01,0x21,0x02,0xa0,0x07,0x00,0x20,0x0a,0x70,0x7b,0x01,
+0x11,0xdd,0x7b,0x01,0x02,0x01,0x00,0x6e,0x2c,0xcc,0xcc,0xcc,0x70,0x00,0x0d,0x00,
+0x01,0xf7,0x05,0x20,0xdd,0xb0,0x04,0x06,0x21,0x00,0x4b,0x11,0x06,0x84,0x26,0xb0,
+0x00,0x05,0xda,0xaa,0xaa,0xbb,0x20,0x00,0x21,0x06,0x80,0xcb,0x01,0x91,0x0c,0x00,
+0x00,0x1e,0x00,0x01,0xcc,0xcc,0xc2,0xd8,0x01,0x00,0x0d,0x00,0xf0,0x08,0x00,0x7d,
+0xdd,0x92,0x23,0xe2,0x21,0x01,0x11,0x11,0x9c,0xcf,0xcc,0x60,0x47,0x77,0x40,0x01,
+0xe0,0x00,0x05,0xcc,0xc8,0x1a,0x00,0x90,0x76,0x03,0xa0,0x01,0xe0,0x00,0x07,0x60,
+0x2a,0x0d,0x00,0x22,0x7e,0xcd,0x0d,0x00,0x01,0x34,0x00,0x22,0x00,0x53,0xa8,0x00,
+0x60,0xc0,0x07,0xee,0xee,0xd0,0x3c,0xcb,0x02,0x12,0x1d,0x0c,0x03,0x40,0xd0,0x07,
+0xbb,0xb2,0x0d,0x00,0xf1,0x20,0x33,0x33,0x15,0xee,0xee,0xd0,0x06,0x77,0x73,0x59,
+0x00,0x08,0x00,0x7a,0xaa,0x35,0x90,0x00,0x00,0x0b,0x31,0x94,0x59,0x00,0x01,0x30,
+0xb2,0x09,0x45,0x90,0x00,0x49,0x0b,0xcb,0xe4,0x5b,0x11,0x18,0x70,0xb3,0x11,0x01,
+0xbd,0xdd,0xb1,0x00,0x31,0x3d,0x00,0xf4,0x38,0x05,0xa0,0x01,0xfe,0xee,0x00,0x06,
+0x6a,0x64,0x2c,0x00,0xe0,0x00,0x44,0x44,0x36,0x80,0x0e,0x00,0x06,0xcc,0xc7,0xd2,
+0x00,0xad,0x60,0x35,0x55,0x55,0x33,0x33,0x30,0x03,0x55,0x54,0xda,0x99,0xbc,0x00,
+0x7c,0xcc,0x35,0x90,0x0c,0x40,0x09,0x40,0x93,0x0b,0x79,0xa0,0x00,0x94,0x09,0x30,
+0x2f,0xe1,0x00,0x09,0xdc,0xe6,0x8f,0x8a,0xe8,0x20,0x94,0x00,0x9c,0x40,0x06,0xd7,
+0x97,0x03,0x12,0x80,0xe2,0x02,0xa4,0x10,0x7e,0xef,0xee,0xc0,0x7c,0xdc,0xc0,0x00,
+0xc2,0xde,0x05,0x41,0x0c,0xcc,0x70,0xd0,0x0d,0x00,0xf1,0x0b,0x0e,0x0c,0xa8,0x60,
+0x1c,0xcc,0x80,0xe0,0xc8,0x75,0x00,0x22,0x21,0x0e,0x0c,0x20,0x00,0x0e,0xab,0xa0,
+0xe0,0xc2,0x00,0x00,0xc0,0x2a,0x0d,0x00,0xf0,0x06,0x9a,0xa9,0xf9,0xea,0x99,0x00,
+0xd2,0x22,0x44,0x44,0x44,0x40,0x00,0x62,0x00,0x00,0x45,0x00,0x00,0x03,0xb0,0x13,
+0x07,0xf4,0x32,0x18,0x8a,0x87,0xee,0xfe,0xee,0x80,0x33,0x33,0x20,0x3c,0x00,0x00,
+0x07,0xcc,0xc2,0x0c,0x20,0xd1,0x00,0x35,0x55,0x1c,0xeb,0xe6,0x00,0x03,0x55,0x51,
+0x00,0xb7,0x0c,0x10,0x7c,0xcc,0x24,0xc4,0x09,0x60,0x09,0x30,0xa4,0xa1,0x09,0xa0,
+0x00,0x93,0x09,0x20,0x2c,0xbd,0x10,0x09,0xdc,0xe5,0x9f,0x60,0x7d,0x10,0x93,0x00,
+0xda,0x20,0x00,0x96,0x95,0x01,0xf1,0x0d,0xa0,0x00,0x90,0x00,0x93,0x00,0x09,0x50,
+0x09,0x60,0x2d,0x00,0x6a,0xba,0xa3,0x7b,0x59,0x94,0x01,0x11,0x11,0x48,0x8f,0x98,
+0x70,0x0c,0xcc,0x70,0x4e,0x06,0xe0,0x00,0x17,0x7e,0x87,0x30,0x0b,0xbb,0x71,0x88,
+0xf8,0x84,0x00,0x88,0x86,0x68,0x06,0x90,0x1c,0x12,0xba,0xee,0xfe,0xee,0x11,0xb0,
+0x1b,0x0d,0x00,0x90,0x1f,0xcd,0xb0,0x00,0xd1,0x00,0x01,0xb0,0x00,0x0d,0x00,0x22,
+0x01,0x50,0x9f,0x07,0xa0,0x40,0x1d,0xde,0xed,0xe0,0x6c,0xdc,0xc0,0xc1,0xa2,0x47,
+0x03,0xf5,0x28,0x69,0x0c,0x01,0xc0,0x0c,0xcc,0x81,0x09,0x60,0x3a,0x00,0x44,0x42,
+0x1b,0x90,0xbd,0x50,0x06,0x66,0x40,0x31,0x70,0x00,0x00,0xcc,0xc8,0x25,0xaa,0x47,
+0x20,0x0c,0x01,0xb7,0x6d,0x16,0x3b,0x00,0xc0,0x1b,0xc2,0xd0,0x08,0xc2,0x0f,0xcd,
+0xca,0x0d,0x00,0xc5,0x10,0xc0,0x00,0x00,0xcd,0xda,0x8b,0x02,0x13,0x60,0x55,0x00,
+0xfb,0x84,0x8c,0xee,0xcc,0xc0,0x47,0x98,0x71,0x0a,0x50,0x00,0x02,0x33,0x33,0x4a,
+0xfb,0xaf,0x00,0x0c,0xcc,0x80,0x0e,0x00,0xe0,0x00,0x55,0x54,0x79,0xd7,0x7f,0x71,
+0x05,0x55,0x34,0x44,0x44,0x44,0x00,0xcc,0xc9,0x3d,0xdd,0xdd,0x50,0x1c,0x01,0xc3,
+0xa0,0x00,0x86,0x01,0xc0,0x0c,0x3a,0x00,0x08,0x60,0x1f,0xcd,0xc3,0xda,0xaa,0xd6,
+0x01,0xc0,0x00,0x3b,0x33,0x39,0x60,0x00,0xa0,0x00,0x91,0x00,0x90,0x00,0x09,0x50,
+0x06,0x90,0x2c,0x00,0x6a,0xba,0xa1,0x4c,0x49,0x91,0x01,0x11,0x11,0x4d,0x99,0x9c,
+0x50,0x0c,0xcc,0x74,0x90,0x00,0x75,0x00,0x55,0x53,0x49,0x00,0x07,0x50,0x05,0x55,
+0x33,0xcf,0xcf,0xc4,0x00,0xcc,0xc8,0x01,0xe0,0xe0,0x00,0x0c,0x02,0xb0,0x5b,0x0e,
+0x00,0x00,0xb0,0x1b,0x0b,0x60,0xe0,0x80,0x0f,0xcd,0xb8,0xd0,0x0e,0x0c,0x00,0xb0,
+0x03,0xd2,0x00,0xbd,0xb0,0xb7,0x07,0xe1,0x10,0x00,0x0a,0x10,0x00,0x00,0x76,0x08,
+0xcc,0xfd,0xcc,0x14,0xcd,0xcb,0x0d,0x00,0x71,0x00,0x02,0xdd,0xfe,0xd8,0x00,0xcd,
+0x13,0x02,0xf5,0x1f,0x03,0x33,0x19,0xdc,0xcc,0xcf,0x10,0x9a,0xa5,0x93,0x20,0x20,
 0xc1,0x0a,0xcc,0x83,0x1d,0x1c,0x14,0x00,0xd0,0x3a,0x00,0xe0,0xc1,0x00,0x0d,0x03,
 0xa0,0x4c,0x0c,0x15,0x20,0xdc,0xda,0x3e,0x40,0xc1,0x84,0x0d,0x00,0x0e,0x60,0x08,
-0xdd,0x10,0x29,0x6d,0x10,0x92,0x3f,0x07,0x00,0x8e,0x57,0xf1,0x07,0x2a,0xba,0x70,
-0x6d,0x19,0x90,0x00,0x11,0x12,0x9f,0x64,0x4d,0xd4,0x09,0xcc,0xaa,0x58,0x88,0x86,
-0x50,0x00,0x00,0x29,0x1b,0xf1,0x06,0xbb,0x49,0xcd,0xbe,0xbe,0x00,0x67,0x73,0x93,
-0x91,0xb0,0xc0,0x0d,0x37,0x79,0xde,0xdf,0xdf,0x00,0xc0,0x57,0x0d,0x00,0xfa,0x4b,
-0xcd,0x79,0x39,0x1b,0x0c,0x00,0xc0,0x00,0x93,0x81,0xa6,0xa0,0x00,0xa0,0x00,0x83,
-0x0a,0x41,0x00,0x07,0x31,0xbc,0xeb,0x96,0xc0,0x1d,0xdd,0x77,0x44,0x78,0x4a,0x40,
-0x00,0x00,0x57,0x75,0x85,0x10,0x07,0xcc,0x8d,0xdd,0xde,0xed,0x90,0x35,0x51,0x57,
-0x75,0x67,0x21,0x04,0x66,0x1c,0x33,0xc5,0x8b,0x20,0x7b,0xb2,0xcb,0xbc,0x3d,0xa0,
-0x0a,0x28,0x3c,0x00,0xc0,0xf2,0x00,0xa1,0x73,0xcb,0xbc,0x8f,0x08,0x0a,0xcd,0x3c,
-0x00,0xba,0x86,0x90,0xa1,0x00,0x00,0x1b,0x01,0xe4,0xfe,0x00,0xf1,0x30,0x0a,0x26,
-0x60,0x0c,0x10,0x00,0x15,0xd5,0x77,0x45,0xea,0xbb,0x30,0x7c,0x99,0xb8,0xdd,0x1a,
-0x30,0x3e,0xa8,0x78,0x62,0x4d,0xa0,0x00,0x69,0x79,0xb2,0x5c,0xad,0x70,0x02,0x31,
-0x79,0x97,0x10,0x08,0x20,0xaa,0xaa,0xac,0xaa,0xaa,0xa0,0x00,0x38,0x88,0x88,0x88,
-0x60,0x00,0x03,0x88,0x88,0x88,0x86,0x00,0x00,0x49,0x99,0x99,0x99,0x20,0x3c,0x00,
-0xc4,0x03,0x41,0x8b,0x99,0x99,0x99,0x01,0x07,0x10,0x0e,0xb7,0x1f,0xf1,0x16,0xaf,
-0xaa,0xfa,0xad,0x40,0x01,0xa8,0xe8,0x8f,0x88,0xa3,0x00,0x4c,0x9f,0x99,0xf9,0x99,
-0x90,0x00,0x4d,0x40,0x0e,0x01,0x6e,0x00,0xcf,0xa9,0x99,0x99,0xad,0x20,0x00,0xda,
-0x99,0x99,0x9a,0xc0,0x62,0x3a,0xf3,0x0d,0x4c,0x00,0x00,0xd8,0x77,0x77,0x79,0xc0,
-0x00,0x0d,0xa9,0x99,0x99,0xbc,0x00,0x00,0x4a,0x70,0x05,0xb9,0x50,0x00,0xb8,0x20,
-0x00,0x00,0x27,0xa0,0x9f,0x0f,0x50,0xec,0xcf,0x10,0x0d,0x10,0x0d,0x14,0x04,0x0d,
-0x00,0x23,0xdd,0xd2,0x0d,0x00,0x22,0xeb,0xbf,0x1a,0x00,0xfa,0x16,0xd1,0xcd,0xfe,
-0xdc,0x00,0xe0,0x0c,0x1e,0x11,0x13,0xd0,0x0b,0xcc,0xc1,0xe0,0x00,0x1d,0x00,0x68,
-0x49,0x0e,0x00,0x01,0xd0,0x1d,0x20,0xb4,0xeb,0xbb,0xbd,0x04,0x80,0x01,0x0e,0x22,
-0x23,0xd0,0x68,0x08,0x10,0x01,0x84,0x45,0x00,0x92,0x15,0x33,0xfd,0xdd,0xb0,0xf2,
-0x1f,0x02,0xf3,0x0f,0xf0,0x17,0x10,0x22,0x27,0xb2,0x7b,0x22,0x20,0x00,0x83,0x59,
-0x05,0xa3,0x80,0x00,0x1e,0x07,0x80,0x5a,0x0d,0x40,0x0b,0x60,0xb4,0x05,0xa0,0x4d,
-0x02,0x90,0x3e,0x00,0x5a,0x00,0xb3,0x00,0x2e,0x50,0x05,0xa0,0xf5,0x0e,0x21,0x0e,
-0xe6,0x2b,0x29,0x01,0xb7,0x14,0x90,0xb6,0x21,0xbd,0xdd,0xd0,0x08,0xae,0xca,0x40,
-0x0c,0x01,0x10,0xa4,0xd0,0x04,0x90,0x1c,0xce,0xec,0x99,0xdd,0xdd,0x00,0x11,0x68,
-0xb9,0x18,0xf1,0x0e,0x07,0x66,0xa4,0x3b,0x30,0x02,0x20,0x86,0x6c,0x85,0xb3,0x00,
-0x67,0x09,0xb6,0x80,0x08,0xdc,0xce,0x30,0xbc,0xb8,0x00,0x01,0x11,0x00,0x0d,0x2e,
-0xb2,0x4c,0x0d,0x64,0x18,0xde,0xee,0xee,0xe9,0x02,0x77,0x57,0x02,0x6a,0x17,0x90,
-0xe1,0x18,0xdf,0xdd,0xf2,0x0c,0xcf,0xcb,0x00,0x35,0x35,0xf1,0x20,0xe0,0x00,0x79,
-0x00,0xe0,0x3d,0xdf,0xdd,0xac,0x19,0xd9,0x00,0x00,0xc1,0x04,0x54,0x44,0x40,0x0a,
-0x2c,0x10,0x2e,0x99,0x9d,0x00,0xc2,0xcd,0xd4,0xb0,0x01,0xd0,0x0d,0x5c,0x10,0x2b,
-0x00,0x1d,0x00,0xdc,0xd1,0x02,0xcc,0xcc,0xb0,0x1b,0x6f,0x50,0x8f,0x54,0x64,0x4a,
-0xee,0xee,0xee,0xe7,0x01,0x93,0x24,0x90,0xf2,0xdf,0xff,0xff,0x10,0xd0,0x0b,0x2d,
-0x10,0x28,0x07,0x20,0xb2,0xd1,0xaa,0x10,0xf0,0x0d,0xfd,0x2d,0xed,0xde,0xb0,0x00,
-0x1b,0x00,0xd1,0x00,0x2b,0x00,0xd1,0xe9,0x5d,0x10,0x02,0xb0,0x0d,0x1c,0x11,0xde,
-0xee,0xeb,0x00,0xd1,0xb0,0x0d,0x27,0x00,0x30,0x1d,0x87,0xd1,0x33,0x15,0xe0,0xc7,
-0x2d,0x43,0x33,0x31,0x36,0x10,0x00,0x9b,0xbb,0xbb,0x40,0x00,0x0d,0x3f,0x00,0xf5,
-0x33,0x29,0x9e,0x99,0x00,0x0d,0x00,0x14,0x5e,0x44,0x13,0x3e,0x33,0x0b,0xbf,0xb9,
-0x8c,0xaf,0xaf,0x0b,0x0b,0x0c,0x86,0x0d,0x0d,0x0e,0xae,0xac,0x86,0x0d,0x0d,0x0b,
-0x0b,0x0c,0x8a,0x7e,0x7e,0x0c,0xbf,0xba,0x8a,0x6e,0x6e,0x13,0x3d,0x33,0x86,0x0d,
-0x0d,0x49,0x9e,0x99,0x96,0x0d,0x0d,0x00,0x0d,0x00,0x8e,0xdf,0xcf,0x00,0x0d,0x00,
-0x86,0x00,0x0c,0x83,0x27,0x00,0x28,0x29,0xf1,0x1e,0x09,0x9e,0x98,0x11,0x4b,0x11,
-0x00,0x44,0xd4,0x3c,0xcc,0xcc,0xc5,0x09,0xcf,0xb7,0x08,0x40,0x91,0x00,0xc0,0xb2,
-0x92,0xd0,0x05,0xc0,0x0c,0xbe,0xca,0xd7,0x10,0x4a,0x70,0xc0,0xb2,0x93,0x77,0x2d,
-0x10,0x0c,0xbe,0xc9,0x00,0xd9,0x60,0x34,0x00,0x70,0xf0,0x00,0x2d,0xdf,0xdb,0x01,
-0xde,0x0d,0x00,0x92,0x04,0xd6,0x1d,0x91,0x00,0x0d,0x02,0xc3,0x00,0x6e,0x5f,0x02,
-0x22,0x49,0x00,0x6b,0x06,0xf0,0x2c,0xa2,0x5f,0xcc,0xcc,0xe5,0x0b,0x3a,0x77,0xc0,
-0x09,0x07,0x50,0x95,0xab,0x0a,0xcc,0xfc,0xc0,0x06,0x8c,0x73,0x35,0x6e,0x55,0x01,
-0x9d,0xbc,0x6a,0x65,0xd4,0xd0,0x03,0xa5,0x70,0xab,0xae,0xaf,0x00,0x4a,0x57,0x0a,
-0x76,0xe5,0xe0,0x05,0x85,0x83,0x24,0x5d,0x44,0x00,0x85,0xae,0x9d,0xdd,0xfd,0xd7,
-0x0d,0x13,0x6d,0x17,0x21,0x01,0x80,0x64,0x15,0x21,0x09,0x10,0xcc,0x04,0x30,0x5d,
-0x10,0x0c,0x19,0x06,0x14,0x74,0x5e,0x32,0x12,0xe9,0x3e,0x48,0x80,0xd0,0x00,0x08,
-0xee,0x30,0x09,0x68,0x70,0x30,0x91,0x20,0xe0,0x2d,0x07,0x10,0x10,0xb6,0xf3,0x26,
-0x80,0xb3,0xb8,0x00,0x01,0xda,0x00,0x3e,0x74,0x68,0x0b,0xd3,0x3d,0x28,0xb5,0x32,
-0x22,0x45,0x15,0x40,0x02,0x8a,0xbb,0xba,0xa0,0xf8,0x09,0x21,0x70,0x00,0x16,0x61,
-0xb3,0xa0,0x0b,0xbf,0xcb,0xa0,0x00,0x0a,0x31,0xd1,0x11,0x1e,0x68,0x38,0x20,0x03,
-0x55,0x6c,0x15,0x41,0x00,0x48,0xd3,0x1d,0x3f,0x05,0x20,0x31,0xfd,0xd7,0x1d,0x30,
-0xb3,0x1d,0x00,0xb6,0x3a,0x40,0x31,0xd0,0x00,0x09,0x0d,0x00,0x60,0xcc,0xcc,0xd4,
-0x00,0xab,0xc4,0xa9,0x1f,0x6a,0x59,0x01,0x9d,0xdc,0xde,0xff,0xa2,0x4e,0xf1,0x0c,
-0xb2,0x00,0x94,0x00,0x4c,0x00,0x04,0xd1,0x02,0xd0,0x0c,0x40,0x00,0x07,0x46,0xac,
-0xab,0xfa,0x70,0x00,0x00,0x23,0x3a,0x83,0x32,0x05,0xbb,0xca,0x0b,0x20,0x12,0xe1,
-0xe0,0x18,0x00,0x39,0x03,0x11,0xdb,0x60,0x03,0x20,0x5a,0x7c,0x06,0x06,0xf9,0x09,
-0x6e,0x10,0x8b,0x00,0x02,0xf3,0xab,0x10,0x00,0x95,0x02,0xe6,0xd7,0x10,0x00,0x00,
-0x21,0x95,0x01,0x8e,0xfe,0xef,0xff,0x30,0xc6,0x34,0xf0,0x03,0xb2,0x08,0xcc,0xcc,
-0xcf,0x70,0x03,0xd3,0x01,0x99,0x8a,0x40,0x00,0x01,0x08,0xbb,0xcf,0xfb,0xbf,0x58,
-0xc0,0x02,0xb0,0x0d,0x08,0xdf,0x2b,0xcb,0xce,0xbb,0xd0,0x00,0xc2,0x0d,0x00,0x28,
-0x00,0x0c,0x0d,0x00,0x91,0x0e,0x4b,0x30,0x2b,0x5c,0xb0,0x0c,0x6b,0x70,0x03,0x2c,
-0x54,0x06,0xcd,0xcc,0xde,0xf5,0x41,0x10,0x11,0x10,0x6d,0x1d,0xf0,0x0f,0x5c,0x16,
-0xaa,0xbf,0xaa,0xa5,0x00,0x7a,0x12,0x23,0xe2,0x22,0x10,0x00,0x01,0xcc,0xcf,0xcc,
-0xb0,0x04,0x43,0x1d,0x01,0xd0,0x0e,0x01,0xcd,0xb1,0xd0,0x1d,0x55,0x19,0xf0,0x0c,
-0x1c,0xce,0xfd,0xcb,0x00,0x03,0xb0,0x04,0xce,0xc5,0x00,0x00,0x3b,0x08,0xb2,0xd0,
-0xa9,0x00,0x05,0xc6,0x70,0x1d,0x00,0x60,0x05,0xb7,0xa3,0xa8,0x6d,0x64,0xd0,0x03,
-0xad,0xdc,0xde,0xf8,0x0d,0x0f,0x20,0x20,0x9d,0x87,0x0e,0x50,0x2b,0x49,0xcb,0xbb,
-0xbb,0x9c,0x2c,0xf0,0x12,0x74,0x01,0xc0,0x01,0x22,0x09,0x44,0xb1,0x99,0x10,0x5c,
-0xf1,0xa7,0x99,0xf9,0x99,0x00,0x0d,0x1b,0x38,0x8f,0x88,0x50,0x00,0xd1,0xd0,0x11,
-0xe1,0x11,0x00,0x0d,0x4b,0x9b,0x5a,0x1a,0x20,0xe8,0x50,0x45,0x09,0x20,0xbb,0xd5,
-0x73,0x13,0x6a,0x78,0x01,0x8d,0xdd,0xdd,0xef,0x89,0x1d,0xc0,0x9a,0x00,0xdc,0xbb,
-0xcd,0x00,0x00,0x75,0x0d,0xba,0x51,0xd0,0x34,0x01,0xf0,0x0d,0x38,0x1d,0x00,0x48,
-0x80,0x6e,0x89,0xc8,0xe6,0x03,0x5e,0x1d,0x44,0x44,0x45,0xd0,0x00,0xd1,0xd0,0xaa,
-0xaa,0x0d,0x00,0x0d,0x1d,0x0b,0x00,0xc0,0x0d,0x00,0xc0,0xc9,0x99,0x0d,0x00,0x2e,
-0x2d,0x05,0x00,0x4c,0xa0,0x2c,0x3b,0xf9,0x4b,0x74,0x29,0x40,0x07,0xde,0xde,0xef,
-0xf7,0x77,0x29,0x00,0x55,0x3f,0xc0,0x00,0x00,0xb8,0x3c,0xcc,0xed,0xcc,0xc4,0x00,
-0xb2,0x04,0xa0,0xf9,0x0d,0xf0,0x02,0x0a,0xcf,0xcc,0xfc,0xa0,0x00,0x00,0xd1,0x28,
-0x62,0x1d,0x06,0xee,0x1d,0x37,0xba,0x73,0x48,0x00,0x22,0x7c,0xb7,0x55,0x00,0x10,
-0xb0,0x0d,0x00,0xf3,0x08,0xca,0xa8,0x0d,0x00,0x2f,0x5c,0x02,0x00,0x6d,0x90,0x2d,
-0x39,0xa3,0x21,0x11,0x23,0x24,0x50,0x03,0x9b,0xcc,0xcb,0xb4,0x9b,0x01,0xf5,0x38,
-0xd3,0x0e,0xab,0x6d,0xaa,0xc0,0x02,0xd2,0xea,0xb5,0xda,0xaa,0x00,0x00,0x0d,0x55,
-0x8c,0x54,0x91,0x00,0x00,0x24,0xc1,0x3b,0x43,0x06,0xee,0x05,0x5e,0x57,0xd5,0x40,
-0x00,0xd0,0x45,0xe5,0x6d,0x53,0x00,0x0d,0x5a,0xaf,0xab,0xea,0xa2,0x00,0xd1,0x14,
-0xb2,0x5b,0x31,0x00,0x0e,0x37,0xd3,0x00,0x4d,0x60,0x0b,0xbc,0xa1,0x00,0x00,0x13,
-0x06,0xa0,0x06,0xcd,0xdd,0xde,0xf4,0x5d,0x36,0x11,0x50,0x82,0x04,0xf2,0x0e,0x4d,
-0x11,0x0a,0xed,0xf3,0x08,0xcb,0xbc,0xc4,0xa2,0x1e,0x00,0x0b,0x30,0x79,0x0a,0x27,
-0x70,0x00,0x59,0x0d,0x20,0xa2,0xd1,0x01,0xde,0xee,0xfd,0x9a,0x7c,0x4d,0x20,0xa2,
-0x2c,0xa2,0x1d,0xf0,0x06,0x0a,0x20,0xc1,0x05,0x90,0x00,0xe0,0xa2,0x0d,0x20,0x59,
-0x00,0x0e,0x0a,0x7d,0xa0,0x05,0xec,0xcc,0xf0,0xa2,0xd5,0x21,0x26,0x0d,0x0a,0x9e,
-0x02,0x20,0x7c,0x99,0x76,0x10,0xf1,0x00,0x07,0xc8,0x88,0x88,0x9d,0x00,0x00,0x59,
-0x88,0x88,0x88,0x90,0x00,0xbb,0xbb,0xff,0x27,0xf3,0x10,0x46,0x66,0x66,0x66,0x61,
-0x00,0x0b,0x63,0x3d,0x53,0x3c,0x30,0x00,0xba,0x99,0xea,0x99,0xe3,0x00,0x07,0x87,
-0x7e,0x87,0x7a,0x20,0x00,0xaa,0xaa,0xeb,0xaa,0xa5,0x40,0x5c,0x10,0x1b,0x41,0x18,
-0x23,0xbb,0x60,0xcb,0x5b,0xf2,0x33,0x0b,0xd3,0x0a,0xcc,0xcd,0xa0,0x0a,0x72,0xb6,
-0x25,0x55,0x7a,0x05,0xdc,0xcb,0x01,0x33,0x36,0xa0,0x00,0x48,0x03,0x88,0x88,0xad,
-0x40,0x15,0x81,0x49,0x9e,0xa9,0x95,0x2b,0xcd,0xb3,0x80,0xc1,0x07,0x30,0x54,0x77,
-0x07,0x9c,0x5b,0x80,0x0a,0x48,0xb0,0x07,0xfe,0x70,0x00,0x75,0x86,0x1a,0x9c,0x3d,
-0x60,0x16,0xbe,0xba,0x60,0xc1,0x19,0x82,0x73,0x7d,0x59,0x20,0x0d,0xdc,0xf6,0x21,
-0x61,0x00,0xda,0xaa,0xaa,0xa6,0x00,0x93,0x06,0x10,0x10,0x60,0x40,0x23,0xcc,0xc7,
-0xf9,0x3a,0x10,0x01,0x4b,0x3c,0x20,0xdd,0xd6,0xc8,0x4f,0x00,0x3e,0x03,0x40,0xe0,
-0x02,0xd6,0xc6,0xa1,0x05,0xf0,0x40,0x25,0xf6,0x00,0x00,0x05,0xfa,0xdb,0x22,0xbd,
-0x83,0x00,0x48,0x30,0x00,0x00,0x27,0x30,0xdc,0xbc,0xb2,0xfb,0xbc,0xdd,0xba,0xcb,
-0x2e,0xaa,0xbd,0xd1,0x03,0xb2,0xc0,0x01,0xdd,0xcb,0xcb,0x2f,0xbb,0xcd,0xd2,0x11,
-0x00,0x11,0x12,0xdd,0x1b,0xed,0xcf,0xc6,0x1d,0xd1,0x08,0x50,0xd0,0x01,0xdd,0x3d,
-0xee,0xdf,0xda,0x1d,0xd1,0x0b,0x10,0xd0,0x01,0xdd,0x13,0xc0,0x0d,0x00,0x1d,0xd1,
-0xb2,0x00,0xd0,0xee,0x80,0xec,0xd0,0x40,0x70,0xee,0xbb,0xbd,0x0f,0xbb,0xbe,0xe1,
-0xd0,0x40,0x11,0xee,0xd0,0x40,0x02,0x0f,0x1c,0x90,0x10,0xeb,0xbb,0xc0,0x1e,0xe1,
-0x0d,0x00,0x0d,0x61,0x40,0x24,0xbc,0xd0,0x0b,0x00,0xb1,0xfc,0xcc,0xa0,0x1e,0xe1,
-0x06,0x00,0x01,0xfe,0x90,0x00,0x8c,0x41,0xf0,0x0b,0xfd,0xe9,0x00,0x5f,0x70,0x00,
-0xd0,0xa3,0x05,0xd2,0xa9,0x00,0xd1,0xc1,0xbb,0x10,0x08,0xd3,0xd5,0x91,0x5d,0xde,
-0xdd,0x51,0xd0,0xb3,0xbb,0x0a,0xf6,0x13,0xd0,0x59,0x77,0x7e,0x97,0x72,0xd0,0x6a,
-0x66,0x6d,0x76,0x62,0xd9,0xd3,0x1a,0x0c,0x2b,0x10,0xd0,0x00,0x96,0x0c,0x24,0xc0,
-0xd0,0x04,0xb0,0x0c,0x20,0x94,0xd0,0x00,0x05,0xdd,0x4f,0x12,0x20,0x40,0x83,0x01,
-0x02,0xf1,0x1a,0xf8,0x7a,0xc7,0x77,0x30,0x02,0xe8,0x44,0xa8,0x44,0x42,0x01,0xec,
-0xca,0xad,0xca,0xaa,0x00,0x02,0x99,0x55,0xb9,0x55,0x50,0x00,0x09,0x95,0x5b,0x95,
-0x55,0x00,0x00,0x9d,0xcc,0xed,0xcc,0xcb,0x00,0x04,0x20,0x0b,0x3a,0x07,0x20,0xce,
-0xfe,0x2d,0x17,0xf4,0x03,0x1a,0x9f,0x8c,0x30,0x00,0x03,0x9d,0x40,0xe0,0x3c,0xc6,
-0x11,0xb5,0x00,0x0e,0x00,0x03,0x93,0x55,0x00,0x40,0xa3,0x00,0x0b,0x47,0x61,0x07,
-0xf0,0x25,0xa2,0xc0,0xd0,0x00,0x64,0x57,0x63,0x8d,0x9b,0x92,0x08,0x3a,0xb7,0x7f,
-0x83,0xe3,0x10,0x87,0x76,0x98,0xd6,0x0d,0x00,0x08,0xcb,0xbd,0x47,0xec,0xfc,0x10,
-0x00,0x84,0x00,0x76,0x0d,0x00,0x0e,0xdf,0xdd,0xb7,0x60,0xd0,0x00,0xc2,0x96,0x0b,
-0x7e,0xdf,0xd1,0x0c,0x9a,0xa6,0x0d,0x00,0xe0,0xc0,0x00,0x2b,0x7d,0xcf,0xc5,0x0c,
-0x00,0x3b,0x67,0x71,0x11,0x00,0x2c,0x17,0x10,0xd1,0x20,0x98,0x88,0x8f,0x88,0x88,
-0x90,0xd4,0x99,0x3e,0x39,0x93,0xe0,0x9b,0x3d,0xf0,0x11,0xa0,0x08,0xcc,0x4e,0x4c,
-0xc8,0x00,0x09,0xbb,0xbe,0xbb,0xba,0x00,0x0d,0x32,0x3e,0x22,0x2e,0x00,0x0d,0x87,
-0x7e,0x77,0x7e,0x00,0x0d,0xbb,0xbf,0xbb,0xbe,0x32,0x0b,0x24,0x00,0x10,0x85,0x55,
-0x10,0x23,0xcc,0xd1,0x05,0x08,0x10,0x4c,0x49,0x00,0x31,0x60,0x00,0x89,0xa1,0x08,
-0x71,0x02,0x22,0x2f,0x22,0x22,0x00,0x2c,0x05,0x08,0x12,0x20,0xc9,0x24,0xf1,0x04,
-0x00,0x5e,0xbb,0xbb,0xbd,0x70,0x00,0x05,0xb5,0x55,0x55,0xa7,0x00,0x00,0x5b,0x44,
-0x44,0x4a,0x70,0x1d,0x0d,0x11,0xd7,0xc0,0x37,0x11,0x07,0x5a,0x20,0x20,0x4c,0xc4,
-0xcf,0x0c,0x23,0x1e,0x00,0x06,0x00,0x68,0xaf,0xff,0xc0,0x1f,0xff,0xf8,0x12,0x00,
-0x68,0x7e,0xee,0xc0,0x1f,0xee,0xe4,0x12,0x00,0x68,0xee,0xef,0xc0,0x1f,0xff,0xfc,
-0x12,0x00,0x03,0x06,0x00,0x03,0x0b,0x3c,0x03,0x00,0x1b,0x20,0x6b,0x00,0xda,0x15,
-0xff,0x08,0xad,0xda,0xaa,0xa6,0x00,0x97,0x3d,0x43,0x6c,0x37,0x90,0x09,0x50,0xd0,
-0x03,0xa0,0x59,0x00,0x95,0x0d,0xcc,0xda,0x05,0x0d,0x00,0x02,0x91,0x9d,0xcf,0xcc,
-0xde,0xcd,0x90,0x09,0x61,0x11,0xde,0x32,0x10,0x0d,0x4c,0x15,0xf0,0x2b,0x01,0x88,
-0xf8,0x76,0xcf,0xcc,0x40,0x05,0x6e,0x55,0x03,0xa0,0x84,0x00,0x79,0xf9,0x6a,0xcc,
-0xcc,0xc2,0x0c,0x33,0x6a,0x29,0x99,0x96,0x00,0xcb,0xbc,0xa3,0xa1,0x15,0xa0,0x0c,
-0x00,0x3a,0x3d,0x99,0xba,0x00,0xbd,0xed,0x90,0x22,0xe2,0x10,0x00,0x1e,0x00,0x8c,
-0xcf,0xcc,0x23,0xbc,0xfb,0xb2,0xa0,0xe0,0x41,0x00,0x31,0x3c,0xcf,0xcc,0x62,0x27,
-0x1e,0xe0,0x1a,0x60,0x10,0x10,0xfa,0x1a,0x20,0xdd,0xfe,0x8a,0x13,0x10,0x58,0x99,
-0x3b,0x00,0x76,0x3e,0x30,0x97,0x00,0x01,0xeb,0x12,0x12,0xdd,0x71,0x5b,0x01,0x21,
-0x00,0x00,0x20,0x00,0x10,0x4a,0x00,0x0d,0x00,0xfc,0x3f,0x11,0xbb,0x73,0x37,0x00,
-0x46,0x12,0x30,0x04,0xb1,0x11,0x4e,0x2d,0x11,0x4e,0x2e,0x1a,0x03,0xa2,0x08,0x90,
-0xc0,0x60,0xb9,0xdd,0xfd,0xd3,0x0c,0x0b,0x0b,0x24,0x00,0xc0,0xc0,0xb0,0xb4,0xdb,
-0xbb,0xe0,0x0c,0x0b,0x0b,0x49,0x00,0x0e,0x0d,0x00,0x20,0xd9,0x99,0x0d,0x00,0x30,
-0x4a,0x22,0x2e,0x0d,0x00,0x21,0xc8,0x88,0x0d,0x00,0xf0,0x08,0x33,0x3e,0x00,0xc0,
-0xb0,0xb2,0x78,0x78,0x60,0x49,0x00,0x0b,0x0a,0x80,0xd5,0x07,0x40,0x00,0xcc,0x90,
-0x01,0xd4,0x10,0x4b,0x55,0x23,0x02,0x10,0x1e,0x64,0xf3,0x39,0x6c,0x9a,0xb5,0xbc,
-0xfb,0xb5,0x06,0xda,0xbb,0x07,0x9d,0x88,0x00,0x66,0x02,0xb0,0xd2,0x22,0xe0,0x04,
-0xbb,0xb8,0x0e,0xaa,0xae,0x00,0x22,0x22,0x21,0xd0,0x00,0xe0,0x19,0x9d,0xa9,0x6e,
-0xaa,0xae,0x00,0x35,0xa1,0x00,0xd5,0x55,0xe0,0x06,0x7a,0xcb,0x26,0xa6,0x95,0x00,
-0x8d,0xb1,0x02,0xc6,0x06,0xb0,0x0b,0x5f,0x51,0xa4,0x00,0x05,0x42,0xb0,0x18,0xcd,
-0xdc,0xcc,0xd7,0x01,0x2e,0x0b,0x00,0xfb,0x37,0xf5,0x33,0x94,0x00,0x00,0x47,0x64,
-0x0a,0xd9,0x00,0x08,0xdb,0x59,0x50,0x6b,0xa9,0x00,0x3a,0x40,0x95,0x01,0xe1,0x40,
-0x02,0xb6,0x2a,0x72,0x26,0xdd,0x03,0xbe,0xcb,0xed,0xbe,0x32,0x40,0x00,0xc2,0x09,
-0x50,0x97,0xc3,0x00,0x0e,0x00,0x95,0x07,0xdc,0x30,0x03,0xc0,0x09,0x50,0x3c,0x17,
-0x00,0xc4,0x00,0x95,0x00,0xd3,0x53,0x49,0x00,0x09,0x50,0x03,0xce,0xc6,0x32,0x00,
-0x82,0x0d,0xa0,0x01,0x88,0x88,0x8f,0x98,0x88,0x81,0x04,0x44,0x44,0x0a,0x0d,0x51,
-0x03,0xeb,0xbb,0xbb,0xe4,0x5d,0x39,0x21,0x0a,0x40,0x55,0x47,0x50,0xb3,0x00,0x06,
-0x99,0x99,0x19,0x28,0xf1,0x03,0xb6,0x33,0x33,0x33,0x36,0xb0,0x0b,0x35,0xeb,0xbb,
-0xe2,0x3b,0x00,0xb3,0x59,0x00,0x0b,0x23,0x0d,0x00,0x97,0xb1,0x3b,0x00,0xb3,0x12,
-0x00,0x00,0x6c,0x70,0x05,0x41,0x70,0x16,0xaf,0xf0,0x00,0x00,0x03,0x7c,0xfc,0x1e,
-0x21,0x06,0xef,0x03,0x1f,0x50,0x0b,0xff,0xff,0xfe,0xac,0x07,0x00,0x90,0xd8,0x30,
-0x09,0xf0,0x00,0x0b,0xf1,0x00,0x00,0x07,0x00,0x1b,0xe0,0x07,0x00,0xf0,0x05,0x3d,
-0xff,0xf0,0x03,0x6c,0xe0,0x00,0xcf,0xff,0xf0,0xaf,0xff,0xe0,0x00,0x5f,0xff,0x80,
-0xdf,0xff,0xd0,0x0f,0x28,0x31,0x2a,0xda,0x20,0xb4,0x10,0xe0,0x9c,0xcc,0xcc,0xcc,
-0x40,0x8f,0xdf,0xb7,0x77,0x77,0xfe,0xdf,0xd0,0xc7,0x80,0x62,0xf0,0x07,0xde,0x8e,
-0x70,0x00,0x00,0xdb,0x8e,0xe5,0xdb,0x77,0x77,0x7f,0x95,0xed,0x1c,0xeb,0xbb,0xbb,
-0xf6,0x1d,0xfc,0xf7,0x55,0x05,0x10,0xfd,0x07,0x4e,0xa0,0xd5,0x0d,0xfa,0xe9,0x33,
-0x33,0x3e,0xca,0xfc,0x3d,0x7f,0x34,0x30,0x3c,0x35,0x52,0x17,0x2d,0x31,0x3f,0xff,
-0xc6,0x8f,0x34,0x20,0xfc,0x6f,0x05,0x00,0x80,0xee,0x94,0xee,0xee,0xee,0xec,0x34,
-0x42,0x00,0x01,0x0f,0x1a,0x00,0x14,0x31,0xfd,0xff,0xa4,0x9a,0x68,0x10,0x00,0x2c,
-0x17,0x02,0x8a,0x3c,0x12,0xfc,0x49,0x22,0x21,0x90,0x50,0x06,0x00,0x20,0xaf,0xc0,
-0x06,0x00,0xa0,0x0c,0xff,0xc0,0x2e,0xff,0x90,0x00,0x1c,0xff,0xce,0x59,0x37,0x12,
-0x1c,0x5f,0x37,0x35,0x1c,0xff,0x90,0x14,0x63,0x01,0xee,0x04,0xf0,0x18,0xf5,0x00,
-0x06,0xf8,0xdf,0xf5,0x06,0xff,0xc2,0xef,0xf9,0xff,0xd1,0x02,0xef,0xff,0xd1,0x00,
-0x08,0xff,0xf7,0x00,0x06,0xff,0xff,0xf5,0x06,0xff,0xe4,0xef,0xf5,0xef,0xe1,0x02,
-0xef,0xd4,0xa1,0x00,0x02,0xeb,0x46,0x11,0x50,0xcd,0x3e,0xf0,0x1e,0xbf,0x40,0x30,
-0x00,0x01,0xcf,0x1b,0xf4,0x7f,0x80,0x00,0xbf,0xd0,0xbf,0x45,0xff,0x40,0x4f,0xe1,
-0x0b,0xf4,0x07,0xfd,0x09,0xf8,0x00,0xbf,0x40,0x0e,0xf2,0xcf,0x40,0x0b,0xf4,0x00,
-0xbf,0x4b,0xf4,0x00,0x9e,0x30,0x0b,0xf4,0x9f,0x80,0x32,0x4a,0x20,0x23,0xff,0xb3,
-0x66,0xd0,0xc0,0x0a,0xfe,0x40,0x01,0x8f,0xf4,0x00,0x0c,0xff,0xed,0xff,0xf6,0x2c,
-0x6c,0x21,0xff,0xc3,0x69,0x3a,0x26,0x10,0x00,0x08,0x61,0x20,0xff,0xf3,0xc2,0x01,
-0xb2,0x3f,0xff,0x70,0x11,0x00,0x7f,0xbf,0xff,0xff,0xce,0xb0,0x0f,0x41,0xf1,0x14,
-0x53,0xff,0xff,0x82,0x5f,0xff,0xf7,0x03,0xff,0xc0,0x00,0x7f,0xf8,0x00,0x3f,0xfa,
-0x00,0x06,0xff,0x70,0x2c,0xff,0xf4,0x01,0xdf,0xfe,0x42,0xff,0xff,0xfe,0xff,0xff,
-0xf6,0x0a,0xff,0x10,0x01,0x60,0x05,0x07,0xff,0xfa,0x13,0x20,0xb5,0x5a,0x11,0x40,
-0x67,0x6a,0x02,0xd8,0x0f,0x40,0x25,0x00,0x36,0x20,0x91,0x3e,0x30,0xfc,0x1a,0xf6,
-0x62,0x31,0xf0,0x15,0xe9,0xfe,0xcf,0x60,0x00,0x00,0xaf,0xc3,0x64,0xff,0xf6,0x00,
-0x01,0xcf,0xa3,0xef,0xa3,0xdf,0x90,0x03,0xef,0x75,0xff,0xff,0xc3,0xcf,0xb0,0xdf,
-0x48,0xff,0xff,0xff,0xe3,0x9f,0x72,0x27,0x4f,0x00,0x60,0xf2,0x50,0x00,0x9f,0xff,
-0xcb,0x02,0x0a,0x40,0x09,0xff,0xf1,0x07,0x9a,0x00,0xd0,0x9f,0xff,0x10,0x7f,0xff,
-0x30,0x00,0x07,0xff,0xe0,0x06,0xff,0xf2,0xde,0x03,0x12,0x54,0xe8,0x31,0x21,0xff,
-0x10,0xcb,0x12,0x2d,0xff,0x20,0x07,0x00,0x50,0x47,0x8f,0xff,0x87,0x40,0x39,0x00,
-0x00,0x7c,0x01,0x00,0xd5,0x60,0x11,0xfa,0x32,0x5f,0x00,0xd4,0x7a,0xf2,0x03,0x46,
-0x66,0x3a,0xfa,0x36,0x66,0x50,0xff,0xff,0xf4,0x54,0xff,0xff,0xf2,0xff,0xff,0xff,
-0xcf,0x07,0x00,0x51,0xff,0xf3,0xb8,0xf2,0x9b,0x16,0x08,0xa1,0xa0,0x00,0x08,0xaa,
-0xaa,0xaa,0xa4,0x00,0x00,0x08,0x8f,0x00,0x30,0x00,0x03,0xfb,0x58,0x00,0x40,0xd0,
-0x00,0xdf,0x10,0x7d,0x5c,0x31,0x80,0x8f,0x60,0xf2,0x6d,0x10,0x3f,0xbd,0x3e,0xc1,
-0x9e,0xee,0xf9,0xff,0xff,0xfc,0x44,0x5f,0xff,0xff,0xaf,0xff,0x01,0x00,0x22,0xfa,
-0xff,0x01,0x00,0x12,0x9a,0x07,0x00,0x10,0xf5,0x19,0x03,0x00,0xae,0x1a,0xf0,0x0c,
-0x6d,0xff,0xfb,0x40,0xcf,0x00,0xbf,0xfd,0xbd,0xff,0xac,0xf0,0xbf,0xd3,0x00,0x03,
-0xcf,0xff,0x4f,0xd1,0x00,0x07,0xaa,0xff,0xf9,0xf5,0x00,0x51,0x7a,0x11,0x01,0xe0,
-0x24,0x03,0xfc,0x09,0x01,0xae,0x00,0x21,0x4f,0x9f,0x60,0x8f,0xf0,0x04,0xf4,0xff,
-0xfb,0x20,0x00,0x3c,0xfb,0x0f,0xcb,0xff,0xca,0xcf,0xfc,0x10,0xfc,0x05,0xcf,0xff,
-0xd7,0x6e,0x0c,0x01,0xbd,0x01,0x00,0xc7,0x57,0xb4,0x06,0xf7,0x01,0x16,0xff,0x8f,
-0xff,0xff,0xf8,0xff,0xff,0x07,0x00,0xb2,0x8a,0xcc,0xef,0xf8,0x00,0x02,0xef,0x80,
-0x00,0x02,0xe7,0xf3,0x0b,0x01,0x7e,0x69,0x70,0x6f,0x70,0x00,0x01,0x16,0xff,0x80,
-0x3c,0x48,0x70,0x82,0xb1,0xff,0xff,0xff,0x80,0xc9,0x05,0x00,0xa0,0x9b,0xff,0xff,
-0xff,0x82,0xf3,0xbd,0xdf,0xff,0x80,0x0a,0x88,0x13,0x80,0xd2,0x66,0x0c,0x6b,0x63,
-0x22,0x04,0xc2,0x6d,0x00,0xa0,0x0b,0xe1,0x00,0x00,0x06,0xf7,0x00,0xb7,0x0c,0xb0,
-0x4b,0x00,0xb0,0x05,0xf5,0x2f,0x3f,0xff,0xff,0xf8,0x2c,0x17,0xd0,0xb8,0x4b,0x00,
-0xb1,0xba,0x2f,0x18,0xbf,0xff,0xff,0xf8,0x09,0xb1,0xf2,0x7b,0x55,0x00,0x30,0x5e,
-0x0a,0x9a,0x89,0x00,0x30,0x2e,0x80,0xe4,0x8d,0x00,0x40,0x0c,0xa0,0x8d,0x00,0x91,
-0x00,0x31,0x10,0x7f,0x30,0x5f,0x00,0x24,0x4f,0x40,0x36,0x04,0x11,0x9f,0x29,0x01,
-0x32,0x9f,0xf9,0xbf,0x29,0x38,0x20,0xdf,0xff,0x4d,0x00,0x90,0x0d,0xff,0xf8,0xaf,
-0xff,0xff,0x9b,0xff,0xf8,0x1d,0x01,0x80,0x6d,0xf8,0x00,0x00,0xcf,0xff,0x40,0x17,
-0xc9,0x01,0x11,0xa0,0xc8,0x01,0x10,0xfd,0x88,0x2d,0x22,0xad,0xfa,0x72,0x01,0x02,
-0x3f,0x63,0x20,0x6f,0x50,0x8b,0x68,0x00,0x1b,0x30,0x10,0xf3,0xb8,0x32,0x10,0xc0,
-0x68,0x6a,0x10,0x70,0xd4,0x63,0x10,0x2a,0xd1,0x62,0xf0,0x28,0xef,0xef,0xff,0xff,
-0xdf,0xb7,0xff,0xff,0xfe,0xce,0x2d,0xff,0xff,0xb5,0xfc,0x36,0xff,0xf3,0x07,0xff,
-0xff,0xf6,0x00,0x02,0x89,0x72,0x00,0x06,0x40,0x00,0x02,0x42,0xfa,0x00,0x03,0xef,
-0x2f,0xa0,0x04,0xff,0xf2,0xfa,0x05,0xff,0xff,0x2f,0xa6,0xff,0xff,0xf2,0xfe,0xff,
-0xff,0xff,0x2f,0xff,0x01,0xf1,0x04,0xfc,0xdf,0xff,0xff,0x2f,0xa1,0xdf,0xff,0xf2,
-0xfa,0x01,0xcf,0xff,0x2f,0xa0,0x00,0xbf,0xf2,0xf9,0x1d,0x83,0x00,0x01,0x72,0x02,
-0x95,0x67,0x12,0xc3,0xb5,0x01,0x00,0xc9,0x5f,0x02,0x91,0x44,0x00,0x14,0x03,0x21,
-0x40,0x00,0x9d,0x00,0x21,0x10,0xff,0x44,0x02,0x11,0xff,0x61,0x02,0x01,0x27,0x67,
-0x11,0x50,0xe1,0x00,0x00,0x1e,0x00,0x10,0xb2,0x2a,0x00,0x10,0xd4,0x36,0x00,0x01,
-0xa1,0x0b,0x11,0x48,0xd4,0x01,0xff,0x03,0x26,0x66,0x10,0x16,0x66,0x30,0xef,0xff,
-0xc0,0xaf,0xff,0xf1,0xff,0xff,0xe0,0xbf,0xff,0xf2,0x06,0x00,0x19,0xb0,0xd0,0xbf,
-0xff,0xf2,0xaf,0xff,0x80,0x6e,0xff,0xc0,0x26,0xa1,0x7c,0x21,0x50,0xef,0x29,0x31,
-0x11,0xff,0x4d,0x67,0x0f,0x06,0x00,0x1c,0x11,0xf5,0xd2,0x02,0xf3,0x09,0xd1,0x05,
-0x00,0x00,0x06,0x45,0xfb,0x00,0x01,0xfc,0x6f,0xfc,0x10,0x1f,0xc6,0xff,0xfd,0x11,
-0xfc,0x6f,0xff,0xfd,0x3f,0xc6,0x12,0x05,0x00,0x1d,0x05,0xf5,0x04,0xfa,0xfc,0x6f,
-0xff,0xf7,0x1f,0xc6,0xff,0xf6,0x01,0xfc,0x6f,0xf5,0x00,0x1f,0xc3,0xe4,0x00,0x00,
-0x17,0x17,0x12,0x52,0x7e,0x63,0x01,0x2b,0x2c,0x30,0x9f,0xff,0xd1,0xcd,0x5f,0x10,
-0xff,0x07,0x00,0x00,0x3b,0x00,0x31,0xc0,0x00,0x5f,0xcf,0x68,0x11,0x0e,0x6f,0x00,
-0x20,0x40,0x8e,0x4f,0x1b,0x22,0xc1,0x02,0x8d,0x06,0x02,0x82,0x00,0x12,0x0f,0x94,
-0x45,0x01,0x45,0x64,0x22,0xe3,0x00,0x2e,0x6b,0xc1,0xf2,0x00,0x00,0xbf,0xf2,0x00,
-0x0b,0xff,0x30,0x00,0xbf,0xf3,0x07,0x00,0xb4,0x2f,0xf9,0x00,0x00,0x06,0xff,0x80,
-0x00,0x00,0x6f,0xf8,0x09,0x00,0x10,0xf4,0x57,0x6f,0x10,0x01,0x2c,0x16,0x00,0xc1,
-0x4d,0x62,0xfc,0x00,0x00,0x02,0xef,0xc0,0xab,0x05,0x01,0x09,0x00,0x20,0x7f,0xf4,
-0xc8,0x04,0x31,0x00,0x6f,0xf7,0x07,0x00,0x24,0x2f,0xf7,0x86,0x62,0x11,0x17,0x94,
-0x02,0x2f,0x8f,0xe0,0x06,0x00,0x01,0x15,0xdf,0xc1,0x01,0x8f,0xff,0xf5,0x36,0x66,
-0xbf,0xf6,0x66,0x50,0x2a,0x00,0x01,0x23,0x4d,0x90,0xef,0x69,0x09,0x30,0x00,0x10,
-0x35,0x79,0x60,0x70,0x40,0x00,0x00,0x5a,0xcd,0xc8,0x20,0x92,0x7f,0xf0,0x2a,0xd7,
-0x69,0xff,0x90,0x00,0x04,0xff,0xa0,0x01,0x02,0xef,0xc1,0x02,0xff,0xf1,0x02,0xfc,
-0x16,0xff,0xb0,0xcf,0xfb,0x05,0xaf,0xf9,0x1f,0xff,0x6d,0xff,0xb1,0xff,0xff,0xb1,
-0xff,0xf7,0x4f,0xfe,0x0b,0xff,0xf5,0x5f,0xfc,0x00,0x6f,0xf9,0x08,0xa5,0x1d,0xfd,
-0x20,0x00,0x5e,0xfb,0x53,0x6e,0xfb,0x10,0x58,0x34,0x23,0xfe,0xa4,0x18,0x18,0x00,
-0x0b,0x09,0x04,0xd1,0x0e,0x60,0x3e,0xf9,0x05,0xac,0xdb,0x71,0x9a,0x64,0x60,0xff,
-0xfd,0x76,0xaf,0xf7,0x00,0xbb,0x04,0xf0,0x20,0x31,0x30,0x4f,0xfa,0x00,0x00,0x32,
-0x04,0xef,0xbf,0xc0,0x9f,0xf8,0x00,0x0e,0xf5,0x02,0xcf,0xff,0x64,0xff,0xf3,0x01,
-0xff,0xf6,0x00,0x9f,0xf8,0x4f,0xff,0x40,0x06,0xff,0xc0,0x00,0x6f,0xeb,0xff,0xa0,
-0x00,0x09,0xff,0x60,0x00,0x3e,0xff,0xc0,0x9e,0x4f,0x40,0xa4,0x30,0x1b,0xfb,0x43,
-0x50,0x54,0x8d,0xff,0x80,0x08,0xfe,0x46,0x7d,0x27,0xef,0x20,0xf9,0x45,0x23,0x01,
-0x40,0xd4,0x11,0x03,0xf6,0x0e,0x22,0x7f,0xff,0x4a,0x5c,0x12,0xff,0x99,0x03,0x12,
-0x0a,0x96,0x33,0x51,0x00,0x3f,0xf5,0x1a,0xfd,0x7e,0x64,0x30,0xf4,0x0a,0xff,0x0e,
-0x58,0x50,0xff,0xf5,0x0a,0xff,0xe1,0xd5,0x69,0x40,0xf6,0x0b,0xff,0xf9,0x04,0x02,
-0xf2,0x08,0xfd,0x8f,0xff,0xff,0x20,0x02,0xff,0xff,0xf3,0x09,0xff,0xff,0xb0,0x0a,
-0xff,0xff,0xf7,0x1c,0xff,0xff,0xf4,0x0e,0xff,0x2d,0x3c,0x30,0x04,0x9a,0xaa,0x01,
-0x00,0x11,0x91,0x5a,0x00,0x12,0x70,0x7f,0x2e,0x50,0xa0,0xef,0xfa,0x00,0x05,0x66,
-0x05,0xf0,0x02,0xf9,0x04,0xff,0xff,0xfb,0x11,0x3f,0xa4,0xff,0x84,0xfc,0x00,0x00,
-0x33,0xff,0x90,0x19,0xd5,0x01,0xd0,0xa2,0x01,0x70,0x00,0x02,0xef,0xa4,0xf6,0x3f,
-0xa0,0xef,0xff,0xb0,0x8d,0x05,0x00,0xdd,0x00,0x20,0xff,0xfb,0x51,0x05,0x21,0x14,
-0xfc,0x41,0x00,0x15,0x19,0xd6,0x04,0x11,0x5f,0x1a,0x6c,0x01,0x11,0x06,0xf1,0x09,
-0x5f,0xfa,0xff,0xa0,0x00,0x05,0xff,0x90,0x3f,0xfa,0x00,0x4f,0xf9,0x00,0x03,0xff,
-0xa0,0xbf,0x90,0x00,0x00,0x3f,0xf1,0x15,0x80,0x7d,0x11,0x01,0x9f,0x04,0xf0,0x08,
-0x9f,0x50,0x00,0x00,0x1d,0xe1,0x8f,0xf5,0x00,0x01,0xdf,0xd0,0x08,0xff,0x50,0x1d,
-0xfd,0x10,0x00,0x8f,0xf6,0xdf,0xd1,0x61,0x01,0x20,0xfd,0x10,0xf8,0x01,0x02,0xf0,
-0x7f,0x10,0x10,0xcc,0x60,0x13,0x10,0x14,0x01,0x20,0xfd,0x18,0xe2,0x03,0x00,0x20,
-0x84,0xf0,0x04,0x4a,0xaa,0xaa,0xfb,0x00,0x0c,0xda,0xf7,0xf4,0x00,0x00,0x0e,0xb0,
-0x00,0x00,0x9f,0x11,0x00,0x00,0x77,0x37,0x33,0x09,0xf1,0x00,0x11,0x00,0xc0,0x10,
-0x00,0x02,0xe6,0xeb,0x9d,0x00,0x09,0xf9,0x99,0x99,0x4d,0x44,0x01,0x73,0x7f,0xff,
-0xff,0xfb,0x1d,0xff,0xa0,0xfe,0x49,0x17,0xa0,0x7e,0x75,0x22,0xcc,0xc7,0x15,0x62,
-0x32,0xf8,0x22,0x22,0x54,0x04,0x00,0xb8,0x06,0x0f,0x01,0x00,0x11,0x05,0x26,0x05,
-0x03,0xaa,0x5d,0x12,0x08,0xbb,0x01,0x21,0x8f,0xff,0xea,0x71,0x02,0x9c,0x3d,0x12,
-0x7f,0xb8,0x04,0x5f,0x69,0x9f,0xff,0x99,0x60,0x52,0x07,0x03,0x50,0x46,0x66,0x2f,
-0xff,0x26,0x36,0x07,0x30,0x46,0x76,0x4f,0x69,0x04,0x2e,0xfc,0xbc,0x36,0x07,0x13,
-0x00,0x69,0x82,0x00,0x10,0x02,0x12,0xfa,0xf0,0x51,0x12,0xff,0xcc,0x6b,0x21,0xfd,
-0x00,0x07,0x84,0x12,0xfa,0x2c,0x75,0x12,0xf6,0x07,0x00,0x00,0xa9,0x42,0x00,0xb1,
-0x03,0x00,0x07,0x18,0x90,0x4f,0xfd,0x00,0x03,0xaf,0xf8,0x07,0xff,0xf2,0xf9,0x6b,
-0x30,0xef,0xfe,0x30,0x37,0x0a,0x21,0xff,0xc2,0xa0,0x00,0x01,0x01,0x83,0x21,0x98,
-0x62,0x67,0x01,0x10,0x84,0xc5,0x01,0xf1,0x05,0x8f,0xff,0x60,0x00,0xaf,0xf3,0xec,
-0x2e,0xc0,0x1c,0xff,0xa0,0xde,0x9f,0xd1,0xdf,0xfa,0x00,0x3e,0xff,0x80,0x02,0x11,
-0x2d,0x61,0x00,0x10,0x1c,0x4e,0x05,0x11,0x2d,0xb6,0x2c,0xf0,0x0f,0xcf,0xaf,0xd2,
-0xef,0xf6,0x00,0xfb,0x0d,0xd0,0x2e,0xff,0x60,0xbf,0xef,0x80,0x02,0xef,0xf3,0x19,
-0xc8,0x00,0x00,0x16,0x40,0x00,0x02,0x66,0x66,0x12,0x00,0x64,0x00,0x20,0x3f,0x40,
-0xbd,0x6c,0xa1,0x3f,0xf2,0xdf,0x6c,0xff,0xff,0x53,0x31,0xff,0x7c,0xfe,0x04,0x0f,
-0x06,0x00,0x0b,0x10,0x7b,0xd3,0x03,0x20,0xff,0xc2,0xf2,0x25,0x11,0xff,0x74,0x81,
-0x10,0x8a,0x8d,0x5d,0x01,0x94,0x16,0x13,0x60,0xa5,0x53,0x10,0xfa,0x02,0x01,0x20,
-0x80,0xfa,0x1c,0x06,0x11,0xf3,0x06,0x00,0x72,0xf5,0xfe,0xaa,0xaa,0xaa,0xff,0xf5,
-0x0f,0x04,0x40,0xff,0xff,0x80,0x4f,0x06,0x00,0x20,0x10,0x0c,0x06,0x00,0x20,0x50,
-0x1e,0x06,0x00,0x51,0xfb,0xef,0xff,0xf5,0x9f,0x70,0x05,0x10,0xcd,0x3d,0x1b,0x24,
-0xd4,0xef,0x3d,0x08,0x05,0x01,0x00,0x10,0xbc,0x08,0x29,0x2f,0xc3,0xff,0x18,0x00,
-0x10,0x10,0x6b,0x12,0x00,0x22,0xcb,0x6f,0xfe,0x01,0x02,0x5e,0x07,0x11,0x95,0x0e,
+0xdd,0x10,0xa1,0x01,0x21,0x00,0x92,0x3f,0x07,0xf1,0x24,0x6e,0xa0,0x00,0x2a,0xba,
+0x70,0x6d,0x19,0x90,0x00,0x11,0x12,0x9f,0x64,0x4d,0xd4,0x09,0xcc,0xaa,0x58,0x88,
+0x86,0x50,0x00,0x00,0x11,0x11,0x11,0x10,0x08,0xbb,0x49,0xcd,0xbe,0xbe,0x00,0x67,
+0x73,0x93,0x91,0xb0,0xc0,0x0d,0x37,0x79,0xde,0xdf,0xdf,0x00,0xc0,0x57,0x0d,0x00,
+0xfa,0x4b,0xcd,0x79,0x39,0x1b,0x0c,0x00,0xc0,0x00,0x93,0x81,0xa6,0xa0,0x00,0xa0,
+0x00,0x83,0x0a,0x41,0x00,0x07,0x31,0xbc,0xeb,0x96,0xc0,0x1d,0xdd,0x77,0x44,0x78,
+0x4a,0x40,0x00,0x00,0x57,0x75,0x85,0x10,0x07,0xcc,0x8d,0xdd,0xde,0xed,0x90,0x35,
+0x51,0x57,0x75,0x67,0x21,0x04,0x66,0x1c,0x33,0xc5,0x8b,0x20,0x7b,0xb2,0xcb,0xbc,
+0x3d,0xa0,0x0a,0x28,0x3c,0x00,0xc0,0xf2,0x00,0xa1,0x73,0xcb,0xbc,0x8f,0x08,0x0a,
+0xcd,0x3c,0x00,0xba,0x86,0x90,0xa1,0x00,0x00,0x1b,0x01,0xe4,0xfe,0x00,0xf0,0x31,
+0x0a,0x26,0x60,0x0c,0x10,0x00,0x15,0xd5,0x77,0x45,0xea,0xbb,0x30,0x7c,0x99,0xb8,
+0xdd,0x1a,0x30,0x3e,0xa8,0x78,0x62,0x4d,0xa0,0x00,0x69,0x79,0xb2,0x5c,0xad,0x70,
+0x02,0x31,0x79,0x97,0x10,0x08,0x20,0xaa,0xaa,0xac,0xaa,0xaa,0xa0,0x00,0x38,0x88,
+0x88,0x88,0x60,0x00,0x03,0x88,0x88,0x88,0x86,0x00,0x00,0x49,0x99,0x99,0x99,0x80,
+0xe4,0x00,0x00,0xc4,0x03,0x41,0x8b,0x99,0x99,0x99,0x01,0x07,0xf0,0x3b,0x0e,0x00,
+0x00,0x00,0x5a,0xaf,0xaa,0xfa,0xad,0x40,0x01,0xa8,0xe8,0x8f,0x88,0xa3,0x00,0x4c,
+0x9f,0x99,0xf9,0x99,0x90,0x00,0x4d,0x40,0x0e,0x01,0x6e,0x00,0xcf,0xa9,0x99,0x99,
+0xad,0x20,0x00,0xda,0x99,0x99,0x9a,0xc0,0x00,0x0d,0x32,0x22,0x22,0x4c,0x00,0x00,
+0xd8,0x77,0x77,0x79,0xc0,0x00,0x0d,0xa9,0x99,0x99,0xbc,0x00,0x00,0x4a,0x70,0x05,
+0xb9,0x50,0x00,0xb8,0x20,0x00,0x00,0x27,0xcc,0x04,0x00,0xcd,0x02,0x94,0xec,0xcf,
+0x10,0x0d,0x10,0x00,0x0e,0x00,0xc1,0x0d,0x00,0x23,0xdd,0xd2,0x0d,0x00,0x22,0xeb,
+0xbf,0x1a,0x00,0xfa,0x16,0xd1,0xcd,0xfe,0xdc,0x00,0xe0,0x0c,0x1e,0x11,0x13,0xd0,
+0x0b,0xcc,0xc1,0xe0,0x00,0x1d,0x00,0x68,0x49,0x0e,0x00,0x01,0xd0,0x1d,0x20,0xb4,
+0xeb,0xbb,0xbd,0x04,0x80,0x01,0x0e,0x22,0x23,0xd0,0x68,0x08,0xb0,0x01,0x11,0x1f,
+0x11,0x11,0x00,0x00,0xad,0xdd,0xfd,0xdd,0x10,0x02,0x10,0x0f,0x09,0x02,0xf0,0x22,
+0xcc,0xcc,0xfc,0xcc,0xcc,0x10,0x22,0x27,0xb2,0x7b,0x22,0x20,0x00,0x83,0x59,0x05,
+0xa3,0x80,0x00,0x1e,0x07,0x80,0x5a,0x0d,0x40,0x0b,0x60,0xb4,0x05,0xa0,0x4d,0x02,
+0x90,0x3e,0x00,0x5a,0x00,0xb3,0x00,0x2e,0x50,0x05,0xa0,0x00,0x00,0x0a,0x50,0x0e,
+0xe6,0x8c,0x06,0x10,0x40,0x52,0x00,0xa0,0x22,0xb6,0x21,0xbd,0xdd,0xd0,0x08,0xae,
+0xca,0x40,0x0c,0x01,0x10,0xa4,0xd0,0x04,0xf0,0x1c,0x1c,0xce,0xec,0x99,0xdd,0xdd,
+0x00,0x11,0x68,0x00,0xb3,0x00,0x00,0x07,0x66,0xa4,0x3b,0x30,0x02,0x20,0x86,0x6c,
+0x85,0xb3,0x00,0x67,0x09,0xb6,0x80,0x08,0xdc,0xce,0x30,0xbc,0xb8,0x00,0x01,0x11,
+0x00,0x0d,0x2e,0xb2,0x00,0x1f,0x04,0x63,0x18,0xde,0xee,0xee,0xe9,0x02,0xa1,0x00,
+0x11,0x0e,0x06,0x00,0xf0,0x2e,0x11,0xe1,0x18,0xdf,0xdd,0xf2,0x0c,0xcf,0xcb,0x00,
+0xe0,0x0d,0x10,0x00,0xe0,0x00,0x79,0x00,0xe0,0x3d,0xdf,0xdd,0xac,0x19,0xd9,0x00,
+0x00,0xc1,0x04,0x54,0x44,0x40,0x0a,0x2c,0x10,0x2e,0x99,0x9d,0x00,0xc2,0xcd,0xd4,
+0xb0,0x01,0xd0,0x0d,0x5c,0x10,0x2b,0x00,0x1d,0x00,0xdc,0xd1,0x02,0xcc,0xcc,0xb0,
+0x1b,0x6f,0x50,0xba,0x05,0x73,0x60,0x4a,0xee,0xee,0xee,0xe7,0x01,0x1b,0x07,0xa0,
+0xdd,0xf2,0xdf,0xff,0xff,0x10,0xd0,0x0b,0x2d,0x10,0x28,0x07,0x10,0xb2,0x26,0x04,
+0xf0,0x0e,0xbd,0xfd,0x2d,0xed,0xde,0xb0,0x00,0x1b,0x00,0xd1,0x00,0x2b,0x00,0xd1,
+0xe9,0x5d,0x10,0x02,0xb0,0x0d,0x1c,0x11,0xde,0xee,0xeb,0x00,0xd1,0xb0,0x0d,0x27,
+0x00,0xf0,0x06,0x1d,0x87,0xd1,0x00,0x00,0x02,0xee,0xc7,0x2d,0x43,0x33,0x31,0x36,
+0x10,0x00,0x9b,0xbb,0xbb,0x40,0x00,0x0d,0x3f,0x00,0xf0,0x31,0x29,0x9e,0x99,0x00,
+0x0d,0x00,0x14,0x5e,0x44,0x13,0x3e,0x33,0x0b,0xbf,0xb9,0x8c,0xaf,0xaf,0x0b,0x0b,
+0x0c,0x86,0x0d,0x0d,0x0e,0xae,0xac,0x86,0x0d,0x0d,0x0b,0x0b,0x0c,0x8a,0x7e,0x7e,
+0x0c,0xbf,0xba,0x8a,0x6e,0x6e,0x13,0x3d,0x33,0x86,0x0d,0x0d,0x49,0x9e,0x99,0x96,
+0x0d,0x0d,0x00,0x0d,0x00,0x8e,0xdf,0xcf,0x00,0x0d,0x00,0x86,0x50,0x06,0x03,0xac,
+0x07,0xf1,0x22,0x00,0x08,0x50,0x00,0x09,0x9e,0x98,0x11,0x4b,0x11,0x00,0x44,0xd4,
+0x3c,0xcc,0xcc,0xc5,0x09,0xcf,0xb7,0x08,0x40,0x91,0x00,0xc0,0xb2,0x92,0xd0,0x05,
+0xc0,0x0c,0xbe,0xca,0xd7,0x10,0x4a,0x70,0xc0,0xb2,0x93,0x77,0x2d,0x10,0x0c,0xbe,
+0xc9,0x00,0xd9,0x60,0x34,0x00,0x70,0xf0,0x00,0x2d,0xdf,0xdb,0x01,0xde,0x0d,0x00,
+0xa4,0x04,0xd6,0x1d,0x91,0x00,0x0d,0x02,0xc3,0x00,0x09,0xd5,0x06,0x11,0x3a,0x06,
+0x00,0xf1,0x30,0x53,0xa2,0x5f,0xcc,0xcc,0xe5,0x0b,0x3a,0x77,0xc0,0x09,0x07,0x50,
+0x95,0xab,0x0a,0xcc,0xfc,0xc0,0x06,0x8c,0x73,0x35,0x6e,0x55,0x01,0x9d,0xbc,0x6a,
+0x65,0xd4,0xd0,0x03,0xa5,0x70,0xab,0xae,0xaf,0x00,0x4a,0x57,0x0a,0x76,0xe5,0xe0,
+0x05,0x85,0x83,0x24,0x5d,0x44,0x00,0x85,0xae,0x9d,0xdd,0xfd,0xd7,0x0d,0x13,0x00,
+0x00,0x1c,0x09,0x06,0x51,0x01,0xc0,0x00,0x09,0x10,0xcc,0x04,0x30,0x5d,0x10,0x0c,
+0x19,0x06,0x10,0x74,0x03,0x0a,0x00,0x01,0x00,0x11,0xe9,0x06,0x00,0xf0,0x11,0x3c,
+0xd0,0x00,0x08,0xee,0x30,0x09,0x68,0x70,0x00,0x00,0xb3,0x01,0xe0,0x2d,0x00,0x00,
+0x0b,0x30,0xb6,0x00,0xa8,0x00,0x00,0xb3,0xb8,0x00,0x01,0xda,0x00,0x3e,0x74,0x68,
+0x0b,0xd3,0x3d,0x28,0xb5,0x32,0x22,0x45,0x15,0x40,0x02,0x8a,0xbb,0xba,0xa0,0xf8,
+0x09,0xf1,0x04,0x70,0x00,0x00,0xb4,0x00,0x00,0x08,0xa0,0x0b,0xbf,0xcb,0xa0,0x00,
+0x0a,0x31,0xd1,0x11,0x1e,0x00,0x47,0x03,0xb1,0xe0,0x03,0x55,0x11,0xfc,0xcc,0xcc,
+0x00,0x48,0xd3,0x1d,0x3f,0x05,0xf0,0x02,0x31,0xfd,0xdd,0xdd,0x50,0x00,0xb3,0x1d,
+0x00,0x00,0x95,0x00,0x0b,0x31,0xd0,0x00,0x09,0x0d,0x00,0xf9,0x02,0xcc,0xcc,0xd4,
+0x00,0xab,0xc4,0x00,0x00,0x00,0x21,0x59,0x01,0x9d,0xdc,0xde,0xff,0x20,0xd2,0x03,
+0xf1,0x0c,0xb2,0x00,0x94,0x00,0x4c,0x00,0x04,0xd1,0x02,0xd0,0x0c,0x40,0x00,0x07,
+0x46,0xac,0xab,0xfa,0x70,0x00,0x00,0x23,0x3a,0x83,0x32,0x05,0xbb,0xca,0x0b,0x60,
+0x12,0xe1,0xee,0xef,0xee,0xee,0x39,0x03,0x11,0xdb,0x60,0x03,0x20,0x5a,0x7c,0x06,
+0x06,0xf8,0x09,0x6e,0x10,0x8b,0x00,0x02,0xf3,0xab,0x10,0x00,0x95,0x02,0xe6,0xd7,
+0x10,0x00,0x00,0x21,0x95,0x01,0x8e,0xfe,0xef,0xff,0x30,0x5a,0x00,0xf0,0x14,0x01,
+0xb2,0x08,0xcc,0xcc,0xcf,0x70,0x03,0xd3,0x01,0x99,0x8a,0x40,0x00,0x01,0x08,0xbb,
+0xcf,0xfb,0xa0,0x00,0x00,0xb3,0x02,0xb0,0x0d,0x08,0xdf,0x2b,0xcb,0xce,0xbb,0xd0,
+0x00,0xc2,0x0d,0x00,0x28,0x00,0x0c,0x0d,0x00,0x80,0x0e,0x4b,0x30,0x2b,0x5c,0xb0,
+0x0c,0x6b,0x9c,0x01,0x73,0x07,0x60,0x06,0xcd,0xcc,0xde,0xf5,0x4f,0x00,0xf3,0x3f,
+0x03,0x10,0x00,0x01,0xd0,0x00,0x00,0x5c,0x16,0xaa,0xbf,0xaa,0xa5,0x00,0x7a,0x12,
+0x23,0xe2,0x22,0x10,0x00,0x01,0xcc,0xcf,0xcc,0xb0,0x04,0x43,0x1d,0x01,0xd0,0x0e,
+0x01,0xcd,0xb1,0xd0,0x1d,0x00,0xe0,0x00,0x3b,0x1c,0xce,0xfd,0xcb,0x00,0x03,0xb0,
+0x04,0xce,0xc5,0x00,0x00,0x3b,0x08,0xb2,0xd0,0xa9,0x00,0x05,0xc6,0x70,0x1d,0x00,
+0x60,0x05,0xb7,0xa3,0x00,0x20,0x00,0x10,0xd0,0x03,0xad,0xdc,0xde,0xf8,0x55,0x00,
+0x30,0x09,0x20,0x9d,0x87,0x0e,0xf0,0x21,0x2b,0x49,0xcb,0xbb,0xbb,0xe0,0x00,0x00,
+0x94,0x74,0x01,0xc0,0x01,0x22,0x09,0x44,0xb1,0x99,0x10,0x5c,0xf1,0xa7,0x99,0xf9,
+0x99,0x00,0x0d,0x1b,0x38,0x8f,0x88,0x50,0x00,0xd1,0xd0,0x11,0xe1,0x11,0x00,0x0d,
+0x4b,0x9b,0xbf,0xbb,0xb0,0x00,0xe8,0x50,0x45,0x09,0xc3,0xbb,0xd5,0x00,0x07,0x00,
+0x00,0x78,0x01,0x8d,0xdd,0xdd,0xef,0xc8,0x05,0x03,0x91,0x03,0xc0,0x9a,0x00,0xdc,
+0xbb,0xcd,0x00,0x00,0x75,0x0d,0xba,0x51,0xd0,0x34,0x01,0xf0,0x0d,0x38,0x1d,0x00,
+0x48,0x80,0x6e,0x89,0xc8,0xe6,0x03,0x5e,0x1d,0x44,0x44,0x45,0xd0,0x00,0xd1,0xd0,
+0xaa,0xaa,0x0d,0x00,0x0d,0x1d,0x0b,0x00,0xc0,0x0d,0x00,0xf3,0x08,0xc9,0x99,0x0d,
+0x00,0x2e,0x2d,0x05,0x00,0x4c,0xa0,0x2c,0x3b,0x60,0x00,0x00,0x01,0x29,0x40,0x07,
+0xde,0xde,0xef,0xf7,0xa3,0x00,0xf0,0x02,0x05,0x00,0x00,0x0b,0x10,0x00,0x00,0xb8,
+0x3c,0xcc,0xed,0xcc,0xc4,0x00,0xb2,0x04,0xa0,0xf9,0x0d,0xf0,0x02,0x0a,0xcf,0xcc,
+0xfc,0xa0,0x00,0x00,0xd1,0x28,0x62,0x1d,0x06,0xee,0x1d,0x37,0xba,0x73,0x48,0x00,
+0x22,0x7c,0xb7,0x55,0x00,0x10,0xb0,0x0d,0x00,0xf0,0x08,0xca,0xa8,0x0d,0x00,0x2f,
+0x5c,0x02,0x00,0x6d,0x90,0x2d,0x39,0xa3,0x21,0x11,0x23,0x24,0x50,0x03,0x9b,0xcc,
+0xcb,0xb4,0x11,0x00,0x01,0x00,0xf3,0x3a,0x01,0xd3,0x0e,0xab,0x6d,0xaa,0xc0,0x02,
+0xd2,0xea,0xb5,0xda,0xaa,0x00,0x00,0x0d,0x55,0x8c,0x54,0x91,0x00,0x00,0x24,0xc1,
+0x3b,0x43,0x06,0xee,0x05,0x5e,0x57,0xd5,0x40,0x00,0xd0,0x45,0xe5,0x6d,0x53,0x00,
+0x0d,0x5a,0xaf,0xab,0xea,0xa2,0x00,0xd1,0x14,0xb2,0x5b,0x31,0x00,0x0e,0x37,0xd3,
+0x00,0x4d,0x60,0x0b,0xbc,0xa1,0x00,0x00,0x13,0x06,0xa0,0x06,0xcd,0xdd,0xde,0xf4,
+0x00,0x01,0x00,0x20,0x04,0x50,0x06,0x00,0xf0,0x11,0x11,0x4d,0x11,0x0a,0xed,0xf3,
+0x08,0xcb,0xbc,0xc4,0xa2,0x1e,0x00,0x0b,0x30,0x79,0x0a,0x27,0x70,0x00,0x59,0x0d,
+0x20,0xa2,0xd1,0x01,0xde,0xee,0xfd,0x9a,0x3b,0x30,0x24,0x00,0xf4,0x14,0xa2,0x2c,
+0x00,0x4d,0xdd,0xdd,0x0a,0x20,0xc1,0x05,0x90,0x00,0xe0,0xa2,0x0d,0x20,0x59,0x00,
+0x0e,0x0a,0x7d,0xa0,0x05,0xec,0xcc,0xf0,0xa2,0x00,0x00,0x59,0x00,0x0d,0x0a,0x20,
+0x00,0x01,0x00,0xf0,0x05,0x7c,0x99,0x99,0x9a,0xd0,0x00,0x07,0xc8,0x88,0x88,0x9d,
+0x00,0x00,0x59,0x88,0x88,0x88,0x90,0x00,0xbb,0x01,0x00,0xf1,0x22,0xb5,0x00,0x46,
+0x66,0x66,0x66,0x61,0x00,0x0b,0x63,0x3d,0x53,0x3c,0x30,0x00,0xba,0x99,0xea,0x99,
+0xe3,0x00,0x07,0x87,0x7e,0x87,0x7a,0x20,0x00,0xaa,0xaa,0xeb,0xaa,0xa5,0x00,0x00,
+0x00,0x0c,0x10,0x00,0x00,0x1b,0xbb,0xbb,0xfc,0xbb,0xbb,0x60,0x00,0x15,0x4e,0x00,
+0xf0,0x55,0x0b,0xd3,0x0a,0xcc,0xcd,0xa0,0x0a,0x72,0xb6,0x25,0x55,0x7a,0x05,0xdc,
+0xcb,0x01,0x33,0x36,0xa0,0x00,0x48,0x03,0x88,0x88,0xad,0x40,0x15,0x81,0x49,0x9e,
+0xa9,0x95,0x2b,0xcd,0xb3,0x80,0xc1,0x07,0x30,0x54,0x77,0x07,0x9c,0x5b,0x80,0x0a,
+0x48,0xb0,0x07,0xfe,0x70,0x00,0x75,0x86,0x1a,0x9c,0x3d,0x60,0x16,0xbe,0xba,0x60,
+0xc1,0x19,0x82,0x73,0x00,0x00,0xad,0x00,0x00,0x00,0x0d,0xdc,0xcc,0xcc,0xc0,0x00,
+0x00,0xda,0xaa,0xaa,0xa6,0x00,0x00,0x0d,0x32,0x22,0x22,0x10,0x00,0x00,0xdc,0xcc,
+0xcc,0xc7,0x00,0x00,0x0d,0x10,0x5a,0x01,0xf0,0x6c,0xdd,0xfe,0xdd,0xdd,0xdd,0xd6,
+0x00,0x0e,0x00,0xc4,0x00,0x86,0x00,0x00,0xe0,0x02,0xd6,0xc6,0x00,0x00,0x0e,0x00,
+0x25,0xf6,0x00,0x00,0x05,0xfa,0xdb,0x22,0xbd,0x83,0x00,0x48,0x30,0x00,0x00,0x27,
+0x30,0xdc,0xbc,0xb2,0xfb,0xbc,0xdd,0xba,0xcb,0x2e,0xaa,0xbd,0xd1,0x03,0xb2,0xc0,
+0x01,0xdd,0xcb,0xcb,0x2f,0xbb,0xcd,0xd2,0x11,0x00,0x11,0x12,0xdd,0x1b,0xed,0xcf,
+0xc6,0x1d,0xd1,0x08,0x50,0xd0,0x01,0xdd,0x3d,0xee,0xdf,0xda,0x1d,0xd1,0x0b,0x10,
+0xd0,0x01,0xdd,0x13,0xc0,0x0d,0x00,0x1d,0xd1,0xb2,0x00,0xd0,0xee,0x80,0xec,0xcc,
+0xd0,0xfc,0xcc,0xee,0xbb,0xbd,0x0f,0xbb,0xbe,0xe1,0x01,0xd0,0xe0,0x01,0xee,0xcc,
+0xcd,0x0f,0xbb,0xce,0xe1,0x7f,0x00,0xf4,0x01,0xee,0x10,0xeb,0xbb,0xc0,0x1e,0xe1,
+0x0d,0x00,0x0d,0x01,0xee,0x10,0xfb,0xbc,0xd0,0x0b,0x00,0xf5,0x41,0xfc,0xcc,0xa0,
+0x1e,0xe1,0x06,0x00,0x01,0xfe,0x90,0x00,0x00,0x00,0x06,0x10,0x00,0xfd,0xe9,0x00,
+0x5f,0x70,0x00,0xd0,0xa3,0x05,0xd2,0xa9,0x00,0xd1,0xc1,0xbb,0x10,0x08,0xd3,0xd5,
+0x91,0x5d,0xde,0xdd,0x51,0xd0,0xb3,0x00,0x0c,0x20,0x00,0xd0,0x59,0x77,0x7e,0x97,
+0x72,0xd0,0x6a,0x66,0x6d,0x76,0x62,0xd9,0xd3,0x1a,0x0c,0x2b,0x10,0xd0,0x00,0x96,
+0x0c,0x24,0xc0,0xd0,0x04,0xb0,0x0c,0x20,0x94,0xd0,0x00,0x05,0xdd,0xa6,0x01,0x30,
+0x09,0x40,0x83,0x01,0x02,0xf0,0x1a,0xf8,0x7a,0xc7,0x77,0x30,0x02,0xe8,0x44,0xa8,
+0x44,0x42,0x01,0xec,0xca,0xad,0xca,0xaa,0x00,0x02,0x99,0x55,0xb9,0x55,0x50,0x00,
+0x09,0x95,0x5b,0x95,0x55,0x00,0x00,0x9d,0xcc,0xed,0xcc,0xcb,0x00,0x04,0x20,0x0b,
+0x9d,0x01,0xf4,0x0a,0xcc,0xce,0xfe,0xcc,0xcc,0x50,0x00,0x1a,0x9f,0x8c,0x30,0x00,
+0x03,0x9d,0x40,0xe0,0x3c,0xc6,0x11,0xb5,0x00,0x0e,0x00,0x03,0x93,0x55,0x00,0xf0,
+0x2d,0xa3,0x00,0x0b,0x47,0x00,0x0c,0xcc,0xcc,0xa2,0xc0,0xd0,0x00,0x64,0x57,0x63,
+0x8d,0x9b,0x92,0x08,0x3a,0xb7,0x7f,0x83,0xe3,0x10,0x87,0x76,0x98,0xd6,0x0d,0x00,
+0x08,0xcb,0xbd,0x47,0xec,0xfc,0x10,0x00,0x84,0x00,0x76,0x0d,0x00,0x0e,0xdf,0xdd,
+0xb7,0x60,0xd0,0x00,0xc2,0x96,0x0b,0x7e,0xdf,0xd1,0x0c,0x9a,0xa6,0x0d,0x00,0xf0,
+0x35,0xc0,0x00,0x2b,0x7d,0xcf,0xc5,0x0c,0x00,0x3b,0x67,0x71,0x11,0x00,0x2c,0xcc,
+0xcf,0xcc,0xcc,0x20,0x98,0x88,0x8f,0x88,0x88,0x90,0xd4,0x99,0x3e,0x39,0x93,0xe0,
+0xa0,0x00,0x0e,0x00,0x00,0xa0,0x08,0xcc,0x4e,0x4c,0xc8,0x00,0x09,0xbb,0xbe,0xbb,
+0xba,0x00,0x0d,0x32,0x3e,0x22,0x2e,0x00,0x0d,0x87,0x7e,0x77,0x7e,0x00,0x0d,0xbb,
+0xbf,0xbb,0xbe,0x32,0x0b,0x24,0x00,0xf0,0x00,0x85,0x00,0x00,0x0b,0xcc,0xcc,0xd1,
+0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x4c,0x49,0x00,0xf0,0x07,0x60,0x00,0x89,0x99,
+0xf9,0x99,0x90,0x00,0x02,0x22,0x2f,0x22,0x22,0x00,0x2c,0xcc,0xcc,0xfc,0xcc,0xcc,
+0x20,0x11,0x01,0x00,0xf0,0x0b,0x10,0x00,0x5e,0xbb,0xbb,0xbd,0x70,0x00,0x05,0xb5,
+0x55,0x55,0xa7,0x00,0x00,0x5b,0x44,0x44,0x4a,0x70,0x00,0x05,0xda,0xaa,0xaa,0xd7,
+0xda,0x02,0xf3,0x00,0x00,0x07,0x70,0x00,0x05,0x90,0x00,0x4c,0xc4,0x00,0x00,0x02,
+0xc0,0x1e,0x00,0x06,0x00,0x68,0xaf,0xff,0xc0,0x1f,0xff,0xf8,0x12,0x00,0x68,0x7e,
+0xee,0xc0,0x1f,0xee,0xe4,0x12,0x00,0x68,0xee,0xef,0xc0,0x1f,0xff,0xfc,0x12,0x00,
+0x03,0x06,0x00,0x01,0x01,0x00,0xa0,0x2e,0xee,0xef,0xfe,0xee,0xee,0x30,0x00,0x00,
+0x6b,0xd9,0x01,0xff,0x09,0xaa,0xad,0xda,0xaa,0xa6,0x00,0x97,0x3d,0x43,0x6c,0x37,
+0x90,0x09,0x50,0xd0,0x03,0xa0,0x59,0x00,0x95,0x0d,0xcc,0xda,0x05,0x0d,0x00,0x02,
+0xf0,0x3e,0x9d,0xcf,0xcc,0xde,0xcd,0x90,0x09,0x61,0x11,0x11,0x11,0x69,0x00,0x00,
+0x0d,0x00,0x00,0xc0,0x00,0x01,0x88,0xf8,0x76,0xcf,0xcc,0x40,0x05,0x6e,0x55,0x03,
+0xa0,0x84,0x00,0x79,0xf9,0x6a,0xcc,0xcc,0xc2,0x0c,0x33,0x6a,0x29,0x99,0x96,0x00,
+0xcb,0xbc,0xa3,0xa1,0x15,0xa0,0x0c,0x00,0x3a,0x3d,0x99,0xba,0x00,0xbd,0xed,0x90,
+0x22,0xe2,0x10,0x00,0x1e,0x00,0x8c,0xcf,0xcc,0x23,0xbc,0xfb,0xb2,0xa0,0xe0,0x41,
+0x00,0xac,0x3c,0xcf,0xcc,0x20,0x00,0xd0,0x00,0x00,0xe0,0x00,0x01,0x00,0xf4,0x0f,
+0x0e,0x10,0x00,0x00,0x04,0xdd,0xdd,0xfe,0xdd,0xda,0x00,0x00,0x58,0x00,0x02,0xc0,
+0x00,0x00,0x01,0xf0,0x00,0x97,0x00,0x01,0xdd,0xdf,0xdd,0xdf,0xdd,0xd5,0x46,0x04,
+0x20,0xdd,0xdd,0x20,0x00,0xb1,0x4a,0x00,0x00,0x03,0xb0,0x00,0x04,0xeb,0xbb,0xbb,
+0xcb,0x0d,0x00,0xf2,0x02,0x04,0xb0,0x00,0x04,0xb1,0x11,0x11,0x4b,0x00,0x00,0x4e,
+0xbb,0xbb,0xbc,0xb0,0x00,0x01,0x2e,0x00,0x90,0xc0,0x60,0xb9,0xdd,0xfd,0xd3,0x0c,
+0x0b,0x0b,0x24,0x00,0xc0,0xc0,0xb0,0xb4,0xdb,0xbb,0xe0,0x0c,0x0b,0x0b,0x49,0x00,
+0x0e,0x0d,0x00,0x20,0xd9,0x99,0x0d,0x00,0x30,0x4a,0x22,0x2e,0x0d,0x00,0x21,0xc8,
+0x88,0x0d,0x00,0xf0,0x11,0x33,0x3e,0x00,0xc0,0xb0,0xb2,0x78,0x78,0x60,0x49,0x00,
+0x0b,0x0a,0x80,0xd5,0x07,0x40,0x00,0xcc,0x90,0x01,0xd4,0x10,0x00,0x00,0x30,0x00,
+0x02,0x10,0x00,0x11,0x10,0x55,0x00,0xf3,0x38,0x6c,0x9a,0xb5,0xbc,0xfb,0xb5,0x06,
+0xda,0xbb,0x07,0x9d,0x88,0x00,0x66,0x02,0xb0,0xd2,0x22,0xe0,0x04,0xbb,0xb8,0x0e,
+0xaa,0xae,0x00,0x22,0x22,0x21,0xd0,0x00,0xe0,0x19,0x9d,0xa9,0x6e,0xaa,0xae,0x00,
+0x35,0xa1,0x00,0xd5,0x55,0xe0,0x06,0x7a,0xcb,0x26,0xa6,0x95,0x00,0x8d,0xb1,0x02,
+0xc6,0x06,0xb0,0x0b,0x5f,0x51,0xa4,0x00,0x05,0x42,0xb0,0x18,0xcd,0xdc,0xcc,0xd7,
+0xa3,0x00,0xf1,0x39,0x0a,0xdd,0xdd,0xdd,0xf1,0x94,0x00,0x00,0x47,0x64,0x0a,0xd9,
+0x00,0x08,0xdb,0x59,0x50,0x6b,0xa9,0x00,0x3a,0x40,0x95,0x01,0xe1,0x40,0x02,0xb6,
+0x2a,0x72,0x26,0xdd,0x03,0xbe,0xcb,0xed,0xbe,0x32,0x40,0x00,0xc2,0x09,0x50,0x97,
+0xc3,0x00,0x0e,0x00,0x95,0x07,0xdc,0x30,0x03,0xc0,0x09,0x50,0x3c,0x17,0x00,0xc4,
+0x00,0x95,0x00,0xd3,0x53,0x49,0x00,0x09,0x50,0x03,0xce,0x10,0x4d,0x00,0xf0,0x01,
+0x10,0x00,0x00,0x01,0xb0,0x00,0x00,0x01,0x88,0x88,0x8f,0x98,0x88,0x81,0x04,0x44,
+0x01,0x00,0xf1,0x1e,0x00,0x03,0xeb,0xbb,0xbb,0xe4,0x00,0x00,0x3b,0x00,0x00,0x0a,
+0x40,0x00,0x02,0xbb,0xbb,0xbb,0xb3,0x00,0x06,0x99,0x99,0x99,0x99,0x96,0x00,0xb6,
+0x33,0x33,0x33,0x36,0xb0,0x0b,0x35,0xeb,0xbb,0xe2,0x3b,0x00,0xb3,0x59,0x00,0x0b,
+0x23,0x0d,0x00,0x92,0xb1,0x3b,0x00,0xb3,0x12,0x00,0x00,0x6c,0x70,0xa2,0x00,0x01,
+0x5b,0x00,0xe0,0x16,0xaf,0xf0,0x00,0x00,0x03,0x7c,0xff,0xff,0xf0,0x00,0x06,0xef,
+0xff,0x07,0x00,0x50,0x0b,0xff,0xff,0xfe,0xac,0x07,0x00,0x90,0xd8,0x30,0x09,0xf0,
+0x00,0x0b,0xf1,0x00,0x00,0x07,0x00,0x1b,0xe0,0x07,0x00,0xf1,0x0b,0x3d,0xff,0xf0,
+0x03,0x6c,0xe0,0x00,0xcf,0xff,0xf0,0xaf,0xff,0xe0,0x00,0x5f,0xff,0x80,0xdf,0xff,
+0xd0,0x00,0x00,0x21,0x00,0x2a,0xda,0xc5,0x05,0xe0,0x80,0x9c,0xcc,0xcc,0xcc,0x40,
+0x8f,0xdf,0xb7,0x77,0x77,0xfe,0xdf,0xd0,0x21,0x05,0xf0,0x08,0x50,0xde,0x8e,0x70,
+0x00,0x00,0xdb,0x8e,0xe5,0xdb,0x77,0x77,0x7f,0x95,0xed,0x1c,0xeb,0xbb,0xbb,0xf6,
+0x1d,0xfc,0xf7,0x55,0x05,0xf0,0x0f,0xfd,0x0c,0x70,0x00,0x00,0xd5,0x0d,0xfa,0xe9,
+0x33,0x33,0x3e,0xca,0xfc,0x3d,0xff,0xff,0xff,0xf8,0x3c,0x35,0x52,0x05,0x55,0x55,
+0x55,0x3f,0xff,0xc6,0xff,0x01,0x00,0x20,0xfc,0x6f,0x05,0x00,0x80,0xee,0x94,0xee,
+0xee,0xee,0xec,0x34,0x42,0x00,0x01,0x0f,0x1a,0x00,0x14,0x30,0xfd,0xff,0xa4,0x06,
+0x00,0x01,0xf0,0x00,0x21,0x29,0x10,0x34,0x03,0x11,0xfc,0x06,0x00,0x31,0xff,0x90,
+0x50,0x06,0x00,0x20,0xaf,0xc0,0x06,0x00,0xf0,0x04,0x0c,0xff,0xc0,0x2e,0xff,0x90,
+0x00,0x1c,0xff,0xce,0xff,0x90,0x00,0x00,0x1c,0xff,0xff,0x90,0x00,0x07,0x00,0x11,
+0x90,0x3d,0x06,0x14,0x90,0xee,0x04,0xf1,0x1c,0xf5,0x00,0x06,0xf8,0xdf,0xf5,0x06,
+0xff,0xc2,0xef,0xf9,0xff,0xd1,0x02,0xef,0xff,0xd1,0x00,0x08,0xff,0xf7,0x00,0x06,
+0xff,0xff,0xf5,0x06,0xff,0xe4,0xef,0xf5,0xef,0xe1,0x02,0xef,0xd4,0xa1,0x00,0x02,
+0xb4,0x00,0x00,0x02,0x14,0x07,0xf0,0x3c,0x20,0xbf,0x40,0x30,0x00,0x01,0xcf,0x1b,
+0xf4,0x7f,0x80,0x00,0xbf,0xd0,0xbf,0x45,0xff,0x40,0x4f,0xe1,0x0b,0xf4,0x07,0xfd,
+0x09,0xf8,0x00,0xbf,0x40,0x0e,0xf2,0xcf,0x40,0x0b,0xf4,0x00,0xbf,0x4b,0xf4,0x00,
+0x9e,0x30,0x0b,0xf4,0x9f,0x80,0x00,0x00,0x00,0xff,0x23,0xff,0x20,0x00,0x00,0x8f,
+0xc0,0x0a,0xfe,0x40,0x01,0x8f,0xf4,0x00,0x0c,0xff,0xed,0xff,0xf6,0x00,0x00,0x07,
+0xef,0xff,0xc3,0x4f,0x00,0x12,0x12,0x0c,0x02,0x11,0x21,0x06,0x00,0x20,0xff,0xf3,
+0xc2,0x01,0xc1,0x3f,0xff,0x70,0x11,0x00,0x7f,0xbf,0xff,0xff,0xce,0xb0,0x1f,0xf5,
+0x00,0xf1,0x14,0x53,0xff,0xff,0x82,0x5f,0xff,0xf7,0x03,0xff,0xc0,0x00,0x7f,0xf8,
+0x00,0x3f,0xfa,0x00,0x06,0xff,0x70,0x2c,0xff,0xf4,0x01,0xdf,0xfe,0x42,0xff,0xff,
+0xfe,0xff,0xff,0xf6,0x0a,0xff,0x10,0x01,0xb0,0x05,0x07,0xff,0xfa,0x13,0x20,0x00,
+0x00,0x0f,0xff,0x40,0x4e,0x00,0x21,0x46,0x50,0x55,0x00,0x30,0x25,0x00,0x36,0xbe,
+0x01,0xf0,0x1d,0x4f,0xfc,0x1a,0xf6,0x00,0x00,0x00,0x7f,0xe9,0xfe,0xcf,0x60,0x00,
+0x00,0xaf,0xc3,0x64,0xff,0xf6,0x00,0x01,0xcf,0xa3,0xef,0xa3,0xdf,0x90,0x03,0xef,
+0x75,0xff,0xff,0xc3,0xcf,0xb0,0xdf,0x48,0xff,0xff,0xff,0xe3,0x9f,0x72,0x27,0x4f,
+0x00,0xe0,0xf2,0x50,0x00,0x9f,0xff,0xcb,0xef,0xff,0x30,0x00,0x09,0xff,0xf1,0x07,
+0x9a,0x00,0xd0,0x9f,0xff,0x10,0x7f,0xff,0x30,0x00,0x07,0xff,0xe0,0x06,0xff,0xf2,
+0xde,0x03,0x11,0x54,0x60,0x00,0x21,0x1f,0xff,0xc3,0x00,0x3d,0x2f,0xff,0x20,0x07,
+0x00,0x50,0x47,0x8f,0xff,0x87,0x40,0x39,0x00,0x01,0x7c,0x01,0x60,0x0a,0xff,0xff,
+0xfa,0x00,0x00,0x23,0x05,0xf2,0x06,0xa0,0x00,0x00,0x46,0x66,0x3a,0xfa,0x36,0x66,
+0x50,0xff,0xff,0xf4,0x54,0xff,0xff,0xf2,0xff,0xff,0xff,0xcf,0x07,0x00,0x51,0xff,
+0xf3,0xb8,0xf2,0x9b,0x16,0x08,0xa1,0xa0,0x00,0x08,0xaa,0xaa,0xaa,0xa4,0x00,0x00,
+0x08,0x8f,0x00,0x30,0x00,0x03,0xfb,0x58,0x00,0x30,0xd0,0x00,0xdf,0x6f,0x00,0x40,
+0x6f,0x80,0x8f,0x60,0x4c,0x00,0xf1,0x03,0xbf,0x3f,0xfe,0xee,0x40,0x00,0x9e,0xee,
+0xf9,0xff,0xff,0xfc,0x44,0x5f,0xff,0xff,0xaf,0xff,0x01,0x00,0x22,0xfa,0xff,0x01,
+0x00,0x12,0x9a,0x07,0x00,0x11,0xf5,0x19,0x03,0xf0,0x0e,0x07,0x90,0x00,0x6d,0xff,
+0xfb,0x40,0xcf,0x00,0xbf,0xfd,0xbd,0xff,0xac,0xf0,0xbf,0xd3,0x00,0x03,0xcf,0xff,
+0x4f,0xd1,0x00,0x07,0xaa,0xff,0xf9,0xf5,0x97,0x00,0x10,0xff,0xe6,0x03,0x00,0xf7,
+0x05,0x02,0x8d,0x01,0x00,0xae,0x00,0xf3,0x0e,0x4f,0x9f,0xff,0xab,0x70,0x00,0x0d,
+0xf4,0xff,0xfb,0x20,0x00,0x3c,0xfb,0x0f,0xcb,0xff,0xca,0xcf,0xfc,0x10,0xfc,0x05,
+0xcf,0xff,0xd7,0x00,0x09,0x70,0xbd,0x01,0xe4,0x05,0x20,0x00,0x06,0xf7,0x01,0x16,
+0xff,0x8f,0xff,0xff,0xf8,0xff,0xff,0x07,0x00,0xc1,0x8a,0xcc,0xef,0xf8,0x00,0x02,
+0xef,0x80,0x00,0x02,0xe7,0x00,0xe2,0x04,0x20,0x04,0x20,0xb8,0x00,0xf0,0x02,0x70,
+0x00,0x01,0x16,0xff,0x80,0x00,0xef,0xff,0xff,0x82,0xb1,0xff,0xff,0xff,0x80,0xc9,
+0x05,0x00,0xe0,0x9b,0xff,0xff,0xff,0x82,0xf3,0xbd,0xdf,0xff,0x80,0x10,0x00,0x03,
+0xef,0x35,0x02,0x20,0x3e,0x70,0xfc,0x07,0x0a,0x73,0x05,0x22,0x04,0xc2,0x6d,0x00,
+0xa0,0x0b,0xe1,0x00,0x00,0x06,0xf7,0x00,0xb7,0x0c,0xb0,0x4b,0x00,0xb0,0x05,0xf5,
+0x2f,0x3f,0xff,0xff,0xf8,0x2c,0x17,0xd0,0xb8,0x4b,0x00,0xb1,0xba,0x2f,0x18,0xbf,
+0xff,0xff,0xf8,0x09,0xb1,0xf2,0x7b,0x55,0x00,0x30,0x5e,0x0a,0x9a,0x89,0x00,0x30,
+0x2e,0x80,0xe4,0x8d,0x00,0x40,0x0c,0xa0,0x8d,0x00,0x91,0x00,0x31,0x10,0x7f,0x30,
+0x5f,0x00,0x24,0x4f,0x40,0x36,0x04,0x11,0x9f,0x29,0x01,0x40,0x9f,0xf9,0xbf,0xff,
+0xaa,0x03,0x30,0x00,0xdf,0xff,0x4d,0x00,0x90,0x0d,0xff,0xf8,0xaf,0xff,0xff,0x9b,
+0xff,0xf8,0x1d,0x01,0x80,0x6d,0xf8,0x00,0x00,0xcf,0xff,0x40,0x17,0xc9,0x01,0x11,
+0xa0,0xc8,0x01,0x61,0xfd,0xaa,0xaa,0xaa,0xaa,0xad,0x6c,0x01,0x00,0x2c,0x01,0x10,
+0x40,0xe0,0x00,0x80,0x50,0x00,0x00,0x0c,0xfb,0x00,0x00,0x03,0x31,0x02,0xf0,0x39,
+0xdf,0xff,0xc0,0x00,0x8f,0xff,0xff,0x70,0x2f,0xff,0xff,0xff,0x2a,0xff,0xff,0xff,
+0xf9,0xef,0xef,0xff,0xff,0xdf,0xb7,0xff,0xff,0xfe,0xce,0x2d,0xff,0xff,0xb5,0xfc,
+0x36,0xff,0xf3,0x07,0xff,0xff,0xf6,0x00,0x02,0x89,0x72,0x00,0x06,0x40,0x00,0x02,
+0x42,0xfa,0x00,0x03,0xef,0x2f,0xa0,0x04,0xff,0xf2,0xfa,0x05,0xff,0xff,0x2f,0xa6,
+0xff,0xff,0xf2,0xfe,0xff,0xff,0xff,0x2f,0xff,0x01,0xf1,0x07,0xfc,0xdf,0xff,0xff,
+0x2f,0xa1,0xdf,0xff,0xf2,0xfa,0x01,0xcf,0xff,0x2f,0xa0,0x00,0xbf,0xf2,0xf9,0x00,
+0x00,0x9c,0xbd,0x00,0x11,0x24,0x06,0x00,0x22,0xef,0xc3,0xb5,0x01,0x11,0x91,0x06,
+0x00,0x21,0xff,0x70,0x06,0x00,0x31,0xfd,0x40,0x00,0x9d,0x00,0x21,0x10,0xff,0x44,
+0x02,0x11,0xff,0x61,0x02,0x00,0x05,0x00,0x21,0xfe,0x50,0xe1,0x00,0x00,0x1e,0x00,
+0x10,0xb2,0x2a,0x00,0x10,0xd4,0x36,0x00,0x10,0xf7,0x42,0x00,0x11,0x48,0xd4,0x01,
+0xff,0x03,0x26,0x66,0x10,0x16,0x66,0x30,0xef,0xff,0xc0,0xaf,0xff,0xf1,0xff,0xff,
+0xe0,0xbf,0xff,0xf2,0x06,0x00,0x19,0xf0,0x02,0xd0,0xbf,0xff,0xf2,0xaf,0xff,0x80,
+0x6e,0xff,0xc0,0x26,0x66,0x66,0x66,0x66,0x50,0xef,0x6d,0x00,0x11,0xf4,0x7e,0x00,
+0x1f,0xf6,0x06,0x00,0x1c,0x11,0xf5,0xd2,0x02,0xf3,0x09,0xd1,0x05,0x00,0x00,0x06,
+0x45,0xfb,0x00,0x01,0xfc,0x6f,0xfc,0x10,0x1f,0xc6,0xff,0xfd,0x11,0xfc,0x6f,0xff,
+0xfd,0x3f,0xc6,0x12,0x05,0x00,0x1d,0x05,0xf4,0x05,0xfa,0xfc,0x6f,0xff,0xf7,0x1f,
+0xc6,0xff,0xf6,0x01,0xfc,0x6f,0xf5,0x00,0x1f,0xc3,0xe4,0x00,0x00,0xfb,0x3a,0x02,
+0x21,0x52,0x00,0xb0,0x01,0x30,0xe2,0x00,0x00,0x8d,0x03,0x00,0xfe,0x08,0x20,0x8f,
+0xff,0x07,0x00,0x00,0x3b,0x00,0x30,0xc0,0x00,0x5f,0x62,0x00,0x21,0xb0,0x0e,0x6f,
+0x00,0x82,0x40,0x8e,0xee,0xee,0xee,0xee,0xc1,0x02,0x8d,0x06,0x02,0x82,0x00,0x11,
+0x0f,0x07,0x00,0x30,0x60,0xcf,0xff,0x1e,0x04,0x02,0x63,0x06,0xd1,0x0b,0xf2,0x00,
+0x00,0xbf,0xf2,0x00,0x0b,0xff,0x30,0x00,0xbf,0xf3,0x07,0x00,0xb4,0x2f,0xf9,0x00,
+0x00,0x06,0xff,0x80,0x00,0x00,0x6f,0xf8,0x09,0x00,0x50,0xf4,0x00,0x00,0x05,0xb0,
+0xc4,0x02,0xb2,0x1e,0xc0,0x00,0x00,0x1e,0xfc,0x00,0x00,0x02,0xef,0xc0,0xab,0x05,
+0x01,0x09,0x00,0x20,0x7f,0xf4,0xc8,0x04,0x31,0x00,0x6f,0xf7,0x07,0x00,0x51,0x2f,
+0xf7,0x00,0x00,0x0a,0xc4,0x06,0x11,0x17,0x94,0x02,0x2f,0x8f,0xe0,0x06,0x00,0x01,
+0x15,0xdf,0xc1,0x01,0x8f,0xff,0xf5,0x36,0x66,0xbf,0xf6,0x66,0x50,0x2a,0x00,0x01,
+0x50,0x4d,0x90,0x00,0x00,0x01,0xc1,0x09,0x09,0x30,0x00,0xf4,0x43,0x35,0x55,0x55,
+0x55,0x55,0x40,0x00,0x00,0x5a,0xcd,0xc8,0x20,0x00,0x00,0x02,0xdf,0xd7,0x69,0xff,
+0x90,0x00,0x04,0xff,0xa0,0x01,0x02,0xef,0xc1,0x02,0xff,0xf1,0x02,0xfc,0x16,0xff,
+0xb0,0xcf,0xfb,0x05,0xaf,0xf9,0x1f,0xff,0x6d,0xff,0xb1,0xff,0xff,0xb1,0xff,0xf7,
+0x4f,0xfe,0x0b,0xff,0xf5,0x5f,0xfc,0x00,0x6f,0xf9,0x08,0xa5,0x1d,0xfd,0x20,0x00,
+0x5e,0xfb,0x53,0x6e,0xfb,0x10,0x00,0x00,0x07,0xce,0xfe,0xa4,0x00,0x00,0x32,0x0b,
+0x09,0x13,0xf5,0x09,0x00,0xe0,0x3e,0xf9,0x05,0xac,0xdb,0x71,0x00,0x00,0x00,0x1b,
+0xff,0xfd,0x76,0xaf,0x4e,0x02,0xf0,0x29,0x08,0xff,0x31,0x30,0x4f,0xfa,0x00,0x00,
+0x32,0x04,0xef,0xbf,0xc0,0x9f,0xf8,0x00,0x0e,0xf5,0x02,0xcf,0xff,0x64,0xff,0xf3,
+0x01,0xff,0xf6,0x00,0x9f,0xf8,0x4f,0xff,0x40,0x06,0xff,0xc0,0x00,0x6f,0xeb,0xff,
+0xa0,0x00,0x09,0xff,0x60,0x00,0x3e,0xff,0xc0,0x00,0x00,0x07,0xff,0xa4,0x30,0x1b,
+0x65,0x00,0x73,0x02,0x8d,0xff,0x80,0x08,0xfe,0x30,0xfc,0x03,0x13,0xef,0x47,0x0d,
+0x11,0x02,0x19,0x04,0x03,0xb7,0x03,0x22,0x0d,0xf8,0x08,0x00,0x12,0x7f,0x75,0x05,
+0x21,0x01,0xff,0x99,0x03,0x00,0x69,0x05,0x01,0xc9,0x0d,0x31,0x3f,0xf5,0x1a,0x25,
+0x07,0xf0,0x06,0xcf,0xf4,0x0a,0xff,0x60,0x00,0x00,0x05,0xff,0xf5,0x0a,0xff,0xe1,
+0x00,0x00,0x0e,0xff,0xf6,0x0b,0xff,0xf9,0x04,0x02,0xf2,0x07,0xfd,0x8f,0xff,0xff,
+0x20,0x02,0xff,0xff,0xf3,0x09,0xff,0xff,0xb0,0x0a,0xff,0xff,0xf7,0x1c,0xff,0xff,
+0xf4,0x0e,0x34,0x05,0x40,0xf8,0x04,0x9a,0xaa,0x01,0x00,0x11,0x91,0x5a,0x00,0x02,
+0x5e,0x08,0x60,0x3f,0xa0,0xef,0xfa,0x00,0x05,0x66,0x05,0xf0,0x02,0xf9,0x04,0xff,
+0xff,0xfb,0x11,0x3f,0xa4,0xff,0x84,0xfc,0x00,0x00,0x33,0xff,0x90,0x19,0xd5,0x01,
+0xd0,0xa2,0x01,0x70,0x00,0x02,0xef,0xa4,0xf6,0x3f,0xa0,0xef,0xff,0xb0,0x8d,0x05,
+0x00,0xdd,0x00,0x20,0xff,0xfb,0x51,0x05,0x21,0x14,0xfc,0x41,0x00,0x15,0x19,0xd6,
+0x04,0x20,0x5f,0xa0,0xcd,0x04,0x01,0x11,0x06,0xf0,0x08,0x5f,0xfa,0xff,0xa0,0x00,
+0x05,0xff,0x90,0x3f,0xfa,0x00,0x4f,0xf9,0x00,0x03,0xff,0xa0,0xbf,0x90,0x00,0x00,
+0x3f,0xf1,0xe6,0x0d,0x31,0x03,0x30,0x01,0x9f,0x04,0xf0,0x08,0x9f,0x50,0x00,0x00,
+0x1d,0xe1,0x8f,0xf5,0x00,0x01,0xdf,0xd0,0x08,0xff,0x50,0x1d,0xfd,0x10,0x00,0x8f,
+0xf6,0xdf,0xd1,0x61,0x01,0x20,0xfd,0x10,0xf8,0x01,0x11,0xd1,0x89,0x05,0x00,0x0b,
+0x00,0x23,0x7d,0x10,0x14,0x01,0x21,0xfd,0x18,0xe2,0x03,0xf3,0x0e,0x6f,0xff,0xfd,
+0x4a,0xaa,0xaa,0xfb,0x00,0x0c,0xda,0xf7,0xf4,0x00,0x00,0x0e,0xb0,0x00,0x00,0x9f,
+0x11,0x00,0x00,0x00,0xeb,0x00,0x00,0x09,0xf1,0x00,0x11,0x00,0xc0,0x10,0x00,0x02,
+0xe6,0xeb,0x9d,0x00,0x09,0xf9,0x99,0x99,0x4d,0x44,0x01,0x72,0x7f,0xff,0xff,0xfb,
+0x1d,0xff,0xa0,0x49,0x00,0x26,0x1d,0xa0,0x83,0x05,0x40,0x6b,0xcc,0xc7,0x00,0x60,
+0x07,0x42,0xff,0xf8,0x22,0x22,0x54,0x04,0x00,0xb8,0x06,0x0f,0x01,0x00,0x11,0x70,
+0xfa,0xff,0xff,0xff,0xff,0xff,0xfa,0x50,0x00,0x00,0x00,0x30,0x00,0x01,0x00,0x21,
+0x08,0xf8,0x07,0x00,0x30,0x8f,0xff,0x80,0x0d,0x00,0x20,0xff,0xff,0x0f,0x00,0xfb,
+0x04,0x7f,0xff,0xff,0xff,0x70,0x00,0x00,0x69,0x9f,0xff,0x99,0x60,0x00,0x00,0x00,
+0x2f,0xff,0x20,0x00,0x07,0x00,0xf0,0x04,0x46,0x66,0x2f,0xff,0x26,0x66,0x50,0xff,
+0xff,0x46,0x76,0x4f,0xff,0xf2,0xff,0xff,0xfc,0xbc,0xff,0x07,0x00,0x70,0xff,0xff,
+0xf3,0xb8,0xf2,0x9b,0xbb,0x01,0x00,0x11,0xa0,0x57,0x00,0x11,0x33,0x06,0x00,0x30,
+0x01,0xff,0xfa,0x07,0x00,0x30,0x07,0xff,0xff,0x07,0x00,0x30,0x0e,0xff,0xfd,0x07,
+0x00,0x12,0x0c,0x15,0x00,0x32,0x00,0xbf,0xf6,0x07,0x00,0x10,0xf1,0x06,0x00,0xf1,
+0x0e,0x06,0xff,0x80,0x00,0x01,0x50,0x00,0x4f,0xfd,0x00,0x03,0xaf,0xf8,0x07,0xff,
+0xf2,0x00,0x0e,0xff,0xff,0xef,0xfe,0x30,0x00,0x0b,0xff,0xff,0xff,0xc2,0xa0,0x00,
+0x70,0xd5,0x00,0x00,0x00,0x02,0x98,0x62,0x2d,0x00,0xf1,0x11,0x05,0x84,0x00,0x00,
+0x01,0x00,0x8f,0xff,0x60,0x00,0xaf,0xf3,0xec,0x2e,0xc0,0x1c,0xff,0xa0,0xde,0x9f,
+0xd1,0xdf,0xfa,0x00,0x3e,0xff,0xff,0xff,0xa0,0x00,0x00,0x2d,0x61,0x00,0x30,0x1c,
+0xff,0xf7,0x0b,0x00,0xf0,0x13,0xff,0xff,0x60,0x00,0xcf,0xaf,0xd2,0xef,0xf6,0x00,
+0xfb,0x0d,0xd0,0x2e,0xff,0x60,0xbf,0xef,0x80,0x02,0xef,0xf3,0x19,0xc8,0x00,0x00,
+0x16,0x40,0x00,0x02,0x66,0x66,0x12,0x00,0x64,0x00,0xff,0x05,0x3f,0x40,0x00,0x0c,
+0xff,0xff,0x3f,0xf2,0xdf,0x6c,0xff,0xff,0x53,0x31,0xff,0x7c,0xff,0xff,0xff,0xf6,
+0x06,0x00,0x0c,0xb0,0x7b,0xff,0xff,0xff,0xf5,0xff,0xc2,0x33,0x33,0x33,0x20,0x00,
+0x01,0xe0,0x20,0x00,0x8a,0xaa,0xaa,0xa9,0x00,0x00,0x49,0x99,0x99,0x99,0x60,0x00,
+0x12,0x00,0x30,0xf8,0x00,0xfa,0x02,0x01,0x10,0x80,0x8d,0x00,0x21,0xef,0xf3,0x06,
+0x00,0x70,0xf5,0xfe,0xaa,0xaa,0xaa,0xff,0xf5,0x1e,0x00,0x00,0x06,0x00,0x20,0x80,
+0x4f,0x06,0x00,0x20,0x10,0x0c,0x06,0x00,0x20,0x50,0x1e,0x06,0x00,0x50,0xfb,0xef,
+0xff,0xf5,0x9f,0x1e,0x00,0x81,0xd1,0xcd,0xdd,0xdd,0xdd,0xdd,0xd4,0xef,0x2a,0x00,
+0x17,0x00,0x01,0x00,0x7f,0xbc,0xcc,0xcc,0xcc,0xcc,0xc3,0xff,0x18,0x00,0x10,0x10,
+0x6b,0x12,0x00,0x31,0xcb,0x6f,0xff,0x01,0x00,0x11,0x9f,0x06,0x00,0x11,0x95,0x0e,
 0x00,0x70,0x65,0xf9,0x3d,0xff,0xff,0xfd,0x39,0x03,0x00,0x20,0xf9,0x3d,0x10,0x00,
-0x11,0xa4,0x17,0x00,0x2c,0xb7,0xbf,0x2b,0x02,0x30,0x55,0x55,0x20,0x63,0x37,0x10,
-0x90,0x72,0x03,0x10,0x40,0x84,0x01,0x00,0xda,0x03,0x40,0xfc,0x44,0x40,0x0c,0xd2,
-0x0b,0x12,0x0e,0xa0,0x07,0x20,0xff,0xfe,0x45,0x02,0x10,0xf6,0xc9,0x01,0x10,0xc0,
-0xc3,0x06,0x01,0x8c,0x70,0x00,0xf4,0x01,0x10,0xf1,0x3e,0x03,0x05,0x25,0x22,0xb0,
-0x35,0x6e,0xf7,0x54,0x00,0x00,0xff,0xf9,0x8f,0xff,0x10,0x1d,0x01,0x00,0x06,0x00,
-0xb0,0xfa,0x24,0x44,0x01,0x00,0xff,0xf4,0xef,0xff,0x3e,0x20,0x9b,0x06,0x20,0x3f,
-0xe2,0x06,0x00,0x21,0x43,0x31,0xa7,0x06,0x18,0xf6,0x06,0x00,0x40,0x23,0x30,0xff,
-0xff,0xb2,0x0a,0x02,0x06,0x00,0x44,0x7a,0xaa,0xaa,0xa2,0xdc,0x68,0x11,0x1f,0xd4,
-0x13,0x31,0xef,0xfa,0x10,0x50,0x06,0x31,0xd0,0x00,0x01,0x1a,0x6a,0x11,0x04,0xba,
-0x47,0x11,0x07,0x92,0x0a,0x11,0x09,0x3e,0x65,0x20,0x0d,0xff,0x6d,0x72,0x10,0x7f,
-0x06,0x00,0x12,0xd0,0x0b,0x07,0x20,0x13,0x33,0xb9,0x01,0x41,0x00,0x00,0xcf,0xf2,
-0xc4,0x0b,0x10,0x50,0xea,0x37,0x01,0x01,0x00,0x12,0x2f,0x03,0x01,0xf0,0x1a,0xf9,
-0xfa,0x0d,0x01,0xb0,0xd0,0xa2,0x0f,0xaf,0xeb,0xfb,0xcf,0xbf,0xbe,0xcb,0xfa,0xff,
-0xe1,0x98,0x1c,0x1c,0x15,0xff,0xaf,0xfd,0x08,0x70,0xb0,0xb0,0x3f,0xfa,0xff,0xdf,
-0xdd,0xdd,0xdd,0xfd,0xdf,0xaf,0xa0,0xd0,0xdd,0x1e,0xa8,0xfa,0xfe,0xaf,0xaa,0xaa,
-0xaa,0xeb,0xaf,0x9a,0xff,0x80,0x01,0x12,0x41,0xf1,0x25,0x21,0xef,0xd0,0x2a,0x6c,
-0x01,0xfc,0x86,0x81,0x29,0xff,0xff,0xff,0x50,0x00,0x03,0xbf,0x45,0x80,0x12,0x3c,
-0xc8,0x6a,0x13,0x0f,0x35,0x6f,0x12,0x9e,0x10,0x08,0x00,0x8f,0x04,0x00,0x43,0x78,
-0x00,0x9c,0x04,0x12,0xf9,0xa9,0x04,0x02,0x7f,0x03,0x13,0x05,0x0f,0x04,0x26,0x4f,
-0xf3,0xd4,0x40,0x30,0x34,0x44,0x43,0x4f,0x01,0x20,0xfb,0x8a,0x05,0x00,0xc1,0x8f,
-0xa0,0xff,0xff,0xfb,0x7f,0xf8,0xff,0xff,0xfc,0x11,0x11,0xaa,0x0c,0x0f,0x05,0x00,
-0x10,0x50,0xbd,0xdd,0xdd,0xdd,0xd8,0x9f,0x01,0x12,0x54,0xac,0x0e,0xf0,0x01,0xff,
-0xff,0xff,0xd8,0x10,0x00,0x04,0xef,0xff,0xdb,0xbc,0xff,0xff,0x70,0x08,0xff,0x4d,
-0x79,0xf0,0x0c,0x4b,0xff,0xb0,0xbf,0x70,0x00,0x13,0x32,0x00,0x05,0xed,0x10,0x30,
-0x06,0xdf,0xff,0xfe,0x80,0x01,0x10,0x00,0x0b,0xff,0xfc,0xce,0xff,0xd2,0xc0,0x7a,
-0x31,0x60,0x00,0x04,0x3b,0x3d,0x32,0x10,0x03,0x40,0xfc,0x0d,0x23,0x04,0xff,0x14,
-0x2c,0x23,0x6f,0xfa,0x1b,0x14,0x10,0xac,0x72,0x04,0x03,0x19,0x0b,0x31,0xd2,0x0f,
-0xea,0x68,0x01,0xc1,0xcf,0x90,0xfa,0x48,0x88,0x88,0x88,0x88,0x65,0xff,0x1f,0xa9,
-0x3d,0x0c,0x32,0x1a,0xf1,0xfa,0xfa,0x02,0x30,0xaf,0x1f,0xa5,0x70,0x0e,0x41,0x98,
-0x5f,0xf1,0xfd,0xf8,0x3a,0x33,0x9b,0xfa,0x0b,0x98,0x02,0x06,0x0c,0x16,0x0f,0x4d,
-0x00,0x03,0x22,0x30,0x05,0x4d,0x00,0x23,0xf7,0x00,0x4d,0x00,0x22,0x70,0x01,0x4d,
-0x00,0x2f,0x94,0x00,0x4d,0x00,0x1e,0x22,0x00,0x00,0x4d,0x00,0x23,0xf0,0x00,0x4d,
-0x00,0x22,0x00,0x00,0x4d,0x00,0x2f,0x90,0x00,0x4d,0x00,0x1d,0x23,0x85,0x00,0x4d,
-0x00,0x22,0xa0,0x00,0x4d,0x00,0x23,0xfa,0x00,0x4d,0x00,0x2f,0x60,0x00,0x4d,0x00,
-0x1d,0x22,0x00,0x00,0x4d,0x00,0x01,0x0c,0x02,0x00,0x4d,0x00,0x02,0x62,0x01,0x13,
-0xaf,0x11,0x00,0x0f,0x4d,0x00,0x09,0x10,0x00,0x9e,0x44,0x13,0x50,0x95,0x02,0x12,
-0xfc,0x01,0x17,0x11,0xd0,0x11,0x00,0x31,0x64,0x00,0xa5,0x56,0x09,0xf0,0x06,0xbf,
-0xf6,0x4e,0x21,0x11,0x11,0x17,0xd3,0x0f,0xff,0xec,0xce,0xec,0xcc,0xcc,0xef,0xe1,
-0x7f,0xe3,0x00,0x2d,0x81,0x1f,0x00,0xd9,0x01,0x23,0x97,0x0a,0x50,0x2c,0x14,0xcc,
-0x98,0x06,0x2a,0x2f,0xfa,0x85,0x5c,0x10,0x10,0x89,0x00,0x00,0x96,0x83,0xf0,0x30,
-0xdf,0xf8,0xcf,0xf8,0x00,0x7f,0xff,0x81,0xdf,0xf1,0x0c,0xfa,0xf8,0x52,0xdf,0x60,
-0xff,0x64,0x78,0x3a,0xf8,0x0f,0xff,0x50,0x08,0xff,0xa1,0xff,0xff,0x12,0xff,0xfa,
-0x0f,0xff,0x41,0x15,0xff,0xa0,0xef,0x46,0x88,0x48,0xf8,0x0b,0xfc,0xf8,0x42,0xef,
-0x50,0x5f,0xff,0x82,0xef,0xf1,0x00,0xaf,0xfa,0xef,0xf6,0x00,0x00,0x5a,0xdc,0xbe,
-0x1a,0x00,0x72,0x88,0x62,0x78,0x8b,0xff,0xfe,0x88,0x82,0x53,0x03,0x11,0x12,0xde,
-0x4a,0x11,0x3f,0x68,0x87,0xbf,0x3f,0xfc,0xfc,0xfe,0xdf,0x90,0x3f,0xd5,0xf4,0xeb,
-0x7f,0x06,0x00,0x07,0x61,0xe6,0xf5,0xec,0x8f,0x90,0x2f,0x54,0x03,0x66,0x07,0x9a,
-0xaa,0xaa,0xa9,0x10,0xb8,0x84,0x42,0x00,0x03,0xef,0xa0,0x89,0x06,0x10,0xf9,0x0d,
-0x00,0x30,0xc3,0xdf,0xff,0x3b,0x09,0x30,0xfd,0x3d,0xf5,0x1a,0x00,0x40,0xff,0xd3,
-0x50,0x00,0x49,0x06,0x02,0x0d,0x00,0x21,0xff,0x60,0x0d,0x00,0x15,0xf6,0x0d,0x00,
-0x11,0x0b,0x0d,0x00,0x00,0x51,0x04,0x01,0x89,0x60,0x00,0x0d,0x00,0x00,0x12,0x32,
-0x03,0x66,0x01,0x10,0x8b,0x73,0x05,0x14,0xb6,0xb8,0x01,0xf1,0x0c,0xf2,0x00,0xbf,
-0xff,0xf8,0xbf,0xf6,0xef,0xff,0x40,0xbf,0xff,0xff,0x10,0xa4,0x09,0xff,0xf4,0xaf,
-0xff,0xff,0xfd,0x10,0x07,0xff,0xff,0x4d,0xb7,0x3c,0xf3,0x07,0xbf,0xff,0xf4,0x1d,
-0xff,0xff,0xf4,0x06,0x10,0xbf,0xff,0x40,0x1d,0xff,0xff,0x47,0xfd,0x2b,0xff,0xf4,
-0x00,0x1d,0xb7,0x01,0x00,0x2f,0x10,0x01,0xcf,0x06,0x50,0x08,0x99,0x99,0x70,0x00,
-0x52,0x0d,0x60,0x0a,0xd0,0xd0,0xd0,0xeb,0x9f,0x05,0x00,0x51,0xff,0xd1,0xd1,0xd1,
-0xeb,0xa0,0x4c,0x0f,0x05,0x00,0x0b,0x10,0xef,0xc6,0x05,0x52,0x5c,0xdd,0xdd,0xdd,
-0xb2,0x9f,0x00,0x11,0xb0,0x37,0x05,0x40,0x0b,0xf0,0x00,0x9f,0x93,0x26,0x82,0xf0,
-0x0a,0xff,0x21,0x11,0x11,0x1f,0xf0,0xad,0x00,0x12,0xf0,0x22,0x06,0x42,0xd0,0x08,
-0xff,0x10,0xbe,0x08,0x03,0xb5,0x74,0x0e,0xed,0x62,0x2f,0xfc,0x00,0x01,0x00,0x56,
-0x04,0xe2,0x06,0x17,0xf4,0x14,0x00,0x7e,0xfb,0xfa,0x00,0xfe,0xfa,0x00,0xf8,0x9c,
-0x00,0x0f,0x01,0x00,0x45,0x4f,0x02,0x02,0x00,0x02,0x69,0x00,0x52,0x2f,0xef,0x00,
-0x01,0x00,0x68,0x1f,0xe9,0x71,0x00,0x5d,0x03,0xd4,0x01,0xa2,0xfa,0x00,0xff,0x00,
-0x00,0xf3,0xfe,0xf7,0xf9,0x00,0x0f,0x0a,0x00,0x0f,0x00,0x4f,0xfe,0xff,0xfb,0xfd,
-0xde,0x01,0x51,0x30,0xfd,0x00,0xfe,0x81,0x00,0x0f,0x01,0x00,0x53,0x1c,0xfd,0x0a,
-0x00,0x19,0xff,0x1f,0x00,0x1f,0xfe,0x79,0x00,0x46,0x13,0xf6,0x5e,0x00,0x00,0xee,
-0x00,0x3f,0xfe,0xfc,0xfe,0xe8,0x01,0x5d,0x15,0x02,0xe2,0x00,0x11,0xfe,0x87,0x00,
-0x2f,0xfe,0xfd,0x83,0x00,0x4a,0x11,0xe8,0x49,0x03,0x15,0xe5,0x77,0x00,0x20,0xfd,
-0xfe,0x73,0x00,0x01,0x7e,0x00,0x0f,0xea,0x00,0x51,0x01,0xc3,0x7b,0x1f,0xfd,0x61,
-0x01,0x5a,0x1f,0xfe,0x2e,0x04,0x60,0x19,0xfa,0xd1,0x02,0x01,0x5c,0x02,0x10,0xfd,
-0x8b,0x00,0x1f,0xfc,0x4e,0x03,0x46,0x14,0xde,0x65,0x01,0x97,0xf9,0x00,0x00,0xe4,
-0xfb,0xee,0xf1,0x00,0xe8,0x92,0x06,0x2f,0xf2,0xf7,0xed,0x00,0x49,0x11,0xdf,0x1a,
-0x77,0x13,0xec,0xe9,0x00,0x20,0xfd,0x00,0x0c,0x0a,0x00,0x0f,0x0a,0x0f,0x17,0x06,
-0x54,0x10,0xfc,0xc4,0x02,0x1f,0xfc,0xe3,0x01,0x5e,0x10,0xf8,0x59,0x02,0x1f,0xfb,
-0xe1,0x00,0x52,0x00,0x05,0x00,0x93,0xea,0xe8,0x00,0x00,0xf8,0xfd,0xe8,0xfe,0x02,
-0x70,0x07,0xdf,0xf5,0xf6,0x00,0xf5,0xf6,0xf8,0xf4,0x00,0xf6,0xf9,0xfa,0xf8,0xfa,
-0xb2,0x03,0x47,0x66,0xe9,0xfc,0x00,0x00,0xf8,0xff,0x11,0x00,0xae,0xfb,0xfc,0x00,
-0x00,0xfb,0xfd,0x00,0x00,0xfd,0xff,0x4f,0x7f,0x0f,0x77,0x00,0x38,0x22,0xf4,0xfa,
-0xf7,0x00,0x13,0x01,0x3b,0x0b,0x23,0xfd,0xfd,0xaa,0x04,0x1f,0x00,0xd8,0x08,0x4b,
-0x14,0xfb,0xb8,0x03,0x15,0x01,0x8b,0x06,0x02,0x94,0x05,0x0f,0xf8,0x06,0x48,0xf0,
-0x0a,0x02,0xfb,0xeb,0xfb,0x00,0x00,0xf6,0xfd,0xf6,0xfe,0x02,0xf6,0x02,0x02,0x01,
-0x02,0x00,0x02,0xf9,0xf9,0xfe,0xfc,0xf9,0xfc,0xfa,0x8d,0x06,0x3f,0xfe,0xfd,0x02,
-0x64,0x02,0x4a,0x2a,0x01,0xfd,0x2a,0x05,0x02,0xee,0x00,0x1f,0xfd,0x96,0x05,0x52,
-0x0f,0x99,0x05,0x57,0x1f,0xf9,0x20,0x06,0x63,0x0f,0x47,0x01,0x0a,0x1f,0xff,0x73,
-0x07,0x46,0x1f,0xff,0x22,0x0b,0x63,0x1f,0xff,0x94,0x00,0x63,0x1e,0x02,0x87,0x04,
-0x19,0x02,0xd4,0x01,0x1f,0x02,0x7b,0x0d,0x4a,0x0f,0x01,0x00,0x71,0x0f,0x49,0x03,
-0x4f,0x1f,0xf2,0x7f,0x00,0x0b,0x2f,0xfe,0xfe,0x32,0x0a,0x47,0x1c,0xf4,0x0e,0x07,
-0x11,0xfe,0xdf,0x01,0x10,0x05,0x08,0x07,0x0f,0x68,0x01,0xbb,0x1d,0x02,0x57,0x02,
-0x00,0xeb,0x0d,0x1f,0x01,0x28,0x05,0x51,0x1f,0xf3,0xca,0x02,0x77,0x1f,0xfe,0x77,
-0x00,0xcc,0x0f,0xe3,0x00,0x64,0x0f,0x6f,0x0a,0x18,0x1f,0xfc,0xc1,0x00,0x0c,0x1f,
-0xfe,0xef,0x12,0x42,0x2f,0xfa,0xfa,0x9f,0x0d,0x58,0x05,0x6d,0x00,0x34,0xfa,0xf6,
-0xfa,0x46,0x62,0x1e,0xfa,0xc4,0x0d,0x0f,0x1d,0x01,0x02,0x3f,0xfc,0xfc,0xfc,0x54,
-0x01,0x34,0x1f,0xf8,0xcb,0x01,0x6d,0x0f,0x01,0x00,0x44,0x2e,0xf1,0xf6,0xe7,0x00,
-0x0f,0x1d,0x15,0x50,0x29,0xf6,0xf6,0x48,0x4b,0x1f,0xf8,0x41,0x03,0x65,0x04,0x5d,
-0x02,0x1f,0x08,0xee,0x00,0x52,0x0f,0x1e,0x04,0x5d,0x0a,0x5c,0x02,0x1f,0xf1,0x9e,
-0x04,0x64,0x1e,0xf4,0x2f,0x04,0x0f,0x63,0x02,0x41,0x2b,0xef,0xeb,0xca,0x02,0x02,
-0x75,0x08,0x1f,0xf1,0x2b,0x04,0x11,0x03,0xb9,0x08,0x3f,0xed,0xf1,0xed,0x41,0x03,
-0x1f,0x1f,0xeb,0x77,0x08,0x02,0x1f,0xf6,0x3c,0x00,0x12,0x03,0x07,0x00,0x2f,0xf1,
-0xf1,0xce,0x12,0x3a,0x0f,0x30,0x03,0x50,0x0f,0x49,0x19,0x68,0x05,0x5f,0x01,0x1f,
-0x06,0x38,0x12,0x4f,0x0f,0x98,0x04,0x63,0x52,0xf6,0xfa,0xfa,0x00,0xfa,0xf9,0x06,
-0x00,0xd0,0x01,0x23,0xf4,0xfc,0x63,0x01,0x10,0xf6,0xf7,0x00,0x1f,0xfc,0xee,0x00,
-0x48,0x0f,0xed,0x08,0x62,0x16,0xf8,0xe9,0x07,0x00,0xee,0x00,0x20,0xfa,0xf8,0x08,
-0x00,0x3f,0xfe,0x00,0xf6,0xf7,0x15,0x50,0x00,0x4d,0x01,0x3f,0xfc,0x02,0x02,0x92,
-0x14,0x5f,0x1f,0xfa,0x36,0x0a,0x8a,0x0f,0x6f,0x08,0x49,0x2f,0xf1,0xf6,0x64,0x02,
-0x62,0x1f,0xf8,0x66,0x00,0x5c,0x1f,0xfa,0xd5,0x08,0x58,0x18,0xfa,0xea,0x07,0x01,
-0x87,0x00,0x2f,0xf8,0xfc,0x4f,0x02,0x5b,0x1f,0xfc,0x16,0x0c,0x58,0x0c,0xdc,0x00,
-0x0f,0x5a,0x10,0x5e,0x0f,0xb2,0x0a,0x18,0x1f,0xfc,0x46,0x0c,0x2e,0x0c,0x39,0x11,
-0x1e,0xfc,0x7b,0x0d,0x0f,0x9e,0x06,0x5e,0x0f,0xba,0x0a,0x58,0x0f,0x39,0x0b,0x53,
-0x2f,0xeb,0xeb,0xba,0x01,0x0c,0x17,0xf6,0x8d,0x00,0x18,0xf8,0x1d,0x00,0x32,0xfc,
-0x00,0xed,0x6d,0x03,0x10,0xfc,0x6d,0x0e,0x23,0xf1,0xf6,0x04,0x0a,0x2f,0xf8,0xf4,
-0x87,0x05,0x34,0x00,0x50,0x0a,0x07,0x5e,0x03,0x00,0x62,0x04,0x13,0xfc,0xb7,0x06,
-0x18,0xfc,0xf4,0x03,0x1f,0xfa,0xc3,0x06,0x18,0x1f,0xfa,0xfe,0x05,0x63,0x2f,0xf4,
-0xf4,0x9c,0x06,0x33,0x1f,0xfa,0x04,0x0d,0x24,0x0f,0x71,0x06,0x89,0x1e,0xfa,0x16,
-0x0c,0x0f,0xf7,0x00,0x23,0x2f,0xed,0xef,0x19,0x15,0x12,0x26,0xf8,0xf8,0x0a,0x02,
-0x05,0xaa,0x00,0x26,0xf4,0xf6,0x6e,0x03,0x2f,0xef,0xf8,0x6c,0x01,0x1a,0x2f,0xf1,
-0xef,0xdc,0x01,0x1d,0x1e,0x02,0xa1,0x01,0x0f,0xad,0x01,0x1f,0x2f,0xef,0xed,0xfd,
-0x01,0x21,0x02,0x86,0x00,0x44,0xf4,0xf8,0xf8,0xf8,0x75,0x0a,0x24,0xf1,0xfa,0x5d,
-0x05,0x0f,0x77,0x00,0x13,0x1f,0xef,0x61,0x03,0x0e,0x1f,0xfc,0x1c,0x00,0x07,0x05,
-0x05,0x01,0x2f,0xfe,0xf6,0xcb,0x05,0x3d,0x0f,0x71,0x08,0x42,0x2f,0xed,0xed,0x6f,
-0x03,0x27,0x12,0xfc,0x65,0x01,0x0f,0xdc,0x01,0x22,0x1f,0xf1,0xee,0x17,0x27,0x0e,
-0x53,0x02,0x0f,0x1b,0x0b,0x53,0x06,0xab,0x14,0x0f,0x51,0x15,0x50,0x05,0xaa,0x00,
-0x28,0xfc,0xf4,0x5b,0x05,0x1f,0xf6,0xe7,0x11,0x5b,0x00,0xbc,0x10,0x1f,0xfa,0xdb,
-0x12,0x66,0x1f,0xfc,0xce,0x17,0x1b,0x1f,0xfe,0xb1,0x0d,0x2e,0x1f,0xfe,0xf9,0x06,
-0x47,0x0f,0x19,0x06,0x0e,0x1f,0xfc,0x77,0x00,0x63,0x0f,0x1b,0x18,0x58,0x1f,0xfa,
-0x84,0x00,0x27,0x0f,0x4c,0x05,0x1a,0x1f,0x04,0x77,0x00,0x36,0x2f,0xf4,0xf6,0xdc,
-0x01,0x35,0x1f,0xfe,0xca,0x02,0x55,0x0f,0x62,0x15,0x29,0x1f,0xfa,0x98,0x16,0x3c,
-0x0f,0x53,0x02,0x33,0x1f,0xf4,0xed,0x0a,0x14,0x1f,0xfa,0x77,0x00,0x3b,0x1f,0xf1,
-0xee,0x00,0x43,0x0f,0xbc,0x0f,0x29,0x1f,0xfc,0xa3,0x18,0x63,0x1f,0xf6,0xda,0x12,
-0x51,0x1f,0xfc,0x02,0x13,0x57,0x12,0xfc,0xe5,0x0d,0x1f,0xfa,0x80,0x00,0x13,0x1f,
-0xfc,0xe5,0x00,0x4f,0x1f,0x06,0xc5,0x0c,0x63,0x1f,0x06,0x78,0x00,0x05,0x1f,0x0a,
-0xd2,0x01,0x7f,0x0f,0x7b,0x0d,0x17,0x1f,0xfc,0x23,0x22,0x14,0x1e,0xfa,0x2f,0x06,
-0x0f,0x2f,0x04,0x29,0x0f,0x19,0x03,0x44,0x0f,0x77,0x00,0x39,0x0f,0x2c,0x0f,0x46,
-0x2f,0x04,0x04,0x1a,0x19,0x36,0x0f,0x74,0x17,0xa2,0x09,0xa2,0x0b,0x0f,0x41,0x13,
-0x17,0x2f,0xef,0xef,0xb1,0x01,0x27,0x17,0xef,0x21,0x12,0x0f,0xf2,0x11,0x1c,0x1f,
-0xfc,0x26,0x02,0x3c,0x1f,0xfc,0x7b,0x0d,0x40,0x0b,0xd9,0x21,0x4f,0xfc,0xfe,0xfe,
-0xfe,0x82,0x0a,0x24,0x2f,0xf4,0xf8,0xe0,0x23,0x88,0x1f,0xfa,0x3f,0x01,0x0e,0x1f,
-0xfc,0xe9,0x12,0x63,0x0f,0x8d,0x0c,0x3c,0x1f,0xfa,0xf4,0x03,0x09,0x1e,0xfe,0x95,
-0x0f,0x0f,0x04,0x0d,0x42,0x19,0xfc,0x38,0x10,0x17,0xf6,0xd1,0x0f,0x2f,0xfc,0xfa,
-0x69,0x0e,0x2b,0x2e,0xf4,0xf4,0xa1,0x06,0x05,0xc8,0x02,0x28,0xf6,0xf6,0x52,0x01,
-0x44,0xf4,0xfc,0xfe,0xfe,0x2f,0x04,0x26,0xfa,0xf8,0x32,0x04,0x03,0xa2,0x31,0x21,
-0x02,0x03,0x91,0x06,0x2e,0x04,0x05,0xad,0x07,0x03,0x73,0xd2,0x00,0x74,0xd2,0x92,
-0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x78,0xd2,0x02,0x60,0x3b,0x70,0x1b,
-0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x42,0x88,0xff,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,
-0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0xcb,0x00,0x08,0xf0,0x11,0x29,0x2a,
-0x2b,0x00,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x00,0x33,0x00,0x34,0x35,0x00,0x00,
-0x36,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x00,0x3d,0x3e,0x3f,0x40,0x41,0x42,0xfd,0xb8,
-0x91,0x44,0x45,0x46,0x47,0x48,0x00,0x49,0x31,0x4a,0xdd,0xcc,0xf1,0x1b,0x31,0x4d,
-0x4e,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x00,0x5a,0x5b,
-0x5c,0x5d,0x5e,0x5f,0x60,0x61,0x62,0x63,0x64,0x2d,0x65,0x66,0x00,0x67,0x68,0x69,
-0x6a,0x6a,0x6b,0x00,0x6c,0x6d,0x6e,0x00,0x4a,0x9f,0x10,0x70,0x1c,0xa7,0x30,0x2d,
-0x72,0x73,0x0e,0x54,0x8f,0x75,0x76,0x77,0x00,0x78,0x79,0x7a,0x00,0x01,0x00,0xff,
-0x48,0x02,0x46,0x02,0x20,0x03,0x02,0x41,0x02,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,
-0x31,0x09,0x00,0x0a,0xf1,0xa0,0x11,0x0b,0xa3,0x5c,0x02,0xff,0xa0,0x00,0xc3,0xd4,
-0x00,0xc2,0xd4,0x02,0xf5,0xad,0x72,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x80,0x44,
-0xfe,0x01,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,
-0x00,0x23,0x73,0x00,0x01,0x51,0x48,0xf1,0x01,0x25,0x26,0x27,0x28,0x00,0x29,0x00,
-0x2a,0x2b,0x2c,0x2d,0x00,0x2a,0x2a,0x00,0x00,0x4e,0x02,0x30,0x33,0x34,0x35,0x4a,
-0x02,0x71,0x00,0x3a,0x3b,0x3c,0x3c,0x3d,0x3e,0xc9,0xce,0x43,0x40,0x41,0x00,0x42,
-0x4e,0x02,0x50,0x49,0x4a,0x00,0x4b,0x4b,0xd4,0xb0,0x01,0x4b,0x02,0x00,0x4c,0x02,
-0x01,0x4d,0x02,0x22,0x55,0x43,0x4e,0x02,0x11,0x55,0x4f,0x02,0x40,0x00,0x00,0x65,
-0x66,0x4f,0x02,0x00,0x20,0x42,0x01,0x50,0x02,0xdf,0x70,0x71,0x72,0x00,0x00,0x73,
-0x00,0x74,0x75,0x00,0x00,0x76,0x77,0x40,0x02,0xff,0x43,0x50,0x00,0x00,0x00,0x00,
-0x00,
+0x11,0xa4,0x17,0x00,0x33,0xb7,0xbf,0xff,0x01,0x00,0x12,0xfa,0x06,0x00,0xe0,0x00,
+0x55,0x55,0x20,0x00,0x03,0xff,0xff,0x90,0x00,0x05,0xff,0xff,0x40,0x84,0x01,0xf0,
+0x06,0x00,0x00,0x0a,0xff,0xfc,0x44,0x40,0x0c,0xff,0xff,0xff,0xf0,0x0e,0xff,0xff,
+0xff,0x80,0x0d,0xff,0xff,0xfe,0x45,0x02,0x10,0xf6,0xc9,0x01,0xa0,0xc0,0x00,0x00,
+0x00,0xff,0x30,0x00,0x00,0x03,0xfa,0xf4,0x01,0x00,0xd7,0x01,0x24,0x03,0x50,0x9f,
+0x00,0xb0,0x35,0x6e,0xf7,0x54,0x00,0x00,0xff,0xf9,0x8f,0xff,0x10,0x1d,0x01,0x00,
+0x06,0x00,0xf0,0x02,0xfa,0x24,0x44,0x01,0x00,0xff,0xf4,0xef,0xff,0x3e,0x20,0xff,
+0xf4,0xff,0xff,0x3f,0xe2,0x06,0x00,0x41,0x43,0x31,0xff,0xf4,0x5f,0x01,0x07,0x06,
+0x00,0x20,0x23,0x30,0x06,0x00,0x22,0x00,0x00,0x06,0x00,0x71,0x7a,0xaa,0xaa,0xa2,
+0x00,0x00,0x03,0x56,0x00,0x20,0x1f,0x70,0x6a,0x00,0x30,0xef,0xfa,0x10,0xc8,0x02,
+0xe0,0xff,0xd0,0x00,0x01,0xff,0xff,0xff,0xf7,0x00,0x04,0xff,0xff,0xff,0xfb,0x75,
+0x02,0x40,0xff,0xfd,0x00,0x09,0x6d,0x00,0x20,0x00,0x0d,0x06,0x00,0x20,0x30,0x7f,
+0x06,0x00,0x11,0xd0,0x53,0x01,0x30,0xf4,0x13,0x33,0xb9,0x01,0x40,0x00,0x00,0xcf,
+0xf2,0x48,0x00,0x61,0x29,0x50,0x00,0x00,0x5a,0xaa,0x01,0x00,0x12,0x2f,0x03,0x01,
+0xf8,0x28,0xf9,0xfa,0x0d,0x01,0xb0,0xd0,0xa2,0x0f,0xaf,0xeb,0xfb,0xcf,0xbf,0xbe,
+0xcb,0xfa,0xff,0xe1,0x98,0x1c,0x1c,0x15,0xff,0xaf,0xfd,0x08,0x70,0xb0,0xb0,0x3f,
+0xfa,0xff,0xdf,0xdd,0xdd,0xdd,0xfd,0xdf,0xaf,0xa0,0xd0,0x00,0x00,0x0a,0x20,0xfa,
+0xfe,0xaf,0xaa,0xaa,0xaa,0xeb,0xaf,0x9a,0xff,0x80,0x01,0x31,0x41,0x00,0x00,0x9e,
+0x00,0x10,0xd0,0x09,0x03,0x30,0x8f,0xff,0xfc,0x68,0x00,0x60,0xff,0xff,0xff,0x50,
+0x00,0x03,0x69,0x01,0x41,0xe0,0x00,0x3c,0xff,0xae,0x00,0x31,0x0f,0xff,0xff,0x45,
+0x01,0x20,0x9e,0xff,0x51,0x01,0x00,0x33,0x00,0x31,0x5f,0xff,0xf1,0xe6,0x02,0x32,
+0xff,0xf9,0x00,0x0f,0x00,0x12,0x20,0x0f,0x00,0x02,0x5a,0x03,0x22,0x4f,0xf3,0x5f,
+0x00,0x70,0x76,0x00,0x00,0x00,0x34,0x44,0x43,0x4f,0x01,0x20,0xfb,0x8a,0x05,0x00,
+0xc0,0x8f,0xa0,0xff,0xff,0xfb,0x7f,0xf8,0xff,0xff,0xfc,0x11,0x11,0x4c,0x00,0x1f,
+0xfc,0x05,0x00,0x10,0x50,0xbd,0xdd,0xdd,0xdd,0xd8,0x9f,0x01,0x20,0x54,0x10,0x54,
+0x00,0xf0,0x29,0x6c,0xff,0xff,0xff,0xd8,0x10,0x00,0x04,0xef,0xff,0xdb,0xbc,0xff,
+0xff,0x70,0x08,0xff,0xd6,0x10,0x00,0x00,0x4b,0xff,0xb0,0xbf,0x70,0x00,0x13,0x32,
+0x00,0x05,0xed,0x10,0x30,0x06,0xdf,0xff,0xfe,0x80,0x01,0x10,0x00,0x0b,0xff,0xfc,
+0xce,0xff,0xd2,0x00,0x00,0x00,0xbe,0x60,0x00,0x04,0xde,0x3d,0x00,0x41,0x10,0x03,
+0x40,0x00,0x45,0x00,0x32,0x04,0xff,0x80,0xa2,0x00,0x32,0x6f,0xfa,0x00,0x06,0x04,
+0x10,0xac,0x72,0x04,0x12,0xaf,0x1d,0x01,0x31,0xd2,0x0f,0xea,0x68,0x01,0xd0,0xcf,
+0x90,0xfa,0x48,0x88,0x88,0x88,0x88,0x65,0xff,0x1f,0xa9,0xff,0xab,0x01,0x32,0x1a,
+0xf1,0xfa,0xfa,0x02,0xc0,0xaf,0x1f,0xa5,0x99,0x99,0x99,0x99,0x98,0x5f,0xf1,0xfd,
+0x99,0x01,0x00,0x33,0x9b,0xfa,0x0b,0x98,0x02,0x15,0x30,0xee,0x02,0x0f,0x4d,0x00,
+0x03,0x22,0x30,0x05,0x4d,0x00,0x23,0xf7,0x00,0x4d,0x00,0x22,0x70,0x01,0x4d,0x00,
+0x2f,0x94,0x00,0x4d,0x00,0x1e,0x22,0x00,0x00,0x4d,0x00,0x23,0xf0,0x00,0x4d,0x00,
+0x22,0x00,0x00,0x4d,0x00,0x2f,0x90,0x00,0x4d,0x00,0x1d,0x23,0x85,0x00,0x4d,0x00,
+0x22,0xa0,0x00,0x4d,0x00,0x23,0xfa,0x00,0x4d,0x00,0x2f,0x60,0x00,0x4d,0x00,0x1d,
+0x22,0x00,0x00,0x4d,0x00,0x01,0x0c,0x02,0x00,0x4d,0x00,0x02,0x62,0x01,0x13,0xaf,
+0x11,0x00,0x0f,0x4d,0x00,0x09,0x00,0x01,0x00,0x23,0x5c,0x50,0x95,0x02,0x11,0xfc,
+0x08,0x00,0x21,0x03,0xd0,0x11,0x00,0x30,0x64,0x00,0xa5,0xc1,0x01,0xf0,0x0b,0x00,
+0xbf,0xf6,0x4e,0x21,0x11,0x11,0x17,0xd3,0x0f,0xff,0xec,0xce,0xec,0xcc,0xcc,0xef,
+0xe1,0x7f,0xe3,0x00,0x2d,0x00,0x00,0x06,0x80,0xd9,0x01,0x32,0x97,0x0a,0xa6,0x44,
+0x00,0x13,0xcc,0x89,0x02,0x39,0x00,0x2f,0xfa,0x5c,0x00,0x20,0x01,0x10,0x89,0x00,
+0xf2,0x42,0xff,0xe8,0x00,0x00,0xdf,0xf8,0xcf,0xf8,0x00,0x7f,0xff,0x81,0xdf,0xf1,
+0x0c,0xfa,0xf8,0x52,0xdf,0x60,0xff,0x64,0x78,0x3a,0xf8,0x0f,0xff,0x50,0x08,0xff,
+0xa1,0xff,0xff,0x12,0xff,0xfa,0x0f,0xff,0x41,0x15,0xff,0xa0,0xef,0x46,0x88,0x48,
+0xf8,0x0b,0xfc,0xf8,0x42,0xef,0x50,0x5f,0xff,0x82,0xef,0xf1,0x00,0xaf,0xfa,0xef,
+0xf6,0x00,0x00,0x5a,0xdc,0xa4,0x00,0x00,0x01,0x56,0x63,0x00,0x00,0x78,0x8b,0xff,
+0xfe,0x88,0x82,0x53,0x03,0x70,0x12,0x22,0x22,0x22,0x22,0x20,0x3f,0x0c,0x00,0xcf,
+0x90,0x3f,0xfc,0xfc,0xfe,0xdf,0x90,0x3f,0xd5,0xf4,0xeb,0x7f,0x06,0x00,0x07,0x61,
+0xe6,0xf5,0xec,0x8f,0x90,0x2f,0x54,0x03,0x61,0x07,0x9a,0xaa,0xaa,0xa9,0x10,0xa4,
+0x00,0x12,0x14,0xf7,0x00,0x22,0xef,0xa0,0x89,0x06,0x10,0xf9,0x0d,0x00,0x20,0xc3,
+0xdf,0x9e,0x06,0x40,0x3e,0xfd,0x3d,0xf5,0x1a,0x00,0x40,0xff,0xd3,0x50,0x00,0x49,
+0x06,0x02,0x0d,0x00,0x21,0xff,0x60,0x0d,0x00,0x15,0xf6,0x0d,0x00,0x11,0x0b,0x0d,
+0x00,0x00,0x51,0x04,0x00,0xbc,0x01,0x31,0x0f,0xff,0xf6,0x4b,0x07,0x13,0x86,0x66,
+0x01,0x10,0x8b,0x73,0x05,0x14,0xb6,0xb8,0x01,0xf0,0x0c,0xf2,0x00,0xbf,0xff,0xf8,
+0xbf,0xf6,0xef,0xff,0x40,0xbf,0xff,0xff,0x10,0xa4,0x09,0xff,0xf4,0xaf,0xff,0xff,
+0xfd,0x10,0x07,0xff,0xff,0x4d,0x83,0x04,0xf4,0x08,0x00,0xbf,0xff,0xf4,0x1d,0xff,
+0xff,0xf4,0x06,0x10,0xbf,0xff,0x40,0x1d,0xff,0xff,0x47,0xfd,0x2b,0xff,0xf4,0x00,
+0x1d,0xb7,0x01,0x31,0x1c,0xff,0xff,0xcf,0x06,0xf0,0x00,0x08,0x99,0x99,0x70,0x00,
+0xbf,0xff,0xff,0xf8,0x0a,0xd0,0xd0,0xd0,0xeb,0x9f,0x05,0x00,0x60,0xff,0xd1,0xd1,
+0xd1,0xeb,0xff,0xe6,0x04,0x0f,0x05,0x00,0x0b,0x10,0xef,0xc6,0x05,0x52,0x5c,0xdd,
+0xdd,0xdd,0xb2,0x9f,0x00,0x11,0xb0,0x37,0x05,0xf2,0x01,0x0b,0xf0,0x00,0x9f,0x10,
+0x00,0x00,0x0f,0xf0,0x0a,0xff,0x21,0x11,0x11,0x1f,0xf0,0xad,0x00,0x12,0xf0,0x22,
+0x06,0x32,0xd0,0x08,0xff,0x2a,0x01,0x12,0x7f,0x07,0x00,0x60,0x01,0x00,0x00,0x00,
+0x00,0x00,
+};
+
+static const etxFontBlock blocks[] = {
+{ .bitmap_index = 0, .comp_offset = 0, .size = 4078, .comp_size = 3644 },
+{ .bitmap_index = 4078, .comp_offset = 3644, .size = 4068, .comp_size = 3323 },
+{ .bitmap_index = 8146, .comp_offset = 6967, .size = 4030, .comp_size = 3096 },
+{ .bitmap_index = 12176, .comp_offset = 10063, .size = 4081, .comp_size = 3493 },
+{ .bitmap_index = 16257, .comp_offset = 13556, .size = 4030, .comp_size = 3539 },
+{ .bitmap_index = 20287, .comp_offset = 17095, .size = 4047, .comp_size = 3586 },
+{ .bitmap_index = 24334, .comp_offset = 20681, .size = 4038, .comp_size = 3739 },
+{ .bitmap_index = 28372, .comp_offset = 24420, .size = 4096, .comp_size = 3694 },
+{ .bitmap_index = 32468, .comp_offset = 28114, .size = 4014, .comp_size = 3381 },
+{ .bitmap_index = 36482, .comp_offset = 31495, .size = 2101, .comp_size = 1467 },
 };
 
 static const etxFontCmap cmaps[] = {
@@ -2313,11 +2447,11 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 12527, .range_length = 51124, .glyph_id_start = 233, .list_length = 349, .type = 3, .unicode_list = 4801, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[60124] __SDRAMFONTS;
+static uint8_t etxUncompBuf[21541] __SDRAMFONTS;
 
 const etxLz4Font lv_font_jp_XXS = {
-.uncomp_size = 59764,
-.comp_size = 36769,
+.uncomp_size = 21181,
+.comp_size = 5696,
 .line_height = 15,
 .base_line = 3,
 .subpx = 0,
@@ -2330,12 +2464,15 @@ const etxLz4Font lv_font_jp_XXS = {
 .bitmap_format = 0,
 .left_class_cnt = 122,
 .right_class_cnt = 119,
-.glyph_bitmap = 5499,
-.class_pair_values = 44082,
-.left_class_mapping = 58600,
-.right_class_mapping = 59182,
+.glyph_bitmap = 0,
+.class_pair_values = 5499,
+.left_class_mapping = 20017,
+.right_class_mapping = 20599,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 60124,
+.lvglFontBufSize = 21541,
+.block_count = 10,
+.blocks = blocks,
+.compressed_bitmap = lz4BitmapData,
 };
@@ -28,7 +28,8 @@
     Usage:
         Create the lv_font.inc file using the lv_font_conv program
         Compile this program with GCC
-        Run this program with the font name as the first argument
+        Run this program with the font name as the first argument, and
+        'blocks' as the second argument to use the block format
 
     Designed to be used by the make_fonts.sh tool, not run standalone.
 
@@ -41,6 +42,10 @@
    structures (see lz4_fonts.h). Everything is then written back out to the
    argv[1].c file to be compiled into the EdgeTx firmware.
 
+        With the block format, the glyph bitmaps are left out of the main
+   compressed data and compressed separately, in blocks of whole glyphs, so
+   that they can be decompressed on demand (see lz4_fonts.h).
+
     Note:
         This is dependant on the LVGL font structure formats. If the LVGL
    version is changed re-check that the font structure are still compatible.
@@ -48,6 +53,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #define __IRAM
 #define LV_SKIP_DEFINES 1
@@ -78,12 +84,15 @@ int main(int argc, char* argv[])
   int uncomp_size = 0;
   int comp_size = 0;
 
+  bool use_blocks = argc > 2 && !strcmp(argv[2], "blocks");
+
   // Pointers to base LVGL font strucures
   const lv_font_t* font = &lv_font;
   lv_font_fmt_txt_dsc_t* dsc = (lv_font_fmt_txt_dsc_t*)font->dsc;
 
   // Calculate size of data to compress
-  uncomp_size = sizeof(glyph_bitmap) + sizeof(glyph_dsc);
+  uncomp_size = sizeof(glyph_dsc);
+  if (!use_blocks) uncomp_size += sizeof(glyph_bitmap);
 
   if (dsc->kern_classes) {
     uncomp_size += sizeof(kern_class_values) + sizeof(kern_left_class_mapping) +
@@ -167,10 +176,12 @@ int main(int argc, char* argv[])
   }
 
   // Copy glyph_bitmap
-  memcpy(next, glyph_bitmap, sizeof(glyph_bitmap));
-  etx_font.glyph_bitmap = next - data;
+  if (!use_blocks) {
+    memcpy(next, glyph_bitmap, sizeof(glyph_bitmap));
+    etx_font.glyph_bitmap = next - data;
 
-  next += sizeof(glyph_bitmap);
+    next += sizeof(glyph_bitmap);
+  }
 
   // Copy kern_classes (optional)
   if (dsc->kern_classes) {
@@ -195,6 +206,46 @@ int main(int argc, char* argv[])
   comp_size = LZ4_compress_HC((const char*)data, (char*)lz4_data, uncomp_size,
                               uncomp_size, 12);
 
+  // Split glyph bitmaps in blocks of whole glyphs and compress each block
+  int glyph_count = sizeof(glyph_dsc) / sizeof(glyph_dsc[0]);
+  int bitmap_size = sizeof(glyph_bitmap);
+  int block_count = 0;
+  int comp_bitmap_size = 0;
+  etxFontBlock* blocks = nullptr;
+  uint8_t* lz4_bitmap = nullptr;
+
+  if (use_blocks) {
+    blocks = (etxFontBlock*)malloc(glyph_count * sizeof(etxFontBlock));
+    int bound = LZ4_compressBound(ETX_FONT_BLOCK_SIZE);
+    lz4_bitmap = (uint8_t*)malloc(glyph_count * bound);
+
+    int start = 0;
+    for (int g = 0; g <= glyph_count; g += 1) {
+      int glyph_start =
+          g < glyph_count ? (int)glyph_dsc[g].bitmap_index : bitmap_size;
+      int glyph_end =
+          g + 1 < glyph_count ? (int)glyph_dsc[g + 1].bitmap_index : bitmap_size;
+
+      if (glyph_end - glyph_start > ETX_FONT_BLOCK_SIZE) {
+        fprintf(stderr, "%s: glyph %d too big for a block\n", argv[1], g);
+        return 1;
+      }
+
+      if ((g == glyph_count && glyph_start > start) ||
+          glyph_end - start > ETX_FONT_BLOCK_SIZE) {
+        etxFontBlock& block = blocks[block_count++];
+        block.bitmap_index = start;
+        block.comp_offset = comp_bitmap_size;
+        block.size = glyph_start - start;
+        block.comp_size = LZ4_compress_HC(
+            (const char*)&glyph_bitmap[start],
+            (char*)&lz4_bitmap[comp_bitmap_size], block.size, bound, 12);
+        comp_bitmap_size += block.comp_size;
+        start = glyph_start;
+      }
+    }
+  }
+
   // Write data to file
   int i;
   char filename[100];
@@ -213,6 +264,27 @@ int main(int argc, char* argv[])
   if ((i & 0x0F) != 0) fprintf(fp, "\n");
   fprintf(fp, "};\n\n");
 
+  if (use_blocks) {
+    // Compressed glyph bitmap blocks
+    fprintf(fp, "static const uint8_t lz4BitmapData[] ={\n");
+    for (i = 0; i < comp_bitmap_size; i += 1) {
+      fprintf(fp, "0x%02x,", lz4_bitmap[i]);
+      if ((i & 0x0F) == 0x0F) fprintf(fp, "\n");
+    }
+    if ((i & 0x0F) != 0) fprintf(fp, "\n");
+    fprintf(fp, "};\n\n");
+
+    fprintf(fp, "static const etxFontBlock blocks[] = {\n");
+    for (int i = 0; i < block_count; i += 1) {
+      fprintf(fp,
+              "{ .bitmap_index = %d, .comp_offset = %d, .size = %d, "
+              ".comp_size = %d },\n",
+              blocks[i].bitmap_index, blocks[i].comp_offset, blocks[i].size,
+              blocks[i].comp_size);
+    }
+    fprintf(fp, "};\n\n");
+  }
+
   // Cmaps
   if (dsc->cmap_num > 0) {
     fprintf(fp, "static const etxFontCmap cmaps[] = {\n");
@@ -261,10 +333,21 @@ int main(int argc, char* argv[])
   fprintf(fp, ".compressed = lz4FontData,\n");
   fprintf(fp, ".lvglFontBuf = etxUncompBuf,\n");
   fprintf(fp, ".lvglFontBufSize = %d,\n", size);
+  if (use_blocks) {
+    fprintf(fp, ".block_count = %d,\n", block_count);
+    fprintf(fp, ".blocks = blocks,\n");
+    fprintf(fp, ".compressed_bitmap = lz4BitmapData,\n");
+  }
   fprintf(fp, "};\n");
 
   fclose(fp);
 
-  printf("%s %d %d %d%%\n", argv[1], uncomp_size, comp_size,
-         (comp_size * 100) / uncomp_size);
+  if (use_blocks) {
+    printf("%s %d %d %d%% (%d bitmap bytes in %d blocks, %d compressed)\n",
+           argv[1], uncomp_size, comp_size, (comp_size * 100) / uncomp_size,
+           bitmap_size, block_count, comp_bitmap_size);
+  } else {
+    printf("%s %d %d %d%%\n", argv[1], uncomp_size, comp_size,
+           (comp_size * 100) / uncomp_size);
+  }
 }
@@ -38,6 +38,10 @@ LATIN1_EXT_A="0x100-0x17F"
 LATIN1="${LATIN1_SUPPLEMENT},${LATIN1_EXT_A}"
 COMPARE="0x2265"
 
+# Font sets using the block format (glyphs decompressed on demand)
+BLOCK_FONT_SETS="tw cn jp ko"
+FONT_FORMAT=""
+
 # LV_SYMBOL_CHARGE, LV_SYMBOL_NEW_LINE, LV_SYMBOL_SD_CARD, LV_SYMBOL_CLOSE
 # LV_SYMBOL_FILE, LV_SYMBOL_OK, LV_SYMBOL_WIFI, LV_SYMBOL_USB
 BL_SYMBOLS="61671,63650,63426,61453,61787,61452,61931,62087"
@@ -102,7 +106,7 @@ function compress_font() {
       "${RADIO_SRC_DIR}/thirdparty/lz4/lz4.c" \
       -o "${SCRIPT_DIR}/lz4_font"
   
-  "${SCRIPT_DIR}/lz4_font" "${name}"
+  "${SCRIPT_DIR}/lz4_font" "${name}" ${FONT_FORMAT}
 }
 
 function make_font_lz4() {
@@ -206,6 +210,12 @@ function make_font_set() {
 
   echo "Creating font set for: ${name}"
 
+  if [[ " ${BLOCK_FONT_SETS} " == *" ${name} "* ]]; then
+    FONT_FORMAT="blocks"
+  else
+    FONT_FORMAT=""
+  fi
+
   # Standard LCD fonts (480x272, 480x320, 320x480)
   make_font_lz4 "${name}" "${LATIN_FONT}" "${ttf_normal}" 9 "XXS" "std" "${chars}"
   make_font_lz4 "${name}" "${LATIN_FONT}" "${ttf_normal}" 13 "XS" "std" "${chars}"
@@ -265,6 +275,14 @@ main() {
     make_font_set "ua" "Arimo/Arimo-Regular.ttf" "Arimo/Arimo-Bold.ttf" "${UA_SYMBOLS}"
     make_font_set "ko" "Nanum/NanumBarunpenR.ttf" "Nanum/NanumBarunpenB.ttf" "${KO_SYMBOLS}"
 
+    # Glyph blocks decompress to whole glyphs (after a format change, also
+    # compare with the previous fonts: check_font_blocks.py --ref HEAD ...)
+    echo "Checking block format fonts..."
+    for name in ${BLOCK_FONT_SETS}; do
+      python3 check_font_blocks.py {std,sml,lrg}/lv_font_${name}_{XXS,XS,L}.c \
+                                   {std,sml,lrg}/lv_font_${name}_bold_{STD,XL}.c
+    done
+
     # Clean up temporary files
     echo "Cleaning up temporary files..."
     rm -f "${SCRIPT_DIR}/lv_font.inc"
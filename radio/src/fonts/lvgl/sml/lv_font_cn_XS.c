@@ -248,7 +248,7 @@ static const uint8_t lz4FontData[] ={
 0xf3,0x08,0x00,0x22,0x21,0x89,0x08,0x00,0x13,0x4f,0x08,0x00,0x10,0x7d,0x08,0x00,
 0x52,0x09,0x00,0xff,0xb8,0x89,0x58,0x00,0x13,0xea,0x08,0x00,0x22,0x1c,0x8a,0xa8,
 0x00,0x22,0x59,0x8a,0xc8,0x00,0x22,0x8d,0x8a,0x60,0x00,0x60,0xb9,0x8a,0x10,0x0a,
-0x0b,0x07,0xd0,0x18,0xf1,0xff,0xff,0xff,0xff,0xff,0x6e,0x72,0x1f,0xb5,0x21,0x51,
+0x0b,0x07,0xd0,0x18,0xf8,0xff,0xff,0xff,0xff,0xff,0x47,0x72,0x1f,0xb5,0x21,0x51,
 0x2f,0x50,0x4d,0x5a,0x4d,0x5b,0x4d,0x5d,0x4d,0x5e,0x4d,0x7a,0x4d,0x7d,0x4d,0x82,
 0x4d,0x89,0x4d,0x8a,0x4d,0x8b,0x4d,0x99,0x4d,0x9b,0x4d,0x9c,0x4d,0xa0,0x4d,0xa8,
 0x4d,0xdc,0x4d,0xde,0x4d,0xf4,0x4d,0xfb,0x4d,0xfe,0x4d,0x15,0x4e,0x1b,0x4e,0x1e,
@@ -333,2017 +333,2110 @@ static const uint8_t lz4FontData[] ={
 0xef,0xc8,0xef,0xc9,0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,0x15,0xf0,0x17,
 0xf0,0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,0x74,0xf0,0xab,
 0xf0,0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,0xd7,0xf1,0xe3,
-0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x2c,0x2b,0x2b,0x2b,0x2b,
-0x17,0x00,0x2b,0x55,0xa5,0x59,0x32,0x60,0x00,0x55,0x55,0x00,0x08,0x29,0x20,0x0c,
-0xec,0xec,0x00,0x0b,0x0b,0x00,0x00,0xa0,0xa0,0x05,0xce,0xcd,0x80,0x05,0x56,0x50,
-0x00,0x82,0x92,0x4d,0x1e,0xf0,0x85,0x74,0x00,0x05,0xdc,0x30,0x1d,0x14,0xd0,0x2c,
-0x00,0x80,0x0b,0xa3,0x00,0x00,0x5c,0x70,0x23,0x00,0xd0,0x4b,0x01,0xe0,0x09,0xed,
-0x50,0x00,0x83,0x00,0x1b,0xb1,0x00,0x07,0x45,0x63,0x70,0x64,0x55,0xa0,0x01,0xa9,
-0x65,0x00,0x00,0x0a,0x6a,0x40,0x08,0x3b,0x0b,0x01,0x90,0xb0,0xb0,0x00,0x08,0xa6,
-0x05,0xdc,0x10,0x00,0xd1,0x67,0x00,0x0c,0x3a,0x40,0x00,0x5f,0x70,0x00,0x1d,0xa9,
-0x07,0x07,0x80,0xc8,0x90,0x59,0x02,0xf4,0x00,0x9b,0xc9,0xc0,0x73,0x73,0x41,0x00,
-0x71,0x04,0x90,0x0b,0x10,0x1c,0x00,0x4a,0x00,0x59,0x00,0x49,0x00,0x2b,0x00,0x0d,
-0x00,0x09,0x40,0x01,0xb0,0x00,0x21,0x81,0x03,0xa0,0x0b,0x20,0x67,0x04,0xa0,0x2b,
-0x03,0xb0,0x49,0x08,0x50,0xc0,0x76,0x03,0x00,0x03,0x80,0x07,0x69,0x80,0x3b,0xe5,
-0x01,0xca,0x30,0x13,0x13,0x00,0x00,0x83,0x00,0x00,0xa4,0x03,0x00,0x32,0x9f,0xff,
-0xf3,0x09,0x00,0xf6,0x28,0x67,0x85,0x70,0xad,0x70,0x01,0x3b,0x00,0x1a,0x00,0x74,
-0x00,0xb0,0x02,0x90,0x08,0x40,0x0c,0x00,0x38,0x00,0x83,0x00,0x60,0x00,0x08,0xdc,
-0x30,0x2c,0x03,0xc0,0x58,0x00,0xe0,0x67,0x00,0xd0,0x67,0x00,0xd0,0x58,0x00,0xe0,
-0x2c,0x03,0xb0,0x07,0xdc,0x30,0x03,0x98,0x2b,0x99,0x00,0x59,0x02,0x00,0xf0,0x6e,
-0x09,0xdd,0x30,0x5a,0x03,0xc0,0x32,0x01,0xd0,0x00,0x07,0x80,0x00,0x3c,0x00,0x01,
-0xd2,0x00,0x0b,0x40,0x00,0x6f,0xdd,0xd3,0x0a,0xdd,0x35,0x80,0x2c,0x00,0x04,0xb0,
-0x1d,0xf2,0x00,0x04,0xb2,0x20,0x0e,0x5a,0x03,0xc0,0xad,0xc2,0x00,0x0d,0x60,0x00,
-0x7e,0x60,0x01,0xc8,0x60,0x0a,0x38,0x60,0x4a,0x08,0x60,0xad,0xde,0xe5,0x00,0x08,
-0x60,0x00,0x08,0x60,0x0a,0xff,0xf0,0x0c,0x10,0x00,0x0d,0x00,0x00,0x0e,0xdd,0x50,
-0x04,0x02,0xe0,0x00,0x00,0xb2,0x1c,0x00,0xd1,0x06,0xdd,0x60,0x01,0xae,0x10,0x0b,
-0x80,0x00,0x1d,0x00,0x00,0x4c,0xcd,0x40,0x5d,0x12,0xe0,0x49,0x00,0xc1,0x1d,0x01,
-0xd0,0x05,0xdd,0x40,0x8d,0xdd,0xf2,0x00,0x01,0xc0,0x00,0x07,0x60,0x34,0x00,0x70,
-0x49,0x00,0x00,0xb3,0x00,0x01,0xd0,0x4a,0x00,0xf0,0x5b,0x09,0xdd,0x40,0x3c,0x02,
-0xd0,0x2c,0x03,0xc0,0x09,0xef,0x30,0x3c,0x03,0xc0,0x67,0x00,0xd0,0x4b,0x02,0xd0,
-0x08,0xdd,0x40,0x09,0xdc,0x15,0xa0,0x5a,0x76,0x00,0xd4,0xb0,0x4f,0x08,0xd8,0xe0,
-0x00,0x3c,0x00,0x0b,0x60,0x7e,0x70,0x3a,0x01,0x00,0x00,0x01,0x3a,0x58,0x01,0x00,
-0x00,0x12,0x58,0x84,0x30,0x00,0x18,0x40,0x8d,0x70,0x9c,0x10,0x00,0x7d,0x81,0x00,
-0x08,0x40,0x3e,0xee,0xb0,0x00,0x00,0x3e,0xee,0xb0,0x49,0x10,0x00,0x6d,0x91,0x00,
-0x0a,0xc1,0x7d,0x81,0x48,0x10,0x00,0x1c,0xea,0x08,0x60,0xb3,0x00,0x0a,0x30,0x04,
-0xc0,0x00,0xd1,0x00,0x27,0xdc,0x01,0xf0,0x7c,0x3a,0x00,0x00,0x3b,0xbb,0x80,0x00,
-0x3a,0x00,0x04,0x90,0x0b,0x02,0xba,0x18,0x22,0x80,0xb1,0x92,0x35,0x55,0x1a,0x0a,
-0x12,0x76,0x44,0x80,0xb0,0x36,0x56,0x38,0x0d,0x07,0x31,0xa0,0xb9,0x7a,0x80,0x09,
-0x50,0x00,0x00,0x00,0x07,0xba,0xa0,0x00,0x00,0x5d,0x00,0x00,0x0a,0xd2,0x00,0x00,
-0xd5,0x80,0x00,0x59,0x0d,0x00,0x0a,0x30,0xb3,0x00,0xfd,0xde,0x80,0x59,0x00,0x1d,
-0x0b,0x40,0x00,0xb3,0x2f,0xdd,0xb0,0x2c,0x00,0x96,0x2c,0x00,0xa5,0x2f,0xde,0xc0,
-0x2c,0x00,0x97,0x2c,0x00,0x5a,0x2c,0x00,0x97,0x2f,0xdd,0xa0,0x03,0xcd,0xb2,0x00,
-0xd3,0x05,0xb0,0x4a,0x00,0x09,0x06,0x80,0x00,0x00,0x68,0x00,0x00,0x04,0xa0,0x00,
-0x80,0x0d,0x30,0x5b,0x00,0x3c,0xdb,0x10,0x2f,0xed,0x70,0x2c,0x00,0xb6,0x2c,0x00,
-0x2c,0x2c,0x00,0x0e,0x03,0x00,0x00,0x09,0x00,0xd1,0xb6,0x2f,0xde,0x70,0x2f,0xdd,
-0xd4,0x2c,0x00,0x00,0x2c,0x00,0x00,0x55,0x00,0x14,0x00,0x0c,0x00,0x47,0xd4,0x2f,
-0xdd,0xd3,0x0f,0x00,0x15,0xa0,0x0c,0x00,0xa1,0x03,0xcd,0xc2,0x00,0xd3,0x04,0xc0,
-0x4b,0x00,0x06,0x64,0x00,0xf0,0x05,0x06,0xde,0x14,0xb0,0x00,0xd1,0x0d,0x40,0x1e,
-0x10,0x2c,0xed,0x60,0x2c,0x00,0x0a,0x42,0xc0,0x00,0xa4,0x07,0x00,0x36,0xfd,0xdd,
-0xf4,0x0e,0x00,0x00,0x07,0x00,0x13,0x1d,0x01,0x00,0x53,0x00,0x03,0xc0,0x00,0x3c,
-0x05,0x00,0xf5,0x15,0xc3,0x00,0x3b,0x96,0x07,0x91,0xcd,0xb1,0x2c,0x00,0x7a,0x02,
-0xc0,0x4d,0x00,0x2c,0x2d,0x20,0x02,0xcd,0x60,0x00,0x2f,0xad,0x00,0x02,0xc0,0x89,
-0x00,0x2c,0x00,0xd4,0x02,0xc0,0x03,0xd0,0x79,0x00,0x08,0x03,0x00,0xf1,0x52,0x2f,
-0xdd,0xd1,0x2f,0x30,0x00,0x7e,0x2f,0x90,0x00,0xde,0x2b,0xd0,0x03,0xbe,0x2b,0x94,
-0x09,0x5e,0x2c,0x4a,0x0d,0x0e,0x2c,0x0d,0x59,0x0e,0x2c,0x08,0xe4,0x0e,0x2c,0x02,
-0xe0,0x0e,0x2f,0x10,0x0a,0x42,0xfa,0x00,0xa4,0x2c,0xd3,0x0a,0x42,0xc4,0xc0,0xa4,
-0x2c,0x0b,0x6a,0x42,0xc0,0x2e,0xb4,0x2c,0x00,0x8f,0x42,0xc0,0x00,0xe4,0x02,0xce,
-0xb1,0x00,0xd4,0x05,0xc0,0x4b,0x00,0x0d,0x26,0x80,0x00,0xa4,0x68,0x00,0x0a,0x44,
-0xb0,0x00,0xd2,0x0d,0x40,0x5c,0x00,0x2c,0xeb,0x10,0x2f,0xed,0xc2,0x2c,0x00,0x5b,
-0x22,0x01,0x46,0x5b,0x2f,0xdd,0xb2,0xf8,0x00,0xf1,0x16,0xce,0xb1,0x00,0xd3,0x06,
-0xb0,0x4a,0x00,0x0d,0x17,0x70,0x00,0xb3,0x77,0x00,0x0b,0x35,0xa0,0x00,0xd1,0x0d,
-0x30,0x6b,0x00,0x3c,0xef,0x40,0x00,0x00,0x4d,0x10,0x00,0x00,0x00,0x2f,0xee,0xa0,
-0x8e,0x01,0xfe,0x1f,0x4a,0x2c,0x00,0xa7,0x2f,0xde,0xa0,0x2c,0x04,0xb0,0x2c,0x00,
-0xc3,0x2c,0x00,0x4b,0x07,0xdd,0x80,0x3c,0x00,0xb5,0x5b,0x00,0x22,0x0b,0xb5,0x00,
-0x00,0x3a,0xd1,0x32,0x00,0x87,0x6a,0x00,0x96,0x08,0xdd,0xa0,0xad,0xee,0xda,0x00,
-0x77,0x00,0x03,0x00,0x38,0x59,0x00,0x1d,0x03,0x00,0xf0,0x45,0x4a,0x00,0x2c,0x1d,
-0x10,0x79,0x05,0xde,0xa1,0xb4,0x00,0x0e,0x15,0x90,0x04,0xb0,0x1e,0x00,0x96,0x00,
-0xb3,0x0d,0x10,0x06,0x83,0xb0,0x00,0x1d,0x86,0x00,0x00,0xbe,0x10,0x00,0x06,0xc0,
-0x00,0x95,0x00,0xf0,0x06,0x86,0x80,0x4f,0x40,0x95,0x2b,0x08,0x98,0x0c,0x10,0xe0,
-0xc1,0xb0,0xd0,0x0b,0x3c,0x0c,0x3a,0x00,0x89,0x80,0x89,0x70,0x04,0xf4,0x04,0xf4,
-0x00,0x1f,0x00,0x0f,0x00,0x6b,0x00,0x7a,0x0d,0x41,0xe2,0x04,0xd9,0x80,0x00,0xbe,
-0x37,0x00,0xf6,0x08,0x04,0xc8,0x90,0x0d,0x30,0xe2,0x6a,0x00,0x6b,0xa5,0x00,0x6a,
-0x3d,0x00,0xd2,0x0b,0x45,0xb0,0x03,0xcc,0x30,0x00,0xbb,0x88,0x00,0xf6,0x0e,0x7d,
-0xdd,0xf6,0x00,0x01,0xe1,0x00,0x0b,0x50,0x00,0x4c,0x00,0x00,0xd2,0x00,0x08,0x80,
-0x00,0x2d,0x00,0x00,0x9f,0xdd,0xd8,0x4d,0x74,0xa0,0x4a,0x04,0x03,0x00,0x60,0x4e,
-0x70,0xa3,0x00,0x04,0x90,0x5c,0x03,0x40,0x94,0x00,0x03,0xa0,0x08,0x00,0x94,0x85,
-0x00,0x02,0xa0,0x00,0x06,0x00,0xcc,0x0e,0x01,0x00,0xf4,0x63,0xcc,0x06,0x90,0x0c,
-0xc0,0x2a,0x84,0x85,0x2a,0xdd,0xdd,0x60,0x44,0x00,0xc1,0x09,0xdc,0x22,0x60,0x4a,
-0x07,0xbc,0xb5,0xa0,0x3b,0x69,0x07,0xb0,0xcd,0x9b,0x59,0x00,0x00,0x59,0x00,0x00,
-0x5c,0xcd,0x40,0x5c,0x02,0xd0,0x59,0x00,0xc1,0x59,0x00,0xc1,0x5c,0x02,0xd0,0x5b,
-0xce,0x40,0x08,0xdc,0x34,0xb0,0x2c,0x86,0x00,0x17,0x60,0x00,0x4b,0x02,0xb0,0x8d,
-0xc2,0x00,0x00,0xe0,0x00,0x0e,0x09,0xda,0xe4,0xb0,0x2e,0x76,0x00,0xe7,0x60,0x0e,
-0x4b,0x02,0xe0,0x9c,0xae,0x07,0xdc,0x33,0xa0,0x2c,0x7e,0xdd,0xd7,0x70,0x00,0x4c,
-0x01,0x60,0x8d,0xd4,0x03,0xd6,0x0c,0x30,0x0d,0x00,0x8f,0xc1,0x0e,0x00,0x02,0x00,
-0x43,0x09,0xda,0xe4,0xc0,0x30,0x00,0xf1,0x09,0x03,0xe0,0x9e,0xae,0x03,0x03,0xc0,
-0x9d,0xc3,0x59,0x00,0x05,0x90,0x00,0x5b,0xbe,0x45,0xc0,0x3c,0x59,0x01,0xd5,0x90,
-0x1d,0x05,0x00,0x31,0x3a,0x00,0x3a,0x01,0x00,0x62,0x04,0x90,0x00,0x04,0x90,0x49,
-0x03,0x00,0x32,0x05,0x94,0xe4,0x9b,0x00,0xf3,0x04,0x59,0x0b,0x60,0x59,0x89,0x00,
-0x5d,0xe0,0x00,0x5d,0xb6,0x00,0x59,0x1d,0x10,0x59,0x05,0xb0,0x3a,0x01,0x00,0xf5,
-0x03,0x5b,0xcd,0x5b,0xe8,0x05,0xb0,0x3f,0x10,0xe0,0x59,0x01,0xd0,0x0d,0x15,0x90,
-0x1d,0x00,0xd1,0x09,0x00,0x0b,0x61,0x00,0xf6,0x08,0x07,0xdd,0x40,0x4c,0x02,0xd0,
-0x86,0x00,0xb2,0x76,0x00,0xb3,0x3c,0x01,0xe0,0x07,0xdd,0x40,0x5c,0xbd,0x40,0x5b,
-0x01,0xf1,0x00,0x32,0x5c,0xcd,0x40,0x6e,0x00,0x36,0x09,0xda,0xd4,0xe3,0x00,0x21,
-0x9d,0xae,0xf7,0x00,0x55,0x00,0x00,0x5c,0xd3,0x5c,0x46,0x05,0xf6,0x0c,0x0a,0xdc,
-0x14,0xa0,0x56,0x1d,0x82,0x00,0x05,0xc5,0x67,0x05,0x90,0xad,0xc2,0x07,0x00,0xe0,
-0xbf,0xa0,0xe0,0x0e,0x00,0xe0,0x0e,0x00,0xac,0x71,0x00,0xf4,0x66,0x3b,0x04,0xd0,
-0xbd,0xad,0xb3,0x06,0x75,0x80,0xb2,0x1c,0x0d,0x00,0xb6,0x80,0x06,0xe3,0x00,0x1e,
-0x00,0xa3,0x0c,0x30,0xb2,0x67,0x0e,0x80,0xd0,0x2b,0x47,0xc3,0xa0,0x0d,0x92,0xb8,
-0x60,0x0a,0xd0,0x6f,0x20,0x06,0x90,0x2e,0x00,0x79,0x0a,0x60,0xd5,0xc0,0x04,0xf3,
-0x00,0x5f,0x40,0x0d,0x3d,0x08,0x80,0x97,0xb3,0x08,0x76,0x80,0xc2,0x1d,0x1c,0x00,
-0xb7,0x70,0x06,0xf2,0x00,0x1d,0x00,0x06,0x70,0x08,0xd1,0x00,0x7d,0xdf,0x70,0x02,
-0xd0,0x00,0xb4,0x00,0x6a,0x00,0x1d,0x10,0x08,0xed,0xd8,0x00,0x82,0x06,0x80,0x0a,
-0x40,0x0a,0x30,0x0c,0x10,0xaa,0x00,0x0c,0x10,0x0a,0x30,0x0a,0x40,0x06,0x80,0x00,
-0x82,0x29,0x01,0x00,0xf5,0x6f,0x14,0x82,0x00,0x2c,0x00,0x0e,0x00,0x0d,0x00,0x0b,
-0x30,0x04,0xf0,0x0b,0x20,0x0d,0x00,0x0e,0x00,0x2c,0x00,0x82,0x00,0x0b,0xd6,0x0b,
-0x13,0x70,0x9e,0x80,0x00,0x00,0xa3,0x00,0x00,0x00,0x0d,0xd3,0x00,0xed,0xdd,0xc2,
-0xd3,0x0d,0x00,0x00,0x02,0xd2,0xd0,0x00,0x00,0x4c,0x1c,0xdd,0xde,0x3d,0x10,0x00,
-0x00,0xdd,0x10,0x00,0x00,0x08,0x20,0x00,0x00,0x02,0xb0,0x00,0x00,0x02,0xde,0x00,
-0x00,0x02,0xd3,0xad,0xdd,0xe2,0xd3,0x00,0x00,0x0d,0x1d,0x50,0x00,0x00,0xd0,0x1c,
-0x5c,0xdd,0xdc,0x00,0x1c,0xf0,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x01,0x10,0x00,
-0x00,0x2d,0xd2,0x00,0x02,0xd3,0x3d,0x20,0x2d,0x30,0x03,0xd2,0x8d,0xe0,0x0e,0xd8,
-0x00,0xd0,0x0d,0x00,0x04,0x00,0xb8,0xdd,0xdd,0x00,0x00,0x11,0x11,0x00,0x00,0xdb,
-0xbd,0x00,0x18,0x00,0xf3,0x00,0xaf,0xc0,0x0c,0xfa,0x1c,0x50,0x05,0xc1,0x01,0xc5,
-0x5c,0x10,0x00,0x1c,0xc1,0xd2,0x25,0x40,0x22,0x00,0x00,0x00,0xff,0x02,0xf1,0x0f,
-0x00,0x03,0xee,0x30,0x00,0x00,0x0c,0x77,0xb0,0x00,0x00,0x4e,0x00,0xe4,0x00,0x00,
-0xc5,0x00,0x6c,0x00,0x05,0xe2,0x22,0x2e,0x50,0x0d,0xff,0xff,0xff,0xd0,0x2b,0x00,
-0xf1,0x10,0x01,0x4d,0xd3,0x05,0xd8,0xc3,0x4b,0x3d,0x10,0xff,0xf5,0xa5,0x02,0xfe,
-0x78,0xb2,0x05,0x90,0x2b,0x96,0x00,0x00,0x69,0x2d,0x30,0x03,0xd1,0x03,0xcd,0xdc,
-0x30,0x98,0x00,0xf0,0x1f,0x08,0xcc,0x61,0x00,0x01,0xd3,0xee,0x3d,0x10,0x0b,0x70,
-0x44,0x07,0xb0,0x1a,0x20,0x00,0x01,0xc1,0x1a,0x10,0x00,0x01,0xb1,0x0b,0x50,0x00,
-0x05,0x90,0x04,0xc5,0x00,0x5a,0x60,0x00,0x4a,0xec,0x95,0x00,0x00,0x00,0x32,0x00,
-0x00,0x00,0x10,0x77,0x00,0xf0,0x17,0xeb,0xcd,0x91,0x00,0x1e,0x29,0xb1,0x4d,0x30,
-0x0c,0x90,0xb7,0x02,0xc0,0x0d,0x9c,0xc1,0x00,0xc2,0x0d,0x05,0x10,0x00,0xb3,0x0a,
-0x50,0x00,0x01,0xd0,0x02,0xd3,0x00,0x1b,0x50,0x00,0x2b,0xdd,0xd5,0x7f,0x00,0x10,
-0x00,0xd7,0x00,0xf2,0x11,0x10,0x00,0xef,0xff,0xf4,0x03,0xe0,0x00,0xd0,0x07,0x90,
-0x08,0x70,0x06,0xc0,0x97,0x00,0x4c,0xc5,0xd0,0x00,0x94,0x97,0xb2,0x00,0x77,0x00,
-0xd0,0x00,0x0b,0xcd,0x50,0x56,0x00,0xf0,0x10,0x04,0x43,0x00,0x00,0x0f,0xfc,0x00,
-0x1c,0x98,0x88,0x88,0x18,0x02,0x22,0x09,0x18,0x3b,0xba,0x09,0x08,0x15,0x54,0x09,
-0x08,0x27,0x76,0x09,0x0c,0x99,0x99,0x88,0x1c,0x00,0x31,0x00,0x02,0x21,0xd6,0x00,
-0xf2,0x39,0x20,0x04,0xcf,0xf8,0xb8,0x6f,0x71,0x32,0x91,0xb9,0x00,0x00,0x90,0x05,
-0xa0,0x00,0x90,0x09,0x50,0x00,0x92,0xd4,0x00,0x00,0xb9,0x9d,0x30,0x00,0x30,0x08,
-0xfe,0xfa,0x00,0x00,0x13,0x30,0x14,0x44,0x44,0x41,0x85,0xf8,0x44,0x58,0x90,0x62,
-0x7e,0xf8,0x91,0xf6,0x4d,0xf8,0x90,0x62,0x00,0x08,0x91,0xf6,0x00,0x08,0x90,0x83,
-0x00,0x08,0x90,0xe6,0x00,0x08,0x89,0xfc,0x99,0x98,0x4f,0x01,0xf2,0x17,0x3b,0xee,
-0xb2,0x00,0x04,0xd3,0x99,0x3d,0x40,0x0d,0x20,0x99,0x02,0xd0,0x1c,0x00,0x76,0x20,
-0xc2,0x1b,0x1a,0x97,0xa7,0xc2,0x0c,0xa9,0x51,0x8a,0xd0,0x03,0xf6,0x00,0x3d,0x30,
-0x00,0x2a,0xee,0xa2,0x2c,0x00,0xf1,0x1e,0x03,0xdd,0x90,0x00,0x00,0x0d,0x20,0x86,
-0x02,0x00,0x0d,0x00,0x49,0xef,0xa0,0x09,0x84,0xc9,0xff,0xf0,0x00,0xde,0xeb,0xff,
-0xb0,0x09,0x55,0xff,0xff,0x70,0x0c,0x1f,0xff,0xff,0xe0,0x0e,0xdf,0xff,0xff,0xf0,
-0x00,0x01,0x22,0x22,0x10,0xff,0x00,0x10,0x0a,0x28,0x07,0xf0,0x0d,0xa5,0x00,0x9a,
-0xa9,0x9f,0x60,0x89,0x99,0x99,0x92,0x2e,0xff,0xff,0xfe,0x02,0xd6,0x44,0x44,0x00,
-0x2c,0x20,0x00,0x00,0x01,0x90,0x00,0x00,0x00,0xd3,0x00,0xf0,0x15,0x05,0x8a,0x50,
-0x00,0x00,0x8a,0x76,0x70,0x00,0x08,0x63,0x70,0x00,0x15,0x58,0x50,0x00,0x4d,0x21,
-0x7a,0x00,0x0e,0x88,0xf1,0xf5,0x00,0x9b,0x49,0x2f,0x20,0x00,0x89,0x79,0x30,0x00,
-0x00,0x46,0x08,0xf3,0x01,0xea,0x00,0xd0,0x09,0x6a,0x0d,0x00,0x69,0xc2,0xd0,0x00,
-0x0a,0x2d,0x00,0x00,0xa2,0x07,0x00,0x42,0xed,0xdd,0xde,0x10,0xa0,0x00,0x30,0x3a,
-0x89,0x00,0xcc,0x26,0x20,0xaa,0x30,0x5b,0x00,0xf1,0x0e,0xa0,0x09,0x24,0x8c,0xd3,
-0x90,0x08,0x18,0x66,0x00,0x91,0x08,0x00,0x9f,0x10,0x26,0x08,0x20,0x67,0x30,0x45,
-0x00,0x88,0x89,0x99,0x80,0x00,0x00,0x00,0x52,0x00,0xf5,0x0d,0xe2,0x40,0x00,0x00,
-0x01,0xf4,0xc0,0x00,0x7d,0x7d,0x8d,0x20,0x03,0xb0,0x2e,0x1c,0x20,0x08,0x40,0x06,
-0xf8,0x00,0x0b,0x00,0x00,0xe2,0x00,0x0c,0x05,0x00,0x01,0x01,0x00,0xf1,0x22,0x0a,
-0x80,0x55,0x91,0x1a,0x90,0x04,0x14,0xf9,0x2e,0x70,0x02,0x00,0x00,0x1a,0xb5,0x00,
-0x00,0x09,0xe0,0x08,0xc8,0x10,0x15,0x00,0x00,0x1c,0xcc,0xb0,0x00,0x00,0x3c,0x10,
-0x05,0xd1,0x00,0x41,0x01,0x11,0x11,0x11,0x10,0x3b,0xbb,0xbb,0xbb,0xb9,0x00,0x00,
-0x28,0x0a,0x06,0x05,0x00,0x3b,0x9c,0xbb,0x90,0x14,0x00,0x51,0x2a,0xaa,0xdb,0xaa,
-0xa7,0x32,0x00,0x80,0x2b,0xbb,0xbb,0xbb,0xb7,0x00,0x00,0x56,0x19,0x00,0x10,0x58,
-0x05,0x00,0x80,0x5d,0xb3,0x00,0x00,0x00,0x56,0x2c,0x80,0x14,0x00,0x13,0x50,0x19,
-0x00,0x04,0x05,0x00,0x80,0x0b,0xbb,0xbb,0xbb,0xb5,0x00,0x00,0x1d,0xf1,0x00,0xf0,
-0x01,0xc9,0x10,0x00,0x00,0x09,0xa9,0xb6,0x00,0x01,0xc7,0x39,0x09,0x90,0x1d,0x40,
-0x39,0x0e,0x06,0x37,0x39,0x00,0x00,0x05,0x00,0x00,0x01,0x00,0xa0,0x06,0x60,0x00,
-0x00,0x00,0x9b,0xbb,0xbb,0x90,0x0c,0x92,0x02,0xf0,0x02,0xea,0xaa,0xaa,0xa0,0x00,
-0x00,0x00,0x0c,0x29,0x99,0x99,0x80,0xc0,0x11,0x11,0x11,0x2a,0x7f,0x01,0x67,0x60,
-0x00,0x00,0xab,0xb1,0x00,0x01,0x00,0x10,0xa5,0xdd,0x08,0xfd,0x03,0x8b,0x30,0x00,
-0x01,0xa7,0x11,0xc5,0x00,0x5d,0x50,0x92,0x09,0xb1,0x20,0x00,0x92,0x00,0x30,0xd7,
-0x00,0x00,0x05,0x00,0xb4,0x09,0x20,0x00,0xbb,0xbe,0xcb,0xb5,0xb0,0x09,0x20,0x37,
-0x04,0x00,0x40,0xeb,0xbe,0xcb,0xc7,0x18,0x00,0x05,0x04,0x00,0xf0,0x14,0x0a,0x20,
-0x00,0x08,0xba,0xeb,0xaa,0xb0,0x84,0x1a,0x31,0x1b,0x04,0x88,0xd9,0x88,0x60,0xab,
-0xbe,0xbb,0xbb,0x2b,0x00,0xa2,0x00,0x92,0xda,0xae,0xba,0xad,0x26,0x00,0xa2,0x00,
-0x41,0x24,0x00,0xf2,0x1f,0x00,0x00,0xca,0xaa,0xad,0x40,0x00,0xb0,0x80,0x06,0x40,
-0x00,0xb0,0x3b,0x16,0x40,0x00,0xb0,0x03,0x16,0x40,0x2b,0xeb,0xbb,0xbd,0xc7,0x00,
-0xb0,0x00,0x06,0x40,0x03,0x80,0x00,0x06,0x40,0x0c,0x20,0x00,0x06,0x40,0x38,0x00,
-0x03,0xbc,0x20,0xe2,0x03,0xf2,0x19,0x70,0xb0,0x00,0x00,0x07,0x1b,0x00,0x00,0x1b,
-0xbb,0xeb,0xbb,0xe0,0x00,0x29,0x00,0x0c,0x00,0x06,0x69,0x10,0xc0,0x00,0xc0,0x39,
-0x0c,0x00,0x77,0x00,0x30,0xb0,0x5b,0x00,0x00,0x39,0x2a,0x00,0x02,0xbc,0x40,0xd9,
-0x00,0x10,0x50,0x05,0x00,0xd0,0x5b,0x00,0x00,0x06,0x99,0x9c,0xa9,0x91,0x01,0x11,
-0x4a,0x11,0x10,0x04,0x2a,0x61,0x00,0x02,0xaa,0xbd,0xaa,0x80,0xfb,0x09,0x01,0x0f,
-0x00,0x01,0x05,0x00,0x53,0x2b,0xbb,0xce,0xbb,0xb7,0x29,0x02,0xc0,0x92,0x02,0x40,
-0x04,0x80,0x39,0x09,0x40,0x00,0xb1,0x01,0x0c,0x9b,0x0a,0x50,0x94,0x00,0x00,0x08,
-0x65,0xbe,0x02,0x10,0xcc,0x29,0x01,0xd3,0xbb,0x70,0x00,0x05,0xb7,0x00,0x7c,0x50,
-0x47,0x00,0x00,0x01,0x84,0x64,0x00,0x00,0x20,0x06,0x80,0x99,0x9c,0x99,0x40,0x01,
-0x11,0x11,0x2d,0xaa,0x00,0x10,0xb5,0x45,0x02,0xf0,0x25,0x60,0x00,0x00,0x01,0xc6,
-0x00,0x00,0x00,0x4c,0x40,0x00,0x00,0x0b,0xaa,0x21,0x01,0x21,0x25,0x03,0x8a,0xaa,
-0x94,0x00,0x00,0x51,0x00,0x00,0x00,0x78,0xe9,0x88,0x30,0x00,0xb1,0x11,0x17,0x50,
-0x00,0xb0,0x00,0x3a,0x20,0x00,0xb0,0x00,0x64,0x00,0x00,0xba,0xaa,0xaa,0xb4,0x4d,
-0x00,0x64,0x65,0x1a,0xaa,0xaa,0xa8,0x74,0x71,0x01,0x23,0x5a,0xb0,0xa6,0x01,0xf0,
-0x12,0x01,0x35,0x50,0x01,0xda,0xa9,0x86,0x20,0x03,0x80,0x07,0x00,0x00,0x05,0x50,
-0x0b,0x00,0x00,0x0a,0xb9,0x9e,0x99,0x93,0x01,0x21,0x1c,0x11,0x10,0x00,0x91,0x0b,
-0x08,0x10,0xc2,0x0a,0xb3,0xb0,0x2c,0x00,0x0b,0x00,0x76,0x02,0x05,0xb8,0x00,0x02,
-0x36,0x00,0xff,0x27,0x23,0x58,0x00,0x06,0x99,0xc8,0x42,0x00,0x47,0x77,0xb9,0x77,
-0x70,0x24,0x57,0xa7,0x94,0x40,0x09,0xa7,0x73,0xa9,0x60,0x00,0x47,0x84,0xa1,0x20,
-0x5a,0x99,0xec,0x9a,0xb0,0x00,0x4a,0x85,0xa1,0x00,0x3b,0xa0,0x73,0x2c,0x70,0x43,
-0x00,0x73,0x00,0x71,0x04,0xcc,0xcc,0xcc,0x90,0x00,0x01,0x00,0x05,0xb0,0x2c,0xcc,
-0xcc,0xcc,0xc8,0x06,0xbb,0xbb,0xbb,0xb0,0x00,0x3a,0x03,0x01,0x05,0x00,0xa6,0x29,
-0x99,0xae,0x99,0x96,0x01,0x11,0x2b,0x11,0x11,0x14,0x00,0x30,0x00,0x00,0x1b,0x09,
-0x00,0x10,0xc7,0x0a,0x00,0x01,0x8d,0x01,0x41,0x93,0x00,0x00,0x5b,0x37,0x00,0xf2,
-0x3b,0x75,0x00,0x94,0x00,0x09,0x81,0x00,0x2a,0x60,0x25,0x1b,0x03,0xc0,0x70,0x00,
-0x05,0x8c,0x30,0x00,0x00,0x01,0xeb,0x00,0x00,0x03,0x8b,0x25,0xc7,0x30,0x58,0x30,
-0x00,0x04,0x91,0x00,0x00,0x20,0x00,0x00,0x24,0x44,0xc6,0x44,0x40,0x35,0x55,0x55,
-0x55,0x50,0x04,0xb8,0x88,0x8d,0x00,0x03,0xa7,0x77,0x7b,0x00,0x06,0x99,0x99,0x99,
-0x00,0x00,0x00,0x49,0x82,0x00,0x6a,0xaa,0xdb,0xaa,0xa2,0x20,0x01,0x10,0x29,0x29,
-0x06,0x00,0x54,0x01,0xf0,0x13,0x6a,0xaa,0xcc,0xaa,0xa1,0x00,0x55,0x55,0x55,0x00,
-0x00,0xc3,0x33,0x3c,0x00,0x00,0xa8,0x88,0x89,0x00,0x49,0x88,0x88,0x88,0xa0,0x65,
-0x09,0x99,0x70,0xa0,0x00,0x1a,0x00,0xb0,0x03,0x09,0x64,0xb0,0x81,0x4b,0x70,0x00,
-0xaa,0x54,0x01,0x05,0x3a,0x03,0xf0,0x08,0xb4,0xea,0xaa,0xe1,0x05,0xc0,0x91,0x00,
-0xb0,0x3d,0xb0,0x56,0x03,0x80,0x42,0xb0,0x0b,0x0a,0x20,0x00,0xb0,0x06,0xa8,0xd3,
-0x2a,0xc8,0xf3,0x00,0x00,0xb0,0x5c,0x3c,0x40,0x00,0xb9,0x80,0x00,0x87,0x0b,0x01,
-0x20,0x03,0xe0,0x05,0x00,0xf0,0x03,0xa4,0xa1,0x00,0x00,0x08,0xa0,0x02,0xc6,0x00,
-0x3c,0x52,0x00,0x03,0x7c,0x00,0x00,0xc0,0x00,0x1a,0x01,0x00,0x03,0x01,0x91,0x03,
-0x90,0x00,0xb0,0x00,0x01,0xc2,0x00,0x0b,0xae,0x0d,0x04,0x72,0x00,0x60,0x93,0x00,
-0xc0,0x00,0x00,0xa2,0x05,0x00,0x10,0xb1,0x05,0x00,0xf1,0x3b,0xd4,0x02,0xd0,0x00,
-0x00,0xcc,0x15,0xf2,0x00,0x04,0x83,0xaa,0x67,0x00,0x09,0x40,0x4c,0x0b,0x10,0x3b,
-0x00,0xb4,0x03,0xb0,0x63,0x02,0x70,0x00,0x51,0x00,0xa1,0x10,0xb0,0x00,0x04,0x80,
-0xb0,0xb1,0x50,0x1e,0x20,0xb4,0xea,0xc0,0xbc,0x48,0xe6,0xb0,0xb0,0x19,0x32,0xb0,
-0xb0,0xb0,0x09,0x20,0xb0,0xb9,0x90,0x09,0x20,0xb0,0xa0,0x00,0x09,0x20,0xb0,0x00,
-0x64,0x09,0x20,0x9b,0xaa,0xb1,0xed,0x01,0xf2,0x19,0x60,0x40,0x02,0x90,0x2a,0x08,
-0x50,0x47,0x02,0xa0,0x0c,0x05,0x60,0x2a,0x00,0x10,0x93,0x02,0xa0,0x00,0x0c,0x00,
-0x2a,0x18,0x14,0xb0,0x04,0xeb,0x31,0xda,0x60,0x53,0x05,0xd3,0x0a,0x50,0x01,0x91,
-0x00,0x06,0x8c,0x00,0xf6,0x1d,0x56,0x32,0x60,0x31,0x00,0xc0,0xb0,0xb1,0xa1,0x07,
-0x90,0xa1,0x21,0xb0,0x4d,0x90,0x65,0x03,0x80,0x33,0x90,0x1b,0x0a,0x20,0x01,0x90,
-0x08,0x88,0x00,0x01,0x90,0x03,0xf3,0x00,0x01,0x90,0x4b,0x4c,0x40,0x01,0x9a,0x70,
-0x01,0x98,0xf8,0x00,0xf3,0x18,0x1a,0x28,0x80,0x00,0x07,0x4b,0x10,0xe9,0xe1,0xe1,
-0xa0,0x0b,0x0b,0xad,0x1a,0x00,0xb0,0xb2,0x91,0xa0,0x0b,0x0b,0x09,0x1a,0x12,0xb0,
-0xb0,0x92,0xe9,0x2b,0x8b,0x09,0x10,0x00,0xb0,0x00,0x91,0x00,0x0b,0x2e,0x00,0xf1,
-0x0f,0x66,0x51,0xb0,0x00,0x00,0xc0,0xc2,0xc1,0x10,0x09,0xa2,0xd9,0xe9,0x92,0x3b,
-0x96,0x20,0xb0,0x00,0x01,0x96,0x99,0xe9,0x97,0x01,0x90,0x11,0xc1,0x11,0x01,0x23,
-0x01,0x05,0x05,0x00,0x03,0xb2,0x02,0x01,0x1a,0x05,0xe0,0x13,0x6a,0xb0,0x00,0xc5,
-0x97,0xc1,0x00,0x08,0xb0,0x00,0xb0,0x00,0x5b,0x05,0x00,0x60,0x20,0xb9,0xbb,0xeb,
-0xb7,0x00,0x0a,0x00,0x03,0x05,0x00,0xf7,0x2b,0x11,0xc1,0x10,0x00,0xb4,0x99,0x99,
-0x95,0x00,0x23,0x02,0x03,0x00,0x00,0x93,0x0c,0x08,0x20,0x01,0xb0,0x67,0x03,0x90,
-0x0b,0x93,0xc0,0x00,0xa4,0x3a,0x99,0xab,0xbb,0x99,0x02,0x90,0x08,0x30,0xb0,0x01,
-0x90,0x0a,0x00,0xb0,0x01,0x90,0x1a,0x01,0x90,0x01,0x90,0xa3,0x03,0x80,0x01,0x96,
-0x60,0x7b,0x30,0xc6,0x01,0xf8,0x1d,0x47,0x0c,0x29,0x00,0x00,0xb1,0x0b,0x03,0x60,
-0x05,0xc3,0x5c,0x9a,0xb2,0x2d,0xb6,0x6a,0x61,0x40,0x22,0xb0,0x05,0x67,0x60,0x00,
-0xb0,0x01,0xc9,0x00,0x00,0xb0,0x06,0xf1,0x12,0x00,0xb2,0xb8,0x77,0x36,0x00,0xb6,
-0x20,0x0a,0xd2,0xfe,0x01,0xf4,0x20,0xc1,0x08,0x30,0x00,0x00,0x57,0x6a,0xea,0xaa,
+0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x00,0x01,0x00,0x2f,0xfd,
+0x00,0x01,0x00,0x03,0x13,0xf8,0x08,0x00,0x08,0x2e,0x00,0xce,0xfc,0xfb,0x00,0xfe,
+0xfb,0x00,0xfa,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x4e,0x02,0x01,0x00,0x02,0x16,
+0x00,0x2f,0xf3,0x00,0x01,0x00,0x15,0x1f,0xef,0x1e,0x00,0x0a,0x03,0x88,0x00,0xb1,
+0xfb,0x00,0xff,0x00,0x00,0xf6,0xff,0xf9,0xfb,0x00,0xf9,0x11,0x00,0x00,0x0f,0x00,
+0x4d,0xff,0xff,0xfc,0xfd,0x92,0x00,0x6f,0xfe,0x00,0xfe,0x00,0x00,0xfc,0x4a,0x00,
+0x01,0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x16,0xff,0x00,0x01,0x13,0xfe,0x48,
+0x00,0x3f,0xfe,0xfd,0xfe,0x9c,0x00,0x0a,0x15,0x02,0x3c,0x00,0x11,0xff,0x3f,0x00,
+0x26,0xff,0xfe,0x30,0x00,0x11,0xee,0x04,0x01,0x15,0xeb,0x24,0x00,0x00,0x4b,0x00,
+0x13,0xfe,0x04,0x00,0x08,0x01,0x00,0x13,0x01,0x70,0x00,0x1f,0x01,0x6b,0x00,0x08,
+0x1f,0xfe,0x43,0x01,0x0d,0x1b,0xfb,0x25,0x00,0x12,0xfe,0x67,0x00,0x31,0xfe,0xfd,
+0xfb,0x0f,0x00,0x14,0xe6,0x6c,0x00,0x97,0xfb,0x00,0x00,0xeb,0xfc,0xf2,0xf5,0x00,
+0xed,0x08,0x02,0x25,0xf6,0xf9,0x0c,0x00,0x75,0xe7,0x00,0x00,0x00,0xf5,0x00,0xf0,
+0x48,0x01,0x21,0xff,0xff,0x17,0x01,0x1f,0x01,0xf7,0x01,0x01,0x10,0xfd,0x63,0x00,
+0x1f,0xfd,0x97,0x00,0x0b,0x3e,0xfa,0x00,0xff,0x8c,0x01,0x03,0x7b,0x02,0xb1,0xef,
+0xee,0x00,0x00,0xfa,0xfe,0xed,0xff,0x01,0x00,0x01,0x60,0x00,0xd3,0xf7,0xf8,0x00,
+0xf7,0xf8,0xfa,0xf7,0x00,0xf9,0xfa,0xfc,0xfa,0xfb,0x5e,0x01,0x66,0xee,0xfd,0x00,
+0x00,0xfa,0xff,0x2b,0x01,0x50,0xfc,0xfd,0x00,0x00,0xfc,0x44,0x01,0x14,0xff,0x8b,
+0x02,0x42,0x01,0x00,0xf6,0xfb,0x51,0x00,0x13,0x01,0x24,0x00,0x04,0x68,0x01,0x27,
+0xff,0x00,0xaf,0x02,0x14,0xfc,0x20,0x01,0x15,0x01,0x51,0x01,0x27,0xfe,0x00,0x8c,
+0x01,0xf0,0x00,0xfe,0x02,0xfc,0xf0,0xfc,0x00,0x00,0xf9,0xfe,0xf9,0xff,0x01,0xf9,
+0x01,0x01,0x92,0x00,0x90,0xfa,0xfb,0xfe,0xfd,0xfb,0xfd,0xfb,0xfe,0xfd,0x4c,0x01,
+0x16,0x01,0xc5,0x00,0x09,0xa8,0x01,0x03,0x48,0x00,0x08,0xf8,0x01,0x06,0x9e,0x02,
+0x0f,0xab,0x01,0x07,0x0f,0x01,0x00,0x06,0x1f,0xff,0xf0,0x01,0x10,0x11,0xff,0x97,
+0x01,0x0e,0x5f,0x00,0x0f,0x4f,0x00,0x07,0x0f,0x1d,0x00,0x0a,0x1e,0x01,0xbd,0x03,
+0x19,0x01,0x81,0x00,0x16,0x01,0x14,0x04,0x0f,0x01,0x00,0x1e,0x0b,0xc9,0x00,0x1f,
+0xf5,0x90,0x00,0x0b,0x05,0xd7,0x01,0x1c,0xf6,0x31,0x02,0x11,0xff,0x93,0x00,0x10,
+0x04,0x2b,0x02,0x0f,0x6f,0x00,0x15,0x17,0x01,0xcc,0x04,0x06,0xa7,0x03,0x1d,0x01,
+0x14,0x01,0x1f,0xf6,0xd8,0x00,0x24,0x1f,0xfe,0x7d,0x01,0x10,0x1f,0xff,0x3d,0x00,
+0x1c,0x03,0x8c,0x01,0x30,0x02,0x03,0x00,0xed,0x00,0x2d,0x04,0x05,0x21,0x00,0xf1,
+0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,
+0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xff,0x0d,
+0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,
+0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,0xff,0xff,
+0xae,0x02,0x1c,0x03,0x20,0x03,0x02,0x17,0x03,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,
+0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xf1,
+0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,
+0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,
+0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,0x00,0x02,
+0x1f,0x24,0x16,0x03,0xff,0xff,0x91,0x50,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const uint8_t lz4BitmapData[] ={
+0xf0,0x1a,0x2c,0x2b,0x2b,0x2b,0x2b,0x17,0x00,0x2b,0x55,0xa5,0x59,0x32,0x60,0x00,
+0x55,0x55,0x00,0x08,0x29,0x20,0x0c,0xec,0xec,0x00,0x0b,0x0b,0x00,0x00,0xa0,0xa0,
+0x05,0xce,0xcd,0x80,0x05,0x56,0x50,0x00,0x82,0x92,0x00,0x01,0x00,0xf0,0x85,0x74,
+0x00,0x05,0xdc,0x30,0x1d,0x14,0xd0,0x2c,0x00,0x80,0x0b,0xa3,0x00,0x00,0x5c,0x70,
+0x23,0x00,0xd0,0x4b,0x01,0xe0,0x09,0xed,0x50,0x00,0x83,0x00,0x1b,0xb1,0x00,0x07,
+0x45,0x63,0x70,0x64,0x55,0xa0,0x01,0xa9,0x65,0x00,0x00,0x0a,0x6a,0x40,0x08,0x3b,
+0x0b,0x01,0x90,0xb0,0xb0,0x00,0x08,0xa6,0x05,0xdc,0x10,0x00,0xd1,0x67,0x00,0x0c,
+0x3a,0x40,0x00,0x5f,0x70,0x00,0x1d,0xa9,0x07,0x07,0x80,0xc8,0x90,0x59,0x02,0xf4,
+0x00,0x9b,0xc9,0xc0,0x73,0x73,0x41,0x00,0x71,0x04,0x90,0x0b,0x10,0x1c,0x00,0x4a,
+0x00,0x59,0x00,0x49,0x00,0x2b,0x00,0x0d,0x00,0x09,0x40,0x01,0xb0,0x00,0x21,0x81,
+0x03,0xa0,0x0b,0x20,0x67,0x04,0xa0,0x2b,0x03,0xb0,0x49,0x08,0x50,0xc0,0x76,0x03,
+0x00,0x03,0x80,0x07,0x69,0x80,0x3b,0xe5,0x01,0xca,0x30,0x13,0x13,0x00,0x00,0x83,
+0x00,0x00,0xa4,0x03,0x00,0x32,0x9f,0xff,0xf3,0x09,0x00,0xf6,0x28,0x67,0x85,0x70,
+0xad,0x70,0x01,0x3b,0x00,0x1a,0x00,0x74,0x00,0xb0,0x02,0x90,0x08,0x40,0x0c,0x00,
+0x38,0x00,0x83,0x00,0x60,0x00,0x08,0xdc,0x30,0x2c,0x03,0xc0,0x58,0x00,0xe0,0x67,
+0x00,0xd0,0x67,0x00,0xd0,0x58,0x00,0xe0,0x2c,0x03,0xb0,0x07,0xdc,0x30,0x03,0x98,
+0x2b,0x99,0x00,0x59,0x02,0x00,0xf0,0x6e,0x09,0xdd,0x30,0x5a,0x03,0xc0,0x32,0x01,
+0xd0,0x00,0x07,0x80,0x00,0x3c,0x00,0x01,0xd2,0x00,0x0b,0x40,0x00,0x6f,0xdd,0xd3,
+0x0a,0xdd,0x35,0x80,0x2c,0x00,0x04,0xb0,0x1d,0xf2,0x00,0x04,0xb2,0x20,0x0e,0x5a,
+0x03,0xc0,0xad,0xc2,0x00,0x0d,0x60,0x00,0x7e,0x60,0x01,0xc8,0x60,0x0a,0x38,0x60,
+0x4a,0x08,0x60,0xad,0xde,0xe5,0x00,0x08,0x60,0x00,0x08,0x60,0x0a,0xff,0xf0,0x0c,
+0x10,0x00,0x0d,0x00,0x00,0x0e,0xdd,0x50,0x04,0x02,0xe0,0x00,0x00,0xb2,0x1c,0x00,
+0xd1,0x06,0xdd,0x60,0x01,0xae,0x10,0x0b,0x80,0x00,0x1d,0x00,0x00,0x4c,0xcd,0x40,
+0x5d,0x12,0xe0,0x49,0x00,0xc1,0x1d,0x01,0xd0,0x05,0xdd,0x40,0x8d,0xdd,0xf2,0x00,
+0x01,0xc0,0x00,0x07,0x60,0x34,0x00,0x70,0x49,0x00,0x00,0xb3,0x00,0x01,0xd0,0x4a,
+0x00,0xf0,0x5b,0x09,0xdd,0x40,0x3c,0x02,0xd0,0x2c,0x03,0xc0,0x09,0xef,0x30,0x3c,
+0x03,0xc0,0x67,0x00,0xd0,0x4b,0x02,0xd0,0x08,0xdd,0x40,0x09,0xdc,0x15,0xa0,0x5a,
+0x76,0x00,0xd4,0xb0,0x4f,0x08,0xd8,0xe0,0x00,0x3c,0x00,0x0b,0x60,0x7e,0x70,0x3a,
+0x01,0x00,0x00,0x01,0x3a,0x58,0x01,0x00,0x00,0x12,0x58,0x84,0x30,0x00,0x18,0x40,
+0x8d,0x70,0x9c,0x10,0x00,0x7d,0x81,0x00,0x08,0x40,0x3e,0xee,0xb0,0x00,0x00,0x3e,
+0xee,0xb0,0x49,0x10,0x00,0x6d,0x91,0x00,0x0a,0xc1,0x7d,0x81,0x48,0x10,0x00,0x1c,
+0xea,0x08,0x60,0xb3,0x00,0x0a,0x30,0x04,0xc0,0x00,0xd1,0x00,0x27,0xdc,0x01,0xf0,
+0x7c,0x3a,0x00,0x00,0x3b,0xbb,0x80,0x00,0x3a,0x00,0x04,0x90,0x0b,0x02,0xba,0x18,
+0x22,0x80,0xb1,0x92,0x35,0x55,0x1a,0x0a,0x12,0x76,0x44,0x80,0xb0,0x36,0x56,0x38,
+0x0d,0x07,0x31,0xa0,0xb9,0x7a,0x80,0x09,0x50,0x00,0x00,0x00,0x07,0xba,0xa0,0x00,
+0x00,0x5d,0x00,0x00,0x0a,0xd2,0x00,0x00,0xd5,0x80,0x00,0x59,0x0d,0x00,0x0a,0x30,
+0xb3,0x00,0xfd,0xde,0x80,0x59,0x00,0x1d,0x0b,0x40,0x00,0xb3,0x2f,0xdd,0xb0,0x2c,
+0x00,0x96,0x2c,0x00,0xa5,0x2f,0xde,0xc0,0x2c,0x00,0x97,0x2c,0x00,0x5a,0x2c,0x00,
+0x97,0x2f,0xdd,0xa0,0x03,0xcd,0xb2,0x00,0xd3,0x05,0xb0,0x4a,0x00,0x09,0x06,0x80,
+0x00,0x00,0x68,0x00,0x00,0x04,0xa0,0x00,0x80,0x0d,0x30,0x5b,0x00,0x3c,0xdb,0x10,
+0x2f,0xed,0x70,0x2c,0x00,0xb6,0x2c,0x00,0x2c,0x2c,0x00,0x0e,0x03,0x00,0x00,0x09,
+0x00,0xd1,0xb6,0x2f,0xde,0x70,0x2f,0xdd,0xd4,0x2c,0x00,0x00,0x2c,0x00,0x00,0x55,
+0x00,0x14,0x00,0x0c,0x00,0x47,0xd4,0x2f,0xdd,0xd3,0x0f,0x00,0x15,0xa0,0x0c,0x00,
+0xa1,0x03,0xcd,0xc2,0x00,0xd3,0x04,0xc0,0x4b,0x00,0x06,0x64,0x00,0xf0,0x05,0x06,
+0xde,0x14,0xb0,0x00,0xd1,0x0d,0x40,0x1e,0x10,0x2c,0xed,0x60,0x2c,0x00,0x0a,0x42,
+0xc0,0x00,0xa4,0x07,0x00,0x36,0xfd,0xdd,0xf4,0x0e,0x00,0x00,0x07,0x00,0x13,0x1d,
+0x01,0x00,0x53,0x00,0x03,0xc0,0x00,0x3c,0x05,0x00,0xf5,0x15,0xc3,0x00,0x3b,0x96,
+0x07,0x91,0xcd,0xb1,0x2c,0x00,0x7a,0x02,0xc0,0x4d,0x00,0x2c,0x2d,0x20,0x02,0xcd,
+0x60,0x00,0x2f,0xad,0x00,0x02,0xc0,0x89,0x00,0x2c,0x00,0xd4,0x02,0xc0,0x03,0xd0,
+0x79,0x00,0x08,0x03,0x00,0xf1,0x52,0x2f,0xdd,0xd1,0x2f,0x30,0x00,0x7e,0x2f,0x90,
+0x00,0xde,0x2b,0xd0,0x03,0xbe,0x2b,0x94,0x09,0x5e,0x2c,0x4a,0x0d,0x0e,0x2c,0x0d,
+0x59,0x0e,0x2c,0x08,0xe4,0x0e,0x2c,0x02,0xe0,0x0e,0x2f,0x10,0x0a,0x42,0xfa,0x00,
+0xa4,0x2c,0xd3,0x0a,0x42,0xc4,0xc0,0xa4,0x2c,0x0b,0x6a,0x42,0xc0,0x2e,0xb4,0x2c,
+0x00,0x8f,0x42,0xc0,0x00,0xe4,0x02,0xce,0xb1,0x00,0xd4,0x05,0xc0,0x4b,0x00,0x0d,
+0x26,0x80,0x00,0xa4,0x68,0x00,0x0a,0x44,0xb0,0x00,0xd2,0x0d,0x40,0x5c,0x00,0x2c,
+0xeb,0x10,0x2f,0xed,0xc2,0x2c,0x00,0x5b,0x22,0x01,0x46,0x5b,0x2f,0xdd,0xb2,0xf8,
+0x00,0xf1,0x16,0xce,0xb1,0x00,0xd3,0x06,0xb0,0x4a,0x00,0x0d,0x17,0x70,0x00,0xb3,
+0x77,0x00,0x0b,0x35,0xa0,0x00,0xd1,0x0d,0x30,0x6b,0x00,0x3c,0xef,0x40,0x00,0x00,
+0x4d,0x10,0x00,0x00,0x00,0x2f,0xee,0xa0,0x8e,0x01,0xfe,0x1f,0x4a,0x2c,0x00,0xa7,
+0x2f,0xde,0xa0,0x2c,0x04,0xb0,0x2c,0x00,0xc3,0x2c,0x00,0x4b,0x07,0xdd,0x80,0x3c,
+0x00,0xb5,0x5b,0x00,0x22,0x0b,0xb5,0x00,0x00,0x3a,0xd1,0x32,0x00,0x87,0x6a,0x00,
+0x96,0x08,0xdd,0xa0,0xad,0xee,0xda,0x00,0x77,0x00,0x03,0x00,0x38,0x59,0x00,0x1d,
+0x03,0x00,0xf0,0x45,0x4a,0x00,0x2c,0x1d,0x10,0x79,0x05,0xde,0xa1,0xb4,0x00,0x0e,
+0x15,0x90,0x04,0xb0,0x1e,0x00,0x96,0x00,0xb3,0x0d,0x10,0x06,0x83,0xb0,0x00,0x1d,
+0x86,0x00,0x00,0xbe,0x10,0x00,0x06,0xc0,0x00,0x95,0x00,0xf0,0x06,0x86,0x80,0x4f,
+0x40,0x95,0x2b,0x08,0x98,0x0c,0x10,0xe0,0xc1,0xb0,0xd0,0x0b,0x3c,0x0c,0x3a,0x00,
+0x89,0x80,0x89,0x70,0x04,0xf4,0x04,0xf4,0x00,0x1f,0x00,0x0f,0x00,0x6b,0x00,0x7a,
+0x0d,0x41,0xe2,0x04,0xd9,0x80,0x00,0xbe,0x37,0x00,0xf6,0x08,0x04,0xc8,0x90,0x0d,
+0x30,0xe2,0x6a,0x00,0x6b,0xa5,0x00,0x6a,0x3d,0x00,0xd2,0x0b,0x45,0xb0,0x03,0xcc,
+0x30,0x00,0xbb,0x88,0x00,0xf6,0x0e,0x7d,0xdd,0xf6,0x00,0x01,0xe1,0x00,0x0b,0x50,
+0x00,0x4c,0x00,0x00,0xd2,0x00,0x08,0x80,0x00,0x2d,0x00,0x00,0x9f,0xdd,0xd8,0x4d,
+0x74,0xa0,0x4a,0x04,0x03,0x00,0x60,0x4e,0x70,0xa3,0x00,0x04,0x90,0x5c,0x03,0x40,
+0x94,0x00,0x03,0xa0,0x08,0x00,0x94,0x85,0x00,0x02,0xa0,0x00,0x06,0x00,0xcc,0x0e,
+0x01,0x00,0xf4,0x63,0xcc,0x06,0x90,0x0c,0xc0,0x2a,0x84,0x85,0x2a,0xdd,0xdd,0x60,
+0x44,0x00,0xc1,0x09,0xdc,0x22,0x60,0x4a,0x07,0xbc,0xb5,0xa0,0x3b,0x69,0x07,0xb0,
+0xcd,0x9b,0x59,0x00,0x00,0x59,0x00,0x00,0x5c,0xcd,0x40,0x5c,0x02,0xd0,0x59,0x00,
+0xc1,0x59,0x00,0xc1,0x5c,0x02,0xd0,0x5b,0xce,0x40,0x08,0xdc,0x34,0xb0,0x2c,0x86,
+0x00,0x17,0x60,0x00,0x4b,0x02,0xb0,0x8d,0xc2,0x00,0x00,0xe0,0x00,0x0e,0x09,0xda,
+0xe4,0xb0,0x2e,0x76,0x00,0xe7,0x60,0x0e,0x4b,0x02,0xe0,0x9c,0xae,0x07,0xdc,0x33,
+0xa0,0x2c,0x7e,0xdd,0xd7,0x70,0x00,0x4c,0x01,0x60,0x8d,0xd4,0x03,0xd6,0x0c,0x30,
+0x0d,0x00,0x8f,0xc1,0x0e,0x00,0x02,0x00,0x43,0x09,0xda,0xe4,0xc0,0x30,0x00,0xf1,
+0x09,0x03,0xe0,0x9e,0xae,0x03,0x03,0xc0,0x9d,0xc3,0x59,0x00,0x05,0x90,0x00,0x5b,
+0xbe,0x45,0xc0,0x3c,0x59,0x01,0xd5,0x90,0x1d,0x05,0x00,0x31,0x3a,0x00,0x3a,0x01,
+0x00,0x62,0x04,0x90,0x00,0x04,0x90,0x49,0x03,0x00,0x32,0x05,0x94,0xe4,0x9b,0x00,
+0xf3,0x04,0x59,0x0b,0x60,0x59,0x89,0x00,0x5d,0xe0,0x00,0x5d,0xb6,0x00,0x59,0x1d,
+0x10,0x59,0x05,0xb0,0x3a,0x01,0x00,0xf5,0x03,0x5b,0xcd,0x5b,0xe8,0x05,0xb0,0x3f,
+0x10,0xe0,0x59,0x01,0xd0,0x0d,0x15,0x90,0x1d,0x00,0xd1,0x09,0x00,0x0b,0x61,0x00,
+0xf6,0x08,0x07,0xdd,0x40,0x4c,0x02,0xd0,0x86,0x00,0xb2,0x76,0x00,0xb3,0x3c,0x01,
+0xe0,0x07,0xdd,0x40,0x5c,0xbd,0x40,0x5b,0x01,0xf1,0x00,0x32,0x5c,0xcd,0x40,0x6e,
+0x00,0x36,0x09,0xda,0xd4,0xe3,0x00,0x21,0x9d,0xae,0xf7,0x00,0x55,0x00,0x00,0x5c,
+0xd3,0x5c,0x46,0x05,0xf6,0x0c,0x0a,0xdc,0x14,0xa0,0x56,0x1d,0x82,0x00,0x05,0xc5,
+0x67,0x05,0x90,0xad,0xc2,0x07,0x00,0xe0,0xbf,0xa0,0xe0,0x0e,0x00,0xe0,0x0e,0x00,
+0xac,0x71,0x00,0xf4,0x66,0x3b,0x04,0xd0,0xbd,0xad,0xb3,0x06,0x75,0x80,0xb2,0x1c,
+0x0d,0x00,0xb6,0x80,0x06,0xe3,0x00,0x1e,0x00,0xa3,0x0c,0x30,0xb2,0x67,0x0e,0x80,
+0xd0,0x2b,0x47,0xc3,0xa0,0x0d,0x92,0xb8,0x60,0x0a,0xd0,0x6f,0x20,0x06,0x90,0x2e,
+0x00,0x79,0x0a,0x60,0xd5,0xc0,0x04,0xf3,0x00,0x5f,0x40,0x0d,0x3d,0x08,0x80,0x97,
+0xb3,0x08,0x76,0x80,0xc2,0x1d,0x1c,0x00,0xb7,0x70,0x06,0xf2,0x00,0x1d,0x00,0x06,
+0x70,0x08,0xd1,0x00,0x7d,0xdf,0x70,0x02,0xd0,0x00,0xb4,0x00,0x6a,0x00,0x1d,0x10,
+0x08,0xed,0xd8,0x00,0x82,0x06,0x80,0x0a,0x40,0x0a,0x30,0x0c,0x10,0xaa,0x00,0x0c,
+0x10,0x0a,0x30,0x0a,0x40,0x06,0x80,0x00,0x82,0x29,0x01,0x00,0xf5,0x6f,0x14,0x82,
+0x00,0x2c,0x00,0x0e,0x00,0x0d,0x00,0x0b,0x30,0x04,0xf0,0x0b,0x20,0x0d,0x00,0x0e,
+0x00,0x2c,0x00,0x82,0x00,0x0b,0xd6,0x0b,0x13,0x70,0x9e,0x80,0x00,0x00,0xa3,0x00,
+0x00,0x00,0x0d,0xd3,0x00,0xed,0xdd,0xc2,0xd3,0x0d,0x00,0x00,0x02,0xd2,0xd0,0x00,
+0x00,0x4c,0x1c,0xdd,0xde,0x3d,0x10,0x00,0x00,0xdd,0x10,0x00,0x00,0x08,0x20,0x00,
+0x00,0x02,0xb0,0x00,0x00,0x02,0xde,0x00,0x00,0x02,0xd3,0xad,0xdd,0xe2,0xd3,0x00,
+0x00,0x0d,0x1d,0x50,0x00,0x00,0xd0,0x1c,0x5c,0xdd,0xdc,0x00,0x1c,0xf0,0x00,0x00,
+0x00,0x19,0x00,0x00,0x00,0x01,0x10,0x00,0x00,0x2d,0xd2,0x00,0x02,0xd3,0x3d,0x20,
+0x2d,0x30,0x03,0xd2,0x8d,0xe0,0x0e,0xd8,0x00,0xd0,0x0d,0x00,0x04,0x00,0xb8,0xdd,
+0xdd,0x00,0x00,0x11,0x11,0x00,0x00,0xdb,0xbd,0x00,0x18,0x00,0xf2,0x01,0xaf,0xc0,
+0x0c,0xfa,0x1c,0x50,0x05,0xc1,0x01,0xc5,0x5c,0x10,0x00,0x1c,0xc1,0x00,0x01,0x00,
+0x40,0x22,0x00,0x00,0x00,0xff,0x02,0xf1,0x0f,0x00,0x03,0xee,0x30,0x00,0x00,0x0c,
+0x77,0xb0,0x00,0x00,0x4e,0x00,0xe4,0x00,0x00,0xc5,0x00,0x6c,0x00,0x05,0xe2,0x22,
+0x2e,0x50,0x0d,0xff,0xff,0xff,0xd0,0x2b,0x00,0xf1,0x10,0x01,0x4d,0xd3,0x05,0xd8,
+0xc3,0x4b,0x3d,0x10,0xff,0xf5,0xa5,0x02,0xfe,0x78,0xb2,0x05,0x90,0x2b,0x96,0x00,
+0x00,0x69,0x2d,0x30,0x03,0xd1,0x03,0xcd,0xdc,0x30,0x98,0x00,0xf0,0x1f,0x08,0xcc,
+0x61,0x00,0x01,0xd3,0xee,0x3d,0x10,0x0b,0x70,0x44,0x07,0xb0,0x1a,0x20,0x00,0x01,
+0xc1,0x1a,0x10,0x00,0x01,0xb1,0x0b,0x50,0x00,0x05,0x90,0x04,0xc5,0x00,0x5a,0x60,
+0x00,0x4a,0xec,0x95,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x10,0x77,0x00,0xf0,0x17,
+0xeb,0xcd,0x91,0x00,0x1e,0x29,0xb1,0x4d,0x30,0x0c,0x90,0xb7,0x02,0xc0,0x0d,0x9c,
+0xc1,0x00,0xc2,0x0d,0x05,0x10,0x00,0xb3,0x0a,0x50,0x00,0x01,0xd0,0x02,0xd3,0x00,
+0x1b,0x50,0x00,0x2b,0xdd,0xd5,0x7f,0x00,0x10,0x00,0xd7,0x00,0xf2,0x11,0x10,0x00,
+0xef,0xff,0xf4,0x03,0xe0,0x00,0xd0,0x07,0x90,0x08,0x70,0x06,0xc0,0x97,0x00,0x4c,
+0xc5,0xd0,0x00,0x94,0x97,0xb2,0x00,0x77,0x00,0xd0,0x00,0x0b,0xcd,0x50,0x56,0x00,
+0xf0,0x10,0x04,0x43,0x00,0x00,0x0f,0xfc,0x00,0x1c,0x98,0x88,0x88,0x18,0x02,0x22,
+0x09,0x18,0x3b,0xba,0x09,0x08,0x15,0x54,0x09,0x08,0x27,0x76,0x09,0x0c,0x99,0x99,
+0x88,0x1c,0x00,0x31,0x00,0x02,0x21,0xd6,0x00,0xf2,0x39,0x20,0x04,0xcf,0xf8,0xb8,
+0x6f,0x71,0x32,0x91,0xb9,0x00,0x00,0x90,0x05,0xa0,0x00,0x90,0x09,0x50,0x00,0x92,
+0xd4,0x00,0x00,0xb9,0x9d,0x30,0x00,0x30,0x08,0xfe,0xfa,0x00,0x00,0x13,0x30,0x14,
+0x44,0x44,0x41,0x85,0xf8,0x44,0x58,0x90,0x62,0x7e,0xf8,0x91,0xf6,0x4d,0xf8,0x90,
+0x62,0x00,0x08,0x91,0xf6,0x00,0x08,0x90,0x83,0x00,0x08,0x90,0xe6,0x00,0x08,0x89,
+0xfc,0x99,0x98,0x4f,0x01,0xf2,0x17,0x3b,0xee,0xb2,0x00,0x04,0xd3,0x99,0x3d,0x40,
+0x0d,0x20,0x99,0x02,0xd0,0x1c,0x00,0x76,0x20,0xc2,0x1b,0x1a,0x97,0xa7,0xc2,0x0c,
+0xa9,0x51,0x8a,0xd0,0x03,0xf6,0x00,0x3d,0x30,0x00,0x2a,0xee,0xa2,0x2c,0x00,0xf1,
+0x1e,0x03,0xdd,0x90,0x00,0x00,0x0d,0x20,0x86,0x02,0x00,0x0d,0x00,0x49,0xef,0xa0,
+0x09,0x84,0xc9,0xff,0xf0,0x00,0xde,0xeb,0xff,0xb0,0x09,0x55,0xff,0xff,0x70,0x0c,
+0x1f,0xff,0xff,0xe0,0x0e,0xdf,0xff,0xff,0xf0,0x00,0x01,0x22,0x22,0x10,0xff,0x00,
+0x10,0x0a,0x28,0x07,0xf0,0x0d,0xa5,0x00,0x9a,0xa9,0x9f,0x60,0x89,0x99,0x99,0x92,
+0x2e,0xff,0xff,0xfe,0x02,0xd6,0x44,0x44,0x00,0x2c,0x20,0x00,0x00,0x01,0x90,0x00,
+0x00,0x00,0xd3,0x00,0xf0,0x15,0x05,0x8a,0x50,0x00,0x00,0x8a,0x76,0x70,0x00,0x08,
+0x63,0x70,0x00,0x15,0x58,0x50,0x00,0x4d,0x21,0x7a,0x00,0x0e,0x88,0xf1,0xf5,0x00,
+0x9b,0x49,0x2f,0x20,0x00,0x89,0x79,0x30,0x00,0x00,0x46,0x08,0xf3,0x01,0xea,0x00,
+0xd0,0x09,0x6a,0x0d,0x00,0x69,0xc2,0xd0,0x00,0x0a,0x2d,0x00,0x00,0xa2,0x07,0x00,
+0x42,0xed,0xdd,0xde,0x10,0xa0,0x00,0x90,0x3a,0x89,0x00,0x00,0x00,0xa0,0x02,0xaa,
+0x30,0x5b,0x00,0xf1,0x0e,0xa0,0x09,0x24,0x8c,0xd3,0x90,0x08,0x18,0x66,0x00,0x91,
+0x08,0x00,0x9f,0x10,0x26,0x08,0x20,0x67,0x30,0x45,0x00,0x88,0x89,0x99,0x80,0x00,
+0x00,0x00,0x52,0x00,0xf5,0x0d,0xe2,0x40,0x00,0x00,0x01,0xf4,0xc0,0x00,0x7d,0x7d,
+0x8d,0x20,0x03,0xb0,0x2e,0x1c,0x20,0x08,0x40,0x06,0xf8,0x00,0x0b,0x00,0x00,0xe2,
+0x00,0x0c,0x05,0x00,0x01,0x01,0x00,0xf1,0x22,0x0a,0x80,0x55,0x91,0x1a,0x90,0x04,
+0x14,0xf9,0x2e,0x70,0x02,0x00,0x00,0x1a,0xb5,0x00,0x00,0x09,0xe0,0x08,0xc8,0x10,
+0x15,0x00,0x00,0x1c,0xcc,0xb0,0x00,0x00,0x3c,0x10,0x05,0xd1,0x00,0x41,0x01,0x11,
+0x11,0x11,0x10,0x3b,0xbb,0xbb,0xbb,0xb9,0x00,0x00,0x28,0x0a,0x06,0x05,0x00,0x3b,
+0x9c,0xbb,0x90,0x14,0x00,0x51,0x2a,0xaa,0xdb,0xaa,0xa7,0x32,0x00,0x80,0x2b,0xbb,
+0xbb,0xbb,0xb7,0x00,0x00,0x56,0x19,0x00,0x10,0x58,0x05,0x00,0x80,0x5d,0xb3,0x00,
+0x00,0x00,0x56,0x2c,0x80,0x14,0x00,0x13,0x50,0x19,0x00,0x04,0x05,0x00,0x80,0x0b,
+0xbb,0xbb,0xbb,0xb5,0x00,0x00,0x1d,0xf1,0x00,0xf0,0x01,0xc9,0x10,0x00,0x00,0x09,
+0xa9,0xb6,0x00,0x01,0xc7,0x39,0x09,0x90,0x1d,0x40,0x39,0x0e,0x06,0x37,0x39,0x00,
+0x00,0x05,0x00,0x00,0x01,0x00,0xa0,0x06,0x60,0x00,0x00,0x00,0x9b,0xbb,0xbb,0x90,
+0x0c,0x92,0x02,0xf0,0x02,0xea,0xaa,0xaa,0xa0,0x00,0x00,0x00,0x0c,0x29,0x99,0x99,
+0x80,0xc0,0x11,0x11,0x11,0x2a,0x7f,0x01,0x67,0x60,0x00,0x00,0xab,0xb1,0x00,0x01,
+0x00,0x10,0xa5,0xdd,0x08,0xfd,0x03,0x8b,0x30,0x00,0x01,0xa7,0x11,0xc5,0x00,0x5d,
+0x50,0x92,0x09,0xb1,0x20,0x00,0x92,0x00,0x30,0xd7,0x00,0x00,0x05,0x00,0xb4,0x09,
+0x20,0x00,0xbb,0xbe,0xcb,0xb5,0xb0,0x09,0x20,0x37,0x04,0x00,0x40,0xeb,0xbe,0xcb,
+0xc7,0x18,0x00,0x05,0x04,0x00,0xf0,0x14,0x0a,0x20,0x00,0x08,0xba,0xeb,0xaa,0xb0,
+0x84,0x1a,0x31,0x1b,0x04,0x88,0xd9,0x88,0x60,0xab,0xbe,0xbb,0xbb,0x2b,0x00,0xa2,
+0x00,0x92,0xda,0xae,0xba,0xad,0x26,0x00,0xa2,0x00,0x41,0x24,0x00,0xf2,0x1f,0x00,
+0x00,0xca,0xaa,0xad,0x40,0x00,0xb0,0x80,0x06,0x40,0x00,0xb0,0x3b,0x16,0x40,0x00,
+0xb0,0x03,0x16,0x40,0x2b,0xeb,0xbb,0xbd,0xc7,0x00,0xb0,0x00,0x06,0x40,0x03,0x80,
+0x00,0x06,0x40,0x0c,0x20,0x00,0x06,0x40,0x38,0x00,0x03,0xbc,0x20,0xe2,0x03,0xf2,
+0x19,0x70,0xb0,0x00,0x00,0x07,0x1b,0x00,0x00,0x1b,0xbb,0xeb,0xbb,0xe0,0x00,0x29,
+0x00,0x0c,0x00,0x06,0x69,0x10,0xc0,0x00,0xc0,0x39,0x0c,0x00,0x77,0x00,0x30,0xb0,
+0x5b,0x00,0x00,0x39,0x2a,0x00,0x02,0xbc,0x40,0xd9,0x00,0x10,0x50,0x05,0x00,0xf1,
+0x08,0x5b,0x00,0x00,0x06,0x99,0x9c,0xa9,0x91,0x01,0x11,0x4a,0x11,0x10,0x00,0x00,
+0x29,0x00,0x00,0x02,0xaa,0xbd,0xaa,0x80,0xfb,0x09,0x01,0x0f,0x00,0x01,0x05,0x00,
+0x53,0x2b,0xbb,0xce,0xbb,0xb7,0x29,0x02,0xc0,0x92,0x02,0x40,0x04,0x80,0x39,0x09,
+0x40,0x00,0xb1,0x01,0x0c,0x9b,0x0a,0x50,0x94,0x00,0x00,0x08,0x65,0xbe,0x02,0x10,
+0xcc,0x29,0x01,0xd3,0xbb,0x70,0x00,0x05,0xb7,0x00,0x7c,0x50,0x47,0x00,0x00,0x01,
+0x84,0x64,0x00,0x00,0x20,0x06,0x80,0x99,0x9c,0x99,0x40,0x01,0x11,0x11,0x2d,0xaa,
+0x00,0x10,0xb5,0x45,0x02,0xf0,0x25,0x60,0x00,0x00,0x01,0xc6,0x00,0x00,0x00,0x4c,
+0x40,0x00,0x00,0x0b,0xaa,0x21,0x01,0x21,0x25,0x03,0x8a,0xaa,0x94,0x00,0x00,0x51,
+0x00,0x00,0x00,0x78,0xe9,0x88,0x30,0x00,0xb1,0x11,0x17,0x50,0x00,0xb0,0x00,0x3a,
+0x20,0x00,0xb0,0x00,0x64,0x00,0x00,0xba,0xaa,0xaa,0xb4,0x4d,0x00,0x64,0x65,0x1a,
+0xaa,0xaa,0xa8,0x74,0x71,0x01,0x23,0x5a,0xb0,0xa6,0x01,0xf0,0x12,0x01,0x35,0x50,
+0x01,0xda,0xa9,0x86,0x20,0x03,0x80,0x07,0x00,0x00,0x05,0x50,0x0b,0x00,0x00,0x0a,
+0xb9,0x9e,0x99,0x93,0x01,0x21,0x1c,0x11,0x10,0x00,0x91,0x0b,0x08,0x10,0xc2,0x0a,
+0xb3,0xb0,0x2c,0x00,0x0b,0x00,0x76,0x02,0x05,0xb8,0x00,0x02,0x36,0x00,0xff,0x27,
+0x23,0x58,0x00,0x06,0x99,0xc8,0x42,0x00,0x47,0x77,0xb9,0x77,0x70,0x24,0x57,0xa7,
+0x94,0x40,0x09,0xa7,0x73,0xa9,0x60,0x00,0x47,0x84,0xa1,0x20,0x5a,0x99,0xec,0x9a,
+0xb0,0x00,0x4a,0x85,0xa1,0x00,0x3b,0xa0,0x73,0x2c,0x70,0x43,0x00,0x73,0x00,0x71,
+0x04,0xcc,0xcc,0xcc,0x90,0x00,0x01,0x00,0x05,0xb0,0x2c,0xcc,0xcc,0xcc,0xc8,0x06,
+0xbb,0xbb,0xbb,0xb0,0x00,0x3a,0x03,0x01,0x05,0x00,0xa6,0x29,0x99,0xae,0x99,0x96,
+0x01,0x11,0x2b,0x11,0x11,0x14,0x00,0x30,0x00,0x00,0x1b,0x09,0x00,0x10,0xc7,0x0a,
+0x00,0x01,0x8d,0x01,0x41,0x93,0x00,0x00,0x5b,0x37,0x00,0xf2,0x3b,0x75,0x00,0x94,
+0x00,0x09,0x81,0x00,0x2a,0x60,0x25,0x1b,0x03,0xc0,0x70,0x00,0x05,0x8c,0x30,0x00,
+0x00,0x01,0xeb,0x00,0x00,0x03,0x8b,0x25,0xc7,0x30,0x58,0x30,0x00,0x04,0x91,0x00,
+0x00,0x20,0x00,0x00,0x24,0x44,0xc6,0x44,0x40,0x35,0x55,0x55,0x55,0x50,0x04,0xb8,
+0x88,0x8d,0x00,0x03,0xa7,0x77,0x7b,0x00,0x06,0x99,0x99,0x99,0x00,0x00,0x00,0x49,
+0x82,0x00,0x6a,0xaa,0xdb,0xaa,0xa2,0x20,0x01,0x10,0x29,0x29,0x06,0x00,0x54,0x01,
+0xf0,0x13,0x6a,0xaa,0xcc,0xaa,0xa1,0x00,0x55,0x55,0x55,0x00,0x00,0xc3,0x33,0x3c,
+0x00,0x00,0xa8,0x88,0x89,0x00,0x49,0x88,0x88,0x88,0xa0,0x65,0x09,0x99,0x70,0xa0,
+0x00,0x1a,0x00,0xb0,0x03,0x09,0x64,0xb0,0x81,0x4b,0x70,0x00,0xaa,0x54,0x01,0x05,
+0x3a,0x03,0xf8,0x18,0xb4,0xea,0xaa,0xe1,0x05,0xc0,0x91,0x00,0xb0,0x3d,0xb0,0x56,
+0x03,0x80,0x42,0xb0,0x0b,0x0a,0x20,0x00,0xb0,0x06,0xa8,0x00,0x00,0xb0,0x03,0xf3,
+0x00,0x00,0xb0,0x5c,0x3c,0x40,0x00,0xb9,0x80,0x00,0x87,0x0b,0x01,0x20,0x03,0xe0,
+0x05,0x00,0xf0,0x03,0xa4,0xa1,0x00,0x00,0x08,0xa0,0x02,0xc6,0x00,0x3c,0x52,0x00,
+0x03,0x7c,0x00,0x00,0xc0,0x00,0x1a,0x01,0x00,0x03,0x01,0x91,0x03,0x90,0x00,0xb0,
+0x00,0x01,0xc2,0x00,0x0b,0xae,0x0d,0x04,0x72,0x00,0x60,0x93,0x00,0xc0,0x00,0x00,
+0xa2,0x05,0x00,0x10,0xb1,0x05,0x00,0xf1,0x3b,0xd4,0x02,0xd0,0x00,0x00,0xcc,0x15,
+0xf2,0x00,0x04,0x83,0xaa,0x67,0x00,0x09,0x40,0x4c,0x0b,0x10,0x3b,0x00,0xb4,0x03,
+0xb0,0x63,0x02,0x70,0x00,0x51,0x00,0xa1,0x10,0xb0,0x00,0x04,0x80,0xb0,0xb1,0x50,
+0x1e,0x20,0xb4,0xea,0xc0,0xbc,0x48,0xe6,0xb0,0xb0,0x19,0x32,0xb0,0xb0,0xb0,0x09,
+0x20,0xb0,0xb9,0x90,0x09,0x20,0xb0,0xa0,0x00,0x09,0x20,0xb0,0x00,0x64,0x09,0x20,
+0x9b,0xaa,0xb1,0xed,0x01,0xf2,0x19,0x60,0x40,0x02,0x90,0x2a,0x08,0x50,0x47,0x02,
+0xa0,0x0c,0x05,0x60,0x2a,0x00,0x10,0x93,0x02,0xa0,0x00,0x0c,0x00,0x2a,0x18,0x14,
+0xb0,0x04,0xeb,0x31,0xda,0x60,0x53,0x05,0xd3,0x0a,0x50,0x01,0x91,0x00,0x06,0x8c,
+0x00,0xf6,0x1d,0x56,0x32,0x60,0x31,0x00,0xc0,0xb0,0xb1,0xa1,0x07,0x90,0xa1,0x21,
+0xb0,0x4d,0x90,0x65,0x03,0x80,0x33,0x90,0x1b,0x0a,0x20,0x01,0x90,0x08,0x88,0x00,
+0x01,0x90,0x03,0xf3,0x00,0x01,0x90,0x4b,0x4c,0x40,0x01,0x9a,0x70,0x01,0x98,0xf8,
+0x00,0xf3,0x18,0x1a,0x28,0x80,0x00,0x07,0x4b,0x10,0xe9,0xe1,0xe1,0xa0,0x0b,0x0b,
+0xad,0x1a,0x00,0xb0,0xb2,0x91,0xa0,0x0b,0x0b,0x09,0x1a,0x12,0xb0,0xb0,0x92,0xe9,
+0x2b,0x8b,0x09,0x10,0x00,0xb0,0x00,0x91,0x00,0x0b,0x2e,0x00,0xf1,0x0f,0x66,0x51,
+0xb0,0x00,0x00,0xc0,0xc2,0xc1,0x10,0x09,0xa2,0xd9,0xe9,0x92,0x3b,0x96,0x20,0xb0,
+0x00,0x01,0x96,0x99,0xe9,0x97,0x01,0x90,0x11,0xc1,0x11,0x01,0x23,0x01,0x05,0x05,
+0x00,0x03,0xb2,0x02,0x01,0x1a,0x05,0xe0,0x13,0x6a,0xb0,0x00,0xc5,0x97,0xc1,0x00,
+0x08,0xb0,0x00,0xb0,0x00,0x5b,0x05,0x00,0x60,0x20,0xb9,0xbb,0xeb,0xb7,0x00,0x0a,
+0x00,0x03,0x05,0x00,0x80,0x11,0xc1,0x10,0x00,0xb4,0x99,0x99,0x95,0xf6,0x24,0x00,
+0x23,0x02,0x03,0x00,0x00,0x93,0x0c,0x08,0x20,0x01,0xb0,0x67,0x03,0x90,0x0b,0x93,
+0xc0,0x00,0xa4,0x3a,0x99,0xab,0xbb,0x99,0x02,0x90,0x08,0x30,0xb0,0x01,0x90,0x0a,
+0x00,0xb0,0x01,0x90,0x1a,0x01,0x90,0x01,0x90,0xa3,0x03,0x80,0x01,0x96,0x60,0x7b,
+0x30,0x00,0x01,0x00,0xf7,0x1e,0x47,0x0c,0x29,0x00,0x00,0xb1,0x0b,0x03,0x60,0x05,
+0xc3,0x5c,0x9a,0xb2,0x2d,0xb6,0x6a,0x61,0x40,0x22,0xb0,0x05,0x67,0x60,0x00,0xb0,
+0x01,0xc9,0x00,0x00,0xb0,0x06,0xf1,0x12,0x00,0xb2,0xb8,0x77,0x36,0x00,0xb6,0x20,
+0x0a,0xd2,0x00,0x01,0x00,0xf4,0x20,0xc1,0x08,0x30,0x00,0x00,0x57,0x6a,0xea,0xaa,
 0x00,0x2f,0x34,0x5c,0x44,0x41,0x0b,0xb3,0x4a,0x74,0x44,0x10,0x09,0x10,0xdb,0xaa,
 0x70,0x00,0x91,0x00,0x00,0xc2,0x00,0x09,0x10,0x27,0x95,0x00,0x00,0x91,0x00,0x7d,
-0x00,0x00,0x09,0x10,0x00,0x57,0x37,0x00,0xf0,0x1f,0x04,0x00,0x60,0x00,0x06,0x50,
+0x00,0x00,0x09,0x10,0x00,0x57,0x37,0x00,0xf0,0x69,0x04,0x00,0x60,0x00,0x06,0x50,
 0x49,0x00,0x00,0xc1,0xbd,0xcb,0xb0,0x6b,0x19,0x00,0x0b,0x2d,0xa1,0x90,0x00,0xb1,
 0x2a,0x1e,0xbb,0xbe,0x00,0xa1,0x90,0x00,0xb0,0x0a,0x19,0x00,0x0b,0x00,0xa1,0xea,
-0xaa,0xe0,0x0a,0x19,0x00,0x0a,0x00,0x04,0x5d,0x04,0x10,0x65,0x27,0x02,0xf0,0x02,
-0xc1,0xbb,0xcb,0xb3,0x0a,0xb0,0x21,0x01,0x40,0x39,0xb0,0x55,0x04,0x80,0x00,0xb0,
-0x29,0x33,0x05,0x10,0x0b,0x6b,0x01,0xf0,0x18,0x0a,0x0b,0x00,0x00,0xb5,0x99,0x9d,
-0x96,0x00,0xb1,0x22,0x22,0x21,0x00,0x13,0x00,0x02,0x60,0x00,0x93,0x8a,0xbd,0x50,
-0x01,0xc0,0xb0,0x0b,0x00,0x0a,0xa0,0xb0,0x0b,0x00,0x5a,0xa0,0xeb,0xbe,0xb8,0x11,
-0x0a,0x00,0xf3,0x05,0x01,0xa0,0xb0,0x09,0x10,0x01,0xa0,0xb0,0x36,0x42,0x01,0xa0,
-0xb2,0x94,0x98,0x01,0xa3,0xc7,0x26,0x96,0x96,0x00,0x50,0x01,0x40,0x00,0x00,0x75,
-0x69,0x00,0x50,0xc4,0xaa,0xba,0xa6,0x0a,0x5a,0x01,0x12,0x39,0x64,0x01,0x38,0xbb,
-0xeb,0xb3,0x73,0x01,0x00,0x23,0x00,0x42,0xb6,0xaa,0xaa,0xa8,0x37,0x00,0xf0,0x1f,
-0xa0,0x06,0x40,0x00,0x06,0x69,0x9c,0xb9,0x92,0x1e,0x22,0x3f,0xe2,0x20,0xab,0x10,
-0x89,0x96,0x00,0x09,0x10,0xa6,0x4b,0x00,0x09,0x29,0x36,0x45,0x80,0x09,0x77,0xad,
-0xc9,0x93,0x09,0x20,0x06,0x40,0x00,0x09,0x10,0x06,0x40,0x00,0x00,0x13,0x32,0x00,
-0xa0,0x87,0x99,0x99,0x97,0x00,0xc0,0x11,0x11,0xc1,0x09,0x4e,0x00,0xf6,0x03,0x3c,
-0xb1,0xd9,0xd0,0xb0,0x01,0xb1,0x90,0xa0,0xb0,0x00,0xb1,0xda,0xe0,0xb0,0x00,0xb1,
-0x90,0x6c,0x00,0x40,0x6b,0xb0,0x00,0x02,0x0a,0x02,0x20,0x57,0x0c,0x6d,0x01,0xd4,
-0x5e,0xbb,0xb9,0x09,0xc1,0xc0,0xb0,0x00,0x3a,0xb7,0x30,0xea,0xa6,0x25,0x00,0x77,
-0xe9,0x96,0x00,0xb0,0x00,0xc1,0x11,0xa0,0x00,0x06,0x01,0x00,0x30,0x05,0x70,0x0b,
-0x87,0x05,0xc0,0x88,0xd8,0x88,0x00,0xaa,0x29,0x9e,0x99,0x70,0x58,0xa4,0x60,0x11,
-0x01,0x60,0x4c,0x9e,0x9a,0xb0,0x00,0xa0,0x45,0x06,0x30,0x0a,0x06,0xb7,0xc2,0x00,
-0x60,0x4d,0xb6,0x10,0x00,0x0a,0x98,0x6e,0x00,0x01,0xec,0x09,0xf7,0x1d,0x9b,0xeb,
-0x50,0x64,0x09,0x13,0x80,0x09,0x64,0x2f,0x07,0xdb,0x39,0x64,0x9d,0x0b,0x0a,0x29,
-0x64,0x0b,0x58,0x1c,0x09,0x64,0x0b,0x23,0xc9,0x09,0x64,0x0b,0x00,0x93,0x04,0x64,
-0x0b,0x04,0xa0,0x00,0x64,0x0b,0x1b,0x00,0x09,0xb2,0x6e,0x00,0xf0,0x05,0x57,0x0b,
-0x0a,0x00,0x00,0xc1,0x0b,0x0b,0x00,0x07,0x94,0xbe,0xbe,0xb5,0x4c,0x90,0x0b,0x0a,
-0x00,0x12,0x05,0x00,0xf7,0x05,0x01,0x97,0xbb,0xbb,0xb6,0x01,0x90,0x16,0x06,0x00,
-0x01,0x90,0xa3,0x04,0xa0,0x01,0x96,0x60,0x00,0x83,0x41,0x04,0xf0,0x00,0x8c,0x8b,
-0x41,0x72,0x09,0x27,0x65,0x49,0x72,0x1f,0x17,0x95,0x49,0x72,0x8c,0x05,0x00,0x10,
-0x19,0x05,0x00,0x11,0x09,0x05,0x00,0xd7,0x15,0x93,0x27,0x72,0x09,0x05,0x58,0x00,
-0x72,0x09,0x28,0x04,0x46,0xdd,0x00,0xf3,0x1e,0x01,0x92,0x79,0xb3,0x30,0x08,0x88,
-0xc0,0xb0,0xa0,0x1e,0x10,0xb0,0xb1,0x30,0xae,0x59,0xe9,0xda,0x90,0x5a,0x00,0xb1,
-0x83,0x90,0x0a,0x38,0xea,0x7c,0x30,0x0a,0x33,0xb0,0x5a,0x10,0x0a,0x00,0xb4,0xbb,
-0x44,0x0a,0x1a,0x95,0x07,0xc1,0x6a,0x00,0x00,0x05,0x00,0xf0,0x01,0x75,0xea,0xaa,
-0xe0,0x01,0xc0,0xb0,0x00,0xb0,0x0b,0xa0,0xd9,0x99,0xe0,0x57,0xa0,0x31,0x01,0xf2,
-0x09,0xa7,0xaa,0xea,0xa6,0x00,0xa0,0x09,0xe9,0x00,0x00,0xa0,0x67,0xb7,0x50,0x00,
-0xa8,0xa0,0xb0,0xb5,0x00,0xa4,0x00,0xb0,0x03,0x37,0x00,0x30,0x11,0x00,0x20,0x9c,
-0x30,0xf3,0x11,0xb0,0x00,0x00,0xb6,0x99,0xb9,0x96,0x09,0x90,0x11,0x11,0x10,0x3c,
-0x90,0x78,0x88,0x70,0x01,0x90,0x67,0x77,0x60,0x00,0x90,0x99,0x99,0x90,0x00,0x90,
-0xa0,0x00,0xa0,0x05,0x00,0xf2,0x58,0xd9,0x99,0xc0,0x00,0x40,0x04,0x10,0x00,0x02,
-0x90,0x0e,0x76,0x60,0x09,0x20,0xac,0x35,0xb0,0x3f,0x09,0x53,0xbb,0x10,0xbc,0x0b,
-0x7a,0x79,0xa3,0x1a,0x0a,0x22,0x92,0x01,0x0a,0x0a,0x26,0x39,0x10,0x0a,0x0a,0x19,
-0x71,0xa2,0x0a,0x00,0x02,0x7c,0x40,0x0a,0x00,0xa9,0x40,0x00,0x00,0x50,0x05,0x20,
-0x00,0x04,0x88,0x8b,0xc8,0x84,0x09,0x3b,0x12,0x11,0x20,0x2f,0x0a,0x35,0x00,0xa0,
-0xad,0x0a,0x84,0x99,0xd4,0x2b,0x0c,0xe1,0x40,0xa0,0x0b,0x0a,0xa0,0xa0,0xa0,0x0b,
-0x28,0x90,0x33,0xa0,0x0b,0x64,0x90,0x00,0xa0,0x0b,0x81,0x90,0x2a,0x60,0x21,0x04,
-0xf2,0x1d,0xb0,0x05,0x70,0x00,0x05,0x77,0xb9,0x9c,0xa0,0x1e,0x20,0xa0,0x0b,0x00,
-0xad,0x25,0x96,0x7b,0x51,0x19,0x24,0x44,0x44,0x41,0x09,0x13,0xca,0xab,0x60,0x09,
-0x14,0x60,0x03,0x70,0x09,0x14,0xc8,0x8a,0x70,0x09,0x14,0x71,0x15,0x70,0xdb,0x01,
-0xf2,0x1d,0xaa,0xb9,0x48,0x91,0x0a,0x18,0x26,0x0a,0x91,0x3f,0x2d,0x8c,0x5a,0x91,
-0xac,0x14,0x60,0x4a,0x91,0x0a,0x25,0xd5,0x2a,0x91,0x0a,0x13,0xc3,0x1a,0x91,0x0a,
-0x00,0xb4,0x40,0x91,0x0a,0x5c,0xd9,0x30,0x91,0x0a,0x32,0x00,0x0a,0xc0,0xff,0x00,
-0xf2,0x0f,0xb8,0x8b,0xc8,0x80,0x06,0x51,0x19,0x31,0x10,0x2e,0x16,0xb9,0x9a,0x60,
-0x9b,0x16,0xa8,0x8a,0x60,0x09,0x16,0x51,0x14,0x60,0x09,0x16,0xa7,0x79,0x60,0x09,
-0x0f,0x00,0x83,0x40,0x03,0x60,0x09,0x5c,0xba,0xab,0xc3,0x08,0x02,0xf3,0x44,0x02,
-0xc1,0x00,0x00,0xc5,0xb8,0x88,0xb5,0x06,0xb4,0x84,0x44,0x95,0x2c,0xa5,0x85,0x55,
-0x51,0x12,0xa5,0xda,0xcc,0xa7,0x00,0xa6,0xc1,0x77,0x17,0x00,0xa8,0xaa,0xcc,0xa7,
-0x00,0xa9,0x91,0x77,0x17,0x00,0xa7,0x91,0x77,0x75,0x00,0x40,0x02,0x40,0x00,0x00,
-0xb8,0x9a,0xe9,0x94,0x06,0x50,0x66,0x66,0x40,0x2f,0x11,0xa2,0x23,0xa0,0xac,0x11,
-0x98,0x88,0x60,0x09,0x1b,0x88,0x88,0x96,0x09,0x19,0x99,0x99,0x86,0x09,0x10,0x00,
-0xa0,0x00,0x05,0x00,0xf1,0x09,0x5a,0x70,0x00,0x01,0x93,0x72,0x95,0x40,0x07,0x3a,
-0xdb,0xdd,0xa0,0x1e,0x0b,0x00,0x00,0xb0,0xad,0x04,0xaa,0xaa,0x50,0x3a,0xaf,0x0a,
-0xf1,0x04,0x4b,0xcf,0xbb,0xb2,0x0a,0x00,0x95,0x09,0x00,0x0a,0x06,0xb4,0x5b,0x80,
-0x0a,0x08,0x86,0x43,0xa0,0x90,0x00,0xf0,0x20,0x02,0x84,0x00,0xb0,0x42,0x08,0x28,
-0x39,0xeb,0x90,0x1e,0x46,0x38,0xdd,0xa4,0x8b,0x3c,0x03,0xd3,0x10,0x1a,0x0a,0x2e,
-0xd9,0x90,0x0a,0x0a,0x39,0x41,0xa0,0x0a,0x0a,0x47,0x96,0xc0,0x0a,0x0d,0x76,0xb9,
-0xd0,0x0a,0x01,0x06,0x30,0x90,0x00,0x20,0x9d,0x0b,0xf8,0x1d,0xc0,0xd9,0xa2,0x00,
-0x06,0x7a,0x41,0xb1,0x00,0x1e,0x7e,0x8b,0xa8,0xb0,0xad,0x19,0x9d,0x98,0xa0,0x19,
-0x14,0xba,0x02,0x50,0x09,0x36,0x4a,0xbd,0x10,0x09,0x3a,0x67,0xb7,0x30,0x09,0x14,
-0xa3,0xa1,0xc2,0x09,0x46,0x2a,0x60,0x11,0xa2,0x0d,0x10,0x2b,0xad,0x0a,0xf2,0x18,
-0xbc,0xbb,0xb6,0x00,0x0b,0x30,0x52,0x00,0x00,0x95,0x00,0x2c,0x30,0x05,0xdc,0xdb,
-0xe9,0xc1,0x00,0x07,0x50,0xb0,0x10,0x00,0x0b,0x20,0xb0,0x03,0x00,0x5a,0x00,0xb0,
-0x0b,0x0b,0xa0,0x00,0xbb,0xc6,0x01,0x93,0x02,0xf0,0x0f,0x64,0x02,0x10,0x03,0xa0,
-0x64,0x0c,0x10,0x00,0x52,0x64,0x44,0x00,0x5b,0xbb,0xdc,0xbb,0xb0,0x00,0x0a,0x15,
-0x50,0x00,0x00,0x0c,0x05,0x50,0x00,0x00,0x2a,0x05,0x00,0x82,0xc3,0x05,0x60,0x41,
-0x4c,0x40,0x02,0xcb,0xc6,0x02,0xf0,0x02,0x09,0x99,0xad,0x99,0x94,0x01,0x11,0x49,
-0x11,0x10,0x00,0xaa,0xbd,0xaa,0x40,0x00,0xb0,0xca,0x0a,0xf7,0x09,0xb1,0x11,0x16,
-0x60,0x00,0x9c,0xba,0xd9,0x40,0x00,0x0a,0x21,0x90,0x01,0x00,0x5a,0x01,0x90,0x0b,
-0x1c,0x90,0x00,0xcb,0xc6,0x9d,0x03,0x20,0x0b,0x30,0x0a,0x01,0x10,0xd1,0x0b,0x00,
-0x10,0x9a,0x05,0x00,0xf1,0x10,0xda,0x30,0x00,0x00,0x04,0xa2,0xb0,0x00,0x00,0x0c,
-0x20,0x95,0x00,0x00,0x88,0x00,0x1d,0x20,0x09,0xa0,0x00,0x03,0xd3,0x26,0x00,0x00,
-0x00,0x23,0x00,0x00,0x12,0x6f,0x0e,0xf2,0x0c,0x10,0x00,0x00,0x1b,0x33,0xc1,0x00,
-0x05,0xc3,0x00,0x2c,0x50,0x69,0xba,0xaa,0xab,0xa7,0x00,0x00,0x55,0x00,0x00,0x00,
-0xaa,0xcc,0xaa,0x00,0x0a,0x00,0x20,0x00,0x55,0xd4,0x0b,0x23,0xcc,0xaa,0x2a,0x0d,
-0x30,0x1c,0x00,0xc1,0x68,0x11,0xf1,0x00,0x3a,0x00,0x05,0xb0,0x10,0x08,0x80,0x2c,
-0x00,0xc2,0x00,0xa5,0x01,0x06,0x90,0x19,0x00,0x10,0x93,0xda,0x14,0x61,0x2d,0x10,
-0x07,0xec,0xbb,0xaa,0x95,0x01,0x12,0x70,0xe3,0x06,0x90,0xb1,0x00,0x75,0x00,0x00,
-0x26,0x02,0xb0,0x00,0x10,0x0c,0x02,0x70,0x09,0x00,0xdf,0x08,0x10,0x10,0x24,0x0c,
-0x02,0x54,0x00,0x57,0x6a,0xaa,0xaa,0xaa,0xa1,0xc8,0x00,0xf0,0x02,0x46,0x00,0x1c,
-0x00,0x00,0x0a,0x00,0x84,0x00,0x05,0xbb,0xce,0xbb,0xa0,0x00,0x00,0x2a,0x72,0x01,
-0xf0,0x05,0xce,0xbb,0xb6,0x00,0x00,0x9d,0x40,0x00,0x00,0x06,0xb1,0xc2,0x00,0x03,
-0xba,0x00,0x2c,0x92,0x19,0x30,0x9d,0x00,0xd0,0xb0,0x00,0x66,0x00,0x38,0xe8,0x88,
-0xbb,0x80,0x00,0xca,0xaa,0xc5,0x1e,0x05,0x26,0x55,0x00,0x0a,0x00,0xc0,0x7a,0xab,
-0xab,0xba,0xa2,0x03,0xa8,0x02,0xa7,0x10,0x58,0x20,0x24,0x12,0x60,0xba,0x99,0x9c,
-0x40,0x00,0xb9,0x05,0x00,0xd0,0xb1,0x11,0x18,0x40,0x00,0xb8,0x77,0x7b,0x40,0x00,
-0xb8,0x88,0x8c,0x63,0x01,0xe0,0x07,0x40,0x2a,0xac,0xaa,0xcb,0xa7,0x01,0x9a,0x00,
-0x4b,0x60,0x1a,0x30,0x32,0x35,0xe6,0x0a,0x07,0x30,0x00,0x0c,0xae,0xbd,0xcc,0x60,
-0x0b,0x0a,0x07,0x34,0x60,0x0a,0x00,0xf1,0x3a,0x0b,0x0a,0x18,0x45,0x70,0x8a,0xab,
-0xaa,0xba,0xa3,0x01,0xa7,0x00,0xb8,0x00,0x5a,0x30,0x00,0x05,0xa0,0x00,0x40,0x00,
-0x05,0x00,0x01,0x6a,0x11,0x6a,0x10,0x08,0x8b,0xaa,0xc8,0x83,0x05,0x9c,0xbb,0xc9,
-0x60,0x02,0x27,0x75,0x93,0xa1,0x17,0x7a,0xa9,0xb8,0xc4,0x06,0x9c,0xbb,0xca,0x90,
-0x00,0x4e,0x53,0xd7,0x00,0x06,0xa6,0x53,0x77,0xa2,0x27,0x06,0x53,0x70,0x36,0x00,
-0x02,0x90,0xd6,0x00,0xf0,0x09,0xb5,0xb0,0x03,0x80,0x04,0x6b,0x00,0x7a,0x00,0x46,
-0xb0,0x0c,0x7a,0x04,0x6b,0x1b,0x40,0x6a,0x46,0xb9,0x30,0x00,0x77,0x6b,0x08,0x01,
-0xe2,0xb0,0x00,0x01,0xbc,0x40,0x0a,0xbd,0x2c,0xad,0x40,0x0a,0x08,0x2b,0x07,0x05,
-0x00,0xb2,0x8e,0xad,0xbe,0xad,0xb3,0x0b,0x19,0x4b,0x18,0x50,0x0b,0x14,0x00,0xc2,
-0x4a,0x07,0x40,0x56,0x08,0x95,0x07,0x40,0x90,0x7c,0xa0,0x6c,0x3c,0x0c,0xf0,0x00,
-0xea,0xbb,0xaa,0xab,0x9a,0x0c,0x00,0x00,0x28,0x01,0xea,0xaa,0xa3,0x00,0x47,0x71,
-0x01,0x30,0xba,0xaa,0xb8,0xfe,0x06,0x50,0x80,0x9a,0xaa,0xaa,0x66,0x62,0x02,0x42,
-0x30,0x00,0x00,0x9a,0x3a,0x03,0x10,0x16,0x2a,0x01,0x20,0x09,0x41,0x63,0x08,0x91,
-0x5b,0x99,0xe9,0xb6,0x00,0x0b,0x00,0xb0,0x46,0x05,0x00,0xb0,0x01,0xab,0xaa,0xea,
-0xc6,0x08,0x44,0x00,0xb0,0x12,0x2b,0x23,0x00,0x11,0x22,0xda,0x09,0x00,0xce,0x10,
-0xf4,0x1b,0x1a,0x00,0xa2,0x39,0x00,0x08,0x52,0xea,0xac,0xa5,0x00,0x4c,0x90,0x19,
-0x00,0x00,0x68,0xda,0xbd,0xa3,0x00,0x32,0x90,0x19,0x00,0x02,0xa1,0xda,0xbd,0xa3,
-0x09,0x31,0x90,0x19,0x00,0x1c,0x01,0xda,0xbe,0xa7,0x01,0x01,0x5e,0x0b,0xf2,0x1e,
-0x24,0x00,0x00,0x37,0x91,0x0a,0x0a,0xaa,0xbd,0xb6,0x03,0x2a,0x44,0x48,0x10,0x00,
-0x0a,0x44,0x39,0x82,0x01,0x1a,0xa9,0x8a,0xb0,0x07,0x49,0x90,0x8c,0x60,0x0b,0x27,
-0xb9,0x8e,0x13,0x38,0x64,0x40,0xb7,0x68,0x21,0x90,0x07,0x30,0xc5,0x33,0x00,0x88,
-0xac,0xbb,0xe0,0x00,0x00,0xa1,0x00,0xb0,0x05,0x00,0x00,0xfa,0x06,0x00,0x77,0x0a,
-0x00,0xe6,0x13,0xc1,0xb0,0x15,0x0b,0x30,0x00,0xb0,0x28,0x77,0x00,0x00,0x8c,0xc4,
-0x31,0x00,0xf1,0x16,0x31,0x0a,0x20,0x05,0x07,0x30,0xa2,0x00,0xb0,0x73,0x0a,0x20,
-0x0b,0x07,0xcb,0xec,0xbb,0xb0,0x10,0x0a,0x20,0x01,0x0c,0x00,0xa2,0x00,0xa2,0xc0,
-0x0a,0x20,0x0a,0x2e,0xbb,0xec,0xbb,0xe2,0x00,0xb2,0x0d,0x00,0xba,0x11,0x12,0x04,
-0x5a,0x02,0x10,0x19,0x60,0x0d,0x00,0x5a,0x02,0x00,0x0a,0x00,0xd0,0x03,0x60,0x19,
-0x00,0x80,0x04,0x70,0x19,0x00,0xb0,0x04,0xdb,0xce,0xf7,0x0b,0x03,0xcc,0x0a,0xf1,
-0x11,0x0a,0xaa,0xad,0xa0,0x00,0x00,0x4a,0x00,0xa4,0x00,0xc0,0x5a,0xb2,0xb1,0xb7,
-0x3b,0xb0,0x29,0xda,0x0b,0xb8,0x82,0xa4,0x8b,0xb1,0x29,0x70,0x1b,0xea,0xaa,0xaa,
-0xae,0x08,0x0c,0x10,0x02,0x42,0x06,0x30,0x3b,0x00,0xa3,0x04,0x03,0xe0,0x1c,0x00,
-0x09,0x80,0x00,0x05,0xb0,0x4b,0xbb,0xbb,0xbb,0x74,0x00,0x04,0xa0,0x07,0x00,0xa8,
-0x18,0x20,0x00,0x0c,0x78,0x0f,0x73,0xb4,0x00,0x0c,0x00,0x1c,0x50,0x0b,0xb7,0x03,
-0xf1,0x1f,0x09,0x10,0xbb,0xbb,0xb1,0x09,0x11,0x06,0x40,0xa1,0x5d,0xca,0x07,0x30,
-0xa1,0x4a,0x10,0x08,0x20,0xb0,0x09,0x10,0x0b,0x00,0xb0,0x09,0x26,0x1b,0x00,0xc0,
-0x0c,0xc6,0x57,0x00,0xc0,0x05,0x02,0xc1,0x00,0xc0,0x00,0x0b,0x20,0x9c,0x50,0x00,
-0x6d,0x0c,0x21,0xec,0xba,0xe1,0x0b,0xf0,0x0c,0x47,0x1a,0x01,0xfa,0xa5,0x47,0x1a,
-0x07,0x50,0x55,0x47,0x1a,0x1b,0x40,0xa2,0x47,0x1a,0x01,0x6b,0xb0,0x47,0x1a,0x00,
-0x0b,0x40,0x23,0x1a,0xbd,0x0b,0x21,0x1a,0x0a,0xbc,0x0d,0x05,0x01,0x00,0xf1,0x19,
-0x06,0xa0,0x00,0x0b,0x02,0xb7,0x70,0xb0,0xb2,0xc1,0x08,0x5b,0x0b,0x6a,0xaa,0xa2,
-0xb0,0xb0,0xb0,0x0b,0x0b,0x0b,0x0b,0x00,0xa0,0xb0,0xb0,0xb1,0x93,0x05,0x0b,0x0b,
-0x00,0x28,0x00,0xb0,0x7a,0xab,0x34,0x9c,0xb3,0x03,0x21,0x01,0x20,0xfc,0x00,0xf0,
-0x0a,0x99,0x99,0x90,0x2a,0xb8,0x12,0xc1,0xb0,0x00,0x37,0x01,0xa0,0xb0,0x00,0xb5,
-0x12,0x80,0xb0,0x08,0xf9,0x05,0x50,0xb0,0x39,0xcb,0x8b,0x0b,0x20,0xb0,0x1b,0x8f,
-0x01,0x82,0xa4,0x00,0xb0,0x00,0xb5,0x60,0x6b,0x50,0x4c,0x10,0x82,0xb7,0xbb,0x50,
-0x09,0x09,0x17,0x93,0x5a,0x05,0x00,0x95,0x1b,0x5a,0xb7,0x8a,0x09,0x2c,0x7b,0xc8,
-0x9a,0x14,0x00,0xd2,0x55,0x09,0x0a,0x19,0x83,0x50,0x09,0x35,0x99,0x5a,0x32,0x97,
-0x00,0x75,0x12,0x00,0x81,0x02,0xf0,0x15,0x8a,0x81,0x10,0xa1,0x02,0x29,0x00,0x91,
-0xa1,0x15,0x7c,0x54,0x91,0xa1,0x14,0x9d,0x53,0x91,0xa1,0x00,0xcd,0x80,0x91,0xa1,
-0x07,0x79,0x65,0x91,0xa1,0x3b,0x29,0x00,0x20,0xa1,0x11,0x19,0x02,0x02,0x81,0x19,
-0x00,0x1b,0xc0,0x0e,0xaa,0xe0,0x10,0xbb,0x00,0xf0,0x02,0x0c,0x55,0xc0,0xb0,0xb0,
-0x59,0x55,0x0b,0x0b,0x38,0xd9,0x81,0xb0,0xb0,0x1b,0x1a,0x1b,0x8a,0x1a,0xb0,0x30,
-0xb0,0x75,0x0b,0x00,0x0b,0x59,0x1a,0x90,0x1a,0xc0,0x5f,0x00,0xf2,0x46,0x1a,0xeb,
-0xa9,0x20,0xb0,0x1b,0x09,0x08,0x1b,0x0a,0x87,0xc6,0x81,0xb0,0x65,0x72,0x68,0x1b,
-0x01,0x1b,0x11,0x81,0xb0,0x99,0xe9,0x78,0x1b,0x00,0x0b,0x00,0x61,0xb0,0x26,0xec,
-0xa0,0x0b,0x29,0x62,0x00,0x0b,0xb0,0x08,0x29,0x00,0x22,0xa0,0x1d,0xbe,0xa6,0x45,
-0xb0,0x56,0x4b,0x22,0x55,0xb0,0x37,0x8c,0x77,0x55,0xb0,0x08,0x8d,0x85,0x45,0xb0,
-0x0b,0x3b,0x2a,0x45,0xb0,0x09,0x19,0x0a,0x00,0xb0,0x09,0x19,0x87,0x00,0xb0,0x00,
-0x19,0x00,0x0b,0x33,0x07,0xf4,0x17,0x0d,0xaa,0xac,0x11,0xb0,0xa0,0x00,0xa4,0x4b,
-0x0d,0xaa,0xa8,0x44,0xb0,0xa0,0x90,0x04,0x4b,0x0a,0xde,0xac,0x44,0xb0,0xa7,0xa0,
-0x94,0x4b,0x28,0x7a,0x0a,0x11,0xb6,0x45,0xa5,0x50,0x0b,0x60,0x0a,0x2e,0x00,0x01,
-0xa8,0x09,0xf1,0x1c,0x20,0x83,0x10,0xa1,0x00,0x8d,0x70,0x72,0xa1,0x08,0xa5,0xa5,
-0x72,0xa1,0x04,0x0b,0x01,0x72,0xa1,0x19,0x9e,0x98,0x72,0xa1,0x02,0x4b,0x70,0x72,
-0xa1,0x09,0x2b,0x47,0x10,0xa1,0x29,0x0b,0x08,0x00,0xa1,0x00,0x88,0x00,0x08,0xe5,
-0x13,0x00,0x1d,0x0e,0x10,0x03,0x95,0x0f,0xf0,0x04,0x1b,0x00,0x2a,0xad,0xaa,0xcc,
-0xa7,0x01,0x33,0x30,0x10,0x40,0x09,0x76,0xd0,0xb0,0xb0,0x09,0x99,0x05,0x00,0x21,
-0x10,0xa0,0x0a,0x00,0x10,0xa0,0x0a,0x00,0x62,0x00,0xb0,0x09,0x18,0xb0,0x1a,0x6d,
-0x00,0xf4,0x19,0x4a,0xaa,0xaa,0x10,0xb0,0x56,0x66,0x34,0x4b,0x0a,0x22,0x58,0x44,
-0xb0,0xa9,0x9a,0x74,0x4b,0x06,0x66,0x65,0x44,0xb1,0xa2,0xb2,0xb4,0x4b,0x1c,0x8d,
-0x8d,0x22,0xb1,0xd9,0xd9,0xd0,0x0b,0x18,0x00,0x0a,0x1b,0x9b,0x00,0x41,0xb0,0x00,
-0x5a,0xda,0x98,0x0c,0xf4,0x12,0xbb,0xeb,0xe1,0x01,0x90,0x02,0x90,0xb0,0x01,0x90,
-0x04,0x70,0xb0,0x01,0xb7,0x18,0x30,0xb0,0x7c,0x94,0x1c,0x00,0xb0,0x10,0x00,0xb4,
-0x00,0xb0,0x00,0x0b,0x50,0x6b,0x60,0x30,0x00,0xf3,0x16,0x22,0x24,0xbe,0xba,0x5a,
-0x6d,0x00,0xb0,0xb5,0x50,0xb0,0x29,0x0b,0x55,0x0b,0x03,0x70,0xb5,0x50,0xb0,0x55,
-0x0b,0x55,0x0b,0x0a,0x21,0xa5,0x50,0xb1,0xc0,0x48,0x5d,0xbe,0x66,0x8c,0x25,0x50,
-0x3b,0x03,0x15,0x80,0x48,0x03,0xf0,0x0b,0x1c,0xfc,0xe2,0x4b,0xea,0xa0,0xb0,0x82,
-0x04,0x72,0x10,0xb0,0x91,0x08,0x23,0x71,0x90,0xa0,0x0c,0x58,0xc5,0x60,0xb0,0x3b,
-0x62,0x6b,0x1f,0x00,0x37,0x46,0x6b,0x80,0xc2,0x09,0x10,0x76,0x88,0x02,0xd0,0xdb,
-0xbb,0xbb,0xc0,0x1c,0x31,0x11,0x00,0xb0,0x44,0xe9,0x9e,0x00,0xce,0x09,0x50,0x01,
-0xa0,0x00,0xea,0xac,0x15,0x0c,0x50,0x00,0x79,0x20,0x00,0xb0,0xcd,0x10,0x63,0xab,
-0xbb,0xbb,0xd3,0x00,0x10,0xfb,0x06,0xf0,0x0c,0x07,0xdb,0xbb,0xbb,0xe7,0xd1,0x03,
-0x42,0x0b,0x3a,0x4a,0xb0,0xa0,0xb0,0xa0,0x8c,0x2a,0x0b,0x0a,0x67,0x07,0xa0,0xb0,
-0xa9,0x99,0x9d,0x0b,0x6c,0x06,0x00,0x0b,0x0b,0x17,0xb5,0x79,0x0d,0x10,0x3a,0x70,
+0xaa,0xe0,0x0a,0x19,0x00,0x0a,0x00,0x04,0x00,0x50,0x00,0x00,0x65,0x00,0xc0,0x00,
+0x00,0xc1,0xbb,0xcb,0xb3,0x0a,0xb0,0x21,0x01,0x40,0x39,0xb0,0x55,0x04,0x80,0x00,
+0xb0,0x29,0x06,0x40,0x00,0xb0,0x0b,0x09,0x10,0x00,0xb0,0x0a,0x0b,0x00,0x00,0xb5,
+0x99,0x9d,0x96,0x00,0xb1,0x22,0x22,0x21,0x00,0x13,0x00,0x02,0x60,0x00,0x93,0x8a,
+0xbd,0x50,0x01,0xc0,0xb0,0x0b,0x00,0x0a,0xa0,0xb0,0x0b,0x00,0x5a,0xa0,0xeb,0xbe,
+0xb8,0x11,0x0a,0x00,0xf3,0x05,0x01,0xa0,0xb0,0x09,0x10,0x01,0xa0,0xb0,0x36,0x42,
+0x01,0xa0,0xb2,0x94,0x98,0x01,0xa3,0xc7,0x26,0x96,0x96,0x00,0x50,0x01,0x40,0x00,
+0x00,0x75,0x69,0x00,0xf2,0x05,0xc4,0xaa,0xba,0xa6,0x0a,0xb0,0x11,0xc1,0x10,0x39,
+0xb0,0x00,0xb0,0x00,0x00,0xb0,0xbb,0xeb,0xb3,0x00,0x0a,0x00,0x01,0x05,0x00,0x00,
+0x23,0x00,0x42,0xb6,0xaa,0xaa,0xa8,0x37,0x00,0xf0,0x1f,0xa0,0x06,0x40,0x00,0x06,
+0x69,0x9c,0xb9,0x92,0x1e,0x22,0x3f,0xe2,0x20,0xab,0x10,0x89,0x96,0x00,0x09,0x10,
+0xa6,0x4b,0x00,0x09,0x29,0x36,0x45,0x80,0x09,0x77,0xad,0xc9,0x93,0x09,0x20,0x06,
+0x40,0x00,0x09,0x10,0x06,0x40,0x00,0x00,0x13,0x32,0x00,0xa0,0x87,0x99,0x99,0x97,
+0x00,0xc0,0x11,0x11,0xc1,0x09,0x4e,0x00,0xf6,0x03,0x3c,0xb1,0xd9,0xd0,0xb0,0x01,
+0xb1,0x90,0xa0,0xb0,0x00,0xb1,0xda,0xe0,0xb0,0x00,0xb1,0x90,0x6c,0x00,0xa0,0x6b,
+0xb0,0x00,0x02,0x01,0x00,0x00,0x00,0x57,0x0c,0x6d,0x01,0xd4,0x5e,0xbb,0xb9,0x09,
+0xc1,0xc0,0xb0,0x00,0x3a,0xb7,0x30,0xea,0xa6,0x25,0x00,0x77,0xe9,0x96,0x00,0xb0,
+0x00,0xc1,0x11,0xa0,0x00,0x06,0x01,0x00,0xf0,0x04,0x05,0x70,0x0b,0x00,0x00,0x00,
+0xb5,0x88,0xd8,0x88,0x00,0xaa,0x29,0x9e,0x99,0x70,0x58,0xa4,0x60,0x11,0x01,0xd0,
+0x4c,0x9e,0x9a,0xb0,0x00,0xa0,0x70,0xb0,0x00,0x00,0x0a,0x06,0xb7,0xc2,0x00,0x60,
+0x4d,0xb6,0x10,0x00,0x0a,0x98,0x6e,0x00,0xf7,0x22,0x10,0x00,0x00,0x00,0x03,0x9b,
+0xeb,0x50,0x64,0x09,0x13,0x80,0x09,0x64,0x2f,0x07,0xdb,0x39,0x64,0x9d,0x0b,0x0a,
+0x29,0x64,0x0b,0x58,0x1c,0x09,0x64,0x0b,0x23,0xc9,0x09,0x64,0x0b,0x00,0x93,0x04,
+0x64,0x0b,0x04,0xa0,0x00,0x64,0x0b,0x1b,0x00,0x09,0xb2,0x6e,0x00,0xf0,0x05,0x57,
+0x0b,0x0a,0x00,0x00,0xc1,0x0b,0x0b,0x00,0x07,0x94,0xbe,0xbe,0xb5,0x4c,0x90,0x0b,
+0x0a,0x00,0x12,0x05,0x00,0xf6,0x05,0x01,0x97,0xbb,0xbb,0xb6,0x01,0x90,0x16,0x06,
+0x00,0x01,0x90,0xa3,0x04,0xa0,0x01,0x96,0x60,0x00,0x83,0x36,0x00,0xf0,0x01,0x03,
+0x8c,0x8b,0x41,0x72,0x09,0x27,0x65,0x49,0x72,0x1f,0x17,0x95,0x49,0x72,0x8c,0x05,
+0x00,0x10,0x19,0x05,0x00,0x11,0x09,0x05,0x00,0xd7,0x15,0x93,0x27,0x72,0x09,0x05,
+0x58,0x00,0x72,0x09,0x28,0x04,0x46,0xdd,0x00,0xf3,0x1e,0x01,0x92,0x79,0xb3,0x30,
+0x08,0x88,0xc0,0xb0,0xa0,0x1e,0x10,0xb0,0xb1,0x30,0xae,0x59,0xe9,0xda,0x90,0x5a,
+0x00,0xb1,0x83,0x90,0x0a,0x38,0xea,0x7c,0x30,0x0a,0x33,0xb0,0x5a,0x10,0x0a,0x00,
+0xb4,0xbb,0x44,0x0a,0x1a,0x95,0x07,0xc1,0x6a,0x00,0x00,0x05,0x00,0xf0,0x01,0x75,
+0xea,0xaa,0xe0,0x01,0xc0,0xb0,0x00,0xb0,0x0b,0xa0,0xd9,0x99,0xe0,0x57,0xa0,0x31,
+0x01,0xf2,0x09,0xa7,0xaa,0xea,0xa6,0x00,0xa0,0x09,0xe9,0x00,0x00,0xa0,0x67,0xb7,
+0x50,0x00,0xa8,0xa0,0xb0,0xb5,0x00,0xa4,0x00,0xb0,0x03,0x37,0x00,0xf3,0x18,0x11,
+0x00,0x20,0x00,0x00,0x83,0x01,0xb0,0x00,0x00,0xb6,0x99,0xb9,0x96,0x09,0x90,0x11,
+0x11,0x10,0x3c,0x90,0x78,0x88,0x70,0x01,0x90,0x67,0x77,0x60,0x00,0x90,0x99,0x99,
+0x90,0x00,0x90,0xa0,0x00,0xa0,0x05,0x00,0xf0,0x5a,0xd9,0x99,0xc0,0x00,0x40,0x04,
+0x10,0x00,0x02,0x90,0x0e,0x76,0x60,0x09,0x20,0xac,0x35,0xb0,0x3f,0x09,0x53,0xbb,
+0x10,0xbc,0x0b,0x7a,0x79,0xa3,0x1a,0x0a,0x22,0x92,0x01,0x0a,0x0a,0x26,0x39,0x10,
+0x0a,0x0a,0x19,0x71,0xa2,0x0a,0x00,0x02,0x7c,0x40,0x0a,0x00,0xa9,0x40,0x00,0x00,
+0x50,0x05,0x20,0x00,0x04,0x88,0x8b,0xc8,0x84,0x09,0x3b,0x12,0x11,0x20,0x2f,0x0a,
+0x35,0x00,0xa0,0xad,0x0a,0x84,0x99,0xd4,0x2b,0x0c,0xe1,0x40,0xa0,0x0b,0x0a,0xa0,
+0xa0,0xa0,0x0b,0x28,0x90,0x33,0xa0,0x0b,0x64,0x90,0x00,0xa0,0x0b,0x81,0x90,0x2a,
+0x60,0x00,0x00,0x17,0x02,0xf2,0x1d,0xb0,0x05,0x70,0x00,0x05,0x77,0xb9,0x9c,0xa0,
+0x1e,0x20,0xa0,0x0b,0x00,0xad,0x25,0x96,0x7b,0x51,0x19,0x24,0x44,0x44,0x41,0x09,
+0x13,0xca,0xab,0x60,0x09,0x14,0x60,0x03,0x70,0x09,0x14,0xc8,0x8a,0x70,0x09,0x14,
+0x71,0x15,0x70,0xdb,0x01,0xf2,0x1d,0xaa,0xb9,0x48,0x91,0x0a,0x18,0x26,0x0a,0x91,
+0x3f,0x2d,0x8c,0x5a,0x91,0xac,0x14,0x60,0x4a,0x91,0x0a,0x25,0xd5,0x2a,0x91,0x0a,
+0x13,0xc3,0x1a,0x91,0x0a,0x00,0xb4,0x40,0x91,0x0a,0x5c,0xd9,0x30,0x91,0x0a,0x32,
+0x00,0x0a,0xc0,0xff,0x00,0xf2,0x0f,0xb8,0x8b,0xc8,0x80,0x06,0x51,0x19,0x31,0x10,
+0x2e,0x16,0xb9,0x9a,0x60,0x9b,0x16,0xa8,0x8a,0x60,0x09,0x16,0x51,0x14,0x60,0x09,
+0x16,0xa7,0x79,0x60,0x09,0x0f,0x00,0x83,0x40,0x03,0x60,0x09,0x5c,0xba,0xab,0xc3,
+0x08,0x02,0xf3,0x44,0x02,0xc1,0x00,0x00,0xc5,0xb8,0x88,0xb5,0x06,0xb4,0x84,0x44,
+0x95,0x2c,0xa5,0x85,0x55,0x51,0x12,0xa5,0xda,0xcc,0xa7,0x00,0xa6,0xc1,0x77,0x17,
+0x00,0xa8,0xaa,0xcc,0xa7,0x00,0xa9,0x91,0x77,0x17,0x00,0xa7,0x91,0x77,0x75,0x00,
+0x40,0x02,0x40,0x00,0x00,0xb8,0x9a,0xe9,0x94,0x06,0x50,0x66,0x66,0x40,0x2f,0x11,
+0xa2,0x23,0xa0,0xac,0x11,0x98,0x88,0x60,0x09,0x1b,0x88,0x88,0x96,0x09,0x19,0x99,
+0x99,0x86,0x09,0x10,0x00,0xa0,0x00,0x05,0x00,0xf0,0x09,0x5a,0x70,0x00,0x01,0x93,
+0x72,0x95,0x40,0x07,0x3a,0xdb,0xdd,0xa0,0x1e,0x0b,0x00,0x00,0xb0,0xad,0x04,0xaa,
+0xaa,0x50,0x3a,0x77,0x00,0xf1,0x05,0x0a,0x4b,0xcf,0xbb,0xb2,0x0a,0x00,0x95,0x09,
+0x00,0x0a,0x06,0xb4,0x5b,0x80,0x0a,0x08,0x86,0x43,0xa0,0x90,0x00,0xf3,0x50,0x02,
+0x84,0x00,0xb0,0x42,0x08,0x28,0x39,0xeb,0x90,0x1e,0x46,0x38,0xdd,0xa4,0x8b,0x3c,
+0x03,0xd3,0x10,0x1a,0x0a,0x2e,0xd9,0x90,0x0a,0x0a,0x39,0x41,0xa0,0x0a,0x0a,0x47,
+0x96,0xc0,0x0a,0x0d,0x76,0xb9,0xd0,0x0a,0x01,0x06,0x30,0x90,0x00,0x20,0x21,0x00,
+0x00,0x00,0xc0,0xd9,0xa2,0x00,0x06,0x7a,0x41,0xb1,0x00,0x1e,0x7e,0x8b,0xa8,0xb0,
+0xad,0x19,0x9d,0x98,0xa0,0x19,0x14,0xba,0x02,0x50,0x09,0x36,0x4a,0xbd,0x10,0x09,
+0x3a,0x67,0xb7,0x30,0x09,0x14,0xa3,0xa1,0xc2,0x09,0x46,0x2a,0x60,0x11,0x91,0x02,
+0x10,0x22,0x05,0x00,0xf2,0x1d,0x2b,0x00,0x00,0x0b,0xbb,0xbc,0xbb,0xb6,0x00,0x0b,
+0x30,0x52,0x00,0x00,0x95,0x00,0x2c,0x30,0x05,0xdc,0xdb,0xe9,0xc1,0x00,0x07,0x50,
+0xb0,0x10,0x00,0x0b,0x20,0xb0,0x03,0x00,0x5a,0x00,0xb0,0x0b,0x0b,0xa0,0x00,0xbb,
+0xc6,0x01,0x93,0x02,0xf0,0x0f,0x64,0x02,0x10,0x03,0xa0,0x64,0x0c,0x10,0x00,0x52,
+0x64,0x44,0x00,0x5b,0xbb,0xdc,0xbb,0xb0,0x00,0x0a,0x15,0x50,0x00,0x00,0x0c,0x05,
+0x50,0x00,0x00,0x2a,0x05,0x00,0x82,0xc3,0x05,0x60,0x41,0x4c,0x40,0x02,0xcb,0xc6,
+0x02,0xf7,0x1e,0x09,0x99,0xad,0x99,0x94,0x01,0x11,0x49,0x11,0x10,0x00,0xaa,0xbd,
+0xaa,0x40,0x00,0xb0,0x00,0x05,0x60,0x00,0xb1,0x11,0x16,0x60,0x00,0x9c,0xba,0xd9,
+0x40,0x00,0x0a,0x21,0x90,0x01,0x00,0x5a,0x01,0x90,0x0b,0x1c,0x90,0x00,0xcb,0xc6,
+0x9d,0x03,0x20,0x0b,0x30,0x0a,0x01,0x10,0xd1,0x0b,0x00,0x10,0x9a,0x05,0x00,0xf0,
+0x10,0xda,0x30,0x00,0x00,0x04,0xa2,0xb0,0x00,0x00,0x0c,0x20,0x95,0x00,0x00,0x88,
+0x00,0x1d,0x20,0x09,0xa0,0x00,0x03,0xd3,0x26,0x00,0x00,0x00,0x23,0x00,0x00,0x12,
+0x23,0x00,0xf2,0x0d,0xbb,0x10,0x00,0x00,0x1b,0x33,0xc1,0x00,0x05,0xc3,0x00,0x2c,
+0x50,0x69,0xba,0xaa,0xab,0xa7,0x00,0x00,0x55,0x00,0x00,0x00,0xaa,0xcc,0xaa,0x00,
+0x0a,0x00,0x00,0x05,0x00,0x52,0x2a,0xaa,0xcc,0xaa,0xa2,0x64,0x00,0xf1,0x07,0x1c,
+0x00,0xc1,0x00,0x00,0x94,0x00,0x3a,0x00,0x05,0xb0,0x10,0x08,0x80,0x2c,0x00,0xc2,
+0x00,0xa5,0x01,0x06,0x90,0x19,0x00,0xb1,0x93,0x00,0x00,0xb3,0x00,0x2d,0x10,0x07,
+0xec,0xbb,0xaa,0x95,0x01,0x21,0x70,0x00,0xc2,0x02,0xe1,0xb1,0x00,0x75,0x00,0x00,
+0x26,0x02,0xb0,0x00,0x2b,0xbb,0xbb,0xbb,0x90,0x45,0x00,0x83,0x06,0x99,0x99,0x99,
+0x10,0x01,0x11,0x11,0x58,0x01,0x57,0x6a,0xaa,0xaa,0xaa,0xa1,0xc8,0x00,0xf0,0x02,
+0x46,0x00,0x1c,0x00,0x00,0x0a,0x00,0x84,0x00,0x05,0xbb,0xce,0xbb,0xa0,0x00,0x00,
+0x2a,0x72,0x01,0xf0,0x05,0xce,0xbb,0xb6,0x00,0x00,0x9d,0x40,0x00,0x00,0x06,0xb1,
+0xc2,0x00,0x03,0xba,0x00,0x2c,0x92,0x19,0x30,0x9d,0x00,0xd0,0xb0,0x00,0x66,0x00,
+0x38,0xe8,0x88,0xbb,0x80,0x00,0xca,0xaa,0xc5,0x1e,0x05,0x26,0x55,0x00,0x0a,0x00,
+0xf0,0x07,0x7a,0xab,0xab,0xba,0xa2,0x03,0xa8,0x02,0xa7,0x10,0x58,0x20,0x00,0x04,
+0x90,0x00,0xba,0x99,0x9c,0x40,0x00,0xb9,0x05,0x00,0xd0,0xb1,0x11,0x18,0x40,0x00,
+0xb8,0x77,0x7b,0x40,0x00,0xb8,0x88,0x8c,0x63,0x01,0xf6,0x11,0x07,0x40,0x2a,0xac,
+0xaa,0xcb,0xa7,0x01,0x9a,0x00,0x4b,0x60,0x1a,0x30,0x00,0x00,0x66,0x00,0x0a,0x07,
+0x30,0x00,0x0c,0xae,0xbd,0xcc,0x60,0x0b,0x0a,0x07,0x34,0x60,0x0a,0x00,0xf1,0x3a,
+0x0b,0x0a,0x18,0x45,0x70,0x8a,0xab,0xaa,0xba,0xa3,0x01,0xa7,0x00,0xb8,0x00,0x5a,
+0x30,0x00,0x05,0xa0,0x00,0x40,0x00,0x05,0x00,0x01,0x6a,0x11,0x6a,0x10,0x08,0x8b,
+0xaa,0xc8,0x83,0x05,0x9c,0xbb,0xc9,0x60,0x02,0x27,0x75,0x93,0xa1,0x17,0x7a,0xa9,
+0xb8,0xc4,0x06,0x9c,0xbb,0xca,0x90,0x00,0x4e,0x53,0xd7,0x00,0x06,0xa6,0x53,0x77,
+0xa2,0x27,0x06,0x53,0x70,0x36,0x00,0x02,0x90,0xd6,0x00,0xf0,0x09,0xb5,0xb0,0x03,
+0x80,0x04,0x6b,0x00,0x7a,0x00,0x46,0xb0,0x0c,0x7a,0x04,0x6b,0x1b,0x40,0x6a,0x46,
+0xb9,0x30,0x00,0x77,0x6b,0x08,0x01,0xe2,0xb0,0x00,0x01,0xbc,0x40,0x0a,0xbd,0x2c,
+0xad,0x40,0x0a,0x08,0x2b,0x07,0x05,0x00,0xb2,0x8e,0xad,0xbe,0xad,0xb3,0x0b,0x19,
+0x4b,0x18,0x50,0x0b,0x14,0x00,0xd1,0x4a,0x07,0x40,0x56,0x08,0x95,0x07,0x40,0x90,
+0x7c,0xa0,0x6c,0x20,0x40,0x01,0xf0,0x00,0xea,0xbb,0xaa,0xab,0x9a,0x0c,0x00,0x00,
+0x28,0x01,0xea,0xaa,0xa3,0x00,0x47,0x71,0x01,0x30,0xba,0xaa,0xb8,0xfe,0x06,0x50,
+0x80,0x9a,0xaa,0xaa,0x66,0x62,0x02,0x42,0x30,0x00,0x00,0x9a,0x3a,0x03,0x10,0x16,
+0x2a,0x01,0xf1,0x00,0x09,0x41,0x11,0xc1,0x10,0x00,0x5b,0x99,0xe9,0xb6,0x00,0x0b,
+0x00,0xb0,0x46,0x05,0x00,0xb0,0x01,0xab,0xaa,0xea,0xc6,0x08,0x44,0x00,0xb0,0x12,
+0x2b,0x23,0x00,0x21,0x22,0x00,0x78,0x06,0xf3,0x1f,0x11,0x11,0x00,0x1a,0x00,0xa2,
+0x39,0x00,0x08,0x52,0xea,0xac,0xa5,0x00,0x4c,0x90,0x19,0x00,0x00,0x68,0xda,0xbd,
+0xa3,0x00,0x32,0x90,0x19,0x00,0x02,0xa1,0xda,0xbd,0xa3,0x09,0x31,0x90,0x19,0x00,
+0x1c,0x01,0xda,0xbe,0xa7,0x01,0x01,0x90,0xd1,0x01,0xf2,0x1e,0x24,0x00,0x00,0x37,
+0x91,0x0a,0x0a,0xaa,0xbd,0xb6,0x03,0x2a,0x44,0x48,0x10,0x00,0x0a,0x44,0x39,0x82,
+0x01,0x1a,0xa9,0x8a,0xb0,0x07,0x49,0x90,0x8c,0x60,0x0b,0x27,0xb9,0x8e,0x13,0x38,
+0x64,0x40,0xb7,0x68,0x21,0x90,0x07,0x30,0xc5,0x33,0x00,0x88,0xac,0xbb,0xe0,0x00,
+0x00,0xa1,0x00,0xb0,0x05,0x00,0x01,0xfa,0x06,0xf1,0x04,0xc0,0x00,0xb0,0x00,0x03,
+0xa0,0x00,0xb0,0x15,0x0b,0x30,0x00,0xb0,0x28,0x77,0x00,0x00,0x8c,0xc4,0x31,0x00,
+0xf0,0x15,0x31,0x0a,0x20,0x05,0x07,0x30,0xa2,0x00,0xb0,0x73,0x0a,0x20,0x0b,0x07,
+0xcb,0xec,0xbb,0xb0,0x10,0x0a,0x20,0x01,0x0c,0x00,0xa2,0x00,0xa2,0xc0,0x0a,0x20,
+0x0a,0x2e,0xbb,0xec,0xbb,0xe2,0x42,0x04,0x71,0x20,0x00,0x00,0x19,0x00,0x00,0x04,
+0x5a,0x02,0x00,0x0a,0x00,0x11,0x1b,0x5a,0x02,0x00,0x0a,0x00,0xe1,0x03,0x60,0x19,
+0x00,0x80,0x04,0x70,0x19,0x00,0xb0,0x04,0xdb,0xce,0xbb,0x88,0x06,0x11,0xb0,0x75,
+0x04,0xf0,0x10,0xaa,0xad,0xa0,0x00,0x00,0x4a,0x00,0xa4,0x00,0xc0,0x5a,0xb2,0xb1,
+0xb7,0x3b,0xb0,0x29,0xda,0x0b,0xb8,0x82,0xa4,0x8b,0xb1,0x29,0x70,0x1b,0xea,0xaa,
+0xaa,0xae,0x7a,0x03,0x20,0x00,0x02,0x42,0x06,0x30,0x3b,0x00,0xa3,0x04,0x03,0xe0,
+0x1c,0x00,0x09,0x80,0x00,0x05,0xb0,0x4b,0xbb,0xbb,0xbb,0x74,0x00,0x04,0xa0,0x07,
+0xf3,0x02,0x08,0x40,0x0c,0x00,0x00,0x0c,0x00,0x0c,0x00,0x00,0xb4,0x00,0x0c,0x00,
+0x1c,0x50,0x0b,0xb7,0x03,0xf1,0x1e,0x09,0x10,0xbb,0xbb,0xb1,0x09,0x11,0x06,0x40,
+0xa1,0x5d,0xca,0x07,0x30,0xa1,0x4a,0x10,0x08,0x20,0xb0,0x09,0x10,0x0b,0x00,0xb0,
+0x09,0x26,0x1b,0x00,0xc0,0x0c,0xc6,0x57,0x00,0xc0,0x05,0x02,0xc1,0x00,0xc0,0x00,
+0x0b,0x20,0x9c,0x50,0x32,0x00,0xf6,0x1e,0x1b,0xec,0xba,0x00,0x1a,0x00,0xb0,0x00,
+0x47,0x1a,0x01,0xfa,0xa5,0x47,0x1a,0x07,0x50,0x55,0x47,0x1a,0x1b,0x40,0xa2,0x47,
+0x1a,0x01,0x6b,0xb0,0x47,0x1a,0x00,0x0b,0x40,0x23,0x1a,0x00,0x87,0x00,0x00,0x1a,
+0x0a,0x70,0x00,0x05,0xb7,0x53,0x03,0xf1,0x19,0x06,0xa0,0x00,0x0b,0x02,0xb7,0x70,
+0xb0,0xb2,0xc1,0x08,0x5b,0x0b,0x6a,0xaa,0xa2,0xb0,0xb0,0xb0,0x0b,0x0b,0x0b,0x0b,
+0x00,0xa0,0xb0,0xb0,0xb1,0x93,0x05,0x0b,0x0b,0x00,0x28,0x00,0xb0,0x7a,0xab,0x34,
+0x9c,0xb3,0x03,0x21,0x01,0x20,0xfc,0x00,0xf0,0x10,0x99,0x99,0x90,0x2a,0xb8,0x12,
+0xc1,0xb0,0x00,0x37,0x01,0xa0,0xb0,0x00,0xb5,0x12,0x80,0xb0,0x08,0xf9,0x05,0x50,
+0xb0,0x39,0xcb,0x09,0x20,0xb0,0x00,0xb0,0x1b,0x8f,0x01,0x72,0xa4,0x00,0xb0,0x00,
+0xb5,0x60,0x6b,0x9b,0x00,0x92,0x0a,0xb7,0xbb,0x50,0x09,0x09,0x17,0x93,0x5a,0x05,
+0x00,0x95,0x1b,0x5a,0xb7,0x8a,0x09,0x2c,0x7b,0xc8,0x9a,0x14,0x00,0xc0,0x55,0x09,
+0x0a,0x19,0x83,0x50,0x09,0x35,0x99,0x5a,0x32,0x97,0x31,0x00,0x12,0x10,0x81,0x02,
+0xf0,0x15,0x8a,0x81,0x10,0xa1,0x02,0x29,0x00,0x91,0xa1,0x15,0x7c,0x54,0x91,0xa1,
+0x14,0x9d,0x53,0x91,0xa1,0x00,0xcd,0x80,0x91,0xa1,0x07,0x79,0x65,0x91,0xa1,0x3b,
+0x29,0x00,0x20,0xa1,0x11,0x19,0x02,0x02,0x81,0x19,0x00,0x1b,0xc0,0x0e,0xaa,0xe0,
+0x10,0xbb,0x00,0xf0,0x11,0x0c,0x55,0xc0,0xb0,0xb0,0x59,0x55,0x0b,0x0b,0x38,0xd9,
+0x81,0xb0,0xb0,0x1b,0x1a,0x1b,0x0b,0x01,0x90,0xb0,0x30,0xb0,0x75,0x0b,0x00,0x0b,
+0x59,0x1a,0x90,0x1a,0xc0,0x5f,0x00,0xf2,0x46,0x1a,0xeb,0xa9,0x20,0xb0,0x1b,0x09,
+0x08,0x1b,0x0a,0x87,0xc6,0x81,0xb0,0x65,0x72,0x68,0x1b,0x01,0x1b,0x11,0x81,0xb0,
+0x99,0xe9,0x78,0x1b,0x00,0x0b,0x00,0x61,0xb0,0x26,0xec,0xa0,0x0b,0x29,0x62,0x00,
+0x0b,0xb0,0x08,0x29,0x00,0x22,0xa0,0x1d,0xbe,0xa6,0x45,0xb0,0x56,0x4b,0x22,0x55,
+0xb0,0x37,0x8c,0x77,0x55,0xb0,0x08,0x8d,0x85,0x45,0xb0,0x0b,0x3b,0x2a,0x45,0xb0,
+0x09,0x19,0x0a,0x00,0xb0,0x09,0x19,0x87,0x00,0xb0,0x00,0x19,0x00,0x0b,0x33,0x07,
+0xf4,0x17,0x0d,0xaa,0xac,0x11,0xb0,0xa0,0x00,0xa4,0x4b,0x0d,0xaa,0xa8,0x44,0xb0,
+0xa0,0x90,0x04,0x4b,0x0a,0xde,0xac,0x44,0xb0,0xa7,0xa0,0x94,0x4b,0x28,0x7a,0x0a,
+0x11,0xb6,0x45,0xa5,0x50,0x0b,0x60,0x0a,0x2e,0x00,0x01,0xa8,0x09,0xf2,0x1d,0x20,
+0x83,0x10,0xa1,0x00,0x8d,0x70,0x72,0xa1,0x08,0xa5,0xa5,0x72,0xa1,0x04,0x0b,0x01,
+0x72,0xa1,0x19,0x9e,0x98,0x72,0xa1,0x02,0x4b,0x70,0x72,0xa1,0x09,0x2b,0x47,0x10,
+0xa1,0x29,0x0b,0x08,0x00,0xa1,0x00,0x88,0x00,0x08,0xd0,0x33,0x00,0x10,0x20,0xcf,
+0x08,0xf0,0x06,0x49,0x00,0x1b,0x00,0x2a,0xad,0xaa,0xcc,0xa7,0x01,0x33,0x30,0x10,
+0x40,0x09,0x76,0xd0,0xb0,0xb0,0x09,0x99,0x05,0x00,0x21,0x10,0xa0,0x0a,0x00,0x10,
+0xa0,0x0a,0x00,0x62,0x00,0xb0,0x09,0x18,0xb0,0x1a,0x6d,0x00,0xf4,0x19,0x4a,0xaa,
+0xaa,0x10,0xb0,0x56,0x66,0x34,0x4b,0x0a,0x22,0x58,0x44,0xb0,0xa9,0x9a,0x74,0x4b,
+0x06,0x66,0x65,0x44,0xb1,0xa2,0xb2,0xb4,0x4b,0x1c,0x8d,0x8d,0x22,0xb1,0xd9,0xd9,
+0xd0,0x0b,0x18,0x00,0x0a,0x1b,0x9b,0x00,0xf4,0x1b,0xb0,0x00,0x5a,0xda,0x00,0xb0,
+0x00,0x01,0x90,0xbb,0xeb,0xe1,0x01,0x90,0x02,0x90,0xb0,0x01,0x90,0x04,0x70,0xb0,
+0x01,0xb7,0x18,0x30,0xb0,0x7c,0x94,0x1c,0x00,0xb0,0x10,0x00,0xb4,0x00,0xb0,0x00,
+0x0b,0x50,0x6b,0x60,0x30,0x00,0xf3,0x16,0x22,0x24,0xbe,0xba,0x5a,0x6d,0x00,0xb0,
+0xb5,0x50,0xb0,0x29,0x0b,0x55,0x0b,0x03,0x70,0xb5,0x50,0xb0,0x55,0x0b,0x55,0x0b,
+0x0a,0x21,0xa5,0x50,0xb1,0xc0,0x48,0x5d,0xbe,0x66,0x8c,0x25,0x50,0x3b,0x03,0x15,
+0x80,0x48,0x03,0xf0,0x0b,0x1c,0xfc,0xe2,0x4b,0xea,0xa0,0xb0,0x82,0x04,0x72,0x10,
+0xb0,0x91,0x08,0x23,0x71,0x90,0xa0,0x0c,0x58,0xc5,0x60,0xb0,0x3b,0x62,0x6b,0x1f,
+0x00,0x37,0x46,0x6b,0x80,0xc2,0x09,0x10,0x76,0x88,0x02,0xd0,0xdb,0xbb,0xbb,0xc0,
+0x1c,0x31,0x11,0x00,0xb0,0x44,0xe9,0x9e,0x00,0xce,0x09,0x50,0x01,0xa0,0x00,0xea,
+0xac,0x15,0x0c,0x30,0x00,0x79,0x20,0x34,0x00,0x83,0x29,0x00,0xab,0xbb,0xbb,0xd3,
+0x00,0x10,0xfb,0x06,0xf0,0x0c,0x07,0xdb,0xbb,0xbb,0xe7,0xd1,0x03,0x42,0x0b,0x3a,
+0x4a,0xb0,0xa0,0xb0,0xa0,0x8c,0x2a,0x0b,0x0a,0x67,0x07,0xa0,0xb0,0xa9,0x99,0x9d,
+0x0b,0x6c,0x06,0x00,0x0b,0x0b,0x13,0xb5,0x59,0x0a,0x00,0x05,0x00,0x10,0x3a,0x70,
 0x0b,0xf0,0x1c,0xb2,0x0c,0x00,0x53,0x06,0xe0,0x0c,0x03,0xc1,0x3c,0xc0,0x0c,0x3d,
 0x20,0x22,0xc0,0x0d,0xb1,0x00,0x00,0xc2,0xbe,0x00,0x00,0x00,0xc4,0x3c,0x00,0x08,
 0x00,0xc0,0x0c,0x00,0x1a,0x00,0xc0,0x09,0xcb,0xc4,0xeb,0xbe,0xbe,0xbb,0x61,0x02,
-0xf0,0x05,0x00,0xb0,0x28,0x0b,0x00,0x0b,0x05,0x60,0xb0,0x10,0xb0,0xa2,0x0b,0x0a,
-0x0b,0x79,0x00,0xab,0xa0,0xb3,0xc2,0x13,0xf0,0x19,0xbb,0xbb,0xbb,0xb4,0xeb,0xbb,
+0xf0,0x31,0x00,0xb0,0x28,0x0b,0x00,0x0b,0x05,0x60,0xb0,0x10,0xb0,0xa2,0x0b,0x0a,
+0x0b,0x79,0x00,0xab,0xa0,0xb3,0x00,0x00,0x00,0x0e,0xbb,0xbb,0xbb,0xb4,0xeb,0xbb,
 0xbb,0xbb,0x2b,0x01,0x00,0x08,0x00,0xb1,0xc2,0x08,0x50,0x0b,0x01,0xc6,0xa0,0x00,
 0xb0,0x03,0xf4,0x00,0x0b,0x01,0xc4,0xc2,0x00,0xb4,0xc1,0x02,0xc1,0x0b,0x31,0x00,
 0x03,0x00,0x24,0x00,0x22,0x50,0x00,0xf7,0x02,0x70,0xb5,0x38,0x00,0x09,0x8c,0x00,
 0x38,0x3d,0x04,0xe0,0x38,0x00,0x29,0x9e,0x99,0xac,0x96,0x02,0x2b,0x22,0x59,0x21,
-0x00,0x39,0x14,0x00,0xb0,0x94,0x00,0x38,0x00,0x04,0xb0,0x00,0x38,0x00,0x1b,0x10,
-0x0f,0x00,0x02,0x12,0x12,0xf4,0x06,0x28,0x03,0x60,0x00,0xa2,0x28,0x0b,0x20,0x00,
-0x23,0x28,0x05,0x00,0x06,0xbb,0xce,0xbb,0xb1,0x00,0x00,0x28,0xd1,0x11,0x00,0x0a,
-0x00,0x06,0x05,0x00,0xf5,0x1d,0x09,0x20,0x0a,0x00,0x00,0x09,0x22,0x5d,0x55,0x00,
-0x7d,0xb4,0x4c,0x4c,0x10,0x09,0x24,0x2b,0x0b,0x60,0x09,0x2a,0x1a,0x0b,0x91,0x09,
-0x3a,0x47,0x0b,0x64,0x09,0x22,0xb1,0x0b,0x22,0x09,0x26,0x70,0x0b,0x00,0x09,0x49,
-0x07,0xb7,0x8e,0x0e,0x10,0x02,0xcc,0x10,0xf8,0x11,0x3b,0x00,0x02,0xad,0xaa,0xdb,
-0x80,0x04,0x70,0x28,0x00,0xb0,0x04,0xc9,0xad,0x99,0xc0,0x04,0x94,0x6a,0x44,0xc0,
-0x01,0x55,0x7b,0x55,0x40,0x2a,0xaa,0xbd,0xaa,0xa7,0x69,0x00,0x10,0x73,0x05,0x00,
-0x10,0x7c,0xd2,0x00,0x10,0x73,0x87,0x00,0x10,0xdc,0x87,0x00,0x01,0xcf,0x11,0x20,
-0x79,0x92,0x4d,0x1e,0x20,0x3b,0xa0,0x0f,0x00,0x11,0x10,0x14,0x00,0x53,0x09,0xbb,
-0xbb,0xbb,0xa0,0x0b,0x10,0x0c,0x05,0x00,0x20,0x7a,0x60,0x0a,0x00,0xf1,0x02,0x00,
-0x02,0x22,0xc3,0x22,0x21,0x29,0x99,0x99,0x99,0x96,0x08,0xbb,0xbb,0xbb,0xb1,0x0b,
-0xd8,0x01,0x14,0x10,0x66,0x11,0x15,0x0c,0x05,0x00,0x01,0x0f,0x00,0x15,0x67,0x70,
-0x11,0x10,0x0c,0x3a,0x14,0x33,0x0b,0x00,0x0a,0x8d,0x10,0x90,0x0b,0x4b,0xbe,0xbb,
-0xa0,0x0b,0x00,0x0b,0x01,0x0f,0x00,0xd0,0x0b,0x20,0x28,0x00,0x0b,0x01,0x50,0x74,
-0x99,0x9e,0x99,0x93,0x30,0x94,0x14,0xf0,0x08,0x0a,0xba,0xac,0xba,0xa4,0x0a,0x13,
-0x4d,0x33,0x20,0x0a,0x1c,0x66,0x66,0xb0,0x0a,0x1d,0x88,0x88,0xb0,0x0b,0x0a,0x00,
-0x63,0x0e,0xf2,0x03,0x9e,0x99,0x70,0x1b,0x08,0x1b,0x08,0x10,0x58,0x77,0x0b,0x02,
-0xa0,0x52,0x50,0xac,0x00,0x31,0x25,0x13,0x90,0x08,0x70,0x86,0x00,0x00,0xed,0xba,
-0x9c,0x90,0x7c,0x06,0xf0,0x0e,0x30,0x2a,0xaf,0xba,0xdc,0xa7,0x00,0x97,0x49,0x2b,
-0x30,0x1c,0x69,0x63,0x71,0x97,0x00,0x17,0xa8,0x16,0x20,0x00,0x03,0x26,0xb6,0x00,
-0x00,0x9a,0x74,0xf0,0x02,0xf3,0x07,0xaa,0xaa,0x40,0x03,0xa1,0x41,0x19,0x30,0x00,
-0xa1,0x86,0x0b,0x00,0x00,0x39,0x05,0x75,0x00,0x00,0x09,0x54,0xa0,0x52,0x13,0xa0,
-0x08,0xaa,0x91,0x00,0x28,0xc5,0x00,0x5b,0xa3,0x34,0x21,0x16,0x20,0x09,0xce,0x92,
-0x06,0x10,0x1c,0x03,0x01,0xf0,0x29,0x2f,0x21,0xea,0xa1,0x00,0x3b,0x80,0x11,0xc0,
-0x00,0x74,0xb2,0x05,0x80,0x00,0xc0,0x2c,0x3b,0x00,0x05,0x90,0x07,0xf5,0x00,0x2d,
-0x14,0xaa,0x4c,0xc4,0x01,0x05,0x20,0x00,0x23,0x3b,0xbb,0x5b,0xbb,0xb0,0x00,0x06,
-0x5b,0x00,0xb0,0x09,0x09,0x28,0x30,0xa0,0x07,0x7c,0x04,0x65,0x70,0x00,0xaa,0xc0,
-0x09,0xf0,0x04,0xac,0x00,0x99,0x00,0x03,0xa6,0x72,0xdc,0x00,0x2c,0x10,0x6c,0x25,
-0xb1,0x32,0x00,0x61,0x00,0x43,0x07,0x0a,0x62,0x20,0x00,0x9a,0xab,0xa8,0x30,0xc2,
-0x06,0xf3,0x13,0xb1,0x11,0x11,0x00,0x01,0xdc,0xa9,0x9b,0x80,0x02,0x93,0x80,0x0b,
-0x10,0x03,0x80,0xa3,0x59,0x00,0x06,0x60,0x1c,0xc0,0x00,0x0a,0x22,0x9a,0xb8,0x10,
-0x0a,0x5a,0x30,0x04,0xa4,0x04,0x02,0x10,0x21,0xac,0x03,0xf2,0x1b,0x93,0x1b,0x00,
+0x00,0x39,0x14,0x00,0xd3,0x94,0x00,0x38,0x00,0x04,0xb0,0x00,0x38,0x00,0x1b,0x10,
+0x00,0x38,0xb5,0x00,0xf1,0x0e,0x70,0x28,0x03,0x60,0x00,0xa2,0x28,0x0b,0x20,0x00,
+0x23,0x28,0x05,0x00,0x06,0xbb,0xce,0xbb,0xb1,0x00,0x00,0x28,0x00,0x00,0x2b,0xbb,
+0xce,0xbb,0xb7,0x0a,0x00,0x06,0x05,0x00,0xf4,0x1e,0x09,0x20,0x0a,0x00,0x00,0x09,
+0x22,0x5d,0x55,0x00,0x7d,0xb4,0x4c,0x4c,0x10,0x09,0x24,0x2b,0x0b,0x60,0x09,0x2a,
+0x1a,0x0b,0x91,0x09,0x3a,0x47,0x0b,0x64,0x09,0x22,0xb1,0x0b,0x22,0x09,0x26,0x70,
+0x0b,0x00,0x09,0x49,0x07,0xb7,0x00,0x15,0x01,0xf8,0x16,0x02,0x00,0x00,0x1b,0x00,
+0x3b,0x00,0x02,0xad,0xaa,0xdb,0x80,0x04,0x70,0x28,0x00,0xb0,0x04,0xc9,0xad,0x99,
+0xc0,0x04,0x94,0x6a,0x44,0xc0,0x01,0x55,0x7b,0x55,0x40,0x2a,0xaa,0xbd,0xaa,0xa7,
+0x69,0x00,0x10,0x73,0x05,0x00,0x10,0x7c,0xd2,0x00,0x10,0x73,0x87,0x00,0x10,0xdc,
+0x87,0x00,0x10,0x74,0x14,0x00,0x80,0x79,0x92,0x00,0x00,0x00,0x74,0x3b,0xa0,0x0f,
+0x00,0x11,0x10,0x14,0x00,0x50,0x09,0xbb,0xbb,0xbb,0xa0,0x0d,0x08,0x1e,0xc0,0x05,
+0x00,0x20,0x7a,0x60,0x0a,0x00,0xf1,0x02,0x00,0x02,0x22,0xc3,0x22,0x21,0x29,0x99,
+0x99,0x99,0x96,0x08,0xbb,0xbb,0xbb,0xb1,0x0b,0xd8,0x01,0x01,0x05,0x00,0x00,0x53,
+0x00,0x15,0x0c,0x05,0x00,0x01,0x0f,0x00,0x10,0x67,0x05,0x00,0x11,0x40,0x14,0x00,
+0xa0,0xbb,0xbb,0xbb,0xb5,0x0b,0x00,0x0a,0x00,0x00,0x0b,0x1b,0x00,0x90,0x0b,0x4b,
+0xbe,0xbb,0xa0,0x0b,0x00,0x0b,0x01,0x0f,0x00,0xf0,0x19,0x0b,0x20,0x28,0x00,0x0b,
+0x01,0x50,0x74,0x99,0x9e,0x99,0x93,0x30,0x11,0x11,0x11,0x10,0x0a,0xba,0xac,0xba,
+0xa4,0x0a,0x13,0x4d,0x33,0x20,0x0a,0x1c,0x66,0x66,0xb0,0x0a,0x1d,0x88,0x88,0xb0,
+0x0b,0x0a,0x00,0x63,0x0e,0xf0,0x05,0x9e,0x99,0x70,0x1b,0x08,0x1b,0x08,0x10,0x58,
+0x77,0x0b,0x02,0xa0,0x52,0x50,0xac,0x00,0x31,0x00,0x00,0x51,0x09,0x90,0x08,0x70,
+0x86,0x00,0x00,0xed,0xba,0x9c,0x90,0x7c,0x06,0xf0,0x0e,0x30,0x2a,0xaf,0xba,0xdc,
+0xa7,0x00,0x97,0x49,0x2b,0x30,0x1c,0x69,0x63,0x71,0x97,0x00,0x17,0xa8,0x16,0x20,
+0x00,0x03,0x26,0xb6,0x00,0x00,0x9a,0x74,0xf0,0x02,0xf0,0x06,0xaa,0xaa,0x40,0x03,
+0xa1,0x41,0x19,0x30,0x00,0xa1,0x86,0x0b,0x00,0x00,0x39,0x05,0x75,0x00,0x00,0x09,
+0x54,0x6a,0x07,0x10,0xcc,0x4b,0x00,0xf0,0x00,0xaa,0x91,0x00,0x28,0xc5,0x00,0x5b,
+0xa3,0x34,0x00,0x00,0x00,0x21,0x09,0xce,0x92,0x06,0x10,0x1c,0x03,0x01,0xf0,0x13,
+0x2f,0x21,0xea,0xa1,0x00,0x3b,0x80,0x11,0xc0,0x00,0x74,0xb2,0x05,0x80,0x00,0xc0,
+0x2c,0x3b,0x00,0x05,0x90,0x07,0xf5,0x00,0x2d,0x14,0xaa,0x4c,0xc4,0x01,0x05,0x20,
+0x00,0x23,0xf2,0x51,0x3b,0xbb,0x5b,0xbb,0xb0,0x00,0x06,0x5b,0x00,0xb0,0x09,0x09,
+0x28,0x30,0xa0,0x07,0x7c,0x04,0x65,0x70,0x00,0xaa,0x00,0xbb,0x10,0x00,0xac,0x00,
+0x99,0x00,0x03,0xa6,0x72,0xdc,0x00,0x2c,0x10,0x6c,0x25,0xb1,0x32,0x00,0x61,0x00,
+0x43,0x00,0x00,0x00,0x02,0x20,0x00,0x9a,0xab,0xa8,0x30,0x00,0xb0,0x00,0x00,0x00,
+0x00,0xb1,0x11,0x11,0x00,0x01,0xdc,0xa9,0x9b,0x80,0x02,0x93,0x80,0x0b,0x10,0x03,
+0x80,0xa3,0x59,0x00,0x06,0x60,0x1c,0xc0,0x00,0x0a,0x22,0x9a,0xb8,0x10,0x0a,0x5a,
+0x30,0x04,0xa4,0x00,0x01,0x00,0xf1,0x21,0x21,0x00,0x00,0x00,0xb0,0x93,0x1b,0x00,
 0x04,0x80,0xc1,0x03,0x30,0x08,0xbc,0xeb,0xbb,0xb3,0x00,0x07,0x91,0x11,0x00,0x00,
 0x0e,0xc9,0x9e,0x30,0x00,0x79,0xb1,0x4b,0x00,0x04,0xc0,0x3b,0xc1,0x00,0x5b,0x00,
-0x7c,0xc5,0x00,0x00,0x4b,0x60,0x07,0x7a,0x07,0xf3,0x1e,0x6e,0xad,0xb5,0x55,0x50,
-0x0b,0x08,0x3a,0x86,0xc0,0x0d,0xad,0x34,0x50,0xa0,0x0b,0x08,0x31,0x91,0x90,0x0d,
-0xad,0x30,0xb7,0x40,0x0b,0x08,0x30,0x6d,0x00,0x2d,0x8d,0xc0,0x7d,0x00,0x46,0x38,
-0x34,0xa5,0x90,0x00,0x08,0x4b,0x00,0x74,0x69,0x00,0xf2,0x21,0x34,0x00,0x00,0x08,
-0x88,0x9e,0x88,0x84,0x01,0x66,0x72,0xb5,0x10,0x04,0xa5,0x60,0xa5,0x80,0x07,0x15,
-0x60,0xa0,0x61,0x04,0x9a,0xa9,0xa9,0x20,0x00,0x4a,0x10,0x6b,0x00,0x00,0x03,0xc9,
-0x90,0x00,0x04,0x8b,0x98,0xb7,0x41,0x07,0x40,0x00,0x03,0x64,0x36,0x00,0xf1,0x13,
-0x8c,0xb9,0xd7,0x00,0x00,0x77,0x76,0x77,0x20,0x09,0x9a,0x98,0x98,0xc1,0x07,0xaa,
-0x46,0xb9,0x81,0x0a,0x77,0x88,0x77,0x95,0x06,0x68,0x88,0x8a,0x23,0x00,0x88,0x66,
-0x6c,0x00,0x05,0x00,0xd0,0x18,0xc9,0x88,0x8d,0x85,0x11,0x11,0x11,0x11,0xb9,0x99,
-0x99,0x9c,0xff,0x0a,0x0b,0x04,0x00,0x00,0x32,0x02,0x10,0xbc,0x08,0x00,0x40,0x07,
-0xbb,0xbb,0xbb,0x5b,0x13,0x51,0xc0,0x09,0x20,0x00,0x0c,0x09,0x00,0x42,0x08,0xbb,
-0xbb,0xbd,0x6c,0x00,0xd2,0x87,0x02,0xc2,0x00,0x98,0x00,0x01,0xc3,0x55,0x00,0x00,
-0x01,0x80,0xcb,0x16,0x00,0x52,0x16,0xc0,0x01,0xaa,0xa9,0x05,0x60,0x02,0x90,0x0b,
-0x05,0x60,0x02,0x80,0x05,0x00,0x61,0xda,0xad,0x05,0x60,0x02,0x70,0x6b,0x16,0x01,
-0x05,0x00,0x00,0xc3,0x1c,0x10,0x06,0xeb,0x01,0xf0,0x0a,0x50,0x30,0x00,0x05,0x70,
-0x07,0x80,0x05,0xd6,0x77,0x8e,0x60,0x46,0x43,0x32,0x19,0x00,0xaa,0xaa,0xaa,0x10,
-0x0c,0x11,0x11,0xa2,0x6f,0x09,0x71,0x20,0x0e,0xbb,0xbb,0xe2,0x00,0xb0,0x44,0x16,
-0x01,0x57,0x05,0x12,0xc0,0xe9,0x15,0x12,0xb6,0x2e,0x16,0x10,0x3b,0x13,0x00,0xb0,
-0xcd,0xbb,0xbb,0xb0,0x0b,0x6a,0x00,0x00,0xb0,0x24,0x1a,0x41,0x05,0x60,0x1e,0xbb,
-0xbb,0xc0,0x00,0x1a,0x10,0x0e,0xf0,0x06,0xca,0xaa,0xad,0x00,0x05,0x71,0x11,0x1c,
-0x00,0x03,0x88,0x88,0x87,0x00,0x59,0x99,0x99,0x99,0x90,0x01,0xa3,0x8f,0x19,0x34,
-0xfb,0xaa,0xa9,0x90,0x14,0x88,0x00,0x48,0x00,0x00,0x00,0x7a,0xb1,0x00,0x6a,0x12,
-0x10,0x8a,0x97,0x00,0xe2,0x77,0x90,0x00,0x04,0xc5,0x00,0x4c,0x40,0x4b,0x7a,0xaa,
-0xa6,0xa3,0x00,0x2f,0x0a,0x20,0xaa,0xae,0x61,0x00,0x15,0x0c,0x0a,0x00,0x10,0x0b,
-0xa8,0x04,0xf2,0x01,0xbe,0xb1,0x44,0x44,0x2b,0xb2,0x55,0x55,0x2b,0xb0,0x99,0x99,
-0x0b,0xb0,0xa0,0x0b,0x04,0x00,0xf0,0x1d,0xda,0xab,0x0b,0xb0,0x20,0x00,0x0b,0xb0,
-0x00,0x01,0xbb,0x00,0x04,0x30,0x00,0x00,0x03,0xfa,0x99,0x70,0x07,0xa2,0x11,0x85,
-0x03,0x73,0x80,0x69,0x00,0x00,0x07,0xd7,0x00,0x00,0x4a,0xfc,0x99,0x90,0x67,0xc1,
-0x11,0x1c,0x00,0x0a,0x4b,0x00,0x00,0x1f,0x09,0x12,0x0a,0x00,0x06,0xa2,0x03,0x20,
-0x06,0xaa,0xab,0x97,0x30,0x0a,0x10,0x00,0xee,0x17,0x12,0xb3,0xd7,0x03,0xa0,0x0b,
-0xbb,0xbb,0x80,0x0c,0x0b,0x00,0x00,0xc0,0x2b,0x05,0x00,0x71,0x87,0x0e,0xaa,0xaa,
-0xc0,0x80,0x0c,0x11,0x01,0x01,0xb0,0x11,0x20,0x10,0x00,0xd1,0x1d,0x22,0xbb,0xce,
-0x88,0x15,0x72,0xb0,0xaa,0xaa,0x0b,0xb0,0xa0,0x0a,0x04,0x00,0x50,0xda,0xaa,0x0b,
-0xb0,0x30,0x8c,0x00,0x22,0x05,0xbb,0x80,0x08,0xf4,0x13,0xa6,0x5a,0xaa,0xc0,0x0a,
-0x0a,0x04,0x00,0xa0,0x0a,0x0a,0x28,0x02,0x90,0x0a,0x0a,0x46,0x03,0x70,0x0a,0x0a,
-0x3a,0xaa,0xa9,0x0d,0x8a,0x00,0x00,0x38,0x0a,0x22,0x9a,0xaa,0x66,0xb5,0x04,0x22,
-0x1a,0xb0,0x31,0x0d,0xf0,0x02,0xbb,0xbf,0xcb,0xb5,0x00,0x00,0xab,0x20,0x00,0x00,
-0x5c,0x79,0x6b,0x50,0x1d,0x81,0x29,0x3c,0x09,0x11,0x14,0x14,0x01,0xf2,0x02,0xab,
-0x70,0x00,0xb0,0x00,0x04,0x70,0x00,0xe9,0x99,0x9b,0x70,0x00,0xc1,0x11,0x15,0x70,
-0xd9,0x11,0x10,0x01,0x32,0x0d,0xf1,0x00,0x4b,0x42,0xb4,0x00,0x2c,0x91,0x68,0x18,
-0xc3,0x01,0xaa,0xab,0xa6,0x10,0x00,0xbe,0x04,0xd2,0xaa,0xac,0xda,0x00,0x01,0xa0,
-0x00,0x0b,0x00,0x01,0xd9,0x99,0x9e,0x0a,0x00,0x01,0x40,0x04,0x00,0xa8,0x18,0x10,
-0x0a,0xfd,0x04,0x40,0xa1,0x00,0x00,0x1a,0x09,0x00,0x01,0x12,0x07,0xf4,0x01,0x0b,
-0x6c,0xaa,0xaa,0xc0,0xc6,0x50,0x00,0x0b,0x68,0x6c,0xaa,0xaa,0xc9,0x16,0x50,0x46,
-0x14,0x20,0x73,0x0c,0xf9,0x06,0xd2,0xae,0xaa,0x90,0x0a,0x20,0x0c,0x00,0x00,0x1b,
-0xaa,0xae,0xaa,0xa6,0x19,0x00,0x40,0xda,0xaa,0xac,0x60,0x91,0x00,0x50,0x60,0x00,
-0xd9,0x99,0x9b,0x0e,0x0e,0x30,0x15,0x60,0x0a,0x66,0x16,0xf3,0x14,0xa1,0x0b,0x00,
-0x0b,0x0a,0x39,0xe9,0x91,0xb0,0xa4,0x7d,0x77,0x3b,0x0b,0x12,0x22,0x21,0xb0,0xb0,
-0xd9,0x9c,0x0b,0x0b,0x0a,0x00,0xb0,0xb4,0x80,0xd9,0x97,0x0b,0x91,0x01,0x00,0x7b,
-0x59,0x07,0x14,0x12,0xbe,0x00,0xa0,0x6a,0x13,0xc4,0x00,0x4d,0x9b,0xaa,0xa9,0xd4,
-0x11,0xd0,0x0b,0xc0,0x0b,0xad,0x1b,0xaa,0xb0,0x0a,0x09,0x1b,0x00,0xb0,0x0b,0x4b,
-0x05,0x00,0x51,0x55,0x0b,0x29,0x50,0x02,0x8f,0x00,0xf1,0x1c,0x03,0x40,0x00,0x02,
-0xad,0x92,0x7a,0xaa,0x00,0x83,0x0b,0x10,0xb4,0xad,0xba,0xb0,0x0b,0x00,0xe6,0x0b,
-0x00,0xb0,0x5e,0xc2,0xb0,0x0b,0x0b,0x84,0xab,0x00,0xb7,0x68,0x30,0xb0,0x0b,0x20,
-0x83,0x0b,0xbb,0xe0,0x08,0x30,0x10,0x81,0x0b,0xf0,0x0d,0x00,0x06,0x63,0x00,0xc1,
-0x00,0x0b,0x67,0x8a,0xda,0xa5,0x0a,0x27,0xb0,0x00,0x38,0x0a,0x27,0xb3,0xab,0x38,
-0x0a,0x27,0xb4,0x48,0x38,0x0c,0x87,0x05,0x00,0x40,0x42,0xb4,0xa8,0x38,0x0b,0x02,
-0x00,0x05,0x00,0x12,0x02,0x8a,0x07,0xe0,0x08,0xba,0x94,0xca,0xd0,0x08,0x21,0x94,
-0x50,0xb0,0x06,0xaa,0xa4,0xba,0xde,0x0b,0xf0,0x0c,0x4a,0x00,0x2a,0xaf,0xaa,0xeb,
-0xa7,0x04,0xc5,0x00,0x2b,0x71,0x2b,0xb8,0xb5,0xb8,0xd5,0x05,0x50,0xb5,0x50,0xb0,
-0x05,0xca,0xa5,0xca,0xb0,0x95,0x02,0x10,0x1b,0x6d,0x01,0x90,0xb0,0x8a,0xaa,0x0b,
-0x1b,0x0b,0x00,0xb0,0xb1,0x0a,0x0a,0x50,0x1b,0x0b,0xaa,0xd0,0xb1,0x1c,0x02,0x60,
-0x1e,0xbb,0xbb,0xbb,0xe1,0xb0,0x33,0x06,0x00,0x95,0x0b,0x50,0x1a,0x00,0x07,0x00,
-0x91,0x18,0x09,0xf0,0x08,0x1a,0x7a,0xcd,0xa9,0x91,0xa0,0x08,0xb1,0x09,0x1a,0x02,
-0xb1,0xa1,0x91,0xa4,0x91,0x02,0x89,0x1d,0x99,0x99,0x99,0xd1,0x0e,0x08,0x00,0x29,
+0x7c,0xc5,0x00,0x00,0x4b,0x60,0x07,0xc4,0x35,0x00,0xf3,0x1e,0x6e,0xad,0xb5,0x55,
+0x50,0x0b,0x08,0x3a,0x86,0xc0,0x0d,0xad,0x34,0x50,0xa0,0x0b,0x08,0x31,0x91,0x90,
+0x0d,0xad,0x30,0xb7,0x40,0x0b,0x08,0x30,0x6d,0x00,0x2d,0x8d,0xc0,0x7d,0x00,0x46,
+0x38,0x34,0xa5,0x90,0x00,0x08,0x4b,0x00,0x74,0x69,0x00,0xf2,0x21,0x34,0x00,0x00,
+0x08,0x88,0x9e,0x88,0x84,0x01,0x66,0x72,0xb5,0x10,0x04,0xa5,0x60,0xa5,0x80,0x07,
+0x15,0x60,0xa0,0x61,0x04,0x9a,0xa9,0xa9,0x20,0x00,0x4a,0x10,0x6b,0x00,0x00,0x03,
+0xc9,0x90,0x00,0x04,0x8b,0x98,0xb7,0x41,0x07,0x40,0x00,0x03,0x64,0x36,0x00,0xf1,
+0x13,0x8c,0xb9,0xd7,0x00,0x00,0x77,0x76,0x77,0x20,0x09,0x9a,0x98,0x98,0xc1,0x07,
+0xaa,0x46,0xb9,0x81,0x0a,0x77,0x88,0x77,0x95,0x06,0x68,0x88,0x8a,0x23,0x00,0x88,
+0x66,0x6c,0x00,0x05,0x00,0xfc,0x02,0x18,0xc9,0x88,0x8d,0x85,0x11,0x11,0x11,0x11,
+0xb9,0x99,0x99,0x9c,0xb0,0x00,0x00,0x0c,0x04,0x00,0x40,0xbb,0xbb,0xbb,0xbc,0x08,
+0x00,0xd1,0x07,0xbb,0xbb,0xbb,0x00,0x92,0x00,0x00,0xc0,0x09,0x20,0x00,0x0c,0x09,
+0x00,0x42,0x08,0xbb,0xbb,0xbd,0x6c,0x00,0xf0,0x14,0x87,0x02,0xc2,0x00,0x98,0x00,
+0x01,0xc3,0x55,0x00,0x00,0x01,0x80,0x2b,0xbb,0xbb,0xbb,0xb7,0x00,0x00,0x00,0x05,
+0x60,0x01,0xaa,0xa9,0x05,0x60,0x02,0x90,0x0b,0x05,0x60,0x02,0x80,0x05,0x00,0xb1,
+0xda,0xad,0x05,0x60,0x02,0x70,0x00,0x05,0x60,0x00,0x00,0x05,0x00,0xf1,0x1c,0x03,
+0xcc,0x30,0x00,0x06,0x00,0x00,0x00,0x08,0x50,0x30,0x00,0x05,0x70,0x07,0x80,0x05,
+0xd6,0x77,0x8e,0x60,0x46,0x43,0x32,0x19,0x00,0xaa,0xaa,0xaa,0x10,0x0c,0x11,0x11,
+0xa2,0x00,0xb0,0x00,0x09,0x20,0x0e,0xbb,0xbb,0xe2,0x09,0x00,0x30,0x00,0x00,0x60,
+0x6e,0x00,0xf0,0x00,0xc0,0x00,0x00,0x1b,0xbb,0xeb,0xbb,0xb6,0x00,0x0a,0x20,0x00,
+0x00,0x00,0x3b,0x13,0x00,0xf0,0x05,0xcd,0xbb,0xbb,0xb0,0x0b,0x6a,0x00,0x00,0xb0,
+0x24,0x1a,0x00,0x00,0xb0,0x00,0x1e,0xbb,0xbb,0xc0,0x00,0x0a,0x00,0xf0,0x0e,0x05,
+0xca,0xaa,0xad,0x00,0x05,0x71,0x11,0x1c,0x00,0x03,0x88,0x88,0x87,0x00,0x59,0x99,
+0x99,0x99,0x90,0x01,0xa3,0x11,0x11,0x10,0x00,0xfb,0xaa,0xa9,0x39,0x00,0x10,0x1b,
+0x05,0x00,0x73,0x48,0x00,0x00,0x00,0x7a,0xb1,0x00,0x01,0x00,0x10,0x01,0x05,0x00,
+0x10,0x8a,0x97,0x00,0xd2,0x77,0x90,0x00,0x04,0xc5,0x00,0x4c,0x40,0x4b,0x7a,0xaa,
+0xa6,0xa3,0x1d,0x00,0x30,0xea,0xaa,0xae,0x61,0x00,0x15,0x0c,0x0a,0x00,0xf2,0x06,
+0x0b,0x00,0xeb,0xbb,0xbb,0xbe,0xb1,0x44,0x44,0x2b,0xb2,0x55,0x55,0x2b,0xb0,0x99,
+0x99,0x0b,0xb0,0xa0,0x0b,0x04,0x00,0xf0,0x1d,0xda,0xab,0x0b,0xb0,0x20,0x00,0x0b,
+0xb0,0x00,0x01,0xbb,0x00,0x04,0x30,0x00,0x00,0x03,0xfa,0x99,0x70,0x07,0xa2,0x11,
+0x85,0x03,0x73,0x80,0x69,0x00,0x00,0x07,0xd7,0x00,0x00,0x4a,0xfc,0x99,0x90,0x67,
+0xc1,0x11,0x1c,0x00,0x0a,0x4b,0x00,0x32,0xaa,0xaa,0xae,0x09,0x00,0xf0,0x05,0x00,
+0x00,0x03,0x20,0x06,0xaa,0xab,0x97,0x30,0x0a,0x10,0x00,0x00,0x00,0x0b,0xbb,0xbb,
+0xbb,0xb3,0x0b,0x7d,0x00,0xb0,0x0c,0x0b,0xbb,0xbb,0x80,0x0c,0x0b,0x00,0x00,0xc0,
+0x2b,0x05,0x00,0x71,0x87,0x0e,0xaa,0xaa,0xc0,0x80,0x0c,0x11,0x01,0x00,0x01,0x00,
+0xf2,0x07,0x04,0x10,0x00,0x00,0x0d,0x00,0x00,0xbb,0xce,0xbb,0xbb,0xb0,0x00,0x00,
+0x0b,0xb0,0xaa,0xaa,0x0b,0xb0,0xa0,0x0a,0x04,0x00,0x50,0xda,0xaa,0x0b,0xb0,0x30,
+0x8c,0x00,0x21,0x05,0xbb,0x2c,0x00,0xf0,0x14,0x0a,0xa6,0x5a,0xaa,0xc0,0x0a,0x0a,
+0x04,0x00,0xa0,0x0a,0x0a,0x28,0x02,0x90,0x0a,0x0a,0x46,0x03,0x70,0x0a,0x0a,0x3a,
+0xaa,0xa9,0x0d,0x8a,0x00,0x00,0x38,0x0a,0x22,0x9a,0xaa,0x66,0x27,0x00,0x50,0x73,
+0x00,0x00,0x00,0x1a,0x17,0x03,0x00,0x87,0x00,0xf1,0x06,0xbf,0xcb,0xb5,0x00,0x00,
+0xab,0x20,0x00,0x00,0x5c,0x79,0x6b,0x50,0x1d,0x81,0x29,0x00,0x87,0x00,0x00,0x14,
+0x14,0x01,0xf0,0x05,0xab,0x70,0x00,0xb0,0x00,0x04,0x70,0x00,0xe9,0x99,0x9b,0x70,
+0x00,0xc1,0x11,0x15,0x70,0x00,0x00,0x13,0x4a,0x01,0xf0,0x03,0xbb,0x10,0x00,0x00,
+0x4b,0x42,0xb4,0x00,0x2c,0x91,0x68,0x18,0xc3,0x01,0xaa,0xab,0xa6,0x10,0x61,0x03,
+0xf2,0x00,0x00,0x00,0xaa,0xac,0xda,0x00,0x01,0xa0,0x00,0x0b,0x00,0x01,0xd9,0x99,
+0x9e,0x0a,0x00,0xf0,0x03,0x00,0x00,0x30,0x00,0x00,0x00,0x06,0x60,0x00,0x0a,0xbb,
+0xbb,0xbb,0xa0,0xa1,0x00,0x00,0x1a,0x09,0x00,0x20,0x80,0xb0,0x7a,0x00,0xf1,0x00,
+0x6c,0xaa,0xaa,0xc0,0xc6,0x50,0x00,0x0b,0x68,0x6c,0xaa,0xaa,0xc9,0x16,0x50,0x2e,
+0x00,0x00,0x9d,0x00,0xf2,0x03,0x0c,0x00,0x00,0x01,0xdb,0xae,0xaa,0x90,0x0a,0x20,
+0x0c,0x00,0x00,0x1b,0xaa,0xae,0xaa,0xa6,0x19,0x00,0x40,0xda,0xaa,0xac,0x60,0x91,
+0x00,0xb0,0x60,0x00,0xd9,0x99,0x9b,0x60,0x00,0xb1,0x11,0x15,0x60,0x4d,0x00,0xf2,
+0x16,0xb0,0xa1,0x0b,0x00,0x0b,0x0a,0x39,0xe9,0x91,0xb0,0xa4,0x7d,0x77,0x3b,0x0b,
+0x12,0x22,0x21,0xb0,0xb0,0xd9,0x9c,0x0b,0x0b,0x0a,0x00,0xb0,0xb4,0x80,0xd9,0x97,
+0x0b,0x91,0x01,0x00,0x7b,0x80,0x42,0x00,0x14,0x12,0xbe,0x00,0xf0,0x0b,0x6a,0x13,
+0xc4,0x00,0x4d,0x9b,0xaa,0xa9,0xd4,0x11,0x00,0x00,0x00,0x11,0x0b,0xad,0x1b,0xaa,
+0xb0,0x0a,0x09,0x1b,0x00,0xb0,0x0b,0x4b,0x05,0x00,0x51,0x55,0x0b,0x29,0x50,0x02,
+0x8f,0x00,0xf0,0x1c,0x03,0x40,0x00,0x02,0xad,0x92,0x7a,0xaa,0x00,0x83,0x0b,0x10,
+0xb4,0xad,0xba,0xb0,0x0b,0x00,0xe6,0x0b,0x00,0xb0,0x5e,0xc2,0xb0,0x0b,0x0b,0x84,
+0xab,0x00,0xb7,0x68,0x30,0xb0,0x0b,0x20,0x83,0x0b,0xbb,0xe0,0x08,0x30,0x10,0x60,
+0x00,0xf0,0x0e,0x31,0x00,0x06,0x63,0x00,0xc1,0x00,0x0b,0x67,0x8a,0xda,0xa5,0x0a,
+0x27,0xb0,0x00,0x38,0x0a,0x27,0xb3,0xab,0x38,0x0a,0x27,0xb4,0x48,0x38,0x0c,0x87,
+0x05,0x00,0x40,0x42,0xb4,0xa8,0x38,0x0b,0x02,0x00,0x05,0x00,0x21,0x02,0xb5,0x94,
+0x00,0xf0,0x1e,0x08,0xba,0x94,0xca,0xd0,0x08,0x21,0x94,0x50,0xb0,0x06,0xaa,0xa4,
+0xba,0xb0,0x00,0x00,0xc0,0x4a,0x00,0x2a,0xaf,0xaa,0xeb,0xa7,0x04,0xc5,0x00,0x2b,
+0x71,0x2b,0xb8,0xb5,0xb8,0xd5,0x05,0x50,0xb5,0x50,0xb0,0x05,0xca,0xa5,0xca,0xb0,
+0x95,0x02,0x10,0x1b,0x6d,0x01,0xf0,0x03,0xb0,0x8a,0xaa,0x0b,0x1b,0x0b,0x00,0xb0,
+0xb1,0xb0,0xb0,0x0b,0x0b,0x1b,0x0b,0xaa,0xd0,0xb1,0x1c,0x02,0x50,0x1e,0xbb,0xbb,
+0xbb,0xe1,0x09,0x00,0xf0,0x1a,0x10,0xea,0xaa,0xaa,0xae,0x1a,0x00,0x07,0x00,0x91,
+0xa0,0x00,0xb0,0x09,0x1a,0x7a,0xcd,0xa9,0x91,0xa0,0x08,0xb1,0x09,0x1a,0x02,0xb1,
+0xa1,0x91,0xa4,0x91,0x02,0x89,0x1d,0x99,0x99,0x99,0xd1,0xb0,0x00,0x00,0x0a,0x29,
 0x00,0xf3,0x10,0xad,0x1b,0x00,0x0a,0x00,0x91,0xb5,0x9a,0xe9,0x79,0x1b,0x07,0x8d,
 0x72,0x91,0xb6,0x88,0xd8,0x69,0x1b,0x01,0x1b,0x1a,0x91,0xb0,0x00,0xb9,0x39,0x1e,
 0x99,0x9a,0x29,0x00,0x00,0x7b,0x00,0xf2,0x00,0xb0,0x04,0x30,0x0b,0xb6,0x9c,0xb9,
 0x6b,0xb0,0x05,0x40,0x0b,0xb0,0xc9,0x9c,0x84,0x02,0xb0,0x98,0x89,0x0b,0xe9,0x99,
 0x99,0x9e,0xb1,0x11,0x11,0x1c,0x76,0x00,0x81,0xb3,0x99,0x99,0x5c,0xb0,0x12,0xa1,
 0x0c,0x04,0x00,0xb0,0x89,0xda,0x3c,0xb0,0x01,0x96,0x2c,0xb4,0x88,0x88,0x6c,0x1c,
-0x00,0x00,0x71,0x04,0x00,0x08,0x00,0xf1,0x3f,0x0b,0x03,0x80,0x00,0xa0,0xb2,0xd9,
+0x00,0x00,0x71,0x04,0x00,0x08,0x00,0xf2,0x3f,0x0b,0x03,0x80,0x00,0xa0,0xb2,0xd9,
 0x8d,0x2a,0x0b,0x63,0xba,0x20,0xa0,0xb7,0xa7,0x6a,0x8b,0x0b,0x30,0x88,0x11,0xa0,
 0xb0,0x89,0x62,0x0a,0x0b,0x11,0x15,0x81,0xb0,0xe8,0x88,0x88,0x8d,0x00,0xe9,0x99,
 0x99,0x9c,0x5b,0x0b,0x88,0x95,0x55,0xb0,0xb7,0x79,0x65,0x5b,0x29,0x99,0x96,0x55,
 0xb4,0x60,0x30,0xa5,0x5b,0x46,0x1a,0x0a,0x55,0xb2,0x6b,0x6b,0x46,0x5b,0x76,0x10,
-0x17,0x65,0xe9,0x99,0x99,0x9b,0x50,0x64,0x02,0x00,0xef,0x20,0x80,0x00,0x1b,0xbd,
-0xcb,0xbb,0xb6,0x00,0x2b,0x70,0x07,0x00,0xca,0x14,0x67,0x0a,0xe0,0xbb,0xeb,0xb1,
-0x27,0xd2,0x14,0x00,0x05,0x00,0x42,0xb5,0xbb,0xeb,0xb6,0x79,0x0b,0x30,0x0a,0x00,
-0x0a,0x16,0x14,0xf0,0x13,0x81,0xa1,0x33,0x03,0xbe,0x98,0x5d,0xb7,0x90,0x00,0xa3,
-0xd8,0xb0,0x29,0x00,0x0a,0x19,0x1a,0x02,0x80,0x01,0xda,0x81,0xa4,0xb5,0x03,0xe8,
-0x08,0x18,0x00,0x20,0x12,0x00,0x82,0x0b,0x02,0x31,0x04,0xca,0xab,0xcb,0x0d,0x00,
-0xbd,0x16,0x12,0x29,0x05,0x00,0x30,0x4a,0xd8,0x84,0x0a,0x00,0x50,0x84,0x2e,0xb8,
-0x01,0x90,0x0a,0x00,0xf3,0x02,0xca,0x84,0x29,0x00,0x4c,0x71,0x84,0x29,0x00,0x10,
-0x01,0x95,0x3a,0x11,0x00,0x07,0x99,0x87,0x1d,0xf1,0x17,0x01,0xa0,0x05,0x70,0x00,
-0x01,0xa0,0x0d,0xa9,0x97,0x3b,0xe9,0xa3,0x00,0x0a,0x01,0xa0,0x48,0x40,0x0a,0x01,
-0xa0,0x00,0xa3,0x19,0x01,0xa7,0x10,0x29,0x58,0x08,0xd4,0x29,0xa1,0x37,0x26,0x00,
-0x53,0x6a,0x10,0x18,0x6a,0xab,0x1b,0x01,0xb5,0x13,0xb1,0xa0,0x79,0xe9,0x90,0x2b,
-0xe8,0x00,0xb0,0xb0,0x00,0xa0,0x05,0x00,0xf0,0x1f,0xbb,0xfb,0xd8,0x01,0xd9,0x06,
-0xb7,0x00,0x3c,0x60,0x0c,0x1b,0x10,0x00,0x01,0xb5,0x03,0xc2,0x00,0x07,0x30,0x00,
-0x27,0x07,0xea,0xe7,0x63,0x91,0x00,0xa0,0xb0,0x63,0x91,0x0a,0xea,0xea,0x63,0x91,
-0x02,0x90,0xb0,0x21,0x91,0x0a,0x10,0xa1,0x7a,0x15,0x10,0x1a,0x04,0x1b,0x31,0xbe,
-0xaa,0x70,0x45,0x10,0xf1,0x05,0x2a,0xaa,0xaa,0xaa,0xa7,0x02,0xc2,0x22,0x77,0x10,
-0x16,0xd6,0x66,0xa9,0x50,0x00,0xb8,0x88,0xb5,0x00,0x05,0x00,0xf3,0x09,0x7a,0xea,
-0xaa,0xcc,0xa3,0x02,0xb0,0x10,0x3a,0x00,0x6c,0x89,0xda,0x96,0xc2,0x30,0x00,0x91,
-0x00,0x10,0x09,0x99,0xda,0x99,0xd8,0x0c,0xf3,0x03,0x02,0x45,0xc4,0x41,0x0a,0x01,
-0x69,0x96,0x51,0x8e,0xb2,0xc5,0x55,0xa0,0x0a,0x00,0xc7,0x77,0x05,0x00,0xe0,0x41,
-0xc7,0x77,0xa0,0x6c,0x79,0xda,0xaa,0xd5,0x20,0x01,0x96,0x09,0x60,0x36,0x20,0x11,
-0x62,0x32,0x00,0xf0,0x1f,0x91,0x08,0x40,0xa0,0x09,0x17,0x87,0xb8,0x77,0xdb,0xa5,
-0x29,0x79,0x09,0x19,0x26,0xb4,0x90,0x91,0x35,0x55,0x53,0x09,0x42,0xd9,0x9d,0x16,
-0xb7,0x2d,0x77,0xc1,0x10,0x01,0xd8,0x8c,0x10,0x00,0x1a,0x00,0x91,0x0a,0xaa,0xbd,
-0xaa,0xa4,0x00,0x11,0x03,0x10,0x04,0xc6,0x05,0x42,0x02,0x99,0x99,0x99,0x79,0x09,
-0xc2,0x05,0xc8,0xac,0x88,0xc0,0x08,0x41,0x11,0x11,0x80,0x1c,0x00,0xae,0x11,0x00,
-0x4b,0x01,0x11,0x50,0x17,0x06,0xf0,0x09,0xaa,0xa4,0x00,0x04,0xcc,0x40,0x6b,0x00,
-0x00,0x50,0x1d,0xdb,0x00,0x00,0x16,0x9c,0x73,0x8d,0xc8,0x11,0x6c,0xaa,0xaa,0xa9,
-0x28,0x17,0x83,0x00,0xc0,0x00,0x0e,0x99,0xe9,0x9c,0x00,0x0b,0x00,0x61,0xaa,0xea,
-0xac,0x00,0x00,0x41,0x1f,0x1d,0xf4,0x1c,0x99,0x99,0x70,0x1b,0x53,0x33,0x33,0x00,
-0x23,0xc5,0x55,0x5c,0x00,0x00,0xc8,0x88,0x8d,0x00,0x00,0xab,0x88,0x8b,0x00,0x00,
-0x6d,0x99,0x97,0x00,0x09,0x8a,0x23,0xb3,0x00,0x02,0x48,0xee,0x84,0x10,0x59,0x73,
-0x00,0x47,0x91,0xe7,0x0b,0xf0,0x12,0xc0,0x00,0x02,0xeb,0xc2,0xc0,0x00,0x08,0x30,
-0xc0,0xc1,0x00,0x2b,0x21,0xc0,0xdc,0x30,0x33,0xba,0x70,0xc1,0xc3,0x00,0x0e,0x10,
-0xc0,0x12,0x00,0x87,0x00,0xc0,0x00,0x07,0x23,0x00,0x12,0x49,0xab,0x05,0x10,0x51,
-0xcd,0x03,0xf6,0x19,0xfa,0xa8,0x00,0x03,0xb6,0x00,0xb3,0x00,0x04,0x18,0x8c,0x40,
-0x00,0x01,0x5b,0xa7,0xa0,0x00,0x0b,0x72,0x6c,0xaa,0xe2,0x00,0x5c,0x91,0x06,0x70,
-0x00,0x40,0x1b,0xa8,0x00,0x00,0x36,0xba,0x30,0x00,0x0b,0x85,0x8d,0x1a,0x10,0x48,
-0xf7,0x06,0x10,0xdd,0x5b,0x07,0x20,0x9e,0x20,0x75,0x0b,0xf0,0x03,0x90,0x00,0x00,
-0x07,0x70,0xb1,0x00,0x00,0x4c,0x00,0x3c,0x10,0x09,0xb0,0x00,0x05,0xd4,0x05,0xfe,
-0x00,0x01,0x0f,0x0a,0x12,0x00,0x08,0x0b,0x10,0x48,0xb6,0x05,0x10,0xdd,0xb2,0x0f,
-0xf2,0x04,0xad,0x10,0x00,0x00,0x02,0xc2,0x80,0x00,0x00,0x2c,0x20,0x87,0x00,0x08,
-0xc2,0x00,0x08,0xb4,0x05,0x6b,0x10,0x0b,0x5a,0x00,0x10,0x8e,0x5a,0x00,0xf0,0x0a,
-0xc3,0xa0,0x00,0x00,0x05,0x80,0xb2,0x00,0x00,0x2d,0x90,0x3c,0x00,0x06,0xc2,0x5b,
-0x05,0xc2,0x18,0x00,0x05,0x10,0x36,0x00,0x82,0x55,0x00,0xc0,0xeb,0xce,0xbb,0x90,
-0x09,0x40,0x38,0x00,0x00,0x06,0x00,0x47,0xc8,0x0a,0x10,0xde,0x37,0x00,0xf1,0x00,
-0xc9,0x50,0x00,0x00,0x08,0x80,0xc2,0x00,0x03,0xb8,0x00,0x2c,0x61,0x19,0x20,0x72,
-0x0a,0x10,0x1a,0xc8,0x0a,0xf5,0x02,0xce,0xbb,0xb3,0x00,0x90,0x39,0x09,0x10,0x00,
-0x55,0x47,0x38,0x00,0x1b,0xcc,0xdd,0xcc,0x2d,0x00,0x91,0xb2,0x00,0x04,0xb8,0x00,
-0x2b,0x92,0x18,0x20,0xe0,0x08,0x00,0x42,0x1d,0xf8,0x1c,0x40,0x25,0x55,0x40,0x1a,
-0x21,0x24,0x4a,0x90,0x7e,0x9d,0x00,0x3a,0x00,0x19,0x0b,0x00,0x92,0x00,0x56,0x19,
-0xab,0xec,0xb3,0x3c,0x94,0x00,0x92,0x00,0x03,0xf4,0x00,0x92,0x00,0x0b,0x4b,0x00,
-0x92,0x00,0x94,0x00,0x0a,0xc1,0x70,0x1b,0x10,0x80,0x17,0x1e,0xf0,0x1c,0x61,0x07,
-0x44,0x20,0x4d,0x9d,0x1a,0x01,0xb0,0x0a,0x0a,0xbc,0xbb,0xc5,0x0a,0x19,0x10,0x00,
-0x12,0x1b,0x95,0x4c,0x99,0xe0,0x00,0xd8,0x45,0x00,0xb0,0x1b,0x44,0x5b,0x88,0xd0,
-0x37,0x00,0x47,0x11,0xb0,0x02,0xbb,0xbb,0xbb,0x6a,0x13,0x60,0x6b,0x10,0x00,0x00,
-0x0b,0x70,0xdc,0x06,0x02,0x12,0x0c,0x11,0xb8,0x0a,0x00,0x03,0x05,0x00,0x10,0x2a,
-0x73,0x06,0x13,0xc6,0x29,0x1e,0xf1,0x00,0x28,0x88,0xbb,0x88,0x80,0x59,0x22,0x22,
-0x22,0xc0,0x35,0x7b,0xbb,0xb4,0x80,0x1d,0x10,0x01,0xae,0x27,0x02,0x9b,0x14,0x02,
-0xa4,0x09,0x10,0x74,0xf9,0x02,0x12,0xc2,0x86,0x0e,0x10,0x00,0xac,0x12,0x40,0x00,
-0x1b,0xbe,0xbb,0x60,0x04,0x00,0x13,0x00,0xf3,0x04,0xb3,0x6a,0xad,0xb0,0x0b,0xd0,
-0x00,0x67,0x00,0x35,0xb4,0xbb,0xeb,0xb8,0x00,0xb0,0x00,0xa1,0x00,0x05,0x00,0x14,
-0x2a,0x56,0x0e,0xf0,0x00,0x10,0x30,0x00,0x20,0x01,0xb0,0x57,0x08,0x50,0x0a,0xda,
-0xad,0xae,0xa5,0x09,0x80,0x1a,0xd0,0x02,0x7a,0xaa,0xf9,0x11,0x00,0x00,0x2b,0x50,
-0x00,0x1a,0xaa,0xcd,0x49,0x0c,0x05,0x01,0x20,0x23,0x1b,0xc4,0xf9,0x0d,0x21,0x06,
-0x60,0x7b,0x08,0x00,0x2b,0x05,0x90,0x08,0x10,0x03,0x30,0x0a,0x25,0xba,0x30,0x0a,
-0xb8,0x18,0xb2,0x10,0x00,0x03,0x0a,0x20,0x00,0x0c,0x05,0xcb,0xbb,0xd6,0x60,0x00,
-0x00,0x8e,0x01,0xf1,0x16,0x0c,0xaa,0xaa,0xaa,0xd4,0x0b,0x00,0xa0,0x00,0x84,0x0b,
-0xbc,0xeb,0xbb,0xb5,0x00,0x2b,0x00,0x95,0x00,0x00,0x7c,0x54,0xc0,0x00,0x00,0x01,
-0xbf,0xa2,0x00,0x03,0x8c,0x70,0x4c,0x91,0x04,0x30,0x25,0x0c,0xf2,0x03,0x52,0x00,
-0x00,0x06,0x66,0xab,0x66,0x62,0x0b,0x44,0x44,0x44,0x95,0x0a,0x6a,0xaa,0xa9,0x75,
-0x4c,0x11,0x10,0xbb,0xd2,0x00,0x42,0x0c,0x01,0xa0,0x00,0x05,0x00,0x97,0x77,0x01,
-0xa0,0x0b,0x1b,0x80,0x00,0xcb,0xb6,0x36,0x09,0x00,0xf1,0x00,0x50,0x0e,0xaa,0xaa,
-0xaa,0xe1,0x44,0x0e,0x90,0xb1,0x01,0x69,0xae,0x99,0x40,0x00,0x62,0x0b,0xaa,0x19,
-0xb0,0x0e,0xaa,0x70,0x00,0xe7,0x0b,0x00,0x00,0x09,0x5b,0x6b,0xb2,0x09,0x37,0x8d,
-0xcb,0xb4,0x97,0x19,0x00,0x18,0x03,0xf0,0x02,0x0d,0xbb,0xac,0xaa,0xd3,0x0b,0x2b,
-0x1c,0x00,0x73,0x00,0x23,0x3c,0x00,0x00,0x01,0x94,0xc9,0x1e,0x01,0xf2,0x03,0xb1,
-0x02,0xd4,0x71,0x00,0x01,0x6c,0x30,0x4b,0x70,0x07,0x50,0x9d,0x00,0x10,0x34,0x19,
-0x00,0xf0,0x14,0xbe,0xaa,0xa3,0x0b,0x05,0x00,0x50,0x74,0x02,0x96,0x15,0x4b,0x30,
-0x09,0x50,0xbb,0x41,0xa0,0x00,0x3b,0x20,0x96,0x00,0x1a,0xfc,0xaa,0xaf,0xc4,0x15,
-0xa1,0x00,0x0b,0x12,0x00,0xa1,0x8c,0x05,0x70,0xab,0xaa,0xad,0x00,0x00,0x00,0x42,
-0x32,0x00,0xf0,0x00,0xcd,0xaa,0xa2,0x0b,0x07,0x00,0x70,0x64,0x02,0xae,0xbb,0xea,
-0x40,0x00,0x06,0x4a,0x0a,0x10,0xca,0xc2,0x09,0xf3,0x05,0xa0,0x83,0x0c,0x00,0x00,
-0xa0,0xb8,0x0c,0x01,0x00,0x17,0x9b,0x00,0x18,0x19,0xb5,0x08,0xaa,0xb4,0x02,0x97,
-0x00,0x11,0x75,0x05,0x00,0x00,0x8b,0x15,0x60,0xdc,0xb7,0x00,0x10,0x00,0x75,0x2c,
-0x06,0x10,0x75,0x85,0x0c,0x10,0x75,0x6c,0x09,0x14,0x75,0x23,0x00,0x26,0x8c,0xd2,
-0x8d,0x02,0xf2,0x1a,0x70,0x49,0x9c,0x60,0x03,0x70,0x25,0x09,0x4b,0xbc,0xd8,0x0b,
-0x2d,0x01,0x03,0x70,0x01,0xd9,0x09,0x33,0x70,0x00,0xc8,0x01,0xa3,0x70,0x06,0x8b,
-0x20,0x43,0x70,0x5b,0x02,0x20,0x03,0x70,0x10,0x00,0x00,0x8c,0x50,0x69,0x12,0xf0,
-0x03,0xca,0xaa,0xab,0x70,0x06,0x94,0x44,0x47,0x70,0x06,0x95,0x55,0x55,0x51,0x03,
-0xb9,0x99,0x9a,0xdb,0x02,0xb0,0x35,0x00,0x1a,0xcb,0xaa,0xcd,0xa6,0x00,0x59,0x00,
-0x46,0x0e,0x13,0x10,0x46,0x99,0x02,0x04,0x30,0x01,0xf7,0x1d,0x84,0x00,0x00,0xa0,
-0x0b,0x77,0xa0,0x01,0xa0,0x0b,0x88,0xa9,0xaa,0xe7,0x0b,0x66,0xa2,0x10,0xa0,0x0a,
-0x22,0xa2,0x90,0xa0,0x3a,0xae,0xa0,0xa2,0xa0,0x00,0x94,0xa0,0x00,0xa0,0x1a,0x50,
-0xa0,0x00,0xa0,0x22,0x2a,0x70,0x5b,0x70,0x62,0x01,0xf0,0x11,0xb0,0x09,0xd9,0x80,
-0x47,0xb3,0x96,0x09,0x60,0x08,0xd0,0x09,0xb6,0x00,0x00,0xb2,0xa7,0x1a,0x00,0x02,
-0xe6,0xbb,0xbe,0xb2,0x3b,0xc0,0x60,0x0b,0x00,0x31,0xb0,0x58,0x3a,0x18,0x10,0x07,
-0x05,0x00,0x01,0x54,0x25,0x05,0x0c,0x03,0xf2,0x09,0x80,0x1a,0x06,0x10,0x01,0xc0,
-0x1a,0x03,0x90,0x06,0x70,0x1a,0x00,0xb2,0x0c,0x10,0x1a,0x00,0x58,0x26,0x00,0x1a,
-0x00,0x0a,0x25,0x03,0x40,0x0a,0xc7,0x00,0x00,0x83,0x02,0x10,0xc0,0xd6,0x04,0x03,
-0x05,0x00,0xb0,0xfb,0xbb,0xbb,0xc0,0x01,0xb0,0x07,0x50,0x00,0x03,0x80,0x37,0x2c,
-0x30,0x50,0x00,0x87,0x93,0x0a,0x30,0x0a,0x81,0x25,0x1d,0x17,0x70,0x0b,0xaa,0xaa,
-0xaa,0xb0,0x0b,0x00,0x72,0x05,0xf1,0x12,0xaa,0xaa,0xbc,0x70,0x0b,0x27,0xac,0x83,
-0x00,0x0b,0x12,0x2c,0x69,0x40,0x0b,0x5a,0x9d,0x31,0x20,0x0b,0x25,0x7e,0xaa,0x80,
-0x38,0x65,0x3b,0x00,0x42,0x92,0x00,0x0a,0xaa,0xe4,0x03,0x00,0x24,0x0e,0x70,0xad,
-0x20,0xa1,0x00,0x00,0x82,0x0a,0x12,0x0c,0xf0,0x0c,0xb7,0x66,0x66,0x66,0x0c,0x33,
-0x33,0x33,0xc0,0xb0,0xd9,0x9a,0x0b,0x29,0x0a,0x00,0xa0,0xb8,0x30,0xe9,0x96,0x2a,
-0x50,0x01,0x00,0x8b,0x40,0x5b,0x00,0x30,0xc0,0x0b,0x00,0x1e,0x01,0xf3,0x12,0xab,
-0xba,0xac,0x80,0x0b,0x04,0x60,0x0b,0x00,0x0b,0x5a,0xea,0xad,0xa0,0x0b,0x00,0xb0,
-0x19,0x00,0x0b,0x8b,0xda,0xbd,0xa3,0x48,0x0a,0x30,0x19,0x00,0x82,0x96,0x00,0x19,
-0x01,0x18,0x00,0x8d,0x00,0x00,0xe5,0x02,0xf2,0x15,0xb0,0x0c,0x68,0xa6,0xc6,0x50,
-0x0b,0x6b,0xd9,0xe9,0x90,0x0b,0x02,0x80,0xb0,0x00,0x0b,0x9d,0xbc,0xba,0xa2,0x1a,
-0x0b,0x03,0x7a,0x40,0x66,0x0c,0x58,0x69,0x20,0x70,0x29,0x51,0x01,0x82,0x81,0x09,
-0x4d,0xbb,0xce,0xbb,0xb2,0x5e,0x23,0x04,0x05,0x00,0x02,0x48,0x04,0x10,0x04,0xdf,
-0x09,0x00,0xb7,0x0b,0x20,0x5b,0xbe,0x86,0x0b,0x15,0x29,0x48,0x02,0x60,0xca,0xbd,
-0xcb,0x90,0x03,0x90,0x3c,0x0d,0x50,0x20,0x09,0x20,0x00,0x87,0xce,0x0c,0xf0,0x24,
-0x50,0x9b,0xbe,0xcb,0xb3,0x00,0x13,0x00,0x05,0x00,0x02,0x4c,0x33,0x89,0x30,0x05,
-0x77,0xba,0x77,0x71,0x02,0xaa,0xdc,0xaa,0x70,0x02,0x22,0xc2,0x22,0x21,0x18,0x8d,
-0xa8,0x88,0x84,0x00,0x3e,0xba,0xaa,0x90,0x05,0xc1,0x03,0x80,0x00,0x1a,0x69,0x9a,
-0xc9,0x95,0x00,0xa9,0x0d,0x42,0x3b,0xbb,0xbb,0xbe,0xe0,0x0f,0x10,0x06,0x05,0x00,
-0x96,0x0b,0x99,0x99,0x9e,0x00,0x0b,0x21,0x11,0x17,0x66,0x21,0x10,0x82,0x0a,0x10,
-0x62,0xb1,0x06,0xcb,0xbb,0xbc,0x80,0xf3,0x08,0x20,0x01,0xb0,0xf3,0x08,0xf1,0x09,
-0xdb,0xbb,0xb6,0x00,0x1c,0x04,0x00,0x00,0x00,0x96,0x1b,0x21,0x10,0x07,0xfb,0x9e,
-0xa9,0xe0,0x39,0x83,0x0a,0x00,0xb0,0x00,0x05,0x00,0x40,0x72,0x0a,0x2a,0x80,0xea,
-0x08,0x01,0x21,0x1a,0xf0,0x03,0x00,0x03,0x99,0x44,0xb6,0x00,0x02,0x5a,0xdb,0xa3,
-0x00,0x08,0x58,0x60,0x18,0x10,0x6a,0xbe,0x75,0x18,0xf0,0x07,0xc3,0x37,0x00,0x00,
-0x2b,0xea,0xbd,0xac,0x50,0x52,0xb0,0x37,0x05,0x50,0x00,0xb0,0x37,0x6b,0x30,0x00,
-0x00,0x37,0xc3,0x07,0xf1,0x17,0x28,0x0a,0x10,0x2a,0xda,0xbd,0xad,0xa6,0x00,0x71,
-0x26,0x08,0x10,0x0e,0xaa,0xbd,0xaa,0xc6,0x0b,0x00,0x39,0x00,0x56,0x00,0xd9,0xbd,
-0x9b,0x70,0x00,0xb0,0x38,0x04,0x70,0x00,0xa0,0x38,0x4b,0x30,0x96,0x06,0xf1,0x1a,
-0x08,0x00,0x01,0xb4,0x36,0xb6,0x30,0x1b,0x54,0xaa,0x29,0xaa,0xbb,0x59,0x80,0x9a,
-0x06,0x55,0x98,0x09,0xa0,0xa5,0x59,0x80,0x9a,0x0a,0x55,0x68,0x83,0x74,0x73,0x40,
-0x80,0x03,0xc5,0x90,0x08,0x06,0xa1,0x03,0x90,0xff,0x01,0xf0,0x17,0x00,0xa0,0x92,
-0x0a,0xb9,0x9c,0x8b,0x93,0xb3,0x88,0x88,0x66,0x43,0x64,0x00,0x0b,0x21,0x03,0x88,
-0xd8,0x60,0x03,0xaa,0xae,0xaa,0x70,0x56,0x00,0xb0,0x1a,0x05,0x60,0x0b,0x39,0x90,
-0x00,0x00,0xb0,0x5e,0x1c,0xa1,0xb9,0x99,0xd1,0x5b,0xd8,0xa5,0x77,0xa1,0x83,0x98,
-0x05,0x00,0xf2,0x49,0x41,0x22,0x40,0x83,0x98,0x7a,0x99,0xc0,0x83,0x99,0x79,0x88,
-0xc0,0x52,0xa5,0x79,0x77,0xc0,0x02,0x90,0x74,0x11,0xb0,0x02,0x90,0x7a,0x99,0xb0,
-0x01,0x90,0x99,0x99,0x92,0x5b,0xd8,0x79,0x99,0x80,0x82,0x99,0x90,0x00,0xa0,0x82,
-0x99,0x69,0x99,0x70,0x82,0x99,0x99,0x99,0x91,0x82,0x99,0x80,0xa0,0x81,0x52,0xa5,
-0xc9,0xd9,0xd1,0x01,0x90,0x80,0xa0,0x81,0x01,0x90,0xc9,0x99,0xd1,0x19,0x9e,0x99,
-0xcb,0x95,0x00,0x78,0x77,0x87,0x40,0x00,0xc4,0x44,0x46,0x80,0x05,0x00,0xf2,0x09,
-0x7a,0xc7,0x77,0x40,0x29,0xcd,0xaa,0xad,0xa6,0x2b,0xe9,0xad,0x9d,0xc6,0x02,0xa0,
-0x28,0x08,0x31,0x00,0xa0,0x28,0x4b,0x00,0x7d,0x07,0xe3,0x50,0x29,0x03,0x30,0x00,
-0x92,0x29,0x0b,0x10,0x00,0x35,0x29,0x27,0x00,0x09,0x12,0x18,0x39,0x57,0x24,0x03,
-0x05,0x00,0x02,0xfc,0x04,0xf0,0x04,0x1c,0x00,0x01,0x1b,0x21,0x86,0x10,0x08,0x9e,
-0x99,0xcc,0x93,0x00,0x0c,0x00,0x56,0x00,0x2a,0xae,0x13,0x1c,0x30,0x2b,0x00,0x66,
-0xba,0x05,0x10,0x56,0xa5,0x1a,0x42,0x56,0x00,0x0c,0x30,0x02,0x06,0x03,0x9d,0x0c,
-0xf0,0x15,0x03,0x33,0x5c,0x33,0x31,0x0c,0x77,0x77,0x77,0x73,0x0b,0x19,0x99,0xad,
-0x20,0x0b,0x01,0x86,0x92,0x00,0x0b,0x69,0x9e,0xd9,0x92,0x0b,0x00,0x0c,0x03,0xc0,
-0x0a,0x00,0x0b,0x07,0x20,0x56,0x0b,0x02,0x35,0x71,0x04,0xab,0x04,0x04,0x12,0x02,
-0x93,0x1a,0x01,0xd2,0x0f,0x20,0xb4,0x0b,0x74,0x20,0xf0,0x0d,0x0b,0x28,0x0b,0x03,
-0xa0,0x0b,0x0b,0x0a,0x18,0x30,0x0b,0x08,0x35,0x3b,0x00,0x1a,0x01,0x10,0x74,0x00,
-0x66,0x89,0x99,0xea,0x95,0x31,0x11,0x11,0x15,0x25,0x10,0x06,0x7e,0x1a,0xe0,0x9e,
-0x99,0x94,0x0b,0x11,0x61,0x16,0x10,0x0b,0x79,0xe9,0x9e,0x93,0x0b,0x2d,0x09,0xf0,
-0x0a,0x0b,0x00,0xa9,0x98,0x00,0x0b,0x59,0x99,0x9a,0x50,0x1b,0x02,0xb2,0x4b,0x10,
-0x56,0x03,0x7e,0xe5,0x10,0x52,0x96,0x30,0x15,0x94,0x84,0x0e,0x80,0x60,0x5a,0xe1,
-0xaa,0xe6,0x20,0x02,0x90,0x56,0x0b,0xf0,0x0b,0x20,0x60,0xb1,0x10,0x1c,0xb7,0xa0,
-0xb8,0x81,0x02,0x65,0xa0,0xb0,0x00,0x0b,0xa1,0xa0,0xb0,0x00,0x07,0xc0,0x8a,0xba,
-0xa2,0x09,0xd7,0x1d,0x25,0x51,0x07,0xbb,0xbb,0xb2,0x10,0x5d,0x14,0xf3,0x1b,0xe3,
-0x9b,0xb9,0x40,0x01,0x93,0x38,0x75,0xa0,0x07,0x35,0x69,0x97,0xb1,0x09,0xd4,0x9b,
-0xb9,0x60,0x02,0xa2,0x7a,0xa7,0x50,0x08,0xa1,0x27,0x72,0x10,0x08,0x78,0x9b,0xb9,
-0x90,0x0a,0xc4,0x04,0x40,0x00,0x56,0x18,0xba,0x5a,0x1b,0x70,0x09,0xbe,0xbb,0xcd,
-0xb4,0x00,0x0b,0x82,0x08,0x05,0x05,0x00,0x90,0x2b,0xbe,0xbb,0xcd,0xb7,0x00,0x1b,
-0x00,0x47,0x36,0x01,0xb3,0x47,0x00,0x02,0xd0,0x00,0x47,0x00,0x0b,0x20,0x00,0x47,
-0x52,0x16,0x00,0x6b,0x05,0xf0,0x04,0x05,0x84,0x44,0x47,0x70,0x05,0x95,0x55,0x55,
-0x42,0x03,0xc8,0x88,0x88,0xc3,0x00,0x02,0x11,0x22,0x8a,0x01,0xe3,0x47,0x00,0x2a,
-0xcc,0xaa,0xbd,0xa7,0x01,0xc1,0x00,0x47,0x00,0x0c,0x40,0x32,0x00,0x00,0x36,0x03,
-0x71,0xa4,0x80,0x2b,0xbb,0xbc,0xeb,0xc7,0x73,0x10,0x90,0x01,0x11,0x10,0xc0,0x00,
-0x08,0xae,0xa5,0xb0,0x96,0x02,0x10,0x83,0x05,0x00,0xd0,0x48,0x04,0x02,0x6e,0xb8,
-0x0c,0x0a,0x09,0x52,0x00,0x04,0xd7,0x7b,0x47,0x13,0xf2,0x10,0x01,0xa0,0x0b,0x4b,
-0xbb,0xa0,0x0b,0x83,0x00,0x00,0x0b,0xca,0xaa,0x70,0x0b,0x00,0x03,0x90,0x0b,0x00,
-0x03,0x80,0x0b,0x00,0x06,0x60,0x0b,0x05,0xbc,0x10,0x0b,0xd0,0x04,0x31,0xb8,0xaa,
-0xe0,0x60,0x0c,0x60,0x0d,0xaa,0x78,0xba,0xa0,0x0b,0x07,0x04,0xf3,0x0a,0x09,0xaa,
-0xc6,0xaa,0xd1,0x09,0x92,0xb5,0xa4,0xa0,0x00,0x4a,0xa0,0x2a,0xe0,0x1b,0x75,0x88,
-0x92,0xb0,0x00,0x8b,0x30,0x69,0x90,0x56,0x07,0x60,0x20,0x02,0x20,0x6a,0xe0,0x38,
-0x7a,0x24,0xf1,0x0d,0x49,0x5c,0x40,0x5a,0xe0,0xc5,0xd5,0xc0,0x72,0x00,0xd7,0xd7,
-0xc0,0x8b,0xa0,0xc5,0xd5,0xc0,0x00,0xb0,0x44,0xd4,0x40,0x00,0xb8,0xaa,0xea,0xa3,
-0xb4,0x0c,0x24,0x3b,0x70,0xf0,0x20,0xf1,0x1f,0x4a,0xac,0x6b,0x99,0xd0,0x00,0x0a,
+0x17,0x65,0xe9,0x99,0x99,0x9b,0x50,0x64,0x02,0xf0,0x0b,0x02,0xa0,0x00,0x00,0x1b,
+0xbd,0xcb,0xbb,0xb6,0x00,0x2b,0x00,0x10,0x00,0x00,0xb3,0x00,0xb0,0x00,0x0a,0xe0,
+0xbb,0xeb,0xb1,0x27,0xb0,0x7b,0x03,0x06,0x05,0x00,0x60,0xb5,0xbb,0xeb,0xb6,0x00,
+0x00,0x23,0x00,0x10,0x0a,0x97,0x03,0xf0,0x15,0x00,0xa0,0x81,0xa1,0x33,0x03,0xbe,
+0x98,0x5d,0xb7,0x90,0x00,0xa3,0xd8,0xb0,0x29,0x00,0x0a,0x19,0x1a,0x02,0x80,0x01,
+0xda,0x81,0xa4,0xb5,0x03,0xe8,0x08,0x18,0x00,0x20,0x12,0x00,0x82,0x0b,0x02,0x42,
+0x04,0xca,0xab,0x90,0x48,0x04,0x32,0x90,0x00,0x29,0x05,0x00,0x30,0x4a,0xd8,0x84,
+0x0a,0x00,0x50,0x84,0x2e,0xb8,0x01,0x90,0x0a,0x00,0xf2,0x04,0xca,0x84,0x29,0x00,
+0x4c,0x71,0x84,0x29,0x00,0x10,0x01,0x95,0x3a,0x11,0x00,0x07,0x99,0x99,0x98,0x32,
+0x00,0xf5,0x1c,0xa0,0x05,0x70,0x00,0x01,0xa0,0x0d,0xa9,0x97,0x3b,0xe9,0xa3,0x00,
+0x0a,0x01,0xa0,0x48,0x40,0x0a,0x01,0xa0,0x00,0xa3,0x19,0x01,0xa7,0x10,0x29,0x58,
+0x08,0xd4,0x29,0xa1,0x37,0x26,0x00,0x53,0x00,0x55,0x00,0x00,0x00,0x6a,0xaf,0x04,
+0x00,0x9a,0x00,0x00,0xaf,0x00,0xb1,0xa0,0x79,0xe9,0x90,0x2b,0xe8,0x00,0xb0,0xb0,
+0x00,0xa0,0x05,0x00,0xf0,0x22,0xbb,0xfb,0xd8,0x01,0xd9,0x06,0xb7,0x00,0x3c,0x60,
+0x0c,0x1b,0x10,0x00,0x01,0xb5,0x03,0xc2,0x00,0x07,0x30,0x00,0x27,0x07,0xea,0xe7,
+0x63,0x91,0x00,0xa0,0xb0,0x63,0x91,0x0a,0xea,0xea,0x63,0x91,0x02,0x90,0xb0,0x21,
+0x91,0x0a,0x10,0xa1,0x09,0xb0,0x00,0x31,0x05,0xf1,0x0f,0x02,0xaa,0xbe,0xaa,0x70,
+0x00,0x00,0x2a,0x00,0x00,0x2a,0xaa,0xaa,0xaa,0xa7,0x02,0xc2,0x22,0x77,0x10,0x16,
+0xd6,0x66,0xa9,0x50,0x00,0xb8,0x88,0xb5,0x00,0x05,0x00,0xf2,0x0a,0x7a,0xea,0xaa,
+0xcc,0xa3,0x02,0xb0,0x10,0x3a,0x00,0x6c,0x89,0xda,0x96,0xc2,0x30,0x00,0x91,0x00,
+0x10,0x09,0x99,0xda,0x99,0x50,0x58,0x04,0xf3,0x03,0x02,0x45,0xc4,0x41,0x0a,0x01,
+0x69,0x96,0x51,0x8e,0xb2,0xc5,0x55,0xa0,0x0a,0x00,0xc7,0x77,0x05,0x00,0xf1,0x04,
+0x41,0xc7,0x77,0xa0,0x6c,0x79,0xda,0xaa,0xd5,0x20,0x01,0x96,0x09,0x60,0x00,0x08,
+0x20,0x00,0x62,0x32,0x00,0xf0,0x1f,0x91,0x08,0x40,0xa0,0x09,0x17,0x87,0xb8,0x77,
+0xdb,0xa5,0x29,0x79,0x09,0x19,0x26,0xb4,0x90,0x91,0x35,0x55,0x53,0x09,0x42,0xd9,
+0x9d,0x16,0xb7,0x2d,0x77,0xc1,0x10,0x01,0xd8,0x8c,0x10,0x00,0x1a,0x00,0x91,0x0a,
+0xaa,0xbd,0xaa,0xa4,0x00,0x11,0x03,0x10,0x04,0xc6,0x05,0xf0,0x06,0x02,0x99,0x99,
+0x99,0x80,0x04,0x70,0x28,0x00,0xb0,0x05,0xc8,0xac,0x88,0xc0,0x08,0x41,0x11,0x11,
+0x80,0x1c,0x50,0x00,0x12,0x23,0x4b,0x01,0x11,0x50,0x17,0x06,0xf3,0x15,0xaa,0xa4,
+0x00,0x04,0xcc,0x40,0x6b,0x00,0x00,0x50,0x1d,0xdb,0x00,0x00,0x16,0x9c,0x73,0x8d,
+0xc8,0x11,0x6c,0xaa,0xaa,0xa9,0x40,0x00,0xb0,0x0b,0x00,0xc0,0x00,0x0e,0x99,0xe9,
+0x9c,0x00,0x0b,0x00,0x60,0xaa,0xea,0xac,0x00,0x00,0x41,0x3b,0x00,0xf2,0x1d,0xea,
+0x99,0x99,0x70,0x1b,0x53,0x33,0x33,0x00,0x23,0xc5,0x55,0x5c,0x00,0x00,0xc8,0x88,
+0x8d,0x00,0x00,0xab,0x88,0x8b,0x00,0x00,0x6d,0x99,0x97,0x00,0x09,0x8a,0x23,0xb3,
+0x00,0x02,0x48,0xee,0x84,0x10,0x59,0x73,0x00,0x47,0x91,0x81,0x01,0xf0,0x14,0xb0,
+0x00,0xc0,0x00,0x02,0xeb,0xc2,0xc0,0x00,0x08,0x30,0xc0,0xc1,0x00,0x2b,0x21,0xc0,
+0xdc,0x30,0x33,0xba,0x70,0xc1,0xc3,0x00,0x0e,0x10,0xc0,0x12,0x00,0x87,0x00,0xc0,
+0x00,0x07,0x23,0x00,0x12,0x49,0xab,0x05,0x10,0x51,0xcd,0x03,0xf1,0x19,0xfa,0xa8,
+0x00,0x03,0xb6,0x00,0xb3,0x00,0x04,0x18,0x8c,0x40,0x00,0x01,0x5b,0xa7,0xa0,0x00,
+0x0b,0x72,0x6c,0xaa,0xe2,0x00,0x5c,0x91,0x06,0x70,0x00,0x40,0x1b,0xa8,0x00,0x00,
+0x36,0xba,0x30,0x00,0x0b,0x85,0x60,0x00,0x13,0x39,0xa6,0x06,0x30,0x1b,0xbb,0xdd,
+0x5b,0x07,0x10,0x9e,0xf8,0x06,0xf0,0x04,0xc4,0x90,0x00,0x00,0x07,0x70,0xb1,0x00,
+0x00,0x4c,0x00,0x3c,0x10,0x09,0xb0,0x00,0x05,0xd4,0x05,0xfe,0x00,0x51,0x08,0xbb,
+0xbb,0xbb,0xb1,0x27,0x01,0x01,0x32,0x00,0xf0,0x0a,0x0b,0xbb,0xdd,0xbb,0xb6,0x00,
+0x00,0xad,0x10,0x00,0x00,0x02,0xc2,0x80,0x00,0x00,0x2c,0x20,0x87,0x00,0x08,0xc2,
+0x00,0x08,0xb4,0x2d,0x00,0x1d,0x24,0x5a,0x00,0x10,0x8e,0x5a,0x00,0xf0,0x0a,0xc3,
+0xa0,0x00,0x00,0x05,0x80,0xb2,0x00,0x00,0x2d,0x90,0x3c,0x00,0x06,0xc2,0x5b,0x05,
+0xc2,0x18,0x00,0x05,0x10,0x36,0x00,0x82,0x55,0x00,0xf0,0x02,0xeb,0xce,0xbb,0x90,
+0x09,0x40,0x38,0x00,0x00,0x06,0x00,0x47,0x00,0x00,0x2b,0xbb,0xde,0x37,0x00,0xf1,
+0x03,0xc9,0x50,0x00,0x00,0x08,0x80,0xc2,0x00,0x03,0xb8,0x00,0x2c,0x61,0x19,0x20,
+0x00,0x00,0x67,0x4e,0x02,0xf5,0x04,0x09,0xbb,0xce,0xbb,0xb3,0x00,0x90,0x39,0x09,
+0x10,0x00,0x55,0x47,0x38,0x00,0x1b,0xcc,0xdd,0xcc,0x2d,0x00,0x90,0xb2,0x00,0x04,
+0xb8,0x00,0x2b,0x92,0x18,0x20,0xe0,0x08,0x00,0x01,0x00,0xf7,0x1d,0x07,0x40,0x25,
+0x55,0x40,0x1a,0x21,0x24,0x4a,0x90,0x7e,0x9d,0x00,0x3a,0x00,0x19,0x0b,0x00,0x92,
+0x00,0x56,0x19,0xab,0xec,0xb3,0x3c,0x94,0x00,0x92,0x00,0x03,0xf4,0x00,0x92,0x00,
+0x0b,0x4b,0x00,0x92,0x00,0x94,0x00,0x0a,0xc1,0xfc,0x02,0xf0,0x2c,0x03,0x80,0x00,
+0xb0,0x00,0x06,0x61,0x07,0x44,0x20,0x4d,0x9d,0x1a,0x01,0xb0,0x0a,0x0a,0xbc,0xbb,
+0xc5,0x0a,0x19,0x10,0x00,0x12,0x1b,0x95,0x4c,0x99,0xe0,0x00,0xd8,0x45,0x00,0xb0,
+0x1b,0x44,0x5b,0x88,0xd0,0x37,0x00,0x47,0x11,0xb0,0x02,0xbb,0xbb,0xbb,0x70,0x00,
+0x00,0x00,0x6b,0x10,0x00,0x00,0x0b,0x70,0xdc,0x06,0x00,0xc3,0x00,0x31,0xce,0xbb,
+0xb8,0x0a,0x00,0x03,0x05,0x00,0x10,0x2a,0x73,0x06,0x10,0xc6,0x0a,0x00,0xf0,0x10,
+0x50,0x00,0x00,0x28,0x88,0xbb,0x88,0x80,0x59,0x22,0x22,0x22,0xc0,0x35,0x7b,0xbb,
+0xb4,0x80,0x00,0x00,0x06,0xa0,0x00,0x00,0x00,0x68,0x00,0x00,0x5b,0xbb,0xdc,0x66,
+0x07,0x01,0xa4,0x09,0x10,0x74,0xf9,0x02,0x10,0xc2,0x0a,0x00,0x10,0x20,0x60,0x04,
+0x60,0x90,0x00,0x00,0x1b,0xbe,0xbb,0x60,0x04,0x00,0x13,0x00,0xf3,0x04,0xb3,0x6a,
+0xad,0xb0,0x0b,0xd0,0x00,0x67,0x00,0x35,0xb4,0xbb,0xeb,0xb8,0x00,0xb0,0x00,0xa1,
+0x00,0x05,0x00,0x23,0x2a,0xc0,0xc4,0x00,0xf2,0x18,0x10,0x30,0x00,0x20,0x01,0xb0,
+0x57,0x08,0x50,0x0a,0xda,0xad,0xae,0xa5,0x09,0x00,0x00,0x00,0x47,0x02,0x7a,0xaa,
+0xf9,0x11,0x00,0x00,0x2b,0x50,0x00,0x1a,0xaa,0xcd,0xaa,0xa7,0x00,0x00,0x56,0x00,
+0x00,0x05,0x00,0x20,0x1b,0xc4,0xf6,0x00,0x02,0x2c,0x07,0x00,0x6b,0x05,0x00,0x2b,
+0x05,0xf2,0x09,0x08,0x10,0x03,0x30,0x0a,0x25,0xba,0x30,0x0a,0xb6,0x10,0x00,0x0a,
+0x10,0x00,0x03,0x0a,0x20,0x00,0x0c,0x05,0xcb,0xbb,0xd6,0x60,0x00,0x00,0x8e,0x01,
+0xf0,0x14,0x0c,0xaa,0xaa,0xaa,0xd4,0x0b,0x00,0xa0,0x00,0x84,0x0b,0xbc,0xeb,0xbb,
+0xb5,0x00,0x2b,0x00,0x95,0x00,0x00,0x7c,0x54,0xc0,0x00,0x00,0x01,0xbf,0xa2,0x00,
+0x03,0x8c,0x70,0x4c,0x91,0xa3,0x08,0xf1,0x07,0x40,0x00,0x00,0x52,0x00,0x00,0x06,
+0x66,0xab,0x66,0x62,0x0b,0x44,0x44,0x44,0x95,0x0a,0x6a,0xaa,0xa9,0x75,0x00,0x29,
+0x09,0x10,0xbb,0xd2,0x00,0x42,0x0c,0x01,0xa0,0x00,0x05,0x00,0x97,0x77,0x01,0xa0,
+0x0b,0x1b,0x80,0x00,0xcb,0xb6,0x36,0x09,0x00,0xf1,0x00,0xf0,0x02,0x0e,0xaa,0xaa,
+0xaa,0xe1,0x0b,0x01,0x11,0x11,0xb1,0x01,0x69,0xae,0x99,0x40,0x00,0x62,0x1e,0x07,
+0xc0,0xc1,0x0e,0xaa,0x70,0x00,0xe7,0x0b,0x00,0x00,0x09,0x5b,0x6b,0xb2,0x09,0x37,
+0x8d,0xcb,0xb4,0xc3,0x01,0x00,0x18,0x03,0xf2,0x05,0x0d,0xbb,0xac,0xaa,0xd3,0x0b,
+0x2b,0x1c,0x00,0x73,0x00,0x23,0x3c,0x00,0x00,0x01,0x94,0x0b,0x00,0x00,0xf2,0x03,
+0xb1,0x02,0xd4,0x71,0x00,0x01,0x6c,0x30,0x4b,0x70,0x07,0x50,0x9d,0x00,0x10,0x34,
+0x19,0x00,0xf0,0x14,0xbe,0xaa,0xa3,0x0b,0x05,0x00,0x50,0x74,0x02,0x96,0x15,0x4b,
+0x30,0x09,0x50,0xbb,0x41,0xa0,0x00,0x3b,0x20,0x96,0x00,0x1a,0xfc,0xaa,0xaf,0xc4,
+0x15,0xa1,0x00,0x0b,0x12,0x00,0xa1,0x8c,0x05,0x70,0xab,0xaa,0xad,0x00,0x00,0x00,
+0x42,0x32,0x00,0xf0,0x00,0xcd,0xaa,0xa2,0x0b,0x07,0x00,0x70,0x64,0x02,0xae,0xbb,
+0xea,0x40,0x00,0x06,0x4a,0x0a,0x10,0xca,0xc2,0x09,0xf3,0x05,0xa0,0x83,0x0c,0x00,
+0x00,0xa0,0xb8,0x0c,0x01,0x00,0x17,0x9b,0x00,0x18,0x19,0xb5,0x08,0xaa,0xb4,0x02,
+0x97,0x00,0x12,0x75,0x05,0x00,0x70,0x2b,0xbb,0xbb,0xdc,0xb7,0x00,0x10,0x0f,0x00,
+0x10,0xb3,0x05,0x00,0x30,0x1c,0x00,0x75,0x6c,0x09,0x14,0x75,0x23,0x00,0x26,0x8c,
+0xd2,0x8d,0x02,0xf2,0x19,0x70,0x49,0x9c,0x60,0x03,0x70,0x25,0x09,0x4b,0xbc,0xd8,
+0x0b,0x2d,0x01,0x03,0x70,0x01,0xd9,0x09,0x33,0x70,0x00,0xc8,0x01,0xa3,0x70,0x06,
+0x8b,0x20,0x43,0x70,0x5b,0x02,0x20,0x03,0x70,0x10,0x00,0x00,0x8c,0x2d,0x05,0xf0,
+0x04,0x06,0xca,0xaa,0xab,0x70,0x06,0x94,0x44,0x47,0x70,0x06,0x95,0x55,0x55,0x51,
+0x03,0xb9,0x99,0x9a,0xdb,0x02,0xf0,0x01,0x35,0x00,0x1a,0xcb,0xaa,0xcd,0xa6,0x00,
+0x59,0x00,0x46,0x00,0x00,0x08,0x40,0x46,0x99,0x02,0x04,0x30,0x01,0xf7,0x1d,0x84,
+0x00,0x00,0xa0,0x0b,0x77,0xa0,0x01,0xa0,0x0b,0x88,0xa9,0xaa,0xe7,0x0b,0x66,0xa2,
+0x10,0xa0,0x0a,0x22,0xa2,0x90,0xa0,0x3a,0xae,0xa0,0xa2,0xa0,0x00,0x94,0xa0,0x00,
+0xa0,0x1a,0x50,0xa0,0x00,0xa0,0x22,0x2a,0x70,0x5b,0x70,0x62,0x01,0xf0,0x17,0xb0,
+0x09,0xd9,0x80,0x47,0xb3,0x96,0x09,0x60,0x08,0xd0,0x09,0xb6,0x00,0x00,0xb2,0xa7,
+0x1a,0x00,0x02,0xe6,0xbb,0xbe,0xb2,0x3b,0xc0,0x60,0x0b,0x00,0x31,0xb0,0x58,0x0b,
+0x00,0x00,0xb0,0x07,0x0b,0x99,0x02,0x27,0xbb,0x00,0x0c,0x03,0xf2,0x09,0x80,0x1a,
+0x06,0x10,0x01,0xc0,0x1a,0x03,0x90,0x06,0x70,0x1a,0x00,0xb2,0x0c,0x10,0x1a,0x00,
+0x58,0x26,0x00,0x1a,0x00,0x0a,0x25,0x03,0x40,0x0a,0xc7,0x00,0x00,0x83,0x02,0x10,
+0xc0,0xd6,0x04,0x03,0x05,0x00,0xf0,0x03,0xfb,0xbb,0xbb,0xc0,0x01,0xb0,0x07,0x50,
+0x00,0x03,0x80,0x01,0xd0,0x00,0x07,0x50,0x00,0x87,0x93,0x0a,0xe0,0x0a,0x81,0x25,
+0x00,0x00,0x00,0x55,0x0b,0xaa,0xaa,0xaa,0xb0,0x0b,0x00,0x72,0x05,0xf2,0x13,0xaa,
+0xaa,0xbc,0x70,0x0b,0x27,0xac,0x83,0x00,0x0b,0x12,0x2c,0x69,0x40,0x0b,0x5a,0x9d,
+0x31,0x20,0x0b,0x25,0x7e,0xaa,0x80,0x38,0x65,0x3b,0x00,0x42,0x92,0x00,0x0a,0xaa,
+0xc1,0x4f,0x06,0x90,0xaa,0xaa,0xad,0x20,0xa1,0x00,0x00,0x82,0x0a,0x12,0x0c,0xf0,
+0x0c,0xb7,0x66,0x66,0x66,0x0c,0x33,0x33,0x33,0xc0,0xb0,0xd9,0x9a,0x0b,0x29,0x0a,
+0x00,0xa0,0xb8,0x30,0xe9,0x96,0x2a,0x50,0x01,0x00,0x8b,0x40,0x5b,0x00,0x30,0xc0,
+0x0b,0x00,0x1e,0x01,0xf2,0x12,0xab,0xba,0xac,0x80,0x0b,0x04,0x60,0x0b,0x00,0x0b,
+0x5a,0xea,0xad,0xa0,0x0b,0x00,0xb0,0x19,0x00,0x0b,0x8b,0xda,0xbd,0xa3,0x48,0x0a,
+0x30,0x19,0x00,0x82,0x96,0x00,0x19,0x13,0x01,0x01,0x8d,0x00,0x00,0xe5,0x02,0xf2,
+0x15,0xb0,0x0c,0x68,0xa6,0xc6,0x50,0x0b,0x6b,0xd9,0xe9,0x90,0x0b,0x02,0x80,0xb0,
+0x00,0x0b,0x9d,0xbc,0xba,0xa2,0x1a,0x0b,0x03,0x7a,0x40,0x66,0x0c,0x58,0x69,0x20,
+0x70,0x29,0x51,0x01,0x82,0x81,0x09,0x43,0xbb,0xce,0xbb,0xb2,0x33,0x05,0x0e,0x05,
+0x00,0x02,0x48,0x04,0x10,0x04,0xdf,0x09,0x00,0xb7,0x0b,0x20,0x5b,0xbe,0x86,0x0b,
+0x15,0x29,0x48,0x02,0x60,0xca,0xbd,0xcb,0x90,0x03,0x90,0x3c,0x0d,0x50,0x20,0x09,
+0x20,0x00,0x87,0xce,0x0c,0xf0,0x24,0x50,0x9b,0xbe,0xcb,0xb3,0x00,0x13,0x00,0x05,
+0x00,0x02,0x4c,0x33,0x89,0x30,0x05,0x77,0xba,0x77,0x71,0x02,0xaa,0xdc,0xaa,0x70,
+0x02,0x22,0xc2,0x22,0x21,0x18,0x8d,0xa8,0x88,0x84,0x00,0x3e,0xba,0xaa,0x90,0x05,
+0xc1,0x03,0x80,0x00,0x1a,0x69,0x9a,0xc9,0x95,0x00,0xa9,0x0d,0x41,0x3b,0xbb,0xbb,
+0xbe,0x0e,0x0c,0x20,0x00,0x06,0x05,0x00,0x92,0x0b,0x99,0x99,0x9e,0x00,0x0b,0x21,
+0x11,0x17,0x17,0x0b,0x00,0x05,0x00,0xb2,0x82,0x0b,0x10,0x00,0x00,0xb1,0x06,0xcb,
+0xbb,0xbc,0x80,0xf3,0x08,0x20,0x01,0xb0,0xf3,0x08,0xf1,0x09,0xdb,0xbb,0xb6,0x00,
+0x1c,0x04,0x00,0x00,0x00,0x96,0x1b,0x21,0x10,0x07,0xfb,0x9e,0xa9,0xe0,0x39,0x83,
+0x0a,0x00,0xb0,0x00,0x05,0x00,0x50,0x72,0x0a,0x2a,0x80,0x00,0xe8,0x08,0x00,0xc2,
+0x04,0xf0,0x1d,0x00,0x03,0x99,0x44,0xb6,0x00,0x02,0x5a,0xdb,0xa3,0x00,0x08,0x58,
+0x60,0x18,0x10,0x6a,0xbe,0xaa,0xaa,0xa1,0x00,0xc3,0x37,0x00,0x00,0x2b,0xea,0xbd,
+0xac,0x50,0x52,0xb0,0x37,0x05,0x50,0x00,0xb0,0x37,0x6b,0x30,0x00,0x00,0x37,0xc3,
+0x07,0xf1,0x17,0x28,0x0a,0x10,0x2a,0xda,0xbd,0xad,0xa6,0x00,0x71,0x26,0x08,0x10,
+0x0e,0xaa,0xbd,0xaa,0xc6,0x0b,0x00,0x39,0x00,0x56,0x00,0xd9,0xbd,0x9b,0x70,0x00,
+0xb0,0x38,0x04,0x70,0x00,0xa0,0x38,0x4b,0x30,0x96,0x06,0xf1,0x1a,0x08,0x00,0x01,
+0xb4,0x36,0xb6,0x30,0x1b,0x54,0xaa,0x29,0xaa,0xbb,0x59,0x80,0x9a,0x06,0x55,0x98,
+0x09,0xa0,0xa5,0x59,0x80,0x9a,0x0a,0x55,0x68,0x83,0x74,0x73,0x40,0x80,0x03,0xc5,
+0x90,0x08,0x06,0xa1,0x03,0x90,0xff,0x01,0xf0,0x19,0x00,0xa0,0x92,0x0a,0xb9,0x9c,
+0x8b,0x93,0xb3,0x88,0x88,0x66,0x43,0x64,0x00,0x0b,0x21,0x03,0x88,0xd8,0x60,0x03,
+0xaa,0xae,0xaa,0x70,0x56,0x00,0xb0,0x1a,0x05,0x60,0x0b,0x39,0x90,0x00,0x00,0xb0,
+0x10,0x00,0xc1,0x02,0x90,0xb9,0x99,0xd1,0x5b,0xd8,0xa5,0x77,0xa1,0x83,0x98,0x05,
+0x00,0xf2,0x49,0x41,0x22,0x40,0x83,0x98,0x7a,0x99,0xc0,0x83,0x99,0x79,0x88,0xc0,
+0x52,0xa5,0x79,0x77,0xc0,0x02,0x90,0x74,0x11,0xb0,0x02,0x90,0x7a,0x99,0xb0,0x01,
+0x90,0x99,0x99,0x92,0x5b,0xd8,0x79,0x99,0x80,0x82,0x99,0x90,0x00,0xa0,0x82,0x99,
+0x69,0x99,0x70,0x82,0x99,0x99,0x99,0x91,0x82,0x99,0x80,0xa0,0x81,0x52,0xa5,0xc9,
+0xd9,0xd1,0x01,0x90,0x80,0xa0,0x81,0x01,0x90,0xc9,0x99,0xd1,0x19,0x9e,0x99,0xcb,
+0x95,0x00,0x78,0x77,0x87,0x40,0x00,0xc4,0x44,0x46,0x80,0x05,0x00,0xfa,0x2a,0x7a,
+0xc7,0x77,0x40,0x29,0xcd,0xaa,0xad,0xa6,0x2b,0xe9,0xad,0x9d,0xc6,0x02,0xa0,0x28,
+0x08,0x31,0x00,0xa0,0x28,0x4b,0x00,0x08,0xbb,0xbb,0xbb,0xb1,0x00,0x50,0x29,0x03,
+0x30,0x00,0x92,0x29,0x0b,0x10,0x00,0x35,0x29,0x27,0x00,0x2a,0xaa,0xbd,0xaa,0xa7,
+0x00,0x00,0x39,0x00,0x00,0x00,0x00,0x29,0x05,0x00,0x00,0x01,0x00,0xf4,0x1c,0x49,
+0x00,0x1c,0x00,0x01,0x1b,0x21,0x86,0x10,0x08,0x9e,0x99,0xcc,0x93,0x00,0x0c,0x00,
+0x56,0x00,0x2a,0xae,0xaa,0xcc,0xa7,0x00,0x2b,0x00,0x66,0x00,0x00,0x67,0x00,0x56,
+0x00,0x02,0xd1,0x00,0x56,0x00,0x0c,0x30,0x00,0x56,0x33,0x00,0xf4,0x20,0x12,0x00,
+0x00,0x03,0x33,0x5c,0x33,0x31,0x0c,0x77,0x77,0x77,0x73,0x0b,0x19,0x99,0xad,0x20,
+0x0b,0x01,0x86,0x92,0x00,0x0b,0x69,0x9e,0xd9,0x92,0x0b,0x00,0x0c,0x03,0xc0,0x0a,
+0x00,0x0b,0x07,0x20,0x56,0x00,0x0b,0x00,0x00,0x71,0x04,0xab,0x00,0x01,0x00,0x10,
+0x02,0x05,0x00,0xf0,0x81,0x1c,0x00,0x00,0x0c,0xbb,0xbb,0xbb,0xb4,0x0b,0x00,0x04,
+0x00,0x60,0x0b,0x28,0x0b,0x03,0xa0,0x0b,0x0b,0x0a,0x18,0x30,0x0b,0x08,0x35,0x3b,
+0x00,0x1a,0x01,0x10,0x74,0x00,0x66,0x89,0x99,0xea,0x95,0x31,0x11,0x11,0x11,0x10,
+0x00,0x00,0x06,0x00,0x00,0x06,0x99,0x9e,0x99,0x94,0x0b,0x11,0x61,0x16,0x10,0x0b,
+0x79,0xe9,0x9e,0x93,0x0b,0x00,0xb0,0x0b,0x00,0x0b,0x00,0xa9,0x98,0x00,0x0b,0x59,
+0x99,0x9a,0x50,0x1b,0x02,0xb2,0x4b,0x10,0x56,0x03,0x7e,0xe5,0x10,0x52,0x96,0x30,
+0x15,0x94,0x00,0x00,0x00,0x04,0x60,0x5a,0xe1,0xaa,0xe6,0x20,0x02,0x90,0x00,0xb0,
+0x00,0x0a,0x20,0x60,0xb1,0x10,0x1c,0xb7,0xa0,0xb8,0x81,0x02,0x65,0xa0,0xb0,0x00,
+0x0b,0xa1,0xa0,0xb0,0x00,0x07,0xc0,0x8a,0xba,0xa2,0x09,0xd7,0x00,0x00,0x00,0x59,
+0x07,0xbb,0xbb,0xb2,0x10,0x94,0x00,0xf1,0x1e,0x3a,0xe3,0x9b,0xb9,0x40,0x01,0x93,
+0x38,0x75,0xa0,0x07,0x35,0x69,0x97,0xb1,0x09,0xd4,0x9b,0xb9,0x60,0x02,0xa2,0x7a,
+0xa7,0x50,0x08,0xa1,0x27,0x72,0x10,0x08,0x78,0x9b,0xb9,0x90,0x0a,0xc4,0x04,0x40,
+0x00,0x56,0x18,0xba,0xaa,0xa2,0xcb,0x00,0xa6,0x09,0xbe,0xbb,0xcd,0xb4,0x00,0x0b,
+0x00,0x47,0x00,0x05,0x00,0x90,0x2b,0xbe,0xbb,0xcd,0xb7,0x00,0x1b,0x00,0x47,0x36,
+0x01,0xb2,0x47,0x00,0x02,0xd0,0x00,0x47,0x00,0x0b,0x20,0x00,0x47,0xfd,0x00,0xf0,
+0x09,0x05,0xca,0xaa,0xab,0x70,0x05,0x84,0x44,0x47,0x70,0x05,0x95,0x55,0x55,0x42,
+0x03,0xc8,0x88,0x88,0xc3,0x00,0x02,0x11,0x22,0x8a,0x01,0xe4,0x47,0x00,0x2a,0xcc,
+0xaa,0xbd,0xa7,0x01,0xc1,0x00,0x47,0x00,0x0c,0x40,0x32,0x00,0xf0,0x0e,0x00,0x00,
+0x01,0xa4,0x80,0x2b,0xbb,0xbc,0xeb,0xc7,0x00,0x00,0x00,0xc0,0x00,0x01,0x11,0x10,
+0xc0,0x00,0x08,0xae,0xa5,0xb0,0x00,0x00,0x0a,0x00,0x83,0x05,0x00,0xf0,0x21,0x48,
+0x04,0x02,0x6e,0xb8,0x0c,0x0a,0x09,0x52,0x00,0x04,0xd7,0x7b,0xbb,0xa0,0x0b,0x00,
+0x01,0xa0,0x0b,0x4b,0xbb,0xa0,0x0b,0x83,0x00,0x00,0x0b,0xca,0xaa,0x70,0x0b,0x00,
+0x03,0x90,0x0b,0x00,0x03,0x80,0x0b,0x00,0x06,0x60,0x0b,0x05,0xbc,0x10,0x0b,0x53,
+0x00,0xf0,0x1e,0x0a,0xaa,0xb8,0xaa,0xe0,0x00,0x00,0xb0,0x00,0xb0,0x0d,0xaa,0x78,
+0xba,0xa0,0x0b,0x00,0x09,0x20,0x00,0x09,0xaa,0xc6,0xaa,0xd1,0x09,0x92,0xb5,0xa4,
+0xa0,0x00,0x4a,0xa0,0x2a,0xe0,0x1b,0x75,0x88,0x92,0xb0,0x00,0x8b,0x30,0x69,0x90,
+0x83,0x00,0xf0,0x1a,0x00,0x00,0x00,0x20,0x02,0x20,0x6a,0xe0,0x38,0x0a,0x20,0x00,
+0xb0,0x49,0x5c,0x40,0x5a,0xe0,0xc5,0xd5,0xc0,0x72,0x00,0xd7,0xd7,0xc0,0x8b,0xa0,
+0xc5,0xd5,0xc0,0x00,0xb0,0x44,0xd4,0x40,0x00,0xb8,0xaa,0xea,0xa3,0x54,0x00,0x52,
+0x00,0x3b,0x70,0x00,0xb0,0xbc,0x00,0xf1,0x1e,0x4a,0xac,0x6b,0x99,0xd0,0x00,0x0a,
 0x65,0x22,0xb0,0x1b,0xab,0x37,0xd7,0x70,0x37,0x00,0x59,0xe9,0x91,0x6b,0x86,0x90,
 0xb0,0x73,0x12,0x2b,0x9a,0xe9,0xc3,0x00,0x0a,0x00,0xb0,0x70,0x00,0x28,0x01,0xc3,
-0xc3,0x08,0xb3,0xcb,0xa8,0x89,0x00,0x2c,0x25,0xe0,0x09,0x20,0x26,0x3a,0x09,0x20,
-0xb2,0x07,0x09,0x22,0x60,0x7b,0xbd,0xbb,0x03,0x1b,0x50,0x1a,0x3b,0xbb,0xbb,0xca,
-0x08,0x00,0x82,0x89,0x99,0x99,0xaa,0x11,0x11,0x11,0x3a,0xb6,0x06,0xe0,0xaa,0xaa,
-0xad,0x50,0x01,0x55,0x55,0x5a,0x40,0x01,0x55,0x55,0x5b,0x30,0xa3,0x05,0xf1,0x0b,
-0xb6,0x04,0x40,0x49,0x02,0x70,0x00,0x96,0x4f,0x7b,0x20,0x00,0x19,0xd7,0xb4,0x00,
-0x0a,0xa3,0x47,0x0a,0x92,0x01,0x07,0xb5,0x00,0x33,0x7a,0x14,0xf8,0x1c,0x3c,0xdb,
-0xe8,0x08,0x80,0x03,0x70,0xb0,0xb6,0x00,0x03,0x70,0xb0,0x00,0x52,0x5c,0xda,0xea,
-0x07,0x90,0x04,0x60,0xb0,0xa7,0x00,0x06,0x50,0xb0,0x10,0x45,0x08,0x30,0xb0,0x02,
-0xc0,0x0c,0x00,0xb0,0x5c,0x10,0x55,0x00,0xb5,0x64,0x26,0xf2,0x1d,0x0c,0x88,0x99,
-0x04,0xa0,0x0c,0x77,0x89,0x7a,0x00,0x09,0x89,0x86,0x40,0x31,0x39,0xad,0x98,0x05,
-0xa0,0x07,0x88,0x84,0x99,0x00,0x0b,0x00,0x37,0x20,0x22,0x08,0x9d,0x93,0x01,0xc1,
-0x0b,0x1a,0x82,0x2b,0x30,0x23,0x87,0x05,0xb1,0x9a,0x2b,0xf6,0x0e,0x02,0xc0,0xaa,
-0xac,0xc0,0x1c,0x20,0x00,0x1c,0x30,0x01,0x85,0x03,0xd8,0x00,0x03,0xc2,0xa9,0x27,
-0xc3,0x2c,0xb4,0x41,0x11,0x33,0x11,0xb0,0x99,0xe9,0x47,0x22,0x00,0xae,0x22,0x22,
-0xea,0xa7,0x65,0x00,0xf0,0x11,0xb1,0x00,0xb0,0x00,0x2b,0x30,0xaa,0xea,0xa2,0x00,
-0xa5,0x22,0xc2,0x22,0x08,0xb4,0x66,0x6a,0x95,0x57,0xb4,0x88,0x8b,0xb5,0x00,0xb0,
-0x52,0x17,0x61,0x00,0xb0,0x59,0x53,0x23,0x20,0x09,0x06,0xf5,0x1c,0x21,0x8c,0x20,
-0xf3,0x13,0x60,0x01,0xc1,0xca,0xaa,0xc0,0x2c,0xd6,0x19,0x60,0x01,0x84,0xc9,0x99,
-0xc0,0x04,0x3c,0x21,0xf1,0x0a,0x3c,0xb0,0xca,0xda,0x80,0x11,0xb0,0xb0,0x91,0xa1,
-0x00,0xb0,0xb0,0x4c,0x20,0x00,0xb0,0xb3,0x4a,0x60,0x00,0xb0,0xd8,0x30,0x77,0x70,
-0x17,0x60,0x09,0x46,0x99,0xc9,0x30,0x67,0x04,0x1a,0xf8,0x12,0x13,0x8b,0x99,0xe9,
-0x92,0x1e,0x2b,0x25,0xc5,0x30,0x9b,0x1b,0x76,0x44,0xb0,0x09,0x1b,0x7a,0x88,0xb0,
-0x09,0x1b,0x79,0x77,0xb0,0x09,0x39,0x79,0x88,0xb0,0x09,0x46,0x74,0xaf,0x22,0xf7,
-0x1e,0x09,0x44,0x84,0x19,0x00,0x85,0x38,0x88,0x4a,0x42,0x06,0x6b,0xbb,0x87,0xb4,
-0x2e,0x16,0x66,0xe4,0xa0,0xbc,0x14,0x44,0x68,0xb0,0x0a,0x0b,0x9a,0x0b,0x70,0x0a,
-0x09,0x0b,0x4b,0x30,0x0a,0x19,0x1a,0x6a,0xa0,0x0a,0x53,0x03,0x90,0x56,0x37,0x01,
-0xf1,0x1f,0xa3,0x33,0xc3,0x32,0x0a,0x42,0x55,0xc5,0x53,0x23,0x74,0xdb,0x9c,0xa5,
-0x02,0xc0,0xa8,0x39,0x55,0x2c,0xb0,0x55,0x55,0x52,0x22,0xb5,0x99,0xb9,0x97,0x00,
-0xb0,0x23,0xa0,0x40,0x00,0xb7,0x49,0x22,0x75,0x00,0xb7,0x0b,0x9a,0x26,0x00,0x03,
-0x1f,0x06,0x10,0xa6,0x3c,0x01,0x90,0x09,0x50,0x00,0x03,0x0b,0x00,0x02,0x40,0x0b,
-0x5c,0x12,0x00,0x66,0x12,0x72,0x93,0x38,0x0b,0x00,0x06,0x57,0x23,0x20,0x16,0x14,
-0xbb,0x3d,0x1f,0x20,0x08,0x50,0xf3,0x1a,0xf8,0x16,0x8a,0x0b,0x30,0x00,0x07,0x02,
-0x58,0x00,0x09,0x1c,0x02,0xc5,0x20,0x0c,0x0c,0x2c,0x22,0xb0,0x48,0x0d,0xb1,0x00,
-0x93,0x31,0x5e,0x10,0x05,0x25,0x2b,0x8c,0x00,0x0b,0x00,0x22,0x09,0xcb,0xc7,0x44,
-0x29,0x00,0x0a,0x00,0x30,0x06,0xbb,0xcd,0x34,0x0b,0x10,0x61,0x6e,0x00,0xf1,0x03,
-0x5c,0x10,0x00,0x07,0x5a,0x03,0x71,0xb0,0x0c,0x1a,0x00,0x08,0x93,0x15,0x0b,0xaa,
-0xa9,0x25,0xc7,0x0e,0xf0,0x09,0x04,0xc4,0xab,0xeb,0xb0,0x18,0xaa,0x00,0xb0,0xb0,
-0x45,0xa2,0x00,0xb0,0xb0,0x11,0xa5,0xbb,0xfb,0xd9,0x00,0xa0,0x06,0xd5,0xd9,0x07,
-0x40,0x1c,0x00,0x00,0xa0,0xeb,0x01,0x47,0xa8,0x70,0x00,0x5a,0xf0,0x00,0xf0,0x0a,
-0x4b,0x11,0x11,0x10,0x02,0xc9,0xe9,0xe9,0xd0,0x0b,0x18,0x53,0x90,0xb0,0x01,0x96,
-0x2b,0x10,0xb0,0x00,0x20,0xb1,0x6b,0x60,0x00,0xca,0x03,0xf1,0x00,0x09,0x39,0x0b,
-0x10,0xa0,0x0a,0x19,0x02,0x18,0x74,0x13,0x0c,0xaa,0xb8,0x12,0x83,0x06,0x30,0x2b,
-0xbb,0xdf,0x91,0x00,0xf3,0x12,0xc6,0x90,0x00,0x00,0x09,0x80,0xc5,0x00,0x04,0xc7,
-0x7a,0x1c,0xb3,0x18,0x20,0x46,0x00,0x64,0x05,0x5a,0x1b,0x11,0xa0,0x0b,0x2a,0x02,
-0x27,0x93,0x07,0x0b,0xaa,0xa9,0x35,0x87,0x01,0xf0,0x05,0x50,0x80,0x00,0x03,0xc8,
-0x45,0x9d,0x10,0x03,0x65,0x54,0x34,0x60,0x00,0xe9,0x99,0x9e,0x00,0x00,0xd9,0x05,
-0x00,0xf2,0x04,0x01,0xa1,0x00,0x00,0x04,0x23,0x5c,0x02,0x30,0x0c,0x37,0x03,0x15,
-0xb0,0x27,0x1c,0xba,0xb5,0x52,0x91,0x19,0xf0,0x1f,0x2f,0x99,0x92,0x00,0x02,0xb1,
-0x01,0xc0,0x00,0x0a,0x9a,0xaa,0xaa,0x90,0x00,0x57,0x77,0x78,0x90,0x00,0x11,0x11,
-0x13,0x90,0x00,0x99,0xba,0x99,0x60,0x01,0x24,0x4a,0x00,0x70,0x09,0x59,0x06,0x46,
-0x57,0x07,0x0c,0xaa,0xab,0x06,0x00,0x13,0xb9,0x02,0x10,0x0b,0x15,0x13,0x50,0x8b,
-0xaa,0xd8,0x00,0x00,0x0d,0x14,0x20,0x00,0xc0,0x60,0x14,0x32,0xcb,0xbb,0xbc,0xf0,
-0x09,0xf7,0x2d,0x08,0x2a,0x0b,0x24,0x80,0x1b,0x0a,0x00,0x05,0xa2,0x23,0x0c,0xaa,
-0xb6,0x11,0x02,0x90,0x0a,0x00,0x00,0x06,0xb6,0xae,0xaa,0xa7,0x1a,0x99,0x19,0x07,
-0x00,0x47,0x93,0x56,0x69,0x15,0x13,0x90,0x93,0x79,0x63,0x02,0x91,0xb4,0x4c,0x70,
-0x02,0x9a,0x30,0x7c,0x20,0x02,0x94,0x03,0xb1,0xb1,0x02,0x90,0x3a,0x10,0x38,0x8c,
-0x21,0x33,0x66,0xb8,0x66,0x03,0x29,0x83,0xe8,0x88,0x8e,0x00,0x00,0xd7,0x77,0x7d,
-0x0a,0x00,0xf4,0x0b,0x11,0x93,0x11,0x00,0x05,0x34,0x1b,0x03,0x80,0x1b,0x56,0x04,
-0x17,0xb1,0x34,0x2c,0xba,0xb5,0x31,0x00,0xa9,0x88,0x8c,0x30,0x00,0xa8,0x05,0x00,
-0xf0,0x36,0x17,0xc8,0x77,0x7c,0x95,0x02,0x6b,0x32,0x6c,0x21,0x05,0xda,0xa9,0x87,
-0xb0,0x01,0x23,0x5b,0x02,0x50,0x0a,0x3b,0x04,0x34,0xb1,0x26,0x08,0x99,0xa5,0x26,
-0x0a,0x05,0x68,0xb6,0x60,0x4b,0x84,0x8a,0xc8,0x70,0x8a,0x44,0x36,0x93,0x31,0x8a,
-0x05,0x55,0x55,0x52,0x1a,0x05,0xb9,0x99,0xa0,0x0a,0x05,0xa8,0x88,0xa0,0x0a,0x05,
-0xb8,0x89,0xa0,0x0a,0x05,0x50,0x00,0x05,0x00,0x21,0x2a,0x70,0xbe,0x06,0xf0,0x07,
-0x06,0x99,0xad,0x99,0x90,0x00,0x0b,0x00,0x75,0x00,0x09,0x99,0x99,0x99,0x94,0x00,
-0xc8,0x88,0x8b,0x40,0x00,0xd7,0x60,0x20,0x01,0x0a,0x00,0xe4,0x12,0x77,0x01,0x20,
-0x08,0x4b,0x06,0x33,0xb0,0x07,0x09,0x99,0xb3,0x32,0x05,0x21,0xf3,0x49,0xdc,0xb4,
-0x0b,0x24,0x43,0xb0,0x40,0x0b,0x36,0x64,0xb3,0x80,0x0b,0x6a,0x98,0x7c,0x10,0x2a,
-0x77,0x68,0x9b,0x16,0x64,0x12,0x45,0x55,0xb3,0x02,0x34,0x48,0x01,0x30,0x0c,0x57,
-0x07,0x17,0xb0,0x34,0x2c,0x99,0x97,0x31,0x01,0x90,0xb7,0x77,0xd0,0x04,0xb4,0xb6,
-0x66,0xd0,0x17,0x99,0x67,0x77,0x80,0x45,0x95,0xac,0x8c,0x97,0x12,0x94,0xac,0x7b,
-0x97,0x01,0x94,0x99,0x99,0x91,0x01,0x90,0x49,0x07,0x90,0x01,0x90,0x09,0xec,0x10,
-0x01,0x98,0xa6,0x25,0xb8,0x00,0xdc,0x2d,0xf4,0x48,0x1a,0x10,0x7a,0xae,0x09,0x21,
-0x50,0x42,0x0b,0x4b,0xaa,0xa1,0x1b,0x48,0x59,0x60,0x40,0x04,0xe3,0x04,0x77,0x60,
-0x02,0xf4,0x01,0xcc,0x00,0x0b,0x4c,0x00,0xf3,0x21,0xa6,0x03,0x3c,0xa8,0x73,0x00,
-0x00,0x72,0x09,0xc0,0x00,0x00,0x07,0x48,0x50,0x08,0xbb,0xbd,0xcb,0xd4,0x0c,0x00,
-0x05,0x60,0x20,0x0c,0xaa,0x83,0x74,0x90,0x0c,0x00,0xb1,0xab,0x20,0x0b,0x00,0xa0,
-0xc8,0x00,0x0b,0x5a,0x72,0xe4,0x26,0x48,0x01,0x2c,0x3a,0x45,0x82,0x00,0x92,0x07,
-0xc1,0x19,0x0c,0x80,0x85,0x80,0x0b,0xbb,0xbc,0xdb,0xc6,0x00,0xed,0x14,0xd0,0x07,
-0xba,0xd0,0xc0,0xc0,0x07,0x20,0xb0,0xc6,0x80,0x06,0xaa,0xc0,0xa1,0x0c,0xd2,0x41,
-0xb8,0x06,0x0a,0xcb,0x8b,0x7c,0x0a,0x03,0x00,0x85,0x05,0xd6,0xac,0x07,0xf6,0x1c,
-0x4b,0x31,0xc4,0x60,0x04,0x5c,0x41,0xc0,0x61,0x2a,0xbb,0xaa,0xea,0xa6,0x03,0xa9,
-0x41,0xc0,0x70,0x0d,0x8a,0x73,0xa2,0xa0,0x19,0x9b,0x93,0x7c,0x30,0x06,0x9b,0x83,
-0x5b,0x05,0x06,0xac,0xa6,0xbc,0x0a,0x06,0x20,0x0b,0x24,0xd6,0x22,0x70,0x10,0x07,
-0x9b,0x92,0x8b,0xa2,0x0c,0x1a,0x0e,0x30,0x0e,0xaa,0x96,0x28,0x15,0xf4,0x0b,0xa6,
-0xcb,0xd5,0x0e,0xab,0xa7,0x41,0x90,0x0a,0x00,0x08,0x21,0x90,0x29,0x00,0x0b,0x11,
-0x90,0x66,0x00,0x1b,0x01,0x90,0x81,0x00,0x73,0x70,0x20,0x00,0x09,0x0d,0x60,0x07,
-0xaa,0xeb,0xaa,0x70,0x0b,0x27,0x0a,0x20,0x0b,0x88,0xe4,0x19,0xf5,0x0d,0x33,0x33,
-0x33,0x20,0x0b,0x89,0xe2,0xa9,0xe0,0x0b,0x64,0xa0,0x83,0xa0,0x0a,0x07,0xd0,0x08,
-0xd0,0x46,0x97,0xb2,0xb5,0xb0,0x81,0x06,0xb0,0x07,0xa1,0x04,0x73,0x14,0x20,0x05,
-0xaa,0xbd,0x96,0x20,0xd9,0x03,0x3a,0xbe,0xbb,0xb1,0x36,0x2d,0x17,0xb8,0xe9,0x08,
-0x20,0x1b,0xc6,0x99,0x0b,0xa0,0x56,0x66,0x63,0x49,0xd9,0x21,0x1c,0x10,0x12,0xb1,
-0xdf,0x02,0x00,0x82,0x2a,0x74,0x16,0xeb,0x10,0x0c,0x00,0x57,0xb0,0x0f,0x00,0x01,
-0x05,0x00,0x58,0x1b,0x80,0x09,0xb9,0x00,0xa8,0x23,0x01,0x13,0x05,0x00,0x36,0x0c,
-0x80,0x02,0xae,0x78,0xea,0xba,0x00,0x00,0xb0,0x13,0x13,0xf5,0x0c,0x1d,0x97,0xb0,
-0x1a,0x00,0x3a,0xc0,0x1d,0xb4,0xa0,0x00,0x0b,0x06,0x42,0x5a,0x00,0x00,0xb2,0xb0,
-0x00,0xa8,0x00,0xb7,0xa1,0x00,0x08,0xa0,0x14,0x13,0xa0,0x73,0x00,0x29,0xd7,0x89,
-0x99,0x94,0x02,0xb1,0x91,0x0f,0x00,0xb0,0x91,0x00,0x00,0x05,0xe9,0xa0,0x00,0x00,
-0x28,0xb0,0xb0,0x0f,0x00,0x00,0x05,0x00,0x75,0xa2,0x90,0x00,0x00,0x0b,0x89,0x20,
-0x24,0x0d,0x71,0x45,0x55,0x54,0xae,0xa1,0x11,0x1c,0x25,0x06,0x00,0x1d,0x1b,0x62,
-0x03,0xda,0x6a,0xaa,0xe4,0x7c,0x83,0x00,0x00,0xf5,0x1a,0x30,0xbb,0xbe,0x1a,0x6e,
-0x0a,0x07,0x56,0x0d,0xa0,0xbb,0xbf,0xa0,0x15,0xc4,0x00,0x8a,0x00,0x27,0xd6,0xda,
-0x02,0xf3,0x0e,0xb0,0x9c,0xdd,0xcc,0x02,0xd9,0x0a,0x1a,0x0b,0x39,0xc0,0x67,0x37,
-0x0a,0x00,0xb2,0x70,0xb0,0x28,0x00,0xb0,0x1b,0x30,0x56,0x0b,0x70,0xa2,0x09,0xb1,
-0x32,0x00,0xf0,0x0c,0x0b,0x18,0x00,0x49,0xd8,0x0a,0x14,0x60,0x02,0xb1,0xbe,0xc9,
-0x71,0x00,0xb0,0x06,0x51,0x60,0x16,0xeb,0x04,0x89,0x30,0x47,0xb0,0x01,0xd9,0xea,
-0x15,0xf0,0x1e,0xf2,0x13,0x00,0xb0,0x5b,0x6a,0x57,0x1a,0x80,0x70,0x07,0xd1,0x00,
-0xb0,0x00,0x92,0x00,0x29,0xe8,0x5a,0xaa,0xb1,0x01,0xc1,0x64,0x00,0x91,0x00,0xb0,
-0x64,0x00,0x91,0x04,0xea,0x7c,0xbb,0xe1,0x36,0xb0,0x82,0x00,0x20,0x00,0xb0,0xa0,
-0xbe,0x06,0x65,0xa0,0x00,0x00,0x0b,0x96,0x30,0x91,0x00,0xd0,0x9b,0xaa,0xe0,0x25,
-0xd5,0x91,0x00,0xc0,0x15,0xd5,0x91,0x79,0x60,0x0f,0x00,0xf7,0x0b,0xa2,0x16,0xeb,
-0x97,0x50,0xb0,0x47,0xc0,0x91,0xb3,0xa0,0x00,0xb0,0x91,0x5e,0x20,0x00,0xb0,0x91,
-0x9c,0x80,0x3b,0x90,0x9a,0x50,0x76,0x1e,0x0e,0x00,0x8f,0x10,0xa0,0x18,0xe7,0x7a,
-0xba,0xa5,0x01,0xc1,0x03,0x00,0x50,0x3d,0x1e,0x90,0xb0,0x18,0xe8,0x0b,0x03,0x80,
-0x13,0xb0,0x09,0x80,0x2f,0xa5,0x06,0x3a,0x00,0x00,0xb2,0x99,0x9d,0x97,0x09,0x90,
-0x86,0x24,0xf0,0x11,0xb0,0xab,0xbb,0xb2,0x38,0xd8,0xa1,0x00,0x00,0x12,0xc2,0xab,
-0xbb,0x90,0x00,0xb0,0xa1,0x00,0xa0,0x16,0xeb,0xa1,0x00,0xa0,0x36,0xb0,0xab,0xaa,
-0xa0,0x00,0xb0,0xa1,0x23,0x00,0x81,0xa3,0x11,0x10,0x1a,0x80,0x69,0x99,0x94,0x9a,
-0x02,0xf8,0x4b,0x08,0x21,0xa5,0x00,0xb0,0x7c,0xa2,0xa9,0x21,0xa0,0x19,0x41,0xa2,
-0x92,0x90,0x08,0x21,0xa0,0x64,0x70,0x3c,0xc3,0xa0,0x07,0x40,0x7b,0x21,0xa4,0x6c,
-0x80,0x08,0x22,0xe9,0x39,0xb1,0x08,0x26,0x61,0xc2,0x66,0x5c,0x10,0x07,0x40,0x15,
-0x01,0x90,0x43,0xa1,0x70,0x29,0xd5,0xb4,0xd3,0x53,0x03,0xa1,0x7a,0xa6,0x65,0x01,
-0xa1,0x0a,0xa8,0x81,0x18,0xe7,0x1f,0x32,0xc0,0x26,0x90,0xa6,0xa7,0x70,0x01,0x97,
-0xa0,0x9d,0x00,0x01,0x96,0x05,0xcb,0x60,0x0b,0x70,0x88,0x00,0x89,0xc8,0x00,0xf3,
-0x10,0x9d,0xab,0xd0,0x29,0xe8,0x08,0x4b,0x40,0x01,0xb1,0x04,0xf9,0x00,0x00,0xb0,
-0xa9,0x28,0xc4,0x04,0xe8,0x32,0xb2,0x32,0x25,0xb0,0x46,0xd6,0x60,0x00,0xb1,0xaa,
-0x25,0x2a,0x16,0x0a,0x56,0x2c,0xf0,0x11,0xb0,0x00,0xc3,0x00,0x02,0xc2,0x06,0x8a,
-0x00,0x17,0xd7,0x5a,0x02,0xb1,0x00,0xb1,0xaa,0xaa,0x77,0x02,0xda,0x01,0x11,0x00,
-0x39,0xd1,0x6b,0x99,0xc0,0x00,0xb0,0x65,0x30,0x00,0x63,0x6b,0x99,0xc0,0x0a,0x90,
-0x65,0x33,0x00,0xf0,0x1a,0x07,0x30,0x11,0xb1,0x10,0x7c,0xa2,0x66,0xd6,0x50,0x18,
-0x43,0x55,0xc5,0x51,0x07,0x43,0x55,0x5c,0x51,0x6d,0xb6,0x88,0x8d,0x92,0x48,0x30,
-0x62,0x1b,0x20,0x07,0x30,0x57,0x0a,0x00,0x07,0x30,0x08,0x0a,0x00,0x5c,0x6c,0x1c,
-0x03,0x64,0x00,0xf0,0x18,0x73,0x25,0x40,0x38,0xe8,0x79,0x52,0x22,0x01,0xc1,0x68,
-0x44,0x95,0x00,0xb0,0x16,0x77,0x50,0x16,0xeb,0x4a,0xaa,0xa0,0x35,0xb0,0x74,0x11,
-0xb0,0x00,0xb0,0x79,0x77,0xd0,0x00,0xb0,0x7a,0x88,0xd0,0x0a,0xa0,0x0c,0x03,0x32,
-0x00,0xf3,0x1c,0x11,0xa3,0x11,0x39,0xe7,0xc5,0x85,0x5b,0x01,0xb1,0x92,0xa0,0x09,
-0x00,0xb2,0xac,0xca,0xa9,0x02,0xeb,0x0c,0x02,0xa0,0x4a,0xc0,0x69,0x07,0x50,0x00,
-0xb0,0x08,0xbc,0x00,0x00,0xb0,0x04,0xcb,0x80,0x0a,0x80,0xb8,0x00,0x78,0x39,0x16,
-0xd0,0xba,0xaa,0xa5,0x29,0xd6,0xb4,0x77,0x71,0x02,0xb1,0xb1,0x33,0x30,0x0f,0x00,
-0xf7,0x0b,0xa6,0x06,0xe8,0xb5,0x47,0x22,0x38,0xa0,0xb5,0x48,0xa1,0x01,0xa0,0xb5,
-0x45,0x50,0x01,0xa3,0x85,0x75,0xb2,0x0a,0x85,0x48,0x81,0x26,0x34,0x2a,0xe0,0x90,
-0x0b,0x53,0x20,0x15,0xb2,0x87,0x4c,0x40,0x16,0xb5,0xe9,0xcb,0xc0,0x9f,0x3c,0xf2,
-0x0b,0xb0,0x06,0xe7,0xb0,0xb0,0xb0,0x27,0xa4,0xbb,0xfb,0xb7,0x01,0x90,0x09,0x89,
-0x00,0x01,0x90,0x78,0x07,0x70,0x0b,0x79,0x60,0x00,0x58,0xfd,0x07,0xf3,0x1c,0x25,
-0xca,0xaa,0xe0,0x4b,0x77,0x40,0x00,0xb0,0x4b,0x76,0xca,0xea,0xa0,0x08,0x25,0x40,
-0xb0,0x00,0x1a,0x98,0xa9,0xe9,0x95,0x4a,0x27,0x79,0xe9,0x90,0x08,0x29,0x90,0x00,
-0xa0,0x08,0x3a,0x91,0x00,0xa0,0x5c,0x46,0x99,0x99,0x99,0x21,0x02,0x37,0x00,0xf4,
-0x1c,0x99,0xe9,0x91,0x5b,0x82,0x44,0xc4,0x30,0x3a,0x61,0x55,0xc5,0xb0,0x08,0x37,
-0x99,0xe9,0xe4,0x4c,0xc3,0x66,0xd6,0xb0,0x49,0x21,0x82,0xb2,0x10,0x08,0x25,0x90,
-0xd9,0x70,0x08,0x2a,0xa4,0xa0,0x00,0x5c,0x47,0x08,0xaa,0xa3,0x9a,0x01,0xa0,0x98,
-0x00,0x19,0xe7,0x59,0xa8,0x94,0x01,0xc1,0x00,0x71,0x2f,0xf0,0x04,0x5a,0xa8,0xa3,
-0x16,0xea,0x00,0xa8,0x00,0x14,0xb0,0x8b,0xa8,0xa5,0x00,0xb0,0x00,0xa8,0x10,0x00,
-0xf3,0x03,0x20,0x09,0x90,0x05,0x00,0xf2,0x1d,0x10,0x15,0x71,0x10,0x2a,0x43,0xb9,
-0x8b,0x90,0x5c,0x70,0x35,0x1a,0x00,0x09,0x17,0xac,0xba,0xa2,0x0a,0xb0,0x0b,0x10,
-0x00,0x9d,0x28,0xcb,0x9e,0x93,0x09,0x10,0xd3,0x2a,0x00,0x09,0x10,0x1b,0xf8,0x00,
-0x5b,0x09,0xa6,0x06,0xa0,0x91,0x00,0xf0,0x0d,0x21,0x23,0xb2,0x20,0x7d,0xba,0x64,
-0x44,0xb0,0x08,0x25,0x5a,0x1a,0x50,0x08,0x23,0xb1,0x02,0x80,0x3c,0xb2,0x99,0x99,
-0x40,0x7a,0x20,0x11,0xc1,0x9c,0x16,0x12,0xb0,0x05,0x00,0xf0,0x02,0x6c,0x09,0xaa,
-0xea,0xa1,0x08,0x30,0x72,0x91,0x00,0x7c,0xa3,0xda,0xdb,0xa3,0x18,0x49,0xc1,0x3d,
-0xc0,0x49,0xda,0xea,0xa1,0x3b,0xc3,0xa0,0xb0,0x00,0x6a,0x30,0xda,0x1e,0x00,0xf0,
-0x22,0xa0,0xb0,0x00,0x08,0x30,0xda,0xea,0xa5,0x5c,0x10,0xa0,0x00,0x00,0x08,0x10,
-0x0a,0x0b,0x00,0x7d,0xa6,0x8d,0x7d,0x72,0x19,0x30,0x0a,0x0b,0x00,0x08,0x21,0xaf,
-0xaf,0x90,0x5d,0xb3,0xa0,0x90,0xb0,0x4a,0x11,0xea,0xda,0xd0,0x08,0x11,0xa0,0x90,
-0xb0,0x08,0x0a,0x00,0x21,0x6c,0x01,0xb6,0x17,0x01,0x8c,0x00,0xf7,0x1c,0xd8,0x88,
-0xb0,0x7c,0xa3,0xc7,0x77,0xb0,0x19,0x31,0xd8,0x88,0xb0,0x08,0x20,0x22,0x22,0x10,
-0x1b,0xc7,0x99,0xe9,0x92,0x9c,0x20,0x90,0xb0,0x00,0x08,0x23,0xc0,0xd8,0x60,0x08,
-0x29,0x96,0xb0,0x00,0x5c,0x38,0x06,0xaa,0xa4,0x1f,0x0a,0xf4,0x1d,0x11,0x98,0xd4,
-0x00,0x5d,0xa3,0x33,0xc3,0x30,0x19,0x34,0x66,0xd6,0x60,0x09,0x22,0x96,0xa5,0x60,
-0x5d,0xb7,0x60,0xa1,0x90,0x3a,0x15,0xc8,0xa7,0xb0,0x09,0x15,0x60,0xa0,0x80,0x09,
-0x15,0xc9,0xe9,0xb0,0x3c,0x05,0x60,0x00,0x80,0xf1,0x01,0xf6,0x1f,0x24,0x30,0x08,
-0x25,0xaa,0x85,0x50,0x5b,0x82,0xa4,0x58,0x30,0x4a,0x76,0xca,0xad,0x90,0x08,0x23,
-0x6a,0x44,0x41,0x09,0xa7,0xa8,0x55,0x51,0x9c,0x40,0xbc,0x9b,0x60,0x08,0x20,0xbb,
-0x3c,0x10,0x08,0x29,0x44,0xf9,0x00,0x5c,0x66,0x88,0x26,0xcd,0x2c,0xf7,0x4c,0x20,
-0x07,0x35,0x99,0xa9,0x70,0x3a,0x72,0x62,0x62,0x90,0x3a,0x70,0x90,0x46,0x20,0x07,
-0x33,0xda,0xda,0xa1,0x1a,0xc6,0x10,0xb0,0x00,0x7b,0x38,0xaa,0xea,0xa5,0x07,0x34,
-0x30,0xb0,0x80,0x07,0x36,0xa8,0xd8,0xb0,0x5c,0x10,0x11,0x11,0xa0,0x08,0x11,0x2b,
-0x2c,0x20,0x08,0x15,0x7d,0x7d,0x70,0x6c,0x93,0x98,0x69,0x60,0x08,0x12,0xd8,0x89,
-0x90,0x2b,0xb5,0xc6,0x68,0x90,0x6b,0x20,0x23,0x92,0x10,0x08,0x19,0x9d,0xea,0x91,
-0x08,0x10,0x3a,0x29,0x00,0x6c,0x1a,0x91,0x04,0xb1,0x26,0x02,0xf2,0x4a,0x24,0xa7,
-0xc5,0x30,0x5b,0x81,0xa1,0xa8,0x20,0x4a,0x78,0xab,0xec,0x92,0x08,0x30,0x58,0xba,
-0x10,0x4c,0xcb,0x81,0x82,0xb3,0x5a,0x22,0xc7,0xd7,0xb0,0x08,0x21,0xd8,0xd8,0xa0,
-0x08,0x21,0x90,0xa0,0xa0,0x5c,0x11,0xc8,0x88,0xa0,0x09,0x10,0xb8,0x8c,0x00,0x5c,
-0x80,0xb7,0x7c,0x00,0x1a,0x36,0x97,0x69,0x70,0x09,0x19,0x09,0x90,0x90,0x0b,0xdb,
-0x8b,0xa8,0xc0,0x4b,0x19,0xac,0xca,0xa1,0x09,0x10,0x4e,0xe5,0x00,0x09,0x15,0xb5,
-0x6a,0x50,0x3b,0x38,0x04,0x60,0x71,0xbb,0x03,0xf3,0x1d,0x22,0x35,0xa3,0x30,0x2a,
-0x68,0xa4,0x64,0xa0,0x3a,0x72,0xab,0x8a,0x90,0x07,0x26,0x79,0x0b,0x20,0x3b,0xb4,
-0xb8,0x86,0x90,0x39,0x25,0x99,0x99,0x70,0x07,0x20,0x60,0xa5,0x00,0x07,0x24,0x90,
-0xa3,0x70,0x2b,0x16,0x09,0x80,0x60,0x93,0x00,0x10,0x65,0xcd,0x06,0x10,0xdd,0xf6,
-0x11,0x10,0x65,0x00,0x12,0x51,0xdd,0xbb,0x20,0x00,0x93,0xd5,0x2a,0xf2,0x03,0x21,
-0xb2,0x00,0x00,0x01,0xdd,0x20,0x00,0x15,0x9c,0x66,0xc9,0x51,0x36,0x20,0x00,0x02,
-0x62,0xe8,0x07,0xf2,0x1d,0x0b,0x06,0x50,0x00,0x0b,0x0b,0x0a,0xba,0xa5,0x0b,0x0b,
-0x1e,0x11,0xb0,0x0b,0x0b,0xaa,0x44,0x70,0x0b,0x0b,0x31,0xa9,0x30,0x0c,0x7e,0x00,
-0x9b,0x00,0x3c,0x5c,0x00,0x9b,0x00,0x00,0x0b,0x08,0x87,0x90,0x00,0x0b,0x77,0x00,
-0x75,0x62,0x16,0x21,0xbb,0xb9,0xa9,0x21,0xd0,0xb2,0xeb,0xb9,0x00,0x00,0x0b,0x98,
-0x0a,0x10,0x0b,0xbb,0xcc,0xc0,0xa6,0x04,0x20,0x29,0x59,0xc1,0x0f,0xf0,0x06,0x4e,
-0x30,0x00,0xb2,0x78,0x05,0xf2,0x00,0x1f,0xa4,0x06,0xb2,0xc4,0x00,0x10,0x02,0x80,
-0x01,0x70,0x00,0x50,0xb4,0x07,0xf3,0x1c,0x82,0x01,0xa0,0x00,0x5c,0xca,0xa5,0xdb,
-0xb6,0x04,0x60,0x0b,0x50,0xb0,0x05,0xdb,0x9d,0x92,0x80,0x05,0x54,0x92,0xb7,0x40,
-0x07,0x44,0x60,0x8c,0x00,0x09,0x25,0x60,0x7c,0x00,0x0c,0x06,0x55,0xb8,0x80,0x74,
-0x7c,0x8a,0x00,0xcf,0x2f,0xf0,0x21,0x91,0x02,0x80,0x00,0x4a,0xda,0x97,0xcb,0xb6,
-0x00,0xa2,0x1d,0x30,0xb0,0x00,0x91,0x7b,0x73,0x80,0x0d,0xcc,0xa0,0xb8,0x30,0x0a,
-0x02,0x80,0x9b,0x00,0x0a,0x02,0x80,0xab,0x00,0x0e,0xbb,0x8a,0x67,0x90,0x03,0x00,
-0x83,0x00,0x54,0x00,0x40,0x00,0x50,0x96,0x32,0xf0,0x1c,0xb0,0x00,0x4a,0xaa,0x92,
-0xeb,0xb4,0x0b,0x16,0x57,0x50,0xb0,0x58,0x05,0x9d,0x82,0x80,0x25,0x8b,0x03,0xb7,
-0x40,0x00,0xa8,0x00,0x7c,0x00,0x02,0xab,0x30,0x9c,0x00,0x3b,0x11,0x49,0x74,0xb1,
-0x10,0x00,0x43,0x00,0x33,0x03,0x6a,0x12,0xf3,0x1d,0x0c,0x33,0x31,0xa0,0x00,0x4a,
-0x66,0x66,0xb7,0x72,0xab,0x9a,0x6b,0x74,0xb1,0x0a,0x82,0xbc,0x93,0x70,0x8d,0xbb,
-0xd4,0xa8,0x30,0x37,0x73,0x70,0x7b,0x00,0x5c,0xcc,0xc2,0x8b,0x00,0x00,0x06,0x44,
-0x96,0x60,0x00,0x7b,0x3a,0x00,0x24,0x2b,0xf2,0x1d,0x85,0x70,0xb0,0x00,0x79,0xda,
-0xa3,0xea,0xa5,0x12,0x82,0x67,0x60,0xb0,0x1b,0x9a,0x5d,0xa1,0x90,0x04,0xa9,0x13,
-0xb6,0x60,0x05,0xec,0x50,0x6e,0x10,0x78,0x92,0x80,0x5d,0x00,0x10,0x82,0x03,0xc8,
-0x90,0x07,0xc1,0x5b,0x10,0x85,0x78,0x08,0xf2,0x1d,0xc3,0x82,0xb0,0x00,0x02,0xb7,
-0x84,0xeb,0xb6,0x7a,0xcd,0xac,0x60,0xc0,0x07,0xda,0x8a,0xb3,0x90,0x4c,0x4b,0x11,
-0xb8,0x50,0x31,0xa5,0x51,0x6e,0x00,0x8b,0xd8,0x60,0x8d,0x00,0x00,0x90,0x07,0xa7,
-0x90,0x07,0xb0,0x78,0x00,0x86,0x3e,0x24,0xf3,0x1b,0x93,0x70,0x80,0x00,0x6b,0xeb,
-0x94,0xca,0xa2,0x05,0xfb,0x27,0x64,0x70,0x4a,0xa2,0x8c,0x96,0x40,0x40,0x80,0x34,
-0xb9,0x10,0x4d,0xbb,0x70,0x8a,0x00,0x0c,0x4a,0x00,0x8a,0x00,0x03,0xdc,0x16,0x87,
-0x70,0x67,0x01,0x77,0x89,0x2f,0xf0,0x1c,0x18,0xab,0x81,0xb0,0x00,0x06,0x9a,0x75,
+0xc3,0x08,0xb3,0xcb,0xa8,0x89,0x32,0x00,0xf0,0x09,0x51,0x09,0x20,0x26,0x3a,0x09,
+0x20,0xb2,0x07,0x09,0x22,0x60,0x7b,0xbd,0xbb,0xb8,0x00,0x00,0x00,0x1a,0x3b,0xbb,
+0xbb,0xca,0x08,0x00,0x81,0x89,0x99,0x99,0xaa,0x11,0x11,0x11,0x3a,0x29,0x00,0xf0,
+0x1e,0x06,0xaa,0xaa,0xad,0x50,0x01,0x55,0x55,0x5a,0x40,0x01,0x55,0x55,0x5b,0x30,
+0x0a,0xaa,0xaa,0xad,0xb6,0x04,0x40,0x49,0x02,0x70,0x00,0x96,0x4f,0x7b,0x20,0x00,
+0x19,0xd7,0xb4,0x00,0x0a,0xa3,0x47,0x0a,0x92,0x01,0x07,0xb5,0x00,0x33,0x31,0x00,
+0xf6,0x1f,0x40,0x3c,0xdb,0xe8,0x08,0x80,0x03,0x70,0xb0,0xb6,0x00,0x03,0x70,0xb0,
+0x00,0x52,0x5c,0xda,0xea,0x07,0x90,0x04,0x60,0xb0,0xa7,0x00,0x06,0x50,0xb0,0x10,
+0x45,0x08,0x30,0xb0,0x02,0xc0,0x0c,0x00,0xb0,0x5c,0x10,0x55,0x00,0xb5,0x90,0x00,
+0x01,0x00,0xf0,0x20,0x0c,0x88,0x99,0x04,0xa0,0x0c,0x77,0x89,0x7a,0x00,0x09,0x89,
+0x86,0x40,0x31,0x39,0xad,0x98,0x05,0xa0,0x07,0x88,0x84,0x99,0x00,0x0b,0x00,0x37,
+0x20,0x22,0x08,0x9d,0x93,0x01,0xc1,0x0b,0x1a,0x82,0x2b,0x30,0x23,0x87,0x05,0xb1,
+0x00,0x00,0x32,0xe3,0x02,0xf1,0x0e,0xc0,0xaa,0xac,0xc0,0x1c,0x20,0x00,0x1c,0x30,
+0x01,0x85,0x03,0xd8,0x00,0x03,0xc2,0xa9,0x27,0xc3,0x2c,0xb4,0x41,0x11,0x33,0x11,
+0xb0,0x99,0xe9,0x90,0x23,0x01,0x02,0x05,0x00,0x42,0xb6,0xaa,0xea,0xa7,0x65,0x00,
+0xf0,0x16,0xb1,0x00,0xb0,0x00,0x2b,0x30,0xaa,0xea,0xa2,0x00,0xa5,0x22,0xc2,0x22,
+0x08,0xb4,0x66,0x6a,0x95,0x57,0xb4,0x88,0x8b,0xb5,0x00,0xb0,0x52,0x17,0x61,0x00,
+0xb0,0x59,0x06,0x40,0x00,0xb0,0x09,0x05,0x00,0x50,0x00,0x8c,0x20,0x00,0x21,0x93,
+0x01,0xf0,0x1f,0xc1,0xca,0xaa,0xc0,0x2c,0x20,0xb0,0x00,0xb0,0x01,0x84,0xc9,0x99,
+0xc0,0x04,0xc0,0xb0,0x00,0xb0,0x3c,0xb0,0xca,0xda,0x80,0x11,0xb0,0xb0,0x91,0xa1,
+0x00,0xb0,0xb0,0x4c,0x20,0x00,0xb0,0xb3,0x4a,0x60,0x00,0xb0,0xd8,0x30,0x77,0x00,
+0x10,0xae,0x02,0xf4,0x1b,0x46,0x99,0xc9,0x30,0x67,0x1b,0x00,0xb0,0x00,0x13,0x8b,
+0x99,0xe9,0x92,0x1e,0x2b,0x25,0xc5,0x30,0x9b,0x1b,0x76,0x44,0xb0,0x09,0x1b,0x7a,
+0x88,0xb0,0x09,0x1b,0x79,0x77,0xb0,0x09,0x39,0x79,0x88,0xb0,0x09,0x46,0x74,0xbf,
+0x01,0x01,0xe5,0x02,0xf7,0x1d,0x44,0x84,0x19,0x00,0x85,0x38,0x88,0x4a,0x42,0x06,
+0x6b,0xbb,0x87,0xb4,0x2e,0x16,0x66,0xe4,0xa0,0xbc,0x14,0x44,0x68,0xb0,0x0a,0x0b,
+0x9a,0x0b,0x70,0x0a,0x09,0x0b,0x4b,0x30,0x0a,0x19,0x1a,0x6a,0xa0,0x0a,0x53,0x03,
+0x90,0x56,0x37,0x01,0xf0,0x20,0xa3,0x33,0xc3,0x32,0x0a,0x42,0x55,0xc5,0x53,0x23,
+0x74,0xdb,0x9c,0xa5,0x02,0xc0,0xa8,0x39,0x55,0x2c,0xb0,0x55,0x55,0x52,0x22,0xb5,
+0x99,0xb9,0x97,0x00,0xb0,0x23,0xa0,0x40,0x00,0xb7,0x49,0x22,0x75,0x00,0xb7,0x0b,
+0x9a,0x26,0x00,0x03,0x30,0xd3,0x00,0x10,0xa6,0x3c,0x01,0xf3,0x11,0x09,0x50,0x00,
+0x03,0x0b,0x00,0x02,0x40,0x0b,0x0b,0x00,0x00,0xc0,0x0c,0x0b,0x00,0x00,0x93,0x38,
+0x0b,0x00,0x06,0x57,0x23,0x0b,0x00,0x0b,0x01,0x00,0x0b,0xbb,0xc6,0x5f,0x00,0xf2,
+0x1c,0x08,0x50,0x01,0x20,0x00,0x00,0x8a,0x0b,0x30,0x00,0x07,0x02,0x58,0x00,0x09,
+0x1c,0x02,0xc5,0x20,0x0c,0x0c,0x2c,0x22,0xb0,0x48,0x0d,0xb1,0x00,0x93,0x31,0x5e,
+0x10,0x05,0x25,0x2b,0x8c,0x00,0x0b,0x00,0x22,0x09,0xcb,0xc7,0xe8,0x04,0x51,0x2b,
+0xbb,0xce,0xbb,0xb7,0x0a,0x00,0x80,0x06,0xbb,0xcd,0xbb,0xb0,0x00,0x00,0x61,0x6e,
+0x00,0xf0,0x28,0x5c,0x10,0x00,0x07,0x5a,0x03,0x71,0xb0,0x0c,0x1a,0x00,0x08,0x93,
+0x15,0x0b,0xaa,0xa9,0x25,0x00,0xa0,0x00,0xb0,0x00,0x04,0xc4,0xab,0xeb,0xb0,0x18,
+0xaa,0x00,0xb0,0xb0,0x45,0xa2,0x00,0xb0,0xb0,0x11,0xa5,0xbb,0xfb,0xd9,0x00,0xa0,
+0x06,0xd5,0x00,0x00,0xa0,0x0b,0x1c,0x00,0x00,0xa0,0xeb,0x01,0x47,0xa8,0x70,0x00,
+0x5a,0xf0,0x00,0xf0,0x0a,0x4b,0x11,0x11,0x10,0x02,0xc9,0xe9,0xe9,0xd0,0x0b,0x18,
+0x53,0x90,0xb0,0x01,0x96,0x2b,0x10,0xb0,0x00,0x20,0xb1,0x6b,0x60,0x00,0xca,0x03,
+0xf0,0x03,0x09,0x39,0x0b,0x10,0xa0,0x0a,0x19,0x02,0x18,0x74,0x13,0x0c,0xaa,0xb8,
+0x12,0x00,0x00,0x38,0x91,0x00,0x10,0xdf,0x91,0x00,0xf3,0x12,0xc6,0x90,0x00,0x00,
+0x09,0x80,0xc5,0x00,0x04,0xc7,0x7a,0x1c,0xb3,0x18,0x20,0x46,0x00,0x64,0x05,0x5a,
+0x1b,0x11,0xa0,0x0b,0x2a,0x02,0x27,0x93,0x07,0x0b,0xaa,0xa9,0x35,0x87,0x01,0xf0,
+0x05,0x50,0x80,0x00,0x03,0xc8,0x45,0x9d,0x10,0x03,0x65,0x54,0x34,0x60,0x00,0xe9,
+0x99,0x9e,0x00,0x00,0xd9,0x05,0x00,0xf0,0x06,0x01,0xa1,0x00,0x00,0x04,0x23,0x5c,
+0x02,0x30,0x0c,0x37,0x03,0x15,0xb0,0x27,0x1c,0xba,0xb5,0x52,0x00,0x03,0x32,0x00,
+0xf0,0x21,0x2f,0x99,0x92,0x00,0x02,0xb1,0x01,0xc0,0x00,0x0a,0x9a,0xaa,0xaa,0x90,
+0x00,0x57,0x77,0x78,0x90,0x00,0x11,0x11,0x13,0x90,0x00,0x99,0xba,0x99,0x60,0x01,
+0x24,0x4a,0x00,0x70,0x09,0x59,0x06,0x46,0x57,0x07,0x0c,0xaa,0xab,0x06,0x00,0x13,
+0x00,0x32,0xc0,0x04,0xb0,0xb1,0x00,0x00,0x8b,0xaa,0xd8,0x00,0x00,0xc1,0x11,0x1c,
+0x6e,0x04,0xf3,0x39,0x0c,0x00,0x00,0xcb,0xbb,0xbc,0x00,0x00,0x00,0x84,0x00,0x00,
+0x08,0x2a,0x0b,0x24,0x80,0x1b,0x0a,0x00,0x05,0xa2,0x23,0x0c,0xaa,0xb6,0x11,0x02,
+0x90,0x0a,0x00,0x00,0x06,0xb6,0xae,0xaa,0xa7,0x1a,0x99,0x19,0x07,0x00,0x47,0x93,
+0x56,0x69,0x15,0x13,0x90,0x93,0x79,0x63,0x02,0x91,0xb4,0x4c,0x70,0x02,0x9a,0x30,
+0x7c,0x20,0x02,0x94,0x03,0xb1,0xb1,0x02,0x90,0x3a,0x10,0x38,0x23,0x01,0xf3,0x07,
+0x22,0x00,0x00,0x00,0x66,0xb8,0x66,0x00,0x00,0xc3,0x33,0x3c,0x00,0x00,0xe8,0x88,
+0x8e,0x00,0x00,0xd7,0x77,0x7d,0x0a,0x00,0xf4,0x0b,0x11,0x93,0x11,0x00,0x05,0x34,
+0x1b,0x03,0x80,0x1b,0x56,0x04,0x17,0xb1,0x34,0x2c,0xba,0xb5,0x31,0x00,0xa9,0x88,
+0x8c,0x30,0x00,0xa8,0x05,0x00,0xf0,0x36,0x17,0xc8,0x77,0x7c,0x95,0x02,0x6b,0x32,
+0x6c,0x21,0x05,0xda,0xa9,0x87,0xb0,0x01,0x23,0x5b,0x02,0x50,0x0a,0x3b,0x04,0x34,
+0xb1,0x26,0x08,0x99,0xa5,0x26,0x0a,0x05,0x68,0xb6,0x60,0x4b,0x84,0x8a,0xc8,0x70,
+0x8a,0x44,0x36,0x93,0x31,0x8a,0x05,0x55,0x55,0x52,0x1a,0x05,0xb9,0x99,0xa0,0x0a,
+0x05,0xa8,0x88,0xa0,0x0a,0x05,0xb8,0x89,0xa0,0x0a,0x05,0x50,0x00,0x05,0x00,0x21,
+0x2a,0x70,0xbe,0x06,0xf2,0x0a,0x06,0x99,0xad,0x99,0x90,0x00,0x0b,0x00,0x75,0x00,
+0x09,0x99,0x99,0x99,0x94,0x00,0xc8,0x88,0x8b,0x40,0x00,0xd7,0x77,0x7b,0x40,0x0a,
+0x00,0xe2,0x12,0x77,0x01,0x20,0x08,0x4b,0x06,0x33,0xb0,0x07,0x09,0x99,0xb3,0x32,
+0x74,0x04,0xf3,0x4a,0x99,0x99,0xdc,0xb4,0x0b,0x24,0x43,0xb0,0x40,0x0b,0x36,0x64,
+0xb3,0x80,0x0b,0x6a,0x98,0x7c,0x10,0x2a,0x77,0x68,0x9b,0x16,0x64,0x12,0x45,0x55,
+0xb3,0x02,0x34,0x48,0x01,0x30,0x0c,0x57,0x07,0x17,0xb0,0x34,0x2c,0x99,0x97,0x31,
+0x01,0x90,0xb7,0x77,0xd0,0x04,0xb4,0xb6,0x66,0xd0,0x17,0x99,0x67,0x77,0x80,0x45,
+0x95,0xac,0x8c,0x97,0x12,0x94,0xac,0x7b,0x97,0x01,0x94,0x99,0x99,0x91,0x01,0x90,
+0x49,0x07,0x90,0x01,0x90,0x09,0xec,0x10,0x01,0x98,0xa6,0x25,0xb8,0x22,0x01,0xf3,
+0x49,0x0a,0x1a,0x10,0x7a,0xae,0x09,0x21,0x50,0x42,0x0b,0x4b,0xaa,0xa1,0x1b,0x48,
+0x59,0x60,0x40,0x04,0xe3,0x04,0x77,0x60,0x02,0xf4,0x01,0xcc,0x00,0x0b,0x4c,0x00,
+0xf3,0x21,0xa6,0x03,0x3c,0xa8,0x73,0x00,0x00,0x72,0x09,0xc0,0x00,0x00,0x07,0x48,
+0x50,0x08,0xbb,0xbd,0xcb,0xd4,0x0c,0x00,0x05,0x60,0x20,0x0c,0xaa,0x83,0x74,0x90,
+0x0c,0x00,0xb1,0xab,0x20,0x0b,0x00,0xa0,0xc8,0x00,0x0b,0x5a,0x72,0xe4,0x26,0x48,
+0x01,0x2c,0x3a,0x45,0x82,0x00,0x92,0x07,0xc1,0x5f,0x00,0xf2,0x1c,0x03,0x85,0x80,
+0x0b,0xbb,0xbc,0xdb,0xc6,0x00,0x00,0x01,0xa0,0x00,0x07,0xba,0xd0,0xc0,0xc0,0x07,
+0x20,0xb0,0xc6,0x80,0x06,0xaa,0xc0,0xad,0x00,0x00,0x00,0x41,0xb8,0x06,0x0a,0xcb,
+0x8b,0x7c,0x0a,0x03,0x00,0x85,0x05,0xd6,0xac,0x07,0xf5,0x1d,0x4b,0x31,0xc4,0x60,
+0x04,0x5c,0x41,0xc0,0x61,0x2a,0xbb,0xaa,0xea,0xa6,0x03,0xa9,0x41,0xc0,0x70,0x0d,
+0x8a,0x73,0xa2,0xa0,0x19,0x9b,0x93,0x7c,0x30,0x06,0x9b,0x83,0x5b,0x05,0x06,0xac,
+0xa6,0xbc,0x0a,0x06,0x20,0x0b,0x24,0xc6,0x0a,0x03,0xf4,0x1e,0x10,0x07,0x9b,0x92,
+0x8b,0xa2,0x0c,0x00,0x06,0x60,0x00,0x0e,0xaa,0x96,0x50,0x00,0x0b,0x00,0xa6,0xcb,
+0xd5,0x0e,0xab,0xa7,0x41,0x90,0x0a,0x00,0x08,0x21,0x90,0x29,0x00,0x0b,0x11,0x90,
+0x66,0x00,0x1b,0x01,0x90,0x81,0x00,0x73,0x01,0x6a,0x05,0x60,0x60,0x00,0x00,0x07,
+0xaa,0xeb,0xb0,0x06,0xf5,0x16,0x00,0x01,0xb0,0x0b,0x88,0x88,0x88,0xb0,0x0b,0x33,
+0x33,0x33,0x20,0x0b,0x89,0xe2,0xa9,0xe0,0x0b,0x64,0xa0,0x83,0xa0,0x0a,0x07,0xd0,
+0x08,0xd0,0x46,0x97,0xb2,0xb5,0xb0,0x81,0x06,0xb0,0x07,0xa1,0x04,0x73,0x14,0x20,
+0x05,0xaa,0xbd,0x96,0x20,0xd9,0x03,0x36,0xbe,0xbb,0xb1,0xda,0x08,0x00,0xf2,0x03,
+0x17,0xb8,0xe9,0x08,0x10,0x1b,0xa3,0x00,0xb0,0xa0,0x56,0x66,0x63,0x49,0xd9,0x21,
+0x1c,0x10,0x12,0xb1,0xdf,0x02,0xb4,0xa0,0x00,0x0c,0x00,0x16,0xeb,0x10,0x0c,0x00,
+0x57,0xb0,0x0f,0x00,0x01,0x05,0x00,0x57,0x1b,0x80,0x09,0xb9,0x00,0x01,0x00,0x10,
+0x0b,0x13,0x05,0x00,0x76,0x08,0xf3,0x19,0x00,0x02,0xae,0x78,0xea,0xba,0x00,0x00,
+0xb0,0x0a,0x01,0xa0,0x00,0x1d,0x97,0xb0,0x1a,0x00,0x3a,0xc0,0x1d,0xb4,0xa0,0x00,
+0x0b,0x06,0x42,0x5a,0x00,0x00,0xb2,0xb0,0x00,0xa8,0x00,0xb7,0xa1,0x00,0x08,0xa0,
+0x38,0x00,0xc0,0xa0,0x00,0x73,0x00,0x29,0xd7,0x89,0x99,0x94,0x02,0xb1,0x91,0x0f,
+0x00,0xb0,0x91,0x00,0x00,0x05,0xe9,0xa0,0x00,0x00,0x28,0xb0,0xb0,0x0f,0x00,0x00,
+0x05,0x00,0x74,0xa2,0x90,0x00,0x00,0x0b,0x89,0x20,0x6a,0x00,0xa2,0xb0,0x45,0x55,
+0x54,0xae,0xa1,0x11,0x1c,0x00,0xb0,0x70,0x00,0x73,0x0b,0x03,0xda,0x6a,0xaa,0xe4,
+0x7c,0x83,0x00,0x88,0xb0,0x0b,0x09,0xbb,0xbe,0x1a,0x90,0x00,0xa2,0x05,0xb0,0xb0,
+0xbb,0xbf,0xa0,0x15,0xc4,0x00,0x8a,0x00,0x27,0xd6,0xda,0x02,0xf3,0x0e,0xb0,0x9c,
+0xdd,0xcc,0x02,0xd9,0x0a,0x1a,0x0b,0x39,0xc0,0x67,0x37,0x0a,0x00,0xb2,0x70,0xb0,
+0x28,0x00,0xb0,0x1b,0x30,0x56,0x0b,0x70,0xa2,0x09,0xb1,0x32,0x00,0xf0,0x3d,0x0b,
+0x18,0x00,0x49,0xd8,0x0a,0x14,0x60,0x02,0xb1,0xbe,0xc9,0x71,0x00,0xb0,0x06,0x51,
+0x60,0x16,0xeb,0x04,0x89,0x30,0x47,0xb0,0x01,0xd9,0x00,0x00,0xb0,0x02,0xf2,0x13,
+0x00,0xb0,0x5b,0x6a,0x57,0x1a,0x80,0x70,0x07,0xd1,0x00,0xb0,0x00,0x92,0x00,0x29,
+0xe8,0x5a,0xaa,0xb1,0x01,0xc1,0x64,0x00,0x91,0x00,0xb0,0x64,0x00,0x91,0x04,0xea,
+0x7c,0xbb,0xe1,0x36,0xb0,0x82,0x00,0x20,0x00,0xb0,0xa0,0xbe,0x06,0x65,0xa0,0x00,
+0x00,0x0b,0x96,0x30,0x91,0x00,0xd0,0x9b,0xaa,0xe0,0x25,0xd5,0x91,0x00,0xc0,0x15,
+0xd5,0x91,0x79,0x60,0x0f,0x00,0xf7,0x0c,0xa2,0x16,0xeb,0x97,0x50,0xb0,0x47,0xc0,
+0x91,0xb3,0xa0,0x00,0xb0,0x91,0x5e,0x20,0x00,0xb0,0x91,0x9c,0x80,0x3b,0x90,0x9a,
+0x50,0x76,0x00,0xc8,0x00,0xf3,0x1c,0x00,0xa1,0x00,0x18,0xe7,0x7a,0xba,0xa5,0x01,
+0xc1,0x03,0x00,0x50,0x00,0xb0,0x0b,0x01,0xb0,0x18,0xe8,0x0b,0x03,0x80,0x13,0xb0,
+0x09,0x16,0x40,0x00,0xb0,0x06,0x3a,0x00,0x00,0xb2,0x99,0x9d,0x97,0x09,0x90,0x11,
+0x11,0x11,0x32,0x00,0xf0,0x10,0xab,0xbb,0xb2,0x38,0xd8,0xa1,0x00,0x00,0x12,0xc2,
+0xab,0xbb,0x90,0x00,0xb0,0xa1,0x00,0xa0,0x16,0xeb,0xa1,0x00,0xa0,0x36,0xb0,0xab,
+0xaa,0xa0,0x00,0xb0,0xa1,0x23,0x00,0x81,0xa3,0x11,0x10,0x1a,0x80,0x69,0x99,0x94,
+0x9a,0x02,0xf8,0x4b,0x08,0x21,0xa5,0x00,0xb0,0x7c,0xa2,0xa9,0x21,0xa0,0x19,0x41,
+0xa2,0x92,0x90,0x08,0x21,0xa0,0x64,0x70,0x3c,0xc3,0xa0,0x07,0x40,0x7b,0x21,0xa4,
+0x6c,0x80,0x08,0x22,0xe9,0x39,0xb1,0x08,0x26,0x61,0xc2,0x66,0x5c,0x10,0x07,0x40,
+0x15,0x01,0x90,0x43,0xa1,0x70,0x29,0xd5,0xb4,0xd3,0x53,0x03,0xa1,0x7a,0xa6,0x65,
+0x01,0xa1,0x0a,0xa8,0x81,0x18,0xe7,0x1f,0x32,0xc0,0x26,0x90,0xa6,0xa7,0x70,0x01,
+0x97,0xa0,0x9d,0x00,0x01,0x96,0x05,0xcb,0x60,0x0b,0x70,0x88,0x00,0x89,0xc8,0x00,
+0xf1,0x12,0x9d,0xab,0xd0,0x29,0xe8,0x08,0x4b,0x40,0x01,0xb1,0x04,0xf9,0x00,0x00,
+0xb0,0xa9,0x28,0xc4,0x04,0xe8,0x32,0xb2,0x32,0x25,0xb0,0x46,0xd6,0x60,0x00,0xb1,
+0xaa,0xea,0xa6,0xfe,0x07,0x10,0x0a,0x0a,0x08,0x04,0xfa,0x00,0xf0,0x0f,0xc3,0x00,
+0x02,0xc2,0x06,0x8a,0x00,0x17,0xd7,0x5a,0x02,0xb1,0x00,0xb1,0xaa,0xaa,0x77,0x02,
+0xda,0x01,0x11,0x00,0x39,0xd1,0x6b,0x99,0xc0,0x00,0xb0,0x65,0x30,0x00,0x63,0x6b,
+0x99,0xc0,0x0a,0x90,0x65,0x33,0x00,0xf4,0x1d,0x07,0x30,0x11,0xb1,0x10,0x7c,0xa2,
+0x66,0xd6,0x50,0x18,0x43,0x55,0xc5,0x51,0x07,0x43,0x55,0x5c,0x51,0x6d,0xb6,0x88,
+0x8d,0x92,0x48,0x30,0x62,0x1b,0x20,0x07,0x30,0x57,0x0a,0x00,0x07,0x30,0x08,0x0a,
+0x00,0x5c,0x10,0x00,0xac,0x64,0x00,0xf0,0x18,0x73,0x25,0x40,0x38,0xe8,0x79,0x52,
+0x22,0x01,0xc1,0x68,0x44,0x95,0x00,0xb0,0x16,0x77,0x50,0x16,0xeb,0x4a,0xaa,0xa0,
+0x35,0xb0,0x74,0x11,0xb0,0x00,0xb0,0x79,0x77,0xd0,0x00,0xb0,0x7a,0x88,0xd0,0x0a,
+0xa0,0x0c,0x03,0x32,0x00,0xf2,0x1c,0x11,0xa3,0x11,0x39,0xe7,0xc5,0x85,0x5b,0x01,
+0xb1,0x92,0xa0,0x09,0x00,0xb2,0xac,0xca,0xa9,0x02,0xeb,0x0c,0x02,0xa0,0x4a,0xc0,
+0x69,0x07,0x50,0x00,0xb0,0x08,0xbc,0x00,0x00,0xb0,0x04,0xcb,0x80,0x0a,0x80,0xb8,
+0x00,0x78,0xaa,0x0a,0xe0,0xa0,0xba,0xaa,0xa5,0x29,0xd6,0xb4,0x77,0x71,0x02,0xb1,
+0xb1,0x33,0x30,0x0f,0x00,0xf6,0x0b,0xa6,0x06,0xe8,0xb5,0x47,0x22,0x38,0xa0,0xb5,
+0x48,0xa1,0x01,0xa0,0xb5,0x45,0x50,0x01,0xa3,0x85,0x75,0xb2,0x0a,0x85,0x48,0x81,
+0x26,0x30,0x01,0xf2,0x1e,0x01,0x90,0x0b,0x53,0x20,0x15,0xb2,0x87,0x4c,0x40,0x16,
+0xb5,0xe9,0xcb,0xc0,0x01,0x90,0xb0,0xb0,0xb0,0x06,0xe7,0xb0,0xb0,0xb0,0x27,0xa4,
+0xbb,0xfb,0xb7,0x01,0x90,0x09,0x89,0x00,0x01,0x90,0x78,0x07,0x70,0x0b,0x79,0x60,
+0x00,0x58,0xfd,0x07,0xf6,0x1d,0x25,0xca,0xaa,0xe0,0x4b,0x77,0x40,0x00,0xb0,0x4b,
+0x76,0xca,0xea,0xa0,0x08,0x25,0x40,0xb0,0x00,0x1a,0x98,0xa9,0xe9,0x95,0x4a,0x27,
+0x79,0xe9,0x90,0x08,0x29,0x90,0x00,0xa0,0x08,0x3a,0x91,0x00,0xa0,0x5c,0x46,0x99,
+0x99,0xd0,0x69,0x00,0xf4,0x1e,0x08,0x25,0x99,0xe9,0x91,0x5b,0x82,0x44,0xc4,0x30,
+0x3a,0x61,0x55,0xc5,0xb0,0x08,0x37,0x99,0xe9,0xe4,0x4c,0xc3,0x66,0xd6,0xb0,0x49,
+0x21,0x82,0xb2,0x10,0x08,0x25,0x90,0xd9,0x70,0x08,0x2a,0xa4,0xa0,0x00,0x5c,0x47,
+0x08,0xaa,0xa3,0x9a,0x01,0xf0,0x12,0x98,0x00,0x19,0xe7,0x59,0xa8,0x94,0x01,0xc1,
+0x00,0xa8,0x00,0x00,0xb0,0x5a,0xa8,0xa3,0x16,0xea,0x00,0xa8,0x00,0x14,0xb0,0x8b,
+0xa8,0xa5,0x00,0xb0,0x00,0xa8,0x10,0x00,0xf3,0x03,0x20,0x09,0x90,0x05,0x00,0xf2,
+0x1d,0x10,0x15,0x71,0x10,0x2a,0x43,0xb9,0x8b,0x90,0x5c,0x70,0x35,0x1a,0x00,0x09,
+0x17,0xac,0xba,0xa2,0x0a,0xb0,0x0b,0x10,0x00,0x9d,0x28,0xcb,0x9e,0x93,0x09,0x10,
+0xd3,0x2a,0x00,0x09,0x10,0x1b,0xf8,0x00,0x5b,0x09,0xa6,0x06,0xa0,0x91,0x00,0xf2,
+0x12,0x21,0x23,0xb2,0x20,0x7d,0xba,0x64,0x44,0xb0,0x08,0x25,0x5a,0x1a,0x50,0x08,
+0x23,0xb1,0x02,0x80,0x3c,0xb2,0x99,0x99,0x40,0x7a,0x20,0x11,0xc1,0x00,0x08,0x20,
+0x00,0xb0,0x05,0x00,0xf0,0x12,0x6c,0x09,0xaa,0xea,0xa1,0x08,0x30,0x72,0x91,0x00,
+0x7c,0xa3,0xda,0xdb,0xa3,0x18,0x49,0xb0,0xb0,0x00,0x08,0x49,0xda,0xea,0xa1,0x3b,
+0xc3,0xa0,0xb0,0x00,0x6a,0x30,0xda,0x1e,0x00,0xf0,0x22,0xa0,0xb0,0x00,0x08,0x30,
+0xda,0xea,0xa5,0x5c,0x10,0xa0,0x00,0x00,0x08,0x10,0x0a,0x0b,0x00,0x7d,0xa6,0x8d,
+0x7d,0x72,0x19,0x30,0x0a,0x0b,0x00,0x08,0x21,0xaf,0xaf,0x90,0x5d,0xb3,0xa0,0x90,
+0xb0,0x4a,0x11,0xea,0xda,0xd0,0x08,0x11,0xa0,0x90,0xb0,0x08,0x0a,0x00,0x20,0x6c,
+0x01,0xef,0x08,0x02,0x8c,0x00,0xf7,0x1c,0xd8,0x88,0xb0,0x7c,0xa3,0xc7,0x77,0xb0,
+0x19,0x31,0xd8,0x88,0xb0,0x08,0x20,0x22,0x22,0x10,0x1b,0xc7,0x99,0xe9,0x92,0x9c,
+0x20,0x90,0xb0,0x00,0x08,0x23,0xc0,0xd8,0x60,0x08,0x29,0x96,0xb0,0x00,0x5c,0x38,
+0x06,0xaa,0xa4,0x1f,0x0a,0xf4,0x1d,0x11,0x98,0xd4,0x00,0x5d,0xa3,0x33,0xc3,0x30,
+0x19,0x34,0x66,0xd6,0x60,0x09,0x22,0x96,0xa5,0x60,0x5d,0xb7,0x60,0xa1,0x90,0x3a,
+0x15,0xc8,0xa7,0xb0,0x09,0x15,0x60,0xa0,0x80,0x09,0x15,0xc9,0xe9,0xb0,0x3c,0x05,
+0x60,0x00,0x80,0xf1,0x01,0xf5,0x20,0x24,0x30,0x08,0x25,0xaa,0x85,0x50,0x5b,0x82,
+0xa4,0x58,0x30,0x4a,0x76,0xca,0xad,0x90,0x08,0x23,0x6a,0x44,0x41,0x09,0xa7,0xa8,
+0x55,0x51,0x9c,0x40,0xbc,0x9b,0x60,0x08,0x20,0xbb,0x3c,0x10,0x08,0x29,0x44,0xf9,
+0x00,0x5c,0x66,0x88,0x26,0xb2,0x6d,0x00,0xf7,0x4c,0x20,0x07,0x35,0x99,0xa9,0x70,
+0x3a,0x72,0x62,0x62,0x90,0x3a,0x70,0x90,0x46,0x20,0x07,0x33,0xda,0xda,0xa1,0x1a,
+0xc6,0x10,0xb0,0x00,0x7b,0x38,0xaa,0xea,0xa5,0x07,0x34,0x30,0xb0,0x80,0x07,0x36,
+0xa8,0xd8,0xb0,0x5c,0x10,0x11,0x11,0xa0,0x08,0x11,0x2b,0x2c,0x20,0x08,0x15,0x7d,
+0x7d,0x70,0x6c,0x93,0x98,0x69,0x60,0x08,0x12,0xd8,0x89,0x90,0x2b,0xb5,0xc6,0x68,
+0x90,0x6b,0x20,0x23,0x92,0x10,0x08,0x19,0x9d,0xea,0x91,0x08,0x10,0x3a,0x29,0x00,
+0x6c,0x1a,0x91,0x04,0xb1,0x26,0x02,0xf0,0x1d,0x24,0xa7,0xc5,0x30,0x5b,0x81,0xa1,
+0xa8,0x20,0x4a,0x78,0xab,0xec,0x92,0x08,0x30,0x58,0xba,0x10,0x4c,0xcb,0x81,0x82,
+0xb3,0x5a,0x22,0xc7,0xd7,0xb0,0x08,0x21,0xd8,0xd8,0xa0,0x08,0x21,0x90,0xa0,0xa0,
+0x5c,0x11,0xc8,0x88,0xa0,0xf0,0x1f,0x09,0x10,0xb8,0x8c,0x00,0x5c,0x80,0xb7,0x7c,
+0x00,0x1a,0x36,0x97,0x69,0x70,0x09,0x19,0x09,0x90,0x90,0x0b,0xdb,0x8b,0xa8,0xc0,
+0x4b,0x19,0xac,0xca,0xa1,0x09,0x10,0x4e,0xe5,0x00,0x09,0x15,0xb5,0x6a,0x50,0x3b,
+0x38,0x04,0x60,0x71,0x00,0x01,0x00,0xf2,0x1f,0x07,0x22,0x35,0xa3,0x30,0x2a,0x68,
+0xa4,0x64,0xa0,0x3a,0x72,0xab,0x8a,0x90,0x07,0x26,0x79,0x0b,0x20,0x3b,0xb4,0xb8,
+0x86,0x90,0x39,0x25,0x99,0x99,0x70,0x07,0x20,0x60,0xa5,0x00,0x07,0x24,0x90,0xa3,
+0x70,0x2b,0x16,0x09,0x80,0x60,0x00,0x01,0x00,0x81,0x65,0x00,0x00,0x2b,0xbb,0xdd,
+0xbb,0xb2,0x0a,0x00,0xf1,0x0f,0x08,0xbb,0xdd,0xbb,0x20,0x00,0x93,0x00,0x2b,0x00,
+0x00,0x0b,0x21,0xb2,0x00,0x00,0x01,0xdd,0x20,0x00,0x15,0x9c,0x66,0xc9,0x51,0x36,
+0x20,0x00,0x02,0x62,0x30,0x00,0xf0,0x27,0x03,0x0b,0x06,0x50,0x00,0x0b,0x0b,0x0a,
+0xba,0xa5,0x0b,0x0b,0x1e,0x11,0xb0,0x0b,0x0b,0xaa,0x44,0x70,0x0b,0x0b,0x31,0xa9,
+0x30,0x0c,0x7e,0x00,0x9b,0x00,0x3c,0x5c,0x00,0x9b,0x00,0x00,0x0b,0x08,0x87,0x90,
+0x00,0x0b,0x77,0x00,0x75,0x00,0x00,0x00,0x50,0x00,0x00,0xbb,0xb9,0x0c,0x3a,0x00,
+0xf2,0x4d,0xb2,0xeb,0xb9,0x00,0x00,0x0b,0x98,0x0a,0x10,0x0b,0xbb,0xcc,0xc0,0xb0,
+0x00,0xb0,0x00,0x29,0x59,0x00,0x0b,0x00,0x00,0x4e,0x30,0x00,0xb2,0x78,0x05,0xf2,
+0x00,0x1f,0xa4,0x06,0xb2,0xc4,0x00,0x10,0x02,0x80,0x01,0x70,0x00,0x50,0x00,0x60,
+0x00,0x00,0x82,0x01,0xa0,0x00,0x5c,0xca,0xa5,0xdb,0xb6,0x04,0x60,0x0b,0x50,0xb0,
+0x05,0xdb,0x9d,0x92,0x80,0x05,0x54,0x92,0xb7,0x40,0x07,0x44,0x60,0x8c,0x00,0x09,
+0x25,0x60,0x7c,0x00,0x0c,0x06,0x55,0xb8,0x80,0x74,0x7c,0x8a,0x00,0x96,0xcc,0x00,
+0xf0,0x1f,0x91,0x02,0x80,0x00,0x4a,0xda,0x97,0xcb,0xb6,0x00,0xa2,0x1d,0x30,0xb0,
+0x00,0x91,0x7b,0x73,0x80,0x0d,0xcc,0xa0,0xb8,0x30,0x0a,0x02,0x80,0x9b,0x00,0x0a,
+0x02,0x80,0xab,0x00,0x0e,0xbb,0x8a,0x67,0x90,0x03,0x00,0x83,0x00,0x54,0x00,0x40,
+0x9b,0x00,0xf2,0x4f,0x93,0x00,0xb0,0x00,0x4a,0xaa,0x92,0xeb,0xb4,0x0b,0x16,0x57,
+0x50,0xb0,0x58,0x05,0x9d,0x82,0x80,0x25,0x8b,0x03,0xb7,0x40,0x00,0xa8,0x00,0x7c,
+0x00,0x02,0xab,0x30,0x9c,0x00,0x3b,0x11,0x49,0x74,0xb1,0x10,0x00,0x43,0x00,0x33,
+0x03,0x00,0x00,0x30,0x00,0x0c,0x33,0x31,0xa0,0x00,0x4a,0x66,0x66,0xb7,0x72,0xab,
+0x9a,0x6b,0x74,0xb1,0x0a,0x82,0xbc,0x93,0x70,0x8d,0xbb,0xd4,0xa8,0x30,0x37,0x73,
+0x70,0x7b,0x00,0x5c,0xcc,0xc2,0x8b,0x00,0x00,0x06,0x44,0x96,0x60,0x00,0x7b,0x3a,
+0x00,0xa2,0x96,0x00,0xf1,0x1d,0x85,0x70,0xb0,0x00,0x79,0xda,0xa3,0xea,0xa5,0x12,
+0x82,0x67,0x60,0xb0,0x1b,0x9a,0x5d,0xa1,0x90,0x04,0xa9,0x13,0xb6,0x60,0x05,0xec,
+0x50,0x6e,0x10,0x78,0x92,0x80,0x5d,0x00,0x10,0x82,0x03,0xc8,0x90,0x07,0xc1,0x5b,
+0x10,0x85,0x31,0x00,0xf1,0x1e,0x14,0xc3,0x82,0xb0,0x00,0x02,0xb7,0x84,0xeb,0xb6,
+0x7a,0xcd,0xac,0x60,0xc0,0x07,0xda,0x8a,0xb3,0x90,0x4c,0x4b,0x11,0xb8,0x50,0x31,
+0xa5,0x51,0x6e,0x00,0x8b,0xd8,0x60,0x8d,0x00,0x00,0x90,0x07,0xa7,0x90,0x07,0xb0,
+0x78,0x00,0x86,0x32,0x00,0xf1,0x1e,0x16,0x93,0x70,0x80,0x00,0x6b,0xeb,0x94,0xca,
+0xa2,0x05,0xfb,0x27,0x64,0x70,0x4a,0xa2,0x8c,0x96,0x40,0x40,0x80,0x34,0xb9,0x10,
+0x4d,0xbb,0x70,0x8a,0x00,0x0c,0x4a,0x00,0x8a,0x00,0x03,0xdc,0x16,0x87,0x70,0x67,
+0x01,0x77,0x00,0x83,0x32,0x00,0xf0,0x21,0x18,0xab,0x81,0xb0,0x00,0x06,0x9a,0x75,
 0xd9,0xe6,0x0b,0x9b,0xc5,0x99,0x50,0x01,0xcc,0x40,0x6f,0x30,0x1b,0x56,0x59,0x81,
 0xb7,0x06,0x99,0x89,0x88,0x81,0x01,0x52,0x5d,0xbb,0x40,0x00,0xa0,0x46,0x00,0x00,
-0x2a,0xea,0xbc,0xdc,0x11,0x13,0x33,0xfc,0x16,0x20,0x2b,0xbb,0x38,0x0f,0x20,0x75,
-0x00,0xc0,0x28,0x00,0x75,0x17,0x20,0x05,0x92,0xe2,0x17,0xf4,0x00,0x9d,0x20,0x00,
-0x00,0x05,0xc9,0xa1,0x00,0x06,0xc9,0x00,0x4c,0x93,0x17,0x10,0xf0,0x18,0xf4,0x1b,
-0x00,0x79,0x01,0x20,0xb0,0x07,0x84,0xa2,0x95,0xb0,0x8d,0xaa,0x72,0x01,0xb0,0x00,
-0x73,0x06,0x90,0xb0,0x5a,0xdc,0xa0,0x42,0xb0,0x06,0x75,0x41,0x47,0xe8,0x2a,0x74,
-0xa8,0x74,0xb0,0x74,0x73,0x61,0x00,0xb0,0x05,0xc1,0x5b,0x29,0xf0,0x13,0x59,0x33,
-0x68,0x83,0xa8,0x98,0x0b,0x00,0x0a,0x6c,0x62,0xa0,0x00,0xa4,0xe6,0x2e,0xbe,0xaa,
-0x5d,0xa1,0xa0,0xb0,0xba,0xa3,0x39,0x0b,0x0b,0x19,0x03,0x80,0xb0,0xba,0xba,0x93,
-0x35,0x17,0x08,0xa1,0x08,0xf5,0x1e,0x0a,0x05,0x52,0x7a,0x91,0x6e,0xac,0xca,0x20,
-0x00,0x0b,0x6a,0x59,0x00,0x00,0x0b,0x27,0x59,0xbe,0xb6,0x0c,0x9b,0x59,0x09,0x10,
-0x1b,0x16,0x6a,0x09,0x10,0x7a,0x9a,0x8b,0x09,0x10,0x1b,0x0a,0x48,0x09,0x10,0x63,
-0x01,0xa1,0x09,0x10,0x0f,0x0a,0xf3,0x1f,0x40,0x38,0xca,0x84,0xa9,0x60,0x08,0x16,
-0x57,0x40,0x00,0x29,0x6b,0x57,0x73,0x32,0x25,0xa7,0x58,0xa8,0xd4,0x49,0xca,0x98,
-0x40,0xa0,0x05,0x75,0x28,0x30,0xa0,0x1a,0x75,0x8a,0x10,0xa0,0x64,0x73,0x7c,0x00,
-0xa0,0x02,0xb1,0x36,0x00,0xa0,0xea,0x2d,0x01,0x78,0x2c,0x60,0xbd,0xbb,0xb6,0x00,
-0x07,0x40,0x9d,0x04,0x10,0x51,0xf6,0x35,0xf0,0x00,0xa9,0x9c,0x40,0x00,0x0b,0x00,
-0x08,0x30,0x00,0x67,0x00,0x09,0x10,0x03,0xc1,0xce,0x29,0x33,0x20,0x0b,0xb8,0x8b,
-0x04,0x20,0x10,0x03,0x0d,0x35,0xf2,0x1c,0x1b,0x11,0x10,0x8b,0xda,0xaa,0x99,0x93,
-0x0a,0x00,0xc5,0x55,0x50,0x0b,0xb9,0x15,0xc5,0xc0,0x0a,0x0b,0x25,0xa0,0x40,0x0a,
-0x0b,0x46,0xaa,0x90,0x0a,0x0b,0x68,0xa0,0x00,0x45,0x0a,0xaa,0xc0,0x00,0x92,0xb7,
-0x71,0xa9,0xa3,0x09,0x0c,0x02,0xdf,0x1a,0x13,0x56,0x77,0x19,0x00,0x9d,0x03,0x12,
-0xb8,0x9a,0x2d,0x20,0x02,0xaa,0xd5,0x19,0xc2,0x3a,0x10,0x03,0x00,0xa7,0x0a,0x10,
-0x0b,0x1d,0x60,0x06,0xcb,0x53,0x2e,0x50,0xbb,0xbb,0xbb,0x8b,0x00,0xfa,0x20,0x50,
-0x00,0xbc,0x00,0x00,0x1b,0x55,0x26,0x02,0x0e,0x00,0x40,0xbe,0xbb,0xbb,0xcb,0x37,
-0x1d,0xf0,0x06,0xaa,0xa0,0x00,0x0b,0x0b,0x0b,0x37,0x77,0xd7,0xb0,0xb2,0x44,0x4d,
-0x4e,0xae,0x09,0x00,0xb0,0xb0,0xb0,0x67,0xef,0x29,0x72,0x90,0xb0,0xea,0xd0,0x00,
-0x0b,0x06,0x92,0x27,0xf2,0x1c,0x0b,0xb8,0x00,0xea,0xe0,0xcb,0xbe,0x1b,0x0b,0x0b,
+0x2a,0xea,0xbc,0xaa,0xa7,0x00,0x00,0x33,0x34,0x00,0x10,0x2b,0x2b,0x02,0xf2,0x17,
+0xbd,0xbb,0xb8,0x00,0x75,0x00,0x0c,0x00,0x00,0x0c,0x00,0x67,0x00,0x00,0x05,0x92,
+0xc0,0x00,0x00,0x00,0x9d,0x20,0x00,0x00,0x05,0xc9,0xa1,0x00,0x06,0xc9,0x00,0x4c,
+0x93,0x17,0x10,0x00,0x00,0x34,0xfa,0x00,0xf0,0x1d,0x79,0x01,0x20,0xb0,0x07,0x84,
+0xa2,0x95,0xb0,0x8d,0xaa,0x72,0x01,0xb0,0x00,0x73,0x06,0x90,0xb0,0x5a,0xdc,0xa0,
+0x42,0xb0,0x06,0x75,0x41,0x47,0xe8,0x2a,0x74,0xa8,0x74,0xb0,0x74,0x73,0x61,0x00,
+0xb0,0x05,0xc1,0x00,0x00,0xb0,0x30,0x00,0xf2,0x18,0x0a,0x59,0x33,0x68,0x83,0xa8,
+0x98,0x0b,0x00,0x0a,0x6c,0x62,0xa0,0x00,0xa4,0xe6,0x2e,0xbe,0xaa,0x5d,0xa1,0xa0,
+0xb0,0xba,0xa3,0x39,0x0b,0x0b,0x19,0x03,0x80,0xb0,0xba,0xba,0x93,0x0b,0x00,0x00,
+0x0a,0x2d,0x00,0x02,0x01,0x00,0xf1,0x1e,0x0a,0x05,0x52,0x7a,0x91,0x6e,0xac,0xca,
+0x20,0x00,0x0b,0x6a,0x59,0x00,0x00,0x0b,0x27,0x59,0xbe,0xb6,0x0c,0x9b,0x59,0x09,
+0x10,0x1b,0x16,0x6a,0x09,0x10,0x7a,0x9a,0x8b,0x09,0x10,0x1b,0x0a,0x48,0x09,0x10,
+0x63,0x01,0xa1,0x09,0x10,0x33,0x00,0x00,0x5b,0x02,0xf0,0x22,0x40,0x38,0xca,0x84,
+0xa9,0x60,0x08,0x16,0x57,0x40,0x00,0x29,0x6b,0x57,0x73,0x32,0x25,0xa7,0x58,0xa8,
+0xd4,0x49,0xca,0x98,0x40,0xa0,0x05,0x75,0x28,0x30,0xa0,0x1a,0x75,0x8a,0x10,0xa0,
+0x64,0x73,0x7c,0x00,0xa0,0x02,0xb1,0x36,0x00,0xa0,0x00,0x00,0x22,0x38,0x00,0xf2,
+0x1b,0x2a,0x00,0x00,0x0b,0xbb,0xbd,0xbb,0xb6,0x00,0x07,0x40,0x00,0x00,0x00,0x09,
+0x51,0x11,0x00,0x00,0x0b,0xa9,0x9c,0x40,0x00,0x0b,0x00,0x08,0x30,0x00,0x67,0x00,
+0x09,0x10,0x03,0xc1,0x00,0x0c,0x00,0x1c,0x20,0x0b,0xb8,0x68,0x00,0xf1,0x23,0x01,
+0x10,0x03,0x00,0x00,0x03,0x90,0x1b,0x11,0x10,0x8b,0xda,0xaa,0x99,0x93,0x0a,0x00,
+0xc5,0x55,0x50,0x0b,0xb9,0x15,0xc5,0xc0,0x0a,0x0b,0x25,0xa0,0x40,0x0a,0x0b,0x46,
+0xaa,0x90,0x0a,0x0b,0x68,0xa0,0x00,0x45,0x0a,0xaa,0xc0,0x00,0x92,0xb7,0x71,0xa9,
+0xa3,0x37,0x00,0x80,0x06,0xbb,0xbb,0xbb,0xb1,0x00,0x00,0x56,0x0c,0x00,0x12,0x74,
+0x9d,0x03,0xf0,0x0c,0xb8,0x00,0x00,0xbb,0x10,0x00,0x00,0x02,0xaa,0x10,0x00,0x00,
+0x0b,0x3a,0x10,0x03,0x00,0xa7,0x0a,0x10,0x0b,0x1d,0x60,0x06,0xcb,0xc6,0x01,0x26,
+0x00,0xf2,0x03,0xbb,0xbb,0xbb,0x8b,0x00,0x00,0x0b,0xb0,0x00,0x00,0xbc,0x00,0x00,
+0x1b,0xeb,0xbb,0xbb,0xbb,0x0e,0x00,0xf1,0x1a,0xbe,0xbb,0xbb,0xcb,0xb0,0x00,0x00,
+0xa0,0xaa,0xa0,0x00,0x0b,0x0b,0x0b,0x37,0x77,0xd7,0xb0,0xb2,0x44,0x4d,0x4e,0xae,
+0x09,0x00,0xb0,0xb0,0xb0,0x67,0x0b,0x0b,0x0b,0x00,0x90,0xb0,0xea,0xd0,0x00,0x0b,
+0x06,0x00,0x7f,0x01,0xf2,0x1c,0x0b,0xb8,0x00,0xea,0xe0,0xcb,0xbe,0x1b,0x0b,0x0b,
 0x00,0x91,0xb0,0xb0,0xb6,0x6c,0x1e,0xae,0x0b,0x55,0xb1,0xb0,0xb0,0xc2,0x2a,0x1e,
 0xae,0x0c,0x66,0xc1,0x90,0x02,0x70,0x09,0x10,0x00,0xa2,0x00,0x91,0x00,0x56,0x00,
-0xbc,0xdf,0x00,0xf1,0x13,0xd9,0x99,0x9a,0x80,0x01,0xd7,0x77,0x79,0x80,0x01,0xa1,
+0xbc,0xdf,0x00,0xf2,0x4b,0xd9,0x99,0x9a,0x80,0x01,0xd7,0x77,0x79,0x80,0x01,0xa1,
 0x11,0x14,0x80,0x00,0xb9,0x99,0x99,0x50,0x01,0xe2,0x27,0x11,0x10,0x0b,0x76,0x8c,
-0x66,0x60,0x02,0x89,0xad,0x99,0x40,0x1c,0x0b,0xf0,0x20,0x1a,0xaa,0xbd,0xaa,0xa6,
-0x77,0x40,0x0a,0x00,0x0b,0x1a,0x5b,0xea,0xb0,0xa0,0xa6,0x3a,0x0a,0x0d,0x9a,0x63,
-0xb0,0xa0,0xa0,0xbd,0xce,0xae,0x6a,0x0a,0x01,0xe7,0x00,0xea,0x90,0x75,0xb0,0x07,
-0x00,0x6a,0x04,0xb1,0x00,0x27,0x00,0x04,0x50,0x02,0x20,0x0d,0x02,0x05,0x00,0x40,
-0xa3,0x33,0x38,0x40,0xd7,0x36,0x11,0x10,0x42,0x00,0x30,0x00,0x92,0x28,0xcb,0x3a,
-0xd2,0x2d,0xaa,0x70,0x06,0x8b,0x48,0x00,0x00,0x2a,0x03,0xac,0xba,0xa7,0xf5,0x04,
-0xe1,0xb9,0x99,0x9d,0x10,0x07,0x40,0x00,0x0a,0x10,0x07,0xa8,0x88,0x8d,0x10,0x0f,
-0x00,0xf2,0x06,0x03,0x09,0x07,0x21,0x30,0x08,0x2a,0x08,0x3a,0x20,0x01,0x7a,0x08,
-0x55,0x00,0x79,0x9e,0xad,0xb9,0x93,0x11,0xf2,0x13,0x20,0x00,0x01,0x96,0x00,0xf0,
-0x02,0x58,0x00,0x07,0xba,0xdb,0xda,0xb1,0x00,0xb2,0x82,0x87,0x30,0x29,0xbb,0xdb,
-0xdc,0x96,0x69,0x00,0x60,0x20,0x00,0xc3,0x33,0x38,0x50,0x52,0x21,0x10,0x50,0x72,
-0x1b,0x02,0x0a,0x00,0xf1,0x1e,0x07,0x98,0x88,0x8d,0x00,0x07,0x97,0x77,0x7d,0x00,
-0x06,0x98,0xa8,0x8a,0x00,0x69,0x99,0xea,0x99,0x91,0x01,0x77,0x77,0x76,0x00,0x04,
-0x71,0x11,0x1b,0x00,0x02,0x98,0xc9,0x87,0x00,0x04,0xb1,0x92,0x89,0x10,0x57,0x07,
-0xc1,0x02,0x90,0x1e,0x1b,0xf0,0x13,0x49,0xe9,0x95,0x99,0x80,0x0a,0x25,0x07,0x20,
-0x00,0x3a,0xad,0x99,0x9d,0x94,0x26,0x8d,0x9a,0x0a,0x00,0x13,0x38,0x08,0x09,0x00,
-0x03,0xb8,0x88,0x8c,0x00,0x04,0xb8,0x88,0x8e,0xb8,0x21,0x61,0x0b,0x00,0x04,0xc9,
-0x99,0x9d,0x88,0x0b,0x80,0x99,0xe9,0x9e,0x99,0xb1,0xc1,0x1c,0x1c,0xc0,0x20,0x40,
-0xeb,0xeb,0xbe,0xbe,0x08,0x00,0x04,0x0c,0x00,0x00,0x99,0x01,0xf0,0x08,0x1a,0xaa,
-0xbe,0xaa,0xa5,0x01,0x88,0x9d,0x88,0x70,0x02,0x91,0x2a,0x11,0xb0,0x02,0xc9,0xad,
-0x99,0xd0,0x02,0x80,0x1a,0xaa,0x35,0x50,0xbc,0x99,0x80,0x00,0x67,0x38,0x02,0x92,
+0x66,0x60,0x02,0x89,0xad,0x99,0x40,0x00,0x00,0x29,0x00,0x00,0x1a,0xaa,0xbd,0xaa,
+0xa6,0x77,0x40,0x0a,0x00,0x0b,0x1a,0x5b,0xea,0xb0,0xa0,0xa6,0x3a,0x0a,0x0d,0x9a,
+0x63,0xb0,0xa0,0xa0,0xbd,0xce,0xae,0x6a,0x0a,0x01,0xe7,0x00,0xea,0x90,0x75,0xb0,
+0x07,0x00,0x6a,0x04,0xb1,0x00,0x27,0x00,0x04,0x50,0x02,0xc8,0x88,0x8b,0x40,0x05,
+0x00,0x91,0xa3,0x33,0x38,0x40,0x00,0x55,0x55,0x55,0x10,0x42,0x00,0xf2,0x05,0x00,
+0x92,0x28,0x00,0x00,0x00,0xe2,0x2d,0xaa,0x70,0x06,0x8b,0x48,0x00,0x00,0x2a,0x03,
+0xac,0xba,0xa7,0xf5,0x04,0xe1,0xb9,0x99,0x9d,0x10,0x07,0x40,0x00,0x0a,0x10,0x07,
+0xa8,0x88,0x8d,0x10,0x0f,0x00,0xf0,0x0a,0x03,0x09,0x07,0x21,0x30,0x08,0x2a,0x08,
+0x3a,0x20,0x01,0x7a,0x08,0x55,0x00,0x79,0x9e,0xad,0xb9,0x93,0x11,0x11,0x11,0x11,
+0x10,0xb8,0x00,0x00,0x96,0x00,0xf0,0x02,0x58,0x00,0x07,0xba,0xdb,0xda,0xb1,0x00,
+0xb2,0x82,0x87,0x30,0x29,0xbb,0xdb,0xdc,0x96,0x69,0x00,0xf2,0x00,0x20,0x00,0xc3,
+0x33,0x38,0x50,0x00,0xd9,0x99,0x9b,0x50,0x00,0xb0,0x00,0x06,0x0a,0x00,0xf0,0x64,
+0x07,0x98,0x88,0x8d,0x00,0x07,0x97,0x77,0x7d,0x00,0x06,0x98,0xa8,0x8a,0x00,0x69,
+0x99,0xea,0x99,0x91,0x01,0x77,0x77,0x76,0x00,0x04,0x71,0x11,0x1b,0x00,0x02,0x98,
+0xc9,0x87,0x00,0x04,0xb1,0x92,0x89,0x10,0x57,0x07,0xc1,0x02,0x90,0x00,0x20,0x00,
+0x00,0x00,0x49,0xe9,0x95,0x99,0x80,0x0a,0x25,0x07,0x20,0x00,0x3a,0xad,0x99,0x9d,
+0x94,0x26,0x8d,0x9a,0x0a,0x00,0x13,0x38,0x08,0x09,0x00,0x03,0xb8,0x88,0x8c,0x00,
+0x04,0xb8,0x88,0x8e,0x00,0x04,0x60,0x00,0x0b,0x00,0x04,0xc9,0x99,0x9d,0x00,0x00,
+0xb0,0x0b,0x00,0x99,0xe9,0x9e,0x99,0xb1,0xc1,0x1c,0x1c,0xb0,0xb0,0x0b,0x0b,0xeb,
+0xeb,0xbe,0xbe,0x08,0x00,0x04,0x0c,0x00,0x00,0x99,0x01,0xf0,0x11,0x1a,0xaa,0xbe,
+0xaa,0xa5,0x01,0x88,0x9d,0x88,0x70,0x02,0x91,0x2a,0x11,0xb0,0x02,0xc9,0xad,0x99,
+0xd0,0x02,0x80,0x1a,0x00,0xb0,0x01,0xc9,0xbc,0x99,0x80,0x00,0x67,0x38,0x02,0x92,
 0x1e,0xe4,0x00,0x00,0x1b,0xa4,0x17,0xbb,0xb8,0xa5,0x05,0xff,0x09,0x78,0x22,0x3c,
 0x31,0x03,0x88,0x32,0x4c,0x41,0x19,0xec,0x87,0xcf,0xa6,0x03,0xaa,0x54,0xb3,0xa0,
 0x19,0x77,0x8c,0x76,0x57,0xe2,0x00,0x01,0x71,0x06,0xa8,0x88,0x8d,0x00,0x06,0xa7,
-0xe2,0x00,0xf3,0x12,0x88,0x8c,0x00,0x69,0x99,0x99,0x99,0x92,0x0b,0x47,0x85,0x55,
+0xe2,0x00,0xf1,0x13,0x88,0x8c,0x00,0x69,0x99,0x99,0x99,0x92,0x0b,0x47,0x85,0x55,
 0x40,0x0b,0x47,0x8a,0x66,0xa0,0x0b,0x8a,0x71,0xab,0x20,0x4d,0x9c,0xd2,0xcc,0x20,
-0x33,0x14,0x9a,0x22,0xb2,0x01,0x1c,0x14,0xa0,0x01,0x1c,0xf0,0x01,0x2d,0x33,0x33,
-0x10,0x01,0xcb,0x66,0x69,0x60,0x1c,0x6d,0xaa,0xac,0x60,0x02,0x38,0xdb,0x00,0x10,
-0x3d,0x9d,0x22,0x01,0x0a,0x00,0xf4,0x1c,0x38,0x00,0x9c,0x40,0x0a,0x05,0x56,0xca,
-0xe7,0xea,0xcc,0x73,0x0b,0x0b,0x7a,0x56,0xa8,0xe0,0xb1,0x65,0x65,0x1b,0x0c,0x9b,
-0x57,0x63,0xc1,0xb1,0x66,0x8a,0x8e,0x7a,0x99,0x8b,0x00,0xb1,0xc1,0xa2,0xc0,0x0b,
-0x84,0x02,0x77,0x7d,0x32,0x15,0x29,0x8e,0x2d,0x13,0x29,0x77,0x18,0x70,0x1a,0xaa,
-0xef,0xba,0xa6,0x00,0x06,0xa3,0x25,0xc0,0x6a,0x29,0x4b,0x10,0x1b,0x80,0x29,0x03,
-0xc5,0x03,0x00,0x29,0x8a,0x10,0x13,0x29,0xca,0x44,0xf7,0x0a,0x1a,0xab,0xee,0xda,
-0xa6,0x00,0x09,0x69,0xb1,0x00,0x00,0x39,0x29,0x3a,0x00,0x03,0xc1,0x29,0x09,0x90,
-0x2d,0x8b,0xce,0xbb,0x99,0xa3,0x0d,0xf3,0x1d,0xb0,0x4d,0xbe,0x00,0x7a,0xea,0x66,
-0x0b,0x00,0x04,0xd1,0x56,0x0b,0x00,0x08,0xe8,0x56,0x0b,0x00,0x0a,0xba,0x74,0x0b,
-0x00,0x65,0xb0,0x83,0x0b,0x00,0x70,0xb0,0xa1,0x0b,0x05,0x00,0xb1,0xa0,0x0b,0x09,
-0x00,0xb8,0x20,0x09,0xb5,0x61,0x0d,0x90,0x7b,0xfb,0xb0,0x7a,0xea,0x10,0xc0,0x00,
-0x04,0xfb,0x19,0xf0,0x02,0x09,0xe7,0x99,0xe9,0x92,0x0a,0xa9,0x21,0xc1,0x10,0x75,
-0xa0,0x00,0xc0,0x00,0x60,0xa0,0x0f,0x1a,0x06,0x05,0x00,0x10,0x05,0x5c,0x02,0xf0,
-0x1b,0x4f,0xaa,0xa4,0x00,0x06,0xca,0x02,0xd1,0x00,0x28,0x06,0xbd,0x20,0x00,0x00,
-0x5b,0x9b,0x93,0x00,0x68,0x50,0x61,0x26,0x91,0x07,0xaa,0xdb,0xaa,0x20,0x00,0x61,
-0x92,0x71,0x00,0x07,0x80,0x92,0x2b,0x00,0x06,0x05,0xb0,0x96,0x12,0x14,0x29,0x71,
-0x19,0xf0,0x01,0xa2,0x29,0x09,0x40,0x00,0x27,0x29,0x19,0x00,0x2b,0xbb,0xef,0xcb,
-0xb7,0x00,0x05,0xeb,0x00,0xf0,0x05,0x5a,0x29,0x4b,0x00,0x1a,0x90,0x29,0x04,0xc4,
-0x04,0x00,0x29,0x00,0x14,0x00,0xb0,0x79,0x97,0x50,0x3a,0xde,0x0d,0xf3,0x14,0x03,
-0xd0,0xaa,0xaa,0xa0,0x07,0xd7,0xb8,0x30,0xc0,0x08,0xb5,0xb3,0x94,0x90,0x56,0xb0,
-0xb0,0xcb,0x20,0x40,0xb0,0xa0,0x7b,0x00,0x00,0xb5,0x65,0xc9,0x60,0x00,0xb9,0x5a,
-0x00,0x76,0xbe,0x00,0xf2,0x1c,0xae,0xad,0x40,0x1a,0xe9,0x0a,0x0a,0x10,0x03,0xe2,
-0x0b,0x0b,0x00,0x05,0xe7,0x0e,0x1a,0xd4,0x09,0xb7,0x3e,0x40,0xc0,0x29,0xa0,0x65,
-0xb4,0xa0,0x42,0xa0,0xb0,0x6e,0x20,0x00,0xa3,0x91,0xac,0x80,0x00,0xa9,0x1a,0x40,
-0x67,0x92,0x0f,0xf0,0x43,0xda,0xbd,0xab,0xa0,0x02,0x90,0x29,0x01,0xa0,0x02,0xd9,
-0xad,0x9a,0xa0,0x02,0xc6,0x7c,0x67,0xa0,0x00,0x33,0x5b,0x33,0x20,0x1a,0xab,0xff,
-0xda,0xa6,0x00,0x0a,0x7a,0xa4,0x00,0x06,0xb3,0x29,0x08,0xa3,0x16,0x00,0x29,0x00,
-0x25,0x00,0xb0,0x9a,0xeb,0xa9,0x18,0xd7,0x00,0xa0,0x00,0x04,0xe3,0x8a,0xeb,0xa8,
-0x04,0xf5,0xa0,0xb0,0x0b,0x08,0xb8,0xa0,0xc9,0x0b,0x19,0xb0,0xa4,0x78,0x5b,0x23,
-0xb0,0xa7,0x00,0x7b,0x00,0xb0,0xa0,0x59,0x0e,0x23,0xa0,0x06,0x82,0x10,0x00,0x25,
-0x2a,0x02,0x4b,0x00,0xf0,0x01,0x1b,0x48,0x85,0x00,0x07,0x91,0x28,0x05,0x82,0x12,
-0x89,0x88,0x8d,0x02,0x00,0x88,0xa9,0x11,0x10,0x89,0x84,0x20,0x03,0x11,0x1b,0x90,
-0xaa,0xa5,0x00,0xb0,0x4a,0xaa,0x90,0x13,0xc3,0xe7,0x15,0x10,0xe9,0xe4,0x03,0xf0,
-0x00,0xf4,0x8a,0xea,0xa4,0x0a,0xca,0x00,0xb0,0x00,0x56,0xb0,0x55,0xb2,0x90,0x50,
-0xd1,0x2b,0x70,0x00,0xb2,0x80,0xb0,0x64,0x00,0xb0,0x38,0x02,0xf0,0x01,0xb0,0x08,
-0x02,0x80,0x14,0xc4,0x07,0x2a,0x10,0x16,0xe5,0x8b,0xbb,0xb2,0x05,0xe7,0x9f,0x05,
-0xa2,0xb6,0x39,0x99,0x70,0x56,0xb0,0x01,0x11,0x10,0x20,0xf4,0x28,0x00,0xad,0x02,
-0x1a,0xb0,0x50,0x22,0xf0,0x0d,0xb0,0x8a,0xcb,0xa6,0x1a,0xe9,0x07,0x05,0x20,0x04,
-0xf1,0x56,0x00,0xb1,0x08,0xc9,0x79,0x07,0x64,0x19,0xa3,0x05,0x6b,0x00,0x63,0xa0,
-0x00,0xe6,0x58,0x3f,0x78,0x8c,0x50,0x00,0xa0,0xb4,0x01,0x87,0x7f,0x0d,0xa0,0x28,
-0x02,0x90,0x2a,0xe9,0x8d,0xad,0xb2,0x01,0xd0,0x87,0x33,0xa0,0xe6,0x59,0xe9,0x90,
-0x08,0xb7,0x00,0xc0,0x00,0x19,0x3a,0x38,0x5c,0x32,0xb1,0x99,0xe9,0x94,0x95,0x37,
-0xf0,0x11,0xb0,0x0a,0x54,0x40,0x3a,0xe9,0x7c,0x25,0xc0,0x02,0xf2,0x65,0x9c,0x20,
-0x06,0xea,0x07,0xcb,0x30,0x0a,0xb7,0xc5,0x01,0x99,0x47,0xb0,0x7b,0xaa,0xc0,0x20,
-0xb0,0x73,0x2b,0x00,0x41,0x7b,0xaa,0xd0,0x00,0x0a,0x00,0x02,0x32,0x00,0xf2,0x19,
-0xca,0xaa,0xa4,0x01,0xb1,0x90,0x00,0x00,0x39,0xe8,0x98,0xbc,0xa2,0x03,0xf4,0x90,
-0x37,0x00,0x09,0xb8,0x96,0xbc,0x90,0x38,0xb0,0x90,0x37,0x00,0x20,0xb0,0x98,0x88,
-0x82,0x00,0xb0,0xc9,0x99,0x95,0x00,0xb0,0xcf,0x04,0x00,0xcd,0x00,0xf0,0x19,0x01,
-0xd1,0x00,0x03,0xc2,0x0a,0x5b,0x00,0x18,0xd6,0xa6,0x03,0xc3,0x05,0xf8,0x49,0x99,
-0x36,0x09,0xb8,0x50,0x70,0x61,0x37,0xa0,0x81,0x90,0x90,0x10,0xa0,0x23,0x37,0x30,
-0x00,0xa3,0x99,0x9d,0x95,0x00,0xa0,0x32,0x00,0xf2,0x1d,0xb1,0x6d,0x6d,0x72,0x2a,
-0xe7,0x0b,0x0b,0x00,0x02,0xc0,0x97,0x47,0xa0,0x06,0xf4,0xb8,0x88,0xc0,0x0a,0xb9,
-0xb6,0x66,0xc0,0x29,0xb0,0x12,0xa2,0x20,0x32,0xb3,0x9b,0xec,0x94,0x00,0xb0,0x1b,
-0x1a,0x20,0x00,0xb5,0xa3,0x01,0xa5,0x60,0x05,0xf0,0x1b,0x31,0x5c,0x5c,0x40,0x7d,
-0xb2,0x1b,0x1b,0x10,0x0b,0x56,0xaa,0xea,0xa2,0x0f,0xc1,0x88,0xd8,0x60,0x4c,0x77,
-0xa2,0xa2,0xb0,0xa7,0x32,0xb5,0xc5,0xb0,0x27,0x31,0xb8,0xb9,0x90,0x07,0x30,0x67,
-0x0a,0x30,0x07,0x39,0x70,0xf4,0x1f,0x03,0xb6,0x2d,0xf3,0x19,0x0a,0xaa,0xa2,0xc0,
-0x00,0xb1,0x05,0x1e,0xaa,0xad,0xa0,0xa7,0x45,0x0a,0xb7,0xa5,0x90,0xb3,0x6b,0x0e,
-0x10,0x1d,0x00,0xb5,0xb8,0x02,0xf1,0x0c,0xb0,0xb0,0x87,0x70,0xc3,0x11,0x2c,0x0b,
-0x39,0x99,0x9b,0x20,0xab,0x1c,0x00,0x8c,0x1d,0x71,0x01,0x30,0x1a,0x00,0x00,0x04,
-0x70,0x05,0x00,0x33,0x1e,0xbb,0xb0,0x0a,0x00,0x04,0x05,0x00,0x34,0x7c,0xda,0xbe,
-0x1b,0x19,0x20,0xbb,0xbb,0xaf,0x0a,0x01,0x51,0x27,0x02,0x6b,0x1d,0x00,0x05,0x00,
-0x33,0x0e,0xbb,0x80,0x0a,0x00,0x00,0x9a,0x3d,0x11,0xe9,0x9a,0x3d,0x00,0xcd,0x0f,
-0x00,0xfa,0x22,0x01,0x05,0x00,0xc0,0x0b,0x0b,0x10,0xc1,0xa2,0x0b,0x0d,0xa3,0xeb,
-0x30,0x0b,0x0b,0x92,0x42,0x02,0x14,0x00,0xd2,0x00,0xc0,0x05,0x0b,0x0c,0x52,0xc0,
-0x0a,0x4e,0xca,0x72,0xbb,0xc5,0x50,0x01,0x30,0x40,0x57,0x11,0xfa,0x3c,0xf0,0x0a,
-0x99,0x40,0x12,0xb1,0x77,0x11,0x10,0x59,0x99,0xcb,0x99,0x91,0x00,0x93,0x75,0x06,
-0x40,0x07,0x80,0x75,0x3b,0x00,0x17,0x00,0x5a,0x7c,0x22,0x50,0xc7,0x00,0x00,0x5b,
-0x84,0x13,0x09,0x10,0xcd,0x9c,0x3b,0x10,0x83,0xbc,0x01,0xf0,0x01,0xe9,0x93,0xb0,
-0x72,0x08,0x51,0x92,0xc9,0x70,0x2a,0x80,0xc0,0xe4,0x00,0x00,0x6c,0xd9,0x27,0xd2,
-0x0d,0x10,0xb0,0x03,0x00,0xb4,0x00,0xc0,0x0a,0x1c,0x40,0x00,0xbb,0x5a,0x2d,0xf1,
-0x1a,0x6d,0xba,0x56,0xb0,0x00,0x0a,0x10,0x7b,0xd8,0x80,0x0d,0xab,0xb2,0xb2,0x20,
-0x47,0x0c,0x40,0xb0,0x00,0xa8,0x69,0xab,0xfd,0xa3,0x11,0xc3,0x0a,0xda,0x00,0x01,
-0xb0,0x76,0xb4,0x90,0x0a,0x38,0x70,0xb0,0x74,0x65,0x95,0x07,0x10,0x04,0x81,0x01,
-0x31,0xa7,0x1a,0xae,0xbe,0x2c,0xf0,0x01,0x00,0x0c,0xaa,0x2a,0x0a,0x20,0x0b,0x00,
-0x73,0x03,0x72,0x0c,0xaa,0x5c,0xab,0x70,0xfd,0x65,0xf7,0x01,0x40,0x4e,0xbb,0x33,
-0xab,0x00,0x2c,0x00,0x03,0xea,0x10,0x0b,0x00,0xaa,0x14,0xc2,0x5c,0x18,0x13,0x00,
-0x65,0x32,0xa0,0x10,0x0c,0x11,0x0c,0x08,0x90,0x0c,0xaa,0x4c,0xb7,0x0f,0x00,0x16,
-0x20,0x19,0x00,0x93,0xa0,0x0c,0x38,0x5c,0x00,0xb0,0x0e,0x94,0x08,0x88,0x35,0x05,
-0x2d,0x05,0xf0,0x17,0x30,0x0b,0xbc,0x4d,0x08,0x80,0x00,0x0c,0x2f,0xa9,0x00,0x00,
-0x3a,0x2a,0xb1,0x00,0x00,0xa3,0x29,0x2b,0x00,0x07,0xa0,0x29,0x06,0xc1,0x1b,0x00,
-0x29,0x00,0x59,0x00,0x06,0xc6,0x00,0x00,0x09,0x60,0xa0,0x00,0xf0,0x02,0x60,0xb0,
-0xb0,0x40,0x11,0x00,0xb2,0xda,0xd0,0x19,0x67,0xe7,0xc0,0xb0,0x00,0x02,0xb0,0x98,
-0x25,0xf2,0x03,0xb0,0xb7,0xb0,0x02,0x90,0xb0,0xa0,0x00,0x0a,0x20,0xb0,0x00,0x46,
-0x09,0x00,0xab,0xaa,0xc2,0x60,0x21,0x10,0x60,0x99,0x08,0xf1,0x19,0x30,0xb0,0x0b,
-0x00,0x41,0x03,0xa0,0x0d,0x62,0x2b,0x4a,0x10,0x02,0x41,0x00,0x09,0xdb,0xbd,0x80,
-0x01,0x90,0xa0,0x0c,0x10,0x08,0x30,0x1b,0xb3,0x00,0x2b,0x04,0xaa,0xba,0x40,0x22,
-0x38,0x10,0x02,0x83,0x07,0xe8,0x19,0x10,0x43,0x76,0x24,0xa0,0x01,0xda,0xea,0xc4,
-0x07,0x81,0x90,0xb0,0x64,0x00,0x0a,0x00,0xf1,0x06,0x00,0x72,0x90,0xb0,0x74,0x02,
-0xa1,0x90,0xb0,0x64,0x0b,0x21,0xeb,0xeb,0xd4,0x03,0x01,0x90,0x00,0x64,0x01,0x5c,
-0x0d,0xa0,0x90,0x6c,0xae,0x00,0x00,0x30,0x82,0x0b,0x00,0x34,0x04,0x02,0x70,0x07,
-0x69,0x50,0x05,0x93,0x00,0x00,0x0e,0x23,0x20,0xb1,0xb0,0x77,0x26,0xf0,0x11,0xb0,
-0x01,0xa0,0x1c,0x00,0xeb,0xbb,0xa0,0x02,0x00,0xb0,0x01,0xa0,0x08,0x60,0x03,0x70,
-0x00,0x00,0x24,0xbc,0xdb,0x80,0x42,0x00,0x03,0x70,0x00,0x2b,0x30,0x03,0x70,0x74,
-0x1b,0xf0,0x09,0xcb,0xb1,0x00,0x80,0x1b,0x01,0x00,0x05,0x70,0x83,0x0b,0x00,0x0c,
-0x04,0xd6,0x8c,0x90,0x24,0x03,0x63,0x10,0x80,0x09,0x40,0x04,0x0a,0xf0,0x19,0x3a,
-0xbb,0xeb,0xd5,0x53,0x0a,0x00,0xa0,0xa0,0x08,0x2a,0xaa,0xea,0x70,0x00,0x0b,0x67,
-0x06,0x70,0x04,0x7a,0x0c,0x3d,0x10,0x0b,0x2a,0x03,0xf6,0x00,0x48,0x74,0x8b,0x5a,
-0xa2,0x11,0x42,0x50,0x00,0x33,0x04,0x71,0x18,0x40,0x05,0xc1,0x01,0xb0,0x75,0x14,
-0x40,0xca,0xa3,0x46,0x00,0x69,0x07,0x01,0x2c,0x01,0x41,0x02,0xbb,0xeb,0xb0,0x79,
-0x04,0x20,0x02,0xa0,0xa3,0x11,0x00,0x8d,0x2d,0x21,0x1b,0x0a,0x82,0x27,0x00,0x32,
-0x03,0x00,0xab,0x24,0xf3,0x1c,0x03,0xb3,0xab,0x99,0x80,0x00,0x06,0xe3,0x07,0x80,
-0x17,0x06,0x1b,0x6b,0x00,0x06,0x90,0x2a,0xd8,0x20,0x00,0x08,0xa3,0x03,0xa7,0x00,
-0x66,0xda,0xaa,0xc0,0x01,0xb2,0x80,0x00,0xb0,0x0a,0x31,0xda,0xaa,0xd0,0x02,0x01,
-0x80,0x2e,0x04,0xf2,0x1b,0x0a,0x60,0xb0,0xb0,0xa0,0x00,0x30,0xb0,0xb0,0xa0,0x21,
-0x03,0xb1,0xb2,0xa0,0x2b,0x49,0xb9,0xba,0xa0,0x00,0x37,0xb9,0xb7,0xe0,0x01,0x51,
-0xa1,0xb0,0xb0,0x07,0x42,0x80,0xb0,0xa0,0x0b,0x07,0x30,0xb0,0xa0,0x38,0x0a,0x4e,
-0x13,0x01,0x52,0x02,0x71,0x14,0x50,0x07,0xb3,0xab,0xd6,0x20,0x07,0x05,0x92,0x54,
-0x09,0xaa,0xea,0xa4,0x09,0x50,0x01,0xa0,0x16,0x05,0xf1,0x05,0x00,0x92,0xda,0xaa,
-0xb0,0x07,0x62,0x70,0x00,0xb0,0x2b,0x02,0xc8,0x88,0xb0,0x01,0x02,0x81,0x11,0xa0,
-0x33,0x09,0xf7,0x1e,0x0b,0x40,0x04,0x70,0x00,0x00,0x59,0xbe,0xab,0xa3,0x43,0x00,
-0xa3,0x0a,0x40,0x18,0x48,0xa9,0x87,0xb1,0x00,0x01,0x74,0x47,0x10,0x00,0xa2,0x85,
-0x58,0x10,0x06,0x74,0x65,0x58,0x20,0x0d,0x1c,0x35,0x58,0x27,0x37,0x4a,0x00,0x06,
-0xb4,0xf1,0x0e,0xf0,0x05,0x7b,0x99,0x95,0x90,0x00,0x09,0x51,0x97,0x90,0x46,0x09,
-0x71,0x97,0x90,0x06,0x39,0x71,0x97,0x90,0x00,0x0a,0x00,0xf3,0x04,0x04,0x69,0x91,
-0x97,0x90,0x09,0x22,0xa2,0x11,0x90,0x0c,0x03,0x89,0x10,0x90,0x26,0x29,0x00,0x75,
-0x7f,0x12,0xf0,0x04,0x61,0x70,0xb0,0x54,0x00,0x40,0x82,0xb0,0xa0,0x27,0x00,0xbb,
-0xeb,0xb2,0x05,0x80,0xb0,0x00,0x82,0x81,0x2b,0x40,0xd2,0x00,0x90,0xb0,0x13,0x0e,
-0xe1,0xea,0xaa,0xd2,0x09,0x40,0xb0,0x00,0x82,0x09,0x00,0xb0,0x0a,0xc1,0x01,0x3b,
-0x04,0xf0,0x06,0x7a,0xa9,0x9a,0xb0,0x00,0x2a,0x77,0x77,0xb0,0x30,0x0a,0x22,0x22,
-0xb0,0x3c,0x27,0xa9,0x9a,0x80,0x02,0x14,0xe9,0x23,0xf6,0x04,0x89,0xb8,0xb6,0x92,
-0x05,0x69,0x10,0xb4,0x00,0x0c,0x09,0x12,0xb0,0x08,0x46,0x0d,0xc8,0x8a,0xb5,0x55,
-0x32,0x51,0x05,0xb7,0xad,0xca,0xa3,0x02,0x36,0x80,0x23,0x0b,0xbe,0xbb,0xb7,0x1a,
-0x40,0xa3,0xbf,0x43,0xf0,0x33,0x86,0x11,0xb4,0x01,0x76,0x59,0x42,0x73,0x07,0x45,
-0x49,0x56,0x92,0x0c,0x07,0x09,0x27,0x26,0x05,0x00,0x7c,0x00,0x00,0x07,0x54,0x68,
-0xb6,0x61,0x00,0x23,0x89,0xc8,0x80,0x35,0x03,0x35,0xa3,0x32,0x08,0x55,0x55,0x55,
-0x53,0x00,0x04,0xb9,0x99,0xb0,0x00,0xa4,0xb7,0x78,0xb0,0x04,0x74,0xb8,0x88,0xb0,
-0x0b,0x14,0x60,0x00,0xb0,0x07,0x04,0x60,0x28,0x15,0x00,0xa8,0x0b,0xf6,0x1d,0x53,
-0x70,0x38,0xb1,0x00,0x5c,0xba,0x92,0x00,0x10,0x08,0x30,0x81,0x00,0x2a,0x39,0x91,
-0x89,0xd5,0x00,0x1b,0xdb,0x90,0xa0,0x02,0x50,0x94,0xa0,0xa0,0x08,0x6b,0xe8,0xb0,
-0xa0,0x0c,0x00,0x92,0x90,0xa0,0x26,0x00,0x95,0x40,0xa0,0x60,0x24,0xf3,0x05,0x04,
-0xb3,0xea,0xaa,0xc0,0x00,0x11,0xc5,0x55,0xc0,0x15,0x00,0xc3,0x33,0xb0,0x07,0x90,
-0xc9,0x99,0xa0,0x51,0x40,0xf2,0x03,0xbd,0xac,0xd1,0x00,0xb5,0x49,0x26,0x91,0x07,
-0x45,0x49,0x26,0x91,0x0b,0x2c,0xcd,0xbc,0xd9,0x37,0x00,0xf1,0x09,0x01,0x10,0x11,
-0x00,0x0a,0x62,0xb0,0x83,0x00,0x00,0x6b,0xcb,0xca,0xa4,0x34,0x08,0x22,0xa4,0x40,
-0x08,0x39,0xb8,0x38,0xc0,0x7b,0x59,0xf2,0x04,0x04,0x4a,0x0b,0xae,0xa4,0x0a,0x1a,
-0x0a,0x0a,0x00,0x0b,0x45,0x19,0x0a,0x00,0x36,0x93,0xb5,0x6c,0x6c,0x35,0xf1,0x19,
-0x02,0x00,0x02,0x40,0x00,0x0b,0x19,0xaa,0xda,0xa4,0x02,0x24,0x59,0x56,0x50,0x51,
-0x2a,0x19,0x55,0x83,0x3a,0x00,0x03,0x21,0x00,0x04,0x06,0x99,0x99,0xb0,0x07,0x23,
-0x98,0x88,0x80,0x0b,0x08,0xb9,0x99,0x90,0x3b,0x09,0x61,0x23,0x00,0x00,0x6a,0x70,
-0x02,0xd1,0x01,0xf2,0x1d,0x9a,0xba,0xca,0xa4,0x00,0x1a,0x21,0xc2,0x10,0x43,0x0a,
-0x79,0x77,0xd0,0x1a,0x4a,0x6a,0x88,0xd0,0x00,0x0b,0x63,0x00,0xa0,0x01,0x6b,0x38,
-0xd8,0x80,0x07,0x5b,0x45,0xb0,0x90,0x0b,0x57,0xb0,0xb0,0x94,0x25,0x90,0x27,0xb0,
-0x01,0x98,0x03,0xf4,0x1d,0x80,0xd9,0x99,0xa0,0x00,0x40,0xd8,0x70,0xa0,0x22,0x04,
-0xc4,0xb5,0xc3,0x1a,0x5c,0x44,0x44,0x4b,0x00,0x04,0xd9,0x99,0xb4,0x00,0x90,0xd8,
-0x88,0xb0,0x03,0x80,0xd8,0x88,0xb0,0x0b,0x20,0xa0,0x00,0xb0,0x07,0x00,0xa0,0x39,
-0x90,0x9d,0x21,0xf1,0x1e,0x20,0x00,0x08,0x79,0xab,0xda,0xa3,0x00,0x21,0xa1,0x0a,
-0x20,0x44,0x1c,0x4b,0x22,0xb2,0x09,0x32,0xb4,0x6b,0x10,0x00,0x07,0xae,0xc6,0x40,
-0x02,0x82,0xc3,0x94,0xa0,0x09,0x7a,0xb0,0x1e,0x20,0x1a,0x00,0xd9,0x62,0xc4,0x02,
-0x00,0x61,0x3a,0x01,0x00,0x92,0x0d,0xf0,0x18,0x93,0x73,0x70,0x00,0x3b,0xdb,0xdb,
-0xc5,0x22,0x01,0x92,0x73,0x60,0x1a,0x2a,0xaa,0xaa,0xa3,0x00,0x0a,0x03,0x70,0x55,
-0x01,0x74,0xbb,0xca,0x90,0x08,0x34,0x63,0x70,0xa0,0x1a,0x04,0x63,0x88,0x80,0x01,
-0xf2,0x03,0xf3,0x4b,0x08,0x13,0x77,0x3c,0x31,0x02,0x76,0xaa,0x6d,0x62,0x11,0x09,
-0xbd,0xad,0x94,0x3c,0x21,0x1a,0x37,0x10,0x01,0x0c,0x9d,0xab,0xc2,0x00,0x6b,0x2a,
-0x67,0x72,0x06,0x6b,0x87,0xa9,0x92,0x0c,0x0b,0x51,0x61,0x82,0x25,0x0b,0x00,0x04,
-0xa1,0x07,0x30,0x05,0xa6,0x60,0x00,0x46,0x9b,0xb9,0x94,0x22,0x0a,0x07,0x00,0x72,
-0x1a,0x3a,0x5d,0x97,0x30,0x00,0x0a,0x06,0x98,0x90,0x00,0x6a,0x00,0x30,0x00,0x06,
-0x5a,0x45,0x73,0x70,0x0b,0x38,0xa9,0x03,0x94,0x26,0x84,0x48,0x89,0x54,0xc1,0x20,
-0xf8,0x21,0x50,0x14,0x00,0x09,0x5a,0xc7,0x45,0x00,0x00,0x48,0x3a,0x7c,0xa5,0x42,
-0x39,0x5b,0xc1,0x90,0x1a,0x3a,0x9c,0xe4,0x90,0x00,0x38,0xa5,0x38,0x90,0x04,0x5c,
-0x55,0x0b,0x60,0x0a,0x0b,0x9b,0x0b,0x30,0x19,0x19,0x0a,0x5a,0xc0,0x53,0xa3,0xa7,
-0xb0,0x57,0x95,0x43,0x10,0x38,0x90,0x1f,0xb0,0x47,0x00,0xb1,0x03,0x90,0x67,0x02,
-0xa0,0x0a,0x20,0x9b,0x18,0x30,0x70,0xca,0x20,0x00,0x00,0x08,0x72,0xb0,0xb8,0x2f,
-0x73,0x4c,0x30,0x0c,0x60,0x00,0x02,0xa7,0xfd,0x07,0xf0,0x07,0x9b,0xbb,0xb4,0x03,
-0xa4,0x10,0x29,0x00,0x17,0xa9,0x00,0x29,0x00,0x44,0xb5,0x00,0x29,0x00,0x11,0xb0,
-0x00,0x29,0x62,0x50,0xe4,0x29,0x00,0x05,0x99,0x00,0x29,0x00,0x0b,0x05,0x00,0x29,
-0x00,0x56,0x00,0x65,0x38,0x74,0x04,0xaa,0xaa,0xab,0x90,0x00,0x67,0xb3,0x1b,0xf0,
-0x12,0x04,0xaa,0xab,0xaa,0x60,0x00,0x50,0x39,0x00,0x40,0x04,0x80,0x79,0x06,0x50,
-0x04,0x01,0xc8,0x45,0x00,0x00,0x5c,0x30,0x89,0x30,0x1a,0x60,0x00,0x03,0x87,0x00,
-0x00,0x1b,0x66,0x08,0xe0,0x1e,0x99,0x90,0x00,0x11,0x3b,0x11,0x10,0x01,0xd9,0x99,
-0x99,0xb0,0x01,0x23,0x18,0xf0,0x08,0x01,0xcb,0xbb,0xbb,0xa0,0x01,0x50,0x20,0x30,
-0x50,0x09,0x42,0x90,0xb0,0x81,0x17,0x00,0x70,0x51,0x23,0x00,0x14,0x04,0x55,0x47,
-0xf2,0x1c,0x1b,0x21,0x10,0x04,0xd8,0x8d,0x88,0x82,0x3c,0xe9,0x9e,0x99,0x60,0x01,
-0xc2,0x2c,0x22,0x10,0x00,0xd6,0x6d,0x66,0x40,0x00,0xe9,0x9e,0x99,0x91,0x02,0x72,
-0x12,0x12,0x40,0x0a,0x16,0x43,0x80,0xb2,0x14,0x02,0x20,0x50,0x24,0x92,0x00,0xf1,
-0x1c,0x88,0x31,0x0b,0x80,0x00,0xb5,0xb4,0x0b,0x35,0x0b,0x59,0xc7,0xbe,0xa8,0x26,
-0x76,0x70,0x4f,0x10,0x00,0x7c,0x00,0xb5,0x80,0x09,0xb0,0x2b,0x40,0xa7,0x04,0x10,
-0x52,0x00,0x14,0x08,0x54,0x60,0xb0,0xa3,0x1a,0x02,0x70,0x90,0xb8,0x25,0x03,0x2d,
-0x38,0xf5,0x1e,0xa0,0x24,0xd3,0x30,0x01,0xa4,0xa4,0x44,0xc0,0x17,0xa9,0xa8,0x88,
-0xd0,0x54,0xb3,0xa7,0x77,0xd0,0x11,0x90,0xa8,0x88,0xd0,0x03,0x90,0x03,0x70,0x00,
-0x06,0xb7,0x55,0x73,0x60,0x0b,0x08,0x67,0x02,0x85,0x55,0x05,0x1b,0x9b,0x35,0x00,
-0x18,0x47,0xd0,0x07,0xbb,0xc5,0x99,0x91,0x0a,0x54,0x97,0x28,0x72,0x0a,0x54,0xa7,
-0x05,0x00,0xf3,0x0c,0x97,0xab,0xb2,0x0a,0x54,0xa7,0x20,0x00,0x0a,0x54,0xa7,0x30,
-0x45,0x09,0x54,0x68,0x99,0x81,0x55,0x54,0x0b,0x60,0x00,0x81,0x54,0x00,0x6b,0x08,
-0x0c,0x00,0x10,0x32,0x02,0x05,0x00,0x62,0xfb,0xbe,0xcb,0xb2,0x00,0xc0,0x61,0x48,
-0x60,0xa5,0x00,0x02,0x91,0x11,0x68,0x45,0x0d,0x60,0x58,0x00,0x0c,0x10,0x00,0x58,
-0x28,0x24,0x02,0x43,0x16,0x00,0xa4,0x5a,0x30,0x88,0x83,0x0a,0xa2,0x42,0xf3,0x14,
-0x0d,0xac,0x4e,0xaa,0xb4,0x0b,0x00,0x0b,0xa0,0x64,0x0e,0xa9,0x0b,0xa1,0xa0,0x0a,
-0x0a,0x1a,0x58,0xa0,0x19,0x0a,0x28,0x0e,0x30,0x56,0x0a,0x75,0x8a,0xa0,0x71,0x0a,
-0xa6,0x60,0x48,0x79,0x25,0x70,0xbb,0xec,0xa0,0x00,0x90,0x00,0x92,0x5c,0x29,0x10,
-0x92,0x37,0x27,0xf0,0x04,0xdb,0xa4,0x00,0x11,0x2c,0xc3,0x10,0x00,0x02,0xc2,0x92,
-0x00,0x00,0x5c,0x20,0x92,0x00,0x2c,0xa1,0x25,0x2a,0x14,0x00,0xa9,0x37,0x10,0x02,
-0x3c,0x19,0xf0,0x09,0x19,0xb1,0x5a,0xdb,0xa1,0x4b,0xe7,0x22,0xa4,0x21,0x61,0xb0,
-0x55,0x59,0x93,0x03,0xd9,0x9a,0xac,0xc5,0x6a,0xc0,0x24,0x05,0xe2,0x18,0x70,0x15,
-0x50,0x00,0xb0,0x03,0x15,0x50,0xd7,0x1f,0xf0,0x1d,0x30,0x00,0xb0,0x01,0x94,0x30,
-0x64,0xb0,0x01,0x90,0x90,0x09,0xc6,0xab,0xda,0xa5,0x00,0xb0,0x14,0xe1,0x10,0x04,
-0xf0,0x06,0xe3,0x00,0x4b,0xc0,0x0b,0x38,0x00,0x60,0xb0,0x4a,0x0b,0x10,0x00,0xb1,
-0xd1,0x03,0xa0,0x00,0xb9,0x40,0x79,0x10,0x12,0x24,0x81,0x28,0xf6,0x10,0xa6,0x04,
+0x33,0x14,0x9a,0x22,0xb2,0x00,0xe3,0x00,0xf0,0x0b,0x02,0xa0,0x00,0x00,0x1b,0xbe,
+0xbb,0xbb,0xb6,0x00,0x2d,0x33,0x33,0x10,0x01,0xcb,0x66,0x69,0x60,0x1c,0x6d,0xaa,
+0xac,0x60,0x02,0x38,0xdb,0x00,0x51,0x3d,0xaa,0xac,0x60,0x00,0x0a,0x00,0xf1,0x1e,
+0x38,0x00,0x9c,0x40,0x0a,0x05,0x56,0xca,0xe7,0xea,0xcc,0x73,0x0b,0x0b,0x7a,0x56,
+0xa8,0xe0,0xb1,0x65,0x65,0x1b,0x0c,0x9b,0x57,0x63,0xc1,0xb1,0x66,0x8a,0x8e,0x7a,
+0x99,0x8b,0x00,0xb1,0xc1,0xa2,0xc0,0x0b,0x84,0x02,0x77,0x0a,0xc0,0x36,0x03,0x00,
+0x32,0x02,0x51,0x04,0xbb,0xce,0xbb,0xa0,0x0a,0x00,0x30,0x00,0x00,0x39,0x41,0x02,
+0xf3,0x08,0xef,0xba,0xa6,0x00,0x06,0xbc,0xb0,0x00,0x00,0x6a,0x29,0x4b,0x10,0x1b,
+0x80,0x29,0x03,0xc5,0x03,0x00,0x29,0x00,0x03,0x23,0x00,0xf3,0x0d,0x3a,0x00,0x00,
+0x1a,0xab,0xee,0xda,0xa6,0x00,0x09,0x69,0xb1,0x00,0x00,0x39,0x29,0x3a,0x00,0x03,
+0xc1,0x29,0x09,0x90,0x2d,0x8b,0xce,0xbb,0x99,0x23,0x00,0x10,0x29,0xe3,0x02,0xf2,
+0x1c,0x4d,0xbe,0x00,0x7a,0xea,0x66,0x0b,0x00,0x04,0xd1,0x56,0x0b,0x00,0x08,0xe8,
+0x56,0x0b,0x00,0x0a,0xba,0x74,0x0b,0x00,0x65,0xb0,0x83,0x0b,0x00,0x70,0xb0,0xa1,
+0x0b,0x05,0x00,0xb1,0xa0,0x0b,0x09,0x00,0xb8,0x20,0x09,0xb5,0x8b,0x00,0xf0,0x0f,
+0xa0,0x7b,0xfb,0xb0,0x7a,0xea,0x10,0xc0,0x00,0x04,0xc0,0x00,0xc0,0x00,0x09,0xe7,
+0x99,0xe9,0x92,0x0a,0xa9,0x21,0xc1,0x10,0x75,0xa0,0x00,0xc0,0x00,0x60,0x05,0x00,
+0x16,0x00,0x05,0x00,0x10,0x05,0x5c,0x02,0xf1,0x1d,0x4f,0xaa,0xa4,0x00,0x06,0xca,
+0x02,0xd1,0x00,0x28,0x06,0xbd,0x20,0x00,0x00,0x5b,0x9b,0x93,0x00,0x68,0x50,0x61,
+0x26,0x91,0x07,0xaa,0xdb,0xaa,0x20,0x00,0x61,0x92,0x71,0x00,0x07,0x80,0x92,0x2b,
+0x00,0x06,0x05,0xb0,0x03,0x30,0x96,0x00,0xf0,0x07,0x08,0xbb,0xce,0xbb,0xb2,0x00,
+0xa2,0x29,0x09,0x40,0x00,0x27,0x29,0x19,0x00,0x2b,0xbb,0xef,0xcb,0xb7,0x00,0x05,
+0xeb,0x00,0xf3,0x2c,0x5a,0x29,0x4b,0x00,0x1a,0x90,0x29,0x04,0xc4,0x04,0x00,0x29,
+0x00,0x14,0x00,0xb0,0x79,0x97,0x50,0x3a,0xe9,0xa0,0x00,0x00,0x03,0xd0,0xaa,0xaa,
+0xa0,0x07,0xd7,0xb8,0x30,0xc0,0x08,0xb5,0xb3,0x94,0x90,0x56,0xb0,0xb0,0xcb,0x20,
+0x40,0xb0,0xa0,0x7b,0x00,0x00,0xb5,0x65,0xc9,0x60,0x00,0xb9,0x5a,0x00,0x76,0xbe,
+0x00,0xf1,0x1c,0xae,0xad,0x40,0x1a,0xe9,0x0a,0x0a,0x10,0x03,0xe2,0x0b,0x0b,0x00,
+0x05,0xe7,0x0e,0x1a,0xd4,0x09,0xb7,0x3e,0x40,0xc0,0x29,0xa0,0x65,0xb4,0xa0,0x42,
+0xa0,0xb0,0x6e,0x20,0x00,0xa3,0x91,0xac,0x80,0x00,0xa9,0x1a,0x40,0x67,0x31,0x00,
+0xf3,0x4b,0x02,0xda,0xbd,0xab,0xa0,0x02,0x90,0x29,0x01,0xa0,0x02,0xd9,0xad,0x9a,
+0xa0,0x02,0xc6,0x7c,0x67,0xa0,0x00,0x33,0x5b,0x33,0x20,0x1a,0xab,0xff,0xda,0xa6,
+0x00,0x0a,0x7a,0xa4,0x00,0x06,0xb3,0x29,0x08,0xa3,0x16,0x00,0x29,0x00,0x25,0x00,
+0xb0,0x9a,0xeb,0xa9,0x18,0xd7,0x00,0xa0,0x00,0x04,0xe3,0x8a,0xeb,0xa8,0x04,0xf5,
+0xa0,0xb0,0x0b,0x08,0xb8,0xa0,0xc9,0x0b,0x19,0xb0,0xa4,0x78,0x5b,0x23,0xb0,0xa7,
+0x00,0x7b,0x00,0xb0,0xa0,0x00,0x0b,0x00,0xb0,0xa0,0x06,0xb8,0xac,0x05,0x32,0x28,
+0x00,0x00,0x4b,0x00,0xf3,0x08,0x1b,0x48,0x85,0x00,0x07,0x91,0x28,0x05,0x82,0x12,
+0x89,0x88,0x8d,0x02,0x00,0x88,0x77,0x7d,0x00,0x00,0x89,0x88,0x8d,0xd2,0x05,0xf0,
+0x01,0xaa,0xaa,0xaa,0xa5,0x00,0xb0,0x4a,0xaa,0x90,0x13,0xc3,0x00,0x00,0x00,0x4a,
+0xe9,0xe4,0x03,0xf0,0x0b,0xf4,0x8a,0xea,0xa4,0x0a,0xca,0x00,0xb0,0x00,0x56,0xb0,
+0x55,0xb2,0x90,0x50,0xb0,0xa0,0xb0,0xa0,0x00,0xb2,0x80,0xb0,0x64,0x00,0xb0,0x38,
+0x02,0xf0,0x01,0xb0,0x08,0x02,0x80,0x14,0xc4,0x07,0x2a,0x10,0x16,0xe5,0x8b,0xbb,
+0xb2,0x05,0xe7,0x9f,0x05,0xa1,0xb6,0x39,0x99,0x70,0x56,0xb0,0x01,0x11,0x10,0x20,
+0x2e,0x06,0x10,0xb1,0xad,0x02,0x06,0x38,0x06,0x10,0xa0,0x0c,0x00,0xf6,0x19,0xb0,
+0x8a,0xcb,0xa6,0x1a,0xe9,0x07,0x05,0x20,0x04,0xf1,0x56,0x00,0xb1,0x08,0xc9,0x79,
+0x07,0x64,0x19,0xa3,0x05,0x6b,0x00,0x63,0xa0,0x00,0xe6,0x00,0x00,0xa0,0x09,0x8c,
+0x50,0x00,0xa0,0xb4,0x01,0x87,0x00,0x01,0x00,0xf1,0x15,0xb0,0x28,0x02,0x90,0x2a,
+0xe9,0x8d,0xad,0xb2,0x01,0xd0,0x00,0xb0,0x00,0x05,0xe6,0x59,0xe9,0x90,0x08,0xb7,
+0x00,0xc0,0x00,0x19,0xb0,0x11,0xc1,0x10,0x32,0xb1,0x99,0xe9,0x94,0x00,0xb0,0x5a,
+0x00,0x05,0x6b,0x00,0xf0,0x11,0xb0,0x0a,0x54,0x40,0x3a,0xe9,0x7c,0x25,0xc0,0x02,
+0xf2,0x65,0x9c,0x20,0x06,0xea,0x07,0xcb,0x30,0x0a,0xb7,0xc5,0x01,0x99,0x47,0xb0,
+0x7b,0xaa,0xc0,0x20,0xb0,0x73,0x2b,0x00,0x41,0x7b,0xaa,0xd0,0x00,0x0a,0x00,0x02,
+0x32,0x00,0xf2,0x19,0xca,0xaa,0xa4,0x01,0xb1,0x90,0x00,0x00,0x39,0xe8,0x98,0xbc,
+0xa2,0x03,0xf4,0x90,0x37,0x00,0x09,0xb8,0x96,0xbc,0x90,0x38,0xb0,0x90,0x37,0x00,
+0x20,0xb0,0x98,0x88,0x82,0x00,0xb0,0xc9,0x99,0x95,0x00,0xb0,0xcf,0x04,0x00,0xcd,
+0x00,0xf0,0x19,0x01,0xd1,0x00,0x03,0xc2,0x0a,0x5b,0x00,0x18,0xd6,0xa6,0x03,0xc3,
+0x05,0xf8,0x49,0x99,0x36,0x09,0xb8,0x50,0x70,0x61,0x37,0xa0,0x81,0x90,0x90,0x10,
+0xa0,0x23,0x37,0x30,0x00,0xa3,0x99,0x9d,0x95,0x00,0xa0,0x32,0x00,0xf2,0x1d,0xb1,
+0x6d,0x6d,0x72,0x2a,0xe7,0x0b,0x0b,0x00,0x02,0xc0,0x97,0x47,0xa0,0x06,0xf4,0xb8,
+0x88,0xc0,0x0a,0xb9,0xb6,0x66,0xc0,0x29,0xb0,0x12,0xa2,0x20,0x32,0xb3,0x9b,0xec,
+0x94,0x00,0xb0,0x1b,0x1a,0x20,0x00,0xb5,0xa3,0x01,0xa5,0x60,0x05,0xf3,0x1d,0x31,
+0x5c,0x5c,0x40,0x7d,0xb2,0x1b,0x1b,0x10,0x0b,0x56,0xaa,0xea,0xa2,0x0f,0xc1,0x88,
+0xd8,0x60,0x4c,0x77,0xa2,0xa2,0xb0,0xa7,0x32,0xb5,0xc5,0xb0,0x27,0x31,0xb8,0xb9,
+0x90,0x07,0x30,0x67,0x0a,0x30,0x07,0x39,0x70,0x00,0xa1,0xf6,0x00,0xf3,0x1c,0x03,
+0x00,0x0a,0xaa,0xa2,0xc0,0x00,0xb1,0x05,0x1e,0xaa,0xad,0xa0,0xa7,0x45,0x0a,0xb7,
+0xa5,0x90,0xb3,0x6b,0x0e,0x10,0x1d,0x00,0xb5,0xb8,0x02,0xf1,0x0c,0xb0,0xb0,0x87,
+0x70,0xc3,0x11,0x2c,0x0b,0x39,0x99,0x9b,0x20,0x19,0x32,0x00,0xa1,0x1a,0x00,0x00,
+0x01,0x30,0x1a,0x00,0x00,0x04,0x70,0x05,0x00,0x33,0x1e,0xbb,0xb0,0x0a,0x00,0x04,
+0x05,0x00,0x42,0x7c,0xda,0xbe,0xaa,0x51,0x09,0x60,0x09,0xbb,0xbb,0xbb,0xb2,0x00,
+0x3b,0x0a,0x30,0x00,0x30,0x0b,0x31,0x01,0x01,0x05,0x00,0x54,0x0e,0xbb,0x80,0x00,
+0xb0,0x0f,0x00,0x60,0x29,0xe9,0xae,0x99,0x96,0x01,0xf2,0x05,0x20,0x00,0x0b,0x9d,
+0x03,0x00,0x05,0x00,0xf2,0x01,0x0b,0x0b,0x10,0xc1,0xa2,0x0b,0x0d,0xa3,0xeb,0x30,
+0x0b,0x0b,0x00,0xd0,0x00,0x0b,0x14,0x00,0xd2,0x00,0xc0,0x05,0x0b,0x0c,0x52,0xc0,
+0x0a,0x4e,0xca,0x72,0xbb,0xc5,0x50,0x01,0xf0,0x1a,0x40,0x57,0x11,0x00,0x00,0xb0,
+0x5c,0x99,0x40,0x12,0xb1,0x77,0x11,0x10,0x59,0x99,0xcb,0x99,0x91,0x00,0x93,0x75,
+0x06,0x40,0x07,0x80,0x75,0x3b,0x00,0x17,0x00,0x5a,0xb1,0x00,0x00,0x38,0xc7,0x00,
+0x00,0x5b,0x84,0x13,0x09,0x60,0xcd,0xbb,0xeb,0xb7,0x00,0x83,0xbc,0x01,0xf1,0x13,
+0xe9,0x93,0xb0,0x72,0x08,0x51,0x92,0xc9,0x70,0x2a,0x80,0xc0,0xe4,0x00,0x00,0x6c,
+0x80,0xb0,0x00,0x00,0x0d,0x10,0xb0,0x03,0x00,0xb4,0x00,0xc0,0x0a,0x1c,0x40,0x00,
+0xbb,0xb7,0x5e,0x00,0xf1,0x1a,0x6d,0xba,0x56,0xb0,0x00,0x0a,0x10,0x7b,0xd8,0x80,
+0x0d,0xab,0xb2,0xb2,0x20,0x47,0x0c,0x40,0xb0,0x00,0xa8,0x69,0xab,0xfd,0xa3,0x11,
+0xc3,0x0a,0xda,0x00,0x01,0xb0,0x76,0xb4,0x90,0x0a,0x38,0x70,0xb0,0x74,0x65,0x95,
+0x07,0x10,0x04,0x81,0x01,0x50,0xa7,0x1a,0xae,0x00,0x0b,0xac,0x00,0xf6,0x14,0x0c,
+0xaa,0x2a,0x0a,0x20,0x0b,0x00,0x73,0x03,0x72,0x0c,0xaa,0x5c,0xab,0x70,0x0b,0x00,
+0x0a,0x09,0x40,0x4e,0xbb,0x33,0xab,0x00,0x2c,0x00,0x03,0xea,0x10,0x0b,0x00,0xaa,
+0x14,0xc2,0xac,0x02,0x32,0x0c,0x00,0x0c,0x05,0x00,0xa0,0x10,0x0c,0x11,0x0c,0x08,
+0x90,0x0c,0xaa,0x4c,0xb7,0x0f,0x00,0x16,0x20,0x19,0x00,0xb3,0xa0,0x0c,0x38,0x5c,
+0x00,0xb0,0x0e,0x94,0x08,0xbb,0x90,0x34,0x00,0x03,0x2d,0x05,0xf0,0x17,0x30,0x0b,
+0xbc,0x4d,0x08,0x80,0x00,0x0c,0x2f,0xa9,0x00,0x00,0x3a,0x2a,0xb1,0x00,0x00,0xa3,
+0x29,0x2b,0x00,0x07,0xa0,0x29,0x06,0xc1,0x1b,0x00,0x29,0x00,0x59,0x00,0x06,0xc6,
+0x00,0x00,0x09,0x60,0xa0,0x00,0xf2,0x17,0x60,0xb0,0xb0,0x40,0x11,0x00,0xb2,0xda,
+0xd0,0x19,0x67,0xe7,0xc0,0xb0,0x00,0x02,0xb0,0xb0,0xb0,0x00,0xa0,0xb0,0xb7,0xb0,
+0x02,0x90,0xb0,0xa0,0x00,0x0a,0x20,0xb0,0x00,0x46,0x09,0x00,0xab,0xaa,0x96,0x00,
+0x20,0x1b,0x60,0x99,0x08,0xf0,0x1a,0x30,0xb0,0x0b,0x00,0x41,0x03,0xa0,0x0d,0x62,
+0x2b,0x4a,0x10,0x02,0x41,0x00,0x09,0xdb,0xbd,0x80,0x01,0x90,0xa0,0x0c,0x10,0x08,
+0x30,0x1b,0xb3,0x00,0x2b,0x04,0xaa,0xba,0x40,0x22,0x38,0x10,0x02,0x83,0x07,0x70,
+0x5f,0x00,0xf0,0x00,0x43,0x00,0xc0,0x00,0x02,0x01,0xda,0xea,0xc4,0x07,0x81,0x90,
+0xb0,0x64,0x00,0x0a,0x00,0xf1,0x05,0x00,0x72,0x90,0xb0,0x74,0x02,0xa1,0x90,0xb0,
+0x64,0x0b,0x21,0xeb,0xeb,0xd4,0x03,0x01,0x90,0x00,0x64,0x06,0x09,0xb0,0x08,0x90,
+0x6c,0xae,0x00,0x00,0x30,0x82,0x0b,0x00,0x34,0x04,0x02,0x50,0x07,0x69,0x50,0x05,
+0x93,0x1c,0x09,0xf0,0x17,0x70,0x00,0xb1,0xb0,0x01,0xa0,0x05,0x70,0xb0,0x01,0xa0,
+0x1c,0x00,0xeb,0xbb,0xa0,0x02,0x00,0xb0,0x01,0xa0,0x08,0x60,0x03,0x70,0x00,0x00,
+0x24,0xbc,0xdb,0x80,0x42,0x00,0x03,0x70,0x00,0x2b,0x30,0x0f,0x00,0xf0,0x0b,0x09,
+0xbe,0xcb,0xb1,0x00,0x80,0x1b,0x01,0x00,0x05,0x70,0x83,0x0b,0x00,0x0c,0x04,0xd6,
+0x8c,0x90,0x24,0x03,0x63,0x10,0x80,0x09,0x40,0x04,0x0a,0xf0,0x29,0x3a,0xbb,0xeb,
+0xd5,0x53,0x0a,0x00,0xa0,0xa0,0x08,0x2a,0xaa,0xea,0x70,0x00,0x0b,0x67,0x06,0x70,
+0x04,0x7a,0x0c,0x3d,0x10,0x0b,0x2a,0x03,0xf6,0x00,0x48,0x74,0x8b,0x5a,0xa2,0x11,
+0x42,0x50,0x00,0x33,0x04,0x00,0x03,0x30,0x00,0x05,0xc1,0x01,0xb0,0x00,0x00,0x07,
+0xaa,0xca,0xa3,0x46,0x00,0x69,0x07,0x01,0x2c,0x01,0x41,0x02,0xbb,0xeb,0xb0,0x79,
+0x04,0x10,0x02,0x05,0x00,0xa3,0x0a,0x30,0x00,0xb0,0x00,0x1b,0x0a,0xbb,0xeb,0xb6,
+0x32,0x03,0xf3,0x1f,0x24,0x00,0x00,0x03,0xb3,0xab,0x99,0x80,0x00,0x06,0xe3,0x07,
+0x80,0x17,0x06,0x1b,0x6b,0x00,0x06,0x90,0x2a,0xd8,0x20,0x00,0x08,0xa3,0x03,0xa7,
+0x00,0x66,0xda,0xaa,0xc0,0x01,0xb2,0x80,0x00,0xb0,0x0a,0x31,0xda,0xaa,0xd0,0x02,
+0x01,0x80,0x2e,0x04,0xf0,0x1b,0x0a,0x60,0xb0,0xb0,0xa0,0x00,0x30,0xb0,0xb0,0xa0,
+0x21,0x03,0xb1,0xb2,0xa0,0x2b,0x49,0xb9,0xba,0xa0,0x00,0x37,0xb9,0xb7,0xe0,0x01,
+0x51,0xa1,0xb0,0xb0,0x07,0x42,0x80,0xb0,0xa0,0x0b,0x07,0x30,0xb0,0xa0,0x38,0x0a,
+0x8e,0x05,0x21,0x00,0x00,0x52,0x02,0x71,0x14,0x50,0x07,0xb3,0xab,0xd6,0x20,0x07,
+0x05,0x92,0x54,0x09,0xaa,0xea,0xa4,0x09,0x50,0x01,0xa0,0x16,0x05,0xf1,0x05,0x00,
+0x92,0xda,0xaa,0xb0,0x07,0x62,0x70,0x00,0xb0,0x2b,0x02,0xc8,0x88,0xb0,0x01,0x02,
+0x81,0x11,0xa0,0x33,0x09,0xf6,0x1e,0x0b,0x40,0x04,0x70,0x00,0x00,0x59,0xbe,0xab,
+0xa3,0x43,0x00,0xa3,0x0a,0x40,0x18,0x48,0xa9,0x87,0xb1,0x00,0x01,0x74,0x47,0x10,
+0x00,0xa2,0x85,0x58,0x10,0x06,0x74,0x65,0x58,0x20,0x0d,0x1c,0x35,0x58,0x27,0x37,
+0x4a,0x00,0x06,0xb4,0x85,0x02,0xf0,0x06,0x08,0x7b,0x99,0x95,0x90,0x00,0x09,0x51,
+0x97,0x90,0x46,0x09,0x71,0x97,0x90,0x06,0x39,0x71,0x97,0x90,0x00,0x0a,0x00,0xf2,
+0x05,0x04,0x69,0x91,0x97,0x90,0x09,0x22,0xa2,0x11,0x90,0x0c,0x03,0x89,0x10,0x90,
+0x26,0x29,0x00,0x75,0xb0,0x6f,0x04,0xf0,0x0c,0x61,0x70,0xb0,0x54,0x00,0x40,0x82,
+0xb0,0xa0,0x27,0x00,0xbb,0xeb,0xb2,0x05,0x80,0xb0,0x00,0x82,0x00,0x00,0xea,0xaa,
+0xd2,0x00,0x90,0xb0,0x13,0x0e,0xe1,0xea,0xaa,0xd2,0x09,0x40,0xb0,0x00,0x82,0x09,
+0x00,0xb0,0x0a,0xc1,0x01,0x3b,0x04,0xf2,0x1d,0x7a,0xa9,0x9a,0xb0,0x00,0x2a,0x77,
+0x77,0xb0,0x30,0x0a,0x22,0x22,0xb0,0x3c,0x27,0xa9,0x9a,0x80,0x02,0x14,0x00,0x40,
+0x00,0x00,0x89,0xb8,0xb6,0x92,0x05,0x69,0x10,0xb4,0x00,0x0c,0x09,0x12,0xb0,0x08,
+0x46,0x0d,0xc8,0x8a,0xb5,0x6d,0x01,0x00,0x05,0x00,0xf0,0x4d,0x05,0xb7,0xad,0xca,
+0xa3,0x00,0x00,0x0a,0x20,0x00,0x23,0x0b,0xbe,0xbb,0xb7,0x1a,0x40,0xa3,0x0a,0x20,
+0x00,0x08,0x86,0x11,0xb4,0x01,0x76,0x59,0x42,0x73,0x07,0x45,0x49,0x56,0x92,0x0c,
+0x07,0x09,0x27,0x26,0x05,0x00,0x7c,0x00,0x00,0x07,0x54,0x68,0xb6,0x61,0x00,0x23,
+0x89,0xc8,0x80,0x35,0x03,0x35,0xa3,0x32,0x08,0x55,0x55,0x55,0x53,0x00,0x04,0xb9,
+0x99,0xb0,0x00,0xa4,0xb7,0x78,0xb0,0x04,0x74,0xb8,0x88,0xb0,0x0b,0x14,0x60,0x00,
+0xb0,0x07,0x04,0x60,0x2a,0x70,0x00,0x00,0xa8,0x0b,0xf0,0x22,0x53,0x70,0x38,0xb1,
+0x00,0x5c,0xba,0x92,0x00,0x10,0x08,0x30,0x81,0x00,0x2a,0x39,0x91,0x89,0xd5,0x00,
+0x1b,0xdb,0x90,0xa0,0x02,0x50,0x94,0xa0,0xa0,0x08,0x6b,0xe8,0xb0,0xa0,0x0c,0x00,
+0x92,0x90,0xa0,0x26,0x00,0x95,0x40,0xa0,0x00,0x00,0x00,0x00,0x00,0xf1,0x0b,0x01,
+0x00,0x00,0x00,0x00,0x04,0xb3,0xea,0xaa,0xc0,0x00,0x11,0xc5,0x55,0xc0,0x15,0x00,
+0xc3,0x33,0xb0,0x07,0x90,0xc9,0x99,0xa0,0x00,0x01,0x00,0xf1,0x04,0x66,0xbd,0xac,
+0xd1,0x00,0xb5,0x49,0x26,0x91,0x07,0x45,0x49,0x26,0x91,0x0b,0x2c,0xcd,0xbc,0xd9,
+0x18,0x00,0xf0,0x22,0x01,0x01,0x10,0x11,0x00,0x0a,0x62,0xb0,0x83,0x00,0x00,0x6b,
+0xcb,0xca,0xa4,0x34,0x08,0x22,0xa4,0x40,0x08,0x39,0xb8,0x38,0xc0,0x00,0x0a,0x0b,
+0x0a,0x00,0x04,0x4a,0x0b,0xae,0xa4,0x0a,0x1a,0x0a,0x0a,0x00,0x0b,0x45,0x19,0x0a,
+0x00,0x36,0x93,0xb5,0x6c,0x35,0x00,0xf0,0x26,0x10,0x00,0x02,0x00,0x02,0x40,0x00,
+0x0b,0x19,0xaa,0xda,0xa4,0x02,0x24,0x59,0x56,0x50,0x51,0x2a,0x19,0x55,0x83,0x3a,
+0x00,0x03,0x21,0x00,0x04,0x06,0x99,0x99,0xb0,0x07,0x23,0x98,0x88,0x80,0x0b,0x08,
+0xb9,0x99,0x90,0x29,0x00,0x00,0x00,0xb0,0x23,0x00,0x00,0x6a,0x70,0x02,0x39,0x00,
+0xf1,0x1f,0x08,0x9a,0xba,0xca,0xa4,0x00,0x1a,0x21,0xc2,0x10,0x43,0x0a,0x79,0x77,
+0xd0,0x1a,0x4a,0x6a,0x88,0xd0,0x00,0x0b,0x63,0x00,0xa0,0x01,0x6b,0x38,0xd8,0x80,
+0x07,0x5b,0x45,0xb0,0x90,0x0b,0x57,0xb0,0xb0,0x94,0x25,0x90,0x27,0xb0,0x01,0x01,
+0x32,0x00,0xf1,0x1d,0x80,0xd9,0x99,0xa0,0x00,0x40,0xd8,0x70,0xa0,0x22,0x04,0xc4,
+0xb5,0xc3,0x1a,0x5c,0x44,0x44,0x4b,0x00,0x04,0xd9,0x99,0xb4,0x00,0x90,0xd8,0x88,
+0xb0,0x03,0x80,0xd8,0x88,0xb0,0x0b,0x20,0xa0,0x00,0xb0,0x07,0x00,0xa0,0x39,0x90,
+0xd2,0x00,0xf1,0x23,0x02,0x00,0x03,0x20,0x00,0x08,0x79,0xab,0xda,0xa3,0x00,0x21,
+0xa1,0x0a,0x20,0x44,0x1c,0x4b,0x22,0xb2,0x09,0x32,0xb4,0x6b,0x10,0x00,0x07,0xae,
+0xc6,0x40,0x02,0x82,0xc3,0x94,0xa0,0x09,0x7a,0xb0,0x1e,0x20,0x1a,0x00,0xd9,0x62,
+0xc4,0x02,0x00,0x61,0x00,0x01,0x37,0x00,0xf1,0x78,0x09,0x51,0x93,0x73,0x70,0x00,
+0x3b,0xdb,0xdb,0xc5,0x22,0x01,0x92,0x73,0x60,0x1a,0x2a,0xaa,0xaa,0xa3,0x00,0x0a,
+0x03,0x70,0x55,0x01,0x74,0xbb,0xca,0x90,0x08,0x34,0x63,0x70,0xa0,0x1a,0x04,0x63,
+0x88,0x80,0x01,0x00,0x03,0x70,0x00,0x08,0x13,0x77,0x3c,0x31,0x02,0x76,0xaa,0x6d,
+0x62,0x11,0x09,0xbd,0xad,0x94,0x3c,0x21,0x1a,0x37,0x10,0x01,0x0c,0x9d,0xab,0xc2,
+0x00,0x6b,0x2a,0x67,0x72,0x06,0x6b,0x87,0xa9,0x92,0x0c,0x0b,0x51,0x61,0x82,0x25,
+0x0b,0x00,0x04,0xa1,0x07,0x30,0x05,0xa6,0x60,0x00,0x46,0x9b,0xb9,0x94,0x22,0x0a,
+0x07,0x00,0x72,0x1a,0x3a,0x5d,0x97,0x30,0x00,0x0a,0x06,0x98,0x90,0x00,0x6a,0x00,
+0x30,0x00,0x06,0x5a,0x45,0x73,0x70,0x0b,0x38,0xa9,0x03,0x94,0x26,0x84,0x48,0x89,
+0x54,0x8c,0x00,0xf2,0x24,0x12,0x00,0x50,0x14,0x00,0x09,0x5a,0xc7,0x45,0x00,0x00,
+0x48,0x3a,0x7c,0xa5,0x42,0x39,0x5b,0xc1,0x90,0x1a,0x3a,0x9c,0xe4,0x90,0x00,0x38,
+0xa5,0x38,0x90,0x04,0x5c,0x55,0x0b,0x60,0x0a,0x0b,0x9b,0x0b,0x30,0x19,0x19,0x0a,
+0x5a,0xc0,0x53,0xa3,0xa7,0xb0,0x57,0x00,0x01,0x00,0x10,0x39,0x05,0x00,0xf2,0x17,
+0x38,0x00,0x00,0x00,0xc0,0x47,0x00,0xb1,0x03,0x90,0x67,0x02,0xa0,0x0a,0x20,0x9b,
+0x09,0x20,0x00,0x00,0xca,0x20,0x00,0x00,0x08,0x72,0xb0,0x00,0x00,0x8a,0x00,0x4c,
+0x30,0x0c,0x60,0x00,0x02,0xa7,0x31,0x00,0xf2,0x1c,0xa0,0x9b,0xbb,0xb4,0x03,0xa4,
+0x10,0x29,0x00,0x17,0xa9,0x00,0x29,0x00,0x44,0xb5,0x00,0x29,0x00,0x11,0xb0,0x00,
+0x29,0x00,0x01,0xc0,0x00,0x29,0x00,0x05,0x99,0x00,0x29,0x00,0x0b,0x05,0x00,0x29,
+0x00,0x56,0x00,0x0b,0xc6,0x31,0x00,0xf2,0x7d,0x04,0xaa,0xaa,0xab,0x90,0x00,0x67,
+0x77,0x78,0x90,0x00,0x11,0x11,0x13,0x90,0x04,0xaa,0xab,0xaa,0x60,0x00,0x50,0x39,
+0x00,0x40,0x04,0x80,0x79,0x06,0x50,0x04,0x01,0xc8,0x45,0x00,0x00,0x5c,0x30,0x89,
+0x30,0x1a,0x60,0x00,0x03,0x87,0x00,0x00,0x1b,0x11,0x10,0x00,0x00,0x1e,0x99,0x90,
+0x00,0x11,0x3b,0x11,0x10,0x01,0xd9,0x99,0x99,0xb0,0x01,0x90,0x00,0x00,0xb0,0x01,
+0xcb,0xbb,0xbb,0xa0,0x01,0x50,0x20,0x30,0x50,0x09,0x42,0x90,0xb0,0x81,0x17,0x00,
+0x70,0x51,0x23,0x00,0x14,0x04,0x00,0x00,0x00,0xa5,0x1b,0x21,0x10,0x04,0xd8,0x8d,
+0x88,0x82,0x3c,0xe9,0x9e,0x99,0x60,0x01,0xc2,0x2c,0x22,0x10,0x00,0xd6,0x6d,0x66,
+0x40,0x00,0xe9,0x9e,0x99,0x91,0x02,0x72,0x12,0x12,0x40,0x0a,0x16,0x43,0x80,0xb2,
+0x14,0x02,0x20,0x50,0x24,0x92,0x00,0xf2,0x1d,0x88,0x31,0x0b,0x80,0x00,0xb5,0xb4,
+0x0b,0x35,0x0b,0x59,0xc7,0xbe,0xa8,0x26,0x76,0x70,0x4f,0x10,0x00,0x7c,0x00,0xb5,
+0x80,0x09,0xb0,0x2b,0x40,0xa7,0x04,0x10,0x52,0x00,0x14,0x08,0x54,0x60,0xb0,0xa3,
+0x1a,0x02,0x70,0x90,0x1a,0x27,0x01,0x00,0xc1,0x02,0xf3,0x1e,0x00,0xa0,0x24,0xd3,
+0x30,0x01,0xa4,0xa4,0x44,0xc0,0x17,0xa9,0xa8,0x88,0xd0,0x54,0xb3,0xa7,0x77,0xd0,
+0x11,0x90,0xa8,0x88,0xd0,0x03,0x90,0x03,0x70,0x00,0x06,0xb7,0x55,0x73,0x60,0x0b,
+0x08,0x67,0x02,0x85,0x55,0x05,0x1b,0x9b,0x35,0x36,0x00,0xf0,0x01,0x50,0x00,0x00,
+0x07,0xbb,0xc5,0x99,0x91,0x0a,0x54,0x97,0x28,0x72,0x0a,0x54,0xa7,0x05,0x00,0xf2,
+0x0d,0x97,0xab,0xb2,0x0a,0x54,0xa7,0x20,0x00,0x0a,0x54,0xa7,0x30,0x45,0x09,0x54,
+0x68,0x99,0x81,0x55,0x54,0x0b,0x60,0x00,0x81,0x54,0x00,0x6b,0xb5,0x36,0x00,0x33,
+0xc0,0x09,0x20,0x05,0x00,0x60,0xfb,0xbe,0xcb,0xb2,0x00,0xc0,0x75,0x03,0xf2,0x08,
+0xea,0xaa,0xa5,0x00,0x02,0x91,0x11,0x68,0x00,0x06,0x50,0x00,0x58,0x00,0x0c,0x10,
+0x00,0x58,0x00,0x37,0x00,0x00,0x58,0x31,0x00,0xf1,0x1f,0x0a,0x0a,0x09,0x88,0x83,
+0x0a,0x0a,0x0b,0x00,0x00,0x0d,0xac,0x4e,0xaa,0xb4,0x0b,0x00,0x0b,0xa0,0x64,0x0e,
+0xa9,0x0b,0xa1,0xa0,0x0a,0x0a,0x1a,0x58,0xa0,0x19,0x0a,0x28,0x0e,0x30,0x56,0x0a,
+0x75,0x8a,0xa0,0x71,0x0a,0xa6,0x60,0x48,0x00,0x25,0x03,0xa0,0xbb,0xbb,0xec,0xa0,
+0x00,0x90,0x00,0x92,0x00,0x02,0x05,0x00,0xf2,0x0f,0x06,0xca,0xaa,0xdb,0xa4,0x00,
+0x11,0x2c,0xc3,0x10,0x00,0x02,0xc2,0x92,0x00,0x00,0x5c,0x20,0x92,0x00,0x2c,0xa1,
+0x00,0x92,0x00,0x03,0x00,0x1b,0xc0,0x00,0x25,0x03,0xf0,0x16,0xb0,0x00,0x92,0x00,
+0x19,0xb1,0x5a,0xdb,0xa1,0x4b,0xe7,0x22,0xa4,0x21,0x61,0xb0,0x55,0x59,0x93,0x03,
+0xd9,0x9a,0xac,0xc5,0x6a,0xc0,0x24,0x05,0x50,0x00,0xb0,0x0b,0x15,0x50,0x00,0xb0,
+0x03,0x05,0x00,0xf0,0x4b,0x00,0x8c,0x30,0x00,0xb0,0x01,0x94,0x30,0x64,0xb0,0x01,
+0x90,0x90,0x09,0xc6,0xab,0xda,0xa5,0x00,0xb0,0x14,0xe1,0x10,0x04,0xf0,0x06,0xe3,
+0x00,0x4b,0xc0,0x0b,0x38,0x00,0x60,0xb0,0x4a,0x0b,0x10,0x00,0xb1,0xd1,0x03,0xa0,
+0x00,0xb9,0x40,0x00,0x56,0x00,0x00,0x24,0x00,0x00,0x0a,0xaa,0xbe,0xaa,0xa6,0x04,
 0x00,0xa1,0x50,0x40,0x04,0xb6,0xda,0x57,0x70,0x00,0x22,0x67,0x34,0x00,0x07,0xa8,
-0xd8,0xe8,0xa0,0x03,0x03,0x47,0x21,0x32,0x2a,0xaa,0xbe,0xaa,0xa7,0x5c,0x0d,0xf3,
-0x17,0x8a,0xa5,0xbb,0xbb,0xb4,0x05,0x40,0x00,0xc1,0x00,0x05,0x40,0x05,0xb1,0x00,
-0x4c,0xc2,0x1c,0xcb,0x10,0x05,0x40,0xc4,0xb3,0xb0,0x05,0x46,0x60,0xb0,0x62,0x08,
-0xc2,0x00,0xb0,0x00,0x77,0x10,0x00,0xfb,0x37,0xf2,0x04,0x4b,0xba,0x9a,0xaa,0xc0,
-0x00,0xa0,0x91,0x40,0xb0,0x00,0xa0,0x91,0xa0,0xb0,0x2b,0xe7,0x91,0xb0,0x0a,0x00,
-0xf1,0x05,0x00,0xa0,0x21,0xb1,0x30,0x01,0xdb,0x06,0x85,0x04,0x5d,0x71,0x2a,0x55,
-0x17,0x00,0x04,0xb1,0x3b,0xa4,0xdb,0x03,0xf0,0x23,0x3a,0xa9,0x0a,0x8b,0xb4,0x01,
-0x90,0x2a,0x0a,0x00,0x01,0x90,0x9a,0x0a,0x00,0x17,0xc5,0x8a,0x0a,0x00,0x05,0xb7,
-0x4b,0x6e,0xb2,0x01,0x91,0x0c,0x0a,0x00,0x01,0xa3,0x1a,0x0a,0x00,0x3b,0xa5,0xa3,
-0x1a,0x20,0x00,0x06,0x51,0x99,0x95,0x3b,0xc9,0xba,0xda,0xa9,0x2e,0x5b,0xa1,0x01,
-0x90,0x00,0xa0,0xb9,0xd9,0xa9,0x02,0xce,0x8a,0x0b,0x00,0xf0,0x01,0x7a,0xea,0xa6,
-0x00,0x0a,0x01,0x1b,0x21,0x00,0x01,0xd8,0x89,0xea,0x97,0x03,0xe9,0x12,0x37,0xf4,
-0x22,0x10,0x06,0xaa,0xeb,0xaa,0x00,0x8b,0xb4,0x70,0xc0,0xa0,0x08,0x23,0xa5,0xd4,
-0xb0,0x08,0x21,0x55,0x55,0x50,0x7d,0xb8,0xaa,0xca,0xa2,0x08,0x20,0x03,0x80,0x00,
-0x08,0x24,0xcd,0xad,0xe0,0x09,0x86,0x59,0x09,0xa0,0x79,0x45,0x59,0x09,0xa0,0x00,
-0x04,0x59,0xa5,0x0e,0x20,0x72,0x29,0x15,0x32,0xb0,0xbd,0xaa,0xa2,0x09,0x41,0x3a,
-0x11,0x10,0x06,0x00,0x29,0x4c,0x31,0x10,0xce,0x47,0x09,0x1d,0x29,0x5c,0x49,0x10,
-0x07,0xe5,0x31,0x01,0x98,0x31,0x90,0x98,0xe8,0x88,0xb0,0xa3,0x1c,0x11,0x1b,0x0b,
-0xf5,0x0b,0x40,0xcb,0xbe,0xbb,0xbb,0xca,0x12,0xa2,0xb3,0x80,0x0b,0x00,0x0b,0x91,
-0x00,0xb0,0x9b,0x80,0xb6,0x09,0x00,0x65,0x12,0xc1,0xeb,0xbb,0xa0,0xc0,0x0c,0x00,
-0x0b,0x0c,0xaa,0xeb,0xaa,0xb0,0x09,0x00,0x60,0xbb,0xfb,0xbb,0xb0,0x80,0x0c,0xbb,
-0x12,0x00,0xdb,0x03,0xf2,0x03,0x06,0xcb,0xbc,0x30,0x09,0xaa,0xdb,0xad,0x30,0x09,
-0x98,0xca,0x8c,0x30,0x09,0x10,0x82,0x09,0x0f,0x00,0xf0,0x02,0x00,0x4a,0x02,0xb1,
-0x00,0x29,0x96,0x00,0x9c,0x70,0x43,0x0b,0x00,0xb0,0x50,0x00,0x86,0x67,0x08,0x16,
-0x80,0xf6,0x0c,0xf0,0x0f,0x06,0x00,0x0c,0xbc,0x05,0xd8,0x91,0x97,0x92,0xe6,0x2c,
-0x09,0x79,0x83,0xb9,0x40,0xdc,0xd0,0x2b,0xd2,0x09,0x79,0x8a,0x21,0x96,0x97,0x90,
-0xba,0xae,0x0d,0x8e,0x00,0x42,0x60,0x00,0xba,0xae,0x61,0x13,0x12,0x04,0x3a,0x34,
-0x40,0x8b,0xcd,0xbb,0xc1,0x70,0x3d,0x00,0x04,0x00,0x03,0x51,0x31,0x08,0x0c,0x00,
-0x20,0x91,0x02,0xe4,0x12,0xf0,0x0c,0xa3,0x02,0x80,0x00,0xbd,0xa8,0x6c,0xac,0x1a,
-0x00,0xbb,0x00,0x91,0xa0,0x0b,0x53,0x0a,0x0e,0xaa,0xa0,0xb0,0xa0,0xa0,0x0a,0x04,
-0x7b,0x0a,0xf0,0x08,0x30,0xea,0xa7,0x00,0x54,0x37,0x24,0x8b,0x70,0x84,0x03,0x10,
-0x23,0x90,0x48,0xf2,0x10,0xb1,0x00,0x5a,0xad,0xaa,0xda,0xa0,0x00,0x13,0x01,0x30,
-0x00,0x03,0xb3,0x01,0x9b,0x30,0x4b,0x21,0x11,0x13,0x90,0x06,0xac,0xad,0x9d,0x00,
-0x06,0x38,0x29,0x1a,0x05,0x00,0x52,0x7c,0xbd,0xbd,0xbe,0xa3,0x25,0x1d,0x30,0x0b,
-0x04,0x70,0x77,0x16,0xf2,0x0b,0xaa,0xa2,0x0b,0x0b,0x47,0x51,0x00,0x0b,0x0b,0x70,
-0x3d,0x30,0x00,0x07,0x00,0x03,0x40,0x09,0xad,0xad,0xbd,0x30,0x09,0x18,0x18,0x27,
-0x05,0x00,0x80,0x7d,0xbd,0xbd,0xbd,0xc3,0x00,0x20,0x00,0xa2,0x2d,0xb0,0x01,0xc1,
-0x00,0x08,0x88,0xd9,0x88,0x50,0x05,0x99,0xda,0x60,0x40,0xf1,0x03,0xa3,0x11,0x10,
-0x37,0x77,0x77,0x77,0x70,0x07,0xab,0xab,0xaa,0x30,0x0a,0x09,0x18,0x27,0x40,0x05,
-0x00,0x20,0x7e,0xad,0x32,0x00,0x01,0x3d,0x38,0xf0,0x08,0x99,0xe9,0x98,0x00,0x01,
-0xa0,0x82,0x0b,0x00,0x7a,0xea,0xac,0xae,0xa3,0x06,0x61,0x80,0x0b,0x00,0x2c,0x00,
-0x25,0x8a,0xbf,0x30,0x71,0xaa,0x10,0x09,0x19,0x19,0x18,0x20,0x05,0x00,0x00,0x64,
-0x00,0xf0,0x07,0xb3,0x9c,0xbb,0xbb,0xf9,0x10,0x00,0x0c,0x9a,0x99,0x99,0xe9,0x31,
-0x11,0x1c,0x91,0x00,0x00,0xc9,0xbb,0xbb,0xbe,0x07,0x00,0x41,0xcb,0xbb,0xbf,0x91,
-0x06,0x2f,0x01,0x46,0x03,0x00,0xa0,0x2f,0x40,0x22,0x86,0x22,0x00,0xf8,0x1f,0x30,
-0x50,0x00,0xc9,0x79,0x11,0x83,0xb3,0x33,0x37,0x50,0x00,0xc6,0x66,0x69,0x0f,0x00,
-0x00,0x1f,0x0a,0x20,0x29,0x99,0x20,0x46,0xf1,0x19,0xa0,0x7c,0xbb,0xe4,0x7c,0x78,
-0x30,0x0b,0x27,0xb3,0x8b,0x99,0xe0,0x9d,0x17,0x40,0x0b,0x0a,0xca,0x73,0x00,0xb8,
-0x5a,0x48,0xca,0xae,0x60,0xa0,0x73,0x00,0xb0,0x0a,0x07,0xca,0xae,0x00,0xa0,0x73,
-0x00,0xa0,0xe6,0x18,0xf0,0x02,0x04,0x99,0xe8,0x75,0x20,0x04,0x99,0xe9,0x99,0x90,
-0x01,0x26,0x92,0x22,0x20,0x19,0x9e,0x11,0x48,0xf1,0x09,0x9d,0x88,0x88,0x70,0x0a,
-0x8c,0x88,0x89,0x90,0x14,0x2b,0x66,0x67,0x90,0x00,0x2a,0x22,0x24,0x90,0x00,0x2d,
-0x99,0x9a,0x90,0x5d,0x08,0xf1,0x0a,0x04,0x44,0x6b,0x44,0x41,0x04,0x55,0x9a,0x55,
-0x52,0x00,0xb7,0x77,0x7c,0x30,0x00,0xb6,0x66,0x6b,0x30,0x00,0xb7,0x77,0x7b,0x30,
-0x0f,0x00,0xe0,0x1a,0xca,0xaa,0xac,0xb6,0x00,0x5a,0x10,0x69,0x40,0x09,0x50,0x00,
-0x01,0xf0,0x2d,0xf0,0x1b,0x02,0x42,0x0d,0xb8,0xa9,0xc6,0x62,0x08,0x27,0x46,0x72,
-0xa0,0x0d,0xb8,0xab,0xaa,0xc8,0x08,0x28,0x92,0x00,0x48,0x0d,0xb7,0x7a,0xb9,0xd6,
-0x08,0x2b,0xa6,0x96,0x90,0x0d,0xb8,0x1e,0x4a,0xd6,0x06,0x01,0xa6,0x00,0x90,0x51,
-0x07,0x22,0x90,0x02,0x6c,0x24,0xf2,0x16,0x47,0x77,0x0d,0xdc,0x89,0x53,0xc7,0x58,
-0x30,0x91,0x0b,0x32,0x94,0x19,0x10,0xb5,0x9d,0xa9,0xa1,0x0b,0x00,0xc5,0x09,0x10,
-0xb0,0x1a,0x95,0x91,0x0b,0x0a,0x30,0x99,0xbb,0xe7,0x70,0x00,0x91,0x85,0x29,0xf0,
-0x16,0x4c,0xda,0x6a,0xab,0x70,0x06,0x40,0x04,0x04,0x60,0x0a,0x00,0x28,0x06,0x40,
-0x1e,0xa8,0x46,0x08,0x20,0x8d,0x0a,0x3a,0xaa,0xc5,0x2a,0x0a,0x00,0x00,0x73,0x0a,
-0x0a,0xab,0xba,0x91,0x0b,0xa7,0x6c,0x06,0x33,0x00,0x00,0x4a,0xe0,0x19,0x00,0x68,
-0x50,0xf0,0x21,0x4c,0xda,0x89,0xe9,0x92,0x06,0x50,0x46,0xd6,0x60,0x0a,0x10,0xa3,
-0xc3,0xb0,0x0e,0xa9,0xa8,0xe8,0xd0,0x7e,0x0a,0xa0,0xb0,0x90,0x3a,0x0a,0x79,0xe9,
-0x90,0x0a,0x0a,0x57,0x90,0x00,0x0b,0xa9,0x2d,0xa3,0x10,0x01,0x01,0x71,0x16,0x82,
-0x00,0x00,0x05,0x69,0x00,0xf3,0x1a,0x0e,0xa9,0x00,0x06,0x40,0x84,0x19,0x00,0x0a,
-0x14,0xfa,0xdb,0xc0,0x1e,0xb8,0x91,0xa0,0xa0,0x7e,0x09,0x9a,0xd9,0xe0,0x3a,0x09,
-0xa3,0xb2,0xb0,0x0a,0x09,0xb7,0xd7,0xd0,0x0b,0xa8,0xb0,0xa0,0xa0,0x03,0x07,0x40,
-0x71,0x46,0x10,0x03,0xb5,0x03,0x06,0xc7,0x0a,0x02,0x16,0x40,0x70,0x10,0x29,0x02,
-0x00,0x00,0xc1,0x29,0x5c,0x52,0xb0,0x29,0x01,0xc0,0x2b,0x00,0x29,0x00,0x84,0x00,
-0x09,0xc7,0x91,0x0e,0xf2,0x08,0x67,0x9d,0x93,0x01,0xdb,0x10,0x9f,0x40,0x08,0xa8,
-0x95,0x8b,0xb1,0x28,0x55,0x19,0x0a,0x37,0x00,0x77,0x66,0x78,0x30,0xcb,0x10,0xe1,
-0x31,0x19,0x05,0x00,0x03,0xb0,0x19,0x07,0x80,0x09,0x05,0xa7,0x00,0x72,0xbf,0x31,
-0x00,0xf8,0x2d,0xf0,0x14,0xa5,0x00,0x43,0x41,0x71,0x30,0x00,0xa0,0xac,0x43,0x70,
-0x00,0xc9,0x64,0x97,0x70,0x00,0x55,0x8a,0x55,0x20,0x0a,0xaa,0xea,0xaa,0xd1,0x0a,
-0x06,0x61,0xb0,0x91,0x0a,0x1c,0xa9,0x76,0x28,0x01,0xf0,0x1e,0x08,0xb0,0x26,0x97,
-0x00,0xb0,0x00,0x12,0xa0,0x33,0xb3,0x30,0x7b,0xea,0x83,0xb0,0xb0,0x05,0xd0,0xa0,
-0xb0,0x92,0x0a,0xd8,0x60,0xb0,0x40,0x38,0xa6,0x00,0xb4,0x80,0x92,0xa0,0x00,0x3b,
-0x10,0x00,0xa0,0x06,0xb2,0x00,0x00,0xa4,0xb6,0xb6,0x01,0xf0,0x4b,0x10,0x00,0x00,
-0x2a,0xca,0x3a,0xbb,0xb1,0x00,0x82,0x0a,0x00,0x91,0x28,0xc9,0x6a,0x00,0x91,0x02,
-0xd7,0x2a,0x00,0x91,0x03,0xeb,0x2b,0xbb,0xb1,0x0b,0x93,0x51,0x00,0x10,0x46,0x82,
-0x08,0x32,0xa0,0x00,0x82,0x1b,0x00,0xa2,0x00,0x82,0x64,0x00,0x45,0x00,0x15,0x05,
-0x00,0x00,0x2a,0xd4,0x0b,0x33,0x30,0x00,0xa0,0x59,0xd7,0xd1,0x4b,0xeb,0xb0,0xa1,
-0x70,0x02,0xe0,0x35,0xa3,0x40,0x08,0xca,0x36,0xa2,0xa0,0x19,0xa3,0x82,0xa0,0xb0,
-0x71,0xa0,0xb0,0xa0,0x92,0x00,0xa0,0xfd,0x1b,0x21,0xa0,0x07,0xda,0x02,0xf7,0x1f,
-0x70,0x00,0x2a,0xd3,0x09,0xd9,0x80,0x00,0xb0,0xb8,0x08,0x60,0x4a,0xe9,0x05,0xd8,
-0x00,0x06,0xe2,0x9a,0x76,0x00,0x09,0xd8,0x12,0xda,0xb5,0x28,0xb3,0x7a,0x20,0xc0,
-0x71,0xb0,0x31,0xbb,0x50,0x00,0xb0,0x04,0xb5,0x00,0x00,0xb2,0xb8,0x10,0x41,0x2f,
-0xf0,0x02,0x1a,0xd5,0xaa,0xaa,0xd0,0x00,0xa0,0xa0,0x00,0xb0,0x38,0xd7,0x9a,0xaa,
-0xd0,0x16,0xd3,0xb9,0x09,0x50,0xf5,0x9a,0xea,0xa3,0x1a,0x39,0x30,0x61,0x74,0xa0,
-0x6a,0xea,0xa0,0x10,0x9d,0x11,0xf2,0x27,0xa2,0xaa,0xea,0xa5,0x00,0x02,0x04,0x00,
-0x00,0x0a,0xd6,0x2e,0x9a,0x50,0x00,0xb2,0xc3,0x2b,0x30,0x28,0xd8,0x67,0x77,0xc1,
-0x05,0xe2,0x59,0x99,0xd1,0x07,0xe7,0x00,0x00,0x81,0x0a,0xb6,0x89,0xa9,0x91,0x65,
-0xb0,0x35,0x93,0x40,0x10,0xb6,0x5b,0x04,0x87,0x00,0xb5,0x0b,0x9a,0x65,0x46,0x40,
-0x10,0x2c,0x31,0x0c,0xe0,0xaa,0xab,0xab,0x04,0x50,0x63,0x1a,0x7a,0x80,0x00,0x6a,
-0x23,0xba,0xaa,0xf4,0x33,0x14,0xc0,0x33,0x3c,0x71,0xc0,0x00,0x0a,0xaa,0xae,0xaa,
-0xa7,0x92,0x00,0x01,0x1e,0x4f,0xf1,0x06,0x0e,0x89,0x98,0x98,0xb6,0x09,0x1b,0x20,
-0xa6,0x44,0x05,0xa2,0x14,0x36,0x90,0x00,0x00,0x47,0x47,0x00,0x2a,0x77,0x14,0xf2,
-0x02,0x01,0xc5,0x80,0x00,0x00,0x4c,0x20,0x88,0x20,0x0b,0x81,0x00,0x04,0xb7,0x00,
-0x02,0x30,0x8f,0x45,0xf1,0x15,0xb0,0x82,0x07,0x54,0x77,0xa3,0x81,0x05,0xa2,0x2b,
-0x8b,0x88,0x8a,0x02,0x92,0xc7,0x71,0xc0,0x29,0x87,0x29,0x0c,0x02,0x90,0x6d,0x90,
-0xc0,0x29,0x84,0x04,0x2c,0x02,0xd8,0x88,0x88,0xb0,0x22,0x38,0xf2,0x05,0x06,0xaa,
-0xbd,0xaa,0xa1,0x00,0x18,0x00,0x37,0x00,0x19,0x9b,0x99,0xaa,0x96,0x00,0x8a,0xaa,
-0xaa,0x30,0x7b,0x15,0xf2,0x04,0xc9,0x99,0x9c,0x50,0x00,0x05,0x62,0x90,0x00,0x00,
-0x2c,0x12,0x90,0x09,0x1a,0xa2,0x00,0xca,0xb5,0xd9,0x07,0xf3,0x1c,0x80,0x90,0xe0,
-0x73,0x4a,0xca,0xa5,0xe5,0xa3,0x03,0x04,0x45,0x55,0x51,0x09,0x29,0xaa,0xca,0xa5,
-0x09,0x45,0x01,0xd0,0x00,0x09,0x62,0xcd,0xad,0xc5,0x05,0xa6,0x98,0x09,0x45,0x5c,
-0x84,0x98,0x09,0x45,0x00,0x00,0x97,0x08,0x4a,0x1e,0xf3,0x22,0x40,0x02,0x30,0x00,
-0x06,0xc9,0x79,0xb9,0x94,0x2a,0x38,0x4a,0x0c,0x10,0x07,0x9a,0xaa,0x9b,0x60,0x00,
-0x11,0xa3,0x12,0xa0,0x06,0x97,0xc8,0x77,0x40,0x09,0xba,0xda,0xaa,0x90,0x00,0x0a,
-0xd1,0x00,0xc0,0x01,0xa4,0xa1,0x12,0xb0,0x1b,0x30,0xa1,0x58,0x20,0x37,0x00,0xf0,
-0x03,0x01,0x40,0x00,0x06,0xd9,0x98,0xc9,0x96,0x2a,0x47,0x2b,0x1b,0x00,0x03,0xaa,
-0xbd,0x9a,0x70,0x67,0x46,0xf0,0x04,0x11,0x28,0x88,0x88,0x9d,0x86,0x08,0x99,0x99,
-0xad,0x94,0x01,0x58,0x11,0x3a,0x10,0x00,0x09,0x60,0xd1,0x06,0xf0,0x16,0x27,0xb6,
-0x00,0x03,0x10,0x05,0x00,0x00,0x0c,0xa9,0x8f,0x99,0x91,0x57,0x92,0x84,0x47,0x00,
-0x40,0x18,0xba,0x13,0x00,0x03,0xa7,0x01,0xa8,0x20,0x78,0x49,0x99,0x73,0xa2,0x02,
-0x30,0x90,0x09,0x6e,0x30,0xc1,0x37,0x00,0x00,0x61,0x23,0xb1,0x00,0x5a,0xaa,0xab,
-0xea,0xa0,0x20,0x06,0x90,0x0d,0xa9,0x7e,0xa9,0x91,0x84,0x91,0x93,0x47,0x66,0x16,
-0x71,0x7c,0x20,0x06,0x96,0x66,0x6c,0x20,0x0a,0x00,0xf4,0x02,0x03,0x8c,0x77,0xc8,
-0x10,0x69,0xad,0x99,0xe9,0x92,0x01,0xb2,0x00,0xb0,0x00,0x3c,0x40,0xac,0x06,0xf0,
-0x0a,0x02,0x10,0x01,0x20,0x00,0x0a,0xa8,0x79,0xc8,0x83,0x48,0x28,0x39,0x0a,0x00,
-0x0a,0x88,0xaa,0x88,0xa1,0x0b,0x79,0x99,0x98,0x91,0xb4,0x11,0x00,0x4c,0x05,0x10,
-0x88,0xa2,0x26,0x27,0x99,0x40,0x03,0x39,0xf6,0x4a,0x73,0x38,0x0a,0x10,0x0a,0xbc,
-0xbd,0xbc,0xa4,0x00,0x05,0xce,0xa1,0x00,0x00,0x78,0x38,0x3b,0x40,0x09,0x30,0x37,
-0x00,0x72,0x1b,0xbb,0xcd,0xbb,0xb5,0x00,0x02,0xc7,0x80,0x00,0x04,0x9b,0x20,0x6b,
-0x72,0x17,0x30,0x00,0x00,0x44,0x03,0x83,0x60,0xb0,0x00,0x0a,0x86,0x70,0xb9,0x95,
-0x05,0x97,0x20,0xb2,0x11,0x29,0xea,0x70,0xb0,0x00,0x01,0xf8,0x1b,0xeb,0xb7,0x09,
-0xa8,0x97,0x00,0x0b,0x47,0x82,0x37,0x00,0x0b,0x00,0x82,0x2c,0x99,0xab,0x00,0x82,
-0x27,0x11,0x1a,0x06,0x04,0xf6,0x1c,0x13,0xa4,0x46,0xc7,0x62,0x08,0xb9,0x38,0xd9,
-0x81,0x06,0xc4,0x34,0xb4,0x42,0x3b,0xe8,0x45,0x55,0x53,0x06,0xf3,0x3b,0x99,0xd0,
-0x0a,0xba,0x4b,0x77,0xd0,0x47,0xa0,0x3b,0x88,0xd0,0x10,0xa0,0x36,0x00,0xb0,0x00,
-0xa0,0x36,0x45,0x24,0xf3,0x20,0x13,0x20,0x05,0xab,0xdb,0x97,0x30,0x00,0x07,0x60,
-0x35,0x00,0x00,0xbc,0x9a,0xb1,0x00,0x00,0x33,0xd8,0x0a,0x00,0x00,0x6c,0x42,0x3a,
-0x80,0x07,0xba,0x9d,0x65,0xa3,0x00,0x47,0x0a,0x2a,0x10,0x06,0xb0,0x0a,0x03,0xb1,
-0x05,0x04,0xb8,0x00,0x32,0x40,0x0a,0xf1,0x25,0x4e,0xaa,0xd0,0x0a,0x0a,0x04,0x7a,
-0x40,0x0a,0x0a,0x04,0xec,0x20,0x04,0x0a,0xc6,0x13,0xa5,0x00,0x8d,0x67,0xa0,0x00,
-0x00,0x8c,0xa3,0x0a,0x30,0x0a,0xca,0x9e,0x87,0xa2,0x00,0x85,0x0b,0x2a,0x20,0x0a,
-0x23,0xa9,0x01,0x91,0x0b,0x99,0xe9,0x9e,0x00,0xb8,0x8e,0x88,0xe0,0xba,0x2c,0xf1,
-0x0e,0x6a,0xe9,0xaa,0x90,0x04,0xca,0xa7,0x50,0x00,0x6b,0xd8,0x8b,0xb0,0x05,0x52,
-0xb2,0x23,0x10,0x6a,0x0a,0x29,0x70,0x47,0x07,0xc0,0x06,0x30,0x00,0x50,0x28,0x2f,
-0xf0,0x0a,0x8a,0xaa,0xa3,0x08,0x23,0x11,0xa3,0x10,0x4b,0x6a,0x00,0x92,0x00,0x47,
-0xc0,0x00,0x92,0x00,0x0a,0x43,0x00,0x92,0x00,0x6c,0x97,0xf2,0x3c,0x10,0x14,0x0a,
-0x00,0x44,0xa6,0xbb,0xec,0xb6,0x2b,0x1b,0x00,0xed,0x33,0xf3,0x1c,0xbe,0xbe,0x30,
-0x08,0x13,0x0b,0x0b,0x00,0x29,0x49,0x0b,0x0b,0x00,0x69,0xd0,0x1f,0x3a,0xe1,0x07,
-0x54,0x3e,0x70,0xb0,0x5d,0x83,0x65,0xc8,0x60,0x00,0x49,0xb1,0x6e,0x00,0x5b,0x74,
-0xa5,0xb8,0xa0,0x00,0x05,0x38,0x00,0x44,0xc3,0x14,0xf0,0x7b,0x29,0x0b,0x00,0x04,
-0x60,0x28,0x0b,0x00,0x0a,0x19,0x37,0x0b,0x00,0x5c,0xd3,0x47,0x0d,0x00,0x03,0x70,
-0x68,0x0f,0x20,0x2e,0xa6,0x9c,0x4d,0x50,0x13,0x00,0xc3,0xc5,0x90,0x28,0xba,0x91,
-0xc0,0xa2,0x13,0x09,0x16,0x40,0x36,0x00,0x91,0x00,0xb6,0x40,0x01,0x90,0x00,0xb1,
-0x70,0x09,0x19,0x5a,0xe9,0x71,0x3d,0xc6,0x00,0xb1,0x43,0x01,0x90,0x6a,0xe8,0x62,
-0x1d,0xa9,0x00,0x82,0x93,0x04,0x00,0x00,0x5d,0x40,0x18,0xb9,0x17,0xbc,0x06,0x13,
-0x00,0x95,0x04,0xc6,0x01,0x20,0x04,0x10,0x00,0x07,0x33,0x5c,0x55,0x50,0x0a,0x13,
-0x5c,0x55,0x50,0x67,0xa4,0xbd,0x90,0x00,0x6a,0x70,0x91,0xa0,0x00,0x0a,0x11,0xea,
-0xea,0x90,0x8d,0xa2,0x20,0xa1,0x10,0x10,0x31,0xc1,0xa2,0x90,0x5b,0x78,0x70,0xa0,
-0xa1,0x20,0x04,0x0a,0xa0,0x11,0xb7,0x3f,0x00,0x1e,0x14,0x50,0xaa,0xc0,0x03,0x70,
-0x0a,0xe3,0x24,0xf0,0x04,0x2a,0x11,0xb0,0x4c,0xc4,0x0d,0x88,0xc0,0x02,0x70,0x1a,
-0x00,0xb0,0x2e,0xa8,0x1e,0xaa,0xc0,0x00,0x42,0x45,0xa2,0x17,0xaa,0x2a,0x00,0xb0,
-0x25,0x10,0xbe,0xaa,0xe7,0x47,0x40,0xf0,0x19,0xc0,0xab,0xeb,0xe0,0x07,0x50,0xa0,
-0xb0,0xa0,0x1b,0x3b,0xb0,0xb0,0xa0,0x7c,0xe4,0xa0,0xb0,0xa0,0x05,0x60,0xaa,0xea,
-0xe0,0x5f,0xa9,0xb0,0xb0,0xa0,0x10,0x00,0xb0,0xb0,0xa0,0x5a,0xa9,0xbb,0xeb,0xe0,
-0x10,0x01,0x4c,0x03,0xf5,0x00,0xf0,0x16,0x08,0x61,0x10,0x07,0x40,0x3e,0x8a,0xb0,
+0xd8,0xe8,0xa0,0x03,0x03,0x47,0x21,0x32,0x2a,0xaa,0xbe,0xaa,0xa7,0x00,0x00,0x1c,
+0x04,0x00,0x05,0x00,0xf0,0x19,0x8a,0xa5,0xbb,0xbb,0xb4,0x05,0x40,0x00,0xc1,0x00,
+0x05,0x40,0x05,0xb1,0x00,0x4c,0xc2,0x1c,0xcb,0x10,0x05,0x40,0xc4,0xb3,0xb0,0x05,
+0x46,0x60,0xb0,0x62,0x08,0xc2,0x00,0xb0,0x00,0x77,0x10,0x00,0xb0,0x00,0x4b,0x04,
+0xf2,0x05,0x00,0x4b,0xba,0x9a,0xaa,0xc0,0x00,0xa0,0x91,0x40,0xb0,0x00,0xa0,0x91,
+0xa0,0xb0,0x2b,0xe7,0x91,0xb0,0x0a,0x00,0xf1,0x05,0x00,0xa0,0x21,0xb1,0x30,0x01,
+0xdb,0x06,0x85,0x04,0x5d,0x71,0x2a,0x55,0x17,0x00,0x04,0xb1,0x3b,0xa4,0xdb,0x03,
+0xf1,0x31,0x3a,0xa9,0x0a,0x8b,0xb4,0x01,0x90,0x2a,0x0a,0x00,0x01,0x90,0x9a,0x0a,
+0x00,0x17,0xc5,0x8a,0x0a,0x00,0x05,0xb7,0x4b,0x6e,0xb2,0x01,0x91,0x0c,0x0a,0x00,
+0x01,0xa3,0x1a,0x0a,0x00,0x3b,0xa5,0xa3,0x1a,0x20,0x00,0x06,0x51,0x99,0x95,0x3b,
+0xc9,0xba,0xda,0xa9,0x00,0x0a,0x0a,0x0a,0x01,0x90,0x00,0xa0,0xb9,0xd9,0xa9,0x02,
+0xce,0x8a,0x0b,0x00,0xf3,0x37,0x7a,0xea,0xa6,0x00,0x0a,0x01,0x1b,0x21,0x00,0x01,
+0xd8,0x89,0xea,0x97,0x03,0xe9,0x20,0x0a,0x00,0x00,0x10,0x06,0xaa,0xeb,0xaa,0x00,
+0x8b,0xb4,0x70,0xc0,0xa0,0x08,0x23,0xa5,0xd4,0xb0,0x08,0x21,0x55,0x55,0x50,0x7d,
+0xb8,0xaa,0xca,0xa2,0x08,0x20,0x03,0x80,0x00,0x08,0x24,0xcd,0xad,0xe0,0x09,0x86,
+0x59,0x09,0xa0,0x79,0x45,0x59,0x09,0xa0,0x00,0x04,0x59,0x0a,0x7d,0x01,0x10,0x72,
+0xfa,0x00,0xa0,0xea,0xbd,0xaa,0xa2,0x09,0x41,0x3a,0x11,0x10,0x06,0x04,0x01,0x56,
+0x01,0xbb,0xce,0xbb,0x90,0x13,0x01,0x01,0x05,0x00,0xf1,0x1f,0x2b,0xbb,0xce,0xbb,
+0xb7,0x07,0xbb,0xbb,0xbb,0x80,0xa1,0x0b,0x00,0x0b,0x0a,0x98,0xe8,0x88,0xb0,0xa3,
+0x1c,0x11,0x1b,0x0b,0x00,0xb0,0x00,0xb0,0xcb,0xbe,0xbb,0xbb,0x0a,0x00,0xb0,0x00,
+0xb3,0x80,0x0b,0x00,0x0b,0x91,0x00,0xb0,0x9b,0x80,0x5a,0x00,0xf1,0x02,0x0c,0x00,
+0x00,0x0b,0xbb,0xeb,0xbb,0xa0,0xc0,0x0c,0x00,0x0b,0x0c,0xaa,0xeb,0xaa,0xb0,0x09,
+0x00,0xa0,0xbb,0xfb,0xbb,0xb0,0x80,0x0c,0x00,0x00,0x60,0x00,0xdb,0x03,0xf2,0x03,
+0x06,0xcb,0xbc,0x30,0x09,0xaa,0xdb,0xad,0x30,0x09,0x98,0xca,0x8c,0x30,0x09,0x10,
+0x82,0x09,0x0f,0x00,0xf4,0x09,0x00,0x4a,0x02,0xb1,0x00,0x29,0x96,0x00,0x9c,0x70,
+0x43,0x0b,0x00,0xb0,0x50,0x00,0x86,0x00,0xb0,0x00,0x0a,0x80,0x00,0xb0,0x34,0x03,
+0xf0,0x0f,0x06,0x00,0x0c,0xbc,0x05,0xd8,0x91,0x97,0x92,0xe6,0x2c,0x09,0x79,0x83,
+0xb9,0x40,0xdc,0xd0,0x2b,0xd2,0x09,0x79,0x8a,0x21,0x96,0x97,0x90,0xba,0xae,0x0d,
+0x8e,0x00,0x60,0x60,0x00,0xba,0xae,0x00,0x00,0x97,0x00,0x00,0xca,0x03,0xb0,0x1b,
+0x00,0x00,0x8b,0xcd,0xbb,0xc1,0xb0,0x00,0x00,0xa1,0x04,0x00,0x4b,0xbb,0xbb,0xbb,
+0xe1,0x0c,0x00,0xf4,0x1f,0x91,0x02,0x10,0x03,0x00,0x00,0xa3,0x02,0x80,0x00,0xbd,
+0xa8,0x6c,0xac,0x1a,0x00,0xbb,0x00,0x91,0xa0,0x0b,0x53,0x0a,0x0e,0xaa,0xa0,0xb0,
+0xa0,0xa0,0x0a,0x04,0x7b,0x0a,0x00,0xa0,0x00,0xb0,0xea,0xa7,0x00,0x0b,0x0a,0x00,
+0x00,0x8b,0x70,0x84,0x03,0xf2,0x15,0x23,0x00,0x00,0x85,0x00,0xb1,0x00,0x5a,0xad,
+0xaa,0xda,0xa0,0x00,0x13,0x01,0x30,0x00,0x03,0xb3,0x01,0x9b,0x30,0x4b,0x21,0x11,
+0x13,0x90,0x06,0xac,0xad,0x9d,0x00,0x06,0x38,0x29,0x1a,0x05,0x00,0x51,0x7c,0xbd,
+0xbd,0xbe,0xa3,0x36,0x00,0xf2,0x13,0x0b,0x0b,0x04,0x70,0x00,0x0b,0x0b,0x0a,0xaa,
+0xa2,0x0b,0x0b,0x47,0x51,0x00,0x0b,0x0b,0x70,0x3d,0x30,0x00,0x07,0x00,0x03,0x40,
+0x09,0xad,0xad,0xbd,0x30,0x09,0x18,0x18,0x27,0x05,0x00,0xf1,0x1e,0x7d,0xbd,0xbd,
+0xbd,0xc3,0x00,0x20,0x00,0x20,0x00,0x00,0x67,0x01,0xc1,0x00,0x08,0x88,0xd9,0x88,
+0x50,0x05,0x99,0xda,0x99,0x10,0x01,0x11,0xa3,0x11,0x10,0x37,0x77,0x77,0x77,0x70,
+0x07,0xab,0xab,0xaa,0x30,0x0a,0x09,0x18,0x27,0x40,0x05,0x00,0x20,0x7e,0xad,0x32,
+0x00,0xf1,0x18,0x00,0x40,0x00,0x00,0x00,0x99,0xe9,0x98,0x00,0x01,0xa0,0x82,0x0b,
+0x00,0x7a,0xea,0xac,0xae,0xa3,0x06,0x61,0x80,0x0b,0x00,0x2c,0x00,0x25,0x8a,0x00,
+0x07,0x99,0x99,0xaa,0x10,0x09,0x19,0x19,0x18,0x20,0x05,0x00,0x00,0x64,0x00,0xf0,
+0x07,0xb3,0x9c,0xbb,0xbb,0xf9,0x10,0x00,0x0c,0x9a,0x99,0x99,0xe9,0x31,0x11,0x1c,
+0x91,0x00,0x00,0xc9,0xbb,0xbb,0xbe,0x07,0x00,0x73,0xcb,0xbb,0xbf,0x91,0x00,0x00,
+0xc0,0x46,0x03,0xf3,0x0c,0xcd,0xaa,0xa4,0x00,0x22,0x86,0x22,0x00,0x00,0xc8,0x88,
+0x8b,0x50,0x00,0xc9,0x99,0x9b,0x50,0x00,0xb3,0x33,0x37,0x50,0x00,0xc6,0x66,0x69,
+0x0f,0x00,0xf0,0x56,0xb0,0x00,0x06,0x60,0x29,0x99,0x99,0x99,0x97,0x00,0xa0,0x7c,
+0xbb,0xe4,0x7c,0x78,0x30,0x0b,0x27,0xb3,0x8b,0x99,0xe0,0x9d,0x17,0x40,0x0b,0x0a,
+0xca,0x73,0x00,0xb8,0x5a,0x48,0xca,0xae,0x60,0xa0,0x73,0x00,0xb0,0x0a,0x07,0xca,
+0xae,0x00,0xa0,0x73,0x00,0xa0,0x00,0x00,0x01,0x24,0x30,0x04,0x99,0xe8,0x75,0x20,
+0x04,0x99,0xe9,0x99,0x90,0x01,0x26,0x92,0x22,0x20,0x19,0x9e,0x99,0x99,0x95,0x00,
+0x9d,0x88,0x88,0x70,0x0a,0x8c,0x88,0x89,0x90,0x14,0x2b,0x66,0x67,0x90,0x00,0x2a,
+0x22,0x24,0x90,0x00,0x2d,0x99,0x9a,0x90,0x00,0x48,0x03,0xf1,0x0a,0x04,0x44,0x6b,
+0x44,0x41,0x04,0x55,0x9a,0x55,0x52,0x00,0xb7,0x77,0x7c,0x30,0x00,0xb6,0x66,0x6b,
+0x30,0x00,0xb7,0x77,0x7b,0x30,0x0f,0x00,0xf0,0x00,0x1a,0xca,0xaa,0xac,0xb6,0x00,
+0x5a,0x10,0x69,0x40,0x09,0x50,0x00,0x01,0x74,0x62,0x04,0xf0,0x1a,0x42,0x0d,0xb8,
+0xa9,0xc6,0x62,0x08,0x27,0x46,0x72,0xa0,0x0d,0xb8,0xab,0xaa,0xc8,0x08,0x28,0x92,
+0x00,0x48,0x0d,0xb7,0x7a,0xb9,0xd6,0x08,0x2b,0xa6,0x96,0x90,0x0d,0xb8,0x1e,0x4a,
+0xd6,0x06,0x01,0xa6,0x00,0x90,0x51,0x07,0x11,0x90,0x1f,0x08,0xf1,0x19,0xb1,0x00,
+0x47,0x77,0x0d,0xdc,0x89,0x53,0xc7,0x58,0x30,0x91,0x0b,0x32,0x94,0x19,0x10,0xb5,
+0x9d,0xa9,0xa1,0x0b,0x00,0xc5,0x09,0x10,0xb0,0x1a,0x95,0x91,0x0b,0x0a,0x30,0x99,
+0xbb,0xe7,0x70,0x00,0x91,0x0a,0xd4,0x01,0xf0,0x16,0x4c,0xda,0x6a,0xab,0x70,0x06,
+0x40,0x04,0x04,0x60,0x0a,0x00,0x28,0x06,0x40,0x1e,0xa8,0x46,0x08,0x20,0x8d,0x0a,
+0x3a,0xaa,0xc5,0x2a,0x0a,0x00,0x00,0x73,0x0a,0x0a,0xab,0xba,0x91,0x0b,0xa7,0x6c,
+0x06,0x43,0x00,0x00,0x4a,0x80,0xc4,0x02,0xf0,0x24,0x11,0x11,0x10,0x4c,0xda,0x89,
+0xe9,0x92,0x06,0x50,0x46,0xd6,0x60,0x0a,0x10,0xa3,0xc3,0xb0,0x0e,0xa9,0xa8,0xe8,
+0xd0,0x7e,0x0a,0xa0,0xb0,0x90,0x3a,0x0a,0x79,0xe9,0x90,0x0a,0x0a,0x57,0x90,0x00,
+0x0b,0xa9,0x2d,0xa3,0x10,0x01,0x01,0x71,0x16,0x82,0x00,0x00,0x05,0x69,0x00,0xf2,
+0x1b,0x0e,0xa9,0x00,0x06,0x40,0x84,0x19,0x00,0x0a,0x14,0xfa,0xdb,0xc0,0x1e,0xb8,
+0x91,0xa0,0xa0,0x7e,0x09,0x9a,0xd9,0xe0,0x3a,0x09,0xa3,0xb2,0xb0,0x0a,0x09,0xb7,
+0xd7,0xd0,0x0b,0xa8,0xb0,0xa0,0xa0,0x03,0x07,0x40,0x46,0x2e,0x03,0x10,0x03,0xb5,
+0x03,0x15,0x00,0x01,0x00,0xf0,0x3f,0x1b,0xbb,0xce,0xbb,0xb6,0x00,0x10,0x29,0x02,
+0x00,0x00,0xc1,0x29,0x0a,0x40,0x06,0x80,0x29,0x01,0xc0,0x2b,0x00,0x29,0x00,0x84,
+0x00,0x09,0xc7,0x00,0x00,0x09,0xbb,0x67,0x9d,0x93,0x01,0xdb,0x10,0x9f,0x40,0x08,
+0xa8,0x95,0x8b,0xb1,0x28,0x55,0x19,0x0a,0x37,0x00,0x77,0x66,0x78,0x30,0x0a,0xaa,
+0xaa,0xaa,0xa5,0x00,0x31,0x19,0x05,0x00,0x03,0xb0,0x19,0x07,0x80,0x09,0x05,0xa7,
+0x00,0x72,0x00,0x00,0x23,0x18,0x02,0xf0,0x16,0xbd,0xaa,0xa5,0x00,0x43,0x41,0x71,
+0x30,0x00,0xa0,0xac,0x43,0x70,0x00,0xc9,0x64,0x97,0x70,0x00,0x55,0x8a,0x55,0x20,
+0x0a,0xaa,0xea,0xaa,0xd1,0x0a,0x06,0x61,0xb0,0x91,0x0a,0x1c,0xa9,0x76,0x28,0x01,
+0xf0,0x1e,0x08,0xb0,0x26,0x97,0x00,0xb0,0x00,0x12,0xa0,0x33,0xb3,0x30,0x7b,0xea,
+0x83,0xb0,0xb0,0x05,0xd0,0xa0,0xb0,0x92,0x0a,0xd8,0x60,0xb0,0x40,0x38,0xa6,0x00,
+0xb4,0x80,0x92,0xa0,0x00,0x3b,0x10,0x00,0xa0,0x06,0xb2,0x00,0x00,0xa4,0xb6,0xb6,
+0x01,0xf1,0x51,0x10,0x00,0x00,0x2a,0xca,0x3a,0xbb,0xb1,0x00,0x82,0x0a,0x00,0x91,
+0x28,0xc9,0x6a,0x00,0x91,0x02,0xd7,0x2a,0x00,0x91,0x03,0xeb,0x2b,0xbb,0xb1,0x0b,
+0x93,0x51,0x00,0x10,0x46,0x82,0x08,0x32,0xa0,0x00,0x82,0x1b,0x00,0xa2,0x00,0x82,
+0x64,0x00,0x45,0x00,0x15,0x05,0x00,0x00,0x2a,0xd4,0x0b,0x33,0x30,0x00,0xa0,0x59,
+0xd7,0xd1,0x4b,0xeb,0xb0,0xa1,0x70,0x02,0xe0,0x35,0xa3,0x40,0x08,0xca,0x36,0xa2,
+0xa0,0x19,0xa3,0x82,0xa0,0xb0,0x71,0xa0,0xb0,0xa0,0x92,0x00,0xa0,0x10,0xa0,0x00,
+0x00,0xa0,0x07,0xda,0x02,0xf3,0x1f,0x70,0x00,0x2a,0xd3,0x09,0xd9,0x80,0x00,0xb0,
+0xb8,0x08,0x60,0x4a,0xe9,0x05,0xd8,0x00,0x06,0xe2,0x9a,0x76,0x00,0x09,0xd8,0x12,
+0xda,0xb5,0x28,0xb3,0x7a,0x20,0xc0,0x71,0xb0,0x31,0xbb,0x50,0x00,0xb0,0x04,0xb5,
+0x00,0x00,0xb2,0xb8,0x10,0x46,0x01,0x00,0xcc,0x05,0xf0,0x02,0x1a,0xd5,0xaa,0xaa,
+0xd0,0x00,0xa0,0xa0,0x00,0xb0,0x38,0xd7,0x9a,0xaa,0xd0,0x16,0xd3,0xb9,0x09,0xd0,
+0xf5,0x9a,0xea,0xa3,0x1a,0xb8,0x00,0xb0,0x00,0x74,0xa0,0x6a,0xea,0x67,0x00,0xf1,
+0x2a,0xb0,0x00,0x00,0xa2,0xaa,0xea,0xa5,0x00,0x02,0x04,0x00,0x00,0x0a,0xd6,0x2e,
+0x9a,0x50,0x00,0xb2,0xc3,0x2b,0x30,0x28,0xd8,0x67,0x77,0xc1,0x05,0xe2,0x59,0x99,
+0xd1,0x07,0xe7,0x00,0x00,0x81,0x0a,0xb6,0x89,0xa9,0x91,0x65,0xb0,0x35,0x93,0x40,
+0x10,0xb6,0x5b,0x04,0x87,0x00,0xb5,0x0b,0x9a,0x65,0x19,0x08,0xf1,0x07,0x00,0x2c,
+0x00,0x00,0xea,0xaa,0xaa,0xab,0xab,0x04,0x50,0x63,0x1a,0x7a,0x80,0x00,0x6a,0x23,
+0xba,0xaa,0xaa,0x70,0x94,0x03,0x00,0x60,0x05,0x00,0x09,0x00,0x51,0x0a,0xaa,0xae,
+0xaa,0xa7,0x92,0x00,0xf0,0x64,0x01,0x11,0x4a,0x11,0x10,0x0e,0x89,0x98,0x98,0xb6,
+0x09,0x1b,0x20,0xa6,0x44,0x05,0xa2,0x14,0x36,0x90,0x00,0x00,0x47,0x47,0x00,0x2a,
+0xaa,0xef,0xba,0xa6,0x00,0x01,0xc5,0x80,0x00,0x00,0x4c,0x20,0x88,0x20,0x0b,0x81,
+0x00,0x04,0xb7,0x00,0x02,0x30,0x00,0x09,0x99,0xad,0x99,0x94,0xb0,0x82,0x07,0x54,
+0x77,0xa3,0x81,0x05,0xa2,0x2b,0x8b,0x88,0x8a,0x02,0x92,0xc7,0x71,0xc0,0x29,0x87,
+0x29,0x0c,0x02,0x90,0x6d,0x90,0xc0,0x29,0x84,0x04,0x2c,0x02,0xd8,0x88,0x88,0xb0,
+0x00,0x00,0x13,0x00,0x00,0x06,0xaa,0xbd,0xaa,0xa1,0x00,0x18,0x00,0x37,0x00,0x19,
+0x9b,0x99,0xaa,0x96,0x00,0x8a,0xaa,0xaa,0x30,0xf3,0x03,0x00,0xfd,0x03,0xf2,0x02,
+0x9c,0x50,0x00,0x05,0x62,0x90,0x00,0x00,0x2c,0x12,0x90,0x09,0x1a,0xa2,0x00,0xca,
+0xb5,0xd9,0x07,0xf2,0x1d,0x80,0x90,0xe0,0x73,0x4a,0xca,0xa5,0xe5,0xa3,0x03,0x04,
+0x45,0x55,0x51,0x09,0x29,0xaa,0xca,0xa5,0x09,0x45,0x01,0xd0,0x00,0x09,0x62,0xcd,
+0xad,0xc5,0x05,0xa6,0x98,0x09,0x45,0x5c,0x84,0x98,0x09,0x45,0x00,0x00,0x97,0x08,
+0xa3,0x59,0x01,0xf3,0x22,0x40,0x02,0x30,0x00,0x06,0xc9,0x79,0xb9,0x94,0x2a,0x38,
+0x4a,0x0c,0x10,0x07,0x9a,0xaa,0x9b,0x60,0x00,0x11,0xa3,0x12,0xa0,0x06,0x97,0xc8,
+0x77,0x40,0x09,0xba,0xda,0xaa,0x90,0x00,0x0a,0xd1,0x00,0xc0,0x01,0xa4,0xa1,0x12,
+0xb0,0x1b,0x30,0xa1,0x58,0x20,0x37,0x00,0xf0,0x1a,0x01,0x40,0x00,0x06,0xd9,0x98,
+0xc9,0x96,0x2a,0x47,0x2b,0x1b,0x00,0x03,0xaa,0xbd,0x9a,0x70,0x01,0x11,0x49,0x11,
+0x11,0x28,0x88,0x88,0x9d,0x86,0x08,0x99,0x99,0xad,0x94,0x01,0x58,0x11,0x3a,0x10,
+0x00,0x09,0x60,0xd1,0x06,0xf1,0x26,0x27,0xb6,0x00,0x03,0x10,0x05,0x00,0x00,0x0c,
+0xa9,0x8f,0x99,0x91,0x57,0x92,0x84,0x47,0x00,0x40,0x18,0xba,0x13,0x00,0x03,0xa7,
+0x01,0xa8,0x20,0x78,0x49,0x99,0x73,0xa2,0x02,0x30,0x90,0x09,0x00,0x00,0xa0,0x83,
+0x37,0x00,0x00,0x61,0x23,0xb1,0x00,0x5a,0xaa,0xab,0xea,0xa0,0x20,0x06,0xf1,0x05,
+0x0d,0xa9,0x7e,0xa9,0x91,0x84,0x91,0x93,0x47,0x00,0x06,0xa7,0x77,0x7c,0x20,0x06,
+0x96,0x66,0x6c,0x20,0x0a,0x00,0xf4,0x02,0x03,0x8c,0x77,0xc8,0x10,0x69,0xad,0x99,
+0xe9,0x92,0x01,0xb2,0x00,0xb0,0x00,0x3c,0x40,0xac,0x06,0xf0,0x0e,0x02,0x10,0x01,
+0x20,0x00,0x0a,0xa8,0x79,0xc8,0x83,0x48,0x28,0x39,0x0a,0x00,0x0a,0x88,0xaa,0x88,
+0xa1,0x0b,0x79,0x99,0x98,0x91,0x00,0xc0,0x00,0x0b,0x4c,0x05,0x70,0x88,0x00,0x00,
+0xd9,0x99,0x99,0x40,0xa9,0x06,0xf6,0x51,0x60,0x00,0xd9,0x99,0x9b,0x60,0x00,0x73,
+0x38,0x0a,0x10,0x0a,0xbc,0xbd,0xbc,0xa4,0x00,0x05,0xce,0xa1,0x00,0x00,0x78,0x38,
+0x3b,0x40,0x09,0x30,0x37,0x00,0x72,0x1b,0xbb,0xcd,0xbb,0xb5,0x00,0x02,0xc7,0x80,
+0x00,0x04,0x9b,0x20,0x6b,0x72,0x17,0x30,0x00,0x00,0x44,0x03,0x83,0x60,0xb0,0x00,
+0x0a,0x86,0x70,0xb9,0x95,0x05,0x97,0x20,0xb2,0x11,0x29,0xea,0x70,0xb0,0x00,0x01,
+0xf8,0x1b,0xeb,0xb7,0x09,0xa8,0x97,0x00,0x0b,0x47,0x82,0x37,0x00,0x0b,0x00,0x82,
+0x2c,0x99,0xab,0x00,0x82,0x27,0x11,0x1a,0x06,0x04,0xf5,0x1e,0x13,0xa4,0x46,0xc7,
+0x62,0x08,0xb9,0x38,0xd9,0x81,0x06,0xc4,0x34,0xb4,0x42,0x3b,0xe8,0x45,0x55,0x53,
+0x06,0xf3,0x3b,0x99,0xd0,0x0a,0xba,0x4b,0x77,0xd0,0x47,0xa0,0x3b,0x88,0xd0,0x10,
+0xa0,0x36,0x00,0xb0,0x00,0xa0,0x36,0x07,0xb0,0x35,0x00,0xf3,0x1f,0x20,0x05,0xab,
+0xdb,0x97,0x30,0x00,0x07,0x60,0x35,0x00,0x00,0xbc,0x9a,0xb1,0x00,0x00,0x33,0xd8,
+0x0a,0x00,0x00,0x6c,0x42,0x3a,0x80,0x07,0xba,0x9d,0x65,0xa3,0x00,0x47,0x0a,0x2a,
+0x10,0x06,0xb0,0x0a,0x03,0xb1,0x05,0x04,0xb8,0x00,0x32,0x40,0x0a,0xf0,0x47,0x4e,
+0xaa,0xd0,0x0a,0x0a,0x04,0x7a,0x40,0x0a,0x0a,0x04,0xec,0x20,0x04,0x0a,0xc6,0x13,
+0xa5,0x00,0x8d,0x67,0xa0,0x00,0x00,0x8c,0xa3,0x0a,0x30,0x0a,0xca,0x9e,0x87,0xa2,
+0x00,0x85,0x0b,0x2a,0x20,0x0a,0x23,0xa9,0x01,0x91,0x0b,0x99,0xe9,0x9e,0x00,0xb8,
+0x8e,0x88,0xe0,0x0b,0x00,0xb0,0x0b,0x00,0x6a,0xe9,0xaa,0x90,0x04,0xca,0xa7,0x50,
+0x00,0x6b,0xd8,0x8b,0xb0,0x05,0x52,0xb2,0x23,0x10,0x6a,0x0a,0x29,0x70,0x47,0x07,
+0xc0,0x06,0x30,0x00,0x50,0x84,0x03,0xf0,0x10,0xb0,0x8a,0xaa,0xa3,0x08,0x23,0x11,
+0xa3,0x10,0x4b,0x6a,0x00,0x92,0x00,0x47,0xc0,0x00,0x92,0x00,0x0a,0x43,0x00,0x92,
+0x00,0x6c,0x97,0x00,0x92,0x00,0x00,0x14,0x0a,0x00,0x42,0xa6,0xbb,0xec,0xb6,0xbd,
+0x00,0x10,0x60,0x8c,0x01,0xf2,0x1d,0x90,0xbe,0xbe,0x30,0x08,0x13,0x0b,0x0b,0x00,
+0x29,0x49,0x0b,0x0b,0x00,0x69,0xd0,0x1f,0x3a,0xe1,0x07,0x54,0x3e,0x70,0xb0,0x5d,
+0x83,0x65,0xc8,0x60,0x00,0x49,0xb1,0x6e,0x00,0x5b,0x74,0xa5,0xb8,0xa0,0x00,0x05,
+0x38,0x00,0x44,0x37,0x00,0xf1,0x7e,0xb0,0x29,0x0b,0x00,0x04,0x60,0x28,0x0b,0x00,
+0x0a,0x19,0x37,0x0b,0x00,0x5c,0xd3,0x47,0x0d,0x00,0x03,0x70,0x68,0x0f,0x20,0x2e,
+0xa6,0x9c,0x4d,0x50,0x13,0x00,0xc3,0xc5,0x90,0x28,0xba,0x91,0xc0,0xa2,0x13,0x09,
+0x16,0x40,0x36,0x00,0x91,0x00,0xb6,0x40,0x01,0x90,0x00,0xb1,0x70,0x09,0x19,0x5a,
+0xe9,0x71,0x3d,0xc6,0x00,0xb1,0x43,0x01,0x90,0x6a,0xe8,0x62,0x1d,0xa9,0x00,0x82,
+0x93,0x04,0x00,0x00,0x5d,0x40,0x18,0xb9,0x17,0xbc,0x06,0x13,0x00,0x95,0x04,0xc6,
+0x01,0x20,0x04,0x10,0x00,0x07,0x33,0x5c,0x55,0x50,0x0a,0x13,0x5c,0x55,0x50,0x67,
+0xa4,0xbd,0x90,0x00,0x6a,0x70,0x91,0xa0,0x00,0x0a,0x11,0xea,0xea,0x90,0x8d,0xa2,
+0x20,0xa1,0x10,0x10,0x31,0xc1,0xa2,0x90,0x5b,0x78,0x70,0xa0,0xa1,0x20,0x04,0x0a,
+0xa0,0x11,0x00,0x31,0x91,0x00,0xf1,0x1e,0x0e,0xaa,0xc0,0x03,0x70,0x0a,0x00,0xb0,
+0x0b,0x09,0x2a,0x11,0xb0,0x4c,0xc4,0x0d,0x88,0xc0,0x02,0x70,0x1a,0x00,0xb0,0x2e,
+0xa8,0x1e,0xaa,0xc0,0x00,0x00,0x1a,0x00,0xb0,0x17,0xaa,0x2a,0x00,0xb0,0x25,0x10,
+0xbe,0xaa,0xe7,0x00,0x40,0x23,0x04,0xf0,0x19,0xab,0xeb,0xe0,0x07,0x50,0xa0,0xb0,
+0xa0,0x1b,0x3b,0xb0,0xb0,0xa0,0x7c,0xe4,0xa0,0xb0,0xa0,0x05,0x60,0xaa,0xea,0xe0,
+0x5f,0xa9,0xb0,0xb0,0xa0,0x10,0x00,0xb0,0xb0,0xa0,0x5a,0xa9,0xbb,0xeb,0xe0,0x10,
+0x00,0xb6,0x0b,0x02,0xf5,0x00,0xf0,0x1c,0x08,0x61,0x10,0x07,0x40,0x3e,0x8a,0xb0,
 0x1a,0x1b,0xc8,0x6a,0x10,0x7b,0xd2,0x01,0xe9,0x00,0x06,0x50,0x7b,0x38,0xa2,0x4e,
-0xa8,0x41,0xa3,0x23,0x12,0x00,0x00,0x07,0x00,0x38,0xaa,0x2a,0x93,0xfe,0x05,0x23,
-0x18,0x80,0x96,0x00,0xf0,0x0e,0x6a,0xab,0xd0,0x04,0x61,0x00,0x0c,0x30,0x0b,0x2c,
-0x11,0xcb,0x00,0x4c,0xd6,0x8b,0x35,0xc5,0x03,0xa0,0x51,0x11,0x24,0x2e,0xcb,0x49,
-0xcb,0x92,0x14,0x9b,0x3c,0xa2,0x05,0x8a,0x00,0x73,0x00,0x27,0x20,0xaa,0xdc,0xa8,
-0x1c,0x11,0xf5,0x1c,0x20,0x73,0x5c,0xc5,0x09,0x06,0xdb,0x86,0xa1,0x55,0xb0,0x73,
-0x56,0xa0,0x8c,0x65,0xdb,0x68,0x80,0x0a,0x00,0x72,0x56,0x91,0x8d,0xa7,0xca,0x86,
-0x37,0x20,0x21,0xb2,0x67,0x57,0x5b,0x82,0x90,0x5a,0x70,0x20,0x09,0x10,0x56,0xe9,
-0x16,0xf0,0x04,0xa1,0x00,0x07,0x30,0xab,0xec,0xb4,0x2a,0x3b,0x00,0xa1,0x00,0x69,
-0xe1,0x7b,0xdb,0xb2,0x09,0x41,0x87,0x14,0xf0,0x07,0xa8,0x6c,0xaa,0xe0,0x00,0x14,
-0x64,0x00,0xb0,0x6b,0x95,0x6b,0x88,0xd0,0x00,0x00,0x66,0x11,0xb0,0x00,0x60,0x06,
-0x6e,0x36,0xf0,0x0e,0x1e,0x99,0x10,0x09,0x12,0xa3,0x2b,0x00,0x49,0x6b,0xea,0xcc,
-0x80,0x69,0xc0,0xb0,0xa0,0xa0,0x09,0x21,0xa0,0xa0,0xa0,0x6e,0xb8,0xaa,0xaa,0x90,
-0x10,0x7e,0x08,0xe0,0x38,0xba,0xa0,0x00,0x45,0x43,0x00,0x7a,0xaa,0xb2,0x00,0x30,
-0x00,0x30,0x4f,0x05,0xf3,0x1b,0xb1,0x00,0x07,0x41,0x9b,0xda,0xa4,0x1a,0x2b,0x09,
-0x44,0x20,0x7d,0xf3,0x5a,0x25,0xb0,0x05,0x80,0xdc,0x98,0xa4,0x3e,0x97,0x0b,0x0b,
-0x00,0x35,0x10,0x1a,0x0b,0x00,0x16,0xa8,0x76,0x0b,0x17,0x45,0x07,0x90,0x0c,0xb4,
-0xa6,0x7e,0xf2,0x1c,0x13,0xc3,0x30,0x04,0x50,0x24,0xc5,0x40,0x1a,0x48,0x9a,0xba,
-0xc4,0x37,0xc0,0x09,0x83,0x80,0x08,0x63,0x76,0x83,0x00,0x3b,0x73,0xab,0xdb,0xa4,
-0x01,0x66,0x03,0xa6,0x00,0x4a,0x40,0x5b,0x13,0xa1,0x00,0x01,0x70,0x00,0x24,0xd2,
-0x3a,0xf4,0x1b,0x90,0x6a,0xaa,0xc0,0x09,0x11,0x27,0x77,0xb0,0x29,0x66,0x01,0x11,
+0xa8,0x41,0xa3,0x23,0x12,0x00,0x00,0x07,0x00,0x38,0xaa,0x2a,0x93,0x00,0x23,0x00,
+0x00,0x18,0x80,0xf0,0x24,0x00,0x31,0x00,0x00,0x00,0x00,0xb0,0x6a,0xab,0xd0,0x04,
+0x61,0x00,0x0c,0x30,0x0b,0x2c,0x11,0xcb,0x00,0x4c,0xd6,0x8b,0x35,0xc5,0x03,0xa0,
+0x51,0x11,0x24,0x2e,0xcb,0x49,0xcb,0x92,0x14,0x00,0x00,0x73,0x00,0x05,0x8a,0x00,
+0x73,0x00,0x27,0x20,0xaa,0xdc,0xa8,0x00,0x01,0x00,0xf2,0x1e,0x07,0x20,0x73,0x5c,
+0xc5,0x09,0x06,0xdb,0x86,0xa1,0x55,0xb0,0x73,0x56,0xa0,0x8c,0x65,0xdb,0x68,0x80,
+0x0a,0x00,0x72,0x56,0x91,0x8d,0xa7,0xca,0x86,0x37,0x20,0x21,0xb2,0x67,0x57,0x5b,
+0x82,0x90,0x5a,0x70,0x20,0x09,0x10,0x56,0x00,0x01,0x00,0xf2,0x81,0xa0,0x00,0xa1,
+0x00,0x07,0x30,0xab,0xec,0xb4,0x2a,0x3b,0x00,0xa1,0x00,0x69,0xe1,0x7b,0xdb,0xb2,
+0x09,0x41,0x00,0x00,0x00,0x6d,0xa8,0x6c,0xaa,0xe0,0x00,0x14,0x64,0x00,0xb0,0x6b,
+0x95,0x6b,0x88,0xd0,0x00,0x00,0x66,0x11,0xb0,0x00,0x60,0x06,0x00,0x00,0x03,0x80,
+0x1e,0x99,0x10,0x09,0x12,0xa3,0x2b,0x00,0x49,0x6b,0xea,0xcc,0x80,0x69,0xc0,0xb0,
+0xa0,0xa0,0x09,0x21,0xa0,0xa0,0xa0,0x6e,0xb8,0xaa,0xaa,0x90,0x10,0x00,0xa0,0x00,
+0x00,0x38,0xba,0xa0,0x00,0x45,0x43,0x00,0x7a,0xaa,0xb2,0x00,0x30,0x00,0x30,0x00,
+0x00,0xc0,0x00,0xb1,0x00,0x07,0x41,0x9b,0xda,0xa4,0x1a,0x2b,0x09,0x44,0x20,0x7d,
+0xf3,0x5a,0x25,0xb0,0x05,0x80,0xdc,0x98,0xa4,0x3e,0x97,0x0b,0x0b,0x00,0x35,0x10,
+0x1a,0x0b,0x00,0x16,0xa8,0x76,0x0b,0x17,0x45,0x07,0x90,0x0c,0xb4,0x96,0x00,0xf0,
+0x1d,0x90,0x13,0xc3,0x30,0x04,0x50,0x24,0xc5,0x40,0x1a,0x48,0x9a,0xba,0xc4,0x37,
+0xc0,0x09,0x83,0x80,0x08,0x63,0x76,0x83,0x00,0x3b,0x73,0xab,0xdb,0xa4,0x01,0x66,
+0x03,0xa6,0x00,0x4a,0x40,0x5b,0x13,0xa1,0x00,0x01,0x70,0x00,0x24,0x62,0x00,0xf3,
+0x1e,0x00,0x02,0x90,0x6a,0xaa,0xc0,0x09,0x11,0x27,0x77,0xb0,0x29,0x66,0x01,0x11,
 0xb0,0x69,0xc0,0x9a,0xdb,0xb5,0x08,0x30,0x61,0x91,0x62,0x5e,0xa4,0x18,0xaa,0x60,
-0x10,0x01,0x19,0xdb,0x20,0x39,0xb5,0xb2,0x92,0xa5,0x21,0x00,0x05,0x73,0x36,0xf1,
-0x22,0x40,0x00,0x23,0x51,0x00,0xb0,0xa8,0xb5,0x71,0x06,0x51,0x64,0x90,0xb0,0x1b,
-0x2b,0x9c,0xbb,0xc5,0x39,0xd3,0x4c,0x44,0x43,0x05,0x63,0x5d,0x55,0x53,0x2e,0xa7,
-0x2f,0x99,0xd0,0x00,0x15,0x88,0x97,0x60,0x3b,0x97,0xa2,0xce,0x50,0x00,0x07,0x38,
-0x20,0x68,0x56,0x0e,0xf2,0x1e,0x01,0xa0,0x11,0xb2,0x10,0x07,0x20,0xc8,0x88,0xd0,
-0x19,0x46,0xb6,0x66,0xd0,0x6a,0xc0,0xb2,0x22,0x30,0x07,0x30,0xdc,0xcc,0xc1,0x4e,
-0x93,0xd6,0x77,0x71,0x00,0x35,0xbc,0xcc,0xc1,0x4b,0x88,0x76,0x77,0x71,0x21,0x08,
-0x36,0x77,0xa0,0x44,0x20,0xf0,0x38,0xa0,0x99,0xcc,0x99,0x04,0x44,0x92,0x00,0x09,
-0x0a,0x37,0x39,0x9a,0x97,0x3a,0xd0,0x92,0x0b,0x00,0x04,0x53,0xf1,0xd9,0xa9,0x1e,
-0xb9,0xa1,0xa0,0x09,0x02,0x13,0x91,0xd9,0x99,0x2a,0x71,0x91,0xd8,0x89,0x00,0x00,
-0x91,0xa1,0x19,0x09,0x9a,0xb8,0xd8,0xc1,0x08,0x8a,0xb9,0xc8,0xb1,0x09,0x99,0xbc,
-0x99,0x93,0x00,0x34,0x97,0x44,0x10,0x00,0xb5,0x55,0x5a,0x40,0x00,0xc7,0x1d,0x2a,
-0x30,0xc6,0x66,0x6a,0x05,0x00,0x90,0x6b,0x40,0x18,0xd8,0x88,0x8c,0xa5,0x00,0x23,
-0x46,0x4a,0x91,0x3c,0x22,0x87,0x20,0x06,0x88,0x9c,0x88,0x81,0xbe,0x55,0xf0,0x0c,
-0x02,0x22,0x49,0x22,0x21,0x18,0x88,0xac,0x88,0x85,0x0a,0xaa,0xcc,0xaa,0xa5,0x00,
-0x01,0xc7,0x70,0x00,0x03,0x7c,0x30,0x7a,0x61,0x18,0x40,0xff,0x4a,0xf0,0x4f,0x24,
-0x40,0x00,0x00,0x2a,0xa7,0x58,0xd3,0x98,0x08,0x67,0x52,0x91,0x18,0x39,0xed,0x89,
-0x92,0x78,0x06,0xba,0x76,0xb0,0x88,0x57,0x52,0x40,0xb0,0x28,0x1c,0xba,0xb7,0xd2,
-0xb8,0x0b,0xa8,0xa3,0x92,0x18,0x0c,0xba,0xb0,0x90,0x08,0x08,0x00,0x85,0xa0,0xa5,
-0x2c,0x99,0x7a,0xa8,0xc2,0x03,0x99,0x71,0xb7,0xc2,0x18,0x99,0xbd,0xa7,0x81,0x05,
-0x84,0x98,0x47,0x70,0x05,0x84,0x88,0x47,0x70,0x03,0x7d,0x77,0xd8,0x40,0x07,0x7d,
-0x77,0xd7,0x71,0x28,0xae,0x88,0xeb,0x86,0x19,0x71,0x00,0x16,0xa2,0xbf,0x0d,0xf0,
-0x0d,0x70,0x03,0xaa,0xea,0xad,0x40,0x00,0x00,0xb0,0xb4,0x00,0x2a,0xaa,0xee,0xaa,
-0xa6,0x00,0x5c,0xd6,0x55,0x20,0x2c,0x9b,0x33,0x37,0x60,0x00,0x1d,0x88,0x05,0x10,
-0x19,0xf8,0x40,0xf0,0x19,0x1d,0xaa,0xab,0x60,0x01,0xb1,0x00,0x39,0x60,0x59,0xd8,
-0x59,0xc0,0x00,0x3a,0xe8,0x01,0xc6,0x81,0x00,0xa0,0x69,0xd4,0x20,0x7c,0xfa,0x20,
-0xb1,0x42,0x0a,0xe7,0x7c,0xea,0x73,0x48,0xba,0x10,0xb0,0x00,0x70,0x92,0x3d,0x30,
-0x00,0xa0,0x00,0xf1,0x18,0xf0,0x1c,0x5b,0xd9,0xd0,0x39,0xd8,0x67,0xb4,0xc0,0x1a,
-0xe9,0x56,0xa2,0xb0,0x00,0xb0,0x39,0xd9,0x90,0x4b,0xf9,0x79,0xd9,0x93,0x08,0xe7,
-0x80,0x93,0x55,0x1a,0xa7,0x94,0xc9,0x95,0x72,0xa0,0x85,0x42,0x95,0x00,0xa0,0x80,
-0x02,0xa3,0xb8,0x07,0xf0,0x1d,0x10,0x7d,0xae,0x2b,0x07,0x50,0x18,0x0a,0x39,0x6d,
-0x50,0x1d,0xaa,0x36,0xd6,0x60,0x18,0x0a,0x00,0xc0,0x00,0x1d,0xaa,0x9a,0xea,0xa3,
-0x18,0x0a,0x01,0xf2,0x00,0x4c,0x9e,0x47,0x8a,0x00,0x44,0x1a,0x2c,0x09,0x70,0x00,
-0x0b,0xb1,0x8b,0x4c,0x00,0xa2,0x5b,0xf2,0x04,0x9d,0x0b,0x57,0x50,0x00,0x0a,0x0b,
-0x50,0x00,0x28,0xbd,0x0b,0x43,0x94,0x13,0x9f,0x9c,0xff,0x70,0x8e,0x2c,0x05,0x2a,
-0x2c,0x00,0xee,0x40,0x00,0xfb,0x54,0x18,0xab,0x7f,0x39,0xf1,0x1d,0x94,0x05,0x60,
-0x40,0x1c,0x58,0xa5,0xb8,0x40,0x16,0x43,0x65,0x60,0x07,0x0b,0x99,0x92,0xca,0xb6,
-0x0b,0x22,0xb2,0x30,0x00,0x0c,0x55,0xb5,0x87,0xa1,0x0d,0x99,0xb5,0xa2,0x01,0x0a,
-0x00,0xb5,0x60,0x0a,0x0a,0x1a,0x82,0xba,0xb5,0x84,0x32,0xf7,0x1d,0x0d,0xab,0x05,
-0xb8,0x00,0x0a,0x0b,0x26,0x62,0x00,0x0d,0xab,0x14,0xb1,0x51,0x0a,0x0b,0x98,0xa7,
-0xb0,0x0b,0x0b,0x29,0xae,0x10,0x0d,0x9b,0x27,0xaa,0x10,0x28,0x0b,0x92,0xa3,0xa0,
-0x56,0x0d,0x80,0xa0,0x55,0x81,0xa8,0x08,0xc0,0x69,0x00,0xf3,0x1b,0x0d,0xb9,0x0a,
-0x0d,0xc6,0x09,0x09,0xae,0x6a,0x36,0x0d,0x99,0x0a,0x0a,0x36,0x09,0x0b,0xae,0x8a,
-0x36,0x0c,0x79,0x45,0x0a,0x36,0x0a,0x49,0x74,0x4a,0x36,0x26,0x09,0x96,0x8a,0xb3,
-0x43,0x0a,0xb5,0x7a,0x00,0x71,0xa6,0xc5,0x34,0x11,0x00,0x9b,0x49,0x20,0x07,0x50,
-0x0d,0x42,0x5f,0xbc,0x19,0x00,0x00,0x0c,0x08,0x00,0x04,0xa0,0x0b,0x0b,0xbd,0xdb,
-0xbb,0xb4,0x00,0x0c,0x10,0x72,0xe0,0x37,0x70,0x3d,0x30,0x06,0xca,0xaa,0x98,0xc1,
-0x8f,0x1b,0x52,0x10,0x03,0xaa,0xbd,0xaa,0xb5,0x0e,0x60,0x01,0x11,0x39,0x11,0x11,
-0x19,0x6e,0x45,0xf0,0x02,0x00,0x40,0x00,0x40,0x00,0x02,0xb2,0x00,0xa3,0x00,0x0c,
-0x7c,0x7a,0xbb,0xa7,0x0a,0x8a,0x91,0x06,0xb0,0x4a,0x0b,0x9a,0x90,0x6d,0x9d,0x0a,
-0x01,0x90,0x0a,0x7a,0x05,0x00,0xe2,0x6b,0x0a,0x01,0x90,0x47,0x0a,0x29,0x01,0x97,
-0x92,0x5b,0xa2,0x00,0xc8,0x8c,0x00,0xf4,0x20,0x30,0x00,0x40,0x00,0x01,0xb1,0x00,
-0x76,0x00,0x0c,0x7c,0x8a,0xaa,0xa9,0x0a,0x8a,0x81,0x00,0x09,0x0a,0x4a,0x0a,0x00,
-0x20,0x6d,0x9d,0x0b,0x29,0x81,0x0a,0x7a,0x0b,0x81,0x00,0x0a,0x7a,0x0b,0x00,0x01,
-0x46,0x0a,0x0b,0x00,0x0a,0x91,0x5b,0x06,0xca,0x40,0x20,0x03,0x20,0xbe,0x1e,0xe0,
-0xba,0xa1,0x00,0x00,0xa3,0x03,0xa0,0x00,0x1c,0xea,0xae,0xba,0x80,0x14,0xd3,0x36,
-0x11,0x00,0x05,0x00,0x10,0xeb,0x63,0x36,0x10,0xa0,0xc5,0x0b,0x00,0xbe,0x3d,0x00,
-0x35,0x43,0x00,0x15,0x33,0x10,0x84,0x0b,0x33,0x21,0xdc,0xb7,0x0a,0x00,0xa4,0x0b,
-0xbc,0xcb,0xbb,0x90,0x00,0x04,0x70,0x01,0xa0,0x05,0x00,0x10,0x24,0x05,0x00,0x30,
-0x89,0x30,0x00,0xb1,0x16,0x92,0x0a,0xae,0xaa,0xcc,0xa4,0x00,0x0b,0x14,0x65,0x56,
-0x13,0x02,0xe3,0x1c,0xf0,0x1f,0x80,0x38,0x01,0xa0,0x2b,0xdb,0xce,0xbb,0xd7,0x00,
-0x01,0xc8,0x70,0x00,0x01,0x6b,0x30,0x7a,0x40,0x1a,0x50,0x00,0x01,0x77,0x1a,0xae,
-0xaa,0xdc,0xa6,0x00,0x0b,0x00,0x65,0x00,0x04,0x80,0x69,0x99,0x80,0x00,0x34,0xa2,
-0x11,0xb0,0x0b,0x50,0x6c,0x4c,0xc0,0x61,0xa1,0x4a,0xa0,0x00,0x49,0xa1,0x00,0x01,
-0x02,0xc0,0xa1,0x47,0x46,0x13,0x6c,0x2c,0x30,0x70,0x1a,0xae,0xaa,0xcc,0xa6,0x00,
-0x0a,0xc5,0x58,0xf1,0x0c,0x77,0x99,0x99,0x96,0x02,0xc0,0x11,0x11,0xb1,0x2d,0xb2,
-0xca,0xd0,0xb0,0x12,0xb2,0x80,0xa0,0xb0,0x00,0xb2,0xd9,0xd0,0xb0,0x00,0xb1,0x40,
-0x0f,0x1c,0xf0,0x06,0x6a,0x70,0x1a,0xae,0xaa,0xdb,0xa6,0x00,0x09,0x00,0x77,0x30,
-0x07,0xaa,0xaa,0x86,0x40,0x02,0x50,0x73,0x02,0x2b,0x08,0x22,0x09,0x20,0xe0,0x20,
-0xe2,0x07,0xbc,0xa1,0x00,0x04,0xb6,0x29,0x2b,0x81,0x29,0x10,0x29,0x00,0x56,0x5a,
-0x00,0xf0,0x13,0x68,0x00,0x43,0x00,0x04,0xca,0x99,0x99,0xc2,0x2b,0x7c,0x88,0x82,
-0x82,0x01,0x90,0xa0,0x00,0x91,0x05,0x99,0xd9,0x96,0xa1,0x00,0x80,0xa0,0x61,0xb0,
-0x00,0xc9,0xd9,0xc2,0xb0,0xd8,0x02,0x11,0x90,0xb9,0x00,0xf0,0x12,0x01,0x09,0x05,
-0x63,0x00,0x04,0xb2,0x4d,0x99,0xa0,0x01,0x15,0xbb,0x2a,0x50,0x1b,0x63,0x06,0xfb,
-0x10,0x00,0x25,0xc7,0x14,0xb8,0x00,0x93,0xb9,0x99,0xc0,0x06,0x70,0xb0,0x6c,0x03,
-0x32,0xb8,0x88,0xc0,0x5a,0x00,0xf0,0x0e,0x69,0x00,0x53,0x00,0x02,0xda,0xab,0xaa,
-0xb4,0x1c,0x86,0xc8,0xb4,0x64,0x23,0x77,0xc7,0x74,0x74,0x00,0xb5,0xb5,0x77,0x73,
-0x00,0xc6,0xc7,0x87,0x82,0x0a,0x00,0xf1,0x1a,0x91,0x00,0x40,0x30,0x4a,0xa0,0x1a,
-0xae,0xaa,0xda,0xa6,0x00,0x08,0x01,0x71,0x00,0x06,0x2a,0x06,0xca,0xa0,0x07,0x3a,
-0x1b,0x35,0x00,0x06,0x2a,0x23,0x0a,0x10,0x01,0x9a,0x99,0x9a,0x40,0x03,0x72,0x63,
-0x63,0x70,0x05,0x00,0xf7,0x24,0x2b,0xdb,0xcb,0xcb,0xd7,0x19,0x9e,0x99,0xea,0x95,
-0x00,0x07,0x00,0x94,0x90,0x08,0x8a,0xaa,0xbd,0xa7,0x0b,0xb6,0x89,0x58,0x52,0x01,
-0x98,0x8b,0x49,0xc0,0x5c,0xd7,0x45,0x6c,0xa0,0x09,0x97,0x69,0x1d,0x20,0x57,0x94,
-0x89,0xad,0x38,0x21,0x70,0x01,0xa0,0xb7,0x00,0xe8,0x27,0xf1,0x1e,0x00,0x3e,0x66,
-0x00,0x09,0xd9,0x5c,0x83,0xb0,0x00,0x87,0x84,0x09,0xe1,0x00,0x08,0x78,0x49,0x86,
-0xa6,0x00,0xdc,0xd4,0x89,0xc8,0x50,0x03,0x92,0x07,0x8c,0x71,0x00,0x09,0x90,0x24,
-0xa2,0x00,0x29,0xdc,0x99,0xad,0x98,0x01,0x20,0x21,0xf4,0x5c,0xf0,0x1e,0x89,0xd8,
-0xd0,0x07,0xd7,0x88,0xd8,0xd0,0x0a,0x9a,0x82,0xb1,0xa0,0x08,0x79,0x4c,0xaa,0x80,
-0x0d,0xcd,0x3b,0xc9,0x20,0x04,0xa1,0x1a,0x62,0xc0,0x00,0xa9,0x8a,0xc8,0x85,0x18,
-0xdc,0x76,0x84,0x90,0x12,0x00,0x84,0xc1,0x52,0x00,0x42,0xf5,0x14,0x60,0xb0,0x6b,
-0xbb,0xb3,0x4b,0x12,0xe3,0x05,0x10,0x77,0x0f,0x00,0xb2,0xd0,0xbb,0xbe,0xb6,0x4c,
-0xb0,0x00,0x0a,0x00,0x21,0xb0,0x91,0x44,0x05,0x05,0x00,0x20,0x04,0xbb,0xd2,0x40,
-0x51,0xc0,0x00,0x3a,0xcb,0x30,0x39,0x1c,0xf3,0x06,0xd2,0x00,0x00,0x85,0x60,0xdc,
-0x40,0x06,0xfb,0x70,0xc0,0xb5,0x5a,0xc4,0x90,0xc0,0x01,0x10,0xb0,0x30,0xc0,0x12,
-0x56,0x00,0x05,0x00,0xf0,0x19,0x1a,0xaa,0xda,0xaa,0x70,0x01,0x22,0xa4,0x22,0x00,
-0x04,0x77,0xc8,0x77,0x20,0x5a,0xaa,0xda,0xaa,0xa0,0x00,0x2b,0x4a,0x02,0x50,0x29,
-0xe3,0x06,0x8a,0x10,0x53,0x92,0x01,0xb5,0x00,0x00,0xca,0xb5,0x09,0xb2,0x0c,0x40,
-0x11,0x10,0x3e,0x21,0xf1,0x05,0x25,0x55,0xb9,0x55,0x50,0x24,0x44,0x44,0x44,0x40,
-0x00,0xd9,0x99,0x9c,0x00,0x49,0xd7,0x77,0x7d,0x91,0x0a,0x00,0xf0,0x34,0x00,0x2a,
-0x59,0x24,0x60,0x39,0xc7,0x01,0xc8,0x00,0x21,0x5a,0x99,0x3a,0x71,0x00,0x45,0x10,
-0x00,0x41,0x02,0x80,0x00,0xa0,0x00,0x5a,0xc6,0xa9,0xda,0xb4,0x00,0x54,0xb0,0xa0,
-0x90,0x00,0xb7,0xba,0xea,0x90,0x0b,0xf7,0xaa,0x01,0xa0,0x64,0xb8,0xa5,0x79,0x50,
-0x00,0xb0,0xa0,0xbb,0x00,0x00,0xb4,0x54,0xbc,0x60,0x00,0xb7,0x58,0x00,0x85,0x05,
-0x28,0x0e,0x4f,0xf1,0x36,0x59,0xaa,0xea,0xa5,0x03,0xa8,0x00,0xb0,0x00,0x27,0x38,
-0x8a,0xda,0xa3,0x00,0x15,0x44,0x00,0x00,0x29,0x9b,0xee,0x99,0xa6,0x03,0x8a,0x04,
-0x79,0x70,0x17,0x67,0x45,0x6b,0x40,0x00,0x79,0x51,0x00,0x66,0x6b,0xbe,0xbd,0xcb,
-0xb1,0x00,0x0a,0x08,0x20,0x00,0x0a,0xae,0xbd,0xba,0x70,0x0a,0x0a,0x08,0x20,0xa0,
-0x0a,0x29,0x08,0x31,0xa0,0x0c,0xa1,0x03,0xab,0xa0,0x0f,0x42,0x33,0x0e,0xaa,0xaa,
-0x0a,0x00,0xf0,0x11,0x0a,0xac,0xca,0xea,0xa5,0x05,0x9c,0xca,0xe9,0x90,0x08,0x25,
-0x50,0xa0,0xa1,0x08,0x9b,0xb9,0xd8,0xd1,0x00,0x13,0xa1,0x11,0x10,0x2a,0xaf,0xaa,
-0xbd,0xa6,0x00,0x8b,0x2d,0x28,0xf3,0x27,0x18,0xed,0xc6,0x10,0x0a,0x96,0x20,0x04,
-0xa1,0x08,0x8b,0xb8,0xd8,0x84,0x09,0x8a,0xa7,0xd7,0xc1,0x06,0x98,0xa8,0x97,0x90,
-0x03,0xa0,0xb8,0x88,0x82,0x1a,0x9c,0xd7,0x77,0xa0,0x07,0xa0,0xa9,0x99,0xc0,0x26,
-0x90,0x6e,0x99,0x60,0x00,0x95,0x59,0x6a,0x10,0x00,0x95,0x98,0x68,0x96,0xa7,0x2b,
-0x60,0x6b,0xaa,0xb0,0x5b,0xea,0x64,0xb1,0x58,0xf5,0x12,0x64,0xa0,0xb0,0x7a,0xd9,
-0x74,0xb0,0xb0,0x04,0x91,0x74,0xa0,0xb0,0x06,0xd2,0x11,0xc2,0x30,0x09,0x2b,0x03,
-0xa4,0x21,0x1a,0x03,0x1a,0x54,0x54,0x82,0x03,0xb1,0x3b,0xb1,0xfa,0x04,0xd0,0x00,
-0x01,0xc0,0x9b,0xaa,0xe0,0x5a,0xc8,0x91,0x00,0xb0,0x00,0x39,0x46,0x14,0xf7,0x0e,
-0xd2,0x91,0xb0,0xb0,0x1c,0xf5,0x91,0xb0,0xb0,0x77,0xb7,0x20,0xd1,0x30,0x00,0xb0,
-0x05,0xa4,0x03,0x00,0xb0,0x28,0x64,0x18,0x00,0xb3,0x80,0x3b,0xa4,0x71,0x2f,0xf0,
-0x0c,0x0b,0x06,0xb8,0x82,0x0b,0x0b,0x09,0x63,0x10,0x0b,0x0b,0x46,0x1b,0x00,0x02,
-0x9f,0x99,0x9d,0x10,0x00,0xb0,0x32,0x0c,0x00,0x00,0xb0,0x75,0x65,0x13,0xc3,0xa9,
-0x06,0x00,0x00,0x09,0xab,0x00,0x73,0x1a,0xb5,0x08,0xaa,0xdf,0x30,0x20,0x07,0x10,
-0xf7,0x42,0xe0,0xae,0x30,0x02,0xd1,0x02,0xb0,0x01,0xde,0xaa,0xea,0xac,0x02,0xb0,
-0x0b,0x56,0x0a,0x30,0xea,0xac,0x01,0x09,0x00,0x70,0x3d,0xaa,0xea,0xac,0x08,0x40,
-0x0b,0x96,0x42,0x22,0xb4,0xb9,0xa0,0x00,0x10,0x30,0x36,0x00,0xf7,0x1c,0xc9,0x19,
-0xda,0xc4,0x0b,0x0b,0x00,0xb0,0x73,0x6d,0xb9,0xab,0x77,0xc0,0x0a,0x52,0xa7,0x24,
-0x00,0x0b,0xa8,0xa8,0xce,0xa3,0x0b,0x75,0xa9,0x0a,0x00,0x0c,0x98,0xa9,0xae,0xa5,
-0x47,0x52,0x90,0x0a,0x00,0x72,0x17,0x80,0x0a,0x10,0x03,0x30,0x04,0xc9,0x10,0x78,
-0x81,0xf3,0x17,0x06,0x8d,0x72,0x6e,0xbb,0x8b,0x3b,0x75,0x1a,0x62,0x9a,0x09,0x45,
+0x10,0x01,0x19,0xdb,0x20,0x39,0xb5,0xb2,0x92,0xa5,0x21,0x00,0x05,0xc0,0xfa,0x00,
+0xf0,0xa8,0x40,0x00,0x23,0x51,0x00,0xb0,0xa8,0xb5,0x71,0x06,0x51,0x64,0x90,0xb0,
+0x1b,0x2b,0x9c,0xbb,0xc5,0x39,0xd3,0x4c,0x44,0x43,0x05,0x63,0x5d,0x55,0x53,0x2e,
+0xa7,0x2f,0x99,0xd0,0x00,0x15,0x88,0x97,0x60,0x3b,0x97,0xa2,0xce,0x50,0x00,0x07,
+0x38,0x20,0x68,0x00,0x00,0x00,0x10,0x00,0x01,0xa0,0x11,0xb2,0x10,0x07,0x20,0xc8,
+0x88,0xd0,0x19,0x46,0xb6,0x66,0xd0,0x6a,0xc0,0xb2,0x22,0x30,0x07,0x30,0xdc,0xcc,
+0xc1,0x4e,0x93,0xd6,0x77,0x71,0x00,0x35,0xbc,0xcc,0xc1,0x4b,0x88,0x76,0x77,0x71,
+0x21,0x08,0x36,0x77,0xa0,0x00,0x40,0x00,0x50,0x00,0x00,0xa0,0x99,0xcc,0x99,0x04,
+0x44,0x92,0x00,0x09,0x0a,0x37,0x39,0x9a,0x97,0x3a,0xd0,0x92,0x0b,0x00,0x04,0x53,
+0xf1,0xd9,0xa9,0x1e,0xb9,0xa1,0xa0,0x09,0x02,0x13,0x91,0xd9,0x99,0x2a,0x71,0x91,
+0xd8,0x89,0x00,0x00,0x91,0xa1,0x19,0x09,0x9a,0xb8,0xd8,0xc1,0x08,0x8a,0xb9,0xc8,
+0xb1,0x09,0x99,0xbc,0x99,0x93,0x00,0x34,0x97,0x44,0x10,0x00,0xb5,0x55,0x5a,0x40,
+0x00,0xc7,0x77,0x7b,0x40,0x00,0xc6,0x66,0x6a,0x05,0x00,0xf1,0xff,0x43,0x6b,0x40,
+0x18,0xd8,0x88,0x8c,0xa5,0x00,0x23,0x00,0x05,0x00,0x01,0x3c,0x22,0x87,0x20,0x06,
+0x88,0x9c,0x88,0x81,0x02,0xaa,0xbd,0xaa,0x80,0x02,0x22,0x49,0x22,0x21,0x18,0x88,
+0xac,0x88,0x85,0x0a,0xaa,0xcc,0xaa,0xa5,0x00,0x01,0xc7,0x70,0x00,0x03,0x7c,0x30,
+0x7a,0x61,0x18,0x40,0x00,0x00,0x55,0x00,0x24,0x40,0x00,0x00,0x2a,0xa7,0x58,0xd3,
+0x98,0x08,0x67,0x52,0x91,0x18,0x39,0xed,0x89,0x92,0x78,0x06,0xba,0x76,0xb0,0x88,
+0x57,0x52,0x40,0xb0,0x28,0x1c,0xba,0xb7,0xd2,0xb8,0x0b,0xa8,0xa3,0x92,0x18,0x0c,
+0xba,0xb0,0x90,0x08,0x08,0x00,0x85,0xa0,0xa5,0x2c,0x99,0x7a,0xa8,0xc2,0x03,0x99,
+0x71,0xb7,0xc2,0x18,0x99,0xbd,0xa7,0x81,0x05,0x84,0x98,0x47,0x70,0x05,0x84,0x88,
+0x47,0x70,0x03,0x7d,0x77,0xd8,0x40,0x07,0x7d,0x77,0xd7,0x71,0x28,0xae,0x88,0xeb,
+0x86,0x19,0x71,0x00,0x16,0xa2,0x00,0x00,0xb0,0x00,0x70,0x03,0xaa,0xea,0xad,0x40,
+0x00,0x00,0xb0,0xb4,0x00,0x2a,0xaa,0xee,0xaa,0xa6,0x00,0x5c,0xd6,0x55,0x20,0x2c,
+0x9b,0x33,0x37,0x60,0x00,0x1d,0x99,0x9b,0x60,0x00,0x19,0x00,0x05,0x60,0x00,0x1d,
+0xaa,0xab,0x60,0x01,0xb1,0x00,0x39,0x60,0x59,0xd8,0x59,0xc0,0x00,0x3a,0xe8,0x01,
+0xc6,0x81,0x00,0xa0,0x69,0xd4,0x20,0x7c,0xfa,0x20,0xb1,0x42,0x0a,0xe7,0x7c,0xea,
+0x73,0x48,0xba,0x10,0xb0,0x00,0x70,0xa0,0x00,0xb0,0x09,0x00,0xa0,0x00,0xaa,0xa4,
+0x01,0xb1,0x5b,0xd9,0xd0,0x39,0xd8,0x67,0xb4,0xc0,0x1a,0xe9,0x56,0xa2,0xb0,0x00,
+0xb0,0x39,0xd9,0x90,0x4b,0xf9,0x79,0xd9,0x93,0x08,0xe7,0x80,0x93,0x55,0x1a,0xa7,
+0x94,0xc9,0x95,0x72,0xa0,0x85,0x42,0x95,0x00,0xa0,0x80,0x02,0xa3,0x00,0x00,0x01,
+0x00,0x10,0x7d,0xae,0x2b,0x07,0x50,0x18,0x0a,0x39,0x6d,0x50,0x1d,0xaa,0x36,0xd6,
+0x60,0x18,0x0a,0x00,0xc0,0x00,0x1d,0xaa,0x9a,0xea,0xa3,0x18,0x0a,0x01,0xf2,0x00,
+0x4c,0x9e,0x47,0x8a,0x00,0x44,0x1a,0x2c,0x09,0x70,0x00,0x0b,0xb1,0x00,0x93,0x11,
+0x02,0xf0,0x13,0x19,0x9d,0x0b,0x57,0x50,0x00,0x0a,0x0b,0x50,0x00,0x28,0xbd,0x0b,
+0x43,0x94,0x13,0x9f,0x9c,0xff,0x70,0x00,0xc1,0x11,0x1c,0x00,0x00,0xd7,0x77,0x7d,
+0x00,0x00,0xe8,0x88,0x8e,0xe0,0x00,0x76,0x0b,0x00,0x00,0xb0,0x03,0xab,0x00,0x01,
+0x00,0xf7,0x4f,0x03,0x94,0x05,0x60,0x40,0x1c,0x58,0xa5,0xb8,0x40,0x16,0x43,0x65,
+0x60,0x07,0x0b,0x99,0x92,0xca,0xb6,0x0b,0x22,0xb2,0x30,0x00,0x0c,0x55,0xb5,0x87,
+0xa1,0x0d,0x99,0xb5,0xa2,0x01,0x0a,0x00,0xb5,0x60,0x0a,0x0a,0x1a,0x82,0xba,0xb5,
+0x00,0x00,0x02,0x00,0x00,0x0d,0xab,0x05,0xb8,0x00,0x0a,0x0b,0x26,0x62,0x00,0x0d,
+0xab,0x14,0xb1,0x51,0x0a,0x0b,0x98,0xa7,0xb0,0x0b,0x0b,0x29,0xae,0x10,0x0d,0x9b,
+0x27,0xaa,0x10,0x28,0x0b,0x92,0xa3,0xa0,0x56,0x0d,0x80,0xa0,0x55,0x81,0xa8,0x08,
+0xc0,0x69,0x00,0xf3,0x1d,0x0d,0xb9,0x0a,0x0d,0xc6,0x09,0x09,0xae,0x6a,0x36,0x0d,
+0x99,0x0a,0x0a,0x36,0x09,0x0b,0xae,0x8a,0x36,0x0c,0x79,0x45,0x0a,0x36,0x0a,0x49,
+0x74,0x4a,0x36,0x26,0x09,0x96,0x8a,0xb3,0x43,0x0a,0xb5,0x7a,0x00,0x71,0xa6,0x00,
+0x0a,0x33,0x00,0xff,0x00,0x01,0x20,0x00,0x00,0x07,0x50,0x00,0x1e,0xbb,0xbb,0xbc,
+0x19,0x00,0x00,0x0c,0x08,0x00,0x04,0xf0,0x3f,0x0b,0x0b,0xbd,0xdb,0xbb,0xb4,0x00,
+0x0c,0x10,0x72,0x00,0x00,0xb3,0x00,0x3d,0x30,0x06,0xca,0xaa,0x98,0xc1,0x00,0x00,
+0x28,0x00,0x10,0x03,0xaa,0xbd,0xaa,0x90,0x00,0x00,0x29,0x00,0x00,0x01,0x11,0x39,
+0x11,0x11,0x19,0x99,0x99,0x99,0x96,0x00,0x40,0x00,0x40,0x00,0x02,0xb2,0x00,0xa3,
+0x00,0x0c,0x7c,0x7a,0xbb,0xa7,0x0a,0x8a,0x00,0x00,0x00,0x0a,0x4a,0x0b,0x9a,0x90,
+0x6d,0x9d,0x0a,0x01,0x90,0x0a,0x7a,0x05,0x00,0xe2,0x6b,0x0a,0x01,0x90,0x47,0x0a,
+0x29,0x01,0x97,0x92,0x5b,0xa2,0x00,0xc8,0x8c,0x00,0xf3,0x22,0x30,0x00,0x40,0x00,
+0x01,0xb1,0x00,0x76,0x00,0x0c,0x7c,0x8a,0xaa,0xa9,0x0a,0x8a,0x81,0x00,0x09,0x0a,
+0x4a,0x0a,0x00,0x20,0x6d,0x9d,0x0b,0x29,0x81,0x0a,0x7a,0x0b,0x81,0x00,0x0a,0x7a,
+0x0b,0x00,0x01,0x46,0x0a,0x0b,0x00,0x0a,0x91,0x5b,0x06,0xaa,0xa6,0x5f,0x01,0xf1,
+0x09,0x20,0x00,0x00,0x00,0x1e,0xba,0xa1,0x00,0x00,0xa3,0x03,0xa0,0x00,0x1c,0xea,
+0xae,0xba,0x80,0x14,0xa0,0x0b,0x00,0xb0,0x00,0x05,0x00,0x40,0xeb,0xbb,0xbb,0xb0,
+0x73,0x04,0xf1,0x06,0x05,0x00,0xb0,0x00,0x00,0x1a,0x00,0xaa,0xaa,0xaa,0xb4,0x00,
+0x0b,0x00,0x84,0x00,0x2b,0xbe,0xbb,0xdc,0xb7,0x0a,0x00,0xa4,0x0b,0xbc,0xcb,0xbb,
+0x90,0x00,0x04,0x70,0x01,0xa0,0x05,0x00,0x10,0x24,0x05,0x00,0xf1,0x52,0x89,0x30,
+0x00,0x04,0x70,0x00,0x00,0x0a,0xae,0xaa,0xcc,0xa4,0x00,0x0b,0x14,0x65,0x00,0x00,
+0x00,0x38,0x00,0x00,0x02,0xda,0xbd,0xab,0xa0,0x02,0x80,0x38,0x01,0xa0,0x2b,0xdb,
+0xce,0xbb,0xd7,0x00,0x01,0xc8,0x70,0x00,0x01,0x6b,0x30,0x7a,0x40,0x1a,0x50,0x00,
+0x01,0x77,0x1a,0xae,0xaa,0xdc,0xa6,0x00,0x0b,0x00,0x65,0x00,0x04,0x80,0x69,0x99,
+0x80,0x00,0x34,0xa2,0x11,0xb0,0x0b,0x50,0xa1,0x00,0xb0,0x00,0x61,0xa1,0x4a,0xa0,
+0x00,0x49,0xa1,0x00,0x01,0x02,0xc0,0xa1,0x00,0x0b,0x0b,0x20,0x6c,0xbb,0xc6,0xbd,
+0x00,0x40,0x1a,0xae,0xaa,0xcc,0x8e,0x01,0xf2,0x43,0x64,0x00,0x00,0x77,0x99,0x99,
+0x96,0x02,0xc0,0x11,0x11,0xb1,0x2d,0xb2,0xca,0xd0,0xb0,0x12,0xb2,0x80,0xa0,0xb0,
+0x00,0xb2,0xd9,0xd0,0xb0,0x00,0xb1,0x40,0x00,0xb0,0x00,0xb0,0x00,0x6a,0x70,0x1a,
+0xae,0xaa,0xdb,0xa6,0x00,0x09,0x00,0x77,0x30,0x07,0xaa,0xaa,0x86,0x40,0x02,0x50,
+0x73,0x02,0xb0,0x00,0xa0,0x36,0x09,0x20,0x1a,0xaa,0xbd,0xaa,0xa6,0x00,0x07,0xbc,
+0xa1,0x00,0x04,0xb6,0x29,0x2b,0x81,0x29,0x10,0x29,0x00,0x56,0x5a,0x00,0xf0,0x13,
+0x68,0x00,0x43,0x00,0x04,0xca,0x99,0x99,0xc2,0x2b,0x7c,0x88,0x82,0x82,0x01,0x90,
+0xa0,0x00,0x91,0x05,0x99,0xd9,0x96,0xa1,0x00,0x80,0xa0,0x61,0xb0,0x00,0xc9,0xd9,
+0xc2,0xb0,0xd8,0x02,0x11,0x90,0xb9,0x00,0xf0,0x12,0x01,0x09,0x05,0x63,0x00,0x04,
+0xb2,0x4d,0x99,0xa0,0x01,0x15,0xbb,0x2a,0x50,0x1b,0x63,0x06,0xfb,0x10,0x00,0x25,
+0xc7,0x14,0xb8,0x00,0x93,0xb9,0x99,0xc0,0x06,0x70,0xb0,0x6c,0x03,0x32,0xb8,0x88,
+0xc0,0x5a,0x00,0xf0,0x0e,0x69,0x00,0x53,0x00,0x02,0xda,0xab,0xaa,0xb4,0x1c,0x86,
+0xc8,0xb4,0x64,0x23,0x77,0xc7,0x74,0x74,0x00,0xb5,0xb5,0x77,0x73,0x00,0xc6,0xc7,
+0x87,0x82,0x0a,0x00,0xf1,0x1a,0x91,0x00,0x40,0x30,0x4a,0xa0,0x1a,0xae,0xaa,0xda,
+0xa6,0x00,0x08,0x01,0x71,0x00,0x06,0x2a,0x06,0xca,0xa0,0x07,0x3a,0x1b,0x35,0x00,
+0x06,0x2a,0x23,0x0a,0x10,0x01,0x9a,0x99,0x9a,0x40,0x03,0x72,0x63,0x63,0x70,0x05,
+0x00,0xf7,0x23,0x2b,0xdb,0xcb,0xcb,0xd7,0x19,0x9e,0x99,0xea,0x95,0x00,0x07,0x00,
+0x94,0x90,0x08,0x8a,0xaa,0xbd,0xa7,0x0b,0xb6,0x89,0x58,0x52,0x01,0x98,0x8b,0x49,
+0xc0,0x5c,0xd7,0x45,0x6c,0xa0,0x09,0x97,0x69,0x1d,0x20,0x57,0x94,0x89,0xad,0x38,
+0x21,0x70,0x01,0xa0,0xb7,0xf9,0x02,0xf0,0x5b,0x09,0x00,0x3e,0x66,0x00,0x09,0xd9,
+0x5c,0x83,0xb0,0x00,0x87,0x84,0x09,0xe1,0x00,0x08,0x78,0x49,0x86,0xa6,0x00,0xdc,
+0xd4,0x89,0xc8,0x50,0x03,0x92,0x07,0x8c,0x71,0x00,0x09,0x90,0x24,0xa2,0x00,0x29,
+0xdc,0x99,0xad,0x98,0x01,0x20,0x21,0x01,0x90,0x00,0x00,0xa0,0x89,0xd8,0xd0,0x07,
+0xd7,0x88,0xd8,0xd0,0x0a,0x9a,0x82,0xb1,0xa0,0x08,0x79,0x4c,0xaa,0x80,0x0d,0xcd,
+0x3b,0xc9,0x20,0x04,0xa1,0x1a,0x62,0xc0,0x00,0xa9,0x8a,0xc8,0x85,0x18,0xdc,0x76,
+0x84,0x90,0x12,0x00,0x84,0xc1,0x52,0x00,0x42,0x00,0x00,0x00,0x04,0xb0,0x6b,0xbb,
+0xb3,0x4b,0x12,0xe3,0x05,0x10,0x77,0x0f,0x00,0xb0,0xd0,0xbb,0xbe,0xb6,0x4c,0xb0,
+0x00,0x0a,0x00,0x21,0xb0,0x4d,0x03,0x07,0x05,0x00,0xf0,0x16,0x04,0xbb,0x00,0x01,
+0x90,0x00,0xc0,0x00,0x3a,0xcb,0x30,0xc0,0x00,0x00,0x0b,0x00,0xd2,0x00,0x00,0x85,
+0x60,0xdc,0x40,0x06,0xfb,0x70,0xc0,0xb5,0x5a,0xc4,0x90,0xc0,0x01,0x10,0xb0,0x30,
+0xc0,0x2d,0x00,0x03,0x05,0x00,0xf0,0x1b,0x1a,0xaa,0xda,0xaa,0x70,0x01,0x22,0xa4,
+0x22,0x00,0x04,0x77,0xc8,0x77,0x20,0x5a,0xaa,0xda,0xaa,0xa0,0x00,0x2b,0x4a,0x02,
+0x50,0x29,0xe3,0x06,0x8a,0x10,0x53,0x92,0x01,0xb5,0x00,0x00,0xca,0xb5,0x09,0xb2,
+0x00,0x62,0x5f,0x06,0xf1,0x09,0x00,0x20,0x00,0x00,0x25,0x55,0xb9,0x55,0x50,0x24,
+0x44,0x44,0x44,0x40,0x00,0xd9,0x99,0x9c,0x00,0x49,0xd7,0x77,0x7d,0x91,0x0a,0x00,
+0xf0,0x7e,0x00,0x2a,0x59,0x24,0x60,0x39,0xc7,0x01,0xc8,0x00,0x21,0x5a,0x99,0x3a,
+0x71,0x00,0x45,0x10,0x00,0x41,0x02,0x80,0x00,0xa0,0x00,0x5a,0xc6,0xa9,0xda,0xb4,
+0x00,0x54,0xb0,0xa0,0x90,0x00,0xb7,0xba,0xea,0x90,0x0b,0xf7,0xaa,0x01,0xa0,0x64,
+0xb8,0xa5,0x79,0x50,0x00,0xb0,0xa0,0xbb,0x00,0x00,0xb4,0x54,0xbc,0x60,0x00,0xb7,
+0x58,0x00,0x85,0x05,0x28,0x00,0xb0,0x00,0x03,0x59,0xaa,0xea,0xa5,0x03,0xa8,0x00,
+0xb0,0x00,0x27,0x38,0x8a,0xda,0xa3,0x00,0x15,0x44,0x00,0x00,0x29,0x9b,0xee,0x99,
+0xa6,0x03,0x8a,0x04,0x79,0x70,0x17,0x67,0x45,0x6b,0x40,0x00,0x79,0x51,0x00,0x66,
+0x6b,0xbe,0xbd,0xcb,0xb1,0x00,0x0a,0x08,0x20,0x00,0x0a,0xae,0xbd,0xba,0x70,0x0a,
+0x0a,0x08,0x20,0xa0,0x0a,0x29,0x08,0x31,0xa0,0x0c,0xa1,0x03,0xab,0xa0,0x0a,0x3c,
+0x08,0x33,0x0e,0xaa,0xaa,0x0a,0x00,0xf2,0x4b,0x0a,0xac,0xca,0xea,0xa5,0x05,0x9c,
+0xca,0xe9,0x90,0x08,0x25,0x50,0xa0,0xa1,0x08,0x9b,0xb9,0xd8,0xd1,0x00,0x13,0xa1,
+0x11,0x10,0x2a,0xaf,0xaa,0xbd,0xa6,0x00,0x8b,0x21,0xb2,0x00,0x00,0x18,0xed,0xc6,
+0x10,0x0a,0x96,0x20,0x04,0xa1,0x08,0x8b,0xb8,0xd8,0x84,0x09,0x8a,0xa7,0xd7,0xc1,
+0x06,0x98,0xa8,0x97,0x90,0x03,0xa0,0xb8,0x88,0x82,0x1a,0x9c,0xd7,0x77,0xa0,0x07,
+0xa0,0xa9,0x99,0xc0,0x26,0x90,0x6e,0x99,0x60,0x00,0x95,0x59,0x6a,0x10,0x00,0x95,
+0x98,0x68,0x96,0xc8,0x04,0xf5,0x1d,0x90,0x6b,0xaa,0xb0,0x5b,0xea,0x64,0x00,0xb0,
+0x01,0x90,0x64,0xa0,0xb0,0x7a,0xd9,0x74,0xb0,0xb0,0x04,0x91,0x74,0xa0,0xb0,0x06,
+0xd2,0x11,0xc2,0x30,0x09,0x2b,0x03,0xa4,0x21,0x1a,0x03,0x1a,0x54,0x54,0x82,0x03,
+0xb1,0x3b,0xb1,0xfa,0x04,0xf6,0x1f,0x00,0x01,0xc0,0x9b,0xaa,0xe0,0x5a,0xc8,0x91,
+0x00,0xb0,0x00,0x39,0x91,0xb0,0xb0,0x00,0xd2,0x91,0xb0,0xb0,0x1c,0xf5,0x91,0xb0,
+0xb0,0x77,0xb7,0x20,0xd1,0x30,0x00,0xb0,0x05,0xa4,0x03,0x00,0xb0,0x28,0x64,0x18,
+0x00,0xb3,0x80,0x3b,0xa4,0x70,0x02,0xf2,0x1f,0x0b,0x0b,0x06,0xb8,0x82,0x0b,0x0b,
+0x09,0x63,0x10,0x0b,0x0b,0x46,0x1b,0x00,0x02,0x9f,0x99,0x9d,0x10,0x00,0xb0,0x32,
+0x0c,0x00,0x00,0xb0,0x75,0x0c,0x00,0x00,0x60,0xa9,0x06,0x00,0x00,0x09,0xab,0x00,
+0x73,0x1a,0xb5,0x08,0xaa,0xc1,0x00,0x7a,0x09,0xf0,0x0b,0x10,0x00,0x00,0x04,0xca,
+0xae,0x30,0x02,0xd1,0x02,0xb0,0x01,0xde,0xaa,0xea,0xac,0x02,0xb0,0x0b,0x00,0xb0,
+0x0e,0xaa,0xea,0xac,0x01,0x09,0x00,0xd2,0x3d,0xaa,0xea,0xac,0x08,0x40,0x0b,0x00,
+0xb0,0xb0,0x00,0xb4,0xb9,0xa0,0x00,0x10,0x30,0x36,0x00,0xf7,0x1c,0xc9,0x19,0xda,
+0xc4,0x0b,0x0b,0x00,0xb0,0x73,0x6d,0xb9,0xab,0x77,0xc0,0x0a,0x52,0xa7,0x24,0x00,
+0x0b,0xa8,0xa8,0xce,0xa3,0x0b,0x75,0xa9,0x0a,0x00,0x0c,0x98,0xa9,0xae,0xa5,0x47,
+0x52,0x90,0x0a,0x00,0x72,0x17,0x80,0x0a,0x10,0x03,0xf3,0x1e,0x04,0xc9,0x10,0x1a,
+0x00,0x0a,0x0a,0x06,0x8d,0x72,0x6e,0xbb,0x8b,0x3b,0x75,0x1a,0x62,0x9a,0x09,0x45,
 0x0c,0xb9,0x9b,0x4b,0x85,0x0c,0xb9,0x92,0x3b,0x61,0x09,0x73,0x90,0x1a,0x91,0x26,
 0x62,0xa3,0x6d,0xc7,0x72,0x67,0x9b,0x96,0x3a,0x34,0x00,0x10,0x32,0xc3,0x05,0x32,
 0x3c,0x11,0x10,0xc3,0x05,0xe0,0x79,0x99,0x99,0x20,0x00,0x12,0x22,0x22,0x00,0x00,
-0x57,0x77,0x77,0x10,0x0f,0x00,0x10,0x30,0xd4,0x52,0x12,0x50,0x7a,0x5d,0x01,0x8b,
-0x12,0x00,0x01,0x00,0xf1,0x0f,0x7d,0xce,0xb3,0xc6,0x62,0x1a,0x7a,0x8a,0xa8,0x81,
-0x5b,0x86,0x81,0xad,0x10,0x08,0x69,0x88,0x42,0x94,0x37,0x77,0xa8,0x77,0x71,0x01,
-0x66,0x66,0x66,0x00,0xe6,0x24,0x10,0x05,0x18,0x24,0x01,0x05,0x00,0x40,0x04,0x50,
-0x00,0xc0,0x83,0x69,0xc6,0xc0,0x00,0x12,0x20,0x00,0xc0,0x00,0x48,0xc3,0xbb,0xfb,
-0xb6,0x07,0x03,0xb0,0x00,0xb4,0x10,0xc0,0x00,0x01,0xf9,0x00,0xc0,0x00,0x03,0x28,
-0x00,0x10,0x04,0xd8,0x12,0x01,0x5e,0x29,0x02,0x53,0x4e,0x21,0xd0,0x00,0x14,0x38,
-0x10,0xf3,0xb1,0x48,0xf0,0x0b,0x98,0x00,0x00,0xb5,0x2a,0x1b,0x10,0x00,0xe7,0x69,
-0x03,0xa0,0x01,0x31,0xa0,0x00,0x56,0x06,0x30,0x24,0x60,0x51,0x01,0xb0,0xa0,0xc0,
-0x3a,0x21,0xf2,0x11,0x31,0xb0,0x4a,0xb0,0x73,0x04,0x70,0x00,0xb0,0x1b,0x0b,0x10,
-0x00,0xb0,0x08,0x87,0x00,0x00,0xb4,0x03,0xf2,0x00,0x01,0xf8,0x4c,0x5c,0x40,0x02,
-0x46,0x91,0x01,0x97,0xca,0x14,0x40,0x80,0x9b,0xbb,0xa0,0x4c,0x11,0x30,0xb0,0x36,
-0x50,0x13,0x49,0xa1,0xc0,0x79,0x99,0xd0,0x00,0xb0,0xb1,0x11,0x80,0x00,0xfc,0x30,
-0xe2,0xb3,0xc0,0x00,0x13,0x00,0xea,0xc0,0x00,0x38,0x03,0x80,0x7c,0xbb,0xd2,0x1e,
-0x39,0xf0,0x0b,0x90,0x0e,0xbe,0x00,0x00,0x62,0x1a,0x0a,0x00,0x13,0x20,0x85,0x0a,
-0x52,0x37,0xb3,0x70,0x01,0x41,0x00,0xb0,0xdb,0xbb,0xb0,0x00,0xb0,0x7d,0x23,0xf0,
-0x01,0xb7,0x07,0xa9,0x00,0x03,0xe4,0x4a,0xba,0x40,0x02,0x23,0x81,0x01,0x83,0x01,
-0x00,0xc1,0x53,0x10,0x90,0xd7,0x00,0x50,0x53,0xbb,0xdb,0xb6,0x36,0xaf,0x51,0x40,
-0x13,0xb0,0x0e,0xaa,0x62,0x20,0x00,0xcd,0x05,0xf7,0x03,0x18,0x00,0xb0,0x00,0xca,
-0x65,0x01,0xa0,0x03,0xe3,0xb0,0x03,0x80,0x02,0x26,0x60,0x9c,0x30,0xf2,0x1c,0x80,
-0x50,0xaa,0xaa,0xa4,0x00,0x80,0x00,0x73,0x8a,0x11,0xf2,0x21,0x73,0x00,0x4a,0xb0,
-0x82,0x74,0x10,0x00,0xb0,0x82,0x7b,0x91,0x00,0xb0,0x82,0x73,0x00,0x00,0xb6,0x92,
-0x73,0x00,0x02,0xf6,0x93,0x84,0x10,0x04,0x33,0x99,0x99,0x95,0x05,0x40,0x00,0x0b,
-0x81,0x00,0x91,0x11,0x1b,0x36,0x00,0x04,0xaa,0xae,0xa8,0x39,0x7f,0x08,0x32,0xae,
-0x7b,0x00,0xe0,0x5a,0xe3,0xb2,0x0a,0x18,0x33,0x02,0xeb,0x9e,0x94,0x8a,0x03,0x50,
-0x20,0x00,0xb7,0x03,0x0c,0x70,0x57,0x9b,0x80,0x01,0xa0,0x53,0xc0,0x0c,0x13,0x73,
-0xc1,0x10,0x4a,0xb2,0x99,0xe9,0x95,0x74,0x22,0xf1,0x03,0xba,0xba,0xe0,0x00,0xb7,
-0xb0,0x00,0xc0,0x02,0xf4,0xb1,0x11,0xc0,0x03,0x30,0xb9,0x99,0xe0,0xee,0x1d,0x30,
-0x06,0x70,0x4a,0x7e,0x55,0xf3,0x17,0xbb,0xaa,0xb9,0x14,0x37,0x93,0x32,0x1a,0x26,
-0xb2,0xb5,0x5a,0x29,0x00,0xb0,0xa9,0x9a,0x28,0x00,0xb0,0xa0,0x0a,0x37,0x00,0xc8,
-0xa9,0x98,0x56,0x02,0xe2,0x50,0x00,0x74,0x02,0x20,0x00,0x4a,0xc0,0x80,0x1b,0xe0,
-0x13,0x00,0x60,0x07,0x80,0x0b,0x02,0xa0,0x00,0x50,0x9c,0xad,0xc4,0x37,0xee,0x6b,
-0x40,0x24,0xb0,0x59,0xdb,0x68,0x03,0x10,0x93,0xbc,0x2f,0x10,0x94,0x80,0x5c,0x60,
-0xda,0x96,0x01,0xf8,0x00,0x82,0x17,0x48,0x13,0x82,0xfa,0x00,0xf0,0x10,0x43,0xac,
-0xca,0xa3,0x00,0xa0,0x17,0x51,0x10,0x00,0x00,0x9e,0x9a,0xa0,0x4a,0xb0,0x0c,0x02,
-0x90,0x00,0xb5,0x88,0x88,0x86,0x00,0xb0,0x9a,0xaa,0xa0,0x00,0xb5,0x50,0x38,0x10,
-0xf7,0x05,0x00,0x23,0x40,0xc9,0x3a,0x2f,0x50,0x08,0x60,0xaa,0xaa,0xe0,0x46,0x59,
-0x71,0xb0,0x14,0x30,0x8a,0xaa,0xb0,0x49,0xd3,0x22,0x60,0xb0,0x88,0xe9,0x82,0x00,
-0xb2,0xca,0x30,0xf2,0x14,0xb6,0x04,0xc7,0x00,0x03,0xe4,0x5b,0x09,0x81,0x00,0x13,
-0x70,0x00,0x45,0x02,0x00,0x32,0x01,0x40,0x05,0x90,0x2b,0x07,0x40,0x00,0x51,0x9d,
-0x9e,0x70,0x26,0x40,0xb1,0x11,0xa0,0x26,0x0c,0x46,0xf2,0x08,0xcd,0xad,0xa0,0x00,
-0xb0,0x0d,0x0b,0x00,0x00,0xc9,0x2c,0x0b,0x00,0x02,0xf5,0x86,0x0b,0x09,0x04,0x38,
-0x80,0x0b,0xb6,0x2b,0x02,0xf0,0x07,0x30,0x66,0xd6,0x62,0x00,0x70,0x78,0xe8,0x80,
-0x25,0x31,0x33,0xc3,0x32,0x36,0xb2,0x66,0x66,0x63,0x00,0xb0,0xb9,0xfc,0x30,0xf1,
-0x09,0xb7,0x77,0xc0,0x00,0xc9,0xb8,0x88,0xc0,0x01,0xf3,0xb0,0x00,0xb0,0x03,0x30,
-0xb0,0x09,0x90,0x06,0x40,0x89,0xe9,0x90,0x00,0x33,0x17,0xf2,0x13,0x03,0xdc,0xed,
-0xd4,0x5a,0xa0,0x48,0x82,0x90,0x00,0xa0,0x86,0xa2,0x10,0x00,0xa4,0xac,0xeb,0xa5,
-0x00,0xc8,0x05,0x86,0x00,0x03,0xc2,0x7b,0x03,0xa1,0x01,0x04,0x50,0x00,0x24,0x90,
-0x01,0xf4,0x1d,0x60,0xda,0xaa,0xb8,0x00,0x90,0xa0,0x90,0x18,0x00,0x00,0xa7,0xda,
-0x38,0x4a,0xb0,0xa4,0xb4,0x48,0x00,0xb0,0xa3,0x33,0x38,0x00,0xb1,0x9a,0x8d,0x28,
-0x00,0xda,0x7a,0x8d,0x28,0x01,0xeb,0x36,0x00,0x18,0x04,0x2a,0x00,0x05,0xb6,0xbc,
-0x1a,0xf0,0x0c,0x01,0x00,0x08,0x20,0x38,0x09,0x10,0x01,0xa5,0xae,0x9e,0xa4,0x00,
-0x04,0x6b,0x0a,0x82,0x4a,0xb3,0x7c,0x4c,0x73,0x00,0xb4,0x55,0x55,0x54,0xdc,0x23,
-0xe0,0xc0,0x00,0xb4,0xb7,0x77,0xc0,0x04,0xe4,0xc8,0x88,0xc0,0x02,0x20,0xa0,0x63,
-0x25,0x00,0x80,0x66,0xf0,0x15,0xfa,0x97,0x00,0x02,0xc2,0x03,0x70,0x02,0xcc,0xaa,
-0xdb,0xa0,0x01,0xb0,0x03,0x0c,0x00,0x0b,0x02,0x90,0xc0,0x00,0xb0,0x66,0x0c,0x00,
-0x07,0x1c,0x43,0x70,0x02,0x7b,0x20,0x7a,0x21,0x84,0xc0,0x55,0x00,0x8a,0x09,0x30,
-0x0e,0xaa,0xa0,0xc6,0x55,0xf0,0x28,0xa2,0xea,0xa7,0x09,0x82,0xa9,0x30,0xa0,0x09,
-0x82,0xbe,0x50,0x90,0x09,0x92,0xa1,0xa4,0x60,0x09,0xb0,0xa0,0x7c,0x10,0x01,0xa6,
-0x00,0x4d,0x10,0x0a,0x34,0x84,0xb3,0xb2,0x33,0x00,0x26,0x00,0x15,0x0d,0xaa,0x90,
-0xa0,0x00,0x09,0x62,0x90,0xa9,0x94,0x09,0x82,0x90,0xa1,0x10,0x09,0x82,0x0f,0x00,
-0xf3,0x08,0xa2,0x9a,0xeb,0xa6,0x09,0xc1,0x98,0x00,0x19,0x01,0xc8,0x08,0x00,0x19,
-0x1b,0x67,0x6c,0x99,0xa9,0x48,0x00,0x28,0x11,0xd5,0x3d,0xf0,0x15,0x92,0x07,0xaa,
-0xd0,0x2a,0xdb,0x70,0x00,0xb0,0x12,0xa4,0x20,0x00,0xb0,0x38,0xba,0x89,0xba,0x90,
-0x08,0x56,0x18,0x20,0x00,0x0b,0x5a,0x78,0x20,0x55,0x1f,0x74,0x03,0xaa,0x91,0x47,
-0xe5,0xa6,0x3f,0x42,0x3b,0xbb,0xbb,0xb6,0xfe,0x13,0xf0,0x14,0x63,0x0a,0xea,0xc4,
-0x0a,0xcb,0x80,0xa0,0x83,0x01,0x85,0x15,0x52,0xb1,0x18,0xab,0x86,0x06,0x50,0x08,
-0x46,0x1b,0x99,0xe0,0x0b,0x4b,0x7b,0x00,0xa0,0x0e,0x85,0x0b,0x99,0xd0,0x19,0x33,
-0x3d,0x52,0x54,0x1a,0xcb,0xbb,0xb5,0x41,0x05,0x00,0x77,0x41,0x00,0x97,0x20,0x02,
-0x05,0x00,0x80,0x00,0xbb,0xbe,0xbb,0x80,0x00,0x52,0x0b,0x48,0x2e,0x31,0x0e,0xaa,
-0xa1,0x6b,0x43,0x30,0x08,0x59,0x7b,0xa5,0x18,0x13,0x6c,0xf5,0x28,0x81,0x0e,0xae,
-0x3d,0xbb,0xb4,0x0a,0x0a,0x38,0x0a,0x00,0xf0,0x1d,0xaa,0xa0,0x00,0x90,0x38,0x00,
-0xb0,0x09,0xa8,0x58,0x00,0xa0,0x0a,0x92,0x4d,0xbb,0xc0,0x0a,0x91,0x48,0x00,0x00,
-0x1d,0xda,0x69,0x11,0x11,0x34,0x00,0x29,0x99,0x95,0x0e,0xae,0x7b,0xaa,0xe0,0x0a,
-0x0a,0x76,0x22,0xb0,0x0e,0xae,0xa0,0x32,0xf2,0x0e,0x90,0x78,0x55,0xc0,0x09,0xaa,
-0x87,0xb5,0x61,0x09,0x90,0x74,0x48,0xb2,0x09,0x95,0x84,0x0c,0x10,0x4d,0xa5,0x9a,
-0xa4,0xc3,0x00,0x00,0x54,0x00,0x23,0x54,0x01,0xf0,0x0f,0xae,0x06,0xc8,0x70,0x0a,
-0x0a,0x2e,0x44,0x80,0x0e,0xae,0xb4,0xaa,0x00,0x00,0x90,0x00,0xbb,0x00,0x09,0xa7,
-0x3b,0x55,0xd3,0x09,0x93,0x8d,0xaa,0xd4,0x09,0x6e,0x5f,0xf5,0x29,0x2d,0xdb,0x2b,
-0x00,0xb0,0x34,0x00,0x0d,0x99,0xd0,0x0d,0xac,0x0a,0x1b,0x00,0x09,0x0a,0x9a,0x1b,
-0x85,0x0d,0xac,0x7d,0x1c,0xa0,0x01,0x90,0x0a,0x1b,0x00,0x08,0xb9,0x1c,0x1f,0x70,
-0x08,0x91,0xcc,0x0b,0x87,0x08,0x91,0x2b,0x0b,0x01,0x2d,0xda,0x67,0x0b,0x08,0x34,
-0x02,0xb0,0x0c,0xa7,0x00,0xb2,0x0e,0xf2,0x1e,0x0e,0xad,0x22,0xb4,0x21,0x0a,0x0a,
-0xb7,0x77,0xa6,0x0b,0x8b,0x68,0x99,0x73,0x01,0x90,0x01,0x11,0x00,0x09,0xa9,0x8a,
-0xaa,0xa5,0x09,0x90,0x01,0x73,0x10,0x09,0x92,0x47,0x73,0xb0,0x2d,0xc9,0xb0,0x73,
-0x56,0x23,0x00,0x25,0xc1,0x02,0xa0,0x4f,0xe0,0x56,0xc7,0x64,0x00,0x00,0xc4,0x44,
-0x4b,0x00,0x00,0xd8,0x88,0x8b,0x00,0x3d,0x0e,0xa0,0x81,0x00,0xc2,0x22,0x2f,0x60,
-0x1a,0xca,0xaa,0xdc,0x3b,0x3a,0xb5,0x3b,0x00,0x00,0x4a,0x90,0x0b,0x00,0x3c,0x71,
-0x0a,0xb8,0x68,0x00,0x00,0x64,0x06,0x00,0x1a,0x36,0x70,0xbe,0xbb,0xbb,0xb4,0x00,
-0x39,0x03,0xb8,0x17,0x00,0x7e,0x36,0x01,0x63,0x01,0x20,0x00,0x0b,0xef,0x16,0x38,
-0xbe,0xbb,0xb6,0xd4,0x62,0x02,0xf4,0x45,0xf0,0x10,0x65,0x00,0x6d,0xba,0x4a,0xea,
-0xa2,0x09,0x40,0x12,0xc1,0x11,0x39,0xb4,0x59,0xa6,0x63,0x25,0xc6,0x0a,0xca,0xa0,
-0x00,0xb6,0x30,0x05,0x80,0x7d,0xe7,0x26,0x6c,0x6d,0x10,0x10,0x9a,0x05,0x00,0x26,
-0x07,0x50,0xa6,0x1d,0xf0,0x16,0x02,0x80,0x00,0xe2,0x00,0x5d,0xcb,0x06,0x79,0x00,
-0x09,0x40,0x39,0x06,0x50,0x09,0xa0,0x92,0x00,0x82,0x3b,0xea,0x0b,0x1a,0x30,0x00,
-0xa0,0x0d,0xb3,0x00,0x38,0xeb,0x1c,0x00,0x00,0x24,0xb0,0xb6,0x45,0xf7,0x1c,0xa0,
-0x09,0xaa,0xa0,0x02,0x80,0x00,0xb0,0x05,0xcb,0xa1,0x0b,0x00,0x0a,0x30,0x7b,0xea,
-0xe2,0xaa,0x58,0x1a,0x0b,0x25,0xa6,0x8b,0xea,0xe0,0x1a,0x89,0x2a,0x0b,0x6a,0xc5,
-0x81,0xa0,0xb0,0x08,0x27,0xbe,0xae,0x00,0x82,0x71,0xc8,0x27,0xf0,0x0d,0x06,0x9e,
-0x96,0xb2,0x80,0x02,0x2c,0x22,0xb3,0x52,0x16,0xa9,0x66,0xc7,0x64,0x09,0xda,0x99,
-0x83,0xa1,0x03,0x82,0x10,0x66,0xa0,0x09,0xbc,0xb8,0x21,0x1a,0xd4,0x53,0x2d,0x03,
-0x0c,0xcd,0xb8,0xcd,0x19,0x00,0x07,0x37,0x52,0xc7,0xa8,0x0c,0xf0,0x1e,0x30,0x00,
-0x15,0xa2,0x00,0x73,0x00,0x4b,0xa8,0x5a,0xbb,0xa4,0x09,0x31,0x06,0x22,0x60,0x0a,
-0x72,0x3b,0x00,0x92,0x3b,0xdb,0x49,0x26,0x64,0x00,0x72,0x01,0x9b,0x00,0x4a,0xdb,
-0x10,0xa8,0x00,0x11,0x82,0x08,0x9b,0x40,0x00,0x72,0x86,0xc4,0x62,0x04,0xf8,0x46,
-0xf0,0x19,0x03,0x91,0x2c,0x88,0xc0,0x5d,0xcb,0x4a,0x44,0xc0,0x09,0x30,0x7d,0xdd,
-0xd4,0x1b,0xa6,0x2a,0x11,0xb0,0x26,0xb7,0x1d,0x88,0xc0,0x00,0x97,0x3d,0x88,0xc0,
-0x6d,0xd7,0x29,0x00,0xb1,0x00,0x82,0xbd,0xcb,0xe4,0x12,0x05,0x15,0xa0,0xa8,0x1e,
-0x00,0x6a,0x0d,0xf1,0x21,0x0c,0x70,0x00,0x3d,0xc9,0x2a,0x36,0x91,0x00,0x84,0x1b,
-0xca,0xac,0xa0,0x0a,0xa4,0x56,0x73,0x25,0x01,0x8c,0x79,0x5b,0x63,0x90,0x00,0x96,
-0x93,0xb6,0x39,0x02,0xbd,0x49,0x8d,0x63,0x90,0x00,0x81,0x90,0x90,0x09,0x00,0x08,
-0x19,0x3b,0x19,0x60,0x08,0xaa,0x51,0xf0,0x10,0xa4,0x78,0xd7,0x71,0x00,0x01,0x25,
-0xa2,0xb1,0x3b,0xb0,0x06,0x60,0xa1,0x00,0xb0,0x0c,0x10,0xb0,0x00,0xb0,0x87,0x00,
-0xc0,0x01,0xb7,0x70,0x3b,0x80,0x0b,0xa7,0x13,0x5a,0x42,0x06,0xcb,0xbb,0xd8,0x4b,
-0x05,0x10,0x10,0x6c,0x4e,0x41,0x86,0xbb,0xbe,0xb4,0xb4,0x01,0x40,0x4b,0x80,0xb1,
-0x0b,0x80,0x47,0x01,0xf1,0x44,0x00,0xec,0x27,0x80,0x05,0xbb,0x00,0x3b,0x5a,0xa8,
-0x89,0x95,0x58,0x53,0x12,0x10,0x65,0x14,0x33,0x40,0xaa,0xaa,0xbd,0x12,0xf0,0x0b,
-0x05,0x88,0x88,0x86,0x3a,0xa2,0x3d,0x45,0x32,0x00,0xb0,0x38,0x09,0x20,0x00,0xb0,
-0xc3,0x36,0xc0,0x00,0xb2,0xa8,0x76,0x93,0x08,0xb6,0x37,0x0d,0x42,0x05,0xbb,0xab,
-0xda,0xa8,0x0b,0x10,0x30,0x39,0x3d,0x50,0x75,0xbe,0xbe,0xb3,0x00,0x8e,0x26,0x20,
-0x4c,0x90,0x0f,0x00,0xf6,0x09,0xb6,0xce,0xbe,0xb5,0x00,0xb0,0x66,0x0b,0x00,0x00,
-0xb1,0xc0,0x0b,0x00,0x09,0x86,0x10,0x04,0x00,0x46,0x05,0xaa,0xab,0xc7,0x93,0x41,
-0xa1,0x09,0x42,0x3d,0x43,0x31,0x00,0xa3,0x9a,0x76,0x62,0x96,0x38,0x52,0x3a,0xa2,
-0xda,0xea,0xa1,0xb3,0x06,0x10,0xb7,0xfe,0x24,0x01,0xb0,0x36,0x96,0xa6,0x00,0x80,
-0x00,0x47,0x06,0xbb,0xab,0xdb,0xc8,0x41,0x71,0x09,0x50,0xcb,0xbb,0xe0,0x00,0x80,
-0x58,0x64,0xf0,0x32,0xc5,0x55,0xd0,0x4b,0x90,0xd6,0x86,0x50,0x00,0xb0,0xb0,0x78,
-0x00,0x00,0xb4,0x80,0x08,0x60,0x00,0xc8,0x10,0x00,0xa1,0x1b,0x79,0x31,0x01,0x22,
-0x33,0x02,0x79,0xaa,0x95,0x07,0x00,0x00,0xb6,0x40,0x06,0x73,0x44,0xd4,0xa2,0x00,
-0x13,0x5b,0xf7,0x52,0x4a,0x90,0x0a,0xca,0x00,0x00,0xb0,0x74,0xb3,0x90,0x00,0xb5,
-0xa0,0xb0,0x93,0x00,0xb7,0xee,0x34,0x92,0x86,0x10,0x60,0x12,0x33,0x02,0x8a,0xaa,
+0x57,0x77,0x77,0x10,0x0f,0x00,0x30,0x30,0x00,0xb0,0x2a,0x06,0x91,0xb1,0x11,0x17,
+0x50,0x00,0xc8,0x88,0x8b,0x50,0x35,0x00,0xf2,0x18,0x7d,0xce,0xb3,0xc6,0x62,0x1a,
+0x7a,0x8a,0xa8,0x81,0x5b,0x86,0x81,0xad,0x10,0x08,0x69,0x88,0x42,0x94,0x37,0x77,
+0xa8,0x77,0x71,0x01,0x66,0x66,0x66,0x00,0x01,0x77,0x77,0x76,0x00,0x05,0xa7,0x77,
+0x7d,0x05,0x00,0x20,0x04,0x50,0xf3,0x02,0xe6,0x83,0x00,0xc0,0x00,0x12,0x20,0x00,
+0xc0,0x00,0x48,0xc3,0xbb,0xfb,0xb6,0x07,0x03,0xb0,0x00,0xb4,0x10,0xc0,0x00,0x01,
+0xf9,0x00,0xc0,0x00,0x03,0x28,0x00,0x20,0x04,0x50,0xb1,0x05,0x10,0x93,0x05,0x00,
+0x00,0x20,0x00,0x40,0x5a,0xd0,0x00,0xe0,0x08,0x00,0xf1,0x34,0xf3,0x00,0x00,0xb0,
+0x05,0x98,0x00,0x00,0xb5,0x2a,0x1b,0x10,0x00,0xe7,0x69,0x03,0xa0,0x01,0x31,0xa0,
+0x00,0x56,0x06,0x30,0x24,0x60,0x51,0x01,0xb0,0xa0,0xc0,0xb0,0x00,0x00,0xb0,0x31,
+0xb0,0x4a,0xb0,0x73,0x04,0x70,0x00,0xb0,0x1b,0x0b,0x10,0x00,0xb0,0x08,0x87,0x00,
+0x00,0xb4,0x03,0xf2,0x00,0x01,0xf8,0x4c,0x5c,0x40,0x02,0x46,0x91,0x01,0x97,0xb9,
+0x00,0xf0,0x0c,0x06,0x80,0x9b,0xbb,0xa0,0x00,0x72,0x00,0x00,0xb0,0x36,0x50,0x00,
+0x00,0xb0,0x24,0xc0,0x79,0x99,0xd0,0x00,0xb0,0xb1,0x11,0x80,0x00,0xb0,0x72,0x00,
+0xe1,0xb3,0xc0,0x00,0x13,0x00,0xea,0xc0,0x00,0x38,0x03,0x80,0x7c,0xbb,0xd2,0x32,
+0x00,0xf0,0x1f,0x05,0x90,0x0e,0xbe,0x00,0x00,0x62,0x1a,0x0a,0x00,0x13,0x20,0x85,
+0x0a,0x52,0x37,0xb3,0x70,0x01,0x41,0x00,0xb0,0xdb,0xbb,0xb0,0x00,0xb0,0x29,0x09,
+0x40,0x00,0xb7,0x07,0xa9,0x00,0x03,0xe4,0x4a,0xba,0x40,0x02,0x23,0x81,0x01,0x83,
+0x01,0x3e,0x0a,0x20,0x05,0x90,0xd7,0x00,0xf0,0x02,0x53,0xbb,0xdb,0xb6,0x36,0x40,
+0x0c,0x00,0x00,0x13,0xb0,0x0e,0xaa,0x80,0x00,0xb0,0x0b,0xcd,0x05,0xf6,0x03,0x18,
+0x00,0xb0,0x00,0xca,0x65,0x01,0xa0,0x03,0xe3,0xb0,0x03,0x80,0x02,0x26,0x60,0x9c,
+0x30,0xbd,0x01,0xf2,0x2e,0x08,0x50,0xaa,0xaa,0xa4,0x00,0x80,0x00,0x73,0x00,0x02,
+0x10,0x00,0x73,0x00,0x4a,0xb0,0x82,0x74,0x10,0x00,0xb0,0x82,0x7b,0x91,0x00,0xb0,
+0x82,0x73,0x00,0x00,0xb6,0x92,0x73,0x00,0x02,0xf6,0x93,0x84,0x10,0x04,0x33,0x99,
+0x99,0x95,0x05,0x40,0x00,0x0b,0x81,0x00,0x91,0x11,0x1b,0x36,0x00,0x04,0xaa,0xae,
+0xa8,0x39,0x7f,0x08,0xf3,0x08,0xae,0x7b,0x00,0x00,0xb0,0x0a,0x0b,0x00,0x00,0xb2,
+0x0a,0x18,0x33,0x02,0xeb,0x9e,0x94,0x8a,0x03,0x50,0x20,0x00,0xb7,0x03,0x0c,0x60,
+0x57,0x9b,0x80,0x01,0xa0,0x53,0x39,0x08,0x81,0x11,0xc1,0x10,0x4a,0xb2,0x99,0xe9,
+0x95,0x60,0x06,0xf2,0x36,0x00,0xb0,0xba,0xba,0xe0,0x00,0xb7,0xb0,0x00,0xc0,0x02,
+0xf4,0xb1,0x11,0xc0,0x03,0x30,0xb9,0x99,0xe0,0x00,0x00,0x04,0x00,0x00,0x06,0x70,
+0x4a,0x00,0x00,0x00,0x70,0xbb,0xaa,0xb9,0x14,0x37,0x93,0x32,0x1a,0x26,0xb2,0xb5,
+0x5a,0x29,0x00,0xb0,0xa9,0x9a,0x28,0x00,0xb0,0xa0,0x0a,0x37,0x00,0xc8,0xa9,0x98,
+0x56,0x02,0xe2,0x50,0x00,0x74,0x02,0x20,0x00,0x4a,0x8f,0x08,0xf0,0x0c,0x02,0x00,
+0x13,0x00,0x60,0x07,0x80,0x0b,0x02,0xa0,0x00,0x50,0x9c,0xad,0xc4,0x37,0x50,0x00,
+0x83,0x00,0x24,0xb0,0x59,0xdb,0x91,0x00,0xb0,0x4b,0x09,0xf3,0x03,0xb0,0x11,0x94,
+0x10,0x00,0xb4,0x99,0xda,0x96,0x01,0xf8,0x00,0x82,0x00,0x03,0x40,0x00,0x82,0xfa,
+0x00,0xf0,0x15,0x43,0xac,0xca,0xa3,0x00,0xa0,0x17,0x51,0x10,0x00,0x00,0x9e,0x9a,
+0xa0,0x4a,0xb0,0x0c,0x02,0x90,0x00,0xb5,0x88,0x88,0x86,0x00,0xb0,0x9a,0xaa,0xa0,
+0x00,0xb5,0xb0,0x00,0xb0,0x01,0xf7,0x05,0x00,0x42,0x40,0xc9,0x99,0xd0,0x32,0x00,
+0xf0,0x33,0x60,0xaa,0xaa,0xe0,0x00,0x90,0xa0,0x00,0xb0,0x14,0x30,0x8a,0xaa,0xb0,
+0x49,0xb0,0x11,0x11,0x10,0x00,0xb0,0x88,0xe9,0x82,0x00,0xb2,0xaa,0xea,0xa6,0x00,
+0xb6,0x04,0xc7,0x00,0x03,0xe4,0x5b,0x09,0x81,0x00,0x13,0x70,0x00,0x45,0x02,0x00,
+0x32,0x01,0x40,0x05,0x90,0x2b,0x07,0x40,0x00,0x51,0x9d,0x9e,0x70,0x26,0x40,0xb1,
+0x11,0xa0,0x26,0xb0,0x1e,0x08,0xf2,0x09,0xb0,0xcd,0xad,0xa0,0x00,0xb0,0x0d,0x0b,
+0x00,0x00,0xc9,0x2c,0x0b,0x00,0x02,0xf5,0x86,0x0b,0x09,0x04,0x38,0x80,0x0b,0xb6,
+0x2b,0x02,0xf0,0x24,0x30,0x66,0xd6,0x62,0x00,0x70,0x78,0xe8,0x80,0x25,0x31,0x33,
+0xc3,0x32,0x36,0xb2,0x66,0x66,0x63,0x00,0xb0,0xb9,0x99,0xc0,0x00,0xb0,0xb7,0x77,
+0xc0,0x00,0xc9,0xb8,0x88,0xc0,0x01,0xf3,0xb0,0x00,0xb0,0x03,0x30,0xb0,0x09,0x90,
+0x06,0x40,0x89,0xe9,0x90,0x00,0x80,0x4f,0x01,0xf2,0x13,0x03,0xdc,0xed,0xd4,0x5a,
+0xa0,0x48,0x82,0x90,0x00,0xa0,0x86,0xa2,0x10,0x00,0xa4,0xac,0xeb,0xa5,0x00,0xc8,
+0x05,0x86,0x00,0x03,0xc2,0x7b,0x03,0xa1,0x01,0x04,0x50,0x00,0x24,0x90,0x01,0xf3,
+0x1d,0x60,0xda,0xaa,0xb8,0x00,0x90,0xa0,0x90,0x18,0x00,0x00,0xa7,0xda,0x38,0x4a,
+0xb0,0xa4,0xb4,0x48,0x00,0xb0,0xa3,0x33,0x38,0x00,0xb1,0x9a,0x8d,0x28,0x00,0xda,
+0x7a,0x8d,0x28,0x01,0xeb,0x36,0x00,0x18,0x04,0x2a,0x00,0x05,0xb6,0x23,0x02,0xf1,
+0x4e,0x10,0x01,0x00,0x08,0x20,0x38,0x09,0x10,0x01,0xa5,0xae,0x9e,0xa4,0x00,0x04,
+0x6b,0x0a,0x82,0x4a,0xb3,0x7c,0x4c,0x73,0x00,0xb4,0x55,0x55,0x54,0x00,0xb0,0xc9,
+0x99,0xc0,0x00,0xb4,0xb7,0x77,0xc0,0x04,0xe4,0xc8,0x88,0xc0,0x02,0x20,0xa0,0x00,
+0xa0,0x00,0x04,0x20,0x00,0x00,0x02,0xfa,0x97,0x00,0x02,0xc2,0x03,0x70,0x02,0xcc,
+0xaa,0xdb,0xa0,0x01,0xb0,0x03,0x0c,0x00,0x0b,0x02,0x90,0xc0,0x00,0xb0,0x66,0x0c,
+0x00,0x07,0x1c,0x43,0x70,0x02,0x7b,0x20,0x7a,0x21,0x84,0x00,0x00,0x16,0x8a,0x09,
+0xf0,0x2f,0x0e,0xaa,0xa0,0xb0,0x00,0x09,0x41,0xa2,0xea,0xa7,0x09,0x82,0xa9,0x30,
+0xa0,0x09,0x82,0xbe,0x50,0x90,0x09,0x92,0xa1,0xa4,0x60,0x09,0xb0,0xa0,0x7c,0x10,
+0x01,0xa6,0x00,0x4d,0x10,0x0a,0x34,0x84,0xb3,0xb2,0x33,0x00,0x26,0x00,0x15,0x0d,
+0xaa,0x90,0xa0,0x00,0x09,0x62,0x90,0xa9,0x94,0x09,0x82,0x90,0xa1,0x10,0x09,0x82,
+0x0f,0x00,0xf2,0x09,0xa2,0x9a,0xeb,0xa6,0x09,0xc1,0x98,0x00,0x19,0x01,0xc8,0x08,
+0x00,0x19,0x1b,0x67,0x6c,0x99,0xa9,0x48,0x00,0x28,0x11,0x29,0xc2,0x00,0xf1,0x1e,
+0x92,0x07,0xaa,0xd0,0x2a,0xdb,0x70,0x00,0xb0,0x12,0xa4,0x20,0x00,0xb0,0x38,0xba,
+0x89,0xba,0x90,0x08,0x56,0x18,0x20,0x00,0x0b,0x5a,0x78,0x20,0x55,0x1f,0x74,0x03,
+0xaa,0x91,0x47,0xe5,0x00,0x00,0x00,0x82,0x3b,0xbb,0xbb,0xb6,0x10,0x32,0x00,0xf2,
+0x1d,0x63,0x0a,0xea,0xc4,0x0a,0xcb,0x80,0xa0,0x83,0x01,0x85,0x15,0x52,0xb1,0x18,
+0xab,0x86,0x06,0x50,0x08,0x46,0x1b,0x99,0xe0,0x0b,0x4b,0x7b,0x00,0xa0,0x0e,0x85,
+0x0b,0x99,0xd0,0x19,0xd7,0x00,0x00,0x00,0x54,0x1a,0xcb,0xbb,0xb5,0x41,0x05,0x82,
+0xeb,0xbb,0xbb,0xc0,0x01,0xa0,0x00,0x00,0x05,0x00,0xf1,0x0f,0x00,0xbb,0xbe,0xbb,
+0x80,0x00,0x52,0x0b,0x00,0x00,0x00,0xb2,0x0e,0xaa,0xa1,0x00,0xe7,0x0b,0x00,0x00,
+0x08,0x59,0x7b,0x00,0x00,0x1b,0x00,0x6c,0xbb,0xb8,0x32,0x00,0x81,0x0e,0xae,0x3d,
+0xbb,0xb4,0x0a,0x0a,0x38,0x0a,0x00,0xf2,0x3e,0xaa,0xa0,0x00,0x90,0x38,0x00,0xb0,
+0x09,0xa8,0x58,0x00,0xa0,0x0a,0x92,0x4d,0xbb,0xc0,0x0a,0x91,0x48,0x00,0x00,0x1d,
+0xda,0x69,0x11,0x11,0x34,0x00,0x29,0x99,0x95,0x0e,0xae,0x7b,0xaa,0xe0,0x0a,0x0a,
+0x76,0x22,0xb0,0x0e,0xae,0x79,0x77,0xd0,0x00,0x90,0x78,0x55,0xc0,0x09,0xaa,0x87,
+0xb5,0x61,0x09,0x90,0x74,0x48,0xb2,0x09,0x95,0x84,0x0c,0x10,0x4d,0xa5,0x9a,0xa4,
+0xc3,0x00,0x00,0x54,0x00,0x23,0x54,0x01,0xf0,0x1d,0xae,0x06,0xc8,0x70,0x0a,0x0a,
+0x2e,0x44,0x80,0x0e,0xae,0xb4,0xaa,0x00,0x00,0x90,0x00,0xbb,0x00,0x09,0xa7,0x3b,
+0x55,0xd3,0x09,0x93,0x8d,0xaa,0xd4,0x09,0x90,0x0a,0x00,0xb0,0x2d,0xdb,0x2b,0x00,
+0xb0,0x34,0x00,0x0d,0x99,0xd0,0xf3,0x1f,0x0d,0xac,0x0a,0x1b,0x00,0x09,0x0a,0x9a,
+0x1b,0x85,0x0d,0xac,0x7d,0x1c,0xa0,0x01,0x90,0x0a,0x1b,0x00,0x08,0xb9,0x1c,0x1f,
+0x70,0x08,0x91,0xcc,0x0b,0x87,0x08,0x91,0x2b,0x0b,0x01,0x2d,0xda,0x67,0x0b,0x08,
+0x34,0x02,0xb0,0x0c,0xa7,0x00,0x01,0x00,0xf6,0x51,0x40,0x00,0x0e,0xad,0x22,0xb4,
+0x21,0x0a,0x0a,0xb7,0x77,0xa6,0x0b,0x8b,0x68,0x99,0x73,0x01,0x90,0x01,0x11,0x00,
+0x09,0xa9,0x8a,0xaa,0xa5,0x09,0x90,0x01,0x73,0x10,0x09,0x92,0x47,0x73,0xb0,0x2d,
+0xc9,0xb0,0x73,0x56,0x23,0x00,0x25,0xc1,0x02,0x00,0x00,0x21,0x00,0x00,0x00,0x56,
+0xc7,0x64,0x00,0x00,0xc4,0x44,0x4b,0x00,0x00,0xd8,0x88,0x8b,0x00,0x00,0xc6,0x66,
+0x6b,0x81,0x00,0xc2,0x22,0x2f,0x60,0x1a,0xca,0xaa,0xdc,0x00,0x00,0x00,0x4b,0x3b,
+0x00,0x00,0x4a,0x90,0x0b,0x00,0x3c,0x71,0x0a,0xb8,0x68,0x00,0xf1,0x15,0x00,0x00,
+0x04,0x90,0x00,0x00,0x0b,0xbe,0xbb,0xbb,0xb4,0x00,0x39,0x03,0x00,0x00,0x00,0xb1,
+0x0b,0x00,0x00,0x02,0xbb,0xbe,0xbb,0x80,0x00,0x00,0x0b,0x00,0x00,0x1b,0xbb,0xbe,
+0xbb,0xb6,0x0a,0x00,0x02,0x05,0x00,0x00,0x01,0x00,0xf0,0x18,0x02,0x90,0x00,0x65,
+0x00,0x6d,0xba,0x4a,0xea,0xa2,0x09,0x40,0x12,0xc1,0x11,0x39,0xb4,0x59,0xa6,0x63,
+0x25,0xc6,0x0a,0xca,0xa0,0x00,0xb6,0x30,0x05,0x80,0x7d,0xe7,0x26,0x6c,0x00,0x00,
+0xa0,0x00,0x9a,0x05,0x00,0x24,0x07,0x50,0x6a,0x00,0xf4,0x4a,0x10,0x00,0x02,0x80,
+0x00,0xe2,0x00,0x5d,0xcb,0x06,0x79,0x00,0x09,0x40,0x39,0x06,0x50,0x09,0xa0,0x92,
+0x00,0x82,0x3b,0xea,0x0b,0x1a,0x30,0x00,0xa0,0x0d,0xb3,0x00,0x38,0xeb,0x1c,0x00,
+0x00,0x24,0xb0,0x0b,0x00,0xa0,0x00,0xa0,0x09,0xaa,0xa0,0x02,0x80,0x00,0xb0,0x05,
+0xcb,0xa1,0x0b,0x00,0x0a,0x30,0x7b,0xea,0xe2,0xaa,0x58,0x1a,0x0b,0x25,0xa6,0x8b,
+0xea,0xe0,0x1a,0x89,0x2a,0x0b,0x6a,0xc5,0x81,0xa0,0xb0,0x08,0x27,0xbe,0xae,0x00,
+0x82,0x71,0x00,0xb0,0x00,0x01,0x00,0xf2,0x1e,0x06,0x9e,0x96,0xb2,0x80,0x02,0x2c,
+0x22,0xb3,0x52,0x16,0xa9,0x66,0xc7,0x64,0x09,0xda,0x99,0x83,0xa1,0x03,0x82,0x10,
+0x66,0xa0,0x09,0xbc,0xb8,0x3d,0x30,0x00,0x07,0x53,0x2d,0x03,0x0c,0xcd,0xb8,0xcd,
+0x19,0x00,0x07,0x37,0x52,0xc7,0x33,0x00,0xf2,0x22,0x30,0x00,0x30,0x00,0x15,0xa2,
+0x00,0x73,0x00,0x4b,0xa8,0x5a,0xbb,0xa4,0x09,0x31,0x06,0x22,0x60,0x0a,0x72,0x3b,
+0x00,0x92,0x3b,0xdb,0x49,0x26,0x64,0x00,0x72,0x01,0x9b,0x00,0x4a,0xdb,0x10,0xa8,
+0x00,0x11,0x82,0x08,0x9b,0x40,0x00,0x72,0x86,0x00,0xa4,0x37,0x00,0xf0,0x1f,0x20,
+0x00,0x00,0x00,0x03,0x91,0x2c,0x88,0xc0,0x5d,0xcb,0x4a,0x44,0xc0,0x09,0x30,0x7d,
+0xdd,0xd4,0x1b,0xa6,0x2a,0x11,0xb0,0x26,0xb7,0x1d,0x88,0xc0,0x00,0x97,0x3d,0x88,
+0xc0,0x6d,0xd7,0x29,0x00,0xb1,0x00,0x82,0xbd,0xcb,0xe4,0x00,0x82,0x07,0x01,0x02,
+0x02,0x01,0x00,0x05,0x00,0xf0,0x24,0x28,0x00,0x0c,0x70,0x00,0x3d,0xc9,0x2a,0x36,
+0x91,0x00,0x84,0x1b,0xca,0xac,0xa0,0x0a,0xa4,0x56,0x73,0x25,0x01,0x8c,0x79,0x5b,
+0x63,0x90,0x00,0x96,0x93,0xb6,0x39,0x02,0xbd,0x49,0x8d,0x63,0x90,0x00,0x81,0x90,
+0x90,0x09,0x00,0x08,0x19,0x3b,0x19,0x60,0x08,0x30,0xe4,0x00,0xf0,0x0f,0xa4,0x78,
+0xd7,0x71,0x00,0x01,0x25,0xa2,0xb1,0x3b,0xb0,0x06,0x60,0xa1,0x00,0xb0,0x0c,0x10,
+0xb0,0x00,0xb0,0x87,0x00,0xc0,0x01,0xb7,0x70,0x3b,0x80,0x0b,0x37,0x02,0x51,0x46,
+0x06,0xcb,0xbb,0xd8,0x68,0x00,0xa1,0x08,0x10,0x00,0x0b,0x00,0x01,0x86,0xbb,0xbe,
+0xb4,0xb4,0x01,0x20,0x4b,0x80,0xd2,0x01,0x20,0xb0,0x2a,0x05,0x00,0xf1,0x03,0x00,
+0x0b,0x00,0x02,0xc0,0x05,0xbb,0x00,0x3b,0x5a,0xa8,0x89,0x95,0x00,0x00,0x02,0x22,
+0x10,0x32,0x00,0x70,0x0a,0x40,0xaa,0xaa,0xa0,0x00,0x90,0x0b,0x00,0xf1,0x13,0x05,
+0x88,0x88,0x86,0x3a,0xa2,0x3d,0x45,0x32,0x00,0xb0,0x38,0x09,0x20,0x00,0xb0,0xc3,
+0x36,0xc0,0x00,0xb2,0xa8,0x76,0x93,0x08,0xb6,0x00,0x00,0x00,0x38,0x05,0xbb,0xab,
+0xda,0x32,0x00,0xf0,0x02,0x09,0x30,0x0b,0x0b,0x00,0x00,0x75,0xbe,0xbe,0xb3,0x00,
+0x00,0x0b,0x0b,0x00,0x4c,0x90,0x0f,0x00,0xf4,0x09,0xb6,0xce,0xbe,0xb5,0x00,0xb0,
+0x66,0x0b,0x00,0x00,0xb1,0xc0,0x0b,0x00,0x09,0x86,0x10,0x04,0x00,0x46,0x05,0xaa,
+0xab,0xc7,0x37,0x02,0xf0,0x09,0x00,0x00,0x09,0x42,0x3d,0x43,0x31,0x00,0xa3,0x9a,
+0x76,0x62,0x00,0x00,0xa0,0xb0,0x00,0x3a,0xa2,0xda,0xea,0xa1,0x00,0xb0,0xe1,0x00,
+0x41,0xb7,0xbb,0xeb,0xb6,0x0a,0x00,0xa3,0x0a,0xa6,0x00,0x80,0x00,0x47,0x06,0xbb,
+0xab,0xdb,0x35,0x00,0x00,0x6e,0x00,0x70,0x50,0xcb,0xbb,0xe0,0x00,0x80,0xc0,0x29,
+0x00,0xf2,0x3f,0xc5,0x55,0xd0,0x4b,0x90,0xd6,0x86,0x50,0x00,0xb0,0xb0,0x78,0x00,
+0x00,0xb4,0x80,0x08,0x60,0x00,0xc8,0x10,0x00,0xa1,0x1b,0x79,0x31,0x01,0x22,0x33,
+0x02,0x79,0xaa,0x95,0x07,0x00,0x00,0xb6,0x40,0x06,0x73,0x44,0xd4,0xa2,0x00,0x13,
+0x5b,0xf7,0x52,0x4a,0x90,0x0a,0xca,0x00,0x00,0xb0,0x74,0xb3,0x90,0x00,0xb5,0xa0,
+0xb0,0x93,0x00,0xb7,0x00,0xb0,0x00,0x08,0x86,0x10,0x60,0x12,0x33,0x02,0x8a,0xaa,
 0xa5,0xff,0x00,0xf0,0x15,0x20,0xe9,0x99,0xb0,0x01,0xa0,0xd6,0x66,0xb0,0x00,0x00,
 0xc2,0x22,0xb0,0x3b,0x90,0xe9,0x99,0x90,0x00,0xb0,0xb1,0x94,0xb2,0x00,0xb0,0xb0,
 0x4d,0x20,0x00,0xb3,0xe9,0x31,0xb1,0x09,0xa6,0x63,0x01,0x53,0x04,0xaa,0xaa,0xca,
-0x00,0x3b,0x02,0xf1,0x0c,0x01,0x10,0x0a,0x00,0x66,0x09,0x30,0x03,0x88,0xad,0xae,
+0x00,0x3b,0x02,0xf2,0x20,0x01,0x10,0x0a,0x00,0x66,0x09,0x30,0x03,0x88,0xad,0xae,
 0xa5,0x00,0x02,0x50,0xb0,0x70,0x2a,0xb3,0x70,0xb0,0xb0,0x00,0xb3,0xc9,0xe9,0xe0,
-0x9a,0x5f,0xe2,0x00,0xb0,0x2d,0x10,0x00,0x08,0xb6,0xc3,0x00,0x00,0x28,0x05,0xaa,
-0xaa,0x19,0x0f,0xf0,0x08,0x08,0x00,0x72,0xb0,0x00,0x02,0x92,0xda,0xea,0xa2,0x00,
-0x03,0x20,0xb0,0x00,0x2b,0x85,0x9e,0xae,0x96,0x00,0xb0,0x1a,0x6c,0x0c,0x81,0x85,
-0x0a,0x08,0x00,0xb8,0x80,0x0c,0xb7,0x75,0x55,0x57,0x29,0x03,0xaa,0xab,0xda,0xd9,
-0x30,0xf0,0x15,0x12,0x9a,0x9c,0xa0,0x02,0xa0,0x18,0xa9,0x00,0x00,0x03,0xb8,0xd9,
-0xc0,0x4a,0x83,0xc8,0xd8,0xd0,0x00,0xb3,0x81,0xb1,0xa0,0x00,0xb3,0xb6,0xc6,0xc0,
-0x00,0xc3,0x70,0xa5,0xc0,0x0a,0x97,0xa0,0x00,0x42,0x05,0xba,0x9a,0xc6,0x0c,0x03,
-0xf0,0x02,0x01,0x11,0xc1,0x10,0x05,0x85,0x66,0xd6,0x63,0x00,0x04,0xb9,0xe9,0xc0,
-0x4a,0x95,0x50,0x9b,0x00,0xf7,0x08,0x9c,0xfa,0x90,0x00,0xb0,0x2b,0xdb,0x20,0x00,
-0xb5,0xc1,0xb1,0xc1,0x06,0xd6,0x00,0x90,0x10,0x48,0x08,0xaa,0x9a,0xb6,0x69,0x00,
-0xf0,0x11,0x25,0xbd,0x9e,0xb5,0x01,0xa5,0x48,0x0c,0x45,0x00,0x03,0x9d,0xa9,0x93,
-0x4a,0xb0,0x3e,0x99,0x80,0x00,0xb4,0xa4,0x04,0x70,0x00,0xb1,0x07,0xab,0x00,0x00,
-0xb0,0x6c,0x4f,0x1b,0x84,0x72,0x00,0x00,0x65,0x06,0xbb,0xab,0xc9,0x09,0x01,0xf0,
-0x04,0x02,0x10,0x0a,0x00,0x56,0x0b,0x20,0x04,0x86,0x8a,0xd8,0x85,0x00,0x00,0x9b,
-0xc9,0x60,0x4c,0x80,0xda,0x07,0xa0,0xb0,0xd8,0x88,0xb0,0x00,0xb0,0xd7,0x77,0xb0,
-0x00,0x0a,0x00,0x21,0x09,0xa5,0xa0,0x00,0x04,0x09,0x01,0x00,0xca,0x67,0xf0,0x08,
-0x70,0x0a,0x35,0x98,0x73,0x60,0x00,0x90,0xb1,0x95,0x70,0x00,0x00,0xa6,0x57,0x40,
-0x2b,0xb6,0x85,0xc5,0x50,0x00,0xb6,0xc5,0x08,0xb1,0xb1,0x80,0xb0,0xa0,0x00,0xc1,
-0xd9,0xe9,0xe0,0x09,0xb7,0x76,0x02,0x14,0xba,0x6e,0x00,0x12,0x13,0x20,0x2a,0xf3,
-0x1a,0x8b,0xba,0x0b,0xba,0xc7,0x82,0x66,0x02,0x90,0xb0,0x82,0xb0,0x16,0xc7,0xc6,
-0x84,0xa0,0x03,0x33,0x33,0x82,0x74,0x0a,0xaa,0xb6,0x82,0x19,0x0b,0x00,0x47,0x86,
-0x97,0x0b,0xaa,0xc7,0x83,0x10,0x0b,0x00,0x46,0x82,0x1f,0x42,0xf1,0x1d,0xdd,0xa6,
-0xbb,0xd0,0x00,0x88,0x00,0x00,0xa0,0x2c,0xcc,0xb0,0x00,0xa0,0x26,0x66,0x95,0xaa,
-0xe0,0x2a,0x48,0xb7,0x30,0x60,0x29,0x22,0xa7,0x30,0x00,0x2a,0x66,0xb7,0x30,0x33,
-0x2c,0x99,0xb7,0x30,0x55,0x26,0x00,0x93,0xbb,0xc1,0x22,0x55,0x80,0x08,0xbb,0xbb,
-0xb9,0x60,0x01,0x30,0x62,0xff,0x0d,0x73,0x57,0x08,0x50,0x00,0x62,0x27,0x1a,0xf9,
-0x1b,0xf0,0x06,0x04,0xdd,0xa0,0x00,0x00,0x4b,0x39,0x6a,0x00,0x1a,0xa0,0x39,0x05,
-0xd4,0x15,0x00,0x39,0x00,0x24,0x00,0x25,0xea,0x2f,0xf3,0x13,0xd4,0x5d,0xab,0xd0,
-0x34,0xa7,0x18,0x3a,0x40,0x06,0xa5,0x02,0xf8,0x00,0x5a,0xea,0x9b,0x28,0xc2,0x05,
-0xf5,0x31,0xa1,0x30,0x1b,0xa8,0x37,0xd7,0x50,0x83,0xa0,0x7a,0xea,0xa1,0xba,0x4e,
-0x21,0x00,0xb0,0x9c,0x36,0xf1,0x11,0x20,0x03,0x99,0xac,0x75,0x20,0x19,0x99,0xad,
-0x99,0x96,0x00,0x55,0x7b,0x55,0x30,0x02,0xa3,0x5a,0x34,0xa0,0x02,0xc7,0x9c,0x78,
-0xa0,0x01,0x97,0x9c,0x78,0x70,0x04,0x36,0x3e,0x00,0x28,0x2d,0x11,0x29,0x23,0x00,
-0xf1,0x09,0xd7,0x77,0x7a,0x60,0x00,0xd6,0x66,0x69,0x60,0x00,0x87,0x77,0x78,0x30,
-0x18,0x88,0x88,0x88,0x86,0x02,0xb7,0x8c,0x77,0xb0,0x05,0x00,0xa1,0x01,0x77,0x8c,
-0x77,0x50,0x03,0x88,0x9c,0x88,0x70,0x2d,0x00,0xf1,0x0a,0x0a,0x1a,0x03,0xc8,0x84,
-0x0a,0x1a,0x2a,0x43,0x10,0x0a,0x1a,0x34,0x2c,0x30,0x03,0x0b,0xbb,0x63,0x40,0x2b,
-0x9c,0x99,0xa9,0x96,0x54,0x24,0xe2,0x03,0x99,0x9c,0x8b,0x70,0x00,0x47,0x28,0x1b,
-0x00,0x1a,0xac,0xbd,0xcc,0x02,0x03,0x20,0x09,0x41,0x9a,0x0b,0x10,0x77,0x02,0x35,
-0xb9,0xa8,0x33,0xc3,0x30,0x00,0xb0,0x67,0xd7,0x71,0x5a,0xea,0x22,0x50,0x21,0x01,
-0xdb,0x89,0x67,0x00,0x3e,0x03,0x10,0x41,0x28,0x00,0xf1,0x0f,0x77,0x34,0xd4,0x40,
-0x3a,0xa9,0x94,0xc4,0xc0,0x00,0xb0,0x90,0xb0,0xa0,0x25,0xc5,0xa0,0xb0,0xa0,0x36,
-0xd6,0xab,0xeb,0xe0,0x00,0xb0,0x10,0xb0,0x10,0x00,0x2d,0x00,0x10,0x70,0xe1,0x28,
-0x01,0xd5,0x53,0xb0,0x54,0x7b,0xea,0xd0,0x4a,0x55,0x01,0x90,0xb0,0x29,0xa7,0x15,
-0x43,0x80,0xa0,0x6b,0xc9,0xb0,0x3a,0xea,0x18,0x52,0xf4,0x13,0xf2,0x02,0x22,0x90,
-0x00,0xa1,0x0a,0x03,0x80,0x00,0xdc,0x0b,0x04,0x60,0x04,0xa3,0xbe,0xbd,0xd6,0xc1,
-0x02,0xf0,0x2c,0x40,0x42,0xa0,0x60,0x3a,0x77,0x28,0xa3,0x60,0x39,0xa9,0x5b,0xba,
-0xc0,0x00,0xa0,0x63,0x70,0xb0,0x2a,0xea,0x73,0xb0,0xb0,0x00,0xb0,0x63,0xb0,0xb0,
-0x00,0xa1,0x65,0xb0,0xa0,0x01,0xea,0x3b,0x4b,0x50,0x04,0x41,0x91,0x00,0x64,0x07,
-0x30,0x0a,0x0a,0x00,0x3b,0x88,0x4d,0x7d,0x71,0x2a,0xa9,0x3c,0x4c,0x41,0x7d,0x3d,
-0x90,0x62,0x27,0xd7,0x39,0x99,0x70,0x13,0xc3,0x45,0x3e,0x12,0xf6,0x2b,0x4c,0x99,
-0xb0,0x00,0xdb,0x46,0x11,0xb0,0x03,0x70,0x4b,0x88,0xa0,0x08,0x02,0x52,0x87,0x30,
-0x6b,0xa2,0x92,0x87,0x90,0x76,0x50,0x76,0xaa,0xc0,0x0a,0x33,0xb6,0xba,0x70,0x4b,
-0x71,0x65,0xaa,0x50,0x3b,0x57,0xa1,0x66,0x10,0x08,0x11,0xb8,0xbb,0x80,0x09,0xb7,
-0xd4,0x54,0x00,0x0a,0x3b,0x08,0xaa,0xa0,0xbd,0x06,0xf2,0x1e,0x06,0x50,0x36,0xb9,
-0x62,0x1c,0xa9,0x19,0x45,0x71,0x47,0x54,0x6a,0x9a,0x94,0x03,0xc2,0x29,0x77,0x91,
-0x27,0xd7,0x4a,0x66,0xb2,0x01,0xb1,0x4b,0x88,0xc2,0x00,0xb2,0x05,0x5a,0x00,0x00,
-0xeb,0x0a,0x1a,0x06,0x04,0x82,0xb5,0x09,0x97,0x35,0x00,0x10,0x55,0x4d,0x5f,0x80,
-0x55,0x05,0xb3,0x00,0x00,0x55,0x86,0x00,0x76,0x45,0x40,0xaa,0xa6,0x00,0x66,0xad,
-0x48,0xe1,0x55,0x03,0xa0,0x00,0x00,0x55,0x01,0x7a,0x20,0x00,0x7d,0xb6,0x05,0xd7,
-0xb0,0x0d,0x10,0x20,0xf0,0x67,0x51,0x5b,0xbb,0xbe,0x19,0x10,0xaf,0x33,0x0f,0x04,
-0x00,0x04,0x30,0x05,0xbb,0x30,0x03,0x5b,0xf0,0x0f,0x5a,0xaa,0xae,0x05,0x00,0x04,
+0x00,0xb0,0x05,0x70,0x00,0x00,0xb0,0x2d,0x10,0x00,0x08,0xb6,0xc3,0x00,0x00,0x28,
+0x05,0xaa,0xaa,0xc8,0x9a,0x01,0xf3,0x1b,0x00,0x72,0xb0,0x00,0x02,0x92,0xda,0xea,
+0xa2,0x00,0x03,0x20,0xb0,0x00,0x2b,0x85,0x9e,0xae,0x96,0x00,0xb0,0x1a,0x0a,0x00,
+0x00,0xb0,0x85,0x0a,0x08,0x00,0xb8,0x80,0x0c,0xb7,0x07,0xb7,0x00,0x00,0x00,0x29,
+0x03,0xaa,0x68,0x01,0x02,0xa0,0x00,0xf0,0x15,0x12,0x9a,0x9c,0xa0,0x02,0xa0,0x18,
+0xa9,0x00,0x00,0x03,0xb8,0xd9,0xc0,0x4a,0x83,0xc8,0xd8,0xd0,0x00,0xb3,0x81,0xb1,
+0xa0,0x00,0xb3,0xb6,0xc6,0xc0,0x00,0xc3,0x70,0xa5,0xc0,0x0a,0x97,0xa0,0x00,0x42,
+0x05,0xba,0x9a,0xc6,0x0c,0x03,0xf0,0x02,0x01,0x11,0xc1,0x10,0x05,0x85,0x66,0xd6,
+0x63,0x00,0x04,0xb9,0xe9,0xc0,0x4a,0x95,0x50,0x9b,0x00,0xf7,0x08,0x9c,0xfa,0x90,
+0x00,0xb0,0x2b,0xdb,0x20,0x00,0xb5,0xc1,0xb1,0xc1,0x06,0xd6,0x00,0x90,0x10,0x48,
+0x08,0xaa,0x9a,0xb6,0x69,0x00,0xf4,0x1d,0x25,0xbd,0x9e,0xb5,0x01,0xa5,0x48,0x0c,
+0x45,0x00,0x03,0x9d,0xa9,0x93,0x4a,0xb0,0x3e,0x99,0x80,0x00,0xb4,0xa4,0x04,0x70,
+0x00,0xb1,0x07,0xab,0x00,0x00,0xb0,0x6c,0x90,0x00,0x0b,0xa9,0x72,0x00,0x00,0x65,
+0x06,0xbb,0xab,0xc9,0x09,0x01,0xf0,0x12,0x02,0x10,0x0a,0x00,0x56,0x0b,0x20,0x04,
+0x86,0x8a,0xd8,0x85,0x00,0x00,0x9b,0xc9,0x60,0x4c,0x80,0xb0,0x00,0xb0,0x01,0xb0,
+0xd8,0x88,0xb0,0x00,0xb0,0xd7,0x77,0xb0,0x00,0x0a,0x00,0x21,0x09,0xa5,0xa0,0x00,
+0x04,0x09,0x01,0xf1,0x1b,0x00,0x00,0x01,0x35,0x70,0x0a,0x35,0x98,0x73,0x60,0x00,
+0x90,0xb1,0x95,0x70,0x00,0x00,0xa6,0x57,0x40,0x2b,0xb6,0x85,0xc5,0x50,0x00,0xb6,
+0x99,0xe9,0x95,0x00,0xb1,0x80,0xb0,0xa0,0x00,0xc1,0xd9,0xe9,0xe0,0x09,0xb7,0x76,
+0x02,0x14,0xba,0x6e,0x00,0x10,0x13,0x05,0x00,0xf2,0x1c,0x1a,0x00,0x8b,0xba,0x0b,
+0xba,0xc7,0x82,0x66,0x02,0x90,0xb0,0x82,0xb0,0x16,0xc7,0xc6,0x84,0xa0,0x03,0x33,
+0x33,0x82,0x74,0x0a,0xaa,0xb6,0x82,0x19,0x0b,0x00,0x47,0x86,0x97,0x0b,0xaa,0xc7,
+0x83,0x10,0x0b,0x00,0x46,0x82,0x36,0x00,0xf0,0x1e,0x4a,0xdd,0xa6,0xbb,0xd0,0x00,
+0x88,0x00,0x00,0xa0,0x2c,0xcc,0xb0,0x00,0xa0,0x26,0x66,0x95,0xaa,0xe0,0x2a,0x48,
+0xb7,0x30,0x60,0x29,0x22,0xa7,0x30,0x00,0x2a,0x66,0xb7,0x30,0x33,0x2c,0x99,0xb7,
+0x30,0x55,0x26,0x00,0x93,0xbb,0xc1,0x74,0x02,0xf0,0x49,0x20,0x08,0xbb,0xbb,0xb9,
+0x60,0x01,0x30,0x62,0x01,0x90,0x00,0xc0,0x57,0x08,0x50,0x00,0x62,0x27,0x1a,0x00,
+0x1b,0xbb,0xce,0xbb,0xb6,0x00,0x04,0xdd,0xa0,0x00,0x00,0x4b,0x39,0x6a,0x00,0x1a,
+0xa0,0x39,0x05,0xd4,0x15,0x00,0x39,0x00,0x24,0x00,0x25,0x00,0x00,0x00,0x49,0xd4,
+0x5d,0xab,0xd0,0x34,0xa7,0x18,0x3a,0x40,0x06,0xa5,0x02,0xf8,0x00,0x5a,0xea,0x9b,
+0x28,0xc2,0x05,0xf5,0x31,0xa1,0x30,0x1b,0xa8,0x37,0xd7,0x50,0x83,0xa0,0x7a,0xea,
+0xa1,0x00,0xa0,0xc0,0x02,0x11,0xa0,0xb3,0x04,0xf0,0x17,0x01,0x24,0x20,0x03,0x99,
+0xac,0x75,0x20,0x19,0x99,0xad,0x99,0x96,0x00,0x55,0x7b,0x55,0x30,0x02,0xa3,0x5a,
+0x34,0xa0,0x02,0xc7,0x9c,0x78,0xa0,0x01,0x97,0x9c,0x78,0x70,0x04,0x99,0xad,0x99,
+0x90,0x2f,0x04,0x21,0x00,0x29,0x23,0x00,0xf1,0x09,0xd7,0x77,0x7a,0x60,0x00,0xd6,
+0x66,0x69,0x60,0x00,0x87,0x77,0x78,0x30,0x18,0x88,0x88,0x88,0x86,0x02,0xb7,0x8c,
+0x77,0xb0,0x05,0x00,0xa1,0x01,0x77,0x8c,0x77,0x50,0x03,0x88,0x9c,0x88,0x70,0x2d,
+0x00,0xf2,0x1e,0x0a,0x1a,0x03,0xc8,0x84,0x0a,0x1a,0x2a,0x43,0x10,0x0a,0x1a,0x34,
+0x2c,0x30,0x03,0x0b,0xbb,0x63,0x40,0x2b,0x9c,0x99,0xa9,0x96,0x00,0x00,0x39,0x00,
+0x00,0x03,0x99,0x9c,0x8b,0x70,0x00,0x47,0x28,0x1b,0x00,0x1a,0xac,0xbd,0xcc,0xa5,
+0xcf,0x03,0xf0,0x06,0x41,0x00,0xb0,0x00,0x5a,0x77,0x00,0xb0,0x00,0x4a,0xa8,0x33,
+0xc3,0x30,0x00,0xb0,0x67,0xd7,0x71,0x5a,0xea,0xaa,0x00,0x14,0xb0,0x05,0x00,0x70,
+0x01,0xdb,0x10,0xb0,0x00,0x04,0x80,0x3e,0x03,0x10,0x41,0x28,0x00,0xf1,0x0f,0x77,
+0x34,0xd4,0x40,0x3a,0xa9,0x94,0xc4,0xc0,0x00,0xb0,0x90,0xb0,0xa0,0x25,0xc5,0xa0,
+0xb0,0xa0,0x36,0xd6,0xab,0xeb,0xe0,0x00,0xb0,0x10,0xb0,0x10,0x00,0x2d,0x00,0x60,
+0x70,0x00,0xb0,0x00,0x02,0x10,0x85,0x04,0xf2,0x1d,0x54,0x7b,0xea,0xd0,0x4a,0x55,
+0x01,0x90,0xb0,0x29,0xa7,0x03,0x70,0xb0,0x00,0xa0,0x6b,0xc9,0xb0,0x3a,0xea,0x18,
+0x52,0xa0,0x00,0xb0,0x09,0x22,0x90,0x00,0xa1,0x0a,0x03,0x80,0x00,0xdc,0x0b,0x04,
+0x60,0x04,0xa3,0xbe,0xbd,0xd6,0xc1,0x02,0xf6,0x77,0x40,0x42,0xa0,0x60,0x3a,0x77,
+0x28,0xa3,0x60,0x39,0xa9,0x5b,0xba,0xc0,0x00,0xa0,0x63,0x70,0xb0,0x2a,0xea,0x73,
+0xb0,0xb0,0x00,0xb0,0x63,0xb0,0xb0,0x00,0xa1,0x65,0xb0,0xa0,0x01,0xea,0x3b,0x4b,
+0x50,0x04,0x41,0x91,0x00,0x64,0x07,0x30,0x0a,0x0a,0x00,0x3b,0x88,0x4d,0x7d,0x71,
+0x2a,0xa9,0x3c,0x4c,0x41,0x00,0xa0,0x56,0x66,0x62,0x27,0xd7,0x39,0x99,0x70,0x13,
+0xc3,0x45,0x00,0xb0,0x00,0xa0,0x4c,0x99,0xb0,0x00,0xdb,0x46,0x11,0xb0,0x03,0x70,
+0x4b,0x88,0xa0,0x08,0x02,0x52,0x87,0x30,0x6b,0xa2,0x92,0x87,0x90,0x76,0x50,0x76,
+0xaa,0xc0,0x0a,0x33,0xb6,0xba,0x70,0x4b,0x71,0x65,0xaa,0x50,0x3b,0x57,0xa1,0x66,
+0x10,0x08,0x11,0xb8,0xbb,0x80,0x09,0xb7,0xd4,0x54,0x00,0x0a,0x3b,0x08,0xaa,0xa0,
+0xbd,0x06,0xf2,0x1e,0x06,0x50,0x36,0xb9,0x62,0x1c,0xa9,0x19,0x45,0x71,0x47,0x54,
+0x6a,0x9a,0x94,0x03,0xc2,0x29,0x77,0x91,0x27,0xd7,0x4a,0x66,0xb2,0x01,0xb1,0x4b,
+0x88,0xc2,0x00,0xb2,0x05,0x5a,0x00,0x00,0xeb,0x0a,0x1a,0x06,0x04,0x82,0xb5,0x09,
+0x97,0x35,0x00,0xf0,0x1d,0x55,0x00,0x09,0x30,0x00,0x55,0x05,0xb3,0x00,0x00,0x55,
+0x86,0x00,0x00,0x2a,0xcc,0xaa,0xaa,0xa6,0x00,0x66,0x0b,0x10,0x00,0x00,0x55,0x03,
+0xa0,0x00,0x00,0x55,0x01,0x7a,0x20,0x00,0x7d,0xb6,0x05,0xd7,0x00,0x32,0x00,0x00,
+0x01,0x53,0x06,0xaf,0x58,0x5b,0xbb,0xbe,0x19,0x10,0x00,0x0b,0xb0,0x00,0x04,0x00,
+0x05,0xf0,0x16,0x05,0xbb,0x30,0x00,0x00,0x00,0x76,0x5a,0xaa,0xae,0x05,0x00,0x04,
 0x0b,0xa0,0x00,0x1a,0x0b,0xb6,0xbb,0xee,0x9b,0xb0,0x05,0xca,0x0b,0xb0,0x7a,0x1a,
-0x0b,0xb9,0x50,0x1a,0x0b,0xb0,0x08,0xb6,0x2c,0x00,0x10,0x6c,0x28,0x00,0x40,0x77,
-0x5a,0xaa,0xae,0xfc,0x58,0x72,0xa0,0x68,0x86,0x0b,0xb0,0xa1,0x1b,0xa7,0x55,0x63,
-0xb9,0x9b,0x0b,0xb0,0x71,0x11,0x50,0x00,0x24,0x01,0xbb,0x98,0x06,0xa5,0x04,0x75,
-0xbb,0xbb,0xe1,0x0a,0x10,0x10,0x09,0x19,0xf5,0x52,0xf4,0x04,0x00,0xbe,0x50,0x91,
-0xb0,0x94,0xa9,0x39,0x1b,0x74,0x0a,0x05,0x91,0xb0,0x00,0xa0,0x09,0x1b,0x00,0xb6,
-0x5c,0x10,0x30,0xbe,0x6b,0x30,0x6b,0xbb,0xbe,0x93,0x49,0xb6,0xa0,0x89,0x99,0x0c,
-0xb0,0xa0,0x0a,0x0c,0xb0,0xc9,0x9d,0x08,0x00,0x02,0x4e,0x57,0x11,0x7c,0x8b,0x09,
-0xf5,0x19,0xad,0x2d,0xaa,0xd0,0xb2,0x92,0x80,0x0a,0x0b,0x83,0x2d,0xaa,0xe0,0xb4,
-0x82,0x80,0x0a,0x0b,0x0b,0x39,0x00,0xb0,0xb0,0xc4,0xdb,0xbe,0x0b,0x75,0x64,0x00,
-0xa0,0xb0,0x0b,0x10,0x0a,0x0b,0x04,0x70,0x0a,0xa0,0x1e,0x68,0xf1,0x04,0x0e,0xbe,
-0x02,0xe2,0x00,0xb3,0x80,0x94,0xa0,0x0b,0x91,0x79,0x04,0xb1,0xb8,0x49,0x30,0x34,
-0x4b,0xb7,0x54,0x50,0xc0,0xb0,0xa0,0x0b,0x95,0x09,0x00,0x86,0x05,0x80,0xa0,0x0b,
-0x00,0xb1,0x0a,0x00,0x32,0x00,0xf0,0x10,0xae,0x00,0x94,0x00,0xb4,0x8c,0xaa,0xaa,
-0xab,0xb1,0x90,0x00,0x0a,0xb8,0x50,0xb0,0x05,0x0b,0x0b,0x0c,0x4b,0x80,0xb0,0xc0,
-0xd7,0x10,0x0b,0xa5,0x0b,0x00,0x01,0x96,0x0e,0x50,0xab,0x00,0x08,0xbb,0xb4,0xed,
-0x00,0xf0,0x1a,0x0e,0xba,0x0c,0x00,0xa0,0xa6,0x54,0x80,0x0a,0x0a,0xb1,0xd6,0xaa,
-0xea,0xaa,0x8b,0x52,0x0a,0x0a,0x28,0x65,0xa1,0xa0,0xa2,0xa6,0x53,0x7a,0x0b,0x92,
-0x65,0x00,0xa0,0xa0,0x06,0x50,0x0a,0x0a,0x00,0x54,0x0a,0xc0,0xec,0x35,0xf0,0x11,
-0x0e,0xbb,0x0c,0xa9,0x70,0xa6,0x6a,0xb0,0x96,0x0a,0xc0,0x33,0xe9,0x00,0xaa,0x38,
-0x95,0x89,0x4a,0x0a,0x8a,0xda,0xa3,0xb8,0xa6,0x09,0x10,0x0a,0x20,0xda,0xda,0xa6,
-0x97,0x64,0x10,0x0a,0xe4,0x68,0x05,0x01,0x00,0xf5,0x1a,0x0e,0xac,0x8b,0xaa,0xc0,
-0xa2,0x88,0x20,0x0b,0x0a,0x82,0x8a,0x99,0xc0,0xa7,0x48,0x20,0x0b,0x0a,0x0a,0x8b,
-0xda,0x80,0xa0,0xb8,0x28,0x2a,0x2a,0x84,0x82,0x1e,0x20,0xa0,0x08,0x45,0x87,0x0a,
-0x00,0xaa,0x50,0x85,0x20,0x2f,0xf5,0x1a,0x0e,0xba,0x02,0xd4,0x00,0xa6,0x51,0xa1,
-0xa4,0x0a,0xb2,0xc4,0x12,0xb5,0xab,0x13,0x8d,0x94,0x0a,0x29,0x33,0xc3,0x31,0xa1,
-0xb7,0x7d,0x77,0x3c,0x93,0x73,0xb2,0x90,0xa0,0x2b,0x0b,0x08,0x4a,0x01,0x18,0xc0,
-0x01,0x8b,0x59,0xf1,0x15,0x0e,0xbb,0x0b,0x20,0x00,0xa5,0x62,0xda,0xb9,0x0a,0xb1,
-0xb1,0x0a,0x20,0xaa,0x64,0x53,0x50,0x0a,0x19,0xb4,0x49,0xe0,0xb4,0xab,0x43,0x4c,
-0x0a,0x51,0xb3,0x23,0xc0,0xa0,0x0c,0x99,0x9e,0x70,0x23,0x00,0x5a,0x02,0xf1,0x1a,
-0x0e,0xc9,0x14,0x97,0x42,0xa7,0x49,0x5d,0x55,0x2a,0x90,0x27,0xd9,0xa0,0xa9,0x58,
-0x8b,0x5b,0x1a,0x45,0xa0,0xa3,0xa1,0xa4,0x6a,0x0c,0x8d,0x1a,0xa1,0xa0,0x90,0x91,
-0xa0,0x2b,0x55,0x26,0x0a,0x08,0x06,0xaa,0xb5,0xbe,0x00,0xf0,0x18,0xb9,0x9a,0xaa,
-0xa5,0xa7,0x45,0x88,0x89,0x0a,0xb0,0x73,0x22,0xb0,0xaa,0x23,0x66,0x66,0x0a,0x18,
-0xbb,0x9a,0xb5,0xa5,0x99,0x53,0x95,0x5b,0x61,0x97,0xc8,0x75,0xa0,0x09,0x0a,0x05,
-0x5a,0x00,0x90,0xa1,0xdc,0x5c,0x03,0x0b,0x02,0xf6,0x1a,0x0d,0xab,0x89,0xe9,0x93,
-0x09,0x55,0x09,0x09,0x20,0x09,0xb2,0x99,0x99,0x96,0x09,0x84,0x78,0x88,0xb0,0x09,
-0x0a,0x88,0x77,0xd0,0x0a,0x68,0x78,0x97,0xb0,0x0a,0x32,0x88,0xd8,0x86,0x09,0x00,
-0x11,0xb1,0x11,0x09,0x4e,0x40,0xf1,0x4c,0x33,0x15,0x00,0x00,0x00,0xd9,0x8d,0x88,
-0x60,0x0a,0xb3,0x4c,0x33,0x20,0x38,0xc6,0x6d,0x66,0x20,0x01,0xd8,0x8d,0x88,0x30,
-0x01,0xd7,0x8d,0x77,0x71,0x01,0x63,0x68,0x33,0x30,0x29,0x9b,0xff,0xc9,0x96,0x01,
-0x7a,0x67,0x8a,0x30,0x2a,0x40,0x46,0x02,0x86,0x03,0x88,0x8e,0x88,0x80,0x00,0xb8,
-0x88,0xe8,0x88,0x80,0x09,0x57,0x3b,0x57,0x49,0x00,0x07,0x74,0x86,0x75,0x00,0x00,
-0x27,0xa9,0xa5,0x00,0x02,0xb9,0x31,0x90,0x5a,0xa0,0x00,0x88,0x88,0x9e,0x60,0x00,
-0x00,0x69,0x6b,0xd1,0x0a,0x10,0xa4,0xe6,0x04,0xf3,0x1b,0xac,0x99,0x80,0x0b,0x88,
-0x9c,0x88,0x95,0x0a,0x67,0x58,0x77,0x66,0x01,0x77,0x58,0x77,0x40,0x08,0x88,0x89,
-0x88,0x84,0x02,0x22,0x77,0x22,0x21,0x05,0xba,0xc9,0xd9,0xd0,0x05,0x62,0x80,0xa0,
-0xb0,0x05,0x62,0x80,0xa5,0xe8,0x21,0xf1,0x49,0x88,0x9d,0x88,0x80,0x0c,0x88,0x9d,
-0x88,0x88,0x09,0x67,0x49,0x67,0x48,0x00,0x66,0x47,0x66,0x40,0x06,0xa8,0x88,0x88,
-0x84,0x07,0x67,0x77,0x77,0x70,0x08,0x9e,0x8b,0xb8,0xc4,0x0c,0x0c,0x13,0x8c,0x70,
-0x35,0x3a,0x85,0x01,0x55,0x28,0xd9,0x72,0xc8,0x30,0x05,0xb6,0x39,0x1b,0x10,0x15,
-0xb6,0x6c,0xbd,0xa0,0x36,0x66,0x60,0x91,0xa0,0x0c,0x8a,0x99,0xda,0xe6,0x0c,0x89,
-0x74,0xb5,0xc0,0x0c,0x8a,0x74,0xb6,0x90,0x0a,0x03,0x70,0x91,0x00,0x0a,0x1a,0x57,
-0xc0,0x70,0x43,0x61,0x00,0x4b,0xbe,0x1a,0xbb,0xa0,0x0a,0x00,0x51,0x2b,0xbe,0x1a,
-0xbb,0x80,0x0a,0x00,0xa1,0x11,0x1b,0x1a,0x31,0x10,0x59,0x9d,0x1a,0xa9,0x91,0x0f,
-0x00,0x01,0x05,0x00,0x03,0x9c,0x52,0x10,0x75,0x09,0x28,0xf0,0x0e,0xdb,0xba,0xb1,
-0x0b,0x08,0x10,0xa0,0x92,0x0b,0x08,0xa9,0xc0,0x92,0x0b,0x08,0x64,0xb0,0x92,0x0b,
-0x08,0x53,0xb0,0x92,0x0b,0xad,0xba,0xea,0xd2,0x0b,0x7c,0x0d,0x10,0x24,0xd0,0x55,
-0xf3,0x14,0x46,0xc5,0x7b,0xeb,0xb1,0x4b,0xeb,0x00,0xb0,0x00,0x67,0x4c,0x3a,0xea,
-0x80,0x67,0x4c,0x13,0xc3,0x31,0x4a,0xd9,0x47,0xd7,0xb4,0x7a,0xd9,0x20,0xb0,0x73,
-0x01,0xa0,0x00,0xb5,0xa0,0x7f,0x3d,0x10,0x24,0x85,0x20,0x10,0xbe,0x85,0x20,0x00,
-0x34,0x35,0x9c,0x3d,0x43,0xa7,0x32,0x17,0x77,0x77,0x77,0x74,0x8a,0x20,0x05,0x0a,
-0x00,0x00,0xb4,0x24,0x11,0xa5,0x63,0x6e,0xd0,0x01,0xdb,0xcb,0xbc,0x70,0x01,0xa0,
-0x15,0x04,0x80,0x01,0xa0,0x28,0x05,0x00,0xf2,0x08,0x38,0x04,0x80,0x01,0x70,0xa5,
-0x63,0x50,0x00,0x5b,0x50,0x5b,0x50,0x1a,0x61,0x00,0x00,0x72,0x6b,0xbb,0x8a,0xea,
-0xa3,0xfc,0x6d,0x70,0xb0,0x5b,0xaa,0xe0,0x00,0xb0,0x54,0x08,0x08,0x24,0x54,0xb0,
-0x05,0x00,0xf1,0x05,0x32,0xb0,0x70,0x01,0xb0,0x08,0x6b,0x40,0x39,0x40,0xa4,0x00,
-0x92,0x13,0x33,0xaa,0xea,0xa7,0x3a,0xe8,0x33,0x35,0x00,0xf9,0x0f,0xf0,0x0c,0xa0,
-0xa0,0x80,0xb0,0x00,0xa0,0xa0,0xb0,0xb0,0x00,0xc7,0xa0,0xb0,0xb0,0x4c,0x82,0x61,
-0xb0,0x70,0x00,0x00,0x1b,0x49,0x70,0x00,0x04,0xa2,0x1a,0x4c,0x01,0x1e,0x4d,0xf0,
-0x07,0xa8,0xae,0xa7,0x0a,0x72,0xa2,0x7a,0x41,0x0a,0x72,0xa9,0x65,0x95,0x0a,0x72,
-0xa9,0x09,0x55,0x0a,0x72,0xa9,0x0a,0x05,0x00,0xf2,0x02,0x19,0x55,0x19,0x72,0xa4,
-0x3b,0x22,0x46,0x41,0xa0,0x96,0xa0,0x72,0x00,0xaa,0x50,0x57,0x61,0x22,0x11,0x10,
-0xd6,0x6e,0xf7,0x1c,0xab,0xfa,0xa3,0x1b,0x40,0x02,0xa0,0x00,0x13,0x02,0xba,0xaa,
-0xd0,0x00,0xb3,0xb0,0x70,0xc0,0x2b,0x30,0xb0,0xb0,0xc0,0x01,0x05,0xb0,0xb0,0xc0,
-0x00,0x94,0x80,0xb0,0x80,0x1a,0x70,0x0a,0x3a,0x60,0x34,0x03,0xa3,0x00,0x65,0xe1,
-0x6d,0xf0,0x07,0xae,0x59,0xae,0x97,0x05,0x67,0x04,0x7b,0x51,0x03,0xd2,0x0b,0x66,
-0x95,0x6a,0xcd,0x8a,0x19,0x55,0x00,0xb4,0x7a,0x05,0x00,0xf2,0x30,0x0a,0x29,0x55,
-0x00,0xb0,0x04,0x57,0x32,0x00,0xb0,0x03,0xb4,0xb0,0x0a,0x90,0x69,0x10,0x37,0x02,
-0x45,0x08,0xae,0xa5,0x09,0x4c,0x80,0x19,0x00,0x0a,0x56,0x08,0xaa,0xb2,0x59,0xca,
-0x99,0x17,0x73,0x07,0x72,0x68,0x19,0x73,0x38,0x75,0x98,0x38,0x73,0x31,0x5d,0x15,
-0x66,0x41,0x02,0xb3,0x02,0xb5,0x90,0x38,0x10,0x38,0x10,0x35,0xdb,0x27,0xf6,0x1d,
-0x79,0x89,0xad,0x95,0x0c,0x79,0x84,0xaa,0x71,0x0c,0x8a,0x89,0x25,0x82,0x13,0x33,
-0x39,0x19,0x82,0x26,0xa7,0x59,0x38,0x82,0x0a,0x7a,0x77,0x66,0x71,0x0d,0x82,0x01,
-0xb4,0x90,0x1a,0xd3,0x3b,0x20,0x46,0x72,0x29,0x89,0x99,0x95,0xc8,0x71,0xf1,0x22,
-0x29,0xcb,0x98,0x9d,0x94,0x06,0x34,0x52,0x69,0x40,0x0a,0xbd,0x8a,0x46,0x92,0x1a,
+0x0b,0xb9,0x50,0x1a,0x0b,0xb0,0x08,0xb6,0x2c,0x00,0x10,0x6c,0x28,0x00,0xf3,0x0c,
+0x77,0x5a,0xaa,0xae,0x0a,0x00,0x00,0x0b,0xa0,0x68,0x86,0x0b,0xb0,0xa1,0x1b,0x0b,
+0xb0,0xa0,0x0b,0x0b,0xb0,0xb9,0x9b,0x0b,0xb0,0x71,0x11,0x50,0x00,0x24,0x01,0xbb,
+0x98,0x06,0xf3,0x1a,0x04,0x75,0xbb,0xbb,0xe1,0x0a,0x10,0x10,0x09,0x19,0x00,0x0a,
+0x00,0x91,0xb5,0x9a,0xe9,0x79,0x1b,0x00,0xbe,0x50,0x91,0xb0,0x94,0xa9,0x39,0x1b,
+0x74,0x0a,0x05,0x91,0xb0,0x00,0xa0,0x09,0x1b,0x00,0x00,0x0b,0xc0,0x38,0x07,0xf6,
+0x06,0x00,0x00,0x78,0x6b,0xbb,0xbe,0x06,0x00,0x00,0x0c,0xa0,0x89,0x99,0x0c,0xb0,
+0xa0,0x0a,0x0c,0xb0,0xc9,0x9d,0x08,0x00,0x20,0x00,0x00,0x04,0x00,0x10,0x7c,0x2c,
+0x00,0xf4,0x19,0x0e,0xad,0x2d,0xaa,0xd0,0xb2,0x92,0x80,0x0a,0x0b,0x83,0x2d,0xaa,
+0xe0,0xb4,0x82,0x80,0x0a,0x0b,0x0b,0x39,0x00,0xb0,0xb0,0xc4,0xdb,0xbe,0x0b,0x75,
+0x64,0x00,0xa0,0xb0,0x0b,0x10,0x0a,0x0b,0x04,0x70,0x0a,0x6c,0x01,0xf0,0x10,0x04,
+0x00,0x0e,0xbe,0x02,0xe2,0x00,0xb3,0x80,0x94,0xa0,0x0b,0x91,0x79,0x04,0xb1,0xb8,
+0x49,0x30,0x34,0x4b,0x0b,0x0b,0x0a,0x00,0xb0,0xc0,0xb0,0xa0,0x0b,0x95,0x09,0x00,
+0x86,0x05,0x80,0xa0,0x0b,0x00,0xb1,0x0a,0x00,0x32,0x00,0xf0,0x19,0xae,0x00,0x94,
+0x00,0xb4,0x8c,0xaa,0xaa,0xab,0xb1,0x90,0x00,0x0a,0xb8,0x50,0xb0,0x05,0x0b,0x0b,
+0x0c,0x4b,0x80,0xb0,0xc0,0xd7,0x10,0x0b,0xa5,0x0b,0x00,0x01,0xb0,0x00,0xc0,0x00,
+0xab,0x00,0x08,0xbb,0xb4,0xed,0x00,0xf6,0x46,0x0e,0xba,0x0c,0x00,0xa0,0xa6,0x54,
+0x80,0x0a,0x0a,0xb1,0xd6,0xaa,0xea,0xaa,0x8b,0x52,0x0a,0x0a,0x28,0x65,0xa1,0xa0,
+0xa2,0xa6,0x53,0x7a,0x0b,0x92,0x65,0x00,0xa0,0xa0,0x06,0x50,0x0a,0x0a,0x00,0x54,
+0x0a,0xc0,0x00,0x00,0x22,0x00,0x0e,0xbb,0x0c,0xa9,0x70,0xa6,0x6a,0xb0,0x96,0x0a,
+0xc0,0x33,0xe9,0x00,0xaa,0x38,0x95,0x89,0x4a,0x0a,0x8a,0xda,0xa3,0xb8,0xa6,0x09,
+0x10,0x0a,0x20,0xda,0xda,0xa6,0xa0,0x00,0x09,0x10,0x0a,0x00,0x00,0x91,0x44,0x05,
+0xf3,0x1a,0x0e,0xac,0x8b,0xaa,0xc0,0xa2,0x88,0x20,0x0b,0x0a,0x82,0x8a,0x99,0xc0,
+0xa7,0x48,0x20,0x0b,0x0a,0x0a,0x8b,0xda,0x80,0xa0,0xb8,0x28,0x2a,0x2a,0x84,0x82,
+0x1e,0x20,0xa0,0x08,0x45,0x87,0x0a,0x00,0xaa,0x50,0x85,0x30,0x00,0xf3,0x1c,0x03,
+0x00,0x0e,0xba,0x02,0xd4,0x00,0xa6,0x51,0xa1,0xa4,0x0a,0xb2,0xc4,0x12,0xb5,0xab,
+0x13,0x8d,0x94,0x0a,0x29,0x33,0xc3,0x31,0xa1,0xb7,0x7d,0x77,0x3c,0x93,0x73,0xb2,
+0x90,0xa0,0x2b,0x0b,0x08,0x4a,0x01,0x18,0xc0,0x01,0x32,0x00,0xf2,0x18,0x21,0x00,
+0x0e,0xbb,0x0b,0x20,0x00,0xa5,0x62,0xda,0xb9,0x0a,0xb1,0xb1,0x0a,0x20,0xaa,0x64,
+0x53,0x50,0x0a,0x19,0xb4,0x49,0xe0,0xb4,0xab,0x43,0x4c,0x0a,0x51,0xb3,0x23,0xc0,
+0xa0,0x0c,0x99,0x9e,0x0a,0x6a,0x04,0xf1,0x1c,0x01,0x20,0x0e,0xc9,0x14,0x97,0x42,
+0xa7,0x49,0x5d,0x55,0x2a,0x90,0x27,0xd9,0xa0,0xa9,0x58,0x8b,0x5b,0x1a,0x45,0xa0,
+0xa3,0xa1,0xa4,0x6a,0x0c,0x8d,0x1a,0xa1,0xa0,0x90,0x91,0xa0,0x2b,0x55,0x26,0x0a,
+0x08,0x06,0xaa,0xb5,0xbe,0x00,0xf4,0x1b,0xb9,0x9a,0xaa,0xa5,0xa7,0x45,0x88,0x89,
+0x0a,0xb0,0x73,0x22,0xb0,0xaa,0x23,0x66,0x66,0x0a,0x18,0xbb,0x9a,0xb5,0xa5,0x99,
+0x53,0x95,0x5b,0x61,0x97,0xc8,0x75,0xa0,0x09,0x0a,0x05,0x5a,0x00,0x90,0xa1,0xb3,
+0x00,0x00,0x43,0x09,0xf5,0x1b,0x0d,0xab,0x89,0xe9,0x93,0x09,0x55,0x09,0x09,0x20,
+0x09,0xb2,0x99,0x99,0x96,0x09,0x84,0x78,0x88,0xb0,0x09,0x0a,0x88,0x77,0xd0,0x0a,
+0x68,0x78,0x97,0xb0,0x0a,0x32,0x88,0xd8,0x86,0x09,0x00,0x11,0xb1,0x11,0x09,0x00,
+0xad,0x09,0xf1,0x4c,0x33,0x15,0x00,0x00,0x00,0xd9,0x8d,0x88,0x60,0x0a,0xb3,0x4c,
+0x33,0x20,0x38,0xc6,0x6d,0x66,0x20,0x01,0xd8,0x8d,0x88,0x30,0x01,0xd7,0x8d,0x77,
+0x71,0x01,0x63,0x68,0x33,0x30,0x29,0x9b,0xff,0xc9,0x96,0x01,0x7a,0x67,0x8a,0x30,
+0x2a,0x40,0x46,0x02,0x86,0x03,0x88,0x8e,0x88,0x80,0x00,0xb8,0x88,0xe8,0x88,0x80,
+0x09,0x57,0x3b,0x57,0x49,0x00,0x07,0x74,0x86,0x75,0x00,0x00,0x27,0xa9,0xa5,0x00,
+0x02,0xb9,0x31,0x90,0x5a,0xa0,0x00,0x88,0x88,0x9e,0x60,0x00,0x00,0x69,0x6b,0xd1,
+0x0a,0x10,0xa4,0xe6,0x04,0xf2,0x1c,0xac,0x99,0x80,0x0b,0x88,0x9c,0x88,0x95,0x0a,
+0x67,0x58,0x77,0x66,0x01,0x77,0x58,0x77,0x40,0x08,0x88,0x89,0x88,0x84,0x02,0x22,
+0x77,0x22,0x21,0x05,0xba,0xc9,0xd9,0xd0,0x05,0x62,0x80,0xa0,0xb0,0x05,0x62,0x80,
+0xa5,0xb0,0x89,0x01,0xf1,0x54,0x88,0x9d,0x88,0x80,0x0c,0x88,0x9d,0x88,0x88,0x09,
+0x67,0x49,0x67,0x48,0x00,0x66,0x47,0x66,0x40,0x06,0xa8,0x88,0x88,0x84,0x07,0x67,
+0x77,0x77,0x70,0x08,0x9e,0x8b,0xb8,0xc4,0x0c,0x0c,0x13,0x8c,0x70,0x35,0x3a,0x85,
+0x01,0x55,0x28,0xd9,0x72,0xc8,0x30,0x05,0xb6,0x39,0x1b,0x10,0x15,0xb6,0x6c,0xbd,
+0xa0,0x36,0x66,0x60,0x91,0xa0,0x0c,0x8a,0x99,0xda,0xe6,0x0c,0x89,0x74,0xb5,0xc0,
+0x0c,0x8a,0x74,0xb6,0x90,0x0a,0x03,0x70,0x91,0x00,0x0a,0x1a,0x57,0xc0,0x00,0x00,
+0x0a,0x1a,0x10,0x00,0x4b,0xbe,0x1a,0xbb,0xa0,0x0a,0x00,0x51,0x2b,0xbe,0x1a,0xbb,
+0x80,0x0a,0x00,0xa1,0x11,0x1b,0x1a,0x31,0x10,0x59,0x9d,0x1a,0xa9,0x91,0x0f,0x00,
+0x01,0x05,0x00,0xf0,0x19,0x1b,0xbb,0xdd,0xbb,0xb7,0x00,0x00,0x75,0x00,0x00,0x08,
+0xbb,0xdb,0xba,0xb1,0x0b,0x08,0x10,0xa0,0x92,0x0b,0x08,0xa9,0xc0,0x92,0x0b,0x08,
+0x64,0xb0,0x92,0x0b,0x08,0x53,0xb0,0x92,0x0b,0xad,0xba,0xea,0xd2,0x8d,0x0b,0xf2,
+0x1b,0x92,0x24,0xb3,0x00,0xb0,0x00,0x46,0xc5,0x7b,0xeb,0xb1,0x4b,0xeb,0x00,0xb0,
+0x00,0x67,0x4c,0x3a,0xea,0x80,0x67,0x4c,0x13,0xc3,0x31,0x4a,0xd9,0x47,0xd7,0xb4,
+0x7a,0xd9,0x20,0xb0,0x73,0x01,0xa0,0x00,0xb5,0xa0,0x01,0x76,0x06,0xf0,0x0c,0x24,
+0x00,0x00,0x06,0xaa,0xbe,0xaa,0xa1,0x00,0x18,0x00,0x29,0x00,0x03,0x3d,0x43,0xa7,
+0x32,0x17,0x77,0x77,0x77,0x74,0x00,0x8a,0xaa,0xaa,0x66,0x0a,0x76,0x06,0x50,0x00,
+0xc9,0x99,0x9c,0x50,0x0a,0x00,0x30,0x0a,0xaa,0xcd,0x23,0x09,0xf0,0x01,0x92,0x00,
+0x00,0x01,0xdb,0xcb,0xbc,0x70,0x01,0xa0,0x15,0x04,0x80,0x01,0xa0,0x28,0x05,0x00,
+0xf1,0x0a,0x38,0x04,0x80,0x01,0x70,0xa5,0x63,0x50,0x00,0x5b,0x50,0x5b,0x50,0x1a,
+0x61,0x00,0x00,0x72,0x6b,0xbb,0x8a,0xea,0xa3,0x00,0xc0,0x30,0x06,0x60,0x5b,0xaa,
+0xe0,0x00,0xb0,0x54,0x08,0x08,0x24,0x54,0xb0,0x05,0x00,0xf2,0x2b,0x32,0xb0,0x70,
+0x01,0xb0,0x08,0x6b,0x40,0x39,0x40,0xa4,0x00,0x92,0x13,0x33,0xaa,0xea,0xa7,0x3a,
+0xe8,0x00,0xc0,0x00,0x00,0xa0,0xaa,0xaa,0xe0,0x00,0xa0,0xa0,0x80,0xb0,0x00,0xa0,
+0xa0,0xb0,0xb0,0x00,0xc7,0xa0,0xb0,0xb0,0x4c,0x82,0x61,0xb0,0x70,0x00,0x00,0x1b,
+0x49,0x70,0x00,0x04,0xa2,0x00,0x66,0x9c,0x08,0xf0,0x08,0x00,0xa8,0xae,0xa7,0x0a,
+0x72,0xa2,0x7a,0x41,0x0a,0x72,0xa9,0x65,0x95,0x0a,0x72,0xa9,0x09,0x55,0x0a,0x72,
+0xa9,0x0a,0x05,0x00,0xf4,0x05,0x19,0x55,0x19,0x72,0xa4,0x3b,0x22,0x46,0x41,0xa0,
+0x96,0xa0,0x72,0x00,0xaa,0x50,0x57,0x00,0x00,0x01,0x71,0x0b,0xf6,0x1d,0xb4,0xab,
+0xfa,0xa3,0x1b,0x40,0x02,0xa0,0x00,0x13,0x02,0xba,0xaa,0xd0,0x00,0xb3,0xb0,0x70,
+0xc0,0x2b,0x30,0xb0,0xb0,0xc0,0x01,0x05,0xb0,0xb0,0xc0,0x00,0x94,0x80,0xb0,0x80,
+0x1a,0x70,0x0a,0x3a,0x60,0x34,0x03,0xa3,0x00,0x65,0xc6,0x03,0xf0,0x08,0x1a,0xae,
+0x59,0xae,0x97,0x05,0x67,0x04,0x7b,0x51,0x03,0xd2,0x0b,0x66,0x95,0x6a,0xcd,0x8a,
+0x19,0x55,0x00,0xb4,0x7a,0x05,0x00,0xf1,0x30,0x0a,0x29,0x55,0x00,0xb0,0x04,0x57,
+0x32,0x00,0xb0,0x03,0xb4,0xb0,0x0a,0x90,0x69,0x10,0x37,0x02,0x45,0x08,0xae,0xa5,
+0x09,0x4c,0x80,0x19,0x00,0x0a,0x56,0x08,0xaa,0xb2,0x59,0xca,0x99,0x17,0x73,0x07,
+0x72,0x68,0x19,0x73,0x38,0x75,0x98,0x38,0x73,0x31,0x5d,0x15,0x66,0x41,0x02,0xb3,
+0x02,0xb5,0x90,0x38,0x10,0x38,0x10,0x35,0x5f,0x00,0xf2,0x1e,0x0c,0x79,0x89,0xad,
+0x95,0x0c,0x79,0x84,0xaa,0x71,0x0c,0x8a,0x89,0x25,0x82,0x13,0x33,0x39,0x19,0x82,
+0x26,0xa7,0x59,0x38,0x82,0x0a,0x7a,0x77,0x66,0x71,0x0d,0x82,0x01,0xb4,0x90,0x1a,
+0xd3,0x3b,0x20,0x46,0x72,0x29,0x89,0x99,0x95,0x92,0x00,0x10,0x50,0x18,0x0a,0xf0,
+0x22,0xcb,0x98,0x9d,0x94,0x06,0x34,0x52,0x69,0x40,0x0a,0xbd,0x8a,0x46,0x92,0x1a,
 0x18,0x49,0x09,0x72,0x1b,0xa5,0x29,0x08,0x72,0x18,0x3a,0x29,0x27,0x72,0x3a,0x84,
 0x86,0x64,0x41,0x65,0x89,0x03,0xa3,0x90,0x53,0x20,0x56,0x00,0x25,0x2b,0xbb,0xbc,
-0xa0,0x82,0x5a,0x00,0xd3,0x08,0x10,0xcb,0x61,0x06,0x10,0xe8,0x48,0x00,0x20,0xc6,
-0xb1,0xc5,0x15,0x10,0x33,0x6e,0x47,0x10,0x04,0x51,0x29,0x10,0x09,0x98,0x0a,0xf3,
-0x4a,0xd4,0x05,0x51,0x88,0xd9,0xc1,0x09,0x9d,0x98,0xc8,0xc1,0x09,0x19,0x44,0xb5,
-0x43,0x35,0x81,0x66,0x66,0x64,0x01,0x90,0x9a,0x99,0xd0,0x01,0x90,0x91,0x90,0xb0,
-0x01,0x94,0x91,0xb0,0xb0,0x03,0xe4,0x28,0x79,0x60,0x04,0x21,0xa4,0x00,0x63,0x2a,
-0xaa,0x6c,0xaa,0xa4,0x05,0x09,0x65,0x00,0x50,0x09,0x18,0x66,0xa1,0xa0,0x18,0x37,
-0x64,0x5d,0x30,0x2b,0xbc,0x74,0x0e,0x20,0x00,0x09,0x74,0x85,0xa0,0x49,0x9a,0x68,
-0x90,0x92,0x10,0x0a,0x66,0x21,0x10,0x04,0x98,0x39,0xbe,0x00,0xf3,0x1c,0x1a,0xad,
-0x00,0x18,0x00,0x05,0x0a,0x2b,0xad,0xa7,0x0a,0x0a,0x37,0x18,0x19,0x09,0x0a,0x38,
-0x39,0x39,0x0c,0x9c,0x69,0xac,0x85,0x00,0x06,0x5b,0x64,0x00,0x28,0xaa,0x33,0xf1,
-0x00,0x22,0x0a,0x17,0xbb,0x20,0x01,0x9a,0x88,0x67,0x6f,0xf1,0x01,0x29,0xd9,0x96,
-0xa8,0xd0,0x02,0x90,0xb6,0x40,0xb0,0x3a,0x18,0x74,0x98,0xa0,0x02,0x71,0x6d,0x10,
-0x53,0x88,0x28,0xc1,0xa8,0x66,0x8b,0x60,0x00,0x23,0x33,0x33,0xc1,0x29,0x99,0x99,
-0x73,0x3c,0x15,0x39,0x9e,0x25,0xf5,0x1c,0x41,0x00,0x3a,0xaa,0x01,0xe5,0x00,0x05,
-0x18,0x0a,0x2a,0x30,0x09,0x28,0xb8,0x45,0xc4,0x08,0x36,0x34,0x55,0x22,0x2b,0xbc,
-0x33,0x80,0x61,0x00,0x2a,0x19,0x64,0xa0,0x59,0x6a,0x05,0x17,0x40,0x00,0x0a,0x69,
-0x9d,0x93,0x04,0x6a,0x0f,0x01,0xcf,0x0d,0xf0,0x05,0x12,0x22,0xb5,0x22,0x20,0x46,
-0x66,0x66,0x66,0x60,0x01,0xd8,0x88,0x9b,0x00,0x01,0xc8,0x88,0x8a,0x00,0x89,0x27,
-0xf0,0x06,0x70,0x37,0x26,0x66,0x50,0xb0,0x37,0x66,0x22,0xb0,0xb0,0x37,0x6b,0x88,
-0x80,0xb0,0x37,0x10,0x00,0x08,0x90,0xe1,0x37,0xf0,0x11,0x0b,0xb7,0x49,0xd9,0x80,
-0xa0,0xa7,0x44,0x0b,0x0a,0x0a,0x73,0x92,0xb0,0xa0,0xa7,0x30,0x98,0x0a,0x0a,0x78,
-0x66,0x63,0xc5,0xa1,0x33,0x36,0x7c,0x53,0x8a,0xaa,0x76,0xc3,0x08,0x00,0xfa,0x55,
-0x12,0xb1,0x1a,0x12,0xf1,0x4a,0x99,0xbd,0x99,0x92,0x00,0x22,0x5a,0x22,0x20,0x00,
-0x66,0x8b,0x66,0x40,0x2a,0xaa,0xbc,0xaa,0xa6,0x00,0x0b,0x60,0x00,0x00,0x02,0xbe,
-0x98,0xae,0x00,0x0a,0x26,0x93,0xc3,0x00,0x00,0x15,0xde,0x82,0x00,0x0b,0xb6,0x10,
-0x49,0xb7,0x0c,0xa9,0xc0,0x0b,0x60,0x0c,0x78,0xa0,0x0a,0x82,0x09,0x77,0x95,0x7c,
-0x74,0x08,0xba,0x82,0x5d,0x32,0x08,0xba,0x70,0x4f,0x00,0x28,0xcb,0x90,0x87,0x50,
-0x06,0x43,0x40,0xb0,0xa0,0x44,0x88,0x69,0x30,0x57,0x20,0x20,0x04,0x00,0x03,0x98,
-0x21,0xf0,0x0e,0x58,0x88,0xcb,0x88,0x80,0x01,0x77,0x12,0xc2,0x10,0x00,0x09,0x7c,
-0x30,0x00,0x00,0x28,0xdd,0x61,0x00,0x6c,0xa4,0x00,0x8a,0xd2,0x00,0x83,0x00,0xa1,
-0x20,0x65,0x10,0xa1,0x36,0x11,0x42,0xa1,0x00,0x09,0x40,0x96,0x35,0xf2,0x22,0x04,
-0x9c,0x10,0x00,0x16,0xbf,0xff,0xf2,0x00,0x3f,0xff,0xff,0xff,0x20,0x05,0xff,0xd9,
-0x41,0xf2,0x00,0x5f,0x20,0x00,0x1f,0x20,0x05,0xe0,0x00,0x01,0xf2,0x00,0x5e,0x00,
-0x07,0x9f,0x20,0x48,0xe0,0x07,0xff,0xf2,0xaf,0xfe,0x00,0x2b,0xd8,0x07,0xff,0x90,
-0xd0,0x78,0x00,0x61,0x01,0xf1,0x18,0x88,0x88,0x88,0x14,0xeb,0xe7,0x77,0x7e,0xbe,
-0xa2,0xd0,0x00,0x0d,0x2a,0xeb,0xe3,0x33,0x3e,0xbe,0xb4,0xfb,0xbb,0xbf,0x4b,0xd9,
-0xd0,0x00,0x0d,0x9d,0xb5,0xd0,0x00,0x0d,0x5b,0xb7,0xff,0xff,0xff,0x7b,0xf6,0x00,
-0xff,0x05,0xff,0xd6,0xff,0xff,0xff,0xff,0xe7,0xff,0xff,0xff,0x67,0x52,0x77,0x77,
-0x76,0xef,0xc6,0xff,0xff,0xfe,0x0f,0x00,0x01,0x20,0x78,0x63,0xae,0x5e,0x12,0x00,
-0x90,0x58,0xf0,0x0a,0x06,0xfd,0x00,0x00,0x00,0x6f,0xf7,0x7c,0x10,0x06,0xff,0x70,
-0xdf,0xc1,0x6f,0xf7,0x00,0x1d,0xfe,0xff,0x70,0x00,0x01,0xdf,0xf7,0xcf,0x4f,0x12,
-0x60,0x3d,0x03,0xf0,0x0c,0xd1,0x02,0xea,0xaf,0xd4,0xef,0x80,0xaf,0xff,0x80,0x02,
-0xff,0xf1,0x02,0xef,0xdf,0xd1,0xdf,0x80,0xaf,0xb6,0x70,0x00,0x85,0x00,0x00,0xa6,
-0x90,0x3a,0xf4,0x1b,0xea,0x29,0x00,0x0e,0xe1,0xea,0x5f,0xa0,0x7f,0x40,0xea,0x08,
-0xf3,0xbd,0x00,0xea,0x01,0xf7,0xcc,0x00,0xb7,0x00,0xf8,0xaf,0x00,0x00,0x04,0xf6,
-0x4f,0xa0,0x00,0x1d,0xf1,0x09,0xfd,0x89,0xef,0x50,0x00,0x6d,0xff,0xc4,0x8c,0x0c,
-0xfa,0x20,0x88,0x10,0x00,0x00,0x05,0xff,0x40,0x00,0x1e,0xcf,0xff,0xfc,0xd0,0x7f,
-0xff,0xdd,0xff,0xf7,0x2d,0xfa,0x00,0xbf,0xd1,0x0b,0xf7,0x00,0x8f,0xa0,0x6f,0xfe,
-0x55,0xef,0xf6,0x4f,0xff,0xff,0xff,0xf3,0x06,0x3a,0xff,0xa3,0x60,0x00,0x03,0xff,
-0x30,0x0f,0x74,0xf0,0x24,0x6f,0x90,0xf8,0x00,0x00,0x09,0xf8,0xec,0xf8,0x00,0x01,
-0xbe,0x5a,0x5c,0xf8,0x00,0x2d,0xd5,0xef,0xf6,0xaf,0x50,0xda,0x6f,0xff,0xff,0x87,
-0xf1,0x11,0xff,0xff,0xff,0xf5,0x10,0x02,0xff,0xc3,0x9f,0xf6,0x00,0x02,0xff,0xb0,
-0x7f,0xf6,0x00,0x01,0xbb,0x70,0x4b,0xb3,0xe9,0x2e,0x00,0x0e,0x78,0x27,0xff,0x60,
-0x05,0x00,0x90,0x01,0xff,0xff,0xff,0x60,0x00,0x5f,0xff,0xfa,0x8c,0x00,0xf3,0x02,
-0xb0,0x00,0x8b,0xb9,0x8b,0x8b,0xb9,0xdf,0xff,0xff,0xfe,0xdf,0xcf,0xff,0xff,0xfc,
-0xbe,0x2f,0x69,0x91,0x44,0x44,0x30,0x00,0x01,0xef,0xff,0xff,0xf4,0x8b,0x09,0x40,
-0x8e,0x10,0x6e,0x10,0x83,0x09,0xd0,0xee,0xcb,0x10,0x0a,0xcd,0xf2,0xff,0xff,0xb8,
-0x9f,0xff,0xf4,0xff,0x01,0x00,0x20,0xf4,0xcf,0x06,0x00,0xf2,0x23,0xe1,0x00,0x04,
-0x87,0x30,0x5f,0x02,0xdf,0xfe,0xfc,0x7f,0x1e,0xd3,0x00,0x3c,0xff,0x9f,0x10,0x05,
-0xfe,0xff,0x44,0x00,0x02,0x66,0x66,0x12,0x22,0x00,0x00,0x11,0xff,0xff,0x50,0x00,
-0xda,0xff,0xa3,0x10,0x08,0xf4,0xfc,0xfb,0x66,0xbf,0x80,0xf5,0x4c,0xff,0xd5,0x8d,
-0x22,0x00,0xa1,0x6b,0x43,0xbf,0xab,0xdf,0xff,0x01,0x00,0x51,0x00,0x3e,0xf0,0x00,
-0x2c,0xb5,0x6b,0xf0,0x07,0x0b,0xf0,0x00,0xab,0xdf,0xf0,0x20,0xff,0xff,0xf0,0xa6,
-0xff,0xff,0xf0,0x59,0xff,0xff,0xf0,0x92,0x00,0x3e,0xf0,0x8a,0x4e,0x05,0x4d,0x12,
-0x30,0x70,0x00,0xaa,0x28,0x00,0x90,0x0a,0x4a,0x70,0xab,0xdf,0xf0,0x23,0xe2,0xe0,
-0x2c,0x00,0x20,0x95,0xc2,0x2e,0x00,0x20,0x76,0xc3,0x30,0x00,0xd1,0xc3,0xe1,0x00,
-0x3e,0xf0,0x09,0xa6,0xb0,0x00,0x02,0xc0,0x03,0x3e,0x7d,0x26,0x20,0xc3,0x00,0x01,
-0x1b,0x30,0x42,0xff,0xef,0x64,0x01,0xf0,0x09,0x0d,0xff,0xef,0xff,0xf8,0x4e,0xfe,
-0x25,0xff,0xff,0x9d,0xe2,0x00,0x6f,0xf9,0x01,0x20,0x00,0x4f,0xf7,0x44,0x44,0x44,
-0x7f,0xd0,0x00,0x10,0xfc,0x1a,0x38,0xf1,0x13,0x07,0xf5,0x00,0x00,0xef,0xc0,0x00,
-0x8f,0xff,0x60,0x3f,0xff,0xff,0x1b,0xff,0xff,0xf9,0xfb,0xff,0xff,0xdd,0x6e,0xff,
-0xfc,0x7e,0x59,0xff,0x60,0x9f,0xff,0x80,0x00,0x13,0x10,0xc7,0x08,0xf1,0x3a,0x70,
-0x03,0xe4,0xe7,0x04,0xff,0x5e,0x75,0xff,0xf5,0xec,0xff,0xff,0x5e,0xff,0xff,0xf5,
-0xea,0xef,0xff,0x5e,0x71,0xdf,0xf5,0xe7,0x01,0xcf,0x59,0x50,0x00,0x92,0x88,0x00,
-0x00,0x00,0x0f,0xfe,0x50,0x00,0x00,0xff,0xff,0xc3,0x00,0x0f,0xff,0xff,0xf9,0x10,
-0xff,0xff,0xff,0xfe,0x5f,0xff,0xff,0xff,0xfa,0xff,0xff,0xff,0xf8,0x0f,0xff,0xff,
-0xb2,0x00,0xff,0xfd,0x40,0x00,0x0e,0xf7,0x03,0x70,0x04,0x96,0x1f,0xee,0xff,0x90,
-0xdf,0xf9,0xff,0xfc,0x0f,0xff,0xcf,0xff,0xc0,0xff,0xfc,0xff,0x09,0x00,0x71,0xfb,
-0x0f,0xff,0xb8,0xbb,0x50,0x8b,0x4a,0x09,0x00,0x93,0x7b,0x10,0xf9,0x3f,0x01,0x01,
-0xbb,0x00,0x0f,0x09,0x00,0x03,0x11,0xb8,0xdb,0x78,0x00,0xa3,0x0b,0xf3,0x0f,0x00,
-0xe7,0xcf,0xb0,0x0e,0x7c,0xff,0xc1,0xe7,0xcf,0xff,0xdf,0x7c,0xff,0xff,0xf7,0xcf,
-0xff,0x9e,0x7c,0xff,0x70,0xe7,0xcf,0x60,0x0e,0x77,0x50,0x00,0x95,0x07,0x11,0xe0,
-0xaf,0x60,0x00,0x00,0x09,0xff,0xf5,0x00,0x00,0x8f,0xff,0xff,0x40,0x06,0x2f,0x01,
-0x10,0x0e,0xb2,0x00,0x51,0x03,0x66,0x66,0x66,0x62,0x6f,0x00,0xa1,0x0f,0xff,0xff,
-0xff,0xfb,0x06,0x88,0x88,0x88,0x84,0xd7,0x02,0xf2,0x07,0xc7,0x00,0x1d,0xf5,0x01,
-0xdf,0x50,0x1d,0xf5,0x00,0x4f,0xd0,0x00,0x06,0xfc,0x00,0x00,0x6f,0xc0,0x00,0x06,
-0xf9,0x93,0x5b,0xf0,0x07,0x3e,0x30,0x00,0x2e,0xf3,0x00,0x02,0xef,0x30,0x00,0x2e,
-0xe3,0x00,0x09,0xf8,0x00,0x8f,0xa0,0x08,0xfa,0x00,0x5f,0x1c,0x7f,0x03,0x39,0x07,
-0x20,0x8f,0x40,0x8e,0x29,0xb0,0x00,0x00,0x00,0x9f,0x50,0x00,0x9b,0xbd,0xfc,0xbb,
-0x6f,0x5c,0x00,0x50,0x13,0x3a,0xf7,0x33,0x10,0x12,0x00,0x02,0x1b,0x00,0x80,0x39,
-0x10,0x00,0xbd,0xdd,0xdd,0xdd,0x8e,0x86,0x00,0x03,0x8c,0x0b,0xf3,0x1f,0x8a,0x95,
-0x00,0x00,0x01,0xcf,0x84,0x6e,0xe3,0x00,0x1e,0xf5,0x08,0x72,0xff,0x40,0xbf,0xe0,
-0x2d,0xf5,0xbf,0xe0,0xdf,0xe3,0xff,0xf6,0xaf,0xf1,0x4f,0xf3,0xaf,0xd1,0xef,0x70,
-0x05,0xfd,0x31,0x2b,0xf7,0x00,0x00,0x19,0xdf,0xea,0x30,0x00,0x98,0x17,0xf2,0x24,
-0xfa,0x16,0xaa,0x83,0x00,0x00,0x03,0xef,0xe6,0x49,0xfb,0x00,0x00,0x01,0xbe,0x49,
-0x28,0xfd,0x00,0x1d,0x40,0x8f,0xfe,0x1f,0xf9,0x04,0xff,0x50,0x5f,0xf1,0xff,0xb0,
-0x0a,0xfc,0x00,0x2d,0xdf,0xf2,0x00,0x0a,0xfa,0x10,0x1b,0xf7,0x00,0x00,0x04,0xbe,
-0xe4,0x08,0xf7,0x6e,0x00,0x15,0xf5,0x4d,0x2a,0x21,0x02,0xe6,0x0b,0x00,0x30,0xbf,
-0xe1,0x00,0x7c,0x3d,0x01,0xb3,0x04,0x30,0x0d,0xe7,0xcf,0x14,0x21,0x20,0xfc,0x08,
+0xa0,0x10,0xd0,0x0d,0x00,0xd3,0x08,0x10,0xcb,0x61,0x06,0x10,0xe8,0x48,0x00,0xf0,
+0x02,0xc6,0xb1,0x00,0x00,0x00,0xa0,0x33,0x00,0x00,0x00,0x84,0x04,0x00,0x00,0x00,
+0x3a,0x09,0x98,0x0a,0xf3,0x4a,0xd4,0x05,0x51,0x88,0xd9,0xc1,0x09,0x9d,0x98,0xc8,
+0xc1,0x09,0x19,0x44,0xb5,0x43,0x35,0x81,0x66,0x66,0x64,0x01,0x90,0x9a,0x99,0xd0,
+0x01,0x90,0x91,0x90,0xb0,0x01,0x94,0x91,0xb0,0xb0,0x03,0xe4,0x28,0x79,0x60,0x04,
+0x21,0xa4,0x00,0x63,0x2a,0xaa,0x6c,0xaa,0xa4,0x05,0x09,0x65,0x00,0x50,0x09,0x18,
+0x66,0xa1,0xa0,0x18,0x37,0x64,0x5d,0x30,0x2b,0xbc,0x74,0x0e,0x20,0x00,0x09,0x74,
+0x85,0xa0,0x49,0x9a,0x68,0x90,0x92,0x10,0x0a,0x66,0x21,0x10,0x04,0x98,0x39,0xbe,
+0x00,0xf1,0x1e,0x1a,0xad,0x00,0x18,0x00,0x05,0x0a,0x2b,0xad,0xa7,0x0a,0x0a,0x37,
+0x18,0x19,0x09,0x0a,0x38,0x39,0x39,0x0c,0x9c,0x69,0xac,0x85,0x00,0x06,0x5b,0x64,
+0x00,0x28,0xaa,0x33,0xf1,0x00,0x22,0x0a,0x17,0xbb,0x20,0x01,0x9a,0x88,0x01,0x98,
+0x32,0x00,0xf0,0x18,0x29,0xd9,0x96,0xa8,0xd0,0x02,0x90,0xb6,0x40,0xb0,0x3a,0x18,
+0x74,0x98,0xa0,0x02,0xaa,0xaa,0xa8,0x00,0x00,0x53,0x00,0x1b,0x00,0x00,0xa8,0x66,
+0x8b,0x60,0x00,0x23,0x33,0x33,0xc1,0x29,0x99,0x99,0x92,0x90,0x06,0x24,0x39,0x80,
+0xb6,0x01,0xf5,0x1c,0x41,0x00,0x3a,0xaa,0x01,0xe5,0x00,0x05,0x18,0x0a,0x2a,0x30,
+0x09,0x28,0xb8,0x45,0xc4,0x08,0x36,0x34,0x55,0x22,0x2b,0xbc,0x33,0x80,0x61,0x00,
+0x2a,0x19,0x64,0xa0,0x59,0x6a,0x05,0x17,0x40,0x00,0x0a,0x69,0x9d,0x93,0x04,0x6a,
+0x0f,0x01,0xcf,0x0d,0xf0,0x1e,0x12,0x22,0xb5,0x22,0x20,0x46,0x66,0x66,0x66,0x60,
+0x01,0xd8,0x88,0x9b,0x00,0x01,0xc8,0x88,0x8a,0x00,0x29,0x99,0x99,0x99,0x70,0x37,
+0x26,0x66,0x50,0xb0,0x37,0x66,0x22,0xb0,0xb0,0x37,0x6b,0x88,0x80,0xb0,0x37,0x10,
+0x00,0x08,0x90,0xf0,0x1f,0x00,0x00,0x05,0x10,0x0b,0xb7,0x49,0xd9,0x80,0xa0,0xa7,
+0x44,0x0b,0x0a,0x0a,0x73,0x92,0xb0,0xa0,0xa7,0x30,0x98,0x0a,0x0a,0x78,0x66,0x63,
+0xc5,0xa1,0x33,0x36,0x7c,0x53,0x8a,0xaa,0x76,0x00,0x00,0x00,0x06,0x50,0x00,0x00,
+0x08,0xb1,0x00,0x01,0x00,0xf0,0x70,0x07,0x99,0xbd,0x99,0x92,0x00,0x22,0x5a,0x22,
+0x20,0x00,0x66,0x8b,0x66,0x40,0x2a,0xaa,0xbc,0xaa,0xa6,0x00,0x0b,0x60,0x00,0x00,
+0x02,0xbe,0x98,0xae,0x00,0x0a,0x26,0x93,0xc3,0x00,0x00,0x15,0xde,0x82,0x00,0x0b,
+0xb6,0x10,0x49,0xb7,0x0c,0xa9,0xc0,0x0b,0x60,0x0c,0x78,0xa0,0x0a,0x82,0x09,0x77,
+0x95,0x7c,0x74,0x08,0xba,0x82,0x5d,0x32,0x08,0xba,0x70,0x4f,0x00,0x28,0xcb,0x90,
+0x87,0x50,0x06,0x43,0x40,0xb0,0xa0,0x44,0x88,0x69,0x30,0x57,0x20,0x20,0x04,0x00,
+0x03,0x00,0x00,0x60,0x00,0x00,0x58,0x88,0xcb,0x88,0x80,0x01,0x77,0x12,0xc2,0x10,
+0x00,0x09,0x7c,0x30,0x00,0x00,0x28,0xdd,0x61,0x00,0x6c,0xa4,0x00,0x8a,0xd2,0x00,
+0x83,0x00,0xa1,0x00,0x00,0xa1,0x05,0x00,0x80,0xc0,0x00,0xa1,0x00,0x09,0x40,0x00,
+0xa1,0x8f,0x00,0xf0,0x27,0x04,0x9c,0x10,0x00,0x16,0xbf,0xff,0xf2,0x00,0x3f,0xff,
+0xff,0xff,0x20,0x05,0xff,0xd9,0x41,0xf2,0x00,0x5f,0x20,0x00,0x1f,0x20,0x05,0xe0,
+0x00,0x01,0xf2,0x00,0x5e,0x00,0x07,0x9f,0x20,0x48,0xe0,0x07,0xff,0xf2,0xaf,0xfe,
+0x00,0x2b,0xd8,0x07,0xff,0x90,0x00,0x00,0x00,0x01,0x10,0x3a,0x00,0xf1,0x19,0x41,
+0x88,0x88,0x88,0x14,0xeb,0xe7,0x77,0x7e,0xbe,0xa2,0xd0,0x00,0x0d,0x2a,0xeb,0xe3,
+0x33,0x3e,0xbe,0xb4,0xfb,0xbb,0xbf,0x4b,0xd9,0xd0,0x00,0x0d,0x9d,0xb5,0xd0,0x00,
+0x0d,0x5b,0xb7,0xff,0xff,0xff,0x7b,0xf6,0x00,0xff,0x05,0xff,0xd6,0xff,0xff,0xff,
+0xff,0xe7,0xff,0xff,0xff,0x67,0x52,0x77,0x77,0x76,0xef,0xc6,0xff,0xff,0xfe,0x0f,
+0x00,0x01,0x51,0x78,0x63,0x88,0x88,0x87,0x5e,0x00,0x00,0x36,0x01,0xf1,0x0e,0xfd,
+0x00,0x00,0x00,0x6f,0xf7,0x7c,0x10,0x06,0xff,0x70,0xdf,0xc1,0x6f,0xf7,0x00,0x1d,
+0xfe,0xff,0x70,0x00,0x01,0xdf,0xf7,0x00,0x00,0x00,0x1c,0x60,0x58,0x00,0xf2,0x3c,
+0x0c,0xd1,0x02,0xea,0xaf,0xd4,0xef,0x80,0xaf,0xff,0x80,0x02,0xff,0xf1,0x02,0xef,
+0xdf,0xd1,0xdf,0x80,0xaf,0xb6,0x70,0x00,0x85,0x00,0x00,0xa6,0x00,0x00,0x02,0xa0,
+0xea,0x29,0x00,0x0e,0xe1,0xea,0x5f,0xa0,0x7f,0x40,0xea,0x08,0xf3,0xbd,0x00,0xea,
+0x01,0xf7,0xcc,0x00,0xb7,0x00,0xf8,0xaf,0x00,0x00,0x04,0xf6,0x4f,0xa0,0x00,0x1d,
+0xf1,0x09,0xfd,0x89,0xef,0x50,0x00,0x6d,0xff,0xc4,0x00,0x01,0x00,0xf9,0x22,0x01,
+0x88,0x10,0x00,0x00,0x05,0xff,0x40,0x00,0x1e,0xcf,0xff,0xfc,0xd0,0x7f,0xff,0xdd,
+0xff,0xf7,0x2d,0xfa,0x00,0xbf,0xd1,0x0b,0xf7,0x00,0x8f,0xa0,0x6f,0xfe,0x55,0xef,
+0xf6,0x4f,0xff,0xff,0xff,0xf3,0x06,0x3a,0xff,0xa3,0x60,0x00,0x03,0xff,0x30,0x00,
+0x01,0x00,0xf7,0x2e,0x6f,0x90,0xf8,0x00,0x00,0x09,0xf8,0xec,0xf8,0x00,0x01,0xbe,
+0x5a,0x5c,0xf8,0x00,0x2d,0xd5,0xef,0xf6,0xaf,0x50,0xda,0x6f,0xff,0xff,0x87,0xf1,
+0x11,0xff,0xff,0xff,0xf5,0x10,0x02,0xff,0xc3,0x9f,0xf6,0x00,0x02,0xff,0xb0,0x7f,
+0xf6,0x00,0x01,0xbb,0x70,0x4b,0xb3,0x00,0x00,0x00,0x88,0x20,0x00,0x00,0x01,0xff,
+0x60,0x05,0x00,0x90,0x01,0xff,0xff,0xff,0x60,0x00,0x5f,0xff,0xfa,0x8c,0x00,0xf2,
+0x02,0xb0,0x00,0x8b,0xb9,0x8b,0x8b,0xb9,0xdf,0xff,0xff,0xfe,0xdf,0xcf,0xff,0xff,
+0xfc,0xbe,0x6c,0x00,0xf0,0x15,0x24,0x44,0x44,0x30,0x00,0x01,0xef,0xff,0xff,0xf4,
+0x00,0x0b,0xc0,0x00,0x00,0x8e,0x10,0x6e,0x10,0x00,0x00,0x0c,0xa0,0xee,0xcb,0x10,
+0x0a,0xcd,0xf2,0xff,0xff,0xb8,0x9f,0xff,0xf4,0xff,0x01,0x00,0x20,0xf4,0xcf,0x06,
+0x00,0xf2,0x25,0xe1,0x00,0x04,0x87,0x30,0x5f,0x02,0xdf,0xfe,0xfc,0x7f,0x1e,0xd3,
+0x00,0x3c,0xff,0x9f,0x10,0x05,0xfe,0xff,0x44,0x00,0x02,0x66,0x66,0x12,0x22,0x00,
+0x00,0x11,0xff,0xff,0x50,0x00,0xda,0xff,0xa3,0x10,0x08,0xf4,0xfc,0xfb,0x66,0xbf,
+0x80,0xf5,0x4c,0xff,0xd5,0x00,0x31,0x68,0x00,0x63,0x70,0x00,0xbf,0xab,0xdf,0xff,
+0x01,0x00,0x50,0x00,0x3e,0xf0,0x00,0x2c,0x14,0x00,0xf0,0x05,0x00,0x0b,0xf0,0x00,
+0xab,0xdf,0xf0,0x20,0xff,0xff,0xf0,0xa6,0xff,0xff,0xf0,0x59,0xff,0xff,0xf0,0x92,
+0x1d,0x00,0x31,0x00,0x02,0xc0,0x36,0x00,0x11,0x40,0x3a,0x00,0x10,0xaa,0x28,0x00,
+0x90,0x0a,0x4a,0x70,0xab,0xdf,0xf0,0x23,0xe2,0xe0,0x2c,0x00,0x20,0x95,0xc2,0x2e,
+0x00,0x20,0x76,0xc3,0x30,0x00,0xe0,0xc3,0xe1,0x00,0x3e,0xf0,0x09,0xa6,0xb0,0x00,
+0x02,0xc0,0x03,0x3e,0x20,0x36,0x00,0x10,0xc3,0xd6,0x00,0x40,0x44,0x42,0xff,0xef,
+0x64,0x01,0xf0,0x09,0x0d,0xff,0xef,0xff,0xf8,0x4e,0xfe,0x25,0xff,0xff,0x9d,0xe2,
+0x00,0x6f,0xf9,0x01,0x20,0x00,0x4f,0xf7,0x44,0x44,0x44,0x7f,0xd0,0x00,0xf1,0x17,
+0xfc,0x00,0x1a,0x00,0x00,0x07,0xf5,0x00,0x00,0xef,0xc0,0x00,0x8f,0xff,0x60,0x3f,
+0xff,0xff,0x1b,0xff,0xff,0xf9,0xfb,0xff,0xff,0xdd,0x6e,0xff,0xfc,0x7e,0x59,0xff,
+0x60,0x9f,0xff,0x80,0x00,0x13,0xa8,0x02,0xf0,0x3a,0x0e,0x70,0x03,0xe4,0xe7,0x04,
+0xff,0x5e,0x75,0xff,0xf5,0xec,0xff,0xff,0x5e,0xff,0xff,0xf5,0xea,0xef,0xff,0x5e,
+0x71,0xdf,0xf5,0xe7,0x01,0xcf,0x59,0x50,0x00,0x92,0x88,0x00,0x00,0x00,0x0f,0xfe,
+0x50,0x00,0x00,0xff,0xff,0xc3,0x00,0x0f,0xff,0xff,0xf9,0x10,0xff,0xff,0xff,0xfe,
+0x5f,0xff,0xff,0xff,0xfa,0xff,0xff,0xff,0xf8,0x0f,0xff,0xff,0xb2,0x00,0xff,0xfd,
+0x40,0x00,0x0e,0x77,0x02,0x14,0x11,0xea,0x01,0xef,0x0d,0xff,0x90,0xdf,0xf9,0xff,
+0xfc,0x0f,0xff,0xcf,0xff,0xc0,0xff,0xfc,0x09,0x00,0x00,0x82,0xfb,0x0f,0xff,0xb8,
+0xbb,0x50,0x8b,0xb5,0x2d,0x00,0x30,0xff,0xff,0xf9,0x3f,0x01,0x01,0xbb,0x00,0x0f,
+0x09,0x00,0x03,0x40,0xb8,0xbb,0xbb,0xbb,0x2d,0x00,0xf0,0x14,0x0b,0xa0,0x00,0xe7,
+0xcf,0xb0,0x0e,0x7c,0xff,0xc1,0xe7,0xcf,0xff,0xdf,0x7c,0xff,0xff,0xf7,0xcf,0xff,
+0x9e,0x7c,0xff,0x70,0xe7,0xcf,0x60,0x0e,0x77,0x50,0x00,0x95,0x00,0x00,0x02,0x53,
+0x00,0xe0,0xaf,0x60,0x00,0x00,0x09,0xff,0xf5,0x00,0x00,0x8f,0xff,0xff,0x40,0x06,
+0x2f,0x01,0x10,0x0e,0xb2,0x00,0x51,0x03,0x66,0x66,0x66,0x62,0x6f,0x00,0xa1,0x0f,
+0xff,0xff,0xff,0xfb,0x06,0x88,0x88,0x88,0x84,0xd7,0x02,0xf0,0x26,0xc7,0x00,0x1d,
+0xf5,0x01,0xdf,0x50,0x1d,0xf5,0x00,0x4f,0xd0,0x00,0x06,0xfc,0x00,0x00,0x6f,0xc0,
+0x00,0x06,0xf9,0x00,0x00,0x51,0x00,0x00,0x00,0x3e,0x30,0x00,0x2e,0xf3,0x00,0x02,
+0xef,0x30,0x00,0x2e,0xe3,0x00,0x09,0xf8,0x00,0x8f,0xa0,0x08,0xfa,0x00,0x5f,0xa0,
+0x00,0x06,0x3a,0x00,0x00,0x44,0x01,0xf0,0x02,0x8f,0x40,0x00,0x00,0x09,0xf5,0x00,
+0x00,0x00,0x9f,0x50,0x00,0x9b,0xbd,0xfc,0xbb,0x6f,0x5c,0x00,0x50,0x13,0x3a,0xf7,
+0x33,0x10,0x12,0x00,0x02,0x1b,0x00,0x80,0x39,0x10,0x00,0xbd,0xdd,0xdd,0xdd,0x8e,
+0x86,0x00,0x02,0x23,0x01,0xf1,0x21,0x04,0x8a,0x95,0x00,0x00,0x01,0xcf,0x84,0x6e,
+0xe3,0x00,0x1e,0xf5,0x08,0x72,0xff,0x40,0xbf,0xe0,0x2d,0xf5,0xbf,0xe0,0xdf,0xe3,
+0xff,0xf6,0xaf,0xf1,0x4f,0xf3,0xaf,0xd1,0xef,0x70,0x05,0xfd,0x31,0x2b,0xf7,0x00,
+0x00,0x19,0xdf,0xea,0x30,0x00,0xb6,0x35,0x00,0xf2,0x25,0x06,0xfa,0x16,0xaa,0x83,
+0x00,0x00,0x03,0xef,0xe6,0x49,0xfb,0x00,0x00,0x01,0xbe,0x49,0x28,0xfd,0x00,0x1d,
+0x40,0x8f,0xfe,0x1f,0xf9,0x04,0xff,0x50,0x5f,0xf1,0xff,0xb0,0x0a,0xfc,0x00,0x2d,
+0xdf,0xf2,0x00,0x0a,0xfa,0x10,0x1b,0xf7,0x00,0x00,0x04,0xbe,0xe4,0x08,0xf7,0x6e,
+0x00,0x12,0xf5,0xc0,0x03,0x51,0x00,0x00,0x00,0x02,0xe6,0x0b,0x00,0x20,0xbf,0xe1,
+0x06,0x00,0x11,0x4f,0xb3,0x04,0x90,0x0d,0xe7,0xcf,0x20,0x00,0x00,0x07,0xfc,0x08,
 0x55,0x00,0xf0,0x0b,0xef,0xd0,0x9f,0xf4,0x00,0x00,0x9f,0xff,0x5c,0xff,0xd0,0x00,
 0x2f,0xff,0xe1,0xaf,0xff,0x60,0x0b,0xff,0xfe,0x2b,0xff,0xfe,0x00,0xef,0x89,0x01,
-0x75,0xf2,0x01,0x33,0x33,0x33,0x33,0x32,0xd4,0x03,0xf3,0x16,0x07,0xc1,0xef,0xd1,
+0x75,0xf2,0x01,0x33,0x33,0x33,0x33,0x32,0xd4,0x03,0xf3,0x1e,0x07,0xc1,0xef,0xd1,
 0x03,0xef,0xfc,0x99,0xfb,0x2e,0xec,0xf8,0x00,0x54,0xde,0x25,0x70,0x00,0x0c,0xf4,
 0x01,0x10,0x00,0xbf,0x5c,0x78,0xd1,0xff,0xf6,0x0a,0xff,0xfd,0x78,0x60,0x00,0x7c,
-0xf6,0xd8,0x63,0x13,0x30,0x9a,0x01,0xf0,0x19,0xaf,0xef,0x60,0x00,0xaf,0x90,0xcf,
-0x60,0x9f,0x80,0x00,0xcf,0x57,0x80,0x00,0x00,0xa4,0x11,0x00,0x00,0x02,0x0c,0xe2,
-0x00,0x05,0xf8,0x3f,0xe2,0x05,0xfd,0x10,0x3f,0xe7,0xfd,0x10,0x00,0x3f,0xfd,0x10,
-0x00,0xa4,0x2b,0x03,0xa4,0x46,0xf0,0x07,0xcf,0xc3,0xff,0xff,0xf5,0x00,0xbe,0xfe,
-0xb3,0x44,0x4e,0x60,0x04,0x3f,0x34,0x00,0x00,0xd6,0x00,0x02,0xf2,0x00,0x5d,0x84,
-0xf0,0x07,0x2f,0x20,0x00,0x8c,0xea,0xf1,0x01,0xff,0xff,0xf7,0xdf,0xf7,0x00,0x04,
-0x44,0x44,0x11,0xc7,0x00,0x58,0x88,0x20,0xb0,0x02,0x50,0xe4,0x44,0x41,0xff,0xff,
-0x3b,0x05,0x0e,0x01,0x00,0x02,0x59,0x02,0x02,0xa2,0x43,0xa0,0x03,0xff,0x40,0x00,
-0x00,0x3f,0xff,0xf4,0x00,0x02,0xe4,0x05,0x92,0x00,0x36,0xff,0x63,0x00,0x00,0x04,
-0xff,0x40,0x05,0x00,0xb5,0x9a,0xa5,0xff,0x5a,0xa9,0xff,0xff,0xdd,0xfe,0xdf,0xff,
-0x5c,0x04,0x00,0x01,0x00,0x10,0xa8,0xc2,0x03,0x20,0x5f,0xff,0x64,0x05,0x20,0xff,
-0xe0,0xdb,0x04,0x11,0xfa,0xa6,0x00,0x10,0x50,0x16,0x00,0xb0,0xd0,0x00,0x39,0x10,
-0x4f,0xf4,0x00,0xbf,0xfc,0x9f,0xf6,0xdc,0x02,0xa5,0xe4,0x00,0x00,0x9f,0xfd,0x81,
-0x00,0x00,0x01,0x31,0x80,0x15,0xf5,0x30,0xfe,0x30,0x05,0xc6,0xe7,0xbb,0x05,0xff,
-0x4d,0xbd,0xb4,0xff,0x40,0x3c,0xff,0xff,0x40,0x00,0x08,0xff,0xb0,0x00,0x6f,0xff,
-0xdf,0x80,0x0e,0x7b,0xb2,0xef,0x80,0xdb,0xd9,0x02,0xef,0x73,0xca,0x10,0x02,0x72,
-0x00,0x5d,0xdd,0x48,0x00,0x08,0xff,0xf6,0xf8,0xcc,0x8f,0xff,0x84,0x3f,0xe8,0xff,
-0xff,0xfc,0xfe,0x8f,0xff,0xff,0xcf,0x09,0x00,0x10,0xe7,0x1e,0x03,0x40,0x46,0x66,
-0x66,0x3f,0xe7,0x04,0x30,0x34,0x44,0x43,0xa8,0x14,0xf1,0x06,0x22,0x00,0x0e,0xff,
-0xff,0xfe,0x20,0xf5,0x22,0x22,0xfe,0x1f,0x40,0x00,0x0e,0xf8,0xf7,0x44,0x44,0xff,
-0x9f,0x62,0x03,0xf0,0x07,0xf6,0x0c,0xff,0x9f,0xff,0x20,0x9f,0xf9,0xff,0xfc,0x7f,
-0xff,0x9a,0xdd,0xdd,0xdd,0xd4,0x67,0x77,0x77,0x77,0x4e,0xad,0x02,0x01,0x95,0x00,
-0x00,0xe0,0x0a,0x00,0xe3,0x01,0x01,0xe4,0x0b,0x50,0x45,0x55,0x55,0x55,0x3f,0x1b,
-0x00,0x01,0x0f,0x3c,0x10,0x58,0x29,0x03,0x01,0x38,0x01,0x00,0xdc,0x02,0xf7,0x00,
-0xf6,0xc5,0xdf,0xff,0xfd,0x5c,0xfe,0x6a,0xff,0xa5,0xef,0xff,0xf9,0x55,0x9f,0x51,
-0x01,0xf0,0x06,0x03,0xaa,0xa2,0x00,0x07,0xff,0xf2,0x00,0x09,0xff,0xd0,0x00,0x0b,
-0xff,0xd8,0x81,0x0e,0xff,0xff,0xe1,0x0e,0xac,0x05,0xe1,0x05,0xfd,0x00,0x00,0x09,
-0xf4,0x00,0x00,0x0d,0xa0,0x00,0x00,0x0f,0x20,0xa5,0x03,0xf1,0x23,0x01,0x79,0x11,
-0x00,0x0f,0xfc,0x9f,0xf4,0x00,0xff,0xfd,0xcc,0x30,0x0f,0xfa,0x79,0x93,0x40,0xff,
-0x8e,0xff,0x6f,0x5f,0xf8,0xef,0xf7,0x64,0xff,0x8e,0xff,0xff,0xcf,0xf8,0xef,0xff,
-0xfc,0x46,0x3e,0xff,0xff,0xc0,0x00,0xdf,0xff,0xfc,0x00,0x02,0x44,0x44,0x20,0x14,
-0x7e,0x50,0x02,0xaf,0x81,0x00,0x02,0xc3,0x7f,0x80,0x9f,0xff,0xff,0x50,0x0c,0xff,
-0xff,0xf8,0x97,0x02,0x51,0xa0,0x3f,0xff,0xff,0xfe,0xd8,0x03,0x00,0x9a,0x08,0x42,
-0x20,0x00,0xbf,0x70,0x7b,0x0f,0x00,0x2f,0x05,0x21,0x44,0x30,0xa0,0x00,0x20,0xf3,
-0xf4,0x34,0x0b,0xf4,0x09,0xf4,0xff,0xbe,0xae,0xae,0xaf,0xf4,0xff,0x3a,0x0a,0x0a,
-0x0f,0xf4,0xfb,0xea,0xaa,0xaa,0xea,0xf4,0xf7,0xb4,0x44,0x44,0xc4,0x06,0x06,0x00,
-0x4f,0x09,0x10,0x70,0xec,0x09,0x00,0xd5,0x01,0xb0,0x4b,0xff,0xff,0x70,0x00,0x5d,
-0xff,0xff,0xff,0x10,0x0c,0x5b,0x00,0x60,0x00,0x0a,0xee,0xef,0xff,0xf2,0x60,0x0b,
-0x21,0xff,0xa0,0x06,0x00,0x10,0x30,0x06,0x00,0x11,0xfb,0xae,0x14,0x14,0xf4,0x1f,
-0x09,0xf0,0x01,0xef,0xff,0x5b,0x00,0xff,0xff,0x6f,0xb0,0xff,0xff,0x68,0x83,0xff,
-0xff,0xfd,0xd6,0x24,0x05,0x1e,0xff,0x04,0x00,0x14,0xf7,0xed,0x44,0x00,0x1a,0x03,
-0xc0,0xbf,0xff,0xfd,0x81,0x00,0x2c,0xfe,0xa8,0x78,0xcf,0xf7,0x0d,0x19,0x00,0xe1,
-0x3c,0xf5,0x22,0x05,0xbe,0xfd,0x81,0x05,0x00,0x09,0xfe,0xa9,0xcf,0xe2,0x4b,0x59,
-0x11,0x38,0xba,0x67,0x01,0x05,0x06,0x12,0x0f,0x3c,0x00,0x61,0x58,0x10,0x00,0x00,
-0xcf,0xff,0xcb,0x04,0xd0,0x75,0x55,0x55,0x55,0x5a,0xf2,0xf6,0xff,0xff,0xff,0xfd,
-0x4f,0x5f,0xa1,0x01,0x91,0xd1,0xf5,0xf5,0x77,0x77,0x77,0x76,0x8f,0x4f,0xfa,0x00,
-0x11,0xd0,0x06,0x01,0x17,0x41,0x2e,0x00,0x21,0x54,0x4a,0x2e,0x00,0x11,0x00,0x2e,
-0x00,0x21,0xf0,0x01,0x2e,0x00,0x1f,0x00,0x2e,0x00,0x05,0x21,0x54,0x44,0x2e,0x00,
-0x11,0x20,0x2e,0x00,0x21,0xf2,0x00,0x2e,0x00,0x1f,0x10,0x2e,0x00,0x05,0x21,0x54,
-0x44,0x2e,0x00,0x20,0x50,0x00,0x2e,0x00,0x21,0xf5,0x00,0x2e,0x00,0x2f,0x20,0x00,
-0x2e,0x00,0x02,0x40,0xfa,0x0f,0x74,0x44,0x2e,0x00,0x11,0xf4,0x87,0x04,0x30,0x5f,
-0x40,0x00,0x2e,0x00,0x01,0x0d,0x00,0x0b,0x2e,0x00,0x00,0x95,0x7d,0x01,0x94,0x75,
-0x11,0xbd,0x1e,0x00,0x70,0xa1,0x03,0x00,0x00,0x0a,0xf7,0x39,0x45,0x1c,0xa1,0xff,
-0xea,0xbf,0xaa,0xaa,0xdf,0x45,0xa3,0x00,0x93,0x60,0x5b,0x31,0x01,0xb8,0xfb,0x08,
-0x17,0x25,0x9f,0xb0,0x45,0x18,0xf2,0x1c,0x6b,0xca,0x40,0x00,0x9f,0xf6,0xff,0x40,
-0x1f,0xff,0x26,0xfb,0x04,0xf6,0xb4,0x6b,0xf0,0x6f,0xf4,0x06,0xff,0x06,0xff,0x90,
-0xbf,0xf0,0x5f,0x95,0x34,0xcf,0x02,0xfb,0xf3,0x4d,0xc0,0x0c,0xff,0x3d,0xf7,0x00,
-0x1b,0xfe,0xf9,0x32,0x00,0x50,0x12,0x3b,0xca,0x22,0x1f,0xf8,0x02,0x50,0x36,0x66,
-0x66,0x66,0x16,0xf0,0x04,0x8a,0x6f,0x6f,0x6f,0x7f,0x26,0xf6,0xf6,0xf7,0x09,0x00,
-0x91,0x24,0xff,0xff,0xff,0xf1,0x03,0x44,0x44,0x42,0x6b,0x00,0x01,0xc7,0x12,0x20,
-0x9f,0xf8,0xc8,0x37,0xc0,0xef,0xe0,0x00,0x00,0xbf,0xe5,0xd4,0x00,0x00,0xbf,0xff,
-0xe0,0x05,0x00,0x13,0xf4,0x05,0x00,0x30,0xaf,0xff,0xf4,0xea,0x06,0x10,0xf4,0xee,
-0x09,0x12,0xf4,0x5c,0x6a,0x02,0x45,0x18,0x00,0xeb,0x1d,0x20,0x08,0xff,0x57,0x03,
-0xf0,0x13,0x08,0xff,0xf9,0x6f,0x69,0xff,0x88,0xff,0xff,0xc1,0x21,0xcf,0xf8,0xdf,
-0xff,0xff,0x50,0x5f,0xff,0x82,0xef,0xff,0x71,0x91,0x7f,0xf8,0x02,0xef,0xfe,0xdf,
-0xde,0xff,0x70,0x02,0x85,0x04,0xf0,0x02,0xe3,0x01,0xdf,0xff,0xe5,0x1d,0x6c,0x5a,
-0xab,0xdf,0x3b,0x18,0x8b,0xff,0xdf,0xde,0xeb,0xae,0x00,0x0c,0x04,0x00,0x45,0xbf,
-0xff,0xff,0xf6,0xab,0x16,0x00,0xe7,0x18,0x80,0x07,0xf0,0x0b,0xf2,0x00,0x00,0x8f,
-0x0b,0x69,0x00,0x30,0xf0,0x7f,0xfa,0x1b,0x7d,0x24,0x6f,0x20,0xa1,0x12,0x0a,0x01,
-0x00,0x1f,0xfd,0xcd,0x7d,0x04,0x13,0xf8,0x08,0x00,0x17,0xf7,0x14,0x00,0x74,0xfc,
-0xfb,0x00,0xfe,0xfb,0x00,0xfa,0x88,0x3b,0x0b,0x01,0x00,0x11,0x02,0x0f,0x6d,0x0c,
-0x01,0x00,0x2f,0xf3,0x00,0x01,0x00,0x15,0x1f,0xef,0x1e,0x00,0x0a,0x03,0x88,0x00,
-0xc2,0xfb,0x00,0xff,0x00,0x00,0xf6,0xff,0xf9,0xfb,0x00,0xf9,0x00,0x4d,0x0b,0x00,
-0xfc,0x05,0x2d,0xfc,0xfd,0x92,0x00,0x6f,0xfe,0x00,0xfe,0x00,0x00,0xfc,0x4a,0x00,
-0x01,0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x16,0xff,0x00,0x01,0x13,0xfe,0x48,
-0x00,0x3f,0xfe,0xfd,0xfe,0x9c,0x00,0x0a,0x15,0x02,0x3c,0x00,0x11,0xff,0x3f,0x00,
-0x26,0xff,0xfe,0x30,0x00,0x11,0xee,0x04,0x01,0x15,0xeb,0x24,0x00,0x00,0x4b,0x00,
-0x13,0xfe,0x04,0x00,0x08,0x01,0x00,0x13,0x01,0x70,0x00,0x1f,0x01,0x6b,0x00,0x08,
-0x1f,0xfe,0x43,0x01,0x0d,0x1b,0xfb,0x25,0x00,0x12,0xfe,0x67,0x00,0x31,0xfe,0xfd,
-0xfb,0x0f,0x00,0x14,0xe6,0x6c,0x00,0x97,0xfb,0x00,0x00,0xeb,0xfc,0xf2,0xf5,0x00,
-0xed,0x08,0x02,0x25,0xf6,0xf9,0x0c,0x00,0x00,0x1d,0x44,0x35,0xf5,0x00,0xf0,0x48,
-0x01,0x10,0xff,0x65,0x01,0x01,0xe7,0x72,0x1e,0x00,0x40,0x02,0x00,0x63,0x00,0x1f,
-0xfd,0x97,0x00,0x0b,0x3e,0xfa,0x00,0xff,0x8c,0x01,0x03,0x7b,0x02,0xb1,0xef,0xee,
-0x00,0x00,0xfa,0xfe,0xed,0xff,0x01,0x00,0x01,0x60,0x00,0xd3,0xf7,0xf8,0x00,0xf7,
-0xf8,0xfa,0xf7,0x00,0xf9,0xfa,0xfc,0xfa,0xfb,0x5e,0x01,0x66,0xee,0xfd,0x00,0x00,
-0xfa,0xff,0x2b,0x01,0x50,0xfc,0xfd,0x00,0x00,0xfc,0x44,0x01,0x14,0xff,0x8b,0x02,
-0x42,0x01,0x00,0xf6,0xfb,0x51,0x00,0x13,0x01,0x24,0x00,0x04,0x68,0x01,0x27,0xff,
-0x00,0xaf,0x02,0x14,0xfc,0x20,0x01,0x15,0x01,0x51,0x01,0x27,0xfe,0x00,0x8c,0x01,
-0xf0,0x00,0xfe,0x02,0xfc,0xf0,0xfc,0x00,0x00,0xf9,0xfe,0xf9,0xff,0x01,0xf9,0x01,
-0x01,0x92,0x00,0x90,0xfa,0xfb,0xfe,0xfd,0xfb,0xfd,0xfb,0xfe,0xfd,0x4c,0x01,0x16,
-0x01,0xc5,0x00,0x09,0xa8,0x01,0x03,0x48,0x00,0x08,0xf8,0x01,0x06,0x9e,0x02,0x0f,
-0xab,0x01,0x07,0x0f,0x01,0x00,0x06,0x1f,0xff,0xf0,0x01,0x10,0x11,0xff,0x97,0x01,
-0x0e,0x5f,0x00,0x0f,0x4f,0x00,0x07,0x0f,0x1d,0x00,0x0a,0x1e,0x01,0xbd,0x03,0x19,
-0x01,0x81,0x00,0x16,0x01,0x14,0x04,0x0f,0x01,0x00,0x1e,0x0b,0xc9,0x00,0x1f,0xf5,
-0x90,0x00,0x0b,0x05,0xd7,0x01,0x1c,0xf6,0x31,0x02,0x11,0xff,0x93,0x00,0x10,0x04,
-0x2b,0x02,0x0f,0x6f,0x00,0x15,0x17,0x01,0xcc,0x04,0x06,0xa7,0x03,0x1d,0x01,0x14,
-0x01,0x1f,0xf6,0xd8,0x00,0x24,0x1f,0xfe,0x7d,0x01,0x10,0x1f,0xff,0x3d,0x00,0x1c,
-0x03,0x8c,0x01,0x21,0x02,0x03,0xc5,0x17,0x2d,0x04,0x05,0x21,0x00,0xf2,0x0c,0x06,
-0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,
-0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x57,0x12,0x70,0x1b,0x1c,0x00,
-0x1d,0x1e,0x00,0x1f,0xa5,0x08,0xe1,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,
-0x24,0x25,0x26,0x24,0x27,0x85,0x72,0x0f,0x01,0x00,0xff,0xff,0xab,0x02,0x1c,0x03,
-0x20,0x03,0x02,0x17,0x03,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x31,0x09,0x00,0x0a,
-0x8f,0x23,0x15,0x0b,0xfa,0x74,0xd1,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,
-0x14,0x00,0x00,0x15,0xbe,0x7b,0x52,0x17,0x17,0x17,0x18,0x17,0xef,0x30,0xd4,0x19,
-0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x36,0x6c,0x0c,0x01,
-0x00,0x1f,0x24,0x16,0x03,0xff,0xff,0x91,0x50,0x00,0x00,0x00,0x00,0x00,
+0xf6,0x00,0x00,0x00,0x05,0x60,0x00,0x00,0x30,0x9a,0x01,0xf1,0x1f,0xaf,0xef,0x60,
+0x00,0xaf,0x90,0xcf,0x60,0x9f,0x80,0x00,0xcf,0x57,0x80,0x00,0x00,0xa4,0x11,0x00,
+0x00,0x02,0x0c,0xe2,0x00,0x05,0xf8,0x3f,0xe2,0x05,0xfd,0x10,0x3f,0xe7,0xfd,0x10,
+0x00,0x3f,0xfd,0x10,0x00,0x00,0x3b,0x10,0x00,0x00,0x80,0x67,0x00,0xf0,0x21,0xcf,
+0xc3,0xff,0xff,0xf5,0x00,0xbe,0xfe,0xb3,0x44,0x4e,0x60,0x04,0x3f,0x34,0x00,0x00,
+0xd6,0x00,0x02,0xf2,0x00,0x00,0x0d,0x60,0x00,0x2f,0x20,0x00,0x8c,0xea,0xf1,0x01,
+0xff,0xff,0xf7,0xdf,0xf7,0x00,0x04,0x44,0x44,0x11,0xc7,0x00,0x58,0x88,0x20,0xb0,
+0x02,0x50,0xe4,0x44,0x41,0xff,0xff,0x3b,0x05,0x1e,0xff,0x01,0x00,0x02,0x26,0x03,
+0xf0,0x00,0x00,0x33,0x00,0x00,0x00,0x03,0xff,0x40,0x00,0x00,0x3f,0xff,0xf4,0x00,
+0x02,0xe4,0x05,0x92,0x00,0x36,0xff,0x63,0x00,0x00,0x04,0xff,0x40,0x05,0x00,0xb5,
+0x9a,0xa5,0xff,0x5a,0xa9,0xff,0xff,0xdd,0xfe,0xdf,0xff,0x5c,0x04,0x00,0x01,0x00,
+0x10,0xa8,0xc2,0x03,0x20,0x5f,0xff,0x64,0x05,0x20,0xff,0xe0,0xdb,0x04,0x11,0xfa,
+0xa6,0x00,0x10,0x50,0x16,0x00,0xb0,0xd0,0x00,0x39,0x10,0x4f,0xf4,0x00,0xbf,0xfc,
+0x9f,0xf6,0xdc,0x02,0xa4,0xe4,0x00,0x00,0x9f,0xfd,0x81,0x00,0x00,0x01,0x31,0x3d,
+0x00,0xf5,0x31,0x06,0xfe,0x30,0x05,0xc6,0xe7,0xbb,0x05,0xff,0x4d,0xbd,0xb4,0xff,
+0x40,0x3c,0xff,0xff,0x40,0x00,0x08,0xff,0xb0,0x00,0x6f,0xff,0xdf,0x80,0x0e,0x7b,
+0xb2,0xef,0x80,0xdb,0xd9,0x02,0xef,0x73,0xca,0x10,0x02,0x72,0x00,0x5d,0xdd,0x48,
+0x00,0x08,0xff,0xf6,0xf8,0xcc,0x8f,0xff,0x84,0x3f,0xe8,0xff,0xff,0xfc,0xfe,0x8f,
+0xff,0xff,0xcf,0x09,0x00,0x10,0xe7,0x1e,0x03,0x40,0x46,0x66,0x66,0x3f,0xe7,0x04,
+0xf1,0x0d,0x34,0x44,0x43,0x00,0x00,0x02,0x22,0x22,0x00,0x0e,0xff,0xff,0xfe,0x20,
+0xf5,0x22,0x22,0xfe,0x1f,0x40,0x00,0x0e,0xf8,0xf7,0x44,0x44,0xff,0x9f,0x62,0x03,
+0xf0,0x07,0xf6,0x0c,0xff,0x9f,0xff,0x20,0x9f,0xf9,0xff,0xfc,0x7f,0xff,0x9a,0xdd,
+0xdd,0xdd,0xd4,0x67,0x77,0x77,0x77,0x4e,0xad,0x02,0x01,0x95,0x00,0x40,0x77,0x77,
+0x77,0x74,0xe3,0x01,0x10,0xb0,0x0e,0x00,0x50,0x45,0x55,0x55,0x55,0x3f,0x1b,0x00,
+0x60,0x11,0x11,0x11,0x11,0x00,0x58,0x29,0x03,0x01,0x38,0x01,0x00,0xdc,0x02,0xf7,
+0x00,0xf6,0xc5,0xdf,0xff,0xfd,0x5c,0xfe,0x6a,0xff,0xa5,0xef,0xff,0xf9,0x55,0x9f,
+0x51,0x01,0xf0,0x06,0x03,0xaa,0xa2,0x00,0x07,0xff,0xf2,0x00,0x09,0xff,0xd0,0x00,
+0x0b,0xff,0xd8,0x81,0x0e,0xff,0xff,0xe1,0x0e,0xac,0x05,0xe1,0x05,0xfd,0x00,0x00,
+0x09,0xf4,0x00,0x00,0x0d,0xa0,0x00,0x00,0x0f,0x20,0xa5,0x03,0xf0,0x2b,0x01,0x79,
+0x11,0x00,0x0f,0xfc,0x9f,0xf4,0x00,0xff,0xfd,0xcc,0x30,0x0f,0xfa,0x79,0x93,0x40,
+0xff,0x8e,0xff,0x6f,0x5f,0xf8,0xef,0xf7,0x64,0xff,0x8e,0xff,0xff,0xcf,0xf8,0xef,
+0xff,0xfc,0x46,0x3e,0xff,0xff,0xc0,0x00,0xdf,0xff,0xfc,0x00,0x02,0x44,0x44,0x20,
+0x00,0x01,0x90,0x00,0x00,0x02,0xaf,0x81,0xa9,0x01,0xa0,0xd0,0x00,0x9f,0xff,0xff,
+0x50,0x0c,0xff,0xff,0xf8,0x97,0x02,0x51,0xa0,0x3f,0xff,0xff,0xfe,0xd8,0x03,0x91,
+0x46,0x66,0x66,0x66,0x20,0x00,0xbf,0x70,0x00,0x6e,0x02,0x00,0x2f,0x05,0x21,0x44,
+0x30,0xa0,0x00,0xf3,0x0f,0xf3,0xf4,0xa0,0xa0,0xb0,0xb0,0xf4,0xff,0xbe,0xae,0xae,
+0xaf,0xf4,0xff,0x3a,0x0a,0x0a,0x0f,0xf4,0xfb,0xea,0xaa,0xaa,0xea,0xf4,0xf7,0xb4,
+0x44,0x44,0xc4,0x06,0x06,0x00,0xfa,0x00,0x10,0x29,0x3c,0x00,0x10,0x3a,0xd5,0x01,
+0xb0,0x4b,0xff,0xff,0x70,0x00,0x5d,0xff,0xff,0xff,0x10,0x0c,0x5b,0x00,0xc1,0x00,
+0x0a,0xee,0xef,0xff,0xf2,0x00,0x00,0x00,0x0a,0xff,0xa0,0x06,0x00,0x10,0x30,0x06,
+0x00,0x01,0x3c,0x01,0x21,0x08,0xf4,0xd8,0x01,0xf0,0x04,0x20,0x00,0x00,0xef,0xff,
+0x5b,0x00,0xff,0xff,0x6f,0xb0,0xff,0xff,0x68,0x83,0xff,0xff,0xfd,0xd6,0x24,0x05,
+0x1e,0xff,0x04,0x00,0x02,0x95,0x03,0x02,0x2b,0x08,0xd0,0x05,0xbf,0xff,0xfd,0x81,
+0x00,0x2c,0xfe,0xa8,0x78,0xcf,0xf7,0x0d,0x19,0x00,0xf0,0x05,0x3c,0xf5,0x22,0x05,
+0xbe,0xfd,0x81,0x05,0x00,0x09,0xfe,0xa9,0xcf,0xe2,0x00,0x00,0x37,0x00,0x00,0x38,
+0x2e,0x00,0x11,0x8c,0x05,0x06,0x12,0x0f,0x3c,0x00,0x61,0x58,0x10,0x00,0x00,0xcf,
+0xff,0xcb,0x04,0xd0,0x75,0x55,0x55,0x55,0x5a,0xf2,0xf6,0xff,0xff,0xff,0xfd,0x4f,
+0x5f,0xa1,0x01,0x91,0xd1,0xf5,0xf5,0x77,0x77,0x77,0x76,0x8f,0x4f,0xfa,0x00,0x11,
+0xd0,0x06,0x01,0x17,0x41,0x2e,0x00,0x21,0x54,0x4a,0x2e,0x00,0x11,0x00,0x2e,0x00,
+0x21,0xf0,0x01,0x2e,0x00,0x1f,0x00,0x2e,0x00,0x05,0x21,0x54,0x44,0x2e,0x00,0x11,
+0x20,0x2e,0x00,0x21,0xf2,0x00,0x2e,0x00,0x1f,0x10,0x2e,0x00,0x05,0x21,0x54,0x44,
+0x2e,0x00,0x20,0x50,0x00,0x2e,0x00,0x21,0xf5,0x00,0x2e,0x00,0x2f,0x20,0x00,0x2e,
+0x00,0x02,0x40,0xfa,0x0f,0x74,0x44,0x2e,0x00,0x11,0xf4,0x87,0x04,0x30,0x5f,0x40,
+0x00,0x2e,0x00,0x01,0x0d,0x00,0x0a,0x2e,0x00,0x00,0x12,0x00,0x20,0x5b,0x10,0xa8,
+0x03,0x11,0xbd,0x1e,0x00,0xf1,0x0d,0xa1,0x03,0x00,0x00,0x0a,0xf7,0x39,0x00,0x00,
+0x07,0x60,0xff,0xea,0xbf,0xaa,0xaa,0xdf,0x45,0xa3,0x00,0x93,0x00,0x04,0x10,0x00,
+0x00,0x01,0xb8,0x8d,0x01,0x44,0x02,0x9f,0xb0,0x00,0x9b,0x05,0xf2,0x1c,0x6b,0xca,
+0x40,0x00,0x9f,0xf6,0xff,0x40,0x1f,0xff,0x26,0xfb,0x04,0xf6,0xb4,0x6b,0xf0,0x6f,
+0xf4,0x06,0xff,0x06,0xff,0x90,0xbf,0xf0,0x5f,0x95,0x34,0xcf,0x02,0xfb,0xf3,0x4d,
+0xc0,0x0c,0xff,0x3d,0xf7,0x00,0x1b,0xfe,0xf9,0x32,0x00,0x50,0x12,0x3b,0xca,0x22,
+0x1f,0xf8,0x02,0x50,0x36,0x66,0x66,0x66,0x16,0xf0,0x04,0x8a,0x6f,0x6f,0x6f,0x7f,
+0x26,0xf6,0xf6,0xf7,0x09,0x00,0x91,0x24,0xff,0xff,0xff,0xf1,0x03,0x44,0x44,0x42,
+0x6b,0x00,0x20,0x97,0x00,0xfe,0x05,0xf0,0x02,0xf8,0x00,0x00,0x00,0xa5,0xef,0xe0,
+0x00,0x00,0xbf,0xe5,0xd4,0x00,0x00,0xbf,0xff,0xe0,0x05,0x00,0x13,0xf4,0x05,0x00,
+0x30,0xaf,0xff,0xf4,0xea,0x06,0x00,0xc3,0x00,0x01,0x05,0x00,0x21,0x02,0x20,0x3a,
+0x00,0x80,0x05,0x88,0x88,0x88,0x86,0x00,0x08,0xff,0x57,0x03,0xf0,0x13,0x08,0xff,
+0xf9,0x6f,0x69,0xff,0x88,0xff,0xff,0xc1,0x21,0xcf,0xf8,0xdf,0xff,0xff,0x50,0x5f,
+0xff,0x82,0xef,0xff,0x71,0x91,0x7f,0xf8,0x02,0xef,0xfe,0xdf,0xde,0xff,0x70,0x02,
+0x85,0x04,0xf0,0x02,0xe3,0x01,0xdf,0xff,0xe5,0x1d,0x6c,0x5a,0xab,0xdf,0x3b,0x18,
+0x8b,0xff,0xdf,0xde,0xeb,0xae,0x00,0x0c,0x04,0x00,0x44,0xbf,0xff,0xff,0xf6,0x6e,
+0x04,0xd0,0x0a,0x00,0x08,0x10,0x00,0x07,0xf0,0x0b,0xf2,0x00,0x00,0x8f,0x0b,0x69,
+0x00,0xf0,0x03,0xf0,0x7f,0xfa,0x99,0x99,0x99,0x00,0x6f,0x20,0x00,0x00,0x00,0x00,
+0x30,0x00,0x00,0x00,0x00,
+};
+
+static const etxFontBlock blocks[] = {
+{ .bitmap_index = 0, .comp_offset = 0, .size = 4044, .comp_size = 3597 },
+{ .bitmap_index = 4044, .comp_offset = 3597, .size = 4091, .comp_size = 3717 },
+{ .bitmap_index = 8135, .comp_offset = 7314, .size = 4082, .comp_size = 3712 },
+{ .bitmap_index = 12217, .comp_offset = 11026, .size = 4082, .comp_size = 3779 },
+{ .bitmap_index = 16299, .comp_offset = 14805, .size = 4080, .comp_size = 3832 },
+{ .bitmap_index = 20379, .comp_offset = 18637, .size = 4075, .comp_size = 3910 },
+{ .bitmap_index = 24454, .comp_offset = 22547, .size = 4065, .comp_size = 3875 },
+{ .bitmap_index = 28519, .comp_offset = 26422, .size = 4049, .comp_size = 3789 },
+{ .bitmap_index = 32568, .comp_offset = 30211, .size = 2984, .comp_size = 2562 },
 };
 
 static const etxFontCmap cmaps[] = {
@@ -2353,11 +2446,11 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 63475, .glyph_id_start = 115, .list_length = 681, .type = 3, .unicode_list = 6368, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[46578] __SDRAMFONTS;
+static uint8_t etxUncompBuf[11026] __SDRAMFONTS;
 
 const etxLz4Font lv_font_cn_XS = {
-.uncomp_size = 46314,
-.comp_size = 37470,
+.uncomp_size = 10762,
+.comp_size = 5933,
 .line_height = 13,
 .base_line = 3,
 .subpx = 0,
@@ -2370,12 +2463,15 @@ const etxLz4Font lv_font_cn_XS = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 7730,
-.class_pair_values = 43282,
-.left_class_mapping = 44722,
-.right_class_mapping = 45518,
+.glyph_bitmap = 0,
+.class_pair_values = 7730,
+.left_class_mapping = 9170,
+.right_class_mapping = 9966,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 46578,
+.lvglFontBufSize = 11026,
+.block_count = 9,
+.blocks = blocks,
+.compressed_bitmap = lz4BitmapData,
 };
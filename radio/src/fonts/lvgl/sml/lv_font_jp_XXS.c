@@ -185,7 +185,7 @@ static const uint8_t lz4FontData[] ={
 0x13,0x46,0x08,0x00,0x13,0x64,0x08,0x00,0x13,0x82,0x08,0x00,0x50,0xa0,0x3c,0x00,
 0x0a,0x0b,0x48,0x04,0x12,0x3c,0x58,0x00,0x13,0xe8,0x08,0x00,0x22,0x04,0x3d,0x68,
 0x03,0x22,0x2d,0x3d,0x28,0x00,0x50,0x4b,0x3d,0x00,0x06,0x07,0x60,0x0a,0x50,0x3d,
-0x10,0x08,0x09,0x06,0x20,0x12,0xf0,0xff,0xff,0xff,0x51,0x72,0x1f,0xb5,0x21,0x51,
+0x10,0x08,0x09,0x06,0x20,0x12,0xf8,0xff,0xff,0xff,0x3e,0x72,0x1f,0xb5,0x21,0x51,
 0x2f,0x52,0x2f,0x92,0x2f,0x94,0x2f,0x98,0x2f,0x9a,0x2f,0x9b,0x2f,0x9c,0x2f,0x9d,
 0x2f,0x9e,0x2f,0x9f,0x2f,0xa1,0x2f,0xa3,0x2f,0xa5,0x2f,0xa7,0x2f,0xa8,0x2f,0xa9,
 0x2f,0xaa,0x2f,0xab,0x2f,0xad,0x2f,0xaf,0x2f,0xb0,0x2f,0xb3,0x2f,0xb4,0x2f,0xb6,
@@ -238,552 +238,668 @@ static const uint8_t lz4FontData[] ={
 0xa4,0xbf,0xa6,0xbf,0xd5,0xbf,0xd6,0xbf,0xd8,0xbf,0xda,0xbf,0xf1,0xbf,0xf8,0xbf,
 0xfb,0xbf,0x04,0xc0,0x2d,0xc0,0x35,0xc0,0x6c,0xc0,0xfc,0xc0,0x51,0xc1,0x52,0xc1,
 0x53,0xc1,0x54,0xc1,0x55,0xc1,0x98,0xc1,0xa4,0xc1,0xfe,0xc1,0x15,0xc2,0x6b,0xc4,
-0xd3,0xc6,0xb3,0xc7,0x56,0x56,0x55,0x34,0x34,0x77,0x25,0x50,0x00,0x86,0x21,0xaa,
-0xc6,0x06,0x29,0x04,0xc8,0xc4,0x08,0x35,0x61,0x03,0xf0,0x37,0x1a,0x00,0x2b,0x5b,
-0x04,0x80,0x50,0x0a,0xb3,0x01,0x01,0xc0,0x66,0x1c,0x00,0x6c,0x20,0x00,0x10,0x00,
-0x67,0x70,0x20,0x36,0x47,0x00,0x00,0x58,0x82,0x02,0x68,0x17,0x03,0x07,0x84,0x0b,
-0xa6,0x00,0xb6,0x50,0x1a,0xb0,0x48,0x34,0xb6,0x39,0x8b,0x80,0x96,0x03,0x50,0x90,
-0x46,0x06,0x40,0x64,0x03,0x70,0x09,0x00,0x14,0x71,0x01,0x80,0x0a,0x00,0x82,0x09,
-0x20,0xa0,0x71,0x12,0xf0,0xff,0x0d,0x00,0x6d,0x92,0x37,0x80,0x00,0x00,0x01,0x80,
-0x00,0x1a,0x00,0x6a,0xda,0x20,0x1a,0x00,0x82,0x70,0x78,0x00,0x44,0x00,0x90,0x03,
-0x60,0x09,0x00,0x18,0x00,0x72,0x00,0x40,0x00,0x1a,0x97,0x07,0x30,0xb0,0x82,0x0b,
-0x07,0x40,0xb0,0x1a,0x97,0x00,0x18,0xb1,0x0b,0x00,0xb0,0x0b,0x00,0xb0,0x3a,0x98,
-0x04,0x10,0xb0,0x00,0x65,0x00,0x76,0x00,0x6c,0x88,0x10,0x3a,0x97,0x31,0x0b,0x04,
-0xc6,0x30,0x0b,0x3a,0x97,0x00,0x98,0x00,0x68,0x80,0x28,0x38,0x08,0x8a,0xc2,0x00,
-0x38,0x00,0x0d,0xaa,0x01,0xd9,0x60,0x01,0x0b,0x12,0x30,0x91,0x0a,0x98,0x00,0x06,
-0x82,0x03,0xb9,0x50,0x75,0x0b,0x06,0x50,0xa0,0x0a,0x97,0x00,0x69,0x9d,0x10,0x02,
-0x80,0x00,0x91,0x00,0x28,0x00,0x0a,0x10,0x00,0x1a,0x97,0x05,0x60,0xb0,0x1c,0xb7,
-0x07,0x30,0xb0,0x3a,0x99,0x00,0x3a,0x95,0x82,0x0b,0x19,0x8c,0x00,0x1b,0x07,0xa2,
-0x43,0x00,0x00,0x43,0x52,0x00,0x00,0x52,0x91,0x00,0x02,0x85,0x8a,0x10,0x07,0xa3,
-0x00,0x01,0x39,0x97,0x00,0x00,0x39,0x97,0x58,0x20,0x01,0x8a,0x3a,0x71,0x10,0x00,
-0x5a,0xb2,0x20,0x56,0x02,0x90,0x04,0x10,0x06,0x10,0x03,0x87,0x87,0x01,0x80,0x77,
-0x26,0x62,0x81,0x90,0x88,0x0a,0x09,0x08,0x36,0x87,0xa7,0x40,0x67,0x75,0x00,0x00,
-0xe2,0x00,0x05,0x79,0x00,0x0b,0x0a,0x10,0x3c,0x9b,0x70,0xa1,0x00,0xb0,0x5b,0x9a,
-0x15,0x60,0x74,0x5b,0x9c,0x15,0x60,0x47,0x5b,0x9b,0x20,0x09,0x9a,0x46,0x60,0x07,
-0x83,0x00,0x06,0x60,0x07,0x09,0x9a,0x30,0x5b,0x99,0x15,0x60,0x29,0x56,0x00,0xc5,
-0x60,0x39,0x5b,0x9a,0x10,0x5b,0x99,0x25,0x60,0x00,0x5b,0x97,0x05,0x60,0x00,0x5b,
-0x99,0x20,0x1a,0x00,0x02,0x0d,0x00,0xf2,0x0a,0x56,0x00,0x00,0x09,0x9a,0x55,0x60,
-0x04,0x83,0x19,0xa5,0x70,0x0c,0x08,0x99,0x70,0x56,0x00,0xb0,0x56,0x00,0xb0,0x5b,
-0x99,0xe0,0x09,0x00,0x10,0x47,0x01,0x00,0x20,0x00,0x0c,0x02,0x00,0xf1,0x06,0x50,
-0x0b,0x5a,0xa5,0x56,0x08,0x50,0x56,0x95,0x00,0x5d,0xc0,0x00,0x57,0x3a,0x00,0x56,
-0x04,0x90,0x56,0x00,0x42,0x00,0x01,0x54,0x00,0xf0,0x1f,0x00,0x5d,0x00,0x0d,0x55,
-0xc4,0x05,0xc5,0x56,0xa0,0xb6,0x55,0x67,0x77,0x65,0x56,0x1e,0x16,0x50,0x5c,0x00,
-0xb0,0x5b,0x80,0xb0,0x56,0x94,0xb0,0x56,0x0b,0xc0,0x56,0x02,0xf0,0x09,0x9a,0x30,
-0x66,0x00,0xc0,0x83,0x00,0xb0,0x66,0x00,0xc0,0x9e,0x00,0x73,0x9a,0x45,0x60,0x1b,
-0x5b,0x89,0x35,0x84,0x00,0xf1,0x23,0x30,0x65,0x00,0xc0,0x92,0x00,0xc0,0x65,0x00,
-0xc0,0x09,0x9c,0x40,0x00,0x02,0x80,0x5b,0x9a,0x25,0x60,0x47,0x5b,0xab,0x15,0x60,
-0xb0,0x56,0x04,0x70,0x2a,0x89,0x16,0x60,0x22,0x06,0x97,0x05,0x10,0x65,0x3a,0x9a,
-0x20,0x79,0xe9,0x50,0x0c,0x00,0x00,0xc0,0x00,0x05,0x00,0xf2,0x31,0x74,0x01,0xa7,
-0x40,0x1a,0x74,0x01,0xa6,0x50,0x2a,0x1a,0x9a,0x20,0xa1,0x00,0xb4,0x70,0x65,0x0a,
-0x0a,0x00,0x65,0x80,0x00,0xe1,0x00,0xa1,0x0d,0x10,0xb5,0x63,0xb6,0x38,0x1a,0x82,
-0xa7,0x30,0xba,0x09,0xb0,0x08,0x70,0x4a,0x00,0x67,0x07,0x60,0x95,0xa0,0x02,0xf2,
-0x00,0xa6,0xa0,0x67,0x07,0x70,0x93,0x06,0x61,0xa0,0xb0,0x06,0xb2,0x46,0x00,0xf2,
-0x02,0x59,0x9e,0x40,0x04,0x80,0x02,0xa0,0x00,0xb1,0x00,0x9b,0x99,0x40,0x59,0x06,
-0x40,0x64,0x03,0x00,0xf1,0x01,0x05,0x90,0x91,0x00,0x37,0x00,0x0a,0x00,0x05,0x50,
-0x00,0xa0,0x00,0x40,0x86,0x38,0x01,0x00,0xf0,0x33,0x96,0x05,0x00,0x1b,0x60,0x82,
-0xa0,0x88,0x85,0x47,0x39,0x96,0x18,0x7b,0x83,0x0b,0x4b,0x9b,0x74,0x00,0x07,0xa9,
-0x80,0x74,0x0a,0x07,0x40,0xa0,0x7a,0x98,0x00,0x19,0x97,0x82,0x04,0x92,0x03,0x2a,
-0x96,0x00,0x0b,0x2b,0x8d,0x83,0x0b,0x82,0x0b,0x2a,0x8d,0x19,0x97,0x89,0x8a,0x94,
-0x00,0x2b,0x87,0x08,0x71,0xa0,0x7d,0x41,0xa0,0x1a,0x01,0xa0,0x19,0x00,0xc0,0x83,
-0x0b,0x2b,0x9d,0x18,0x97,0x74,0x00,0x7a,0xa8,0x74,0x0b,0x02,0x00,0x71,0x43,0x65,
-0x65,0x65,0x65,0x04,0x20,0x79,0x00,0xf0,0x01,0x42,0xb2,0x74,0x00,0x07,0x48,0x60,
-0x7b,0x70,0x07,0x8b,0x00,0x74,0x39,0x00,0x65,0x01,0x00,0xe4,0x7a,0xaa,0x9b,0x37,
-0x40,0xc0,0x47,0x74,0x0b,0x04,0x77,0x40,0xb0,0x47,0x36,0x00,0xf0,0x02,0x19,0x98,
-0x08,0x20,0x91,0x82,0x09,0x11,0xa8,0x70,0x7a,0x88,0x07,0x40,0xa0,0x74,0x0b,0x89,
-0x00,0x24,0x00,0x00,0x7a,0x00,0xf2,0x0b,0x00,0x0b,0x00,0x07,0xb5,0x74,0x07,0x40,
-0x74,0x00,0x3a,0xa5,0x49,0x32,0x22,0x68,0x3a,0x96,0x38,0x09,0xc2,0x38,0x02,0x80,
-0x0c,0x30,0x3f,0x00,0xf0,0x28,0x2b,0x9c,0xa1,0x38,0x46,0x82,0x0a,0xa0,0x08,0x60,
-0xa0,0x77,0x0a,0x64,0x99,0x45,0x1b,0x77,0xa1,0x0c,0x22,0xb0,0x75,0x66,0x0a,0xa0,
-0x0a,0xa0,0x75,0x57,0xa1,0x37,0x46,0x81,0x09,0x80,0x08,0x30,0x69,0x00,0x59,0xc7,
-0x02,0xb0,0x0b,0x10,0x8b,0x86,0x00,0x00,0x75,0x0b,0x00,0xb0,0x96,0x27,0x03,0x41,
-0x75,0x00,0x00,0x54,0x01,0x00,0xf2,0x20,0x22,0x00,0x08,0x30,0x29,0x01,0xa0,0x0a,
-0x40,0xa0,0x29,0x08,0x30,0x00,0x00,0x19,0x70,0x74,0x23,0x95,0x00,0x00,0x20,0x00,
-0x00,0x00,0xc9,0x00,0x1b,0xaa,0xa5,0x90,0x18,0x00,0x00,0x86,0x1d,0xaa,0x93,0xa0,
-0x00,0x00,0xba,0x00,0x00,0x00,0x40,0x69,0x19,0xf0,0x03,0x4f,0x00,0x00,0x04,0x98,
-0xaa,0xa6,0x0c,0x00,0x00,0x18,0x05,0x76,0xaa,0xb8,0x00,0x6e,0x00,0xc9,0x06,0xf0,
-0x0e,0x00,0x00,0x07,0x20,0x00,0x08,0x7b,0x10,0x08,0x60,0x1b,0x11,0xad,0x08,0xb5,
+0xd3,0xc6,0xb3,0xc7,0x00,0x01,0x00,0x2f,0xfe,0x00,0x01,0x00,0x56,0x1b,0xf9,0x08,
+0x00,0x00,0x01,0x00,0xbf,0xfd,0xfc,0x00,0xff,0xfc,0x00,0xfb,0x00,0x00,0x00,0x01,
+0x85,0x00,0x53,0x2f,0x01,0x01,0x6a,0x00,0x54,0x2f,0xf5,0x00,0x01,0x00,0x68,0x1f,
+0xf2,0x71,0x00,0x5d,0x03,0xd4,0x01,0xb1,0xfc,0x00,0xff,0x00,0x00,0xf8,0xff,0xfb,
+0xfc,0x00,0xfa,0x11,0x00,0x00,0x0f,0x00,0x4f,0xff,0xff,0xfd,0xfe,0x74,0x01,0x51,
+0x10,0xfe,0x6d,0x00,0x1f,0xfd,0xf0,0x00,0x54,0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,
+0x00,0x1f,0xff,0x79,0x00,0x46,0x13,0xfa,0x5e,0x00,0x00,0xee,0x00,0x3f,0xff,0xfd,
+0xff,0xe8,0x01,0x5d,0x15,0x01,0xe2,0x00,0x11,0xff,0x87,0x00,0x2f,0xff,0xfe,0x83,
+0x00,0x4a,0x11,0xf1,0x49,0x03,0x15,0xf0,0x77,0x00,0x20,0xfe,0xff,0x73,0x00,0x01,
+0x7e,0x00,0x0f,0xea,0x00,0x51,0x10,0xfe,0x08,0x00,0x1f,0xfe,0x61,0x01,0x5a,0x1f,
+0xff,0x2e,0x04,0x60,0x1b,0xfc,0x08,0x06,0x10,0xfe,0x64,0x01,0x00,0x69,0x01,0x1f,
+0xfc,0x72,0x00,0x45,0x14,0xeb,0x65,0x01,0x97,0xfc,0x00,0x00,0xef,0xfd,0xf5,0xf7,
+0x00,0xf1,0x13,0x06,0x2f,0xf8,0xfa,0xed,0x00,0x49,0x73,0xec,0x00,0x00,0x00,0xf7,
+0x00,0xf4,0xe9,0x00,0x10,0xfe,0x4b,0x02,0x00,0x75,0x01,0x0f,0x17,0x06,0x55,0x10,
+0xfd,0xc4,0x02,0x1f,0xfe,0xe3,0x01,0x5e,0x1f,0xfb,0x1d,0x05,0x56,0x11,0xfe,0x80,
+0x06,0x83,0xf2,0x00,0x00,0xfb,0xfe,0xf1,0xff,0x01,0x70,0x07,0xdf,0xf9,0xfa,0x00,
+0xf9,0xfa,0xfb,0xf9,0x00,0xfa,0xfc,0xfc,0xfb,0xfc,0xb2,0x03,0x47,0x66,0xf2,0xfe,
+0x00,0x00,0xfb,0xff,0x11,0x00,0x62,0xfd,0xfd,0x00,0x00,0xfd,0xfe,0x37,0x04,0x2f,
+0x00,0x01,0x77,0x00,0x46,0x22,0xf8,0xfc,0x5c,0x01,0x13,0x01,0x11,0x00,0x23,0xfe,
+0xfe,0xaa,0x04,0x1f,0x00,0xd8,0x08,0x4b,0x14,0xfd,0x6f,0x01,0x15,0x01,0x7b,0x01,
+0x02,0x94,0x05,0x0f,0xde,0x01,0x48,0xe0,0x01,0xfd,0xf3,0xfd,0x00,0x00,0xfa,0xfe,
+0xfa,0xff,0x01,0xfa,0x01,0x01,0xde,0x01,0x70,0xfb,0xfc,0xff,0xfe,0xfc,0xfe,0xfc,
+0x0a,0x06,0x3f,0xff,0xfe,0x01,0x64,0x02,0x4a,0x09,0x8c,0x05,0x14,0xff,0xee,0x00,
+0x1f,0xfe,0x96,0x05,0x52,0x1f,0xff,0x8f,0x05,0x5a,0x0f,0x20,0x06,0x60,0x1f,0xfe,
+0x77,0x00,0x0b,0x2f,0xff,0xff,0xf1,0x06,0xb7,0x0e,0x77,0x00,0x0f,0x94,0x00,0x55,
+0x1e,0x01,0x10,0x04,0x19,0x01,0x6f,0x00,0x0f,0x2f,0x04,0x43,0x0f,0x52,0x07,0x4a,
+0x0f,0xf1,0x01,0x7e,0x1f,0xf8,0xca,0x02,0x63,0x1d,0x01,0x7b,0x00,0x00,0x07,0x06,
+0x01,0xdf,0x01,0x10,0x03,0x08,0x07,0x0f,0x68,0x01,0xbb,0x1b,0x01,0xca,0x0f,0x02,
+0x15,0x0c,0x1f,0x01,0xd0,0x03,0x51,0x1f,0xf8,0xca,0x02,0x77,0x1f,0xff,0x77,0x00,
+0xcc,0x0f,0xe3,0x00,0x64,0x0f,0x04,0x09,0x18,0x0f,0x71,0x08,0x0c,0x0b,0xed,0x03,
+0x1f,0xfd,0xa4,0x07,0x35,0x1f,0xfc,0x9f,0x0d,0x58,0x05,0x6d,0x00,0x21,0xfc,0xfa,
+0x0a,0x00,0x1e,0xf7,0x25,0x08,0x0e,0x35,0x08,0x03,0x1d,0x01,0x3f,0xfd,0xfd,0xfd,
+0x54,0x01,0x34,0x1f,0xfb,0xcb,0x01,0x6d,0x0f,0x01,0x00,0x44,0x2f,0xf7,0xfa,0xe7,
+0x00,0x06,0x0f,0x91,0x00,0x49,0x13,0xfa,0x77,0x00,0x1f,0x03,0x5e,0x01,0x54,0x0f,
+0xca,0x02,0x0d,0x1f,0x05,0xee,0x00,0x52,0x0f,0x1e,0x04,0x5d,0x0a,0x5c,0x02,0x1f,
+0xf7,0x9e,0x04,0x64,0x1e,0xf8,0x2f,0x04,0x0f,0x63,0x02,0x41,0x2b,0xf6,0xf3,0xca,
+0x02,0x02,0x75,0x08,0x1f,0xf7,0x2b,0x04,0x11,0x03,0x54,0x07,0x3f,0xf4,0xf7,0xf4,
+0x41,0x03,0x1f,0x1e,0xf3,0x77,0x08,0x0f,0x74,0x0a,0x15,0x13,0xf7,0x07,0x00,0x2f,
+0xf7,0xf7,0x3f,0x0d,0x53,0x0f,0xfa,0x05,0x47,0x0f,0xbd,0x04,0x5d,0x00,0x5f,0x01,
+0x1f,0x04,0x38,0x12,0x4f,0x0f,0x98,0x04,0x62,0x00,0x28,0x12,0x22,0x00,0xfc,0xf9,
+0x06,0x00,0xd0,0x01,0x23,0xf8,0xfd,0x63,0x01,0x10,0xfa,0xf7,0x00,0x1f,0xfd,0xee,
+0x00,0x48,0x0f,0xed,0x08,0x62,0x16,0xfb,0xe9,0x07,0x00,0xee,0x00,0x20,0xfc,0xfb,
+0x08,0x00,0x3f,0xff,0x00,0xfa,0x68,0x10,0x51,0x00,0x22,0x13,0x2f,0x01,0x01,0xbe,
+0x02,0x5e,0x0f,0xa6,0x03,0x4d,0x0f,0x6b,0x08,0x83,0x02,0xeb,0x04,0x1f,0xfa,0x64,
+0x02,0x62,0x1f,0xfb,0x66,0x00,0x5c,0x1f,0xfc,0xd5,0x08,0x58,0x18,0xfc,0xea,0x07,
+0x01,0x87,0x00,0x2f,0xfb,0xfd,0x4f,0x02,0x5b,0x1f,0xfd,0x16,0x0c,0x58,0x0c,0xdc,
+0x00,0x0f,0x5a,0x10,0x5e,0x0f,0xb2,0x0a,0x18,0x1f,0xfd,0x46,0x0c,0x2e,0x0c,0x39,
+0x11,0x1f,0xfd,0x7b,0x0d,0x59,0x0f,0x4e,0x13,0x67,0x1f,0xfd,0x39,0x0b,0x5a,0x2f,
+0xf3,0xf3,0xba,0x01,0x0c,0x17,0xfa,0x8d,0x00,0x18,0xfb,0x1d,0x00,0x32,0xfd,0x00,
+0xf4,0x6d,0x03,0x10,0xfd,0x6d,0x0e,0x23,0xf7,0xfa,0x04,0x0a,0x2f,0xfb,0xf8,0x87,
+0x05,0x35,0x00,0xb8,0x1a,0x06,0x5e,0x03,0x00,0x62,0x04,0x13,0xfd,0xb7,0x06,0x18,
+0xfd,0xf4,0x03,0x1f,0xfc,0xc3,0x06,0x18,0x1f,0xfc,0xfe,0x05,0x63,0x2f,0xf8,0xf8,
+0x9c,0x06,0x33,0x1f,0xfc,0x04,0x0d,0x24,0x0f,0x71,0x06,0x89,0x1e,0xfc,0x16,0x0c,
+0x0f,0xf7,0x00,0x23,0x2f,0xf4,0xf6,0x19,0x15,0x12,0x26,0xfb,0xfb,0x0a,0x02,0x05,
+0xaa,0x00,0x26,0xf8,0xfa,0x6e,0x03,0x2f,0xf6,0xfb,0x6c,0x01,0x1a,0x2f,0xf7,0xf6,
+0xdc,0x01,0x1d,0x1e,0x01,0xa1,0x01,0x0f,0xad,0x01,0x1f,0x2f,0xf6,0xf4,0xfd,0x01,
+0x21,0x02,0x86,0x00,0x44,0xf8,0xfb,0xfb,0xfb,0x75,0x0a,0x25,0xf7,0xfc,0x8f,0x25,
+0x0f,0x77,0x00,0x12,0x1f,0xf6,0x61,0x03,0x0e,0x1f,0xfd,0x1c,0x00,0x07,0x05,0x05,
+0x01,0x2f,0xff,0xfa,0xcb,0x05,0x3d,0x0f,0x71,0x08,0x42,0x2f,0xf4,0xf4,0x6f,0x03,
+0x27,0x12,0xfd,0x65,0x01,0x0f,0xdc,0x01,0x22,0x1f,0xf7,0xee,0x17,0x27,0x0e,0x53,
+0x02,0x0f,0x1b,0x0b,0x53,0x06,0xab,0x14,0x0f,0x51,0x15,0x50,0x25,0xfd,0xfd,0x32,
+0x22,0x08,0x5b,0x05,0x1f,0xfa,0xe7,0x11,0x5b,0x00,0xbc,0x10,0x1f,0xfc,0xdb,0x12,
+0x66,0x1f,0xfd,0xce,0x17,0x1b,0x1f,0xff,0xb1,0x0d,0x2e,0x1f,0xff,0xf9,0x06,0x47,
+0x0f,0x19,0x06,0x0e,0x1f,0xfd,0x77,0x00,0x63,0x0f,0x1b,0x18,0x58,0x1f,0xfc,0x84,
+0x00,0x27,0x0f,0x4c,0x05,0x1a,0x1f,0x03,0x77,0x00,0x36,0x2f,0xf8,0xfa,0xdc,0x01,
+0x35,0x1f,0xff,0xca,0x02,0x55,0x0f,0x62,0x15,0x29,0x1f,0xfc,0x98,0x16,0x3c,0x0f,
+0x53,0x02,0x33,0x1f,0xf8,0xed,0x0a,0x14,0x1f,0xfc,0x77,0x00,0x3b,0x1f,0xf7,0xee,
+0x00,0x43,0x0f,0xbc,0x0f,0x29,0x1f,0xfd,0xa3,0x18,0x63,0x1f,0xfa,0xda,0x12,0x51,
+0x1f,0xfd,0x02,0x13,0x57,0x12,0xfd,0xe5,0x0d,0x1f,0xfc,0x80,0x00,0x13,0x1f,0xfd,
+0xe5,0x00,0x4f,0x1f,0x04,0xc5,0x0c,0x63,0x1f,0x04,0x78,0x00,0x05,0x1f,0x06,0xd2,
+0x01,0x7f,0x0f,0x7b,0x0d,0x17,0x1f,0xfd,0x23,0x22,0x14,0x1e,0xfc,0x2f,0x06,0x0f,
+0x2f,0x04,0x29,0x0f,0x19,0x03,0x44,0x0f,0x77,0x00,0x39,0x0f,0x2c,0x0f,0x46,0x2f,
+0x03,0x03,0x1a,0x19,0x36,0x0f,0x74,0x17,0xa2,0x09,0xa2,0x0b,0x0f,0x41,0x13,0x17,
+0x2f,0xf6,0xf6,0xb1,0x01,0x27,0x17,0xf6,0x21,0x12,0x0f,0xf2,0x11,0x1c,0x1f,0xfd,
+0x26,0x02,0x3c,0x1f,0xfd,0x7b,0x0d,0x40,0x0b,0xd9,0x21,0x4f,0xfd,0xff,0xff,0xff,
+0x82,0x0a,0x24,0x2f,0xf8,0xfb,0xe0,0x23,0x88,0x1f,0xfc,0x3f,0x01,0x0e,0x1f,0xfd,
+0xe9,0x12,0x63,0x0f,0x8d,0x0c,0x3c,0x1f,0xfc,0xf4,0x03,0x09,0x1e,0xff,0x95,0x0f,
+0x0f,0x04,0x0d,0x42,0x19,0xfd,0x38,0x10,0x17,0xfa,0xd1,0x0f,0x2f,0xfd,0xfc,0x69,
+0x0e,0x2b,0x2e,0xf8,0xf8,0xa1,0x06,0x05,0xc8,0x02,0x28,0xfa,0xfa,0x52,0x01,0x44,
+0xf8,0xfd,0xff,0xff,0x2f,0x04,0x26,0xfc,0xfb,0x32,0x04,0x12,0x01,0x29,0x4e,0x21,
+0x02,0x03,0x0f,0x08,0x2e,0x04,0x05,0x94,0x07,0x03,0xbc,0x3b,0x00,0xbd,0x3b,0x92,
+0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0xc1,0x3b,0x01,0x20,0x00,0xff,0x0c,
+0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,
+0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0xcb,0x00,0x08,0xf0,0x4e,
+0x29,0x2a,0x2b,0x00,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x00,0x33,0x00,0x34,0x35,
+0x00,0x00,0x36,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x00,0x3d,0x3e,0x3f,0x40,0x41,0x42,
+0x00,0x00,0x00,0x43,0x44,0x45,0x46,0x47,0x48,0x00,0x49,0x31,0x4a,0x00,0x4b,0x4c,
+0x00,0x00,0x31,0x4d,0x4e,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,
+0x59,0x00,0x5a,0x5b,0x5c,0x5d,0x5e,0x5f,0x60,0x61,0x62,0x63,0x64,0x2d,0x65,0x66,
+0x00,0x67,0x68,0x69,0x6a,0x6a,0x6b,0x00,0x6c,0x6d,0x6e,0x00,0x6f,0x61,0x00,0xff,
+0x05,0x70,0x00,0x71,0x00,0x00,0x2d,0x72,0x73,0x00,0x00,0x00,0x74,0x75,0x76,0x77,
+0x00,0x78,0x79,0x7a,0x00,0x01,0x00,0xff,0x48,0x02,0x46,0x02,0x20,0x03,0x02,0x41,
+0x02,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,
+0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0x20,0x0b,0x00,0x0c,0x3e,0x00,0x0b,0x3e,0x00,
+0x8d,0x50,0x91,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,
+0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,
+0x23,0x73,0x00,0x02,0xf1,0x03,0x24,0x00,0x25,0x26,0x27,0x28,0x00,0x29,0x00,0x2a,
+0x2b,0x2c,0x2d,0x00,0x2a,0x2a,0x00,0x00,0x4e,0x02,0x30,0x33,0x34,0x35,0x4a,0x02,
+0xf3,0x01,0x00,0x3a,0x3b,0x3c,0x3c,0x3d,0x3e,0x00,0x00,0x3f,0x00,0x00,0x40,0x41,
+0x00,0x42,0x4e,0x02,0x91,0x49,0x4a,0x00,0x4b,0x4b,0x00,0x4c,0x4d,0x00,0x4b,0x02,
+0x00,0x4c,0x02,0x01,0x4d,0x02,0x22,0x55,0x43,0x4e,0x02,0x11,0x55,0x4f,0x02,0x40,
+0x00,0x00,0x65,0x66,0x4f,0x02,0x41,0x00,0x00,0x00,0x6b,0x50,0x02,0xdf,0x70,0x71,
+0x72,0x00,0x00,0x73,0x00,0x74,0x75,0x00,0x00,0x76,0x77,0x40,0x02,0xff,0x43,0x50,
+0x00,0x00,0x00,0x00,0x00,
+};
+
+static const uint8_t lz4BitmapData[] ={
+0xf0,0xff,0x6f,0x56,0x56,0x55,0x34,0x34,0x77,0x25,0x50,0x00,0x86,0x21,0xaa,0xc6,
+0x06,0x29,0x04,0xc8,0xc4,0x08,0x35,0x00,0x00,0x00,0x00,0x1a,0x00,0x2b,0x5b,0x04,
+0x80,0x50,0x0a,0xb3,0x01,0x01,0xc0,0x66,0x1c,0x00,0x6c,0x20,0x00,0x10,0x00,0x67,
+0x70,0x20,0x36,0x47,0x00,0x00,0x58,0x82,0x02,0x68,0x17,0x03,0x07,0x84,0x0b,0xa6,
+0x00,0xb6,0x50,0x1a,0xb0,0x48,0x34,0xb6,0x39,0x8b,0x80,0x96,0x03,0x50,0x90,0x46,
+0x06,0x40,0x64,0x03,0x70,0x09,0x00,0x14,0x71,0x01,0x80,0x0a,0x00,0x82,0x09,0x20,
+0xa0,0x37,0x05,0x00,0x08,0x00,0x6d,0x92,0x37,0x80,0x00,0x00,0x01,0x80,0x00,0x1a,
+0x00,0x6a,0xda,0x20,0x1a,0x00,0x82,0x70,0x78,0x00,0x44,0x00,0x90,0x03,0x60,0x09,
+0x00,0x18,0x00,0x72,0x00,0x40,0x00,0x1a,0x97,0x07,0x30,0xb0,0x82,0x0b,0x07,0x40,
+0xb0,0x1a,0x97,0x00,0x18,0xb1,0x0b,0x00,0xb0,0x0b,0x00,0xb0,0x3a,0x98,0x04,0x10,
+0xb0,0x00,0x65,0x00,0x76,0x00,0x6c,0x88,0x10,0x3a,0x97,0x31,0x0b,0x04,0xc6,0x30,
+0x0b,0x3a,0x97,0x00,0x98,0x00,0x68,0x80,0x28,0x38,0x08,0x8a,0xc2,0x00,0x38,0x00,
+0x0d,0xaa,0x01,0xd9,0x60,0x01,0x0b,0x12,0x30,0x91,0x0a,0x98,0x00,0x06,0x82,0x03,
+0xb9,0x50,0x75,0x0b,0x06,0x50,0xa0,0x0a,0x97,0x00,0x69,0x9d,0x10,0x02,0x80,0x00,
+0x91,0x00,0x28,0x00,0x0a,0x10,0x00,0x1a,0x97,0x05,0x60,0xb0,0x1c,0xb7,0x07,0x30,
+0xb0,0x3a,0x99,0x00,0x3a,0x95,0x82,0x0b,0x19,0x8c,0x00,0x1b,0x07,0xa2,0x43,0x00,
+0x00,0x43,0x52,0x00,0x00,0x52,0x91,0x00,0x02,0x85,0x8a,0x10,0x07,0xa3,0x00,0x01,
+0x39,0x97,0x00,0x00,0x39,0x97,0x58,0x20,0x01,0x8a,0x3a,0x71,0x10,0x00,0x5a,0xb2,
+0x20,0x56,0x02,0x90,0x04,0x10,0x06,0x10,0x03,0x87,0x87,0x01,0x80,0x77,0x26,0x62,
+0x81,0x90,0x88,0x0a,0x09,0x08,0x36,0x87,0xa7,0x40,0x67,0x75,0x00,0x00,0xe2,0x00,
+0x05,0x79,0x00,0x0b,0x0a,0x10,0x3c,0x9b,0x70,0xa1,0x00,0xb0,0x5b,0x9a,0x15,0x60,
+0x74,0x5b,0x9c,0x15,0x60,0x47,0x5b,0x9b,0x20,0x09,0x9a,0x46,0x60,0x07,0x83,0x00,
+0x06,0x60,0x07,0x09,0x9a,0x30,0x5b,0x99,0x15,0x60,0x29,0x56,0x00,0xc5,0x60,0x39,
+0x5b,0x9a,0x10,0x5b,0x99,0x25,0x60,0x00,0x5b,0x97,0x05,0x60,0x00,0x5b,0x99,0x20,
+0x1a,0x00,0x02,0x0d,0x00,0xf2,0x0a,0x56,0x00,0x00,0x09,0x9a,0x55,0x60,0x04,0x83,
+0x19,0xa5,0x70,0x0c,0x08,0x99,0x70,0x56,0x00,0xb0,0x56,0x00,0xb0,0x5b,0x99,0xe0,
+0x09,0x00,0x10,0x47,0x01,0x00,0x20,0x00,0x0c,0x02,0x00,0xf1,0x06,0x50,0x0b,0x5a,
+0xa5,0x56,0x08,0x50,0x56,0x95,0x00,0x5d,0xc0,0x00,0x57,0x3a,0x00,0x56,0x04,0x90,
+0x56,0x00,0x42,0x00,0x01,0x54,0x00,0xf0,0x1f,0x00,0x5d,0x00,0x0d,0x55,0xc4,0x05,
+0xc5,0x56,0xa0,0xb6,0x55,0x67,0x77,0x65,0x56,0x1e,0x16,0x50,0x5c,0x00,0xb0,0x5b,
+0x80,0xb0,0x56,0x94,0xb0,0x56,0x0b,0xc0,0x56,0x02,0xf0,0x09,0x9a,0x30,0x66,0x00,
+0xc0,0x83,0x00,0xb0,0x66,0x00,0xc0,0x9e,0x00,0x73,0x9a,0x45,0x60,0x1b,0x5b,0x89,
+0x35,0x84,0x00,0xf1,0x23,0x30,0x65,0x00,0xc0,0x92,0x00,0xc0,0x65,0x00,0xc0,0x09,
+0x9c,0x40,0x00,0x02,0x80,0x5b,0x9a,0x25,0x60,0x47,0x5b,0xab,0x15,0x60,0xb0,0x56,
+0x04,0x70,0x2a,0x89,0x16,0x60,0x22,0x06,0x97,0x05,0x10,0x65,0x3a,0x9a,0x20,0x79,
+0xe9,0x50,0x0c,0x00,0x00,0xc0,0x00,0x05,0x00,0xf2,0x31,0x74,0x01,0xa7,0x40,0x1a,
+0x74,0x01,0xa6,0x50,0x2a,0x1a,0x9a,0x20,0xa1,0x00,0xb4,0x70,0x65,0x0a,0x0a,0x00,
+0x65,0x80,0x00,0xe1,0x00,0xa1,0x0d,0x10,0xb5,0x63,0xb6,0x38,0x1a,0x82,0xa7,0x30,
+0xba,0x09,0xb0,0x08,0x70,0x4a,0x00,0x67,0x07,0x60,0x95,0xa0,0x02,0xf2,0x00,0xa6,
+0xa0,0x67,0x07,0x70,0x93,0x06,0x61,0xa0,0xb0,0x06,0xb2,0x46,0x00,0xf2,0x02,0x59,
+0x9e,0x40,0x04,0x80,0x02,0xa0,0x00,0xb1,0x00,0x9b,0x99,0x40,0x59,0x06,0x40,0x64,
+0x03,0x00,0xf1,0x01,0x05,0x90,0x91,0x00,0x37,0x00,0x0a,0x00,0x05,0x50,0x00,0xa0,
+0x00,0x40,0x86,0x38,0x01,0x00,0xf0,0x33,0x96,0x05,0x00,0x1b,0x60,0x82,0xa0,0x88,
+0x85,0x47,0x39,0x96,0x18,0x7b,0x83,0x0b,0x4b,0x9b,0x74,0x00,0x07,0xa9,0x80,0x74,
+0x0a,0x07,0x40,0xa0,0x7a,0x98,0x00,0x19,0x97,0x82,0x04,0x92,0x03,0x2a,0x96,0x00,
+0x0b,0x2b,0x8d,0x83,0x0b,0x82,0x0b,0x2a,0x8d,0x19,0x97,0x89,0x8a,0x94,0x00,0x2b,
+0x87,0x08,0x71,0xa0,0x7d,0x41,0xa0,0x1a,0x01,0xa0,0x19,0x00,0xc0,0x83,0x0b,0x2b,
+0x9d,0x18,0x97,0x74,0x00,0x7a,0xa8,0x74,0x0b,0x02,0x00,0x71,0x43,0x65,0x65,0x65,
+0x65,0x04,0x20,0x79,0x00,0xf0,0x01,0x42,0xb2,0x74,0x00,0x07,0x48,0x60,0x7b,0x70,
+0x07,0x8b,0x00,0x74,0x39,0x00,0x65,0x01,0x00,0xe4,0x7a,0xaa,0x9b,0x37,0x40,0xc0,
+0x47,0x74,0x0b,0x04,0x77,0x40,0xb0,0x47,0x36,0x00,0xf0,0x02,0x19,0x98,0x08,0x20,
+0x91,0x82,0x09,0x11,0xa8,0x70,0x7a,0x88,0x07,0x40,0xa0,0x74,0x0b,0x89,0x00,0x24,
+0x00,0x00,0x7a,0x00,0xf2,0x0b,0x00,0x0b,0x00,0x07,0xb5,0x74,0x07,0x40,0x74,0x00,
+0x3a,0xa5,0x49,0x32,0x22,0x68,0x3a,0x96,0x38,0x09,0xc2,0x38,0x02,0x80,0x0c,0x30,
+0x3f,0x00,0xf0,0x28,0x2b,0x9c,0xa1,0x38,0x46,0x82,0x0a,0xa0,0x08,0x60,0xa0,0x77,
+0x0a,0x64,0x99,0x45,0x1b,0x77,0xa1,0x0c,0x22,0xb0,0x75,0x66,0x0a,0xa0,0x0a,0xa0,
+0x75,0x57,0xa1,0x37,0x46,0x81,0x09,0x80,0x08,0x30,0x69,0x00,0x59,0xc7,0x02,0xb0,
+0x0b,0x10,0x8b,0x86,0x00,0x00,0x75,0x0b,0x00,0xb0,0x96,0x27,0x03,0x41,0x75,0x00,
+0x00,0x54,0x01,0x00,0xf0,0x59,0x22,0x00,0x08,0x30,0x29,0x01,0xa0,0x0a,0x40,0xa0,
+0x29,0x08,0x30,0x00,0x00,0x19,0x70,0x74,0x23,0x95,0x00,0x00,0x20,0x00,0x00,0x00,
+0xc9,0x00,0x1b,0xaa,0xa5,0x90,0x18,0x00,0x00,0x86,0x1d,0xaa,0x93,0xa0,0x00,0x00,
+0xba,0x00,0x00,0x00,0x40,0x00,0x00,0x02,0x00,0x00,0x00,0x4f,0x00,0x00,0x04,0x98,
+0xaa,0xa6,0x0c,0x00,0x00,0x18,0x05,0x76,0xaa,0xb8,0x00,0x6e,0x00,0x00,0x00,0x04,
+0x00,0x00,0x00,0x07,0x20,0x00,0x08,0x7b,0x10,0x08,0x60,0x1b,0x11,0xad,0x08,0xb5,
 0x00,0xa0,0x91,0x00,0x0a,0x09,0x10,0x00,0xaa,0xd1,0x00,0x00,0x6a,0xa0,0x0b,0x00,
-0x00,0x12,0x00,0xd2,0x8d,0x08,0x94,0x0a,0x60,0x1c,0x20,0x0b,0x3a,0x30,0x00,0x0c,
-0x50,0xb4,0x19,0xf1,0x20,0x06,0x60,0x00,0x00,0x0d,0xd0,0x00,0x00,0x77,0x87,0x00,
-0x00,0xd0,0x0d,0x00,0x08,0x60,0x06,0x80,0x1f,0xee,0xee,0xf1,0x00,0x02,0xa4,0x00,
-0x79,0xc1,0xc0,0x77,0x0f,0xd9,0x0b,0x02,0xf6,0xa0,0xb0,0x32,0x0b,0x08,0x50,0x05,
-0x90,0x08,0xbb,0x80,0x34,0x00,0xf1,0x40,0x13,0x32,0x00,0x02,0x6c,0xf6,0x60,0x09,
-0x52,0x71,0xa2,0x1b,0x00,0x00,0x66,0x0b,0x00,0x00,0x65,0x07,0x70,0x02,0xb0,0x00,
-0x8a,0xaa,0x20,0x00,0x02,0x10,0x00,0x00,0x30,0x00,0x00,0x0a,0xbd,0xab,0x40,0x1c,
-0x28,0x70,0x93,0x0c,0xbb,0x30,0x19,0x0b,0x01,0x00,0x19,0x07,0x60,0x00,0xa3,0x00,
-0x6b,0xba,0x30,0x06,0xcc,0xc8,0x0c,0x30,0x65,0x0d,0x01,0xb0,0x3e,0x3a,0x00,0xb8,
-0x7c,0x00,0xb2,0x1b,0x00,0x4b,0xb5,0x54,0x00,0xf1,0x71,0x99,0x10,0x57,0xdd,0x85,
-0x71,0x55,0x17,0x71,0x66,0x17,0x72,0xbb,0x37,0x70,0x00,0x07,0x47,0xff,0x84,0x00,
-0x66,0x10,0x00,0x01,0x30,0x06,0x08,0xdb,0xc0,0x99,0xc0,0x00,0x07,0x05,0x80,0x00,
-0x71,0x81,0x00,0x0b,0xab,0x00,0x00,0x30,0x7e,0xdc,0x00,0x00,0x01,0x00,0x68,0x86,
-0x66,0x77,0x53,0x9a,0x77,0x78,0xec,0x73,0x30,0x06,0x79,0x80,0x06,0x76,0x60,0x06,
-0x9c,0xc7,0x79,0x00,0x28,0x96,0x00,0x04,0xa9,0x85,0xb0,0x0c,0x07,0x80,0x66,0x19,
-0x05,0x63,0x19,0x0b,0x8b,0x5a,0x88,0x07,0xb2,0x03,0xd2,0x00,0x6b,0xba,0x20,0x02,
-0x97,0x00,0x00,0x0a,0x14,0x73,0x30,0x0b,0x02,0xbf,0xf4,0x04,0xde,0x9f,0xf5,0x08,
-0x5a,0xff,0xe0,0x0a,0x5f,0xff,0xf5,0x0d,0xcb,0xbb,0xb4,0x43,0x01,0xf0,0x02,0x03,
-0x90,0x00,0x16,0x65,0x9a,0x00,0x1a,0xaa,0xaa,0x60,0x05,0xfe,0xef,0xf2,0x00,0x49,
-0x14,0x00,0x12,0x70,0x29,0x01,0xf0,0x0b,0x04,0x72,0x00,0x00,0x04,0x77,0x80,0x00,
-0x04,0x66,0x20,0x00,0x54,0x93,0x00,0x0c,0x47,0x4b,0x00,0x1f,0x3d,0x3e,0x00,0x03,
-0x85,0x93,0xd8,0x00,0x92,0xa0,0x07,0xc3,0xa0,0x08,0x5a,0xa0,0x00,0x0a,0x03,0x00,
-0xf1,0x2b,0xaa,0xaa,0xa9,0x00,0x46,0x10,0x00,0x05,0x40,0x87,0x20,0x08,0x00,0x01,
-0x80,0x35,0x6a,0xb5,0x70,0x60,0x37,0x40,0x62,0x34,0x0b,0x90,0x24,0x06,0x77,0x77,
-0x70,0x00,0x00,0x0a,0x00,0x00,0x00,0x1d,0x81,0x02,0xb9,0xb7,0x80,0x09,0x10,0xb5,
-0x80,0x0a,0x00,0x2d,0x00,0x09,0x00,0x1c,0x00,0x27,0x00,0x1c,0x6c,0x00,0xf0,0x0b,
-0x37,0x33,0x73,0x27,0x05,0xe0,0x10,0x00,0x29,0x82,0x01,0x8b,0x38,0x20,0x39,0x98,
-0x44,0x00,0xa4,0x00,0x20,0x36,0x46,0x06,0x36,0x40,0x6d,0x1b,0xf1,0x3a,0x2a,0x35,
-0x10,0x35,0xb3,0x60,0x00,0x3c,0xac,0x40,0x56,0x88,0x09,0x0a,0x0c,0x50,0xa0,0xa9,
-0xa3,0xa6,0x00,0x00,0x21,0x00,0x60,0x00,0x30,0x0a,0x00,0x05,0x60,0xa0,0x00,0x0b,
-0x0a,0x01,0x00,0x91,0x82,0x73,0x04,0x21,0xc9,0x00,0x00,0x00,0x35,0x31,0x00,0x00,
-0x15,0x85,0x00,0x00,0x00,0x12,0x00,0x05,0x99,0xd6,0x00,0x00,0x08,0x50,0x00,0x00,
-0xa9,0xa0,0x00,0x0a,0x40,0x6a,0x92,0xd7,0x00,0xf1,0x05,0x50,0x10,0x07,0x9a,0x61,
-0x84,0x04,0x87,0x61,0x03,0xb7,0x12,0xb0,0xb4,0x40,0x0a,0x07,0xb2,0x8a,0x30,0x68,
-0x02,0xf2,0x07,0x19,0x00,0x20,0x07,0xac,0x92,0xa1,0x01,0x82,0x19,0x38,0x00,0xa0,
-0x18,0x06,0x05,0x60,0x46,0x00,0x0a,0x09,0xb1,0x0d,0x01,0xf2,0x0b,0x20,0x01,0x51,
-0x00,0xa0,0x02,0x63,0x47,0xd9,0x65,0x60,0x12,0x80,0xa0,0xa0,0x06,0x40,0x90,0x42,
-0x0a,0x00,0xa0,0x00,0x55,0x5a,0x60,0x20,0x00,0xf0,0x23,0x32,0x00,0x68,0xac,0x90,
-0x00,0x09,0x12,0x78,0x8a,0xb3,0x00,0x01,0xb0,0x81,0x04,0x70,0x77,0x22,0x20,0x04,
-0x77,0x30,0x00,0x40,0x16,0x38,0x8b,0xb6,0x41,0x00,0x09,0x11,0x09,0x99,0xca,0x20,
-0x00,0x02,0x80,0x08,0x00,0x99,0x00,0xa0,0x00,0x00,0x04,0x9a,0xa3,0x3f,0x1c,0xf0,
-0x1a,0x01,0xb3,0x02,0xa2,0x02,0xb0,0x00,0x1b,0x20,0x00,0x1b,0x30,0x00,0x0a,0x50,
-0x00,0x03,0x0a,0x00,0x0a,0x00,0x0a,0x08,0x9d,0x92,0x09,0x00,0x09,0x00,0x0a,0x30,
-0x09,0x00,0x0e,0x10,0x0a,0x00,0x09,0x00,0xa4,0x00,0x24,0x03,0x32,0x1a,0xaa,0xa0,
-0x6c,0x00,0x90,0x50,0x00,0x00,0x92,0x00,0x00,0x2b,0xba,0xa6,0xb6,0x00,0xf3,0x02,
-0x0a,0x23,0x89,0x9b,0x92,0x00,0x00,0x90,0x41,0x05,0xc1,0x91,0x00,0x00,0x3b,0x99,
-0x70,0xa2,0x1c,0x12,0xb0,0x73,0x01,0x12,0xa0,0x07,0x00,0xa1,0x90,0x00,0x20,0x0b,
-0x00,0x2b,0x00,0x6a,0xa9,0x10,0x1c,0x00,0x8c,0x13,0x20,0x0a,0x02,0x66,0x00,0xa0,
-0x01,0x1c,0x00,0xf0,0x07,0x11,0xb1,0x10,0x17,0x76,0xc6,0x62,0x00,0x39,0xc0,0x00,
-0x00,0x71,0x92,0x00,0x00,0x18,0xe0,0x00,0x00,0x2a,0x60,0x6b,0x01,0x11,0x00,0x83,
-0x00,0xf3,0x0a,0x01,0xa5,0x73,0x38,0x77,0xc7,0x71,0x00,0x48,0xb0,0x00,0x00,0x90,
-0xb0,0x00,0x00,0x39,0xd0,0x00,0x00,0x3a,0x40,0x00,0x00,0x41,0x14,0x1d,0xe1,0xa0,
-0x09,0x00,0x02,0xb5,0x6c,0x93,0x46,0xb3,0x2a,0x00,0x00,0x90,0x89,0x7e,0x00,0xf2,
-0x05,0x00,0x7a,0xaa,0x50,0x00,0x00,0x10,0x00,0x68,0xac,0x00,0x00,0x39,0x00,0x03,
-0x7d,0x88,0x81,0x54,0x95,0x94,0x00,0x52,0xa5,0x20,0x00,0x00,0x57,0xe2,0x03,0xb0,
-0x38,0x30,0x00,0x09,0xc9,0x50,0x00,0x00,0x90,0x59,0x90,0x34,0x00,0x70,0x05,0x61,
-0x80,0x00,0x0b,0x00,0x99,0xaf,0x01,0x00,0xf7,0x02,0xf0,0x0a,0x10,0x00,0x46,0x11,
-0x85,0x19,0xca,0x50,0x20,0x00,0xa0,0x69,0x80,0x01,0x90,0x00,0x00,0x06,0x52,0x60,
-0x00,0x0b,0x00,0xa9,0x90,0x1f,0x00,0x60,0x28,0x99,0x93,0x32,0x00,0x0a,0x5d,0x1d,
-0x10,0x9b,0xfb,0x00,0x50,0x05,0x9a,0x9b,0x40,0x45,0xa5,0x05,0x01,0x02,0x01,0xf2,
-0x02,0x29,0x50,0x00,0x5a,0x82,0x00,0x15,0x78,0x9a,0xa0,0x14,0x23,0x90,0x00,0x00,
-0x09,0x00,0x7a,0x00,0x70,0x09,0x30,0x00,0x00,0x00,0x9c,0x30,0x3f,0x00,0xc1,0x14,
-0x67,0x9a,0xa0,0x15,0x33,0xa2,0x30,0x00,0x0a,0x03,0x63,0x1c,0x00,0x70,0x0a,0x20,
-0x00,0x00,0x01,0x9c,0x20,0x1c,0x00,0xd1,0x11,0x00,0x00,0x29,0x00,0x40,0x0a,0x4a,
-0x60,0x08,0x80,0x00,0x55,0x74,0x01,0xf0,0x1b,0x2a,0xaa,0xa4,0x00,0x12,0x00,0x00,
-0x00,0x76,0x21,0x00,0x39,0xe6,0x25,0x90,0x02,0x90,0x02,0x44,0x0b,0x20,0x18,0x00,
-0x27,0x28,0x9c,0x10,0x00,0x71,0x1a,0xc1,0x00,0x29,0xa3,0x10,0x70,0x01,0x12,0x09,
-0x02,0x88,0x70,0x6e,0x00,0xb1,0x11,0x00,0x00,0xd3,0x90,0x00,0x0c,0x04,0xaa,0xa1,
-0x10,0x79,0x04,0xf0,0x07,0x86,0x00,0x02,0xa3,0xa2,0xa1,0x0a,0x03,0x70,0x27,0x09,
-0x07,0x30,0x09,0x0a,0x2b,0x00,0x65,0x04,0xa2,0x3a,0x90,0x5e,0x01,0x30,0x10,0x00,
-0x10,0xfa,0x01,0xf4,0x03,0x90,0x79,0xd9,0x39,0x00,0x09,0x00,0x91,0x00,0x90,0x0c,
-0x37,0x7c,0x70,0xb0,0x89,0xa1,0x20,0x70,0x1e,0xf0,0x17,0x7c,0x30,0x00,0x05,0x80,
-0xb2,0x00,0x3b,0x00,0x1b,0x10,0x01,0x00,0x02,0xc1,0x00,0x00,0x00,0x23,0x00,0x00,
-0x02,0x60,0x00,0x6b,0x17,0x42,0x04,0x81,0xb1,0x00,0x3b,0x00,0x3b,0x00,0x21,0x00,
-0x04,0x6f,0x01,0xf1,0x1f,0x53,0x38,0x9c,0x84,0x00,0x18,0x00,0x59,0x9c,0x97,0x00,
-0x08,0x00,0x38,0x8d,0x60,0x74,0x28,0x49,0x05,0x61,0x00,0x03,0x9a,0x90,0x00,0x00,
-0x07,0x30,0x10,0x01,0x6d,0x40,0x90,0x29,0x85,0x5b,0xb0,0x83,0xa0,0x09,0x53,0x29,
-0x20,0x86,0x00,0xbb,0x04,0xf3,0x09,0x82,0x11,0x00,0x07,0xc6,0x21,0xb2,0x05,0xc1,
-0x00,0x01,0x08,0x62,0x00,0x20,0x06,0xc0,0x00,0xa0,0x00,0x88,0x8a,0x60,0x00,0x7f,
-0x01,0xf1,0x09,0x02,0x40,0x19,0x00,0x00,0xba,0xcb,0x80,0x05,0xc1,0x90,0x75,0x09,
-0x1b,0x70,0x19,0x09,0x1d,0x50,0x56,0x06,0x91,0x38,0x90,0x21,0x01,0x00,0x67,0x03,
-0xf0,0x1f,0x70,0x00,0x07,0xbb,0x90,0x00,0x16,0x30,0x21,0x07,0xca,0x81,0xa0,0x09,
-0x10,0x0a,0x00,0x68,0x26,0x90,0x00,0x48,0x50,0x01,0x10,0x00,0x02,0x9a,0x70,0x26,
-0x00,0x00,0x45,0x48,0x50,0x7b,0x41,0x49,0x31,0x00,0x0a,0x03,0x67,0xb2,0x01,0x32,
-0x33,0x00,0xf2,0x04,0x47,0x8a,0x40,0x6a,0x10,0xb0,0x75,0x00,0xa0,0x72,0x00,0xa0,
-0x10,0x02,0x90,0x02,0x8a,0x10,0x02,0xeb,0x00,0xf1,0x08,0x09,0x9b,0xa0,0x00,0x03,
-0x80,0x00,0x05,0xe8,0x70,0x08,0x81,0x03,0x80,0x33,0x86,0x0a,0x00,0x73,0x89,0x60,
-0x00,0x57,0xab,0x01,0x00,0x1a,0x02,0xf3,0x06,0x39,0xd4,0x9b,0x10,0x00,0xc6,0x05,
-0x30,0x08,0xb0,0x07,0x20,0x47,0x90,0x09,0x01,0x00,0x90,0x06,0xc6,0x00,0xaa,0x00,
-0x01,0x20,0x00,0xf1,0x24,0xd3,0x9a,0x70,0x00,0xd7,0x00,0x76,0x07,0xb0,0x00,0x19,
-0x38,0x90,0x00,0x75,0x20,0x90,0x5c,0x70,0x00,0x60,0x10,0x00,0x00,0x03,0x00,0x00,
-0x06,0x7b,0x77,0x00,0x02,0xa3,0x10,0x00,0x04,0xb9,0x78,0x90,0x0a,0x17,0xc1,0x00,
-0x00,0x92,0x80,0x00,0x00,0x79,0x89,0x40,0xd1,0x1f,0x00,0xc6,0x05,0xf1,0x07,0x0b,
-0x10,0x00,0x00,0x46,0x00,0x00,0x00,0xb8,0x30,0x00,0x05,0xa1,0xa0,0x02,0x0b,0x00,
-0xa0,0x73,0x37,0x00,0x8a,0x02,0x06,0xd1,0x78,0x88,0x95,0x00,0x40,0x92,0x00,0x94,
-0x40,0x00,0xa0,0x00,0x09,0x2e,0x04,0xf0,0x00,0x2a,0x99,0x99,0xb0,0x00,0x03,0x04,
-0x80,0x00,0x0b,0x39,0x00,0x00,0x0b,0x00,0x2b,0x02,0x30,0x00,0x04,0xb1,0x30,0x01,
-0x02,0x3b,0x02,0x71,0x03,0xb1,0x02,0x8c,0x00,0x77,0x1a,0x71,0x02,0x11,0x0a,0x2c,
-0x20,0xb4,0x00,0x00,0x67,0x00,0x01,0xa5,0x00,0x49,0x9b,0x00,0x16,0x97,0x03,0x11,
-0xb0,0x99,0x00,0xf1,0x03,0xa1,0x00,0xc9,0x99,0x9b,0xa0,0x00,0x28,0x50,0x00,0x82,
-0x00,0x04,0x80,0x02,0x98,0x00,0x01,0x30,0x02,0xc0,0x59,0xda,0x92,0x00,0x81,0x00,
-0x00,0x81,0x00,0x99,0xda,0x95,0x89,0x01,0xb4,0x11,0x11,0x10,0x08,0x8c,0x98,0x60,
-0x00,0x09,0x10,0x00,0x04,0x00,0xf3,0x06,0x5a,0xaa,0xaa,0xa1,0x00,0x03,0x00,0x59,
-0x9d,0x96,0x00,0x5e,0x00,0x04,0x98,0x00,0x69,0x08,0x00,0x10,0x6c,0x0d,0x01,0xf1,
-0x02,0x02,0x99,0x9e,0x99,0x00,0x07,0xd0,0x00,0x09,0x59,0x00,0x3b,0x20,0x81,0x00,
-0x00,0x9c,0x73,0x00,0x70,0x99,0xd9,0x99,0x00,0x0a,0x00,0xa0,0x00,0x0b,0x83,0xb1,
-0x01,0x80,0xa2,0x09,0xb3,0x00,0x00,0xdc,0x03,0xf2,0x07,0x0a,0x01,0x74,0x1a,0x9d,
-0x99,0x80,0x00,0x19,0x00,0xa0,0x00,0x65,0x00,0x90,0x01,0xb0,0x03,0x70,0x0a,0x10,
-0xac,0x97,0x01,0x10,0x03,0x19,0x03,0xf2,0x03,0x02,0x20,0x08,0xad,0xa7,0x20,0x01,
-0x06,0x30,0x10,0x04,0x6a,0xca,0x91,0x06,0x31,0x90,0x00,0xe1,0x03,0x12,0x30,0xf5,
-0x00,0xa0,0xb1,0x00,0x00,0x7a,0x88,0xc0,0x78,0x00,0x47,0x04,0x0f,0x01,0x71,0x0a,
-0x40,0x00,0x5b,0x30,0x00,0x16,0x41,0x02,0xe0,0x32,0x00,0x1a,0x00,0x74,0x00,0xa9,
-0x9b,0x70,0x0a,0x40,0x09,0x20,0x23,0x29,0x01,0x10,0x02,0x2d,0x00,0x41,0x10,0x00,
-0x04,0x40,0x7a,0x00,0x01,0x08,0x01,0xb2,0x04,0xc9,0xba,0xa1,0x1b,0x00,0xa0,0x00,
-0x31,0x00,0xa0,0xb3,0x05,0x11,0x77,0x34,0x01,0x00,0x25,0x05,0xe0,0x41,0x00,0xb0,
-0x01,0x74,0x02,0xe9,0xaa,0xa1,0x0b,0x10,0xa0,0x00,0x43,0x2d,0x00,0x00,0xc4,0x07,
-0x12,0x59,0x21,0x08,0x34,0x6a,0xaa,0xa8,0x64,0x01,0x00,0x03,0x00,0xb0,0x7a,0xaa,
-0xaa,0x00,0xa0,0x0a,0x00,0x49,0xd9,0x9d,0x93,0x08,0x00,0x01,0x04,0x00,0x62,0x00,
-0x66,0x00,0x00,0x07,0x90,0x6a,0x04,0xb0,0x20,0x03,0x22,0x00,0xa0,0x0a,0x64,0x69,
-0xd9,0x9d,0x92,0xae,0x04,0xb5,0x00,0xa0,0x28,0x00,0x00,0x00,0x74,0x00,0x00,0x08,
-0x80,0xd5,0x21,0x40,0x00,0x97,0x00,0x00,0x0f,0x21,0xf4,0x02,0x09,0x80,0x00,0xa1,
-0x00,0x10,0x09,0x50,0x00,0x03,0xb4,0x00,0x06,0xd9,0x10,0x00,0x01,0x2a,0x01,0xf1,
-0x00,0xa5,0x06,0x54,0x01,0x05,0x00,0x30,0x0a,0x60,0x00,0xb0,0x00,0x20,0x09,0x40,
-0x20,0x00,0x21,0xc9,0x10,0x3f,0x00,0x42,0x05,0xaa,0xaa,0x20,0xdb,0x01,0xe3,0x65,
-0x00,0x00,0x04,0xe2,0x00,0x00,0x69,0x1b,0x20,0x0b,0x60,0x01,0xb0,0x36,0x22,0x52,
-0x63,0x06,0xa9,0x9a,0x51,0x20,0x00,0xe4,0x82,0x00,0x00,0x05,0xd1,0x00,0x00,0x78,
-0x2b,0x10,0x1b,0x50,0x02,0xb0,0xc0,0x02,0xa1,0x0a,0x36,0x9a,0x59,0xd5,0x26,0x50,
-0x0a,0x02,0x80,0x08,0x05,0xf2,0x06,0xb9,0xa6,0x00,0x30,0x01,0x53,0x00,0xa0,0x00,
-0x52,0x00,0xb6,0x9a,0xc0,0x69,0xd3,0x07,0x40,0x00,0xa0,0x27,0x76,0x01,0x21,0x6a,
-0x9a,0xf7,0x02,0xe0,0x07,0x00,0x00,0x80,0x76,0x00,0x37,0x00,0x80,0x09,0x20,0x00,
-0x03,0xa0,0x59,0x01,0x22,0x07,0xa1,0x38,0x01,0xf1,0x00,0x00,0x03,0x52,0x04,0x00,
-0x02,0x52,0x0a,0x20,0x05,0x60,0x02,0x90,0x0a,0x10,0xa1,0x02,0x61,0x01,0xb1,0x00,
-0x00,0x6b,0x20,0xb3,0x01,0xe0,0x00,0x06,0x10,0x00,0x02,0xe9,0x98,0x01,0xb1,0x01,
-0xa1,0xb2,0x92,0x83,0x2d,0x22,0x54,0x00,0x69,0x41,0x02,0xb6,0x71,0x04,0xf0,0x09,
-0x31,0x00,0x1b,0x00,0x74,0x00,0x99,0x9a,0x80,0x09,0x51,0x08,0x30,0x34,0x1a,0x8a,
-0x00,0x00,0x01,0xcb,0x00,0x00,0x5b,0x10,0xde,0x0a,0x02,0x13,0x02,0x40,0x89,0xa9,
-0x40,0x00,0x0e,0x03,0x80,0x99,0xd9,0x94,0x00,0x02,0x70,0x00,0x00,0xd0,0x09,0x13,
-0x89,0xd0,0x01,0xf2,0x01,0x50,0x03,0x54,0x54,0x28,0x07,0x01,0x83,0x00,0x04,0x90,
-0x00,0x79,0x00,0x03,0x40,0x50,0x08,0xb1,0x0a,0x00,0x61,0x0b,0x07,0x30,0xb0,0x06,
-0x21,0x13,0x80,0x6d,0x03,0x61,0x01,0xb3,0x00,0x00,0x7b,0x30,0xae,0x00,0x41,0x01,
-0x99,0x99,0x50,0x00,0x04,0x41,0x99,0xc9,0x94,0x00,0xe3,0x05,0x41,0x50,0x00,0x00,
-0x5a,0x5d,0x02,0x00,0x43,0x02,0x50,0x53,0x05,0x99,0x97,0x53,0x0a,0x00,0x63,0x49,
-0x9a,0xa9,0x90,0x00,0x07,0x63,0x01,0x03,0xbf,0x04,0x10,0x19,0x31,0x00,0x51,0x1e,
-0x82,0x01,0x92,0x9a,0x0a,0x00,0x10,0x04,0x51,0x00,0xb0,0x0b,0x01,0x67,0xa0,0x05,
-0x1a,0xb6,0x10,0xa0,0x5b,0x3a,0x5e,0x02,0x12,0x03,0x12,0x07,0x81,0x08,0x88,0xd8,
-0x84,0x01,0x12,0xa1,0x10,0xe3,0x08,0x00,0xee,0x03,0x16,0xa4,0xd2,0x23,0x57,0x06,
-0xaa,0xaa,0x40,0x00,0x01,0x00,0x40,0x3b,0xaa,0xaa,0xb1,0x1c,0x07,0xf1,0x01,0x05,
-0x99,0x9c,0x90,0x00,0x00,0x4a,0x00,0x00,0x29,0xb4,0x20,0x0a,0x83,0x91,0xa5,0x9e,
-0x00,0x10,0x00,0xad,0x00,0x10,0x73,0x53,0x00,0x70,0x04,0x70,0x00,0x1b,0x00,0x02,
-0xc2,0xce,0x02,0x01,0x37,0x01,0xf1,0x07,0x23,0x00,0x00,0xa1,0x0b,0x00,0x00,0xc0,
-0x08,0x30,0x03,0x80,0x01,0xa0,0x0b,0x10,0x00,0xb0,0x27,0x00,0x00,0x63,0x51,0x01,
-0xf1,0x05,0x20,0x22,0x75,0x00,0xb1,0x29,0x00,0x00,0xb0,0x0a,0x10,0x04,0x70,0x03,
-0x70,0x0b,0x10,0x00,0xc0,0x47,0x56,0x06,0x01,0xe5,0x02,0xc0,0x76,0x00,0x83,0x19,
-0x32,0x00,0xb0,0x09,0x10,0x01,0x90,0x02,0xcd,0x01,0x52,0xb0,0x29,0x00,0x00,0x83,
-0x38,0x04,0xb4,0x25,0x0a,0x00,0x05,0x40,0xa0,0x17,0xa0,0x0a,0xa8,0x30,0x39,0x04,
-0x11,0x5a,0x40,0x08,0xa4,0x00,0x60,0x00,0x47,0x3a,0x00,0x49,0x40,0xa9,0x95,0xec,
-0x07,0x31,0x06,0xa9,0xaa,0x32,0x01,0x30,0x9a,0xaa,0xa8,0x19,0x01,0xa6,0x00,0x64,
-0x00,0x01,0xb0,0x00,0x2b,0x20,0x0a,0x91,0xba,0x24,0x50,0x66,0xaa,0xaa,0xa9,0x10,
-0x65,0x05,0x00,0x5f,0x00,0x84,0x2a,0x00,0x00,0x3b,0x10,0x00,0xb8,0x10,0x05,0x01,
-0x71,0x6a,0xaa,0xaa,0xb6,0x00,0x00,0x38,0xce,0x01,0xa9,0x02,0xa0,0x00,0x03,0xb1,
-0x00,0x0b,0x81,0x00,0x00,0x86,0x06,0xa7,0xa3,0x00,0x3b,0x00,0x0b,0x30,0x01,0x00,
-0x01,0xc2,0x86,0x06,0x12,0x41,0x86,0x06,0x41,0x1b,0x10,0x11,0x00,0xcd,0x02,0xe0,
-0x43,0x00,0x00,0x04,0x61,0x00,0x7b,0x45,0x62,0x06,0x70,0x94,0x00,0x4a,0x0e,0x04,
-0x30,0x00,0x00,0xb3,0x6f,0x07,0x05,0x33,0x02,0xd2,0x20,0xa0,0x20,0x03,0x80,0xa0,
-0xa0,0x09,0x00,0xa0,0x36,0x00,0x2a,0x66,0x0b,0x01,0x3d,0x02,0x70,0x09,0x14,0x62,
-0x59,0x9d,0xa9,0x80,0xac,0x07,0xe1,0x09,0x29,0x08,0x20,0x47,0x09,0x01,0xa0,0x30,
-0x1a,0x00,0x20,0x00,0x67,0x43,0x02,0x56,0x62,0x00,0x09,0x14,0x52,0x20,0x00,0xa0,
-0x09,0x30,0x47,0x09,0x01,0xc0,0x30,0x1a,0x00,0x30,0x20,0x00,0x50,0x19,0x99,0x99,
-0xa2,0x00,0xf1,0x00,0xa0,0x30,0x0b,0x20,0x00,0x88,0xb2,0x00,0x00,0x06,0x90,0xac,
-0x07,0x04,0x5c,0x00,0xf4,0x03,0x08,0xaa,0x61,0x00,0x00,0x42,0x1a,0x96,0x10,0x00,
-0x04,0x70,0x56,0x30,0x00,0x03,0x7a,0xa1,0x1a,0x00,0x13,0x0b,0x18,0x08,0x20,0x55,
-0x01,0xc3,0x08,0x96,0x20,0x01,0xa1,0x36,0xb0,0x3b,0xa9,0x75,0x93,0xf9,0x00,0xf0,
-0x0b,0x74,0x00,0x91,0x0b,0x00,0x02,0xba,0x50,0x00,0x04,0xe7,0x00,0x04,0xb0,0x88,
-0x09,0x80,0x00,0x30,0x10,0x00,0x00,0x05,0x99,0x99,0x60,0x38,0x00,0x42,0x09,0x9d,
-0x99,0x92,0x3c,0x08,0x00,0x91,0x03,0x21,0xba,0xa0,0x4a,0x01,0xd0,0x20,0x00,0x16,
-0xa8,0x9a,0x55,0xa0,0x92,0x00,0xa1,0x30,0x00,0x64,0x14,0x26,0x21,0x00,0x30,0x84,
-0x02,0xc2,0x40,0x14,0xca,0x98,0xd1,0x25,0x57,0x07,0x40,0x00,0x0a,0x16,0x32,0x00,
-0x33,0x06,0x40,0x00,0xf2,0x05,0x31,0x09,0x99,0xc0,0xc6,0x01,0xc0,0x90,0x79,0x9a,
-0xc9,0x02,0x88,0x89,0x30,0x00,0x11,0x16,0x50,0xb7,0x07,0x02,0xf0,0x05,0x10,0x0b,
-0xa7,0x0b,0xf0,0x00,0xa6,0x39,0x88,0x90,0x00,0x00,0x90,0x29,0x88,0xd0,0x00,0x00,
-0x90,0x49,0x99,0x06,0x00,0x32,0x69,0x99,0x96,0xfc,0x04,0x30,0x39,0x99,0x9a,0x02,
-0x05,0x00,0x06,0x00,0x40,0x01,0x09,0x99,0x95,0x52,0x00,0x70,0x79,0x99,0x9d,0x00,
-0x00,0x02,0x90,0xf9,0x03,0x53,0x18,0xa1,0x00,0x01,0x30,0xef,0x00,0x21,0x19,0x0a,
-0x03,0x00,0x90,0x09,0x00,0x37,0x00,0x00,0xa2,0x00,0x4b,0x50,0xb5,0x03,0x26,0xa0,
-0xa0,0x04,0x00,0xa1,0x90,0xa0,0x14,0x06,0x50,0xa3,0xa1,0x2a,0x00,0xb9,0x31,0x00,
-0x05,0x49,0x0a,0xa2,0x01,0x10,0xa0,0x01,0xa1,0x0a,0x17,0xa1,0x00,0xea,0x4a,0x00,
-0x34,0x8a,0xaa,0xa8,0x02,0x0c,0x00,0x03,0x00,0xe0,0xa9,0x99,0x9b,0x99,0x99,0x98,
-0x0a,0x00,0x00,0xb0,0xa0,0x00,0x19,0x01,0x44,0x02,0x50,0x06,0x80,0x00,0x3b,0x70,
-0xe2,0x03,0x00,0x41,0x09,0x20,0x00,0x87,0xeb,0x08,0x20,0x0b,0x20,0xea,0x0a,0x33,
-0x4b,0x40,0x07,0x76,0x02,0xc5,0x2a,0xaa,0xaa,0xa1,0x01,0x00,0x00,0x10,0x4a,0xaa,
-0xaa,0xa8,0x46,0x01,0x01,0x04,0x00,0x24,0x99,0x90,0x0c,0x00,0x41,0x79,0x9d,0x99,
-0x93,0xcf,0x00,0x00,0x6a,0x01,0x01,0xc6,0x09,0xa1,0xa3,0x00,0x00,0x09,0x08,0x70,
-0x00,0x09,0x00,0x10,0x10,0x00,0x10,0x09,0xfe,0x01,0xf2,0x05,0xe9,0x96,0x00,0x05,
-0x90,0x00,0x00,0x3b,0x9a,0x10,0x06,0xa2,0x81,0xb2,0x26,0x01,0x80,0x05,0x00,0x01,
-0xd3,0x11,0xf1,0x13,0x22,0x22,0x22,0x20,0x46,0x6b,0x66,0x61,0x38,0x8c,0x98,0x80,
-0x53,0x38,0x03,0x90,0x53,0x78,0x08,0x90,0x53,0xcc,0x88,0x90,0x53,0x00,0x00,0x90,
-0x53,0x00,0x06,0xa0,0x00,0x09,0xe2,0x00,0xe1,0xc8,0x8d,0x88,0x99,0x00,0x90,0x09,
-0xd9,0x9d,0x99,0x96,0x00,0x90,0x06,0x15,0x00,0xf1,0x13,0x90,0x00,0x00,0x01,0x34,
-0x60,0x07,0x78,0x93,0x00,0x08,0xb9,0xaa,0x92,0x28,0xc9,0xbb,0x96,0x00,0x93,0x56,
-0x30,0x18,0x8f,0xf9,0x83,0x03,0xa5,0x7a,0x50,0x37,0x03,0x50,0x57,0xb8,0x01,0x51,
-0x9a,0xe1,0x00,0x03,0xb2,0xc8,0x06,0x51,0x08,0x00,0x00,0x00,0x80,0x07,0x00,0xf0,
-0x0e,0x59,0x60,0x00,0x00,0x60,0x09,0x00,0x07,0x44,0x09,0x00,0x1d,0x09,0x1c,0x97,
-0x9b,0x4d,0x79,0x08,0x09,0x19,0x09,0x27,0x09,0x09,0x05,0x84,0x09,0x09,0x9a,0x16,
-0x41,0x88,0x97,0x00,0x00,0x63,0x00,0xf4,0x0e,0x90,0x06,0x50,0x00,0x90,0x0e,0x39,
-0x99,0xd5,0x8c,0x02,0x00,0x90,0x19,0x06,0x40,0x90,0x09,0x00,0x90,0x90,0x09,0x00,
-0x00,0x90,0x09,0x00,0x69,0x70,0x84,0x02,0xf4,0x09,0x01,0x84,0x09,0x00,0x07,0x3a,
-0x09,0x00,0x1e,0x1c,0x9d,0x93,0x8b,0x32,0x09,0x00,0x08,0x49,0x9d,0x97,0x08,0x00,
-0x09,0x00,0x04,0x00,0x01,0x01,0x00,0xf0,0x04,0x80,0x25,0x92,0x06,0x68,0x79,0x00,
-0x3f,0x00,0x18,0x00,0x89,0x58,0x8c,0x86,0x09,0x00,0x28,0x00,0xbf,0x12,0x01,0x08,
-0x00,0xf1,0x11,0x28,0x88,0x85,0x00,0x30,0x31,0x00,0x03,0x60,0x44,0x00,0x0c,0x18,
-0x88,0x91,0x7c,0x07,0x10,0x90,0x09,0x04,0x42,0x60,0x09,0x02,0x76,0x20,0x09,0x38,
-0x8c,0x84,0x09,0x5b,0x0c,0xf1,0x0f,0x15,0x80,0x06,0x3b,0x6a,0x00,0x1d,0x08,0x09,
-0x00,0x8b,0x0c,0x8c,0x85,0x09,0x08,0x08,0x00,0x09,0x08,0x05,0x30,0x09,0x08,0x35,
-0x76,0x09,0x2b,0x56,0x95,0xf9,0x05,0xf0,0x0d,0x50,0x90,0x00,0x09,0x10,0x90,0x00,
-0x2d,0x69,0xfc,0x93,0x8b,0x05,0xb8,0x00,0x09,0x08,0x93,0x70,0x09,0x99,0xc8,0xa4,
-0x09,0x00,0x90,0x00,0x09,0xfb,0x00,0xf2,0x00,0x71,0x50,0x00,0x06,0x37,0xa8,0x84,
-0x1e,0x18,0x90,0x00,0x8b,0x51,0x98,0x82,0x18,0x00,0x22,0x98,0x83,0x08,0x00,0x15,
-0x90,0x55,0x03,0x00,0xde,0x00,0xf1,0x0d,0x07,0x79,0x9d,0x97,0x2e,0x18,0x8c,0x84,
-0x8a,0x17,0x09,0x08,0x08,0x1a,0x8c,0x86,0x08,0x09,0x64,0x00,0x08,0x02,0xf6,0x00,
-0x08,0x59,0x15,0xa7,0x49,0x06,0xf3,0x0f,0x45,0xc8,0x8a,0x60,0x1c,0x0c,0x88,0x96,
-0x07,0x90,0x00,0x90,0x00,0x08,0x48,0xae,0x87,0x00,0x80,0x1a,0xc7,0x00,0x08,0x2b,
-0x19,0x75,0x00,0x85,0x10,0x90,0x8b,0x06,0xf0,0x0c,0x30,0x30,0x00,0x05,0x52,0x65,
-0x21,0x0c,0x25,0x55,0x53,0x7b,0x06,0x77,0x60,0x08,0x06,0x66,0x60,0x08,0x0b,0x77,
-0xb0,0x08,0x08,0x00,0x80,0x08,0x00,0xf3,0x2e,0x03,0x30,0x80,0x00,0x09,0x05,0xc7,
-0xb2,0x3c,0x55,0x5a,0x40,0x79,0x87,0x76,0x85,0x09,0x81,0x75,0x30,0x09,0x80,0x77,
-0x43,0x09,0x10,0x27,0x80,0x09,0x07,0xa4,0x00,0x00,0x50,0x33,0x00,0x07,0x59,0x99,
-0x93,0x2d,0x06,0x21,0x70,0x6a,0x48,0x9a,0x95,0x09,0x07,0x88,0x80,0x09,0x08,0x00,
-0x90,0x09,0x0b,0x77,0xc0,0x09,0xb2,0x00,0xf0,0x50,0x01,0x70,0x08,0x00,0x08,0x49,
-0xac,0x94,0x3d,0x00,0x99,0x80,0x9a,0x44,0xb6,0xc0,0x09,0x44,0xc6,0xc0,0x09,0x44,
-0xa3,0xa0,0x09,0x45,0x44,0x40,0x09,0x27,0x77,0x73,0x00,0x50,0x41,0x00,0x05,0x6a,
-0x88,0xa1,0x1d,0x2a,0x77,0xb1,0x7a,0x2a,0x77,0x71,0x08,0x3d,0x56,0x43,0x08,0x4b,
-0xaa,0x93,0x08,0x78,0x56,0x43,0x08,0x77,0x56,0x72,0x00,0x50,0x23,0x00,0x06,0x68,
-0x88,0x85,0x1c,0x09,0x66,0xb0,0x7a,0x05,0x66,0x70,0x08,0x78,0x77,0x79,0x08,0x26,
-0x8a,0x72,0x08,0x00,0x26,0x00,0x08,0x02,0x94,0x0a,0x09,0xe0,0x08,0x0a,0x68,0xb6,
-0x28,0x2c,0x58,0xb6,0x28,0x9a,0x55,0x96,0x28,0x09,0x04,0x00,0xf1,0x3b,0x38,0x84,
-0x18,0x09,0x45,0x80,0x08,0x09,0x70,0x50,0x85,0x04,0x42,0x73,0x20,0x0a,0x49,0xca,
-0x91,0x3c,0x5a,0xb9,0x92,0x7a,0x4e,0x87,0x70,0x09,0x7b,0x4a,0xb0,0x09,0x0a,0x3a,
-0xa0,0x09,0x0c,0x7c,0xc0,0x09,0x09,0x08,0xa0,0x00,0x41,0x30,0x00,0x05,0x5a,0x7b,
-0x00,0x0b,0x7b,0x8a,0xb0,0x7a,0x09,0xc8,0x90,0x08,0x38,0x93,0x70,0x08,0x16,0x6b,
-0x60,0x08,0x25,0x88,0x72,0x08,0x55,0x66,0x00,0x07,0x31,0x05,0x88,0x88,0x68,0x05,
-0xf1,0x04,0x29,0xaa,0x9b,0x96,0x00,0x63,0x17,0x00,0x00,0x80,0x17,0x00,0x01,0x90,
-0x17,0x08,0x1a,0x10,0x0b,0x89,0x02,0x00,0xca,0x05,0xf2,0x0c,0x29,0x99,0xc9,0x96,
-0x00,0x65,0x06,0x00,0x05,0xb6,0x79,0xc1,0x02,0x59,0x46,0x23,0x00,0x56,0x36,0x00,
-0x00,0xa1,0x36,0x08,0x1a,0x40,0x1b,0x24,0x00,0xf3,0x12,0x71,0x80,0x00,0x02,0xd9,
-0xc9,0x91,0x09,0x11,0x80,0x00,0x04,0x02,0x80,0x00,0x28,0xab,0x8c,0x85,0x00,0x72,
-0x08,0x00,0x00,0xa0,0x08,0x06,0x1a,0x30,0x0b,0x98,0x00,0x00,0xb4,0x07,0x10,0x39,
-0x71,0x05,0x00,0x66,0x07,0x40,0x91,0x00,0x00,0x37,0xf5,0x06,0x70,0x09,0x40,0x19,
-0x20,0x00,0xc4,0x31,0x4c,0x0a,0x00,0x2e,0x08,0xb0,0x19,0x66,0x00,0x05,0x80,0x04,
-0x81,0x48,0x89,0xa8,0x88,0xa1,0x03,0x40,0x01,0x89,0xc8,0x50,0x08,0x00,0x70,0x18,
-0x89,0xc8,0x85,0x00,0x30,0x13,0xb8,0x09,0xf1,0x06,0x10,0x08,0x31,0x02,0xa0,0x46,
-0x0a,0x10,0x46,0x00,0x47,0x03,0x00,0x01,0xa0,0x09,0x30,0x0b,0xb9,0x99,0xb0,0x49,
-0x07,0x30,0x81,0x09,0x00,0x04,0x00,0x40,0x09,0xc9,0x9d,0x95,0x08,0x00,0xf1,0x09,
-0x39,0xc9,0x9d,0x97,0x00,0x32,0x05,0x00,0x05,0x90,0x03,0xa1,0x05,0x00,0x00,0x23,
-0x01,0xb7,0x77,0xa0,0x01,0xa5,0x55,0xa0,0x08,0x00,0xc0,0xb6,0x66,0xa0,0x29,0xb8,
-0x88,0xb6,0x03,0xa1,0x06,0x81,0x25,0x86,0x05,0xf0,0x06,0x09,0x00,0x08,0x88,0xc8,
-0x85,0x90,0x18,0x00,0x99,0x04,0xb0,0x09,0x90,0xa3,0xa0,0x9a,0xa3,0x04,0x79,0x91,
-0x43,0x2b,0x60,0x03,0x96,0x0d,0x99,0xd9,0x99,0xf7,0x01,0x00,0x04,0x00,0x50,0x0d,
-0x99,0x99,0x99,0x08,0x63,0x04,0x01,0x04,0x00,0x20,0x02,0x96,0x98,0x00,0xf0,0x0a,
-0x06,0x99,0xc8,0xb0,0x07,0x67,0xa5,0xb0,0x07,0x33,0x92,0xa0,0x3c,0x98,0x98,0xc7,
-0x07,0x10,0x00,0x90,0x07,0x10,0x08,0xa0,0x00,0xa3,0x0f,0xf0,0x18,0xa0,0x90,0xa0,
-0x0a,0x0a,0x08,0x99,0xd9,0xb0,0x30,0x0a,0x01,0x1a,0x00,0xa0,0x54,0xd9,0x9d,0x9b,
-0x40,0x00,0x00,0x54,0x00,0x22,0x04,0x00,0x00,0xb0,0x07,0x30,0x07,0x50,0x00,0xa2,
-0x2a,0x9a,0x99,0x87,0xe5,0x0d,0xc1,0x00,0x38,0x00,0x80,0x00,0xa1,0x02,0x70,0x0a,
-0x30,0x7a,0x30,0xc3,0x09,0xf4,0x0f,0x03,0x33,0x30,0x5a,0x75,0xb5,0xb0,0x02,0x80,
-0x90,0x90,0x09,0x71,0x90,0x90,0x6e,0xa0,0x90,0x90,0x59,0x43,0x60,0x90,0x09,0x09,
-0x10,0x90,0x09,0x45,0x28,0x01,0x04,0xf1,0x05,0x09,0x0c,0x8c,0x17,0x09,0x0c,0x7c,
-0x18,0x09,0x03,0x72,0x18,0x09,0x04,0x8b,0x28,0x09,0x06,0x08,0x03,0xa0,0x03,0x44,
-0x43,0x68,0x03,0x97,0xdd,0x07,0xf2,0x0d,0x6a,0x80,0x09,0x34,0x80,0x35,0x96,0x8c,
-0x74,0x59,0x07,0xc1,0x35,0x90,0xa9,0x93,0x59,0x94,0x81,0x12,0x94,0x18,0x00,0x09,
-0x01,0x80,0x07,0xa0,0x21,0x04,0xf0,0x0f,0x00,0x09,0x38,0xc8,0x77,0x19,0x07,0x35,
-0x17,0x19,0x09,0xb8,0x17,0x19,0x07,0x94,0x67,0x19,0x15,0x0c,0x03,0x09,0x02,0x85,
-0x70,0x09,0x28,0x00,0x51,0x87,0x23,0x00,0xf2,0x08,0x24,0x84,0x30,0x09,0x09,0x88,
-0x0a,0x09,0x0a,0xc9,0x0a,0x09,0x09,0x29,0x0a,0x09,0x0b,0x5b,0x0a,0x09,0x0c,0x8c,
-0x06,0x0c,0x04,0x41,0x3a,0x04,0x87,0x00,0x7a,0x08,0xf2,0x01,0x02,0x40,0x26,0xc7,
-0x6c,0x75,0x04,0x44,0x12,0x32,0x0a,0x5a,0x18,0x53,0x0a,0x7b,0x04,0x00,0x85,0x08,
-0x07,0x11,0x53,0x08,0x3a,0x03,0xa1,0xb5,0x04,0xf4,0x10,0xa1,0x10,0x08,0x87,0x97,
-0xa6,0x08,0x26,0xb6,0x49,0x08,0x06,0xb6,0x09,0x08,0x36,0xb6,0x49,0x08,0x0a,0x88,
-0x35,0x08,0x0b,0x79,0x40,0x08,0x07,0x03,0x42,0x96,0xbd,0x05,0x41,0x49,0x9d,0x99,
-0xc1,0x1c,0x01,0xc1,0x28,0x00,0x90,0x00,0x92,0x00,0x90,0x06,0x80,0x00,0x90,0x58,
-0x42,0x05,0x02,0x22,0x05,0xc0,0x8e,0xb1,0x90,0x00,0x09,0x09,0xd9,0xb0,0x09,0x00,
-0x90,0x80,0x1d,0x05,0xb1,0x4c,0x93,0x70,0x90,0x41,0x0a,0x10,0x90,0x00,0x75,0x29,
-0x20,0x01,0x01,0xab,0x05,0xf3,0x07,0x07,0xaa,0x6d,0x8a,0x91,0xa0,0x90,0x98,0x09,
-0x09,0x09,0x80,0x90,0x90,0x88,0x09,0x75,0x27,0xa8,0xda,0x4a,0x28,0x1a,0x05,0x00,
-0xb9,0x04,0xf5,0x0f,0x08,0x00,0x6a,0xca,0x08,0x00,0x06,0x13,0x8c,0xb0,0x63,0x18,
-0x08,0x70,0x17,0x81,0x17,0x80,0x02,0xd0,0x44,0x80,0x0a,0x55,0x90,0x80,0x62,0x04,
-0x55,0x90,0x28,0x00,0xf6,0x0f,0x89,0x08,0x00,0xbe,0xd9,0x08,0x00,0x48,0x96,0x9d,
-0xc1,0x88,0x99,0x26,0x80,0x88,0x99,0x44,0x80,0x49,0xa6,0x91,0x90,0x03,0x75,0xb0,
-0x90,0x89,0x7b,0x26,0xc2,0x04,0xf0,0x2b,0xa0,0x90,0x00,0x07,0x30,0x90,0x62,0x2f,
-0x10,0x92,0xa0,0x9a,0x10,0xcb,0x10,0x08,0x15,0xd0,0x00,0x08,0x68,0x90,0x03,0x08,
-0x10,0x90,0x08,0x08,0x10,0xa9,0xb4,0x03,0x14,0x10,0x60,0x03,0xa6,0x96,0xa0,0x09,
-0x34,0x93,0x91,0x09,0x78,0xb7,0xb1,0x07,0x78,0xb7,0x91,0x28,0x89,0xc8,0x87,0x00,
-0x01,0x70,0x51,0x04,0x01,0x99,0x06,0x40,0x06,0x99,0xc9,0x91,0x08,0x00,0x01,0x18,
-0x00,0xb1,0x28,0x05,0x00,0x00,0x90,0x05,0x60,0x09,0xb9,0x99,0xc2,0xf8,0x09,0xf0,
-0x0d,0x12,0x46,0x30,0x3a,0x6a,0x34,0x20,0x2a,0x5a,0x5b,0x50,0x82,0x22,0x22,0xa0,
-0x19,0xa8,0x9c,0x10,0x00,0x94,0xb3,0x00,0x04,0x8a,0x96,0x20,0x44,0x45,0x03,0x12,
-0x03,0x1d,0x07,0xf1,0x1d,0x29,0xac,0x99,0x96,0x00,0x91,0x00,0x00,0x06,0xe8,0x88,
-0xc1,0x36,0x90,0x00,0x71,0x00,0x99,0x99,0xc1,0x00,0x90,0x00,0x71,0x0a,0x88,0x8b,
-0x40,0x08,0x88,0x89,0x30,0x57,0x77,0x77,0x71,0x04,0x81,0x11,0x10,0x04,0x88,0x8c,
-0x30,0x2a,0x01,0x22,0x04,0x88,0xe9,0x00,0x00,0x98,0x0b,0xf0,0x08,0x3a,0x93,0x00,
-0x18,0x91,0x19,0x81,0x64,0x77,0x77,0x35,0x05,0x88,0x88,0x50,0x09,0x00,0x01,0x80,
-0x09,0x88,0x89,0x80,0x08,0x00,0xf0,0x26,0x0c,0x88,0x88,0x97,0x08,0x57,0x77,0x37,
-0x08,0x38,0x76,0x17,0x08,0x62,0x08,0x17,0x08,0x69,0x8b,0x17,0x08,0x31,0x00,0x17,
-0x08,0x00,0x02,0x95,0x00,0x17,0x00,0x00,0x1a,0x98,0xa7,0x29,0x60,0x19,0x00,0x02,
-0xc9,0x10,0x29,0xdc,0x88,0x81,0x19,0x00,0x09,0x00,0xc8,0x88,0xb0,0xb9,0x12,0xf0,
-0x24,0x63,0x00,0x08,0x8d,0x88,0x83,0x90,0x00,0x03,0x69,0x38,0x87,0x26,0x95,0x20,
-0x82,0x69,0x59,0x89,0x26,0x92,0x10,0x02,0x69,0x00,0x05,0xa4,0x18,0x89,0xe8,0x85,
-0x00,0x2b,0x87,0x10,0x29,0x71,0x81,0x96,0x04,0x89,0xd8,0x70,0x05,0x40,0x00,0x90,
-0x05,0xa8,0x88,0xb0,0x08,0x00,0x01,0x90,0x00,0xb0,0x49,0x85,0x00,0x3a,0x65,0x55,
-0xa4,0x25,0x88,0x99,0x21,0x88,0x0a,0x41,0x09,0x88,0x88,0x90,0x04,0x00,0x00,0x05,
-0x02,0x71,0x80,0x90,0x00,0x06,0xc8,0xd8,0x81,0x27,0x02,0xf0,0x1c,0x88,0xa8,0x86,
-0x02,0x88,0x88,0x70,0x04,0x40,0x00,0x90,0x04,0xa8,0x88,0xb0,0x04,0x50,0x00,0x90,
-0x0b,0x89,0xd8,0xd0,0x94,0x8c,0x69,0x09,0x68,0xa7,0x90,0x93,0x77,0x59,0x09,0x63,
-0x07,0x94,0x56,0x97,0x69,0x80,0x00,0x06,0x35,0x04,0xf0,0x3f,0x0c,0x7b,0x68,0x79,
-0x0c,0x6a,0x68,0x69,0x0b,0x66,0x36,0x69,0x08,0x49,0x78,0x09,0x08,0x43,0x08,0x09,
-0x08,0x49,0x75,0x09,0x08,0x00,0x03,0x96,0x3a,0xa4,0xb7,0xa0,0x28,0x86,0x96,0x80,
-0x68,0x9c,0x9d,0x82,0x07,0x60,0x29,0x20,0x8c,0x95,0xa9,0xd3,0x07,0x25,0x80,0x90,
-0x0c,0x95,0xb8,0x90,0x89,0x99,0x99,0xd8,0x06,0x88,0x49,0x80,0x90,0x08,0x98,0x09,
-0x00,0x89,0x80,0x68,0x84,0x98,0x98,0x88,0x8d,0x80,0xdd,0x12,0xf0,0x21,0xa8,0xa8,
-0xd8,0x4c,0x7c,0x79,0x80,0x80,0x80,0x98,0x5c,0x7c,0x79,0x83,0x70,0x80,0x98,0x98,
-0x89,0x8c,0x81,0x00,0x00,0x90,0x0c,0x88,0xb8,0x89,0x08,0x77,0xc7,0x49,0x08,0x00,
-0x80,0x09,0x08,0x68,0x7c,0x09,0x08,0x57,0x6a,0x09,0x0c,0x88,0x88,0x89,0x4a,0x04,
-0x01,0x08,0x00,0xf7,0x00,0x68,0xc8,0x39,0x08,0x48,0xc8,0x19,0x08,0x00,0x86,0x09,
-0x08,0x77,0xa8,0x49,0x1c,0x00,0x11,0x84,0x23,0x07,0x30,0x89,0xd9,0x90,0x08,0x00,
-0xc0,0x18,0x00,0x90,0x00,0x54,0x00,0x90,0x00,0x63,0x88,0x88,0x85,0xe6,0x0d,0x40,
-0x28,0x9d,0x88,0x86,0xe6,0x01,0xd0,0x04,0x90,0x08,0x00,0x3c,0x56,0x8d,0x83,0x13,
-0x50,0x09,0x00,0x03,0x04,0x00,0x20,0x68,0x8d,0x08,0x0d,0x01,0x37,0x12,0xf1,0x0d,
-0x09,0x01,0xd8,0x85,0x5d,0x8a,0x31,0x18,0x09,0x03,0x91,0x08,0x09,0x00,0x06,0x28,
-0x0a,0xa1,0x49,0x47,0x66,0x06,0x50,0x35,0x00,0x00,0x08,0xa2,0x02,0x0b,0x00,0x04,
-0x00,0xf2,0x05,0x0a,0x8c,0x89,0x4d,0x8a,0x8c,0x89,0x08,0x0a,0x4b,0x49,0x08,0x32,
-0x4b,0x32,0x4d,0x87,0x9d,0x86,0x42,0x83,0x03,0x20,0x98,0x00,0x05,0x0f,0xf2,0x10,
-0x8c,0x5a,0x88,0x80,0x48,0xc7,0x91,0x85,0x00,0x74,0x4a,0x87,0x60,0x39,0xc6,0x99,
-0x35,0x04,0x8c,0x79,0x4c,0x00,0x00,0x80,0x95,0xd3,0x00,0x08,0x0a,0x90,0x90,0xcb,
-0x0d,0xf0,0x08,0x00,0x63,0x00,0x03,0x58,0x46,0x71,0x18,0x55,0x98,0x45,0x01,0x48,
-0xa9,0x81,0x08,0x37,0x53,0x91,0x09,0xb9,0xe8,0x83,0xd7,0x02,0x42,0x27,0x78,0xb7,
-0x76,0x9a,0x0e,0xf0,0x0f,0x90,0x90,0x07,0x09,0xaa,0xa7,0x4c,0x9a,0x6b,0x68,0x07,
+0x00,0x12,0x00,0xe1,0x8d,0x08,0x94,0x0a,0x60,0x1c,0x20,0x0b,0x3a,0x30,0x00,0x0c,
+0x50,0x00,0x01,0x00,0xf1,0x20,0x06,0x60,0x00,0x00,0x0d,0xd0,0x00,0x00,0x77,0x87,
+0x00,0x00,0xd0,0x0d,0x00,0x08,0x60,0x06,0x80,0x1f,0xee,0xee,0xf1,0x00,0x02,0xa4,
+0x00,0x79,0xc1,0xc0,0x77,0x0f,0xd9,0x0b,0x02,0xf6,0xa0,0xb0,0x32,0x0b,0x08,0x50,
+0x05,0x90,0x08,0xbb,0x80,0x34,0x00,0xf1,0x40,0x13,0x32,0x00,0x02,0x6c,0xf6,0x60,
+0x09,0x52,0x71,0xa2,0x1b,0x00,0x00,0x66,0x0b,0x00,0x00,0x65,0x07,0x70,0x02,0xb0,
+0x00,0x8a,0xaa,0x20,0x00,0x02,0x10,0x00,0x00,0x30,0x00,0x00,0x0a,0xbd,0xab,0x40,
+0x1c,0x28,0x70,0x93,0x0c,0xbb,0x30,0x19,0x0b,0x01,0x00,0x19,0x07,0x60,0x00,0xa3,
+0x00,0x6b,0xba,0x30,0x06,0xcc,0xc8,0x0c,0x30,0x65,0x0d,0x01,0xb0,0x3e,0x3a,0x00,
+0xb8,0x7c,0x00,0xb2,0x1b,0x00,0x4b,0xb5,0x54,0x00,0xf1,0x71,0x99,0x10,0x57,0xdd,
+0x85,0x71,0x55,0x17,0x71,0x66,0x17,0x72,0xbb,0x37,0x70,0x00,0x07,0x47,0xff,0x84,
+0x00,0x66,0x10,0x00,0x01,0x30,0x06,0x08,0xdb,0xc0,0x99,0xc0,0x00,0x07,0x05,0x80,
+0x00,0x71,0x81,0x00,0x0b,0xab,0x00,0x00,0x30,0x7e,0xdc,0x00,0x00,0x01,0x00,0x68,
+0x86,0x66,0x77,0x53,0x9a,0x77,0x78,0xec,0x73,0x30,0x06,0x79,0x80,0x06,0x76,0x60,
+0x06,0x9c,0xc7,0x79,0x00,0x28,0x96,0x00,0x04,0xa9,0x85,0xb0,0x0c,0x07,0x80,0x66,
+0x19,0x05,0x63,0x19,0x0b,0x8b,0x5a,0x88,0x07,0xb2,0x03,0xd2,0x00,0x6b,0xba,0x20,
+0x02,0x97,0x00,0x00,0x0a,0x14,0x73,0x30,0x0b,0x02,0xbf,0xf4,0x04,0xde,0x9f,0xf5,
+0x08,0x5a,0xff,0xe0,0x0a,0x5f,0xff,0xf5,0x0d,0xcb,0xbb,0xb4,0x43,0x01,0xf0,0x02,
+0x03,0x90,0x00,0x16,0x65,0x9a,0x00,0x1a,0xaa,0xaa,0x60,0x05,0xfe,0xef,0xf2,0x00,
+0x49,0x14,0x00,0x12,0x70,0x29,0x01,0xf0,0x0b,0x04,0x72,0x00,0x00,0x04,0x77,0x80,
+0x00,0x04,0x66,0x20,0x00,0x54,0x93,0x00,0x0c,0x47,0x4b,0x00,0x1f,0x3d,0x3e,0x00,
+0x03,0x85,0x93,0xd8,0x00,0x92,0xa0,0x07,0xc3,0xa0,0x08,0x5a,0xa0,0x00,0x0a,0x03,
+0x00,0xf1,0x2b,0xaa,0xaa,0xa9,0x00,0x46,0x10,0x00,0x05,0x40,0x87,0x20,0x08,0x00,
+0x01,0x80,0x35,0x6a,0xb5,0x70,0x60,0x37,0x40,0x62,0x34,0x0b,0x90,0x24,0x06,0x77,
+0x77,0x70,0x00,0x00,0x0a,0x00,0x00,0x00,0x1d,0x81,0x02,0xb9,0xb7,0x80,0x09,0x10,
+0xb5,0x80,0x0a,0x00,0x2d,0x00,0x09,0x00,0x1c,0x00,0x27,0x00,0x1c,0x6c,0x00,0xf1,
+0x58,0x37,0x33,0x73,0x27,0x05,0xe0,0x10,0x00,0x29,0x82,0x01,0x8b,0x38,0x20,0x39,
+0x98,0x44,0x00,0xa4,0x00,0x20,0x36,0x46,0x06,0x36,0x40,0x00,0x00,0x00,0x02,0x2a,
+0x35,0x10,0x35,0xb3,0x60,0x00,0x3c,0xac,0x40,0x56,0x88,0x09,0x0a,0x0c,0x50,0xa0,
+0xa9,0xa3,0xa6,0x00,0x00,0x21,0x00,0x60,0x00,0x30,0x0a,0x00,0x05,0x60,0xa0,0x00,
+0x0b,0x0a,0x01,0x00,0x91,0x82,0x73,0x04,0x21,0xc9,0x00,0x00,0x00,0x35,0x31,0x00,
+0x00,0x15,0x85,0x00,0x00,0x00,0x12,0x00,0x05,0x99,0xd6,0x00,0x00,0x08,0x50,0x00,
+0x00,0xa9,0xa0,0x00,0x0a,0x40,0x6a,0x92,0xd7,0x00,0xf1,0x05,0x50,0x10,0x07,0x9a,
+0x61,0x84,0x04,0x87,0x61,0x03,0xb7,0x12,0xb0,0xb4,0x40,0x0a,0x07,0xb2,0x8a,0x30,
+0x68,0x02,0xf2,0x07,0x19,0x00,0x20,0x07,0xac,0x92,0xa1,0x01,0x82,0x19,0x38,0x00,
+0xa0,0x18,0x06,0x05,0x60,0x46,0x00,0x0a,0x09,0xb1,0x0d,0x01,0xf2,0x0b,0x20,0x01,
+0x51,0x00,0xa0,0x02,0x63,0x47,0xd9,0x65,0x60,0x12,0x80,0xa0,0xa0,0x06,0x40,0x90,
+0x42,0x0a,0x00,0xa0,0x00,0x55,0x5a,0x60,0x20,0x00,0xf0,0x50,0x32,0x00,0x68,0xac,
+0x90,0x00,0x09,0x12,0x78,0x8a,0xb3,0x00,0x01,0xb0,0x81,0x04,0x70,0x77,0x22,0x20,
+0x04,0x77,0x30,0x00,0x40,0x16,0x38,0x8b,0xb6,0x41,0x00,0x09,0x11,0x09,0x99,0xca,
+0x20,0x00,0x02,0x80,0x08,0x00,0x99,0x00,0xa0,0x00,0x00,0x04,0x9a,0xa3,0x00,0x00,
+0x00,0x10,0x01,0xb3,0x02,0xa2,0x02,0xb0,0x00,0x1b,0x20,0x00,0x1b,0x30,0x00,0x0a,
+0x50,0x00,0x03,0x0a,0x00,0x0a,0x00,0x0a,0x08,0x9d,0x92,0x09,0x00,0x09,0x00,0x0a,
+0x30,0x09,0x00,0x0e,0x10,0x0a,0x00,0x09,0x00,0xa4,0x00,0x24,0x03,0x32,0x1a,0xaa,
+0xa0,0x6c,0x00,0x90,0x50,0x00,0x00,0x92,0x00,0x00,0x2b,0xba,0xa6,0xb6,0x00,0xf3,
+0x01,0x0a,0x23,0x89,0x9b,0x92,0x00,0x00,0x90,0x41,0x05,0xc1,0x91,0x00,0x00,0x3b,
+0x99,0xbd,0x01,0x22,0x00,0xb0,0x73,0x01,0x12,0xa0,0x07,0x00,0xa1,0x90,0x00,0x20,
+0x0b,0x00,0x2b,0x00,0x6a,0xa9,0x10,0x1c,0x00,0x8c,0x13,0x20,0x0a,0x02,0x66,0x00,
+0xa0,0x01,0x1c,0x00,0xf0,0x07,0x11,0xb1,0x10,0x17,0x76,0xc6,0x62,0x00,0x39,0xc0,
+0x00,0x00,0x71,0x92,0x00,0x00,0x18,0xe0,0x00,0x00,0x2a,0x60,0x6b,0x01,0x11,0x00,
+0x83,0x00,0xf1,0x0c,0x01,0xa5,0x73,0x38,0x77,0xc7,0x71,0x00,0x48,0xb0,0x00,0x00,
+0x90,0xb0,0x00,0x00,0x39,0xd0,0x00,0x00,0x3a,0x40,0x00,0x00,0x41,0x00,0x00,0xab,
+0x03,0xe1,0xa0,0x09,0x00,0x02,0xb5,0x6c,0x93,0x46,0xb3,0x2a,0x00,0x00,0x90,0x89,
+0x7e,0x00,0xf2,0x05,0x00,0x7a,0xaa,0x50,0x00,0x00,0x10,0x00,0x68,0xac,0x00,0x00,
+0x39,0x00,0x03,0x7d,0x88,0x81,0x54,0x95,0x94,0x00,0x52,0xa5,0x20,0x00,0x00,0x57,
+0xe2,0x03,0xb0,0x38,0x30,0x00,0x09,0xc9,0x50,0x00,0x00,0x90,0x59,0x90,0x34,0x00,
+0x70,0x05,0x61,0x80,0x00,0x0b,0x00,0x99,0xaf,0x01,0x00,0xf7,0x02,0xf0,0x0a,0x10,
+0x00,0x46,0x11,0x85,0x19,0xca,0x50,0x20,0x00,0xa0,0x69,0x80,0x01,0x90,0x00,0x00,
+0x06,0x52,0x60,0x00,0x0b,0x00,0xa9,0x90,0x1f,0x00,0x40,0x28,0x99,0x93,0x32,0x4f,
+0x00,0x30,0x48,0x00,0x9b,0xfb,0x00,0x50,0x05,0x9a,0x9b,0x40,0x45,0xa5,0x05,0x01,
+0x02,0x01,0xf2,0x02,0x29,0x50,0x00,0x5a,0x82,0x00,0x15,0x78,0x9a,0xa0,0x14,0x23,
+0x90,0x00,0x00,0x09,0x00,0x7a,0x00,0x70,0x09,0x30,0x00,0x00,0x00,0x9c,0x30,0x3f,
+0x00,0xc1,0x14,0x67,0x9a,0xa0,0x15,0x33,0xa2,0x30,0x00,0x0a,0x03,0x63,0x1c,0x00,
+0x70,0x0a,0x20,0x00,0x00,0x01,0x9c,0x20,0x1c,0x00,0xd1,0x11,0x00,0x00,0x29,0x00,
+0x40,0x0a,0x4a,0x60,0x08,0x80,0x00,0x55,0x74,0x01,0xf0,0x1b,0x2a,0xaa,0xa4,0x00,
+0x12,0x00,0x00,0x00,0x76,0x21,0x00,0x39,0xe6,0x25,0x90,0x02,0x90,0x02,0x44,0x0b,
+0x20,0x18,0x00,0x27,0x28,0x9c,0x10,0x00,0x71,0x1a,0xc1,0x00,0x29,0xa3,0x10,0x70,
+0x01,0x12,0x09,0x02,0x88,0x70,0x6e,0x00,0xb1,0x11,0x00,0x00,0xd3,0x90,0x00,0x0c,
+0x04,0xaa,0xa1,0x10,0x79,0x04,0xf0,0x07,0x86,0x00,0x02,0xa3,0xa2,0xa1,0x0a,0x03,
+0x70,0x27,0x09,0x07,0x30,0x09,0x0a,0x2b,0x00,0x65,0x04,0xa2,0x3a,0x90,0x5e,0x01,
+0x30,0x10,0x00,0x10,0xfa,0x01,0xf3,0x04,0x90,0x79,0xd9,0x39,0x00,0x09,0x00,0x91,
+0x00,0x90,0x0c,0x37,0x7c,0x70,0xb0,0x89,0xa1,0x20,0x00,0x01,0x00,0xf0,0x17,0x7c,
+0x30,0x00,0x05,0x80,0xb2,0x00,0x3b,0x00,0x1b,0x10,0x01,0x00,0x02,0xc1,0x00,0x00,
+0x00,0x23,0x00,0x00,0x02,0x60,0x00,0x6b,0x17,0x42,0x04,0x81,0xb1,0x00,0x3b,0x00,
+0x3b,0x00,0x21,0x00,0x04,0x6f,0x01,0xf1,0x1f,0x53,0x38,0x9c,0x84,0x00,0x18,0x00,
+0x59,0x9c,0x97,0x00,0x08,0x00,0x38,0x8d,0x60,0x74,0x28,0x49,0x05,0x61,0x00,0x03,
+0x9a,0x90,0x00,0x00,0x07,0x30,0x10,0x01,0x6d,0x40,0x90,0x29,0x85,0x5b,0xb0,0x83,
+0xa0,0x09,0x53,0x29,0x20,0x86,0x00,0xbb,0x04,0xf3,0x09,0x82,0x11,0x00,0x07,0xc6,
+0x21,0xb2,0x05,0xc1,0x00,0x01,0x08,0x62,0x00,0x20,0x06,0xc0,0x00,0xa0,0x00,0x88,
+0x8a,0x60,0x00,0x7f,0x01,0xf1,0x09,0x02,0x40,0x19,0x00,0x00,0xba,0xcb,0x80,0x05,
+0xc1,0x90,0x75,0x09,0x1b,0x70,0x19,0x09,0x1d,0x50,0x56,0x06,0x91,0x38,0x90,0x21,
+0x01,0x00,0x67,0x03,0xf0,0x1f,0x70,0x00,0x07,0xbb,0x90,0x00,0x16,0x30,0x21,0x07,
+0xca,0x81,0xa0,0x09,0x10,0x0a,0x00,0x68,0x26,0x90,0x00,0x48,0x50,0x01,0x10,0x00,
+0x02,0x9a,0x70,0x26,0x00,0x00,0x45,0x48,0x50,0x7b,0x41,0x49,0x31,0x00,0x0a,0x03,
+0x67,0xb2,0x01,0x32,0x33,0x00,0xf2,0x04,0x47,0x8a,0x40,0x6a,0x10,0xb0,0x75,0x00,
+0xa0,0x72,0x00,0xa0,0x10,0x02,0x90,0x02,0x8a,0x10,0x02,0xeb,0x00,0xf1,0x08,0x09,
+0x9b,0xa0,0x00,0x03,0x80,0x00,0x05,0xe8,0x70,0x08,0x81,0x03,0x80,0x33,0x86,0x0a,
+0x00,0x73,0x89,0x60,0x00,0x57,0xab,0x01,0x00,0x1a,0x02,0xf3,0x06,0x39,0xd4,0x9b,
+0x10,0x00,0xc6,0x05,0x30,0x08,0xb0,0x07,0x20,0x47,0x90,0x09,0x01,0x00,0x90,0x06,
+0xc6,0x00,0xaa,0x00,0x01,0x20,0x00,0xf1,0x24,0xd3,0x9a,0x70,0x00,0xd7,0x00,0x76,
+0x07,0xb0,0x00,0x19,0x38,0x90,0x00,0x75,0x20,0x90,0x5c,0x70,0x00,0x60,0x10,0x00,
+0x00,0x03,0x00,0x00,0x06,0x7b,0x77,0x00,0x02,0xa3,0x10,0x00,0x04,0xb9,0x78,0x90,
+0x0a,0x17,0xc1,0x00,0x00,0x92,0x80,0x00,0x00,0x79,0x89,0x40,0x3c,0x00,0x00,0xc6,
+0x05,0xf1,0x07,0x0b,0x10,0x00,0x00,0x46,0x00,0x00,0x00,0xb8,0x30,0x00,0x05,0xa1,
+0xa0,0x02,0x0b,0x00,0xa0,0x73,0x37,0x00,0x8a,0x02,0x06,0xd1,0x78,0x88,0x95,0x00,
+0x40,0x92,0x00,0x94,0x40,0x00,0xa0,0x00,0x09,0x2e,0x04,0xf0,0x00,0x2a,0x99,0x99,
+0xb0,0x00,0x03,0x04,0x80,0x00,0x0b,0x39,0x00,0x00,0x0b,0x00,0x2b,0x02,0x30,0x00,
+0x04,0xb1,0x30,0x01,0x02,0x3b,0x02,0x70,0x03,0xb1,0x02,0x8c,0x00,0x77,0x1a,0x71,
+0x02,0x00,0x58,0x02,0x00,0x03,0x03,0xa4,0x00,0x67,0x00,0x01,0xa5,0x00,0x49,0x9b,
+0x00,0x16,0x97,0x03,0x11,0xb0,0x99,0x00,0xf1,0x03,0xa1,0x00,0xc9,0x99,0x9b,0xa0,
+0x00,0x28,0x50,0x00,0x82,0x00,0x04,0x80,0x02,0x98,0x00,0x01,0x30,0x02,0xc0,0x59,
+0xda,0x92,0x00,0x81,0x00,0x00,0x81,0x00,0x99,0xda,0x95,0x89,0x01,0xb4,0x11,0x11,
+0x10,0x08,0x8c,0x98,0x60,0x00,0x09,0x10,0x00,0x04,0x00,0xf3,0x06,0x5a,0xaa,0xaa,
+0xa1,0x00,0x03,0x00,0x59,0x9d,0x96,0x00,0x5e,0x00,0x04,0x98,0x00,0x69,0x08,0x00,
+0x10,0x6c,0x0d,0x01,0xf1,0x02,0x02,0x99,0x9e,0x99,0x00,0x07,0xd0,0x00,0x09,0x59,
+0x00,0x3b,0x20,0x81,0x00,0x00,0x9c,0x73,0x00,0x70,0x99,0xd9,0x99,0x00,0x0a,0x00,
+0xa0,0x00,0x0b,0x83,0xb1,0x01,0x80,0xa2,0x09,0xb3,0x00,0x00,0xdc,0x03,0xf2,0x07,
+0x0a,0x01,0x74,0x1a,0x9d,0x99,0x80,0x00,0x19,0x00,0xa0,0x00,0x65,0x00,0x90,0x01,
+0xb0,0x03,0x70,0x0a,0x10,0xac,0x97,0x01,0x10,0x03,0x19,0x03,0xf2,0x03,0x02,0x20,
+0x08,0xad,0xa7,0x20,0x01,0x06,0x30,0x10,0x04,0x6a,0xca,0x91,0x06,0x31,0x90,0x00,
+0xe1,0x03,0x12,0x30,0xf5,0x00,0xa0,0xb1,0x00,0x00,0x7a,0x88,0xc0,0x78,0x00,0x47,
+0x04,0x0f,0x01,0x71,0x0a,0x40,0x00,0x5b,0x30,0x00,0x16,0x41,0x02,0xe0,0x32,0x00,
+0x1a,0x00,0x74,0x00,0xa9,0x9b,0x70,0x0a,0x40,0x09,0x20,0x23,0x29,0x01,0x10,0x02,
+0x2d,0x00,0x41,0x10,0x00,0x04,0x40,0x7a,0x00,0x01,0x08,0x01,0xb2,0x04,0xc9,0xba,
+0xa1,0x1b,0x00,0xa0,0x00,0x31,0x00,0xa0,0xb3,0x05,0x11,0x77,0x34,0x01,0x00,0x25,
+0x05,0xe0,0x41,0x00,0xb0,0x01,0x74,0x02,0xe9,0xaa,0xa1,0x0b,0x10,0xa0,0x00,0x43,
+0x2d,0x00,0x00,0xc4,0x07,0x12,0x59,0x21,0x08,0x34,0x6a,0xaa,0xa8,0x64,0x01,0x00,
+0x03,0x00,0xb0,0x7a,0xaa,0xaa,0x00,0xa0,0x0a,0x00,0x49,0xd9,0x9d,0x93,0x08,0x00,
+0x01,0x04,0x00,0x62,0x00,0x66,0x00,0x00,0x07,0x90,0x6a,0x04,0xb0,0x20,0x03,0x22,
+0x00,0xa0,0x0a,0x64,0x69,0xd9,0x9d,0x92,0xae,0x04,0xb2,0x00,0xa0,0x28,0x00,0x00,
+0x00,0x74,0x00,0x00,0x08,0x80,0x20,0x00,0x00,0x01,0x00,0xf4,0x09,0x97,0x00,0x00,
+0x02,0x04,0x00,0x00,0x09,0x80,0x00,0xa1,0x00,0x10,0x09,0x50,0x00,0x03,0xb4,0x00,
+0x06,0xd9,0x10,0x00,0x01,0x2a,0x01,0xf1,0x00,0xa5,0x06,0x54,0x01,0x05,0x00,0x30,
+0x0a,0x60,0x00,0xb0,0x00,0x20,0x09,0x40,0x20,0x00,0x21,0xc9,0x10,0x3f,0x00,0x42,
+0x05,0xaa,0xaa,0x20,0xdb,0x01,0xe2,0x65,0x00,0x00,0x04,0xe2,0x00,0x00,0x69,0x1b,
+0x20,0x0b,0x60,0x01,0xb0,0x3b,0x00,0x62,0x02,0x63,0x06,0xa9,0x9a,0x51,0x20,0x00,
+0xe4,0x82,0x00,0x00,0x05,0xd1,0x00,0x00,0x78,0x2b,0x10,0x1b,0x50,0x02,0xb0,0xc0,
+0x02,0xa1,0x0a,0x36,0x9a,0x59,0xd5,0x26,0x50,0x0a,0x02,0x80,0x08,0x05,0xf2,0x06,
+0xb9,0xa6,0x00,0x30,0x01,0x53,0x00,0xa0,0x00,0x52,0x00,0xb6,0x9a,0xc0,0x69,0xd3,
+0x07,0x40,0x00,0xa0,0x27,0x76,0x01,0x21,0x6a,0x9a,0xf7,0x02,0xe0,0x07,0x00,0x00,
+0x80,0x76,0x00,0x37,0x00,0x80,0x09,0x20,0x00,0x03,0xa0,0x59,0x01,0x22,0x07,0xa1,
+0x38,0x01,0xf1,0x00,0x00,0x03,0x52,0x04,0x00,0x02,0x52,0x0a,0x20,0x05,0x60,0x02,
+0x90,0x0a,0x10,0xa1,0x02,0x61,0x01,0xb1,0x00,0x00,0x6b,0x20,0xb3,0x01,0xf4,0x08,
+0x00,0x06,0x10,0x00,0x02,0xe9,0x98,0x01,0xb1,0x01,0xa1,0xb2,0x92,0x83,0x00,0x00,
+0xbd,0x00,0x00,0x69,0x41,0x02,0xb6,0x71,0x04,0xf0,0x09,0x31,0x00,0x1b,0x00,0x74,
+0x00,0x99,0x9a,0x80,0x09,0x51,0x08,0x30,0x34,0x1a,0x8a,0x00,0x00,0x01,0xcb,0x00,
+0x00,0x5b,0x10,0xde,0x0a,0x02,0x13,0x02,0x40,0x89,0xa9,0x40,0x00,0x0e,0x03,0x80,
+0x99,0xd9,0x94,0x00,0x02,0x70,0x00,0x00,0xd0,0x09,0x13,0x89,0xd0,0x01,0xf2,0x01,
+0x50,0x03,0x54,0x54,0x28,0x07,0x01,0x83,0x00,0x04,0x90,0x00,0x79,0x00,0x03,0x40,
+0x50,0x08,0xb1,0x0a,0x00,0x61,0x0b,0x07,0x30,0xb0,0x06,0x21,0x13,0x80,0x6d,0x03,
+0x61,0x01,0xb3,0x00,0x00,0x7b,0x30,0xae,0x00,0x41,0x01,0x99,0x99,0x50,0x00,0x04,
+0x41,0x99,0xc9,0x94,0x00,0xe3,0x05,0x41,0x50,0x00,0x00,0x5a,0x5d,0x02,0x00,0x43,
+0x02,0x50,0x53,0x05,0x99,0x97,0x53,0x0a,0x00,0x63,0x49,0x9a,0xa9,0x90,0x00,0x07,
+0x63,0x01,0x03,0xbf,0x04,0x10,0x19,0x31,0x00,0x51,0x1e,0x82,0x01,0x92,0x9a,0x0a,
+0x00,0x10,0x04,0x51,0x00,0xb0,0x0b,0x01,0x67,0xa0,0x05,0x1a,0xb6,0x10,0xa0,0x5b,
+0x3a,0x5e,0x02,0x12,0x03,0x12,0x07,0x81,0x08,0x88,0xd8,0x84,0x01,0x12,0xa1,0x10,
+0xe3,0x08,0x00,0xee,0x03,0x25,0xa4,0x00,0x01,0x00,0x57,0x06,0xaa,0xaa,0x40,0x00,
+0x01,0x00,0x40,0x3b,0xaa,0xaa,0xb1,0x1c,0x07,0xf1,0x01,0x05,0x99,0x9c,0x90,0x00,
+0x00,0x4a,0x00,0x00,0x29,0xb4,0x20,0x0a,0x83,0x91,0xa5,0x9e,0x00,0x10,0x00,0xad,
+0x00,0x10,0x73,0x53,0x00,0x70,0x04,0x70,0x00,0x1b,0x00,0x02,0xc2,0xce,0x02,0x01,
+0x37,0x01,0xf1,0x07,0x23,0x00,0x00,0xa1,0x0b,0x00,0x00,0xc0,0x08,0x30,0x03,0x80,
+0x01,0xa0,0x0b,0x10,0x00,0xb0,0x27,0x00,0x00,0x63,0x51,0x01,0xf1,0x05,0x20,0x22,
+0x75,0x00,0xb1,0x29,0x00,0x00,0xb0,0x0a,0x10,0x04,0x70,0x03,0x70,0x0b,0x10,0x00,
+0xc0,0x47,0x56,0x06,0x01,0xe5,0x02,0xc0,0x76,0x00,0x83,0x19,0x32,0x00,0xb0,0x09,
+0x10,0x01,0x90,0x02,0xcd,0x01,0x52,0xb0,0x29,0x00,0x00,0x83,0x38,0x04,0xb4,0x25,
+0x0a,0x00,0x05,0x40,0xa0,0x17,0xa0,0x0a,0xa8,0x30,0x39,0x04,0x11,0x5a,0x40,0x08,
+0xa4,0x00,0x60,0x00,0x47,0x3a,0x00,0x49,0x40,0xa9,0x95,0xec,0x07,0x31,0x06,0xa9,
+0xaa,0x32,0x01,0x30,0x9a,0xaa,0xa8,0x19,0x01,0xa5,0x00,0x64,0x00,0x01,0xb0,0x00,
+0x2b,0x20,0x0a,0x91,0xd8,0x00,0x60,0x02,0x66,0xaa,0xaa,0xa9,0x10,0x65,0x05,0x00,
+0x5f,0x00,0x84,0x2a,0x00,0x00,0x3b,0x10,0x00,0xb8,0x10,0x05,0x01,0x71,0x6a,0xaa,
+0xaa,0xb6,0x00,0x00,0x38,0xce,0x01,0xa9,0x02,0xa0,0x00,0x03,0xb1,0x00,0x0b,0x81,
+0x00,0x00,0x86,0x06,0xa7,0xa3,0x00,0x3b,0x00,0x0b,0x30,0x01,0x00,0x01,0xc2,0x86,
+0x06,0x12,0x41,0x86,0x06,0x41,0x1b,0x10,0x11,0x00,0xcd,0x02,0xe0,0x43,0x00,0x00,
+0x04,0x61,0x00,0x7b,0x45,0x62,0x06,0x70,0x94,0x00,0x4a,0x0e,0x04,0x30,0x00,0x00,
+0xb3,0x6f,0x07,0x05,0x33,0x02,0xf0,0x04,0x20,0xa0,0x20,0x03,0x80,0xa0,0xa0,0x09,
+0x00,0xa0,0x36,0x00,0x2a,0x80,0x00,0x00,0x00,0x00,0x00,0xf6,0x19,0x00,0x00,0x00,
+0x20,0x00,0x09,0x14,0x62,0x59,0x9d,0xa9,0x80,0x00,0x09,0x00,0x00,0x09,0x29,0x08,
+0x20,0x47,0x09,0x01,0xa0,0x30,0x1a,0x00,0x20,0x00,0x67,0x00,0x00,0x00,0x00,0x04,
+0x62,0x00,0x09,0x14,0x52,0x20,0x00,0xa0,0x09,0x30,0x47,0x09,0x01,0xc0,0x30,0x1a,
+0x00,0x30,0x20,0x00,0xf3,0x09,0x19,0x99,0x99,0xa2,0x00,0x00,0x01,0xb0,0x00,0x30,
+0x0b,0x20,0x00,0x88,0xb2,0x00,0x00,0x06,0x90,0x00,0x00,0x00,0x76,0x00,0x01,0x00,
+0xf4,0x03,0x08,0xaa,0x61,0x00,0x00,0x42,0x1a,0x96,0x10,0x00,0x04,0x70,0x56,0x30,
+0x00,0x03,0x7a,0xa1,0x1a,0x00,0xf5,0x09,0x0b,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+0x55,0x01,0x00,0x00,0xa0,0x09,0x20,0x01,0xa1,0x36,0xb0,0x3b,0xa9,0x75,0x93,0x00,
+0x01,0x00,0xf0,0x0b,0x74,0x00,0x91,0x0b,0x00,0x02,0xba,0x50,0x00,0x04,0xe7,0x00,
+0x04,0xb0,0x88,0x09,0x80,0x00,0x30,0x10,0x00,0x00,0x05,0x99,0x99,0x60,0x38,0x00,
+0x63,0x09,0x9d,0x99,0x92,0x00,0x0a,0x44,0x00,0x30,0x07,0xba,0xa0,0x32,0x00,0xf2,
+0x16,0x06,0x20,0x00,0x16,0xa8,0x9a,0x55,0xa0,0x92,0x00,0xa1,0x30,0x00,0x64,0x00,
+0x00,0x15,0x00,0x00,0x30,0x00,0x00,0x00,0xb0,0x00,0x40,0x14,0xca,0x98,0xd1,0x25,
+0x57,0x07,0x40,0x00,0x0a,0x16,0x32,0x00,0x60,0x06,0x40,0x00,0x00,0x01,0x10,0x35,
+0x00,0xf0,0x0d,0x09,0x99,0xc0,0x00,0x00,0xa0,0x00,0x00,0x90,0x79,0x9a,0xc9,0x02,
+0x88,0x89,0x30,0x00,0x11,0x16,0x50,0x00,0x00,0x07,0x30,0x00,0x00,0x09,0x10,0xa6,
+0x00,0xf0,0x03,0x1a,0xaa,0xaa,0xa6,0x39,0x88,0x90,0x00,0x00,0x90,0x29,0x88,0xd0,
+0x00,0x00,0x90,0x49,0x99,0x06,0x00,0x31,0x69,0x99,0x96,0x49,0x00,0x80,0x0a,0x39,
+0x99,0x9a,0x00,0x00,0x0a,0x7a,0x06,0x00,0x40,0x01,0x09,0x99,0x95,0x52,0x00,0xf3,
+0x01,0x79,0x99,0x9d,0x00,0x00,0x02,0x90,0x00,0x01,0xb1,0x00,0x18,0xa1,0x00,0x01,
+0x30,0xef,0x00,0x21,0x19,0x0a,0x03,0x00,0xf6,0x00,0x09,0x00,0x37,0x00,0x00,0xa2,
+0x00,0x4b,0x50,0x00,0x20,0x00,0x00,0xa0,0xa0,0x04,0x00,0xc3,0x90,0xa0,0x14,0x06,
+0x50,0xa3,0xa1,0x2a,0x00,0xb9,0x00,0x00,0xd8,0x00,0x10,0xa0,0x07,0x00,0xa2,0x01,
+0x10,0xa0,0x01,0xa1,0x0a,0x17,0xa1,0x00,0xea,0x4a,0x00,0x65,0x8a,0xaa,0xa8,0xa0,
+0x00,0x0a,0x03,0x00,0xf1,0x21,0xa9,0x99,0x9b,0x99,0x99,0x98,0x0a,0x00,0x00,0xb0,
+0xa0,0x00,0x19,0x01,0x00,0x08,0x30,0x00,0x06,0x80,0x00,0x3b,0x70,0x00,0x00,0x10,
+0x00,0x00,0x55,0x00,0x00,0x00,0x87,0x00,0x21,0x00,0x10,0x0b,0x20,0x00,0x0a,0x50,
+0x00,0x4b,0x40,0x07,0xb8,0x10,0x44,0x00,0xc5,0x2a,0xaa,0xaa,0xa1,0x01,0x00,0x00,
+0x10,0x4a,0xaa,0xaa,0xa8,0x46,0x01,0x01,0x04,0x00,0x24,0x99,0x90,0x0c,0x00,0x41,
+0x79,0x9d,0x99,0x93,0xcf,0x00,0x00,0x6a,0x01,0x10,0x09,0x14,0x00,0xa1,0xa3,0x00,
+0x00,0x09,0x08,0x70,0x00,0x09,0x00,0x10,0x10,0x00,0x10,0x09,0xfe,0x01,0xf0,0x07,
+0xe9,0x96,0x00,0x05,0x90,0x00,0x00,0x3b,0x9a,0x10,0x06,0xa2,0x81,0xb2,0x26,0x01,
+0x80,0x05,0x00,0x01,0x80,0x00,0x04,0x00,0xf1,0x13,0x22,0x22,0x22,0x20,0x46,0x6b,
+0x66,0x61,0x38,0x8c,0x98,0x80,0x53,0x38,0x03,0x90,0x53,0x78,0x08,0x90,0x53,0xcc,
+0x88,0x90,0x53,0x00,0x00,0x90,0x53,0x00,0x06,0xa0,0x00,0x09,0xe2,0x00,0xe1,0xc8,
+0x8d,0x88,0x99,0x00,0x90,0x09,0xd9,0x9d,0x99,0x96,0x00,0x90,0x06,0x15,0x00,0xf1,
+0x13,0x90,0x00,0x00,0x01,0x34,0x60,0x07,0x78,0x93,0x00,0x08,0xb9,0xaa,0x92,0x28,
+0xc9,0xbb,0x96,0x00,0x93,0x56,0x30,0x18,0x8f,0xf9,0x83,0x03,0xa5,0x7a,0x50,0x37,
+0x03,0x50,0x57,0xb8,0x01,0x50,0x9a,0xe1,0x00,0x03,0xb2,0xdf,0x01,0x61,0x00,0x08,
+0x00,0x00,0x00,0x80,0x07,0x00,0xf1,0x16,0x59,0x60,0x00,0x00,0x60,0x09,0x00,0x07,
+0x44,0x09,0x00,0x1d,0x09,0x1c,0x97,0x9b,0x4d,0x79,0x08,0x09,0x19,0x09,0x27,0x09,
+0x09,0x05,0x84,0x09,0x09,0x00,0x09,0x09,0x06,0x88,0x97,0x00,0x00,0x63,0x00,0xf4,
+0x0e,0x90,0x06,0x50,0x00,0x90,0x0e,0x39,0x99,0xd5,0x8c,0x02,0x00,0x90,0x19,0x06,
+0x40,0x90,0x09,0x00,0x90,0x90,0x09,0x00,0x00,0x90,0x09,0x00,0x69,0x70,0x84,0x02,
+0xf4,0x09,0x01,0x84,0x09,0x00,0x07,0x3a,0x09,0x00,0x1e,0x1c,0x9d,0x93,0x8b,0x32,
+0x09,0x00,0x08,0x49,0x9d,0x97,0x08,0x00,0x09,0x00,0x04,0x00,0x01,0x01,0x00,0xf1,
+0x08,0x80,0x25,0x92,0x06,0x68,0x79,0x00,0x3f,0x00,0x18,0x00,0x89,0x58,0x8c,0x86,
+0x09,0x00,0x28,0x00,0x09,0x00,0x18,0x00,0x08,0x00,0xf1,0x10,0x28,0x88,0x85,0x00,
+0x30,0x31,0x00,0x03,0x60,0x44,0x00,0x0c,0x18,0x88,0x91,0x7c,0x07,0x10,0x90,0x09,
+0x04,0x42,0x60,0x09,0x02,0x76,0x20,0x09,0x38,0x8c,0x84,0x42,0x00,0xf1,0x0f,0x50,
+0x15,0x80,0x06,0x3b,0x6a,0x00,0x1d,0x08,0x09,0x00,0x8b,0x0c,0x8c,0x85,0x09,0x08,
+0x08,0x00,0x09,0x08,0x05,0x30,0x09,0x08,0x35,0x76,0x09,0x2b,0x56,0x53,0x02,0xf0,
+0x0e,0x03,0x50,0x90,0x00,0x09,0x10,0x90,0x00,0x2d,0x69,0xfc,0x93,0x8b,0x05,0xb8,
+0x00,0x09,0x08,0x93,0x70,0x09,0x99,0xc8,0xa4,0x09,0x00,0x90,0x00,0x09,0xfb,0x00,
+0xf2,0x00,0x71,0x50,0x00,0x06,0x37,0xa8,0x84,0x1e,0x18,0x90,0x00,0x8b,0x51,0x98,
+0x82,0x18,0x00,0x22,0x98,0x83,0x08,0x00,0x15,0x90,0x55,0x03,0x00,0xde,0x00,0xf0,
+0x0d,0x07,0x79,0x9d,0x97,0x2e,0x18,0x8c,0x84,0x8a,0x17,0x09,0x08,0x08,0x1a,0x8c,
+0x86,0x08,0x09,0x64,0x00,0x08,0x02,0xf6,0x00,0x08,0x59,0x15,0xa7,0x94,0x02,0xf2,
+0x11,0x00,0x45,0xc8,0x8a,0x60,0x1c,0x0c,0x88,0x96,0x07,0x90,0x00,0x90,0x00,0x08,
+0x48,0xae,0x87,0x00,0x80,0x1a,0xc7,0x00,0x08,0x2b,0x19,0x75,0x00,0x85,0x10,0x90,
+0x50,0x49,0x00,0xf0,0x0c,0x30,0x30,0x00,0x05,0x52,0x65,0x21,0x0c,0x25,0x55,0x53,
+0x7b,0x06,0x77,0x60,0x08,0x06,0x66,0x60,0x08,0x0b,0x77,0xb0,0x08,0x08,0x00,0x80,
+0x08,0x00,0xf3,0x2e,0x03,0x30,0x80,0x00,0x09,0x05,0xc7,0xb2,0x3c,0x55,0x5a,0x40,
+0x79,0x87,0x76,0x85,0x09,0x81,0x75,0x30,0x09,0x80,0x77,0x43,0x09,0x10,0x27,0x80,
+0x09,0x07,0xa4,0x00,0x00,0x50,0x33,0x00,0x07,0x59,0x99,0x93,0x2d,0x06,0x21,0x70,
+0x6a,0x48,0x9a,0x95,0x09,0x07,0x88,0x80,0x09,0x08,0x00,0x90,0x09,0x0b,0x77,0xc0,
+0x09,0xb2,0x00,0xf0,0x62,0x01,0x70,0x08,0x00,0x08,0x49,0xac,0x94,0x3d,0x00,0x99,
+0x80,0x9a,0x44,0xb6,0xc0,0x09,0x44,0xc6,0xc0,0x09,0x44,0xa3,0xa0,0x09,0x45,0x44,
+0x40,0x09,0x27,0x77,0x73,0x00,0x50,0x41,0x00,0x05,0x6a,0x88,0xa1,0x1d,0x2a,0x77,
+0xb1,0x7a,0x2a,0x77,0x71,0x08,0x3d,0x56,0x43,0x08,0x4b,0xaa,0x93,0x08,0x78,0x56,
+0x43,0x08,0x77,0x56,0x72,0x00,0x50,0x23,0x00,0x06,0x68,0x88,0x85,0x1c,0x09,0x66,
+0xb0,0x7a,0x05,0x66,0x70,0x08,0x78,0x77,0x79,0x08,0x26,0x8a,0x72,0x08,0x00,0x26,
+0x00,0x08,0x02,0x94,0x00,0x04,0x40,0x00,0x08,0x0a,0x68,0xb6,0x28,0x2c,0x58,0xb6,
+0x28,0x9a,0x55,0x96,0x28,0x09,0x04,0x00,0xf0,0x3c,0x38,0x84,0x18,0x09,0x45,0x80,
+0x08,0x09,0x70,0x50,0x85,0x04,0x42,0x73,0x20,0x0a,0x49,0xca,0x91,0x3c,0x5a,0xb9,
+0x92,0x7a,0x4e,0x87,0x70,0x09,0x7b,0x4a,0xb0,0x09,0x0a,0x3a,0xa0,0x09,0x0c,0x7c,
+0xc0,0x09,0x09,0x08,0xa0,0x00,0x41,0x30,0x00,0x05,0x5a,0x7b,0x00,0x0b,0x7b,0x8a,
+0xb0,0x7a,0x09,0xc8,0x90,0x08,0x38,0x93,0x70,0x08,0x16,0x6b,0x60,0x08,0x25,0x88,
+0x72,0x08,0x55,0x66,0x03,0xc4,0x00,0x40,0x05,0x88,0x88,0x80,0x08,0x00,0xf2,0x04,
+0x29,0xaa,0x9b,0x96,0x00,0x63,0x17,0x00,0x00,0x80,0x17,0x00,0x01,0x90,0x17,0x08,
+0x1a,0x10,0x0b,0x89,0x02,0xf2,0x0f,0x02,0x60,0x00,0x29,0x99,0xc9,0x96,0x00,0x65,
+0x06,0x00,0x05,0xb6,0x79,0xc1,0x02,0x59,0x46,0x23,0x00,0x56,0x36,0x00,0x00,0xa1,
+0x36,0x08,0x1a,0x40,0x1b,0x24,0x00,0xf1,0x10,0x71,0x80,0x00,0x02,0xd9,0xc9,0x91,
+0x09,0x11,0x80,0x00,0x04,0x02,0x80,0x00,0x28,0xab,0x8c,0x85,0x00,0x72,0x08,0x00,
+0x00,0xa0,0x08,0x06,0x1a,0x30,0x0b,0x98,0x90,0x01,0x00,0x1c,0x04,0x10,0x39,0x71,
+0x05,0xf0,0x17,0x70,0x00,0x00,0x0b,0x91,0x00,0x00,0x37,0x29,0x00,0x00,0xb0,0x09,
+0x40,0x19,0x20,0x00,0xc4,0x31,0x00,0x00,0x03,0x00,0x02,0x70,0x00,0x00,0x19,0x66,
+0x00,0x05,0x80,0x04,0x81,0x48,0x89,0xa8,0x88,0xa1,0x03,0x40,0x01,0x89,0xc8,0x50,
+0x08,0x00,0xf0,0x19,0x18,0x89,0xc8,0x85,0x00,0x30,0x13,0x00,0x00,0xa0,0x0a,0x10,
+0x08,0x31,0x02,0xa0,0x46,0x0a,0x10,0x46,0x00,0x47,0x03,0x00,0x01,0xa0,0x09,0x30,
+0x0b,0xb9,0x99,0xb0,0x00,0x00,0x00,0x31,0x00,0x81,0x09,0x00,0x04,0x00,0x40,0x09,
+0xc9,0x9d,0x95,0x08,0x00,0xf1,0x09,0x39,0xc9,0x9d,0x97,0x00,0x32,0x05,0x00,0x05,
+0x90,0x03,0xa1,0x05,0x00,0x00,0x23,0x01,0xb7,0x77,0xa0,0x01,0xa5,0x55,0xa0,0x08,
+0x00,0xc0,0xb6,0x66,0xa0,0x29,0xb8,0x88,0xb6,0x03,0xa1,0x06,0x81,0x25,0x86,0x05,
+0xf0,0x10,0x09,0x00,0x08,0x88,0xc8,0x85,0x90,0x18,0x00,0x99,0x04,0xb0,0x09,0x90,
+0xa3,0xa0,0x9a,0xa3,0x04,0x79,0x91,0x00,0x00,0x99,0x00,0x03,0x96,0x0d,0x99,0xd9,
+0x99,0xf7,0x01,0x00,0x04,0x00,0x50,0x0d,0x99,0x99,0x99,0x08,0x63,0x04,0x01,0x04,
+0x00,0x20,0x02,0x96,0x98,0x00,0xf1,0x44,0x06,0x99,0xc8,0xb0,0x07,0x67,0xa5,0xb0,
+0x07,0x33,0x92,0xa0,0x3c,0x98,0x98,0xc7,0x07,0x10,0x00,0x90,0x07,0x10,0x08,0xa0,
+0x00,0x0a,0x00,0x09,0x00,0xa0,0x90,0xa0,0x0a,0x0a,0x08,0x99,0xd9,0xb0,0x30,0x0a,
+0x01,0x1a,0x00,0xa0,0x54,0xd9,0x9d,0x9b,0x40,0x00,0x00,0x54,0x00,0x22,0x04,0x00,
+0x00,0xb0,0x07,0x30,0x07,0x50,0x00,0xa2,0x2a,0x9a,0x99,0x87,0x00,0x0a,0x00,0x90,
+0x00,0x38,0x00,0x80,0x00,0xa1,0x02,0x70,0x0a,0x30,0x7a,0x46,0x05,0xf4,0x10,0x07,
+0x03,0x33,0x30,0x5a,0x75,0xb5,0xb0,0x02,0x80,0x90,0x90,0x09,0x71,0x90,0x90,0x6e,
+0xa0,0x90,0x90,0x59,0x43,0x60,0x90,0x09,0x09,0x10,0x90,0x09,0x45,0x28,0x01,0x04,
+0xf1,0x05,0x09,0x0c,0x8c,0x17,0x09,0x0c,0x7c,0x18,0x09,0x03,0x72,0x18,0x09,0x04,
+0x8b,0x28,0x09,0x06,0x08,0x03,0xa0,0x03,0x43,0x43,0x68,0x03,0x97,0x24,0x00,0xf2,
+0x0e,0x02,0x6a,0x80,0x09,0x34,0x80,0x35,0x96,0x8c,0x74,0x59,0x07,0xc1,0x35,0x90,
+0xa9,0x93,0x59,0x94,0x81,0x12,0x94,0x18,0x00,0x09,0x01,0x80,0x07,0xa0,0x21,0x04,
+0xf0,0x0f,0x00,0x09,0x38,0xc8,0x77,0x19,0x07,0x35,0x17,0x19,0x09,0xb8,0x17,0x19,
+0x07,0x94,0x67,0x19,0x15,0x0c,0x03,0x09,0x02,0x85,0x70,0x09,0x28,0x00,0x51,0x87,
+0x23,0x00,0xf2,0x08,0x24,0x84,0x30,0x09,0x09,0x88,0x0a,0x09,0x0a,0xc9,0x0a,0x09,
+0x09,0x29,0x0a,0x09,0x0b,0x5b,0x0a,0x09,0x0c,0x8c,0x06,0x0c,0x04,0x31,0x3a,0x04,
+0x87,0x48,0x00,0xf2,0x02,0x60,0x02,0x40,0x26,0xc7,0x6c,0x75,0x04,0x44,0x12,0x32,
+0x0a,0x5a,0x18,0x53,0x0a,0x7b,0x04,0x00,0x85,0x08,0x07,0x11,0x53,0x08,0x3a,0x03,
+0xa1,0xb5,0x04,0xf4,0x10,0xa1,0x10,0x08,0x87,0x97,0xa6,0x08,0x26,0xb6,0x49,0x08,
+0x06,0xb6,0x09,0x08,0x36,0xb6,0x49,0x08,0x0a,0x88,0x35,0x08,0x0b,0x79,0x40,0x08,
+0x07,0x03,0x42,0x96,0xbd,0x05,0x41,0x49,0x9d,0x99,0xc1,0x1c,0x01,0xc1,0x28,0x00,
+0x90,0x00,0x92,0x00,0x90,0x06,0x80,0x00,0x90,0x58,0x42,0x05,0x02,0x22,0x05,0xc0,
+0x8e,0xb1,0x90,0x00,0x09,0x09,0xd9,0xb0,0x09,0x00,0x90,0x80,0x1d,0x05,0xb1,0x4c,
+0x93,0x70,0x90,0x41,0x0a,0x10,0x90,0x00,0x75,0x29,0x20,0x01,0x01,0xab,0x05,0xf3,
+0x07,0x07,0xaa,0x6d,0x8a,0x91,0xa0,0x90,0x98,0x09,0x09,0x09,0x80,0x90,0x90,0x88,
+0x09,0x75,0x27,0xa8,0xda,0x4a,0x28,0x1a,0x05,0x00,0xb9,0x04,0xf5,0x0f,0x08,0x00,
+0x6a,0xca,0x08,0x00,0x06,0x13,0x8c,0xb0,0x63,0x18,0x08,0x70,0x17,0x81,0x17,0x80,
+0x02,0xd0,0x44,0x80,0x0a,0x55,0x90,0x80,0x62,0x04,0x55,0x90,0x28,0x00,0xf6,0x0f,
+0x89,0x08,0x00,0xbe,0xd9,0x08,0x00,0x48,0x96,0x9d,0xc1,0x88,0x99,0x26,0x80,0x88,
+0x99,0x44,0x80,0x49,0xa6,0x91,0x90,0x03,0x75,0xb0,0x90,0x89,0x7b,0x26,0xc2,0x04,
+0xf0,0x2b,0xa0,0x90,0x00,0x07,0x30,0x90,0x62,0x2f,0x10,0x92,0xa0,0x9a,0x10,0xcb,
+0x10,0x08,0x15,0xd0,0x00,0x08,0x68,0x90,0x03,0x08,0x10,0x90,0x08,0x08,0x10,0xa9,
+0xb4,0x03,0x14,0x10,0x60,0x03,0xa6,0x96,0xa0,0x09,0x34,0x93,0x91,0x09,0x78,0xb7,
+0xb1,0x07,0x78,0xb7,0x91,0x28,0x89,0xc8,0x87,0x00,0x01,0x70,0x51,0x04,0x01,0x99,
+0x06,0x40,0x06,0x99,0xc9,0x91,0x08,0x00,0x01,0x18,0x00,0xc0,0x28,0x05,0x00,0x00,
+0x90,0x05,0x60,0x09,0xb9,0x99,0xc2,0x00,0x34,0x07,0xf0,0x0d,0x12,0x46,0x30,0x3a,
+0x6a,0x34,0x20,0x2a,0x5a,0x5b,0x50,0x82,0x22,0x22,0xa0,0x19,0xa8,0x9c,0x10,0x00,
+0x94,0xb3,0x00,0x04,0x8a,0x96,0x20,0x44,0x45,0x03,0x12,0x03,0x1d,0x07,0xf1,0x1d,
+0x29,0xac,0x99,0x96,0x00,0x91,0x00,0x00,0x06,0xe8,0x88,0xc1,0x36,0x90,0x00,0x71,
+0x00,0x99,0x99,0xc1,0x00,0x90,0x00,0x71,0x0a,0x88,0x8b,0x40,0x08,0x88,0x89,0x30,
+0x57,0x77,0x77,0x71,0x04,0x81,0x11,0x10,0x04,0x88,0x8c,0x30,0x2a,0x01,0x23,0x04,
+0x88,0xe9,0x00,0xf0,0x0b,0x40,0x00,0x00,0x3a,0x93,0x00,0x18,0x91,0x19,0x81,0x64,
+0x77,0x77,0x35,0x05,0x88,0x88,0x50,0x09,0x00,0x01,0x80,0x09,0x88,0x89,0x80,0x08,
+0x00,0xf0,0x5d,0x0c,0x88,0x88,0x97,0x08,0x57,0x77,0x37,0x08,0x38,0x76,0x17,0x08,
+0x62,0x08,0x17,0x08,0x69,0x8b,0x17,0x08,0x31,0x00,0x17,0x08,0x00,0x02,0x95,0x00,
+0x17,0x00,0x00,0x1a,0x98,0xa7,0x29,0x60,0x19,0x00,0x02,0xc9,0x10,0x29,0xdc,0x88,
+0x81,0x19,0x00,0x09,0x00,0xc8,0x88,0xb0,0x09,0x00,0x09,0x00,0x63,0x00,0x08,0x8d,
+0x88,0x83,0x90,0x00,0x03,0x69,0x38,0x87,0x26,0x95,0x20,0x82,0x69,0x59,0x89,0x26,
+0x92,0x10,0x02,0x69,0x00,0x05,0xa4,0x18,0x89,0xe8,0x85,0x00,0x2b,0x87,0x10,0x29,
+0x71,0x81,0x96,0x04,0x89,0xd8,0x70,0x05,0x40,0x00,0x90,0x05,0xa8,0x88,0xb0,0x08,
+0x00,0x01,0x90,0x00,0xf1,0x04,0x49,0x85,0x00,0x3a,0x65,0x55,0xa4,0x25,0x88,0x99,
+0x21,0x00,0x00,0x38,0x00,0x09,0x88,0x88,0x90,0x04,0x00,0x00,0x05,0x02,0x71,0x80,
+0x90,0x00,0x06,0xc8,0xd8,0x81,0x27,0x02,0xf0,0x1c,0x88,0xa8,0x86,0x02,0x88,0x88,
+0x70,0x04,0x40,0x00,0x90,0x04,0xa8,0x88,0xb0,0x04,0x50,0x00,0x90,0x0b,0x89,0xd8,
+0xd0,0x94,0x8c,0x69,0x09,0x68,0xa7,0x90,0x93,0x77,0x59,0x09,0x63,0x07,0x94,0x56,
+0x97,0x69,0x80,0x00,0x06,0x35,0x04,0xf0,0x73,0x0c,0x7b,0x68,0x79,0x0c,0x6a,0x68,
+0x69,0x0b,0x66,0x36,0x69,0x08,0x49,0x78,0x09,0x08,0x43,0x08,0x09,0x08,0x49,0x75,
+0x09,0x08,0x00,0x03,0x96,0x3a,0xa4,0xb7,0xa0,0x28,0x86,0x96,0x80,0x68,0x9c,0x9d,
+0x82,0x07,0x60,0x29,0x20,0x8c,0x95,0xa9,0xd3,0x07,0x25,0x80,0x90,0x0c,0x95,0xb8,
+0x90,0x89,0x99,0x99,0xd8,0x06,0x88,0x49,0x80,0x90,0x08,0x98,0x09,0x00,0x89,0x80,
+0x68,0x84,0x98,0x98,0x88,0x8d,0x80,0x00,0x00,0x90,0x89,0xa8,0xa8,0xd8,0x4c,0x7c,
+0x79,0x80,0x80,0x80,0x98,0x5c,0x7c,0x79,0x83,0x70,0x80,0x98,0x98,0x89,0x8c,0x81,
+0x00,0x00,0x90,0x0c,0x88,0xb8,0x89,0x08,0x77,0xc7,0x49,0x08,0x00,0x80,0x09,0x08,
+0x68,0x7c,0x09,0x08,0x57,0x6a,0x09,0x0c,0x88,0x88,0x89,0x4a,0x04,0x01,0x08,0x00,
+0xf7,0x00,0x68,0xc8,0x39,0x08,0x48,0xc8,0x19,0x08,0x00,0x86,0x09,0x08,0x77,0xa8,
+0x49,0x1c,0x00,0x11,0x84,0x23,0x07,0x30,0x89,0xd9,0x90,0x08,0x00,0xf0,0x05,0x18,
+0x00,0x90,0x00,0x54,0x00,0x90,0x00,0x63,0x88,0x88,0x85,0x00,0x07,0x00,0x00,0x28,
+0x9d,0x88,0x86,0xe6,0x01,0xd0,0x04,0x90,0x08,0x00,0x3c,0x56,0x8d,0x83,0x13,0x50,
+0x09,0x00,0x03,0x04,0x00,0x32,0x68,0x8d,0x86,0x02,0x03,0xf1,0x0f,0x91,0x00,0x09,
+0x01,0xd8,0x85,0x5d,0x8a,0x31,0x18,0x09,0x03,0x91,0x08,0x09,0x00,0x06,0x28,0x0a,
+0xa1,0x49,0x47,0x66,0x06,0x50,0x35,0x00,0x00,0x08,0xa2,0x02,0x0b,0x00,0x04,0x00,
+0xf2,0x05,0x0a,0x8c,0x89,0x4d,0x8a,0x8c,0x89,0x08,0x0a,0x4b,0x49,0x08,0x32,0x4b,
+0x32,0x4d,0x87,0x9d,0x86,0x42,0x83,0x03,0x10,0x98,0xbe,0x07,0xf2,0x10,0x02,0x8c,
+0x5a,0x88,0x80,0x48,0xc7,0x91,0x85,0x00,0x74,0x4a,0x87,0x60,0x39,0xc6,0x99,0x35,
+0x04,0x8c,0x79,0x4c,0x00,0x00,0x80,0x95,0xd3,0x00,0x08,0x0a,0x90,0xfe,0x02,0xf0,
+0x09,0x04,0x00,0x63,0x00,0x03,0x58,0x46,0x71,0x18,0x55,0x98,0x45,0x01,0x48,0xa9,
+0x81,0x08,0x37,0x53,0x91,0x09,0xb9,0xe8,0x83,0xd7,0x02,0x41,0x27,0x78,0xb7,0x76,
+0xd7,0x04,0xf0,0x10,0x00,0x90,0x90,0x07,0x09,0xaa,0xa7,0x4c,0x9a,0x6b,0x68,0x07,
 0x0a,0x5b,0x58,0x07,0x24,0x88,0x82,0x3c,0x88,0x54,0x84,0x21,0x07,0x43,0x74,0x00,
 0x07,0x87,0xa4,0x2c,0x00,0xf1,0x06,0x18,0x88,0xc8,0x85,0x05,0x88,0xa8,0x82,0x05,
 0x88,0x87,0x81,0x08,0x01,0x70,0x71,0x0a,0x88,0x98,0xb1,0x19,0xe4,0x05,0x00,0x3c,
 0x04,0xf1,0x0f,0x50,0x00,0x18,0x8c,0x9b,0x85,0x05,0x49,0x27,0x80,0x07,0x09,0x26,
 0x24,0x00,0x4d,0x77,0x30,0x09,0x88,0x29,0x00,0x01,0x5a,0xc7,0x30,0x27,0x30,0x03,
-0x66,0xf0,0x04,0xf1,0x0f,0x70,0x09,0x00,0x06,0xb9,0x29,0x00,0x09,0x08,0x1b,0x00,
+0x66,0xf0,0x04,0xf0,0x10,0x70,0x09,0x00,0x06,0xb9,0x29,0x00,0x09,0x08,0x1b,0x00,
 0x48,0x1b,0x0c,0x90,0x11,0xa8,0x09,0x38,0x00,0xa2,0x09,0x00,0x06,0x70,0x09,0x00,
-0x47,0x00,0x09,0x1f,0x0f,0xf1,0x0c,0x01,0x88,0x8d,0x10,0x07,0x55,0x95,0x00,0x02,
-0x7a,0x84,0x00,0x28,0x37,0x98,0xd4,0x02,0x94,0x56,0x80,0x00,0x05,0xc5,0x00,0x29,
-0x84,0x00,0x83,0x03,0x00,0x4a,0x03,0xf0,0x09,0x29,0x9a,0xc9,0x97,0x00,0x07,0xc0,
-0x00,0x00,0x0a,0x37,0x00,0x00,0x84,0x0a,0x20,0x19,0x60,0x00,0x95,0x02,0x00,0x00,
-0x02,0x32,0x01,0x80,0x08,0x8c,0x99,0x40,0x09,0x09,0x01,0x80,0x04,0x00,0xf1,0x11,
-0x79,0x9e,0xc9,0x93,0x00,0x66,0x91,0x00,0x18,0x80,0x1a,0x60,0x52,0x00,0x00,0x43,
-0x06,0x28,0x00,0x00,0x0c,0x8c,0x88,0x50,0x47,0x19,0x11,0x00,0x40,0x09,0x00,0x00,
-0x20,0x00,0x80,0x47,0x90,0x00,0x06,0x90,0x1a,0x40,0x64,0xf8,0x0d,0xf0,0x11,0x80,
-0x12,0x50,0x16,0x89,0x86,0x71,0x02,0x99,0x89,0xc6,0x28,0x91,0x70,0x90,0x00,0x51,
-0x64,0x40,0x28,0x8b,0xc8,0x86,0x01,0x69,0x29,0x30,0x27,0x30,0x01,0x56,0x00,0xbe,
-0x20,0x12,0x9d,0xbf,0x03,0xd1,0x03,0x83,0x89,0xd1,0x3d,0x50,0x09,0x10,0x14,0x68,
-0x8d,0x87,0x03,0xdd,0x01,0x03,0xa7,0x03,0xf1,0x0f,0x05,0x10,0x00,0x69,0x9a,0xa9,
-0xa1,0x73,0x55,0x55,0x71,0x00,0x22,0x22,0x00,0x69,0xba,0xb9,0x92,0x00,0x81,0x71,
-0x00,0x00,0x90,0x71,0x14,0x59,0x20,0x59,0xa6,0x0c,0x00,0x48,0x00,0xf4,0x0d,0x69,
-0x9b,0x99,0xb0,0x70,0x00,0x00,0x80,0x04,0x8d,0x88,0x00,0x08,0x19,0x88,0x30,0x0b,
-0x29,0x00,0x00,0x28,0x9a,0x00,0x00,0x91,0x2b,0x99,0x92,0xef,0x03,0xf0,0x0d,0x2b,
-0x89,0x98,0xa5,0x18,0x79,0xa7,0x83,0x01,0x46,0x84,0x20,0x01,0x37,0x73,0x20,0x28,
-0x8d,0xd8,0x85,0x02,0x93,0x2a,0x40,0x16,0x00,0x00,0x55,0x44,0x00,0xf3,0x2d,0x88,
-0x88,0x88,0xb1,0x43,0x82,0x48,0x40,0x38,0x2b,0x82,0x70,0x05,0x90,0x39,0x20,0x9c,
-0x98,0x8d,0x92,0x06,0x10,0x09,0x00,0x06,0x98,0x8c,0x00,0x03,0x50,0x00,0x90,0x37,
-0xb6,0x00,0x90,0x13,0x48,0x99,0xd6,0x08,0x53,0x20,0x90,0x06,0xc0,0x91,0x90,0x01,
-0xe1,0x34,0x90,0x09,0x38,0x00,0x90,0x54,0x00,0x09,0x90,0xab,0x05,0x00,0x04,0x00,
-0x00,0x24,0x0a,0xf1,0x05,0x80,0x07,0x20,0x90,0x91,0x0b,0x00,0x90,0x28,0x45,0x00,
-0x90,0x0b,0x00,0x00,0x90,0x01,0x00,0x4a,0x60,0x7e,0x04,0x40,0x05,0x19,0x04,0x20,
-0x57,0x09,0xf2,0x00,0x72,0x09,0x00,0x53,0x00,0x08,0x07,0x20,0x00,0x01,0x86,0x00,
-0x47,0x98,0x10,0x64,0x16,0x12,0x22,0x58,0x0f,0x60,0x58,0xd8,0x88,0x81,0x00,0x90,
-0x62,0x0d,0x02,0x0d,0x03,0xf1,0x15,0x75,0x00,0x90,0x00,0x53,0x99,0xd9,0x93,0x00,
-0x50,0x04,0x20,0x07,0xba,0x9c,0x83,0x03,0x59,0x85,0x50,0x01,0x3b,0x33,0x30,0x28,
-0xbb,0x88,0x86,0x02,0xa7,0x99,0x70,0x28,0x87,0xaa,0x75,0x10,0x02,0xf0,0x0d,0x50,
-0x91,0x70,0x09,0xb9,0xca,0xa4,0x07,0x67,0x77,0x37,0x01,0x91,0x16,0x41,0x00,0x45,
-0xb5,0x10,0x08,0x98,0xd8,0xd0,0x08,0x00,0x94,0xb0,0x00,0x42,0x0a,0xc0,0x9a,0xc9,
-0x93,0x02,0x61,0x71,0x90,0x00,0x71,0x75,0x10,0x39,0xf4,0x01,0x05,0x8b,0x05,0x11,
-0x70,0x70,0x02,0xf3,0x2d,0x0b,0x8a,0x9a,0x83,0x0a,0x7c,0x7c,0x72,0x09,0x09,0x1a,
-0x00,0x08,0x06,0x66,0x00,0x27,0x9c,0x7b,0x50,0x63,0x08,0xb8,0x00,0x52,0x74,0x14,
-0x82,0x00,0x00,0x70,0x00,0x0b,0x88,0xa9,0x86,0x09,0x01,0x30,0x20,0x09,0x65,0x92,
-0x90,0x09,0x75,0xa7,0x34,0x17,0x78,0xc8,0x81,0x44,0x00,0x90,0x00,0x83,0x88,0xc8,
-0x85,0xf1,0x06,0xf2,0x0e,0x51,0x5b,0x56,0x8c,0x30,0x09,0x04,0x09,0x10,0x29,0xa8,
-0x0b,0x73,0x23,0x98,0x09,0x00,0x0c,0x48,0x8c,0x84,0x0c,0x80,0x00,0x00,0x74,0x3a,
-0x99,0x84,0x24,0x00,0xd1,0x46,0x90,0x00,0x00,0x36,0x43,0x29,0x99,0xac,0x97,0x09,
-0x99,0x58,0x08,0x0b,0xf1,0x18,0x00,0x90,0x0a,0x01,0x00,0xa8,0x76,0x38,0x19,0x51,
-0x00,0xa8,0x18,0x8a,0x38,0x89,0x09,0x67,0x28,0x66,0x0c,0x86,0x4a,0x85,0x08,0x19,
-0x17,0x09,0x01,0x99,0x03,0x89,0x3a,0x79,0x4a,0x68,0x01,0x95,0x04,0x40,0x00,0xf4,
-0x0d,0x58,0x99,0x88,0x81,0x48,0x89,0x66,0x60,0x80,0x09,0x55,0x40,0x78,0x8c,0xaa,
-0x82,0x00,0x88,0x0a,0x90,0x01,0x79,0x06,0x70,0x3a,0x3b,0x81,0x53,0x45,0x0f,0xf1,
-0x0d,0x48,0xc0,0x90,0x40,0x15,0xa7,0x78,0x91,0x64,0x25,0x7c,0x80,0x79,0xa8,0x09,
-0x80,0x00,0x85,0x7c,0x90,0x00,0x90,0x09,0x90,0x08,0x89,0x9a,0xa4,0xc0,0x03,0xe0,
-0x08,0x10,0x60,0xb0,0x81,0x54,0x03,0x28,0x16,0x01,0x99,0xa9,0x99,0x00,0x72,0x0e,
-0x53,0x99,0x9a,0x28,0x88,0x88,0x5e,0x10,0xf5,0x0d,0x11,0x2b,0xac,0x72,0x91,0x05,
-0x28,0x16,0x02,0x3b,0xac,0x80,0x93,0x07,0x18,0x09,0x20,0x08,0x08,0x00,0x28,0x0a,
-0x08,0x03,0xa0,0x44,0x08,0x48,0xfe,0x06,0xf5,0x8d,0x0d,0xcc,0xa2,0x81,0x09,0x86,
-0x75,0x02,0x27,0x98,0x71,0x92,0x09,0x66,0x78,0x10,0x07,0x97,0x50,0x28,0x09,0x76,
-0x42,0xa0,0x24,0xa0,0x69,0x00,0x05,0x40,0x35,0x00,0x48,0x08,0xab,0x81,0x23,0x61,
-0x56,0x11,0x2e,0x37,0x78,0xb4,0x7a,0x38,0x89,0xc4,0x09,0x06,0x01,0x70,0x09,0x02,
-0x71,0x70,0x09,0x00,0x29,0x50,0x03,0x20,0x50,0x00,0x27,0x06,0x44,0x40,0x23,0x78,
-0xc4,0x50,0x2d,0x3c,0xa7,0xa4,0x49,0x05,0xb7,0x61,0x08,0x58,0x85,0x40,0x08,0x01,
-0xbc,0x10,0x08,0x59,0x21,0x86,0x03,0x24,0x20,0x00,0x37,0x0c,0x87,0x74,0x24,0xab,
-0x66,0xa0,0x3e,0x08,0x66,0xb0,0x59,0x04,0xc6,0x60,0x08,0x09,0xb7,0xa0,0x08,0x22,
-0x9c,0x10,0x08,0x49,0x54,0x95,0x08,0x07,0x05,0x20,0x64,0x67,0x68,0x10,0x18,0x8a,
-0x9a,0x97,0x4b,0x58,0x8e,0x63,0x58,0x37,0x55,0xb0,0x08,0x62,0x83,0xa0,0x08,0x80,
-0xba,0xa0,0x08,0x70,0x45,0x16,0xa5,0x00,0xf1,0x0b,0x49,0x02,0x40,0x00,0x22,0x5a,
-0x10,0x06,0x90,0x67,0x20,0x45,0x94,0x80,0xa0,0x80,0xa8,0x00,0x73,0x19,0xd0,0x08,
-0x00,0x51,0x69,0x99,0xf0,0x01,0xf1,0x0e,0x09,0x88,0xc8,0x85,0x09,0x03,0x50,0x00,
-0x09,0x00,0x79,0x00,0x09,0x18,0x01,0x30,0x18,0x99,0x00,0x63,0x46,0x79,0x00,0x78,
-0x82,0x16,0x89,0x42,0x00,0xc1,0x23,0xf0,0x2f,0x10,0x00,0x05,0x86,0xa6,0x00,0x3a,
-0x77,0x98,0x70,0x03,0x77,0x77,0x90,0x05,0x77,0x77,0x90,0x00,0x06,0x10,0x20,0x17,
-0x81,0x92,0x82,0x52,0x98,0x8a,0x15,0x08,0x13,0x77,0x31,0x09,0x45,0x88,0x52,0x78,
-0x76,0x99,0x61,0x78,0x47,0x77,0x74,0x18,0x0c,0x77,0xc0,0x08,0x0b,0x66,0xb0,0x08,
-0x0c,0x66,0xc0,0x08,0x08,0x04,0xa0,0x51,0x05,0xf1,0x2d,0x15,0xb4,0xa7,0x79,0x05,
-0xc1,0xa7,0x79,0x18,0xa7,0xa6,0x69,0x20,0x50,0x97,0x78,0x01,0x04,0x60,0x42,0x09,
-0x80,0x72,0x29,0x33,0x68,0x8a,0x24,0x00,0x01,0x40,0x00,0x06,0xb8,0x7c,0x81,0x17,
-0x88,0x79,0x74,0x03,0x96,0x66,0x90,0x03,0x96,0x66,0xa0,0x01,0x6a,0x86,0x40,0x07,
-0x53,0x91,0x81,0x16,0x49,0x79,0x15,0xff,0x03,0xf0,0x0e,0x53,0x63,0x70,0x3d,0x7c,
+0x47,0x00,0x09,0x00,0x39,0x01,0xf1,0x0c,0x01,0x88,0x8d,0x10,0x07,0x55,0x95,0x00,
+0x02,0x7a,0x84,0x00,0x28,0x37,0x98,0xd4,0x02,0x94,0x56,0x80,0x00,0x05,0xc5,0x00,
+0x29,0x84,0x00,0x83,0x03,0x00,0x4a,0x03,0xf0,0x09,0x29,0x9a,0xc9,0x97,0x00,0x07,
+0xc0,0x00,0x00,0x0a,0x37,0x00,0x00,0x84,0x0a,0x20,0x19,0x60,0x00,0x95,0x02,0x00,
+0x00,0x02,0x32,0x01,0x80,0x08,0x8c,0x99,0x40,0x09,0x09,0x01,0x80,0x04,0x00,0xf1,
+0x11,0x79,0x9e,0xc9,0x93,0x00,0x66,0x91,0x00,0x18,0x80,0x1a,0x60,0x52,0x00,0x00,
+0x43,0x06,0x28,0x00,0x00,0x0c,0x8c,0x88,0x50,0x47,0x19,0x11,0x00,0x40,0x09,0x00,
+0x00,0x20,0x00,0xf2,0x22,0x47,0x90,0x00,0x06,0x90,0x1a,0x40,0x64,0x00,0x00,0x63,
+0x00,0x80,0x12,0x50,0x16,0x89,0x86,0x71,0x02,0x99,0x89,0xc6,0x28,0x91,0x70,0x90,
+0x00,0x51,0x64,0x40,0x28,0x8b,0xc8,0x86,0x01,0x69,0x29,0x30,0x27,0x30,0x01,0x56,
+0x00,0x06,0x00,0x00,0x29,0x9d,0xbf,0x03,0xd1,0x03,0x83,0x89,0xd1,0x3d,0x50,0x09,
+0x10,0x14,0x68,0x8d,0x87,0x03,0xdd,0x01,0x03,0xa7,0x03,0xf1,0x0f,0x05,0x10,0x00,
+0x69,0x9a,0xa9,0xa1,0x73,0x55,0x55,0x71,0x00,0x22,0x22,0x00,0x69,0xba,0xb9,0x92,
+0x00,0x81,0x71,0x00,0x00,0x90,0x71,0x14,0x59,0x20,0x59,0xa6,0x0c,0x00,0x48,0x00,
+0xf4,0x0d,0x69,0x9b,0x99,0xb0,0x70,0x00,0x00,0x80,0x04,0x8d,0x88,0x00,0x08,0x19,
+0x88,0x30,0x0b,0x29,0x00,0x00,0x28,0x9a,0x00,0x00,0x91,0x2b,0x99,0x92,0xef,0x03,
+0xf0,0x0d,0x2b,0x89,0x98,0xa5,0x18,0x79,0xa7,0x83,0x01,0x46,0x84,0x20,0x01,0x37,
+0x73,0x20,0x28,0x8d,0xd8,0x85,0x02,0x93,0x2a,0x40,0x16,0x00,0x00,0x55,0x44,0x00,
+0xf3,0x2d,0x88,0x88,0x88,0xb1,0x43,0x82,0x48,0x40,0x38,0x2b,0x82,0x70,0x05,0x90,
+0x39,0x20,0x9c,0x98,0x8d,0x92,0x06,0x10,0x09,0x00,0x06,0x98,0x8c,0x00,0x03,0x50,
+0x00,0x90,0x37,0xb6,0x00,0x90,0x13,0x48,0x99,0xd6,0x08,0x53,0x20,0x90,0x06,0xc0,
+0x91,0x90,0x01,0xe1,0x34,0x90,0x09,0x38,0x00,0x90,0x54,0x00,0x09,0x90,0xab,0x05,
+0x00,0x04,0x00,0x00,0x24,0x0a,0xf1,0x05,0x80,0x07,0x20,0x90,0x91,0x0b,0x00,0x90,
+0x28,0x45,0x00,0x90,0x0b,0x00,0x00,0x90,0x01,0x00,0x4a,0x60,0x7e,0x04,0x40,0x05,
+0x19,0x04,0x20,0x57,0x09,0xf0,0x02,0x72,0x09,0x00,0x53,0x00,0x08,0x07,0x20,0x00,
+0x01,0x86,0x00,0x47,0x98,0x10,0x00,0x21,0x3f,0x00,0xd0,0x22,0x00,0x00,0x00,0x73,
+0x00,0x00,0x58,0xd8,0x88,0x81,0x00,0x90,0x62,0x0d,0x02,0x0d,0x03,0xf1,0x15,0x75,
+0x00,0x90,0x00,0x53,0x99,0xd9,0x93,0x00,0x50,0x04,0x20,0x07,0xba,0x9c,0x83,0x03,
+0x59,0x85,0x50,0x01,0x3b,0x33,0x30,0x28,0xbb,0x88,0x86,0x02,0xa7,0x99,0x70,0x28,
+0x87,0xaa,0x75,0x10,0x02,0xf0,0x0d,0x50,0x91,0x70,0x09,0xb9,0xca,0xa4,0x07,0x67,
+0x77,0x37,0x01,0x91,0x16,0x41,0x00,0x45,0xb5,0x10,0x08,0x98,0xd8,0xd0,0x08,0x00,
+0x94,0xb0,0x00,0x42,0x0a,0xc0,0x9a,0xc9,0x93,0x02,0x61,0x71,0x90,0x00,0x71,0x75,
+0x10,0x39,0xf4,0x01,0x05,0x8b,0x05,0x11,0x70,0x70,0x02,0xf3,0x2d,0x0b,0x8a,0x9a,
+0x83,0x0a,0x7c,0x7c,0x72,0x09,0x09,0x1a,0x00,0x08,0x06,0x66,0x00,0x27,0x9c,0x7b,
+0x50,0x63,0x08,0xb8,0x00,0x52,0x74,0x14,0x82,0x00,0x00,0x70,0x00,0x0b,0x88,0xa9,
+0x86,0x09,0x01,0x30,0x20,0x09,0x65,0x92,0x90,0x09,0x75,0xa7,0x34,0x17,0x78,0xc8,
+0x81,0x44,0x00,0x90,0x00,0x83,0x88,0xc8,0x85,0xf1,0x06,0xf2,0x0e,0x51,0x5b,0x56,
+0x8c,0x30,0x09,0x04,0x09,0x10,0x29,0xa8,0x0b,0x73,0x23,0x98,0x09,0x00,0x0c,0x48,
+0x8c,0x84,0x0c,0x80,0x00,0x00,0x74,0x3a,0x99,0x84,0x24,0x00,0xd1,0x46,0x90,0x00,
+0x00,0x36,0x43,0x29,0x99,0xac,0x97,0x09,0x99,0x58,0x08,0x0b,0xf1,0x18,0x00,0x90,
+0x0a,0x01,0x00,0xa8,0x76,0x38,0x19,0x51,0x00,0xa8,0x18,0x8a,0x38,0x89,0x09,0x67,
+0x28,0x66,0x0c,0x86,0x4a,0x85,0x08,0x19,0x17,0x09,0x01,0x99,0x03,0x89,0x3a,0x79,
+0x4a,0x68,0x01,0x95,0x04,0x40,0x00,0xf2,0x0d,0x58,0x99,0x88,0x81,0x48,0x89,0x66,
+0x60,0x80,0x09,0x55,0x40,0x78,0x8c,0xaa,0x82,0x00,0x88,0x0a,0x90,0x01,0x79,0x06,
+0x70,0x3a,0x3b,0x81,0x53,0x60,0x00,0xf1,0x0f,0x20,0x00,0x48,0xc0,0x90,0x40,0x15,
+0xa7,0x78,0x91,0x64,0x25,0x7c,0x80,0x79,0xa8,0x09,0x80,0x00,0x85,0x7c,0x90,0x00,
+0x90,0x09,0x90,0x08,0x89,0x9a,0xa4,0xc0,0x03,0xe0,0x08,0x10,0x60,0xb0,0x81,0x54,
+0x03,0x28,0x16,0x01,0x99,0xa9,0x99,0x00,0x72,0x0e,0x62,0x99,0x9a,0x28,0x88,0x88,
+0xa0,0x7a,0x0d,0xf5,0x0d,0x11,0x2b,0xac,0x72,0x91,0x05,0x28,0x16,0x02,0x3b,0xac,
+0x80,0x93,0x07,0x18,0x09,0x20,0x08,0x08,0x00,0x28,0x0a,0x08,0x03,0xa0,0x44,0x08,
+0x48,0xfe,0x06,0xf0,0x2d,0x0d,0xcc,0xa2,0x81,0x09,0x86,0x75,0x02,0x27,0x98,0x71,
+0x92,0x09,0x66,0x78,0x10,0x07,0x97,0x50,0x28,0x09,0x76,0x42,0xa0,0x24,0xa0,0x69,
+0x00,0x05,0x40,0x35,0x00,0x48,0x08,0xab,0x81,0x23,0x61,0x56,0x11,0x2e,0x37,0x78,
+0xb4,0x7a,0x38,0x89,0xc4,0x09,0x06,0x01,0x70,0x09,0x02,0x71,0x70,0x09,0x00,0x29,
+0x50,0xf4,0x52,0x03,0x20,0x50,0x00,0x27,0x06,0x44,0x40,0x23,0x78,0xc4,0x50,0x2d,
+0x3c,0xa7,0xa4,0x49,0x05,0xb7,0x61,0x08,0x58,0x85,0x40,0x08,0x01,0xbc,0x10,0x08,
+0x59,0x21,0x86,0x03,0x24,0x20,0x00,0x37,0x0c,0x87,0x74,0x24,0xab,0x66,0xa0,0x3e,
+0x08,0x66,0xb0,0x59,0x04,0xc6,0x60,0x08,0x09,0xb7,0xa0,0x08,0x22,0x9c,0x10,0x08,
+0x49,0x54,0x95,0x08,0x07,0x05,0x20,0x64,0x67,0x68,0x10,0x18,0x8a,0x9a,0x97,0x4b,
+0x58,0x8e,0x63,0x58,0x37,0x55,0xb0,0x08,0x62,0x83,0xa0,0x08,0x80,0xba,0xa0,0x08,
+0x70,0x45,0x16,0x00,0x01,0x00,0xf1,0x2c,0x49,0x02,0x40,0x00,0x22,0x5a,0x10,0x06,
+0x90,0x67,0x20,0x45,0x94,0x80,0xa0,0x80,0xa8,0x00,0x73,0x19,0xd0,0x08,0x00,0x51,
+0x69,0x99,0x00,0x00,0x01,0x50,0x00,0x09,0x88,0xc8,0x85,0x09,0x03,0x50,0x00,0x09,
+0x00,0x79,0x00,0x09,0x18,0x01,0x30,0x18,0x99,0x00,0x63,0x46,0x79,0x00,0x78,0x82,
+0x16,0x89,0x42,0x40,0x00,0xf0,0x70,0x72,0x10,0x00,0x05,0x86,0xa6,0x00,0x3a,0x77,
+0x98,0x70,0x03,0x77,0x77,0x90,0x05,0x77,0x77,0x90,0x00,0x06,0x10,0x20,0x17,0x81,
+0x92,0x82,0x52,0x98,0x8a,0x15,0x08,0x13,0x77,0x31,0x09,0x45,0x88,0x52,0x78,0x76,
+0x99,0x61,0x78,0x47,0x77,0x74,0x18,0x0c,0x77,0xc0,0x08,0x0b,0x66,0xb0,0x08,0x0c,
+0x66,0xc0,0x08,0x08,0x04,0xa0,0x00,0x80,0x00,0x00,0x15,0xb4,0xa7,0x79,0x05,0xc1,
+0xa7,0x79,0x18,0xa7,0xa6,0x69,0x20,0x50,0x97,0x78,0x01,0x04,0x60,0x42,0x09,0x80,
+0x72,0x29,0x33,0x68,0x8a,0x24,0x00,0x01,0x40,0x00,0x06,0xb8,0x7c,0x81,0x17,0x88,
+0x79,0x74,0x03,0x96,0x66,0x90,0x03,0x96,0x66,0xa0,0x01,0x6a,0x86,0x40,0x07,0x53,
+0x91,0x81,0x16,0x49,0x79,0x15,0x83,0x00,0xf0,0x0f,0x05,0x53,0x63,0x70,0x3d,0x7c,
 0x88,0x22,0x08,0x68,0x38,0x83,0x0b,0x5a,0x66,0x71,0x0b,0x5a,0x64,0x04,0x04,0x26,
-0x47,0x81,0x17,0x60,0x81,0x73,0x51,0x87,0x24,0x00,0xf1,0x0f,0x94,0x60,0x08,0x88,
+0x47,0x81,0x17,0x60,0x81,0x73,0x51,0x87,0x24,0x00,0xf0,0x0f,0x94,0x60,0x08,0x88,
 0xd8,0xc5,0x09,0x00,0x81,0x10,0x0c,0x87,0x63,0xa0,0x09,0x09,0x3a,0x50,0x08,0x09,
-0x1d,0x02,0x46,0x83,0xab,0x08,0x80,0x08,0x22,0xb5,0x18,0x03,0xb0,0x34,0x68,0x70,
-0x04,0x44,0x90,0x00,0x07,0x89,0xc8,0x83,0x04,0x0a,0x41,0x39,0x99,0xc9,0x97,0xa7,
-0x0e,0x00,0x04,0x00,0x35,0x69,0x60,0x00,0x1d,0x06,0xf0,0x02,0x08,0x88,0xd0,0x5c,
-0x79,0x00,0x90,0x08,0x09,0x99,0xc0,0x7d,0x99,0x08,0x00,0x19,0x08,0x53,0x32,0x65,
-0x03,0x80,0x4a,0x61,0x00,0x83,0x24,0x00,0xf0,0x09,0x1a,0x8c,0x89,0x3b,0x6a,0x8c,
-0x89,0x08,0x19,0x08,0x09,0x4d,0x7a,0x8c,0x89,0x08,0x04,0x08,0x04,0x08,0x00,0x08,
-0x00,0x2a,0x1e,0x00,0x00,0xf8,0x05,0xf0,0x08,0x10,0x00,0x00,0x08,0x19,0x99,0x93,
-0x3a,0x6a,0x88,0x80,0x07,0x5a,0x00,0x80,0x6c,0x5a,0x88,0xc0,0x07,0x19,0x00,0x00,
-0x04,0x00,0xf2,0x35,0x3a,0x05,0x88,0x84,0x07,0x00,0x15,0x00,0x07,0x06,0x8c,0x84,
-0x4c,0x89,0x24,0x21,0x07,0x18,0x09,0x00,0x2b,0x98,0x26,0x30,0x29,0x18,0x72,0x80,
-0x07,0x45,0x91,0x84,0x2a,0x61,0xa7,0x57,0x07,0x10,0x08,0x00,0x07,0x16,0xad,0xa4,
-0x4c,0x80,0x09,0x00,0x07,0x27,0x77,0xc6,0x4c,0x77,0x88,0xc6,0x07,0x11,0x50,0x80,
-0x07,0x10,0x90,0x80,0x2a,0x00,0x07,0x80,0x5e,0x11,0xf5,0x0c,0x24,0x83,0x06,0x26,
-0x6b,0x31,0x3b,0x87,0x7c,0x75,0x06,0x39,0x7c,0x78,0x5c,0x8a,0x7c,0x78,0x06,0x2a,
-0x7c,0x78,0x06,0x23,0x08,0x03,0x2b,0x88,0x00,0xf1,0x0f,0x17,0x00,0x07,0x17,0xba,
-0xb6,0x3c,0x80,0x81,0x80,0x07,0x17,0x99,0x86,0x4c,0x88,0xc8,0x97,0x07,0x13,0x70,
-0x90,0x07,0x11,0x9d,0x50,0x1a,0x18,0x83,0x85,0xd0,0x00,0xf0,0x0e,0x01,0x77,0x00,
-0x08,0x07,0x56,0x20,0x4c,0x8e,0x8c,0x73,0x08,0x6a,0x9c,0x82,0x4d,0x87,0x18,0x00,
-0x18,0x07,0x9c,0x82,0x08,0x07,0x9c,0x85,0x3a,0x07,0x0f,0x31,0xf6,0x2e,0x02,0x50,
-0x3a,0x48,0x9b,0x61,0x4b,0x46,0x53,0x50,0x09,0x66,0x96,0x80,0x7c,0x68,0x97,0x80,
-0x08,0x48,0x97,0x80,0x08,0x42,0x70,0x80,0x57,0x45,0x72,0x90,0x08,0x02,0x93,0x00,
-0x19,0x09,0x4a,0x00,0x6b,0x6c,0x89,0x90,0x08,0x07,0x66,0x80,0x8c,0x19,0x44,0x90,
-0x08,0x49,0xca,0x93,0x08,0x01,0x88,0x00,0x56,0x58,0x01,0x34,0x01,0xf0,0x0c,0x02,
-0xa7,0x90,0x3b,0x37,0xb8,0xa3,0x08,0x07,0x68,0x07,0x2c,0x6b,0xb8,0x97,0x09,0x17,
-0xbf,0x85,0x08,0x05,0x8a,0x90,0x29,0x65,0x08,0x26,0x67,0x06,0xf0,0x31,0x0c,0x7a,
-0x46,0x00,0x0b,0x6a,0xa9,0xc9,0x0b,0x7d,0xa5,0xa0,0x08,0x09,0x09,0xa0,0x0a,0x87,
-0x0a,0x50,0x19,0x19,0x66,0x93,0x31,0x02,0x40,0x05,0x33,0x75,0x34,0x00,0x27,0x95,
-0x73,0x00,0x5d,0xe9,0xc9,0xd3,0x64,0x44,0xb4,0x90,0x4b,0x86,0x0b,0x50,0x1a,0x53,
-0x0c,0x20,0x19,0xb3,0x84,0x81,0x41,0x03,0x20,0x13,0x00,0x02,0x20,0x00,0x95,0x14,
-0xf0,0x29,0x28,0xc8,0x8a,0xb6,0x00,0x91,0x09,0x10,0x00,0x19,0x38,0x00,0x00,0x07,
-0xe0,0x00,0x01,0x88,0x4b,0x40,0x38,0x20,0x00,0x67,0x01,0x50,0x02,0x61,0x39,0x9a,
-0x95,0x10,0x08,0x45,0x90,0x00,0x47,0xc7,0xa8,0xc5,0x48,0xc8,0x90,0x90,0x15,0x95,
-0x80,0x90,0x71,0x87,0x80,0x90,0x04,0x72,0x50,0x90,0xf7,0x0d,0x00,0x88,0x07,0x00,
-0xf6,0x13,0x60,0x00,0x5c,0x99,0x60,0x00,0x72,0x92,0x10,0x91,0x01,0x80,0x03,0x80,
-0x03,0x60,0x2a,0x00,0x8a,0x01,0x18,0xf1,0x0d,0x0c,0x89,0x79,0xb6,0x0b,0x69,0x83,
-0x60,0x0c,0x89,0xba,0xa7,0x08,0x10,0x09,0x60,0x08,0x35,0x0a,0x70,0x0c,0xb9,0x74,
-0x75,0x17,0x03,0x90,0xa9,0xcc,0x1e,0x52,0x99,0x99,0x90,0x00,0x09,0x06,0x00,0x05,
-0x09,0x00,0xf2,0x0b,0x88,0xb0,0xd8,0xd8,0x08,0x0b,0x4b,0x88,0xb0,0xa4,0xb8,0x08,
-0x1b,0x6c,0x88,0x73,0x51,0x94,0x00,0x80,0x09,0x00,0x44,0x05,0xa0,0x00,0xb0,0x08,
-0xf0,0x09,0x88,0xa6,0x8c,0x82,0x80,0x93,0x3a,0x32,0x88,0xb5,0x55,0xb3,0x80,0x98,
-0x88,0xc4,0x88,0xa5,0x50,0x90,0x70,0x00,0x90,0x90,0x39,0x0e,0xf0,0x0d,0x0c,0xcc,
+0x1d,0x02,0x46,0x83,0xab,0x08,0x80,0x08,0x22,0xb5,0x44,0x00,0xf0,0x05,0x02,0x34,
+0x68,0x70,0x04,0x44,0x90,0x00,0x07,0x89,0xc8,0x83,0x00,0x00,0x80,0x00,0x39,0x99,
+0xc9,0x97,0x08,0x00,0x01,0x04,0x00,0x21,0x69,0x60,0xeb,0x00,0x10,0x08,0x04,0x00,
+0xf5,0x0c,0x08,0x88,0xd0,0x5c,0x79,0x00,0x90,0x08,0x09,0x99,0xc0,0x7d,0x99,0x08,
+0x00,0x19,0x08,0x08,0x00,0x08,0x07,0x03,0x80,0x4a,0x61,0x00,0x83,0x24,0x00,0xf1,
+0x0b,0x1a,0x8c,0x89,0x3b,0x6a,0x8c,0x89,0x08,0x19,0x08,0x09,0x4d,0x7a,0x8c,0x89,
+0x08,0x04,0x08,0x04,0x08,0x00,0x08,0x00,0x2a,0x00,0x08,0x48,0x00,0xf0,0x09,0x07,
+0x10,0x00,0x00,0x08,0x19,0x99,0x93,0x3a,0x6a,0x88,0x80,0x07,0x5a,0x00,0x80,0x6c,
+0x5a,0x88,0xc0,0x07,0x19,0x00,0x00,0x04,0x00,0xf0,0x35,0x3a,0x05,0x88,0x84,0x07,
+0x00,0x15,0x00,0x07,0x06,0x8c,0x84,0x4c,0x89,0x24,0x21,0x07,0x18,0x09,0x00,0x2b,
+0x98,0x26,0x30,0x29,0x18,0x72,0x80,0x07,0x45,0x91,0x84,0x2a,0x61,0xa7,0x57,0x07,
+0x10,0x08,0x00,0x07,0x16,0xad,0xa4,0x4c,0x80,0x09,0x00,0x07,0x27,0x77,0xc6,0x4c,
+0x77,0x88,0xc6,0x07,0x11,0x50,0x80,0x07,0x10,0x90,0x80,0x2a,0x00,0x07,0x80,0x64,
+0x00,0xf5,0x0e,0x06,0x20,0x24,0x83,0x06,0x26,0x6b,0x31,0x3b,0x87,0x7c,0x75,0x06,
+0x39,0x7c,0x78,0x5c,0x8a,0x7c,0x78,0x06,0x2a,0x7c,0x78,0x06,0x23,0x08,0x03,0x2b,
+0x88,0x00,0xf1,0x0f,0x17,0x00,0x07,0x17,0xba,0xb6,0x3c,0x80,0x81,0x80,0x07,0x17,
+0x99,0x86,0x4c,0x88,0xc8,0x97,0x07,0x13,0x70,0x90,0x07,0x11,0x9d,0x50,0x1a,0x18,
+0x83,0x85,0xd0,0x00,0xf6,0x4f,0x01,0x77,0x00,0x08,0x07,0x56,0x20,0x4c,0x8e,0x8c,
+0x73,0x08,0x6a,0x9c,0x82,0x4d,0x87,0x18,0x00,0x18,0x07,0x9c,0x82,0x08,0x07,0x9c,
+0x85,0x3a,0x07,0x10,0x00,0x08,0x07,0x02,0x50,0x3a,0x48,0x9b,0x61,0x4b,0x46,0x53,
+0x50,0x09,0x66,0x96,0x80,0x7c,0x68,0x97,0x80,0x08,0x48,0x97,0x80,0x08,0x42,0x70,
+0x80,0x57,0x45,0x72,0x90,0x08,0x02,0x93,0x00,0x19,0x09,0x4a,0x00,0x6b,0x6c,0x89,
+0x90,0x08,0x07,0x66,0x80,0x8c,0x19,0x44,0x90,0x08,0x49,0xca,0x93,0x08,0x01,0x88,
+0x00,0x56,0x58,0x01,0x34,0x01,0xf0,0xac,0x02,0xa7,0x90,0x3b,0x37,0xb8,0xa3,0x08,
+0x07,0x68,0x07,0x2c,0x6b,0xb8,0x97,0x09,0x17,0xbf,0x85,0x08,0x05,0x8a,0x90,0x29,
+0x65,0x08,0x26,0x00,0x00,0x02,0x00,0x0c,0x7a,0x46,0x00,0x0b,0x6a,0xa9,0xc9,0x0b,
+0x7d,0xa5,0xa0,0x08,0x09,0x09,0xa0,0x0a,0x87,0x0a,0x50,0x19,0x19,0x66,0x93,0x31,
+0x02,0x40,0x05,0x33,0x75,0x34,0x00,0x27,0x95,0x73,0x00,0x5d,0xe9,0xc9,0xd3,0x64,
+0x44,0xb4,0x90,0x4b,0x86,0x0b,0x50,0x1a,0x53,0x0c,0x20,0x19,0xb3,0x84,0x81,0x41,
+0x03,0x20,0x13,0x00,0x02,0x20,0x00,0x00,0x01,0x90,0x00,0x28,0xc8,0x8a,0xb6,0x00,
+0x91,0x09,0x10,0x00,0x19,0x38,0x00,0x00,0x07,0xe0,0x00,0x01,0x88,0x4b,0x40,0x38,
+0x20,0x00,0x67,0x01,0x50,0x02,0x61,0x39,0x9a,0x95,0x10,0x08,0x45,0x90,0x00,0x47,
+0xc7,0xa8,0xc5,0x48,0xc8,0x90,0x90,0x15,0x95,0x80,0x90,0x71,0x87,0x80,0x90,0x04,
+0x72,0x50,0x90,0x00,0x02,0x60,0x00,0x18,0x88,0xc8,0x85,0x00,0x38,0x00,0x00,0x00,
+0x5c,0x99,0x60,0x00,0x72,0x00,0x90,0x00,0x90,0x01,0x80,0x03,0x80,0x03,0x60,0x2a,
+0x00,0x8a,0x20,0xc4,0x00,0xf0,0x0d,0x0c,0x89,0x79,0xb6,0x0b,0x69,0x83,0x60,0x0c,
+0x89,0xba,0xa7,0x08,0x10,0x09,0x60,0x08,0x35,0x0a,0x70,0x0c,0xb9,0x74,0x75,0x17,
+0x03,0x90,0xa9,0x20,0x00,0x62,0x99,0x99,0x99,0x90,0x00,0x09,0x06,0x00,0x05,0x09,
+0x00,0xf1,0x0a,0x88,0xb0,0xd8,0xd8,0x08,0x0b,0x4b,0x88,0xb0,0xa4,0xb8,0x08,0x1b,
+0x6c,0x88,0x73,0x51,0x94,0x00,0x80,0x09,0x00,0x44,0x05,0xa0,0x9f,0x01,0xf0,0x2b,
+0x09,0x00,0x88,0xa6,0x8c,0x82,0x80,0x93,0x3a,0x32,0x88,0xb5,0x55,0xb3,0x80,0x98,
+0x88,0xc4,0x88,0xa5,0x50,0x90,0x70,0x00,0x90,0x90,0x00,0x00,0x08,0x70,0x0c,0xcc,
 0xcd,0x60,0x09,0x67,0x67,0x50,0x57,0x7a,0x77,0x72,0x07,0x66,0x68,0x30,0x08,0x68,
 0x79,0x30,0x06,0x38,0x28,0x10,0x63,0x3a,0x01,0x80,0xad,0x00,0x80,0x07,0x88,0xc7,
-0xb2,0x07,0x77,0xc7,0xa2,0x08,0x00,0xc3,0x00,0x84,0x40,0x00,0x00,0x8d,0x10,0x00,
-0x19,0x84,0x89,0x97,0xe9,0x0b,0xf0,0x2b,0x00,0x17,0x9b,0xb9,0xb2,0x07,0x9a,0xb9,
-0xb2,0x05,0x68,0x96,0x61,0x26,0x68,0x86,0x65,0x06,0x76,0x66,0x90,0x08,0x65,0x55,
-0xa0,0x08,0x76,0x66,0xa0,0x0c,0xdd,0xdd,0x60,0x0a,0x66,0x68,0x50,0x68,0x78,0x77,
-0x72,0x0b,0x79,0x97,0x90,0x0b,0x78,0x74,0x70,0x3b,0x8c,0x2f,0x30,0x44,0x2a,0x92,
-0x93,0x00,0x0f,0x28,0x30,0x9c,0x88,0x86,0x97,0x15,0xe0,0x04,0xe8,0x88,0xa0,0x38,
-0xa7,0x77,0xa0,0x00,0xa8,0x88,0xa0,0x00,0x90,0x02,0x00,0x20,0x08,0x80,0xe7,0x36,
-0xf2,0x0c,0x4a,0x6a,0x98,0xc0,0x0b,0x88,0x88,0xc0,0x09,0x37,0x80,0x80,0x0a,0x57,
-0x98,0xc0,0x79,0x99,0x80,0x80,0x19,0x63,0x80,0x80,0x81,0x07,0x64,0xdb,0x00,0x00,
-0xd8,0x0b,0x12,0x9a,0xd8,0x0b,0x01,0x50,0x0f,0xf3,0x00,0x0b,0xe4,0x00,0x00,0x94,
-0x89,0x20,0x1b,0x41,0x80,0xa6,0x12,0x01,0x80,0x03,0xf0,0x0b,0x40,0x86,0x00,0x01,
-0x80,0x91,0x06,0xe3,0x92,0x00,0x0b,0xd5,0x00,0x00,0xa3,0x89,0x30,0x2b,0x31,0x80,
-0xa7,0x11,0x20,0x00,0x01,0x3c,0x00,0xf1,0x04,0x9e,0xeb,0x96,0x00,0x65,0x8a,0x00,
-0x02,0x91,0x84,0x80,0x2a,0x9a,0xc9,0x99,0x00,0x01,0x80,0x01,0x1c,0x00,0xf1,0x10,
-0x33,0x00,0x00,0x02,0xd8,0x8c,0x00,0x39,0x58,0xa2,0x00,0x01,0x59,0x95,0x10,0x29,
-0x89,0x88,0x91,0x00,0x36,0x24,0x00,0x08,0x36,0x27,0x30,0x15,0x1a,0x10,0x60,0x75,
-0x02,0x00,0xed,0x06,0xf0,0x08,0x05,0xc8,0x50,0x6d,0x90,0x80,0x82,0x0e,0x57,0x10,
-0x95,0x4c,0x70,0x36,0x00,0x98,0x18,0xac,0x85,0x08,0x00,0x37,0x00,0x04,0x00,0x02,
-0x21,0x03,0xf6,0x0d,0x90,0x00,0x07,0x14,0xcb,0xc0,0x5d,0xaa,0x95,0x40,0x0d,0x93,
-0x8a,0x61,0x4a,0x39,0x88,0x93,0x47,0x18,0x00,0x90,0x07,0x18,0x88,0xc0,0x07,0x18,
-0xaa,0x11,0xf5,0x11,0x06,0x10,0x2a,0x00,0x18,0x32,0x93,0x80,0x4c,0x99,0x9c,0x97,
+0xb2,0x07,0x77,0xc7,0xa2,0x08,0x00,0xc1,0x00,0x84,0x40,0x00,0x00,0x8d,0x10,0x00,
+0x19,0x84,0x89,0x97,0x5b,0x00,0xf0,0x46,0x03,0x50,0x00,0x17,0x9b,0xb9,0xb2,0x07,
+0x9a,0xb9,0xb2,0x05,0x68,0x96,0x61,0x26,0x68,0x86,0x65,0x06,0x76,0x66,0x90,0x08,
+0x65,0x55,0xa0,0x08,0x76,0x66,0xa0,0x0c,0xdd,0xdd,0x60,0x0a,0x66,0x68,0x50,0x68,
+0x78,0x77,0x72,0x0b,0x79,0x97,0x90,0x0b,0x78,0x74,0x70,0x3b,0x8c,0x2f,0x30,0x44,
+0x2a,0x92,0x93,0x00,0x06,0x00,0x00,0x28,0x9c,0x88,0x86,0x00,0x92,0x00,0x00,0x04,
+0xe8,0x88,0xa0,0x38,0xa7,0x77,0xa0,0x00,0xa8,0x88,0xa0,0x00,0x90,0x02,0x00,0xf2,
+0x12,0x08,0x80,0x07,0x07,0x00,0x00,0x4a,0x6a,0x98,0xc0,0x0b,0x88,0x88,0xc0,0x09,
+0x37,0x80,0x80,0x0a,0x57,0x98,0xc0,0x79,0x99,0x80,0x80,0x19,0x63,0x80,0x80,0x81,
+0x07,0x64,0xdb,0x00,0x70,0x01,0x80,0x00,0x06,0x9a,0xc9,0x91,0x08,0x00,0xf0,0x05,
+0x29,0x99,0xc9,0x96,0x00,0x0b,0xe4,0x00,0x00,0x94,0x89,0x20,0x1b,0x41,0x80,0xa6,
+0x12,0x01,0x80,0x03,0x18,0x00,0x40,0x28,0x89,0xc8,0x86,0x08,0x00,0xf3,0x02,0x08,
+0x9a,0xc9,0x92,0x00,0x0b,0xd5,0x00,0x00,0xa3,0x89,0x30,0x2b,0x31,0x80,0xa7,0x11,
+0x20,0x00,0x01,0x3c,0x00,0xf1,0x04,0x9e,0xeb,0x96,0x00,0x65,0x8a,0x00,0x02,0x91,
+0x84,0x80,0x2a,0x9a,0xc9,0x99,0x00,0x01,0x80,0x01,0x1c,0x00,0xf2,0x10,0x33,0x00,
+0x00,0x02,0xd8,0x8c,0x00,0x39,0x58,0xa2,0x00,0x01,0x59,0x95,0x10,0x29,0x89,0x88,
+0x91,0x00,0x36,0x24,0x00,0x08,0x36,0x27,0x30,0x15,0x1a,0x10,0x60,0x75,0x02,0xf0,
+0x0b,0x90,0x00,0x08,0x05,0xc8,0x50,0x6d,0x90,0x80,0x82,0x0e,0x57,0x10,0x95,0x4c,
+0x70,0x36,0x00,0x98,0x18,0xac,0x85,0x08,0x00,0x37,0x00,0x04,0x00,0x02,0x21,0x03,
+0xf4,0x0f,0x90,0x00,0x07,0x14,0xcb,0xc0,0x5d,0xaa,0x95,0x40,0x0d,0x93,0x8a,0x61,
+0x4a,0x39,0x88,0x93,0x47,0x18,0x00,0x90,0x07,0x18,0x88,0xc0,0x07,0x18,0x00,0x90,
+0x44,0x05,0xf5,0x11,0x06,0x10,0x2a,0x00,0x18,0x32,0x93,0x80,0x4c,0x99,0x9c,0x97,
 0x0c,0x86,0x7c,0x74,0x3c,0x58,0x08,0x07,0x67,0x15,0x9f,0x73,0x06,0x10,0x94,0x80,
 0x06,0x3a,0x30,0x59,0xe5,0x02,0xf3,0x09,0x38,0x8c,0x70,0x5c,0x67,0x86,0x80,0x3e,
 0x76,0x84,0x60,0x79,0x86,0x83,0x90,0x68,0x57,0x88,0x80,0x08,0x7a,0xa8,0x72,0x08,
@@ -798,446 +914,358 @@ static const uint8_t lz4FontData[] ={
 0x70,0x94,0xc3,0x9c,0x01,0x51,0x01,0x01,0x80,0x00,0x09,0x04,0x00,0x33,0xc9,0x91,
 0x09,0x0c,0x00,0xf0,0x05,0x7d,0x9a,0xc9,0x93,0x09,0x99,0xd9,0x93,0x01,0x10,0x90,
 0x00,0x04,0x40,0xd9,0x90,0x04,0x40,0x90,0x00,0x04,0x00,0x42,0x2a,0xa8,0xc8,0x86,
-0x06,0x01,0xf0,0x0e,0x93,0x10,0x6c,0x82,0x83,0x80,0x0c,0x95,0xb7,0x40,0x52,0x80,
+0x06,0x01,0xf1,0x0f,0x93,0x10,0x6c,0x82,0x83,0x80,0x0c,0x95,0xb7,0x40,0x52,0x80,
 0x88,0x92,0x78,0x87,0x85,0x41,0x05,0x40,0x1a,0x70,0x0a,0x01,0x8d,0x02,0x82,0x19,
-0x24,0x8d,0x17,0x00,0x20,0x08,0xf4,0x0e,0x00,0x03,0xb8,0x88,0x83,0x19,0x88,0x98,
+0x24,0xa3,0x23,0x00,0xf4,0x10,0x70,0x00,0x00,0x03,0xb8,0x88,0x83,0x19,0x88,0x98,
 0x80,0x00,0x80,0x80,0x80,0x3a,0xb9,0xc8,0xc7,0x05,0x33,0x50,0x90,0x04,0x88,0x89,
-0xb5,0x00,0x00,0x49,0x30,0x50,0x01,0x03,0x09,0x13,0x00,0xef,0x0e,0x80,0xb3,0x0c,
-0x96,0xaa,0x20,0x09,0x00,0xa0,0x10,0x00,0x93,0x04,0x0a,0x24,0x90,0x08,0x2d,0x82,
-0x79,0xa4,0xfc,0x0a,0xf1,0x0d,0x00,0x07,0x97,0x77,0x73,0x38,0x77,0x77,0x40,0x27,
-0x88,0x88,0x20,0x04,0x11,0x64,0x40,0x01,0xab,0x13,0x50,0x02,0xa9,0x61,0x74,0x29,
-0x10,0x60,0x89,0x13,0x10,0x18,0xcd,0x10,0x20,0x64,0x09,0x3c,0x0c,0xf1,0x67,0x87,
-0x48,0x4c,0x89,0x08,0x00,0x39,0x09,0x27,0x05,0x49,0x05,0x84,0x0a,0x09,0x00,0x09,
-0x35,0x07,0x88,0x97,0x08,0x30,0x09,0x00,0x00,0x46,0x8c,0x82,0x25,0x00,0x09,0x00,
-0x04,0x28,0x8c,0x85,0x00,0x40,0x82,0x00,0x04,0x51,0x70,0x90,0x0a,0x0b,0x98,0x96,
-0x01,0x00,0x00,0x02,0x09,0x10,0x09,0x00,0x01,0x58,0x8d,0x86,0x22,0x09,0x09,0x17,
-0x07,0x1c,0x8c,0x92,0x00,0x28,0x90,0xa0,0x06,0x66,0x4a,0x50,0x09,0x83,0x8a,0x92,
-0x02,0x45,0x10,0x16,0x18,0x15,0x09,0x06,0x02,0x29,0x09,0x74,0x42,0x08,0x8d,0x94,
-0x08,0x09,0x11,0x28,0x01,0x1b,0x77,0x78,0x07,0x2c,0x88,0x88,0x0a,0x09,0x00,0x08,
-0x34,0x09,0x02,0x95,0x00,0x33,0x21,0xf1,0x0f,0x09,0x81,0x02,0x68,0x8c,0x96,0x31,
-0x82,0x49,0x00,0x28,0x83,0x4a,0x62,0x02,0x88,0xb8,0x80,0x09,0x88,0xa7,0x51,0x27,
-0x83,0x2a,0x77,0x54,0x40,0x80,0x96,0x42,0x1e,0x00,0x6c,0x02,0xf3,0x0d,0x3c,0x77,
-0xb0,0x20,0x0c,0x77,0xb0,0x28,0x09,0x77,0x80,0x00,0x48,0x88,0x81,0x07,0x64,0x77,
-0x71,0x09,0x44,0x77,0x71,0x44,0x9a,0xcc,0xb6,0x00,0xe9,0x1b,0xf0,0x25,0x18,0x89,
-0x8b,0x83,0x40,0x77,0x88,0xa0,0x36,0x88,0x76,0xb0,0x02,0x96,0x78,0xb0,0x09,0x92,
-0x18,0x50,0x45,0x99,0x08,0x82,0x65,0x43,0x66,0x12,0x05,0x26,0x23,0x00,0x11,0x5c,
-0x7b,0x71,0x17,0x6b,0x6b,0x60,0x02,0x5b,0x6b,0x60,0x09,0x0d,0x9c,0x93,0x3a,0x8c,
-0xa9,0x97,0xec,0x03,0x00,0x04,0x00,0xf0,0x71,0x05,0x00,0x60,0x00,0x04,0x97,0x87,
-0x94,0x30,0x37,0x97,0x61,0x26,0x27,0xc7,0x80,0x02,0x58,0xb6,0xb0,0x09,0x49,0xc7,
-0xc0,0x36,0x38,0x05,0x70,0x10,0x40,0x00,0x21,0x09,0x10,0x07,0x00,0x03,0x69,0x8c,
-0xa3,0x24,0x2a,0xbd,0xa7,0x05,0x16,0x66,0x72,0x00,0x29,0x55,0x84,0x04,0x59,0x66,
-0x84,0x0a,0x07,0xb7,0xc2,0x03,0x35,0x00,0x26,0x04,0x20,0x00,0x00,0x1d,0x99,0xaa,
-0x90,0x79,0x34,0x85,0x30,0x4c,0xaa,0xcb,0xa0,0x08,0x34,0x85,0x30,0x69,0x88,0x88,
-0x92,0x36,0x62,0x90,0xa0,0x50,0x22,0x31,0x32,0x00,0x90,0x08,0x50,0x53,0x90,0x08,
-0x35,0x07,0xa8,0x9c,0x87,0x00,0x90,0x3c,0x00,0x09,0x90,0x7b,0x10,0x73,0x90,0xa2,
-0x60,0x00,0x96,0x50,0x91,0x00,0xb8,0x00,0x09,0x4e,0x1b,0xf1,0x09,0x58,0x8c,0x98,
-0x82,0x39,0x6a,0x95,0x70,0x02,0x39,0x54,0x00,0x58,0xab,0xa7,0x90,0x78,0x9b,0x99,
-0x93,0x00,0x08,0x10,0x00,0x04,0x00,0x01,0x5c,0x05,0xf1,0x0b,0x76,0xa4,0x07,0x18,
-0x77,0xb4,0x4c,0x98,0x77,0xb4,0x07,0x18,0x87,0xb4,0x1a,0xa2,0x89,0x00,0x54,0x05,
-0x49,0x04,0x00,0x58,0x07,0x87,0x20,0x00,0xf0,0x1d,0x89,0x8c,0x88,0x08,0x09,0x6b,
-0x68,0x4c,0x79,0x4a,0x48,0x08,0x02,0x3b,0x32,0x09,0x66,0x8d,0x86,0x6d,0x50,0x09,
-0x00,0x20,0x38,0x8d,0x88,0x00,0x70,0x80,0x00,0x04,0x60,0x80,0x00,0x0b,0x99,0xc9,
-0x93,0x15,0x00,0x80,0x00,0x04,0x38,0x10,0x02,0xc1,0x07,0x00,0x64,0x04,0xf0,0x0b,
-0x97,0x0a,0x89,0xc8,0xd0,0xa7,0x8c,0x7c,0x09,0x01,0x90,0x90,0xb8,0x9c,0x8d,0x08,
-0x00,0x80,0x91,0x60,0x08,0x09,0x71,0x00,0x86,0xa0,0x7c,0x03,0x00,0x42,0x0e,0xf2,
-0x04,0x78,0xa9,0x20,0x07,0x80,0x84,0x37,0x09,0x97,0xca,0x39,0x09,0x76,0x98,0x29,
-0x0d,0x88,0x88,0x89,0x37,0x11,0xf0,0x0f,0x13,0x40,0x05,0xb8,0xb6,0x60,0x28,0xc8,
-0xcc,0x95,0x00,0x76,0x98,0x10,0x19,0x98,0xc7,0xc4,0x04,0x74,0x93,0xa0,0x04,0x64,
-0x93,0xa0,0x04,0x97,0x77,0xa0,0x9a,0x01,0xc0,0x38,0xb4,0x88,0x40,0x0a,0xb6,0x7b,
-0x70,0x77,0x77,0x78,0x73,0x69,0x16,0xc0,0x05,0x97,0x8a,0x00,0x00,0xa0,0x35,0x00,
-0x58,0xc8,0xc9,0x82,0x34,0x3b,0xf0,0x2a,0x27,0xaa,0x89,0x60,0x06,0x8b,0x77,0x30,
-0x58,0xc8,0x77,0x71,0x06,0xc7,0x77,0x50,0x77,0xb5,0x57,0x70,0x20,0xb6,0x67,0x70,
-0x00,0xb7,0x78,0x70,0x11,0x10,0x05,0x00,0x3c,0x69,0xb9,0x86,0x09,0x04,0xba,0x44,
-0x2c,0xab,0x8b,0x51,0x88,0x84,0xac,0x71,0x08,0x83,0x9b,0x61,0x0b,0x53,0x9c,0x74,
-0x00,0x79,0x09,0x03,0xf8,0x1b,0xf2,0x63,0x69,0x9c,0xa9,0x92,0x04,0x18,0x14,0x00,
-0x0a,0x08,0x14,0x70,0x83,0x08,0x10,0xa0,0x10,0x7b,0x00,0x10,0x37,0x90,0x08,0x00,
-0x29,0x02,0x28,0x50,0x7c,0x98,0x28,0x71,0x0d,0x59,0x08,0x14,0x5b,0x60,0x08,0x90,
-0x88,0x00,0x04,0x80,0x08,0x00,0x7a,0x00,0x08,0x3c,0x60,0x00,0x16,0x80,0x60,0x00,
-0x29,0x14,0xbb,0xa3,0x6c,0x9a,0x09,0x60,0x0c,0x34,0x39,0x60,0x2d,0x96,0x39,0x80,
-0x88,0x19,0x09,0x53,0x17,0x14,0x09,0x12,0x07,0x00,0x66,0x00,0x03,0x70,0x24,0x00,
-0x3a,0x24,0xa8,0xc0,0x3a,0x74,0x79,0x40,0x2c,0x67,0x79,0x00,0x1d,0x90,0x88,0xb5,
-0x88,0x17,0x63,0xb0,0x17,0x10,0x2d,0x20,0x07,0x29,0x73,0x1a,0x00,0x21,0x0e,0xf4,
-0x01,0x68,0x8b,0x98,0xa0,0x90,0x60,0x52,0x80,0x39,0x30,0x07,0x70,0x06,0x8a,0x88,
-0x20,0x94,0x12,0x40,0x58,0x8d,0x88,0x80,0x89,0x03,0xf0,0x0d,0x1b,0x88,0xa8,0x87,
-0x15,0x94,0x09,0x45,0x06,0x21,0x66,0x60,0x28,0x8a,0xbb,0x96,0x00,0x0b,0x82,0x00,
-0x02,0x94,0x09,0x61,0x16,0x10,0x00,0x25,0x25,0x18,0xf2,0x0d,0x17,0x39,0x09,0x08,
-0x46,0x76,0x89,0x85,0x33,0x88,0x9b,0x86,0x15,0x76,0x9b,0x85,0x06,0x89,0x73,0x48,
-0x5a,0x89,0x73,0x48,0x00,0x08,0x63,0x77,0x63,0x00,0xf1,0x0f,0x60,0x00,0x59,0xc8,
-0xac,0x82,0x48,0xaa,0x99,0x70,0x03,0x3a,0x43,0x90,0x0a,0x4a,0x44,0x30,0x08,0xaf,
-0x87,0xb0,0x04,0xa9,0x00,0x90,0x58,0x08,0x07,0x30,0xb3,0x06,0xf3,0x2f,0x20,0x24,
-0x00,0x0a,0xc8,0xba,0xa6,0x22,0x35,0x90,0x40,0x00,0x78,0x3a,0x40,0x29,0x67,0x77,
-0x58,0x00,0xb8,0x88,0x80,0x00,0x80,0x00,0x90,0x00,0xc8,0x88,0x80,0x07,0x11,0x71,
-0x10,0x98,0xab,0x8c,0x61,0x19,0x66,0x67,0x60,0x0a,0x66,0x67,0x70,0x0b,0x88,0x89,
-0x70,0x03,0xb4,0x5a,0x20,0x59,0xc7,0x8b,0x72,0x4a,0x10,0x17,0x04,0x0e,0xf0,0x0a,
-0x24,0x00,0x2b,0xc7,0x98,0xb5,0x18,0x88,0xb7,0x94,0x08,0x77,0x77,0x57,0x01,0xb7,
-0x77,0x90,0x01,0xa5,0x55,0x50,0x01,0x92,0x22,0x0c,0x15,0xf1,0x11,0xc0,0x05,0x00,
-0x50,0x00,0x3b,0xba,0xac,0x72,0x87,0xbb,0x6c,0x80,0x37,0xa6,0x80,0x80,0x57,0xaa,
-0x80,0x90,0x47,0xa7,0x83,0x60,0x58,0xb7,0x80,0x25,0x00,0x70,0x78,0x25,0x0e,0xf1,
-0x10,0x27,0x22,0x3a,0x31,0x59,0x83,0x5b,0x52,0x2a,0x52,0x6c,0x61,0x5d,0x86,0x77,
-0x75,0x0e,0x64,0x97,0xa2,0x5b,0x54,0x96,0xa2,0x58,0x04,0x96,0xa2,0x07,0x04,0x42,
-0xd8,0x13,0x00,0x2d,0x0d,0xf0,0x2e,0x06,0x78,0xb7,0x73,0x03,0x78,0xb7,0x70,0x27,
-0x8d,0x7a,0x75,0x02,0x9b,0x85,0x20,0x08,0xb8,0xa7,0x94,0x01,0x70,0x95,0x60,0x18,
-0x08,0x70,0x45,0x12,0x2a,0x22,0x21,0x36,0x6c,0x66,0x62,0x68,0x8c,0x88,0x86,0x62,
-0x85,0x64,0x06,0x04,0xb9,0x16,0x30,0x1a,0x8a,0x86,0x82,0x06,0x47,0x28,0x50,0x44,
-0x4a,0x00,0x63,0x02,0x94,0x02,0xf0,0x0c,0x18,0x9c,0xc0,0x98,0x58,0x08,0x80,0x28,
-0x58,0x8c,0xc0,0x98,0x99,0x08,0x80,0x54,0x68,0x08,0x80,0x87,0x59,0x8c,0xc0,0x52,
-0x08,0x00,0x70,0xcc,0x03,0xf0,0x0e,0x08,0x32,0xc8,0xa0,0x98,0x69,0x97,0x30,0x39,
-0x40,0x8b,0x30,0x99,0xa8,0x61,0x73,0x44,0x50,0x07,0x10,0x87,0x52,0x86,0x00,0x21,
-0x00,0x02,0x60,0x03,0x9f,0x01,0xf1,0x0c,0x19,0xa8,0xd0,0x54,0x80,0xa6,0x60,0x9c,
-0x10,0x9d,0x20,0x78,0xa6,0x35,0x62,0x43,0x55,0x9c,0x80,0x87,0x70,0x08,0x00,0x86,
-0x28,0x9c,0x83,0x35,0x0b,0xf6,0x10,0x00,0x41,0x00,0x08,0x37,0xab,0x82,0x66,0x70,
-0xa1,0x40,0x6b,0x27,0x97,0xc0,0x37,0x95,0x64,0x42,0x66,0x72,0x78,0x00,0x76,0x65,
-0x48,0x03,0x75,0x3a,0x07,0x94,0x8c,0x05,0xf1,0x0e,0x08,0x00,0x27,0x19,0x48,0x41,
-0xa7,0x59,0x59,0x60,0x38,0x39,0x8f,0x92,0x87,0x79,0x6b,0x80,0x55,0x79,0x58,0x11,
-0x76,0x69,0x00,0x00,0x75,0x0a,0x88,0x71,0x0d,0x00,0xdd,0x0a,0xf4,0x0d,0x16,0x37,
-0x8c,0x72,0xa7,0x55,0x8a,0x80,0x2a,0x48,0x77,0x83,0x96,0x85,0x11,0x33,0x32,0x40,
-0x86,0x20,0x77,0x71,0x86,0x24,0x64,0x2a,0x15,0x95,0x4c,0x00,0xf0,0x0e,0x7d,0xd8,
-0xc8,0x90,0x76,0x74,0x4c,0x10,0x56,0x97,0x84,0x90,0x05,0xc9,0x71,0x00,0x18,0xc9,
-0x6a,0x50,0x14,0x39,0x17,0x20,0x35,0x3a,0x02,0x70,0x01,0x6c,0x00,0xf0,0x0d,0x12,
-0x77,0xa0,0x87,0x81,0x55,0x90,0x2a,0x47,0x8b,0x83,0x9b,0xb5,0x58,0x71,0x42,0x50,
-0x7e,0x50,0x77,0x78,0x78,0xa2,0x64,0x01,0x47,0x01,0x05,0x34,0x3a,0xf1,0x2c,0x37,
-0x88,0xa0,0x88,0x68,0x77,0xc0,0x29,0x47,0x68,0xb0,0x88,0xa6,0x6a,0x70,0x44,0x51,
-0x8c,0x60,0x77,0x59,0x29,0x90,0x54,0x13,0x67,0x22,0x05,0x00,0x05,0x00,0x08,0x38,
-0x78,0xa0,0x67,0x69,0x55,0xa0,0x3a,0x39,0x22,0x20,0x79,0xac,0x8b,0xa4,0x44,0x5c,
-0x9b,0xb4,0x87,0x6b,0x37,0x64,0x53,0x27,0x33,0x73,0xd7,0x1b,0xf4,0x00,0x8c,0x9b,
-0xa5,0x1a,0xab,0xda,0xa5,0x01,0x79,0x86,0x50,0x03,0x85,0x55,0x90,0x04,0x00,0xf1,
-0x29,0x29,0x97,0x77,0xc5,0x0b,0x6b,0x8a,0x95,0x06,0x69,0x86,0x73,0x03,0x7a,0x9b,
-0x80,0x27,0x8d,0xc8,0x75,0x29,0xd7,0x77,0xc0,0x00,0x96,0x66,0xb0,0x00,0x97,0x77,
-0xb0,0x00,0x07,0x20,0x41,0x04,0x8b,0x9b,0x80,0x18,0x8b,0x9e,0x85,0x00,0x19,0x71,
-0x10,0x18,0xaa,0x66,0x50,0x12,0x59,0x88,0x60,0x59,0x05,0x33,0x02,0x8a,0x10,0x1e,
-0x0c,0xf6,0x2d,0x50,0x08,0x8c,0x8a,0x40,0x00,0x08,0x56,0x00,0x68,0xae,0x98,0x82,
-0x29,0xd9,0x78,0x30,0x42,0xb7,0x79,0x50,0x01,0x70,0x04,0x50,0x01,0xc8,0x8a,0x50,
-0x00,0x80,0x91,0x30,0x27,0xc0,0xa7,0x30,0x36,0xb0,0x76,0x90,0x04,0x77,0x77,0x00,
-0x09,0x44,0x4a,0x00,0x09,0x33,0x3a,0x00,0x09,0x66,0x6b,0x00,0x09,0x00,0x3b,0x66,
-0x1f,0xf2,0x1c,0x51,0x62,0x10,0x1a,0x19,0x69,0x81,0x27,0x67,0x72,0x04,0x0b,0x79,
-0x39,0x85,0x0b,0x5a,0x31,0x11,0x0c,0x7b,0x68,0x61,0x08,0x09,0x62,0x07,0x08,0x58,
-0x49,0x87,0x00,0x42,0x00,0x68,0xc9,0x87,0x90,0x00,0x09,0xa8,0x88,0x8b,0x06,0x00,
-0x02,0x09,0x00,0x20,0x00,0x42,0x0b,0x14,0x40,0x80,0x97,0x77,0x79,0x2d,0x0f,0xf0,
-0x01,0x98,0xc9,0x87,0x09,0x01,0x88,0x60,0xa3,0x73,0xa5,0x08,0x51,0x00,0x43,0x00,
-0x44,0x46,0x1c,0xf0,0x07,0x79,0xa0,0x00,0x4e,0x98,0xd9,0x81,0x02,0x90,0x09,0x05,
-0x30,0x09,0x99,0xd9,0xb3,0x00,0x90,0x00,0x01,0x20,0x09,0xe2,0x01,0xf0,0x1e,0x49,
-0x88,0x89,0x80,0x00,0x90,0x08,0x00,0x68,0xc8,0x8c,0xb3,0x38,0x98,0x8c,0xa3,0x47,
-0x78,0x49,0x50,0x59,0x78,0x59,0x80,0x67,0x77,0x6a,0x20,0x84,0x79,0x8b,0x43,0x70,
-0x00,0x80,0xa4,0x01,0x20,0x00,0x00,0x28,0x05,0x88,0x82,0x41,0xb3,0x18,0x85,0x19,
-0x9b,0xb4,0x9b,0x00,0x05,0x40,0x09,0x04,0x00,0xf4,0x13,0x6a,0x10,0x04,0x02,0x41,
-0x00,0x46,0x5b,0x44,0x84,0x36,0x6b,0x74,0x00,0x3b,0x8b,0x89,0xc5,0x58,0x8b,0x86,
-0x80,0x08,0x4b,0x62,0x80,0x08,0x6c,0x96,0x80,0x08,0x00,0x14,0xa0,0x42,0x0d,0xf1,
-0x4c,0x28,0x8c,0x88,0x70,0x07,0x7c,0x87,0x40,0x58,0x8c,0x98,0x81,0x01,0x93,0x81,
-0x70,0x79,0x70,0x5b,0x10,0x03,0xa8,0x35,0xa2,0x03,0x50,0x00,0x11,0x00,0x05,0x20,
-0x00,0x57,0x78,0x87,0x71,0x06,0x77,0x79,0x30,0x5c,0x76,0x69,0x92,0x05,0x8a,0xa8,
-0x30,0x05,0xb1,0x77,0x70,0x63,0xb5,0x69,0x71,0x00,0x73,0x00,0x32,0x20,0x90,0x07,
-0x00,0x36,0x98,0x8c,0x81,0x27,0x90,0x07,0x00,0x30,0x78,0x87,0x70,0x67,0x7a,0xa7,
-0x72,0x03,0x94,0x84,0x60,0x55,0xa4,0x5a,0x50,0x03,0x63,0x00,0x91,0x0e,0xf1,0x31,
-0x35,0x80,0x00,0x80,0x89,0xc8,0x35,0x80,0x59,0xd9,0x35,0x80,0x41,0x89,0x04,0x80,
-0x57,0x7b,0x97,0x72,0x15,0x83,0x85,0x60,0x46,0x97,0x29,0x61,0x02,0x30,0x00,0x21,
-0x05,0x01,0x40,0x00,0x38,0x48,0x87,0x73,0x35,0x9d,0x66,0xa0,0x09,0x79,0x66,0xb0,
-0x6d,0x94,0xc7,0x70,0x38,0x37,0xb8,0xb0,0x08,0x14,0xab,0x10,0x08,0x29,0x64,0x94,
-0x41,0x10,0xf0,0x00,0xc9,0xc8,0x81,0x3a,0xb8,0xc7,0xb0,0x39,0xa8,0xa6,0x90,0x68,
-0xba,0x88,0x82,0x9a,0x2d,0xf0,0x05,0x04,0xad,0xb7,0x30,0x45,0x20,0x01,0x50,0x09,
-0x88,0x89,0x60,0x09,0x77,0x79,0x60,0x09,0x77,0x78,0x60,0x0c,0x00,0x00,0x8f,0x0b,
-0x84,0x01,0x90,0x90,0x07,0x59,0x10,0x69,0x95,0xe8,0x09,0xf2,0x0d,0x19,0x36,0x98,
-0xc0,0x2a,0x47,0x87,0xc0,0x6c,0x88,0x87,0xb0,0x0a,0x06,0x98,0xc0,0x09,0x80,0x88,
-0x00,0x36,0x53,0x78,0x01,0x80,0x19,0x06,0x94,0x80,0x10,0x00,0x65,0x1a,0xf5,0x0f,
+0xb5,0x00,0x00,0x49,0x30,0x50,0x01,0x31,0x09,0x00,0x90,0x04,0x00,0xb0,0x0a,0x00,
+0x90,0xb3,0x0c,0x96,0xaa,0x20,0x09,0x00,0xa0,0x10,0x00,0xb1,0x04,0x0a,0x24,0x90,
+0x08,0x2d,0x82,0x79,0xa4,0x00,0x00,0x9c,0x06,0xf0,0x0e,0x00,0x07,0x97,0x77,0x73,
+0x38,0x77,0x77,0x40,0x27,0x88,0x88,0x20,0x04,0x11,0x64,0x40,0x01,0xab,0x13,0x50,
+0x02,0xa9,0x61,0x74,0x29,0x10,0x60,0x95,0x24,0x00,0xf1,0x70,0x18,0x00,0x09,0x00,
+0x08,0x64,0x09,0x00,0x00,0x09,0x0c,0x87,0x48,0x4c,0x89,0x08,0x00,0x39,0x09,0x27,
+0x05,0x49,0x05,0x84,0x0a,0x09,0x00,0x09,0x35,0x07,0x88,0x97,0x08,0x30,0x09,0x00,
+0x00,0x46,0x8c,0x82,0x25,0x00,0x09,0x00,0x04,0x28,0x8c,0x85,0x00,0x40,0x82,0x00,
+0x04,0x51,0x70,0x90,0x0a,0x0b,0x98,0x96,0x01,0x00,0x00,0x02,0x09,0x10,0x09,0x00,
+0x01,0x58,0x8d,0x86,0x22,0x09,0x09,0x17,0x07,0x1c,0x8c,0x92,0x00,0x28,0x90,0xa0,
+0x06,0x66,0x4a,0x50,0x09,0x83,0x8a,0x92,0x02,0x45,0x10,0x16,0x18,0x15,0x09,0x06,
+0x02,0x29,0x09,0x74,0x42,0x08,0x8d,0x94,0x08,0x09,0x11,0x28,0x01,0x1b,0x77,0x78,
+0x07,0x2c,0x88,0x88,0x0a,0x09,0x00,0x08,0x34,0x09,0x02,0x84,0x00,0xf1,0x11,0x19,
+0x00,0x09,0x81,0x02,0x68,0x8c,0x96,0x31,0x82,0x49,0x00,0x28,0x83,0x4a,0x62,0x02,
+0x88,0xb8,0x80,0x09,0x88,0xa7,0x51,0x27,0x83,0x2a,0x77,0x54,0x40,0x80,0x96,0xcc,
+0x00,0x00,0x6c,0x02,0xf0,0x0c,0x3c,0x77,0xb0,0x20,0x0c,0x77,0xb0,0x28,0x09,0x77,
+0x80,0x00,0x48,0x88,0x81,0x07,0x64,0x77,0x71,0x09,0x44,0x77,0x71,0x44,0x9a,0xcc,
+0xb6,0x24,0x00,0x10,0x10,0xd0,0x00,0xf0,0x24,0x89,0x8b,0x83,0x40,0x77,0x88,0xa0,
+0x36,0x88,0x76,0xb0,0x02,0x96,0x78,0xb0,0x09,0x92,0x18,0x50,0x45,0x99,0x08,0x82,
+0x65,0x43,0x66,0x12,0x05,0x26,0x23,0x00,0x11,0x5c,0x7b,0x71,0x17,0x6b,0x6b,0x60,
+0x02,0x5b,0x6b,0x60,0x09,0x0d,0x9c,0x93,0x3a,0x8c,0xa9,0x97,0xec,0x03,0x00,0x04,
+0x00,0xf1,0x8d,0x05,0x00,0x60,0x00,0x04,0x97,0x87,0x94,0x30,0x37,0x97,0x61,0x26,
+0x27,0xc7,0x80,0x02,0x58,0xb6,0xb0,0x09,0x49,0xc7,0xc0,0x36,0x38,0x05,0x70,0x10,
+0x40,0x00,0x21,0x09,0x10,0x07,0x00,0x03,0x69,0x8c,0xa3,0x24,0x2a,0xbd,0xa7,0x05,
+0x16,0x66,0x72,0x00,0x29,0x55,0x84,0x04,0x59,0x66,0x84,0x0a,0x07,0xb7,0xc2,0x03,
+0x35,0x00,0x26,0x04,0x20,0x00,0x00,0x1d,0x99,0xaa,0x90,0x79,0x34,0x85,0x30,0x4c,
+0xaa,0xcb,0xa0,0x08,0x34,0x85,0x30,0x69,0x88,0x88,0x92,0x36,0x62,0x90,0xa0,0x50,
+0x22,0x31,0x32,0x00,0x90,0x08,0x50,0x53,0x90,0x08,0x35,0x07,0xa8,0x9c,0x87,0x00,
+0x90,0x3c,0x00,0x09,0x90,0x7b,0x10,0x73,0x90,0xa2,0x60,0x00,0x96,0x50,0x91,0x00,
+0xb8,0x00,0x09,0x00,0x06,0x10,0x00,0x58,0x8c,0x98,0x82,0x39,0x6a,0x95,0x70,0x02,
+0x39,0x54,0x00,0x58,0xab,0xa7,0x90,0x78,0x9b,0x99,0x93,0x00,0x08,0x10,0x00,0x04,
+0x00,0x01,0x5c,0x05,0xf1,0x0b,0x76,0xa4,0x07,0x18,0x77,0xb4,0x4c,0x98,0x77,0xb4,
+0x07,0x18,0x87,0xb4,0x1a,0xa2,0x89,0x00,0x54,0x05,0x49,0x04,0x00,0x58,0x07,0x87,
+0x20,0x00,0xf3,0x20,0x89,0x8c,0x88,0x08,0x09,0x6b,0x68,0x4c,0x79,0x4a,0x48,0x08,
+0x02,0x3b,0x32,0x09,0x66,0x8d,0x86,0x6d,0x50,0x09,0x00,0x20,0x38,0x8d,0x88,0x00,
+0x70,0x80,0x00,0x04,0x60,0x80,0x00,0x0b,0x99,0xc9,0x93,0x15,0x00,0x80,0x00,0x04,
+0x99,0xc9,0x91,0xc1,0x07,0x00,0x64,0x04,0xf0,0x0b,0x97,0x0a,0x89,0xc8,0xd0,0xa7,
+0x8c,0x7c,0x09,0x01,0x90,0x90,0xb8,0x9c,0x8d,0x08,0x00,0x80,0x91,0x60,0x08,0x09,
+0x71,0x00,0x86,0xa0,0x7c,0x03,0xf1,0x08,0x88,0x88,0x85,0x00,0x78,0xa9,0x20,0x07,
+0x80,0x84,0x37,0x09,0x97,0xca,0x39,0x09,0x76,0x98,0x29,0x0d,0x88,0x88,0x89,0x8b,
+0x02,0xf0,0x10,0x00,0x13,0x40,0x05,0xb8,0xb6,0x60,0x28,0xc8,0xcc,0x95,0x00,0x76,
+0x98,0x10,0x19,0x98,0xc7,0xc4,0x04,0x74,0x93,0xa0,0x04,0x64,0x93,0xa0,0x04,0x97,
+0x77,0xa0,0x9a,0x01,0xf0,0x4c,0x38,0xb4,0x88,0x40,0x0a,0xb6,0x7b,0x70,0x77,0x77,
+0x78,0x73,0x08,0x00,0x09,0x00,0x05,0x97,0x8a,0x00,0x00,0xa0,0x35,0x00,0x58,0xc8,
+0xc9,0x82,0x00,0x60,0x06,0x00,0x27,0xaa,0x89,0x60,0x06,0x8b,0x77,0x30,0x58,0xc8,
+0x77,0x71,0x06,0xc7,0x77,0x50,0x77,0xb5,0x57,0x70,0x20,0xb6,0x67,0x70,0x00,0xb7,
+0x78,0x70,0x11,0x10,0x05,0x00,0x3c,0x69,0xb9,0x86,0x09,0x04,0xba,0x44,0x2c,0xab,
+0x8b,0x51,0x88,0x84,0xac,0x71,0x08,0x83,0x9b,0x61,0x0b,0x53,0x9c,0x74,0x00,0x03,
+0x50,0x2b,0x06,0x10,0x50,0xfc,0x00,0xf2,0x65,0x69,0x9c,0xa9,0x92,0x04,0x18,0x14,
+0x00,0x0a,0x08,0x14,0x70,0x83,0x08,0x10,0xa0,0x10,0x7b,0x00,0x10,0x37,0x90,0x08,
+0x00,0x29,0x02,0x28,0x50,0x7c,0x98,0x28,0x71,0x0d,0x59,0x08,0x14,0x5b,0x60,0x08,
+0x90,0x88,0x00,0x04,0x80,0x08,0x00,0x7a,0x00,0x08,0x3c,0x60,0x00,0x16,0x80,0x60,
+0x00,0x29,0x14,0xbb,0xa3,0x6c,0x9a,0x09,0x60,0x0c,0x34,0x39,0x60,0x2d,0x96,0x39,
+0x80,0x88,0x19,0x09,0x53,0x17,0x14,0x09,0x12,0x07,0x00,0x66,0x00,0x03,0x70,0x24,
+0x00,0x3a,0x24,0xa8,0xc0,0x3a,0x74,0x79,0x40,0x2c,0x67,0x79,0x00,0x1d,0x90,0x88,
+0xb5,0x88,0x17,0x63,0xb0,0x17,0x10,0x2d,0x20,0x07,0x29,0x80,0x00,0x05,0x05,0xf2,
+0x05,0x00,0x00,0x68,0x8b,0x98,0xa0,0x90,0x60,0x52,0x80,0x39,0x30,0x07,0x70,0x06,
+0x8a,0x88,0x20,0x00,0x09,0x1a,0x01,0x40,0x58,0x8d,0x88,0x80,0x89,0x03,0xf2,0x2d,
+0x1b,0x88,0xa8,0x87,0x15,0x94,0x09,0x45,0x06,0x21,0x66,0x60,0x28,0x8a,0xbb,0x96,
+0x00,0x0b,0x82,0x00,0x02,0x94,0x09,0x61,0x16,0x10,0x00,0x25,0x06,0x00,0x09,0x00,
+0x17,0x39,0x09,0x08,0x46,0x76,0x89,0x85,0x33,0x88,0x9b,0x86,0x15,0x76,0x9b,0x85,
+0x06,0x89,0x73,0x48,0x5a,0x89,0x73,0x48,0x00,0x08,0x63,0x77,0x63,0x00,0xf1,0x0f,
+0x60,0x00,0x59,0xc8,0xac,0x82,0x48,0xaa,0x99,0x70,0x03,0x3a,0x43,0x90,0x0a,0x4a,
+0x44,0x30,0x08,0xaf,0x87,0xb0,0x04,0xa9,0x00,0x90,0x58,0x08,0x07,0x30,0xb3,0x06,
+0xf2,0x2f,0x20,0x24,0x00,0x0a,0xc8,0xba,0xa6,0x22,0x35,0x90,0x40,0x00,0x78,0x3a,
+0x40,0x29,0x67,0x77,0x58,0x00,0xb8,0x88,0x80,0x00,0x80,0x00,0x90,0x00,0xc8,0x88,
+0x80,0x07,0x11,0x71,0x10,0x98,0xab,0x8c,0x61,0x19,0x66,0x67,0x60,0x0a,0x66,0x67,
+0x70,0x0b,0x88,0x89,0x70,0x03,0xb4,0x5a,0x20,0x59,0xc7,0x8b,0x72,0x4a,0x10,0x17,
+0xa8,0x05,0xf0,0x30,0x00,0x24,0x00,0x2b,0xc7,0x98,0xb5,0x18,0x88,0xb7,0x94,0x08,
+0x77,0x77,0x57,0x01,0xb7,0x77,0x90,0x01,0xa5,0x55,0x50,0x01,0x92,0x22,0xa0,0x01,
+0xb7,0x77,0xc0,0x05,0x00,0x50,0x00,0x3b,0xba,0xac,0x72,0x87,0xbb,0x6c,0x80,0x37,
+0xa6,0x80,0x80,0x57,0xaa,0x80,0x90,0x47,0xa7,0x83,0x60,0x58,0xb7,0x80,0x25,0x00,
+0x70,0x78,0x92,0x44,0x00,0xf2,0x11,0x27,0x22,0x3a,0x31,0x59,0x83,0x5b,0x52,0x2a,
+0x52,0x6c,0x61,0x5d,0x86,0x77,0x75,0x0e,0x64,0x97,0xa2,0x5b,0x54,0x96,0xa2,0x58,
+0x04,0x96,0xa2,0x07,0x04,0x42,0xa1,0x44,0x05,0xf0,0x30,0x70,0x00,0x06,0x78,0xb7,
+0x73,0x03,0x78,0xb7,0x70,0x27,0x8d,0x7a,0x75,0x02,0x9b,0x85,0x20,0x08,0xb8,0xa7,
+0x94,0x01,0x70,0x95,0x60,0x18,0x08,0x70,0x45,0x12,0x2a,0x22,0x21,0x36,0x6c,0x66,
+0x62,0x68,0x8c,0x88,0x86,0x62,0x85,0x64,0x06,0x04,0xb9,0x16,0x30,0x1a,0x8a,0x86,
+0x82,0x06,0x47,0x28,0x50,0x44,0x4a,0x00,0x63,0x02,0x94,0x02,0xf0,0x0c,0x18,0x9c,
+0xc0,0x98,0x58,0x08,0x80,0x28,0x58,0x8c,0xc0,0x98,0x99,0x08,0x80,0x54,0x68,0x08,
+0x80,0x87,0x59,0x8c,0xc0,0x52,0x08,0x00,0x70,0xcc,0x03,0xf0,0x0e,0x08,0x32,0xc8,
+0xa0,0x98,0x69,0x97,0x30,0x39,0x40,0x8b,0x30,0x99,0xa8,0x61,0x73,0x44,0x50,0x07,
+0x10,0x87,0x52,0x86,0x00,0x21,0x00,0x02,0x60,0x03,0x9f,0x01,0xf1,0x0c,0x19,0xa8,
+0xd0,0x54,0x80,0xa6,0x60,0x9c,0x10,0x9d,0x20,0x78,0xa6,0x35,0x62,0x43,0x55,0x9c,
+0x80,0x87,0x70,0x08,0x00,0x86,0x28,0x9c,0x83,0x35,0x0b,0xf6,0x10,0x00,0x41,0x00,
+0x08,0x37,0xab,0x82,0x66,0x70,0xa1,0x40,0x6b,0x27,0x97,0xc0,0x37,0x95,0x64,0x42,
+0x66,0x72,0x78,0x00,0x76,0x65,0x48,0x03,0x75,0x3a,0x07,0x94,0x8c,0x05,0xf2,0x0f,
+0x08,0x00,0x27,0x19,0x48,0x41,0xa7,0x59,0x59,0x60,0x38,0x39,0x8f,0x92,0x87,0x79,
+0x6b,0x80,0x55,0x79,0x58,0x11,0x76,0x69,0x00,0x00,0x75,0x0a,0x88,0x84,0xdc,0x06,
+0xf4,0x0f,0x08,0x00,0x16,0x37,0x8c,0x72,0xa7,0x55,0x8a,0x80,0x2a,0x48,0x77,0x83,
+0x96,0x85,0x11,0x33,0x32,0x40,0x86,0x20,0x77,0x71,0x86,0x24,0x64,0x2a,0x15,0x95,
+0x4c,0x00,0xf0,0x0e,0x7d,0xd8,0xc8,0x90,0x76,0x74,0x4c,0x10,0x56,0x97,0x84,0x90,
+0x05,0xc9,0x71,0x00,0x18,0xc9,0x6a,0x50,0x14,0x39,0x17,0x20,0x35,0x3a,0x02,0x70,
+0x01,0x6c,0x00,0xf0,0x4c,0x12,0x77,0xa0,0x87,0x81,0x55,0x90,0x2a,0x47,0x8b,0x83,
+0x9b,0xb5,0x58,0x71,0x42,0x50,0x7e,0x50,0x77,0x78,0x78,0xa2,0x64,0x01,0x47,0x01,
+0x05,0x00,0x15,0x00,0x08,0x37,0x88,0xa0,0x88,0x68,0x77,0xc0,0x29,0x47,0x68,0xb0,
+0x88,0xa6,0x6a,0x70,0x44,0x51,0x8c,0x60,0x77,0x59,0x29,0x90,0x54,0x13,0x67,0x22,
+0x05,0x00,0x05,0x00,0x08,0x38,0x78,0xa0,0x67,0x69,0x55,0xa0,0x3a,0x39,0x22,0x20,
+0x79,0xac,0x8b,0xa4,0x44,0x5c,0x9b,0xb4,0x87,0x6b,0x37,0x64,0x53,0x27,0x33,0x73,
+0x80,0x00,0xf4,0x01,0x0b,0x8c,0x9b,0xa5,0x1a,0xab,0xda,0xa5,0x01,0x79,0x86,0x50,
+0x03,0x85,0x55,0x90,0x04,0x00,0xf1,0x29,0x29,0x97,0x77,0xc5,0x0b,0x6b,0x8a,0x95,
+0x06,0x69,0x86,0x73,0x03,0x7a,0x9b,0x80,0x27,0x8d,0xc8,0x75,0x29,0xd7,0x77,0xc0,
+0x00,0x96,0x66,0xb0,0x00,0x97,0x77,0xb0,0x00,0x07,0x20,0x41,0x04,0x8b,0x9b,0x80,
+0x18,0x8b,0x9e,0x85,0x00,0x19,0x71,0x10,0x18,0xaa,0x66,0x50,0x12,0x59,0x88,0x60,
+0x59,0x05,0x33,0x02,0x8a,0x10,0x1e,0x0c,0xf5,0x2e,0x50,0x08,0x8c,0x8a,0x40,0x00,
+0x08,0x56,0x00,0x68,0xae,0x98,0x82,0x29,0xd9,0x78,0x30,0x42,0xb7,0x79,0x50,0x01,
+0x70,0x04,0x50,0x01,0xc8,0x8a,0x50,0x00,0x80,0x91,0x30,0x27,0xc0,0xa7,0x30,0x36,
+0xb0,0x76,0x90,0x04,0x77,0x77,0x00,0x09,0x44,0x4a,0x00,0x09,0x33,0x3a,0x00,0x09,
+0x66,0x6b,0x00,0x09,0x00,0x3b,0x00,0x4c,0x08,0xf2,0x1c,0x51,0x62,0x10,0x1a,0x19,
+0x69,0x81,0x27,0x67,0x72,0x04,0x0b,0x79,0x39,0x85,0x0b,0x5a,0x31,0x11,0x0c,0x7b,
+0x68,0x61,0x08,0x09,0x62,0x07,0x08,0x58,0x49,0x87,0x00,0x42,0x00,0x68,0xc9,0x87,
+0x90,0x00,0x09,0xa8,0x88,0x8b,0x06,0x00,0x02,0x09,0x00,0xf0,0x29,0x00,0x42,0x00,
+0x09,0x88,0x88,0x80,0x97,0x77,0x79,0x09,0x00,0x00,0x90,0x98,0xc9,0x87,0x09,0x01,
+0x88,0x60,0xa3,0x73,0xa5,0x08,0x51,0x00,0x43,0x00,0x44,0x00,0x00,0x00,0x2a,0x79,
+0xa0,0x00,0x4e,0x98,0xd9,0x81,0x02,0x90,0x09,0x05,0x30,0x09,0x99,0xd9,0xb3,0x00,
+0x90,0x00,0x01,0x20,0x09,0xe2,0x01,0xf5,0x2a,0x49,0x88,0x89,0x80,0x00,0x90,0x08,
+0x00,0x68,0xc8,0x8c,0xb3,0x38,0x98,0x8c,0xa3,0x47,0x78,0x49,0x50,0x59,0x78,0x59,
+0x80,0x67,0x77,0x6a,0x20,0x84,0x79,0x8b,0x43,0x70,0x00,0x80,0xa4,0x01,0x20,0x00,
+0x00,0x28,0x05,0x88,0x82,0x41,0x70,0x00,0x00,0x0b,0x19,0x9b,0xb4,0x9b,0x00,0x05,
+0x40,0x09,0x04,0x00,0xf4,0x13,0x6a,0x10,0x04,0x02,0x41,0x00,0x46,0x5b,0x44,0x84,
+0x36,0x6b,0x74,0x00,0x3b,0x8b,0x89,0xc5,0x58,0x8b,0x86,0x80,0x08,0x4b,0x62,0x80,
+0x08,0x6c,0x96,0x80,0x08,0x00,0x14,0xa0,0x42,0x0d,0xf1,0x4c,0x28,0x8c,0x88,0x70,
+0x07,0x7c,0x87,0x40,0x58,0x8c,0x98,0x81,0x01,0x93,0x81,0x70,0x79,0x70,0x5b,0x10,
+0x03,0xa8,0x35,0xa2,0x03,0x50,0x00,0x11,0x00,0x05,0x20,0x00,0x57,0x78,0x87,0x71,
+0x06,0x77,0x79,0x30,0x5c,0x76,0x69,0x92,0x05,0x8a,0xa8,0x30,0x05,0xb1,0x77,0x70,
+0x63,0xb5,0x69,0x71,0x00,0x73,0x00,0x32,0x20,0x90,0x07,0x00,0x36,0x98,0x8c,0x81,
+0x27,0x90,0x07,0x00,0x30,0x78,0x87,0x70,0x67,0x7a,0xa7,0x72,0x03,0x94,0x84,0x60,
+0x55,0xa4,0x5a,0x50,0x03,0x63,0x00,0x91,0x0e,0xf1,0x30,0x35,0x80,0x00,0x80,0x89,
+0xc8,0x35,0x80,0x59,0xd9,0x35,0x80,0x41,0x89,0x04,0x80,0x57,0x7b,0x97,0x72,0x15,
+0x83,0x85,0x60,0x46,0x97,0x29,0x61,0x02,0x30,0x00,0x21,0x05,0x01,0x40,0x00,0x38,
+0x48,0x87,0x73,0x35,0x9d,0x66,0xa0,0x09,0x79,0x66,0xb0,0x6d,0x94,0xc7,0x70,0x38,
+0x37,0xb8,0xb0,0x08,0x14,0xab,0x10,0x08,0x29,0x64,0xf8,0x02,0xf0,0x19,0x58,0xc9,
+0xc8,0x81,0x3a,0xb8,0xc7,0xb0,0x39,0xa8,0xa6,0x90,0x68,0xba,0x88,0x82,0x04,0x90,
+0x56,0x00,0x04,0xad,0xb7,0x30,0x45,0x20,0x01,0x50,0x09,0x88,0x89,0x60,0x09,0x77,
+0x79,0x60,0x09,0x77,0x78,0x60,0x0c,0x00,0x00,0x8f,0x0b,0x84,0x01,0x90,0x90,0x07,
+0x59,0x10,0x69,0x95,0xe8,0x09,0xf0,0x11,0x19,0x36,0x98,0xc0,0x2a,0x47,0x87,0xc0,
+0x6c,0x88,0x87,0xb0,0x0a,0x06,0x98,0xc0,0x09,0x80,0x88,0x00,0x36,0x53,0x78,0x01,
+0x80,0x19,0x06,0x94,0x00,0x00,0x00,0x00,0xf0,0x16,0x00,0x20,0x00,0x00,0x00,0x29,
 0x38,0x77,0xc0,0x03,0x4a,0x87,0x7c,0x00,0x09,0x48,0x77,0xc0,0x0a,0xc9,0x88,0x8c,
-0x00,0x19,0x00,0x88,0x00,0x00,0x90,0x35,0x80,0x40,0x09,0x28,0x06,0x95,0x45,0x45,
-0xf4,0x0d,0x08,0x96,0x5c,0x89,0x2c,0xb8,0x18,0x18,0x3c,0xbb,0x63,0xa4,0x08,0x67,
-0x86,0xb5,0x0b,0xbb,0x78,0xc7,0x24,0x67,0x00,0x80,0x60,0x29,0x00,0x80,0xcd,0x0b,
-0xf0,0x05,0x28,0x88,0xb8,0x86,0x01,0x77,0x77,0x40,0x00,0x33,0x33,0x20,0x00,0x44,
-0x44,0x20,0x03,0xa8,0x88,0x90,0x8e,0x12,0x31,0x03,0xa7,0x77,0x79,0x01,0x00,0xa3,
-0x2f,0xf2,0x03,0x38,0xa8,0x09,0x00,0x05,0x53,0x09,0x00,0x06,0x64,0x9d,0x95,0x04,
-0x42,0x09,0x00,0x0b,0x78,0x04,0x00,0x00,0xb1,0x06,0x00,0x31,0x04,0xf0,0x0e,0x6b,
-0x85,0x88,0xc0,0x25,0x50,0x00,0x90,0x35,0x52,0x98,0xc0,0x24,0x44,0x50,0x30,0x88,
-0xb3,0x50,0x01,0x88,0xb3,0x50,0x26,0x80,0x01,0xa8,0xa2,0x02,0x7d,0x08,0xf4,0x0c,
-0x21,0xc9,0x80,0x5a,0x98,0x50,0xb3,0x25,0x48,0x44,0x40,0x13,0x39,0x96,0xc0,0x78,
-0xb0,0x96,0x60,0x78,0xb4,0xbb,0x82,0x70,0x0d,0x40,0x98,0x02,0x25,0xf1,0x2d,0x39,
-0x46,0x8d,0x83,0x48,0x72,0x19,0x00,0x24,0x35,0x2b,0x93,0x24,0x35,0x29,0x00,0x68,
-0xa5,0x29,0x00,0x68,0xaa,0x8c,0x73,0x61,0x01,0x11,0x10,0x07,0x00,0x06,0x00,0x6a,
-0x77,0xab,0x83,0x37,0x60,0x90,0x30,0x24,0x46,0xcb,0x10,0x24,0x30,0x74,0x80,0x78,
-0xa6,0x28,0x40,0x78,0xb5,0xd7,0x90,0x70,0x2d,0x30,0x63,0x09,0x06,0xf0,0x0c,0x02,
+0x00,0x19,0x00,0x88,0x00,0x00,0x90,0x35,0x80,0x40,0x09,0x28,0x06,0x95,0x00,0x01,
+0x00,0xf1,0x11,0x02,0x00,0x00,0x00,0x08,0x96,0x5c,0x89,0x2c,0xb8,0x18,0x18,0x3c,
+0xbb,0x63,0xa4,0x08,0x67,0x86,0xb5,0x0b,0xbb,0x78,0xc7,0x24,0x67,0x00,0x80,0x60,
+0x29,0x00,0x80,0x25,0x00,0xf1,0x10,0x03,0x50,0x00,0x28,0x88,0xb8,0x86,0x01,0x77,
+0x77,0x40,0x00,0x33,0x33,0x20,0x00,0x44,0x44,0x20,0x03,0xa8,0x88,0x90,0x03,0x50,
+0x00,0x90,0x03,0xa7,0x77,0xa0,0x23,0x00,0xf2,0x06,0x60,0x09,0x00,0x38,0xa8,0x09,
+0x00,0x05,0x53,0x09,0x00,0x06,0x64,0x9d,0x95,0x04,0x42,0x09,0x00,0x0b,0x78,0x04,
+0x00,0xf0,0x15,0x08,0x00,0x09,0x00,0x03,0x00,0x00,0x00,0x6b,0x85,0x88,0xc0,0x25,
+0x50,0x00,0x90,0x35,0x52,0x98,0xc0,0x24,0x44,0x50,0x30,0x88,0xb3,0x50,0x01,0x88,
+0xb3,0x50,0x26,0x80,0x01,0xa8,0xa2,0x88,0x00,0xf0,0x0d,0x18,0x21,0xc9,0x80,0x5a,
+0x98,0x50,0xb3,0x25,0x48,0x44,0x40,0x13,0x39,0x96,0xc0,0x78,0xb0,0x96,0x60,0x78,
+0xb4,0xbb,0x82,0x70,0x0d,0x40,0x98,0x64,0x00,0x00,0x44,0x00,0xf0,0x2d,0x39,0x46,
+0x8d,0x83,0x48,0x72,0x19,0x00,0x24,0x35,0x2b,0x93,0x24,0x35,0x29,0x00,0x68,0xa5,
+0x29,0x00,0x68,0xaa,0x8c,0x73,0x61,0x01,0x11,0x10,0x07,0x00,0x06,0x00,0x6a,0x77,
+0xab,0x83,0x37,0x60,0x90,0x30,0x24,0x46,0xcb,0x10,0x24,0x30,0x74,0x80,0x78,0xa6,
+0x28,0x40,0x78,0xb5,0xd7,0x90,0x70,0x2d,0x30,0x63,0x44,0x00,0xf1,0x10,0x07,0x02,
 0x40,0x80,0x69,0x84,0xb5,0xa1,0x37,0x52,0x3a,0x31,0x24,0x33,0x8c,0x80,0x24,0x30,
-0x1a,0x10,0x78,0xb5,0x6c,0x63,0x78,0xb0,0x09,0x00,0xcb,0x1e,0x10,0x02,0x05,0x08,
-0xf4,0x0c,0x76,0xac,0xa4,0x25,0x46,0x44,0x53,0x26,0x53,0x94,0x90,0x14,0x31,0x33,
+0x1a,0x10,0x78,0xb5,0x6c,0x63,0x78,0xb0,0x09,0x00,0x70,0x00,0x09,0x10,0x01,0xf4,
+0x0d,0x5c,0x76,0xac,0xa4,0x25,0x46,0x44,0x53,0x26,0x53,0x94,0x90,0x14,0x31,0x33,
 0x00,0x78,0xa6,0x86,0x71,0x78,0xb7,0x80,0x86,0x70,0x00,0x98,0x60,0x34,0x01,0xf1,
 0x0d,0x28,0x26,0xc8,0x72,0x59,0x83,0xb5,0x90,0x24,0x35,0xb5,0xb2,0x24,0x34,0x44,
-0x41,0x87,0xb8,0x77,0xb0,0x87,0x98,0x77,0xc0,0x80,0x08,0x00,0x90,0x64,0x00,0xf6,
-0x0a,0x83,0xa6,0x90,0x37,0x68,0x33,0xa1,0x24,0x38,0x00,0x81,0x24,0x35,0xdd,0xa0,
-0x78,0xb0,0x88,0x00,0x78,0xb6,0x58,0x06,0x70,0x1c,0xf9,0x04,0xf2,0x11,0x08,0x02,
-0x3a,0x31,0x59,0x84,0x5b,0x53,0x25,0x44,0x99,0x92,0x26,0x57,0x77,0x76,0x3a,0x85,
-0x10,0x05,0x59,0xa0,0x83,0x40,0x59,0xa2,0xa3,0x57,0x52,0x0c,0x22,0xa6,0xb9,0x06,
-0xf5,0x2f,0x19,0x00,0x39,0x71,0xa6,0x70,0x17,0x7b,0x98,0xa9,0x14,0x33,0x55,0x52,
-0x14,0x38,0x97,0x67,0x49,0xa9,0xa8,0x87,0x49,0xa7,0x64,0x37,0x43,0x07,0x63,0x65,
-0x07,0x01,0x83,0x81,0x29,0x79,0x78,0x78,0x07,0x5b,0xa9,0xb6,0x04,0x35,0x64,0x82,
-0x04,0x38,0x17,0x96,0x1a,0x99,0x67,0xb0,0x1a,0x99,0x5b,0xb6,0x15,0x00,0x08,0x39,
-0x6c,0x00,0xf0,0x20,0x52,0x36,0x00,0x4a,0x65,0xb7,0x91,0x87,0x68,0x2c,0x80,0x26,
-0x79,0x73,0x54,0x38,0xaa,0xaa,0x82,0x03,0x66,0x66,0x30,0x08,0x55,0x55,0x80,0x09,
-0x55,0x55,0x90,0x00,0x34,0x80,0x00,0x09,0xbb,0xd9,0xc0,0x0a,0xb8,0xc7,0x72,0x3c,
-0x98,0x98,0xb0,0x14,0x00,0x00,0x04,0x00,0x80,0x05,0xc6,0x8c,0x60,0x25,0x00,0x00,
-0x62,0xc5,0x03,0xf1,0x0f,0x78,0xc0,0x09,0x00,0x77,0xc0,0x0d,0x84,0x76,0xb0,0x09,
-0x00,0x71,0x95,0x99,0xb0,0x48,0x96,0x20,0x80,0x84,0x97,0x98,0xc0,0x80,0x06,0x30,
-0x80,0x00,0x01,0x11,0x09,0x01,0x08,0x00,0xf1,0x04,0x19,0x9d,0x9c,0x96,0x04,0x29,
-0x08,0x70,0x0a,0x27,0x08,0x45,0x23,0x83,0x08,0x06,0x04,0x70,0x96,0x28,0x09,0xf1,
-0x0d,0x38,0xc6,0x68,0xc0,0x13,0x92,0x00,0x90,0x36,0xb6,0xa8,0x80,0x35,0xb6,0x80,
-0x13,0x47,0x80,0x78,0x93,0x6a,0x90,0x00,0x00,0x80,0x88,0x99,0x94,0xe2,0x04,0x00,
-0x74,0x0d,0xf0,0x07,0x8c,0x78,0xd8,0xa0,0x25,0xb5,0x65,0x58,0x01,0x49,0x28,0x79,
-0x40,0x17,0xb8,0xa0,0x09,0x02,0xc8,0x0b,0x77,0x90,0xed,0x2a,0x42,0x07,0x07,0xa9,
-0x99,0x90,0x02,0xf2,0x09,0x78,0xc3,0xb9,0x94,0x78,0xc3,0xb8,0x70,0x06,0x13,0x50,
-0x90,0x76,0xa7,0x50,0x90,0x76,0x13,0xa7,0x60,0xa9,0x75,0xa8,0x85,0x5e,0x1b,0xf2,
-0x0f,0x08,0x00,0x39,0xd8,0x09,0x00,0x18,0xb7,0xac,0x87,0x29,0xa9,0x78,0x07,0x29,
-0xb9,0xac,0x87,0x26,0xb6,0x78,0x07,0x01,0x91,0xac,0x87,0x00,0x80,0x70,0x07,0x42,
-0x03,0xf4,0x0f,0x17,0x00,0x7c,0x97,0x8b,0x82,0x6b,0x81,0x70,0x60,0x8a,0xa9,0x50,
-0x93,0x79,0x82,0x86,0x40,0x3a,0x50,0x2c,0x00,0x6c,0x72,0x99,0x40,0x08,0x08,0x20,
-0x64,0x66,0x03,0xf3,0x10,0x48,0x5a,0x79,0xa3,0x58,0x66,0x7c,0x91,0x8b,0xb8,0x6b,
-0xa0,0x45,0x67,0x6b,0xb0,0x54,0x83,0x6b,0x60,0x85,0x77,0x8c,0x82,0x60,0x00,0x08,
-0x00,0x22,0x02,0x10,0x4b,0x1f,0xf0,0x1a,0xa5,0x00,0x69,0x00,0x99,0x00,0x09,0x08,
-0x36,0x30,0x09,0x56,0x00,0xa3,0x39,0x82,0x00,0x11,0x40,0x06,0x78,0x73,0x21,0x00,
-0x51,0x00,0x1a,0x0b,0x97,0x90,0x00,0x0b,0x44,0x90,0x6c,0x0a,0x33,0x20,0x09,0x0c,
-0x88,0xca,0x1e,0x91,0x80,0x0a,0x27,0x77,0x70,0x61,0x58,0x88,0xb7,0xa2,0x28,0xf4,
-0x10,0x03,0x00,0x30,0x0a,0x06,0x17,0x30,0x01,0x28,0xc9,0x80,0x4b,0x48,0xc9,0x82,
-0x09,0x00,0xb7,0x00,0x09,0x08,0x34,0x70,0x2b,0x72,0x00,0x20,0x80,0x69,0x99,0xa5,
-0xbd,0x01,0xf2,0x0d,0x37,0x08,0xb9,0x90,0x03,0x17,0x9d,0x70,0x59,0x1b,0x7b,0xb0,
-0x09,0x1b,0x5a,0xb0,0x09,0x19,0x29,0x90,0x1a,0x53,0x04,0x60,0x70,0x48,0x79,0xb4,
-0x29,0x26,0xf1,0x0f,0x90,0x00,0x1a,0x58,0xc8,0x83,0x01,0x38,0xc7,0x90,0x7b,0x43,
-0x90,0x90,0x09,0x29,0xfc,0x70,0x09,0x45,0x92,0x80,0x28,0x50,0x20,0x00,0x70,0x38,
-0x88,0xa5,0x56,0x08,0xf5,0x0c,0x3a,0x77,0x78,0x02,0x49,0xa5,0xb3,0x5c,0x38,0x7b,
-0x73,0x09,0x55,0x6c,0x62,0x09,0x95,0x6c,0x63,0x0a,0x60,0x05,0x00,0x71,0x48,0x89,
-0xb6,0x25,0x02,0xf0,0x0e,0x1a,0xe9,0x90,0x00,0x08,0x24,0x80,0x5c,0x39,0x77,0xa3,
-0x09,0x34,0xaa,0x43,0x09,0x34,0xa8,0x43,0x1b,0x62,0x00,0x70,0x80,0x59,0x88,0xa8,
-0x00,0x00,0x25,0x2b,0xf2,0x0d,0x41,0x00,0x1a,0x4a,0x9a,0xa3,0x00,0x29,0xaa,0x92,
-0x58,0x37,0x88,0x73,0x08,0x35,0x99,0x53,0x08,0x35,0xa8,0x63,0x2a,0x93,0x00,0x61,
-0x40,0x17,0xaa,0x07,0xf4,0x0d,0x28,0x8d,0xac,0xc7,0x01,0x65,0x79,0x56,0x49,0x2a,
-0x58,0x82,0x09,0x19,0x38,0x51,0x09,0x5b,0xab,0xa5,0x0a,0x74,0x00,0x53,0x72,0x37,
-0x88,0x99,0x9a,0x1e,0xf2,0x0c,0x09,0xa9,0x5a,0x99,0x06,0x28,0x18,0x62,0x28,0x9a,
-0x68,0x81,0x07,0x88,0x38,0x07,0x08,0x02,0x68,0x48,0x0b,0x89,0x68,0x40,0x08,0x02,
-0x68,0x6e,0x17,0xf0,0x08,0xcb,0xbb,0xb0,0x03,0x76,0x66,0x70,0x29,0xaa,0xaa,0xa5,
-0x07,0x77,0xb6,0xc0,0x04,0x66,0xa5,0x80,0x04,0x67,0xb6,0x61,0xd7,0x18,0x00,0x7d,
-0x03,0xf0,0x29,0x2b,0x83,0x77,0xb0,0x98,0x73,0x77,0xb0,0x5b,0x86,0x6b,0x63,0x27,
-0x43,0x7a,0x91,0x58,0x60,0x7e,0x40,0x19,0x8a,0x58,0x93,0x67,0x21,0x57,0x01,0x04,
-0xa7,0x77,0x60,0x04,0xa7,0x77,0x40,0x04,0xa6,0x66,0x30,0x6b,0xaa,0xa8,0xa2,0x06,
-0x30,0x97,0x60,0x07,0x67,0x5a,0x60,0x05,0x41,0x00,0x33,0x82,0x1a,0xf1,0x1d,0x0b,
-0x5a,0x67,0x59,0x0b,0x87,0x48,0x79,0x08,0x4b,0x88,0x19,0x08,0x7c,0xaa,0x39,0x08,
-0x16,0x34,0x09,0x08,0x70,0x35,0x96,0x0f,0xed,0x6e,0xe9,0x0a,0x39,0x64,0x39,0x0b,
-0x44,0x25,0x59,0x08,0x49,0x79,0x09,0x08,0x49,0x69,0x09,0xa6,0x1a,0x30,0x11,0x02,
-0x96,0x7b,0x04,0xf1,0x0d,0x88,0x90,0x7a,0x20,0x84,0x49,0x30,0x85,0x84,0x32,0x7c,
-0x70,0x80,0x97,0x7c,0x74,0x85,0x45,0x19,0x60,0x80,0x19,0x09,0x46,0x80,0x21,0x77,
-0x03,0x15,0x04,0xf0,0x4c,0x42,0x40,0x00,0x1c,0x88,0xb7,0x70,0x8c,0x68,0xa6,0x50,
-0x0a,0x68,0xa6,0x50,0x0b,0xab,0xca,0xa3,0x58,0x8d,0xc7,0x72,0x05,0xa8,0x69,0x20,
-0x86,0x06,0x20,0x64,0x00,0x20,0x03,0x10,0x47,0x97,0x54,0x70,0x37,0xa8,0xc8,0xb4,
-0x3b,0x89,0xa7,0xb3,0x37,0xb7,0x80,0x80,0x77,0x77,0x87,0xb3,0x73,0x39,0x88,0xc5,
-0x70,0x19,0x70,0x00,0x2a,0xad,0xaa,0x80,0x85,0x8a,0x58,0x83,0x16,0x89,0x48,0x40,
-0x09,0x6d,0x66,0x80,0x0a,0x6b,0x66,0x90,0x0a,0x6c,0x66,0x46,0x00,0x06,0x77,0x84,
-0x8d,0x02,0x70,0x17,0x7c,0x87,0x60,0x06,0x7b,0x77,0x4a,0x1c,0x82,0x72,0x09,0x77,
-0x7a,0x30,0x09,0x66,0x6a,0x04,0x00,0xc0,0x00,0x4a,0x10,0x00,0x09,0x09,0x00,0x19,
-0x99,0x0d,0x98,0x00,0xd4,0x22,0x30,0x99,0x0d,0x96,0x08,0x00,0x40,0x39,0x99,0x0d,
+0x41,0x87,0xb8,0x77,0xb0,0x87,0x98,0x77,0xc0,0x80,0x08,0x00,0x90,0x64,0x00,0xf3,
+0x0d,0x83,0xa6,0x90,0x37,0x68,0x33,0xa1,0x24,0x38,0x00,0x81,0x24,0x35,0xdd,0xa0,
+0x78,0xb0,0x88,0x00,0x78,0xb6,0x58,0x06,0x70,0x1c,0x07,0x94,0x00,0x01,0x00,0xf1,
+0x11,0x08,0x02,0x3a,0x31,0x59,0x84,0x5b,0x53,0x25,0x44,0x99,0x92,0x26,0x57,0x77,
+0x76,0x3a,0x85,0x10,0x05,0x59,0xa0,0x83,0x40,0x59,0xa2,0xa3,0x57,0x52,0x0c,0x22,
+0xa6,0xb0,0x00,0xf5,0x30,0x00,0x19,0x00,0x39,0x71,0xa6,0x70,0x17,0x7b,0x98,0xa9,
+0x14,0x33,0x55,0x52,0x14,0x38,0x97,0x67,0x49,0xa9,0xa8,0x87,0x49,0xa7,0x64,0x37,
+0x43,0x07,0x63,0x65,0x07,0x01,0x83,0x81,0x29,0x79,0x78,0x78,0x07,0x5b,0xa9,0xb6,
+0x04,0x35,0x64,0x82,0x04,0x38,0x17,0x96,0x1a,0x99,0x67,0xb0,0x1a,0x99,0x5b,0xb6,
+0x15,0x00,0x08,0x39,0x6c,0x00,0xf0,0x20,0x52,0x36,0x00,0x4a,0x65,0xb7,0x91,0x87,
+0x68,0x2c,0x80,0x26,0x79,0x73,0x54,0x38,0xaa,0xaa,0x82,0x03,0x66,0x66,0x30,0x08,
+0x55,0x55,0x80,0x09,0x55,0x55,0x90,0x00,0x34,0x80,0x00,0x09,0xbb,0xd9,0xc0,0x0a,
+0xb8,0xc7,0x72,0x3c,0x98,0x98,0xb0,0x14,0x00,0x00,0x04,0x00,0xf1,0x20,0x05,0xc6,
+0x8c,0x60,0x25,0x00,0x00,0x62,0x00,0x00,0x09,0x00,0x78,0xc0,0x09,0x00,0x77,0xc0,
+0x0d,0x84,0x76,0xb0,0x09,0x00,0x71,0x95,0x99,0xb0,0x48,0x96,0x20,0x80,0x84,0x97,
+0x98,0xc0,0x80,0x06,0x30,0x80,0x00,0x01,0x80,0x00,0x04,0x99,0xc9,0x08,0x00,0xf0,
+0x05,0x19,0x9d,0x9c,0x96,0x04,0x29,0x08,0x70,0x0a,0x27,0x08,0x45,0x23,0x83,0x08,
+0x06,0x04,0x70,0x96,0x00,0x4a,0x02,0xf1,0x10,0x38,0xc6,0x68,0xc0,0x13,0x92,0x00,
+0x90,0x36,0xb6,0xa8,0x80,0x35,0xb6,0x80,0x13,0x47,0x80,0x78,0x93,0x6a,0x90,0x00,
+0x00,0x80,0x88,0x99,0x94,0x10,0x00,0x00,0x24,0x00,0xf2,0x10,0x01,0x8c,0x78,0xd8,
+0xa0,0x25,0xb5,0x65,0x58,0x01,0x49,0x28,0x79,0x40,0x17,0xb8,0xa0,0x09,0x02,0xc8,
+0x0b,0x77,0x90,0x48,0xb0,0x00,0x00,0x07,0x07,0xa9,0x99,0x90,0x02,0xf1,0x0a,0x78,
+0xc3,0xb9,0x94,0x78,0xc3,0xb8,0x70,0x06,0x13,0x50,0x90,0x76,0xa7,0x50,0x90,0x76,
+0x13,0xa7,0x60,0xa9,0x75,0xa8,0x85,0x00,0x45,0x00,0xf1,0x0f,0x08,0x00,0x39,0xd8,
+0x09,0x00,0x18,0xb7,0xac,0x87,0x29,0xa9,0x78,0x07,0x29,0xb9,0xac,0x87,0x26,0xb6,
+0x78,0x07,0x01,0x91,0xac,0x87,0x00,0x80,0x70,0x07,0x0d,0x01,0xf2,0x10,0x00,0x17,
+0x00,0x7c,0x97,0x8b,0x82,0x6b,0x81,0x70,0x60,0x8a,0xa9,0x50,0x93,0x79,0x82,0x86,
+0x40,0x3a,0x50,0x2c,0x00,0x6c,0x72,0x99,0x40,0x08,0x08,0x20,0x64,0x24,0x00,0xf0,
+0x4f,0x00,0x00,0x48,0x5a,0x79,0xa3,0x58,0x66,0x7c,0x91,0x8b,0xb8,0x6b,0xa0,0x45,
+0x67,0x6b,0xb0,0x54,0x83,0x6b,0x60,0x85,0x77,0x8c,0x82,0x60,0x00,0x08,0x00,0x22,
+0x02,0x10,0x00,0x09,0x00,0x90,0x00,0x00,0x00,0xa5,0x00,0x69,0x00,0x99,0x00,0x09,
+0x08,0x36,0x30,0x09,0x56,0x00,0xa3,0x39,0x82,0x00,0x11,0x40,0x06,0x78,0x73,0x21,
+0x00,0x51,0x00,0x1a,0x0b,0x97,0x90,0x00,0x0b,0x44,0x90,0x6c,0x0a,0x33,0x20,0x09,
+0x0c,0x88,0xc0,0x09,0x09,0x00,0x80,0x0a,0x27,0x77,0x70,0x61,0x58,0x88,0xb7,0x64,
+0x00,0xf4,0x11,0x11,0x03,0x00,0x30,0x0a,0x06,0x17,0x30,0x01,0x28,0xc9,0x80,0x4b,
+0x48,0xc9,0x82,0x09,0x00,0xb7,0x00,0x09,0x08,0x34,0x70,0x2b,0x72,0x00,0x20,0x80,
+0x69,0x99,0xa5,0xbd,0x01,0xf0,0x0d,0x37,0x08,0xb9,0x90,0x03,0x17,0x9d,0x70,0x59,
+0x1b,0x7b,0xb0,0x09,0x1b,0x5a,0xb0,0x09,0x19,0x29,0x90,0x1a,0x53,0x04,0x60,0x70,
+0x48,0x79,0xb4,0x20,0x00,0xf1,0x10,0x31,0x00,0x90,0x00,0x1a,0x58,0xc8,0x83,0x01,
+0x38,0xc7,0x90,0x7b,0x43,0x90,0x90,0x09,0x29,0xfc,0x70,0x09,0x45,0x92,0x80,0x28,
+0x50,0x20,0x00,0x70,0x38,0x88,0x48,0x00,0xf5,0x0d,0x27,0x3a,0x77,0x78,0x02,0x49,
+0xa5,0xb3,0x5c,0x38,0x7b,0x73,0x09,0x55,0x6c,0x62,0x09,0x95,0x6c,0x63,0x0a,0x60,
+0x05,0x00,0x71,0x48,0x89,0xb6,0x25,0x02,0xf0,0x0c,0x1a,0xe9,0x90,0x00,0x08,0x24,
+0x80,0x5c,0x39,0x77,0xa3,0x09,0x34,0xaa,0x43,0x09,0x34,0xa8,0x43,0x1b,0x62,0x00,
+0x70,0x80,0x59,0x88,0xa8,0x20,0x00,0xf0,0x12,0x21,0x00,0x41,0x00,0x1a,0x4a,0x9a,
+0xa3,0x00,0x29,0xaa,0x92,0x58,0x37,0x88,0x73,0x08,0x35,0x99,0x53,0x08,0x35,0xa8,
+0x63,0x2a,0x93,0x00,0x61,0x40,0x17,0x88,0x84,0x00,0x19,0x03,0xf1,0x0c,0x8d,0xac,
+0xc7,0x01,0x65,0x79,0x56,0x49,0x2a,0x58,0x82,0x09,0x19,0x38,0x51,0x09,0x5b,0xab,
+0xa5,0x0a,0x74,0x00,0x53,0x72,0x37,0x88,0x99,0x65,0x00,0xf1,0x0f,0x30,0x00,0x00,
+0x09,0xa9,0x5a,0x99,0x06,0x28,0x18,0x62,0x28,0x9a,0x68,0x81,0x07,0x88,0x38,0x07,
+0x08,0x02,0x68,0x48,0x0b,0x89,0x68,0x40,0x08,0x02,0x68,0x23,0x00,0xf0,0x0d,0x05,
+0xcb,0xbb,0xb0,0x03,0x76,0x66,0x70,0x29,0xaa,0xaa,0xa5,0x07,0x77,0xb6,0xc0,0x04,
+0x66,0xa5,0x80,0x04,0x67,0xb6,0x61,0x27,0x78,0xb7,0x76,0x7d,0x03,0xf0,0x61,0x2b,
+0x83,0x77,0xb0,0x98,0x73,0x77,0xb0,0x5b,0x86,0x6b,0x63,0x27,0x43,0x7a,0x91,0x58,
+0x60,0x7e,0x40,0x19,0x8a,0x58,0x93,0x67,0x21,0x57,0x01,0x04,0xa7,0x77,0x60,0x04,
+0xa7,0x77,0x40,0x04,0xa6,0x66,0x30,0x6b,0xaa,0xa8,0xa2,0x06,0x30,0x97,0x60,0x07,
+0x67,0x5a,0x60,0x05,0x41,0x00,0x33,0x0c,0x7b,0x68,0x79,0x0b,0x5a,0x67,0x59,0x0b,
+0x87,0x48,0x79,0x08,0x4b,0x88,0x19,0x08,0x7c,0xaa,0x39,0x08,0x16,0x34,0x09,0x08,
+0x70,0x35,0x96,0x0f,0xed,0x6e,0xe9,0x0a,0x39,0x64,0x39,0x0b,0x44,0x25,0x59,0x08,
+0x49,0x79,0x09,0x08,0x49,0x69,0x09,0x08,0x49,0x78,0x09,0x08,0x11,0x02,0x96,0x7b,
+0x04,0xf1,0x0d,0x88,0x90,0x7a,0x20,0x84,0x49,0x30,0x85,0x84,0x32,0x7c,0x70,0x80,
+0x97,0x7c,0x74,0x85,0x45,0x19,0x60,0x80,0x19,0x09,0x46,0x80,0x21,0x77,0x03,0x15,
+0x04,0xf0,0x4c,0x42,0x40,0x00,0x1c,0x88,0xb7,0x70,0x8c,0x68,0xa6,0x50,0x0a,0x68,
+0xa6,0x50,0x0b,0xab,0xca,0xa3,0x58,0x8d,0xc7,0x72,0x05,0xa8,0x69,0x20,0x86,0x06,
+0x20,0x64,0x00,0x20,0x03,0x10,0x47,0x97,0x54,0x70,0x37,0xa8,0xc8,0xb4,0x3b,0x89,
+0xa7,0xb3,0x37,0xb7,0x80,0x80,0x77,0x77,0x87,0xb3,0x73,0x39,0x88,0xc5,0x70,0x19,
+0x70,0x00,0x2a,0xad,0xaa,0x80,0x85,0x8a,0x58,0x83,0x16,0x89,0x48,0x40,0x09,0x6d,
+0x66,0x80,0x0a,0x6b,0x66,0x90,0x0a,0x6c,0x66,0x46,0x00,0x06,0x77,0x84,0x8d,0x02,
+0xf2,0x04,0x17,0x7c,0x87,0x60,0x06,0x7b,0x77,0x30,0x57,0x77,0x77,0x72,0x09,0x77,
+0x7a,0x30,0x09,0x66,0x6a,0x04,0x00,0xb0,0x00,0x4a,0x10,0x00,0x09,0x09,0x00,0x19,
+0x99,0x0d,0x98,0x08,0x00,0x40,0x09,0x99,0x0d,0x96,0x08,0x00,0x40,0x39,0x99,0x0d,
 0x99,0x08,0x00,0x00,0x04,0x00,0xf3,0x2b,0x28,0x8a,0xb8,0x86,0x08,0x8b,0xa9,0x83,
 0x09,0x35,0x08,0x35,0x09,0x3a,0x78,0x35,0x09,0x39,0x68,0x35,0x0c,0xab,0x8c,0xa5,
 0x09,0x00,0x00,0x35,0x00,0x80,0x1a,0x10,0x29,0xc6,0x7c,0x85,0x19,0xb7,0x89,0x88,
 0x1a,0x69,0xb6,0x69,0x1a,0x79,0x66,0xa5,0x26,0xb5,0xb7,0xc7,0x13,0xa2,0xa7,0xc6,
-0x00,0x80,0x01,0x06,0x00,0x23,0x19,0xf1,0x0b,0xa8,0x8c,0x70,0x00,0x90,0x28,0x00,
-0x68,0x88,0x88,0x82,0x07,0x77,0x79,0x30,0x09,0x77,0x7a,0x40,0x09,0x00,0x04,0x40,
-0x09,0x88,0x8a,0xb4,0x27,0xc4,0x76,0x73,0x8c,0x81,0x76,0x70,0xa8,0xa0,0x76,0x70,
-0xb6,0xb0,0x04,0x00,0x84,0x82,0x70,0x82,0x60,0x60,0x69,0x50,0x72,0x60,0x02,0xf2,
-0x0c,0x2a,0x78,0x7b,0x72,0x2a,0x77,0x96,0xb0,0x27,0x74,0xa7,0xc0,0x37,0xa4,0xa7,
-0xc0,0x17,0xb6,0x76,0x80,0x4b,0x72,0x80,0x82,0x71,0x87,0x77,0xa7,0x13,0xf4,0x0c,
-0x9a,0x8a,0x71,0x29,0x79,0x07,0x73,0x4b,0x9c,0x87,0x95,0x07,0x18,0x19,0x82,0x09,
-0x08,0x09,0xa3,0x0a,0x08,0x05,0x53,0x73,0x08,0x00,0x96,0x88,0x00,0xf3,0x0c,0x58,
-0x89,0x88,0x82,0x07,0x76,0x6a,0x10,0x05,0x76,0x69,0x10,0x68,0x77,0x77,0xb0,0x62,
-0xa7,0x85,0x90,0x62,0xb7,0x74,0x90,0x62,0x10,0x03,0x2e,0x11,0xf0,0x01,0x26,0xbe,
-0x00,0x8d,0xff,0xff,0x00,0xff,0xe9,0x5f,0x00,0xf3,0x00,0x0f,0x00,0xf0,0x04,0x00,
-0xf0,0x07,0x0a,0xff,0xaf,0xf0,0x0a,0xfa,0xaf,0xa0,0x00,0x00,0xbd,0xcc,0xce,0xab,
-0x8b,0x00,0x07,0x58,0xcd,0x66,0x6a,0xac,0x04,0x00,0x00,0x0c,0x00,0x00,0x14,0x00,
-0xf0,0x01,0x34,0x14,0x44,0x43,0xff,0x7f,0xff,0xff,0xab,0x4b,0xbb,0xba,0xbc,0x5c,
-0xcc,0xcb,0x0c,0x00,0x44,0x67,0x17,0x88,0x86,0x14,0x00,0x00,0xd1,0x27,0xf0,0x03,
-0x00,0x00,0x09,0xfa,0xa9,0x00,0x9f,0xa0,0xaf,0x99,0xfa,0x00,0x0a,0xff,0xa0,0x00,
-0x00,0x99,0x60,0x1a,0xf0,0x31,0x72,0xcf,0x4a,0xf4,0x1d,0xff,0x60,0x0a,0xff,0x30,
-0xaf,0x7d,0xf3,0xa6,0x01,0xb3,0x00,0x0c,0x51,0x00,0x1d,0x7d,0x6e,0x70,0x8d,0x0d,
-0x65,0xf1,0xc7,0x0d,0x60,0xe6,0xd7,0x06,0x20,0xe6,0x9d,0x00,0x04,0xf2,0x1e,0xc7,
-0x8f,0x80,0x01,0x9d,0xc6,0x00,0x00,0x0c,0xc0,0x00,0x18,0x8f,0xf8,0x81,0x8f,0xfe,
-0xef,0xf8,0x2f,0xe0,0x0e,0xf2,0x04,0x00,0x00,0x0c,0x00,0x00,0x14,0x00,0x30,0x00,
-0x0c,0xc0,0x23,0x03,0xf4,0x16,0x22,0x00,0x00,0xaf,0xaa,0xa0,0x01,0xda,0x6a,0xfa,
-0x03,0xe8,0xbf,0xb8,0xe3,0xb6,0xdf,0xff,0xd6,0xb0,0x8f,0xfb,0xff,0x80,0x08,0xfc,
-0x0c,0xf8,0x00,0x5b,0x80,0x8b,0x50,0x00,0x0f,0xf0,0x00,0x04,0x00,0xf0,0x17,0x07,
-0xff,0xff,0x70,0x00,0x9f,0xf9,0x00,0x78,0x7a,0xa7,0x87,0xff,0xfb,0xbf,0xff,0xff,
-0xff,0xfb,0xbf,0x05,0xff,0xff,0xf5,0x01,0xe3,0x00,0x03,0xe1,0xa8,0x00,0x00,0x08,
-0xaf,0xff,0x50,0x6f,0xff,0x01,0x00,0x10,0xfd,0x04,0x00,0x00,0x49,0x07,0xf1,0x12,
-0x02,0xbf,0xfb,0x3f,0x2e,0x92,0x18,0xff,0x9a,0x00,0x6c,0xff,0x31,0x00,0x24,0x44,
-0x44,0x42,0x00,0x13,0xff,0xc6,0x00,0xb9,0xfe,0xa5,0x5b,0xd1,0xf2,0x8c,0xc8,0x10,
-0x30,0x98,0x0b,0x20,0x34,0xcf,0x35,0x00,0xf3,0x08,0xab,0xff,0x00,0x4f,0x00,0x01,
-0x00,0x09,0x00,0x34,0xcf,0x01,0xff,0xff,0x1b,0xff,0xff,0x1b,0xbb,0xff,0x01,0x00,
-0x4f,0x66,0x2d,0xf2,0x20,0x54,0x00,0x00,0x90,0x23,0xb3,0x34,0xcf,0x02,0xc3,0xbf,
-0xff,0xf1,0xb5,0x6c,0xff,0xff,0x1b,0x56,0xca,0xbf,0xf0,0x2c,0x3a,0x00,0x4f,0x02,
-0x3b,0x30,0x00,0x10,0x05,0x40,0xdf,0xff,0xff,0xfd,0xf0,0x7f,0xff,0xff,0xf8,0xcf,
-0xb1,0xbf,0xfb,0x5b,0xb4,0x00,0x10,0xdf,0x87,0x00,0xf1,0x10,0xb4,0x00,0x03,0xfb,
-0x00,0x0b,0xff,0x40,0x6f,0xff,0xd0,0xdf,0xff,0xf5,0xf8,0xff,0xf7,0xaa,0x8f,0xf2,
-0x1a,0xfd,0x40,0x40,0x00,0x2f,0x20,0x8f,0xf2,0x9f,0xff,0x7c,0x00,0x70,0x5e,0xff,
-0xf2,0x2d,0xfb,0x10,0x19,0xea,0x18,0xf2,0x0a,0xa1,0x00,0x00,0xff,0xf7,0x00,0x0f,
-0xff,0xfd,0x40,0xff,0xff,0xff,0xaf,0xff,0xff,0xfa,0xff,0xff,0xd4,0x0f,0xff,0x70,
-0x00,0xda,0x1c,0x0b,0xb9,0x9b,0x90,0x9b,0x9f,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,
-0x07,0x00,0xae,0xf2,0x42,0x02,0x42,0x24,0x44,0x44,0x2f,0xff,0xff,0x01,0x00,0xc1,
-0xf8,0xbb,0xbb,0xb8,0x20,0x00,0x4f,0x80,0x2f,0xff,0x92,0xff,0x70,0x00,0x72,0xfe,
-0x5f,0xfd,0x22,0xf9,0x10,0x1b,0x3e,0x09,0xf1,0x1b,0x8f,0x80,0x00,0x00,0x7f,0xff,
-0x70,0x00,0x5f,0xff,0xff,0x50,0x0e,0xff,0xff,0xfe,0x00,0x58,0x88,0x88,0x50,0x0f,
-0xff,0xff,0xff,0x00,0xab,0xbb,0xbb,0xa0,0x00,0x06,0x20,0x07,0xf4,0x07,0xf5,0x05,
-0xf5,0x00,0x2e,0xb0,0x03,0x00,0xf1,0x07,0x60,0x00,0x10,0x26,0x00,0x04,0xf6,0x00,
-0x05,0xf6,0x00,0x06,0xf5,0x00,0xbe,0x20,0xbe,0x10,0x6e,0x10,0x00,0x10,0x25,0x35,
-0xf0,0x01,0x03,0xf3,0x00,0x00,0x4f,0x40,0x07,0x8a,0xfa,0x87,0xef,0xff,0xff,0xe0,
-0x04,0xf4,0x0e,0x00,0x00,0x0e,0x28,0x40,0x78,0x88,0x88,0x7e,0x59,0x00,0xf1,0x0c,
-0x8c,0xcc,0x80,0x01,0xdd,0x16,0x3d,0xd1,0xcf,0x55,0xed,0x5f,0xcb,0xf5,0xdf,0xd5,
-0xfc,0x1d,0xd3,0x73,0xdd,0x10,0x08,0xdc,0xc8,0x10,0x1d,0x89,0x01,0xf0,0x11,0x5e,
-0x8c,0xcc,0xa2,0x00,0x00,0x2d,0xb4,0x49,0xf4,0x00,0x7a,0x1a,0xff,0x3f,0xe1,0x07,
-0xfa,0x06,0xf7,0xff,0x10,0x0a,0xf3,0x03,0xef,0x40,0x00,0x06,0xcc,0x71,0xbb,0x02,
-0x01,0x00,0xf7,0x2b,0x20,0x3e,0x30,0x27,0x16,0x10,0xfc,0x28,0x03,0xf0,0x10,0xfc,
-0xf6,0x00,0x00,0x00,0xed,0x0d,0xe0,0x00,0x00,0x8f,0xe0,0xef,0x80,0x00,0x2f,0xff,
-0x6f,0xff,0x20,0x0b,0xff,0xe2,0xef,0xfa,0x00,0xdf,0xff,0xff,0xff,0xd0,0x21,0x0a,
-0xf0,0x05,0x44,0x00,0x04,0xf5,0xef,0xb1,0xcf,0xfd,0x01,0x8c,0xd1,0xc1,0x01,0xdc,
-0x81,0xc1,0xef,0xc1,0xbf,0xfd,0x14,0x00,0x03,0x3d,0x0a,0xe3,0x00,0x04,0xe4,0x00,
-0x04,0xfc,0xf4,0x04,0xf8,0x08,0xf4,0xb8,0x00,0x08,0x3d,0x2d,0xd2,0x0b,0x80,0x00,
-0x8b,0x4f,0x80,0x8f,0x40,0x4f,0xcf,0x40,0x00,0x4e,0xab,0x2b,0xf2,0x11,0x94,0x14,
-0x44,0x40,0x00,0xbf,0xf8,0xbb,0xbf,0x10,0x08,0xb7,0x60,0x00,0xe1,0x00,0x0b,0x40,
-0x00,0x1e,0x20,0x00,0xb7,0x44,0x5e,0xfd,0x50,0x07,0xbb,0xb8,0x5f,0x80,0x8d,0x0a,
-0x43,0xdf,0xfb,0x00,0x00,0x81,0x02,0x05,0x01,0x00,0x01,0x06,0x02,0x00,0xb4,0x1c,
-0x22,0x9f,0xf9,0xc4,0x02,0x03,0xd0,0x02,0x71,0x78,0x4f,0xf4,0x87,0xff,0xe8,0x8e,
-0xc8,0x02,0x13,0x00,0x22,0x10,0x63,0xea,0x00,0x00,0x00,0xef,0xe0,0xde,0x00,0xf2,
-0x03,0x4f,0x70,0x00,0x00,0x1d,0xe0,0x07,0xdc,0x4d,0xf3,0x00,0xef,0xff,0xe3,0x00,
-0x0a,0xec,0x70,0x1c,0x0a,0xf3,0x1b,0xcd,0xc0,0x2d,0xc0,0xe7,0xf2,0xee,0x20,0x4b,
-0xff,0xe2,0x00,0x04,0xff,0xa0,0x00,0xcd,0xf9,0xf9,0x00,0xe7,0xe0,0x7f,0x90,0x4a,
-0x40,0x04,0x50,0x00,0xff,0xf7,0x47,0x4f,0xff,0x47,0xf8,0xff,0xff,0xff,0x8f,0xff,
-0xff,0x07,0x00,0xf0,0x10,0xfb,0x78,0x88,0x7f,0xff,0xff,0x00,0x24,0x44,0x41,0x0f,
-0xbb,0xbb,0xe2,0xf0,0x00,0x0f,0xdf,0x44,0x44,0xff,0xff,0xfc,0xff,0xff,0xf9,0x09,
-0xff,0xff,0xd5,0xdf,0x20,0x02,0x30,0x01,0x11,0x11,0xf4,0x01,0xf0,0x06,0x01,0x11,
-0x11,0x05,0x55,0x55,0x55,0xcc,0xcc,0xcc,0xc0,0x11,0x11,0x10,0xff,0xff,0xff,0xf0,
-0x11,0x11,0x10,0xc1,0x00,0xf1,0x00,0x9f,0xff,0xff,0xf9,0xb7,0xff,0xff,0x7b,0xfe,
-0x7c,0xc7,0xef,0xff,0xfa,0xaf,0xd5,0x00,0xf1,0x08,0x07,0xff,0x60,0x00,0xaf,0xf2,
-0x00,0x0c,0xff,0x87,0x00,0xef,0xff,0xb0,0x07,0x8e,0xf2,0x00,0x00,0xf8,0x00,0x00,
-0x3e,0x51,0x2d,0xf1,0x1f,0x79,0xb9,0x70,0x0f,0xfc,0xff,0x00,0xff,0x68,0x83,0x0f,
-0xf8,0xff,0x8b,0xff,0x8f,0xf8,0x8f,0xf8,0xff,0xff,0x78,0x8f,0xff,0xf0,0x07,0xff,
-0xff,0x00,0x0d,0x00,0x00,0x4e,0xfe,0x30,0x0d,0xff,0xfd,0x00,0xff,0xff,0xf0,0x3f,
-0xff,0xff,0x3b,0xa3,0x00,0x41,0x88,0x60,0x04,0xf4,0xb7,0x01,0xf4,0x03,0xdf,0x18,
-0x81,0x88,0x1f,0xfe,0xaa,0xca,0xae,0xff,0xea,0xac,0xaa,0xef,0xf1,0x80,0x00,0x81,
-0xd1,0x03,0x01,0x01,0x00,0xf0,0x07,0x4b,0xc0,0x00,0x00,0x5c,0xff,0xb0,0x00,0x6e,
-0xff,0xff,0x40,0x0d,0xff,0xff,0xfc,0x00,0x06,0x88,0xcf,0xf5,0x00,0x02,0x02,0x00,
-0x05,0x00,0x00,0xba,0x0a,0x13,0x5d,0x2a,0x00,0x9b,0xff,0xf8,0xb0,0xff,0xf8,0xfb,
-0xff,0xfc,0x88,0x11,0x03,0xf3,0x0a,0x00,0x04,0x77,0x40,0x00,0x09,0xff,0xcc,0xff,
-0x90,0xcd,0x40,0x00,0x04,0xdc,0x20,0x4b,0xff,0xb4,0x02,0x01,0xfa,0x55,0xaf,0x10,
-0x7e,0x34,0x21,0xee,0x00,0x41,0x2a,0x00,0x31,0x04,0xc0,0x44,0x40,0xfb,0xbb,0xbb,
-0xbb,0xda,0xf7,0xee,0xee,0xee,0x5f,0x4e,0x01,0xb9,0x2f,0xf5,0x66,0x66,0x66,0xab,
-0x8b,0xbb,0xbb,0xbb,0xb3,0x1e,0x00,0x10,0x70,0x1e,0x00,0x10,0x80,0x1e,0x00,0x1e,
-0x54,0x1e,0x00,0xcd,0xe0,0x00,0x5f,0xf8,0xff,0xf0,0x00,0x2f,0xf5,0x66,0x64,0x44,
-0x1e,0x00,0xcc,0xe7,0x00,0x00,0x5f,0xf8,0xf8,0x00,0x00,0x2f,0xf5,0x65,0x44,0x1e,
-0x00,0x60,0xd8,0xf0,0x00,0x00,0x00,0x5f,0x05,0x00,0x61,0x2f,0xf4,0x44,0x44,0x44,
-0xad,0x1e,0x00,0x04,0x2c,0x02,0x10,0xd8,0x05,0x00,0xf0,0x04,0x36,0x40,0x00,0x09,
-0xb1,0x91,0x11,0x17,0x20,0xef,0x88,0xd8,0x88,0xd9,0x02,0x20,0x06,0x48,0x70,0x18,
-0x03,0x14,0xec,0x04,0x0f,0xf3,0x1d,0xdd,0xc3,0x04,0xff,0x3e,0xd0,0x9c,0xb5,0x5f,
-0x2b,0xf7,0x1a,0xf4,0xbf,0x81,0xbf,0x39,0xc9,0x64,0xf2,0x4f,0xf3,0xde,0x00,0x6d,
-0xed,0x30,0x78,0xdf,0xd8,0x77,0x88,0x88,0x87,0x8f,0xff,0xff,0x88,0xcc,0x8c,0xc8,
-0x8c,0xc8,0xcc,0x07,0x00,0x40,0x85,0xff,0xff,0xf5,0x63,0x10,0xe1,0x30,0x00,0x00,
-0x4b,0xfd,0x00,0x00,0x7f,0x9b,0x70,0x00,0x7f,0xff,0x40,0x24,0x04,0x00,0x04,0x00,
-0x65,0x0e,0xff,0x70,0x00,0x00,0xee,0x2b,0x2a,0xd2,0xaf,0xff,0xff,0xfc,0x0b,0xff,
-0x9c,0xc9,0xff,0xaf,0xff,0xc1,0x1c,0x05,0x00,0x01,0x0f,0x00,0x01,0x19,0x00,0xf3,
-0x02,0x07,0xff,0xfe,0x17,0xb6,0x27,0xc3,0xfe,0xb9,0xbe,0x3f,0xff,0xff,0xf3,0xff,
-0xff,0xff,0x07,0x00,0x41,0x3c,0xff,0xff,0xe1,0xe9,0x0c,0xc0,0x23,0x00,0x02,0xf0,
-0x2e,0x92,0x22,0x5f,0x0d,0xff,0xff,0xff,0x09,0x00,0x10,0x21,0xe6,0x2d,0x0a,0x01,
-0x00,0x2f,0xfe,0x00,0x01,0x00,0x56,0x1b,0xf9,0x08,0x00,0x00,0x01,0x00,0x73,0xfd,
-0xfc,0x00,0xff,0xfc,0x00,0xfb,0x5c,0x16,0x0f,0x01,0x00,0x50,0x2f,0x01,0x01,0x6a,
-0x00,0x54,0x2f,0xf5,0x00,0x01,0x00,0x68,0x1f,0xf2,0x71,0x00,0x5d,0x03,0xd4,0x01,
-0xb3,0xfc,0x00,0xff,0x00,0x00,0xf8,0xff,0xfb,0xfc,0x00,0xfa,0x24,0x04,0x00,0xb1,
-0x05,0x2f,0xfd,0xfe,0x74,0x01,0x51,0x10,0xfe,0x6d,0x00,0x1f,0xfd,0xf0,0x00,0x54,
-0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x1f,0xff,0x79,0x00,0x46,0x13,0xfa,0x5e,
-0x00,0x00,0xee,0x00,0x3f,0xff,0xfd,0xff,0xe8,0x01,0x5d,0x05,0xc8,0x01,0x00,0x1b,
-0x0b,0x00,0x07,0x00,0x1f,0xfe,0x83,0x00,0x4a,0x11,0xf1,0x49,0x03,0x15,0xf0,0x77,
-0x00,0x20,0xfe,0xff,0x73,0x00,0x01,0x7e,0x00,0x0f,0xea,0x00,0x51,0x10,0xfe,0x08,
-0x00,0x1f,0xfe,0x61,0x01,0x5a,0x1f,0xff,0x2e,0x04,0x60,0x1b,0xfc,0x08,0x06,0x10,
-0xfe,0x64,0x01,0x00,0x69,0x01,0x1f,0xfc,0x72,0x00,0x45,0x14,0xeb,0x65,0x01,0x97,
-0xfc,0x00,0x00,0xef,0xfd,0xf5,0xf7,0x00,0xf1,0x13,0x06,0x2f,0xf8,0xfa,0xed,0x00,
-0x49,0x00,0xbc,0x07,0x33,0xf7,0x00,0xf4,0xe9,0x00,0x10,0xfe,0x4b,0x02,0x00,0x75,
-0x01,0x0f,0x17,0x06,0x55,0x10,0xfd,0xc4,0x02,0x1f,0xfe,0xe3,0x01,0x5e,0x1f,0xfb,
-0x1d,0x05,0x56,0x11,0xfe,0x80,0x06,0x83,0xf2,0x00,0x00,0xfb,0xfe,0xf1,0xff,0x01,
-0x70,0x07,0xdf,0xf9,0xfa,0x00,0xf9,0xfa,0xfb,0xf9,0x00,0xfa,0xfc,0xfc,0xfb,0xfc,
-0xb2,0x03,0x47,0x66,0xf2,0xfe,0x00,0x00,0xfb,0xff,0x11,0x00,0x62,0xfd,0xfd,0x00,
-0x00,0xfd,0xfe,0x37,0x04,0x2f,0x00,0x01,0x77,0x00,0x46,0x22,0xf8,0xfc,0x5c,0x01,
-0x13,0x01,0x11,0x00,0x23,0xfe,0xfe,0xaa,0x04,0x1f,0x00,0xd8,0x08,0x4b,0x14,0xfd,
-0x6f,0x01,0x15,0x01,0x7b,0x01,0x02,0x94,0x05,0x0f,0xde,0x01,0x48,0xe0,0x01,0xfd,
-0xf3,0xfd,0x00,0x00,0xfa,0xfe,0xfa,0xff,0x01,0xfa,0x01,0x01,0xde,0x01,0x70,0xfb,
-0xfc,0xff,0xfe,0xfc,0xfe,0xfc,0x0a,0x06,0x3f,0xff,0xfe,0x01,0x64,0x02,0x4a,0x09,
-0x8c,0x05,0x14,0xff,0xee,0x00,0x1f,0xfe,0x96,0x05,0x52,0x1f,0xff,0x8f,0x05,0x5a,
-0x0f,0x20,0x06,0x60,0x1f,0xfe,0x77,0x00,0x0b,0x2f,0xff,0xff,0xf1,0x06,0xb7,0x0e,
-0x77,0x00,0x0f,0x94,0x00,0x55,0x1e,0x01,0x10,0x04,0x19,0x01,0x6f,0x00,0x0f,0x2f,
-0x04,0x43,0x0f,0x52,0x07,0x4a,0x0f,0xf1,0x01,0x7e,0x1f,0xf8,0xca,0x02,0x63,0x1d,
-0x01,0x7b,0x00,0x00,0x07,0x06,0x01,0xdf,0x01,0x10,0x03,0x08,0x07,0x0f,0x68,0x01,
-0xbb,0x1b,0x01,0xca,0x0f,0x02,0x15,0x0c,0x1f,0x01,0xd0,0x03,0x51,0x1f,0xf8,0xca,
-0x02,0x77,0x1f,0xff,0x77,0x00,0xcc,0x0f,0xe3,0x00,0x64,0x0f,0x04,0x09,0x18,0x0f,
-0x71,0x08,0x0c,0x0b,0xed,0x03,0x1f,0xfd,0xa4,0x07,0x35,0x1f,0xfc,0x9f,0x0d,0x58,
-0x05,0x6d,0x00,0x21,0xfc,0xfa,0x0a,0x00,0x1e,0xf7,0x25,0x08,0x0e,0x35,0x08,0x03,
-0x1d,0x01,0x3f,0xfd,0xfd,0xfd,0x54,0x01,0x34,0x1f,0xfb,0xcb,0x01,0x6d,0x0f,0x01,
-0x00,0x44,0x2f,0xf7,0xfa,0xe7,0x00,0x06,0x0f,0x91,0x00,0x49,0x23,0xfa,0xfa,0xbb,
-0x39,0x0f,0x5e,0x01,0x54,0x0f,0xca,0x02,0x0d,0x1f,0x05,0xee,0x00,0x52,0x0f,0x1e,
-0x04,0x5d,0x0a,0x5c,0x02,0x1f,0xf7,0x9e,0x04,0x64,0x1e,0xf8,0x2f,0x04,0x0f,0x63,
-0x02,0x41,0x2b,0xf6,0xf3,0xca,0x02,0x02,0x75,0x08,0x1f,0xf7,0x2b,0x04,0x11,0x03,
-0x54,0x07,0x3f,0xf4,0xf7,0xf4,0x41,0x03,0x1f,0x1e,0xf3,0x77,0x08,0x0f,0x74,0x0a,
-0x15,0x13,0xf7,0x07,0x00,0x2f,0xf7,0xf7,0x3f,0x0d,0x53,0x0f,0xfa,0x05,0x47,0x0f,
-0xbd,0x04,0x5d,0x13,0xfa,0x3b,0x53,0x0f,0x38,0x12,0x4c,0x0f,0x98,0x04,0x62,0x00,
-0x28,0x12,0x22,0x00,0xfc,0xf9,0x06,0x00,0xd0,0x01,0x23,0xf8,0xfd,0x63,0x01,0x10,
-0xfa,0xf7,0x00,0x1f,0xfd,0xee,0x00,0x48,0x0f,0xed,0x08,0x62,0x16,0xfb,0xe9,0x07,
-0x00,0xee,0x00,0x20,0xfc,0xfb,0x08,0x00,0x3f,0xff,0x00,0xfa,0x68,0x10,0x51,0x00,
-0x22,0x13,0x2f,0x01,0x01,0xbe,0x02,0x5e,0x0f,0xa6,0x03,0x4d,0x0f,0x6b,0x08,0x83,
-0x02,0xeb,0x04,0x1f,0xfa,0x64,0x02,0x62,0x1f,0xfb,0x66,0x00,0x5c,0x1f,0xfc,0xd5,
-0x08,0x58,0x18,0xfc,0xea,0x07,0x01,0x87,0x00,0x2f,0xfb,0xfd,0x4f,0x02,0x5b,0x1f,
-0xfd,0x16,0x0c,0x58,0x0c,0xdc,0x00,0x0f,0x5a,0x10,0x5e,0x0f,0xb2,0x0a,0x18,0x1f,
-0xfd,0x46,0x0c,0x2e,0x0c,0x39,0x11,0x1f,0xfd,0x7b,0x0d,0x59,0x0f,0x4e,0x13,0x67,
-0x1f,0xfd,0x39,0x0b,0x5a,0x2f,0xf3,0xf3,0xba,0x01,0x0c,0x17,0xfa,0x8d,0x00,0x18,
-0xfb,0x1d,0x00,0x32,0xfd,0x00,0xf4,0x6d,0x03,0x10,0xfd,0x6d,0x0e,0x23,0xf7,0xfa,
-0x04,0x0a,0x2f,0xfb,0xf8,0x87,0x05,0x35,0x00,0xb8,0x1a,0x06,0x5e,0x03,0x00,0x62,
-0x04,0x13,0xfd,0xb7,0x06,0x18,0xfd,0xf4,0x03,0x1f,0xfc,0xc3,0x06,0x18,0x1f,0xfc,
-0xfe,0x05,0x63,0x2f,0xf8,0xf8,0x9c,0x06,0x33,0x1f,0xfc,0x04,0x0d,0x24,0x0f,0x71,
-0x06,0x89,0x1e,0xfc,0x16,0x0c,0x0f,0xf7,0x00,0x23,0x2f,0xf4,0xf6,0x19,0x15,0x12,
-0x26,0xfb,0xfb,0x0a,0x02,0x05,0xaa,0x00,0x26,0xf8,0xfa,0x6e,0x03,0x2f,0xf6,0xfb,
-0x6c,0x01,0x1a,0x2f,0xf7,0xf6,0xdc,0x01,0x1d,0x1e,0x01,0xa1,0x01,0x0f,0xad,0x01,
-0x1f,0x2f,0xf6,0xf4,0xfd,0x01,0x21,0x02,0x86,0x00,0x44,0xf8,0xfb,0xfb,0xfb,0x75,
-0x0a,0x25,0xf7,0xfc,0x8f,0x25,0x0f,0x77,0x00,0x12,0x1f,0xf6,0x61,0x03,0x0e,0x1f,
-0xfd,0x1c,0x00,0x07,0x05,0x05,0x01,0x2f,0xff,0xfa,0xcb,0x05,0x3d,0x0f,0x71,0x08,
-0x42,0x2f,0xf4,0xf4,0x6f,0x03,0x27,0x12,0xfd,0x65,0x01,0x0f,0xdc,0x01,0x22,0x1f,
-0xf7,0xee,0x17,0x27,0x0e,0x53,0x02,0x0f,0x1b,0x0b,0x53,0x06,0xab,0x14,0x0f,0x51,
-0x15,0x50,0x25,0xfd,0xfd,0x32,0x22,0x08,0x5b,0x05,0x1f,0xfa,0xe7,0x11,0x5b,0x00,
-0xbc,0x10,0x1f,0xfc,0xdb,0x12,0x66,0x1f,0xfd,0xce,0x17,0x1b,0x1f,0xff,0xb1,0x0d,
-0x2e,0x1f,0xff,0xf9,0x06,0x47,0x0f,0x19,0x06,0x0e,0x1f,0xfd,0x77,0x00,0x63,0x0f,
-0x1b,0x18,0x58,0x1f,0xfc,0x84,0x00,0x27,0x0f,0x4c,0x05,0x1a,0x1f,0x03,0x77,0x00,
-0x36,0x2f,0xf8,0xfa,0xdc,0x01,0x35,0x1f,0xff,0xca,0x02,0x55,0x0f,0x62,0x15,0x29,
-0x1f,0xfc,0x98,0x16,0x3c,0x0f,0x53,0x02,0x33,0x1f,0xf8,0xed,0x0a,0x14,0x1f,0xfc,
-0x77,0x00,0x3b,0x1f,0xf7,0xee,0x00,0x43,0x0f,0xbc,0x0f,0x29,0x1f,0xfd,0xa3,0x18,
-0x63,0x1f,0xfa,0xda,0x12,0x51,0x1f,0xfd,0x02,0x13,0x57,0x12,0xfd,0xe5,0x0d,0x1f,
-0xfc,0x80,0x00,0x13,0x1f,0xfd,0xe5,0x00,0x4f,0x1f,0x04,0xc5,0x0c,0x63,0x1f,0x04,
-0x78,0x00,0x05,0x1f,0x06,0xd2,0x01,0x7f,0x0f,0x7b,0x0d,0x17,0x1f,0xfd,0x23,0x22,
-0x14,0x1e,0xfc,0x2f,0x06,0x0f,0x2f,0x04,0x29,0x0f,0x19,0x03,0x44,0x0f,0x77,0x00,
-0x39,0x0f,0x2c,0x0f,0x46,0x2f,0x03,0x03,0x1a,0x19,0x36,0x0f,0x74,0x17,0xa2,0x09,
-0xa2,0x0b,0x0f,0x41,0x13,0x17,0x2f,0xf6,0xf6,0xb1,0x01,0x27,0x17,0xf6,0x21,0x12,
-0x0f,0xf2,0x11,0x1c,0x1f,0xfd,0x26,0x02,0x3c,0x1f,0xfd,0x7b,0x0d,0x40,0x0b,0xd9,
-0x21,0x00,0xc4,0x37,0x0f,0x82,0x0a,0x24,0x2f,0xf8,0xfb,0xe0,0x23,0x88,0x1f,0xfc,
-0x3f,0x01,0x0e,0x1f,0xfd,0xe9,0x12,0x63,0x0f,0x8d,0x0c,0x3c,0x1f,0xfc,0xf4,0x03,
-0x09,0x1e,0xff,0x95,0x0f,0x0f,0x04,0x0d,0x42,0x19,0xfd,0x38,0x10,0x17,0xfa,0xd1,
-0x0f,0x2f,0xfd,0xfc,0x69,0x0e,0x2b,0x2e,0xf8,0xf8,0xa1,0x06,0x05,0xc8,0x02,0x28,
-0xfa,0xfa,0x52,0x01,0x44,0xf8,0xfd,0xff,0xff,0x2f,0x04,0x26,0xfc,0xfb,0x32,0x04,
-0x12,0x01,0xd6,0x69,0x21,0x02,0x03,0x0f,0x08,0x2e,0x04,0x05,0x94,0x07,0x03,0x3e,
-0x79,0x00,0x3f,0x79,0x92,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x43,0x79,
-0x11,0x00,0x62,0x76,0x70,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x4a,0x3c,0xff,0x00,
-0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0xcb,
-0x00,0x08,0xf0,0x11,0x29,0x2a,0x2b,0x00,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x00,
-0x33,0x00,0x34,0x35,0x00,0x00,0x36,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x00,0x3d,0x3e,
-0x3f,0x40,0x41,0x42,0x23,0x67,0xf2,0x2a,0x44,0x45,0x46,0x47,0x48,0x00,0x49,0x31,
-0x4a,0x00,0x4b,0x4c,0x00,0x00,0x31,0x4d,0x4e,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,
-0x55,0x56,0x57,0x58,0x59,0x00,0x5a,0x5b,0x5c,0x5d,0x5e,0x5f,0x60,0x61,0x62,0x63,
-0x64,0x2d,0x65,0x66,0x00,0x67,0x68,0x69,0x6a,0x6a,0x6b,0x00,0x6c,0x6d,0x6e,0x00,
-0x6f,0x6c,0x50,0x60,0x71,0x00,0x00,0x2d,0x72,0x73,0x9d,0x66,0x8f,0x75,0x76,0x77,
-0x00,0x78,0x79,0x7a,0x00,0x01,0x00,0xff,0x48,0x02,0x46,0x02,0x20,0x03,0x02,0x41,
-0x02,0x4a,0x06,0x07,0x06,0x08,0x1f,0x00,0x00,0xac,0x71,0x22,0x00,0x0b,0x48,0x68,
-0x12,0x0c,0x61,0x67,0x20,0x0b,0x00,0x8e,0x7b,0x00,0x8d,0x7b,0x01,0xfb,0x67,0x72,
-0x00,0x16,0x00,0x17,0x17,0x17,0x18,0xa8,0x4d,0xe1,0x19,0x19,0x1a,0x19,0x17,0x1b,
-0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x44,0x69,0x1e,0x00,0x01,0x00,0xf1,0x03,
-0x24,0x00,0x25,0x26,0x27,0x28,0x00,0x29,0x00,0x2a,0x2b,0x2c,0x2d,0x00,0x2a,0x2a,
-0x00,0x00,0x4e,0x02,0x30,0x33,0x34,0x35,0x4a,0x02,0xf3,0x01,0x00,0x3a,0x3b,0x3c,
-0x3c,0x3d,0x3e,0x00,0x00,0x3f,0x00,0x00,0x40,0x41,0x00,0x42,0x4e,0x02,0x91,0x49,
-0x4a,0x00,0x4b,0x4b,0x00,0x4c,0x4d,0x00,0x4b,0x02,0x00,0x4c,0x02,0x01,0x4d,0x02,
-0x22,0x55,0x43,0x4e,0x02,0x11,0x55,0x4f,0x02,0x40,0x00,0x00,0x65,0x66,0x4f,0x02,
-0x00,0x16,0x49,0x01,0x50,0x02,0x30,0x70,0x71,0x72,0x76,0x5b,0x6f,0x74,0x75,0x00,
-0x00,0x76,0x77,0x40,0x02,0xff,0x43,0x50,0x00,0x00,0x00,0x00,0x00,
+0x00,0x80,0x01,0x06,0xf0,0x10,0x06,0x00,0x00,0x29,0xa8,0x8c,0x70,0x00,0x90,0x28,
+0x00,0x68,0x88,0x88,0x82,0x07,0x77,0x79,0x30,0x09,0x77,0x7a,0x40,0x09,0x00,0x04,
+0x40,0x09,0x88,0x8a,0x40,0x23,0x00,0xc4,0x76,0x73,0x8c,0x81,0x76,0x70,0xa8,0xa0,
+0x76,0x70,0xb6,0xb0,0x04,0x00,0x84,0x82,0x70,0x82,0x60,0x60,0x69,0x50,0x72,0x60,
+0x02,0xf1,0x0d,0x2a,0x78,0x7b,0x72,0x2a,0x77,0x96,0xb0,0x27,0x74,0xa7,0xc0,0x37,
+0xa4,0xa7,0xc0,0x17,0xb6,0x76,0x80,0x4b,0x72,0x80,0x82,0x71,0x87,0x77,0x83,0x80,
+0x02,0xf4,0x0c,0x9a,0x8a,0x71,0x29,0x79,0x07,0x73,0x4b,0x9c,0x87,0x95,0x07,0x18,
+0x19,0x82,0x09,0x08,0x09,0xa3,0x0a,0x08,0x05,0x53,0x73,0x08,0x00,0x96,0x88,0x00,
+0xf2,0x0d,0x58,0x89,0x88,0x82,0x07,0x76,0x6a,0x10,0x05,0x76,0x69,0x10,0x68,0x77,
+0x77,0xb0,0x62,0xa7,0x85,0x90,0x62,0xb7,0x74,0x90,0x62,0x10,0x03,0x90,0x66,0x00,
+0xf0,0x01,0x26,0xbe,0x00,0x8d,0xff,0xff,0x00,0xff,0xe9,0x5f,0x00,0xf3,0x00,0x0f,
+0x00,0xf0,0x04,0x00,0xf0,0x07,0x0a,0xff,0xaf,0xf0,0x0a,0xfa,0xaf,0xa0,0x00,0x00,
+0xbd,0xcc,0xce,0xab,0x8b,0x00,0x07,0x58,0xcd,0x66,0x6a,0xac,0x04,0x00,0x00,0x0c,
+0x00,0x00,0x14,0x00,0xf0,0x01,0x34,0x14,0x44,0x43,0xff,0x7f,0xff,0xff,0xab,0x4b,
+0xbb,0xba,0xbc,0x5c,0xcc,0xcb,0x0c,0x00,0x44,0x67,0x17,0x88,0x86,0x14,0x00,0xf0,
+0x4b,0x00,0x00,0x00,0x9a,0x00,0x00,0x09,0xfa,0xa9,0x00,0x9f,0xa0,0xaf,0x99,0xfa,
+0x00,0x0a,0xff,0xa0,0x00,0x00,0x99,0x00,0x00,0x63,0x00,0x72,0xcf,0x4a,0xf4,0x1d,
+0xff,0x60,0x0a,0xff,0x30,0xaf,0x7d,0xf3,0xa6,0x01,0xb3,0x00,0x0c,0x51,0x00,0x1d,
+0x7d,0x6e,0x70,0x8d,0x0d,0x65,0xf1,0xc7,0x0d,0x60,0xe6,0xd7,0x06,0x20,0xe6,0x9d,
+0x00,0x04,0xf2,0x1e,0xc7,0x8f,0x80,0x01,0x9d,0xc6,0x00,0x00,0x0c,0xc0,0x00,0x18,
+0x8f,0xf8,0x81,0x8f,0xfe,0xef,0xf8,0x2f,0xe0,0x0e,0xf2,0x04,0x00,0x00,0x0c,0x00,
+0x00,0x14,0x00,0x30,0x00,0x0c,0xc0,0x23,0x03,0xf4,0x16,0x22,0x00,0x00,0xaf,0xaa,
+0xa0,0x01,0xda,0x6a,0xfa,0x03,0xe8,0xbf,0xb8,0xe3,0xb6,0xdf,0xff,0xd6,0xb0,0x8f,
+0xfb,0xff,0x80,0x08,0xfc,0x0c,0xf8,0x00,0x5b,0x80,0x8b,0x50,0x00,0x0f,0xf0,0x00,
+0x04,0x00,0xf0,0x17,0x07,0xff,0xff,0x70,0x00,0x9f,0xf9,0x00,0x78,0x7a,0xa7,0x87,
+0xff,0xfb,0xbf,0xff,0xff,0xff,0xfb,0xbf,0x05,0xff,0xff,0xf5,0x01,0xe3,0x00,0x03,
+0xe1,0xa8,0x00,0x00,0x08,0xaf,0xff,0x50,0x6f,0xff,0x01,0x00,0x10,0xfd,0x04,0x00,
+0x00,0x49,0x07,0xf0,0x12,0x02,0xbf,0xfb,0x3f,0x2e,0x92,0x18,0xff,0x9a,0x00,0x6c,
+0xff,0x31,0x00,0x24,0x44,0x44,0x42,0x00,0x13,0xff,0xc6,0x00,0xb9,0xfe,0xa5,0x5b,
+0xd1,0xf2,0x8c,0xc8,0x10,0x30,0x48,0x01,0x30,0x09,0x34,0xcf,0x35,0x00,0xf0,0x0b,
+0xab,0xff,0x00,0x4f,0x00,0x01,0x00,0x09,0x00,0x34,0xcf,0x01,0xff,0xff,0x1b,0xff,
+0xff,0x1b,0xbb,0xff,0x01,0x00,0x4f,0x00,0x00,0x01,0x25,0x00,0xf2,0x20,0x54,0x00,
+0x00,0x90,0x23,0xb3,0x34,0xcf,0x02,0xc3,0xbf,0xff,0xf1,0xb5,0x6c,0xff,0xff,0x1b,
+0x56,0xca,0xbf,0xf0,0x2c,0x3a,0x00,0x4f,0x02,0x3b,0x30,0x00,0x10,0x05,0x40,0xdf,
+0xff,0xff,0xfd,0xf0,0x7f,0xff,0xff,0xf8,0xcf,0xb1,0xbf,0xfb,0x5b,0xb4,0x00,0x10,
+0xdf,0x87,0x00,0xf1,0x10,0xb4,0x00,0x03,0xfb,0x00,0x0b,0xff,0x40,0x6f,0xff,0xd0,
+0xdf,0xff,0xf5,0xf8,0xff,0xf7,0xaa,0x8f,0xf2,0x1a,0xfd,0x40,0x40,0x00,0x2f,0x20,
+0x8f,0xf2,0x9f,0xff,0x7c,0x00,0xf1,0x16,0x5e,0xff,0xf2,0x2d,0xfb,0x10,0x19,0x00,
+0x00,0x00,0x0d,0xa1,0x00,0x00,0xff,0xf7,0x00,0x0f,0xff,0xfd,0x40,0xff,0xff,0xff,
+0xaf,0xff,0xff,0xfa,0xff,0xff,0xd4,0x0f,0xff,0x70,0x00,0xda,0x10,0xf5,0x01,0xb9,
+0x9b,0x90,0x9b,0x9f,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0x07,0x00,0xae,0xf2,0x42,
+0x02,0x42,0x24,0x44,0x44,0x2f,0xff,0xff,0x01,0x00,0xc1,0xf8,0xbb,0xbb,0xb8,0x20,
+0x00,0x4f,0x80,0x2f,0xff,0x92,0xff,0x70,0x00,0x81,0xfe,0x5f,0xfd,0x22,0xf9,0x10,
+0x1b,0x00,0x3e,0x09,0xf1,0x1b,0x8f,0x80,0x00,0x00,0x7f,0xff,0x70,0x00,0x5f,0xff,
+0xff,0x50,0x0e,0xff,0xff,0xfe,0x00,0x58,0x88,0x88,0x50,0x0f,0xff,0xff,0xff,0x00,
+0xab,0xbb,0xbb,0xa0,0x00,0x06,0x20,0x07,0xf4,0x07,0xf5,0x05,0xf5,0x00,0x2e,0xb0,
+0x03,0x00,0xf0,0x1c,0x60,0x00,0x10,0x26,0x00,0x04,0xf6,0x00,0x05,0xf6,0x00,0x06,
+0xf5,0x00,0xbe,0x20,0xbe,0x10,0x6e,0x10,0x00,0x10,0x00,0x00,0x04,0x00,0x00,0x03,
+0xf3,0x00,0x00,0x4f,0x40,0x07,0x8a,0xfa,0x87,0xef,0xff,0xff,0xe0,0x04,0xf4,0x0e,
+0x00,0x80,0x00,0x01,0xb1,0x00,0x78,0x88,0x88,0x7e,0x59,0x00,0xf1,0x0c,0x8c,0xcc,
+0x80,0x01,0xdd,0x16,0x3d,0xd1,0xcf,0x55,0xed,0x5f,0xcb,0xf5,0xdf,0xd5,0xfc,0x1d,
+0xd3,0x73,0xdd,0x10,0x08,0xdc,0xc8,0x10,0x1d,0x89,0x01,0xf1,0x11,0x5e,0x8c,0xcc,
+0xa2,0x00,0x00,0x2d,0xb4,0x49,0xf4,0x00,0x7a,0x1a,0xff,0x3f,0xe1,0x07,0xfa,0x06,
+0xf7,0xff,0x10,0x0a,0xf3,0x03,0xef,0x40,0x00,0x06,0xcc,0x71,0xbb,0x02,0x01,0x40,
+0x89,0x00,0x00,0x3e,0x2e,0x00,0x20,0x0c,0xfc,0x28,0x03,0xf0,0x28,0xfc,0xf6,0x00,
+0x00,0x00,0xed,0x0d,0xe0,0x00,0x00,0x8f,0xe0,0xef,0x80,0x00,0x2f,0xff,0x6f,0xff,
+0x20,0x0b,0xff,0xe2,0xef,0xfa,0x00,0xdf,0xff,0xff,0xff,0xd0,0x00,0x00,0x00,0x20,
+0x44,0x00,0x04,0xf5,0xef,0xb1,0xcf,0xfd,0x01,0x8c,0xd1,0xc1,0x01,0xdc,0x81,0xc1,
+0xef,0xc1,0xbf,0xfd,0x14,0x00,0x12,0x00,0xff,0x00,0xf2,0x00,0x00,0x04,0xe4,0x00,
+0x04,0xfc,0xf4,0x04,0xf8,0x08,0xf4,0xb8,0x00,0x08,0xb0,0x5b,0x03,0xe1,0x0b,0x80,
+0x00,0x8b,0x4f,0x80,0x8f,0x40,0x4f,0xcf,0x40,0x00,0x4e,0x40,0x13,0x00,0xf1,0x12,
+0x94,0x14,0x44,0x40,0x00,0xbf,0xf8,0xbb,0xbf,0x10,0x08,0xb7,0x60,0x00,0xe1,0x00,
+0x0b,0x40,0x00,0x1e,0x20,0x00,0xb7,0x44,0x5e,0xfd,0x50,0x07,0xbb,0xb8,0x5f,0x80,
+0x00,0x50,0x00,0x43,0xdf,0xfb,0x00,0x00,0x81,0x02,0x05,0x01,0x00,0x01,0x06,0x02,
+0x30,0x09,0x90,0x00,0xbc,0x02,0x01,0xc4,0x02,0x03,0xd0,0x02,0x71,0x78,0x4f,0xf4,
+0x87,0xff,0xe8,0x8e,0xc8,0x02,0x03,0x39,0x04,0x73,0x07,0xea,0x00,0x00,0x00,0xef,
+0xe0,0xde,0x00,0xf2,0x03,0x4f,0x70,0x00,0x00,0x1d,0xe0,0x07,0xdc,0x4d,0xf3,0x00,
+0xef,0xff,0xe3,0x00,0x0a,0xec,0x70,0x1c,0x0a,0xf3,0x1b,0xcd,0xc0,0x2d,0xc0,0xe7,
+0xf2,0xee,0x20,0x4b,0xff,0xe2,0x00,0x04,0xff,0xa0,0x00,0xcd,0xf9,0xf9,0x00,0xe7,
+0xe0,0x7f,0x90,0x4a,0x40,0x04,0x50,0x00,0xff,0xf7,0x47,0x4f,0xff,0x47,0xf8,0xff,
+0xff,0xff,0x8f,0xff,0xff,0x07,0x00,0xf0,0x10,0xfb,0x78,0x88,0x7f,0xff,0xff,0x00,
+0x24,0x44,0x41,0x0f,0xbb,0xbb,0xe2,0xf0,0x00,0x0f,0xdf,0x44,0x44,0xff,0xff,0xfc,
+0xff,0xff,0xf9,0x09,0xff,0xff,0xd5,0xdf,0x20,0x02,0x30,0x01,0x11,0x11,0xf4,0x01,
+0xf0,0x06,0x01,0x11,0x11,0x05,0x55,0x55,0x55,0xcc,0xcc,0xcc,0xc0,0x11,0x11,0x10,
+0xff,0xff,0xff,0xf0,0x11,0x11,0x10,0xc1,0x00,0xf1,0x00,0x9f,0xff,0xff,0xf9,0xb7,
+0xff,0xff,0x7b,0xfe,0x7c,0xc7,0xef,0xff,0xfa,0xaf,0xd5,0x00,0xf1,0x3b,0x07,0xff,
+0x60,0x00,0xaf,0xf2,0x00,0x0c,0xff,0x87,0x00,0xef,0xff,0xb0,0x07,0x8e,0xf2,0x00,
+0x00,0xf8,0x00,0x00,0x3e,0x00,0x00,0x06,0x50,0x00,0x79,0xb9,0x70,0x0f,0xfc,0xff,
+0x00,0xff,0x68,0x83,0x0f,0xf8,0xff,0x8b,0xff,0x8f,0xf8,0x8f,0xf8,0xff,0xff,0x78,
+0x8f,0xff,0xf0,0x07,0xff,0xff,0x00,0x0d,0x00,0x00,0x4e,0xfe,0x30,0x0d,0xff,0xfd,
+0x00,0xff,0xff,0xf0,0x3f,0xff,0xff,0x3b,0xa3,0x00,0x41,0x88,0x60,0x04,0xf4,0xb7,
+0x01,0xf4,0x03,0xdf,0x18,0x81,0x88,0x1f,0xfe,0xaa,0xca,0xae,0xff,0xea,0xac,0xaa,
+0xef,0xf1,0x80,0x00,0x81,0xd1,0x03,0x01,0x01,0x00,0xf0,0x07,0x4b,0xc0,0x00,0x00,
+0x5c,0xff,0xb0,0x00,0x6e,0xff,0xff,0x40,0x0d,0xff,0xff,0xfc,0x00,0x06,0x88,0xcf,
+0xf5,0x00,0x02,0x02,0x00,0x05,0x00,0x00,0xba,0x0a,0x13,0x5d,0x2a,0x00,0x9b,0xff,
+0xf8,0xb0,0xff,0xf8,0xfb,0xff,0xfc,0x88,0x11,0x03,0xf0,0x0d,0x00,0x04,0x77,0x40,
+0x00,0x09,0xff,0xcc,0xff,0x90,0xcd,0x40,0x00,0x04,0xdc,0x20,0x4b,0xff,0xb4,0x02,
+0x01,0xfa,0x55,0xaf,0x10,0x00,0x00,0x21,0x38,0x00,0x10,0xee,0x05,0x00,0x20,0x87,
+0x00,0x31,0x04,0xc0,0x44,0x40,0xfb,0xbb,0xbb,0xbb,0xda,0xf7,0xee,0xee,0xee,0x5f,
+0x4e,0x01,0xb9,0x2f,0xf5,0x66,0x66,0x66,0xab,0x8b,0xbb,0xbb,0xbb,0xb3,0x1e,0x00,
+0x10,0x70,0x1e,0x00,0x10,0x80,0x1e,0x00,0x1e,0x54,0x1e,0x00,0xcd,0xe0,0x00,0x5f,
+0xf8,0xff,0xf0,0x00,0x2f,0xf5,0x66,0x64,0x44,0x1e,0x00,0xcc,0xe7,0x00,0x00,0x5f,
+0xf8,0xf8,0x00,0x00,0x2f,0xf5,0x65,0x44,0x1e,0x00,0x60,0xd8,0xf0,0x00,0x00,0x00,
+0x5f,0x05,0x00,0x61,0x2f,0xf4,0x44,0x44,0x44,0xad,0x1e,0x00,0x04,0x2c,0x02,0x10,
+0xd8,0x05,0x00,0xf0,0x04,0x36,0x40,0x00,0x09,0xb1,0x91,0x11,0x17,0x20,0xef,0x88,
+0xd8,0x88,0xd9,0x02,0x20,0x06,0x48,0x70,0x18,0x03,0x13,0xec,0x25,0x00,0xf3,0x1e,
+0x06,0xdd,0xc3,0x04,0xff,0x3e,0xd0,0x9c,0xb5,0x5f,0x2b,0xf7,0x1a,0xf4,0xbf,0x81,
+0xbf,0x39,0xc9,0x64,0xf2,0x4f,0xf3,0xde,0x00,0x6d,0xed,0x30,0x78,0xdf,0xd8,0x77,
+0x88,0x88,0x87,0x8f,0xff,0xff,0x88,0xcc,0x8c,0xc8,0x8c,0xc8,0xcc,0x07,0x00,0x30,
+0x85,0xff,0xff,0x4f,0x01,0xf1,0x00,0x7d,0x30,0x00,0x00,0x4b,0xfd,0x00,0x00,0x7f,
+0x9b,0x70,0x00,0x7f,0xff,0x40,0x24,0x04,0x00,0x04,0x00,0x74,0x0e,0xff,0x70,0x00,
+0x00,0xee,0x70,0x8e,0x01,0xd2,0xaf,0xff,0xff,0xfc,0x0b,0xff,0x9c,0xc9,0xff,0xaf,
+0xff,0xc1,0x1c,0x05,0x00,0x01,0x0f,0x00,0x01,0x19,0x00,0xf3,0x02,0x07,0xff,0xfe,
+0x17,0xb6,0x27,0xc3,0xfe,0xb9,0xbe,0x3f,0xff,0xff,0xf3,0xff,0xff,0xff,0x07,0x00,
+0x41,0x3c,0xff,0xff,0xe1,0xe9,0x0c,0x90,0x23,0x00,0x02,0xf0,0x2e,0x92,0x22,0x5f,
+0x0d,0x6b,0x02,0x90,0x2e,0x92,0x22,0x21,0x00,0x23,0x00,0x00,0x00,
+};
+
+static const etxFontBlock blocks[] = {
+{ .bitmap_index = 0, .comp_offset = 0, .size = 4069, .comp_size = 3691 },
+{ .bitmap_index = 4069, .comp_offset = 3691, .size = 4074, .comp_size = 3782 },
+{ .bitmap_index = 8143, .comp_offset = 7473, .size = 4061, .comp_size = 3895 },
+{ .bitmap_index = 12204, .comp_offset = 11368, .size = 3542, .comp_size = 3253 },
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1250,11 +1278,11 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 12527, .range_length = 51124, .glyph_id_start = 233, .list_length = 349, .type = 3, .unicode_list = 4801, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[37287] __SDRAMFONTS;
+static uint8_t etxUncompBuf[21541] __SDRAMFONTS;
 
 const etxLz4Font lv_font_jp_XXS = {
-.uncomp_size = 36927,
-.comp_size = 19773,
+.uncomp_size = 21181,
+.comp_size = 5429,
 .line_height = 10,
 .base_line = 2,
 .subpx = 0,
@@ -1267,12 +1295,15 @@ const etxLz4Font lv_font_jp_XXS = {
 .bitmap_format = 0,
 .left_class_cnt = 122,
 .right_class_cnt = 119,
-.glyph_bitmap = 5499,
-.class_pair_values = 21245,
-.left_class_mapping = 35763,
-.right_class_mapping = 36345,
+.glyph_bitmap = 0,
+.class_pair_values = 5499,
+.left_class_mapping = 20017,
+.right_class_mapping = 20599,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 37287,
+.lvglFontBufSize = 21541,
+.block_count = 4,
+.blocks = blocks,
+.compressed_bitmap = lz4BitmapData,
 };
@@ -205,969 +205,1114 @@ static const uint8_t lz4FontData[] ={
 0xb6,0x2f,0xb7,0x2f,0xb8,0x2f,0xba,0x2f,0xbb,0x2f,0xbe,0x2f,0xbf,0x2f,0xc8,0x2f,
 0xc9,0x2f,0xce,0x2f,0xcf,0x2f,0xd0,0x2f,0xd1,0x2f,0xd2,0x2f,0xd9,0x2f,0xda,0x2f,
 0xdb,0x2f,0xdc,0x2f,0xdf,0x2f,0xe2,0x2f,0xe3,0x2f,0x00,0x01,0x02,0x03,0x00,0x04,
-0x05,0x06,0x07,0x08,0xe7,0x01,0xf2,0xff,0xff,0xff,0xf2,0x0c,0x0d,0x0e,0x0f,0x10,
-0x00,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x1d,0x00,0x1e,
-0x1f,0x00,0x20,0x21,0x22,0x23,0x24,0x25,0x00,0x26,0x27,0x28,0x29,0x2a,0x00,0x00,
-0x04,0x00,0x0d,0x00,0x11,0x1d,0x1b,0x1d,0x1c,0x1d,0x1e,0x1d,0x32,0x1d,0x3e,0x1d,
-0x68,0x1d,0x97,0x1d,0xe7,0x1d,0xe9,0x1d,0x07,0x1e,0x0c,0x1e,0x5e,0x1e,0x5f,0x1e,
-0x64,0x1e,0x6d,0x1e,0x90,0x1e,0xee,0x1e,0xf2,0x1e,0xff,0x1e,0x1e,0x1f,0x35,0x1f,
-0x60,0x1f,0x6d,0x1f,0x85,0x1f,0xaa,0x1f,0xe0,0x1f,0x54,0x20,0x56,0x20,0x59,0x20,
-0x76,0x20,0x79,0x20,0x7d,0x20,0x82,0x20,0x88,0x20,0x96,0x20,0x97,0x20,0x9e,0x20,
-0x0b,0x21,0x17,0x21,0x2e,0x21,0x36,0x21,0x3a,0x21,0x4c,0x21,0x5b,0x21,0x5e,0x21,
-0x83,0x21,0xac,0x21,0xb0,0x21,0xb1,0x21,0xca,0x21,0xe6,0x21,0x27,0x22,0x69,0x22,
-0xcc,0x22,0xe8,0x22,0x04,0x23,0x08,0x23,0x19,0x23,0x1d,0x23,0x1e,0x23,0x22,0x23,
-0x37,0x23,0x3c,0x23,0x5b,0x23,0x79,0x23,0x60,0x24,0x79,0x25,0xef,0x25,0x03,0x26,
-0x0b,0x26,0x0e,0x26,0x38,0x26,0x39,0x26,0x58,0x26,0xdc,0x26,0x42,0x27,0x68,0x27,
-0xa8,0x27,0x01,0x28,0x1a,0x28,0x27,0x28,0x2b,0x28,0x38,0x28,0x3f,0x28,0x42,0x28,
-0x79,0x28,0x69,0x2a,0x9d,0x2a,0xab,0x2a,0xb0,0x2a,0xca,0x2a,0x0f,0x2b,0x20,0x2b,
-0x22,0x2b,0xf7,0x2c,0xff,0x2c,0x49,0x2d,0x84,0x2d,0xb7,0x2d,0xb8,0x2d,0x07,0x2e,
-0x20,0x2e,0x42,0x2e,0x46,0x2e,0x48,0x2e,0x64,0x2e,0x73,0x2e,0x82,0x2e,0x96,0x2e,
-0x9d,0x2e,0xba,0x2e,0xbf,0x2e,0xd6,0x2e,0xed,0x2e,0x36,0x2f,0xd6,0x2f,0x04,0x30,
-0x20,0x30,0x5c,0x30,0x21,0x31,0x5c,0x31,0xaf,0x31,0xcd,0x31,0xe3,0x31,0xf2,0x31,
-0x12,0x32,0x50,0x32,0xb6,0x32,0xb9,0x32,0xd4,0x32,0xec,0x32,0xde,0x33,0x68,0x34,
-0x81,0x34,0x98,0x34,0xc1,0x34,0xca,0x34,0xf3,0x34,0xf6,0x34,0x1f,0x35,0x53,0x35,
-0x80,0x35,0x05,0x36,0x09,0x36,0x11,0x36,0x1a,0x36,0x30,0x36,0x3b,0x36,0x3c,0x36,
-0x3d,0x36,0x72,0x36,0xb1,0x36,0x4d,0x37,0x2d,0x38,0x86,0x38,0x93,0x38,0xdc,0x38,
-0x2a,0x39,0x70,0x39,0x73,0x3a,0x74,0x3a,0x9c,0x3a,0xdf,0x3a,0xe5,0x3a,0x28,0x3b,
-0x71,0x3b,0xe6,0x3b,0xf3,0x3b,0x99,0x3c,0x2c,0x3d,0x3a,0x3d,0xa1,0x3d,0xa7,0x3d,
-0x25,0x3e,0x81,0x3e,0x32,0x40,0xc7,0x41,0x98,0x42,0x0f,0x43,0x17,0x43,0x30,0x44,
-0x39,0x44,0x4c,0x44,0x7b,0x44,0x8c,0x45,0x51,0x46,0xcb,0x47,0x4b,0x48,0xe3,0x48,
-0x01,0x49,0x0c,0x49,0x8b,0x49,0x92,0x49,0x00,0x4a,0x3d,0x4a,0x65,0x4a,0xa8,0x4a,
-0xb2,0x4a,0xd5,0x4a,0xcf,0x4b,0x31,0x4c,0x33,0x4c,0x41,0x4c,0x53,0x4c,0x5d,0x4c,
-0x82,0x4c,0xaa,0x4c,0xab,0x4c,0xdb,0x4c,0xe2,0x4c,0xeb,0x4c,0xf9,0x4c,0x7f,0x4e,
-0x83,0x4e,0x14,0x4f,0x16,0x4f,0xdd,0x4f,0x0e,0x50,0xfb,0x50,0x80,0x51,0x83,0x51,
-0x46,0x54,0x5d,0x57,0x6e,0x57,0x79,0x57,0x81,0x57,0xd6,0x57,0x0e,0x58,0x18,0x58,
-0x92,0x58,0x9c,0x58,0xa0,0x58,0xa7,0x58,0xf4,0x58,0x11,0x59,0x19,0x59,0x29,0x59,
-0x3e,0x59,0x4d,0x59,0x83,0x59,0x84,0x59,0x9e,0x59,0xaf,0x59,0xbd,0x59,0xbe,0x59,
-0xe7,0x59,0x69,0x5a,0x77,0x5a,0xcc,0x5b,0xcd,0x5b,0x75,0x5c,0x88,0x5c,0x96,0x5c,
-0xee,0x5c,0x09,0x5e,0x14,0x5e,0x2e,0x5e,0xcd,0x5e,0x0e,0x5f,0x12,0x5f,0x2b,0x5f,
-0x30,0x5f,0x56,0x5f,0x5f,0x5f,0x7a,0x5f,0x89,0x5f,0xf9,0x5f,0xe0,0x60,0x43,0x62,
-0x88,0x64,0x9c,0x64,0xa4,0x64,0x75,0x65,0xd7,0x65,0xf3,0x65,0x0c,0x66,0x63,0x66,
-0x6f,0x66,0x73,0x66,0xe4,0x66,0x04,0x67,0x17,0x67,0x5d,0x67,0xec,0x67,0xe9,0x69,
-0x12,0xbf,0x19,0xbf,0x1c,0xbf,0x1d,0xbf,0x1e,0xbf,0x22,0xbf,0x24,0xbf,0x26,0xbf,
-0x2a,0xbf,0x2d,0xbf,0x32,0xbf,0x37,0xbf,0x38,0xbf,0x39,0xbf,0x4f,0xbf,0x54,0xbf,
-0x59,0xbf,0x5c,0xbf,0x5d,0xbf,0x5e,0xbf,0x62,0xbf,0x63,0xbf,0x64,0xbf,0x65,0xbf,
-0x78,0xbf,0x79,0xbf,0x7f,0xbf,0x81,0xbf,0x82,0xbf,0x85,0xbf,0x88,0xbf,0x89,0xbf,
-0x8a,0xbf,0x8c,0xbf,0xa4,0xbf,0xa6,0xbf,0xd5,0xbf,0xd6,0xbf,0xd8,0xbf,0xda,0xbf,
-0xf1,0xbf,0xf8,0xbf,0xfb,0xbf,0x04,0xc0,0x2d,0xc0,0x35,0xc0,0x6c,0xc0,0xfc,0xc0,
-0x51,0xc1,0x52,0xc1,0x53,0xc1,0x54,0xc1,0x55,0xc1,0x98,0xc1,0xa4,0xc1,0xfe,0xc1,
-0x15,0xc2,0x6b,0xc4,0xd3,0xc6,0xb3,0xc7,0x2f,0xc1,0xfb,0x1f,0xb0,0xfa,0x0f,0xa0,
-0xf9,0x06,0x31,0xd9,0x1e,0xa0,0x9a,0x8b,0x9a,0x8b,0x98,0x89,0x43,0x44,0x00,0x1f,
-0x0b,0x70,0x00,0x5d,0x0f,0x30,0x2f,0xff,0xff,0xf7,0x01,0xb8,0x6d,0x10,0x00,0xe4,
-0x7a,0x00,0x8f,0xff,0xff,0xf0,0x15,0xf2,0xd6,0x20,0x06,0xc0,0xf2,0x00,0x08,0xa2,
-0xf0,0x00,0x00,0x09,0x70,0x00,0x05,0xdb,0x30,0x09,0xfe,0xff,0x40,0xfd,0x02,0xfb,
-0x0f,0xe1,0x04,0x40,0x7f,0xf8,0x10,0x00,0x4b,0xfe,0x31,0x41,0x04,0xfb,0x4f,0x90,
-0x1f,0xc0,0xdf,0xce,0xf7,0x01,0x8e,0xc5,0x00,0x00,0xb5,0x00,0x0a,0xfc,0x10,0x00,
-0x00,0x5e,0x2c,0x80,0xb3,0x00,0x5e,0x0b,0x96,0xc0,0x00,0x0c,0xfe,0x4e,0x20,0x00,
-0x00,0x10,0xb7,0x00,0x00,0x00,0x06,0xc5,0xdd,0x50,0x00,0x2e,0x2e,0x77,0xf0,0x00,
-0xa7,0x0e,0x65,0xf0,0x00,0x00,0x06,0xee,0x70,0x01,0xbf,0xd5,0x00,0x00,0x9f,0x9d,
-0xf0,0x00,0x0a,0xf0,0x9f,0x00,0x00,0x4f,0xdf,0x50,0x00,0x05,0xff,0x90,0x66,0x04,
-0xfb,0xbf,0x6e,0xb0,0x8f,0x50,0xdf,0xf6,0x04,0xfd,0x6a,0xff,0x30,0x06,0xdf,0xe9,
-0xfd,0x10,0x9b,0x9b,0x9a,0x44,0x00,0x01,0x00,0x02,0xe2,0x00,0xd9,0x00,0x7f,0x10,
-0x0d,0xb0,0x00,0xf7,0x00,0x2f,0x60,0x03,0xf5,0x00,0x2f,0x60,0x00,0xf8,0x00,0x0b,
-0xc0,0x00,0x4f,0x30,0x00,0xad,0x10,0x00,0x91,0x10,0x00,0x9a,0x00,0x2e,0x70,0x07,
-0xf1,0x02,0xf6,0x00,0xea,0x00,0xdc,0x00,0xcd,0x00,0xdc,0x00,0xf9,0x03,0xf4,0x0a,
-0xd0,0x5f,0x30,0x74,0x00,0x00,0x99,0x00,0x43,0x88,0x23,0x8e,0xfe,0xf8,0x02,0xff,
-0x20,0x0d,0x79,0xc0,0x05,0x01,0x50,0x00,0x4b,0x40,0x00,0x05,0xf6,0x00,0x00,0x5f,
-0x60,0x0a,0xff,0xff,0xfb,0x6a,0xcf,0xca,0x70,0x0e,0x00,0xf0,0x17,0x00,0x1f,0x72,
-0xf6,0x5f,0x26,0x70,0x02,0x22,0x04,0xff,0xf4,0x15,0x55,0x10,0x1d,0x91,0xea,0x00,
-0x00,0xd8,0x00,0x03,0xf2,0x00,0x08,0xd0,0x00,0x0d,0x70,0x00,0x3f,0x20,0x00,0x8c,
-0x00,0x00,0xe7,0x11,0x00,0xf8,0x22,0x09,0xc0,0x00,0x0e,0x70,0x00,0x02,0xbf,0xd6,
-0x00,0xdf,0x8c,0xf5,0x3f,0x90,0x1f,0xa5,0xf7,0x00,0xfd,0x6f,0x70,0x0f,0xd5,0xf7,
-0x00,0xfc,0x3f,0x90,0x2f,0xa0,0xdf,0x8c,0xf5,0x02,0xbf,0xd7,0x00,0x02,0x8d,0x1c,
-0xff,0xf1,0x95,0xcf,0x10,0x0c,0xf1,0x00,0x05,0x00,0xf0,0xb5,0x04,0xcf,0xe8,0x02,
-0xfe,0x8c,0xf6,0x7f,0x50,0x3f,0xa0,0x00,0x06,0xf7,0x00,0x03,0xfd,0x00,0x03,0xee,
-0x10,0x03,0xee,0x20,0x02,0xef,0x97,0x77,0x6f,0xff,0xff,0xf0,0x05,0xdf,0xd7,0x03,
-0xfe,0x8c,0xf6,0x38,0x30,0x3f,0x90,0x01,0x29,0xf6,0x00,0x8f,0xfa,0x00,0x02,0x59,
-0xf7,0x5a,0x30,0x1f,0xc4,0xfe,0x8b,0xf8,0x05,0xdf,0xe8,0x00,0x00,0x02,0xff,0x10,
-0x00,0x0b,0xff,0x10,0x00,0x5f,0xff,0x10,0x01,0xea,0xcf,0x10,0x09,0xe1,0xcf,0x10,
-0x3f,0x82,0xcf,0x30,0x9f,0xff,0xff,0xf1,0x35,0x55,0xdf,0x50,0x00,0x00,0xcf,0x10,
-0x0a,0xff,0xff,0x90,0xbf,0x88,0x85,0x0d,0xc0,0x00,0x00,0xff,0xff,0xb1,0x09,0x95,
-0x9f,0x90,0x00,0x00,0xfd,0x2a,0x60,0x0f,0xd0,0xef,0x8b,0xf8,0x03,0xcf,0xe8,0x00,
-0x00,0x2a,0xe9,0x00,0x3f,0xfa,0x50,0x0d,0xe2,0x10,0x03,0xfd,0xef,0xd2,0x5f,0xe6,
-0x9f,0xb5,0xf7,0x00,0xee,0x3f,0x90,0x0e,0xe0,0xcf,0x9b,0xf9,0x01,0xae,0xe9,0x00,
-0x9f,0xff,0xff,0xe4,0x88,0x89,0xfb,0x00,0x00,0x7f,0x30,0x00,0x0e,0xc0,0x00,0x07,
-0xf5,0x00,0x00,0xee,0x00,0x00,0x6f,0x70,0x00,0x0d,0xf1,0x00,0x05,0xf9,0x00,0x00,
-0x44,0x00,0xf0,0x30,0xef,0x8c,0xf6,0x2f,0xa0,0x3f,0x90,0xee,0x38,0xf6,0x04,0xff,
-0xfc,0x01,0xed,0x69,0xf7,0x5f,0x70,0x0f,0xc2,0xfe,0x8b,0xf9,0x05,0xcf,0xe9,0x00,
-0x02,0xcf,0xd5,0x01,0xef,0x8d,0xf3,0x5f,0x80,0x3f,0x96,0xf6,0x01,0xfc,0x3f,0xc2,
-0x7f,0xc0,0x9f,0xfe,0xfa,0x00,0x23,0x7f,0x50,0x09,0xbf,0xc0,0x01,0xfd,0x80,0x00,
-0x1e,0xa1,0xd9,0xe2,0x05,0x71,0x01,0xd9,0x1e,0xa0,0x2e,0x82,0xe8,0x0e,0x18,0xf2,
-0x2e,0x85,0x0f,0x91,0xf6,0x6d,0x00,0x10,0x00,0x01,0x7a,0x02,0x9f,0xfb,0x8f,0xe9,
-0x40,0x9f,0xd7,0x10,0x04,0xbf,0xfa,0x00,0x02,0x9c,0x00,0x00,0x00,0x2f,0xff,0xff,
-0x81,0x88,0x88,0x84,0x18,0x88,0x88,0x42,0xff,0xff,0xf8,0x3b,0x40,0x00,0x03,0xff,
-0xd6,0x00,0x00,0x6b,0xff,0x30,0x04,0x9f,0xf4,0x2e,0xff,0x92,0x03,0xd6,0x51,0x18,
-0xf0,0x44,0x08,0xef,0xb2,0x7f,0xca,0xfc,0x69,0x10,0xee,0x00,0x06,0xf9,0x00,0x5f,
-0xb0,0x00,0xbf,0x00,0x00,0x12,0x00,0x00,0xbc,0x00,0x00,0xcd,0x00,0x00,0x04,0xbe,
-0xfd,0x70,0x00,0x00,0x8e,0x61,0x13,0xbc,0x00,0x05,0xe2,0x00,0x00,0x0b,0x70,0x0d,
-0x60,0x3c,0xea,0x14,0xd0,0x3f,0x11,0xf8,0x4f,0x21,0xf0,0x5e,0x07,0xe0,0x3f,0x00,
-0xf1,0x6c,0x0a,0xb0,0x5f,0x03,0xf0,0x6d,0x09,0xd1,0xbf,0x2a,0x90,0x2f,0x12,0xde,
-0x6b,0xfa,0x00,0x0d,0x90,0x57,0x00,0xf0,0x60,0x03,0xea,0x42,0x36,0x00,0x00,0x00,
-0x29,0xdf,0xea,0x00,0x00,0x00,0x0b,0xf7,0x00,0x00,0x01,0xff,0xd0,0x00,0x00,0x7f,
-0xcf,0x30,0x00,0x0d,0xe2,0xf9,0x00,0x03,0xf8,0x0c,0xf0,0x00,0x9f,0xa8,0xcf,0x50,
-0x0f,0xff,0xff,0xfb,0x06,0xf8,0x00,0x0c,0xf2,0xcf,0x30,0x00,0x7f,0x80,0x2f,0xff,
-0xfc,0x50,0x2f,0xe8,0x9f,0xf3,0x2f,0xb0,0x07,0xf7,0x2f,0xc1,0x2b,0xf3,0x2f,0xff,
-0xff,0xa0,0x2f,0xc4,0x4a,0xf6,0x2f,0xb0,0x04,0xfa,0x2f,0xe8,0x8d,0xf6,0x2f,0xff,
-0xfd,0x80,0x00,0x8e,0xfd,0x60,0x00,0xaf,0xc9,0xdf,0x70,0x2f,0xd0,0x00,0xfe,0x06,
-0xf8,0x00,0x01,0x20,0x7f,0x70,0x00,0x00,0x09,0x00,0xf1,0x14,0x10,0x2f,0xc0,0x00,
-0xfe,0x00,0xbf,0xc9,0xdf,0x70,0x00,0x9e,0xfd,0x60,0x00,0x2f,0xff,0xe9,0x10,0x2f,
-0xe8,0xbf,0xd0,0x2f,0xb0,0x08,0xf8,0x2f,0xb0,0x02,0xfc,0x2f,0xb0,0x00,0xfe,0x08,
-0x00,0x00,0x10,0x00,0x31,0xe8,0xbf,0xd1,0x20,0x00,0xe0,0xff,0xff,0xf0,0x2f,0xe8,
-0x88,0x80,0x2f,0xb0,0x00,0x00,0x2f,0xd8,0x88,0xd7,0x03,0x11,0x60,0x0c,0x00,0x00,
-0x04,0x00,0x00,0x18,0x00,0x00,0x20,0x00,0xf1,0x03,0xff,0xff,0xd2,0xfe,0x88,0x87,
-0x2f,0xb0,0x00,0x02,0xfe,0x88,0x83,0x2f,0xff,0xff,0x62,0xfb,0x21,0x00,0x22,0x02,
-0xfb,0x28,0x00,0xf0,0x19,0x00,0x7d,0xfd,0x80,0x00,0x9f,0xd9,0xcf,0xa0,0x1f,0xe0,
-0x00,0xab,0x05,0xf9,0x00,0x11,0x10,0x6f,0x80,0x8f,0xff,0x25,0xf9,0x02,0x4d,0xf2,
-0x1f,0xe0,0x00,0xcf,0x20,0x9f,0xd9,0xaf,0xf1,0x00,0x7d,0xfe,0xb3,0x2d,0x00,0x61,
-0x9f,0x52,0xfb,0x00,0x09,0xf5,0x09,0x00,0x86,0xfe,0x88,0x8c,0xf5,0x2f,0xff,0xff,
-0xff,0x12,0x00,0x04,0x09,0x00,0x46,0x50,0x0f,0xd0,0xfd,0x03,0x00,0x00,0x36,0x01,
-0x4a,0x70,0x00,0x07,0xf7,0x07,0x00,0xf0,0x0c,0x8c,0x20,0x8f,0x66,0xfd,0x9f,0xf2,
-0x08,0xef,0xc4,0x00,0x2f,0xb0,0x07,0xfc,0x02,0xfb,0x04,0xfe,0x10,0x2f,0xb2,0xef,
-0x30,0x02,0xfc,0xcf,0xfa,0x00,0xf6,0x06,0xf5,0x00,0x02,0xff,0xbf,0xe1,0x00,0x2f,
-0xc0,0x8f,0xa0,0x02,0xfb,0x00,0xdf,0x50,0x2f,0xb0,0x03,0xfe,0x10,0xb4,0x00,0x0b,
-0x07,0x00,0xf0,0x48,0xfe,0x88,0x86,0x2f,0xff,0xff,0xc0,0x2f,0xf7,0x00,0x02,0xff,
-0x82,0xff,0xd0,0x00,0x7f,0xf8,0x2f,0xef,0x30,0x0d,0xef,0x82,0xfa,0xf9,0x03,0xf9,
-0xf8,0x2f,0xaa,0xe0,0x9f,0x5f,0x82,0xfa,0x4f,0x5e,0xa5,0xf8,0x2f,0xb0,0xee,0xf4,
-0x5f,0x82,0xfb,0x08,0xfe,0x05,0xf8,0x2f,0xb0,0x2f,0x80,0x5f,0x80,0x2f,0xf1,0x00,
-0x9f,0x52,0xff,0xa0,0x09,0xf5,0x2f,0xff,0x40,0x9f,0x52,0xfc,0xed,0x09,0xf5,0x2f,
-0xb6,0xf8,0x9f,0x52,0xfb,0x0c,0xfb,0xf5,0x2f,0xb0,0x2f,0xdb,0x00,0x10,0x8f,0xd2,
-0x00,0xf0,0x0b,0xdf,0x50,0x00,0x7d,0xfd,0x70,0x00,0x9f,0xda,0xdf,0x80,0x2f,0xe0,
-0x00,0xef,0x15,0xf9,0x00,0x09,0xf5,0x7f,0x70,0x00,0x8f,0x66,0xf8,0xf2,0x00,0x81,
-0xd0,0x00,0xef,0x10,0x9f,0xd9,0xdf,0x90,0x24,0x00,0xf5,0x09,0x2f,0xff,0xfd,0x70,
-0x2f,0xe9,0x9d,0xf8,0x2f,0xb0,0x01,0xfd,0x2f,0xb0,0x05,0xfc,0x2f,0xff,0xff,0xf4,
-0x2f,0xe8,0x86,0x10,0x95,0x01,0x02,0x71,0x01,0x12,0x60,0x4d,0x00,0x5f,0xd0,0x01,
-0xef,0x16,0xf8,0x4d,0x00,0x01,0xe0,0x80,0x00,0x7d,0xff,0xf3,0x00,0x00,0x00,0x3e,
-0xf1,0x00,0x00,0x00,0x13,0x56,0x00,0xe0,0x60,0x02,0xfe,0x89,0xef,0x50,0x2f,0xb0,
-0x05,0xf9,0x02,0xfb,0x00,0x8f,0xd9,0x01,0xff,0x35,0xc1,0x02,0xfe,0x8d,0xf4,0x00,
-0x2f,0xb0,0x4f,0xc0,0x02,0xfb,0x00,0xcf,0x40,0x2f,0xb0,0x04,0xfc,0x00,0x03,0xbf,
-0xfc,0x40,0x1e,0xf9,0x9f,0xf2,0x3f,0xb0,0x05,0xc5,0x0e,0xf9,0x30,0x00,0x01,0xaf,
-0xfd,0x40,0x00,0x01,0x6e,0xf3,0x7e,0x60,0x06,0xf7,0x2f,0xf9,0x8e,0xf4,0x03,0xbe,
-0xfd,0x50,0xcf,0xff,0xff,0xfc,0x68,0x8f,0xf8,0x86,0x00,0x0f,0xf0,0x00,0x04,0x00,
-0x05,0x4f,0x4f,0xa0,0x01,0xfd,0x04,0x00,0x01,0xf0,0x49,0x2f,0xc0,0x03,0xfb,0x0c,
-0xfb,0x9e,0xf5,0x01,0x9e,0xfd,0x50,0xcf,0x40,0x00,0xdf,0x46,0xf9,0x00,0x2f,0xe0,
-0x1f,0xe0,0x06,0xf8,0x00,0xbf,0x30,0xbf,0x30,0x05,0xf8,0x0f,0xd0,0x00,0x0f,0xc5,
-0xf7,0x00,0x00,0xaf,0xbf,0x20,0x00,0x04,0xff,0xc0,0x00,0x00,0x0e,0xf6,0x00,0x00,
-0xaf,0x30,0x3f,0x90,0x0d,0xf1,0x7f,0x60,0x7f,0xd0,0x0f,0xd0,0x3f,0x90,0xbf,0xf1,
-0x3f,0x90,0x0f,0xc0,0xeb,0xf5,0x6f,0x50,0x0c,0xf3,0xf5,0xe8,0x9f,0x20,0x08,0xf9,
-0xf1,0xac,0xce,0x2d,0x00,0xf0,0x25,0x6f,0xfa,0x00,0x01,0xff,0x80,0x2f,0xf7,0x00,
-0x00,0xdf,0x40,0x0e,0xf3,0x00,0x7f,0xa0,0x06,0xfc,0x00,0xdf,0x30,0xef,0x20,0x04,
-0xfc,0x8f,0x80,0x00,0x0a,0xff,0xe0,0x00,0x00,0x3f,0xf8,0x00,0x00,0x0b,0xff,0xe1,
-0x00,0x05,0xfc,0x8f,0x90,0x00,0xef,0x30,0xef,0x30,0x8f,0x24,0x00,0xf0,0x06,0xbf,
-0x50,0x04,0xfc,0x03,0xfc,0x00,0xcf,0x30,0x0a,0xf3,0x3f,0xb0,0x00,0x2f,0xba,0xf2,
-0x00,0x00,0x9f,0xfa,0xb0,0x03,0x12,0x20,0xcf,0x00,0x31,0x00,0xff,0x00,0x09,0x00,
-0x00,0xe8,0x06,0xfd,0x1a,0xf6,0x48,0x88,0x9f,0xf2,0x00,0x00,0xaf,0x60,0x00,0x06,
-0xfa,0x00,0x00,0x2f,0xe1,0x00,0x00,0xcf,0x40,0x00,0x08,0xf8,0x00,0x00,0x4f,0xf8,
-0x88,0x84,0x8f,0xff,0xff,0xf8,0x01,0x10,0x3f,0xf8,0x3f,0xb2,0x3f,0x90,0x02,0x00,
-0x70,0xa1,0x3f,0xf8,0x14,0x42,0xcf,0x10,0x0f,0x05,0xf9,0x0d,0x1f,0xd0,0x00,0x0a,
-0xf3,0x00,0x04,0xf9,0x00,0x00,0xdf,0x00,0x00,0x7f,0x60,0x00,0x1f,0xc0,0x00,0x0b,
-0xf2,0x00,0x05,0xf8,0x11,0x1e,0xfd,0x4f,0xfa,0x02,0xf0,0x33,0xfd,0x2f,0xde,0xfd,
-0x44,0x30,0x00,0x74,0x00,0x04,0xfe,0x00,0x0a,0xbf,0x50,0x1f,0x49,0xc0,0x8e,0x03,
-0xf3,0x22,0x22,0x21,0xff,0xff,0xfc,0x55,0x55,0x53,0x4f,0x90,0x05,0xf4,0x05,0xdf,
-0xd4,0x03,0xfc,0x6e,0xf1,0x25,0x20,0xaf,0x30,0x7d,0xef,0xf4,0x6f,0x92,0xaf,0x47,
-0xfb,0x7e,0xf4,0x0a,0xfd,0xaf,0x60,0x4f,0x80,0x00,0x04,0xf8,0x00,0x00,0x07,0x00,
-0xf0,0x15,0xfb,0xde,0x90,0x4f,0xf9,0xcf,0x74,0xf9,0x01,0xfc,0x4f,0x80,0x0f,0xd4,
-0xf8,0x01,0xfc,0x4f,0xf8,0xcf,0x74,0xf9,0xde,0x90,0x03,0xcf,0xd5,0x01,0xfe,0x8e,
-0xf2,0x7f,0x60,0x3b,0x48,0xf4,0x88,0x00,0xf0,0x01,0x27,0x31,0xfe,0x8d,0xf3,0x03,
-0xcf,0xd5,0x00,0x00,0x00,0x3f,0x90,0x00,0x03,0xf9,0x07,0x00,0xf0,0x0a,0x5d,0xea,
-0xf9,0x2f,0xe9,0xdf,0x97,0xf6,0x04,0xf9,0x8f,0x40,0x3f,0x97,0xf5,0x03,0xf9,0x2f,
-0xd6,0xcf,0x90,0x5d,0xe9,0xf9,0x03,0xab,0x05,0xf3,0x17,0x8c,0xf3,0x6f,0x70,0x3f,
-0x88,0xff,0xff,0xfa,0x6f,0x93,0x33,0x21,0xef,0x99,0xe4,0x02,0xbf,0xe9,0x00,0x01,
-0xbf,0x90,0x9f,0xb5,0x0c,0xf1,0x0d,0xff,0xf6,0x4d,0xf6,0x20,0xcf,0x00,0x0c,0xf0,
-0x00,0x05,0x00,0xf0,0x1b,0x04,0xde,0x9f,0xb1,0xff,0x9c,0xfb,0x6f,0x70,0x2f,0xb8,
-0xf4,0x02,0xfb,0x6f,0x60,0x2f,0xb1,0xff,0x8c,0xfb,0x04,0xde,0xaf,0xb0,0x20,0x04,
-0xfa,0x0d,0xb7,0xdf,0x40,0x7d,0xfd,0x60,0x5f,0x80,0x00,0x05,0xf8,0x00,0x00,0x07,
-0x00,0xf4,0x01,0xfa,0xcf,0xa0,0x5f,0xe8,0xcf,0x65,0xf8,0x04,0xf9,0x5f,0x80,0x3f,
-0x95,0xf8,0x03,0x07,0x00,0x83,0x2e,0x82,0xd7,0x00,0x03,0xfa,0x3f,0xa3,0x03,0x00,
-0x89,0x02,0xf8,0x02,0xd7,0x00,0x00,0x03,0xfa,0x02,0x00,0x96,0xf9,0x5c,0xf7,0x9f,
-0xa0,0x4f,0x80,0x00,0x00,0x04,0x00,0xf5,0x0b,0xbf,0x60,0x4f,0x89,0xf9,0x00,0x4f,
-0xef,0xb0,0x00,0x4f,0xff,0xc0,0x00,0x4f,0xda,0xf6,0x00,0x4f,0x81,0xef,0x20,0x4f,
-0x80,0x5f,0xb0,0x4b,0x00,0x02,0x03,0x00,0xf7,0x0c,0x4f,0x9c,0xfb,0x4d,0xfa,0x04,
-0xff,0x8d,0xff,0x9c,0xf5,0x4f,0x80,0x5f,0x80,0x5f,0x84,0xf8,0x04,0xf8,0x04,0xf8,
-0x4f,0x80,0x4f,0x80,0x4f,0x0b,0x00,0xb6,0x80,0x5f,0x9c,0xfb,0x05,0xff,0x8c,0xf6,
-0x5f,0x80,0x4f,0x9c,0x00,0x00,0x07,0x00,0x50,0x90,0x03,0xcf,0xd6,0x01,0xa7,0x07,
-0xf0,0x10,0x60,0x1f,0xc8,0xf4,0x00,0xee,0x6f,0x60,0x1f,0xc1,0xfe,0x8c,0xf5,0x03,
-0xcf,0xd6,0x00,0x4f,0xbd,0xe9,0x04,0xfe,0x7b,0xf7,0x4f,0x80,0x1f,0xc4,0xf8,0x00,
-0xfd,0x07,0x00,0x30,0xff,0x8c,0xf7,0x15,0x00,0x02,0xa5,0x01,0x00,0x07,0x00,0xd0,
-0x05,0xde,0x8f,0x92,0xfe,0x8d,0xf9,0x7f,0x60,0x3f,0x98,0xf4,0x03,0x07,0x00,0x00,
-0x0e,0x00,0x34,0x05,0xde,0xaf,0x8c,0x01,0x01,0x07,0x00,0xc2,0x04,0xfa,0xd9,0x4f,
-0xfc,0x64,0xf9,0x00,0x4f,0x80,0x04,0xf8,0x05,0x00,0xf0,0x06,0x07,0xef,0xc4,0x04,
-0xfb,0x5e,0xf0,0x5f,0xa2,0x23,0x00,0x8f,0xfe,0x60,0x24,0x04,0xdf,0x16,0xfa,0x5d,
-0xf1,0x18,0x05,0xf1,0x08,0x07,0x70,0x00,0xfe,0x00,0xff,0xff,0x15,0xff,0x50,0x0f,
-0xe0,0x00,0xfe,0x00,0x0f,0xe0,0x00,0xdf,0x81,0x05,0xee,0x10,0xb5,0x00,0x26,0x04,
-0xf9,0x07,0x00,0x00,0x67,0x00,0xf2,0x5d,0x08,0xee,0x9f,0x90,0xcf,0x20,0x9f,0x46,
-0xf6,0x0d,0xf0,0x1f,0xb2,0xfa,0x00,0xcf,0x6f,0x40,0x06,0xfe,0xf0,0x00,0x1f,0xfa,
-0x00,0x00,0xcf,0x50,0x00,0xbf,0x00,0xf9,0x08,0xf3,0x7f,0x45,0xfd,0x0b,0xf0,0x3f,
-0x79,0xff,0x2e,0xb0,0x0e,0xae,0x8f,0x9f,0x70,0x0b,0xff,0x3a,0xff,0x30,0x07,0xfe,
-0x06,0xff,0x00,0x03,0xf9,0x01,0xfb,0x00,0x7f,0x70,0xcf,0x20,0xee,0x7f,0x90,0x05,
-0xff,0xe1,0x00,0x0f,0xfa,0x00,0x07,0xff,0xf2,0x01,0xee,0x5f,0xa0,0x9f,0x60,0xbf,
-0x30,0xdf,0x20,0x9f,0x57,0xf7,0x0e,0xf0,0x2f,0xb3,0xfa,0x00,0xdf,0x8f,0x50,0x07,
-0xff,0xf0,0x00,0x2f,0x55,0x00,0xf0,0x08,0x0b,0xf0,0x00,0x29,0xf9,0x00,0x03,0xfc,
-0x10,0x00,0x7f,0xff,0xff,0x13,0x77,0xbf,0xb0,0x00,0x1e,0xe1,0x00,0x0c,0xf4,0x4d,
-0x03,0xf6,0x1b,0x04,0xff,0x87,0x71,0x8f,0xff,0xff,0x20,0x00,0x16,0x00,0x1e,0xc0,
-0x07,0xf3,0x00,0x8f,0x10,0x09,0xf1,0x01,0xce,0x00,0xbf,0x40,0x03,0xec,0x00,0x09,
-0xf0,0x00,0x8f,0x10,0x07,0xf2,0x00,0x2f,0xa0,0x00,0x39,0x00,0xe3,0x01,0x00,0xf0,
-0x16,0x43,0x00,0x8f,0x40,0x0e,0xb0,0x0c,0xd0,0x0c,0xd0,0x09,0xf3,0x01,0xef,0x08,
-0xf6,0x0c,0xe0,0x0c,0xd0,0x0d,0xc0,0x6f,0x60,0x65,0x00,0x07,0xec,0x30,0xba,0x2f,
-0xbc,0xf9,0xf7,0x2a,0x10,0x9e,0x3c,0x05,0x10,0x30,0x9d,0x07,0xf0,0x15,0x4f,0x50,
-0x00,0x00,0x00,0x04,0xee,0x40,0x0c,0xff,0xff,0xfc,0x3e,0x40,0xe4,0x22,0x22,0x00,
-0x4e,0x3e,0x20,0x00,0x00,0x00,0x8d,0xe3,0x11,0x11,0x00,0x3e,0x4d,0xff,0xff,0xfb,
-0x3e,0x40,0x21,0x00,0x10,0x50,0x2c,0x00,0x10,0x60,0x74,0x08,0x24,0x40,0x00,0x3c,
-0x00,0x10,0x5f,0x0b,0x00,0x20,0x4e,0xe4,0x05,0x00,0x11,0x3c,0x3f,0x00,0xf0,0x08,
-0x02,0x22,0x24,0xed,0x80,0x00,0x00,0x00,0x2e,0x4e,0x30,0x01,0x11,0x13,0xe0,0x4e,
-0x3b,0xff,0xff,0xfd,0x00,0x5e,0xe4,0x2c,0x00,0x21,0x6f,0x40,0xbb,0x20,0x01,0x68,
-0x08,0x20,0x2b,0x20,0x24,0x00,0xf3,0x15,0xee,0x20,0x00,0x00,0x2e,0xa0,0xae,0x20,
-0x00,0x1d,0xa0,0x00,0xad,0x10,0x1d,0xd4,0x00,0x04,0xdd,0x13,0xcc,0xf2,0x02,0xfc,
-0xc3,0x00,0x0f,0x20,0x2f,0x00,0x00,0x00,0xf2,0x02,0xf0,0x00,0x0b,0x00,0xe0,0xf3,
-0x13,0xf0,0x00,0x00,0x0d,0xff,0xfd,0x00,0x00,0x00,0x0c,0xff,0xfc,0x11,0x00,0x3d,
-0x23,0xf0,0x00,0x27,0x00,0xf0,0x0a,0x33,0xf2,0x02,0xf3,0x30,0x3f,0xfd,0x10,0x1d,
-0xff,0x30,0x6e,0x30,0x00,0x3e,0x60,0x00,0x5e,0x40,0x4e,0x50,0x00,0x00,0x4e,0x8e,
-0x76,0x00,0x26,0x3c,0x30,0x41,0x21,0x11,0xa0,0x91,0x00,0x00,0xd2,0x00,0x20,0x0e,
-0xfe,0x61,0x0b,0xf0,0x15,0xf4,0xf6,0x00,0x00,0x00,0xe9,0x09,0xe0,0x00,0x00,0x7f,
-0x10,0x1f,0x70,0x00,0x1f,0x80,0x00,0x8f,0x10,0x08,0xe0,0x00,0x00,0xe8,0x01,0xfc,
-0x88,0x88,0x8c,0xf1,0x9f,0xff,0xff,0xff,0xff,0xca,0x08,0xf0,0x2e,0x3b,0xc5,0x00,
-0x00,0x02,0x1e,0x86,0xf2,0x00,0x4d,0xf7,0xf0,0x0d,0x50,0x4f,0x60,0x7f,0xb9,0xf1,
-0x0e,0x60,0x09,0xff,0xe6,0x04,0xe0,0x00,0xcf,0xa1,0xd4,0x5c,0x00,0x0e,0x60,0x0c,
-0x63,0xe0,0x01,0x20,0x00,0xe4,0x0e,0x60,0x00,0x00,0x6e,0x00,0x4f,0x70,0x00,0x7f,
-0x50,0x00,0x4d,0xfe,0xfd,0x40,0x00,0x00,0x02,0x42,0x3b,0x01,0xf0,0x0b,0x11,0x10,
-0x00,0x00,0x00,0xbf,0xff,0x72,0x00,0x08,0xc1,0xdf,0xc3,0xf5,0x04,0x98,0x02,0xe2,
-0x07,0xb4,0x5d,0x00,0x01,0x00,0x1b,0x4d,0x5f,0x00,0xf0,0x3e,0xbe,0x68,0x00,0x00,
-0x00,0x09,0x6a,0xd0,0x00,0x00,0x00,0xb9,0x1a,0xa0,0x00,0x00,0x9d,0x00,0x88,0xc4,
-0x25,0xb9,0x60,0x00,0x69,0xe9,0xf6,0x70,0x00,0x00,0x05,0x25,0x00,0x00,0x00,0x28,
-0x01,0x32,0x00,0x00,0x01,0xee,0xef,0xef,0xd5,0x00,0x0d,0x90,0xbc,0x10,0x5f,0x70,
-0x0b,0xc1,0x0b,0xd0,0x03,0xf3,0x07,0xfd,0x1a,0xc0,0x00,0x99,0x0b,0x7a,0xfc,0x10,
-0x00,0x5c,0x0b,0x60,0x61,0x00,0x00,0x5c,0x08,0xe4,0x00,0xf3,0x04,0x89,0x01,0xf4,
-0x00,0x00,0x02,0xf3,0x00,0x6f,0x60,0x00,0x5e,0x70,0x00,0x04,0xdf,0xef,0xd5,0x00,
-0x8a,0x00,0xf0,0x20,0x0c,0xee,0xee,0xee,0x10,0x01,0xfa,0x66,0x6b,0xb0,0x00,0x6f,
-0x10,0x00,0xd5,0x00,0x0b,0xb0,0x00,0x5e,0x00,0x00,0x7e,0x00,0x6d,0x40,0x00,0x2d,
-0xf3,0x7b,0x10,0x00,0x0d,0x8b,0x3d,0xd0,0x00,0x03,0xf0,0xd4,0x8e,0x30,0x00,0x3f,
-0x15,0x10,0xf3,0xc8,0x0b,0x60,0x8d,0x00,0x00,0x02,0xdf,0xfd,0xba,0x01,0x20,0x33,
-0x00,0xa8,0x00,0xc0,0xaa,0x60,0x00,0x00,0xef,0xfa,0x10,0xcb,0xbb,0xba,0xaa,0xbc,
-0xd8,0x09,0xf0,0x03,0xc0,0x5f,0xff,0xd0,0xbc,0x00,0x22,0x21,0x0c,0xc0,0x13,0x33,
-0x20,0xcc,0x05,0xee,0xec,0x0c,0x64,0x02,0xd0,0xc9,0xcb,0xde,0xed,0xb9,0x00,0x0e,
-0xff,0xa0,0x00,0x00,0x56,0x63,0x38,0x00,0xf0,0x2a,0x57,0x62,0x04,0x00,0x06,0xef,
-0xff,0xf1,0xad,0x47,0xfb,0x30,0x24,0x0a,0x39,0xfa,0x00,0x00,0x00,0xa2,0x03,0xc5,
-0x00,0x00,0x0a,0x20,0x00,0xc8,0x00,0x00,0xa2,0x00,0x98,0x00,0x00,0x0a,0x22,0xc6,
-0x00,0x00,0x00,0xa7,0xcf,0xb0,0x00,0x00,0x0a,0xa0,0x5f,0xc5,0x23,0x50,0x20,0x00,
-0x4d,0xff,0xff,0x49,0x0a,0xf0,0x19,0x54,0x00,0x89,0x99,0x99,0x99,0x8c,0x2f,0xd1,
-0x11,0x2b,0xb0,0x65,0x06,0xef,0xfb,0x0b,0x93,0xdf,0xff,0xb0,0xfd,0x00,0x69,0xdb,
-0x02,0x20,0x00,0x0b,0xb0,0xeb,0x00,0x00,0xbb,0x0f,0xd0,0x00,0x0b,0xb0,0x76,0x09,
-0x00,0x81,0xe0,0x00,0x0b,0xea,0xff,0xaa,0xaa,0xe0,0xf2,0x01,0xf0,0x2b,0x18,0xde,
-0xd8,0x10,0x00,0x3e,0xad,0x6a,0xbe,0x30,0x1e,0x70,0xc5,0x70,0x7e,0x18,0xb0,0x0c,
-0x57,0x00,0xb8,0xc5,0x00,0xbd,0x60,0x05,0xce,0x30,0x24,0x06,0x90,0x2e,0xd4,0x4b,
-0xe3,0xe7,0xc7,0xd9,0xcb,0x8b,0x04,0xc6,0xd9,0x2f,0xa9,0x00,0x00,0xbf,0x20,0x5f,
-0x71,0x01,0x7e,0x50,0x00,0x3b,0xff,0xfb,0x37,0x02,0xf2,0x32,0x20,0x00,0x00,0x03,
-0xbd,0x80,0x00,0x00,0x03,0xe6,0x4b,0xb0,0x00,0x00,0xa7,0x00,0x0f,0x12,0x62,0x0a,
-0x60,0x00,0xe7,0xff,0xf4,0x6d,0x10,0x6d,0xbf,0xff,0xb0,0x9f,0xef,0x7a,0xff,0xfa,
-0x07,0xe9,0xcf,0xff,0xfe,0x23,0xe1,0x4f,0xff,0xff,0xe1,0x96,0x1e,0xff,0xff,0xff,
-0x8c,0x38,0xff,0xff,0xff,0xfb,0xcf,0xfd,0xdd,0xdd,0xdd,0x90,0x11,0x77,0x02,0x20,
-0x61,0x00,0x6b,0x03,0x11,0xd2,0x06,0x00,0xf1,0x05,0xe3,0x00,0x02,0x43,0x33,0x37,
-0xe3,0x00,0xaf,0xff,0xff,0xff,0xf4,0x03,0x66,0x66,0x66,0x66,0x60,0x09,0x67,0x02,
-0x90,0x08,0xf9,0x88,0x88,0x95,0x00,0x07,0xd1,0x00,0x99,0x02,0x01,0x06,0x00,0x25,
-0x05,0x90,0xb9,0x02,0x20,0x68,0x50,0xc1,0x01,0xf0,0x24,0x48,0xc9,0x10,0x00,0x00,
-0x8c,0xa4,0x4c,0x30,0x00,0x03,0x22,0x8b,0x20,0x00,0x00,0x5a,0xc5,0x10,0x00,0x06,
-0x86,0x97,0x30,0x00,0x1c,0xb0,0x10,0xab,0x00,0x0a,0xf2,0x7f,0x82,0xf9,0x00,0xaf,
-0x29,0xfa,0x1f,0x90,0x01,0xda,0x04,0x09,0xd1,0x00,0x01,0x8b,0x9a,0x81,0x76,0x02,
-0xfa,0x0a,0xfd,0x10,0x0d,0x63,0x36,0x9d,0x10,0xd3,0x00,0xb0,0xbd,0x0d,0x30,0x0a,
-0xc9,0xe3,0xd3,0x00,0x00,0x0d,0x3d,0x30,0x00,0x00,0xd3,0x09,0x00,0x60,0x40,0x00,
-0x00,0xd3,0xcf,0xff,0x74,0x04,0x01,0xbc,0x0b,0x10,0x53,0x06,0x00,0xf0,0x2b,0xa9,
-0x6a,0x90,0x00,0x00,0x06,0x70,0x00,0x8d,0xc7,0x00,0x0a,0x10,0x00,0x00,0x09,0x40,
-0x1d,0x10,0x00,0x47,0x33,0x90,0xa3,0x38,0xcf,0xda,0x33,0x80,0xc0,0x68,0x58,0x00,
-0x04,0xb0,0xb0,0x00,0x4f,0x90,0x00,0xa2,0xa1,0x00,0xdf,0xf3,0x00,0x83,0x2c,0x20,
-0x00,0x00,0x01,0xc0,0x02,0xbb,0xbb,0xbb,0xbb,0x3f,0x01,0x11,0x4d,0xf2,0x00,0xf0,
-0x1b,0xf0,0x87,0x00,0x00,0x00,0x7f,0x2f,0x40,0x19,0xd8,0x6e,0xae,0x30,0x0a,0xb3,
-0x7b,0x60,0xd4,0x01,0xf1,0x00,0x9b,0x4f,0x20,0x5b,0x00,0x01,0xbf,0x60,0x08,0x70,
-0x00,0x04,0xf0,0x00,0xa5,0x00,0x00,0x4f,0x00,0x0c,0x30,0x0b,0x00,0x10,0xe2,0x0b,
-0x00,0x02,0x01,0x00,0xf0,0x38,0x07,0xe8,0x01,0xe0,0xd2,0x1e,0x0d,0x20,0x8e,0x80,
-0x00,0x10,0x0d,0xf9,0x1f,0xfd,0x0b,0xf7,0x01,0x00,0x00,0x01,0xfb,0x50,0x00,0x07,
-0xcf,0xe8,0x20,0x00,0x4e,0xf7,0x08,0xdf,0xd8,0x11,0xfa,0x40,0x00,0x09,0x88,0x88,
-0x31,0xff,0xff,0xf6,0x00,0x00,0x01,0xc8,0x00,0x2d,0xf9,0x00,0x1d,0xf6,0x00,0x2a,
-0x00,0x00,0x10,0x02,0xde,0xd2,0x97,0x07,0x99,0x90,0x98,0x1b,0xfb,0x7b,0x03,0x04,
-0xf1,0x04,0xf1,0x26,0x28,0x79,0xf9,0x8a,0xd8,0x03,0xff,0xff,0xff,0xeb,0x50,0x01,
-0x19,0xe1,0x08,0x40,0x00,0x00,0xaf,0xbd,0xfb,0x10,0x00,0x9f,0xfa,0xcf,0xee,0x20,
-0xaf,0xdd,0x0e,0x91,0xfb,0x4f,0x68,0xea,0xf1,0x0b,0xea,0xe0,0x6f,0xf6,0x00,0xed,
-0xbe,0x8d,0xf8,0x01,0xaf,0x64,0xef,0xcf,0x6b,0x03,0x04,0x41,0x68,0x30,0x00,0x24,
-0x4a,0x00,0xd0,0x8f,0x40,0x00,0x06,0xd2,0x00,0x7f,0x40,0x00,0x03,0xfb,0x00,0x7f,
-0x41,0x00,0x30,0x20,0x6f,0x40,0xc0,0x06,0xf0,0x0d,0x5f,0x60,0x01,0x00,0x0f,0xc0,
-0x2f,0x90,0x3c,0x00,0x0d,0xf0,0x0e,0xe0,0xaf,0x30,0x0a,0xd1,0x08,0xff,0xfc,0x00,
-0x01,0x00,0x00,0xcf,0xe2,0x00,0xbd,0x01,0x11,0x00,0xd9,0x01,0x01,0x0e,0x04,0x10,
-0xff,0x98,0x0a,0xf0,0x05,0x01,0x35,0x79,0x10,0x00,0x01,0x12,0x34,0x60,0x00,0x0a,
-0xff,0xff,0xff,0x80,0x00,0x68,0x76,0xcf,0xa0,0x29,0x01,0x10,0x80,0x05,0x00,0x10,
-0xf8,0xa8,0x04,0xf1,0x07,0xcd,0xf3,0x00,0x00,0x6f,0xb0,0x3f,0xa1,0x23,0x5f,0xd0,
-0x00,0xdf,0xff,0xd0,0x62,0x00,0x01,0x78,0x85,0x00,0x1f,0x15,0x02,0xf0,0x30,0x0f,
-0x80,0x00,0x20,0x00,0x46,0x6f,0xdc,0xe1,0xfa,0x10,0x8f,0xff,0xfd,0x90,0x8f,0xf3,
-0x02,0x2f,0x70,0x00,0x02,0xc1,0x00,0x0f,0x96,0x87,0x40,0x00,0x00,0x6f,0xff,0xef,
-0xfb,0x00,0x1c,0xff,0x90,0x00,0x8f,0x40,0xaf,0x2f,0x80,0x00,0x4f,0x60,0xce,0x3f,
-0x81,0x26,0xef,0x20,0x4f,0xff,0x67,0xff,0xf6,0x00,0x01,0x77,0x01,0x75,0x43,0x00,
-0x21,0x75,0x00,0x49,0x00,0x11,0xd0,0x4f,0x0e,0xf4,0x2d,0xf9,0x00,0x0b,0xc0,0x01,
-0xab,0xcf,0xff,0xc3,0x8f,0x50,0x1f,0xde,0xf9,0x9f,0xb0,0xfd,0x00,0x00,0xce,0x00,
-0xbe,0x09,0xf3,0x00,0x1f,0xa0,0x0b,0xd0,0x4f,0x80,0x07,0xf4,0x00,0xcc,0x00,0x40,
-0x00,0xde,0x00,0x0f,0xa0,0x00,0x00,0x6f,0x83,0x27,0xf7,0x00,0x00,0x0e,0xf1,0x9f,
-0xfe,0x10,0x00,0x00,0x14,0x02,0x66,0x60,0x01,0xf0,0x36,0x04,0x00,0x00,0x07,0x50,
-0x00,0x76,0xf3,0x00,0x01,0xfb,0x00,0x05,0xe6,0x50,0x00,0x3f,0x80,0x00,0xab,0x00,
-0x2a,0xbd,0xff,0xfc,0x2a,0xf3,0x03,0xfd,0xef,0x89,0xfa,0x2f,0xb0,0x00,0x0d,0xd0,
-0x0c,0xc0,0xbf,0x20,0x03,0xf8,0x00,0xdc,0x06,0xf7,0x00,0x8f,0x30,0x0e,0xb0,0x15,
-0x00,0x0e,0xd0,0x01,0xf9,0x00,0x00,0x07,0xf7,0x31,0x8f,0x50,0x00,0x00,0xef,0x1b,
-0x21,0x0e,0x41,0x03,0x50,0x37,0x61,0x52,0x00,0xf0,0x0f,0x37,0x10,0x00,0x00,0x43,
+0x05,0x06,0x07,0x08,0xe7,0x01,0xf8,0xff,0xff,0xd1,0x0c,0x0d,0x0e,0x0f,0x10,0x00,
+0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x1d,0x00,0x1e,0x1f,
+0x00,0x20,0x21,0x22,0x23,0x24,0x25,0x00,0x26,0x27,0x28,0x29,0x2a,0x00,0x00,0x04,
+0x00,0x0d,0x00,0x11,0x1d,0x1b,0x1d,0x1c,0x1d,0x1e,0x1d,0x32,0x1d,0x3e,0x1d,0x68,
+0x1d,0x97,0x1d,0xe7,0x1d,0xe9,0x1d,0x07,0x1e,0x0c,0x1e,0x5e,0x1e,0x5f,0x1e,0x64,
+0x1e,0x6d,0x1e,0x90,0x1e,0xee,0x1e,0xf2,0x1e,0xff,0x1e,0x1e,0x1f,0x35,0x1f,0x60,
+0x1f,0x6d,0x1f,0x85,0x1f,0xaa,0x1f,0xe0,0x1f,0x54,0x20,0x56,0x20,0x59,0x20,0x76,
+0x20,0x79,0x20,0x7d,0x20,0x82,0x20,0x88,0x20,0x96,0x20,0x97,0x20,0x9e,0x20,0x0b,
+0x21,0x17,0x21,0x2e,0x21,0x36,0x21,0x3a,0x21,0x4c,0x21,0x5b,0x21,0x5e,0x21,0x83,
+0x21,0xac,0x21,0xb0,0x21,0xb1,0x21,0xca,0x21,0xe6,0x21,0x27,0x22,0x69,0x22,0xcc,
+0x22,0xe8,0x22,0x04,0x23,0x08,0x23,0x19,0x23,0x1d,0x23,0x1e,0x23,0x22,0x23,0x37,
+0x23,0x3c,0x23,0x5b,0x23,0x79,0x23,0x60,0x24,0x79,0x25,0xef,0x25,0x03,0x26,0x0b,
+0x26,0x0e,0x26,0x38,0x26,0x39,0x26,0x58,0x26,0xdc,0x26,0x42,0x27,0x68,0x27,0xa8,
+0x27,0x01,0x28,0x1a,0x28,0x27,0x28,0x2b,0x28,0x38,0x28,0x3f,0x28,0x42,0x28,0x79,
+0x28,0x69,0x2a,0x9d,0x2a,0xab,0x2a,0xb0,0x2a,0xca,0x2a,0x0f,0x2b,0x20,0x2b,0x22,
+0x2b,0xf7,0x2c,0xff,0x2c,0x49,0x2d,0x84,0x2d,0xb7,0x2d,0xb8,0x2d,0x07,0x2e,0x20,
+0x2e,0x42,0x2e,0x46,0x2e,0x48,0x2e,0x64,0x2e,0x73,0x2e,0x82,0x2e,0x96,0x2e,0x9d,
+0x2e,0xba,0x2e,0xbf,0x2e,0xd6,0x2e,0xed,0x2e,0x36,0x2f,0xd6,0x2f,0x04,0x30,0x20,
+0x30,0x5c,0x30,0x21,0x31,0x5c,0x31,0xaf,0x31,0xcd,0x31,0xe3,0x31,0xf2,0x31,0x12,
+0x32,0x50,0x32,0xb6,0x32,0xb9,0x32,0xd4,0x32,0xec,0x32,0xde,0x33,0x68,0x34,0x81,
+0x34,0x98,0x34,0xc1,0x34,0xca,0x34,0xf3,0x34,0xf6,0x34,0x1f,0x35,0x53,0x35,0x80,
+0x35,0x05,0x36,0x09,0x36,0x11,0x36,0x1a,0x36,0x30,0x36,0x3b,0x36,0x3c,0x36,0x3d,
+0x36,0x72,0x36,0xb1,0x36,0x4d,0x37,0x2d,0x38,0x86,0x38,0x93,0x38,0xdc,0x38,0x2a,
+0x39,0x70,0x39,0x73,0x3a,0x74,0x3a,0x9c,0x3a,0xdf,0x3a,0xe5,0x3a,0x28,0x3b,0x71,
+0x3b,0xe6,0x3b,0xf3,0x3b,0x99,0x3c,0x2c,0x3d,0x3a,0x3d,0xa1,0x3d,0xa7,0x3d,0x25,
+0x3e,0x81,0x3e,0x32,0x40,0xc7,0x41,0x98,0x42,0x0f,0x43,0x17,0x43,0x30,0x44,0x39,
+0x44,0x4c,0x44,0x7b,0x44,0x8c,0x45,0x51,0x46,0xcb,0x47,0x4b,0x48,0xe3,0x48,0x01,
+0x49,0x0c,0x49,0x8b,0x49,0x92,0x49,0x00,0x4a,0x3d,0x4a,0x65,0x4a,0xa8,0x4a,0xb2,
+0x4a,0xd5,0x4a,0xcf,0x4b,0x31,0x4c,0x33,0x4c,0x41,0x4c,0x53,0x4c,0x5d,0x4c,0x82,
+0x4c,0xaa,0x4c,0xab,0x4c,0xdb,0x4c,0xe2,0x4c,0xeb,0x4c,0xf9,0x4c,0x7f,0x4e,0x83,
+0x4e,0x14,0x4f,0x16,0x4f,0xdd,0x4f,0x0e,0x50,0xfb,0x50,0x80,0x51,0x83,0x51,0x46,
+0x54,0x5d,0x57,0x6e,0x57,0x79,0x57,0x81,0x57,0xd6,0x57,0x0e,0x58,0x18,0x58,0x92,
+0x58,0x9c,0x58,0xa0,0x58,0xa7,0x58,0xf4,0x58,0x11,0x59,0x19,0x59,0x29,0x59,0x3e,
+0x59,0x4d,0x59,0x83,0x59,0x84,0x59,0x9e,0x59,0xaf,0x59,0xbd,0x59,0xbe,0x59,0xe7,
+0x59,0x69,0x5a,0x77,0x5a,0xcc,0x5b,0xcd,0x5b,0x75,0x5c,0x88,0x5c,0x96,0x5c,0xee,
+0x5c,0x09,0x5e,0x14,0x5e,0x2e,0x5e,0xcd,0x5e,0x0e,0x5f,0x12,0x5f,0x2b,0x5f,0x30,
+0x5f,0x56,0x5f,0x5f,0x5f,0x7a,0x5f,0x89,0x5f,0xf9,0x5f,0xe0,0x60,0x43,0x62,0x88,
+0x64,0x9c,0x64,0xa4,0x64,0x75,0x65,0xd7,0x65,0xf3,0x65,0x0c,0x66,0x63,0x66,0x6f,
+0x66,0x73,0x66,0xe4,0x66,0x04,0x67,0x17,0x67,0x5d,0x67,0xec,0x67,0xe9,0x69,0x12,
+0xbf,0x19,0xbf,0x1c,0xbf,0x1d,0xbf,0x1e,0xbf,0x22,0xbf,0x24,0xbf,0x26,0xbf,0x2a,
+0xbf,0x2d,0xbf,0x32,0xbf,0x37,0xbf,0x38,0xbf,0x39,0xbf,0x4f,0xbf,0x54,0xbf,0x59,
+0xbf,0x5c,0xbf,0x5d,0xbf,0x5e,0xbf,0x62,0xbf,0x63,0xbf,0x64,0xbf,0x65,0xbf,0x78,
+0xbf,0x79,0xbf,0x7f,0xbf,0x81,0xbf,0x82,0xbf,0x85,0xbf,0x88,0xbf,0x89,0xbf,0x8a,
+0xbf,0x8c,0xbf,0xa4,0xbf,0xa6,0xbf,0xd5,0xbf,0xd6,0xbf,0xd8,0xbf,0xda,0xbf,0xf1,
+0xbf,0xf8,0xbf,0xfb,0xbf,0x04,0xc0,0x2d,0xc0,0x35,0xc0,0x6c,0xc0,0xfc,0xc0,0x51,
+0xc1,0x52,0xc1,0x53,0xc1,0x54,0xc1,0x55,0xc1,0x98,0xc1,0xa4,0xc1,0xfe,0xc1,0x15,
+0xc2,0x6b,0xc4,0xd3,0xc6,0xb3,0xc7,0x00,0x01,0x00,0x2f,0xfa,0x00,0x01,0x00,0x56,
+0x13,0xfc,0x08,0x00,0x17,0xf4,0x14,0x00,0xbf,0xfb,0xfa,0x00,0xfe,0xf7,0x00,0xf7,
+0x00,0x00,0x00,0x01,0x85,0x00,0x53,0x4f,0x02,0x04,0x00,0x02,0x69,0x00,0x52,0x2f,
+0xe3,0x00,0x01,0x00,0x68,0x1f,0xe7,0x71,0x00,0x5d,0x03,0xd4,0x01,0xb2,0xf8,0x00,
+0xfe,0x00,0x00,0xf4,0xfe,0xf8,0xfc,0x00,0xf1,0xdf,0x01,0x7f,0xff,0x00,0x00,0xfe,
+0xff,0xfb,0xfd,0xde,0x01,0x51,0x3f,0xfd,0x00,0xfe,0xcf,0x02,0x57,0x1c,0xfd,0x0a,
+0x00,0x19,0xff,0x1f,0x00,0x1f,0xfe,0x69,0x01,0x4a,0x00,0x5e,0x00,0x7f,0xf7,0x00,
+0xfe,0x00,0xfe,0xfc,0xfe,0xe8,0x01,0x5d,0x15,0x02,0xe2,0x00,0x11,0xfe,0x87,0x00,
+0x2f,0xfe,0xfd,0x83,0x00,0x4a,0x75,0xe4,0x00,0x00,0x00,0xed,0x00,0xeb,0x77,0x00,
+0x20,0xfd,0xfe,0x73,0x00,0x01,0x7e,0x00,0x0f,0xea,0x00,0x51,0x10,0xfd,0x08,0x00,
+0x1f,0xfd,0x61,0x01,0x5a,0x1f,0xfe,0x2e,0x04,0x60,0x19,0xef,0xd1,0x02,0x01,0x0c,
+0x00,0x10,0xfd,0x8b,0x00,0x2f,0xfc,0xfa,0x1d,0x05,0x4d,0xa6,0x02,0xfa,0x00,0x00,
+0xeb,0xfe,0xeb,0xf7,0x00,0xe4,0x1c,0x00,0x3f,0xff,0xf4,0xfb,0xed,0x00,0x49,0x72,
+0xd7,0x00,0x00,0x00,0xee,0x00,0xed,0x9f,0x04,0x51,0x00,0xfc,0x00,0xff,0xff,0xbd,
+0x03,0x1f,0x01,0x17,0x06,0x54,0x10,0xfd,0xc4,0x02,0x1f,0xfc,0xe3,0x01,0x5e,0x10,
+0xfb,0x59,0x02,0x0f,0x58,0x01,0x4a,0x09,0x51,0x08,0xc0,0xe6,0xe4,0x00,0x00,0xf4,
+0xfd,0xea,0xfe,0x02,0x00,0x02,0x02,0x59,0x01,0xdf,0xef,0xf7,0x00,0xf7,0xeb,0xf9,
+0xf8,0x00,0xf9,0xf8,0xfb,0xf8,0xfa,0xb2,0x03,0x47,0x66,0xea,0xf0,0x00,0x00,0xf8,
+0xff,0x11,0x00,0x50,0xfb,0xfc,0x00,0x00,0xfb,0xce,0x02,0x18,0xff,0xbb,0x04,0x0f,
+0x77,0x00,0x3e,0x22,0xf1,0xfa,0xdd,0x08,0x03,0xe5,0x06,0x33,0x01,0xfd,0xfd,0xaa,
+0x04,0x1f,0x00,0xd8,0x08,0x4b,0x14,0xf0,0xb8,0x03,0x15,0x01,0xb8,0x03,0x02,0x94,
+0x05,0x0f,0xbf,0x02,0x48,0xf0,0x0a,0x02,0xfb,0xe9,0xf1,0x00,0x00,0xf1,0xfd,0xf6,
+0xfe,0x02,0xf6,0x02,0x02,0x01,0x02,0x00,0x02,0xfa,0xf9,0xfe,0xfc,0xf9,0xfc,0xfa,
+0x8d,0x06,0x3f,0xfe,0xfd,0x02,0x64,0x02,0x4a,0x2a,0x01,0xfd,0x2a,0x05,0x02,0xee,
+0x00,0x1f,0xfd,0x96,0x05,0x52,0x1f,0xfe,0x03,0x06,0x73,0x0f,0x87,0x00,0x47,0x0f,
+0x47,0x01,0x0a,0x1f,0xff,0x73,0x07,0x46,0x1f,0xff,0x22,0x0b,0x63,0x1f,0xff,0x94,
+0x00,0x63,0x1e,0x02,0x87,0x04,0x19,0x02,0xd4,0x01,0x0f,0xa6,0x04,0x43,0x1f,0xf8,
+0x8d,0x0c,0x69,0x0f,0xe2,0x08,0x5e,0x1f,0xf7,0x7f,0x00,0x0b,0x2f,0xfe,0xfe,0x32,
+0x0a,0x47,0x1c,0xee,0x55,0x03,0x20,0xfe,0x02,0x1b,0x06,0x10,0x05,0x08,0x07,0x0f,
+0x01,0x00,0x5c,0x1f,0xfd,0x20,0x0b,0x4f,0x1c,0xef,0x5c,0x01,0x2f,0xff,0x01,0x28,
+0x05,0x51,0x1f,0xf3,0xca,0x02,0x77,0x1f,0xfc,0x77,0x00,0x63,0x1f,0xfe,0x6c,0x00,
+0xc1,0x0f,0x55,0x12,0x23,0x0f,0x82,0x01,0x0c,0x0b,0xed,0x03,0x1f,0xfc,0xe6,0x0a,
+0x35,0x0f,0x38,0x13,0x58,0x15,0xfa,0x6d,0x00,0x21,0xfa,0xf6,0x0a,0x00,0x1e,0xf1,
+0xb8,0x13,0x0e,0xf9,0x10,0x03,0x1d,0x01,0x3f,0xfc,0xfc,0xfc,0x54,0x01,0x34,0x1f,
+0xf8,0xcb,0x01,0x6d,0x0f,0x01,0x00,0x44,0x2f,0xf1,0xf6,0xe7,0x00,0x06,0x0f,0x91,
+0x00,0x49,0x13,0xf6,0x77,0x00,0x1f,0x04,0xa2,0x07,0x6c,0x04,0x5d,0x02,0x1f,0x08,
+0xee,0x00,0x52,0x0f,0x1e,0x04,0x5d,0x0a,0x5c,0x02,0x1f,0xf1,0x9e,0x04,0x64,0x1e,
+0xf4,0x2f,0x04,0x0f,0x63,0x02,0x41,0x2b,0xef,0xeb,0xca,0x02,0x02,0x75,0x08,0x1f,
+0xf1,0x2b,0x04,0x11,0x03,0xc1,0x15,0x3f,0xed,0xf1,0xed,0x41,0x03,0x1f,0x1f,0xeb,
+0xdf,0x09,0x02,0x1f,0xf6,0x3c,0x00,0x12,0x03,0x07,0x00,0x2f,0xf1,0xf1,0x81,0x10,
+0x3b,0x0f,0x30,0x03,0x4f,0x0e,0xc9,0x01,0x0f,0x01,0x00,0x5b,0x00,0x5f,0x01,0x1f,
+0x06,0x66,0x00,0x4e,0x1f,0xf8,0x98,0x04,0x63,0x52,0xf6,0xfa,0xfa,0x00,0xfa,0xf9,
+0x06,0x00,0xd0,0x01,0x23,0xf4,0xfc,0x63,0x01,0x10,0xf6,0xf7,0x00,0x1f,0xfc,0xee,
+0x00,0x48,0x0f,0xed,0x08,0x62,0x16,0xf8,0xe9,0x07,0x00,0xee,0x00,0x20,0xfa,0xf8,
+0x08,0x00,0x3f,0xfe,0x00,0xf6,0xaa,0x13,0x50,0x00,0x4d,0x01,0x3f,0xfc,0x02,0x02,
+0xc8,0x0a,0x5f,0x1f,0xfa,0x36,0x0a,0x8a,0x0f,0x6f,0x08,0x49,0x2f,0xf1,0xf6,0x64,
+0x02,0x62,0x1f,0xf8,0x66,0x00,0x5c,0x1f,0xfa,0xd5,0x08,0x58,0x18,0xfa,0xea,0x07,
+0x01,0x87,0x00,0x2f,0xf8,0xfc,0x4f,0x02,0x5b,0x1f,0xfc,0x16,0x0c,0x58,0x0c,0xdc,
+0x00,0x0f,0x5a,0x10,0x5e,0x0f,0xb2,0x0a,0x18,0x1f,0xfc,0x46,0x0c,0x2e,0x0c,0x39,
+0x11,0x1e,0xfc,0x7b,0x0d,0x0f,0x9e,0x06,0x5e,0x0f,0xba,0x0a,0x58,0x0f,0x39,0x0b,
+0x53,0x2f,0xeb,0xeb,0xba,0x01,0x0c,0x17,0xf6,0x8d,0x00,0x18,0xf8,0x1d,0x00,0x32,
+0xfc,0x00,0xed,0x6d,0x03,0x10,0xfc,0x6d,0x0e,0x23,0xf1,0xf6,0x04,0x0a,0x2f,0xf8,
+0xf4,0x87,0x05,0x35,0x00,0x65,0x11,0x06,0x5e,0x03,0x00,0x62,0x04,0x13,0xfc,0xb7,
+0x06,0x18,0xfc,0xf4,0x03,0x1f,0xfa,0xc3,0x06,0x18,0x1f,0xfa,0xfe,0x05,0x63,0x2f,
+0xf4,0xf4,0x9c,0x06,0x33,0x1f,0xfa,0x04,0x0d,0x24,0x0f,0x71,0x06,0x89,0x1e,0xfa,
+0x16,0x0c,0x0f,0xf7,0x00,0x23,0x2f,0xed,0xef,0x81,0x16,0x12,0x26,0xf8,0xf8,0x0a,
+0x02,0x05,0xaa,0x00,0x26,0xf4,0xf6,0x6e,0x03,0x2f,0xef,0xf8,0x6c,0x01,0x1a,0x2f,
+0xf1,0xef,0xdc,0x01,0x1d,0x1e,0x02,0xa1,0x01,0x0f,0xad,0x01,0x1f,0x2f,0xef,0xed,
+0xfd,0x01,0x21,0x02,0x86,0x00,0x44,0xf4,0xf8,0xf8,0xf8,0x75,0x0a,0x24,0xf1,0xfa,
+0x5d,0x05,0x0f,0x77,0x00,0x13,0x1f,0xef,0x61,0x03,0x0e,0x1f,0xfc,0x1c,0x00,0x07,
+0x05,0x05,0x01,0x3f,0xfe,0xf6,0xfa,0xe8,0x18,0x91,0x2f,0xed,0xed,0x6f,0x03,0x27,
+0x12,0xfc,0x65,0x01,0x0f,0xdc,0x01,0x22,0x1f,0xf1,0x56,0x19,0x27,0x0e,0x53,0x02,
+0x0f,0x1b,0x0b,0x53,0x06,0xab,0x14,0x0f,0x51,0x15,0x50,0x05,0xaa,0x00,0x28,0xfc,
+0xf4,0x5b,0x05,0x1f,0xf6,0xe7,0x11,0x5b,0x00,0xbc,0x10,0x1f,0xfa,0xdb,0x12,0x66,
+0x1f,0xfc,0xce,0x17,0x1b,0x1f,0xfe,0xb1,0x0d,0x2e,0x1f,0xfe,0xf9,0x06,0x47,0x0f,
+0x19,0x06,0x0e,0x1f,0xfc,0x77,0x00,0x63,0x0f,0x1b,0x18,0x58,0x1f,0xfa,0x84,0x00,
+0x27,0x0f,0x4c,0x05,0x1a,0x1f,0x04,0x77,0x00,0x36,0x2f,0xf4,0xf6,0xdc,0x01,0x35,
+0x1f,0xfe,0xca,0x02,0x55,0x0f,0x62,0x15,0x29,0x1f,0xfa,0x98,0x16,0x3c,0x0f,0x53,
+0x02,0x33,0x1f,0xf4,0xed,0x0a,0x14,0x1f,0xfa,0x77,0x00,0x3b,0x1f,0xf1,0xee,0x00,
+0x43,0x0f,0xbc,0x0f,0x29,0x1f,0xfc,0xa3,0x18,0x63,0x1f,0xf6,0xda,0x12,0x51,0x1f,
+0xfc,0x02,0x13,0x57,0x12,0xfc,0xe5,0x0d,0x1f,0xfa,0x80,0x00,0x13,0x1f,0xfc,0xe5,
+0x00,0x4f,0x1f,0x06,0xc5,0x0c,0x63,0x1f,0x06,0x78,0x00,0x05,0x1f,0x0a,0xd2,0x01,
+0x7f,0x0f,0x7b,0x0d,0x17,0x1f,0xfc,0x8b,0x23,0x14,0x1e,0xfa,0x2f,0x06,0x0f,0x2f,
+0x04,0x29,0x0f,0x19,0x03,0x44,0x0f,0x77,0x00,0x39,0x0f,0x2c,0x0f,0x46,0x2f,0x04,
+0x04,0x1a,0x19,0x36,0x0f,0x74,0x17,0xa2,0x09,0xa2,0x0b,0x0f,0x41,0x13,0x17,0x2f,
+0xef,0xef,0xb1,0x01,0x27,0x17,0xef,0x21,0x12,0x0f,0xf2,0x11,0x1c,0x1f,0xfc,0x26,
+0x02,0x3c,0x1f,0xfc,0x7b,0x0d,0x40,0x0b,0xd9,0x21,0x4f,0xfc,0xfe,0xfe,0xfe,0x82,
+0x0a,0x24,0x2f,0xf4,0xf8,0xe0,0x23,0x88,0x1f,0xfa,0x3f,0x01,0x0e,0x1f,0xfc,0xe9,
+0x12,0x63,0x0f,0x8d,0x0c,0x3c,0x1f,0xfa,0xf4,0x03,0x09,0x1e,0xfe,0x95,0x0f,0x0f,
+0x04,0x0d,0x42,0x19,0xfc,0x38,0x10,0x17,0xf6,0xd1,0x0f,0x2f,0xfc,0xfa,0x69,0x0e,
+0x2b,0x2e,0xf4,0xf4,0xa1,0x06,0x05,0xc8,0x02,0x28,0xf6,0xf6,0x52,0x01,0x44,0xf4,
+0xfc,0xfe,0xfe,0x2f,0x04,0x26,0xfa,0xf8,0x32,0x04,0x03,0xa2,0x31,0x21,0x02,0x03,
+0x91,0x06,0x2e,0x04,0x05,0xad,0x07,0x03,0xbc,0x3b,0x00,0xbd,0x3b,0x92,0x0c,0x0c,
+0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0xc1,0x3b,0x01,0x20,0x00,0xff,0x0c,0x1a,0x1b,
+0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,
+0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0xcb,0x00,0x08,0xf0,0x4e,0x29,0x2a,
+0x2b,0x00,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x00,0x33,0x00,0x34,0x35,0x00,0x00,
+0x36,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x00,0x3d,0x3e,0x3f,0x40,0x41,0x42,0x00,0x00,
+0x00,0x43,0x44,0x45,0x46,0x47,0x48,0x00,0x49,0x31,0x4a,0x00,0x4b,0x4c,0x00,0x00,
+0x31,0x4d,0x4e,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x00,
+0x5a,0x5b,0x5c,0x5d,0x5e,0x5f,0x60,0x61,0x62,0x63,0x64,0x2d,0x65,0x66,0x00,0x67,
+0x68,0x69,0x6a,0x6a,0x6b,0x00,0x6c,0x6d,0x6e,0x00,0x6f,0x61,0x00,0xff,0x05,0x70,
+0x00,0x71,0x00,0x00,0x2d,0x72,0x73,0x00,0x00,0x00,0x74,0x75,0x76,0x77,0x00,0x78,
+0x79,0x7a,0x00,0x01,0x00,0xff,0x48,0x02,0x46,0x02,0x20,0x03,0x02,0x41,0x02,0x4b,
+0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,
+0x21,0x0c,0x00,0x08,0x00,0x20,0x0b,0x00,0x0c,0x3e,0x00,0x0b,0x3e,0xd1,0x00,0x00,
+0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,
+0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,
+0x73,0x00,0x02,0xf1,0x03,0x24,0x00,0x25,0x26,0x27,0x28,0x00,0x29,0x00,0x2a,0x2b,
+0x2c,0x2d,0x00,0x2a,0x2a,0x00,0x00,0x4e,0x02,0x30,0x33,0x34,0x35,0x4a,0x02,0xf3,
+0x01,0x00,0x3a,0x3b,0x3c,0x3c,0x3d,0x3e,0x00,0x00,0x3f,0x00,0x00,0x40,0x41,0x00,
+0x42,0x4e,0x02,0x91,0x49,0x4a,0x00,0x4b,0x4b,0x00,0x4c,0x4d,0x00,0x4b,0x02,0x00,
+0x4c,0x02,0x01,0x4d,0x02,0x22,0x55,0x43,0x4e,0x02,0x11,0x55,0x4f,0x02,0x40,0x00,
+0x00,0x65,0x66,0x4f,0x02,0x41,0x00,0x00,0x00,0x6b,0x50,0x02,0xdf,0x70,0x71,0x72,
+0x00,0x00,0x73,0x00,0x74,0x75,0x00,0x00,0x76,0x77,0x40,0x02,0xff,0x43,0x50,0x00,
+0x00,0x00,0x00,0x00,
+};
+
+static const uint8_t lz4BitmapData[] ={
+0xf2,0xff,0x13,0x2f,0xc1,0xfb,0x1f,0xb0,0xfa,0x0f,0xa0,0xf9,0x06,0x31,0xd9,0x1e,
+0xa0,0x9a,0x8b,0x9a,0x8b,0x98,0x89,0x43,0x44,0x00,0x1f,0x0b,0x70,0x00,0x5d,0x0f,
+0x30,0x2f,0xff,0xff,0xf7,0x01,0xb8,0x6d,0x10,0x00,0xe4,0x7a,0x00,0x8f,0xff,0xff,
+0xf0,0x15,0xf2,0xd6,0x20,0x06,0xc0,0xf2,0x00,0x08,0xa2,0xf0,0x00,0x00,0x09,0x70,
+0x00,0x05,0xdb,0x30,0x09,0xfe,0xff,0x40,0xfd,0x02,0xfb,0x0f,0xe1,0x04,0x40,0x7f,
+0xf8,0x10,0x00,0x4b,0xfe,0x31,0x41,0x04,0xfb,0x4f,0x90,0x1f,0xc0,0xdf,0xce,0xf7,
+0x01,0x8e,0xc5,0x00,0x00,0xb5,0x00,0x0a,0xfc,0x10,0x00,0x00,0x5e,0x2c,0x80,0xb3,
+0x00,0x5e,0x0b,0x96,0xc0,0x00,0x0c,0xfe,0x4e,0x20,0x00,0x00,0x10,0xb7,0x00,0x00,
+0x00,0x06,0xc5,0xdd,0x50,0x00,0x2e,0x2e,0x77,0xf0,0x00,0xa7,0x0e,0x65,0xf0,0x00,
+0x00,0x06,0xee,0x70,0x01,0xbf,0xd5,0x00,0x00,0x9f,0x9d,0xf0,0x00,0x0a,0xf0,0x9f,
+0x00,0x00,0x4f,0xdf,0x50,0x00,0x05,0xff,0x90,0x66,0x04,0xfb,0xbf,0x6e,0xb0,0x8f,
+0x50,0xdf,0xf6,0x04,0xfd,0x6a,0xff,0x30,0x06,0xdf,0xe9,0xfd,0x10,0x9b,0x9b,0x9a,
+0x44,0x00,0x01,0x00,0x02,0xe2,0x00,0xd9,0x00,0x7f,0x10,0x0d,0xb0,0x00,0xf7,0x00,
+0x2f,0x60,0x03,0xf5,0x00,0x2f,0x60,0x00,0xf8,0x00,0x0b,0xc0,0x00,0x4f,0x30,0x00,
+0xad,0x10,0x00,0x91,0x10,0x00,0x9a,0x00,0x2e,0x70,0x07,0xf1,0x02,0xf6,0x00,0xea,
+0x00,0xdc,0x00,0xcd,0x00,0xdc,0x00,0xf9,0x03,0xf4,0x0a,0xd0,0x5f,0x30,0x74,0x00,
+0x00,0x99,0x00,0x43,0x88,0x23,0x8e,0xfe,0xf8,0x02,0xff,0x20,0x0d,0x79,0xc0,0x05,
+0x01,0x50,0x00,0x4b,0x40,0x00,0x05,0xf6,0x00,0x00,0x5f,0x60,0x0a,0xff,0xff,0xfb,
+0x6a,0xcf,0xca,0x70,0x0e,0x00,0xf0,0x17,0x00,0x1f,0x72,0xf6,0x5f,0x26,0x70,0x02,
+0x22,0x04,0xff,0xf4,0x15,0x55,0x10,0x1d,0x91,0xea,0x00,0x00,0xd8,0x00,0x03,0xf2,
+0x00,0x08,0xd0,0x00,0x0d,0x70,0x00,0x3f,0x20,0x00,0x8c,0x00,0x00,0xe7,0x11,0x00,
+0xf8,0x22,0x09,0xc0,0x00,0x0e,0x70,0x00,0x02,0xbf,0xd6,0x00,0xdf,0x8c,0xf5,0x3f,
+0x90,0x1f,0xa5,0xf7,0x00,0xfd,0x6f,0x70,0x0f,0xd5,0xf7,0x00,0xfc,0x3f,0x90,0x2f,
+0xa0,0xdf,0x8c,0xf5,0x02,0xbf,0xd7,0x00,0x02,0x8d,0x1c,0xff,0xf1,0x95,0xcf,0x10,
+0x0c,0xf1,0x00,0x05,0x00,0xf0,0xb5,0x04,0xcf,0xe8,0x02,0xfe,0x8c,0xf6,0x7f,0x50,
+0x3f,0xa0,0x00,0x06,0xf7,0x00,0x03,0xfd,0x00,0x03,0xee,0x10,0x03,0xee,0x20,0x02,
+0xef,0x97,0x77,0x6f,0xff,0xff,0xf0,0x05,0xdf,0xd7,0x03,0xfe,0x8c,0xf6,0x38,0x30,
+0x3f,0x90,0x01,0x29,0xf6,0x00,0x8f,0xfa,0x00,0x02,0x59,0xf7,0x5a,0x30,0x1f,0xc4,
+0xfe,0x8b,0xf8,0x05,0xdf,0xe8,0x00,0x00,0x02,0xff,0x10,0x00,0x0b,0xff,0x10,0x00,
+0x5f,0xff,0x10,0x01,0xea,0xcf,0x10,0x09,0xe1,0xcf,0x10,0x3f,0x82,0xcf,0x30,0x9f,
+0xff,0xff,0xf1,0x35,0x55,0xdf,0x50,0x00,0x00,0xcf,0x10,0x0a,0xff,0xff,0x90,0xbf,
+0x88,0x85,0x0d,0xc0,0x00,0x00,0xff,0xff,0xb1,0x09,0x95,0x9f,0x90,0x00,0x00,0xfd,
+0x2a,0x60,0x0f,0xd0,0xef,0x8b,0xf8,0x03,0xcf,0xe8,0x00,0x00,0x2a,0xe9,0x00,0x3f,
+0xfa,0x50,0x0d,0xe2,0x10,0x03,0xfd,0xef,0xd2,0x5f,0xe6,0x9f,0xb5,0xf7,0x00,0xee,
+0x3f,0x90,0x0e,0xe0,0xcf,0x9b,0xf9,0x01,0xae,0xe9,0x00,0x9f,0xff,0xff,0xe4,0x88,
+0x89,0xfb,0x00,0x00,0x7f,0x30,0x00,0x0e,0xc0,0x00,0x07,0xf5,0x00,0x00,0xee,0x00,
+0x00,0x6f,0x70,0x00,0x0d,0xf1,0x00,0x05,0xf9,0x00,0x00,0x44,0x00,0xf0,0x3c,0xef,
+0x8c,0xf6,0x2f,0xa0,0x3f,0x90,0xee,0x38,0xf6,0x04,0xff,0xfc,0x01,0xed,0x69,0xf7,
+0x5f,0x70,0x0f,0xc2,0xfe,0x8b,0xf9,0x05,0xcf,0xe9,0x00,0x02,0xcf,0xd5,0x01,0xef,
+0x8d,0xf3,0x5f,0x80,0x3f,0x96,0xf6,0x01,0xfc,0x3f,0xc2,0x7f,0xc0,0x9f,0xfe,0xfa,
+0x00,0x23,0x7f,0x50,0x09,0xbf,0xc0,0x01,0xfd,0x80,0x00,0x1e,0xa1,0xd9,0x00,0x00,
+0x00,0x00,0x01,0xd9,0x1e,0xa0,0x2e,0x82,0xe8,0x00,0x01,0x00,0xf1,0x2f,0x85,0x0f,
+0x91,0xf6,0x6d,0x00,0x10,0x00,0x01,0x7a,0x02,0x9f,0xfb,0x8f,0xe9,0x40,0x9f,0xd7,
+0x10,0x04,0xbf,0xfa,0x00,0x02,0x9c,0x00,0x00,0x00,0x2f,0xff,0xff,0x81,0x88,0x88,
+0x84,0x18,0x88,0x88,0x42,0xff,0xff,0xf8,0x3b,0x40,0x00,0x03,0xff,0xd6,0x00,0x00,
+0x6b,0xff,0x30,0x04,0x9f,0xf4,0x2e,0xff,0x92,0x03,0xd6,0x00,0x01,0x00,0xf0,0x44,
+0x08,0xef,0xb2,0x7f,0xca,0xfc,0x69,0x10,0xee,0x00,0x06,0xf9,0x00,0x5f,0xb0,0x00,
+0xbf,0x00,0x00,0x12,0x00,0x00,0xbc,0x00,0x00,0xcd,0x00,0x00,0x04,0xbe,0xfd,0x70,
+0x00,0x00,0x8e,0x61,0x13,0xbc,0x00,0x05,0xe2,0x00,0x00,0x0b,0x70,0x0d,0x60,0x3c,
+0xea,0x14,0xd0,0x3f,0x11,0xf8,0x4f,0x21,0xf0,0x5e,0x07,0xe0,0x3f,0x00,0xf1,0x6c,
+0x0a,0xb0,0x5f,0x03,0xf0,0x6d,0x09,0xd1,0xbf,0x2a,0x90,0x2f,0x12,0xde,0x6b,0xfa,
+0x00,0x0d,0x90,0x57,0x00,0xf0,0x60,0x03,0xea,0x42,0x36,0x00,0x00,0x00,0x29,0xdf,
+0xea,0x00,0x00,0x00,0x0b,0xf7,0x00,0x00,0x01,0xff,0xd0,0x00,0x00,0x7f,0xcf,0x30,
+0x00,0x0d,0xe2,0xf9,0x00,0x03,0xf8,0x0c,0xf0,0x00,0x9f,0xa8,0xcf,0x50,0x0f,0xff,
+0xff,0xfb,0x06,0xf8,0x00,0x0c,0xf2,0xcf,0x30,0x00,0x7f,0x80,0x2f,0xff,0xfc,0x50,
+0x2f,0xe8,0x9f,0xf3,0x2f,0xb0,0x07,0xf7,0x2f,0xc1,0x2b,0xf3,0x2f,0xff,0xff,0xa0,
+0x2f,0xc4,0x4a,0xf6,0x2f,0xb0,0x04,0xfa,0x2f,0xe8,0x8d,0xf6,0x2f,0xff,0xfd,0x80,
+0x00,0x8e,0xfd,0x60,0x00,0xaf,0xc9,0xdf,0x70,0x2f,0xd0,0x00,0xfe,0x06,0xf8,0x00,
+0x01,0x20,0x7f,0x70,0x00,0x00,0x09,0x00,0xf1,0x14,0x10,0x2f,0xc0,0x00,0xfe,0x00,
+0xbf,0xc9,0xdf,0x70,0x00,0x9e,0xfd,0x60,0x00,0x2f,0xff,0xe9,0x10,0x2f,0xe8,0xbf,
+0xd0,0x2f,0xb0,0x08,0xf8,0x2f,0xb0,0x02,0xfc,0x2f,0xb0,0x00,0xfe,0x08,0x00,0x00,
+0x10,0x00,0x31,0xe8,0xbf,0xd1,0x20,0x00,0xe0,0xff,0xff,0xf0,0x2f,0xe8,0x88,0x80,
+0x2f,0xb0,0x00,0x00,0x2f,0xd8,0x88,0xd7,0x03,0x11,0x60,0x0c,0x00,0x00,0x04,0x00,
+0x00,0x18,0x00,0x00,0x20,0x00,0xf1,0x03,0xff,0xff,0xd2,0xfe,0x88,0x87,0x2f,0xb0,
+0x00,0x02,0xfe,0x88,0x83,0x2f,0xff,0xff,0x62,0xfb,0x21,0x00,0x22,0x02,0xfb,0x28,
+0x00,0xf0,0x19,0x00,0x7d,0xfd,0x80,0x00,0x9f,0xd9,0xcf,0xa0,0x1f,0xe0,0x00,0xab,
+0x05,0xf9,0x00,0x11,0x10,0x6f,0x80,0x8f,0xff,0x25,0xf9,0x02,0x4d,0xf2,0x1f,0xe0,
+0x00,0xcf,0x20,0x9f,0xd9,0xaf,0xf1,0x00,0x7d,0xfe,0xb3,0x2d,0x00,0x61,0x9f,0x52,
+0xfb,0x00,0x09,0xf5,0x09,0x00,0x86,0xfe,0x88,0x8c,0xf5,0x2f,0xff,0xff,0xff,0x12,
+0x00,0x04,0x09,0x00,0x46,0x50,0x0f,0xd0,0xfd,0x03,0x00,0x00,0x36,0x01,0x4a,0x70,
+0x00,0x07,0xf7,0x07,0x00,0xf0,0x0c,0x8c,0x20,0x8f,0x66,0xfd,0x9f,0xf2,0x08,0xef,
+0xc4,0x00,0x2f,0xb0,0x07,0xfc,0x02,0xfb,0x04,0xfe,0x10,0x2f,0xb2,0xef,0x30,0x02,
+0xfc,0xcf,0xfa,0x00,0xf6,0x06,0xf5,0x00,0x02,0xff,0xbf,0xe1,0x00,0x2f,0xc0,0x8f,
+0xa0,0x02,0xfb,0x00,0xdf,0x50,0x2f,0xb0,0x03,0xfe,0x10,0xb4,0x00,0x0b,0x07,0x00,
+0xf0,0x48,0xfe,0x88,0x86,0x2f,0xff,0xff,0xc0,0x2f,0xf7,0x00,0x02,0xff,0x82,0xff,
+0xd0,0x00,0x7f,0xf8,0x2f,0xef,0x30,0x0d,0xef,0x82,0xfa,0xf9,0x03,0xf9,0xf8,0x2f,
+0xaa,0xe0,0x9f,0x5f,0x82,0xfa,0x4f,0x5e,0xa5,0xf8,0x2f,0xb0,0xee,0xf4,0x5f,0x82,
+0xfb,0x08,0xfe,0x05,0xf8,0x2f,0xb0,0x2f,0x80,0x5f,0x80,0x2f,0xf1,0x00,0x9f,0x52,
+0xff,0xa0,0x09,0xf5,0x2f,0xff,0x40,0x9f,0x52,0xfc,0xed,0x09,0xf5,0x2f,0xb6,0xf8,
+0x9f,0x52,0xfb,0x0c,0xfb,0xf5,0x2f,0xb0,0x2f,0xdb,0x00,0x10,0x8f,0xd2,0x00,0xf0,
+0x0b,0xdf,0x50,0x00,0x7d,0xfd,0x70,0x00,0x9f,0xda,0xdf,0x80,0x2f,0xe0,0x00,0xef,
+0x15,0xf9,0x00,0x09,0xf5,0x7f,0x70,0x00,0x8f,0x66,0xf8,0xf2,0x00,0x81,0xd0,0x00,
+0xef,0x10,0x9f,0xd9,0xdf,0x90,0x24,0x00,0xf5,0x09,0x2f,0xff,0xfd,0x70,0x2f,0xe9,
+0x9d,0xf8,0x2f,0xb0,0x01,0xfd,0x2f,0xb0,0x05,0xfc,0x2f,0xff,0xff,0xf4,0x2f,0xe8,
+0x86,0x10,0x95,0x01,0x02,0x71,0x01,0x12,0x60,0x4d,0x00,0x5f,0xd0,0x01,0xef,0x16,
+0xf8,0x4d,0x00,0x01,0xe0,0x80,0x00,0x7d,0xff,0xf3,0x00,0x00,0x00,0x3e,0xf1,0x00,
+0x00,0x00,0x13,0x56,0x00,0xe0,0x60,0x02,0xfe,0x89,0xef,0x50,0x2f,0xb0,0x05,0xf9,
+0x02,0xfb,0x00,0x8f,0xd9,0x01,0xff,0x35,0xc1,0x02,0xfe,0x8d,0xf4,0x00,0x2f,0xb0,
+0x4f,0xc0,0x02,0xfb,0x00,0xcf,0x40,0x2f,0xb0,0x04,0xfc,0x00,0x03,0xbf,0xfc,0x40,
+0x1e,0xf9,0x9f,0xf2,0x3f,0xb0,0x05,0xc5,0x0e,0xf9,0x30,0x00,0x01,0xaf,0xfd,0x40,
+0x00,0x01,0x6e,0xf3,0x7e,0x60,0x06,0xf7,0x2f,0xf9,0x8e,0xf4,0x03,0xbe,0xfd,0x50,
+0xcf,0xff,0xff,0xfc,0x68,0x8f,0xf8,0x86,0x00,0x0f,0xf0,0x00,0x04,0x00,0x05,0x4f,
+0x4f,0xa0,0x01,0xfd,0x04,0x00,0x01,0xf0,0x49,0x2f,0xc0,0x03,0xfb,0x0c,0xfb,0x9e,
+0xf5,0x01,0x9e,0xfd,0x50,0xcf,0x40,0x00,0xdf,0x46,0xf9,0x00,0x2f,0xe0,0x1f,0xe0,
+0x06,0xf8,0x00,0xbf,0x30,0xbf,0x30,0x05,0xf8,0x0f,0xd0,0x00,0x0f,0xc5,0xf7,0x00,
+0x00,0xaf,0xbf,0x20,0x00,0x04,0xff,0xc0,0x00,0x00,0x0e,0xf6,0x00,0x00,0xaf,0x30,
+0x3f,0x90,0x0d,0xf1,0x7f,0x60,0x7f,0xd0,0x0f,0xd0,0x3f,0x90,0xbf,0xf1,0x3f,0x90,
+0x0f,0xc0,0xeb,0xf5,0x6f,0x50,0x0c,0xf3,0xf5,0xe8,0x9f,0x20,0x08,0xf9,0xf1,0xac,
+0xce,0x2d,0x00,0xf0,0x25,0x6f,0xfa,0x00,0x01,0xff,0x80,0x2f,0xf7,0x00,0x00,0xdf,
+0x40,0x0e,0xf3,0x00,0x7f,0xa0,0x06,0xfc,0x00,0xdf,0x30,0xef,0x20,0x04,0xfc,0x8f,
+0x80,0x00,0x0a,0xff,0xe0,0x00,0x00,0x3f,0xf8,0x00,0x00,0x0b,0xff,0xe1,0x00,0x05,
+0xfc,0x8f,0x90,0x00,0xef,0x30,0xef,0x30,0x8f,0x24,0x00,0xf0,0x06,0xbf,0x50,0x04,
+0xfc,0x03,0xfc,0x00,0xcf,0x30,0x0a,0xf3,0x3f,0xb0,0x00,0x2f,0xba,0xf2,0x00,0x00,
+0x9f,0xfa,0xb0,0x03,0x12,0x20,0xcf,0x00,0x31,0x00,0xff,0x00,0x09,0x00,0x00,0xe8,
+0x06,0xfd,0x1a,0xf6,0x48,0x88,0x9f,0xf2,0x00,0x00,0xaf,0x60,0x00,0x06,0xfa,0x00,
+0x00,0x2f,0xe1,0x00,0x00,0xcf,0x40,0x00,0x08,0xf8,0x00,0x00,0x4f,0xf8,0x88,0x84,
+0x8f,0xff,0xff,0xf8,0x01,0x10,0x3f,0xf8,0x3f,0xb2,0x3f,0x90,0x02,0x00,0x70,0xa1,
+0x3f,0xf8,0x14,0x42,0xcf,0x10,0x0f,0x05,0xf9,0x0d,0x1f,0xd0,0x00,0x0a,0xf3,0x00,
+0x04,0xf9,0x00,0x00,0xdf,0x00,0x00,0x7f,0x60,0x00,0x1f,0xc0,0x00,0x0b,0xf2,0x00,
+0x05,0xf8,0x11,0x1e,0xfd,0x4f,0xfa,0x02,0xf0,0x33,0xfd,0x2f,0xde,0xfd,0x44,0x30,
+0x00,0x74,0x00,0x04,0xfe,0x00,0x0a,0xbf,0x50,0x1f,0x49,0xc0,0x8e,0x03,0xf3,0x22,
+0x22,0x21,0xff,0xff,0xfc,0x55,0x55,0x53,0x4f,0x90,0x05,0xf4,0x05,0xdf,0xd4,0x03,
+0xfc,0x6e,0xf1,0x25,0x20,0xaf,0x30,0x7d,0xef,0xf4,0x6f,0x92,0xaf,0x47,0xfb,0x7e,
+0xf4,0x0a,0xfd,0xaf,0x60,0x4f,0x80,0x00,0x04,0xf8,0x00,0x00,0x07,0x00,0xf0,0x15,
+0xfb,0xde,0x90,0x4f,0xf9,0xcf,0x74,0xf9,0x01,0xfc,0x4f,0x80,0x0f,0xd4,0xf8,0x01,
+0xfc,0x4f,0xf8,0xcf,0x74,0xf9,0xde,0x90,0x03,0xcf,0xd5,0x01,0xfe,0x8e,0xf2,0x7f,
+0x60,0x3b,0x48,0xf4,0x88,0x00,0xf0,0x01,0x27,0x31,0xfe,0x8d,0xf3,0x03,0xcf,0xd5,
+0x00,0x00,0x00,0x3f,0x90,0x00,0x03,0xf9,0x07,0x00,0xf0,0x0a,0x5d,0xea,0xf9,0x2f,
+0xe9,0xdf,0x97,0xf6,0x04,0xf9,0x8f,0x40,0x3f,0x97,0xf5,0x03,0xf9,0x2f,0xd6,0xcf,
+0x90,0x5d,0xe9,0xf9,0x03,0xab,0x05,0xf3,0x17,0x8c,0xf3,0x6f,0x70,0x3f,0x88,0xff,
+0xff,0xfa,0x6f,0x93,0x33,0x21,0xef,0x99,0xe4,0x02,0xbf,0xe9,0x00,0x01,0xbf,0x90,
+0x9f,0xb5,0x0c,0xf1,0x0d,0xff,0xf6,0x4d,0xf6,0x20,0xcf,0x00,0x0c,0xf0,0x00,0x05,
+0x00,0xf0,0x1b,0x04,0xde,0x9f,0xb1,0xff,0x9c,0xfb,0x6f,0x70,0x2f,0xb8,0xf4,0x02,
+0xfb,0x6f,0x60,0x2f,0xb1,0xff,0x8c,0xfb,0x04,0xde,0xaf,0xb0,0x20,0x04,0xfa,0x0d,
+0xb7,0xdf,0x40,0x7d,0xfd,0x60,0x5f,0x80,0x00,0x05,0xf8,0x00,0x00,0x07,0x00,0xf4,
+0x01,0xfa,0xcf,0xa0,0x5f,0xe8,0xcf,0x65,0xf8,0x04,0xf9,0x5f,0x80,0x3f,0x95,0xf8,
+0x03,0x07,0x00,0x83,0x2e,0x82,0xd7,0x00,0x03,0xfa,0x3f,0xa3,0x03,0x00,0x89,0x02,
+0xf8,0x02,0xd7,0x00,0x00,0x03,0xfa,0x02,0x00,0x96,0xf9,0x5c,0xf7,0x9f,0xa0,0x4f,
+0x80,0x00,0x00,0x04,0x00,0xf5,0x0b,0xbf,0x60,0x4f,0x89,0xf9,0x00,0x4f,0xef,0xb0,
+0x00,0x4f,0xff,0xc0,0x00,0x4f,0xda,0xf6,0x00,0x4f,0x81,0xef,0x20,0x4f,0x80,0x5f,
+0xb0,0x4b,0x00,0x02,0x03,0x00,0xf7,0x0c,0x4f,0x9c,0xfb,0x4d,0xfa,0x04,0xff,0x8d,
+0xff,0x9c,0xf5,0x4f,0x80,0x5f,0x80,0x5f,0x84,0xf8,0x04,0xf8,0x04,0xf8,0x4f,0x80,
+0x4f,0x80,0x4f,0x0b,0x00,0xb6,0x80,0x5f,0x9c,0xfb,0x05,0xff,0x8c,0xf6,0x5f,0x80,
+0x4f,0x9c,0x00,0x00,0x07,0x00,0x50,0x90,0x03,0xcf,0xd6,0x01,0xa7,0x07,0xf0,0x10,
+0x60,0x1f,0xc8,0xf4,0x00,0xee,0x6f,0x60,0x1f,0xc1,0xfe,0x8c,0xf5,0x03,0xcf,0xd6,
+0x00,0x4f,0xbd,0xe9,0x04,0xfe,0x7b,0xf7,0x4f,0x80,0x1f,0xc4,0xf8,0x00,0xfd,0x07,
+0x00,0x30,0xff,0x8c,0xf7,0x15,0x00,0x02,0xa5,0x01,0x00,0x07,0x00,0xd0,0x05,0xde,
+0x8f,0x92,0xfe,0x8d,0xf9,0x7f,0x60,0x3f,0x98,0xf4,0x03,0x07,0x00,0x00,0x0e,0x00,
+0x34,0x05,0xde,0xaf,0x8c,0x01,0x01,0x07,0x00,0xc2,0x04,0xfa,0xd9,0x4f,0xfc,0x64,
+0xf9,0x00,0x4f,0x80,0x04,0xf8,0x05,0x00,0xf0,0x06,0x07,0xef,0xc4,0x04,0xfb,0x5e,
+0xf0,0x5f,0xa2,0x23,0x00,0x8f,0xfe,0x60,0x24,0x04,0xdf,0x16,0xfa,0x5d,0xf1,0x18,
+0x05,0xf1,0x08,0x07,0x70,0x00,0xfe,0x00,0xff,0xff,0x15,0xff,0x50,0x0f,0xe0,0x00,
+0xfe,0x00,0x0f,0xe0,0x00,0xdf,0x81,0x05,0xee,0x10,0xb5,0x00,0x26,0x04,0xf9,0x07,
+0x00,0x00,0x67,0x00,0xf2,0x5d,0x08,0xee,0x9f,0x90,0xcf,0x20,0x9f,0x46,0xf6,0x0d,
+0xf0,0x1f,0xb2,0xfa,0x00,0xcf,0x6f,0x40,0x06,0xfe,0xf0,0x00,0x1f,0xfa,0x00,0x00,
+0xcf,0x50,0x00,0xbf,0x00,0xf9,0x08,0xf3,0x7f,0x45,0xfd,0x0b,0xf0,0x3f,0x79,0xff,
+0x2e,0xb0,0x0e,0xae,0x8f,0x9f,0x70,0x0b,0xff,0x3a,0xff,0x30,0x07,0xfe,0x06,0xff,
+0x00,0x03,0xf9,0x01,0xfb,0x00,0x7f,0x70,0xcf,0x20,0xee,0x7f,0x90,0x05,0xff,0xe1,
+0x00,0x0f,0xfa,0x00,0x07,0xff,0xf2,0x01,0xee,0x5f,0xa0,0x9f,0x60,0xbf,0x30,0xdf,
+0x20,0x9f,0x57,0xf7,0x0e,0xf0,0x2f,0xb3,0xfa,0x00,0xdf,0x8f,0x50,0x07,0xff,0xf0,
+0x00,0x2f,0x55,0x00,0xf0,0x08,0x0b,0xf0,0x00,0x29,0xf9,0x00,0x03,0xfc,0x10,0x00,
+0x7f,0xff,0xff,0x13,0x77,0xbf,0xb0,0x00,0x1e,0xe1,0x00,0x0c,0xf4,0x4d,0x03,0xf6,
+0x1b,0x04,0xff,0x87,0x71,0x8f,0xff,0xff,0x20,0x00,0x16,0x00,0x1e,0xc0,0x07,0xf3,
+0x00,0x8f,0x10,0x09,0xf1,0x01,0xce,0x00,0xbf,0x40,0x03,0xec,0x00,0x09,0xf0,0x00,
+0x8f,0x10,0x07,0xf2,0x00,0x2f,0xa0,0x00,0x39,0x00,0xe3,0x01,0x00,0xf0,0x16,0x43,
+0x00,0x8f,0x40,0x0e,0xb0,0x0c,0xd0,0x0c,0xd0,0x09,0xf3,0x01,0xef,0x08,0xf6,0x0c,
+0xe0,0x0c,0xd0,0x0d,0xc0,0x6f,0x60,0x65,0x00,0x07,0xec,0x30,0xba,0x2f,0xbc,0xf9,
+0xf7,0x2a,0x10,0x9e,0x3c,0x05,0x10,0x30,0x9d,0x07,0xf0,0x15,0x4f,0x50,0x00,0x00,
+0x00,0x04,0xee,0x40,0x0c,0xff,0xff,0xfc,0x3e,0x40,0xe4,0x22,0x22,0x00,0x4e,0x3e,
+0x20,0x00,0x00,0x00,0x8d,0xe3,0x11,0x11,0x00,0x3e,0x4d,0xff,0xff,0xfb,0x3e,0x40,
+0x21,0x00,0x10,0x50,0x2c,0x00,0x10,0x60,0x74,0x08,0x24,0x40,0x00,0x3c,0x00,0x10,
+0x5f,0x0b,0x00,0x20,0x4e,0xe4,0x05,0x00,0x11,0x3c,0x3f,0x00,0xf0,0x08,0x02,0x22,
+0x24,0xed,0x80,0x00,0x00,0x00,0x2e,0x4e,0x30,0x01,0x11,0x13,0xe0,0x4e,0x3b,0xff,
+0xff,0xfd,0x00,0x5e,0xe4,0x2c,0x00,0x11,0x6f,0x37,0x00,0x11,0x40,0x68,0x08,0x20,
+0x2b,0x20,0x24,0x00,0xf3,0x15,0xee,0x20,0x00,0x00,0x2e,0xa0,0xae,0x20,0x00,0x1d,
+0xa0,0x00,0xad,0x10,0x1d,0xd4,0x00,0x04,0xdd,0x13,0xcc,0xf2,0x02,0xfc,0xc3,0x00,
+0x0f,0x20,0x2f,0x00,0x00,0x00,0xf2,0x02,0xf0,0x00,0x0b,0x00,0xe0,0xf3,0x13,0xf0,
+0x00,0x00,0x0d,0xff,0xfd,0x00,0x00,0x00,0x0c,0xff,0xfc,0x11,0x00,0x3d,0x23,0xf0,
+0x00,0x27,0x00,0xf0,0x0a,0x33,0xf2,0x02,0xf3,0x30,0x3f,0xfd,0x10,0x1d,0xff,0x30,
+0x6e,0x30,0x00,0x3e,0x60,0x00,0x5e,0x40,0x4e,0x50,0x00,0x00,0x4e,0x8e,0x76,0x00,
+0x35,0x3c,0x30,0x00,0x01,0x00,0x11,0xa0,0x91,0x00,0x00,0xd2,0x00,0x20,0x0e,0xfe,
+0x61,0x0b,0xf0,0x15,0xf4,0xf6,0x00,0x00,0x00,0xe9,0x09,0xe0,0x00,0x00,0x7f,0x10,
+0x1f,0x70,0x00,0x1f,0x80,0x00,0x8f,0x10,0x08,0xe0,0x00,0x00,0xe8,0x01,0xfc,0x88,
+0x88,0x8c,0xf1,0x9f,0xff,0xff,0xff,0xff,0xca,0x08,0xf0,0x2e,0x3b,0xc5,0x00,0x00,
+0x02,0x1e,0x86,0xf2,0x00,0x4d,0xf7,0xf0,0x0d,0x50,0x4f,0x60,0x7f,0xb9,0xf1,0x0e,
+0x60,0x09,0xff,0xe6,0x04,0xe0,0x00,0xcf,0xa1,0xd4,0x5c,0x00,0x0e,0x60,0x0c,0x63,
+0xe0,0x01,0x20,0x00,0xe4,0x0e,0x60,0x00,0x00,0x6e,0x00,0x4f,0x70,0x00,0x7f,0x50,
+0x00,0x4d,0xfe,0xfd,0x40,0x00,0x00,0x02,0x42,0x3b,0x01,0xf0,0x0b,0x11,0x10,0x00,
+0x00,0x00,0xbf,0xff,0x72,0x00,0x08,0xc1,0xdf,0xc3,0xf5,0x04,0x98,0x02,0xe2,0x07,
+0xb4,0x5d,0x00,0x01,0x00,0x1b,0x4d,0x5f,0x00,0xf0,0x3e,0xbe,0x68,0x00,0x00,0x00,
+0x09,0x6a,0xd0,0x00,0x00,0x00,0xb9,0x1a,0xa0,0x00,0x00,0x9d,0x00,0x88,0xc4,0x25,
+0xb9,0x60,0x00,0x69,0xe9,0xf6,0x70,0x00,0x00,0x05,0x25,0x00,0x00,0x00,0x28,0x01,
+0x32,0x00,0x00,0x01,0xee,0xef,0xef,0xd5,0x00,0x0d,0x90,0xbc,0x10,0x5f,0x70,0x0b,
+0xc1,0x0b,0xd0,0x03,0xf3,0x07,0xfd,0x1a,0xc0,0x00,0x99,0x0b,0x7a,0xfc,0x10,0x00,
+0x5c,0x0b,0x60,0x61,0x00,0x00,0x5c,0x08,0xe4,0x00,0xf3,0x04,0x89,0x01,0xf4,0x00,
+0x00,0x02,0xf3,0x00,0x6f,0x60,0x00,0x5e,0x70,0x00,0x04,0xdf,0xef,0xd5,0x00,0x8a,
+0x00,0xf0,0x20,0x0c,0xee,0xee,0xee,0x10,0x01,0xfa,0x66,0x6b,0xb0,0x00,0x6f,0x10,
+0x00,0xd5,0x00,0x0b,0xb0,0x00,0x5e,0x00,0x00,0x7e,0x00,0x6d,0x40,0x00,0x2d,0xf3,
+0x7b,0x10,0x00,0x0d,0x8b,0x3d,0xd0,0x00,0x03,0xf0,0xd4,0x8e,0x30,0x00,0x3f,0x15,
+0x10,0xf3,0xc8,0x0b,0x60,0x8d,0x00,0x00,0x02,0xdf,0xfd,0xba,0x01,0x20,0x33,0x00,
+0xa8,0x00,0xc0,0xaa,0x60,0x00,0x00,0xef,0xfa,0x10,0xcb,0xbb,0xba,0xaa,0xbc,0xd8,
+0x09,0xf0,0x03,0xc0,0x5f,0xff,0xd0,0xbc,0x00,0x22,0x21,0x0c,0xc0,0x13,0x33,0x20,
+0xcc,0x05,0xee,0xec,0x0c,0x64,0x02,0xd0,0xc9,0xcb,0xde,0xed,0xb9,0x00,0x0e,0xff,
+0xa0,0x00,0x00,0x56,0x63,0x38,0x00,0xf0,0x2a,0x57,0x62,0x04,0x00,0x06,0xef,0xff,
+0xf1,0xad,0x47,0xfb,0x30,0x24,0x0a,0x39,0xfa,0x00,0x00,0x00,0xa2,0x03,0xc5,0x00,
+0x00,0x0a,0x20,0x00,0xc8,0x00,0x00,0xa2,0x00,0x98,0x00,0x00,0x0a,0x22,0xc6,0x00,
+0x00,0x00,0xa7,0xcf,0xb0,0x00,0x00,0x0a,0xa0,0x5f,0xc5,0x23,0x50,0x20,0x00,0x4d,
+0xff,0xff,0x49,0x0a,0xf0,0x19,0x54,0x00,0x89,0x99,0x99,0x99,0x8c,0x2f,0xd1,0x11,
+0x2b,0xb0,0x65,0x06,0xef,0xfb,0x0b,0x93,0xdf,0xff,0xb0,0xfd,0x00,0x69,0xdb,0x02,
+0x20,0x00,0x0b,0xb0,0xeb,0x00,0x00,0xbb,0x0f,0xd0,0x00,0x0b,0xb0,0x76,0x09,0x00,
+0x81,0xe0,0x00,0x0b,0xea,0xff,0xaa,0xaa,0xe0,0xf2,0x01,0xf0,0x2b,0x18,0xde,0xd8,
+0x10,0x00,0x3e,0xad,0x6a,0xbe,0x30,0x1e,0x70,0xc5,0x70,0x7e,0x18,0xb0,0x0c,0x57,
+0x00,0xb8,0xc5,0x00,0xbd,0x60,0x05,0xce,0x30,0x24,0x06,0x90,0x2e,0xd4,0x4b,0xe3,
+0xe7,0xc7,0xd9,0xcb,0x8b,0x04,0xc6,0xd9,0x2f,0xa9,0x00,0x00,0xbf,0x20,0x5f,0x71,
+0x01,0x7e,0x50,0x00,0x3b,0xff,0xfb,0x37,0x02,0xf2,0x32,0x20,0x00,0x00,0x03,0xbd,
+0x80,0x00,0x00,0x03,0xe6,0x4b,0xb0,0x00,0x00,0xa7,0x00,0x0f,0x12,0x62,0x0a,0x60,
+0x00,0xe7,0xff,0xf4,0x6d,0x10,0x6d,0xbf,0xff,0xb0,0x9f,0xef,0x7a,0xff,0xfa,0x07,
+0xe9,0xcf,0xff,0xfe,0x23,0xe1,0x4f,0xff,0xff,0xe1,0x96,0x1e,0xff,0xff,0xff,0x8c,
+0x38,0xff,0xff,0xff,0xfb,0xcf,0xfd,0xdd,0xdd,0xdd,0x90,0x11,0x77,0x02,0x20,0x61,
+0x00,0x6b,0x03,0x11,0xd2,0x06,0x00,0xf1,0x05,0xe3,0x00,0x02,0x43,0x33,0x37,0xe3,
+0x00,0xaf,0xff,0xff,0xff,0xf4,0x03,0x66,0x66,0x66,0x66,0x60,0x09,0x67,0x02,0x90,
+0x08,0xf9,0x88,0x88,0x95,0x00,0x07,0xd1,0x00,0x99,0x02,0x01,0x06,0x00,0x25,0x05,
+0x90,0xb9,0x02,0x20,0x68,0x50,0xc1,0x01,0xf0,0x24,0x48,0xc9,0x10,0x00,0x00,0x8c,
+0xa4,0x4c,0x30,0x00,0x03,0x22,0x8b,0x20,0x00,0x00,0x5a,0xc5,0x10,0x00,0x06,0x86,
+0x97,0x30,0x00,0x1c,0xb0,0x10,0xab,0x00,0x0a,0xf2,0x7f,0x82,0xf9,0x00,0xaf,0x29,
+0xfa,0x1f,0x90,0x01,0xda,0x04,0x09,0xd1,0x00,0x01,0x8b,0x9a,0x81,0x76,0x02,0xfa,
+0x0a,0xfd,0x10,0x0d,0x63,0x36,0x9d,0x10,0xd3,0x00,0xb0,0xbd,0x0d,0x30,0x0a,0xc9,
+0xe3,0xd3,0x00,0x00,0x0d,0x3d,0x30,0x00,0x00,0xd3,0x09,0x00,0x60,0x40,0x00,0x00,
+0xd3,0xcf,0xff,0x74,0x04,0x01,0xbc,0x0b,0x10,0x53,0x06,0x00,0xf0,0x2b,0xa9,0x6a,
+0x90,0x00,0x00,0x06,0x70,0x00,0x8d,0xc7,0x00,0x0a,0x10,0x00,0x00,0x09,0x40,0x1d,
+0x10,0x00,0x47,0x33,0x90,0xa3,0x38,0xcf,0xda,0x33,0x80,0xc0,0x68,0x58,0x00,0x04,
+0xb0,0xb0,0x00,0x4f,0x90,0x00,0xa2,0xa1,0x00,0xdf,0xf3,0x00,0x83,0x2c,0x20,0x00,
+0x00,0x01,0xc0,0x02,0xbb,0xbb,0xbb,0xbb,0x3f,0x01,0x11,0x4d,0xf2,0x00,0xf0,0x1b,
+0xf0,0x87,0x00,0x00,0x00,0x7f,0x2f,0x40,0x19,0xd8,0x6e,0xae,0x30,0x0a,0xb3,0x7b,
+0x60,0xd4,0x01,0xf1,0x00,0x9b,0x4f,0x20,0x5b,0x00,0x01,0xbf,0x60,0x08,0x70,0x00,
+0x04,0xf0,0x00,0xa5,0x00,0x00,0x4f,0x00,0x0c,0x30,0x0b,0x00,0x10,0xe2,0x0b,0x00,
+0x02,0x01,0x00,0xf0,0x39,0x07,0xe8,0x01,0xe0,0xd2,0x1e,0x0d,0x20,0x8e,0x80,0x00,
+0x10,0x0d,0xf9,0x1f,0xfd,0x0b,0xf7,0x01,0x00,0x00,0x01,0xfb,0x50,0x00,0x07,0xcf,
+0xe8,0x20,0x00,0x4e,0xf7,0x08,0xdf,0xd8,0x11,0xfa,0x40,0x00,0x09,0x88,0x88,0x31,
+0xff,0xff,0xf6,0x00,0x00,0x01,0xc8,0x00,0x2d,0xf9,0x00,0x1d,0xf6,0x00,0x2a,0x00,
+0x00,0x10,0x02,0xde,0xd2,0x97,0x07,0x99,0x90,0x98,0x1b,0xfb,0x10,0x12,0x00,0x01,
+0x00,0xf0,0x34,0x4f,0x50,0x00,0x00,0x28,0x79,0xf9,0x8a,0xd8,0x03,0xff,0xff,0xff,
+0xeb,0x50,0x01,0x19,0xe1,0x08,0x40,0x00,0x00,0xaf,0xbd,0xfb,0x10,0x00,0x9f,0xfa,
+0xcf,0xee,0x20,0xaf,0xdd,0x0e,0x91,0xfb,0x4f,0x68,0xea,0xf1,0x0b,0xea,0xe0,0x6f,
+0xf6,0x00,0xed,0xbe,0x8d,0xf8,0x01,0xaf,0x64,0xef,0xcf,0x6b,0xff,0x90,0x00,0x00,
+0x00,0x68,0x30,0x00,0x24,0x10,0x47,0x00,0xd0,0x8f,0x40,0x00,0x06,0xd2,0x00,0x7f,
+0x40,0x00,0x03,0xfb,0x00,0x7f,0x41,0x00,0xf0,0x13,0x20,0x6f,0x40,0x00,0x00,0x4f,
+0x80,0x5f,0x60,0x01,0x00,0x0f,0xc0,0x2f,0x90,0x3c,0x00,0x0d,0xf0,0x0e,0xe0,0xaf,
+0x30,0x0a,0xd1,0x08,0xff,0xfc,0x00,0x01,0x00,0x00,0xcf,0xe2,0x37,0x00,0x11,0x02,
+0x84,0x00,0xf0,0x15,0x06,0x42,0x00,0x00,0x00,0x01,0xff,0xff,0xf3,0x00,0x00,0x01,
+0x35,0x79,0x10,0x00,0x01,0x12,0x34,0x60,0x00,0x0a,0xff,0xff,0xff,0x80,0x00,0x68,
+0x76,0xcf,0xa0,0x00,0x00,0x00,0x7f,0x80,0x05,0x00,0xf0,0x0d,0xf8,0x00,0x00,0x00,
+0x6f,0xcd,0xf3,0x00,0x00,0x6f,0xb0,0x3f,0xa1,0x23,0x5f,0xd0,0x00,0xdf,0xff,0xd0,
+0x62,0x00,0x01,0x78,0x85,0x00,0x1f,0x90,0x48,0x00,0xf0,0x30,0x0f,0x80,0x00,0x20,
+0x00,0x46,0x6f,0xdc,0xe1,0xfa,0x10,0x8f,0xff,0xfd,0x90,0x8f,0xf3,0x02,0x2f,0x70,
+0x00,0x02,0xc1,0x00,0x0f,0x96,0x87,0x40,0x00,0x00,0x6f,0xff,0xef,0xfb,0x00,0x1c,
+0xff,0x90,0x00,0x8f,0x40,0xaf,0x2f,0x80,0x00,0x4f,0x60,0xce,0x3f,0x81,0x26,0xef,
+0x20,0x4f,0xff,0x67,0xff,0xf6,0x00,0x01,0x77,0x01,0x75,0x43,0x00,0x21,0x75,0x00,
+0x49,0x00,0x20,0xd0,0x00,0x92,0x00,0xf3,0x2e,0xf9,0x00,0x0b,0xc0,0x01,0xab,0xcf,
+0xff,0xc3,0x8f,0x50,0x1f,0xde,0xf9,0x9f,0xb0,0xfd,0x00,0x00,0xce,0x00,0xbe,0x09,
+0xf3,0x00,0x1f,0xa0,0x0b,0xd0,0x4f,0x80,0x07,0xf4,0x00,0xcc,0x00,0x40,0x00,0xde,
+0x00,0x0f,0xa0,0x00,0x00,0x6f,0x83,0x27,0xf7,0x00,0x00,0x0e,0xf1,0x9f,0xfe,0x10,
+0x00,0x00,0x14,0x02,0x66,0x10,0x60,0x01,0xf1,0x3e,0x04,0x00,0x00,0x07,0x50,0x00,
+0x76,0xf3,0x00,0x01,0xfb,0x00,0x05,0xe6,0x50,0x00,0x3f,0x80,0x00,0xab,0x00,0x2a,
+0xbd,0xff,0xfc,0x2a,0xf3,0x03,0xfd,0xef,0x89,0xfa,0x2f,0xb0,0x00,0x0d,0xd0,0x0c,
+0xc0,0xbf,0x20,0x03,0xf8,0x00,0xdc,0x06,0xf7,0x00,0x8f,0x30,0x0e,0xb0,0x15,0x00,
+0x0e,0xd0,0x01,0xf9,0x00,0x00,0x07,0xf7,0x31,0x8f,0x50,0x00,0x00,0xef,0x1b,0xff,
+0xd0,0x00,0x00,0x03,0x50,0x37,0x61,0x52,0x00,0xf4,0x31,0x37,0x10,0x00,0x00,0x43,
 0x37,0xfa,0x8c,0x10,0x0f,0xff,0xff,0xfe,0xb1,0x00,0x34,0x44,0x7f,0x40,0x30,0x08,
-0x76,0x78,0xfe,0xff,0x10,0xff,0xff,0xee,0xfa,0xdd,0x05,0xf5,0x0e,0x1f,0xa0,0x00,
+0x76,0x78,0xfe,0xff,0x10,0xff,0xff,0xee,0xfa,0x40,0x00,0x00,0x00,0x1f,0xa0,0x00,
 0x68,0x00,0x3e,0xff,0x20,0x0d,0xb0,0x01,0x68,0x80,0x00,0xde,0x20,0x00,0x10,0x00,
-0x06,0xff,0xfe,0xff,0x40,0x00,0x03,0x8a,0xaa,0x82,0x3e,0x03,0xf0,0x0c,0x44,0x00,
-0x77,0xb0,0x11,0x11,0xed,0x59,0xb8,0xc2,0x9f,0xff,0xff,0xfe,0x34,0x00,0x25,0x66,
-0x5f,0xa0,0x01,0x00,0x45,0x55,0x5d,0xfb,0xf7,0x88,0x03,0xf0,0x05,0xfe,0x72,0x00,
-0x01,0x11,0x00,0xbe,0x00,0x00,0x16,0x10,0x09,0xdf,0x70,0x00,0x6f,0x20,0x07,0xbd,
-0x40,0xc0,0x0f,0x00,0x05,0x0a,0x30,0xfb,0x9a,0xb9,0x03,0x0f,0x12,0xff,0x6b,0x0f,
-0x10,0x34,0x4f,0x0c,0xf0,0x06,0xf3,0x00,0x00,0x4f,0xf7,0x00,0x00,0x6f,0xe4,0x00,
-0x00,0x9f,0xc1,0x00,0x00,0x7f,0xc0,0x00,0x00,0x06,0xfd,0x1d,0x03,0xf0,0x00,0xfe,
-0x30,0x00,0x00,0x06,0xff,0x50,0x00,0x00,0x05,0xff,0x70,0x00,0x00,0x03,0x05,0x00,
-0xf0,0x2e,0x04,0xb0,0x4d,0x70,0x00,0x0b,0xf0,0x05,0xf5,0x00,0x00,0xaf,0x00,0x7f,
-0x20,0x00,0x09,0xf0,0x09,0xf0,0x0b,0xa9,0xdf,0xde,0xae,0x00,0xef,0xff,0xfd,0xba,
-0xd0,0x00,0x00,0x9f,0x00,0xbd,0x61,0x00,0x09,0xf0,0x0a,0xee,0x20,0x00,0xbe,0x00,
-0x8f,0xd0,0x00,0x0f,0xb0,0x06,0xf9,0x00,0x09,0xf6,0x00,0x3f,0x60,0x0b,0xfc,0x80,
-0x04,0xf9,0x02,0x6a,0x00,0x00,0x03,0x21,0x11,0x23,0x02,0xff,0xff,0xff,0xf1,0x17,
-0x89,0x99,0x87,0x00,0x01,0x00,0x10,0xcc,0xc2,0x01,0xf0,0x06,0xc0,0x00,0x00,0x00,
-0xdf,0x83,0x23,0x46,0x74,0xff,0xff,0xff,0xfe,0x01,0x68,0x98,0x86,0x30,0x00,0x00,
-0x03,0x70,0x07,0x00,0x7a,0x10,0x60,0x05,0x43,0x39,0xfa,0xcf,0x01,0x1a,0x00,0x60,
-0xa1,0x04,0x56,0x54,0x9f,0x30,0xed,0x01,0x01,0x96,0x02,0xd0,0x8d,0xf4,0x00,0xaf,
-0x00,0x1d,0xff,0x50,0x0d,0xd0,0x00,0x00,0x10,0xc2,0x0b,0x31,0x22,0x00,0x04,0xee,
-0x06,0x42,0x02,0x79,0xa9,0x83,0x5e,0x00,0x24,0x2f,0xd0,0x5f,0x00,0x20,0x0f,0xb0,
-0x05,0x00,0x12,0xa0,0x71,0x01,0x12,0x00,0x84,0x02,0x01,0x05,0x00,0xf3,0x09,0x2f,
-0x90,0x00,0x00,0x71,0x1f,0xa0,0x00,0x06,0xfa,0x0f,0xe3,0x02,0x8f,0xf4,0x08,0xff,
-0xff,0xfe,0x40,0x00,0x6a,0xb9,0x60,0x41,0x00,0xf3,0x03,0xc0,0x00,0x08,0x10,0x1f,
-0xb0,0x09,0x8b,0xb0,0x1f,0xa0,0x05,0xf4,0xa0,0x1f,0x90,0x00,0x61,0x37,0x00,0x13,
-0x80,0x05,0x00,0xf0,0x05,0x10,0x2f,0x80,0x00,0x02,0xe6,0x1f,0xc0,0x00,0x4e,0xf8,
-0x0c,0xff,0xce,0xff,0x70,0x01,0xae,0xfd,0x92,0x4b,0x02,0xb0,0xf7,0x00,0x00,0x12,
-0x22,0x36,0xf9,0x33,0x30,0xcf,0xff,0xfa,0x00,0xa1,0x9b,0xa9,0x9a,0xfb,0x89,0x90,
-0x00,0x00,0x59,0xf6,0x09,0x08,0x10,0xf7,0x9a,0x01,0x20,0x61,0xfa,0x44,0x00,0x20,
-0xb7,0xfc,0xbf,0x10,0x30,0xff,0xfa,0x00,0x8c,0x08,0x10,0xf2,0x74,0x04,0x20,0xff,
-0x50,0xa5,0x06,0x04,0xfd,0x01,0x20,0x03,0x38,0xa3,0x06,0xb0,0xf2,0xf6,0xf3,0x01,
-0x12,0x22,0xbf,0x3b,0x85,0x02,0xff,0x01,0x00,0xc0,0xb0,0x1b,0xba,0x99,0xdf,0x89,
-0x97,0x00,0x00,0x01,0x6c,0xf0,0x9b,0x03,0x01,0x64,0x06,0x40,0x00,0x9f,0x16,0xf3,
-0x3a,0x00,0x30,0xf4,0x9f,0x60,0xa5,0x08,0x21,0xff,0xf4,0xed,0x06,0x10,0xfd,0x06,
-0x00,0x30,0x6c,0xfe,0x20,0x95,0x00,0x26,0xe9,0x10,0x7a,0x01,0x40,0x0a,0x80,0x00,
-0xdc,0x18,0x01,0x00,0x83,0x01,0x70,0x0e,0xb1,0x34,0xdd,0x89,0x5c,0xdf,0x65,0x01,
-0xb0,0x5c,0xaf,0xd5,0x42,0xdb,0x00,0x00,0x0e,0xa0,0x12,0xea,0x06,0x00,0x10,0x8f,
-0x29,0x03,0xc1,0xb0,0x25,0x50,0x00,0x00,0x0d,0xe4,0x22,0x35,0x40,0x00,0x07,0xea,
-0x03,0x52,0x00,0x36,0x77,0x76,0x20,0x13,0x04,0xe0,0x0a,0xde,0xff,0xfb,0x00,0x00,
-0x89,0x89,0xff,0x60,0x00,0x00,0x03,0xee,0x40,0x02,0xf1,0x00,0xfc,0x10,0x11,0x15,
-0x8b,0xff,0xef,0xff,0xf7,0xbf,0xec,0xff,0xb6,0x55,0x21,0xa7,0x09,0x00,0xf2,0x09,
-0x00,0x16,0x04,0x10,0x92,0xbe,0x01,0x20,0xdf,0xff,0x92,0x01,0x50,0x59,0xa6,0x00,
-0x00,0x05,0x67,0x01,0x00,0x40,0x0d,0xf1,0x0a,0x00,0x56,0x6f,0xec,0xe0,0x00,0x0b,
-0xff,0xff,0xc9,0x00,0x00,0x12,0x7f,0x50,0x78,0x98,0x40,0x0a,0xf1,0x1f,0xff,0xfa,
-0x00,0xfc,0xf7,0x04,0xf0,0x0e,0x70,0x42,0x00,0x00,0x0a,0xf3,0x0f,0x90,0x00,0x01,
-0xfd,0x00,0xfd,0x32,0x45,0x8f,0x70,0x09,0xff,0xff,0xd1,0x61,0x00,0x03,0x56,0x53,
-0x00,0x00,0x42,0x1a,0x0f,0xf1,0x1b,0x00,0x3f,0xa0,0x00,0xa6,0xf1,0x05,0x47,0xfc,
-0xb7,0x08,0xb7,0x31,0xff,0xff,0xfe,0x60,0x02,0x00,0x04,0x4c,0xf1,0x25,0x66,0x51,
-0x00,0x00,0xfc,0x06,0xff,0xff,0x40,0x00,0x4f,0x70,0x12,0x11,0x20,0x00,0x09,0xf2,
-0x02,0x55,0x02,0x30,0x05,0xf3,0x00,0xa1,0x0c,0xf0,0x13,0x6f,0x70,0x02,0x10,0x0d,
-0xf2,0x02,0xff,0xff,0xf7,0x00,0x58,0x00,0x01,0x68,0x87,0x20,0x00,0x03,0x7a,0xcc,
-0x70,0x00,0xae,0xff,0xca,0xef,0xa0,0x0b,0xc6,0x10,0x00,0xcf,0x10,0xb9,0x00,0x10,
-0xf2,0xe8,0x00,0x60,0xef,0x00,0x00,0x13,0x59,0xff,0xac,0x14,0x60,0xfb,0x40,0x00,
-0x00,0x06,0x41,0x47,0x00,0xf1,0x03,0x25,0x7a,0x96,0x00,0x04,0x8d,0xff,0xfe,0xff,
-0xd1,0x0f,0xfe,0x84,0x00,0x08,0xfa,0x06,0x40,0xb1,0x02,0x00,0x01,0x00,0x11,0xfe,
-0x93,0x12,0x10,0xfa,0x73,0x01,0xf0,0x06,0xbf,0xe1,0x00,0x00,0xbd,0xff,0xfb,0x20,
-0x00,0x00,0x8d,0xb8,0x30,0x00,0x00,0x01,0x24,0x57,0x89,0xa4,0x0e,0xc3,0x01,0x61,
-0xf6,0x0b,0xa7,0x55,0xee,0x51,0xdc,0x01,0x14,0x00,0x51,0x02,0x02,0x97,0x0a,0x00,
-0x90,0x14,0x02,0x7c,0x02,0x00,0xa7,0x01,0x21,0xfd,0x73,0xdb,0x01,0x20,0xff,0x30,
-0x88,0x00,0xa0,0x79,0x00,0x00,0x01,0x23,0x56,0x79,0x94,0x00,0xef,0x43,0x00,0x70,
-0x60,0x0c,0xa8,0x55,0xee,0x61,0x20,0x99,0x09,0x30,0x21,0x8a,0x90,0x44,0x00,0x20,
-0x0d,0x6b,0x14,0x0a,0x20,0x00,0x32,0x7d,0x05,0x11,0x60,0xb5,0x05,0x27,0xfc,0x00,
-0x46,0x00,0x31,0x09,0xff,0xf2,0x15,0x00,0x20,0x78,0x00,0x41,0x03,0x10,0x00,0xd5,
-0x03,0x00,0xb8,0x0e,0xf3,0x06,0x4c,0x00,0xaf,0x42,0xbf,0xf4,0x02,0xfe,0xff,0x91,
-0x00,0x2e,0xfa,0x10,0x00,0x2e,0xe4,0x00,0x00,0x0a,0xf4,0x99,0x01,0x60,0x0a,0xf9,
-0x32,0x34,0x66,0x2e,0x73,0x02,0x71,0x04,0x78,0x87,0x63,0x00,0x00,0x67,0x50,0x00,
-0x20,0x0d,0xe0,0x0b,0x06,0xf0,0x0e,0x66,0xfe,0xd7,0x2a,0x20,0x00,0xcf,0xff,0xd9,
-0x36,0xff,0x80,0x00,0x0b,0xe0,0x02,0x53,0xbe,0x00,0x02,0xf8,0x00,0x6f,0x20,0x20,
-0x00,0xaf,0x20,0x05,0x65,0x04,0xf4,0x0e,0x90,0x36,0x9f,0x30,0x00,0x0d,0xf1,0x8f,
-0xef,0xfd,0x50,0x00,0x14,0x0f,0xa0,0x5f,0xef,0x90,0x00,0x00,0xdf,0xbe,0xf3,0x85,
-0x00,0x00,0x02,0xad,0xc6,0x89,0x02,0x11,0xfb,0xed,0x00,0xc0,0x70,0x2f,0xff,0xff,
-0x54,0xf4,0x01,0x9a,0xba,0xa3,0x6f,0x20,0x3d,0x01,0x01,0x30,0x02,0x20,0x9e,0x30,
-0xb5,0x00,0x00,0x98,0x1e,0xf0,0x07,0x00,0x8f,0xe0,0xcc,0x00,0x00,0x07,0xf9,0x0b,
-0xfb,0x9a,0xca,0x5f,0x60,0x2b,0xff,0xff,0xa1,0x72,0x00,0x00,0x10,0xcc,0x00,0xf0,
-0x29,0x54,0x10,0x00,0x00,0x05,0xef,0xff,0xfa,0x10,0x00,0x9f,0xc8,0xf9,0x8f,0xd0,
-0x05,0xf9,0x07,0xf4,0x06,0xf8,0x0c,0xe0,0x0b,0xf0,0x00,0xec,0x0f,0xa0,0x0e,0xd0,
-0x00,0xcf,0x1f,0xa0,0x4f,0x70,0x00,0xed,0x0e,0xe4,0xdf,0x10,0x06,0xf9,0x07,0xff,
-0xf8,0x01,0x8f,0xf1,0x00,0x7c,0x70,0x9f,0xfd,0x5b,0x00,0x80,0x19,0x50,0x00,0x03,
-0x10,0x00,0x03,0x30,0x7e,0x01,0x20,0x0c,0xe0,0xaa,0x02,0xf1,0x27,0x0c,0xe2,0x40,
-0x6f,0x20,0xef,0xff,0xff,0xd0,0x8f,0x00,0x78,0x8d,0xe6,0x40,0x9e,0x00,0x00,0x0b,
-0xe0,0x00,0xad,0x20,0x00,0x0a,0xf0,0x00,0xbd,0xe1,0x4b,0xdf,0xf2,0x00,0xaf,0xc1,
-0xfb,0x7c,0xff,0x80,0x9f,0x84,0xf6,0x1c,0xfc,0xf4,0x6f,0x41,0xef,0xff,0xb0,0x70,
-0x28,0x10,0x06,0x8a,0x06,0x21,0x38,0x20,0x70,0x05,0x01,0x7e,0x08,0x20,0x1e,0xfa,
-0x5b,0x06,0xf1,0x0a,0x0d,0xf6,0x07,0xfd,0x10,0x00,0x0c,0xfa,0x00,0x09,0xfc,0x00,
-0x02,0xed,0x00,0x00,0x0c,0xfb,0x00,0x02,0x30,0x00,0x00,0x0d,0xfb,0xf8,0x00,0x21,
-0x1d,0xf3,0x07,0x00,0x12,0x15,0x06,0x01,0x10,0x71,0x9f,0x0c,0xf2,0x16,0x08,0x7c,
-0xb0,0x00,0x02,0xef,0xc0,0x5f,0x4b,0x00,0x01,0xdf,0xdf,0xb0,0x71,0x00,0x00,0xbf,
-0x60,0xaf,0x90,0x00,0x00,0xaf,0xa0,0x00,0xcf,0x70,0x00,0x4f,0xd0,0x00,0x01,0xef,
-0x60,0x00,0x64,0x99,0x05,0x00,0x5c,0x02,0x02,0xe9,0x08,0x30,0x05,0x70,0x00,0x28,
-0x03,0xf0,0x06,0x13,0x10,0xeb,0x24,0x50,0x5f,0xff,0xff,0xff,0xc0,0x14,0x56,0xfc,
-0x43,0x10,0x45,0x44,0xec,0x67,0x80,0xaf,0x7b,0x04,0xf2,0x0c,0x02,0x23,0xec,0x10,
-0x00,0x01,0x57,0xed,0x10,0x00,0x5f,0xfe,0xff,0xfa,0x10,0xbe,0x00,0xde,0xbf,0xf2,
-0x7f,0xfe,0xfa,0x04,0xa0,0x04,0x88,0xe6,0x04,0x10,0x01,0x47,0x01,0x11,0xfe,0x6a,
-0x12,0x32,0x1a,0x88,0xfd,0x6a,0x08,0x01,0x1a,0x00,0xf1,0x1b,0x0b,0xf0,0x06,0xe2,
-0x00,0x03,0xbe,0xff,0xb6,0x8f,0x10,0x06,0xfc,0xdf,0x9c,0xff,0xf2,0x00,0xf9,0x1f,
-0xb0,0x03,0xff,0xf3,0x3f,0x6a,0xf3,0x00,0x6f,0xae,0x01,0xff,0xfa,0x00,0x3f,0xd0,
-0x00,0x04,0xa7,0x00,0x8f,0xe3,0xa9,0x04,0x10,0xa2,0x5c,0x08,0x00,0x93,0x00,0x50,
-0x31,0x8f,0x57,0x40,0x60,0xa3,0x02,0xf0,0x02,0x64,0xfc,0x00,0x68,0xcf,0x73,0x00,
-0x8f,0xb0,0x02,0xaf,0x10,0x00,0x09,0xd0,0x4f,0xff,0x19,0x18,0x20,0xca,0x1f,0x5d,
-0x00,0x80,0xda,0x4f,0x50,0x00,0xaa,0x00,0x9f,0xfe,0x57,0x06,0x90,0x06,0xee,0x00,
-0x03,0xee,0x00,0x00,0xaf,0xfe,0x18,0x05,0x41,0x06,0x9a,0x97,0x30,0x4f,0x00,0x11,
-0x30,0xdb,0x00,0x70,0xce,0x00,0x00,0x00,0xce,0x03,0x6f,0xa3,0x06,0x11,0xfe,0x24,
-0x09,0xf1,0x1d,0x7f,0xe6,0x9f,0x5d,0xf4,0x00,0x3f,0xfe,0x0e,0xb0,0x1f,0xc0,0x0c,
-0xd5,0xfc,0xf5,0x00,0xbf,0x00,0xf8,0x0c,0xfd,0x00,0x0c,0xe0,0x0f,0x80,0xcf,0xc0,
-0x03,0xfb,0x00,0xdf,0xff,0xa7,0x06,0xef,0x30,0x02,0xba,0x40,0x4f,0xfe,0x50,0x5d,
-0x16,0x05,0xf4,0x04,0x10,0xce,0xba,0x02,0x00,0x18,0x17,0xf0,0x07,0x09,0xc8,0xfc,
-0x67,0x00,0x00,0x7d,0xff,0xff,0xf0,0x00,0x00,0x02,0xf7,0x11,0x00,0x00,0x75,0x6f,
-0x41,0x22,0x95,0xa3,0x07,0xf1,0x11,0x0d,0xe1,0x03,0xaf,0x77,0x50,0x6f,0x50,0x08,
-0xf1,0x00,0x05,0xf7,0x00,0x6f,0x81,0x03,0xdf,0x30,0x01,0xef,0xff,0xff,0x70,0x00,
-0x01,0x8a,0xa8,0x20,0x00,0x00,0x04,0x4c,0x00,0x90,0xff,0xeb,0x82,0x00,0x00,0x04,
-0x8b,0xef,0x30,0x63,0x07,0x40,0x10,0x00,0x08,0xf1,0x15,0x00,0xf1,0x04,0xaf,0x2a,
-0xef,0xe9,0x10,0x0c,0xff,0xd9,0x7b,0xfc,0x00,0xef,0x80,0x00,0x0b,0xf2,0x06,0x60,
-0x00,0x41,0x04,0xd7,0x03,0xbf,0xc0,0x00,0x4f,0xff,0xff,0xc1,0x00,0x00,0x9a,0x98,
-0x40,0xf9,0x06,0x20,0x01,0xf9,0xf6,0x02,0xf2,0x1c,0x63,0xac,0x80,0x04,0xf8,0xfd,
-0xcf,0xb0,0x6f,0xf7,0x00,0xaf,0x37,0xfb,0x00,0x04,0xf6,0x8f,0x50,0x00,0x3f,0x87,
-0xf3,0x00,0x06,0xf6,0x38,0x10,0x00,0xbf,0x30,0x00,0x00,0x9f,0xa0,0x00,0x69,0xef,
-0xc1,0x00,0x08,0xfc,0x60,0xa8,0x01,0x12,0x00,0x3b,0x02,0x70,0xdd,0xee,0xfb,0x00,
-0x00,0xba,0x99,0x08,0x02,0x80,0x02,0xde,0x30,0x00,0x00,0x04,0xed,0x40,0xba,0x07,
-0xf5,0x14,0xff,0xfb,0x20,0x09,0xfd,0x52,0x26,0xfe,0x18,0xf9,0x14,0x40,0x06,0xf5,
-0x17,0x1e,0xff,0xe1,0x5f,0x50,0x05,0xf4,0x2f,0xbe,0xf1,0x00,0x1e,0xfe,0xff,0xe4,
-0x00,0x00,0x16,0x87,0x50,0x44,0x00,0x02,0x1f,0x08,0x11,0x07,0xbd,0x00,0x40,0x23,
-0xaf,0x20,0x69,0x71,0x15,0xe0,0xf7,0xef,0xff,0x60,0x00,0x64,0xbf,0xf8,0x03,0xf8,
-0x00,0x00,0x1e,0xf6,0x6b,0x19,0xfa,0x12,0x0b,0xfa,0x00,0x04,0xf5,0x00,0x08,0xff,
-0xa0,0x00,0x6f,0x30,0x04,0xf9,0xea,0x00,0x07,0xf2,0x12,0x1b,0x0e,0xa0,0x00,0x7f,
-0xdf,0x60,0x00,0xfb,0x00,0x02,0xff,0xc2,0x00,0x01,0x00,0x21,0x9f,0x30,0x67,0x04,
-0x02,0x55,0x00,0x21,0xbf,0x20,0xc0,0x17,0xf0,0x0c,0xf3,0x8c,0xec,0x50,0x00,0x75,
-0xce,0xef,0xca,0xef,0x70,0x00,0x2f,0xf8,0x00,0x00,0xde,0x00,0x0d,0xfa,0x00,0x00,
-0x0a,0xf0,0x0b,0xff,0xa0,0x8c,0x05,0xc0,0xf6,0xea,0x00,0x03,0xcf,0x60,0x06,0x0e,
-0xa0,0x3d,0xff,0x70,0x0d,0x04,0x26,0x96,0x10,0x24,0x01,0x00,0xb5,0x04,0x40,0x21,
-0x5f,0x73,0x56,0x42,0x01,0xf1,0x22,0xff,0xd0,0x01,0x57,0xfa,0x43,0x20,0x00,0x00,
-0xaf,0x55,0x10,0x29,0x30,0x5f,0xff,0xfe,0x9f,0xf7,0x4f,0xe4,0x0b,0xfe,0x81,0x05,
-0xe2,0x3e,0xff,0x40,0x00,0x00,0x1e,0xc4,0xf4,0x00,0x00,0x04,0xf8,0x15,0x10,0x10,
-0x00,0x1e,0xff,0xef,0xfa,0x00,0x00,0x17,0x70,0x01,0x12,0x02,0x0c,0x0c,0x21,0xbf,
-0x40,0x9c,0x03,0x01,0x52,0x05,0x21,0x0c,0xf2,0x5f,0x02,0x12,0xf9,0x19,0x00,0x20,
-0x89,0x20,0x19,0x00,0x21,0xfe,0xfc,0xe0,0x17,0xf0,0x14,0x0b,0xf0,0x03,0xc1,0x02,
-0xfc,0x00,0x9f,0x00,0x9f,0x30,0x9f,0x40,0x08,0xf5,0x6f,0xc0,0x0f,0xe0,0x00,0x4f,
-0xff,0xe2,0x00,0x46,0x00,0x00,0x59,0x71,0x00,0x77,0x77,0x77,0x77,0x70,0x25,0x07,
-0xf0,0x01,0xf5,0x10,0x04,0x51,0x4f,0xb0,0x00,0x0a,0xf4,0xed,0x10,0x00,0x0b,0xf3,
-0xb1,0x00,0x28,0x19,0x01,0x23,0x19,0x30,0x00,0x08,0xfd,0x48,0x00,0x14,0xb1,0xc1,
-0x00,0x70,0x6a,0xa9,0x99,0x99,0x9a,0x80,0x8f,0xac,0x05,0x11,0xf2,0x1f,0x01,0x60,
-0x70,0x00,0x00,0xbf,0x18,0xfb,0x78,0x00,0x20,0x5f,0xb0,0x61,0x05,0x01,0x0f,0x31,
-0x11,0xfc,0x58,0x0b,0x11,0xf8,0xfa,0x05,0x11,0xe0,0xa6,0x05,0x10,0x40,0xfd,0x00,
-0x14,0x92,0x46,0x00,0x10,0x10,0xa8,0x01,0x00,0x70,0x0b,0xf4,0x06,0xaf,0xd2,0x00,
-0x00,0x5e,0xfb,0x10,0x02,0x7d,0xff,0xc0,0x00,0x5f,0xfd,0x8f,0xb0,0x00,0x08,0x40,
-0x0f,0xb0,0xdd,0x08,0x14,0x1f,0x05,0x00,0x00,0x3c,0x00,0x11,0x20,0xe9,0x00,0x20,
-0xf3,0x00,0xf9,0x0e,0x10,0x90,0xed,0x01,0x00,0x5d,0x0c,0xf1,0x05,0x7e,0xff,0x30,
-0x00,0x06,0xbf,0xfe,0xef,0x00,0x00,0x0c,0xfa,0x40,0xcf,0x00,0x00,0x02,0x10,0x00,
-0xcf,0x2f,0x00,0x09,0x06,0x00,0x01,0x7f,0x01,0x20,0x79,0x10,0x0b,0x00,0x10,0x20,
-0xcd,0x00,0x91,0xf1,0x00,0x00,0x57,0x77,0xdf,0x87,0x78,0x09,0xb5,0x06,0x70,0x9f,
-0x10,0x00,0x00,0xbf,0x39,0xf1,0x4b,0x15,0x20,0x9e,0x10,0x10,0x1a,0x00,0xd0,0x07,
-0x00,0xd8,0x06,0x60,0xcf,0x90,0x00,0x00,0x27,0xff,0xdc,0x16,0x01,0x9d,0x04,0x24,
-0x46,0x10,0x67,0x08,0x00,0x30,0x01,0x70,0x06,0x88,0xdf,0x98,0x83,0x00,0x00,0x3d,
-0x00,0x05,0x05,0x00,0x60,0x01,0x00,0xaf,0x20,0x11,0x5f,0x73,0x08,0x43,0x28,0x77,
-0x77,0x77,0x17,0x0a,0x11,0x06,0x2d,0x09,0x91,0x04,0xaa,0xae,0xfb,0xaa,0xa1,0x00,
-0x00,0x0a,0x35,0x01,0x0c,0x06,0x00,0x10,0x01,0x78,0x15,0x20,0x01,0x3f,0x2a,0x00,
-0xa1,0xfc,0x2b,0xaa,0xaa,0xaa,0xaa,0xa9,0x00,0x00,0x00,0xa8,0x0e,0x20,0x0e,0xb0,
-0x2d,0x01,0x42,0xdb,0x01,0x00,0x8f,0x9b,0x0e,0x60,0x6d,0xfd,0x66,0x20,0x00,0x09,
-0x6e,0x08,0xe0,0x2b,0xf8,0xbc,0x00,0x00,0x8f,0xf6,0x0b,0xd0,0x00,0x06,0xb2,0x47,
-0xed,0x50,0x01,0x26,0xff,0x80,0xb6,0x02,0x01,0x22,0x0a,0x00,0x46,0x01,0x10,0x01,
-0x44,0x00,0x11,0x01,0xea,0x00,0x70,0xfb,0x05,0x88,0x88,0xef,0xe8,0x86,0x93,0x00,
-0x10,0xc0,0x41,0x01,0xf1,0x09,0xbd,0xc0,0x00,0x00,0x2c,0xfb,0x0c,0xd0,0x00,0x08,
-0xff,0x80,0x0c,0xd0,0x00,0x0c,0xd3,0x02,0x1d,0xd0,0x00,0x01,0x00,0x0e,0x1e,0x00,
-0x34,0x06,0x88,0x20,0xf6,0x07,0x20,0x0e,0xd0,0x8d,0x00,0x40,0xec,0x00,0x10,0x07,
-0x46,0x00,0xe0,0xf3,0x48,0x89,0xfc,0x88,0xbf,0x30,0x00,0x5f,0x60,0x07,0xf2,0x00,
-0x0a,0x05,0x13,0x20,0x01,0xfd,0x0c,0x09,0xf2,0x05,0xbf,0x60,0x00,0xce,0x00,0x9f,
-0xc0,0x23,0x3f,0xb0,0x9f,0xd1,0x07,0xff,0xf6,0x00,0x71,0x00,0x27,0x85,0x8c,0x00,
-0x20,0x17,0x00,0x7e,0x0c,0x20,0xa7,0xf3,0x90,0x00,0x81,0x07,0xd8,0x50,0x00,0x01,
-0xfa,0x00,0x18,0x45,0x01,0xd0,0xff,0xd1,0x00,0x69,0x9b,0xfc,0x99,0xdf,0x10,0x00,
-0x00,0x7f,0x40,0x4f,0x09,0x50,0x0c,0xf1,0x00,0xaf,0x00,0xc4,0x0d,0x20,0x0c,0xe0,
-0x2d,0x17,0xf0,0x06,0x00,0xec,0x00,0x01,0xbf,0xa0,0x32,0x5f,0x90,0x00,0xcf,0xc0,
-0x09,0xff,0xf4,0x00,0x01,0x80,0x00,0x37,0x84,0x01,0x02,0x11,0x63,0x59,0x02,0x11,
-0x70,0x0d,0x08,0xb1,0x7a,0xd8,0x07,0xbd,0xff,0xff,0xfc,0x70,0x9f,0xc9,0xdf,0x66,
-0x07,0xf5,0x03,0xf3,0x01,0x44,0x00,0x14,0x9f,0xde,0xff,0xb9,0xff,0xff,0xff,0xb8,
-0x63,0x7b,0x86,0x3f,0xc0,0x0a,0x02,0x11,0x09,0x9f,0x06,0x11,0x5a,0x82,0x07,0x11,
-0xa2,0xa3,0x07,0x11,0xe0,0x1c,0x00,0xf1,0x0a,0xff,0xff,0xe5,0x00,0x09,0xfb,0x88,
-0x8e,0xf5,0x00,0x9f,0xb0,0x00,0x1f,0xe0,0x0b,0xfb,0x00,0x00,0x8f,0x80,0x01,0x70,
-0x00,0x03,0xff,0x00,0x20,0x2e,0xf4,0x99,0x06,0x10,0xef,0x3e,0x0c,0x20,0xaf,0xf6,
-0x15,0x03,0x01,0x68,0x07,0x15,0x06,0x77,0x04,0x00,0xc4,0x04,0xf0,0x04,0x50,0x00,
-0x55,0xf2,0x00,0x00,0x4f,0xc0,0x07,0xc9,0x60,0x00,0x0c,0xfa,0x77,0x9a,0x00,0x00,
-0x08,0xf6,0x01,0xf0,0x01,0x00,0x07,0xfc,0x00,0x04,0xfb,0x00,0x0a,0xfd,0x10,0x00,
-0xaf,0x50,0x02,0xcb,0x10,0x5d,0x06,0x05,0x27,0x07,0x11,0x2d,0x1f,0x03,0x20,0x5e,
-0xf8,0xbb,0x01,0x21,0xdf,0xf6,0x05,0x13,0x18,0xa2,0x4e,0x05,0x11,0x51,0x3e,0x02,
-0x11,0xf9,0xb6,0x06,0x10,0xf4,0x67,0x00,0x10,0x2f,0x33,0x01,0x80,0x00,0xcf,0xa9,
-0x9f,0xe9,0x9a,0x09,0xfb,0x69,0x14,0x20,0x2d,0xd1,0x94,0x16,0x12,0x00,0x57,0x05,
-0x21,0x00,0x04,0xe8,0x06,0x21,0x3e,0xf4,0x74,0x02,0x01,0x4e,0x07,0x16,0x95,0x4f,
-0x00,0x00,0x3b,0x1c,0x90,0x55,0xe0,0x00,0x07,0xf8,0x00,0x09,0xab,0x50,0x07,0x03,
-0x10,0x16,0xd8,0x07,0x00,0x11,0x14,0xb0,0x0d,0xfb,0xab,0xfe,0xab,0xa0,0x0a,0xf9,
-0x00,0x3f,0x90,0x43,0x00,0x10,0x06,0x57,0x03,0x12,0x10,0x29,0x03,0x00,0x76,0x1c,
-0x00,0x4b,0x04,0x22,0xf3,0x00,0x70,0x03,0x00,0x70,0x01,0x14,0xb5,0xf3,0x00,0x21,
-0x00,0x02,0xd9,0x02,0x62,0x1a,0xaa,0xaa,0xaa,0xef,0x10,0x56,0x03,0x00,0x05,0x04,
-0x08,0x0b,0x00,0x10,0x10,0x0b,0x00,0x10,0x5f,0x27,0x00,0x51,0x14,0xba,0xaa,0xaa,
-0xae,0x16,0x00,0x11,0x46,0x7f,0x08,0x10,0xfc,0x20,0x00,0x00,0xe5,0x03,0x00,0x6f,
-0x15,0xf5,0x01,0xfb,0x00,0x03,0xba,0xef,0xaa,0xaf,0xea,0xb1,0x3f,0xff,0xfe,0xee,
-0xff,0xff,0x10,0x1a,0x00,0x21,0x01,0xfa,0xba,0x01,0x21,0x3f,0x80,0x28,0x03,0x11,
-0xf3,0x82,0x0a,0x01,0x5a,0x04,0x21,0x3d,0xfd,0x8c,0x03,0x13,0x98,0xdc,0x00,0x20,
-0x21,0x05,0x72,0x04,0xf0,0x03,0x3f,0xad,0xa5,0x00,0x0f,0xb0,0x03,0xf8,0xa4,0x34,
-0x98,0xfe,0x88,0xaf,0xc9,0x80,0x7f,0xff,0x8a,0x03,0x00,0x80,0x05,0x20,0x3f,0x70,
-0x7b,0x02,0x21,0x04,0xf6,0x99,0x04,0x20,0x6f,0x50,0x27,0x04,0x21,0x0d,0xf1,0x11,
-0x02,0x01,0x5e,0x01,0x21,0x5d,0xfc,0xd4,0x00,0x18,0xd7,0x7d,0x01,0x01,0x06,0x00,
-0x11,0x8e,0x33,0x08,0x20,0x6e,0xfa,0x11,0x00,0x60,0x01,0xa5,0x00,0x00,0x10,0x8f,
-0x10,0x05,0x40,0x90,0x5e,0xfb,0x00,0xba,0x08,0x31,0x95,0x00,0x05,0x83,0x0c,0x20,
-0x9f,0xf3,0xe2,0x0c,0x50,0xfd,0x30,0x00,0x04,0x8d,0x95,0x10,0x30,0x1f,0xff,0xa3,
-0x82,0x01,0x17,0x61,0xe9,0x0e,0xf0,0x0d,0x00,0xad,0x30,0x05,0xb6,0xe1,0x00,0x09,
-0xff,0x70,0x1f,0x59,0x20,0x00,0x03,0xc3,0x00,0x42,0x00,0x0a,0xd4,0x00,0x00,0x00,
-0xa6,0x00,0x8f,0xf8,0x4e,0x10,0x60,0x00,0x2c,0x30,0x00,0x7f,0xd1,0x66,0x00,0x30,
-0xbf,0xe2,0x00,0xfb,0x09,0x70,0xc2,0x00,0x00,0x04,0x8e,0xff,0x90,0x10,0x09,0x20,
-0xfa,0x30,0xf6,0x00,0x02,0x4e,0x00,0x51,0x8a,0xaa,0xaa,0xab,0x40,0xa5,0x12,0x01,
-0x12,0x01,0x11,0xef,0x46,0x05,0x01,0x46,0x02,0x01,0x58,0x02,0x30,0x01,0xef,0x90,
-0x01,0x02,0x20,0xfe,0xf8,0x0c,0x04,0xf2,0x02,0x51,0xef,0x80,0x05,0xef,0xe3,0x00,
-0x2e,0xf7,0x07,0xf9,0x10,0x00,0x03,0xf7,0x00,0x20,0x3a,0x13,0x05,0x01,0x00,0x20,
-0x85,0xe1,0x85,0x05,0xe1,0x0a,0xba,0x60,0x0f,0xff,0xff,0xff,0xf8,0x00,0x00,0xaa,
-0x99,0x9a,0xff,0x55,0x01,0x11,0x6f,0xcc,0x10,0x21,0x1e,0xe1,0x78,0x02,0x12,0xf6,
-0x63,0x0b,0x00,0x60,0x0e,0x20,0x1b,0xfb,0x0b,0x11,0xf1,0x06,0x6e,0xf9,0x01,0xdf,
-0xa0,0x00,0xdf,0xf7,0x00,0x01,0xef,0x70,0x05,0xa1,0x00,0x00,0x03,0xb0,0x00,0x00,
-0x02,0xe9,0x0d,0x03,0x05,0x11,0xf1,0x09,0x01,0xf9,0x02,0x59,0xd6,0x00,0x01,0x6f,
+0x06,0xff,0xfe,0xff,0x40,0x00,0x03,0x8a,0xaa,0x82,0x00,0x01,0x00,0xf0,0x27,0x44,
+0x00,0x77,0xb0,0x11,0x11,0xed,0x59,0xb8,0xc2,0x9f,0xff,0xff,0xfe,0x34,0x00,0x25,
+0x66,0x5f,0xa0,0x01,0x00,0x45,0x55,0x5d,0xfb,0xf7,0x00,0xaf,0xff,0xff,0xfe,0x72,
+0x00,0x01,0x11,0x00,0xbe,0x00,0x00,0x16,0x10,0x09,0xdf,0x70,0x00,0x6f,0x20,0x07,
+0xbd,0x40,0x00,0x7f,0x30,0x3a,0x00,0xa1,0x3f,0xfb,0x9a,0xb9,0x00,0x00,0x04,0xbe,
+0xff,0xe8,0x49,0x00,0xf0,0x1e,0x34,0x00,0x00,0x00,0x3e,0xf3,0x00,0x00,0x4f,0xf7,
+0x00,0x00,0x6f,0xe4,0x00,0x00,0x9f,0xc1,0x00,0x00,0x7f,0xc0,0x00,0x00,0x06,0xfd,
+0x10,0x00,0x00,0x09,0xfe,0x30,0x00,0x00,0x06,0xff,0x50,0x00,0x00,0x05,0xff,0x70,
+0x00,0x00,0x03,0x05,0x00,0xf9,0x43,0x04,0xb0,0x4d,0x70,0x00,0x0b,0xf0,0x05,0xf5,
+0x00,0x00,0xaf,0x00,0x7f,0x20,0x00,0x09,0xf0,0x09,0xf0,0x0b,0xa9,0xdf,0xde,0xae,
+0x00,0xef,0xff,0xfd,0xba,0xd0,0x00,0x00,0x9f,0x00,0xbd,0x61,0x00,0x09,0xf0,0x0a,
+0xee,0x20,0x00,0xbe,0x00,0x8f,0xd0,0x00,0x0f,0xb0,0x06,0xf9,0x00,0x09,0xf6,0x00,
+0x3f,0x60,0x0b,0xfc,0x00,0x00,0x20,0x00,0x6a,0x00,0x00,0x03,0x21,0x11,0x23,0x02,
+0xff,0xff,0xff,0xf1,0x17,0x89,0x99,0x87,0x00,0x01,0x00,0x10,0xcc,0xc2,0x01,0xf0,
+0x07,0xc0,0x00,0x00,0x00,0xdf,0x83,0x23,0x46,0x74,0xff,0xff,0xff,0xfe,0x01,0x68,
+0x98,0x86,0x30,0x00,0x00,0x03,0x40,0x1f,0x00,0x90,0xee,0x00,0x00,0x05,0x43,0x39,
+0xfa,0xcf,0x01,0x1a,0x00,0x60,0xa1,0x04,0x56,0x54,0x9f,0x30,0xed,0x01,0x01,0x96,
+0x02,0xf2,0x0e,0x8d,0xf4,0x00,0xaf,0x00,0x1d,0xff,0x50,0x0d,0xd0,0x00,0x00,0x10,
+0x00,0xcf,0x40,0x00,0x22,0x00,0x04,0xff,0xff,0xff,0x90,0x00,0x02,0x79,0xa9,0x83,
+0x5e,0x00,0x24,0x2f,0xd0,0x5f,0x00,0x20,0x0f,0xb0,0x05,0x00,0x12,0xa0,0x71,0x01,
+0x12,0x00,0x84,0x02,0x01,0x05,0x00,0xf3,0x09,0x2f,0x90,0x00,0x00,0x71,0x1f,0xa0,
+0x00,0x06,0xfa,0x0f,0xe3,0x02,0x8f,0xf4,0x08,0xff,0xff,0xfe,0x40,0x00,0x6a,0xb9,
+0x60,0x41,0x00,0xf3,0x03,0xc0,0x00,0x08,0x10,0x1f,0xb0,0x09,0x8b,0xb0,0x1f,0xa0,
+0x05,0xf4,0xa0,0x1f,0x90,0x00,0x61,0x37,0x00,0x13,0x80,0x05,0x00,0xf0,0x05,0x10,
+0x2f,0x80,0x00,0x02,0xe6,0x1f,0xc0,0x00,0x4e,0xf8,0x0c,0xff,0xce,0xff,0x70,0x01,
+0xae,0xfd,0x92,0x4b,0x02,0xb0,0xf7,0x00,0x00,0x12,0x22,0x36,0xf9,0x33,0x30,0xcf,
+0xff,0xfa,0x00,0xf0,0x01,0x9b,0xa9,0x9a,0xfb,0x89,0x90,0x00,0x00,0x59,0xf6,0x00,
+0x00,0x00,0x0c,0xff,0xf7,0x9a,0x01,0x20,0x61,0xfa,0x44,0x00,0x80,0xb7,0xfc,0x00,
+0x00,0x00,0x08,0xff,0xfa,0x6f,0x00,0x60,0x4e,0xf2,0x00,0x00,0x00,0x4d,0x81,0x01,
+0x24,0x00,0x09,0xfd,0x01,0xf0,0x02,0x03,0x38,0x00,0x00,0x00,0x0b,0xf2,0xf6,0xf3,
+0x01,0x12,0x22,0xbf,0x3b,0x85,0x02,0xff,0x01,0x00,0xc0,0xb0,0x1b,0xba,0x99,0xdf,
+0x89,0x97,0x00,0x00,0x01,0x6c,0xf0,0x9b,0x03,0x20,0xff,0xff,0x2b,0x00,0x30,0x9f,
+0x16,0xf3,0x3a,0x00,0x20,0xf4,0x9f,0xbe,0x00,0x40,0x2e,0xff,0xf4,0x00,0x0e,0x00,
+0x10,0xfd,0x06,0x00,0x30,0x6c,0xfe,0x20,0x95,0x00,0x26,0xe9,0x10,0x7a,0x01,0x40,
+0x0a,0x80,0x00,0xdc,0x18,0x01,0x00,0x83,0x01,0x70,0x0e,0xb1,0x34,0xdd,0x89,0x5c,
+0xdf,0x65,0x01,0xb0,0x5c,0xaf,0xd5,0x42,0xdb,0x00,0x00,0x0e,0xa0,0x12,0xea,0x06,
+0x00,0x10,0x8f,0x29,0x03,0xc1,0xb0,0x25,0x50,0x00,0x00,0x0d,0xe4,0x22,0x35,0x40,
+0x00,0x07,0xea,0x03,0x52,0x00,0x36,0x77,0x76,0x20,0x13,0x04,0xe0,0x0a,0xde,0xff,
+0xfb,0x00,0x00,0x89,0x89,0xff,0x60,0x00,0x00,0x03,0xee,0x40,0x02,0xf1,0x02,0xfc,
+0x10,0x11,0x15,0x8b,0xff,0xef,0xff,0xf7,0xbf,0xec,0xff,0xb6,0x55,0x21,0x00,0x4f,
+0xcf,0x00,0x20,0xf0,0x00,0x16,0x04,0x10,0x92,0xbe,0x01,0x20,0xdf,0xff,0x92,0x01,
+0x51,0x59,0xa6,0x00,0x00,0x05,0x67,0x01,0xf1,0x0d,0xdf,0x00,0x00,0x00,0x56,0x6f,
+0xec,0xe0,0x00,0x0b,0xff,0xff,0xc9,0x00,0x00,0x12,0x7f,0x50,0x78,0x98,0x40,0x0a,
+0xf1,0x1f,0xff,0xfa,0x00,0xfc,0xf7,0x04,0xf1,0x3c,0x70,0x42,0x00,0x00,0x0a,0xf3,
+0x0f,0x90,0x00,0x01,0xfd,0x00,0xfd,0x32,0x45,0x8f,0x70,0x09,0xff,0xff,0xd1,0x61,
+0x00,0x03,0x56,0x53,0x00,0x00,0x42,0x00,0x00,0x13,0x00,0x00,0x3f,0xa0,0x00,0xa6,
+0xf1,0x05,0x47,0xfc,0xb7,0x08,0xb7,0x31,0xff,0xff,0xfe,0x60,0x02,0x00,0x04,0x4c,
+0xf1,0x25,0x66,0x51,0x00,0x00,0xfc,0x06,0xff,0xff,0x40,0x00,0x4f,0x70,0x12,0x11,
+0x20,0x00,0x09,0xf2,0x02,0x55,0x02,0x10,0x05,0x27,0x01,0xf0,0x15,0x5f,0x80,0x6f,
+0x70,0x02,0x10,0x0d,0xf2,0x02,0xff,0xff,0xf7,0x00,0x58,0x00,0x01,0x68,0x87,0x20,
+0x00,0x03,0x7a,0xcc,0x70,0x00,0xae,0xff,0xca,0xef,0xa0,0x0b,0xc6,0x10,0x00,0xcf,
+0x10,0xb9,0x00,0x10,0xf2,0xe8,0x00,0xf0,0x01,0xef,0x00,0x00,0x13,0x59,0xff,0x50,
+0x00,0x05,0xff,0xfb,0x40,0x00,0x00,0x06,0x41,0x47,0x00,0xf1,0x03,0x25,0x7a,0x96,
+0x00,0x04,0x8d,0xff,0xfe,0xff,0xd1,0x0f,0xfe,0x84,0x00,0x08,0xfa,0x06,0x40,0xb1,
+0x02,0x00,0x01,0x00,0x20,0xfe,0x00,0xd4,0x01,0x10,0xfa,0x73,0x01,0xf0,0x06,0xbf,
+0xe1,0x00,0x00,0xbd,0xff,0xfb,0x20,0x00,0x00,0x8d,0xb8,0x30,0x00,0x00,0x01,0x24,
+0x57,0x89,0xa4,0x0e,0xc3,0x01,0x61,0xf6,0x0b,0xa7,0x55,0xee,0x51,0xdc,0x01,0x14,
+0x00,0x51,0x02,0x31,0x00,0x5f,0x40,0x06,0x00,0x13,0x60,0x7c,0x02,0x00,0xa7,0x01,
+0x21,0xfd,0x73,0xdb,0x01,0x20,0xff,0x30,0x88,0x00,0xa0,0x79,0x00,0x00,0x01,0x23,
+0x56,0x79,0x94,0x00,0xef,0x43,0x00,0x60,0x60,0x0c,0xa8,0x55,0xee,0x61,0x89,0x01,
+0x40,0xbf,0x21,0x8a,0x90,0x44,0x00,0x80,0x0d,0x6b,0x00,0x00,0x06,0xf4,0x00,0x32,
+0x7d,0x05,0x11,0x60,0xb5,0x05,0x27,0xfc,0x00,0x46,0x00,0x31,0x09,0xff,0xf2,0x15,
+0x00,0x20,0x78,0x00,0x41,0x03,0x30,0x00,0x05,0xf5,0x06,0x03,0xf3,0x08,0xc0,0x00,
+0x4c,0x00,0xaf,0x42,0xbf,0xf4,0x02,0xfe,0xff,0x91,0x00,0x2e,0xfa,0x10,0x00,0x2e,
+0xe4,0x00,0x00,0x0a,0xf4,0x99,0x01,0x60,0x0a,0xf9,0x32,0x34,0x66,0x2e,0x73,0x02,
+0x71,0x04,0x78,0x87,0x63,0x00,0x00,0x67,0x50,0x00,0x20,0x0d,0xe0,0x0b,0x06,0xf0,
+0x0e,0x66,0xfe,0xd7,0x2a,0x20,0x00,0xcf,0xff,0xd9,0x36,0xff,0x80,0x00,0x0b,0xe0,
+0x02,0x53,0xbe,0x00,0x02,0xf8,0x00,0x6f,0x20,0x20,0x00,0xaf,0x20,0x05,0x65,0x04,
+0xf4,0x0e,0x90,0x36,0x9f,0x30,0x00,0x0d,0xf1,0x8f,0xef,0xfd,0x50,0x00,0x14,0x0f,
+0xa0,0x5f,0xef,0x90,0x00,0x00,0xdf,0xbe,0xf3,0x85,0x00,0x00,0x02,0xad,0xc6,0x89,
+0x02,0x11,0xfb,0xed,0x00,0xc0,0x70,0x2f,0xff,0xff,0x54,0xf4,0x01,0x9a,0xba,0xa3,
+0x6f,0x20,0x3d,0x01,0x01,0x30,0x02,0x30,0x9e,0x30,0x00,0x96,0x04,0xf0,0x0a,0x37,
+0x70,0x00,0x00,0x8f,0xe0,0xcc,0x00,0x00,0x07,0xf9,0x0b,0xfb,0x9a,0xca,0x5f,0x60,
+0x2b,0xff,0xff,0xa1,0x72,0x00,0x00,0x10,0xcc,0x00,0xf0,0x29,0x54,0x10,0x00,0x00,
+0x05,0xef,0xff,0xfa,0x10,0x00,0x9f,0xc8,0xf9,0x8f,0xd0,0x05,0xf9,0x07,0xf4,0x06,
+0xf8,0x0c,0xe0,0x0b,0xf0,0x00,0xec,0x0f,0xa0,0x0e,0xd0,0x00,0xcf,0x1f,0xa0,0x4f,
+0x70,0x00,0xed,0x0e,0xe4,0xdf,0x10,0x06,0xf9,0x07,0xff,0xf8,0x01,0x8f,0xf1,0x00,
+0x7c,0x70,0x9f,0xfd,0x5b,0x00,0x80,0x19,0x50,0x00,0x03,0x10,0x00,0x03,0x30,0x7e,
+0x01,0x20,0x0c,0xe0,0xaa,0x02,0xf1,0x27,0x0c,0xe2,0x40,0x6f,0x20,0xef,0xff,0xff,
+0xd0,0x8f,0x00,0x78,0x8d,0xe6,0x40,0x9e,0x00,0x00,0x0b,0xe0,0x00,0xad,0x20,0x00,
+0x0a,0xf0,0x00,0xbd,0xe1,0x4b,0xdf,0xf2,0x00,0xaf,0xc1,0xfb,0x7c,0xff,0x80,0x9f,
+0x84,0xf6,0x1c,0xfc,0xf4,0x6f,0x41,0xef,0xff,0xb0,0x70,0x28,0x10,0x06,0x8a,0x06,
+0x21,0x38,0x20,0x70,0x05,0x10,0xff,0x07,0x00,0x20,0x1e,0xfa,0x5b,0x06,0xf1,0x0a,
+0x0d,0xf6,0x07,0xfd,0x10,0x00,0x0c,0xfa,0x00,0x09,0xfc,0x00,0x02,0xed,0x00,0x00,
+0x0c,0xfb,0x00,0x02,0x30,0x00,0x00,0x0d,0xfb,0xf8,0x00,0x21,0x1d,0xf3,0x07,0x00,
+0x12,0x15,0x06,0x01,0xf2,0x1b,0x71,0x00,0x00,0x01,0x40,0x08,0x7c,0xb0,0x00,0x02,
+0xef,0xc0,0x5f,0x4b,0x00,0x01,0xdf,0xdf,0xb0,0x71,0x00,0x00,0xbf,0x60,0xaf,0x90,
+0x00,0x00,0xaf,0xa0,0x00,0xcf,0x70,0x00,0x4f,0xd0,0x00,0x01,0xef,0x60,0x00,0x64,
+0x99,0x05,0x00,0x5c,0x02,0x11,0xff,0x72,0x00,0x30,0x05,0x70,0x00,0x28,0x03,0xf0,
+0x06,0x13,0x10,0xeb,0x24,0x50,0x5f,0xff,0xff,0xff,0xc0,0x14,0x56,0xfc,0x43,0x10,
+0x45,0x44,0xec,0x67,0x80,0xaf,0x7b,0x04,0xf2,0x0c,0x02,0x23,0xec,0x10,0x00,0x01,
+0x57,0xed,0x10,0x00,0x5f,0xfe,0xff,0xfa,0x10,0xbe,0x00,0xde,0xbf,0xf2,0x7f,0xfe,
+0xfa,0x04,0xa0,0x04,0x88,0xe6,0x04,0x10,0x01,0x47,0x01,0x20,0xfe,0xff,0x8f,0x00,
+0x32,0x1a,0x88,0xfd,0x6a,0x08,0x01,0x1a,0x00,0xf1,0x1b,0x0b,0xf0,0x06,0xe2,0x00,
+0x03,0xbe,0xff,0xb6,0x8f,0x10,0x06,0xfc,0xdf,0x9c,0xff,0xf2,0x00,0xf9,0x1f,0xb0,
+0x03,0xff,0xf3,0x3f,0x6a,0xf3,0x00,0x6f,0xae,0x01,0xff,0xfa,0x00,0x3f,0xd0,0x00,
+0x04,0xa7,0x00,0x8f,0xe3,0xa9,0x04,0x10,0xa2,0x5c,0x08,0x00,0x93,0x00,0x50,0x31,
+0x8f,0x57,0x40,0x60,0xa3,0x02,0xf0,0x01,0x64,0xfc,0x00,0x68,0xcf,0x73,0x00,0x8f,
+0xb0,0x02,0xaf,0x10,0x00,0x09,0xd0,0x4f,0xb1,0x00,0x30,0x10,0xca,0x1f,0x5d,0x00,
+0x80,0xda,0x4f,0x50,0x00,0xaa,0x00,0x9f,0xfe,0x57,0x06,0x90,0x06,0xee,0x00,0x03,
+0xee,0x00,0x00,0xaf,0xfe,0x18,0x05,0x41,0x06,0x9a,0x97,0x30,0x4f,0x00,0x11,0x30,
+0xdb,0x00,0x70,0xce,0x00,0x00,0x00,0xce,0x03,0x6f,0xa3,0x06,0xf0,0x23,0xfe,0xff,
+0xff,0xf6,0x00,0x00,0x7f,0xe6,0x9f,0x5d,0xf4,0x00,0x3f,0xfe,0x0e,0xb0,0x1f,0xc0,
+0x0c,0xd5,0xfc,0xf5,0x00,0xbf,0x00,0xf8,0x0c,0xfd,0x00,0x0c,0xe0,0x0f,0x80,0xcf,
+0xc0,0x03,0xfb,0x00,0xdf,0xff,0xa7,0x06,0xef,0x30,0x02,0xba,0x40,0x4f,0xfe,0x50,
+0x48,0x00,0x15,0x85,0xf4,0x04,0x11,0xce,0xba,0x02,0xf0,0x0a,0xc0,0x00,0x00,0x09,
+0xc8,0xfc,0x67,0x00,0x00,0x7d,0xff,0xff,0xf0,0x00,0x00,0x02,0xf7,0x11,0x00,0x00,
+0x75,0x6f,0x41,0x22,0x95,0xa3,0x07,0xf1,0x11,0x0d,0xe1,0x03,0xaf,0x77,0x50,0x6f,
+0x50,0x08,0xf1,0x00,0x05,0xf7,0x00,0x6f,0x81,0x03,0xdf,0x30,0x01,0xef,0xff,0xff,
+0x70,0x00,0x01,0x8a,0xa8,0x20,0x00,0x00,0x04,0x4c,0x00,0x90,0xff,0xeb,0x82,0x00,
+0x00,0x04,0x8b,0xef,0x30,0x63,0x07,0x40,0x10,0x00,0x08,0xf1,0x15,0x00,0xf1,0x04,
+0xaf,0x2a,0xef,0xe9,0x10,0x0c,0xff,0xd9,0x7b,0xfc,0x00,0xef,0x80,0x00,0x0b,0xf2,
+0x06,0x60,0x00,0x41,0x04,0xd7,0x03,0xbf,0xc0,0x00,0x4f,0xff,0xff,0xc1,0x00,0x00,
+0x9a,0x98,0x40,0xf9,0x06,0x20,0x01,0xf9,0xf6,0x02,0xf2,0x1c,0x63,0xac,0x80,0x04,
+0xf8,0xfd,0xcf,0xb0,0x6f,0xf7,0x00,0xaf,0x37,0xfb,0x00,0x04,0xf6,0x8f,0x50,0x00,
+0x3f,0x87,0xf3,0x00,0x06,0xf6,0x38,0x10,0x00,0xbf,0x30,0x00,0x00,0x9f,0xa0,0x00,
+0x69,0xef,0xc1,0x00,0x08,0xfc,0x60,0xa8,0x01,0x12,0x00,0x3b,0x02,0x70,0xdd,0xee,
+0xfb,0x00,0x00,0xba,0x99,0x08,0x02,0x80,0x02,0xde,0x30,0x00,0x00,0x04,0xed,0x40,
+0xba,0x07,0xf5,0x14,0xff,0xfb,0x20,0x09,0xfd,0x52,0x26,0xfe,0x18,0xf9,0x14,0x40,
+0x06,0xf5,0x17,0x1e,0xff,0xe1,0x5f,0x50,0x05,0xf4,0x2f,0xbe,0xf1,0x00,0x1e,0xfe,
+0xff,0xe4,0x00,0x00,0x16,0x87,0x50,0x44,0x00,0x02,0x1f,0x08,0x11,0x07,0xbd,0x00,
+0xfa,0x2c,0x23,0xaf,0x20,0x69,0x60,0x00,0x2f,0xff,0xf7,0xef,0xff,0x60,0x00,0x64,
+0xbf,0xf8,0x03,0xf8,0x00,0x00,0x1e,0xf6,0x00,0x2f,0x60,0x00,0x0b,0xfa,0x00,0x04,
+0xf5,0x00,0x08,0xff,0xa0,0x00,0x6f,0x30,0x04,0xf9,0xea,0x00,0x07,0xf2,0x12,0x1b,
+0x0e,0xa0,0x00,0x7f,0xdf,0x60,0x00,0xfb,0x00,0x02,0xff,0xc2,0x00,0x01,0x00,0x21,
+0x9f,0x30,0x67,0x04,0x02,0x55,0x00,0x20,0xbf,0x20,0xe3,0x00,0xf0,0x0d,0xff,0xf3,
+0x8c,0xec,0x50,0x00,0x75,0xce,0xef,0xca,0xef,0x70,0x00,0x2f,0xf8,0x00,0x00,0xde,
+0x00,0x0d,0xfa,0x00,0x00,0x0a,0xf0,0x0b,0xff,0xa0,0x8c,0x05,0xc0,0xf6,0xea,0x00,
+0x03,0xcf,0x60,0x06,0x0e,0xa0,0x3d,0xff,0x70,0x0d,0x04,0x26,0x96,0x10,0x24,0x01,
+0x00,0xb5,0x04,0x40,0x21,0x5f,0x73,0x56,0x42,0x01,0xf1,0x22,0xff,0xd0,0x01,0x57,
+0xfa,0x43,0x20,0x00,0x00,0xaf,0x55,0x10,0x29,0x30,0x5f,0xff,0xfe,0x9f,0xf7,0x4f,
+0xe4,0x0b,0xfe,0x81,0x05,0xe2,0x3e,0xff,0x40,0x00,0x00,0x1e,0xc4,0xf4,0x00,0x00,
+0x04,0xf8,0x15,0x10,0x10,0x00,0x1e,0xff,0xef,0xfa,0x00,0x00,0x17,0x70,0x01,0x21,
+0x02,0x20,0x4a,0x00,0x21,0xbf,0x40,0x9c,0x03,0x01,0x52,0x05,0x21,0x0c,0xf2,0x5f,
+0x02,0x12,0xf9,0x19,0x00,0x20,0x89,0x20,0x19,0x00,0x20,0xfe,0xfc,0xef,0x02,0xf0,
+0x15,0xf7,0x0b,0xf0,0x03,0xc1,0x02,0xfc,0x00,0x9f,0x00,0x9f,0x30,0x9f,0x40,0x08,
+0xf5,0x6f,0xc0,0x0f,0xe0,0x00,0x4f,0xff,0xe2,0x00,0x46,0x00,0x00,0x59,0x71,0x00,
+0x77,0x77,0x77,0x77,0x70,0x25,0x07,0xf0,0x04,0xf5,0x10,0x04,0x51,0x4f,0xb0,0x00,
+0x0a,0xf4,0xed,0x10,0x00,0x0b,0xf3,0xb1,0x00,0x00,0x0e,0xc0,0x71,0x05,0x50,0x70,
+0x00,0x00,0x08,0xfd,0x48,0x00,0x14,0xb1,0xc1,0x00,0x70,0x6a,0xa9,0x99,0x99,0x9a,
+0x80,0x8f,0xac,0x05,0x11,0xf2,0x1f,0x01,0x60,0x70,0x00,0x00,0xbf,0x18,0xfb,0x78,
+0x00,0x20,0x5f,0xb0,0x61,0x05,0x10,0x03,0x16,0x00,0x11,0xfc,0x58,0x0b,0x11,0xf8,
+0xfa,0x05,0x11,0xe0,0xa6,0x05,0x10,0x40,0xfd,0x00,0x14,0x92,0x46,0x00,0x10,0x10,
+0xa8,0x01,0x00,0x70,0x0b,0xf4,0x06,0xaf,0xd2,0x00,0x00,0x5e,0xfb,0x10,0x02,0x7d,
+0xff,0xc0,0x00,0x5f,0xfd,0x8f,0xb0,0x00,0x08,0x40,0x0f,0xb0,0xdd,0x08,0x14,0x1f,
+0x05,0x00,0x00,0x3c,0x00,0x11,0x20,0xe9,0x00,0x10,0xf3,0xd9,0x03,0x20,0xdf,0x90,
+0xed,0x01,0xf1,0x09,0xf6,0x00,0x00,0x01,0x7e,0xff,0x30,0x00,0x06,0xbf,0xfe,0xef,
+0x00,0x00,0x0c,0xfa,0x40,0xcf,0x00,0x00,0x02,0x10,0x00,0xcf,0x2f,0x00,0x09,0x06,
+0x00,0x01,0x7f,0x01,0x20,0x79,0x10,0x0b,0x00,0x10,0x20,0xcd,0x00,0x91,0xf1,0x00,
+0x00,0x57,0x77,0xdf,0x87,0x78,0x09,0xb5,0x06,0xf1,0x01,0x9f,0x10,0x00,0x00,0xbf,
+0x39,0xf1,0x00,0x00,0x0f,0xf0,0x9e,0x10,0x00,0x05,0xf9,0xd0,0x07,0x00,0xd8,0x06,
+0x70,0xcf,0x90,0x00,0x00,0x27,0xff,0xb0,0xf1,0x01,0x00,0x9d,0x04,0x24,0x46,0x10,
+0x67,0x08,0x00,0x30,0x01,0x70,0x06,0x88,0xdf,0x98,0x83,0x00,0x00,0x3d,0x00,0x05,
+0x05,0x00,0x60,0x01,0x00,0xaf,0x20,0x11,0x5f,0x73,0x08,0x43,0x28,0x77,0x77,0x77,
+0x17,0x0a,0x11,0x06,0x2d,0x09,0x91,0x04,0xaa,0xae,0xfb,0xaa,0xa1,0x00,0x00,0x0a,
+0x35,0x01,0x0c,0x06,0x00,0x70,0x01,0x00,0x0a,0xf3,0x00,0x01,0x3f,0x2a,0x00,0xd0,
+0xfc,0x2b,0xaa,0xaa,0xaa,0xaa,0xa9,0x00,0x00,0x00,0x11,0x00,0x00,0xa9,0x08,0x00,
+0x2d,0x01,0x30,0xdb,0x01,0x00,0x72,0x01,0x90,0xf4,0x03,0x66,0x6d,0xfd,0x66,0x20,
+0x00,0x09,0x6e,0x08,0xe0,0x2b,0xf8,0xbc,0x00,0x00,0x8f,0xf6,0x0b,0xd0,0x00,0x06,
+0xb2,0x47,0xed,0x50,0x01,0x26,0xff,0x80,0xb6,0x02,0x01,0x22,0x0a,0x00,0x46,0x01,
+0x10,0x01,0x44,0x00,0x11,0x01,0xea,0x00,0x70,0xfb,0x05,0x88,0x88,0xef,0xe8,0x86,
+0x93,0x00,0x10,0xc0,0x41,0x01,0xf1,0x09,0xbd,0xc0,0x00,0x00,0x2c,0xfb,0x0c,0xd0,
+0x00,0x08,0xff,0x80,0x0c,0xd0,0x00,0x0c,0xd3,0x02,0x1d,0xd0,0x00,0x01,0x00,0x0e,
+0x1e,0x00,0x34,0x06,0x88,0x20,0xf6,0x07,0x20,0x0e,0xd0,0x8d,0x00,0x40,0xec,0x00,
+0x10,0x07,0x46,0x00,0xc0,0xf3,0x48,0x89,0xfc,0x88,0xbf,0x30,0x00,0x5f,0x60,0x07,
+0xf2,0xb7,0x00,0x40,0x8f,0x10,0x01,0xfd,0x0c,0x09,0xf2,0x05,0xbf,0x60,0x00,0xce,
+0x00,0x9f,0xc0,0x23,0x3f,0xb0,0x9f,0xd1,0x07,0xff,0xf6,0x00,0x71,0x00,0x27,0x85,
+0x8c,0x00,0x20,0x17,0x00,0x7e,0x0c,0x20,0xa7,0xf3,0x90,0x00,0x81,0x07,0xd8,0x50,
+0x00,0x01,0xfa,0x00,0x18,0x45,0x01,0xd0,0xff,0xd1,0x00,0x69,0x9b,0xfc,0x99,0xdf,
+0x10,0x00,0x00,0x7f,0x40,0x4f,0x09,0x80,0x0c,0xf1,0x00,0xaf,0x00,0x00,0x03,0xfb,
+0xba,0x06,0xf0,0x09,0x00,0xdf,0x40,0x00,0xec,0x00,0x01,0xbf,0xa0,0x32,0x5f,0x90,
+0x00,0xcf,0xc0,0x09,0xff,0xf4,0x00,0x01,0x80,0x00,0x37,0x84,0x01,0x02,0x11,0x63,
+0x59,0x02,0x11,0x70,0x0d,0x08,0xb1,0x7a,0xd8,0x07,0xbd,0xff,0xff,0xfc,0x70,0x9f,
+0xc9,0xdf,0x66,0x07,0xf5,0x03,0xf3,0x01,0x44,0x00,0x14,0x9f,0xde,0xff,0xb9,0xff,
+0xff,0xff,0xb8,0x63,0x7b,0x86,0x3f,0xc0,0x0a,0x02,0x11,0x09,0x9f,0x06,0x11,0x5a,
+0x82,0x07,0x11,0xa2,0xa3,0x07,0x11,0xe0,0x1c,0x00,0xf1,0x0a,0xff,0xff,0xe5,0x00,
+0x09,0xfb,0x88,0x8e,0xf5,0x00,0x9f,0xb0,0x00,0x1f,0xe0,0x0b,0xfb,0x00,0x00,0x8f,
+0x80,0x01,0x70,0x00,0x03,0xff,0x00,0x20,0x2e,0xf4,0x99,0x06,0x10,0xef,0x3e,0x0c,
+0x20,0xaf,0xf6,0x15,0x03,0x01,0x68,0x07,0x15,0x06,0x77,0x04,0x00,0xc4,0x04,0xf0,
+0x04,0x50,0x00,0x55,0xf2,0x00,0x00,0x4f,0xc0,0x07,0xc9,0x60,0x00,0x0c,0xfa,0x77,
+0x9a,0x00,0x00,0x08,0xf6,0x01,0xf0,0x01,0x00,0x07,0xfc,0x00,0x04,0xfb,0x00,0x0a,
+0xfd,0x10,0x00,0xaf,0x50,0x02,0xcb,0x10,0x5d,0x06,0x05,0x27,0x07,0x11,0x2d,0x1f,
+0x03,0x20,0x5e,0xf8,0xbb,0x01,0x30,0xdf,0xf6,0x00,0x5a,0x00,0x18,0xa2,0x4e,0x05,
+0x11,0x51,0x3e,0x02,0x11,0xf9,0xb6,0x06,0x10,0xf4,0x67,0x00,0x10,0x2f,0x33,0x01,
+0xf0,0x01,0x00,0xcf,0xa9,0x9f,0xe9,0x9a,0x09,0xfb,0x00,0x2f,0xa0,0x00,0x2d,0xd1,
+0x00,0x5f,0xb0,0x0b,0x01,0x57,0x05,0x21,0x00,0x04,0xe8,0x06,0x21,0x3e,0xf4,0x74,
+0x02,0x01,0x4e,0x07,0x17,0x95,0x4f,0x00,0xc0,0x12,0x00,0x00,0x55,0xe0,0x00,0x07,
+0xf8,0x00,0x09,0xab,0x50,0x07,0x03,0x30,0x16,0x00,0x00,0x70,0x02,0xd0,0xfd,0x00,
+0x0d,0xfb,0xab,0xfe,0xab,0xa0,0x0a,0xf9,0x00,0x3f,0x90,0x43,0x00,0x10,0x06,0x57,
+0x03,0x12,0x10,0x29,0x03,0x31,0x00,0x5f,0xb0,0x64,0x04,0x22,0xf3,0x00,0x70,0x03,
+0x00,0x70,0x01,0x14,0xb5,0xf3,0x00,0x21,0x00,0x02,0xd9,0x02,0x62,0x1a,0xaa,0xaa,
+0xaa,0xef,0x10,0x56,0x03,0x00,0x05,0x04,0x08,0x0b,0x00,0x10,0x10,0x0b,0x00,0x10,
+0x5f,0x27,0x00,0xc0,0x14,0xba,0xaa,0xaa,0xae,0xf1,0x00,0x00,0x00,0x00,0x46,0x00,
+0xf5,0x12,0x00,0x0b,0xe0,0x00,0xfc,0x00,0x00,0x00,0xbf,0x00,0x0f,0xb0,0x00,0x00,
+0x0b,0xf0,0x00,0xfb,0x00,0x03,0xba,0xef,0xaa,0xaf,0xea,0xb1,0x3f,0xff,0xfe,0xee,
+0xff,0xff,0x10,0x1a,0x00,0xf0,0x00,0x01,0xfa,0x00,0x00,0x00,0xcf,0x00,0x3f,0x80,
+0x00,0x00,0x00,0x00,0x0a,0xf3,0x06,0x00,0x20,0x08,0xfc,0x06,0x00,0x30,0x3d,0xfd,
+0x10,0x07,0x00,0x22,0x98,0x00,0x01,0x00,0xf0,0x1a,0x21,0x05,0x00,0x00,0xfc,0x00,
+0x3f,0xad,0xa5,0x00,0x0f,0xb0,0x03,0xf8,0xa4,0x34,0x98,0xfe,0x88,0xaf,0xc9,0x80,
+0x7f,0xff,0xff,0xff,0xff,0xfe,0x00,0x00,0xfb,0x00,0x3f,0x70,0x00,0x00,0x0f,0xb0,
+0x04,0xf6,0x00,0x27,0x00,0x80,0x6f,0x50,0x00,0x00,0x02,0x10,0x0d,0xf1,0x39,0x00,
+0x20,0x09,0xf9,0x06,0x00,0x11,0x5d,0x54,0x00,0x36,0x01,0xd7,0x00,0x01,0x00,0x11,
+0x01,0x06,0x00,0x20,0x8e,0x60,0x06,0x00,0x20,0x6e,0xfa,0x11,0x00,0xf0,0x0c,0x01,
+0xa5,0x00,0x00,0x10,0x8f,0x70,0x00,0x00,0x08,0x90,0x5e,0xfb,0x00,0x00,0x4f,0xd0,
+0x00,0x95,0x00,0x05,0xfe,0x20,0x00,0x00,0x00,0x9f,0x99,0x00,0xf5,0x03,0x4d,0xfd,
+0x30,0x00,0x04,0x8d,0xff,0x90,0x00,0x00,0x1f,0xff,0xa3,0x00,0x00,0x00,0x06,0x61,
+0x4c,0x00,0xf0,0x19,0x44,0x00,0x00,0xad,0x30,0x05,0xb6,0xe1,0x00,0x09,0xff,0x70,
+0x1f,0x59,0x20,0x00,0x03,0xc3,0x00,0x42,0x00,0x0a,0xd4,0x00,0x00,0x00,0xa6,0x00,
+0x8f,0xf8,0x00,0x00,0x6f,0xb0,0x00,0x2c,0x30,0x00,0x7f,0xd1,0x66,0x00,0xc0,0xbf,
+0xe2,0x00,0x00,0x00,0x05,0xef,0xc2,0x00,0x00,0x04,0x8e,0x4d,0x00,0x40,0x04,0xff,
+0xfa,0x30,0xf6,0x00,0x02,0x4e,0x00,0xa1,0x8a,0xaa,0xaa,0xab,0x40,0x00,0xaf,0xff,
+0xff,0xff,0x12,0x01,0x10,0xef,0x05,0x01,0x20,0x07,0xf8,0x0b,0x00,0x20,0x3f,0xd0,
+0x3e,0x00,0xf0,0x0d,0xef,0x90,0x00,0x00,0x00,0x3e,0xfe,0xf8,0x00,0x00,0x07,0xff,
+0x51,0xef,0x80,0x05,0xef,0xe3,0x00,0x2e,0xf7,0x07,0xf9,0x10,0x00,0x03,0xf7,0x00,
+0xaa,0x00,0x17,0x20,0xe2,0x00,0xf1,0x05,0x85,0xe1,0x00,0x10,0x00,0x00,0x0a,0xba,
+0x60,0x0f,0xff,0xff,0xff,0xf8,0x00,0x00,0xaa,0x99,0x9a,0xff,0x55,0x01,0x20,0x6f,
+0x90,0x06,0x00,0x20,0x1e,0xe1,0x06,0x00,0x21,0x0b,0xf6,0x26,0x01,0xf1,0x12,0xff,
+0xa0,0x00,0x00,0x00,0x1b,0xfb,0xcf,0xa0,0x00,0x00,0x6e,0xf9,0x01,0xdf,0xa0,0x00,
+0xdf,0xf7,0x00,0x01,0xef,0x70,0x05,0xa1,0x00,0x00,0x03,0xb0,0x00,0x00,0x02,0xfa,
+0x52,0x00,0x21,0x1f,0x90,0x3a,0x01,0xf1,0x08,0xf9,0x02,0x59,0xd6,0x00,0x01,0x6f,
 0xee,0xff,0xff,0xc0,0x1f,0xff,0xff,0xc9,0x5c,0xf3,0x00,0xda,0x8f,0x90,0x04,0xfa,
-0x1a,0x00,0x20,0xee,0x10,0x27,0x00,0x22,0x19,0x40,0x2c,0x08,0x00,0x34,0x00,0x41,
-0xd2,0x23,0x57,0x30,0x82,0x03,0x10,0xf5,0x8e,0x14,0x37,0x87,0x65,0x10,0x7f,0x01,
-0x20,0x76,0xd0,0x49,0x0c,0x80,0x0b,0x9b,0x30,0x00,0xaf,0x10,0x00,0x26,0x2a,0x05,
-0xf0,0x05,0x47,0xbe,0xe3,0x02,0x58,0xef,0xff,0xfe,0xff,0x20,0x9f,0xff,0xf8,0x51,
-0x6f,0x80,0x03,0x52,0xaf,0x10,0xfb,0x00,0x40,0x0a,0xf1,0x0a,0xe2,0xb1,0x08,0x22,
-0x10,0x01,0x29,0x02,0x00,0x93,0x0a,0x40,0x7f,0xfe,0xef,0xfc,0xb0,0x06,0xb0,0xbb,
-0xa9,0x60,0x00,0x07,0x10,0x00,0x00,0x89,0x28,0xfa,0x29,0x07,0x20,0x0e,0xf4,0xd6,
-0x04,0x91,0x5f,0xd0,0x00,0x5f,0x90,0x00,0xc7,0x00,0x0c,0xdc,0x03,0x11,0xfc,0x10,
-0x0d,0x10,0x40,0x05,0x00,0x10,0x70,0x3c,0x01,0x10,0x90,0x05,0x00,0x10,0x60,0x8a,
-0x01,0x18,0x10,0xb1,0x06,0x40,0x01,0xb5,0xf1,0x03,0x0e,0x16,0x90,0xa4,0xaf,0x40,
-0x00,0x00,0xd9,0x00,0x5f,0xd0,0x8b,0x0c,0x20,0x0c,0xf6,0xfc,0x1d,0x21,0x03,0xf9,
-0x84,0x07,0x41,0x20,0x00,0x4f,0xb0,0x89,0x01,0x10,0x30,0xe6,0x03,0x10,0xf8,0x94,
-0x07,0x31,0xdf,0xa0,0x00,0xb7,0x1b,0x00,0x69,0x17,0x02,0x33,0x04,0x25,0x09,0x91,
-0xc8,0x0f,0x20,0x00,0xbf,0x7b,0x04,0x11,0x08,0x7b,0x04,0x12,0x8f,0x7b,0x04,0x91,
-0x2d,0x80,0x8f,0x70,0x05,0x90,0x2c,0xfe,0xfd,0xd7,0x12,0x20,0xfd,0x20,0x7b,0x04,
-0xc0,0xdf,0x50,0x00,0x01,0x8f,0xf5,0x04,0x00,0x00,0x8f,0xfc,0x30,0xd2,0x0a,0x18,
-0x50,0xa0,0x08,0x40,0x41,0x00,0x44,0xe1,0x01,0x02,0x80,0x08,0xba,0x70,0x00,0x0c,
-0xfb,0x88,0xad,0xbc,0x00,0x00,0xcc,0x12,0xf1,0x09,0x06,0xfc,0x00,0x03,0xfc,0x00,
-0x08,0xfd,0x27,0x00,0x9f,0x50,0x03,0xec,0x19,0xfe,0x7f,0xc0,0x00,0x01,0x00,0x06,
-0xff,0xf6,0x7b,0x04,0x01,0xbc,0x07,0x30,0x4e,0xf8,0x69,0xce,0x0d,0x11,0xf6,0xec,
-0x09,0x01,0x95,0x00,0x06,0x22,0x02,0x70,0x30,0x00,0x04,0x56,0x79,0xbe,0xf5,0xc0,
-0x0e,0x50,0xe9,0x62,0x00,0x01,0x21,0xdd,0x01,0x10,0x10,0x69,0x10,0x21,0x10,0xef,
-0xf7,0x03,0x64,0x88,0x77,0x9f,0xc7,0x78,0x80,0x93,0x0d,0x24,0xdf,0x10,0x4d,0x03,
-0x21,0x01,0xcf,0xd8,0x00,0x12,0x59,0x46,0x00,0xf2,0x07,0x67,0x00,0x21,0x00,0x9c,
-0x0a,0xf1,0x0a,0xf3,0x09,0xf3,0x4f,0x60,0xee,0x00,0x3f,0x90,0x72,0x4f,0x90,0x00,
-0x50,0xaf,0x08,0x21,0x09,0xf8,0x55,0x02,0x31,0x00,0x00,0x01,0x1e,0x01,0x2b,0x0b,
-0xd5,0x78,0x09,0xf0,0x0a,0x02,0x03,0xe6,0x00,0x07,0x40,0x0e,0xe0,0x0f,0xd0,0x02,
-0xfe,0x00,0x9f,0x50,0xaf,0x30,0x5f,0x80,0x02,0xfb,0x04,0xb3,0x0a,0xf3,0xe7,0x0f,
-0x12,0x01,0xd4,0x0b,0x21,0xaf,0x40,0x83,0x08,0x11,0xb0,0x4b,0x01,0x10,0xc1,0x5a,
-0x16,0x21,0xef,0xc0,0xa1,0x07,0x11,0x80,0x09,0x0a,0x16,0x10,0x4d,0x00,0x94,0xff,
-0xee,0xee,0xfd,0x00,0x01,0x99,0x99,0x99,0x34,0x04,0x60,0x89,0x88,0x88,0x88,0x89,
-0x90,0xcd,0x00,0x00,0x33,0x0b,0x35,0x0e,0xe0,0x00,0x6b,0x08,0x20,0x7f,0x60,0x14,
-0x02,0x20,0xfe,0x10,0x80,0x01,0x01,0x70,0x10,0x2a,0x2a,0x20,0x9a,0x00,0x20,0x55,
-0xe1,0xf9,0x16,0x84,0xac,0xbb,0x50,0x0c,0xfe,0xee,0xff,0x56,0x62,0x00,0x10,0x88,
-0x01,0x00,0x20,0x60,0x4f,0x51,0x00,0x12,0xfa,0x92,0x14,0x05,0x0a,0x05,0x03,0xae,
-0x00,0x25,0xcf,0x60,0x11,0x02,0x00,0x8a,0x24,0x13,0x00,0xc6,0x1d,0x13,0xed,0x63,
-0x07,0xf0,0x03,0x00,0xee,0x40,0x00,0x00,0x0e,0xff,0xfa,0x40,0x00,0xee,0x9e,0xff,
-0xd1,0x0e,0xd0,0x05,0xde,0x1b,0x00,0x11,0x10,0x1b,0x00,0x13,0xfe,0xe7,0x0b,0x02,
-0xb5,0x14,0xf0,0x03,0x3f,0xc0,0x05,0x4f,0x50,0x1f,0xa0,0x0a,0xc7,0xb0,0x1f,0xa0,
-0x01,0xa1,0x00,0x1f,0xd4,0x00,0x77,0x04,0xc0,0xe9,0x30,0x00,0x1f,0xc9,0xff,0xfc,
-0x00,0x1f,0xa0,0x06,0xda,0xaa,0x01,0x12,0x01,0x18,0x12,0x01,0x99,0x1f,0x26,0x2c,
-0x90,0x3d,0x12,0x00,0x1f,0x0f,0x03,0x62,0x09,0x72,0x21,0x11,0x2f,0xc1,0x11,0x20,
-0xdf,0xd2,0x01,0x51,0x88,0x9f,0xd8,0x88,0x80,0xd0,0x1b,0x11,0x00,0xcc,0x20,0x04,
-0x62,0x04,0x20,0x0b,0xf9,0xb7,0x00,0x21,0xef,0xc0,0x36,0x01,0x01,0x8a,0x05,0x64,
-0xcb,0xbb,0xbb,0xc6,0x00,0xdf,0x87,0x04,0x0e,0x01,0x00,0x60,0x32,0x22,0x22,0x22,
-0x22,0x2e,0x56,0x00,0x10,0xf9,0xcd,0x08,0x00,0x9c,0x18,0x11,0x04,0xa7,0x04,0x01,
-0x8a,0x05,0xc1,0x01,0xa9,0x9b,0xfc,0x9a,0x50,0x00,0x1f,0xfe,0xee,0xef,0xfe,0xf4,
-0x0d,0x01,0x46,0x05,0x11,0x06,0x06,0x00,0xf0,0x08,0x4c,0xfd,0x26,0x00,0x00,0x26,
-0xcf,0xff,0x76,0xfe,0x50,0x0e,0xfe,0x75,0xf7,0x06,0xff,0x30,0x34,0x00,0x3f,0x70,
-0x02,0x89,0x11,0x11,0xf7,0x41,0x00,0x26,0x4d,0x70,0x67,0x00,0x20,0x05,0xd7,0x8d,
-0x00,0x20,0xf7,0x00,0xf8,0x14,0x03,0xb9,0x04,0x30,0x01,0xef,0x20,0xe0,0x0f,0x00,
-0x1b,0x02,0xd0,0xe0,0x00,0x00,0x2b,0xfe,0x20,0x00,0x19,0xff,0xd2,0x00,0x00,0x2e,
-0x7e,0x00,0x03,0x38,0x0b,0x11,0x10,0xf7,0x1a,0x20,0x3f,0xa0,0x52,0x12,0x41,0x06,
-0xf7,0x02,0xfd,0xe3,0x0b,0x00,0x61,0x07,0x20,0x0e,0xf0,0xbe,0x03,0x21,0x04,0xfa,
-0xf7,0x00,0x21,0xbf,0x40,0xf1,0x13,0x10,0xd0,0xd5,0x07,0x20,0x0c,0xf6,0x22,0x0d,
-0x20,0x11,0xac,0x6e,0x00,0x09,0xa2,0x07,0x11,0x3c,0x07,0x00,0xe1,0xaa,0xc7,0x00,
-0x05,0xd5,0x0a,0xf3,0xa1,0x00,0x00,0x8f,0x50,0x6f,0x80,0xf4,0x01,0x70,0xef,0x00,
-0x00,0x00,0xfd,0x00,0x08,0x88,0x25,0x10,0x90,0xf5,0x10,0x00,0xb7,0x0a,0x50,0xdf,
-0x20,0x03,0xfd,0x00,0x46,0x1c,0x20,0xdf,0x50,0x3f,0x06,0x21,0x4f,0xc0,0x24,0x00,
-0x25,0x01,0x00,0x05,0x0d,0x11,0x9c,0x4f,0x18,0xe1,0x2a,0x0c,0x00,0x03,0xf9,0x09,
-0xf5,0x9c,0x50,0x00,0x6f,0x70,0x2f,0xc0,0xb4,0x08,0x00,0xde,0x07,0x80,0xef,0x00,
-0x05,0xfa,0x00,0x00,0x4f,0xa0,0xeb,0x00,0x20,0x0b,0xf5,0xe9,0x1f,0x00,0x9d,0x08,
-0x21,0x05,0xfc,0x55,0x02,0x30,0x0f,0xf1,0x2b,0x4e,0x00,0x2b,0xbb,0x20,0x88,0x01,
-0x70,0x49,0x70,0xde,0x00,0x00,0x2f,0x6e,0xda,0x10,0xf4,0x06,0x84,0x00,0xce,0x00,
-0x03,0xaf,0x20,0x0c,0xe4,0x9e,0xff,0xc3,0x00,0xcf,0xff,0xd8,0x20,0x00,0x0c,0xf6,
-0x20,0x41,0x0e,0x12,0x0c,0x07,0x09,0x50,0x52,0x22,0x35,0x60,0x06,0x83,0x0a,0x50,
-0x00,0x03,0x78,0x98,0x86,0x7d,0x14,0xf1,0x0e,0x00,0x03,0xc9,0x0d,0xf0,0x00,0x00,
-0xa2,0xa2,0xde,0x00,0x00,0x09,0xdb,0x0c,0xe0,0x01,0x7d,0xf4,0x00,0xcf,0x7c,0xff,
-0xe9,0x20,0x0c,0xff,0xfa,0x50,0x63,0x20,0x04,0x3d,0x00,0x02,0x48,0x00,0x60,0xf5,
-0x22,0x23,0x56,0x00,0x6f,0xb1,0x0f,0x70,0x00,0x37,0x89,0x88,0x64,0x00,0x3a,0x71,
-0x03,0x11,0x04,0x66,0x0b,0x41,0x01,0x11,0x11,0x11,0xa1,0x09,0x20,0x1f,0xd0,0xd1,
-0x06,0x11,0xf7,0xa1,0x0f,0x13,0x00,0x73,0x05,0x60,0x05,0xef,0x80,0x00,0x01,0x7c,
-0x4f,0x02,0x23,0x0a,0xfa,0x85,0x13,0x08,0x01,0x00,0x30,0x93,0xe1,0x10,0xbd,0x1a,
-0x20,0xb7,0xaf,0x9d,0x00,0x52,0x10,0x7a,0xaa,0xaa,0xab,0x39,0x02,0x11,0xfa,0x4a,
-0x03,0x17,0xf5,0xca,0x09,0x00,0x62,0x03,0x20,0x1c,0xfb,0x4f,0x02,0x20,0xef,0xb0,
-0x3e,0x07,0x11,0xf9,0x27,0x08,0x04,0x08,0x04,0x20,0x09,0xc4,0x6b,0x01,0x21,0x3a,
-0x0b,0xbe,0x0c,0x75,0xb7,0x5a,0xaa,0xaa,0xaa,0xff,0x20,0x51,0x12,0x21,0x07,0xf7,
-0xec,0x0a,0x02,0xfa,0x0e,0x10,0x80,0xf8,0x02,0x10,0xfd,0x87,0x11,0x20,0xdf,0xc1,
-0xfd,0x02,0x20,0xfa,0x10,0xfd,0x02,0x02,0x60,0x01,0x31,0x38,0x10,0x00,0x60,0x0d,
-0x11,0x30,0x15,0x11,0x00,0x07,0x00,0x80,0x0c,0xf6,0x05,0xfe,0x30,0x00,0x0c,0xfa,
-0xc5,0x02,0x00,0xe4,0x06,0x30,0x08,0xfe,0x10,0x82,0x06,0x12,0x0a,0xa6,0x08,0x12,
-0x0c,0x15,0x11,0x12,0x14,0x84,0x00,0x10,0x82,0x15,0x11,0x20,0x09,0x8b,0x15,0x11,
-0xf0,0x04,0xb0,0x5f,0x4a,0x00,0x00,0xdf,0xdf,0xc0,0x61,0x00,0x00,0xbf,0x70,0x9f,
-0xc0,0x00,0x00,0xaf,0xb0,0x03,0x00,0x80,0x4f,0xe1,0x00,0x00,0xbf,0xa0,0x00,0x64,
-0x87,0x0c,0x12,0x90,0xbd,0x04,0x01,0x83,0x0e,0x02,0x5a,0x14,0x20,0x1b,0xb1,0xa0,
-0x09,0x30,0x07,0x75,0x80,0x3a,0x01,0x20,0x77,0x58,0x7b,0x14,0x80,0x81,0xbb,0x10,
-0x00,0xcf,0x61,0xdf,0x80,0x56,0x11,0xc0,0x01,0xdf,0x70,0x00,0x7f,0xd0,0x00,0x02,
-0xef,0x60,0x00,0xa3,0x56,0x11,0x12,0x50,0x83,0x0c,0x11,0x10,0xff,0x00,0x16,0x60,
-0x10,0x05,0x03,0xb3,0x07,0x10,0xa0,0x7e,0x02,0x20,0x01,0xfa,0xba,0x0c,0x00,0x14,
-0x01,0xf0,0x17,0xe0,0x05,0x88,0x89,0xfd,0x88,0x88,0x00,0x00,0x30,0x1f,0x90,0x02,
-0x00,0x00,0x5f,0x61,0xf9,0x0d,0xd0,0x00,0x1e,0xd0,0x1f,0x90,0x5f,0x90,0x0d,0xf4,
-0x01,0xf9,0x00,0xbf,0x30,0x66,0x00,0x2f,0x90,0x8f,0x03,0x21,0xff,0xf8,0x34,0x01,
-0x14,0x88,0x5b,0x01,0x10,0x17,0x84,0x01,0x30,0xa0,0xa8,0xd6,0xda,0x07,0xa2,0x05,
-0xe7,0x90,0x11,0x00,0x2f,0x90,0x16,0x10,0x0a,0x82,0x09,0xf1,0x1c,0x68,0x88,0x9f,
-0xc8,0x88,0x80,0x00,0x02,0x01,0xf9,0x00,0x10,0x00,0x05,0xf6,0x1f,0x90,0xdd,0x00,
-0x01,0xee,0x01,0xf9,0x06,0xf8,0x00,0xcf,0x40,0x1f,0x90,0x0c,0xf2,0x07,0x70,0x02,
-0xf9,0x00,0x38,0x00,0x00,0x0e,0xef,0x80,0xe6,0x08,0x13,0x92,0xa3,0x00,0x30,0x02,
-0xbb,0x20,0x2f,0x08,0xa1,0x69,0x97,0x01,0x10,0x02,0xf9,0x01,0x9a,0x10,0xaf,0xad,
-0x05,0x40,0x06,0x88,0x89,0xfc,0xa3,0x00,0x41,0x20,0x1f,0x90,0x11,0xa3,0x00,0xa0,
-0x0e,0xc0,0x00,0x1e,0xe0,0x1f,0x90,0x7f,0x80,0x0c,0xa3,0x00,0xc1,0xdf,0x30,0x77,
-0x00,0x2f,0x90,0x04,0x81,0x00,0x00,0xee,0xf8,0x31,0x0a,0x22,0xa9,0x20,0x4b,0x0d,
-0x21,0x01,0x00,0xe8,0x04,0x10,0xc1,0xf9,0x05,0x21,0xdf,0xd0,0x57,0x01,0x30,0x20,
-0x00,0x22,0x9a,0x1a,0x40,0x01,0xef,0x51,0xdf,0x8e,0x21,0x26,0xfe,0xf8,0xe9,0x04,
-0x21,0x2e,0xf6,0x52,0x0f,0x11,0xff,0xc6,0x05,0x15,0x58,0x0c,0x10,0x61,0xeb,0x74,
-0x00,0x00,0x59,0xcf,0xfd,0x00,0x60,0x37,0xc5,0x00,0x96,0x30,0x00,0xa0,0x17,0x51,
-0xc8,0x30,0x00,0x14,0x7b,0x24,0x09,0x50,0x04,0x20,0x0b,0xc9,0x52,0x0d,0x17,0x80,
-0xff,0xe9,0x50,0x00,0x03,0x6a,0xef,0xf3,0x44,0x00,0x15,0x70,0xe2,0x03,0x12,0xfe,
-0x3a,0x02,0x01,0x66,0x06,0x00,0x1d,0x04,0x03,0x3a,0x07,0x00,0xa4,0x05,0x00,0x54,
-0x01,0x50,0x07,0xf6,0x00,0xcf,0x30,0x13,0x00,0xc0,0x03,0xfc,0x00,0x00,0x2f,0xb2,
-0x35,0x7e,0xf4,0x01,0xde,0xff,0x4d,0x03,0x65,0x0f,0xdc,0xa8,0x75,0x31,0xcf,0x43,
-0x12,0x02,0x8e,0x08,0x00,0x21,0x16,0x10,0x10,0x50,0x04,0x20,0x0c,0xd3,0xb1,0x04,
-0x90,0x8f,0xf7,0x7f,0x90,0x00,0x00,0x3e,0xff,0xf1,0x4f,0x00,0x00,0x4c,0x05,0xf1,
-0x07,0x1c,0xfd,0xfe,0x30,0x00,0x1c,0xfb,0x08,0xff,0x40,0x7f,0xfb,0x00,0x08,0xf5,
-0x6f,0xf7,0x00,0x00,0x03,0x00,0x62,0x0f,0x02,0x00,0xf6,0x0f,0x20,0x00,0xbf,0xf0,
-0x01,0x00,0x99,0x0d,0x03,0xf9,0x06,0x62,0x6a,0x9a,0xfe,0x99,0x9a,0x99,0xb2,0x01,
-0x05,0x16,0x00,0x00,0xb5,0x00,0x60,0x20,0x12,0x10,0x00,0x0d,0xff,0xc8,0x12,0x42,
-0x17,0xaa,0xa9,0x40,0xcc,0x00,0x21,0x05,0xf5,0x21,0x00,0xf0,0x04,0xa2,0x58,0xbd,
-0x21,0x69,0xff,0xff,0xef,0xe1,0x1f,0xed,0xf7,0x15,0xf6,0x00,0x20,0x3f,0x73,0xfb,
-0xfe,0x14,0x10,0x3a,0xf9,0x0b,0x02,0x1e,0x17,0x15,0x40,0x98,0x10,0x16,0x03,0xc4,
-0x02,0x01,0x57,0x0e,0x00,0xd0,0x09,0x60,0x14,0x8b,0xeb,0x00,0x35,0xbf,0xe3,0x00,
-0xc0,0x3f,0xff,0xfe,0x74,0x1c,0xf3,0x00,0x85,0x1d,0xf0,0x08,0xf8,0x69,0x01,0x20,
-0x46,0xfc,0x2e,0x00,0x34,0xf8,0x05,0x10,0x32,0x04,0x04,0xc7,0x0f,0x03,0x38,0x01,
-0x10,0x4a,0xd9,0x02,0x81,0xba,0xaa,0xab,0x50,0x00,0x0e,0xee,0xee,0xae,0x00,0x01,
-0x26,0x0c,0x21,0x05,0xf6,0x37,0x09,0x71,0x30,0x01,0x99,0x88,0x8d,0xf9,0x91,0x31,
-0x0d,0x07,0x6a,0x20,0x01,0xbb,0x0f,0x00,0x35,0x12,0x56,0x7b,0xbb,0xbb,0xef,0x40,
-0x39,0x11,0x27,0x00,0xef,0x77,0x1b,0x21,0x03,0xfb,0x60,0x01,0x41,0x6f,0x90,0x10,
-0x1f,0x98,0x18,0x20,0x10,0xba,0xc3,0x06,0x60,0xb1,0x24,0x44,0x44,0x44,0x06,0x28,
-0x07,0xa0,0x13,0x22,0x22,0x9f,0x10,0x44,0x33,0x3a,0xf1,0x1f,0x1d,0x00,0x40,0x33,
-0x33,0x3a,0xf1,0x72,0x00,0x10,0x19,0x1b,0x00,0xb3,0x47,0x77,0x77,0xcf,0x10,0x09,
-0x98,0x88,0x88,0x89,0x00,0x58,0x08,0x00,0xe6,0x0c,0x01,0x76,0x14,0x10,0x05,0x27,
-0x0d,0x58,0x00,0x8f,0xfe,0xee,0xef,0x16,0x00,0x10,0x1b,0x16,0x00,0x33,0x01,0xff,
-0xee,0x16,0x00,0x13,0x34,0xa6,0x00,0x00,0x5a,0x00,0x63,0xa0,0x00,0xaa,0x99,0x99,
-0xa6,0x25,0x1d,0xa5,0xfe,0xee,0xee,0xff,0x62,0xa9,0x99,0x99,0x9d,0xf6,0xae,0x00,
-0x20,0x9f,0x70,0xa8,0x04,0xb0,0xc0,0x00,0x00,0x28,0xef,0xa0,0x00,0x00,0x1e,0xfe,
-0x70,0xbf,0x17,0x02,0x2f,0x00,0xf1,0x0f,0x11,0x0a,0xf3,0x00,0x0c,0xf1,0xaf,0x20,
-0x00,0xbf,0x19,0xf2,0x00,0x0b,0xf0,0x9f,0x20,0x00,0xbf,0x09,0xf2,0x00,0x0c,0xf0,
-0xaf,0x30,0x00,0xdf,0x05,0x81,0x85,0x17,0x00,0x43,0x06,0x30,0x2c,0xfc,0x00,0x8f,
-0x2b,0x00,0x1c,0x06,0x00,0xef,0x11,0x10,0x2e,0x6c,0x04,0x31,0xec,0x02,0xf9,0x0d,
-0x00,0x16,0x2f,0x0d,0x00,0x30,0x0f,0xb0,0x2f,0x59,0x07,0xf0,0x0f,0xfa,0x02,0xf9,
-0x00,0x61,0x00,0x5f,0x70,0x2f,0x90,0x5f,0x90,0x0c,0xf2,0x02,0xfa,0x9f,0xd1,0x08,
-0xfb,0x00,0x2f,0xff,0xd1,0x03,0xfe,0x10,0x02,0xff,0x80,0x98,0x02,0x50,0x05,0x20,
-0x00,0x00,0x2d,0x06,0x03,0x03,0x3e,0x02,0x01,0x0b,0x00,0x14,0xfa,0x0b,0x00,0x30,
-0x29,0x01,0xfa,0xf6,0x27,0xf0,0x02,0x1f,0xa0,0x00,0x7f,0xf5,0x01,0xfa,0x05,0xdf,
-0xd3,0x00,0x1f,0xee,0xfe,0x80,0x00,0x01,0xfb,0x2a,0x03,0x1a,0x1b,0x15,0x00,0x56,
-0x0e,0x80,0xfa,0x2f,0xd9,0x99,0x99,0xaf,0xa1,0xf9,0x41,0x00,0x10,0x1f,0x54,0x0d,
-0x08,0x0b,0x00,0x10,0xfa,0x0b,0x00,0x01,0xdb,0x01,0x70,0xa2,0xfd,0x99,0x99,0x9a,
-0xfa,0x05,0x56,0x15,0x71,0x40,0x79,0x88,0x88,0x88,0x97,0x0b,0x6b,0x06,0x00,0x84,
-0x0e,0x21,0xcf,0x2b,0xd1,0x11,0x73,0xbf,0x10,0x00,0x03,0xfb,0x03,0x40,0x2a,0x0a,
-0x20,0x5f,0xd0,0x27,0x08,0x60,0xe2,0x00,0x00,0x06,0xdf,0xf3,0xba,0x03,0x10,0xa2,
-0xb3,0x03,0x01,0x3b,0x0f,0x11,0x90,0x0d,0x02,0x02,0xb0,0x05,0xb1,0xbf,0xe2,0x00,
-0x01,0x70,0x00,0x09,0xc1,0x00,0x0a,0xf1,0xc3,0x02,0x11,0xc0,0xb1,0x17,0x10,0x20,
-0x9e,0x0d,0x00,0x15,0x16,0x62,0x7e,0xfc,0x10,0x00,0x17,0xbf,0xea,0x0d,0x01,0x17,
-0x1b,0x06,0x61,0x02,0x81,0x0e,0xfe,0xee,0xee,0xee,0xfa,0xef,0xff,0xbf,0x01,0x02,
-0x3a,0x17,0x01,0xa7,0x00,0x10,0xbb,0x01,0x00,0x14,0xb8,0x32,0x1a,0x22,0x00,0x9f,
-0x8d,0x06,0x09,0x0d,0x00,0x11,0xff,0x40,0x1b,0x4f,0x9f,0x88,0x88,0x40,0x27,0x00,
-0x03,0x11,0xaf,0x38,0x2c,0x00,0x01,0x00,0x11,0xa1,0x69,0x0a,0x13,0x85,0x83,0x08,
-0x01,0x13,0x00,0x51,0xf7,0x08,0x88,0x8b,0xfa,0x3b,0x00,0x02,0xd8,0x23,0x10,0x06,
-0x28,0x21,0x00,0x72,0x1e,0x10,0xb2,0x0d,0x00,0x31,0xf5,0xaf,0xf7,0xf2,0x23,0x21,
-0x4e,0x60,0x49,0x19,0x06,0xff,0x23,0x09,0x0d,0x00,0x06,0x4e,0x00,0x83,0xf2,0x18,
-0x88,0x89,0xff,0x88,0x88,0x10,0x07,0x07,0x31,0x00,0x7f,0xf7,0xfe,0x1e,0xf0,0x08,
-0xff,0xcf,0xd2,0x00,0x01,0xaf,0xc6,0xf5,0x5f,0xf5,0x04,0xff,0xa0,0x5f,0x50,0x3e,
-0xf5,0x0a,0x40,0x05,0xf5,0x00,0x29,0x57,0x01,0x16,0x50,0x13,0x04,0x03,0x0d,0x00,
-0x07,0x9c,0x00,0xe2,0x07,0x77,0x79,0xf8,0x77,0x77,0x30,0x36,0x66,0x8f,0x86,0x66,
-0x40,0x09,0x1f,0x0b,0xf0,0x19,0x9d,0x00,0x4f,0x30,0x0d,0xa0,0x09,0xd6,0xd4,0xf2,
-0xc5,0xda,0x00,0x9d,0x6d,0x4f,0x2e,0x6d,0xa0,0x09,0xd6,0xe8,0xf8,0xf6,0xda,0x00,
-0x9d,0x6f,0xff,0xff,0x6d,0xa0,0x09,0xd0,0x00,0x00,0x35,0xea,0x00,0x9d,0x1d,0x0a,
-0x40,0x40,0x00,0x00,0x8f,0x98,0x01,0x00,0x94,0x16,0x61,0x89,0x99,0xdf,0x99,0x99,
-0x3e,0xe5,0x01,0xf3,0x02,0xea,0x00,0x8f,0x10,0x3f,0x6e,0xa0,0x08,0xf1,0x03,0xf6,
-0xed,0x77,0xcf,0x87,0x9f,0x6e,0x16,0x00,0x43,0x9f,0x10,0x3e,0x60,0xc0,0x16,0x05,
-0x37,0x00,0x60,0x00,0x23,0x45,0x67,0x9c,0xc0,0x99,0x08,0xb1,0xec,0xa7,0x20,0x02,
-0x66,0x57,0xf7,0x33,0x32,0x00,0x7f,0x74,0x1c,0x63,0x01,0x3f,0x85,0xf6,0x7f,0x52,
-0xaa,0x00,0x81,0x02,0x3f,0x86,0xf7,0x7f,0x52,0x10,0x9f,0xbc,0x03,0xf2,0x0b,0x03,
-0x55,0xdf,0xff,0xe6,0x55,0x00,0x03,0xcf,0xbf,0xbf,0xe6,0x00,0x1c,0xfe,0x43,0xf5,
-0x3e,0xff,0x60,0xa7,0x00,0x3f,0x50,0x06,0xb1,0xa1,0x0e,0x02,0x87,0x24,0x41,0x47,
-0x77,0x77,0x7b,0x24,0x06,0x30,0x7f,0xe3,0x00,0x84,0x14,0x15,0x10,0x08,0x0f,0x2f,
-0x1f,0x80,0x06,0x00,0x02,0x11,0x58,0xb8,0x03,0x2c,0x5f,0xfc,0xab,0x09,0xb0,0x01,
-0xe5,0x00,0x0f,0x60,0x00,0x00,0x8f,0x29,0x60,0xf6,0x30,0x03,0xf5,0x2f,0xe9,0x0f,
-0x9a,0xf2,0x0b,0xf7,0x0e,0xb8,0xff,0xff,0x27,0xff,0x74,0xff,0xff,0x84,0xf2,0x5e,
-0xfb,0xff,0xc2,0xf6,0x4f,0x20,0x3f,0x74,0xe9,0x0f,0x66,0xf1,0x01,0xf7,0x0e,0x90,
-0xfb,0xfe,0x00,0x1f,0x70,0xe9,0x0f,0x74,0x20,0x01,0xf7,0x0e,0xa0,0x00,0x0c,0x80,
-0x1f,0x70,0xce,0x98,0x8a,0xf7,0x01,0xf7,0x03,0xbd,0xdd,0xc9,0x56,0x00,0x11,0xd8,
-0x46,0x02,0x20,0x5f,0x70,0x46,0x02,0x20,0x0d,0xf1,0x0d,0x00,0x20,0x07,0xfa,0xfd,
-0x08,0xf0,0x10,0x74,0xff,0xa4,0x88,0x88,0xcf,0x83,0x8f,0xfa,0x03,0x50,0x09,0xf0,
-0x00,0x5e,0xa0,0xaf,0x20,0x9f,0x00,0x00,0xea,0x01,0xfb,0x09,0xf0,0x00,0x0e,0xa0,
-0x08,0x90,0x0d,0x00,0x21,0x00,0x00,0x0d,0x00,0x30,0x03,0x77,0xdf,0x0d,0x00,0x3b,
-0x1f,0xfe,0x70,0x9e,0x0d,0xf0,0x13,0xe5,0x32,0x7f,0x10,0x00,0x00,0x9f,0x2d,0xb7,
-0xf1,0x00,0x00,0x1f,0xb1,0xfc,0xbf,0x87,0x60,0x0a,0xf6,0x7f,0xff,0xff,0xfc,0x06,
-0xff,0x5d,0xc0,0x7f,0x10,0x00,0x7f,0xf5,0x64,0x88,0x17,0x90,0x5f,0x58,0x88,0xcf,
-0x98,0x83,0x01,0xf5,0xdf,0xdb,0x1b,0x81,0x1f,0x50,0x00,0x7f,0x10,0x00,0x01,0xf5,
-0xa2,0x17,0x09,0x0d,0x00,0xf0,0x07,0x00,0x0b,0x50,0x00,0x15,0xa1,0x00,0x05,0xfa,
-0x9b,0xef,0xfe,0x70,0x00,0xde,0x7d,0xbd,0xf2,0x00,0x00,0x8f,0xa0,0xbc,0x00,0x20,
-0x6f,0xf9,0x88,0x00,0x91,0x0a,0xff,0xa8,0x88,0xdf,0x88,0x81,0x24,0xea,0xd1,0x05,
-0x21,0x0e,0x90,0x1c,0x03,0x11,0xe9,0x1c,0x03,0x04,0x0d,0x00,0x10,0x9f,0x8e,0x05,
-0x64,0x0e,0x95,0x88,0x88,0x88,0x80,0xc9,0x0e,0x31,0xd8,0x00,0xae,0xdf,0x02,0x60,
-0x06,0xe2,0x00,0x00,0x0d,0xd4,0xef,0x06,0xf0,0x0a,0x09,0xf9,0x28,0x88,0x88,0x88,
-0x05,0xff,0x90,0x5e,0x00,0x3f,0x50,0x3e,0xf9,0x04,0xf2,0x06,0xf3,0x00,0x1e,0x90,
-0x2f,0x60,0x8f,0x4e,0x00,0x90,0xf8,0x0b,0xc0,0x00,0x0e,0x90,0x0e,0xa0,0xe8,0x0d,
-0x00,0x70,0x74,0x1f,0x50,0x00,0x0e,0x9b,0xff,0x9f,0x19,0x64,0xe9,0x68,0x88,0x88,
-0x88,0x30,0xa8,0x01,0xf0,0x12,0xd4,0x00,0x15,0x9e,0x70,0x00,0x7f,0x4c,0xff,0xff,
-0xb6,0x00,0x0e,0xb3,0xf9,0x59,0xf0,0x00,0x08,0xf8,0x3f,0x30,0x7f,0x00,0x03,0xff,
-0x83,0xf6,0x38,0xf3,0x31,0x8f,0xf8,0xf4,0x03,0xf4,0x18,0x61,0x5f,0x83,0xf6,0x36,
-0xf6,0x31,0x00,0xf8,0x3f,0x30,0x1f,0x60,0x00,0x0f,0x83,0xf3,0x01,0xe9,0x20,0x00,
-0xf8,0x3f,0x38,0xca,0xd8,0x90,0x0f,0x86,0xff,0xaf,0x8f,0xf6,0x00,0xf8,0x7c,0x72,
-0x84,0x8c,0x3d,0x09,0x41,0x3c,0x30,0x06,0xf1,0xbf,0x10,0x20,0x06,0xf1,0x40,0x09,
-0x61,0x78,0x8b,0xf8,0x88,0x50,0x0b,0x34,0x01,0xf0,0x1f,0xa0,0x6f,0xf5,0x00,0x7f,
-0xff,0x20,0x00,0x8f,0xf5,0x00,0xee,0xfe,0x90,0x00,0x15,0xf5,0x07,0xf7,0xf6,0xf2,
-0x00,0x02,0xf5,0x2f,0x86,0xf1,0xdb,0x00,0x02,0xf7,0xef,0x8a,0xf7,0xaf,0x90,0x02,
-0xf8,0xe5,0xff,0xff,0xca,0x80,0x02,0xf5,0x00,0x3f,0x00,0x00,0x07,0x00,0x16,0xe1,
-0xa8,0x01,0x31,0xd7,0x07,0xb0,0x87,0x07,0x11,0xec,0x65,0x0e,0xf0,0x00,0x5f,0xff,
-0xff,0xf9,0x09,0xf8,0x1e,0xdd,0xf8,0x88,0x56,0xff,0x8b,0xf3,0xae,0x7e,0x14,0xf0,
-0x09,0x89,0x0a,0xff,0xff,0x40,0x3f,0x80,0x00,0xaf,0x55,0x51,0x00,0xf8,0x00,0x0a,
-0xe2,0x22,0x10,0x0f,0x80,0x00,0xaf,0xff,0xf7,0x0d,0x00,0x50,0xf3,0x33,0x10,0x0f,
-0x80,0x45,0x01,0x00,0x0d,0x00,0x16,0xe0,0x55,0x00,0x30,0xe8,0x00,0x7f,0xb3,0x15,
-0x01,0x02,0x0e,0xf0,0x00,0x0e,0xb4,0x77,0xbf,0x77,0x74,0x0a,0xf8,0x14,0x49,0xf5,
-0x44,0x17,0xff,0x86,0x7b,0x10,0x91,0x7c,0xf8,0x6f,0x07,0xf1,0x4f,0x30,0x0e,0x86,
-0x88,0x10,0xb0,0xe8,0x3b,0x5c,0xe4,0x44,0x10,0x0e,0x80,0xdb,0xe9,0x00,0x37,0x48,
-0xf1,0x01,0xff,0x91,0x00,0x00,0x0e,0x98,0xef,0xbf,0xfc,0x94,0x00,0xe8,0x9a,0x30,
-0x17,0xad,0x38,0x06,0x00,0x51,0x02,0x11,0xf8,0x90,0x08,0xf0,0x06,0x9f,0x1f,0xa5,
-0x55,0xce,0x00,0x1f,0xb0,0xf7,0x00,0x09,0xe0,0x0c,0xf8,0x0f,0xa5,0x55,0xce,0x07,
-0xff,0x80,0x1a,0x00,0x21,0x6c,0xf8,0x2a,0x02,0x21,0x1e,0x8c,0xaf,0x12,0x90,0xe8,
-0x67,0xbf,0xff,0x87,0x40,0x0e,0x80,0x2f,0x80,0x28,0xfb,0x03,0xe8,0x4e,0xd8,0xf5,
-0xfc,0x10,0x0e,0xaf,0xd1,0x7f,0x16,0xfa,0x00,0xe8,0x30,0x07,0xf1,0x03,0xac,0x02,
-0x30,0xd3,0x00,0xb7,0x50,0x05,0x00,0xfa,0x32,0x30,0x00,0x1f,0x9e,0x96,0x00,0xf1,
-0x06,0x0a,0xf7,0x34,0x44,0x44,0x44,0x05,0xff,0x70,0xff,0xff,0xff,0x40,0x5c,0xf7,
-0x05,0x55,0x55,0x51,0x00,0x1e,0x0d,0x00,0xa0,0x00,0xe7,0x04,0x44,0x44,0x41,0x00,
-0x0e,0x73,0xff,0x24,0x1b,0xf4,0x03,0xe7,0x3f,0x10,0x00,0xe7,0x00,0x0e,0x73,0xf6,
-0x44,0x4e,0x70,0x00,0xe7,0x3e,0xee,0xee,0xe6,0x9f,0x12,0x30,0x07,0xe1,0x02,0x8d,
-0x07,0xf0,0x36,0xdb,0x00,0xaf,0xfe,0xed,0x00,0x3f,0x60,0x6f,0xe5,0x6f,0x90,0x0c,
-0xf3,0x5d,0xbe,0xac,0xe1,0x06,0xff,0x4f,0x31,0x9f,0xf8,0x10,0x8f,0xf4,0xfc,0xfe,
-0x89,0xff,0x61,0x7f,0x4f,0x74,0x3b,0xa0,0x60,0x04,0xf4,0xf3,0xae,0x84,0xa1,0x00,
-0x4f,0x4f,0x22,0x6b,0xe4,0x30,0x04,0xf4,0xf2,0x9c,0x64,0xce,0x20,0x4f,0x30,0x16,
-0x9d,0xfa,0x10,0x04,0xf3,0x02,0xea,0x51,0x99,0x08,0x30,0x30,0x08,0xb0,0x02,0x0a,
-0x70,0x66,0xbf,0x76,0x60,0x00,0xec,0x6f,0xcd,0x02,0xf0,0x00,0xaf,0x60,0x6d,0x00,
-0x7e,0x00,0x6f,0xf5,0x03,0xf2,0x0d,0xa0,0x06,0xef,0x5e,0xf8,0x00,0x90,0x03,0xf5,
-0x44,0x44,0x44,0x44,0x20,0x2f,0x50,0xc1,0x1b,0xc0,0x02,0xf5,0x0e,0xb6,0x67,0xf7,
-0x00,0x2f,0x50,0xe8,0x00,0x0f,0x0d,0x00,0x20,0xc7,0x77,0x0d,0x00,0x45,0xef,0xee,
-0xef,0x70,0xa4,0x03,0xf1,0x17,0x00,0x0d,0xa0,0x00,0x00,0x9f,0x4d,0xdd,0xff,0xdd,
-0x60,0x2f,0x91,0x66,0x6f,0xa6,0x62,0x0c,0xf5,0x13,0x4e,0xff,0xed,0x09,0xff,0x57,
-0xe4,0xf5,0x3a,0xe0,0x7d,0xf5,0x7e,0x4f,0xff,0xfe,0x01,0x4f,0x0d,0x00,0x11,0x02,
-0x0d,0x00,0x60,0x00,0x2f,0x57,0xe4,0xf8,0x7c,0x0d,0x00,0xf3,0x02,0x27,0x77,0x77,
-0x00,0x2f,0x57,0xfe,0xee,0xee,0xe8,0x02,0xf5,0x36,0x66,0x66,0x66,0x30,0x56,0x03,
-0x21,0x01,0xf6,0xfd,0x01,0xf0,0x06,0x8f,0x8e,0xee,0xfe,0xed,0x00,0x1f,0xa7,0xf5,
-0x55,0x5b,0xe0,0x0a,0xf6,0x7f,0x55,0x55,0xbe,0x06,0xff,0x67,0xa8,0x01,0xf0,0x08,
-0x8f,0xf6,0x8f,0x55,0x55,0x55,0x01,0x4f,0x69,0xef,0xff,0xff,0xf1,0x01,0xf6,0xac,
-0xf4,0xd8,0x5f,0x10,0x1f,0x6d,0xaf,0x0d,0x00,0xf5,0x03,0xf7,0xf7,0xf7,0xea,0x7f,
-0x10,0x1f,0xcf,0x3f,0x4d,0x88,0xf1,0x01,0xf9,0x91,0xf4,0xd8,0xcb,0xa2,0x01,0x30,
-0xc2,0x00,0xbc,0x1c,0x1f,0x10,0xef,0xdf,0x03,0xf0,0x0d,0x1f,0x84,0x88,0x88,0x88,
-0x50,0x0c,0xf3,0x1f,0xb9,0x9a,0xf4,0x07,0xff,0x31,0xfd,0xbb,0xcf,0x40,0x4d,0xf3,
-0x36,0x66,0x66,0x63,0x00,0x4f,0x6f,0x05,0x19,0xf0,0x09,0x02,0xf6,0xf5,0x44,0x44,
-0x5f,0x40,0x2f,0x45,0xef,0xff,0xff,0x51,0x02,0xf3,0x01,0x1b,0xe1,0x10,0x00,0x2f,
-0x30,0x26,0xce,0x5d,0x29,0x11,0x02,0xa8,0x04,0x21,0x22,0x00,0x5f,0x09,0xf0,0x21,
-0xde,0xff,0xf0,0x02,0xf3,0x01,0xf7,0xe7,0x7f,0x3a,0x3f,0x30,0x8f,0x3e,0xbb,0xf4,
-0xf3,0xf3,0x2f,0xf3,0xec,0xcf,0x4f,0x3f,0x3a,0xff,0x3e,0x66,0xf4,0xf3,0xf3,0x6c,
-0xf3,0xef,0xff,0x4f,0x3f,0x30,0x4f,0x3e,0x77,0xf4,0xf3,0xf3,0x04,0xf3,0xeb,0xbf,
-0x0d,0x00,0x30,0x3c,0xcc,0xd4,0x0d,0x00,0xf4,0x03,0x8b,0x7c,0x00,0x3f,0x30,0x4f,
-0x6f,0x63,0xf4,0x59,0xf2,0x04,0xf7,0x90,0x06,0x17,0xfa,0x00,0xff,0x26,0x80,0xd0,
-0x0f,0x70,0xf8,0x00,0x00,0xdc,0xcf,0xa2,0x01,0xf0,0x23,0x4f,0x56,0x7f,0xb7,0xfb,
-0x70,0x0d,0xf6,0xcc,0xfe,0xcf,0xec,0x58,0xff,0x59,0xfd,0x88,0x88,0x83,0x6e,0xf5,
-0xcf,0xed,0xdd,0xdd,0x00,0x5f,0xdf,0xf8,0x9f,0x6a,0xf0,0x04,0xf5,0x8f,0xff,0xfe,
-0xff,0x00,0x4f,0x33,0xf7,0x8f,0x5a,0xf0,0x04,0xf3,0x3f,0xff,0xff,0x0d,0x00,0x30,
-0xf5,0x6f,0x4a,0x0d,0x00,0x80,0x35,0xf5,0xe9,0x00,0x00,0x1b,0x32,0xc4,0xa4,0x06,
-0x20,0xf2,0xcf,0xab,0x1e,0x71,0xfb,0xbf,0x65,0xed,0x22,0x00,0x9f,0x99,0x0b,0x90,
-0x5f,0xf4,0x7f,0x28,0xe2,0x9e,0x08,0xff,0x45,0x0d,0x00,0xf6,0x16,0x16,0xf4,0x3a,
-0xff,0x30,0x68,0x00,0x2f,0x5b,0x98,0xfe,0xcf,0x80,0x02,0xf5,0x8e,0xb8,0xf9,0xf6,
-0x00,0x2f,0x45,0x7b,0xee,0x88,0xe3,0x02,0xf6,0xdf,0xb6,0xf7,0x0c,0x80,0x2f,0x44,
-0x13,0xfd,0xed,0x12,0x81,0x11,0x11,0x11,0x11,0x10,0x00,0x0e,0xff,0xcf,0x02,0x44,
-0x56,0x66,0x66,0x66,0x8c,0x16,0x11,0x08,0x3b,0x08,0x12,0x41,0xee,0x06,0x51,0x00,
-0x03,0xf7,0x08,0xf1,0xa0,0x21,0x20,0x8f,0x10,0x42,0x15,0xfc,0x08,0x08,0xf1,0x05,
-0x20,0x05,0xfa,0x00,0x8f,0x10,0xbb,0x08,0xfd,0x10,0x07,0xf8,0x7f,0x81,0xda,0x10,
-0x00,0x2d,0xff,0xd2,0xdc,0x11,0x11,0x7f,0xae,0x03,0x00,0x4e,0x1d,0x12,0x02,0x2e,
-0x08,0xf0,0x05,0x17,0x7a,0xfd,0x77,0xa9,0x77,0x10,0x01,0xee,0x10,0x1e,0xe2,0x00,
-0x02,0xdf,0x85,0x67,0xbf,0xe1,0x00,0xf4,0x17,0x80,0xef,0xc0,0x00,0x11,0xfb,0x0d,
-0xd0,0x53,0x80,0x06,0xf3,0x08,0xdd,0x00,0x40,0x00,0x2d,0xf2,0x0d,0xd0,0x0e,0x91,
-0x8e,0xf7,0x00,0xcf,0x77,0xf7,0x1e,0xd5,0x00,0x06,0xef,0xfd,0x10,0xb3,0x00,0x31,
-0x1b,0x41,0xf7,0xed,0x0b,0x61,0x5f,0x93,0x33,0x10,0x00,0xbf,0x9c,0x00,0x90,0x3f,
-0x93,0x4f,0x93,0x33,0x10,0x05,0xd0,0x01,0x1a,0x00,0x10,0x88,0x40,0x0e,0x12,0x84,
-0x8e,0x0b,0x00,0x10,0x2c,0x20,0x7f,0x10,0xbc,0x08,0x10,0x07,0xed,0x04,0xf5,0x03,
-0xee,0x00,0x7f,0x10,0xd6,0x07,0xef,0x40,0x07,0xf8,0x7f,0x60,0xdd,0x40,0x00,0x2d,
-0xff,0xd1,0x52,0x1e,0x12,0xa2,0x82,0x09,0x01,0xe8,0x27,0x02,0xfa,0x09,0x02,0x35,
-0x0b,0x00,0x9f,0x0d,0x11,0x10,0x95,0x13,0x11,0xfa,0x25,0x08,0x20,0x69,0xf4,0x9c,
-0x07,0x30,0xe0,0x1e,0xe0,0xc0,0x10,0x50,0x00,0x7f,0xa0,0x00,0x1b,0x08,0x2e,0x30,
-0xa0,0x3e,0xfb,0x80,0x0f,0x20,0x70,0x98,0x2a,0x00,0x1c,0xb1,0x05,0x01,0x21,0x4e,
-0x50,0x6b,0x19,0x01,0x03,0x10,0xf0,0x04,0x5f,0xc3,0xdf,0x50,0x00,0x03,0xcf,0xa0,
-0x01,0xcf,0xa2,0x06,0xff,0xc5,0x55,0x55,0xdf,0xf7,0x1a,0xa9,0x0e,0x23,0xab,0x20,
-0x0c,0x09,0x51,0x16,0x69,0xf9,0x66,0x20,0xc7,0x25,0x10,0xf6,0x2e,0x0a,0x00,0x6e,
-0x00,0x51,0x66,0x66,0x9f,0x96,0x66,0x79,0x17,0x00,0xe5,0x24,0x41,0x03,0x82,0x02,
-0x93,0x9b,0x1c,0x21,0x2f,0xc0,0xe2,0x11,0xf1,0x08,0x8f,0x70,0x00,0x2e,0xf2,0x00,
-0x00,0xdf,0x50,0x1d,0xf5,0x0a,0xc2,0x02,0xef,0x41,0xc8,0x03,0xfd,0x00,0x04,0xd1,
-0x00,0x1c,0x0e,0x00,0x98,0x0c,0x21,0x1d,0xa0,0xf7,0x1d,0xf4,0x07,0x9f,0x60,0x00,
-0x3e,0xfa,0x9a,0xbd,0xff,0x10,0x05,0xff,0xff,0xed,0xcb,0xfa,0x00,0x05,0x31,0x00,
-0x00,0x0b,0xa0,0xa2,0x00,0x40,0x06,0xf3,0x00,0xcd,0x2e,0x00,0xc1,0x30,0x0c,0xd0,
-0x00,0x06,0x8b,0xf9,0x88,0xee,0x88,0x20,0xbf,0xbe,0x1b,0x09,0x1a,0x00,0x82,0x18,
-0x8b,0xfa,0x88,0xee,0x88,0x52,0xff,0x96,0x09,0x40,0x01,0x50,0x00,0x43,0xc2,0x15,
-0x70,0x60,0x1d,0xf7,0x00,0x05,0xef,0x60,0x09,0x01,0x10,0x9d,0xc7,0x10,0x14,0xd3,
-0x55,0x00,0x11,0x5f,0xd5,0x0c,0x55,0x05,0xf6,0x33,0x33,0xcf,0x0d,0x00,0x30,0xf7,
-0x44,0x44,0x0d,0x00,0x01,0xc3,0x0c,0x0a,0x1a,0x00,0x43,0xf5,0x22,0x22,0xbf,0xb4,
-0x0a,0xf5,0x05,0xa0,0x55,0xbf,0x75,0x5d,0xe7,0x53,0x05,0xcf,0xc2,0x00,0x7e,0xfa,
-0x20,0xcc,0x50,0x00,0x00,0x08,0xe4,0x4d,0x01,0x22,0x6f,0x30,0xb0,0x00,0x02,0x01,
-0x24,0xf0,0x14,0x9e,0xd8,0x8c,0xfa,0x88,0xf9,0xe9,0x00,0x8f,0x10,0x0e,0x9e,0x90,
-0x0d,0xf7,0x00,0xe9,0xe9,0x05,0xfd,0xf8,0x0e,0x9e,0x94,0xfd,0x09,0xf6,0xe9,0xec,
-0xfc,0x10,0x0b,0xae,0x9e,0x93,0xef,0x07,0xa3,0xe9,0x00,0x00,0x07,0x8f,0x8e,0x90,
-0x00,0x00,0xbf,0xb0,0x1f,0x02,0xca,0x15,0xb3,0xec,0x77,0xbf,0x87,0x7c,0xf0,0xe9,
-0x00,0x7f,0x10,0x08,0x06,0x00,0x02,0x12,0x00,0x02,0x1e,0x00,0x11,0xea,0x86,0x23,
-0x1a,0xe9,0x06,0x00,0x40,0x05,0x8d,0xf0,0xe9,0x7f,0x14,0x11,0x70,0xbb,0x15,0x83,
-0xfd,0x01,0x66,0x66,0xbf,0x66,0x66,0x50,0xaf,0x23,0x11,0x4f,0x23,0x1b,0xf1,0x0c,
-0x04,0xf7,0x5b,0xf5,0x5c,0xd0,0x00,0x4f,0x86,0xbf,0x66,0xcd,0x00,0x04,0xfe,0xef,
-0xfe,0xef,0xd0,0x03,0x7f,0x64,0xaf,0x44,0xce,0x41,0xcf,0xdf,0x00,0xd0,0x52,0x6f,
-0x52,0x22,0x22,0xbe,0x20,0x04,0xf3,0x00,0x04,0x6d,0xd0,0xc6,0x39,0x22,0x6f,0xe6,
-0x11,0x1e,0xf1,0x08,0x02,0xc4,0x09,0xf1,0x07,0xc0,0x3f,0x50,0x9f,0x10,0x9f,0x13,
-0xf5,0x09,0xf1,0x09,0xf1,0x3f,0xb8,0xdf,0x98,0xdf,0x13,0x70,0x15,0xf1,0x07,0x98,
-0x00,0x9f,0x10,0x1a,0x6e,0xd0,0x09,0xf1,0x01,0xf9,0xed,0x00,0x9f,0x10,0x1f,0x9e,
-0xd3,0x3b,0xf4,0x35,0xf9,0xa9,0x00,0x66,0x94,0x44,0x44,0x44,0x46,0xf9,0x6d,0x02,
-0x81,0x4e,0x40,0x00,0x00,0x0d,0xf2,0x00,0xee,0x0f,0x1c,0x21,0x05,0xfa,0x9d,0x16,
-0xa0,0x0a,0xf8,0x04,0xff,0xb7,0x77,0x77,0x8f,0xf5,0x0b,0x84,0x00,0x11,0xca,0xf9,
-0x1c,0x10,0xf9,0x5a,0x0e,0x00,0x68,0x0a,0x00,0xa5,0x11,0x50,0xf7,0x00,0x00,0x2e,
-0xf2,0xf6,0x22,0x80,0x8f,0xf5,0x05,0x8c,0xf3,0x00,0x0b,0xc3,0x4c,0x09,0x0a,0x01,
-0x00,0x90,0x0c,0x90,0x02,0x22,0x22,0x20,0x00,0x6e,0x16,0xa2,0x1b,0xf0,0x31,0xff,
-0xfe,0x55,0xdd,0x5a,0xf0,0x26,0x6d,0xe0,0x0d,0xb0,0x7f,0x00,0x03,0xf7,0x20,0xea,
-0x07,0xf0,0x01,0xdf,0x9d,0x0f,0x80,0x8f,0x01,0xdf,0xff,0x23,0xf5,0x08,0xf0,0x7f,
-0xef,0xea,0x6f,0x20,0x9e,0x00,0x4a,0xe3,0x4d,0xd0,0x0a,0xd0,0x00,0xae,0x05,0xf7,
-0x00,0xcc,0x00,0x0a,0xe3,0xfd,0x18,0x9f,0x90,0x00,0xae,0x0a,0x20,0xbd,0xb1,0x71,
-0x04,0xfa,0x36,0x60,0x00,0x8f,0x0e,0xa5,0x6f,0x63,0x50,0x8f,0x0e,0x70,0x1f,0x69,
-0xe0,0x8f,0x0e,0xda,0xbf,0x69,0xe0,0x8f,0x0c,0xff,0xdd,0x59,0xe0,0x8f,0x00,0xbd,
-0x00,0x09,0xe0,0x8f,0x00,0xdf,0xff,0x89,0xe0,0x8f,0x00,0xfb,0x7f,0x79,0xe0,0x8f,
-0x03,0xf4,0x0f,0x68,0xe0,0x8f,0x0a,0xf0,0x1f,0x50,0x00,0x8f,0x5f,0x84,0x8f,0x30,
-0x68,0xde,0x3b,0x0c,0xfa,0x00,0x7f,0xe7,0xa4,0x00,0xf0,0x02,0x4a,0xf3,0x00,0x08,
-0xf0,0x4c,0xff,0xfb,0x41,0x41,0x8f,0x02,0xa7,0xfa,0x00,0x4f,0x48,0x96,0x0a,0xf0,
-0x21,0x04,0xf4,0x8f,0x05,0xff,0xff,0xff,0x4f,0x48,0xf0,0x26,0x9f,0xc6,0x64,0xf4,
-0x8f,0x00,0x0c,0xff,0x60,0x4f,0x48,0xf0,0x06,0xff,0xef,0x84,0xf4,0x8f,0x03,0xf8,
-0xea,0x86,0x4f,0x48,0xf0,0x6d,0x0e,0xa0,0x00,0x00,0x8f,0x00,0x10,0xea,0x00,0x06,
-0x9d,0x34,0x00,0x02,0x5a,0x00,0x01,0x73,0x04,0x00,0xd3,0x08,0xf3,0x3a,0x01,0xf7,
-0x14,0x49,0xf7,0x44,0x36,0x1f,0x75,0xff,0xff,0xff,0xe7,0xf2,0xf7,0x01,0xaf,0x44,
-0x51,0x7f,0x2f,0x70,0x7f,0x83,0xcc,0x07,0xf2,0xf7,0x0f,0xff,0xff,0x30,0x7f,0x2f,
-0x70,0x43,0xaf,0x6c,0x97,0xf2,0xf7,0x01,0xbf,0x79,0xf4,0x7f,0x2f,0x71,0xee,0x59,
-0xf8,0x07,0xe2,0xf7,0x03,0x4c,0xff,0xa1,0x00,0x1f,0x72,0xaf,0xd3,0x3e,0xd1,0x78,
-0xf6,0x0d,0x70,0x00,0x23,0x0e,0xfc,0xc5,0x04,0xf7,0x15,0x28,0x0f,0x85,0xa0,0x00,
-0x7f,0x03,0xf2,0xf8,0xad,0x39,0x07,0xf0,0x0e,0x8f,0x8f,0x76,0xf1,0x7f,0x00,0xa7,
-0xfb,0x95,0x6f,0x17,0xf0,0x0f,0xff,0xff,0x96,0xf1,0x7f,0x00,0xf9,0x33,0xf9,0x0d,
-0x00,0x22,0x22,0xe9,0x0d,0x00,0x21,0x95,0xc1,0x1a,0x00,0xe1,0x00,0x07,0xf0,0x0f,
-0x72,0x7f,0x80,0x56,0xcf,0x00,0xf7,0x1f,0xd3,0x08,0xdc,0x2c,0x01,0x05,0x15,0x11,
-0x01,0x03,0x00,0x20,0x08,0xf4,0x07,0x16,0x72,0x34,0x6f,0xc4,0x45,0xfd,0x44,0x09,
-0x76,0x05,0x10,0x01,0xe5,0x05,0xf1,0x09,0x53,0x00,0xef,0xff,0xf3,0x9b,0x0f,0x70,
-0x0e,0xb4,0x7f,0x3a,0xc0,0xf7,0x00,0xef,0xee,0xf3,0xac,0x0f,0x70,0x0e,0xa3,0x6f,
-0x0d,0x00,0x13,0xef,0x0d,0x00,0xfc,0x01,0x34,0x50,0xf7,0x00,0xe9,0x27,0xf3,0x05,
-0x7f,0x60,0x0e,0x95,0xfc,0x00,0x8f,0xd2,0xd0,0x05,0xf0,0x3c,0x00,0x00,0x01,0xf4,
-0x3d,0xde,0xfd,0xdc,0x14,0x1f,0x44,0xf4,0x5b,0x49,0xe6,0xf1,0xf4,0x1c,0xff,0xff,
-0xf7,0x6f,0x1f,0x40,0x28,0xaf,0x87,0x06,0xf1,0xf4,0x02,0xac,0xfb,0x80,0x6f,0x1f,
-0x42,0xcc,0xdf,0xcc,0x96,0xf1,0xf4,0x04,0x47,0xf5,0x43,0x6f,0x1f,0x40,0x7f,0xff,
-0xff,0x46,0xe1,0xf4,0x08,0xd4,0x45,0xf4,0x00,0x1f,0x40,0x8f,0xcc,0xcf,0x40,0x69,
-0xf4,0x08,0xd5,0x56,0xe4,0x0a,0xeb,0x2e,0x10,0x02,0x0a,0x2d,0x10,0x90,0x6d,0x06,
-0x51,0x8f,0xd8,0x88,0x87,0x0f,0x55,0x03,0x01,0x9e,0x11,0x11,0xdc,0x11,0x05,0x10,
-0xeb,0x9d,0x2d,0x20,0x00,0xfa,0xf1,0x2a,0x20,0x00,0xf9,0x88,0x10,0x20,0x02,0xf7,
-0xfb,0x1a,0xd6,0x05,0xf5,0x1b,0xfd,0x10,0x09,0x9e,0xf1,0x0c,0xa0,0x00,0x0c,0xfe,
-0xa8,0x14,0xf0,0x05,0x0b,0xd0,0x00,0x07,0xbb,0xbb,0x30,0xbd,0x00,0x00,0x8d,0xff,
-0xd6,0x3c,0xe3,0x33,0x00,0x0e,0x90,0x8f,0x5d,0x04,0x50,0xe9,0x02,0x3d,0xc3,0x9f,
-0xfc,0x0b,0xf0,0x0e,0xea,0x08,0xf0,0x00,0xe9,0x00,0x1f,0x70,0x9f,0x00,0x0e,0xca,
-0x66,0xf3,0x09,0xe0,0x8e,0xff,0xd5,0xce,0x00,0xbd,0x07,0xb7,0x20,0x7f,0x70,0x0d,
-0xb0,0x0c,0x2c,0x97,0x78,0xf9,0x00,0x00,0x0a,0xb0,0x0d,0xfd,0x20,0x9f,0x2b,0x00,
-0xfb,0x02,0x90,0xc0,0x00,0x56,0x66,0x60,0x38,0xee,0x88,0x5d,0x89,0x34,0xf2,0x28,
-0xff,0xf8,0xdb,0x19,0xf1,0x00,0xea,0x0f,0x8d,0xb0,0x8f,0x10,0x0f,0x81,0xf7,0xdb,
-0x08,0xf1,0x01,0xf6,0x2f,0x6d,0xb0,0x8f,0x10,0x3f,0x43,0xf5,0xdb,0x08,0xf1,0x07,
-0xf2,0x4f,0x4d,0xb0,0x8f,0x10,0xdd,0x06,0xf2,0xdd,0x8c,0xf1,0x5f,0x89,0xef,0x0d,
-0xff,0xff,0x14,0xd0,0xee,0x60,0xcb,0x18,0x30,0x06,0x49,0x2e,0x20,0x03,0xf4,0x4c,
-0x3d,0x50,0x14,0x4e,0xb4,0x40,0x9c,0xf1,0x05,0xf5,0x2f,0xfe,0x1a,0xd1,0x10,0x03,
-0xd5,0x5b,0x2d,0xff,0xff,0x30,0x9e,0x03,0xf6,0x4c,0xc7,0xf3,0x4f,0x60,0x7c,0xf1,
-0xba,0x3f,0x20,0x7e,0x8f,0x75,0x0d,0x83,0xf2,0x00,0x6f,0xf1,0x01,0xf5,0x4f,0x10,
-0x02,0xff,0x50,0x5f,0x15,0xf0,0x01,0xde,0xae,0x0d,0xb0,0x6f,0x03,0xef,0x20,0x49,
-0xf5,0x6c,0xd0,0x1b,0x20,0x00,0xb7,0x1f,0xe6,0x1a,0x0e,0x20,0x12,0x00,0xbd,0x2c,
-0xa0,0xff,0xc5,0x0c,0xa0,0x00,0x01,0x0f,0x70,0x00,0xca,0xe0,0x1b,0xfa,0x2f,0xfe,
-0x3d,0xb3,0x31,0x27,0x7f,0xb7,0x7f,0xff,0xff,0x42,0xf9,0xfc,0xcc,0x2e,0xa5,0xf4,
-0x2f,0xdf,0xee,0xc0,0xf7,0x3f,0x32,0xf7,0xfb,0xbc,0x1f,0x64,0xf3,0x19,0x9f,0xc9,
-0x75,0xf3,0x4f,0x23,0xdd,0xfe,0xdb,0xbf,0x05,0xf1,0x03,0x3f,0xa5,0x7f,0x80,0x7f,
-0x06,0xde,0xff,0xff,0xf4,0x7d,0xe0,0x47,0x64,0x32,0xc3,0x2f,0xe6,0xe6,0x1e,0x42,
-0x00,0xbe,0x09,0xf1,0x12,0x19,0xf1,0x09,0x10,0x22,0x00,0x0c,0xf2,0x09,0xf1,0x1d,
-0xf2,0x09,0xff,0x00,0x9f,0x1c,0xf9,0x05,0xff,0xf0,0x09,0xfc,0xfb,0x00,0x1d,0xcf,
-0xc0,0x1c,0x31,0x09,0xf0,0x5e,0xa3,0x10,0xb0,0xbf,0xff,0x10,0x03,0x00,0x09,0xf5,
-0x8a,0xf1,0x00,0xf7,0x56,0x24,0xf2,0x00,0x10,0x2f,0x70,0x09,0xf0,0x07,0xfd,0xcd,
-0xf3,0x00,0x9f,0x00,0x19,0xcc,0xc7,0x9e,0x14,0xf1,0x02,0x10,0x00,0x0a,0xd0,0x9f,
-0x10,0x6f,0x60,0x00,0x4f,0x62,0xf7,0x0e,0xd0,0x00,0x0f,0xff,0x2c,0x1a,0xf2,0x17,
-0xfa,0x45,0xfa,0x45,0xf8,0x00,0x0f,0xed,0xdf,0xed,0xdf,0x80,0x00,0xfa,0x56,0xfa,
-0x55,0xf8,0x00,0x0f,0xdb,0xbf,0xdb,0xbf,0x80,0x00,0xaa,0xab,0xfd,0xaa,0xa5,0x00,
-0x66,0x66,0x7f,0xb6,0x66,0x64,0xe8,0x07,0x00,0x5f,0x11,0x11,0x70,0xa4,0x00,0x12,
-0xf7,0xab,0x00,0x24,0xf8,0x00,0x53,0x2a,0x11,0x02,0xcc,0x22,0x72,0x00,0x18,0x88,
-0x8f,0xc8,0x88,0x50,0x1a,0x00,0x12,0x02,0xc2,0x06,0xf0,0x0c,0x19,0x99,0xdf,0xb9,
-0x99,0x99,0x60,0x00,0x2f,0xc0,0x09,0xb0,0x00,0x00,0x0c,0xe1,0x00,0x6f,0x80,0x00,
-0x09,0xf8,0x45,0x67,0xff,0x30,0x05,0xd7,0x14,0xe0,0xfc,0x00,0x09,0x65,0x32,0x10,
-0x07,0x80,0x00,0x01,0x23,0x46,0x8a,0xa0,0x32,0x06,0x90,0xfd,0xb9,0x30,0x04,0xb9,
-0x37,0xd0,0x09,0xb0,0x31,0x33,0x92,0x20,0xeb,0x00,0x04,0xae,0x46,0xf6,0x7f,0x84,
-0x4e,0x00,0x30,0xf1,0x2f,0x50,0x1f,0x03,0x20,0x11,0x88,0x21,0x04,0x60,0x80,0x00,
-0x3f,0xd7,0x78,0xfe,0x03,0x07,0x40,0xb3,0xdf,0x40,0x00,0x72,0x39,0xf5,0x00,0x70,
-0x00,0x02,0x8a,0xef,0xeb,0xff,0xeb,0x91,0x0d,0xc9,0x40,0x00,0x69,0xca,0x4e,0x01,
-0x25,0x02,0xf7,0x55,0x11,0x21,0x03,0xff,0x72,0x07,0x73,0x28,0x8a,0xfc,0x88,0x88,
-0x88,0x20,0x49,0x26,0x02,0x83,0x1b,0x01,0xa9,0x12,0xa0,0x50,0x0a,0xff,0xf7,0x77,
-0x79,0xf5,0x07,0xfa,0xae,0x08,0x31,0x30,0x06,0x0a,0xe0,0x98,0x26,0x01,0x89,0x17,
-0x72,0x50,0x00,0x0a,0xf6,0x66,0x68,0xe5,0xd6,0x06,0xe0,0x90,0x00,0x0e,0xc5,0x55,
-0x55,0xf9,0x00,0x00,0xec,0x44,0x44,0x5f,0x90,0xd8,0x09,0x00,0xd7,0x18,0x00,0x63,
-0x1b,0x22,0x10,0x06,0xaa,0x00,0xd6,0x36,0x7f,0xc6,0x66,0x66,0x66,0x00,0x05,0xfb,
-0x77,0x77,0x74,0x00,0x20,0x20,0x01,0x92,0x11,0x41,0x04,0x66,0xdf,0x10,0xc9,0x06,
-0x1d,0x70,0xa7,0x1b,0x21,0x1e,0x90,0x0c,0x1e,0x01,0x1b,0x03,0xd0,0x5e,0xf6,0xef,
-0x60,0x00,0x03,0xcf,0xe3,0x01,0xcf,0xc5,0x05,0xff,0xbe,0x09,0xe1,0xf5,0x09,0x45,
-0x77,0x77,0x75,0x16,0x00,0x02,0x44,0x44,0x44,0x43,0x00,0x7f,0x24,0x11,0xb0,0x4d,
-0x11,0x10,0xeb,0x56,0x05,0x00,0x98,0x24,0x00,0xe2,0x22,0x00,0x2a,0x23,0x61,0x77,
-0x77,0x7e,0xa0,0x00,0xff,0x61,0x07,0xf1,0x03,0xfb,0x77,0x77,0x77,0x7b,0xf0,0xf8,
-0x68,0x88,0x88,0x67,0xf0,0xf8,0xbe,0xee,0xee,0xb7,0xf0,0xde,0x22,0xb0,0xf0,0xf8,
+0x1a,0x00,0x20,0xee,0x10,0x27,0x00,0x20,0x19,0x40,0x0d,0x00,0x02,0x34,0x00,0xf7,
+0x02,0xd2,0x23,0x57,0x30,0x00,0x00,0xcf,0xff,0xff,0xf5,0x00,0x00,0x00,0x57,0x87,
+0x65,0x10,0x7f,0x01,0xf0,0x17,0x76,0xd0,0x00,0x0b,0xf2,0x00,0x0b,0x9b,0x30,0x00,
+0xaf,0x10,0x00,0x26,0x00,0x00,0x0a,0xf2,0x47,0xbe,0xe3,0x02,0x58,0xef,0xff,0xfe,
+0xff,0x20,0x9f,0xff,0xf8,0x51,0x6f,0x80,0x03,0x52,0xaf,0x10,0xfb,0x00,0x30,0x0a,
+0xf1,0x0a,0x39,0x01,0x32,0xaf,0x10,0x01,0x29,0x02,0x70,0x02,0x30,0x00,0x00,0x7f,
+0xfe,0xef,0xd8,0x01,0xf0,0x15,0x6a,0xbb,0xa9,0x60,0x00,0x07,0x10,0x00,0x00,0x89,
+0x28,0xfa,0x00,0x00,0x0c,0xf2,0x0e,0xf4,0x00,0x00,0xfe,0x00,0x5f,0xd0,0x00,0x5f,
+0x90,0x00,0xc7,0x00,0x0c,0xf4,0x00,0x00,0x00,0x04,0x28,0x00,0x30,0x02,0xef,0x40,
+0x05,0x00,0x10,0x70,0x3c,0x01,0x10,0x90,0x05,0x00,0x10,0x60,0x8a,0x01,0x14,0x10,
+0x2f,0x01,0x10,0x10,0x96,0x00,0xd0,0xb5,0xf1,0x03,0x00,0x00,0x00,0xb9,0xa4,0xaf,
+0x40,0x00,0x00,0xd9,0x44,0x00,0xe0,0x02,0xfc,0x00,0x0c,0xf6,0x00,0x07,0xf7,0x00,
+0x03,0xf9,0x00,0x0c,0xf2,0x61,0x01,0x21,0x4f,0xb0,0x89,0x01,0x00,0xb5,0x01,0x10,
+0x1d,0x9a,0x01,0x30,0x03,0xdf,0xa0,0x23,0x02,0x01,0x22,0x01,0x31,0x2b,0x50,0x00,
+0x4f,0x01,0x10,0x91,0x06,0x00,0x30,0x2f,0xd0,0x00,0x04,0x03,0xf0,0x0b,0xff,0xff,
+0xe5,0x00,0x08,0xfb,0x88,0x8e,0xf5,0x00,0x8f,0xb0,0x00,0x1f,0xe0,0x0b,0xfb,0x2d,
+0x80,0x8f,0x70,0x05,0x90,0x2c,0xfe,0xfd,0x1f,0x00,0xf0,0x03,0x8f,0xfd,0x20,0x00,
+0x00,0x04,0xef,0xdf,0x50,0x00,0x01,0x8f,0xf5,0x04,0x00,0x00,0x8f,0xfc,0x59,0x00,
+0x37,0x1a,0x50,0x00,0x01,0x00,0x40,0x41,0x00,0x44,0xe1,0x01,0x02,0x80,0x08,0xba,
+0x70,0x00,0x0c,0xfb,0x88,0xad,0xbc,0x00,0xf1,0x0c,0xff,0xff,0xf3,0x00,0x06,0xfc,
+0x00,0x03,0xfc,0x00,0x08,0xfd,0x27,0x00,0x9f,0x50,0x03,0xec,0x19,0xfe,0x7f,0xc0,
+0x00,0x01,0x00,0x06,0xff,0xd2,0x01,0xd1,0x2d,0xff,0xf2,0x00,0x00,0x00,0x4e,0xf8,
+0x69,0x00,0x00,0x04,0xbf,0x12,0x00,0x11,0xaf,0x95,0x00,0x06,0x22,0x02,0xf0,0x03,
+0x30,0x00,0x04,0x56,0x79,0xbe,0xf5,0x00,0x0b,0xff,0xff,0xe9,0x62,0x00,0x01,0x21,
+0x1f,0x90,0x04,0x01,0x50,0x1f,0xa0,0x00,0x10,0xef,0x57,0x03,0xa1,0xf1,0x88,0x77,
+0x9f,0xc7,0x78,0x80,0x00,0x00,0x6f,0x23,0x03,0x24,0xdf,0x10,0x4d,0x03,0x21,0x01,
+0xcf,0xd8,0x00,0x12,0x59,0x46,0x00,0xf1,0x07,0x67,0x00,0x21,0x00,0x9c,0x0a,0xf1,
+0x0a,0xf3,0x09,0xf3,0x4f,0x60,0xee,0x00,0x3f,0x90,0x72,0x4f,0x90,0x00,0x50,0x2b,
+0x01,0x31,0x00,0x09,0xf8,0x55,0x02,0x31,0x00,0x00,0x01,0x1e,0x01,0x3a,0x0b,0xd5,
+0x00,0x01,0x00,0xf1,0x11,0x02,0x03,0xe6,0x00,0x07,0x40,0x0e,0xe0,0x0f,0xd0,0x02,
+0xfe,0x00,0x9f,0x50,0xaf,0x30,0x5f,0x80,0x02,0xfb,0x04,0xb3,0x0a,0xf3,0x00,0x0a,
+0x80,0x00,0x01,0xfd,0x00,0xb6,0x00,0x20,0x40,0x00,0x5e,0x01,0x11,0xb0,0x4b,0x01,
+0x70,0xc1,0x00,0x00,0x00,0x18,0xef,0xc0,0x02,0x02,0x02,0x20,0x03,0x26,0x07,0x10,
+0x4d,0x00,0x94,0xff,0xee,0xee,0xfd,0x00,0x01,0x99,0x99,0x99,0x34,0x04,0x61,0x89,
+0x88,0x88,0x88,0x89,0x90,0xcd,0x00,0x51,0xf0,0x00,0x00,0x0e,0xe0,0x8e,0x02,0x01,
+0x49,0x00,0x20,0x7f,0x60,0x14,0x02,0x20,0xfe,0x10,0x80,0x01,0x10,0xf4,0x11,0x00,
+0x2a,0x2a,0x20,0x9a,0x00,0xe4,0x55,0xe1,0x00,0x89,0x99,0x99,0xac,0xbb,0x50,0x0c,
+0xfe,0xee,0xff,0x56,0x62,0x00,0x10,0x88,0x01,0x00,0x20,0x60,0x4f,0x51,0x00,0x10,
+0xfa,0x3b,0x00,0x11,0x40,0x41,0x03,0x01,0x67,0x04,0x03,0xae,0x00,0x25,0xcf,0x60,
+0x11,0x02,0x30,0x00,0x09,0x70,0x06,0x00,0xa0,0x0f,0xf0,0x00,0x00,0x00,0xed,0x00,
+0x00,0x00,0x0e,0x36,0x01,0xf0,0x02,0xee,0x40,0x00,0x00,0x0e,0xff,0xfa,0x40,0x00,
+0xee,0x9e,0xff,0xd1,0x0e,0xd0,0x05,0xde,0x1b,0x00,0x11,0x10,0x1b,0x00,0x63,0xfe,
+0x00,0x00,0x00,0x0d,0xc0,0x6a,0x00,0xf0,0x04,0x00,0x3f,0xc0,0x05,0x4f,0x50,0x1f,
+0xa0,0x0a,0xc7,0xb0,0x1f,0xa0,0x01,0xa1,0x00,0x1f,0xd4,0x00,0x77,0x04,0xc0,0xe9,
+0x30,0x00,0x1f,0xc9,0xff,0xfc,0x00,0x1f,0xa0,0x06,0xda,0xaa,0x01,0x40,0x01,0x00,
+0x1f,0xa0,0x69,0x02,0x00,0xd5,0x00,0x36,0x2c,0x90,0x00,0x75,0x02,0x11,0x1f,0x49,
+0x00,0x00,0x63,0x05,0x72,0x21,0x11,0x2f,0xc1,0x11,0x20,0xdf,0xd2,0x01,0x91,0x88,
+0x9f,0xd8,0x88,0x80,0x00,0x00,0x3f,0x90,0x05,0x01,0x15,0x70,0x62,0x04,0x20,0x0b,
+0xf9,0xb7,0x00,0x21,0xef,0xc0,0x36,0x01,0x01,0x8a,0x05,0x64,0xcb,0xbb,0xbb,0xc6,
+0x00,0xdf,0x87,0x04,0x0e,0x01,0x00,0x60,0x32,0x22,0x22,0x22,0x22,0x2e,0x56,0x00,
+0x20,0xf9,0xaa,0x01,0x00,0x41,0x60,0x00,0x00,0x04,0xa7,0x04,0x01,0x8a,0x05,0xd1,
+0x01,0xa9,0x9b,0xfc,0x9a,0x50,0x00,0x1f,0xfe,0xee,0xef,0xfe,0x00,0x6b,0x01,0x10,
+0x20,0x31,0x05,0x01,0x06,0x00,0xf0,0x0a,0x4c,0xfd,0x26,0x00,0x00,0x26,0xcf,0xff,
+0x76,0xfe,0x50,0x0e,0xfe,0x75,0xf7,0x06,0xff,0x30,0x34,0x00,0x3f,0x70,0x02,0x60,
+0x00,0xc3,0x04,0x10,0x00,0x68,0x05,0x16,0x70,0x67,0x00,0x20,0x05,0xd7,0x8d,0x00,
+0x10,0xf7,0x3f,0x01,0x13,0xf1,0xb9,0x04,0x70,0x01,0xef,0x20,0x00,0x00,0x0a,0xf9,
+0x1b,0x02,0xe0,0xe0,0x00,0x00,0x2b,0xfe,0x20,0x00,0x19,0xff,0xd2,0x00,0x00,0x2e,
+0xf8,0x38,0x01,0x13,0x20,0xca,0x03,0x10,0x40,0x89,0x00,0x90,0xa0,0x9f,0x60,0x00,
+0x00,0x06,0xf7,0x02,0xfd,0x41,0x02,0x70,0x30,0x0b,0xf4,0x00,0x00,0x0e,0xf0,0xbe,
+0x03,0x21,0x04,0xfa,0xf7,0x00,0x51,0xbf,0x40,0x00,0x09,0xf6,0x57,0x05,0x30,0x4f,
+0xc0,0x0c,0x22,0x03,0x30,0xff,0x11,0xac,0x6e,0x00,0x18,0xa2,0x25,0x06,0x11,0x3c,
+0x07,0x00,0xe1,0xaa,0xc7,0x00,0x05,0xd5,0x0a,0xf3,0xa1,0x00,0x00,0x8f,0x50,0x6f,
+0x80,0xf4,0x01,0x90,0xef,0x00,0x00,0x00,0xfd,0x00,0x08,0xf6,0x00,0x66,0x04,0xf0,
+0x03,0x2f,0xc0,0x00,0x0c,0xf3,0x00,0x00,0xdf,0x20,0x03,0xfd,0x00,0x00,0x08,0xf8,
+0x00,0xdf,0x50,0x3f,0x06,0x21,0x4f,0xc0,0x24,0x00,0x15,0x01,0xee,0x04,0x30,0x00,
+0x9c,0x50,0xa5,0x00,0xf0,0x10,0x2a,0x0c,0x00,0x03,0xf9,0x09,0xf5,0x9c,0x50,0x00,
+0x6f,0x70,0x2f,0xc0,0x00,0x00,0x09,0xf3,0x00,0xbf,0x30,0x00,0x00,0xef,0x00,0x05,
+0xfa,0x00,0x00,0x4f,0xa0,0xeb,0x00,0xc1,0x0b,0xf5,0x00,0x00,0xaf,0x60,0x03,0xfe,
+0x00,0x00,0x05,0xfc,0x55,0x02,0x30,0x0f,0xf1,0x2b,0x4e,0x00,0x2b,0xbb,0x20,0x88,
+0x01,0xf0,0x10,0x49,0x70,0xde,0x00,0x00,0x2f,0x6e,0x0d,0xe0,0x00,0x00,0x84,0x00,
+0xce,0x00,0x03,0xaf,0x20,0x0c,0xe4,0x9e,0xff,0xc3,0x00,0xcf,0xff,0xd8,0x20,0x00,
+0x0c,0xf6,0x2f,0x00,0x10,0xce,0x28,0x00,0x21,0x0c,0xe0,0x9f,0x02,0xf5,0x24,0x52,
+0x22,0x35,0x60,0x06,0xff,0xff,0xff,0xfc,0x00,0x03,0x78,0x98,0x86,0x40,0x00,0x22,
+0x00,0x00,0x03,0xc9,0x0d,0xf0,0x00,0x00,0xa2,0xa2,0xde,0x00,0x00,0x09,0xdb,0x0c,
+0xe0,0x01,0x7d,0xf4,0x00,0xcf,0x7c,0xff,0xe9,0x20,0x0c,0xff,0xfa,0x50,0x00,0x00,
+0xcf,0x40,0x3d,0x00,0x02,0x48,0x00,0xf0,0x02,0xf5,0x22,0x23,0x56,0x00,0x6f,0xff,
+0xff,0xff,0xc0,0x00,0x37,0x89,0x88,0x64,0x00,0x3a,0x71,0x03,0x10,0x04,0x09,0x02,
+0x70,0xf6,0x01,0x11,0x11,0x11,0xdf,0x20,0x7e,0x02,0x10,0xd0,0xd1,0x06,0x10,0xf7,
+0xec,0x00,0x23,0xfe,0x00,0x73,0x05,0x60,0x05,0xef,0x80,0x00,0x01,0x7c,0x4f,0x02,
+0x31,0x0a,0xfa,0x20,0xe3,0x02,0x09,0x01,0x00,0x20,0x93,0xe1,0x88,0x02,0x30,0xc9,
+0xb7,0xaf,0x9d,0x00,0x52,0x10,0x7a,0xaa,0xaa,0xab,0x39,0x02,0x11,0xfa,0x4a,0x03,
+0x11,0xf5,0xda,0x02,0x15,0xe0,0x62,0x03,0x20,0x1c,0xfb,0x4f,0x02,0x20,0xef,0xb0,
+0x3e,0x07,0x11,0xf9,0x27,0x08,0x04,0x08,0x04,0x20,0x09,0xc4,0x6b,0x01,0x30,0x3a,
+0x0b,0x8f,0x92,0x00,0x61,0xb7,0x5a,0xaa,0xaa,0xaa,0xff,0x6e,0x00,0x00,0x00,0x08,
+0x00,0xc6,0x05,0x04,0x4a,0x02,0x30,0x00,0xaf,0x80,0xf8,0x02,0x00,0x65,0x08,0x30,
+0x05,0xdf,0xc1,0xfd,0x02,0x20,0xfa,0x10,0xfd,0x02,0x02,0x60,0x01,0x21,0x38,0x10,
+0xca,0x02,0x20,0xfe,0x30,0x27,0x07,0x10,0xfa,0x07,0x00,0x80,0x0c,0xf6,0x05,0xfe,
+0x30,0x00,0x0c,0xfa,0xc5,0x02,0x00,0xe4,0x06,0x30,0x08,0xfe,0x10,0x82,0x06,0x12,
+0x0a,0xa6,0x08,0x21,0x0c,0xf3,0x37,0x00,0x12,0x14,0x84,0x00,0xf0,0x0f,0x82,0x00,
+0x00,0x01,0x40,0x09,0x8b,0xb0,0x00,0x02,0xef,0xb0,0x5f,0x4a,0x00,0x00,0xdf,0xdf,
+0xc0,0x61,0x00,0x00,0xbf,0x70,0x9f,0xc0,0x00,0x00,0xaf,0xb0,0x03,0x00,0xd2,0x4f,
+0xe1,0x00,0x00,0xbf,0xa0,0x00,0x64,0x00,0x00,0x01,0xdf,0x90,0xbd,0x04,0x11,0x30,
+0xef,0x02,0x01,0x6b,0x05,0x90,0x1b,0xb1,0x00,0x00,0x01,0x10,0x07,0x75,0x80,0x3a,
+0x01,0xf1,0x13,0x77,0x58,0x00,0x01,0xdf,0xff,0x81,0xbb,0x10,0x00,0xcf,0x61,0xdf,
+0x80,0x00,0x00,0xaf,0xa0,0x01,0xdf,0x70,0x00,0x7f,0xd0,0x00,0x02,0xef,0x60,0x00,
+0xa3,0x00,0x00,0x03,0xff,0x2b,0x06,0x12,0x06,0xda,0x07,0x26,0x09,0x60,0x10,0x05,
+0x03,0xb3,0x07,0x10,0xa0,0x7e,0x02,0x41,0x01,0xfa,0x00,0x01,0x56,0x08,0xf0,0x18,
+0xff,0xe0,0x05,0x88,0x89,0xfd,0x88,0x88,0x00,0x00,0x30,0x1f,0x90,0x02,0x00,0x00,
+0x5f,0x61,0xf9,0x0d,0xd0,0x00,0x1e,0xd0,0x1f,0x90,0x5f,0x90,0x0d,0xf4,0x01,0xf9,
+0x00,0xbf,0x30,0x66,0x00,0x2f,0x90,0x8f,0x03,0x21,0xff,0xf8,0x34,0x01,0x14,0x88,
+0x5b,0x01,0x10,0x17,0x84,0x01,0x30,0xa0,0xa8,0xd6,0xda,0x07,0xa2,0x05,0xe7,0x90,
+0x11,0x00,0x2f,0x90,0x16,0x10,0x0a,0x82,0x09,0xf1,0x1c,0x68,0x88,0x9f,0xc8,0x88,
+0x80,0x00,0x02,0x01,0xf9,0x00,0x10,0x00,0x05,0xf6,0x1f,0x90,0xdd,0x00,0x01,0xee,
+0x01,0xf9,0x06,0xf8,0x00,0xcf,0x40,0x1f,0x90,0x0c,0xf2,0x07,0x70,0x02,0xf9,0x00,
+0x38,0x00,0x00,0x0e,0xef,0x80,0xe6,0x08,0x13,0x92,0xa3,0x00,0x30,0x02,0xbb,0x20,
+0x2f,0x08,0xa1,0x69,0x97,0x01,0x10,0x02,0xf9,0x01,0x9a,0x10,0xaf,0xad,0x05,0x40,
+0x06,0x88,0x89,0xfc,0xa3,0x00,0x41,0x20,0x1f,0x90,0x11,0xa3,0x00,0xa0,0x0e,0xc0,
+0x00,0x1e,0xe0,0x1f,0x90,0x7f,0x80,0x0c,0xa3,0x00,0xc1,0xdf,0x30,0x77,0x00,0x2f,
+0x90,0x04,0x81,0x00,0x00,0xee,0xf8,0x31,0x0a,0x51,0xa9,0x20,0x00,0x00,0x11,0x66,
+0x03,0x01,0xe8,0x04,0x10,0xc1,0xf9,0x05,0x21,0xdf,0xd0,0x57,0x01,0xa0,0x20,0x00,
+0x22,0x00,0x1d,0xf6,0x00,0x01,0xef,0x51,0x3d,0x01,0x36,0x4f,0xfe,0xf8,0xe9,0x04,
+0x11,0x2e,0x16,0x07,0x21,0x03,0xff,0xc6,0x05,0x14,0x58,0x37,0x01,0x71,0x9f,0xeb,
+0x74,0x00,0x00,0x59,0xcf,0xfd,0x00,0x50,0x37,0xc5,0x00,0x96,0x30,0x64,0x02,0x61,
+0xff,0xc8,0x30,0x00,0x14,0x7b,0x24,0x09,0xf0,0x02,0x04,0x20,0x0b,0xc9,0x52,0x00,
+0x00,0x0c,0xff,0xff,0xe9,0x50,0x00,0x03,0x6a,0xef,0xf3,0x44,0x00,0x15,0x70,0xe2,
+0x03,0x12,0xfe,0x3a,0x02,0x01,0x66,0x06,0x00,0x1d,0x04,0x03,0x3a,0x07,0x00,0xa4,
+0x05,0x00,0x54,0x01,0x50,0x07,0xf6,0x00,0xcf,0x30,0x13,0x00,0xc0,0x03,0xfc,0x00,
+0x00,0x2f,0xb2,0x35,0x7e,0xf4,0x01,0xde,0xff,0x4d,0x03,0x71,0x0f,0xdc,0xa8,0x75,
+0x31,0xcf,0x30,0x92,0x00,0x13,0x30,0x8e,0x08,0x00,0xc3,0x04,0x20,0x00,0x10,0x50,
+0x04,0x20,0x0c,0xd3,0xb1,0x04,0x90,0x8f,0xf7,0x7f,0x90,0x00,0x00,0x3e,0xff,0xf1,
+0x4f,0x00,0x00,0x4c,0x05,0xf1,0x07,0x1c,0xfd,0xfe,0x30,0x00,0x1c,0xfb,0x08,0xff,
+0x40,0x7f,0xfb,0x00,0x08,0xf5,0x6f,0xf7,0x00,0x00,0x03,0x00,0x62,0x0f,0x02,0x60,
+0x77,0x77,0x77,0x77,0x00,0xbf,0xf0,0x01,0x34,0x00,0x01,0xfb,0xf9,0x06,0x62,0x6a,
+0x9a,0xfe,0x99,0x9a,0x99,0xb2,0x01,0x05,0x16,0x00,0x00,0xb5,0x00,0xe2,0x20,0x12,
+0x10,0x00,0x0d,0xff,0xff,0xf7,0x00,0x00,0x17,0xaa,0xa9,0x40,0xcc,0x00,0x21,0x05,
+0xf5,0x21,0x00,0xf0,0x03,0xa2,0x58,0xbd,0x21,0x69,0xff,0xff,0xef,0xe1,0x1f,0xed,
+0xf7,0x15,0xf6,0x00,0x20,0x3f,0x73,0x39,0x00,0x31,0xfb,0x3a,0x10,0xd8,0x0b,0x00,
+0x47,0x06,0x10,0x40,0xb4,0x00,0x11,0xf9,0xba,0x00,0x06,0xc4,0x02,0x01,0xcf,0x06,
+0x00,0xd0,0x09,0x60,0x14,0x8b,0xeb,0x00,0x35,0xbf,0xe3,0x00,0xc0,0x3f,0xff,0xfe,
+0x74,0x1c,0xf3,0x00,0x85,0x1d,0xf0,0x08,0xf8,0x69,0x01,0x20,0x46,0xfc,0x2e,0x00,
+0x33,0xf8,0x05,0x10,0x32,0x04,0x00,0xdd,0x03,0x17,0x10,0x38,0x01,0x10,0x4a,0xd9,
+0x02,0x81,0xba,0xaa,0xab,0x50,0x00,0x0e,0xee,0xee,0xae,0x00,0x01,0x26,0x0c,0x21,
+0x05,0xf6,0x37,0x09,0x80,0x30,0x01,0x99,0x88,0x8d,0xf9,0x91,0x2f,0xce,0x00,0x18,
+0x30,0x4a,0x04,0x00,0x92,0x02,0x71,0xe4,0x00,0x00,0x7b,0xbb,0xbb,0xef,0xda,0x01,
+0x01,0x8a,0x08,0x00,0x5e,0x05,0x01,0x12,0x07,0x11,0xd0,0xa8,0x00,0x11,0xfb,0x60,
+0x01,0x50,0x6f,0x90,0x10,0x1f,0xff,0x01,0x00,0x20,0x10,0xba,0xc3,0x06,0x60,0xb1,
+0x24,0x44,0x44,0x44,0x06,0x28,0x07,0xa0,0x13,0x22,0x22,0x9f,0x10,0x44,0x33,0x3a,
+0xf1,0x1f,0x1d,0x00,0x40,0x33,0x33,0x3a,0xf1,0x72,0x00,0x10,0x19,0x1b,0x00,0xb3,
+0x47,0x77,0x77,0xcf,0x10,0x09,0x98,0x88,0x88,0x89,0x00,0x58,0x08,0x00,0xe6,0x0c,
+0x10,0x00,0x0d,0x01,0xa8,0x05,0xaa,0xaa,0xaa,0xef,0x00,0x8f,0xfe,0xee,0xef,0x16,
+0x00,0x10,0x1b,0x16,0x00,0x33,0x01,0xff,0xee,0x16,0x00,0x13,0x34,0xa6,0x00,0x00,
+0x5a,0x00,0x62,0xa0,0x00,0xaa,0x99,0x99,0xa6,0x10,0x00,0xb5,0x4f,0xfe,0xee,0xee,
+0xff,0x62,0xa9,0x99,0x99,0x9d,0xf6,0xae,0x00,0x20,0x9f,0x70,0xa8,0x04,0xa0,0xc0,
+0x00,0x00,0x28,0xef,0xa0,0x00,0x00,0x1e,0xfe,0x0f,0x00,0x12,0x25,0x2f,0x00,0xf0,
+0x0f,0x11,0x0a,0xf3,0x00,0x0c,0xf1,0xaf,0x20,0x00,0xbf,0x19,0xf2,0x00,0x0b,0xf0,
+0x9f,0x20,0x00,0xbf,0x09,0xf2,0x00,0x0c,0xf0,0xaf,0x30,0x00,0xdf,0x05,0x81,0x90,
+0x06,0x01,0x43,0x06,0x50,0x2c,0xfc,0x00,0x00,0x8f,0x08,0x04,0x10,0x84,0xf8,0x04,
+0x20,0xc0,0x2e,0x6c,0x04,0x31,0xec,0x02,0xf9,0x0d,0x00,0x16,0x2f,0x0d,0x00,0x30,
+0x0f,0xb0,0x2f,0x59,0x07,0xf0,0x0f,0xfa,0x02,0xf9,0x00,0x61,0x00,0x5f,0x70,0x2f,
+0x90,0x5f,0x90,0x0c,0xf2,0x02,0xfa,0x9f,0xd1,0x08,0xfb,0x00,0x2f,0xff,0xd1,0x03,
+0xfe,0x10,0x02,0xff,0x80,0x98,0x02,0x50,0x05,0x20,0x00,0x00,0x2d,0x06,0x03,0x03,
+0x3e,0x02,0x01,0x0b,0x00,0x14,0xfa,0x0b,0x00,0x10,0x29,0x0b,0x00,0xf0,0x06,0x3e,
+0xf1,0x1f,0xa0,0x00,0x7f,0xf5,0x01,0xfa,0x05,0xdf,0xd3,0x00,0x1f,0xee,0xfe,0x80,
+0x00,0x01,0xff,0xd6,0x74,0x01,0x17,0x40,0xaa,0x09,0x00,0x41,0x09,0x70,0x2f,0xd9,
+0x99,0x99,0xaf,0xa1,0xf9,0x41,0x00,0x10,0x1f,0x54,0x0d,0x08,0x0b,0x00,0x10,0xfa,
+0x0b,0x00,0x01,0xdb,0x01,0xf1,0x03,0xa2,0xfd,0x99,0x99,0x9a,0xfa,0x05,0x30,0x00,
+0x00,0x05,0x40,0x79,0x88,0x88,0x88,0x97,0x0b,0x6b,0x06,0x70,0xbf,0x10,0x00,0x00,
+0xcf,0x2b,0xf1,0x5f,0x09,0x73,0xbf,0x10,0x00,0x03,0xfb,0x03,0x40,0x2a,0x0a,0x20,
+0x5f,0xd0,0x27,0x08,0x60,0xe2,0x00,0x00,0x06,0xdf,0xf3,0xba,0x03,0x10,0xa2,0xb3,
+0x03,0x10,0x30,0x05,0x00,0x11,0x90,0x0d,0x02,0x02,0xb0,0x05,0xb1,0xbf,0xe2,0x00,
+0x01,0x70,0x00,0x09,0xc1,0x00,0x0a,0xf1,0xc3,0x02,0x10,0xc0,0x3b,0x05,0x20,0xfe,
+0x20,0x9e,0x0d,0xa2,0xe3,0x00,0x00,0x00,0x7e,0xfc,0x10,0x00,0x17,0xbf,0xea,0x0d,
+0x14,0x92,0x41,0x00,0x02,0x01,0x00,0x61,0x0e,0xfe,0xee,0xee,0xee,0xfa,0x54,0x0a,
+0x12,0xa0,0xef,0x08,0x11,0xff,0xa7,0x00,0x10,0xbb,0x01,0x00,0x52,0xb8,0x00,0x00,
+0x09,0xf0,0x46,0x04,0x02,0x8d,0x06,0x09,0x0d,0x00,0x01,0x60,0x03,0x5f,0x00,0x9f,
+0x88,0x88,0x40,0x27,0x00,0x03,0x10,0xaf,0xd7,0x03,0x01,0x4e,0x00,0x11,0xa1,0x69,
+0x0a,0x13,0x85,0x83,0x08,0x01,0x13,0x00,0x51,0xf7,0x08,0x88,0x8b,0xfa,0x3b,0x00,
+0x21,0x6f,0x40,0xe1,0x03,0x21,0xfb,0x30,0xca,0x0d,0x20,0xff,0xb2,0x0d,0x00,0x40,
+0xf5,0xaf,0xf7,0x00,0x1a,0x00,0x10,0x4e,0xf1,0x08,0x01,0xd1,0x0a,0x04,0x27,0x00,
+0x08,0x0d,0x00,0x06,0x4e,0x00,0x83,0xf2,0x18,0x88,0x89,0xff,0x88,0x88,0x10,0x07,
+0x07,0x40,0x00,0x7f,0xf7,0x80,0x06,0x00,0xf0,0x08,0xff,0xcf,0xd2,0x00,0x01,0xaf,
+0xc6,0xf5,0x5f,0xf5,0x04,0xff,0xa0,0x5f,0x50,0x3e,0xf5,0x0a,0x40,0x05,0xf5,0x00,
+0x29,0x57,0x01,0x16,0x50,0x13,0x04,0x50,0x00,0x5f,0x50,0x00,0x00,0x11,0x00,0x01,
+0x00,0x20,0x01,0xff,0x01,0x00,0xf0,0x00,0xf7,0x07,0x77,0x79,0xf8,0x77,0x77,0x30,
+0x36,0x66,0x8f,0x86,0x66,0x40,0x09,0x13,0x00,0xf0,0x31,0xfa,0x00,0x9d,0x00,0x4f,
+0x30,0x0d,0xa0,0x09,0xd6,0xd4,0xf2,0xc5,0xda,0x00,0x9d,0x6d,0x4f,0x2e,0x6d,0xa0,
+0x09,0xd6,0xe8,0xf8,0xf6,0xda,0x00,0x9d,0x6f,0xff,0xff,0x6d,0xa0,0x09,0xd0,0x00,
+0x00,0x35,0xea,0x00,0x9d,0x00,0x00,0x04,0xfe,0x40,0x00,0x00,0x8f,0x10,0x00,0x00,
+0x00,0x08,0xf1,0x00,0x00,0x89,0x99,0xdf,0x99,0x99,0x3e,0x44,0x00,0xf3,0x03,0xf6,
+0xea,0x00,0x8f,0x10,0x3f,0x6e,0xa0,0x08,0xf1,0x03,0xf6,0xed,0x77,0xcf,0x87,0x9f,
+0x6e,0x16,0x00,0x41,0x9f,0x10,0x3e,0x60,0x2c,0x00,0x07,0x37,0x00,0xf0,0x06,0x00,
+0x23,0x45,0x67,0x9c,0xc0,0x00,0x6f,0xff,0xff,0xec,0xa7,0x20,0x02,0x66,0x57,0xf7,
+0x33,0x32,0x00,0x7f,0x30,0x00,0x73,0xb0,0x01,0x3f,0x85,0xf6,0x7f,0x52,0xaa,0x00,
+0x80,0x02,0x3f,0x86,0xf7,0x7f,0x52,0x10,0x9f,0x0d,0x00,0xf1,0x0c,0xf0,0x03,0x55,
+0xdf,0xff,0xe6,0x55,0x00,0x03,0xcf,0xbf,0xbf,0xe6,0x00,0x1c,0xfe,0x43,0xf5,0x3e,
+0xff,0x60,0xa7,0x00,0x3f,0x50,0x06,0xb1,0xdc,0x00,0x11,0x00,0x26,0x00,0xf0,0x02,
+0x90,0x47,0x77,0x77,0x7b,0xff,0x40,0x00,0x00,0x00,0x7f,0xe3,0x00,0x00,0x00,0x0c,
+0xfa,0x72,0x00,0x30,0x1f,0x90,0x00,0x06,0x00,0x1f,0x80,0x06,0x00,0x02,0xaa,0x58,
+0x9f,0x70,0x00,0x00,0x00,0x5f,0xfc,0x20,0x00,0x01,0x00,0xf5,0x3e,0x01,0xe5,0x00,
+0x0f,0x60,0x00,0x00,0x8f,0x29,0x60,0xf6,0x00,0x00,0x1f,0xa0,0xe9,0x0f,0x9a,0xf2,
+0x0b,0xf7,0x0e,0xb8,0xff,0xff,0x27,0xff,0x74,0xff,0xff,0x84,0xf2,0x5e,0xfb,0xff,
+0xc2,0xf6,0x4f,0x20,0x3f,0x74,0xe9,0x0f,0x66,0xf1,0x01,0xf7,0x0e,0x90,0xfb,0xfe,
+0x00,0x1f,0x70,0xe9,0x0f,0x74,0x20,0x01,0xf7,0x0e,0xa0,0x00,0x0c,0x80,0x1f,0x70,
+0xce,0x98,0x8a,0xf7,0x01,0xf7,0x03,0xbd,0xdd,0xc9,0x56,0x00,0xe0,0xd8,0x00,0x00,
+0x9f,0x00,0x00,0x5f,0x70,0x00,0x09,0xf0,0x00,0x0d,0xf1,0x0d,0x00,0xf0,0x16,0x07,
+0xfa,0x8f,0xff,0xff,0xff,0x74,0xff,0xa4,0x88,0x88,0xcf,0x83,0x8f,0xfa,0x03,0x50,
+0x09,0xf0,0x00,0x5e,0xa0,0xaf,0x20,0x9f,0x00,0x00,0xea,0x01,0xfb,0x09,0xf0,0x00,
+0x0e,0xa0,0x08,0x90,0x0d,0x00,0x21,0x00,0x00,0x0d,0x00,0x30,0x03,0x77,0xdf,0x0d,
+0x00,0x3a,0x1f,0xfe,0x70,0xb0,0x00,0xf0,0x2e,0x02,0xe5,0x32,0x7f,0x10,0x00,0x00,
+0x9f,0x2d,0xb7,0xf1,0x00,0x00,0x1f,0xb1,0xfc,0xbf,0x87,0x60,0x0a,0xf6,0x7f,0xff,
+0xff,0xfc,0x06,0xff,0x5d,0xc0,0x7f,0x10,0x00,0x7f,0xf5,0x64,0x07,0xf1,0x00,0x00,
+0x5f,0x58,0x88,0xcf,0x98,0x83,0x01,0xf5,0xdf,0xff,0xff,0xff,0x60,0x1f,0x50,0x00,
+0x7f,0x10,0x00,0x01,0xf5,0x00,0x1a,0x00,0x09,0x0d,0x00,0xf0,0x07,0x00,0x0b,0x50,
+0x00,0x15,0xa1,0x00,0x05,0xfa,0x9b,0xef,0xfe,0x70,0x00,0xde,0x7d,0xbd,0xf2,0x00,
+0x00,0x8f,0xa0,0xbc,0x00,0x20,0x6f,0xf9,0x88,0x00,0x90,0x0a,0xff,0xa8,0x88,0xdf,
+0x88,0x81,0x24,0xea,0x75,0x01,0x30,0x30,0x0e,0x90,0x1a,0x00,0x20,0x00,0xe9,0x1a,
+0x00,0x14,0x00,0x0d,0x00,0x00,0x90,0x01,0x61,0x10,0x0e,0x95,0x88,0x88,0x88,0x6d,
+0x01,0x11,0x20,0xfe,0x00,0xf0,0x1a,0xae,0x00,0x00,0x00,0x6f,0x40,0x06,0xe2,0x00,
+0x00,0x0d,0xd4,0xff,0xff,0xff,0xe0,0x09,0xf9,0x28,0x88,0x88,0x88,0x05,0xff,0x90,
+0x5e,0x00,0x3f,0x50,0x3e,0xf9,0x04,0xf2,0x06,0xf3,0x00,0x1e,0x90,0x2f,0x60,0x8f,
+0x4e,0x00,0x90,0xf8,0x0b,0xc0,0x00,0x0e,0x90,0x0e,0xa0,0xe8,0x0d,0x00,0x60,0x74,
+0x1f,0x50,0x00,0x0e,0x9b,0x53,0x02,0x74,0x00,0xe9,0x68,0x88,0x88,0x88,0x30,0xa8,
+0x01,0xf3,0x3e,0xd4,0x00,0x15,0x9e,0x70,0x00,0x7f,0x4c,0xff,0xff,0xb6,0x00,0x0e,
+0xb3,0xf9,0x59,0xf0,0x00,0x08,0xf8,0x3f,0x30,0x7f,0x00,0x03,0xff,0x83,0xf6,0x38,
+0xf3,0x31,0x8f,0xf8,0x3f,0xff,0xff,0xff,0x61,0x5f,0x83,0xf6,0x36,0xf6,0x31,0x00,
+0xf8,0x3f,0x30,0x1f,0x60,0x00,0x0f,0x83,0xf3,0x01,0xe9,0x20,0x00,0xf8,0x3f,0x38,
+0xca,0xd8,0x90,0x0f,0x86,0xff,0xaf,0x8f,0xf6,0x00,0xf8,0x7c,0x72,0x84,0x8c,0x10,
+0x55,0x00,0x30,0x3c,0x30,0x06,0x05,0x01,0x20,0xaf,0x10,0x07,0x00,0x81,0x01,0xf9,
+0x78,0x8b,0xf8,0x88,0x50,0x0b,0x34,0x01,0xf0,0x1f,0xa0,0x6f,0xf5,0x00,0x7f,0xff,
+0x20,0x00,0x8f,0xf5,0x00,0xee,0xfe,0x90,0x00,0x15,0xf5,0x07,0xf7,0xf6,0xf2,0x00,
+0x02,0xf5,0x2f,0x86,0xf1,0xdb,0x00,0x02,0xf7,0xef,0x8a,0xf7,0xaf,0x90,0x02,0xf8,
+0xe5,0xff,0xff,0xca,0x80,0x02,0xf5,0x00,0x3f,0x00,0x00,0x07,0x00,0x16,0xe1,0xa8,
+0x01,0x30,0xd7,0x07,0xb0,0x9e,0x02,0xf0,0x23,0x40,0xec,0x00,0x00,0x00,0x0e,0xd0,
+0x5f,0xff,0xff,0xf9,0x09,0xf8,0x1e,0xdd,0xf8,0x88,0x56,0xff,0x8b,0xf3,0xae,0x00,
+0x00,0x5e,0xf8,0x89,0x0a,0xff,0xff,0x40,0x3f,0x80,0x00,0xaf,0x55,0x51,0x00,0xf8,
+0x00,0x0a,0xe2,0x22,0x10,0x0f,0x80,0x00,0xaf,0xff,0xf7,0x0d,0x00,0x50,0xf3,0x33,
+0x10,0x0f,0x80,0x45,0x01,0x00,0x0d,0x00,0x16,0xe0,0x55,0x00,0x20,0xe8,0x00,0xfc,
+0x01,0x10,0x7f,0xa1,0x00,0xf1,0x0d,0x80,0x0e,0xb4,0x77,0xbf,0x77,0x74,0x0a,0xf8,
+0x14,0x49,0xf5,0x44,0x17,0xff,0x86,0xff,0xff,0xff,0xf3,0x7c,0xf8,0x6f,0x07,0xf1,
+0x4f,0x30,0x0e,0x0d,0x00,0xb0,0x00,0xe8,0x3b,0x5c,0xe4,0x44,0x10,0x0e,0x80,0xdb,
+0xe9,0x3a,0x00,0xf1,0x06,0x02,0xff,0x91,0x00,0x00,0x0e,0x98,0xef,0xbf,0xfc,0x94,
+0x00,0xe8,0x9a,0x30,0x17,0xad,0x30,0x00,0x05,0x20,0x51,0x02,0x10,0xf8,0xa1,0x01,
+0xf0,0x07,0x00,0x9f,0x1f,0xa5,0x55,0xce,0x00,0x1f,0xb0,0xf7,0x00,0x09,0xe0,0x0c,
+0xf8,0x0f,0xa5,0x55,0xce,0x07,0xff,0x80,0x1a,0x00,0x21,0x6c,0xf8,0x2a,0x02,0xfb,
+0x17,0x1e,0x8c,0xff,0xff,0xff,0xf8,0x00,0xe8,0x67,0xbf,0xff,0x87,0x40,0x0e,0x80,
+0x2f,0xff,0xfc,0x00,0x00,0xe8,0x4e,0xd8,0xf5,0xfc,0x10,0x0e,0xaf,0xd1,0x7f,0x16,
+0xfa,0x00,0xe8,0x30,0x07,0xf1,0x03,0xac,0x02,0x40,0xd3,0x00,0xb7,0x00,0xfd,0x02,
+0x60,0x08,0xd0,0x00,0x00,0x1f,0x9e,0x96,0x00,0xf1,0x06,0x0a,0xf7,0x34,0x44,0x44,
+0x44,0x05,0xff,0x70,0xff,0xff,0xff,0x40,0x5c,0xf7,0x05,0x55,0x55,0x51,0x00,0x1e,
+0x0d,0x00,0xf2,0x11,0x00,0xe7,0x04,0x44,0x44,0x41,0x00,0x0e,0x73,0xff,0xff,0xff,
+0x70,0x00,0xe7,0x3f,0x10,0x00,0xe7,0x00,0x0e,0x73,0xf6,0x44,0x4e,0x70,0x00,0xe7,
+0x3e,0xee,0xee,0xe6,0xfe,0x03,0xf0,0x51,0x00,0x00,0x07,0xe1,0x02,0xf6,0x00,0x00,
+0x00,0xdb,0x00,0xaf,0xfe,0xed,0x00,0x3f,0x60,0x6f,0xe5,0x6f,0x90,0x0c,0xf3,0x5d,
+0xbe,0xac,0xe1,0x06,0xff,0x4f,0x31,0x9f,0xf8,0x10,0x8f,0xf4,0xfc,0xfe,0x89,0xff,
+0x61,0x7f,0x4f,0x74,0x3b,0xa0,0x60,0x04,0xf4,0xf3,0xae,0x84,0xa1,0x00,0x4f,0x4f,
+0x22,0x6b,0xe4,0x30,0x04,0xf4,0xf2,0x9c,0x64,0xce,0x20,0x4f,0x30,0x16,0x9d,0xfa,
+0x10,0x04,0xf3,0x02,0xea,0x51,0x00,0x00,0x00,0x0a,0x30,0x08,0xb0,0x00,0x00,0x07,
+0xf6,0x66,0xbf,0x76,0x60,0x00,0xec,0x6f,0xcd,0x02,0xf0,0x00,0xaf,0x60,0x6d,0x00,
+0x7e,0x00,0x6f,0xf5,0x03,0xf2,0x0d,0xa0,0x06,0xef,0x5e,0xf8,0x00,0xf0,0x0a,0x03,
+0xf5,0x44,0x44,0x44,0x44,0x20,0x2f,0x50,0xef,0xff,0xff,0x70,0x02,0xf5,0x0e,0xb6,
+0x67,0xf7,0x00,0x2f,0x50,0xe8,0x00,0x0f,0x0d,0x00,0x20,0xc7,0x77,0x0d,0x00,0x45,
+0xef,0xee,0xef,0x70,0xa4,0x03,0xf1,0x17,0x00,0x0d,0xa0,0x00,0x00,0x9f,0x4d,0xdd,
+0xff,0xdd,0x60,0x2f,0x91,0x66,0x6f,0xa6,0x62,0x0c,0xf5,0x13,0x4e,0xff,0xed,0x09,
+0xff,0x57,0xe4,0xf5,0x3a,0xe0,0x7d,0xf5,0x7e,0x4f,0xff,0xfe,0x01,0x4f,0x0d,0x00,
+0x11,0x02,0x0d,0x00,0x60,0x00,0x2f,0x57,0xe4,0xf8,0x7c,0x0d,0x00,0xf3,0x02,0x27,
+0x77,0x77,0x00,0x2f,0x57,0xfe,0xee,0xee,0xe8,0x02,0xf5,0x36,0x66,0x66,0x66,0x30,
+0x56,0x03,0x21,0x01,0xf6,0xfd,0x01,0xf0,0x06,0x8f,0x8e,0xee,0xfe,0xed,0x00,0x1f,
+0xa7,0xf5,0x55,0x5b,0xe0,0x0a,0xf6,0x7f,0x55,0x55,0xbe,0x06,0xff,0x67,0xa8,0x01,
+0xf0,0x08,0x8f,0xf6,0x8f,0x55,0x55,0x55,0x01,0x4f,0x69,0xef,0xff,0xff,0xf1,0x01,
+0xf6,0xac,0xf4,0xd8,0x5f,0x10,0x1f,0x6d,0xaf,0x0d,0x00,0xf5,0x03,0xf7,0xf7,0xf7,
+0xea,0x7f,0x10,0x1f,0xcf,0x3f,0x4d,0x88,0xf1,0x01,0xf9,0x91,0xf4,0xd8,0xcb,0xa2,
+0x01,0x80,0xc2,0x00,0xbc,0x00,0x00,0x00,0x9e,0xef,0xdf,0x03,0xf0,0x0c,0x1f,0x84,
+0x88,0x88,0x88,0x50,0x0c,0xf3,0x1f,0xb9,0x9a,0xf4,0x07,0xff,0x31,0xfd,0xbb,0xcf,
+0x40,0x4d,0xf3,0x36,0x66,0x66,0x63,0x00,0x4f,0x18,0x01,0xf1,0x0f,0xf4,0x02,0xf6,
+0xf5,0x44,0x44,0x5f,0x40,0x2f,0x45,0xef,0xff,0xff,0x51,0x02,0xf3,0x01,0x1b,0xe1,
+0x10,0x00,0x2f,0x30,0x26,0xce,0x00,0x00,0x02,0xf3,0x02,0xa8,0x04,0x11,0x22,0x55,
+0x00,0xf0,0x22,0x0b,0xde,0xff,0xf0,0x02,0xf3,0x01,0xf7,0xe7,0x7f,0x3a,0x3f,0x30,
+0x8f,0x3e,0xbb,0xf4,0xf3,0xf3,0x2f,0xf3,0xec,0xcf,0x4f,0x3f,0x3a,0xff,0x3e,0x66,
+0xf4,0xf3,0xf3,0x6c,0xf3,0xef,0xff,0x4f,0x3f,0x30,0x4f,0x3e,0x77,0xf4,0xf3,0xf3,
+0x04,0xf3,0xeb,0xbf,0x0d,0x00,0x30,0x3c,0xcc,0xd4,0x0d,0x00,0xf4,0x02,0x8b,0x7c,
+0x00,0x3f,0x30,0x4f,0x6f,0x63,0xf4,0x59,0xf2,0x04,0xf7,0x90,0x06,0x17,0xfa,0xaa,
+0x00,0x90,0x07,0xd0,0x0f,0x70,0xf8,0x00,0x00,0xdc,0xcf,0xa2,0x01,0xf0,0x23,0x4f,
+0x56,0x7f,0xb7,0xfb,0x70,0x0d,0xf6,0xcc,0xfe,0xcf,0xec,0x58,0xff,0x59,0xfd,0x88,
+0x88,0x83,0x6e,0xf5,0xcf,0xed,0xdd,0xdd,0x00,0x5f,0xdf,0xf8,0x9f,0x6a,0xf0,0x04,
+0xf5,0x8f,0xff,0xfe,0xff,0x00,0x4f,0x33,0xf7,0x8f,0x5a,0xf0,0x04,0xf3,0x3f,0xff,
+0xff,0x0d,0x00,0x30,0xf5,0x6f,0x4a,0x0d,0x00,0x80,0x35,0xf5,0xe9,0x00,0x00,0x1b,
+0x32,0xc4,0xa4,0x06,0xe0,0xf2,0xcf,0xff,0xf3,0x00,0x00,0xfb,0xbf,0x65,0xed,0x22,
+0x00,0x9f,0xbf,0x47,0x01,0x90,0x5f,0xf4,0x7f,0x28,0xe2,0x9e,0x08,0xff,0x45,0x0d,
+0x00,0xf5,0x17,0x16,0xf4,0x3a,0xff,0x30,0x68,0x00,0x2f,0x5b,0x98,0xfe,0xcf,0x80,
+0x02,0xf5,0x8e,0xb8,0xf9,0xf6,0x00,0x2f,0x45,0x7b,0xee,0x88,0xe3,0x02,0xf6,0xdf,
+0xb6,0xf7,0x0c,0x80,0x2f,0x44,0x13,0xfd,0x10,0xf0,0x02,0x81,0x11,0x11,0x11,0x11,
+0x10,0x00,0x0e,0xff,0xcf,0x02,0x53,0x56,0x66,0x66,0x66,0x61,0x19,0x00,0x20,0x08,
+0x88,0x01,0x00,0x12,0x41,0xee,0x06,0x31,0x00,0x03,0xf7,0x1c,0x07,0x20,0x5f,0x40,
+0x28,0x07,0xfb,0x0b,0x0a,0xf1,0x08,0xf1,0x05,0x20,0x05,0xfa,0x00,0x8f,0x10,0xbb,
+0x08,0xfd,0x10,0x07,0xf8,0x7f,0x81,0xda,0x10,0x00,0x2d,0xff,0xd2,0x00,0x01,0x00,
+0x11,0x7f,0xae,0x03,0x51,0x03,0xf8,0x00,0x00,0x02,0x48,0x00,0xf0,0x12,0xf2,0x17,
+0x7a,0xfd,0x77,0xa9,0x77,0x10,0x01,0xee,0x10,0x1e,0xe2,0x00,0x02,0xdf,0x85,0x67,
+0xbf,0xe1,0x00,0x5f,0xff,0xff,0xff,0xef,0xc0,0x00,0x11,0xfb,0x0d,0xd0,0x53,0x80,
+0x06,0xf3,0x08,0xdd,0x00,0x40,0x00,0x2d,0xf2,0x0d,0xd0,0x0e,0x91,0x8e,0xf7,0x00,
+0xcf,0x77,0xf7,0x1e,0xd5,0x00,0x06,0xef,0xfd,0x10,0xb3,0x00,0xe1,0x1b,0x41,0xf7,
+0x00,0x00,0x00,0x05,0xf8,0x5f,0x93,0x33,0x10,0x00,0xbf,0x9c,0x00,0x90,0x3f,0x93,
+0x4f,0x93,0x33,0x10,0x05,0xd0,0x01,0x1a,0x00,0x91,0x88,0x88,0x9f,0xc8,0x88,0x84,
+0x1f,0xff,0xff,0x93,0x03,0x20,0x1f,0x80,0x80,0x02,0x30,0x06,0xf4,0x07,0xed,0x04,
+0xf4,0x04,0xee,0x00,0x7f,0x10,0xd6,0x07,0xef,0x40,0x07,0xf8,0x7f,0x60,0xdd,0x40,
+0x00,0x2d,0xff,0xd1,0x01,0xa9,0x00,0x11,0xa2,0x06,0x00,0x21,0x3f,0xe2,0x07,0x00,
+0x21,0x5f,0xd0,0x07,0x00,0x11,0x9f,0x1b,0x03,0x30,0x0c,0xff,0x10,0xc5,0x03,0x21,
+0xfd,0xfa,0x25,0x08,0x20,0x69,0xf4,0x9c,0x07,0xf0,0x0a,0xe0,0x1e,0xe0,0x00,0x00,
+0x0c,0xf5,0x00,0x7f,0xa0,0x00,0x1b,0xfa,0x00,0x00,0xcf,0xa0,0x3e,0xfb,0x00,0x00,
+0x01,0xdf,0x70,0x98,0x2a,0x00,0x1c,0xb1,0x05,0x01,0x20,0x4e,0x50,0x06,0x00,0x30,
+0x3e,0xfe,0x30,0x5b,0x00,0xf0,0x0c,0xc3,0xdf,0x50,0x00,0x03,0xcf,0xa0,0x01,0xcf,
+0xa2,0x06,0xff,0xc5,0x55,0x55,0xdf,0xf7,0x1a,0xaf,0xff,0xff,0xff,0xab,0x20,0x00,
+0x00,0x5f,0x27,0x00,0x71,0x16,0x69,0xf9,0x66,0x20,0x00,0x04,0x4b,0x06,0x30,0x00,
+0x00,0x04,0x6e,0x00,0x71,0x66,0x66,0x9f,0x96,0x66,0x60,0x0f,0xd1,0x00,0xf1,0x1c,
+0x00,0x00,0x03,0x82,0x02,0x93,0x00,0x00,0x00,0xcf,0x20,0x2f,0xc0,0x00,0x00,0x4f,
+0xa0,0x00,0x8f,0x70,0x00,0x2e,0xf2,0x00,0x00,0xdf,0x50,0x1d,0xf5,0x0a,0xc2,0x02,
+0xef,0x41,0xc8,0x03,0xfd,0x00,0x04,0xd1,0x00,0x00,0xcf,0x83,0x03,0xf4,0x10,0x6f,
+0x90,0x1d,0xa0,0x00,0x00,0x3f,0xc0,0x00,0x9f,0x60,0x00,0x3e,0xfa,0x9a,0xbd,0xff,
+0x10,0x05,0xff,0xff,0xed,0xcb,0xfa,0x00,0x05,0x31,0x00,0x00,0x0b,0xa0,0xa2,0x00,
+0x40,0x06,0xf3,0x00,0xcd,0x2e,0x00,0xd1,0x30,0x0c,0xd0,0x00,0x06,0x8b,0xf9,0x88,
+0xee,0x88,0x20,0xbf,0xff,0x90,0x05,0x08,0x1a,0x00,0x82,0x18,0x8b,0xfa,0x88,0xee,
+0x88,0x52,0xff,0x96,0x09,0xf0,0x00,0x01,0x50,0x00,0x43,0x00,0x00,0x01,0xcf,0x60,
+0x1d,0xf7,0x00,0x05,0xef,0x60,0x09,0x01,0x64,0x9d,0x30,0x00,0x00,0x0a,0xd3,0x55,
+0x00,0x10,0x5f,0x19,0x09,0x65,0x00,0x05,0xf6,0x33,0x33,0xcf,0x0d,0x00,0x30,0xf7,
+0x44,0x44,0x0d,0x00,0x3c,0xee,0xee,0xef,0x1a,0x00,0x61,0xf5,0x22,0x22,0xbf,0x00,
+0x2f,0x5c,0x00,0xf5,0x05,0xa0,0x55,0xbf,0x75,0x5d,0xe7,0x53,0x05,0xcf,0xc2,0x00,
+0x7e,0xfa,0x20,0xcc,0x50,0x00,0x00,0x08,0xe4,0x4d,0x01,0x22,0x6f,0x30,0xb0,0x00,
+0x20,0x00,0xef,0x2b,0x00,0xf0,0x14,0x9e,0xd8,0x8c,0xfa,0x88,0xf9,0xe9,0x00,0x8f,
+0x10,0x0e,0x9e,0x90,0x0d,0xf7,0x00,0xe9,0xe9,0x05,0xfd,0xf8,0x0e,0x9e,0x94,0xfd,
+0x09,0xf6,0xe9,0xec,0xfc,0x10,0x0b,0xae,0x9e,0x93,0xef,0x07,0xb2,0xe9,0x00,0x00,
+0x07,0x8f,0x8e,0x90,0x00,0x00,0xbf,0xc2,0x46,0x00,0x11,0xef,0xb6,0x09,0xb3,0xec,
+0x77,0xbf,0x87,0x7c,0xf0,0xe9,0x00,0x7f,0x10,0x08,0x06,0x00,0x02,0x12,0x00,0x02,
+0x1e,0x00,0x10,0xea,0x04,0x03,0x2a,0xf0,0xe9,0x06,0x00,0x20,0x05,0x8d,0x06,0x00,
+0x40,0x06,0xfe,0x70,0x4f,0x24,0x00,0x80,0xfd,0x01,0x66,0x66,0xbf,0x66,0x66,0x50,
+0x1d,0x00,0x40,0x00,0x00,0x00,0x4f,0x13,0x00,0xf1,0x0d,0x00,0x04,0xf7,0x5b,0xf5,
+0x5c,0xd0,0x00,0x4f,0x86,0xbf,0x66,0xcd,0x00,0x04,0xfe,0xef,0xfe,0xef,0xd0,0x03,
+0x7f,0x64,0xaf,0x44,0xce,0x41,0xcf,0xdf,0x00,0xf0,0x04,0x52,0x6f,0x52,0x22,0x22,
+0xbe,0x20,0x04,0xf3,0x00,0x04,0x6d,0xd0,0x00,0x4f,0x30,0x00,0x6f,0xe6,0x6d,0x02,
+0xf0,0x0a,0x10,0x00,0x02,0xc4,0x09,0xf1,0x07,0xc0,0x3f,0x50,0x9f,0x10,0x9f,0x13,
+0xf5,0x09,0xf1,0x09,0xf1,0x3f,0xb8,0xdf,0x98,0xdf,0x13,0x34,0x00,0xf1,0x08,0xf1,
+0x98,0x00,0x9f,0x10,0x1a,0x6e,0xd0,0x09,0xf1,0x01,0xf9,0xed,0x00,0x9f,0x10,0x1f,
+0x9e,0xd3,0x3b,0xf4,0x35,0xf9,0xa9,0x00,0x66,0x94,0x44,0x44,0x44,0x46,0xf9,0x6d,
+0x02,0xf0,0x0f,0x4e,0x40,0x00,0x00,0x0d,0xf2,0x00,0xee,0x00,0x00,0x06,0xf9,0x00,
+0x05,0xfa,0x00,0x04,0xfe,0x10,0x00,0x0a,0xf8,0x04,0xff,0xb7,0x77,0x77,0x8f,0xf5,
+0x0b,0x84,0x00,0x60,0xca,0x00,0x00,0x08,0xf3,0x01,0x33,0x00,0x11,0xbf,0x68,0x0a,
+0x50,0x2f,0x90,0x02,0xf7,0x00,0x47,0x02,0xb0,0x4f,0x60,0x00,0x8f,0xf5,0x05,0x8c,
+0xf3,0x00,0x0b,0xc3,0x4c,0x09,0x0a,0x01,0x00,0xf0,0x3e,0x0c,0x90,0x02,0x22,0x22,
+0x20,0x00,0x6e,0x16,0xff,0xff,0xff,0x14,0xff,0xfe,0x55,0xdd,0x5a,0xf0,0x26,0x6d,
+0xe0,0x0d,0xb0,0x7f,0x00,0x03,0xf7,0x20,0xea,0x07,0xf0,0x01,0xdf,0x9d,0x0f,0x80,
+0x8f,0x01,0xdf,0xff,0x23,0xf5,0x08,0xf0,0x7f,0xef,0xea,0x6f,0x20,0x9e,0x00,0x4a,
+0xe3,0x4d,0xd0,0x0a,0xd0,0x00,0xae,0x05,0xf7,0x00,0xcc,0x00,0x0a,0xe3,0xfd,0x18,
+0x9f,0x90,0x00,0xae,0x0a,0x20,0xbd,0xb1,0x71,0x04,0xfa,0x36,0x60,0x00,0x8f,0x0e,
+0xa5,0x6f,0x63,0x50,0x8f,0x0e,0x70,0x1f,0x69,0xe0,0x8f,0x0e,0xda,0xbf,0x69,0xe0,
+0x8f,0x0c,0xff,0xdd,0x59,0xe0,0x8f,0x00,0xbd,0x00,0x09,0xe0,0x8f,0x00,0xdf,0xff,
+0x89,0xe0,0x8f,0x00,0xfb,0x7f,0x79,0xe0,0x8f,0x03,0xf4,0x0f,0x68,0xe0,0x8f,0x0a,
+0xf0,0x1f,0x50,0x00,0x8f,0x5f,0x84,0x8f,0x30,0x68,0xde,0x3b,0x0c,0xfa,0x00,0x7f,
+0xe7,0xa4,0x00,0xf0,0x02,0x4a,0xf3,0x00,0x08,0xf0,0x4c,0xff,0xfb,0x41,0x41,0x8f,
+0x02,0xa7,0xfa,0x00,0x4f,0x48,0x96,0x0a,0xf0,0x21,0x04,0xf4,0x8f,0x05,0xff,0xff,
+0xff,0x4f,0x48,0xf0,0x26,0x9f,0xc6,0x64,0xf4,0x8f,0x00,0x0c,0xff,0x60,0x4f,0x48,
+0xf0,0x06,0xff,0xef,0x84,0xf4,0x8f,0x03,0xf8,0xea,0x86,0x4f,0x48,0xf0,0x6d,0x0e,
+0xa0,0x00,0x00,0x8f,0x00,0x10,0xea,0x00,0x06,0x9d,0x34,0x00,0x02,0x5a,0x00,0x01,
+0x73,0x04,0x00,0xd3,0x08,0xf3,0x3a,0x01,0xf7,0x14,0x49,0xf7,0x44,0x36,0x1f,0x75,
+0xff,0xff,0xff,0xe7,0xf2,0xf7,0x01,0xaf,0x44,0x51,0x7f,0x2f,0x70,0x7f,0x83,0xcc,
+0x07,0xf2,0xf7,0x0f,0xff,0xff,0x30,0x7f,0x2f,0x70,0x43,0xaf,0x6c,0x97,0xf2,0xf7,
+0x01,0xbf,0x79,0xf4,0x7f,0x2f,0x71,0xee,0x59,0xf8,0x07,0xe2,0xf7,0x03,0x4c,0xff,
+0xa1,0x00,0x1f,0x72,0xaf,0xd3,0x3e,0xd1,0x78,0xf6,0x0d,0x70,0x00,0x23,0x0e,0xfc,
+0xc5,0x04,0xf7,0x15,0x28,0x0f,0x85,0xa0,0x00,0x7f,0x03,0xf2,0xf8,0xad,0x39,0x07,
+0xf0,0x0e,0x8f,0x8f,0x76,0xf1,0x7f,0x00,0xa7,0xfb,0x95,0x6f,0x17,0xf0,0x0f,0xff,
+0xff,0x96,0xf1,0x7f,0x00,0xf9,0x33,0xf9,0x0d,0x00,0x22,0x22,0xe9,0x0d,0x00,0x21,
+0x95,0xc1,0x1a,0x00,0xf1,0x01,0x00,0x07,0xf0,0x0f,0x72,0x7f,0x80,0x56,0xcf,0x00,
+0xf7,0x1f,0xd3,0x08,0xff,0x90,0x15,0x07,0x01,0x6a,0x08,0x00,0x03,0x00,0xd2,0x08,
+0xf4,0x00,0x09,0xf3,0x00,0x34,0x6f,0xc4,0x45,0xfd,0x44,0x09,0x76,0x05,0x10,0x01,
+0xe5,0x05,0xf1,0x09,0x53,0x00,0xef,0xff,0xf3,0x9b,0x0f,0x70,0x0e,0xb4,0x7f,0x3a,
+0xc0,0xf7,0x00,0xef,0xee,0xf3,0xac,0x0f,0x70,0x0e,0xa3,0x6f,0x0d,0x00,0x13,0xef,
+0x0d,0x00,0xfc,0x01,0x34,0x50,0xf7,0x00,0xe9,0x27,0xf3,0x05,0x7f,0x60,0x0e,0x95,
+0xfc,0x00,0x8f,0xd2,0xd0,0x05,0xf3,0x42,0x00,0x00,0x01,0xf4,0x3d,0xde,0xfd,0xdc,
+0x14,0x1f,0x44,0xf4,0x5b,0x49,0xe6,0xf1,0xf4,0x1c,0xff,0xff,0xf7,0x6f,0x1f,0x40,
+0x28,0xaf,0x87,0x06,0xf1,0xf4,0x02,0xac,0xfb,0x80,0x6f,0x1f,0x42,0xcc,0xdf,0xcc,
+0x96,0xf1,0xf4,0x04,0x47,0xf5,0x43,0x6f,0x1f,0x40,0x7f,0xff,0xff,0x46,0xe1,0xf4,
+0x08,0xd4,0x45,0xf4,0x00,0x1f,0x40,0x8f,0xcc,0xcf,0x40,0x69,0xf4,0x08,0xd5,0x56,
+0xe4,0x0a,0xeb,0x00,0x00,0x00,0x0f,0x90,0x00,0x06,0x00,0x81,0x08,0x88,0x8f,0xd8,
+0x88,0x87,0x0f,0xff,0x42,0x03,0x51,0x00,0x3f,0x80,0x00,0xdc,0x11,0x05,0xf5,0x16,
+0xeb,0x00,0x00,0xaf,0x20,0x00,0xfa,0x00,0x01,0xfc,0x00,0x00,0xf9,0x00,0x0b,0xf5,
+0x00,0x02,0xf7,0x00,0x8f,0xb0,0x00,0x05,0xf5,0x1b,0xfd,0x10,0x09,0x9e,0xf1,0x0c,
+0xa0,0x00,0x0c,0xfe,0x60,0x9e,0x00,0xf0,0x05,0x0b,0xd0,0x00,0x07,0xbb,0xbb,0x30,
+0xbd,0x00,0x00,0x8d,0xff,0xd6,0x3c,0xe3,0x33,0x00,0x0e,0x90,0x8f,0x5d,0x04,0x50,
+0xe9,0x02,0x3d,0xc3,0x9f,0xfc,0x0b,0xf5,0x1a,0xea,0x08,0xf0,0x00,0xe9,0x00,0x1f,
+0x70,0x9f,0x00,0x0e,0xca,0x66,0xf3,0x09,0xe0,0x8e,0xff,0xd5,0xce,0x00,0xbd,0x07,
+0xb7,0x20,0x7f,0x70,0x0d,0xb0,0x00,0x00,0x9f,0xc1,0x78,0xf9,0x00,0x00,0x0a,0xb0,
+0x0d,0xfd,0x71,0x0d,0x12,0xcc,0xfb,0x02,0xf5,0x37,0xc0,0x00,0x56,0x66,0x60,0x38,
+0xee,0x88,0x5d,0xff,0xff,0x15,0xff,0xff,0xf8,0xdb,0x19,0xf1,0x00,0xea,0x0f,0x8d,
+0xb0,0x8f,0x10,0x0f,0x81,0xf7,0xdb,0x08,0xf1,0x01,0xf6,0x2f,0x6d,0xb0,0x8f,0x10,
+0x3f,0x43,0xf5,0xdb,0x08,0xf1,0x07,0xf2,0x4f,0x4d,0xb0,0x8f,0x10,0xdd,0x06,0xf2,
+0xdd,0x8c,0xf1,0x5f,0x89,0xef,0x0d,0xff,0xff,0x14,0xd0,0xee,0x60,0xcb,0x07,0xd1,
+0xc1,0x08,0x11,0x00,0x16,0x07,0xa0,0xf4,0x00,0x09,0xc0,0x00,0x14,0x4e,0xb4,0x40,
+0x9c,0xf1,0x05,0xf5,0x2f,0xfe,0x1a,0xd1,0x10,0x03,0xd5,0x5b,0x2d,0xff,0xff,0x30,
+0x9e,0x03,0xf6,0x4c,0xc7,0xf3,0x4f,0x60,0x7c,0xf1,0xba,0x3f,0x20,0x7e,0x8f,0x75,
+0x0d,0x83,0xf2,0x00,0x6f,0xf1,0x01,0xf5,0x4f,0x10,0x02,0xff,0x50,0x5f,0x15,0xf0,
+0x01,0xde,0xae,0x0d,0xb0,0x6f,0x03,0xef,0x20,0x49,0xf5,0x6c,0xd0,0x1b,0x20,0x00,
+0xb7,0x1f,0xe6,0x1a,0x0e,0x10,0x12,0x1d,0x07,0xf6,0x3d,0xff,0xff,0xc5,0x0c,0xa0,
+0x00,0x01,0x0f,0x70,0x00,0xca,0x00,0x07,0xff,0xff,0xfe,0x3d,0xb3,0x31,0x27,0x7f,
+0xb7,0x7f,0xff,0xff,0x42,0xf9,0xfc,0xcc,0x2e,0xa5,0xf4,0x2f,0xdf,0xee,0xc0,0xf7,
+0x3f,0x32,0xf7,0xfb,0xbc,0x1f,0x64,0xf3,0x19,0x9f,0xc9,0x75,0xf3,0x4f,0x23,0xdd,
+0xfe,0xdb,0xbf,0x05,0xf1,0x03,0x3f,0xa5,0x7f,0x80,0x7f,0x06,0xde,0xff,0xff,0xf4,
+0x7d,0xe0,0x47,0x64,0x32,0xc3,0x2f,0x5b,0x00,0x02,0x07,0x00,0x30,0xbe,0x09,0xf1,
+0x2a,0x07,0xf0,0x0e,0xa0,0x9f,0x10,0x22,0x00,0x0c,0xf2,0x09,0xf1,0x1d,0xf2,0x09,
+0xff,0x00,0x9f,0x1c,0xf9,0x05,0xff,0xf0,0x09,0xfc,0xfb,0x00,0x1d,0xcf,0x00,0x9f,
+0xfa,0x0f,0x0e,0x40,0x5e,0xf7,0x00,0x00,0x9f,0x08,0xf0,0x0e,0x10,0x03,0x00,0x09,
+0xf5,0x8a,0xf1,0x00,0xf7,0x00,0x9f,0x00,0x9f,0x10,0x2f,0x70,0x09,0xf0,0x07,0xfd,
+0xcd,0xf3,0x00,0x9f,0x00,0x19,0xcc,0xc7,0x00,0xf0,0x34,0x00,0x00,0x00,0x10,0x00,
+0x10,0x00,0x0a,0xd0,0x9f,0x10,0x6f,0x60,0x00,0x4f,0x62,0xf7,0x0e,0xd0,0x00,0x0f,
+0xff,0xff,0xff,0xff,0x80,0x00,0xfa,0x45,0xfa,0x45,0xf8,0x00,0x0f,0xed,0xdf,0xed,
+0xdf,0x80,0x00,0xfa,0x56,0xfa,0x55,0xf8,0x00,0x0f,0xdb,0xbf,0xdb,0xbf,0x80,0x00,
+0xaa,0xab,0xfd,0xaa,0xa5,0x00,0x66,0x66,0x7f,0xb6,0x66,0x64,0x1f,0xff,0x01,0x00,
+0xc1,0x90,0x00,0x00,0x1f,0x70,0x00,0x00,0x00,0x00,0x01,0xf7,0x00,0x07,0x00,0x11,
+0xf8,0x07,0x00,0x50,0x2f,0x80,0x00,0x00,0x02,0x20,0x00,0x82,0xfb,0x00,0x18,0x88,
+0x8f,0xc8,0x88,0x50,0x1a,0x00,0x11,0x02,0x34,0x00,0xf2,0x39,0xfa,0x19,0x99,0xdf,
+0xb9,0x99,0x99,0x60,0x00,0x2f,0xc0,0x09,0xb0,0x00,0x00,0x0c,0xe1,0x00,0x6f,0x80,
+0x00,0x09,0xf8,0x45,0x67,0xff,0x30,0x05,0xff,0xff,0xff,0xfe,0xfc,0x00,0x09,0x65,
+0x32,0x10,0x07,0x80,0x00,0x01,0x23,0x46,0x8a,0xa0,0x00,0xef,0xff,0xff,0xfd,0xb9,
+0x30,0x04,0xb9,0x37,0xd0,0x09,0xb0,0x00,0x0b,0xc0,0x5f,0x20,0xeb,0x00,0x04,0xae,
+0x46,0xf6,0x7f,0x84,0x4e,0x00,0xf0,0x1f,0xf1,0x2f,0x50,0x00,0x00,0x00,0x7f,0x11,
+0x88,0xff,0xff,0xff,0xe7,0x80,0x00,0x3f,0xd7,0x78,0xfe,0x00,0x00,0x00,0x5f,0xb3,
+0xdf,0x40,0x00,0x00,0x00,0x8f,0xff,0x70,0x00,0x02,0x8a,0xef,0xeb,0xff,0xeb,0x91,
+0x0d,0xc9,0x40,0x00,0x69,0xca,0xa3,0x00,0x01,0xa2,0x00,0x12,0x02,0xb0,0x00,0x51,
+0x6f,0x40,0x00,0x00,0x03,0x48,0x00,0xb1,0xf3,0x28,0x8a,0xfc,0x88,0x88,0x88,0x20,
+0x00,0x9f,0x30,0xc2,0x00,0x10,0xd0,0x06,0x00,0x10,0x0b,0x1a,0x00,0xf0,0x08,0x50,
+0x0a,0xff,0xf7,0x77,0x79,0xf5,0x07,0xfa,0xae,0x00,0x00,0x4f,0x50,0x06,0x0a,0xe0,
+0x00,0x04,0xf5,0x00,0x00,0xaf,0x1a,0x00,0x91,0x00,0x0a,0xf6,0x66,0x68,0xe5,0x00,
+0x00,0xef,0x0b,0x01,0xf2,0x0b,0x0e,0xc5,0x55,0x55,0xf9,0x00,0x00,0xec,0x44,0x44,
+0x5f,0x90,0x00,0x0e,0xff,0xff,0xff,0xf9,0x00,0x00,0x22,0x22,0x22,0x22,0x10,0x06,
+0xaa,0x00,0xc2,0x36,0x7f,0xc6,0x66,0x66,0x66,0x00,0x05,0xfb,0x77,0x77,0x74,0x41,
+0x00,0x10,0x80,0x65,0x00,0xe1,0x05,0xf5,0x00,0x00,0x00,0x04,0x66,0xdf,0x10,0x00,
+0x00,0x00,0x4f,0xff,0x4e,0x01,0x09,0x01,0x00,0x20,0x1e,0x90,0x06,0x00,0xf0,0x03,
+0x2d,0xfd,0x20,0x00,0x00,0x00,0x5e,0xf6,0xef,0x60,0x00,0x03,0xcf,0xe3,0x01,0xcf,
+0xc5,0x05,0x54,0x00,0xe0,0xef,0xf5,0x09,0x45,0x77,0x77,0x75,0x16,0x00,0x02,0x44,
+0x44,0x44,0x43,0xf1,0x00,0xf1,0x03,0xff,0xff,0xb0,0x00,0x08,0xf1,0x00,0x00,0xeb,
+0x00,0x00,0x8f,0x00,0x00,0x0e,0xb0,0x00,0x08,0x87,0x01,0x71,0x00,0x8f,0x77,0x77,
+0x7e,0xa0,0x00,0x89,0x00,0xf0,0x04,0xf0,0xfb,0x77,0x77,0x77,0x7b,0xf0,0xf8,0x68,
+0x88,0x88,0x67,0xf0,0xf8,0xbe,0xee,0xee,0xb7,0xf0,0xb7,0x01,0xc0,0x07,0xf0,0xf8,
 0x2e,0xee,0xee,0x27,0xf0,0xf8,0x2f,0x85,0x8f,0x06,0x00,0x20,0x40,0x4f,0x06,0x00,
 0x20,0xed,0xef,0x06,0x00,0x90,0x96,0x66,0x17,0xf0,0xf8,0x04,0x10,0x03,0x7c,0x2a,
-0x00,0x3a,0x01,0xfe,0x70,0x51,0x03,0x23,0xbf,0x50,0xb4,0x15,0xf0,0x03,0xb0,0x03,
-0xdf,0x97,0x77,0xbf,0x70,0x2f,0xe5,0x40,0x03,0xfd,0x00,0x05,0x1a,0xf6,0x4e,0xe3,
-0xa9,0x08,0x20,0xfe,0x20,0xff,0x14,0xc0,0xf9,0x77,0x70,0x5d,0xff,0xfe,0xee,0xef,
-0xf1,0x1a,0x6f,0x90,0xa2,0x00,0x12,0x0e,0x06,0x00,0x01,0x80,0x23,0x53,0x0e,0xc6,
-0x66,0x6b,0xf1,0x53,0x00,0x23,0x0d,0xf1,0xf9,0x18,0x11,0x0e,0xe5,0x16,0xf0,0x10,
-0xed,0x88,0x88,0x88,0x8d,0xee,0x90,0x11,0x11,0x10,0xae,0xe9,0x1f,0xff,0xff,0x0a,
-0xee,0x91,0xf7,0x49,0xf0,0xae,0xe9,0x1f,0x40,0x6f,0x0a,0xee,0x91,0xff,0xff,0x0b,
-0x00,0xa0,0x85,0x55,0x0a,0xee,0x90,0x41,0x00,0x78,0xed,0xe9,0x02,0x14,0x12,0x60,
-0xcc,0x08,0x50,0x21,0x66,0x66,0xbf,0xe7,0x53,0x0b,0x30,0x9f,0xf5,0x63,0x4a,0x14,
-0xf4,0x02,0xdf,0x6d,0xfb,0x20,0x5f,0xfe,0x55,0xf4,0x06,0xef,0x50,0xa5,0x00,0x4f,
-0x40,0x01,0x70,0x6f,0x00,0x02,0xde,0x09,0x50,0xdd,0x55,0x55,0x5d,0xf0,0xbc,0x1d,
-0x00,0xf4,0x15,0x11,0xdf,0x27,0x09,0x56,0x0d,0xd6,0x66,0x66,0xdf,0x87,0x01,0x21,
-0x3e,0x70,0x08,0x24,0x20,0xfe,0x30,0x8d,0x1f,0xf1,0x04,0xc3,0xaf,0x92,0x00,0x4d,
-0xff,0x87,0xe3,0x6f,0xfd,0x52,0xea,0x31,0x2d,0xa1,0x27,0xd3,0x00,0x8f,0x10,0x02,
-0xe2,0x02,0x33,0x33,0x6f,0xb0,0x00,0x00,0x55,0x55,0x5d,0xf7,0x50,0x00,0x0e,0xd9,
-0x22,0x11,0xea,0x4b,0x23,0x00,0x75,0x14,0xe0,0xfe,0x00,0x00,0xec,0x66,0x66,0x6d,
-0xe0,0x00,0x00,0x4d,0x30,0xfa,0x00,0x91,0x1a,0x52,0x5f,0xc5,0x55,0x20,0x05,0x79,
-0x1b,0xe2,0xfd,0x11,0x1f,0xa1,0x11,0x00,0x1a,0x96,0x66,0xfc,0x66,0x66,0x13,0xff,
-0x05,0x0a,0x11,0x01,0x23,0x0c,0x12,0x0b,0xa3,0x00,0x50,0xbe,0x55,0x55,0x5c,0xf0,
-0x6b,0x05,0x00,0x66,0x14,0x11,0xbf,0xbd,0x09,0x71,0x0b,0xe7,0x77,0x77,0xcf,0x00,
-0x05,0xc3,0x1d,0xf4,0x33,0x05,0xf8,0x66,0x66,0x66,0xf9,0x05,0xf3,0x02,0xc3,0x00,
-0xe9,0x05,0xf5,0xff,0xff,0xf4,0xe9,0x05,0xf3,0x35,0xf6,0x30,0xe9,0x05,0xf7,0xff,
-0xff,0xf8,0xe9,0x06,0xf2,0x44,0x44,0x42,0xe9,0x07,0xf0,0xef,0xff,0xf0,0xe9,0x0a,
-0xe0,0xe8,0x06,0xf0,0xe9,0x0e,0xa0,0xee,0xce,0xf0,0xe9,0x5f,0x50,0xea,0x55,0xb7,
-0xf9,0x4c,0x00,0x32,0x00,0x8f,0xd3,0xa2,0x09,0x10,0xf1,0x84,0x09,0xf3,0x02,0x28,
-0xf1,0xf7,0x29,0xf0,0xee,0xde,0xf1,0xfe,0xde,0xf0,0xeb,0x39,0xf1,0xf8,0x3a,0xf0,
-0x18,0x00,0xf0,0x00,0x22,0x20,0x22,0x29,0xf0,0xe9,0x0f,0xff,0xfe,0x08,0xf0,0xe9,
-0x0f,0x94,0xaf,0x06,0x00,0x30,0x50,0x7f,0x08,0x12,0x00,0x74,0xff,0x08,0xf0,0xe9,
-0x0d,0x84,0x4a,0xa8,0x09,0xf3,0x3f,0x05,0xff,0xff,0x1d,0xff,0xfb,0x00,0x5f,0x59,
-0xf1,0xdb,0x4d,0xb0,0x05,0xf0,0x6f,0x1d,0x90,0xbb,0x00,0x5f,0xff,0xf1,0xdf,0xff,
-0xb0,0x01,0x44,0x4d,0xb3,0xce,0x63,0x01,0x66,0x68,0xfc,0x69,0xfc,0x64,0x2e,0xef,
-0xff,0xee,0xff,0xee,0x80,0x3a,0xf8,0x00,0x07,0xfb,0x51,0x2f,0xff,0xff,0x3d,0xff,
-0xff,0x90,0x3f,0x98,0xf3,0xeb,0x5f,0xa0,0x00,0xf9,0x8f,0x3e,0xa5,0xf8,0x00,0x0f,
-0xff,0xe3,0xef,0xfe,0x80,0x86,0x0b,0x81,0xfd,0x99,0x99,0x99,0x9d,0xf0,0x0f,0x80,
-0x28,0x10,0xf1,0x08,0xf8,0x16,0x66,0x66,0x09,0xf0,0x0f,0x82,0xff,0xff,0xf1,0x9f,
-0x00,0xf8,0x2f,0x40,0x7f,0x19,0xf0,0x0f,0x82,0xf4,0x07,0x0d,0x00,0xd0,0xff,0xff,
-0x19,0xf0,0x0f,0x81,0x66,0x66,0x60,0x9f,0x00,0xf9,0x00,0xf4,0x29,0x03,0x41,0x00,
+0x00,0x25,0x01,0xfe,0xa5,0x00,0x11,0x02,0x06,0x00,0x10,0xbf,0x83,0x01,0x10,0x0a,
+0x7b,0x00,0xf0,0x18,0x03,0xdf,0x97,0x77,0xbf,0x70,0x2f,0xe5,0x40,0x03,0xfd,0x00,
+0x05,0x1a,0xf6,0x4e,0xe3,0x00,0x00,0x01,0xcf,0xfe,0x20,0x00,0x00,0x28,0xef,0xf9,
+0x77,0x70,0x5d,0xff,0xfe,0xee,0xef,0xf1,0x1a,0x6f,0x90,0xa2,0x00,0x12,0x0e,0x06,
+0x00,0x00,0x19,0x01,0x63,0x00,0x0e,0xc6,0x66,0x6b,0xf1,0x53,0x00,0x20,0x0d,0xf1,
+0x58,0x00,0x21,0xfa,0x00,0x1b,0x00,0xf0,0x12,0xff,0xfe,0xed,0x88,0x88,0x88,0x8d,
+0xee,0x90,0x11,0x11,0x10,0xae,0xe9,0x1f,0xff,0xff,0x0a,0xee,0x91,0xf7,0x49,0xf0,
+0xae,0xe9,0x1f,0x40,0x6f,0x0a,0xee,0x91,0xff,0xff,0x0b,0x00,0xf1,0x01,0x85,0x55,
+0x0a,0xee,0x90,0x41,0x00,0x78,0xed,0xe9,0x00,0x00,0x09,0xfe,0x60,0x2f,0xe5,0x00,
+0xf4,0x12,0x21,0x66,0x66,0xbf,0xe7,0x66,0x61,0x00,0x00,0x9f,0xf5,0x63,0x00,0x00,
+0x06,0xdf,0xdf,0x6d,0xfb,0x20,0x5f,0xfe,0x55,0xf4,0x06,0xef,0x50,0xa5,0x00,0x4f,
+0x40,0x01,0x70,0x6f,0x00,0x00,0x2d,0x00,0xf6,0x0b,0x00,0x00,0xdd,0x55,0x55,0x5d,
+0xf0,0x00,0x0d,0xc0,0x00,0x00,0xbf,0x00,0x00,0xdf,0xee,0xee,0xef,0xf0,0x00,0x0d,
+0xd6,0x66,0x66,0xdf,0x87,0x01,0x11,0x3e,0x32,0x00,0xf1,0x0b,0x5e,0xfe,0x30,0x00,
+0x00,0x04,0xbf,0xc3,0xaf,0x92,0x00,0x4d,0xff,0x87,0xe3,0x6f,0xfd,0x52,0xea,0x31,
+0x2d,0xa1,0x27,0xd3,0x00,0x8f,0x10,0x02,0xc1,0x02,0x33,0x33,0x6f,0xb0,0x00,0x00,
+0x55,0x55,0x5d,0xf7,0x50,0xc1,0x00,0xf1,0x14,0xfe,0x00,0x00,0xea,0x00,0x00,0x0b,
+0xe0,0x00,0x0e,0xfe,0xee,0xee,0xfe,0x00,0x00,0xec,0x66,0x66,0x6d,0xe0,0x00,0x00,
+0x4d,0x30,0xfa,0x00,0x00,0x00,0x0c,0xf6,0x5f,0xc5,0x55,0x20,0xc9,0x01,0xf2,0x00,
+0xf6,0x01,0xfd,0x11,0x1f,0xa1,0x11,0x00,0x1a,0x96,0x66,0xfc,0x66,0x66,0x13,0x93,
+0x02,0x82,0x00,0x01,0x11,0x11,0x11,0x10,0x00,0x0b,0xa3,0x00,0xe0,0xbe,0x55,0x55,
+0x5c,0xf0,0x00,0x0b,0xd0,0x00,0x00,0xaf,0x00,0x00,0xbf,0xc8,0x01,0x71,0x00,0x0b,
+0xe7,0x77,0x77,0xcf,0x00,0x41,0x00,0xf2,0x34,0xf9,0x05,0xf8,0x66,0x66,0x66,0xf9,
+0x05,0xf3,0x02,0xc3,0x00,0xe9,0x05,0xf5,0xff,0xff,0xf4,0xe9,0x05,0xf3,0x35,0xf6,
+0x30,0xe9,0x05,0xf7,0xff,0xff,0xf8,0xe9,0x06,0xf2,0x44,0x44,0x42,0xe9,0x07,0xf0,
+0xef,0xff,0xf0,0xe9,0x0a,0xe0,0xe8,0x06,0xf0,0xe9,0x0e,0xa0,0xee,0xce,0xf0,0xe9,
+0x5f,0x50,0xea,0x55,0xb7,0xf9,0x4c,0x00,0x32,0x00,0x8f,0xd3,0xe8,0x00,0xf3,0x09,
+0xef,0xff,0xf1,0xff,0xff,0xf0,0xea,0x28,0xf1,0xf7,0x29,0xf0,0xee,0xde,0xf1,0xfe,
+0xde,0xf0,0xeb,0x39,0xf1,0xf8,0x3a,0xf0,0x18,0x00,0xf0,0x00,0x22,0x20,0x22,0x29,
+0xf0,0xe9,0x0f,0xff,0xfe,0x08,0xf0,0xe9,0x0f,0x94,0xaf,0x06,0x00,0x30,0x50,0x7f,
+0x08,0x12,0x00,0xf1,0x50,0xff,0x08,0xf0,0xe9,0x0d,0x84,0x4a,0x8d,0xf0,0xe9,0x00,
+0x00,0x06,0xfe,0x70,0x05,0xff,0xff,0x1d,0xff,0xfb,0x00,0x5f,0x59,0xf1,0xdb,0x4d,
+0xb0,0x05,0xf0,0x6f,0x1d,0x90,0xbb,0x00,0x5f,0xff,0xf1,0xdf,0xff,0xb0,0x01,0x44,
+0x4d,0xb3,0xce,0x63,0x01,0x66,0x68,0xfc,0x69,0xfc,0x64,0x2e,0xef,0xff,0xee,0xff,
+0xee,0x80,0x3a,0xf8,0x00,0x07,0xfb,0x51,0x2f,0xff,0xff,0x3d,0xff,0xff,0x90,0x3f,
+0x98,0xf3,0xeb,0x5f,0xa0,0x00,0xf9,0x8f,0x3e,0xa5,0xf8,0x00,0x0f,0xff,0xe3,0xef,
+0xfe,0x80,0x0f,0xff,0x05,0x01,0x70,0xfd,0x99,0x99,0x99,0x9d,0xf0,0x0f,0x38,0x03,
+0xf1,0x0a,0x9f,0x00,0xf8,0x16,0x66,0x66,0x09,0xf0,0x0f,0x82,0xff,0xff,0xf1,0x9f,
+0x00,0xf8,0x2f,0x40,0x7f,0x19,0xf0,0x0f,0x82,0xf4,0x07,0x0d,0x00,0xc0,0xff,0xff,
+0x19,0xf0,0x0f,0x81,0x66,0x66,0x60,0x9f,0x00,0xf9,0x9d,0x02,0x13,0xf0,0x41,0x00,
 0x55,0xfb,0x66,0x66,0x66,0x6c,0x0d,0x00,0xf1,0x20,0x67,0x76,0x77,0x6c,0xf0,0x0f,
 0x80,0x5e,0x0e,0x60,0x8f,0x00,0xf8,0x38,0xf4,0xf9,0x38,0xf0,0x0f,0x8c,0xff,0xff,
 0xfc,0x8f,0x00,0xf8,0x06,0xe0,0xe6,0x08,0xf0,0x0f,0x8d,0xff,0xff,0xfd,0x8f,0x00,
@@ -1176,1273 +1321,1259 @@ static const uint8_t lz4FontData[] ={
 0x00,0x29,0x20,0x09,0xf0,0xf8,0x34,0x7f,0x64,0x49,0xf0,0xf8,0xdf,0xff,0xff,0xd9,
 0xf0,0xf8,0x01,0x5f,0x41,0x09,0xf0,0xf8,0x4f,0xff,0xff,0x59,0xf0,0xf8,0x4f,0x10,
 0x1f,0x06,0x00,0x93,0xed,0xef,0x59,0xf0,0xf8,0x03,0x33,0x33,0x19,0x3c,0x00,0x16,
-0xfc,0x48,0x00,0x10,0xff,0x24,0x04,0xf0,0x13,0xdf,0xf9,0x45,0x55,0x55,0x3b,0xff,
+0xfc,0x48,0x00,0x10,0xff,0x24,0x04,0xf2,0x1e,0xdf,0xf9,0x45,0x55,0x55,0x3b,0xff,
 0x9b,0xff,0xff,0xfa,0xbf,0xf9,0x00,0x4f,0x20,0x0b,0xff,0x96,0xff,0xff,0xf5,0xbf,
-0xf9,0x25,0x8f,0x9e,0x2b,0xff,0x90,0x05,0xf4,0xd5,0xbf,0x82,0x0a,0x72,0xdb,0xff,
-0x93,0x44,0x44,0x43,0xbf,0x37,0x00,0x52,0xc7,0x77,0x77,0x77,0xdf,0x69,0x04,0x91,
-0x20,0x6f,0x87,0x77,0x77,0x77,0x71,0x06,0xf2,0xec,0x04,0x20,0x6f,0x20,0x83,0x0d,
-0x22,0x06,0xf1,0x0d,0x12,0x71,0x58,0x8c,0xf8,0x88,0x40,0x08,0xf7,0x9e,0x11,0x11,
-0x9f,0xab,0x11,0x21,0x0b,0xd0,0x1a,0x00,0x11,0xfa,0x0d,0x00,0x82,0x4f,0x87,0x77,
-0xbf,0x87,0x77,0x37,0xf5,0x93,0x02,0x0c,0x4c,0x14,0x00,0x3c,0x07,0x62,0x33,0x9f,
-0x63,0x33,0x33,0x11,0x9c,0x0e,0xc0,0x04,0x4a,0xf7,0x44,0x44,0x44,0x10,0x02,0xfc,
-0x00,0x3f,0x50,0xf9,0x0c,0xf1,0x04,0x03,0xf5,0x00,0x01,0xdf,0xf0,0xdf,0xff,0xff,
-0xe0,0x3f,0xef,0x05,0x68,0xf9,0x65,0x00,0x49,0xf0,0x1a,0x00,0x40,0x9f,0x00,0x03,
-0xf5,0xd0,0x30,0x70,0x66,0x8f,0xa6,0x63,0x00,0x9f,0x5f,0x65,0x14,0x04,0x43,0x19,
-0x40,0x50,0x01,0xf6,0x00,0x5f,0x14,0xf1,0x2f,0x8f,0x41,0x11,0x00,0x1f,0x60,0x3f,
-0xff,0xff,0xf3,0x7f,0xff,0xdd,0xe5,0x55,0x8f,0x23,0x8f,0xa7,0xf5,0x40,0x04,0xf2,
-0x01,0xf5,0x01,0x6f,0x70,0x4f,0x10,0x1f,0x50,0x00,0x6e,0x26,0xf1,0x01,0xfb,0xe2,
-0x01,0x9f,0xcf,0x02,0x9f,0xf7,0x28,0xfe,0x67,0xf0,0x6f,0x91,0x09,0xf8,0x00,0x9d,
-0x01,0x20,0x00,0x11,0x26,0x7e,0xa0,0xc7,0x16,0x15,0xd3,0xf8,0x12,0x10,0x0a,0x05,
-0x01,0xf0,0x21,0x0e,0x80,0xad,0x4f,0x98,0xf2,0x27,0xfc,0x6a,0xd7,0xfb,0xaf,0x24,
-0xff,0xfe,0xaf,0xdf,0xee,0xf2,0x02,0xe9,0x2a,0xb0,0xf6,0x5f,0x20,0x0e,0x80,0xaf,
-0xef,0xff,0xf2,0x00,0xe8,0x14,0x57,0xfb,0x55,0x00,0x0e,0xee,0x34,0x6f,0xb4,0x41,
-0x3d,0xff,0x8c,0x21,0x0c,0xd1,0xf8,0x10,0x11,0x3f,0x91,0x10,0x01,0x00,0x47,0x78,
-0xfc,0x77,0x50,0xd2,0x04,0xf6,0x40,0xfb,0x26,0xaf,0x64,0x8f,0xff,0xfe,0x05,0xff,
-0xff,0xc8,0xe5,0x5b,0xe0,0x00,0x6f,0x00,0x8d,0x01,0x9e,0x09,0xef,0xfe,0xea,0xd2,
-0xff,0xa0,0x4d,0x96,0xea,0x9e,0x36,0x52,0x00,0xa9,0x2f,0x28,0xff,0xff,0xf2,0x5f,
-0xff,0xfc,0x8f,0xf4,0x9e,0x02,0x5a,0xf5,0x48,0xec,0x9d,0xa0,0x35,0xaf,0x55,0x9d,
-0x5f,0xf4,0x0a,0xff,0xff,0xfa,0xd0,0xff,0x10,0x00,0x6f,0x00,0x8e,0xbf,0xfe,0x30,
-0x06,0xf0,0x08,0xfd,0x32,0xb2,0x4e,0x01,0x10,0x03,0x33,0x0c,0x20,0x40,0x05,0xd6,
-0x05,0xf1,0x06,0xab,0x3b,0xf8,0xbf,0x93,0x00,0x95,0x7f,0xfe,0xaa,0xff,0xf8,0x09,
-0xf4,0x43,0x6d,0xc6,0x23,0x00,0x03,0x1c,0x9e,0x1f,0xf1,0x0c,0x8b,0x2b,0x4c,0xb6,
-0xb2,0x00,0x3f,0x4a,0xe4,0xca,0x2f,0x80,0x0b,0x92,0xd3,0xef,0x60,0x5a,0x00,0x14,
-0x34,0x4d,0x83,0x33,0x10,0x00,0xcf,0x80,0x0f,0x74,0x33,0x33,0x4f,0x93,0x33,0x32,
-0x2f,0x8b,0x07,0x01,0xd3,0x07,0xf0,0x2e,0x0d,0x80,0x0e,0x80,0x0e,0xa0,0x00,0xd8,
-0x02,0xae,0x26,0xf6,0x10,0x0d,0x80,0xef,0xff,0xff,0xf6,0x2c,0xfe,0x9e,0x94,0xf8,
-0x4f,0x62,0xcf,0xe9,0xef,0xef,0xfe,0xf6,0x00,0xd8,0x0e,0xb7,0xfa,0x8f,0x60,0x0d,
-0x80,0x88,0x88,0x88,0x83,0x00,0xdc,0xa5,0xff,0xff,0xfe,0x02,0xaf,0xfd,0x6f,0x65,
-0x5b,0xe0,0x2f,0xc5,0x05,0xb1,0x04,0x61,0x20,0x00,0x5f,0x65,0x5b,0xe0,0xcd,0x08,
-0x10,0xfe,0x9f,0x06,0x15,0xf4,0x44,0x10,0xf2,0x04,0x04,0x44,0x48,0xf7,0x44,0x44,
-0x00,0x5e,0xee,0xff,0xfe,0xee,0x80,0x01,0x55,0x55,0x55,0x55,0x53,0x3a,0x0e,0xe1,
-0x50,0x02,0xf9,0x47,0xf7,0x46,0xf5,0x00,0x3f,0x84,0x7f,0x74,0x6f,0x50,0x90,0x04,
-0x11,0xf5,0x0c,0x19,0x22,0x2a,0x40,0xa8,0x22,0x2b,0x04,0xd1,0xd5,0x06,0x15,0x10,
-0x54,0x0e,0x03,0xbf,0x1b,0xf0,0x0a,0x55,0x5e,0xd5,0xde,0x65,0x50,0x00,0xc9,0xdb,
-0x0c,0xdd,0xa0,0x00,0x8f,0x4d,0xb0,0xcd,0x4f,0xb0,0x09,0x60,0xdb,0x0b,0xc0,0x57,
-0x06,0x1b,0x51,0x22,0x20,0x00,0x00,0x3c,0x61,0x05,0xf8,0x0c,0xbf,0xef,0x81,0x6f,
-0xc0,0x00,0x06,0x60,0x8f,0xdf,0xb1,0x00,0x02,0x69,0xcf,0xff,0xfe,0xb8,0x73,0x3f,
-0xec,0x83,0x03,0x9c,0xff,0x20,0x10,0x5f,0x00,0x21,0x0b,0xb0,0x57,0x18,0x40,0xfb,
-0x12,0x08,0xf1,0x55,0x07,0xf0,0x18,0xfc,0x8f,0x10,0x00,0x09,0xf5,0x5f,0xa8,0xf1,
-0x00,0x02,0xf9,0x03,0xf7,0x8f,0xe5,0x00,0xaf,0x95,0x8f,0x38,0xfd,0xf4,0x00,0x4a,
-0xff,0xd0,0x8f,0x2d,0xf3,0x00,0x0a,0xf6,0x08,0xf1,0x28,0x00,0x03,0xfe,0x34,0x00,
-0x90,0x04,0xef,0x30,0x08,0xf1,0x00,0x07,0xff,0x50,0x0d,0x00,0x23,0x1a,0x20,0xa4,
-0x18,0x03,0x89,0x09,0x21,0xdc,0x10,0xf8,0x27,0x00,0x89,0x00,0xb0,0x4d,0xfa,0x66,
-0x8f,0xd1,0x00,0x03,0xc5,0xd7,0x5f,0xe2,0x34,0x26,0xe0,0xff,0xd5,0x00,0x00,0x0a,
-0xef,0xfb,0x7e,0xf4,0x21,0x00,0x9a,0x62,0x7f,0x75,0x2d,0xb1,0x17,0xef,0x83,0x38,
-0xf9,0x00,0x03,0xf9,0x7d,0x57,0xfd,0xb0,0x1e,0xd4,0xf9,0x00,0x01,0x68,0xae,0xff,
-0xc4,0x00,0x00,0x0e,0xfd,0xa6,0x10,0x02,0x01,0x00,0x1a,0x00,0x17,0xf6,0xf8,0x30,
-0x21,0x04,0xf5,0x49,0x11,0x42,0xbf,0xb8,0x88,0x83,0x18,0x01,0x00,0xcc,0x2f,0x11,
-0xf1,0x2a,0x03,0x21,0xef,0x70,0x62,0x35,0x20,0xdf,0x10,0x0a,0x27,0x20,0x05,0xfc,
-0xa0,0x01,0xd4,0x20,0x09,0xfc,0x10,0x1b,0xfe,0x30,0x00,0x0a,0xff,0x50,0xaa,0x10,
-0xfa,0x3a,0x02,0xac,0x03,0x11,0xf6,0x41,0x1e,0x30,0x8f,0xb7,0x77,0x26,0x33,0x00,
-0x8e,0x01,0xf2,0x04,0x0c,0xb0,0x2f,0x70,0x5f,0x50,0x00,0xcb,0x02,0xf6,0x04,0xf5,
-0x00,0x0d,0xb0,0x4f,0x60,0x5f,0x50,0x38,0x02,0x50,0x91,0x77,0x77,0xff,0xfa,0x91,
-0x08,0x30,0x7f,0x9e,0xd1,0x33,0x09,0xf5,0x01,0xc0,0x4f,0xd3,0x00,0x18,0xef,0xb1,
-0x00,0x5f,0xfc,0x60,0xdb,0x50,0x00,0x00,0x19,0x87,0x0a,0x31,0x3b,0x42,0xf7,0x9d,
-0x2b,0x23,0x2f,0x70,0xc8,0x0f,0xb0,0xf6,0x00,0x9f,0xb9,0xaf,0xc9,0x99,0x40,0x0b,
-0xb0,0x03,0xa0,0x46,0x44,0x88,0x88,0xaf,0xb8,0x00,0x12,0x51,0x80,0x00,0x01,0xef,
-0xf6,0x1b,0x08,0x30,0x7d,0xe3,0x00,0x77,0x11,0xa0,0x3f,0xf7,0x00,0x1c,0xff,0x80,
-0x00,0x3d,0xff,0x80,0xe9,0x1f,0x20,0x06,0xc3,0xeb,0x2a,0xf0,0x10,0x35,0x83,0x00,
-0x91,0xe8,0xef,0xed,0xba,0x70,0x0d,0x8e,0x87,0x67,0x90,0xad,0x00,0x8c,0xe8,0x7c,
-0x5e,0x4f,0x50,0x01,0x0e,0x85,0xb4,0x87,0xf4,0x10,0x18,0xf8,0xd5,0x06,0xf2,0x04,
-0x2f,0xef,0x81,0xe6,0x04,0xf2,0x00,0x60,0xe8,0x06,0x97,0xdf,0x10,0x00,0x08,0x54,
-0xf5,0x26,0x30,0x06,0x1a,0xf9,0x05,0xf8,0x04,0x44,0x8f,0xff,0xb5,0x44,0x21,0x47,
-0xbf,0xd2,0x9f,0xd8,0x63,0x1f,0xeb,0x60,0x00,0x4a,0xef,0x70,0x27,0x03,0x59,0x01,
-0x73,0x06,0x66,0xbf,0x96,0x66,0x66,0x31,0x4c,0x13,0x22,0x08,0xf4,0xb3,0x20,0xf0,
-0x0b,0x4f,0xff,0xff,0x90,0x01,0xcf,0x21,0x66,0x8f,0xe3,0x01,0xdf,0xf0,0x00,0x0d,
-0xe2,0x00,0x5f,0xef,0x27,0x77,0xfc,0x77,0x50,0x49,0xf4,0x62,0x11,0x00,0xaa,0x18,
-0x10,0xf9,0x4a,0x0b,0x40,0x05,0x7f,0x80,0x00,0x3d,0x0b,0x1d,0xe3,0x94,0x09,0x10,
-0x9c,0x4b,0x0e,0x52,0x88,0x8d,0xfa,0x88,0x86,0x3e,0x0a,0xf2,0x06,0xc0,0x3f,0x41,
-0x11,0x11,0x11,0xcc,0x02,0xa5,0xff,0xff,0xff,0x98,0x80,0x00,0x03,0x33,0x33,0x32,
-0x00,0x07,0xf6,0x09,0x60,0x37,0x7a,0xfa,0x7f,0xc7,0x77,0x92,0x13,0x11,0xf9,0xbf,
-0x34,0xc4,0x0f,0x90,0x1c,0x22,0x7d,0xf5,0x00,0xed,0x69,0xf2,0x5f,0xb4,0x7e,0x37,
-0x08,0x01,0x00,0x10,0x4d,0xd5,0x10,0x02,0xe0,0x21,0x02,0x1d,0x06,0x30,0x0f,0x70,
-0x00,0xcc,0x09,0x10,0xb6,0xc2,0x00,0xa1,0xb0,0x00,0x07,0x78,0xfb,0x77,0x00,0x00,
-0x06,0xd3,0xa7,0x1a,0x21,0xaf,0x21,0x3e,0x09,0x80,0xf7,0x1f,0xb6,0x66,0x00,0x04,
-0xfe,0xf7,0x9c,0x09,0xa4,0xde,0x1d,0xff,0xd9,0x88,0x84,0x4e,0x40,0x07,0xce,0x8e,
-0x3c,0x06,0x6f,0x03,0x00,0xe4,0x35,0x03,0xba,0x06,0xc4,0xfa,0x66,0x7a,0x76,0x6b,
-0xf0,0x0d,0x94,0x48,0xf7,0x44,0xbd,0x04,0x09,0xf4,0x04,0x35,0x58,0xf7,0x55,0x30,
-0x00,0x09,0xdd,0xef,0xed,0xda,0x00,0x05,0x55,0x5a,0xf7,0x55,0x55,0x12,0x88,0x08,
-0x10,0xbf,0xcc,0x49,0xe6,0x4a,0xff,0x50,0x5f,0xe9,0x51,0x1e,0xe8,0x10,0x00,0x3b,
-0xfe,0x10,0x10,0x57,0x00,0x02,0x2a,0x37,0x04,0x5b,0x00,0xf0,0x1a,0x40,0xfb,0x7a,
-0x76,0x68,0x69,0xf4,0x0d,0x69,0xf5,0x03,0xfa,0x5d,0x30,0x3c,0xf7,0x2e,0x74,0xee,
-0x30,0x04,0xd4,0x2d,0xff,0x72,0xc5,0x00,0x00,0x6e,0xd1,0x8f,0xb1,0x00,0x06,0xdf,
-0xe6,0x55,0xaf,0xfa,0x34,0xfe,0x72,0x0e,0xd2,0xf6,0x03,0x3f,0x50,0x00,0x1f,0x81,
-0x00,0x03,0xf9,0x66,0x67,0xf8,0x89,0x1d,0x11,0x80,0xbf,0x26,0x21,0x07,0xf1,0x6c,
-0x12,0xf0,0x23,0x7f,0x10,0x8e,0xef,0xee,0x21,0x18,0xf3,0x04,0x88,0x8c,0xad,0xff,
-0xff,0xf5,0x05,0x11,0xf7,0x45,0x5a,0xf6,0x21,0xec,0x5f,0x34,0x60,0x7f,0x10,0x04,
-0xff,0xe0,0x8f,0x27,0xf1,0x00,0x07,0xfb,0x00,0xe9,0x7f,0x10,0x00,0x9f,0xf3,0x06,
-0x37,0xf1,0x00,0x5f,0xae,0xce,0x06,0xcb,0x7f,0xc0,0x67,0x03,0x9d,0xf0,0x05,0xb0,
-0x00,0x00,0x1f,0xf8,0xf8,0x32,0x06,0x00,0x2b,0x00,0xcc,0x02,0xf0,0x14,0xd2,0x1f,
-0x90,0xad,0x00,0x00,0xde,0x01,0xf9,0x07,0xf5,0x00,0x1f,0xa0,0x1f,0x90,0x1f,0xd0,
-0x07,0xf5,0x01,0xf9,0x00,0x9f,0x30,0xee,0x00,0x1f,0x90,0x04,0xf9,0x2c,0x60,0x01,
-0xf9,0xa3,0x2f,0x00,0x34,0x00,0x51,0x20,0x00,0x04,0x8a,0xf8,0x1a,0x0c,0x09,0x15,
-0x1c,0x02,0xc6,0x32,0x01,0x42,0x07,0xd0,0x00,0x7e,0x17,0xf1,0x0d,0x70,0x00,0x0e,
-0xb0,0x7f,0x10,0x9f,0x20,0xf9,0x14,0x40,0x01,0xfa,0x01,0xfb,0xdd,0x12,0x70,0xf3,
-0x1a,0x20,0x07,0xf1,0x02,0x19,0x7f,0x07,0x21,0x13,0xfa,0x79,0x35,0xd0,0xed,0x10,
-0x00,0x00,0x01,0x5c,0xfc,0x20,0x00,0x48,0xad,0xff,0xd6,0x13,0x2e,0x2e,0xb7,0x20,
-0x9f,0x27,0x03,0x7a,0x04,0x25,0xbe,0x00,0xa3,0x0c,0x40,0x18,0x8a,0xfb,0x88,0xf2,
-0x1d,0x02,0xdd,0x15,0x81,0x0d,0xf5,0x55,0x55,0x55,0x00,0x03,0xfe,0x0a,0x0a,0x50,
-0x9f,0x21,0x1d,0xc1,0x11,0x15,0x28,0xf7,0x04,0xdb,0x00,0x00,0x1d,0xe1,0x00,0x0d,
-0xb0,0x00,0x08,0xf3,0x67,0x77,0xed,0x77,0x73,0x04,0x0c,0xff,0x70,0x07,0x00,0x4c,
-0x2b,0x82,0xb0,0x00,0x05,0x6d,0xf6,0x68,0xfb,0x63,0x8c,0x13,0x72,0x90,0x01,0x55,
-0x5d,0xf5,0x55,0x50,0x04,0x1f,0x73,0x00,0x25,0x55,0xaf,0x85,0x55,0x55,0xb0,0x0c,
-0x30,0x01,0x1c,0xf7,0x64,0x19,0x11,0x0a,0xa0,0x05,0xf1,0x01,0x1c,0xfa,0x22,0x6f,
-0x72,0x20,0x07,0xfe,0x77,0x79,0xfa,0x77,0x71,0x05,0x6f,0xff,0xed,0x3e,0xc2,0x89,
-0x03,0xf5,0x08,0xa1,0x00,0x29,0xf4,0x5f,0x73,0xfb,0x20,0xfe,0x01,0x80,0x30,0xf8,
-0x55,0x55,0x55,0x57,0xf3,0x0f,0xe8,0x1d,0x60,0x6f,0x30,0x00,0xeb,0x44,0x4a,0x63,
-0x08,0x60,0xcd,0xfe,0xcc,0x10,0x00,0x16,0x38,0x0e,0x11,0x30,0x4b,0x06,0x00,0x51,
-0x4d,0xf5,0x01,0x1f,0x80,0x1f,0x70,0x02,0xf6,0x01,0xf8,0x9e,0xf6,0x00,0x05,0x20,
-0x1f,0x83,0x75,0xea,0x10,0x01,0xe2,0x24,0xf0,0x02,0x03,0x78,0x78,0xfc,0x78,0x76,
-0x00,0x06,0xe1,0x1f,0x80,0x9e,0x20,0x00,0x3f,0x71,0xf8,0x08,0x29,0xd1,0xc7,0x1f,
-0x83,0xd3,0x00,0x19,0x99,0x9a,0xfd,0x99,0x99,0x62,0xff,0xf5,0x0a,0x05,0x72,0x0e,
-0x02,0xbc,0x1d,0x09,0x0d,0x00,0x03,0xea,0x0d,0x00,0xf9,0x26,0x12,0x07,0x4c,0x05,
-0xe0,0x8f,0x77,0xa8,0x77,0xa8,0x73,0x08,0xf3,0x4f,0x94,0x5f,0x94,0x10,0x8f,0x39,
-0x09,0xa0,0xf5,0x09,0xf0,0x0f,0x81,0x3f,0x70,0x00,0x9f,0x00,0x95,0x00,0x30,0x0a,
-0xd3,0x46,0x54,0x14,0xf5,0x11,0xcc,0x8e,0xfe,0xee,0xff,0x60,0x0f,0x90,0x5f,0xb3,
-0x9f,0x90,0x03,0xf6,0x24,0xaf,0xff,0xd4,0x20,0x7f,0x2e,0xfd,0x97,0xbf,0xff,0x50,
-0x20,0x20,0x00,0x00,0x02,0x40,0xf8,0x0c,0x21,0x0b,0xe1,0x41,0x30,0x00,0xf0,0x16,
-0x10,0x8f,0xad,0x23,0xf0,0x15,0x73,0x08,0xf0,0x57,0x0c,0x52,0x81,0x00,0x9f,0x0c,
+0xf9,0x25,0x8f,0x9e,0x2b,0xff,0x90,0x05,0xf4,0xd5,0xbf,0xf9,0xef,0xff,0xff,0xdb,
+0xff,0x93,0x44,0x44,0x43,0xbf,0x37,0x00,0x52,0xc7,0x77,0x77,0x77,0xdf,0x69,0x04,
+0x91,0x20,0x6f,0x87,0x77,0x77,0x77,0x71,0x06,0xf2,0xec,0x04,0xf0,0x0d,0x6f,0x20,
+0x07,0xf1,0x00,0x00,0x06,0xf1,0x00,0x7f,0x10,0x00,0x00,0x7f,0x58,0x8c,0xf8,0x88,
+0x40,0x08,0xf7,0xff,0xff,0xff,0xf8,0x00,0x9f,0x00,0x1a,0x00,0x21,0x0b,0xd0,0x1a,
+0x00,0x11,0xfa,0x0d,0x00,0x82,0x4f,0x87,0x77,0xbf,0x87,0x77,0x37,0xf5,0x93,0x02,
+0x0a,0x88,0x04,0xc1,0x02,0xe5,0x00,0x00,0x00,0x03,0x33,0x9f,0x63,0x33,0x33,0x11,
+0x68,0x00,0xf1,0x15,0xf7,0x04,0x4a,0xf7,0x44,0x44,0x44,0x10,0x02,0xfc,0x00,0x3f,
+0x50,0x00,0x00,0xcf,0x30,0x03,0xf5,0x00,0x01,0xdf,0xf0,0xdf,0xff,0xff,0xe0,0x3f,
+0xef,0x05,0x68,0xf9,0x65,0x00,0x49,0xf0,0x1a,0x00,0xf3,0x04,0x9f,0x00,0x03,0xf5,
+0x00,0x00,0x09,0xf2,0x66,0x8f,0xa6,0x63,0x00,0x9f,0x5f,0xff,0xff,0xff,0x60,0x54,
+0x00,0xf0,0x38,0x1f,0x50,0x01,0xf6,0x00,0x00,0x01,0xf5,0x00,0x8f,0x41,0x11,0x00,
+0x1f,0x60,0x3f,0xff,0xff,0xf3,0x7f,0xff,0xdd,0xe5,0x55,0x8f,0x23,0x8f,0xa7,0xf5,
+0x40,0x04,0xf2,0x01,0xf5,0x01,0x6f,0x70,0x4f,0x10,0x1f,0x50,0x00,0x6e,0x26,0xf1,
+0x01,0xfb,0xe2,0x01,0x9f,0xcf,0x02,0x9f,0xf7,0x28,0xfe,0x67,0xf0,0x6f,0x91,0x09,
+0xf8,0x00,0x9d,0x01,0x20,0x00,0x11,0x26,0x7e,0xa0,0xd7,0x05,0x24,0xff,0xd3,0xa9,
+0x00,0x20,0xe8,0x0a,0x05,0x01,0xf1,0x32,0x0e,0x80,0xad,0x4f,0x98,0xf2,0x27,0xfc,
+0x6a,0xd7,0xfb,0xaf,0x24,0xff,0xfe,0xaf,0xdf,0xee,0xf2,0x02,0xe9,0x2a,0xb0,0xf6,
+0x5f,0x20,0x0e,0x80,0xaf,0xef,0xff,0xf2,0x00,0xe8,0x14,0x57,0xfb,0x55,0x00,0x0e,
+0xee,0x34,0x6f,0xb4,0x41,0x3d,0xff,0x8c,0xff,0xff,0xff,0x52,0xf8,0x10,0x11,0x3f,
+0x91,0x10,0x01,0x00,0x47,0x78,0xfc,0x77,0x50,0xd2,0x04,0xf6,0x40,0xfb,0x26,0xaf,
+0x64,0x8f,0xff,0xfe,0x05,0xff,0xff,0xc8,0xe5,0x5b,0xe0,0x00,0x6f,0x00,0x8d,0x01,
+0x9e,0x09,0xef,0xfe,0xea,0xd2,0xff,0xa0,0x4d,0x96,0xea,0x9e,0x36,0x52,0x00,0xa9,
+0x2f,0x28,0xff,0xff,0xf2,0x5f,0xff,0xfc,0x8f,0xf4,0x9e,0x02,0x5a,0xf5,0x48,0xec,
+0x9d,0xa0,0x35,0xaf,0x55,0x9d,0x5f,0xf4,0x0a,0xff,0xff,0xfa,0xd0,0xff,0x10,0x00,
+0x6f,0x00,0x8e,0xbf,0xfe,0x30,0x06,0xf0,0x08,0xfd,0x32,0xb2,0x4e,0x01,0x70,0x03,
+0x00,0x00,0x00,0x4e,0x40,0x05,0xd6,0x05,0xf0,0x26,0xab,0x3b,0xf8,0xbf,0x93,0x00,
+0x95,0x7f,0xfe,0xaa,0xff,0xf8,0x09,0xf4,0x43,0x6d,0xc6,0x23,0x00,0x03,0x1c,0xff,
+0xff,0xff,0xc0,0x00,0x8b,0x2b,0x4c,0xb6,0xb2,0x00,0x3f,0x4a,0xe4,0xca,0x2f,0x80,
+0x0b,0x92,0xd3,0xef,0x60,0x5a,0x00,0x14,0x34,0x4d,0x83,0x33,0x10,0x00,0xcf,0x80,
+0x01,0x84,0x00,0x33,0x33,0x4f,0x93,0x33,0x32,0x2f,0x8b,0x07,0x01,0xd3,0x07,0xf0,
+0x2e,0x0d,0x80,0x0e,0x80,0x0e,0xa0,0x00,0xd8,0x02,0xae,0x26,0xf6,0x10,0x0d,0x80,
+0xef,0xff,0xff,0xf6,0x2c,0xfe,0x9e,0x94,0xf8,0x4f,0x62,0xcf,0xe9,0xef,0xef,0xfe,
+0xf6,0x00,0xd8,0x0e,0xb7,0xfa,0x8f,0x60,0x0d,0x80,0x88,0x88,0x88,0x83,0x00,0xdc,
+0xa5,0xff,0xff,0xfe,0x02,0xaf,0xfd,0x6f,0x65,0x5b,0xe0,0x2f,0xc5,0x05,0xb1,0x04,
+0x80,0x20,0x00,0x5f,0x65,0x5b,0xe0,0x00,0x00,0x0d,0x00,0x00,0x9f,0x06,0x14,0xf4,
+0xb9,0x07,0xf1,0x07,0xf2,0x04,0x44,0x48,0xf7,0x44,0x44,0x00,0x5e,0xee,0xff,0xfe,
+0xee,0x80,0x01,0x55,0x55,0x55,0x55,0x53,0x00,0x2f,0x23,0x07,0xd1,0x02,0xf9,0x47,
+0xf7,0x46,0xf5,0x00,0x3f,0x84,0x7f,0x74,0x6f,0x50,0x90,0x04,0x10,0xf5,0xa6,0x04,
+0x41,0x00,0x2a,0x40,0x3f,0xbe,0x06,0x2b,0x04,0xd1,0xd5,0x06,0x12,0x10,0x7f,0x07,
+0x32,0x30,0x00,0x00,0x49,0x08,0xf1,0x14,0x10,0x55,0x5e,0xd5,0xde,0x65,0x50,0x00,
+0xc9,0xdb,0x0c,0xdd,0xa0,0x00,0x8f,0x4d,0xb0,0xcd,0x4f,0xb0,0x09,0x60,0xdb,0x0b,
+0xc0,0x57,0x00,0x00,0x0b,0xf5,0x22,0x20,0x00,0x00,0x3c,0x61,0x05,0xf8,0x0c,0xbf,
+0xef,0x81,0x6f,0xc0,0x00,0x06,0x60,0x8f,0xdf,0xb1,0x00,0x02,0x69,0xcf,0xff,0xfe,
+0xb8,0x73,0x3f,0xec,0x83,0x03,0x9c,0xff,0x20,0x10,0x5f,0x00,0xb0,0x0b,0xb0,0x00,
+0x8f,0x10,0x00,0x00,0xfb,0x12,0x08,0xf1,0x55,0x07,0xf0,0x18,0xfc,0x8f,0x10,0x00,
+0x09,0xf5,0x5f,0xa8,0xf1,0x00,0x02,0xf9,0x03,0xf7,0x8f,0xe5,0x00,0xaf,0x95,0x8f,
+0x38,0xfd,0xf4,0x00,0x4a,0xff,0xd0,0x8f,0x2d,0xf3,0x00,0x0a,0xf6,0x08,0xf1,0x28,
+0x00,0x03,0xfe,0x34,0x00,0x90,0x04,0xef,0x30,0x08,0xf1,0x00,0x07,0xff,0x50,0x0d,
+0x00,0x21,0x1a,0x20,0x4c,0x07,0x04,0x01,0x00,0x30,0x01,0xdc,0x10,0x11,0x01,0x10,
+0xef,0x89,0x00,0xf0,0x1d,0x4d,0xfa,0x66,0x8f,0xd1,0x00,0x03,0xc5,0xd7,0x5f,0xe2,
+0x00,0x00,0x00,0x2b,0xff,0xd5,0x00,0x00,0x0a,0xef,0xfb,0x7e,0xf4,0x21,0x00,0x9a,
+0x62,0x7f,0xff,0xff,0xf2,0x00,0x17,0xef,0x83,0x38,0xf9,0x00,0x03,0xf9,0x7d,0x57,
+0xfd,0xef,0x01,0xe4,0xef,0xf9,0x00,0x01,0x68,0xae,0xff,0xc4,0x00,0x00,0x0e,0xfd,
+0xa6,0x10,0x02,0x01,0x00,0x1a,0x00,0x11,0xf6,0x07,0x00,0x21,0x4f,0x60,0x28,0x01,
+0x00,0x0c,0x08,0x61,0x88,0x88,0xbf,0xb8,0x88,0x83,0x18,0x01,0x00,0x29,0x03,0x21,
+0xcf,0xf1,0x2a,0x03,0x10,0xef,0x80,0x06,0x20,0x09,0xf4,0x27,0x08,0x40,0x04,0xfc,
+0x05,0xfc,0xa0,0x01,0xf6,0x02,0x20,0x09,0xfc,0x10,0x1b,0xfe,0x30,0x00,0x0a,0xff,
+0x50,0xaa,0x10,0x00,0x00,0x06,0xd1,0xac,0x03,0x00,0x55,0x00,0x81,0x06,0x77,0x8f,
+0xb7,0x77,0x20,0x00,0xcf,0x8e,0x01,0xf2,0x04,0x0c,0xb0,0x2f,0x70,0x5f,0x50,0x00,
+0xcb,0x02,0xf6,0x04,0xf5,0x00,0x0d,0xb0,0x4f,0x60,0x5f,0x50,0x38,0x02,0x50,0x91,
+0x77,0x77,0xff,0xfa,0x91,0x08,0x30,0x7f,0x9e,0xd1,0x33,0x09,0xf4,0x02,0xc0,0x4f,
+0xd3,0x00,0x18,0xef,0xb1,0x00,0x5f,0xfc,0x60,0xdb,0x50,0x00,0x00,0x19,0xe6,0x54,
+0x00,0x30,0x3b,0x42,0xf7,0x82,0x00,0x42,0xf3,0x2f,0x70,0x00,0xf2,0x08,0xf2,0x08,
+0xf6,0x00,0x9f,0xb9,0xaf,0xc9,0x99,0x40,0x0b,0xb0,0x03,0xf7,0x00,0x00,0x01,0x88,
+0x88,0xaf,0xb8,0x88,0x84,0x1f,0xff,0x46,0x0a,0x31,0x01,0xef,0xf6,0x1b,0x08,0xf0,
+0x2b,0x7d,0xe3,0x00,0x00,0x03,0xcf,0xa0,0x3f,0xf7,0x00,0x1c,0xff,0x80,0x00,0x3d,
+0xff,0x80,0xa9,0x20,0x00,0x00,0x06,0xc3,0x00,0x00,0x00,0x12,0x35,0x83,0x00,0x91,
+0xe8,0xef,0xed,0xba,0x70,0x0d,0x8e,0x87,0x67,0x90,0xad,0x00,0x8c,0xe8,0x7c,0x5e,
+0x4f,0x50,0x01,0x0e,0x85,0xb4,0x87,0xf4,0x10,0x18,0xf8,0xd5,0x06,0xf1,0x05,0x2f,
+0xef,0x81,0xe6,0x04,0xf2,0x00,0x60,0xe8,0x06,0x97,0xdf,0x10,0x00,0x08,0x54,0xf5,
+0x26,0x30,0x01,0x61,0x00,0xfa,0x06,0xf8,0x04,0x44,0x8f,0xff,0xb5,0x44,0x21,0x47,
+0xbf,0xd2,0x9f,0xd8,0x63,0x1f,0xeb,0x60,0x00,0x4a,0xef,0x50,0x63,0x02,0x11,0x03,
+0x04,0x01,0x62,0x66,0xbf,0x96,0x66,0x66,0x31,0xb0,0x04,0x41,0x00,0x08,0xf4,0x00,
+0x5d,0x08,0xf0,0x0b,0x4f,0xff,0xff,0x90,0x01,0xcf,0x21,0x66,0x8f,0xe3,0x01,0xdf,
+0xf0,0x00,0x0d,0xe2,0x00,0x5f,0xef,0x27,0x77,0xfc,0x77,0x50,0x49,0xf4,0xa0,0x0a,
+0x30,0x00,0x9f,0x00,0x35,0x06,0x50,0x09,0xf0,0x05,0x7f,0x80,0xbd,0x04,0x2d,0x9f,
+0xe3,0x94,0x09,0xa2,0x9c,0x00,0x00,0x00,0x28,0x88,0x8d,0xfa,0x88,0x86,0x3e,0x0a,
+0xf2,0x06,0xc0,0x3f,0x41,0x11,0x11,0x11,0xcc,0x02,0xa5,0xff,0xff,0xff,0x98,0x80,
+0x00,0x03,0x33,0x33,0x32,0x00,0x07,0xf6,0x09,0xb0,0x37,0x7a,0xfa,0x7f,0xc7,0x77,
+0x00,0x00,0x7f,0x20,0xf9,0x6f,0x08,0xfc,0x02,0xe0,0x0f,0x90,0x1c,0x22,0x7d,0xf5,
+0x00,0xed,0x69,0xf2,0x5f,0xb4,0x00,0x08,0xff,0xfa,0x5b,0x00,0xa3,0x4d,0x50,0x00,
+0x00,0x08,0x88,0x89,0xfd,0x88,0x88,0xae,0x09,0x30,0x0f,0x70,0x00,0xcc,0x09,0x10,
+0xb6,0xc2,0x00,0xb0,0xb0,0x00,0x07,0x78,0xfb,0x77,0x00,0x00,0x06,0xd3,0x1f,0x04,
+0x07,0x21,0xaf,0x21,0x3e,0x09,0x80,0xf7,0x1f,0xb6,0x66,0x00,0x04,0xfe,0xf7,0x9c,
+0x09,0xdb,0xde,0x1d,0xff,0xd9,0x88,0x84,0x4e,0x40,0x07,0xce,0xff,0xff,0x20,0x6f,
+0x03,0x43,0x5f,0x40,0x00,0x00,0xba,0x06,0xc4,0xfa,0x66,0x7a,0x76,0x6b,0xf0,0x0d,
+0x94,0x48,0xf7,0x44,0xbd,0x04,0x09,0xf4,0x04,0x35,0x58,0xf7,0x55,0x30,0x00,0x09,
+0xdd,0xef,0xed,0xda,0x00,0x05,0x55,0x5a,0xf7,0x55,0x55,0x12,0x88,0x08,0xf6,0x04,
+0xbf,0x9f,0x90,0x00,0x00,0x4a,0xff,0x50,0x5f,0xe9,0x51,0x1e,0xe8,0x10,0x00,0x3b,
+0xfe,0x10,0x10,0x57,0x00,0x01,0xbf,0x02,0x14,0x70,0x5b,0x00,0xf2,0x2e,0x40,0xfb,
+0x7a,0x76,0x68,0x69,0xf4,0x0d,0x69,0xf5,0x03,0xfa,0x5d,0x30,0x3c,0xf7,0x2e,0x74,
+0xee,0x30,0x04,0xd4,0x2d,0xff,0x72,0xc5,0x00,0x00,0x6e,0xd1,0x8f,0xb1,0x00,0x06,
+0xdf,0xe6,0x55,0xaf,0xfa,0x34,0xfe,0xff,0xff,0xff,0xfd,0xf6,0x03,0x3f,0x50,0x00,
+0x1f,0x81,0x00,0x03,0xf9,0x66,0x67,0xf8,0x00,0x00,0x3f,0x14,0x0b,0x20,0x89,0x00,
+0x8d,0x06,0xf0,0x27,0x06,0xf3,0x00,0x00,0x7f,0x10,0x8e,0xef,0xee,0x21,0x18,0xf3,
+0x04,0x88,0x8c,0xad,0xff,0xff,0xf5,0x05,0x11,0xf7,0x45,0x5a,0xf6,0x21,0xec,0x5f,
+0x34,0x60,0x7f,0x10,0x04,0xff,0xe0,0x8f,0x27,0xf1,0x00,0x07,0xfb,0x00,0xe9,0x7f,
+0x10,0x00,0x9f,0xf3,0x06,0x37,0xf1,0x00,0x5f,0xae,0xce,0x06,0xc7,0x7f,0xc0,0x67,
+0x03,0x9d,0xf0,0x05,0xb0,0x00,0x00,0x1f,0xf8,0xbe,0x03,0x12,0xf9,0x73,0x06,0x15,
+0x90,0x0d,0x00,0xf1,0x18,0x09,0xd2,0x1f,0x90,0xad,0x00,0x00,0xde,0x01,0xf9,0x07,
+0xf5,0x00,0x1f,0xa0,0x1f,0x90,0x1f,0xd0,0x07,0xf5,0x01,0xf9,0x00,0x9f,0x30,0xee,
+0x00,0x1f,0x90,0x04,0xf9,0x2c,0x60,0x01,0xf9,0x00,0x0f,0xc0,0x34,0x00,0x51,0x20,
+0x00,0x04,0x8a,0xf8,0x1a,0x0c,0x27,0xfc,0x20,0xae,0x01,0x12,0x07,0x1f,0x04,0x10,
+0x7f,0x0a,0x01,0xf0,0x10,0x7e,0x17,0xf1,0x0d,0x70,0x00,0x0e,0xb0,0x7f,0x10,0x9f,
+0x20,0x06,0xf4,0x07,0xf1,0x01,0xfa,0x01,0xfb,0x00,0x7f,0x10,0x08,0xf3,0x1a,0x20,
+0x07,0xf1,0x02,0x19,0x7f,0x07,0x11,0x13,0xef,0x01,0xfd,0x05,0x15,0xed,0x10,0x00,
+0x00,0x01,0x5c,0xfc,0x20,0x00,0x48,0xad,0xff,0xd6,0x00,0x00,0x04,0xfd,0xb7,0x20,
+0x63,0x02,0x04,0x7a,0x04,0x25,0xbe,0x00,0xa3,0x0c,0xa1,0x18,0x8a,0xfb,0x88,0x88,
+0x88,0x10,0x00,0x7f,0x20,0xba,0x0a,0x71,0xf5,0x55,0x55,0x55,0x00,0x03,0xfe,0x0a,
+0x0a,0xf7,0x0d,0x9f,0x21,0x1d,0xc1,0x11,0x00,0x3f,0x90,0x00,0xdb,0x00,0x00,0x1d,
+0xe1,0x00,0x0d,0xb0,0x00,0x08,0xf3,0x67,0x77,0xed,0x77,0x73,0x04,0x0c,0xff,0x70,
+0x07,0xc0,0x00,0xc7,0x00,0x0c,0xb0,0x00,0x05,0x6d,0xf6,0x68,0xfb,0x63,0xc4,0x03,
+0x00,0x08,0x03,0x71,0x55,0x5d,0xf5,0x55,0x50,0x00,0x3f,0x04,0x02,0x63,0x25,0x55,
+0xaf,0x85,0x55,0x55,0xb0,0x0c,0x81,0x01,0x1c,0xf7,0x44,0x44,0x41,0x00,0x0a,0xa0,
+0x05,0xf1,0x00,0x1c,0xfa,0x22,0x6f,0x72,0x20,0x07,0xfe,0x77,0x79,0xfa,0x77,0x71,
+0x05,0x6f,0x68,0x08,0xd2,0x00,0x89,0x03,0xf5,0x08,0xa1,0x00,0x29,0xf4,0x5f,0x73,
+0xfb,0x20,0xfe,0x01,0xf0,0x03,0x30,0xf8,0x55,0x55,0x55,0x57,0xf3,0x0f,0x6e,0xff,
+0xff,0xff,0x6f,0x30,0x00,0xeb,0x44,0x4a,0x63,0x08,0x60,0xcd,0xfe,0xcc,0x10,0x00,
+0x16,0x38,0x0e,0x22,0x30,0x02,0x8a,0x03,0xf4,0x03,0x2f,0x60,0x1f,0x80,0x1f,0x70,
+0x02,0xf6,0x01,0xf8,0x9e,0xf6,0x00,0x05,0x20,0x1f,0x83,0x75,0xa2,0x00,0x10,0x7f,
+0x21,0x00,0xf1,0x14,0xe0,0x03,0x78,0x78,0xfc,0x78,0x76,0x00,0x06,0xe1,0x1f,0x80,
+0x9e,0x20,0x00,0x3f,0x71,0xf8,0x0f,0xb0,0x00,0x00,0xc7,0x1f,0x83,0xd3,0x00,0x19,
+0x99,0x9a,0xfd,0x99,0x99,0x62,0xff,0xf5,0x0a,0x05,0x72,0x0e,0x01,0x0f,0x03,0x0a,
+0x0d,0x00,0x03,0xea,0x0d,0x33,0x0c,0xe0,0x00,0x8b,0x03,0xf0,0x01,0x60,0x8f,0x77,
+0xa8,0x77,0xa8,0x73,0x08,0xf3,0x4f,0x94,0x5f,0x94,0x10,0x8f,0xbf,0x18,0x05,0x90,
+0x09,0xf0,0x0f,0x81,0x3f,0x70,0x00,0x9f,0x00,0x95,0x00,0xf5,0x18,0x0a,0xd3,0x46,
+0x66,0x66,0x50,0x00,0xcc,0x8e,0xfe,0xee,0xff,0x60,0x0f,0x90,0x5f,0xb3,0x9f,0x90,
+0x03,0xf6,0x24,0xaf,0xff,0xd4,0x20,0x7f,0x2e,0xfd,0x97,0xbf,0xff,0x50,0x20,0x20,
+0x00,0x00,0x02,0x40,0xf8,0x0c,0x51,0x0b,0xe1,0x00,0x00,0x08,0x5b,0x00,0xf0,0x1a,
+0x70,0x8f,0x77,0x77,0x77,0x77,0x73,0x08,0xf0,0x57,0x0c,0x52,0x81,0x00,0x9f,0x0c,
 0xb0,0xf7,0x7f,0x00,0x09,0xe3,0xff,0x5f,0x8e,0xf6,0x00,0xae,0xdb,0x8d,0xff,0xe6,
-0xf5,0x0b,0xc3,0x32,0x3f,0x84,0x14,0x00,0xda,0x5f,0x4f,0x34,0x20,0x0f,0x81,0xb8,
+0xf5,0x0b,0xc3,0x32,0x3f,0x84,0x14,0x00,0xda,0xfd,0x08,0x30,0xd0,0x0f,0x81,0xb8,
 0x07,0x94,0x05,0xf4,0x55,0x55,0xfa,0x55,0x53,0x5d,0x2f,0xbe,0x07,0x04,0xb8,0x04,
-0xd1,0x76,0x07,0xff,0xf5,0x9c,0xef,0xff,0xc1,0x25,0xcf,0x08,0xa8,0xce,0xa6,0x11,
-0xf0,0x18,0x09,0xe0,0x00,0x06,0xf3,0x03,0x70,0x9e,0x00,0x00,0xdf,0x64,0x7e,0x09,
-0xfd,0xd4,0x3f,0xff,0xb7,0xe0,0x9f,0x99,0x30,0x50,0xe8,0x7e,0x09,0xe0,0x00,0x1f,
-0x9f,0x57,0xe0,0x9e,0x00,0x00,0x9f,0xf0,0x7f,0x1d,0x1f,0xfc,0x04,0xff,0x42,0x55,
-0x55,0x55,0x20,0xbf,0xef,0xda,0x97,0x77,0x75,0x5f,0x50,0x5b,0xde,0xff,0xff,0x60,
-0x5c,0x02,0x31,0xbe,0x3d,0x50,0xd7,0x22,0x13,0x9d,0x4b,0x05,0x71,0x08,0x88,0x88,
-0x8c,0xf9,0x88,0x40,0x44,0x37,0x00,0xd0,0x00,0x70,0xf6,0xf3,0x00,0x00,0x58,0xdf,
-0x88,0x92,0x06,0x21,0x09,0xe0,0x29,0x03,0xf0,0x29,0x9e,0x00,0x0d,0xd0,0x65,0x00,
-0x2b,0xfb,0xe6,0x8f,0x39,0xc0,0xef,0xff,0xc8,0x22,0xfe,0xe9,0x06,0x63,0x00,0x00,
-0x05,0xed,0x20,0x0f,0xff,0xfe,0x2f,0xff,0xfe,0x00,0x55,0x5c,0xe1,0x55,0x5c,0xe0,
-0x05,0x77,0xde,0x07,0x77,0xde,0x00,0xbf,0xff,0xe0,0xff,0xff,0xe0,0x0c,0xb0,0x00,
-0x0f,0x70,0x4b,0x0d,0xf2,0x1a,0xe3,0xff,0xee,0xe1,0x09,0x86,0xbf,0x1a,0x76,0xbf,
-0x00,0xcf,0xa9,0xf1,0xff,0x88,0xf0,0x00,0x8e,0xee,0x01,0xad,0xef,0x03,0xdf,0xde,
-0xc4,0xef,0xdd,0xe0,0x1a,0x65,0xfa,0x19,0x63,0xdb,0x00,0x04,0xfe,0x30,0x0b,0x05,
-0x27,0x16,0x01,0x98,0x20,0xf6,0x3e,0xfb,0x3f,0xff,0xff,0xf4,0x05,0x5c,0xb3,0xf5,
-0x22,0x22,0x00,0x00,0xab,0x3f,0xff,0xff,0x90,0x06,0x6c,0xb3,0xfb,0xaa,0xa6,0x00,
-0xef,0xfb,0x3f,0xcb,0xbb,0x70,0x0e,0x60,0x06,0xf9,0x88,0x86,0x20,0xff,0xeb,0xff,
-0xff,0xee,0xe7,0x06,0x6d,0xb7,0xe2,0xf4,0x4a,0x00,0x00,0xba,0x7e,0x08,0xef,0xa1,
-0x00,0x0d,0x97,0xe1,0x3e,0xe3,0x00,0x68,0xf7,0xbf,0xf9,0x3f,0xf6,0x09,0xfd,0x1a,
-0xa4,0x00,0x2a,0x10,0xb2,0x03,0xd0,0x40,0x00,0x04,0xff,0xfe,0x04,0xf6,0x26,0x00,
-0x16,0x6b,0xe0,0xdb,0xde,0x08,0xf0,0x05,0x8e,0xaf,0xdd,0xff,0xe0,0x0b,0xbd,0xe8,
-0xec,0xea,0x7f,0x42,0xff,0xfe,0x00,0x0f,0x60,0x20,0x3f,0x20,0x8e,0x3d,0xf0,0x05,
-0x05,0xf7,0x77,0x8d,0x5f,0x99,0xf0,0x7f,0xff,0xf8,0xd5,0xf9,0x9f,0x00,0x11,0xae,
-0x8f,0xff,0xff,0xe0,0x00,0x50,0xf3,0x01,0xf6,0xba,0x00,0x46,0xfa,0x78,0x9f,0xde,
-0xf3,0x07,0xfe,0x3e,0xfd,0xca,0x9e,0x70,0xc3,0x3f,0xf0,0x07,0x10,0x1f,0x90,0x07,
-0x32,0xfa,0x01,0xf9,0x03,0xf9,0x08,0xf3,0x1f,0x90,0xaf,0x10,0x1d,0x51,0xf9,0x0d,
-0x70,0x08,0x15,0x19,0x12,0x50,0x0b,0x11,0x01,0xa6,0x23,0x13,0x9f,0xe2,0x33,0x21,
-0x88,0x8f,0xb7,0x25,0x11,0xeb,0x78,0x31,0x52,0xb3,0x99,0x99,0x99,0x99,0x9c,0x39,
-0x20,0x35,0x01,0x89,0x17,0xf0,0x06,0x2e,0xe1,0x06,0xec,0x6f,0xc4,0x5e,0xf2,0x00,
-0x0d,0x90,0xe9,0x3f,0xe3,0x00,0x00,0xd9,0x0e,0x90,0x61,0x04,0x0d,0x00,0xf0,0x0a,
-0x00,0x0a,0xf3,0x5f,0xff,0xff,0xfd,0x1a,0xf5,0x02,0x6e,0xb6,0xec,0x6e,0xf5,0x00,
-0x00,0xf6,0x0e,0x90,0x52,0x0a,0x50,0x2f,0x40,0x1a,0x00,0x70,0x07,0xf1,0x0e,0x90,
-0x2b,0xf5,0x02,0x11,0x05,0x7b,0xf5,0x00,0x2d,0x20,0x0e,0x94,0xb1,0x74,0x09,0xf0,
-0x3d,0xcf,0xee,0xff,0x70,0x1e,0xb0,0x0c,0xa0,0x00,0xf7,0x0b,0xf3,0x00,0xcf,0xee,
-0xef,0x8c,0xf5,0x00,0x0c,0xea,0xaa,0xf9,0xc4,0x00,0x01,0x66,0xaf,0x76,0x40,0x0b,
-0xe1,0x5f,0xff,0xff,0xfe,0x1b,0xf4,0x00,0x59,0x99,0x99,0x5f,0xe4,0x00,0x09,0xe5,
-0x58,0xf4,0x61,0x18,0x20,0x9f,0xff,0xff,0x40,0x0c,0xf2,0x07,0xb8,0xf7,0x90,0x1b,
-0xf4,0x02,0xfa,0x9f,0x4f,0x8f,0xf5,0x00,0x06,0x5e,0xa0,0x52,0xb2,0xdc,0x3d,0x20,
-0x20,0x06,0x3d,0x20,0x80,0xa0,0x77,0xaf,0x87,0x60,0x6f,0xb0,0x1f,0x4a,0x0a,0x20,
-0x83,0xe5,0x1c,0x45,0x20,0x01,0xde,0x75,0x1e,0xf1,0x01,0x81,0xdf,0x95,0x66,0x66,
-0xce,0x63,0xaf,0xf8,0x47,0x77,0x7c,0xf7,0x34,0x5e,0x8a,0x33,0x08,0xb0,0xe8,0x08,
-0xa0,0x0a,0xe0,0x00,0x0e,0x80,0x4f,0x70,0xae,0xa2,0x1e,0x95,0x76,0x6d,0xd0,0x00,
-0x0e,0x80,0x00,0x2f,0xe7,0xfb,0x25,0x30,0xe0,0x05,0xf6,0xe8,0x08,0xf0,0x02,0x06,
-0xf8,0x0a,0xb0,0x06,0xf6,0x45,0xff,0xde,0xf5,0x00,0x03,0x7f,0x57,0xaf,0xe7,0xd1,
-0x8d,0x4d,0xf9,0x23,0xc3,0x4f,0xb0,0x1e,0xf7,0x9f,0xff,0xff,0xef,0x48,0xff,0x72,
-0x4e,0xf4,0x33,0x92,0x04,0xf7,0x2c,0xff,0xff,0xf4,0x00,0x0f,0x7d,0xef,0x83,0xeb,
-0x00,0x00,0xf7,0x10,0x5f,0xfd,0x00,0x00,0x0f,0x86,0xbf,0xfd,0xfd,0x93,0x00,0xf7,
-0xcc,0x71,0x04,0xae,0x30,0x00,0x56,0x26,0x30,0xe1,0x5f,0x30,0x9a,0x26,0x00,0x12,
-0x05,0x30,0x36,0xf8,0x27,0xdd,0x04,0x30,0x16,0x6f,0xef,0x0a,0x0d,0xf4,0x25,0x1e,
-0xd0,0x8f,0x55,0x5f,0x80,0x1d,0xf8,0x07,0xfb,0xbb,0xf8,0x09,0xff,0x80,0x7f,0xbb,
-0xbf,0x80,0x25,0xe8,0x01,0xbf,0x65,0x51,0x00,0x0e,0x80,0x9f,0xfe,0xff,0x50,0x00,
-0xe8,0x8e,0xcd,0x6e,0xb0,0x00,0x0e,0x83,0x7a,0xff,0xf9,0x62,0x00,0xe8,0x8c,0x84,
-0x27,0xbd,0x20,0x9e,0x11,0xf0,0x11,0x60,0xbb,0x00,0xb7,0x00,0x0c,0xe4,0xbb,0xba,
-0x5f,0x60,0x08,0xe5,0x4b,0xbb,0xa7,0xfa,0x84,0x13,0xde,0xff,0xff,0xcf,0xcf,0x70,
-0x7f,0x54,0x44,0x4e,0xe4,0xf0,0x4f,0x6c,0x0d,0xfb,0x1a,0x7d,0x09,0xff,0x47,0x88,
-0x74,0xed,0xb0,0x16,0xf2,0xef,0xfe,0x0a,0xf6,0x00,0x3f,0x2f,0x54,0xf6,0x6f,0x10,
-0x03,0xf3,0xf3,0x8f,0xcd,0xf8,0x00,0x3f,0x9e,0x06,0x7c,0xd7,0xf6,0x03,0xf5,0x60,
-0x01,0xc1,0x08,0x30,0x02,0x06,0x02,0x16,0x04,0x30,0x8f,0xd3,0x08,0x84,0x37,0xf9,
-0x2c,0x5e,0xb2,0xfc,0x00,0x02,0x44,0xf6,0x21,0xbf,0x20,0x00,0x8f,0x4f,0x60,0x7f,
-0x86,0x00,0x0c,0xd3,0xf6,0x6f,0xb6,0xf5,0x01,0xf8,0x3f,0xbf,0xb0,0x0d,0xe0,0x7f,
-0x23,0xff,0xc0,0x00,0x6f,0x50,0x31,0xaf,0xc0,0x00,0x82,0xc4,0x06,0xef,0xf6,0x00,
-0x1f,0x70,0x05,0xfd,0x6f,0xd8,0x8b,0xf4,0x00,0x05,0x00,0x9f,0x66,0x08,0xc1,0x0c,
-0x80,0x00,0x00,0x04,0x77,0x77,0xdf,0x87,0x77,0x30,0x8f,0xe8,0x0d,0x50,0x08,0xf0,
-0x00,0xb8,0x10,0x63,0x08,0xfc,0x21,0x09,0xfe,0x40,0x00,0x08,0xf0,0x03,0x64,0xe5,
+0xf0,0x47,0x76,0x07,0xff,0xf5,0x9c,0xef,0xff,0xc1,0x25,0xcf,0x08,0xa8,0xce,0x00,
+0x00,0x0f,0x90,0x00,0x09,0xe0,0x00,0x06,0xf3,0x03,0x70,0x9e,0x00,0x00,0xdf,0x64,
+0x7e,0x09,0xfd,0xd4,0x3f,0xff,0xb7,0xe0,0x9f,0x99,0x30,0x50,0xe8,0x7e,0x09,0xe0,
+0x00,0x1f,0x9f,0x57,0xe0,0x9e,0x00,0x00,0x9f,0xf0,0x7f,0xff,0xff,0xf7,0x02,0xff,
+0x42,0x55,0x55,0x55,0x20,0xbf,0xef,0xda,0x97,0x77,0x75,0x5f,0x50,0x5b,0xde,0xff,
+0xff,0x60,0x20,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0xb0,0xbe,0x3d,0x50,
+0x00,0x00,0x00,0x0b,0xf0,0x9d,0x01,0xff,0x01,0x00,0xf0,0x7b,0xf8,0x08,0x88,0x88,
+0x8c,0xf9,0x88,0x40,0x00,0x00,0x00,0x8f,0x20,0x00,0x08,0xff,0xff,0xf6,0xf3,0x00,
+0x00,0x58,0xdf,0x88,0x4f,0x60,0x00,0x00,0x09,0xe0,0x01,0xf9,0x00,0x00,0x00,0x9e,
+0x00,0x0d,0xd0,0x65,0x00,0x2b,0xfb,0xe6,0x8f,0x39,0xc0,0xef,0xff,0xc8,0x22,0xfe,
+0xe9,0x06,0x63,0x00,0x00,0x05,0xed,0x20,0x0f,0xff,0xfe,0x2f,0xff,0xfe,0x00,0x55,
+0x5c,0xe1,0x55,0x5c,0xe0,0x05,0x77,0xde,0x07,0x77,0xde,0x00,0xbf,0xff,0xe0,0xff,
+0xff,0xe0,0x0c,0xb0,0x00,0x0f,0x70,0x00,0x00,0xdf,0xee,0xe3,0xff,0xee,0xe1,0x09,
+0x86,0xbf,0x1a,0x76,0xbf,0x00,0xcf,0xa9,0xf1,0xff,0x88,0xf0,0x00,0x8e,0xee,0x01,
+0xad,0xef,0x03,0xdf,0xde,0xc4,0xef,0xdd,0xe0,0x1a,0x65,0xfa,0x19,0x63,0xdb,0x00,
+0x04,0xfe,0x30,0x0b,0xff,0x50,0x9d,0x00,0x14,0x01,0xa6,0x00,0xf5,0x40,0x01,0xff,
+0xfb,0x3f,0xff,0xff,0xf4,0x05,0x5c,0xb3,0xf5,0x22,0x22,0x00,0x00,0xab,0x3f,0xff,
+0xff,0x90,0x06,0x6c,0xb3,0xfb,0xaa,0xa6,0x00,0xef,0xfb,0x3f,0xcb,0xbb,0x70,0x0e,
+0x60,0x06,0xf9,0x88,0x86,0x20,0xff,0xeb,0xff,0xff,0xee,0xe7,0x06,0x6d,0xb7,0xe2,
+0xf4,0x4a,0x00,0x00,0xba,0x7e,0x08,0xef,0xa1,0x00,0x0d,0x97,0xe1,0x3e,0xe3,0x00,
+0x68,0xf7,0xbf,0xf9,0x3f,0xf6,0x09,0xfd,0x1a,0xa4,0x00,0x2a,0x10,0xfe,0x00,0xf2,
+0x43,0x07,0x40,0x00,0x04,0xff,0xfe,0x04,0xf6,0x26,0x00,0x16,0x6b,0xe0,0xdb,0x05,
+0xf4,0x00,0x00,0x8e,0xaf,0xdd,0xff,0xe0,0x0b,0xbd,0xe8,0xec,0xea,0x7f,0x42,0xff,
+0xfe,0x00,0x0f,0x60,0x20,0x3f,0x20,0x08,0xff,0xff,0xfe,0x05,0xf7,0x77,0x8d,0x5f,
+0x99,0xf0,0x7f,0xff,0xf8,0xd5,0xf9,0x9f,0x00,0x11,0xae,0x8f,0xff,0xff,0xe0,0x00,
+0x0b,0xc0,0x00,0xf6,0xba,0x00,0x46,0xfa,0x78,0x9f,0xde,0xf3,0x07,0xfe,0x3e,0xfd,
+0xca,0x9e,0x70,0x58,0x00,0xf0,0x0d,0x04,0x10,0x1f,0x90,0x07,0x32,0xfa,0x01,0xf9,
+0x03,0xf9,0x08,0xf3,0x1f,0x90,0xaf,0x10,0x1d,0x51,0xf9,0x0d,0x70,0x08,0x88,0x9f,
+0xc8,0x88,0x50,0x67,0x01,0x10,0xfb,0x25,0x00,0x30,0x0f,0xb0,0x9f,0x0b,0x00,0x60,
+0x05,0x88,0x88,0x88,0x8f,0xb0,0x11,0x00,0x20,0xeb,0x5f,0x1c,0x00,0x61,0xb3,0x99,
+0x99,0x99,0x99,0xfb,0x47,0x00,0x10,0x35,0x95,0x01,0xf0,0x07,0xa0,0x2e,0xe1,0x06,
+0xec,0x6f,0xc4,0x5e,0xf2,0x00,0x0d,0x90,0xe9,0x3f,0xe3,0x00,0x00,0xd9,0x0e,0x90,
+0x61,0x04,0x0d,0x00,0xf0,0x0a,0x00,0x0a,0xf3,0x5f,0xff,0xff,0xfd,0x1a,0xf5,0x02,
+0x6e,0xb6,0xec,0x6e,0xf5,0x00,0x00,0xf6,0x0e,0x90,0x52,0x0a,0x50,0x2f,0x40,0x1a,
+0x00,0xf8,0x04,0x07,0xf1,0x0e,0x90,0x2b,0xf5,0x02,0xfb,0x00,0xe9,0x7f,0xf5,0x00,
+0x2d,0x20,0x0e,0x94,0xb1,0x00,0x01,0x00,0xf4,0x8e,0x10,0x00,0xcf,0xee,0xff,0x70,
+0x1e,0xb0,0x0c,0xa0,0x00,0xf7,0x0b,0xf3,0x00,0xcf,0xee,0xef,0x8c,0xf5,0x00,0x0c,
+0xea,0xaa,0xf9,0xc4,0x00,0x01,0x66,0xaf,0x76,0x40,0x0b,0xe1,0x5f,0xff,0xff,0xfe,
+0x1b,0xf4,0x00,0x59,0x99,0x99,0x5f,0xe4,0x00,0x09,0xe5,0x58,0xf4,0x61,0x18,0x20,
+0x9f,0xff,0xff,0x40,0x0c,0xf2,0x07,0xb8,0xf7,0x90,0x1b,0xf4,0x02,0xfa,0x9f,0x4f,
+0x8f,0xf5,0x00,0x06,0x5e,0xa0,0x52,0xb2,0x00,0x00,0x00,0x6c,0x20,0x06,0xf1,0x00,
+0x00,0x5f,0xa0,0x77,0xaf,0x87,0x60,0x6f,0xb0,0x1f,0xff,0xff,0xfe,0x02,0x83,0xe5,
+0x00,0x6f,0x10,0x00,0x01,0xde,0xdf,0xff,0xff,0xff,0x81,0xdf,0x95,0x66,0x66,0xce,
+0x63,0xaf,0xf8,0x47,0x77,0x7c,0xf7,0x34,0x5e,0x8a,0xff,0xff,0xff,0xf6,0x00,0xe8,
+0x08,0xa0,0x0a,0xe0,0x00,0x0e,0x80,0x4f,0x70,0xae,0x00,0x00,0xe8,0x00,0x76,0x6d,
+0xd0,0x00,0x0e,0x80,0x00,0x2f,0xe7,0xa5,0x00,0xf9,0x3f,0x0a,0xe0,0x05,0xf6,0x00,
+0x00,0x09,0xf4,0x06,0xf8,0x0a,0xb0,0x06,0xf6,0x45,0xff,0xde,0xf5,0x00,0x03,0x7f,
+0x57,0xaf,0xe7,0xd1,0x00,0x2f,0xc0,0x8f,0xc3,0x4f,0xb0,0x1e,0xf7,0x9f,0xff,0xff,
+0xef,0x48,0xff,0x72,0x4e,0xf4,0x33,0x92,0x04,0xf7,0x2c,0xff,0xff,0xf4,0x00,0x0f,
+0x7d,0xef,0x83,0xeb,0x00,0x00,0xf7,0x10,0x5f,0xfd,0x00,0x00,0x0f,0x86,0xbf,0xfd,
+0xfd,0x93,0x00,0xf7,0xcc,0x71,0x04,0xae,0x30,0x00,0x01,0xf3,0x3f,0x0a,0xe1,0x5f,
+0x30,0x00,0x00,0x08,0xf6,0x0c,0xff,0xff,0xff,0x36,0xf8,0x27,0xf7,0x44,0x44,0x41,
+0x16,0x6f,0xef,0xff,0xff,0xf8,0x00,0x1e,0xd0,0x8f,0x55,0x5f,0x80,0x1d,0xf8,0x07,
+0xfb,0xbb,0xf8,0x09,0xff,0x80,0x7f,0xbb,0xbf,0x80,0x25,0xe8,0x01,0xbf,0x65,0x51,
+0x00,0x0e,0x80,0x9f,0xfe,0xff,0x50,0x00,0xe8,0x8e,0xcd,0x6e,0xb0,0x00,0x0e,0x83,
+0x7a,0xff,0xf9,0x62,0x00,0xe8,0x8c,0x84,0x27,0xbd,0x20,0x55,0x00,0xfa,0x3e,0x1e,
+0x60,0xbb,0x00,0xb7,0x00,0x0c,0xe4,0xbb,0xba,0x5f,0x60,0x08,0xe5,0x4b,0xbb,0xa7,
+0xfa,0x84,0x13,0xde,0xff,0xff,0xcf,0xcf,0x70,0x7f,0x54,0x44,0x4e,0xe4,0xf0,0x4f,
+0xf7,0xff,0xff,0xff,0x7d,0x09,0xff,0x47,0x88,0x74,0xed,0xb0,0x16,0xf2,0xef,0xfe,
+0x0a,0xf6,0x00,0x3f,0x2f,0x54,0xf6,0x6f,0x10,0x03,0xf3,0xf3,0x8f,0xcd,0xf8,0x00,
+0x3f,0x9e,0x06,0x7c,0xd7,0xf6,0x03,0xf5,0x60,0x01,0xc1,0x08,0xb0,0x00,0x31,0x00,
+0x08,0x90,0x07,0x00,0xf7,0x35,0x8f,0xd3,0x08,0xf3,0x00,0x00,0x01,0x5e,0xb2,0xfc,
+0x00,0x02,0x44,0xf6,0x21,0xbf,0x20,0x00,0x8f,0x4f,0x60,0x7f,0x86,0x00,0x0c,0xd3,
+0xf6,0x6f,0xb6,0xf5,0x01,0xf8,0x3f,0xbf,0xb0,0x0d,0xe0,0x7f,0x23,0xff,0xc0,0x00,
+0x6f,0x50,0x31,0xaf,0xc0,0x00,0x82,0xc4,0x06,0xef,0xf6,0x00,0x1f,0x70,0x05,0xfd,
+0x6f,0xd8,0x8b,0xf4,0x00,0x05,0x00,0x9f,0xff,0xfa,0x56,0x00,0xd0,0x0c,0x80,0x00,
+0x00,0x04,0x77,0x77,0xdf,0x87,0x77,0x30,0x8f,0xff,0x94,0x01,0xfb,0x2b,0x08,0xf0,
+0x00,0xb8,0x10,0x00,0x00,0x8f,0x00,0x09,0xfe,0x40,0x00,0x08,0xf0,0x03,0x64,0xe5,
 0x00,0x00,0x9f,0x14,0x7f,0x10,0x19,0x20,0x0a,0xe6,0xf7,0xf1,0x01,0xfa,0x00,0xcc,
 0x8d,0x7f,0x10,0x49,0xf1,0x0f,0x9d,0xa7,0xf1,0x0f,0xaf,0x65,0xf6,0xd5,0x6f,0x76,
-0xf5,0xe7,0x5e,0x00,0x02,0xdf,0xfc,0xb2,0x06,0x30,0x4f,0x91,0x11,0x29,0x11,0x02,
-0x2d,0x3b,0x40,0xd3,0x22,0xde,0x10,0x63,0x29,0x00,0x35,0x03,0x50,0x03,0x55,0x55,
-0x55,0xbe,0xea,0x24,0x00,0x0d,0x00,0x12,0x04,0x0d,0x00,0x11,0xcf,0x0d,0x00,0xf1,
-0x0d,0x11,0x34,0x5f,0x50,0x07,0x60,0x0a,0xea,0xe0,0xbf,0x25,0xbe,0x12,0xf8,0x9f,
-0x66,0x89,0xf6,0xf7,0x19,0x14,0xdf,0xff,0xfa,0x07,0x20,0x01,0xf4,0x39,0x22,0x20,
-0x1f,0x49,0x7a,0x0c,0xf0,0x0e,0x03,0xfe,0x66,0x6b,0xf6,0x66,0x04,0xef,0xcc,0xbb,
-0xef,0xbb,0x90,0x6d,0xf5,0xbb,0xbd,0xfb,0xbb,0x69,0xaf,0x45,0x88,0x88,0x88,0x73,
-0x24,0xf4,0x1f,0xb3,0x09,0xe0,0x1f,0x41,0xfa,0x77,0x7e,0xa0,0x01,0xf4,0x1f,0xa7,
-0x77,0xea,0x00,0x1f,0x3c,0x1d,0x00,0x0d,0x00,0x20,0x61,0x36,0x0d,0x00,0xf0,0x42,
-0xf4,0x01,0xfe,0x50,0x00,0x3f,0x40,0x6f,0xff,0xfe,0x00,0x25,0xf6,0x26,0xf3,0x3a,
-0xe0,0x5f,0xff,0xff,0x7f,0xaa,0xde,0x00,0x2b,0xf6,0x26,0xfd,0xde,0xe0,0x03,0xff,
-0xf6,0x6f,0x44,0xae,0x01,0xde,0xfb,0xf8,0xfd,0xde,0xe0,0x6e,0x4f,0x43,0x6f,0x65,
-0xbe,0x00,0x12,0xc3,0x09,0xdd,0xdd,0xc0,0x07,0x75,0x86,0xf7,0x01,0xd7,0x00,0xea,
-0x9e,0x08,0xa5,0x8c,0xf1,0x5f,0x48,0xf6,0x66,0xce,0x3f,0x60,0x50,0x3d,0xff,0xff,
-0x60,0x83,0x0b,0x14,0xc3,0xab,0x06,0xf1,0x00,0x70,0x01,0x29,0xe3,0x23,0xfa,0x21,
-0x01,0xbb,0xdf,0xcb,0xcf,0xdb,0xb1,0x1b,0x45,0x26,0x22,0x10,0x07,0x4a,0x26,0xf4,
-0x1d,0xae,0x66,0x66,0x6e,0xb0,0x00,0x0a,0xfb,0xbb,0xbb,0xfb,0x00,0x00,0xaf,0xbb,
-0xbb,0xbf,0xb0,0x00,0x03,0x33,0xbf,0x63,0x36,0x00,0x04,0xf7,0xf6,0xcd,0x24,0xf5,
-0x01,0xdc,0x4f,0x74,0x5d,0x8a,0xe0,0x19,0x21,0xcf,0xff,0xe3,0x26,0x4e,0x09,0xf6,
-0x3e,0x0d,0xc3,0x20,0xf6,0x39,0x20,0x2d,0xe3,0xcd,0x1f,0xfe,0x93,0x07,0xff,0xfe,
-0xf9,0xf8,0x07,0x80,0x0b,0xbb,0xbc,0x2a,0xff,0xe7,0x00,0xe8,0x15,0xf2,0xe5,0x02,
-0x00,0x0e,0xed,0xef,0x2f,0xaa,0xf8,0x00,0xec,0xab,0xf2,0xfb,0x55,0x60,0x0e,0x72,
-0xcf,0x1e,0xed,0xfb,0x00,0x62,0x05,0x7d,0x25,0x68,0x30,0x0e,0x6e,0x91,0xf6,0x52,
-0xf9,0x08,0xf2,0xeb,0x35,0x4e,0x6a,0xf0,0x26,0x07,0xff,0xff,0xd1,0x36,0x9c,0x01,
-0x31,0x04,0xf6,0xd9,0xa3,0x01,0x42,0x66,0xf7,0x00,0x8f,0x8d,0x26,0x10,0xf8,0x1f,
-0x0c,0x60,0x30,0x8f,0x32,0x21,0xf9,0x0b,0x47,0x47,0xfa,0x1b,0x4e,0xb5,0xf5,0x00,
-0x9f,0x47,0xf3,0xce,0xce,0x00,0x0a,0xf0,0x4f,0x38,0xff,0x60,0x00,0xbd,0x28,0xf2,
-0x6f,0xc0,0x71,0x0f,0xbc,0xfd,0x5f,0xfc,0x0d,0x75,0xf7,0x23,0x8f,0xe9,0xfc,0xf4,
-0x4e,0x10,0x04,0xc1,0x08,0xeb,0x13,0x25,0x00,0xa6,0x15,0x11,0xdc,0x39,0x1d,0x50,
-0xc9,0x61,0x00,0x05,0x43,0xe0,0x29,0x61,0x01,0x55,0x56,0xfb,0x55,0x55,0x96,0x1b,
-0x00,0xe3,0x01,0xc2,0x13,0xf9,0x11,0x11,0x01,0x77,0x77,0x8f,0xc7,0x77,0x75,0x3f,
-0x68,0x1c,0x05,0x86,0x09,0x25,0xf8,0x00,0x6d,0x25,0x27,0x06,0xff,0x1e,0x0f,0x10,
-0xf8,0x44,0x0e,0xf4,0x39,0x01,0x2f,0x92,0x6f,0x87,0x7c,0xf0,0xaf,0xff,0xf7,0xf2,
-0x00,0x9f,0x06,0xaf,0xda,0x6f,0x20,0x09,0xf0,0x00,0xf8,0x06,0xf4,0x22,0xaf,0x00,
-0x0f,0x94,0x7f,0xff,0xff,0xf0,0x7b,0xff,0xfa,0xf5,0xde,0x44,0x09,0xcf,0xa2,0x9e,
-0x08,0xf2,0x00,0x00,0xf8,0x0d,0xc0,0x3f,0x80,0x00,0x0f,0x82,0xf8,0x00,0xcf,0x20,
-0x36,0xf7,0xcf,0x20,0x03,0xfe,0x45,0xfd,0x28,0x70,0x00,0x04,0xc1,0x55,0x00,0x20,
-0xca,0x0a,0xaf,0x01,0xf3,0x04,0x1d,0xb1,0xae,0x6f,0xb7,0xf7,0x3f,0xff,0xea,0xc0,
-0xe8,0x1f,0x73,0xef,0xfd,0xae,0x7f,0xb7,0xf7,0x1a,0x00,0xf0,0x06,0x0c,0xb2,0xac,
-0x0e,0x81,0xf7,0x16,0xef,0xda,0xe7,0xfb,0x7f,0x71,0xdf,0xd5,0x6a,0xff,0xfe,0x94,
-0x00,0xca,0xa5,0x04,0x30,0x00,0x0c,0xa0,0xa5,0x04,0x21,0x05,0xea,0x0d,0x00,0x20,
-0xde,0x50,0x0d,0x00,0x13,0x00,0xfb,0x39,0x11,0xda,0x6d,0x10,0xb0,0x0d,0xa0,0xaf,
-0x77,0x77,0x71,0x6f,0xff,0xea,0xe0,0x00,0x33,0x1f,0x10,0xaf,0x89,0x21,0x20,0xda,
-0x0a,0x5b,0x04,0xf0,0x01,0x0d,0xc6,0xae,0x00,0x0e,0x80,0x4b,0xff,0xfb,0xe1,0x11,
-0xe8,0x05,0xdf,0xb0,0xaf,0xe1,0x0a,0x90,0xda,0x0a,0xf5,0x55,0x52,0x00,0x0d,0xa0,
-0xae,0x78,0x1e,0x11,0xea,0x7c,0x00,0x6a,0xfe,0x40,0x68,0x88,0x88,0x84,0x5a,0x01,
-0xf0,0x00,0x5f,0x00,0x00,0x5e,0x10,0x00,0x05,0xf0,0x04,0x47,0xf9,0x44,0x15,0xaf,
-0x85,0xaf,0x08,0xf2,0x2b,0xaf,0xff,0x7f,0x62,0x65,0x22,0x00,0x5f,0x03,0xf4,0x0d,
-0xc0,0x00,0x05,0xf5,0x5f,0x41,0xf7,0x00,0x06,0xcf,0xf9,0xf3,0x6f,0x20,0x00,0xbe,
-0xf3,0x6f,0x1b,0xd5,0xf1,0x00,0x5f,0x09,0xf2,0xf7,0x0f,0x70,0x05,0xf1,0xdb,0x9f,
-0x11,0xad,0x03,0xaf,0x5f,0x7f,0xff,0xff,0xf3,0x5f,0x93,0xb0,0x99,0x65,0x3d,0x1d,
-0x0d,0x00,0x48,0x56,0xf1,0x0a,0x04,0xf2,0x00,0x00,0x3f,0x20,0x77,0x9f,0x87,0x50,
-0x59,0xf9,0x2e,0xff,0xff,0xfb,0x0a,0xef,0xe3,0x00,0x4f,0x20,0x00,0x03,0xf2,0xc3,
-0x14,0xf1,0x00,0x3f,0x65,0x66,0x66,0xce,0x62,0x6b,0xff,0x87,0x77,0x7c,0xe7,0x2b,
-0xef,0x56,0xcf,0x3a,0xfb,0x09,0xf2,0x05,0xc0,0x09,0xd0,0x00,0x3f,0x20,0x2f,0x90,
-0x9d,0x00,0x39,0xf2,0x00,0x67,0x5c,0xd0,0x04,0xfb,0x00,0x00,0x1f,0xf7,0xff,0x03,
-0xf0,0x00,0x0b,0xc0,0xcf,0xff,0xfc,0x90,0x01,0xbc,0x12,0x32,0xf8,0x00,0x03,0xff,
-0xfd,0x4b,0x0d,0xf0,0x01,0x2c,0xff,0xac,0xcc,0xfe,0xcc,0x80,0x0b,0xc0,0x34,0x4f,
-0xa4,0x41,0x00,0xbc,0x1b,0x75,0x25,0xf0,0x00,0x7e,0xfd,0xbc,0x4f,0xa5,0xf6,0x4f,
-0xfe,0x3b,0xfe,0xff,0xef,0x60,0x1b,0xc0,0x0d,0x00,0x30,0x00,0xbc,0x0b,0xa0,0x09,
-0xa0,0x7e,0xc0,0x54,0x0f,0x70,0x52,0x0d,0xe6,0x00,0x00,0x8e,0x3f,0x20,0xf0,0x00,
-0x1f,0x18,0x20,0x6f,0x03,0x45,0x02,0xf0,0x01,0x7c,0xfa,0x27,0xf6,0x5c,0xb5,0x08,
-0xef,0xc1,0x0e,0x61,0xf6,0x00,0x06,0xf0,0x9f,0x6a,0x0a,0xf1,0x00,0x6f,0x63,0x56,
-0xf9,0x55,0x51,0x6d,0xff,0x65,0x8f,0x85,0x55,0x1b,0xef,0x4c,0xee,0x3b,0xf5,0x09,
-0xf0,0x09,0xf3,0x0e,0xa0,0x00,0x6f,0x00,0x9e,0xfd,0xf2,0x00,0x3a,0xf0,0x46,0xaf,
-0xff,0xd5,0x06,0xf9,0x0b,0xda,0x50,0x3b,0x5f,0x09,0xf0,0x34,0xd9,0x00,0x6b,0x3c,
-0x10,0x00,0x0d,0x90,0x0d,0xb1,0xe7,0x00,0x3c,0xfe,0xb4,0xff,0xff,0xff,0x33,0xaf,
-0xda,0xdf,0xa8,0xfa,0x71,0x00,0xda,0xaf,0xf7,0x4f,0x83,0x00,0x0d,0xbd,0xbf,0xff,
-0xff,0xf1,0x2a,0xff,0xd2,0xf7,0x3f,0x72,0x04,0xff,0xc2,0x2f,0xa7,0xfa,0x70,0x01,
-0xd9,0x02,0xff,0xef,0xfe,0x00,0x0d,0x90,0x2f,0x62,0xf6,0x10,0x08,0xf9,0x02,0xa4,
-0x0c,0x64,0xde,0x40,0x2f,0x95,0x55,0x52,0x5b,0x03,0xe0,0xf1,0x06,0xc0,0x05,0xe2,
-0x00,0x4f,0x10,0x1f,0x60,0xdb,0x00,0x7c,0xfb,0xd9,0x04,0xf3,0x2b,0x68,0xef,0xd5,
-0x66,0x66,0x66,0x62,0x04,0xf1,0x6b,0xbb,0x13,0x4d,0x00,0x4f,0x48,0xea,0xf5,0xf4,
-0xf0,0x5b,0xff,0xad,0x8f,0x5f,0x4f,0x09,0xef,0x58,0xd9,0xf5,0xf4,0xf0,0x04,0xf1,
-0x8d,0x9f,0x5f,0x4f,0x00,0x4f,0x18,0xd9,0xf4,0xb4,0xf0,0x39,0xf1,0x8a,0x6f,0x13,
-0x8f,0x05,0xfa,0x08,0xab,0xa0,0x7f,0x1b,0x20,0x00,0xcf,0x49,0x20,0xad,0x00,0xd0,
-0x49,0xd0,0x3f,0xff,0xf6,0x00,0x5b,0xfa,0x3e,0xb2,0x9e,0x10,0x06,0xdf,0xcb,0x0c,
-0x01,0xf0,0x0e,0x04,0xf0,0x1f,0x79,0x78,0x8e,0x00,0x4f,0x70,0xe7,0xf3,0xe6,0xe0,
-0x6d,0xff,0x1e,0xe9,0x1a,0xce,0x08,0xdf,0x20,0xe5,0x5f,0x36,0xe0,0x04,0xf0,0xcf,
-0x5e,0x03,0xf4,0x04,0x4f,0x02,0x34,0xff,0xd4,0x32,0x2a,0xf0,0x27,0xed,0x2c,0xd7,
-0x23,0xfa,0x0e,0xe8,0x10,0x07,0xd7,0x5b,0x0a,0x20,0xf1,0x04,0x57,0x12,0xf0,0x21,
-0x3f,0x10,0x4f,0x11,0x7c,0x00,0x9e,0xfd,0x14,0xfe,0xee,0xc0,0x09,0xef,0xd1,0x27,
-0x76,0x75,0x00,0x03,0xf1,0x7f,0xff,0x6f,0xff,0x00,0x3f,0x77,0xa4,0xf6,0xd4,0xf0,
-0x6c,0xff,0x9f,0xff,0x7f,0xff,0x09,0xef,0x22,0x33,0x9f,0x53,0x30,0x03,0xf1,0xaf,
-0x6e,0x01,0xf5,0x04,0x3f,0x10,0x2c,0xff,0xf7,0x00,0x18,0xf4,0xaf,0xd9,0xf8,0xfc,
-0x21,0xfb,0x1c,0x60,0x7f,0x23,0xa0,0xef,0x3d,0x30,0x00,0x04,0x50,0x12,0x10,0x70,
-0xe0,0xbf,0x00,0x00,0x0e,0xa3,0xae,0x93,0x3e,0xf0,0x17,0xe9,0x19,0xe3,0xff,0xff,
-0xf8,0x0e,0xff,0xfe,0xaf,0xdc,0xfe,0x60,0xe8,0x09,0xff,0xf6,0x3f,0x70,0x0e,0xff,
-0xff,0xfe,0xb7,0xf3,0x00,0xea,0x3a,0xe2,0x8f,0xcf,0x00,0x0e,0xa4,0xbe,0x02,0xff,
-0x90,0x34,0x00,0xf0,0x09,0x0e,0xf4,0x00,0x05,0xc3,0xc3,0x07,0xff,0xc0,0x01,0xec,
-0x0b,0xeb,0xfc,0x9f,0xd3,0x7f,0x20,0x28,0xf9,0x00,0x8f,0x40,0x10,0x09,0x0a,0xf6,
-0x40,0x10,0x08,0x2f,0x78,0x52,0xd3,0x00,0x00,0xc9,0xf9,0xf4,0x5f,0x20,0x00,0x3c,
-0xaf,0xcc,0x88,0xf7,0x77,0x34,0xae,0xff,0xc9,0xcf,0xff,0xf6,0x19,0xff,0xdf,0x7f,
-0xe0,0xf7,0x05,0xd3,0xc6,0x4b,0xff,0x5f,0x40,0x05,0x9e,0x54,0x76,0xed,0xf1,0x02,
-0xff,0xff,0xf6,0x09,0xfb,0x00,0x08,0xf2,0x8e,0x10,0x6f,0x80,0x00,0x5d,0xff,0x60,
-0x2e,0xff,0x20,0x16,0xdf,0xec,0x6f,0xd2,0xee,0x45,0xfa,0x20,0x2d,0xb1,0x02,0xd3,
-0xb1,0x0e,0x12,0x11,0x75,0x22,0x02,0x16,0x02,0x15,0xed,0x99,0x1a,0xc0,0x18,0x9f,
-0xd8,0x88,0xaf,0xc8,0x50,0x00,0xae,0x00,0x08,0xf3,0x3d,0x23,0x30,0x01,0xec,0x00,
-0x90,0x44,0x21,0xbf,0x30,0x28,0x18,0x11,0x70,0xfa,0x39,0x10,0xf7,0xbf,0x36,0xd1,
-0xff,0x9c,0xfd,0x50,0x02,0xcf,0xfc,0x30,0x07,0xff,0xf8,0x0b,0x93,0x09,0x09,0x02,
-0x12,0x0c,0x00,0x07,0x1b,0xf1,0x06,0x04,0x8d,0xc0,0x1e,0xef,0xfe,0xbb,0xfc,0x83,
-0x00,0x7e,0x58,0xe4,0xbb,0x00,0x00,0x02,0xf2,0x9c,0x0b,0xb0,0x68,0x1c,0xf2,0x21,
-0xbf,0xdd,0xd7,0x14,0x4d,0xb4,0x4b,0xea,0xfd,0x51,0x55,0xeb,0x54,0xba,0x0f,0x80,
-0x3e,0xef,0xfe,0xac,0x90,0xf8,0x00,0x66,0xca,0xa1,0xe8,0x0f,0x80,0x1f,0x6c,0x9c,
-0xaf,0x60,0xf8,0x01,0x93,0xd9,0x39,0xf2,0x0f,0x80,0x00,0xad,0x40,0x5a,0x00,0xf8,
-0xca,0x11,0x06,0xba,0x0a,0x12,0x3f,0xc4,0x03,0x15,0xeb,0xb4,0x2b,0x72,0x09,0x99,
-0xfe,0x99,0x99,0x99,0x40,0x86,0x3f,0x00,0x75,0x59,0x00,0x57,0x30,0x41,0x3f,0xb8,
-0x88,0xcf,0xb6,0x3f,0x21,0x09,0xf0,0x15,0x46,0x50,0xbd,0x00,0x00,0x9f,0x60,0x09,
-0x1a,0x50,0xbf,0xb0,0x07,0x79,0xf7,0xcb,0x04,0x15,0xaf,0xd7,0x4b,0xf0,0x09,0x0e,
-0xff,0xf7,0xbe,0xee,0xed,0x00,0xeb,0x5f,0x75,0x78,0xf9,0x60,0x0e,0x80,0xe7,0x16,
-0x4f,0x20,0x00,0xef,0xff,0x77,0xf4,0x9e,0x19,0xf3,0x23,0xe7,0xcc,0x7f,0x43,0x00,
-0xef,0xef,0x8e,0xff,0xff,0xf1,0x0e,0xb6,0x63,0x11,0xeb,0x00,0x00,0xe8,0x2a,0x00,
-0x4f,0xf4,0x00,0x0e,0x82,0xf6,0x0a,0xff,0x50,0x00,0xfd,0xff,0xd3,0xf9,0xe5,0x92,
-0x4f,0xe7,0x48,0xee,0x1e,0x9d,0x30,0x91,0x00,0x6f,0x30,0x9f,0xc0,0x60,0x01,0x01,
-0xb5,0x10,0x51,0xfd,0x88,0x88,0x8d,0xf0,0x45,0x11,0x06,0x05,0x00,0x02,0x19,0x00,
-0x00,0xc1,0x17,0x06,0x14,0x00,0x00,0x2c,0x50,0x02,0x19,0x00,0x13,0xfa,0x45,0x2d,
-0xf3,0x0f,0x12,0x22,0x22,0x01,0xff,0xff,0x38,0xff,0xff,0xf1,0x1f,0x98,0xf3,0x8f,
-0x33,0x9f,0x11,0xf5,0x2f,0x38,0xf0,0x07,0xf1,0x1f,0x63,0xf3,0x8f,0x88,0xbf,0x11,
-0x1a,0x00,0xf1,0x0a,0x86,0xf3,0x8f,0x00,0x7f,0x11,0xf5,0x2f,0x39,0xf7,0x7b,0xf1,
-0x1f,0xff,0xf3,0xcf,0xdd,0xef,0x11,0xfa,0x77,0x2f,0x80,0x07,0xf1,0xfa,0x00,0x10,
-0x7f,0x4f,0x2e,0x82,0x02,0x7c,0xf0,0x00,0x00,0x3d,0x10,0x2f,0x7e,0x4a,0x02,0x48,
-0x50,0xf0,0x03,0xe9,0x00,0x02,0xff,0xfe,0x26,0x6f,0xc6,0x61,0x2f,0x8b,0xe6,0xee,
-0xff,0xee,0x22,0xf4,0x8e,0x87,0x1a,0xf1,0x1e,0x2f,0x8b,0xed,0xff,0xff,0xff,0x82,
-0xff,0xfe,0x45,0x55,0x8f,0x73,0x2f,0x48,0xe8,0x99,0x9b,0xfa,0x42,0xf4,0x8e,0x7a,
-0x98,0xaf,0xa4,0x2f,0xff,0xe1,0xf9,0x04,0xf3,0x02,0xf9,0x66,0x08,0xf4,0x4f,0x30,
-0x1c,0x30,0x00,0x06,0x79,0xf3,0x42,0x09,0x02,0xab,0x0b,0x04,0xd0,0x22,0x00,0xcf,
-0x0a,0x01,0xad,0x20,0xf2,0x05,0xef,0xee,0xee,0xef,0xe0,0x00,0x0e,0xc9,0x99,0x99,
-0xde,0x00,0x02,0x77,0x7b,0xf9,0x77,0x72,0x04,0xff,0x82,0x41,0x20,0x59,0x99,0xf1,
-0x1c,0xf3,0x11,0x09,0xe6,0x66,0x66,0xeb,0x00,0x00,0x9f,0xee,0xee,0xef,0xb0,0x00,
-0x03,0xb6,0x5f,0x68,0x82,0x00,0x2a,0xfd,0x56,0xf4,0x7e,0xf7,0x00,0xa6,0x0a,0xfc,
-0x10,0x08,0x90,0xba,0x1a,0xc2,0x55,0x55,0x8f,0xa5,0x55,0x51,0x00,0x44,0x47,0xf9,
-0x44,0x41,0x55,0x11,0x7f,0x50,0x00,0xf8,0x36,0xf8,0x35,0xf5,0x0d,0x00,0x02,0x31,
-0x8d,0x3c,0xe1,0xcc,0x3a,0x10,0xf8,0x4d,0x06,0xc4,0xaf,0xff,0xfe,0xb9,0x88,0x51,
-0xee,0x92,0x15,0x9c,0xde,0xf4,0x4a,0x0d,0x51,0xee,0xee,0xfe,0xef,0xf0,0x3f,0x02,
-0x23,0x8f,0x00,0x9e,0x13,0xc3,0x27,0x77,0x9f,0xa7,0xcf,0x21,0x01,0x99,0x9a,0xfb,
-0x99,0x90,0xcf,0x15,0x80,0x18,0x88,0x8a,0xfa,0x88,0x88,0x41,0x89,0x8a,0x0c,0x31,
-0x84,0x00,0xbf,0x4c,0x02,0xe0,0x0b,0xe8,0x88,0x88,0xcf,0x10,0x00,0xbe,0x77,0x77,
-0x7b,0xf1,0x00,0x0b,0xde,0x30,0x22,0x10,0x00,0xad,0x0e,0x21,0x0f,0x60,0x23,0x13,
-0x00,0x13,0x31,0x90,0x90,0x00,0x0f,0xb8,0x88,0x88,0xf9,0x00,0x12,0xb5,0x26,0x13,
-0x51,0xf8,0x20,0xf0,0x0a,0x08,0xf8,0xbf,0x68,0x88,0x86,0x00,0x7f,0x8b,0xf6,0xfc,
-0xaf,0xa0,0x07,0xff,0xff,0x1b,0xc6,0xf3,0x00,0x8f,0x5a,0xf6,0x1f,0xf9,0x91,0x2d,
-0xa5,0xbb,0xfe,0xfa,0x22,0x42,0x06,0xf4,0xb3,0x07,0xb0,0xf3,0x0e,0x10,0xe4,0x99,
-0x0d,0x54,0x77,0xbf,0x97,0x77,0x77,0xab,0x13,0x02,0x05,0x40,0x11,0x03,0x96,0x10,
-0xf0,0x0d,0x03,0xef,0xe6,0x66,0x6b,0xf0,0x03,0xfe,0xdf,0xdd,0xdd,0xef,0x00,0x08,
-0x1b,0xd5,0x55,0x5a,0xf0,0x00,0x00,0xbf,0xdd,0xdd,0xff,0x00,0x00,0x0b,0x1a,0x00,
-0x00,0x6f,0x5b,0x20,0x27,0xcf,0x81,0x06,0xf6,0x43,0x02,0xfe,0x80,0x00,0x06,0xf0,
-0x6f,0x0a,0xff,0xff,0x16,0xff,0xff,0xfe,0xad,0x6a,0xf1,0x4d,0xfb,0xdf,0xaa,0xb0,
-0x6f,0x10,0x6f,0x38,0xf0,0xad,0x5a,0xf1,0x06,0xff,0xff,0x0a,0xff,0xff,0x10,0x6f,
-0x48,0xf0,0xab,0x06,0xf1,0x06,0xfd,0xef,0x0b,0xd7,0xbf,0x12,0x9f,0x48,0xf4,0xcf,
-0xde,0xf1,0x8f,0xff,0xff,0xde,0x80,0x6f,0x10,0x4c,0x39,0x83,0xf6,0x06,0xf1,0x1d,
-0xd0,0x5f,0xbf,0x26,0xbf,0x03,0xd2,0x00,0x55,0xa0,0xbf,0x90,0x53,0x15,0x15,0xf7,
-0xdb,0x1e,0x12,0x01,0x7c,0x10,0x10,0x07,0x41,0x09,0x12,0x40,0x1a,0x00,0x05,0x92,
-0x03,0x71,0x9f,0xff,0xc9,0x99,0x40,0x00,0x0c,0xd1,0x32,0xf9,0x0a,0x1c,0xf7,0xf9,
-0xdf,0x40,0x00,0x7f,0xf5,0x2f,0x71,0xdf,0xa1,0x3f,0xd3,0x02,0xf7,0x00,0x9f,0x80,
-0x30,0x00,0x2f,0x70,0x00,0x30,0x87,0x2f,0x02,0xf6,0x01,0x73,0x31,0x88,0x88,0xaf,
-0xa8,0x88,0x82,0x1a,0x00,0x11,0x8f,0x27,0x09,0x60,0x05,0x88,0xbf,0xff,0xb8,0x85,
-0x51,0x4b,0x00,0x76,0x1c,0xf0,0x05,0x3e,0xe7,0xf6,0xdf,0x40,0x01,0x9f,0xe2,0x5f,
-0x51,0xdf,0xb2,0x4f,0xb1,0x05,0xf5,0x01,0xaf,0x40,0x30,0x41,0x00,0x13,0x20,0x37,
-0x16,0x02,0xa6,0x4f,0x02,0xc8,0x01,0x04,0xb9,0x13,0x40,0x05,0xfb,0xfb,0xf4,0xf7,
-0x37,0x10,0x5f,0xc7,0x46,0xf0,0x05,0x5f,0x74,0xf5,0x8f,0x60,0x00,0x2f,0xd0,0x4f,
-0x50,0xdf,0x40,0x3e,0xfc,0x9b,0xfb,0x9c,0xff,0x43,0xe4,0x36,0x07,0x19,0xd1,0x41,
-0x00,0x05,0xce,0x07,0x13,0xd1,0xf2,0x30,0xf1,0x14,0xfe,0x50,0x00,0x3d,0xff,0x85,
-0x8f,0xe1,0x00,0x0c,0xe6,0xcf,0x9f,0xe2,0x00,0x00,0x11,0x38,0xff,0xfa,0x51,0x00,
-0x4c,0xff,0xe9,0x48,0xef,0xfe,0x41,0xb7,0x40,0x4f,0x40,0x26,0x80,0xfe,0x00,0xf5,
-0x0c,0xf4,0x00,0x05,0xa6,0x8f,0x86,0x85,0x10,0x00,0x8f,0x54,0xf4,0x8f,0x50,0x00,
-0xbf,0x63,0x8f,0x30,0xaf,0x40,0x02,0x30,0x6f,0xc0,0x00,0x70,0xd1,0x0c,0x11,0xe0,
-0xa7,0x2c,0xf1,0x26,0x8e,0x02,0x5c,0xe5,0x50,0x00,0x3a,0xf3,0x6f,0xff,0xff,0x00,
-0x3f,0xff,0xf5,0x2f,0x65,0xf2,0x10,0x2d,0xf2,0x3d,0xe0,0x5f,0x8b,0x01,0xff,0x8b,
-0xe4,0x66,0xde,0x60,0x7f,0xff,0x50,0x0f,0x90,0x00,0x1e,0xee,0x78,0x77,0xfc,0x77,
-0x47,0xe8,0xe0,0xef,0xff,0xff,0xf9,0x15,0x8e,0x71,0x02,0x21,0x08,0xe0,0xb5,0x22,
-0x02,0x0d,0x00,0x04,0xc5,0x04,0x31,0x80,0x05,0xe1,0xee,0x2c,0xf0,0x2c,0xdf,0xcc,
-0xc9,0x03,0x7f,0xc5,0xaf,0xc9,0xaf,0xb0,0x7f,0xff,0xcf,0xee,0x3c,0xe2,0x00,0x4f,
-0xe2,0x30,0xdf,0xf3,0x00,0x09,0xff,0xd6,0xcf,0xdf,0xea,0x30,0xef,0x9a,0xfa,0x30,
-0x16,0xd6,0x8d,0xe8,0x09,0xff,0xff,0xf8,0x09,0x7e,0x80,0x8f,0x55,0x5f,0x90,0x21,
-0xe8,0x08,0xe0,0x00,0xf9,0x00,0x0e,0x80,0x8f,0xd4,0x02,0x56,0xe8,0x08,0xe5,0x55,
-0xe8,0x55,0x00,0x30,0x00,0x4e,0x30,0x55,0x00,0xb2,0x1e,0xfd,0x20,0x02,0x5f,0xb4,
-0x6f,0xb1,0xbf,0x70,0x8f,0x45,0x12,0x90,0x3f,0xc0,0x24,0x7f,0x64,0x10,0x07,0xff,
-0x5e,0x1f,0x19,0xfa,0x17,0xcf,0xdb,0xe8,0x7f,0x59,0xe0,0x3f,0xf8,0x3e,0x97,0xf6,
-0x9e,0x0a,0xae,0x80,0xde,0xff,0xfe,0xd0,0x42,0xe8,0x00,0x1d,0xff,0x40,0x00,0x0e,
-0x80,0x6e,0xc1,0xaf,0x92,0x00,0xe8,0x5e,0x80,0x00,0x7d,0xd7,0x0d,0x30,0x2f,0x29,
-0xff,0x17,0x2c,0xf0,0x5b,0xf2,0x24,0x44,0x9f,0xd1,0x06,0xef,0xe2,0x00,0x8f,0xc1,
-0x00,0x7f,0xff,0x63,0x2e,0xcc,0xb9,0x00,0x3f,0x3c,0xeb,0xe8,0x8b,0xc0,0x08,0xfb,
-0xc4,0xbe,0x9b,0xa9,0x00,0xdf,0xee,0x6b,0xe7,0xcf,0x40,0x5f,0xf4,0xcf,0xbe,0x68,
-0xf4,0x0a,0xaf,0x2b,0x36,0xeb,0xfc,0xc0,0x44,0xf2,0x02,0xdf,0x87,0x15,0x00,0x2f,
-0x36,0x6c,0xa6,0x66,0x62,0x02,0xf6,0xee,0xee,0xee,0xee,0x40,0x04,0xf1,0x9f,0xfc,
-0xcf,0xff,0x50,0x4f,0x19,0xc7,0xc4,0x4f,0x71,0x4b,0xfa,0xaa,0x5c,0x66,0xf2,0x07,
-0xff,0xfb,0xff,0xca,0x8f,0x10,0x06,0xf4,0x9a,0x5c,0xd8,0xf2,0x00,0xaf,0xda,0x12,
-0x4d,0xf4,0x18,0x0e,0xfe,0xec,0x44,0x3a,0xc1,0x05,0xff,0x6a,0xa9,0x90,0xef,0x00,
-0xac,0xf1,0xab,0xaf,0x5f,0xf0,0x04,0x6f,0x1d,0xfb,0xbf,0xcf,0x35,0x04,0xf2,0xc5,
-0x08,0xf3,0xf7,0x70,0x4f,0x10,0x00,0xc5,0x0d,0xf3,0xa4,0x00,0xf1,0x2d,0xe7,0x00,
-0x7f,0x0a,0xd0,0x00,0x0e,0x70,0xcf,0xff,0xff,0xf4,0x25,0xfa,0x44,0xbf,0x7c,0xe7,
-0x07,0xff,0xfc,0x4c,0xf9,0xde,0x90,0x04,0xf8,0x2d,0xef,0xdf,0xfd,0x70,0x7f,0xe1,
-0x67,0x7f,0xa7,0x72,0x0c,0xff,0x98,0xff,0xff,0xff,0x04,0xff,0xab,0x8f,0x8f,0xbc,
-0xf0,0xa9,0xe7,0x08,0xe6,0xfa,0xbf,0x03,0x1e,0x74,0x43,0x17,0xe0,0xe7,0x08,0xe1,
-0x14,0xaf,0x00,0x0e,0x70,0x7c,0x00,0xaf,0x90,0x00,0xe7,0x77,0x04,0xf0,0x21,0x70,
-0x0e,0x70,0x33,0xf7,0xf6,0x31,0x48,0xfc,0x69,0xdf,0xef,0xed,0x17,0xff,0xfc,0xba,
-0xd7,0xf6,0xf2,0x04,0xf8,0x1b,0xad,0x7f,0x6f,0x20,0x7f,0xd0,0x9d,0xdd,0xdd,0xd1,
-0x0c,0xff,0x93,0xbb,0xbb,0xb9,0x04,0xff,0x9c,0x58,0x88,0x88,0x72,0xa9,0xe7,0x17,
-0x03,0xf0,0x35,0x83,0x1e,0x70,0x4b,0x2f,0x6a,0x50,0x00,0xe7,0x4f,0xb4,0xf6,0x9f,
-0x40,0x0e,0x71,0x70,0xee,0x20,0x71,0x02,0xf0,0x08,0x1b,0x62,0x80,0x00,0x2f,0x02,
-0xd0,0xc7,0x88,0x20,0x39,0xf8,0xba,0xec,0xbf,0xca,0x06,0xff,0xf9,0xe6,0xaa,0x8e,
-0x20,0x08,0xf2,0x4c,0xba,0xbb,0xae,0x00,0xcf,0xbc,0xee,0xcd,0xde,0xd2,0x1f,0xfd,
-0x6d,0x67,0xf6,0xf6,0x08,0xcf,0x2e,0x8f,0x04,0xf6,0x0b,0x86,0xf0,0x4f,0x80,0xe8,
-0xe5,0x01,0x2f,0x09,0xde,0x79,0xfb,0x41,0x02,0xf5,0xf5,0x39,0xff,0xbd,0x60,0x2f,
-0x88,0x04,0xc4,0x3c,0xd0,0x97,0x01,0x00,0xec,0x07,0x03,0x50,0x47,0x31,0x53,0x00,
-0xec,0xb4,0x4f,0x01,0x0d,0x00,0x50,0xfa,0x00,0xef,0xff,0xfa,0x0d,0x00,0x5a,0xe9,
-0x99,0x70,0x00,0xfa,0x1a,0x00,0x11,0xec,0xd3,0x11,0x10,0x0e,0x14,0x3a,0x01,0x1d,
-0x02,0x30,0x35,0x77,0x77,0x7a,0x1d,0x03,0x52,0x00,0x02,0xca,0x29,0x73,0x05,0x77,
-0x77,0xee,0x77,0x77,0x10,0x19,0x3e,0x31,0x7a,0x00,0xdc,0x2e,0x34,0x10,0x0d,0xbb,
-0x05,0x50,0x9f,0x00,0xde,0x88,0x83,0x0d,0x00,0x11,0xc0,0xd0,0x1e,0x03,0x1a,0x00,
-0x14,0xc0,0x13,0x04,0x20,0x91,0x99,0x01,0x00,0xf0,0x29,0x95,0x4f,0xff,0xfe,0x07,
-0xf5,0xc4,0x02,0x6f,0xb6,0x50,0x6f,0x28,0xa0,0x02,0xf6,0x00,0x6c,0xff,0xff,0x10,
-0x5f,0xff,0x8f,0xff,0xb8,0x50,0x0a,0xe6,0xf7,0x13,0xf5,0x47,0x32,0xf8,0x1f,0x78,
-0xcf,0xff,0xf6,0x7f,0xab,0xf5,0xeb,0xfb,0x28,0x20,0x67,0xfb,0x00,0x0c,0xcb,0xe2,
-0x00,0x4f,0x50,0xf1,0x42,0xf5,0x04,0x1d,0xc0,0x02,0x9f,0xf7,0x43,0x2e,0xe2,0x0a,
-0xff,0x9c,0xec,0x90,0xa2,0x00,0x58,0x10,0x2c,0xe3,0x05,0x14,0x15,0x10,0xfa,0x34,
-0x30,0x30,0x1d,0xe6,0x7e,0x2c,0x20,0x0c,0xfb,0x51,0x55,0x40,0x00,0x98,0xef,0xff,
-0xdd,0x43,0x52,0x1f,0x70,0xca,0x07,0xf0,0xbf,0x06,0xd3,0xfb,0x16,0xaf,0x87,0xfa,
-0x6c,0xf6,0x50,0x08,0xf1,0x2f,0x40,0xbd,0xd7,0x00,0x60,0x60,0x04,0x55,0x55,0x78,
-0xfa,0x02,0x0b,0x05,0x5b,0x27,0x05,0x7e,0x39,0x01,0xd7,0x0d,0x21,0x09,0xf0,0x87,
-0x15,0x00,0x0d,0x00,0x70,0x05,0xa0,0x09,0xf1,0x00,0x1f,0x83,0x0e,0x42,0xa0,0xf1,
-0xfb,0xfe,0x30,0x09,0xf8,0x77,0x1f,0xfc,0x10,0x1a,0x00,0x13,0xfb,0x27,0x00,0x11,
-0x02,0x27,0x00,0xf9,0x08,0x02,0xf4,0x09,0xf6,0xad,0x1f,0x80,0x3f,0x40,0xdf,0xff,
-0x90,0xfd,0x8b,0xf1,0x0e,0xc5,0x00,0x08,0xff,0xf8,0x00,0x10,0xba,0x25,0x12,0xf9,
-0x62,0x00,0x01,0x92,0x16,0x81,0x2f,0xc5,0x55,0x55,0x55,0x50,0x1d,0xfc,0x11,0x3b,
-0x72,0xf7,0x35,0x55,0x55,0x54,0x00,0x04,0xec,0x16,0xb0,0x05,0x55,0x5c,0x86,0xf7,
-0x00,0x00,0xbe,0x57,0xf6,0x1f,0x31,0x63,0x30,0xfb,0x00,0xf8,0xa8,0x15,0xf3,0x02,
-0xf6,0x0d,0xb6,0x50,0x5d,0xf9,0x2d,0xf3,0x8f,0xd8,0x0b,0xd4,0x00,0x04,0x01,0xbe,
-0x20,0x69,0x0b,0x11,0xb3,0xbd,0x24,0x30,0x6e,0xf2,0x95,0xca,0x24,0xf0,0x09,0x16,
-0x0f,0x81,0xf8,0x8b,0x10,0x20,0x00,0xf9,0x6f,0xff,0xf1,0x4f,0xb2,0x3f,0xff,0xfa,
-0x6f,0x10,0x6e,0x5f,0xfc,0x4f,0x76,0x47,0x1c,0xf0,0x03,0x81,0xf7,0x7f,0x00,0x03,
-0xc1,0xf8,0x1f,0xcf,0xe0,0x00,0xbe,0x0f,0x81,0xf8,0x63,0x00,0x4f,0x64,0x2e,0xf1,
-0x01,0xe7,0x0d,0xe0,0x0e,0xd7,0x66,0x9f,0x60,0x66,0x00,0x6e,0xff,0xff,0xb0,0x05,
-0x92,0xc6,0x08,0x90,0x6e,0xf3,0x11,0xaf,0x11,0x00,0x00,0x17,0x3f,0x28,0x06,0x81,
-0x40,0x01,0x55,0xcf,0x55,0x30,0x5f,0xd3,0x1a,0x00,0x21,0x3c,0x2a,0x5b,0x07,0xb0,
-0x01,0x57,0xbf,0xb7,0x77,0x00,0x03,0xe2,0x0b,0xe1,0x12,0x66,0x4c,0xa0,0xf7,0x0d,
-0xc0,0x00,0x5f,0x60,0xcf,0x45,0xaf,0x70,0xfe,0x31,0xb1,0xfe,0xee,0x00,0x54,0x00,
-0x85,0x20,0x03,0xa1,0x05,0xa2,0x61,0x18,0x90,0x5e,0xf3,0x44,0x9f,0x54,0x51,0x00,
-0x15,0x6f,0xf1,0x07,0xf2,0x00,0x40,0x06,0xf2,0x8f,0x39,0xf1,0x5f,0xd3,0x6f,0x17,
-0xf2,0x66,0x00,0x5d,0x27,0x3c,0x16,0xf4,0x16,0x8f,0xfb,0x47,0xf5,0x00,0x08,0x79,
-0xe7,0xf2,0xce,0x00,0x00,0xea,0xbc,0x0d,0xef,0x60,0x00,0x7f,0x3f,0x80,0x9f,0xf3,
-0x00,0x1f,0xb6,0xf8,0xdf,0xbe,0xfb,0x31,0xa3,0x7c,0x6d,0x40,0x07,0xe2,0x74,0x2c,
-0xf0,0x0d,0x91,0x16,0x07,0xf1,0x46,0x00,0x7f,0xe4,0xf8,0x7f,0x1c,0xd0,0x00,0x27,
-0x0a,0xe7,0xf4,0xf5,0x00,0x40,0x00,0x87,0xaf,0x78,0x30,0x4f,0xd3,0x1f,0xb0,0x00,
-0x40,0x3d,0x41,0xf7,0x11,0x75,0x24,0x01,0x0d,0x00,0x81,0x05,0xd2,0xf8,0x22,0x2e,
-0x90,0x00,0xcc,0x0d,0x00,0xf4,0x03,0x5f,0x51,0xfa,0x55,0x5e,0x90,0x0e,0xd0,0x1f,
-0x60,0x37,0xf9,0x00,0x75,0x01,0xf6,0x03,0xfd,0xdb,0x04,0xe0,0x8b,0x20,0x00,0x0b,
-0xdc,0x90,0x06,0xec,0x11,0x11,0xbd,0x5e,0x40,0x02,0xfa,0x0f,0xf4,0x2c,0xf6,0x04,
-0x02,0xf6,0x44,0xaf,0x33,0x15,0xfd,0x4f,0x9f,0xfa,0xf3,0xc2,0x04,0xb2,0xf5,0x44,
-0x7f,0x9f,0x00,0x01,0x3f,0x9f,0xf9,0xff,0xa0,0x02,0xf7,0xf8,0x7b,0x6f,0xf3,0x00,
-0x7f,0x6f,0x7e,0xf6,0xfb,0x43,0x0e,0xa8,0xd7,0x94,0xdf,0xd7,0xb5,0xf5,0xe9,0x12,
-0xce,0x8f,0xf7,0x18,0x1b,0x20,0x1b,0x20,0x9d,0x51,0x02,0x12,0x20,0x24,0x07,0x20,
-0x90,0xdf,0xe4,0x00,0xf0,0x13,0x9f,0x7d,0xb3,0x33,0xe9,0x00,0x00,0x81,0xdb,0x33,
-0x3e,0x90,0x00,0x00,0x0d,0xfe,0xee,0xf9,0x01,0xea,0x20,0xdb,0x55,0x5f,0x90,0x06,
-0xe9,0x0c,0xee,0xee,0xe8,0x00,0x01,0x01,0x0f,0x02,0x30,0x00,0x39,0x4f,0x32,0x08,
-0xf1,0x06,0x0a,0xe4,0xf4,0xf4,0xd6,0xf0,0x03,0xf7,0x4f,0x4f,0x4d,0x6f,0x00,0xce,
-0x28,0xf8,0xf8,0xe9,0xf5,0x09,0x73,0xa9,0x1b,0x03,0xf5,0x01,0x12,0x20,0xd7,0x3b,
-0x10,0x6d,0xb8,0x06,0x90,0x01,0xc6,0xdc,0x66,0xea,0x66,0x10,0x00,0x0d,0x66,0x53,
-0xf0,0x02,0x04,0x00,0xda,0xef,0xff,0xfe,0x08,0xfb,0x1e,0x9e,0x83,0x39,0xe0,0x07,
-0xb0,0xf9,0xef,0x05,0x1f,0x80,0x0f,0x7e,0x83,0x39,0xe0,0x00,0xa3,0xf5,0x0d,0x00,
-0xfb,0x09,0x6f,0x9f,0x37,0x2e,0x86,0x50,0x0d,0xca,0xe6,0xf4,0xe8,0x9f,0x15,0xf7,
-0xf9,0xcc,0x5f,0x82,0xf5,0x19,0x2c,0x20,0x1f,0xe4,0x0d,0x0f,0x30,0x2e,0x80,0xae,
-0x16,0x58,0xe1,0x7c,0x5f,0xfc,0xfe,0xbb,0x00,0xb5,0x4f,0xf7,0x7f,0xa6,0x60,0x19,
-0xe7,0x02,0x15,0xe0,0x01,0x95,0xf8,0x8f,0xa7,0x30,0x00,0xbe,0x7f,0x77,0xfa,0x62,
-0x00,0xcf,0x3a,0x30,0xe3,0xf2,0x07,0x70,0x5f,0x95,0x44,0x44,0x01,0x77,0x67,0x9f,
-0xa6,0x66,0x64,0x8c,0x2d,0x04,0xf0,0x0b,0x26,0x03,0xf5,0x55,0x00,0x11,0x48,0x60,
-0x41,0x21,0x07,0xfd,0x16,0x09,0xf1,0x07,0x02,0x4f,0x84,0x44,0x49,0xf0,0x02,0x00,
-0x7f,0xee,0xee,0xe6,0x06,0xfb,0x01,0x55,0xfb,0x55,0x00,0x06,0xa0,0xaf,0xa2,0x38,
-0x71,0x0a,0xc3,0xfa,0x3f,0x70,0x00,0x95,0x0d,0x00,0xf3,0x0a,0x1f,0x9a,0xc4,0xfa,
-0x4f,0x70,0x08,0xf2,0x8d,0xed,0xdf,0xd6,0x01,0xfb,0x05,0xdd,0x14,0xfb,0x20,0x1a,
-0x46,0xfa,0x10,0x03,0xdd,0x6c,0x17,0xf0,0x01,0x07,0xc5,0x0f,0xff,0xfe,0xf9,0x00,
-0x07,0xe2,0xf6,0x9f,0x2d,0x90,0x00,0x01,0x0f,0xe8,0x01,0x81,0x30,0x04,0x55,0xbf,
-0x55,0x52,0x5f,0xc3,0x2d,0x0a,0x21,0x6e,0x30,0xbd,0x0a,0x20,0x10,0x0f,0x5b,0x13,
-0xf5,0x11,0x03,0xa0,0xfc,0xaa,0xae,0xa0,0x00,0xbe,0x1f,0xca,0xaa,0xea,0x00,0x5f,
-0x60,0xfe,0xdd,0xdf,0xa0,0x0e,0xd0,0x39,0xf7,0x0d,0xe6,0x00,0x75,0x1e,0xb4,0x00,
-0x07,0xe4,0x6c,0x15,0x11,0x50,0x3e,0x08,0x10,0xfa,0x59,0x04,0x11,0x07,0xc9,0x25,
-0xd2,0x22,0xee,0xf1,0xf3,0xd7,0x8d,0x00,0x06,0xaf,0x7f,0x8e,0xab,0xe6,0x30,0x05,
-0xe3,0xf1,0x00,0x5f,0x1f,0x3d,0x78,0xd0,0x00,0x6a,0xf7,0xf8,0xea,0xbe,0x63,0x3a,
-0x30,0xf6,0x07,0x0a,0x42,0x60,0x54,0x19,0x50,0x06,0xf5,0x5f,0x2a,0xe0,0xcf,0x11,
-0xec,0x04,0xf3,0x6f,0x23,0xf8,0x01,0x10,0x01,0x6d,0x40,0x00,0xae,0x03,0xf1,0x0a,
-0x9f,0x18,0x00,0x03,0x1f,0x70,0x09,0xf1,0xe9,0x04,0xf5,0xf7,0x00,0x9f,0x06,0xc0,
-0x0c,0xef,0x87,0x7c,0xf7,0x87,0x30,0x37,0xfa,0x61,0x01,0x41,0x1f,0x70,0x0c,0xf6,
-0x72,0x42,0xf0,0x0b,0xef,0xb0,0x00,0x2c,0xff,0x70,0x4f,0xcf,0x20,0x04,0xe4,0xf7,
-0x0b,0xe1,0xea,0x00,0x01,0x1f,0x75,0xf8,0x07,0xf6,0x00,0x01,0xfb,0xfc,0x33,0x47,
-0x5c,0x1f,0xac,0x10,0x00,0x0b,0x1c,0x19,0x00,0xe6,0x25,0x12,0x0d,0x89,0x00,0xf1,
-0x18,0x57,0x66,0xce,0x7a,0x67,0x73,0x08,0xe4,0x3f,0x98,0xf3,0xdb,0x00,0x1b,0xc8,
-0xff,0xf4,0x8e,0x20,0x00,0x18,0x27,0xf9,0xa5,0x70,0x00,0xaf,0xdc,0xfe,0xdf,0xdf,
-0xc1,0x09,0x50,0x7a,0xc8,0x87,0x3a,0x11,0xd9,0x12,0x15,0x74,0x84,0x21,0x07,0x89,
-0x1a,0x20,0x6f,0xff,0xfc,0x15,0xf0,0x11,0x02,0x6e,0xc6,0x6f,0x54,0x4a,0xf0,0x00,
-0xd9,0x05,0xf4,0x33,0x9f,0x00,0x0d,0x90,0x5f,0xfe,0xef,0xf0,0x26,0xec,0x65,0xf5,
-0x44,0xaf,0x04,0xff,0xff,0x5f,0xee,0xef,0x1a,0x00,0x70,0xf6,0x44,0xaf,0x00,0x0d,
-0x91,0x6f,0x08,0x69,0xf4,0x0a,0xef,0xf4,0x8f,0x1f,0x60,0x09,0xfc,0x84,0x1e,0xc1,
-0xf6,0x44,0x11,0x00,0x6d,0xf3,0x1f,0x9b,0xa0,0x00,0x0e,0xb3,0x00,0xcf,0xf5,0x64,
-0x15,0x10,0xff,0x19,0x1f,0xf0,0x0f,0x41,0x6e,0xc6,0x8d,0x4f,0x97,0xf4,0x00,0xd9,
-0x08,0xea,0xfc,0xbf,0x40,0x0d,0x90,0x8f,0xbf,0xdc,0xf4,0x2e,0xff,0xb8,0xc0,0xe5,
-0x2f,0x41,0xaf,0xd8,0x8f,0x8c,0x09,0xf1,0x13,0xd9,0x03,0x56,0xfb,0x55,0x10,0x0d,
-0x90,0x24,0x5f,0xa4,0x42,0x00,0xdd,0xca,0xff,0xff,0xff,0x63,0xdf,0xfd,0x11,0x2f,
-0x81,0x10,0x3e,0x93,0x37,0x77,0xfb,0x77,0x60,0x00,0x07,0xf2,0x2b,0x31,0x2b,0x31,
-0xf8,0x8e,0x4b,0x01,0xb7,0x00,0x11,0xef,0xb3,0x3f,0x02,0x81,0x1b,0x21,0x2f,0xd0,
-0xc4,0x00,0x12,0x52,0xd1,0x00,0x11,0x9f,0x59,0x01,0x10,0x05,0xcd,0x18,0x19,0x30,
-0x67,0x1b,0x03,0x07,0x2a,0x03,0xed,0x3a,0x10,0x22,0x01,0x00,0x12,0x00,0x9d,0x3e,
-0xb4,0xfa,0x55,0xfa,0x55,0xbe,0x00,0xf9,0x23,0xf9,0x22,0xae,0x12,0x00,0xb1,0x45,
-0xfa,0x44,0xbe,0x01,0xf8,0x12,0xf9,0x11,0xae,0x02,0x12,0x00,0x20,0x04,0xf7,0x24,
-0x00,0x00,0xd5,0x13,0xe2,0x00,0x9e,0x1f,0xa0,0x00,0xf8,0x45,0xce,0x3e,0x20,0x00,
-0xf8,0x9f,0xf7,0x08,0x1a,0x05,0xc8,0x27,0x07,0x1b,0x33,0x21,0x00,0x9f,0x7e,0x0c,
-0xf6,0x08,0x99,0xc7,0xf6,0xd9,0x8f,0x00,0xf9,0x9b,0x6f,0x5c,0x98,0xf0,0x0f,0x99,
-0xff,0xff,0xf9,0x8f,0x00,0xf9,0x9a,0x3f,0x1b,0x0d,0x00,0x44,0x12,0x22,0x22,0x18,
-0xa5,0x25,0x11,0x77,0x5d,0x25,0x00,0x5a,0x0e,0xf3,0x0e,0x46,0x70,0x00,0x2e,0xef,
-0xff,0xff,0xeb,0x30,0x00,0x6e,0x65,0xf8,0x0c,0x90,0x00,0x01,0xf8,0x1f,0x73,0xf8,
-0x00,0x05,0x5d,0xd6,0xfa,0xbf,0x75,0x21,0x5d,0x3a,0xe1,0x6b,0xf9,0xfa,0xdd,0x84,
-0x12,0xff,0xd3,0x03,0x10,0x9f,0xf6,0x07,0xdf,0x28,0x25,0x81,0x09,0xf4,0x4f,0x94,
-0xaf,0x10,0x00,0x9f,0xb2,0x02,0x43,0x09,0xf3,0x3f,0x83,0x0d,0x00,0x11,0xe1,0x4a,
-0x04,0x10,0x01,0x12,0x07,0xf0,0x22,0xe8,0xf6,0xe9,0x00,0x04,0x54,0xed,0x0c,0xfa,
-0x39,0x00,0xad,0x8f,0x60,0x4f,0x9e,0xd1,0x01,0xdf,0xfb,0xbb,0xff,0xe1,0x00,0x4f,
-0xea,0xcc,0xcb,0xdf,0xa1,0x6f,0xf7,0x44,0x44,0x46,0xff,0x81,0x77,0xfe,0xee,0xef,
-0xf5,0x60,0x00,0x6f,0x42,0x22,0x6f,0x50,0x70,0x4e,0x00,0x4d,0x49,0xe3,0x05,0xf3,
-0x02,0xe5,0x00,0x01,0x44,0x6f,0x84,0x9f,0x64,0x41,0x3f,0xff,0x09,0x3f,0x11,0x20,
-0xf6,0x06,0xf3,0x03,0xce,0x10,0x0d,0xd0,0x00,0x09,0xde,0xfd,0xde,0xfe,0xda,0x00,
-0x36,0x66,0xdf,0x66,0x66,0x40,0xaf,0x3e,0x63,0x36,0x6b,0xf8,0x66,0x66,0x30,0x2e,
-0x00,0xe0,0x01,0xdf,0xa8,0x88,0x88,0x10,0x01,0xcf,0xf8,0x88,0x8c,0xf1,0x03,0xef,
-0x22,0x0d,0x60,0x10,0x3e,0x49,0xf9,0x99,0x9c,0x47,0x3a,0x62,0x77,0x77,0xbf,0x10,
-0x00,0x09,0x17,0x10,0x01,0x9d,0x0f,0x40,0x01,0x44,0x44,0x00,0x20,0x13,0x30,0xff,
-0xed,0xff,0x4f,0x38,0xf4,0x30,0x61,0xd9,0xee,0x77,0xf4,0x05,0xf2,0x05,0x9f,0x6f,
-0x96,0x10,0x9f,0x76,0x5f,0xff,0xff,0xf0,0x1e,0xfe,0xff,0xfa,0x3f,0x93,0x08,0xfc,
-0x6e,0x5f,0xff,0xff,0xd0,0x7f,0xc6,0xe0,0xe9,0x2e,0x92,0x00,0x9c,0x6e,0x0e,0xfe,
-0xff,0xc0,0x08,0xff,0xe0,0xea,0x3f,0x93,0x00,0x8d,0x55,0x0e,0xed,0xfe,0xd4,0x02,
-0x30,0x00,0xeb,0x66,0x66,0x3c,0x03,0x03,0xc3,0x34,0x56,0x67,0x77,0x77,0x77,0x72,
-0x1b,0x3f,0x00,0x43,0x03,0x01,0x1c,0x03,0xf1,0x15,0x73,0x00,0x36,0x11,0xf9,0x04,
-0x50,0x00,0x0c,0xf1,0x1f,0x90,0xcf,0x20,0x05,0xf9,0x01,0xf9,0x03,0xfb,0x03,0xfd,
-0x10,0x1f,0x90,0x0a,0xf3,0x08,0x32,0x9b,0xf8,0x00,0x39,0x20,0x00,0x0e,0x54,0x1f,
-0xf0,0x26,0x37,0xc1,0x00,0xe8,0x00,0x04,0xff,0xfb,0x30,0x0e,0x80,0x00,0x04,0xae,
-0x00,0x95,0xe8,0xc8,0x03,0x5b,0xf5,0x3f,0x6e,0x89,0xe0,0x8f,0xff,0xfc,0xf3,0xe8,
-0x4f,0x40,0x1f,0xf4,0x8f,0x0e,0x80,0xc4,0x06,0xff,0xe3,0x50,0xe8,0x46,0x01,0xee,
-0xeb,0x40,0x0e,0x9d,0xc0,0x8e,0x9e,0xa1,0x11,0xc0,0x03,0x58,0xe0,0x00,0x4c,0xf6,
-0x00,0x00,0x8e,0x19,0xdf,0xd4,0x24,0x0c,0x20,0xba,0x50,0x00,0x44,0xd0,0xd2,0x3d,
-0x40,0x00,0x01,0xff,0xfa,0x37,0xf8,0x66,0x64,0x03,0x8e,0x56,0x42,0xf5,0x2a,0x81,
-0x5a,0xf5,0x7f,0x59,0xe3,0xf2,0x3f,0xff,0xfc,0xc0,0x9e,0x26,0x00,0x1e,0xf4,0x08,
-0x89,0xe6,0xa0,0x05,0xff,0xe2,0xd9,0x9e,0x6f,0x10,0xde,0xeb,0x6f,0x59,0xe1,0xf6,
-0x6e,0x8e,0x09,0xe0,0x9e,0x0d,0x91,0x57,0xe0,0x77,0x09,0xe0,0x87,0x00,0x7e,0x00,
-0x07,0xde,0x00,0x00,0x07,0xe0,0x00,0xbe,0xc0,0x0c,0x20,0x26,0xbd,0xa6,0x3b,0xf0,
-0x28,0x1f,0xff,0x81,0x6f,0xff,0xfd,0x00,0x18,0xe0,0xbf,0xa5,0x8f,0x90,0x26,0xbf,
-0x65,0x5d,0xcf,0xc0,0x05,0xff,0xff,0x65,0xcf,0xc0,0x00,0x02,0xff,0x4a,0xfb,0xdf,
-0x52,0x00,0x7f,0xfe,0x22,0x8f,0xff,0xf8,0x0e,0xde,0xc6,0xcf,0x72,0xaf,0x26,0xe8,
-0xe0,0x5c,0x7e,0x9f,0x90,0x16,0x8e,0x00,0x92,0x4b,0x30,0x08,0xe0,0x59,0x37,0x2f,
-0x5d,0x8e,0x0a,0xc7,0x10,0x00,0xf9,0x21,0x10,0x60,0x04,0x0f,0x52,0x78,0xfd,0x77,
-0x77,0x01,0x80,0x1f,0xf1,0x0b,0x1f,0x70,0x23,0x00,0x50,0x8f,0x10,0xb6,0x8f,0xd0,
-0x5f,0xd9,0x70,0x09,0xff,0xa1,0x00,0x3c,0xfa,0x00,0x6d,0x96,0x66,0x66,0x7a,0x30,
-0xbc,0x33,0x1a,0x70,0xcd,0x20,0x01,0x6c,0x01,0x30,0x70,0x0e,0xee,0x01,0x00,0x06,
-0x3d,0x07,0x21,0xaf,0x20,0x1e,0x33,0x00,0x6d,0x03,0xf1,0x12,0xf8,0x69,0x66,0x78,
-0x6d,0xe0,0x4c,0x4a,0xf5,0x0b,0xf9,0x89,0x00,0x7f,0xe4,0x01,0x07,0xfe,0x20,0x03,
-0x80,0x08,0xf4,0xe5,0x80,0x01,0x33,0x33,0xbf,0x4d,0xc3,0x30,0x7f,0x76,0x00,0xf4,
-0x0b,0x11,0x22,0x27,0xff,0xc2,0x22,0x20,0x00,0x06,0xfd,0x4f,0xa1,0x00,0x02,0x8d,
-0xfc,0x10,0x5f,0xfb,0x71,0x2e,0xb5,0x00,0x00,0x18,0xdc,0x7f,0x05,0xf0,0x06,0xf4,
-0x0b,0xa3,0xf4,0x6f,0x10,0x0b,0xa0,0xba,0x3f,0x46,0xf1,0x5d,0xed,0xcb,0xc8,0xf9,
-0x9f,0x14,0xaa,0xaa,0x36,0x15,0x30,0x0b,0x08,0x86,0x82,0x38,0x20,0xf3,0xba,0x49,
-0x03,0xf0,0x10,0x0d,0x5d,0x53,0x39,0xf6,0x33,0x00,0xc6,0xf2,0xef,0xff,0xff,0xf3,
-0x07,0x6f,0x5e,0x7e,0x4f,0x5f,0x35,0xdf,0xfd,0xe6,0xe4,0xf4,0xf3,0x4a,0x63,0x0e,
-0x6e,0x4f,0xfa,0x25,0x3a,0xe6,0xd3,0xec,0x17,0x26,0x00,0x08,0x39,0x11,0x8e,0x8b,
-0x51,0xf2,0x01,0xae,0xff,0xff,0x54,0xf9,0x8f,0x3b,0xf3,0xec,0x10,0x2b,0x56,0xd6,
-0x9b,0x49,0xb0,0x95,0x04,0xf2,0x07,0x10,0x00,0x55,0x59,0xf6,0x5a,0xf1,0x00,0x2f,
-0xfe,0xff,0xee,0xee,0x10,0x04,0xf8,0x5a,0xf6,0x55,0x53,0x00,0x6f,0x2e,0x07,0xf4,
-0x02,0x08,0xfd,0xf1,0x01,0xf8,0x02,0x9f,0xe5,0x6f,0x1b,0xef,0x40,0x0b,0x71,0x06,
-0xf1,0x47,0x2f,0x3f,0x00,0xe2,0x11,0x11,0x8e,0x03,0x20,0xf0,0x01,0x7e,0xff,0xff,
-0x63,0xfb,0xce,0x4a,0xf6,0xfc,0x41,0x2b,0x14,0xa4,0xe7,0x07,0x90,0x6a,0x00,0x10,
-0xe6,0xbe,0x13,0xf0,0x02,0xfb,0x28,0xfe,0x83,0x04,0xef,0xef,0xff,0xff,0xbf,0xf8,
-0x09,0x51,0x44,0x44,0x42,0x27,0x53,0x2b,0x00,0x48,0x07,0xc5,0x5f,0x53,0x33,0x4f,
-0x70,0x00,0x05,0xf7,0x55,0x56,0xf7,0x00,0x74,0x01,0x02,0xaa,0x00,0xf0,0x04,0xb2,
-0x21,0x9e,0x32,0x21,0x08,0xff,0xff,0xcf,0xff,0xff,0x83,0xf8,0x9d,0x1a,0xd1,0xbc,
-0x10,0x02,0xd8,0x11,0x80,0xf5,0x00,0x09,0xf8,0x88,0x88,0xaf,0x50,0x7d,0x03,0xf3,
-0x07,0x79,0xf5,0x00,0x09,0xfd,0xdd,0xdd,0xef,0x50,0x00,0x9f,0xbb,0xbb,0xbc,0xf5,
-0x00,0x34,0x5f,0xa4,0x4d,0xe4,0x31,0x32,0x05,0x30,0x37,0xee,0x10,0x36,0x31,0x20,
-0xd8,0x10,0xa1,0x13,0x0a,0x20,0x0e,0xf2,0x0a,0x71,0x10,0x8e,0x11,0x10,0x09,0xff,
-0xff,0x8e,0xff,0xff,0x54,0xf7,0x7f,0x28,0xe1,0xbd,0x00,0x0a,0x33,0x98,0xf6,0x36,
-0x73,0x00,0x17,0x02,0x00,0x6f,0x11,0x70,0x88,0xbf,0x10,0x07,0xf8,0x77,0x78,0xce,
-0x6a,0x01,0x96,0x00,0x20,0x07,0xf6,0xff,0x0a,0x21,0x00,0x7f,0x6d,0x12,0x63,0x07,
-0xf4,0x33,0x33,0x8f,0x20,0x0d,0x00,0x04,0xb0,0x00,0x61,0xb1,0x10,0x9e,0x21,0x10,
-0x07,0xb0,0x00,0xe0,0x92,0xf9,0xbb,0x3d,0xc3,0xec,0x21,0x04,0x2d,0x82,0x24,0x47,
-0x64,0x01,0x71,0x61,0xf0,0x1e,0xff,0xf2,0x07,0x8e,0xb8,0x4c,0xa0,0x5f,0x20,0xda,
-0xeb,0xd8,0xca,0x04,0xf2,0x0d,0xef,0xef,0x8c,0xa3,0x9f,0x20,0xdb,0xec,0xe8,0xca,
-0x6f,0xb0,0x06,0x7e,0xb7,0x5c,0xa0,0x05,0x63,0xff,0xff,0xfd,0xcd,0x66,0xcc,0x00,
-0x0d,0x70,0x06,0x11,0x10,0x03,0xe5,0x07,0x10,0xa1,0x28,0x0f,0x31,0x3d,0xaa,0xeb,
-0xf7,0x23,0xf0,0x20,0xcf,0x26,0x6f,0xb6,0x61,0x0d,0xef,0xb1,0xcc,0xfe,0xcc,0x02,
-0x9d,0xd8,0x8a,0xaf,0xda,0xa6,0x3c,0xff,0xb4,0x88,0x88,0x87,0x30,0x2f,0xf3,0x0f,
-0xff,0xff,0xd0,0x09,0xff,0xe2,0xf9,0x77,0xcd,0x03,0xfe,0xbc,0x3f,0x97,0x7c,0xd0,
-0x5c,0xba,0x00,0x7e,0x06,0xc4,0x2a,0xa0,0x0f,0x50,0x3b,0xd0,0x00,0xaa,0x00,0xf4,
-0x0b,0xf8,0xfd,0x47,0x02,0xb5,0x05,0x63,0x15,0x55,0x6f,0xa5,0x55,0x30,0x67,0x26,
-0x10,0x14,0x0d,0x00,0x22,0x20,0x3f,0x80,0x5c,0x60,0x11,0x6d,0xe7,0x26,0xc3,0x10,
-0x41,0x08,0xa0,0xe8,0x20,0x00,0x02,0x6b,0xfc,0x51,0xbe,0x30,0x06,0xe0,0x02,0xf3,
-0x06,0xef,0x40,0x26,0xc9,0x2c,0xb1,0x83,0x60,0x18,0xee,0x86,0xeb,0x2a,0xfa,0x10,
-0x98,0x15,0xfe,0x50,0x04,0xb2,0xac,0x06,0x04,0xbf,0x28,0x52,0x45,0xfa,0x44,0x44,
-0x04,0xe9,0x05,0xf0,0x0b,0x4f,0x65,0x7f,0xe5,0x75,0x6f,0x73,0xb2,0x8f,0xa1,0x5f,
-0x80,0xb5,0x00,0xaf,0xed,0xed,0x67,0x10,0x00,0x02,0x8f,0xe7,0x12,0xed,0x10,0xd2,
-0x21,0xf3,0x09,0xed,0xec,0x00,0x37,0xe8,0x2c,0xb2,0x84,0x70,0x18,0xfd,0x86,0xeb,
-0x2b,0xf9,0x10,0x97,0x07,0xfe,0x50,0x05,0x91,0x00,0x34,0x5d,0x28,0x10,0x1f,0x1e,
-0x2b,0xf0,0x20,0xf4,0x71,0xfb,0xde,0x9f,0x60,0x8b,0x6f,0x3f,0x4a,0xb1,0xf6,0x3f,
-0xbe,0x81,0xf4,0xab,0x1f,0x65,0xff,0xf1,0x1f,0x4a,0xb1,0xf6,0x02,0xe8,0xb1,0xfa,
-0xdd,0x8f,0x60,0xbd,0x5f,0x5f,0xff,0xff,0xf6,0x4f,0xeb,0xc6,0xf4,0xab,0x1f,0x60,
-0x62,0x4a,0x1a,0x00,0xf0,0x05,0x2f,0x89,0xe5,0xf8,0xcd,0x5f,0x65,0xd6,0xb7,0x6f,
-0xff,0xff,0xf6,0x69,0x23,0x01,0xf6,0x22,0x3e,0x50,0x97,0x05,0x00,0x4c,0x01,0x30,
-0xc0,0x00,0xdc,0x17,0x3e,0xf0,0x32,0x10,0x6f,0xff,0xfb,0x00,0xac,0x7e,0x4f,0xf6,
+0xf5,0xe7,0x5e,0x00,0x02,0xdf,0xfc,0x00,0x01,0x00,0x70,0x4f,0x91,0x11,0x00,0x00,
+0x00,0x3e,0xe7,0x01,0xa0,0x00,0x7f,0xd3,0x22,0xde,0x10,0x00,0x0c,0xff,0xff,0x35,
+0x03,0x81,0x03,0x55,0x55,0x55,0xbe,0x00,0x00,0x6f,0x0d,0x00,0x12,0x04,0x0d,0x00,
+0x11,0xcf,0x0d,0x00,0xf0,0x4b,0x11,0x34,0x5f,0x50,0x07,0x60,0x0a,0xea,0xe0,0xbf,
+0x25,0xbe,0x12,0xf8,0x9f,0x66,0x89,0xf6,0xf7,0x19,0x14,0xdf,0xff,0xfa,0x07,0x20,
+0x01,0xf4,0x00,0x09,0xf0,0x00,0x00,0x1f,0x49,0xff,0xff,0xff,0xf2,0x03,0xfe,0x66,
+0x6b,0xf6,0x66,0x04,0xef,0xcc,0xbb,0xef,0xbb,0x90,0x6d,0xf5,0xbb,0xbd,0xfb,0xbb,
+0x69,0xaf,0x45,0x88,0x88,0x88,0x73,0x24,0xf4,0x1f,0xff,0xff,0xfa,0x00,0x1f,0x41,
+0xfa,0x77,0x7e,0xa0,0x01,0xf4,0x1f,0xa7,0x77,0xea,0x00,0x1f,0x41,0xff,0xff,0xff,
+0x0d,0x00,0x20,0x61,0x36,0x0d,0x00,0xf0,0x4b,0xf4,0x01,0xfe,0x50,0x00,0x3f,0x40,
+0x6f,0xff,0xfe,0x00,0x25,0xf6,0x26,0xf3,0x3a,0xe0,0x5f,0xff,0xff,0x7f,0xaa,0xde,
+0x00,0x2b,0xf6,0x26,0xfd,0xde,0xe0,0x03,0xff,0xf6,0x6f,0x44,0xae,0x01,0xde,0xfb,
+0xf8,0xfd,0xde,0xe0,0x6e,0x4f,0x43,0x6f,0x65,0xbe,0x00,0x12,0xc3,0x09,0xdd,0xdd,
+0xc0,0x07,0x75,0x86,0xf7,0x01,0xd7,0x00,0xea,0x9e,0x08,0xa5,0x8c,0xf1,0x5f,0x48,
+0xf6,0x66,0xce,0x3f,0x60,0x50,0x3d,0xff,0xff,0x60,0x10,0x00,0x00,0x04,0xc3,0x00,
+0x00,0x00,0x7f,0xde,0x00,0xf0,0x01,0x70,0x01,0x29,0xe3,0x23,0xfa,0x21,0x01,0xbb,
+0xdf,0xcb,0xcf,0xdb,0xb1,0x1b,0xbb,0x01,0x00,0xf2,0x27,0x10,0x07,0xbb,0xbb,0xbb,
+0xb8,0x00,0x00,0xae,0x66,0x66,0x6e,0xb0,0x00,0x0a,0xfb,0xbb,0xbb,0xfb,0x00,0x00,
+0xaf,0xbb,0xbb,0xbf,0xb0,0x00,0x03,0x33,0xbf,0x63,0x36,0x00,0x04,0xf7,0xf6,0xcd,
+0x24,0xf5,0x01,0xdc,0x4f,0x74,0x5d,0x8a,0xe0,0x19,0x21,0xcf,0xff,0xe3,0x26,0x00,
+0x00,0xa4,0x04,0xf6,0x3e,0x0d,0xc3,0x20,0xf6,0x39,0x20,0x2d,0xe3,0xcd,0x1f,0xfe,
+0x93,0x07,0xff,0xfe,0xf9,0xf8,0x07,0x80,0x0b,0xbb,0xbc,0x2a,0xff,0xe7,0x00,0xe8,
+0x15,0xf2,0xe5,0x02,0x00,0x0e,0xed,0xef,0x2f,0xaa,0xf8,0x00,0xec,0xab,0xf2,0xfb,
+0x55,0x60,0x0e,0x72,0xcf,0x1e,0xed,0xfb,0x00,0x62,0x05,0x7d,0x25,0x68,0x30,0x0e,
+0x6e,0x91,0xf6,0x52,0xf9,0x08,0xf2,0xeb,0x35,0x4e,0x6a,0xf0,0x26,0x07,0xff,0xff,
+0xd1,0x36,0x9c,0x01,0x31,0x04,0xf6,0xd9,0xa3,0x01,0x31,0x66,0xf7,0x00,0xf6,0x01,
+0xfa,0x2c,0xf7,0x08,0xf8,0x77,0x8f,0xb7,0x77,0x30,0x8f,0x32,0x21,0xf9,0x0b,0x60,
+0x09,0xff,0xff,0x4e,0xb5,0xf5,0x00,0x9f,0x47,0xf3,0xce,0xce,0x00,0x0a,0xf0,0x4f,
+0x38,0xff,0x60,0x00,0xbd,0x28,0xf2,0x6f,0xc0,0x71,0x0f,0xbc,0xfd,0x5f,0xfc,0x0d,
+0x75,0xf7,0x23,0x8f,0xe9,0xfc,0xf4,0x4e,0x10,0x04,0xc1,0x08,0xeb,0xf5,0x01,0xf2,
+0x0d,0x01,0x23,0x46,0x8a,0xdc,0x00,0x04,0xff,0xff,0xff,0xc9,0x61,0x00,0x05,0x43,
+0x3f,0x80,0x00,0x00,0x01,0x55,0x56,0xfb,0x55,0x55,0x00,0x4f,0xff,0xe3,0x01,0xc1,
+0x13,0xf9,0x11,0x11,0x01,0x77,0x77,0x8f,0xc7,0x77,0x75,0x3f,0x72,0x06,0x51,0xa0,
+0x00,0x00,0x1f,0x90,0x3c,0x00,0x10,0xf8,0x06,0x00,0x20,0x58,0x9f,0x43,0x05,0x36,
+0x06,0xff,0xb2,0x55,0x00,0xf4,0x3e,0xf8,0x05,0xff,0xff,0xff,0x01,0x2f,0x92,0x6f,
+0x87,0x7c,0xf0,0xaf,0xff,0xf7,0xf2,0x00,0x9f,0x06,0xaf,0xda,0x6f,0x20,0x09,0xf0,
+0x00,0xf8,0x06,0xf4,0x22,0xaf,0x00,0x0f,0x94,0x7f,0xff,0xff,0xf0,0x7b,0xff,0xfa,
+0xf5,0xde,0x44,0x09,0xcf,0xa2,0x9e,0x08,0xf2,0x00,0x00,0xf8,0x0d,0xc0,0x3f,0x80,
+0x00,0x0f,0x82,0xf8,0x00,0xcf,0x20,0x36,0xf7,0xcf,0x20,0x03,0xfe,0x45,0xfd,0x28,
+0x70,0x00,0x04,0xc1,0x55,0x00,0x20,0xca,0x0a,0xaf,0x01,0xf3,0x04,0x1d,0xb1,0xae,
+0x6f,0xb7,0xf7,0x3f,0xff,0xea,0xc0,0xe8,0x1f,0x73,0xef,0xfd,0xae,0x7f,0xb7,0xf7,
+0x1a,0x00,0xf0,0x06,0x0c,0xb2,0xac,0x0e,0x81,0xf7,0x16,0xef,0xda,0xe7,0xfb,0x7f,
+0x71,0xdf,0xd5,0x6a,0xff,0xfe,0x94,0x00,0xca,0xa5,0x04,0x30,0x00,0x0c,0xa0,0xa5,
+0x04,0x21,0x05,0xea,0x0d,0x00,0x20,0xde,0x50,0x0d,0x00,0x00,0x01,0x00,0x00,0xee,
+0x02,0x10,0xda,0x3b,0x00,0xf1,0x05,0x20,0x0d,0xa0,0xaf,0x77,0x77,0x71,0x6f,0xff,
+0xea,0xe0,0x00,0x00,0x06,0xef,0xfd,0xaf,0x66,0x66,0x30,0x1a,0x00,0xf1,0x15,0xf8,
+0x00,0x0d,0xc6,0xae,0x00,0x0e,0x80,0x4b,0xff,0xfb,0xe1,0x11,0xe8,0x05,0xdf,0xb0,
+0xaf,0xff,0xff,0x80,0x00,0xda,0x0a,0xf5,0x55,0x52,0x00,0x0d,0xa0,0xae,0x00,0x00,
+0x00,0x16,0xea,0x7c,0x00,0x6a,0xfe,0x40,0x68,0x88,0x88,0x84,0x5a,0x01,0xf2,0x3f,
+0x5f,0x00,0x00,0x5e,0x10,0x00,0x05,0xf0,0x04,0x47,0xf9,0x44,0x15,0xaf,0x85,0xff,
+0xff,0xff,0xf5,0xaf,0xff,0x7f,0x62,0x65,0x22,0x00,0x5f,0x03,0xf4,0x0d,0xc0,0x00,
+0x05,0xf5,0x5f,0x41,0xf7,0x00,0x06,0xcf,0xf9,0xf3,0x6f,0x20,0x00,0xbe,0xf3,0x6f,
+0x1b,0xd5,0xf1,0x00,0x5f,0x09,0xf2,0xf7,0x0f,0x70,0x05,0xf1,0xdb,0x9f,0x11,0xad,
+0x03,0xaf,0x5f,0x7f,0xff,0xff,0xf3,0x5f,0x93,0xb0,0x99,0x65,0x3d,0x50,0x54,0x00,
+0xf0,0x0d,0x03,0xf2,0x00,0x04,0xf2,0x00,0x00,0x3f,0x20,0x77,0x9f,0x87,0x50,0x59,
+0xf9,0x2e,0xff,0xff,0xfb,0x0a,0xef,0xe3,0x00,0x4f,0x20,0x00,0x03,0xf2,0x18,0x02,
+0xfb,0x1e,0x50,0x3f,0x65,0x66,0x66,0xce,0x62,0x6b,0xff,0x87,0x77,0x7c,0xe7,0x2b,
+0xef,0x56,0xff,0xff,0xff,0xf4,0x03,0xf2,0x05,0xc0,0x09,0xd0,0x00,0x3f,0x20,0x2f,
+0x90,0x9d,0x00,0x39,0xf2,0x00,0x67,0x5c,0xd0,0x04,0xfb,0x00,0x00,0x1f,0xf7,0xff,
+0x03,0xf0,0x27,0x0b,0xc0,0xcf,0xff,0xfc,0x90,0x01,0xbc,0x12,0x32,0xf8,0x00,0x03,
+0xff,0xfd,0xff,0xff,0xff,0xfa,0x2c,0xff,0xac,0xcc,0xfe,0xcc,0x80,0x0b,0xc0,0x34,
+0x4f,0xa4,0x41,0x00,0xbc,0x1b,0xff,0xff,0xff,0x61,0x7e,0xfd,0xbc,0x4f,0xa5,0xf6,
+0x4f,0xfe,0x3b,0xfe,0xff,0xef,0x60,0x1b,0xc0,0x0d,0x00,0xf0,0x0e,0x00,0xbc,0x0b,
+0xff,0xff,0xff,0x60,0x7e,0xc0,0x54,0x0f,0x70,0x52,0x0d,0xe6,0x00,0x00,0xf7,0x00,
+0x00,0x06,0xf0,0x00,0x09,0xb0,0x00,0x00,0x6f,0x03,0x45,0x02,0xf0,0x00,0x7c,0xfa,
+0x27,0xf6,0x5c,0xb5,0x08,0xef,0xc1,0x0e,0x61,0xf6,0x00,0x06,0xf0,0x45,0x07,0xf0,
+0x01,0x30,0x6f,0x63,0x56,0xf9,0x55,0x51,0x6d,0xff,0x65,0x8f,0x85,0x55,0x1b,0xef,
+0x4c,0x1f,0x01,0xf4,0x0b,0x06,0xf0,0x09,0xf3,0x0e,0xa0,0x00,0x6f,0x00,0x9e,0xfd,
+0xf2,0x00,0x3a,0xf0,0x46,0xaf,0xff,0xd5,0x06,0xf9,0x0b,0xda,0x50,0x3b,0x90,0xa4,
+0x00,0xf4,0x3e,0xd9,0x00,0x6b,0x3c,0x10,0x00,0x0d,0x90,0x0d,0xb1,0xe7,0x00,0x3c,
+0xfe,0xb4,0xff,0xff,0xff,0x33,0xaf,0xda,0xdf,0xa8,0xfa,0x71,0x00,0xda,0xaf,0xf7,
+0x4f,0x83,0x00,0x0d,0xbd,0xbf,0xff,0xff,0xf1,0x2a,0xff,0xd2,0xf7,0x3f,0x72,0x04,
+0xff,0xc2,0x2f,0xa7,0xfa,0x70,0x01,0xd9,0x02,0xff,0xef,0xfe,0x00,0x0d,0x90,0x2f,
+0x62,0xf6,0x10,0x08,0xf9,0x02,0xff,0xff,0xff,0x80,0xde,0x40,0x2f,0x95,0x55,0x52,
+0x5b,0x03,0xe0,0xf1,0x06,0xc0,0x05,0xe2,0x00,0x4f,0x10,0x1f,0x60,0xdb,0x00,0x7c,
+0xfb,0xd9,0x04,0xf4,0x2c,0x68,0xef,0xd5,0x66,0x66,0x66,0x62,0x04,0xf1,0x6b,0xbb,
+0x13,0x4d,0x00,0x4f,0x48,0xea,0xf5,0xf4,0xf0,0x5b,0xff,0xad,0x8f,0x5f,0x4f,0x09,
+0xef,0x58,0xd9,0xf5,0xf4,0xf0,0x04,0xf1,0x8d,0x9f,0x5f,0x4f,0x00,0x4f,0x18,0xd9,
+0xf4,0xb4,0xf0,0x39,0xf1,0x8a,0x6f,0x13,0x8f,0x05,0xfa,0x08,0xab,0xa0,0x7f,0xa0,
+0x55,0x00,0x30,0xf0,0x00,0xad,0xb0,0x03,0xe0,0x00,0x3f,0xff,0xf6,0x00,0x5b,0xfa,
+0x3e,0xb2,0x9e,0x10,0x06,0xdf,0xcb,0x0c,0x01,0xf0,0x0e,0x04,0xf0,0x1f,0x79,0x78,
+0x8e,0x00,0x4f,0x70,0xe7,0xf3,0xe6,0xe0,0x6d,0xff,0x1e,0xe9,0x1a,0xce,0x08,0xdf,
+0x20,0xe5,0x5f,0x36,0xe0,0x04,0xf0,0xcf,0x5e,0x03,0xf3,0x05,0x4f,0x02,0x34,0xff,
+0xd4,0x32,0x2a,0xf0,0x27,0xed,0x2c,0xd7,0x23,0xfa,0x0e,0xe8,0x10,0x07,0xd7,0x00,
+0xfe,0x01,0xf0,0x27,0xf1,0x04,0xff,0xff,0xc0,0x00,0x3f,0x10,0x4f,0x11,0x7c,0x00,
+0x9e,0xfd,0x14,0xfe,0xee,0xc0,0x09,0xef,0xd1,0x27,0x76,0x75,0x00,0x03,0xf1,0x7f,
+0xff,0x6f,0xff,0x00,0x3f,0x77,0xa4,0xf6,0xd4,0xf0,0x6c,0xff,0x9f,0xff,0x7f,0xff,
+0x09,0xef,0x22,0x33,0x9f,0x53,0x30,0x03,0xf1,0xaf,0x6e,0x01,0xf0,0x04,0x3f,0x10,
+0x2c,0xff,0xf7,0x00,0x18,0xf4,0xaf,0xd9,0xf8,0xfc,0x21,0xfb,0x1c,0x60,0x7f,0x23,
+0xa0,0xc1,0x03,0x12,0x20,0xad,0x00,0xf0,0x27,0x50,0x00,0x00,0xef,0xff,0xe0,0xbf,
+0x00,0x00,0x0e,0xa3,0xae,0x0e,0xc0,0x00,0x00,0xe9,0x19,0xe3,0xff,0xff,0xf8,0x0e,
+0xff,0xfe,0xaf,0xdc,0xfe,0x60,0xe8,0x09,0xff,0xf6,0x3f,0x70,0x0e,0xff,0xff,0xfe,
+0xb7,0xf3,0x00,0xea,0x3a,0xe2,0x8f,0xcf,0x00,0x0e,0xa4,0xbe,0x02,0xff,0x90,0x34,
+0x00,0xf0,0x09,0x0e,0xf4,0x00,0x05,0xc3,0xc3,0x07,0xff,0xc0,0x01,0xec,0x0b,0xeb,
+0xfc,0x9f,0xd3,0x7f,0x20,0x28,0xf9,0x00,0x8f,0x40,0x10,0x09,0x0a,0xf1,0x40,0x10,
+0x08,0x2f,0x78,0x52,0xd3,0x00,0x00,0xc9,0xf9,0xf4,0x5f,0x20,0x00,0x3c,0xaf,0xcc,
+0x88,0xf7,0x77,0x34,0xae,0xff,0xc9,0xcf,0xff,0xf6,0x19,0xff,0xdf,0x7f,0xe0,0xf7,
+0x05,0xd3,0xc6,0x4b,0xff,0x5f,0x40,0x05,0x9e,0x54,0x76,0xed,0xf1,0x02,0xff,0xff,
+0xf6,0x09,0xfb,0x00,0x08,0xf2,0x8e,0x10,0x6f,0x80,0x00,0x5d,0xff,0x60,0x2e,0xff,
+0x20,0x16,0xdf,0xec,0x6f,0xd2,0xee,0x45,0xfa,0x20,0x2d,0xb1,0x02,0xd3,0x03,0x09,
+0x05,0xb9,0x03,0x32,0x00,0x00,0x3f,0x16,0x02,0x41,0xed,0x00,0x00,0x02,0x97,0x04,
+0xb0,0xfa,0x18,0x9f,0xd8,0x88,0xaf,0xc8,0x50,0x00,0xae,0x00,0x71,0x07,0x40,0x03,
+0xf8,0x01,0xec,0x36,0x08,0x30,0xf4,0xbf,0x30,0x97,0x05,0x20,0xff,0x70,0xf0,0x00,
+0x10,0xbf,0xf5,0x02,0xe1,0x18,0xff,0x9c,0xfd,0x50,0x02,0xcf,0xfc,0x30,0x07,0xff,
+0xf8,0x0b,0x93,0x09,0x09,0x22,0x00,0x02,0x0d,0x05,0xf0,0x08,0xf7,0x00,0x04,0x8d,
+0xc0,0x1e,0xef,0xfe,0xbb,0xfc,0x83,0x00,0x7e,0x58,0xe4,0xbb,0x00,0x00,0x02,0xf2,
+0x9c,0x0b,0xb0,0x20,0x05,0xf1,0x22,0xfe,0xbf,0xdd,0xd7,0x14,0x4d,0xb4,0x4b,0xea,
+0xfd,0x51,0x55,0xeb,0x54,0xba,0x0f,0x80,0x3e,0xef,0xfe,0xac,0x90,0xf8,0x00,0x66,
+0xca,0xa1,0xe8,0x0f,0x80,0x1f,0x6c,0x9c,0xaf,0x60,0xf8,0x01,0x93,0xd9,0x39,0xf2,
+0x0f,0x80,0x00,0xad,0x40,0x5a,0x00,0xf8,0x52,0x00,0x16,0x02,0xba,0x0a,0x12,0x3f,
+0xc4,0x03,0x10,0xeb,0x1c,0x0b,0x01,0xc3,0x05,0xa1,0x09,0x99,0xfe,0x99,0x99,0x99,
+0x40,0x00,0x0f,0xb0,0x19,0x00,0xe1,0xff,0xff,0xff,0xf1,0x00,0x00,0x3f,0xb8,0x88,
+0xcf,0x00,0x00,0x07,0xf3,0x3e,0x07,0xf0,0x02,0xee,0x00,0x00,0xbd,0x00,0x00,0x9f,
+0x60,0x00,0x0e,0xb0,0x00,0xbf,0xb0,0x07,0x79,0xf7,0xcb,0x04,0x24,0xaf,0xfb,0x54,
+0x00,0xf3,0x3f,0x0e,0xff,0xf7,0xbe,0xee,0xed,0x00,0xeb,0x5f,0x75,0x78,0xf9,0x60,
+0x0e,0x80,0xe7,0x16,0x4f,0x20,0x00,0xef,0xff,0x77,0xf4,0xf1,0x00,0x0e,0x90,0xe7,
+0xcc,0x7f,0x43,0x00,0xef,0xef,0x8e,0xff,0xff,0xf1,0x0e,0xb6,0x63,0x11,0xeb,0x00,
+0x00,0xe8,0x2a,0x00,0x4f,0xf4,0x00,0x0e,0x82,0xf6,0x0a,0xff,0x50,0x00,0xfd,0xff,
+0xd3,0xf9,0xe5,0x92,0x4f,0xe7,0x48,0xee,0x1e,0x9d,0x30,0x91,0x00,0x6f,0x30,0x9f,
+0xc0,0x60,0x01,0x00,0x9b,0x00,0xa7,0xf0,0xfd,0x88,0x88,0x8d,0xf0,0xf9,0x00,0x00,
+0x09,0x05,0x00,0x02,0x19,0x00,0x37,0x99,0x99,0x9d,0x14,0x00,0x42,0xfc,0x88,0x88,
+0x8c,0x19,0x00,0x21,0xfa,0x00,0xb2,0x00,0xf3,0x10,0x00,0x12,0x22,0x22,0x01,0xff,
+0xff,0x38,0xff,0xff,0xf1,0x1f,0x98,0xf3,0x8f,0x33,0x9f,0x11,0xf5,0x2f,0x38,0xf0,
+0x07,0xf1,0x1f,0x63,0xf3,0x8f,0x88,0xbf,0x11,0x1a,0x00,0xf1,0x0a,0x86,0xf3,0x8f,
+0x00,0x7f,0x11,0xf5,0x2f,0x39,0xf7,0x7b,0xf1,0x1f,0xff,0xf3,0xcf,0xdd,0xef,0x11,
+0xfa,0x77,0x2f,0x80,0x07,0xf1,0xfa,0x00,0xe4,0x7f,0x10,0x00,0x03,0xfb,0x02,0x7c,
+0xf0,0x00,0x00,0x3d,0x10,0x2f,0xe8,0xa8,0x06,0xf1,0x37,0x11,0x10,0x00,0xe9,0x00,
+0x02,0xff,0xfe,0x26,0x6f,0xc6,0x61,0x2f,0x8b,0xe6,0xee,0xff,0xee,0x22,0xf4,0x8e,
+0x00,0x0e,0x90,0x00,0x2f,0x8b,0xed,0xff,0xff,0xff,0x82,0xff,0xfe,0x45,0x55,0x8f,
+0x73,0x2f,0x48,0xe8,0x99,0x9b,0xfa,0x42,0xf4,0x8e,0x7a,0x98,0xaf,0xa4,0x2f,0xff,
+0xe1,0xf9,0x04,0xf3,0x02,0xf9,0x66,0x08,0xf4,0x4f,0x30,0x1c,0x30,0x00,0x06,0x79,
+0xf3,0x42,0x09,0x15,0xfb,0x94,0x01,0x11,0xef,0xe3,0x06,0x00,0x10,0x06,0xf1,0x07,
+0xae,0x00,0x00,0xef,0xee,0xee,0xef,0xe0,0x00,0x0e,0xc9,0x99,0x99,0xde,0x00,0x02,
+0x77,0x7b,0xf9,0x77,0x72,0x04,0xa9,0x01,0x10,0xf2,0x52,0x0b,0xf1,0x15,0x99,0x60,
+0x00,0x09,0xe6,0x66,0x66,0xeb,0x00,0x00,0x9f,0xee,0xee,0xef,0xb0,0x00,0x03,0xb6,
+0x5f,0x68,0x82,0x00,0x2a,0xfd,0x56,0xf4,0x7e,0xf7,0x00,0xa6,0x0a,0xfc,0x10,0x08,
+0x90,0x2f,0x2e,0x00,0xf0,0x01,0x21,0x55,0x55,0x8f,0xa5,0x55,0x51,0x00,0x44,0x47,
+0xf9,0x44,0x41,0x00,0x0f,0xff,0x96,0x05,0x6f,0x00,0xf8,0x36,0xf8,0x35,0xf5,0x0d,
+0x00,0x02,0x30,0x8d,0x3c,0xe1,0xde,0x00,0x20,0xef,0xf8,0x4d,0x06,0xc4,0xaf,0xff,
+0xfe,0xb9,0x88,0x51,0xee,0x92,0x15,0x9c,0xde,0xf4,0x4a,0x0d,0x51,0xee,0xee,0xfe,
+0xef,0xf0,0x3f,0x02,0x31,0x8f,0x00,0x1f,0x62,0x00,0xf0,0x0d,0x80,0x27,0x77,0x9f,
+0xa7,0xcf,0x21,0x01,0x99,0x9a,0xfb,0x99,0x90,0x00,0x5e,0xee,0xff,0xfe,0xee,0x80,
+0x18,0x88,0x8a,0xfa,0x88,0x88,0x41,0x89,0x8a,0x0c,0x31,0x84,0x00,0xbf,0x4c,0x02,
+0xf1,0x04,0x0b,0xe8,0x88,0x88,0xcf,0x10,0x00,0xbe,0x77,0x77,0x7b,0xf1,0x00,0x0b,
+0xfe,0xee,0xee,0xff,0x10,0xde,0x01,0xf2,0x0d,0x90,0x00,0x0f,0x60,0x00,0x00,0xf9,
+0x00,0x00,0xff,0xee,0xee,0xef,0x90,0x00,0x0f,0xb8,0x88,0x88,0xf9,0x00,0x12,0x88,
+0x88,0x88,0x88,0x51,0x09,0xf1,0x00,0xf4,0x19,0x08,0xf8,0xbf,0x68,0x88,0x86,0x00,
+0x7f,0x8b,0xf6,0xfc,0xaf,0xa0,0x07,0xff,0xff,0x1b,0xc6,0xf3,0x00,0x8f,0x5a,0xf6,
+0x1f,0xf9,0x00,0x9f,0xff,0xff,0xbb,0xfe,0xfa,0x22,0x42,0x06,0xf4,0xb3,0x07,0xb0,
+0x00,0x98,0x04,0x10,0xe4,0x99,0x0d,0x62,0x77,0xbf,0x97,0x77,0x77,0x31,0xdb,0x02,
+0x31,0x00,0x09,0xf3,0x19,0x00,0x00,0x0d,0x00,0xf0,0x0e,0x00,0x03,0xef,0xe6,0x66,
+0x6b,0xf0,0x03,0xfe,0xdf,0xdd,0xdd,0xef,0x00,0x08,0x1b,0xd5,0x55,0x5a,0xf0,0x00,
+0x00,0xbf,0xdd,0xdd,0xff,0x00,0x00,0x0b,0x1a,0x00,0x60,0x00,0x00,0xbc,0x00,0x27,
+0xcf,0x81,0x06,0xf5,0x43,0x02,0xfe,0x80,0x00,0x06,0xf0,0x6f,0x0a,0xff,0xff,0x16,
+0xff,0xff,0xfe,0xad,0x6a,0xf1,0x4d,0xfb,0xdf,0xaa,0xb0,0x6f,0x10,0x6f,0x38,0xf0,
+0xad,0x5a,0xf1,0x06,0xff,0xff,0x0a,0xff,0xff,0x10,0x6f,0x48,0xf0,0xab,0x06,0xf1,
+0x06,0xfd,0xef,0x0b,0xd7,0xbf,0x12,0x9f,0x48,0xf4,0xcf,0xde,0xf1,0x8f,0xff,0xff,
+0xde,0x80,0x6f,0x10,0x4c,0x39,0x83,0xf6,0x06,0xf1,0x1d,0xd0,0x5f,0xbf,0x26,0xbf,
+0x03,0xd2,0x00,0x55,0xa0,0xbf,0x90,0xea,0x01,0x12,0x02,0xef,0x06,0x23,0x2f,0x80,
+0x7f,0x03,0x30,0xf9,0x00,0x07,0x41,0x09,0x12,0x40,0x1a,0x00,0x05,0x92,0x03,0x50,
+0x9f,0xff,0xc9,0x99,0x40,0xf8,0x0a,0xf2,0x11,0x30,0x00,0x00,0x1c,0xf7,0xf9,0xdf,
+0x40,0x00,0x7f,0xf5,0x2f,0x71,0xdf,0xa1,0x3f,0xd3,0x02,0xf7,0x00,0x9f,0x80,0x30,
+0x00,0x2f,0x70,0x00,0x30,0x00,0x00,0x05,0xf5,0xe3,0x07,0x32,0x50,0x00,0x00,0xf6,
+0x01,0x73,0x31,0x88,0x88,0xaf,0xa8,0x88,0x82,0x1a,0x00,0x11,0x8f,0x27,0x09,0xf0,
+0x18,0x05,0x88,0xbf,0xff,0xb8,0x85,0x00,0x00,0x2e,0xff,0xfe,0x30,0x00,0x00,0x3e,
+0xe7,0xf6,0xdf,0x40,0x01,0x9f,0xe2,0x5f,0x51,0xdf,0xb2,0x4f,0xb1,0x05,0xf5,0x01,
+0xaf,0x40,0x30,0x00,0x5f,0x50,0x00,0x20,0x50,0x00,0x00,0x04,0xf5,0x00,0x01,0x00,
+0xc0,0x4f,0x50,0x00,0x00,0x18,0x88,0x8a,0xfa,0x88,0x88,0x12,0xff,0x01,0x00,0xf9,
+0x19,0xf3,0x00,0x05,0xfb,0xfb,0xf4,0x00,0x00,0x00,0xce,0x5f,0x6f,0xc0,0x00,0x00,
+0x5f,0x74,0xf5,0x8f,0x60,0x00,0x2f,0xd0,0x4f,0x50,0xdf,0x40,0x3e,0xfc,0x9b,0xfb,
+0x9c,0xff,0x43,0xe4,0xff,0xff,0xff,0xf5,0xd1,0x41,0x00,0x04,0x01,0x00,0x20,0x0b,
+0xd1,0x06,0x00,0xf0,0x18,0x09,0xff,0xff,0xfe,0x50,0x00,0x3d,0xff,0x85,0x8f,0xe1,
+0x00,0x0c,0xe6,0xcf,0x9f,0xe2,0x00,0x00,0x11,0x38,0xff,0xfa,0x51,0x00,0x4c,0xff,
+0xe9,0x48,0xef,0xfe,0x41,0xb7,0x40,0x4f,0x40,0x26,0x80,0x01,0x6e,0x00,0xf4,0x0c,
+0xf4,0x00,0x05,0xa6,0x8f,0x86,0x85,0x10,0x00,0x8f,0x54,0xf4,0x8f,0x50,0x00,0xbf,
+0x63,0x8f,0x30,0xaf,0x40,0x02,0x30,0x6f,0xc0,0x00,0x70,0x54,0x00,0xf1,0x30,0x08,
+0xe0,0x00,0xae,0x00,0x00,0x00,0x8e,0x02,0x5c,0xe5,0x50,0x00,0x3a,0xf3,0x6f,0xff,
+0xff,0x00,0x3f,0xff,0xf5,0x2f,0x65,0xf2,0x10,0x2d,0xf2,0x3d,0xe0,0x5f,0x8b,0x01,
+0xff,0x8b,0xe4,0x66,0xde,0x60,0x7f,0xff,0x50,0x0f,0x90,0x00,0x1e,0xee,0x78,0x77,
+0xfc,0x77,0x47,0xe8,0xe0,0xef,0xff,0xff,0xf9,0x15,0x8e,0x00,0x00,0xf9,0x41,0x00,
+0x42,0x0f,0x90,0x00,0x00,0x0d,0x00,0x03,0x01,0x00,0xf6,0x3e,0x0e,0x80,0x05,0xe1,
+0x00,0x00,0x00,0xe8,0x00,0xdf,0xcc,0xc9,0x03,0x7f,0xc5,0xaf,0xc9,0xaf,0xb0,0x7f,
+0xff,0xcf,0xee,0x3c,0xe2,0x00,0x4f,0xe2,0x30,0xdf,0xf3,0x00,0x09,0xff,0xd6,0xcf,
+0xdf,0xea,0x30,0xef,0x9a,0xfa,0x30,0x16,0xd6,0x8d,0xe8,0x09,0xff,0xff,0xf8,0x09,
+0x7e,0x80,0x8f,0x55,0x5f,0x90,0x21,0xe8,0x08,0xe0,0x00,0xf9,0x00,0x0e,0x80,0x8f,
+0xff,0xff,0x90,0x00,0xe8,0x08,0xe5,0x55,0xe8,0x55,0x00,0x30,0x00,0x4e,0x30,0x55,
+0x00,0xb1,0x1e,0xfd,0x20,0x02,0x5f,0xb4,0x6f,0xb1,0xbf,0x70,0x8f,0x54,0x01,0xf8,
+0x27,0x60,0x3f,0xc0,0x24,0x7f,0x64,0x10,0x07,0xff,0x5e,0xff,0xff,0xfe,0x00,0xcf,
+0xdb,0xe8,0x7f,0x59,0xe0,0x3f,0xf8,0x3e,0x97,0xf6,0x9e,0x0a,0xae,0x80,0xde,0xff,
+0xfe,0xd0,0x42,0xe8,0x00,0x1d,0xff,0x40,0x00,0x0e,0x80,0x6e,0xc1,0xaf,0x92,0x00,
+0xe8,0x5e,0x80,0x00,0x7d,0x30,0x00,0x01,0x00,0xf4,0x8d,0x2f,0x29,0xff,0xff,0xff,
+0x70,0x02,0xf2,0x24,0x44,0x9f,0xd1,0x06,0xef,0xe2,0x00,0x8f,0xc1,0x00,0x7f,0xff,
+0x63,0x2e,0xcc,0xb9,0x00,0x3f,0x3c,0xeb,0xe8,0x8b,0xc0,0x08,0xfb,0xc4,0xbe,0x9b,
+0xa9,0x00,0xdf,0xee,0x6b,0xe7,0xcf,0x40,0x5f,0xf4,0xcf,0xbe,0x68,0xf4,0x0a,0xaf,
+0x2b,0x36,0xeb,0xfc,0xc0,0x44,0xf2,0x02,0xdf,0x87,0x15,0x00,0x2f,0x36,0x6c,0xa6,
+0x66,0x62,0x02,0xf6,0xee,0xee,0xee,0xee,0x40,0x04,0xf1,0x9f,0xfc,0xcf,0xff,0x50,
+0x4f,0x19,0xc7,0xc4,0x4f,0x71,0x4b,0xfa,0xaa,0x5c,0x66,0xf2,0x07,0xff,0xfb,0xff,
+0xca,0x8f,0x10,0x06,0xf4,0x9a,0x5c,0xd8,0xf2,0x00,0xaf,0xda,0xff,0xef,0xff,0xf7,
+0x0e,0xfe,0xec,0x44,0x3a,0xc1,0x05,0xff,0x6a,0xa9,0x90,0xef,0x00,0xac,0xf1,0xab,
+0xaf,0x5f,0xf0,0x04,0x6f,0x1d,0xfb,0xbf,0xcf,0x35,0x04,0xf2,0xc5,0x08,0xf3,0xf7,
+0x70,0x4f,0x10,0x00,0xc5,0x0d,0xf3,0xa4,0x00,0xf0,0x41,0xe7,0x00,0x7f,0x0a,0xd0,
+0x00,0x0e,0x70,0xcf,0xff,0xff,0xf4,0x25,0xfa,0x44,0xbf,0x7c,0xe7,0x07,0xff,0xfc,
+0x4c,0xf9,0xde,0x90,0x04,0xf8,0x2d,0xef,0xdf,0xfd,0x70,0x7f,0xe1,0x67,0x7f,0xa7,
+0x72,0x0c,0xff,0x98,0xff,0xff,0xff,0x04,0xff,0xab,0x8f,0x8f,0xbc,0xf0,0xa9,0xe7,
+0x08,0xe6,0xfa,0xbf,0x03,0x1e,0x74,0xff,0xff,0xff,0xfa,0x00,0xe7,0x08,0xe1,0x14,
+0xaf,0x00,0x0e,0x70,0x7c,0x00,0xaf,0x90,0x00,0xe7,0x1f,0xf2,0x00,0xf6,0x86,0x0e,
+0x70,0x33,0xf7,0xf6,0x31,0x48,0xfc,0x69,0xdf,0xef,0xed,0x17,0xff,0xfc,0xba,0xd7,
+0xf6,0xf2,0x04,0xf8,0x1b,0xad,0x7f,0x6f,0x20,0x7f,0xd0,0x9d,0xdd,0xdd,0xd1,0x0c,
+0xff,0x93,0xbb,0xbb,0xb9,0x04,0xff,0x9c,0x58,0x88,0x88,0x72,0xa9,0xe7,0x2f,0xff,
+0xff,0xff,0x83,0x1e,0x70,0x4b,0x2f,0x6a,0x50,0x00,0xe7,0x4f,0xb4,0xf6,0x9f,0x40,
+0x0e,0x71,0x70,0xee,0x20,0x71,0x02,0xf0,0x08,0x1b,0x62,0x80,0x00,0x2f,0x02,0xd0,
+0xc7,0x88,0x20,0x39,0xf8,0xba,0xec,0xbf,0xca,0x06,0xff,0xf9,0xe6,0xaa,0x8e,0x20,
+0x08,0xf2,0x4c,0xba,0xbb,0xae,0x00,0xcf,0xbc,0xee,0xcd,0xde,0xd2,0x1f,0xfd,0x6d,
+0x67,0xf6,0xf6,0x08,0xcf,0x2e,0xff,0xff,0xff,0xf2,0x86,0xf0,0x4f,0x80,0xe8,0xe5,
+0x01,0x2f,0x09,0xde,0x79,0xfb,0x41,0x02,0xf5,0xf5,0x39,0xff,0xbd,0x60,0x2f,0x88,
+0x04,0xc4,0x3c,0xd0,0x97,0x01,0x12,0xec,0xf8,0x01,0x51,0xc0,0x00,0x00,0x00,0x53,
+0x0d,0x00,0x21,0x0f,0xa0,0x0d,0x00,0x50,0xfa,0x00,0xef,0xff,0xfa,0x0d,0x00,0x5a,
+0xe9,0x99,0x70,0x00,0xfa,0x1a,0x00,0x01,0x0d,0x00,0x10,0xb0,0x0d,0x00,0x11,0xaf,
+0x1d,0x02,0x20,0x35,0x77,0x01,0x00,0x13,0x71,0x52,0x00,0x11,0xbf,0x84,0x03,0xa0,
+0x05,0x77,0x77,0xee,0x77,0x77,0x10,0x00,0x00,0x0d,0x34,0x00,0x30,0x7a,0x00,0xdc,
+0x56,0x03,0xb0,0xf0,0x0d,0xff,0xff,0x50,0x00,0x9f,0x00,0xde,0x88,0x83,0x0d,0x00,
+0x00,0x1a,0x00,0x13,0x9f,0x1a,0x00,0x00,0x0d,0x00,0x11,0x2f,0x4e,0x00,0x20,0x91,
+0x99,0x01,0x00,0xf0,0x26,0x95,0x4f,0xff,0xfe,0x07,0xf5,0xc4,0x02,0x6f,0xb6,0x50,
+0x6f,0x28,0xa0,0x02,0xf6,0x00,0x6c,0xff,0xff,0x10,0x5f,0xff,0x8f,0xff,0xb8,0x50,
+0x0a,0xe6,0xf7,0x13,0xf5,0x47,0x32,0xf8,0x1f,0x78,0xcf,0xff,0xf6,0x7f,0xab,0xf5,
+0xeb,0xfb,0x28,0x20,0x67,0xfb,0x00,0x0c,0xcb,0xe2,0xca,0x03,0xf4,0x07,0x9f,0xf3,
+0x00,0x1d,0xc0,0x02,0x9f,0xf7,0x43,0x2e,0xe2,0x0a,0xff,0x9c,0xec,0x90,0xa2,0x00,
+0x58,0x10,0x2c,0xe3,0xef,0x00,0x20,0xbe,0x10,0x06,0x00,0x10,0x3f,0x68,0x00,0xf1,
+0x0c,0x30,0x1d,0xe6,0x66,0x66,0x66,0x61,0x0c,0xfb,0x66,0x66,0x66,0x60,0x00,0x98,
+0xef,0xff,0xff,0xff,0x10,0x00,0x1f,0x70,0xca,0x07,0xf0,0x04,0x88,0x00,0xd3,0xfb,
+0x16,0xaf,0x87,0xfa,0x6c,0xf6,0x50,0x08,0xf1,0x2f,0x40,0xbd,0xd7,0x00,0x70,0x60,
+0x04,0x55,0x55,0x78,0xfa,0x52,0x32,0x01,0x28,0xfc,0x10,0xdf,0x02,0x00,0xc9,0x00,
+0x20,0x01,0xf8,0xc9,0x00,0x32,0x00,0x1f,0x80,0x0d,0x00,0xf0,0x06,0x05,0xa0,0x09,
+0xf1,0x00,0x1f,0x83,0xff,0x20,0x9f,0xff,0xf1,0xfb,0xfe,0x30,0x09,0xf8,0x77,0x1f,
+0xfc,0x10,0x1a,0x00,0x13,0xfb,0x27,0x00,0x11,0x02,0x27,0x00,0xf3,0x07,0x02,0xf4,
+0x09,0xf6,0xad,0x1f,0x80,0x3f,0x40,0xdf,0xff,0x90,0xfd,0x8b,0xf1,0x0e,0xc5,0x00,
+0x08,0xff,0xf8,0x00,0x5d,0x00,0x11,0x02,0x06,0x00,0x22,0x03,0xf9,0x62,0x00,0x10,
+0xff,0xa3,0x00,0xf1,0x05,0x2f,0xc5,0x55,0x55,0x55,0x50,0x1d,0xfc,0xff,0xff,0xff,
+0xe0,0x05,0xf7,0x35,0x55,0x55,0x54,0x00,0x04,0x9b,0x00,0xf2,0x19,0x00,0x05,0x55,
+0x5c,0x86,0xf7,0x00,0x00,0xbe,0x57,0xf6,0x1f,0x70,0x00,0x02,0xbf,0xfb,0x00,0xf8,
+0x00,0x00,0x08,0xff,0xf6,0x0d,0xb6,0x50,0x5d,0xf9,0x2d,0xf3,0x8f,0xd8,0x0b,0xd4,
+0x00,0x04,0x01,0xbe,0x20,0x5a,0x00,0xf0,0x41,0x04,0xb3,0x00,0x01,0xf7,0x00,0x00,
+0x6e,0xf2,0x95,0x1f,0x70,0x00,0x00,0x16,0x0f,0x81,0xf8,0x8b,0x10,0x20,0x00,0xf9,
+0x6f,0xff,0xf1,0x4f,0xb2,0x3f,0xff,0xfa,0x6f,0x10,0x6e,0x5f,0xfc,0x4f,0x76,0xf1,
+0x00,0x00,0x4f,0x81,0xf7,0x7f,0x00,0x03,0xc1,0xf8,0x1f,0xcf,0xe0,0x00,0xbe,0x0f,
+0x81,0xf8,0x63,0x00,0x4f,0x70,0xf8,0x00,0x00,0xe7,0x0d,0xe0,0x0e,0xd7,0x66,0x9f,
+0x60,0x66,0x00,0x6e,0xff,0xff,0xb0,0x05,0x92,0xd3,0x00,0xf1,0x07,0x00,0x6e,0xf3,
+0x11,0xaf,0x11,0x00,0x00,0x17,0x3f,0xff,0xff,0xf9,0x00,0x40,0x01,0x55,0xcf,0x55,
+0x30,0x5f,0xd3,0x1a,0x00,0xf0,0x42,0x3c,0x2a,0xff,0xff,0xff,0xf1,0x00,0x01,0x57,
+0xbf,0xb7,0x77,0x00,0x03,0xe2,0x0b,0xe1,0x12,0x00,0x00,0xce,0x03,0xf7,0x0d,0xc0,
+0x00,0x5f,0x60,0xcf,0x45,0xaf,0x70,0x0e,0xd0,0x5f,0xff,0xfe,0xee,0x00,0x54,0x00,
+0x85,0x20,0x03,0xa1,0x05,0xa2,0x00,0x07,0xf1,0x00,0x00,0x5e,0xf3,0x44,0x9f,0x54,
+0x51,0x00,0x15,0x6f,0xff,0xff,0xff,0x50,0x40,0x06,0xf2,0x8f,0x39,0xf1,0x5f,0xd3,
+0x6f,0x17,0xf2,0x66,0x00,0x5d,0x27,0xff,0xbb,0x04,0xf3,0x17,0x00,0x8f,0xfb,0x47,
+0xf5,0x00,0x08,0x79,0xe7,0xf2,0xce,0x00,0x00,0xea,0xbc,0x0d,0xef,0x60,0x00,0x7f,
+0x3f,0x80,0x9f,0xf3,0x00,0x1f,0xb6,0xf8,0xdf,0xbe,0xfb,0x31,0xa3,0x7c,0x6d,0x40,
+0x07,0xe2,0xa0,0x01,0xf0,0x0e,0x06,0x91,0x16,0x07,0xf1,0x46,0x00,0x7f,0xe4,0xf8,
+0x7f,0x1c,0xd0,0x00,0x27,0x0a,0xe7,0xf4,0xf5,0x00,0x40,0x00,0x87,0xaf,0x78,0x30,
+0x4f,0xd3,0x1f,0xb0,0x00,0x81,0x3d,0x41,0xf7,0x11,0x1e,0x90,0x00,0x00,0x0d,0x00,
+0x81,0x05,0xd2,0xf8,0x22,0x2e,0x90,0x00,0xcc,0x0d,0x00,0xf4,0x03,0x5f,0x51,0xfa,
+0x55,0x5e,0x90,0x0e,0xd0,0x1f,0x60,0x37,0xf9,0x00,0x75,0x01,0xf6,0x03,0xfd,0xdb,
+0x04,0xf4,0x3e,0x8b,0x20,0x00,0x0b,0xdc,0x90,0x06,0xec,0x11,0x11,0xbd,0x5e,0x40,
+0x02,0x4f,0xff,0xff,0xff,0xf6,0x04,0x02,0xf6,0x44,0xaf,0x33,0x15,0xfd,0x4f,0x9f,
+0xfa,0xf3,0xc2,0x04,0xb2,0xf5,0x44,0x7f,0x9f,0x00,0x01,0x3f,0x9f,0xf9,0xff,0xa0,
+0x02,0xf7,0xf8,0x7b,0x6f,0xf3,0x00,0x7f,0x6f,0x7e,0xf6,0xfb,0x43,0x0e,0xa8,0xd7,
+0x94,0xdf,0xd7,0xb5,0xf5,0xe9,0x12,0xce,0x8f,0xf7,0x18,0x1b,0x20,0x1b,0x20,0x9d,
+0x51,0x02,0x02,0xa2,0x01,0x30,0x5f,0x90,0xdf,0xe4,0x00,0xf0,0x13,0x9f,0x7d,0xb3,
+0x33,0xe9,0x00,0x00,0x81,0xdb,0x33,0x3e,0x90,0x00,0x00,0x0d,0xfe,0xee,0xf9,0x01,
+0xea,0x20,0xdb,0x55,0x5f,0x90,0x06,0xe9,0x0c,0xee,0xee,0xe8,0x00,0x01,0x01,0x0f,
+0x02,0x20,0x00,0x39,0x7c,0x00,0xf0,0x07,0x00,0x0a,0xe4,0xf4,0xf4,0xd6,0xf0,0x03,
+0xf7,0x4f,0x4f,0x4d,0x6f,0x00,0xce,0x28,0xf8,0xf8,0xe9,0xf5,0x09,0x73,0x1d,0x02,
+0x13,0xc0,0xf5,0x01,0x02,0x5b,0x00,0x20,0xdf,0x6d,0xb8,0x06,0xf0,0x1b,0x01,0xc6,
+0xdc,0x66,0xea,0x66,0x10,0x00,0x0d,0xa0,0x1f,0x90,0x00,0x04,0x00,0xda,0xef,0xff,
+0xfe,0x08,0xfb,0x1e,0x9e,0x83,0x39,0xe0,0x07,0xb0,0xf9,0xef,0xff,0xfe,0x00,0x00,
+0x0f,0x7e,0x83,0x39,0xe0,0x00,0xa3,0xf5,0x0d,0x00,0xfa,0x0a,0x6f,0x9f,0x37,0x2e,
+0x86,0x50,0x0d,0xca,0xe6,0xf4,0xe8,0x9f,0x15,0xf7,0xf9,0xcc,0x5f,0x82,0xf5,0x19,
+0x2c,0x20,0x1f,0xe4,0x00,0x01,0x00,0xf0,0x06,0x2e,0x80,0xae,0x3d,0x40,0x00,0x00,
+0x7c,0x5f,0xfc,0xfe,0xbb,0x00,0xb5,0x4f,0xf7,0x7f,0xa6,0x60,0x19,0xe7,0x17,0x01,
+0xf0,0x01,0x00,0x01,0x95,0xf8,0x8f,0xa7,0x30,0x00,0xbe,0x7f,0x77,0xfa,0x62,0x00,
+0xcf,0x45,0xa0,0x04,0xd2,0x07,0x70,0x5f,0x95,0x44,0x44,0x01,0x77,0x67,0x9f,0xa6,
+0x66,0x64,0xfd,0x03,0x51,0xa0,0x00,0x00,0x3f,0x50,0xf4,0x02,0x16,0xf5,0x55,0x00,
+0x90,0x48,0x00,0x03,0xf7,0x00,0x00,0x07,0xfd,0xff,0xe4,0x00,0xf1,0x13,0x02,0x4f,
+0x84,0x44,0x49,0xf0,0x02,0x00,0x7f,0xee,0xee,0xe6,0x06,0xfb,0x01,0x55,0xfb,0x55,
+0x00,0x06,0xa0,0xaf,0xff,0xff,0xf7,0x00,0x00,0x0a,0xc3,0xfa,0x3f,0x70,0x00,0x95,
+0x0d,0x00,0xf0,0x0d,0x1f,0x9a,0xc4,0xfa,0x4f,0x70,0x08,0xf2,0x8d,0xed,0xdf,0xd6,
+0x01,0xfb,0x05,0xdd,0x14,0xfb,0x20,0x1a,0x46,0xfa,0x10,0x03,0xdd,0x00,0x00,0x01,
+0x54,0x00,0xf0,0x01,0x07,0xc5,0x0f,0xff,0xfe,0xf9,0x00,0x07,0xe2,0xf6,0x9f,0x2d,
+0x90,0x00,0x01,0x0f,0xe8,0x01,0x80,0x30,0x04,0x55,0xbf,0x55,0x52,0x5f,0xc3,0x68,
+0x00,0xf5,0x1e,0x80,0x6e,0x30,0x99,0x99,0x99,0x60,0x00,0x10,0x0f,0xa7,0x77,0xea,
+0x00,0x03,0xa0,0xfc,0xaa,0xae,0xa0,0x00,0xbe,0x1f,0xca,0xaa,0xea,0x00,0x5f,0x60,
+0xfe,0xdd,0xdf,0xa0,0x0e,0xd0,0x39,0xf7,0x0d,0xe6,0x00,0x75,0x1e,0xb4,0x00,0x07,
+0x06,0x01,0x21,0x0a,0x50,0x3e,0x08,0x10,0xfa,0x59,0x04,0x10,0x07,0x47,0x00,0xe2,
+0xfe,0x22,0xee,0xf1,0xf3,0xd7,0x8d,0x00,0x06,0xaf,0x7f,0x8e,0xab,0xe6,0x30,0x05,
+0xf1,0x00,0xf1,0x00,0x5f,0x1f,0x3d,0x78,0xd0,0x00,0x6a,0xf7,0xf8,0xea,0xbe,0x63,
+0x1f,0xf8,0x00,0xf4,0x08,0x70,0x0a,0x42,0x60,0x54,0x19,0x50,0x06,0xf5,0x5f,0x2a,
+0xe0,0xcf,0x11,0xec,0x04,0xf3,0x6f,0x23,0xf8,0x01,0x10,0x01,0x02,0x04,0x20,0x00,
+0x00,0xae,0x03,0xf1,0x0a,0x9f,0x18,0x00,0x03,0x1f,0x70,0x09,0xf1,0xe9,0x04,0xf5,
+0xf7,0x00,0x9f,0x06,0xc0,0x0c,0xef,0x87,0x7c,0xf7,0x87,0x30,0x37,0xfa,0x61,0x01,
+0xfb,0x1e,0x1f,0x70,0x0c,0xf6,0x00,0x00,0x0a,0xf7,0x00,0xef,0xb0,0x00,0x2c,0xff,
+0x70,0x4f,0xcf,0x20,0x04,0xe4,0xf7,0x0b,0xe1,0xea,0x00,0x01,0x1f,0x75,0xf8,0x07,
+0xf6,0x00,0x01,0xfb,0xfc,0x00,0x0b,0xf6,0x00,0x1f,0xac,0x10,0x00,0x0b,0x20,0xb7,
+0x01,0x52,0x3e,0x70,0x00,0x00,0x0d,0x89,0x00,0xf2,0x1e,0x57,0x66,0xce,0x7a,0x67,
+0x73,0x08,0xe4,0x3f,0x98,0xf3,0xdb,0x00,0x1b,0xc8,0xff,0xf4,0x8e,0x20,0x00,0x18,
+0x27,0xf9,0xa5,0x70,0x00,0xaf,0xdc,0xfe,0xdf,0xdf,0xc1,0x09,0x50,0x7a,0xc8,0x87,
+0x3a,0x11,0x77,0x77,0x8f,0xc7,0x77,0x74,0xb5,0x01,0x21,0x90,0x00,0xf5,0x04,0x11,
+0x00,0x02,0x05,0xf0,0x18,0x00,0x6f,0xff,0xf7,0xff,0xff,0xff,0x02,0x6e,0xc6,0x6f,
+0x54,0x4a,0xf0,0x00,0xd9,0x05,0xf4,0x33,0x9f,0x00,0x0d,0x90,0x5f,0xfe,0xef,0xf0,
+0x26,0xec,0x65,0xf5,0x44,0xaf,0x04,0xff,0xff,0x5f,0xee,0xef,0x1a,0x00,0xf4,0x14,
+0xf6,0x44,0xaf,0x00,0x0d,0x91,0x6f,0xff,0xff,0xf0,0x15,0xef,0xf4,0x8f,0x1f,0x60,
+0x09,0xfc,0x84,0x1e,0xc1,0xf6,0x44,0x11,0x00,0x6d,0xf3,0x1f,0x9b,0xa0,0x00,0x0e,
+0xb3,0x00,0xcf,0x06,0x02,0xf0,0x15,0x4f,0xff,0xf8,0xff,0xff,0xff,0x41,0x6e,0xc6,
+0x8d,0x4f,0x97,0xf4,0x00,0xd9,0x08,0xea,0xfc,0xbf,0x40,0x0d,0x90,0x8f,0xbf,0xdc,
+0xf4,0x2e,0xff,0xb8,0xc0,0xe5,0x2f,0x41,0xaf,0xd8,0x8f,0x8c,0x09,0xf0,0x12,0xd9,
+0x03,0x56,0xfb,0x55,0x10,0x0d,0x90,0x24,0x5f,0xa4,0x42,0x00,0xdd,0xca,0xff,0xff,
+0xff,0x63,0xdf,0xfd,0x11,0x2f,0x81,0x10,0x3e,0x93,0x37,0x77,0xfb,0x77,0x60,0x00,
+0x96,0x01,0x50,0xfd,0x00,0x2b,0x31,0xf8,0x98,0x09,0x11,0xf3,0xb7,0x00,0x80,0xef,
+0x89,0xfc,0x88,0x88,0x00,0x7f,0xff,0x52,0x05,0x21,0x2f,0xd0,0xc4,0x00,0x12,0x52,
+0xd1,0x00,0x11,0x9f,0x59,0x01,0x63,0x05,0x88,0x9f,0xc8,0x88,0x30,0xde,0x00,0x02,
+0xeb,0x00,0x12,0x1f,0xf8,0x00,0x10,0x88,0x01,0x00,0x30,0x85,0x00,0x22,0x01,0x00,
+0x11,0x00,0xef,0x01,0xc4,0x00,0xfa,0x55,0xfa,0x55,0xbe,0x00,0xf9,0x23,0xf9,0x22,
+0xae,0x12,0x00,0xb1,0x45,0xfa,0x44,0xbe,0x01,0xf8,0x12,0xf9,0x11,0xae,0x02,0x12,
+0x00,0x20,0x04,0xf7,0x24,0x00,0xf1,0x03,0x09,0xf0,0x00,0xf8,0x00,0x9e,0x1f,0xa0,
+0x00,0xf8,0x45,0xce,0x3e,0x20,0x00,0xf8,0x9f,0xf7,0x42,0x01,0x03,0x05,0x07,0x30,
+0x21,0x66,0x66,0x44,0x02,0x05,0x5d,0x06,0x00,0x65,0x01,0xf6,0x09,0x0f,0x99,0xc7,
+0xf6,0xd9,0x8f,0x00,0xf9,0x9b,0x6f,0x5c,0x98,0xf0,0x0f,0x99,0xff,0xff,0xf9,0x8f,
+0x00,0xf9,0x9a,0x3f,0x1b,0x0d,0x00,0x71,0x12,0x22,0x22,0x18,0xf0,0x0f,0xff,0x28,
+0x03,0x00,0x93,0x07,0xf1,0x14,0x7c,0xf0,0x00,0x00,0x00,0x12,0x46,0x70,0x00,0x2e,
+0xef,0xff,0xff,0xeb,0x30,0x00,0x6e,0x65,0xf8,0x0c,0x90,0x00,0x01,0xf8,0x1f,0x73,
+0xf8,0x00,0x05,0x5d,0xd6,0xfa,0xbf,0x75,0x21,0x2d,0x00,0xf1,0x0e,0xf7,0x02,0x6b,
+0xf9,0xfa,0xdd,0x84,0x12,0xff,0xd3,0x03,0x10,0x9f,0xf6,0x07,0xdf,0xff,0xff,0xff,
+0xf8,0x00,0x09,0xf4,0x4f,0x94,0xaf,0x10,0x00,0x9f,0xb2,0x02,0x43,0x09,0xf3,0x3f,
+0x83,0x0d,0x00,0x11,0xe1,0x4a,0x04,0x10,0x01,0x12,0x07,0xf0,0x24,0xe8,0xf6,0xe9,
+0x00,0x04,0x54,0xed,0x0c,0xfa,0x39,0x00,0xad,0x8f,0x60,0x4f,0x9e,0xd1,0x01,0xdf,
+0xfb,0xbb,0xff,0xe1,0x00,0x4f,0xea,0xcc,0xcb,0xdf,0xa1,0x6f,0xf7,0x44,0x44,0x46,
+0xff,0x81,0x77,0xfe,0xee,0xef,0xf5,0x60,0x00,0x6f,0x42,0x22,0x6f,0x50,0x00,0x06,
+0x7a,0x0b,0xe1,0x00,0x00,0x05,0xf3,0x02,0xe5,0x00,0x01,0x44,0x6f,0x84,0x9f,0x64,
+0x41,0x8d,0x07,0x20,0xff,0x30,0xf8,0x04,0x10,0x10,0xb5,0x0b,0xf1,0x02,0x10,0x0d,
+0xd0,0x00,0x09,0xde,0xfd,0xde,0xfe,0xda,0x00,0x36,0x66,0xdf,0x66,0x66,0x40,0x48,
+0x01,0x83,0xf0,0x00,0x36,0x6b,0xf8,0x66,0x66,0x30,0x2e,0x00,0xf1,0x13,0x01,0xdf,
+0xa8,0x88,0x88,0x10,0x01,0xcf,0xf8,0x88,0x8c,0xf1,0x03,0xef,0xdf,0xdd,0xdd,0xef,
+0x10,0x3e,0x49,0xf9,0x99,0x9c,0xf1,0x00,0x00,0x9f,0x77,0x77,0xbf,0x10,0x00,0x09,
+0xb7,0x00,0x00,0x01,0x00,0xf4,0x42,0x10,0x00,0x01,0x44,0x44,0x00,0x0e,0xa0,0x00,
+0x6f,0xff,0xed,0xff,0xff,0xff,0x40,0x3f,0x61,0xd9,0xee,0x77,0xf4,0x05,0xf2,0x05,
+0x9f,0x6f,0x96,0x10,0x9f,0x76,0x5f,0xff,0xff,0xf0,0x1e,0xfe,0xff,0xfa,0x3f,0x93,
+0x08,0xfc,0x6e,0x5f,0xff,0xff,0xd0,0x7f,0xc6,0xe0,0xe9,0x2e,0x92,0x00,0x9c,0x6e,
+0x0e,0xfe,0xff,0xc0,0x08,0xff,0xe0,0xea,0x3f,0x93,0x00,0x8d,0x55,0x0e,0xed,0xfe,
+0xd4,0x02,0x30,0x00,0xeb,0x66,0x66,0x20,0x2c,0x0b,0x10,0xff,0x4e,0x00,0x63,0x00,
+0x67,0x77,0x77,0x77,0x72,0x13,0x00,0x03,0xcc,0x03,0x01,0x1c,0x03,0xf0,0x16,0x73,
+0x00,0x36,0x11,0xf9,0x04,0x50,0x00,0x0c,0xf1,0x1f,0x90,0xcf,0x20,0x05,0xf9,0x01,
+0xf9,0x03,0xfb,0x03,0xfd,0x10,0x1f,0x90,0x0a,0xf3,0x08,0x32,0x9b,0xf8,0x00,0x39,
+0x20,0x00,0x0e,0xfc,0x4c,0x00,0xf0,0x36,0x37,0xc1,0x00,0xe8,0x00,0x04,0xff,0xfb,
+0x30,0x0e,0x80,0x00,0x04,0xae,0x00,0x95,0xe8,0xc8,0x03,0x5b,0xf5,0x3f,0x6e,0x89,
+0xe0,0x8f,0xff,0xfc,0xf3,0xe8,0x4f,0x40,0x1f,0xf4,0x8f,0x0e,0x80,0xc4,0x06,0xff,
+0xe3,0x50,0xe8,0x46,0x01,0xee,0xeb,0x40,0x0e,0x9d,0xc0,0x8e,0x9e,0x00,0x00,0x0a,
+0xf4,0x03,0x58,0xe0,0x00,0x4c,0xf6,0x00,0x00,0x8e,0x19,0xdf,0xd4,0x24,0x0c,0x10,
+0xba,0x7d,0x04,0xf5,0x3c,0x38,0xd2,0x3d,0x40,0x00,0x01,0xff,0xfa,0x37,0xf8,0x66,
+0x64,0x03,0x8e,0x00,0xdf,0xff,0xff,0x81,0x5a,0xf5,0x7f,0x59,0xe3,0xf2,0x3f,0xff,
+0xfc,0xc0,0x9e,0x26,0x00,0x1e,0xf4,0x08,0x89,0xe6,0xa0,0x05,0xff,0xe2,0xd9,0x9e,
+0x6f,0x10,0xde,0xeb,0x6f,0x59,0xe1,0xf6,0x6e,0x8e,0x09,0xe0,0x9e,0x0d,0x91,0x57,
+0xe0,0x77,0x09,0xe0,0x87,0x00,0x7e,0x00,0x07,0xde,0x00,0x00,0x07,0xe0,0x00,0xbe,
+0xc0,0x0c,0xfc,0x3e,0x26,0xbd,0x00,0x5f,0x70,0x00,0x1f,0xff,0x81,0x6f,0xff,0xfd,
+0x00,0x18,0xe0,0xbf,0xa5,0x8f,0x90,0x26,0xbf,0x65,0x5d,0xcf,0xc0,0x05,0xff,0xff,
+0x65,0xcf,0xc0,0x00,0x02,0xff,0x4a,0xfb,0xdf,0x52,0x00,0x7f,0xfe,0x22,0x8f,0xff,
+0xf8,0x0e,0xde,0xc6,0xcf,0x72,0xaf,0x26,0xe8,0xe0,0x5c,0x7e,0x9f,0x90,0x16,0x8e,
+0x00,0x01,0xdf,0xa0,0x00,0x08,0xe0,0x59,0xfe,0x60,0x00,0x00,0x8e,0x0a,0xc7,0x10,
+0x00,0x01,0x00,0xc1,0x4d,0x60,0x00,0x00,0x07,0x77,0x78,0xfd,0x77,0x77,0x01,0xff,
+0x1e,0x05,0xf0,0x0d,0x1f,0x70,0x23,0x00,0x50,0x8f,0x10,0xb6,0x8f,0xd0,0x5f,0xd9,
+0x70,0x09,0xff,0xa1,0x00,0x3c,0xfa,0x00,0x6d,0x96,0x66,0x66,0x7a,0x30,0x00,0x5f,
+0x5e,0x01,0x00,0x68,0x01,0x11,0x90,0x2c,0x03,0x00,0x17,0x09,0x01,0x6c,0x01,0x30,
+0x70,0x0e,0xee,0x01,0x00,0x06,0x3d,0x07,0x20,0xaf,0x20,0x33,0x04,0x01,0x6d,0x03,
+0xf1,0x12,0xf8,0x69,0x66,0x78,0x6d,0xe0,0x4c,0x4a,0xf5,0x0b,0xf9,0x89,0x00,0x7f,
+0xe4,0x01,0x07,0xfe,0x20,0x03,0x80,0x08,0xf4,0xe5,0x80,0x01,0x33,0x33,0xbf,0x4d,
+0xc3,0x30,0x7f,0x76,0x00,0xf4,0x0b,0x11,0x22,0x27,0xff,0xc2,0x22,0x20,0x00,0x06,
+0xfd,0x4f,0xa1,0x00,0x02,0x8d,0xfc,0x10,0x5f,0xfb,0x71,0x2e,0xb5,0x00,0x00,0x18,
+0xdc,0x7f,0x05,0xf0,0x13,0xf4,0x0b,0xa3,0xf4,0x6f,0x10,0x0b,0xa0,0xba,0x3f,0x46,
+0xf1,0x5d,0xed,0xcb,0xc8,0xf9,0x9f,0x14,0xaa,0xaa,0xbf,0xff,0xff,0xf1,0x0b,0x08,
+0x86,0x66,0x66,0x66,0x30,0xf3,0xba,0x49,0x03,0xfa,0x18,0x0d,0x5d,0x53,0x39,0xf6,
+0x33,0x00,0xc6,0xf2,0xef,0xff,0xff,0xf3,0x07,0x6f,0x5e,0x7e,0x4f,0x5f,0x35,0xdf,
+0xfd,0xe6,0xe4,0xf4,0xf3,0x4a,0x63,0x0e,0x6e,0x4f,0x6f,0x30,0x00,0x00,0xe6,0xd3,
+0xec,0xd1,0x03,0x01,0x50,0x0d,0xa0,0x00,0x8e,0x00,0x1b,0x03,0xf2,0x01,0xae,0xff,
+0xff,0x54,0xf9,0x8f,0x3b,0xf3,0xec,0x10,0x2b,0x56,0xd6,0x9b,0x49,0xb0,0x95,0x04,
+0xf2,0x07,0x10,0x00,0x55,0x59,0xf6,0x5a,0xf1,0x00,0x2f,0xfe,0xff,0xee,0xee,0x10,
+0x04,0xf8,0x5a,0xf6,0x55,0x53,0x00,0x6f,0x2e,0x07,0xf5,0x03,0x08,0xfd,0xf1,0x01,
+0xf8,0x02,0x9f,0xe5,0x6f,0x1b,0xef,0x40,0x0b,0x71,0x06,0xf1,0x47,0x40,0xcb,0x0d,
+0x40,0x90,0x00,0x8e,0x00,0xef,0x04,0xf0,0x01,0x7e,0xff,0xff,0x63,0xfb,0xce,0x4a,
+0xf6,0xfc,0x41,0x2b,0x14,0xa4,0xe7,0x07,0x90,0x6a,0x00,0xf1,0x0a,0xe6,0x00,0x00,
+0x00,0x6c,0xfb,0x28,0xfe,0x83,0x04,0xef,0xef,0xff,0xff,0xbf,0xf8,0x09,0x51,0x44,
+0x44,0x42,0x27,0x00,0x05,0xff,0x48,0x07,0xc5,0x5f,0x53,0x33,0x4f,0x70,0x00,0x05,
+0xf7,0x55,0x56,0xf7,0x00,0x74,0x01,0x02,0xaa,0x00,0xf0,0x10,0xb2,0x21,0x9e,0x32,
+0x21,0x08,0xff,0xff,0xcf,0xff,0xff,0x83,0xf8,0x9d,0x1a,0xd1,0xbc,0x10,0x02,0x9f,
+0xee,0xee,0xef,0xf5,0x00,0x09,0xf8,0x88,0x88,0xaf,0x50,0x7d,0x03,0xf3,0x07,0x79,
+0xf5,0x00,0x09,0xfd,0xdd,0xdd,0xef,0x50,0x00,0x9f,0xbb,0xbb,0xbc,0xf5,0x00,0x34,
+0x5f,0xa4,0x4d,0xe4,0x31,0x32,0x05,0xf0,0x04,0x37,0xee,0x10,0x0b,0xd0,0x00,0x07,
+0xd8,0x10,0x00,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x01,0x00,
+0xf0,0x0c,0x2f,0x71,0x10,0x8e,0x11,0x10,0x09,0xff,0xff,0x8e,0xff,0xff,0x54,0xf7,
+0x7f,0x28,0xe1,0xbd,0x00,0x0a,0x33,0x98,0xf6,0x36,0x73,0x00,0xff,0x01,0x00,0xf2,
+0x0b,0xf1,0x0f,0xb8,0x88,0x88,0x88,0xbf,0x10,0x07,0xf8,0x77,0x78,0xf7,0x00,0x00,
+0x7f,0xff,0xff,0xff,0x70,0x00,0x07,0xf6,0x55,0x55,0x54,0x0d,0x00,0x83,0xf2,0x00,
+0x07,0xf4,0x33,0x33,0x8f,0x20,0x0d,0x00,0x03,0x01,0x00,0xf3,0x3f,0x0d,0xb1,0x10,
+0x9e,0x21,0x10,0x07,0xff,0xff,0xcf,0xff,0xff,0x92,0xf9,0xbb,0x3d,0xc3,0xec,0x21,
+0x04,0x2d,0x82,0x24,0x47,0x64,0x01,0xff,0xff,0xfb,0xcf,0xff,0xf2,0x07,0x8e,0xb8,
+0x4c,0xa0,0x5f,0x20,0xda,0xeb,0xd8,0xca,0x04,0xf2,0x0d,0xef,0xef,0x8c,0xa3,0x9f,
+0x20,0xdb,0xec,0xe8,0xca,0x6f,0xb0,0x06,0x7e,0xb7,0x5c,0xa0,0x05,0x63,0xff,0xff,
+0xfd,0xcd,0x66,0xcc,0x00,0x0d,0x70,0x06,0xff,0xfe,0x50,0x55,0x00,0xf3,0x3e,0x0a,
+0xa1,0x00,0x0e,0x80,0x00,0x3d,0xaa,0xeb,0xff,0xff,0xff,0x40,0xfb,0xcf,0x26,0x6f,
+0xb6,0x61,0x0d,0xef,0xb1,0xcc,0xfe,0xcc,0x02,0x9d,0xd8,0x8a,0xaf,0xda,0xa6,0x3c,
+0xff,0xb4,0x88,0x88,0x87,0x30,0x2f,0xf3,0x0f,0xff,0xff,0xd0,0x09,0xff,0xe2,0xf9,
+0x77,0xcd,0x03,0xfe,0xbc,0x3f,0x97,0x7c,0xd0,0x5c,0xba,0x00,0xff,0xff,0xfd,0x00,
+0x2a,0xa0,0x0f,0x50,0x3b,0xd0,0x00,0xaa,0x00,0xf4,0x0b,0xf8,0x54,0x00,0x11,0x09,
+0xe5,0x00,0xf0,0x00,0x00,0x15,0x55,0x6f,0xa5,0x55,0x30,0x00,0xef,0xff,0xff,0xff,
+0xf6,0x00,0x14,0x0d,0x00,0x21,0x20,0x3f,0x1a,0x00,0xf0,0x22,0xb0,0x11,0x6d,0xe7,
+0x26,0xc3,0x10,0x00,0xaf,0xff,0xff,0xe8,0x20,0x00,0x02,0x6b,0xfc,0x51,0xbe,0x30,
+0x06,0xff,0xff,0xff,0xfe,0xef,0x40,0x26,0xc9,0x2c,0xb1,0x83,0x60,0x18,0xee,0x86,
+0xeb,0x2a,0xfa,0x10,0x98,0x15,0xfe,0x50,0x04,0xb2,0x00,0x00,0x01,0x59,0x00,0x01,
+0x3a,0x00,0x81,0xf2,0x04,0x44,0x45,0xfa,0x44,0x44,0x04,0x0d,0x00,0xf1,0x28,0xf7,
+0x4f,0x65,0x7f,0xe5,0x75,0x6f,0x73,0xb2,0x8f,0xa1,0x5f,0x80,0xb5,0x00,0xaf,0xed,
+0xed,0x67,0x10,0x00,0x02,0x8f,0xe7,0x12,0xed,0x10,0x08,0xff,0xff,0xff,0xed,0xec,
+0x00,0x37,0xe8,0x2c,0xb2,0x84,0x70,0x18,0xfd,0x86,0xeb,0x2b,0xf9,0x10,0x97,0x07,
+0xfe,0x50,0x05,0x91,0x00,0x34,0xa3,0x00,0xf0,0x27,0x0b,0xb0,0x1f,0xff,0xff,0xf6,
+0x01,0xf4,0x71,0xfb,0xde,0x9f,0x60,0x8b,0x6f,0x3f,0x4a,0xb1,0xf6,0x3f,0xbe,0x81,
+0xf4,0xab,0x1f,0x65,0xff,0xf1,0x1f,0x4a,0xb1,0xf6,0x02,0xe8,0xb1,0xfa,0xdd,0x8f,
+0x60,0xbd,0x5f,0x5f,0xff,0xff,0xf6,0x4f,0xeb,0xc6,0xf4,0xab,0x1f,0x60,0x62,0x4a,
+0x1a,0x00,0xf0,0x09,0x2f,0x89,0xe5,0xf8,0xcd,0x5f,0x65,0xd6,0xb7,0x6f,0xff,0xff,
+0xf6,0x69,0x23,0x01,0xf6,0x22,0x3e,0x50,0x00,0x10,0x00,0x01,0x4c,0x01,0xf4,0x3d,
+0xc0,0x00,0xdc,0x00,0x00,0x02,0xf5,0x10,0x6f,0xff,0xfb,0x00,0xac,0x7e,0x4f,0xf6,
 0x8f,0x80,0x6f,0xbe,0x9d,0xdf,0x9d,0xd1,0x05,0xcf,0xe1,0x21,0x6f,0xf3,0x00,0x06,
 0xfb,0xa0,0x8f,0xef,0xd3,0x05,0xfe,0xdf,0xbf,0x92,0x3e,0xf7,0x3c,0x86,0xd3,0x36,
 0xfa,0x26,0x01,0x85,0x6e,0x00,0x04,0xe8,0x00,0x3f,0x7a,0xd5,0xbc,0x72,0x00,0x06,
-0xd5,0xc5,0x33,0x9e,0xfa,0x30,0x46,0x12,0x1d,0x26,0x04,0xf6,0x01,0x12,0x63,0x31,
-0x45,0xf0,0x3a,0xa0,0xbf,0xff,0xff,0xb0,0x06,0xf5,0x83,0xdb,0x48,0xf8,0x00,0xda,
-0x9e,0x09,0xf3,0xdf,0x10,0x8f,0xdf,0x70,0x1e,0xff,0x60,0x06,0xef,0xe0,0x04,0xdf,
-0xf6,0x00,0x04,0xf9,0xcc,0xff,0x9d,0xfe,0x33,0xee,0xaf,0xa7,0x1b,0x55,0xa0,0x5f,
-0xda,0xd5,0x66,0xfa,0x64,0x01,0x43,0x68,0x3f,0xff,0xff,0xb0,0x4f,0xab,0xf0,0x00,
-0xf7,0x00,0x07,0xd8,0xba,0x65,0x6f,0xa5,0x51,0x9a,0x58,0x0e,0xe8,0x01,0x13,0x10,
-0x99,0x4d,0x01,0xd4,0x29,0xf4,0x38,0x1f,0x80,0x56,0x8f,0xa6,0x61,0x08,0xe5,0xad,
-0xff,0xff,0xff,0x24,0xfa,0xc9,0x03,0xf7,0x59,0x00,0x7f,0xfe,0x12,0xde,0x38,0xf6,
-0x00,0x3f,0x7a,0xcf,0xff,0xfe,0xe0,0x2d,0xe8,0xf6,0x98,0x35,0x28,0x05,0xfe,0xbe,
-0x5b,0xc4,0xf2,0x00,0x15,0x24,0x70,0xda,0x4f,0x21,0x02,0xf9,0xbd,0x1f,0x64,0xf2,
-0xd4,0x5e,0x6a,0x9b,0xf1,0x4f,0x7f,0x47,0xa4,0x77,0xf5,0x01,0xef,0xd0,0xde,0x09,
-0x13,0x10,0x60,0x01,0xf1,0x39,0x6b,0x00,0xe6,0x30,0x01,0xf5,0x08,0xeb,0x7e,0x7f,
-0x50,0x9c,0x7e,0x8e,0x7c,0xec,0xe0,0x4f,0xae,0x78,0xe3,0x9f,0xb7,0x05,0xff,0xc0,
-0x8e,0xcf,0xff,0xf6,0x03,0xf6,0xa8,0xe5,0xaf,0xb6,0x22,0xee,0xcf,0xae,0x0e,0xff,
-0x50,0x3c,0x85,0x9b,0xfa,0xdf,0xbf,0x40,0x85,0x7b,0x8f,0xd4,0xe6,0x81,0x0f,0x8a,
-0xf9,0xe1,0x0d,0x50,0x03,0xe5,0xb9,0xaf,0x66,0x66,0x64,0x49,0x25,0x08,0x1a,0x04,
-0x40,0x97,0x00,0x00,0x9e,0x6a,0x2c,0xf8,0x36,0xdf,0xff,0xff,0xf5,0x08,0xc5,0xa3,
-0x44,0xaf,0x44,0x14,0xf9,0xd5,0x5f,0xff,0xff,0xe0,0x6f,0xfc,0x04,0x66,0x66,0x66,
-0x10,0x2f,0x77,0xdf,0xff,0xff,0xf6,0x1d,0xdb,0xdd,0x64,0x32,0x3e,0x65,0xeb,0x7d,
-0x52,0xfa,0x9a,0x52,0x05,0x36,0x90,0x2f,0x99,0xa0,0x01,0xf9,0xae,0x08,0xf5,0x9a,
-0x66,0x4e,0x6b,0x88,0xfc,0x09,0xcb,0xa5,0x92,0x42,0xfa,0x10,0x5f,0xf4,0x0c,0x59,
-0x00,0x58,0x02,0x10,0xf8,0xcf,0x23,0xf4,0x37,0x65,0xe0,0x08,0xc4,0xea,0x00,0xfe,
-0xdd,0xf3,0x7f,0x5f,0x40,0x0f,0xb8,0x8f,0x30,0xdf,0xc0,0x00,0xfa,0x9f,0x62,0x6e,
-0xfe,0x71,0x0e,0xff,0xff,0xbe,0x72,0x8e,0x30,0x00,0x4a,0xe4,0x49,0x10,0x00,0x00,
-0xdf,0xff,0xfa,0x67,0x10,0x00,0x5a,0xcf,0xfd,0xde,0xff,0x70,0x05,0x8b,0x64,0xf9,
-0x37,0x46,0x00,0x6d,0xd5,0x2f,0x84,0xcf,0x80,0x06,0x60,0x7f,0xd3,0x00,0x45,0x11,
-0x3d,0x30,0x09,0xe0,0x3f,0xd3,0x03,0xfc,0x36,0xf7,0x21,0x44,0x44,0xf7,0x00,0x8e,
+0xd5,0xc5,0x33,0x9e,0xfa,0x30,0x46,0x12,0x00,0x00,0x06,0xd3,0xf6,0x01,0x11,0x63,
+0x06,0x00,0xf0,0x3b,0x0f,0xa0,0xbf,0xff,0xff,0xb0,0x06,0xf5,0x83,0xdb,0x48,0xf8,
+0x00,0xda,0x9e,0x09,0xf3,0xdf,0x10,0x8f,0xdf,0x70,0x1e,0xff,0x60,0x06,0xef,0xe0,
+0x04,0xdf,0xf6,0x00,0x04,0xf9,0xcc,0xff,0x9d,0xfe,0x33,0xee,0xaf,0xa7,0x1b,0x55,
+0xa0,0x5f,0xda,0xd5,0x66,0xfa,0x64,0x01,0x43,0x68,0x3f,0xff,0xff,0xb0,0x4f,0xab,
+0xf0,0x00,0xf7,0x00,0x07,0xd8,0xba,0x65,0x6f,0xa5,0x51,0x9a,0x58,0x0e,0xe8,0x01,
+0x12,0x10,0x5b,0x00,0xf1,0x41,0x89,0x00,0x04,0xd1,0x00,0x00,0x1f,0x80,0x56,0x8f,
+0xa6,0x61,0x08,0xe5,0xad,0xff,0xff,0xff,0x24,0xfa,0xc9,0x03,0xf7,0x59,0x00,0x7f,
+0xfe,0x12,0xde,0x38,0xf6,0x00,0x3f,0x7a,0xcf,0xff,0xfe,0xe0,0x2d,0xe8,0xf6,0x98,
+0x35,0x28,0x05,0xfe,0xbe,0x5b,0xc4,0xf2,0x00,0x15,0x24,0x70,0xda,0x4f,0x21,0x02,
+0xf9,0xbd,0x1f,0x64,0xf2,0xd4,0x5e,0x6a,0x9b,0xf1,0x4f,0x7f,0x47,0xa4,0x77,0xf5,
+0x01,0xef,0xd0,0x00,0x00,0x02,0x55,0x00,0x13,0x10,0x60,0x01,0xf0,0x38,0x6b,0x00,
+0xe6,0x30,0x01,0xf5,0x08,0xeb,0x7e,0x7f,0x50,0x9c,0x7e,0x8e,0x7c,0xec,0xe0,0x4f,
+0xae,0x78,0xe3,0x9f,0xb7,0x05,0xff,0xc0,0x8e,0xcf,0xff,0xf6,0x03,0xf6,0xa8,0xe5,
+0xaf,0xb6,0x22,0xee,0xcf,0xae,0x0e,0xff,0x50,0x3c,0x85,0x9b,0xfa,0xdf,0xbf,0x40,
+0x85,0x7b,0x8f,0xd4,0xe6,0x81,0x0f,0x8a,0xf9,0xe1,0x0d,0x50,0x03,0xe5,0xb9,0xaf,
+0x66,0x66,0x64,0x49,0x25,0xca,0x01,0xf4,0x43,0xa0,0x00,0x97,0x00,0x00,0x9e,0x00,
+0x00,0x1f,0x50,0xdf,0xff,0xff,0xf5,0x08,0xc5,0xa3,0x44,0xaf,0x44,0x14,0xf9,0xd5,
+0x5f,0xff,0xff,0xe0,0x6f,0xfc,0x04,0x66,0x66,0x66,0x10,0x2f,0x77,0xdf,0xff,0xff,
+0xf6,0x1d,0xdb,0xdd,0x64,0x32,0x3e,0x65,0xeb,0x7d,0x52,0xfa,0x9a,0x52,0x05,0x36,
+0x90,0x2f,0x99,0xa0,0x01,0xf9,0xae,0x08,0xf5,0x9a,0x66,0x4e,0x6b,0x88,0xfc,0x09,
+0xcb,0xa5,0x92,0x42,0xfa,0x10,0x5f,0xf4,0x00,0x00,0x01,0x5d,0x01,0x01,0x58,0x02,
+0xf2,0x3f,0xf8,0xff,0xff,0xd0,0x0f,0x65,0xe0,0x08,0xc4,0xea,0x00,0xfe,0xdd,0xf3,
+0x7f,0x5f,0x40,0x0f,0xb8,0x8f,0x30,0xdf,0xc0,0x00,0xfa,0x9f,0x62,0x6e,0xfe,0x71,
+0x0e,0xff,0xff,0xbe,0x72,0x8e,0x30,0x00,0x4a,0xe4,0x49,0x10,0x00,0x00,0xdf,0xff,
+0xfa,0x67,0x10,0x00,0x5a,0xcf,0xfd,0xde,0xff,0x70,0x05,0x8b,0x64,0xf9,0x37,0x46,
+0x00,0x6d,0xd5,0x2f,0x84,0xcf,0x80,0x06,0x60,0x7f,0xd3,0x00,0x45,0x00,0x00,0x22,
+0x02,0x03,0x20,0xe0,0x3f,0xd3,0x03,0xfa,0x37,0xf7,0x21,0x44,0x44,0xf7,0x00,0x8e,
 0x3e,0x24,0x55,0x5f,0x70,0x3f,0xaa,0xe1,0xbd,0xdd,0xf7,0x05,0xff,0xf4,0x56,0x66,
 0x6f,0xa1,0x04,0xe9,0x9c,0xee,0xff,0xee,0x31,0xcf,0x8f,0x49,0x0d,0x82,0x80,0x4f,
 0xdb,0xe6,0xda,0xdc,0xea,0x00,0x63,0x58,0x03,0xcf,0xfc,0x00,0x1f,0x9a,0xe7,0xfc,
-0xec,0xfc,0x24,0xf7,0xaa,0x88,0x5e,0x84,0xc1,0x49,0x24,0x00,0x0d,0xe4,0xa2,0x1b,
-0x10,0xa0,0x8a,0x60,0xf0,0x01,0x01,0xf6,0x10,0xcc,0xfd,0xcc,0x10,0x9d,0x5f,0x4f,
-0x96,0x69,0xf2,0x5f,0xbe,0xc1,0xbc,0x01,0x80,0xdf,0xf2,0x1f,0x84,0x48,0xf2,0x03,
-0xfc,0x0d,0x00,0xf7,0x18,0x23,0xef,0xbf,0x22,0x29,0xe1,0x80,0x3f,0xc9,0xeb,0xff,
-0xcf,0xcf,0x30,0x74,0x6a,0x1b,0xc9,0xff,0x20,0x1f,0x9a,0xf7,0xf5,0x9e,0xfa,0x04,
-0xe6,0xb1,0xf7,0x5c,0xd5,0xf7,0x48,0x12,0x01,0x0b,0xf7,0x03,0x5c,0x28,0x10,0x10,
-0x5b,0x00,0x00,0x9e,0x72,0xf0,0x14,0x01,0xf5,0x25,0xee,0xff,0xee,0x20,0x7d,0x5f,
-0x8f,0x44,0x45,0xf2,0x2e,0xac,0xa6,0xf3,0x33,0x4f,0x23,0xff,0xf1,0x6f,0xff,0xff,
-0xf2,0x02,0xeb,0xa6,0xe1,0x11,0x11,0x01,0xcf,0xaf,0xe6,0x6c,0xf3,0x12,0x1d,0xa8,
-0xcb,0xf9,0xc3,0xd8,0x80,0x86,0x8b,0xbf,0xff,0xef,0xe8,0x0f,0x9b,0xfe,0xcc,0xd8,
-0xea,0x82,0xf6,0xb8,0xf8,0x9c,0x3d,0x88,0x4d,0x24,0x1b,0x49,0x61,0x6d,0x50,0x3a,
-0x4e,0x02,0x38,0x0a,0x63,0x5f,0x17,0xf0,0x9d,0x0a,0xe0,0x0d,0x00,0xf1,0x06,0x57,
-0x77,0x8f,0xa7,0x77,0x71,0x0a,0xbb,0xbd,0xfc,0xbb,0xbb,0x20,0x07,0xcc,0xdf,0xcc,
-0xcc,0x00,0x00,0x9e,0xe1,0x09,0x60,0x09,0xf9,0x99,0x99,0xcf,0x00,0x6c,0x05,0x21,
-0xbe,0xf0,0x86,0x05,0x92,0xcf,0x00,0x02,0xae,0x77,0x77,0x7c,0xf2,0x11,0xe7,0x24,
-0x12,0x06,0xe4,0x36,0x63,0x6f,0x28,0xf0,0x9d,0x0b,0xd0,0x0d,0x00,0x60,0x14,0x44,
-0x9f,0x54,0x45,0x50,0x4d,0x04,0x93,0xfd,0xed,0x00,0x24,0x44,0x9f,0x58,0xfe,0x41,
-0x23,0x17,0xf0,0x04,0x12,0x6a,0xff,0xf8,0x55,0x31,0x2a,0xff,0xfd,0xdd,0xdd,0xf6,
-0x00,0xc9,0xbf,0xaa,0xaa,0xaf,0x60,0xf8,0x3f,0x22,0x67,0xf6,0x66,0x05,0x11,0x60,
-0x58,0x06,0xf2,0x08,0x52,0x00,0x0d,0xdd,0xff,0xdd,0xaf,0x50,0x00,0x66,0x6f,0xc6,
-0xcf,0x70,0x00,0x55,0x55,0xfb,0x8f,0xd5,0x51,0x1f,0xff,0x10,0x09,0x70,0x08,0xfe,
-0x51,0x11,0x00,0x01,0x7e,0xb3,0x09,0x21,0x04,0xff,0x3c,0x6a,0x22,0x07,0x16,0xe0,
-0x28,0x32,0x34,0x44,0x48,0xf4,0x33,0x01,0x2c,0x49,0x17,0x5f,0x49,0x37,0x00,0x55,
-0x00,0x92,0x32,0x00,0x06,0x66,0xfc,0x66,0x4e,0xc0,0x00,0x7b,0x57,0x63,0x11,0x11,
-0xfa,0x3d,0xe2,0x10,0x96,0x00,0xf0,0x10,0x44,0x5a,0xff,0x84,0x44,0x42,0x02,0x8e,
-0xff,0xeb,0xbb,0xb0,0x03,0xff,0xef,0x66,0x66,0xbf,0x00,0x04,0x19,0xfc,0xcc,0xce,
-0xf0,0x00,0x00,0x9f,0x55,0x55,0xbf,0x67,0x4d,0x31,0x55,0x5b,0xf0,0xb0,0x0b,0x00,
-0x98,0x61,0xf0,0x14,0xf9,0x0f,0x80,0x42,0x00,0xff,0xff,0x90,0xfd,0xef,0x90,0x02,
-0x22,0xf9,0x0f,0xc4,0x02,0x02,0xac,0xef,0x90,0xfb,0x56,0xf5,0x19,0x64,0xf9,0x08,
-0xee,0xeb,0x10,0x09,0xef,0xee,0xee,0xe9,0x37,0x40,0x44,0x44,0x4d,0xc0,0xe7,0x27,
-0x00,0xa6,0x41,0x45,0xaf,0x33,0x33,0x3d,0x0d,0x00,0x50,0xae,0x00,0x03,0x5d,0xc0,
-0x54,0x42,0x27,0x6f,0xe6,0xa1,0x00,0x00,0x83,0x0e,0xf0,0x15,0xf4,0xe9,0x0f,0x98,
-0xf7,0x04,0xfd,0x8d,0xf2,0xff,0xc6,0x10,0x2e,0xcb,0x9f,0x6f,0x80,0x0a,0x20,0x45,
-0x55,0x60,0xfd,0x8a,0xf3,0x0e,0xff,0xff,0x07,0xcc,0xc9,0x00,0xeb,0x6b,0xf0,0xf8,
-0xac,0x20,0xb0,0xff,0x0f,0x98,0xfa,0x00,0xea,0x4a,0xf0,0xff,0xe8,0x10,0x0d,0x00,
-0xf5,0x00,0xa0,0x06,0x10,0xe7,0x5b,0xf0,0xfc,0x77,0xf6,0x0e,0x78,0xd8,0x08,0xee,
-0xec,0xf2,0x4d,0x92,0xe2,0x00,0x00,0x05,0x55,0xde,0x55,0x55,0x01,0xf9,0x08,0xb1,
-0x82,0x22,0x22,0x9f,0x11,0xfb,0x77,0x77,0x7c,0xf1,0x1f,0x94,0x08,0x10,0xf7,0x0e,
-0x29,0x02,0x0b,0x00,0x02,0x16,0x00,0x00,0x97,0x5f,0x12,0x11,0x2c,0x00,0x10,0xb7,
-0xce,0x49,0x04,0x41,0x04,0x00,0x36,0x56,0x02,0x77,0x33,0xb4,0x0e,0xd6,0x66,0x66,
+0xec,0xfc,0x24,0xf7,0xaa,0x88,0x5e,0x84,0xc1,0x49,0x24,0x00,0x0d,0xe4,0x00,0x01,
+0x00,0xf0,0x07,0x0b,0xa0,0x00,0x0f,0xa0,0x00,0x01,0xf6,0x10,0xcc,0xfd,0xcc,0x10,
+0x9d,0x5f,0x4f,0x96,0x69,0xf2,0x5f,0xbe,0xc1,0xbc,0x01,0x80,0xdf,0xf2,0x1f,0x84,
+0x48,0xf2,0x03,0xfc,0x0d,0x00,0xf4,0x18,0x23,0xef,0xbf,0x22,0x29,0xe1,0x80,0x3f,
+0xc9,0xeb,0xff,0xcf,0xcf,0x30,0x74,0x6a,0x1b,0xc9,0xff,0x20,0x1f,0x9a,0xf7,0xf5,
+0x9e,0xfa,0x04,0xe6,0xb1,0xf7,0x5c,0xd5,0xf7,0x48,0x12,0x01,0x0b,0xf7,0x03,0x55,
+0x00,0x10,0x10,0x03,0x00,0x00,0x5b,0x00,0xf3,0x3b,0x0e,0x70,0x00,0x01,0xf5,0x25,
+0xee,0xff,0xee,0x20,0x7d,0x5f,0x8f,0x44,0x45,0xf2,0x2e,0xac,0xa6,0xf3,0x33,0x4f,
+0x23,0xff,0xf1,0x6f,0xff,0xff,0xf2,0x02,0xeb,0xa6,0xe1,0x11,0x11,0x01,0xcf,0xaf,
+0x8f,0xff,0xff,0xf8,0x1d,0xa8,0xcb,0xf9,0xc3,0xd8,0x80,0x86,0x8b,0xbf,0xff,0xef,
+0xe8,0x0f,0x9b,0xfe,0xcc,0xd8,0xea,0x82,0xf6,0xb8,0xf8,0x9c,0x3d,0x88,0x4d,0x24,
+0x1b,0x49,0x61,0x6d,0x61,0x04,0x20,0x05,0xff,0xd9,0x03,0x73,0x00,0x5f,0x17,0xf0,
+0x9d,0x0a,0xe0,0x0d,0x00,0xf1,0x25,0x57,0x77,0x8f,0xa7,0x77,0x71,0x0a,0xbb,0xbd,
+0xfc,0xbb,0xbb,0x20,0x07,0xcc,0xdf,0xcc,0xcc,0x00,0x00,0x9e,0x77,0x77,0x7c,0xf0,
+0x00,0x09,0xf9,0x99,0x99,0xcf,0x00,0x00,0x9f,0xbb,0xbb,0xbe,0xf0,0x00,0x09,0xf8,
+0x88,0x88,0xcf,0x00,0x02,0xae,0x77,0x77,0x7c,0xf2,0x11,0xf2,0x03,0x40,0xf8,0x06,
+0xff,0xff,0x74,0x04,0x63,0x6f,0x28,0xf0,0x9d,0x0b,0xd0,0x0d,0x00,0x60,0x14,0x44,
+0x9f,0x54,0x45,0x50,0x4d,0x04,0xa1,0xfd,0xed,0x00,0x24,0x44,0x9f,0x58,0xfe,0x41,
+0x1f,0x2e,0x00,0xf2,0x0b,0x80,0x12,0x6a,0xff,0xf8,0x55,0x31,0x2a,0xff,0xfd,0xdd,
+0xdd,0xf6,0x00,0xc9,0xbf,0xaa,0xaa,0xaf,0x60,0x00,0x07,0xf6,0x66,0x67,0xf6,0x66,
+0x05,0xf2,0x0c,0x60,0x00,0x00,0x0e,0x90,0x00,0x52,0x00,0x0d,0xdd,0xff,0xdd,0xaf,
+0x50,0x00,0x66,0x6f,0xc6,0xcf,0x70,0x00,0x55,0x55,0xfb,0x8f,0xd5,0x51,0x41,0x00,
+0xf0,0x07,0x40,0x00,0x08,0xfe,0x51,0x11,0x00,0x01,0x7e,0xff,0xff,0xff,0xf0,0x04,
+0xff,0x9e,0xb0,0x00,0x00,0x00,0x07,0x16,0x5a,0x00,0xc0,0x00,0x00,0x34,0x44,0x48,
+0xf5,0x00,0x00,0x00,0x04,0x66,0xcf,0xf1,0x02,0x35,0x5f,0xfe,0x60,0xa2,0x01,0x00,
+0x55,0x00,0x81,0x32,0x00,0x06,0x66,0xfc,0x66,0x4e,0xc0,0xb6,0x04,0x83,0xd1,0x00,
+0x11,0x11,0xfa,0x3d,0xe2,0x10,0x96,0x00,0xf0,0x16,0x44,0x5a,0xff,0x84,0x44,0x42,
+0x02,0x8e,0xff,0xeb,0xbb,0xb0,0x03,0xff,0xef,0x66,0x66,0xbf,0x00,0x04,0x19,0xfc,
+0xcc,0xce,0xf0,0x00,0x00,0x9f,0x55,0x55,0xbf,0x00,0x00,0x09,0xf5,0x55,0x5b,0x0d,
+0x00,0x00,0x44,0x05,0xf5,0x2a,0x00,0x00,0xf9,0x0f,0x80,0x42,0x00,0xff,0xff,0x90,
+0xfd,0xef,0x90,0x02,0x22,0xf9,0x0f,0xc4,0x02,0x02,0xac,0xef,0x90,0xfb,0x56,0xf5,
+0x19,0x64,0xf9,0x08,0xee,0xeb,0x10,0x09,0xef,0xee,0xee,0xeb,0x00,0x00,0xaf,0x44,
+0x44,0x4d,0xc0,0x00,0x0a,0xff,0xff,0xff,0xfc,0x00,0x00,0xaf,0x33,0x33,0x3d,0x0d,
+0x00,0xb7,0xae,0x00,0x03,0x5d,0xc0,0x00,0x0a,0xe0,0x00,0x6f,0xe6,0xa1,0x00,0xf0,
+0x28,0xf7,0x00,0x00,0x07,0xf4,0xe9,0x0f,0x98,0xf7,0x04,0xfd,0x8d,0xf2,0xff,0xc6,
+0x10,0x2e,0xcb,0x9f,0x6f,0x80,0x0a,0x20,0x45,0x55,0x60,0xfd,0x8a,0xf3,0x0e,0xff,
+0xff,0x07,0xcc,0xc9,0x00,0xeb,0x6b,0xf0,0xf8,0x02,0x00,0x0e,0xed,0xff,0x0f,0x98,
+0xfa,0x00,0xea,0x4a,0xf0,0xff,0xe8,0x10,0x0d,0x00,0xf4,0x01,0xa0,0x06,0x10,0xe7,
+0x5b,0xf0,0xfc,0x77,0xf6,0x0e,0x78,0xd8,0x08,0xee,0xec,0x10,0xf5,0x05,0x91,0xe2,
+0x00,0x00,0x05,0x55,0xde,0x55,0x55,0x01,0xe2,0x06,0xb1,0x1f,0x82,0x22,0x22,0x9f,
+0x11,0xfb,0x77,0x77,0x7c,0xf1,0xf8,0x00,0x53,0x11,0xf7,0x00,0x00,0x08,0x0b,0x00,
+0x02,0x16,0x00,0x52,0x70,0x00,0x00,0x8f,0x11,0x2c,0x00,0x54,0xb7,0x77,0x77,0xcf,
+0x10,0x41,0x04,0x51,0x6f,0x50,0x00,0x00,0x0e,0x28,0x02,0xb4,0x0e,0xd6,0x66,0x66,
 0xce,0x00,0x0e,0xc4,0x44,0x44,0xce,0x12,0x00,0x44,0xc3,0x33,0x33,0xbe,0x0c,0x00,
-0xfa,0x0f,0xb1,0x8f,0x61,0x3b,0x20,0x0e,0xb0,0x0d,0xf7,0xef,0x50,0x0f,0xb0,0x25,
+0xf9,0x0f,0xb1,0x8f,0x61,0x3b,0x20,0x0e,0xb0,0x0d,0xf7,0xef,0x50,0x0f,0xb0,0x25,
 0xdf,0xf4,0x00,0x4f,0xee,0xfa,0x1a,0xff,0xd4,0x6f,0xc9,0x51,0x00,0x39,0xc0,0x01,
-0xca,0x0f,0x01,0xf5,0x07,0x02,0x5b,0x4b,0xd2,0x1b,0xf7,0x56,0xef,0x20,0x00,0x3e,
-0xfc,0x66,0xaf,0xa6,0x62,0x05,0x10,0x16,0xe1,0x02,0xf7,0x01,0xf7,0x02,0xf6,0x00,
-0x0f,0xb6,0x7f,0xa6,0x8f,0x60,0x00,0x51,0x23,0x01,0xfa,0x26,0x41,0x17,0x60,0x00,
-0xf7,0x30,0x01,0x00,0x8a,0x00,0x20,0x69,0xf5,0x8e,0x69,0x32,0xff,0xe9,0x00,0xae,
-0x31,0xf5,0x38,0x49,0xdd,0xef,0xdd,0xdf,0xee,0xd3,0x00,0x07,0xb0,0x02,0xa5,0xe5,
-0x00,0x66,0x66,0x66,0x8f,0x9d,0x90,0x0f,0xed,0xdd,0xde,0xfe,0xdd,0x10,0xf7,0x99,
-0x99,0x4f,0x66,0x50,0x0f,0x8f,0x6f,0x52,0xe9,0xf7,0x00,0xf7,0xfd,0xdf,0x5c,0xfe,
-0x00,0x1f,0x6f,0x77,0xd5,0x9f,0x80,0x04,0xf5,0xf6,0xf6,0x2b,0xf3,0x51,0x9f,0x2f,
-0xfe,0xff,0xed,0xcd,0x59,0x80,0x00,0x05,0xd2,0x3d,0xda,0x20,0x21,0x19,0x30,0xde,
-0x03,0x10,0xf3,0xd6,0x04,0x91,0x0b,0xf8,0x02,0x77,0x77,0x77,0x07,0xfb,0x31,0xb4,
-0x3f,0x21,0x1e,0xe0,0x60,0x01,0x70,0xf6,0x78,0x88,0x88,0x82,0x07,0xff,0xfd,0x00,
-0x30,0x46,0xff,0xe0,0x43,0x0f,0x21,0x3c,0xbe,0xbb,0x37,0x21,0x09,0xe0,0xfe,0x12,
-0x13,0x9e,0x0d,0x00,0x31,0x01,0x9a,0xf7,0xee,0x27,0xf1,0x0a,0xeb,0x10,0x00,0x00,
+0x35,0x03,0x21,0x2e,0x70,0x41,0x07,0xf1,0x03,0xff,0xff,0xf7,0x00,0x00,0x1b,0xf7,
+0x56,0xef,0x20,0x00,0x3e,0xfc,0x66,0xaf,0xa6,0x62,0x05,0x93,0x01,0xe1,0x60,0x02,
+0xf7,0x01,0xf7,0x02,0xf6,0x00,0x0f,0xb6,0x7f,0xa6,0x8f,0x60,0xb4,0x01,0xa1,0xf6,
+0x00,0x0f,0x70,0x00,0x00,0x17,0x60,0x00,0xf7,0x30,0x01,0x00,0x8a,0x00,0xa1,0x69,
+0xf5,0x00,0x4d,0xff,0xff,0xff,0xe9,0x00,0xbf,0x35,0x00,0xf4,0x39,0x49,0xdd,0xef,
+0xdd,0xdf,0xee,0xd3,0x00,0x07,0xb0,0x02,0xa5,0xe5,0x00,0x66,0x66,0x66,0x8f,0x9d,
+0x90,0x0f,0xed,0xdd,0xde,0xfe,0xdd,0x10,0xf7,0x99,0x99,0x4f,0x66,0x50,0x0f,0x8f,
+0x6f,0x52,0xe9,0xf7,0x00,0xf7,0xfd,0xdf,0x5c,0xfe,0x00,0x1f,0x6f,0x77,0xd5,0x9f,
+0x80,0x04,0xf5,0xf6,0xf6,0x2b,0xf3,0x51,0x9f,0x2f,0xfe,0xff,0xed,0xcd,0x59,0x80,
+0x00,0x05,0xd2,0x3d,0xc1,0xa3,0x00,0x21,0x19,0x30,0xde,0x03,0x10,0xf3,0xd6,0x04,
+0x90,0x0b,0xf8,0x02,0x77,0x77,0x77,0x07,0xfb,0x31,0x13,0x00,0x31,0x1b,0x1e,0xe0,
+0x60,0x01,0x70,0xf6,0x78,0x88,0x88,0x82,0x07,0xff,0xfd,0x00,0xf1,0x00,0x46,0xff,
+0xe0,0x00,0x01,0xf7,0x00,0x3c,0xbe,0x00,0x00,0x1f,0x70,0x00,0x09,0x0d,0x00,0x23,
+0x00,0x9e,0x0d,0x00,0x21,0x01,0x9a,0x0d,0x00,0xf0,0x0b,0x0d,0xeb,0x10,0x00,0x00,
 0x73,0x01,0x36,0x30,0x00,0x00,0x6f,0x7f,0xff,0xd8,0xcf,0xf2,0x5f,0xb1,0x67,0xf5,
-0x45,0x66,0x17,0xd7,0x7f,0x0a,0x3f,0x30,0xfc,0x46,0xf5,0xef,0x47,0xf2,0x2a,0x4e,
-0xef,0xec,0xff,0xf6,0x4f,0xf2,0xf9,0xf9,0xd5,0xfb,0x29,0xff,0x2f,0x8f,0x9d,0x0e,
-0x80,0x16,0xf2,0xee,0xfe,0xc0,0xe8,0x00,0x3f,0x28,0xaf,0x97,0x0e,0x80,0x03,0xf2,
-0x79,0xf8,0x60,0xe8,0x00,0x3f,0x5c,0xdf,0xef,0x7f,0x70,0x03,0xf3,0x65,0x43,0x1d,
-0xe3,0x00,0x00,0x11,0x15,0xf4,0x11,0x10,0xfe,0x0f,0x72,0xc0,0x02,0x55,0x58,0xf7,
-0x55,0x53,0xc8,0x1a,0x73,0x40,0x02,0x44,0x47,0xf7,0x44,0x42,0xe9,0x2a,0xf1,0x0a,
-0x02,0x26,0xee,0xbf,0x42,0x74,0x00,0x29,0xfe,0x21,0xf9,0x8f,0xa0,0x6f,0xff,0xb0,
-0x08,0xff,0x60,0x00,0x61,0xeb,0x38,0x7c,0xf8,0x00,0x0f,0x9c,0x0a,0xff,0x50,0x03,
-0xe9,0x40,0x00,0x04,0xa0,0x42,0x0b,0x24,0x8f,0x30,0x3b,0x15,0x91,0x00,0x34,0x55,
-0x55,0x55,0x54,0x30,0x00,0x6f,0xa1,0x23,0xf0,0x02,0x8b,0xf7,0x66,0x67,0xfc,0x82,
-0x19,0xcf,0x88,0x88,0x8f,0xc9,0x20,0x06,0xfe,0xdd,0xde,0x25,0x4d,0xf0,0x13,0xfe,
-0x8f,0x84,0xb6,0x00,0x5b,0xff,0x20,0xce,0xce,0x50,0x4f,0xcc,0xe1,0x46,0xef,0x81,
-0x00,0x10,0xcf,0xff,0x92,0xcf,0xf5,0x00,0x08,0x84,0x10,0x00,0x48,0x00,0x02,0x09,
-0xb0,0x3b,0x08,0x91,0xdb,0xab,0x46,0x7f,0xb6,0x63,0x02,0xbb,0xbc,0xb4,0x17,0x10,
-0xcb,0xf4,0x0e,0xf3,0x05,0x2b,0xff,0xb3,0x67,0xfb,0x66,0x11,0xb4,0xab,0x6e,0xee,
-0xee,0xe3,0x03,0x35,0x67,0xf6,0x33,0x33,0x22,0x8e,0x2a,0x50,0x18,0xeb,0x5f,0x53,
-0xda,0x19,0x25,0xf4,0x01,0x9f,0xf9,0x10,0x05,0x3d,0xea,0xe7,0x8f,0xd8,0x30,0x03,
-0xfc,0x95,0x10,0x29,0xe5,0x36,0x06,0x11,0x01,0xf2,0x02,0xf1,0x1f,0xba,0xb9,0x00,
-0x2f,0x57,0xe0,0x3f,0xff,0xfe,0xb2,0xf5,0x7e,0x04,0xe8,0xec,0x88,0x2f,0x57,0xe0,
-0x38,0x8e,0xc8,0x82,0xf5,0x7e,0x00,0xef,0xff,0xfe,0x04,0x17,0xe0,0x0e,0x4b,0xaf,
-0xe0,0x1f,0xfd,0x00,0x21,0x75,0x5f,0x50,0x78,0x30,0x6f,0x5c,0x00,0xf9,0x0c,0x71,
-0x35,0xaf,0xd9,0xf6,0x5d,0xb1,0x4e,0xff,0xb0,0x0b,0xff,0xb2,0x00,0x52,0xfc,0xac,
-0x0a,0xfe,0x93,0x00,0x3f,0xc8,0x40,0x03,0x9d,0x30,0xe5,0x2d,0x30,0x3f,0x20,0x0d,
-0x6a,0x04,0x10,0xc6,0xe0,0x04,0xf3,0x32,0x39,0xff,0xfa,0xfe,0x77,0x77,0x61,0x36,
-0x7f,0x9e,0xfc,0xcc,0xf8,0x00,0x09,0xd3,0x5f,0xbb,0xbf,0x80,0x04,0xfa,0xf7,0xf6,
-0x55,0xf8,0x03,0xff,0xf6,0x5f,0xff,0xff,0x80,0xcf,0xfe,0xd0,0x6f,0xa4,0x51,0x05,
-0x3f,0x69,0x7f,0xec,0xef,0x60,0x00,0xf5,0x4f,0xbf,0x8f,0xa0,0x00,0x0f,0x51,0x69,
-0xff,0xf9,0x61,0x00,0xf5,0x5d,0x94,0x17,0xbd,0x9f,0x03,0x02,0x48,0x0f,0xd0,0x50,
-0x55,0x5b,0xf5,0xce,0x55,0x51,0x01,0x44,0xae,0x4b,0xd4,0x43,0x0d,0x0b,0x00,0x77,
-0x15,0xf2,0x04,0xf1,0x8e,0x09,0xd0,0x9e,0x00,0x5f,0xef,0xfe,0xff,0xef,0xe0,0x02,
-0x44,0x8f,0x94,0x44,0x44,0x12,0x0b,0x01,0xf7,0x0b,0x03,0x3c,0xf6,0x34,0xee,0x43,
-0x20,0x03,0xef,0xfc,0xcf,0x40,0x00,0x03,0x46,0xaf,0xff,0xff,0xa5,0x00,0xaf,0xec,
-0x83,0x03,0x8e,0xa0,0xca,0x0f,0x20,0xff,0xf0,0xb0,0x04,0x00,0xb7,0x04,0x52,0x9f,
-0x44,0x44,0x4a,0xf0,0xfc,0x09,0x05,0x0d,0x00,0x00,0x70,0x1c,0x01,0xd7,0x04,0x15,
-0x5a,0x1a,0x00,0x21,0x02,0xfa,0xe0,0x46,0xf5,0x03,0xaf,0x50,0xae,0x00,0x99,0x17,
-0xdf,0xa0,0x09,0xf7,0x7e,0xa1,0xec,0x60,0x00,0x4e,0xff,0xe4,0xa5,0x40,0xf0,0x08,
-0x00,0xbf,0xff,0xfe,0x00,0x59,0xf5,0x3b,0xc5,0x5b,0xe0,0x1f,0xff,0xfa,0xbb,0x44,
-0xbe,0x00,0x7b,0xf8,0x5b,0xff,0xff,0xba,0x33,0xf4,0x22,0xbb,0x44,0xbe,0x04,0xef,
-0xfe,0xcb,0xed,0xde,0xe0,0x16,0xbf,0x75,0xbc,0x66,0xce,0x00,0x0b,0xfa,0x0b,0xff,
-0xff,0xd0,0x00,0xfc,0xf7,0x0f,0x7e,0x80,0x00,0x5f,0x38,0xb5,0xf3,0xe8,0x10,0x2e,
-0xb0,0x04,0xec,0x0e,0xbc,0x81,0xb1,0x00,0xec,0x10,0x9f,0xe4,0xec,0x07,0x12,0x22,
-0x42,0x0b,0x20,0xd0,0x0e,0x2e,0x00,0xf0,0x01,0x5e,0x10,0xe9,0x33,0xbd,0x06,0xff,
-0xff,0x3e,0x93,0x3b,0xd0,0x5c,0xcd,0xf3,0xef,0xb0,0x56,0xf0,0x0f,0xda,0x0e,0x93,
-0x3b,0xd0,0x00,0xbf,0x40,0xef,0xee,0xfd,0x02,0xdf,0xfe,0x2e,0xa4,0x4b,0xd0,0x9f,
-0xdf,0xd7,0xef,0xff,0xfd,0x02,0x29,0xe2,0x02,0xf3,0xe7,0x51,0x03,0xf4,0x01,0x8f,
-0x0e,0x75,0x30,0x09,0xe1,0x8f,0x80,0xeb,0xc9,0x00,0x9e,0x2d,0x60,0x09,0xee,0xb5,
-0x01,0x12,0x92,0xe2,0x14,0xf0,0x1a,0x30,0x09,0xff,0xff,0xf0,0x0a,0xff,0xf7,0x27,
-0xf5,0x8f,0x01,0xf9,0x5f,0x30,0x8d,0x06,0xf0,0xaf,0xcd,0xfb,0x5f,0x84,0xbd,0x04,
-0xfa,0xf9,0xfc,0xb0,0x9e,0x60,0x0e,0xbf,0xaf,0x3f,0x4f,0x60,0x00,0xeb,0xfb,0xf7,
-0x8d,0x1f,0xf1,0x0d,0x6e,0x4f,0xdb,0x5f,0x95,0x00,0xff,0xff,0xf6,0x86,0xfa,0x52,
-0x1f,0x4e,0x5f,0x9f,0xff,0xff,0x56,0xe0,0xe7,0xf1,0x00,0xf6,0x00,0x88,0x04,0xbb,
-0x99,0x1d,0x0b,0x46,0x24,0x10,0x40,0xb6,0x35,0x53,0x34,0xfd,0x43,0x33,0x22,0x41,
-0x42,0x61,0x13,0x33,0x33,0x33,0x30,0x00,0x6c,0x3b,0x01,0x6f,0x1f,0x24,0x22,0x20,
-0x0d,0x00,0x02,0x70,0x38,0x12,0x07,0x6d,0x01,0x80,0x7f,0x33,0x33,0x3a,0xf0,0x00,
-0x07,0xf6,0x65,0x06,0x64,0x00,0x7f,0xed,0xdd,0xde,0xf0,0x11,0x01,0x20,0x09,0xc0,
-0x9d,0x2e,0x00,0x9c,0x7a,0xe0,0x8f,0x10,0x03,0xff,0xff,0xf3,0x08,0xf1,0x00,0x04,
-0x44,0x44,0x00,0x8f,0xd9,0x03,0xf0,0x05,0xa7,0x8c,0xf9,0x84,0x04,0x66,0x64,0xcf,
-0xff,0xff,0x70,0xaf,0xff,0xa0,0x08,0xf1,0x00,0x03,0x55,0x53,0x1a,0x00,0x91,0x9f,
-0xef,0xb0,0x08,0xf1,0x00,0x09,0xa0,0x9b,0x0d,0x00,0x11,0xff,0x0d,0x00,0x22,0xc4,
-0x43,0xfd,0x4b,0x01,0x47,0x22,0x12,0x63,0x66,0x01,0xc0,0xb0,0x0a,0xff,0xff,0xf0,
-0x01,0x7d,0x11,0x47,0x77,0xcf,0x07,0xb8,0x01,0x50,0x09,0xf0,0x14,0x44,0x42,0x48,
-0x18,0xf1,0x08,0xdf,0xff,0x41,0x22,0x2a,0xf0,0x04,0x44,0x42,0x9f,0xff,0xff,0x01,
-0xff,0xff,0x79,0xf4,0x4b,0xf0,0x03,0x44,0x41,0x9f,0x84,0x1f,0xf4,0x09,0x49,0xf0,
-0x00,0x10,0x0e,0x61,0xf4,0x9f,0x00,0x0c,0x80,0xef,0xef,0x48,0xf9,0x89,0xf7,0x0e,
-0x94,0x41,0x2c,0xee,0xeb,0x10,0x63,0x46,0xa0,0xc0,0x04,0xff,0xff,0x10,0x03,0x7d,
-0x42,0x5f,0x79,0x01,0x23,0xf0,0x0b,0xc7,0xe0,0x5f,0x10,0x04,0x44,0x44,0xdb,0x04,
-0xf5,0x20,0xbf,0xff,0xdf,0x30,0x1e,0xf7,0x04,0x55,0x54,0x85,0x55,0x55,0x00,0xbf,
-0xff,0x00,0x47,0xf0,0x03,0x03,0x44,0x42,0xcc,0x34,0xfa,0x00,0xaf,0xff,0x44,0xf6,
-0xaf,0x20,0x0a,0x90,0xf4,0x0a,0xff,0x69,0x49,0xb3,0xad,0xfd,0xff,0xd7,0x0a,0xb4,
-0x47,0xd5,0x01,0x9e,0x40,0x91,0x18,0x12,0x60,0x8f,0x13,0x20,0x10,0x9f,0xb0,0x00,
-0x60,0xe4,0x04,0x77,0xfc,0x77,0x0b,0xdb,0x4a,0xf0,0x11,0x90,0x00,0x24,0x44,0x40,
-0x20,0xe9,0x00,0x01,0xff,0xf9,0x4f,0x2e,0x90,0x00,0x14,0x44,0x34,0xf2,0xef,0xfd,
-0x04,0xee,0xea,0x4f,0x2e,0xc7,0x70,0x04,0x44,0x24,0xf2,0x83,0x20,0x10,0xfb,0x1a,
-0x00,0x30,0x2f,0x19,0xb4,0x0d,0x00,0xc4,0xf7,0xcb,0xbf,0xaf,0xd9,0x93,0x2f,0xdd,
-0x9d,0xdd,0xdd,0xdd,0x58,0x0d,0x20,0x2d,0x10,0xfb,0x7b,0xf0,0x0e,0x00,0xe7,0x03,
-0x77,0xed,0x77,0x19,0xde,0xdd,0xbf,0xff,0xff,0xf3,0x46,0x66,0x61,0x0d,0xa0,0x20,
-0x02,0xff,0xfb,0x07,0xf3,0x9f,0x10,0x15,0x55,0x45,0x79,0x06,0xfa,0x17,0xff,0xfb,
-0x16,0x8f,0x95,0x60,0x04,0x44,0x30,0x6f,0x92,0xf9,0x02,0xff,0xfb,0x8e,0x53,0xed,
-0x00,0x2f,0x17,0xb0,0x17,0xff,0x90,0x02,0xff,0xfd,0x8e,0xf7,0x5f,0xb0,0x2f,0x54,
-0x4e,0xa2,0x00,0x6c,0x69,0x10,0xf0,0x07,0x2d,0x10,0x1b,0x40,0x0c,0x90,0x00,0xe8,
-0x00,0xcd,0x04,0xf6,0x0a,0xde,0xdd,0x6a,0xf8,0xaf,0x71,0x56,0x66,0x6a,0xf5,0x09,
-0x20,0xee,0xea,0x1a,0x6d,0xf0,0x14,0x28,0x88,0x53,0xff,0xff,0xfb,0x02,0xbb,0xb8,
-0x17,0x7f,0xc7,0x50,0x14,0x44,0x30,0x00,0xf8,0x00,0x04,0xfe,0xfc,0x8b,0xbf,0xdb,
-0xb3,0x4f,0x08,0xc6,0x88,0xfc,0x88,0x24,0xff,0xfc,0x27,0x00,0x37,0x4f,0x44,0x30,
-0xa0,0x22,0x13,0x40,0xc6,0x02,0x10,0x5f,0x6a,0x12,0xf4,0x37,0xd4,0x01,0x55,0xf8,
-0x9f,0x0b,0xff,0xff,0x5e,0x5f,0x37,0xf0,0x35,0x55,0x5d,0x8a,0xe0,0x8e,0x02,0xff,
-0xfa,0x45,0xf7,0x4c,0xc0,0x16,0x66,0x45,0xfb,0x0e,0xf5,0x02,0xff,0xfa,0x18,0x17,
-0x00,0x00,0x04,0x44,0x33,0x49,0xf6,0x43,0x03,0xff,0xfb,0xdc,0xe7,0xd8,0xc0,0x3f,
-0x08,0xdf,0x9e,0x01,0x9f,0x43,0xff,0xff,0xd6,0xf4,0x5f,0x94,0x3f,0x54,0x30,0x2f,
-0xff,0xb0,0x2d,0x05,0x12,0x50,0x13,0x0f,0xf0,0x30,0x60,0xaf,0xff,0xff,0xf0,0x12,
-0xc8,0x23,0x4e,0xc4,0x44,0x0c,0xff,0xff,0x54,0xeb,0x44,0x10,0x46,0x66,0x66,0xff,
-0xff,0xf3,0x03,0xff,0xfc,0x04,0xf3,0x2f,0x30,0x15,0x55,0x46,0xaf,0x78,0xf8,0x23,
-0xff,0xfc,0xdd,0xdd,0xdd,0xd5,0x15,0x55,0x52,0x88,0x88,0x85,0x03,0xff,0xfd,0x5f,
-0xdc,0xcf,0xa0,0x3f,0x17,0xd5,0xf1,0x00,0xda,0x0d,0x00,0x91,0xee,0xef,0xa0,0x3f,
-0x32,0x25,0xf7,0x66,0xea,0x4e,0x1a,0x25,0x01,0x10,0x11,0x01,0xf0,0x15,0x1c,0x40,
-0x1d,0x50,0x00,0xe7,0x00,0xdc,0x07,0xf3,0x0a,0xdf,0xdd,0x4a,0xe7,0xde,0x40,0x46,
-0x66,0x66,0xfe,0xee,0xfa,0x03,0xff,0xfa,0x5f,0x00,0x0c,0xa0,0x15,0x55,0x45,0xf4,
-0x44,0xda,0x0d,0x00,0xf9,0x14,0xff,0xff,0xa0,0x14,0x44,0x31,0x8f,0x6f,0x62,0x03,
-0xff,0xfb,0x09,0xf3,0xf3,0x00,0x3f,0x09,0xb0,0xea,0x3f,0x39,0x23,0xff,0xfc,0xbf,
-0x42,0xf8,0xf4,0x3f,0x44,0x5e,0x70,0x0d,0xfd,0x13,0x33,0x90,0x00,0x2e,0x20,0x01,
-0x1e,0xb1,0x10,0x00,0xd7,0xbd,0x04,0x30,0x48,0xff,0xff,0x71,0x40,0x30,0x26,0x66,
-0x62,0x69,0x03,0x90,0xff,0xf9,0x25,0x55,0x55,0x51,0x07,0x77,0x4a,0x41,0x08,0xfa,
-0x18,0xff,0xf9,0xa9,0x52,0x42,0xe6,0x04,0x44,0x33,0x3e,0x7d,0x85,0x20,0xff,0xfb,
-0x00,0xf6,0xd8,0x00,0x0f,0x39,0xb0,0x7f,0x2d,0x86,0x50,0xff,0xfb,0x6f,0xa0,0xdb,
-0xc8,0x0f,0x74,0x4c,0xa0,0x08,0xfe,0x30,0x75,0x29,0x21,0xd3,0x00,0x2d,0x4b,0xf0,
-0x0f,0xca,0x00,0x08,0xfe,0x20,0x00,0x4d,0xee,0xc1,0xaf,0xae,0xe3,0x00,0x16,0x66,
-0x9f,0xfe,0x69,0xff,0xa0,0x0d,0xff,0x9d,0xae,0xee,0xda,0x50,0x05,0x55,0x33,0x20,
-0x32,0x30,0x0d,0xff,0x88,0x3a,0x11,0xf0,0x05,0x04,0x44,0x28,0xc9,0x7e,0x5f,0x10,
-0x0e,0xff,0x98,0xed,0xcf,0xbf,0x10,0x0e,0x4a,0x98,0xec,0xbf,0xaf,0x0e,0x00,0xa5,
-0xc9,0x7e,0x7f,0x10,0x0e,0x84,0x28,0xc7,0x5b,0xbc,0x9e,0x06,0x04,0x18,0x01,0xf0,
-0x0b,0x0c,0x80,0xd8,0x30,0x00,0xc5,0x2f,0xff,0xdc,0xbf,0x12,0xff,0xfa,0xb8,0xa9,
-0xc9,0xc8,0x05,0x55,0x4a,0xac,0x7c,0xa5,0x30,0xcf,0xfb,0x3b,0x0b,0xf9,0x1e,0x04,
-0x55,0x27,0x77,0x7a,0xc4,0x20,0xcf,0xf5,0xee,0xde,0x8d,0xc8,0x03,0x44,0x1e,0x98,
-0xe6,0xff,0x10,0xbf,0xf6,0xed,0xce,0x4f,0x90,0x0b,0x5b,0x6e,0xcc,0xe8,0xf6,0xa0,
-0xbf,0xf6,0xea,0x7f,0xfd,0xec,0x0b,0x73,0x11,0x01,0xd4,0x3f,0x9a,0x35,0x00,0x0b,
-0x25,0xf1,0x15,0x2f,0x20,0x00,0x17,0xf8,0x99,0x5a,0xff,0xff,0x60,0xbe,0xcc,0xed,
-0xfe,0x4f,0x50,0x5f,0xcc,0x6e,0x63,0xbf,0xc0,0x00,0x8c,0xcb,0xf4,0xbf,0xcf,0xd5,
-0x04,0x52,0x7a,0xb8,0x20,0x28,0x12,0xca,0x12,0x80,0xe4,0x00,0x6a,0xaa,0xaa,0xaa,
-0x80,0x00,0x51,0x2b,0xf0,0x03,0xb9,0x00,0x00,0x69,0x99,0x99,0x99,0x90,0x00,0x0b,
-0xc4,0x44,0x44,0xaf,0x00,0x00,0xbe,0xcc,0xf9,0x0a,0xf0,0x23,0x07,0xee,0xff,0xef,
-0xfe,0xf7,0x00,0x07,0x7b,0xf7,0xcf,0x7f,0x70,0x02,0xfa,0xcf,0x8c,0xf8,0x84,0x00,
-0x5f,0xce,0xfc,0xef,0xcc,0xc3,0x01,0x6d,0xf7,0x29,0xe3,0x8f,0x21,0xff,0xfd,0xcb,
-0xcd,0xdf,0x50,0x02,0xaf,0xaa,0xaa,0xad,0xf0,0x00,0x09,0xf7,0x77,0x77,0x70,0x06,
-0x00,0x77,0x24,0x02,0x9e,0x11,0xf0,0x1f,0x00,0x04,0x8c,0xf6,0x00,0xcf,0xa4,0x00,
-0xbc,0x71,0x00,0x00,0x3a,0xb1,0x0e,0xff,0xf8,0x00,0xe9,0x00,0x00,0xe9,0x3f,0x80,
-0x0e,0x90,0x00,0x0e,0x81,0xe8,0x00,0xea,0x33,0x10,0xef,0xff,0x80,0x0e,0xff,0xf6,
-0x0e,0x70,0xe8,0x00,0xea,0x22,0x0d,0x00,0x00,0x1a,0x00,0xf6,0x17,0x92,0xe8,0xcf,
-0xff,0xfe,0x00,0xe9,0x4f,0x8c,0xeb,0xbe,0xe0,0x0e,0xff,0xf8,0xc8,0x00,0x9e,0x00,
-0x7d,0x4d,0x2c,0x80,0x09,0xe0,0x2f,0xa0,0xcc,0xcf,0xff,0xfe,0x04,0xc1,0x02,0x2c,
-0xc6,0x6b,0xd0,0x3d,0x22,0x01,0x66,0x17,0xb3,0xaa,0xbf,0xda,0xaa,0x30,0x00,0xac,
-0xcd,0xfe,0xcc,0xc3,0x4a,0x22,0xf7,0x24,0x1d,0xdd,0xde,0xff,0xdd,0xdd,0x60,0x99,
-0x9c,0xfa,0xcf,0xb9,0x94,0x00,0x95,0x7f,0x17,0xf5,0x91,0x00,0x4f,0x69,0xf0,0x7f,
-0x4f,0xa0,0x1e,0xd0,0xdd,0x07,0xf2,0x8f,0x32,0xc2,0x6f,0x70,0x7f,0x21,0xf6,0x00,
-0x7f,0xd0,0x8c,0xf2,0x00,0x00,0x05,0xc1,0x0c,0xfa,0x00,0xf8,0x20,0xf0,0x39,0x0d,
-0xff,0xff,0x00,0xce,0xff,0xe7,0x45,0x5b,0xf0,0x05,0x6f,0xb6,0x30,0x00,0x8f,0x00,
-0x22,0xe9,0x21,0x22,0x29,0xf0,0x3f,0xff,0xff,0xcb,0xff,0xff,0x00,0x32,0xad,0x22,
-0xbc,0x22,0x20,0x0c,0x99,0xe6,0x4b,0xb0,0x07,0x30,0xd9,0x9f,0xe9,0xbc,0x22,0xd8,
-0x0e,0xfa,0xd0,0x08,0xff,0xff,0x40,0xff,0xfd,0x00,0x02,0x33,0x20,0x2f,0x9f,0xfb,
-0x97,0x77,0x77,0x66,0xf0,0x3a,0xef,0x4f,0x37,0x04,0x5f,0x18,0xf0,0x08,0x20,0x8f,
-0xff,0xff,0x32,0xee,0xfe,0xe2,0x7f,0x68,0xf2,0x16,0x9f,0x86,0x08,0xe0,0x6f,0x11,
-0x26,0xf4,0x23,0xf9,0x5b,0x5d,0x32,0xf4,0x23,0xed,0x1c,0xfa,0x03,0x66,0xf9,0x63,
-0x75,0x66,0x50,0x1e,0x4f,0x72,0x3f,0xee,0xfe,0x01,0xf4,0xfe,0xd4,0xf3,0x09,0xe0,
-0x2f,0xcf,0x50,0x3f,0xfe,0xfe,0x04,0xff,0xf5,0x01,0x44,0x44,0x40,0x7e,0x9f,0xe9,
-0x87,0x77,0x78,0x59,0xa0,0x5b,0xef,0xff,0xff,0xf5,0x01,0x40,0x08,0x10,0xf7,0x40,
-0x08,0xa0,0xf7,0x4f,0x7f,0xc8,0x88,0x82,0x0f,0x40,0xe7,0xf8,0x7d,0x56,0x10,0x9f,
-0x0d,0x34,0x30,0x0b,0xcf,0xc5,0x61,0x17,0xe0,0x24,0xf1,0x0f,0x80,0x0e,0x80,0x1f,
-0x6f,0xc6,0xf8,0x00,0xe8,0x01,0xf6,0x9e,0x37,0xc0,0x80,0x1f,0x6f,0x10,0xfb,0x77,
-0x73,0x01,0xf9,0xfe,0x9f,0x80,0x50,0x5f,0x85,0x82,0xff,0xff,0xff,0x84,0x61,0x00,
-0x08,0x52,0x53,0x00,0x1f,0x2a,0xf0,0x14,0x07,0xf0,0x00,0x5d,0xef,0xdc,0x00,0x7f,
-0x00,0x02,0x6a,0xf6,0x63,0x5a,0xf5,0x51,0x2f,0xff,0xfb,0xaf,0xff,0xff,0x42,0xf6,
-0xd7,0xca,0xa6,0xe1,0xf4,0x2f,0xff,0xfc,0xaa,0x6e,0x1f,0x0d,0x00,0xf0,0x0b,0xed,
-0xfc,0xf4,0x2f,0xff,0xfb,0xae,0xdf,0xbf,0x42,0x49,0xf4,0x4a,0xa6,0xe1,0xf4,0x9f,
-0xff,0xff,0xca,0x6e,0x1f,0x40,0x17,0xf1,0x1a,0x28,0x19,0x65,0x6f,0x00,0xac,0x55,
-0x6e,0x30,0x55,0x00,0x00,0xdc,0x06,0xf5,0x36,0x2c,0xdf,0xca,0x44,0x9f,0x54,0x21,
-0x8b,0xf8,0x6f,0xff,0xff,0xf9,0x0b,0xdf,0xb7,0x2d,0x82,0xb7,0x10,0xf9,0xea,0xa7,
-0xf4,0x0a,0xf2,0x0f,0xff,0xfc,0xfc,0x30,0x6f,0xa0,0xf8,0xea,0xa4,0xbd,0x4f,0x80,
-0x0f,0xff,0xfa,0x03,0xfd,0xe0,0x00,0x28,0xf2,0x20,0x0c,0xf7,0x00,0x5f,0xff,0xfd,
-0x04,0xff,0xd1,0x00,0x27,0xf2,0x28,0xfb,0x5e,0xf7,0x00,0x6f,0x00,0xc6,0xff,0x5f,
-0x20,0x12,0xc8,0x9b,0x2a,0xf1,0x27,0x15,0xac,0x8d,0xda,0x27,0x46,0xf1,0x3d,0xc9,
-0xf3,0x54,0xf8,0x45,0x01,0xfd,0xdc,0x6f,0xff,0xff,0xb0,0x4a,0xec,0xa7,0x78,0xfa,
-0x75,0x05,0xee,0xfd,0xbf,0x6f,0x9b,0xb0,0x0c,0x7d,0x74,0xfe,0xfe,0xfb,0x00,0xd6,
-0xd7,0x4f,0x7f,0xac,0xb0,0x0e,0x5e,0xa4,0x77,0xfa,0x75,0x02,0xf6,0xb7,0x12,0x70,
-0x8e,0x09,0x15,0x56,0xf9,0x55,0x13,0x41,0x5c,0x41,0x50,0x00,0x0a,0x60,0x34,0x08,
-0x21,0x9f,0x60,0xfa,0x61,0x11,0xa7,0x45,0x70,0x00,0x89,0x10,0x10,0x10,0x87,0x71,
-0xf7,0x22,0x3f,0xf7,0x00,0x06,0xff,0x90,0x09,0xfc,0xd0,0x00,0x24,0xf9,0x02,0xf9,
-0x4f,0x50,0x00,0x0e,0x90,0xcf,0x20,0xee,0x30,0x00,0xe9,0xcf,0x50,0x04,0xff,0x20,
-0x4f,0xb4,0x60,0x00,0x04,0x90,0x5f,0xac,0xe9,0x76,0x67,0x79,0x52,0xb0,0x06,0xce,
-0xff,0xff,0xe3,0x75,0x34,0x41,0x20,0x00,0x00,0x93,0x12,0x6d,0x30,0x1d,0xf3,0x2f,
-0xc7,0x05,0x40,0x1d,0x52,0xf8,0x44,0x31,0x67,0xf1,0x05,0x2f,0xa7,0x7b,0xf1,0x05,
-0x88,0x42,0xfe,0xdd,0xdd,0x10,0x9f,0xf8,0x2f,0x73,0x33,0x31,0x00,0x0e,0x82,0xc6,
-0x0e,0xf1,0x0d,0xe8,0x2f,0x50,0x00,0xf8,0x00,0x0e,0x82,0xf8,0x55,0x5f,0x80,0x00,
-0xe9,0x2e,0xee,0xee,0xe8,0x03,0xde,0xea,0x65,0x44,0x56,0x74,0x3d,0x11,0x9e,0x00,
-0x0f,0x08,0x01,0x00,0xa0,0xb9,0x00,0x6e,0x10,0x4f,0x40,0x07,0xf5,0x01,0xf7,0xc2,
-0x66,0x11,0x85,0x35,0x27,0x80,0x00,0x27,0x7c,0xf7,0x76,0x05,0xcc,0x60,0x29,0x3c,
-0x30,0x4a,0xf7,0xdf,0x23,0x02,0x81,0x0f,0x75,0x66,0xff,0xb6,0x62,0x00,0xf7,0xe6,
-0x69,0xf1,0x07,0x0f,0x71,0x9f,0xa0,0xaf,0x70,0x06,0xfa,0x7f,0x80,0x00,0xa7,0x09,
-0xfb,0xfe,0xb8,0x77,0x79,0xa7,0x5a,0x01,0x8e,0xf4,0x26,0x08,0x0a,0x05,0x20,0xb3,
-0x03,0xe6,0x11,0xa0,0x1c,0xf4,0x03,0xb8,0x5e,0xd2,0x00,0x1d,0xb0,0x18,0x97,0x19,
-0x20,0x20,0x5f,0xc2,0x08,0x80,0x11,0x05,0xf5,0x8f,0x49,0xf0,0x8f,0xf8,0x0d,0x00,
-0x91,0x03,0x5f,0x85,0xf5,0x8f,0x39,0xf0,0x00,0xe8,0x1a,0x00,0xf6,0x07,0x0e,0x85,
-0xf2,0x6f,0x19,0xf0,0x02,0xfa,0x5f,0x25,0xf6,0xfb,0x05,0xfb,0xdd,0x75,0x44,0x56,
-0x74,0x3c,0x00,0x7d,0xb6,0x00,0x20,0x05,0x00,0x19,0x0d,0xf0,0x01,0x02,0xfd,0x1c,
-0xee,0xff,0xee,0xe4,0x03,0xf7,0x55,0x5b,0xf5,0x55,0x10,0x02,0x07,0xb6,0x00,0xf0,
-0x0a,0x35,0x53,0x8f,0x3a,0xf3,0xbe,0x08,0xff,0x88,0xf5,0xbf,0x5b,0xe0,0x24,0xf8,
-0x6d,0xef,0xfe,0xdc,0x00,0x0e,0x80,0x2e,0xff,0xf8,0xdc,0x52,0xf0,0x05,0xb9,0xe4,
-0xed,0x10,0x2f,0xb8,0x60,0x9e,0x01,0x60,0x5f,0xdd,0xea,0x66,0x56,0x68,0x64,0xc0,
-0x06,0xbe,0x3a,0x62,0x03,0x79,0x34,0x01,0x62,0x17,0xa1,0x10,0xbf,0x67,0xe1,0x11,
-0x17,0xf1,0x00,0xaa,0x8f,0xd1,0x16,0xf0,0x19,0x08,0xe5,0xe2,0x3f,0x50,0x3a,0xa6,
-0x8e,0xaf,0xcc,0xfa,0x04,0xcf,0x99,0xc6,0x6e,0xc6,0x60,0x00,0xf9,0xcb,0xdf,0xff,
-0xfb,0x00,0x0f,0xaf,0xa6,0x6e,0xc6,0x61,0x00,0xfe,0xf9,0xbb,0xfe,0xbb,0x30,0x2f,
-0xd9,0xb8,0x29,0xa7,0x4f,0xdd,0xfa,0x76,0x77,0x8a,0x52,0xd1,0x06,0xcf,0xbb,0x01,
-0x13,0x10,0x2e,0x47,0x10,0x6f,0xe5,0x05,0xb0,0xfa,0x06,0xe2,0x26,0xf1,0x00,0x07,
-0x60,0x6f,0xed,0x4f,0x10,0x3c,0xf3,0x25,0xe3,0xe4,0xf1,0x06,0xdd,0x66,0xdf,0xdf,
-0xdf,0xc0,0x4a,0xf7,0x7f,0x77,0x77,0xaf,0x00,0x0f,0x77,0xf5,0xff,0xe5,0xf0,0x00,
-0xf7,0x7f,0x6b,0x4e,0x5f,0x00,0x0f,0x77,0xf6,0xfe,0xe7,0xf0,0x07,0xf9,0x8f,0x23,
-0x03,0xfb,0x08,0xfa,0xfd,0x86,0x66,0x78,0xaa,0x59,0x02,0x9e,0x96,0x44,0x06,0x0a,
-0x06,0x81,0x72,0x01,0x11,0xd9,0x11,0x10,0x2e,0xe2,0x04,0x0c,0x91,0x2f,0x61,0x5f,
-0x31,0xe9,0x10,0x00,0x10,0xaf,0x22,0x0a,0xf6,0x21,0x0a,0xc4,0x9c,0x47,0xf0,0x7f,
-0xf7,0xab,0xbd,0xec,0x8f,0x03,0x7f,0x7a,0xb4,0xbd,0x75,0xf0,0x00,0xf7,0xab,0x9a,
-0x7e,0x5f,0x00,0x0f,0x7a,0xb9,0xee,0xe9,0xf0,0x05,0xfa,0x9a,0x22,0x05,0xea,0x04,
-0xf9,0xde,0x96,0x55,0x67,0xa7,0x2b,0x00,0x7c,0xef,0x3a,0x16,0x02,0x15,0x05,0xf0,
-0x00,0xd5,0x0c,0xff,0xbd,0xff,0xf0,0x0c,0xf3,0xc9,0x8b,0xd8,0x6f,0x00,0x2f,0x9c,
-0x0d,0x00,0xf6,0x29,0x00,0x40,0xba,0x49,0xd9,0x49,0x31,0x33,0x15,0xcf,0xb9,0xfd,
-0xa1,0x5f,0xf8,0x8d,0xfe,0xef,0xdb,0x01,0x2f,0x82,0x5f,0x89,0xf5,0x30,0x00,0xf9,
-0xee,0xff,0xff,0xee,0x40,0x0f,0x83,0x9f,0x88,0xf8,0x31,0x00,0xfc,0x9f,0xa0,0x08,
-0xf9,0x03,0xde,0xbf,0xd6,0x44,0x49,0x74,0x2e,0x20,0x3a,0xef,0x71,0x02,0x23,0x05,
-0x60,0x3c,0x4a,0xf0,0x14,0x0d,0xff,0xf3,0x06,0x6b,0xf8,0x62,0xda,0x7f,0xa0,0xdf,
-0xff,0xff,0x5d,0x75,0xf4,0x00,0xe6,0x0d,0xb0,0xd7,0x9e,0x00,0x1c,0xb4,0xf6,0x1d,
-0x7e,0x80,0x3f,0xff,0xff,0xfa,0xd8,0xda,0xb1,0x1c,0xf0,0x07,0x1d,0x74,0xf3,0x09,
-0xff,0xff,0xf2,0xd7,0x0e,0x70,0x9e,0x66,0xaf,0x2d,0x94,0xf7,0x09,0xd0,0x05,0xf2,
-0xda,0xff,0xf7,0x34,0x80,0x2d,0x73,0x00,0x09,0xe6,0x69,0xe2,0xd7,0x5a,0x0e,0x70,
-0xcc,0xcc,0xce,0xe0,0x00,0x08,0xf9,0xda,0x29,0x80,0x00,0x8f,0x88,0x88,0x8d,0xe0,
-0x00,0x04,0xf3,0x1c,0x13,0x00,0xf8,0x1d,0x21,0x17,0x88,0x7d,0x54,0xf2,0x03,0xbd,
-0x78,0xfb,0x7a,0xf3,0x00,0x0b,0xeb,0xbf,0xdb,0xcf,0x30,0x00,0x8b,0xaa,0xfc,0xaa,
-0xb2,0x3d,0x0d,0x83,0x70,0x02,0x22,0x23,0xf8,0x22,0x22,0x12,0x81,0x0b,0x13,0x22,
-0x99,0x38,0xf2,0x3b,0x1f,0xff,0xff,0x80,0x08,0xfe,0xe3,0x44,0x44,0xe8,0x06,0xf7,
-0x2d,0x9b,0xdd,0xdf,0x80,0x6f,0xff,0xc1,0x56,0x66,0xe8,0x00,0x3b,0xc4,0x6d,0xdd,
-0xdf,0xe3,0x15,0xbc,0x57,0xdd,0xfe,0xdd,0x44,0xff,0xff,0x59,0x0e,0x72,0x80,0x06,
-0x9a,0x83,0xd8,0xeb,0xea,0x00,0xf9,0xbf,0x04,0xcf,0xfb,0x00,0x08,0xad,0xc8,0xfa,
-0xfb,0xfb,0x24,0xef,0xfc,0x96,0x5f,0x73,0xc3,0x27,0x40,0x00,0x0d,0xe3,0xa6,0x0d,
-0x00,0xcb,0x5a,0xf0,0x06,0xfa,0x33,0x33,0x33,0x00,0x00,0x0f,0xb5,0x55,0x55,0x30,
-0x00,0x00,0xfe,0xdd,0xdd,0xd8,0x00,0x00,0x0f,0xc9,0xc0,0x1f,0x00,0xfb,0x42,0x14,
-0x64,0xb0,0x1d,0xf0,0x01,0x69,0xf8,0x6e,0xe6,0x7e,0xa4,0x00,0x4f,0x30,0x5f,0x9d,
-0xf7,0x00,0x04,0xf3,0x14,0x1d,0x67,0xc5,0xbf,0xef,0xe0,0x7f,0xfb,0x60,0x08,0xc8,
-0x41,0x00,0x28,0xd3,0xe0,0x14,0x10,0xf2,0x9a,0x2b,0x52,0x38,0xf2,0xf8,0x39,0xf0,
-0x0c,0x00,0x54,0xf9,0x27,0xf2,0xf7,0x19,0x0c,0x00,0xf1,0x01,0x35,0x54,0x55,0x49,
-0xf0,0xf8,0x9f,0xff,0xff,0x98,0xf0,0xf8,0x08,0xd0,0xf7,0x08,0xf2,0x42,0xf1,0x06,
-0xd8,0xf0,0xf8,0x2b,0xb3,0xf8,0x28,0xf0,0xf8,0x3f,0x50,0xe7,0x8d,0xf0,0xf8,0x79,
-0x00,0xe6,0xde,0x70,0xff,0x3c,0x44,0x30,0xfa,0x17,0xf1,0x3c,0x00,0xb3,0xef,0xf1,
-0xff,0xef,0xf0,0xfa,0x38,0xf1,0xf8,0x29,0xf0,0x18,0x00,0x10,0x12,0x54,0x44,0x11,
-0xf9,0x42,0x44,0x55,0xf9,0x0f,0x83,0x9f,0x08,0x0c,0x00,0x13,0x82,0x0c,0x00,0x62,
-0x8d,0xf0,0xf9,0x09,0x30,0x03,0x77,0x46,0x10,0x73,0x1a,0x38,0xf0,0x0c,0x00,0x7f,
-0x90,0x00,0x1f,0x8e,0xa0,0x3f,0xbf,0x80,0x01,0xf3,0xf6,0x6f,0xb0,0x8f,0x90,0x1f,
-0x6f,0x7f,0xd2,0x11,0xbf,0x81,0xf8,0xf0,0x8f,0x3d,0x06,0xfd,0x1b,0x4e,0x60,0x33,
-0xf9,0x30,0x01,0xf3,0xab,0xaa,0xaf,0xda,0xa4,0x1f,0x5c,0xcb,0xbb,0xfd,0xbb,0x41,
-0xfc,0xf6,0x4b,0x0f,0x8a,0x50,0x1f,0x41,0x0d,0xa0,0xf7,0x8f,0x21,0xf3,0x07,0xe4,
-0x6f,0x70,0xd7,0x1f,0x30,0x01,0x3f,0x39,0x51,0x21,0xcb,0x09,0x75,0x6b,0xc2,0xeb,
-0xef,0xcb,0xb8,0x00,0x7f,0xe7,0x7c,0xe7,0x77,0x40,0x3f,0xab,0x20,0xc2,0x3b,0xe7,
-0x7d,0xe7,0x77,0x00,0x00,0xbe,0x77,0xde,0x77,0x70,0x93,0x45,0x73,0xf0,0x01,0x78,
-0x46,0xf8,0x44,0x44,0x46,0x39,0xf2,0x54,0x02,0x28,0xff,0xff,0xfa,0x32,0x13,0xae,
-0xf9,0x3f,0x57,0xff,0xb5,0x0c,0x82,0x02,0xf5,0x00,0x6b,0x20,0x00,0x0b,0x30,0x00,
-0x95,0x70,0x04,0xdd,0xfe,0xdc,0x3f,0x4f,0x40,0x29,0x87,0x99,0x79,0xf6,0xb7,0x20,
-0xc9,0xec,0xd9,0xff,0xff,0xf6,0x0c,0xaa,0xbd,0xdf,0xc3,0xf4,0x00,0xcf,0xff,0xf7,
-0xbf,0xff,0xf4,0x03,0x3b,0xa3,0x28,0xd5,0xf5,0x12,0xff,0xff,0xfc,0x8d,0x6f,0x71,
-0x2f,0x6e,0x87,0xc8,0xff,0xff,0x42,0xfc,0xee,0xac,0x8c,0x2f,0x20,0x2f,0x43,0x5b,
-0xc8,0xff,0xff,0x82,0xf0,0x05,0xc6,0x8d,0x77,0x73,0x04,0x66,0x29,0xf3,0x11,0x57,
-0x77,0xbf,0x77,0x77,0x51,0x2f,0xdd,0xde,0xfd,0xdd,0xef,0x32,0xf6,0xaa,0x8f,0x5a,
-0xa5,0xf3,0x2b,0x45,0x57,0xf3,0x55,0x4b,0x20,0x05,0x99,0x6b,0x49,0x95,0x00,0x26,
-0x1e,0x30,0x0f,0xa7,0xbf,0xea,0x08,0x52,0xfb,0x8c,0xf8,0x8c,0xf0,0x86,0x02,0x80,
-0x52,0x00,0xc6,0x18,0xf6,0x44,0x5d,0x80,0x59,0x66,0x41,0xff,0xd2,0x04,0xff,0xe4,
-0x13,0xf3,0x04,0x02,0x22,0x4f,0x82,0x22,0x10,0x00,0xad,0xdd,0xfe,0xdd,0xd2,0x00,
-0x04,0x55,0x6f,0x95,0x55,0x10,0x7a,0x40,0x10,0x34,0xe1,0x41,0x11,0x31,0x43,0x11,
-0xe1,0xd0,0x00,0x06,0xf9,0x77,0x77,0xdd,0x00,0x00,0x6f,0x87,0x77,0x7d,0xd0,0xbc,
-0x1e,0x10,0xfd,0x5a,0x44,0x90,0x03,0x4d,0xc0,0x00,0x06,0xf2,0x00,0x6e,0xd6,0x51,
-0x26,0xe0,0x0a,0xf0,0x00,0x00,0x77,0x7d,0xe0,0xaf,0x77,0x72,0x0f,0xff,0xfe,0x0a,
-0xa7,0x05,0x30,0x0b,0xe0,0xaf,0xea,0x0b,0xf0,0x03,0xce,0x0a,0xf4,0x44,0x00,0xdf,
-0xff,0xe0,0xaf,0xff,0xf1,0x02,0x22,0xce,0x0a,0xf2,0x22,0x00,0x1a,0x00,0x31,0x11,
-0x11,0x4f,0x27,0x00,0x10,0x92,0x34,0x00,0x23,0x66,0x63,0x41,0x00,0x02,0x34,0x00,
-0x09,0x46,0x1e,0xe2,0x90,0x77,0x77,0xaf,0xa7,0x77,0x74,0x01,0x11,0x18,0xf3,0x11,
-0x11,0x00,0xf7,0x59,0xf8,0x09,0x09,0xfa,0xed,0xac,0xfa,0xdf,0x00,0x9e,0x0b,0xb3,
+0x45,0x66,0x17,0xd7,0x7f,0x57,0x02,0xf1,0x31,0x03,0xfc,0x46,0xf5,0x40,0x00,0x00,
+0x8f,0x4e,0xef,0xec,0xff,0xf6,0x4f,0xf2,0xf9,0xf9,0xd5,0xfb,0x29,0xff,0x2f,0x8f,
+0x9d,0x0e,0x80,0x16,0xf2,0xee,0xfe,0xc0,0xe8,0x00,0x3f,0x28,0xaf,0x97,0x0e,0x80,
+0x03,0xf2,0x79,0xf8,0x60,0xe8,0x00,0x3f,0x5c,0xdf,0xef,0x7f,0x70,0x03,0xf3,0x65,
+0x43,0x1d,0xe3,0x00,0x00,0x11,0x15,0xf4,0x11,0xbd,0x07,0xb1,0xff,0xff,0xc0,0x02,
+0x55,0x58,0xf7,0x55,0x53,0x00,0x0f,0x2f,0x03,0x71,0x02,0x44,0x47,0xf7,0x44,0x42,
+0x03,0x1f,0x01,0xfb,0x1a,0xf3,0x02,0x26,0xee,0xbf,0x42,0x74,0x00,0x29,0xfe,0x21,
+0xf9,0x8f,0xa0,0x6f,0xff,0xb0,0x08,0xff,0x60,0x00,0x61,0xeb,0x38,0x7c,0xf8,0x00,
+0x00,0x4f,0xff,0xf8,0x0a,0xff,0x50,0x03,0xe9,0x40,0x00,0x04,0xa0,0x00,0x01,0x00,
+0x52,0x8f,0x30,0x00,0x00,0x2f,0x40,0x08,0x80,0x34,0x55,0x55,0x55,0x54,0x30,0x00,
+0x6f,0x1e,0x09,0xf0,0x29,0x01,0x8b,0xf7,0x66,0x67,0xfc,0x82,0x19,0xcf,0x88,0x88,
+0x8f,0xc9,0x20,0x06,0xfe,0xdd,0xde,0xf7,0x00,0x00,0x17,0xfe,0x8f,0x84,0xb6,0x00,
+0x5b,0xff,0x20,0xce,0xce,0x50,0x4f,0xcc,0xe1,0x46,0xef,0x81,0x00,0x10,0xcf,0xff,
+0x92,0xcf,0xf5,0x00,0x08,0x84,0x10,0x00,0x48,0x00,0x02,0x09,0xb0,0x3b,0x08,0x90,
+0xdb,0xab,0x46,0x7f,0xb6,0x63,0x02,0xbb,0xbc,0x49,0x00,0xf1,0x0b,0x02,0xcb,0x00,
+0x1f,0x80,0x00,0x2b,0xff,0xb3,0x67,0xfb,0x66,0x11,0xb4,0xab,0x6e,0xee,0xee,0xe3,
+0x03,0x35,0x67,0xf6,0x33,0x33,0x22,0x75,0x00,0xf4,0x0c,0xf9,0x00,0x18,0xeb,0x5f,
+0x53,0xda,0x02,0xdf,0xfc,0x00,0x9f,0xf9,0x10,0x05,0x3d,0xea,0xe7,0x8f,0xd8,0x30,
+0x03,0xfc,0x95,0x10,0x29,0xe5,0x36,0x06,0x11,0x01,0xf2,0x02,0xf1,0x1f,0xba,0xb9,
+0x00,0x2f,0x57,0xe0,0x3f,0xff,0xfe,0xb2,0xf5,0x7e,0x04,0xe8,0xec,0x88,0x2f,0x57,
+0xe0,0x38,0x8e,0xc8,0x82,0xf5,0x7e,0x00,0xef,0xff,0xfe,0x04,0x17,0xe0,0x0e,0x4b,
+0xaf,0xe0,0x1f,0xfd,0x00,0x21,0x75,0x5f,0x50,0x78,0x30,0x6f,0x5c,0x00,0xf1,0x0b,
+0x71,0x35,0xaf,0xd9,0xf6,0x5d,0xb1,0x4e,0xff,0xb0,0x0b,0xff,0xb2,0x00,0x52,0xfc,
+0xac,0x0a,0xfe,0x93,0x00,0x3f,0xc8,0x40,0x03,0x9d,0xfb,0x01,0x05,0x3e,0x07,0x30,
+0x3f,0x20,0x0d,0x6a,0x04,0x10,0xc6,0xe0,0x04,0xf3,0x32,0x39,0xff,0xfa,0xfe,0x77,
+0x77,0x61,0x36,0x7f,0x9e,0xfc,0xcc,0xf8,0x00,0x09,0xd3,0x5f,0xbb,0xbf,0x80,0x04,
+0xfa,0xf7,0xf6,0x55,0xf8,0x03,0xff,0xf6,0x5f,0xff,0xff,0x80,0xcf,0xfe,0xd0,0x6f,
+0xa4,0x51,0x05,0x3f,0x69,0x7f,0xec,0xef,0x60,0x00,0xf5,0x4f,0xbf,0x8f,0xa0,0x00,
+0x0f,0x51,0x69,0xff,0xf9,0x61,0x00,0xf5,0x5d,0x94,0x17,0xbd,0x9f,0x03,0x11,0x0f,
+0x82,0x00,0xf0,0x00,0x50,0x55,0x5b,0xf5,0xce,0x55,0x51,0x01,0x44,0xae,0x4b,0xd4,
+0x43,0x00,0x5f,0x13,0x00,0xf2,0x06,0xe0,0x05,0xf1,0x8e,0x09,0xd0,0x9e,0x00,0x5f,
+0xef,0xfe,0xff,0xef,0xe0,0x02,0x44,0x8f,0x94,0x44,0x44,0x12,0x0b,0x01,0xf5,0x0a,
+0x03,0x3c,0xf6,0x34,0xee,0x43,0x20,0x03,0xef,0xfc,0xcf,0x40,0x00,0x03,0x46,0xaf,
+0xff,0xff,0xa5,0x00,0xaf,0xec,0x83,0x03,0x8e,0xb5,0x01,0x10,0x9f,0x19,0x05,0x00,
+0xb0,0x04,0x00,0xb7,0x04,0x52,0x9f,0x44,0x44,0x4a,0xf0,0xfc,0x09,0x05,0x0d,0x00,
+0x41,0xfe,0xee,0xee,0xff,0xd7,0x04,0x15,0x5a,0x1a,0x00,0x30,0x02,0xfa,0x0a,0xd0,
+0x02,0xf5,0x02,0xaf,0x50,0xae,0x00,0x99,0x17,0xdf,0xa0,0x09,0xf7,0x7e,0xa1,0xec,
+0x60,0x00,0x4e,0xff,0xe8,0x06,0xf4,0x3e,0x6f,0x00,0xbf,0xff,0xfe,0x00,0x59,0xf5,
+0x3b,0xc5,0x5b,0xe0,0x1f,0xff,0xfa,0xbb,0x44,0xbe,0x00,0x7b,0xf8,0x5b,0xff,0xff,
+0xe0,0x00,0x6f,0x00,0xbb,0x44,0xbe,0x04,0xef,0xfe,0xcb,0xed,0xde,0xe0,0x16,0xbf,
+0x75,0xbc,0x66,0xce,0x00,0x0b,0xfa,0x0b,0xff,0xff,0xd0,0x00,0xfc,0xf7,0x0f,0x7e,
+0x80,0x00,0x5f,0x38,0xb5,0xf3,0xe8,0x10,0x2e,0xb0,0x04,0xec,0x0e,0xbc,0x81,0xb1,
+0x00,0xec,0x10,0x9f,0xe4,0xec,0x07,0x12,0x22,0x42,0x0b,0x20,0xd0,0x0e,0x2e,0x00,
+0xf0,0x23,0x5e,0x10,0xe9,0x33,0xbd,0x06,0xff,0xff,0x3e,0x93,0x3b,0xd0,0x5c,0xcd,
+0xf3,0xef,0xee,0xfd,0x00,0x01,0xda,0x0e,0x93,0x3b,0xd0,0x00,0xbf,0x40,0xef,0xee,
+0xfd,0x02,0xdf,0xfe,0x2e,0xa4,0x4b,0xd0,0x9f,0xdf,0xd7,0xef,0xff,0xfd,0x02,0x29,
+0xe2,0x02,0xf3,0xe7,0x51,0x03,0xf4,0x01,0x8f,0x0e,0x75,0x30,0x09,0xe1,0x8f,0x80,
+0xeb,0xc9,0x00,0x9e,0x2d,0x60,0x09,0xee,0xb5,0x01,0x11,0x92,0x06,0x00,0xfc,0x3e,
+0x5f,0x30,0x09,0xff,0xff,0xf0,0x0a,0xff,0xf7,0x27,0xf5,0x8f,0x01,0xf9,0x5f,0x30,
+0x8d,0x06,0xf0,0xaf,0xcd,0xfb,0x5f,0x84,0xbd,0x04,0xfa,0xf9,0xfc,0xb0,0x9e,0x60,
+0x0e,0xbf,0xaf,0x3f,0x4f,0x60,0x00,0xeb,0xfb,0xf7,0xff,0xff,0xf1,0x0e,0x6e,0x4f,
+0xdb,0x5f,0x95,0x00,0xff,0xff,0xf6,0x86,0xfa,0x52,0x1f,0x4e,0x5f,0x9f,0xff,0xff,
+0x56,0xe0,0xe7,0xf1,0x00,0xf6,0x00,0x88,0x04,0xbb,0x00,0x0f,0x60,0x15,0x03,0x93,
+0x5f,0x40,0x00,0x00,0x03,0x33,0x34,0xfd,0x43,0xa6,0x02,0x91,0xfa,0x00,0x13,0x33,
+0x33,0x33,0x30,0x00,0x05,0x09,0x05,0x64,0x00,0x12,0x22,0x22,0x22,0x20,0x0d,0x00,
+0x72,0x01,0x11,0x11,0x11,0x10,0x00,0x07,0x6d,0x01,0x80,0x7f,0x33,0x33,0x3a,0xf0,
+0x00,0x07,0xf6,0x65,0x06,0x64,0x00,0x7f,0xed,0xdd,0xde,0xf0,0x11,0x01,0x50,0x09,
+0xc0,0x00,0x08,0xf1,0x6c,0x02,0xf0,0x00,0x00,0x8f,0x10,0x03,0xff,0xff,0xf3,0x08,
+0xf1,0x00,0x04,0x44,0x44,0x00,0x8f,0xd9,0x03,0xf0,0x05,0xa7,0x8c,0xf9,0x84,0x04,
+0x66,0x64,0xcf,0xff,0xff,0x70,0xaf,0xff,0xa0,0x08,0xf1,0x00,0x03,0x55,0x53,0x1a,
+0x00,0x91,0x9f,0xef,0xb0,0x08,0xf1,0x00,0x09,0xa0,0x9b,0x0d,0x00,0x11,0xff,0x0d,
+0x00,0x20,0xc4,0x43,0x0d,0x00,0x00,0x17,0x03,0x14,0x20,0xac,0x0a,0xd0,0x0d,0xb0,
+0x0a,0xff,0xff,0xf0,0x01,0x7d,0x11,0x47,0x77,0xcf,0x07,0xb8,0x01,0xf3,0x2e,0x09,
+0xf0,0x14,0x44,0x42,0x00,0x00,0x9f,0x00,0xdf,0xff,0x41,0x22,0x2a,0xf0,0x04,0x44,
+0x42,0x9f,0xff,0xff,0x01,0xff,0xff,0x79,0xf4,0x4b,0xf0,0x03,0x44,0x41,0x9f,0x00,
+0x00,0x00,0xef,0xff,0x49,0xf0,0x00,0x10,0x0e,0x61,0xf4,0x9f,0x00,0x0c,0x80,0xef,
+0xef,0x48,0xf9,0x89,0xf7,0x0e,0x94,0x41,0x2c,0xee,0xeb,0x10,0xbb,0x01,0xf2,0x3f,
+0x0b,0xc0,0x04,0xff,0xff,0x10,0x03,0x7d,0x42,0x5f,0x79,0xf1,0x04,0xff,0xff,0xc7,
+0xe0,0x5f,0x10,0x04,0x44,0x44,0xdb,0x04,0xf5,0x20,0xbf,0xff,0xdf,0x30,0x1e,0xf7,
+0x04,0x55,0x54,0x85,0x55,0x55,0x00,0xbf,0xff,0xaf,0xff,0xff,0xf1,0x03,0x44,0x42,
+0xcc,0x34,0xfa,0x00,0xaf,0xff,0x44,0xf6,0xaf,0x20,0x0a,0x90,0xf4,0x0a,0xff,0x80,
+0x00,0xaf,0xff,0xad,0xfd,0xff,0xd7,0x0a,0xb4,0x47,0xd5,0x01,0x9e,0x40,0x57,0x01,
+0x12,0x02,0x69,0x01,0x30,0x4f,0x10,0x9f,0xb0,0x00,0xf0,0x20,0xe4,0x04,0x77,0xfc,
+0x77,0x0b,0xff,0xff,0x10,0x0e,0x90,0x00,0x24,0x44,0x40,0x20,0xe9,0x00,0x01,0xff,
+0xf9,0x4f,0x2e,0x90,0x00,0x14,0x44,0x34,0xf2,0xef,0xfd,0x04,0xee,0xea,0x4f,0x2e,
+0xc7,0x70,0x04,0x44,0x24,0xf2,0xe9,0x00,0x02,0xff,0xfb,0x1a,0x00,0x30,0x2f,0x19,
+0xb4,0x0d,0x00,0xc4,0xf7,0xcb,0xbf,0xaf,0xd9,0x93,0x2f,0xdd,0x9d,0xdd,0xdd,0xdd,
+0x58,0x0d,0xf0,0x14,0x2d,0x10,0x00,0x0d,0x70,0x00,0x00,0xe7,0x03,0x77,0xed,0x77,
+0x19,0xde,0xdd,0xbf,0xff,0xff,0xf3,0x46,0x66,0x61,0x0d,0xa0,0x20,0x02,0xff,0xfb,
+0x07,0xf3,0x9f,0x10,0x15,0x55,0x45,0x79,0x06,0xf4,0x17,0xff,0xfb,0x16,0x8f,0x95,
+0x60,0x04,0x44,0x30,0x6f,0x92,0xf9,0x02,0xff,0xfb,0x8e,0x53,0xed,0x00,0x2f,0x17,
+0xb0,0x17,0xff,0x90,0x02,0xff,0xfd,0x8e,0xf7,0x5f,0xb0,0x2f,0x54,0x4e,0xa2,0x00,
+0x6c,0x64,0x07,0x04,0x5b,0x00,0xf0,0x05,0x1b,0x40,0x0c,0x90,0x00,0xe8,0x00,0xcd,
+0x04,0xf6,0x0a,0xde,0xdd,0x6a,0xf8,0xaf,0x71,0x56,0x66,0x6a,0xf5,0x09,0xf0,0x1a,
+0xee,0xea,0x00,0x0f,0x80,0x00,0x28,0x88,0x53,0xff,0xff,0xfb,0x02,0xbb,0xb8,0x17,
+0x7f,0xc7,0x50,0x14,0x44,0x30,0x00,0xf8,0x00,0x04,0xfe,0xfc,0x8b,0xbf,0xdb,0xb3,
+0x4f,0x08,0xc6,0x88,0xfc,0x88,0x24,0xff,0xfc,0x27,0x00,0x11,0x4f,0x1a,0x00,0x01,
+0x08,0x01,0x43,0x10,0x00,0x00,0x40,0xc6,0x02,0xf4,0x3c,0x5f,0xff,0xff,0xf1,0x00,
+0xd4,0x01,0x55,0xf8,0x9f,0x0b,0xff,0xff,0x5e,0x5f,0x37,0xf0,0x35,0x55,0x5d,0x8a,
+0xe0,0x8e,0x02,0xff,0xfa,0x45,0xf7,0x4c,0xc0,0x16,0x66,0x45,0xfb,0x0e,0xf5,0x02,
+0xff,0xfa,0x18,0x17,0x00,0x00,0x04,0x44,0x33,0x49,0xf6,0x43,0x03,0xff,0xfb,0xdc,
+0xe7,0xd8,0xc0,0x3f,0x08,0xdf,0x9e,0x01,0x9f,0x43,0xff,0xff,0xd6,0xf4,0x5f,0x94,
+0x3f,0x54,0x30,0x2f,0xff,0xb0,0x2d,0x05,0x12,0x50,0x13,0x0f,0xf0,0x30,0x60,0xaf,
+0xff,0xff,0xf0,0x12,0xc8,0x23,0x4e,0xc4,0x44,0x0c,0xff,0xff,0x54,0xeb,0x44,0x10,
+0x46,0x66,0x66,0xff,0xff,0xf3,0x03,0xff,0xfc,0x04,0xf3,0x2f,0x30,0x15,0x55,0x46,
+0xaf,0x78,0xf8,0x23,0xff,0xfc,0xdd,0xdd,0xdd,0xd5,0x15,0x55,0x52,0x88,0x88,0x85,
+0x03,0xff,0xfd,0x5f,0xdc,0xcf,0xa0,0x3f,0x17,0xd5,0xf1,0x00,0xda,0x0d,0x00,0x90,
+0xee,0xef,0xa0,0x3f,0x32,0x25,0xf7,0x66,0xea,0xb5,0x00,0x03,0x89,0x05,0x01,0x11,
+0x01,0xf0,0x15,0x1c,0x40,0x1d,0x50,0x00,0xe7,0x00,0xdc,0x07,0xf3,0x0a,0xdf,0xdd,
+0x4a,0xe7,0xde,0x40,0x46,0x66,0x66,0xfe,0xee,0xfa,0x03,0xff,0xfa,0x5f,0x00,0x0c,
+0xa0,0x15,0x55,0x45,0xf4,0x44,0xda,0x0d,0x00,0xf0,0x1b,0xff,0xff,0xa0,0x14,0x44,
+0x31,0x8f,0x6f,0x62,0x03,0xff,0xfb,0x09,0xf3,0xf3,0x00,0x3f,0x09,0xb0,0xea,0x3f,
+0x39,0x23,0xff,0xfc,0xbf,0x42,0xf8,0xf4,0x3f,0x44,0x5e,0x70,0x0d,0xfd,0x00,0x00,
+0x00,0x10,0x00,0x00,0x00,0x12,0x00,0x01,0x00,0xf8,0x40,0x2e,0x20,0x01,0x1e,0xb1,
+0x10,0x00,0xd7,0x09,0xff,0xff,0xff,0x48,0xff,0xff,0x14,0x4e,0xb4,0x40,0x26,0x66,
+0x62,0xff,0xff,0xfe,0x00,0xff,0xf9,0x25,0x55,0x55,0x51,0x07,0x77,0x4a,0xff,0xff,
+0xff,0x60,0xff,0xf9,0xa9,0x52,0x42,0xe6,0x04,0x44,0x33,0x3e,0x7d,0x85,0x20,0xff,
+0xfb,0x00,0xf6,0xd8,0x00,0x0f,0x39,0xb0,0x7f,0x2d,0x86,0x50,0xff,0xfb,0x6f,0xa0,
+0xdb,0xc8,0x0f,0x74,0x4c,0xa0,0x08,0xfe,0x30,0x00,0x01,0x00,0xf0,0x36,0x01,0xd3,
+0x00,0x00,0xb7,0x00,0x00,0x00,0xca,0x00,0x08,0xfe,0x20,0x00,0x4d,0xee,0xc1,0xaf,
+0xae,0xe3,0x00,0x16,0x66,0x9f,0xfe,0x69,0xff,0xa0,0x0d,0xff,0x9d,0xae,0xee,0xda,
+0x50,0x05,0x55,0x33,0x55,0x55,0x55,0x00,0x0d,0xff,0x88,0xff,0xff,0xff,0x10,0x04,
+0x44,0x28,0xc9,0x7e,0x5f,0x10,0x0e,0xff,0x98,0xed,0xcf,0xbf,0x10,0x0e,0x4a,0x98,
+0xec,0xbf,0xaf,0x0e,0x00,0xa0,0xc9,0x7e,0x7f,0x10,0x0e,0x84,0x28,0xc7,0x5b,0xbc,
+0x56,0x00,0x16,0x10,0x62,0x00,0xf8,0x3f,0x2d,0x10,0x0c,0x80,0xd8,0x30,0x00,0xc5,
+0x2f,0xff,0xdc,0xbf,0x12,0xff,0xfa,0xb8,0xa9,0xc9,0xc8,0x05,0x55,0x4a,0xac,0x7c,
+0xa5,0x30,0xcf,0xfb,0xff,0xff,0xff,0xfd,0x04,0x55,0x27,0x77,0x7a,0xc4,0x20,0xcf,
+0xf5,0xee,0xde,0x8d,0xc8,0x03,0x44,0x1e,0x98,0xe6,0xff,0x10,0xbf,0xf6,0xed,0xce,
+0x4f,0x90,0x0b,0x5b,0x6e,0xcc,0xe8,0xf6,0xa0,0xbf,0xf6,0xea,0x7f,0xfd,0xec,0x0b,
+0x73,0x11,0x01,0xd4,0x3f,0x50,0xbc,0x00,0xf0,0x1a,0x04,0xff,0xff,0xfe,0x2f,0x20,
+0x00,0x17,0xf8,0x99,0x5a,0xff,0xff,0x60,0xbe,0xcc,0xed,0xfe,0x4f,0x50,0x5f,0xcc,
+0x6e,0x63,0xbf,0xc0,0x00,0x8c,0xcb,0xf4,0xbf,0xcf,0xd5,0x04,0x52,0x7a,0xb8,0x20,
+0x28,0x12,0xee,0x01,0x00,0xf0,0x81,0xe4,0x00,0x6a,0xaa,0xaa,0xaa,0x80,0x00,0x07,
+0xbb,0xbb,0xbb,0xb9,0x00,0x00,0x69,0x99,0x99,0x99,0x90,0x00,0x0b,0xc4,0x44,0x44,
+0xaf,0x00,0x00,0xbe,0xcc,0xcc,0xce,0xf0,0x00,0x07,0xee,0xff,0xef,0xfe,0xf7,0x00,
+0x07,0x7b,0xf7,0xcf,0x7f,0x70,0x02,0xfa,0xcf,0x8c,0xf8,0x84,0x00,0x5f,0xce,0xfc,
+0xef,0xcc,0xc3,0x01,0x6d,0xf7,0x29,0xe3,0x8f,0x21,0xff,0xfd,0xcb,0xcd,0xdf,0x50,
+0x02,0xaf,0xaa,0xaa,0xad,0xf0,0x00,0x09,0xf7,0x77,0x77,0xbf,0x00,0x00,0x9f,0x88,
+0x88,0x8c,0xf0,0x00,0x09,0xfd,0xdd,0xdd,0xef,0x00,0x04,0x8c,0xf6,0x00,0xcf,0xa4,
+0x00,0xbc,0x71,0x00,0x00,0x3a,0xb1,0x0e,0xff,0xf8,0x00,0xe9,0x00,0x00,0xe9,0x3f,
+0x80,0x0e,0x90,0x00,0x0e,0x81,0xe8,0x00,0xea,0x33,0x10,0xef,0xff,0x80,0x0e,0xff,
+0xf6,0x0e,0x70,0xe8,0x00,0xea,0x22,0x0d,0x00,0x00,0x1a,0x00,0xf5,0x17,0x92,0xe8,
+0xcf,0xff,0xfe,0x00,0xe9,0x4f,0x8c,0xeb,0xbe,0xe0,0x0e,0xff,0xf8,0xc8,0x00,0x9e,
+0x00,0x7d,0x4d,0x2c,0x80,0x09,0xe0,0x2f,0xa0,0xcc,0xcf,0xff,0xfe,0x04,0xc1,0x02,
+0x2c,0xc6,0x6b,0xd0,0xf4,0x00,0xf6,0x3b,0x02,0xf8,0x00,0x00,0x00,0x08,0xaa,0xbf,
+0xda,0xaa,0x30,0x00,0xac,0xcd,0xfe,0xcc,0xc3,0x00,0x00,0x00,0x2f,0x80,0x00,0x00,
+0x1d,0xdd,0xde,0xff,0xdd,0xdd,0x60,0x99,0x9c,0xfa,0xcf,0xb9,0x94,0x00,0x95,0x7f,
+0x17,0xf5,0x91,0x00,0x4f,0x69,0xf0,0x7f,0x4f,0xa0,0x1e,0xd0,0xdd,0x07,0xf2,0x8f,
+0x32,0xc2,0x6f,0x70,0x7f,0x21,0xf6,0x00,0x7f,0xd0,0x8c,0xf2,0x00,0x00,0x05,0xc1,
+0x0c,0xfa,0x48,0x01,0xf3,0x3f,0x0e,0x80,0x0d,0xff,0xff,0x00,0xce,0xff,0xe7,0x45,
+0x5b,0xf0,0x05,0x6f,0xb6,0x30,0x00,0x8f,0x00,0x22,0xe9,0x21,0x22,0x29,0xf0,0x3f,
+0xff,0xff,0xcb,0xff,0xff,0x00,0x32,0xad,0x22,0xbc,0x22,0x20,0x0c,0x99,0xe6,0x4b,
+0xb0,0x07,0x30,0xd9,0x9f,0xe9,0xbc,0x22,0xd8,0x0e,0xfa,0xd0,0x08,0xff,0xff,0x40,
+0xff,0xfd,0x00,0x02,0x33,0x20,0x2f,0x9f,0xfb,0x97,0x77,0x77,0x66,0xf0,0x3a,0xef,
+0xff,0xff,0xf8,0x04,0x55,0x00,0xf2,0x3f,0x4f,0x20,0x8f,0xff,0xff,0x32,0xee,0xfe,
+0xe2,0x7f,0x68,0xf2,0x16,0x9f,0x86,0x08,0xe0,0x6f,0x11,0x26,0xf4,0x23,0xf9,0x5b,
+0xf0,0x7f,0xff,0xff,0xed,0x1c,0xfa,0x03,0x66,0xf9,0x63,0x75,0x66,0x50,0x1e,0x4f,
+0x72,0x3f,0xee,0xfe,0x01,0xf4,0xfe,0xd4,0xf3,0x09,0xe0,0x2f,0xcf,0x50,0x3f,0xfe,
+0xfe,0x04,0xff,0xf5,0x01,0x44,0x44,0x40,0x7e,0x9f,0xe9,0x87,0x77,0x78,0x59,0xa0,
+0x5b,0xef,0xff,0xff,0xf5,0x01,0x54,0x00,0xf0,0x01,0x0f,0xff,0xf7,0xff,0xff,0xff,
+0x50,0xf7,0x4f,0x7f,0xc8,0x88,0x82,0x0f,0x40,0xe7,0x0c,0x01,0xf3,0x2b,0xfb,0x9f,
+0x7f,0xb6,0x66,0x30,0x0b,0xcf,0xc5,0xff,0xff,0xf8,0x00,0x24,0xf1,0x0f,0x80,0x0e,
+0x80,0x1f,0x6f,0xc6,0xf8,0x00,0xe8,0x01,0xf6,0xfa,0x4f,0xff,0xff,0x80,0x1f,0x6f,
+0x10,0xfb,0x77,0x73,0x01,0xf9,0xfe,0x9f,0x80,0x00,0x00,0x8f,0xfc,0x82,0xff,0xff,
+0xff,0x84,0x61,0x00,0x08,0x88,0x88,0x85,0xa9,0x00,0xf0,0x17,0x06,0xf0,0x00,0x07,
+0xf0,0x00,0x5d,0xef,0xdc,0x00,0x7f,0x00,0x02,0x6a,0xf6,0x63,0x5a,0xf5,0x51,0x2f,
+0xff,0xfb,0xaf,0xff,0xff,0x42,0xf6,0xd7,0xca,0xa6,0xe1,0xf4,0x2f,0xff,0xfc,0xaa,
+0x6e,0x1f,0x0d,0x00,0xf6,0x15,0xed,0xfc,0xf4,0x2f,0xff,0xfb,0xae,0xdf,0xbf,0x42,
+0x49,0xf4,0x4a,0xa6,0xe1,0xf4,0x9f,0xff,0xff,0xca,0x6e,0x1f,0x40,0x17,0xf1,0x1a,
+0xff,0xff,0xf4,0x00,0x6f,0x00,0xac,0x55,0x6e,0x30,0x55,0x00,0xf3,0x3b,0x09,0xc0,
+0x00,0x2c,0xdf,0xca,0x44,0x9f,0x54,0x21,0x8b,0xf8,0x6f,0xff,0xff,0xf9,0x0b,0xdf,
+0xb7,0x2d,0x82,0xb7,0x10,0xf9,0xea,0xa7,0xf4,0x0a,0xf2,0x0f,0xff,0xfc,0xfc,0x30,
+0x6f,0xa0,0xf8,0xea,0xa4,0xbd,0x4f,0x80,0x0f,0xff,0xfa,0x03,0xfd,0xe0,0x00,0x28,
+0xf2,0x20,0x0c,0xf7,0x00,0x5f,0xff,0xfd,0x04,0xff,0xd1,0x00,0x27,0xf2,0x28,0xfb,
+0x5e,0xf7,0x00,0x6f,0x00,0xc6,0x00,0x1a,0xf5,0x02,0xf1,0x51,0x12,0xc8,0x4c,0xff,
+0xff,0xff,0x15,0xac,0x8d,0xda,0x27,0x46,0xf1,0x3d,0xc9,0xf3,0x54,0xf8,0x45,0x01,
+0xfd,0xdc,0x6f,0xff,0xff,0xb0,0x4a,0xec,0xa7,0x78,0xfa,0x75,0x05,0xee,0xfd,0xbf,
+0x6f,0x9b,0xb0,0x0c,0x7d,0x74,0xfe,0xfe,0xfb,0x00,0xd6,0xd7,0x4f,0x7f,0xac,0xb0,
+0x0e,0x5e,0xa4,0x77,0xfa,0x75,0x02,0xf6,0xff,0xff,0xff,0xff,0xf2,0x8e,0x09,0x15,
+0x56,0xf9,0x55,0x13,0x60,0x00,0x00,0x0f,0x50,0x00,0x0a,0x60,0x00,0x92,0x00,0x00,
+0x00,0x9f,0x60,0x1e,0xe1,0x00,0x00,0x00,0xa7,0x00,0x2f,0x90,0x65,0x00,0xf6,0x28,
+0xff,0x10,0x00,0x01,0x11,0x00,0x3f,0xf7,0x00,0x06,0xff,0x90,0x09,0xfc,0xd0,0x00,
+0x24,0xf9,0x02,0xf9,0x4f,0x50,0x00,0x0e,0x90,0xcf,0x20,0xee,0x30,0x00,0xe9,0xcf,
+0x50,0x04,0xff,0x20,0x4f,0xb4,0x60,0x00,0x04,0x90,0x5f,0xac,0xe9,0x76,0x67,0x79,
+0x52,0xb0,0x06,0xce,0xff,0xff,0xe3,0x4d,0x02,0xf0,0x1d,0x03,0x20,0x00,0x00,0x93,
+0x00,0x00,0xfb,0x00,0x00,0x1d,0xf3,0x2f,0xff,0xff,0xf1,0x00,0x1d,0x52,0xf8,0x44,
+0x9f,0x10,0x00,0x00,0x2f,0xa7,0x7b,0xf1,0x05,0x88,0x42,0xfe,0xdd,0xdd,0x10,0x9f,
+0xf8,0x2f,0x73,0x33,0x31,0x00,0x0e,0x8d,0x01,0xf9,0x13,0x80,0x00,0xe8,0x2f,0x50,
+0x00,0xf8,0x00,0x0e,0x82,0xf8,0x55,0x5f,0x80,0x00,0xe9,0x2e,0xee,0xee,0xe8,0x03,
+0xde,0xea,0x65,0x44,0x56,0x74,0x3d,0x11,0x9e,0xff,0xff,0xff,0x40,0xb0,0x04,0xf0,
+0x14,0xb9,0x00,0x6e,0x10,0x4f,0x40,0x07,0xf5,0x01,0xf7,0x0c,0xd0,0x00,0x0c,0x85,
+0xff,0xff,0xff,0xe0,0x00,0x00,0x27,0x7c,0xf7,0x76,0x05,0xcc,0x60,0x00,0xaf,0x00,
+0x00,0x4a,0xf7,0xdf,0x23,0x02,0xf0,0x14,0x0f,0x75,0x66,0xff,0xb6,0x62,0x00,0xf7,
+0x00,0x7f,0xdf,0x60,0x00,0x0f,0x71,0x9f,0xa0,0xaf,0x70,0x06,0xfa,0x7f,0x80,0x00,
+0xa7,0x09,0xfb,0xfe,0xb8,0x77,0x79,0xa7,0x5a,0x01,0x8e,0x27,0x00,0x09,0x0a,0x05,
+0xf0,0x13,0xb3,0x03,0xff,0xff,0xff,0xa0,0x1c,0xf4,0x03,0xb8,0x5e,0xd2,0x00,0x1d,
+0xb0,0x18,0xff,0xe1,0x00,0x00,0x20,0x5f,0xff,0xff,0xff,0x00,0x11,0x05,0xf5,0x8f,
+0x49,0xf0,0x8f,0xf8,0x0d,0x00,0x91,0x03,0x5f,0x85,0xf5,0x8f,0x39,0xf0,0x00,0xe8,
+0x1a,0x00,0xf6,0x07,0x0e,0x85,0xf2,0x6f,0x19,0xf0,0x02,0xfa,0x5f,0x25,0xf6,0xfb,
+0x05,0xfb,0xdd,0x75,0x44,0x56,0x74,0x3c,0x00,0x7d,0xb6,0x00,0xf0,0x07,0x05,0x00,
+0x00,0x09,0xe0,0x00,0x02,0xfd,0x1c,0xee,0xff,0xee,0xe4,0x03,0xf7,0x55,0x5b,0xf5,
+0x55,0x10,0x02,0x07,0xb6,0x00,0xf3,0x25,0x35,0x53,0x8f,0x3a,0xf3,0xbe,0x08,0xff,
+0x88,0xf5,0xbf,0x5b,0xe0,0x24,0xf8,0x6d,0xef,0xfe,0xdc,0x00,0x0e,0x80,0x2e,0xff,
+0xf8,0x00,0x00,0xe9,0x9f,0xb9,0xe4,0xed,0x10,0x2f,0xb8,0x60,0x9e,0x01,0x60,0x5f,
+0xdd,0xea,0x66,0x56,0x68,0x64,0xc0,0x06,0xbe,0xff,0xff,0xe5,0xaa,0x00,0x30,0x07,
+0x30,0x7f,0x8a,0x05,0x90,0xbf,0x67,0xe1,0x11,0x17,0xf1,0x00,0xaa,0x8f,0x0d,0x00,
+0xf7,0x28,0x00,0x08,0xe5,0xe2,0x3f,0x50,0x3a,0xa6,0x8e,0xaf,0xcc,0xfa,0x04,0xcf,
+0x99,0xc6,0x6e,0xc6,0x60,0x00,0xf9,0xcb,0xdf,0xff,0xfb,0x00,0x0f,0xaf,0xa6,0x6e,
+0xc6,0x61,0x00,0xfe,0xf9,0xbb,0xfe,0xbb,0x30,0x2f,0xd9,0x00,0x0c,0xa0,0x00,0x4f,
+0xdd,0xfa,0x76,0x77,0x8a,0x52,0xd1,0x06,0xcf,0xbb,0x01,0x02,0xb3,0x05,0x30,0xcc,
+0x00,0x6f,0xe5,0x05,0xf1,0x34,0xfa,0x06,0xe2,0x26,0xf1,0x00,0x07,0x60,0x6f,0xed,
+0x4f,0x10,0x00,0x00,0x06,0xe3,0xe4,0xf1,0x06,0xdd,0x66,0xdf,0xdf,0xdf,0xc0,0x4a,
+0xf7,0x7f,0x77,0x77,0xaf,0x00,0x0f,0x77,0xf5,0xff,0xe5,0xf0,0x00,0xf7,0x7f,0x6b,
+0x4e,0x5f,0x00,0x0f,0x77,0xf6,0xfe,0xe7,0xf0,0x07,0xf9,0x8f,0x23,0x03,0xfb,0x08,
+0xfa,0xfd,0x86,0x66,0x78,0xaa,0x59,0x02,0x9e,0xdc,0x01,0x26,0x00,0x00,0x0a,0x06,
+0x90,0x72,0x01,0x11,0xd9,0x11,0x10,0x2e,0xe2,0xff,0x7a,0x01,0x90,0x2f,0x61,0x5f,
+0x31,0xe9,0x10,0x00,0x10,0xaf,0x46,0x01,0xf9,0x24,0x00,0x0a,0xc4,0x9c,0x47,0xf0,
+0x7f,0xf7,0xab,0xbd,0xec,0x8f,0x03,0x7f,0x7a,0xb4,0xbd,0x75,0xf0,0x00,0xf7,0xab,
+0x9a,0x7e,0x5f,0x00,0x0f,0x7a,0xb9,0xee,0xe9,0xf0,0x05,0xfa,0x9a,0x22,0x05,0xea,
+0x04,0xf9,0xde,0x96,0x55,0x67,0xa7,0x2b,0x00,0x7c,0xef,0xff,0xfe,0xbb,0x01,0xf0,
+0x01,0x02,0xd5,0x0c,0xff,0xbd,0xff,0xf0,0x0c,0xf3,0xc9,0x8b,0xd8,0x6f,0x00,0x2f,
+0x9c,0x0d,0x00,0xf6,0x29,0x00,0x40,0xba,0x49,0xd9,0x49,0x31,0x33,0x15,0xcf,0xb9,
+0xfd,0xa1,0x5f,0xf8,0x8d,0xfe,0xef,0xdb,0x01,0x2f,0x82,0x5f,0x89,0xf5,0x30,0x00,
+0xf9,0xee,0xff,0xff,0xee,0x40,0x0f,0x83,0x9f,0x88,0xf8,0x31,0x00,0xfc,0x9f,0xa0,
+0x08,0xf9,0x03,0xde,0xbf,0xd6,0x44,0x49,0x74,0x2e,0x20,0x3a,0xef,0x71,0x02,0x21,
+0x05,0x60,0x07,0x00,0xf0,0x5a,0xae,0x00,0x0d,0xff,0xf3,0x06,0x6b,0xf8,0x62,0xda,
+0x7f,0xa0,0xdf,0xff,0xff,0x5d,0x75,0xf4,0x00,0xe6,0x0d,0xb0,0xd7,0x9e,0x00,0x1c,
+0xb4,0xf6,0x1d,0x7e,0x80,0x3f,0xff,0xff,0xfa,0xd8,0xda,0x00,0x22,0x22,0x22,0x1d,
+0x74,0xf3,0x09,0xff,0xff,0xf2,0xd7,0x0e,0x70,0x9e,0x66,0xaf,0x2d,0x94,0xf7,0x09,
+0xd0,0x05,0xf2,0xda,0xff,0x20,0x9f,0xff,0xff,0x2d,0x73,0x00,0x09,0xe6,0x69,0xe2,
+0xd7,0x00,0x00,0x00,0x8f,0xcc,0xcc,0xce,0xe0,0x00,0x08,0xf9,0x99,0x99,0xde,0x00,
+0x00,0x8f,0x88,0x88,0x8d,0xe0,0x00,0x04,0x88,0x88,0x88,0x88,0x00,0x2f,0xff,0x01,
+0x00,0x20,0x90,0x17,0x0d,0x00,0xf0,0x07,0x30,0x00,0xbd,0x78,0xfb,0x7a,0xf3,0x00,
+0x0b,0xeb,0xbf,0xdb,0xcf,0x30,0x00,0x8b,0xaa,0xfc,0xaa,0xb2,0x00,0x0f,0x20,0x00,
+0x81,0x70,0x02,0x22,0x23,0xf8,0x22,0x22,0x12,0x2d,0x00,0x31,0xfa,0x00,0x22,0xa2,
+0x00,0xf0,0x3c,0x0c,0xe0,0x1f,0xff,0xff,0x80,0x08,0xfe,0xe3,0x44,0x44,0xe8,0x06,
+0xf7,0x2d,0x9b,0xdd,0xdf,0x80,0x6f,0xff,0xc1,0x56,0x66,0xe8,0x00,0x3b,0xc4,0x6d,
+0xdd,0xdf,0xe3,0x15,0xbc,0x57,0xdd,0xfe,0xdd,0x44,0xff,0xff,0x59,0x0e,0x72,0x80,
+0x06,0x9a,0x83,0xd8,0xeb,0xea,0x00,0xf9,0xbf,0x04,0xcf,0xfb,0x00,0x08,0xad,0xc8,
+0xfa,0xfb,0xfb,0x24,0xef,0xfc,0x96,0x5f,0x73,0xc3,0x27,0x40,0x00,0x0d,0x0e,0x02,
+0x00,0x69,0x00,0xf2,0x14,0xf0,0x00,0x00,0xfa,0x33,0x33,0x33,0x00,0x00,0x0f,0xb5,
+0x55,0x55,0x30,0x00,0x00,0xfe,0xdd,0xdd,0xd8,0x00,0x00,0x0f,0xc9,0x99,0x99,0x60,
+0x00,0x00,0xfb,0x66,0x66,0x64,0x00,0x1f,0xb0,0x00,0xf3,0x11,0x69,0xf8,0x6e,0xe6,
+0x7e,0xa4,0x00,0x4f,0x30,0x5f,0x9d,0xf7,0x00,0x04,0xf3,0x14,0x9f,0xf3,0x00,0x00,
+0xbf,0xef,0xe0,0x7f,0xfb,0x60,0x08,0xc8,0x41,0x00,0x28,0xd3,0x4c,0x01,0xc2,0xff,
+0xff,0xf2,0xff,0xff,0xf0,0xfa,0x38,0xf2,0xf8,0x39,0xf0,0x0c,0x00,0x54,0xf9,0x27,
+0xf2,0xf7,0x19,0x0c,0x00,0xf0,0x1d,0x35,0x54,0x55,0x49,0xf0,0xf8,0x9f,0xff,0xff,
+0x98,0xf0,0xf8,0x08,0xd0,0xf7,0x08,0xf0,0xf8,0xdf,0xff,0xff,0xd8,0xf0,0xf8,0x2b,
+0xb3,0xf8,0x28,0xf0,0xf8,0x3f,0x50,0xe7,0x8d,0xf0,0xf8,0x79,0x00,0xe6,0xde,0x70,
+0xff,0xff,0xf1,0x48,0x00,0x20,0x17,0xf1,0x3c,0x00,0xb3,0xef,0xf1,0xff,0xef,0xf0,
+0xfa,0x38,0xf1,0xf8,0x29,0xf0,0x18,0x00,0xf5,0x01,0x12,0x20,0x22,0x29,0xf0,0xf9,
+0x0f,0xff,0xff,0x08,0xf0,0xf9,0x0f,0x83,0x9f,0x08,0x0c,0x00,0x13,0x82,0x0c,0x00,
+0x80,0x8d,0xf0,0xf9,0x09,0x30,0x03,0xfe,0x70,0x94,0x00,0xf0,0x11,0x73,0x00,0x01,
+0xff,0xfb,0x00,0x7f,0x90,0x00,0x1f,0x8e,0xa0,0x3f,0xbf,0x80,0x01,0xf3,0xf6,0x6f,
+0xb0,0x8f,0x90,0x1f,0x6f,0x7f,0xd2,0x11,0xbf,0x81,0xf8,0xf0,0x8f,0x3d,0x06,0xfb,
+0x1d,0x4e,0x60,0x33,0xf9,0x30,0x01,0xf3,0xab,0xaa,0xaf,0xda,0xa4,0x1f,0x5c,0xcb,
+0xbb,0xfd,0xbb,0x41,0xfc,0xf6,0x4b,0x0f,0x8a,0x50,0x1f,0x41,0x0d,0xa0,0xf7,0x8f,
+0x21,0xf3,0x07,0xe4,0x6f,0x70,0xd7,0x1f,0x30,0x01,0x3f,0xd2,0x00,0x01,0x00,0xf0,
+0x06,0xcb,0x09,0xc0,0x00,0x00,0x00,0x7f,0xeb,0xef,0xcb,0xb8,0x00,0x7f,0xe7,0x7c,
+0xe7,0x77,0x40,0x3f,0xff,0xff,0x11,0x05,0xe0,0x3b,0xe7,0x7d,0xe7,0x77,0x00,0x00,
+0xbe,0x77,0xde,0x77,0x70,0x00,0x0b,0x14,0x00,0x81,0xf0,0x01,0x78,0x46,0xf8,0x44,
+0x44,0x01,0x53,0x01,0xf0,0x57,0xf8,0x02,0x28,0xff,0xff,0xfa,0x32,0x13,0xae,0xf9,
+0x3f,0x57,0xff,0xb5,0x0c,0x82,0x02,0xf5,0x00,0x6b,0x20,0x00,0x0b,0x30,0x00,0x95,
+0x70,0x04,0xdd,0xfe,0xdc,0x3f,0x4f,0x40,0x29,0x87,0x99,0x79,0xf6,0xb7,0x20,0xc9,
+0xec,0xd9,0xff,0xff,0xf6,0x0c,0xaa,0xbd,0xdf,0xc3,0xf4,0x00,0xcf,0xff,0xf7,0xbf,
+0xff,0xf4,0x03,0x3b,0xa3,0x28,0xd5,0xf5,0x12,0xff,0xff,0xfc,0x8d,0x6f,0x71,0x2f,
+0x6e,0x87,0xc8,0xff,0xff,0x42,0xfc,0xee,0xac,0x8c,0x2f,0x20,0x2f,0x43,0x5b,0xc8,
+0xff,0xff,0x82,0xf0,0x05,0xc6,0x8d,0x77,0x73,0x04,0xff,0xff,0xb2,0x06,0xf0,0x10,
+0x57,0x77,0xbf,0x77,0x77,0x51,0x2f,0xdd,0xde,0xfd,0xdd,0xef,0x32,0xf6,0xaa,0x8f,
+0x5a,0xa5,0xf3,0x2b,0x45,0x57,0xf3,0x55,0x4b,0x20,0x05,0x99,0x6b,0x49,0x95,0xb6,
+0x01,0x00,0x0a,0x02,0x30,0x0f,0xa7,0xbf,0xea,0x08,0x52,0xfb,0x8c,0xf8,0x8c,0xf0,
+0x86,0x02,0xe1,0x52,0x00,0xc6,0x18,0xf6,0x44,0x5d,0x80,0x00,0x00,0x2d,0xff,0xff,
+0xd2,0x4e,0x00,0xf2,0x06,0xfc,0x00,0x02,0x22,0x4f,0x82,0x22,0x10,0x00,0xad,0xdd,
+0xfe,0xdd,0xd2,0x00,0x04,0x55,0x6f,0x95,0x55,0x10,0x24,0x02,0x70,0x60,0x34,0x55,
+0x55,0x55,0x55,0x31,0x59,0x04,0xf0,0x02,0xff,0xd0,0x00,0x06,0xf9,0x77,0x77,0xdd,
+0x00,0x00,0x6f,0x87,0x77,0x7d,0xd0,0x00,0x06,0x01,0x0a,0xf0,0x10,0x00,0x00,0x6f,
+0x20,0x03,0x4d,0xc0,0x00,0x06,0xf2,0x00,0x6e,0xd6,0x00,0x00,0x00,0xbe,0x0a,0xf0,
+0x00,0x00,0x77,0x7d,0xe0,0xaf,0x77,0x72,0x0f,0xff,0xfe,0x0a,0xa7,0x05,0xf0,0x0a,
+0x0b,0xe0,0xaf,0x00,0x00,0x04,0x44,0xce,0x0a,0xf4,0x44,0x00,0xdf,0xff,0xe0,0xaf,
+0xff,0xf1,0x02,0x22,0xce,0x0a,0xf2,0x22,0x00,0x1a,0x00,0x31,0x11,0x11,0x4f,0x27,
+0x00,0x10,0x92,0x34,0x00,0x23,0x66,0x63,0x41,0x00,0x02,0x34,0x00,0x03,0x01,0x00,
+0x03,0xad,0x02,0xe1,0x77,0x77,0xaf,0xa7,0x77,0x74,0x01,0x11,0x18,0xf3,0x11,0x11,
+0x00,0x9f,0xde,0x00,0xf8,0x09,0x09,0xfa,0xed,0xac,0xfa,0xdf,0x00,0x9e,0x0b,0xb3,
 0x8f,0x09,0xf0,0x09,0xe0,0xbf,0xff,0xf0,0x9f,0x00,0x9e,0x0b,0xa1,0x6f,0x0d,0x00,
-0x33,0x7f,0x09,0xf0,0x4d,0x1a,0x12,0x9f,0x02,0x20,0xf1,0x3a,0x4f,0x20,0x02,0xbb,
-0x22,0x02,0xff,0xff,0xf4,0xff,0xff,0xf0,0x16,0x9f,0x86,0x45,0xfa,0x8f,0x40,0xde,
-0xfe,0xc8,0xcc,0xcc,0xc9,0x0e,0xa6,0xbd,0x0d,0xdd,0xdd,0x30,0xef,0xff,0xd0,0xf8,
-0x25,0xf4,0x0e,0x94,0xad,0x0f,0xec,0xdf,0x40,0xef,0xff,0xd2,0x88,0xcf,0x85,0x15,
-0x8f,0x75,0x7e,0xde,0xfd,0xc4,0xff,0xff,0xf2,0xe8,0xaf,0x32,0x00,0x4f,0x30,0x0f,
-0xff,0xff,0xa0,0x04,0xf3,0x81,0x2a,0x05,0x96,0x2f,0x15,0x80,0xa9,0x16,0x60,0x26,
-0xbe,0x66,0x6a,0xe8,0x60,0x82,0x2e,0x33,0xbf,0x10,0x01,0x75,0x16,0x01,0xbf,0x20,
-0xf2,0x00,0x30,0x06,0xdd,0xdd,0xdd,0xdd,0x10,0x00,0x7f,0x54,0x44,0x4b,0xf1,0x00,
-0x07,0x4a,0x2d,0x20,0x7f,0x44,0x1d,0x3d,0x00,0xba,0x1b,0x20,0xbf,0x10,0xc5,0x23,
-0x15,0xef,0x6a,0x42,0xf0,0x11,0xf3,0x04,0xea,0xff,0xff,0xf6,0x0f,0x5c,0x5e,0x35,
-0xaf,0x55,0x20,0xf5,0xf5,0xe4,0xce,0xfc,0xc0,0x0f,0x5f,0x5e,0x5f,0x65,0xaf,0x00,
-0xf5,0xf5,0xe5,0xfc,0xcd,0xf0,0x0d,0x00,0x20,0x54,0x9f,0x0d,0x00,0xb1,0xfd,0xde,
-0xf0,0x1f,0x4f,0x5e,0x5f,0x44,0x9f,0x02,0xf3,0x0d,0x00,0xf5,0x05,0x6e,0x2f,0x5e,
-0x19,0x85,0xa6,0x0a,0x90,0x15,0xf9,0xf9,0x1c,0xe4,0x13,0x00,0x13,0x74,0x00,0x08,
-0x20,0x70,0x11,0x10,0xd7,0xfa,0x2a,0xf0,0x07,0xc2,0x9d,0x01,0x4f,0x31,0x00,0x9f,
-0xef,0xd0,0xef,0xfe,0xe2,0x09,0xc5,0xad,0x0f,0x84,0x7f,0x20,0x8d,0xdd,0xc0,0x63,
-0x37,0xf0,0x1a,0x33,0x33,0x2f,0x84,0x7f,0x22,0xdd,0xfe,0xd9,0xfd,0xcd,0xf2,0x06,
-0x5d,0x72,0x0f,0xca,0xbf,0x20,0xb8,0xdf,0xf2,0x8b,0x6c,0x90,0x0d,0xee,0x50,0x8f,
-0xa0,0x7f,0x53,0xfa,0xfa,0x59,0xa3,0x33,0x96,0x4b,0x05,0xbe,0x94,0x01,0x19,0x10,
-0x78,0x13,0x00,0xf6,0x40,0x10,0xe1,0xe5,0x37,0xf0,0x0e,0xcf,0xf6,0x00,0x02,0x8c,
-0x6a,0x08,0xff,0xe3,0x0d,0xff,0xcc,0xf0,0x4f,0x7b,0x10,0x4a,0xf0,0x8f,0x00,0xdd,
-0x7a,0x17,0xbf,0x7b,0xf7,0x78,0xcf,0x82,0x11,0x01,0x80,0xd2,0xa2,0x00,0xac,0x08,
-0xf0,0x8f,0xea,0x22,0x4e,0xf2,0x05,0x06,0xfd,0xf5,0x03,0xf6,0x08,0xf0,0x3f,0x64,
-0x11,0xde,0x00,0x8f,0x00,0xdd,0x6c,0x1d,0x40,0x08,0xf0,0x35,0x70,0x08,0x04,0x6b,
-0x00,0xc0,0x10,0x80,0x3c,0xcc,0xcd,0xfe,0xcc,0xcc,0x22,0x78,0x66,0x05,0x32,0x71,
-0x00,0x8f,0xf1,0x1d,0x53,0xf5,0x55,0x55,0xfa,0x00,0x5a,0x2f,0x10,0xde,0x2c,0x0c,
-0xf1,0x05,0xd0,0x0e,0xb6,0x77,0x77,0x75,0xce,0x00,0xe9,0x6f,0xff,0xff,0x3a,0xe0,
-0x0e,0x96,0xf3,0x24,0xf3,0xae,0x0d,0x00,0x88,0x6b,0xe0,0x0e,0x93,0x70,0x00,0x0d,
-0xd7,0x33,0x07,0x70,0x16,0xaf,0xf0,0x00,0x00,0x03,0x7c,0x2a,0x03,0x22,0x06,0xef,
-0x4d,0x49,0x40,0xff,0xff,0xfe,0xac,0x07,0x00,0x41,0xd8,0x30,0x09,0xf0,0x13,0x68,
-0x00,0x07,0x00,0x1b,0xe0,0x07,0x00,0xf0,0x03,0x3d,0xff,0xf0,0x03,0x6c,0xe0,0x00,
-0xcf,0xff,0xf0,0xaf,0xff,0xe0,0x00,0x5f,0xff,0x80,0xdf,0x77,0x7b,0x41,0x21,0x00,
-0x2a,0xda,0xb3,0x00,0xf0,0x2d,0x80,0x9c,0xcc,0xcc,0xcc,0x40,0x8f,0xdf,0xb7,0x77,
-0x77,0xfe,0xdf,0xd0,0xc7,0x00,0x00,0x0d,0x50,0xde,0x8e,0x70,0x00,0x00,0xdb,0x8e,
-0xe5,0xdb,0x77,0x77,0x7f,0x95,0xed,0x1c,0xeb,0xbb,0xbb,0xf6,0x1d,0xfc,0xf7,0x00,
-0x00,0x0d,0xdc,0xfd,0x0c,0x70,0x00,0x00,0xd5,0x0d,0xfa,0xe9,0x33,0x33,0x3e,0xca,
-0xfc,0x3d,0x30,0x02,0xb1,0x3c,0x35,0x52,0x05,0x55,0x55,0x55,0x3f,0xff,0xc6,0xff,
-0xa0,0x03,0x10,0x6f,0x05,0x00,0xcf,0xee,0x94,0xee,0xee,0xee,0xec,0x34,0x42,0x04,
-0x44,0x44,0x44,0x1a,0x00,0x14,0x32,0xfd,0xff,0xa4,0xa5,0x03,0x00,0x44,0x8a,0x11,
-0x10,0x8e,0x0e,0x21,0xfc,0x00,0x9c,0x79,0x21,0x90,0x50,0x06,0x00,0x20,0xaf,0xc0,
-0x06,0x00,0xa0,0x0c,0xff,0xc0,0x2e,0xff,0x90,0x00,0x1c,0xff,0xce,0xbc,0x24,0x12,
-0x1c,0x88,0x3e,0x12,0x1c,0x8e,0x3e,0x13,0x0b,0xfc,0x2e,0x00,0xbb,0x65,0xf0,0x06,
-0x06,0xf8,0xdf,0xf5,0x06,0xff,0xc2,0xef,0xf9,0xff,0xd1,0x02,0xef,0xff,0xd1,0x00,
-0x08,0xff,0xf7,0x00,0x06,0x71,0x35,0xf1,0x02,0xff,0xe4,0xef,0xf5,0xef,0xe1,0x02,
-0xef,0xd4,0xa1,0x00,0x02,0xb4,0x00,0x00,0x02,0x50,0xbd,0x01,0xf0,0x1e,0xbf,0x40,
-0x30,0x00,0x01,0xcf,0x1b,0xf4,0x7f,0x80,0x00,0xbf,0xd0,0xbf,0x45,0xff,0x40,0x4f,
-0xe1,0x0b,0xf4,0x07,0xfd,0x09,0xf8,0x00,0xbf,0x40,0x0e,0xf2,0xcf,0x40,0x0b,0xf4,
-0x00,0xbf,0x4b,0xf4,0x00,0x9e,0x30,0x0b,0xf4,0x9f,0x80,0x68,0x06,0x30,0x23,0xff,
-0x20,0x7b,0x44,0xa0,0x0a,0xfe,0x40,0x01,0x8f,0xf4,0x00,0x0c,0xff,0xed,0x43,0x3a,
-0x41,0x07,0xef,0xff,0xc3,0x42,0x0b,0x12,0x10,0x3f,0x6e,0x02,0x93,0x06,0x10,0xf3,
+0x41,0x7f,0x09,0xf0,0x09,0x41,0x00,0xf6,0x45,0x00,0x9f,0x77,0x77,0x77,0x7c,0xf0,
+0x00,0x4f,0x20,0x02,0xbb,0x22,0x02,0xff,0xff,0xf4,0xff,0xff,0xf0,0x16,0x9f,0x86,
+0x45,0xfa,0x8f,0x40,0xde,0xfe,0xc8,0xcc,0xcc,0xc9,0x0e,0xa6,0xbd,0x0d,0xdd,0xdd,
+0x30,0xef,0xff,0xd0,0xf8,0x25,0xf4,0x0e,0x94,0xad,0x0f,0xec,0xdf,0x40,0xef,0xff,
+0xd2,0x88,0xcf,0x85,0x15,0x8f,0x75,0x7e,0xde,0xfd,0xc4,0xff,0xff,0xf2,0xe8,0xaf,
+0x32,0x00,0x4f,0x30,0x0f,0xff,0xff,0xa0,0x04,0xf3,0x00,0x00,0x8e,0x31,0x02,0x70,
+0x3f,0x80,0x00,0x00,0x05,0xff,0xff,0xd7,0x0b,0xc3,0x26,0xbe,0x66,0x6a,0xe8,0x60,
+0x00,0x07,0xf3,0x00,0xbf,0x10,0x16,0x02,0x20,0x06,0x66,0x01,0x00,0xf4,0x18,0x30,
+0x06,0xdd,0xdd,0xdd,0xdd,0x10,0x00,0x7f,0x54,0x44,0x4b,0xf1,0x00,0x07,0xfe,0xee,
+0xee,0xff,0x10,0x00,0x7f,0x44,0x44,0x4a,0xf1,0x00,0x07,0xf6,0x55,0x55,0xbf,0x10,
+0x00,0x7f,0xee,0xee,0xef,0xf1,0x53,0x00,0xf0,0x11,0xf3,0x04,0xea,0xff,0xff,0xf6,
+0x0f,0x5c,0x5e,0x35,0xaf,0x55,0x20,0xf5,0xf5,0xe4,0xce,0xfc,0xc0,0x0f,0x5f,0x5e,
+0x5f,0x65,0xaf,0x00,0xf5,0xf5,0xe5,0xfc,0xcd,0xf0,0x0d,0x00,0x20,0x54,0x9f,0x0d,
+0x00,0xb1,0xfd,0xde,0xf0,0x1f,0x4f,0x5e,0x5f,0x44,0x9f,0x02,0xf3,0x0d,0x00,0xf3,
+0x05,0x6e,0x2f,0x5e,0x19,0x85,0xa6,0x0a,0x90,0x15,0xf9,0xf9,0x1c,0xe4,0x13,0x00,
+0x13,0x74,0x00,0x08,0x20,0x55,0x00,0xf0,0x3b,0x9f,0xff,0xd7,0xff,0xff,0xf8,0x09,
+0xc2,0x9d,0x01,0x4f,0x31,0x00,0x9f,0xef,0xd0,0xef,0xfe,0xe2,0x09,0xc5,0xad,0x0f,
+0x84,0x7f,0x20,0x8d,0xdd,0xc0,0xff,0xff,0xf2,0x03,0x33,0x33,0x2f,0x84,0x7f,0x22,
+0xdd,0xfe,0xd9,0xfd,0xcd,0xf2,0x06,0x5d,0x72,0x0f,0xca,0xbf,0x20,0xb8,0xdf,0xf2,
+0x8b,0x6c,0x90,0x0d,0xee,0x50,0x8f,0xa0,0x7f,0x53,0xfa,0xfa,0x59,0xa3,0x33,0x96,
+0x4b,0x05,0xbe,0x94,0x01,0x18,0x10,0x34,0x03,0x00,0xcb,0x06,0xf0,0x14,0x98,0xe1,
+0x03,0x55,0x55,0x55,0xcf,0xf6,0x00,0x02,0x8c,0x6a,0x08,0xff,0xe3,0x0d,0xff,0xcc,
+0xf0,0x4f,0x7b,0x10,0x4a,0xf0,0x8f,0x00,0xdd,0x7a,0x17,0xbf,0x7b,0xf7,0x78,0xcf,
+0x82,0x11,0x01,0xf2,0x13,0xd2,0xa2,0x00,0xac,0x08,0xf0,0x8f,0xea,0x00,0x0e,0x90,
+0x8f,0x06,0xfd,0xf5,0x03,0xf6,0x08,0xf0,0x3f,0x64,0x11,0xde,0x00,0x8f,0x00,0xdd,
+0x6c,0x1d,0x40,0x08,0xf0,0x02,0xdf,0xd1,0x08,0x15,0x20,0x5d,0x00,0xc0,0x5f,0x40,
+0x00,0x00,0x3c,0xcc,0xcd,0xfe,0xcc,0xcc,0x22,0x78,0x66,0x05,0x11,0x71,0x6f,0x00,
+0xb0,0xa0,0x00,0x08,0xf5,0x55,0x55,0xfa,0x00,0x00,0x59,0x99,0xdd,0x04,0x10,0xde,
+0x2c,0x0c,0xf1,0x05,0xd0,0x0e,0xb6,0x77,0x77,0x75,0xce,0x00,0xe9,0x6f,0xff,0xff,
+0x3a,0xe0,0x0e,0x96,0xf3,0x24,0xf3,0xae,0x0d,0x00,0x88,0x6b,0xe0,0x0e,0x93,0x70,
+0x00,0x0d,0xd7,0x33,0x07,0x70,0x16,0xaf,0xf0,0x00,0x00,0x03,0x7c,0x2a,0x03,0x20,
+0x06,0xef,0x31,0x03,0x00,0xd4,0x03,0x20,0xfe,0xac,0x07,0x00,0x90,0xd8,0x30,0x09,
+0xf0,0x00,0x0b,0xf1,0x00,0x00,0x07,0x00,0x1b,0xe0,0x07,0x00,0xf1,0x0b,0x3d,0xff,
+0xf0,0x03,0x6c,0xe0,0x00,0xcf,0xff,0xf0,0xaf,0xff,0xe0,0x00,0x5f,0xff,0x80,0xdf,
+0xff,0xd0,0x00,0x00,0x21,0x00,0x2a,0xda,0xb3,0x00,0xf0,0x2d,0x80,0x9c,0xcc,0xcc,
+0xcc,0x40,0x8f,0xdf,0xb7,0x77,0x77,0xfe,0xdf,0xd0,0xc7,0x00,0x00,0x0d,0x50,0xde,
+0x8e,0x70,0x00,0x00,0xdb,0x8e,0xe5,0xdb,0x77,0x77,0x7f,0x95,0xed,0x1c,0xeb,0xbb,
+0xbb,0xf6,0x1d,0xfc,0xf7,0x00,0x00,0x0d,0xdc,0xfd,0x0c,0x70,0x00,0x00,0xd5,0x0d,
+0xfa,0xe9,0x33,0x33,0x3e,0xca,0xfc,0x3d,0x30,0x02,0xb1,0x3c,0x35,0x52,0x05,0x55,
+0x55,0x55,0x3f,0xff,0xc6,0xff,0xa0,0x03,0x10,0x6f,0x05,0x00,0xcf,0xee,0x94,0xee,
+0xee,0xee,0xec,0x34,0x42,0x04,0x44,0x44,0x44,0x1a,0x00,0x14,0x31,0xfd,0xff,0xa4,
+0xa5,0x03,0x00,0x01,0x00,0x21,0x29,0x10,0x8e,0x0e,0x11,0xfc,0x06,0x00,0x31,0xff,
+0x90,0x50,0x06,0x00,0x20,0xaf,0xc0,0x06,0x00,0xf0,0x04,0x0c,0xff,0xc0,0x2e,0xff,
+0x90,0x00,0x1c,0xff,0xce,0xff,0x90,0x00,0x00,0x1c,0xff,0xff,0x90,0x00,0x07,0x00,
+0x01,0x84,0x01,0x23,0x0b,0x90,0x30,0x01,0xf0,0x07,0x09,0xf5,0x00,0x06,0xf8,0xdf,
+0xf5,0x06,0xff,0xc2,0xef,0xf9,0xff,0xd1,0x02,0xef,0xff,0xd1,0x00,0x08,0xff,0xf7,
+0x06,0x04,0xf1,0x04,0xf5,0x06,0xff,0xe4,0xef,0xf5,0xef,0xe1,0x02,0xef,0xd4,0xa1,
+0x00,0x02,0xb4,0x00,0x00,0x02,0x50,0xbd,0x01,0xf0,0x1e,0xbf,0x40,0x30,0x00,0x01,
+0xcf,0x1b,0xf4,0x7f,0x80,0x00,0xbf,0xd0,0xbf,0x45,0xff,0x40,0x4f,0xe1,0x0b,0xf4,
+0x07,0xfd,0x09,0xf8,0x00,0xbf,0x40,0x0e,0xf2,0xcf,0x40,0x0b,0xf4,0x00,0xbf,0x4b,
+0xf4,0x00,0x9e,0x30,0x0b,0xf4,0x9f,0x80,0x68,0x06,0xf1,0x0a,0x23,0xff,0x20,0x00,
+0x00,0x8f,0xc0,0x0a,0xfe,0x40,0x01,0x8f,0xf4,0x00,0x0c,0xff,0xed,0xff,0xf6,0x00,
+0x00,0x07,0xef,0xff,0xc3,0x42,0x0b,0x02,0x6d,0x02,0x12,0x21,0x93,0x06,0x10,0xf3,
 0xc2,0x01,0xb2,0x3f,0xff,0x70,0x11,0x00,0x7f,0xbf,0xff,0xff,0xce,0xb0,0x25,0x04,
-0xa0,0x53,0xff,0xff,0x82,0x5f,0xff,0xf7,0x03,0xff,0xc0,0x01,0x7e,0x20,0x3f,0xfa,
-0x5c,0x6f,0x90,0x2c,0xff,0xf4,0x01,0xdf,0xfe,0x42,0xff,0xff,0xbf,0x75,0x12,0x0a,
-0xf1,0x19,0x50,0x05,0x07,0xff,0xfa,0x13,0x99,0x87,0x02,0x30,0x08,0x12,0x46,0x91,
-0x08,0x40,0x25,0x00,0x36,0x20,0xfd,0x0c,0x30,0xfc,0x1a,0xf6,0xfd,0x05,0x20,0xe9,
-0xfe,0xa2,0x66,0x30,0xaf,0xc3,0x64,0xae,0x27,0xf1,0x08,0xcf,0xa3,0xef,0xa3,0xdf,
+0xf1,0x14,0x53,0xff,0xff,0x82,0x5f,0xff,0xf7,0x03,0xff,0xc0,0x00,0x7f,0xf8,0x00,
+0x3f,0xfa,0x00,0x06,0xff,0x70,0x2c,0xff,0xf4,0x01,0xdf,0xfe,0x42,0xff,0xff,0xfe,
+0xff,0xff,0xf6,0x0a,0xff,0x10,0x01,0x60,0x05,0x07,0xff,0xfa,0x13,0x20,0x2e,0x07,
+0x90,0x40,0x00,0x00,0x00,0x00,0x46,0x50,0x00,0x00,0xf0,0x50,0x00,0x00,0x00,0x25,
+0x00,0x36,0x20,0x00,0x00,0x00,0x4f,0xfc,0x1a,0xf6,0x00,0x00,0x00,0x7f,0xe9,0xfe,
+0xcf,0x60,0x00,0x00,0xaf,0xc3,0x64,0xff,0xf6,0x00,0x01,0xcf,0xa3,0xef,0xa3,0xdf,
 0x90,0x03,0xef,0x75,0xff,0xff,0xc3,0xcf,0xb0,0xdf,0x48,0xff,0xff,0xff,0xe3,0x9f,
-0x72,0x27,0x9b,0x0b,0xd0,0x50,0x00,0x9f,0xff,0xcb,0xef,0xff,0x30,0x00,0x09,0xff,
-0xf1,0x07,0x9a,0x00,0xb1,0x9f,0xff,0x10,0x7f,0xff,0x30,0x00,0x07,0xff,0xe0,0x06,
-0x7c,0x1f,0x23,0x04,0x54,0xc9,0x04,0x02,0x40,0x64,0x2d,0xff,0x20,0x07,0x00,0x30,
-0x47,0x8f,0xff,0x77,0x7e,0x12,0x9f,0x3e,0x26,0x00,0x34,0x48,0x01,0xb7,0x21,0x00,
-0x00,0x28,0xb1,0x46,0x66,0x3a,0xfa,0x36,0x66,0x50,0xff,0xff,0xf4,0x54,0x71,0x07,
-0x00,0xbc,0x1f,0x11,0xf2,0x20,0x17,0x31,0xb8,0xf2,0x9b,0x68,0x3a,0x73,0xa0,0x00,
-0x08,0xaa,0xaa,0xaa,0xa4,0x86,0x40,0x11,0xf2,0x15,0x63,0x00,0xbb,0x4e,0x01,0x4c,
-0x4e,0x41,0x6f,0x80,0x8f,0x60,0x87,0x2c,0xe0,0x3f,0xfe,0xee,0x40,0x00,0x9e,0xee,
-0xf9,0xff,0xff,0xfc,0x44,0x5f,0xff,0xe5,0x12,0x01,0x87,0x08,0x12,0xff,0x01,0x00,
-0x12,0x9a,0x07,0x00,0x11,0xf5,0x19,0x03,0xf2,0x0d,0x07,0x90,0x00,0x6d,0xff,0xfb,
-0x40,0xcf,0x00,0xbf,0xfd,0xbd,0xff,0xac,0xf0,0xbf,0xd3,0x00,0x03,0xcf,0xff,0x4f,
-0xd1,0x00,0x07,0xaa,0xff,0xf9,0xf5,0x4e,0x11,0x01,0xba,0x58,0x14,0x10,0x20,0x08,
-0x00,0xee,0x68,0x70,0x9f,0xff,0xab,0x70,0x00,0x0d,0xf4,0x6b,0x7a,0xe0,0x3c,0xfb,
-0x0f,0xcb,0xff,0xca,0xcf,0xfc,0x10,0xfc,0x05,0xcf,0xff,0xd7,0x3f,0x6b,0x01,0xbd,
-0x01,0x00,0x3d,0x5c,0x61,0x06,0xf7,0x01,0x16,0xff,0x8f,0x32,0x1d,0x04,0x07,0x00,
-0xb2,0x8a,0xcc,0xef,0xf8,0x00,0x02,0xef,0x80,0x00,0x02,0xe7,0x5b,0x14,0x22,0x04,
-0x20,0xce,0x74,0x40,0x01,0x16,0xff,0x80,0xfc,0x1f,0x20,0x82,0xb1,0x8f,0x0a,0x10,
-0xc9,0x05,0x00,0x10,0x9b,0xa3,0x33,0xa4,0xf3,0xbd,0xdf,0xff,0x80,0x10,0x00,0x03,
-0xef,0x80,0x91,0x4d,0x0b,0xa4,0x4a,0x21,0x04,0xc2,0x6d,0x00,0x00,0x9a,0x41,0x00,
-0xe7,0x8e,0x30,0xb7,0x0c,0xb0,0x4b,0x00,0xb0,0x05,0xf5,0x2f,0x3f,0xff,0xff,0xf8,
-0x2c,0x17,0xd0,0xb8,0x4b,0x00,0x40,0xba,0x2f,0x18,0xbf,0x0b,0x05,0x31,0xb1,0xf2,
-0x7b,0x55,0x00,0x30,0x5e,0x0a,0x9a,0x89,0x00,0x30,0x2e,0x80,0xe4,0x8d,0x00,0x40,
-0x0c,0xa0,0x8d,0x00,0x91,0x00,0x31,0x10,0x7f,0x30,0x5f,0x00,0x24,0x4f,0x40,0x36,
-0x04,0x11,0x9f,0x29,0x01,0x31,0x9f,0xf9,0xbf,0xda,0x05,0x02,0xa8,0x66,0xa0,0x80,
-0x0d,0xff,0xf8,0xaf,0xff,0xff,0x9b,0xff,0xf8,0x1d,0x01,0x20,0x6d,0xf8,0xd8,0x3c,
-0x20,0x40,0x17,0xc9,0x01,0x11,0xa0,0xc8,0x01,0x10,0xfd,0x96,0x64,0x33,0xad,0xfa,
-0xff,0x70,0x6c,0x13,0x40,0xa4,0x1a,0x20,0x0c,0xfb,0xdc,0x32,0x10,0xf3,0x14,0x1e,
-0x10,0xc0,0xd0,0x04,0x10,0x70,0x48,0x0a,0x10,0x2a,0x39,0x17,0x00,0x87,0x22,0xf0,
-0x00,0xdf,0xb7,0xff,0xff,0xfe,0xce,0x2d,0xff,0xff,0xb5,0xfc,0x36,0xff,0xf3,0x07,
-0x52,0x1a,0xf0,0x0c,0x02,0x89,0x72,0x00,0x06,0x40,0x00,0x02,0x42,0xfa,0x00,0x03,
-0xef,0x2f,0xa0,0x04,0xff,0xf2,0xfa,0x05,0xff,0xff,0x2f,0xa6,0xff,0xff,0xf2,0x01,
-0x44,0x10,0x2f,0xff,0x01,0xf2,0x04,0xfc,0xdf,0xff,0xff,0x2f,0xa1,0xdf,0xff,0xf2,
-0xfa,0x01,0xcf,0xff,0x2f,0xa0,0x00,0xbf,0xf2,0xf9,0xaa,0x46,0x32,0x00,0x00,0x24,
-0xad,0x34,0x12,0xc3,0xb5,0x01,0x00,0x45,0x6e,0x02,0xcd,0x22,0x00,0x14,0x03,0x02,
-0x57,0x26,0x22,0xfa,0x10,0x25,0x21,0x02,0x81,0x19,0x01,0xd0,0x06,0x11,0x50,0xca,
-0x47,0x00,0x1e,0x00,0x10,0xb2,0x2a,0x00,0x10,0xd4,0x36,0x00,0x11,0xf7,0x87,0x2a,
-0x11,0x10,0x0d,0x25,0x90,0x66,0x10,0x16,0x66,0x30,0xef,0xff,0xc0,0xaf,0xc6,0x09,
-0x4f,0xe0,0xbf,0xff,0xf2,0x06,0x00,0x19,0xb0,0xd0,0xbf,0xff,0xf2,0xaf,0xff,0x80,
-0x6e,0xff,0xc0,0x26,0x22,0x07,0x00,0x2b,0x5d,0x01,0x9a,0x07,0x00,0x40,0x1b,0x0f,
-0x06,0x00,0x1c,0x21,0xf5,0xaf,0x2a,0x1d,0xf3,0x08,0x05,0x00,0x00,0x06,0x45,0xfb,
-0x00,0x01,0xfc,0x6f,0xfc,0x10,0x1f,0xc6,0xff,0xfd,0x11,0xfc,0x6f,0xff,0xfd,0x3f,
-0xc6,0x12,0x05,0x00,0x1d,0x05,0xf5,0x04,0xfa,0xfc,0x6f,0xff,0xf7,0x1f,0xc6,0xff,
-0xf6,0x01,0xfc,0x6f,0xf5,0x00,0x1f,0xc3,0xe4,0x00,0x00,0xca,0x35,0x12,0x52,0x2f,
-0x25,0x12,0xe2,0x2b,0x07,0x01,0x0a,0x49,0x00,0x7e,0x1d,0x03,0x27,0x6b,0x11,0x5f,
-0x7b,0x22,0x12,0x0e,0xda,0x1d,0x10,0x8e,0x6d,0x06,0x30,0xc1,0x02,0x44,0x01,0x00,
-0x12,0x00,0x82,0x00,0x12,0x0f,0x33,0x09,0x01,0x68,0x58,0x12,0xe3,0x63,0x06,0x00,
-0x5d,0x7d,0x91,0xbf,0xf2,0x00,0x0b,0xff,0x30,0x00,0xbf,0xf3,0x07,0x00,0x20,0x2f,
-0xf9,0x72,0x24,0x00,0x8e,0x6f,0x14,0xf8,0x09,0x00,0x60,0xf4,0x00,0x00,0x05,0xb0,
-0x01,0x47,0x40,0x60,0xc0,0x00,0x00,0x1e,0xfc,0x00,0x84,0x7b,0x02,0xab,0x05,0x01,
-0x09,0x00,0x21,0x7f,0xf4,0x24,0x74,0x21,0x6f,0xf7,0x07,0x00,0x10,0x2f,0xda,0x2b,
-0x11,0x70,0xc7,0x69,0x11,0x40,0x77,0x07,0x1f,0xe0,0x06,0x00,0x01,0x15,0xdf,0xc1,
-0x01,0x60,0xff,0xf5,0x36,0x66,0xbf,0xf6,0x25,0x59,0x0e,0x2a,0x00,0x00,0x3c,0x87,
-0x01,0x9d,0x56,0x09,0x30,0x00,0x10,0x35,0xf3,0x09,0x70,0x40,0x00,0x00,0x5a,0xcd,
-0xc8,0x20,0xc1,0x77,0xf0,0x28,0xd7,0x69,0xff,0x90,0x00,0x04,0xff,0xa0,0x01,0x02,
-0xef,0xc1,0x02,0xff,0xf1,0x02,0xfc,0x16,0xff,0xb0,0xcf,0xfb,0x05,0xaf,0xf9,0x1f,
-0xff,0x6d,0xff,0xb1,0xff,0xff,0xb1,0xff,0xf7,0x4f,0xfe,0x0b,0xff,0xf5,0x5f,0xfc,
-0x00,0x6f,0xf9,0x08,0xa5,0x1d,0xfd,0x20,0x00,0x5e,0xfb,0x53,0x6e,0x60,0x38,0x74,
-0x07,0xce,0xfe,0xa4,0x00,0x00,0x32,0xac,0x12,0x14,0xf5,0x60,0x2b,0x50,0xf9,0x05,
-0xac,0xdb,0x71,0x9a,0x1c,0x51,0xff,0xfd,0x76,0xaf,0xf7,0x81,0x80,0xf0,0x08,0x31,
-0x30,0x4f,0xfa,0x00,0x00,0x32,0x04,0xef,0xbf,0xc0,0x9f,0xf8,0x00,0x0e,0xf5,0x02,
-0xcf,0xff,0x64,0xff,0xf3,0x01,0x60,0x4a,0x50,0xf8,0x4f,0xff,0x40,0x06,0xd9,0x40,
-0xb0,0xeb,0xff,0xa0,0x00,0x09,0xff,0x60,0x00,0x3e,0xff,0xc0,0xcc,0x25,0x21,0xa4,
-0x30,0x9c,0x84,0x45,0x02,0x8d,0xff,0x80,0x1b,0x15,0x33,0x04,0xef,0x20,0x58,0x0e,
-0x14,0x70,0x72,0x89,0x00,0x51,0x18,0x14,0xf8,0x57,0x46,0x13,0x20,0xee,0x64,0x13,
-0xa0,0x62,0x68,0x11,0xf4,0xbe,0x09,0x31,0xf5,0x1a,0xfd,0xb6,0x68,0x40,0xf4,0x0a,
-0xff,0x60,0xc9,0x09,0x40,0xf5,0x0a,0xff,0xe1,0x44,0x1e,0x40,0xf6,0x0b,0xff,0xf9,
-0x04,0x02,0x10,0xfd,0x4a,0x8a,0x30,0x02,0xff,0xff,0x25,0x0e,0x00,0x9c,0x18,0x73,
-0xf7,0x1c,0xff,0xff,0xf4,0x0e,0xff,0x85,0x4a,0x11,0x9a,0x39,0x6f,0x01,0x95,0x71,
-0x03,0x52,0x52,0x60,0x3f,0xa0,0xef,0xfa,0x00,0x05,0x66,0x05,0xf0,0x02,0xf9,0x04,
-0xff,0xff,0xfb,0x11,0x3f,0xa4,0xff,0x84,0xfc,0x00,0x00,0x33,0xff,0x90,0x19,0xd5,
-0x01,0xd1,0xa2,0x01,0x70,0x00,0x02,0xef,0xa4,0xf6,0x3f,0xa0,0xef,0xff,0xb0,0x8d,
-0x05,0x00,0xf1,0x64,0x20,0xfb,0x11,0x0f,0x84,0x12,0xfc,0xcc,0x1d,0x05,0xd6,0x04,
-0x21,0x5f,0xa0,0x04,0x21,0x10,0xfa,0x0b,0x00,0x30,0xfa,0xff,0xa0,0xaf,0x94,0x81,
-0x3f,0xfa,0x00,0x4f,0xf9,0x00,0x03,0xff,0x99,0x36,0x31,0x3f,0xf1,0x15,0x6b,0x6a,
-0x11,0x01,0x9f,0x04,0x20,0x9f,0x50,0xfa,0x47,0x10,0x8f,0x83,0x4f,0xc0,0xd0,0x08,
-0xff,0x50,0x1d,0xfd,0x10,0x00,0x8f,0xf6,0xdf,0xd1,0x61,0x01,0x11,0xfd,0x25,0x71,
-0x24,0xd1,0x00,0x2b,0x73,0x23,0x7d,0x10,0x14,0x01,0x21,0xfd,0x18,0xe2,0x03,0xc2,
-0x6f,0xff,0xfd,0x4a,0xaa,0xaa,0xfb,0x00,0x0c,0xda,0xf7,0xf4,0xcc,0x78,0x22,0x9f,
-0x11,0x69,0x3a,0x23,0x09,0xf1,0xdd,0x78,0x00,0x26,0x5b,0x31,0xe6,0xeb,0x9d,0x65,
-0x21,0x40,0x4d,0xff,0xff,0xa0,0x05,0x21,0x43,0xfb,0x1d,0xff,0xa0,0x16,0x7c,0x07,
-0x8b,0x1d,0x32,0x6b,0xcc,0xc7,0x8e,0x0e,0x32,0xf8,0x22,0x22,0x54,0x04,0x00,0xb8,
-0x06,0x0f,0x01,0x00,0x11,0x05,0x26,0x05,0x02,0x29,0x8b,0x01,0x18,0x8f,0x01,0x88,
-0x03,0x11,0x80,0x27,0x02,0x01,0xcf,0x6b,0x12,0x7f,0xb8,0x04,0x5f,0x69,0x9f,0xff,
-0x99,0x60,0x52,0x07,0x03,0x50,0x46,0x66,0x2f,0xff,0x26,0x36,0x07,0x30,0x46,0x76,
-0x4f,0x69,0x04,0x2e,0xfc,0xbc,0x36,0x07,0x14,0x00,0x91,0x89,0x00,0x21,0x2a,0x01,
-0x9c,0x11,0x02,0xc7,0x82,0x12,0x0e,0x32,0x09,0x13,0x0c,0x30,0x43,0x22,0xbf,0xf6,
-0x07,0x00,0x12,0xf1,0x9e,0x6d,0x10,0x80,0x7b,0x5d,0x90,0x4f,0xfd,0x00,0x03,0xaf,
-0xf8,0x07,0xff,0xf2,0x4a,0x20,0x31,0xef,0xfe,0x30,0x0b,0x0e,0x11,0xc2,0xa0,0x00,
-0x01,0x29,0x8a,0x21,0x98,0x62,0x67,0x01,0x30,0x84,0x00,0x00,0x0d,0x7a,0xf2,0x02,
+0x72,0x27,0xff,0xff,0xff,0xff,0xf2,0x50,0x00,0x9f,0xff,0xcb,0xef,0xff,0x30,0x00,
+0x09,0xff,0xf1,0x07,0xff,0xf3,0x00,0x00,0x9f,0xff,0x10,0x7f,0xff,0x30,0x00,0x07,
+0xff,0xe0,0x06,0xff,0xf2,0x00,0x00,0x00,0x04,0x54,0x00,0x01,0x00,0x30,0x1f,0xff,
+0x10,0x07,0x00,0x3d,0x2f,0xff,0x20,0x07,0x00,0x50,0x47,0x8f,0xff,0x87,0x40,0x39,
+0x00,0x90,0xff,0xff,0x90,0x00,0x00,0x0a,0xff,0xff,0xfa,0x1c,0x00,0xf2,0x08,0xaf,
+0xff,0xa0,0x00,0x00,0x46,0x66,0x3a,0xfa,0x36,0x66,0x50,0xff,0xff,0xf4,0x54,0xff,
+0xff,0xf2,0xff,0xff,0xff,0xcf,0x07,0x00,0x60,0xff,0xf3,0xb8,0xf2,0x9b,0xbb,0x01,
+0x00,0xa1,0xa0,0x00,0x08,0xaa,0xaa,0xaa,0xa4,0x00,0x00,0x08,0x8f,0x00,0x30,0x00,
+0x03,0xfb,0x58,0x00,0x30,0xd0,0x00,0xdf,0x6f,0x00,0x40,0x6f,0x80,0x8f,0x60,0x4c,
+0x00,0xf1,0x03,0xbf,0x3f,0xfe,0xee,0x40,0x00,0x9e,0xee,0xf9,0xff,0xff,0xfc,0x44,
+0x5f,0xff,0xff,0xaf,0xff,0x01,0x00,0x22,0xfa,0xff,0x01,0x00,0x12,0x9a,0x07,0x00,
+0xf0,0x14,0xf5,0x00,0x00,0x00,0x10,0x00,0x07,0x90,0x00,0x6d,0xff,0xfb,0x40,0xcf,
+0x00,0xbf,0xfd,0xbd,0xff,0xac,0xf0,0xbf,0xd3,0x00,0x03,0xcf,0xff,0x4f,0xd1,0x00,
+0x07,0xaa,0xff,0xf9,0xf5,0x97,0x00,0x91,0xff,0x01,0x00,0x00,0x00,0x11,0x11,0x10,
+0x00,0x01,0x00,0x01,0xae,0x00,0xf1,0x10,0x4f,0x9f,0xff,0xab,0x70,0x00,0x0d,0xf4,
+0xff,0xfb,0x20,0x00,0x3c,0xfb,0x0f,0xcb,0xff,0xca,0xcf,0xfc,0x10,0xfc,0x05,0xcf,
+0xff,0xd7,0x00,0x09,0x70,0x00,0x12,0x2b,0x00,0xe4,0x05,0x20,0x00,0x06,0xf7,0x01,
+0x16,0xff,0x8f,0xff,0xff,0xf8,0xff,0xff,0x07,0x00,0xe0,0x8a,0xcc,0xef,0xf8,0x00,
+0x02,0xef,0x80,0x00,0x02,0xe7,0x00,0x00,0x01,0x2f,0x01,0x10,0x20,0xb8,0x00,0xf0,
+0x02,0x70,0x00,0x01,0x16,0xff,0x80,0x00,0xef,0xff,0xff,0x82,0xb1,0xff,0xff,0xff,
+0x80,0xc9,0x05,0x00,0xf2,0x06,0x9b,0xff,0xff,0xff,0x82,0xf3,0xbd,0xdf,0xff,0x80,
+0x10,0x00,0x03,0xef,0x80,0x00,0x00,0x00,0x3e,0x70,0x00,0x36,0x00,0x07,0x01,0x00,
+0x22,0x04,0xc2,0x6d,0x00,0xa0,0x0b,0xe1,0x00,0x00,0x06,0xf7,0x00,0xb7,0x0c,0xb0,
+0x4b,0x00,0xb0,0x05,0xf5,0x2f,0x3f,0xff,0xff,0xf8,0x2c,0x17,0xd0,0xb8,0x4b,0x00,
+0xb1,0xba,0x2f,0x18,0xbf,0xff,0xff,0xf8,0x09,0xb1,0xf2,0x7b,0x55,0x00,0x30,0x5e,
+0x0a,0x9a,0x89,0x00,0x30,0x2e,0x80,0xe4,0x8d,0x00,0x40,0x0c,0xa0,0x8d,0x00,0x91,
+0x00,0x31,0x10,0x7f,0x30,0x5f,0x00,0x22,0x4f,0x40,0x5b,0x00,0x31,0x10,0x00,0x9f,
+0x29,0x01,0x30,0x9f,0xf9,0xbf,0x07,0x00,0x40,0xf8,0x00,0xdf,0xff,0x4d,0x00,0x90,
+0x0d,0xff,0xf8,0xaf,0xff,0xff,0x9b,0xff,0xf8,0x1d,0x01,0x80,0x6d,0xf8,0x00,0x00,
+0xcf,0xff,0x40,0x17,0xc9,0x01,0x11,0xa0,0xc8,0x01,0x61,0xfd,0xaa,0xaa,0xaa,0xaa,
+0xad,0x6c,0x01,0x00,0x2c,0x01,0x10,0x40,0xe0,0x00,0x80,0x50,0x00,0x00,0x0c,0xfb,
+0x00,0x00,0x03,0x31,0x02,0xf0,0x39,0xdf,0xff,0xc0,0x00,0x8f,0xff,0xff,0x70,0x2f,
+0xff,0xff,0xff,0x2a,0xff,0xff,0xff,0xf9,0xef,0xef,0xff,0xff,0xdf,0xb7,0xff,0xff,
+0xfe,0xce,0x2d,0xff,0xff,0xb5,0xfc,0x36,0xff,0xf3,0x07,0xff,0xff,0xf6,0x00,0x02,
+0x89,0x72,0x00,0x06,0x40,0x00,0x02,0x42,0xfa,0x00,0x03,0xef,0x2f,0xa0,0x04,0xff,
+0xf2,0xfa,0x05,0xff,0xff,0x2f,0xa6,0xff,0xff,0xf2,0xfe,0xff,0xff,0xff,0x2f,0xff,
+0x01,0xf1,0x07,0xfc,0xdf,0xff,0xff,0x2f,0xa1,0xdf,0xff,0xf2,0xfa,0x01,0xcf,0xff,
+0x2f,0xa0,0x00,0xbf,0xf2,0xf9,0x00,0x00,0x9c,0xbd,0x00,0x11,0x24,0x06,0x00,0x22,
+0xef,0xc3,0xb5,0x01,0x11,0x91,0x06,0x00,0x21,0xff,0x70,0x06,0x00,0x31,0xfd,0x40,
+0x00,0x9d,0x00,0x21,0x10,0xff,0x44,0x02,0x11,0xff,0x61,0x02,0x00,0x05,0x00,0x21,
+0xfe,0x50,0xe1,0x00,0x00,0x1e,0x00,0x10,0xb2,0x2a,0x00,0x10,0xd4,0x36,0x00,0x10,
+0xf7,0x42,0x00,0x11,0x48,0xd4,0x01,0xff,0x03,0x26,0x66,0x10,0x16,0x66,0x30,0xef,
+0xff,0xc0,0xaf,0xff,0xf1,0xff,0xff,0xe0,0xbf,0xff,0xf2,0x06,0x00,0x19,0xf0,0x02,
+0xd0,0xbf,0xff,0xf2,0xaf,0xff,0x80,0x6e,0xff,0xc0,0x26,0x66,0x66,0x66,0x66,0x50,
+0xef,0x6d,0x00,0x11,0xf4,0x7e,0x00,0x1f,0xf6,0x06,0x00,0x1c,0x11,0xf5,0xd2,0x02,
+0xf4,0x28,0xd1,0x05,0x00,0x00,0x06,0x45,0xfb,0x00,0x01,0xfc,0x6f,0xfc,0x10,0x1f,
+0xc6,0xff,0xfd,0x11,0xfc,0x6f,0xff,0xfd,0x3f,0xc6,0xff,0xff,0xff,0xfc,0x6f,0xff,
+0xff,0xff,0xc6,0xff,0xff,0xfa,0xfc,0x6f,0xff,0xf7,0x1f,0xc6,0xff,0xf6,0x01,0xfc,
+0x6f,0xf5,0x00,0x1f,0xc3,0xe4,0x00,0x00,0xfb,0x3a,0x02,0x21,0x52,0x00,0xb0,0x01,
+0x30,0xe2,0x00,0x00,0x8d,0x03,0x60,0xd1,0x00,0x00,0x00,0x8f,0xff,0x07,0x00,0x00,
+0x3b,0x00,0x30,0xc0,0x00,0x5f,0x62,0x00,0x21,0xb0,0x0e,0x6f,0x00,0x90,0x40,0x8e,
+0xee,0xee,0xee,0xee,0xc1,0x02,0x44,0x01,0x00,0x12,0x00,0x82,0x00,0x11,0x0f,0x07,
+0x00,0x30,0x60,0xcf,0xff,0x1e,0x04,0x01,0x2d,0x02,0xe1,0x00,0x0b,0xf2,0x00,0x00,
+0xbf,0xf2,0x00,0x0b,0xff,0x30,0x00,0xbf,0xf3,0x07,0x00,0xb4,0x2f,0xf9,0x00,0x00,
+0x06,0xff,0x80,0x00,0x00,0x6f,0xf8,0x09,0x00,0x50,0xf4,0x00,0x00,0x05,0xb0,0xc4,
+0x02,0xe4,0x1e,0xc0,0x00,0x00,0x1e,0xfc,0x00,0x00,0x02,0xef,0xc0,0x00,0x00,0x2e,
+0x09,0x00,0x91,0x7f,0xf4,0x00,0x06,0xff,0x70,0x00,0x6f,0xf7,0x07,0x00,0x60,0x2f,
+0xf7,0x00,0x00,0x0a,0x70,0xa1,0x00,0x11,0x17,0x94,0x02,0x2f,0x8f,0xe0,0x06,0x00,
+0x01,0x15,0xdf,0xc1,0x01,0x8f,0xff,0xf5,0x36,0x66,0xbf,0xf6,0x66,0x50,0x2a,0x00,
+0x01,0x99,0x4d,0x90,0x00,0x00,0x01,0x11,0x11,0x11,0x11,0x30,0x00,0xf3,0x43,0x35,
+0x55,0x55,0x55,0x55,0x40,0x00,0x00,0x5a,0xcd,0xc8,0x20,0x00,0x00,0x02,0xdf,0xd7,
+0x69,0xff,0x90,0x00,0x04,0xff,0xa0,0x01,0x02,0xef,0xc1,0x02,0xff,0xf1,0x02,0xfc,
+0x16,0xff,0xb0,0xcf,0xfb,0x05,0xaf,0xf9,0x1f,0xff,0x6d,0xff,0xb1,0xff,0xff,0xb1,
+0xff,0xf7,0x4f,0xfe,0x0b,0xff,0xf5,0x5f,0xfc,0x00,0x6f,0xf9,0x08,0xa5,0x1d,0xfd,
+0x20,0x00,0x5e,0xfb,0x53,0x6e,0xfb,0x10,0x00,0x00,0x07,0xce,0xfe,0xa4,0x00,0x00,
+0x32,0x5e,0x01,0x23,0x0e,0xf5,0x09,0x00,0xe0,0x3e,0xf9,0x05,0xac,0xdb,0x71,0x00,
+0x00,0x00,0x1b,0xff,0xfd,0x76,0xaf,0x4e,0x02,0xf0,0x29,0x08,0xff,0x31,0x30,0x4f,
+0xfa,0x00,0x00,0x32,0x04,0xef,0xbf,0xc0,0x9f,0xf8,0x00,0x0e,0xf5,0x02,0xcf,0xff,
+0x64,0xff,0xf3,0x01,0xff,0xf6,0x00,0x9f,0xf8,0x4f,0xff,0x40,0x06,0xff,0xc0,0x00,
+0x6f,0xeb,0xff,0xa0,0x00,0x09,0xff,0x60,0x00,0x3e,0xff,0xc0,0x00,0x00,0x07,0xff,
+0xa4,0x30,0x1b,0x65,0x00,0x73,0x02,0x8d,0xff,0x80,0x08,0xfe,0x30,0xfc,0x03,0x22,
+0xef,0x20,0x09,0x00,0x11,0x02,0x19,0x04,0x03,0xb7,0x03,0x22,0x0d,0xf8,0x08,0x00,
+0x12,0x7f,0x75,0x05,0x21,0x01,0xff,0x99,0x03,0x00,0x69,0x05,0x10,0xf4,0x08,0x00,
+0x40,0x3f,0xf5,0x1a,0xfd,0x08,0x00,0xf0,0x06,0xcf,0xf4,0x0a,0xff,0x60,0x00,0x00,
+0x05,0xff,0xf5,0x0a,0xff,0xe1,0x00,0x00,0x0e,0xff,0xf6,0x0b,0xff,0xf9,0x04,0x02,
+0xf2,0x07,0xfd,0x8f,0xff,0xff,0x20,0x02,0xff,0xff,0xf3,0x09,0xff,0xff,0xb0,0x0a,
+0xff,0xff,0xf7,0x1c,0xff,0xff,0xf4,0x0e,0x34,0x05,0x40,0xf8,0x04,0x9a,0xaa,0x01,
+0x00,0x11,0x91,0x5a,0x00,0x21,0x70,0x00,0x51,0x00,0x50,0xa0,0xef,0xfa,0x00,0x05,
+0x66,0x05,0xf0,0x02,0xf9,0x04,0xff,0xff,0xfb,0x11,0x3f,0xa4,0xff,0x84,0xfc,0x00,
+0x00,0x33,0xff,0x90,0x19,0xd5,0x01,0xd0,0xa2,0x01,0x70,0x00,0x02,0xef,0xa4,0xf6,
+0x3f,0xa0,0xef,0xff,0xb0,0x8d,0x05,0x00,0xdd,0x00,0x20,0xff,0xfb,0x51,0x05,0x21,
+0x14,0xfc,0x41,0x00,0x15,0x19,0xd6,0x04,0x20,0x5f,0xa0,0xcd,0x04,0x01,0x11,0x06,
+0xf1,0x0f,0x5f,0xfa,0xff,0xa0,0x00,0x05,0xff,0x90,0x3f,0xfa,0x00,0x4f,0xf9,0x00,
+0x03,0xff,0xa0,0xbf,0x90,0x00,0x00,0x3f,0xf1,0x15,0x00,0x00,0x00,0x03,0x30,0x01,
+0x9f,0x04,0xf0,0x08,0x9f,0x50,0x00,0x00,0x1d,0xe1,0x8f,0xf5,0x00,0x01,0xdf,0xd0,
+0x08,0xff,0x50,0x1d,0xfd,0x10,0x00,0x8f,0xf6,0xdf,0xd1,0x61,0x01,0x20,0xfd,0x10,
+0xf8,0x01,0x11,0xd1,0x89,0x05,0x00,0x0b,0x00,0x23,0x7d,0x10,0x14,0x01,0x21,0xfd,
+0x18,0xe2,0x03,0xf3,0x0e,0x6f,0xff,0xfd,0x4a,0xaa,0xaa,0xfb,0x00,0x0c,0xda,0xf7,
+0xf4,0x00,0x00,0x0e,0xb0,0x00,0x00,0x9f,0x11,0x00,0x00,0x00,0xeb,0x00,0x00,0x09,
+0xf1,0x00,0x11,0x00,0xc0,0x10,0x00,0x02,0xe6,0xeb,0x9d,0x00,0x09,0xf9,0x99,0x99,
+0x4d,0x44,0x01,0x72,0x7f,0xff,0xff,0xfb,0x1d,0xff,0xa0,0x49,0x00,0x26,0x1d,0xa0,
+0x83,0x05,0xc2,0x6b,0xcc,0xc7,0x00,0x00,0x00,0x0f,0xff,0xff,0xf8,0x22,0x22,0x54,
+0x04,0x00,0xb8,0x06,0x0f,0x01,0x00,0x11,0x05,0x26,0x05,0x12,0x00,0xd2,0x01,0x12,
+0x08,0xbb,0x01,0x10,0x8f,0x2a,0x03,0x00,0xe2,0x06,0x11,0xf8,0xc7,0x01,0x01,0xb8,
+0x04,0x5f,0x69,0x9f,0xff,0x99,0x60,0x52,0x07,0x03,0x50,0x46,0x66,0x2f,0xff,0x26,
+0x36,0x07,0x30,0x46,0x76,0x4f,0x69,0x04,0x2e,0xfc,0xbc,0x36,0x07,0x00,0x01,0x00,
+0x22,0x33,0x00,0x10,0x02,0x01,0x70,0x07,0x31,0x07,0xff,0xff,0xa7,0x02,0x11,0xff,
+0x0d,0x02,0x12,0x0c,0x15,0x00,0x32,0x00,0xbf,0xf6,0x07,0x00,0x00,0x05,0x01,0x01,
+0xb1,0x03,0xf1,0x0a,0x01,0x50,0x00,0x4f,0xfd,0x00,0x03,0xaf,0xf8,0x07,0xff,0xf2,
+0x00,0x0e,0xff,0xff,0xef,0xfe,0x30,0x00,0x0b,0xff,0xff,0xff,0xc2,0xa0,0x00,0x10,
+0xd5,0x7c,0x02,0x21,0x98,0x62,0x67,0x01,0x10,0x84,0xc5,0x01,0xf1,0x05,0x8f,0xff,
 0x60,0x00,0xaf,0xf3,0xec,0x2e,0xc0,0x1c,0xff,0xa0,0xde,0x9f,0xd1,0xdf,0xfa,0x00,
-0x3e,0xda,0x2f,0x11,0x2d,0x61,0x00,0x10,0x1c,0x4e,0x05,0x11,0x2d,0x4d,0x22,0xf1,
-0x0e,0xcf,0xaf,0xd2,0xef,0xf6,0x00,0xfb,0x0d,0xd0,0x2e,0xff,0x60,0xbf,0xef,0x80,
-0x02,0xef,0xf3,0x19,0xc8,0x00,0x00,0x16,0x40,0x00,0x02,0x66,0x66,0x12,0x88,0x56,
-0x11,0x3f,0x55,0x38,0xa1,0x3f,0xf2,0xdf,0x6c,0xff,0xff,0x53,0x31,0xff,0x7c,0xfe,
-0x04,0x0f,0x06,0x00,0x0b,0x10,0x7b,0xd3,0x03,0x62,0xff,0xc2,0x33,0x33,0x33,0x20,
-0xaf,0x49,0x11,0x8a,0xb2,0x7a,0x11,0x49,0x32,0x0b,0x02,0xc4,0x06,0x01,0xa8,0x90,
-0x20,0x80,0xfa,0x1c,0x06,0x11,0xf3,0x06,0x00,0x20,0xf5,0xfe,0x6f,0x6f,0x01,0x00,
-0x52,0x00,0x06,0x00,0x20,0x80,0x4f,0x06,0x00,0x20,0x10,0x0c,0x06,0x00,0x20,0x50,
-0x1e,0x06,0x00,0x51,0xfb,0xef,0xff,0xf5,0x9f,0x70,0x05,0x10,0xcd,0xd4,0x0c,0x24,
-0xd4,0xef,0x3d,0x08,0x05,0x01,0x00,0x7f,0xbc,0xcc,0xcc,0xcc,0xcc,0xc3,0xff,0x18,
-0x00,0x10,0x10,0x6b,0x12,0x00,0x22,0xcb,0x6f,0xfe,0x01,0x02,0x5e,0x07,0x11,0x95,
-0x0e,0x00,0x70,0x65,0xf9,0x3d,0xff,0xff,0xfd,0x39,0x03,0x00,0x20,0xf9,0x3d,0x10,
-0x00,0x21,0xa4,0x6f,0x0c,0x70,0x1c,0xbf,0x2b,0x02,0x50,0x55,0x55,0x20,0x00,0x03,
-0x3a,0x09,0x11,0x05,0x72,0x23,0x01,0x95,0x12,0x50,0xff,0xfc,0x44,0x40,0x0c,0xd2,
-0x0b,0x12,0x0e,0xa0,0x07,0x01,0xc6,0x50,0x20,0x8f,0xf6,0xc9,0x01,0x10,0xc0,0xc3,
-0x06,0x10,0x30,0xf2,0x8f,0x04,0xbb,0x4b,0x15,0x03,0x92,0x12,0x92,0x35,0x6e,0xf7,
-0x54,0x00,0x00,0xff,0xf9,0x8f,0xe5,0x3a,0x00,0x06,0x00,0xb0,0xfa,0x24,0x44,0x01,
-0x00,0xff,0xf4,0xef,0xff,0x3e,0x20,0x9b,0x06,0x20,0x3f,0xe2,0x06,0x00,0x21,0x43,
-0x31,0xa7,0x06,0x18,0xf6,0x06,0x00,0x22,0x23,0x30,0x38,0x60,0x02,0x06,0x00,0x43,
-0x7a,0xaa,0xaa,0xa2,0x49,0x6d,0x02,0x1e,0x59,0x11,0x07,0x99,0x70,0x10,0x8f,0x48,
-0x0f,0x11,0x01,0x59,0x2a,0x11,0x04,0x10,0x48,0x02,0x82,0x2f,0x02,0xdb,0x1e,0x01,
-0x74,0x30,0x02,0x83,0x2b,0x12,0xd0,0x0b,0x07,0x20,0x13,0x33,0xb9,0x01,0x41,0x00,
-0x00,0xcf,0xf2,0xc4,0x0b,0x51,0x50,0x00,0x00,0x5a,0xaa,0x01,0x00,0x22,0x2f,0xff,
-0x63,0x1f,0xf0,0x19,0xfa,0x0d,0x01,0xb0,0xd0,0xa2,0x0f,0xaf,0xeb,0xfb,0xcf,0xbf,
-0xbe,0xcb,0xfa,0xff,0xe1,0x98,0x1c,0x1c,0x15,0xff,0xaf,0xfd,0x08,0x70,0xb0,0xb0,
-0x3f,0xfa,0xff,0xdf,0xdd,0xdd,0xdd,0xfd,0xdf,0xaf,0xa0,0xd0,0x27,0x8c,0x87,0xfa,
-0xfe,0xaf,0xaa,0xaa,0xaa,0xeb,0xaf,0xed,0x09,0x01,0x94,0x76,0x11,0x00,0x9e,0x00,
-0x01,0x96,0x78,0x11,0x8f,0x24,0x8e,0x11,0x29,0x60,0x15,0x12,0x03,0x76,0x6e,0x12,
-0x3c,0x8b,0x3b,0x13,0x0f,0xa2,0x79,0x23,0x9e,0xff,0xb3,0x58,0x00,0xc8,0x55,0x02,
-0xa0,0x25,0x13,0xf9,0x71,0x60,0x02,0x0f,0x82,0x03,0x0f,0x04,0x13,0x4f,0x47,0x38,
-0x20,0x76,0x00,0xeb,0x24,0x10,0x43,0x4f,0x01,0x20,0xfb,0x8a,0x05,0x00,0xc1,0x8f,
-0xa0,0xff,0xff,0xfb,0x7f,0xf8,0xff,0xff,0xfc,0x11,0x11,0xaa,0x0c,0x0f,0x05,0x00,
-0x10,0x21,0xbd,0xdd,0xc4,0x12,0x30,0x00,0x35,0x54,0xb5,0x04,0x00,0xfd,0x36,0x20,
-0xff,0xd8,0xa6,0x51,0xf0,0x10,0xff,0xdb,0xbc,0xff,0xff,0x70,0x08,0xff,0xd6,0x10,
-0x00,0x00,0x4b,0xff,0xb0,0xbf,0x70,0x00,0x13,0x32,0x00,0x05,0xed,0x10,0x30,0x06,
-0xdf,0xff,0xfe,0x80,0x01,0x36,0x57,0x21,0xfc,0xce,0x18,0x63,0x51,0xbe,0x60,0x00,
-0x04,0xde,0x72,0x51,0x22,0x03,0x40,0xfc,0x0d,0x14,0x04,0x12,0x75,0x23,0x6f,0xfa,
-0x45,0x16,0x10,0xac,0x72,0x04,0x03,0x19,0x0b,0x31,0xd2,0x0f,0xea,0x68,0x01,0x40,
-0xcf,0x90,0xfa,0x48,0x71,0x0e,0x41,0x65,0xff,0x1f,0xa9,0x3d,0x0c,0x32,0x1a,0xf1,
-0xfa,0xfa,0x02,0x40,0xaf,0x1f,0xa5,0x99,0x33,0x73,0x31,0x5f,0xf1,0xfd,0xa3,0x37,
-0x21,0x9b,0xfa,0x10,0x12,0x09,0xc6,0x6e,0x0f,0x4d,0x00,0x03,0x22,0x30,0x05,0x4d,
-0x00,0x23,0xf7,0x00,0x4d,0x00,0x22,0x70,0x01,0x4d,0x00,0x2f,0x94,0x00,0x4d,0x00,
-0x1e,0x22,0x00,0x00,0x4d,0x00,0x23,0xf0,0x00,0x4d,0x00,0x22,0x00,0x00,0x4d,0x00,
-0x2f,0x90,0x00,0x4d,0x00,0x1d,0x23,0x85,0x00,0x4d,0x00,0x22,0xa0,0x00,0x4d,0x00,
-0x23,0xfa,0x00,0x4d,0x00,0x2f,0x60,0x00,0x4d,0x00,0x1d,0x03,0xba,0x27,0x01,0x58,
-0x6e,0x01,0x4d,0x00,0x02,0x62,0x01,0x13,0xaf,0x11,0x00,0x0e,0x4d,0x00,0x0a,0xda,
-0x1c,0x23,0x5c,0x50,0x95,0x02,0x12,0xfc,0x98,0x18,0x11,0xd0,0x11,0x00,0x10,0x64,
-0xe7,0x8c,0x00,0x42,0x7d,0xf0,0x09,0xf6,0x4e,0x21,0x11,0x11,0x17,0xd3,0x0f,0xff,
-0xec,0xce,0xec,0xcc,0xcc,0xef,0xe1,0x7f,0xe3,0x00,0x2d,0x00,0x00,0x06,0x80,0xd9,
-0x01,0x33,0x97,0x0a,0xa6,0x3c,0x5e,0x04,0x98,0x06,0x2a,0x2f,0xfa,0x36,0x1d,0x10,
-0x10,0x89,0x00,0x00,0x90,0x8a,0xf0,0x2a,0xdf,0xf8,0xcf,0xf8,0x00,0x7f,0xff,0x81,
-0xdf,0xf1,0x0c,0xfa,0xf8,0x52,0xdf,0x60,0xff,0x64,0x78,0x3a,0xf8,0x0f,0xff,0x50,
-0x08,0xff,0xa1,0xff,0xff,0x12,0xff,0xfa,0x0f,0xff,0x41,0x15,0xff,0xa0,0xef,0x46,
-0x88,0x48,0xf8,0x0b,0xfc,0xf8,0x42,0xef,0x50,0x5f,0xff,0x82,0xef,0xf1,0x00,0xaf,
-0xfa,0xd6,0x52,0x60,0x5a,0xdc,0xa4,0x00,0x00,0x01,0x9a,0x8f,0x62,0x78,0x8b,0xff,
-0xfe,0x88,0x82,0x53,0x03,0x10,0x12,0xfc,0x32,0x02,0xa5,0x2c,0xcf,0x90,0x3f,0xfc,
-0xfc,0xfe,0xdf,0x90,0x3f,0xd5,0xf4,0xeb,0x7f,0x06,0x00,0x07,0x42,0xe6,0xf5,0xec,
-0x8f,0xf3,0x3f,0x77,0x80,0x07,0x9a,0xaa,0xaa,0xa9,0x10,0x80,0x74,0x32,0x03,0xef,
-0xa0,0x89,0x06,0x01,0xd5,0x77,0x30,0xc3,0xdf,0xff,0x3b,0x09,0x30,0xfd,0x3d,0xf5,
-0x1a,0x00,0x31,0xff,0xd3,0x50,0x65,0x49,0x02,0x0d,0x00,0x24,0xff,0x60,0x72,0x49,
-0x03,0x0d,0x00,0x12,0x0b,0xc2,0x64,0x12,0x0d,0xf5,0x4f,0x12,0x0f,0x4a,0x7a,0x33,
-0x08,0x86,0x30,0xa8,0x37,0x00,0x73,0x05,0x14,0xb6,0xb8,0x01,0xf0,0x03,0xf2,0x00,
-0xbf,0xff,0xf8,0xbf,0xf6,0xef,0xff,0x40,0xbf,0xff,0xff,0x10,0xa4,0x09,0xff,0xf4,
-0x0a,0x29,0x00,0x27,0x2e,0x11,0x4d,0x6b,0x14,0xf4,0x07,0xbf,0xff,0xf4,0x1d,0xff,
-0xff,0xf4,0x06,0x10,0xbf,0xff,0x40,0x1d,0xff,0xff,0x47,0xfd,0x2b,0xff,0xf4,0x00,
-0x1d,0xb7,0x01,0x23,0x1c,0xff,0x7b,0x2f,0x40,0x99,0x99,0x70,0x00,0x52,0x0d,0x60,
-0x0a,0xd0,0xd0,0xd0,0xeb,0x9f,0x05,0x00,0x51,0xff,0xd1,0xd1,0xd1,0xeb,0x3c,0x3a,
-0x0f,0x05,0x00,0x0b,0x10,0xef,0xc6,0x05,0x43,0x5c,0xdd,0xdd,0xdd,0xfc,0x47,0x31,
-0xb0,0x00,0x03,0x9b,0x4e,0x01,0xac,0x81,0xa2,0x0f,0xf0,0x0a,0xff,0x21,0x11,0x11,
-0x1f,0xf0,0xaf,0x09,0x53,0x02,0x22,0x06,0x46,0xd0,0x08,0xff,0x10,0x74,0x51,0x0d,
-0x02,0x0e,0x11,0x00,0x99,0x3b,0x0f,0x01,0x00,0x56,0x04,0x04,0x4b,0x17,0xf4,0x14,
-0x00,0x51,0xfb,0xfa,0x00,0xfe,0xf7,0xfd,0x27,0x1f,0x01,0x85,0x00,0x53,0x4f,0x02,
-0x04,0x00,0x02,0x69,0x00,0x52,0x2f,0xe3,0x00,0x01,0x00,0x68,0x1f,0xe7,0x71,0x00,
-0x5d,0x13,0xf4,0x8c,0x4a,0x00,0x08,0x75,0x62,0xf4,0xfe,0xf8,0xfc,0x00,0xf1,0xdf,
-0x01,0x7f,0xff,0x00,0x00,0xfe,0xff,0xfb,0xfd,0xde,0x01,0x51,0x3f,0xfd,0x00,0xfe,
-0xcf,0x02,0x57,0x1c,0xfd,0x0a,0x00,0x19,0xff,0x1f,0x00,0x1f,0xfe,0x69,0x01,0x4a,
-0x20,0xfe,0x00,0xf6,0x49,0x5f,0xfe,0x00,0xfe,0xfc,0xfe,0xe8,0x01,0x5d,0x15,0x02,
-0xe2,0x00,0x11,0xfe,0x87,0x00,0x2f,0xfe,0xfd,0x83,0x00,0x4a,0x11,0xe4,0x74,0x48,
-0x15,0xeb,0x77,0x00,0x20,0xfd,0xfe,0x73,0x00,0x01,0x7e,0x00,0x0f,0xea,0x00,0x51,
-0x10,0xfd,0x08,0x00,0x1f,0xfd,0x61,0x01,0x5a,0x1f,0xfe,0x2e,0x04,0x60,0x02,0xdc,
-0x7d,0x09,0xdd,0x02,0x10,0xfd,0x8b,0x00,0x2f,0xfc,0xfa,0x1d,0x05,0x4d,0x00,0xbc,
-0x62,0x67,0xeb,0xfe,0xeb,0xf7,0x00,0xe4,0x29,0x32,0x2f,0xf4,0xfb,0xed,0x00,0x49,
-0x11,0xd7,0x00,0x90,0x13,0xed,0xd5,0x8e,0x20,0xfc,0x00,0x0c,0x0a,0x00,0x0f,0x0a,
-0x0f,0x17,0x06,0x54,0x10,0xfd,0xc4,0x02,0x1f,0xfc,0xe3,0x01,0x5e,0x10,0xfb,0x59,
-0x02,0x0f,0x58,0x01,0x4a,0x09,0x51,0x08,0xc0,0xe6,0xe4,0x00,0x00,0xf4,0xfd,0xea,
-0xfe,0x02,0x00,0x02,0x02,0x59,0x01,0xdf,0xef,0xf7,0x00,0xf7,0xeb,0xf9,0xf8,0x00,
-0xf9,0xf8,0xfb,0xf8,0xfa,0xb2,0x03,0x47,0x66,0xea,0xf0,0x00,0x00,0xf8,0xff,0x11,
-0x00,0x50,0xfb,0xfc,0x00,0x00,0xfb,0xce,0x02,0x1e,0xff,0x82,0x7f,0x0f,0x77,0x00,
-0x38,0x22,0xf1,0xfa,0xdd,0x08,0x04,0xb9,0x2e,0x23,0xfd,0xfd,0xaa,0x04,0x1f,0x00,
-0xd8,0x08,0x4b,0x14,0xf0,0xb8,0x03,0x15,0x01,0xb8,0x03,0x02,0x94,0x05,0x0f,0xbf,
-0x02,0x48,0xf0,0x0a,0x02,0xfb,0xe9,0xf1,0x00,0x00,0xf1,0xfd,0xf6,0xfe,0x02,0xf6,
-0x02,0x02,0x01,0x02,0x00,0x02,0xfa,0xf9,0xfe,0xfc,0xf9,0xfc,0xfa,0x8d,0x06,0x3f,
-0xfe,0xfd,0x02,0x64,0x02,0x4a,0x2a,0x01,0xfd,0x2a,0x05,0x02,0xee,0x00,0x1f,0xfd,
-0x96,0x05,0x52,0x1f,0xfe,0x03,0x06,0x73,0x0f,0x87,0x00,0x47,0x0f,0x47,0x01,0x0a,
-0x1f,0xff,0x73,0x07,0x46,0x1f,0xff,0x22,0x0b,0x63,0x1f,0xff,0x94,0x00,0x63,0x1e,
-0x02,0x87,0x04,0x19,0x02,0xd4,0x01,0x0f,0xa6,0x04,0x43,0x1f,0xf8,0x8d,0x0c,0x69,
-0x0f,0xe2,0x08,0x5e,0x1f,0xf7,0x7f,0x00,0x0b,0x2f,0xfe,0xfe,0x32,0x0a,0x47,0x1c,
-0xee,0x55,0x03,0x30,0xfe,0x02,0x00,0x80,0x64,0x00,0x08,0x07,0x0f,0x01,0x00,0x5c,
-0x1f,0xfd,0x20,0x0b,0x4f,0x1c,0xef,0x5c,0x01,0x2f,0xff,0x01,0x28,0x05,0x51,0x1f,
-0xf3,0xca,0x02,0x77,0x1f,0xfc,0x77,0x00,0x63,0x1f,0xfe,0x6c,0x00,0xc1,0x0f,0x55,
-0x12,0x23,0x0f,0x82,0x01,0x0c,0x0b,0xed,0x03,0x1f,0xfc,0xe6,0x0a,0x35,0x0f,0x38,
-0x13,0x58,0x15,0xfa,0x6d,0x00,0x21,0xfa,0xf6,0x0a,0x00,0x1e,0xf1,0xb8,0x13,0x0e,
-0xf9,0x10,0x03,0x1d,0x01,0x3f,0xfc,0xfc,0xfc,0x54,0x01,0x34,0x1f,0xf8,0xcb,0x01,
-0x6d,0x0f,0x01,0x00,0x44,0x2f,0xf1,0xf6,0xe7,0x00,0x06,0x0f,0x91,0x00,0x49,0x25,
-0xf6,0xf6,0xcf,0xa2,0x0f,0xa2,0x07,0x6a,0x04,0x5d,0x02,0x1f,0x08,0xee,0x00,0x52,
-0x0f,0x1e,0x04,0x5d,0x0a,0x5c,0x02,0x1f,0xf1,0x9e,0x04,0x64,0x1e,0xf4,0x2f,0x04,
-0x0f,0x63,0x02,0x41,0x2b,0xef,0xeb,0xca,0x02,0x02,0x75,0x08,0x1f,0xf1,0x2b,0x04,
-0x11,0x03,0xc1,0x15,0x3f,0xed,0xf1,0xed,0x41,0x03,0x1f,0x1f,0xeb,0xdf,0x09,0x02,
-0x1f,0xf6,0x3c,0x00,0x12,0x03,0x07,0x00,0x2f,0xf1,0xf1,0x81,0x10,0x3b,0x0f,0x30,
-0x03,0x4f,0x0e,0xc9,0x01,0x0f,0x01,0x00,0x5b,0x01,0xb2,0x6d,0x0f,0x66,0x00,0x4e,
-0x1f,0xf8,0x98,0x04,0x63,0x52,0xf6,0xfa,0xfa,0x00,0xfa,0xf9,0x06,0x00,0xd0,0x01,
-0x23,0xf4,0xfc,0x63,0x01,0x10,0xf6,0xf7,0x00,0x1f,0xfc,0xee,0x00,0x48,0x0f,0xed,
-0x08,0x62,0x16,0xf8,0xe9,0x07,0x00,0xee,0x00,0x20,0xfa,0xf8,0x08,0x00,0x3f,0xfe,
-0x00,0xf6,0xaa,0x13,0x50,0x00,0x4d,0x01,0x3f,0xfc,0x02,0x02,0xc8,0x0a,0x5f,0x1f,
-0xfa,0x36,0x0a,0x8a,0x0f,0x6f,0x08,0x49,0x2f,0xf1,0xf6,0x64,0x02,0x62,0x1f,0xf8,
-0x66,0x00,0x5c,0x1f,0xfa,0xd5,0x08,0x58,0x18,0xfa,0xea,0x07,0x01,0x87,0x00,0x2f,
-0xf8,0xfc,0x4f,0x02,0x5b,0x1f,0xfc,0x16,0x0c,0x58,0x0c,0xdc,0x00,0x0f,0x5a,0x10,
-0x5e,0x0f,0xb2,0x0a,0x18,0x1f,0xfc,0x46,0x0c,0x2e,0x0c,0x39,0x11,0x1e,0xfc,0x7b,
-0x0d,0x0f,0x9e,0x06,0x5e,0x0f,0xba,0x0a,0x58,0x0f,0x39,0x0b,0x53,0x2f,0xeb,0xeb,
-0xba,0x01,0x0c,0x17,0xf6,0x8d,0x00,0x18,0xf8,0x1d,0x00,0x32,0xfc,0x00,0xed,0x6d,
-0x03,0x10,0xfc,0x6d,0x0e,0x23,0xf1,0xf6,0x04,0x0a,0x2f,0xf8,0xf4,0x87,0x05,0x35,
-0x00,0x65,0x11,0x06,0x5e,0x03,0x00,0x62,0x04,0x13,0xfc,0xb7,0x06,0x18,0xfc,0xf4,
-0x03,0x1f,0xfa,0xc3,0x06,0x18,0x1f,0xfa,0xfe,0x05,0x63,0x2f,0xf4,0xf4,0x9c,0x06,
-0x33,0x1f,0xfa,0x04,0x0d,0x24,0x0f,0x71,0x06,0x89,0x1e,0xfa,0x16,0x0c,0x0f,0xf7,
-0x00,0x23,0x2f,0xed,0xef,0x81,0x16,0x12,0x26,0xf8,0xf8,0x0a,0x02,0x05,0xaa,0x00,
-0x26,0xf4,0xf6,0x6e,0x03,0x2f,0xef,0xf8,0x6c,0x01,0x1a,0x2f,0xf1,0xef,0xdc,0x01,
-0x1d,0x1e,0x02,0xa1,0x01,0x0f,0xad,0x01,0x1f,0x2f,0xef,0xed,0xfd,0x01,0x21,0x02,
-0x86,0x00,0x44,0xf4,0xf8,0xf8,0xf8,0x75,0x0a,0x24,0xf1,0xfa,0x5d,0x05,0x0f,0x77,
-0x00,0x13,0x1f,0xef,0x61,0x03,0x0e,0x1f,0xfc,0x1c,0x00,0x07,0x05,0x05,0x01,0x3f,
-0xfe,0xf6,0xfa,0xe8,0x18,0x91,0x2f,0xed,0xed,0x6f,0x03,0x27,0x12,0xfc,0x65,0x01,
-0x0f,0xdc,0x01,0x22,0x1f,0xf1,0x56,0x19,0x27,0x0e,0x53,0x02,0x0f,0x1b,0x0b,0x53,
-0x06,0xab,0x14,0x0f,0x51,0x15,0x50,0x05,0xaa,0x00,0x28,0xfc,0xf4,0x5b,0x05,0x1f,
-0xf6,0xe7,0x11,0x5b,0x00,0xbc,0x10,0x1f,0xfa,0xdb,0x12,0x66,0x1f,0xfc,0xce,0x17,
-0x1b,0x1f,0xfe,0xb1,0x0d,0x2e,0x1f,0xfe,0xf9,0x06,0x47,0x0f,0x19,0x06,0x0e,0x1f,
-0xfc,0x77,0x00,0x63,0x0f,0x1b,0x18,0x58,0x1f,0xfa,0x84,0x00,0x27,0x0f,0x4c,0x05,
-0x1a,0x1f,0x04,0x77,0x00,0x36,0x2f,0xf4,0xf6,0xdc,0x01,0x35,0x1f,0xfe,0xca,0x02,
-0x55,0x0f,0x62,0x15,0x29,0x1f,0xfa,0x98,0x16,0x3c,0x0f,0x53,0x02,0x33,0x1f,0xf4,
-0xed,0x0a,0x14,0x1f,0xfa,0x77,0x00,0x3b,0x1f,0xf1,0xee,0x00,0x43,0x0f,0xbc,0x0f,
-0x29,0x1f,0xfc,0xa3,0x18,0x63,0x1f,0xf6,0xda,0x12,0x51,0x1f,0xfc,0x02,0x13,0x57,
-0x12,0xfc,0xe5,0x0d,0x1f,0xfa,0x80,0x00,0x13,0x1f,0xfc,0xe5,0x00,0x4f,0x1f,0x06,
-0xc5,0x0c,0x63,0x1f,0x06,0x78,0x00,0x05,0x1f,0x0a,0xd2,0x01,0x7f,0x0f,0x7b,0x0d,
-0x17,0x1f,0xfc,0x8b,0x23,0x14,0x1e,0xfa,0x2f,0x06,0x0f,0x2f,0x04,0x29,0x0f,0x19,
-0x03,0x44,0x0f,0x77,0x00,0x39,0x0f,0x2c,0x0f,0x46,0x2f,0x04,0x04,0x1a,0x19,0x36,
-0x0f,0x74,0x17,0xa2,0x09,0xa2,0x0b,0x0f,0x41,0x13,0x17,0x2f,0xef,0xef,0xb1,0x01,
-0x27,0x17,0xef,0x21,0x12,0x0f,0xf2,0x11,0x1c,0x1f,0xfc,0x26,0x02,0x3c,0x1f,0xfc,
-0x7b,0x0d,0x40,0x0b,0xd9,0x21,0x4f,0xfc,0xfe,0xfe,0xfe,0x82,0x0a,0x24,0x2f,0xf4,
-0xf8,0xe0,0x23,0x88,0x1f,0xfa,0x3f,0x01,0x0e,0x1f,0xfc,0xe9,0x12,0x63,0x0f,0x8d,
-0x0c,0x3c,0x1f,0xfa,0xf4,0x03,0x09,0x1e,0xfe,0x95,0x0f,0x0f,0x04,0x0d,0x42,0x19,
-0xfc,0x38,0x10,0x17,0xf6,0xd1,0x0f,0x2f,0xfc,0xfa,0x69,0x0e,0x2b,0x2e,0xf4,0xf4,
-0xa1,0x06,0x05,0xc8,0x02,0x28,0xf6,0xf6,0x52,0x01,0x44,0xf4,0xfc,0xfe,0xfe,0x2f,
-0x04,0x26,0xfa,0xf8,0x32,0x04,0x03,0xa2,0x31,0x21,0x02,0x03,0x91,0x06,0x2e,0x04,
-0x05,0xad,0x07,0x03,0x2a,0xda,0x00,0x2b,0xda,0x92,0x0c,0x0c,0x09,0x10,0x11,0x12,
-0x00,0x13,0x0d,0x2f,0xda,0x02,0x60,0x3b,0x70,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,
-0x32,0x4b,0xff,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,
-0x24,0x27,0x28,0xcb,0x00,0x08,0xf0,0x10,0x29,0x2a,0x2b,0x00,0x2c,0x2d,0x2e,0x2f,
-0x30,0x31,0x32,0x00,0x33,0x00,0x34,0x35,0x00,0x00,0x36,0x37,0x38,0x39,0x3a,0x3b,
-0x3c,0x00,0x3d,0x3e,0x3f,0x40,0x41,0x69,0xc7,0xf0,0x2b,0x43,0x44,0x45,0x46,0x47,
-0x48,0x00,0x49,0x31,0x4a,0x00,0x4b,0x4c,0x00,0x00,0x31,0x4d,0x4e,0x4e,0x4f,0x50,
-0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x00,0x5a,0x5b,0x5c,0x5d,0x5e,0x5f,
-0x60,0x61,0x62,0x63,0x64,0x2d,0x65,0x66,0x00,0x67,0x68,0x69,0x6a,0x6a,0x6b,0x00,
-0x6c,0x6d,0x6e,0x00,0x6f,0x61,0x00,0x10,0x70,0x56,0xc0,0x20,0x2d,0x72,0x46,0xbd,
-0x9f,0x74,0x75,0x76,0x77,0x00,0x78,0x79,0x7a,0x00,0x01,0x00,0xff,0x48,0x02,0x46,
-0x02,0x20,0x03,0x02,0x41,0x02,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,
-0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0x20,0x0b,0x00,0x7a,
-0xdc,0x00,0x79,0xdc,0x02,0x06,0xc2,0x72,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x80,
-0x44,0xfe,0x01,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,
-0x00,0x00,0x23,0x73,0x00,0x01,0x51,0x48,0xf1,0x01,0x25,0x26,0x27,0x28,0x00,0x29,
-0x00,0x2a,0x2b,0x2c,0x2d,0x00,0x2a,0x2a,0x00,0x00,0x4e,0x02,0x30,0x33,0x34,0x35,
-0x4a,0x02,0xf3,0x01,0x00,0x3a,0x3b,0x3c,0x3c,0x3d,0x3e,0x00,0x00,0x3f,0x00,0x00,
-0x40,0x41,0x00,0x42,0x4e,0x02,0x91,0x49,0x4a,0x00,0x4b,0x4b,0x00,0x4c,0x4d,0x00,
-0x4b,0x02,0x00,0x4c,0x02,0x01,0x4d,0x02,0x22,0x55,0x43,0x4e,0x02,0x11,0x55,0x4f,
-0x02,0x40,0x00,0x00,0x65,0x66,0x4f,0x02,0x00,0x20,0x42,0x01,0x50,0x02,0x30,0x70,
-0x71,0x72,0xf6,0x51,0x6f,0x74,0x75,0x00,0x00,0x76,0x77,0x40,0x02,0xff,0x43,0x50,
-0x00,0x00,0x00,0x00,0x00,
+0x3e,0xff,0x80,0x02,0x11,0x2d,0x61,0x00,0x10,0x1c,0x4e,0x05,0x10,0x2d,0x38,0x04,
+0xf0,0x10,0x00,0xcf,0xaf,0xd2,0xef,0xf6,0x00,0xfb,0x0d,0xd0,0x2e,0xff,0x60,0xbf,
+0xef,0x80,0x02,0xef,0xf3,0x19,0xc8,0x00,0x00,0x16,0x40,0x00,0x02,0x66,0x66,0x12,
+0x00,0x64,0x00,0xf1,0x01,0x3f,0x40,0x00,0x0c,0xff,0xff,0x3f,0xf2,0xdf,0x6c,0xff,
+0xff,0x53,0x31,0xff,0x7c,0xfe,0x04,0x0f,0x06,0x00,0x0b,0x10,0x7b,0xd3,0x03,0x60,
+0xff,0xc2,0x33,0x33,0x33,0x20,0x00,0x01,0xe2,0x20,0x00,0x8a,0xaa,0xaa,0xa9,0x00,
+0x00,0x49,0x99,0x99,0x99,0x60,0x00,0xc4,0x06,0x10,0xfa,0x02,0x01,0x20,0x80,0xfa,
+0x1c,0x06,0x11,0xf3,0x06,0x00,0x72,0xf5,0xfe,0xaa,0xaa,0xaa,0xff,0xf5,0x0f,0x04,
+0x40,0xff,0xff,0x80,0x4f,0x06,0x00,0x20,0x10,0x0c,0x06,0x00,0x20,0x50,0x1e,0x06,
+0x00,0x51,0xfb,0xef,0xff,0xf5,0x9f,0x70,0x05,0x74,0xcd,0xdd,0xdd,0xdd,0xdd,0xd4,
+0xef,0x3d,0x08,0x05,0x01,0x00,0x7f,0xbc,0xcc,0xcc,0xcc,0xcc,0xc3,0xff,0x18,0x00,
+0x10,0x10,0x6b,0x12,0x00,0x22,0xcb,0x6f,0xfe,0x01,0x02,0x5e,0x07,0x11,0x95,0x0e,
+0x00,0x70,0x65,0xf9,0x3d,0xff,0xff,0xfd,0x39,0x03,0x00,0x20,0xf9,0x3d,0x10,0x00,
+0x11,0xa4,0x17,0x00,0x2c,0xb7,0xbf,0x2b,0x02,0x80,0x55,0x55,0x20,0x00,0x03,0xff,
+0xff,0x90,0x72,0x03,0x10,0x40,0x84,0x01,0x00,0xda,0x03,0x92,0xfc,0x44,0x40,0x0c,
+0xff,0xff,0xff,0xf0,0x0e,0xa0,0x07,0x20,0xff,0xfe,0x45,0x02,0x10,0xf6,0xc9,0x01,
+0x10,0xc0,0xc3,0x06,0x50,0x30,0x00,0x00,0x03,0xfa,0xf4,0x01,0x10,0xf1,0x3e,0x03,
+0x14,0x50,0x9f,0x00,0xb0,0x35,0x6e,0xf7,0x54,0x00,0x00,0xff,0xf9,0x8f,0xff,0x10,
+0x1d,0x01,0x00,0x06,0x00,0xb0,0xfa,0x24,0x44,0x01,0x00,0xff,0xf4,0xef,0xff,0x3e,
+0x20,0x9b,0x06,0x20,0x3f,0xe2,0x06,0x00,0x21,0x43,0x31,0xa7,0x06,0x18,0xf6,0x06,
+0x00,0x30,0x23,0x30,0xff,0xa5,0x07,0x12,0x00,0x06,0x00,0x72,0x7a,0xaa,0xaa,0xa2,
+0x00,0x00,0x03,0xfa,0x09,0x10,0x70,0x6a,0x00,0x31,0xef,0xfa,0x10,0x50,0x06,0x10,
+0xd0,0x80,0x04,0xa0,0xff,0xf7,0x00,0x04,0xff,0xff,0xff,0xfb,0x00,0x07,0x7e,0x07,
+0x20,0x00,0x09,0x6d,0x00,0x20,0x00,0x0d,0x06,0x00,0x20,0x30,0x7f,0x06,0x00,0x12,
+0xd0,0x0b,0x07,0x20,0x13,0x33,0xb9,0x01,0x40,0x00,0x00,0xcf,0xf2,0x48,0x00,0x61,
+0x29,0x50,0x00,0x00,0x5a,0xaa,0x01,0x00,0x12,0x2f,0x03,0x01,0xf8,0x28,0xf9,0xfa,
+0x0d,0x01,0xb0,0xd0,0xa2,0x0f,0xaf,0xeb,0xfb,0xcf,0xbf,0xbe,0xcb,0xfa,0xff,0xe1,
+0x98,0x1c,0x1c,0x15,0xff,0xaf,0xfd,0x08,0x70,0xb0,0xb0,0x3f,0xfa,0xff,0xdf,0xdd,
+0xdd,0xdd,0xfd,0xdf,0xaf,0xa0,0xd0,0x00,0x00,0x0a,0x20,0xfa,0xfe,0xaf,0xaa,0xaa,
+0xaa,0xeb,0xaf,0x9a,0xff,0x80,0x01,0x31,0x41,0x00,0x00,0x9e,0x00,0x10,0xd0,0x09,
+0x03,0x30,0x8f,0xff,0xfc,0x68,0x00,0x60,0xff,0xff,0xff,0x50,0x00,0x03,0x69,0x01,
+0x41,0xe0,0x00,0x3c,0xff,0xae,0x00,0x00,0xdd,0x06,0x00,0x45,0x01,0x12,0x9e,0x10,
+0x08,0x00,0x8f,0x04,0x31,0xff,0xf1,0x00,0x9c,0x04,0x12,0xf9,0xa9,0x04,0x02,0x7f,
+0x03,0x13,0x05,0x0f,0x04,0x22,0x4f,0xf3,0x5f,0x00,0x70,0x76,0x00,0x00,0x00,0x34,
+0x44,0x43,0x4f,0x01,0x20,0xfb,0x8a,0x05,0x00,0xd0,0x8f,0xa0,0xff,0xff,0xfb,0x7f,
+0xf8,0xff,0xff,0xfc,0x11,0x11,0xff,0x98,0x07,0x0f,0x05,0x00,0x10,0x50,0xbd,0xdd,
+0xdd,0xdd,0xd8,0x9f,0x01,0x11,0x54,0xb5,0x04,0xf0,0x2a,0x6c,0xff,0xff,0xff,0xd8,
+0x10,0x00,0x04,0xef,0xff,0xdb,0xbc,0xff,0xff,0x70,0x08,0xff,0xd6,0x10,0x00,0x00,
+0x4b,0xff,0xb0,0xbf,0x70,0x00,0x13,0x32,0x00,0x05,0xed,0x10,0x30,0x06,0xdf,0xff,
+0xfe,0x80,0x01,0x10,0x00,0x0b,0xff,0xfc,0xce,0xff,0xd2,0x00,0x00,0x00,0xbe,0x60,
+0x00,0x04,0xde,0x10,0x23,0x05,0x41,0x03,0x40,0x00,0x10,0x2a,0x06,0x01,0xc6,0x00,
+0x00,0x8b,0x09,0x22,0xfa,0x00,0x06,0x04,0x10,0xac,0x72,0x04,0x03,0x19,0x0b,0x31,
+0xd2,0x0f,0xea,0x68,0x01,0xd0,0xcf,0x90,0xfa,0x48,0x88,0x88,0x88,0x88,0x65,0xff,
+0x1f,0xa9,0xff,0xab,0x01,0x32,0x1a,0xf1,0xfa,0xfa,0x02,0xc0,0xaf,0x1f,0xa5,0x99,
+0x99,0x99,0x99,0x98,0x5f,0xf1,0xfd,0x99,0x01,0x00,0x33,0x9b,0xfa,0x0b,0x98,0x02,
+0x03,0x8b,0x06,0x0f,0x4d,0x00,0x06,0x22,0x30,0x05,0x4d,0x00,0x23,0xf7,0x00,0x4d,
+0x00,0x22,0x70,0x01,0x4d,0x00,0x2f,0x94,0x00,0x4d,0x00,0x1e,0x22,0x00,0x00,0x4d,
+0x00,0x23,0xf0,0x00,0x4d,0x00,0x22,0x00,0x00,0x4d,0x00,0x2f,0x90,0x00,0x4d,0x00,
+0x1d,0x23,0x85,0x00,0x4d,0x00,0x22,0xa0,0x00,0x4d,0x00,0x23,0xfa,0x00,0x4d,0x00,
+0x2f,0x60,0x00,0x4d,0x00,0x1d,0x22,0x00,0x00,0x4d,0x00,0x01,0x0c,0x02,0x00,0x4d,
+0x00,0x02,0x62,0x01,0x13,0xaf,0x11,0x00,0x0f,0x4d,0x00,0x09,0x00,0x01,0x00,0x23,
+0x5c,0x50,0x95,0x02,0x02,0x0e,0x07,0x21,0x03,0xd0,0x11,0x00,0x31,0x64,0x00,0xa5,
+0x56,0x09,0xf0,0x0a,0xbf,0xf6,0x4e,0x21,0x11,0x11,0x17,0xd3,0x0f,0xff,0xec,0xce,
+0xec,0xcc,0xcc,0xef,0xe1,0x7f,0xe3,0x00,0x2d,0x00,0x00,0x06,0x80,0xd9,0x01,0x32,
+0x97,0x0a,0xa6,0x44,0x00,0x14,0xcc,0x98,0x06,0x29,0x2f,0xfa,0x5c,0x00,0x20,0x01,
+0x10,0x89,0x00,0xf2,0x42,0xff,0xe8,0x00,0x00,0xdf,0xf8,0xcf,0xf8,0x00,0x7f,0xff,
+0x81,0xdf,0xf1,0x0c,0xfa,0xf8,0x52,0xdf,0x60,0xff,0x64,0x78,0x3a,0xf8,0x0f,0xff,
+0x50,0x08,0xff,0xa1,0xff,0xff,0x12,0xff,0xfa,0x0f,0xff,0x41,0x15,0xff,0xa0,0xef,
+0x46,0x88,0x48,0xf8,0x0b,0xfc,0xf8,0x42,0xef,0x50,0x5f,0xff,0x82,0xef,0xf1,0x00,
+0xaf,0xfa,0xef,0xf6,0x00,0x00,0x5a,0xdc,0xa4,0x00,0x00,0x01,0x56,0x63,0x00,0x00,
+0x78,0x8b,0xff,0xfe,0x88,0x82,0x53,0x03,0x80,0x12,0x22,0x22,0x22,0x22,0x20,0x3f,
+0xff,0xc9,0x0d,0xbf,0x3f,0xfc,0xfc,0xfe,0xdf,0x90,0x3f,0xd5,0xf4,0xeb,0x7f,0x06,
+0x00,0x07,0x61,0xe6,0xf5,0xec,0x8f,0x90,0x2f,0x54,0x03,0x52,0x07,0x9a,0xaa,0xaa,
+0xa9,0x95,0x07,0x12,0x14,0xf7,0x00,0x22,0xef,0xa0,0x89,0x06,0x10,0xf9,0x0d,0x00,
+0x30,0xc3,0xdf,0xff,0x3b,0x09,0x30,0xfd,0x3d,0xf5,0x1a,0x00,0x40,0xff,0xd3,0x50,
+0x00,0x49,0x06,0x02,0x0d,0x00,0x21,0xff,0x60,0x0d,0x00,0x15,0xf6,0x0d,0x00,0x11,
+0x0b,0x0d,0x00,0x00,0x51,0x04,0x11,0x60,0x88,0x07,0x11,0xf6,0x4b,0x07,0x13,0x86,
+0x66,0x01,0x10,0x8b,0x73,0x05,0x14,0xb6,0xb8,0x01,0xf0,0x0d,0xf2,0x00,0xbf,0xff,
+0xf8,0xbf,0xf6,0xef,0xff,0x40,0xbf,0xff,0xff,0x10,0xa4,0x09,0xff,0xf4,0xaf,0xff,
+0xff,0xfd,0x10,0x07,0xff,0xff,0x4d,0xff,0x21,0x09,0xf4,0x07,0xbf,0xff,0xf4,0x1d,
+0xff,0xff,0xf4,0x06,0x10,0xbf,0xff,0x40,0x1d,0xff,0xff,0x47,0xfd,0x2b,0xff,0xf4,
+0x00,0x1d,0xb7,0x01,0x31,0x1c,0xff,0xff,0xcf,0x06,0x50,0x08,0x99,0x99,0x70,0x00,
+0x52,0x0d,0x60,0x0a,0xd0,0xd0,0xd0,0xeb,0x9f,0x05,0x00,0x60,0xff,0xd1,0xd1,0xd1,
+0xeb,0xff,0xe6,0x04,0x0f,0x05,0x00,0x0b,0x10,0xef,0xc6,0x05,0x52,0x5c,0xdd,0xdd,
+0xdd,0xb2,0x9f,0x00,0x11,0xb0,0x37,0x05,0x20,0x0b,0xf0,0x70,0x08,0xa2,0x00,0x0f,
+0xf0,0x0a,0xff,0x21,0x11,0x11,0x1f,0xf0,0xad,0x00,0x12,0xf0,0x22,0x06,0x42,0xd0,
+0x08,0xff,0x10,0xbe,0x08,0x02,0x07,0x00,0x60,0x01,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const etxFontBlock blocks[] = {
+{ .bitmap_index = 0, .comp_offset = 0, .size = 4038, .comp_size = 3693 },
+{ .bitmap_index = 4038, .comp_offset = 3693, .size = 4090, .comp_size = 3571 },
+{ .bitmap_index = 8128, .comp_offset = 7264, .size = 4066, .comp_size = 3213 },
+{ .bitmap_index = 12194, .comp_offset = 10477, .size = 4092, .comp_size = 3612 },
+{ .bitmap_index = 16286, .comp_offset = 14089, .size = 4082, .comp_size = 3551 },
+{ .bitmap_index = 20368, .comp_offset = 17640, .size = 4058, .comp_size = 3696 },
+{ .bitmap_index = 24426, .comp_offset = 21336, .size = 4040, .comp_size = 3636 },
+{ .bitmap_index = 28466, .comp_offset = 24972, .size = 4041, .comp_size = 3673 },
+{ .bitmap_index = 32507, .comp_offset = 28645, .size = 4014, .comp_size = 3653 },
+{ .bitmap_index = 36521, .comp_offset = 32298, .size = 4037, .comp_size = 2917 },
 };
 
 static const etxFontCmap cmaps[] = {
@@ -2455,11 +2586,11 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 12527, .range_length = 51124, .glyph_id_start = 233, .list_length = 349, .type = 3, .unicode_list = 4801, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[62099] __SDRAMFONTS;
+static uint8_t etxUncompBuf[21541] __SDRAMFONTS;
 
 const etxLz4Font lv_font_jp_bold_STD = {
-.uncomp_size = 61739,
-.comp_size = 39045,
+.uncomp_size = 21181,
+.comp_size = 5668,
 .line_height = 15,
 .base_line = 3,
 .subpx = 0,
@@ -2472,12 +2603,15 @@ const etxLz4Font lv_font_jp_bold_STD = {
 .bitmap_format = 0,
 .left_class_cnt = 122,
 .right_class_cnt = 119,
-.glyph_bitmap = 5499,
-.class_pair_values = 46057,
-.left_class_mapping = 60575,
-.right_class_mapping = 61157,
+.glyph_bitmap = 0,
+.class_pair_values = 5499,
+.left_class_mapping = 20017,
+.right_class_mapping = 20599,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 62099,
+.lvglFontBufSize = 21541,
+.block_count = 10,
+.blocks = blocks,
+.compressed_bitmap = lz4BitmapData,
 };
@@ -199,1182 +199,85 @@ static const uint8_t lz4FontData[] ={
 0x71,0x08,0x00,0x43,0x07,0x00,0x00,0x9f,0x08,0x00,0x13,0xcd,0x08,0x00,0x13,0xfb,
 0x08,0x00,0x22,0x29,0x57,0x08,0x00,0x10,0x57,0x08,0x00,0x52,0x09,0x00,0xff,0x92,
 0x57,0x58,0x00,0x13,0xc4,0x08,0x00,0x22,0xf6,0x57,0xa8,0x00,0x22,0x33,0x58,0xc8,
-0x00,0x22,0x67,0x58,0x60,0x00,0x60,0x93,0x58,0x10,0x0a,0x0b,0x07,0x98,0x13,0xf1,
-0xff,0xff,0xff,0xff,0x1f,0x72,0x1f,0xb5,0x21,0x50,0xab,0x54,0xab,0x58,0xab,0x60,
-0xab,0x62,0xab,0x65,0xab,0x69,0xab,0x6c,0xab,0x81,0xab,0xc0,0xab,0xc4,0xab,0xd0,
-0xab,0xdc,0xab,0xf0,0xab,0xf8,0xab,0xf9,0xab,0x00,0xac,0x0d,0xac,0x14,0xac,0x30,
-0xac,0x31,0xac,0x41,0xac,0x45,0xac,0x4c,0xac,0x50,0xac,0xa0,0xac,0xbc,0xac,0xbd,
-0xac,0xc5,0xac,0xdc,0xac,0x10,0xad,0x2c,0xad,0x30,0xad,0x48,0xad,0x49,0xad,0x4c,
-0xad,0x50,0xad,0x59,0xad,0x80,0xad,0x88,0xad,0x91,0xad,0x9c,0xad,0x0c,0xae,0x08,
-0xaf,0x94,0xaf,0xa4,0xaf,0xad,0xaf,0xe8,0xaf,0xf0,0xaf,0xf8,0xaf,0x04,0xb0,0x58,
-0xb0,0x60,0xb0,0x73,0xb0,0x74,0xb0,0xc8,0xb0,0xe2,0xb0,0x54,0xb1,0x5c,0xb1,0xc4,
-0xb1,0xe0,0xb1,0xe4,0xb1,0xf5,0xb1,0x18,0xb2,0x28,0xb2,0x29,0xb2,0x34,0xb2,0x38,
-0xb2,0x45,0xb2,0x50,0xb2,0xa4,0xb2,0xac,0xb2,0xbe,0xb2,0xc0,0xb2,0xc1,0xb2,0xc4,
-0xb2,0xc8,0xb2,0x14,0xb3,0x15,0xb3,0x29,0xb3,0x68,0xb3,0x6c,0xb3,0x78,0xb3,0xa0,
-0xb3,0xa8,0xb3,0xf4,0xb3,0x10,0xb4,0x18,0xb4,0x2c,0xb4,0x2d,0xb4,0x30,0xb4,0x34,
-0xb4,0x41,0xb4,0x64,0xb4,0x79,0xb4,0x80,0xb4,0x9c,0xb4,0x60,0xb5,0xec,0xb5,0x40,
-0xb6,0xcc,0xb6,0xd0,0xb6,0xdc,0xb6,0xe1,0xb6,0xe8,0xb6,0xe9,0xb6,0x19,0xb7,0x3c,
-0xb7,0x4c,0xb7,0x4d,0xb7,0x58,0xb7,0x59,0xb7,0x5c,0xb7,0x74,0xb7,0x75,0xb7,0x7c,
-0xb7,0xac,0xb7,0xad,0xb7,0xb0,0xb7,0xb4,0xb7,0xbf,0xb7,0x1c,0xb8,0x38,0xb8,0x49,
-0xb8,0xa8,0xb8,0xb8,0xb8,0xc4,0xb8,0xc8,0xb8,0xcc,0xb8,0xd4,0xb8,0xfc,0xb8,0xfd,
-0xb8,0x00,0xb9,0x0c,0xb9,0x0d,0xb9,0x0f,0xb9,0x11,0xb9,0x18,0xb9,0x19,0xb9,0x1c,
-0xb9,0x1e,0xb9,0x20,0xb9,0x2e,0xb9,0x34,0xb9,0x45,0xb9,0x47,0xb9,0x88,0xb9,0x8c,
-0xb9,0x90,0xb9,0xa4,0xb9,0xc4,0xb9,0xd5,0xb9,0xf8,0xb9,0xf9,0xb9,0x0b,0xba,0x84,
-0xba,0x88,0xba,0xfc,0xba,0x48,0xbb,0x49,0xbb,0x50,0xbb,0x5b,0xbb,0x5d,0xbb,0x5f,
-0xbb,0x64,0xbb,0x65,0xbb,0x68,0xbb,0x6c,0xbb,0x6d,0xbb,0x79,0xbb,0x80,0xbb,0x81,
-0xbb,0xd4,0xbb,0xd8,0xbb,0xdc,0xbb,0xe4,0xbb,0xe5,0xbb,0xf0,0xbb,0xf8,0xbb,0x10,
-0xbc,0x14,0xbc,0x44,0xbc,0x45,0xbc,0x48,0xbc,0x4c,0xbc,0x57,0xbc,0xd0,0xbc,0xd4,
-0xbc,0xd8,0xbc,0xe9,0xbc,0x40,0xbd,0x5c,0xbd,0x64,0xbd,0x94,0xbd,0x98,0xbd,0x9c,
-0xbd,0xb0,0xbd,0xb8,0xbd,0xe0,0xbf,0xfc,0xbf,0xfd,0xbf,0x00,0xc0,0x0d,0xc0,0x11,
-0xc0,0x18,0xc0,0x19,0xc0,0x28,0xc0,0x2d,0xc0,0x47,0xc0,0x6c,0xc0,0x6d,0xc0,0x70,
-0xc0,0x74,0xc0,0x81,0xc0,0x88,0xc0,0x89,0xc0,0x8c,0xc0,0x90,0xc0,0x9b,0xc0,0xa8,
-0xc0,0xdc,0xc0,0xdd,0xc0,0xe0,0xc0,0xf1,0xc0,0x30,0xc1,0x68,0xc1,0x6c,0xc1,0x7b,
-0xc1,0xf4,0xc1,0xfc,0xc1,0x05,0xc2,0x09,0xc2,0x2c,0xc2,0x2d,0xc2,0x30,0xc2,0x34,
-0xc2,0x3c,0xc2,0x41,0xc2,0x48,0xc2,0x40,0xc4,0x94,0xc4,0x95,0xc4,0x98,0xc4,0x9a,
-0xc4,0x9c,0xc4,0xa4,0xc4,0xa5,0xc4,0xa9,0xc4,0xae,0xc4,0xc0,0xc4,0xcc,0xc4,0xe1,
-0xc4,0x04,0xc5,0x08,0xc5,0x0c,0xc5,0x15,0xc5,0x16,0xc5,0x18,0xc5,0x20,0xc5,0x28,
-0xc5,0x3c,0xc5,0x3d,0xc5,0x40,0xc5,0x44,0xc5,0x51,0xc5,0x58,0xc5,0x74,0xc5,0x78,
-0xc5,0x7c,0xc5,0x85,0xc5,0x90,0xc5,0x94,0xc5,0xc8,0xc5,0xcc,0xc5,0xe4,0xc5,0xf9,
-0xc5,0x00,0xc6,0x04,0xc6,0x08,0xc6,0x10,0xc6,0x13,0xc6,0x1c,0xc6,0x20,0xc6,0x24,
-0xc6,0x38,0xc6,0x54,0xc6,0x70,0xc6,0x78,0xc6,0x8c,0xc6,0x90,0xc6,0x94,0xc6,0x9c,
-0xc6,0xa1,0xc6,0xa8,0xc6,0xc4,0xc6,0xc5,0xc6,0xc8,0xc6,0xcc,0xc6,0xcd,0xc6,0xd4,
-0xc6,0xd5,0xc6,0xd8,0xc6,0xe0,0xc6,0xe1,0xc6,0xe4,0xc6,0xe8,0xc6,0xf5,0xc6,0xfc,
-0xc6,0xfd,0xc6,0x50,0xc7,0x51,0xc7,0x54,0xc7,0x58,0xc7,0x60,0xc7,0x61,0xc7,0x65,
-0xc7,0x6c,0xc7,0x7f,0xc7,0x88,0xc7,0xc0,0xc7,0xc1,0xc7,0xc4,0xc7,0xd5,0xc7,0xdc,
-0xc7,0x4c,0xc8,0x50,0xc8,0x61,0xc8,0xd9,0xc8,0xe0,0xc8,0xed,0xc8,0x10,0xc9,0x11,
-0xc9,0x14,0xc9,0x20,0xc9,0x21,0xc9,0x2c,0xc9,0x48,0xc9,0x49,0xc9,0x0d,0xca,0x5d,
-0xcb,0x78,0xcb,0x88,0xcb,0x8c,0xcb,0x8e,0xcb,0x94,0xcb,0xfb,0xcb,0xfd,0xcb,0x04,
-0xcc,0x58,0xcc,0xac,0xcc,0xe4,0xcc,0xe5,0xcc,0xe8,0xcc,0xec,0xcc,0xf9,0xcc,0x38,
-0xcd,0x71,0xcd,0xa8,0xcd,0xbd,0xcd,0xc4,0xcd,0xe0,0xcd,0x34,0xce,0x38,0xce,0x3c,
-0xce,0x44,0xce,0x47,0xce,0x50,0xce,0x6c,0xce,0x7c,0xce,0xa4,0xce,0xac,0xce,0xbc,
-0xcf,0xc4,0xcf,0xcc,0xcf,0xf4,0xcf,0xfc,0xcf,0x10,0xd0,0x18,0xd0,0x20,0xd0,0x2c,
-0xd0,0x2d,0xd0,0x3d,0xd0,0x80,0xd0,0x84,0xd0,0x88,0xd0,0x90,0xd0,0x9c,0xd0,0x9d,
-0xd0,0xa0,0xd0,0xa4,0xd0,0xac,0xd0,0xf0,0xd0,0xf4,0xd0,0x05,0xd1,0x7c,0xd1,0x08,
-0xd2,0x09,0xd2,0x0c,0xd2,0x10,0xd2,0x40,0xd2,0x41,0xd2,0x5c,0xd2,0x6d,0xd2,0x78,
-0xd2,0xd4,0xd2,0xdc,0xd2,0xe8,0xd2,0xe9,0xd2,0x08,0xd3,0x19,0xd3,0x3c,0xd3,0x44,
-0xd3,0xac,0xd3,0xc8,0xd3,0x54,0xd4,0x5c,0xd4,0x8c,0xd4,0x90,0xd4,0x94,0xd4,0xa1,
-0xd4,0xa8,0xd4,0xa9,0xd4,0xac,0xd4,0xb0,0xd4,0xb8,0xd4,0xb9,0xd4,0xbd,0xd4,0xc4,
-0xd4,0xd9,0xd4,0xf5,0xd4,0x18,0xd5,0x28,0xd5,0x2d,0xd5,0x3c,0xd5,0x54,0xd5,0x65,
-0xd5,0x88,0xd5,0x90,0xd5,0x9d,0xd5,0xa4,0xd5,0xa5,0xd5,0xa8,0xd5,0xac,0xd5,0xb9,
-0xd5,0xdc,0xd5,0xf8,0xd5,0x14,0xd6,0x70,0xd6,0x84,0xd6,0xc0,0xd6,0xd8,0xd6,0x51,
-0xef,0x58,0xef,0x5b,0xef,0x5c,0xef,0x5d,0xef,0x61,0xef,0x63,0xef,0x65,0xef,0x69,
-0xef,0x6c,0xef,0x71,0xef,0x76,0xef,0x77,0xef,0x78,0xef,0x8e,0xef,0x93,0xef,0x98,
-0xef,0x9b,0xef,0x9c,0xef,0x9d,0xef,0xa1,0xef,0xa2,0xef,0xa3,0xef,0xa4,0xef,0xb7,
-0xef,0xb8,0xef,0xbe,0xef,0xc0,0xef,0xc1,0xef,0xc4,0xef,0xc7,0xef,0xc8,0xef,0xc9,
-0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,0x15,0xf0,0x17,0xf0,0x19,0xf0,0x30,
-0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,0x74,0xf0,0xab,0xf0,0x3b,0xf1,0x90,
-0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,0x54,
-0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x2c,0x2b,0x2b,0x2b,0x2b,0x17,0x00,0x2b,0x55,
-0xa5,0x59,0x32,0x60,0x00,0x55,0x55,0x00,0x08,0x29,0x20,0x0c,0xec,0xec,0x00,0x0b,
-0x0b,0x00,0x00,0xa0,0xa0,0x05,0xce,0xcd,0x80,0x05,0x56,0x50,0x00,0x82,0x92,0xc7,
-0x17,0xf0,0x85,0x74,0x00,0x05,0xdc,0x30,0x1d,0x14,0xd0,0x2c,0x00,0x80,0x0b,0xa3,
-0x00,0x00,0x5c,0x70,0x23,0x00,0xd0,0x4b,0x01,0xe0,0x09,0xed,0x50,0x00,0x83,0x00,
-0x1b,0xb1,0x00,0x07,0x45,0x63,0x70,0x64,0x55,0xa0,0x01,0xa9,0x65,0x00,0x00,0x0a,
-0x6a,0x40,0x08,0x3b,0x0b,0x01,0x90,0xb0,0xb0,0x00,0x08,0xa6,0x05,0xdc,0x10,0x00,
-0xd1,0x67,0x00,0x0c,0x3a,0x40,0x00,0x5f,0x70,0x00,0x1d,0xa9,0x07,0x07,0x80,0xc8,
-0x90,0x59,0x02,0xf4,0x00,0x9b,0xc9,0xc0,0x73,0x73,0x41,0x00,0x71,0x04,0x90,0x0b,
-0x10,0x1c,0x00,0x4a,0x00,0x59,0x00,0x49,0x00,0x2b,0x00,0x0d,0x00,0x09,0x40,0x01,
-0xb0,0x00,0x21,0x81,0x03,0xa0,0x0b,0x20,0x67,0x04,0xa0,0x2b,0x03,0xb0,0x49,0x08,
-0x50,0xc0,0x76,0x03,0x00,0x03,0x80,0x07,0x69,0x80,0x3b,0xe5,0x01,0xca,0x30,0x13,
-0x13,0x00,0x00,0x83,0x00,0x00,0xa4,0x03,0x00,0x32,0x9f,0xff,0xf3,0x09,0x00,0xf6,
-0x28,0x67,0x85,0x70,0xad,0x70,0x01,0x3b,0x00,0x1a,0x00,0x74,0x00,0xb0,0x02,0x90,
-0x08,0x40,0x0c,0x00,0x38,0x00,0x83,0x00,0x60,0x00,0x08,0xdc,0x30,0x2c,0x03,0xc0,
-0x58,0x00,0xe0,0x67,0x00,0xd0,0x67,0x00,0xd0,0x58,0x00,0xe0,0x2c,0x03,0xb0,0x07,
-0xdc,0x30,0x03,0x98,0x2b,0x99,0x00,0x59,0x02,0x00,0xf0,0x6e,0x09,0xdd,0x30,0x5a,
-0x03,0xc0,0x32,0x01,0xd0,0x00,0x07,0x80,0x00,0x3c,0x00,0x01,0xd2,0x00,0x0b,0x40,
-0x00,0x6f,0xdd,0xd3,0x0a,0xdd,0x35,0x80,0x2c,0x00,0x04,0xb0,0x1d,0xf2,0x00,0x04,
-0xb2,0x20,0x0e,0x5a,0x03,0xc0,0xad,0xc2,0x00,0x0d,0x60,0x00,0x7e,0x60,0x01,0xc8,
-0x60,0x0a,0x38,0x60,0x4a,0x08,0x60,0xad,0xde,0xe5,0x00,0x08,0x60,0x00,0x08,0x60,
-0x0a,0xff,0xf0,0x0c,0x10,0x00,0x0d,0x00,0x00,0x0e,0xdd,0x50,0x04,0x02,0xe0,0x00,
-0x00,0xb2,0x1c,0x00,0xd1,0x06,0xdd,0x60,0x01,0xae,0x10,0x0b,0x80,0x00,0x1d,0x00,
-0x00,0x4c,0xcd,0x40,0x5d,0x12,0xe0,0x49,0x00,0xc1,0x1d,0x01,0xd0,0x05,0xdd,0x40,
-0x8d,0xdd,0xf2,0x00,0x01,0xc0,0x00,0x07,0x60,0x34,0x00,0x70,0x49,0x00,0x00,0xb3,
-0x00,0x01,0xd0,0x4a,0x00,0xf0,0x5b,0x09,0xdd,0x40,0x3c,0x02,0xd0,0x2c,0x03,0xc0,
-0x09,0xef,0x30,0x3c,0x03,0xc0,0x67,0x00,0xd0,0x4b,0x02,0xd0,0x08,0xdd,0x40,0x09,
-0xdc,0x15,0xa0,0x5a,0x76,0x00,0xd4,0xb0,0x4f,0x08,0xd8,0xe0,0x00,0x3c,0x00,0x0b,
-0x60,0x7e,0x70,0x3a,0x01,0x00,0x00,0x01,0x3a,0x58,0x01,0x00,0x00,0x12,0x58,0x84,
-0x30,0x00,0x18,0x40,0x8d,0x70,0x9c,0x10,0x00,0x7d,0x81,0x00,0x08,0x40,0x3e,0xee,
-0xb0,0x00,0x00,0x3e,0xee,0xb0,0x49,0x10,0x00,0x6d,0x91,0x00,0x0a,0xc1,0x7d,0x81,
-0x48,0x10,0x00,0x1c,0xea,0x08,0x60,0xb3,0x00,0x0a,0x30,0x04,0xc0,0x00,0xd1,0x00,
-0x27,0xdc,0x01,0xf0,0x7c,0x3a,0x00,0x00,0x3b,0xbb,0x80,0x00,0x3a,0x00,0x04,0x90,
-0x0b,0x02,0xba,0x18,0x22,0x80,0xb1,0x92,0x35,0x55,0x1a,0x0a,0x12,0x76,0x44,0x80,
-0xb0,0x36,0x56,0x38,0x0d,0x07,0x31,0xa0,0xb9,0x7a,0x80,0x09,0x50,0x00,0x00,0x00,
-0x07,0xba,0xa0,0x00,0x00,0x5d,0x00,0x00,0x0a,0xd2,0x00,0x00,0xd5,0x80,0x00,0x59,
-0x0d,0x00,0x0a,0x30,0xb3,0x00,0xfd,0xde,0x80,0x59,0x00,0x1d,0x0b,0x40,0x00,0xb3,
-0x2f,0xdd,0xb0,0x2c,0x00,0x96,0x2c,0x00,0xa5,0x2f,0xde,0xc0,0x2c,0x00,0x97,0x2c,
-0x00,0x5a,0x2c,0x00,0x97,0x2f,0xdd,0xa0,0x03,0xcd,0xb2,0x00,0xd3,0x05,0xb0,0x4a,
-0x00,0x09,0x06,0x80,0x00,0x00,0x68,0x00,0x00,0x04,0xa0,0x00,0x80,0x0d,0x30,0x5b,
-0x00,0x3c,0xdb,0x10,0x2f,0xed,0x70,0x2c,0x00,0xb6,0x2c,0x00,0x2c,0x2c,0x00,0x0e,
-0x03,0x00,0x00,0x09,0x00,0xd1,0xb6,0x2f,0xde,0x70,0x2f,0xdd,0xd4,0x2c,0x00,0x00,
-0x2c,0x00,0x00,0x55,0x00,0x14,0x00,0x0c,0x00,0x47,0xd4,0x2f,0xdd,0xd3,0x0f,0x00,
-0x15,0xa0,0x0c,0x00,0xa1,0x03,0xcd,0xc2,0x00,0xd3,0x04,0xc0,0x4b,0x00,0x06,0x64,
-0x00,0xf0,0x05,0x06,0xde,0x14,0xb0,0x00,0xd1,0x0d,0x40,0x1e,0x10,0x2c,0xed,0x60,
-0x2c,0x00,0x0a,0x42,0xc0,0x00,0xa4,0x07,0x00,0x36,0xfd,0xdd,0xf4,0x0e,0x00,0x00,
-0x07,0x00,0x13,0x1d,0x01,0x00,0x53,0x00,0x03,0xc0,0x00,0x3c,0x05,0x00,0xf5,0x15,
-0xc3,0x00,0x3b,0x96,0x07,0x91,0xcd,0xb1,0x2c,0x00,0x7a,0x02,0xc0,0x4d,0x00,0x2c,
-0x2d,0x20,0x02,0xcd,0x60,0x00,0x2f,0xad,0x00,0x02,0xc0,0x89,0x00,0x2c,0x00,0xd4,
-0x02,0xc0,0x03,0xd0,0x79,0x00,0x08,0x03,0x00,0xf1,0x52,0x2f,0xdd,0xd1,0x2f,0x30,
-0x00,0x7e,0x2f,0x90,0x00,0xde,0x2b,0xd0,0x03,0xbe,0x2b,0x94,0x09,0x5e,0x2c,0x4a,
-0x0d,0x0e,0x2c,0x0d,0x59,0x0e,0x2c,0x08,0xe4,0x0e,0x2c,0x02,0xe0,0x0e,0x2f,0x10,
-0x0a,0x42,0xfa,0x00,0xa4,0x2c,0xd3,0x0a,0x42,0xc4,0xc0,0xa4,0x2c,0x0b,0x6a,0x42,
-0xc0,0x2e,0xb4,0x2c,0x00,0x8f,0x42,0xc0,0x00,0xe4,0x02,0xce,0xb1,0x00,0xd4,0x05,
-0xc0,0x4b,0x00,0x0d,0x26,0x80,0x00,0xa4,0x68,0x00,0x0a,0x44,0xb0,0x00,0xd2,0x0d,
-0x40,0x5c,0x00,0x2c,0xeb,0x10,0x2f,0xed,0xc2,0x2c,0x00,0x5b,0x22,0x01,0x46,0x5b,
-0x2f,0xdd,0xb2,0xf8,0x00,0xf1,0x16,0xce,0xb1,0x00,0xd3,0x06,0xb0,0x4a,0x00,0x0d,
-0x17,0x70,0x00,0xb3,0x77,0x00,0x0b,0x35,0xa0,0x00,0xd1,0x0d,0x30,0x6b,0x00,0x3c,
-0xef,0x40,0x00,0x00,0x4d,0x10,0x00,0x00,0x00,0x2f,0xee,0xa0,0x8e,0x01,0xfe,0x1f,
-0x4a,0x2c,0x00,0xa7,0x2f,0xde,0xa0,0x2c,0x04,0xb0,0x2c,0x00,0xc3,0x2c,0x00,0x4b,
-0x07,0xdd,0x80,0x3c,0x00,0xb5,0x5b,0x00,0x22,0x0b,0xb5,0x00,0x00,0x3a,0xd1,0x32,
-0x00,0x87,0x6a,0x00,0x96,0x08,0xdd,0xa0,0xad,0xee,0xda,0x00,0x77,0x00,0x03,0x00,
-0x38,0x59,0x00,0x1d,0x03,0x00,0xf0,0x45,0x4a,0x00,0x2c,0x1d,0x10,0x79,0x05,0xde,
-0xa1,0xb4,0x00,0x0e,0x15,0x90,0x04,0xb0,0x1e,0x00,0x96,0x00,0xb3,0x0d,0x10,0x06,
-0x83,0xb0,0x00,0x1d,0x86,0x00,0x00,0xbe,0x10,0x00,0x06,0xc0,0x00,0x95,0x00,0xf0,
-0x06,0x86,0x80,0x4f,0x40,0x95,0x2b,0x08,0x98,0x0c,0x10,0xe0,0xc1,0xb0,0xd0,0x0b,
-0x3c,0x0c,0x3a,0x00,0x89,0x80,0x89,0x70,0x04,0xf4,0x04,0xf4,0x00,0x1f,0x00,0x0f,
-0x00,0x6b,0x00,0x7a,0x0d,0x41,0xe2,0x04,0xd9,0x80,0x00,0xbe,0x37,0x00,0xf6,0x08,
-0x04,0xc8,0x90,0x0d,0x30,0xe2,0x6a,0x00,0x6b,0xa5,0x00,0x6a,0x3d,0x00,0xd2,0x0b,
-0x45,0xb0,0x03,0xcc,0x30,0x00,0xbb,0x88,0x00,0xf6,0x0e,0x7d,0xdd,0xf6,0x00,0x01,
-0xe1,0x00,0x0b,0x50,0x00,0x4c,0x00,0x00,0xd2,0x00,0x08,0x80,0x00,0x2d,0x00,0x00,
-0x9f,0xdd,0xd8,0x4d,0x74,0xa0,0x4a,0x04,0x03,0x00,0x60,0x4e,0x70,0xa3,0x00,0x04,
-0x90,0x5c,0x03,0x40,0x94,0x00,0x03,0xa0,0x08,0x00,0x94,0x85,0x00,0x02,0xa0,0x00,
-0x06,0x00,0xcc,0x0e,0x01,0x00,0xf4,0x63,0xcc,0x06,0x90,0x0c,0xc0,0x2a,0x84,0x85,
-0x2a,0xdd,0xdd,0x60,0x44,0x00,0xc1,0x09,0xdc,0x22,0x60,0x4a,0x07,0xbc,0xb5,0xa0,
-0x3b,0x69,0x07,0xb0,0xcd,0x9b,0x59,0x00,0x00,0x59,0x00,0x00,0x5c,0xcd,0x40,0x5c,
-0x02,0xd0,0x59,0x00,0xc1,0x59,0x00,0xc1,0x5c,0x02,0xd0,0x5b,0xce,0x40,0x08,0xdc,
-0x34,0xb0,0x2c,0x86,0x00,0x17,0x60,0x00,0x4b,0x02,0xb0,0x8d,0xc2,0x00,0x00,0xe0,
-0x00,0x0e,0x09,0xda,0xe4,0xb0,0x2e,0x76,0x00,0xe7,0x60,0x0e,0x4b,0x02,0xe0,0x9c,
-0xae,0x07,0xdc,0x33,0xa0,0x2c,0x7e,0xdd,0xd7,0x70,0x00,0x4c,0x01,0x60,0x8d,0xd4,
-0x03,0xd6,0x0c,0x30,0x0d,0x00,0x8f,0xc1,0x0e,0x00,0x02,0x00,0x43,0x09,0xda,0xe4,
-0xc0,0x30,0x00,0xf1,0x09,0x03,0xe0,0x9e,0xae,0x03,0x03,0xc0,0x9d,0xc3,0x59,0x00,
-0x05,0x90,0x00,0x5b,0xbe,0x45,0xc0,0x3c,0x59,0x01,0xd5,0x90,0x1d,0x05,0x00,0x31,
-0x3a,0x00,0x3a,0x01,0x00,0x62,0x04,0x90,0x00,0x04,0x90,0x49,0x03,0x00,0x32,0x05,
-0x94,0xe4,0x9b,0x00,0xf3,0x04,0x59,0x0b,0x60,0x59,0x89,0x00,0x5d,0xe0,0x00,0x5d,
-0xb6,0x00,0x59,0x1d,0x10,0x59,0x05,0xb0,0x3a,0x01,0x00,0xf5,0x03,0x5b,0xcd,0x5b,
-0xe8,0x05,0xb0,0x3f,0x10,0xe0,0x59,0x01,0xd0,0x0d,0x15,0x90,0x1d,0x00,0xd1,0x09,
-0x00,0x0b,0x61,0x00,0xf6,0x08,0x07,0xdd,0x40,0x4c,0x02,0xd0,0x86,0x00,0xb2,0x76,
-0x00,0xb3,0x3c,0x01,0xe0,0x07,0xdd,0x40,0x5c,0xbd,0x40,0x5b,0x01,0xf1,0x00,0x32,
-0x5c,0xcd,0x40,0x6e,0x00,0x36,0x09,0xda,0xd4,0xe3,0x00,0x21,0x9d,0xae,0xf7,0x00,
-0x55,0x00,0x00,0x5c,0xd3,0x5c,0x46,0x05,0xf6,0x0c,0x0a,0xdc,0x14,0xa0,0x56,0x1d,
-0x82,0x00,0x05,0xc5,0x67,0x05,0x90,0xad,0xc2,0x07,0x00,0xe0,0xbf,0xa0,0xe0,0x0e,
-0x00,0xe0,0x0e,0x00,0xac,0x71,0x00,0xf4,0x66,0x3b,0x04,0xd0,0xbd,0xad,0xb3,0x06,
-0x75,0x80,0xb2,0x1c,0x0d,0x00,0xb6,0x80,0x06,0xe3,0x00,0x1e,0x00,0xa3,0x0c,0x30,
-0xb2,0x67,0x0e,0x80,0xd0,0x2b,0x47,0xc3,0xa0,0x0d,0x92,0xb8,0x60,0x0a,0xd0,0x6f,
-0x20,0x06,0x90,0x2e,0x00,0x79,0x0a,0x60,0xd5,0xc0,0x04,0xf3,0x00,0x5f,0x40,0x0d,
-0x3d,0x08,0x80,0x97,0xb3,0x08,0x76,0x80,0xc2,0x1d,0x1c,0x00,0xb7,0x70,0x06,0xf2,
-0x00,0x1d,0x00,0x06,0x70,0x08,0xd1,0x00,0x7d,0xdf,0x70,0x02,0xd0,0x00,0xb4,0x00,
-0x6a,0x00,0x1d,0x10,0x08,0xed,0xd8,0x00,0x82,0x06,0x80,0x0a,0x40,0x0a,0x30,0x0c,
-0x10,0xaa,0x00,0x0c,0x10,0x0a,0x30,0x0a,0x40,0x06,0x80,0x00,0x82,0x29,0x01,0x00,
-0xf5,0x6f,0x14,0x82,0x00,0x2c,0x00,0x0e,0x00,0x0d,0x00,0x0b,0x30,0x04,0xf0,0x0b,
-0x20,0x0d,0x00,0x0e,0x00,0x2c,0x00,0x82,0x00,0x0b,0xd6,0x0b,0x13,0x70,0x9e,0x80,
-0x00,0x00,0xa3,0x00,0x00,0x00,0x0d,0xd3,0x00,0xed,0xdd,0xc2,0xd3,0x0d,0x00,0x00,
-0x02,0xd2,0xd0,0x00,0x00,0x4c,0x1c,0xdd,0xde,0x3d,0x10,0x00,0x00,0xdd,0x10,0x00,
-0x00,0x08,0x20,0x00,0x00,0x02,0xb0,0x00,0x00,0x02,0xde,0x00,0x00,0x02,0xd3,0xad,
-0xdd,0xe2,0xd3,0x00,0x00,0x0d,0x1d,0x50,0x00,0x00,0xd0,0x1c,0x5c,0xdd,0xdc,0x00,
-0x1c,0xf0,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x01,0x10,0x00,0x00,0x2d,0xd2,0x00,
-0x02,0xd3,0x3d,0x20,0x2d,0x30,0x03,0xd2,0x8d,0xe0,0x0e,0xd8,0x00,0xd0,0x0d,0x00,
-0x04,0x00,0xb8,0xdd,0xdd,0x00,0x00,0x11,0x11,0x00,0x00,0xdb,0xbd,0x00,0x18,0x00,
-0xf3,0x00,0xaf,0xc0,0x0c,0xfa,0x1c,0x50,0x05,0xc1,0x01,0xc5,0x5c,0x10,0x00,0x1c,
-0xc1,0x4c,0x1f,0x40,0x22,0x00,0x00,0x00,0xff,0x02,0xf1,0x0f,0x00,0x03,0xee,0x30,
-0x00,0x00,0x0c,0x77,0xb0,0x00,0x00,0x4e,0x00,0xe4,0x00,0x00,0xc5,0x00,0x6c,0x00,
-0x05,0xe2,0x22,0x2e,0x50,0x0d,0xff,0xff,0xff,0xd0,0x2b,0x00,0xf1,0x10,0x01,0x4d,
-0xd3,0x05,0xd8,0xc3,0x4b,0x3d,0x10,0xff,0xf5,0xa5,0x02,0xfe,0x78,0xb2,0x05,0x90,
-0x2b,0x96,0x00,0x00,0x69,0x2d,0x30,0x03,0xd1,0x03,0xcd,0xdc,0x30,0x98,0x00,0xf0,
-0x1f,0x08,0xcc,0x61,0x00,0x01,0xd3,0xee,0x3d,0x10,0x0b,0x70,0x44,0x07,0xb0,0x1a,
-0x20,0x00,0x01,0xc1,0x1a,0x10,0x00,0x01,0xb1,0x0b,0x50,0x00,0x05,0x90,0x04,0xc5,
-0x00,0x5a,0x60,0x00,0x4a,0xec,0x95,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x10,0x77,
-0x00,0xf0,0x17,0xeb,0xcd,0x91,0x00,0x1e,0x29,0xb1,0x4d,0x30,0x0c,0x90,0xb7,0x02,
-0xc0,0x0d,0x9c,0xc1,0x00,0xc2,0x0d,0x05,0x10,0x00,0xb3,0x0a,0x50,0x00,0x01,0xd0,
-0x02,0xd3,0x00,0x1b,0x50,0x00,0x2b,0xdd,0xd5,0x7f,0x00,0x10,0x00,0xd7,0x00,0xf2,
-0x11,0x10,0x00,0xef,0xff,0xf4,0x03,0xe0,0x00,0xd0,0x07,0x90,0x08,0x70,0x06,0xc0,
-0x97,0x00,0x4c,0xc5,0xd0,0x00,0x94,0x97,0xb2,0x00,0x77,0x00,0xd0,0x00,0x0b,0xcd,
-0x50,0x56,0x00,0xf0,0x10,0x04,0x43,0x00,0x00,0x0f,0xfc,0x00,0x1c,0x98,0x88,0x88,
-0x18,0x02,0x22,0x09,0x18,0x3b,0xba,0x09,0x08,0x15,0x54,0x09,0x08,0x27,0x76,0x09,
-0x0c,0x99,0x99,0x88,0x1c,0x00,0x31,0x00,0x02,0x21,0xd6,0x00,0xf2,0x39,0x20,0x04,
-0xcf,0xf8,0xb8,0x6f,0x71,0x32,0x91,0xb9,0x00,0x00,0x90,0x05,0xa0,0x00,0x90,0x09,
-0x50,0x00,0x92,0xd4,0x00,0x00,0xb9,0x9d,0x30,0x00,0x30,0x08,0xfe,0xfa,0x00,0x00,
-0x13,0x30,0x14,0x44,0x44,0x41,0x85,0xf8,0x44,0x58,0x90,0x62,0x7e,0xf8,0x91,0xf6,
-0x4d,0xf8,0x90,0x62,0x00,0x08,0x91,0xf6,0x00,0x08,0x90,0x83,0x00,0x08,0x90,0xe6,
-0x00,0x08,0x89,0xfc,0x99,0x98,0x4f,0x01,0xf2,0x17,0x3b,0xee,0xb2,0x00,0x04,0xd3,
-0x99,0x3d,0x40,0x0d,0x20,0x99,0x02,0xd0,0x1c,0x00,0x76,0x20,0xc2,0x1b,0x1a,0x97,
-0xa7,0xc2,0x0c,0xa9,0x51,0x8a,0xd0,0x03,0xf6,0x00,0x3d,0x30,0x00,0x2a,0xee,0xa2,
-0x2c,0x00,0xf1,0x1e,0x03,0xdd,0x90,0x00,0x00,0x0d,0x20,0x86,0x02,0x00,0x0d,0x00,
-0x49,0xef,0xa0,0x09,0x84,0xc9,0xff,0xf0,0x00,0xde,0xeb,0xff,0xb0,0x09,0x55,0xff,
-0xff,0x70,0x0c,0x1f,0xff,0xff,0xe0,0x0e,0xdf,0xff,0xff,0xf0,0x00,0x01,0x22,0x22,
-0x10,0xff,0x00,0x10,0x0a,0x28,0x07,0xf0,0x0d,0xa5,0x00,0x9a,0xa9,0x9f,0x60,0x89,
-0x99,0x99,0x92,0x2e,0xff,0xff,0xfe,0x02,0xd6,0x44,0x44,0x00,0x2c,0x20,0x00,0x00,
-0x01,0x90,0x00,0x00,0x00,0xd3,0x00,0xf0,0x15,0x05,0x8a,0x50,0x00,0x00,0x8a,0x76,
-0x70,0x00,0x08,0x63,0x70,0x00,0x15,0x58,0x50,0x00,0x4d,0x21,0x7a,0x00,0x0e,0x88,
-0xf1,0xf5,0x00,0x9b,0x49,0x2f,0x20,0x00,0x89,0x79,0x30,0x00,0x00,0x46,0x08,0xf3,
-0x01,0xea,0x00,0xd0,0x09,0x6a,0x0d,0x00,0x69,0xc2,0xd0,0x00,0x0a,0x2d,0x00,0x00,
-0xa2,0x07,0x00,0x42,0xed,0xdd,0xde,0x10,0xa0,0x00,0x30,0x3a,0x89,0x00,0x46,0x20,
-0x20,0xaa,0x30,0x5b,0x00,0xf1,0x0e,0xa0,0x09,0x24,0x8c,0xd3,0x90,0x08,0x18,0x66,
-0x00,0x91,0x08,0x00,0x9f,0x10,0x26,0x08,0x20,0x67,0x30,0x45,0x00,0x88,0x89,0x99,
-0x80,0x00,0x00,0x00,0x52,0x00,0xf5,0x0d,0xe2,0x40,0x00,0x00,0x01,0xf4,0xc0,0x00,
-0x7d,0x7d,0x8d,0x20,0x03,0xb0,0x2e,0x1c,0x20,0x08,0x40,0x06,0xf8,0x00,0x0b,0x00,
-0x00,0xe2,0x00,0x0c,0x05,0x00,0x01,0x01,0x00,0xf0,0x1d,0x0a,0x80,0x55,0x91,0x1a,
-0x90,0x04,0x14,0xf9,0x2e,0x70,0x02,0x00,0x00,0x1a,0xb5,0x00,0x00,0x09,0xe0,0x08,
-0xc8,0x10,0x15,0x00,0x00,0x1c,0xcc,0xb0,0x00,0x00,0x06,0x00,0x58,0x8c,0x0a,0x00,
-0x00,0x0a,0x0a,0x00,0x00,0x55,0x0a,0x7a,0x00,0xa5,0x96,0x09,0x20,0x09,0x00,0x74,
-0x00,0x09,0x00,0x00,0x04,0x00,0xf0,0x10,0x02,0x00,0x01,0x21,0x06,0x00,0x37,0x6c,
-0x0a,0x00,0x00,0x19,0x0a,0x00,0x00,0xa1,0x0a,0x95,0x09,0x30,0x0a,0x00,0x61,0x00,
-0x0a,0x00,0x07,0x00,0x08,0x00,0x09,0x8a,0x02,0xf0,0x19,0x98,0x88,0x10,0x00,0x11,
-0x10,0x00,0x13,0x43,0x07,0x00,0x25,0x4c,0x0a,0x00,0x00,0x47,0x0a,0xa5,0x02,0xa0,
-0x0a,0x00,0x68,0x00,0x09,0x00,0x03,0x55,0x55,0x00,0x02,0x44,0x4b,0x00,0x07,0xaa,
-0xab,0x00,0x0a,0x33,0x01,0xf3,0x11,0x99,0x99,0x10,0x24,0x54,0x08,0x00,0x13,0x3b,
-0x09,0x00,0x00,0x19,0x09,0x95,0x00,0xa2,0x09,0x10,0x2a,0x30,0x09,0x00,0x30,0x00,
-0x03,0x00,0x09,0x99,0x9d,0x00,0x0a,0x02,0x00,0x30,0x04,0x88,0x87,0x7c,0x00,0xf0,
-0x15,0x10,0x28,0x9d,0x16,0x30,0x00,0x0b,0x06,0x40,0x00,0x57,0x06,0xa7,0x07,0x80,
-0x06,0x30,0x33,0x00,0x03,0x10,0x09,0x08,0x09,0x00,0x09,0xad,0x0d,0x10,0x09,0x09,
-0x56,0x90,0x04,0x87,0x40,0x13,0x01,0xf0,0x0f,0x40,0x00,0x89,0xb5,0x0a,0x00,0x00,
-0x09,0x10,0xa0,0x00,0x02,0x90,0x0d,0x91,0x03,0xa0,0x00,0xa0,0x02,0x70,0x00,0x06,
-0x00,0x00,0x69,0x8a,0x20,0x00,0x0a,0xc8,0x00,0xa0,0xb2,0x05,0x80,0x00,0x01,0x78,
-0x50,0x00,0x25,0x55,0x7d,0x00,0x01,0xa5,0x00,0x10,0x95,0xa5,0x00,0xf2,0x02,0x59,
-0x00,0x09,0x00,0x11,0x33,0x45,0x00,0x09,0x66,0x55,0x00,0x0a,0x99,0x99,0x00,0x09,
-0xa5,0x00,0xf0,0x12,0x20,0x00,0x00,0x40,0x64,0x9a,0x78,0x09,0x00,0x64,0x80,0x90,
-0x09,0x08,0x6b,0x01,0x90,0x84,0xa0,0x92,0x08,0x09,0x56,0x00,0x80,0x93,0x00,0x08,
-0x19,0x00,0x00,0x81,0x90,0x19,0x01,0xf0,0x17,0x00,0x40,0x50,0x38,0x9a,0x81,0x80,
-0x00,0x47,0x88,0xc1,0x00,0xb0,0x81,0x90,0x0a,0x30,0x80,0x80,0x42,0x00,0x30,0x60,
-0x00,0x19,0x99,0x40,0x00,0x92,0x00,0xa0,0x00,0x75,0x02,0xa0,0x00,0x05,0x86,0x51,
-0x02,0xf2,0x07,0x62,0x88,0xb3,0x09,0x00,0x0a,0x00,0x90,0x02,0x93,0x39,0x00,0xa1,
-0x55,0x90,0x75,0x00,0x09,0x56,0x00,0x00,0x90,0x61,0x01,0x12,0x90,0xab,0x01,0x31,
-0x41,0x88,0xc2,0x23,0x00,0xe0,0x04,0x76,0x99,0x03,0xa0,0x00,0x93,0x70,0x00,0x09,
-0x00,0x80,0x00,0x60,0x34,0x01,0x30,0xd8,0x89,0x60,0x69,0x03,0xf0,0x09,0x55,0x00,
-0x80,0x43,0xb1,0x0a,0x00,0x0b,0x59,0xa0,0x09,0x30,0x0a,0x19,0x30,0x00,0xa1,0x00,
-0x00,0x04,0x00,0xc9,0x99,0x90,0x2f,0x01,0xf3,0x1b,0xa0,0x00,0x90,0x07,0x88,0x84,
-0x01,0x11,0x05,0x42,0x17,0x7a,0x09,0x63,0x00,0x27,0x09,0x53,0x00,0x67,0x79,0x53,
-0x00,0xa0,0x29,0x53,0x06,0x50,0x09,0x53,0x29,0x00,0x09,0x53,0x10,0x00,0x09,0x53,
-0x00,0x00,0x08,0x53,0x11,0x03,0xf0,0x1b,0x31,0x28,0x8b,0x09,0x72,0x00,0x28,0x09,
-0x73,0x00,0xa4,0x99,0x72,0x09,0x40,0x09,0x72,0x32,0x00,0x05,0x51,0x00,0x08,0x04,
-0x30,0x00,0x3b,0x09,0x50,0x00,0xa6,0x98,0xa3,0x02,0x20,0x50,0x04,0x00,0x01,0x00,
-0x63,0x87,0xb9,0x00,0xdc,0x59,0x90,0x02,0x80,0x09,0x00,0xa1,0x12,0x90,0x83,0x07,
-0x79,0x64,0xb9,0x00,0xf1,0x08,0x31,0x88,0xb2,0x0a,0x00,0x0b,0x49,0xa0,0x04,0x77,
-0x8a,0x05,0x90,0x00,0xa3,0x50,0x00,0x06,0x00,0x99,0x99,0x70,0x00,0xef,0x01,0xf0,
-0x18,0xa0,0x00,0x00,0x03,0x05,0x56,0x10,0x80,0x33,0x97,0x9b,0x00,0x1a,0x00,0xa0,
-0x0a,0x28,0x9b,0x2a,0x20,0x00,0x90,0x05,0x55,0x54,0x00,0x44,0x44,0xa0,0x0a,0xaa,
-0xa8,0x00,0xb0,0x00,0x00,0x08,0x99,0x97,0x46,0x00,0xe0,0x89,0xb2,0x0a,0x00,0x0a,
-0x49,0xa0,0x03,0x87,0x8a,0x03,0x90,0x00,0xa3,0xbd,0x01,0xa0,0x59,0x8a,0x20,0x0b,
-0x00,0x19,0x00,0xa2,0x05,0x70,0xb9,0x01,0xf1,0x11,0x10,0x05,0x51,0x28,0x8a,0x09,
-0x72,0x00,0x29,0x79,0x72,0x00,0x74,0x29,0x72,0x00,0xa2,0x29,0x72,0x06,0x54,0x69,
-0x72,0x38,0x00,0x09,0x72,0x20,0x00,0x09,0x72,0x00,0x04,0x00,0x52,0x00,0x10,0x05,
-0x99,0x9b,0xb9,0x02,0x00,0x80,0x00,0x10,0x18,0xb5,0x02,0xf1,0x10,0x06,0x00,0x00,
-0x18,0x00,0x00,0x79,0x9a,0x99,0x94,0x04,0x99,0x99,0x10,0x00,0x00,0x07,0x20,0x00,
-0x05,0x08,0x20,0x00,0x0a,0x04,0x00,0x79,0x9d,0x99,0x94,0x00,0xf0,0x01,0xa0,0x9a,
-0x30,0x00,0x00,0x05,0x50,0x00,0x00,0x05,0x40,0x75,0x02,0x06,0x28,0x00,0x11,0x07,
-0x28,0x00,0x13,0x69,0x28,0x00,0xf6,0x00,0x06,0x20,0x03,0x30,0x07,0xa9,0x8b,0x40,
-0x07,0x20,0x05,0x40,0x03,0x89,0x98,0x28,0x00,0x10,0x06,0x28,0x00,0x10,0x05,0x28,
-0x00,0x11,0x93,0x13,0x01,0xe0,0x89,0x97,0x00,0x05,0x50,0x08,0x20,0x03,0x90,0x1b,
-0x00,0x00,0x38,0x72,0x12,0x00,0x50,0x50,0x01,0x89,0x98,0x09,0x11,0x01,0xf2,0x09,
-0x90,0x00,0x01,0x09,0x0a,0x00,0x00,0x91,0x80,0xd9,0x10,0x09,0x15,0x0a,0x00,0x00,
-0x90,0x21,0xa0,0x04,0x99,0x86,0x2a,0x00,0x2d,0x01,0x00,0x55,0x02,0x00,0xe5,0x03,
-0x23,0x89,0x99,0x2d,0x00,0xf1,0x02,0x09,0x09,0x0b,0x40,0x00,0xa0,0x21,0xb4,0x04,
-0x89,0x86,0x1a,0x00,0x00,0x60,0x00,0x60,0x57,0x01,0x86,0x00,0xd9,0x99,0x60,0x00,
-0x06,0x99,0x9b,0xa7,0x03,0xe1,0x81,0x69,0x00,0x00,0xa2,0x74,0x00,0x00,0x92,0x70,
-0x00,0x69,0xa9,0xa9,0x86,0x00,0x02,0x20,0x00,0x13,0x0a,0x24,0x00,0x61,0x04,0x00,
-0x89,0x9b,0x99,0x92,0x0f,0x00,0x03,0x04,0x00,0x00,0x6c,0x00,0x23,0x04,0x88,0xc2,
-0x00,0x01,0x04,0x00,0xd9,0x04,0x00,0x69,0x9b,0xa9,0x94,0x00,0x06,0x30,0x00,0x05,
-0x9b,0xaa,0x12,0x01,0x37,0x05,0x99,0x99,0x4c,0x00,0x10,0x03,0x28,0x00,0xf1,0x05,
-0x82,0x03,0x46,0x64,0x10,0x03,0x4a,0x27,0x50,0x08,0x97,0x03,0x50,0x0a,0x00,0x03,
-0x50,0x06,0x99,0x01,0x8b,0x03,0x60,0x08,0x99,0x90,0x90,0x00,0x00,0x04,0x00,0xe1,
-0x61,0x90,0x48,0xc8,0x72,0x90,0x00,0xa0,0x69,0xb0,0x00,0x30,0x00,0x80,0xe0,0x00,
-0x11,0xd9,0xc6,0x04,0x43,0x40,0x99,0x99,0x09,0xdf,0x00,0xe0,0x00,0x00,0x50,0x94,
-0x9a,0x98,0x39,0x00,0x81,0x00,0x90,0x08,0x10,0x09,0x07,0x00,0x03,0x05,0x01,0x80,
-0x04,0x99,0x9c,0x30,0x00,0x00,0x06,0x30,0x77,0x01,0x01,0x73,0x00,0x75,0xb9,0x9c,
-0x96,0x00,0xa0,0x0a,0x00,0x04,0x00,0x32,0x20,0x02,0x00,0xbd,0x01,0x10,0x9c,0xc3,
-0x00,0x10,0x10,0xce,0x04,0xd0,0x69,0x99,0x99,0x93,0x00,0x09,0x0a,0x00,0x06,0x38,
-0x08,0x00,0x07,0x3a,0x00,0x33,0xa8,0x89,0x40,0xe1,0x01,0x07,0xf8,0x00,0x01,0x88,
-0x04,0x01,0x3c,0x00,0x00,0x30,0x00,0x37,0x04,0x88,0x98,0xee,0x04,0x44,0x05,0x00,
-0x79,0x99,0x15,0x02,0x14,0x9b,0x03,0x01,0x10,0x50,0x03,0x01,0x03,0x94,0x00,0x03,
-0x28,0x00,0x10,0x08,0x3c,0x00,0x02,0x15,0x02,0x12,0x40,0x04,0x00,0x33,0x05,0xb8,
-0x88,0x6c,0x00,0x17,0x98,0x2b,0x01,0x20,0x02,0x00,0x3f,0x06,0x00,0x06,0x05,0x92,
-0x03,0x44,0x49,0x20,0x07,0x99,0x9a,0x10,0x0b,0x24,0x00,0x38,0x30,0x04,0x99,0x78,
-0x00,0x16,0x04,0x50,0x00,0x64,0x20,0x04,0x30,0x07,0xa9,0x9b,0x65,0x02,0x00,0x3e,
-0x04,0xfc,0x04,0x61,0x88,0xa6,0x09,0x00,0x07,0x20,0x90,0x00,0xa0,0x09,0x00,0x73,
-0x00,0x90,0x47,0x00,0x09,0x28,0x85,0x03,0xfd,0x03,0x52,0x88,0xc3,0x0a,0x00,0x0b,
-0x00,0xa0,0x08,0x50,0x0a,0x2a,0x40,0x00,0xa0,0x05,0x55,0x55,0x62,0x03,0xf0,0x0a,
-0x41,0x88,0xc3,0x09,0x00,0x0b,0x00,0x90,0x05,0x60,0x09,0x07,0x70,0x00,0x92,0x30,
-0x00,0x04,0x00,0x90,0x00,0x90,0x0d,0xa9,0x9a,0x07,0x00,0x30,0x08,0x88,0x84,0xa6,
-0x02,0xf4,0x10,0x04,0xa8,0x9b,0x0a,0x00,0x05,0x50,0xa0,0xa0,0x00,0x82,0x28,0x0a,
-0x00,0x0a,0x07,0x30,0xd8,0x15,0x50,0xa0,0x09,0x00,0x50,0x55,0x00,0x90,0x00,0x02,
-0x00,0x09,0xa6,0x02,0xf8,0x0d,0x04,0x00,0x01,0x01,0x00,0x64,0x98,0x89,0x09,0x07,
-0x33,0x70,0x90,0xa0,0x67,0x9a,0x09,0x0a,0x00,0xa7,0x31,0x90,0x09,0x40,0x91,0x00,
-0x90,0x01,0x96,0x00,0x73,0x00,0x29,0xb8,0x8d,0x00,0x00,0x73,0xb1,0x01,0x11,0x70,
-0x84,0x02,0x1c,0x90,0x84,0x02,0xf1,0x04,0x08,0xa6,0x8a,0x40,0x00,0x46,0x04,0x50,
-0x00,0x73,0x05,0x40,0x00,0xa0,0x07,0x30,0x00,0x70,0x06,0x6d,0x01,0x00,0x89,0x01,
-0xf1,0x01,0x08,0x94,0x89,0x20,0x00,0x37,0x05,0x50,0x00,0x72,0x06,0x40,0x00,0x40,
-0x05,0x10,0xe1,0x01,0x00,0x25,0x01,0x81,0xa9,0x9b,0x30,0x08,0x20,0x05,0x40,0x08,
-0x25,0x01,0x52,0x88,0x10,0x29,0x95,0x99,0x68,0x00,0xf0,0x03,0xb0,0x0a,0x00,0x00,
-0x30,0x04,0x00,0x78,0x98,0x88,0x82,0x02,0x44,0x44,0x00,0x09,0x44,0x43,0xd6,0x05,
-0x14,0x10,0xd6,0x05,0xa0,0x03,0x00,0x00,0x70,0x00,0xa0,0x00,0x09,0x00,0x0a,0xa4,
-0x00,0x43,0xa0,0x00,0x0d,0x92,0x09,0x00,0x63,0x09,0x00,0x0b,0x99,0x70,0x90,0x8d,
-0x01,0x21,0x00,0x90,0x9a,0x00,0x10,0x03,0x71,0x03,0x11,0xa0,0x8f,0x06,0xc0,0x00,
-0xd9,0x20,0xa2,0x24,0x0a,0x00,0x07,0x76,0x40,0x90,0x00,0xbe,0x04,0x00,0x5d,0x01,
-0x61,0x00,0x1b,0x9a,0x98,0x00,0x02,0x34,0x00,0x49,0x99,0x98,0x00,0x02,0x2d,0x00,
-0x00,0xe5,0x00,0x41,0x0b,0x99,0x80,0x90,0x2d,0x03,0xa0,0x02,0xc9,0x99,0x90,0x00,
-0x37,0x00,0x0a,0x00,0x03,0x7c,0x00,0x00,0x6a,0x01,0x82,0x01,0x00,0x04,0x05,0x0a,
-0x00,0x09,0x18,0x04,0x00,0x61,0x0b,0x58,0x0a,0x00,0x0a,0x48,0x0c,0x00,0x63,0x88,
-0x29,0x18,0x00,0x00,0x09,0x04,0x00,0x20,0x00,0x02,0x55,0x00,0x11,0xa0,0x9f,0x07,
-0x40,0xa0,0xa0,0x29,0x9a,0x07,0x00,0x00,0x0e,0x00,0x35,0x99,0x60,0xa0,0x5e,0x05,
-0x14,0x00,0x23,0x00,0xf0,0x07,0x03,0x99,0xb0,0xa0,0x01,0x09,0x0a,0x99,0x70,0x90,
-0x03,0x33,0x43,0x00,0x66,0x55,0xa0,0x1a,0x99,0x98,0x02,0x90,0x9c,0x00,0x10,0x97,
-0x23,0x00,0x01,0x83,0x01,0xf1,0x18,0x03,0x99,0xc0,0x0a,0x11,0x30,0x90,0x08,0x87,
-0x50,0x90,0x00,0x08,0x95,0x20,0x03,0x88,0x88,0x80,0x00,0x38,0x87,0x10,0x00,0xb1,
-0x04,0x80,0x00,0x49,0x98,0x10,0x01,0x00,0x04,0x23,0x0a,0x00,0x0a,0x36,0x04,0x00,
-0x61,0x07,0x9a,0x36,0x0a,0x00,0x09,0x04,0x00,0x73,0x0b,0x99,0x29,0x36,0x00,0x00,
-0x09,0x04,0x00,0x01,0x1f,0x09,0x01,0x17,0x04,0x13,0x05,0xfa,0x02,0x40,0x04,0xb9,
-0x99,0x10,0x51,0x03,0x00,0x0d,0x08,0x41,0x79,0x9b,0x99,0x94,0xa5,0x08,0x10,0x08,
-0xc4,0x01,0x10,0x91,0x2c,0x02,0xf3,0x11,0x9d,0x98,0x00,0x04,0x44,0xb4,0x45,0x10,
-0x44,0x44,0x44,0x40,0x00,0x79,0x99,0x90,0x00,0x00,0x50,0x32,0x00,0x00,0x09,0x05,
-0x40,0x00,0x07,0x99,0x88,0x20,0x00,0x40,0x0a,0x02,0x01,0xce,0x00,0x32,0x0a,0x98,
-0x89,0x39,0x02,0x43,0x88,0x88,0x99,0x92,0x13,0x00,0x04,0x1c,0x00,0x01,0x25,0x07,
-0x12,0x00,0xaa,0x04,0xf0,0x09,0x00,0x77,0x66,0x71,0x00,0x00,0x22,0x21,0x00,0x08,
-0x98,0xd8,0x88,0x10,0x03,0x5c,0x55,0x00,0x00,0x34,0x44,0xb0,0x00,0x07,0xf3,0x04,
-0x12,0xb0,0xec,0x01,0x1d,0x40,0x5a,0x00,0x14,0x10,0x5a,0x00,0x41,0x94,0x00,0x1a,
-0x00,0x69,0x09,0x00,0xef,0x01,0x04,0xab,0x02,0x0a,0xd4,0x00,0x33,0x05,0xa9,0x99,
-0x9c,0x09,0x02,0x26,0x04,0x26,0x01,0x10,0x20,0x00,0x13,0x03,0x1c,0x00,0x00,0xb2,
-0x03,0x34,0x05,0x20,0x00,0x6a,0x04,0x01,0x9b,0x09,0x23,0x02,0x20,0x28,0x00,0x65,
-0x73,0x34,0x00,0x01,0x55,0x54,0xd6,0x03,0x60,0x00,0x79,0x96,0x00,0x04,0x60,0x13,
-0x06,0x53,0x1a,0x10,0x00,0x48,0x72,0xb7,0x01,0x10,0x09,0x7e,0x02,0x02,0xe1,0x01,
-0x11,0x90,0xbe,0x01,0x16,0x60,0xd6,0x03,0x00,0x68,0x01,0x14,0x50,0xfd,0x01,0x31,
-0x00,0x0a,0x0c,0x56,0x05,0x00,0xf1,0x07,0x62,0x80,0x19,0x00,0x0a,0x01,0x90,0xf1,
-0x07,0x01,0x23,0x00,0x03,0x46,0x00,0x21,0x09,0x0b,0x23,0x00,0xa3,0x03,0x01,0x80,
-0x00,0x90,0x1d,0xa9,0x99,0x01,0x80,0xd6,0x03,0x81,0x05,0x00,0x7a,0x97,0x0a,0x00,
-0x81,0x00,0x04,0x00,0xc9,0x10,0x91,0x00,0x0a,0x85,0x91,0x00,0x09,0x00,0x69,0x99,
-0x49,0xe5,0x09,0x00,0xa9,0x02,0x25,0x89,0x96,0x28,0x00,0xc2,0x84,0x89,0x8a,0x39,
-0x00,0x00,0x15,0x09,0x00,0x07,0x00,0x06,0xad,0x03,0x30,0x88,0x88,0x00,0xe5,0x09,
-0x00,0x50,0x00,0x03,0x28,0x00,0xa1,0x21,0x91,0x00,0x0a,0x63,0x69,0x9b,0x3a,0x00,
-0x00,0x1c,0x04,0x31,0x08,0x00,0x0a,0xc1,0x09,0x13,0x09,0x03,0x05,0xf1,0x04,0x04,
-0x05,0x0c,0x88,0x09,0x18,0x09,0x00,0x09,0x18,0x19,0x00,0x0b,0x68,0x19,0x00,0x0b,
-0x48,0x19,0xe3,0x02,0x19,0x19,0xe3,0x02,0x62,0x01,0x22,0x00,0x60,0xc7,0x72,0xc3,
-0x00,0x24,0x28,0x89,0xe3,0x02,0x36,0x98,0x80,0xa0,0x09,0x01,0xf1,0x02,0x02,0x33,
-0x00,0x50,0xc6,0x51,0x0a,0x0a,0x00,0x99,0xa0,0xa0,0x01,0x09,0x09,0x99,0x60,0x41,
-0x08,0x60,0x34,0x33,0xa0,0x0a,0x99,0x98,0xdc,0x01,0x11,0x08,0x6f,0x00,0x81,0x60,
-0x0d,0x98,0x10,0xa0,0x0a,0x01,0x99,0x1f,0x06,0x40,0x0c,0x98,0x60,0x90,0x49,0x07,
-0x60,0x01,0x99,0x99,0x60,0x00,0x43,0xbb,0x2b,0xf2,0x06,0x09,0x00,0x02,0x99,0x88,
-0x80,0x02,0x22,0x05,0x24,0x0c,0x65,0x09,0x35,0x09,0x00,0x09,0x35,0x09,0x06,0x99,
-0x08,0x00,0x00,0x04,0x00,0x32,0x99,0x19,0x35,0xdf,0x02,0x21,0x08,0x36,0x81,0x0d,
-0xf0,0x10,0x21,0x04,0x33,0x0c,0x75,0x0a,0x55,0x0a,0x04,0x6a,0x55,0x0a,0x02,0x3a,
-0x55,0x0c,0x88,0x09,0x55,0x00,0x00,0x04,0x22,0x00,0x69,0x99,0xb2,0x00,0x00,0x00,
-0x73,0x7b,0x19,0x02,0x57,0x0d,0xf1,0x0b,0x07,0x41,0x0c,0x96,0x0a,0x63,0x0a,0x00,
-0x0a,0x63,0x0a,0x06,0x9a,0x62,0x0a,0x02,0x0a,0x62,0x08,0x86,0x0a,0x62,0x00,0x80,
-0x04,0x41,0x77,0x02,0x30,0xa8,0x88,0x91,0xae,0x0d,0x41,0x01,0x21,0x05,0x32,0x50,
-0x00,0xf1,0x08,0x06,0x9a,0x55,0x0a,0x00,0x09,0x55,0x0b,0x99,0x09,0x54,0x00,0x13,
-0x34,0x51,0x00,0x35,0x55,0x93,0x00,0x59,0x99,0xb2,0x2a,0x03,0x14,0x49,0xdc,0x04,
-0x12,0x97,0x53,0x02,0x11,0x30,0x87,0x02,0x00,0xf5,0x01,0x01,0xf5,0x02,0x75,0x79,
-0x9b,0xa9,0x94,0x02,0x99,0x98,0x71,0x06,0x40,0x02,0x9c,0xa9,0x20,0x29,0x00,0x21,
-0x69,0x99,0xda,0x08,0x18,0x20,0xad,0x06,0x0c,0x28,0x00,0xf3,0x02,0x12,0x28,0x52,
-0x21,0x46,0x66,0x66,0x62,0x00,0x79,0x97,0x00,0x04,0x70,0x08,0x20,0x02,0x87,0x02,
-0x00,0x38,0x01,0x24,0xc9,0x85,0x41,0x02,0xe2,0x0a,0x99,0x80,0x90,0x03,0x10,0x09,
-0x00,0x62,0x00,0x93,0x8a,0x98,0x2a,0x39,0x03,0x10,0x01,0x06,0x2e,0x12,0xc8,0x23,
-0x00,0x11,0xaa,0xf8,0x01,0xf3,0x04,0xa5,0x9a,0x98,0x2a,0x00,0x40,0x00,0x70,0x18,
-0x00,0x00,0x01,0xd9,0x99,0x50,0x08,0x99,0x50,0x80,0xa7,0x02,0xf2,0x09,0x8b,0x96,
-0x0a,0x01,0x84,0x41,0xa4,0x76,0x64,0x07,0x01,0x99,0x99,0x50,0x37,0x00,0x0a,0x03,
-0x70,0x01,0x90,0x08,0x98,0x84,0x8b,0x0c,0x22,0x88,0x86,0x9c,0x03,0x00,0xb6,0x01,
-0x07,0xe4,0x03,0x09,0x75,0x05,0x01,0x64,0x07,0x11,0x99,0xa0,0x0f,0xe0,0x08,0x75,
-0x56,0x10,0x01,0x33,0x33,0x00,0x89,0x8b,0x88,0x83,0x03,0x5c,0x40,0x07,0x11,0x4b,
-0xe0,0x03,0x12,0x0b,0xdf,0x03,0x10,0x30,0xdf,0x01,0x21,0xc8,0x84,0x98,0x00,0x20,
-0xc9,0x97,0x41,0x00,0xd5,0x94,0x9a,0x99,0x29,0x00,0x72,0x00,0x90,0x07,0x20,0x09,
-0x00,0x72,0x47,0x08,0x02,0xb9,0x02,0x02,0x78,0x00,0x27,0x99,0x20,0x02,0x04,0xbf,
-0x01,0x90,0x00,0x01,0xa0,0x19,0x00,0x00,0x19,0x01,0x80,0x78,0x00,0x02,0xf4,0x02,
-0x79,0xc8,0x9c,0x83,0x03,0xc4,0x5b,0x10,0x02,0x44,0x47,0x40,0x07,0x99,0x9a,0x30,
-0x0b,0x57,0x04,0x04,0xa3,0x01,0x03,0x35,0x09,0x34,0x06,0xa9,0x99,0x42,0x04,0x00,
-0xb3,0x06,0x15,0x93,0x7b,0x01,0xb0,0x73,0x34,0x10,0x01,0x44,0x44,0x10,0x68,0x88,
-0x88,0x83,0x4a,0x10,0x0f,0xa3,0x01,0x09,0x44,0x04,0xa9,0x99,0x20,0xf3,0x06,0x39,
-0x04,0x20,0x00,0xbc,0x08,0x31,0x03,0x99,0x99,0x10,0x00,0xf8,0x04,0x07,0x86,0x66,
-0x20,0x00,0x23,0x32,0x00,0x69,0x88,0x88,0x83,0x04,0x55,0x54,0x00,0x03,0x54,0x4c,
-0x10,0x01,0x11,0x20,0x50,0x00,0x21,0x50,0x00,0x04,0x00,0xc9,0x02,0x98,0x99,0x20,
-0x24,0x44,0x44,0x41,0x35,0x55,0x55,0x52,0xf3,0x01,0xb6,0x38,0x83,0x00,0x22,0x20,
-0x07,0xc6,0x62,0x0a,0x90,0x00,0x03,0x00,0x20,0x99,0x87,0x04,0x0e,0x02,0x86,0x01,
-0x00,0x11,0x02,0x27,0xd9,0x82,0x75,0x04,0x80,0xa0,0x00,0x10,0x06,0x00,0x39,0x89,
-0x20,0xd9,0x06,0x60,0xa2,0x04,0x80,0x01,0x68,0x50,0x28,0x08,0x40,0x09,0x93,0xc8,
-0x19,0xd4,0x07,0x50,0x90,0x0a,0x00,0xa0,0x09,0x09,0x00,0x11,0xd9,0x09,0x00,0x3a,
-0x89,0x4b,0x92,0x44,0x07,0x00,0x58,0x01,0xf0,0x02,0x50,0x88,0x98,0x19,0x90,0x90,
-0x90,0x09,0x90,0x90,0x90,0x0c,0xc0,0x90,0x90,0x09,0xa0,0x0c,0x00,0x30,0x68,0x78,
-0x39,0xeb,0x04,0x03,0x04,0x00,0x60,0x00,0x20,0x0c,0x93,0xc9,0x30,0xc7,0x0c,0x00,
-0x04,0x00,0x75,0x0b,0x95,0xb9,0x50,0x00,0x04,0x10,0xf5,0x02,0xff,0x03,0x00,0x48,
-0x57,0x81,0x00,0x0a,0x13,0x81,0x00,0x00,0xa0,0x27,0x00,0x00,0x0a,0x86,0xc8,0x20,
-0x3f,0x02,0x08,0x00,0x17,0x02,0xc0,0x0c,0x89,0x92,0x90,0x09,0x09,0x00,0x90,0x0c,
-0x89,0x83,0x90,0x1a,0x00,0x72,0x38,0x9a,0x95,0x90,0x00,0x46,0x00,0x04,0x00,0x21,
-0x45,0x00,0x71,0x00,0x00,0xc8,0x04,0x22,0x59,0x99,0xfd,0x0e,0x80,0x02,0x2a,0x0a,
-0x10,0xa7,0x74,0x09,0x85,0x07,0x08,0x37,0x98,0x99,0x39,0x18,0x05,0x11,0x01,0xed,
-0x08,0xf9,0x08,0x59,0x9a,0x0a,0x00,0x12,0x2a,0x0a,0x00,0xa5,0x53,0x0a,0x95,0xa0,
-0x01,0x0a,0x00,0x49,0x85,0x19,0x00,0x06,0x00,0x07,0x18,0x05,0xf1,0x04,0x48,0x85,
-0x08,0x00,0x01,0x19,0x0a,0x00,0x13,0x39,0x0a,0x10,0xa6,0x63,0x09,0x95,0x98,0x9a,
-0x39,0x3c,0x00,0x31,0x06,0xaa,0xaa,0x14,0x05,0x00,0x04,0x00,0x33,0x04,0x98,0x87,
-0x28,0x00,0x41,0x09,0x00,0x59,0x99,0x70,0x00,0xf0,0x1e,0x10,0x97,0x79,0x39,0x00,
-0x02,0x10,0x06,0x00,0x01,0x99,0x95,0x00,0x07,0x30,0x0a,0x00,0x06,0x60,0x1b,0x00,
-0x00,0x58,0x71,0x00,0x01,0x10,0x40,0x50,0x68,0xc0,0x90,0x90,0x00,0x90,0x90,0x90,
-0x36,0xc0,0x95,0xb0,0x94,0x30,0x93,0xa0,0x0d,0x00,0x24,0x88,0x96,0x5e,0x0b,0x11,
-0x90,0xc8,0x00,0xf3,0x0d,0x03,0x32,0x03,0x61,0x05,0x5b,0x27,0x82,0x05,0x5b,0x1a,
-0xb2,0x0b,0x32,0x19,0x92,0x0c,0x68,0x47,0x81,0x01,0x20,0x02,0x40,0x00,0x69,0x99,
-0xb0,0xfb,0x06,0x10,0xa0,0xaa,0x04,0x03,0xa0,0x00,0xfc,0x01,0x94,0x48,0x8a,0x0a,
-0x00,0xa3,0x32,0x0a,0x00,0x94,0x46,0x2a,0x94,0x02,0x10,0x07,0x78,0x00,0x00,0xac,
-0x11,0x31,0x61,0x77,0xc0,0x8a,0x0e,0x50,0x66,0xc2,0x9c,0x0b,0x32,0x67,0x00,0x47,
-0x09,0x0c,0x88,0x70,0xd9,0x09,0xb0,0x08,0x88,0x00,0x80,0x11,0xa0,0x0a,0x08,0x9d,
-0x49,0xd0,0x24,0x02,0xa2,0x89,0x80,0xa0,0x01,0x00,0x05,0x00,0xa9,0x99,0xa0,0x8a,
-0x0e,0x88,0xa0,0x05,0x88,0x86,0x08,0x88,0x00,0x70,0x23,0x00,0x10,0x70,0x09,0x0e,
-0x00,0x68,0x0a,0x30,0x0b,0xa9,0x9c,0x07,0x00,0x80,0x06,0x88,0x86,0x23,0x20,0x50,
-0x70,0x46,0xe1,0x00,0xf0,0x02,0xa0,0x80,0x90,0x48,0xd5,0xc1,0x90,0x92,0x10,0x81,
-0x90,0x90,0x00,0x81,0x90,0x79,0x85,0x37,0x09,0x03,0x04,0x00,0x00,0x44,0x02,0xf4,
-0x07,0x31,0x04,0x33,0x05,0x5a,0x0a,0x45,0x04,0x5a,0x7b,0x45,0x0b,0x31,0x1a,0x45,
-0x0c,0x68,0x3a,0x45,0x01,0x20,0x03,0x8b,0x05,0x13,0x63,0x04,0x00,0x10,0x10,0x9f,
-0x05,0xf1,0x09,0x08,0x99,0x0a,0x45,0x00,0x09,0x1a,0x45,0x0c,0x95,0x7b,0x45,0x0a,
-0x01,0x09,0x45,0x08,0x87,0x19,0x45,0x00,0x50,0x07,0x44,0xb7,0x00,0x20,0x99,0x88,
-0x05,0x1b,0x00,0xe1,0x00,0x11,0x60,0xe1,0x00,0xca,0x29,0xc0,0x66,0xc0,0x09,0x0b,
-0x32,0x03,0xa0,0x90,0x01,0x6b,0xe1,0x00,0xf0,0x04,0x07,0x87,0x00,0x70,0x11,0xa4,
-0x9c,0x07,0x8c,0x00,0x90,0xa1,0x04,0x9c,0x0c,0x78,0x60,0x90,0x11,0x40,0x0d,0x25,
-0x99,0xb0,0x77,0x09,0xb0,0x02,0x08,0x87,0x00,0x60,0x01,0x1a,0x5a,0xd0,0x08,0x9d,
-0xfe,0x02,0x21,0x49,0xc0,0x3e,0x0a,0xd1,0x12,0x22,0x30,0x00,0x67,0x77,0xb0,0x00,
-0x89,0x99,0xa0,0x00,0xa0,0xcf,0x03,0x22,0x80,0x03,0xa5,0x0d,0x00,0xeb,0x08,0x71,
-0x00,0x07,0x97,0x87,0x10,0x00,0x13,0xd8,0x02,0x00,0x41,0x0d,0x52,0x93,0x00,0x49,
-0x99,0x80,0xa3,0x08,0x30,0x89,0x99,0x80,0xc6,0x06,0x11,0x10,0x5c,0x00,0x84,0x89,
-0x99,0x88,0x81,0x00,0x48,0x89,0x90,0x45,0x09,0x11,0x81,0x88,0x02,0x13,0x02,0x6c,
-0x0e,0x80,0x05,0xba,0xaa,0x10,0x05,0xa8,0x88,0x20,0x38,0x04,0x00,0x45,0x00,0x13,
-0x03,0xcf,0x14,0x13,0x07,0x2f,0x04,0xf1,0x08,0x00,0x25,0x55,0x40,0x00,0x01,0x44,
-0x4b,0x00,0x00,0x7a,0x99,0x80,0x00,0x04,0x8b,0x88,0x10,0x08,0x88,0xd8,0x88,0x10,
-0xa7,0x14,0x50,0x68,0x88,0xc2,0x00,0x06,0x2f,0x0d,0x14,0xb0,0x44,0x05,0x01,0x82,
-0x00,0xb2,0x11,0x1a,0x00,0x00,0x98,0x88,0x70,0x00,0x08,0x98,0x89,0x82,0x00,0x60,
-0x99,0x9a,0x99,0x91,0x00,0x00,0x75,0x10,0x91,0x2d,0x60,0x00,0x00,0x4b,0x16,0x80,
-0x00,0x05,0xd9,0x08,0x00,0x8d,0x04,0x13,0x9c,0xcf,0x00,0xf4,0x02,0x98,0x00,0x07,
-0x97,0x78,0x20,0x00,0x21,0x11,0x00,0x00,0xa0,0x44,0x00,0x69,0xc9,0xaa,0xcf,0x00,
-0x21,0x09,0x00,0x7b,0x02,0x01,0x79,0x09,0x20,0x59,0x89,0xbd,0x00,0x00,0xa2,0x07,
-0x35,0xc9,0x99,0x20,0x8c,0x09,0x00,0x59,0x0b,0x11,0x02,0x37,0x03,0xf5,0x07,0x07,
-0x20,0x05,0xb9,0x99,0x10,0x06,0x85,0x55,0x20,0x00,0x33,0x33,0x00,0x69,0x9b,0xb9,
-0x94,0x03,0x15,0x32,0x10,0xfe,0x0c,0x30,0x99,0x99,0x10,0xfe,0x04,0x00,0x08,0x01,
-0x41,0x06,0x99,0x9b,0x10,0xb8,0x0d,0x22,0x98,0x98,0x2a,0x05,0x35,0xd9,0x9d,0x94,
-0x0a,0x0e,0x40,0x40,0x03,0x00,0x02,0x55,0x06,0xf1,0x13,0x11,0x18,0x20,0x05,0xa8,
-0x88,0x10,0x05,0xa8,0x89,0x30,0x11,0x12,0x11,0x10,0x57,0xc7,0x9a,0x73,0x04,0xd9,
-0xbc,0x20,0x08,0x20,0x05,0x50,0x08,0x30,0x05,0x40,0x02,0x88,0x88,0xb8,0x09,0x05,
-0x94,0x01,0xb4,0xa9,0x99,0x00,0x07,0x20,0x01,0x00,0x03,0x99,0x98,0x20,0xe8,0x09,
-0xf1,0x05,0x02,0x66,0x66,0x00,0x00,0x22,0x2a,0x10,0x05,0xa9,0x9a,0x00,0x07,0x52,
-0x22,0x10,0x02,0x66,0x66,0x20,0x18,0x00,0x13,0x20,0xea,0x0d,0x12,0xb8,0x67,0x01,
-0x04,0xbe,0x0d,0xc0,0x07,0xa9,0x98,0x00,0x04,0x99,0x89,0x10,0x78,0x88,0x88,0x82,
-0x64,0x01,0x93,0x05,0x88,0x8b,0x20,0x05,0x99,0x9b,0x20,0x0a,0x62,0x01,0x04,0xc0,
-0x00,0x00,0x6c,0x00,0xf0,0x05,0x06,0xa9,0x98,0x10,0x12,0x22,0x22,0x20,0x57,0x77,
-0x77,0x73,0x05,0x99,0x9a,0x20,0x09,0x10,0x05,0x40,0x04,0x00,0xf0,0x14,0x04,0x89,
-0x88,0x10,0x02,0x22,0x02,0x31,0x77,0xc0,0x45,0x00,0x0a,0x04,0x50,0x67,0xc0,0x45,
-0x0a,0x21,0x04,0x50,0xa0,0x00,0x45,0x0c,0x98,0x94,0x50,0x00,0x00,0x45,0x00,0x00,
-0x04,0x75,0x05,0xa0,0x18,0x88,0x00,0x60,0x11,0x91,0x0a,0x08,0x9c,0x10,0xac,0x07,
-0x31,0x0c,0x89,0x70,0x10,0x0a,0x36,0x99,0x99,0x80,0x6b,0x11,0xf0,0x0a,0x04,0x44,
-0x00,0x50,0x44,0xa1,0x0a,0x03,0x3a,0x10,0x90,0xb4,0x40,0x09,0x0b,0x23,0x40,0x90,
-0x55,0x52,0x09,0x00,0x50,0x00,0x80,0xda,0x02,0x50,0xb8,0x88,0x70,0x00,0x11,0x46,
-0x00,0x12,0x50,0x46,0x00,0x40,0xa0,0xa0,0x00,0x09,0xdc,0x02,0x71,0x12,0x10,0x04,
-0x00,0xb9,0x99,0xa0,0xf3,0x03,0x56,0x00,0xa0,0x06,0x88,0x85,0x23,0x00,0x02,0x69,
-0x00,0x20,0x60,0x90,0xb3,0x01,0x10,0x80,0xbd,0x03,0x10,0x9b,0x07,0x00,0x02,0x23,
-0x00,0x82,0x80,0x01,0x19,0x10,0xa0,0x08,0x9c,0x00,0x70,0x09,0x10,0x88,0x94,0x0c,
-0xf0,0x03,0x30,0x90,0x00,0x02,0xa0,0x10,0x00,0x0b,0xa6,0x00,0x01,0xa3,0x06,0x80,
-0x00,0x10,0x00,0x10,0x28,0x00,0x05,0x6e,0x00,0xc0,0x0a,0x0c,0x67,0x60,0xa0,0x33,
-0x20,0x07,0x00,0x29,0x89,0x40,0x6e,0x00,0x61,0x83,0x03,0xa0,0x00,0x68,0x61,0x51,
-0x0a,0x51,0x99,0x0a,0x00,0x90,0x09,0x04,0x00,0x10,0x96,0xba,0x05,0x00,0x04,0x00,
-0x2a,0x79,0x88,0x86,0x14,0x01,0xc3,0x10,0x10,0x8a,0x73,0x06,0x01,0x28,0x00,0x20,
-0x97,0x89,0x2d,0x0a,0x00,0x87,0x05,0x05,0x9b,0x10,0x11,0x0a,0x24,0x00,0x83,0x13,
-0x42,0x06,0x00,0x95,0x4a,0x0a,0x00,0x48,0x00,0x70,0x95,0x86,0x6a,0x09,0x00,0x02,
-0x20,0xc9,0x0a,0x12,0x09,0x96,0x0f,0x05,0xc9,0x0a,0x14,0x08,0x50,0x00,0x10,0x95,
-0x7c,0x00,0x20,0x89,0x89,0x0a,0x27,0xf0,0x02,0x78,0x00,0x09,0x04,0x88,0x60,0x09,
-0x00,0x99,0x00,0x0b,0x45,0x65,0x40,0x03,0x41,0x88,0x0f,0x04,0x31,0x00,0x89,0x9a,
-0x74,0x00,0x01,0x28,0x00,0xe6,0x59,0x97,0x09,0x00,0x02,0x33,0x44,0x00,0x03,0x65,
-0x5c,0x00,0x06,0x99,0xd6,0x14,0x0c,0x50,0x00,0x31,0x79,0x98,0x0a,0xeb,0x02,0xf1,
-0x01,0x05,0x99,0xaa,0x00,0x00,0x04,0xb1,0x00,0x02,0x98,0xa6,0x00,0x05,0x00,0x03,
-0x20,0x19,0x0b,0x50,0x7a,0x09,0x08,0x09,0x09,0x04,0x00,0xc0,0x0c,0x68,0x08,0x09,
-0x0b,0x38,0x08,0x09,0x09,0x08,0x0a,0x88,0x6b,0x34,0x04,0x04,0x00,0x00,0x7a,0x06,
-0xf0,0x15,0x04,0x14,0x0c,0x8c,0x0b,0x4a,0x09,0x09,0x0c,0xba,0x09,0x09,0x0a,0x7a,
-0x0c,0x9b,0x0a,0x7a,0x00,0x00,0x02,0x23,0x00,0x54,0x00,0x48,0x00,0x5b,0x99,0xa8,
-0x00,0x54,0x00,0x18,0x00,0x28,0x5c,0x08,0xf0,0x01,0x02,0x03,0x0c,0x8c,0x0b,0x0a,
-0x09,0x09,0x0c,0x8a,0x09,0x09,0x0b,0x0a,0x0c,0x8b,0xbe,0x07,0x00,0x2f,0x37,0xf0,
-0x05,0x65,0x00,0x00,0x01,0xba,0x10,0x00,0x2b,0x22,0xa2,0x00,0x31,0x00,0x03,0x02,
-0x22,0x00,0x61,0xb5,0xb0,0x91,0x0b,0xd8,0x91,0x80,0x93,0x9b,0x17,0x09,0x00,0x91,
-0x70,0x90,0x09,0x0a,0x8a,0x48,0x10,0xc0,0x03,0x33,0x00,0x50,0x0b,0x5b,0x00,0xa0,
-0x09,0x09,0x14,0xb0,0x04,0x00,0xa0,0x0b,0x6b,0x20,0x90,0x01,0x21,0x00,0x90,0x00,
-0x60,0xf7,0x01,0x01,0xce,0x0a,0x04,0x66,0x07,0x30,0x50,0x0c,0x9c,0x28,0x00,0x30,
-0x49,0xc0,0x09,0xff,0x07,0xf2,0x02,0x9a,0x20,0x90,0x00,0x33,0x34,0x30,0x00,0x56,
-0x55,0xb0,0x00,0x99,0x99,0x90,0x00,0x90,0xfd,0x04,0xf1,0x04,0x02,0x21,0x05,0x34,
-0x0c,0x5a,0x09,0x45,0x09,0x09,0x09,0x45,0x09,0x0b,0x9a,0x45,0x08,0x09,0x09,0x04,
-0x00,0x60,0x09,0x88,0x09,0x45,0x00,0x00,0x04,0x00,0x21,0x08,0x35,0x4f,0x09,0x61,
-0x66,0x00,0x80,0x0a,0x2a,0x18,0x4c,0x00,0x02,0x04,0x00,0xa1,0x4b,0xc0,0x07,0x88,
-0x10,0x90,0x00,0x70,0x00,0x60,0x4c,0x00,0x11,0xb8,0x0e,0x05,0x00,0x03,0x15,0x40,
-0x70,0xb4,0xa3,0x9c,0x23,0x00,0x70,0x90,0x92,0x8c,0x0c,0x8c,0x01,0xa0,0x01,0x02,
-0x0a,0x4e,0x02,0x00,0xb0,0x01,0x70,0xa9,0x9c,0x10,0x08,0x10,0x07,0x20,0x04,0x00,
-0x00,0x38,0x04,0x01,0x4c,0x08,0x12,0x08,0x4c,0x08,0x00,0x54,0x04,0x40,0x06,0x40,
-0x05,0x40,0x04,0x00,0x40,0x02,0x9b,0xa8,0x10,0x47,0x05,0x00,0xe0,0x03,0x1b,0x05,
-0x9e,0x09,0x60,0x00,0x59,0x99,0x90,0x00,0x09,0x1a,0x01,0x00,0xce,0x00,0x32,0x04,
-0x9c,0x87,0x23,0x01,0x24,0x99,0x99,0x1a,0x05,0xa0,0x1e,0x40,0x00,0x00,0x2b,0x29,
-0x60,0x00,0x07,0x10,0x03,0x0e,0x01,0x58,0x02,0x20,0x8c,0x00,0x88,0x15,0x8f,0x00,
-0x09,0x77,0x7c,0x00,0x00,0x01,0x11,0xc4,0x0e,0x05,0x00,0x12,0x04,0x93,0x06,0x40,
-0x08,0x10,0x06,0x30,0x08,0x10,0x02,0xef,0x0e,0xd5,0x69,0x9a,0xc9,0x94,0x04,0x32,
-0x70,0x00,0x06,0x40,0x20,0x00,0x05,0x62,0x04,0xa0,0x99,0x20,0x08,0x10,0x05,0x40,
-0x08,0x86,0x6a,0x40,0xea,0x0e,0x43,0x78,0xd8,0x9c,0x84,0x90,0x0a,0x53,0x60,0x07,
-0x99,0x9a,0x40,0xf8,0x09,0xf0,0x03,0x50,0x02,0x23,0x00,0x50,0xc5,0xb0,0x18,0x09,
-0x08,0x01,0x80,0x90,0x81,0x18,0x09,0x08,0x11,0x07,0x00,0x20,0x0a,0x8a,0xd6,0x0a,
-0x00,0xa2,0x0b,0x13,0x70,0xd5,0x09,0x31,0xc9,0xc0,0x0a,0x38,0x01,0x62,0x90,0x0a,
-0x0c,0x8c,0x00,0xa0,0x75,0x03,0x16,0x90,0x3a,0x04,0x06,0xd3,0x01,0x2f,0x00,0xa0,
-0xd3,0x01,0x09,0x00,0x4b,0x00,0x08,0x28,0x00,0x02,0x4d,0x00,0xf2,0x00,0x10,0xa0,
-0x00,0x01,0xa0,0x20,0x00,0x09,0xb3,0x00,0x00,0x96,0x09,0x50,0x01,0xd5,0x0f,0x1c,
-0x50,0x73,0x00,0x0b,0xab,0x01,0x00,0x47,0x08,0x26,0x09,0x1a,0x4b,0x00,0xf1,0x10,
-0x08,0x98,0x10,0xa0,0x00,0x07,0x76,0x10,0x00,0x79,0x88,0x70,0x00,0x00,0x3a,0x40,
-0x00,0x6a,0x8a,0x71,0x00,0x20,0x00,0x11,0x20,0x02,0x08,0x00,0xa0,0x09,0x0a,0x25,
-0x00,0x81,0x99,0x9b,0x09,0x96,0xa0,0x09,0x09,0x10,0x21,0x04,0x1a,0x89,0x21,0x04,
-0xf2,0x01,0x30,0x03,0x06,0x00,0x80,0x09,0x09,0x00,0x98,0x8a,0x09,0x95,0x80,0x09,
-0x09,0x10,0x41,0x04,0x1d,0x04,0x21,0x04,0x32,0x10,0x02,0x05,0x28,0x00,0x51,0x7a,
-0x09,0x00,0x91,0x19,0x2c,0x00,0x89,0x00,0x38,0x84,0x09,0x00,0x05,0x00,0x08,0xd2,
-0x09,0x00,0x50,0x00,0x10,0x81,0x74,0x00,0x30,0x8a,0x09,0xa5,0x24,0x00,0x20,0x58,
-0x86,0xf9,0x03,0x51,0x34,0x00,0x04,0x66,0x6c,0xcf,0x18,0x13,0x0b,0xf9,0x03,0x01,
-0x28,0x00,0xf1,0x0c,0x0a,0x0a,0x00,0x98,0x8c,0x0a,0xa5,0x80,0x0a,0x09,0x00,0x58,
-0x87,0x09,0x00,0x03,0x32,0x34,0x00,0x05,0x59,0x4b,0x00,0x09,0x97,0x08,0x00,0x02,
-0x00,0x50,0x97,0x03,0x00,0x40,0x05,0xa0,0x00,0x92,0x0a,0x00,0x98,0x8a,0x0a,0x84,
-0x80,0x09,0x0a,0xa0,0x00,0x00,0xa4,0x18,0x23,0x98,0x94,0x82,0x09,0x11,0x2b,0x82,
-0x09,0x00,0x21,0x04,0x40,0x18,0x09,0x09,0x09,0x04,0x00,0xe0,0x1d,0x9c,0x0b,0x59,
-0x09,0x09,0x0a,0x39,0x09,0x09,0x09,0x09,0x0a,0x89,0x2e,0x15,0x03,0x04,0x00,0x00,
-0x1d,0x12,0xf0,0x04,0x02,0x03,0x51,0x09,0x09,0x18,0x73,0x0c,0x8c,0x1b,0xa3,0x09,
-0x09,0x0a,0x83,0x0b,0x8b,0x08,0x73,0xda,0x17,0x21,0x00,0x59,0xfa,0x09,0x13,0x91,
-0xd5,0x03,0x90,0x10,0x10,0x01,0x00,0x68,0x10,0x90,0x09,0x81,0xdc,0x0a,0x20,0xc4,
-0x89,0x07,0x00,0x59,0x10,0x90,0x09,0x59,0x99,0xf9,0x03,0x50,0x02,0x00,0x50,0x09,
-0x08,0xce,0x01,0xce,0x12,0xa0,0x09,0x09,0x26,0xb0,0x0a,0x4b,0x00,0x90,0x03,0x42,
-0xf9,0x03,0x40,0x04,0x03,0x00,0x60,0xab,0x01,0x41,0x0d,0x9d,0x59,0xd0,0xb7,0x01,
-0x28,0x89,0x00,0x26,0x02,0x05,0xf6,0x08,0x40,0x04,0x04,0x00,0x70,0xf7,0x01,0x30,
-0x8d,0x49,0xc0,0x07,0x00,0x12,0x8b,0x63,0x02,0x14,0xa9,0x65,0x06,0x00,0x22,0x0a,
-0xa0,0x03,0x03,0x00,0x60,0x90,0x90,0x0a,0x0d,0x9d,0x29,0x23,0x00,0x02,0x88,0x04,
-0x11,0x02,0x65,0x06,0x22,0x99,0x9c,0x65,0x06,0x90,0x86,0x01,0x01,0x05,0x34,0x18,
-0x09,0x09,0x45,0x04,0x00,0x32,0x1d,0x9d,0x9a,0x47,0x04,0x00,0x04,0x00,0x1a,0x87,
-0x3f,0x04,0xc0,0x02,0x03,0x04,0x23,0x09,0x09,0x09,0x36,0x0d,0x9d,0x9b,0x36,0x08,
-0x00,0xf1,0x01,0x0a,0x89,0x09,0x36,0x00,0x13,0x34,0x41,0x00,0x25,0x55,0x84,0x00,
-0x4a,0x99,0xa3,0xaf,0x0f,0x41,0x39,0x99,0x94,0x02,0xe6,0x00,0x62,0x13,0xb0,0x0d,
-0x9d,0x14,0xb0,0x75,0x02,0x56,0x2a,0xc0,0x07,0x87,0x00,0x67,0x04,0x08,0xe6,0x00,
-0xb3,0x08,0x38,0xc0,0x0d,0x9d,0x01,0xa0,0x09,0x09,0x39,0xc0,0xe6,0x00,0x1c,0x50,
-0xe6,0x00,0xf7,0x07,0x01,0x00,0x02,0x00,0x06,0x30,0x09,0x00,0x06,0xa9,0x9d,0x00,
-0x07,0x20,0x0a,0x00,0x06,0xa8,0x8c,0x00,0x00,0x03,0x6c,0x04,0xfc,0x08,0x30,0x04,
-0x10,0x05,0xa7,0x7b,0x20,0x05,0x51,0x17,0x20,0x02,0x9c,0xa9,0x00,0x12,0x28,0x42,
-0x21,0x56,0x66,0x66,0x62,0x6c,0x04,0xf0,0x01,0x04,0x30,0x05,0x10,0x05,0xa8,0x8b,
-0x20,0x05,0x40,0x07,0x20,0x04,0xa9,0x9b,0x10,0x40,0x00,0x64,0x69,0x9a,0x99,0x93,
-0x03,0x20,0x5a,0x16,0x21,0x89,0x50,0xa0,0x12,0xf1,0x0b,0x30,0x07,0x00,0x07,0xb9,
-0x9d,0x00,0x07,0x74,0x4b,0x00,0x01,0x4b,0x53,0x00,0x78,0x8c,0x88,0x92,0x01,0x22,
-0x23,0x00,0x04,0x76,0x6b,0xe8,0x04,0x14,0x0b,0x74,0x08,0x00,0x50,0x00,0x21,0xb9,
-0x9c,0x50,0x00,0x32,0x03,0x9b,0x9a,0x48,0x0d,0x00,0x39,0x15,0x10,0x05,0x78,0x1e,
-0xb0,0x90,0x00,0x02,0xa2,0x4a,0x10,0x04,0x00,0x01,0x30,0x00,0x02,0x00,0x30,0x09,
-0x10,0x09,0xd7,0x04,0x12,0xc0,0xed,0x04,0x10,0x49,0xb9,0x19,0x01,0xd2,0x14,0x27,
-0xd9,0x98,0xb1,0x09,0x10,0x04,0xd9,0x12,0x30,0x03,0x00,0x05,0x97,0x09,0x73,0xa9,
-0x9c,0x20,0x04,0xb9,0x9c,0x10,0xb7,0x04,0xd1,0x93,0x02,0x32,0x70,0x00,0x05,0x50,
-0x30,0x00,0x04,0xb8,0x89,0x60,0xa5,0x00,0x40,0x10,0x07,0x00,0x07,0x11,0x01,0x21,
-0x53,0x3a,0x01,0x13,0x7d,0x79,0x8a,0x88,0x82,0x01,0x2b,0x33,0xa5,0x00,0xd1,0x00,
-0x53,0x00,0x70,0x00,0x07,0xb9,0x9c,0x00,0x00,0x77,0x33,0xa0,0x2a,0x00,0x20,0x08,
-0x98,0xd7,0x0a,0x20,0x1a,0x11,0x8d,0x0a,0x84,0x71,0x00,0x0a,0x99,0xa9,0x10,0x00,
-0x90,0x8d,0x1b,0x30,0x30,0x00,0x20,0x45,0x09,0xe2,0x10,0x00,0x99,0x99,0xc1,0x00,
-0x08,0x10,0x08,0x10,0x00,0x49,0x99,0x90,0x5b,0x0a,0x64,0x9d,0x99,0xc8,0x30,0x01,
-0x90,0xc9,0x0f,0x30,0x40,0x04,0x00,0x97,0x01,0x20,0x07,0x30,0x9b,0x09,0x04,0x97,
-0x01,0x17,0x8b,0xa1,0x0f,0x00,0xb3,0x13,0x10,0x06,0x23,0x06,0x33,0x00,0x07,0x63,
-0xa2,0x00,0x23,0x88,0x89,0x47,0x01,0x25,0x6a,0x20,0x67,0x0a,0x02,0x61,0x10,0x30,
-0x40,0x90,0x09,0x46,0x08,0x60,0xa0,0xd9,0x99,0x09,0x0a,0x00,0xc4,0x0e,0x46,0x09,
-0x0a,0x98,0x70,0x38,0x03,0x90,0x01,0x03,0x00,0x30,0x50,0x09,0x00,0x80,0xa0,0x04,
-0x0d,0xf1,0x03,0x09,0x01,0x80,0x90,0x0a,0x45,0x80,0x90,0x03,0x43,0x10,0x90,0x00,
-0x80,0x00,0x80,0x00,0xb0,0x52,0x02,0x21,0x80,0x00,0x40,0x01,0x20,0x30,0x60,0x28,
-0x00,0x22,0x0d,0x99,0x28,0x00,0x3a,0x09,0x88,0x40,0x5e,0x05,0x12,0xc0,0x52,0x02,
-0xf5,0x0f,0x21,0x12,0x20,0x80,0x09,0x46,0x99,0x0a,0x00,0x94,0x69,0x90,0xa0,0x0a,
-0xa6,0xdc,0x0d,0x80,0x94,0x59,0x90,0xa0,0x09,0x45,0x99,0x09,0x00,0x8a,0x4b,0xa0,
-0xeb,0x0e,0x02,0xf8,0x15,0xf1,0x13,0x20,0x11,0x25,0x00,0x92,0x68,0x78,0x10,0x9a,
-0x6c,0x98,0xa5,0x93,0x68,0x78,0x10,0x59,0x39,0x68,0x10,0x01,0x33,0x34,0x00,0x02,
-0x66,0x6c,0x00,0x04,0xaa,0xab,0x00,0x07,0x40,0x6d,0x06,0xe1,0x10,0x10,0x11,0x10,
-0x69,0x17,0x98,0x09,0x91,0x79,0x80,0x99,0x97,0xdc,0x07,0x00,0x68,0x16,0x98,0x09,
-0x69,0x4a,0xa0,0x41,0x18,0x00,0xbf,0x15,0x12,0x90,0x4e,0x0b,0x80,0x02,0xc0,0x0a,
-0x00,0x07,0xa3,0x09,0x96,0x7a,0x3c,0x3a,0x72,0x06,0x39,0x84,0x09,0x20,0x20,0x03,
-0x37,0x15,0x10,0x10,0x04,0x00,0xbb,0x07,0xc2,0x09,0x97,0x49,0x09,0x19,0x10,0x60,
-0x00,0x26,0x60,0x19,0x10,0x04,0x03,0x00,0xf1,0x09,0x80,0x00,0x01,0x90,0x09,0x00,
-0x00,0x57,0x00,0x90,0x00,0x0a,0xb1,0x09,0x95,0x06,0x51,0x90,0x90,0x00,0x50,0x01,
-0x19,0x00,0x6f,0x03,0x24,0x0a,0x00,0x1c,0x01,0x00,0x89,0x09,0x10,0x02,0x2f,0x06,
-0x10,0x80,0x93,0x1d,0x00,0x01,0x10,0xb2,0xb1,0x0a,0x95,0x07,0x51,0xa0,0xa0,0x00,
-0x40,0x00,0x13,0x7d,0x07,0x00,0x56,0x14,0x01,0x59,0x07,0x02,0x14,0x1e,0x22,0x00,
-0x40,0xab,0x00,0x10,0x37,0x2d,0x00,0xf2,0x0a,0xb0,0x0a,0x85,0x07,0x62,0x90,0xa0,
-0x00,0x60,0x01,0x18,0x00,0x00,0x19,0x99,0x50,0x00,0x08,0x30,0x0a,0x00,0x00,0x66,
-0x02,0xb0,0x4a,0x05,0xf0,0x0a,0x10,0x30,0x50,0x00,0x90,0x81,0x90,0x01,0x80,0x81,
-0x90,0x04,0xa0,0x86,0xb0,0x08,0xa0,0x84,0xb0,0x19,0x27,0x81,0x90,0x81,0x08,0xc0,
-0x1d,0x03,0x04,0x00,0x00,0x0c,0x10,0xf0,0x05,0x10,0x04,0x34,0x00,0xa0,0x0a,0x46,
-0x01,0xb0,0x0b,0x86,0x07,0xa3,0x0b,0x66,0x38,0x0a,0x1a,0x46,0x30,0xee,0x13,0x75,
-0x79,0x99,0xb3,0x00,0x00,0x00,0x64,0x63,0x0e,0x31,0x20,0x04,0x12,0x28,0x00,0xf0,
-0x3b,0xc0,0x0c,0xa6,0x08,0x85,0x0a,0x46,0x57,0x08,0x2a,0x46,0x10,0x00,0x02,0x11,
-0x00,0x7a,0x99,0xb3,0x00,0x91,0x00,0x54,0x00,0x91,0x00,0x64,0x00,0x38,0x88,0x81,
-0x00,0x20,0x04,0x23,0x00,0xa0,0x19,0x45,0x01,0xb0,0x1c,0xa6,0x08,0x94,0x19,0x55,
-0x57,0x09,0x28,0x45,0x10,0x00,0x03,0x34,0x00,0x08,0x99,0x60,0x00,0x83,0x00,0x92,
-0x00,0x76,0x01,0xa1,0x00,0x05,0x87,0x20,0x00,0x40,0x08,0xcc,0x00,0xf0,0x00,0x63,
-0x02,0xd0,0x09,0x31,0x0a,0x58,0x09,0x21,0x74,0x04,0x5a,0x63,0x00,0x02,0x94,0x10,
-0xb1,0x12,0x00,0x00,0x4b,0xa0,0x00,0x05,0x90,0x3a,0x10,0x02,0x78,0x00,0x00,0xc1,
-0x17,0x10,0x09,0x05,0x01,0xd8,0x1e,0x08,0x99,0x06,0x86,0x00,0x90,0xa0,0xa0,0x09,
-0x62,0x03,0x50,0xc2,0x01,0x01,0x23,0x00,0xf0,0x01,0x0a,0x00,0xc0,0x69,0xa0,0x69,
-0x70,0x09,0x38,0x06,0x50,0x93,0x00,0x00,0x05,0x02,0xfe,0x14,0x06,0xe3,0x07,0x42,
-0x40,0x00,0x60,0x09,0x23,0x00,0xa0,0x59,0x80,0x0a,0x29,0x05,0x60,0xa3,0x00,0x02,
-0x0a,0x8f,0x01,0x01,0x64,0x1e,0x22,0x88,0x60,0x7a,0x1c,0xf8,0x06,0x70,0x09,0x10,
-0x0a,0x00,0xd3,0x58,0xa0,0x83,0xa1,0x09,0x65,0x01,0x60,0x90,0x01,0x22,0x22,0x00,
-0x77,0x77,0x49,0x1a,0x30,0x30,0x00,0x60,0x23,0x00,0xa0,0xc0,0x59,0xa0,0x59,0x90,
-0x0a,0x39,0x05,0x60,0xa3,0x21,0x0b,0x20,0x4a,0x99,0xab,0x1d,0x00,0x65,0x1f,0x00,
-0xab,0x1d,0xfa,0x0a,0x20,0x05,0x34,0x00,0x90,0x09,0x45,0x01,0x80,0x09,0x45,0x04,
-0xa4,0x99,0x45,0x08,0xa1,0x09,0x45,0x18,0x27,0x09,0x45,0x71,0x07,0xb8,0x05,0xf0,
-0x06,0x00,0x10,0x04,0x42,0x00,0xa0,0x09,0x64,0x01,0xb1,0x89,0x54,0x07,0xa4,0x09,
-0x54,0x38,0x09,0x19,0x54,0x30,0xc1,0x06,0x33,0x79,0x99,0xb1,0x61,0x15,0x11,0x82,
-0x77,0x01,0xf1,0x0c,0x40,0x06,0x52,0x00,0xa0,0x09,0x63,0x01,0xb2,0x99,0x62,0x07,
-0xb3,0x09,0x62,0x39,0x0a,0x19,0x62,0x30,0x00,0x09,0x62,0x00,0x90,0x04,0x51,0x0c,
-0x03,0x11,0xb8,0x65,0x15,0x00,0xf9,0x19,0xf0,0x05,0x32,0x00,0xa0,0x09,0x54,0x01,
-0xc2,0x99,0x54,0x08,0x86,0x09,0x54,0x57,0x07,0x29,0x54,0x20,0x23,0x35,0x65,0x15,
-0x11,0xa2,0x54,0x00,0x10,0xb0,0x93,0x0e,0x41,0x99,0x93,0x00,0x20,0x28,0x00,0xf1,
-0x02,0x64,0x00,0xb2,0x99,0x54,0x06,0xb3,0x09,0x54,0x29,0x0a,0x19,0x54,0x40,0x00,
-0x14,0x53,0x34,0x07,0x40,0x02,0xc8,0x00,0x00,0xa6,0x25,0xf7,0x06,0x40,0x00,0x11,
-0x00,0x50,0x00,0x60,0x0a,0x03,0x6a,0x00,0xc0,0x13,0xa0,0x69,0x84,0x8a,0x39,0x07,
-0x51,0xa4,0x31,0x01,0x34,0xc8,0x88,0x60,0x55,0x04,0x00,0x72,0x13,0xe6,0x0c,0x60,
-0x00,0x00,0x76,0xa4,0x00,0x07,0x60,0x08,0x50,0x01,0x07,0x20,0xbb,0x12,0xff,0x02,
-0x05,0x10,0x00,0x00,0x0d,0x50,0x00,0x01,0xa3,0x86,0x00,0x07,0x25,0x15,0x30,0x12,
-0x29,0x03,0x06,0x03,0x01,0xa3,0x0a,0xb1,0x0b,0x30,0x00,0x00,0x77,0xa3,0x00,0x08,
-0x44,0x18,0x30,0x40,0x00,0x1e,0x9a,0x0d,0x14,0x01,0x50,0x00,0x61,0x0c,0x50,0x00,
-0x01,0xa4,0x96,0x50,0x00,0x80,0x34,0x4a,0x64,0x42,0x34,0x44,0x44,0x41,0x72,0x1e,
-0x24,0x04,0x60,0xe5,0x13,0x10,0x72,0x35,0x01,0x10,0x50,0x4f,0x1d,0xb1,0xc1,0x00,
-0x90,0x58,0xa0,0x09,0x39,0x04,0x70,0x91,0x08,0x40,0x02,0x30,0x94,0x8a,0x98,0xd8,
-0x24,0x02,0x1d,0x15,0x00,0x55,0x06,0x10,0x0c,0xd8,0x18,0xbc,0x9a,0x00,0x00,0x06,
-0x80,0x3a,0x10,0x00,0x30,0x00,0x01,0xb5,0x0a,0x14,0x90,0xe4,0x00,0x00,0x78,0x00,
-0xa1,0x40,0x00,0x00,0x95,0xa4,0x00,0x08,0x30,0x07,0x30,0xfe,0x05,0xa6,0x9b,0xc9,
-0x94,0x06,0x24,0x50,0x00,0x07,0x21,0x10,0x7e,0x10,0x05,0xf0,0x00,0x10,0x96,0xac,
-0x10,0x11,0x30,0xff,0x18,0x00,0xc9,0x16,0x2a,0x04,0x20,0x7b,0x06,0x01,0xa8,0x0b,
-0x00,0x8f,0x06,0x90,0x20,0x00,0x00,0x58,0xa1,0x00,0x06,0x80,0x1a,0x5b,0x04,0x05,
-0x87,0x0f,0x30,0x00,0x00,0x70,0x64,0x0b,0xf2,0x09,0x30,0x00,0x00,0x3b,0x29,0x60,
-0x00,0x06,0x00,0x04,0x10,0x08,0x88,0x88,0x88,0x10,0x02,0x33,0x33,0x00,0x00,0x46,
-0x55,0xc0,0xdc,0x1e,0x12,0xa0,0x4a,0x1d,0x11,0x10,0x05,0x03,0x60,0x2d,0x50,0x00,
-0x04,0xa0,0x77,0x62,0x0d,0x21,0x10,0x79,0xa5,0x0b,0x00,0x90,0x0d,0x15,0x07,0x93,
-0x18,0x02,0x3c,0x04,0x01,0x55,0x00,0x60,0x20,0x00,0x00,0x2b,0x2a,0x30,0x54,0x10,
-0xe0,0x10,0x06,0x55,0x55,0x56,0x10,0x33,0x33,0x33,0x30,0x00,0x08,0x89,0x40,0x85,
-0x09,0x00,0x3c,0x04,0x12,0xa0,0x3c,0x04,0x06,0x74,0x03,0xd3,0x0e,0x10,0x09,0x05,
-0x78,0x00,0x90,0xa0,0x91,0x0a,0x53,0x01,0x70,0x7b,0x1b,0x03,0x74,0x03,0x11,0x50,
-0x74,0x03,0xc9,0x00,0xa0,0x5a,0x60,0x0a,0x39,0x07,0x40,0xa4,0x00,0x01,0x07,0x74,
-0x03,0x50,0x04,0x00,0x40,0x00,0x80,0x2e,0x03,0x73,0xd0,0x00,0xa0,0x49,0x80,0x0a,
-0x2a,0x74,0x03,0x37,0x80,0x00,0x50,0x74,0x03,0xf1,0x02,0x21,0x00,0x70,0x00,0x72,
-0x00,0xa0,0x00,0xc4,0x00,0xa0,0x06,0x59,0x20,0xa0,0x46,0x00,0x4a,0x12,0x91,0x20,
-0x00,0x77,0x77,0xb0,0x00,0xaa,0xaa,0x90,0xb6,0x02,0x00,0x21,0x12,0x10,0x20,0xd3,
-0x01,0x01,0x6e,0x00,0x97,0x4a,0x80,0x09,0x2a,0x05,0x60,0x93,0x00,0x01,0x00,0x22,
-0x40,0xa0,0x07,0x88,0x84,0x23,0x00,0x14,0x09,0x23,0x00,0x02,0xe2,0x03,0x24,0x01,
-0x08,0x9c,0x03,0x12,0xa2,0x9c,0x03,0x00,0xf7,0x01,0x50,0x90,0x90,0x09,0x00,0x0a,
-0xfa,0x1a,0xfb,0x01,0xc0,0xb1,0x0a,0x00,0x1f,0x1d,0x50,0xd9,0x15,0x78,0x79,0x09,
-0x00,0xa0,0xd1,0x90,0x62,0x06,0x11,0x00,0x0b,0x00,0xe7,0x18,0x00,0x00,0xd0,0x59,
-0x00,0x05,0xa4,0xaa,0x10,0x1a,0x0a,0x71,0x80,0x15,0x1b,0x10,0x94,0xbe,0x0a,0x52,
-0x09,0x92,0x0a,0x00,0x82,0xbb,0x0f,0xba,0x10,0x90,0x09,0x0a,0x85,0x72,0x19,0x09,
-0x00,0x09,0x91,0x9a,0x0b,0x61,0x04,0x60,0x03,0x00,0x56,0x39,0x93,0x0f,0x72,0x10,
-0x81,0x09,0x09,0x97,0x2a,0x95,0x6b,0x1f,0x1b,0x07,0x37,0x06,0x00,0x50,0x00,0x62,
-0x2a,0x95,0x0a,0x00,0x81,0x0a,0xbb,0x0f,0xb4,0x65,0x19,0x09,0x00,0x06,0x81,0x09,
-0x00,0x06,0x10,0x06,0x69,0x24,0x01,0x32,0x06,0x71,0x05,0x71,0x08,0x00,0x65,0x29,
-0x0a,0x24,0x00,0x00,0xa2,0x0b,0x30,0x2a,0xa5,0x07,0x10,0x16,0xf2,0x08,0x00,0x09,
-0x03,0x88,0x50,0x09,0x00,0x9a,0x10,0x0a,0x43,0x75,0x40,0x02,0x41,0x78,0x00,0x03,
-0x40,0x06,0x00,0x58,0x49,0x57,0x10,0x68,0x73,0x09,0x09,0x00,0x08,0x93,0xbb,0x0f,
-0x15,0x9b,0xbb,0x0f,0x33,0x04,0x60,0x04,0xa0,0x00,0x82,0x0a,0x00,0x81,0x09,0x0a,
-0x95,0x2a,0x95,0xbb,0x0f,0x35,0x08,0x99,0x9c,0x91,0x24,0x4f,0x03,0x88,0x87,0x00,
-0x28,0x00,0x03,0x03,0xfc,0x1a,0x15,0xa9,0x69,0x02,0x00,0x8a,0x03,0x31,0x00,0x56,
-0x29,0xc4,0x00,0x73,0x85,0x81,0x09,0x09,0x10,0x2a,0xa5,0xea,0x0b,0x03,0x6c,0x15,
-0x13,0x05,0x6c,0x15,0xf2,0x04,0x04,0x50,0x0a,0x00,0x56,0x37,0x0c,0x00,0x90,0x08,
-0x0c,0x97,0x81,0x08,0x0b,0x00,0x2b,0xa4,0x0b,0xb2,0x0c,0x00,0x5d,0x12,0xf0,0x10,
-0x70,0x70,0x00,0x00,0x90,0x91,0x00,0x08,0x99,0x88,0x20,0x02,0x20,0x40,0x44,0x66,
-0x3a,0x0a,0x90,0x07,0xa8,0xd8,0x11,0x79,0x0a,0x2b,0xa2,0x90,0xa0,0x00,0x02,0x4f,
-0x0b,0x16,0xb0,0x71,0x15,0x07,0x8b,0x01,0x01,0x7e,0x10,0x00,0x21,0x0d,0x4d,0x72,
-0x19,0x09,0x95,0x8b,0x01,0x00,0x9b,0x00,0x33,0x39,0x09,0x95,0x8b,0x01,0x50,0x62,
-0x2a,0x95,0x09,0x41,0xc1,0x05,0xc3,0x00,0x89,0x96,0x00,0x05,0x60,0x09,0x10,0x04,
-0x80,0x1b,0x00,0x19,0x1a,0xf9,0x05,0x50,0x38,0x80,0x09,0x0a,0x03,0x60,0x91,0x80,
-0x0a,0x5b,0x08,0x00,0x93,0xa0,0xa0,0x55,0x09,0x02,0x86,0x35,0x0c,0xf0,0x02,0x61,
-0x00,0x53,0x83,0xa0,0x0a,0x81,0x08,0x34,0xa8,0x20,0x82,0x49,0x2a,0x69,0x00,0x90,
-0x0a,0x01,0x36,0x70,0x00,0x80,0xdc,0x02,0xf0,0x02,0x02,0x40,0x00,0x54,0x84,0x90,
-0x0a,0x81,0x09,0x29,0xa7,0x30,0xa0,0x0a,0x08,0x94,0x00,0x9d,0x1e,0x90,0x01,0x66,
-0x55,0xa0,0x2a,0x99,0x97,0x04,0x50,0xb2,0x07,0x19,0x97,0x23,0x00,0x40,0x09,0x08,
-0x94,0x00,0x6d,0x12,0xf0,0x13,0x03,0x50,0x00,0x80,0x4c,0x99,0x99,0x03,0x50,0x00,
-0x90,0x18,0x88,0x83,0x02,0x40,0x01,0x50,0x48,0x49,0x03,0x80,0x81,0x09,0x3a,0x80,
-0x73,0x0a,0x03,0x80,0x08,0x94,0x03,0x80,0x91,0x0a,0xf1,0x13,0x07,0x21,0x69,0x00,
-0x07,0xaa,0x6c,0x30,0x07,0x21,0xb7,0xb1,0x03,0x88,0x60,0x12,0x03,0x40,0x01,0x40,
-0x48,0x4b,0x01,0x80,0x81,0x0c,0x4a,0x80,0x73,0x0d,0x01,0x80,0x19,0xa6,0xdb,0x19,
-0x11,0x20,0xe9,0x1d,0xa0,0xd2,0x1d,0x00,0x08,0x4b,0x94,0xa0,0x03,0x01,0x20,0xf2,
-0x04,0x50,0x15,0x05,0x74,0x09,0x26,0x2c,0x0c,0xf1,0x09,0x09,0x09,0x7b,0x36,0x09,
-0x09,0x39,0x26,0x09,0x0b,0x09,0x26,0x02,0x83,0x09,0x26,0x00,0x00,0x09,0x27,0x00,
-0x00,0x07,0x27,0x58,0x0c,0xf1,0x04,0x30,0x04,0x41,0x58,0x77,0x09,0x63,0x90,0x0d,
-0x8a,0x63,0x81,0x09,0x09,0x63,0x2a,0xa2,0x09,0x63,0x08,0x0c,0x73,0x55,0x55,0xb1,
-0x00,0x99,0x99,0xb0,0x08,0x0c,0x10,0x92,0x14,0x0f,0x01,0x2c,0x01,0xe8,0x89,0xc1,
-0x80,0x09,0x09,0x08,0x00,0x91,0x90,0xa0,0x57,0x8c,0x02,0x96,0x2c,0x01,0xf0,0x01,
-0x04,0x60,0x00,0x64,0x73,0x93,0x9a,0x80,0x09,0x00,0xa7,0x20,0x93,0x7a,0x1a,0x95,
-0xe8,0x27,0x29,0x05,0x03,0x27,0x25,0x00,0xee,0x06,0xf5,0x0c,0xa9,0x53,0x8a,0x81,
-0x09,0x00,0xa9,0x00,0x90,0x0a,0x65,0x29,0x5b,0x90,0x67,0x10,0x09,0x03,0x40,0x00,
-0x60,0x46,0x00,0x00,0x03,0xb8,0x89,0x4f,0x01,0x9f,0x93,0x9a,0x81,0x09,0x00,0x97,
-0x30,0xa4,0x9a,0x4f,0x01,0x03,0xf1,0x02,0x51,0x00,0x64,0x83,0xa3,0x9a,0x91,0x08,
-0x10,0xa8,0x20,0x95,0x9a,0x1b,0xa7,0x00,0x90,0xe9,0x18,0x91,0x8a,0x10,0x0b,0x00,
-0x18,0x00,0xa2,0x06,0x60,0x03,0x04,0xa2,0x05,0x25,0x05,0x74,0x09,0x36,0x09,0x0a,
-0x8b,0x36,0x03,0x01,0x93,0x2a,0x36,0x09,0x0a,0x6b,0x26,0x02,0x82,0x0a,0xff,0x00,
-0x25,0x08,0x27,0x31,0x0b,0x50,0x98,0x97,0x00,0x03,0x60,0xba,0x20,0x00,0x26,0x0c,
-0x12,0x96,0x15,0x04,0x04,0xdc,0x06,0x80,0x38,0x71,0x00,0x02,0x91,0x1a,0x00,0x04,
-0x5d,0x20,0x21,0x7a,0x95,0xf7,0x0c,0x00,0xbc,0x05,0x22,0x03,0x40,0xd6,0x06,0x23,
-0x04,0xb8,0x14,0x06,0xf0,0x04,0x78,0x82,0x00,0x06,0x50,0x0a,0x00,0x04,0x83,0x4a,
-0x00,0x00,0x3c,0x50,0x00,0x78,0x8b,0x88,0x92,0x9c,0x21,0x57,0x03,0x55,0x5a,0x20,
-0x07,0x12,0x0c,0x00,0xb8,0x06,0xb2,0x03,0x80,0x1a,0x00,0x04,0x70,0x0b,0x00,0x00,
-0x6b,0x93,0x27,0x17,0x00,0x9b,0x11,0x32,0x10,0x03,0x20,0x13,0x16,0x12,0x06,0x11,
-0x23,0x00,0xc3,0x04,0xf0,0x03,0x69,0x92,0x09,0x00,0x0a,0x01,0x80,0x90,0x00,0xa0,
-0x18,0x09,0x00,0x06,0x99,0x10,0xc9,0x10,0xe4,0x13,0x95,0x00,0x54,0x00,0x90,0x04,
-0x89,0x98,0x29,0x00,0x43,0x1f,0x70,0x01,0x86,0x00,0x70,0x00,0xa1,0x46,0x29,0x03,
-0x70,0x80,0xa0,0x00,0x79,0xa3,0x0d,0x90,0x6c,0x05,0xd0,0x04,0x89,0x98,0x1a,0x00,
-0x01,0x40,0x00,0x60,0x00,0x37,0x00,0x00,0xa0,0x21,0x02,0xfd,0x08,0x30,0x69,0x92,
-0x09,0x54,0x00,0x61,0xa0,0x18,0x09,0x06,0x99,0x10,0x0a,0x1d,0x63,0x63,0x00,0x93,
-0x8a,0x99,0x39,0x32,0x07,0x00,0x4c,0x00,0x30,0xa1,0x46,0x0a,0xc9,0x0b,0xa0,0x79,
-0xa3,0x0a,0x00,0x72,0x00,0xa5,0x89,0x98,0x1a,0x46,0x00,0x11,0x37,0x44,0x00,0x11,
-0x50,0xed,0x00,0x21,0x99,0x97,0x11,0x01,0x23,0x03,0x60,0x31,0x01,0xe0,0x30,0x12,
-0x00,0x00,0xa0,0x46,0x00,0x79,0xd9,0xab,0x94,0x00,0x06,0x86,0x2d,0x08,0xf0,0x10,
-0x47,0x00,0x00,0x73,0x02,0x80,0x00,0x00,0xd9,0xd1,0x00,0x02,0x29,0x2a,0x22,0x00,
-0x67,0x77,0x77,0x60,0x00,0x07,0x98,0x10,0x00,0x08,0x30,0x29,0x00,0x00,0x83,0xb5,
-0x21,0xb0,0x78,0x70,0x00,0x00,0x05,0x87,0x10,0x00,0x06,0x60,0x29,0x95,0x08,0x9f,
-0xa0,0x00,0x04,0x94,0x68,0x00,0x00,0x01,0x43,0x18,0x21,0x06,0x00,0x8b,0x01,0x21,
-0x90,0x2a,0x8b,0x01,0x00,0xca,0x03,0x04,0x9f,0x07,0x75,0x05,0x33,0x60,0x00,0x06,
-0x41,0x20,0x3f,0x08,0x00,0x8b,0x01,0x11,0x05,0x8b,0x01,0x50,0x49,0x00,0x00,0x35,
-0x40,0x5c,0x1d,0x36,0x82,0x03,0x4b,0x8b,0x01,0x05,0xfb,0x0c,0xa0,0x04,0x87,0x10,
-0x00,0x04,0x70,0x1a,0x00,0x00,0x55,0x64,0x13,0x63,0x68,0x81,0x00,0x09,0x99,0x99,
-0xc2,0x17,0x50,0x69,0xc9,0xa1,0x00,0x0a,0x9c,0x01,0xf0,0x02,0xa0,0x00,0x72,0x00,
-0x04,0x89,0x87,0x00,0x00,0x48,0x82,0x00,0x02,0x90,0x0a,0x00,0x03,0xf9,0x03,0x3f,
-0x69,0x83,0x00,0xf4,0x07,0x05,0x20,0x01,0x76,0x3f,0x01,0x00,0x50,0x0d,0xf0,0x05,
-0x90,0xa1,0x46,0x09,0x01,0x75,0x00,0x93,0x77,0x78,0x49,0x02,0x84,0x00,0x90,0x06,
-0x36,0x9a,0x00,0x63,0x3a,0x24,0x71,0x03,0x00,0x54,0x00,0x60,0xa3,0x66,0x85,0x01,
-0xa0,0x69,0x92,0x09,0x57,0x77,0x72,0x90,0x0a,0x07,0x9a,0xb1,0x06,0xf0,0x0d,0x28,
-0x00,0x01,0x01,0xd9,0x99,0x70,0x02,0x87,0x00,0x60,0xa0,0x37,0x0a,0x0a,0x56,0x60,
-0xa0,0x04,0x42,0x1a,0x69,0xd8,0x72,0xa0,0x08,0x05,0x69,0x6e,0x28,0xf1,0x1e,0x05,
-0x56,0x6a,0x01,0xb3,0x34,0x10,0x09,0x99,0x97,0x03,0x61,0x13,0x60,0x39,0x29,0x26,
-0x90,0x63,0x07,0x26,0x90,0x38,0x28,0x26,0x90,0x04,0x61,0x26,0x90,0x69,0x99,0x56,
-0x90,0x00,0x91,0x56,0x90,0x00,0x92,0x76,0x90,0x00,0x90,0x26,0x16,0x11,0x01,0x8e,
-0x00,0xf0,0x01,0x56,0x09,0x09,0x00,0x80,0x90,0xa2,0x65,0x09,0x01,0x64,0x00,0x93,
-0x88,0x89,0x49,0x5e,0x25,0x00,0xd2,0x0f,0x12,0x52,0xe0,0x07,0x10,0x05,0x67,0x19,
-0x31,0x60,0x1a,0x00,0x96,0x26,0x35,0x04,0x94,0x59,0x83,0x01,0x34,0x94,0x00,0x0a,
-0x41,0x22,0x14,0x0a,0x23,0x09,0xf1,0x0b,0x68,0x84,0x00,0x05,0x60,0x0a,0x00,0x04,
-0x93,0x3b,0x00,0x00,0x25,0x51,0x00,0x78,0xb8,0x9b,0x84,0x02,0xc4,0x5b,0x10,0x03,
-0x55,0x57,0xaf,0x13,0x13,0x0a,0xaf,0x13,0x02,0x56,0x03,0x11,0x95,0x87,0x01,0x10,
-0x05,0x07,0x08,0x29,0xa8,0x95,0x9e,0x0e,0x71,0x00,0x58,0x70,0x00,0x04,0x70,0x29,
-0x28,0x06,0x13,0x01,0x3c,0x22,0x00,0x43,0x26,0x14,0x07,0x2a,0x07,0x04,0xc8,0x22,
-0x22,0x68,0x82,0x70,0x00,0x92,0x82,0x3a,0x00,0x00,0x36,0x50,0x00,0x78,0x88,0xf2,
-0x24,0x57,0x02,0x54,0x49,0x30,0x06,0x81,0x18,0x00,0xcd,0x05,0x00,0x9a,0x01,0x00,
-0x5a,0x03,0x40,0x00,0x47,0x61,0x00,0x8f,0x1e,0x20,0x01,0x10,0x5f,0x14,0x15,0x9a,
-0x19,0x19,0x00,0x42,0x25,0x09,0x7e,0x03,0x30,0x68,0x83,0x00,0x2e,0x20,0x42,0x23,
-0x33,0x33,0x31,0x19,0x06,0x45,0x08,0x10,0x03,0x80,0x32,0x20,0x35,0x30,0x69,0xa2,
-0x28,0x03,0x22,0x9a,0x10,0xe6,0x04,0x52,0x21,0x94,0x88,0x86,0x29,0x28,0x03,0x11,
-0x03,0x5d,0x14,0x80,0x20,0x81,0x64,0x0a,0x08,0x09,0x00,0xa0,0x3f,0x2b,0x70,0x06,
-0x40,0xa0,0x80,0x08,0x92,0x08,0x4a,0x20,0x02,0xd4,0x1a,0x61,0x10,0x04,0x61,0x00,
-0x64,0x72,0x94,0x12,0x73,0x97,0x20,0x90,0x09,0x1a,0x96,0x00,0x10,0x05,0x12,0x50,
-0xb5,0x14,0x10,0x80,0x04,0x06,0x60,0x60,0x00,0x54,0x83,0x90,0x0a,0xb0,0x12,0x51,
-0x20,0x90,0x09,0x2a,0x77,0x5b,0x26,0x50,0x02,0x50,0x00,0x80,0x37,0xa5,0x0b,0x07,
-0x5f,0x06,0x01,0x46,0x00,0x02,0x3c,0x06,0xb0,0x80,0x13,0x34,0x43,0x02,0x66,0x56,
-0x80,0x3a,0x99,0xa6,0x39,0x11,0x31,0x29,0x99,0x96,0x23,0x00,0xf1,0x07,0xb0,0x09,
-0x81,0x0a,0x10,0x97,0x30,0xb0,0x09,0x08,0x95,0x00,0x90,0x23,0x22,0x33,0x04,0x5a,
-0x25,0x90,0x79,0x90,0x3b,0x20,0x3f,0x69,0x80,0x03,0x8c,0x00,0x01,0xc1,0x04,0x04,
-0xb9,0x9a,0x70,0x55,0x00,0x18,0x05,0x50,0x02,0x80,0x82,0x06,0xe0,0x04,0x14,0x84,
-0x90,0x82,0x81,0x09,0x08,0x27,0x30,0xa0,0x72,0x08,0x94,0xe2,0x0b,0x00,0x5f,0x11,
-0xf1,0x10,0x10,0x5b,0x99,0xd1,0x05,0x40,0x08,0x10,0x28,0x88,0x80,0x03,0x40,0x02,
-0x30,0x58,0x48,0x04,0x50,0x90,0x0a,0x04,0x50,0x82,0x0a,0x04,0x50,0x1a,0x94,0x04,
-0x50,0x41,0x30,0x01,0x7d,0x06,0x92,0x4b,0x00,0x07,0x3a,0x94,0x90,0x03,0x02,0x10,
-0x78,0x1e,0x53,0xa9,0x0a,0x00,0x00,0x45,0x6f,0x0f,0xc7,0xe0,0x09,0x96,0x09,0x48,
-0x09,0x00,0x55,0x09,0x19,0x00,0x20,0xa9,0x07,0xf0,0x03,0x35,0x63,0x07,0x00,0x13,
-0x67,0x09,0x00,0x00,0xb0,0x09,0x75,0x08,0xb3,0x09,0x32,0x67,0x0a,0x20,0x00,0x00,
-0x34,0x09,0x19,0x9c,0x3f,0x27,0x00,0xe7,0x0a,0x10,0x58,0x50,0x00,0xf9,0x03,0x92,
-0x0a,0x00,0x05,0xd1,0x0a,0x95,0x48,0x2a,0x09,0x00,0x60,0x03,0x19,0x00,0x08,0x00,
-0x06,0xef,0x18,0x31,0x48,0x95,0x07,0xe5,0x2d,0xfd,0x00,0x01,0xc0,0x0a,0x96,0x0a,
-0x86,0x09,0x00,0x81,0x07,0x19,0x00,0x02,0x33,0x45,0x0c,0x09,0x00,0x61,0x0f,0x70,
-0x01,0x98,0xd1,0x0a,0x00,0x00,0x2a,0x8b,0x1f,0xc0,0x60,0x0d,0x92,0x08,0x39,0x30,
-0x90,0x03,0x30,0x04,0x08,0x00,0x07,0x20,0x20,0x00,0x0b,0x2a,0x00,0x61,0xb2,0x03,
-0xa0,0x00,0x01,0x78,0x96,0x2c,0xf1,0x0c,0x14,0x19,0xa8,0x09,0x36,0x00,0x54,0x09,
-0x36,0x00,0xa0,0x0b,0x76,0x02,0xe0,0x0a,0x56,0x09,0x47,0x09,0x36,0x37,0x09,0x09,
-0x36,0x10,0x01,0x32,0x26,0x10,0x26,0x87,0x05,0xfb,0x0b,0x01,0x11,0x04,0x34,0x17,
-0x7a,0x0a,0x46,0x00,0x83,0x0c,0x86,0x03,0xc6,0x0b,0x66,0x1a,0x08,0x2a,0x46,0x21,
-0x00,0x14,0x22,0x00,0x59,0x61,0x0f,0x52,0x00,0x00,0x42,0x98,0xd0,0x07,0x2d,0xf4,
-0x00,0x54,0x59,0x00,0xb7,0x23,0x90,0x46,0xa0,0x09,0x19,0x04,0x60,0x91,0x10,0x01,
-0x4a,0x07,0xf8,0x07,0x16,0x66,0x00,0x70,0x22,0xb0,0x0a,0x00,0x65,0x36,0xa0,0x3c,
-0x71,0x3a,0x29,0x08,0x40,0xa3,0x00,0x01,0x05,0x02,0x06,0x1b,0xfb,0x06,0x01,0x01,
-0x22,0x00,0x51,0x66,0xd0,0x0a,0x00,0x47,0x02,0xa0,0x1d,0x43,0x79,0x0a,0x2a,0x10,
-0x95,0x20,0x14,0x99,0x08,0xf1,0x09,0x07,0x88,0x10,0x60,0x00,0x0b,0x10,0xa0,0x00,
-0x49,0x39,0xc0,0x02,0xab,0x10,0xa0,0x2a,0x01,0x80,0xa0,0x00,0x45,0x55,0x50,0xd8,
-0x27,0x22,0xba,0xaa,0xac,0x2a,0x02,0x72,0x2f,0xf0,0x00,0x31,0x99,0xd0,0x0a,0x00,
-0x37,0x48,0xa0,0x2a,0x90,0x09,0x2a,0x04,0x60,0x91,0xe0,0x02,0x35,0xb9,0x99,0x80,
-0x75,0x2d,0x00,0xdd,0x22,0xf2,0x00,0x71,0x89,0xd1,0x0a,0x00,0x37,0x59,0xa0,0x2a,
-0xa0,0x09,0x2a,0x04,0x70,0x91,0xeb,0x1e,0x19,0x80,0x5a,0x29,0x01,0x46,0x00,0xa0,
-0x36,0x49,0xa0,0x2b,0x80,0x0a,0x2a,0x16,0x50,0xa3,0xb6,0x01,0x81,0x39,0x89,0x10,
-0x0b,0x00,0x28,0x00,0xb2,0xdf,0x2c,0xf4,0x15,0x01,0x20,0x05,0x42,0x07,0x97,0x09,
-0x63,0x00,0x64,0x09,0x63,0x00,0xb3,0x99,0x63,0x02,0xe2,0x09,0x63,0x0a,0x38,0x09,
-0x63,0x37,0x08,0x19,0x63,0x00,0x00,0x09,0x63,0x00,0x00,0x07,0x63,0xbb,0x2d,0xf1,
-0x05,0x38,0xa8,0x09,0x63,0x00,0xa3,0x89,0x63,0x07,0x96,0x09,0x63,0x57,0x08,0x29,
-0x63,0x10,0x00,0x22,0x42,0xe3,0x22,0x71,0x05,0xaa,0x00,0x00,0x78,0x02,0xa1,0x48,
-0x01,0x01,0x4a,0x01,0xf1,0x07,0x08,0x00,0x0a,0x47,0x80,0x05,0x50,0x28,0x00,0xc6,
-0x13,0x90,0x55,0xa3,0x69,0x19,0x05,0x50,0x91,0x00,0x01,0x09,0x88,0x03,0x00,0x83,
-0x1d,0xf0,0x03,0xaa,0x00,0x00,0x01,0xb2,0x00,0x00,0x2b,0xb1,0x00,0x06,0x91,0x2a,
-0x30,0x01,0x05,0x20,0x10,0xb8,0x05,0x41,0x79,0x9a,0xa9,0x94,0x9f,0x1d,0xfe,0x03,
-0x02,0xb4,0x00,0x00,0x7a,0xb5,0x00,0x06,0x34,0x15,0x40,0x23,0x39,0x53,0x31,0x46,
-0x55,0x66,0xb8,0x0e,0x01,0x48,0x00,0xa3,0xcb,0x00,0x00,0x29,0xd1,0x00,0x07,0x73,
-0x28,0x40,0xb4,0x07,0x0e,0xb8,0x0e,0x10,0x48,0xc1,0x08,0xf0,0x0c,0x03,0xb2,0x00,
-0x00,0x19,0xab,0x30,0x00,0x07,0x26,0x06,0x20,0x03,0x33,0xb3,0x33,0x00,0x55,0x55,
-0x56,0x61,0x00,0x19,0x89,0x40,0x00,0x08,0xb0,0x04,0x14,0x75,0x7b,0x0d,0x00,0xe1,
-0x07,0xf1,0x06,0x99,0xd1,0x09,0x00,0x00,0x38,0x00,0x90,0x00,0x1b,0x90,0x09,0x00,
-0x1a,0x16,0x50,0xd9,0x11,0x07,0x01,0x09,0x08,0x12,0x28,0x04,0x8a,0xe1,0x07,0x01,
-0x13,0x01,0x10,0x88,0x63,0x1b,0x96,0xb0,0x00,0x01,0x97,0x89,0x00,0x06,0x10,0x02,
-0x76,0x0e,0x04,0x04,0x00,0x03,0x01,0x00,0x01,0xaa,0x00,0x72,0x19,0xd1,0x00,0x07,
-0x82,0x39,0x40,0xc0,0x14,0x86,0xb9,0x94,0x06,0x23,0x60,0x00,0x07,0x20,0xc2,0x0e,
-0x04,0xfa,0x00,0x31,0x01,0x89,0xb6,0xf0,0x2d,0x01,0x4c,0x00,0x25,0x07,0x30,0xc1,
-0x27,0x04,0x3a,0x25,0x04,0x28,0x00,0x84,0x02,0x98,0xa7,0x00,0x05,0x10,0x02,0x30,
-0xe7,0x23,0x0d,0xdd,0x15,0x00,0x9c,0x0b,0xf2,0x06,0x05,0xa2,0x00,0x06,0xa6,0x97,
-0x10,0x12,0x00,0x01,0x10,0x89,0x99,0x99,0x90,0x03,0x33,0x44,0x00,0x04,0x55,0x78,
-0x03,0x04,0x46,0x18,0x02,0x22,0x01,0xfd,0x06,0x04,0xb2,0x00,0x00,0x29,0x9b,0x40,
-0x00,0x06,0x10,0x05,0x20,0x07,0x77,0x77,0x77,0x10,0x22,0x11,0x22,0x20,0x22,0x01,
-0x00,0xf8,0x00,0x31,0x51,0x88,0xd0,0x84,0x02,0x00,0xf3,0x07,0x97,0xb7,0x00,0xa0,
-0x55,0xa0,0x0a,0x19,0x02,0x80,0x18,0x2a,0xff,0x07,0x06,0x67,0x00,0x80,0x22,0xc0,
-0x0a,0x00,0x57,0x00,0xa0,0x2b,0xa0,0x0a,0x2a,0x03,0x70,0xa1,0x00,0x00,0x05,0x01,
-0x28,0x03,0x03,0xb7,0x00,0xa0,0x1c,0x70,0x09,0x1a,0x18,0x30,0x93,0x10,0x02,0x28,
-0x03,0x13,0x70,0xdf,0x2f,0x30,0x99,0xd1,0x0a,0xea,0x53,0xa6,0x1b,0x80,0x0a,0x1a,
-0x26,0x50,0xa2,0x10,0x02,0x06,0x00,0x03,0x12,0xa0,0x00,0x03,0x16,0x41,0x23,0x00,
-0x76,0x0a,0x27,0x50,0xa3,0x10,0x02,0x04,0x00,0x03,0x1a,0xa0,0x5a,0x2c,0xf8,0x09,
-0x90,0xa0,0x00,0x81,0x36,0x0a,0x00,0x0c,0x28,0x70,0xd9,0x12,0xa8,0xaa,0x09,0x00,
-0x82,0xa6,0x63,0x90,0x02,0x01,0x00,0x19,0x75,0x0e,0xf5,0x0e,0x04,0x41,0x4c,0x7c,
-0x19,0x72,0x09,0x19,0x09,0x72,0x0a,0x09,0x0b,0xa2,0x0e,0x0e,0x0b,0x92,0x4a,0x8a,
-0x49,0x72,0x81,0xd1,0x89,0x72,0x10,0x10,0x19,0xe9,0x2f,0xf1,0x07,0x01,0x01,0x04,
-0x51,0x3b,0x6c,0x09,0x73,0x09,0x0a,0x0b,0xa3,0x0e,0x3d,0x1a,0x73,0x74,0xd2,0x79,
-0x73,0x20,0x10,0x3e,0x12,0x09,0xff,0x18,0xf0,0x01,0x06,0x84,0x88,0x10,0x00,0x83,
-0x0b,0x00,0x03,0xd3,0x9a,0x00,0x08,0x0b,0x52,0x50,0x81,0x06,0x01,0xba,0x29,0x0e,
-0xcb,0x02,0xf5,0x04,0x53,0xb7,0xa6,0x0a,0x09,0x17,0x30,0xa0,0xd4,0xb6,0x0a,0x63,
-0xc4,0x90,0xa3,0x01,0x01,0x06,0x01,0xa3,0x0b,0x10,0x90,0x5f,0x1f,0xf6,0x0e,0x30,
-0x04,0x00,0x04,0x51,0x0a,0x00,0x69,0x9b,0x0a,0x00,0x00,0x56,0x0a,0x00,0x00,0xc0,
-0x09,0x96,0x09,0x95,0x09,0x00,0x66,0x0a,0x09,0x00,0x30,0x01,0xbc,0x05,0xf1,0x08,
-0x18,0x80,0x04,0x00,0x36,0x64,0x0a,0x00,0x23,0x77,0x0a,0x00,0x01,0xd0,0x0a,0x95,
-0x2b,0x49,0x0a,0x00,0x60,0x02,0x15,0xaf,0x25,0x08,0xe1,0x32,0x60,0x08,0x82,0x04,
-0x30,0x48,0x88,0xdd,0x32,0xf0,0x28,0x05,0xb7,0x03,0xd4,0x05,0x40,0x49,0x08,0x35,
-0x40,0x20,0x10,0x03,0x10,0x00,0xa0,0x19,0x00,0x01,0xe2,0x6c,0x00,0x09,0x2a,0x92,
-0xa0,0x01,0x01,0x00,0x00,0x08,0x82,0x05,0x20,0x38,0x87,0x06,0x30,0x00,0x38,0x06,
-0xb7,0x02,0xd4,0x06,0x30,0x3a,0x19,0x36,0x30,0x30,0x00,0x02,0x10,0x03,0x1a,0x15,
-0x40,0x02,0xb3,0x00,0x01,0x8c,0x30,0xf0,0x18,0x10,0x02,0x40,0x05,0x50,0x04,0x32,
-0x03,0x52,0x09,0x54,0x16,0x78,0x09,0x44,0x00,0x64,0x0b,0x84,0x00,0xd0,0x0a,0x74,
-0x06,0x96,0x09,0x44,0x29,0x09,0x09,0x44,0x20,0x02,0x09,0x44,0x00,0x00,0x09,0x44,
-0x35,0x03,0xf0,0x03,0x07,0x83,0x00,0x52,0x77,0x70,0x09,0x01,0x2c,0x00,0x90,0x0b,
-0x64,0x99,0x1a,0x29,0x30,0x94,0xf9,0x01,0xfa,0x13,0x01,0x90,0x20,0x00,0x9b,0x20,
-0x00,0x95,0x0a,0x40,0x22,0x00,0x04,0x06,0x83,0x00,0x51,0x67,0x70,0x0a,0x02,0x2c,
-0x00,0xa0,0x0b,0x64,0x9a,0x1a,0x39,0x20,0xa4,0x10,0x03,0x09,0xb3,0x04,0xf1,0x15,
-0x05,0x82,0x05,0x43,0x05,0x53,0x09,0x54,0x04,0x58,0x09,0x54,0x00,0x65,0x29,0x54,
-0x00,0xd4,0x69,0x54,0x07,0x78,0x09,0x54,0x39,0x08,0x19,0x54,0x10,0x00,0x09,0x54,
-0x00,0x00,0x08,0x54,0x42,0x02,0x20,0x55,0x40,0xda,0x35,0x41,0x00,0x04,0x99,0xc8,
-0xa6,0x03,0x84,0x00,0x78,0xa5,0x00,0x08,0x23,0x15,0x30,0x48,0x0c,0x70,0x06,0x83,
-0x00,0x71,0x99,0x90,0x09,0x94,0x2b,0x9d,0x0b,0x70,0x09,0x0a,0x28,0x40,0x92,0x16,
-0x02,0xac,0x12,0x00,0x43,0x04,0x30,0x70,0x00,0x03,0xc9,0x2e,0xf2,0x03,0x01,0xa3,
-0x00,0x01,0x79,0xb5,0x00,0x07,0x20,0x04,0x40,0x68,0x88,0x88,0x84,0x01,0x19,0x20,
-0x55,0x08,0x01,0x2d,0x23,0x04,0x10,0x0b,0xf3,0x0a,0x70,0x00,0x03,0x98,0x9b,0x00,
-0x00,0x06,0xc2,0x00,0x07,0x94,0x6a,0x30,0x35,0x44,0x44,0x51,0x34,0x59,0x74,0x41,
-0x04,0x9b,0xa9,0xd4,0x2f,0x02,0x9d,0x07,0x00,0x28,0x00,0xb0,0x02,0x88,0x9a,0x00,
-0x00,0x03,0xb4,0x00,0x04,0x97,0x98,0xa7,0x0a,0x10,0x20,0x15,0x04,0x2a,0x04,0x13,
-0x15,0x04,0x01,0x01,0x00,0xf0,0x04,0x58,0x50,0x00,0x04,0x98,0xa7,0x00,0x00,0x29,
-0xc0,0x00,0x08,0x71,0x58,0x20,0x78,0x88,0x88,0x80,0x1a,0x02,0xb4,0x06,0x9a,0x9d,
-0x00,0x04,0x88,0x8d,0x00,0x0b,0x21,0x11,0x41,0x07,0x06,0x80,0x00,0xf3,0x09,0x04,
-0xc3,0x00,0x05,0xa7,0x89,0x20,0x03,0x00,0x01,0x20,0x68,0x8b,0xa8,0x83,0x00,0x2a,
-0x81,0x00,0x03,0x91,0x2a,0x10,0x04,0x4d,0x09,0xf0,0x06,0x04,0x85,0x00,0x60,0x88,
-0x82,0x09,0x00,0x2b,0x00,0x90,0x59,0xa3,0x09,0x25,0x00,0x40,0x95,0x99,0x88,0x29,
-0xe4,0x04,0x11,0x0a,0x99,0x2c,0x00,0x63,0x18,0x0d,0xcf,0x00,0xaa,0x95,0x6a,0x30,
-0x13,0x22,0x22,0x30,0x57,0x66,0x67,0x8e,0x05,0x00,0x63,0x28,0xf4,0x0b,0x54,0x00,
-0x50,0x25,0x50,0x09,0x17,0x7b,0x30,0x90,0x00,0xb0,0x09,0x00,0x67,0x00,0x90,0x3a,
-0xa0,0x09,0x1a,0x03,0x80,0x91,0x10,0x02,0x3f,0x07,0xfb,0x05,0x06,0x83,0x00,0x62,
-0x88,0x90,0x0a,0x00,0x1b,0x00,0xa0,0x0c,0x70,0x0a,0x2a,0x29,0x30,0xa3,0x00,0x02,
-0xd8,0x01,0x00,0xa2,0x08,0xf5,0x0a,0x58,0x8d,0x09,0x10,0x00,0x0a,0x08,0x10,0x69,
-0xa7,0x08,0x10,0x00,0xa0,0x08,0xa6,0x06,0x50,0x08,0x10,0x48,0x00,0x08,0x10,0x30,
-0x6a,0x01,0x11,0x02,0xa8,0x1c,0x31,0x19,0x9d,0x19,0xb4,0x54,0x90,0x29,0x99,0x0a,
-0x49,0x00,0x73,0x0b,0x59,0x01,0x23,0x19,0x46,0x10,0x09,0x09,0x22,0xa8,0x1c,0x16,
-0x01,0xc1,0x30,0xc1,0xa2,0x89,0xb3,0x4a,0x00,0x74,0x34,0xa0,0x29,0x00,0x0a,0x1a,
-0xef,0x03,0x1a,0x0a,0xff,0x34,0x6f,0x14,0x4b,0x00,0x91,0x38,0x86,0xff,0x34,0x03,
-0x03,0xe4,0x30,0xb0,0x37,0x9d,0x69,0xb0,0x1c,0x30,0x0a,0x3a,0x20,0x00,0xa0,0xe8,
-0x2e,0x30,0x55,0x55,0xa0,0x7d,0x2f,0x14,0xb0,0x05,0x2c,0xd2,0x81,0x88,0xc1,0x0a,
-0x28,0x8b,0x59,0xa0,0x0a,0x30,0x0a,0x2a,0x30,0x82,0x13,0x09,0x22,0x35,0x00,0x0f,
-0x39,0xf0,0x06,0x88,0xd1,0x09,0x15,0x5b,0x00,0x90,0x39,0x55,0x99,0x05,0x70,0x00,
-0x94,0x50,0x02,0x09,0x00,0x02,0x80,0x40,0xfa,0x02,0xa1,0x94,0x1a,0x30,0x22,0x00,
-0x04,0x01,0x11,0x05,0x61,0x1d,0x35,0xf1,0x05,0x19,0x09,0x72,0x49,0xb6,0x69,0x72,
-0x00,0xa1,0x29,0x72,0x05,0x50,0x09,0x72,0x29,0x00,0x09,0x72,0x30,0x7c,0x04,0x12,
-0x08,0xfb,0x2b,0x04,0xd7,0x00,0xde,0x67,0xa2,0x89,0xb0,0x1a,0x00,0x74,0x11,0x90,
-0x29,0x07,0x8a,0x1a,0x1d,0x35,0xd0,0xc2,0x0a,0x25,0x5a,0x48,0xa0,0x09,0x46,0x9a,
-0x19,0x50,0x00,0xa2,0x28,0x2f,0x09,0x91,0x00,0x12,0x04,0xbe,0x32,0x11,0x20,0xc6,
-0x32,0x00,0x43,0x04,0x25,0x18,0x07,0xaf,0x34,0x81,0x02,0x77,0x77,0x00,0x00,0x22,
-0x28,0x20,0x24,0x00,0x10,0x09,0x9d,0x33,0xf1,0x01,0x99,0x94,0x02,0x55,0x56,0x10,
-0x01,0x44,0x37,0x50,0x06,0xa9,0xaa,0x30,0x08,0x20,0xe1,0x19,0x22,0x40,0x05,0x95,
-0x25,0x47,0x10,0x05,0x99,0x9d,0xec,0x11,0x03,0x4f,0x0c,0x70,0x25,0x55,0x50,0x00,
-0x01,0x33,0x3b,0xf9,0x16,0x10,0xd0,0x75,0x13,0x00,0x45,0x13,0x41,0x88,0x20,0x03,
-0x55,0x32,0x2f,0x10,0xa2,0x93,0x04,0x06,0x0f,0x26,0x83,0x02,0x55,0x55,0x00,0x01,
-0x33,0x39,0x20,0x95,0x00,0x05,0x0b,0x33,0x0c,0x6e,0x31,0x02,0xfb,0x00,0x11,0x0a,
-0xd2,0x01,0x56,0xb0,0x0a,0x00,0x74,0x00,0xd2,0x01,0x08,0x93,0x32,0xe1,0x99,0xb5,
-0x0a,0x38,0x9c,0x10,0xa0,0x07,0x60,0x0a,0x19,0x50,0x00,0xa1,0xb4,0x2d,0x37,0x43,
-0xa0,0x0a,0xaf,0x01,0x36,0x05,0x00,0x8a,0x9a,0x2e,0x32,0x00,0x99,0x87,0x9a,0x2e,
-0x66,0x89,0x9a,0x59,0x00,0x00,0x02,0x82,0x29,0xe0,0x48,0x86,0x07,0x00,0xa1,0x10,
-0x0a,0x00,0xa9,0x97,0x09,0x95,0xa0,0x00,0xf8,0x1f,0x90,0x39,0x00,0x01,0x22,0x24,
-0x00,0x04,0x77,0x7c,0xce,0x26,0x05,0xba,0x0a,0xf1,0x01,0x38,0x87,0x08,0x00,0x82,
-0x10,0x0a,0x00,0x84,0x32,0x0a,0x10,0x97,0x75,0x0a,0x95,0x48,0x00,0x0e,0x82,0x29,
-0x00,0x5a,0x29,0xf2,0x06,0x5c,0x87,0x09,0x09,0xa0,0x00,0x90,0x9c,0x66,0x0b,0x49,
-0xb3,0x20,0xb4,0x9a,0x00,0x09,0x09,0xc9,0x92,0x90,0x8e,0x34,0x20,0x90,0x90,0x71,
-0x2e,0xf0,0x05,0x30,0x43,0x4c,0x55,0x09,0x45,0xc5,0x50,0xc8,0x5b,0x32,0x0b,0x65,
-0xc6,0x82,0x94,0x51,0x10,0x03,0x22,0x56,0x0d,0x01,0xa8,0x0a,0x21,0x06,0x30,0xab,
-0x0a,0xf1,0x26,0x41,0x2c,0x98,0x0a,0x46,0xd9,0x80,0xda,0x6a,0x00,0x0a,0x46,0xc9,
-0x92,0x94,0x60,0x00,0x02,0x12,0x04,0x20,0x03,0x20,0x6a,0x99,0xb4,0x06,0x30,0x05,
-0x40,0x38,0x99,0x81,0x22,0x20,0x06,0xc6,0x62,0x09,0xa0,0x00,0x09,0xd8,0x73,0x7b,
-0xa1,0x00,0x29,0xa0,0x00,0x09,0xb9,0x88,0x73,0x30,0x02,0x27,0x06,0xf0,0x07,0x33,
-0x10,0x50,0x0c,0x66,0x20,0xa0,0x0b,0x44,0x15,0xb0,0x0b,0x54,0x13,0xa0,0x0b,0x45,
-0x60,0x90,0x03,0x43,0x20,0x1f,0x1b,0x02,0x7f,0x0a,0x03,0x8e,0x1e,0xc0,0x07,0x88,
-0x30,0x60,0x0a,0x11,0x00,0xa0,0x0d,0x99,0x49,0xc0,0xb2,0x0c,0x23,0x0b,0x98,0x20,
-0x16,0x0b,0x6a,0x28,0x70,0x07,0x88,0x30,0x70,0xa1,0x10,0x0a,0x27,0x00,0x00,0x6b,
-0x25,0x21,0x98,0x60,0xe5,0x21,0x03,0x74,0x1f,0x02,0x25,0x14,0xf1,0x00,0x02,0x32,
-0x05,0x25,0x1b,0x64,0x09,0x36,0x18,0x00,0x09,0x36,0x1c,0x83,0x8a,0x08,0x00,0x11,
-0x18,0xe1,0x31,0x13,0x19,0xab,0x0b,0x20,0x08,0x26,0x73,0x00,0xf6,0x02,0x33,0x30,
-0x43,0x3c,0x54,0x0a,0x45,0xc5,0x37,0xb4,0x5b,0x31,0x1a,0x45,0xc6,0x82,0xa5,0xff,
-0x00,0x11,0x73,0xd8,0x09,0x00,0xff,0x00,0xf0,0x09,0x42,0x2c,0x97,0x0a,0x45,0xa0,
-0x00,0xa4,0x5d,0x95,0x8b,0x45,0xa0,0x20,0x94,0x48,0x87,0x19,0x44,0x04,0x00,0x75,
-0x40,0xa0,0x73,0x0c,0x22,0x89,0x20,0x82,0x0a,0xf3,0x0c,0x2c,0x98,0x0a,0x55,0xd9,
-0x58,0xb4,0x5a,0x00,0x09,0x45,0xc9,0x92,0x95,0x50,0x02,0x24,0x41,0x03,0x77,0x6a,
-0x30,0x49,0x99,0xb2,0x08,0x10,0xef,0x2e,0xf1,0x10,0x41,0x1d,0x97,0x0a,0x55,0xd8,
-0x58,0xb4,0x5a,0x10,0x09,0x45,0xc8,0x92,0xa5,0x50,0x00,0x03,0x21,0x04,0x99,0x9a,
-0x10,0x73,0x00,0x73,0x07,0x30,0x07,0x20,0x28,0x3f,0x1d,0x00,0x39,0x27,0x02,0x6f,
-0x2d,0x00,0x08,0x00,0x25,0x98,0x76,0x45,0x29,0x22,0x79,0x9c,0x12,0x2f,0x01,0x02,
-0x05,0x72,0xa8,0x87,0x00,0x04,0xa8,0x89,0x10,0x18,0x29,0x11,0xb9,0x18,0x29,0x09,
-0x47,0x2d,0x00,0x1f,0x2d,0x62,0x41,0x11,0x00,0x06,0x98,0x86,0x56,0x2f,0x22,0x07,
-0x30,0x6a,0x18,0xe0,0x59,0x84,0x00,0x03,0x80,0x09,0x10,0x03,0x80,0x0a,0x10,0x00,
-0x48,0x83,0x97,0x00,0x12,0x60,0x40,0x03,0x32,0xa9,0x99,0x50,0x09,0x00,0x33,0x59,
-0x99,0x80,0x15,0x1f,0x0c,0xc6,0x28,0x02,0x6e,0x24,0x12,0x98,0x38,0x2e,0x04,0x9d,
-0x00,0x16,0x11,0x36,0x32,0x01,0x9d,0x00,0x22,0x61,0x11,0x9d,0x00,0x21,0xb9,0x99,
-0xfe,0x27,0x00,0xff,0x19,0x11,0x04,0x5f,0x1e,0x22,0x04,0x60,0x04,0x00,0x03,0x9d,
-0x00,0x10,0x50,0xad,0x00,0x30,0x87,0x00,0x05,0xc5,0x00,0x04,0x40,0x00,0x13,0x10,
-0x76,0x28,0x03,0x5e,0x32,0x01,0xce,0x03,0xc0,0x07,0x64,0x43,0x00,0x00,0x8a,0x99,
-0x60,0x00,0x05,0x88,0x88,0x17,0x19,0x12,0x89,0xdd,0x29,0x41,0x78,0x88,0xc0,0x00,
-0x0a,0x04,0x13,0xa0,0xa9,0x2e,0x07,0x5a,0x31,0x51,0xc7,0x73,0x09,0x0a,0x22,0xe3,
-0x2f,0x02,0x47,0x32,0x04,0xe9,0x2a,0x00,0x5c,0x02,0x01,0x34,0x02,0x21,0x30,0xa0,
-0x34,0x02,0x11,0x70,0xa6,0x23,0x0c,0x19,0x24,0x71,0x40,0x04,0x99,0x95,0x19,0x00,
-0x08,0x92,0x06,0x30,0x90,0x0d,0x92,0xc2,0x11,0x01,0x43,0x18,0x3d,0x3c,0x9c,0x60,
-0xee,0x2d,0x50,0x08,0x00,0x5b,0x9b,0x3a,0x36,0x5d,0x10,0xa5,0x3a,0x5d,0x31,0x7c,
-0x9b,0x5a,0x18,0x00,0x32,0x06,0x20,0x08,0xba,0x20,0x20,0x30,0x09,0x49,0x17,0x00,
-0x97,0x03,0xf3,0x0d,0x32,0x38,0x88,0x29,0x54,0x08,0x08,0x09,0x54,0x09,0x09,0x0b,
-0x84,0x09,0x09,0x0b,0x74,0x09,0x09,0x09,0x54,0x3b,0x9b,0x49,0x54,0x00,0x00,0x09,
-0x04,0x00,0xc0,0x00,0x10,0x38,0x88,0x50,0x60,0x30,0x30,0x0a,0x09,0x09,0x39,0x46,
-0x24,0x22,0x3b,0x9a,0xdd,0x34,0x84,0x56,0x55,0xa0,0x0a,0x99,0x97,0x01,0x90,0xd9,
-0x36,0x70,0x73,0xb9,0xb5,0x0a,0x09,0x09,0x49,0x23,0x00,0x31,0x3d,0x8c,0x70,0xf7,
-0x02,0x18,0xc9,0xa2,0x0a,0xf6,0x0e,0x02,0x22,0x05,0x51,0x38,0x87,0x09,0x72,0x08,
-0x08,0x09,0x72,0x09,0x0a,0x59,0x72,0x09,0x09,0x39,0x72,0x09,0x09,0x09,0x72,0x4b,
-0x9a,0x49,0x72,0x00,0xd2,0x05,0xf0,0x06,0x00,0x13,0x33,0x04,0x51,0x28,0x57,0x0a,
-0x73,0x09,0x0a,0x7a,0x73,0x09,0x09,0x2a,0x73,0x4c,0x8c,0x3a,0x73,0x8e,0x0a,0x2a,
-0x00,0x69,0x52,0x0a,0xf5,0x05,0x13,0x33,0x20,0x52,0x75,0x73,0x2a,0x09,0x09,0x16,
-0xa0,0x90,0x92,0x6a,0x1a,0x4b,0x42,0xa1,0x33,0x21,0x38,0x0b,0x14,0xc8,0x38,0x0b,
-0xd2,0x33,0xb9,0x95,0x1a,0x09,0x09,0x28,0xa0,0x90,0x92,0x7a,0x3c,0x8d,0x59,0x01,
-0x61,0x49,0x89,0x20,0x0b,0x00,0x09,0x47,0x2f,0x21,0x78,0x50,0xa3,0x39,0x00,0x08,
-0x02,0xd6,0x90,0x26,0x00,0x00,0xa0,0x26,0x00,0x07,0xd9,0xac,0x50,0x00,0x03,0x5f,
-0x15,0x01,0xdc,0x00,0xa1,0x60,0x50,0x00,0x03,0xb4,0xa5,0x00,0x04,0x4b,0x43,0x37,
-0x15,0x22,0x03,0x44,0x39,0x0c,0x18,0x07,0x39,0x0c,0x0f,0x48,0x00,0x01,0xc0,0x50,
-0x13,0x00,0x00,0xa0,0x37,0x00,0x69,0xb9,0xab,0x94,0x04,0x56,0x11,0x22,0x10,0x01,
-0xae,0x12,0xb5,0xa0,0x0a,0x10,0x07,0x88,0x88,0x60,0x68,0x88,0x89,0x96,0x2d,0x30,
-0x16,0x06,0xe3,0x08,0x10,0x07,0x51,0x08,0xb9,0x90,0x45,0x00,0x00,0xa0,0x45,0x00,
-0x08,0xd9,0xab,0x40,0x99,0x12,0x10,0x89,0x0b,0x0b,0x10,0x50,0x11,0x2c,0x70,0x4b,
-0x50,0x00,0x04,0x44,0x43,0x00,0x93,0x1b,0x38,0x00,0x04,0x55,0x7c,0x35,0x13,0xa0,
-0xb1,0x21,0x81,0x12,0x22,0x20,0x73,0x77,0x75,0x09,0x08,0xff,0x25,0x00,0x44,0x21,
-0x00,0x3d,0x21,0x37,0x4c,0x9b,0x80,0x7c,0x02,0x02,0x46,0x01,0x03,0x22,0x26,0x5d,
-0x09,0x1a,0x4b,0x40,0x91,0x46,0x01,0x05,0xff,0x01,0x16,0x00,0xff,0x01,0x1d,0x42,
-0xff,0x01,0x34,0x53,0xb9,0xb5,0x23,0x00,0x0f,0x69,0x01,0x02,0xf3,0x14,0x05,0x42,
-0x03,0x20,0x00,0x24,0x30,0x54,0x00,0x78,0x88,0x65,0x40,0x00,0x68,0x70,0x54,0x00,
-0x18,0x07,0x25,0xb8,0x03,0x60,0x53,0x54,0x00,0x0a,0x1a,0x05,0x40,0x00,0x37,0x30,
-0x54,0xfd,0x35,0xf7,0x0b,0x00,0x11,0x00,0x06,0x84,0x06,0x00,0x68,0x88,0x4a,0x00,
-0x05,0x83,0x09,0x00,0x37,0x09,0x09,0xa6,0x37,0x0a,0x09,0x00,0x04,0x72,0x07,0xd6,
-0x39,0x02,0x1b,0x1a,0xf2,0x10,0x06,0x94,0x08,0x00,0x57,0x77,0x3a,0x00,0x14,0x72,
-0x09,0x00,0x1b,0x5a,0x09,0x52,0x45,0x09,0x09,0x53,0x0a,0x68,0x09,0x00,0x00,0x30,
-0x09,0x00,0x04,0x50,0x01,0x54,0x0c,0x00,0xd6,0x03,0x21,0x84,0x04,0x50,0x00,0xf1,
-0x04,0x06,0x93,0x0a,0x00,0x38,0x0a,0x0a,0x95,0x37,0x0a,0x0a,0x00,0x04,0x72,0x05,
-0x00,0x04,0x99,0x9d,0x4e,0x3a,0x10,0x09,0x10,0x2a,0x34,0x98,0x88,0x10,0x78,0x00,
-0xf0,0x00,0x04,0x82,0x0a,0x00,0x39,0x1a,0x0a,0x95,0x36,0x0a,0x09,0x00,0x06,0x84,
-0x07,0x6c,0x36,0x02,0xcd,0x22,0x00,0x3a,0x03,0x63,0x99,0x87,0x00,0x06,0x84,0x05,
-0xa0,0x00,0x51,0x0a,0x00,0x37,0x0a,0x09,0x28,0x00,0xb1,0x05,0x83,0x06,0x00,0x03,
-0x10,0x05,0x00,0x06,0xb9,0x9d,0x90,0x24,0x72,0x02,0x89,0x87,0x00,0x06,0x83,0x05,
-0x78,0x00,0x45,0x82,0x09,0x00,0x38,0x28,0x00,0x52,0x08,0x00,0x00,0x79,0x95,0xa0,
-0x16,0x03,0xe8,0x19,0xf0,0x0f,0x06,0x51,0x12,0x50,0x02,0x42,0x25,0x90,0x57,0x77,
-0x45,0x90,0x08,0x95,0x25,0x90,0x27,0x09,0x2b,0xd0,0x26,0x09,0x25,0x90,0x0a,0x68,
-0x25,0x90,0x01,0x30,0x2b,0x15,0x11,0x26,0x23,0x21,0xf0,0x0a,0x06,0x82,0x22,0x55,
-0x77,0x76,0x4a,0x15,0x82,0x55,0xa2,0x93,0x95,0xac,0x38,0x19,0x54,0x90,0x47,0x12,
-0x27,0x00,0x29,0x99,0x30,0x67,0x03,0x71,0x94,0x03,0x90,0x00,0x68,0x60,0x00,0x5f,
-0x0a,0x10,0x08,0x77,0x00,0x10,0x94,0x77,0x00,0xae,0x39,0x2a,0x09,0x00,0x36,0x09,
-0x09,0x94,0x06,0x73,0x77,0x00,0xf5,0x0c,0x05,0x75,0x00,0x61,0x24,0x41,0x09,0x46,
-0x66,0x60,0x90,0x69,0x90,0x09,0x09,0x03,0x79,0xa0,0x90,0x26,0x09,0x09,0x49,0x20,
-0x90,0x04,0x20,0x33,0x19,0xd0,0x85,0x00,0x64,0x88,0x85,0x0a,0x03,0x74,0x00,0xa0,
-0xa0,0x94,0x9a,0x9e,0x26,0x72,0x58,0x50,0x08,0x00,0x99,0x99,0x50,0xff,0x36,0x10,
-0xa0,0x3d,0x09,0x81,0x85,0x00,0x54,0x88,0x85,0x0a,0x04,0x84,0x23,0x00,0x00,0x04,
-0x02,0x20,0x38,0x40,0x5e,0x2c,0x01,0xad,0x32,0x11,0xa3,0x95,0x00,0xf1,0x05,0x05,
-0x82,0x04,0x50,0x58,0x88,0x19,0x81,0x07,0x85,0x09,0x81,0x27,0x0a,0x69,0x81,0x0a,
-0x88,0x09,0x81,0xa6,0x37,0x91,0x69,0x99,0xd0,0x00,0x69,0x99,0xc0,0x00,0xb0,0x6b,
-0x05,0xa0,0x91,0x04,0x85,0x00,0x43,0x77,0x75,0x0a,0x03,0x85,0x4b,0x00,0x80,0x8a,
-0x09,0x07,0x44,0xa0,0x78,0x91,0x3a,0x8a,0x00,0x32,0x07,0x00,0x05,0x64,0x36,0xf0,
-0x12,0x97,0x04,0x86,0x00,0x63,0x99,0x86,0x0a,0x02,0x84,0x29,0xb0,0xa0,0x81,0x0a,
-0x09,0x07,0x49,0xb0,0x48,0x70,0x09,0x00,0x18,0x98,0x20,0x0a,0x10,0x29,0x00,0xa2,
-0x03,0x90,0x11,0x13,0x72,0x58,0x80,0x00,0x07,0x77,0x77,0x30,0x90,0x17,0x30,0x29,
-0x00,0x04,0x06,0x18,0x21,0x78,0x92,0x17,0x1f,0x42,0x69,0x9c,0xa9,0x93,0xc8,0x0c,
-0xa1,0x81,0x00,0x06,0x88,0x88,0x20,0x00,0x88,0x93,0x00,0xb8,0x24,0x70,0x4c,0x81,
-0x00,0x68,0x8a,0x88,0x83,0x12,0x2e,0x80,0x02,0x56,0x6a,0x30,0x09,0x43,0x33,0x00,
-0x20,0x06,0x00,0x28,0x00,0x14,0x05,0x28,0x00,0x00,0x4b,0x23,0x71,0x5b,0x82,0x00,
-0x68,0x8b,0x88,0x83,0x3f,0x01,0xf0,0x1f,0x70,0x1a,0x00,0x05,0x60,0x0b,0x00,0x00,
-0x58,0x82,0x00,0x04,0x86,0x02,0x30,0x04,0x88,0x86,0x45,0x00,0x03,0x84,0x03,0x50,
-0x00,0xa0,0x82,0x36,0x00,0x09,0x06,0x33,0xb8,0x00,0x68,0x80,0x36,0x00,0x00,0x70,
-0x03,0x60,0x06,0x8c,0x99,0x66,0xb2,0x02,0x11,0x50,0x4c,0x09,0xf2,0x11,0x03,0x86,
-0x02,0x40,0x48,0x88,0x73,0x70,0x06,0x88,0x03,0x70,0x09,0x05,0x43,0xc8,0x07,0xa8,
-0x03,0x70,0x46,0xc7,0x84,0x70,0x13,0x22,0x01,0x20,0x03,0x99,0x9a,0x50,0x91,0x06,
-0xf0,0x14,0x02,0x30,0x03,0x96,0x02,0x50,0x04,0x88,0x87,0x27,0x00,0x05,0x77,0x02,
-0x70,0x00,0x90,0x44,0x2c,0x80,0x0a,0x59,0x12,0x80,0x00,0x0b,0x23,0x28,0x00,0x59,
-0x97,0x52,0x70,0x00,0x46,0x53,0x00,0x00,0xf1,0x3c,0x00,0xee,0x06,0xf0,0x15,0x03,
-0x86,0x01,0x40,0x48,0x88,0x63,0x70,0x07,0x79,0x12,0x70,0x0a,0x06,0x42,0xc9,0x03,
-0xc5,0x02,0x70,0x58,0xa8,0x83,0x60,0x02,0x99,0x99,0x50,0x01,0x55,0x57,0x80,0x05,
-0x84,0x44,0x10,0x17,0x1f,0x02,0x28,0x00,0xf0,0x0b,0x62,0x70,0x06,0x88,0x02,0x70,
-0x09,0x05,0x42,0xb7,0x07,0xa8,0x02,0x81,0x58,0xc7,0x83,0x70,0x00,0x38,0x85,0x10,
-0x01,0xa0,0x07,0x50,0x04,0x00,0xf0,0x09,0x00,0x38,0x84,0x00,0x04,0x87,0x00,0x54,
-0x88,0x86,0x09,0x02,0x85,0x00,0x90,0xa0,0x63,0x09,0x09,0x04,0x40,0x90,0x58,0x80,
-0x1a,0x04,0x44,0x95,0x9c,0x89,0x29,0x11,0x0e,0x14,0x48,0x69,0x01,0x12,0x61,0x69,
-0x01,0x00,0x4a,0x17,0xb0,0x78,0x93,0x00,0x00,0x90,0x35,0x00,0x69,0xd9,0xab,0x93,
-0x2d,0x0e,0xf0,0x04,0x07,0x88,0x88,0x30,0x00,0x48,0x71,0x00,0x03,0x80,0x29,0x00,
-0x02,0x93,0x48,0x00,0x00,0x25,0x40,0x57,0x27,0x02,0xce,0x11,0x00,0x04,0x00,0x12,
-0x01,0x73,0x14,0xf0,0x02,0x17,0x70,0x05,0x29,0x98,0x80,0xa0,0x88,0x94,0x0a,0x07,
-0x78,0x30,0xa6,0x99,0x89,0x2a,0xbd,0x10,0xa1,0x09,0x99,0x84,0x00,0x45,0x55,0xa0,
-0x1b,0x55,0x52,0xf8,0x04,0x0f,0x4f,0x00,0x05,0x71,0xb9,0xaa,0x93,0x00,0xa0,0x36,
-0x00,0x04,0x00,0xf2,0x0e,0x20,0x01,0x00,0x01,0x98,0x00,0x62,0x88,0x88,0x0a,0x04,
-0x88,0x10,0x90,0xa0,0x27,0x09,0x05,0x78,0x10,0xa5,0x88,0x98,0x2a,0x01,0x20,0x00,
-0x90,0x37,0x66,0x1a,0x61,0x05,0x65,0x00,0x60,0x13,0x31,0xf7,0x02,0x70,0x59,0xa1,
-0x09,0x09,0x03,0x60,0x90,0xf7,0x02,0x67,0x39,0x20,0x90,0x05,0x20,0x09,0x02,0x37,
-0xf3,0x21,0x9c,0x10,0x00,0x16,0xbf,0xff,0xf2,0x00,0x3f,0xff,0xff,0xff,0x20,0x05,
-0xff,0xd9,0x41,0xf2,0x00,0x5f,0x20,0x00,0x1f,0x20,0x05,0xe0,0x00,0x01,0xf2,0x00,
-0x5e,0x00,0x07,0x9f,0x20,0x48,0xe0,0x07,0xff,0xf2,0xaf,0xfe,0x00,0x2b,0xd8,0x07,
-0xff,0x90,0xaa,0x46,0x00,0x45,0x0d,0xf1,0x17,0x88,0x88,0x14,0xeb,0xe7,0x77,0x7e,
-0xbe,0xa2,0xd0,0x00,0x0d,0x2a,0xeb,0xe3,0x33,0x3e,0xbe,0xb4,0xfb,0xbb,0xbf,0x4b,
-0xd9,0xd0,0x00,0x0d,0x9d,0xb5,0xd0,0x00,0x0d,0x5b,0xb7,0xff,0xff,0xff,0x7b,0x67,
-0x00,0xff,0x05,0xff,0xd6,0xff,0xff,0xff,0xff,0xe7,0xff,0xff,0xff,0x67,0x52,0x77,
-0x77,0x76,0xef,0xc6,0xff,0xff,0xfe,0x0f,0x00,0x01,0x54,0x78,0x63,0x88,0x88,0x87,
-0x7d,0x3b,0xf2,0x0e,0x06,0xfd,0x00,0x00,0x00,0x6f,0xf7,0x7c,0x10,0x06,0xff,0x70,
-0xdf,0xc1,0x6f,0xf7,0x00,0x1d,0xfe,0xff,0x70,0x00,0x01,0xdf,0xf7,0x00,0x00,0x00,
-0x1c,0xa8,0x0d,0xf3,0x3b,0x0c,0xd1,0x02,0xea,0xaf,0xd4,0xef,0x80,0xaf,0xff,0x80,
-0x02,0xff,0xf1,0x02,0xef,0xdf,0xd1,0xdf,0x80,0xaf,0xb6,0x70,0x00,0x85,0x00,0x00,
-0xa6,0x00,0x00,0x02,0xa0,0xea,0x29,0x00,0x0e,0xe1,0xea,0x5f,0xa0,0x7f,0x40,0xea,
-0x08,0xf3,0xbd,0x00,0xea,0x01,0xf7,0xcc,0x00,0xb7,0x00,0xf8,0xaf,0x00,0x00,0x04,
-0xf6,0x4f,0xa0,0x00,0x1d,0xf1,0x09,0xfd,0x89,0xef,0x50,0x00,0x6d,0xff,0xc4,0x7e,
-0x06,0x20,0x01,0x88,0xb3,0x1d,0xf9,0x1c,0xff,0x40,0x00,0x1e,0xcf,0xff,0xfc,0xd0,
-0x7f,0xff,0xdd,0xff,0xf7,0x2d,0xfa,0x00,0xbf,0xd1,0x0b,0xf7,0x00,0x8f,0xa0,0x6f,
-0xfe,0x55,0xef,0xf6,0x4f,0xff,0xff,0xff,0xf3,0x06,0x3a,0xff,0xa3,0x60,0x00,0x03,
-0xff,0x30,0x00,0x01,0x00,0xf0,0x24,0x6f,0x90,0xf8,0x00,0x00,0x09,0xf8,0xec,0xf8,
-0x00,0x01,0xbe,0x5a,0x5c,0xf8,0x00,0x2d,0xd5,0xef,0xf6,0xaf,0x50,0xda,0x6f,0xff,
-0xff,0x87,0xf1,0x11,0xff,0xff,0xff,0xf5,0x10,0x02,0xff,0xc3,0x9f,0xf6,0x00,0x02,
-0xff,0xb0,0x7f,0xf6,0x00,0x01,0xbb,0x70,0x4b,0xb3,0x4d,0x20,0x00,0xe8,0x45,0x27,
-0xff,0x60,0x05,0x00,0x90,0x01,0xff,0xff,0xff,0x60,0x00,0x5f,0xff,0xfa,0x8c,0x00,
-0xf2,0x02,0xb0,0x00,0x8b,0xb9,0x8b,0x8b,0xb9,0xdf,0xff,0xff,0xfe,0xdf,0xcf,0xff,
-0xff,0xfc,0xbe,0x6c,0x00,0xf0,0x03,0x24,0x44,0x44,0x30,0x00,0x01,0xef,0xff,0xff,
-0xf4,0x00,0x0b,0xc0,0x00,0x00,0x8e,0x10,0x6e,0x37,0x23,0xe0,0xa0,0xee,0xcb,0x10,
-0x0a,0xcd,0xf2,0xff,0xff,0xb8,0x9f,0xff,0xf4,0xff,0x01,0x00,0x20,0xf4,0xcf,0x06,
-0x00,0xf2,0x25,0xe1,0x00,0x04,0x87,0x30,0x5f,0x02,0xdf,0xfe,0xfc,0x7f,0x1e,0xd3,
-0x00,0x3c,0xff,0x9f,0x10,0x05,0xfe,0xff,0x44,0x00,0x02,0x66,0x66,0x12,0x22,0x00,
-0x00,0x11,0xff,0xff,0x50,0x00,0xda,0xff,0xa3,0x10,0x08,0xf4,0xfc,0xfb,0x66,0xbf,
-0x80,0xf5,0x4c,0xff,0xd5,0x00,0x31,0x68,0x00,0x63,0x70,0x00,0xbf,0xab,0xdf,0xff,
-0x01,0x00,0x51,0x00,0x3e,0xf0,0x00,0x2c,0xdc,0x22,0xf0,0x04,0x0b,0xf0,0x00,0xab,
-0xdf,0xf0,0x20,0xff,0xff,0xf0,0xa6,0xff,0xff,0xf0,0x59,0xff,0xff,0xf0,0x92,0x1d,
-0x00,0x42,0x00,0x02,0xc0,0x00,0x39,0x27,0x00,0x26,0x00,0x10,0xaa,0x28,0x00,0x90,
-0x0a,0x4a,0x70,0xab,0xdf,0xf0,0x23,0xe2,0xe0,0x2c,0x00,0x20,0x95,0xc2,0x2e,0x00,
-0x20,0x76,0xc3,0x30,0x00,0xd1,0xc3,0xe1,0x00,0x3e,0xf0,0x09,0xa6,0xb0,0x00,0x02,
-0xc0,0x03,0x3e,0xc6,0x0b,0x10,0xc3,0xd6,0x00,0x40,0x44,0x42,0xff,0xef,0x64,0x01,
-0xf0,0x09,0x0d,0xff,0xef,0xff,0xf8,0x4e,0xfe,0x25,0xff,0xff,0x9d,0xe2,0x00,0x6f,
-0xf9,0x01,0x20,0x00,0x4f,0xf7,0x44,0x44,0x44,0x7f,0xd0,0x00,0xf0,0x15,0xfc,0x00,
-0x1a,0x00,0x00,0x07,0xf5,0x00,0x00,0xef,0xc0,0x00,0x8f,0xff,0x60,0x3f,0xff,0xff,
-0x1b,0xff,0xff,0xf9,0xfb,0xff,0xff,0xdd,0x6e,0xff,0xfc,0x7e,0x59,0xff,0x60,0x9f,
-0xff,0x80,0xba,0x0b,0x00,0x13,0x47,0xf0,0x10,0x70,0x03,0xe4,0xe7,0x04,0xff,0x5e,
-0x75,0xff,0xf5,0xec,0xff,0xff,0x5e,0xff,0xff,0xf5,0xea,0xef,0xff,0x5e,0x71,0xdf,
-0xf5,0xe7,0x01,0xcf,0x59,0x50,0x00,0x92,0x76,0x31,0xf1,0x17,0x0f,0xfe,0x50,0x00,
-0x00,0xff,0xff,0xc3,0x00,0x0f,0xff,0xff,0xf9,0x10,0xff,0xff,0xff,0xfe,0x5f,0xff,
-0xff,0xff,0xfa,0xff,0xff,0xff,0xf8,0x0f,0xff,0xff,0xb2,0x00,0xff,0xfd,0x40,0x00,
-0x0e,0xf7,0xb5,0x07,0x03,0x01,0x00,0xef,0x0d,0xff,0x90,0xdf,0xf9,0xff,0xfc,0x0f,
-0xff,0xcf,0xff,0xc0,0xff,0xfc,0x09,0x00,0x00,0x82,0xfb,0x0f,0xff,0xb8,0xbb,0x50,
-0x8b,0xb5,0x2d,0x00,0x30,0xff,0xff,0xf9,0x3f,0x01,0x01,0xbb,0x00,0x0f,0x09,0x00,
-0x03,0x40,0xb8,0xbb,0xbb,0xbb,0x2d,0x00,0xf3,0x11,0x0b,0xa0,0x00,0xe7,0xcf,0xb0,
-0x0e,0x7c,0xff,0xc1,0xe7,0xcf,0xff,0xdf,0x7c,0xff,0xff,0xf7,0xcf,0xff,0x9e,0x7c,
-0xff,0x70,0xe7,0xcf,0x60,0x0e,0x77,0x50,0x00,0x95,0xa2,0x12,0xe0,0xaf,0x60,0x00,
-0x00,0x09,0xff,0xf5,0x00,0x00,0x8f,0xff,0xff,0x40,0x06,0x2f,0x01,0x10,0x0e,0xb2,
-0x00,0x51,0x03,0x66,0x66,0x66,0x62,0x6f,0x00,0xa1,0x0f,0xff,0xff,0xff,0xfb,0x06,
-0x88,0x88,0x88,0x84,0xd7,0x02,0xf0,0x23,0xc7,0x00,0x1d,0xf5,0x01,0xdf,0x50,0x1d,
-0xf5,0x00,0x4f,0xd0,0x00,0x06,0xfc,0x00,0x00,0x6f,0xc0,0x00,0x06,0xf9,0x00,0x00,
-0x51,0x00,0x00,0x00,0x3e,0x30,0x00,0x2e,0xf3,0x00,0x02,0xef,0x30,0x00,0x2e,0xe3,
-0x00,0x09,0xf8,0x00,0x8f,0xa0,0x08,0xfa,0x00,0x5f,0xf6,0x4c,0x03,0x28,0x19,0xf0,
-0x02,0x8f,0x40,0x00,0x00,0x09,0xf5,0x00,0x00,0x00,0x9f,0x50,0x00,0x9b,0xbd,0xfc,
-0xbb,0x6f,0x5c,0x00,0x50,0x13,0x3a,0xf7,0x33,0x10,0x12,0x00,0x02,0x1b,0x00,0x80,
-0x39,0x10,0x00,0xbd,0xdd,0xdd,0xdd,0x8e,0x86,0x00,0x03,0x5b,0x04,0xf2,0x20,0x8a,
-0x95,0x00,0x00,0x01,0xcf,0x84,0x6e,0xe3,0x00,0x1e,0xf5,0x08,0x72,0xff,0x40,0xbf,
-0xe0,0x2d,0xf5,0xbf,0xe0,0xdf,0xe3,0xff,0xf6,0xaf,0xf1,0x4f,0xf3,0xaf,0xd1,0xef,
-0x70,0x05,0xfd,0x31,0x2b,0xf7,0x00,0x00,0x19,0xdf,0xea,0x30,0x00,0xb6,0xfc,0x25,
-0xf2,0x24,0xfa,0x16,0xaa,0x83,0x00,0x00,0x03,0xef,0xe6,0x49,0xfb,0x00,0x00,0x01,
-0xbe,0x49,0x28,0xfd,0x00,0x1d,0x40,0x8f,0xfe,0x1f,0xf9,0x04,0xff,0x50,0x5f,0xf1,
-0xff,0xb0,0x0a,0xfc,0x00,0x2d,0xdf,0xf2,0x00,0x0a,0xfa,0x10,0x1b,0xf7,0x00,0x00,
-0x04,0xbe,0xe4,0x08,0xf7,0x6e,0x00,0x12,0xf5,0xc0,0x03,0x00,0x04,0x0c,0x11,0xe6,
-0x0b,0x00,0x20,0xbf,0xe1,0x06,0x00,0x11,0x4f,0xb3,0x04,0x30,0x0d,0xe7,0xcf,0xd4,
-0x0d,0x20,0xfc,0x08,0x55,0x00,0xf0,0x0b,0xef,0xd0,0x9f,0xf4,0x00,0x00,0x9f,0xff,
-0x5c,0xff,0xd0,0x00,0x2f,0xff,0xe1,0xaf,0xff,0x60,0x0b,0xff,0xfe,0x2b,0xff,0xfe,
-0x00,0xef,0x89,0x01,0x76,0xf2,0x01,0x33,0x33,0x33,0x33,0x32,0xa8,0x0a,0xf0,0x15,
-0xc1,0xef,0xd1,0x03,0xef,0xfc,0x99,0xfb,0x2e,0xec,0xf8,0x00,0x54,0xde,0x25,0x70,
-0x00,0x0c,0xf4,0x01,0x10,0x00,0xbf,0x5c,0x78,0xd1,0xff,0xf6,0x0a,0xff,0xfd,0x78,
-0x60,0x00,0x7c,0xf6,0xd5,0x09,0x12,0x60,0x32,0x49,0x00,0x9a,0x01,0xf2,0x1e,0xaf,
-0xef,0x60,0x00,0xaf,0x90,0xcf,0x60,0x9f,0x80,0x00,0xcf,0x57,0x80,0x00,0x00,0xa4,
-0x11,0x00,0x00,0x02,0x0c,0xe2,0x00,0x05,0xf8,0x3f,0xe2,0x05,0xfd,0x10,0x3f,0xe7,
-0xfd,0x10,0x00,0x3f,0xfd,0x10,0x00,0x00,0x3b,0x10,0x00,0x00,0xf1,0x0d,0xf0,0x07,
-0xcf,0xc3,0xff,0xff,0xf5,0x00,0xbe,0xfe,0xb3,0x44,0x4e,0x60,0x04,0x3f,0x34,0x00,
-0x00,0xd6,0x00,0x02,0xf2,0x00,0x37,0x52,0xf0,0x07,0x2f,0x20,0x00,0x8c,0xea,0xf1,
-0x01,0xff,0xff,0xf7,0xdf,0xf7,0x00,0x04,0x44,0x44,0x11,0xc7,0x00,0x58,0x88,0x20,
-0xb0,0x02,0x50,0xe4,0x44,0x41,0xff,0xff,0x3b,0x05,0x1e,0xff,0x01,0x00,0x02,0x26,
-0x03,0x20,0x00,0x33,0x3d,0x07,0x90,0xff,0x40,0x00,0x00,0x3f,0xff,0xf4,0x00,0x02,
-0xe4,0x05,0x92,0x00,0x36,0xff,0x63,0x00,0x00,0x04,0xff,0x40,0x05,0x00,0xb6,0x9a,
-0xa5,0xff,0x5a,0xa9,0xff,0xff,0xdd,0xfe,0xdf,0xff,0x5c,0x04,0x00,0x12,0x10,0x00,
-0xc2,0x03,0x20,0x5f,0xff,0x64,0x05,0x20,0xff,0xe0,0xdb,0x04,0x11,0xfa,0xa6,0x00,
-0x10,0x50,0x16,0x00,0xb0,0xd0,0x00,0x39,0x10,0x4f,0xf4,0x00,0xbf,0xfc,0x9f,0xf6,
-0xdc,0x02,0xa5,0xe4,0x00,0x00,0x9f,0xfd,0x81,0x00,0x00,0x01,0x31,0xa6,0x28,0xf5,
-0x30,0xfe,0x30,0x05,0xc6,0xe7,0xbb,0x05,0xff,0x4d,0xbd,0xb4,0xff,0x40,0x3c,0xff,
-0xff,0x40,0x00,0x08,0xff,0xb0,0x00,0x6f,0xff,0xdf,0x80,0x0e,0x7b,0xb2,0xef,0x80,
-0xdb,0xd9,0x02,0xef,0x73,0xca,0x10,0x02,0x72,0x00,0x5d,0xdd,0x48,0x00,0x08,0xff,
-0xf6,0xf8,0xcc,0x8f,0xff,0x84,0x3f,0xe8,0xff,0xff,0xfc,0xfe,0x8f,0xff,0xff,0xcf,
-0x09,0x00,0x10,0xe7,0x1e,0x03,0x40,0x46,0x66,0x66,0x3f,0xe7,0x04,0xf1,0x0d,0x34,
-0x44,0x43,0x00,0x00,0x02,0x22,0x22,0x00,0x0e,0xff,0xff,0xfe,0x20,0xf5,0x22,0x22,
-0xfe,0x1f,0x40,0x00,0x0e,0xf8,0xf7,0x44,0x44,0xff,0x9f,0x62,0x03,0xf0,0x07,0xf6,
-0x0c,0xff,0x9f,0xff,0x20,0x9f,0xf9,0xff,0xfc,0x7f,0xff,0x9a,0xdd,0xdd,0xdd,0xd4,
-0x67,0x77,0x77,0x77,0x4e,0xad,0x02,0x01,0x95,0x00,0x40,0x77,0x77,0x77,0x74,0xe3,
-0x01,0x20,0xb0,0x00,0x87,0x5c,0x40,0x55,0x55,0x55,0x3f,0x1b,0x00,0x60,0x11,0x11,
-0x11,0x11,0x00,0x58,0x29,0x03,0x01,0x38,0x01,0x00,0xdc,0x02,0xf7,0x00,0xf6,0xc5,
-0xdf,0xff,0xfd,0x5c,0xfe,0x6a,0xff,0xa5,0xef,0xff,0xf9,0x55,0x9f,0x51,0x01,0xf0,
-0x06,0x03,0xaa,0xa2,0x00,0x07,0xff,0xf2,0x00,0x09,0xff,0xd0,0x00,0x0b,0xff,0xd8,
-0x81,0x0e,0xff,0xff,0xe1,0x0e,0xac,0x05,0xe1,0x05,0xfd,0x00,0x00,0x09,0xf4,0x00,
-0x00,0x0d,0xa0,0x00,0x00,0x0f,0x20,0xa5,0x03,0xf1,0x23,0x01,0x79,0x11,0x00,0x0f,
-0xfc,0x9f,0xf4,0x00,0xff,0xfd,0xcc,0x30,0x0f,0xfa,0x79,0x93,0x40,0xff,0x8e,0xff,
-0x6f,0x5f,0xf8,0xef,0xf7,0x64,0xff,0x8e,0xff,0xff,0xcf,0xf8,0xef,0xff,0xfc,0x46,
-0x3e,0xff,0xff,0xc0,0x00,0xdf,0xff,0xfc,0x00,0x02,0x44,0x44,0x20,0xee,0x4b,0x50,
-0x02,0xaf,0x81,0x00,0x02,0x9d,0x4d,0x80,0x9f,0xff,0xff,0x50,0x0c,0xff,0xff,0xf8,
-0x97,0x02,0x51,0xa0,0x3f,0xff,0xff,0xfe,0xd8,0x03,0x82,0x46,0x66,0x66,0x66,0x20,
-0x00,0xbf,0x70,0xa0,0x4b,0x00,0x2f,0x05,0x21,0x44,0x30,0xa0,0x00,0xf4,0x0f,0xf3,
-0xf4,0xa0,0xa0,0xb0,0xb0,0xf4,0xff,0xbe,0xae,0xae,0xaf,0xf4,0xff,0x3a,0x0a,0x0a,
-0x0f,0xf4,0xfb,0xea,0xaa,0xaa,0xea,0xf4,0xf7,0xb4,0x44,0x44,0xc4,0x06,0x06,0x00,
-0x28,0x45,0x10,0x70,0x06,0x4c,0x00,0xd5,0x01,0xb0,0x4b,0xff,0xff,0x70,0x00,0x5d,
-0xff,0xff,0xff,0x10,0x0c,0x5b,0x00,0x60,0x00,0x0a,0xee,0xef,0xff,0xf2,0x77,0x0c,
-0x11,0xff,0xf5,0x21,0x01,0xde,0x06,0x21,0x0a,0xfb,0xdf,0x28,0x32,0xf4,0x00,0x00,
-0xca,0x3c,0xf0,0x01,0xef,0xff,0x5b,0x00,0xff,0xff,0x6f,0xb0,0xff,0xff,0x68,0x83,
-0xff,0xff,0xfd,0xd6,0x24,0x05,0x1e,0xff,0x04,0x00,0x13,0xf7,0x4f,0x07,0x01,0xc5,
-0x41,0xc0,0xbf,0xff,0xfd,0x81,0x00,0x2c,0xfe,0xa8,0x78,0xcf,0xf7,0x0d,0x19,0x00,
-0xe0,0x3c,0xf5,0x22,0x05,0xbe,0xfd,0x81,0x05,0x00,0x09,0xfe,0xa9,0xcf,0xe2,0x5f,
-0x2d,0x20,0x00,0x38,0x2e,0x00,0x11,0x8c,0x05,0x06,0x22,0x0f,0xf7,0x03,0x17,0x51,
-0x10,0x00,0x00,0xcf,0xff,0xcb,0x04,0xd0,0x75,0x55,0x55,0x55,0x5a,0xf2,0xf6,0xff,
-0xff,0xff,0xfd,0x4f,0x5f,0xa1,0x01,0x91,0xd1,0xf5,0xf5,0x77,0x77,0x77,0x76,0x8f,
-0x4f,0xfa,0x00,0x11,0xd0,0x06,0x01,0x17,0x41,0x2e,0x00,0x21,0x54,0x4a,0x2e,0x00,
-0x11,0x00,0x2e,0x00,0x21,0xf0,0x01,0x2e,0x00,0x1f,0x00,0x2e,0x00,0x05,0x21,0x54,
-0x44,0x2e,0x00,0x11,0x20,0x2e,0x00,0x21,0xf2,0x00,0x2e,0x00,0x1f,0x10,0x2e,0x00,
-0x05,0x21,0x54,0x44,0x2e,0x00,0x20,0x50,0x00,0x2e,0x00,0x21,0xf5,0x00,0x2e,0x00,
-0x2f,0x20,0x00,0x2e,0x00,0x02,0x40,0xfa,0x0f,0x74,0x44,0x2e,0x00,0x11,0xf4,0x87,
-0x04,0x30,0x5f,0x40,0x00,0x2e,0x00,0x01,0x0d,0x00,0x0a,0x2e,0x00,0x00,0x12,0x00,
-0x11,0x5b,0x35,0x4f,0x11,0xbd,0x1e,0x00,0xf1,0x06,0xa1,0x03,0x00,0x00,0x0a,0xf7,
-0x39,0x00,0x00,0x07,0x60,0xff,0xea,0xbf,0xaa,0xaa,0xdf,0x45,0xa3,0x00,0x93,0xb5,
-0x2b,0x31,0x01,0xb8,0xfb,0x37,0x1c,0x34,0x9f,0xb0,0x00,0x9b,0x05,0xf2,0x1c,0x6b,
-0xca,0x40,0x00,0x9f,0xf6,0xff,0x40,0x1f,0xff,0x26,0xfb,0x04,0xf6,0xb4,0x6b,0xf0,
-0x6f,0xf4,0x06,0xff,0x06,0xff,0x90,0xbf,0xf0,0x5f,0x95,0x34,0xcf,0x02,0xfb,0xf3,
-0x4d,0xc0,0x0c,0xff,0x3d,0xf7,0x00,0x1b,0xfe,0xf9,0x32,0x00,0x50,0x12,0x3b,0xca,
-0x22,0x1f,0xf8,0x02,0x50,0x36,0x66,0x66,0x66,0x16,0xf0,0x04,0x8a,0x6f,0x6f,0x6f,
-0x7f,0x26,0xf6,0xf6,0xf7,0x09,0x00,0x91,0x24,0xff,0xff,0xff,0xf1,0x03,0x44,0x44,
-0x42,0x6b,0x00,0x20,0x97,0x00,0xfe,0x05,0x10,0xf8,0xa8,0x4e,0xc0,0xef,0xe0,0x00,
-0x00,0xbf,0xe5,0xd4,0x00,0x00,0xbf,0xff,0xe0,0x05,0x00,0x13,0xf4,0x05,0x00,0x30,
-0xaf,0xff,0xf4,0xea,0x06,0x00,0xc3,0x00,0x01,0x05,0x00,0x02,0xc5,0x3b,0x00,0x57,
-0x0c,0x50,0x88,0x86,0x00,0x08,0xff,0x57,0x03,0xf0,0x13,0x08,0xff,0xf9,0x6f,0x69,
-0xff,0x88,0xff,0xff,0xc1,0x21,0xcf,0xf8,0xdf,0xff,0xff,0x50,0x5f,0xff,0x82,0xef,
-0xff,0x71,0x91,0x7f,0xf8,0x02,0xef,0xfe,0xdf,0xde,0xff,0x70,0x02,0x85,0x04,0xf0,
-0x02,0xe3,0x01,0xdf,0xff,0xe5,0x1d,0x6c,0x5a,0xab,0xdf,0x3b,0x18,0x8b,0xff,0xdf,
-0xde,0xeb,0xae,0x00,0x0c,0x04,0x00,0x44,0xbf,0xff,0xff,0xf6,0x6e,0x04,0x10,0x0a,
-0x25,0x18,0x80,0x07,0xf0,0x0b,0xf2,0x00,0x00,0x8f,0x0b,0x69,0x00,0x92,0xf0,0x7f,
-0xfa,0x99,0x99,0x99,0x00,0x6f,0x20,0x67,0x2e,0x0c,0x01,0x00,0x2f,0xfd,0x00,0x01,
-0x00,0x03,0x13,0xf8,0x08,0x00,0x17,0xf7,0x14,0x00,0x75,0xfc,0xfb,0x00,0xfe,0xfb,
-0x00,0xfa,0xff,0x1d,0x0a,0x01,0x00,0x10,0x02,0x00,0x32,0x0d,0x01,0x00,0x2f,0xf3,
-0x00,0x01,0x00,0x15,0x1f,0xef,0x1e,0x00,0x0a,0x03,0x88,0x00,0xc2,0xfb,0x00,0xff,
-0x00,0x00,0xf6,0xff,0xf9,0xfb,0x00,0xf9,0x00,0x4d,0x0b,0x00,0xfc,0x05,0x2d,0xfc,
-0xfd,0x92,0x00,0x6f,0xfe,0x00,0xfe,0x00,0x00,0xfc,0x4a,0x00,0x01,0x1c,0xfe,0x0a,
-0x00,0x19,0xff,0x1f,0x00,0x16,0xff,0x00,0x01,0x13,0xfe,0x48,0x00,0x3f,0xfe,0xfd,
-0xfe,0x9c,0x00,0x0a,0x15,0x02,0x3c,0x00,0x11,0xff,0x3f,0x00,0x26,0xff,0xfe,0x30,
-0x00,0x11,0xee,0x04,0x01,0x15,0xeb,0x24,0x00,0x00,0x4b,0x00,0x13,0xfe,0x04,0x00,
-0x08,0x01,0x00,0x13,0x01,0x70,0x00,0x1f,0x01,0x6b,0x00,0x08,0x1f,0xfe,0x43,0x01,
-0x0d,0x1b,0xfb,0x25,0x00,0x12,0xfe,0x67,0x00,0x31,0xfe,0xfd,0xfb,0x0f,0x00,0x14,
-0xe6,0x6c,0x00,0x97,0xfb,0x00,0x00,0xeb,0xfc,0xf2,0xf5,0x00,0xed,0x08,0x02,0x25,
-0xf6,0xf9,0x0c,0x00,0x75,0xe7,0x00,0x00,0x00,0xf5,0x00,0xf0,0x48,0x01,0x10,0xff,
-0x65,0x01,0x02,0x51,0x1a,0x0e,0x40,0x02,0x00,0x63,0x00,0x1f,0xfd,0x97,0x00,0x0b,
+0x00,0x22,0x67,0x58,0x60,0x00,0x60,0x93,0x58,0x10,0x0a,0x0b,0x07,0x98,0x13,0xf8,
+0xff,0xff,0xff,0xf7,0x72,0x1f,0xb5,0x21,0x50,0xab,0x54,0xab,0x58,0xab,0x60,0xab,
+0x62,0xab,0x65,0xab,0x69,0xab,0x6c,0xab,0x81,0xab,0xc0,0xab,0xc4,0xab,0xd0,0xab,
+0xdc,0xab,0xf0,0xab,0xf8,0xab,0xf9,0xab,0x00,0xac,0x0d,0xac,0x14,0xac,0x30,0xac,
+0x31,0xac,0x41,0xac,0x45,0xac,0x4c,0xac,0x50,0xac,0xa0,0xac,0xbc,0xac,0xbd,0xac,
+0xc5,0xac,0xdc,0xac,0x10,0xad,0x2c,0xad,0x30,0xad,0x48,0xad,0x49,0xad,0x4c,0xad,
+0x50,0xad,0x59,0xad,0x80,0xad,0x88,0xad,0x91,0xad,0x9c,0xad,0x0c,0xae,0x08,0xaf,
+0x94,0xaf,0xa4,0xaf,0xad,0xaf,0xe8,0xaf,0xf0,0xaf,0xf8,0xaf,0x04,0xb0,0x58,0xb0,
+0x60,0xb0,0x73,0xb0,0x74,0xb0,0xc8,0xb0,0xe2,0xb0,0x54,0xb1,0x5c,0xb1,0xc4,0xb1,
+0xe0,0xb1,0xe4,0xb1,0xf5,0xb1,0x18,0xb2,0x28,0xb2,0x29,0xb2,0x34,0xb2,0x38,0xb2,
+0x45,0xb2,0x50,0xb2,0xa4,0xb2,0xac,0xb2,0xbe,0xb2,0xc0,0xb2,0xc1,0xb2,0xc4,0xb2,
+0xc8,0xb2,0x14,0xb3,0x15,0xb3,0x29,0xb3,0x68,0xb3,0x6c,0xb3,0x78,0xb3,0xa0,0xb3,
+0xa8,0xb3,0xf4,0xb3,0x10,0xb4,0x18,0xb4,0x2c,0xb4,0x2d,0xb4,0x30,0xb4,0x34,0xb4,
+0x41,0xb4,0x64,0xb4,0x79,0xb4,0x80,0xb4,0x9c,0xb4,0x60,0xb5,0xec,0xb5,0x40,0xb6,
+0xcc,0xb6,0xd0,0xb6,0xdc,0xb6,0xe1,0xb6,0xe8,0xb6,0xe9,0xb6,0x19,0xb7,0x3c,0xb7,
+0x4c,0xb7,0x4d,0xb7,0x58,0xb7,0x59,0xb7,0x5c,0xb7,0x74,0xb7,0x75,0xb7,0x7c,0xb7,
+0xac,0xb7,0xad,0xb7,0xb0,0xb7,0xb4,0xb7,0xbf,0xb7,0x1c,0xb8,0x38,0xb8,0x49,0xb8,
+0xa8,0xb8,0xb8,0xb8,0xc4,0xb8,0xc8,0xb8,0xcc,0xb8,0xd4,0xb8,0xfc,0xb8,0xfd,0xb8,
+0x00,0xb9,0x0c,0xb9,0x0d,0xb9,0x0f,0xb9,0x11,0xb9,0x18,0xb9,0x19,0xb9,0x1c,0xb9,
+0x1e,0xb9,0x20,0xb9,0x2e,0xb9,0x34,0xb9,0x45,0xb9,0x47,0xb9,0x88,0xb9,0x8c,0xb9,
+0x90,0xb9,0xa4,0xb9,0xc4,0xb9,0xd5,0xb9,0xf8,0xb9,0xf9,0xb9,0x0b,0xba,0x84,0xba,
+0x88,0xba,0xfc,0xba,0x48,0xbb,0x49,0xbb,0x50,0xbb,0x5b,0xbb,0x5d,0xbb,0x5f,0xbb,
+0x64,0xbb,0x65,0xbb,0x68,0xbb,0x6c,0xbb,0x6d,0xbb,0x79,0xbb,0x80,0xbb,0x81,0xbb,
+0xd4,0xbb,0xd8,0xbb,0xdc,0xbb,0xe4,0xbb,0xe5,0xbb,0xf0,0xbb,0xf8,0xbb,0x10,0xbc,
+0x14,0xbc,0x44,0xbc,0x45,0xbc,0x48,0xbc,0x4c,0xbc,0x57,0xbc,0xd0,0xbc,0xd4,0xbc,
+0xd8,0xbc,0xe9,0xbc,0x40,0xbd,0x5c,0xbd,0x64,0xbd,0x94,0xbd,0x98,0xbd,0x9c,0xbd,
+0xb0,0xbd,0xb8,0xbd,0xe0,0xbf,0xfc,0xbf,0xfd,0xbf,0x00,0xc0,0x0d,0xc0,0x11,0xc0,
+0x18,0xc0,0x19,0xc0,0x28,0xc0,0x2d,0xc0,0x47,0xc0,0x6c,0xc0,0x6d,0xc0,0x70,0xc0,
+0x74,0xc0,0x81,0xc0,0x88,0xc0,0x89,0xc0,0x8c,0xc0,0x90,0xc0,0x9b,0xc0,0xa8,0xc0,
+0xdc,0xc0,0xdd,0xc0,0xe0,0xc0,0xf1,0xc0,0x30,0xc1,0x68,0xc1,0x6c,0xc1,0x7b,0xc1,
+0xf4,0xc1,0xfc,0xc1,0x05,0xc2,0x09,0xc2,0x2c,0xc2,0x2d,0xc2,0x30,0xc2,0x34,0xc2,
+0x3c,0xc2,0x41,0xc2,0x48,0xc2,0x40,0xc4,0x94,0xc4,0x95,0xc4,0x98,0xc4,0x9a,0xc4,
+0x9c,0xc4,0xa4,0xc4,0xa5,0xc4,0xa9,0xc4,0xae,0xc4,0xc0,0xc4,0xcc,0xc4,0xe1,0xc4,
+0x04,0xc5,0x08,0xc5,0x0c,0xc5,0x15,0xc5,0x16,0xc5,0x18,0xc5,0x20,0xc5,0x28,0xc5,
+0x3c,0xc5,0x3d,0xc5,0x40,0xc5,0x44,0xc5,0x51,0xc5,0x58,0xc5,0x74,0xc5,0x78,0xc5,
+0x7c,0xc5,0x85,0xc5,0x90,0xc5,0x94,0xc5,0xc8,0xc5,0xcc,0xc5,0xe4,0xc5,0xf9,0xc5,
+0x00,0xc6,0x04,0xc6,0x08,0xc6,0x10,0xc6,0x13,0xc6,0x1c,0xc6,0x20,0xc6,0x24,0xc6,
+0x38,0xc6,0x54,0xc6,0x70,0xc6,0x78,0xc6,0x8c,0xc6,0x90,0xc6,0x94,0xc6,0x9c,0xc6,
+0xa1,0xc6,0xa8,0xc6,0xc4,0xc6,0xc5,0xc6,0xc8,0xc6,0xcc,0xc6,0xcd,0xc6,0xd4,0xc6,
+0xd5,0xc6,0xd8,0xc6,0xe0,0xc6,0xe1,0xc6,0xe4,0xc6,0xe8,0xc6,0xf5,0xc6,0xfc,0xc6,
+0xfd,0xc6,0x50,0xc7,0x51,0xc7,0x54,0xc7,0x58,0xc7,0x60,0xc7,0x61,0xc7,0x65,0xc7,
+0x6c,0xc7,0x7f,0xc7,0x88,0xc7,0xc0,0xc7,0xc1,0xc7,0xc4,0xc7,0xd5,0xc7,0xdc,0xc7,
+0x4c,0xc8,0x50,0xc8,0x61,0xc8,0xd9,0xc8,0xe0,0xc8,0xed,0xc8,0x10,0xc9,0x11,0xc9,
+0x14,0xc9,0x20,0xc9,0x21,0xc9,0x2c,0xc9,0x48,0xc9,0x49,0xc9,0x0d,0xca,0x5d,0xcb,
+0x78,0xcb,0x88,0xcb,0x8c,0xcb,0x8e,0xcb,0x94,0xcb,0xfb,0xcb,0xfd,0xcb,0x04,0xcc,
+0x58,0xcc,0xac,0xcc,0xe4,0xcc,0xe5,0xcc,0xe8,0xcc,0xec,0xcc,0xf9,0xcc,0x38,0xcd,
+0x71,0xcd,0xa8,0xcd,0xbd,0xcd,0xc4,0xcd,0xe0,0xcd,0x34,0xce,0x38,0xce,0x3c,0xce,
+0x44,0xce,0x47,0xce,0x50,0xce,0x6c,0xce,0x7c,0xce,0xa4,0xce,0xac,0xce,0xbc,0xcf,
+0xc4,0xcf,0xcc,0xcf,0xf4,0xcf,0xfc,0xcf,0x10,0xd0,0x18,0xd0,0x20,0xd0,0x2c,0xd0,
+0x2d,0xd0,0x3d,0xd0,0x80,0xd0,0x84,0xd0,0x88,0xd0,0x90,0xd0,0x9c,0xd0,0x9d,0xd0,
+0xa0,0xd0,0xa4,0xd0,0xac,0xd0,0xf0,0xd0,0xf4,0xd0,0x05,0xd1,0x7c,0xd1,0x08,0xd2,
+0x09,0xd2,0x0c,0xd2,0x10,0xd2,0x40,0xd2,0x41,0xd2,0x5c,0xd2,0x6d,0xd2,0x78,0xd2,
+0xd4,0xd2,0xdc,0xd2,0xe8,0xd2,0xe9,0xd2,0x08,0xd3,0x19,0xd3,0x3c,0xd3,0x44,0xd3,
+0xac,0xd3,0xc8,0xd3,0x54,0xd4,0x5c,0xd4,0x8c,0xd4,0x90,0xd4,0x94,0xd4,0xa1,0xd4,
+0xa8,0xd4,0xa9,0xd4,0xac,0xd4,0xb0,0xd4,0xb8,0xd4,0xb9,0xd4,0xbd,0xd4,0xc4,0xd4,
+0xd9,0xd4,0xf5,0xd4,0x18,0xd5,0x28,0xd5,0x2d,0xd5,0x3c,0xd5,0x54,0xd5,0x65,0xd5,
+0x88,0xd5,0x90,0xd5,0x9d,0xd5,0xa4,0xd5,0xa5,0xd5,0xa8,0xd5,0xac,0xd5,0xb9,0xd5,
+0xdc,0xd5,0xf8,0xd5,0x14,0xd6,0x70,0xd6,0x84,0xd6,0xc0,0xd6,0xd8,0xd6,0x51,0xef,
+0x58,0xef,0x5b,0xef,0x5c,0xef,0x5d,0xef,0x61,0xef,0x63,0xef,0x65,0xef,0x69,0xef,
+0x6c,0xef,0x71,0xef,0x76,0xef,0x77,0xef,0x78,0xef,0x8e,0xef,0x93,0xef,0x98,0xef,
+0x9b,0xef,0x9c,0xef,0x9d,0xef,0xa1,0xef,0xa2,0xef,0xa3,0xef,0xa4,0xef,0xb7,0xef,
+0xb8,0xef,0xbe,0xef,0xc0,0xef,0xc1,0xef,0xc4,0xef,0xc7,0xef,0xc8,0xef,0xc9,0xef,
+0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,0x15,0xf0,0x17,0xf0,0x19,0xf0,0x30,0xf0,
+0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,0x74,0xf0,0xab,0xf0,0x3b,0xf1,0x90,0xf1,
+0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,0x54,0xf2,
+0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x00,0x01,0x00,0x2f,0xfd,0x00,0x01,0x00,0x03,0x13,
+0xf8,0x08,0x00,0x08,0x2e,0x00,0xce,0xfc,0xfb,0x00,0xfe,0xfb,0x00,0xfa,0x00,0x00,
+0x00,0x01,0x00,0x01,0x00,0x4e,0x02,0x01,0x00,0x02,0x16,0x00,0x2f,0xf3,0x00,0x01,
+0x00,0x15,0x1f,0xef,0x1e,0x00,0x0a,0x03,0x88,0x00,0xb1,0xfb,0x00,0xff,0x00,0x00,
+0xf6,0xff,0xf9,0xfb,0x00,0xf9,0x11,0x00,0x00,0x0f,0x00,0x4d,0xff,0xff,0xfc,0xfd,
+0x92,0x00,0x6f,0xfe,0x00,0xfe,0x00,0x00,0xfc,0x4a,0x00,0x01,0x1c,0xfe,0x0a,0x00,
+0x19,0xff,0x1f,0x00,0x16,0xff,0x00,0x01,0x13,0xfe,0x48,0x00,0x3f,0xfe,0xfd,0xfe,
+0x9c,0x00,0x0a,0x15,0x02,0x3c,0x00,0x11,0xff,0x3f,0x00,0x26,0xff,0xfe,0x30,0x00,
+0x11,0xee,0x04,0x01,0x15,0xeb,0x24,0x00,0x00,0x4b,0x00,0x13,0xfe,0x04,0x00,0x08,
+0x01,0x00,0x13,0x01,0x70,0x00,0x1f,0x01,0x6b,0x00,0x08,0x1f,0xfe,0x43,0x01,0x0d,
+0x1b,0xfb,0x25,0x00,0x12,0xfe,0x67,0x00,0x31,0xfe,0xfd,0xfb,0x0f,0x00,0x14,0xe6,
+0x6c,0x00,0x97,0xfb,0x00,0x00,0xeb,0xfc,0xf2,0xf5,0x00,0xed,0x08,0x02,0x25,0xf6,
+0xf9,0x0c,0x00,0x75,0xe7,0x00,0x00,0x00,0xf5,0x00,0xf0,0x48,0x01,0x21,0xff,0xff,
+0x17,0x01,0x1f,0x01,0xf7,0x01,0x01,0x10,0xfd,0x63,0x00,0x1f,0xfd,0x97,0x00,0x0b,
 0x3e,0xfa,0x00,0xff,0x8c,0x01,0x03,0x7b,0x02,0xb1,0xef,0xee,0x00,0x00,0xfa,0xfe,
 0xed,0xff,0x01,0x00,0x01,0x60,0x00,0xd3,0xf7,0xf8,0x00,0xf7,0xf8,0xfa,0xf7,0x00,
 0xf9,0xfa,0xfc,0xfa,0xfb,0x5e,0x01,0x66,0xee,0xfd,0x00,0x00,0xfa,0xff,0x2b,0x01,
@@ -1387,19 +290,1221 @@ static const uint8_t lz4FontData[] ={
 0x01,0x00,0x06,0x1f,0xff,0xf0,0x01,0x10,0x11,0xff,0x97,0x01,0x0e,0x5f,0x00,0x0f,
 0x4f,0x00,0x07,0x0f,0x1d,0x00,0x0a,0x1e,0x01,0xbd,0x03,0x19,0x01,0x81,0x00,0x16,
 0x01,0x14,0x04,0x0f,0x01,0x00,0x1e,0x0b,0xc9,0x00,0x1f,0xf5,0x90,0x00,0x0b,0x05,
-0xd7,0x01,0x1c,0xf6,0x31,0x02,0x11,0xff,0x93,0x00,0x01,0x05,0x4d,0x0f,0x6f,0x00,
-0x15,0x17,0x01,0xcc,0x04,0x06,0xa7,0x03,0x1d,0x01,0x14,0x01,0x1f,0xf6,0xd8,0x00,
-0x24,0x1f,0xfe,0x7d,0x01,0x10,0x1f,0xff,0x3d,0x00,0x1c,0x03,0x8c,0x01,0x21,0x02,
-0x03,0x47,0x1b,0x2d,0x04,0x05,0x21,0x00,0xf1,0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,
-0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,
-0x15,0x16,0x17,0x18,0x19,0x20,0x00,0x80,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,
-0xa5,0x08,0xff,0x01,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,
-0x24,0x27,0x28,0x00,0x01,0x00,0xff,0xfe,0x0a,0x75,0x02,0x20,0x03,0x02,0x70,0x02,
-0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x10,0x09,0x59,0x4f,0x00,0x93,0x0f,0x10,0x00,
-0xe6,0x56,0x00,0x08,0x00,0xd0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,
-0x00,0x00,0x15,0x21,0x28,0x61,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,
-0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,
-0x23,0x73,0x00,0x02,0x1f,0x24,0x6f,0x02,0xff,0xe9,0x50,0x00,0x00,0x00,0x00,0x00,
+0xd7,0x01,0x1c,0xf6,0x31,0x02,0x11,0xff,0x93,0x00,0x10,0x04,0x2b,0x02,0x0f,0x6f,
+0x00,0x15,0x17,0x01,0xcc,0x04,0x06,0xa7,0x03,0x1d,0x01,0x14,0x01,0x1f,0xf6,0xd8,
+0x00,0x24,0x1f,0xfe,0x7d,0x01,0x10,0x1f,0xff,0x3d,0x00,0x1c,0x03,0x8c,0x01,0x30,
+0x02,0x03,0x00,0xed,0x00,0x2d,0x04,0x05,0x21,0x00,0xf1,0x0c,0x06,0x07,0x08,0x09,
+0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,
+0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xff,0x0d,0x1a,0x1b,0x1c,0x00,0x1d,
+0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,
+0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,0xff,0xfe,0x0a,0x75,0x02,0x20,0x03,
+0x02,0x70,0x02,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,
+0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,
+0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,
+0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,
+0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,0x00,0x02,0x1f,0x24,0x6f,0x02,0xff,0xe9,
+0x50,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const uint8_t lz4BitmapData[] ={
+0xf0,0x1a,0x2c,0x2b,0x2b,0x2b,0x2b,0x17,0x00,0x2b,0x55,0xa5,0x59,0x32,0x60,0x00,
+0x55,0x55,0x00,0x08,0x29,0x20,0x0c,0xec,0xec,0x00,0x0b,0x0b,0x00,0x00,0xa0,0xa0,
+0x05,0xce,0xcd,0x80,0x05,0x56,0x50,0x00,0x82,0x92,0x00,0x01,0x00,0xf0,0x85,0x74,
+0x00,0x05,0xdc,0x30,0x1d,0x14,0xd0,0x2c,0x00,0x80,0x0b,0xa3,0x00,0x00,0x5c,0x70,
+0x23,0x00,0xd0,0x4b,0x01,0xe0,0x09,0xed,0x50,0x00,0x83,0x00,0x1b,0xb1,0x00,0x07,
+0x45,0x63,0x70,0x64,0x55,0xa0,0x01,0xa9,0x65,0x00,0x00,0x0a,0x6a,0x40,0x08,0x3b,
+0x0b,0x01,0x90,0xb0,0xb0,0x00,0x08,0xa6,0x05,0xdc,0x10,0x00,0xd1,0x67,0x00,0x0c,
+0x3a,0x40,0x00,0x5f,0x70,0x00,0x1d,0xa9,0x07,0x07,0x80,0xc8,0x90,0x59,0x02,0xf4,
+0x00,0x9b,0xc9,0xc0,0x73,0x73,0x41,0x00,0x71,0x04,0x90,0x0b,0x10,0x1c,0x00,0x4a,
+0x00,0x59,0x00,0x49,0x00,0x2b,0x00,0x0d,0x00,0x09,0x40,0x01,0xb0,0x00,0x21,0x81,
+0x03,0xa0,0x0b,0x20,0x67,0x04,0xa0,0x2b,0x03,0xb0,0x49,0x08,0x50,0xc0,0x76,0x03,
+0x00,0x03,0x80,0x07,0x69,0x80,0x3b,0xe5,0x01,0xca,0x30,0x13,0x13,0x00,0x00,0x83,
+0x00,0x00,0xa4,0x03,0x00,0x32,0x9f,0xff,0xf3,0x09,0x00,0xf6,0x28,0x67,0x85,0x70,
+0xad,0x70,0x01,0x3b,0x00,0x1a,0x00,0x74,0x00,0xb0,0x02,0x90,0x08,0x40,0x0c,0x00,
+0x38,0x00,0x83,0x00,0x60,0x00,0x08,0xdc,0x30,0x2c,0x03,0xc0,0x58,0x00,0xe0,0x67,
+0x00,0xd0,0x67,0x00,0xd0,0x58,0x00,0xe0,0x2c,0x03,0xb0,0x07,0xdc,0x30,0x03,0x98,
+0x2b,0x99,0x00,0x59,0x02,0x00,0xf0,0x6e,0x09,0xdd,0x30,0x5a,0x03,0xc0,0x32,0x01,
+0xd0,0x00,0x07,0x80,0x00,0x3c,0x00,0x01,0xd2,0x00,0x0b,0x40,0x00,0x6f,0xdd,0xd3,
+0x0a,0xdd,0x35,0x80,0x2c,0x00,0x04,0xb0,0x1d,0xf2,0x00,0x04,0xb2,0x20,0x0e,0x5a,
+0x03,0xc0,0xad,0xc2,0x00,0x0d,0x60,0x00,0x7e,0x60,0x01,0xc8,0x60,0x0a,0x38,0x60,
+0x4a,0x08,0x60,0xad,0xde,0xe5,0x00,0x08,0x60,0x00,0x08,0x60,0x0a,0xff,0xf0,0x0c,
+0x10,0x00,0x0d,0x00,0x00,0x0e,0xdd,0x50,0x04,0x02,0xe0,0x00,0x00,0xb2,0x1c,0x00,
+0xd1,0x06,0xdd,0x60,0x01,0xae,0x10,0x0b,0x80,0x00,0x1d,0x00,0x00,0x4c,0xcd,0x40,
+0x5d,0x12,0xe0,0x49,0x00,0xc1,0x1d,0x01,0xd0,0x05,0xdd,0x40,0x8d,0xdd,0xf2,0x00,
+0x01,0xc0,0x00,0x07,0x60,0x34,0x00,0x70,0x49,0x00,0x00,0xb3,0x00,0x01,0xd0,0x4a,
+0x00,0xf0,0x5b,0x09,0xdd,0x40,0x3c,0x02,0xd0,0x2c,0x03,0xc0,0x09,0xef,0x30,0x3c,
+0x03,0xc0,0x67,0x00,0xd0,0x4b,0x02,0xd0,0x08,0xdd,0x40,0x09,0xdc,0x15,0xa0,0x5a,
+0x76,0x00,0xd4,0xb0,0x4f,0x08,0xd8,0xe0,0x00,0x3c,0x00,0x0b,0x60,0x7e,0x70,0x3a,
+0x01,0x00,0x00,0x01,0x3a,0x58,0x01,0x00,0x00,0x12,0x58,0x84,0x30,0x00,0x18,0x40,
+0x8d,0x70,0x9c,0x10,0x00,0x7d,0x81,0x00,0x08,0x40,0x3e,0xee,0xb0,0x00,0x00,0x3e,
+0xee,0xb0,0x49,0x10,0x00,0x6d,0x91,0x00,0x0a,0xc1,0x7d,0x81,0x48,0x10,0x00,0x1c,
+0xea,0x08,0x60,0xb3,0x00,0x0a,0x30,0x04,0xc0,0x00,0xd1,0x00,0x27,0xdc,0x01,0xf0,
+0x7c,0x3a,0x00,0x00,0x3b,0xbb,0x80,0x00,0x3a,0x00,0x04,0x90,0x0b,0x02,0xba,0x18,
+0x22,0x80,0xb1,0x92,0x35,0x55,0x1a,0x0a,0x12,0x76,0x44,0x80,0xb0,0x36,0x56,0x38,
+0x0d,0x07,0x31,0xa0,0xb9,0x7a,0x80,0x09,0x50,0x00,0x00,0x00,0x07,0xba,0xa0,0x00,
+0x00,0x5d,0x00,0x00,0x0a,0xd2,0x00,0x00,0xd5,0x80,0x00,0x59,0x0d,0x00,0x0a,0x30,
+0xb3,0x00,0xfd,0xde,0x80,0x59,0x00,0x1d,0x0b,0x40,0x00,0xb3,0x2f,0xdd,0xb0,0x2c,
+0x00,0x96,0x2c,0x00,0xa5,0x2f,0xde,0xc0,0x2c,0x00,0x97,0x2c,0x00,0x5a,0x2c,0x00,
+0x97,0x2f,0xdd,0xa0,0x03,0xcd,0xb2,0x00,0xd3,0x05,0xb0,0x4a,0x00,0x09,0x06,0x80,
+0x00,0x00,0x68,0x00,0x00,0x04,0xa0,0x00,0x80,0x0d,0x30,0x5b,0x00,0x3c,0xdb,0x10,
+0x2f,0xed,0x70,0x2c,0x00,0xb6,0x2c,0x00,0x2c,0x2c,0x00,0x0e,0x03,0x00,0x00,0x09,
+0x00,0xd1,0xb6,0x2f,0xde,0x70,0x2f,0xdd,0xd4,0x2c,0x00,0x00,0x2c,0x00,0x00,0x55,
+0x00,0x14,0x00,0x0c,0x00,0x47,0xd4,0x2f,0xdd,0xd3,0x0f,0x00,0x15,0xa0,0x0c,0x00,
+0xa1,0x03,0xcd,0xc2,0x00,0xd3,0x04,0xc0,0x4b,0x00,0x06,0x64,0x00,0xf0,0x05,0x06,
+0xde,0x14,0xb0,0x00,0xd1,0x0d,0x40,0x1e,0x10,0x2c,0xed,0x60,0x2c,0x00,0x0a,0x42,
+0xc0,0x00,0xa4,0x07,0x00,0x36,0xfd,0xdd,0xf4,0x0e,0x00,0x00,0x07,0x00,0x13,0x1d,
+0x01,0x00,0x53,0x00,0x03,0xc0,0x00,0x3c,0x05,0x00,0xf5,0x15,0xc3,0x00,0x3b,0x96,
+0x07,0x91,0xcd,0xb1,0x2c,0x00,0x7a,0x02,0xc0,0x4d,0x00,0x2c,0x2d,0x20,0x02,0xcd,
+0x60,0x00,0x2f,0xad,0x00,0x02,0xc0,0x89,0x00,0x2c,0x00,0xd4,0x02,0xc0,0x03,0xd0,
+0x79,0x00,0x08,0x03,0x00,0xf1,0x52,0x2f,0xdd,0xd1,0x2f,0x30,0x00,0x7e,0x2f,0x90,
+0x00,0xde,0x2b,0xd0,0x03,0xbe,0x2b,0x94,0x09,0x5e,0x2c,0x4a,0x0d,0x0e,0x2c,0x0d,
+0x59,0x0e,0x2c,0x08,0xe4,0x0e,0x2c,0x02,0xe0,0x0e,0x2f,0x10,0x0a,0x42,0xfa,0x00,
+0xa4,0x2c,0xd3,0x0a,0x42,0xc4,0xc0,0xa4,0x2c,0x0b,0x6a,0x42,0xc0,0x2e,0xb4,0x2c,
+0x00,0x8f,0x42,0xc0,0x00,0xe4,0x02,0xce,0xb1,0x00,0xd4,0x05,0xc0,0x4b,0x00,0x0d,
+0x26,0x80,0x00,0xa4,0x68,0x00,0x0a,0x44,0xb0,0x00,0xd2,0x0d,0x40,0x5c,0x00,0x2c,
+0xeb,0x10,0x2f,0xed,0xc2,0x2c,0x00,0x5b,0x22,0x01,0x46,0x5b,0x2f,0xdd,0xb2,0xf8,
+0x00,0xf1,0x16,0xce,0xb1,0x00,0xd3,0x06,0xb0,0x4a,0x00,0x0d,0x17,0x70,0x00,0xb3,
+0x77,0x00,0x0b,0x35,0xa0,0x00,0xd1,0x0d,0x30,0x6b,0x00,0x3c,0xef,0x40,0x00,0x00,
+0x4d,0x10,0x00,0x00,0x00,0x2f,0xee,0xa0,0x8e,0x01,0xfe,0x1f,0x4a,0x2c,0x00,0xa7,
+0x2f,0xde,0xa0,0x2c,0x04,0xb0,0x2c,0x00,0xc3,0x2c,0x00,0x4b,0x07,0xdd,0x80,0x3c,
+0x00,0xb5,0x5b,0x00,0x22,0x0b,0xb5,0x00,0x00,0x3a,0xd1,0x32,0x00,0x87,0x6a,0x00,
+0x96,0x08,0xdd,0xa0,0xad,0xee,0xda,0x00,0x77,0x00,0x03,0x00,0x38,0x59,0x00,0x1d,
+0x03,0x00,0xf0,0x45,0x4a,0x00,0x2c,0x1d,0x10,0x79,0x05,0xde,0xa1,0xb4,0x00,0x0e,
+0x15,0x90,0x04,0xb0,0x1e,0x00,0x96,0x00,0xb3,0x0d,0x10,0x06,0x83,0xb0,0x00,0x1d,
+0x86,0x00,0x00,0xbe,0x10,0x00,0x06,0xc0,0x00,0x95,0x00,0xf0,0x06,0x86,0x80,0x4f,
+0x40,0x95,0x2b,0x08,0x98,0x0c,0x10,0xe0,0xc1,0xb0,0xd0,0x0b,0x3c,0x0c,0x3a,0x00,
+0x89,0x80,0x89,0x70,0x04,0xf4,0x04,0xf4,0x00,0x1f,0x00,0x0f,0x00,0x6b,0x00,0x7a,
+0x0d,0x41,0xe2,0x04,0xd9,0x80,0x00,0xbe,0x37,0x00,0xf6,0x08,0x04,0xc8,0x90,0x0d,
+0x30,0xe2,0x6a,0x00,0x6b,0xa5,0x00,0x6a,0x3d,0x00,0xd2,0x0b,0x45,0xb0,0x03,0xcc,
+0x30,0x00,0xbb,0x88,0x00,0xf6,0x0e,0x7d,0xdd,0xf6,0x00,0x01,0xe1,0x00,0x0b,0x50,
+0x00,0x4c,0x00,0x00,0xd2,0x00,0x08,0x80,0x00,0x2d,0x00,0x00,0x9f,0xdd,0xd8,0x4d,
+0x74,0xa0,0x4a,0x04,0x03,0x00,0x60,0x4e,0x70,0xa3,0x00,0x04,0x90,0x5c,0x03,0x40,
+0x94,0x00,0x03,0xa0,0x08,0x00,0x94,0x85,0x00,0x02,0xa0,0x00,0x06,0x00,0xcc,0x0e,
+0x01,0x00,0xf4,0x63,0xcc,0x06,0x90,0x0c,0xc0,0x2a,0x84,0x85,0x2a,0xdd,0xdd,0x60,
+0x44,0x00,0xc1,0x09,0xdc,0x22,0x60,0x4a,0x07,0xbc,0xb5,0xa0,0x3b,0x69,0x07,0xb0,
+0xcd,0x9b,0x59,0x00,0x00,0x59,0x00,0x00,0x5c,0xcd,0x40,0x5c,0x02,0xd0,0x59,0x00,
+0xc1,0x59,0x00,0xc1,0x5c,0x02,0xd0,0x5b,0xce,0x40,0x08,0xdc,0x34,0xb0,0x2c,0x86,
+0x00,0x17,0x60,0x00,0x4b,0x02,0xb0,0x8d,0xc2,0x00,0x00,0xe0,0x00,0x0e,0x09,0xda,
+0xe4,0xb0,0x2e,0x76,0x00,0xe7,0x60,0x0e,0x4b,0x02,0xe0,0x9c,0xae,0x07,0xdc,0x33,
+0xa0,0x2c,0x7e,0xdd,0xd7,0x70,0x00,0x4c,0x01,0x60,0x8d,0xd4,0x03,0xd6,0x0c,0x30,
+0x0d,0x00,0x8f,0xc1,0x0e,0x00,0x02,0x00,0x43,0x09,0xda,0xe4,0xc0,0x30,0x00,0xf1,
+0x09,0x03,0xe0,0x9e,0xae,0x03,0x03,0xc0,0x9d,0xc3,0x59,0x00,0x05,0x90,0x00,0x5b,
+0xbe,0x45,0xc0,0x3c,0x59,0x01,0xd5,0x90,0x1d,0x05,0x00,0x31,0x3a,0x00,0x3a,0x01,
+0x00,0x62,0x04,0x90,0x00,0x04,0x90,0x49,0x03,0x00,0x32,0x05,0x94,0xe4,0x9b,0x00,
+0xf3,0x04,0x59,0x0b,0x60,0x59,0x89,0x00,0x5d,0xe0,0x00,0x5d,0xb6,0x00,0x59,0x1d,
+0x10,0x59,0x05,0xb0,0x3a,0x01,0x00,0xf5,0x03,0x5b,0xcd,0x5b,0xe8,0x05,0xb0,0x3f,
+0x10,0xe0,0x59,0x01,0xd0,0x0d,0x15,0x90,0x1d,0x00,0xd1,0x09,0x00,0x0b,0x61,0x00,
+0xf6,0x08,0x07,0xdd,0x40,0x4c,0x02,0xd0,0x86,0x00,0xb2,0x76,0x00,0xb3,0x3c,0x01,
+0xe0,0x07,0xdd,0x40,0x5c,0xbd,0x40,0x5b,0x01,0xf1,0x00,0x32,0x5c,0xcd,0x40,0x6e,
+0x00,0x36,0x09,0xda,0xd4,0xe3,0x00,0x21,0x9d,0xae,0xf7,0x00,0x55,0x00,0x00,0x5c,
+0xd3,0x5c,0x46,0x05,0xf6,0x0c,0x0a,0xdc,0x14,0xa0,0x56,0x1d,0x82,0x00,0x05,0xc5,
+0x67,0x05,0x90,0xad,0xc2,0x07,0x00,0xe0,0xbf,0xa0,0xe0,0x0e,0x00,0xe0,0x0e,0x00,
+0xac,0x71,0x00,0xf4,0x66,0x3b,0x04,0xd0,0xbd,0xad,0xb3,0x06,0x75,0x80,0xb2,0x1c,
+0x0d,0x00,0xb6,0x80,0x06,0xe3,0x00,0x1e,0x00,0xa3,0x0c,0x30,0xb2,0x67,0x0e,0x80,
+0xd0,0x2b,0x47,0xc3,0xa0,0x0d,0x92,0xb8,0x60,0x0a,0xd0,0x6f,0x20,0x06,0x90,0x2e,
+0x00,0x79,0x0a,0x60,0xd5,0xc0,0x04,0xf3,0x00,0x5f,0x40,0x0d,0x3d,0x08,0x80,0x97,
+0xb3,0x08,0x76,0x80,0xc2,0x1d,0x1c,0x00,0xb7,0x70,0x06,0xf2,0x00,0x1d,0x00,0x06,
+0x70,0x08,0xd1,0x00,0x7d,0xdf,0x70,0x02,0xd0,0x00,0xb4,0x00,0x6a,0x00,0x1d,0x10,
+0x08,0xed,0xd8,0x00,0x82,0x06,0x80,0x0a,0x40,0x0a,0x30,0x0c,0x10,0xaa,0x00,0x0c,
+0x10,0x0a,0x30,0x0a,0x40,0x06,0x80,0x00,0x82,0x29,0x01,0x00,0xf5,0x6f,0x14,0x82,
+0x00,0x2c,0x00,0x0e,0x00,0x0d,0x00,0x0b,0x30,0x04,0xf0,0x0b,0x20,0x0d,0x00,0x0e,
+0x00,0x2c,0x00,0x82,0x00,0x0b,0xd6,0x0b,0x13,0x70,0x9e,0x80,0x00,0x00,0xa3,0x00,
+0x00,0x00,0x0d,0xd3,0x00,0xed,0xdd,0xc2,0xd3,0x0d,0x00,0x00,0x02,0xd2,0xd0,0x00,
+0x00,0x4c,0x1c,0xdd,0xde,0x3d,0x10,0x00,0x00,0xdd,0x10,0x00,0x00,0x08,0x20,0x00,
+0x00,0x02,0xb0,0x00,0x00,0x02,0xde,0x00,0x00,0x02,0xd3,0xad,0xdd,0xe2,0xd3,0x00,
+0x00,0x0d,0x1d,0x50,0x00,0x00,0xd0,0x1c,0x5c,0xdd,0xdc,0x00,0x1c,0xf0,0x00,0x00,
+0x00,0x19,0x00,0x00,0x00,0x01,0x10,0x00,0x00,0x2d,0xd2,0x00,0x02,0xd3,0x3d,0x20,
+0x2d,0x30,0x03,0xd2,0x8d,0xe0,0x0e,0xd8,0x00,0xd0,0x0d,0x00,0x04,0x00,0xb8,0xdd,
+0xdd,0x00,0x00,0x11,0x11,0x00,0x00,0xdb,0xbd,0x00,0x18,0x00,0xf2,0x01,0xaf,0xc0,
+0x0c,0xfa,0x1c,0x50,0x05,0xc1,0x01,0xc5,0x5c,0x10,0x00,0x1c,0xc1,0x00,0x01,0x00,
+0x40,0x22,0x00,0x00,0x00,0xff,0x02,0xf1,0x0f,0x00,0x03,0xee,0x30,0x00,0x00,0x0c,
+0x77,0xb0,0x00,0x00,0x4e,0x00,0xe4,0x00,0x00,0xc5,0x00,0x6c,0x00,0x05,0xe2,0x22,
+0x2e,0x50,0x0d,0xff,0xff,0xff,0xd0,0x2b,0x00,0xf1,0x10,0x01,0x4d,0xd3,0x05,0xd8,
+0xc3,0x4b,0x3d,0x10,0xff,0xf5,0xa5,0x02,0xfe,0x78,0xb2,0x05,0x90,0x2b,0x96,0x00,
+0x00,0x69,0x2d,0x30,0x03,0xd1,0x03,0xcd,0xdc,0x30,0x98,0x00,0xf0,0x1f,0x08,0xcc,
+0x61,0x00,0x01,0xd3,0xee,0x3d,0x10,0x0b,0x70,0x44,0x07,0xb0,0x1a,0x20,0x00,0x01,
+0xc1,0x1a,0x10,0x00,0x01,0xb1,0x0b,0x50,0x00,0x05,0x90,0x04,0xc5,0x00,0x5a,0x60,
+0x00,0x4a,0xec,0x95,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x10,0x77,0x00,0xf0,0x17,
+0xeb,0xcd,0x91,0x00,0x1e,0x29,0xb1,0x4d,0x30,0x0c,0x90,0xb7,0x02,0xc0,0x0d,0x9c,
+0xc1,0x00,0xc2,0x0d,0x05,0x10,0x00,0xb3,0x0a,0x50,0x00,0x01,0xd0,0x02,0xd3,0x00,
+0x1b,0x50,0x00,0x2b,0xdd,0xd5,0x7f,0x00,0x10,0x00,0xd7,0x00,0xf2,0x11,0x10,0x00,
+0xef,0xff,0xf4,0x03,0xe0,0x00,0xd0,0x07,0x90,0x08,0x70,0x06,0xc0,0x97,0x00,0x4c,
+0xc5,0xd0,0x00,0x94,0x97,0xb2,0x00,0x77,0x00,0xd0,0x00,0x0b,0xcd,0x50,0x56,0x00,
+0xf0,0x10,0x04,0x43,0x00,0x00,0x0f,0xfc,0x00,0x1c,0x98,0x88,0x88,0x18,0x02,0x22,
+0x09,0x18,0x3b,0xba,0x09,0x08,0x15,0x54,0x09,0x08,0x27,0x76,0x09,0x0c,0x99,0x99,
+0x88,0x1c,0x00,0x31,0x00,0x02,0x21,0xd6,0x00,0xf2,0x39,0x20,0x04,0xcf,0xf8,0xb8,
+0x6f,0x71,0x32,0x91,0xb9,0x00,0x00,0x90,0x05,0xa0,0x00,0x90,0x09,0x50,0x00,0x92,
+0xd4,0x00,0x00,0xb9,0x9d,0x30,0x00,0x30,0x08,0xfe,0xfa,0x00,0x00,0x13,0x30,0x14,
+0x44,0x44,0x41,0x85,0xf8,0x44,0x58,0x90,0x62,0x7e,0xf8,0x91,0xf6,0x4d,0xf8,0x90,
+0x62,0x00,0x08,0x91,0xf6,0x00,0x08,0x90,0x83,0x00,0x08,0x90,0xe6,0x00,0x08,0x89,
+0xfc,0x99,0x98,0x4f,0x01,0xf2,0x17,0x3b,0xee,0xb2,0x00,0x04,0xd3,0x99,0x3d,0x40,
+0x0d,0x20,0x99,0x02,0xd0,0x1c,0x00,0x76,0x20,0xc2,0x1b,0x1a,0x97,0xa7,0xc2,0x0c,
+0xa9,0x51,0x8a,0xd0,0x03,0xf6,0x00,0x3d,0x30,0x00,0x2a,0xee,0xa2,0x2c,0x00,0xf1,
+0x1e,0x03,0xdd,0x90,0x00,0x00,0x0d,0x20,0x86,0x02,0x00,0x0d,0x00,0x49,0xef,0xa0,
+0x09,0x84,0xc9,0xff,0xf0,0x00,0xde,0xeb,0xff,0xb0,0x09,0x55,0xff,0xff,0x70,0x0c,
+0x1f,0xff,0xff,0xe0,0x0e,0xdf,0xff,0xff,0xf0,0x00,0x01,0x22,0x22,0x10,0xff,0x00,
+0x10,0x0a,0x28,0x07,0xf0,0x0d,0xa5,0x00,0x9a,0xa9,0x9f,0x60,0x89,0x99,0x99,0x92,
+0x2e,0xff,0xff,0xfe,0x02,0xd6,0x44,0x44,0x00,0x2c,0x20,0x00,0x00,0x01,0x90,0x00,
+0x00,0x00,0xd3,0x00,0xf0,0x15,0x05,0x8a,0x50,0x00,0x00,0x8a,0x76,0x70,0x00,0x08,
+0x63,0x70,0x00,0x15,0x58,0x50,0x00,0x4d,0x21,0x7a,0x00,0x0e,0x88,0xf1,0xf5,0x00,
+0x9b,0x49,0x2f,0x20,0x00,0x89,0x79,0x30,0x00,0x00,0x46,0x08,0xf3,0x01,0xea,0x00,
+0xd0,0x09,0x6a,0x0d,0x00,0x69,0xc2,0xd0,0x00,0x0a,0x2d,0x00,0x00,0xa2,0x07,0x00,
+0x42,0xed,0xdd,0xde,0x10,0xa0,0x00,0x90,0x3a,0x89,0x00,0x00,0x00,0xa0,0x02,0xaa,
+0x30,0x5b,0x00,0xf1,0x0e,0xa0,0x09,0x24,0x8c,0xd3,0x90,0x08,0x18,0x66,0x00,0x91,
+0x08,0x00,0x9f,0x10,0x26,0x08,0x20,0x67,0x30,0x45,0x00,0x88,0x89,0x99,0x80,0x00,
+0x00,0x00,0x52,0x00,0xf5,0x0d,0xe2,0x40,0x00,0x00,0x01,0xf4,0xc0,0x00,0x7d,0x7d,
+0x8d,0x20,0x03,0xb0,0x2e,0x1c,0x20,0x08,0x40,0x06,0xf8,0x00,0x0b,0x00,0x00,0xe2,
+0x00,0x0c,0x05,0x00,0x01,0x01,0x00,0xf0,0x1d,0x0a,0x80,0x55,0x91,0x1a,0x90,0x04,
+0x14,0xf9,0x2e,0x70,0x02,0x00,0x00,0x1a,0xb5,0x00,0x00,0x09,0xe0,0x08,0xc8,0x10,
+0x15,0x00,0x00,0x1c,0xcc,0xb0,0x00,0x00,0x06,0x00,0x58,0x8c,0x0a,0x00,0x00,0x0a,
+0x0a,0x00,0x00,0x55,0x0a,0x7a,0x00,0xa5,0x96,0x09,0x20,0x09,0x00,0x74,0x00,0x09,
+0x00,0x00,0x04,0x00,0xf0,0x10,0x02,0x00,0x01,0x21,0x06,0x00,0x37,0x6c,0x0a,0x00,
+0x00,0x19,0x0a,0x00,0x00,0xa1,0x0a,0x95,0x09,0x30,0x0a,0x00,0x61,0x00,0x0a,0x00,
+0x07,0x00,0x08,0x00,0x09,0x8a,0x02,0xf0,0x19,0x98,0x88,0x10,0x00,0x11,0x10,0x00,
+0x13,0x43,0x07,0x00,0x25,0x4c,0x0a,0x00,0x00,0x47,0x0a,0xa5,0x02,0xa0,0x0a,0x00,
+0x68,0x00,0x09,0x00,0x03,0x55,0x55,0x00,0x02,0x44,0x4b,0x00,0x07,0xaa,0xab,0x00,
+0x0a,0x33,0x01,0xf3,0x11,0x99,0x99,0x10,0x24,0x54,0x08,0x00,0x13,0x3b,0x09,0x00,
+0x00,0x19,0x09,0x95,0x00,0xa2,0x09,0x10,0x2a,0x30,0x09,0x00,0x30,0x00,0x03,0x00,
+0x09,0x99,0x9d,0x00,0x0a,0x02,0x00,0x30,0x04,0x88,0x87,0x7c,0x00,0xf0,0x15,0x10,
+0x28,0x9d,0x16,0x30,0x00,0x0b,0x06,0x40,0x00,0x57,0x06,0xa7,0x07,0x80,0x06,0x30,
+0x33,0x00,0x03,0x10,0x09,0x08,0x09,0x00,0x09,0xad,0x0d,0x10,0x09,0x09,0x56,0x90,
+0x04,0x87,0x40,0x13,0x01,0xf0,0x0f,0x40,0x00,0x89,0xb5,0x0a,0x00,0x00,0x09,0x10,
+0xa0,0x00,0x02,0x90,0x0d,0x91,0x03,0xa0,0x00,0xa0,0x02,0x70,0x00,0x06,0x00,0x00,
+0x69,0x8a,0x20,0x00,0x0a,0xc8,0x00,0xa0,0xb2,0x05,0x80,0x00,0x01,0x78,0x50,0x00,
+0x25,0x55,0x7d,0x00,0x01,0xa5,0x00,0x10,0x95,0xa5,0x00,0xf2,0x02,0x59,0x00,0x09,
+0x00,0x11,0x33,0x45,0x00,0x09,0x66,0x55,0x00,0x0a,0x99,0x99,0x00,0x09,0xa5,0x00,
+0xf0,0x12,0x20,0x00,0x00,0x40,0x64,0x9a,0x78,0x09,0x00,0x64,0x80,0x90,0x09,0x08,
+0x6b,0x01,0x90,0x84,0xa0,0x92,0x08,0x09,0x56,0x00,0x80,0x93,0x00,0x08,0x19,0x00,
+0x00,0x81,0x90,0x19,0x01,0xf0,0x17,0x00,0x40,0x50,0x38,0x9a,0x81,0x80,0x00,0x47,
+0x88,0xc1,0x00,0xb0,0x81,0x90,0x0a,0x30,0x80,0x80,0x42,0x00,0x30,0x60,0x00,0x19,
+0x99,0x40,0x00,0x92,0x00,0xa0,0x00,0x75,0x02,0xa0,0x00,0x05,0x86,0x51,0x02,0xf2,
+0x07,0x62,0x88,0xb3,0x09,0x00,0x0a,0x00,0x90,0x02,0x93,0x39,0x00,0xa1,0x55,0x90,
+0x75,0x00,0x09,0x56,0x00,0x00,0x90,0x61,0x01,0x12,0x90,0xab,0x01,0x31,0x41,0x88,
+0xc2,0x23,0x00,0xe0,0x04,0x76,0x99,0x03,0xa0,0x00,0x93,0x70,0x00,0x09,0x00,0x80,
+0x00,0x60,0x34,0x01,0x30,0xd8,0x89,0x60,0x69,0x03,0xf0,0x09,0x55,0x00,0x80,0x43,
+0xb1,0x0a,0x00,0x0b,0x59,0xa0,0x09,0x30,0x0a,0x19,0x30,0x00,0xa1,0x00,0x00,0x04,
+0x00,0xc9,0x99,0x90,0x2f,0x01,0xf3,0x1b,0xa0,0x00,0x90,0x07,0x88,0x84,0x01,0x11,
+0x05,0x42,0x17,0x7a,0x09,0x63,0x00,0x27,0x09,0x53,0x00,0x67,0x79,0x53,0x00,0xa0,
+0x29,0x53,0x06,0x50,0x09,0x53,0x29,0x00,0x09,0x53,0x10,0x00,0x09,0x53,0x00,0x00,
+0x08,0x53,0x11,0x03,0xf0,0x1b,0x31,0x28,0x8b,0x09,0x72,0x00,0x28,0x09,0x73,0x00,
+0xa4,0x99,0x72,0x09,0x40,0x09,0x72,0x32,0x00,0x05,0x51,0x00,0x08,0x04,0x30,0x00,
+0x3b,0x09,0x50,0x00,0xa6,0x98,0xa3,0x02,0x20,0x50,0x04,0x00,0x01,0x00,0x63,0x87,
+0xb9,0x00,0xdc,0x59,0x90,0x02,0x80,0x09,0x00,0xa1,0x12,0x90,0x83,0x07,0x79,0x64,
+0xb9,0x00,0xf1,0x08,0x31,0x88,0xb2,0x0a,0x00,0x0b,0x49,0xa0,0x04,0x77,0x8a,0x05,
+0x90,0x00,0xa3,0x50,0x00,0x06,0x00,0x99,0x99,0x70,0x00,0xef,0x01,0xf0,0x18,0xa0,
+0x00,0x00,0x03,0x05,0x56,0x10,0x80,0x33,0x97,0x9b,0x00,0x1a,0x00,0xa0,0x0a,0x28,
+0x9b,0x2a,0x20,0x00,0x90,0x05,0x55,0x54,0x00,0x44,0x44,0xa0,0x0a,0xaa,0xa8,0x00,
+0xb0,0x00,0x00,0x08,0x99,0x97,0x46,0x00,0xe0,0x89,0xb2,0x0a,0x00,0x0a,0x49,0xa0,
+0x03,0x87,0x8a,0x03,0x90,0x00,0xa3,0xbd,0x01,0xa0,0x59,0x8a,0x20,0x0b,0x00,0x19,
+0x00,0xa2,0x05,0x70,0xb9,0x01,0xf1,0x11,0x10,0x05,0x51,0x28,0x8a,0x09,0x72,0x00,
+0x29,0x79,0x72,0x00,0x74,0x29,0x72,0x00,0xa2,0x29,0x72,0x06,0x54,0x69,0x72,0x38,
+0x00,0x09,0x72,0x20,0x00,0x09,0x72,0x00,0x04,0x00,0x52,0x00,0x10,0x05,0x99,0x9b,
+0xb9,0x02,0x00,0x80,0x00,0x10,0x18,0xb5,0x02,0xf1,0x10,0x06,0x00,0x00,0x18,0x00,
+0x00,0x79,0x9a,0x99,0x94,0x04,0x99,0x99,0x10,0x00,0x00,0x07,0x20,0x00,0x05,0x08,
+0x20,0x00,0x0a,0x04,0x00,0x79,0x9d,0x99,0x94,0x00,0xf0,0x01,0xa0,0x9a,0x30,0x00,
+0x00,0x05,0x50,0x00,0x00,0x05,0x40,0x75,0x02,0x06,0x28,0x00,0x11,0x07,0x28,0x00,
+0x13,0x69,0x28,0x00,0xf6,0x00,0x06,0x20,0x03,0x30,0x07,0xa9,0x8b,0x40,0x07,0x20,
+0x05,0x40,0x03,0x89,0x98,0x28,0x00,0x10,0x06,0x28,0x00,0x10,0x05,0x28,0x00,0x11,
+0x93,0x13,0x01,0xe0,0x89,0x97,0x00,0x05,0x50,0x08,0x20,0x03,0x90,0x1b,0x00,0x00,
+0x38,0x72,0x12,0x00,0x50,0x50,0x01,0x89,0x98,0x09,0x11,0x01,0xf2,0x09,0x90,0x00,
+0x01,0x09,0x0a,0x00,0x00,0x91,0x80,0xd9,0x10,0x09,0x15,0x0a,0x00,0x00,0x90,0x21,
+0xa0,0x04,0x99,0x86,0x2a,0x00,0x2d,0x01,0x00,0x55,0x02,0x00,0xe5,0x03,0x23,0x89,
+0x99,0x2d,0x00,0xf1,0x02,0x09,0x09,0x0b,0x40,0x00,0xa0,0x21,0xb4,0x04,0x89,0x86,
+0x1a,0x00,0x00,0x60,0x00,0x60,0x57,0x01,0x86,0x00,0xd9,0x99,0x60,0x00,0x06,0x99,
+0x9b,0xa7,0x03,0xe1,0x81,0x69,0x00,0x00,0xa2,0x74,0x00,0x00,0x92,0x70,0x00,0x69,
+0xa9,0xa9,0x86,0x00,0x02,0x20,0x00,0x13,0x0a,0x24,0x00,0x61,0x04,0x00,0x89,0x9b,
+0x99,0x92,0x0f,0x00,0x03,0x04,0x00,0x00,0x6c,0x00,0x23,0x04,0x88,0xc2,0x00,0x01,
+0x04,0x00,0xd9,0x04,0x00,0x69,0x9b,0xa9,0x94,0x00,0x06,0x30,0x00,0x05,0x9b,0xaa,
+0x12,0x01,0x37,0x05,0x99,0x99,0x4c,0x00,0x10,0x03,0x28,0x00,0xf1,0x05,0x82,0x03,
+0x46,0x64,0x10,0x03,0x4a,0x27,0x50,0x08,0x97,0x03,0x50,0x0a,0x00,0x03,0x50,0x06,
+0x99,0x01,0x8b,0x03,0x60,0x08,0x99,0x90,0x90,0x00,0x00,0x04,0x00,0xe1,0x61,0x90,
+0x48,0xc8,0x72,0x90,0x00,0xa0,0x69,0xb0,0x00,0x30,0x00,0x80,0xe0,0x00,0x11,0xd9,
+0xc6,0x04,0x43,0x40,0x99,0x99,0x09,0xdf,0x00,0xe0,0x00,0x00,0x50,0x94,0x9a,0x98,
+0x39,0x00,0x81,0x00,0x90,0x08,0x10,0x09,0x07,0x00,0x03,0x05,0x01,0x80,0x04,0x99,
+0x9c,0x30,0x00,0x00,0x06,0x30,0x77,0x01,0x01,0x73,0x00,0x75,0xb9,0x9c,0x96,0x00,
+0xa0,0x0a,0x00,0x04,0x00,0x32,0x20,0x02,0x00,0xbd,0x01,0x10,0x9c,0xc3,0x00,0x10,
+0x10,0xce,0x04,0xd0,0x69,0x99,0x99,0x93,0x00,0x09,0x0a,0x00,0x06,0x38,0x08,0x00,
+0x07,0x3a,0x00,0x33,0xa8,0x89,0x40,0xe1,0x01,0x07,0xf8,0x00,0x01,0x88,0x04,0x01,
+0x3c,0x00,0x00,0x30,0x00,0x37,0x04,0x88,0x98,0xee,0x04,0x44,0x05,0x00,0x79,0x99,
+0x15,0x02,0x14,0x9b,0x03,0x01,0x10,0x50,0x03,0x01,0x03,0x94,0x00,0x03,0x28,0x00,
+0x10,0x08,0x3c,0x00,0x02,0x15,0x02,0x12,0x40,0x04,0x00,0x33,0x05,0xb8,0x88,0x6c,
+0x00,0x17,0x98,0x2b,0x01,0x20,0x02,0x00,0x3f,0x06,0x00,0x06,0x05,0x92,0x03,0x44,
+0x49,0x20,0x07,0x99,0x9a,0x10,0x0b,0x24,0x00,0x38,0x30,0x04,0x99,0x78,0x00,0x16,
+0x04,0x50,0x00,0xf0,0x00,0x20,0x04,0x30,0x07,0xa9,0x9b,0x40,0x07,0x20,0x05,0x40,
+0x03,0x89,0x98,0x10,0xf1,0x0e,0x00,0x01,0x00,0x61,0x88,0xa6,0x09,0x00,0x07,0x20,
+0x90,0x00,0xa0,0x09,0x00,0x73,0x00,0x90,0x47,0x00,0x09,0x28,0x00,0x00,0x90,0x00,
+0x00,0x09,0x00,0x07,0x00,0x00,0x01,0x00,0xf0,0x2d,0x52,0x88,0xc3,0x0a,0x00,0x0b,
+0x00,0xa0,0x08,0x50,0x0a,0x2a,0x40,0x00,0xa0,0x05,0x55,0x55,0x00,0x44,0x44,0xa0,
+0x0a,0xaa,0xa8,0x00,0xb0,0x00,0x00,0x08,0x99,0x97,0x00,0x00,0x00,0x41,0x88,0xc3,
+0x09,0x00,0x0b,0x00,0x90,0x05,0x60,0x09,0x07,0x70,0x00,0x92,0x30,0x00,0x04,0x00,
+0x90,0x00,0x90,0x0d,0xa9,0x9a,0x07,0x00,0xf1,0x15,0x08,0x88,0x84,0x00,0x00,0x00,
+0x50,0x04,0xa8,0x9b,0x0a,0x00,0x05,0x50,0xa0,0xa0,0x00,0x82,0x28,0x0a,0x00,0x0a,
+0x07,0x30,0xd8,0x15,0x50,0xa0,0x09,0x00,0x50,0x55,0x00,0x90,0x00,0x02,0x70,0x00,
+0xf8,0x12,0x00,0xa0,0x00,0x00,0x00,0x04,0x00,0x01,0x01,0x00,0x64,0x98,0x89,0x09,
+0x07,0x33,0x70,0x90,0xa0,0x67,0x9a,0x09,0x0a,0x00,0xa7,0x31,0x90,0x09,0x40,0x91,
+0x00,0x90,0x01,0x96,0x00,0xf5,0x0a,0x00,0x29,0xb8,0x8d,0x00,0x00,0x73,0x0a,0x00,
+0x00,0xa0,0x0a,0x00,0x00,0x70,0x04,0x00,0x89,0x9b,0x99,0x90,0x00,0x0a,0x00,0x00,
+0x04,0x00,0xf0,0x08,0x02,0x00,0x00,0x08,0xa6,0x8a,0x40,0x00,0x46,0x04,0x50,0x00,
+0x73,0x05,0x40,0x00,0xa0,0x07,0x30,0x00,0x70,0x06,0x10,0x3c,0x00,0xf0,0x09,0x79,
+0x99,0x99,0x94,0x08,0x94,0x89,0x20,0x00,0x37,0x05,0x50,0x00,0x72,0x06,0x40,0x00,
+0x40,0x05,0x10,0x69,0x99,0x99,0x93,0x1c,0x00,0x80,0x06,0xa9,0x9b,0x30,0x08,0x20,
+0x05,0x40,0x04,0x00,0x72,0x03,0x89,0x88,0x10,0x29,0x95,0x99,0x68,0x00,0xf0,0x08,
+0xb0,0x0a,0x00,0x00,0x30,0x04,0x00,0x78,0x98,0x88,0x82,0x02,0x44,0x44,0x00,0x09,
+0x44,0x43,0x00,0x0a,0x99,0x99,0x10,0x94,0x00,0xe0,0x05,0x99,0x99,0x20,0x03,0x00,
+0x00,0x70,0x00,0xa0,0x00,0x09,0x00,0x0a,0xa4,0x00,0x43,0xa0,0x00,0x0d,0x92,0x09,
+0x00,0x50,0x09,0x00,0x0b,0x99,0x70,0xb6,0x00,0x01,0xe4,0x00,0x11,0x90,0x9a,0x00,
+0x80,0x03,0x00,0x00,0x60,0x00,0xa0,0x00,0x0a,0x2d,0x00,0xf0,0x00,0xd9,0x20,0xa2,
+0x24,0x0a,0x00,0x07,0x76,0x40,0x90,0x00,0x05,0x55,0x54,0x00,0x5d,0x01,0x61,0x00,
+0x1b,0x9a,0x98,0x00,0x02,0x34,0x00,0x49,0x99,0x98,0x00,0x02,0x2d,0x00,0x00,0xe5,
+0x00,0x30,0x0b,0x99,0x80,0x1d,0x00,0xc0,0x03,0x00,0x02,0xc9,0x99,0x90,0x00,0x37,
+0x00,0x0a,0x00,0x03,0x7c,0x00,0x00,0x6a,0x01,0x82,0x01,0x00,0x04,0x05,0x0a,0x00,
+0x09,0x18,0x04,0x00,0x61,0x0b,0x58,0x0a,0x00,0x0a,0x48,0x0c,0x00,0x63,0x88,0x29,
+0x18,0x00,0x00,0x09,0x04,0x00,0x20,0x00,0x02,0x55,0x00,0x30,0xa0,0x00,0x0a,0x40,
+0x01,0x30,0xa0,0x29,0x9a,0x07,0x00,0x00,0x0e,0x00,0x32,0x99,0x60,0xa0,0x3d,0x01,
+0x00,0x8b,0x01,0x04,0x23,0x00,0xf0,0x07,0x03,0x99,0xb0,0xa0,0x01,0x09,0x0a,0x99,
+0x70,0x90,0x03,0x33,0x43,0x00,0x66,0x55,0xa0,0x1a,0x99,0x98,0x02,0x90,0x9c,0x00,
+0x10,0x97,0x23,0x00,0x01,0x83,0x01,0xf1,0x18,0x03,0x99,0xc0,0x0a,0x11,0x30,0x90,
+0x08,0x87,0x50,0x90,0x00,0x08,0x95,0x20,0x03,0x88,0x88,0x80,0x00,0x38,0x87,0x10,
+0x00,0xb1,0x04,0x80,0x00,0x49,0x98,0x10,0x01,0x00,0x04,0x23,0x0a,0x00,0x0a,0x36,
+0x04,0x00,0x61,0x07,0x9a,0x36,0x0a,0x00,0x09,0x04,0x00,0x73,0x0b,0x99,0x29,0x36,
+0x00,0x00,0x09,0x04,0x00,0x30,0x00,0x01,0x00,0x4d,0x01,0x12,0x40,0x04,0x00,0xa0,
+0x06,0x40,0x00,0x00,0x04,0xb9,0x99,0x10,0x00,0x05,0x08,0x01,0xc0,0x10,0x00,0x79,
+0x9b,0x99,0x94,0x00,0x30,0x00,0x00,0x00,0x08,0xc4,0x01,0x10,0x91,0x2c,0x02,0xf3,
+0x11,0x9d,0x98,0x00,0x04,0x44,0xb4,0x45,0x10,0x44,0x44,0x44,0x40,0x00,0x79,0x99,
+0x90,0x00,0x00,0x50,0x32,0x00,0x00,0x09,0x05,0x40,0x00,0x07,0x99,0x88,0x20,0x00,
+0x40,0x0a,0x02,0x01,0xce,0x00,0x32,0x0a,0x98,0x89,0x39,0x02,0x43,0x88,0x88,0x99,
+0x92,0x13,0x00,0x04,0x1c,0x00,0x10,0x00,0xc4,0x02,0xf2,0x15,0x00,0x00,0x00,0x07,
+0x20,0x00,0x00,0x00,0x77,0x66,0x71,0x00,0x00,0x22,0x21,0x00,0x08,0x98,0xd8,0x88,
+0x10,0x03,0x5c,0x55,0x00,0x00,0x34,0x44,0xb0,0x00,0x07,0x99,0x9b,0x00,0x00,0xb0,
+0xec,0x01,0x1d,0x40,0x5a,0x00,0x14,0x10,0x5a,0x00,0x30,0x94,0x00,0x1a,0xe3,0x01,
+0x20,0xa0,0x09,0xef,0x01,0x04,0xab,0x02,0x0a,0xd4,0x00,0x44,0x05,0xa9,0x99,0x10,
+0x18,0x00,0x00,0x75,0x02,0x26,0x01,0x10,0x20,0x00,0x12,0x03,0x1c,0x00,0x00,0x18,
+0x00,0xe0,0x94,0x05,0x20,0x00,0x00,0x07,0x30,0x00,0x00,0x06,0xa8,0x89,0x30,0x00,
+0x8f,0x01,0x13,0x20,0x28,0x00,0x61,0x73,0x34,0x00,0x01,0x55,0x54,0x24,0x00,0x11,
+0x00,0xce,0x02,0xd3,0x96,0x00,0x04,0x60,0x08,0x20,0x03,0x90,0x1a,0x10,0x00,0x48,
+0x72,0xb7,0x01,0x10,0x09,0x7e,0x02,0x02,0xe1,0x01,0x11,0x90,0xbe,0x01,0x16,0x60,
+0xd6,0x03,0x00,0x68,0x01,0x14,0x50,0xfd,0x01,0x60,0x00,0x0a,0x0c,0x99,0x90,0x90,
+0x79,0x03,0xd2,0xc9,0x99,0x80,0x19,0x00,0x0a,0x01,0x90,0x00,0x90,0x07,0x88,0x84,
+0x23,0x00,0x03,0x46,0x00,0x21,0x09,0x0b,0x23,0x00,0xa3,0x03,0x01,0x80,0x00,0x90,
+0x1d,0xa9,0x99,0x01,0x80,0xd6,0x03,0x81,0x05,0x00,0x7a,0x97,0x0a,0x00,0x81,0x00,
+0x04,0x00,0xc3,0x10,0x91,0x00,0x0a,0x85,0x91,0x00,0x09,0x00,0x69,0x99,0x49,0xee,
+0x02,0x11,0x09,0x46,0x02,0x00,0xa9,0x02,0x25,0x89,0x96,0x28,0x00,0xc2,0x84,0x89,
+0x8a,0x39,0x00,0x00,0x15,0x09,0x00,0x07,0x00,0x06,0xad,0x03,0x60,0x88,0x88,0x00,
+0x00,0x11,0x10,0x27,0x01,0x04,0x28,0x00,0xa1,0x21,0x91,0x00,0x0a,0x63,0x69,0x9b,
+0x3a,0x00,0x00,0x1c,0x04,0xd0,0x08,0x00,0x0a,0x99,0x9d,0x00,0x0a,0x00,0x09,0x00,
+0x05,0x99,0x98,0xf9,0x01,0xf1,0x03,0x05,0x0c,0x88,0x09,0x18,0x09,0x00,0x09,0x18,
+0x19,0x00,0x0b,0x68,0x19,0x00,0x0b,0x48,0x19,0xe3,0x02,0x19,0x19,0xe3,0x02,0x62,
+0x01,0x22,0x00,0x60,0xc7,0x72,0xc3,0x00,0x24,0x28,0x89,0xe3,0x02,0x36,0x98,0x80,
+0xa0,0x09,0x01,0xf0,0x03,0x02,0x33,0x00,0x50,0xc6,0x51,0x0a,0x0a,0x00,0x99,0xa0,
+0xa0,0x01,0x09,0x09,0x99,0x60,0x90,0x83,0x03,0x60,0x34,0x33,0xa0,0x0a,0x99,0x98,
+0xdc,0x01,0x11,0x08,0x6f,0x00,0x90,0x60,0x0d,0x98,0x10,0xa0,0x0a,0x01,0x99,0xa0,
+0x44,0x00,0x30,0x0c,0x98,0x60,0x3a,0x00,0xf2,0x11,0x30,0x01,0x99,0x99,0x60,0x00,
+0x43,0x08,0x00,0x00,0x54,0x09,0x00,0x02,0x99,0x88,0x80,0x02,0x22,0x05,0x24,0x0c,
+0x65,0x09,0x35,0x09,0x00,0x09,0x35,0x09,0x06,0x99,0x08,0x00,0x00,0x04,0x00,0x32,
+0x99,0x19,0x35,0xdf,0x02,0x30,0x08,0x36,0x00,0x7c,0x01,0xf1,0x34,0x21,0x04,0x33,
+0x0c,0x75,0x0a,0x55,0x0a,0x04,0x6a,0x55,0x0a,0x02,0x3a,0x55,0x0c,0x88,0x09,0x55,
+0x00,0x00,0x04,0x22,0x00,0x69,0x99,0xb2,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x72,
+0x00,0x00,0x00,0x10,0x00,0x00,0x07,0x41,0x0c,0x96,0x0a,0x63,0x0a,0x00,0x0a,0x63,
+0x0a,0x06,0x9a,0x62,0x0a,0x02,0x0a,0x62,0x08,0x86,0x0a,0x62,0x00,0x80,0x04,0x41,
+0x77,0x02,0xb1,0xa8,0x88,0x91,0x00,0x01,0x10,0x00,0x01,0x21,0x05,0x32,0x50,0x00,
+0xf1,0x08,0x06,0x9a,0x55,0x0a,0x00,0x09,0x55,0x0b,0x99,0x09,0x54,0x00,0x13,0x34,
+0x51,0x00,0x35,0x55,0x93,0x00,0x59,0x99,0xb2,0x2a,0x03,0x14,0x49,0xdc,0x04,0x12,
+0x97,0x53,0x02,0x11,0x30,0x87,0x02,0x00,0xf5,0x01,0x01,0xf5,0x02,0x93,0x79,0x9b,
+0xa9,0x94,0x02,0x99,0x98,0x00,0x06,0xa3,0x02,0x40,0x02,0x9c,0xa9,0x20,0x29,0x00,
+0x00,0x63,0x02,0x30,0x04,0x99,0x99,0x79,0x02,0x12,0x50,0x04,0x00,0x2c,0x02,0x10,
+0x28,0x00,0xf3,0x02,0x12,0x28,0x52,0x21,0x46,0x66,0x66,0x62,0x00,0x79,0x97,0x00,
+0x04,0x70,0x08,0x20,0x02,0x87,0x02,0x00,0x38,0x01,0x24,0xc9,0x85,0x41,0x02,0xe2,
+0x0a,0x99,0x80,0x90,0x03,0x10,0x09,0x00,0x62,0x00,0x93,0x8a,0x98,0x2a,0x39,0x03,
+0x00,0xee,0x03,0x22,0x80,0xc8,0x23,0x00,0x11,0xaa,0xf8,0x01,0xf3,0x04,0xa5,0x9a,
+0x98,0x2a,0x00,0x40,0x00,0x70,0x18,0x00,0x00,0x01,0xd9,0x99,0x50,0x08,0x99,0x50,
+0x80,0xa7,0x02,0xf0,0x08,0x8b,0x96,0x0a,0x01,0x84,0x41,0xa4,0x76,0x64,0x07,0x01,
+0x99,0x99,0x50,0x37,0x00,0x0a,0x03,0x70,0x01,0x90,0x08,0x98,0x5a,0x06,0x00,0x41,
+0x02,0x12,0x86,0x9c,0x03,0x00,0xb6,0x01,0x07,0xe4,0x03,0x09,0x75,0x05,0x00,0x37,
+0x02,0xf0,0x04,0x99,0x99,0x00,0x08,0x20,0x00,0x00,0x08,0x75,0x56,0x10,0x01,0x33,
+0x33,0x00,0x89,0x8b,0x88,0x83,0xe1,0x03,0x31,0x03,0x44,0x4b,0xe0,0x03,0x12,0x0b,
+0xdf,0x03,0x10,0x30,0xdf,0x01,0x21,0xc8,0x84,0x98,0x00,0x20,0xc9,0x97,0x41,0x00,
+0xb0,0x94,0x9a,0x99,0x29,0x00,0x72,0x00,0x90,0x07,0x20,0x09,0x07,0x00,0x02,0xd5,
+0x02,0x03,0xb9,0x02,0x02,0x78,0x00,0x27,0x99,0x20,0x02,0x04,0xbf,0x01,0x90,0x00,
+0x01,0xa0,0x19,0x00,0x00,0x19,0x01,0x80,0x78,0x00,0x02,0xf4,0x02,0x79,0xc8,0x9c,
+0x83,0x03,0xc4,0x5b,0x10,0x02,0x44,0x47,0x40,0x07,0x99,0x9a,0x30,0x0b,0x57,0x04,
+0x04,0xa3,0x01,0x12,0x20,0x8b,0x04,0x34,0x06,0xa9,0x99,0x42,0x04,0x00,0xb3,0x06,
+0x15,0x93,0x7b,0x01,0xff,0x00,0x73,0x34,0x10,0x01,0x44,0x44,0x10,0x68,0x88,0x88,
+0x83,0x00,0x00,0x01,0x10,0xa3,0x01,0x09,0x44,0x04,0xa9,0x99,0x20,0xf3,0x06,0x16,
+0x04,0x52,0x04,0x01,0x6c,0x00,0x31,0x03,0x99,0x99,0x10,0x00,0xf8,0x04,0x07,0x86,
+0x66,0x20,0x00,0x23,0x32,0x00,0x69,0x88,0x88,0x83,0x04,0x55,0x54,0x00,0x03,0x54,
+0x4c,0x10,0x01,0x11,0x20,0x50,0x00,0x21,0x50,0x00,0x04,0x00,0xc9,0x02,0x98,0x99,
+0x20,0x24,0x44,0x44,0x41,0x35,0x55,0x55,0x52,0xf3,0x01,0xb6,0x38,0x83,0x00,0x22,
+0x20,0x07,0xc6,0x62,0x0a,0x90,0x00,0x03,0x00,0x31,0x99,0x87,0x0a,0x29,0x05,0x12,
+0x09,0xc5,0x00,0x37,0x60,0xd9,0x82,0x75,0x04,0x80,0xa0,0x00,0x10,0x06,0x00,0x39,
+0x89,0x20,0xd9,0x06,0x60,0xa2,0x04,0x80,0x01,0x68,0x50,0x28,0x08,0x40,0x09,0x93,
+0xc8,0x19,0xd4,0x07,0x50,0x90,0x0a,0x00,0xa0,0x09,0x09,0x00,0x11,0xd9,0x09,0x00,
+0x3a,0x89,0x4b,0x92,0x44,0x07,0x00,0x58,0x01,0xf0,0x02,0x50,0x88,0x98,0x19,0x90,
+0x90,0x90,0x09,0x90,0x90,0x90,0x0c,0xc0,0x90,0x90,0x09,0xa0,0x0c,0x00,0x30,0x68,
+0x78,0x39,0xeb,0x04,0x03,0x04,0x00,0x71,0x00,0x20,0x0c,0x93,0xc9,0x30,0x0a,0x40,
+0x07,0x95,0xa0,0x00,0x0b,0x95,0xb9,0x50,0x00,0x04,0x10,0xf5,0x02,0xff,0x03,0x00,
+0x48,0x57,0x81,0x00,0x0a,0x13,0x81,0x00,0x00,0xa0,0x27,0x00,0x00,0x0a,0x86,0xc8,
+0x20,0x3f,0x02,0x08,0x00,0x17,0x02,0xc0,0x0c,0x89,0x92,0x90,0x09,0x09,0x00,0x90,
+0x0c,0x89,0x83,0x90,0x1a,0x00,0x72,0x38,0x9a,0x95,0x90,0x00,0x46,0x00,0x04,0x00,
+0x21,0x45,0x00,0x71,0x00,0x00,0xc8,0x04,0x40,0x59,0x99,0x0a,0x00,0xba,0x02,0x80,
+0x02,0x2a,0x0a,0x10,0xa7,0x74,0x09,0x85,0x07,0x08,0x37,0x98,0x99,0x39,0x18,0x05,
+0x11,0x01,0xed,0x08,0xf9,0x08,0x59,0x9a,0x0a,0x00,0x12,0x2a,0x0a,0x00,0xa5,0x53,
+0x0a,0x95,0xa0,0x01,0x0a,0x00,0x49,0x85,0x19,0x00,0x06,0x00,0x07,0x18,0x05,0xf1,
+0x04,0x48,0x85,0x08,0x00,0x01,0x19,0x0a,0x00,0x13,0x39,0x0a,0x10,0xa6,0x63,0x09,
+0x95,0x98,0x9a,0x39,0x3c,0x00,0x31,0x06,0xaa,0xaa,0x14,0x05,0x00,0x04,0x00,0x33,
+0x04,0x98,0x87,0x28,0x00,0x41,0x09,0x00,0x59,0x99,0x70,0x00,0xf0,0x1e,0x10,0x97,
+0x79,0x39,0x00,0x02,0x10,0x06,0x00,0x01,0x99,0x95,0x00,0x07,0x30,0x0a,0x00,0x06,
+0x60,0x1b,0x00,0x00,0x58,0x71,0x00,0x01,0x10,0x40,0x50,0x68,0xc0,0x90,0x90,0x00,
+0x90,0x90,0x90,0x36,0xc0,0x95,0xb0,0x94,0x30,0x93,0xa0,0x0d,0x00,0x20,0x88,0x96,
+0xe5,0x05,0x04,0x04,0x00,0xf3,0x0f,0x00,0x20,0x03,0x32,0x03,0x61,0x05,0x5b,0x27,
+0x82,0x05,0x5b,0x1a,0xb2,0x0b,0x32,0x19,0x92,0x0c,0x68,0x47,0x81,0x01,0x20,0x02,
+0x40,0x00,0x69,0x99,0xb0,0xfb,0x06,0x10,0xa0,0xaa,0x04,0x03,0xa0,0x00,0xfd,0x01,
+0x94,0x48,0x8a,0x0a,0x00,0xa3,0x32,0x0a,0x00,0x94,0x46,0x2a,0x94,0x02,0x10,0x07,
+0x78,0x00,0x60,0x02,0x21,0x00,0x61,0x77,0xc0,0xb0,0x00,0x60,0x90,0x66,0xc2,0x9c,
+0x0b,0x32,0x67,0x00,0x47,0x09,0x0c,0x88,0x70,0xd9,0x09,0xb0,0x08,0x88,0x00,0x80,
+0x11,0xa0,0x0a,0x08,0x9d,0x49,0xd0,0x24,0x02,0x80,0x89,0x80,0xa0,0x01,0x00,0x05,
+0x00,0xa9,0x7a,0x05,0x00,0xbf,0x01,0x88,0xa0,0x05,0x88,0x86,0x08,0x88,0x00,0x70,
+0x23,0x00,0x50,0x70,0xa0,0x00,0x00,0x03,0x68,0x0a,0x30,0x0b,0xa9,0x9c,0x07,0x00,
+0x80,0x06,0x88,0x86,0x23,0x20,0x50,0x70,0x46,0xe1,0x00,0xf0,0x02,0xa0,0x80,0x90,
+0x48,0xd5,0xc1,0x90,0x92,0x10,0x81,0x90,0x90,0x00,0x81,0x90,0x79,0x85,0x37,0x09,
+0x03,0x04,0x00,0x00,0x44,0x02,0xf4,0x07,0x31,0x04,0x33,0x05,0x5a,0x0a,0x45,0x04,
+0x5a,0x7b,0x45,0x0b,0x31,0x1a,0x45,0x0c,0x68,0x3a,0x45,0x01,0x20,0x03,0x8b,0x05,
+0x13,0x63,0x04,0x00,0x10,0x10,0x9f,0x05,0xf1,0x09,0x08,0x99,0x0a,0x45,0x00,0x09,
+0x1a,0x45,0x0c,0x95,0x7b,0x45,0x0a,0x01,0x09,0x45,0x08,0x87,0x19,0x45,0x00,0x50,
+0x07,0x44,0xb7,0x00,0x31,0x99,0x88,0x92,0x50,0x00,0x31,0x21,0x00,0x60,0xe1,0x00,
+0xca,0x29,0xc0,0x66,0xc0,0x09,0x0b,0x32,0x03,0xa0,0x90,0x01,0x6b,0xe1,0x00,0xf5,
+0x0a,0x07,0x87,0x00,0x70,0x11,0xa4,0x9c,0x07,0x8c,0x00,0x90,0xa1,0x04,0x9c,0x0c,
+0x78,0x60,0x90,0x11,0x00,0x04,0x00,0x89,0x99,0xb0,0x77,0x09,0xb0,0x02,0x08,0x87,
+0x00,0x60,0x01,0x1a,0x5a,0xd0,0x08,0x9d,0xfe,0x02,0x21,0x49,0xc0,0x3e,0x0a,0xd1,
+0x12,0x22,0x30,0x00,0x67,0x77,0xb0,0x00,0x89,0x99,0xa0,0x00,0xa0,0xcf,0x03,0x40,
+0x80,0x03,0x99,0x9b,0x4b,0x02,0x00,0xeb,0x08,0x72,0x00,0x07,0x97,0x87,0x10,0x00,
+0x13,0xd8,0x02,0x82,0x69,0x9b,0xa9,0x93,0x00,0x49,0x99,0x80,0xa3,0x08,0x30,0x89,
+0x99,0x80,0xc6,0x06,0x11,0x10,0x5c,0x00,0x84,0x89,0x99,0x88,0x81,0x00,0x48,0x89,
+0x90,0x45,0x09,0x11,0x81,0x88,0x02,0x31,0x02,0x99,0x99,0x3a,0x00,0x80,0x05,0xba,
+0xaa,0x10,0x05,0xa8,0x88,0x20,0x38,0x04,0x00,0x45,0x00,0x31,0x03,0x10,0x00,0xb7,
+0x04,0x13,0x07,0x2f,0x04,0xf4,0x15,0x00,0x25,0x55,0x40,0x00,0x01,0x44,0x4b,0x00,
+0x00,0x7a,0x99,0x80,0x00,0x04,0x8b,0x88,0x10,0x08,0x88,0xd8,0x88,0x10,0x00,0x11,
+0x11,0x00,0x00,0x68,0x88,0xc2,0x00,0x06,0x99,0x9c,0x10,0x23,0x09,0x12,0x30,0x82,
+0x00,0xb2,0x11,0x1a,0x00,0x00,0x98,0x88,0x70,0x00,0x08,0x98,0x89,0x82,0x00,0x40,
+0x99,0x9a,0x99,0x91,0xcf,0x0a,0xb1,0x00,0x00,0x2d,0x60,0x00,0x00,0x4b,0x16,0x80,
+0x00,0x05,0xd9,0x08,0x00,0x8d,0x04,0x13,0x9c,0xcf,0x00,0xf4,0x02,0x98,0x00,0x07,
+0x97,0x78,0x20,0x00,0x21,0x11,0x00,0x00,0xa0,0x44,0x00,0x69,0xc9,0xaa,0xcf,0x00,
+0x21,0x09,0x00,0x7b,0x02,0x01,0x79,0x09,0x20,0x59,0x89,0xbd,0x00,0x00,0xa2,0x07,
+0x35,0xc9,0x99,0x20,0x8c,0x09,0x00,0x59,0x0b,0x11,0x02,0x37,0x03,0xf0,0x0c,0x07,
+0x20,0x05,0xb9,0x99,0x10,0x06,0x85,0x55,0x20,0x00,0x33,0x33,0x00,0x69,0x9b,0xb9,
+0x94,0x03,0x15,0x32,0x10,0x07,0xa9,0x9b,0x40,0x07,0xd9,0x0b,0x30,0x99,0x99,0x10,
+0xfe,0x04,0x00,0x08,0x01,0x50,0x06,0x99,0x9b,0x10,0x0a,0xb6,0x00,0x22,0x98,0x98,
+0x2a,0x05,0x53,0xd9,0x9d,0x94,0x00,0xa0,0x59,0x0c,0x40,0x40,0x03,0x00,0x02,0x55,
+0x06,0xf1,0x13,0x11,0x18,0x20,0x05,0xa8,0x88,0x10,0x05,0xa8,0x89,0x30,0x11,0x12,
+0x11,0x10,0x57,0xc7,0x9a,0x73,0x04,0xd9,0xbc,0x20,0x08,0x20,0x05,0x50,0x08,0x30,
+0x05,0x40,0x02,0x88,0x88,0xb8,0x09,0x05,0x94,0x01,0xb4,0xa9,0x99,0x00,0x07,0x20,
+0x01,0x00,0x03,0x99,0x98,0x20,0xe8,0x09,0xf1,0x05,0x02,0x66,0x66,0x00,0x00,0x22,
+0x2a,0x10,0x05,0xa9,0x9a,0x00,0x07,0x52,0x22,0x10,0x02,0x66,0x66,0x20,0x18,0x00,
+0x22,0x20,0x00,0xae,0x05,0x32,0xb8,0x89,0x40,0x2e,0x06,0x13,0x98,0x44,0x00,0xa0,
+0x98,0x00,0x04,0x99,0x89,0x10,0x78,0x88,0x88,0x82,0x64,0x01,0x93,0x05,0x88,0x8b,
+0x20,0x05,0x99,0x9b,0x20,0x0a,0x62,0x01,0x04,0xc0,0x00,0x00,0x6c,0x00,0xf0,0x05,
+0x06,0xa9,0x98,0x10,0x12,0x22,0x22,0x20,0x57,0x77,0x77,0x73,0x05,0x99,0x9a,0x20,
+0x09,0x10,0x05,0x40,0x04,0x00,0xf0,0x14,0x04,0x89,0x88,0x10,0x02,0x22,0x02,0x31,
+0x77,0xc0,0x45,0x00,0x0a,0x04,0x50,0x67,0xc0,0x45,0x0a,0x21,0x04,0x50,0xa0,0x00,
+0x45,0x0c,0x98,0x94,0x50,0x00,0x00,0x45,0x00,0x00,0x04,0x75,0x05,0xa0,0x18,0x88,
+0x00,0x60,0x11,0x91,0x0a,0x08,0x9c,0x10,0xac,0x07,0x31,0x0c,0x89,0x70,0x10,0x0a,
+0x35,0x99,0x99,0x80,0x96,0x02,0xf0,0x0b,0x03,0x04,0x44,0x00,0x50,0x44,0xa1,0x0a,
+0x03,0x3a,0x10,0x90,0xb4,0x40,0x09,0x0b,0x23,0x40,0x90,0x55,0x52,0x09,0x00,0x50,
+0x00,0x80,0xda,0x02,0x50,0xb8,0x88,0x70,0x00,0x11,0x46,0x00,0x12,0x50,0x46,0x00,
+0x40,0xa0,0xa0,0x00,0x09,0xdc,0x02,0x71,0x12,0x10,0x04,0x00,0xb9,0x99,0xa0,0xf3,
+0x03,0x56,0x00,0xa0,0x06,0x88,0x85,0x23,0x00,0x02,0x69,0x00,0x20,0x60,0x90,0xb3,
+0x01,0x10,0x80,0xbd,0x03,0x10,0x9b,0x07,0x00,0x02,0x23,0x00,0x82,0x80,0x01,0x19,
+0x10,0xa0,0x08,0x9c,0x00,0x70,0x09,0x10,0x88,0x94,0x0c,0xf0,0x03,0x30,0x90,0x00,
+0x02,0xa0,0x10,0x00,0x0b,0xa6,0x00,0x01,0xa3,0x06,0x80,0x00,0x10,0x00,0x10,0x28,
+0x00,0x05,0x6e,0x00,0xc0,0x0a,0x0c,0x67,0x60,0xa0,0x33,0x20,0x07,0x00,0x29,0x89,
+0x40,0x6e,0x00,0x61,0x83,0x03,0xa0,0x00,0x68,0x61,0x51,0x0a,0x51,0x99,0x0a,0x00,
+0x90,0x09,0x04,0x00,0x10,0x96,0xba,0x05,0x00,0x04,0x00,0x3a,0x79,0x88,0x09,0xa1,
+0x0a,0x00,0x83,0x03,0x10,0x8a,0x73,0x06,0x01,0x28,0x00,0x20,0x97,0x89,0x2d,0x0a,
+0x00,0x87,0x05,0x27,0x99,0x99,0x50,0x0e,0xa3,0x04,0x00,0x13,0x42,0x06,0x00,0x95,
+0x4a,0x0a,0x00,0x48,0x00,0x70,0x95,0x86,0x6a,0x09,0x00,0x02,0x20,0xc9,0x0a,0x11,
+0x09,0x22,0x00,0x15,0x09,0xc9,0x0a,0x14,0x08,0x50,0x00,0x10,0x95,0x7c,0x00,0xf0,
+0x08,0x89,0x89,0x08,0x00,0x00,0x00,0x78,0x00,0x09,0x04,0x88,0x60,0x09,0x00,0x99,
+0x00,0x0b,0x45,0x65,0x40,0x03,0x41,0x88,0x0f,0x04,0x31,0x00,0x89,0x9a,0x74,0x00,
+0x01,0x28,0x00,0xf3,0x01,0x59,0x97,0x09,0x00,0x02,0x33,0x44,0x00,0x03,0x65,0x5c,
+0x00,0x06,0x99,0xab,0x00,0xea,0x01,0x1c,0x10,0x50,0x00,0x31,0x79,0x98,0x0a,0xeb,
+0x02,0xf1,0x01,0x05,0x99,0xaa,0x00,0x00,0x04,0xb1,0x00,0x02,0x98,0xa6,0x00,0x05,
+0x00,0x03,0x20,0x19,0x0b,0x50,0x7a,0x09,0x08,0x09,0x09,0x04,0x00,0xf0,0x0b,0x0c,
+0x68,0x08,0x09,0x0b,0x38,0x08,0x09,0x09,0x08,0x0a,0x88,0x09,0x08,0x00,0x00,0x09,
+0x08,0x00,0x00,0x09,0x08,0x00,0x00,0x00,0x01,0xf0,0x5f,0x00,0x00,0x04,0x14,0x0c,
+0x8c,0x0b,0x4a,0x09,0x09,0x0c,0xba,0x09,0x09,0x0a,0x7a,0x0c,0x9b,0x0a,0x7a,0x00,
+0x00,0x02,0x23,0x00,0x54,0x00,0x48,0x00,0x5b,0x99,0xa8,0x00,0x54,0x00,0x18,0x00,
+0x28,0x88,0x83,0x00,0x00,0x02,0x03,0x0c,0x8c,0x0b,0x0a,0x09,0x09,0x0c,0x8a,0x09,
+0x09,0x0b,0x0a,0x0c,0x8b,0x0a,0x0a,0x00,0x00,0x04,0x08,0x00,0x00,0x65,0x00,0x00,
+0x01,0xba,0x10,0x00,0x2b,0x22,0xa2,0x00,0x31,0x00,0x03,0x02,0x22,0x00,0x61,0xb5,
+0xb0,0x09,0x18,0x09,0x00,0x91,0x80,0x93,0x9b,0x17,0x09,0x00,0x91,0x70,0x90,0x09,
+0x0a,0x8a,0x00,0x90,0x00,0x00,0x09,0x00,0x00,0x07,0x00,0xd0,0x00,0x03,0x33,0x00,
+0x50,0x0b,0x5b,0x00,0xa0,0x09,0x09,0x14,0xb0,0x04,0x00,0xc1,0x0b,0x6b,0x20,0x90,
+0x01,0x21,0x00,0x90,0x00,0x60,0x00,0x80,0x21,0x00,0x42,0xa8,0x88,0x90,0x00,0x01,
+0x00,0x30,0x50,0x0c,0x9c,0x28,0x00,0xf1,0x07,0x49,0xc0,0x09,0x09,0x00,0xa0,0x0a,
+0x9a,0x20,0x90,0x00,0x33,0x34,0x30,0x00,0x56,0x55,0xb0,0x00,0x99,0x99,0x90,0x2c,
+0x00,0xf1,0x07,0x79,0x99,0x80,0x02,0x21,0x05,0x34,0x0c,0x5a,0x09,0x45,0x09,0x09,
+0x09,0x45,0x09,0x0b,0x9a,0x45,0x08,0x09,0x09,0x04,0x00,0x60,0x09,0x88,0x09,0x45,
+0x00,0x00,0x04,0x00,0x20,0x08,0x35,0x4d,0x00,0x71,0x06,0x66,0x00,0x80,0x0a,0x2a,
+0x18,0x4c,0x00,0x02,0x04,0x00,0xa1,0x4b,0xc0,0x07,0x88,0x10,0x90,0x00,0x70,0x00,
+0x60,0x4c,0x00,0x21,0xb8,0x89,0x78,0x00,0x70,0x04,0x55,0x00,0x70,0xb4,0xa3,0x9c,
+0x23,0x00,0xf0,0x09,0x90,0x92,0x8c,0x0c,0x8c,0x01,0xa0,0x00,0x00,0x06,0x00,0x29,
+0x89,0x40,0x09,0x00,0x0a,0x00,0x83,0x03,0xa0,0x00,0x68,0x61,0x27,0x00,0x80,0x07,
+0xa9,0x9c,0x10,0x08,0x10,0x07,0x20,0x04,0x00,0xf0,0x09,0x06,0x99,0x9b,0x10,0x00,
+0x04,0x10,0x00,0x00,0x08,0x20,0x00,0x79,0x9b,0xa9,0x94,0x03,0x99,0x99,0x10,0x06,
+0x40,0x05,0x40,0x04,0x00,0xf2,0x05,0x02,0x9b,0xa8,0x10,0x00,0x06,0x40,0x00,0x69,
+0x99,0x99,0x93,0x05,0x99,0x99,0x20,0x00,0x00,0x05,0x50,0x04,0x00,0x80,0x02,0x10,
+0x00,0x59,0x99,0x90,0x00,0x09,0x1a,0x01,0x00,0xce,0x00,0x32,0x04,0x9c,0x87,0x23,
+0x01,0xf1,0x07,0x99,0x99,0x99,0x91,0x00,0x00,0x60,0x00,0x00,0x00,0x1e,0x40,0x00,
+0x00,0x2b,0x29,0x60,0x00,0x07,0x10,0x05,0x20,0x12,0x01,0xf0,0x07,0x09,0x88,0x8c,
+0x00,0x00,0xa0,0x00,0x90,0x00,0x09,0x77,0x7c,0x00,0x00,0x01,0x11,0x00,0x00,0x88,
+0x88,0x99,0x92,0x13,0x00,0x52,0x00,0x00,0x0a,0x00,0x00,0x09,0x00,0x00,0x65,0x01,
+0xe1,0x99,0x99,0x00,0x06,0x40,0x08,0x10,0x06,0x30,0x08,0x10,0x02,0x98,0x89,0x14,
+0x00,0xf1,0x01,0x69,0x9a,0xc9,0x94,0x04,0x32,0x70,0x00,0x06,0x40,0x20,0x00,0x05,
+0xb8,0x89,0x40,0xed,0x00,0xf0,0x29,0x99,0x99,0x20,0x08,0x10,0x05,0x40,0x08,0x86,
+0x6a,0x40,0x00,0x22,0x21,0x00,0x78,0xd8,0x9c,0x84,0x03,0xc4,0x5b,0x10,0x02,0x44,
+0x47,0x60,0x07,0x99,0x9a,0x40,0x0b,0x00,0x00,0x00,0x05,0x99,0x99,0x50,0x02,0x23,
+0x00,0x50,0xc5,0xb0,0x18,0x09,0x08,0x01,0x80,0x90,0x81,0x18,0x09,0x08,0x11,0x07,
+0x00,0xb2,0x0a,0x8a,0x01,0x80,0x00,0x00,0x18,0x00,0x00,0x01,0x70,0x76,0x00,0x41,
+0x60,0xc9,0xc0,0x0a,0x38,0x01,0x40,0x90,0x0a,0x0c,0x8c,0x8b,0x00,0x51,0x05,0x00,
+0x89,0x99,0x90,0x9a,0x00,0x00,0x0e,0x00,0x16,0x03,0xd3,0x01,0x2f,0x00,0xa0,0xd3,
+0x01,0x09,0x00,0x4b,0x00,0x08,0x28,0x00,0x02,0x4d,0x00,0xf0,0x03,0x10,0xa0,0x00,
+0x01,0xa0,0x20,0x00,0x09,0xb3,0x00,0x00,0x96,0x09,0x50,0x01,0x20,0x00,0x40,0x50,
+0x00,0x0c,0x73,0x00,0x0b,0xab,0x01,0x66,0x08,0x88,0x00,0x80,0x09,0x1a,0x4b,0x00,
+0xf1,0x10,0x08,0x98,0x10,0xa0,0x00,0x07,0x76,0x10,0x00,0x79,0x88,0x70,0x00,0x00,
+0x3a,0x40,0x00,0x6a,0x8a,0x71,0x00,0x20,0x00,0x11,0x20,0x02,0x08,0x00,0xa0,0x09,
+0x0a,0x25,0x00,0xe0,0x99,0x9b,0x09,0x96,0xa0,0x09,0x09,0x10,0x90,0x09,0x09,0x00,
+0x79,0x89,0xb8,0x02,0x04,0x04,0x00,0xf0,0x06,0x02,0x00,0x30,0x03,0x06,0x00,0x80,
+0x09,0x09,0x00,0x98,0x8a,0x09,0x95,0x80,0x09,0x09,0x10,0x79,0x88,0x09,0x47,0x01,
+0x43,0x00,0x07,0x99,0x99,0x83,0x01,0x11,0x0a,0x10,0x00,0x32,0x10,0x02,0x05,0x28,
+0x00,0x51,0x7a,0x09,0x00,0x91,0x19,0x2c,0x00,0x82,0x00,0x38,0x84,0x09,0x00,0x05,
+0x00,0x08,0x26,0x00,0x61,0x88,0x88,0x00,0x00,0x11,0x10,0x50,0x00,0x10,0x81,0x74,
+0x00,0x30,0x8a,0x09,0xa5,0x24,0x00,0xf3,0x01,0x58,0x86,0x09,0x00,0x02,0x33,0x34,
+0x00,0x04,0x66,0x6c,0x00,0x07,0xaa,0xab,0x00,0x81,0x01,0x11,0x10,0x28,0x00,0xf1,
+0x0c,0x0a,0x0a,0x00,0x98,0x8c,0x0a,0xa5,0x80,0x0a,0x09,0x00,0x58,0x87,0x09,0x00,
+0x03,0x32,0x34,0x00,0x05,0x59,0x4b,0x00,0x09,0x97,0x08,0x00,0x02,0x00,0x50,0x97,
+0x03,0x00,0x40,0x05,0xa0,0x00,0x93,0x0a,0x00,0x98,0x8a,0x0a,0x84,0x80,0x09,0x0a,
+0xa0,0x00,0xf0,0x02,0x06,0x00,0x00,0x98,0x94,0x00,0x07,0x30,0x0a,0x00,0x06,0x60,
+0x2b,0x00,0x00,0x58,0x71,0xa4,0x00,0x50,0x05,0x18,0x09,0x09,0x09,0x04,0x00,0xf4,
+0x03,0x1d,0x9c,0x0b,0x59,0x09,0x09,0x0a,0x39,0x09,0x09,0x09,0x09,0x0a,0x89,0x09,
+0x09,0x00,0x00,0x04,0x00,0xf3,0x13,0x00,0x02,0x02,0x02,0x03,0x51,0x09,0x09,0x18,
+0x73,0x0c,0x8c,0x1b,0xa3,0x09,0x09,0x0a,0x83,0x0b,0x8b,0x08,0x73,0x00,0x00,0x03,
+0x31,0x00,0x59,0x99,0xb0,0x00,0x00,0x00,0x91,0xd5,0x03,0xf0,0x00,0x10,0x10,0x01,
+0x00,0x68,0x10,0x90,0x09,0x81,0x09,0x00,0x98,0x99,0xc4,0x89,0x07,0x00,0x59,0x10,
+0x90,0x09,0x59,0x99,0xf9,0x03,0x50,0x02,0x00,0x50,0x09,0x08,0xce,0x01,0xce,0x12,
+0xa0,0x09,0x09,0x26,0xb0,0x0a,0x4b,0x00,0x90,0x03,0x42,0xf9,0x03,0x40,0x04,0x03,
+0x00,0x60,0xab,0x01,0x41,0x0d,0x9d,0x59,0xd0,0xb7,0x01,0x28,0x89,0x00,0x26,0x02,
+0x32,0xa0,0x00,0xa0,0x26,0x02,0x40,0x04,0x04,0x00,0x70,0xf7,0x01,0x30,0x8d,0x49,
+0xc0,0x07,0x00,0x12,0x8b,0x63,0x02,0x30,0xa9,0x99,0xa0,0xfe,0x01,0xf0,0x01,0x90,
+0x00,0xa0,0x05,0x88,0x86,0x03,0x03,0x00,0x60,0x90,0x90,0x0a,0x0d,0x9d,0x29,0x23,
+0x00,0x02,0x88,0x04,0x10,0x02,0x6e,0x00,0x30,0x0b,0x99,0x9c,0x07,0x00,0xb0,0x06,
+0x88,0x86,0x01,0x01,0x05,0x34,0x18,0x09,0x09,0x45,0x04,0x00,0x32,0x1d,0x9d,0x9a,
+0x47,0x04,0x00,0x04,0x00,0x1a,0x87,0x3f,0x04,0xc0,0x02,0x03,0x04,0x23,0x09,0x09,
+0x09,0x36,0x0d,0x9d,0x9b,0x36,0x08,0x00,0xf1,0x0a,0x0a,0x89,0x09,0x36,0x00,0x13,
+0x34,0x41,0x00,0x25,0x55,0x84,0x00,0x4a,0x99,0xa3,0x00,0x73,0x00,0x00,0x00,0x39,
+0x99,0x94,0x02,0xe6,0x00,0x62,0x13,0xb0,0x0d,0x9d,0x14,0xb0,0x75,0x02,0x56,0x2a,
+0xc0,0x07,0x87,0x00,0x67,0x04,0x08,0xe6,0x00,0xb3,0x08,0x38,0xc0,0x0d,0x9d,0x01,
+0xa0,0x09,0x09,0x39,0xc0,0xe6,0x00,0x1c,0x50,0xe6,0x00,0xf7,0x07,0x01,0x00,0x02,
+0x00,0x06,0x30,0x09,0x00,0x06,0xa9,0x9d,0x00,0x07,0x20,0x0a,0x00,0x06,0xa8,0x8c,
+0x00,0x00,0x03,0x6c,0x04,0xfc,0x08,0x30,0x04,0x10,0x05,0xa7,0x7b,0x20,0x05,0x51,
+0x17,0x20,0x02,0x9c,0xa9,0x00,0x12,0x28,0x42,0x21,0x56,0x66,0x66,0x62,0x6c,0x04,
+0xf0,0x01,0x04,0x30,0x05,0x10,0x05,0xa8,0x8b,0x20,0x05,0x40,0x07,0x20,0x04,0xa9,
+0x9b,0x10,0x40,0x00,0x70,0x69,0x9a,0x99,0x93,0x03,0x20,0x00,0x9f,0x04,0x00,0x12,
+0x04,0x20,0x50,0x00,0x6d,0x02,0xf1,0x0b,0x30,0x07,0x00,0x07,0xb9,0x9d,0x00,0x07,
+0x74,0x4b,0x00,0x01,0x4b,0x53,0x00,0x78,0x8c,0x88,0x92,0x01,0x22,0x23,0x00,0x04,
+0x76,0x6b,0xe8,0x04,0x03,0x91,0x02,0x20,0x30,0x03,0x50,0x00,0x21,0xb9,0x9c,0x50,
+0x00,0xf0,0x0e,0x03,0x9b,0x9a,0x00,0x00,0x07,0x20,0x00,0x79,0x99,0x99,0x93,0x00,
+0x05,0x30,0x00,0x00,0x0c,0x90,0x00,0x02,0xa2,0x4a,0x10,0x04,0x00,0x01,0x30,0x00,
+0x02,0x00,0x30,0x09,0x10,0x09,0xd7,0x04,0x12,0xc0,0xed,0x04,0x32,0x49,0x99,0x70,
+0xcd,0x04,0x46,0x99,0xd9,0x98,0x20,0xb7,0x04,0x70,0x04,0x00,0x00,0x02,0x20,0x03,
+0x00,0x51,0x00,0x83,0x05,0xa9,0x9c,0x20,0x04,0xb9,0x9c,0x10,0xb7,0x04,0xd1,0x93,
+0x02,0x32,0x70,0x00,0x05,0x50,0x30,0x00,0x04,0xb8,0x89,0x60,0xa5,0x00,0x40,0x10,
+0x07,0x00,0x07,0x11,0x01,0xed,0x53,0x3a,0x00,0x01,0x55,0x54,0x00,0x79,0x8a,0x88,
+0x82,0x01,0x2b,0x33,0xa5,0x00,0xd1,0x00,0x53,0x00,0x70,0x00,0x07,0xb9,0x9c,0x00,
+0x00,0x77,0x33,0xa0,0x2a,0x00,0xf1,0x03,0x08,0x98,0xa8,0x88,0x20,0x00,0x1a,0x11,
+0x00,0x00,0x98,0x88,0x71,0x00,0x0a,0x99,0xa9,0x10,0x95,0x01,0x01,0x2e,0x01,0xf2,
+0x05,0x30,0x00,0x20,0x00,0x08,0x10,0x07,0x10,0x00,0x99,0x99,0xc1,0x00,0x08,0x10,
+0x08,0x10,0x00,0x49,0x99,0x8b,0x06,0xb0,0x08,0x9d,0x99,0xc8,0x30,0x01,0x90,0x19,
+0x00,0x00,0x19,0xf3,0x04,0x30,0x40,0x04,0x00,0x97,0x01,0x55,0x07,0x30,0x09,0x00,
+0x07,0x97,0x01,0x23,0x8b,0x00,0x01,0x00,0x00,0x07,0x01,0x40,0x94,0x05,0x20,0x06,
+0x23,0x06,0x33,0x00,0x07,0x63,0xa2,0x00,0x23,0x88,0x89,0x47,0x01,0x11,0x6a,0xa2,
+0x00,0x14,0x0a,0xa2,0x00,0xf6,0x08,0x00,0x00,0x40,0x90,0x09,0x09,0x09,0x00,0x90,
+0xa0,0xd9,0x99,0x09,0x0a,0x00,0x90,0x90,0x90,0x09,0x09,0x0a,0x98,0x70,0x38,0x03,
+0xf1,0x10,0x01,0x03,0x00,0x30,0x50,0x09,0x00,0x80,0xa0,0x0c,0x89,0x80,0xa0,0x09,
+0x01,0x80,0x90,0x0a,0x45,0x80,0x90,0x03,0x43,0x10,0x90,0x00,0x80,0x00,0x80,0x00,
+0xb0,0x52,0x02,0x21,0x80,0x00,0x40,0x01,0x20,0x30,0x60,0x28,0x00,0x22,0x0d,0x99,
+0x28,0x00,0x3a,0x09,0x88,0x40,0x5e,0x05,0x12,0xc0,0x52,0x02,0xf3,0x10,0x21,0x12,
+0x20,0x80,0x09,0x46,0x99,0x0a,0x00,0x94,0x69,0x90,0xa0,0x0a,0xa6,0xdc,0x0d,0x80,
+0x94,0x59,0x90,0xa0,0x09,0x45,0x99,0x09,0x00,0x8a,0x4b,0xa0,0x90,0xeb,0x04,0x21,
+0x00,0xa0,0xf0,0x04,0xf1,0x13,0x20,0x11,0x25,0x00,0x92,0x68,0x78,0x10,0x9a,0x6c,
+0x98,0xa5,0x93,0x68,0x78,0x10,0x59,0x39,0x68,0x10,0x01,0x33,0x34,0x00,0x02,0x66,
+0x6c,0x00,0x04,0xaa,0xab,0x00,0x07,0x40,0x6d,0x06,0xe1,0x10,0x10,0x11,0x10,0x69,
+0x17,0x98,0x09,0x91,0x79,0x80,0x99,0x97,0xdc,0x07,0x00,0x67,0x16,0x98,0x09,0x69,
+0x4a,0xa0,0x00,0x04,0x00,0x0f,0x06,0xf9,0x08,0x00,0x90,0x0a,0x00,0x00,0xa0,0x0a,
+0x00,0x02,0xc0,0x0a,0x00,0x07,0xa3,0x09,0x96,0x0a,0x0a,0x09,0x00,0x72,0x06,0x39,
+0x63,0x05,0x80,0x00,0x20,0x03,0x00,0x00,0xa0,0x09,0x10,0x04,0x00,0xf8,0x00,0x07,
+0xc2,0x09,0x97,0x49,0x09,0x19,0x10,0x60,0x00,0x26,0x00,0x05,0x99,0x9a,0x63,0x05,
+0x00,0x03,0x00,0xf1,0x09,0x80,0x00,0x01,0x90,0x09,0x00,0x00,0x57,0x00,0x90,0x00,
+0x0a,0xb1,0x09,0x95,0x06,0x51,0x90,0x90,0x00,0x50,0x01,0x19,0x00,0x6f,0x03,0x23,
+0x0a,0x00,0x1c,0x01,0x00,0x68,0x05,0x20,0x00,0x02,0x2f,0x06,0xf2,0x05,0x80,0x0a,
+0x00,0x00,0x47,0x00,0xa0,0x00,0x0a,0xb1,0x0a,0x95,0x07,0x51,0xa0,0xa0,0x00,0x40,
+0x00,0x13,0x7d,0x07,0x32,0x0a,0x99,0x9d,0x59,0x07,0x40,0x04,0x88,0x87,0x00,0x95,
+0x01,0x02,0xab,0x00,0x10,0x37,0x2d,0x00,0xf2,0x0a,0xb0,0x0a,0x85,0x07,0x62,0x90,
+0xa0,0x00,0x60,0x01,0x18,0x00,0x00,0x19,0x99,0x50,0x00,0x08,0x30,0x0a,0x00,0x00,
+0x66,0x02,0xb0,0x4a,0x05,0xf4,0x0e,0x10,0x30,0x50,0x00,0x90,0x81,0x90,0x01,0x80,
+0x81,0x90,0x04,0xa0,0x86,0xb0,0x08,0xa0,0x84,0xb0,0x19,0x27,0x81,0x90,0x81,0x08,
+0x81,0x90,0x00,0x00,0x04,0x00,0xf0,0x17,0x00,0x20,0x00,0x10,0x04,0x34,0x00,0xa0,
+0x0a,0x46,0x01,0xb0,0x0b,0x86,0x07,0xa3,0x0b,0x66,0x38,0x0a,0x1a,0x46,0x30,0x00,
+0x04,0x22,0x00,0x79,0x99,0xb3,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x63,0x4a,0x05,
+0x41,0x00,0x20,0x04,0x12,0x28,0x00,0xf0,0x3b,0xc0,0x0c,0xa6,0x08,0x85,0x0a,0x46,
+0x57,0x08,0x2a,0x46,0x10,0x00,0x02,0x11,0x00,0x7a,0x99,0xb3,0x00,0x91,0x00,0x54,
+0x00,0x91,0x00,0x64,0x00,0x38,0x88,0x81,0x00,0x20,0x04,0x23,0x00,0xa0,0x19,0x45,
+0x01,0xb0,0x1c,0xa6,0x08,0x94,0x19,0x55,0x57,0x09,0x28,0x45,0x10,0x00,0x03,0x34,
+0x00,0x08,0x99,0x60,0x00,0x83,0x00,0x92,0x00,0x76,0x01,0xa1,0x00,0x05,0x87,0x20,
+0x00,0x40,0x08,0xcc,0x00,0xf1,0x0f,0x63,0x02,0xd0,0x09,0x31,0x0a,0x58,0x09,0x21,
+0x74,0x04,0x5a,0x63,0x00,0x02,0x0a,0x00,0x00,0x0a,0x12,0x00,0x00,0x4b,0xa0,0x00,
+0x05,0x90,0x3a,0x10,0x02,0x78,0x00,0x50,0x00,0x60,0x0a,0x00,0x09,0x05,0x01,0xd8,
+0x1e,0x08,0x99,0x06,0x86,0x00,0x90,0xa0,0xa0,0x09,0x62,0x03,0x50,0xc2,0x01,0x01,
+0x23,0x00,0xf7,0x04,0x0a,0x00,0xc0,0x69,0xa0,0x69,0x70,0x09,0x38,0x06,0x50,0x93,
+0x00,0x00,0x05,0x02,0x99,0x99,0x60,0xe3,0x07,0x42,0x40,0x00,0x60,0x09,0x23,0x00,
+0xa0,0x59,0x80,0x0a,0x29,0x05,0x60,0xa3,0x00,0x02,0x0a,0x8f,0x01,0x00,0x21,0x00,
+0x21,0xd8,0x88,0xbe,0x03,0xf0,0x0c,0x30,0x00,0x70,0x09,0x10,0x0a,0x00,0xd3,0x58,
+0xa0,0x83,0xa1,0x09,0x65,0x01,0x60,0x90,0x01,0x22,0x22,0x00,0x77,0x77,0xa0,0x0a,
+0xaa,0xa8,0xd0,0x02,0x70,0x08,0x99,0x97,0x00,0x30,0x00,0x60,0x23,0x00,0x70,0xc0,
+0x59,0xa0,0x59,0x90,0x0a,0x39,0x46,0x00,0xfa,0x1b,0x00,0x07,0x00,0x4a,0x99,0x20,
+0x0b,0x00,0x19,0x00,0xb2,0x05,0x80,0x01,0x78,0x50,0x00,0x20,0x05,0x34,0x00,0x90,
+0x09,0x45,0x01,0x80,0x09,0x45,0x04,0xa4,0x99,0x45,0x08,0xa1,0x09,0x45,0x18,0x27,
+0x09,0x45,0x71,0x07,0xb8,0x05,0xf0,0x06,0x00,0x10,0x04,0x42,0x00,0xa0,0x09,0x64,
+0x01,0xb1,0x89,0x54,0x07,0xa4,0x09,0x54,0x38,0x09,0x19,0x54,0x30,0xc1,0x06,0xb1,
+0x79,0x99,0xb1,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x82,0x77,0x01,0xf1,0x0c,0x40,
+0x06,0x52,0x00,0xa0,0x09,0x63,0x01,0xb2,0x99,0x62,0x07,0xb3,0x09,0x62,0x39,0x0a,
+0x19,0x62,0x30,0x00,0x09,0x62,0x00,0x90,0x04,0x51,0x0c,0x03,0xf1,0x14,0xb8,0x88,
+0x91,0x00,0x01,0x10,0x00,0x00,0x30,0x04,0x32,0x00,0xa0,0x09,0x54,0x01,0xc2,0x99,
+0x54,0x08,0x86,0x09,0x54,0x57,0x07,0x29,0x54,0x20,0x23,0x35,0x51,0x00,0x35,0x55,
+0xa2,0x54,0x00,0x00,0x92,0x03,0x51,0x59,0x99,0x93,0x00,0x20,0x28,0x00,0xf1,0x02,
+0x64,0x00,0xb2,0x99,0x54,0x06,0xb3,0x09,0x54,0x29,0x0a,0x19,0x54,0x40,0x00,0x14,
+0x53,0x34,0x07,0xf7,0x0e,0x02,0xc8,0x00,0x00,0x3a,0x04,0x90,0x00,0x40,0x00,0x11,
+0x00,0x50,0x00,0x60,0x0a,0x03,0x6a,0x00,0xc0,0x13,0xa0,0x69,0x84,0x8a,0x39,0x07,
+0x51,0xa4,0x31,0x01,0x12,0xc8,0x31,0x01,0x01,0xbf,0x0a,0xf1,0x02,0x50,0x00,0x00,
+0x0c,0x60,0x00,0x00,0x76,0xa4,0x00,0x07,0x60,0x08,0x50,0x01,0x07,0x20,0x73,0x05,
+0x00,0x03,0x06,0xff,0x03,0x00,0x05,0x10,0x00,0x00,0x0d,0x50,0x00,0x01,0xa3,0x86,
+0x00,0x07,0x25,0x15,0x30,0x12,0x29,0x03,0x06,0x03,0x01,0xa3,0x0a,0xb1,0x0b,0x30,
+0x00,0x00,0x77,0xa3,0x00,0x08,0x44,0x18,0x30,0x40,0x00,0x40,0x9a,0x99,0x94,0x04,
+0x4b,0x00,0x52,0x30,0x00,0x00,0x06,0xa8,0x15,0x0a,0x01,0x50,0x00,0x61,0x0c,0x50,
+0x00,0x01,0xa4,0x96,0x50,0x00,0xf0,0x08,0x34,0x4a,0x64,0x42,0x34,0x44,0x44,0x41,
+0x00,0x89,0x97,0x00,0x04,0x60,0x08,0x20,0x02,0x90,0x1a,0x10,0x00,0x38,0x72,0x35,
+0x01,0xf1,0x01,0x50,0x08,0x10,0x09,0x00,0xc1,0x00,0x90,0x58,0xa0,0x09,0x39,0x04,
+0x70,0x91,0x08,0x40,0x02,0x41,0x94,0x8a,0x98,0x19,0x32,0x02,0x00,0xcd,0x03,0x00,
+0x55,0x06,0xfc,0x01,0x0c,0x10,0x00,0x00,0x05,0x9a,0x00,0x00,0x06,0x80,0x3a,0x10,
+0x00,0x30,0x00,0x01,0xb5,0x0a,0x14,0x90,0xe4,0x00,0x00,0x78,0x00,0xa1,0x40,0x00,
+0x00,0x95,0xa4,0x00,0x08,0x30,0x07,0x30,0xfe,0x05,0xc8,0x9b,0xc9,0x94,0x06,0x24,
+0x50,0x00,0x07,0x21,0x10,0x00,0x07,0xa0,0x00,0x01,0xf0,0x00,0xfa,0x02,0x96,0x00,
+0x07,0x20,0x05,0x30,0x69,0x99,0x99,0x94,0x00,0x06,0x30,0x00,0x00,0x04,0x20,0x7b,
+0x06,0x01,0xa8,0x0b,0x00,0x8f,0x06,0x90,0x20,0x00,0x00,0x58,0xa1,0x00,0x06,0x80,
+0x1a,0x5b,0x04,0x11,0x20,0x58,0x00,0x00,0xab,0x06,0x20,0x00,0x70,0x64,0x0b,0xf2,
+0x0d,0x30,0x00,0x00,0x3b,0x29,0x60,0x00,0x06,0x00,0x04,0x10,0x08,0x88,0x88,0x88,
+0x10,0x02,0x33,0x33,0x00,0x00,0x46,0x55,0xc0,0x00,0x06,0x99,0x9b,0xa5,0x00,0x41,
+0x05,0x99,0x98,0x10,0x05,0x03,0xc0,0x2d,0x50,0x00,0x04,0xa0,0x77,0x00,0x05,0x00,
+0x03,0x10,0x79,0xa5,0x0b,0x00,0x1b,0x06,0x21,0x00,0x07,0x3d,0x04,0x00,0x3b,0x03,
+0x02,0x3c,0x04,0x01,0x55,0x00,0xf2,0x0b,0x20,0x00,0x00,0x2b,0x2a,0x30,0x00,0x08,
+0x10,0x06,0x10,0x06,0x55,0x55,0x56,0x10,0x33,0x33,0x33,0x30,0x00,0x08,0x89,0x40,
+0x00,0x07,0x3c,0x04,0x12,0xa0,0x3c,0x04,0x06,0x74,0x03,0xe2,0x0e,0x10,0x09,0x05,
+0x78,0x00,0x90,0xa0,0x91,0x0a,0x53,0x01,0x70,0xa0,0x19,0x01,0x03,0x74,0x03,0x11,
+0x50,0x74,0x03,0xc9,0x00,0xa0,0x5a,0x60,0x0a,0x39,0x07,0x40,0xa4,0x00,0x01,0x07,
+0x74,0x03,0x50,0x04,0x00,0x40,0x00,0x80,0x2e,0x03,0x73,0xd0,0x00,0xa0,0x49,0x80,
+0x0a,0x2a,0x74,0x03,0x37,0x80,0x00,0x50,0x74,0x03,0xf1,0x10,0x21,0x00,0x70,0x00,
+0x72,0x00,0xa0,0x00,0xc4,0x00,0xa0,0x06,0x59,0x20,0xa0,0x46,0x00,0x70,0x90,0x00,
+0x12,0x22,0x20,0x00,0x77,0x77,0xb0,0x00,0xaa,0xaa,0x90,0xb6,0x02,0x50,0x89,0x99,
+0x80,0x00,0x20,0xd3,0x01,0x01,0x6e,0x00,0xe0,0x4a,0x80,0x09,0x2a,0x05,0x60,0x93,
+0x00,0x01,0x04,0x00,0xc9,0x99,0x90,0x83,0x00,0x60,0xa0,0x00,0xa0,0x07,0x88,0x84,
+0x23,0x00,0x14,0x09,0x23,0x00,0x02,0xe2,0x03,0x24,0x01,0x08,0x9c,0x03,0x12,0xa2,
+0x9c,0x03,0x00,0xf7,0x01,0xfb,0x0a,0x90,0x90,0x09,0x00,0x0a,0x09,0x00,0x90,0x00,
+0xc0,0xb1,0x0a,0x00,0x1f,0x1d,0x50,0xd9,0x15,0x78,0x79,0x09,0x00,0xa0,0xd1,0x90,
+0x62,0x06,0x11,0x00,0x0b,0x00,0xe4,0x18,0x00,0x00,0xd0,0x59,0x00,0x05,0xa4,0xaa,
+0x10,0x1a,0x0a,0x71,0x80,0xf5,0x02,0x00,0xda,0x01,0x00,0xbe,0x0a,0x50,0x09,0x92,
+0x0a,0x00,0x82,0x1e,0x07,0xda,0x09,0x0a,0x10,0x90,0x09,0x0a,0x85,0x72,0x19,0x09,
+0x00,0x09,0x91,0x9a,0x0b,0x60,0x04,0x60,0x03,0x00,0x56,0x39,0x24,0x00,0x91,0x09,
+0x10,0x81,0x09,0x09,0x97,0x2a,0x95,0x09,0x73,0x06,0x1b,0x07,0x37,0x06,0x00,0x50,
+0x00,0x70,0x2a,0x95,0x0a,0x00,0x81,0x0a,0x09,0x2c,0x00,0xe0,0x95,0x65,0x19,0x09,
+0x00,0x06,0x81,0x09,0x00,0x06,0x10,0x06,0x00,0x09,0x58,0x09,0x12,0x98,0x9a,0x0b,
+0x71,0x05,0x71,0x08,0x00,0x65,0x29,0x0a,0x24,0x00,0x00,0xa2,0x0b,0xf1,0x0f,0x2a,
+0xa5,0x07,0x00,0x00,0x00,0x88,0x00,0x09,0x03,0x88,0x50,0x09,0x00,0x9a,0x10,0x0a,
+0x43,0x75,0x40,0x02,0x41,0x78,0x00,0x03,0x40,0x06,0x00,0x58,0x49,0x9c,0x00,0x70,
+0x96,0x73,0x09,0x09,0x00,0x08,0x93,0xc2,0x0b,0x51,0x44,0x00,0x03,0x65,0x5c,0x42,
+0x02,0x13,0x0a,0xc2,0x0b,0x33,0x04,0x60,0x04,0xa0,0x00,0x60,0x0a,0x00,0x81,0x09,
+0x0a,0x95,0x84,0x00,0x00,0x31,0x05,0x53,0x08,0x99,0x9c,0x00,0x0a,0x02,0x00,0x4f,
+0x03,0x88,0x87,0x00,0x28,0x00,0x03,0x30,0x02,0x00,0x09,0x3a,0x0c,0x15,0xa9,0x69,
+0x02,0x00,0x8a,0x03,0x31,0x00,0x56,0x29,0xc4,0x00,0x73,0x85,0x81,0x09,0x09,0x10,
+0x2a,0xa5,0xea,0x0b,0x21,0x99,0x95,0x65,0x02,0x80,0x05,0x60,0x1b,0x00,0x00,0x58,
+0x71,0x00,0xf4,0x5a,0x04,0x50,0x0a,0x00,0x56,0x37,0x0c,0x00,0x90,0x08,0x0c,0x97,
+0x81,0x08,0x0b,0x00,0x2b,0xa4,0x0b,0x00,0x00,0x00,0x04,0x00,0x07,0x99,0x98,0x00,
+0x00,0x70,0x70,0x00,0x00,0x90,0x91,0x00,0x08,0x99,0x88,0x20,0x02,0x20,0x40,0x44,
+0x66,0x3a,0x0a,0x90,0x07,0xa8,0xd8,0x11,0x79,0x0a,0x2b,0xa2,0x90,0xa0,0x00,0x02,
+0x03,0x00,0xa9,0x99,0xb0,0x0a,0x00,0x0a,0x00,0xa0,0x00,0xa0,0x05,0x88,0x86,0x00,
+0x00,0x06,0x00,0x09,0x92,0x0a,0x00,0x82,0x09,0x0a,0x95,0x90,0x09,0x0a,0x00,0x90,
+0x09,0x09,0x00,0x72,0x19,0x09,0x95,0x09,0x91,0x09,0x00,0x00,0x00,0x04,0x00,0xf1,
+0x34,0x02,0x00,0x04,0x60,0x08,0x00,0x56,0x39,0x09,0x95,0x90,0x09,0x09,0x10,0x81,
+0x09,0x09,0x62,0x2a,0x95,0x09,0x41,0x00,0x00,0x07,0x00,0x00,0x89,0x96,0x00,0x05,
+0x60,0x09,0x10,0x04,0x80,0x1b,0x00,0x00,0x48,0x72,0x00,0x00,0x00,0x00,0x50,0x38,
+0x80,0x09,0x0a,0x03,0x60,0x91,0x80,0x0a,0x5b,0x08,0x00,0x93,0xa0,0xa0,0x55,0x09,
+0x02,0x86,0x00,0x90,0x49,0x00,0x00,0x07,0x00,0xf0,0x12,0x00,0x03,0x61,0x00,0x53,
+0x83,0xa0,0x0a,0x81,0x08,0x34,0xa8,0x20,0x82,0x49,0x2a,0x69,0x00,0x90,0x02,0x00,
+0x09,0x00,0x70,0x00,0x80,0x0a,0x00,0x00,0x00,0xd8,0x88,0x60,0x70,0x00,0xf9,0x13,
+0x40,0x00,0x54,0x84,0x90,0x0a,0x81,0x09,0x29,0xa7,0x30,0xa0,0x0a,0x08,0x94,0x00,
+0x90,0x03,0x33,0x43,0x01,0x66,0x55,0xa0,0x2a,0x99,0x97,0x04,0x50,0x00,0x00,0x19,
+0x99,0x97,0x23,0x00,0x30,0x09,0x08,0x94,0x5b,0x00,0xf0,0x75,0x03,0x03,0x50,0x00,
+0x80,0x4c,0x99,0x99,0x03,0x50,0x00,0x90,0x18,0x88,0x83,0x02,0x40,0x01,0x50,0x48,
+0x49,0x03,0x80,0x81,0x09,0x3a,0x80,0x73,0x0a,0x03,0x80,0x08,0x94,0x03,0x80,0x00,
+0x00,0x02,0x20,0x07,0x21,0x69,0x00,0x07,0xaa,0x6c,0x30,0x07,0x21,0xb7,0xb1,0x03,
+0x88,0x60,0x12,0x03,0x40,0x01,0x40,0x48,0x4b,0x01,0x80,0x81,0x0c,0x4a,0x80,0x73,
+0x0d,0x01,0x80,0x19,0xa6,0x01,0x80,0x00,0x00,0x00,0x20,0x00,0xa0,0x09,0x00,0x00,
+0xd2,0x1d,0x00,0x08,0x4b,0x94,0xa0,0x03,0x01,0x20,0x10,0x00,0x00,0x05,0x15,0x05,
+0x74,0x09,0x26,0x09,0x09,0x09,0x36,0x09,0x09,0x7b,0x36,0x09,0x09,0x39,0x26,0x09,
+0x0b,0x09,0x26,0x02,0x83,0x09,0x26,0x00,0x00,0x09,0x27,0x00,0x00,0x07,0x27,0x00,
+0xbe,0x00,0xf1,0x1c,0x30,0x04,0x41,0x58,0x77,0x09,0x63,0x90,0x0d,0x8a,0x63,0x81,
+0x09,0x09,0x63,0x2a,0xa2,0x09,0x63,0x00,0x33,0x34,0x50,0x00,0x55,0x55,0xb1,0x00,
+0x99,0x99,0xb0,0x00,0xa0,0x00,0x00,0x00,0x79,0x99,0x92,0x00,0x00,0x00,0x60,0x2c,
+0x01,0xe8,0x89,0xc1,0x80,0x09,0x09,0x08,0x00,0x91,0x90,0xa0,0x57,0x8c,0x02,0x96,
+0x2c,0x01,0xf0,0x0f,0x04,0x60,0x00,0x64,0x73,0x93,0x9a,0x80,0x09,0x00,0xa7,0x20,
+0x93,0x7a,0x1a,0x95,0x01,0x90,0x00,0x00,0x05,0x03,0x99,0x99,0x70,0x00,0x00,0x0a,
+0x00,0x00,0x49,0x00,0xf5,0x11,0x03,0x00,0x00,0x00,0x82,0xa9,0x53,0x8a,0x81,0x09,
+0x00,0xa9,0x00,0x90,0x0a,0x65,0x29,0x5b,0x90,0x67,0x10,0x09,0x03,0x40,0x00,0x60,
+0x46,0x00,0x00,0x03,0xb8,0x89,0x4f,0x01,0x9f,0x93,0x9a,0x81,0x09,0x00,0x97,0x30,
+0xa4,0x9a,0x4f,0x01,0x03,0xf0,0x01,0x51,0x00,0x64,0x83,0xa3,0x9a,0x91,0x08,0x10,
+0xa8,0x20,0x95,0x9a,0x1b,0xa7,0x00,0x69,0x00,0xf2,0x0b,0x00,0x59,0x8a,0x10,0x0b,
+0x00,0x18,0x00,0xa2,0x06,0x60,0x01,0x78,0x50,0x00,0x00,0x05,0x25,0x05,0x74,0x09,
+0x36,0x09,0x0a,0x8b,0x36,0x03,0x01,0x93,0x2a,0x36,0x09,0x0a,0x6b,0x26,0x02,0x82,
+0x0a,0xff,0x00,0x34,0x08,0x27,0x00,0x01,0x00,0xe0,0x98,0x97,0x00,0x03,0x60,0x0a,
+0x00,0x03,0x70,0x09,0x00,0x00,0x99,0x96,0x42,0x02,0xf1,0x1e,0x00,0x00,0x07,0x20,
+0x00,0x79,0x9b,0xa9,0x94,0x00,0x38,0x71,0x00,0x02,0x91,0x1a,0x00,0x04,0x60,0x0a,
+0x00,0x00,0x7a,0x95,0x00,0x00,0x08,0x20,0x00,0x69,0x99,0x99,0x93,0x03,0x40,0x00,
+0x00,0x05,0x50,0x00,0x00,0x04,0xb8,0x89,0x40,0x44,0x00,0xf0,0x10,0x78,0x82,0x00,
+0x06,0x50,0x0a,0x00,0x04,0x83,0x4a,0x00,0x00,0x3c,0x50,0x00,0x78,0x8b,0x88,0x92,
+0x02,0x44,0x44,0x00,0x03,0x55,0x5a,0x20,0x07,0x99,0x9b,0x10,0xf4,0x02,0xf1,0x04,
+0x05,0x99,0x99,0x30,0x00,0x38,0x72,0x00,0x03,0x80,0x1a,0x00,0x04,0x70,0x0b,0x00,
+0x00,0x6b,0x93,0x68,0x00,0x00,0x50,0x00,0xf0,0x01,0x05,0x10,0x03,0x20,0x07,0xa9,
+0x9b,0x40,0x07,0x20,0x06,0x40,0x03,0x89,0x98,0x10,0x9b,0x02,0xf3,0x11,0x00,0x69,
+0x92,0x09,0x00,0x0a,0x01,0x80,0x90,0x00,0xa0,0x18,0x09,0x00,0x06,0x99,0x10,0xc9,
+0x10,0x02,0x20,0x09,0x00,0x00,0x54,0x00,0x90,0x04,0x89,0x98,0x29,0x00,0x77,0x01,
+0x90,0x01,0x00,0x01,0x86,0x00,0x70,0x00,0xa1,0x46,0x29,0x03,0xf0,0x07,0x80,0xa0,
+0x00,0x79,0xa3,0x0d,0x90,0x00,0x72,0x00,0xa0,0x04,0x89,0x98,0x1a,0x00,0x01,0x40,
+0x00,0x60,0x00,0x37,0x57,0x01,0x30,0xc9,0x99,0x60,0x32,0x00,0x40,0x30,0x69,0x92,
+0x09,0x54,0x00,0xf2,0x02,0xa0,0x18,0x09,0x06,0x99,0x10,0x90,0x03,0x10,0x09,0x00,
+0x63,0x00,0x93,0x8a,0x99,0x39,0x4e,0x00,0x10,0x02,0x4c,0x00,0xf0,0x02,0xa1,0x46,
+0x0a,0x09,0x00,0x80,0xa0,0x79,0xa3,0x0a,0x00,0x72,0x00,0xa5,0x89,0x98,0x1a,0x46,
+0x00,0x11,0x37,0x44,0x00,0x11,0x50,0xed,0x00,0x21,0x99,0x97,0x11,0x01,0x23,0x03,
+0x60,0x31,0x01,0xd0,0x30,0x12,0x00,0x00,0xa0,0x46,0x00,0x79,0xd9,0xab,0x94,0x00,
+0x06,0xa7,0x03,0xf1,0x33,0x50,0x47,0x00,0x00,0x73,0x02,0x80,0x00,0x00,0xd9,0xd1,
+0x00,0x02,0x29,0x2a,0x22,0x00,0x67,0x77,0x77,0x60,0x00,0x07,0x98,0x10,0x00,0x08,
+0x30,0x29,0x00,0x00,0x83,0x02,0x90,0x00,0x00,0x78,0x70,0x00,0x00,0x05,0x87,0x10,
+0x00,0x06,0x60,0x29,0x00,0x00,0x91,0x00,0xa0,0x00,0x04,0x94,0x68,0x00,0x00,0x01,
+0x43,0x00,0x00,0x88,0x88,0x99,0x92,0x30,0x02,0x01,0x38,0x02,0x23,0x00,0xa0,0xa7,
+0x01,0x00,0x8b,0x01,0x22,0x90,0x2a,0x8b,0x01,0x21,0x89,0x96,0x13,0x00,0xe6,0x69,
+0x9b,0xc9,0x94,0x05,0x33,0x60,0x00,0x06,0x41,0x20,0x00,0x06,0xa8,0x8b,0x01,0x11,
+0x05,0x8b,0x01,0xc6,0x49,0x00,0x00,0x35,0x40,0x00,0x89,0x8b,0x88,0x82,0x03,0x4b,
+0x8b,0x01,0x14,0x0a,0x8b,0x01,0xf1,0x07,0x04,0x87,0x10,0x00,0x04,0x70,0x1a,0x00,
+0x00,0x55,0x01,0xa0,0x00,0x00,0x68,0x81,0x00,0x09,0x99,0x99,0x99,0x20,0x74,0x00,
+0x50,0x69,0xc9,0xa1,0x00,0x0a,0x9c,0x01,0xf0,0x02,0xa0,0x00,0x72,0x00,0x04,0x89,
+0x87,0x00,0x00,0x48,0x82,0x00,0x02,0x90,0x0a,0x00,0x03,0xf9,0x03,0x20,0x69,0x83,
+0xb4,0x01,0xf0,0x08,0x94,0x00,0x06,0x30,0x00,0x00,0x04,0x20,0x00,0x00,0x0c,0x90,
+0x00,0x02,0xa2,0x4a,0x10,0x04,0x00,0x01,0x30,0x01,0x76,0x3f,0x01,0xf1,0x14,0x09,
+0x09,0x00,0x90,0x90,0xa1,0x46,0x09,0x01,0x75,0x00,0x93,0x77,0x78,0x49,0x02,0x84,
+0x00,0x90,0x06,0x36,0x9a,0x00,0x63,0x00,0x90,0x01,0x00,0x03,0x00,0x54,0x00,0x60,
+0xa3,0x66,0x85,0x01,0xf0,0x4c,0x69,0x92,0x09,0x57,0x77,0x72,0x90,0x0a,0x07,0x9a,
+0x00,0x50,0x00,0x90,0x28,0x00,0x01,0x01,0xd9,0x99,0x70,0x02,0x87,0x00,0x60,0xa0,
+0x37,0x0a,0x0a,0x56,0x60,0xa0,0x04,0x42,0x1a,0x69,0xd8,0x72,0xa0,0x08,0x05,0x69,
+0x00,0x99,0x99,0x70,0x05,0x56,0x6a,0x01,0xb3,0x34,0x10,0x09,0x99,0x97,0x03,0x61,
+0x13,0x60,0x39,0x29,0x26,0x90,0x63,0x07,0x26,0x90,0x38,0x28,0x26,0x90,0x04,0x61,
+0x26,0x90,0x69,0x99,0x56,0x90,0x00,0x91,0x56,0x90,0x00,0x92,0x76,0x90,0x00,0x90,
+0x26,0x1a,0x02,0x11,0x10,0x8e,0x00,0xf1,0x0a,0x56,0x09,0x09,0x00,0x80,0x90,0xa2,
+0x65,0x09,0x01,0x64,0x00,0x93,0x88,0x89,0x49,0x00,0x73,0x00,0x90,0x06,0x30,0x09,
+0x00,0x52,0x3e,0x02,0xf5,0x02,0x00,0x05,0x88,0x20,0x00,0x06,0x60,0x1a,0x00,0x00,
+0x81,0x00,0x90,0x00,0x04,0x94,0x59,0x83,0x01,0x30,0x94,0x00,0x0a,0x22,0x00,0x00,
+0x58,0x04,0x01,0x09,0x00,0x00,0x01,0x00,0xf3,0x10,0x68,0x84,0x00,0x05,0x60,0x0a,
+0x00,0x04,0x93,0x3b,0x00,0x00,0x25,0x51,0x00,0x78,0xb8,0x9b,0x84,0x02,0xc4,0x5b,
+0x10,0x03,0x55,0x57,0x60,0x07,0x99,0x9a,0x40,0x5b,0x01,0x12,0x50,0x56,0x03,0x11,
+0x95,0x87,0x01,0x00,0x04,0x00,0x35,0x00,0xa8,0x95,0x6d,0x03,0x10,0x79,0x3a,0x01,
+0xe1,0x58,0x70,0x00,0x04,0x70,0x29,0x00,0x07,0x30,0x0a,0x00,0x01,0x99,0x94,0x18,
+0x00,0x53,0x89,0x99,0x99,0x92,0x07,0xf3,0x01,0x42,0x0a,0x98,0x89,0x10,0x70,0x00,
+0x12,0x82,0x70,0x00,0xb0,0x82,0x3a,0x00,0x00,0x36,0x50,0x00,0x78,0x88,0x88,0x82,
+0x56,0x03,0x85,0x02,0x54,0x49,0x30,0x06,0x99,0x9b,0x20,0xcb,0x01,0x21,0x48,0x72,
+0x9a,0x01,0x00,0x5a,0x03,0xf9,0x0d,0x00,0x47,0x61,0x00,0x68,0x88,0x88,0x83,0x01,
+0x10,0x00,0x00,0x04,0x99,0x9a,0x20,0x08,0x20,0x05,0x50,0x08,0x30,0x05,0x40,0x03,
+0x89,0x88,0x10,0x7e,0x03,0xb2,0x68,0x83,0x00,0x46,0x66,0x66,0x62,0x23,0x33,0x33,
+0x31,0x19,0x06,0x63,0x08,0x10,0x03,0x80,0x1a,0x10,0x19,0x06,0x35,0x30,0x69,0xa2,
+0x28,0x03,0x22,0x9a,0x10,0xe6,0x04,0x52,0x21,0x94,0x88,0x86,0x29,0x28,0x03,0x10,
+0x03,0x72,0x04,0xf0,0x17,0x89,0x20,0x81,0x64,0x0a,0x08,0x09,0x00,0xa0,0x80,0x90,
+0x09,0x08,0x06,0x40,0xa0,0x80,0x08,0x92,0x08,0x00,0x00,0x00,0x80,0x00,0x00,0x08,
+0x10,0x00,0x00,0x10,0x04,0x61,0x00,0x64,0x72,0x90,0x09,0xca,0x04,0x62,0x20,0x90,
+0x09,0x1a,0x96,0x00,0x10,0x05,0x00,0x1f,0x01,0x50,0x18,0x00,0x00,0x01,0x80,0x04,
+0x06,0x40,0x60,0x00,0x54,0x83,0x19,0x06,0x70,0x00,0x98,0x20,0x90,0x09,0x2a,0x77,
+0x21,0x02,0x50,0x09,0x02,0x50,0x00,0x80,0x6e,0x03,0x17,0xc8,0x5f,0x06,0x01,0x46,
+0x00,0x02,0x3c,0x06,0xf1,0x03,0x80,0x13,0x34,0x43,0x02,0x66,0x56,0x80,0x3a,0x99,
+0xa6,0x06,0x40,0x00,0x00,0x29,0x99,0x96,0x23,0x00,0xf0,0x06,0xb0,0x09,0x81,0x0a,
+0x10,0x97,0x30,0xb0,0x09,0x08,0x95,0x00,0x90,0x23,0x22,0x33,0x04,0x5a,0x25,0x90,
+0x79,0x26,0x07,0x5f,0x00,0x90,0x69,0x80,0x03,0x8c,0x00,0x01,0xc1,0x04,0x04,0xb9,
+0x9a,0x70,0x55,0x00,0x18,0x05,0x50,0x02,0x80,0x82,0x06,0xf0,0x24,0x04,0x14,0x84,
+0x90,0x82,0x81,0x09,0x08,0x27,0x30,0xa0,0x72,0x08,0x94,0x07,0x20,0x00,0x00,0x20,
+0x05,0x40,0x07,0x10,0x5b,0x99,0xd1,0x05,0x40,0x08,0x10,0x28,0x88,0x80,0x03,0x40,
+0x02,0x30,0x58,0x48,0x04,0x50,0x90,0x0a,0x04,0x50,0x82,0x0a,0x04,0x50,0x1a,0x94,
+0x92,0x05,0x22,0x01,0x10,0x7d,0x06,0xa1,0x4b,0x00,0x07,0x3a,0x94,0x90,0x03,0x02,
+0x10,0x20,0x8f,0x05,0xf7,0x09,0xa9,0x0a,0x00,0x00,0x45,0x0a,0x00,0x00,0xa0,0x0a,
+0x00,0x02,0xe0,0x09,0x96,0x09,0x48,0x09,0x00,0x55,0x09,0x19,0x00,0x20,0xa9,0x07,
+0xf0,0x03,0x35,0x63,0x07,0x00,0x13,0x67,0x09,0x00,0x00,0xb0,0x09,0x75,0x08,0xb3,
+0x09,0x32,0x67,0x0a,0x20,0x00,0x54,0x05,0x00,0x07,0x99,0x9c,0x0a,0x02,0x12,0x00,
+0x8f,0x05,0x30,0x08,0x00,0x58,0x50,0x00,0xf1,0x03,0x92,0x0a,0x00,0x05,0xd1,0x0a,
+0x95,0x48,0x2a,0x09,0x00,0x60,0x03,0x19,0x00,0x08,0x00,0x06,0x22,0x00,0xf3,0x19,
+0x09,0x88,0x88,0x00,0x00,0x11,0x10,0x00,0x48,0x95,0x07,0x00,0x00,0x55,0x0a,0x00,
+0x01,0xc0,0x0a,0x96,0x0a,0x86,0x09,0x00,0x81,0x07,0x19,0x00,0x02,0x33,0x45,0x00,
+0x03,0x65,0x5c,0x00,0x06,0x99,0x9b,0x00,0x30,0x02,0x00,0x5c,0x02,0xf0,0x0f,0x40,
+0x01,0x98,0xd1,0x0a,0x00,0x00,0x2a,0x00,0xa0,0x00,0x0b,0x60,0x0d,0x92,0x08,0x39,
+0x30,0x90,0x03,0x30,0x04,0x08,0x00,0x00,0x39,0x89,0x20,0x00,0x0b,0x2a,0x00,0x70,
+0xb2,0x03,0xa0,0x00,0x01,0x78,0x60,0xd9,0x06,0xf0,0x12,0x14,0x19,0xa8,0x09,0x36,
+0x00,0x54,0x09,0x36,0x00,0xa0,0x0b,0x76,0x02,0xe0,0x0a,0x56,0x09,0x47,0x09,0x36,
+0x37,0x09,0x09,0x36,0x10,0x01,0x09,0x36,0x00,0x00,0x09,0x26,0x87,0x05,0xf0,0x18,
+0x01,0x11,0x04,0x34,0x17,0x7a,0x0a,0x46,0x00,0x83,0x0c,0x86,0x03,0xc6,0x0b,0x66,
+0x1a,0x08,0x2a,0x46,0x21,0x00,0x14,0x22,0x00,0x59,0x99,0xb3,0x00,0x00,0x00,0x64,
+0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x7d,0x00,0x40,0x42,0x98,0xd0,0x09,0x55,0x03,
+0xf4,0x01,0x04,0x54,0x59,0x00,0xb7,0x23,0x90,0x46,0xa0,0x09,0x19,0x04,0x60,0x91,
+0x10,0x01,0x4a,0x07,0xf5,0x0a,0x16,0x66,0x00,0x70,0x22,0xb0,0x0a,0x00,0x65,0x36,
+0xa0,0x3c,0x71,0x3a,0x29,0x08,0x40,0xa3,0x00,0x01,0x05,0x02,0x99,0x99,0x80,0x4a,
+0x07,0xfb,0x06,0x01,0x01,0x22,0x00,0x51,0x66,0xd0,0x0a,0x00,0x47,0x02,0xa0,0x1d,
+0x43,0x79,0x0a,0x2a,0x10,0x95,0x20,0x14,0x99,0x08,0xf1,0x13,0x07,0x88,0x10,0x60,
+0x00,0x0b,0x10,0xa0,0x00,0x49,0x39,0xc0,0x02,0xab,0x10,0xa0,0x2a,0x01,0x80,0xa0,
+0x00,0x45,0x55,0x50,0x00,0x44,0x44,0xa0,0x00,0xba,0xaa,0x80,0x00,0xa0,0x77,0x03,
+0x00,0x3f,0x08,0xf0,0x00,0x31,0x99,0xd0,0x0a,0x00,0x37,0x48,0xa0,0x2a,0x90,0x09,
+0x2a,0x04,0x60,0x91,0xe0,0x02,0x32,0xb9,0x99,0x80,0x7a,0x09,0xf1,0x06,0x90,0x07,
+0x88,0x84,0x00,0x00,0x00,0x71,0x89,0xd1,0x0a,0x00,0x37,0x59,0xa0,0x2a,0xa0,0x09,
+0x2a,0x04,0x70,0x23,0x00,0xd4,0x90,0x00,0x80,0x0d,0xa9,0x9a,0x00,0x90,0x00,0x90,
+0x08,0x88,0x84,0x46,0x00,0xa0,0x36,0x49,0xa0,0x2b,0x80,0x0a,0x2a,0x16,0x50,0xa3,
+0xb6,0x01,0xf2,0x22,0x39,0x89,0x10,0x0b,0x00,0x28,0x00,0xb2,0x05,0x70,0x01,0x78,
+0x50,0x01,0x20,0x05,0x42,0x07,0x97,0x09,0x63,0x00,0x64,0x09,0x63,0x00,0xb3,0x99,
+0x63,0x02,0xe2,0x09,0x63,0x0a,0x38,0x09,0x63,0x37,0x08,0x19,0x63,0x00,0x00,0x09,
+0x63,0x00,0x00,0x07,0x63,0x25,0x04,0xf1,0x13,0x03,0x31,0x38,0xa8,0x09,0x63,0x00,
+0xa3,0x89,0x63,0x07,0x96,0x09,0x63,0x57,0x08,0x29,0x63,0x10,0x00,0x22,0x42,0x00,
+0x00,0xb0,0x00,0x00,0x05,0xaa,0x00,0x00,0x78,0x02,0xa1,0x48,0x01,0x01,0x4a,0x01,
+0xf1,0x05,0x08,0x00,0x0a,0x47,0x80,0x05,0x50,0x28,0x00,0xc6,0x13,0x90,0x55,0xa3,
+0x69,0x19,0x05,0x50,0x91,0x00,0x4a,0x01,0x10,0x80,0x3c,0x02,0xf0,0x04,0x88,0xaa,
+0x00,0x00,0x01,0xb2,0x00,0x00,0x2b,0xb1,0x00,0x06,0x91,0x2a,0x30,0x01,0x05,0x20,
+0x10,0xb8,0x05,0x50,0x79,0x9a,0xa9,0x94,0x02,0x36,0x02,0xf0,0x05,0x02,0xb4,0x00,
+0x00,0x7a,0xb5,0x00,0x06,0x34,0x15,0x40,0x23,0x39,0x53,0x31,0x46,0x55,0x66,0x62,
+0x05,0x06,0x06,0x01,0xde,0x07,0x00,0x04,0x00,0x31,0x02,0x10,0x00,0x48,0x00,0xa3,
+0xcb,0x00,0x00,0x29,0xd1,0x00,0x07,0x73,0x28,0x40,0xb4,0x07,0x10,0x94,0xfb,0x05,
+0x36,0x07,0x30,0x00,0x79,0x06,0x10,0x48,0xc1,0x08,0xf0,0x0c,0x03,0xb2,0x00,0x00,
+0x19,0xab,0x30,0x00,0x07,0x26,0x06,0x20,0x03,0x33,0xb3,0x33,0x00,0x55,0x55,0x56,
+0x61,0x00,0x19,0x89,0x40,0x00,0x08,0xb0,0x04,0x81,0x75,0x02,0xa0,0x00,0x00,0x58,
+0x71,0x00,0xe1,0x07,0xf0,0x07,0x99,0xd1,0x09,0x00,0x00,0x38,0x00,0x90,0x00,0x1b,
+0x90,0x09,0x00,0x1a,0x16,0x50,0xd9,0x11,0x07,0x01,0x09,0x00,0x74,0x01,0x28,0x04,
+0x8a,0xe1,0x07,0x01,0x13,0x01,0x00,0xca,0x00,0xb5,0x04,0xb0,0x00,0x01,0x97,0x89,
+0x00,0x06,0x10,0x02,0x30,0x82,0x06,0x04,0x04,0x00,0x03,0x01,0x00,0x01,0xaa,0x00,
+0x71,0x19,0xd1,0x00,0x07,0x82,0x39,0x40,0x23,0x07,0xc3,0x9a,0xb9,0x94,0x06,0x23,
+0x60,0x00,0x07,0x20,0x10,0x00,0x07,0xaa,0x00,0x04,0xfa,0x00,0x72,0x01,0x89,0xb6,
+0x00,0x06,0x20,0x03,0x4c,0x00,0x00,0xcb,0x00,0x20,0x79,0x96,0x3d,0x0b,0x32,0x20,
+0x02,0x90,0x08,0x05,0x04,0x28,0x00,0x80,0x02,0x98,0xa7,0x00,0x05,0x10,0x02,0x30,
+0x58,0x05,0x00,0xf0,0x03,0x0c,0x22,0x01,0x10,0x04,0x9c,0x0b,0xf2,0x06,0x05,0xa2,
+0x00,0x06,0xa6,0x97,0x10,0x12,0x00,0x01,0x10,0x89,0x99,0x99,0x90,0x03,0x33,0x44,
+0x00,0x04,0x55,0x78,0x03,0x14,0x0b,0x78,0x03,0x01,0x22,0x01,0xfd,0x06,0x04,0xb2,
+0x00,0x00,0x29,0x9b,0x40,0x00,0x06,0x10,0x05,0x20,0x07,0x77,0x77,0x77,0x10,0x22,
+0x11,0x22,0x20,0x22,0x01,0x00,0xf8,0x00,0x31,0x51,0x88,0xd0,0x84,0x02,0x00,0xf3,
+0x07,0xa5,0xb7,0x00,0xa0,0x55,0xa0,0x0a,0x19,0x02,0x80,0xa0,0x05,0x03,0xff,0x08,
+0x00,0x06,0x67,0x00,0x80,0x22,0xc0,0x0a,0x00,0x57,0x00,0xa0,0x2b,0xa0,0x0a,0x2a,
+0x03,0x70,0xa1,0x00,0x00,0x05,0x01,0x28,0x03,0x03,0xb7,0x00,0xa0,0x1c,0x70,0x09,
+0x1a,0x18,0x30,0x93,0x10,0x02,0x28,0x03,0x12,0x70,0x35,0x01,0xf6,0x03,0x31,0x99,
+0xd1,0x0a,0x00,0x29,0x00,0xa0,0x1b,0x80,0x0a,0x1a,0x26,0x50,0xa2,0x10,0x02,0x06,
+0x00,0x03,0x12,0xa0,0x00,0x03,0x16,0x41,0x23,0x00,0x76,0x0a,0x27,0x50,0xa3,0x10,
+0x02,0x04,0x00,0x03,0x12,0xa0,0x00,0x03,0x40,0x50,0x04,0xa8,0x9b,0xf1,0x06,0xf4,
+0x09,0x90,0xa0,0x00,0x81,0x36,0x0a,0x00,0x0c,0x28,0x70,0xd9,0x12,0xa8,0xaa,0x09,
+0x00,0x82,0xa6,0x63,0x90,0x02,0x01,0x00,0x19,0xcd,0x08,0x10,0x02,0x54,0x04,0xf1,
+0x12,0x41,0x4c,0x7c,0x19,0x72,0x09,0x19,0x09,0x72,0x0a,0x09,0x0b,0xa2,0x0e,0x0e,
+0x0b,0x92,0x4a,0x8a,0x49,0x72,0x81,0xd1,0x89,0x72,0x10,0x10,0x19,0x72,0x00,0x00,
+0x09,0x72,0xc1,0x07,0xf0,0x0d,0x01,0x04,0x51,0x3b,0x6c,0x09,0x73,0x09,0x0a,0x0b,
+0xa3,0x0e,0x3d,0x1a,0x73,0x74,0xd2,0x79,0x73,0x20,0x10,0x03,0x31,0x00,0x79,0x99,
+0xb0,0x00,0x36,0x09,0x02,0x22,0x02,0xf0,0x02,0x10,0x06,0x84,0x88,0x10,0x00,0x83,
+0x0b,0x00,0x03,0xd3,0x9a,0x00,0x08,0x0b,0x52,0x50,0x81,0x06,0x00,0xd5,0x01,0x1e,
+0x05,0xcb,0x02,0xf5,0x04,0x53,0xb7,0xa6,0x0a,0x09,0x17,0x30,0xa0,0xd4,0xb6,0x0a,
+0x63,0xc4,0x90,0xa3,0x01,0x01,0x06,0x01,0xa3,0x0b,0x00,0xd9,0x06,0xf6,0x0f,0x04,
+0x30,0x04,0x00,0x04,0x51,0x0a,0x00,0x69,0x9b,0x0a,0x00,0x00,0x56,0x0a,0x00,0x00,
+0xc0,0x09,0x96,0x09,0x95,0x09,0x00,0x66,0x0a,0x09,0x00,0x30,0x01,0xbc,0x05,0xf1,
+0x0a,0x18,0x80,0x04,0x00,0x36,0x64,0x0a,0x00,0x23,0x77,0x0a,0x00,0x01,0xd0,0x0a,
+0x95,0x2b,0x49,0x0a,0x00,0x60,0x02,0x15,0x00,0x07,0x68,0x05,0x02,0x02,0x00,0xf0,
+0x69,0x04,0x88,0x87,0x00,0x08,0x82,0x04,0x30,0x48,0x88,0x06,0x40,0x00,0x57,0x05,
+0xb7,0x03,0xd4,0x05,0x40,0x49,0x08,0x35,0x40,0x20,0x10,0x03,0x10,0x00,0xa0,0x19,
+0x00,0x01,0xe2,0x6c,0x00,0x09,0x2a,0x92,0xa0,0x01,0x01,0x00,0x00,0x08,0x82,0x05,
+0x20,0x38,0x87,0x06,0x30,0x00,0x38,0x06,0xb7,0x02,0xd4,0x06,0x30,0x3a,0x19,0x36,
+0x30,0x30,0x00,0x02,0x10,0x03,0x99,0x9d,0x00,0x00,0x02,0xb3,0x00,0x01,0x89,0x98,
+0x10,0x04,0x10,0x02,0x40,0x05,0x50,0x04,0x32,0x03,0x52,0x09,0x54,0x16,0x78,0x09,
+0x44,0x00,0x64,0x0b,0x84,0x00,0xd0,0x0a,0x74,0x06,0x96,0x09,0x44,0x29,0x09,0x09,
+0x44,0x20,0x02,0x09,0x44,0x00,0x00,0x09,0x44,0x35,0x03,0xf0,0x03,0x07,0x83,0x00,
+0x52,0x77,0x70,0x09,0x01,0x2c,0x00,0x90,0x0b,0x64,0x99,0x1a,0x29,0x30,0x94,0xf9,
+0x01,0xfa,0x13,0x01,0x90,0x20,0x00,0x9b,0x20,0x00,0x95,0x0a,0x40,0x22,0x00,0x04,
+0x06,0x83,0x00,0x51,0x67,0x70,0x0a,0x02,0x2c,0x00,0xa0,0x0b,0x64,0x9a,0x1a,0x39,
+0x20,0xa4,0x10,0x03,0x09,0xb3,0x04,0xf1,0x15,0x05,0x82,0x05,0x43,0x05,0x53,0x09,
+0x54,0x04,0x58,0x09,0x54,0x00,0x65,0x29,0x54,0x00,0xd4,0x69,0x54,0x07,0x78,0x09,
+0x54,0x39,0x08,0x19,0x54,0x10,0x00,0x09,0x54,0x00,0x00,0x08,0x54,0x42,0x02,0xa1,
+0x55,0x40,0x00,0x00,0x13,0x30,0x00,0x04,0x99,0xc8,0xa6,0x03,0x84,0x00,0x78,0xa5,
+0x00,0x08,0x23,0x15,0x30,0x48,0x0c,0x50,0x06,0x83,0x00,0x71,0x99,0xe5,0x03,0xf3,
+0x04,0x00,0x90,0x0b,0x70,0x09,0x0a,0x28,0x40,0x92,0x16,0x02,0x09,0x00,0xa0,0x00,
+0x94,0x8a,0x98,0x19,0x7a,0x0b,0x02,0x43,0x04,0xf2,0x0a,0x70,0x00,0x03,0x99,0x97,
+0x00,0x00,0x01,0xa3,0x00,0x01,0x79,0xb5,0x00,0x07,0x20,0x04,0x40,0x68,0x88,0x88,
+0x84,0x01,0x19,0x20,0x55,0x08,0x12,0x08,0xf7,0x04,0x02,0x10,0x0b,0xf3,0x0b,0x70,
+0x00,0x03,0x98,0x9b,0x00,0x00,0x06,0xc2,0x00,0x07,0x94,0x6a,0x30,0x35,0x44,0x44,
+0x51,0x34,0x59,0x74,0x41,0x04,0x9b,0xa9,0x30,0x9d,0x0c,0x01,0x9d,0x07,0x00,0x28,
+0x00,0xb0,0x02,0x88,0x9a,0x00,0x00,0x03,0xb4,0x00,0x04,0x97,0x98,0xa7,0x0a,0x10,
+0x20,0x15,0x04,0x2a,0x04,0x13,0x15,0x04,0x01,0x01,0x00,0xf0,0x04,0x58,0x50,0x00,
+0x04,0x98,0xa7,0x00,0x00,0x29,0xc0,0x00,0x08,0x71,0x58,0x20,0x78,0x88,0x88,0x80,
+0x1a,0x02,0xf0,0x01,0x06,0x9a,0x9d,0x00,0x04,0x88,0x8d,0x00,0x0b,0x21,0x11,0x00,
+0x05,0x99,0x99,0x10,0x10,0x00,0x01,0x00,0xf9,0x3b,0x38,0x70,0x00,0x03,0x98,0x9b,
+0x00,0x00,0x04,0xc3,0x00,0x05,0xa7,0x89,0x20,0x03,0x00,0x01,0x20,0x68,0x8b,0xa8,
+0x83,0x00,0x2a,0x81,0x00,0x03,0x91,0x2a,0x10,0x04,0x80,0x1a,0x10,0x00,0x48,0x72,
+0x00,0x04,0x85,0x00,0x60,0x88,0x82,0x09,0x00,0x2b,0x00,0x90,0x59,0xa3,0x09,0x25,
+0x00,0x40,0x95,0x99,0x88,0x29,0x00,0xa0,0x00,0x90,0x0a,0x00,0x09,0x00,0x90,0x00,
+0x90,0x00,0x00,0x01,0x4f,0x00,0xf2,0x08,0x06,0xc2,0x00,0x07,0x95,0x6a,0x30,0x13,
+0x22,0x22,0x30,0x57,0x66,0x67,0x62,0x05,0x99,0x99,0x20,0x00,0x00,0x05,0x50,0x04,
+0x00,0xf0,0x11,0x01,0x10,0x04,0x54,0x00,0x50,0x25,0x50,0x09,0x17,0x7b,0x30,0x90,
+0x00,0xb0,0x09,0x00,0x67,0x00,0x90,0x3a,0xa0,0x09,0x1a,0x03,0x80,0x91,0x10,0x02,
+0x09,0x00,0x00,0x4f,0x00,0xf0,0x14,0x00,0x06,0x83,0x00,0x62,0x88,0x90,0x0a,0x00,
+0x1b,0x00,0xa0,0x0c,0x70,0x0a,0x2a,0x29,0x30,0xa3,0x00,0x02,0x09,0x00,0x39,0x89,
+0x10,0x0b,0x00,0x28,0x00,0xb2,0x05,0x70,0x01,0x78,0x4e,0x00,0xf1,0x0f,0x00,0x58,
+0x8d,0x09,0x10,0x00,0x0a,0x08,0x10,0x69,0xa7,0x08,0x10,0x00,0xa0,0x08,0xa6,0x06,
+0x50,0x08,0x10,0x48,0x00,0x08,0x10,0x30,0x00,0x08,0x10,0x00,0x04,0x00,0xf0,0x14,
+0x02,0x00,0x00,0x00,0x04,0x05,0x19,0x9d,0x19,0x09,0x00,0x0a,0x09,0x09,0x29,0x99,
+0x0a,0x49,0x00,0x73,0x0b,0x59,0x01,0x90,0x09,0x09,0x0a,0x10,0x09,0x09,0x22,0x00,
+0x09,0x09,0x00,0x04,0x00,0x00,0xc2,0x00,0xf2,0x0c,0x01,0x00,0x61,0x88,0xa6,0x09,
+0x00,0x07,0x20,0xa2,0x89,0xb3,0x4a,0x00,0x74,0x34,0xa0,0x29,0x00,0x0a,0x1a,0x00,
+0x00,0xa0,0x00,0x00,0x0a,0x96,0x00,0x00,0x01,0x00,0xf0,0x07,0x41,0x88,0xc2,0x09,
+0x14,0x4b,0x00,0x91,0x38,0x86,0x99,0x03,0xa0,0x00,0x93,0x70,0x00,0x09,0x00,0x80,
+0x00,0x60,0x21,0x00,0x32,0xd8,0x89,0x60,0x23,0x00,0xf0,0x21,0x52,0x88,0xc3,0x0a,
+0x37,0x9d,0x69,0xb0,0x1c,0x30,0x0a,0x3a,0x20,0x00,0xa0,0x03,0x33,0x43,0x00,0x55,
+0x55,0xa0,0x09,0x99,0x98,0x00,0xb0,0x00,0x00,0x08,0x99,0x98,0x00,0x00,0x00,0x81,
+0x88,0xc1,0x0a,0x28,0x8b,0x59,0xa0,0x0a,0x30,0x0a,0x2a,0x30,0x62,0x00,0x80,0x04,
+0x00,0xc9,0x99,0x90,0x0a,0x00,0x0a,0x55,0x01,0xf5,0x3f,0x07,0x88,0x84,0x00,0x00,
+0x00,0x32,0x88,0xd1,0x09,0x15,0x5b,0x00,0x90,0x39,0x55,0x99,0x05,0x70,0x00,0x94,
+0x50,0x02,0x09,0x00,0x02,0x80,0x40,0x00,0x9b,0x20,0x00,0x94,0x1a,0x30,0x22,0x00,
+0x04,0x01,0x11,0x05,0x61,0x28,0x8b,0x09,0x72,0x00,0x19,0x09,0x72,0x49,0xb6,0x69,
+0x72,0x00,0xa1,0x29,0x72,0x05,0x50,0x09,0x72,0x29,0x00,0x09,0x72,0x30,0x00,0x09,
+0x72,0x00,0x00,0x08,0x72,0x00,0x00,0x00,0x10,0xd7,0x00,0xd1,0x67,0xa2,0x89,0xb0,
+0x1a,0x00,0x74,0x11,0x90,0x29,0x07,0x8a,0x1a,0xd0,0x00,0x16,0x09,0xd7,0x00,0xfa,
+0x03,0x31,0x88,0xc2,0x0a,0x25,0x5a,0x48,0xa0,0x09,0x46,0x9a,0x19,0x50,0x00,0xa2,
+0x10,0x00,0x05,0x91,0x00,0x90,0x04,0x99,0x9c,0x10,0x00,0x00,0x07,0x20,0x05,0x08,
+0x00,0xf1,0x08,0x01,0x09,0x00,0x00,0x18,0x07,0x00,0x00,0x18,0x00,0x00,0x79,0x9a,
+0x99,0x94,0x02,0x77,0x77,0x00,0x00,0x22,0x28,0x20,0x24,0x00,0xf2,0x18,0x09,0x04,
+0x00,0x69,0x9b,0x99,0x94,0x02,0x55,0x56,0x10,0x01,0x44,0x37,0x50,0x06,0xa9,0xaa,
+0x30,0x08,0x20,0x00,0x00,0x03,0x99,0x99,0x40,0x05,0x99,0x9c,0x00,0x00,0x00,0x09,
+0x10,0x05,0x99,0x9d,0x00,0x7d,0x00,0x11,0x09,0x7c,0x00,0xf0,0x03,0x79,0x99,0x99,
+0x94,0x00,0x25,0x55,0x50,0x00,0x01,0x33,0x3b,0x00,0x00,0x59,0x99,0xd0,0x00,0xdb,
+0x01,0xf0,0x05,0x08,0x98,0x88,0x88,0x20,0x03,0x55,0x55,0x00,0x00,0x34,0x44,0xa2,
+0x00,0x07,0x99,0x9b,0x10,0x00,0xb0,0x19,0x00,0xb3,0x99,0x99,0x30,0x02,0x55,0x55,
+0x00,0x01,0x33,0x39,0x20,0x95,0x00,0x02,0x41,0x00,0x00,0x35,0x02,0x70,0xa9,0x9b,
+0x30,0x08,0x20,0x05,0x40,0x04,0x00,0x33,0x03,0x89,0x88,0xfb,0x00,0x11,0x0a,0xd2,
+0x01,0x56,0xb0,0x0a,0x00,0x74,0x00,0xd2,0x01,0x07,0xfb,0x00,0xf7,0x08,0x52,0x99,
+0xb5,0x0a,0x38,0x9c,0x10,0xa0,0x07,0x60,0x0a,0x19,0x50,0x00,0xa1,0x05,0x55,0x54,
+0x00,0x34,0x43,0xa0,0x0a,0xaf,0x01,0x82,0x05,0x00,0x8a,0x97,0x0a,0x00,0x81,0x00,
+0x04,0x00,0xd1,0x99,0x87,0x0a,0x85,0x91,0x00,0x09,0x00,0x89,0x9a,0x59,0x00,0x00,
+0xb1,0x02,0x02,0x3f,0x02,0xf2,0x12,0x48,0x86,0x07,0x00,0xa1,0x10,0x0a,0x00,0xa9,
+0x97,0x09,0x95,0xa0,0x00,0x09,0x00,0x79,0x89,0x39,0x00,0x01,0x22,0x24,0x00,0x04,
+0x77,0x7c,0x00,0x06,0x99,0x9c,0x00,0x0a,0xbe,0x00,0xf0,0x02,0x10,0x38,0x87,0x08,
+0x00,0x82,0x10,0x0a,0x00,0x84,0x32,0x0a,0x10,0x97,0x75,0x0a,0x95,0x48,0x00,0x00,
+0x01,0x02,0x40,0x06,0xaa,0xaa,0x00,0x50,0x03,0x00,0x04,0x00,0xf1,0x0e,0x04,0x98,
+0x87,0x00,0x01,0x10,0x40,0x5c,0x87,0x09,0x09,0xa0,0x00,0x90,0x9c,0x66,0x0b,0x49,
+0xb3,0x20,0xb4,0x9a,0x00,0x09,0x09,0xc9,0x92,0x90,0x90,0xb0,0x02,0xf0,0x16,0x90,
+0x90,0x00,0x00,0x02,0x33,0x30,0x43,0x4c,0x55,0x09,0x45,0xc5,0x50,0xc8,0x5b,0x32,
+0x0b,0x65,0xc6,0x82,0x94,0x51,0x10,0x03,0x22,0x06,0x99,0x9b,0x20,0x00,0x00,0x63,
+0x00,0x00,0x06,0x30,0xff,0x01,0xf0,0x27,0x00,0x41,0x2c,0x98,0x0a,0x46,0xd9,0x80,
+0xda,0x6a,0x00,0x0a,0x46,0xc9,0x92,0x94,0x60,0x00,0x02,0x12,0x04,0x20,0x03,0x20,
+0x6a,0x99,0xb4,0x06,0x30,0x05,0x40,0x38,0x99,0x81,0x22,0x20,0x06,0xc6,0x62,0x09,
+0xa0,0x00,0x09,0xd8,0x73,0x7b,0xa1,0x00,0x29,0xa0,0x00,0x09,0xb9,0x88,0x16,0x03,
+0x02,0xd9,0x00,0xf0,0x0d,0x02,0x33,0x10,0x50,0x0c,0x66,0x20,0xa0,0x0b,0x44,0x15,
+0xb0,0x0b,0x54,0x13,0xa0,0x0b,0x45,0x60,0x90,0x03,0x43,0x20,0x90,0x00,0x70,0x00,
+0x80,0x4a,0x01,0x31,0x00,0xa8,0x88,0x49,0x01,0xf1,0x13,0x07,0x88,0x30,0x60,0x0a,
+0x11,0x00,0xa0,0x0d,0x99,0x49,0xc0,0x0a,0x00,0x00,0x90,0x0b,0x98,0x70,0x90,0x00,
+0x12,0x22,0x20,0x00,0x67,0x77,0xb0,0x00,0x89,0x99,0xa0,0x00,0xa0,0xeb,0x01,0x80,
+0x80,0x07,0x88,0x30,0x70,0xa1,0x10,0x0a,0x27,0x00,0x70,0xa0,0x00,0x0a,0x0c,0x98,
+0x60,0xa0,0x61,0x01,0x41,0xa9,0x99,0xa0,0x09,0x6d,0x02,0xf1,0x04,0xa0,0x05,0x88,
+0x86,0x02,0x32,0x05,0x25,0x1b,0x64,0x09,0x36,0x18,0x00,0x09,0x36,0x1c,0x83,0x8a,
+0x08,0x00,0x00,0x04,0x00,0xc0,0x0b,0x99,0x19,0x36,0x00,0x00,0x09,0x26,0x00,0x00,
+0x08,0x26,0x73,0x00,0xf6,0x02,0x33,0x30,0x43,0x3c,0x54,0x0a,0x45,0xc5,0x37,0xb4,
+0x5b,0x31,0x1a,0x45,0xc6,0x82,0xa5,0xff,0x00,0x42,0x73,0x00,0x00,0x07,0xff,0x00,
+0xf0,0x08,0x42,0x2c,0x97,0x0a,0x45,0xa0,0x00,0xa4,0x5d,0x95,0x8b,0x45,0xa0,0x20,
+0x94,0x48,0x87,0x19,0x44,0x04,0x00,0x75,0x40,0x04,0x02,0x31,0x88,0x89,0x20,0x02,
+0x02,0xf0,0x0b,0x42,0x2c,0x98,0x0a,0x55,0xd9,0x58,0xb4,0x5a,0x00,0x09,0x45,0xc9,
+0x92,0x95,0x50,0x02,0x24,0x41,0x03,0x77,0x6a,0x30,0x49,0x99,0xb2,0x42,0x04,0xf2,
+0x17,0x49,0x99,0x93,0x00,0x00,0x41,0x1d,0x97,0x0a,0x55,0xd8,0x58,0xb4,0x5a,0x10,
+0x09,0x45,0xc8,0x92,0xa5,0x50,0x00,0x03,0x21,0x04,0x99,0x9a,0x10,0x73,0x00,0x73,
+0x07,0x30,0x07,0x20,0x28,0x88,0x80,0x80,0x02,0x70,0x98,0x00,0x07,0x20,0x00,0x00,
+0x07,0x08,0x00,0x51,0x98,0x76,0x10,0x00,0x13,0x34,0x03,0x82,0x00,0x79,0x9c,0xa9,
+0x94,0x02,0x99,0x98,0x02,0x05,0xf2,0x02,0xa8,0x87,0x00,0x04,0xa8,0x89,0x10,0x00,
+0x06,0x40,0x00,0x69,0x9b,0xb9,0x93,0x03,0x10,0xaa,0x00,0x60,0x06,0xa8,0x89,0x40,
+0x00,0x00,0x29,0x03,0xd1,0x98,0x00,0x06,0x41,0x11,0x00,0x06,0x98,0x86,0x00,0x05,
+0xa9,0x99,0x1d,0x00,0xf0,0x04,0x69,0x99,0x99,0x93,0x00,0x59,0x84,0x00,0x03,0x80,
+0x09,0x10,0x03,0x80,0x0a,0x10,0x00,0x48,0x83,0x97,0x00,0x12,0x60,0x40,0x03,0x32,
+0xa9,0x99,0x50,0x09,0x00,0x31,0x59,0x99,0x80,0xcf,0x00,0x51,0x09,0x99,0xc9,0x99,
+0x20,0x6f,0x02,0x01,0x74,0x01,0x12,0x03,0xe7,0x02,0x00,0x95,0x00,0x00,0x8a,0x03,
+0x14,0x08,0x9d,0x00,0x12,0x11,0x18,0x00,0x00,0x5d,0x00,0x01,0x9d,0x00,0x22,0x61,
+0x11,0x9d,0x00,0xf2,0x04,0xb9,0x99,0x10,0x12,0x22,0x22,0x20,0x56,0x66,0x66,0x62,
+0x04,0x99,0x99,0x30,0x00,0x00,0x04,0x60,0x04,0x00,0x03,0x9d,0x00,0x10,0x50,0xad,
+0x00,0x30,0x87,0x00,0x05,0xc5,0x00,0x04,0x40,0x00,0x20,0x10,0x00,0xd0,0x00,0x00,
+0xc5,0x00,0x11,0x30,0x55,0x00,0x00,0xce,0x03,0xf1,0x0c,0x07,0x64,0x43,0x00,0x00,
+0x8a,0x99,0x60,0x00,0x05,0x88,0x88,0x10,0x08,0x88,0x88,0x89,0x10,0x00,0x11,0x11,
+0x00,0x00,0x78,0x88,0xc0,0x00,0x0a,0x04,0x12,0xa0,0x10,0x03,0x80,0x40,0x01,0x22,
+0x00,0x60,0xc7,0x72,0x09,0x34,0x02,0xd7,0xc7,0x73,0x09,0x0a,0x22,0x00,0x90,0xa0,
+0x00,0x09,0x0c,0x99,0x90,0xa1,0x04,0x00,0x5c,0x02,0x01,0x34,0x02,0x21,0x30,0xa0,
+0x34,0x02,0x92,0x70,0xa0,0x00,0x00,0x06,0x00,0x89,0x99,0x90,0x9b,0x05,0x12,0xa0,
+0xe5,0x00,0x71,0x40,0x04,0x99,0x95,0x19,0x00,0x08,0x92,0x06,0x42,0x90,0x0d,0x92,
+0x09,0x09,0x00,0x64,0x09,0x00,0x3c,0x9c,0x60,0x90,0x6d,0x04,0x22,0x90,0x00,0x13,
+0x06,0xf1,0x02,0x08,0x00,0x5b,0x9b,0x3a,0x00,0x09,0x09,0x0a,0xa5,0x09,0x09,0x0a,
+0x00,0x7c,0x9b,0x5a,0x18,0x00,0xf0,0x00,0x06,0x20,0x08,0x00,0x07,0xb9,0x9d,0x00,
+0x07,0x30,0x09,0x00,0x03,0x88,0x87,0x97,0x03,0xf3,0x0d,0x32,0x38,0x88,0x29,0x54,
+0x08,0x08,0x09,0x54,0x09,0x09,0x0b,0x84,0x09,0x09,0x0b,0x74,0x09,0x09,0x09,0x54,
+0x3b,0x9b,0x49,0x54,0x00,0x00,0x09,0x04,0x00,0xf0,0x05,0x00,0x10,0x38,0x88,0x50,
+0x60,0x30,0x30,0x0a,0x09,0x09,0x39,0xa0,0x90,0x90,0x0a,0x3b,0x9a,0x70,0x90,0xf5,
+0x05,0x80,0x56,0x55,0xa0,0x0a,0x99,0x97,0x01,0x90,0x46,0x04,0xb0,0x97,0x00,0x00,
+0x00,0x73,0xb9,0xb5,0x0a,0x09,0x09,0x49,0x23,0x00,0x20,0x3d,0x8c,0xc3,0x00,0x00,
+0x64,0x05,0x22,0x80,0x0a,0xf7,0x02,0xf6,0x11,0x07,0x88,0x84,0x02,0x22,0x05,0x51,
+0x38,0x87,0x09,0x72,0x08,0x08,0x09,0x72,0x09,0x0a,0x59,0x72,0x09,0x09,0x39,0x72,
+0x09,0x09,0x09,0x72,0x4b,0x9a,0x49,0x72,0x00,0xd2,0x05,0xf0,0x0d,0x00,0x13,0x33,
+0x04,0x51,0x28,0x57,0x0a,0x73,0x09,0x0a,0x7a,0x73,0x09,0x09,0x2a,0x73,0x4c,0x8c,
+0x3a,0x73,0x00,0x00,0x04,0x41,0x00,0x69,0x99,0x22,0x05,0x13,0x91,0xe7,0x00,0xf0,
+0x07,0x10,0x13,0x33,0x20,0x52,0x75,0x73,0x2a,0x09,0x09,0x16,0xa0,0x90,0x92,0x6a,
+0x1a,0x4b,0x42,0xa1,0x33,0x21,0x09,0xb7,0x03,0x00,0x34,0x01,0x32,0xc8,0x88,0x70,
+0x00,0x02,0xd2,0x33,0xb9,0x95,0x1a,0x09,0x09,0x28,0xa0,0x90,0x92,0x7a,0x3c,0x8d,
+0x59,0x01,0xa0,0x49,0x89,0x20,0x0b,0x00,0x09,0x00,0xa2,0x04,0x80,0x67,0x07,0x00,
+0xd9,0x02,0x00,0x08,0x02,0xb1,0x90,0x26,0x00,0x00,0xa0,0x26,0x00,0x07,0xd9,0xac,
+0x50,0x6f,0x01,0x00,0xd9,0x02,0x31,0x9b,0xa9,0x94,0xdc,0x00,0xf0,0x07,0x60,0x50,
+0x00,0x03,0xb4,0xa5,0x00,0x04,0x4b,0x43,0x00,0x78,0x8b,0x88,0x92,0x03,0x44,0x44,
+0x00,0x04,0x55,0x5c,0xb6,0x05,0x23,0x00,0x0b,0xf7,0x04,0x0f,0x48,0x00,0x02,0xf2,
+0x14,0x50,0x13,0x00,0x00,0xa0,0x37,0x00,0x69,0xb9,0xab,0x94,0x04,0x99,0x99,0x50,
+0x00,0x10,0x01,0x00,0x00,0xa0,0x09,0x00,0x00,0xa0,0x0a,0x10,0x07,0x88,0x88,0x60,
+0x68,0x88,0x89,0x96,0x71,0x02,0x12,0x50,0x61,0x02,0x13,0x00,0xcc,0x02,0x00,0x51,
+0x08,0xa5,0x90,0x45,0x00,0x00,0xa0,0x45,0x00,0x08,0xd9,0xab,0x19,0x00,0x01,0x09,
+0x06,0xf2,0x08,0x89,0x99,0x70,0x00,0x00,0x50,0x60,0x00,0x00,0x4b,0x4b,0x50,0x00,
+0x04,0x44,0x43,0x00,0x08,0x88,0x88,0x88,0x00,0x04,0x4a,0x06,0x11,0xb0,0x94,0x00,
+0x04,0x7c,0x02,0xf0,0x00,0x20,0x12,0x22,0x20,0x73,0x77,0x75,0x09,0x08,0x09,0x00,
+0xa0,0x90,0x90,0x09,0x32,0x02,0x67,0x90,0x90,0x09,0x4c,0x9b,0x80,0x7c,0x02,0x02,
+0x46,0x01,0x22,0x0a,0x09,0x23,0x00,0x4d,0x1a,0x4b,0x40,0x91,0x46,0x01,0x05,0xff,
+0x01,0x16,0x00,0xff,0x01,0x1d,0x42,0xff,0x01,0x34,0x53,0xb9,0xb5,0x23,0x00,0x0f,
+0x69,0x01,0x02,0xf0,0x14,0x05,0x42,0x03,0x20,0x00,0x24,0x30,0x54,0x00,0x78,0x88,
+0x65,0x40,0x00,0x68,0x70,0x54,0x00,0x18,0x07,0x25,0xb8,0x03,0x60,0x53,0x54,0x00,
+0x0a,0x1a,0x05,0x40,0x00,0x37,0x30,0x54,0xb6,0x00,0x00,0xed,0x00,0xf1,0x0c,0x11,
+0x00,0x06,0x84,0x06,0x00,0x68,0x88,0x4a,0x00,0x05,0x83,0x09,0x00,0x37,0x09,0x09,
+0xa6,0x37,0x0a,0x09,0x00,0x04,0x72,0x07,0x00,0x05,0x5f,0x08,0x13,0x0a,0x04,0x00,
+0xf1,0x12,0x03,0x00,0x06,0x94,0x08,0x00,0x57,0x77,0x3a,0x00,0x14,0x72,0x09,0x00,
+0x1b,0x5a,0x09,0x52,0x45,0x09,0x09,0x53,0x0a,0x68,0x09,0x00,0x00,0x30,0x09,0x00,
+0x04,0x50,0x01,0x93,0x04,0x10,0x02,0xd6,0x03,0x21,0x84,0x04,0x50,0x00,0xf4,0x11,
+0x06,0x93,0x0a,0x00,0x38,0x0a,0x0a,0x95,0x37,0x0a,0x0a,0x00,0x04,0x72,0x05,0x00,
+0x04,0x99,0x9d,0x00,0x04,0x99,0x9c,0x00,0x09,0x20,0x00,0x00,0x04,0x98,0x88,0x10,
+0x78,0x00,0xf1,0x04,0x04,0x82,0x0a,0x00,0x39,0x1a,0x0a,0x95,0x36,0x0a,0x09,0x00,
+0x06,0x84,0x07,0x00,0x03,0xa9,0x99,0x36,0x03,0x01,0x3a,0x03,0x63,0x99,0x87,0x00,
+0x06,0x84,0x05,0xa0,0x00,0x51,0x0a,0x00,0x37,0x0a,0x09,0x28,0x00,0xf2,0x08,0x05,
+0x83,0x06,0x00,0x03,0x10,0x05,0x00,0x06,0xb9,0x9d,0x00,0x06,0x30,0x09,0x00,0x02,
+0x89,0x87,0x00,0x06,0x83,0x05,0x78,0x00,0x45,0x82,0x09,0x00,0x38,0x28,0x00,0xe0,
+0x08,0x00,0x00,0x79,0x95,0x00,0x04,0x60,0x0a,0x00,0x03,0x80,0x1b,0x00,0x82,0x0a,
+0xf0,0x14,0x06,0x51,0x12,0x50,0x02,0x42,0x25,0x90,0x57,0x77,0x45,0x90,0x08,0x95,
+0x25,0x90,0x27,0x09,0x2b,0xd0,0x26,0x09,0x25,0x90,0x0a,0x68,0x25,0x90,0x01,0x30,
+0x26,0x90,0x00,0x00,0x26,0xad,0x01,0xf0,0x0b,0x20,0x06,0x82,0x22,0x55,0x77,0x76,
+0x4a,0x15,0x82,0x55,0xa2,0x93,0x95,0xac,0x38,0x19,0x54,0x90,0x47,0x12,0x27,0x00,
+0x29,0x99,0x30,0x67,0x03,0x71,0x94,0x03,0x90,0x00,0x68,0x60,0x00,0x5f,0x0a,0x10,
+0x08,0x77,0x00,0x10,0x94,0x77,0x00,0xae,0x39,0x2a,0x09,0x00,0x36,0x09,0x09,0x94,
+0x06,0x73,0x77,0x00,0xf3,0x0c,0x05,0x75,0x00,0x61,0x24,0x41,0x09,0x46,0x66,0x60,
+0x90,0x69,0x90,0x09,0x09,0x03,0x79,0xa0,0x90,0x26,0x09,0x09,0x49,0x20,0x90,0x04,
+0x20,0x20,0x02,0x00,0x1c,0x0b,0xf1,0x0c,0x64,0x88,0x85,0x0a,0x03,0x74,0x00,0xa0,
+0xa0,0x94,0x9a,0x09,0x08,0x00,0xa0,0x58,0x50,0x08,0x00,0x99,0x99,0x50,0x19,0x00,
+0x0a,0x01,0x90,0xd9,0x03,0x91,0x04,0x85,0x00,0x54,0x88,0x85,0x0a,0x04,0x84,0x23,
+0x00,0x00,0x04,0x02,0x70,0x38,0x40,0x07,0x00,0x29,0x89,0x20,0x95,0x00,0x11,0xa3,
+0x95,0x00,0xf1,0x13,0x05,0x82,0x04,0x50,0x58,0x88,0x19,0x81,0x07,0x85,0x09,0x81,
+0x27,0x0a,0x69,0x81,0x0a,0x88,0x09,0x81,0x00,0x00,0x02,0x20,0x00,0x69,0x99,0xd0,
+0x00,0x69,0x99,0xc0,0x00,0xb0,0x6b,0x05,0xa0,0x91,0x04,0x85,0x00,0x43,0x77,0x75,
+0x0a,0x03,0x85,0x4b,0x00,0x80,0x8a,0x09,0x07,0x44,0xa0,0x78,0x91,0x3a,0x8a,0x00,
+0x51,0x07,0x00,0x05,0x00,0xa0,0x6b,0x02,0xf1,0x34,0x04,0x86,0x00,0x63,0x99,0x86,
+0x0a,0x02,0x84,0x29,0xb0,0xa0,0x81,0x0a,0x09,0x07,0x49,0xb0,0x48,0x70,0x09,0x00,
+0x18,0x98,0x20,0x0a,0x10,0x29,0x00,0xa2,0x03,0x90,0x01,0x78,0x60,0x00,0x58,0x80,
+0x00,0x07,0x77,0x77,0x30,0x00,0x38,0x71,0x00,0x02,0x90,0x29,0x00,0x04,0x60,0x09,
+0x00,0x00,0x78,0x92,0x00,0x00,0x05,0x10,0x00,0x69,0x9c,0xa9,0x93,0x4d,0x03,0xf0,
+0x14,0x48,0x81,0x00,0x06,0x88,0x88,0x20,0x00,0x88,0x93,0x00,0x01,0x90,0x19,0x00,
+0x00,0x4c,0x81,0x00,0x68,0x8a,0x88,0x83,0x05,0x99,0x9a,0x20,0x02,0x56,0x6a,0x30,
+0x09,0x43,0x33,0x00,0x20,0x06,0x00,0x28,0x00,0x15,0x05,0x28,0x00,0xa1,0x09,0x00,
+0x00,0x5b,0x82,0x00,0x68,0x8b,0x88,0x83,0x3f,0x01,0xf0,0x1f,0x70,0x1a,0x00,0x05,
+0x60,0x0b,0x00,0x00,0x58,0x82,0x00,0x04,0x86,0x02,0x30,0x04,0x88,0x86,0x45,0x00,
+0x03,0x84,0x03,0x50,0x00,0xa0,0x82,0x36,0x00,0x09,0x06,0x33,0xb8,0x00,0x68,0x80,
+0x36,0x00,0x00,0x70,0x03,0x60,0x06,0x8c,0x99,0x66,0xb2,0x02,0x11,0x50,0x4c,0x09,
+0xf2,0x11,0x03,0x86,0x02,0x40,0x48,0x88,0x73,0x70,0x06,0x88,0x03,0x70,0x09,0x05,
+0x43,0xc8,0x07,0xa8,0x03,0x70,0x46,0xc7,0x84,0x70,0x13,0x22,0x01,0x20,0x03,0x99,
+0x9a,0x50,0x91,0x06,0xf0,0x14,0x02,0x30,0x03,0x96,0x02,0x50,0x04,0x88,0x87,0x27,
+0x00,0x05,0x77,0x02,0x70,0x00,0x90,0x44,0x2c,0x80,0x0a,0x59,0x12,0x80,0x00,0x0b,
+0x23,0x28,0x00,0x59,0x97,0x52,0x70,0x00,0x46,0x53,0x00,0x40,0xb8,0x88,0x40,0x00,
+0xee,0x06,0xf2,0x19,0x03,0x86,0x01,0x40,0x48,0x88,0x63,0x70,0x07,0x79,0x12,0x70,
+0x0a,0x06,0x42,0xc9,0x03,0xc5,0x02,0x70,0x58,0xa8,0x83,0x60,0x02,0x99,0x99,0x50,
+0x01,0x55,0x57,0x80,0x05,0x84,0x44,0x10,0x02,0x99,0x99,0x60,0x28,0x00,0xf0,0x0b,
+0x62,0x70,0x06,0x88,0x02,0x70,0x09,0x05,0x42,0xb7,0x07,0xa8,0x02,0x81,0x58,0xc7,
+0x83,0x70,0x00,0x38,0x85,0x10,0x01,0xa0,0x07,0x50,0x04,0x00,0xf0,0x09,0x00,0x38,
+0x84,0x00,0x04,0x87,0x00,0x54,0x88,0x86,0x09,0x02,0x85,0x00,0x90,0xa0,0x63,0x09,
+0x09,0x04,0x40,0x90,0x58,0x80,0x1a,0x04,0x42,0x95,0x9c,0x89,0x29,0x1d,0x02,0x34,
+0x02,0x00,0x48,0x69,0x01,0x12,0x61,0x69,0x01,0xf1,0x1c,0x50,0x0a,0x00,0x00,0x78,
+0x93,0x00,0x00,0x90,0x35,0x00,0x69,0xd9,0xab,0x93,0x00,0x48,0x70,0x00,0x07,0x88,
+0x88,0x30,0x00,0x48,0x71,0x00,0x03,0x80,0x29,0x00,0x02,0x93,0x48,0x00,0x00,0x25,
+0x40,0x00,0x69,0x9a,0x99,0x94,0x17,0x08,0x21,0x07,0x30,0x5c,0x0d,0x00,0xc9,0x08,
+0xf1,0x10,0x17,0x70,0x05,0x29,0x98,0x80,0xa0,0x88,0x94,0x0a,0x07,0x78,0x30,0xa6,
+0x99,0x89,0x2a,0x00,0x90,0x00,0x80,0x09,0x99,0x84,0x00,0x45,0x55,0xa0,0x1b,0x55,
+0x52,0xf8,0x04,0x0f,0x4f,0x00,0x05,0x71,0xb9,0xaa,0x93,0x00,0xa0,0x36,0x00,0x04,
+0x00,0xf1,0x1a,0x20,0x01,0x00,0x01,0x98,0x00,0x62,0x88,0x88,0x0a,0x04,0x88,0x10,
+0x90,0xa0,0x27,0x09,0x05,0x78,0x10,0xa5,0x88,0x98,0x2a,0x01,0x20,0x00,0x90,0x37,
+0x00,0x00,0x02,0xc9,0x99,0x60,0x05,0x65,0x00,0x60,0x13,0x31,0xf7,0x02,0x70,0x59,
+0xa1,0x09,0x09,0x03,0x60,0x90,0xf7,0x02,0x57,0x39,0x20,0x90,0x05,0x20,0x39,0x0b,
+0xf0,0x23,0x04,0x9c,0x10,0x00,0x16,0xbf,0xff,0xf2,0x00,0x3f,0xff,0xff,0xff,0x20,
+0x05,0xff,0xd9,0x41,0xf2,0x00,0x5f,0x20,0x00,0x1f,0x20,0x05,0xe0,0x00,0x01,0xf2,
+0x00,0x5e,0x00,0x07,0x9f,0x20,0x48,0xe0,0x07,0xff,0xf2,0xaf,0xfe,0x00,0x2b,0xd8,
+0x07,0xff,0x90,0x00,0xfd,0x0d,0x02,0x45,0x0d,0xf1,0x17,0x88,0x88,0x14,0xeb,0xe7,
+0x77,0x7e,0xbe,0xa2,0xd0,0x00,0x0d,0x2a,0xeb,0xe3,0x33,0x3e,0xbe,0xb4,0xfb,0xbb,
+0xbf,0x4b,0xd9,0xd0,0x00,0x0d,0x9d,0xb5,0xd0,0x00,0x0d,0x5b,0xb7,0xff,0xff,0xff,
+0x7b,0x67,0x00,0xff,0x05,0xff,0xd6,0xff,0xff,0xff,0xff,0xe7,0xff,0xff,0xff,0x67,
+0x52,0x77,0x77,0x76,0xef,0xc6,0xff,0xff,0xfe,0x0f,0x00,0x01,0x51,0x78,0x63,0x88,
+0x88,0x87,0x5e,0x00,0x00,0xe1,0x03,0xf2,0x0d,0xfd,0x00,0x00,0x00,0x6f,0xf7,0x7c,
+0x10,0x06,0xff,0x70,0xdf,0xc1,0x6f,0xf7,0x00,0x1d,0xfe,0xff,0x70,0x00,0x01,0xdf,
+0xf7,0x00,0x00,0x00,0x1c,0xa8,0x0d,0xf3,0x3b,0x0c,0xd1,0x02,0xea,0xaf,0xd4,0xef,
+0x80,0xaf,0xff,0x80,0x02,0xff,0xf1,0x02,0xef,0xdf,0xd1,0xdf,0x80,0xaf,0xb6,0x70,
+0x00,0x85,0x00,0x00,0xa6,0x00,0x00,0x02,0xa0,0xea,0x29,0x00,0x0e,0xe1,0xea,0x5f,
+0xa0,0x7f,0x40,0xea,0x08,0xf3,0xbd,0x00,0xea,0x01,0xf7,0xcc,0x00,0xb7,0x00,0xf8,
+0xaf,0x00,0x00,0x04,0xf6,0x4f,0xa0,0x00,0x1d,0xf1,0x09,0xfd,0x89,0xef,0x50,0x00,
+0x6d,0xff,0xc4,0x7e,0x06,0xf9,0x22,0x01,0x88,0x10,0x00,0x00,0x05,0xff,0x40,0x00,
+0x1e,0xcf,0xff,0xfc,0xd0,0x7f,0xff,0xdd,0xff,0xf7,0x2d,0xfa,0x00,0xbf,0xd1,0x0b,
+0xf7,0x00,0x8f,0xa0,0x6f,0xfe,0x55,0xef,0xf6,0x4f,0xff,0xff,0xff,0xf3,0x06,0x3a,
+0xff,0xa3,0x60,0x00,0x03,0xff,0x30,0x00,0x01,0x00,0xf7,0x2e,0x6f,0x90,0xf8,0x00,
+0x00,0x09,0xf8,0xec,0xf8,0x00,0x01,0xbe,0x5a,0x5c,0xf8,0x00,0x2d,0xd5,0xef,0xf6,
+0xaf,0x50,0xda,0x6f,0xff,0xff,0x87,0xf1,0x11,0xff,0xff,0xff,0xf5,0x10,0x02,0xff,
+0xc3,0x9f,0xf6,0x00,0x02,0xff,0xb0,0x7f,0xf6,0x00,0x01,0xbb,0x70,0x4b,0xb3,0x00,
+0x00,0x00,0x88,0x20,0x00,0x00,0x01,0xff,0x60,0x05,0x00,0x90,0x01,0xff,0xff,0xff,
+0x60,0x00,0x5f,0xff,0xfa,0x8c,0x00,0xf0,0x07,0xb0,0x00,0x8b,0xb9,0x8b,0x8b,0xb9,
+0xdf,0xff,0xff,0xfe,0xdf,0xcf,0xff,0xff,0xfc,0xbe,0x00,0x00,0x00,0x00,0x00,0xf0,
+0x16,0x00,0x24,0x44,0x44,0x30,0x00,0x01,0xef,0xff,0xff,0xf4,0x00,0x0b,0xc0,0x00,
+0x00,0x8e,0x10,0x6e,0x10,0x00,0x00,0x0c,0xa0,0xee,0xcb,0x10,0x0a,0xcd,0xf2,0xff,
+0xff,0xb8,0x9f,0xff,0xf4,0xff,0x01,0x00,0x20,0xf4,0xcf,0x06,0x00,0xf1,0x26,0xe1,
+0x00,0x04,0x87,0x30,0x5f,0x02,0xdf,0xfe,0xfc,0x7f,0x1e,0xd3,0x00,0x3c,0xff,0x9f,
+0x10,0x05,0xfe,0xff,0x44,0x00,0x02,0x66,0x66,0x12,0x22,0x00,0x00,0x11,0xff,0xff,
+0x50,0x00,0xda,0xff,0xa3,0x10,0x08,0xf4,0xfc,0xfb,0x66,0xbf,0x80,0xf5,0x4c,0xff,
+0xd5,0x00,0x31,0x00,0x01,0x00,0x63,0x70,0x00,0xbf,0xab,0xdf,0xff,0x01,0x00,0x50,
+0x00,0x3e,0xf0,0x00,0x2c,0x14,0x00,0xf0,0x05,0x00,0x0b,0xf0,0x00,0xab,0xdf,0xf0,
+0x20,0xff,0xff,0xf0,0xa6,0xff,0xff,0xf0,0x59,0xff,0xff,0xf0,0x92,0x1d,0x00,0x31,
+0x00,0x02,0xc0,0x36,0x00,0x11,0x40,0x3a,0x00,0x10,0xaa,0x28,0x00,0x90,0x0a,0x4a,
+0x70,0xab,0xdf,0xf0,0x23,0xe2,0xe0,0x2c,0x00,0x20,0x95,0xc2,0x2e,0x00,0x20,0x76,
+0xc3,0x30,0x00,0xe0,0xc3,0xe1,0x00,0x3e,0xf0,0x09,0xa6,0xb0,0x00,0x02,0xc0,0x03,
+0x3e,0x20,0x36,0x00,0x10,0xc3,0xd6,0x00,0xf0,0x11,0x44,0x42,0xff,0xef,0xff,0xff,
+0xff,0xf3,0x0d,0xff,0xef,0xff,0xf8,0x4e,0xfe,0x25,0xff,0xff,0x9d,0xe2,0x00,0x6f,
+0xf9,0x01,0x20,0x00,0x4f,0xf7,0x44,0x44,0x44,0x7f,0xd0,0x00,0xf0,0x18,0xfc,0x00,
+0x1a,0x00,0x00,0x07,0xf5,0x00,0x00,0xef,0xc0,0x00,0x8f,0xff,0x60,0x3f,0xff,0xff,
+0x1b,0xff,0xff,0xf9,0xfb,0xff,0xff,0xdd,0x6e,0xff,0xfc,0x7e,0x59,0xff,0x60,0x9f,
+0xff,0x80,0x00,0x13,0x10,0x54,0x00,0xf3,0x40,0x0e,0x70,0x03,0xe4,0xe7,0x04,0xff,
+0x5e,0x75,0xff,0xf5,0xec,0xff,0xff,0x5e,0xff,0xff,0xf5,0xea,0xef,0xff,0x5e,0x71,
+0xdf,0xf5,0xe7,0x01,0xcf,0x59,0x50,0x00,0x92,0x88,0x00,0x00,0x00,0x0f,0xfe,0x50,
+0x00,0x00,0xff,0xff,0xc3,0x00,0x0f,0xff,0xff,0xf9,0x10,0xff,0xff,0xff,0xfe,0x5f,
+0xff,0xff,0xff,0xfa,0xff,0xff,0xff,0xf8,0x0f,0xff,0xff,0xb2,0x00,0xff,0xfd,0x40,
+0x00,0x0e,0xf7,0x00,0x00,0x00,0x11,0x00,0x01,0x00,0xef,0x0d,0xff,0x90,0xdf,0xf9,
+0xff,0xfc,0x0f,0xff,0xcf,0xff,0xc0,0xff,0xfc,0x09,0x00,0x00,0x82,0xfb,0x0f,0xff,
+0xb8,0xbb,0x50,0x8b,0xb5,0x2d,0x00,0x30,0xff,0xff,0xf9,0x3f,0x01,0x01,0xbb,0x00,
+0x0f,0x09,0x00,0x03,0x40,0xb8,0xbb,0xbb,0xbb,0x2d,0x00,0xf0,0x14,0x0b,0xa0,0x00,
+0xe7,0xcf,0xb0,0x0e,0x7c,0xff,0xc1,0xe7,0xcf,0xff,0xdf,0x7c,0xff,0xff,0xf7,0xcf,
+0xff,0x9e,0x7c,0xff,0x70,0xe7,0xcf,0x60,0x0e,0x77,0x50,0x00,0x95,0x00,0x00,0x02,
+0x53,0x00,0xe0,0xaf,0x60,0x00,0x00,0x09,0xff,0xf5,0x00,0x00,0x8f,0xff,0xff,0x40,
+0x06,0x2f,0x01,0x10,0x0e,0xb2,0x00,0x51,0x03,0x66,0x66,0x66,0x62,0x6f,0x00,0xa0,
+0x0f,0xff,0xff,0xff,0xfb,0x06,0x88,0x88,0x88,0x84,0x2f,0x00,0xf0,0x27,0x01,0xc7,
+0x00,0x1d,0xf5,0x01,0xdf,0x50,0x1d,0xf5,0x00,0x4f,0xd0,0x00,0x06,0xfc,0x00,0x00,
+0x6f,0xc0,0x00,0x06,0xf9,0x00,0x00,0x51,0x00,0x00,0x00,0x3e,0x30,0x00,0x2e,0xf3,
+0x00,0x02,0xef,0x30,0x00,0x2e,0xe3,0x00,0x09,0xf8,0x00,0x8f,0xa0,0x08,0xfa,0x00,
+0x5f,0xa0,0x00,0x06,0x3a,0x00,0x00,0x44,0x01,0xf0,0x02,0x8f,0x40,0x00,0x00,0x09,
+0xf5,0x00,0x00,0x00,0x9f,0x50,0x00,0x9b,0xbd,0xfc,0xbb,0x6f,0x5c,0x00,0x50,0x13,
+0x3a,0xf7,0x33,0x10,0x12,0x00,0x02,0x1b,0x00,0x80,0x39,0x10,0x00,0xbd,0xdd,0xdd,
+0xdd,0x8e,0x86,0x00,0x02,0x23,0x01,0xf1,0x21,0x04,0x8a,0x95,0x00,0x00,0x01,0xcf,
+0x84,0x6e,0xe3,0x00,0x1e,0xf5,0x08,0x72,0xff,0x40,0xbf,0xe0,0x2d,0xf5,0xbf,0xe0,
+0xdf,0xe3,0xff,0xf6,0xaf,0xf1,0x4f,0xf3,0xaf,0xd1,0xef,0x70,0x05,0xfd,0x31,0x2b,
+0xf7,0x00,0x00,0x19,0xdf,0xea,0x30,0x00,0xb6,0x35,0x00,0xf2,0x25,0x06,0xfa,0x16,
+0xaa,0x83,0x00,0x00,0x03,0xef,0xe6,0x49,0xfb,0x00,0x00,0x01,0xbe,0x49,0x28,0xfd,
+0x00,0x1d,0x40,0x8f,0xfe,0x1f,0xf9,0x04,0xff,0x50,0x5f,0xf1,0xff,0xb0,0x0a,0xfc,
+0x00,0x2d,0xdf,0xf2,0x00,0x0a,0xfa,0x10,0x1b,0xf7,0x00,0x00,0x04,0xbe,0xe4,0x08,
+0xf7,0x6e,0x00,0x21,0xf5,0x00,0xe9,0x00,0x51,0x00,0x00,0x00,0x02,0xe6,0x0b,0x00,
+0x20,0xbf,0xe1,0x06,0x00,0x30,0x4f,0xff,0x90,0x82,0x01,0x80,0xe7,0xcf,0x20,0x00,
+0x00,0x07,0xfc,0x08,0x55,0x00,0xf0,0x0b,0xef,0xd0,0x9f,0xf4,0x00,0x00,0x9f,0xff,
+0x5c,0xff,0xd0,0x00,0x2f,0xff,0xe1,0xaf,0xff,0x60,0x0b,0xff,0xfe,0x2b,0xff,0xfe,
+0x00,0xef,0x89,0x01,0x84,0xf2,0x01,0x33,0x33,0x33,0x33,0x32,0x00,0x01,0x00,0xf3,
+0x1e,0x07,0xc1,0xef,0xd1,0x03,0xef,0xfc,0x99,0xfb,0x2e,0xec,0xf8,0x00,0x54,0xde,
+0x25,0x70,0x00,0x0c,0xf4,0x01,0x10,0x00,0xbf,0x5c,0x78,0xd1,0xff,0xf6,0x0a,0xff,
+0xfd,0x78,0x60,0x00,0x7c,0xf6,0x00,0x00,0x00,0x05,0x60,0x00,0x00,0x30,0x9a,0x01,
+0xf1,0x1f,0xaf,0xef,0x60,0x00,0xaf,0x90,0xcf,0x60,0x9f,0x80,0x00,0xcf,0x57,0x80,
+0x00,0x00,0xa4,0x11,0x00,0x00,0x02,0x0c,0xe2,0x00,0x05,0xf8,0x3f,0xe2,0x05,0xfd,
+0x10,0x3f,0xe7,0xfd,0x10,0x00,0x3f,0xfd,0x10,0x00,0x00,0x3b,0x10,0x00,0x00,0x80,
+0x67,0x00,0xf0,0x21,0xcf,0xc3,0xff,0xff,0xf5,0x00,0xbe,0xfe,0xb3,0x44,0x4e,0x60,
+0x04,0x3f,0x34,0x00,0x00,0xd6,0x00,0x02,0xf2,0x00,0x00,0x0d,0x60,0x00,0x2f,0x20,
+0x00,0x8c,0xea,0xf1,0x01,0xff,0xff,0xf7,0xdf,0xf7,0x00,0x04,0x44,0x44,0x11,0xc7,
+0x00,0x58,0x88,0x20,0xb0,0x02,0x40,0xe4,0x44,0x41,0xff,0xad,0x02,0x2e,0xff,0xff,
+0x01,0x00,0x02,0x26,0x03,0xf2,0x0d,0x00,0x33,0x00,0x00,0x00,0x03,0xff,0x40,0x00,
+0x00,0x3f,0xff,0xf4,0x00,0x02,0xff,0xff,0xff,0x20,0x00,0x36,0xff,0x63,0x00,0x00,
+0x04,0xff,0x40,0x05,0x00,0xa0,0x9a,0xa5,0xff,0x5a,0xa9,0xff,0xff,0xdd,0xfe,0xdf,
+0x31,0x00,0x15,0xbe,0xf7,0x00,0x10,0xa8,0xc2,0x03,0xd1,0x5f,0xff,0x00,0x00,0x00,
+0x0c,0xff,0xe0,0x00,0x00,0x00,0x6f,0xfa,0xa6,0x00,0x10,0x50,0x16,0x00,0xb0,0xd0,
+0x00,0x39,0x10,0x4f,0xf4,0x00,0xbf,0xfc,0x9f,0xf6,0xdc,0x02,0xa4,0xe4,0x00,0x00,
+0x9f,0xfd,0x81,0x00,0x00,0x01,0x31,0x3d,0x00,0xf5,0x31,0x06,0xfe,0x30,0x05,0xc6,
+0xe7,0xbb,0x05,0xff,0x4d,0xbd,0xb4,0xff,0x40,0x3c,0xff,0xff,0x40,0x00,0x08,0xff,
+0xb0,0x00,0x6f,0xff,0xdf,0x80,0x0e,0x7b,0xb2,0xef,0x80,0xdb,0xd9,0x02,0xef,0x73,
+0xca,0x10,0x02,0x72,0x00,0x5d,0xdd,0x48,0x00,0x08,0xff,0xf6,0xf8,0xcc,0x8f,0xff,
+0x84,0x3f,0xe8,0xff,0xff,0xfc,0xfe,0x8f,0xff,0xff,0xcf,0x09,0x00,0x10,0xe7,0x1e,
+0x03,0x40,0x46,0x66,0x66,0x3f,0xe7,0x04,0xf1,0x0d,0x34,0x44,0x43,0x00,0x00,0x02,
+0x22,0x22,0x00,0x0e,0xff,0xff,0xfe,0x20,0xf5,0x22,0x22,0xfe,0x1f,0x40,0x00,0x0e,
+0xf8,0xf7,0x44,0x44,0xff,0x9f,0x62,0x03,0xf0,0x07,0xf6,0x0c,0xff,0x9f,0xff,0x20,
+0x9f,0xf9,0xff,0xfc,0x7f,0xff,0x9a,0xdd,0xdd,0xdd,0xd4,0x67,0x77,0x77,0x77,0x4e,
+0xad,0x02,0x01,0x95,0x00,0x40,0x77,0x77,0x77,0x74,0xe3,0x01,0x10,0xb0,0x0e,0x00,
+0x50,0x45,0x55,0x55,0x55,0x3f,0x1b,0x00,0x60,0x11,0x11,0x11,0x11,0x00,0x58,0x29,
+0x03,0x01,0x38,0x01,0x00,0xdc,0x02,0xf7,0x00,0xf6,0xc5,0xdf,0xff,0xfd,0x5c,0xfe,
+0x6a,0xff,0xa5,0xef,0xff,0xf9,0x55,0x9f,0x51,0x01,0xf1,0x18,0x03,0xaa,0xa2,0x00,
+0x07,0xff,0xf2,0x00,0x09,0xff,0xd0,0x00,0x0b,0xff,0xd8,0x81,0x0e,0xff,0xff,0xe1,
+0x0e,0xff,0xff,0x60,0x00,0x05,0xfd,0x00,0x00,0x09,0xf4,0x00,0x00,0x0d,0xa0,0x00,
+0x00,0x0f,0x20,0xa5,0x03,0xf0,0x2b,0x01,0x79,0x11,0x00,0x0f,0xfc,0x9f,0xf4,0x00,
+0xff,0xfd,0xcc,0x30,0x0f,0xfa,0x79,0x93,0x40,0xff,0x8e,0xff,0x6f,0x5f,0xf8,0xef,
+0xf7,0x64,0xff,0x8e,0xff,0xff,0xcf,0xf8,0xef,0xff,0xfc,0x46,0x3e,0xff,0xff,0xc0,
+0x00,0xdf,0xff,0xfc,0x00,0x02,0x44,0x44,0x20,0x00,0x01,0x90,0x00,0x00,0x02,0xaf,
+0x81,0xa9,0x01,0xa0,0xd0,0x00,0x9f,0xff,0xff,0x50,0x0c,0xff,0xff,0xf8,0x97,0x02,
+0x51,0xa0,0x3f,0xff,0xff,0xfe,0xd8,0x03,0x91,0x46,0x66,0x66,0x66,0x20,0x00,0xbf,
+0x70,0x00,0x6e,0x02,0x00,0x2f,0x05,0x21,0x44,0x30,0xa0,0x00,0xf3,0x0f,0xf3,0xf4,
+0xa0,0xa0,0xb0,0xb0,0xf4,0xff,0xbe,0xae,0xae,0xaf,0xf4,0xff,0x3a,0x0a,0x0a,0x0f,
+0xf4,0xfb,0xea,0xaa,0xaa,0xea,0xf4,0xf7,0xb4,0x44,0x44,0xc4,0x06,0x06,0x00,0xfa,
+0x00,0x10,0x29,0x3c,0x00,0x10,0x3a,0xd5,0x01,0xb0,0x4b,0xff,0xff,0x70,0x00,0x5d,
+0xff,0xff,0xff,0x10,0x0c,0x5b,0x00,0xc1,0x00,0x0a,0xee,0xef,0xff,0xf2,0x00,0x00,
+0x00,0x0a,0xff,0xa0,0x06,0x00,0x10,0x30,0x06,0x00,0x01,0x3c,0x01,0x21,0x08,0xf4,
+0xd8,0x01,0xf0,0x04,0x20,0x00,0x00,0xef,0xff,0x5b,0x00,0xff,0xff,0x6f,0xb0,0xff,
+0xff,0x68,0x83,0xff,0xff,0xfd,0xd6,0x24,0x05,0x1e,0xff,0x04,0x00,0x22,0xf7,0x00,
+0x8f,0x03,0x10,0x10,0x1a,0x03,0xc0,0xbf,0xff,0xfd,0x81,0x00,0x2c,0xfe,0xa8,0x78,
+0xcf,0xf7,0x0d,0x19,0x00,0xf0,0x05,0x3c,0xf5,0x22,0x05,0xbe,0xfd,0x81,0x05,0x00,
+0x09,0xfe,0xa9,0xcf,0xe2,0x00,0x00,0x37,0x00,0x00,0x38,0x2e,0x00,0x11,0x8c,0x05,
+0x06,0x12,0x0f,0x3c,0x00,0x61,0x58,0x10,0x00,0x00,0xcf,0xff,0xcb,0x04,0xd0,0x75,
+0x55,0x55,0x55,0x5a,0xf2,0xf6,0xff,0xff,0xff,0xfd,0x4f,0x5f,0xa1,0x01,0x91,0xd1,
+0xf5,0xf5,0x77,0x77,0x77,0x76,0x8f,0x4f,0xfa,0x00,0x11,0xd0,0x06,0x01,0x17,0x41,
+0x2e,0x00,0x21,0x54,0x4a,0x2e,0x00,0x11,0x00,0x2e,0x00,0x21,0xf0,0x01,0x2e,0x00,
+0x1f,0x00,0x2e,0x00,0x05,0x21,0x54,0x44,0x2e,0x00,0x11,0x20,0x2e,0x00,0x21,0xf2,
+0x00,0x2e,0x00,0x1f,0x10,0x2e,0x00,0x05,0x21,0x54,0x44,0x2e,0x00,0x20,0x50,0x00,
+0x2e,0x00,0x21,0xf5,0x00,0x2e,0x00,0x2f,0x20,0x00,0x2e,0x00,0x02,0x40,0xfa,0x0f,
+0x74,0x44,0x2e,0x00,0x11,0xf4,0x87,0x04,0x30,0x5f,0x40,0x00,0x2e,0x00,0x01,0x0d,
+0x00,0x0a,0x2e,0x00,0x00,0x12,0x00,0x20,0x5b,0x10,0xa8,0x03,0x11,0xbd,0x1e,0x00,
+0xf1,0x0d,0xa1,0x03,0x00,0x00,0x0a,0xf7,0x39,0x00,0x00,0x07,0x60,0xff,0xea,0xbf,
+0xaa,0xaa,0xdf,0x45,0xa3,0x00,0x93,0x00,0x04,0x10,0x00,0x00,0x01,0xb8,0x8d,0x01,
+0x44,0x02,0x9f,0xb0,0x00,0x9b,0x05,0xf2,0x1c,0x6b,0xca,0x40,0x00,0x9f,0xf6,0xff,
+0x40,0x1f,0xff,0x26,0xfb,0x04,0xf6,0xb4,0x6b,0xf0,0x6f,0xf4,0x06,0xff,0x06,0xff,
+0x90,0xbf,0xf0,0x5f,0x95,0x34,0xcf,0x02,0xfb,0xf3,0x4d,0xc0,0x0c,0xff,0x3d,0xf7,
+0x00,0x1b,0xfe,0xf9,0x32,0x00,0x50,0x12,0x3b,0xca,0x22,0x1f,0xf8,0x02,0x50,0x36,
+0x66,0x66,0x66,0x16,0xf0,0x04,0x8a,0x6f,0x6f,0x6f,0x7f,0x26,0xf6,0xf6,0xf7,0x09,
+0x00,0x91,0x24,0xff,0xff,0xff,0xf1,0x03,0x44,0x44,0x42,0x6b,0x00,0x20,0x97,0x00,
+0xfe,0x05,0xf0,0x02,0xf8,0x00,0x00,0x00,0xa5,0xef,0xe0,0x00,0x00,0xbf,0xe5,0xd4,
+0x00,0x00,0xbf,0xff,0xe0,0x05,0x00,0x13,0xf4,0x05,0x00,0x30,0xaf,0xff,0xf4,0xea,
+0x06,0x00,0xc3,0x00,0x01,0x05,0x00,0x21,0x02,0x20,0x3a,0x00,0x80,0x05,0x88,0x88,
+0x88,0x86,0x00,0x08,0xff,0x57,0x03,0xf0,0x13,0x08,0xff,0xf9,0x6f,0x69,0xff,0x88,
+0xff,0xff,0xc1,0x21,0xcf,0xf8,0xdf,0xff,0xff,0x50,0x5f,0xff,0x82,0xef,0xff,0x71,
+0x91,0x7f,0xf8,0x02,0xef,0xfe,0xdf,0xde,0xff,0x70,0x02,0x85,0x04,0xf0,0x02,0xe3,
+0x01,0xdf,0xff,0xe5,0x1d,0x6c,0x5a,0xab,0xdf,0x3b,0x18,0x8b,0xff,0xdf,0xde,0xeb,
+0xae,0x00,0x0c,0x04,0x00,0x44,0xbf,0xff,0xff,0xf6,0x6e,0x04,0xd0,0x0a,0x00,0x08,
+0x10,0x00,0x07,0xf0,0x0b,0xf2,0x00,0x00,0x8f,0x0b,0x69,0x00,0xf0,0x03,0xf0,0x7f,
+0xfa,0x99,0x99,0x99,0x00,0x6f,0x20,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,
+};
+
+static const etxFontBlock blocks[] = {
+{ .bitmap_index = 0, .comp_offset = 0, .size = 4065, .comp_size = 3588 },
+{ .bitmap_index = 4065, .comp_offset = 3588, .size = 4088, .comp_size = 3173 },
+{ .bitmap_index = 8153, .comp_offset = 6761, .size = 4067, .comp_size = 3273 },
+{ .bitmap_index = 12220, .comp_offset = 10034, .size = 4053, .comp_size = 3474 },
+{ .bitmap_index = 16273, .comp_offset = 13508, .size = 4091, .comp_size = 3531 },
+{ .bitmap_index = 20364, .comp_offset = 17039, .size = 2350, .comp_size = 1985 },
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1409,11 +1514,11 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 63475, .glyph_id_start = 115, .list_length = 514, .type = 3, .unicode_list = 5032, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[31736] __SDRAMFONTS;
+static uint8_t etxUncompBuf[9022] __SDRAMFONTS;
 
 const etxLz4Font lv_font_ko_XS = {
-.uncomp_size = 31472,
-.comp_size = 22368,
+.uncomp_size = 8758,
+.comp_size = 4822,
 .line_height = 13,
 .base_line = 3,
 .subpx = 0,
@@ -1426,12 +1531,15 @@ const etxLz4Font lv_font_ko_XS = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 6060,
-.class_pair_values = 28774,
-.left_class_mapping = 30214,
-.right_class_mapping = 30843,
+.glyph_bitmap = 0,
+.class_pair_values = 6060,
+.left_class_mapping = 7500,
+.right_class_mapping = 8129,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 31736,
+.lvglFontBufSize = 9022,
+.block_count = 6,
+.blocks = blocks,
+.compressed_bitmap = lz4BitmapData,
 };
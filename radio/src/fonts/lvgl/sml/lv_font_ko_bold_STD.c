@@ -215,347 +215,392 @@ static const uint8_t lz4FontData[] ={
 0x13,0xd7,0x08,0x00,0x22,0x24,0x8e,0x08,0x00,0x22,0x71,0x8e,0xa8,0x00,0xa2,0xcf,
 0x8e,0x60,0x0b,0x0b,0x0e,0x00,0xfe,0x1c,0x8f,0x60,0x00,0x22,0x70,0x8f,0xa8,0x00,
 0xa2,0xd2,0x8f,0x40,0x10,0x11,0x0a,0x00,0x00,0x27,0x90,0x60,0x00,0x60,0x6d,0x90,
-0x10,0x0d,0x0e,0x09,0x98,0x13,0xf2,0xff,0xff,0xff,0xff,0xff,0x19,0x72,0x1f,0xb5,
-0x21,0x50,0xab,0x54,0xab,0x58,0xab,0x60,0xab,0x62,0xab,0x65,0xab,0x69,0xab,0x6c,
-0xab,0x81,0xab,0xc0,0xab,0xc4,0xab,0xd0,0xab,0xdc,0xab,0xf0,0xab,0xf8,0xab,0xf9,
-0xab,0x00,0xac,0x0d,0xac,0x14,0xac,0x30,0xac,0x31,0xac,0x41,0xac,0x45,0xac,0x4c,
-0xac,0x50,0xac,0xa0,0xac,0xbc,0xac,0xbd,0xac,0xc5,0xac,0xdc,0xac,0x10,0xad,0x2c,
-0xad,0x30,0xad,0x48,0xad,0x49,0xad,0x4c,0xad,0x50,0xad,0x59,0xad,0x80,0xad,0x88,
-0xad,0x91,0xad,0x9c,0xad,0x0c,0xae,0x08,0xaf,0x94,0xaf,0xa4,0xaf,0xad,0xaf,0xe8,
-0xaf,0xf0,0xaf,0xf8,0xaf,0x04,0xb0,0x58,0xb0,0x60,0xb0,0x73,0xb0,0x74,0xb0,0xc8,
-0xb0,0xe2,0xb0,0x54,0xb1,0x5c,0xb1,0xc4,0xb1,0xe0,0xb1,0xe4,0xb1,0xf5,0xb1,0x18,
-0xb2,0x28,0xb2,0x29,0xb2,0x34,0xb2,0x38,0xb2,0x45,0xb2,0x50,0xb2,0xa4,0xb2,0xac,
-0xb2,0xbe,0xb2,0xc0,0xb2,0xc1,0xb2,0xc4,0xb2,0xc8,0xb2,0x14,0xb3,0x15,0xb3,0x29,
-0xb3,0x68,0xb3,0x6c,0xb3,0x78,0xb3,0xa0,0xb3,0xa8,0xb3,0xf4,0xb3,0x10,0xb4,0x18,
-0xb4,0x2c,0xb4,0x2d,0xb4,0x30,0xb4,0x34,0xb4,0x41,0xb4,0x64,0xb4,0x79,0xb4,0x80,
-0xb4,0x9c,0xb4,0x60,0xb5,0xec,0xb5,0x40,0xb6,0xcc,0xb6,0xd0,0xb6,0xdc,0xb6,0xe1,
-0xb6,0xe8,0xb6,0xe9,0xb6,0x19,0xb7,0x3c,0xb7,0x4c,0xb7,0x4d,0xb7,0x58,0xb7,0x59,
-0xb7,0x5c,0xb7,0x74,0xb7,0x75,0xb7,0x7c,0xb7,0xac,0xb7,0xad,0xb7,0xb0,0xb7,0xb4,
-0xb7,0xbf,0xb7,0x1c,0xb8,0x38,0xb8,0x49,0xb8,0xa8,0xb8,0xb8,0xb8,0xc4,0xb8,0xc8,
-0xb8,0xcc,0xb8,0xd4,0xb8,0xfc,0xb8,0xfd,0xb8,0x00,0xb9,0x0c,0xb9,0x0d,0xb9,0x0f,
-0xb9,0x11,0xb9,0x18,0xb9,0x19,0xb9,0x1c,0xb9,0x1e,0xb9,0x20,0xb9,0x2e,0xb9,0x34,
-0xb9,0x45,0xb9,0x47,0xb9,0x88,0xb9,0x8c,0xb9,0x90,0xb9,0xa4,0xb9,0xc4,0xb9,0xd5,
-0xb9,0xf8,0xb9,0xf9,0xb9,0x0b,0xba,0x84,0xba,0x88,0xba,0xfc,0xba,0x48,0xbb,0x49,
-0xbb,0x50,0xbb,0x5b,0xbb,0x5d,0xbb,0x5f,0xbb,0x64,0xbb,0x65,0xbb,0x68,0xbb,0x6c,
-0xbb,0x6d,0xbb,0x79,0xbb,0x80,0xbb,0x81,0xbb,0xd4,0xbb,0xd8,0xbb,0xdc,0xbb,0xe4,
-0xbb,0xe5,0xbb,0xf0,0xbb,0xf8,0xbb,0x10,0xbc,0x14,0xbc,0x44,0xbc,0x45,0xbc,0x48,
-0xbc,0x4c,0xbc,0x57,0xbc,0xd0,0xbc,0xd4,0xbc,0xd8,0xbc,0xe9,0xbc,0x40,0xbd,0x5c,
-0xbd,0x64,0xbd,0x94,0xbd,0x98,0xbd,0x9c,0xbd,0xb0,0xbd,0xb8,0xbd,0xe0,0xbf,0xfc,
-0xbf,0xfd,0xbf,0x00,0xc0,0x0d,0xc0,0x11,0xc0,0x18,0xc0,0x19,0xc0,0x28,0xc0,0x2d,
-0xc0,0x47,0xc0,0x6c,0xc0,0x6d,0xc0,0x70,0xc0,0x74,0xc0,0x81,0xc0,0x88,0xc0,0x89,
-0xc0,0x8c,0xc0,0x90,0xc0,0x9b,0xc0,0xa8,0xc0,0xdc,0xc0,0xdd,0xc0,0xe0,0xc0,0xf1,
-0xc0,0x30,0xc1,0x68,0xc1,0x6c,0xc1,0x7b,0xc1,0xf4,0xc1,0xfc,0xc1,0x05,0xc2,0x09,
-0xc2,0x2c,0xc2,0x2d,0xc2,0x30,0xc2,0x34,0xc2,0x3c,0xc2,0x41,0xc2,0x48,0xc2,0x40,
-0xc4,0x94,0xc4,0x95,0xc4,0x98,0xc4,0x9a,0xc4,0x9c,0xc4,0xa4,0xc4,0xa5,0xc4,0xa9,
-0xc4,0xae,0xc4,0xc0,0xc4,0xcc,0xc4,0xe1,0xc4,0x04,0xc5,0x08,0xc5,0x0c,0xc5,0x15,
-0xc5,0x16,0xc5,0x18,0xc5,0x20,0xc5,0x28,0xc5,0x3c,0xc5,0x3d,0xc5,0x40,0xc5,0x44,
-0xc5,0x51,0xc5,0x58,0xc5,0x74,0xc5,0x78,0xc5,0x7c,0xc5,0x85,0xc5,0x90,0xc5,0x94,
-0xc5,0xc8,0xc5,0xcc,0xc5,0xe4,0xc5,0xf9,0xc5,0x00,0xc6,0x04,0xc6,0x08,0xc6,0x10,
-0xc6,0x13,0xc6,0x1c,0xc6,0x20,0xc6,0x24,0xc6,0x38,0xc6,0x54,0xc6,0x70,0xc6,0x78,
-0xc6,0x8c,0xc6,0x90,0xc6,0x94,0xc6,0x9c,0xc6,0xa1,0xc6,0xa8,0xc6,0xc4,0xc6,0xc5,
-0xc6,0xc8,0xc6,0xcc,0xc6,0xcd,0xc6,0xd4,0xc6,0xd5,0xc6,0xd8,0xc6,0xe0,0xc6,0xe1,
-0xc6,0xe4,0xc6,0xe8,0xc6,0xf5,0xc6,0xfc,0xc6,0xfd,0xc6,0x50,0xc7,0x51,0xc7,0x54,
-0xc7,0x58,0xc7,0x60,0xc7,0x61,0xc7,0x65,0xc7,0x6c,0xc7,0x7f,0xc7,0x88,0xc7,0xc0,
-0xc7,0xc1,0xc7,0xc4,0xc7,0xd5,0xc7,0xdc,0xc7,0x4c,0xc8,0x50,0xc8,0x61,0xc8,0xd9,
-0xc8,0xe0,0xc8,0xed,0xc8,0x10,0xc9,0x11,0xc9,0x14,0xc9,0x20,0xc9,0x21,0xc9,0x2c,
-0xc9,0x48,0xc9,0x49,0xc9,0x0d,0xca,0x5d,0xcb,0x78,0xcb,0x88,0xcb,0x8c,0xcb,0x8e,
-0xcb,0x94,0xcb,0xfb,0xcb,0xfd,0xcb,0x04,0xcc,0x58,0xcc,0xac,0xcc,0xe4,0xcc,0xe5,
-0xcc,0xe8,0xcc,0xec,0xcc,0xf9,0xcc,0x38,0xcd,0x71,0xcd,0xa8,0xcd,0xbd,0xcd,0xc4,
-0xcd,0xe0,0xcd,0x34,0xce,0x38,0xce,0x3c,0xce,0x44,0xce,0x47,0xce,0x50,0xce,0x6c,
-0xce,0x7c,0xce,0xa4,0xce,0xac,0xce,0xbc,0xcf,0xc4,0xcf,0xcc,0xcf,0xf4,0xcf,0xfc,
-0xcf,0x10,0xd0,0x18,0xd0,0x20,0xd0,0x2c,0xd0,0x2d,0xd0,0x3d,0xd0,0x80,0xd0,0x84,
-0xd0,0x88,0xd0,0x90,0xd0,0x9c,0xd0,0x9d,0xd0,0xa0,0xd0,0xa4,0xd0,0xac,0xd0,0xf0,
-0xd0,0xf4,0xd0,0x05,0xd1,0x7c,0xd1,0x08,0xd2,0x09,0xd2,0x0c,0xd2,0x10,0xd2,0x40,
-0xd2,0x41,0xd2,0x5c,0xd2,0x6d,0xd2,0x78,0xd2,0xd4,0xd2,0xdc,0xd2,0xe8,0xd2,0xe9,
-0xd2,0x08,0xd3,0x19,0xd3,0x3c,0xd3,0x44,0xd3,0xac,0xd3,0xc8,0xd3,0x54,0xd4,0x5c,
-0xd4,0x8c,0xd4,0x90,0xd4,0x94,0xd4,0xa1,0xd4,0xa8,0xd4,0xa9,0xd4,0xac,0xd4,0xb0,
-0xd4,0xb8,0xd4,0xb9,0xd4,0xbd,0xd4,0xc4,0xd4,0xd9,0xd4,0xf5,0xd4,0x18,0xd5,0x28,
-0xd5,0x2d,0xd5,0x3c,0xd5,0x54,0xd5,0x65,0xd5,0x88,0xd5,0x90,0xd5,0x9d,0xd5,0xa4,
-0xd5,0xa5,0xd5,0xa8,0xd5,0xac,0xd5,0xb9,0xd5,0xdc,0xd5,0xf8,0xd5,0x14,0xd6,0x70,
-0xd6,0x84,0xd6,0xc0,0xd6,0xd8,0xd6,0x51,0xef,0x58,0xef,0x5b,0xef,0x5c,0xef,0x5d,
-0xef,0x61,0xef,0x63,0xef,0x65,0xef,0x69,0xef,0x6c,0xef,0x71,0xef,0x76,0xef,0x77,
-0xef,0x78,0xef,0x8e,0xef,0x93,0xef,0x98,0xef,0x9b,0xef,0x9c,0xef,0x9d,0xef,0xa1,
-0xef,0xa2,0xef,0xa3,0xef,0xa4,0xef,0xb7,0xef,0xb8,0xef,0xbe,0xef,0xc0,0xef,0xc1,
-0xef,0xc4,0xef,0xc7,0xef,0xc8,0xef,0xc9,0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,
-0xf0,0x15,0xf0,0x17,0xf0,0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,
-0xf0,0x74,0xf0,0xab,0xf0,0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,
-0xf1,0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x2f,
-0xc1,0xfb,0x1f,0xb0,0xfa,0x0f,0xa0,0xf9,0x06,0x31,0xd9,0x1e,0xa0,0x9a,0x8b,0x9a,
-0x8b,0x98,0x89,0x43,0x44,0x00,0x1f,0x0b,0x70,0x00,0x5d,0x0f,0x30,0x2f,0xff,0xff,
-0xf7,0x01,0xb8,0x6d,0x10,0x00,0xe4,0x7a,0x00,0x8f,0xff,0xff,0xf0,0x15,0xf2,0xd6,
-0x20,0x06,0xc0,0xf2,0x00,0x08,0xa2,0xf0,0x00,0x00,0x09,0x70,0x00,0x05,0xdb,0x30,
-0x09,0xfe,0xff,0x40,0xfd,0x02,0xfb,0x0f,0xe1,0x04,0x40,0x7f,0xf8,0x10,0x00,0x4b,
-0xfe,0x31,0x41,0x04,0xfb,0x4f,0x90,0x1f,0xc0,0xdf,0xce,0xf7,0x01,0x8e,0xc5,0x00,
-0x00,0xb5,0x00,0x0a,0xfc,0x10,0x00,0x00,0x5e,0x2c,0x80,0xb3,0x00,0x5e,0x0b,0x96,
-0xc0,0x00,0x0c,0xfe,0x4e,0x20,0x00,0x00,0x10,0xb7,0x00,0x00,0x00,0x06,0xc5,0xdd,
-0x50,0x00,0x2e,0x2e,0x77,0xf0,0x00,0xa7,0x0e,0x65,0xf0,0x00,0x00,0x06,0xee,0x70,
-0x01,0xbf,0xd5,0x00,0x00,0x9f,0x9d,0xf0,0x00,0x0a,0xf0,0x9f,0x00,0x00,0x4f,0xdf,
-0x50,0x00,0x05,0xff,0x90,0x66,0x04,0xfb,0xbf,0x6e,0xb0,0x8f,0x50,0xdf,0xf6,0x04,
-0xfd,0x6a,0xff,0x30,0x06,0xdf,0xe9,0xfd,0x10,0x9b,0x9b,0x9a,0x44,0x00,0x01,0x00,
-0x02,0xe2,0x00,0xd9,0x00,0x7f,0x10,0x0d,0xb0,0x00,0xf7,0x00,0x2f,0x60,0x03,0xf5,
-0x00,0x2f,0x60,0x00,0xf8,0x00,0x0b,0xc0,0x00,0x4f,0x30,0x00,0xad,0x10,0x00,0x91,
-0x10,0x00,0x9a,0x00,0x2e,0x70,0x07,0xf1,0x02,0xf6,0x00,0xea,0x00,0xdc,0x00,0xcd,
-0x00,0xdc,0x00,0xf9,0x03,0xf4,0x0a,0xd0,0x5f,0x30,0x74,0x00,0x00,0x99,0x00,0x43,
-0x88,0x23,0x8e,0xfe,0xf8,0x02,0xff,0x20,0x0d,0x79,0xc0,0x05,0x01,0x50,0x00,0x4b,
-0x40,0x00,0x05,0xf6,0x00,0x00,0x5f,0x60,0x0a,0xff,0xff,0xfb,0x6a,0xcf,0xca,0x70,
-0x0e,0x00,0xf0,0x17,0x00,0x1f,0x72,0xf6,0x5f,0x26,0x70,0x02,0x22,0x04,0xff,0xf4,
-0x15,0x55,0x10,0x1d,0x91,0xea,0x00,0x00,0xd8,0x00,0x03,0xf2,0x00,0x08,0xd0,0x00,
-0x0d,0x70,0x00,0x3f,0x20,0x00,0x8c,0x00,0x00,0xe7,0x11,0x00,0xf8,0x22,0x09,0xc0,
-0x00,0x0e,0x70,0x00,0x02,0xbf,0xd6,0x00,0xdf,0x8c,0xf5,0x3f,0x90,0x1f,0xa5,0xf7,
-0x00,0xfd,0x6f,0x70,0x0f,0xd5,0xf7,0x00,0xfc,0x3f,0x90,0x2f,0xa0,0xdf,0x8c,0xf5,
-0x02,0xbf,0xd7,0x00,0x02,0x8d,0x1c,0xff,0xf1,0x95,0xcf,0x10,0x0c,0xf1,0x00,0x05,
-0x00,0xf0,0xb5,0x04,0xcf,0xe8,0x02,0xfe,0x8c,0xf6,0x7f,0x50,0x3f,0xa0,0x00,0x06,
-0xf7,0x00,0x03,0xfd,0x00,0x03,0xee,0x10,0x03,0xee,0x20,0x02,0xef,0x97,0x77,0x6f,
-0xff,0xff,0xf0,0x05,0xdf,0xd7,0x03,0xfe,0x8c,0xf6,0x38,0x30,0x3f,0x90,0x01,0x29,
-0xf6,0x00,0x8f,0xfa,0x00,0x02,0x59,0xf7,0x5a,0x30,0x1f,0xc4,0xfe,0x8b,0xf8,0x05,
-0xdf,0xe8,0x00,0x00,0x02,0xff,0x10,0x00,0x0b,0xff,0x10,0x00,0x5f,0xff,0x10,0x01,
-0xea,0xcf,0x10,0x09,0xe1,0xcf,0x10,0x3f,0x82,0xcf,0x30,0x9f,0xff,0xff,0xf1,0x35,
-0x55,0xdf,0x50,0x00,0x00,0xcf,0x10,0x0a,0xff,0xff,0x90,0xbf,0x88,0x85,0x0d,0xc0,
-0x00,0x00,0xff,0xff,0xb1,0x09,0x95,0x9f,0x90,0x00,0x00,0xfd,0x2a,0x60,0x0f,0xd0,
-0xef,0x8b,0xf8,0x03,0xcf,0xe8,0x00,0x00,0x2a,0xe9,0x00,0x3f,0xfa,0x50,0x0d,0xe2,
-0x10,0x03,0xfd,0xef,0xd2,0x5f,0xe6,0x9f,0xb5,0xf7,0x00,0xee,0x3f,0x90,0x0e,0xe0,
-0xcf,0x9b,0xf9,0x01,0xae,0xe9,0x00,0x9f,0xff,0xff,0xe4,0x88,0x89,0xfb,0x00,0x00,
-0x7f,0x30,0x00,0x0e,0xc0,0x00,0x07,0xf5,0x00,0x00,0xee,0x00,0x00,0x6f,0x70,0x00,
-0x0d,0xf1,0x00,0x05,0xf9,0x00,0x00,0x44,0x00,0xf0,0x30,0xef,0x8c,0xf6,0x2f,0xa0,
-0x3f,0x90,0xee,0x38,0xf6,0x04,0xff,0xfc,0x01,0xed,0x69,0xf7,0x5f,0x70,0x0f,0xc2,
-0xfe,0x8b,0xf9,0x05,0xcf,0xe9,0x00,0x02,0xcf,0xd5,0x01,0xef,0x8d,0xf3,0x5f,0x80,
-0x3f,0x96,0xf6,0x01,0xfc,0x3f,0xc2,0x7f,0xc0,0x9f,0xfe,0xfa,0x00,0x23,0x7f,0x50,
-0x09,0xbf,0xc0,0x01,0xfd,0x80,0x00,0x1e,0xa1,0xd9,0x9b,0x06,0x71,0x01,0xd9,0x1e,
-0xa0,0x2e,0x82,0xe8,0x3f,0x1a,0xf2,0x2e,0x85,0x0f,0x91,0xf6,0x6d,0x00,0x10,0x00,
-0x01,0x7a,0x02,0x9f,0xfb,0x8f,0xe9,0x40,0x9f,0xd7,0x10,0x04,0xbf,0xfa,0x00,0x02,
-0x9c,0x00,0x00,0x00,0x2f,0xff,0xff,0x81,0x88,0x88,0x84,0x18,0x88,0x88,0x42,0xff,
-0xff,0xf8,0x3b,0x40,0x00,0x03,0xff,0xd6,0x00,0x00,0x6b,0xff,0x30,0x04,0x9f,0xf4,
-0x2e,0xff,0x92,0x03,0xd6,0x82,0x1a,0xf0,0x44,0x08,0xef,0xb2,0x7f,0xca,0xfc,0x69,
-0x10,0xee,0x00,0x06,0xf9,0x00,0x5f,0xb0,0x00,0xbf,0x00,0x00,0x12,0x00,0x00,0xbc,
-0x00,0x00,0xcd,0x00,0x00,0x04,0xbe,0xfd,0x70,0x00,0x00,0x8e,0x61,0x13,0xbc,0x00,
-0x05,0xe2,0x00,0x00,0x0b,0x70,0x0d,0x60,0x3c,0xea,0x14,0xd0,0x3f,0x11,0xf8,0x4f,
-0x21,0xf0,0x5e,0x07,0xe0,0x3f,0x00,0xf1,0x6c,0x0a,0xb0,0x5f,0x03,0xf0,0x6d,0x09,
-0xd1,0xbf,0x2a,0x90,0x2f,0x12,0xde,0x6b,0xfa,0x00,0x0d,0x90,0x57,0x00,0xf0,0x60,
-0x03,0xea,0x42,0x36,0x00,0x00,0x00,0x29,0xdf,0xea,0x00,0x00,0x00,0x0b,0xf7,0x00,
-0x00,0x01,0xff,0xd0,0x00,0x00,0x7f,0xcf,0x30,0x00,0x0d,0xe2,0xf9,0x00,0x03,0xf8,
-0x0c,0xf0,0x00,0x9f,0xa8,0xcf,0x50,0x0f,0xff,0xff,0xfb,0x06,0xf8,0x00,0x0c,0xf2,
-0xcf,0x30,0x00,0x7f,0x80,0x2f,0xff,0xfc,0x50,0x2f,0xe8,0x9f,0xf3,0x2f,0xb0,0x07,
-0xf7,0x2f,0xc1,0x2b,0xf3,0x2f,0xff,0xff,0xa0,0x2f,0xc4,0x4a,0xf6,0x2f,0xb0,0x04,
-0xfa,0x2f,0xe8,0x8d,0xf6,0x2f,0xff,0xfd,0x80,0x00,0x8e,0xfd,0x60,0x00,0xaf,0xc9,
-0xdf,0x70,0x2f,0xd0,0x00,0xfe,0x06,0xf8,0x00,0x01,0x20,0x7f,0x70,0x00,0x00,0x09,
-0x00,0xf1,0x14,0x10,0x2f,0xc0,0x00,0xfe,0x00,0xbf,0xc9,0xdf,0x70,0x00,0x9e,0xfd,
-0x60,0x00,0x2f,0xff,0xe9,0x10,0x2f,0xe8,0xbf,0xd0,0x2f,0xb0,0x08,0xf8,0x2f,0xb0,
-0x02,0xfc,0x2f,0xb0,0x00,0xfe,0x08,0x00,0x00,0x10,0x00,0x31,0xe8,0xbf,0xd1,0x20,
-0x00,0xe0,0xff,0xff,0xf0,0x2f,0xe8,0x88,0x80,0x2f,0xb0,0x00,0x00,0x2f,0xd8,0x88,
-0xd7,0x03,0x11,0x60,0x0c,0x00,0x00,0x04,0x00,0x00,0x18,0x00,0x00,0x20,0x00,0xf1,
-0x03,0xff,0xff,0xd2,0xfe,0x88,0x87,0x2f,0xb0,0x00,0x02,0xfe,0x88,0x83,0x2f,0xff,
-0xff,0x62,0xfb,0x21,0x00,0x22,0x02,0xfb,0x28,0x00,0xf0,0x19,0x00,0x7d,0xfd,0x80,
-0x00,0x9f,0xd9,0xcf,0xa0,0x1f,0xe0,0x00,0xab,0x05,0xf9,0x00,0x11,0x10,0x6f,0x80,
-0x8f,0xff,0x25,0xf9,0x02,0x4d,0xf2,0x1f,0xe0,0x00,0xcf,0x20,0x9f,0xd9,0xaf,0xf1,
-0x00,0x7d,0xfe,0xb3,0x2d,0x00,0x61,0x9f,0x52,0xfb,0x00,0x09,0xf5,0x09,0x00,0x86,
-0xfe,0x88,0x8c,0xf5,0x2f,0xff,0xff,0xff,0x12,0x00,0x04,0x09,0x00,0x46,0x50,0x0f,
-0xd0,0xfd,0x03,0x00,0x00,0x36,0x01,0x4a,0x70,0x00,0x07,0xf7,0x07,0x00,0xf0,0x0c,
-0x8c,0x20,0x8f,0x66,0xfd,0x9f,0xf2,0x08,0xef,0xc4,0x00,0x2f,0xb0,0x07,0xfc,0x02,
-0xfb,0x04,0xfe,0x10,0x2f,0xb2,0xef,0x30,0x02,0xfc,0xcf,0xfa,0x00,0xf6,0x06,0xf5,
-0x00,0x02,0xff,0xbf,0xe1,0x00,0x2f,0xc0,0x8f,0xa0,0x02,0xfb,0x00,0xdf,0x50,0x2f,
-0xb0,0x03,0xfe,0x10,0xb4,0x00,0x0b,0x07,0x00,0xf0,0x48,0xfe,0x88,0x86,0x2f,0xff,
-0xff,0xc0,0x2f,0xf7,0x00,0x02,0xff,0x82,0xff,0xd0,0x00,0x7f,0xf8,0x2f,0xef,0x30,
-0x0d,0xef,0x82,0xfa,0xf9,0x03,0xf9,0xf8,0x2f,0xaa,0xe0,0x9f,0x5f,0x82,0xfa,0x4f,
-0x5e,0xa5,0xf8,0x2f,0xb0,0xee,0xf4,0x5f,0x82,0xfb,0x08,0xfe,0x05,0xf8,0x2f,0xb0,
-0x2f,0x80,0x5f,0x80,0x2f,0xf1,0x00,0x9f,0x52,0xff,0xa0,0x09,0xf5,0x2f,0xff,0x40,
-0x9f,0x52,0xfc,0xed,0x09,0xf5,0x2f,0xb6,0xf8,0x9f,0x52,0xfb,0x0c,0xfb,0xf5,0x2f,
-0xb0,0x2f,0xdb,0x00,0x10,0x8f,0xd2,0x00,0xf0,0x0b,0xdf,0x50,0x00,0x7d,0xfd,0x70,
-0x00,0x9f,0xda,0xdf,0x80,0x2f,0xe0,0x00,0xef,0x15,0xf9,0x00,0x09,0xf5,0x7f,0x70,
-0x00,0x8f,0x66,0xf8,0xf2,0x00,0x81,0xd0,0x00,0xef,0x10,0x9f,0xd9,0xdf,0x90,0x24,
-0x00,0xf5,0x09,0x2f,0xff,0xfd,0x70,0x2f,0xe9,0x9d,0xf8,0x2f,0xb0,0x01,0xfd,0x2f,
-0xb0,0x05,0xfc,0x2f,0xff,0xff,0xf4,0x2f,0xe8,0x86,0x10,0x95,0x01,0x02,0x71,0x01,
-0x12,0x60,0x4d,0x00,0x5f,0xd0,0x01,0xef,0x16,0xf8,0x4d,0x00,0x01,0xe0,0x80,0x00,
-0x7d,0xff,0xf3,0x00,0x00,0x00,0x3e,0xf1,0x00,0x00,0x00,0x13,0x56,0x00,0xe0,0x60,
-0x02,0xfe,0x89,0xef,0x50,0x2f,0xb0,0x05,0xf9,0x02,0xfb,0x00,0x8f,0xd9,0x01,0xff,
-0x35,0xc1,0x02,0xfe,0x8d,0xf4,0x00,0x2f,0xb0,0x4f,0xc0,0x02,0xfb,0x00,0xcf,0x40,
-0x2f,0xb0,0x04,0xfc,0x00,0x03,0xbf,0xfc,0x40,0x1e,0xf9,0x9f,0xf2,0x3f,0xb0,0x05,
-0xc5,0x0e,0xf9,0x30,0x00,0x01,0xaf,0xfd,0x40,0x00,0x01,0x6e,0xf3,0x7e,0x60,0x06,
-0xf7,0x2f,0xf9,0x8e,0xf4,0x03,0xbe,0xfd,0x50,0xcf,0xff,0xff,0xfc,0x68,0x8f,0xf8,
-0x86,0x00,0x0f,0xf0,0x00,0x04,0x00,0x05,0x4f,0x4f,0xa0,0x01,0xfd,0x04,0x00,0x01,
-0xf0,0x49,0x2f,0xc0,0x03,0xfb,0x0c,0xfb,0x9e,0xf5,0x01,0x9e,0xfd,0x50,0xcf,0x40,
-0x00,0xdf,0x46,0xf9,0x00,0x2f,0xe0,0x1f,0xe0,0x06,0xf8,0x00,0xbf,0x30,0xbf,0x30,
-0x05,0xf8,0x0f,0xd0,0x00,0x0f,0xc5,0xf7,0x00,0x00,0xaf,0xbf,0x20,0x00,0x04,0xff,
-0xc0,0x00,0x00,0x0e,0xf6,0x00,0x00,0xaf,0x30,0x3f,0x90,0x0d,0xf1,0x7f,0x60,0x7f,
-0xd0,0x0f,0xd0,0x3f,0x90,0xbf,0xf1,0x3f,0x90,0x0f,0xc0,0xeb,0xf5,0x6f,0x50,0x0c,
-0xf3,0xf5,0xe8,0x9f,0x20,0x08,0xf9,0xf1,0xac,0xce,0x2d,0x00,0xf0,0x25,0x6f,0xfa,
-0x00,0x01,0xff,0x80,0x2f,0xf7,0x00,0x00,0xdf,0x40,0x0e,0xf3,0x00,0x7f,0xa0,0x06,
-0xfc,0x00,0xdf,0x30,0xef,0x20,0x04,0xfc,0x8f,0x80,0x00,0x0a,0xff,0xe0,0x00,0x00,
-0x3f,0xf8,0x00,0x00,0x0b,0xff,0xe1,0x00,0x05,0xfc,0x8f,0x90,0x00,0xef,0x30,0xef,
-0x30,0x8f,0x24,0x00,0xf0,0x06,0xbf,0x50,0x04,0xfc,0x03,0xfc,0x00,0xcf,0x30,0x0a,
-0xf3,0x3f,0xb0,0x00,0x2f,0xba,0xf2,0x00,0x00,0x9f,0xfa,0xb0,0x03,0x12,0x20,0xcf,
-0x00,0x31,0x00,0xff,0x00,0x09,0x00,0x00,0xe8,0x06,0xfd,0x1a,0xf6,0x48,0x88,0x9f,
-0xf2,0x00,0x00,0xaf,0x60,0x00,0x06,0xfa,0x00,0x00,0x2f,0xe1,0x00,0x00,0xcf,0x40,
-0x00,0x08,0xf8,0x00,0x00,0x4f,0xf8,0x88,0x84,0x8f,0xff,0xff,0xf8,0x01,0x10,0x3f,
-0xf8,0x3f,0xb2,0x3f,0x90,0x02,0x00,0x70,0xa1,0x3f,0xf8,0x14,0x42,0xcf,0x10,0x0f,
-0x05,0xf9,0x0d,0x1f,0xd0,0x00,0x0a,0xf3,0x00,0x04,0xf9,0x00,0x00,0xdf,0x00,0x00,
-0x7f,0x60,0x00,0x1f,0xc0,0x00,0x0b,0xf2,0x00,0x05,0xf8,0x11,0x1e,0xfd,0x4f,0xfa,
-0x02,0xf0,0x33,0xfd,0x2f,0xde,0xfd,0x44,0x30,0x00,0x74,0x00,0x04,0xfe,0x00,0x0a,
-0xbf,0x50,0x1f,0x49,0xc0,0x8e,0x03,0xf3,0x22,0x22,0x21,0xff,0xff,0xfc,0x55,0x55,
-0x53,0x4f,0x90,0x05,0xf4,0x05,0xdf,0xd4,0x03,0xfc,0x6e,0xf1,0x25,0x20,0xaf,0x30,
-0x7d,0xef,0xf4,0x6f,0x92,0xaf,0x47,0xfb,0x7e,0xf4,0x0a,0xfd,0xaf,0x60,0x4f,0x80,
-0x00,0x04,0xf8,0x00,0x00,0x07,0x00,0xf0,0x15,0xfb,0xde,0x90,0x4f,0xf9,0xcf,0x74,
-0xf9,0x01,0xfc,0x4f,0x80,0x0f,0xd4,0xf8,0x01,0xfc,0x4f,0xf8,0xcf,0x74,0xf9,0xde,
-0x90,0x03,0xcf,0xd5,0x01,0xfe,0x8e,0xf2,0x7f,0x60,0x3b,0x48,0xf4,0x88,0x00,0xf0,
-0x01,0x27,0x31,0xfe,0x8d,0xf3,0x03,0xcf,0xd5,0x00,0x00,0x00,0x3f,0x90,0x00,0x03,
-0xf9,0x07,0x00,0xf0,0x0a,0x5d,0xea,0xf9,0x2f,0xe9,0xdf,0x97,0xf6,0x04,0xf9,0x8f,
-0x40,0x3f,0x97,0xf5,0x03,0xf9,0x2f,0xd6,0xcf,0x90,0x5d,0xe9,0xf9,0x03,0xab,0x05,
-0xf3,0x17,0x8c,0xf3,0x6f,0x70,0x3f,0x88,0xff,0xff,0xfa,0x6f,0x93,0x33,0x21,0xef,
-0x99,0xe4,0x02,0xbf,0xe9,0x00,0x01,0xbf,0x90,0x9f,0xb5,0x0c,0xf1,0x0d,0xff,0xf6,
-0x4d,0xf6,0x20,0xcf,0x00,0x0c,0xf0,0x00,0x05,0x00,0xf0,0x1b,0x04,0xde,0x9f,0xb1,
-0xff,0x9c,0xfb,0x6f,0x70,0x2f,0xb8,0xf4,0x02,0xfb,0x6f,0x60,0x2f,0xb1,0xff,0x8c,
-0xfb,0x04,0xde,0xaf,0xb0,0x20,0x04,0xfa,0x0d,0xb7,0xdf,0x40,0x7d,0xfd,0x60,0x5f,
-0x80,0x00,0x05,0xf8,0x00,0x00,0x07,0x00,0xf4,0x01,0xfa,0xcf,0xa0,0x5f,0xe8,0xcf,
-0x65,0xf8,0x04,0xf9,0x5f,0x80,0x3f,0x95,0xf8,0x03,0x07,0x00,0x83,0x2e,0x82,0xd7,
-0x00,0x03,0xfa,0x3f,0xa3,0x03,0x00,0x89,0x02,0xf8,0x02,0xd7,0x00,0x00,0x03,0xfa,
-0x02,0x00,0x96,0xf9,0x5c,0xf7,0x9f,0xa0,0x4f,0x80,0x00,0x00,0x04,0x00,0xf5,0x0b,
-0xbf,0x60,0x4f,0x89,0xf9,0x00,0x4f,0xef,0xb0,0x00,0x4f,0xff,0xc0,0x00,0x4f,0xda,
-0xf6,0x00,0x4f,0x81,0xef,0x20,0x4f,0x80,0x5f,0xb0,0x4b,0x00,0x02,0x03,0x00,0xf7,
-0x0c,0x4f,0x9c,0xfb,0x4d,0xfa,0x04,0xff,0x8d,0xff,0x9c,0xf5,0x4f,0x80,0x5f,0x80,
-0x5f,0x84,0xf8,0x04,0xf8,0x04,0xf8,0x4f,0x80,0x4f,0x80,0x4f,0x0b,0x00,0xb6,0x80,
-0x5f,0x9c,0xfb,0x05,0xff,0x8c,0xf6,0x5f,0x80,0x4f,0x9c,0x00,0x00,0x07,0x00,0x50,
-0x90,0x03,0xcf,0xd6,0x01,0xa7,0x07,0xf0,0x10,0x60,0x1f,0xc8,0xf4,0x00,0xee,0x6f,
-0x60,0x1f,0xc1,0xfe,0x8c,0xf5,0x03,0xcf,0xd6,0x00,0x4f,0xbd,0xe9,0x04,0xfe,0x7b,
-0xf7,0x4f,0x80,0x1f,0xc4,0xf8,0x00,0xfd,0x07,0x00,0x30,0xff,0x8c,0xf7,0x15,0x00,
-0x02,0xa5,0x01,0x00,0x07,0x00,0xd0,0x05,0xde,0x8f,0x92,0xfe,0x8d,0xf9,0x7f,0x60,
-0x3f,0x98,0xf4,0x03,0x07,0x00,0x00,0x0e,0x00,0x34,0x05,0xde,0xaf,0x8c,0x01,0x01,
-0x07,0x00,0xc2,0x04,0xfa,0xd9,0x4f,0xfc,0x64,0xf9,0x00,0x4f,0x80,0x04,0xf8,0x05,
-0x00,0xf0,0x06,0x07,0xef,0xc4,0x04,0xfb,0x5e,0xf0,0x5f,0xa2,0x23,0x00,0x8f,0xfe,
-0x60,0x24,0x04,0xdf,0x16,0xfa,0x5d,0xf1,0x18,0x05,0xf1,0x08,0x07,0x70,0x00,0xfe,
-0x00,0xff,0xff,0x15,0xff,0x50,0x0f,0xe0,0x00,0xfe,0x00,0x0f,0xe0,0x00,0xdf,0x81,
-0x05,0xee,0x10,0xb5,0x00,0x26,0x04,0xf9,0x07,0x00,0x00,0x67,0x00,0xf2,0x5d,0x08,
-0xee,0x9f,0x90,0xcf,0x20,0x9f,0x46,0xf6,0x0d,0xf0,0x1f,0xb2,0xfa,0x00,0xcf,0x6f,
-0x40,0x06,0xfe,0xf0,0x00,0x1f,0xfa,0x00,0x00,0xcf,0x50,0x00,0xbf,0x00,0xf9,0x08,
-0xf3,0x7f,0x45,0xfd,0x0b,0xf0,0x3f,0x79,0xff,0x2e,0xb0,0x0e,0xae,0x8f,0x9f,0x70,
-0x0b,0xff,0x3a,0xff,0x30,0x07,0xfe,0x06,0xff,0x00,0x03,0xf9,0x01,0xfb,0x00,0x7f,
-0x70,0xcf,0x20,0xee,0x7f,0x90,0x05,0xff,0xe1,0x00,0x0f,0xfa,0x00,0x07,0xff,0xf2,
-0x01,0xee,0x5f,0xa0,0x9f,0x60,0xbf,0x30,0xdf,0x20,0x9f,0x57,0xf7,0x0e,0xf0,0x2f,
-0xb3,0xfa,0x00,0xdf,0x8f,0x50,0x07,0xff,0xf0,0x00,0x2f,0x55,0x00,0xf0,0x08,0x0b,
-0xf0,0x00,0x29,0xf9,0x00,0x03,0xfc,0x10,0x00,0x7f,0xff,0xff,0x13,0x77,0xbf,0xb0,
-0x00,0x1e,0xe1,0x00,0x0c,0xf4,0x4d,0x03,0xf6,0x1b,0x04,0xff,0x87,0x71,0x8f,0xff,
-0xff,0x20,0x00,0x16,0x00,0x1e,0xc0,0x07,0xf3,0x00,0x8f,0x10,0x09,0xf1,0x01,0xce,
-0x00,0xbf,0x40,0x03,0xec,0x00,0x09,0xf0,0x00,0x8f,0x10,0x07,0xf2,0x00,0x2f,0xa0,
-0x00,0x39,0x00,0xe3,0x01,0x00,0xf0,0x16,0x43,0x00,0x8f,0x40,0x0e,0xb0,0x0c,0xd0,
-0x0c,0xd0,0x09,0xf3,0x01,0xef,0x08,0xf6,0x0c,0xe0,0x0c,0xd0,0x0d,0xc0,0x6f,0x60,
-0x65,0x00,0x07,0xec,0x30,0xba,0x2f,0xbc,0xf9,0xf7,0x2a,0x10,0x9e,0x3c,0x05,0x10,
-0x30,0x9d,0x07,0xf0,0x15,0x4f,0x50,0x00,0x00,0x00,0x04,0xee,0x40,0x0c,0xff,0xff,
-0xfc,0x3e,0x40,0xe4,0x22,0x22,0x00,0x4e,0x3e,0x20,0x00,0x00,0x00,0x8d,0xe3,0x11,
-0x11,0x00,0x3e,0x4d,0xff,0xff,0xfb,0x3e,0x40,0x21,0x00,0x10,0x50,0x2c,0x00,0x10,
-0x60,0x74,0x08,0x24,0x40,0x00,0x3c,0x00,0x10,0x5f,0x0b,0x00,0x20,0x4e,0xe4,0x05,
-0x00,0x11,0x3c,0x3f,0x00,0xf0,0x08,0x02,0x22,0x24,0xed,0x80,0x00,0x00,0x00,0x2e,
-0x4e,0x30,0x01,0x11,0x13,0xe0,0x4e,0x3b,0xff,0xff,0xfd,0x00,0x5e,0xe4,0x2c,0x00,
-0x21,0x6f,0x40,0xec,0x22,0x01,0x68,0x08,0x20,0x2b,0x20,0x24,0x00,0xf3,0x15,0xee,
-0x20,0x00,0x00,0x2e,0xa0,0xae,0x20,0x00,0x1d,0xa0,0x00,0xad,0x10,0x1d,0xd4,0x00,
-0x04,0xdd,0x13,0xcc,0xf2,0x02,0xfc,0xc3,0x00,0x0f,0x20,0x2f,0x00,0x00,0x00,0xf2,
-0x02,0xf0,0x00,0x0b,0x00,0xe0,0xf3,0x13,0xf0,0x00,0x00,0x0d,0xff,0xfd,0x00,0x00,
-0x00,0x0c,0xff,0xfc,0x11,0x00,0x3d,0x23,0xf0,0x00,0x27,0x00,0xf0,0x0a,0x33,0xf2,
-0x02,0xf3,0x30,0x3f,0xfd,0x10,0x1d,0xff,0x30,0x6e,0x30,0x00,0x3e,0x60,0x00,0x5e,
-0x40,0x4e,0x50,0x00,0x00,0x4e,0x8e,0x76,0x00,0x26,0x3c,0x30,0x72,0x23,0x11,0xa0,
-0x91,0x00,0x00,0xd2,0x00,0x20,0x0e,0xfe,0x61,0x0b,0xf0,0x15,0xf4,0xf6,0x00,0x00,
-0x00,0xe9,0x09,0xe0,0x00,0x00,0x7f,0x10,0x1f,0x70,0x00,0x1f,0x80,0x00,0x8f,0x10,
-0x08,0xe0,0x00,0x00,0xe8,0x01,0xfc,0x88,0x88,0x8c,0xf1,0x9f,0xff,0xff,0xff,0xff,
-0xca,0x08,0xf0,0x2e,0x3b,0xc5,0x00,0x00,0x02,0x1e,0x86,0xf2,0x00,0x4d,0xf7,0xf0,
-0x0d,0x50,0x4f,0x60,0x7f,0xb9,0xf1,0x0e,0x60,0x09,0xff,0xe6,0x04,0xe0,0x00,0xcf,
-0xa1,0xd4,0x5c,0x00,0x0e,0x60,0x0c,0x63,0xe0,0x01,0x20,0x00,0xe4,0x0e,0x60,0x00,
-0x00,0x6e,0x00,0x4f,0x70,0x00,0x7f,0x50,0x00,0x4d,0xfe,0xfd,0x40,0x00,0x00,0x02,
-0x42,0x3b,0x01,0xf0,0x0b,0x11,0x10,0x00,0x00,0x00,0xbf,0xff,0x72,0x00,0x08,0xc1,
-0xdf,0xc3,0xf5,0x04,0x98,0x02,0xe2,0x07,0xb4,0x5d,0x00,0x01,0x00,0x1b,0x4d,0x5f,
-0x00,0xf0,0x3e,0xbe,0x68,0x00,0x00,0x00,0x09,0x6a,0xd0,0x00,0x00,0x00,0xb9,0x1a,
-0xa0,0x00,0x00,0x9d,0x00,0x88,0xc4,0x25,0xb9,0x60,0x00,0x69,0xe9,0xf6,0x70,0x00,
-0x00,0x05,0x25,0x00,0x00,0x00,0x28,0x01,0x32,0x00,0x00,0x01,0xee,0xef,0xef,0xd5,
-0x00,0x0d,0x90,0xbc,0x10,0x5f,0x70,0x0b,0xc1,0x0b,0xd0,0x03,0xf3,0x07,0xfd,0x1a,
-0xc0,0x00,0x99,0x0b,0x7a,0xfc,0x10,0x00,0x5c,0x0b,0x60,0x61,0x00,0x00,0x5c,0x08,
-0xe4,0x00,0xf3,0x04,0x89,0x01,0xf4,0x00,0x00,0x02,0xf3,0x00,0x6f,0x60,0x00,0x5e,
-0x70,0x00,0x04,0xdf,0xef,0xd5,0x00,0x8a,0x00,0xf0,0x20,0x0c,0xee,0xee,0xee,0x10,
-0x01,0xfa,0x66,0x6b,0xb0,0x00,0x6f,0x10,0x00,0xd5,0x00,0x0b,0xb0,0x00,0x5e,0x00,
-0x00,0x7e,0x00,0x6d,0x40,0x00,0x2d,0xf3,0x7b,0x10,0x00,0x0d,0x8b,0x3d,0xd0,0x00,
-0x03,0xf0,0xd4,0x8e,0x30,0x00,0x3f,0x15,0x10,0xf3,0xc8,0x0b,0x60,0x8d,0x00,0x00,
-0x02,0xdf,0xfd,0xba,0x01,0x20,0x33,0x00,0xa8,0x00,0xc0,0xaa,0x60,0x00,0x00,0xef,
-0xfa,0x10,0xcb,0xbb,0xba,0xaa,0xbc,0xd8,0x09,0xf0,0x03,0xc0,0x5f,0xff,0xd0,0xbc,
-0x00,0x22,0x21,0x0c,0xc0,0x13,0x33,0x20,0xcc,0x05,0xee,0xec,0x0c,0x64,0x02,0xd0,
-0xc9,0xcb,0xde,0xed,0xb9,0x00,0x0e,0xff,0xa0,0x00,0x00,0x56,0x63,0x38,0x00,0xf0,
-0x2a,0x57,0x62,0x04,0x00,0x06,0xef,0xff,0xf1,0xad,0x47,0xfb,0x30,0x24,0x0a,0x39,
-0xfa,0x00,0x00,0x00,0xa2,0x03,0xc5,0x00,0x00,0x0a,0x20,0x00,0xc8,0x00,0x00,0xa2,
-0x00,0x98,0x00,0x00,0x0a,0x22,0xc6,0x00,0x00,0x00,0xa7,0xcf,0xb0,0x00,0x00,0x0a,
-0xa0,0x5f,0xc5,0x23,0x50,0x20,0x00,0x4d,0xff,0xff,0x49,0x0a,0xf0,0x19,0x54,0x00,
-0x89,0x99,0x99,0x99,0x8c,0x2f,0xd1,0x11,0x2b,0xb0,0x65,0x06,0xef,0xfb,0x0b,0x93,
-0xdf,0xff,0xb0,0xfd,0x00,0x69,0xdb,0x02,0x20,0x00,0x0b,0xb0,0xeb,0x00,0x00,0xbb,
-0x0f,0xd0,0x00,0x0b,0xb0,0x76,0x09,0x00,0x81,0xe0,0x00,0x0b,0xea,0xff,0xaa,0xaa,
-0xe0,0xf2,0x01,0xf0,0x2b,0x18,0xde,0xd8,0x10,0x00,0x3e,0xad,0x6a,0xbe,0x30,0x1e,
-0x70,0xc5,0x70,0x7e,0x18,0xb0,0x0c,0x57,0x00,0xb8,0xc5,0x00,0xbd,0x60,0x05,0xce,
-0x30,0x24,0x06,0x90,0x2e,0xd4,0x4b,0xe3,0xe7,0xc7,0xd9,0xcb,0x8b,0x04,0xc6,0xd9,
-0x2f,0xa9,0x00,0x00,0xbf,0x20,0x5f,0x71,0x01,0x7e,0x50,0x00,0x3b,0xff,0xfb,0x37,
-0x02,0xf2,0x32,0x20,0x00,0x00,0x03,0xbd,0x80,0x00,0x00,0x03,0xe6,0x4b,0xb0,0x00,
-0x00,0xa7,0x00,0x0f,0x12,0x62,0x0a,0x60,0x00,0xe7,0xff,0xf4,0x6d,0x10,0x6d,0xbf,
-0xff,0xb0,0x9f,0xef,0x7a,0xff,0xfa,0x07,0xe9,0xcf,0xff,0xfe,0x23,0xe1,0x4f,0xff,
-0xff,0xe1,0x96,0x1e,0xff,0xff,0xff,0x8c,0x38,0xff,0xff,0xff,0xfb,0xcf,0xfd,0xdd,
-0xdd,0xdd,0x90,0x11,0x77,0x02,0x20,0x61,0x00,0x6b,0x03,0x11,0xd2,0x06,0x00,0xf1,
-0x05,0xe3,0x00,0x02,0x43,0x33,0x37,0xe3,0x00,0xaf,0xff,0xff,0xff,0xf4,0x03,0x66,
-0x66,0x66,0x66,0x60,0x09,0x67,0x02,0x90,0x08,0xf9,0x88,0x88,0x95,0x00,0x07,0xd1,
-0x00,0x99,0x02,0x01,0x06,0x00,0x25,0x05,0x90,0xb9,0x02,0x20,0x68,0x50,0xc1,0x01,
-0xf0,0x24,0x48,0xc9,0x10,0x00,0x00,0x8c,0xa4,0x4c,0x30,0x00,0x03,0x22,0x8b,0x20,
-0x00,0x00,0x5a,0xc5,0x10,0x00,0x06,0x86,0x97,0x30,0x00,0x1c,0xb0,0x10,0xab,0x00,
-0x0a,0xf2,0x7f,0x82,0xf9,0x00,0xaf,0x29,0xfa,0x1f,0x90,0x01,0xda,0x04,0x09,0xd1,
-0x00,0x01,0x8b,0x9a,0x81,0x76,0x02,0xfa,0x0a,0xfd,0x10,0x0d,0x63,0x36,0x9d,0x10,
-0xd3,0x00,0xb0,0xbd,0x0d,0x30,0x0a,0xc9,0xe3,0xd3,0x00,0x00,0x0d,0x3d,0x30,0x00,
-0x00,0xd3,0x09,0x00,0x60,0x40,0x00,0x00,0xd3,0xcf,0xff,0x74,0x04,0x01,0xbc,0x0b,
-0x10,0x53,0x06,0x00,0xf0,0x2b,0xa9,0x6a,0x90,0x00,0x00,0x06,0x70,0x00,0x8d,0xc7,
-0x00,0x0a,0x10,0x00,0x00,0x09,0x40,0x1d,0x10,0x00,0x47,0x33,0x90,0xa3,0x38,0xcf,
-0xda,0x33,0x80,0xc0,0x68,0x58,0x00,0x04,0xb0,0xb0,0x00,0x4f,0x90,0x00,0xa2,0xa1,
-0x00,0xdf,0xf3,0x00,0x83,0x2c,0x20,0x00,0x00,0x01,0xc0,0x02,0xbb,0xbb,0xbb,0xbb,
-0x3f,0x01,0x11,0x4d,0xf2,0x00,0xf0,0x1b,0xf0,0x87,0x00,0x00,0x00,0x7f,0x2f,0x40,
-0x19,0xd8,0x6e,0xae,0x30,0x0a,0xb3,0x7b,0x60,0xd4,0x01,0xf1,0x00,0x9b,0x4f,0x20,
-0x5b,0x00,0x01,0xbf,0x60,0x08,0x70,0x00,0x04,0xf0,0x00,0xa5,0x00,0x00,0x4f,0x00,
-0x0c,0x30,0x0b,0x00,0x10,0xe2,0x0b,0x00,0x02,0x01,0x00,0xf0,0x3a,0x07,0xe8,0x01,
-0xe0,0xd2,0x1e,0x0d,0x20,0x8e,0x80,0x00,0x10,0x0d,0xf9,0x1f,0xfd,0x0b,0xf7,0x01,
-0x00,0x00,0x01,0xfb,0x50,0x00,0x07,0xcf,0xe8,0x20,0x00,0x4e,0xf7,0x08,0xdf,0xd8,
-0x11,0xfa,0x40,0x00,0x09,0x88,0x88,0x31,0xff,0xff,0xf6,0x00,0x00,0x10,0x0c,0x20,
-0x02,0xee,0xef,0xb0,0xe3,0x00,0x00,0x00,0xa8,0x0e,0x40,0x00,0x00,0x0f,0x30,0xe4,
-0x00,0x00,0x08,0xb0,0x0e,0x63,0x0b,0x03,0xf1,0x02,0xed,0xc3,0x00,0xd7,0x00,0x0e,
-0x30,0x00,0xba,0x00,0x00,0xe3,0x00,0x69,0x00,0x00,0x0e,0x92,0x04,0x01,0xa2,0x04,
-0x02,0x0b,0x00,0x13,0xc3,0x76,0x00,0xf0,0x18,0x34,0x44,0x00,0xe1,0x00,0x1c,0xcb,
-0xe8,0x0f,0x20,0x00,0x00,0x0e,0x50,0xf2,0x00,0x00,0x05,0xe0,0x0f,0x20,0x00,0x01,
-0xe5,0x00,0xff,0xf2,0x02,0xd7,0x00,0x0f,0x41,0x04,0xe6,0x00,0x00,0xf2,0x00,0x11,
-0x7b,0x04,0x90,0x00,0x0d,0x20,0x00,0x90,0x00,0x00,0xf3,0x00,0x1d,0x09,0x10,0x41,
-0xe4,0x03,0x43,0xcf,0xff,0xfe,0x40,0x48,0x00,0x80,0x45,0x56,0x10,0xe1,0x00,0x1a,
-0xaa,0xe7,0x48,0x00,0xf3,0x0c,0x2f,0x20,0xf5,0x30,0x00,0x0b,0xa0,0x0f,0xdc,0x10,
-0x0b,0xc0,0x00,0xf2,0x00,0x3e,0xa0,0x00,0x0f,0x20,0x02,0x30,0x11,0x11,0x40,0x00,
-0x01,0x71,0x01,0x20,0x01,0xf2,0x0b,0x00,0x50,0xfe,0x10,0x00,0x2f,0x10,0xcb,0x0d,
-0x43,0xef,0xff,0xff,0x50,0x48,0x00,0xf0,0x21,0x11,0x10,0x0a,0x10,0x01,0xef,0xef,
-0x80,0xf2,0x00,0x00,0x00,0xd6,0x0f,0x30,0x00,0x00,0x4f,0x10,0xff,0xf2,0x00,0x1e,
-0x70,0x0f,0x20,0x00,0x5e,0x80,0x00,0xf2,0x00,0x4b,0x30,0x00,0x07,0x00,0x00,0x0d,
-0xee,0xee,0xd1,0x00,0x02,0xf4,0x22,0x2f,0x20,0x42,0x00,0xf0,0x07,0xf2,0x00,0x02,
-0xf1,0x00,0x1f,0x20,0x00,0x0e,0xff,0xff,0xd0,0x00,0x02,0x33,0x40,0x0b,0x30,0x01,
-0xcc,0xce,0x80,0x05,0x04,0x30,0xe5,0x0c,0x50,0xa2,0x04,0xf5,0x1f,0xcf,0xe2,0x00,
-0x3f,0x50,0x0c,0x62,0x00,0x8f,0x60,0x00,0xc5,0x00,0x39,0x10,0x00,0x07,0x20,0x00,
-0x29,0x09,0x20,0xb0,0x00,0x04,0xe1,0xd4,0x3e,0x00,0x00,0x4f,0xff,0x46,0xf2,0x00,
-0x04,0xd0,0xd4,0xdc,0xb0,0x00,0x3f,0xff,0x8b,0x0c,0x40,0x8a,0x00,0x20,0x0b,0x20,
-0x8a,0x00,0x10,0xf3,0x48,0x00,0x00,0x8a,0x00,0xf0,0x13,0x4e,0x00,0xff,0xf3,0x00,
-0x2e,0x50,0x0f,0x51,0x00,0x4e,0x60,0x00,0xf3,0x00,0x4d,0x30,0x00,0x0e,0x20,0x00,
-0x00,0x7c,0xda,0x20,0x00,0x00,0x8d,0x43,0x8e,0x10,0x00,0x0d,0x50,0x61,0x01,0x10,
-0xba,0x01,0x10,0x40,0x02,0xdf,0xee,0x60,0x43,0x00,0x00,0xeb,0x00,0x90,0x12,0x20,
-0x0b,0x10,0x02,0xee,0xef,0x70,0xf2,0x81,0x01,0xf0,0x09,0x0f,0x31,0x00,0x00,0x8c,
-0x00,0xff,0xe2,0x00,0x5f,0x20,0x0f,0x20,0x00,0x9e,0x30,0x00,0xf2,0x00,0x48,0x10,
-0x00,0x06,0x00,0xbc,0x00,0xe0,0xf2,0x00,0x01,0xf3,0x22,0x22,0x00,0x00,0x1f,0xff,
-0xff,0xf1,0x00,0x01,0xc7,0x0b,0x00,0x0b,0x00,0x28,0xf5,0x00,0x01,0x00,0xf2,0x23,
-0x11,0x11,0xb0,0xe2,0x3e,0xef,0xe2,0xe0,0xf3,0x00,0x06,0xc2,0xe0,0xe3,0x00,0x09,
-0x92,0xe0,0xe3,0x00,0x0e,0x42,0xfc,0xf3,0x00,0x5e,0x02,0xe4,0xf3,0x00,0xd6,0x02,
-0xe0,0xe3,0x09,0xc0,0x02,0xe0,0xe3,0x4e,0x10,0x02,0xe0,0xe3,0x11,0x00,0x02,0xe0,
-0xe3,0x00,0x05,0x00,0xf3,0x34,0x00,0x70,0xa1,0x00,0x01,0x10,0x70,0x91,0x2f,0xee,
-0xf1,0xf1,0xe3,0x00,0x05,0xe0,0xf2,0xe3,0x00,0x0c,0x70,0xff,0xf3,0x00,0x9c,0x00,
-0xf1,0xe3,0x0a,0xc1,0x00,0xf1,0xe3,0x37,0x00,0x00,0x80,0xc2,0x00,0x00,0x7b,0xb7,
-0x00,0x00,0x09,0xd5,0x4b,0xb0,0x00,0x0f,0x40,0x01,0xf0,0x00,0x0d,0x80,0x06,0xe0,
-0x00,0x03,0xde,0xed,0x40,0x00,0x00,0x01,0x10,0x81,0x00,0xf2,0x15,0x12,0x10,0x4c,
-0x0d,0xee,0xee,0x05,0xd0,0x00,0x07,0xb0,0x5d,0x00,0x00,0xd6,0x05,0xd0,0x00,0x5e,
-0x58,0xad,0x00,0x1e,0x54,0x8a,0xd0,0x0b,0xa0,0x00,0x4d,0x09,0xc0,0x00,0x04,0xd3,
-0xb0,0x0c,0x03,0x10,0x04,0xe2,0x05,0x10,0x4c,0xca,0x03,0x10,0x80,0x3a,0x00,0xe0,
-0x10,0x00,0x11,0x20,0x03,0xe0,0x0d,0xee,0xeb,0x03,0xf0,0x00,0x00,0x99,0xce,0x06,
-0xf0,0x0f,0xe7,0xbc,0xf0,0x00,0x09,0xb0,0x46,0xf0,0x00,0xac,0x10,0x02,0xf0,0x0d,
+0x10,0x0d,0x0e,0x09,0x98,0x13,0xf8,0xff,0xff,0xff,0xf7,0x72,0x1f,0xb5,0x21,0x50,
+0xab,0x54,0xab,0x58,0xab,0x60,0xab,0x62,0xab,0x65,0xab,0x69,0xab,0x6c,0xab,0x81,
+0xab,0xc0,0xab,0xc4,0xab,0xd0,0xab,0xdc,0xab,0xf0,0xab,0xf8,0xab,0xf9,0xab,0x00,
+0xac,0x0d,0xac,0x14,0xac,0x30,0xac,0x31,0xac,0x41,0xac,0x45,0xac,0x4c,0xac,0x50,
+0xac,0xa0,0xac,0xbc,0xac,0xbd,0xac,0xc5,0xac,0xdc,0xac,0x10,0xad,0x2c,0xad,0x30,
+0xad,0x48,0xad,0x49,0xad,0x4c,0xad,0x50,0xad,0x59,0xad,0x80,0xad,0x88,0xad,0x91,
+0xad,0x9c,0xad,0x0c,0xae,0x08,0xaf,0x94,0xaf,0xa4,0xaf,0xad,0xaf,0xe8,0xaf,0xf0,
+0xaf,0xf8,0xaf,0x04,0xb0,0x58,0xb0,0x60,0xb0,0x73,0xb0,0x74,0xb0,0xc8,0xb0,0xe2,
+0xb0,0x54,0xb1,0x5c,0xb1,0xc4,0xb1,0xe0,0xb1,0xe4,0xb1,0xf5,0xb1,0x18,0xb2,0x28,
+0xb2,0x29,0xb2,0x34,0xb2,0x38,0xb2,0x45,0xb2,0x50,0xb2,0xa4,0xb2,0xac,0xb2,0xbe,
+0xb2,0xc0,0xb2,0xc1,0xb2,0xc4,0xb2,0xc8,0xb2,0x14,0xb3,0x15,0xb3,0x29,0xb3,0x68,
+0xb3,0x6c,0xb3,0x78,0xb3,0xa0,0xb3,0xa8,0xb3,0xf4,0xb3,0x10,0xb4,0x18,0xb4,0x2c,
+0xb4,0x2d,0xb4,0x30,0xb4,0x34,0xb4,0x41,0xb4,0x64,0xb4,0x79,0xb4,0x80,0xb4,0x9c,
+0xb4,0x60,0xb5,0xec,0xb5,0x40,0xb6,0xcc,0xb6,0xd0,0xb6,0xdc,0xb6,0xe1,0xb6,0xe8,
+0xb6,0xe9,0xb6,0x19,0xb7,0x3c,0xb7,0x4c,0xb7,0x4d,0xb7,0x58,0xb7,0x59,0xb7,0x5c,
+0xb7,0x74,0xb7,0x75,0xb7,0x7c,0xb7,0xac,0xb7,0xad,0xb7,0xb0,0xb7,0xb4,0xb7,0xbf,
+0xb7,0x1c,0xb8,0x38,0xb8,0x49,0xb8,0xa8,0xb8,0xb8,0xb8,0xc4,0xb8,0xc8,0xb8,0xcc,
+0xb8,0xd4,0xb8,0xfc,0xb8,0xfd,0xb8,0x00,0xb9,0x0c,0xb9,0x0d,0xb9,0x0f,0xb9,0x11,
+0xb9,0x18,0xb9,0x19,0xb9,0x1c,0xb9,0x1e,0xb9,0x20,0xb9,0x2e,0xb9,0x34,0xb9,0x45,
+0xb9,0x47,0xb9,0x88,0xb9,0x8c,0xb9,0x90,0xb9,0xa4,0xb9,0xc4,0xb9,0xd5,0xb9,0xf8,
+0xb9,0xf9,0xb9,0x0b,0xba,0x84,0xba,0x88,0xba,0xfc,0xba,0x48,0xbb,0x49,0xbb,0x50,
+0xbb,0x5b,0xbb,0x5d,0xbb,0x5f,0xbb,0x64,0xbb,0x65,0xbb,0x68,0xbb,0x6c,0xbb,0x6d,
+0xbb,0x79,0xbb,0x80,0xbb,0x81,0xbb,0xd4,0xbb,0xd8,0xbb,0xdc,0xbb,0xe4,0xbb,0xe5,
+0xbb,0xf0,0xbb,0xf8,0xbb,0x10,0xbc,0x14,0xbc,0x44,0xbc,0x45,0xbc,0x48,0xbc,0x4c,
+0xbc,0x57,0xbc,0xd0,0xbc,0xd4,0xbc,0xd8,0xbc,0xe9,0xbc,0x40,0xbd,0x5c,0xbd,0x64,
+0xbd,0x94,0xbd,0x98,0xbd,0x9c,0xbd,0xb0,0xbd,0xb8,0xbd,0xe0,0xbf,0xfc,0xbf,0xfd,
+0xbf,0x00,0xc0,0x0d,0xc0,0x11,0xc0,0x18,0xc0,0x19,0xc0,0x28,0xc0,0x2d,0xc0,0x47,
+0xc0,0x6c,0xc0,0x6d,0xc0,0x70,0xc0,0x74,0xc0,0x81,0xc0,0x88,0xc0,0x89,0xc0,0x8c,
+0xc0,0x90,0xc0,0x9b,0xc0,0xa8,0xc0,0xdc,0xc0,0xdd,0xc0,0xe0,0xc0,0xf1,0xc0,0x30,
+0xc1,0x68,0xc1,0x6c,0xc1,0x7b,0xc1,0xf4,0xc1,0xfc,0xc1,0x05,0xc2,0x09,0xc2,0x2c,
+0xc2,0x2d,0xc2,0x30,0xc2,0x34,0xc2,0x3c,0xc2,0x41,0xc2,0x48,0xc2,0x40,0xc4,0x94,
+0xc4,0x95,0xc4,0x98,0xc4,0x9a,0xc4,0x9c,0xc4,0xa4,0xc4,0xa5,0xc4,0xa9,0xc4,0xae,
+0xc4,0xc0,0xc4,0xcc,0xc4,0xe1,0xc4,0x04,0xc5,0x08,0xc5,0x0c,0xc5,0x15,0xc5,0x16,
+0xc5,0x18,0xc5,0x20,0xc5,0x28,0xc5,0x3c,0xc5,0x3d,0xc5,0x40,0xc5,0x44,0xc5,0x51,
+0xc5,0x58,0xc5,0x74,0xc5,0x78,0xc5,0x7c,0xc5,0x85,0xc5,0x90,0xc5,0x94,0xc5,0xc8,
+0xc5,0xcc,0xc5,0xe4,0xc5,0xf9,0xc5,0x00,0xc6,0x04,0xc6,0x08,0xc6,0x10,0xc6,0x13,
+0xc6,0x1c,0xc6,0x20,0xc6,0x24,0xc6,0x38,0xc6,0x54,0xc6,0x70,0xc6,0x78,0xc6,0x8c,
+0xc6,0x90,0xc6,0x94,0xc6,0x9c,0xc6,0xa1,0xc6,0xa8,0xc6,0xc4,0xc6,0xc5,0xc6,0xc8,
+0xc6,0xcc,0xc6,0xcd,0xc6,0xd4,0xc6,0xd5,0xc6,0xd8,0xc6,0xe0,0xc6,0xe1,0xc6,0xe4,
+0xc6,0xe8,0xc6,0xf5,0xc6,0xfc,0xc6,0xfd,0xc6,0x50,0xc7,0x51,0xc7,0x54,0xc7,0x58,
+0xc7,0x60,0xc7,0x61,0xc7,0x65,0xc7,0x6c,0xc7,0x7f,0xc7,0x88,0xc7,0xc0,0xc7,0xc1,
+0xc7,0xc4,0xc7,0xd5,0xc7,0xdc,0xc7,0x4c,0xc8,0x50,0xc8,0x61,0xc8,0xd9,0xc8,0xe0,
+0xc8,0xed,0xc8,0x10,0xc9,0x11,0xc9,0x14,0xc9,0x20,0xc9,0x21,0xc9,0x2c,0xc9,0x48,
+0xc9,0x49,0xc9,0x0d,0xca,0x5d,0xcb,0x78,0xcb,0x88,0xcb,0x8c,0xcb,0x8e,0xcb,0x94,
+0xcb,0xfb,0xcb,0xfd,0xcb,0x04,0xcc,0x58,0xcc,0xac,0xcc,0xe4,0xcc,0xe5,0xcc,0xe8,
+0xcc,0xec,0xcc,0xf9,0xcc,0x38,0xcd,0x71,0xcd,0xa8,0xcd,0xbd,0xcd,0xc4,0xcd,0xe0,
+0xcd,0x34,0xce,0x38,0xce,0x3c,0xce,0x44,0xce,0x47,0xce,0x50,0xce,0x6c,0xce,0x7c,
+0xce,0xa4,0xce,0xac,0xce,0xbc,0xcf,0xc4,0xcf,0xcc,0xcf,0xf4,0xcf,0xfc,0xcf,0x10,
+0xd0,0x18,0xd0,0x20,0xd0,0x2c,0xd0,0x2d,0xd0,0x3d,0xd0,0x80,0xd0,0x84,0xd0,0x88,
+0xd0,0x90,0xd0,0x9c,0xd0,0x9d,0xd0,0xa0,0xd0,0xa4,0xd0,0xac,0xd0,0xf0,0xd0,0xf4,
+0xd0,0x05,0xd1,0x7c,0xd1,0x08,0xd2,0x09,0xd2,0x0c,0xd2,0x10,0xd2,0x40,0xd2,0x41,
+0xd2,0x5c,0xd2,0x6d,0xd2,0x78,0xd2,0xd4,0xd2,0xdc,0xd2,0xe8,0xd2,0xe9,0xd2,0x08,
+0xd3,0x19,0xd3,0x3c,0xd3,0x44,0xd3,0xac,0xd3,0xc8,0xd3,0x54,0xd4,0x5c,0xd4,0x8c,
+0xd4,0x90,0xd4,0x94,0xd4,0xa1,0xd4,0xa8,0xd4,0xa9,0xd4,0xac,0xd4,0xb0,0xd4,0xb8,
+0xd4,0xb9,0xd4,0xbd,0xd4,0xc4,0xd4,0xd9,0xd4,0xf5,0xd4,0x18,0xd5,0x28,0xd5,0x2d,
+0xd5,0x3c,0xd5,0x54,0xd5,0x65,0xd5,0x88,0xd5,0x90,0xd5,0x9d,0xd5,0xa4,0xd5,0xa5,
+0xd5,0xa8,0xd5,0xac,0xd5,0xb9,0xd5,0xdc,0xd5,0xf8,0xd5,0x14,0xd6,0x70,0xd6,0x84,
+0xd6,0xc0,0xd6,0xd8,0xd6,0x51,0xef,0x58,0xef,0x5b,0xef,0x5c,0xef,0x5d,0xef,0x61,
+0xef,0x63,0xef,0x65,0xef,0x69,0xef,0x6c,0xef,0x71,0xef,0x76,0xef,0x77,0xef,0x78,
+0xef,0x8e,0xef,0x93,0xef,0x98,0xef,0x9b,0xef,0x9c,0xef,0x9d,0xef,0xa1,0xef,0xa2,
+0xef,0xa3,0xef,0xa4,0xef,0xb7,0xef,0xb8,0xef,0xbe,0xef,0xc0,0xef,0xc1,0xef,0xc4,
+0xef,0xc7,0xef,0xc8,0xef,0xc9,0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,0x15,
+0xf0,0x17,0xf0,0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,0x74,
+0xf0,0xab,0xf0,0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,0xd7,
+0xf1,0xe3,0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x00,0x01,0x00,
+0x2f,0xfa,0x00,0x01,0x00,0x03,0x13,0xfc,0x08,0x00,0x17,0xf4,0x14,0x00,0x60,0xfb,
+0xfa,0x00,0xfe,0xf7,0x00,0x40,0x00,0x2e,0x01,0x00,0x01,0x00,0x4e,0x02,0x04,0x00,
+0x02,0x16,0x00,0x2f,0xe3,0x00,0x01,0x00,0x15,0x1f,0xe7,0x1e,0x00,0x0a,0x03,0x88,
+0x00,0xb2,0xf8,0x00,0xfe,0x00,0x00,0xf4,0xfe,0xf8,0xfc,0x00,0xf1,0x93,0x00,0x7d,
+0xff,0x00,0x00,0xfe,0xff,0xfb,0xfd,0x92,0x00,0x3f,0xfd,0x00,0xfe,0xdd,0x00,0x04,
+0x1c,0xfd,0x0a,0x00,0x19,0xff,0x1f,0x00,0x16,0xfe,0x70,0x00,0x00,0x0b,0x00,0x7f,
+0xf7,0x00,0xfe,0x00,0xfe,0xfc,0xfe,0x9c,0x00,0x0a,0x15,0x02,0x3c,0x00,0x11,0xfe,
+0x34,0x00,0x26,0xfe,0xfd,0x30,0x00,0x75,0xe4,0x00,0x00,0x00,0xed,0x00,0xeb,0x24,
+0x00,0x20,0xfd,0xfe,0x20,0x00,0x01,0x2b,0x00,0x0d,0x44,0x00,0x10,0xfd,0x08,0x00,
+0x1f,0xfd,0x68,0x00,0x07,0x1f,0xfe,0x43,0x01,0x0d,0x19,0xef,0xdf,0x00,0x01,0x0c,
+0x00,0x10,0xfd,0x38,0x00,0x29,0xfc,0xfa,0x8c,0x01,0xa6,0x02,0xfa,0x00,0x00,0xeb,
+0xfe,0xeb,0xf7,0x00,0xe4,0x2b,0x00,0x35,0xff,0xf4,0xfb,0x0c,0x00,0x72,0xd7,0x00,
+0x00,0x00,0xee,0x00,0xed,0x61,0x01,0x51,0x00,0xfc,0x00,0xff,0xff,0x25,0x01,0x1f,
+0x01,0xe0,0x01,0x01,0x10,0xfd,0xd2,0x00,0x1f,0xfc,0x97,0x00,0x0b,0x10,0xfb,0xba,
+0x00,0x06,0x5f,0x00,0x09,0x7b,0x02,0xc0,0xe6,0xe4,0x00,0x00,0xf4,0xfd,0xea,0xfe,
+0x02,0x00,0x02,0x02,0x60,0x00,0xd3,0xef,0xf7,0x00,0xf7,0xeb,0xf9,0xf8,0x00,0xf9,
+0xf8,0xfb,0xf8,0xfa,0x1a,0x01,0x66,0xea,0xf0,0x00,0x00,0xf8,0xff,0x2b,0x01,0x50,
+0xfb,0xfc,0x00,0x00,0xfb,0xdc,0x00,0x14,0xff,0x7d,0x01,0x42,0x02,0x00,0xf1,0xfa,
+0xb4,0x02,0x03,0x08,0x02,0x33,0x01,0xfd,0xfd,0x6c,0x01,0x17,0x00,0xaf,0x02,0x14,
+0xf0,0x20,0x01,0x15,0x01,0x20,0x01,0x02,0xb0,0x01,0x04,0xcd,0x00,0xf0,0x0a,0x02,
+0xfb,0xe9,0xf1,0x00,0x00,0xf1,0xfd,0xf6,0xfe,0x02,0xf6,0x02,0x02,0x01,0x02,0x00,
+0x02,0xfa,0xf9,0xfe,0xfc,0xf9,0xfc,0xfa,0x03,0x02,0x36,0xfe,0xfd,0x02,0xc5,0x00,
+0x2a,0x01,0xfd,0x99,0x01,0x02,0x48,0x00,0x1e,0xfd,0xb2,0x01,0x1f,0xfe,0xcc,0x01,
+0x20,0x1c,0xfe,0xaa,0x02,0x1e,0x00,0x01,0x00,0x12,0xff,0x43,0x02,0x1f,0xff,0x5a,
+0x03,0x10,0x1f,0xff,0x1d,0x00,0x10,0x1e,0x02,0xdd,0x01,0x19,0x02,0xa5,0x00,0x10,
+0x02,0x7d,0x03,0x0f,0x01,0x00,0x24,0x0b,0xed,0x00,0x1f,0xf7,0x2c,0x00,0x0b,0x23,
+0xfe,0xfe,0xd7,0x01,0x1c,0xee,0x6c,0x02,0x20,0xfe,0x02,0xe4,0x01,0x3e,0x05,0x00,
+0x02,0x89,0x02,0x0e,0xe2,0x03,0x06,0x58,0x03,0x1c,0xef,0x63,0x00,0x2d,0xff,0x01,
+0x80,0x01,0x1f,0xf3,0xd8,0x00,0x24,0x1f,0xfc,0x24,0x00,0x10,0x1f,0xfe,0x19,0x00,
+0x1b,0x04,0x69,0x03,0x10,0x02,0x4a,0x1d,0x4d,0x04,0x00,0x04,0x05,0x21,0x00,0x30,
+0x06,0x07,0x08,0x46,0x0b,0xf1,0x05,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,
+0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xff,0x0d,0x1a,
+0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,
+0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,0xff,0xfe,0x0a,
+0x75,0x02,0x20,0x03,0x02,0x70,0x02,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,
+0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xf1,0x08,0x0b,
+0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,0x00,0x16,
+0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,
+0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,0x00,0x02,0x1f,0x24,
+0x6f,0x02,0xff,0xe9,0x50,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const uint8_t lz4BitmapData[] ={
+0xf2,0xff,0x13,0x2f,0xc1,0xfb,0x1f,0xb0,0xfa,0x0f,0xa0,0xf9,0x06,0x31,0xd9,0x1e,
+0xa0,0x9a,0x8b,0x9a,0x8b,0x98,0x89,0x43,0x44,0x00,0x1f,0x0b,0x70,0x00,0x5d,0x0f,
+0x30,0x2f,0xff,0xff,0xf7,0x01,0xb8,0x6d,0x10,0x00,0xe4,0x7a,0x00,0x8f,0xff,0xff,
+0xf0,0x15,0xf2,0xd6,0x20,0x06,0xc0,0xf2,0x00,0x08,0xa2,0xf0,0x00,0x00,0x09,0x70,
+0x00,0x05,0xdb,0x30,0x09,0xfe,0xff,0x40,0xfd,0x02,0xfb,0x0f,0xe1,0x04,0x40,0x7f,
+0xf8,0x10,0x00,0x4b,0xfe,0x31,0x41,0x04,0xfb,0x4f,0x90,0x1f,0xc0,0xdf,0xce,0xf7,
+0x01,0x8e,0xc5,0x00,0x00,0xb5,0x00,0x0a,0xfc,0x10,0x00,0x00,0x5e,0x2c,0x80,0xb3,
+0x00,0x5e,0x0b,0x96,0xc0,0x00,0x0c,0xfe,0x4e,0x20,0x00,0x00,0x10,0xb7,0x00,0x00,
+0x00,0x06,0xc5,0xdd,0x50,0x00,0x2e,0x2e,0x77,0xf0,0x00,0xa7,0x0e,0x65,0xf0,0x00,
+0x00,0x06,0xee,0x70,0x01,0xbf,0xd5,0x00,0x00,0x9f,0x9d,0xf0,0x00,0x0a,0xf0,0x9f,
+0x00,0x00,0x4f,0xdf,0x50,0x00,0x05,0xff,0x90,0x66,0x04,0xfb,0xbf,0x6e,0xb0,0x8f,
+0x50,0xdf,0xf6,0x04,0xfd,0x6a,0xff,0x30,0x06,0xdf,0xe9,0xfd,0x10,0x9b,0x9b,0x9a,
+0x44,0x00,0x01,0x00,0x02,0xe2,0x00,0xd9,0x00,0x7f,0x10,0x0d,0xb0,0x00,0xf7,0x00,
+0x2f,0x60,0x03,0xf5,0x00,0x2f,0x60,0x00,0xf8,0x00,0x0b,0xc0,0x00,0x4f,0x30,0x00,
+0xad,0x10,0x00,0x91,0x10,0x00,0x9a,0x00,0x2e,0x70,0x07,0xf1,0x02,0xf6,0x00,0xea,
+0x00,0xdc,0x00,0xcd,0x00,0xdc,0x00,0xf9,0x03,0xf4,0x0a,0xd0,0x5f,0x30,0x74,0x00,
+0x00,0x99,0x00,0x43,0x88,0x23,0x8e,0xfe,0xf8,0x02,0xff,0x20,0x0d,0x79,0xc0,0x05,
+0x01,0x50,0x00,0x4b,0x40,0x00,0x05,0xf6,0x00,0x00,0x5f,0x60,0x0a,0xff,0xff,0xfb,
+0x6a,0xcf,0xca,0x70,0x0e,0x00,0xf0,0x17,0x00,0x1f,0x72,0xf6,0x5f,0x26,0x70,0x02,
+0x22,0x04,0xff,0xf4,0x15,0x55,0x10,0x1d,0x91,0xea,0x00,0x00,0xd8,0x00,0x03,0xf2,
+0x00,0x08,0xd0,0x00,0x0d,0x70,0x00,0x3f,0x20,0x00,0x8c,0x00,0x00,0xe7,0x11,0x00,
+0xf8,0x22,0x09,0xc0,0x00,0x0e,0x70,0x00,0x02,0xbf,0xd6,0x00,0xdf,0x8c,0xf5,0x3f,
+0x90,0x1f,0xa5,0xf7,0x00,0xfd,0x6f,0x70,0x0f,0xd5,0xf7,0x00,0xfc,0x3f,0x90,0x2f,
+0xa0,0xdf,0x8c,0xf5,0x02,0xbf,0xd7,0x00,0x02,0x8d,0x1c,0xff,0xf1,0x95,0xcf,0x10,
+0x0c,0xf1,0x00,0x05,0x00,0xf0,0xb5,0x04,0xcf,0xe8,0x02,0xfe,0x8c,0xf6,0x7f,0x50,
+0x3f,0xa0,0x00,0x06,0xf7,0x00,0x03,0xfd,0x00,0x03,0xee,0x10,0x03,0xee,0x20,0x02,
+0xef,0x97,0x77,0x6f,0xff,0xff,0xf0,0x05,0xdf,0xd7,0x03,0xfe,0x8c,0xf6,0x38,0x30,
+0x3f,0x90,0x01,0x29,0xf6,0x00,0x8f,0xfa,0x00,0x02,0x59,0xf7,0x5a,0x30,0x1f,0xc4,
+0xfe,0x8b,0xf8,0x05,0xdf,0xe8,0x00,0x00,0x02,0xff,0x10,0x00,0x0b,0xff,0x10,0x00,
+0x5f,0xff,0x10,0x01,0xea,0xcf,0x10,0x09,0xe1,0xcf,0x10,0x3f,0x82,0xcf,0x30,0x9f,
+0xff,0xff,0xf1,0x35,0x55,0xdf,0x50,0x00,0x00,0xcf,0x10,0x0a,0xff,0xff,0x90,0xbf,
+0x88,0x85,0x0d,0xc0,0x00,0x00,0xff,0xff,0xb1,0x09,0x95,0x9f,0x90,0x00,0x00,0xfd,
+0x2a,0x60,0x0f,0xd0,0xef,0x8b,0xf8,0x03,0xcf,0xe8,0x00,0x00,0x2a,0xe9,0x00,0x3f,
+0xfa,0x50,0x0d,0xe2,0x10,0x03,0xfd,0xef,0xd2,0x5f,0xe6,0x9f,0xb5,0xf7,0x00,0xee,
+0x3f,0x90,0x0e,0xe0,0xcf,0x9b,0xf9,0x01,0xae,0xe9,0x00,0x9f,0xff,0xff,0xe4,0x88,
+0x89,0xfb,0x00,0x00,0x7f,0x30,0x00,0x0e,0xc0,0x00,0x07,0xf5,0x00,0x00,0xee,0x00,
+0x00,0x6f,0x70,0x00,0x0d,0xf1,0x00,0x05,0xf9,0x00,0x00,0x44,0x00,0xf0,0x3c,0xef,
+0x8c,0xf6,0x2f,0xa0,0x3f,0x90,0xee,0x38,0xf6,0x04,0xff,0xfc,0x01,0xed,0x69,0xf7,
+0x5f,0x70,0x0f,0xc2,0xfe,0x8b,0xf9,0x05,0xcf,0xe9,0x00,0x02,0xcf,0xd5,0x01,0xef,
+0x8d,0xf3,0x5f,0x80,0x3f,0x96,0xf6,0x01,0xfc,0x3f,0xc2,0x7f,0xc0,0x9f,0xfe,0xfa,
+0x00,0x23,0x7f,0x50,0x09,0xbf,0xc0,0x01,0xfd,0x80,0x00,0x1e,0xa1,0xd9,0x00,0x00,
+0x00,0x00,0x01,0xd9,0x1e,0xa0,0x2e,0x82,0xe8,0x00,0x01,0x00,0xf1,0x2f,0x85,0x0f,
+0x91,0xf6,0x6d,0x00,0x10,0x00,0x01,0x7a,0x02,0x9f,0xfb,0x8f,0xe9,0x40,0x9f,0xd7,
+0x10,0x04,0xbf,0xfa,0x00,0x02,0x9c,0x00,0x00,0x00,0x2f,0xff,0xff,0x81,0x88,0x88,
+0x84,0x18,0x88,0x88,0x42,0xff,0xff,0xf8,0x3b,0x40,0x00,0x03,0xff,0xd6,0x00,0x00,
+0x6b,0xff,0x30,0x04,0x9f,0xf4,0x2e,0xff,0x92,0x03,0xd6,0x00,0x01,0x00,0xf0,0x44,
+0x08,0xef,0xb2,0x7f,0xca,0xfc,0x69,0x10,0xee,0x00,0x06,0xf9,0x00,0x5f,0xb0,0x00,
+0xbf,0x00,0x00,0x12,0x00,0x00,0xbc,0x00,0x00,0xcd,0x00,0x00,0x04,0xbe,0xfd,0x70,
+0x00,0x00,0x8e,0x61,0x13,0xbc,0x00,0x05,0xe2,0x00,0x00,0x0b,0x70,0x0d,0x60,0x3c,
+0xea,0x14,0xd0,0x3f,0x11,0xf8,0x4f,0x21,0xf0,0x5e,0x07,0xe0,0x3f,0x00,0xf1,0x6c,
+0x0a,0xb0,0x5f,0x03,0xf0,0x6d,0x09,0xd1,0xbf,0x2a,0x90,0x2f,0x12,0xde,0x6b,0xfa,
+0x00,0x0d,0x90,0x57,0x00,0xf0,0x60,0x03,0xea,0x42,0x36,0x00,0x00,0x00,0x29,0xdf,
+0xea,0x00,0x00,0x00,0x0b,0xf7,0x00,0x00,0x01,0xff,0xd0,0x00,0x00,0x7f,0xcf,0x30,
+0x00,0x0d,0xe2,0xf9,0x00,0x03,0xf8,0x0c,0xf0,0x00,0x9f,0xa8,0xcf,0x50,0x0f,0xff,
+0xff,0xfb,0x06,0xf8,0x00,0x0c,0xf2,0xcf,0x30,0x00,0x7f,0x80,0x2f,0xff,0xfc,0x50,
+0x2f,0xe8,0x9f,0xf3,0x2f,0xb0,0x07,0xf7,0x2f,0xc1,0x2b,0xf3,0x2f,0xff,0xff,0xa0,
+0x2f,0xc4,0x4a,0xf6,0x2f,0xb0,0x04,0xfa,0x2f,0xe8,0x8d,0xf6,0x2f,0xff,0xfd,0x80,
+0x00,0x8e,0xfd,0x60,0x00,0xaf,0xc9,0xdf,0x70,0x2f,0xd0,0x00,0xfe,0x06,0xf8,0x00,
+0x01,0x20,0x7f,0x70,0x00,0x00,0x09,0x00,0xf1,0x14,0x10,0x2f,0xc0,0x00,0xfe,0x00,
+0xbf,0xc9,0xdf,0x70,0x00,0x9e,0xfd,0x60,0x00,0x2f,0xff,0xe9,0x10,0x2f,0xe8,0xbf,
+0xd0,0x2f,0xb0,0x08,0xf8,0x2f,0xb0,0x02,0xfc,0x2f,0xb0,0x00,0xfe,0x08,0x00,0x00,
+0x10,0x00,0x31,0xe8,0xbf,0xd1,0x20,0x00,0xe0,0xff,0xff,0xf0,0x2f,0xe8,0x88,0x80,
+0x2f,0xb0,0x00,0x00,0x2f,0xd8,0x88,0xd7,0x03,0x11,0x60,0x0c,0x00,0x00,0x04,0x00,
+0x00,0x18,0x00,0x00,0x20,0x00,0xf1,0x03,0xff,0xff,0xd2,0xfe,0x88,0x87,0x2f,0xb0,
+0x00,0x02,0xfe,0x88,0x83,0x2f,0xff,0xff,0x62,0xfb,0x21,0x00,0x22,0x02,0xfb,0x28,
+0x00,0xf0,0x19,0x00,0x7d,0xfd,0x80,0x00,0x9f,0xd9,0xcf,0xa0,0x1f,0xe0,0x00,0xab,
+0x05,0xf9,0x00,0x11,0x10,0x6f,0x80,0x8f,0xff,0x25,0xf9,0x02,0x4d,0xf2,0x1f,0xe0,
+0x00,0xcf,0x20,0x9f,0xd9,0xaf,0xf1,0x00,0x7d,0xfe,0xb3,0x2d,0x00,0x61,0x9f,0x52,
+0xfb,0x00,0x09,0xf5,0x09,0x00,0x86,0xfe,0x88,0x8c,0xf5,0x2f,0xff,0xff,0xff,0x12,
+0x00,0x04,0x09,0x00,0x46,0x50,0x0f,0xd0,0xfd,0x03,0x00,0x00,0x36,0x01,0x4a,0x70,
+0x00,0x07,0xf7,0x07,0x00,0xf0,0x0c,0x8c,0x20,0x8f,0x66,0xfd,0x9f,0xf2,0x08,0xef,
+0xc4,0x00,0x2f,0xb0,0x07,0xfc,0x02,0xfb,0x04,0xfe,0x10,0x2f,0xb2,0xef,0x30,0x02,
+0xfc,0xcf,0xfa,0x00,0xf6,0x06,0xf5,0x00,0x02,0xff,0xbf,0xe1,0x00,0x2f,0xc0,0x8f,
+0xa0,0x02,0xfb,0x00,0xdf,0x50,0x2f,0xb0,0x03,0xfe,0x10,0xb4,0x00,0x0b,0x07,0x00,
+0xf0,0x48,0xfe,0x88,0x86,0x2f,0xff,0xff,0xc0,0x2f,0xf7,0x00,0x02,0xff,0x82,0xff,
+0xd0,0x00,0x7f,0xf8,0x2f,0xef,0x30,0x0d,0xef,0x82,0xfa,0xf9,0x03,0xf9,0xf8,0x2f,
+0xaa,0xe0,0x9f,0x5f,0x82,0xfa,0x4f,0x5e,0xa5,0xf8,0x2f,0xb0,0xee,0xf4,0x5f,0x82,
+0xfb,0x08,0xfe,0x05,0xf8,0x2f,0xb0,0x2f,0x80,0x5f,0x80,0x2f,0xf1,0x00,0x9f,0x52,
+0xff,0xa0,0x09,0xf5,0x2f,0xff,0x40,0x9f,0x52,0xfc,0xed,0x09,0xf5,0x2f,0xb6,0xf8,
+0x9f,0x52,0xfb,0x0c,0xfb,0xf5,0x2f,0xb0,0x2f,0xdb,0x00,0x10,0x8f,0xd2,0x00,0xf0,
+0x0b,0xdf,0x50,0x00,0x7d,0xfd,0x70,0x00,0x9f,0xda,0xdf,0x80,0x2f,0xe0,0x00,0xef,
+0x15,0xf9,0x00,0x09,0xf5,0x7f,0x70,0x00,0x8f,0x66,0xf8,0xf2,0x00,0x81,0xd0,0x00,
+0xef,0x10,0x9f,0xd9,0xdf,0x90,0x24,0x00,0xf5,0x09,0x2f,0xff,0xfd,0x70,0x2f,0xe9,
+0x9d,0xf8,0x2f,0xb0,0x01,0xfd,0x2f,0xb0,0x05,0xfc,0x2f,0xff,0xff,0xf4,0x2f,0xe8,
+0x86,0x10,0x95,0x01,0x02,0x71,0x01,0x12,0x60,0x4d,0x00,0x5f,0xd0,0x01,0xef,0x16,
+0xf8,0x4d,0x00,0x01,0xe0,0x80,0x00,0x7d,0xff,0xf3,0x00,0x00,0x00,0x3e,0xf1,0x00,
+0x00,0x00,0x13,0x56,0x00,0xe0,0x60,0x02,0xfe,0x89,0xef,0x50,0x2f,0xb0,0x05,0xf9,
+0x02,0xfb,0x00,0x8f,0xd9,0x01,0xff,0x35,0xc1,0x02,0xfe,0x8d,0xf4,0x00,0x2f,0xb0,
+0x4f,0xc0,0x02,0xfb,0x00,0xcf,0x40,0x2f,0xb0,0x04,0xfc,0x00,0x03,0xbf,0xfc,0x40,
+0x1e,0xf9,0x9f,0xf2,0x3f,0xb0,0x05,0xc5,0x0e,0xf9,0x30,0x00,0x01,0xaf,0xfd,0x40,
+0x00,0x01,0x6e,0xf3,0x7e,0x60,0x06,0xf7,0x2f,0xf9,0x8e,0xf4,0x03,0xbe,0xfd,0x50,
+0xcf,0xff,0xff,0xfc,0x68,0x8f,0xf8,0x86,0x00,0x0f,0xf0,0x00,0x04,0x00,0x05,0x4f,
+0x4f,0xa0,0x01,0xfd,0x04,0x00,0x01,0xf0,0x49,0x2f,0xc0,0x03,0xfb,0x0c,0xfb,0x9e,
+0xf5,0x01,0x9e,0xfd,0x50,0xcf,0x40,0x00,0xdf,0x46,0xf9,0x00,0x2f,0xe0,0x1f,0xe0,
+0x06,0xf8,0x00,0xbf,0x30,0xbf,0x30,0x05,0xf8,0x0f,0xd0,0x00,0x0f,0xc5,0xf7,0x00,
+0x00,0xaf,0xbf,0x20,0x00,0x04,0xff,0xc0,0x00,0x00,0x0e,0xf6,0x00,0x00,0xaf,0x30,
+0x3f,0x90,0x0d,0xf1,0x7f,0x60,0x7f,0xd0,0x0f,0xd0,0x3f,0x90,0xbf,0xf1,0x3f,0x90,
+0x0f,0xc0,0xeb,0xf5,0x6f,0x50,0x0c,0xf3,0xf5,0xe8,0x9f,0x20,0x08,0xf9,0xf1,0xac,
+0xce,0x2d,0x00,0xf0,0x25,0x6f,0xfa,0x00,0x01,0xff,0x80,0x2f,0xf7,0x00,0x00,0xdf,
+0x40,0x0e,0xf3,0x00,0x7f,0xa0,0x06,0xfc,0x00,0xdf,0x30,0xef,0x20,0x04,0xfc,0x8f,
+0x80,0x00,0x0a,0xff,0xe0,0x00,0x00,0x3f,0xf8,0x00,0x00,0x0b,0xff,0xe1,0x00,0x05,
+0xfc,0x8f,0x90,0x00,0xef,0x30,0xef,0x30,0x8f,0x24,0x00,0xf0,0x06,0xbf,0x50,0x04,
+0xfc,0x03,0xfc,0x00,0xcf,0x30,0x0a,0xf3,0x3f,0xb0,0x00,0x2f,0xba,0xf2,0x00,0x00,
+0x9f,0xfa,0xb0,0x03,0x12,0x20,0xcf,0x00,0x31,0x00,0xff,0x00,0x09,0x00,0x00,0xe8,
+0x06,0xfd,0x1a,0xf6,0x48,0x88,0x9f,0xf2,0x00,0x00,0xaf,0x60,0x00,0x06,0xfa,0x00,
+0x00,0x2f,0xe1,0x00,0x00,0xcf,0x40,0x00,0x08,0xf8,0x00,0x00,0x4f,0xf8,0x88,0x84,
+0x8f,0xff,0xff,0xf8,0x01,0x10,0x3f,0xf8,0x3f,0xb2,0x3f,0x90,0x02,0x00,0x70,0xa1,
+0x3f,0xf8,0x14,0x42,0xcf,0x10,0x0f,0x05,0xf9,0x0d,0x1f,0xd0,0x00,0x0a,0xf3,0x00,
+0x04,0xf9,0x00,0x00,0xdf,0x00,0x00,0x7f,0x60,0x00,0x1f,0xc0,0x00,0x0b,0xf2,0x00,
+0x05,0xf8,0x11,0x1e,0xfd,0x4f,0xfa,0x02,0xf0,0x33,0xfd,0x2f,0xde,0xfd,0x44,0x30,
+0x00,0x74,0x00,0x04,0xfe,0x00,0x0a,0xbf,0x50,0x1f,0x49,0xc0,0x8e,0x03,0xf3,0x22,
+0x22,0x21,0xff,0xff,0xfc,0x55,0x55,0x53,0x4f,0x90,0x05,0xf4,0x05,0xdf,0xd4,0x03,
+0xfc,0x6e,0xf1,0x25,0x20,0xaf,0x30,0x7d,0xef,0xf4,0x6f,0x92,0xaf,0x47,0xfb,0x7e,
+0xf4,0x0a,0xfd,0xaf,0x60,0x4f,0x80,0x00,0x04,0xf8,0x00,0x00,0x07,0x00,0xf0,0x15,
+0xfb,0xde,0x90,0x4f,0xf9,0xcf,0x74,0xf9,0x01,0xfc,0x4f,0x80,0x0f,0xd4,0xf8,0x01,
+0xfc,0x4f,0xf8,0xcf,0x74,0xf9,0xde,0x90,0x03,0xcf,0xd5,0x01,0xfe,0x8e,0xf2,0x7f,
+0x60,0x3b,0x48,0xf4,0x88,0x00,0xf0,0x01,0x27,0x31,0xfe,0x8d,0xf3,0x03,0xcf,0xd5,
+0x00,0x00,0x00,0x3f,0x90,0x00,0x03,0xf9,0x07,0x00,0xf0,0x0a,0x5d,0xea,0xf9,0x2f,
+0xe9,0xdf,0x97,0xf6,0x04,0xf9,0x8f,0x40,0x3f,0x97,0xf5,0x03,0xf9,0x2f,0xd6,0xcf,
+0x90,0x5d,0xe9,0xf9,0x03,0xab,0x05,0xf3,0x17,0x8c,0xf3,0x6f,0x70,0x3f,0x88,0xff,
+0xff,0xfa,0x6f,0x93,0x33,0x21,0xef,0x99,0xe4,0x02,0xbf,0xe9,0x00,0x01,0xbf,0x90,
+0x9f,0xb5,0x0c,0xf1,0x0d,0xff,0xf6,0x4d,0xf6,0x20,0xcf,0x00,0x0c,0xf0,0x00,0x05,
+0x00,0xf0,0x1b,0x04,0xde,0x9f,0xb1,0xff,0x9c,0xfb,0x6f,0x70,0x2f,0xb8,0xf4,0x02,
+0xfb,0x6f,0x60,0x2f,0xb1,0xff,0x8c,0xfb,0x04,0xde,0xaf,0xb0,0x20,0x04,0xfa,0x0d,
+0xb7,0xdf,0x40,0x7d,0xfd,0x60,0x5f,0x80,0x00,0x05,0xf8,0x00,0x00,0x07,0x00,0xf4,
+0x01,0xfa,0xcf,0xa0,0x5f,0xe8,0xcf,0x65,0xf8,0x04,0xf9,0x5f,0x80,0x3f,0x95,0xf8,
+0x03,0x07,0x00,0x83,0x2e,0x82,0xd7,0x00,0x03,0xfa,0x3f,0xa3,0x03,0x00,0x89,0x02,
+0xf8,0x02,0xd7,0x00,0x00,0x03,0xfa,0x02,0x00,0x96,0xf9,0x5c,0xf7,0x9f,0xa0,0x4f,
+0x80,0x00,0x00,0x04,0x00,0xf5,0x0b,0xbf,0x60,0x4f,0x89,0xf9,0x00,0x4f,0xef,0xb0,
+0x00,0x4f,0xff,0xc0,0x00,0x4f,0xda,0xf6,0x00,0x4f,0x81,0xef,0x20,0x4f,0x80,0x5f,
+0xb0,0x4b,0x00,0x02,0x03,0x00,0xf7,0x0c,0x4f,0x9c,0xfb,0x4d,0xfa,0x04,0xff,0x8d,
+0xff,0x9c,0xf5,0x4f,0x80,0x5f,0x80,0x5f,0x84,0xf8,0x04,0xf8,0x04,0xf8,0x4f,0x80,
+0x4f,0x80,0x4f,0x0b,0x00,0xb6,0x80,0x5f,0x9c,0xfb,0x05,0xff,0x8c,0xf6,0x5f,0x80,
+0x4f,0x9c,0x00,0x00,0x07,0x00,0x50,0x90,0x03,0xcf,0xd6,0x01,0xa7,0x07,0xf0,0x10,
+0x60,0x1f,0xc8,0xf4,0x00,0xee,0x6f,0x60,0x1f,0xc1,0xfe,0x8c,0xf5,0x03,0xcf,0xd6,
+0x00,0x4f,0xbd,0xe9,0x04,0xfe,0x7b,0xf7,0x4f,0x80,0x1f,0xc4,0xf8,0x00,0xfd,0x07,
+0x00,0x30,0xff,0x8c,0xf7,0x15,0x00,0x02,0xa5,0x01,0x00,0x07,0x00,0xd0,0x05,0xde,
+0x8f,0x92,0xfe,0x8d,0xf9,0x7f,0x60,0x3f,0x98,0xf4,0x03,0x07,0x00,0x00,0x0e,0x00,
+0x34,0x05,0xde,0xaf,0x8c,0x01,0x01,0x07,0x00,0xc2,0x04,0xfa,0xd9,0x4f,0xfc,0x64,
+0xf9,0x00,0x4f,0x80,0x04,0xf8,0x05,0x00,0xf0,0x06,0x07,0xef,0xc4,0x04,0xfb,0x5e,
+0xf0,0x5f,0xa2,0x23,0x00,0x8f,0xfe,0x60,0x24,0x04,0xdf,0x16,0xfa,0x5d,0xf1,0x18,
+0x05,0xf1,0x08,0x07,0x70,0x00,0xfe,0x00,0xff,0xff,0x15,0xff,0x50,0x0f,0xe0,0x00,
+0xfe,0x00,0x0f,0xe0,0x00,0xdf,0x81,0x05,0xee,0x10,0xb5,0x00,0x26,0x04,0xf9,0x07,
+0x00,0x00,0x67,0x00,0xf2,0x5d,0x08,0xee,0x9f,0x90,0xcf,0x20,0x9f,0x46,0xf6,0x0d,
+0xf0,0x1f,0xb2,0xfa,0x00,0xcf,0x6f,0x40,0x06,0xfe,0xf0,0x00,0x1f,0xfa,0x00,0x00,
+0xcf,0x50,0x00,0xbf,0x00,0xf9,0x08,0xf3,0x7f,0x45,0xfd,0x0b,0xf0,0x3f,0x79,0xff,
+0x2e,0xb0,0x0e,0xae,0x8f,0x9f,0x70,0x0b,0xff,0x3a,0xff,0x30,0x07,0xfe,0x06,0xff,
+0x00,0x03,0xf9,0x01,0xfb,0x00,0x7f,0x70,0xcf,0x20,0xee,0x7f,0x90,0x05,0xff,0xe1,
+0x00,0x0f,0xfa,0x00,0x07,0xff,0xf2,0x01,0xee,0x5f,0xa0,0x9f,0x60,0xbf,0x30,0xdf,
+0x20,0x9f,0x57,0xf7,0x0e,0xf0,0x2f,0xb3,0xfa,0x00,0xdf,0x8f,0x50,0x07,0xff,0xf0,
+0x00,0x2f,0x55,0x00,0xf0,0x08,0x0b,0xf0,0x00,0x29,0xf9,0x00,0x03,0xfc,0x10,0x00,
+0x7f,0xff,0xff,0x13,0x77,0xbf,0xb0,0x00,0x1e,0xe1,0x00,0x0c,0xf4,0x4d,0x03,0xf6,
+0x1b,0x04,0xff,0x87,0x71,0x8f,0xff,0xff,0x20,0x00,0x16,0x00,0x1e,0xc0,0x07,0xf3,
+0x00,0x8f,0x10,0x09,0xf1,0x01,0xce,0x00,0xbf,0x40,0x03,0xec,0x00,0x09,0xf0,0x00,
+0x8f,0x10,0x07,0xf2,0x00,0x2f,0xa0,0x00,0x39,0x00,0xe3,0x01,0x00,0xf0,0x16,0x43,
+0x00,0x8f,0x40,0x0e,0xb0,0x0c,0xd0,0x0c,0xd0,0x09,0xf3,0x01,0xef,0x08,0xf6,0x0c,
+0xe0,0x0c,0xd0,0x0d,0xc0,0x6f,0x60,0x65,0x00,0x07,0xec,0x30,0xba,0x2f,0xbc,0xf9,
+0xf7,0x2a,0x10,0x9e,0x3c,0x05,0x10,0x30,0x9d,0x07,0xf0,0x15,0x4f,0x50,0x00,0x00,
+0x00,0x04,0xee,0x40,0x0c,0xff,0xff,0xfc,0x3e,0x40,0xe4,0x22,0x22,0x00,0x4e,0x3e,
+0x20,0x00,0x00,0x00,0x8d,0xe3,0x11,0x11,0x00,0x3e,0x4d,0xff,0xff,0xfb,0x3e,0x40,
+0x21,0x00,0x10,0x50,0x2c,0x00,0x10,0x60,0x74,0x08,0x24,0x40,0x00,0x3c,0x00,0x10,
+0x5f,0x0b,0x00,0x20,0x4e,0xe4,0x05,0x00,0x11,0x3c,0x3f,0x00,0xf0,0x08,0x02,0x22,
+0x24,0xed,0x80,0x00,0x00,0x00,0x2e,0x4e,0x30,0x01,0x11,0x13,0xe0,0x4e,0x3b,0xff,
+0xff,0xfd,0x00,0x5e,0xe4,0x2c,0x00,0x11,0x6f,0x37,0x00,0x11,0x40,0x68,0x08,0x20,
+0x2b,0x20,0x24,0x00,0xf3,0x15,0xee,0x20,0x00,0x00,0x2e,0xa0,0xae,0x20,0x00,0x1d,
+0xa0,0x00,0xad,0x10,0x1d,0xd4,0x00,0x04,0xdd,0x13,0xcc,0xf2,0x02,0xfc,0xc3,0x00,
+0x0f,0x20,0x2f,0x00,0x00,0x00,0xf2,0x02,0xf0,0x00,0x0b,0x00,0xe0,0xf3,0x13,0xf0,
+0x00,0x00,0x0d,0xff,0xfd,0x00,0x00,0x00,0x0c,0xff,0xfc,0x11,0x00,0x3d,0x23,0xf0,
+0x00,0x27,0x00,0xf0,0x0a,0x33,0xf2,0x02,0xf3,0x30,0x3f,0xfd,0x10,0x1d,0xff,0x30,
+0x6e,0x30,0x00,0x3e,0x60,0x00,0x5e,0x40,0x4e,0x50,0x00,0x00,0x4e,0x8e,0x76,0x00,
+0x35,0x3c,0x30,0x00,0x01,0x00,0x11,0xa0,0x91,0x00,0x00,0xd2,0x00,0x20,0x0e,0xfe,
+0x61,0x0b,0xf0,0x15,0xf4,0xf6,0x00,0x00,0x00,0xe9,0x09,0xe0,0x00,0x00,0x7f,0x10,
+0x1f,0x70,0x00,0x1f,0x80,0x00,0x8f,0x10,0x08,0xe0,0x00,0x00,0xe8,0x01,0xfc,0x88,
+0x88,0x8c,0xf1,0x9f,0xff,0xff,0xff,0xff,0xca,0x08,0xf0,0x2e,0x3b,0xc5,0x00,0x00,
+0x02,0x1e,0x86,0xf2,0x00,0x4d,0xf7,0xf0,0x0d,0x50,0x4f,0x60,0x7f,0xb9,0xf1,0x0e,
+0x60,0x09,0xff,0xe6,0x04,0xe0,0x00,0xcf,0xa1,0xd4,0x5c,0x00,0x0e,0x60,0x0c,0x63,
+0xe0,0x01,0x20,0x00,0xe4,0x0e,0x60,0x00,0x00,0x6e,0x00,0x4f,0x70,0x00,0x7f,0x50,
+0x00,0x4d,0xfe,0xfd,0x40,0x00,0x00,0x02,0x42,0x3b,0x01,0xf0,0x0b,0x11,0x10,0x00,
+0x00,0x00,0xbf,0xff,0x72,0x00,0x08,0xc1,0xdf,0xc3,0xf5,0x04,0x98,0x02,0xe2,0x07,
+0xb4,0x5d,0x00,0x01,0x00,0x1b,0x4d,0x5f,0x00,0xf0,0x3e,0xbe,0x68,0x00,0x00,0x00,
+0x09,0x6a,0xd0,0x00,0x00,0x00,0xb9,0x1a,0xa0,0x00,0x00,0x9d,0x00,0x88,0xc4,0x25,
+0xb9,0x60,0x00,0x69,0xe9,0xf6,0x70,0x00,0x00,0x05,0x25,0x00,0x00,0x00,0x28,0x01,
+0x32,0x00,0x00,0x01,0xee,0xef,0xef,0xd5,0x00,0x0d,0x90,0xbc,0x10,0x5f,0x70,0x0b,
+0xc1,0x0b,0xd0,0x03,0xf3,0x07,0xfd,0x1a,0xc0,0x00,0x99,0x0b,0x7a,0xfc,0x10,0x00,
+0x5c,0x0b,0x60,0x61,0x00,0x00,0x5c,0x08,0xe4,0x00,0xf3,0x04,0x89,0x01,0xf4,0x00,
+0x00,0x02,0xf3,0x00,0x6f,0x60,0x00,0x5e,0x70,0x00,0x04,0xdf,0xef,0xd5,0x00,0x8a,
+0x00,0xf0,0x20,0x0c,0xee,0xee,0xee,0x10,0x01,0xfa,0x66,0x6b,0xb0,0x00,0x6f,0x10,
+0x00,0xd5,0x00,0x0b,0xb0,0x00,0x5e,0x00,0x00,0x7e,0x00,0x6d,0x40,0x00,0x2d,0xf3,
+0x7b,0x10,0x00,0x0d,0x8b,0x3d,0xd0,0x00,0x03,0xf0,0xd4,0x8e,0x30,0x00,0x3f,0x15,
+0x10,0xf3,0xc8,0x0b,0x60,0x8d,0x00,0x00,0x02,0xdf,0xfd,0xba,0x01,0x20,0x33,0x00,
+0xa8,0x00,0xc0,0xaa,0x60,0x00,0x00,0xef,0xfa,0x10,0xcb,0xbb,0xba,0xaa,0xbc,0xd8,
+0x09,0xf0,0x03,0xc0,0x5f,0xff,0xd0,0xbc,0x00,0x22,0x21,0x0c,0xc0,0x13,0x33,0x20,
+0xcc,0x05,0xee,0xec,0x0c,0x64,0x02,0xd0,0xc9,0xcb,0xde,0xed,0xb9,0x00,0x0e,0xff,
+0xa0,0x00,0x00,0x56,0x63,0x38,0x00,0xf0,0x2a,0x57,0x62,0x04,0x00,0x06,0xef,0xff,
+0xf1,0xad,0x47,0xfb,0x30,0x24,0x0a,0x39,0xfa,0x00,0x00,0x00,0xa2,0x03,0xc5,0x00,
+0x00,0x0a,0x20,0x00,0xc8,0x00,0x00,0xa2,0x00,0x98,0x00,0x00,0x0a,0x22,0xc6,0x00,
+0x00,0x00,0xa7,0xcf,0xb0,0x00,0x00,0x0a,0xa0,0x5f,0xc5,0x23,0x50,0x20,0x00,0x4d,
+0xff,0xff,0x49,0x0a,0xf0,0x19,0x54,0x00,0x89,0x99,0x99,0x99,0x8c,0x2f,0xd1,0x11,
+0x2b,0xb0,0x65,0x06,0xef,0xfb,0x0b,0x93,0xdf,0xff,0xb0,0xfd,0x00,0x69,0xdb,0x02,
+0x20,0x00,0x0b,0xb0,0xeb,0x00,0x00,0xbb,0x0f,0xd0,0x00,0x0b,0xb0,0x76,0x09,0x00,
+0x81,0xe0,0x00,0x0b,0xea,0xff,0xaa,0xaa,0xe0,0xf2,0x01,0xf0,0x2b,0x18,0xde,0xd8,
+0x10,0x00,0x3e,0xad,0x6a,0xbe,0x30,0x1e,0x70,0xc5,0x70,0x7e,0x18,0xb0,0x0c,0x57,
+0x00,0xb8,0xc5,0x00,0xbd,0x60,0x05,0xce,0x30,0x24,0x06,0x90,0x2e,0xd4,0x4b,0xe3,
+0xe7,0xc7,0xd9,0xcb,0x8b,0x04,0xc6,0xd9,0x2f,0xa9,0x00,0x00,0xbf,0x20,0x5f,0x71,
+0x01,0x7e,0x50,0x00,0x3b,0xff,0xfb,0x37,0x02,0xf2,0x32,0x20,0x00,0x00,0x03,0xbd,
+0x80,0x00,0x00,0x03,0xe6,0x4b,0xb0,0x00,0x00,0xa7,0x00,0x0f,0x12,0x62,0x0a,0x60,
+0x00,0xe7,0xff,0xf4,0x6d,0x10,0x6d,0xbf,0xff,0xb0,0x9f,0xef,0x7a,0xff,0xfa,0x07,
+0xe9,0xcf,0xff,0xfe,0x23,0xe1,0x4f,0xff,0xff,0xe1,0x96,0x1e,0xff,0xff,0xff,0x8c,
+0x38,0xff,0xff,0xff,0xfb,0xcf,0xfd,0xdd,0xdd,0xdd,0x90,0x11,0x77,0x02,0x20,0x61,
+0x00,0x6b,0x03,0x11,0xd2,0x06,0x00,0xf1,0x05,0xe3,0x00,0x02,0x43,0x33,0x37,0xe3,
+0x00,0xaf,0xff,0xff,0xff,0xf4,0x03,0x66,0x66,0x66,0x66,0x60,0x09,0x67,0x02,0x90,
+0x08,0xf9,0x88,0x88,0x95,0x00,0x07,0xd1,0x00,0x99,0x02,0x01,0x06,0x00,0x25,0x05,
+0x90,0xb9,0x02,0x20,0x68,0x50,0xc1,0x01,0xf0,0x24,0x48,0xc9,0x10,0x00,0x00,0x8c,
+0xa4,0x4c,0x30,0x00,0x03,0x22,0x8b,0x20,0x00,0x00,0x5a,0xc5,0x10,0x00,0x06,0x86,
+0x97,0x30,0x00,0x1c,0xb0,0x10,0xab,0x00,0x0a,0xf2,0x7f,0x82,0xf9,0x00,0xaf,0x29,
+0xfa,0x1f,0x90,0x01,0xda,0x04,0x09,0xd1,0x00,0x01,0x8b,0x9a,0x81,0x76,0x02,0xfa,
+0x0a,0xfd,0x10,0x0d,0x63,0x36,0x9d,0x10,0xd3,0x00,0xb0,0xbd,0x0d,0x30,0x0a,0xc9,
+0xe3,0xd3,0x00,0x00,0x0d,0x3d,0x30,0x00,0x00,0xd3,0x09,0x00,0x60,0x40,0x00,0x00,
+0xd3,0xcf,0xff,0x74,0x04,0x01,0xbc,0x0b,0x10,0x53,0x06,0x00,0xf0,0x2b,0xa9,0x6a,
+0x90,0x00,0x00,0x06,0x70,0x00,0x8d,0xc7,0x00,0x0a,0x10,0x00,0x00,0x09,0x40,0x1d,
+0x10,0x00,0x47,0x33,0x90,0xa3,0x38,0xcf,0xda,0x33,0x80,0xc0,0x68,0x58,0x00,0x04,
+0xb0,0xb0,0x00,0x4f,0x90,0x00,0xa2,0xa1,0x00,0xdf,0xf3,0x00,0x83,0x2c,0x20,0x00,
+0x00,0x01,0xc0,0x02,0xbb,0xbb,0xbb,0xbb,0x3f,0x01,0x11,0x4d,0xf2,0x00,0xf0,0x1b,
+0xf0,0x87,0x00,0x00,0x00,0x7f,0x2f,0x40,0x19,0xd8,0x6e,0xae,0x30,0x0a,0xb3,0x7b,
+0x60,0xd4,0x01,0xf1,0x00,0x9b,0x4f,0x20,0x5b,0x00,0x01,0xbf,0x60,0x08,0x70,0x00,
+0x04,0xf0,0x00,0xa5,0x00,0x00,0x4f,0x00,0x0c,0x30,0x0b,0x00,0x10,0xe2,0x0b,0x00,
+0x02,0x01,0x00,0xf0,0x3a,0x07,0xe8,0x01,0xe0,0xd2,0x1e,0x0d,0x20,0x8e,0x80,0x00,
+0x10,0x0d,0xf9,0x1f,0xfd,0x0b,0xf7,0x01,0x00,0x00,0x01,0xfb,0x50,0x00,0x07,0xcf,
+0xe8,0x20,0x00,0x4e,0xf7,0x08,0xdf,0xd8,0x11,0xfa,0x40,0x00,0x09,0x88,0x88,0x31,
+0xff,0xff,0xf6,0x00,0x00,0x10,0x0c,0x20,0x02,0xee,0xef,0xb0,0xe3,0x00,0x00,0x00,
+0xa8,0x0e,0x40,0x00,0x00,0x0f,0x30,0xe4,0x00,0x00,0x08,0xb0,0x0e,0x63,0x0b,0x03,
+0xf1,0x02,0xed,0xc3,0x00,0xd7,0x00,0x0e,0x30,0x00,0xba,0x00,0x00,0xe3,0x00,0x69,
+0x00,0x00,0x0e,0x92,0x04,0x01,0xa2,0x04,0x80,0x0e,0x40,0x00,0x00,0x00,0x00,0xc3,
+0x00,0x11,0x00,0x01,0x00,0xf0,0x24,0x34,0x44,0x00,0xe1,0x00,0x1c,0xcb,0xe8,0x0f,
+0x20,0x00,0x00,0x0e,0x50,0xf2,0x00,0x00,0x05,0xe0,0x0f,0x20,0x00,0x01,0xe5,0x00,
+0xff,0xf2,0x02,0xd7,0x00,0x0f,0x41,0x04,0xe6,0x00,0x00,0xf2,0x00,0x11,0x00,0x00,
+0x0f,0x20,0x00,0x0d,0x20,0x00,0x90,0x00,0x00,0xf3,0x37,0x00,0xb2,0x0f,0x41,0x11,
+0x10,0x00,0x00,0xcf,0xff,0xfe,0x40,0x00,0x01,0x00,0x80,0x45,0x56,0x10,0xe1,0x00,
+0x1a,0xaa,0xe7,0x48,0x00,0xf0,0x15,0x2f,0x20,0xf5,0x30,0x00,0x0b,0xa0,0x0f,0xdc,
+0x10,0x0b,0xc0,0x00,0xf2,0x00,0x3e,0xa0,0x00,0x0f,0x20,0x02,0x30,0x11,0x11,0x40,
+0x00,0x01,0xff,0xff,0xff,0x20,0x00,0x00,0x00,0x01,0xf2,0x0b,0x00,0xd3,0xfe,0x10,
+0x00,0x2f,0x10,0x00,0x10,0x00,0x01,0xef,0xff,0xff,0x50,0x48,0x00,0xf0,0x21,0x11,
+0x10,0x0a,0x10,0x01,0xef,0xef,0x80,0xf2,0x00,0x00,0x00,0xd6,0x0f,0x30,0x00,0x00,
+0x4f,0x10,0xff,0xf2,0x00,0x1e,0x70,0x0f,0x20,0x00,0x5e,0x80,0x00,0xf2,0x00,0x4b,
+0x30,0x00,0x07,0x00,0x00,0x0d,0xee,0xee,0xd1,0x00,0x02,0xf4,0x22,0x2f,0x20,0x42,
+0x00,0xf5,0x40,0xf2,0x00,0x02,0xf1,0x00,0x1f,0x20,0x00,0x0e,0xff,0xff,0xd0,0x00,
+0x02,0x33,0x40,0x0b,0x30,0x01,0xcc,0xce,0x80,0xd5,0x00,0x00,0x00,0xe5,0x0c,0x50,
+0x00,0x00,0x6e,0x00,0xcf,0xe2,0x00,0x3f,0x50,0x0c,0x62,0x00,0x8f,0x60,0x00,0xc5,
+0x00,0x39,0x10,0x00,0x07,0x20,0x00,0x29,0x09,0x20,0xb0,0x00,0x04,0xe1,0xd4,0x3e,
+0x00,0x00,0x4f,0xff,0x46,0xf2,0x00,0x04,0xd0,0xd4,0xdc,0xb0,0x00,0x3f,0xff,0x8b,
+0x0c,0x40,0x8a,0x00,0x20,0x0b,0x20,0x8a,0x00,0x10,0xf3,0x48,0x00,0x00,0x8a,0x00,
+0xf0,0x20,0x4e,0x00,0xff,0xf3,0x00,0x2e,0x50,0x0f,0x51,0x00,0x4e,0x60,0x00,0xf3,
+0x00,0x4d,0x30,0x00,0x0e,0x20,0x00,0x00,0x7c,0xda,0x20,0x00,0x00,0x8d,0x43,0x8e,
+0x10,0x00,0x0d,0x50,0x00,0xe4,0x00,0x00,0xba,0x00,0x3f,0x20,0x00,0x02,0xdf,0xee,
+0x60,0x43,0x00,0x00,0xeb,0x00,0x80,0x12,0x20,0x0b,0x10,0x02,0xee,0xef,0x70,0xd2,
+0x00,0xf0,0x0a,0xe4,0x0f,0x31,0x00,0x00,0x8c,0x00,0xff,0xe2,0x00,0x5f,0x20,0x0f,
+0x20,0x00,0x9e,0x30,0x00,0xf2,0x00,0x48,0x10,0x00,0x06,0x00,0xbc,0x00,0xf1,0x02,
+0xf2,0x00,0x01,0xf3,0x22,0x22,0x00,0x00,0x1f,0xff,0xff,0xf1,0x00,0x01,0xf1,0x00,
+0x00,0x0b,0x00,0x28,0xf5,0x00,0x01,0x00,0xf2,0x23,0x11,0x11,0xb0,0xe2,0x3e,0xef,
+0xe2,0xe0,0xf3,0x00,0x06,0xc2,0xe0,0xe3,0x00,0x09,0x92,0xe0,0xe3,0x00,0x0e,0x42,
+0xfc,0xf3,0x00,0x5e,0x02,0xe4,0xf3,0x00,0xd6,0x02,0xe0,0xe3,0x09,0xc0,0x02,0xe0,
+0xe3,0x4e,0x10,0x02,0xe0,0xe3,0x11,0x00,0x02,0xe0,0xe3,0x00,0x05,0x00,0xf3,0x34,
+0x00,0x70,0xa1,0x00,0x01,0x10,0x70,0x91,0x2f,0xee,0xf1,0xf1,0xe3,0x00,0x05,0xe0,
+0xf2,0xe3,0x00,0x0c,0x70,0xff,0xf3,0x00,0x9c,0x00,0xf1,0xe3,0x0a,0xc1,0x00,0xf1,
+0xe3,0x37,0x00,0x00,0x80,0xc2,0x00,0x00,0x7b,0xb7,0x00,0x00,0x09,0xd5,0x4b,0xb0,
+0x00,0x0f,0x40,0x01,0xf0,0x00,0x0d,0x80,0x06,0xe0,0x00,0x03,0xde,0xed,0x40,0x00,
+0x00,0x01,0x10,0x81,0x00,0xf0,0x26,0x12,0x10,0x4c,0x0d,0xee,0xee,0x05,0xd0,0x00,
+0x07,0xb0,0x5d,0x00,0x00,0xd6,0x05,0xd0,0x00,0x5e,0x58,0xad,0x00,0x1e,0x54,0x8a,
+0xd0,0x0b,0xa0,0x00,0x4d,0x09,0xc0,0x00,0x04,0xd3,0xb0,0x00,0x00,0x4d,0x00,0x00,
+0x00,0x04,0xd0,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x02,0x80,0x3a,0x00,0xf0,0x21,
+0x10,0x00,0x11,0x20,0x03,0xe0,0x0d,0xee,0xeb,0x03,0xf0,0x00,0x00,0x99,0x02,0xf0,
+0x00,0x00,0xe7,0xbc,0xf0,0x00,0x09,0xb0,0x46,0xf0,0x00,0xac,0x10,0x02,0xf0,0x0d,
 0xa1,0x00,0x02,0xf0,0x03,0x00,0x00,0x03,0xe0,0x00,0x4c,0x00,0x01,0xb0,0x00,0x5d,
-0x34,0x00,0x10,0x5d,0x78,0x00,0xf1,0x2c,0x3f,0xff,0xff,0xe0,0x00,0x01,0x10,0x0c,
+0x34,0x00,0x10,0x5d,0x78,0x00,0xf1,0x2b,0x3f,0xff,0xff,0xe0,0x00,0x01,0x10,0x0c,
 0x21,0xff,0xef,0x70,0xe4,0x00,0x00,0xe6,0x1e,0x40,0x00,0x5e,0xcf,0xf4,0x00,0x1e,
 0x50,0x0d,0x30,0x4e,0x70,0x00,0xe3,0x4d,0x40,0x00,0x0c,0x20,0x0a,0xee,0xee,0xd2,
 0x00,0xd7,0x22,0x2f,0x40,0x0d,0x50,0x00,0xe3,0x00,0xd6,0x00,0x0e,0x30,0x0a,0xff,
-0xff,0xe1,0x00,0x3d,0x10,0xf0,0x1e,0x22,0x10,0xb1,0xd2,0x2e,0xef,0xb0,0xe2,0xe3,
+0xff,0xe1,0xb2,0x00,0xf0,0x1f,0x01,0x22,0x10,0xb1,0xd2,0x2e,0xef,0xb0,0xe2,0xe3,
 0x00,0x0b,0x90,0xe2,0xe3,0x00,0x0e,0x60,0xe2,0xe3,0x00,0x3f,0x9c,0xf2,0xe3,0x00,
 0x8b,0x24,0xe2,0xe3,0x01,0xf3,0x00,0xe2,0xe3,0x0b,0xa0,0x00,0xe2,0xe3,0x6d,0x00,
 0x00,0xe2,0xe3,0x11,0x05,0x00,0x13,0x00,0x05,0x00,0xf7,0x2f,0x60,0x81,0x03,0x44,
@@ -566,1487 +611,1632 @@ static const uint8_t lz4FontData[] ={
 0x05,0xb3,0x7d,0x00,0x00,0xd7,0xce,0xd0,0x00,0x5e,0x00,0x5d,0x00,0x1e,0x50,0x16,
 0xd0,0x0b,0xa0,0x9f,0xfd,0x34,0x01,0x04,0xf0,0x0e,0x01,0x22,0x30,0x02,0xa1,0xdd,
 0xdf,0x81,0x5d,0x00,0x00,0xe4,0xdf,0xd0,0x00,0x6d,0x00,0x4d,0x00,0x3e,0x46,0xff,
-0xd0,0x6e,0x40,0x01,0x5d,0x4a,0x10,0x29,0x00,0x80,0x22,0x22,0x32,0x00,0x9e,0xdd,
-0xde,0xe0,0xbe,0x0b,0x00,0xc3,0x04,0x10,0xf0,0xfe,0x0d,0x10,0x00,0xc8,0x05,0xf0,
-0x10,0x16,0x67,0x71,0x09,0x33,0xdd,0xcf,0x63,0xd6,0x00,0x04,0xf4,0xdf,0x60,0x01,
-0xd7,0x00,0xc6,0x01,0xca,0x0b,0xff,0x64,0xe7,0x00,0x01,0xd5,0x21,0x01,0x11,0x15,
-0x6d,0x02,0x70,0xf3,0x00,0x01,0x11,0x1e,0x40,0x0d,0x76,0x02,0x11,0xe5,0x6f,0x08,
-0x21,0xff,0xf9,0xac,0x00,0xf0,0x0e,0x02,0x44,0x42,0x03,0xc0,0xbc,0xbe,0xb0,0x5e,
-0x00,0x00,0xc7,0xcf,0xe0,0x00,0x3f,0x20,0x4e,0x00,0x1d,0x76,0xff,0xe0,0x4e,0x80,
-0x01,0x5e,0x2d,0x40,0x76,0x00,0x90,0x2a,0xdc,0x72,0x00,0x1e,0x72,0x4d,0x90,0x06,
-0xc5,0x00,0xb3,0x4f,0x20,0x0a,0xc0,0x00,0x8f,0xef,0xc2,0x00,0x00,0x01,0xec,0x00,
-0x61,0x01,0x23,0x10,0xb1,0xd2,0x3e,0x6e,0x01,0xf0,0x14,0x0c,0xb5,0xf2,0xe3,0x00,
-0x0f,0xab,0xf2,0xe4,0x00,0x4f,0x10,0xe2,0xe4,0x00,0x9b,0x23,0xe2,0xe4,0x02,0xf3,
-0xcd,0xf2,0xe4,0x0c,0x90,0x00,0xe2,0xe4,0x7c,0x00,0x00,0xe3,0xe4,0x20,0x05,0x00,
-0x13,0x00,0x05,0x00,0x60,0x50,0x81,0x04,0xee,0xef,0xfc,0xe3,0x02,0x01,0x12,0x05,
-0x13,0x4e,0x05,0x00,0xf0,0x17,0x05,0xc0,0x5d,0x00,0x00,0x06,0xd0,0x6a,0x00,0x00,
-0x06,0xc0,0x00,0x00,0x12,0x27,0xd2,0x22,0x21,0xbe,0xee,0xee,0xee,0xfa,0x01,0xcd,
-0xdd,0xdc,0x00,0x00,0x33,0x33,0x4f,0x10,0x00,0x00,0x20,0x1f,0x38,0x02,0x10,0x2f,
-0x04,0x01,0xf4,0x07,0x05,0x00,0x9c,0xcd,0xfc,0xcc,0xc9,0x24,0x44,0x44,0x44,0x42,
-0x00,0x11,0x11,0x11,0x00,0x02,0xff,0xff,0xef,0x30,0xf7,0x04,0x01,0x05,0x00,0x25,
-0x0a,0x20,0x3c,0x00,0xa0,0x20,0x00,0x00,0x20,0x0f,0x10,0x00,0x03,0xe0,0x1f,0x3c,
-0x00,0xf0,0x08,0x03,0x00,0x8d,0xde,0xfd,0xdd,0xd8,0x13,0x33,0x33,0x33,0x31,0x00,
-0x80,0x00,0x07,0x10,0x01,0xf1,0x11,0x1e,0x30,0x01,0x41,0x00,0x50,0x01,0xf0,0x00,
-0x0e,0x30,0xbe,0x04,0x02,0x07,0x03,0x0a,0x7d,0x00,0x05,0x41,0x00,0x40,0x05,0x00,
-0x8d,0xdd,0x41,0x00,0xf0,0x01,0x32,0x22,0x22,0x31,0x00,0x08,0xcc,0x91,0x00,0x00,
-0xbc,0x33,0xad,0x00,0x00,0xf4,0x9d,0x04,0x83,0xd8,0x00,0x6f,0x00,0x00,0x3d,0xee,
-0xd4,0x17,0x04,0x04,0x1b,0x02,0x61,0x00,0xe2,0x00,0x03,0xff,0xff,0xc6,0x05,0x21,
-0x05,0xd0,0x06,0x00,0xf2,0x15,0xc0,0xe4,0x00,0x00,0x0e,0x06,0xb0,0xe5,0x10,0x00,
-0x0f,0x17,0xa0,0xef,0xe3,0x00,0x0f,0x18,0x80,0xe4,0x00,0x00,0x0f,0x11,0x11,0xe4,
-0x00,0x0c,0xdf,0xde,0xf9,0xe4,0x00,0x02,0x33,0x21,0xca,0x05,0x23,0x00,0xe4,0x70,
-0x07,0x81,0x02,0x33,0x41,0x0a,0x10,0x00,0xbd,0xcd,0x41,0x00,0xf4,0x09,0x4e,0x0e,
-0x30,0x00,0x07,0x34,0xe0,0xe4,0x00,0x00,0xb6,0x3c,0x0e,0xca,0x10,0x0b,0x71,0x43,
-0xe8,0x40,0xaf,0xff,0xec,0x7e,0x02,0x06,0x70,0x74,0x00,0x0d,0x30,0x00,0x0c,0x60,
-0x0e,0x00,0xe0,0xc7,0x11,0x11,0x00,0x00,0x09,0xff,0xff,0xe7,0x00,0x04,0xee,0xef,
-0xfd,0x7b,0x01,0x20,0x2f,0x10,0x76,0x04,0x10,0x00,0x4c,0x13,0xa0,0x00,0x00,0x68,
-0x1c,0x4e,0x00,0x00,0x8a,0x3f,0x39,0x05,0x00,0xf3,0x07,0x00,0x00,0x01,0x9a,0x4f,
-0x22,0x20,0xaf,0xfe,0xee,0xff,0xfa,0x00,0x11,0x11,0x10,0x00,0x04,0xff,0xff,0xfe,
-0x00,0x7b,0x02,0x02,0x05,0x00,0x01,0x7c,0x02,0xc3,0x27,0x00,0xce,0xee,0xee,0xef,
-0xf9,0x12,0x22,0xe5,0x11,0x10,0xa1,0x00,0x06,0x05,0x00,0x65,0x81,0x00,0x00,0x02,
-0xcc,0xcd,0x3a,0x01,0x02,0x69,0x00,0x11,0x1f,0x80,0x07,0x01,0x22,0x08,0x40,0xfa,
-0x00,0x00,0x9a,0x15,0x01,0x52,0x9a,0x22,0x00,0x03,0xef,0xb7,0x01,0x24,0x0f,0x40,
-0x05,0x00,0x20,0x0e,0x30,0x9f,0x02,0x10,0x00,0x60,0x00,0x70,0x50,0x00,0x01,0x22,
-0x22,0xc7,0x00,0xb8,0x02,0x10,0x70,0x06,0x00,0xf0,0x02,0x94,0x00,0x02,0x22,0x22,
-0x22,0x22,0x06,0xdd,0xee,0xfd,0xdd,0xc0,0x00,0x11,0x4e,0x11,0x0b,0x14,0x20,0x9e,
-0xfd,0x36,0x0b,0xb0,0x03,0xe0,0x00,0x3f,0xff,0x10,0x3e,0x00,0x04,0xe0,0x00,0x0b,
+0xd0,0x6e,0x40,0x01,0x5d,0x4a,0x10,0x29,0x00,0xf0,0x00,0x22,0x22,0x32,0x00,0x9e,
+0xdd,0xde,0xe0,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x57,0x01,0x20,0x00,0x3e,0x70,
+0x00,0xf0,0x11,0x20,0x16,0x67,0x71,0x09,0x33,0xdd,0xcf,0x63,0xd6,0x00,0x04,0xf4,
+0xdf,0x60,0x01,0xd7,0x00,0xc6,0x01,0xca,0x0b,0xff,0x64,0xe7,0x00,0x01,0xd5,0x21,
+0x01,0x11,0x15,0x6d,0x02,0x70,0xf3,0x00,0x01,0x11,0x1e,0x40,0x0d,0x76,0x02,0x81,
+0xe5,0x00,0x00,0x00,0x0c,0xff,0xff,0xf9,0xac,0x00,0xf0,0x0e,0x02,0x44,0x42,0x03,
+0xc0,0xbc,0xbe,0xb0,0x5e,0x00,0x00,0xc7,0xcf,0xe0,0x00,0x3f,0x20,0x4e,0x00,0x1d,
+0x76,0xff,0xe0,0x4e,0x80,0x01,0x5e,0x2d,0x40,0x76,0x00,0x90,0x2a,0xdc,0x72,0x00,
+0x1e,0x72,0x4d,0x90,0x06,0xc5,0x00,0xb3,0x4f,0x20,0x0a,0xc0,0x00,0x8f,0xef,0xc2,
+0x00,0x00,0x01,0xec,0x00,0x61,0x01,0x23,0x10,0xb1,0xd2,0x3e,0x6e,0x01,0xf0,0x14,
+0x0c,0xb5,0xf2,0xe3,0x00,0x0f,0xab,0xf2,0xe4,0x00,0x4f,0x10,0xe2,0xe4,0x00,0x9b,
+0x23,0xe2,0xe4,0x02,0xf3,0xcd,0xf2,0xe4,0x0c,0x90,0x00,0xe2,0xe4,0x7c,0x00,0x00,
+0xe3,0xe4,0x20,0x05,0x00,0x13,0x00,0x05,0x00,0x60,0x50,0x81,0x04,0xee,0xef,0xfc,
+0xe3,0x02,0x10,0x4f,0x49,0x00,0x13,0x4e,0x05,0x00,0xf0,0x17,0x05,0xc0,0x5d,0x00,
+0x00,0x06,0xd0,0x6a,0x00,0x00,0x06,0xc0,0x00,0x00,0x12,0x27,0xd2,0x22,0x21,0xbe,
+0xee,0xee,0xee,0xfa,0x01,0xcd,0xdd,0xdc,0x00,0x00,0x33,0x33,0x4f,0x10,0x00,0x00,
+0x20,0x1f,0x38,0x02,0x10,0x2f,0x04,0x01,0xf4,0x0c,0x05,0x00,0x9c,0xcd,0xfc,0xcc,
+0xc9,0x24,0x44,0x44,0x44,0x42,0x00,0x11,0x11,0x11,0x00,0x02,0xff,0xff,0xef,0x30,
+0x00,0x00,0x00,0x0e,0x40,0x05,0x00,0x25,0x0a,0x20,0x3c,0x00,0xa0,0x20,0x00,0x00,
+0x20,0x0f,0x10,0x00,0x03,0xe0,0x1f,0x3c,0x00,0xf0,0x08,0x03,0x00,0x8d,0xde,0xfd,
+0xdd,0xd8,0x13,0x33,0x33,0x33,0x31,0x00,0x80,0x00,0x07,0x10,0x01,0xf1,0x11,0x1e,
+0x30,0x01,0x41,0x00,0x50,0x01,0xf0,0x00,0x0e,0x30,0xbe,0x04,0x02,0x07,0x03,0x0a,
+0x7d,0x00,0x05,0x41,0x00,0x40,0x05,0x00,0x8d,0xdd,0x41,0x00,0xf0,0x01,0x32,0x22,
+0x22,0x31,0x00,0x08,0xcc,0x91,0x00,0x00,0xbc,0x33,0xad,0x00,0x00,0xf4,0x9d,0x04,
+0x83,0xd8,0x00,0x6f,0x00,0x00,0x3d,0xee,0xd4,0x17,0x04,0x04,0x1b,0x02,0x70,0x00,
+0xe2,0x00,0x03,0xff,0xff,0xb0,0x6f,0x02,0x21,0x05,0xd0,0x06,0x00,0xf1,0x17,0xc0,
+0xe4,0x00,0x00,0x0e,0x06,0xb0,0xe5,0x10,0x00,0x0f,0x17,0xa0,0xef,0xe3,0x00,0x0f,
+0x18,0x80,0xe4,0x00,0x00,0x0f,0x11,0x11,0xe4,0x00,0x0c,0xdf,0xde,0xf9,0xe4,0x00,
+0x02,0x33,0x21,0x00,0xe4,0x3e,0x00,0x02,0x06,0x00,0xa1,0x61,0x00,0x02,0x33,0x41,
+0x0a,0x10,0x00,0xbd,0xcd,0x41,0x00,0xf3,0x0a,0x4e,0x0e,0x30,0x00,0x07,0x34,0xe0,
+0xe4,0x00,0x00,0xb6,0x3c,0x0e,0xca,0x10,0x0b,0x71,0x43,0xe8,0x40,0xaf,0xff,0xec,
+0x7e,0x40,0x32,0x00,0x70,0x74,0x00,0x0d,0x30,0x00,0x0c,0x60,0x0e,0x00,0xe0,0xc7,
+0x11,0x11,0x00,0x00,0x09,0xff,0xff,0xe7,0x00,0x04,0xee,0xef,0xfd,0x7b,0x01,0x20,
+0x2f,0x10,0x76,0x04,0x00,0x1c,0x00,0xb0,0x2f,0x00,0x00,0x68,0x1c,0x4e,0x00,0x00,
+0x8a,0x3f,0x39,0x05,0x00,0xf3,0x07,0x00,0x00,0x01,0x9a,0x4f,0x22,0x20,0xaf,0xfe,
+0xee,0xff,0xfa,0x00,0x11,0x11,0x10,0x00,0x04,0xff,0xff,0xfe,0x00,0x7b,0x02,0x02,
+0x05,0x00,0x01,0x7c,0x02,0xc3,0x27,0x00,0xce,0xee,0xee,0xef,0xf9,0x12,0x22,0xe5,
+0x11,0x10,0xa1,0x00,0x06,0x05,0x00,0x65,0x81,0x00,0x00,0x02,0xcc,0xcd,0x3a,0x01,
+0x02,0x69,0x00,0x01,0x05,0x00,0xa0,0x03,0x00,0xaf,0xff,0xff,0xff,0xfa,0x00,0x00,
+0x9a,0x15,0x01,0x52,0x9a,0x22,0x00,0x03,0xef,0xb7,0x01,0x24,0x0f,0x40,0x05,0x00,
+0x20,0x0e,0x30,0x9f,0x02,0x10,0x00,0x60,0x00,0x70,0x50,0x00,0x01,0x22,0x22,0xc7,
+0x00,0xb8,0x02,0x10,0x70,0x06,0x00,0xf0,0x17,0x94,0x00,0x02,0x22,0x22,0x22,0x22,
+0x06,0xdd,0xee,0xfd,0xdd,0xc0,0x00,0x11,0x4e,0x11,0x00,0x00,0x2f,0xff,0x9e,0xfd,
+0x00,0x00,0x00,0xf2,0x03,0xe0,0x00,0x3f,0xff,0x10,0x3e,0x00,0x04,0xe0,0x00,0x0b,
 0x00,0x3a,0xee,0x90,0x3d,0x50,0x05,0x60,0x10,0x06,0xc0,0x0b,0xee,0xee,0x5b,0x02,
-0x30,0x3e,0x05,0xc0,0x2f,0x2d,0xf1,0x0d,0xc0,0x24,0x44,0x6a,0x75,0xc0,0x6a,0xcf,
-0x97,0x46,0xc0,0x00,0x5e,0x0a,0xff,0xc0,0x00,0x16,0x00,0x16,0xc0,0x00,0x43,0x00,
-0x04,0xa0,0x00,0xa8,0x24,0x08,0x30,0x11,0x11,0x10,0x18,0x10,0x00,0x80,0x03,0xf4,
-0x19,0x02,0xa0,0x8e,0xee,0xf2,0x3e,0x00,0x00,0x0f,0x32,0xf0,0x00,0x00,0xf3,0x2f,
-0x00,0x00,0x1f,0x12,0xf0,0x00,0x00,0xa2,0x2f,0x3d,0xdd,0xef,0xd4,0xf0,0x22,0xe5,
-0x00,0x2f,0x00,0x0e,0x40,0x02,0xf0,0x00,0xe4,0x09,0x00,0x00,0xbc,0x06,0x00,0x3f,
-0x00,0x42,0x05,0xff,0xff,0xfc,0xdf,0x04,0x04,0x05,0x00,0x10,0x6c,0x05,0x00,0xf7,
-0x02,0x36,0x00,0xae,0xee,0xee,0xff,0xfa,0x01,0x5e,0x11,0xf4,0x10,0x00,0x4e,0x00,
-0xe3,0x00,0x05,0x00,0x30,0x17,0x00,0x71,0x37,0x01,0x61,0x43,0x00,0x02,0xcc,0xcc,
-0xcf,0x3c,0x01,0x05,0x41,0x01,0x30,0x1d,0x00,0xbf,0x3c,0x01,0xe2,0x01,0x13,0xf1,
-0xc7,0x10,0x00,0x12,0xf0,0xc6,0x00,0x01,0xf2,0x90,0x73,0x41,0x06,0x20,0x01,0xf2,
-0xe2,0x01,0x80,0xef,0xff,0xff,0x70,0x03,0xee,0xef,0xfa,0xe1,0x01,0x15,0x6d,0x6e,
-0x00,0x20,0x7b,0x00,0x3b,0x0b,0x00,0x05,0x00,0x12,0x75,0x0c,0x01,0x51,0x9d,0xdd,
-0xdd,0xdd,0xd9,0xfd,0x02,0x40,0x01,0xcc,0xcd,0xdb,0x6e,0x00,0x15,0x6f,0xdc,0x01,
-0x11,0x3d,0x1c,0x04,0x00,0xa0,0x00,0x20,0xee,0xea,0x6c,0x01,0xb8,0x20,0x02,0xbb,
-0xbb,0xcc,0x20,0x00,0x44,0x44,0x4f,0x40,0xa5,0x01,0x00,0xdf,0x0a,0x8a,0x12,0x22,
-0x31,0x00,0x01,0xdd,0xdd,0xee,0x1d,0x02,0x70,0x3d,0x00,0x13,0x33,0x33,0x35,0x31,
-0x64,0x00,0x12,0xd8,0x1f,0x0d,0x15,0xf3,0x05,0x00,0x14,0xf4,0xa5,0x00,0x31,0x01,
-0xee,0xee,0x86,0x02,0x12,0x3f,0x81,0x02,0x00,0x43,0x0d,0xd2,0x00,0x12,0x11,0x11,
-0x12,0x21,0x9e,0xee,0xee,0xee,0xd8,0x00,0x01,0xcf,0x03,0x11,0xff,0x0e,0x02,0x10,
-0x50,0x0a,0x00,0x11,0x30,0xf5,0x04,0x00,0x0a,0x00,0x12,0x70,0x98,0x03,0x03,0xb9,
-0x00,0x1a,0x5f,0x95,0x02,0x03,0xb9,0x00,0x9f,0x01,0x11,0x11,0x11,0x20,0x00,0xa0,
-0x00,0x08,0xd9,0x03,0x07,0x02,0x46,0x00,0xc0,0x12,0x10,0x3d,0x0b,0xee,0xef,0x14,
-0xe0,0x00,0x04,0xe0,0x4d,0x63,0x2f,0xf2,0x05,0xd0,0x00,0x2f,0x20,0x4d,0x00,0x0c,
-0x80,0x04,0xd0,0x08,0xc0,0x00,0x4d,0x07,0xe2,0x00,0x04,0xd0,0xc2,0x14,0x01,0x23,
-0x03,0xd0,0xf9,0x09,0x00,0xb0,0x05,0xf0,0x13,0x20,0x07,0x41,0xed,0xdf,0x90,0xb7,
-0x00,0x00,0xe6,0x0b,0x70,0x00,0x8d,0x00,0xb7,0x00,0x8e,0x30,0x0a,0x72,0xea,0x10,
-0x00,0xa6,0x02,0x11,0x11,0x25,0x10,0x0d,0xff,0xfe,0xf5,0xae,0x01,0x20,0x50,0x0a,
-0x7e,0x05,0x21,0xb8,0x00,0x7a,0x03,0x13,0xf8,0x72,0x00,0xf0,0x19,0x10,0x07,0x41,
-0xff,0xef,0x80,0xb6,0x00,0x00,0xe5,0x0b,0x60,0x00,0x5e,0x00,0xb6,0x00,0x3f,0x40,
-0x0b,0x60,0x6e,0x50,0x00,0xb6,0x4b,0x20,0x00,0x08,0x40,0x0a,0x20,0x00,0x83,0x00,
-0xe5,0x11,0x1c,0x50,0x0e,0x44,0x00,0x50,0xe3,0x00,0x0c,0x50,0x0d,0x44,0x00,0x02,
-0x3a,0x00,0xf0,0x1e,0x11,0x04,0xb0,0x08,0xef,0x9f,0xf1,0x5d,0x00,0x01,0xf1,0x2f,
-0x05,0xd0,0x00,0x4d,0x05,0xe0,0x4d,0x00,0x08,0x90,0x8b,0x04,0xfe,0xb0,0xd5,0x0b,
-0x80,0x4d,0x20,0x4e,0x01,0xf2,0x04,0xd0,0x0c,0x60,0x7c,0x00,0x4d,0x00,0x20,0x0e,
-0x30,0x60,0x06,0x13,0x20,0xaa,0x0a,0x10,0xd0,0x06,0x00,0x12,0x16,0x81,0x00,0xf0,
-0x19,0x12,0x02,0x10,0x2e,0x7e,0xf8,0xef,0x23,0xf0,0x1f,0x01,0xf1,0x3e,0x04,0xd0,
-0x4e,0x03,0xe0,0x89,0x08,0xac,0xfe,0x0d,0x40,0xd6,0x14,0xe4,0xe0,0x3f,0x00,0x3e,
-0xc5,0x0b,0x80,0x03,0xe1,0x03,0xe0,0x00,0x2e,0x65,0x19,0x13,0xe0,0x57,0x01,0xf3,
-0x03,0x01,0x90,0x00,0x13,0x30,0x23,0x20,0x00,0x0c,0xdf,0x7b,0xdf,0x10,0x00,0x00,
-0xc6,0x01,0xf1,0xa1,0x0e,0x90,0x04,0xe0,0x03,0xe0,0x00,0x00,0x56,0x00,0x28,0xa8,
-0x09,0x60,0xee,0xff,0x70,0x12,0x22,0xd6,0x0d,0x04,0x11,0x0d,0xe4,0x09,0x00,0x97,
-0x09,0x03,0x0b,0x00,0x13,0x82,0x70,0x01,0xf0,0x07,0x0a,0xff,0x9b,0xff,0x40,0x00,
-0x19,0xa0,0x0c,0x60,0x00,0x0b,0x60,0x0d,0x50,0x00,0x0f,0x20,0x0e,0x30,0x00,0x4e,
-0x72,0x0a,0x30,0x98,0x00,0x1f,0x39,0x08,0x53,0x02,0x00,0x12,0x22,0x22,0xf8,0x05,
-0xf0,0x03,0x08,0xcc,0x97,0xdd,0x20,0x02,0x39,0xb1,0x3e,0x40,0x00,0x0b,0x70,0x0f,
-0x30,0x00,0x1f,0x10,0xc1,0x05,0x22,0x00,0x07,0xbf,0x02,0x01,0x9c,0x02,0xe2,0x00,
-0xbc,0xcc,0xcb,0x20,0x02,0xf5,0x44,0x4e,0x40,0x02,0xf1,0x00,0x0e,0x05,0x00,0xf5,
-0x0a,0x00,0xef,0xff,0xfe,0x20,0x08,0xef,0xb8,0xff,0x30,0x00,0x18,0xb0,0x1e,0x40,
-0x00,0x0c,0x60,0x0e,0x30,0x00,0x2e,0x00,0x0f,0x10,0x7d,0x04,0x12,0xf9,0x50,0x01,
-0x00,0x56,0x02,0x23,0x02,0xf1,0x6a,0x02,0x15,0x20,0x60,0x02,0x15,0x50,0x1d,0x02,
-0x01,0xc7,0x04,0x40,0xf1,0x00,0x0f,0x30,0xa1,0x00,0x10,0xf3,0x1e,0x0b,0x05,0x0b,
-0x00,0x20,0xff,0xe2,0x0b,0x00,0x13,0x31,0x16,0x00,0x91,0xcc,0xdf,0x2f,0x20,0x00,
-0x24,0x42,0x00,0xf2,0x31,0x0b,0x01,0x68,0x0c,0x11,0xf2,0xe9,0x0b,0x04,0x4b,0x00,
-0x40,0x80,0x00,0x00,0xe2,0x1b,0x06,0x20,0x0f,0x30,0x3b,0x01,0xf0,0x03,0xf8,0x60,
-0x1f,0x10,0x00,0x0f,0xba,0x22,0xf7,0x67,0x92,0xf3,0x00,0x08,0xaa,0x96,0x0f,0x30,
-0x0b,0x03,0x11,0x60,0x1a,0x03,0x13,0x30,0x43,0x05,0x40,0xff,0xff,0xfe,0x20,0x6f,
-0x00,0x11,0x10,0x16,0x00,0x18,0x60,0xca,0x04,0x41,0x60,0x00,0x00,0xe1,0x4d,0x00,
-0x10,0x20,0x4d,0x00,0x20,0xf3,0x10,0x4d,0x00,0xc3,0xfe,0x22,0xf2,0x12,0x40,0xf2,
-0x00,0x0e,0xff,0xfc,0x2f,0x20,0x71,0x00,0xb0,0xcd,0xdd,0xdd,0x10,0x00,0x1f,0x53,
-0x33,0xf3,0x00,0x01,0xb9,0x00,0x00,0x32,0x00,0x20,0xf2,0x00,0x1d,0x01,0x03,0x00,
-0x03,0xa2,0x05,0x00,0x01,0xc0,0xd3,0x0f,0x30,0x02,0xf0,0xe3,0x05,0x00,0x12,0x20,
-0x05,0x00,0x63,0xfc,0xf3,0x0f,0x20,0x02,0xf4,0x0f,0x00,0x80,0x98,0xa5,0xf0,0xe3,
-0x06,0x87,0x53,0xf0,0x5d,0x0a,0x02,0x05,0x00,0x10,0xe4,0x81,0x00,0x91,0x91,0x40,
-0x00,0x00,0xc2,0xe4,0x00,0x00,0xe4,0x04,0x00,0x74,0x04,0x66,0xf4,0xe4,0x08,0xbb,
-0xf4,0x10,0x00,0x70,0xe9,0x89,0xb2,0xe4,0x58,0x87,0x40,0x29,0x00,0x04,0x04,0x00,
-0x13,0x91,0x2d,0x0e,0xf0,0x05,0xb6,0xe4,0x00,0x00,0xc7,0xe4,0x05,0xff,0xf7,0xe4,
-0x00,0x11,0xc7,0xf5,0x23,0x52,0xc7,0xbe,0xed,0xa3,0x1a,0x0f,0x22,0x41,0x0e,0xe5,
-0x02,0x50,0xe4,0x0b,0xff,0xff,0xf2,0xe9,0x05,0x00,0x87,0x1b,0x05,0x4e,0x34,0x40,
-0x00,0x00,0x89,0xe4,0x04,0x00,0xf0,0x09,0x05,0xff,0xf9,0xe4,0x00,0x11,0x89,0xf7,
-0x45,0x73,0x89,0x9c,0xcb,0x82,0x89,0x00,0x47,0x65,0x54,0x00,0x37,0x99,0x10,0x2e,
-0x63,0x05,0xe4,0x69,0xa9,0x50,0x06,0xe3,0x24,0xf4,0x02,0xde,0xde,0xc1,0x00,0x01,
-0x20,0xe1,0x00,0x82,0x00,0xb1,0xd2,0x0f,0x30,0x00,0xe2,0xe3,0x05,0x00,0xd3,0x20,
-0x33,0xe3,0xe3,0x0f,0x22,0xdd,0xf3,0xe3,0x0f,0x20,0x00,0xe3,0x05,0x00,0x80,0x98,
-0xa3,0xe3,0xe3,0x06,0x87,0x50,0xe3,0x4f,0x07,0x06,0x05,0x00,0x36,0x60,0x81,0x00,
-0xc5,0x01,0x0b,0x05,0x00,0x10,0xef,0x41,0x04,0x11,0x01,0x45,0x0e,0xe1,0xb7,0x00,
-0x00,0x12,0x22,0xc8,0x22,0x21,0xbf,0xfe,0xee,0xff,0xfb,0x00,0x07,0x0f,0x15,0xf3,
-0x28,0x00,0xf0,0x17,0xff,0xee,0xff,0x10,0x00,0x12,0xaa,0x10,0x00,0x13,0x33,0xaa,
-0x33,0x31,0x9d,0xdc,0xcc,0xcc,0xc8,0x00,0x23,0x33,0x33,0x00,0x02,0xdd,0xdd,0xdc,
-0x40,0x00,0x0c,0x00,0xb2,0x00,0x00,0x2f,0x10,0xd5,0x21,0x06,0x52,0xee,0x90,0x00,
-0x08,0x00,0x2b,0x0d,0x00,0xe9,0x05,0x01,0x36,0x0d,0x03,0x14,0x0c,0x72,0xfe,0xb0,
-0x00,0x00,0x12,0x21,0x10,0x10,0x0c,0x6e,0x10,0xef,0xff,0xff,0xfe,0xe9,0x5e,0x03,
-0x05,0xe2,0x0d,0x03,0x69,0x01,0x14,0xe3,0x6a,0x05,0x00,0xb6,0x0d,0x13,0x10,0x56,
-0x05,0x10,0xff,0x56,0x05,0x12,0xc6,0xec,0x02,0x02,0x25,0x09,0x0a,0xf6,0x02,0x15,
-0x70,0xa9,0x02,0x02,0x88,0x00,0x24,0x01,0xf2,0x87,0x00,0x02,0x33,0x05,0x03,0x86,
-0x00,0x20,0x01,0x10,0x41,0x03,0x30,0xe9,0x00,0x6b,0x66,0x00,0x06,0x05,0x00,0x12,
-0x69,0xfe,0x00,0x01,0xfc,0x0b,0x09,0xf1,0x05,0x17,0xf3,0x38,0x01,0x44,0xfd,0x10,
-0x00,0x01,0x11,0x09,0x01,0xb6,0x09,0x20,0x8c,0xcc,0x15,0x01,0x1a,0xc2,0x2d,0x00,
-0x30,0xed,0xcc,0xdd,0x1f,0x00,0x10,0x43,0x0f,0x06,0x23,0x11,0x11,0x2c,0x08,0x00,
-0x01,0x00,0x14,0xf1,0x4b,0x00,0x24,0x01,0xf3,0x46,0x06,0x2a,0x00,0xb1,0x3c,0x00,
-0x01,0x74,0x01,0x00,0x94,0x12,0x52,0x8b,0xbb,0xbb,0xbb,0xb7,0x1a,0x0a,0x80,0x06,
-0xbb,0x81,0x00,0x00,0xad,0x54,0xbd,0x9d,0x09,0x10,0x0f,0x9d,0x09,0x29,0x5f,0x10,
-0x9d,0x09,0x00,0x60,0x02,0x15,0xd2,0xcc,0x02,0x07,0x04,0x00,0x5e,0xf4,0x00,0x00,
-0xe4,0xfa,0xcc,0x02,0x10,0x72,0x34,0x00,0x80,0x51,0x00,0x00,0xb5,0xd5,0x00,0x00,
-0xc6,0x04,0x00,0x11,0xe4,0x04,0x00,0xf0,0x07,0x10,0xc5,0xde,0xef,0xf5,0xc5,0x02,
-0x21,0x00,0x72,0x08,0xdd,0xdd,0xc2,0x0c,0x83,0x33,0xe5,0x0c,0x60,0x00,0xd4,0x04,
-0x00,0xc0,0x09,0xff,0xff,0xe2,0x51,0x00,0x00,0x95,0xd5,0x00,0x00,0xb7,0x04,0x00,
-0x10,0xe4,0x04,0x00,0xf1,0x0c,0x01,0x31,0xb7,0xcf,0xff,0xd4,0xb6,0x00,0x00,0x00,
-0x52,0x08,0x30,0x00,0x83,0x0b,0x71,0x11,0xc5,0x0b,0xff,0xfe,0xf5,0x0b,0x60,0x00,
-0xc5,0x35,0x06,0x02,0x5c,0x13,0x70,0x0c,0x10,0x02,0xff,0xfe,0x60,0xf2,0xe0,0x06,
-0x11,0x0f,0xab,0x01,0x02,0x0b,0x00,0x30,0xfe,0x33,0xf0,0xf8,0x03,0x02,0x16,0x00,
-0x81,0xf3,0x34,0x61,0xf2,0x00,0x1b,0xcc,0xb9,0x38,0x02,0x08,0x82,0x04,0x13,0xe1,
-0xc4,0x04,0x88,0x22,0x22,0x00,0xf2,0x00,0x2f,0xdd,0xc3,0x42,0x00,0x10,0xcc,0x7f,
-0x14,0xb4,0xf6,0x40,0x3f,0x44,0x57,0x0f,0x20,0x01,0xbc,0xba,0x70,0x37,0x00,0x44,
-0x0e,0x10,0x00,0xb1,0x88,0x02,0x22,0x31,0x11,0x7c,0x04,0x04,0x67,0x14,0x91,0x56,
-0x66,0x10,0xf2,0x00,0x3f,0xaa,0x93,0x0f,0x8b,0x07,0x11,0xf3,0x48,0x00,0xb1,0xff,
-0x23,0xf0,0x01,0x30,0xf4,0x00,0x1f,0xff,0xeb,0x0f,0x27,0x00,0x40,0x70,0x00,0x00,
-0xb0,0x51,0x11,0x40,0x0f,0x21,0x11,0xf2,0xc4,0x04,0x20,0xef,0x20,0x78,0x05,0x01,
-0x0b,0x00,0x08,0x77,0x07,0x00,0xd9,0x0a,0xa6,0xa0,0xd2,0x1f,0xdd,0xc3,0xf0,0xe3,
-0x2f,0x00,0x03,0x05,0x00,0x72,0xfc,0xf3,0x2f,0x00,0x03,0xf4,0xf3,0x0f,0x00,0x52,
-0x88,0xa6,0xf0,0xe3,0x07,0x7c,0x04,0x15,0x03,0x05,0x00,0x32,0x01,0x70,0xa2,0x3f,
-0x02,0x92,0x20,0xb4,0xed,0xdd,0x80,0xc5,0xf3,0x00,0x00,0x04,0x00,0x34,0x09,0xff,
-0xf5,0x0c,0x00,0x70,0xfa,0x8a,0xc4,0xc6,0x58,0x76,0x51,0x58,0x04,0x13,0xc5,0x04,
-0x00,0xf0,0x09,0x82,0x12,0x22,0x10,0x28,0xee,0xdd,0x70,0x4d,0xf3,0x00,0x34,0x7d,
-0xf3,0x00,0x9c,0xdd,0xf4,0x01,0x31,0x4d,0xcf,0xfe,0xc4,0x1e,0x07,0x50,0x15,0x05,
-0xef,0xff,0xfc,0x2f,0x09,0x93,0x09,0xff,0xff,0xfa,0x0a,0xb0,0x00,0x00,0x08,0xb3,
-0x09,0xf2,0x10,0x12,0x22,0x00,0x29,0x0e,0xed,0xd7,0x04,0xd0,0xf3,0x00,0x11,0x5d,
-0x0f,0x30,0x1e,0xff,0xd0,0xf3,0x00,0x00,0x4d,0x0d,0xdd,0xdd,0x14,0xd0,0x01,0x00,
-0x00,0x15,0x1a,0x0a,0x20,0x31,0x11,0x1c,0x10,0x60,0x4d,0x00,0x00,0xe3,0x04,0xd1,
-0x5c,0x05,0x12,0xe3,0xdf,0x00,0xe2,0x23,0x20,0xb0,0xd2,0x1f,0xdd,0xb0,0xf1,0xe3,
-0x2f,0x00,0x00,0xf1,0xf3,0x05,0x00,0x20,0x03,0xee,0x0f,0x00,0x12,0x11,0x14,0x00,
-0xb0,0xe3,0x2f,0x77,0x93,0xf1,0xe3,0x08,0x98,0x61,0xf1,0xe3,0xdb,0x02,0x00,0xda,
-0x00,0x20,0xf0,0xe3,0x80,0x03,0xf1,0x03,0xa2,0x01,0x10,0x07,0x0a,0x1d,0xff,0xa0,
-0xe2,0xe3,0xf3,0x00,0x0e,0x3e,0x3f,0x30,0xff,0xf3,0x09,0x00,0xf3,0x04,0x3e,0xee,
-0xf3,0xe3,0xe3,0x12,0x10,0x0a,0x2d,0x20,0x02,0x22,0x33,0x20,0x02,0xee,0xdd,0xdf,
-0x10,0x9f,0x03,0x20,0x1f,0x10,0x3c,0x00,0x03,0x22,0x08,0xf1,0x1a,0x0d,0x28,0x3d,
+0xf0,0x14,0x3e,0x05,0xc0,0x00,0x00,0x4d,0x05,0xc0,0x24,0x44,0x6a,0x75,0xc0,0x6a,
+0xcf,0x97,0x46,0xc0,0x00,0x5e,0x0a,0xff,0xc0,0x00,0x16,0x00,0x16,0xc0,0x00,0x43,
+0x00,0x04,0xa0,0x00,0xa8,0x32,0x00,0x10,0xa9,0xfd,0x00,0x30,0x8f,0xff,0xff,0x80,
+0x03,0xf4,0x19,0x02,0xa0,0x8e,0xee,0xf2,0x3e,0x00,0x00,0x0f,0x32,0xf0,0x00,0x00,
+0xf3,0x2f,0x00,0x00,0x1f,0x12,0xf0,0x00,0x00,0xa2,0x2f,0x3d,0xdd,0xef,0xd4,0xf0,
+0x22,0xe5,0x00,0x2f,0x00,0x0e,0x40,0x02,0xf0,0x00,0xe4,0x09,0x00,0x00,0xbc,0x06,
+0x00,0x3f,0x00,0x42,0x05,0xff,0xff,0xfc,0xdf,0x04,0x04,0x05,0x00,0x10,0x6c,0x05,
+0x00,0xf7,0x02,0x36,0x00,0xae,0xee,0xee,0xff,0xfa,0x01,0x5e,0x11,0xf4,0x10,0x00,
+0x4e,0x00,0xe3,0x00,0x05,0x00,0x30,0x17,0x00,0x71,0x37,0x01,0x61,0x43,0x00,0x02,
+0xcc,0xcc,0xcf,0x3c,0x01,0x05,0x41,0x01,0x30,0x1d,0x00,0xbf,0x3c,0x01,0xe2,0x01,
+0x13,0xf1,0xc7,0x10,0x00,0x12,0xf0,0xc6,0x00,0x01,0xf2,0x90,0x73,0x41,0x06,0x20,
+0x01,0xf2,0xe2,0x01,0x80,0xef,0xff,0xff,0x70,0x03,0xee,0xef,0xfa,0xe1,0x01,0x15,
+0x6d,0x6e,0x00,0x10,0x7b,0x05,0x00,0x10,0x89,0x05,0x00,0x12,0x75,0x0c,0x01,0x51,
+0x9d,0xdd,0xdd,0xdd,0xd9,0xfd,0x02,0x40,0x01,0xcc,0xcd,0xdb,0x6e,0x00,0x15,0x6f,
+0xdc,0x01,0x11,0x3d,0x1c,0x04,0x00,0xa0,0x00,0x20,0xee,0xea,0x6c,0x01,0xb9,0x20,
+0x02,0xbb,0xbb,0xcc,0x20,0x00,0x44,0x44,0x4f,0x40,0xa5,0x01,0xba,0x0a,0x20,0x00,
+0x12,0x22,0x31,0x00,0x01,0xdd,0xdd,0xee,0x1d,0x02,0x70,0x3d,0x00,0x13,0x33,0x33,
+0x35,0x31,0x64,0x00,0x21,0xd8,0x00,0x8b,0x02,0x15,0xf3,0x05,0x00,0x14,0xf4,0xa5,
+0x00,0x31,0x01,0xee,0xee,0x86,0x02,0x13,0x3f,0x81,0x02,0xf2,0x01,0x00,0x00,0x2b,
+0x00,0x12,0x11,0x11,0x12,0x21,0x9e,0xee,0xee,0xee,0xd8,0x00,0x01,0xcf,0x03,0x11,
+0xff,0x0e,0x02,0x10,0x50,0x0a,0x00,0x11,0x30,0xf5,0x04,0x00,0x0a,0x00,0x12,0x70,
+0x98,0x03,0x03,0xb9,0x00,0x1a,0x5f,0x95,0x02,0x03,0xb9,0x00,0x9f,0x01,0x11,0x11,
+0x11,0x20,0x00,0xa0,0x00,0x08,0xd9,0x03,0x07,0x02,0x46,0x00,0xf2,0x15,0x12,0x10,
+0x3d,0x0b,0xee,0xef,0x14,0xe0,0x00,0x04,0xe0,0x4d,0x00,0x00,0xa9,0x04,0xd0,0x00,
+0x2f,0x20,0x4d,0x00,0x0c,0x80,0x04,0xd0,0x08,0xc0,0x00,0x4d,0x07,0xe2,0x00,0x04,
+0xd0,0xc2,0x14,0x01,0x10,0x03,0xb0,0x05,0x13,0x4d,0xb0,0x05,0xf0,0x13,0x20,0x07,
+0x41,0xed,0xdf,0x90,0xb7,0x00,0x00,0xe6,0x0b,0x70,0x00,0x8d,0x00,0xb7,0x00,0x8e,
+0x30,0x0a,0x72,0xea,0x10,0x00,0xa6,0x02,0x11,0x11,0x25,0x10,0x0d,0xff,0xfe,0xf5,
+0xae,0x01,0x20,0x50,0x0a,0x7e,0x05,0x21,0xb8,0x00,0x7a,0x03,0x13,0xf8,0x72,0x00,
+0xf0,0x19,0x10,0x07,0x41,0xff,0xef,0x80,0xb6,0x00,0x00,0xe5,0x0b,0x60,0x00,0x5e,
+0x00,0xb6,0x00,0x3f,0x40,0x0b,0x60,0x6e,0x50,0x00,0xb6,0x4b,0x20,0x00,0x08,0x40,
+0x0a,0x20,0x00,0x83,0x00,0xe5,0x11,0x1c,0x50,0x0e,0x44,0x00,0x50,0xe3,0x00,0x0c,
+0x50,0x0d,0x44,0x00,0x02,0x3a,0x00,0xf0,0x1e,0x11,0x04,0xb0,0x08,0xef,0x9f,0xf1,
+0x5d,0x00,0x01,0xf1,0x2f,0x05,0xd0,0x00,0x4d,0x05,0xe0,0x4d,0x00,0x08,0x90,0x8b,
+0x04,0xfe,0xb0,0xd5,0x0b,0x80,0x4d,0x20,0x4e,0x01,0xf2,0x04,0xd0,0x0c,0x60,0x7c,
+0x00,0x4d,0x00,0x20,0x0e,0x30,0x60,0x06,0x11,0x20,0xb1,0x00,0x02,0x6b,0x06,0x22,
+0x00,0x16,0x81,0x00,0xf3,0x1e,0x12,0x02,0x10,0x2e,0x7e,0xf8,0xef,0x23,0xf0,0x1f,
+0x01,0xf1,0x3e,0x04,0xd0,0x4e,0x03,0xe0,0x89,0x08,0xac,0xfe,0x0d,0x40,0xd6,0x14,
+0xe4,0xe0,0x3f,0x00,0x3e,0xc5,0x0b,0x80,0x03,0xe1,0x03,0xe0,0x00,0x2e,0x00,0x01,
+0x00,0x02,0xe0,0x57,0x01,0xf0,0x03,0x01,0x90,0x00,0x13,0x30,0x23,0x20,0x00,0x0c,
+0xdf,0x7b,0xdf,0x10,0x00,0x00,0xc6,0x01,0xf1,0x26,0x0a,0xc0,0x2f,0x00,0x00,0x04,
+0xe0,0x03,0xe0,0x00,0x00,0x56,0x00,0x28,0xa8,0x09,0x60,0xee,0xff,0x70,0x12,0x22,
+0xd6,0x0d,0x04,0x11,0x0d,0xe4,0x09,0x00,0x97,0x09,0x03,0x0b,0x00,0x13,0x82,0x70,
+0x01,0xf0,0x07,0x0a,0xff,0x9b,0xff,0x40,0x00,0x19,0xa0,0x0c,0x60,0x00,0x0b,0x60,
+0x0d,0x50,0x00,0x0f,0x20,0x0e,0x30,0x00,0x4e,0x72,0x0a,0x30,0x98,0x00,0x1f,0x39,
+0x08,0x53,0x02,0x00,0x12,0x22,0x22,0xf8,0x05,0xf0,0x03,0x08,0xcc,0x97,0xdd,0x20,
+0x02,0x39,0xb1,0x3e,0x40,0x00,0x0b,0x70,0x0f,0x30,0x00,0x1f,0x10,0xc1,0x05,0x22,
+0x00,0x07,0xbf,0x02,0x01,0x9c,0x02,0xe2,0x00,0xbc,0xcc,0xcb,0x20,0x02,0xf5,0x44,
+0x4e,0x40,0x02,0xf1,0x00,0x0e,0x05,0x00,0xf5,0x0a,0x00,0xef,0xff,0xfe,0x20,0x08,
+0xef,0xb8,0xff,0x30,0x00,0x18,0xb0,0x1e,0x40,0x00,0x0c,0x60,0x0e,0x30,0x00,0x2e,
+0x00,0x0f,0x10,0x7d,0x04,0x12,0xf9,0x50,0x01,0x00,0x56,0x02,0x23,0x02,0xf1,0x6a,
+0x02,0x15,0x20,0x60,0x02,0x15,0x50,0x1d,0x02,0x01,0xc7,0x04,0x40,0xf1,0x00,0x0f,
+0x30,0xa1,0x00,0x10,0xf3,0x1e,0x0b,0x05,0x0b,0x00,0x20,0xff,0xe2,0x0b,0x00,0x13,
+0x31,0x16,0x00,0x91,0xcc,0xdf,0x2f,0x20,0x00,0x24,0x42,0x00,0xf2,0x31,0x0b,0x00,
+0xf7,0x0a,0x02,0x0b,0x00,0x14,0x07,0x4b,0x00,0x40,0x80,0x00,0x00,0xe2,0x1b,0x06,
+0x20,0x0f,0x30,0x3b,0x01,0xf0,0x03,0xf8,0x60,0x1f,0x10,0x00,0x0f,0xba,0x22,0xf7,
+0x67,0x92,0xf3,0x00,0x08,0xaa,0x96,0x0f,0x30,0x0b,0x03,0x11,0x60,0x1a,0x03,0x13,
+0x30,0x43,0x05,0x40,0xff,0xff,0xfe,0x20,0x6f,0x00,0x11,0x10,0x16,0x00,0x18,0x60,
+0xca,0x04,0x41,0x60,0x00,0x00,0xe1,0x4d,0x00,0x10,0x20,0x4d,0x00,0x20,0xf3,0x10,
+0x4d,0x00,0xc3,0xfe,0x22,0xf2,0x12,0x40,0xf2,0x00,0x0e,0xff,0xfc,0x2f,0x20,0x71,
+0x00,0xb0,0xcd,0xdd,0xdd,0x10,0x00,0x1f,0x53,0x33,0xf3,0x00,0x01,0xb9,0x00,0x00,
+0x32,0x00,0x20,0xf2,0x00,0x1d,0x01,0x03,0x00,0x03,0xa2,0x05,0x00,0x01,0xc0,0xd3,
+0x0f,0x30,0x02,0xf0,0xe3,0x05,0x00,0x12,0x20,0x05,0x00,0x63,0xfc,0xf3,0x0f,0x20,
+0x02,0xf4,0x0f,0x00,0x80,0x98,0xa5,0xf0,0xe3,0x06,0x87,0x53,0xf0,0x5d,0x0a,0x02,
+0x05,0x00,0x10,0xe4,0x81,0x00,0x91,0x91,0x40,0x00,0x00,0xc2,0xe4,0x00,0x00,0xe4,
+0x04,0x00,0x74,0x04,0x66,0xf4,0xe4,0x08,0xbb,0xf4,0x10,0x00,0x70,0xe9,0x89,0xb2,
+0xe4,0x58,0x87,0x40,0x29,0x00,0x04,0x04,0x00,0x12,0x91,0xbd,0x06,0xf2,0x0c,0x00,
+0xb6,0xe4,0x00,0x00,0xc7,0xe4,0x05,0xff,0xf7,0xe4,0x00,0x11,0xc7,0xf5,0x23,0x52,
+0xc7,0xbe,0xed,0xa3,0xc6,0x00,0x00,0x00,0x41,0x0e,0xe5,0x02,0x70,0xe4,0x0b,0xff,
+0xff,0xf2,0x0c,0x70,0x28,0x02,0x23,0xff,0xfb,0xef,0x00,0x00,0x43,0x04,0x20,0x89,
+0xe4,0x04,0x00,0xf0,0x09,0x05,0xff,0xf9,0xe4,0x00,0x11,0x89,0xf7,0x45,0x73,0x89,
+0x9c,0xcb,0x82,0x89,0x00,0x47,0x65,0x54,0x00,0x37,0x99,0x10,0x2e,0x63,0x05,0xe4,
+0x69,0xa9,0x50,0x06,0xe3,0x24,0xf4,0x02,0xde,0xde,0xc1,0x00,0x01,0x20,0xe1,0x00,
+0x82,0x00,0xb1,0xd2,0x0f,0x30,0x00,0xe2,0xe3,0x05,0x00,0xd3,0x20,0x33,0xe3,0xe3,
+0x0f,0x22,0xdd,0xf3,0xe3,0x0f,0x20,0x00,0xe3,0x05,0x00,0x80,0x98,0xa3,0xe3,0xe3,
+0x06,0x87,0x50,0xe3,0x4f,0x07,0x06,0x05,0x00,0x36,0x60,0x81,0x00,0xc5,0x01,0x0b,
+0x05,0x00,0x10,0xef,0x41,0x04,0x20,0x01,0x53,0x0b,0x00,0xf5,0x00,0xb7,0x00,0x00,
+0x12,0x22,0xc8,0x22,0x21,0xbf,0xfe,0xee,0xff,0xfb,0x00,0xd2,0xe6,0x04,0x01,0x28,
+0x00,0xf0,0x17,0xff,0xee,0xff,0x10,0x00,0x12,0xaa,0x10,0x00,0x13,0x33,0xaa,0x33,
+0x31,0x9d,0xdc,0xcc,0xcc,0xc8,0x00,0x23,0x33,0x33,0x00,0x02,0xdd,0xdd,0xdc,0x40,
+0x00,0x0c,0x00,0xb2,0x00,0x00,0x2f,0x10,0xd5,0x21,0x06,0x52,0xee,0x90,0x00,0x08,
+0x00,0x2b,0x0d,0x00,0xe9,0x05,0x01,0x36,0x0d,0x03,0x14,0x0c,0x72,0xfe,0xb0,0x00,
+0x00,0x12,0x21,0x10,0x10,0x0c,0x7e,0x10,0xef,0xff,0xff,0xfe,0xe9,0x00,0x5e,0x03,
+0x15,0xc3,0x1b,0x02,0x01,0x69,0x01,0x14,0xe3,0x6a,0x05,0x00,0xb6,0x0d,0x13,0x10,
+0x56,0x05,0x10,0xff,0x56,0x05,0x12,0xc6,0xec,0x02,0x02,0x25,0x09,0x0a,0xf6,0x02,
+0x15,0x70,0xa9,0x02,0x02,0x88,0x00,0x24,0x01,0xf2,0x87,0x00,0x02,0x33,0x05,0x03,
+0x86,0x00,0x20,0x01,0x10,0x41,0x03,0x30,0xe9,0x00,0x6b,0x66,0x00,0x06,0x05,0x00,
+0x12,0x69,0xfe,0x00,0x01,0xfc,0x0b,0x09,0xf1,0x05,0x17,0xf3,0x38,0x01,0x44,0xfd,
+0x10,0x00,0x01,0x11,0x09,0x01,0xb6,0x09,0x20,0x8c,0xcc,0x15,0x01,0x1a,0xc2,0x2d,
+0x00,0x30,0xed,0xcc,0xdd,0x1f,0x00,0x10,0x43,0x0f,0x06,0x23,0x11,0x11,0x2c,0x08,
+0x00,0x01,0x00,0x14,0xf1,0x4b,0x00,0x24,0x01,0xf3,0x46,0x06,0x2a,0x00,0xb1,0x3c,
+0x00,0x01,0x74,0x01,0x92,0x01,0x11,0x10,0x00,0x8b,0xbb,0xbb,0xbb,0xb7,0x1a,0x0a,
+0x80,0x06,0xbb,0x81,0x00,0x00,0xad,0x54,0xbd,0x9d,0x09,0x10,0x0f,0x9d,0x09,0x29,
+0x5f,0x10,0x9d,0x09,0x00,0x60,0x02,0x15,0xd2,0xcc,0x02,0x07,0x04,0x00,0x5e,0xf4,
+0x00,0x00,0xe4,0xfa,0xcc,0x02,0x10,0x72,0x34,0x00,0x80,0x51,0x00,0x00,0xb5,0xd5,
+0x00,0x00,0xc6,0x04,0x00,0x11,0xe4,0x04,0x00,0xf0,0x07,0x10,0xc5,0xde,0xef,0xf5,
+0xc5,0x02,0x21,0x00,0x72,0x08,0xdd,0xdd,0xc2,0x0c,0x83,0x33,0xe5,0x0c,0x60,0x00,
+0xd4,0x04,0x00,0xc0,0x09,0xff,0xff,0xe2,0x51,0x00,0x00,0x95,0xd5,0x00,0x00,0xb7,
+0x04,0x00,0x10,0xe4,0x04,0x00,0xf2,0x0d,0x01,0x31,0xb7,0xcf,0xff,0xd4,0xb6,0x00,
+0x00,0x00,0x52,0x08,0x30,0x00,0x83,0x0b,0x71,0x11,0xc5,0x0b,0xff,0xfe,0xf5,0x0b,
+0x60,0x00,0xc5,0x0a,0xf1,0x05,0x00,0xc8,0x00,0x70,0x0c,0x10,0x02,0xff,0xfe,0x60,
+0xf2,0xe0,0x06,0x11,0x0f,0xab,0x01,0x02,0x0b,0x00,0x30,0xfe,0x33,0xf0,0xf8,0x03,
+0x02,0x16,0x00,0x81,0xf3,0x34,0x61,0xf2,0x00,0x1b,0xcc,0xb9,0x38,0x02,0x05,0x82,
+0x04,0x50,0x00,0x00,0x00,0xe1,0x00,0xf1,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x22,
+0x22,0x00,0xf2,0x00,0x2f,0xdd,0xc3,0x0f,0x20,0x03,0xf0,0x00,0x00,0xf2,0x00,0x3f,
+0x00,0x00,0x0f,0xcc,0x13,0xf0,0x00,0x00,0xf6,0x40,0x3f,0x44,0x57,0x0f,0x20,0x01,
+0xbc,0xba,0x70,0xf2,0x00,0x00,0x00,0x00,0x0f,0x20,0x00,0x0e,0x10,0x00,0xb1,0x00,
+0x01,0x0e,0x00,0xb2,0x1f,0x31,0x11,0x10,0x00,0x00,0xef,0xff,0xff,0x30,0x00,0x01,
+0x00,0xa0,0x56,0x66,0x10,0xf2,0x00,0x3f,0xaa,0x93,0x0f,0x30,0x48,0x00,0x11,0xf3,
+0x48,0x00,0xb1,0xff,0x23,0xf0,0x01,0x30,0xf4,0x00,0x1f,0xff,0xeb,0x0f,0x27,0x00,
+0xf1,0x07,0x70,0x00,0x00,0xb0,0x00,0x0a,0x10,0x00,0x0f,0x21,0x11,0xf2,0x00,0x00,
+0xff,0xff,0xef,0x20,0x00,0x0f,0x10,0x00,0x0b,0x00,0x36,0xff,0x10,0x00,0x01,0x00,
+0xd6,0x02,0x33,0x21,0xa0,0xd2,0x1f,0xdd,0xc3,0xf0,0xe3,0x2f,0x00,0x03,0x05,0x00,
+0x72,0xfc,0xf3,0x2f,0x00,0x03,0xf4,0xf3,0x0f,0x00,0xc5,0x88,0xa6,0xf0,0xe3,0x07,
+0x87,0x53,0xf0,0xe3,0x00,0x00,0x03,0x05,0x00,0x30,0x01,0x70,0xa2,0x40,0x00,0xb2,
+0x24,0x44,0x20,0xb4,0xed,0xdd,0x80,0xc5,0xf3,0x00,0x00,0x04,0x00,0x34,0x09,0xff,
+0xf5,0x0c,0x00,0xc3,0xfa,0x8a,0xc4,0xc6,0x58,0x76,0x51,0xc6,0x00,0x00,0x00,0xc5,
+0x04,0x00,0xf0,0x22,0x82,0x12,0x22,0x10,0x28,0xee,0xdd,0x70,0x4d,0xf3,0x00,0x34,
+0x7d,0xf3,0x00,0x9c,0xdd,0xf4,0x01,0x31,0x4d,0xcf,0xfe,0xc4,0x4d,0x00,0x00,0x00,
+0x15,0x05,0xef,0xff,0xfc,0x00,0x11,0x11,0x6d,0x09,0xff,0xff,0xfa,0x0a,0xb0,0x00,
+0x00,0x08,0xff,0xff,0xfc,0x64,0x00,0xf2,0x27,0x12,0x22,0x00,0x29,0x0e,0xed,0xd7,
+0x04,0xd0,0xf3,0x00,0x11,0x5d,0x0f,0x30,0x1e,0xff,0xd0,0xf3,0x00,0x00,0x4d,0x0d,
+0xdd,0xdd,0x14,0xd0,0x01,0x00,0x00,0x15,0x00,0x8f,0xff,0xff,0xd0,0x00,0x31,0x11,
+0x30,0x00,0x0e,0x20,0x4d,0x00,0x00,0xe3,0x04,0xd1,0x00,0xef,0xff,0xfe,0xe3,0xdf,
+0x00,0xe2,0x23,0x20,0xb0,0xd2,0x1f,0xdd,0xb0,0xf1,0xe3,0x2f,0x00,0x00,0xf1,0xf3,
+0x05,0x00,0x20,0x03,0xee,0x0f,0x00,0x12,0x11,0x14,0x00,0xa0,0xe3,0x2f,0x77,0x93,
+0xf1,0xe3,0x08,0x98,0x61,0xf1,0x32,0x00,0x10,0xf1,0xda,0x00,0x10,0xf0,0x0a,0x00,
+0xf1,0x04,0x80,0xa2,0x01,0x10,0x07,0x0a,0x1d,0xff,0xa0,0xe2,0xe3,0xf3,0x00,0x0e,
+0x3e,0x3f,0x30,0xff,0xf3,0x09,0x00,0xf0,0x08,0x3e,0xee,0xf3,0xe3,0xe3,0x12,0x10,
+0x0a,0x2d,0x20,0x02,0x22,0x33,0x20,0x02,0xee,0xdd,0xdf,0x10,0x00,0x00,0x01,0xf1,
+0xa8,0x01,0x10,0x10,0x3c,0x00,0x01,0x77,0x00,0xf0,0x56,0x01,0x10,0x0d,0x28,0x3d,
 0xff,0xb0,0xe3,0xb6,0xf3,0x00,0x0e,0x3b,0x6f,0x30,0xef,0xf3,0xb6,0xf3,0x01,0x1e,
 0x3b,0x6f,0x53,0x51,0xe3,0xb5,0xad,0xda,0x2e,0x3c,0x50,0x00,0x00,0xe3,0xc5,0x02,
-0xd0,0x07,0x19,0x30,0x3e,0x00,0x7e,0x0f,0x10,0x12,0x47,0x1f,0xf0,0x11,0xe3,0x01,
-0x10,0x09,0x1a,0x1d,0xff,0xa0,0xe3,0xe3,0xf3,0x01,0x2e,0x3e,0x3f,0x30,0xdd,0xf3,
-0xe3,0xf4,0x13,0x0d,0x3e,0x3b,0xfe,0xb2,0xd3,0xe3,0x00,0x00,0x05,0x04,0x95,0x0f,
-0x11,0xf0,0x30,0x0c,0x62,0x1f,0xff,0xff,0xe0,0x02,0xf0,0xac,0x10,0x33,0xf7,0x00,
-0x00,0xa4,0x02,0x00,0x20,0x04,0x13,0xea,0x2a,0x04,0x15,0xf1,0xbb,0x04,0x10,0xff,
-0xdb,0x16,0x30,0x01,0x43,0x00,0xb3,0x12,0x00,0x27,0x00,0x50,0xb9,0x22,0x21,0xbf,
-0xee,0x26,0x05,0x30,0xdf,0xff,0xfd,0x9d,0x04,0x16,0x10,0xb2,0x03,0x40,0x30,0x00,
-0x01,0xa9,0xb6,0x03,0x32,0x99,0x11,0x10,0xee,0x03,0x0e,0xcc,0x0d,0x05,0x15,0x0c,
-0x02,0x48,0x04,0x30,0x00,0x00,0xf3,0x41,0x00,0x16,0xf2,0x41,0x00,0x19,0xaa,0x41,
-0x00,0x20,0x00,0x22,0x1d,0x0d,0xa0,0xdd,0xf7,0x00,0x00,0xe6,0x00,0x2f,0x20,0x00,
-0xe7,0xa8,0x11,0x34,0x5e,0xee,0xe7,0xf3,0x03,0xf0,0x0c,0x10,0x02,0xa0,0xff,0xff,
-0xd0,0x3e,0x1f,0x20,0x00,0x03,0xe1,0xf2,0x00,0x00,0x3e,0x1f,0x30,0x12,0x03,0xe0,
-0xdf,0xfe,0xd3,0x3e,0x00,0x04,0x5b,0x0f,0xb5,0xe3,0x00,0x3f,0x01,0x1e,0x53,0x53,
-0xf5,0xee,0xed,0xb9,0x6d,0x0f,0x12,0x1b,0x7c,0x00,0xa0,0x58,0x88,0x70,0xb3,0x00,
-0xea,0x88,0x70,0xc5,0x00,0xf5,0x03,0xa0,0x00,0xe7,0x44,0x40,0xc6,0x00,0x8c,0xfb,
-0xa1,0xc6,0x81,0x01,0xf2,0x01,0xc6,0x0c,0xcd,0xfe,0xfa,0xc6,0x03,0x44,0x43,0x10,
-0xc6,0x00,0x06,0x10,0x00,0xa4,0x9c,0x05,0x30,0x0d,0x61,0x11,0x9b,0x21,0xc0,0xff,
-0xf9,0x0a,0xdd,0xdc,0x0a,0x40,0xe6,0x33,0x10,0xc6,0x0e,0x92,0x08,0xf1,0x23,0xed,
-0xbc,0xc1,0xc6,0x02,0x5f,0x52,0x0c,0x60,0x01,0xf3,0x43,0xc6,0x8f,0xfe,0xec,0x7c,
-0x60,0x00,0x11,0x11,0x41,0x00,0xdf,0xff,0xff,0x30,0x0e,0x40,0x00,0xe4,0x00,0xe5,
-0x00,0x0e,0x40,0x0b,0xff,0xff,0xe2,0x00,0x34,0x44,0x43,0x00,0x02,0xfc,0xcc,0xca,
-0x00,0x79,0x01,0x01,0x05,0x00,0x41,0x01,0xfe,0xee,0xfc,0xe6,0x04,0x00,0xdd,0x03,
-0x73,0x11,0x21,0x7f,0xff,0xff,0xee,0xe9,0x93,0x14,0x24,0x4e,0x00,0x9d,0x14,0x00,
-0x59,0x10,0x0b,0x2f,0x01,0x10,0xf3,0xfe,0x00,0x50,0xdf,0xff,0xfe,0x30,0x01,0x04,
-0x01,0x11,0x9f,0xc7,0x05,0x0f,0x12,0x06,0x09,0x12,0x80,0x2f,0x15,0xf0,0x19,0x44,
-0x44,0x02,0xa0,0xed,0xcb,0xa0,0x3e,0x0e,0x40,0x00,0x03,0xe0,0xe4,0x01,0x20,0x3f,
-0x0c,0xff,0xfe,0x43,0xf0,0x00,0x00,0x01,0x3e,0x6d,0xde,0xef,0xc3,0xe0,0x22,0xf4,
-0x00,0x3e,0x00,0x0f,0x30,0x03,0xe0,0xff,0x13,0x02,0xa6,0x04,0x3f,0x40,0x00,0x07,
-0xb8,0x00,0x04,0x23,0xff,0x20,0x32,0x18,0x0f,0x48,0x06,0x0f,0x17,0xef,0x28,0x02,
-0x06,0xb8,0x00,0x13,0x01,0xb8,0x00,0x35,0x3f,0x11,0xe5,0x20,0x0c,0x2f,0x1e,0x50,
-0xca,0x06,0x02,0x30,0x12,0x11,0x20,0x87,0x02,0x13,0xfa,0x39,0x06,0x06,0x9b,0x02,
-0x30,0xfe,0xee,0xfe,0xdd,0x03,0x1d,0x10,0x89,0x06,0x0f,0x9b,0x02,0x01,0x00,0xaf,
-0x00,0x01,0x1e,0x00,0x0f,0x67,0x10,0x0b,0x00,0x88,0x0a,0x55,0x00,0x00,0xf5,0x33,
-0x32,0xe8,0x0c,0x10,0x12,0xbf,0x0e,0x12,0xed,0xb4,0x02,0x10,0xaf,0x39,0x17,0x02,
-0x1d,0x07,0x1e,0x90,0xc5,0x06,0x02,0x78,0x00,0x10,0xf5,0x78,0x00,0x22,0xf5,0x00,
-0xb5,0x07,0x80,0x50,0x01,0x10,0x00,0x01,0x10,0xae,0xef,0xda,0x01,0x15,0x11,0x0b,
-0x0d,0x30,0x01,0x11,0x1f,0xa3,0x01,0x10,0xfe,0xeb,0x00,0x18,0x01,0xeb,0x00,0x0f,
-0xb9,0x00,0x05,0x43,0x24,0x33,0x33,0x33,0xdc,0x00,0x06,0x13,0x03,0x15,0xe7,0x13,
-0x03,0x14,0x4e,0x13,0x03,0xdb,0x13,0x23,0x10,0xc3,0xed,0xdd,0x70,0xe4,0xf3,0x00,
-0x00,0xe4,0xf2,0x04,0x00,0x61,0xfa,0x89,0xb4,0xe4,0x57,0x76,0x02,0x07,0x17,0xe5,
-0xce,0x09,0x00,0x1e,0x05,0x12,0x3d,0x52,0x05,0x15,0x00,0x04,0x00,0xf2,0x0d,0xed,
-0xcd,0xe3,0x4d,0x12,0x21,0x00,0x3b,0x00,0x3a,0xdc,0x70,0x03,0xf6,0x24,0xd9,0x08,
-0xb0,0x00,0x5e,0x05,0xe2,0x00,0xab,0x00,0x9f,0xef,0xc2,0x1a,0x08,0x00,0x93,0x0c,
-0xf0,0x12,0x22,0x01,0x21,0x4e,0x00,0x3f,0xe5,0xfe,0x94,0xe0,0x03,0xf0,0x1f,0x10,
-0x3e,0x00,0x3e,0x01,0xf1,0x03,0xf0,0x04,0xe0,0x1f,0x10,0x3f,0xc8,0x4e,0x01,0xf1,
-0x03,0xf4,0x24,0x0b,0x00,0xc4,0x00,0x4e,0x32,0xf4,0x33,0xf0,0x01,0xbc,0x5b,0xca,
-0x3f,0x00,0x85,0x03,0x02,0xe7,0x0d,0x27,0x02,0xe0,0x48,0x06,0xd6,0x03,0x31,0x32,
-0x39,0x4b,0x2f,0xbc,0xd8,0x5c,0x4d,0x3e,0x0c,0x50,0x05,0x00,0x20,0x5f,0xfd,0x0a,
-0x00,0xf0,0x00,0x5d,0x3e,0x0c,0x50,0x4c,0x4d,0x3f,0x6c,0xa5,0x4c,0x4d,0x08,0x75,
-0x95,0x4c,0x18,0x03,0x01,0x05,0x00,0x10,0x5c,0x05,0x00,0xf2,0x00,0x26,0x29,0x00,
-0x11,0x00,0x01,0x00,0x0a,0xff,0x8d,0xff,0x60,0x0b,0x70,0x0e,0x63,0x0c,0x00,0x05,
-0x00,0xa0,0x40,0x00,0x0a,0xff,0x9d,0xfe,0x80,0x00,0x11,0x32,0x2d,0x04,0x10,0x98,
-0xbd,0x04,0x40,0xa9,0x11,0x10,0xcf,0xc3,0x01,0xd0,0x01,0xbb,0xa4,0xbb,0x80,0x00,
-0x3f,0x43,0x8c,0x42,0x00,0x04,0xe0,0x90,0x1a,0xf1,0x00,0x4e,0x00,0x8a,0x00,0x00,
-0x02,0xfe,0xd7,0xfd,0xc0,0x00,0x01,0x21,0x02,0x20,0x91,0x03,0x73,0x11,0x06,0xff,
-0xff,0xfe,0xee,0xd0,0x90,0x0e,0x02,0xb9,0x00,0x02,0x0b,0x00,0x15,0xd0,0xfe,0x06,
-0xf0,0x08,0x30,0x23,0x11,0xb0,0x1f,0xd6,0xfd,0x82,0xf0,0x2f,0x01,0xf1,0x02,0xf0,
-0x2f,0x11,0xf2,0x02,0xf0,0x1e,0xf9,0xef,0xb2,0x2c,0x00,0xe1,0x22,0xf0,0x4e,0xee,
-0xff,0xc3,0xf0,0x01,0x1e,0x50,0x02,0xf0,0x00,0x0e,0x05,0x00,0x14,0x40,0x05,0x00,
-0xd1,0x03,0x00,0x00,0x70,0x01,0x11,0x20,0x0b,0x20,0x03,0xff,0xff,0x30,0xad,0x0a,
-0x20,0x0e,0x40,0x19,0x05,0xe0,0xe4,0x00,0x2f,0xff,0xf2,0x0e,0xfe,0x44,0xe0,0x00,
-0x00,0xe5,0x20,0x4e,0x12,0x00,0xb5,0x04,0xe0,0x01,0x30,0xe3,0x00,0x1c,0xff,0xec,
-0x1e,0x30,0x12,0x0a,0x02,0x0e,0x18,0xc0,0x92,0x00,0x02,0x22,0x60,0x0a,0x10,0x02,
-0xdd,0xdf,0x30,0xe4,0x37,0x09,0xf4,0x08,0x0e,0x40,0x01,0xab,0xbf,0x30,0xe5,0x10,
-0x3f,0x55,0x40,0x0e,0xff,0x33,0xf1,0x23,0x50,0xe4,0x00,0x1d,0xed,0xca,0x1e,0x43,
-0x12,0x10,0xc1,0x43,0x12,0x02,0x50,0x08,0x01,0xb1,0x02,0xf0,0x0c,0x0d,0xff,0xff,
-0xe3,0x00,0x2d,0xdd,0xd2,0x0d,0x20,0x00,0x34,0x3f,0x30,0xe3,0x00,0x01,0x22,0xe3,
-0x0e,0x40,0x03,0xfe,0xee,0x20,0xef,0xf4,0x79,0x00,0xb0,0x51,0x03,0xfd,0xdf,0xe1,
-0xe4,0x00,0x02,0x32,0x10,0x08,0xa3,0x04,0x10,0x12,0x83,0x03,0x30,0xfe,0xef,0x40,
-0x42,0x00,0x10,0xe4,0x42,0x00,0x20,0x1e,0x40,0x42,0x00,0x11,0xe2,0xaa,0x0f,0x00,
-0x0a,0x0b,0xf1,0x04,0x20,0xe3,0x00,0x03,0x43,0xf3,0x0e,0x40,0x00,0x12,0x2e,0x30,
-0xe4,0x00,0x3f,0xee,0xe2,0x0e,0xff,0xc6,0x00,0x90,0x10,0x3f,0xbb,0xce,0x1e,0x40,
-0x00,0x34,0x32,0x27,0x0b,0x90,0x07,0xbc,0x92,0x00,0x00,0x09,0xc4,0x39,0xe0,0x92,
-0x00,0x20,0x0f,0x30,0x9e,0x0f,0x78,0xf1,0x00,0x00,0x3d,0xfe,0xd5,0x00,0x0a,0x02,
-0xc0,0x33,0x20,0xa0,0xd2,0x2d,0xdd,0xe1,0xe0,0xe3,0x00,0x04,0xe2,0x05,0x00,0xf4,
-0x0c,0xe1,0xe0,0xe3,0x2c,0xde,0xe1,0xfc,0xf3,0x4f,0x44,0x21,0xe4,0xe3,0x4e,0x00,
-0x01,0xe0,0xe3,0x3f,0x34,0x52,0xe0,0xe3,0x1c,0xcb,0x93,0xe0,0x6e,0x07,0x02,0x73,
-0x07,0xf0,0x07,0x70,0xa2,0x03,0x44,0x30,0x80,0x91,0x0c,0xdd,0xe0,0xf1,0xe3,0x00,
-0x03,0xe0,0xf2,0xe3,0x0e,0xff,0xe0,0xff,0xf3,0x2e,0x0d,0xf5,0x05,0xe3,0x0f,0x55,
-0x62,0xf1,0xe3,0x0a,0xcb,0x92,0xb0,0xe2,0x00,0x02,0x22,0x33,0x30,0x00,0x3e,0xed,
-0xdd,0x4d,0x04,0x02,0x05,0x00,0x02,0x79,0x07,0xb0,0x06,0x66,0x70,0x0b,0x20,0x01,
-0xab,0xaf,0x30,0xe4,0x10,0x95,0x01,0x70,0xee,0x23,0xec,0xbc,0x20,0xe3,0x00,0x11,
-0x01,0xf1,0x09,0xdc,0x13,0xfd,0xdf,0xe1,0xe6,0x20,0x02,0x32,0x10,0x0c,0x20,0x00,
-0x00,0x7b,0xc9,0x20,0x00,0x00,0x9c,0x43,0x9e,0x10,0x00,0xe6,0x05,0xa5,0x00,0xc8,
-0x00,0x4f,0x10,0x00,0x03,0xdf,0xed,0x50,0x17,0x09,0x72,0x30,0x02,0xd1,0xdd,0xcf,
-0x20,0x3e,0xcf,0x12,0xf3,0x0b,0x0f,0x20,0x4e,0x0c,0xdd,0xf3,0xef,0xe2,0xf4,0x43,
-0x00,0x3e,0x2f,0x00,0x00,0x02,0xe1,0xf3,0x34,0x61,0x2f,0x0b,0xdc,0xb9,0x12,0xf0,
-0x35,0x11,0x01,0x0c,0x03,0xf0,0x04,0x19,0x0b,0xcc,0xc1,0x01,0xd0,0x44,0x4f,0x30,
-0x2f,0x00,0x11,0xf3,0x46,0xf1,0xff,0xff,0x4c,0xcf,0x2d,0x00,0xf0,0x15,0xf1,0xfa,
-0xab,0xd3,0x2f,0x03,0x54,0x31,0x00,0xb0,0x05,0xcd,0xdd,0xda,0x00,0x9b,0x33,0x36,
-0xe0,0x09,0xa0,0x00,0x3e,0x00,0x9a,0x00,0x04,0xe0,0x06,0xff,0xff,0xfb,0x0b,0xcc,
-0xc1,0x03,0x36,0x00,0xa0,0x4e,0x00,0x11,0xf3,0x48,0xe1,0xff,0xff,0x4c,0xde,0xd0,
-0x0f,0xf1,0x04,0xe1,0xfd,0xde,0xf3,0x4d,0x01,0x32,0x10,0x01,0x60,0x05,0x60,0x00,
-0x38,0x00,0x8a,0x11,0x16,0xc0,0x10,0x09,0x55,0x89,0x00,0x05,0xc0,0x07,0x8b,0x0b,
-0x10,0x00,0x79,0x24,0xd2,0x33,0x00,0xb1,0xc2,0x5d,0xdf,0x40,0xf3,0xe3,0x00,0x0d,
-0x40,0xe3,0x05,0x00,0xb0,0x2c,0xcf,0x9d,0xf3,0xe3,0x4f,0x33,0x13,0xe3,0xe3,0x4e,
-0x4a,0x0d,0x86,0x3f,0x33,0x51,0xe3,0xe3,0x1c,0xcb,0x91,0x68,0x17,0x14,0xf2,0x71,
-0x01,0xb0,0x00,0x70,0x91,0x0c,0xdf,0x40,0xf2,0xe3,0x00,0x0d,0x51,0x71,0x01,0x41,
-0x7e,0xf2,0xe3,0x1f,0x90,0x0d,0x30,0x55,0x62,0xe3,0x71,0x01,0x15,0xb1,0x71,0x01,
+0xd0,0x07,0x19,0x30,0x3e,0x00,0x00,0x00,0x03,0xe0,0x00,0x12,0x00,0x2f,0xff,0xff,
+0xe3,0x01,0x10,0x09,0x1a,0x1d,0xff,0xa0,0xe3,0xe3,0xf3,0x01,0x2e,0x3e,0x3f,0x30,
+0xdd,0xf3,0xe3,0xf4,0x13,0x0d,0x3e,0x3b,0xfe,0xb2,0xd3,0xe3,0x00,0x00,0x05,0x04,
+0x00,0x3f,0xff,0xff,0xf0,0x00,0x11,0x11,0x2f,0x10,0x1f,0xff,0xff,0xe0,0x02,0xf0,
+0x73,0x00,0x42,0xff,0xff,0xf7,0x00,0x72,0x00,0x72,0x11,0x10,0x00,0x01,0xff,0xff,
+0xea,0x8b,0x00,0x05,0x05,0x00,0x00,0xf0,0x01,0x50,0xfd,0x00,0x00,0x01,0x43,0x0b,
+0x00,0x10,0xa8,0x27,0x00,0xa0,0xb9,0x22,0x21,0xbf,0xee,0xee,0xff,0xfb,0x00,0xdf,
+0x19,0x00,0x10,0xf4,0x5b,0x02,0x11,0xf3,0x28,0x00,0xf0,0x0c,0xee,0xff,0x30,0x00,
+0x01,0xa9,0x10,0x00,0x01,0x11,0x99,0x11,0x10,0xaf,0xff,0xff,0xff,0xfa,0x00,0x11,
+0x11,0x11,0x00,0x02,0xff,0xff,0xef,0x52,0x02,0x25,0x0e,0x40,0x05,0x00,0x03,0x88,
+0x02,0x10,0xef,0x41,0x00,0x10,0xf3,0x41,0x00,0x16,0xf2,0x41,0x00,0x19,0xaa,0x41,
+0x00,0xf0,0x0c,0x00,0x22,0x00,0x00,0x00,0x4e,0xdd,0xf7,0x00,0x00,0xe6,0x00,0x2f,
+0x20,0x00,0xe7,0x00,0x3f,0x20,0x00,0x5e,0xee,0xe7,0x00,0x00,0x00,0x11,0x33,0x00,
+0xf0,0x1c,0x10,0x02,0xa0,0xff,0xff,0xd0,0x3e,0x1f,0x20,0x00,0x03,0xe1,0xf2,0x00,
+0x00,0x3e,0x1f,0x30,0x12,0x03,0xe0,0xdf,0xfe,0xd3,0x3e,0x00,0x04,0x00,0x03,0xf0,
+0x00,0xe3,0x00,0x3f,0x01,0x1e,0x53,0x53,0xf5,0xee,0xed,0xb9,0x3f,0x28,0x01,0x00,
+0xf2,0x00,0x12,0x1b,0x7c,0x00,0xf0,0x09,0x58,0x88,0x70,0xb3,0x00,0xea,0x88,0x70,
+0xc5,0x00,0xe4,0x00,0x00,0xc6,0x00,0xe7,0x44,0x40,0xc6,0x00,0x8c,0xfb,0xa1,0xc6,
+0x81,0x01,0xf1,0x50,0xc6,0x0c,0xcd,0xfe,0xfa,0xc6,0x03,0x44,0x43,0x10,0xc6,0x00,
+0x06,0x10,0x00,0xa4,0x00,0x0d,0x50,0x00,0x00,0x00,0x0d,0x61,0x11,0x10,0x00,0x0b,
+0xff,0xff,0xf9,0x0a,0xdd,0xdc,0x0a,0x40,0xe6,0x33,0x10,0xc6,0x0e,0x40,0x00,0x0c,
+0x60,0xed,0xbc,0xc1,0xc6,0x02,0x5f,0x52,0x0c,0x60,0x01,0xf3,0x43,0xc6,0x8f,0xfe,
+0xec,0x7c,0x60,0x00,0x11,0x11,0x41,0x00,0xdf,0xff,0xff,0x30,0x0e,0x40,0x00,0xe4,
+0x00,0xe5,0x00,0x0e,0x40,0x0b,0xff,0xff,0xe2,0x00,0x34,0x44,0x43,0x00,0x02,0xfc,
+0xcc,0xca,0x00,0x79,0x01,0x01,0x05,0x00,0x52,0x01,0xfe,0xee,0xfc,0x10,0x7a,0x01,
+0xd0,0x00,0x00,0x11,0x21,0x7f,0xff,0xff,0xee,0xe9,0x00,0x00,0x4d,0x00,0xf4,0x00,
+0x23,0x00,0x00,0x0a,0x00,0x3c,0x4c,0x00,0x00,0x2f,0x01,0x10,0xf3,0xfe,0x00,0x50,
+0xdf,0xff,0xfe,0x30,0x01,0x04,0x01,0x81,0x9f,0xff,0xff,0xff,0xe9,0x00,0x01,0xc6,
+0x6b,0x01,0x12,0xff,0x6b,0x01,0x00,0x0a,0x00,0x01,0x25,0x04,0x01,0x14,0x00,0x11,
+0x80,0x40,0x00,0xf0,0x1c,0x03,0x44,0x44,0x02,0xa0,0xed,0xcb,0xa0,0x3e,0x0e,0x40,
+0x00,0x03,0xe0,0xe4,0x01,0x20,0x3f,0x0c,0xff,0xfe,0x43,0xf0,0x00,0x00,0x01,0x3e,
+0x6d,0xde,0xef,0xc3,0xe0,0x22,0xf4,0x00,0x3e,0x00,0x0f,0x30,0x03,0xe0,0x00,0xf2,
+0x09,0x00,0x00,0x3f,0x00,0x3f,0x40,0x00,0x07,0xb8,0x00,0x04,0x21,0xff,0x20,0xb8,
+0x00,0x01,0xab,0x02,0x11,0xaf,0x81,0x00,0x47,0x6b,0x00,0xe3,0x00,0x05,0x00,0x38,
+0x69,0x00,0xd2,0xb8,0x00,0x1c,0xf4,0xb8,0x00,0x13,0x01,0xb8,0x00,0x31,0x3f,0x11,
+0xe5,0xa4,0x00,0x00,0x19,0x02,0x2a,0x1e,0x50,0xb8,0x00,0x12,0x70,0x41,0x00,0x51,
+0x12,0x11,0x20,0x00,0x00,0x0e,0x02,0x01,0x91,0x02,0x06,0x9b,0x02,0x30,0xfe,0xee,
+0xfe,0xdd,0x03,0x03,0x8f,0x04,0xaf,0x24,0x44,0x44,0x44,0x42,0x8c,0xcc,0xcc,0xcc,
+0xc8,0x9b,0x02,0x02,0x00,0xaf,0x00,0x01,0x1e,0x00,0x01,0x28,0x00,0x0f,0x9b,0x02,
+0x04,0xb3,0x0a,0x20,0x00,0xbc,0xcc,0xcb,0x00,0x00,0xf5,0x33,0x32,0x3c,0x00,0x82,
+0xf4,0x11,0x12,0x00,0x00,0xce,0xee,0xed,0xb4,0x02,0x00,0xeb,0x00,0x11,0xfb,0x7a,
+0x02,0x42,0x00,0x90,0x00,0x00,0xb9,0x02,0x41,0x01,0xf3,0x11,0x11,0x5f,0x05,0x12,
+0x70,0x78,0x00,0x10,0xf5,0x78,0x00,0x10,0xf5,0xeb,0x00,0xb0,0xcf,0xff,0xfe,0x50,
+0x01,0x10,0x00,0x01,0x10,0xae,0xef,0xda,0x01,0x02,0x73,0x00,0x00,0xeb,0x00,0x30,
+0x01,0x11,0x1f,0xa3,0x01,0x10,0xfe,0xeb,0x00,0x18,0x01,0xeb,0x00,0x0f,0xb9,0x00,
+0x05,0x43,0x24,0x33,0x33,0x33,0xdc,0x00,0x06,0x13,0x03,0x15,0xe7,0x13,0x03,0x14,
+0x4e,0x13,0x03,0xdb,0x13,0x23,0x10,0xc3,0xed,0xdd,0x70,0xe4,0xf3,0x00,0x00,0xe4,
+0xf2,0x04,0x00,0xe0,0xfa,0x89,0xb4,0xe4,0x57,0x76,0x40,0xe4,0x00,0x00,0x00,0xe5,
+0x00,0x00,0xf8,0x02,0x23,0x00,0x91,0x1e,0x05,0x12,0x3d,0x52,0x05,0x15,0x00,0x04,
+0x00,0xf2,0x0f,0xed,0xcd,0xe3,0x4d,0x12,0x21,0x00,0x3b,0x00,0x3a,0xdc,0x70,0x03,
+0xf6,0x24,0xd9,0x08,0xb0,0x00,0x5e,0x05,0xe2,0x00,0xab,0x00,0x9f,0xef,0xc2,0x00,
+0x00,0x71,0x01,0xf0,0x14,0x20,0x00,0x22,0x01,0x21,0x4e,0x00,0x3f,0xe5,0xfe,0x94,
+0xe0,0x03,0xf0,0x1f,0x10,0x3e,0x00,0x3e,0x01,0xf1,0x03,0xf0,0x04,0xe0,0x1f,0x10,
+0x3f,0xc8,0x4e,0x01,0xf1,0x03,0xf4,0x24,0x0b,0x00,0xc4,0x00,0x4e,0x32,0xf4,0x33,
+0xf0,0x01,0xbc,0x5b,0xca,0x3f,0x00,0x85,0x03,0x21,0x00,0x3f,0x5c,0x05,0x17,0xe0,
+0x48,0x06,0xd6,0x03,0x31,0x32,0x39,0x4b,0x2f,0xbc,0xd8,0x5c,0x4d,0x3e,0x0c,0x50,
+0x05,0x00,0x20,0x5f,0xfd,0x0a,0x00,0xf0,0x00,0x5d,0x3e,0x0c,0x50,0x4c,0x4d,0x3f,
+0x6c,0xa5,0x4c,0x4d,0x08,0x75,0x95,0x4c,0x18,0x03,0x01,0x05,0x00,0x10,0x5c,0x05,
+0x00,0xf0,0x06,0x26,0x29,0x00,0x11,0x00,0x01,0x00,0x0a,0xff,0x8d,0xff,0x60,0x0b,
+0x70,0x0e,0x40,0x00,0x0b,0x70,0x0f,0x30,0x05,0x00,0xa0,0x40,0x00,0x0a,0xff,0x9d,
+0xfe,0x80,0x00,0x11,0x32,0x2d,0x04,0x10,0x98,0xbd,0x04,0x40,0xa9,0x11,0x10,0xcf,
+0xc3,0x01,0xf0,0x00,0x01,0xbb,0xa4,0xbb,0x80,0x00,0x3f,0x43,0x8c,0x42,0x00,0x04,
+0xe0,0x08,0xa0,0x70,0x03,0xd1,0x8a,0x00,0x00,0x02,0xfe,0xd7,0xfd,0xc0,0x00,0x01,
+0x21,0x02,0x20,0x91,0x03,0xa6,0x11,0x06,0xff,0xff,0xfe,0xee,0xd0,0x00,0x00,0x3e,
+0xb9,0x00,0x02,0x0b,0x00,0x15,0xd0,0xfe,0x06,0xf0,0x08,0x30,0x23,0x11,0xb0,0x1f,
+0xd6,0xfd,0x82,0xf0,0x2f,0x01,0xf1,0x02,0xf0,0x2f,0x11,0xf2,0x02,0xf0,0x1e,0xf9,
+0xef,0xb2,0x2c,0x00,0xe1,0x22,0xf0,0x4e,0xee,0xff,0xc3,0xf0,0x01,0x1e,0x50,0x02,
+0xf0,0x00,0x0e,0x05,0x00,0x14,0x40,0x05,0x00,0xd0,0x03,0x00,0x00,0x70,0x01,0x11,
+0x20,0x0b,0x20,0x03,0xff,0xff,0x30,0x2e,0x06,0x30,0xe3,0x0e,0x40,0x19,0x05,0xe0,
+0xe4,0x00,0x2f,0xff,0xf2,0x0e,0xfe,0x44,0xe0,0x00,0x00,0xe5,0x20,0x4e,0x12,0x00,
+0xa1,0x04,0xe0,0x01,0x30,0xe3,0x00,0x1c,0xff,0xec,0x1e,0x82,0x02,0x24,0xe3,0x00,
+0xab,0x02,0xc0,0x00,0x92,0x00,0x02,0x22,0x60,0x0a,0x10,0x02,0xdd,0xdf,0x30,0xcc,
+0x01,0xf2,0x0b,0xf3,0x0e,0x40,0x01,0xab,0xbf,0x30,0xe5,0x10,0x3f,0x55,0x40,0x0e,
+0xff,0x33,0xf1,0x23,0x50,0xe4,0x00,0x1d,0xed,0xca,0x1e,0x40,0x00,0xed,0x01,0x40,
+0xc1,0x00,0x0d,0x30,0x19,0x08,0x00,0x2b,0x00,0x00,0xb1,0x02,0xf0,0x0c,0x0d,0xff,
+0xff,0xe3,0x00,0x2d,0xdd,0xd2,0x0d,0x20,0x00,0x34,0x3f,0x30,0xe3,0x00,0x01,0x22,
+0xe3,0x0e,0x40,0x03,0xfe,0xee,0x20,0xef,0xf4,0x79,0x00,0xb0,0x51,0x03,0xfd,0xdf,
+0xe1,0xe4,0x00,0x02,0x32,0x10,0x08,0xa3,0x04,0x10,0x12,0x83,0x03,0x30,0xfe,0xef,
+0x40,0x42,0x00,0x10,0xe4,0x42,0x00,0x20,0x1e,0x40,0x42,0x00,0x11,0xe2,0x05,0x01,
+0xf1,0x08,0x00,0x02,0xdd,0xdd,0x20,0xe3,0x00,0x03,0x43,0xf3,0x0e,0x40,0x00,0x12,
+0x2e,0x30,0xe4,0x00,0x3f,0xee,0xe2,0x0e,0xff,0xc6,0x00,0xf0,0x07,0x10,0x3f,0xbb,
+0xce,0x1e,0x40,0x00,0x34,0x32,0x00,0xb2,0x00,0x00,0x07,0xbc,0x92,0x00,0x00,0x09,
+0xc4,0x39,0xe0,0x92,0x00,0xd8,0x0f,0x30,0x00,0x0c,0x80,0x04,0xf1,0x00,0x00,0x3d,
+0xfe,0xd5,0x00,0x0a,0x02,0xc0,0x33,0x20,0xa0,0xd2,0x2d,0xdd,0xe1,0xe0,0xe3,0x00,
+0x04,0xe2,0x05,0x00,0xf4,0x0c,0xe1,0xe0,0xe3,0x2c,0xde,0xe1,0xfc,0xf3,0x4f,0x44,
+0x21,0xe4,0xe3,0x4e,0x00,0x01,0xe0,0xe3,0x3f,0x34,0x52,0xe0,0xe3,0x1c,0xcb,0x93,
+0xe0,0x6e,0x07,0x02,0x73,0x07,0xf5,0x1f,0x70,0xa2,0x03,0x44,0x30,0x80,0x91,0x0c,
+0xdd,0xe0,0xf1,0xe3,0x00,0x03,0xe0,0xf2,0xe3,0x0e,0xff,0xe0,0xff,0xf3,0x1f,0x20,
+0x00,0xf2,0xe3,0x0f,0x55,0x62,0xf1,0xe3,0x0a,0xcb,0x92,0xb0,0xe2,0x00,0x02,0x22,
+0x33,0x30,0x00,0x3e,0xed,0xdd,0x4d,0x04,0x02,0x05,0x00,0x02,0x79,0x07,0xb0,0x06,
+0x66,0x70,0x0b,0x20,0x01,0xab,0xaf,0x30,0xe4,0x10,0x95,0x01,0x70,0xee,0x23,0xec,
+0xbc,0x20,0xe3,0x00,0x11,0x01,0xf1,0x09,0xdc,0x13,0xfd,0xdf,0xe1,0xe6,0x20,0x02,
+0x32,0x10,0x0c,0x20,0x00,0x00,0x7b,0xc9,0x20,0x00,0x00,0x9c,0x43,0x9e,0x10,0x00,
+0xe6,0x05,0xa5,0x00,0xc8,0x00,0x4f,0x10,0x00,0x03,0xdf,0xed,0x50,0x17,0x09,0xf0,
+0x17,0x30,0x02,0xd1,0xdd,0xcf,0x20,0x3e,0x00,0x00,0xf2,0x03,0xe0,0x00,0x0f,0x20,
+0x4e,0x0c,0xdd,0xf3,0xef,0xe2,0xf4,0x43,0x00,0x3e,0x2f,0x00,0x00,0x02,0xe1,0xf3,
+0x34,0x61,0x2f,0x0b,0xdc,0xb9,0x12,0x76,0x00,0x14,0x2f,0x0c,0x03,0xf0,0x04,0x19,
+0x0b,0xcc,0xc1,0x01,0xd0,0x44,0x4f,0x30,0x2f,0x00,0x11,0xf3,0x46,0xf1,0xff,0xff,
+0x4c,0xcf,0x2d,0x00,0xf0,0x15,0xf1,0xfa,0xab,0xd3,0x2f,0x03,0x54,0x31,0x00,0xb0,
+0x05,0xcd,0xdd,0xda,0x00,0x9b,0x33,0x36,0xe0,0x09,0xa0,0x00,0x3e,0x00,0x9a,0x00,
+0x04,0xe0,0x06,0xff,0xff,0xfb,0x0b,0xcc,0xc1,0x03,0x36,0x00,0xf1,0x12,0x4e,0x00,
+0x11,0xf3,0x48,0xe1,0xff,0xff,0x4c,0xde,0x2f,0x00,0x00,0x04,0xe1,0xfd,0xde,0xf3,
+0x4d,0x01,0x32,0x10,0x01,0x60,0x05,0x60,0x00,0x38,0x00,0x8a,0x11,0x16,0xc0,0x10,
+0x09,0x51,0x89,0x00,0x05,0xc0,0x07,0x4e,0x05,0x04,0x01,0x00,0xe2,0x13,0x33,0x00,
+0xb1,0xc2,0x5d,0xdf,0x40,0xf3,0xe3,0x00,0x0d,0x40,0xe3,0x05,0x00,0xf0,0x09,0x2c,
+0xcf,0x9d,0xf3,0xe3,0x4f,0x33,0x13,0xe3,0xe3,0x4e,0x00,0x00,0xe3,0xe3,0x3f,0x33,
+0x51,0xe3,0xe3,0x1c,0xcb,0x91,0xe2,0x67,0x01,0x01,0x05,0x00,0x14,0xf2,0x71,0x01,
+0xb0,0x00,0x70,0x91,0x0c,0xdf,0x40,0xf2,0xe3,0x00,0x0d,0x51,0x71,0x01,0x70,0x7e,
+0xf2,0xe3,0x1f,0x20,0x00,0xe3,0x71,0x01,0x10,0xe3,0x71,0x01,0x15,0xb1,0x71,0x01,
 0x1a,0xde,0x59,0x08,0x27,0x01,0xf0,0x45,0x0a,0xf0,0x13,0x34,0x00,0xe3,0xb1,0x0c,
 0xdf,0x40,0xe3,0xf2,0x00,0x0d,0x50,0xe3,0xf2,0x0e,0xef,0x7e,0xf3,0xf2,0x1f,0x31,
 0x00,0xe3,0xf2,0x0f,0x31,0x30,0xe3,0xf2,0x0d,0xfe,0xc2,0xe3,0xf2,0xfc,0x02,0x80,
-0xf2,0x00,0x47,0x00,0x91,0xe1,0x00,0x6a,0x33,0x00,0x10,0x6a,0x66,0x18,0x40,0x4f,
-0xff,0xff,0xe0,0x6a,0x01,0x30,0xc0,0xcd,0xdf,0x0a,0x09,0xf0,0x0f,0xe4,0x9b,0xe0,
-0x00,0x0f,0x46,0x8e,0x0c,0xdd,0xf3,0x02,0xe2,0xf5,0x43,0x04,0x6e,0x2f,0x10,0x01,
-0xbc,0xe2,0xf4,0x34,0x61,0x2e,0x0c,0xdc,0xb9,0x12,0xe0,0xd8,0x1f,0x09,0x6a,0x01,
-0xf2,0x17,0xb0,0x44,0x4f,0x48,0x9f,0x00,0x00,0xf4,0xab,0xf1,0xff,0xff,0x20,0x2f,
-0x2f,0x10,0x02,0xff,0xf1,0xf3,0x34,0x63,0x5f,0x0b,0xdc,0xb9,0x02,0xf0,0x00,0x12,
-0x22,0x24,0x00,0x6e,0xee,0xee,0xe0,0x00,0xed,0x1b,0x16,0x04,0xa9,0x17,0x01,0xff,
-0x05,0xf2,0x0f,0x0b,0xcc,0xc1,0x02,0xe0,0x04,0x44,0xf5,0xcd,0xf0,0x06,0x77,0xf3,
-0x35,0xf0,0x1f,0x98,0x83,0xde,0xf0,0x1f,0x22,0x35,0x35,0xf0,0x0d,0xfe,0xdb,0x22,
-0xe0,0x28,0x00,0x11,0x4e,0xdb,0x1a,0x50,0x22,0x15,0xf0,0x00,0x6f,0x0a,0x00,0x10,
-0x8b,0x76,0x03,0x10,0x6f,0x18,0x19,0x03,0x71,0x09,0x01,0x36,0x06,0x03,0x90,0x15,
-0x10,0x01,0x0a,0x00,0xf6,0x04,0x02,0xf1,0x11,0x10,0x00,0x02,0xf3,0x33,0x45,0x10,
-0x00,0xbc,0xdc,0xcb,0x30,0x00,0x00,0x88,0x00,0x0d,0x09,0x41,0xf9,0x00,0xde,0xef,
-0x14,0x0d,0x22,0x1f,0x20,0x0a,0x00,0x01,0x18,0x0e,0xe1,0xee,0xee,0xef,0x50,0x00,
-0x01,0x8c,0x11,0x00,0x9d,0xdd,0xef,0xdd,0xd9,0x2d,0x13,0x11,0x02,0xea,0x0b,0x35,
-0x11,0x11,0x1e,0xd6,0x06,0xc0,0x0b,0x20,0x00,0x9a,0xaa,0xaa,0x00,0x00,0x34,0x43,
-0x4f,0x10,0x9a,0x08,0x12,0x10,0x63,0x06,0x11,0xef,0x3c,0x00,0x73,0x8b,0x10,0x00,
-0x8c,0xcb,0xde,0xbb,0x17,0x07,0x01,0x36,0x0e,0x03,0x86,0x14,0x13,0x12,0xd6,0x06,
-0x21,0xad,0xdd,0xc8,0x0d,0x13,0x5f,0x3c,0x00,0xf2,0x04,0xe8,0x44,0x44,0x10,0x00,
-0x8c,0xdf,0xcc,0x40,0x37,0x77,0x9f,0x77,0x75,0x26,0x66,0x66,0x66,0x53,0x73,0x00,
-0x42,0x12,0x22,0x1e,0x40,0xe1,0x13,0x04,0x8b,0x11,0x02,0xd6,0x06,0x00,0xfe,0x15,
-0x30,0x10,0x00,0x12,0xf9,0x1b,0x03,0x7d,0x00,0x14,0x12,0x87,0x1c,0x22,0x7b,0x00,
-0x44,0x16,0x30,0x01,0x11,0x24,0xa4,0x05,0x10,0x8b,0xff,0x03,0x00,0x36,0x00,0x9f,
-0x6f,0x52,0xda,0x00,0x04,0xb3,0x00,0x1a,0x70,0x27,0x01,0x0d,0xd2,0xcc,0xcb,0x30,
-0x00,0x0d,0x01,0xd0,0x00,0x01,0x2f,0x33,0xf2,0x20,0x27,0x01,0x30,0xdd,0xde,0xec,
-0x2b,0x0d,0xb0,0x3f,0x00,0x01,0xbc,0xcc,0xcf,0x00,0x02,0xf4,0x44,0x42,0x32,0x00,
-0x53,0x12,0x00,0x01,0xde,0xfe,0xc6,0x07,0x12,0x7f,0x73,0x00,0x1a,0x5d,0x69,0x09,
-0x69,0x39,0x00,0x00,0x00,0xcd,0xde,0xaa,0x00,0x32,0xf3,0x11,0x00,0x63,0x01,0x43,
-0x01,0x12,0x33,0x22,0x93,0x0a,0x91,0x10,0x7b,0x01,0x00,0x01,0xf0,0x35,0x0d,0x30,
-0x76,0x12,0x04,0x95,0x14,0x04,0x14,0x0d,0x30,0xdd,0xde,0xeb,0x7d,0x00,0x10,0x7e,
-0x7d,0x00,0x15,0xde,0x7d,0x00,0x17,0x23,0x7d,0x00,0x10,0xae,0x6b,0x17,0x40,0x02,
-0x7c,0x11,0xe4,0xd3,0x15,0x04,0x2e,0x09,0x10,0x37,0x8b,0x07,0x10,0xcd,0x68,0x01,
-0x35,0x13,0x32,0x3f,0x27,0x01,0x01,0x2e,0x09,0x63,0xff,0x50,0x01,0x10,0x11,0x00,
-0x03,0x02,0x34,0x0f,0x30,0xf2,0xee,0x12,0x05,0x25,0x13,0x10,0xdf,0x60,0x12,0x02,
-0x27,0x01,0x22,0xfe,0xee,0xa4,0x06,0x02,0x27,0x01,0x10,0xf2,0x59,0x0a,0x30,0xf1,
-0x11,0x12,0x46,0x00,0x03,0x7d,0x00,0xe0,0x02,0x11,0x11,0x12,0x20,0xaf,0xee,0xee,
-0xee,0xf9,0x00,0xaa,0xaa,0xa9,0x12,0x02,0x11,0x6f,0xe1,0x00,0xf4,0x04,0x00,0x02,
-0xf3,0x22,0x21,0x00,0x01,0xfd,0xcc,0xdd,0x40,0x00,0x13,0x33,0x32,0x00,0x8c,0xcb,
-0xbb,0x12,0x02,0x1d,0x70,0xf3,0x15,0x21,0x60,0x00,0x4a,0x19,0x33,0x24,0x33,0x6f,
-0x1e,0x0c,0x02,0x24,0x09,0x9f,0xff,0xee,0x40,0x57,0x66,0x66,0x66,0x75,0x46,0x12,
-0x02,0x10,0x30,0xee,0xee,0xed,0x0f,0x11,0x11,0x4f,0x47,0x1e,0x00,0xa5,0x00,0x10,
-0x10,0xce,0x09,0x20,0xef,0x30,0xf9,0x1b,0x16,0x00,0x2a,0x10,0x10,0x03,0x01,0x14,
-0xa2,0x04,0xe2,0x22,0x1e,0x40,0x04,0xe0,0x00,0x0e,0x30,0x33,0x09,0x70,0x33,0x30,
-0x04,0xb2,0xdd,0xdf,0x30,0x63,0x1b,0xf3,0x0e,0x05,0xd0,0x00,0x0e,0x40,0x5d,0x0c,
-0xdd,0xf3,0x05,0xd2,0xf5,0x43,0x00,0x5d,0x2f,0x10,0x00,0x05,0xd1,0xf3,0x23,0x52,
-0x5d,0x0b,0xdc,0xba,0x25,0xd0,0xa7,0x17,0x20,0x05,0xd0,0xe2,0x18,0xf0,0x12,0x0b,
-0xcc,0xc1,0x08,0x50,0x44,0x4f,0x30,0xb7,0x00,0x11,0xe3,0x0b,0x70,0xff,0xff,0x20,
-0xb6,0x1f,0x10,0x00,0x0b,0x60,0xfc,0xcd,0xf3,0xb6,0x02,0x43,0x20,0x07,0x30,0x01,
-0x83,0x14,0x01,0x4d,0x03,0x20,0x00,0x00,0x72,0x2c,0x01,0x6c,0x19,0x11,0xc5,0xdd,
-0x06,0xf0,0x11,0x17,0x77,0x70,0x03,0xb1,0x99,0x9f,0x30,0x4d,0x00,0x00,0xe4,0x04,
-0xd0,0xcd,0xdf,0x30,0x4d,0x1f,0x33,0x20,0x04,0xd1,0xf2,0x12,0x41,0x4d,0x0d,0xee,
-0xdb,0x35,0xd0,0x88,0x08,0x60,0x00,0x94,0x00,0x03,0x90,0x0c,0x3d,0x00,0x40,0xc6,
-0x11,0x11,0x10,0x80,0x0e,0x00,0x95,0x05,0x12,0xb0,0x95,0x05,0x80,0xe3,0x04,0xe0,
-0xff,0xff,0x20,0x4d,0x1f,0x01,0x1c,0xf7,0x10,0xfb,0xbc,0xe3,0x4d,0x02,0x43,0x20,
-0x02,0x80,0x07,0xcd,0xdd,0xd9,0x00,0xb8,0x33,0x37,0xd0,0x0b,0x60,0x00,0x5d,0x00,
-0xb6,0x00,0x05,0xd0,0x08,0xff,0xff,0xf9,0xcb,0x05,0x08,0x36,0x00,0xf0,0x04,0xfd,
-0xdf,0xf3,0x4d,0x01,0x22,0x10,0x01,0x50,0x07,0x40,0x00,0x29,0x00,0xa7,0x11,0x15,
-0xd0,0x0a,0x79,0x01,0x57,0xa6,0x00,0x04,0xd0,0x09,0x60,0x13,0x91,0x00,0x10,0xbc,
-0xcc,0x10,0x4d,0x04,0x44,0xf3,0x2e,0x01,0xf0,0x1b,0x4e,0x0f,0xff,0xf2,0x04,0xe1,
-0xf1,0x00,0x00,0x4d,0x1f,0x54,0x57,0x24,0xd0,0x9c,0xba,0x81,0x4d,0x00,0x00,0x0a,
-0x04,0xc0,0x00,0x06,0xe0,0x00,0x00,0x01,0xef,0x70,0x00,0x01,0xda,0x3e,0x90,0x00,
-0xe9,0x00,0x1c,0xa0,0x8f,0x0b,0x04,0xd6,0x04,0x21,0x04,0xd0,0x40,0x00,0x00,0x07,
-0x0f,0x10,0xe0,0x41,0x00,0x11,0xd0,0x81,0x00,0xf0,0x07,0x0f,0x99,0xac,0x34,0xd0,
-0x04,0x55,0x42,0x03,0xb0,0x00,0x03,0xad,0xc8,0x00,0x00,0x2e,0x62,0x4c,0xb0,0x00,
-0x6b,0x14,0x09,0x96,0x4e,0x10,0x08,0xd0,0x00,0x08,0xfe,0xfd,0x30,0x4f,0x1c,0x00,
-0xa0,0x20,0x50,0xd2,0x00,0x2f,0xbb,0xf2,0x60,0x10,0x20,0x0e,0x30,0x57,0x0c,0x00,
-0x5b,0x08,0x50,0xe0,0x0e,0x30,0xee,0xd4,0x0b,0x00,0x40,0x63,0x03,0xe0,0x0e,0x24,
-0x08,0x10,0x66,0x2f,0x08,0x28,0x89,0x88,0xe2,0x20,0x11,0xe4,0xbf,0x23,0x10,0x20,
-0x3f,0x07,0xb0,0x0a,0x10,0x03,0xfd,0xdf,0x20,0xf3,0x00,0x4e,0x00,0xf3,0x95,0x0c,
-0x80,0x0f,0x30,0xff,0xf3,0x3e,0x00,0xe3,0x0f,0x05,0x02,0x50,0x30,0xf3,0x00,0x00,
-0x10,0xda,0x20,0x10,0x02,0xb6,0x01,0x4e,0x03,0xee,0xdd,0xdf,0x32,0x11,0x05,0x87,
-0x07,0x20,0x0b,0x20,0x48,0x00,0x30,0xe4,0x00,0x3e,0x22,0x09,0x00,0x48,0x00,0x11,
-0xe4,0x90,0x00,0xb4,0xff,0x32,0xf3,0x3e,0x30,0xe4,0x00,0x1d,0xdd,0xc2,0x0e,0x59,
-0x09,0x31,0xe1,0x00,0x0d,0xe5,0x10,0x01,0x22,0x09,0x11,0x12,0x22,0x09,0x1b,0xe4,
-0x8a,0x00,0x20,0x0e,0x51,0x42,0x00,0x20,0xef,0xf3,0x42,0x00,0xf3,0x18,0x30,0x02,
-0xfd,0xdf,0x30,0xc2,0x00,0x01,0x11,0x05,0xba,0x20,0x00,0x26,0x00,0x45,0x63,0x00,
-0x05,0xc0,0x2a,0xaa,0xa1,0x00,0x5c,0x00,0x8e,0xe4,0x00,0x05,0xd5,0x4e,0x38,0x90,
-0x00,0x19,0x85,0x7e,0xd3,0x8a,0x00,0xf0,0x0f,0x66,0x66,0x00,0xe2,0x00,0x3f,0x99,
-0xf3,0x0f,0x30,0x04,0xe0,0x0f,0x30,0xf7,0x40,0x3e,0x00,0xf3,0x0f,0xcb,0x13,0xf2,
-0x2e,0x30,0xf3,0x00,0x1d,0xed,0xd2,0xb6,0x00,0x00,0x6c,0x21,0x14,0x00,0xdd,0x22,
-0x13,0xf3,0x0b,0x00,0x22,0x1f,0x10,0x84,0x0f,0x0a,0x38,0x16,0x0a,0x4d,0x00,0x20,
-0xf3,0x00,0x4d,0x00,0xf0,0x00,0xff,0x33,0xe0,0x0e,0x30,0xf3,0x00,0x2f,0xee,0xf3,
-0x0f,0x30,0x00,0x22,0x21,0xb8,0x03,0x00,0xbb,0x0d,0x40,0x00,0x0b,0xbb,0xbf,0xa3,
-0x02,0xe9,0x2c,0xc1,0x00,0x00,0x01,0x8e,0xdc,0x40,0x00,0x04,0xe9,0x10,0x6d,0x80,
-0xc1,0x11,0xa5,0x20,0xb0,0xd2,0x0f,0xdd,0xe1,0xf1,0xe3,0x1f,0x13,0x05,0x00,0xb0,
-0x03,0xe1,0xfc,0xf3,0x1f,0x03,0xe1,0xf4,0xf3,0x1f,0x03,0x0f,0x00,0x71,0x9a,0xe1,
-0xf1,0xe3,0x06,0x76,0x51,0xdd,0x10,0x04,0x05,0x00,0x00,0xe2,0x10,0xe0,0x04,0x55,
-0x40,0x90,0xa4,0x1f,0xbc,0xe0,0xf2,0xb6,0x1f,0x03,0xf0,0xf3,0x05,0x00,0xf0,0x02,
-0xfe,0xf6,0x1f,0x03,0xf0,0xe3,0xb6,0x0f,0xee,0xe0,0xe2,0xb6,0x01,0x11,0x00,0x60,
-0x62,0x44,0x12,0x70,0x83,0x00,0x0e,0x41,0x11,0xc5,0x00,0x09,0x19,0x00,0xfd,0x0f,
-0x25,0xc5,0x00,0x0a,0x19,0xe0,0x05,0x66,0x50,0xb0,0xc2,0x1f,0xab,0xf0,0xf2,0xe3,
-0x1f,0x02,0xf0,0xf3,0x05,0x00,0xf0,0x01,0xfe,0xf3,0x1f,0x02,0xf0,0xe3,0xe3,0x1f,
-0xdd,0xf0,0xe2,0xe3,0x02,0x33,0x10,0x80,0xba,0x10,0x32,0x70,0x60,0x00,0xaf,0x2f,
-0xd6,0x8e,0xf7,0x00,0x00,0x07,0xe3,0x3e,0x90,0x00,0x5c,0x20,0x01,0xb5,0xc3,0x00,
-0xf1,0x08,0x44,0x45,0x00,0x2d,0x2f,0xbb,0xf2,0x03,0xe3,0xf0,0x0e,0x30,0x3e,0x3f,
-0x00,0xe3,0x04,0xe3,0xe0,0x0e,0x3f,0xfe,0x3e,0x09,0x00,0x00,0x12,0x00,0x62,0x77,
-0xf3,0x03,0xf0,0x89,0x88,0x71,0x1f,0x06,0x09,0x19,0xf1,0x11,0x02,0x33,0x30,0x03,
-0xc1,0xfd,0xdf,0x20,0x4e,0x2f,0x00,0xf3,0x03,0xe2,0xf0,0x0f,0x3e,0xfe,0x1f,0x00,
-0xe3,0x04,0xe1,0xf4,0x3e,0x30,0x3e,0x0c,0xdd,0xc2,0x04,0xe0,0x1d,0x06,0x60,0x4b,
-0x00,0x02,0xb0,0x05,0xc0,0xe3,0x03,0xf1,0x14,0x11,0x11,0x10,0x03,0xef,0xff,0xeb,
-0x02,0x33,0x30,0x01,0x90,0x1f,0xdd,0xf2,0x03,0xf0,0x2f,0x00,0xf3,0x14,0xf0,0x1f,
-0x00,0xf5,0xee,0xf0,0x1f,0x10,0xe3,0x03,0xf0,0x0f,0xff,0xe2,0x5d,0x00,0x41,0x01,
-0x50,0x00,0x4f,0xe5,0x07,0x30,0x10,0x04,0xe0,0x6a,0x06,0x58,0xb0,0x00,0x99,0x00,
-0x00,0xf9,0x07,0x01,0x75,0x01,0xe2,0x22,0x20,0xa1,0xd2,0x0f,0xde,0xe0,0xe3,0xe3,
+0xf2,0x00,0x47,0x00,0x91,0xe1,0x00,0x6a,0x33,0x00,0x90,0x6a,0x00,0x01,0x10,0x00,
+0x4f,0xff,0xff,0xe0,0x6a,0x01,0x30,0xc0,0xcd,0xdf,0x0a,0x09,0xf0,0x0e,0xe4,0x9b,
+0xe0,0x00,0x0f,0x46,0x8e,0x0c,0xdd,0xf3,0x02,0xe2,0xf5,0x43,0x04,0x6e,0x2f,0x10,
+0x01,0xbc,0xe2,0xf4,0x34,0x61,0x2e,0x0c,0xdc,0xb9,0x12,0x61,0x01,0x19,0x2e,0x6a,
+0x01,0xf0,0x15,0xb0,0x44,0x4f,0x48,0x9f,0x00,0x00,0xf4,0xab,0xf1,0xff,0xff,0x20,
+0x2f,0x2f,0x10,0x02,0xff,0xf1,0xf3,0x34,0x63,0x5f,0x0b,0xdc,0xb9,0x02,0xf0,0x00,
+0x12,0x22,0x24,0x00,0x6e,0xee,0xee,0x2d,0x00,0x64,0x4f,0x00,0x00,0x00,0x04,0xf0,
+0xfd,0x03,0x11,0x20,0xff,0x05,0xf2,0x0f,0x0b,0xcc,0xc1,0x02,0xe0,0x04,0x44,0xf5,
+0xcd,0xf0,0x06,0x77,0xf3,0x35,0xf0,0x1f,0x98,0x83,0xde,0xf0,0x1f,0x22,0x35,0x35,
+0xf0,0x0d,0xfe,0xdb,0x22,0xe0,0x28,0x00,0x10,0x4e,0x57,0x0a,0x60,0x02,0x22,0x15,
+0xf0,0x00,0x6f,0x0a,0x00,0x40,0x8b,0x11,0x11,0x00,0x0a,0x00,0x14,0xe0,0x71,0x09,
+0x01,0x36,0x06,0x12,0xfe,0x0f,0x05,0x10,0x01,0x0a,0x00,0xf6,0x04,0x02,0xf1,0x11,
+0x10,0x00,0x02,0xf3,0x33,0x45,0x10,0x00,0xbc,0xdc,0xcb,0x30,0x00,0x00,0x88,0x00,
+0x0d,0x09,0x60,0xf9,0x00,0xde,0xef,0xff,0x10,0x3b,0x06,0x12,0x20,0x0a,0x00,0x10,
+0xf4,0x41,0x00,0xf1,0x05,0xee,0xee,0xef,0x50,0x00,0x01,0x8c,0x11,0x00,0x9d,0xdd,
+0xef,0xdd,0xd9,0x01,0x11,0x11,0x11,0x20,0x02,0xea,0x0b,0x35,0x11,0x11,0x1e,0xd6,
+0x06,0xc0,0x0b,0x20,0x00,0x9a,0xaa,0xaa,0x00,0x00,0x34,0x43,0x4f,0x10,0x9a,0x08,
+0x12,0x10,0x63,0x06,0x11,0xef,0x3c,0x00,0x73,0x8b,0x10,0x00,0x8c,0xcb,0xde,0xbb,
+0x17,0x07,0x15,0x80,0x9f,0x01,0x33,0xf2,0x11,0x12,0xd6,0x06,0x30,0xad,0xdd,0xdd,
+0x5e,0x07,0x13,0x5f,0x3c,0x00,0xf2,0x04,0xe8,0x44,0x44,0x10,0x00,0x8c,0xdf,0xcc,
+0x40,0x37,0x77,0x9f,0x77,0x75,0x26,0x66,0x66,0x66,0x53,0x73,0x00,0x41,0x12,0x22,
+0x1e,0x40,0x83,0x08,0x48,0x03,0xf1,0x11,0x11,0xd6,0x06,0x94,0xce,0xee,0xee,0x10,
+0x00,0x12,0x22,0x2f,0x20,0x7d,0x00,0x11,0x12,0x1c,0x07,0x42,0x40,0x00,0x00,0x7b,
+0x53,0x07,0x40,0xfa,0x01,0x11,0x24,0xa4,0x05,0x10,0x8b,0xff,0x03,0x00,0x36,0x00,
+0x9f,0x6f,0x52,0xda,0x00,0x04,0xb3,0x00,0x1a,0x70,0x27,0x01,0x0d,0xd2,0xcc,0xcb,
+0x30,0x00,0x0d,0x01,0xd0,0x00,0x01,0x2f,0x33,0xf2,0x20,0x27,0x01,0x30,0xdd,0xde,
+0xec,0x2b,0x0d,0xb0,0x3f,0x00,0x01,0xbc,0xcc,0xcf,0x00,0x02,0xf4,0x44,0x42,0x32,
+0x00,0x53,0x12,0x00,0x01,0xde,0xfe,0xc6,0x07,0x12,0x7f,0x73,0x00,0x1a,0x5d,0x69,
+0x09,0x69,0x39,0x00,0x00,0x00,0xcd,0xde,0xaa,0x00,0x32,0xf3,0x11,0x00,0x63,0x01,
+0x43,0x01,0x12,0x33,0x22,0x93,0x0a,0xa0,0x10,0x7b,0x01,0x00,0x01,0xf0,0x35,0x0d,
+0x30,0x01,0xeb,0x00,0x66,0x01,0xf1,0x11,0x1e,0x30,0x01,0x14,0x0d,0x30,0xdd,0xde,
+0xeb,0x7d,0x00,0x10,0x7e,0x7d,0x00,0x15,0xde,0x7d,0x00,0x17,0x23,0x7d,0x00,0xc5,
+0xae,0xee,0xee,0xef,0xf9,0x02,0x7c,0x11,0xe4,0x00,0x00,0x6c,0x2e,0x09,0x10,0x37,
+0x8b,0x07,0x10,0xcd,0x68,0x01,0x35,0x13,0x32,0x3f,0x27,0x01,0x01,0x2e,0x09,0x63,
+0xff,0x50,0x01,0x10,0x11,0x00,0x03,0x02,0x41,0x0f,0x30,0xf2,0x00,0x78,0x00,0x20,
+0x02,0xf1,0x49,0x06,0x00,0x05,0x00,0x00,0x51,0x09,0x13,0x20,0x27,0x01,0x22,0xfe,
+0xee,0xa4,0x06,0x02,0x27,0x01,0x10,0xf2,0x59,0x0a,0x30,0xf1,0x11,0x12,0x46,0x00,
+0x03,0x7d,0x00,0xe0,0x02,0x11,0x11,0x12,0x20,0xaf,0xee,0xee,0xee,0xf9,0x00,0xaa,
+0xaa,0xa9,0x12,0x02,0x11,0x6f,0xe1,0x00,0xf4,0x04,0x00,0x02,0xf3,0x22,0x21,0x00,
+0x01,0xfd,0xcc,0xdd,0x40,0x00,0x13,0x33,0x32,0x00,0x8c,0xcb,0xbb,0x12,0x02,0x01,
+0xc4,0x01,0x03,0x0b,0x09,0x02,0xe8,0x08,0xa3,0x60,0x00,0xcd,0xdd,0xdc,0x00,0x00,
+0x24,0x33,0x6f,0x1e,0x0c,0x02,0x24,0x09,0x9f,0xff,0xee,0x40,0x57,0x66,0x66,0x66,
+0x75,0x46,0x12,0x02,0x10,0x80,0xee,0xee,0xed,0x00,0x00,0x12,0x21,0x4f,0xaa,0x00,
+0x10,0xff,0xa5,0x00,0x10,0x10,0xce,0x09,0x62,0xef,0x30,0x00,0x01,0x22,0x10,0x12,
+0x02,0x02,0x0b,0x06,0xe2,0xef,0xff,0xfe,0x20,0x04,0xe2,0x22,0x1e,0x40,0x04,0xe0,
+0x00,0x0e,0x30,0x33,0x09,0xf0,0x18,0x33,0x30,0x04,0xb2,0xdd,0xdf,0x30,0x5d,0x00,
+0x00,0xe4,0x05,0xd0,0x00,0x0e,0x40,0x5d,0x0c,0xdd,0xf3,0x05,0xd2,0xf5,0x43,0x00,
+0x5d,0x2f,0x10,0x00,0x05,0xd1,0xf3,0x23,0x52,0x5d,0x0b,0xdc,0xba,0x25,0xa4,0x07,
+0x00,0xe2,0x01,0x10,0x05,0x09,0x00,0xf2,0x16,0x27,0x0b,0xcc,0xc1,0x08,0x50,0x44,
+0x4f,0x30,0xb7,0x00,0x11,0xe3,0x0b,0x70,0xff,0xff,0x20,0xb6,0x1f,0x10,0x00,0x0b,
+0x60,0xfc,0xcd,0xf3,0xb6,0x02,0x43,0x20,0x07,0x30,0x01,0x22,0x22,0x20,0x4d,0x03,
+0x83,0x00,0x00,0xd6,0x00,0x00,0x00,0x0c,0x60,0x71,0x0e,0xf0,0x13,0x02,0x00,0x17,
+0x77,0x70,0x03,0xb1,0x99,0x9f,0x30,0x4d,0x00,0x00,0xe4,0x04,0xd0,0xcd,0xdf,0x30,
+0x4d,0x1f,0x33,0x20,0x04,0xd1,0xf2,0x12,0x41,0x4d,0x0d,0xee,0xdb,0x35,0xd0,0x88,
+0x08,0x60,0x00,0x94,0x00,0x03,0x90,0x0c,0x3d,0x00,0x40,0xc6,0x11,0x11,0x10,0x80,
+0x0e,0x00,0x95,0x05,0x12,0xb0,0x95,0x05,0xf0,0x1c,0xe3,0x04,0xe0,0xff,0xff,0x20,
+0x4d,0x1f,0x10,0x00,0x04,0xd0,0xfb,0xbc,0xe3,0x4d,0x02,0x43,0x20,0x02,0x80,0x07,
+0xcd,0xdd,0xd9,0x00,0xb8,0x33,0x37,0xd0,0x0b,0x60,0x00,0x5d,0x00,0xb6,0x00,0x05,
+0xd0,0x08,0xff,0xff,0xf9,0xf4,0x28,0x0b,0xcc,0xc1,0x03,0xd0,0x44,0x4f,0x30,0x4e,
+0x00,0x11,0xe3,0x04,0xe0,0xff,0xff,0x20,0x4d,0x1f,0x10,0x00,0x04,0xd0,0xfd,0xdf,
+0xf3,0x4d,0x01,0x22,0x10,0x01,0x50,0x07,0x40,0x00,0x29,0x00,0xa7,0x11,0x15,0xd0,
+0x0a,0xff,0xff,0xfd,0x00,0xa6,0x00,0x04,0xd0,0x09,0xff,0xff,0xfb,0x00,0x01,0x00,
+0xf1,0x2c,0x10,0xbc,0xcc,0x10,0x4d,0x04,0x44,0xf3,0x04,0xe0,0x00,0x0e,0x30,0x4e,
+0x0f,0xff,0xf2,0x04,0xe1,0xf1,0x00,0x00,0x4d,0x1f,0x54,0x57,0x24,0xd0,0x9c,0xba,
+0x81,0x4d,0x00,0x00,0x0a,0x04,0xc0,0x00,0x06,0xe0,0x00,0x00,0x01,0xef,0x70,0x00,
+0x01,0xda,0x3e,0x90,0x00,0xe9,0x00,0x1c,0xa0,0x01,0x00,0x00,0x01,0x3f,0x00,0x52,
+0x0b,0xcc,0xc1,0x04,0xd0,0x40,0x00,0x40,0x00,0xe3,0x04,0xe0,0x41,0x00,0x11,0xd0,
+0x81,0x00,0xf3,0x14,0x0f,0x99,0xac,0x34,0xd0,0x04,0x55,0x42,0x03,0xb0,0x00,0x03,
+0xad,0xc8,0x00,0x00,0x2e,0x62,0x4c,0xb0,0x00,0x6b,0x00,0x03,0xf0,0x00,0x4e,0x10,
+0x08,0xd0,0x00,0x08,0xfe,0xfd,0x30,0x44,0x00,0x00,0x01,0x00,0xf0,0x0c,0x34,0x44,
+0x00,0xd2,0x00,0x2f,0xbb,0xf2,0x0f,0x30,0x03,0xf0,0x0e,0x30,0xf4,0x00,0x3e,0x00,
+0xe3,0x0e,0x40,0x03,0xe0,0x0e,0x30,0xee,0xd4,0x0b,0x00,0x10,0x63,0x0b,0x00,0xc0,
+0xe4,0x00,0x3f,0x66,0xf3,0x0e,0x40,0x00,0x89,0x88,0x00,0xe4,0x34,0x00,0x20,0x0e,
+0x40,0x06,0x00,0x01,0x0b,0x00,0xf0,0x25,0x09,0x20,0x00,0x02,0x33,0x30,0x0a,0x10,
+0x03,0xfd,0xdf,0x20,0xf3,0x00,0x4e,0x00,0xf3,0x0f,0x30,0x03,0xe0,0x0f,0x30,0xff,
+0xf3,0x3e,0x00,0xe3,0x0f,0x30,0x02,0xff,0xff,0x30,0xf3,0x00,0x00,0x10,0x00,0x0d,
+0x20,0x00,0x02,0x22,0x22,0x20,0x00,0x03,0xee,0xdd,0xdf,0x20,0x38,0x00,0x10,0xf2,
+0x05,0x00,0x11,0x0f,0x0b,0x00,0x12,0xe1,0x8a,0x00,0x00,0x48,0x00,0x20,0x0b,0x20,
+0x48,0x00,0x70,0xe4,0x00,0x3e,0x00,0xf3,0x0e,0x40,0x48,0x00,0x11,0xe4,0x90,0x00,
+0xc0,0xff,0x32,0xf3,0x3e,0x30,0xe4,0x00,0x1d,0xdd,0xc2,0x0e,0x30,0x2a,0x00,0x40,
+0xe3,0x00,0x00,0xe1,0x53,0x00,0x20,0x0f,0x10,0x0e,0x00,0x9b,0xf3,0x11,0x12,0x00,
+0x00,0x0d,0xff,0xff,0xe4,0x8a,0x00,0x20,0x0e,0x51,0x42,0x00,0x20,0xef,0xf3,0x42,
+0x00,0xf3,0x18,0x30,0x02,0xfd,0xdf,0x30,0xc2,0x00,0x01,0x11,0x05,0xba,0x20,0x00,
+0x26,0x00,0x45,0x63,0x00,0x05,0xc0,0x2a,0xaa,0xa1,0x00,0x5c,0x00,0x8e,0xe4,0x00,
+0x05,0xd5,0x4e,0x38,0x90,0x00,0x19,0x85,0x7e,0xd3,0x8a,0x00,0xf0,0x0f,0x66,0x66,
+0x00,0xe2,0x00,0x3f,0x99,0xf3,0x0f,0x30,0x04,0xe0,0x0f,0x30,0xf7,0x40,0x3e,0x00,
+0xf3,0x0f,0xcb,0x13,0xf2,0x2e,0x30,0xf3,0x00,0x1d,0xed,0xd2,0xb6,0x00,0x91,0x11,
+0x11,0x40,0x00,0x00,0xff,0xff,0xff,0x20,0x81,0x00,0x03,0x0b,0x00,0x10,0x1f,0x8f,
+0x00,0x00,0x0b,0x00,0x15,0x60,0xe5,0x01,0x0d,0x4d,0x00,0x20,0xf3,0x00,0x4d,0x00,
+0xf0,0x02,0xff,0x33,0xe0,0x0e,0x30,0xf3,0x00,0x2f,0xee,0xf3,0x0f,0x30,0x00,0x22,
+0x21,0x00,0x70,0x88,0x01,0xf7,0x09,0x43,0x00,0x00,0x0b,0xbb,0xbf,0xd0,0x00,0x00,
+0x00,0x2c,0xc1,0x00,0x00,0x01,0x8e,0xdc,0x40,0x00,0x04,0xe9,0x10,0x6d,0x80,0x4c,
+0x00,0xc5,0x02,0x33,0x20,0xb0,0xd2,0x0f,0xdd,0xe1,0xf1,0xe3,0x1f,0x13,0x05,0x00,
+0xb0,0x03,0xe1,0xfc,0xf3,0x1f,0x03,0xe1,0xf4,0xf3,0x1f,0x03,0x0f,0x00,0xc5,0x9a,
+0xe1,0xf1,0xe3,0x06,0x76,0x51,0xf1,0xe3,0x00,0x00,0x01,0x05,0x00,0xf0,0x02,0x00,
+0x80,0xa2,0x04,0x55,0x40,0x90,0xa4,0x1f,0xbc,0xe0,0xf2,0xb6,0x1f,0x03,0xf0,0xf3,
+0x05,0x00,0xf0,0x16,0xfe,0xf6,0x1f,0x03,0xf0,0xe3,0xb6,0x0f,0xee,0xe0,0xe2,0xb6,
+0x01,0x11,0x00,0x60,0x62,0x00,0x0a,0x10,0x00,0x83,0x00,0x0e,0x41,0x11,0xc5,0x00,
+0x0e,0xff,0xfe,0xf5,0x00,0x0e,0x30,0x00,0xc5,0x5a,0x01,0x11,0xf3,0x7d,0x00,0xe0,
+0x05,0x66,0x50,0xb0,0xc2,0x1f,0xab,0xf0,0xf2,0xe3,0x1f,0x02,0xf0,0xf3,0x05,0x00,
+0xf6,0x1b,0xfe,0xf3,0x1f,0x02,0xf0,0xe3,0xe3,0x1f,0xdd,0xf0,0xe2,0xe3,0x02,0x33,
+0x10,0x80,0xe3,0x00,0x00,0x05,0x70,0x60,0x00,0x00,0x0d,0x90,0x00,0x00,0x00,0x8e,
+0xf7,0x00,0x00,0x07,0xe3,0x3e,0x90,0x00,0x5c,0x20,0x01,0xb5,0xc3,0x00,0xf1,0x08,
+0x44,0x45,0x00,0x2d,0x2f,0xbb,0xf2,0x03,0xe3,0xf0,0x0e,0x30,0x3e,0x3f,0x00,0xe3,
+0x04,0xe3,0xe0,0x0e,0x3f,0xfe,0x3e,0x09,0x00,0x00,0x12,0x00,0xf0,0x26,0x77,0xf3,
+0x03,0xf0,0x89,0x88,0x00,0x3f,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x3e,0x00,
+0x00,0x00,0x01,0x90,0x02,0x33,0x30,0x03,0xc1,0xfd,0xdf,0x20,0x4e,0x2f,0x00,0xf3,
+0x03,0xe2,0xf0,0x0f,0x3e,0xfe,0x1f,0x00,0xe3,0x04,0xe1,0xf4,0x3e,0x30,0x3e,0x0c,
+0xdd,0xc2,0x04,0x29,0x00,0xf1,0x20,0x4e,0x00,0x4b,0x00,0x02,0xb0,0x05,0xc0,0x00,
+0x00,0x00,0x5c,0x11,0x11,0x10,0x03,0xef,0xff,0xeb,0x02,0x33,0x30,0x01,0x90,0x1f,
+0xdd,0xf2,0x03,0xf0,0x2f,0x00,0xf3,0x14,0xf0,0x1f,0x00,0xf5,0xee,0xf0,0x1f,0x10,
+0xe3,0x03,0xf0,0x0f,0xff,0xe2,0x5d,0x00,0xf0,0x04,0x01,0x50,0x00,0x4f,0xff,0xff,
+0xe0,0x00,0x00,0x10,0x04,0xe0,0x00,0x7f,0xff,0xff,0xb0,0x00,0x99,0xa4,0x00,0x11,
+0x6f,0x14,0x00,0x05,0x75,0x01,0xe2,0x22,0x20,0xa1,0xd2,0x0f,0xde,0xe0,0xe3,0xe3,
 0x1f,0x12,0xe0,0xe3,0xf3,0x05,0x00,0x20,0x02,0xfe,0x02,0x01,0x50,0xe1,0xe3,0xe3,
-0x1f,0x02,0x19,0x00,0x8e,0x78,0xf0,0xe3,0xe3,0x08,0x88,0x70,0xe2,0x73,0x09,0xf2,
-0x0e,0x40,0x02,0xa2,0xfc,0xcf,0x20,0x4f,0x2f,0x00,0xf3,0xcf,0xf2,0xf0,0x0f,0x30,
-0x3f,0x1f,0x00,0xe3,0x15,0xf1,0xf4,0x3e,0x3c,0xfe,0x0c,0xdd,0xc2,0x03,0xb8,0x00,
-0x50,0x68,0x00,0x02,0xc0,0x08,0x33,0x01,0x80,0x8a,0x11,0x11,0x10,0x06,0xff,0xff,
-0xea,0x27,0x09,0xa0,0x91,0xfd,0xdf,0x32,0x5e,0x1f,0x00,0xe6,0xde,0xe1,0x29,0x01,
-0xe0,0x1f,0x00,0xe6,0xff,0xe0,0xfe,0xdf,0x31,0x5e,0x01,0x11,0x00,0x02,0xd0,0xea,
-0x0d,0x60,0x00,0x3f,0x62,0x4c,0x90,0x07,0x6f,0x27,0x18,0x4e,0x24,0x20,0x00,0xb9,
-0x0e,0x00,0xf1,0x1e,0x10,0xff,0xf0,0x03,0x26,0x1f,0x10,0x05,0x00,0x93,0x02,0xfe,
-0xee,0xff,0x00,0x00,0x01,0x33,0x00,0x5f,0x0d,0x65,0x12,0xa9,0x22,0x21,0xbf,0xff,
-0x91,0x04,0x01,0xc6,0x06,0x60,0xf5,0x11,0x1f,0x30,0x00,0xf3,0xed,0x0b,0x10,0xee,
-0x35,0x10,0x00,0x6f,0x08,0x50,0x02,0x22,0x8b,0x22,0x21,0xdd,0x1b,0x1f,0xe9,0x21,
-0x12,0x0c,0x06,0x46,0x00,0x17,0xf4,0x46,0x00,0x12,0xef,0x46,0x00,0x35,0x01,0x11,
-0x8b,0x55,0x16,0x23,0x13,0x00,0x3d,0x08,0x10,0x01,0xb9,0x29,0xb0,0x2d,0x97,0xe5,
-0x00,0x04,0xe7,0x00,0x4e,0x70,0x00,0x10,0x28,0x04,0x88,0x44,0x44,0x43,0x00,0x03,
-0xfc,0xcc,0xcf,0xbe,0x00,0x01,0xb9,0x00,0x14,0x11,0xc1,0x10,0x12,0xbf,0x46,0x00,
-0x1a,0x5d,0xdf,0x1d,0x14,0x4b,0x82,0x00,0x00,0xee,0x06,0x70,0x01,0xf5,0x33,0x5f,
-0x00,0x01,0xf1,0xac,0x0b,0x80,0xfc,0xcc,0xdf,0x00,0x00,0x24,0x43,0x32,0x74,0x07,
-0x05,0xa8,0x12,0x10,0x3f,0x75,0x04,0x10,0x3f,0x37,0x09,0x11,0x2a,0x12,0x10,0x17,
-0x12,0xed,0x19,0x00,0xa2,0x07,0x01,0xc3,0x00,0x00,0xb7,0x19,0x21,0x1f,0x20,0x0f,
-0x00,0x0f,0x02,0x11,0x1a,0xf1,0x09,0x03,0x44,0x40,0x0a,0x40,0xfc,0xbf,0x30,0xc5,
-0x0f,0x10,0xe3,0x0c,0x50,0xf1,0x0e,0x30,0xc5,0x1f,0x00,0xe3,0x0c,0x51,0xf0,0x09,
-0x00,0xb0,0xe4,0x0c,0x51,0xf7,0x6f,0x30,0xc5,0x08,0x98,0x81,0x0b,0x80,0x06,0x00,
-0x17,0x03,0x01,0x89,0x06,0x10,0x73,0xaa,0x02,0xf0,0x08,0xd1,0xfd,0xdf,0x20,0x2f,
-0x1f,0x00,0xf3,0x02,0xf1,0xf0,0x0f,0x30,0x2f,0x1f,0x00,0xe3,0x02,0xf0,0xff,0xff,
-0x30,0x2f,0xc0,0x25,0x00,0x0c,0x1f,0x52,0x21,0x00,0x6e,0xdd,0xde,0x31,0x02,0x00,
-0x02,0x1c,0x05,0xe3,0x0a,0x00,0x3b,0x00,0x50,0xc0,0x1f,0xdd,0xf2,0x02,0xe5,0x02,
-0x20,0x02,0xf0,0x41,0x00,0x06,0xe5,0x02,0x12,0xf0,0x69,0x2b,0x0f,0xe5,0x02,0x0f,
-0xf3,0x24,0x23,0x33,0x00,0xb5,0x1f,0xdd,0xf2,0x0b,0x61,0xf0,0x0f,0x30,0xb6,0x1f,
-0x00,0xf3,0x0b,0x61,0xf0,0x0e,0x30,0xb6,0x0f,0xff,0xf3,0x0b,0x60,0x01,0x00,0x00,
-0xb6,0x00,0x00,0x2f,0x07,0x20,0x00,0x09,0xe1,0x00,0x00,0x05,0xfc,0xd1,0x00,0x06,
-0xf5,0x0a,0xe3,0x00,0xb3,0x51,0x28,0x00,0x3b,0x00,0xf1,0x23,0x4c,0x1f,0xdd,0xf2,
-0x05,0xc1,0xf0,0x0f,0x30,0x5d,0x1f,0x00,0xf3,0x05,0xd1,0xf0,0x0e,0x30,0x5c,0x0f,
-0xdd,0xf3,0x05,0xc0,0x12,0x21,0x00,0x4a,0x00,0x03,0xad,0xc6,0x00,0x02,0xf6,0x24,
-0xd7,0x00,0x6b,0x00,0x06,0xc0,0x04,0xe1,0x00,0xba,0x00,0x08,0xfe,0xfb,0xee,0x01,
-0x06,0x9e,0x0b,0x83,0x1f,0x44,0xf3,0x03,0xf0,0x1f,0x00,0xe3,0x05,0x00,0xf0,0x04,
-0x0f,0xcc,0xf4,0x03,0xf0,0x03,0x44,0x30,0x02,0xe0,0x00,0x03,0xca,0x94,0x00,0x00,
-0x00,0x35,0x52,0x0a,0x0a,0x00,0x3d,0x2b,0xc0,0x05,0xdc,0x10,0x00,0x16,0xde,0xf9,
-0x30,0x01,0xc8,0x30,0x27,0xf4,0x07,0x01,0x03,0x01,0x60,0x00,0xd3,0x00,0x3e,0x00,
-0xc5,0x33,0x06,0xf0,0x14,0x0c,0x50,0xe4,0x00,0x3e,0x44,0xd5,0x0d,0x40,0x03,0xfc,
-0xcf,0x50,0xdd,0xc4,0x3e,0x00,0xd5,0x0d,0x74,0x03,0xe0,0x0d,0x50,0xd4,0x00,0x3f,
-0x77,0xe4,0x0d,0x40,0x00,0x78,0x88,0x00,0x85,0x18,0x08,0xce,0x19,0x70,0x09,0x30,
-0x00,0x19,0x00,0x82,0x0d,0x3c,0x25,0xe2,0x40,0xe4,0x00,0x3f,0x88,0xf4,0x0e,0x41,
-0x03,0xf7,0x7f,0x30,0xef,0xf2,0x39,0x06,0x20,0xfb,0xbf,0x2f,0x0f,0x40,0x44,0x30,
-0x0a,0x10,0x15,0x21,0x31,0x10,0x00,0x03,0xd6,0x02,0x0f,0xc3,0x06,0x03,0x32,0x17,
-0x00,0x61,0x48,0x00,0xd0,0xf3,0x00,0x3e,0x33,0xe4,0x0f,0x30,0x03,0xfd,0xcf,0x30,
-0xe6,0x30,0x48,0x00,0x40,0xed,0x23,0xe2,0x2f,0x1c,0x10,0x25,0xdd,0xc1,0xc3,0x06,
-0x33,0xb0,0x00,0x0c,0x34,0x06,0x02,0x46,0x20,0x10,0x0e,0xe5,0x0f,0x43,0x18,0x00,
-0x71,0x0c,0x42,0x00,0xb1,0x3f,0x99,0xf4,0x0e,0x52,0x03,0xf6,0x6f,0x30,0xee,0xd2,
-0x8a,0x00,0x53,0x01,0xef,0xfd,0x10,0xe3,0x62,0x1b,0x40,0x1e,0xff,0xff,0xf1,0x6d,
-0x13,0x20,0x2f,0x20,0x17,0x16,0x10,0xf0,0x40,0x0a,0x11,0x11,0x16,0x00,0x13,0xf4,
-0x8a,0x00,0x32,0x18,0x00,0x72,0x48,0x00,0x14,0xe3,0x48,0x00,0x25,0x6e,0x40,0x48,
-0x00,0x15,0xfe,0x48,0x00,0xf7,0x0b,0x9f,0xfb,0xaf,0xf3,0x00,0x00,0x15,0xd0,0x0d,
-0x50,0x00,0x9f,0xfb,0x00,0xd4,0x00,0x0a,0x70,0x00,0x0d,0x40,0x00,0x9f,0xff,0x40,
-0xc3,0xae,0x1f,0xf1,0x09,0x00,0x01,0xd0,0x0b,0x20,0xe3,0x00,0x3f,0x00,0xd4,0x0e,
-0x40,0x03,0xf8,0x9f,0x40,0xe4,0x00,0x2f,0x77,0xf3,0x0e,0xff,0x32,0x1a,0x08,0x31,
-0x1f,0xff,0xf1,0xd2,0x00,0x00,0x33,0x10,0x91,0x06,0xab,0x81,0x00,0x00,0x08,0xd5,
-0x4a,0xd0,0x33,0x10,0x60,0x40,0x00,0x0c,0x80,0x03,0xf2,0x94,0x23,0x25,0xe7,0x00,
-0xe0,0x26,0x00,0xa5,0x09,0xf0,0x00,0x30,0xa1,0x3b,0x2f,0x02,0xe0,0xe3,0x5d,0x2f,
-0x02,0xf0,0xe3,0x4d,0x2f,0x46,0x05,0x00,0xf0,0x08,0xcc,0xf0,0xed,0xdd,0x2f,0x02,
-0xe0,0xe6,0x7d,0x2f,0x03,0xe0,0xe3,0x4d,0x1f,0x79,0xe0,0xe3,0x4d,0x07,0x88,0x50,
-0xe3,0xec,0x0b,0x06,0x05,0x00,0x90,0x71,0x29,0x0b,0x01,0xa0,0x70,0x92,0x1f,0x12,
-0x83,0x06,0x10,0x78,0x83,0x06,0xf0,0x05,0x9a,0xf0,0xff,0xf3,0x1f,0x03,0xe0,0xe2,
-0xe3,0x0f,0xdd,0xd0,0xe2,0xe3,0x01,0x22,0x10,0xc1,0xc2,0x00,0xaa,0x17,0x2f,0x00,
-0x2e,0x33,0x10,0x04,0x04,0x30,0x02,0xf2,0x14,0x2d,0x3e,0x00,0xd4,0x03,0xf3,0xe0,
-0x0d,0x40,0x3f,0x3f,0x44,0xd4,0x03,0xf3,0xfc,0xcf,0x4d,0xff,0x3f,0x00,0xd4,0x04,
-0xf3,0xf0,0x0d,0x40,0x2f,0x2f,0x77,0xe3,0x02,0xf0,0x78,0x87,0xeb,0x0f,0x04,0xf4,
-0x0f,0x21,0x01,0x90,0xad,0x02,0xf0,0x0a,0x50,0x03,0x00,0x3e,0x1f,0x00,0xd4,0x04,
+0x1f,0x02,0x19,0x00,0x80,0x78,0xf0,0xe3,0xe3,0x08,0x88,0x70,0xe2,0x6b,0x01,0x01,
+0x05,0x00,0x10,0xf2,0x05,0x00,0xf2,0x12,0x70,0xa2,0x03,0x44,0x40,0x02,0xa2,0xfc,
+0xcf,0x20,0x4f,0x2f,0x00,0xf3,0xcf,0xf2,0xf0,0x0f,0x30,0x3f,0x1f,0x00,0xe3,0x15,
+0xf1,0xf4,0x3e,0x3c,0xfe,0x0c,0xdd,0xc2,0x03,0xb8,0x00,0x50,0x68,0x00,0x02,0xc0,
+0x08,0x33,0x01,0xf0,0x07,0x8a,0x11,0x11,0x10,0x06,0xff,0xff,0xea,0x02,0x33,0x30,
+0x02,0x91,0xfd,0xdf,0x32,0x5e,0x1f,0x00,0xe6,0xde,0xe1,0x29,0x01,0xf2,0x15,0x1f,
+0x00,0xe6,0xff,0xe0,0xfe,0xdf,0x31,0x5e,0x01,0x11,0x00,0x02,0xd0,0x00,0x3a,0xdc,
+0x70,0x00,0x3f,0x62,0x4c,0x90,0x07,0xb0,0x00,0x5e,0x00,0x4e,0x20,0x0a,0xc0,0x00,
+0x8f,0xef,0xc2,0xd5,0x03,0x80,0x11,0x11,0x11,0x00,0x03,0xff,0xff,0xff,0xf0,0x03,
+0x26,0x1f,0x10,0x05,0x00,0x80,0x02,0xfe,0xee,0xff,0x00,0x00,0x01,0x33,0xd2,0x00,
+0xa5,0x98,0x00,0x00,0x01,0x12,0xa9,0x22,0x21,0xbf,0xff,0x91,0x04,0xf1,0x13,0xdf,
+0xff,0xff,0x10,0x00,0xf5,0x11,0x1f,0x30,0x00,0xf3,0x00,0x0f,0x30,0x00,0xee,0xee,
+0xff,0x20,0x00,0x01,0x8b,0x10,0x00,0x02,0x22,0x8b,0x22,0x21,0xae,0xee,0xee,0xee,
+0xe9,0x5a,0x00,0x54,0x02,0xff,0xff,0xef,0x30,0x02,0x04,0x02,0x05,0x00,0x17,0x30,
+0xa0,0x02,0x01,0x46,0x00,0x17,0xf4,0x46,0x00,0x12,0xef,0x46,0x00,0xd0,0x01,0x11,
+0x8b,0x11,0x11,0xaf,0xff,0xff,0xff,0xfa,0x00,0x00,0x13,0x29,0x00,0x10,0x8b,0x7d,
+0x01,0xf0,0x00,0xee,0x20,0x00,0x00,0x2d,0x97,0xe5,0x00,0x04,0xe7,0x00,0x4e,0x70,
+0x00,0x10,0x28,0x04,0x88,0x44,0x44,0x43,0x00,0x03,0xfc,0xcc,0xcf,0xbe,0x00,0x01,
+0xb9,0x00,0x21,0x11,0x11,0x5d,0x03,0x32,0x01,0x10,0xbf,0x46,0x00,0x38,0x5d,0x00,
+0x00,0x05,0x00,0x14,0x4b,0x82,0x00,0xf3,0x0e,0xcd,0xdd,0xdc,0x00,0x01,0xf5,0x33,
+0x5f,0x00,0x01,0xf1,0x00,0x2f,0x00,0x00,0xfc,0xcc,0xdf,0x00,0x00,0x24,0x43,0x32,
+0x00,0x01,0x11,0x11,0x11,0x10,0x82,0x00,0x10,0x3f,0x75,0x04,0x91,0x3f,0x00,0x00,
+0x01,0xf2,0x2a,0x00,0x00,0x01,0x3f,0x04,0x15,0xef,0xb5,0x03,0x31,0xdf,0xff,0xfe,
+0xc3,0x00,0x61,0x20,0x00,0xf2,0x00,0x1f,0x20,0x0f,0x00,0x10,0x01,0x78,0x00,0x90,
+0x9f,0xff,0xff,0xff,0xe9,0x00,0x3f,0x11,0xe5,0x04,0x01,0x10,0xff,0xfa,0x00,0x30,
+0x1e,0x50,0x02,0xf7,0x03,0x41,0x03,0xf0,0x00,0x00,0x14,0x00,0x11,0x70,0x40,0x00,
+0xf1,0x09,0x03,0x44,0x40,0x0a,0x40,0xfc,0xbf,0x30,0xc5,0x0f,0x10,0xe3,0x0c,0x50,
+0xf1,0x0e,0x30,0xc5,0x1f,0x00,0xe3,0x0c,0x51,0xf0,0x09,0x00,0xf0,0x00,0xe4,0x0c,
+0x51,0xf7,0x6f,0x30,0xc5,0x08,0x98,0x81,0x0b,0x50,0x00,0x00,0x00,0x17,0x03,0x10,
+0x0c,0x09,0x00,0x10,0x73,0xaa,0x02,0xf2,0x15,0xd1,0xfd,0xdf,0x20,0x2f,0x1f,0x00,
+0xf3,0x02,0xf1,0xf0,0x0f,0x30,0x2f,0x1f,0x00,0xe3,0x02,0xf0,0xff,0xff,0x30,0x2f,
+0x00,0x10,0x00,0x01,0xd0,0x00,0x22,0x22,0x21,0x00,0x6e,0xdd,0xde,0x31,0x02,0x34,
+0x00,0x00,0x04,0x1b,0x03,0x20,0x00,0x20,0x3b,0x00,0x50,0xc0,0x1f,0xdd,0xf2,0x02,
+0xe5,0x02,0x20,0x02,0xf0,0x41,0x00,0x06,0xe5,0x02,0x10,0xf0,0x34,0x01,0x1f,0x40,
+0xe5,0x02,0x10,0xf4,0x27,0x23,0x33,0x00,0xb5,0x1f,0xdd,0xf2,0x0b,0x61,0xf0,0x0f,
+0x30,0xb6,0x1f,0x00,0xf3,0x0b,0x61,0xf0,0x0e,0x30,0xb6,0x0f,0xff,0xf3,0x0b,0x60,
+0x01,0x00,0x00,0xb6,0x00,0x00,0x2f,0x07,0x20,0x00,0x09,0xe1,0x00,0x00,0x05,0xfc,
+0xd1,0x00,0x06,0xf5,0x0a,0xe3,0x00,0xb3,0x00,0x05,0x90,0x3b,0x00,0xf1,0x23,0x4c,
+0x1f,0xdd,0xf2,0x05,0xc1,0xf0,0x0f,0x30,0x5d,0x1f,0x00,0xf3,0x05,0xd1,0xf0,0x0e,
+0x30,0x5c,0x0f,0xdd,0xf3,0x05,0xc0,0x12,0x21,0x00,0x4a,0x00,0x03,0xad,0xc6,0x00,
+0x02,0xf6,0x24,0xd7,0x00,0x6b,0x00,0x06,0xc0,0x04,0xe1,0x00,0xba,0x00,0x08,0xfe,
+0xfb,0xee,0x01,0x04,0xc8,0x06,0xa3,0x02,0xe0,0x1f,0x44,0xf3,0x03,0xf0,0x1f,0x00,
+0xe3,0x05,0x00,0xf0,0x05,0x0f,0xcc,0xf4,0x03,0xf0,0x03,0x44,0x30,0x02,0xe0,0x00,
+0x03,0xca,0x94,0x00,0x00,0x00,0x35,0x52,0x00,0xbb,0x00,0xf2,0x03,0x90,0x00,0x00,
+0x05,0xdc,0x10,0x00,0x16,0xde,0xf9,0x30,0x01,0xc8,0x30,0x27,0xc5,0x00,0x00,0x03,
+0x01,0x60,0x00,0xd3,0x00,0x3e,0x00,0xc5,0x33,0x06,0xf0,0x15,0x0c,0x50,0xe4,0x00,
+0x3e,0x44,0xd5,0x0d,0x40,0x03,0xfc,0xcf,0x50,0xdd,0xc4,0x3e,0x00,0xd5,0x0d,0x74,
+0x03,0xe0,0x0d,0x50,0xd4,0x00,0x3f,0x77,0xe4,0x0d,0x40,0x00,0x78,0x88,0x00,0xd4,
+0x34,0x00,0x20,0x0d,0x50,0x06,0x00,0x11,0xd5,0xc3,0x06,0xf2,0x09,0x30,0x00,0x19,
+0x00,0x82,0x0d,0x20,0x03,0xe0,0x0d,0x40,0xe4,0x00,0x3f,0x88,0xf4,0x0e,0x41,0x03,
+0xf7,0x7f,0x30,0xef,0xf2,0x39,0x06,0xf1,0x02,0xfb,0xbf,0x20,0xe3,0x00,0x03,0x44,
+0x30,0x0a,0x10,0x00,0x01,0x22,0x22,0x10,0x00,0x03,0xd6,0x02,0x0f,0xc3,0x06,0x03,
+0x32,0x17,0x00,0x61,0x48,0x00,0xd0,0xf3,0x00,0x3e,0x33,0xe4,0x0f,0x30,0x03,0xfd,
+0xcf,0x30,0xe6,0x30,0x48,0x00,0xa5,0xed,0x23,0xe2,0x2f,0x30,0xe3,0x00,0x1c,0xdd,
+0xc1,0xc3,0x06,0x33,0xb0,0x00,0x0c,0x34,0x06,0xf3,0x00,0x01,0xf2,0x11,0x11,0x00,
+0x00,0x0e,0xff,0xff,0xe3,0x00,0x18,0x00,0x71,0x0c,0x42,0x00,0xb1,0x3f,0x99,0xf4,
+0x0e,0x52,0x03,0xf6,0x6f,0x30,0xee,0xd2,0x8a,0x00,0x51,0x01,0xef,0xfd,0x10,0xe3,
+0x89,0x05,0xf0,0x04,0x00,0x00,0x1e,0xff,0xff,0xf1,0x00,0x00,0x12,0x11,0x2f,0x20,
+0x00,0x1f,0xff,0xff,0xf0,0x00,0x02,0x42,0x00,0x00,0x16,0x00,0x13,0xf4,0x8a,0x00,
+0x32,0x18,0x00,0x72,0x48,0x00,0x14,0xe3,0x48,0x00,0x25,0x6e,0x40,0x48,0x00,0x15,
+0xfe,0x48,0x00,0xf6,0x0b,0x9f,0xfb,0xaf,0xf3,0x00,0x00,0x15,0xd0,0x0d,0x50,0x00,
+0x9f,0xfb,0x00,0xd4,0x00,0x0a,0x70,0x00,0x0d,0x40,0x00,0x9f,0xff,0x40,0xc3,0x1b,
+0x02,0xf1,0x0a,0x01,0x00,0x01,0xd0,0x0b,0x20,0xe3,0x00,0x3f,0x00,0xd4,0x0e,0x40,
+0x03,0xf8,0x9f,0x40,0xe4,0x00,0x2f,0x77,0xf3,0x0e,0xff,0x32,0x1a,0x08,0x32,0x1f,
+0xff,0xf1,0xd2,0x00,0xc0,0xb2,0x00,0x00,0x06,0xab,0x81,0x00,0x00,0x08,0xd5,0x4a,
+0xd0,0x1d,0x08,0xc1,0x0f,0x40,0x00,0x0c,0x80,0x03,0xf2,0x00,0x00,0x3d,0xee,0xe7,
+0xba,0x03,0x04,0x4f,0x05,0xf0,0x01,0x00,0x30,0xa1,0x3b,0x2f,0x02,0xe0,0xe3,0x5d,
+0x2f,0x02,0xf0,0xe3,0x4d,0x2f,0x46,0x05,0x00,0xf0,0x09,0xcc,0xf0,0xed,0xdd,0x2f,
+0x02,0xe0,0xe6,0x7d,0x2f,0x03,0xe0,0xe3,0x4d,0x1f,0x79,0xe0,0xe3,0x4d,0x07,0x88,
+0x50,0xe3,0x4d,0x2a,0x01,0x05,0x05,0x00,0x90,0x71,0x29,0x0b,0x01,0xa0,0x70,0x92,
+0x1f,0x12,0x83,0x06,0x10,0x78,0x83,0x06,0xf0,0x0e,0x9a,0xf0,0xff,0xf3,0x1f,0x03,
+0xe0,0xe2,0xe3,0x0f,0xdd,0xd0,0xe2,0xe3,0x01,0x22,0x10,0xc1,0xc2,0x00,0x02,0x22,
+0x33,0x20,0x00,0x2e,0xed,0xdd,0xf1,0x6d,0x00,0x06,0x05,0x00,0x15,0xf0,0xd1,0x00,
+0x00,0x30,0x02,0xf0,0x16,0x2d,0x3e,0x00,0xd4,0x03,0xf3,0xe0,0x0d,0x40,0x3f,0x3f,
+0x44,0xd4,0x03,0xf3,0xfc,0xcf,0x4d,0xff,0x3f,0x00,0xd4,0x04,0xf3,0xf0,0x0d,0x40,
+0x2f,0x2f,0x77,0xe3,0x02,0xf0,0x78,0x87,0x00,0x2f,0xad,0x00,0x00,0x37,0x00,0x11,
+0x2f,0x83,0x06,0x01,0xad,0x02,0xf2,0x0f,0x50,0x03,0x00,0x3e,0x1f,0x00,0xd4,0x04,
 0xe1,0xf6,0x6e,0x40,0x3e,0x1f,0x88,0xf4,0xee,0xe1,0xf0,0x0e,0x31,0x5e,0x1f,0x10,
-0xf3,0xcb,0x16,0x12,0x10,0x9a,0x03,0x60,0x04,0xb0,0x00,0x2b,0x00,0x5c,0x60,0x01,
-0x10,0xd1,0xfb,0x2e,0xf4,0x05,0xff,0xfe,0xc0,0x09,0x00,0x71,0x01,0x90,0x1f,0x00,
-0xd4,0x03,0xf0,0x1f,0xaa,0xf4,0x14,0xf0,0x1f,0x76,0x88,0x06,0x3f,0x0d,0xff,0xe1,
-0x88,0x06,0x04,0x19,0x9a,0xa3,0x03,0x50,0x0a,0x00,0x82,0x01,0xb1,0x9c,0x00,0xf0,
-0x03,0x1f,0x77,0xe4,0x03,0xf1,0xf9,0x9f,0x4e,0xff,0x1f,0x00,0xe3,0x01,0xf0,0xfc,
-0xcf,0x20,0x2f,0x85,0x0b,0x16,0x70,0x6c,0x10,0x53,0x90,0x00,0x3e,0x00,0x99,0x6c,
-0x10,0xf0,0x0c,0x0a,0x00,0x81,0x02,0x81,0xf0,0x0e,0x30,0x4e,0x1f,0x77,0xf3,0x15,
-0xe1,0xf9,0x9f,0x3e,0xee,0x1f,0x00,0xf2,0x04,0xd0,0xef,0xfe,0x10,0x4d,0x74,0x00,
-0xb0,0x60,0x06,0x50,0x00,0x38,0x00,0x98,0x11,0x16,0xc0,0x09,0x6c,0x10,0x59,0x97,
-0x00,0x05,0xc0,0x08,0x6c,0x10,0x00,0xaa,0x01,0x20,0xd2,0x2f,0xe0,0x06,0x00,0xaa,
+0xf3,0x03,0xe0,0xdf,0xfe,0x10,0x9a,0x03,0x60,0x04,0xb0,0x00,0x2b,0x00,0x5c,0x60,
+0x01,0xf4,0x0a,0xd1,0x11,0x11,0x00,0x3e,0xff,0xfe,0xc0,0x09,0x00,0x71,0x01,0x90,
+0x1f,0x00,0xd4,0x03,0xf0,0x1f,0xaa,0xf4,0x14,0xf0,0x1f,0x76,0x88,0x06,0x3f,0x0d,
+0xff,0xe1,0x88,0x06,0x04,0x19,0x9a,0xa3,0x03,0x50,0x0a,0x00,0x82,0x01,0xb1,0x9c,
+0x00,0xf0,0x39,0x1f,0x77,0xe4,0x03,0xf1,0xf9,0x9f,0x4e,0xff,0x1f,0x00,0xe3,0x01,
+0xf0,0xfc,0xcf,0x20,0x2f,0x01,0x22,0x10,0x00,0x70,0x05,0xcd,0xdd,0xda,0x00,0x9b,
+0x33,0x36,0xe0,0x09,0x90,0x00,0x3e,0x00,0x99,0x00,0x04,0xe0,0x06,0xff,0xff,0xfb,
+0x0a,0x00,0x81,0x02,0x81,0xf0,0x0e,0x30,0x4e,0x1f,0x77,0xf3,0x15,0xe1,0xf9,0x9f,
+0x3e,0xee,0x1f,0x00,0xf2,0x04,0xd0,0xef,0xfe,0x10,0x4d,0x74,0x00,0xf1,0x05,0x60,
+0x06,0x50,0x00,0x38,0x00,0x98,0x11,0x16,0xc0,0x09,0xff,0xff,0xfc,0x00,0x97,0x00,
+0x05,0xc0,0x08,0x20,0x05,0x17,0x00,0xaa,0x01,0x20,0xd2,0x2f,0xe0,0x06,0x00,0xaa,
 0x01,0x30,0xf3,0x2f,0x46,0x05,0x00,0x50,0xcc,0xff,0xf3,0xe3,0x2f,0xf9,0x06,0x00,
 0xaa,0x01,0x10,0xe3,0xaa,0x01,0x4d,0xe3,0x07,0x88,0x50,0xf9,0x06,0x52,0x08,0x00,
 0x70,0xa1,0xc2,0x1e,0x08,0xa0,0x57,0xf1,0xe3,0xe3,0x1f,0xbb,0xff,0xf3,0xe3,0x1f,
-0x32,0x00,0x31,0x0e,0xff,0xb0,0xed,0x1d,0x20,0x50,0x50,0xe3,0x18,0x10,0xf1,0xaf,
-0x12,0x30,0xf1,0x00,0x1f,0xe9,0x00,0x01,0x43,0x1f,0x14,0x0e,0xe5,0x18,0xf3,0x01,
-0x04,0x00,0x30,0x02,0x91,0xf0,0x0d,0x40,0x3f,0x1f,0x11,0xd4,0xdf,0xf1,0xff,0xff,
-0x3a,0x07,0x44,0xf1,0x0f,0x3c,0xfe,0x36,0x01,0x80,0x4e,0x00,0x5a,0x00,0x02,0xc0,
-0x07,0xb0,0x71,0x23,0x81,0x11,0x11,0x10,0x04,0xef,0xff,0xec,0x00,0xd1,0x03,0xf0,
-0x03,0x00,0x71,0x02,0xd0,0x1f,0x00,0xd5,0x8a,0xf0,0x1f,0xff,0xf4,0x68,0xf0,0x1f,
-0x10,0xe4,0x57,0x05,0x00,0x16,0xde,0x6f,0x01,0x1f,0x60,0x6f,0x01,0x0b,0x00,0x73,
-0x05,0x00,0x37,0x02,0x10,0x3d,0x9a,0x03,0x11,0x4e,0x4a,0x2b,0x30,0x00,0x01,0xf1,
-0xac,0x0d,0x70,0xf5,0x44,0x7d,0x00,0x00,0x9b,0xcc,0x5d,0x22,0x12,0x87,0xa4,0x14,
-0x26,0x20,0xbf,0x2c,0x1d,0xd0,0xc2,0x00,0x0e,0x00,0x00,0xfb,0x99,0x9f,0x00,0x00,
-0xf7,0x55,0x5f,0x54,0x1d,0x6f,0xcf,0x00,0x00,0x23,0xaa,0x42,0x66,0x19,0x17,0x01,
-0x01,0x00,0x10,0xe2,0x46,0x00,0x90,0xf5,0x22,0x2f,0x00,0x00,0xfe,0xdd,0xdf,0x00,
-0x8c,0x06,0x00,0x82,0x0f,0x20,0xfd,0x00,0x42,0x3b,0x02,0x49,0x21,0x01,0xcd,0x06,
-0x2d,0x00,0x81,0xed,0x0d,0x10,0x80,0xcb,0x21,0x00,0x5c,0x04,0x60,0x0f,0x00,0x00,
-0xfd,0xdd,0xdf,0x46,0x00,0x11,0x3f,0x95,0x07,0x00,0x27,0x07,0xc5,0x10,0x00,0x6e,
-0xdd,0xef,0xdd,0xe9,0x02,0x22,0x22,0x21,0x10,0xf2,0x0d,0x16,0x50,0xf2,0x0d,0x11,
-0x01,0x40,0x10,0x01,0x45,0x08,0x10,0xe2,0x41,0x00,0x10,0xfc,0xbe,0x00,0x30,0xf6,
-0x44,0x4f,0x61,0x17,0x62,0x3f,0x00,0x00,0xad,0xee,0xdb,0x94,0x15,0x03,0xcb,0x21,
-0x10,0x25,0x79,0x00,0x10,0x9b,0x04,0x10,0x00,0xbb,0x21,0x95,0x5e,0x64,0xe8,0x00,
-0x05,0xd4,0x00,0x1b,0x80,0x04,0x20,0x10,0x50,0x9c,0x00,0x10,0x2f,0xad,0x1c,0x20,
-0xff,0xf0,0xa4,0x0b,0x00,0xb8,0x1c,0x30,0x31,0x13,0xf0,0x61,0x10,0x15,0xec,0x6d,
-0x18,0x00,0x7f,0x08,0x21,0x11,0x1d,0x7a,0x07,0x16,0xd6,0x96,0x05,0x11,0x93,0xca,
-0x26,0x11,0x08,0xfb,0x00,0x12,0x10,0xc4,0x1c,0x00,0x0a,0x00,0x00,0x7b,0x2e,0x02,
-0x39,0x00,0x07,0xc8,0x07,0x11,0x91,0xd7,0x31,0x14,0x18,0x05,0x01,0x10,0xdf,0x24,
-0x06,0x32,0x30,0x00,0x03,0x05,0x01,0x00,0x3c,0x00,0x00,0x19,0x00,0x11,0x2f,0xd7,
-0x07,0x02,0xda,0x01,0x15,0xaf,0x40,0x08,0x23,0x02,0xff,0x7c,0x11,0x0b,0xea,0x24,
-0x03,0xc4,0x00,0x01,0x46,0x00,0x1f,0xf3,0x46,0x00,0x0e,0x20,0x01,0xee,0xe2,0x0f,
-0x00,0x58,0x2c,0x0f,0xd0,0x22,0x02,0x30,0x50,0x00,0x15,0x46,0x00,0x11,0x4e,0x5b,
-0x22,0x00,0x08,0x01,0x10,0x4e,0x05,0x00,0x10,0x5e,0x07,0x01,0x16,0xeb,0xcd,0x00,
-0x35,0xf8,0x00,0x7b,0x5f,0x10,0x01,0x0a,0x00,0x3f,0x47,0x00,0xa1,0x86,0x02,0x13,
-0x22,0x00,0x00,0xbb,0x23,0x20,0xae,0xef,0x9f,0x08,0x01,0xff,0x01,0x1a,0xe2,0xff,
-0x01,0x11,0xef,0xff,0x01,0x14,0x11,0xab,0x0f,0x00,0x3a,0x02,0x01,0xfa,0x00,0x00,
-0x3b,0x11,0x0e,0xf1,0x0f,0x03,0xf3,0x05,0xf1,0x08,0x71,0xe0,0x02,0xd0,0x3e,0x1f,
+0x32,0x00,0x40,0x0e,0xff,0xb0,0xe3,0x23,0x00,0x40,0x50,0x50,0x00,0x3f,0xc5,0x02,
+0x60,0x01,0x11,0x12,0xf1,0x00,0x1f,0xe9,0x00,0x31,0x2f,0x20,0x00,0x05,0x03,0x11,
+0xf7,0x7d,0x00,0xf3,0x01,0x04,0x00,0x30,0x02,0x91,0xf0,0x0d,0x40,0x3f,0x1f,0x11,
+0xd4,0xdf,0xf1,0xff,0xff,0x3a,0x07,0x44,0xf1,0x0f,0x3c,0xfe,0x36,0x01,0xf1,0x05,
+0x4e,0x00,0x5a,0x00,0x02,0xc0,0x07,0xb0,0x00,0x00,0x00,0x6c,0x11,0x11,0x10,0x04,
+0xef,0xff,0xec,0x00,0xd1,0x03,0xf0,0x03,0x00,0x71,0x02,0xd0,0x1f,0x00,0xd5,0x8a,
+0xf0,0x1f,0xff,0xf4,0x68,0xf0,0x1f,0x10,0xe4,0x57,0x05,0x00,0x16,0xde,0x6f,0x01,
+0x1f,0x60,0x6f,0x01,0x0b,0x00,0x73,0x05,0x00,0x37,0x02,0x10,0x3d,0x9a,0x03,0x60,
+0x4e,0x00,0x01,0xff,0xff,0xfe,0x50,0x06,0xf5,0x09,0x3e,0x00,0x01,0xf5,0x44,0x7d,
+0x00,0x00,0x9b,0xcc,0xb8,0x00,0x00,0x00,0x87,0x00,0x00,0x01,0x11,0xa9,0x11,0x20,
+0xbf,0xff,0x35,0x01,0xf4,0x0c,0xc2,0x00,0x0e,0x00,0x00,0xfb,0x99,0x9f,0x00,0x00,
+0xf7,0x55,0x5f,0x00,0x00,0xed,0xcc,0xcf,0x00,0x00,0x23,0xaa,0x42,0x00,0x01,0x11,
+0x99,0x7d,0x06,0x0f,0x45,0x07,0x10,0x10,0xe2,0x46,0x00,0x90,0xf5,0x22,0x2f,0x00,
+0x00,0xfe,0xdd,0xdf,0x00,0x8c,0x06,0x70,0x00,0x00,0xcf,0xff,0xfd,0x00,0x00,0xb8,
+0x05,0x00,0x46,0x00,0x11,0xf9,0xcd,0x06,0x23,0x00,0x81,0x7c,0x0a,0x00,0x23,0x00,
+0x11,0x11,0xc3,0x06,0x50,0x80,0x00,0x10,0x00,0x02,0x5c,0x04,0x60,0x0f,0x00,0x00,
+0xfd,0xdd,0xdf,0x46,0x00,0x11,0x3f,0x95,0x07,0x00,0x27,0x07,0xf2,0x05,0x10,0x00,
+0x6e,0xdd,0xef,0xdd,0xe9,0x02,0x22,0x22,0x21,0x10,0x02,0xef,0xff,0xff,0x30,0x00,
+0x12,0x22,0xc3,0x06,0x81,0x30,0x03,0xf1,0x11,0x11,0x00,0x01,0xef,0xc3,0x06,0x00,
+0xfa,0x00,0x10,0xe2,0x41,0x00,0x10,0xfc,0xbe,0x00,0xd1,0xf6,0x44,0x4f,0x00,0x00,
+0xf5,0x33,0x3f,0x00,0x00,0xad,0xee,0xdb,0xf0,0x00,0x11,0x10,0x82,0x00,0x30,0x00,
+0x00,0x25,0x79,0x00,0x10,0x9b,0xf1,0x06,0xc2,0xff,0x50,0x00,0x00,0x5e,0x64,0xe8,
+0x00,0x05,0xd4,0x00,0x1b,0xad,0x0a,0x00,0x5a,0x04,0x40,0x50,0x00,0x00,0xf3,0x3a,
+0x03,0x40,0x0f,0xff,0xff,0xf0,0xa4,0x0b,0xc3,0x3f,0x00,0x00,0x0f,0x31,0x13,0xf0,
+0x00,0x00,0xce,0xee,0xec,0xe9,0x00,0x11,0xef,0x7f,0x08,0x21,0x11,0x1d,0x7a,0x07,
+0x16,0xd6,0x96,0x05,0x71,0x93,0x00,0x00,0x00,0x81,0x00,0x08,0xfb,0x00,0x10,0x10,
+0x50,0x0b,0x12,0x10,0x0a,0x00,0x32,0xbf,0xff,0xfd,0x39,0x00,0x07,0xc8,0x07,0x20,
+0x91,0x2f,0x05,0x01,0x14,0x18,0x05,0x01,0x10,0xdf,0x24,0x06,0x32,0x30,0x00,0x03,
+0x05,0x01,0x00,0x3c,0x00,0x00,0x19,0x00,0x11,0x2f,0xd7,0x07,0x02,0xda,0x01,0x15,
+0xaf,0x40,0x08,0x01,0xfb,0x00,0x34,0x00,0x11,0x11,0x05,0x01,0x04,0xc8,0x07,0x03,
+0xc4,0x00,0x01,0x46,0x00,0x1f,0xf3,0x46,0x00,0x0e,0xaa,0x01,0xee,0xff,0xff,0x30,
+0x02,0xf3,0x22,0x22,0x00,0x0e,0x08,0x01,0xca,0x00,0x00,0x07,0x01,0x10,0x15,0x46,
+0x00,0x10,0x4e,0x46,0x00,0x10,0xfe,0x08,0x01,0x10,0x4e,0x05,0x00,0x10,0x5e,0x07,
+0x01,0x16,0xeb,0xcd,0x00,0x30,0xf8,0x00,0x7b,0x12,0x06,0x10,0x6b,0x05,0x00,0x01,
+0x0a,0x00,0x3f,0x47,0x00,0xa1,0x86,0x02,0x12,0x00,0x01,0x00,0x70,0x12,0x22,0x22,
+0x22,0x21,0xae,0xef,0x9f,0x08,0x01,0xff,0x01,0x1a,0xe2,0xff,0x01,0x11,0xef,0xff,
+0x01,0x34,0x11,0x10,0x00,0x81,0x02,0x13,0x10,0xfa,0x00,0x46,0x12,0x22,0x2f,0x40,
+0xff,0x01,0x06,0xc2,0x08,0x00,0x04,0x02,0xf1,0x08,0x71,0xe0,0x02,0xd0,0x3e,0x1f,
 0x10,0x3e,0x03,0xe1,0xf1,0x14,0xe0,0x3f,0x1f,0xff,0xfe,0x03,0xf1,0xf1,0x03,0xe0,
 0x3f,0x12,0x00,0x75,0xf5,0x36,0xe0,0x3e,0x0a,0xbb,0xb8,0x9e,0x0b,0x01,0x09,0x00,
-0xf0,0x05,0x1a,0x04,0x00,0x30,0x03,0x91,0xf0,0x0d,0x30,0x4e,0x1f,0x11,0xd3,0x04,
-0xe1,0xff,0xff,0x30,0x4e,0x1f,0x9e,0x1d,0x82,0xf1,0x0f,0x30,0x4d,0x0d,0xff,0xe1,
-0x04,0xe2,0x0f,0x44,0x67,0x00,0x03,0xb0,0xea,0x0a,0x00,0x84,0x21,0x10,0xe8,0xab,
-0x03,0xf1,0x07,0xa1,0xf0,0x0d,0x40,0x4d,0x1f,0xff,0xf3,0x04,0xd1,0xf1,0x0e,0x30,
-0x4d,0x1f,0x10,0xe3,0x04,0xd0,0xdf,0xfd,0x10,0xf4,0x25,0x12,0x40,0xc9,0x27,0x40,
-0x10,0x05,0xd0,0x0a,0xbc,0x00,0x12,0xb7,0xd4,0x25,0x19,0xfc,0x62,0x28,0xf0,0x0c,
-0x0d,0x10,0xb2,0xe3,0xa8,0x3e,0x20,0xe3,0xf5,0xc9,0x4d,0x20,0xe9,0xf5,0xeb,0x4d,
-0x20,0xea,0xf5,0xec,0x4d,0xfc,0xd4,0xf4,0xc9,0x4d,0x30,0x05,0x00,0xb0,0x20,0xd6,
-0xf4,0xdb,0x4d,0x20,0x8d,0xc1,0xcd,0x2d,0x20,0x2d,0x00,0x01,0x05,0x00,0x10,0x30,
-0x78,0x09,0x17,0x20,0x44,0x00,0xf1,0x11,0x52,0x25,0x06,0x1c,0x00,0x3e,0x79,0xe4,
-0xf2,0xd0,0x02,0xea,0x9e,0x8f,0x1e,0x10,0x2f,0xd9,0xec,0xf1,0xff,0x32,0xe7,0x9e,
-0x5e,0x1d,0x00,0x0d,0xe6,0xbe,0xb1,0xd0,0x7a,0x15,0x01,0x82,0x08,0x10,0xd0,0xbb,
-0x19,0x20,0x5e,0x00,0x12,0x28,0x13,0xb0,0x1d,0x29,0x12,0xaf,0xd5,0x33,0x05,0x3c,
-0x01,0xf2,0x07,0x21,0x20,0x30,0xe1,0x4b,0x87,0xe2,0xe0,0xf1,0x4c,0x87,0xe3,0xe0,
-0xf1,0x4d,0xa7,0xe6,0xf0,0xf1,0x4f,0xe7,0xed,0x0f,0x00,0xf1,0x00,0xe1,0x4c,0x96,
-0xe4,0xe0,0xe1,0x4d,0xb6,0xe8,0xe0,0xe1,0x19,0xa3,0x7a,0x70,0x38,0x08,0x06,0x05,
-0x00,0x50,0x90,0x00,0x03,0x00,0x0a,0xed,0x2a,0x00,0xd7,0x03,0x10,0x4e,0x42,0x0b,
-0x20,0x06,0xd0,0x0e,0x02,0xfc,0x0a,0xaf,0x10,0x0e,0x64,0x00,0x0f,0xe8,0x00,0xed,
-0xc3,0x07,0xd3,0xf1,0x0e,0x30,0x01,0xe4,0x0b,0x90,0xe3,0x00,0x79,0x00,0x2d,0x0e,
-0x67,0x18,0x14,0xd3,0x85,0x00,0x10,0x05,0x48,0x00,0x11,0x04,0x48,0x00,0x10,0x7c,
-0x48,0x00,0xf1,0x05,0x0d,0xe0,0x00,0xff,0xf3,0x06,0xda,0xb0,0x0f,0x41,0x03,0xe3,
-0x0b,0x90,0xf3,0x00,0xc4,0x00,0x07,0x0e,0x93,0x0f,0x1f,0x30,0x93,0x0f,0x0a,0x06,
-0x0d,0x24,0x10,0xd1,0x9d,0x11,0x00,0x23,0x00,0x20,0x07,0xc0,0x06,0x00,0x20,0x0d,
-0xb0,0x06,0x00,0xf1,0x04,0x4e,0xe6,0x00,0xfe,0xe2,0x02,0xe5,0x3e,0x40,0xf4,0x20,
-0x0d,0x70,0x03,0xa0,0xf2,0x00,0x01,0x01,0x47,0x00,0x20,0x1f,0x10,0x1b,0x35,0x02,
-0x0f,0x0f,0x20,0x1f,0x21,0xba,0x0b,0x13,0x0e,0x7f,0x18,0x02,0x7d,0x05,0x13,0xe2,
-0xde,0x00,0x20,0x08,0xb0,0xa1,0x00,0xff,0x05,0xef,0x20,0x0f,0xee,0x30,0x9c,0x8d,
-0x10,0xf5,0x20,0x7e,0x20,0x9c,0x0f,0x30,0x08,0x20,0x00,0x30,0x60,0xd1,0x20,0x14,
-0x32,0x00,0x01,0x80,0x4d,0x00,0x11,0x0e,0x4d,0x00,0x10,0xe3,0x4d,0x00,0xf1,0x0e,
-0x0e,0xff,0x40,0x9c,0x9d,0x10,0xe4,0x10,0x7e,0x10,0x9c,0x0e,0x30,0x07,0x10,0x00,
-0x30,0xd2,0x00,0x00,0x07,0xcc,0x92,0x00,0x00,0x0a,0xd5,0x4a,0xe0,0x8f,0x22,0x50,
-0x40,0x00,0x0d,0x90,0x05,0xcc,0x18,0x27,0xff,0xe5,0x99,0x08,0x00,0x11,0x25,0xf0,
-0x20,0x01,0xa0,0xd1,0x00,0x0c,0x50,0x2e,0x0f,0x20,0x00,0xd4,0x03,0xe0,0xf2,0x00,
-0x0e,0x30,0x3e,0x0f,0x20,0x02,0xf7,0x03,0xfc,0xf2,0x00,0x8d,0xd0,0x2e,0x4f,0x20,
-0x0e,0x3d,0x42,0xe0,0xf2,0x09,0xa0,0x4c,0x2e,0x0f,0x20,0xb1,0x00,0x93,0xe0,0xf2,
-0xa6,0x16,0x20,0x0e,0x20,0x26,0x08,0x10,0xe2,0x77,0x26,0x10,0x0a,0x28,0x27,0x40,
-0x70,0x91,0x00,0x5d,0xcf,0x24,0xf2,0x09,0x8b,0x00,0xe4,0xe3,0x00,0xdd,0x00,0xef,
-0xf3,0x05,0xec,0x80,0xd3,0xe3,0x2e,0x41,0xe5,0xd3,0xe3,0x65,0x00,0x13,0xa2,0xd2,
-0x62,0x17,0x0f,0xa0,0x08,0x09,0x85,0x10,0x00,0x28,0x00,0xd2,0xe3,0x00,0x6c,0x46,
-0x00,0xf0,0x0e,0xde,0x00,0xef,0xf3,0x06,0xdb,0x90,0xd4,0xe3,0x2e,0x31,0xd5,0xd3,
-0xe3,0x64,0x00,0x12,0x81,0x60,0x00,0x0a,0xcc,0xcc,0xb0,0x00,0x0f,0x74,0x44,0xf2,
-0xcf,0x00,0x10,0xf1,0x4e,0x30,0x30,0xf1,0x00,0x0c,0x9f,0x02,0x60,0x15,0x00,0xb0,
-0xc2,0x00,0x6d,0xdc,0x20,0x10,0x8b,0x8c,0x07,0xf1,0x02,0xdc,0x00,0xff,0xf3,0x05,
-0xed,0x70,0xf1,0xe3,0x2e,0x42,0xe4,0xf1,0xe3,0x75,0x00,0x23,0xb2,0x30,0xc2,0x20,
-0x50,0x00,0x05,0xee,0xde,0x60,0x00,0x0f,0x60,0x05,0xf0,0x05,0x00,0x10,0x05,0xf5,
-0x2b,0x05,0x0c,0x01,0x00,0xef,0x08,0x10,0xe2,0x61,0x05,0x20,0x0f,0x41,0xf1,0x01,
-0xf0,0x08,0xff,0xe1,0x00,0xdf,0x30,0x0f,0x30,0x00,0x8d,0x7e,0x20,0xf6,0x40,0x6e,
-0x20,0x7d,0x0f,0xcb,0x17,0x20,0x00,0x30,0xf3,0x9b,0x1f,0x00,0xff,0x00,0x20,0x0c,
-0xa0,0xfe,0x00,0x20,0xff,0x70,0x02,0x37,0x85,0x3e,0x90,0x00,0x04,0xc3,0x00,0x1b,
-0x50,0x88,0x02,0xf1,0x15,0x03,0xa0,0x03,0xf0,0x00,0x4d,0x00,0x4e,0x00,0x04,0xd0,
+0xf0,0x04,0x1a,0x04,0x00,0x30,0x03,0x91,0xf0,0x0d,0x30,0x4e,0x1f,0x11,0xd3,0x04,
+0xe1,0xff,0xff,0x30,0x4e,0xa2,0x0b,0xa1,0xd1,0xf1,0x0f,0x30,0x4d,0x0d,0xff,0xe1,
+0x04,0xd0,0xaa,0x09,0x44,0x67,0x00,0x03,0xb0,0xea,0x0a,0x50,0x00,0x05,0xff,0xff,
+0xe8,0xab,0x03,0xf1,0x06,0xa1,0xf0,0x0d,0x40,0x4d,0x1f,0xff,0xf3,0x04,0xd1,0xf1,
+0x0e,0x30,0x4d,0x1f,0x10,0xe3,0x04,0xd0,0xdf,0xfd,0xa3,0x04,0x30,0x02,0x40,0x05,
+0x9a,0x04,0x50,0x00,0x10,0x05,0xd0,0x0a,0xbc,0x00,0x10,0xb7,0xdd,0x03,0x01,0x12,
+0x00,0x07,0x01,0x00,0xf0,0x0c,0x0d,0x10,0xb2,0xe3,0xa8,0x3e,0x20,0xe3,0xf5,0xc9,
+0x4d,0x20,0xe9,0xf5,0xeb,0x4d,0x20,0xea,0xf5,0xec,0x4d,0xfc,0xd4,0xf4,0xc9,0x4d,
+0x30,0x05,0x00,0xb0,0x20,0xd6,0xf4,0xdb,0x4d,0x20,0x8d,0xc1,0xcd,0x2d,0x20,0x2d,
+0x00,0x01,0x05,0x00,0xb0,0x30,0x00,0x00,0x00,0x0c,0x20,0x00,0x00,0x00,0x00,0x00,
+0x11,0x00,0x01,0x00,0xf0,0x11,0x52,0x25,0x06,0x1c,0x00,0x3e,0x79,0xe4,0xf2,0xd0,
+0x02,0xea,0x9e,0x8f,0x1e,0x10,0x2f,0xd9,0xec,0xf1,0xff,0x32,0xe7,0x9e,0x5e,0x1d,
+0x00,0x0d,0xe6,0xbe,0xb1,0xd0,0x24,0x00,0xf0,0x06,0x13,0x00,0x00,0x7f,0xff,0xff,
+0xd0,0x00,0x00,0x11,0x00,0x5e,0x00,0x00,0xbf,0xff,0xff,0xb0,0x00,0x0c,0x70,0x19,
+0x00,0x56,0xaf,0xff,0xff,0x90,0x00,0x01,0x00,0xf2,0x08,0x01,0x21,0x20,0x30,0xe1,
+0x4b,0x87,0xe2,0xe0,0xf1,0x4c,0x87,0xe3,0xe0,0xf1,0x4d,0xa7,0xe6,0xf0,0xf1,0x4f,
+0xe7,0xed,0x0f,0x00,0xf0,0x01,0xe1,0x4c,0x96,0xe4,0xe0,0xe1,0x4d,0xb6,0xe8,0xe0,
+0xe1,0x19,0xa3,0x7a,0x70,0xe1,0x31,0x00,0x06,0x05,0x00,0xf0,0x23,0x90,0x00,0x03,
+0x00,0x0a,0x10,0x00,0x03,0xe0,0x00,0xf3,0x00,0x00,0x4e,0x00,0x0f,0x30,0x00,0x06,
+0xd0,0x00,0xe3,0x00,0x00,0xaf,0x10,0x0e,0x64,0x00,0x0f,0xe8,0x00,0xed,0xc3,0x07,
+0xd3,0xf1,0x0e,0x30,0x01,0xe4,0x0b,0x90,0xe3,0x00,0x79,0x00,0x2d,0x0e,0x30,0x36,
+0x00,0x10,0xe3,0x05,0x00,0x20,0x0e,0x40,0x06,0x00,0x14,0xd3,0x85,0x00,0x10,0x05,
+0x48,0x00,0x11,0x04,0x48,0x00,0x10,0x7c,0x48,0x00,0xf0,0x11,0x0d,0xe0,0x00,0xff,
+0xf3,0x06,0xda,0xb0,0x0f,0x41,0x03,0xe3,0x0b,0x90,0xf3,0x00,0xc4,0x00,0x07,0x0e,
+0x20,0x00,0x02,0x22,0x22,0x30,0x00,0x03,0xee,0xdd,0xdf,0x20,0x34,0x00,0x10,0xf2,
+0x05,0x00,0x25,0x0f,0x20,0x8e,0x00,0x07,0x01,0x00,0x70,0x40,0x00,0xd1,0x00,0x00,
+0x05,0xd0,0x23,0x00,0x20,0x07,0xc0,0x06,0x00,0x20,0x0d,0xb0,0x06,0x00,0xf1,0x04,
+0x4e,0xe6,0x00,0xfe,0xe2,0x02,0xe5,0x3e,0x40,0xf4,0x20,0x0d,0x70,0x03,0xa0,0xf2,
+0x00,0x01,0x01,0x47,0x00,0x40,0x1f,0x10,0x00,0xa0,0x06,0x00,0x00,0x3b,0x00,0xa4,
+0x1f,0x21,0x11,0x10,0x00,0x00,0x0e,0xff,0xff,0xe2,0x20,0x01,0x33,0x60,0x00,0xe2,
+0xde,0x00,0x20,0x08,0xb0,0xa1,0x00,0xf0,0x08,0xef,0x20,0x0f,0xee,0x30,0x9c,0x8d,
+0x10,0xf5,0x20,0x7e,0x20,0x9c,0x0f,0x30,0x08,0x20,0x00,0x30,0x60,0x00,0x00,0xb0,
+0xc2,0x00,0xe1,0x0f,0x21,0x11,0xf2,0x00,0x00,0xff,0xff,0xef,0x20,0x00,0x0f,0x10,
+0x00,0x0b,0x00,0x38,0xff,0x10,0x00,0x6d,0x01,0x12,0x80,0x4d,0x00,0x11,0x0e,0x4d,
+0x00,0x10,0xe3,0x4d,0x00,0xf0,0x1e,0x0e,0xff,0x40,0x9c,0x9d,0x10,0xe4,0x10,0x7e,
+0x10,0x9c,0x0e,0x30,0x07,0x10,0x00,0x30,0xd2,0x00,0x00,0x07,0xcc,0x92,0x00,0x00,
+0x0a,0xd5,0x4a,0xe0,0x00,0x00,0xf4,0x00,0x0f,0x40,0x00,0x0d,0x90,0x05,0xf1,0x00,
+0x00,0x3d,0xff,0xe5,0x43,0x00,0x06,0x51,0x00,0xf0,0x20,0x41,0x01,0xa0,0xd1,0x00,
+0x0c,0x50,0x2e,0x0f,0x20,0x00,0xd4,0x03,0xe0,0xf2,0x00,0x0e,0x30,0x3e,0x0f,0x20,
+0x02,0xf7,0x03,0xfc,0xf2,0x00,0x8d,0xd0,0x2e,0x4f,0x20,0x0e,0x3d,0x42,0xe0,0xf2,
+0x09,0xa0,0x4c,0x2e,0x0f,0x20,0xb1,0x00,0x93,0xe0,0x31,0x01,0x70,0x2e,0x0e,0x20,
+0x00,0x00,0x02,0xf0,0xdd,0x00,0x10,0x07,0xbb,0x01,0xf0,0x1c,0x00,0x70,0x91,0x00,
+0x5d,0x00,0xe3,0xe3,0x00,0x8b,0x00,0xe4,0xe3,0x00,0xdd,0x00,0xef,0xf3,0x05,0xec,
+0x80,0xd3,0xe3,0x2e,0x41,0xe5,0xd3,0xe3,0x65,0x00,0x13,0xa2,0xd2,0x00,0x02,0x22,
+0x33,0x30,0x00,0x2e,0xed,0xdd,0xf1,0x72,0x00,0x06,0x05,0x00,0x15,0xf0,0x86,0x00,
+0x85,0x10,0x00,0x28,0x00,0xd2,0xe3,0x00,0x6c,0x46,0x00,0xf0,0x0e,0xde,0x00,0xef,
+0xf3,0x06,0xdb,0x90,0xd4,0xe3,0x2e,0x31,0xd5,0xd3,0xe3,0x64,0x00,0x12,0x81,0x60,
+0x00,0x0a,0xcc,0xcc,0xb0,0x00,0x0f,0x74,0x44,0xf2,0xcf,0x00,0x80,0xf1,0x00,0x0f,
+0x40,0x01,0xf1,0x00,0x0c,0x9f,0x02,0x80,0x15,0x00,0xb0,0xc2,0x00,0x6d,0x00,0xf1,
+0x3c,0x00,0xf2,0x16,0xf2,0xe3,0x00,0xdc,0x00,0xff,0xf3,0x05,0xed,0x70,0xf1,0xe3,
+0x2e,0x42,0xe4,0xf1,0xe3,0x75,0x00,0x23,0xe0,0xe3,0x00,0x00,0x02,0x20,0x50,0x00,
+0x05,0xee,0xde,0x60,0x00,0x0f,0x60,0x05,0xf0,0x05,0x00,0x47,0x05,0xee,0xee,0x50,
+0x0c,0x01,0x20,0x01,0x90,0x58,0x01,0x40,0x3f,0x00,0x0f,0x41,0xf1,0x01,0xf0,0x0c,
+0xff,0xe1,0x00,0xdf,0x30,0x0f,0x30,0x00,0x8d,0x7e,0x20,0xf6,0x40,0x6e,0x20,0x7d,
+0x0f,0xcb,0x17,0x20,0x00,0x30,0xf3,0x00,0x00,0x00,0x58,0xff,0x00,0x20,0x0c,0xa0,
+0xfe,0x00,0xe5,0xff,0x70,0x00,0x00,0x06,0xf4,0x3e,0x90,0x00,0x04,0xc3,0x00,0x1b,
+0x50,0x88,0x02,0xf0,0x16,0x03,0xa0,0x03,0xf0,0x00,0x4d,0x00,0x4e,0x00,0x04,0xd0,
 0x06,0xd0,0x12,0x6d,0x00,0xbf,0x2b,0xff,0xd0,0x1f,0xc9,0x00,0x4d,0x08,0xc2,0xf1,
-0x04,0xd2,0xf3,0x09,0xa0,0x4d,0x67,0x00,0x1a,0x1e,0x04,0x05,0x9e,0x2f,0xf2,0x11,
-0x28,0x00,0x05,0x00,0x02,0x90,0x00,0xf2,0x00,0x4d,0x00,0x2f,0x10,0x15,0xd0,0x08,
-0xf2,0x7f,0xfd,0x02,0xfb,0xd0,0x04,0xd1,0xd8,0x0a,0xb0,0x4d,0x89,0x00,0x08,0x24,
-0x99,0x2f,0x48,0x8e,0xdd,0xde,0xc0,0x36,0x14,0x12,0x5c,0x3b,0x01,0x80,0x03,0x10,
-0x02,0xc0,0x00,0x0c,0x60,0x03,0xc6,0x1b,0xf0,0x09,0x03,0xe0,0x00,0x2f,0x52,0xde,
+0x04,0xd2,0xf3,0x09,0xa0,0x4d,0x67,0x00,0x1a,0x04,0x61,0x03,0x41,0x4d,0x00,0x00,
+0x00,0x09,0x00,0xf0,0x1f,0x28,0x00,0x05,0x00,0x02,0x90,0x00,0xf2,0x00,0x4d,0x00,
+0x2f,0x10,0x15,0xd0,0x08,0xf2,0x7f,0xfd,0x02,0xfb,0xd0,0x04,0xd1,0xd8,0x0a,0xb0,
+0x4d,0x89,0x00,0x08,0x24,0xd0,0x00,0x22,0x22,0x32,0x00,0x8e,0xdd,0xde,0xc0,0x00,
+0x00,0x00,0x5d,0x65,0x00,0x00,0x36,0x00,0x12,0x5c,0x3b,0x01,0xf0,0x15,0x03,0x10,
+0x02,0xc0,0x00,0x0c,0x60,0x03,0xf0,0x00,0x0e,0x50,0x03,0xe0,0x00,0x2f,0x52,0xde,
 0xe0,0x00,0xae,0xe1,0x25,0xe0,0x05,0xe1,0xab,0x03,0xe0,0x3e,0x30,0x0c,0x63,0xe0,
-0x11,0x02,0x61,0x03,0x10,0x5d,0x3b,0x02,0x04,0x40,0x0e,0x03,0x03,0x31,0x02,0xf5,
-0x08,0x30,0x90,0x00,0xd2,0x0a,0x2f,0xf1,0x07,0xe3,0x00,0x0a,0xc0,0xcd,0xf3,0x00,
-0x2f,0xd6,0x34,0xe3,0x01,0xd6,0x2e,0x40,0xe3,0x0c,0x90,0x03,0xa0,0xe3,0x02,0x0c,
-0x03,0x00,0x4b,0x32,0x00,0x92,0x0e,0x21,0xf3,0x00,0xdf,0x2f,0x22,0x0e,0x50,0xe0,
-0x2f,0x03,0x9d,0x21,0xf7,0x26,0x06,0x10,0x02,0xb0,0x00,0xe5,0x00,0x4e,0x00,0x1f,
-0x30,0x36,0xe0,0x07,0xf6,0x1d,0xee,0x02,0xf9,0xf3,0x03,0xe2,0xe8,0x06,0xe2,0x3e,
-0x45,0x00,0x04,0x23,0xd0,0x00,0x2a,0xcc,0x70,0x00,0x2e,0x94,0x5d,0xa0,0x06,0xd0,
-0x00,0x4f,0x00,0x4f,0x30,0x0a,0xc0,0x00,0x7f,0xff,0xc2,0x91,0x13,0xb0,0x41,0x00,
-0xc0,0xd2,0x00,0xc6,0x00,0xf1,0xf2,0x00,0xd5,0x05,0x00,0xf0,0x0d,0xf3,0x12,0xf2,
-0xf2,0x03,0xf7,0xbf,0xf2,0xf2,0x08,0xed,0x00,0xf2,0xe2,0x0e,0x4e,0x40,0xf2,0xe2,
-0x8b,0x06,0xb0,0xf1,0xe2,0xb1,0x00,0x90,0xf1,0x76,0x02,0x02,0x05,0x00,0x01,0xe3,
-0x11,0x31,0xa1,0x00,0x02,0x7f,0x02,0x00,0xf8,0x01,0xf9,0x09,0x7b,0x01,0xf2,0xe3,
+0x11,0x02,0x61,0x03,0x10,0x5d,0x3b,0x02,0x22,0x5d,0x00,0x42,0x00,0x61,0x10,0x00,
+0x3f,0xff,0xff,0xe0,0xb2,0x00,0x00,0x7a,0x00,0xf0,0x0c,0xd2,0x00,0x06,0xc0,0x00,
+0xe3,0x00,0x0a,0xc0,0xcd,0xf3,0x00,0x2f,0xd6,0x34,0xe3,0x01,0xd6,0x2e,0x40,0xe3,
+0x0c,0x90,0x03,0xa0,0xe3,0x02,0x0c,0x03,0x00,0xcd,0x02,0x80,0xf2,0x00,0x00,0x11,
+0x11,0xf3,0x00,0x0d,0x0a,0x00,0x40,0x0e,0x50,0x00,0x00,0x7c,0x01,0x12,0xf7,0x41,
+0x00,0xf5,0x29,0x06,0x10,0x02,0xb0,0x00,0xe5,0x00,0x4e,0x00,0x1f,0x30,0x36,0xe0,
+0x07,0xf6,0x1d,0xee,0x02,0xf9,0xf3,0x03,0xe2,0xe8,0x06,0xe2,0x3e,0x45,0x00,0x04,
+0x23,0xd0,0x00,0x2a,0xcc,0x70,0x00,0x2e,0x94,0x5d,0xa0,0x06,0xd0,0x00,0x4f,0x00,
+0x4f,0x30,0x0a,0xc0,0x00,0x7f,0xff,0xc2,0x00,0x00,0x01,0x85,0x02,0xa0,0x00,0xc0,
+0xd2,0x00,0xc6,0x00,0xf1,0xf2,0x00,0xd5,0x05,0x00,0xf0,0x0d,0xf3,0x12,0xf2,0xf2,
+0x03,0xf7,0xbf,0xf2,0xf2,0x08,0xed,0x00,0xf2,0xe2,0x0e,0x4e,0x40,0xf2,0xe2,0x8b,
+0x06,0xb0,0xf1,0xe2,0xb1,0x00,0x90,0xf1,0x76,0x02,0x02,0x05,0x00,0x00,0x04,0x04,
+0x41,0x80,0xa1,0x00,0x02,0x7f,0x02,0x00,0xf8,0x01,0xf9,0x09,0x7b,0x01,0xf2,0xe3,
 0x00,0xcc,0x6f,0xf3,0xe3,0x04,0xed,0x70,0xe3,0xe3,0x1d,0x52,0xe3,0xe3,0xe3,0x77,
-0x00,0x34,0xd2,0xe2,0x7f,0x02,0x07,0x3a,0x22,0x13,0xf0,0x5f,0x1a,0x30,0x00,0x81,
-0x94,0xc0,0x02,0xf3,0x15,0xb6,0x00,0x7b,0x01,0xe3,0xb6,0x00,0xcb,0x5f,0xf3,0xb6,
-0x03,0xfe,0x50,0xe3,0xb6,0x0c,0x63,0xe2,0xe3,0xb6,0x89,0x00,0x45,0xe3,0xc6,0x00,
-0x01,0x00,0xe3,0xc5,0x00,0x2f,0x00,0x71,0x93,0x7d,0x2c,0x00,0xf3,0x2b,0x10,0x1e,
-0x7e,0x13,0x70,0x17,0x00,0xb1,0xc2,0x00,0x5e,0x00,0xf8,0x31,0xf5,0x08,0x14,0xf2,
-0xe3,0x00,0xde,0x7c,0xf3,0xe3,0x05,0xea,0xb0,0xe3,0xe3,0x3e,0x40,0xc7,0xe3,0xe3,
-0x65,0x00,0x02,0x71,0x60,0xf2,0x09,0x13,0xf2,0xf2,0x09,0x18,0x10,0xf2,0x09,0x20,
-0x00,0x15,0x41,0x00,0x11,0x6d,0x41,0x00,0xf0,0x02,0x15,0xf2,0xe3,0x00,0xdd,0x5a,
-0xf3,0xe3,0x05,0xec,0x80,0xe3,0xe3,0x2e,0x41,0xd5,0xe3,0x3d,0x03,0xa0,0x81,0xe3,
-0x00,0x00,0x06,0x40,0x60,0x00,0x00,0x0e,0x78,0x05,0xe3,0x9e,0xf5,0x00,0x00,0x09,
-0xe2,0x4f,0x70,0x00,0x7b,0x10,0x02,0xc3,0x00,0x34,0x0a,0xf1,0x12,0x02,0xc0,0x00,
-0x0e,0x40,0x03,0xf0,0x00,0x0f,0x32,0xee,0xe0,0x00,0x4f,0x20,0x25,0xe0,0x00,0xce,
-0xc2,0xab,0xe0,0x08,0xd0,0xc9,0x57,0xe0,0x5e,0x20,0x1d,0x43,0xe0,0x10,0xfd,0x01,
-0x10,0x3e,0xfd,0x01,0x04,0x00,0x31,0x10,0x10,0x8f,0x23,0x10,0xe0,0x15,0x03,0x02,
-0x37,0x23,0x00,0xb4,0x04,0x10,0x70,0x69,0x06,0x00,0xe6,0x0d,0xf3,0x00,0x07,0xf2,
-0x7e,0x30,0x00,0x08,0xe3,0x00,0x6e,0x40,0x00,0x51,0x0a,0x30,0x22,0x33,0x0e,0xd0,
-0x11,0x1d,0x61,0x12,0x00,0xef,0xee,0xee,0xee,0xf7,0x00,0x00,0x76,0x31,0x00,0x10,
-0xd9,0x30,0x00,0xf6,0x03,0xdf,0x70,0x00,0x01,0xbc,0x23,0xd9,0x00,0x07,0x70,0x97,
-0x07,0x40,0x01,0x11,0xb9,0x11,0x10,0x38,0x11,0x15,0x03,0x56,0x2d,0x04,0x05,0x00,
-0x28,0x0d,0x30,0xc8,0x04,0x10,0x98,0x05,0x00,0x10,0xea,0xea,0x0b,0xd1,0xde,0x70,
-0x00,0x02,0xbc,0x22,0xda,0x00,0x07,0x60,0x97,0x07,0x30,0x90,0x00,0x03,0x75,0x19,
-0x00,0xc3,0x07,0x15,0xa1,0xa8,0x05,0x12,0xf3,0x2b,0x18,0x27,0xff,0x70,0x41,0x00,
-0x10,0x01,0x52,0x08,0xf4,0x09,0x1c,0xbd,0xb0,0x00,0x04,0xe9,0x22,0xad,0x20,0x04,
-0x20,0xa8,0x03,0x20,0x58,0x88,0xdc,0x88,0x85,0x47,0x77,0x77,0x77,0x74,0x92,0x27,
-0x11,0xad,0x03,0x05,0x14,0x30,0x92,0x27,0x13,0xe5,0x9f,0x23,0xf4,0x1d,0x04,0x10,
-0x03,0xa0,0x00,0xc6,0x00,0x4d,0x00,0x0f,0x40,0x03,0xe0,0x05,0xf9,0x00,0x3e,0x01,
-0xe7,0xe6,0x03,0xe0,0xc8,0x03,0xe3,0x3e,0x26,0x0a,0x12,0x23,0xe0,0x00,0xe3,0x00,
-0x3e,0x02,0x2e,0x54,0x54,0xe3,0xde,0xdc,0xb9,0x5e,0xf4,0x07,0x20,0x2b,0x00,0xdd,
-0x08,0x00,0x62,0x06,0x00,0x38,0x1a,0xf2,0x01,0x10,0x00,0x00,0x08,0xda,0xd1,0x00,
-0x00,0xad,0x20,0x8e,0x30,0x06,0x80,0x00,0x04,0x9a,0x00,0x21,0x8f,0xff,0xb0,0x07,
-0x01,0x11,0x2f,0x06,0x05,0x00,0x15,0x5b,0xf9,0x00,0x10,0x65,0x05,0x00,0x10,0xc8,
-0x37,0x03,0x00,0x20,0x01,0x9f,0x8e,0x35,0xe6,0x00,0x08,0xa1,0x00,0x2a,0x40,0xaf,
-0x11,0x12,0x15,0x10,0xf9,0x00,0x10,0xfc,0xf9,0x00,0xd3,0xac,0xb0,0x00,0x04,0xe8,
-0x00,0x9d,0x20,0x04,0x20,0x00,0x02,0x20,0x90,0x2e,0x10,0x8b,0x7d,0x06,0x32,0x35,
-0x00,0x00,0xf8,0x30,0x10,0x04,0x36,0x00,0x84,0x7f,0x53,0xe9,0x00,0x06,0xb2,0x00,
-0x1a,0x3a,0x01,0x01,0xa2,0x2f,0x10,0xb8,0xd4,0x00,0x10,0xfd,0x97,0x01,0x70,0x8c,
-0xa0,0x00,0x01,0xca,0x00,0xca,0x71,0x47,0x12,0x09,0x13,0x12,0x01,0xb2,0x2f,0x53,
-0x9d,0xde,0xee,0xed,0xd7,0x32,0x00,0x10,0xb5,0x27,0x04,0x00,0xce,0x2c,0xd1,0x2d,
-0x9d,0xa0,0x00,0x07,0xe6,0x01,0xad,0x20,0x04,0x10,0x00,0x02,0x22,0x12,0x03,0xe4,
-0x33,0x01,0x60,0x09,0x00,0x00,0x34,0x02,0x06,0x19,0x25,0xf1,0x01,0x5f,0x0b,0x14,
-0x21,0x65,0x02,0x20,0x02,0xfc,0x3e,0x06,0x90,0x8a,0xd2,0x00,0x06,0xe6,0x00,0x7e,
-0x30,0x02,0x7a,0x22,0xf1,0x00,0x7b,0xbb,0xaa,0xab,0xb7,0x24,0x55,0x55,0x55,0x42,
-0x00,0x90,0x00,0x09,0x10,0x74,0x37,0x01,0x55,0x0a,0x20,0x02,0xf0,0xe1,0x37,0x0c,
-0xfc,0x06,0x01,0xfa,0x00,0x11,0xfb,0xfa,0x00,0xf2,0x07,0xb1,0x00,0x05,0xe8,0x00,
-0x9e,0x30,0x03,0x20,0x00,0x02,0x10,0x6a,0xaa,0x99,0x9a,0xa7,0x25,0x66,0x66,0x65,
-0x52,0x90,0x0f,0x3f,0x9d,0x55,0xbd,0xf3,0x01,0x03,0x00,0x9c,0x05,0xfa,0x13,0x00,
-0xf2,0x00,0x5c,0x00,0x1f,0x10,0x05,0xc0,0x03,0xf0,0x00,0x5c,0x00,0x8f,0x60,0x05,
-0xc0,0x0d,0xbd,0x00,0x5d,0x05,0xd0,0xd5,0x05,0xd0,0xe5,0x05,0xd0,0x5d,0x49,0x00,
-0x08,0x9c,0x19,0x00,0x9c,0x05,0x10,0x08,0x55,0x37,0xf0,0x08,0xc6,0x00,0x2f,0x00,
-0x0c,0x60,0x07,0xf2,0x00,0xc6,0x01,0xeb,0xd0,0x0c,0x60,0xc8,0x0a,0xb0,0xc6,0x89,
-0x00,0x08,0x1b,0x51,0x25,0x64,0x30,0x01,0xff,0xee,0xef,0x40,0x9c,0x19,0x14,0x50,
-0x9c,0x19,0x00,0x71,0x00,0x30,0x0d,0x20,0x03,0x4b,0x02,0xf1,0x07,0x5d,0x00,0x0e,
-0x30,0x09,0xd0,0x00,0xe3,0x01,0xfe,0x70,0x0e,0x30,0xb9,0x2e,0x40,0xe3,0xab,0x00,
-0x3d,0x0e,0x32,0xcb,0x08,0x61,0xc5,0x00,0x08,0x10,0x0d,0x60,0x3d,0x00,0x00,0x27,
-0x22,0x03,0x1b,0x04,0xf1,0x0c,0x02,0xa0,0x00,0xc3,0x00,0x5d,0x00,0x0d,0x40,0x09,
-0xc0,0x00,0xd4,0x01,0xfe,0x60,0x0d,0x40,0xb9,0x3f,0x40,0xd4,0xaa,0x00,0x4d,0x0d,
-0x42,0x17,0x2a,0x03,0x46,0x1d,0x10,0xe4,0x12,0x03,0x11,0x20,0x5f,0x03,0x17,0xcf,
-0xce,0x0a,0x80,0x10,0x00,0x09,0x40,0x03,0xe0,0x00,0x0d,0x11,0x06,0x10,0x1f,0x34,
-0x25,0xf0,0x10,0x7f,0xa0,0x03,0xe0,0x02,0xe4,0xd7,0x03,0xe0,0x2e,0x60,0x2e,0x43,
+0x00,0x34,0xd2,0xe2,0x7f,0x02,0x15,0x01,0x05,0x00,0x04,0x7f,0x02,0x40,0x13,0x00,
+0x81,0x94,0xc0,0x02,0xf0,0x17,0xb6,0x00,0x7b,0x01,0xe3,0xb6,0x00,0xcb,0x5f,0xf3,
+0xb6,0x03,0xfe,0x50,0xe3,0xb6,0x0c,0x63,0xe2,0xe3,0xb6,0x89,0x00,0x45,0xe3,0xc6,
+0x00,0x01,0x00,0xe3,0xc5,0x00,0x2f,0x00,0x71,0x93,0x00,0x3f,0x32,0x00,0xf0,0x01,
+0x3f,0x11,0x11,0x20,0x00,0x1e,0xff,0xff,0xe4,0x00,0x17,0x00,0xb1,0xc2,0x00,0x5e,
+0x7d,0x00,0xf0,0x09,0x8b,0x14,0xf2,0xe3,0x00,0xde,0x7c,0xf3,0xe3,0x05,0xea,0xb0,
+0xe3,0xe3,0x3e,0x40,0xc7,0xe3,0xe3,0x65,0x00,0x02,0x71,0x60,0x67,0x01,0x80,0xf1,
+0x00,0x01,0x11,0x12,0xf2,0x00,0x1f,0x71,0x01,0x20,0x2f,0x10,0xba,0x04,0x05,0x3a,
+0x01,0x10,0x15,0x41,0x00,0x11,0x6d,0x41,0x00,0xf0,0x02,0x15,0xf2,0xe3,0x00,0xdd,
+0x5a,0xf3,0xe3,0x05,0xec,0x80,0xe3,0xe3,0x2e,0x41,0xd5,0xe3,0x3d,0x03,0xa0,0x81,
+0xe3,0x00,0x00,0x06,0x40,0x60,0x00,0x00,0x0e,0x78,0x05,0xd2,0x9e,0xf5,0x00,0x00,
+0x09,0xe2,0x4f,0x70,0x00,0x7b,0x10,0x02,0xc3,0x41,0x00,0xf1,0x14,0x04,0x00,0x02,
+0xc0,0x00,0x0e,0x40,0x03,0xf0,0x00,0x0f,0x32,0xee,0xe0,0x00,0x4f,0x20,0x25,0xe0,
+0x00,0xce,0xc2,0xab,0xe0,0x08,0xd0,0xc9,0x57,0xe0,0x5e,0x20,0x1d,0x43,0xe0,0x10,
+0xfd,0x01,0x10,0x3e,0xfd,0x01,0x10,0x4e,0x32,0x00,0x10,0x4e,0xfd,0x01,0x11,0x2f,
+0xfd,0x01,0x11,0x02,0xfa,0x04,0x11,0xa8,0xb4,0x04,0x00,0x60,0x00,0xf0,0x19,0x09,
+0xef,0x20,0x00,0x00,0x07,0xf2,0x7e,0x30,0x00,0x08,0xe3,0x00,0x6e,0x40,0x00,0x51,
+0x0a,0x30,0x22,0x00,0x00,0x00,0xd5,0x00,0x00,0x00,0x11,0x1d,0x61,0x12,0x00,0xef,
+0xee,0xee,0xee,0xf7,0x00,0x00,0x76,0x31,0x00,0x10,0xd9,0x30,0x00,0xf0,0x12,0xdf,
+0x70,0x00,0x01,0xbc,0x23,0xd9,0x00,0x07,0x70,0x97,0x07,0x40,0x01,0x11,0xb9,0x11,
+0x10,0xae,0xee,0xee,0xee,0xe9,0x00,0x11,0x11,0x11,0x00,0x03,0xff,0xff,0xff,0x40,
+0xed,0x00,0x14,0x50,0x05,0x00,0x28,0x0d,0x30,0xc8,0x04,0x10,0x98,0x05,0x00,0xf0,
+0x03,0xea,0x00,0x00,0x00,0x0a,0xde,0x70,0x00,0x02,0xbc,0x22,0xda,0x00,0x07,0x60,
+0x97,0x07,0x30,0x90,0x00,0x00,0x60,0x06,0x95,0xff,0xfa,0x01,0x11,0x00,0x11,0x10,
+0x00,0xa1,0xa8,0x05,0x97,0xf3,0x11,0x12,0x00,0x00,0xdf,0xff,0xff,0x70,0x41,0x00,
+0xf1,0x17,0x01,0xeb,0x00,0x00,0x00,0x1c,0xbd,0xb0,0x00,0x04,0xe9,0x22,0xad,0x20,
+0x04,0x20,0xa8,0x03,0x20,0x58,0x88,0xdc,0x88,0x85,0x47,0x77,0x77,0x77,0x74,0x00,
+0x06,0xbb,0x81,0x00,0x00,0xad,0x54,0xad,0x03,0x05,0xa0,0x30,0x00,0xd8,0x00,0x5f,
+0x10,0x00,0x3d,0xee,0xe5,0xcf,0x00,0x00,0x3b,0x01,0xf0,0x20,0x10,0x03,0xa0,0x00,
+0xc6,0x00,0x4d,0x00,0x0f,0x40,0x03,0xe0,0x05,0xf9,0x00,0x3e,0x01,0xe7,0xe6,0x03,
+0xe0,0xc8,0x03,0xe3,0x3e,0x26,0x0a,0x12,0x23,0xe0,0x00,0xe3,0x00,0x3e,0x02,0x2e,
+0x54,0x54,0xe3,0xde,0xdc,0xb9,0x5e,0x00,0x00,0x00,0x03,0x2e,0x03,0x40,0x2b,0x00,
+0x00,0x15,0x7c,0x00,0x10,0x7c,0x05,0x00,0xf2,0x02,0xce,0x10,0x00,0x00,0x08,0xda,
+0xd1,0x00,0x00,0xad,0x20,0x8e,0x30,0x06,0x80,0x00,0x04,0x9a,0x00,0xa8,0x8f,0xff,
+0xff,0xff,0xfc,0x00,0x00,0x6c,0x00,0x00,0x05,0x00,0x15,0x5b,0xf9,0x00,0x10,0x65,
+0x05,0x00,0x10,0xc8,0x37,0x03,0x00,0x20,0x01,0xe1,0x8e,0x35,0xe6,0x00,0x08,0xa1,
+0x00,0x2a,0x40,0x01,0x11,0x11,0x11,0x10,0xf9,0x00,0x11,0x00,0x67,0x02,0xa1,0xe1,
+0x3f,0x00,0x00,0x01,0xf2,0x2a,0x00,0x00,0x01,0xf9,0x00,0x40,0xef,0xff,0xff,0x60,
+0xba,0x01,0x04,0xf9,0x00,0x10,0xfc,0xf9,0x00,0xd0,0xac,0xb0,0x00,0x04,0xe8,0x00,
+0x9d,0x20,0x04,0x20,0x00,0x02,0x20,0x7b,0x01,0x40,0xea,0x01,0x11,0x8b,0x7d,0x06,
+0x10,0x35,0x28,0x00,0x10,0x9a,0xe5,0x00,0x00,0x36,0x00,0x84,0x7f,0x53,0xe9,0x00,
+0x06,0xb2,0x00,0x1a,0x3a,0x01,0x10,0x89,0x05,0x00,0x10,0xb8,0xd4,0x00,0x10,0xfd,
+0x97,0x01,0xd2,0x8c,0xa0,0x00,0x01,0xca,0x00,0xca,0x00,0x09,0x70,0x00,0x09,0x60,
+0x14,0x03,0x93,0x33,0x33,0x33,0x31,0x9d,0xde,0xee,0xed,0xd7,0x32,0x00,0x10,0xb5,
+0x27,0x04,0xf2,0x08,0xf9,0x00,0x00,0x00,0x2d,0x9d,0xa0,0x00,0x07,0xe6,0x01,0xad,
+0x20,0x04,0x10,0x00,0x02,0x10,0x9f,0xff,0xff,0xff,0xf9,0x44,0x04,0xf1,0x06,0xff,
+0xff,0xff,0x30,0x00,0x01,0x11,0x1e,0x40,0x02,0xff,0xff,0xfe,0x20,0x03,0xf1,0x01,
+0x11,0x00,0x01,0xef,0xad,0x01,0x14,0x21,0x65,0x02,0x20,0x02,0xfc,0x3e,0x06,0xf0,
+0x12,0x8a,0xd2,0x00,0x06,0xe6,0x00,0x7e,0x30,0x02,0x10,0x00,0x01,0x10,0x7b,0xbb,
+0xaa,0xab,0xb7,0x24,0x55,0x55,0x55,0x42,0x00,0x90,0x00,0x09,0x10,0x02,0xf1,0x00,
+0x1f,0x20,0x4b,0x00,0x7c,0x20,0x02,0xf0,0x00,0x0f,0x20,0x02,0xfc,0x06,0x01,0xfa,
+0x00,0x11,0xfb,0xfa,0x00,0xff,0x10,0xb1,0x00,0x05,0xe8,0x00,0x9e,0x30,0x03,0x20,
+0x00,0x02,0x10,0x6a,0xaa,0x99,0x9a,0xa7,0x25,0x66,0x66,0x65,0x52,0x00,0x06,0xab,
+0x81,0x00,0x00,0x9d,0x55,0xbd,0xf3,0x01,0x03,0x00,0x9c,0x05,0xf8,0x15,0x00,0xf2,
+0x00,0x5c,0x00,0x1f,0x10,0x05,0xc0,0x03,0xf0,0x00,0x5c,0x00,0x8f,0x60,0x05,0xc0,
+0x0d,0xbd,0x00,0x5d,0x05,0xd0,0xd5,0x05,0xd0,0xe5,0x05,0xd0,0x5d,0x49,0x00,0x08,
+0x25,0xd0,0x66,0x05,0x00,0x9c,0x05,0xf0,0x16,0x08,0x30,0x00,0xf2,0x00,0xc6,0x00,
+0x2f,0x00,0x0c,0x60,0x07,0xf2,0x00,0xc6,0x01,0xeb,0xd0,0x0c,0x60,0xc8,0x0a,0xb0,
+0xc6,0x89,0x00,0x08,0x1b,0x60,0x00,0x11,0x11,0x30,0x01,0xff,0xee,0xef,0xed,0x02,
+0x10,0xd6,0x18,0x05,0x00,0xec,0x02,0x10,0xc5,0xf0,0x00,0x00,0x71,0x00,0x30,0x0d,
+0x20,0x03,0x4b,0x02,0xf1,0x07,0x5d,0x00,0x0e,0x30,0x09,0xd0,0x00,0xe3,0x01,0xfe,
+0x70,0x0e,0x30,0xb9,0x2e,0x40,0xe3,0xab,0x00,0x3d,0x0e,0x32,0xcb,0x08,0x61,0xc5,
+0x00,0x08,0x10,0x0d,0x60,0x3d,0x00,0x34,0x01,0x00,0x0a,0x1b,0x04,0xf0,0x12,0x02,
+0xa0,0x00,0xc3,0x00,0x5d,0x00,0x0d,0x40,0x09,0xc0,0x00,0xd4,0x01,0xfe,0x60,0x0d,
+0x40,0xb9,0x3f,0x40,0xd4,0xaa,0x00,0x4d,0x0d,0x42,0x00,0x00,0x00,0x51,0x00,0xef,
+0x70,0x01,0x30,0x11,0x11,0xe4,0x12,0x03,0x11,0x20,0x5f,0x03,0x15,0xcf,0x1b,0x03,
+0x00,0x28,0x02,0x60,0x09,0x40,0x03,0xe0,0x00,0x0d,0x11,0x06,0xf0,0x17,0x1f,0x30,
+0x03,0xe0,0x00,0x7f,0xa0,0x03,0xe0,0x02,0xe4,0xd7,0x03,0xe0,0x2e,0x60,0x2e,0x43,
 0xe0,0x24,0x00,0x01,0x11,0x60,0x00,0x2b,0xcc,0xcc,0xa0,0x00,0x5e,0x44,0x46,0xf0,
-0x00,0x5d,0xf6,0x0f,0x10,0x5d,0x82,0x14,0x42,0x3e,0xff,0xff,0xc0,0x1f,0x1e,0x11,
-0xb2,0xb1,0x08,0x30,0x04,0xe0,0x03,0x80,0x0b,0xf1,0x1a,0x9f,0x80,0x03,0xe0,0x3e,
-0x4e,0x50,0x3e,0x3e,0x50,0x3e,0x33,0xe3,0x30,0x00,0x10,0x3d,0x00,0x02,0xac,0xc7,
-0x00,0x02,0xe9,0x45,0xda,0x00,0x6d,0x00,0x04,0xf0,0x04,0xf3,0x00,0xac,0x00,0x07,
-0xff,0xfc,0x20,0x00,0xd4,0x14,0x50,0x01,0x03,0x80,0x00,0x4d,0x65,0x35,0x70,0x05,
-0xd0,0x6c,0x05,0xd0,0x00,0x6c,0xd7,0x37,0xf5,0x0d,0x08,0xf0,0x9d,0x05,0xe3,0x10,
-0xbf,0x3b,0xf1,0x4f,0xd8,0x0e,0xc8,0xfd,0x54,0xd0,0x05,0xd4,0xfc,0x6a,0x4d,0x00,
-0xa6,0x0d,0x41,0xc4,0xd0,0x00,0xe9,0x3a,0x01,0x91,0x06,0x09,0x4e,0x33,0x00,0xe5,
-0x12,0x00,0x8d,0x01,0xf4,0x07,0xf4,0x00,0x00,0x9f,0x13,0xf8,0x00,0x01,0xfd,0x89,
-0xdf,0x10,0x0a,0x92,0xef,0x29,0xa0,0x09,0x00,0x54,0x00,0x70,0x59,0x25,0x32,0x43,
-0x32,0x9c,0x7d,0x24,0x00,0x74,0x01,0x10,0x01,0xbc,0x1f,0xf0,0x01,0x0b,0xff,0x40,
-0x1f,0x10,0x06,0xc0,0x5e,0x01,0xf1,0x00,0xb7,0x00,0xf2,0x1f,0x10,0x9c,0x2f,0xf0,
-0x02,0xfe,0xe2,0xb7,0x00,0xf2,0x0f,0x31,0x07,0xb0,0x4e,0x00,0xf1,0x00,0x0c,0xef,
-0x50,0x0f,0xc3,0x02,0x02,0x8b,0x08,0x2e,0x0f,0x10,0x4b,0x2f,0xe0,0x3a,0xb3,0x00,
-0xe1,0x00,0x0f,0x77,0xf0,0x0f,0x20,0x04,0xe0,0x0d,0x40,0x9c,0x07,0xc0,0xc5,0x0f,
-0xff,0x22,0xf1,0x1e,0x20,0xf3,0x10,0x09,0xff,0x90,0xd2,0x3a,0x01,0x3d,0x00,0xa4,
-0x11,0x12,0x22,0x00,0x00,0x4f,0xfe,0xee,0xf0,0x00,0x42,0x33,0x03,0x54,0x2d,0x03,
-0x86,0x24,0x03,0x36,0x22,0xf0,0x05,0x40,0x00,0xd3,0x00,0x0a,0xdd,0xb0,0x0f,0x40,
-0x02,0xf0,0x0f,0x20,0xf4,0x00,0x5d,0x00,0xc5,0x0e,0x51,0x58,0x00,0xa3,0xef,0xf2,
-0x1f,0x76,0xf1,0x0e,0x40,0x00,0x4c,0xb4,0xd6,0x0a,0x64,0x30,0x00,0x0c,0x10,0x00,
-0x91,0x9c,0x0a,0x03,0x1c,0x2b,0xf1,0x12,0xfe,0x30,0x00,0x03,0xab,0x30,0x09,0x20,
-0x01,0xfa,0x9f,0x10,0xe4,0x00,0x4e,0x00,0xe4,0x0e,0x51,0x04,0xd0,0x0c,0x50,0xef,
-0xe3,0x1f,0x10,0xe2,0x0e,0x30,0x00,0x7e,0xd7,0xdd,0x2c,0x20,0x05,0xba,0xee,0x40,
-0x20,0x34,0x52,0xea,0x19,0x10,0xbb,0xea,0x19,0x73,0x7d,0xd3,0x00,0x05,0xd5,0x5e,
-0x28,0xea,0x19,0x81,0x01,0x88,0x20,0x0a,0x20,0x01,0xe9,0x9e,0x8f,0x02,0xf3,0x04,
-0xd4,0x0e,0x52,0x05,0xd0,0x0c,0x50,0xee,0xe3,0x2f,0x54,0xf2,0x0e,0x30,0x00,0x5c,
-0xd6,0x00,0xf3,0xc7,0x0e,0x04,0xec,0x07,0x14,0x1e,0xf7,0x07,0x22,0xf2,0x00,0xb4,
-0x06,0x19,0xf6,0x99,0x01,0x80,0x29,0x92,0x00,0xe1,0x00,0x0e,0x98,0xe0,0x1f,0x01,
-0x13,0x0e,0x1f,0x01,0xb0,0xfe,0x12,0xf2,0x1f,0x20,0xf3,0x10,0x08,0xff,0x80,0x0f,
-0x0b,0x02,0x00,0x43,0x0b,0x90,0x44,0x44,0x44,0x00,0x00,0x1f,0xcc,0xbc,0xf2,0x96,
-0x01,0x10,0x0f,0xfe,0x13,0x25,0x01,0xf2,0x32,0x1f,0x01,0x41,0x14,0x10,0x82,0x48,
-0x00,0x13,0xa9,0x48,0x00,0x14,0xf3,0x67,0x01,0x90,0x0e,0x30,0xf2,0x00,0x09,0xee,
-0xa0,0x0f,0x20,0xa6,0x06,0x10,0x80,0x79,0x40,0x70,0x09,0x10,0x00,0x1f,0x22,0x22,
-0xf2,0xdf,0x27,0x20,0xef,0x20,0x5f,0x01,0x04,0x1d,0x0b,0xc0,0x02,0x9a,0x30,0x0d,
-0x10,0x00,0xe9,0x9f,0x00,0xf2,0x00,0x4e,0x0f,0x3b,0x00,0x1a,0x01,0x50,0xff,0xf2,
-0x2f,0x00,0xe2,0x0f,0x3b,0x30,0xd9,0x00,0xf2,0x83,0x04,0xd0,0x0d,0x10,0x00,0x00,
-0x7b,0xb8,0x10,0x00,0x00,0xac,0x43,0x9d,0x00,0x1a,0x04,0x01,0x99,0x3f,0x1a,0x5f,
-0x15,0x23,0x73,0x9a,0x30,0x0e,0x10,0x00,0xe9,0x8f,0x48,0x00,0x11,0x30,0x48,0x00,
-0x30,0xe1,0x1f,0x21,0x48,0x00,0x25,0x7e,0xe7,0x1e,0x02,0x90,0x3e,0xee,0xef,0xf3,
-0x00,0x00,0x14,0x11,0x50,0xbd,0x09,0x00,0xe8,0x00,0x31,0x4d,0x01,0xf3,0x4a,0x11,
-0xf0,0x20,0xe7,0x00,0x01,0x54,0x00,0xa1,0xc2,0x0d,0xbc,0x90,0xe3,0xe4,0x3f,0x02,
-0xf0,0xe4,0xe4,0x4d,0x00,0xf1,0xef,0xf4,0x2f,0x02,0xe0,0xe4,0xe3,0x0a,0xdd,0x70,
-0xe4,0xe3,0x00,0x32,0x00,0x71,0x71,0x00,0x09,0xbb,0xbb,0xb0,0x00,0x0e,0x74,0x44,
-0xf2,0xc1,0x0c,0x00,0x4b,0x09,0x42,0x01,0xf2,0x00,0x0c,0x8c,0x09,0x0d,0xbd,0x02,
-0x20,0xfd,0xc1,0xbd,0x02,0x10,0x53,0xbd,0x02,0x01,0xc8,0x02,0x20,0x0f,0x20,0xbd,
-0x02,0x2f,0xff,0xf1,0xbd,0x02,0x09,0xf0,0x03,0x03,0xab,0x40,0x0a,0x20,0x01,0xf7,
-0x6f,0x10,0xe6,0x20,0x4e,0x00,0xd4,0x0e,0xed,0x25,0xd0,0x21,0x16,0xd1,0x2f,0x11,
-0xf2,0x0e,0xcb,0x10,0x9f,0xf9,0x00,0xe5,0x10,0x00,0x11,0x7d,0x11,0x80,0x02,0x31,
-0x40,0x00,0x00,0x3e,0xdc,0xfa,0x91,0x4a,0x20,0x00,0xe5,0x10,0x06,0x77,0x2e,0x40,
-0x00,0x03,0xdf,0xef,0x90,0x6b,0x0c,0xf9,0x16,0xc0,0x2b,0xd7,0x00,0x2e,0x0c,0x93,
-0xe5,0x02,0xe1,0xf0,0x08,0xa0,0x2e,0x3f,0x00,0x6b,0xad,0xe2,0xf0,0x07,0xb2,0x6f,
-0x0f,0x30,0xb8,0x02,0xf0,0x7e,0xbe,0x10,0x2f,0x00,0x35,0x10,0x02,0xf0,0xb9,0x22,
-0x20,0x00,0x23,0xda,0x19,0x20,0xed,0xa0,0x72,0x27,0xf0,0x05,0xf2,0x03,0xf0,0x3e,
-0x00,0xc5,0xbc,0xf0,0x3f,0x00,0xd4,0x37,0xf0,0x0e,0x76,0xf1,0x03,0xe0,0x04,0xcc,
-0x91,0x04,0x01,0x4c,0x07,0x62,0x48,0x00,0x01,0xa0,0x00,0x6b,0x35,0x36,0x10,0x01,
-0x51,0x4c,0xb0,0xff,0xc0,0x01,0x89,0x20,0x01,0xa0,0x0d,0xa8,0xe0,0x02,0x32,0x00,
-0x10,0x35,0x3c,0x00,0xa2,0xbd,0xf0,0x1f,0x64,0xf2,0x02,0xf0,0x04,0xcd,0x60,0x8d,
-0x27,0x12,0x40,0xb5,0x22,0x42,0x01,0x11,0x15,0xe0,0x9a,0x0e,0x10,0x98,0x45,0x0a,
-0x01,0x20,0x2d,0x05,0xfa,0x04,0xf2,0x0f,0x01,0x89,0x20,0x00,0xf0,0x0d,0xa8,0xe0,
-0x00,0xf1,0x3f,0x00,0xd4,0xab,0xf1,0x3e,0x00,0xc5,0x34,0xf1,0x1f,0x43,0xf2,0x00,
-0xf1,0x05,0xee,0x70,0x01,0xf1,0x3c,0x2e,0x10,0x66,0x7d,0x00,0x60,0x89,0x11,0x14,
-0xe0,0x00,0x8f,0x7a,0x01,0x31,0x88,0x00,0x03,0x50,0x00,0x17,0xc0,0x46,0x00,0xf2,
-0x0e,0x88,0x20,0x05,0xc0,0x0e,0x98,0xe0,0x05,0xc0,0x3f,0x00,0xd4,0xad,0xc0,0x3e,
-0x00,0xd5,0x38,0xc0,0x1f,0x64,0xf2,0x05,0xc0,0x04,0xcc,0x60,0x05,0xc0,0xc0,0x14,
-0xf1,0x09,0xd0,0x4a,0x0a,0x30,0x00,0xf2,0x7c,0x0d,0x40,0x00,0xff,0xfc,0x1f,0x90,
-0x00,0xf1,0x7c,0x8c,0xf2,0x00,0xee,0xfb,0xe2,0x68,0x3c,0x01,0x00,0xcd,0x00,0xf2,
-0x0b,0x90,0x0d,0xa8,0xe0,0x03,0xe0,0x3f,0x00,0xd4,0x26,0xe0,0x4e,0x00,0xc5,0xad,
-0xe0,0x1f,0x43,0xf2,0x03,0xe0,0x06,0xee,0x70,0x03,0xe0,0xc8,0x0d,0x30,0x09,0x30,
-0x3b,0xc7,0x0e,0xf5,0x02,0x7d,0x00,0x00,0x4f,0xc0,0xdf,0x50,0x00,0xc7,0xae,0xe4,
-0xf3,0x06,0xa0,0x0e,0x30,0x47,0x65,0x31,0xf0,0x19,0xb3,0x02,0xbc,0x30,0xe3,0xd4,
-0x0b,0x86,0xd0,0xe3,0xe4,0x0f,0x10,0xf2,0xe3,0xe4,0x1f,0x00,0xdd,0xf3,0xe4,0x1f,
-0x00,0xe5,0xe3,0xd4,0x0e,0x31,0xf1,0xd3,0xd4,0x07,0xdc,0x90,0xd3,0xd4,0x00,0x45,
-0x00,0xd3,0xe0,0x17,0x01,0x05,0x00,0x20,0xe3,0xd4,0x55,0x32,0xf0,0x16,0xa2,0x01,
-0x54,0x00,0xb1,0xc2,0x0d,0xbd,0x80,0xf2,0xe4,0x3f,0x04,0xd1,0xf2,0xd4,0x4d,0x03,
-0xff,0xf3,0xd4,0x2f,0x05,0xd0,0xe3,0xd4,0x0a,0xef,0x50,0xe3,0xe4,0x00,0x11,0x00,
-0x51,0x60,0x00,0x95,0x4b,0x02,0x38,0x28,0x01,0x0a,0x0c,0x11,0x3e,0x20,0x37,0x07,
-0xe5,0x03,0xf0,0x12,0x02,0xc0,0x2b,0xd8,0x00,0x3e,0x0c,0x93,0xd5,0x79,0xe1,0xf0,
-0x07,0xa7,0xae,0x3f,0x00,0x6b,0x03,0xe2,0xf0,0x07,0xb1,0x4e,0x0f,0x20,0xa8,0xdf,
-0xe0,0x8d,0xae,0x10,0x2e,0xfd,0x01,0x09,0xb6,0x24,0xf0,0x0d,0x18,0x02,0x9b,0x70,
-0x01,0x90,0xd9,0x4d,0x64,0x6f,0x2f,0x00,0x7b,0xbc,0xf3,0xe0,0x06,0xb0,0x2f,0x1f,
-0x30,0xa9,0xde,0xf0,0x7f,0xed,0x10,0x2f,0x04,0x29,0x54,0xe0,0x00,0x12,0x22,0x21,
-0xb6,0x24,0x0b,0xd3,0x19,0x02,0xcd,0x0a,0xf3,0x0d,0x50,0x00,0x3e,0x0b,0xdc,0xc0,
-0x37,0xf2,0xf0,0x0f,0x3b,0xdf,0x4d,0x00,0xc5,0x03,0xf4,0xe0,0x0d,0x42,0x5f,0x0f,
-0x87,0xf1,0xef,0xf0,0x3b,0xb3,0x79,0x11,0x41,0x09,0x70,0x00,0x2a,0x4e,0x08,0x40,
-0x0a,0x81,0x12,0x22,0xbf,0x01,0xf2,0x10,0xb0,0x01,0x78,0x40,0x01,0xa0,0x0d,0xb7,
-0xe5,0x25,0xf0,0x3f,0x00,0x7b,0xcd,0xf0,0x3f,0x00,0x6b,0x02,0xf0,0x0e,0x73,0xc9,
-0xcd,0xf0,0x03,0xbd,0x90,0x24,0xe0,0x92,0x12,0x06,0x37,0x02,0x01,0xec,0x24,0x10,
-0x8c,0x37,0x02,0x13,0x7f,0x01,0x0d,0x00,0x32,0x03,0xf1,0x07,0x01,0x90,0xe9,0x7f,
-0x13,0x6f,0x3f,0x00,0xd5,0xbc,0xf3,0xe0,0x0c,0x50,0x3f,0x1f,0x21,0xe3,0xef,0xf0,
-0x6e,0xe8,0xa5,0x00,0x02,0x7c,0x1c,0x00,0x53,0x20,0xe4,0x90,0x06,0xc0,0x00,0x5e,
-0x00,0x3e,0x20,0x0a,0xb0,0x00,0x7f,0xef,0xb2,0xc0,0x0c,0x05,0xa5,0x01,0x60,0xe7,
-0xf3,0xe4,0x0f,0x10,0xf9,0xa0,0x01,0x24,0xd3,0xd3,0xa5,0x01,0x6f,0xfd,0xf3,0xd4,
-0x07,0xdc,0xa0,0xa5,0x01,0x01,0x50,0x71,0xa2,0x00,0x04,0x99,0xec,0x44,0x50,0x77,
-0xd8,0x00,0x00,0xc6,0x6a,0x00,0x10,0xe5,0x3c,0x14,0x10,0xaa,0xe9,0x4f,0x30,0x2d,
-0xfe,0xd2,0xa1,0x29,0x05,0xab,0x09,0x10,0x99,0x7d,0x11,0x00,0x17,0x2a,0x10,0x11,
-0x59,0x0b,0x10,0x19,0x05,0x3c,0x51,0xda,0x33,0xac,0x00,0x01,0x63,0x31,0x82,0xcb,
-0x55,0xcb,0x00,0x00,0x17,0xdc,0x60,0x65,0x09,0x06,0x76,0x36,0x25,0x00,0xa3,0xb2,
-0x20,0x12,0xf5,0xa3,0x33,0x05,0xa5,0x1f,0x80,0x3c,0xff,0xc3,0x00,0x00,0x0f,0x60,
-0x08,0x1c,0x10,0x00,0xda,0x11,0x42,0x07,0xfd,0xee,0x50,0xe8,0x0b,0x14,0x0e,0xb0,
-0x45,0x02,0x0d,0x02,0x10,0xf3,0x08,0x06,0x22,0x0e,0x30,0x0b,0x00,0x20,0x03,0xf1,
-0xf2,0x00,0x15,0x2f,0xbc,0x0c,0x03,0x89,0x00,0x14,0x22,0x89,0x00,0xe2,0xda,0x45,
-0xbb,0x00,0x00,0x18,0xed,0x71,0x00,0x01,0x22,0xb9,0x22,0x20,0x09,0x0c,0x30,0x40,
-0x00,0x03,0x49,0x41,0x17,0x0f,0xd5,0x09,0x02,0xa5,0x41,0x13,0x00,0x1e,0x07,0xf0,
-0x03,0x96,0x00,0x06,0xfd,0xe3,0x0a,0x70,0x00,0xf4,0x08,0xb0,0xa8,0x00,0x2f,0x00,
-0x4d,0x0a,0x80,0x0b,0x00,0xc0,0x9a,0x51,0x05,0xfe,0xd2,0x09,0xda,0x40,0x00,0x20,
-0x00,0x98,0xe0,0x04,0xd5,0x09,0x80,0x00,0x00,0xf4,0x33,0xa8,0x00,0xaf,0xfe,0xdc,
-0x8a,0x80,0x3d,0x0c,0xf0,0x1d,0x08,0x70,0x00,0x01,0x9c,0xa1,0x0c,0x20,0x00,0xaa,
-0x29,0xa0,0xe4,0x00,0x0d,0x40,0x3d,0x0e,0x40,0x00,0xb9,0x29,0xc0,0xe6,0x10,0x02,
-0xcf,0xc2,0x0e,0xfe,0x10,0x00,0xf1,0x01,0xe4,0x00,0xbe,0xef,0xff,0x8e,0x40,0x00,
-0x11,0x10,0x09,0x01,0x10,0x71,0x6a,0x26,0x02,0x36,0x12,0x33,0xe5,0x11,0x11,0xc1,
-0x0e,0x00,0xe1,0x2c,0xf0,0x0a,0xa0,0x2d,0xef,0x50,0x3e,0x09,0x90,0x4e,0x03,0xe0,
-0xc5,0x00,0xf0,0x2e,0x0a,0x90,0x4e,0x02,0xe0,0x2d,0xee,0x50,0x2e,0x00,0x02,0xd8,
-0x02,0xb5,0xc4,0x00,0x2e,0x00,0x0c,0x62,0x42,0xe2,0xff,0xfe,0xda,0x1f,0x19,0xf0,
-0x07,0x1d,0x00,0x9c,0xb2,0x01,0x90,0x8b,0x28,0xc0,0x3e,0x0c,0x60,0x2f,0x03,0xe0,
-0x9b,0x27,0xd0,0x3e,0x01,0xaf,0xc3,0xd3,0x2f,0xf3,0x03,0x01,0x3f,0x4e,0xef,0xff,
-0xa3,0xf0,0x11,0x10,0x00,0x3f,0x00,0x63,0x00,0x02,0xc0,0x0c,0x60,0x14,0x3d,0x01,
-0xc5,0x13,0x30,0x03,0x88,0x40,0xf2,0x01,0x40,0xe7,0x00,0x00,0xd6,0x78,0x01,0x10,
-0xe4,0x37,0x01,0x10,0xb9,0xf2,0x01,0x30,0x2e,0xdd,0xd2,0x76,0x1f,0x10,0x30,0x50,
-0x2f,0x10,0xe3,0x0e,0x09,0x27,0xe3,0x00,0x65,0x17,0x0d,0x69,0x01,0x60,0xbc,0x00,
-0x00,0x3f,0xbb,0xf3,0x28,0x0c,0x14,0xf3,0xf2,0x01,0x25,0x33,0x10,0x8a,0x30,0x40,
-0x3f,0x10,0x00,0xe7,0xf0,0x29,0x34,0x4e,0xee,0xe6,0x8a,0x30,0x10,0x37,0x4d,0x34,
-0x30,0x7e,0x88,0xe5,0x6f,0x04,0x23,0x05,0xd0,0x55,0x33,0x93,0x0a,0xc4,0x4b,0xa0,
-0x00,0x00,0x07,0xbb,0x70,0xb7,0x3c,0x12,0xef,0x72,0x00,0x11,0x0c,0x10,0x07,0x16,
-0xc5,0x9d,0x16,0x15,0xb4,0x17,0x05,0x83,0x18,0xcc,0x80,0x00,0x00,0xcb,0x33,0xbb,
-0x89,0x00,0x89,0xd9,0x23,0xac,0x00,0x00,0x29,0xdc,0x91,0x21,0x16,0x01,0xbc,0x0c,
-0x10,0x3e,0x91,0x06,0x14,0x18,0xcc,0x2b,0x06,0xb5,0x0d,0x01,0x7a,0x02,0x30,0xf7,
-0x00,0x6e,0x79,0x02,0xdd,0x5f,0x00,0x00,0x6f,0xde,0xe5,0x00,0x01,0x00,0x22,0x00,
-0x10,0x8f,0xa3,0x16,0x23,0x0e,0x30,0xa9,0x15,0x0a,0x82,0x2e,0x10,0x19,0x6e,0x00,
-0x51,0xe9,0x22,0x9d,0x00,0x01,0xc3,0x00,0x20,0x9e,0xaa,0x95,0x52,0x60,0x54,0x10,
-0x00,0x8d,0xcb,0xbb,0x3b,0x2f,0x63,0x7e,0x44,0x42,0x00,0x01,0x4e,0x6b,0x30,0x00,
-0x12,0x11,0x00,0x41,0x00,0x01,0x02,0x27,0x24,0xfe,0x20,0x3c,0x00,0x13,0xad,0xbe,
-0x00,0x23,0x9e,0x9a,0x3c,0x00,0x11,0xaf,0xfc,0x3f,0x20,0x22,0x7c,0xaa,0x2f,0x10,
-0x27,0x65,0x00,0x10,0x8c,0xe4,0x17,0x00,0x15,0x17,0x60,0x7f,0x62,0xdc,0x10,0x03,
-0xa3,0x69,0x02,0x00,0xe1,0x00,0xf0,0x1b,0x08,0xca,0x10,0x3d,0x07,0xd3,0x9b,0x04,
-0xe0,0xb6,0x01,0xf0,0x3e,0x0b,0x60,0x1f,0x03,0xe0,0x6c,0x39,0xb0,0x3e,0x00,0x8c,
-0xa1,0x03,0xe1,0x66,0x67,0x8a,0x4e,0x17,0x7f,0x75,0x23,0xe0,0x00,0xf2,0x5d,0xee,
-0x00,0x0f,0x86,0x0f,0x20,0xf1,0x00,0xe7,0x31,0x13,0x01,0x74,0x03,0x91,0x9c,0xa2,
-0x03,0xd0,0x08,0xb2,0x9c,0x03,0xe0,0x31,0x02,0xf0,0x08,0x08,0xb3,0x9b,0x03,0xf0,
+0x00,0x5d,0x00,0x02,0x05,0x00,0x70,0x03,0xf0,0x00,0x3e,0xff,0xff,0xc0,0x41,0x00,
+0x31,0x20,0x00,0xb2,0xb1,0x08,0xf1,0x20,0x04,0xe0,0x03,0xf1,0x00,0x3e,0x00,0x9f,
+0x80,0x03,0xe0,0x3e,0x4e,0x50,0x3e,0x3e,0x50,0x3e,0x33,0xe3,0x30,0x00,0x10,0x3d,
+0x00,0x02,0xac,0xc7,0x00,0x02,0xe9,0x45,0xda,0x00,0x6d,0x00,0x04,0xf0,0x04,0xf3,
+0x00,0xac,0x00,0x07,0xff,0xfc,0x20,0xa2,0x02,0xf1,0x20,0x10,0x01,0x03,0x80,0x00,
+0x4d,0x05,0xc0,0x5d,0x00,0x05,0xd0,0x6c,0x05,0xd0,0x00,0x6c,0x07,0xb0,0x5d,0x00,
+0x08,0xf0,0x9d,0x05,0xe3,0x10,0xbf,0x3b,0xf1,0x4f,0xd8,0x0e,0xc8,0xfd,0x54,0xd0,
+0x05,0xd4,0xfc,0x6a,0x4d,0x00,0xa6,0x0d,0x41,0xc4,0x6b,0x0a,0x11,0x4d,0xcd,0x04,
+0x01,0x91,0x06,0x19,0x3d,0x88,0x09,0x30,0x3e,0x00,0xc5,0x8d,0x01,0xf2,0x06,0xf4,
+0x00,0x00,0x9f,0x13,0xf8,0x00,0x01,0xfd,0x89,0xdf,0x10,0x0a,0x92,0xef,0x29,0xa0,
+0x09,0x00,0x54,0x00,0xef,0x00,0xa2,0x24,0x44,0x44,0x43,0x32,0x9c,0xcc,0xcc,0xcc,
+0xc8,0x74,0x01,0xf0,0x1b,0x01,0x00,0x01,0xf0,0x00,0x0b,0xff,0x40,0x1f,0x10,0x06,
+0xc0,0x5e,0x01,0xf1,0x00,0xb7,0x00,0xf2,0x1f,0x10,0x0c,0x60,0x0e,0x30,0xfe,0xe2,
+0xb7,0x00,0xf2,0x0f,0x31,0x07,0xb0,0x4e,0x00,0xf1,0x00,0x0c,0xef,0x50,0x0f,0xc3,
+0x02,0x02,0x8b,0x08,0x25,0x0f,0x10,0x67,0x04,0x14,0x07,0x7a,0x00,0xe0,0x3a,0xb3,
+0x00,0xe1,0x00,0x0f,0x77,0xf0,0x0f,0x20,0x04,0xe0,0x0d,0x40,0x9c,0x07,0xf1,0x01,
+0xc5,0x0f,0xff,0x22,0xf1,0x1e,0x20,0xf3,0x10,0x09,0xff,0x90,0x0f,0x20,0x00,0x01,
+0x3d,0x00,0x91,0x11,0x12,0x22,0x00,0x00,0x4f,0xfe,0xee,0xf0,0x47,0x05,0x15,0x10,
+0x5f,0x06,0x22,0x1f,0x00,0x48,0x01,0x02,0x01,0x00,0xf0,0x06,0x03,0x40,0x00,0xd3,
+0x00,0x0a,0xdd,0xb0,0x0f,0x40,0x02,0xf0,0x0f,0x20,0xf4,0x00,0x5d,0x00,0xc5,0x0e,
+0x51,0x58,0x00,0xa3,0xef,0xf2,0x1f,0x76,0xf1,0x0e,0x40,0x00,0x4c,0xb4,0xd6,0x0a,
+0x64,0x30,0x00,0x0c,0x10,0x00,0x91,0x9c,0x0a,0x30,0x31,0x11,0x10,0xfc,0x03,0xf0,
+0x14,0xfe,0x30,0x00,0x03,0xab,0x30,0x09,0x20,0x01,0xfa,0x9f,0x10,0xe4,0x00,0x4e,
+0x00,0xe4,0x0e,0x51,0x04,0xd0,0x0c,0x50,0xef,0xe3,0x1f,0x10,0xe2,0x0e,0x30,0x00,
+0x7e,0xd7,0x00,0xc2,0xb0,0x02,0xf1,0x17,0xba,0x20,0x00,0x16,0x00,0x34,0x52,0x00,
+0x05,0xc0,0x2a,0xbb,0xa1,0x00,0x5c,0x00,0x7d,0xd3,0x00,0x05,0xd5,0x5e,0x28,0x90,
+0x00,0x19,0x85,0x7e,0xd3,0x00,0x01,0x88,0x20,0x0a,0x20,0x01,0xe9,0x9e,0x8f,0x02,
+0xf2,0x04,0xd4,0x0e,0x52,0x05,0xd0,0x0c,0x50,0xee,0xe3,0x2f,0x54,0xf2,0x0e,0x30,
+0x00,0x5c,0xd6,0x00,0xf3,0xbe,0x08,0x05,0xec,0x07,0x14,0x1e,0xf7,0x07,0x22,0xf2,
+0x00,0xb4,0x06,0x19,0xf6,0x99,0x01,0x80,0x29,0x92,0x00,0xe1,0x00,0x0e,0x98,0xe0,
+0x1f,0x01,0x13,0x0e,0x1f,0x01,0xb0,0xfe,0x12,0xf2,0x1f,0x20,0xf3,0x10,0x08,0xff,
+0x80,0x0f,0x0b,0x02,0x00,0x43,0x0b,0xc0,0x44,0x44,0x44,0x00,0x00,0x1f,0xcc,0xbc,
+0xf2,0x00,0x01,0xf0,0x6b,0x0b,0x41,0x1f,0x10,0x01,0xf2,0xd2,0x00,0x04,0x48,0x00,
+0x20,0x17,0x82,0x48,0x00,0x13,0xa9,0x48,0x00,0x14,0xf3,0x67,0x01,0x90,0x0e,0x30,
+0xf2,0x00,0x09,0xee,0xa0,0x0f,0x20,0xa6,0x06,0xf0,0x03,0x80,0x00,0x00,0xa0,0x00,
+0x09,0x10,0x00,0x1f,0x22,0x22,0xf2,0x00,0x01,0xfe,0xee,0xef,0x20,0x5f,0x01,0x04,
+0x1d,0x0b,0xa0,0x02,0x9a,0x30,0x0d,0x10,0x00,0xe9,0x9f,0x00,0xf2,0x1a,0x01,0x20,
+0x0f,0x31,0x1a,0x01,0xc0,0xff,0xf2,0x2f,0x00,0xe2,0x0f,0x20,0x00,0x9e,0xd9,0x00,
+0xf2,0x83,0x04,0xd0,0x0d,0x10,0x00,0x00,0x7b,0xb8,0x10,0x00,0x00,0xac,0x43,0x9d,
+0x00,0x1a,0x04,0x22,0xf3,0x00,0x1d,0x04,0x33,0x03,0xdf,0xed,0xba,0x09,0x00,0x48,
+0x00,0x53,0x0e,0x10,0x00,0xe9,0x8f,0x48,0x00,0x11,0x30,0x48,0x00,0x30,0xe1,0x1f,
+0x21,0x48,0x00,0x25,0x7e,0xe7,0x1e,0x02,0x90,0x3e,0xee,0xef,0xf3,0x00,0x00,0x14,
+0x11,0x50,0xbd,0x09,0x00,0xe8,0x00,0xf0,0x28,0x4d,0x01,0xf3,0x00,0x00,0x6f,0xff,
+0xff,0xe7,0x00,0x01,0x54,0x00,0xa1,0xc2,0x0d,0xbc,0x90,0xe3,0xe4,0x3f,0x02,0xf0,
+0xe4,0xe4,0x4d,0x00,0xf1,0xef,0xf4,0x2f,0x02,0xe0,0xe4,0xe3,0x0a,0xdd,0x70,0xe4,
+0xe3,0x00,0x32,0x00,0x71,0x71,0x00,0x09,0xbb,0xbb,0xb0,0x00,0x0e,0x74,0x44,0xf2,
+0xc1,0x0c,0x00,0x4b,0x09,0x42,0x01,0xf2,0x00,0x0c,0x8c,0x09,0x0d,0xbd,0x02,0x20,
+0xfd,0xc1,0xbd,0x02,0x10,0x53,0xbd,0x02,0x01,0xc8,0x02,0x20,0x0f,0x20,0xbd,0x02,
+0x2f,0xff,0xf1,0xbd,0x02,0x09,0xf0,0x15,0x03,0xab,0x40,0x0a,0x20,0x01,0xf7,0x6f,
+0x10,0xe6,0x20,0x4e,0x00,0xd4,0x0e,0xed,0x25,0xd0,0x0c,0x50,0xe4,0x00,0x2f,0x11,
+0xf2,0x0e,0xcb,0x10,0x9f,0xf9,0x00,0xe5,0x10,0x00,0x11,0x00,0x46,0x0d,0xe0,0x02,
+0x31,0x40,0x00,0x00,0x3e,0xdc,0xfa,0x00,0x00,0x0b,0x70,0x00,0xe5,0x10,0x06,0x77,
+0x2e,0x40,0x00,0x03,0xdf,0xef,0x90,0x6b,0x0c,0xf0,0x16,0xc0,0x2b,0xd7,0x00,0x2e,
+0x0c,0x93,0xe5,0x02,0xe1,0xf0,0x08,0xa0,0x2e,0x3f,0x00,0x6b,0xad,0xe2,0xf0,0x07,
+0xb2,0x6f,0x0f,0x30,0xb8,0x02,0xf0,0x7e,0xbe,0x10,0x2f,0x00,0x35,0x10,0x02,0xf0,
+0xd5,0x05,0x00,0xbd,0x00,0x00,0xc2,0x00,0xf0,0x12,0x19,0x00,0x23,0x00,0x02,0xc0,
+0x08,0xed,0xa0,0x03,0xf0,0x1f,0x10,0xf2,0x03,0xf0,0x3e,0x00,0xc5,0xbc,0xf0,0x3f,
+0x00,0xd4,0x37,0xf0,0x0e,0x76,0xf1,0x03,0xe0,0x04,0xcc,0x91,0x04,0x01,0x4c,0x07,
+0x60,0x48,0x00,0x01,0xa0,0x00,0x6b,0x66,0x00,0x10,0x7b,0x49,0x03,0xd0,0x5f,0xff,
+0xff,0xc0,0x01,0x89,0x20,0x01,0xa0,0x0d,0xa8,0xe0,0x02,0x32,0x00,0x10,0x35,0x3c,
+0x00,0xc2,0xbd,0xf0,0x1f,0x64,0xf2,0x02,0xf0,0x04,0xcd,0x60,0x02,0xe0,0x95,0x0d,
+0x10,0x4e,0xf1,0x0b,0x42,0x01,0x11,0x15,0xe0,0x9a,0x0e,0x31,0x98,0x00,0x01,0x71,
+0x07,0x16,0xd0,0x4b,0x0c,0xf2,0x0d,0x01,0x89,0x20,0x00,0xf0,0x0d,0xa8,0xe0,0x00,
+0xf1,0x3f,0x00,0xd4,0xab,0xf1,0x3e,0x00,0xc5,0x34,0xf1,0x1f,0x43,0xf2,0x00,0xf1,
+0x05,0xee,0x70,0x9a,0x03,0x30,0x70,0x00,0x66,0x7d,0x00,0x60,0x89,0x11,0x14,0xe0,
+0x00,0x8f,0x7a,0x01,0x31,0x88,0x00,0x03,0x50,0x00,0x17,0xc0,0x46,0x00,0xf0,0x0e,
+0x88,0x20,0x05,0xc0,0x0e,0x98,0xe0,0x05,0xc0,0x3f,0x00,0xd4,0xad,0xc0,0x3e,0x00,
+0xd5,0x38,0xc0,0x1f,0x64,0xf2,0x05,0xc0,0x04,0xcc,0x60,0x05,0xc0,0x1c,0x01,0xf1,
+0x0b,0x50,0x00,0xd0,0x4a,0x0a,0x30,0x00,0xf2,0x7c,0x0d,0x40,0x00,0xff,0xfc,0x1f,
+0x90,0x00,0xf1,0x7c,0x8c,0xf2,0x00,0xee,0xfb,0xe2,0x68,0x3c,0x01,0x00,0xcd,0x00,
+0xf2,0x0b,0x90,0x0d,0xa8,0xe0,0x03,0xe0,0x3f,0x00,0xd4,0x26,0xe0,0x4e,0x00,0xc5,
+0xad,0xe0,0x1f,0x43,0xf2,0x03,0xe0,0x06,0xee,0x70,0x03,0xe0,0xc8,0x0d,0x30,0x09,
+0x30,0x3b,0xc7,0x0e,0xf4,0x02,0x7d,0x00,0x00,0x4f,0xc0,0xdf,0x50,0x00,0xc7,0xae,
+0xe4,0xf3,0x06,0xa0,0x0e,0x30,0x47,0x86,0x00,0xf2,0x1d,0x91,0xb3,0x02,0xbc,0x30,
+0xe3,0xd4,0x0b,0x86,0xd0,0xe3,0xe4,0x0f,0x10,0xf2,0xe3,0xe4,0x1f,0x00,0xdd,0xf3,
+0xe4,0x1f,0x00,0xe5,0xe3,0xd4,0x0e,0x31,0xf1,0xd3,0xd4,0x07,0xdc,0x90,0xd3,0xd4,
+0x00,0x45,0x00,0xd3,0xd4,0x00,0x00,0x05,0x00,0x70,0xe3,0xd4,0x00,0x00,0x00,0x60,
+0xa2,0xf0,0x28,0x01,0x54,0x00,0xb1,0xc2,0x0d,0xbd,0x80,0xf2,0xe4,0x3f,0x04,0xd1,
+0xf2,0xd4,0x4d,0x03,0xff,0xf3,0xd4,0x2f,0x05,0xd0,0xe3,0xd4,0x0a,0xef,0x50,0xe3,
+0xe4,0x00,0x11,0x00,0x51,0x60,0x00,0x2f,0xff,0xff,0xf0,0x00,0x00,0x00,0x03,0xf0,
+0x00,0x3f,0xff,0xff,0xe0,0x00,0x3e,0x00,0x00,0x00,0x14,0x00,0x23,0xf6,0x00,0x01,
+0x00,0xf0,0x1b,0x02,0xc0,0x2b,0xd8,0x00,0x3e,0x0c,0x93,0xd5,0x79,0xe1,0xf0,0x07,
+0xa7,0xae,0x3f,0x00,0x6b,0x03,0xe2,0xf0,0x07,0xb1,0x4e,0x0f,0x20,0xa8,0xdf,0xe0,
+0x8d,0xae,0x10,0x2e,0x00,0x35,0x10,0x02,0xe0,0x00,0x00,0x00,0x2e,0x2d,0x00,0x00,
+0x09,0x00,0xf0,0x1a,0x18,0x02,0x9b,0x70,0x01,0x90,0xd9,0x4d,0x64,0x6f,0x2f,0x00,
+0x7b,0xbc,0xf3,0xe0,0x06,0xb0,0x2f,0x1f,0x30,0xa9,0xde,0xf0,0x7f,0xed,0x10,0x2f,
+0x00,0x11,0x00,0x01,0xe0,0x00,0x12,0x22,0x21,0x00,0x6e,0xee,0xee,0x2d,0x00,0x50,
+0x4e,0x00,0x00,0x00,0x04,0x09,0x00,0x01,0x79,0x00,0x11,0x20,0x73,0x00,0xf1,0x0e,
+0x04,0x50,0x00,0x3e,0x0b,0xdc,0xc0,0x37,0xf2,0xf0,0x0f,0x3b,0xdf,0x4d,0x00,0xc5,
+0x03,0xf4,0xe0,0x0d,0x42,0x5f,0x0f,0x87,0xf1,0xef,0xf0,0x3b,0xb3,0x29,0x00,0xf0,
+0x23,0x03,0xe0,0x09,0x70,0x00,0x2a,0x00,0xa8,0x00,0x00,0x00,0x0a,0x81,0x12,0x22,
+0x00,0x8f,0xff,0xff,0xb0,0x01,0x78,0x40,0x01,0xa0,0x0d,0xb7,0xe5,0x25,0xf0,0x3f,
+0x00,0x7b,0xcd,0xf0,0x3f,0x00,0x6b,0x02,0xf0,0x0e,0x73,0xc9,0xcd,0xf0,0x03,0xbd,
+0x90,0x24,0xe0,0x58,0x00,0xd0,0x50,0x00,0x4e,0xff,0xff,0xd0,0x00,0x01,0x11,0x15,
+0xe0,0x00,0x6f,0x0a,0x00,0x60,0x8c,0x00,0x01,0x00,0x00,0x7f,0xf7,0x00,0x10,0x00,
+0x55,0x00,0xf1,0x09,0xab,0x40,0x01,0x90,0xe9,0x7f,0x13,0x6f,0x3f,0x00,0xd5,0xbc,
+0xf3,0xe0,0x0c,0x50,0x3f,0x1f,0x21,0xe3,0xef,0xf0,0x6e,0xe8,0xa5,0x00,0xf1,0x0c,
+0x02,0xd0,0x00,0x3a,0xdc,0x70,0x00,0x2e,0x62,0x4c,0x90,0x06,0xc0,0x00,0x5e,0x00,
+0x3e,0x20,0x0a,0xb0,0x00,0x7f,0xef,0xb2,0x00,0x00,0x01,0x3e,0x00,0xf2,0x1d,0x91,
+0xb3,0x02,0xbc,0x30,0xe3,0xd4,0x0b,0x86,0xe7,0xf3,0xe4,0x0f,0x10,0xf9,0xf3,0xe4,
+0x1f,0x00,0xd3,0xd3,0xe4,0x1f,0x00,0xe5,0xe3,0xd4,0x0e,0x31,0xfd,0xf3,0xd4,0x07,
+0xdc,0xa0,0xd3,0xd4,0x00,0x45,0x00,0xd3,0xd4,0x00,0x00,0x05,0x00,0x10,0xe3,0x05,
+0x00,0xe0,0x71,0xa2,0x00,0x04,0x99,0x60,0x00,0x00,0x6e,0x77,0xd8,0x00,0x00,0xc6,
+0x6a,0x00,0xf0,0x02,0xe5,0x00,0x2f,0x00,0x00,0xaa,0x00,0x8c,0x00,0x00,0x2d,0xfe,
+0xd2,0x00,0x00,0x00,0x22,0x5e,0x00,0x10,0x89,0x05,0x00,0xf0,0x18,0x99,0x00,0x00,
+0xbf,0xff,0xff,0xff,0xfb,0x01,0x11,0x11,0x11,0x11,0x00,0x19,0xcc,0x91,0x00,0x00,
+0xda,0x33,0xac,0x00,0x01,0xf2,0x00,0x3f,0x00,0x00,0xcb,0x55,0xcb,0x00,0x00,0x17,
+0xdc,0x60,0x00,0x00,0x17,0x01,0x52,0xaf,0xff,0xff,0xff,0xf9,0xc1,0x01,0x10,0xa3,
+0x05,0x00,0x10,0xe4,0x05,0x00,0x93,0xf5,0x11,0x11,0x00,0x00,0xcf,0xff,0xff,0x60,
+0xdb,0x01,0xf3,0x13,0x3c,0xff,0xc3,0x00,0x00,0x0f,0x60,0x08,0xe0,0x00,0x00,0xf4,
+0x00,0x5e,0x00,0x00,0x07,0xfd,0xee,0x50,0x00,0x00,0x00,0xd5,0x00,0x00,0x0e,0xff,
+0xff,0xff,0xff,0x90,0x00,0x00,0x0d,0x02,0x72,0xf3,0x00,0x00,0x11,0x11,0x0e,0x30,
+0x0b,0x00,0x41,0x03,0xf1,0x00,0x01,0x16,0x00,0x13,0xf7,0x47,0x00,0x02,0x89,0x00,
+0x14,0x22,0x89,0x00,0xf3,0x1d,0xda,0x45,0xbb,0x00,0x00,0x18,0xed,0x71,0x00,0x01,
+0x22,0xb9,0x22,0x20,0xae,0xee,0xee,0xee,0xe9,0x00,0x40,0x00,0x03,0x00,0x02,0xf1,
+0x00,0x0f,0x20,0x02,0xff,0xff,0xff,0x20,0x02,0xf0,0x00,0x0f,0x20,0x01,0xff,0xff,
+0xfe,0x10,0x42,0x00,0xf0,0x05,0x20,0x00,0x96,0x00,0x06,0xfd,0xe3,0x0a,0x70,0x00,
+0xf4,0x08,0xb0,0xa8,0x00,0x2f,0x00,0x4d,0x0a,0x80,0x0b,0x00,0xf0,0x0e,0x9a,0x51,
+0x05,0xfe,0xd2,0x09,0xda,0x40,0x00,0x20,0x00,0x98,0x00,0x00,0x0f,0x10,0x09,0x80,
+0x00,0x00,0xf4,0x33,0xa8,0x00,0xaf,0xfe,0xdc,0x8a,0x80,0x39,0x00,0x10,0x98,0x05,
+0x00,0xf0,0x1d,0x08,0x70,0x00,0x01,0x9c,0xa1,0x0c,0x20,0x00,0xaa,0x29,0xa0,0xe4,
+0x00,0x0d,0x40,0x3d,0x0e,0x40,0x00,0xb9,0x29,0xc0,0xe6,0x10,0x02,0xcf,0xc2,0x0e,
+0xfe,0x10,0x00,0xf1,0x01,0xe4,0x00,0xbe,0xef,0xff,0x8e,0x40,0x00,0x11,0x10,0x09,
+0x01,0x70,0x71,0x00,0x0b,0x20,0x00,0x0e,0x40,0x3b,0x00,0x10,0xe5,0x12,0x01,0x11,
+0x0c,0xcb,0x00,0xf0,0x0d,0x01,0x00,0x02,0xa0,0x2d,0xef,0x50,0x3e,0x09,0x90,0x4e,
+0x03,0xe0,0xc5,0x00,0xf0,0x2e,0x0a,0x90,0x4e,0x02,0xe0,0x2d,0xee,0x50,0x2e,0x00,
+0x02,0xd8,0x02,0xc0,0xc4,0x00,0x2e,0x00,0x0c,0x62,0x42,0xe2,0xff,0xfe,0xda,0x2f,
+0x0f,0x02,0x00,0x35,0x03,0xf0,0x1c,0x1d,0x00,0x9c,0xb2,0x01,0x90,0x8b,0x28,0xc0,
+0x3e,0x0c,0x60,0x2f,0x03,0xe0,0x9b,0x27,0xd0,0x3e,0x01,0xaf,0xc3,0x03,0xf0,0x00,
+0xe3,0x01,0x3f,0x4e,0xef,0xff,0xa3,0xf0,0x11,0x10,0x00,0x3f,0x00,0x63,0x00,0x02,
+0xc0,0x0c,0x74,0x01,0xc0,0xc7,0x11,0x11,0x00,0x09,0xff,0xff,0xfc,0x00,0x03,0x88,
+0x40,0xf2,0x01,0x40,0xe7,0x00,0x00,0xd6,0x78,0x01,0x10,0xe4,0x37,0x01,0x10,0xb9,
+0xf2,0x01,0xf1,0x03,0x2e,0xdd,0xd2,0x00,0x00,0x02,0x22,0x30,0x00,0x00,0x4c,0x00,
+0xe3,0x00,0x00,0x4d,0x00,0xe3,0xf2,0x01,0x1f,0xfa,0x69,0x01,0x04,0xb4,0xbc,0x00,
+0x00,0x3f,0xbb,0xf3,0x00,0x00,0x3f,0x00,0xf3,0xf2,0x01,0xf0,0x0b,0x33,0x10,0x00,
+0x00,0x4e,0xdd,0xf7,0x00,0x00,0xe6,0x00,0x3f,0x10,0x00,0xe7,0x00,0x4f,0x10,0x00,
+0x4e,0xee,0xe6,0x00,0x00,0x00,0x11,0x42,0x00,0xf0,0x02,0x37,0x72,0x00,0x00,0x00,
+0x7e,0x88,0xe5,0x00,0x00,0x0e,0x40,0x05,0xd0,0x00,0x00,0xf3,0x48,0x00,0x91,0x0a,
+0xc4,0x4b,0xa0,0x00,0x00,0x07,0xbb,0x70,0x65,0x00,0x32,0x11,0x10,0xef,0x72,0x00,
+0x20,0x0c,0x50,0x0f,0x00,0x10,0xc5,0x05,0x00,0x11,0x0d,0x0b,0x00,0x24,0xb4,0x00,
+0x01,0x00,0x83,0x18,0xcc,0x80,0x00,0x00,0xcb,0x33,0xbb,0x89,0x00,0x81,0xd9,0x23,
+0xac,0x00,0x00,0x29,0xdc,0x91,0x1c,0x00,0x21,0x10,0xaf,0x3f,0x00,0x00,0x18,0x00,
+0x20,0x00,0xe1,0xac,0x03,0x60,0xf2,0x18,0x00,0x00,0x00,0xf3,0x69,0x01,0x47,0xdf,
+0xff,0xff,0x70,0x7a,0x02,0x30,0xf7,0x00,0x6e,0x79,0x02,0xd2,0x5f,0x00,0x00,0x6f,
+0xde,0xe5,0x00,0x01,0x00,0x22,0x00,0x10,0x8f,0x3c,0x00,0x30,0x5d,0x00,0x00,0x29,
+0x02,0x11,0x30,0x76,0x02,0x01,0x0a,0x00,0x01,0x75,0x02,0x25,0x02,0xff,0x41,0x00,
+0x10,0x19,0x6e,0x00,0x51,0xe9,0x22,0x9d,0x00,0x01,0xc3,0x00,0xf2,0x09,0x9e,0xaa,
+0xe8,0x00,0x00,0x02,0x54,0x10,0x00,0x8d,0xcb,0xbb,0xcc,0xc8,0x24,0x44,0x7e,0x44,
+0x42,0x00,0x01,0x4e,0x11,0x00,0x3c,0x00,0x30,0xf0,0x00,0x0e,0x41,0x00,0x20,0x1e,
+0x30,0x74,0x02,0x14,0x20,0x3c,0x00,0x13,0xad,0xbe,0x00,0x23,0x9e,0x9a,0x3c,0x00,
+0xd0,0xaf,0xee,0xee,0xee,0xfa,0x01,0x22,0x7c,0x22,0x10,0x00,0x00,0x27,0x65,0x00,
+0x10,0x8c,0x15,0x04,0xa0,0xff,0x80,0x00,0x00,0x7f,0x62,0xdc,0x10,0x03,0xa3,0x69,
+0x02,0x00,0xe1,0x00,0xf3,0x26,0x08,0xca,0x10,0x3d,0x07,0xd3,0x9b,0x04,0xe0,0xb6,
+0x01,0xf0,0x3e,0x0b,0x60,0x1f,0x03,0xe0,0x6c,0x39,0xb0,0x3e,0x00,0x8c,0xa1,0x03,
+0xe1,0x66,0x67,0x8a,0x4e,0x17,0x7f,0x75,0x23,0xe0,0x00,0xf2,0x5d,0xee,0x00,0x0f,
+0x20,0x25,0xe0,0x00,0xf1,0x00,0x3e,0x00,0x04,0x00,0x01,0x74,0x03,0x91,0x9c,0xa2,
+0x03,0xd0,0x08,0xb2,0x9c,0x03,0xe0,0x31,0x02,0xf0,0x0f,0x08,0xb3,0x9b,0x03,0xf0,
 0x00,0x8c,0x91,0x03,0xf0,0x49,0x99,0xab,0xb3,0xf0,0x14,0x7e,0x32,0x14,0xf0,0x00,
-0x4d,0x07,0xff,0x32,0x00,0x8b,0x06,0x10,0xa8,0x7b,0x39,0x04,0x15,0x3e,0xf0,0x16,
-0xe1,0x02,0xbd,0xc4,0x08,0x60,0xb9,0x16,0xe0,0xa9,0x0b,0x92,0x6e,0x0a,0x90,0x2b,
-0xdc,0x40,0xa9,0x47,0x77,0x8a,0x9a,0x95,0x9b,0xe7,0x63,0xb9,0x00,0x4d,0x0a,0xff,
-0x90,0x00,0x20,0x00,0x53,0x2e,0x02,0xb9,0x40,0x05,0x77,0x78,0xe5,0x00,0xca,0x66,
-0x66,0x10,0x0b,0x31,0x16,0xf0,0x09,0x01,0x89,0x30,0xa2,0xc3,0x0d,0x96,0xf1,0xd4,
-0xd4,0x2f,0x00,0xc4,0xd4,0xd4,0x1f,0x00,0xd4,0xd4,0xd4,0x0b,0xcb,0xd0,0xd4,0x95,
-0x04,0xf0,0x36,0xd4,0xd4,0x59,0x9a,0xba,0xd4,0xd4,0x36,0xbb,0x41,0xd4,0xd4,0x00,
-0x89,0x6a,0xf4,0xd4,0x00,0x89,0x25,0xe4,0xd4,0x00,0x89,0x00,0xd4,0xd4,0x00,0x22,
-0x00,0x41,0x72,0x00,0x7c,0xb2,0x01,0xa0,0x6d,0x38,0xc0,0x3e,0x0b,0x70,0x1f,0x03,
-0xe0,0xb7,0x01,0xf0,0x3e,0x07,0xc3,0x8b,0x02,0xe0,0x08,0xca,0x10,0x2f,0x00,0x00,
-0x13,0x42,0xf3,0xff,0xfe,0xca,0x3f,0x00,0xd6,0x39,0x00,0xfa,0x35,0x20,0x00,0x0f,
-0xec,0x0c,0xb0,0x70,0x00,0x1b,0x00,0x03,0x77,0x20,0x00,0x00,0x7e,0x89,0xd9,0x36,
-0x00,0x2b,0x0f,0x10,0xf4,0xd9,0x01,0x30,0x9c,0x45,0xd7,0x6d,0x02,0x16,0x60,0xd4,
-0x20,0x11,0xf7,0xe8,0x02,0x07,0x05,0x00,0x15,0x4b,0x95,0x31,0x08,0x2d,0x02,0x13,
-0x7d,0x2d,0x02,0x32,0x7f,0xdd,0xf6,0xce,0x21,0x00,0x69,0x02,0x5f,0xe8,0x00,0x0f,
-0x20,0xf3,0x2d,0x02,0x0d,0x01,0xfc,0x02,0x30,0x4d,0xee,0xc2,0x15,0x03,0x40,0x9b,
-0x00,0x02,0xf0,0xa2,0x29,0x10,0xf1,0x6b,0x0c,0x26,0xac,0x55,0x8c,0x00,0x04,0x4e,
-0x18,0x00,0x3e,0x0f,0x0f,0xe1,0x02,0x06,0x17,0x12,0x9d,0x0f,0x03,0xfa,0x1d,0x08,
-0x89,0x1a,0x00,0x07,0x29,0x09,0xb4,0x00,0x40,0x7e,0x00,0x00,0xf4,0x9d,0x41,0x21,
-0x6e,0xee,0xe1,0x02,0x25,0x01,0x10,0x9a,0x31,0x06,0xb4,0x00,0x1e,0x40,0xe1,0x02,
-0x0f,0xec,0x03,0x04,0xa1,0x18,0xbb,0x70,0x00,0x13,0x34,0x44,0x44,0x42,0x9d,0xe6,
-0x0c,0x27,0x01,0x11,0xe1,0x02,0x1e,0x40,0xe1,0x02,0x14,0x9d,0xe1,0x02,0x04,0x1d,
-0x03,0x00,0x9a,0x31,0x12,0xc7,0x2f,0x29,0x08,0xb2,0x34,0x0d,0x28,0x04,0x00,0x7e,
-0x0a,0xf0,0x0d,0x90,0x1c,0xef,0x60,0x3e,0x09,0xa0,0x3f,0x03,0xe0,0xb5,0x00,0xf1,
-0x3e,0x0a,0x80,0x3f,0x03,0xe0,0x2e,0xce,0x60,0x3e,0x00,0x02,0x10,0x03,0xe0,0x8c,
-0x33,0x76,0x3c,0xdd,0xdf,0xe6,0xe0,0x33,0x32,0x07,0x19,0x05,0x30,0x0d,0xf1,0x14,
-0x4c,0x03,0xcd,0x70,0x05,0xd0,0xe7,0x3e,0x50,0x4d,0x4d,0x00,0x8a,0x04,0xd6,0xc0,
-0x06,0xb0,0x4d,0x5c,0x00,0x7b,0x04,0xc2,0xf1,0x0b,0x70,0x4c,0x0a,0xdb,0xd1,0x04,
-0xc0,0x04,0x51,0x2e,0x34,0x11,0x04,0xb0,0x24,0x02,0x78,0x14,0x01,0x49,0x0c,0xf1,
-0x0f,0xb7,0x00,0x2e,0x0d,0x94,0xd6,0x03,0xf2,0xf0,0x07,0xb0,0x3f,0x3e,0x00,0x6b,
-0x03,0xf1,0xf3,0x0a,0x80,0x3f,0x06,0xfe,0xd1,0x03,0xe0,0x00,0x10,0x00,0x2d,0x83,
-0x20,0x44,0x06,0xee,0xee,0xee,0x31,0x08,0x14,0x4e,0x7a,0x00,0x11,0x02,0x6d,0x0a,
-0x40,0x9e,0xdb,0x00,0x3e,0x6c,0x0a,0x60,0xe3,0xe0,0x0c,0x50,0x3e,0x3f,0xc6,0x16,
-0x73,0xe7,0x6f,0x10,0x3e,0x03,0xcc,0x40,0x31,0x1d,0x61,0x67,0x00,0x02,0x80,0x08,
-0x90,0x46,0x07,0x30,0x01,0x00,0x07,0x46,0x07,0xf2,0x09,0x8a,0x50,0x02,0xb0,0xda,
-0x6e,0x50,0x3f,0x3f,0x00,0x7b,0x03,0xf3,0xf0,0x06,0xb0,0x3f,0x0e,0x84,0xc7,0x03,
-0xe0,0x3b,0xd9,0x8b,0x08,0x20,0x30,0x04,0x12,0x34,0x50,0x01,0x11,0x14,0xe0,0x07,
-0xc5,0x28,0x30,0x9a,0x00,0x01,0xa9,0x37,0x12,0xfd,0x4b,0x03,0xf0,0x05,0x8a,0x60,
-0x02,0xb0,0xda,0x7f,0x70,0x3e,0x3f,0x00,0xac,0x03,0xe3,0xf0,0x09,0xd0,0x3e,0x0e,
-0x84,0xe9,0x3b,0x00,0x12,0x10,0x3b,0x00,0x40,0x3f,0xff,0x3e,0xfc,0x1b,0x29,0x51,
-0xf0,0x2f,0xff,0x20,0x3e,0x1f,0x42,0x47,0x2f,0xff,0xa0,0x2d,0x34,0x0d,0xf1,0x09,
-0xa3,0x00,0x3c,0x0d,0x97,0xf1,0x04,0xe2,0xf0,0x0d,0x40,0x4e,0x3f,0x00,0xc5,0x03,
-0xe1,0xf2,0x0e,0x20,0x3e,0x08,0xff,0x90,0xeb,0x00,0xf2,0x04,0x2b,0x00,0x14,0x44,
-0x44,0x30,0x09,0xec,0xcb,0xde,0x00,0x98,0x00,0x04,0xe0,0x09,0x80,0x00,0x5e,0xe1,
-0x08,0xf1,0x0b,0x79,0x40,0x02,0xc0,0xdb,0x6e,0x40,0x3e,0x2f,0x00,0x7a,0x03,0xe3,
-0xf0,0x06,0xb0,0x3e,0x0f,0x51,0xb8,0x03,0xe0,0x4d,0xfb,0x10,0x3e,0x48,0x0a,0x62,
-0x05,0x90,0x00,0x1a,0x00,0x7c,0xb1,0x00,0x50,0xfe,0x00,0x7b,0x00,0x03,0x0b,0x1f,
-0x14,0xfc,0x86,0x0a,0xf0,0x0a,0x0b,0x40,0x0d,0xa8,0xe0,0x0d,0x50,0x3f,0x00,0xd4,
-0x0d,0x50,0x4e,0x00,0xc5,0x0d,0x50,0x1f,0x43,0xf2,0x0d,0x50,0x06,0xee,0x70,0xdd,
-0x05,0x00,0xb7,0x48,0x30,0x0a,0x20,0x85,0x05,0x19,0xf3,0x02,0xd6,0x00,0x00,0x5f,
-0xa2,0xfe,0x10,0x01,0xe6,0xce,0x8a,0xb0,0x07,0x80,0x3c,0x00,0x91,0x07,0x2e,0x20,
-0x20,0x0a,0xcb,0x13,0x20,0x10,0xf1,0x0f,0x11,0x00,0xee,0x0c,0x10,0xb7,0x6a,0x0c,
-0xc0,0x3f,0x30,0x0f,0xee,0x30,0x0c,0xea,0x00,0xf3,0x10,0x06,0xe2,0xc7,0x3d,0x9c,
-0xe3,0x08,0xb0,0xf2,0x00,0x25,0x00,0x05,0x0f,0x57,0x19,0x10,0x70,0xa3,0x38,0x61,
-0x09,0x20,0x03,0xdd,0xdf,0x10,0x4b,0x4a,0x00,0xdd,0x35,0xf0,0x04,0xf4,0x00,0xef,
-0xf3,0x01,0xdc,0xd0,0x0e,0x51,0x01,0xd8,0x0b,0xa0,0xe4,0x00,0x67,0x00,0x06,0x0d,
-0x3b,0x12,0x53,0x22,0x40,0x00,0x02,0xff,0x69,0x22,0x02,0x11,0x4a,0x15,0x30,0x4d,
-0x00,0x15,0x02,0xcd,0x04,0x70,0x11,0x00,0xd2,0x00,0x3f,0xff,0xf0,0x1a,0x42,0x10,
-0x8c,0x16,0x10,0x20,0x1f,0x40,0x53,0x33,0xe0,0xf8,0x00,0xef,0xf2,0x08,0xe4,0xf4,
-0x0e,0x40,0x06,0xe2,0x05,0xc0,0xe3,0x73,0x12,0x11,0x0e,0x4e,0x32,0x19,0x91,0x5c,
-0x4a,0x12,0xef,0x92,0x14,0x00,0x71,0x03,0xa0,0xbc,0xcc,0x10,0xe3,0x00,0x04,0x49,
-0xe0,0x0e,0x30,0xa9,0x34,0xf0,0x02,0xe4,0x10,0x00,0xaf,0x20,0x0e,0xff,0x30,0x9e,
-0xac,0x00,0xe3,0x00,0x7e,0x30,0xab,0x0f,0x03,0x36,0x21,0x30,0x50,0x32,0x00,0x01,
-0xbd,0x2c,0x13,0xe4,0x0b,0x00,0x02,0x93,0x00,0x05,0x3b,0x25,0x00,0xdd,0x00,0x20,
-0x0a,0x00,0xdd,0x00,0xa0,0xf2,0x00,0x00,0x09,0xb0,0x0f,0x20,0x00,0x03,0xf4,0xe6,
-0x4a,0xe1,0xeb,0xd1,0x0f,0x20,0x03,0xe6,0x0a,0xb0,0xf2,0x00,0x43,0x00,0x05,0x0f,
-0x7b,0x0e,0x01,0x90,0x31,0x11,0x9d,0xb6,0x1a,0x10,0xf3,0xff,0x13,0x0a,0x7b,0x0e,
-0x03,0x67,0x30,0xf1,0x1a,0x20,0xa1,0xc2,0x1d,0xde,0xb0,0xf2,0xe3,0x00,0x0b,0x80,
-0xf1,0xe3,0x00,0x1f,0x30,0xf1,0xe3,0x00,0x7e,0x00,0xfa,0xf3,0x00,0xef,0x30,0xf7,
-0xf3,0x06,0xd9,0x90,0xf1,0xe3,0x1e,0x41,0xf1,0xf1,0xe3,0x58,0x00,0x64,0x73,0x20,
-0x06,0x05,0x00,0xf0,0x01,0x60,0x92,0x00,0x11,0x00,0x61,0x81,0x3f,0xff,0xd0,0xf3,
-0xe4,0x00,0x0b,0x80,0xe4,0x1f,0x47,0xf2,0x02,0xef,0xf4,0x01,0xee,0x80,0xe4,0xd4,
-0x0c,0xa2,0xe4,0xe4,0xe4,0x5a,0x00,0x35,0xc3,0xe3,0xc3,0x29,0x12,0x4f,0xf7,0x0b,
-0x1a,0x02,0x05,0x00,0xf6,0x1a,0x00,0x20,0x04,0x45,0x50,0x02,0xb3,0xbb,0xbf,0x30,
-0x3d,0x00,0x01,0xf0,0x03,0xd0,0x00,0x7b,0x00,0x3d,0x00,0x0e,0x73,0xcd,0xe0,0x06,
-0xfc,0x03,0x6e,0x01,0xe5,0xe4,0x03,0xe0,0xb9,0x06,0xd0,0x3e,0x1a,0x00,0x09,0x03,
-0x1d,0x10,0xd0,0x10,0x08,0xf5,0x19,0x01,0x23,0x30,0x02,0x90,0xbd,0xdf,0x40,0x4e,
-0x00,0x03,0xe0,0x14,0xe0,0x00,0xd8,0x6f,0xfe,0x00,0x9c,0xf2,0x03,0xe0,0x8d,0x17,
-0xd0,0x3e,0x1b,0x10,0x06,0x13,0xe0,0x00,0x11,0x22,0x23,0x00,0x6e,0xee,0xef,0xb8,
-0x18,0x16,0xc0,0xb8,0x18,0xf2,0x13,0x11,0x10,0x02,0xc0,0x0c,0xfe,0xf8,0x03,0xf0,
-0x00,0x02,0xf3,0x02,0xf0,0x00,0x0a,0xb0,0x78,0xf0,0x00,0x4f,0xe2,0x8a,0xf0,0x02,
-0xe5,0xbb,0x03,0xf0,0x1e,0x70,0x0d,0x53,0xe0,0xbb,0x49,0x10,0x3b,0x0c,0x13,0x01,
-0xbb,0x16,0x20,0x5e,0x11,0x58,0x09,0x02,0xee,0x0d,0xf2,0x12,0x01,0x03,0xbb,0xcc,
-0x20,0xd4,0x14,0x49,0xf2,0x0e,0x40,0x00,0xdb,0x03,0xe4,0x00,0x7f,0x65,0xdf,0x40,
-0x4f,0xae,0x20,0xd4,0x4f,0x50,0x8e,0x0d,0x43,0x30,0x00,0x20,0x50,0xb1,0x01,0x50,
-0x11,0x00,0xe4,0x00,0xcf,0x22,0x13,0x00,0xea,0x36,0x13,0xcf,0xea,0x1e,0x00,0x93,
-0x02,0xf0,0x17,0x14,0xdd,0xed,0x00,0xe4,0x00,0x09,0x80,0x1e,0x40,0x03,0xf2,0xdf,
-0xf4,0x01,0xec,0xb0,0x0e,0x41,0xd8,0x0c,0x80,0xe4,0x77,0x00,0x16,0x0e,0x30,0x02,
-0x33,0x33,0x50,0x00,0xdd,0xcc,0xcf,0x30,0x0d,0x95,0x4b,0x30,0xd6,0x00,0x0f,0xfa,
-0x49,0xf0,0x13,0xe2,0x02,0x23,0x30,0x0a,0x34,0xdd,0xef,0x30,0xd5,0x00,0x0a,0xc0,
-0x3d,0x50,0x05,0xf4,0x5d,0xf5,0x04,0xfc,0xd1,0x0d,0x55,0xf5,0x0a,0xc0,0xd5,0x53,
-0x00,0x05,0x08,0x20,0x09,0x6f,0x02,0x41,0xe5,0x11,0x1e,0x30,0x64,0x40,0x51,0xe3,
-0x00,0x0e,0x20,0x0d,0xb3,0x24,0x01,0xc2,0x48,0x40,0x30,0x02,0x91,0xdd,0x27,0x01,
-0xf1,0x1d,0x02,0xe0,0x04,0xe0,0x00,0xc9,0x3f,0xfe,0x00,0x8e,0xf3,0x04,0xe0,0x6e,
-0x27,0xe1,0x4e,0x1d,0x20,0x06,0x24,0xe0,0x00,0x02,0x43,0x28,0x00,0x0a,0xeb,0xce,
-0x40,0x05,0xf1,0x00,0x7d,0x00,0x5f,0x10,0x08,0xc0,0x00,0x9f,0xef,0xd3,0x9d,0x1a,
-0x80,0x03,0x34,0x10,0xa1,0xc2,0x2d,0xdf,0x80,0xf9,0x32,0xf1,0x10,0x50,0xf3,0xf3,
-0x00,0x2f,0x10,0xf3,0xf3,0x00,0x9c,0x8e,0xf3,0xf3,0x01,0xff,0x11,0xe3,0xe3,0x08,
-0xbb,0x70,0xe3,0xe3,0x2f,0x23,0xe0,0xe3,0xe3,0x76,0x00,0x82,0x65,0x22,0x06,0x97,
-0x22,0x90,0x50,0xa2,0x03,0x44,0x20,0xa1,0xc2,0x2c,0xce,0x66,0x4a,0xf0,0x08,0x0e,
-0x71,0xe4,0xe3,0x00,0x7e,0x6e,0xf4,0xe3,0x03,0xfe,0x60,0xe4,0xe3,0x1e,0x63,0xe3,
-0xe4,0xe3,0x57,0x00,0x33,0xb2,0x5f,0x18,0x24,0x50,0x91,0x5f,0x18,0xf0,0x01,0xf4,
-0x00,0x00,0x0a,0xd1,0x5f,0x70,0x00,0x7a,0x10,0x02,0xc2,0x04,0x45,0x50,0x03,0x10,
-0x02,0xf1,0x10,0x4d,0x00,0x01,0xf1,0x58,0xd0,0x00,0x7b,0x1a,0xcd,0x00,0x0e,0x70,
-0x03,0xd0,0x06,0xfc,0x05,0x8e,0x00,0xe6,0xe6,0xab,0xd0,0xaa,0x07,0xc0,0x3d,0x1c,
-0x00,0x0b,0x07,0x02,0x05,0xb6,0x44,0x12,0x28,0xc9,0x02,0x11,0xcf,0x83,0x0c,0x23,
-0x07,0xf1,0xe8,0x52,0xe1,0x08,0xed,0xb1,0x00,0x03,0xdc,0x20,0x9e,0x30,0x05,0x50,
-0x56,0x03,0x40,0x98,0x16,0x30,0x12,0x22,0xaa,0x7c,0x43,0x00,0xa8,0x3b,0x90,0x1c,
-0xcc,0xcc,0x50,0x00,0x00,0x33,0x4e,0xe2,0xe1,0x01,0xf1,0x04,0xf5,0x00,0x00,0x04,
-0xce,0x67,0xfa,0x10,0x00,0x75,0x09,0x31,0x63,0x00,0x01,0x11,0xd6,0x11,0x10,0xf0,
-0x43,0x00,0x65,0x15,0x01,0x9f,0x32,0x11,0xef,0xae,0x02,0x01,0x46,0x19,0x17,0x02,
-0x67,0x13,0x00,0x94,0x27,0x00,0x14,0x39,0x20,0xbc,0xcd,0x7a,0x00,0xf4,0x01,0x6e,
-0x90,0x00,0x00,0x7e,0xb9,0xe8,0x10,0x07,0x93,0x66,0x29,0x50,0x00,0x00,0xa9,0x44,
-0x22,0x10,0x10,0xac,0x38,0x2e,0x92,0x00,0x17,0x0d,0xf1,0x0c,0xbd,0xdd,0xd9,0x00,
-0x00,0x12,0x3c,0xf4,0x00,0x00,0x03,0xdf,0x70,0x00,0x02,0xae,0x77,0xeb,0x20,0x05,
-0x60,0x77,0x05,0x40,0x01,0x11,0x9a,0xd3,0x18,0x22,0xef,0xfa,0xbb,0x51,0x60,0x5e,
-0xdc,0xf7,0x00,0x00,0xf5,0x39,0x07,0x10,0xe6,0x39,0x07,0x16,0x5e,0x61,0x0b,0x03,
-0x76,0x15,0xf0,0x13,0x96,0x00,0x0d,0xff,0xf7,0x0a,0x70,0x00,0x00,0x3f,0x20,0xa8,
-0x00,0x00,0x1e,0x90,0x0a,0x80,0x00,0x0c,0xce,0x20,0x9b,0x52,0x1d,0x90,0x8d,0x09,
-0xda,0x43,0x60,0xb0,0x61,0x98,0xb2,0x00,0xc6,0x09,0x80,0x02,0x34,0xf5,0x65,0xa8,
-0x00,0x8c,0xcb,0xb9,0x5a,0xcf,0x0c,0x10,0x06,0x07,0x01,0x70,0x34,0x42,0x00,0x00,
-0xbc,0xcc,0xf8,0xe3,0x16,0x10,0xc0,0x36,0x52,0xd0,0x60,0x00,0x00,0x8e,0x75,0xeb,
-0x10,0x07,0x91,0x00,0x07,0x50,0x11,0x61,0x41,0x12,0xaf,0x86,0x3b,0x01,0xd0,0x28,
-0x06,0x05,0x00,0x16,0x88,0x06,0x01,0x10,0x31,0x06,0x01,0x10,0xfa,0xad,0x00,0xc1,
-0xa0,0x00,0x00,0x5c,0xdc,0xe6,0x00,0x07,0xb5,0x00,0x4b,0x60,0x9f,0x00,0x1c,0xbf,
-0xa2,0x0b,0x19,0x17,0xa2,0x0b,0x10,0xbc,0x42,0x15,0x20,0x23,0x4d,0x14,0x02,0x80,
-0xef,0xa1,0x00,0x05,0xec,0x42,0x9f,0x60,0x6b,0x38,0x20,0x20,0x9e,0x1b,0x09,0x00,
-0xb2,0x01,0xa5,0x20,0x00,0x05,0xdd,0x70,0x00,0x00,0x9d,0x66,0xcc,0x81,0x4a,0x09,
-0x5f,0x17,0x02,0x41,0x00,0xf2,0x03,0x4c,0xf4,0x00,0x00,0x04,0xdf,0x90,0x00,0x03,
-0xce,0x74,0xcd,0x40,0x04,0x50,0x00,0x03,0x40,0x4f,0x18,0x01,0xa7,0x47,0x04,0x0d,
-0x24,0x1f,0x40,0x0d,0x24,0x02,0x30,0xde,0xef,0xfa,0x44,0x09,0xc1,0xd2,0x00,0x00,
-0x3a,0xff,0xb3,0x00,0x07,0xd7,0x11,0x7c,0x50,0x8a,0x2a,0x0e,0x3e,0x09,0x0f,0xf2,
-0x09,0x04,0x0f,0xc3,0x00,0x05,0x0f,0x02,0x09,0x17,0xa0,0x10,0x03,0x91,0xff,0xef,
-0x30,0x5d,0x00,0x02,0xf1,0xba,0x16,0x00,0x82,0x17,0xf4,0x05,0x70,0x05,0xd0,0x05,
-0xfb,0x00,0x4c,0x00,0xd7,0xf3,0x04,0xc0,0x9b,0x07,0xc0,0x4c,0x2d,0x10,0x0a,0x24,
-0xc7,0x04,0x01,0xd0,0x04,0x14,0x4b,0x0b,0x06,0xf0,0x0e,0x08,0x25,0xdd,0xef,0x00,
-0xd5,0x00,0x09,0xb0,0x0d,0x50,0x03,0xf2,0x00,0xd5,0x01,0xef,0x40,0x0d,0x51,0xc9,
-0x6e,0x20,0xd5,0xb9,0x00,0x79,0x0c,0x51,0x7e,0x05,0x13,0x01,0xe6,0x40,0x14,0xe4,
-0xf4,0x00,0x10,0xe3,0x8e,0x06,0x00,0x6b,0x29,0x91,0x0c,0x25,0xcc,0xdf,0x00,0xe4,
-0x00,0x0a,0x90,0xd1,0x09,0xf0,0x03,0xe4,0x00,0xdf,0x20,0x0e,0x30,0xbb,0x9c,0x00,
-0xe3,0xab,0x00,0xc7,0x0e,0x33,0x00,0x00,0x10,0x7d,0x2a,0x41,0x0b,0x10,0x0d,0x50,
-0xbc,0x0e,0x10,0x12,0xe9,0x3d,0x10,0xe5,0xc6,0x04,0xf2,0x0b,0x15,0xdd,0xef,0x10,
-0xe4,0x00,0x09,0xc0,0x0e,0x40,0x03,0xf3,0x00,0xe4,0x02,0xef,0x70,0x0e,0x42,0xd8,
-0x3f,0x40,0xe4,0xb7,0x00,0x49,0xc6,0x04,0x00,0x91,0x25,0x00,0xe9,0x3d,0x71,0xe3,
-0x00,0xe4,0x00,0x0e,0x30,0x0c,0xc6,0x04,0x33,0x20,0x08,0x24,0xa7,0x00,0xf5,0x04,
-0x0c,0x50,0x04,0xf3,0x00,0xc5,0x02,0xee,0xa0,0x0c,0x53,0xe7,0x1d,0x70,0xd5,0x75,
-0x00,0x16,0x09,0xc6,0x04,0x11,0x20,0xfc,0x15,0x09,0xc6,0x04,0xf2,0x25,0x00,0x11,
-0x01,0x00,0x92,0x00,0x07,0xff,0xbf,0xd0,0xd4,0x00,0x00,0x2f,0x06,0xb0,0xd5,0x00,
-0x00,0x5d,0x0a,0x90,0xd5,0x00,0x00,0x9a,0x0d,0x60,0xd7,0x30,0x00,0xdd,0x1f,0x90,
-0xde,0xc2,0x02,0xed,0x8d,0xe0,0xd5,0x00,0x09,0x87,0xf5,0xc5,0xd5,0x00,0x0e,0x11,
-0xd0,0x5a,0x3b,0x39,0x17,0xc5,0x06,0x00,0x18,0xb4,0xf3,0x06,0xf6,0x21,0x15,0x44,
-0x50,0x93,0xb3,0x4c,0xea,0xf4,0xd4,0xd4,0x05,0xc0,0xe1,0xd4,0xc4,0x07,0x91,0xf0,
-0xd4,0xc4,0x0a,0x94,0xe0,0xdd,0xf4,0x0e,0xd8,0xf2,0xd7,0xd4,0x2d,0xdd,0xd7,0xd4,
-0xc4,0x97,0x8e,0x4c,0xc4,0xc4,0xa1,0x27,0x08,0xc4,0xc4,0x00,0x00,0x00,0x05,0x00,
-0xf2,0x16,0x41,0x72,0x01,0x00,0x10,0x15,0x37,0x4f,0xf9,0xfb,0x4c,0x6b,0x03,0xe0,
-0xa9,0x4d,0x7b,0x07,0xc0,0xe7,0x4f,0xfb,0x0b,0xf6,0xfc,0x4d,0x6b,0x2d,0x9f,0x7d,
-0x8d,0x6b,0x45,0x1b,0x03,0x7c,0x6b,0x9e,0x17,0x13,0x4f,0x14,0x49,0x15,0xa8,0x05,
-0x00,0x11,0xa7,0xce,0x00,0x40,0x09,0xff,0x7e,0xfe,0x5a,0x52,0xf1,0x0c,0xc8,0x00,
+0x4d,0x07,0xff,0xf0,0x00,0x11,0x00,0x03,0xe0,0xc8,0x03,0x60,0x60,0x00,0xa9,0x11,
+0x11,0x10,0xe0,0x04,0xf0,0x16,0xe1,0x02,0xbd,0xc4,0x08,0x60,0xb9,0x16,0xe0,0xa9,
+0x0b,0x92,0x6e,0x0a,0x90,0x2b,0xdc,0x40,0xa9,0x47,0x77,0x8a,0x9a,0x95,0x9b,0xe7,
+0x63,0xb9,0x00,0x4d,0x0a,0xff,0x90,0x00,0x20,0x00,0x53,0x2e,0x02,0xb0,0x40,0x05,
+0x77,0x78,0xe5,0x00,0xca,0x66,0x66,0x10,0x0b,0x6c,0x02,0x05,0x01,0x00,0xf0,0x09,
+0x01,0x89,0x30,0xa2,0xc3,0x0d,0x96,0xf1,0xd4,0xd4,0x2f,0x00,0xc4,0xd4,0xd4,0x1f,
+0x00,0xd4,0xd4,0xd4,0x0b,0xcb,0xd0,0xd4,0x95,0x04,0xf0,0x50,0xd4,0xd4,0x59,0x9a,
+0xba,0xd4,0xd4,0x36,0xbb,0x41,0xd4,0xd4,0x00,0x89,0x6a,0xf4,0xd4,0x00,0x89,0x25,
+0xe4,0xd4,0x00,0x89,0x00,0xd4,0xd4,0x00,0x22,0x00,0x41,0x72,0x00,0x7c,0xb2,0x01,
+0xa0,0x6d,0x38,0xc0,0x3e,0x0b,0x70,0x1f,0x03,0xe0,0xb7,0x01,0xf0,0x3e,0x07,0xc3,
+0x8b,0x02,0xe0,0x08,0xca,0x10,0x2f,0x00,0x00,0x13,0x42,0xf3,0xff,0xfe,0xca,0x3f,
+0x00,0x0f,0x30,0x02,0xf0,0x00,0xf2,0x00,0x2f,0x00,0x0f,0x20,0x03,0xe0,0x00,0x70,
+0x00,0x1b,0x00,0x03,0x77,0x20,0x00,0x00,0x7e,0x89,0xf4,0xe3,0x02,0x40,0x7c,0x00,
+0x00,0xf4,0xd9,0x01,0x30,0x9c,0x45,0xd7,0x6d,0x02,0x11,0x60,0x93,0x00,0x10,0x10,
+0xde,0x02,0x11,0xf7,0xe8,0x02,0x07,0x05,0x00,0x36,0x4b,0x00,0xd2,0xb7,0x00,0x05,
+0x2d,0x02,0x13,0x7d,0x2d,0x02,0x72,0x7f,0xdd,0xf6,0x00,0x00,0x01,0x33,0xe4,0x04,
+0x5f,0xe8,0x00,0x0f,0x20,0xf3,0x2d,0x02,0x0d,0x01,0xfc,0x02,0x30,0x4d,0xee,0xc2,
+0x15,0x03,0x10,0x9b,0xba,0x03,0xa6,0x3f,0x00,0x01,0xf1,0x00,0x4d,0x00,0x00,0xac,
+0x55,0x8c,0x00,0x70,0x00,0x00,0x12,0x22,0x22,0x22,0x21,0xb0,0x04,0x1f,0xea,0xe1,
+0x02,0x06,0x66,0x12,0x11,0x11,0x11,0x10,0xaf,0x92,0x03,0x20,0xb2,0x00,0xdc,0x02,
+0x00,0x05,0x00,0x13,0xf4,0xe1,0x02,0x19,0x50,0xb4,0x00,0x10,0x7e,0xb4,0x00,0x51,
+0x6f,0x00,0x00,0x6e,0xee,0xe1,0x02,0x11,0x01,0x3c,0x00,0x12,0xfb,0x58,0x07,0x04,
+0xb4,0x00,0x1e,0x40,0xe1,0x02,0x0f,0xec,0x03,0x04,0xf7,0x02,0x18,0xbb,0x70,0x00,
+0x13,0x34,0x44,0x44,0x42,0x9d,0xcc,0xcc,0xcc,0xc8,0x00,0x01,0x11,0xe1,0x02,0x1e,
+0x40,0xe1,0x02,0x14,0x9d,0xe1,0x02,0x04,0x1d,0x03,0xa2,0x8c,0xcc,0xcc,0xcc,0xc7,
+0x24,0x44,0x44,0x44,0x42,0x56,0x06,0x0f,0x28,0x04,0x06,0xf2,0x1b,0x01,0x00,0x01,
+0x90,0x1c,0xef,0x60,0x3e,0x09,0xa0,0x3f,0x03,0xe0,0xb5,0x00,0xf1,0x3e,0x0a,0x80,
+0x3f,0x03,0xe0,0x2e,0xce,0x60,0x3e,0x00,0x02,0x10,0x03,0xe0,0x00,0x00,0x01,0x3e,
+0x3c,0xdd,0xdf,0xe6,0xe0,0x33,0x32,0x8e,0x07,0x00,0x40,0x07,0x14,0x07,0xaf,0x01,
+0xf0,0x16,0x4c,0x03,0xcd,0x70,0x05,0xd0,0xe7,0x3e,0x50,0x4d,0x4d,0x00,0x8a,0x04,
+0xd6,0xc0,0x06,0xb0,0x4d,0x5c,0x00,0x7b,0x04,0xc2,0xf1,0x0b,0x70,0x4c,0x0a,0xdb,
+0xd1,0x04,0xc0,0x04,0x51,0x00,0x4c,0xe6,0x07,0x50,0xc0,0x00,0x00,0x00,0x5c,0x0a,
+0x01,0x02,0x69,0x06,0xf4,0x19,0x29,0xb7,0x00,0x2e,0x0d,0x94,0xd6,0x03,0xf2,0xf0,
+0x07,0xb0,0x3f,0x3e,0x00,0x6b,0x03,0xf1,0xf3,0x0a,0x80,0x3f,0x06,0xfe,0xd1,0x03,
+0xe0,0x00,0x10,0x00,0x2d,0x00,0x01,0x22,0x22,0x10,0x06,0xee,0xee,0xee,0x31,0x08,
+0x14,0x4e,0x7a,0x00,0xf2,0x11,0x02,0x00,0x23,0x00,0x02,0xc0,0x9e,0xdb,0x00,0x3e,
+0x1f,0x10,0xf2,0x03,0xe3,0xe0,0x0c,0x50,0x3e,0x3f,0x00,0xd4,0x03,0xe0,0xe7,0x6f,
+0x10,0x3e,0x03,0xcc,0x40,0x03,0x2d,0x00,0x61,0x67,0x00,0x02,0x80,0x08,0x90,0x46,
+0x07,0x30,0x01,0x00,0x07,0x46,0x07,0xf2,0x09,0x8a,0x50,0x02,0xb0,0xda,0x6e,0x50,
+0x3f,0x3f,0x00,0x7b,0x03,0xf3,0xf0,0x06,0xb0,0x3f,0x0e,0x84,0xc7,0x03,0xe0,0x3b,
+0xd9,0x8b,0x08,0xf0,0x05,0x30,0x04,0xef,0xff,0xfd,0x00,0x01,0x11,0x14,0xe0,0x07,
+0xff,0xff,0xfd,0x00,0x9a,0x00,0x01,0x00,0x08,0x09,0x00,0x01,0xb8,0x02,0xf0,0x05,
+0x8a,0x60,0x02,0xb0,0xda,0x7f,0x70,0x3e,0x3f,0x00,0xac,0x03,0xe3,0xf0,0x09,0xd0,
+0x3e,0x0e,0x84,0xe9,0x3b,0x00,0x12,0x10,0x3b,0x00,0xf6,0x07,0x3f,0xff,0x3e,0xfc,
+0x00,0x11,0xe3,0x04,0xf0,0x2f,0xff,0x20,0x3e,0x04,0xe0,0x00,0x03,0xe0,0x2f,0xff,
+0xa0,0x2d,0xd2,0x02,0xf1,0x0a,0x29,0xa3,0x00,0x3c,0x0d,0x97,0xf1,0x04,0xe2,0xf0,
+0x0d,0x40,0x4e,0x3f,0x00,0xc5,0x03,0xe1,0xf2,0x0e,0x20,0x3e,0x08,0xff,0x90,0xeb,
+0x00,0xf2,0x04,0x2b,0x00,0x14,0x44,0x44,0x30,0x09,0xec,0xcb,0xde,0x00,0x98,0x00,
+0x04,0xe0,0x09,0x80,0x00,0x5e,0xe1,0x08,0xf1,0x09,0x79,0x40,0x02,0xc0,0xdb,0x6e,
+0x40,0x3e,0x2f,0x00,0x7a,0x03,0xe3,0xf0,0x06,0xb0,0x3e,0x0f,0x51,0xb8,0x03,0xe0,
+0x4d,0xfb,0x76,0x00,0x82,0x01,0x80,0x05,0x90,0x00,0x1a,0x00,0x7c,0xb1,0x00,0x74,
+0xfe,0x00,0x7b,0x00,0x03,0xe0,0x06,0x01,0x04,0xf1,0x0d,0x01,0x89,0x20,0x0b,0x40,
+0x0d,0xa8,0xe0,0x0d,0x50,0x3f,0x00,0xd4,0x0d,0x50,0x4e,0x00,0xc5,0x0d,0x50,0x1f,
+0x43,0xf2,0x0d,0x50,0x06,0xee,0x70,0xdd,0x05,0xf2,0x0c,0x07,0x20,0x00,0x0a,0x20,
+0x85,0x00,0x00,0x0f,0x20,0xd6,0x00,0x00,0x5f,0xa2,0xfe,0x10,0x01,0xe6,0xce,0x8a,
+0xb0,0x07,0x80,0x3c,0x00,0x91,0x41,0x00,0xf1,0x20,0x11,0x20,0x0a,0x00,0x03,0xff,
+0xff,0x10,0xf1,0x00,0x00,0x05,0xd0,0x0f,0x20,0x00,0x00,0xb7,0x00,0xf2,0x00,0x00,
+0x3f,0x30,0x0f,0xee,0x30,0x0c,0xea,0x00,0xf3,0x10,0x06,0xe2,0xf3,0x0f,0x20,0x02,
+0xe3,0x08,0xb0,0xf2,0x00,0x25,0x00,0x05,0x0f,0xc9,0x09,0x10,0xf2,0x05,0x00,0x02,
+0x0b,0x00,0xf5,0x24,0x70,0x00,0x02,0x23,0x20,0x09,0x20,0x03,0xdd,0xdf,0x10,0xe4,
+0x00,0x00,0x08,0xb0,0x0e,0x40,0x00,0x03,0xf4,0x00,0xef,0xf3,0x01,0xdc,0xd0,0x0e,
+0x51,0x01,0xd8,0x0b,0xa0,0xe4,0x00,0x67,0x00,0x06,0x0d,0x30,0x00,0x01,0x11,0x22,
+0x40,0x00,0x02,0xff,0xee,0xef,0x20,0x5b,0x03,0x25,0x0f,0x30,0x4d,0x00,0x15,0x02,
+0xcd,0x04,0x90,0x11,0x00,0xd2,0x00,0x3f,0xff,0xf0,0x0f,0x40,0xa7,0x05,0xf0,0x0e,
+0xf4,0x00,0x00,0x1f,0x40,0x0e,0x40,0x00,0x0b,0xf8,0x00,0xef,0xf2,0x08,0xe4,0xf4,
+0x0e,0x40,0x06,0xe2,0x05,0xc0,0xe3,0x00,0x21,0x00,0x00,0x0e,0x30,0x82,0x00,0x14,
+0x91,0x4b,0x00,0x80,0x41,0x11,0x10,0x00,0x00,0xef,0xff,0xff,0xfe,0x07,0x00,0x71,
+0x03,0xf1,0x16,0xbc,0xcc,0x10,0xe3,0x00,0x04,0x49,0xe0,0x0e,0x30,0x00,0x00,0xe7,
+0x00,0xe4,0x10,0x00,0xaf,0x20,0x0e,0xff,0x30,0x9e,0xac,0x00,0xe3,0x00,0x7e,0x30,
+0xab,0x0f,0x30,0x01,0x00,0x00,0x30,0x50,0x32,0x00,0x10,0x20,0x70,0x03,0x13,0xe4,
+0x0b,0x00,0x02,0x93,0x00,0x14,0xef,0x4b,0x09,0x00,0xdd,0x00,0x20,0x0a,0x00,0xdd,
+0x00,0x70,0xf2,0x00,0x00,0x09,0xb0,0x0f,0x20,0xdd,0x00,0xf0,0x0d,0xff,0xf2,0x02,
+0xeb,0xd1,0x0f,0x20,0x03,0xe6,0x0a,0xb0,0xf2,0x00,0x43,0x00,0x05,0x0f,0x10,0x00,
+0x00,0x7b,0xb8,0x20,0x00,0x00,0x9c,0x43,0x9d,0x80,0x07,0x00,0x92,0x00,0x98,0xc8,
+0x00,0x5f,0x10,0x00,0x03,0xdf,0xed,0x50,0xf0,0x04,0xf0,0x1e,0x02,0x34,0x20,0xa1,
+0xc2,0x1d,0xde,0xb0,0xf2,0xe3,0x00,0x0b,0x80,0xf1,0xe3,0x00,0x1f,0x30,0xf1,0xe3,
+0x00,0x7e,0x00,0xfa,0xf3,0x00,0xef,0x30,0xf7,0xf3,0x06,0xd9,0x90,0xf1,0xe3,0x1e,
+0x41,0xf1,0xf1,0xe3,0x58,0x00,0x64,0xf2,0xe3,0x1a,0x01,0x05,0x05,0x00,0xf0,0x16,
+0x60,0x92,0x00,0x11,0x00,0x61,0x81,0x3f,0xff,0xd0,0xf3,0xe4,0x00,0x0b,0x80,0xe4,
+0xe4,0x00,0x4f,0x10,0xef,0xf4,0x01,0xee,0x80,0xe4,0xd4,0x0c,0xa2,0xe4,0xe4,0xe4,
+0x5a,0x00,0x35,0xc3,0xe3,0xcc,0x09,0x32,0x40,0x00,0x4f,0xf7,0x0b,0x1a,0x02,0x05,
+0x00,0xf4,0x1b,0x00,0x20,0x04,0x45,0x50,0x02,0xb3,0xbb,0xbf,0x30,0x3d,0x00,0x01,
+0xf0,0x03,0xd0,0x00,0x7b,0x00,0x3d,0x00,0x0e,0x73,0xcd,0xe0,0x06,0xfc,0x03,0x6e,
+0x01,0xe5,0xe4,0x03,0xe0,0xb9,0x06,0xd0,0x3e,0x1a,0x00,0x09,0x03,0xb3,0x0b,0x20,
+0x03,0xd0,0x10,0x08,0xf1,0x1b,0x01,0x23,0x30,0x02,0x90,0xbd,0xdf,0x40,0x4e,0x00,
+0x03,0xe0,0x14,0xe0,0x00,0xd8,0x6f,0xfe,0x00,0x9c,0xf2,0x03,0xe0,0x8d,0x17,0xd0,
+0x3e,0x1b,0x10,0x06,0x13,0xe0,0x00,0x11,0x22,0x23,0x00,0x6e,0xee,0xef,0xc0,0x00,
+0xdd,0x07,0x24,0x00,0x05,0xfc,0x03,0xf1,0x17,0x00,0x10,0x00,0x11,0x10,0x02,0xc0,
+0x0c,0xfe,0xf8,0x03,0xf0,0x00,0x02,0xf3,0x02,0xf0,0x00,0x0a,0xb0,0x78,0xf0,0x00,
+0x4f,0xe2,0x8a,0xf0,0x02,0xe5,0xbb,0x03,0xf0,0x1e,0x70,0x0d,0x53,0xe0,0x03,0xe9,
+0x03,0x41,0x3b,0x00,0x02,0xa0,0xf5,0x03,0x50,0x00,0x5e,0x11,0x11,0x10,0xae,0x0c,
+0x10,0xd0,0xc4,0x01,0xf2,0x11,0x03,0xbb,0xcc,0x20,0xd4,0x14,0x49,0xf2,0x0e,0x40,
+0x00,0xdb,0x03,0xe4,0x00,0x7f,0x65,0xdf,0x40,0x4f,0xae,0x20,0xd4,0x4f,0x50,0x8e,
+0x0d,0x43,0x30,0x00,0x20,0x50,0xb1,0x01,0x30,0x11,0x00,0xe4,0xfa,0x0a,0x50,0x20,
+0x0e,0x50,0x01,0x10,0x09,0x00,0x13,0x80,0xb6,0x01,0xf0,0x45,0x09,0x14,0xdd,0xed,
+0x00,0xe4,0x00,0x09,0x80,0x1e,0x40,0x03,0xf2,0xdf,0xf4,0x01,0xec,0xb0,0x0e,0x41,
+0xd8,0x0c,0x80,0xe4,0x77,0x00,0x16,0x0e,0x30,0x02,0x33,0x33,0x50,0x00,0xdd,0xcc,
+0xcf,0x30,0x0d,0x60,0x00,0xf3,0x00,0xd6,0x00,0x0f,0x30,0x0a,0xff,0xff,0xe2,0x02,
+0x23,0x30,0x0a,0x34,0xdd,0xef,0x30,0xd5,0x00,0x0a,0xc0,0x3d,0x50,0x05,0xf4,0x5d,
+0xf5,0x04,0xfc,0xd1,0x0d,0x55,0xf5,0x0a,0xc0,0xd5,0x53,0x00,0x05,0x08,0x20,0x09,
+0x6f,0x02,0x50,0xe5,0x11,0x1e,0x30,0x0e,0x2e,0x0b,0x81,0xe3,0x00,0x0e,0x20,0x0d,
+0xff,0xff,0xf1,0xb6,0x02,0x00,0x27,0x01,0x20,0x91,0xdd,0x27,0x01,0xf0,0x1d,0x02,
+0xe0,0x04,0xe0,0x00,0xc9,0x3f,0xfe,0x00,0x8e,0xf3,0x04,0xe0,0x6e,0x27,0xe1,0x4e,
+0x1d,0x20,0x06,0x24,0xe0,0x00,0x02,0x43,0x28,0x00,0x0a,0xeb,0xce,0x40,0x05,0xf1,
+0x00,0x7d,0x00,0x5f,0x10,0x08,0xc0,0x00,0x9f,0xef,0xd3,0x28,0x07,0xf0,0x1e,0x00,
+0x03,0x34,0x10,0xa1,0xc2,0x2d,0xdf,0x80,0xe3,0xe3,0x00,0x0d,0x50,0xf3,0xf3,0x00,
+0x2f,0x10,0xf3,0xf3,0x00,0x9c,0x8e,0xf3,0xf3,0x01,0xff,0x11,0xe3,0xe3,0x08,0xbb,
+0x70,0xe3,0xe3,0x2f,0x23,0xe0,0xe3,0xe3,0x76,0x00,0x82,0xe3,0x0b,0x02,0x15,0xe2,
+0x05,0x00,0xf0,0x1e,0x50,0xa2,0x03,0x44,0x20,0xa1,0xc2,0x2c,0xce,0xd0,0xe3,0xe3,
+0x00,0x0e,0x71,0xe4,0xe3,0x00,0x7e,0x6e,0xf4,0xe3,0x03,0xfe,0x60,0xe4,0xe3,0x1e,
+0x63,0xe3,0xe4,0xe3,0x57,0x00,0x33,0xb2,0xe3,0x00,0x00,0x06,0x50,0x91,0x00,0x00,
+0x0e,0x7e,0x06,0xf0,0x02,0x9e,0xf4,0x00,0x00,0x0a,0xd1,0x5f,0x70,0x00,0x7a,0x10,
+0x02,0xc2,0x04,0x45,0x50,0x03,0x10,0x02,0xf1,0x10,0x4d,0x00,0x01,0xf1,0x58,0xd0,
+0x00,0x7b,0x1a,0xcd,0x00,0x0e,0x70,0x03,0xd0,0x06,0xfc,0x05,0x8e,0x00,0xe6,0xe6,
+0xab,0xd0,0xaa,0x07,0xc0,0x3d,0x1c,0x00,0x0b,0x07,0x02,0x14,0x3d,0x10,0x02,0x12,
+0x28,0xc9,0x02,0x11,0xcf,0x83,0x0c,0x10,0x07,0xfc,0x00,0xf0,0x06,0x5f,0x40,0x00,
+0x00,0x08,0xed,0xb1,0x00,0x03,0xdc,0x20,0x9e,0x30,0x05,0x50,0x56,0x03,0x40,0x00,
+0x00,0x9a,0x73,0x07,0xf0,0x03,0xaa,0x22,0x21,0xbe,0xee,0xee,0xff,0xfb,0x00,0x1c,
+0xcc,0xcc,0x50,0x00,0x00,0x33,0x4e,0xe2,0xe1,0x01,0xf0,0x0c,0xf5,0x00,0x00,0x04,
+0xce,0x67,0xfa,0x10,0x00,0x75,0x09,0x31,0x63,0x00,0x01,0x11,0xd6,0x11,0x10,0x0d,
+0xee,0xee,0xee,0xff,0x60,0x00,0x11,0x68,0x07,0x41,0x6f,0xff,0xef,0xf0,0x9b,0x0c,
+0x10,0x10,0xc6,0x01,0x01,0x5c,0x01,0x14,0x1f,0x3e,0x03,0x70,0x23,0x33,0x32,0x00,
+0x00,0xbc,0xcd,0x7a,0x00,0xf3,0x01,0x6e,0x90,0x00,0x00,0x7e,0xb9,0xe8,0x10,0x07,
+0x93,0x66,0x29,0x50,0x00,0x00,0xa9,0x17,0x0d,0x8e,0x01,0x10,0x01,0x11,0x10,0x00,
+0x92,0x00,0x17,0x0d,0xf0,0x16,0xbd,0xdd,0xd9,0x00,0x00,0x12,0x3c,0xf4,0x00,0x00,
+0x03,0xdf,0x70,0x00,0x02,0xae,0x77,0xeb,0x20,0x05,0x60,0x77,0x05,0x40,0x01,0x11,
+0x9a,0x11,0x10,0xae,0xee,0xee,0xef,0xfa,0x00,0x00,0x33,0xa0,0x00,0x50,0xdc,0xf7,
+0x00,0x00,0xf5,0x39,0x07,0x10,0xe6,0x39,0x07,0x16,0x5e,0x61,0x0b,0x12,0x00,0xd4,
+0x02,0xf0,0x13,0x96,0x00,0x0d,0xff,0xf7,0x0a,0x70,0x00,0x00,0x3f,0x20,0xa8,0x00,
+0x00,0x1e,0x90,0x0a,0x80,0x00,0x0c,0xce,0x20,0x9b,0x52,0x1d,0x90,0x8d,0x09,0xda,
+0x43,0x60,0xb0,0x61,0x98,0xb2,0x00,0xc6,0x09,0x80,0x02,0x34,0xf5,0x65,0xa8,0x00,
+0x8c,0xcb,0xb9,0x5a,0xcf,0x0c,0x10,0x06,0x07,0x01,0xf1,0x17,0x34,0x42,0x00,0x00,
+0xbc,0xcc,0xf8,0x00,0x00,0x00,0x1c,0xc0,0x00,0x00,0x02,0xdf,0x60,0x00,0x00,0x8e,
+0x75,0xeb,0x10,0x07,0x91,0x00,0x07,0x50,0x11,0x11,0x11,0x12,0x21,0xaf,0xff,0xff,
+0xee,0xe9,0x13,0x0e,0x08,0x05,0x00,0x80,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0xf3,0x6e,0x00,0x23,0x33,0x31,0x00,0x00,0xbc,0xcd,0xfa,0x00,0x00,0x00,0x5e,0xa0,
+0x00,0x00,0x5c,0xdc,0xe6,0x00,0x07,0xb5,0x00,0x4b,0x60,0x00,0x00,0x00,0x00,0x10,
+0xbf,0xff,0xff,0xff,0xfa,0x00,0x00,0x3f,0x00,0x00,0x00,0xe1,0x3e,0x00,0x00,0x00,
+0xf2,0x17,0x00,0x00,0x00,0xf3,0x11,0x11,0x00,0x00,0xdf,0xff,0xff,0x70,0x00,0xbc,
+0xcc,0xc8,0x00,0x00,0x23,0x4d,0xe3,0x00,0x00,0x06,0xef,0xa1,0x00,0x05,0xec,0x42,
+0x9f,0x60,0x02,0x20,0x00,0x01,0x20,0x9e,0xee,0xee,0xee,0xea,0x12,0x22,0xaa,0x22,
+0x20,0x00,0x05,0xdd,0x70,0x00,0x00,0x9d,0x66,0xcc,0x00,0x00,0xf4,0x00,0x1f,0x20,
+0x00,0xd8,0x00,0x5f,0x10,0x00,0x3d,0xee,0xe5,0x00,0x00,0x00,0x11,0x00,0x00,0x41,
+0x00,0xf6,0x1b,0x4c,0xf4,0x00,0x00,0x04,0xdf,0x90,0x00,0x03,0xce,0x74,0xcd,0x40,
+0x04,0x50,0x00,0x03,0x40,0x13,0x33,0x33,0x33,0x31,0x9d,0xdd,0xdd,0xdd,0xd8,0x00,
+0x11,0x11,0x11,0x00,0x02,0xff,0xff,0xef,0x40,0x00,0x00,0x00,0x0e,0x05,0x00,0x21,
+0x30,0x00,0x01,0x00,0x20,0xde,0xef,0xb9,0x00,0xf0,0x08,0x3c,0xd2,0x00,0x00,0x3a,
+0xff,0xb3,0x00,0x07,0xd7,0x11,0x7c,0x50,0x01,0x00,0x00,0x01,0x10,0xaf,0xff,0xff,
+0xff,0xfb,0x22,0x00,0x00,0x3c,0x00,0x71,0xff,0x30,0x00,0x11,0x11,0x0e,0x30,0x0a,
+0x00,0x41,0x03,0xf1,0x00,0x01,0x14,0x00,0x12,0x70,0x41,0x00,0x0f,0xc3,0x00,0x05,
+0xf3,0x13,0x8c,0xcc,0xcc,0xcc,0xc7,0x24,0x44,0x44,0x44,0x42,0x00,0x00,0x22,0x00,
+0x00,0x00,0x4e,0xdd,0xf7,0x00,0x00,0xe6,0x00,0x3f,0x10,0x00,0xe7,0x00,0x4f,0x10,
+0x00,0x4e,0xee,0xe6,0xc3,0x00,0xf0,0x21,0x01,0x10,0x03,0x91,0xff,0xef,0x30,0x5d,
+0x00,0x02,0xf1,0x05,0xd0,0x00,0x6c,0x00,0x5d,0x00,0x0d,0x70,0x05,0xd0,0x05,0xfb,
+0x00,0x4c,0x00,0xd7,0xf3,0x04,0xc0,0x9b,0x07,0xc0,0x4c,0x2d,0x10,0x0a,0x24,0xc0,
+0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x05,0x09,0x00,0x12,0x4b,0x9a,0x00,0xf0,0x18,
+0x23,0x20,0x08,0x25,0xdd,0xef,0x00,0xd5,0x00,0x09,0xb0,0x0d,0x50,0x03,0xf2,0x00,
+0xd5,0x01,0xef,0x40,0x0d,0x51,0xc9,0x6e,0x20,0xd5,0xb9,0x00,0x79,0x0c,0x51,0x00,
+0x11,0x11,0x40,0x01,0xef,0xff,0xff,0xeb,0x00,0x14,0xe4,0xf4,0x00,0x10,0xe3,0x73,
+0x00,0xf0,0x5e,0x00,0x03,0x44,0x30,0x0c,0x25,0xcc,0xdf,0x00,0xe4,0x00,0x0a,0x90,
+0x0e,0x40,0x03,0xf1,0x00,0xe4,0x00,0xdf,0x20,0x0e,0x30,0xbb,0x9c,0x00,0xe3,0xab,
+0x00,0xc7,0x0e,0x33,0x00,0x00,0x10,0xe3,0x00,0xb3,0x00,0x0b,0x10,0x0d,0x50,0x00,
+0x00,0x00,0xe5,0x11,0x12,0x00,0x0b,0xff,0xff,0xe5,0x02,0x23,0x20,0x09,0x15,0xdd,
+0xef,0x10,0xe4,0x00,0x09,0xc0,0x0e,0x40,0x03,0xf3,0x00,0xe4,0x02,0xef,0x70,0x0e,
+0x42,0xd8,0x3f,0x40,0xe4,0xb7,0x00,0x49,0x0e,0x30,0x02,0x33,0x33,0x50,0x00,0xed,
+0xcc,0xcf,0x30,0x0e,0x40,0x00,0xe3,0x00,0xe4,0x00,0x0e,0x30,0x0c,0xff,0xff,0xe2,
+0xa7,0x00,0x13,0x24,0xa7,0x00,0xf2,0x1b,0x0c,0x50,0x04,0xf3,0x00,0xc5,0x02,0xee,
+0xa0,0x0c,0x53,0xe7,0x1d,0x70,0xd5,0x75,0x00,0x16,0x09,0x20,0x09,0x20,0x00,0x91,
+0x00,0xe5,0x11,0x1e,0x20,0x0e,0xff,0xff,0xf2,0x00,0xe3,0x00,0x0e,0x20,0x0d,0xff,
+0xff,0xf1,0x5e,0x01,0xf1,0x25,0x11,0x01,0x00,0x92,0x00,0x07,0xff,0xbf,0xd0,0xd4,
+0x00,0x00,0x2f,0x06,0xb0,0xd5,0x00,0x00,0x5d,0x0a,0x90,0xd5,0x00,0x00,0x9a,0x0d,
+0x60,0xd7,0x30,0x00,0xdd,0x1f,0x90,0xde,0xc2,0x02,0xed,0x8d,0xe0,0xd5,0x00,0x09,
+0x87,0xf5,0xc5,0xd5,0x00,0x0e,0x11,0xd0,0x5a,0xd5,0x39,0x00,0x17,0xc5,0x06,0x00,
+0x27,0xb4,0x00,0x01,0x00,0xf6,0x21,0x15,0x44,0x50,0x93,0xb3,0x4c,0xea,0xf4,0xd4,
+0xd4,0x05,0xc0,0xe1,0xd4,0xc4,0x07,0x91,0xf0,0xd4,0xc4,0x0a,0x94,0xe0,0xdd,0xf4,
+0x0e,0xd8,0xf2,0xd7,0xd4,0x2d,0xdd,0xd7,0xd4,0xc4,0x97,0x8e,0x4c,0xc4,0xc4,0xa1,
+0x27,0x08,0xc4,0xc4,0x00,0x00,0x00,0x05,0x00,0xf0,0x20,0x41,0x72,0x01,0x00,0x10,
+0x15,0x37,0x4f,0xf9,0xfb,0x4c,0x6b,0x03,0xe0,0xa9,0x4d,0x7b,0x07,0xc0,0xe7,0x4f,
+0xfb,0x0b,0xf6,0xfc,0x4d,0x6b,0x2d,0x9f,0x7d,0x8d,0x6b,0x45,0x1b,0x03,0x7c,0x6b,
+0x00,0x00,0x11,0x12,0x22,0x00,0x4f,0xff,0xff,0xf8,0x6d,0x00,0x15,0xa8,0x05,0x00,
+0x11,0xa7,0xce,0x00,0xf1,0x14,0x09,0xff,0x7e,0xfe,0x00,0x00,0x2f,0x20,0xc8,0x00,
 0x00,0xbf,0x27,0xf5,0x00,0x07,0xd8,0xee,0x7e,0x30,0x08,0x10,0xd7,0x03,0x30,0x01,
-0x11,0xc7,0x11,0x10,0xbe,0xee,0xee,0xef,0xf8,0xb0,0x02,0x54,0x04,0xff,0xfe,0xef,
-0x20,0x90,0x08,0x24,0x0f,0x30,0xdc,0x08,0x00,0x40,0x1d,0xf4,0x1c,0x22,0x01,0xa0,
-0x4d,0xf8,0xdf,0x12,0xf0,0x01,0xf1,0x3e,0x02,0xf0,0x05,0xf1,0x8c,0x02,0xf0,0x0c,
-0xf7,0xef,0x12,0xf0,0x3e,0x4f,0xba,0x82,0xf0,0x64,0x09,0x22,0x61,0xf0,0x00,0x01,
-0x12,0x22,0x40,0x00,0x5e,0xee,0xef,0xe0,0xbf,0x0a,0x24,0x04,0xe0,0xc0,0x0a,0x13,
-0x00,0x07,0x11,0x30,0x9f,0xe5,0x00,0x87,0x4e,0x73,0x10,0x0f,0x10,0x05,0xff,0xff,
-0x20,0x30,0x53,0x00,0x24,0x08,0xfc,0x07,0xf3,0x10,0x00,0x5f,0x40,0x0f,0xff,0x30,
-0x1e,0xbc,0x00,0xf2,0x00,0x0c,0x80,0xd6,0x0f,0x20,0x07,0xa0,0x03,0xb0,0xfc,0x47,
-0x23,0x0c,0x10,0xc5,0x20,0xd0,0x7f,0xf6,0x00,0xe1,0x00,0x16,0x66,0x60,0x0f,0x20,
-0x02,0x99,0xbf,0x48,0x00,0xf1,0x06,0x0c,0x80,0x0f,0xfe,0x10,0x0a,0xfa,0x00,0xf3,
-0x10,0x0b,0xc2,0xd8,0x0f,0x20,0x06,0x90,0x01,0x70,0xf1,0x00,0x1c,0x46,0x50,0x00,
-0x0f,0xed,0xdd,0xf2,0xaf,0x47,0x00,0x92,0x17,0x15,0x20,0x92,0x17,0x0f,0x48,0x00,
-0x07,0x81,0xff,0x10,0x0b,0xfa,0x00,0xf2,0x00,0x1b,0x48,0x00,0x40,0x80,0x01,0x60,
-0xa0,0xa2,0x29,0x10,0x63,0x3f,0x14,0x00,0x94,0x02,0xf3,0x00,0x8f,0x43,0xf9,0x00,
-0x00,0x2f,0x8e,0xd9,0xe7,0x00,0x0a,0x60,0x7b,0x02,0xb0,0xcf,0x08,0x11,0x21,0xfd,
-0x1c,0xf0,0x08,0xd5,0x00,0xd2,0x00,0x17,0x78,0x80,0x0f,0x30,0x02,0x88,0xbf,0x20,
-0xe5,0x10,0x00,0x1d,0x90,0x0e,0xff,0x30,0x1d,0xfa,0x5f,0x1d,0xf0,0x05,0x81,0xca,
-0x0e,0x30,0x05,0x30,0x00,0x30,0x81,0x00,0x00,0x8b,0xbb,0xba,0x10,0x00,0x03,0x44,
-0x5f,0xc0,0x9d,0x03,0x00,0xfa,0x04,0x86,0xaf,0xbf,0x80,0x00,0x01,0xd8,0x10,0x3b,
-0x94,0x15,0x00,0x31,0x1d,0xfa,0x1b,0x30,0x91,0xc2,0x02,0x23,0x10,0xf2,0xe3,0x0d,
-0xde,0xd0,0xf2,0xe3,0x00,0x09,0x90,0xf2,0xe3,0x00,0x0e,0x30,0xfa,0xf3,0x00,0x7f,
-0x30,0xf8,0xf3,0x02,0xfb,0xa0,0xf2,0xe3,0x0c,0x81,0xf2,0xe2,0xe3,0x4b,0x00,0x66,
-0xe2,0x0c,0x07,0x21,0x70,0x92,0x63,0x14,0xf0,0x19,0x02,0xef,0xb0,0x04,0xc0,0x05,
-0x66,0x72,0x04,0xd0,0x08,0x88,0xf7,0x04,0xd0,0x00,0x08,0xd1,0xde,0xd0,0x00,0x6f,
-0xe2,0x26,0xd0,0x08,0xe2,0x8d,0x14,0xd0,0x1a,0x10,0x05,0x15,0xd0,0x00,0x00,0x0a,
-0x44,0xb0,0x57,0x0a,0x00,0x6f,0x58,0xc6,0xe2,0x00,0x00,0x1b,0xd1,0x9e,0x40,0x00,
-0xaa,0x00,0x05,0xe1,0x76,0x46,0x40,0x3e,0xfa,0x00,0x3c,0x45,0x00,0xf1,0x1c,0xf0,
-0x88,0x9f,0x60,0x3f,0x00,0x09,0xc1,0xde,0xf0,0x07,0xfe,0x12,0x6f,0x09,0xe2,0xac,
-0x03,0xe2,0xa1,0x00,0x61,0x3e,0x00,0x00,0x24,0x31,0x80,0x00,0xae,0xbc,0xe4,0x00,
-0x6e,0x00,0x06,0xd0,0x05,0xe1,0x00,0x8c,0x00,0x09,0x81,0x34,0x13,0x11,0x95,0x55,
-0x30,0xff,0x10,0xa1,0xc6,0x00,0x10,0xe3,0xc6,0x00,0xf0,0x11,0xf3,0xf3,0x00,0x0b,
-0x90,0xe3,0xf2,0x00,0x1f,0x58,0xf3,0xe2,0x00,0x9f,0x47,0xf3,0xe2,0x03,0xfc,0x90,
-0xe3,0xe2,0x0d,0x62,0xf1,0xd3,0xe2,0x59,0x00,0x84,0xd3,0xe3,0x34,0x14,0x05,0x2e,
-0x48,0x23,0x71,0xa2,0x9a,0x13,0x01,0xee,0x13,0x11,0x23,0x12,0x43,0x10,0xf5,0x0b,
-0x15,0xf2,0x01,0xc0,0x00,0x00,0x01,0xbf,0x20,0x00,0x00,0x5e,0xab,0xe5,0x00,0x0b,
-0xb4,0x22,0x5d,0xf5,0x06,0x24,0x00,0x00,0x50,0x3e,0x02,0x90,0x01,0xf5,0x1c,0xdb,
-0x90,0x03,0x90,0x04,0x64,0x00,0x5d,0x0d,0xfe,0xf7,0x05,0xd0,0x00,0x4f,0x20,0x4d,
-0x00,0x3f,0xd0,0x04,0xd0,0x3e,0x7b,0xa0,0x4d,0x2e,0x64,0x1c,0x44,0xd0,0x10,0xe3,
-0x00,0x4d,0x00,0x0e,0x42,0x34,0xd3,0xff,0xfe,0xc9,0x9a,0x22,0xa0,0x3b,0x00,0x09,
-0x87,0x30,0x00,0x00,0x04,0x77,0x30,0x69,0x30,0x70,0xd7,0x00,0x00,0x22,0x2a,0xf3,
-0x00,0x77,0x56,0xa1,0x00,0x02,0x9f,0x98,0xf8,0x10,0x09,0x72,0x00,0x18,0xa3,0x05,
-0x13,0x11,0x5c,0x06,0x0b,0x98,0x06,0x10,0x87,0xa7,0x13,0x10,0x87,0x05,0x58,0x20,
-0x78,0x30,0x66,0x06,0x10,0xf9,0xdf,0x05,0xc0,0xd1,0x00,0x00,0x19,0xff,0xb1,0x00,
-0x07,0xea,0x21,0x9f,0x40,0x06,0x1e,0x22,0x20,0x9f,0xa7,0x27,0x4d,0x9b,0x21,0x00,
-0x02,0x35,0x20,0x04,0x3c,0x55,0xf2,0x0d,0x07,0x76,0x20,0x00,0x00,0x04,0x89,0x30,
-0x00,0x00,0xde,0xee,0xe8,0x00,0x00,0x11,0x3d,0xd2,0x00,0x00,0x29,0xff,0xb2,0x00,
-0x08,0xe9,0x21,0x9e,0x46,0x0b,0x12,0xbf,0x35,0x20,0x70,0x5e,0x11,0x10,0x01,0xc0,
-0x4e,0x00,0xc1,0x05,0x12,0x00,0x25,0x2e,0x02,0x88,0x1e,0x20,0x06,0x87,0xf5,0x18,
-0x70,0x78,0x40,0x00,0x00,0xdf,0xee,0xfd,0xb6,0x05,0xd1,0xd2,0x00,0x03,0x9e,0xc9,
-0xea,0x30,0x05,0x62,0x00,0x05,0x50,0x9e,0x3c,0x1f,0xd3,0x22,0x6e,0x22,0x10,0x02,
-0xde,0xef,0xee,0x20,0x00,0x23,0x22,0x2e,0x9f,0x0f,0x38,0xf2,0x11,0x22,0x61,0x06,
-0x1c,0x07,0xcd,0x00,0x10,0xd2,0xcd,0x00,0x51,0xa1,0x00,0x07,0xea,0x22,0xcd,0x00,
-0x13,0x02,0xcd,0x00,0x20,0x00,0x8a,0x7b,0x10,0x30,0xff,0xe5,0x00,0x61,0x06,0x03,
-0x6b,0x06,0x09,0x2f,0x08,0xf0,0x18,0x10,0x0d,0xed,0x10,0x3e,0x01,0x35,0x52,0x03,
-0xe0,0x7c,0xbf,0xc0,0x3e,0x00,0x09,0xf3,0x03,0xe0,0x3d,0xa9,0xd2,0x2f,0x0a,0x50,
-0x05,0x42,0xf2,0xbb,0xbc,0xde,0x4f,0x04,0x4f,0x62,0x02,0xf0,0x00,0xe3,0xe7,0x4f,
-0x00,0x14,0x30,0x30,0xe2,0x00,0x2e,0x05,0x0d,0x1d,0x60,0x4e,0x01,0x50,0x3d,0xc1,
-0x00,0x00,0x2a,0x08,0x01,0x45,0xe8,0x11,0x8e,0x40,0x2d,0x07,0x03,0x95,0x1f,0x0d,
-0x6b,0x3b,0x03,0x69,0x07,0xf5,0x1d,0x07,0xdc,0x60,0x03,0xb0,0x02,0x31,0x00,0x4d,
-0x4e,0xef,0xf2,0x04,0xd0,0x11,0x5f,0x00,0x4d,0x00,0x0b,0x90,0x04,0xd0,0x03,0xf5,
-0x00,0x4d,0x00,0xdd,0xc0,0x04,0xe0,0x9c,0x0e,0x50,0x4e,0x5d,0x10,0x4d,0x04,0xe1,
-0x10,0x00,0x10,0xa9,0x17,0xf2,0x28,0x17,0x04,0xec,0x80,0x03,0x80,0x24,0x65,0x00,
-0x6d,0x1c,0xdc,0xf6,0x06,0xd0,0x00,0x6e,0x00,0x5d,0x00,0x4f,0xc0,0x05,0xd0,0x5f,
-0x5b,0xb0,0x5c,0x3e,0x40,0x09,0x25,0xc0,0x00,0x02,0x43,0x37,0x00,0x0b,0xeb,0xde,
-0x30,0x06,0xe0,0x00,0x8b,0x00,0x5e,0x10,0x0a,0xb0,0x00,0xaf,0xef,0xd2,0x28,0x17,
-0x10,0x01,0x5b,0x58,0x12,0xef,0x95,0x52,0xe0,0xa9,0x0e,0x30,0x00,0x11,0x2e,0x40,
-0xe3,0x00,0x7e,0xff,0xd0,0x0e,0x63,0x0c,0x15,0x40,0xed,0xc3,0x00,0x9b,0x9c,0x00,
-0x73,0x7d,0x10,0x00,0xe3,0x00,0x4d,0x10,0xa7,0x00,0x07,0x79,0x37,0x15,0x82,0x06,
-0x46,0xb0,0xc0,0xe2,0x3f,0xfe,0xf2,0xf0,0xf3,0x00,0x02,0xf1,0xf0,0x41,0x55,0xf7,
-0x11,0xf0,0xe3,0x9f,0xff,0x70,0xfc,0xf3,0x00,0x3f,0x10,0xf4,0xf3,0x00,0xc8,0x00,
-0xf0,0xe3,0x07,0xd0,0x00,0xf0,0xe3,0x3e,0x20,0x00,0xf0,0xe3,0x23,0x00,0x00,0xf0,
-0xe3,0x2a,0x24,0x02,0x87,0x4f,0x00,0x37,0x55,0x10,0xec,0x37,0x55,0xff,0x0b,0x90,
-0x5d,0x03,0x44,0xc5,0x05,0xd0,0xab,0xdf,0x5c,0xdd,0x00,0x0c,0x81,0x47,0xd0,0x06,
-0xe0,0x00,0x4d,0x04,0xf4,0x00,0x04,0xd0,0xe4,0x6b,0x56,0x03,0x00,0x1b,0x08,0xf2,
-0x0d,0xe0,0x0c,0xfe,0xfb,0x03,0xf0,0x01,0x22,0x98,0x02,0xf0,0x0b,0xcd,0xf6,0xbc,
-0xf0,0x00,0x1d,0x80,0x46,0xf0,0x02,0xd9,0x00,0x02,0xf0,0x0e,0x60,0x49,0x0d,0x0b,
-0x6b,0x56,0x03,0x68,0x25,0xf2,0x12,0x02,0x33,0x31,0x09,0x50,0xcd,0xce,0x90,0xb6,
-0x05,0x66,0xe6,0x3c,0x61,0x99,0xec,0x7d,0xf6,0x00,0x9e,0x20,0x0b,0x61,0xcb,0x10,
-0x00,0xb6,0x14,0x01,0x11,0x15,0x10,0x0d,0xc6,0x30,0x30,0x0d,0x50,0x0b,0x3b,0x0c,
-0x18,0xc8,0xc8,0x4f,0xf0,0x0d,0x01,0x22,0x20,0x0c,0x23,0xee,0xdf,0x60,0xe4,0x03,
-0x34,0xf3,0x1e,0x44,0xcc,0xfb,0xbf,0xf4,0x00,0x6e,0x20,0x0d,0x30,0x9e,0x20,0x00,
-0xe3,0x58,0x7a,0x25,0x0f,0xa6,0x56,0x04,0xf0,0x11,0x11,0x21,0x02,0x80,0x0b,0xee,
-0xed,0x04,0xd0,0x02,0x33,0x9a,0x04,0xd0,0x09,0xac,0xf7,0xef,0xd0,0x00,0x1d,0x80,
-0x16,0xd0,0x03,0xe8,0x00,0x04,0xd0,0x0c,0x40,0x02,0xde,0x00,0x60,0x0f,0x23,0xa0,
-0x00,0x00,0x6f,0xcd,0x27,0xa2,0xed,0xd2,0x00,0x00,0x2d,0x90,0x9e,0x30,0x00,0xc7,
-0xd2,0x08,0x06,0x01,0x00,0xf0,0x09,0xa1,0xd2,0x3f,0xff,0xf0,0xe2,0xe3,0x00,0x07,
-0xe0,0xe2,0xe3,0x01,0x1b,0xa0,0xe3,0xe3,0x9e,0xff,0xac,0xf2,0xe3,0x00,0x7d,0xe7,
-0x56,0x19,0xe4,0xe7,0x56,0x13,0x21,0xa5,0x04,0x13,0xe2,0xd8,0x4c,0xf8,0x1a,0x01,
-0x10,0x01,0xc0,0xef,0xff,0xb0,0x3f,0x00,0x00,0x7a,0x25,0xf0,0x11,0x2c,0x6c,0xef,
-0x0d,0xef,0xe0,0x03,0xf0,0x00,0xc8,0x01,0x4f,0x00,0x6d,0x0a,0xff,0xf0,0x4f,0x30,
-0x00,0x2f,0x1e,0x30,0x00,0x02,0xe0,0x10,0x3f,0x1c,0xf0,0x10,0x04,0x55,0x50,0x0b,
-0x24,0xbb,0xbf,0x41,0xe3,0x12,0x34,0xf7,0xff,0x35,0xaa,0xf8,0x00,0xe3,0x00,0xac,
-0x0e,0xff,0x32,0xcb,0x00,0x01,0xe3,0x55,0x00,0x00,0x08,0xee,0x00,0x10,0xd1,0xee,
-0x00,0x36,0x30,0x0d,0x50,0x9a,0x0d,0x03,0x9b,0x05,0x11,0x0e,0xa8,0x08,0x01,0x81,
-0x3e,0x40,0x1b,0xbb,0xbc,0xf2,0x7b,0x1e,0x23,0x5f,0x10,0xe1,0x0e,0x33,0x03,0xd0,
-0x2d,0x3a,0x12,0xf1,0x07,0x02,0x26,0xe2,0x22,0x21,0x08,0xfe,0xee,0xee,0xee,0xd0,
-0x00,0xbb,0xbb,0xbb,0x00,0x00,0x45,0x55,0x5f,0x10,0x01,0x32,0x2c,0x30,0x12,0x71,
-0x3f,0xc1,0x01,0x12,0x05,0x7f,0x24,0x11,0x12,0xad,0x3e,0x0b,0x31,0x2d,0x08,0x36,
-0x2e,0x10,0x00,0x18,0x11,0x13,0xfd,0x5d,0x56,0x35,0x11,0x11,0x5e,0xbf,0x54,0x01,
-0xfc,0x01,0x01,0xdb,0x1c,0x12,0x35,0xf6,0x45,0x02,0x9d,0x20,0x31,0xde,0xee,0xed,
-0xf9,0x3d,0x02,0x6e,0x00,0x00,0x93,0x52,0x00,0x5a,0x10,0x20,0x14,0x10,0x00,0x55,
-0x19,0xf9,0xdd,0x0a,0x0e,0x6e,0x00,0x00,0xf6,0x45,0x00,0x1a,0x53,0x50,0x10,0x01,
-0xcc,0xcc,0xdf,0x3a,0x39,0x12,0x5f,0xee,0x1d,0x03,0x29,0x25,0x00,0x18,0x0f,0x90,
-0x34,0x44,0x44,0x00,0x03,0xfd,0xdd,0xdf,0x30,0x0c,0x26,0x02,0x05,0x00,0x00,0x8b,
-0x23,0x0a,0x84,0x52,0xf7,0x13,0x2e,0x0d,0xee,0xec,0x03,0xf0,0x00,0x05,0xa0,0x3f,
-0x03,0x44,0xb6,0x03,0xf0,0xab,0xcf,0x10,0x3f,0x00,0x0b,0x90,0x03,0xf0,0x05,0xe1,
-0x00,0x2f,0x03,0xf4,0x00,0x02,0xf0,0xe5,0x8e,0x01,0x13,0x2e,0x88,0x38,0x30,0x31,
-0x07,0x30,0xbc,0x02,0xf0,0x0b,0x03,0x44,0xd5,0x0b,0x61,0xbc,0xfd,0x00,0xb6,0x00,
-0x6f,0x30,0x0b,0x60,0x9e,0x30,0x00,0xb6,0x27,0x00,0x00,0x05,0x20,0x0c,0xee,0xee,
-0xf9,0x57,0x1e,0x1d,0xbc,0x02,0x02,0x7a,0x5b,0x00,0x59,0x4c,0x02,0xc4,0x4b,0x00,
-0x70,0x2e,0x00,0xf5,0x48,0xc0,0xee,0xe5,0x0e,0xee,0x43,0xf2,0x21,0x00,0xe5,0x20,
-0x3f,0x00,0xa2,0x17,0x01,0x43,0x44,0x4c,0x1e,0xff,0xec,0x2e,0xdc,0x2b,0x12,0xb2,
-0xfb,0x11,0xe0,0x01,0xcc,0xcc,0x50,0xe4,0x00,0x3f,0x44,0x40,0x0e,0x40,0x03,0xf2,
-0x22,0xb4,0x43,0x90,0xed,0xd4,0x0e,0xff,0x33,0xe0,0x00,0x20,0xe4,0x94,0x66,0x02,
-0x43,0x44,0x13,0x50,0x43,0x4c,0x27,0x01,0x21,0xad,0x11,0x19,0x11,0xd5,0x50,0x90,
-0x03,0x44,0x41,0x0d,0x20,0x02,0xfd,0xdc,0x40,0xd9,0x33,0x00,0x3a,0x15,0x60,0xff,
-0xff,0x50,0xef,0xf4,0x3e,0x4e,0x44,0x4a,0x02,0xfd,0xde,0xf1,0x4e,0x44,0x11,0xef,
-0x4e,0x44,0x10,0x30,0x85,0x04,0x18,0xf4,0x4e,0x44,0x01,0xb5,0x3b,0x70,0xb1,0xd2,
-0x0f,0xdd,0xb1,0xf2,0xf3,0xa1,0x2b,0x12,0xe3,0x05,0x00,0x83,0xdd,0xd0,0xfb,0xf3,
-0x0f,0x42,0x10,0xf6,0x14,0x00,0x7a,0x65,0x83,0xf2,0xe3,0x09,0xba,0x82,0xa7,0x11,
-0x00,0x74,0x4b,0xb0,0x22,0x10,0x80,0x91,0x0f,0xee,0xc0,0xf1,0xe3,0x0f,0x21,0x28,
-0x00,0x30,0xff,0xc0,0xff,0x32,0x00,0xa4,0xf1,0xe3,0x0f,0xdd,0xf3,0xf2,0xe3,0x02,
-0x32,0x00,0xce,0x33,0x0f,0x01,0x44,0x05,0xf0,0x05,0x04,0x55,0x50,0xb0,0xb3,0x0f,
-0xba,0x80,0xf1,0xc5,0x0f,0x31,0x10,0xf2,0xc5,0x0f,0xff,0xc0,0xfe,0xf5,0x73,0x00,
-0xb0,0xc5,0x0f,0xaa,0xb3,0xf1,0xc5,0x05,0x65,0x40,0x90,0x82,0xfb,0x5b,0x10,0x50,
-0x48,0x2c,0x10,0xe3,0x8a,0x30,0x10,0xf3,0x1f,0x20,0x13,0xe2,0x1d,0x03,0x01,0x21,
-0x0e,0x91,0x10,0x2d,0xee,0xdd,0x80,0x3e,0xf3,0x00,0x00,0x04,0x00,0x61,0xfd,0xdc,
-0x3f,0xfe,0xf6,0x32,0x0c,0x00,0x93,0x2e,0xf7,0x45,0x72,0x2f,0x8b,0xba,0x82,0x2f,
-0x01,0x34,0x11,0x2e,0xd1,0x1f,0x03,0x06,0x14,0x50,0x03,0xd0,0x0f,0xff,0xe7,0x3d,
-0x47,0xa0,0x00,0x26,0xe0,0x1f,0xff,0xf3,0xbd,0xe0,0x1f,0x21,0xa3,0x58,0x83,0x10,
-0x23,0x03,0xe0,0x0e,0xff,0xec,0x14,0xda,0x0a,0x31,0x3c,0x00,0x02,0x0f,0x61,0x02,
-0xac,0x11,0x00,0x0a,0x34,0xf0,0x09,0xd0,0x03,0x44,0x41,0x01,0x90,0x0f,0xdd,0xc6,
-0x03,0xf0,0x1f,0x21,0x10,0x47,0xf0,0x1f,0xff,0xe3,0x9b,0xf0,0x1f,0x00,0x01,0xad,
-0x37,0x30,0xfd,0x13,0xe0,0x51,0x09,0x15,0x30,0x8b,0x42,0x01,0x9f,0x1d,0x1b,0xc0,
-0x8b,0x42,0x00,0x41,0x00,0xf0,0x00,0xb0,0xfd,0xdc,0x60,0x2f,0x1f,0x21,0x10,0x46,
-0xf1,0xff,0xfe,0x4a,0xbf,0x1f,0xd5,0x03,0x7f,0xfd,0xce,0xe1,0x2f,0x01,0x21,0x00,
-0x76,0x44,0x05,0x03,0x3d,0x3c,0x00,0xc8,0x3a,0x30,0xdd,0x90,0xe3,0xa6,0x01,0x22,
-0xe3,0xf3,0x05,0x00,0x72,0xee,0x7d,0xf3,0xe3,0x0f,0x31,0x03,0x14,0x00,0x96,0xe3,
-0x0f,0x65,0x71,0xe3,0xe3,0x09,0xba,0x81,0x94,0x51,0x02,0xcf,0x33,0x00,0xab,0x01,
-0xa0,0x70,0x91,0x0f,0xee,0xa0,0xf2,0xe3,0x0f,0x31,0x01,0xab,0x01,0x23,0xae,0xf2,
-0x32,0x00,0x30,0xdd,0xf3,0xe3,0xab,0x01,0x15,0xb1,0xab,0x01,0x0e,0x3b,0x44,0x08,
-0x8e,0x59,0x90,0xe3,0xb1,0x0f,0xff,0xb0,0xe3,0xf2,0x0f,0x10,0x31,0x44,0x51,0xff,
-0x8f,0xf3,0xf2,0x0f,0x3b,0x44,0x74,0x43,0x41,0xe3,0xf2,0x0c,0xdc,0xa2,0x3b,0x44,
-0x43,0x3b,0x00,0x91,0xd1,0x3a,0x01,0x05,0xa1,0x5c,0x02,0xfe,0x00,0x60,0x30,0xc1,
-0xd1,0x0f,0xcb,0x80,0x87,0x00,0x73,0x04,0xf2,0xe3,0x0f,0xfe,0x8b,0xf3,0x87,0x00,
-0xb1,0xbb,0xd3,0xe3,0xe3,0x03,0x43,0x10,0x60,0x60,0x00,0x3e,0x10,0x37,0x32,0x22,
-0x23,0xf1,0xd8,0x29,0x64,0x3f,0x10,0x11,0x10,0x00,0x1f,0xcb,0x1f,0x03,0x73,0x02,
-0x06,0xc8,0x00,0x1c,0x9e,0xc8,0x00,0x10,0xd2,0x8d,0x04,0x11,0x00,0x56,0x37,0x00,
-0x7f,0x27,0x03,0x05,0x00,0x10,0x0d,0x94,0x01,0x12,0x11,0x77,0x4d,0x13,0xfd,0x2b,
-0x14,0x00,0x57,0x16,0x31,0x02,0xf2,0x21,0xdf,0x42,0x10,0x44,0xdf,0x42,0x2c,0xbb,
-0x20,0x06,0x44,0x01,0xe5,0x31,0x30,0xf4,0x22,0x21,0x9c,0x23,0x10,0xfc,0x3d,0x50,
-0x05,0xca,0x52,0x2c,0x8b,0x00,0xca,0x43,0x01,0xc2,0x11,0x10,0x02,0xca,0x43,0x02,
-0xe6,0x04,0x1b,0xde,0x3c,0x00,0x24,0x00,0x00,0x47,0x54,0x00,0x89,0x43,0xb0,0xfe,
-0xff,0xee,0xfa,0x02,0x22,0x33,0x22,0x10,0x00,0x4d,0x5f,0x37,0x01,0x5a,0x4a,0x0b,
-0x72,0x4d,0x30,0xac,0xcc,0xc9,0xc1,0x33,0x10,0x42,0x2e,0x1e,0x10,0x31,0x12,0x32,
-0x10,0xd8,0x24,0x0d,0x13,0x01,0xe3,0x3a,0x0f,0x5c,0x43,0x0b,0x0f,0xeb,0x00,0x11,
-0x0a,0xa3,0x42,0x01,0xaf,0x00,0x1a,0xf5,0xaf,0x00,0x05,0x69,0x00,0x07,0xff,0x55,
-0x01,0x77,0x16,0x31,0x11,0x11,0x1d,0x04,0x2b,0x08,0xd4,0x0a,0x00,0xb9,0x02,0x07,
-0x41,0x00,0x24,0xf4,0x11,0xf0,0x00,0x00,0x88,0x0d,0x07,0x0d,0x4c,0x17,0x70,0x04,
-0x2b,0x04,0xe4,0x42,0x30,0xab,0xbb,0xb9,0x74,0x35,0x13,0x53,0x3c,0x00,0x30,0xf6,
-0x33,0x34,0xff,0x00,0xd4,0xcb,0x10,0x68,0x77,0x77,0x78,0x85,0x35,0x55,0x55,0x54,
-0x42,0x03,0x4e,0x06,0x03,0x6f,0x4d,0x01,0x0b,0x0b,0x05,0xca,0x0a,0x93,0x12,0x23,
-0x10,0x2c,0xed,0xdd,0x80,0x3e,0xe3,0x08,0x04,0x80,0xfc,0xbb,0x60,0x3f,0xf7,0x55,
-0x20,0x3f,0x56,0x1e,0x70,0xf5,0x34,0x52,0x3f,0xad,0xdc,0xa4,0x28,0x12,0x04,0x04,
-0x00,0xd0,0x18,0x03,0x44,0x41,0x07,0x40,0xfd,0xdc,0x60,0xb7,0x0f,0x20,0x00,0xa2,
-0x42,0x30,0x70,0xb6,0x0f,0xa2,0x42,0x7f,0xfd,0xde,0xf1,0xb6,0x01,0x32,0x10,0xa2,
-0x42,0x0a,0x03,0x05,0x5e,0xf1,0x1f,0x44,0x30,0xc4,0x00,0x7c,0xcc,0xb9,0x0d,0x50,
-0x00,0x62,0x19,0x00,0xd5,0x00,0x0c,0x54,0xe0,0x0d,0x50,0x00,0xc5,0x4e,0x00,0xde,
-0xd5,0x0c,0x54,0xd0,0x0c,0x73,0x00,0xc5,0x4d,0x00,0xc5,0x00,0x3d,0x98,0xe5,0x1c,
-0x50,0x07,0xba,0xaa,0x92,0x2d,0x10,0x02,0x8b,0x1e,0x11,0xc6,0xed,0x1f,0x13,0x30,
-0x48,0x00,0xf4,0x10,0x66,0x66,0x60,0xe2,0x00,0x5a,0xa9,0x97,0x0f,0x30,0x00,0x76,
-0x0d,0x00,0xf3,0x00,0x09,0x81,0xf0,0x0f,0xff,0x30,0x98,0x2f,0x00,0xf3,0x00,0x7f,
-0xee,0xff,0x2f,0x5d,0x40,0x0f,0x1e,0x52,0x13,0x00,0xe8,0x3e,0xd1,0x5e,0xee,0xd7,
-0xe2,0xe3,0x05,0x43,0x60,0xe2,0xe3,0x09,0x86,0xb0,0x05,0x00,0xfa,0x06,0xec,0xf3,
-0x09,0x86,0xa0,0xe6,0xf3,0x09,0x87,0xa0,0xe2,0xe3,0x3c,0xcb,0xd7,0xe2,0xe3,0x38,
-0x88,0x75,0xe2,0xb9,0x55,0x21,0x50,0x91,0x28,0x2b,0xf0,0x0c,0xcd,0xdd,0xd1,0x6a,
-0x03,0x33,0x42,0x07,0xb0,0x4b,0x0d,0x43,0x9b,0x05,0xc0,0xd5,0xce,0xb0,0x5c,0x0e,
-0x51,0x6b,0x4f,0xff,0xee,0x86,0xa0,0x6c,0x05,0x20,0x00,0x9f,0x4e,0x21,0x30,0x11,
-0x00,0x8a,0xc8,0x19,0x50,0x90,0x0a,0x90,0x01,0x10,0x12,0x00,0x12,0xc0,0x9b,0x04,
-0xf0,0x22,0x33,0x04,0x63,0xdd,0xde,0xc1,0x7b,0x04,0xb0,0xd4,0x18,0xb0,0x5c,0x0d,
-0x5e,0xfb,0x04,0xc0,0xe3,0x07,0xb3,0xef,0xdf,0xe6,0x7b,0x02,0x22,0x21,0x06,0x90,
-0x01,0x33,0x33,0x41,0x00,0x9e,0xcc,0xce,0xa0,0x09,0x90,0x00,0x8a,0x00,0x9a,0x00,
-0x08,0xa0,0x07,0x19,0x6c,0xf0,0x02,0x22,0x20,0x82,0xc2,0x5e,0xee,0xd5,0xc4,0xe3,
-0x05,0x35,0x40,0xc4,0xf3,0x09,0x79,0x80,0x05,0x00,0xf0,0x07,0x9c,0xf4,0xf3,0x09,
-0x79,0x83,0xc4,0xe3,0x09,0x79,0x70,0xb4,0xe3,0x2c,0xbc,0xb5,0xb4,0xe3,0x39,0x99,
-0x84,0xb4,0xa7,0x00,0x06,0x05,0x00,0xf3,0x18,0x40,0xa2,0x02,0x33,0x30,0x52,0x72,
-0x5d,0xdd,0xd4,0xc6,0xc6,0x09,0x67,0x90,0xc6,0xc6,0x09,0x78,0xac,0xf6,0xc6,0x09,
-0x78,0x90,0xb6,0xc6,0x5e,0xee,0xf9,0xb6,0xc6,0x03,0x32,0x20,0x73,0xb4,0x00,0x00,
-0x62,0x17,0x1a,0xf3,0x65,0x5d,0x12,0xe3,0x23,0x18,0xf1,0x10,0x44,0x44,0x05,0x92,
-0xcc,0xcb,0xb2,0x6b,0x01,0x90,0x93,0xff,0xb0,0x3d,0x0d,0x30,0x5b,0x03,0xd0,0xd3,
-0xde,0xb0,0x6e,0x5e,0x86,0x7b,0x1b,0xcb,0xba,0x55,0xb0,0xe6,0x2c,0x64,0x4a,0x00,
-0x04,0x80,0x06,0xc0,0xa0,0x38,0x30,0xff,0xff,0xea,0x36,0x00,0xf0,0x07,0x73,0xcc,
-0xcc,0xb2,0x8b,0x04,0xb0,0xd4,0xef,0xb0,0x5c,0x0d,0x41,0x8b,0x04,0xc0,0xe4,0xce,
-0xb3,0xef,0xdf,0xe8,0xe9,0x00,0xf6,0x07,0x07,0xb0,0x00,0x02,0x42,0x36,0x00,0x1c,
-0xeb,0xdd,0x20,0x07,0xd0,0x00,0xaa,0x00,0x6d,0x00,0x0b,0x90,0x00,0xbf,0xfe,0x5f,
-0x31,0x01,0x00,0x06,0x5a,0x36,0x30,0x2c,0x00,0xe1,0xb1,0x03,0x12,0xf2,0x05,0x00,
-0x97,0x08,0xff,0xee,0xff,0xa0,0x00,0x11,0x22,0x10,0x39,0x4d,0x02,0xda,0x3f,0x11,
-0x5f,0xdf,0x18,0x20,0x27,0x13,0x73,0x66,0x20,0xc0,0x5f,0x33,0x10,0x01,0xd1,0x4e,
-0x20,0x0d,0x50,0x38,0x0e,0x74,0xfe,0xee,0xf9,0x01,0x12,0x21,0x12,0x0e,0x36,0x01,
-0x3f,0x2b,0x01,0xaf,0x2c,0x02,0x33,0x05,0x06,0x0f,0x38,0x0f,0x74,0x00,0x07,0x30,
-0x13,0x11,0x20,0xc2,0x15,0x62,0xf1,0x00,0x12,0x3f,0x23,0xf3,0x90,0x57,0x90,0x05,
-0xcc,0xcc,0xcc,0x50,0x01,0x36,0x33,0x73,0x19,0x19,0x10,0xf1,0x05,0x00,0xa0,0xf2,
-0x00,0x06,0xdf,0xcc,0xfd,0x90,0x01,0x43,0x33,0x96,0x21,0x06,0x1d,0x0f,0x20,0x8a,
-0x00,0x08,0x36,0x05,0xd7,0x23,0x13,0x77,0xe2,0x00,0x11,0x08,0x8e,0x00,0x82,0x4b,
-0x01,0xe0,0x00,0x00,0x5d,0x01,0xf0,0x05,0x00,0x9c,0x09,0xef,0xde,0xfe,0x70,0x01,
-0x22,0x22,0x11,0xf1,0x36,0x11,0x04,0xc3,0x02,0xf3,0x03,0x27,0x11,0x70,0x00,0x00,
-0x3e,0x02,0xf0,0x00,0x06,0xef,0xee,0xff,0x50,0x00,0x21,0x11,0x11,0x0b,0x0a,0x13,
-0x32,0x96,0x37,0x0a,0xc5,0x4f,0x08,0xec,0x36,0x00,0x90,0x01,0xf3,0x16,0x93,0xcc,
-0xcc,0xb1,0x7b,0x02,0x70,0x73,0x07,0xb0,0x5c,0x0c,0x60,0x6b,0x05,0xc0,0xc6,0x06,
-0xb0,0x5c,0x0c,0x50,0x6b,0x04,0xc0,0xc5,0x06,0xb1,0x8e,0x5e,0x93,0x6b,0x3a,0xba,
-0xaa,0x66,0xb0,0xc5,0x0a,0x10,0x06,0x09,0x00,0xf0,0x11,0x25,0x04,0x44,0x44,0x06,
-0x92,0xcc,0xcb,0xa1,0x7b,0x03,0x70,0x92,0x07,0xb0,0x5c,0x0d,0x40,0x7b,0x05,0xc0,
-0xd4,0x07,0xa1,0x8d,0x5e,0x82,0x7a,0x3c,0xcb,0xba,0x67,0xee,0x02,0x80,0x7a,0x00,
-0x69,0x00,0x05,0x70,0x08,0xb0,0xec,0x40,0x03,0xd6,0x41,0x0c,0x24,0x03,0x02,0x36,
-0x00,0x00,0x24,0x03,0x61,0x7b,0x4f,0xff,0xee,0x87,0xa0,0x7f,0x31,0x0f,0x24,0x03,
-0x0b,0x30,0x73,0xdd,0xdd,0x24,0x03,0x12,0xc4,0x75,0x00,0x49,0x04,0xc0,0xd3,0x07,
-0x3b,0x02,0x1f,0x46,0x3b,0x02,0x07,0x00,0x8b,0x2f,0xf5,0x26,0xda,0x00,0xc4,0x00,
-0x00,0x12,0x20,0x0c,0x50,0x0c,0xff,0xff,0xf4,0xc6,0x00,0x00,0x24,0x10,0x0c,0x60,
-0x00,0x5f,0xde,0x10,0xb7,0x10,0x0d,0x50,0xa8,0x0b,0xff,0x50,0xf1,0x06,0xa0,0xb6,
-0x00,0x0f,0x20,0x89,0x0b,0x60,0x00,0xba,0x4e,0x50,0xb6,0x00,0x01,0x9c,0x70,0x0c,
-0x60,0x74,0x04,0x13,0x0a,0x9f,0x1b,0x02,0xe8,0x59,0xf0,0x0f,0x5d,0xe8,0x00,0xe1,
-0x00,0x7a,0x99,0x98,0x0f,0x20,0x03,0x56,0x75,0x40,0xf2,0x00,0x09,0xed,0xb0,0x0f,
-0xa9,0x11,0xf0,0x0e,0x40,0xf9,0x71,0x1f,0x11,0xe3,0x24,0x2a,0x33,0xe9,0x00,0xf2,
-0x44,0x2b,0x02,0x6c,0x3b,0x18,0x11,0x10,0x2c,0x19,0x0f,0x58,0x0d,0xf0,0x04,0x7f,
-0xd7,0x00,0xd1,0x00,0x13,0x56,0x41,0x0f,0x20,0x09,0xcc,0xcc,0xb0,0xf2,0x00,0x04,
-0xcc,0x50,0xf0,0x5b,0x20,0x1f,0x10,0xb9,0x2a,0xf1,0x01,0xd3,0x0f,0x41,0x00,0xe7,
-0x6f,0x10,0xf2,0x00,0x02,0xaa,0x40,0x0f,0x20,0x00,0x08,0xe8,0x29,0x10,0xf4,0xd7,
-0x00,0x23,0x0f,0x51,0x24,0x67,0x12,0x30,0x8d,0x6a,0x20,0x00,0x4b,0x48,0x00,0xf0,
-0x11,0x9b,0xbb,0xba,0x0f,0x20,0x02,0x48,0x84,0x30,0xf2,0x00,0x0d,0xba,0xe0,0x0f,
-0xff,0x22,0xf0,0x0d,0x40,0xf3,0x10,0x0e,0x97,0xe1,0x0f,0x20,0x00,0x16,0x71,0x00,
-0x80,0x01,0x4f,0x91,0xed,0x10,0x00,0x03,0x33,0x33,0xf2,0x00,0x03,0x40,0x02,0x10,
-0x4f,0xe8,0x03,0x16,0x03,0xb4,0x39,0x08,0xe2,0x00,0xf0,0x00,0xaa,0xa9,0x0f,0x20,
-0x01,0x37,0x84,0x20,0xf2,0x00,0x0b,0xba,0xd0,0x0f,0xfe,0x4d,0x00,0xc2,0xf4,0x20,
-0x1f,0x31,0xf3,0x0f,0x20,0x00,0x7f,0xf8,0x00,0xe1,0x1b,0x4c,0x00,0x5b,0x0a,0x0a,
-0x41,0x14,0x01,0xfd,0x0c,0x08,0x48,0x00,0x10,0xa9,0x2a,0x01,0x14,0x57,0x2a,0x01,
-0x10,0xcb,0x2a,0x01,0x43,0xf7,0x50,0x1f,0x10,0x2a,0x01,0x10,0xf1,0xce,0x29,0x11,
-0x05,0x2d,0x37,0x02,0x34,0x4a,0x01,0x19,0x40,0x04,0x38,0x5c,0x0f,0x90,0x00,0x07,
-0x11,0xff,0x90,0x00,0x60,0x10,0x1f,0x21,0xe3,0x0f,0x20,0xa1,0x76,0x10,0xf2,0x90,
-0x00,0x10,0x02,0x67,0x6d,0x50,0xee,0x70,0x00,0x00,0xd7,0x10,0x08,0x98,0x0e,0x60,
-0x02,0xf2,0x00,0x00,0x5e,0xee,0xe8,0xeb,0x36,0xf0,0x23,0x08,0xba,0x40,0xa0,0xd1,
-0x01,0x45,0x20,0xf1,0xe3,0x9f,0xff,0xf9,0xe1,0xe3,0x00,0x45,0x00,0xe1,0xe3,0x09,
-0xdc,0xa0,0xe3,0xe3,0x0f,0x21,0xf1,0xed,0xf3,0x1f,0x00,0xf2,0xe1,0xe3,0x0f,0x21,
-0xf0,0xe1,0xe3,0x08,0xee,0x90,0xe1,0xe3,0x00,0x23,0x00,0xe1,0xe3,0x26,0x19,0x03,
-0xe7,0x66,0x01,0x3c,0x14,0xf1,0x29,0xde,0x70,0x93,0xa3,0x39,0x99,0x95,0xc5,0xb5,
-0x15,0x67,0x53,0xc5,0xb5,0x05,0xed,0xc0,0xcf,0xf5,0x0d,0x40,0xd3,0xc5,0xb5,0x0d,
-0x50,0xe3,0xc5,0xb5,0x05,0xfe,0xb0,0x93,0xb5,0x00,0x01,0x03,0x41,0x51,0x00,0x04,
-0xed,0xcf,0x90,0x00,0x0d,0x70,0x01,0xf3,0x00,0x0d,0x80,0x02,0xf3,0x00,0x03,0x99,
-0x00,0x19,0x01,0xd4,0x00,0xf3,0x0c,0x69,0x88,0x87,0x0f,0x31,0x04,0x67,0x77,0x60,
-0xff,0xe1,0x07,0xcc,0x90,0x0f,0x20,0x01,0xf0,0x0d,0x30,0xfd,0xc0,0x1f,0x31,0xe3,
-0x0f,0x53,0xd4,0x00,0x3b,0x00,0x11,0x08,0xd4,0x00,0x20,0x03,0xf1,0xd4,0x00,0x09,
-0x58,0x40,0xa0,0x4f,0xdc,0x00,0x2c,0x00,0x12,0x20,0x03,0xe9,0xff,0x7d,0x48,0xf8,
-0x0e,0x14,0x20,0x03,0xe0,0x4f,0xcf,0x40,0x3e,0x0c,0x70,0x6c,0x8c,0xe0,0xf3,0x03,
-0xf3,0x6e,0x0e,0x40,0x5d,0x02,0xe0,0x8d,0x8e,0x70,0x2e,0x00,0x58,0x50,0x62,0x5f,
-0x10,0x10,0xc9,0x32,0xf2,0x15,0xb9,0x00,0x1c,0x6d,0xdd,0xdd,0x12,0xf0,0x13,0x52,
-0x20,0x2f,0x06,0xff,0xe2,0x14,0xf0,0xe6,0x0b,0x8d,0xef,0x0e,0x40,0xa7,0x02,0xf0,
-0x5e,0xcd,0x10,0x2f,0x00,0x02,0x11,0x12,0x70,0x08,0x00,0x21,0x60,0x05,0xd0,0x09,
-0xa0,0x00,0x5d,0x9e,0x03,0xf0,0x16,0xa0,0x00,0x64,0x30,0x00,0x10,0x08,0xaa,0x00,
-0x3e,0x6d,0xdd,0xdd,0x24,0xe0,0x13,0x63,0x20,0x4e,0x06,0xfe,0xf3,0x05,0xe0,0xe6,
-0x09,0xac,0xfe,0x0e,0x40,0x89,0x03,0xe0,0x6e,0xce,0x20,0x4e,0x2c,0x23,0xb0,0x80,
-0x00,0x8f,0xee,0xd3,0x00,0x4f,0x20,0x07,0xd0,0x04,0xd1,0x1c,0x41,0x09,0xfe,0xed,
-0x40,0x42,0x11,0xf0,0x1d,0x76,0x20,0x00,0x10,0x01,0x79,0x40,0x95,0xb5,0x5f,0xfe,
-0xe9,0xb6,0xc5,0x00,0x46,0x10,0xb6,0xc5,0x09,0xfe,0xd1,0xb6,0xc5,0x0e,0x40,0xdf,
-0xf6,0xc5,0x0b,0x84,0xf2,0xb6,0xc5,0x01,0x79,0x40,0x63,0x62,0x00,0x1d,0xdd,0xde,
-0xe2,0xaf,0x02,0x30,0xf4,0x00,0x1f,0x8c,0x06,0x46,0x3f,0x21,0x22,0x20,0xd1,0x0a,
-0x02,0x17,0x0b,0xf0,0x1a,0xfe,0xb0,0x03,0xd0,0x36,0x67,0x66,0x04,0xe0,0x48,0x88,
-0x88,0x13,0xe0,0x03,0xef,0xc1,0xce,0xe0,0x0c,0x70,0xc7,0x25,0xe0,0x0e,0x30,0x99,
-0x15,0xe0,0x0a,0xa4,0xe6,0xff,0xe0,0x00,0x8b,0x70,0x04,0xe0,0x00,0x15,0xc9,0x11,
-0x10,0x5e,0x6d,0x02,0x05,0x92,0x0c,0x20,0x00,0x31,0x71,0x48,0xf2,0x25,0xeb,0x00,
-0x5a,0x49,0x99,0x98,0x16,0xc2,0x66,0x76,0x61,0x7c,0x04,0xee,0xc1,0xef,0xc0,0xe4,
-0x0b,0x70,0x6c,0x0e,0x60,0xc7,0xef,0xc0,0x5e,0xfc,0x10,0x7b,0x00,0x00,0x02,0x13,
-0x70,0x00,0xaf,0xde,0xd2,0x00,0x5e,0x10,0x09,0xa0,0x05,0xe1,0x00,0x9a,0x00,0x0a,
-0xfe,0xfd,0xe0,0x30,0x02,0x6e,0x10,0xf0,0x00,0xed,0x80,0x00,0x02,0x44,0x55,0x43,
-0x10,0x07,0xbb,0xbb,0xbb,0x50,0x00,0x19,0x39,0x24,0x30,0xc9,0x22,0xb9,0xc7,0x29,
-0x10,0x8a,0xa9,0x01,0x00,0xca,0x24,0x13,0x54,0x08,0x15,0x07,0x39,0x24,0x80,0x03,
-0x42,0x10,0x00,0x00,0x06,0xbc,0xa0,0xcf,0x62,0x40,0xdd,0x60,0x00,0x06,0x7d,0x27,
-0xf1,0x0a,0x5e,0x32,0xb9,0x00,0x00,0x5e,0x43,0xb9,0x00,0x00,0x06,0xce,0x70,0x00,
-0x6c,0xbb,0xde,0xbb,0xb9,0x14,0x55,0x56,0x55,0x42,0x01,0xa0,0x03,0xa5,0x67,0x77,
-0x7e,0x60,0x01,0xf9,0x77,0x78,0x10,0x00,0x9b,0x29,0x00,0xfa,0x2d,0x10,0x00,0x1e,
-0x2f,0xf0,0x03,0x00,0x03,0x99,0x99,0x99,0x20,0x01,0x55,0x87,0x55,0x10,0x00,0x4e,
-0xcc,0xe3,0x00,0x00,0x9a,0xd7,0x33,0xf0,0x0b,0x2b,0xff,0xb2,0x00,0x46,0x66,0xbb,
-0x66,0x64,0x69,0x99,0x99,0x99,0x96,0x00,0x3a,0xdd,0xa2,0x00,0x00,0xf8,0x22,0x8e,
-0x00,0x00,0xf3,0x8b,0x14,0x15,0x7f,0x86,0x14,0x11,0x10,0x60,0x31,0xfa,0x25,0xfc,
-0x00,0x96,0x00,0x37,0x77,0x66,0x1a,0x70,0x04,0x88,0x88,0x81,0xa8,0x00,0x03,0xdf,
-0xc2,0x0a,0x80,0x00,0xd6,0x09,0x90,0x9b,0x51,0x0d,0x40,0x89,0x09,0xda,0x40,0x5e,
-0xde,0x20,0x98,0x00,0x00,0x06,0x00,0x09,0x80,0x00,0x02,0xf0,0x22,0xa8,0x00,0xaf,
-0xff,0xfd,0x9a,0xb5,0x1c,0x10,0x86,0x78,0x14,0x40,0x07,0x97,0x00,0xe3,0xdc,0x2b,
-0xf0,0x19,0x1e,0x40,0x00,0x05,0x75,0x00,0xe4,0x00,0x0c,0xdb,0xe8,0x0e,0x51,0x00,
-0xe4,0x07,0xa0,0xef,0xe1,0x05,0xde,0xb2,0x0e,0x40,0x04,0x67,0xf7,0x86,0xe4,0x00,
-0x78,0x88,0x76,0x28,0x10,0x00,0x0c,0xdd,0xdd,0xd2,0x53,0x63,0x25,0x3f,0x30,0xec,
-0x21,0x60,0x0b,0x10,0x00,0x00,0x86,0x60,0x51,0x00,0xf0,0x1b,0x99,0x10,0x87,0x00,
-0x2e,0xee,0xee,0x88,0x80,0x00,0x06,0x97,0x10,0x89,0x00,0x08,0xc7,0xca,0x08,0x90,
-0x00,0xb5,0x06,0xd0,0x8f,0xe3,0x04,0xeb,0xe6,0x08,0x91,0x00,0x02,0xf3,0x34,0x88,
-0x00,0x6f,0xff,0xec,0x98,0x80,0x5b,0x0a,0x10,0x88,0xb7,0x2a,0x11,0x01,0xff,0x58,
-0x11,0x20,0x03,0x16,0x40,0x90,0x00,0x01,0x75,0x90,0x00,0xe0,0x08,0xa8,0x00,0xe3,
-0x00,0x8f,0xff,0xfe,0x2e,0x30,0x00,0x3a,0xb8,0x00,0x01,0x1f,0xf0,0x09,0xa8,0x0e,
-0xdc,0x00,0xd9,0x5c,0x70,0xe6,0x30,0x01,0x8f,0x60,0x0e,0x30,0x0b,0xdd,0xfd,0xf8,
-0xe3,0x00,0x23,0x44,0x32,0x15,0x4a,0x4b,0xd1,0xee,0xf6,0x00,0x00,0x67,0x77,0x8e,
-0x60,0x00,0x0f,0x87,0x77,0x72,0x0f,0x1d,0x13,0xc0,0x19,0x05,0x0c,0xdd,0x00,0x20,
-0x16,0x85,0xdd,0x00,0xf0,0x10,0xb9,0xd8,0x0e,0x51,0x00,0xf2,0x08,0x90,0xef,0xe1,
-0x06,0xee,0xb2,0x0e,0x40,0x03,0x47,0xf5,0x74,0xe4,0x00,0x9b,0xbb,0xa8,0x3c,0x30,
-0x00,0x02,0x9d,0xdb,0x30,0x86,0x25,0x20,0x7f,0x10,0x56,0x55,0x19,0xf2,0xb5,0x03,
-0x11,0x01,0x77,0x0c,0x80,0xfb,0x00,0xb3,0x03,0x77,0x76,0x60,0xd5,0x71,0x01,0xf5,
-0x15,0xc5,0x00,0x4e,0xfc,0x10,0xc5,0x00,0xe4,0x0a,0x80,0xc5,0x00,0xf3,0x09,0x80,
-0xc5,0x00,0x6e,0xdd,0x10,0xc5,0x00,0x01,0x70,0x00,0xc5,0x00,0x03,0xf1,0x23,0xc5,
-0x0e,0xff,0xfe,0xc8,0xc5,0x3c,0x1b,0x1f,0x83,0x7b,0x02,0x11,0xf2,0x04,0x6e,0xde,
+0x11,0xc7,0x11,0x10,0xbe,0xee,0xee,0xef,0xf8,0xb0,0x02,0xa5,0x04,0xff,0xfe,0xef,
+0x20,0x00,0x00,0x00,0x0f,0x30,0x05,0x00,0x12,0x20,0xf3,0x01,0xf5,0x21,0x20,0x22,
+0x01,0xa0,0x4d,0xf8,0xdf,0x12,0xf0,0x01,0xf1,0x3e,0x02,0xf0,0x05,0xf1,0x8c,0x02,
+0xf0,0x0c,0xf7,0xef,0x12,0xf0,0x3e,0x4f,0xba,0x82,0xf0,0x64,0x09,0x22,0x61,0xf0,
+0x00,0x01,0x12,0x22,0x40,0x00,0x5e,0xee,0xef,0xe0,0x00,0x00,0x00,0x04,0x05,0x00,
+0x21,0x03,0xe0,0x91,0x03,0x02,0x05,0x01,0xf0,0x04,0x9f,0xe5,0x00,0xc0,0x00,0x00,
+0x12,0x10,0x0f,0x10,0x05,0xff,0xff,0x20,0xf2,0x00,0x00,0x05,0xe0,0x61,0x00,0xf5,
+0x0b,0xc8,0x00,0xf3,0x10,0x00,0x5f,0x40,0x0f,0xff,0x30,0x1e,0xbc,0x00,0xf2,0x00,
+0x0c,0x80,0xd6,0x0f,0x20,0x07,0xa0,0x03,0xb0,0xf2,0x00,0x82,0x00,0x01,0x0b,0x00,
+0x41,0x0c,0x10,0x00,0x01,0x4a,0x00,0xd0,0x7f,0xf6,0x00,0xe1,0x00,0x16,0x66,0x60,
+0x0f,0x20,0x02,0x99,0xbf,0x48,0x00,0xf0,0x13,0x0c,0x80,0x0f,0xfe,0x10,0x0a,0xfa,
+0x00,0xf3,0x10,0x0b,0xc2,0xd8,0x0f,0x20,0x06,0x90,0x01,0x70,0xf1,0x00,0x00,0x23,
+0x33,0x33,0x00,0x00,0x0f,0xed,0xdd,0xf2,0x00,0x01,0xf2,0x48,0x00,0xaf,0x1f,0x20,
+0x01,0xf2,0x00,0x00,0xef,0xff,0xfe,0x00,0x48,0x00,0x08,0x81,0xff,0x10,0x0b,0xfa,
+0x00,0xf2,0x00,0x1b,0x48,0x00,0xd0,0x80,0x01,0x60,0xa0,0x00,0x00,0x0a,0x00,0x63,
+0x00,0x00,0x03,0xf0,0x94,0x02,0xf2,0x01,0x8f,0x43,0xf9,0x00,0x00,0x2f,0x8e,0xd9,
+0xe7,0x00,0x0a,0x60,0x7b,0x02,0xb0,0x00,0x1e,0x01,0x10,0x21,0x06,0x00,0xf0,0x21,
+0x6c,0xd5,0x00,0xd2,0x00,0x17,0x78,0x80,0x0f,0x30,0x02,0x88,0xbf,0x20,0xe5,0x10,
+0x00,0x1d,0x90,0x0e,0xff,0x30,0x1d,0xfa,0x00,0xe3,0x00,0x3e,0x81,0xca,0x0e,0x30,
+0x05,0x30,0x00,0x30,0x81,0x00,0x00,0x8b,0xbb,0xba,0x10,0x00,0x03,0x44,0x5f,0xc0,
+0x9d,0x03,0xd7,0xc0,0x00,0x00,0x02,0xaf,0xbf,0x80,0x00,0x01,0xd8,0x10,0x3b,0xc0,
+0x2e,0x02,0xf0,0x1d,0x06,0xff,0x30,0x91,0xc2,0x02,0x23,0x10,0xf2,0xe3,0x0d,0xde,
+0xd0,0xf2,0xe3,0x00,0x09,0x90,0xf2,0xe3,0x00,0x0e,0x30,0xfa,0xf3,0x00,0x7f,0x30,
+0xf8,0xf3,0x02,0xfb,0xa0,0xf2,0xe3,0x0c,0x81,0xf2,0xe2,0xe3,0x4b,0x00,0x66,0xe2,
+0x5a,0x03,0x06,0x05,0x00,0x40,0x70,0x92,0x00,0x20,0x93,0x00,0xf0,0x1b,0xef,0xb0,
+0x04,0xc0,0x05,0x66,0x72,0x04,0xd0,0x08,0x88,0xf7,0x04,0xd0,0x00,0x08,0xd1,0xde,
+0xd0,0x00,0x6f,0xe2,0x26,0xd0,0x08,0xe2,0x8d,0x14,0xd0,0x1a,0x10,0x05,0x15,0xd0,
+0x00,0x00,0x0a,0x44,0xb0,0x00,0x00,0x1f,0x97,0x04,0xd2,0xbf,0xe2,0x00,0x00,0x1b,
+0xd1,0x9e,0x40,0x00,0xaa,0x00,0x05,0xe1,0x83,0x00,0x00,0x21,0x01,0x40,0x3e,0xfa,
+0x00,0x3c,0x45,0x00,0xf1,0x1f,0xf0,0x88,0x9f,0x60,0x3f,0x00,0x09,0xc1,0xde,0xf0,
+0x07,0xfe,0x12,0x6f,0x09,0xe2,0xac,0x03,0xe2,0xa1,0x00,0x61,0x3e,0x00,0x00,0x24,
+0x31,0x80,0x00,0xae,0xbc,0xe4,0x00,0x6e,0x00,0x06,0xd0,0x05,0xe1,0x00,0x8c,0x00,
+0x09,0xfe,0xfd,0x30,0x60,0x04,0x00,0x01,0x00,0x40,0x07,0xff,0x10,0xa1,0xc6,0x00,
+0x10,0xe3,0xc6,0x00,0xf0,0x10,0xf3,0xf3,0x00,0x0b,0x90,0xe3,0xf2,0x00,0x1f,0x58,
+0xf3,0xe2,0x00,0x9f,0x47,0xf3,0xe2,0x03,0xfc,0x90,0xe3,0xe2,0x0d,0x62,0xf1,0xd3,
+0xe2,0x59,0x00,0x84,0xd3,0xbc,0x00,0x01,0x05,0x00,0x10,0xe3,0x05,0x00,0x22,0x71,
+0xa2,0x42,0x00,0x20,0x2f,0xdc,0xd0,0x05,0xf0,0x10,0x23,0x10,0x00,0x01,0xff,0xff,
+0xf5,0x00,0x00,0x00,0x0a,0xc0,0x00,0x00,0x01,0xbf,0x20,0x00,0x00,0x5e,0xab,0xe5,
+0x00,0x0b,0xb4,0x22,0x5d,0x50,0x00,0x00,0xa9,0x29,0x00,0x46,0xa9,0x11,0x10,0xcf,
+0x3b,0x05,0xf0,0x1d,0xdb,0x90,0x03,0x90,0x04,0x64,0x00,0x5d,0x0d,0xfe,0xf7,0x05,
+0xd0,0x00,0x4f,0x20,0x4d,0x00,0x3f,0xd0,0x04,0xd0,0x3e,0x7b,0xa0,0x4d,0x2e,0x64,
+0x1c,0x44,0xd0,0x10,0xe3,0x00,0x4d,0x00,0x0e,0x42,0x34,0xd3,0xff,0xfe,0xc9,0x4d,
+0xa9,0x02,0xf0,0x09,0xd0,0x00,0x00,0x00,0x3b,0x00,0x09,0x87,0x30,0x00,0x00,0x04,
+0x77,0x30,0x00,0x00,0xcd,0xdd,0xd7,0x00,0x00,0x22,0x2a,0xf3,0x6d,0x00,0xb1,0x60,
+0x00,0x02,0x9f,0x98,0xf8,0x10,0x09,0x72,0x00,0x18,0xa3,0x05,0x13,0x11,0x5c,0x06,
+0x38,0x99,0x00,0x00,0x05,0x00,0xc0,0x87,0x00,0x00,0x00,0x08,0x87,0x20,0x00,0x00,
+0x03,0x78,0x30,0x66,0x06,0x10,0xf9,0xdf,0x05,0xf1,0x03,0xd1,0x00,0x00,0x19,0xff,
+0xb1,0x00,0x07,0xea,0x21,0x9f,0x40,0x02,0x10,0x00,0x01,0x20,0x9f,0x3c,0x00,0x31,
+0x11,0x9b,0x21,0xcb,0x05,0x01,0x11,0x06,0x14,0x50,0x05,0x00,0x23,0x0c,0x40,0x36,
+0x01,0xf1,0x0d,0x76,0x20,0x00,0x00,0x04,0x89,0x30,0x00,0x00,0xde,0xee,0xe8,0x00,
+0x00,0x11,0x3d,0xd2,0x00,0x00,0x29,0xff,0xb2,0x00,0x08,0xe9,0x21,0x9e,0x50,0x22,
+0x00,0x01,0x82,0x00,0x90,0x01,0x11,0x5e,0x11,0x10,0x01,0xc0,0x4e,0x00,0xc1,0x05,
+0x90,0x00,0x00,0x02,0xf2,0x11,0x11,0x00,0x01,0xef,0x20,0x06,0x10,0x06,0xc8,0x00,
+0x80,0x02,0x78,0x40,0x00,0x00,0xdf,0xee,0xfd,0xb6,0x05,0xc1,0xd2,0x00,0x03,0x9e,
+0xc9,0xea,0x30,0x05,0x62,0x00,0x05,0x50,0xe3,0x06,0xf2,0x00,0x01,0x22,0x6e,0x22,
+0x10,0x02,0xde,0xef,0xee,0x20,0x00,0x23,0x22,0x2e,0x40,0x61,0x06,0x38,0xf2,0x11,
+0x22,0x61,0x06,0x1c,0x07,0xcd,0x00,0x10,0xd2,0xcd,0x00,0x51,0xa1,0x00,0x07,0xea,
+0x22,0xcd,0x00,0x13,0x02,0xcd,0x00,0x90,0x00,0x8a,0x00,0x00,0x00,0x4d,0xff,0xe5,
+0x00,0x61,0x06,0x03,0x6b,0x06,0x15,0x5e,0x66,0x06,0x00,0x49,0x02,0xfd,0x27,0x0d,
+0xed,0x10,0x3e,0x01,0x35,0x52,0x03,0xe0,0x7c,0xbf,0xc0,0x3e,0x00,0x09,0xf3,0x03,
+0xe0,0x3d,0xa9,0xd2,0x2f,0x0a,0x50,0x05,0x42,0xf2,0xbb,0xbc,0xde,0x4f,0x04,0x4f,
+0x62,0x02,0xf0,0x00,0xe3,0x00,0x2f,0x00,0x0e,0x30,0x02,0xe0,0x00,0xe2,0x00,0x2e,
+0x00,0x02,0x00,0x00,0x60,0x4e,0x01,0x50,0x3d,0xc1,0x00,0x00,0x2a,0x08,0x01,0x45,
+0xe8,0x11,0x8e,0x40,0x2d,0x07,0x12,0xf9,0xf2,0x01,0x12,0xef,0x2d,0x07,0x1c,0x1e,
+0x69,0x07,0xf4,0x1e,0x07,0xdc,0x60,0x03,0xb0,0x02,0x31,0x00,0x4d,0x4e,0xef,0xf2,
+0x04,0xd0,0x11,0x5f,0x00,0x4d,0x00,0x0b,0x90,0x04,0xd0,0x03,0xf5,0x00,0x4d,0x00,
+0xdd,0xc0,0x04,0xe0,0x9c,0x0e,0x50,0x4e,0x5d,0x10,0x4d,0x04,0xe1,0x10,0x00,0x10,
+0x4e,0xb4,0x04,0xf0,0x28,0x17,0x04,0xec,0x80,0x03,0x80,0x24,0x65,0x00,0x6d,0x1c,
+0xdc,0xf6,0x06,0xd0,0x00,0x6e,0x00,0x5d,0x00,0x4f,0xc0,0x05,0xd0,0x5f,0x5b,0xb0,
+0x5c,0x3e,0x40,0x09,0x25,0xc0,0x00,0x02,0x43,0x37,0x00,0x0b,0xeb,0xde,0x30,0x06,
+0xe0,0x00,0x8b,0x00,0x5e,0x10,0x0a,0xb0,0x00,0xaf,0xef,0xd2,0xe1,0x06,0x00,0x97,
+0x00,0x70,0x0c,0x20,0x02,0xef,0xff,0xb0,0xe3,0x96,0x02,0xf0,0x06,0x0e,0x30,0x00,
+0x11,0x2e,0x40,0xe3,0x00,0x7e,0xff,0xd0,0x0e,0x63,0x00,0x00,0xd6,0x00,0xed,0xc3,
+0x00,0x9b,0x9c,0x00,0x73,0x7d,0x10,0x00,0xe3,0x00,0x4d,0x10,0xa7,0x00,0x24,0xe4,
+0x00,0xb7,0x00,0x22,0x00,0x82,0x35,0x01,0xf0,0x22,0x01,0x11,0x10,0xc0,0xe2,0x3f,
+0xfe,0xf2,0xf0,0xf3,0x00,0x02,0xf1,0xf0,0xe3,0x00,0x06,0xd0,0xf0,0xe3,0x9f,0xff,
+0x70,0xfc,0xf3,0x00,0x3f,0x10,0xf4,0xf3,0x00,0xc8,0x00,0xf0,0xe3,0x07,0xd0,0x00,
+0xf0,0xe3,0x3e,0x20,0x00,0xf0,0xe3,0x23,0x00,0x00,0xf0,0x6f,0x00,0x10,0xf1,0x05,
+0x00,0x22,0x80,0xa1,0x41,0x00,0xf5,0x17,0x12,0x10,0x4c,0x0d,0xee,0xec,0x05,0xd0,
+0x00,0x07,0x90,0x5d,0x03,0x44,0xc5,0x05,0xd0,0xab,0xdf,0x5c,0xdd,0x00,0x0c,0x81,
+0x47,0xd0,0x06,0xe0,0x00,0x4d,0x04,0xf4,0x00,0x04,0xd0,0xe4,0x00,0x00,0xff,0x02,
+0x10,0x4c,0x46,0x01,0x11,0x80,0xf9,0x03,0x00,0x1b,0x08,0xf2,0x10,0xe0,0x0c,0xfe,
+0xfb,0x03,0xf0,0x01,0x22,0x98,0x02,0xf0,0x0b,0xcd,0xf6,0xbc,0xf0,0x00,0x1d,0x80,
+0x46,0xf0,0x02,0xd9,0x00,0x02,0xf0,0x0e,0x60,0x00,0x02,0xf0,0xd9,0x05,0x60,0x4c,
+0x00,0x01,0xb0,0x00,0x5d,0x34,0x00,0x10,0x5d,0x37,0x00,0xf0,0x21,0x3f,0xff,0xff,
+0xe0,0x02,0x33,0x31,0x09,0x50,0xcd,0xce,0x90,0xb6,0x05,0x66,0xe6,0x3c,0x61,0x99,
+0xec,0x7d,0xf6,0x00,0x9e,0x20,0x0b,0x61,0xcb,0x10,0x00,0xb6,0x14,0x01,0x11,0x15,
+0x10,0x0d,0xff,0xff,0xf4,0x00,0x00,0x00,0x0d,0x50,0x0b,0xff,0xff,0xc7,0x00,0x33,
+0x00,0x00,0x09,0xb4,0x06,0xf0,0x49,0x00,0x01,0x22,0x20,0x0c,0x23,0xee,0xdf,0x60,
+0xe4,0x03,0x34,0xf3,0x1e,0x44,0xcc,0xfb,0xbf,0xf4,0x00,0x6e,0x20,0x0d,0x30,0x9e,
+0x20,0x00,0xe3,0x58,0x00,0x00,0x06,0x10,0x0a,0xee,0xee,0xd2,0x00,0xd7,0x22,0x2f,
+0x40,0x0d,0x50,0x00,0xe3,0x00,0xd6,0x00,0x0e,0x30,0x0a,0xff,0xff,0xe1,0x00,0x11,
+0x21,0x02,0x80,0x0b,0xee,0xed,0x04,0xd0,0x02,0x33,0x9a,0x04,0xd0,0x09,0xac,0xf7,
+0xef,0xd0,0x00,0x1d,0x80,0x16,0xd0,0x03,0xe8,0x00,0x04,0xd0,0x0c,0x40,0x02,0xde,
+0x00,0xf2,0x05,0x0f,0x23,0xa0,0x00,0x00,0x6f,0x20,0x00,0x00,0x02,0xed,0xd2,0x00,
+0x00,0x2d,0x90,0x9e,0x30,0x00,0xc7,0xd2,0x08,0x06,0x01,0x00,0xf0,0x17,0xa1,0xd2,
+0x3f,0xff,0xf0,0xe2,0xe3,0x00,0x07,0xe0,0xe2,0xe3,0x01,0x1b,0xa0,0xe3,0xe3,0x9e,
+0xff,0xac,0xf2,0xe3,0x00,0x7d,0x24,0xe2,0xe3,0x01,0xe4,0x00,0xe2,0xe3,0x0b,0xa0,
+0x00,0xe2,0xe3,0x6d,0x66,0x05,0x13,0x21,0xa5,0x04,0x01,0x70,0x05,0xf0,0x20,0x60,
+0x81,0x00,0x01,0x10,0x01,0xc0,0xef,0xff,0xb0,0x3f,0x00,0x00,0x7a,0x25,0xf0,0x11,
+0x2c,0x6c,0xef,0x0d,0xef,0xe0,0x03,0xf0,0x00,0xc8,0x01,0x4f,0x00,0x6d,0x0a,0xff,
+0xf0,0x4f,0x30,0x00,0x2f,0x1e,0x30,0x00,0x02,0xe0,0x10,0x00,0x00,0x2e,0x66,0x01,
+0x00,0x63,0x02,0xf0,0x11,0x19,0x04,0x55,0x50,0x0b,0x24,0xbb,0xbf,0x41,0xe3,0x12,
+0x34,0xf7,0xff,0x35,0xaa,0xf8,0x00,0xe3,0x00,0xac,0x0e,0xff,0x32,0xcb,0x00,0x01,
+0xe3,0x55,0x00,0x00,0x08,0xee,0x00,0x10,0xd1,0xee,0x00,0x92,0x30,0x0d,0x50,0x00,
+0xf3,0x00,0xd6,0x00,0x0f,0xee,0x00,0x11,0x00,0x2a,0x02,0x01,0xa8,0x08,0xe0,0x01,
+0x11,0x1f,0x20,0x00,0x1b,0xbb,0xbc,0xf2,0x00,0x00,0x44,0x44,0x5f,0xaf,0x05,0x00,
+0x98,0x01,0x30,0x03,0xd0,0x2d,0x59,0x06,0x00,0x0e,0x00,0xf0,0x05,0x26,0xe2,0x22,
+0x21,0x08,0xfe,0xee,0xee,0xee,0xd0,0x00,0xbb,0xbb,0xbb,0x00,0x00,0x45,0x55,0x5f,
+0x10,0x22,0x04,0x50,0x00,0x00,0x12,0x71,0x3f,0xc1,0x01,0x30,0x05,0x00,0xaf,0xc3,
+0x03,0x54,0x12,0x11,0x11,0x11,0x20,0x6f,0x0a,0x23,0x1e,0x50,0x6f,0x0a,0x05,0x4f,
+0x04,0x10,0x00,0xed,0x01,0x80,0xff,0xff,0xfd,0x00,0x00,0x11,0x11,0x4f,0x05,0x00,
+0x40,0x5e,0x00,0x04,0xff,0x44,0x07,0x12,0x00,0xfc,0x01,0x10,0x6b,0x05,0x00,0x21,
+0x35,0x00,0x74,0x0a,0xe3,0x9c,0xcc,0xcc,0xcc,0xc8,0x00,0xde,0xee,0xed,0x00,0x00,
+0x22,0x22,0x3f,0x6e,0x00,0xc4,0x11,0x11,0x3f,0x00,0x01,0x11,0x11,0x14,0x10,0xaf,
+0xfe,0xee,0xb0,0x03,0x0f,0x6e,0x00,0x06,0x30,0xbc,0xcc,0xcb,0xd0,0x00,0xb1,0x4f,
+0x10,0x01,0xcc,0xcc,0xdf,0x00,0x00,0x34,0x44,0x5f,0xc7,0x03,0x22,0x00,0xaf,0xf4,
+0x04,0xf1,0x02,0x11,0x11,0x10,0x00,0x34,0x44,0x44,0x00,0x03,0xfd,0xdd,0xdf,0x30,
+0x03,0xf0,0x00,0x0f,0x05,0x00,0x00,0x23,0x0b,0x13,0xfe,0x64,0x08,0x03,0xfd,0x02,
+0xf7,0x13,0x2e,0x0d,0xee,0xec,0x03,0xf0,0x00,0x05,0xa0,0x3f,0x03,0x44,0xb6,0x03,
+0xf0,0xab,0xcf,0x10,0x3f,0x00,0x0b,0x90,0x03,0xf0,0x05,0xe1,0x00,0x2f,0x03,0xf4,
+0x00,0x02,0xf0,0xe5,0x8e,0x01,0x10,0x2e,0x34,0x00,0x60,0x90,0x02,0x33,0x31,0x07,
+0x30,0xbc,0x02,0xfd,0x10,0x03,0x44,0xd5,0x0b,0x61,0xbc,0xfd,0x00,0xb6,0x00,0x6f,
+0x30,0x0b,0x60,0x9e,0x30,0x00,0xb6,0x27,0x00,0x00,0x05,0x20,0x0c,0xee,0xee,0xf3,
+0x00,0x01,0x11,0x1d,0xbc,0x02,0x00,0xec,0x04,0x80,0x10,0x0a,0x10,0x02,0xff,0xfe,
+0x60,0xf3,0x74,0x0c,0x00,0x95,0x00,0x00,0xf2,0x0a,0xc0,0x3f,0xee,0xe5,0x0e,0xee,
+0x43,0xf2,0x21,0x00,0xe5,0x20,0x3f,0x92,0x04,0xa1,0x03,0xe0,0x01,0x30,0xe3,0x00,
+0x1e,0xff,0xec,0x2e,0xf6,0x03,0x16,0xe3,0xf6,0x03,0x11,0xb2,0x15,0x01,0xf1,0x12,
+0x00,0x01,0xcc,0xcc,0x50,0xe4,0x00,0x3f,0x44,0x40,0x0e,0x40,0x03,0xf2,0x22,0x00,
+0xe5,0x10,0x3f,0xed,0xd4,0x0e,0xff,0x33,0xe0,0x00,0x20,0xe4,0x00,0x2f,0xff,0xfd,
+0x1e,0x2c,0x00,0x31,0x50,0x00,0x00,0xee,0x04,0x41,0x01,0x21,0x11,0xe4,0x0b,0x00,
+0x61,0x20,0x00,0x0f,0x30,0x11,0x10,0x0b,0x00,0x22,0x60,0x00,0xaf,0x01,0xb0,0x44,
+0x41,0x0d,0x20,0x02,0xfd,0xdc,0x40,0xe3,0x00,0x3f,0x63,0x00,0xf0,0x15,0x03,0xff,
+0xff,0x50,0xef,0xf4,0x3e,0x00,0x00,0x0e,0x51,0x02,0xfd,0xde,0xf1,0xe4,0x00,0x02,
+0x32,0x10,0x08,0x10,0x00,0x01,0x11,0x12,0x20,0x00,0x00,0xef,0xfe,0xef,0x40,0x00,
+0x0f,0x30,0x85,0x04,0x10,0xf4,0x41,0x05,0x43,0x0d,0xff,0xff,0xe2,0xd8,0x08,0xe2,
+0x33,0x30,0xb1,0xd2,0x0f,0xdd,0xb1,0xf2,0xf3,0x0f,0x10,0x00,0xf2,0xe3,0x05,0x00,
+0x83,0xdd,0xd0,0xfb,0xf3,0x0f,0x42,0x10,0xf6,0x14,0x00,0x80,0x65,0x83,0xf2,0xe3,
+0x09,0xba,0x82,0xf2,0xcd,0x00,0x06,0x05,0x00,0xe0,0x80,0xa2,0x01,0x22,0x10,0x80,
+0x91,0x0f,0xee,0xc0,0xf1,0xe3,0x0f,0x21,0x28,0x00,0x30,0xff,0xc0,0xff,0x32,0x00,
+0xf1,0x06,0xf1,0xe3,0x0f,0xdd,0xf3,0xf2,0xe3,0x02,0x32,0x00,0xc1,0xc2,0x00,0x02,
+0x22,0x33,0x20,0x00,0x3e,0xed,0xdd,0x75,0x0b,0x06,0x05,0x00,0x11,0xf0,0x7d,0x00,
+0xf0,0x05,0x04,0x55,0x50,0xb0,0xb3,0x0f,0xba,0x80,0xf1,0xc5,0x0f,0x31,0x10,0xf2,
+0xc5,0x0f,0xff,0xc0,0xfe,0xf5,0x73,0x00,0xd0,0xc5,0x0f,0xaa,0xb3,0xf1,0xc5,0x05,
+0x65,0x40,0x90,0x82,0x00,0x06,0x0e,0x01,0x60,0x0f,0x21,0x11,0xe3,0x00,0x0f,0x93,
+0x01,0x43,0x0f,0x10,0x00,0xe2,0x1d,0x03,0x10,0x00,0xfe,0x09,0x91,0x10,0x2d,0xee,
+0xdd,0x80,0x3e,0xf3,0x00,0x00,0x04,0x00,0x61,0xfd,0xdc,0x3f,0xfe,0xf6,0x32,0x0c,
+0x00,0x90,0x2e,0xf7,0x45,0x72,0x2f,0x8b,0xba,0x82,0x2f,0x63,0x08,0x03,0x00,0x02,
+0x13,0x19,0x78,0x05,0xf3,0x11,0x20,0x03,0xd0,0x0f,0xff,0xe7,0x04,0xe0,0x1f,0x10,
+0x00,0x26,0xe0,0x1f,0xff,0xf3,0xbd,0xe0,0x1f,0x21,0x00,0x03,0xe0,0x1f,0x10,0x23,
+0x03,0xe0,0x0e,0xff,0xec,0x14,0xda,0x0a,0x70,0x3c,0x00,0x02,0xb0,0x00,0x5e,0x00,
+0x7e,0x0e,0x00,0x94,0x02,0xf0,0x13,0x3e,0xff,0xfe,0xd0,0x03,0x44,0x41,0x01,0x90,
+0x0f,0xdd,0xc6,0x03,0xf0,0x1f,0x21,0x10,0x47,0xf0,0x1f,0xff,0xe3,0x9b,0xf0,0x1f,
+0x00,0x01,0x03,0xf0,0x0f,0xff,0xfd,0x13,0xe0,0x51,0x09,0xf0,0x06,0x30,0x00,0x4e,
+0xff,0xff,0xd0,0x00,0x02,0x22,0x15,0xe0,0x00,0x6f,0xff,0xff,0xc0,0x00,0x8b,0x11,
+0x11,0x00,0x0a,0x00,0x14,0xe0,0xb7,0x01,0xf0,0x01,0x01,0xb0,0xfd,0xdc,0x60,0x2f,
+0x1f,0x21,0x10,0x46,0xf1,0xff,0xfe,0x4a,0xbf,0x1f,0xd5,0x03,0xf5,0x0d,0xfd,0xce,
+0xe1,0x2f,0x01,0x21,0x00,0x00,0xb0,0x05,0xcd,0xdd,0xda,0x00,0x9b,0x33,0x36,0xe0,
+0x09,0xa0,0x00,0x3e,0x00,0x9a,0x00,0x04,0xe0,0x06,0xf3,0x08,0x80,0x33,0x20,0xa1,
+0xd2,0x0f,0xdd,0x90,0xe3,0xa6,0x01,0x22,0xe3,0xf3,0x05,0x00,0x72,0xee,0x7d,0xf3,
+0xe3,0x0f,0x31,0x03,0x14,0x00,0xa5,0xe3,0x0f,0x65,0x71,0xe3,0xe3,0x09,0xba,0x81,
+0xe3,0x66,0x09,0x11,0xf2,0x31,0x0a,0x00,0xab,0x01,0xa0,0x70,0x91,0x0f,0xee,0xa0,
+0xf2,0xe3,0x0f,0x31,0x01,0xab,0x01,0x23,0xae,0xf2,0x32,0x00,0x30,0xdd,0xf3,0xe3,
+0xab,0x01,0x15,0xb1,0xab,0x01,0x20,0xde,0xf1,0x24,0x01,0x06,0x05,0x00,0x17,0xf0,
+0x41,0x05,0x90,0x11,0x00,0xe3,0xb1,0x0f,0xff,0xb0,0xe3,0xf2,0x3c,0x00,0x80,0xf2,
+0x0f,0xff,0x8f,0xf3,0xf2,0x0f,0x31,0x0a,0x00,0x90,0x43,0x41,0xe3,0xf2,0x0c,0xdc,
+0xa2,0xe3,0xf2,0x78,0x00,0x63,0xf2,0x00,0x3b,0x00,0x91,0xd1,0x3a,0x01,0x80,0x00,
+0x01,0x10,0x00,0x3f,0xff,0xff,0xe0,0x10,0x00,0x01,0x00,0xf1,0x2d,0x03,0x44,0x30,
+0xc1,0xd1,0x0f,0xcb,0x80,0xf2,0xe3,0x0f,0x31,0x04,0xf2,0xe3,0x0f,0xfe,0x8b,0xf3,
+0xe3,0x0f,0x10,0x00,0xe3,0xe3,0x0f,0xbb,0xd3,0xe3,0xe3,0x03,0x43,0x10,0x60,0x60,
+0x00,0x3e,0xff,0xff,0xf0,0x00,0x02,0x22,0x23,0xf1,0x00,0x2f,0xff,0xff,0xe0,0x00,
+0x3f,0x10,0x11,0x10,0x00,0x1f,0xff,0xff,0xf6,0x41,0x00,0x80,0x01,0x22,0x10,0x80,
+0x91,0x0f,0xee,0xa0,0x41,0x00,0x73,0x01,0xf2,0xe3,0x0f,0xff,0x9e,0xf2,0x41,0x00,
+0xe0,0xdd,0xf3,0xe3,0xe3,0x02,0x32,0x00,0xb1,0xd2,0x00,0x00,0x11,0x11,0x00,0x32,
+0x00,0x53,0xf0,0x00,0x1f,0x20,0x02,0x05,0x00,0xf0,0x32,0x0d,0xff,0xff,0xd0,0x00,
+0x11,0x11,0x10,0x00,0x01,0xff,0xff,0xfd,0x00,0x02,0xf0,0x00,0x00,0x00,0x02,0xff,
+0xff,0xfc,0x00,0x02,0xf2,0x21,0x10,0x00,0x02,0xf3,0x33,0x44,0x10,0x00,0xbc,0xcc,
+0xbb,0x20,0x00,0x00,0x88,0x00,0x00,0x01,0x11,0x99,0x11,0x10,0xaf,0xff,0xff,0xff,
+0xf9,0x00,0xce,0xee,0xeb,0x00,0x00,0xf4,0x22,0x21,0x00,0x00,0x2d,0x00,0xf0,0x0c,
+0x00,0xf3,0x10,0x00,0x00,0x00,0xef,0xff,0xff,0x10,0x00,0x01,0x8b,0x00,0x00,0x8c,
+0xcb,0xde,0xbb,0xc8,0x24,0x44,0x44,0x44,0x42,0x00,0x80,0x50,0x00,0x10,0xf1,0x05,
+0x00,0xbb,0xf2,0x11,0x12,0x00,0x01,0xef,0xff,0xff,0x70,0x00,0xde,0x3c,0x00,0x11,
+0x00,0x3c,0x00,0xf2,0x0c,0xfe,0x10,0x00,0x00,0x7b,0x00,0x00,0xaf,0xfe,0xff,0xee,
+0xfa,0x02,0x22,0x33,0x22,0x10,0x00,0x4d,0xee,0xe7,0x00,0x00,0xe7,0x00,0x3f,0x20,
+0x05,0x00,0x10,0x5e,0x0f,0x00,0xf0,0x10,0x00,0x11,0x00,0x00,0x00,0xac,0xcc,0xc9,
+0x00,0x00,0xf6,0x44,0x42,0x00,0x00,0xf4,0x33,0x31,0x00,0x00,0xfd,0xdd,0xd8,0x00,
+0x00,0xf2,0x00,0x01,0x00,0x00,0xdf,0x46,0x00,0x00,0x01,0x00,0x80,0x7f,0xff,0xff,
+0xff,0xfa,0x01,0x11,0x5d,0x0c,0x00,0x10,0x4e,0x05,0x00,0x10,0x4d,0x05,0x00,0x3f,
+0x39,0x00,0x00,0xeb,0x00,0x12,0x00,0x19,0x00,0x92,0x11,0x11,0x12,0x20,0xaf,0xee,
+0xee,0xee,0xf9,0xaf,0x00,0x1a,0xf5,0xaf,0x00,0x05,0x69,0x00,0x02,0x0e,0x01,0x00,
+0x81,0x01,0x00,0xdc,0x00,0xa0,0x40,0x00,0x11,0x11,0x1d,0x50,0x00,0x00,0x00,0x0d,
+0x05,0x00,0x31,0x0c,0x40,0x00,0x01,0x00,0x38,0xcd,0xdd,0xda,0x41,0x00,0x24,0xf4,
+0x11,0xf0,0x00,0x83,0x01,0x10,0x00,0x00,0x8c,0xcc,0xcc,0xcc,0x2c,0x01,0x10,0x70,
+0x2d,0x00,0x10,0xf2,0x05,0x00,0x31,0xf3,0x11,0x11,0x4f,0x01,0xa3,0x60,0x00,0xab,
+0xbb,0xb9,0x00,0x00,0xf7,0x55,0x53,0x3c,0x00,0x30,0xf6,0x33,0x34,0xff,0x00,0xf0,
+0x10,0xcb,0x10,0x68,0x77,0x77,0x78,0x85,0x35,0x55,0x55,0x54,0x42,0x03,0xff,0xff,
+0xff,0x30,0x00,0x11,0x11,0x1e,0x40,0x02,0xff,0xff,0xff,0x20,0x03,0xf2,0x11,0x11,
+0xe1,0x00,0x21,0xff,0x70,0x7c,0x00,0xf4,0x18,0x12,0x23,0x10,0x2c,0xed,0xdd,0x80,
+0x3e,0xe3,0x00,0x00,0x3e,0xf3,0x00,0x00,0x3e,0xfc,0xbb,0x60,0x3f,0xf7,0x55,0x20,
+0x3f,0xf3,0x00,0x00,0x3f,0xf5,0x34,0x52,0x3f,0xad,0xdc,0xa4,0x3f,0x00,0x00,0x00,
+0x04,0x00,0xf0,0x1a,0x18,0x03,0x44,0x41,0x07,0x40,0xfd,0xdc,0x60,0xb7,0x0f,0x20,
+0x00,0x0b,0x70,0xff,0xff,0x70,0xb6,0x0f,0x10,0x00,0x0b,0x60,0xfd,0xde,0xf1,0xb6,
+0x01,0x32,0x10,0x07,0x30,0x01,0x22,0x22,0x20,0x00,0xee,0xee,0xef,0xe0,0x00,0x10,
+0xd6,0xe4,0x00,0x50,0x60,0x00,0x00,0x00,0xc5,0x31,0x01,0x12,0x00,0x38,0x01,0xf0,
+0x22,0x44,0x44,0x30,0xc4,0x00,0x7c,0xcc,0xb9,0x0d,0x50,0x00,0x62,0x19,0x00,0xd5,
+0x00,0x0c,0x54,0xe0,0x0d,0x50,0x00,0xc5,0x4e,0x00,0xde,0xd5,0x0c,0x54,0xd0,0x0c,
+0x73,0x00,0xc5,0x4d,0x00,0xc5,0x00,0x3d,0x98,0xe5,0x1c,0x50,0x07,0xba,0xaa,0x92,
+0xc5,0x00,0x45,0x00,0x10,0x50,0x06,0x00,0x10,0xc6,0x05,0x00,0x23,0x08,0x30,0x48,
+0x00,0xf0,0x14,0x66,0x66,0x60,0xe2,0x00,0x5a,0xa9,0x97,0x0f,0x30,0x00,0x76,0x0d,
+0x00,0xf3,0x00,0x09,0x81,0xf0,0x0f,0xff,0x30,0x98,0x2f,0x00,0xf3,0x00,0x7f,0xee,
+0xff,0x2f,0x30,0x00,0x22,0x21,0x31,0x01,0x90,0xb0,0x00,0x0a,0x10,0x00,0x0f,0x21,
+0x11,0xf2,0x21,0x01,0x61,0xef,0x20,0x00,0x0f,0x10,0x00,0x0b,0x00,0x12,0xff,0x9f,
+0x01,0x03,0x4d,0x00,0xf1,0x02,0x22,0x20,0xa1,0xd2,0x5e,0xee,0xd7,0xe2,0xe3,0x05,
+0x43,0x60,0xe2,0xe3,0x09,0x86,0xb0,0x05,0x00,0xf5,0x0b,0xec,0xf3,0x09,0x86,0xa0,
+0xe6,0xf3,0x09,0x87,0xa0,0xe2,0xe3,0x3c,0xcb,0xd7,0xe2,0xe3,0x38,0x88,0x75,0xe2,
+0xe3,0x00,0x00,0x00,0xe3,0x05,0x00,0x20,0x50,0x91,0x40,0x00,0xf0,0x23,0x13,0xcd,
+0xdd,0xd1,0x6a,0x03,0x33,0x42,0x07,0xb0,0x4b,0x0d,0x43,0x9b,0x05,0xc0,0xd5,0xce,
+0xb0,0x5c,0x0e,0x51,0x6b,0x4f,0xff,0xee,0x86,0xa0,0x00,0x00,0x00,0x23,0x00,0x9f,
+0xff,0xff,0x90,0x00,0x11,0x00,0x8a,0x00,0x8f,0xff,0xff,0x90,0x0a,0x90,0x01,0x10,
+0x12,0x00,0x11,0xc0,0x7b,0x00,0xf0,0x38,0x33,0x33,0x04,0x63,0xdd,0xde,0xc1,0x7b,
+0x04,0xb0,0xd4,0x18,0xb0,0x5c,0x0d,0x5e,0xfb,0x04,0xc0,0xe3,0x07,0xb3,0xef,0xdf,
+0xe6,0x7b,0x02,0x22,0x21,0x06,0x90,0x01,0x33,0x33,0x41,0x00,0x9e,0xcc,0xce,0xa0,
+0x09,0x90,0x00,0x8a,0x00,0x9a,0x00,0x08,0xa0,0x07,0xff,0xff,0xf8,0x01,0x22,0x20,
+0x82,0xc2,0x5e,0xee,0xd5,0xc4,0xe3,0x05,0x35,0x40,0xc4,0xf3,0x09,0x79,0x80,0x05,
+0x00,0xf0,0x07,0x9c,0xf4,0xf3,0x09,0x79,0x83,0xc4,0xe3,0x09,0x79,0x70,0xb4,0xe3,
+0x2c,0xbc,0xb5,0xb4,0xe3,0x39,0x99,0x84,0xb4,0xa7,0x00,0x06,0x05,0x00,0xf2,0x16,
+0x40,0xa2,0x02,0x33,0x30,0x52,0x72,0x5d,0xdd,0xd4,0xc6,0xc6,0x09,0x67,0x90,0xc6,
+0xc6,0x09,0x78,0xac,0xf6,0xc6,0x09,0x78,0x90,0xb6,0xc6,0x5e,0xee,0xf9,0xb6,0xc6,
+0x03,0x32,0x20,0x73,0xb4,0x06,0x03,0x31,0x3f,0xff,0xff,0xcc,0x02,0x15,0xe4,0x05,
+0x00,0x10,0xe3,0x05,0x00,0xf0,0x1c,0x20,0x04,0x44,0x44,0x05,0x92,0xcc,0xcb,0xb2,
+0x6b,0x01,0x90,0x93,0xff,0xb0,0x3d,0x0d,0x30,0x5b,0x03,0xd0,0xd3,0xde,0xb0,0x6e,
+0x5e,0x86,0x7b,0x1b,0xcb,0xba,0x55,0xb0,0x00,0x00,0x00,0x5b,0x00,0x4a,0x00,0x04,
+0x80,0x06,0xe2,0x00,0x80,0x6c,0x11,0x11,0x10,0x04,0xff,0xff,0xea,0x36,0x00,0xf0,
+0x07,0x73,0xcc,0xcc,0xb2,0x8b,0x04,0xb0,0xd4,0xef,0xb0,0x5c,0x0d,0x41,0x8b,0x04,
+0xc0,0xe4,0xce,0xb3,0xef,0xdf,0xe8,0xe9,0x00,0xf2,0x0c,0x07,0xb0,0x00,0x02,0x42,
+0x36,0x00,0x1c,0xeb,0xdd,0x20,0x07,0xd0,0x00,0xaa,0x00,0x6d,0x00,0x0b,0x90,0x00,
+0xbf,0xef,0xc2,0x00,0x00,0x01,0x3d,0x03,0xa0,0x00,0x06,0xff,0xff,0xff,0x50,0x00,
+0x2c,0x00,0xe1,0xb1,0x03,0x12,0xf2,0x05,0x00,0x80,0x08,0xff,0xee,0xff,0xa0,0x00,
+0x11,0x22,0xcc,0x01,0x10,0x98,0x7f,0x04,0xa0,0xa9,0x11,0x10,0xbf,0xff,0xff,0xff,
+0xfb,0x00,0x5f,0xc5,0x04,0xa1,0x00,0x27,0x13,0x80,0x00,0x00,0x03,0xc0,0x5f,0x00,
+0x3e,0x00,0x30,0x40,0x00,0x01,0x77,0x03,0xc0,0xde,0xee,0xfe,0xee,0xf9,0x01,0x12,
+0x21,0x12,0x10,0x00,0x02,0x1b,0x03,0x00,0xed,0x00,0x10,0xe4,0x0b,0x00,0x22,0xfe,
+0x20,0x33,0x05,0x02,0x85,0x04,0x0f,0x74,0x00,0x0b,0xf0,0x12,0x13,0x11,0x20,0x00,
+0x00,0x1f,0x00,0xf1,0x00,0x12,0x3f,0x23,0xf3,0x21,0xbf,0xfe,0xee,0xff,0xfb,0x05,
+0xcc,0xcc,0xcc,0x50,0x01,0x36,0x33,0x73,0x00,0x00,0x3e,0x00,0xf1,0x05,0x00,0xd0,
+0xf2,0x00,0x06,0xdf,0xcc,0xfd,0x90,0x01,0x43,0x33,0x33,0x10,0x00,0x9f,0x00,0x10,
+0xbf,0x76,0x04,0x53,0x00,0x00,0x8a,0x00,0x00,0x05,0x00,0x10,0x89,0x05,0x00,0x13,
+0x77,0xe2,0x00,0x11,0x08,0x8e,0x00,0x82,0x4b,0x01,0xe0,0x00,0x00,0x5d,0x01,0xf0,
+0x05,0x00,0xa2,0x09,0xef,0xde,0xfe,0x70,0x01,0x22,0x22,0x11,0x00,0xae,0x03,0xa1,
+0x22,0x22,0x22,0x21,0xae,0xef,0xff,0xff,0xe9,0x04,0xc3,0x02,0xf1,0x05,0x27,0x11,
+0x70,0x00,0x00,0x3e,0x02,0xf0,0x00,0x06,0xef,0xee,0xff,0x50,0x00,0x21,0x11,0x11,
+0x00,0xaf,0xda,0x04,0x52,0x32,0x22,0x22,0x00,0x02,0xf4,0x00,0x31,0x11,0x1f,0x40,
+0xdd,0x00,0x65,0x03,0xf0,0x00,0x11,0x00,0x02,0xf9,0x03,0x00,0x90,0x01,0xf0,0x15,
+0x93,0xcc,0xcc,0xb1,0x7b,0x02,0x70,0x73,0x07,0xb0,0x5c,0x0c,0x60,0x6b,0x05,0xc0,
+0xc6,0x06,0xb0,0x5c,0x0c,0x50,0x6b,0x04,0xc0,0xc5,0x06,0xb1,0x8e,0x5e,0x93,0x6b,
+0x3a,0xba,0xaa,0x66,0xcf,0x01,0x50,0x6b,0x00,0x00,0x00,0x06,0x09,0x00,0xf0,0x11,
+0x25,0x04,0x44,0x44,0x06,0x92,0xcc,0xcb,0xa1,0x7b,0x03,0x70,0x92,0x07,0xb0,0x5c,
+0x0d,0x40,0x7b,0x05,0xc0,0xd4,0x07,0xa1,0x8d,0x5e,0x82,0x7a,0x3c,0xcb,0xba,0x67,
+0xee,0x02,0x70,0x7a,0x00,0x69,0x00,0x05,0x70,0x08,0x2f,0x00,0x8c,0x8b,0x11,0x11,
+0x10,0x06,0xff,0xff,0xea,0x24,0x03,0x02,0x36,0x00,0x00,0x24,0x03,0x60,0x7b,0x4f,
+0xff,0xee,0x87,0xa0,0x1f,0x00,0x0f,0x24,0x03,0x0c,0x30,0x73,0xdd,0xdd,0x24,0x03,
+0x12,0xc4,0x75,0x00,0x49,0x04,0xc0,0xd3,0x07,0x3b,0x02,0x1f,0x46,0x3b,0x02,0x06,
+0x00,0x01,0x00,0xf5,0x27,0x8f,0xda,0x00,0xc4,0x00,0x00,0x12,0x20,0x0c,0x50,0x0c,
+0xff,0xff,0xf4,0xc6,0x00,0x00,0x24,0x10,0x0c,0x60,0x00,0x5f,0xde,0x10,0xb7,0x10,
+0x0d,0x50,0xa8,0x0b,0xff,0x50,0xf1,0x06,0xa0,0xb6,0x00,0x0f,0x20,0x89,0x0b,0x60,
+0x00,0xba,0x4e,0x50,0xb6,0x00,0x01,0x9c,0x70,0x0c,0x60,0x74,0x04,0x32,0x0a,0x50,
+0x00,0xa3,0x01,0x01,0xfb,0x05,0xf2,0x14,0x5d,0xe8,0x00,0xe1,0x00,0x7a,0x99,0x98,
+0x0f,0x20,0x03,0x56,0x75,0x40,0xf2,0x00,0x09,0xed,0xb0,0x0f,0xa9,0x11,0xf0,0x0e,
+0x40,0xf9,0x71,0x1f,0x11,0xe3,0x0f,0x20,0x00,0x7e,0xe9,0xa5,0x05,0x70,0x05,0x00,
+0x00,0x4f,0xff,0xff,0xe0,0x93,0x06,0x11,0x1f,0x00,0x02,0x10,0xf1,0x16,0x00,0x28,
+0x0f,0x00,0x01,0x00,0xf0,0x1f,0x7f,0xd7,0x00,0xd1,0x00,0x13,0x56,0x41,0x0f,0x20,
+0x09,0xcc,0xcc,0xb0,0xf2,0x00,0x04,0xcc,0x50,0x0f,0x20,0x00,0xf3,0x1f,0x10,0xff,
+0xf2,0x2f,0x00,0xd3,0x0f,0x41,0x00,0xe7,0x6f,0x10,0xf2,0x00,0x02,0xaa,0x40,0x0f,
+0x20,0x00,0x08,0x10,0x57,0x02,0x10,0xf4,0xd7,0x00,0xd0,0x0f,0x51,0x11,0x10,0x00,
+0x00,0xcf,0xff,0xfe,0x30,0x00,0x02,0x42,0x48,0x00,0x10,0x4b,0x48,0x00,0xf1,0x1e,
+0x9b,0xbb,0xba,0x0f,0x20,0x02,0x48,0x84,0x30,0xf2,0x00,0x0d,0xba,0xe0,0x0f,0xff,
+0x22,0xf0,0x0d,0x40,0xf3,0x10,0x0e,0x97,0xe1,0x0f,0x20,0x00,0x16,0x71,0x00,0x80,
+0x00,0x02,0xdd,0xdd,0xed,0x10,0x00,0x03,0x33,0x33,0xf2,0x00,0x03,0x40,0x02,0x10,
+0x4f,0xe8,0x03,0x11,0x03,0xe6,0x02,0x0d,0xe2,0x00,0xf0,0x00,0xaa,0xa9,0x0f,0x20,
+0x01,0x37,0x84,0x20,0xf2,0x00,0x0b,0xba,0xd0,0x0f,0xfe,0x4d,0x00,0xa0,0xf4,0x20,
+0x1f,0x31,0xf3,0x0f,0x20,0x00,0x7f,0xf8,0x13,0x03,0x10,0x01,0x85,0x06,0xe1,0x0f,
+0xff,0xff,0xf2,0x00,0x01,0xf2,0x00,0x0f,0x20,0x00,0x1f,0x20,0x01,0x5b,0x05,0x1a,
+0xfe,0x48,0x00,0x10,0xa9,0x2a,0x01,0x14,0x57,0x2a,0x01,0x10,0xcb,0x2a,0x01,0x42,
+0xf7,0x50,0x1f,0x10,0x2a,0x01,0x00,0xd2,0x00,0x10,0x40,0x2a,0x01,0x10,0x1f,0xa3,
+0x05,0x10,0x01,0xa1,0x06,0x00,0x2d,0x01,0x14,0xf2,0x01,0x07,0x0f,0x90,0x00,0x06,
+0x11,0xff,0x90,0x00,0x30,0x10,0x1f,0x21,0x48,0x00,0x40,0x8f,0xfa,0x00,0xf2,0x90,
+0x00,0xa0,0x02,0x00,0x00,0x04,0xee,0xee,0x70,0x00,0x00,0xd7,0x10,0x08,0x90,0x0e,
+0x60,0x02,0xf2,0x00,0x00,0x5e,0xee,0xe8,0xd9,0x00,0x04,0xef,0x05,0xf0,0x22,0x08,
+0xba,0x40,0xa0,0xd1,0x01,0x45,0x20,0xf1,0xe3,0x9f,0xff,0xf9,0xe1,0xe3,0x00,0x45,
+0x00,0xe1,0xe3,0x09,0xdc,0xa0,0xe3,0xe3,0x0f,0x21,0xf1,0xed,0xf3,0x1f,0x00,0xf2,
+0xe1,0xe3,0x0f,0x21,0xf0,0xe1,0xe3,0x08,0xee,0x90,0xe1,0xe3,0x00,0x23,0x00,0xe1,
+0xf4,0x04,0x01,0x05,0x00,0x40,0x70,0xa1,0x00,0x20,0x8d,0x02,0xf1,0x29,0xde,0x70,
+0x93,0xa3,0x39,0x99,0x95,0xc5,0xb5,0x15,0x67,0x53,0xc5,0xb5,0x05,0xed,0xc0,0xcf,
+0xf5,0x0d,0x40,0xd3,0xc5,0xb5,0x0d,0x50,0xe3,0xc5,0xb5,0x05,0xfe,0xb0,0x93,0xb5,
+0x00,0x01,0x03,0x41,0x51,0x00,0x04,0xed,0xcf,0x90,0x00,0x0d,0x70,0x01,0xf3,0x00,
+0x0d,0x80,0x02,0xf3,0x00,0x03,0x99,0x00,0x19,0x01,0xd4,0x00,0xf3,0x0c,0x69,0x88,
+0x87,0x0f,0x31,0x04,0x67,0x77,0x60,0xff,0xe1,0x07,0xcc,0x90,0x0f,0x20,0x01,0xf0,
+0x0d,0x30,0xfd,0xc0,0x1f,0x31,0xe3,0x0f,0x53,0xd4,0x00,0x3b,0x00,0x11,0x08,0xd4,
+0x00,0x33,0x03,0xf1,0x00,0xea,0x08,0x05,0xd4,0x00,0xf0,0x22,0x4f,0xdc,0x00,0x2c,
+0x00,0x12,0x20,0x03,0xe9,0xff,0xff,0xf3,0x3e,0x00,0x14,0x20,0x03,0xe0,0x4f,0xcf,
+0x40,0x3e,0x0c,0x70,0x6c,0x8c,0xe0,0xf3,0x03,0xf3,0x6e,0x0e,0x40,0x5d,0x02,0xe0,
+0x8d,0x8e,0x70,0x2e,0x00,0x58,0x50,0x02,0xe0,0x00,0x00,0x00,0x3e,0x3d,0x00,0x20,
+0x90,0x00,0x3f,0x00,0xf0,0x16,0x2b,0xb9,0x00,0x1c,0x6d,0xdd,0xdd,0x12,0xf0,0x13,
+0x52,0x20,0x2f,0x06,0xff,0xe2,0x14,0xf0,0xe6,0x0b,0x8d,0xef,0x0e,0x40,0xa7,0x02,
+0xf0,0x5e,0xcd,0x10,0x2f,0x00,0x02,0x11,0x12,0x70,0x08,0x0e,0x09,0x80,0x9a,0x00,
+0x05,0xd0,0x09,0xa0,0x00,0x5d,0x9e,0x03,0xf0,0x5e,0xa0,0x00,0x64,0x30,0x00,0x10,
+0x08,0xaa,0x00,0x3e,0x6d,0xdd,0xdd,0x24,0xe0,0x13,0x63,0x20,0x4e,0x06,0xfe,0xf3,
+0x05,0xe0,0xe6,0x09,0xac,0xfe,0x0e,0x40,0x89,0x03,0xe0,0x6e,0xce,0x20,0x4e,0x00,
+0x12,0x11,0x11,0x80,0x00,0x8f,0xee,0xd3,0x00,0x4f,0x20,0x07,0xd0,0x04,0xf1,0x00,
+0x7d,0x00,0x09,0xfe,0xed,0x40,0x00,0x00,0x10,0x00,0x01,0x76,0x20,0x00,0x10,0x01,
+0x79,0x40,0x95,0xb5,0x5f,0xfe,0xe9,0xb6,0xc5,0x00,0x46,0x10,0xb6,0xc5,0x09,0xfe,
+0xd1,0xb6,0xc5,0x0e,0x40,0xdf,0xf6,0xc5,0x0b,0x84,0xf2,0xb6,0xc5,0x01,0x79,0x40,
+0x63,0x62,0x00,0x1d,0xdd,0xde,0xe2,0xaf,0x02,0x30,0xf4,0x00,0x1f,0x8c,0x06,0x46,
+0x3f,0x21,0x22,0x20,0xd1,0x0a,0x02,0x17,0x0b,0xf0,0x1f,0xfe,0xb0,0x03,0xd0,0x36,
+0x67,0x66,0x04,0xe0,0x48,0x88,0x88,0x13,0xe0,0x03,0xef,0xc1,0xce,0xe0,0x0c,0x70,
+0xc7,0x25,0xe0,0x0e,0x30,0x99,0x15,0xe0,0x0a,0xa4,0xe6,0xff,0xe0,0x00,0x8b,0x70,
+0x04,0xe0,0x00,0x15,0x00,0x04,0xd0,0x00,0x5e,0x6d,0x02,0x10,0x5e,0xf4,0x02,0xf4,
+0x32,0x3e,0xff,0xfe,0xd0,0x00,0x31,0x00,0x00,0x00,0x2c,0xeb,0x00,0x5a,0x49,0x99,
+0x98,0x16,0xc2,0x66,0x76,0x61,0x7c,0x04,0xee,0xc1,0xef,0xc0,0xe4,0x0b,0x70,0x6c,
+0x0e,0x60,0xc7,0xef,0xc0,0x5e,0xfc,0x10,0x7b,0x00,0x00,0x02,0x13,0x70,0x00,0xaf,
+0xde,0xd2,0x00,0x5e,0x10,0x09,0xa0,0x05,0xe1,0x00,0x9a,0x00,0x0a,0xfe,0xfd,0x20,
+0x00,0x00,0x7c,0x01,0xf0,0x0d,0x0e,0xed,0x80,0x00,0x02,0x44,0x55,0x43,0x10,0x07,
+0xbb,0xbb,0xbb,0x50,0x00,0x19,0xcc,0x80,0x00,0x00,0xc9,0x22,0xb9,0x00,0x00,0xe5,
+0x00,0x8a,0xa9,0x01,0x50,0xd2,0x00,0x00,0x00,0x54,0x29,0x00,0x22,0x99,0x00,0x9b,
+0x05,0x03,0xb8,0x00,0xf1,0x1d,0x42,0x10,0x00,0x00,0x06,0xbc,0xa0,0x00,0x01,0xdd,
+0xdd,0xdd,0x60,0x00,0x06,0xbb,0x70,0x00,0x00,0x5e,0x32,0xb9,0x00,0x00,0x5e,0x43,
+0xb9,0x00,0x00,0x06,0xce,0x70,0x00,0x6c,0xbb,0xde,0xbb,0xb9,0x14,0x55,0x56,0x55,
+0x42,0x01,0xa0,0x03,0x90,0x67,0x77,0x7e,0x60,0x01,0xf9,0x77,0x78,0x10,0xbd,0x08,
+0x13,0x90,0xb8,0x08,0x00,0x86,0x00,0xf0,0x21,0x09,0xee,0xa0,0x00,0x03,0x99,0x99,
+0x99,0x20,0x01,0x55,0x87,0x55,0x10,0x00,0x4e,0xcc,0xe3,0x00,0x00,0x9a,0x00,0xb8,
+0x00,0x00,0x2b,0xff,0xb2,0x00,0x46,0x66,0xbb,0x66,0x64,0x69,0x99,0x99,0x99,0x96,
+0x00,0x3a,0xdd,0xa2,0x00,0x00,0xf8,0x22,0x8e,0xa2,0x0a,0x63,0x4f,0x00,0x00,0x7f,
+0xee,0xe6,0x2e,0x0b,0x01,0xcb,0x00,0xf1,0x28,0x3e,0xfc,0x00,0x96,0x00,0x37,0x77,
+0x66,0x1a,0x70,0x04,0x88,0x88,0x81,0xa8,0x00,0x03,0xdf,0xc2,0x0a,0x80,0x00,0xd6,
+0x09,0x90,0x9b,0x51,0x0d,0x40,0x89,0x09,0xda,0x40,0x5e,0xde,0x20,0x98,0x00,0x00,
+0x06,0x00,0x09,0x80,0x00,0x02,0xf0,0x22,0xa8,0x00,0xaf,0xff,0xfd,0x9a,0x80,0x00,
+0x79,0x07,0x00,0x1e,0x06,0xf1,0x2e,0x50,0x00,0x00,0x86,0x40,0x01,0x00,0x00,0x07,
+0x97,0x00,0xe3,0x00,0x6e,0xee,0xee,0x1e,0x40,0x00,0x05,0x75,0x00,0xe4,0x00,0x0c,
+0xdb,0xe8,0x0e,0x51,0x00,0xe4,0x07,0xa0,0xef,0xe1,0x05,0xde,0xb2,0x0e,0x40,0x04,
+0x67,0xf7,0x86,0xe4,0x00,0x78,0x88,0x76,0x28,0x10,0x00,0x0c,0xdd,0xdd,0xd2,0x00,
+0x00,0x33,0x33,0x3f,0xd4,0x09,0x01,0x6c,0x08,0x60,0x0b,0x10,0x00,0x00,0x86,0x60,
+0x51,0x00,0xf1,0x1d,0x99,0x10,0x87,0x00,0x2e,0xee,0xee,0x88,0x80,0x00,0x06,0x97,
+0x10,0x89,0x00,0x08,0xc7,0xca,0x08,0x90,0x00,0xb5,0x06,0xd0,0x8f,0xe3,0x04,0xeb,
+0xe6,0x08,0x91,0x00,0x02,0xf3,0x34,0x88,0x00,0x6f,0xff,0xec,0x98,0x80,0x00,0x02,
+0x7d,0x0c,0x10,0xd5,0x19,0x05,0x20,0x0d,0x61,0x99,0x07,0x10,0xbf,0x22,0x01,0x20,
+0x01,0x75,0x90,0x00,0xf0,0x2c,0x08,0xa8,0x00,0xe3,0x00,0x8f,0xff,0xfe,0x2e,0x30,
+0x00,0x3a,0xb8,0x00,0xe3,0x00,0x0e,0x71,0xa8,0x0e,0xdc,0x00,0xd9,0x5c,0x70,0xe6,
+0x30,0x01,0x8f,0x60,0x0e,0x30,0x0b,0xdd,0xfd,0xf8,0xe3,0x00,0x23,0x44,0x32,0x15,
+0x00,0x00,0x0d,0xff,0xee,0xf6,0x00,0x00,0x67,0x77,0x8e,0x60,0x00,0x0f,0x87,0x77,
+0x72,0xc6,0x0b,0x23,0xff,0xc0,0x19,0x05,0x0c,0xdd,0x00,0x20,0x16,0x85,0xdd,0x00,
+0xf9,0x1b,0xb9,0xd8,0x0e,0x51,0x00,0xf2,0x08,0x90,0xef,0xe1,0x06,0xee,0xb2,0x0e,
+0x40,0x03,0x47,0xf5,0x74,0xe4,0x00,0x9b,0xbb,0xa8,0x3c,0x30,0x00,0x02,0x9d,0xdb,
+0x30,0x00,0x00,0xe9,0x22,0x7f,0x10,0x00,0x0e,0x50,0x02,0xf2,0xb5,0x03,0x11,0x01,
+0x77,0x0c,0x80,0xfb,0x00,0xb3,0x03,0x77,0x76,0x60,0xd5,0x71,0x01,0xf1,0x14,0xc5,
+0x00,0x4e,0xfc,0x10,0xc5,0x00,0xe4,0x0a,0x80,0xc5,0x00,0xf3,0x09,0x80,0xc5,0x00,
+0x6e,0xdd,0x10,0xc5,0x00,0x01,0x70,0x00,0xc5,0x00,0x03,0xf1,0x23,0xc5,0x0e,0xff,
+0xfe,0xc8,0x0a,0x0b,0x01,0x05,0x00,0x1f,0x83,0x7b,0x02,0x11,0xf0,0x06,0x6e,0xde,
 0xd2,0x00,0x00,0x38,0x11,0xa0,0x00,0x00,0x6c,0x01,0xf1,0x00,0xae,0xff,0xee,0xfe,
-0xe9,0x21,0x12,0x20,0x04,0x32,0xd3,0x06,0xc0,0xcd,0x60,0x00,0x05,0x99,0x99,0x98,
-0x20,0x03,0x66,0x77,0x66,0x93,0x16,0x10,0xc1,0x9d,0x16,0x10,0x98,0xeb,0x26,0x80,
-0xc7,0x00,0x00,0x2a,0xcc,0x80,0x00,0x23,0xcc,0x57,0x53,0x9d,0xdd,0xee,0xcc,0xc6,
-0xc4,0x17,0x01,0xe8,0x01,0x14,0x97,0x79,0x03,0xf1,0x1d,0xbd,0xc2,0x00,0x10,0x05,
-0x68,0x85,0x26,0xb0,0x1b,0xbb,0xbb,0x65,0xc0,0x03,0xce,0xd7,0x05,0xc0,0x09,0xa0,
-0x6e,0x05,0xc0,0x02,0xac,0xb5,0x05,0xc0,0x6b,0xbb,0xcd,0xe5,0xc0,0x14,0x7e,0x32,
-0x05,0xb0,0x00,0x15,0x11,0x12,0x10,0xbe,0x24,0xc5,0x00,0x38,0x88,0x8b,0xc0,0x00,
-0xac,0x77,0x77,0x30,0x00,0x8f,0x73,0x3a,0x03,0x8c,0x00,0x1a,0x50,0x8c,0x00,0x40,
-0xb1,0x00,0x00,0xe4,0xc1,0x02,0xf0,0x06,0xe8,0x23,0xd6,0x00,0x00,0x3a,0xcc,0x70,
-0x00,0x22,0x22,0x22,0x33,0x31,0xad,0xef,0xdc,0xfd,0xc6,0x00,0x8a,0x85,0x0a,0x01,
-0x05,0x00,0x15,0x78,0x26,0x28,0x10,0x33,0xaf,0x38,0xf1,0x18,0xcd,0x40,0x5a,0x1a,
-0xaa,0xaa,0x66,0xb0,0x46,0x98,0x53,0x6c,0x04,0xeb,0xcb,0x06,0xc0,0x99,0x01,0xf0,
-0x6c,0x04,0xe9,0xcb,0x06,0xc0,0x02,0x55,0x23,0x6c,0x6f,0xff,0xfe,0xb6,0xc0,0x03,
-0x10,0x00,0x38,0xd2,0x07,0x22,0x0c,0x71,0x15,0x40,0x12,0xb0,0xb1,0x26,0x60,0xa9,
-0x10,0x2c,0x00,0x35,0x50,0x3f,0x05,0xfb,0x11,0xf6,0x3e,0x00,0x26,0x30,0x03,0xe0,
+0xe9,0x01,0x11,0xfb,0x02,0x20,0x04,0x32,0xd3,0x06,0xf0,0x05,0xcd,0x60,0x00,0x05,
+0x99,0x99,0x98,0x20,0x03,0x66,0x77,0x66,0x10,0x00,0x5e,0xee,0xc1,0x00,0x00,0xe6,
+0xcb,0x01,0xf1,0x04,0xd9,0x23,0xc7,0x00,0x00,0x2a,0xcc,0x80,0x00,0x23,0x33,0x33,
+0x33,0x42,0x9d,0xdd,0xee,0xcc,0xc6,0xbc,0x02,0x03,0xe8,0x01,0x14,0x97,0x79,0x03,
+0xf0,0x1d,0xbd,0xc2,0x00,0x10,0x05,0x68,0x85,0x26,0xb0,0x1b,0xbb,0xbb,0x65,0xc0,
+0x03,0xce,0xd7,0x05,0xc0,0x09,0xa0,0x6e,0x05,0xc0,0x02,0xac,0xb5,0x05,0xc0,0x6b,
+0xbb,0xcd,0xe5,0xc0,0x14,0x7e,0x32,0x05,0xb0,0x00,0x15,0x11,0x12,0x10,0x34,0x04,
+0xb0,0xb0,0x00,0x38,0x88,0x8b,0xc0,0x00,0xac,0x77,0x77,0x30,0x0f,0x00,0x12,0xe0,
+0x46,0x00,0x03,0x8c,0x00,0x1a,0x50,0x8c,0x00,0x40,0xb1,0x00,0x00,0xe4,0xc1,0x02,
+0xf0,0x06,0xe8,0x23,0xd6,0x00,0x00,0x3a,0xcc,0x70,0x00,0x22,0x22,0x22,0x33,0x31,
+0xad,0xef,0xdc,0xfd,0xc6,0x00,0x8a,0x85,0x0a,0x01,0x05,0x00,0x33,0x78,0x00,0xd2,
+0x8c,0x00,0xf1,0x1d,0x33,0x20,0x00,0x00,0x07,0xcd,0x40,0x5a,0x1a,0xaa,0xaa,0x66,
+0xb0,0x46,0x98,0x53,0x6c,0x04,0xeb,0xcb,0x06,0xc0,0x99,0x01,0xf0,0x6c,0x04,0xe9,
+0xcb,0x06,0xc0,0x02,0x55,0x23,0x6c,0x6f,0xff,0xfe,0xb6,0xc0,0x03,0x10,0x00,0x38,
+0xd2,0x07,0x40,0x0c,0x71,0x11,0x10,0x8e,0x03,0x11,0xb0,0x3f,0x00,0x70,0x4c,0xa9,
+0x10,0x2c,0x00,0x35,0x50,0x3f,0x05,0xf1,0x11,0xf6,0x3e,0x00,0x26,0x30,0x03,0xe0,
 0x4e,0xaf,0x40,0x3f,0x0c,0x60,0x7b,0x03,0xf0,0xe2,0x04,0xd0,0x3f,0x0d,0x50,0x7b,
-0x03,0xf0,0x5e,0x9e,0x40,0x2f,0x00,0x36,0x20,0x15,0x45,0x03,0x3c,0x03,0x20,0x16,
-0xaf,0x5b,0x14,0x10,0x7c,0x73,0x0a,0x10,0x06,0x3d,0x2b,0x10,0xf0,0x98,0x1d,0x20,
-0xfe,0xac,0x07,0x00,0x90,0xd8,0x30,0x09,0xf0,0x00,0x0b,0xf1,0x00,0x00,0x07,0x00,
-0x1b,0xe0,0x07,0x00,0xf0,0x05,0x3d,0xff,0xf0,0x03,0x6c,0xe0,0x00,0xcf,0xff,0xf0,
-0xaf,0xff,0xe0,0x00,0x5f,0xff,0x80,0xdf,0xff,0xd0,0xa5,0x32,0x22,0x2a,0xda,0x53,
-0x63,0x00,0x30,0x14,0xa0,0x40,0x8f,0xdf,0xb7,0x77,0x77,0xfe,0xdf,0xd0,0xc7,0x35,
-0x0e,0xf0,0x0c,0xde,0x8e,0x70,0x00,0x00,0xdb,0x8e,0xe5,0xdb,0x77,0x77,0x7f,0x95,
-0xed,0x1c,0xeb,0xbb,0xbb,0xf6,0x1d,0xfc,0xf7,0x00,0x00,0x0d,0xdc,0xfd,0x92,0x3f,
-0xa0,0xd5,0x0d,0xfa,0xe9,0x33,0x33,0x3e,0xca,0xfc,0x3d,0x5a,0x41,0xc0,0x3c,0x35,
-0x52,0x05,0x55,0x55,0x55,0x3f,0xff,0xc6,0xff,0xff,0x8c,0x38,0x10,0x6f,0x05,0x00,
-0xcf,0xee,0x94,0xee,0xee,0xee,0xec,0x34,0x42,0x04,0x44,0x44,0x44,0x1a,0x00,0x14,
-0x44,0xfd,0xff,0xa4,0xff,0xfa,0x26,0x11,0x29,0xf1,0x00,0x21,0x2e,0xfc,0x06,0x00,
-0x31,0xff,0x90,0x50,0x06,0x00,0x20,0xaf,0xc0,0x06,0x00,0xa0,0x0c,0xff,0xc0,0x2e,
-0xff,0x90,0x00,0x1c,0xff,0xce,0x9f,0x04,0x12,0x1c,0xa5,0x04,0x12,0x1c,0xab,0x04,
-0x14,0x0b,0x4e,0x32,0xf0,0x07,0x09,0xf5,0x00,0x06,0xf8,0xdf,0xf5,0x06,0xff,0xc2,
-0xef,0xf9,0xff,0xd1,0x02,0xef,0xff,0xd1,0x00,0x08,0xff,0xf7,0x69,0x0b,0xf1,0x04,
-0xf5,0x06,0xff,0xe4,0xef,0xf5,0xef,0xe1,0x02,0xef,0xd4,0xa1,0x00,0x02,0xb4,0x00,
-0x00,0x02,0x50,0x6e,0x0c,0xf0,0x1e,0xbf,0x40,0x30,0x00,0x01,0xcf,0x1b,0xf4,0x7f,
-0x80,0x00,0xbf,0xd0,0xbf,0x45,0xff,0x40,0x4f,0xe1,0x0b,0xf4,0x07,0xfd,0x09,0xf8,
-0x00,0xbf,0x40,0x0e,0xf2,0xcf,0x40,0x0b,0xf4,0x00,0xbf,0x4b,0xf4,0x00,0x9e,0x30,
-0x0b,0xf4,0x9f,0x80,0x85,0x4e,0x10,0x23,0x9b,0x4e,0xc0,0x8f,0xc0,0x0a,0xfe,0x40,
-0x01,0x8f,0xf4,0x00,0x0c,0xff,0xed,0x30,0x06,0x41,0x07,0xef,0xff,0xc3,0x41,0x0b,
-0x02,0xb8,0x05,0x11,0x21,0x06,0x00,0x01,0xdf,0x0c,0xd1,0x10,0x3f,0xff,0x70,0x11,
-0x00,0x7f,0xbf,0xff,0xff,0xce,0xb0,0x1f,0xf5,0x00,0xa0,0x53,0xff,0xff,0x82,0x5f,
-0xff,0xf7,0x03,0xff,0xc0,0xe9,0x08,0xf1,0x06,0x3f,0xfa,0x00,0x06,0xff,0x70,0x2c,
-0xff,0xf4,0x01,0xdf,0xfe,0x42,0xff,0xff,0xfe,0xff,0xff,0xf6,0x0a,0xff,0x10,0x01,
-0x50,0x05,0x07,0xff,0xfa,0x13,0xd7,0x79,0x02,0x4e,0x26,0x12,0x46,0x44,0x09,0x40,
-0x25,0x00,0x36,0x20,0x94,0x07,0x30,0xfc,0x1a,0xf6,0xe0,0x09,0xf0,0x15,0xe9,0xfe,
-0xcf,0x60,0x00,0x00,0xaf,0xc3,0x64,0xff,0xf6,0x00,0x01,0xcf,0xa3,0xef,0xa3,0xdf,
-0x90,0x03,0xef,0x75,0xff,0xff,0xc3,0xcf,0xb0,0xdf,0x48,0xff,0xff,0xff,0xe3,0x9f,
-0x72,0x27,0x4f,0x00,0xe0,0xf2,0x50,0x00,0x9f,0xff,0xcb,0xef,0xff,0x30,0x00,0x09,
-0xff,0xf1,0x07,0x9a,0x00,0xd0,0x9f,0xff,0x10,0x7f,0xff,0x30,0x00,0x07,0xff,0xe0,
-0x06,0xff,0xf2,0x2c,0x03,0x22,0x54,0x00,0xa4,0x63,0x12,0x10,0x96,0x2f,0x1d,0x20,
-0x07,0x00,0x50,0x47,0x8f,0xff,0x87,0x40,0x39,0x00,0x01,0x7c,0x01,0x13,0x0a,0x6d,
-0x06,0x10,0xaf,0x3a,0x74,0xf2,0x03,0x46,0x66,0x3a,0xfa,0x36,0x66,0x50,0xff,0xff,
-0xf4,0x54,0xff,0xff,0xf2,0xff,0xff,0xff,0xcf,0x07,0x00,0x60,0xff,0xf3,0xb8,0xf2,
-0x9b,0xbb,0x01,0x00,0x71,0xa0,0x00,0x08,0xaa,0xaa,0xaa,0xa4,0x8f,0x60,0x00,0xd4,
-0x09,0x20,0x03,0xfb,0x58,0x00,0x40,0xd0,0x00,0xdf,0x10,0x20,0x46,0x31,0x80,0x8f,
-0x60,0x5c,0x1b,0xf0,0x00,0x3f,0xfe,0xee,0x40,0x00,0x9e,0xee,0xf9,0xff,0xff,0xfc,
-0x44,0x5f,0xff,0xff,0xd2,0x06,0x00,0xd5,0x06,0x12,0xff,0x01,0x00,0x12,0x9a,0x07,
-0x00,0x11,0xf5,0x19,0x03,0xf1,0x0e,0x07,0x90,0x00,0x6d,0xff,0xfb,0x40,0xcf,0x00,
-0xbf,0xfd,0xbd,0xff,0xac,0xf0,0xbf,0xd3,0x00,0x03,0xcf,0xff,0x4f,0xd1,0x00,0x07,
-0xaa,0xff,0xf9,0xf5,0x0d,0x07,0x25,0x01,0x00,0xde,0x4c,0x03,0x3a,0x5d,0xf0,0x0b,
-0x4f,0x9f,0xff,0xab,0x70,0x00,0x0d,0xf4,0xff,0xfb,0x20,0x00,0x3c,0xfb,0x0f,0xcb,
-0xff,0xca,0xcf,0xfc,0x10,0xfc,0x05,0xcf,0xff,0xd7,0x96,0x3a,0x02,0xbd,0x01,0x80,
-0x05,0x20,0x00,0x06,0xf7,0x01,0x16,0xff,0x21,0x7b,0x24,0xff,0xff,0x07,0x00,0xb2,
-0x8a,0xcc,0xef,0xf8,0x00,0x02,0xef,0x80,0x00,0x02,0xe7,0x60,0x05,0x31,0x04,0x20,
-0x00,0x2f,0x80,0x40,0x01,0x16,0xff,0x80,0x2b,0x11,0x20,0x82,0xb1,0xe1,0x44,0x10,
-0xc9,0x05,0x00,0xe0,0x9b,0xff,0xff,0xff,0x82,0xf3,0xbd,0xdf,0xff,0x80,0x10,0x00,
-0x03,0xef,0x35,0x02,0x13,0x3e,0xff,0x45,0x08,0x01,0x00,0x22,0x04,0xc2,0x6d,0x00,
-0x30,0x0b,0xe1,0x00,0x25,0x81,0x30,0xb7,0x0c,0xb0,0x4b,0x00,0xb0,0x05,0xf5,0x2f,
-0x3f,0xff,0xff,0xf8,0x2c,0x17,0xd0,0xb8,0x4b,0x00,0xb1,0xba,0x2f,0x18,0xbf,0xff,
-0xff,0xf8,0x09,0xb1,0xf2,0x7b,0x55,0x00,0x30,0x5e,0x0a,0x9a,0x89,0x00,0x30,0x2e,
-0x80,0xe4,0x8d,0x00,0x40,0x0c,0xa0,0x8d,0x00,0x91,0x00,0x22,0x10,0x7f,0x78,0x52,
-0x24,0x4f,0x40,0x36,0x04,0x11,0x9f,0x29,0x01,0x41,0x9f,0xf9,0xbf,0xff,0x04,0x45,
-0x20,0xdf,0xff,0x4d,0x00,0x90,0x0d,0xff,0xf8,0xaf,0xff,0xff,0x9b,0xff,0xf8,0x1d,
-0x01,0x20,0x6d,0xf8,0xe1,0x0b,0x20,0x40,0x17,0xc9,0x01,0x11,0xa0,0xc8,0x01,0x72,
-0xfd,0xaa,0xaa,0xaa,0xaa,0xad,0xfa,0x72,0x01,0x02,0x09,0x78,0x00,0x82,0x77,0x20,
-0x0c,0xfb,0x82,0x18,0x10,0xf3,0xae,0x06,0x10,0xc0,0x5b,0x05,0x10,0x70,0x08,0x7f,
-0x10,0x2a,0x77,0x12,0xf0,0x04,0xef,0xef,0xff,0xff,0xdf,0xb7,0xff,0xff,0xfe,0xce,
-0x2d,0xff,0xff,0xb5,0xfc,0x36,0xff,0xf3,0x07,0x3d,0x09,0xf0,0x11,0x02,0x89,0x72,
-0x00,0x06,0x40,0x00,0x02,0x42,0xfa,0x00,0x03,0xef,0x2f,0xa0,0x04,0xff,0xf2,0xfa,
-0x05,0xff,0xff,0x2f,0xa6,0xff,0xff,0xf2,0xfe,0xff,0xff,0xff,0x2f,0xff,0x01,0xf2,
-0x07,0xfc,0xdf,0xff,0xff,0x2f,0xa1,0xdf,0xff,0xf2,0xfa,0x01,0xcf,0xff,0x2f,0xa0,
-0x00,0xbf,0xf2,0xf9,0x00,0x00,0x9c,0x68,0x39,0x02,0xc2,0x46,0x12,0xc3,0xb5,0x01,
-0x00,0x00,0x11,0x02,0x54,0x0e,0x00,0x14,0x03,0x21,0x40,0x00,0x9d,0x00,0x21,0x10,
-0xff,0x44,0x02,0x11,0xff,0x61,0x02,0x00,0x05,0x00,0x21,0xfe,0x50,0xe1,0x00,0x00,
-0x1e,0x00,0x10,0xb2,0x2a,0x00,0x00,0xfa,0x32,0x02,0x40,0x32,0x11,0x48,0xd4,0x01,
-0xff,0x03,0x26,0x66,0x10,0x16,0x66,0x30,0xef,0xff,0xc0,0xaf,0xff,0xf1,0xff,0xff,
-0xe0,0xbf,0xff,0xf2,0x06,0x00,0x19,0xb0,0xd0,0xbf,0xff,0xf2,0xaf,0xff,0x80,0x6e,
-0xff,0xc0,0x26,0x07,0x76,0x30,0x50,0xef,0xff,0x13,0x76,0x01,0x7e,0x00,0x1f,0xf6,
-0x06,0x00,0x1c,0x11,0xf5,0xd2,0x02,0xf3,0x09,0xd1,0x05,0x00,0x00,0x06,0x45,0xfb,
-0x00,0x01,0xfc,0x6f,0xfc,0x10,0x1f,0xc6,0xff,0xfd,0x11,0xfc,0x6f,0xff,0xfd,0x3f,
-0xc6,0x12,0x05,0x00,0x1d,0x05,0xf5,0x05,0xfa,0xfc,0x6f,0xff,0xf7,0x1f,0xc6,0xff,
-0xf6,0x01,0xfc,0x6f,0xf5,0x00,0x1f,0xc3,0xe4,0x00,0x00,0xfb,0x54,0x45,0x02,0xfa,
-0x13,0x11,0xe2,0xd5,0x21,0x22,0xff,0xd1,0x0c,0x3e,0x10,0xd1,0xcb,0x16,0x00,0x50,
-0x08,0x10,0x5f,0x62,0x00,0x21,0xb0,0x0e,0x6f,0x00,0xa0,0x40,0x8e,0xee,0xee,0xee,
-0xee,0xc1,0x02,0x44,0x44,0x20,0x39,0x02,0x82,0x00,0x11,0x0f,0x07,0x00,0x30,0x60,
-0xcf,0xff,0x1e,0x04,0x01,0x63,0x06,0x00,0xd1,0x7d,0xa1,0x00,0xbf,0xf2,0x00,0x0b,
-0xff,0x30,0x00,0xbf,0xf3,0x07,0x00,0x50,0x2f,0xf9,0x00,0x00,0x06,0xc6,0x28,0x24,
-0x6f,0xf8,0x09,0x00,0x60,0xf4,0x00,0x00,0x05,0xb0,0x01,0x9e,0x4f,0x50,0xc0,0x00,
-0x00,0x1e,0xfc,0xf7,0x1d,0x12,0xc0,0xab,0x05,0x01,0x09,0x00,0x20,0x7f,0xf4,0xc8,
-0x04,0x31,0x00,0x6f,0xf7,0x07,0x00,0x00,0xd9,0x7e,0x21,0x0a,0x70,0x78,0x39,0x11,
-0x40,0x22,0x0f,0x1f,0xe0,0x06,0x00,0x01,0x15,0xdf,0xc1,0x01,0x8f,0xff,0xf5,0x36,
-0x66,0xbf,0xf6,0x66,0x50,0x2a,0x00,0x01,0x00,0x7a,0x79,0x02,0x93,0x34,0x08,0x30,
-0x00,0xc0,0x35,0x55,0x55,0x55,0x55,0x40,0x00,0x00,0x5a,0xcd,0xc8,0x20,0xc2,0x26,
-0xf0,0x28,0xd7,0x69,0xff,0x90,0x00,0x04,0xff,0xa0,0x01,0x02,0xef,0xc1,0x02,0xff,
-0xf1,0x02,0xfc,0x16,0xff,0xb0,0xcf,0xfb,0x05,0xaf,0xf9,0x1f,0xff,0x6d,0xff,0xb1,
-0xff,0xff,0xb1,0xff,0xf7,0x4f,0xfe,0x0b,0xff,0xf5,0x5f,0xfc,0x00,0x6f,0xf9,0x08,
-0xa5,0x1d,0xfd,0x20,0x00,0x5e,0xfb,0x53,0x6e,0x2f,0x4f,0x74,0x07,0xce,0xfe,0xa4,
-0x00,0x00,0x32,0x72,0x0b,0x14,0xf5,0x13,0x3c,0x50,0xf9,0x05,0xac,0xdb,0x71,0x2d,
-0x63,0x60,0xff,0xfd,0x76,0xaf,0xf7,0x00,0xbb,0x04,0xf0,0x1b,0x31,0x30,0x4f,0xfa,
-0x00,0x00,0x32,0x04,0xef,0xbf,0xc0,0x9f,0xf8,0x00,0x0e,0xf5,0x02,0xcf,0xff,0x64,
-0xff,0xf3,0x01,0xff,0xf6,0x00,0x9f,0xf8,0x4f,0xff,0x40,0x06,0xff,0xc0,0x00,0x6f,
-0xeb,0xff,0xa0,0x00,0x09,0xff,0x2f,0x17,0x10,0xc0,0x86,0x21,0x30,0xa4,0x30,0x1b,
-0x65,0x00,0x73,0x02,0x8d,0xff,0x80,0x08,0xfe,0x30,0xfc,0x03,0x23,0xef,0x20,0x62,
-0x0b,0x14,0x70,0xb0,0x7b,0x00,0xb5,0x15,0x23,0xf8,0x00,0x3d,0x16,0x13,0x20,0xd0,
-0x6b,0x12,0xa0,0x64,0x6c,0x02,0x7c,0x4e,0x41,0x3f,0xf5,0x1a,0xfd,0xf7,0x28,0x20,
-0xf4,0x0a,0x6b,0x1a,0x60,0x05,0xff,0xf5,0x0a,0xff,0xe1,0x90,0x1c,0x40,0xf6,0x0b,
-0xff,0xf9,0x04,0x02,0x40,0xfd,0x8f,0xff,0xff,0x4b,0x1c,0x50,0xf3,0x09,0xff,0xff,
-0xb0,0xe2,0x3d,0x52,0x1c,0xff,0xff,0xf4,0x0e,0x34,0x05,0x40,0xf8,0x04,0x9a,0xaa,
-0x01,0x00,0x11,0x91,0x5a,0x00,0x02,0xa3,0x11,0x60,0x3f,0xa0,0xef,0xfa,0x00,0x05,
-0x66,0x05,0xf0,0x02,0xf9,0x04,0xff,0xff,0xfb,0x11,0x3f,0xa4,0xff,0x84,0xfc,0x00,
-0x00,0x33,0xff,0x90,0x19,0xd5,0x01,0xd0,0xa2,0x01,0x70,0x00,0x02,0xef,0xa4,0xf6,
-0x3f,0xa0,0xef,0xff,0xb0,0x8d,0x05,0x00,0xdd,0x00,0x20,0xff,0xfb,0x51,0x05,0x22,
-0x14,0xfc,0x45,0x30,0x05,0xd6,0x04,0x20,0x5f,0xa0,0xcd,0x04,0x01,0x11,0x06,0x40,
-0x5f,0xfa,0xff,0xa0,0xed,0x86,0xf0,0x01,0x3f,0xfa,0x00,0x4f,0xf9,0x00,0x03,0xff,
-0xa0,0xbf,0x90,0x00,0x00,0x3f,0xf1,0x15,0x96,0x0c,0x12,0x30,0x61,0x57,0xf0,0x08,
-0x9f,0x50,0x00,0x00,0x1d,0xe1,0x8f,0xf5,0x00,0x01,0xdf,0xd0,0x08,0xff,0x50,0x1d,
-0xfd,0x10,0x00,0x8f,0xf6,0xdf,0xd1,0x61,0x01,0x20,0xfd,0x10,0xf8,0x01,0x02,0x56,
-0x79,0x10,0x10,0x3e,0x82,0x13,0x10,0x14,0x01,0x21,0xfd,0x18,0xe2,0x03,0xf0,0x04,
+0x03,0xf0,0x5e,0x9e,0x40,0x2f,0x00,0x36,0x20,0x14,0x0e,0x12,0x2f,0x3f,0x05,0x24,
+0x00,0x00,0x3c,0x03,0x90,0x16,0xaf,0xf0,0x00,0x00,0x03,0x7c,0xff,0xff,0x88,0x09,
+0x10,0xff,0x07,0x00,0x50,0x0b,0xff,0xff,0xfe,0xac,0x07,0x00,0x90,0xd8,0x30,0x09,
+0xf0,0x00,0x0b,0xf1,0x00,0x00,0x07,0x00,0x1b,0xe0,0x07,0x00,0xf0,0x10,0x3d,0xff,
+0xf0,0x03,0x6c,0xe0,0x00,0xcf,0xff,0xf0,0xaf,0xff,0xe0,0x00,0x5f,0xff,0x80,0xdf,
+0xff,0xd0,0x00,0x00,0x21,0x00,0x2a,0xda,0x20,0x00,0x00,0x00,0x00,0xf0,0x3c,0x80,
+0x9c,0xcc,0xcc,0xcc,0x40,0x8f,0xdf,0xb7,0x77,0x77,0xfe,0xdf,0xd0,0xc7,0x00,0x00,
+0x0d,0x50,0xde,0x8e,0x70,0x00,0x00,0xdb,0x8e,0xe5,0xdb,0x77,0x77,0x7f,0x95,0xed,
+0x1c,0xeb,0xbb,0xbb,0xf6,0x1d,0xfc,0xf7,0x00,0x00,0x0d,0xdc,0xfd,0x0c,0x70,0x00,
+0x00,0xd5,0x0d,0xfa,0xe9,0x33,0x33,0x3e,0xca,0xfc,0x3d,0xff,0xff,0xff,0xf8,0x3c,
+0x35,0x52,0x05,0x55,0x55,0x55,0x3f,0xff,0xc6,0xff,0x01,0x00,0x20,0xfc,0x6f,0x05,
+0x00,0xcf,0xee,0x94,0xee,0xee,0xee,0xec,0x34,0x42,0x04,0x44,0x44,0x44,0x1a,0x00,
+0x14,0x30,0xfd,0xff,0xa4,0x06,0x00,0x10,0x00,0x01,0x00,0x20,0x29,0x10,0x06,0x00,
+0x21,0x2e,0xfc,0x06,0x00,0x31,0xff,0x90,0x50,0x06,0x00,0x20,0xaf,0xc0,0x06,0x00,
+0xf0,0x01,0x0c,0xff,0xc0,0x2e,0xff,0x90,0x00,0x1c,0xff,0xce,0xff,0x90,0x00,0x00,
+0x1c,0xff,0x06,0x00,0x21,0x00,0x1c,0x06,0x00,0x42,0x00,0x0b,0x90,0x00,0x01,0x00,
+0xf0,0x1e,0x09,0xf5,0x00,0x06,0xf8,0xdf,0xf5,0x06,0xff,0xc2,0xef,0xf9,0xff,0xd1,
+0x02,0xef,0xff,0xd1,0x00,0x08,0xff,0xf7,0x00,0x06,0xff,0xff,0xf5,0x06,0xff,0xe4,
+0xef,0xf5,0xef,0xe1,0x02,0xef,0xd4,0xa1,0x00,0x02,0xb4,0x00,0x00,0x02,0x50,0x31,
+0x00,0xf0,0x3c,0x20,0xbf,0x40,0x30,0x00,0x01,0xcf,0x1b,0xf4,0x7f,0x80,0x00,0xbf,
+0xd0,0xbf,0x45,0xff,0x40,0x4f,0xe1,0x0b,0xf4,0x07,0xfd,0x09,0xf8,0x00,0xbf,0x40,
+0x0e,0xf2,0xcf,0x40,0x0b,0xf4,0x00,0xbf,0x4b,0xf4,0x00,0x9e,0x30,0x0b,0xf4,0x9f,
+0x80,0x00,0x00,0x00,0xff,0x23,0xff,0x20,0x00,0x00,0x8f,0xc0,0x0a,0xfe,0x40,0x01,
+0x8f,0xf4,0x00,0x0c,0xff,0xed,0xff,0xf6,0x00,0x00,0x07,0xef,0xff,0xc3,0x4f,0x00,
+0x21,0x12,0x10,0x87,0x00,0x11,0x21,0x06,0x00,0xf1,0x03,0xff,0xf3,0x00,0x00,0x00,
+0x10,0x3f,0xff,0x70,0x11,0x00,0x7f,0xbf,0xff,0xff,0xce,0xb0,0x1f,0xf5,0x00,0xf1,
+0x14,0x53,0xff,0xff,0x82,0x5f,0xff,0xf7,0x03,0xff,0xc0,0x00,0x7f,0xf8,0x00,0x3f,
+0xfa,0x00,0x06,0xff,0x70,0x2c,0xff,0xf4,0x01,0xdf,0xfe,0x42,0xff,0xff,0xfe,0xff,
+0xff,0xf6,0x0a,0xff,0x10,0x01,0xb0,0x05,0x07,0xff,0xfa,0x13,0x20,0x00,0x00,0x0f,
+0xff,0x40,0x4e,0x00,0x21,0x46,0x50,0x55,0x00,0xf0,0x24,0x25,0x00,0x36,0x20,0x00,
+0x00,0x00,0x4f,0xfc,0x1a,0xf6,0x00,0x00,0x00,0x7f,0xe9,0xfe,0xcf,0x60,0x00,0x00,
+0xaf,0xc3,0x64,0xff,0xf6,0x00,0x01,0xcf,0xa3,0xef,0xa3,0xdf,0x90,0x03,0xef,0x75,
+0xff,0xff,0xc3,0xcf,0xb0,0xdf,0x48,0xff,0xff,0xff,0xe3,0x9f,0x72,0x27,0x4f,0x00,
+0xe0,0xf2,0x50,0x00,0x9f,0xff,0xcb,0xef,0xff,0x30,0x00,0x09,0xff,0xf1,0x07,0x9a,
+0x00,0xf1,0x03,0x9f,0xff,0x10,0x7f,0xff,0x30,0x00,0x07,0xff,0xe0,0x06,0xff,0xf2,
+0x00,0x00,0x00,0x04,0x54,0x60,0x00,0x21,0x1f,0xff,0xc3,0x00,0x3d,0x2f,0xff,0x20,
+0x07,0x00,0x50,0x47,0x8f,0xff,0x87,0x40,0x39,0x00,0x01,0x7c,0x01,0x40,0x0a,0xff,
+0xff,0xfa,0x1c,0x00,0xf2,0x08,0xaf,0xff,0xa0,0x00,0x00,0x46,0x66,0x3a,0xfa,0x36,
+0x66,0x50,0xff,0xff,0xf4,0x54,0xff,0xff,0xf2,0xff,0xff,0xff,0xcf,0x07,0x00,0x60,
+0xff,0xf3,0xb8,0xf2,0x9b,0xbb,0x01,0x00,0xa1,0xa0,0x00,0x08,0xaa,0xaa,0xaa,0xa4,
+0x00,0x00,0x08,0x8f,0x00,0x30,0x00,0x03,0xfb,0x58,0x00,0x30,0xd0,0x00,0xdf,0x6f,
+0x00,0x40,0x6f,0x80,0x8f,0x60,0x4c,0x00,0xf1,0x03,0xbf,0x3f,0xfe,0xee,0x40,0x00,
+0x9e,0xee,0xf9,0xff,0xff,0xfc,0x44,0x5f,0xff,0xff,0xaf,0xff,0x01,0x00,0x22,0xfa,
+0xff,0x01,0x00,0x12,0x9a,0x07,0x00,0x10,0xf5,0x57,0x01,0xf0,0x0f,0x00,0x07,0x90,
+0x00,0x6d,0xff,0xfb,0x40,0xcf,0x00,0xbf,0xfd,0xbd,0xff,0xac,0xf0,0xbf,0xd3,0x00,
+0x03,0xcf,0xff,0x4f,0xd1,0x00,0x07,0xaa,0xff,0xf9,0xf5,0x97,0x00,0x82,0xff,0x01,
+0x00,0x00,0x00,0x11,0x11,0x10,0x1a,0x02,0x01,0xae,0x00,0xf3,0x0e,0x4f,0x9f,0xff,
+0xab,0x70,0x00,0x0d,0xf4,0xff,0xfb,0x20,0x00,0x3c,0xfb,0x0f,0xcb,0xff,0xca,0xcf,
+0xfc,0x10,0xfc,0x05,0xcf,0xff,0xd7,0x00,0x09,0x70,0xbd,0x01,0xe4,0x05,0x20,0x00,
+0x06,0xf7,0x01,0x16,0xff,0x8f,0xff,0xff,0xf8,0xff,0xff,0x07,0x00,0xe0,0x8a,0xcc,
+0xef,0xf8,0x00,0x02,0xef,0x80,0x00,0x02,0xe7,0x00,0x00,0x01,0x2f,0x01,0x10,0x20,
+0xb8,0x00,0xf0,0x02,0x70,0x00,0x01,0x16,0xff,0x80,0x00,0xef,0xff,0xff,0x82,0xb1,
+0xff,0xff,0xff,0x80,0xc9,0x05,0x00,0xe0,0x9b,0xff,0xff,0xff,0x82,0xf3,0xbd,0xdf,
+0xff,0x80,0x10,0x00,0x03,0xef,0x35,0x02,0x32,0x3e,0x70,0x00,0x36,0x00,0x07,0x01,
+0x00,0x22,0x04,0xc2,0x6d,0x00,0xa0,0x0b,0xe1,0x00,0x00,0x06,0xf7,0x00,0xb7,0x0c,
+0xb0,0x4b,0x00,0xb0,0x05,0xf5,0x2f,0x3f,0xff,0xff,0xf8,0x2c,0x17,0xd0,0xb8,0x4b,
+0x00,0xb1,0xba,0x2f,0x18,0xbf,0xff,0xff,0xf8,0x09,0xb1,0xf2,0x7b,0x55,0x00,0x30,
+0x5e,0x0a,0x9a,0x89,0x00,0x30,0x2e,0x80,0xe4,0x8d,0x00,0x40,0x0c,0xa0,0x8d,0x00,
+0x91,0x00,0x31,0x10,0x7f,0x30,0x5f,0x00,0x11,0x4f,0x29,0x02,0x00,0x1d,0x01,0x11,
+0x9f,0x29,0x01,0x40,0x9f,0xf9,0xbf,0xff,0xaa,0x03,0x30,0x00,0xdf,0xff,0x4d,0x00,
+0x90,0x0d,0xff,0xf8,0xaf,0xff,0xff,0x9b,0xff,0xf8,0x1d,0x01,0x80,0x6d,0xf8,0x00,
+0x00,0xcf,0xff,0x40,0x17,0xc9,0x01,0x11,0xa0,0xc8,0x01,0x61,0xfd,0xaa,0xaa,0xaa,
+0xaa,0xad,0x6c,0x01,0x00,0x2c,0x01,0x10,0x40,0xe0,0x00,0x80,0x50,0x00,0x00,0x0c,
+0xfb,0x00,0x00,0x03,0x31,0x02,0xf0,0x39,0xdf,0xff,0xc0,0x00,0x8f,0xff,0xff,0x70,
+0x2f,0xff,0xff,0xff,0x2a,0xff,0xff,0xff,0xf9,0xef,0xef,0xff,0xff,0xdf,0xb7,0xff,
+0xff,0xfe,0xce,0x2d,0xff,0xff,0xb5,0xfc,0x36,0xff,0xf3,0x07,0xff,0xff,0xf6,0x00,
+0x02,0x89,0x72,0x00,0x06,0x40,0x00,0x02,0x42,0xfa,0x00,0x03,0xef,0x2f,0xa0,0x04,
+0xff,0xf2,0xfa,0x05,0xff,0xff,0x2f,0xa6,0xff,0xff,0xf2,0xfe,0xff,0xff,0xff,0x2f,
+0xff,0x01,0xf1,0x07,0xfc,0xdf,0xff,0xff,0x2f,0xa1,0xdf,0xff,0xf2,0xfa,0x01,0xcf,
+0xff,0x2f,0xa0,0x00,0xbf,0xf2,0xf9,0x00,0x00,0x9c,0xbd,0x00,0x11,0x24,0x06,0x00,
+0x22,0xef,0xc3,0xb5,0x01,0x11,0x91,0x06,0x00,0x21,0xff,0x70,0x06,0x00,0x31,0xfd,
+0x40,0x00,0x9d,0x00,0x21,0x10,0xff,0x44,0x02,0x11,0xff,0x61,0x02,0x00,0x05,0x00,
+0x21,0xfe,0x50,0xe1,0x00,0x00,0x1e,0x00,0x10,0xb2,0x2a,0x00,0x10,0xd4,0x36,0x00,
+0x10,0xf7,0x42,0x00,0x11,0x48,0xd4,0x01,0xff,0x03,0x26,0x66,0x10,0x16,0x66,0x30,
+0xef,0xff,0xc0,0xaf,0xff,0xf1,0xff,0xff,0xe0,0xbf,0xff,0xf2,0x06,0x00,0x19,0xf0,
+0x02,0xd0,0xbf,0xff,0xf2,0xaf,0xff,0x80,0x6e,0xff,0xc0,0x26,0x66,0x66,0x66,0x66,
+0x50,0xef,0x6d,0x00,0x11,0xf4,0x7e,0x00,0x1f,0xf6,0x06,0x00,0x1c,0x11,0xf5,0xd2,
+0x02,0xf3,0x09,0xd1,0x05,0x00,0x00,0x06,0x45,0xfb,0x00,0x01,0xfc,0x6f,0xfc,0x10,
+0x1f,0xc6,0xff,0xfd,0x11,0xfc,0x6f,0xff,0xfd,0x3f,0xc6,0x12,0x05,0x00,0x1d,0x05,
+0xf4,0x05,0xfa,0xfc,0x6f,0xff,0xf7,0x1f,0xc6,0xff,0xf6,0x01,0xfc,0x6f,0xf5,0x00,
+0x1f,0xc3,0xe4,0x00,0x00,0xfb,0x3a,0x02,0x21,0x52,0x00,0xb0,0x01,0x30,0xe2,0x00,
+0x00,0x8d,0x03,0x60,0xd1,0x00,0x00,0x00,0x8f,0xff,0x07,0x00,0x00,0x3b,0x00,0x30,
+0xc0,0x00,0x5f,0x62,0x00,0x21,0xb0,0x0e,0x6f,0x00,0x90,0x40,0x8e,0xee,0xee,0xee,
+0xee,0xc1,0x02,0x44,0x01,0x00,0x12,0x00,0x82,0x00,0x11,0x0f,0x07,0x00,0x30,0x60,
+0xcf,0xff,0x1e,0x04,0x01,0x2d,0x02,0xe1,0x00,0x0b,0xf2,0x00,0x00,0xbf,0xf2,0x00,
+0x0b,0xff,0x30,0x00,0xbf,0xf3,0x07,0x00,0xb4,0x2f,0xf9,0x00,0x00,0x06,0xff,0x80,
+0x00,0x00,0x6f,0xf8,0x09,0x00,0x50,0xf4,0x00,0x00,0x05,0xb0,0xc4,0x02,0xb2,0x1e,
+0xc0,0x00,0x00,0x1e,0xfc,0x00,0x00,0x02,0xef,0xc0,0xab,0x05,0x01,0x09,0x00,0x20,
+0x7f,0xf4,0xc8,0x04,0x31,0x00,0x6f,0xf7,0x07,0x00,0x60,0x2f,0xf7,0x00,0x00,0x0a,
+0x70,0xa1,0x00,0x11,0x17,0x94,0x02,0x2f,0x8f,0xe0,0x06,0x00,0x01,0x15,0xdf,0xc1,
+0x01,0x8f,0xff,0xf5,0x36,0x66,0xbf,0xf6,0x66,0x50,0x2a,0x00,0x01,0x99,0x4d,0x90,
+0x00,0x00,0x01,0x11,0x11,0x11,0x11,0x30,0x00,0xf3,0x43,0x35,0x55,0x55,0x55,0x55,
+0x40,0x00,0x00,0x5a,0xcd,0xc8,0x20,0x00,0x00,0x02,0xdf,0xd7,0x69,0xff,0x90,0x00,
+0x04,0xff,0xa0,0x01,0x02,0xef,0xc1,0x02,0xff,0xf1,0x02,0xfc,0x16,0xff,0xb0,0xcf,
+0xfb,0x05,0xaf,0xf9,0x1f,0xff,0x6d,0xff,0xb1,0xff,0xff,0xb1,0xff,0xf7,0x4f,0xfe,
+0x0b,0xff,0xf5,0x5f,0xfc,0x00,0x6f,0xf9,0x08,0xa5,0x1d,0xfd,0x20,0x00,0x5e,0xfb,
+0x53,0x6e,0xfb,0x10,0x00,0x00,0x07,0xce,0xfe,0xa4,0x00,0x00,0x32,0x5e,0x01,0x23,
+0x0e,0xf5,0x09,0x00,0xe0,0x3e,0xf9,0x05,0xac,0xdb,0x71,0x00,0x00,0x00,0x1b,0xff,
+0xfd,0x76,0xaf,0x4e,0x02,0xf0,0x29,0x08,0xff,0x31,0x30,0x4f,0xfa,0x00,0x00,0x32,
+0x04,0xef,0xbf,0xc0,0x9f,0xf8,0x00,0x0e,0xf5,0x02,0xcf,0xff,0x64,0xff,0xf3,0x01,
+0xff,0xf6,0x00,0x9f,0xf8,0x4f,0xff,0x40,0x06,0xff,0xc0,0x00,0x6f,0xeb,0xff,0xa0,
+0x00,0x09,0xff,0x60,0x00,0x3e,0xff,0xc0,0x00,0x00,0x07,0xff,0xa4,0x30,0x1b,0x65,
+0x00,0x73,0x02,0x8d,0xff,0x80,0x08,0xfe,0x30,0xfc,0x03,0x22,0xef,0x20,0x09,0x00,
+0x11,0x02,0x19,0x04,0x03,0xb7,0x03,0x22,0x0d,0xf8,0x08,0x00,0x12,0x7f,0x75,0x05,
+0x21,0x01,0xff,0x99,0x03,0x00,0x69,0x05,0x10,0xf4,0x08,0x00,0x31,0x3f,0xf5,0x1a,
+0x25,0x07,0xf0,0x06,0xcf,0xf4,0x0a,0xff,0x60,0x00,0x00,0x05,0xff,0xf5,0x0a,0xff,
+0xe1,0x00,0x00,0x0e,0xff,0xf6,0x0b,0xff,0xf9,0x04,0x02,0xf2,0x07,0xfd,0x8f,0xff,
+0xff,0x20,0x02,0xff,0xff,0xf3,0x09,0xff,0xff,0xb0,0x0a,0xff,0xff,0xf7,0x1c,0xff,
+0xff,0xf4,0x0e,0x34,0x05,0x40,0xf8,0x04,0x9a,0xaa,0x01,0x00,0x11,0x91,0x5a,0x00,
+0x21,0x70,0x00,0x51,0x00,0x50,0xa0,0xef,0xfa,0x00,0x05,0x66,0x05,0xf0,0x02,0xf9,
+0x04,0xff,0xff,0xfb,0x11,0x3f,0xa4,0xff,0x84,0xfc,0x00,0x00,0x33,0xff,0x90,0x19,
+0xd5,0x01,0xd0,0xa2,0x01,0x70,0x00,0x02,0xef,0xa4,0xf6,0x3f,0xa0,0xef,0xff,0xb0,
+0x8d,0x05,0x00,0xdd,0x00,0x20,0xff,0xfb,0x51,0x05,0x21,0x14,0xfc,0x41,0x00,0x15,
+0x19,0xd6,0x04,0x20,0x5f,0xa0,0xcd,0x04,0x01,0x11,0x06,0xf1,0x0f,0x5f,0xfa,0xff,
+0xa0,0x00,0x05,0xff,0x90,0x3f,0xfa,0x00,0x4f,0xf9,0x00,0x03,0xff,0xa0,0xbf,0x90,
+0x00,0x00,0x3f,0xf1,0x15,0x00,0x00,0x00,0x03,0x30,0x01,0x9f,0x04,0xf0,0x08,0x9f,
+0x50,0x00,0x00,0x1d,0xe1,0x8f,0xf5,0x00,0x01,0xdf,0xd0,0x08,0xff,0x50,0x1d,0xfd,
+0x10,0x00,0x8f,0xf6,0xdf,0xd1,0x61,0x01,0x20,0xfd,0x10,0xf8,0x01,0x11,0xd1,0x89,
+0x05,0x00,0x0b,0x00,0x23,0x7d,0x10,0x14,0x01,0x21,0xfd,0x18,0xe2,0x03,0xf3,0x0e,
 0x6f,0xff,0xfd,0x4a,0xaa,0xaa,0xfb,0x00,0x0c,0xda,0xf7,0xf4,0x00,0x00,0x0e,0xb0,
-0x00,0x00,0x9f,0x64,0x0c,0x63,0xeb,0x00,0x00,0x09,0xf1,0x00,0x11,0x00,0xc0,0x10,
-0x00,0x02,0xe6,0xeb,0x9d,0x00,0x09,0xf9,0x99,0x99,0x4d,0x44,0x01,0x52,0x7f,0xff,
-0xff,0xfb,0x1d,0x4c,0x01,0x10,0x00,0xcb,0x7c,0x05,0x01,0x00,0x41,0x6b,0xcc,0xc7,
-0x00,0x63,0x10,0x32,0xf8,0x22,0x22,0x54,0x04,0x00,0xb8,0x06,0x0f,0x01,0x00,0x11,
-0x05,0x26,0x05,0x02,0x67,0x7d,0x01,0x56,0x81,0x01,0x88,0x03,0x11,0x80,0x27,0x02,
-0x01,0x99,0x1c,0x12,0x7f,0xb8,0x04,0x5f,0x69,0x9f,0xff,0x99,0x60,0x52,0x07,0x03,
-0x50,0x46,0x66,0x2f,0xff,0x26,0x36,0x07,0x30,0x46,0x76,0x4f,0x69,0x04,0x2e,0xfc,
-0xbc,0x36,0x07,0x01,0x81,0x0a,0x03,0xe0,0x6d,0x12,0xfa,0xd8,0x23,0x12,0xff,0x87,
-0x1e,0x11,0xfd,0xbb,0x16,0x03,0xf2,0x0d,0x22,0xbf,0xf6,0x07,0x00,0x12,0xf1,0xc1,
-0x24,0x11,0x80,0xf9,0x4e,0x80,0xfd,0x00,0x03,0xaf,0xf8,0x07,0xff,0xf2,0x97,0x1b,
-0x30,0xef,0xfe,0x30,0x37,0x0a,0x21,0xff,0xc2,0xa0,0x00,0x01,0x67,0x7c,0x21,0x98,
-0x62,0x67,0x01,0x10,0x84,0xc5,0x01,0xf0,0x02,0x8f,0xff,0x60,0x00,0xaf,0xf3,0xec,
-0x2e,0xc0,0x1c,0xff,0xa0,0xde,0x9f,0xd1,0xdf,0xfa,0xee,0x19,0x00,0x34,0x01,0x11,
-0x2d,0x61,0x00,0x10,0x1c,0x4e,0x05,0x11,0x2d,0x81,0x57,0xf0,0x09,0xcf,0xaf,0xd2,
-0xef,0xf6,0x00,0xfb,0x0d,0xd0,0x2e,0xff,0x60,0xbf,0xef,0x80,0x02,0xef,0xf3,0x19,
-0xc8,0x00,0x00,0x16,0x40,0x33,0x17,0x20,0x12,0x00,0x64,0x00,0x20,0x3f,0x40,0xf4,
-0x36,0xa1,0x3f,0xf2,0xdf,0x6c,0xff,0xff,0x53,0x31,0xff,0x7c,0xfe,0x04,0x0f,0x06,
-0x00,0x0b,0x10,0x7b,0xd3,0x03,0x71,0xff,0xc2,0x33,0x33,0x33,0x20,0xff,0xa5,0x11,
-0x11,0x8a,0x99,0x5b,0x62,0x49,0x99,0x99,0x99,0x60,0x00,0xc4,0x06,0x01,0xe6,0x82,
-0x20,0x80,0xfa,0x1c,0x06,0x11,0xf3,0x06,0x00,0x72,0xf5,0xfe,0xaa,0xaa,0xaa,0xff,
-0xf5,0x0f,0x04,0x40,0xff,0xff,0x80,0x4f,0x06,0x00,0x20,0x10,0x0c,0x06,0x00,0x20,
-0x50,0x1e,0x06,0x00,0x51,0xfb,0xef,0xff,0xf5,0x9f,0x70,0x05,0x61,0xcd,0xdd,0xdd,
-0xdd,0xdd,0xd4,0xb8,0x05,0x09,0x95,0x78,0x7f,0xbc,0xcc,0xcc,0xcc,0xcc,0xc3,0xff,
-0x18,0x00,0x10,0x10,0x6b,0x12,0x00,0x22,0xcb,0x6f,0xfe,0x01,0x02,0x5e,0x07,0x11,
-0x95,0x0e,0x00,0x70,0x65,0xf9,0x3d,0xff,0xff,0xfd,0x39,0x03,0x00,0x20,0xf9,0x3d,
-0x10,0x00,0x11,0xa4,0x17,0x00,0x2c,0xb7,0xbf,0x2b,0x02,0x30,0x55,0x55,0x20,0x0b,
-0x13,0x10,0x90,0x72,0x03,0x10,0x40,0x84,0x01,0x00,0xda,0x03,0x40,0xfc,0x44,0x40,
-0x0c,0xd2,0x0b,0x12,0x0e,0xa0,0x07,0x01,0xd9,0x1f,0x20,0x8f,0xf6,0xc9,0x01,0x10,
-0xc0,0xc3,0x06,0x10,0x30,0x30,0x82,0x04,0xe4,0x2c,0x15,0x03,0xc6,0x2f,0xa1,0x35,
-0x6e,0xf7,0x54,0x00,0x00,0xff,0xf9,0x8f,0xff,0xae,0x0f,0x00,0x06,0x00,0xb0,0xfa,
+0x00,0x00,0x9f,0x11,0x00,0x00,0x00,0xeb,0x00,0x00,0x09,0xf1,0x00,0x11,0x00,0xc0,
+0x10,0x00,0x02,0xe6,0xeb,0x9d,0x00,0x09,0xf9,0x99,0x99,0x4d,0x44,0x01,0x72,0x7f,
+0xff,0xff,0xfb,0x1d,0xff,0xa0,0x49,0x00,0x26,0x1d,0xa0,0x83,0x05,0x40,0x6b,0xcc,
+0xc7,0x00,0x60,0x07,0x42,0xff,0xf8,0x22,0x22,0x54,0x04,0x00,0xb8,0x06,0x0f,0x01,
+0x00,0x11,0x05,0x26,0x05,0x12,0x00,0xd2,0x01,0x12,0x08,0xbb,0x01,0x10,0x8f,0x2a,
+0x03,0x00,0xe2,0x06,0x11,0xf8,0xc7,0x01,0x01,0xb8,0x04,0x5f,0x69,0x9f,0xff,0x99,
+0x60,0x52,0x07,0x03,0x50,0x46,0x66,0x2f,0xff,0x26,0x36,0x07,0x30,0x46,0x76,0x4f,
+0x69,0x04,0x2e,0xfc,0xbc,0x36,0x07,0x00,0x01,0x00,0x22,0x33,0x00,0x10,0x02,0x01,
+0x70,0x07,0x31,0x07,0xff,0xff,0xa7,0x02,0x02,0x32,0x09,0x12,0x0c,0x15,0x00,0x32,
+0x00,0xbf,0xf6,0x07,0x00,0x00,0x05,0x01,0x01,0xb1,0x03,0xf1,0x0a,0x01,0x50,0x00,
+0x4f,0xfd,0x00,0x03,0xaf,0xf8,0x07,0xff,0xf2,0x00,0x0e,0xff,0xff,0xef,0xfe,0x30,
+0x00,0x0b,0xff,0xff,0xff,0xc2,0xa0,0x00,0x10,0xd5,0x7c,0x02,0x21,0x98,0x62,0x67,
+0x01,0x10,0x84,0xc5,0x01,0xf1,0x05,0x8f,0xff,0x60,0x00,0xaf,0xf3,0xec,0x2e,0xc0,
+0x1c,0xff,0xa0,0xde,0x9f,0xd1,0xdf,0xfa,0x00,0x3e,0xff,0x80,0x02,0x11,0x2d,0x61,
+0x00,0x10,0x1c,0x4e,0x05,0x10,0x2d,0x38,0x04,0xf0,0x10,0x00,0xcf,0xaf,0xd2,0xef,
+0xf6,0x00,0xfb,0x0d,0xd0,0x2e,0xff,0x60,0xbf,0xef,0x80,0x02,0xef,0xf3,0x19,0xc8,
+0x00,0x00,0x16,0x40,0x00,0x02,0x66,0x66,0x12,0x00,0x64,0x00,0xf1,0x01,0x3f,0x40,
+0x00,0x0c,0xff,0xff,0x3f,0xf2,0xdf,0x6c,0xff,0xff,0x53,0x31,0xff,0x7c,0xfe,0x04,
+0x0f,0x06,0x00,0x0b,0x10,0x7b,0xd3,0x03,0x60,0xff,0xc2,0x33,0x33,0x33,0x20,0x00,
+0x01,0xe2,0x20,0x00,0x8a,0xaa,0xaa,0xa9,0x00,0x00,0x49,0x99,0x99,0x99,0x60,0x00,
+0xc4,0x06,0x10,0xfa,0x02,0x01,0x20,0x80,0xfa,0x1c,0x06,0x11,0xf3,0x06,0x00,0x72,
+0xf5,0xfe,0xaa,0xaa,0xaa,0xff,0xf5,0x0f,0x04,0x40,0xff,0xff,0x80,0x4f,0x06,0x00,
+0x20,0x10,0x0c,0x06,0x00,0x20,0x50,0x1e,0x06,0x00,0x51,0xfb,0xef,0xff,0xf5,0x9f,
+0x70,0x05,0x74,0xcd,0xdd,0xdd,0xdd,0xdd,0xd4,0xef,0x3d,0x08,0x05,0x01,0x00,0x7f,
+0xbc,0xcc,0xcc,0xcc,0xcc,0xc3,0xff,0x18,0x00,0x10,0x10,0x6b,0x12,0x00,0x22,0xcb,
+0x6f,0xfe,0x01,0x02,0x5e,0x07,0x11,0x95,0x0e,0x00,0x70,0x65,0xf9,0x3d,0xff,0xff,
+0xfd,0x39,0x03,0x00,0x20,0xf9,0x3d,0x10,0x00,0x11,0xa4,0x17,0x00,0x2c,0xb7,0xbf,
+0x2b,0x02,0x80,0x55,0x55,0x20,0x00,0x03,0xff,0xff,0x90,0x72,0x03,0x10,0x40,0x84,
+0x01,0x00,0xda,0x03,0x92,0xfc,0x44,0x40,0x0c,0xff,0xff,0xff,0xf0,0x0e,0xa0,0x07,
+0x20,0xff,0xfe,0x45,0x02,0x10,0xf6,0xc9,0x01,0x10,0xc0,0xc3,0x06,0x50,0x30,0x00,
+0x00,0x03,0xfa,0xf4,0x01,0x10,0xf1,0x3e,0x03,0x14,0x50,0x9f,0x00,0xb0,0x35,0x6e,
+0xf7,0x54,0x00,0x00,0xff,0xf9,0x8f,0xff,0x10,0x1d,0x01,0x00,0x06,0x00,0xb0,0xfa,
 0x24,0x44,0x01,0x00,0xff,0xf4,0xef,0xff,0x3e,0x20,0x9b,0x06,0x20,0x3f,0xe2,0x06,
-0x00,0x21,0x43,0x31,0xa7,0x06,0x18,0xf6,0x06,0x00,0x31,0x23,0x30,0xff,0xe2,0x10,
-0x02,0x06,0x00,0x40,0x7a,0xaa,0xaa,0xa2,0x46,0x70,0x05,0x9c,0x45,0x43,0x07,0xef,
-0xfa,0x10,0xeb,0x3c,0x11,0x01,0x3c,0x35,0x11,0x04,0xf0,0x16,0x11,0x07,0x92,0x0a,
-0x01,0x00,0x7d,0x30,0x00,0x0d,0xff,0x49,0x16,0x10,0x7f,0x06,0x00,0x12,0xd0,0x0b,
-0x07,0x00,0x79,0x2b,0x00,0x25,0x0d,0x11,0xcf,0x98,0x14,0x00,0x0c,0x2d,0x21,0x5a,
-0xaa,0x01,0x00,0x12,0x2f,0x03,0x01,0xf0,0x1a,0xf9,0xfa,0x0d,0x01,0xb0,0xd0,0xa2,
-0x0f,0xaf,0xeb,0xfb,0xcf,0xbf,0xbe,0xcb,0xfa,0xff,0xe1,0x98,0x1c,0x1c,0x15,0xff,
-0xaf,0xfd,0x08,0x70,0xb0,0xb0,0x3f,0xfa,0xff,0xdf,0xdd,0xdd,0xdd,0xfd,0xdf,0xaf,
-0xa0,0xd0,0x7b,0x66,0x87,0xfa,0xfe,0xaf,0xaa,0xaa,0xaa,0xeb,0xaf,0xed,0x09,0x01,
-0xbc,0x47,0x11,0x00,0x9e,0x00,0x01,0x94,0x2f,0x11,0x8f,0x77,0x32,0x11,0x29,0xb8,
-0x10,0x30,0x03,0xbf,0xff,0xef,0x0d,0x21,0x3c,0xff,0xae,0x00,0x00,0xdd,0x06,0x00,
-0x45,0x01,0x24,0x9e,0xff,0x6f,0x4e,0x12,0x5f,0x91,0x1e,0x13,0x05,0x26,0x1b,0x12,
-0x5f,0x7f,0x03,0x13,0x05,0x0f,0x04,0x12,0x4f,0x81,0x59,0x00,0x6c,0x46,0x00,0x28,
-0x5a,0x00,0x4f,0x01,0x20,0xfb,0x8a,0x05,0x00,0xc1,0x8f,0xa0,0xff,0xff,0xfb,0x7f,
-0xf8,0xff,0xff,0xfc,0x11,0x11,0xaa,0x0c,0x0f,0x05,0x00,0x10,0x10,0xbd,0x7b,0x2c,
-0x00,0x9f,0x01,0x21,0x54,0x10,0x93,0x28,0xf0,0x18,0xff,0xff,0xff,0xd8,0x10,0x00,
-0x04,0xef,0xff,0xdb,0xbc,0xff,0xff,0x70,0x08,0xff,0xd6,0x10,0x00,0x00,0x4b,0xff,
-0xb0,0xbf,0x70,0x00,0x13,0x32,0x00,0x05,0xed,0x10,0x30,0x06,0xdf,0xff,0xfe,0x80,
-0x01,0x50,0x69,0x40,0xfc,0xce,0xff,0xd2,0x60,0x80,0x50,0x60,0x00,0x04,0xde,0x10,
-0x23,0x05,0x22,0x03,0x40,0xfc,0x0d,0x14,0x04,0x35,0x4f,0x23,0x6f,0xfa,0x2a,0x10,
-0x10,0xac,0x72,0x04,0x03,0x19,0x0b,0x31,0xd2,0x0f,0xea,0x68,0x01,0xc1,0xcf,0x90,
-0xfa,0x48,0x88,0x88,0x88,0x88,0x65,0xff,0x1f,0xa9,0x3d,0x0c,0x32,0x1a,0xf1,0xfa,
-0xfa,0x02,0xc0,0xaf,0x1f,0xa5,0x99,0x99,0x99,0x99,0x98,0x5f,0xf1,0xfd,0x99,0x01,
-0x00,0x33,0x9b,0xfa,0x0b,0x98,0x02,0x06,0x26,0x47,0x0f,0x4d,0x00,0x03,0x22,0x30,
-0x05,0x4d,0x00,0x23,0xf7,0x00,0x4d,0x00,0x22,0x70,0x01,0x4d,0x00,0x2f,0x94,0x00,
-0x4d,0x00,0x1e,0x22,0x00,0x00,0x4d,0x00,0x23,0xf0,0x00,0x4d,0x00,0x22,0x00,0x00,
-0x4d,0x00,0x2f,0x90,0x00,0x4d,0x00,0x1d,0x23,0x85,0x00,0x4d,0x00,0x22,0xa0,0x00,
-0x4d,0x00,0x23,0xfa,0x00,0x4d,0x00,0x2f,0x60,0x00,0x4d,0x00,0x1d,0x22,0x00,0x00,
-0x4d,0x00,0x01,0x0c,0x02,0x00,0x4d,0x00,0x02,0x62,0x01,0x13,0xaf,0x11,0x00,0x0f,
-0x4d,0x00,0x09,0x10,0x00,0x9a,0x2d,0x13,0x50,0x95,0x02,0x22,0xfc,0x00,0x10,0x67,
-0x01,0x11,0x00,0x31,0x64,0x00,0xa5,0x56,0x09,0xf0,0x0a,0xbf,0xf6,0x4e,0x21,0x11,
-0x11,0x17,0xd3,0x0f,0xff,0xec,0xce,0xec,0xcc,0xcc,0xef,0xe1,0x7f,0xe3,0x00,0x2d,
-0x00,0x00,0x06,0x80,0xd9,0x01,0x32,0x97,0x0a,0xa6,0x44,0x00,0x14,0xcc,0x98,0x06,
-0x17,0x2f,0x1f,0x54,0x03,0xc8,0x11,0xf0,0x3a,0x01,0xaf,0xff,0xe8,0x00,0x00,0xdf,
-0xf8,0xcf,0xf8,0x00,0x7f,0xff,0x81,0xdf,0xf1,0x0c,0xfa,0xf8,0x52,0xdf,0x60,0xff,
-0x64,0x78,0x3a,0xf8,0x0f,0xff,0x50,0x08,0xff,0xa1,0xff,0xff,0x12,0xff,0xfa,0x0f,
-0xff,0x41,0x15,0xff,0xa0,0xef,0x46,0x88,0x48,0xf8,0x0b,0xfc,0xf8,0x42,0xef,0x50,
-0x5f,0xff,0x82,0xef,0xf1,0x00,0xaf,0xfa,0xef,0xf6,0x00,0x00,0x5a,0xdc,0xa4,0x00,
-0x00,0x01,0xd8,0x81,0x62,0x78,0x8b,0xff,0xfe,0x88,0x82,0x53,0x03,0x20,0x12,0x22,
-0x6c,0x74,0x11,0x3f,0x85,0x3d,0xbf,0x3f,0xfc,0xfc,0xfe,0xdf,0x90,0x3f,0xd5,0xf4,
-0xeb,0x7f,0x06,0x00,0x07,0x61,0xe6,0xf5,0xec,0x8f,0x90,0x2f,0x54,0x03,0x52,0x07,
-0x9a,0xaa,0xaa,0xa9,0x95,0x07,0x13,0x14,0x9e,0x60,0x12,0xa0,0x89,0x06,0x10,0xf9,
-0x0d,0x00,0x40,0xc3,0xdf,0xff,0x00,0xef,0x21,0x21,0x3d,0xf5,0xb8,0x60,0x30,0xd3,
-0x50,0x00,0x49,0x06,0x02,0x0d,0x00,0x21,0xff,0x60,0x0d,0x00,0x15,0xf6,0x0d,0x00,
-0x12,0x0b,0x6c,0x15,0x12,0x0d,0x3b,0x23,0x12,0x0f,0x79,0x15,0x23,0x08,0x86,0x66,
-0x01,0x10,0x8b,0x73,0x05,0x14,0xb6,0xb8,0x01,0xf0,0x0d,0xf2,0x00,0xbf,0xff,0xf8,
-0xbf,0xf6,0xef,0xff,0x40,0xbf,0xff,0xff,0x10,0xa4,0x09,0xff,0xf4,0xaf,0xff,0xff,
-0xfd,0x10,0x07,0xff,0xff,0x4d,0xff,0x21,0x09,0xf3,0x07,0xbf,0xff,0xf4,0x1d,0xff,
-0xff,0xf4,0x06,0x10,0xbf,0xff,0x40,0x1d,0xff,0xff,0x47,0xfd,0x2b,0xff,0xf4,0x00,
-0x1d,0xb7,0x01,0x00,0x2f,0x10,0x01,0xcf,0x06,0x50,0x08,0x99,0x99,0x70,0x00,0x52,
-0x0d,0x60,0x0a,0xd0,0xd0,0xd0,0xeb,0x9f,0x05,0x00,0x60,0xff,0xd1,0xd1,0xd1,0xeb,
-0xff,0xe6,0x04,0x0f,0x05,0x00,0x0b,0x01,0xb7,0x3c,0x52,0x5c,0xdd,0xdd,0xdd,0xb2,
-0x9f,0x00,0x10,0xb0,0x37,0x05,0x00,0x1a,0x86,0x20,0x9f,0x10,0x72,0x89,0x72,0x0a,
-0xff,0x21,0x11,0x11,0x1f,0xf0,0xad,0x00,0x12,0xf0,0x22,0x06,0x33,0xd0,0x08,0xff,
-0x0f,0x20,0x14,0x10,0x81,0x75,0x0c,0x01,0x00,0x0a,0xf6,0x01,0x06,0x01,0x00,0x04,
-0x59,0x3b,0x17,0xf4,0x14,0x00,0x7e,0xfb,0xfa,0x00,0xfe,0xf7,0x00,0xf7,0x49,0x00,
-0x02,0x4b,0x0a,0x3e,0x04,0x00,0x02,0x16,0x00,0x2f,0xe3,0x00,0x01,0x00,0x15,0x1f,
-0xe7,0x1e,0x00,0x0a,0x03,0x88,0x00,0xb2,0xf8,0x00,0xfe,0x00,0x00,0xf4,0xfe,0xf8,
-0xfc,0x00,0xf1,0x93,0x00,0x7d,0xff,0x00,0x00,0xfe,0xff,0xfb,0xfd,0x92,0x00,0x3f,
-0xfd,0x00,0xfe,0xdd,0x00,0x04,0x1c,0xfd,0x0a,0x00,0x19,0xff,0x1f,0x00,0x16,0xfe,
-0x70,0x00,0x20,0xfe,0x00,0xe4,0x3a,0x5f,0xfe,0x00,0xfe,0xfc,0xfe,0x9c,0x00,0x0a,
-0x15,0x02,0x3c,0x00,0x11,0xfe,0x34,0x00,0x26,0xfe,0xfd,0x30,0x00,0x10,0xe4,0x82,
-0x73,0x25,0x00,0xeb,0x24,0x00,0x20,0xfd,0xfe,0x20,0x00,0x01,0x2b,0x00,0x0d,0x44,
-0x00,0x10,0xfd,0x08,0x00,0x1f,0xfd,0x68,0x00,0x07,0x1f,0xfe,0x43,0x01,0x0d,0x19,
-0xef,0xdf,0x00,0x01,0x0c,0x00,0x10,0xfd,0x38,0x00,0x29,0xfc,0xfa,0x8c,0x01,0x83,
-0x02,0xfa,0x00,0x00,0xeb,0xfe,0xeb,0xf7,0x05,0x7d,0x02,0x05,0x01,0x16,0xf4,0xc0,
-0x62,0x20,0xd7,0x00,0x8c,0x90,0x12,0xed,0x61,0x01,0x30,0x00,0xfc,0x00,0x2f,0x05,
-0x11,0xff,0x4f,0x38,0x1e,0x00,0x4e,0x01,0x00,0xd2,0x00,0x1f,0xfc,0x97,0x00,0x0b,
-0x37,0xfb,0x00,0xfe,0x3e,0x0e,0x0a,0x7b,0x02,0x10,0xe6,0x79,0x26,0x70,0xfd,0xea,
-0xfe,0x02,0x00,0x02,0x02,0x60,0x00,0xd3,0xef,0xf7,0x00,0xf7,0xeb,0xf9,0xf8,0x00,
-0xf9,0xf8,0xfb,0xf8,0xfa,0x1a,0x01,0x66,0xea,0xf0,0x00,0x00,0xf8,0xff,0x2b,0x01,
-0x50,0xfb,0xfc,0x00,0x00,0xfb,0xdc,0x00,0x14,0xff,0x7d,0x01,0x20,0x02,0x00,0x3c,
-0x05,0x16,0xfc,0x9a,0x02,0x33,0x01,0xfd,0xfd,0x6c,0x01,0x08,0xf8,0x02,0x14,0xf0,
-0x20,0x01,0x15,0x01,0x20,0x01,0x02,0xb0,0x01,0x04,0xcd,0x00,0xf0,0x0a,0x02,0xfb,
-0xe9,0xf1,0x00,0x00,0xf1,0xfd,0xf6,0xfe,0x02,0xf6,0x02,0x02,0x01,0x02,0x00,0x02,
-0xfa,0xf9,0xfe,0xfc,0xf9,0xfc,0xfa,0x03,0x02,0x46,0xfe,0xfd,0x02,0xfb,0x20,0x05,
-0x1a,0xfd,0x99,0x01,0x02,0x48,0x00,0x1e,0xfd,0xb2,0x01,0x1f,0xfe,0xcc,0x01,0x20,
-0x1c,0xfe,0xaa,0x02,0x1e,0x00,0x01,0x00,0x12,0xff,0x43,0x02,0x1f,0xff,0x5a,0x03,
-0x10,0x1f,0xff,0x1d,0x00,0x10,0x1e,0x02,0xdd,0x01,0x19,0x02,0xa5,0x00,0x10,0x02,
-0x7d,0x03,0x0f,0x01,0x00,0x24,0x0b,0xed,0x00,0x1f,0xf7,0x2c,0x00,0x0b,0x23,0xfe,
-0xfe,0xd7,0x01,0x1c,0xee,0x6c,0x02,0x50,0xfe,0x02,0x00,0xfc,0x00,0x44,0x52,0x0e,
-0x89,0x02,0x0e,0xe2,0x03,0x06,0x58,0x03,0x1c,0xef,0x63,0x00,0x2d,0xff,0x01,0x80,
-0x01,0x1f,0xf3,0xd8,0x00,0x24,0x1f,0xfc,0x24,0x00,0x10,0x1f,0xfe,0x19,0x00,0x1b,
-0x04,0x69,0x03,0x21,0x02,0x03,0xf9,0x50,0x2d,0x04,0x05,0x21,0x00,0x30,0x06,0x07,
-0x08,0xf2,0x9b,0xf2,0x05,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,
-0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x4a,0x08,0x70,0x1b,0x1c,0x00,0x1d,
-0x1e,0x00,0x1f,0x7a,0x44,0xe3,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,
-0x25,0x26,0x24,0x27,0xba,0x38,0x0f,0x01,0x00,0xff,0xfe,0x05,0x75,0x02,0x20,0x03,
-0x02,0x70,0x02,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,
-0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xa2,0x0b,0x00,0x0d,0x0e,0x0f,0x10,
-0x11,0x12,0x13,0x14,0x2d,0x52,0x72,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x99,0x11,
-0xd0,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x22,0x26,
-0x0f,0x01,0x00,0x01,0x1f,0x24,0x6f,0x02,0xff,0xe9,0x50,0x00,0x00,0x00,0x00,0x00,
+0x00,0x21,0x43,0x31,0xa7,0x06,0x18,0xf6,0x06,0x00,0x40,0x23,0x30,0xff,0xff,0xb2,
+0x0a,0x02,0x06,0x00,0x72,0x7a,0xaa,0xaa,0xa2,0x00,0x00,0x03,0xfa,0x09,0x20,0x70,
+0x00,0xc9,0x0a,0x21,0xfa,0x10,0x50,0x06,0x10,0xd0,0x80,0x04,0xa1,0xff,0xf7,0x00,
+0x04,0xff,0xff,0xff,0xfb,0x00,0x07,0x92,0x0a,0x10,0x09,0x6d,0x00,0x20,0x00,0x0d,
+0x06,0x00,0x20,0x30,0x7f,0x06,0x00,0x12,0xd0,0x0b,0x07,0x20,0x13,0x33,0xb9,0x01,
+0x41,0x00,0x00,0xcf,0xf2,0xc4,0x0b,0x51,0x50,0x00,0x00,0x5a,0xaa,0x01,0x00,0x12,
+0x2f,0x03,0x01,0xf8,0x28,0xf9,0xfa,0x0d,0x01,0xb0,0xd0,0xa2,0x0f,0xaf,0xeb,0xfb,
+0xcf,0xbf,0xbe,0xcb,0xfa,0xff,0xe1,0x98,0x1c,0x1c,0x15,0xff,0xaf,0xfd,0x08,0x70,
+0xb0,0xb0,0x3f,0xfa,0xff,0xdf,0xdd,0xdd,0xdd,0xfd,0xdf,0xaf,0xa0,0xd0,0x00,0x00,
+0x0a,0x20,0xfa,0xfe,0xaf,0xaa,0xaa,0xaa,0xeb,0xaf,0x9a,0xff,0x80,0x01,0x31,0x41,
+0x00,0x00,0x9e,0x00,0x10,0xd0,0x09,0x03,0x30,0x8f,0xff,0xfc,0x68,0x00,0x60,0xff,
+0xff,0xff,0x50,0x00,0x03,0x69,0x01,0x41,0xe0,0x00,0x3c,0xff,0xae,0x00,0x00,0xdd,
+0x06,0x00,0x45,0x01,0x12,0x9e,0x10,0x08,0x00,0x8f,0x04,0x31,0xff,0xf1,0x00,0x9c,
+0x04,0x12,0xf9,0xa9,0x04,0x02,0x7f,0x03,0x13,0x05,0x0f,0x04,0x22,0x4f,0xf3,0x5f,
+0x00,0x70,0x76,0x00,0x00,0x00,0x34,0x44,0x43,0x4f,0x01,0x20,0xfb,0x8a,0x05,0x00,
+0xc1,0x8f,0xa0,0xff,0xff,0xfb,0x7f,0xf8,0xff,0xff,0xfc,0x11,0x11,0xaa,0x0c,0x0f,
+0x05,0x00,0x10,0x50,0xbd,0xdd,0xdd,0xdd,0xd8,0x9f,0x01,0x11,0x54,0xb5,0x04,0xf0,
+0x2a,0x6c,0xff,0xff,0xff,0xd8,0x10,0x00,0x04,0xef,0xff,0xdb,0xbc,0xff,0xff,0x70,
+0x08,0xff,0xd6,0x10,0x00,0x00,0x4b,0xff,0xb0,0xbf,0x70,0x00,0x13,0x32,0x00,0x05,
+0xed,0x10,0x30,0x06,0xdf,0xff,0xfe,0x80,0x01,0x10,0x00,0x0b,0xff,0xfc,0xce,0xff,
+0xd2,0x00,0x00,0x00,0xbe,0x60,0x00,0x04,0xde,0x10,0x23,0x05,0x41,0x03,0x40,0x00,
+0x10,0x2a,0x06,0x01,0xc6,0x00,0x00,0x8b,0x09,0x22,0xfa,0x00,0x06,0x04,0x10,0xac,
+0x72,0x04,0x03,0x19,0x0b,0x31,0xd2,0x0f,0xea,0x68,0x01,0xc1,0xcf,0x90,0xfa,0x48,
+0x88,0x88,0x88,0x88,0x65,0xff,0x1f,0xa9,0x3d,0x0c,0x32,0x1a,0xf1,0xfa,0xfa,0x02,
+0xc0,0xaf,0x1f,0xa5,0x99,0x99,0x99,0x99,0x98,0x5f,0xf1,0xfd,0x99,0x01,0x00,0x33,
+0x9b,0xfa,0x0b,0x98,0x02,0x03,0x8b,0x06,0x0f,0x4d,0x00,0x06,0x22,0x30,0x05,0x4d,
+0x00,0x23,0xf7,0x00,0x4d,0x00,0x22,0x70,0x01,0x4d,0x00,0x2f,0x94,0x00,0x4d,0x00,
+0x1e,0x22,0x00,0x00,0x4d,0x00,0x23,0xf0,0x00,0x4d,0x00,0x22,0x00,0x00,0x4d,0x00,
+0x2f,0x90,0x00,0x4d,0x00,0x1d,0x23,0x85,0x00,0x4d,0x00,0x22,0xa0,0x00,0x4d,0x00,
+0x23,0xfa,0x00,0x4d,0x00,0x2f,0x60,0x00,0x4d,0x00,0x1d,0x22,0x00,0x00,0x4d,0x00,
+0x01,0x0c,0x02,0x00,0x4d,0x00,0x02,0x62,0x01,0x13,0xaf,0x11,0x00,0x0f,0x4d,0x00,
+0x09,0x00,0x01,0x00,0x23,0x5c,0x50,0x95,0x02,0x02,0x0e,0x07,0x21,0x03,0xd0,0x11,
+0x00,0x31,0x64,0x00,0xa5,0x56,0x09,0xf0,0x0a,0xbf,0xf6,0x4e,0x21,0x11,0x11,0x17,
+0xd3,0x0f,0xff,0xec,0xce,0xec,0xcc,0xcc,0xef,0xe1,0x7f,0xe3,0x00,0x2d,0x00,0x00,
+0x06,0x80,0xd9,0x01,0x32,0x97,0x0a,0xa6,0x44,0x00,0x14,0xcc,0x98,0x06,0x29,0x2f,
+0xfa,0x5c,0x00,0x20,0x01,0x10,0x89,0x00,0xf0,0x36,0xff,0xe8,0x00,0x00,0xdf,0xf8,
+0xcf,0xf8,0x00,0x7f,0xff,0x81,0xdf,0xf1,0x0c,0xfa,0xf8,0x52,0xdf,0x60,0xff,0x64,
+0x78,0x3a,0xf8,0x0f,0xff,0x50,0x08,0xff,0xa1,0xff,0xff,0x12,0xff,0xfa,0x0f,0xff,
+0x41,0x15,0xff,0xa0,0xef,0x46,0x88,0x48,0xf8,0x0b,0xfc,0xf8,0x42,0xef,0x50,0x5f,
+0xff,0x82,0xef,0xf1,0x00,0xaf,0xfa,0xef,0xf6,0x00,0x00,0x5a,0xdc,0xa4,0x00,0xd0,
+0x00,0x01,0x56,0x63,0x00,0x00,0x78,0x8b,0xff,0xfe,0x88,0x82,0xff,0x01,0x00,0x80,
+0xf5,0x12,0x22,0x22,0x22,0x22,0x20,0x3f,0x0c,0x00,0xcf,0x90,0x3f,0xfc,0xfc,0xfe,
+0xdf,0x90,0x3f,0xd5,0xf4,0xeb,0x7f,0x06,0x00,0x07,0x60,0xe6,0xf5,0xec,0x8f,0x90,
+0x2f,0x30,0x00,0x80,0x80,0x07,0x9a,0xaa,0xaa,0xa9,0x10,0x00,0x01,0x00,0x11,0x14,
+0x06,0x00,0x30,0x03,0xef,0xa0,0x07,0x00,0x30,0x0c,0xff,0xf9,0x0d,0x00,0xa0,0xc3,
+0xdf,0xff,0x00,0x00,0x00,0x3e,0xfd,0x3d,0xf5,0x1a,0x00,0x82,0xff,0xd3,0x50,0x00,
+0x00,0x3e,0xff,0xff,0x0d,0x00,0x21,0xff,0x60,0x0d,0x00,0x15,0xf6,0x0d,0x00,0x11,
+0x0b,0x0d,0x00,0x21,0x00,0x0d,0x0d,0x00,0x21,0x00,0x0f,0x0d,0x00,0x51,0x00,0x08,
+0x86,0x30,0x00,0x01,0x00,0x91,0x8b,0xcc,0xcc,0xcc,0xcc,0xb6,0x00,0x00,0xaf,0xb5,
+0x00,0xf1,0x28,0xf2,0x00,0xbf,0xff,0xf8,0xbf,0xf6,0xef,0xff,0x40,0xbf,0xff,0xff,
+0x10,0xa4,0x09,0xff,0xf4,0xaf,0xff,0xff,0xfd,0x10,0x07,0xff,0xff,0x4d,0xff,0xff,
+0xff,0xf4,0x00,0xbf,0xff,0xf4,0x1d,0xff,0xff,0xf4,0x06,0x10,0xbf,0xff,0x40,0x1d,
+0xff,0xff,0x47,0xfd,0x2b,0xff,0xf4,0x00,0x1d,0xff,0x01,0x00,0x31,0x30,0x00,0x1c,
+0x08,0x00,0xf0,0x02,0xa0,0x00,0x08,0x99,0x99,0x70,0x00,0xbf,0xff,0xff,0xf8,0x0a,
+0xd0,0xd0,0xd0,0xeb,0x9f,0x05,0x00,0x50,0xff,0xd1,0xd1,0xd1,0xeb,0x1e,0x00,0x1f,
+0xfb,0x05,0x00,0x0b,0xa2,0xef,0xff,0xff,0xff,0xfa,0x5c,0xdd,0xdd,0xdd,0xb2,0x9f,
+0x00,0xf2,0x07,0xb0,0x00,0x03,0x00,0x00,0x00,0x0b,0xf0,0x00,0x9f,0x10,0x00,0x00,
+0x0f,0xf0,0x0a,0xff,0x21,0x11,0x11,0x1f,0xf0,0xad,0x00,0x21,0xf0,0x9f,0x07,0x00,
+0x32,0xd0,0x08,0xff,0x2a,0x01,0x12,0x7f,0x07,0x00,0x60,0x01,0x00,0x00,0x00,0x00,
+0x00,
+};
+
+static const etxFontBlock blocks[] = {
+{ .bitmap_index = 0, .comp_offset = 0, .size = 4078, .comp_size = 3729 },
+{ .bitmap_index = 4078, .comp_offset = 3729, .size = 4088, .comp_size = 3254 },
+{ .bitmap_index = 8166, .comp_offset = 6983, .size = 4072, .comp_size = 3198 },
+{ .bitmap_index = 12238, .comp_offset = 10181, .size = 4037, .comp_size = 3179 },
+{ .bitmap_index = 16275, .comp_offset = 13360, .size = 4067, .comp_size = 3441 },
+{ .bitmap_index = 20342, .comp_offset = 16801, .size = 4089, .comp_size = 3455 },
+{ .bitmap_index = 24431, .comp_offset = 20256, .size = 4045, .comp_size = 3431 },
+{ .bitmap_index = 28476, .comp_offset = 23687, .size = 4088, .comp_size = 3414 },
+{ .bitmap_index = 32564, .comp_offset = 27101, .size = 4072, .comp_size = 2994 },
+{ .bitmap_index = 36636, .comp_offset = 30095, .size = 400, .comp_size = 306 },
 };
 
 static const etxFontCmap cmaps[] = {
@@ -2056,11 +2246,11 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 63475, .glyph_id_start = 115, .list_length = 514, .type = 3, .unicode_list = 5032, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[46058] __SDRAMFONTS;
+static uint8_t etxUncompBuf[9022] __SDRAMFONTS;
 
 const etxLz4Font lv_font_ko_bold_STD = {
-.uncomp_size = 45794,
-.comp_size = 32720,
+.uncomp_size = 8758,
+.comp_size = 5082,
 .line_height = 15,
 .base_line = 3,
 .subpx = 0,
@@ -2073,12 +2263,15 @@ const etxLz4Font lv_font_ko_bold_STD = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 6060,
-.class_pair_values = 43096,
-.left_class_mapping = 44536,
-.right_class_mapping = 45165,
+.glyph_bitmap = 0,
+.class_pair_values = 6060,
+.left_class_mapping = 7500,
+.right_class_mapping = 8129,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 46058,
+.lvglFontBufSize = 9022,
+.block_count = 10,
+.blocks = blocks,
+.compressed_bitmap = lz4BitmapData,
 };
@@ -258,3480 +258,3668 @@ static const uint8_t lz4FontData[] ={
 0x08,0x00,0x13,0x58,0x08,0x00,0x13,0xa5,0x08,0x00,0x13,0xf2,0x08,0x00,0x22,0x3f,
 0xf2,0xa8,0x00,0xa2,0x9d,0xf2,0x60,0x0b,0x0b,0x0e,0x00,0xfe,0xea,0xf2,0x60,0x00,
 0x22,0x3e,0xf3,0xa8,0x00,0x50,0xa0,0xf3,0x40,0x10,0x11,0x18,0x17,0x12,0xf3,0x60,
-0x00,0x60,0x3b,0xf4,0x10,0x0d,0x0e,0x09,0x88,0x19,0xf2,0xff,0xff,0xff,0xff,0xff,
-0xff,0x96,0x72,0x1f,0xb5,0x21,0x51,0x2f,0x50,0x4d,0x5a,0x4d,0x5b,0x4d,0x5d,0x4d,
-0x76,0x4d,0x7d,0x4d,0x82,0x4d,0x89,0x4d,0x8b,0x4d,0x9b,0x4d,0xa8,0x4d,0xdc,0x4d,
-0xf4,0x4d,0xfb,0x4d,0xfe,0x4d,0x1b,0x4e,0x26,0x4e,0x35,0x4e,0x40,0x4e,0x46,0x4e,
-0x4b,0x4e,0x4d,0x4e,0x60,0x4e,0x7f,0x4e,0x98,0x4e,0x9d,0x4e,0x9e,0x4e,0x9f,0x4e,
-0xa5,0x4e,0xac,0x4e,0xcf,0x4e,0xd6,0x4e,0xdb,0x4e,0xeb,0x4e,0x14,0x4f,0x2d,0x4f,
-0x31,0x4f,0x3e,0x4f,0x3f,0x4f,0x5b,0x4f,0x5d,0x4f,0x62,0x4f,0x8c,0x4f,0x9f,0x4f,
-0xac,0x4f,0xc4,0x4f,0xe9,0x4f,0x03,0x50,0x15,0x50,0x1f,0x50,0x50,0x50,0x6f,0x50,
-0x82,0x50,0x95,0x50,0x99,0x50,0x9b,0x50,0xb5,0x50,0xb7,0x50,0xb8,0x50,0xbc,0x50,
-0xc6,0x50,0xc7,0x50,0xc8,0x50,0xcc,0x50,0xda,0x50,0x16,0x51,0x4a,0x51,0x4d,0x51,
-0x56,0x51,0x57,0x51,0x67,0x51,0x6d,0x51,0x75,0x51,0x79,0x51,0x7a,0x51,0x80,0x51,
-0x86,0x51,0x87,0x51,0x9d,0x51,0x9e,0x51,0xbf,0x51,0xc5,0x51,0xef,0x51,0xf0,0x51,
-0x25,0x52,0x55,0x52,0x58,0x52,0x66,0x52,0x89,0x52,0x90,0x52,0x97,0x52,0x9a,0x52,
-0xa4,0x52,0xb1,0x52,0xef,0x52,0x13,0x53,0x19,0x53,0x1a,0x53,0x1d,0x53,0x26,0x53,
-0x33,0x53,0x3a,0x53,0x3f,0x53,0x40,0x53,0x43,0x53,0x58,0x53,0x5c,0x53,0x5d,0x53,
-0x5e,0x53,0x61,0x53,0x76,0x53,0x7b,0x53,0x7f,0x53,0x9a,0x53,0xdc,0x53,0x9f,0x54,
-0xaf,0x54,0xfe,0x54,0x1e,0x55,0xb8,0x55,0x2e,0x56,0x30,0x56,0x4a,0x56,0x4e,0x56,
-0x5b,0x56,0x5d,0x56,0x63,0x56,0x66,0x56,0x78,0x56,0x80,0x56,0x90,0x56,0x97,0x56,
-0xdb,0x56,0x47,0x57,0x4a,0x57,0x81,0x57,0x9a,0x57,0xbb,0x57,0xee,0x57,0x23,0x58,
-0x66,0x58,0x6a,0x58,0x77,0x58,0x79,0x58,0x7a,0x58,0x81,0x58,0x8e,0x58,0xcd,0x58,
-0x1b,0x59,0xa0,0x5a,0xa7,0x5a,0xa8,0x5a,0xc8,0x5a,0xd3,0x5a,0xd9,0x5a,0xdc,0x5a,
-0xea,0x5a,0x09,0x5b,0x36,0x5b,0x3b,0x5b,0x3c,0x5b,0x48,0x5b,0x49,0x5b,0x54,0x5b,
-0x57,0x5b,0x5d,0x5b,0x5e,0x5b,0x5f,0x5b,0x8a,0x5b,0x8e,0x5b,0x90,0x5b,0x9f,0x5b,
-0xa5,0x5b,0x35,0x5d,0x36,0x5d,0x3e,0x5d,0x42,0x5d,0x5c,0x5d,0x86,0x5d,0x88,0x5d,
-0x8d,0x5d,0x90,0x5d,0x95,0x5d,0xa5,0x5d,0xc3,0x5d,0xce,0x5d,0xdf,0x5d,0xf6,0x5d,
-0x30,0x5e,0x46,0x5e,0x4a,0x5e,0x50,0x5e,0x5f,0x5e,0x65,0x5e,0x81,0x5e,0x87,0x5e,
-0x98,0x5e,0xb2,0x5e,0xc1,0x5e,0xd5,0x5e,0xd8,0x5e,0xdc,0x5e,0xe1,0x5e,0xee,0x5e,
-0xf9,0x5e,0xfa,0x5e,0xfe,0x5e,0x07,0x5f,0x13,0x5f,0x15,0x5f,0x3b,0x5f,0x4d,0x5f,
-0x70,0x5f,0x75,0x5f,0xb2,0x5f,0xbf,0x5f,0x15,0x60,0x5f,0x60,0x6f,0x60,0x9b,0x60,
-0xb2,0x60,0x19,0x61,0x48,0x61,0x60,0x61,0x66,0x61,0x7a,0x61,0x82,0x61,0x86,0x61,
-0x90,0x61,0x97,0x61,0x9b,0x61,0xa3,0x61,0xce,0x61,0x19,0x62,0x22,0x62,0x4e,0x62,
-0x51,0x62,0x57,0x62,0x59,0x62,0x7f,0x62,0xc7,0x62,0xd3,0x62,0xe2,0x62,0xf1,0x62,
-0xf5,0x62,0xf7,0x62,0xf8,0x62,0x1f,0x63,0x20,0x63,0x22,0x63,0x2a,0x63,0x2b,0x63,
-0x44,0x63,0x66,0x63,0xc8,0x63,0xf5,0x63,0xfd,0x63,0x17,0x64,0x1a,0x64,0x1d,0x64,
-0x2a,0x64,0x36,0x64,0x3c,0x64,0x44,0x64,0x7f,0x64,0x86,0x64,0x89,0x64,0x8e,0x64,
-0x95,0x64,0x98,0x64,0x9f,0x64,0xa1,0x64,0xa7,0x64,0xa9,0x64,0xc4,0x64,0xc8,0x64,
-0xd7,0x64,0xec,0x64,0xff,0x64,0x00,0x65,0x07,0x65,0x09,0x65,0x0c,0x65,0x1b,0x65,
-0x35,0x65,0x5e,0x65,0x6f,0x65,0x70,0x65,0x7f,0x65,0x92,0x65,0xbe,0x65,0xbf,0x65,
-0xfb,0x65,0x42,0x66,0x44,0x66,0x4f,0x66,0x50,0x66,0x59,0x66,0x6f,0x66,0x7a,0x66,
-0x7c,0x66,0xcf,0x66,0xec,0x66,0x14,0x67,0x35,0x67,0x71,0x67,0x8c,0x67,0x96,0x67,
-0x98,0x67,0xcf,0x67,0xed,0x67,0xc5,0x68,0x52,0x69,0x69,0x69,0x71,0x69,0x73,0x69,
-0xaf,0x69,0xbb,0x69,0xe4,0x69,0xf2,0x69,0x54,0x6a,0xa0,0x6a,0xb2,0x6a,0xb3,0x6a,
-0xb4,0x6a,0xb5,0x6a,0xcb,0x6a,0xda,0x6a,0x05,0x6b,0x24,0x6b,0x84,0x6b,0xb0,0x6b,
-0xe2,0x6b,0xf1,0x6b,0x09,0x6c,0x0f,0x6c,0x25,0x6c,0x32,0x6c,0x38,0x6c,0x6b,0x6c,
-0x82,0x6c,0x8b,0x6c,0x91,0x6c,0xd8,0x6c,0x47,0x6d,0x4b,0x6d,0x55,0x6d,0x6b,0x6d,
-0x7c,0x6d,0xe0,0x6d,0xe6,0x6d,0xfb,0x6d,0x21,0x6e,0x3f,0x6e,0x4e,0x6e,0x4f,0x6e,
-0x88,0x6e,0x10,0x6f,0x4e,0x6f,0xb3,0x6f,0xbb,0x6f,0x09,0x70,0x0a,0x70,0x1f,0x70,
-0x71,0x70,0x76,0x70,0x86,0x70,0xd4,0x70,0x18,0x71,0x7c,0x71,0x97,0x71,0x98,0x71,
-0xa9,0x71,0xc9,0x71,0x10,0x72,0xd7,0x72,0x3d,0x73,0x4e,0x73,0x56,0x73,0xae,0x73,
-0x00,0x74,0x6f,0x74,0x78,0x74,0x9c,0x74,0xb5,0x74,0xc0,0x74,0xc6,0x74,0xda,0x74,
-0xcc,0x75,0xcd,0x75,0xd4,0x75,0x1a,0x76,0x33,0x76,0x34,0x76,0x3e,0x76,0x44,0x76,
-0x48,0x76,0x5b,0x76,0x6f,0x76,0xfc,0x76,0x35,0x77,0xbc,0x77,0x0a,0x78,0x0c,0x78,
-0x8a,0x78,0xd1,0x78,0x22,0x79,0x40,0x79,0x4b,0x79,0x5b,0x79,0x81,0x79,0x9d,0x79,
-0xb9,0x79,0xca,0x79,0xd1,0x79,0xe7,0x79,0x3f,0x7a,0x46,0x7a,0x7c,0x7a,0x99,0x7a,
-0xe7,0x7a,0xf1,0x7a,0x10,0x7b,0x14,0x7b,0x8d,0x7b,0xb4,0x7b,0xe8,0x7b,0x0e,0x7c,
-0x4b,0x7c,0x55,0x7c,0x6a,0x7c,0x7f,0x7c,0x80,0x7c,0x92,0x7c,0x94,0x7c,0xa0,0x7c,
-0xa5,0x7c,0xc1,0x7c,0xd1,0x7c,0xe3,0x7c,0xf0,0x7c,0x1a,0x7d,0x2a,0x7d,0x38,0x7d,
-0x39,0x7d,0x44,0x7d,0x7e,0x7d,0x81,0x7d,0x8d,0x7d,0xdc,0x7d,0x66,0x7e,0xbe,0x7e,
-0xde,0x7e,0xf9,0x7e,0x4b,0x7f,0x4c,0x7f,0x55,0x7f,0x67,0x7f,0x76,0x7f,0xbf,0x7f,
-0xc2,0x7f,0x1c,0x80,0x4d,0x80,0x58,0x80,0xc3,0x80,0x3a,0x81,0x43,0x81,0x57,0x81,
-0x7a,0x81,0x85,0x81,0xc2,0x81,0x41,0x82,0xc7,0x82,0x2c,0x83,0x54,0x83,0x8d,0x83,
-0xb1,0x83,0x1b,0x84,0x1d,0x85,0x1f,0x85,0x7d,0x85,0xaf,0x85,0x52,0x86,0x0a,0x87,
-0x9c,0x87,0xab,0x87,0xad,0x87,0xb8,0x87,0xc0,0x87,0xfb,0x87,0x2c,0x88,0x2d,0x88,
-0x4d,0x88,0x57,0x88,0xcf,0x88,0xd1,0x88,0xd6,0x88,0xdf,0x88,0xe6,0x88,0x18,0x89,
-0x22,0x89,0x33,0x89,0x48,0x89,0x50,0x89,0x58,0x89,0x68,0x89,0x7a,0x89,0x7d,0x89,
-0x8b,0x89,0xb2,0x89,0xb6,0x89,0xc1,0x89,0xc3,0x89,0xdc,0x89,0xdd,0x89,0xee,0x89,
-0xf4,0x89,0xfa,0x89,0x0f,0x8a,0x1b,0x8a,0x99,0x8a,0xac,0x8a,0xb6,0x8a,0xc0,0x8a,
-0xc7,0x8a,0xd0,0x8a,0xda,0x8a,0xf0,0x8b,0x0c,0x8c,0x75,0x8c,0xc7,0x8c,0xd5,0x8c,
-0x03,0x8d,0x2d,0x8d,0x2f,0x8d,0x3f,0x8d,0x43,0x8d,0xb4,0x8d,0xfb,0x8d,0x1a,0x8e,
-0x48,0x8e,0x53,0x8e,0x59,0x8e,0x7a,0x8e,0x7f,0x8e,0x88,0x8e,0x99,0x8e,0xc4,0x8e,
-0xe1,0x8e,0x40,0x8f,0x50,0x8f,0x56,0x8f,0x6a,0x8f,0x6f,0x8f,0x73,0x8f,0x81,0x8f,
-0x82,0x8f,0x9a,0x8f,0x9b,0x8f,0x9e,0x8f,0xa3,0x8f,0xa9,0x8f,0xc2,0x8f,0xc8,0x8f,
-0xda,0x8f,0xdf,0x8f,0x38,0x90,0x9d,0x90,0x1b,0x91,0x1d,0x91,0x1f,0x91,0x2d,0x91,
-0x65,0x91,0x54,0x92,0x7f,0x92,0xc5,0x92,0xe6,0x92,0x31,0x93,0x68,0x93,0xa1,0x93,
-0xc7,0x94,0xd0,0x94,0xd9,0x94,0xdb,0x94,0xe2,0x94,0xe3,0x94,0x2c,0x95,0x90,0x95,
-0x94,0x95,0x9d,0x95,0xa0,0x95,0xb4,0x95,0xc0,0x95,0xc7,0x95,0xde,0x95,0xe4,0x95,
-0xec,0x95,0xf8,0x95,0x16,0x96,0x29,0x96,0x32,0x96,0x46,0x96,0x4b,0x96,0x50,0x96,
-0x57,0x96,0x98,0x96,0xac,0x96,0xae,0x96,0xb2,0x96,0x1c,0x97,0x23,0x97,0x43,0x97,
-0x4f,0x97,0x51,0x97,0x52,0x97,0x55,0x97,0x56,0x97,0x58,0x97,0x60,0x97,0x8b,0x97,
-0x9c,0x97,0x9f,0x97,0xae,0x97,0xbf,0x97,0xd4,0x97,0xec,0x97,0x2b,0x98,0x9b,0x98,
-0x25,0x99,0x2b,0x99,0x95,0x99,0xa7,0x99,0x24,0x9a,0x28,0x9a,0x44,0x9c,0xf5,0x9d,
-0x28,0x9e,0x2e,0x9e,0x9a,0x9e,0xa0,0x9e,0x51,0xef,0x58,0xef,0x5b,0xef,0x5c,0xef,
-0x5d,0xef,0x61,0xef,0x63,0xef,0x65,0xef,0x69,0xef,0x6c,0xef,0x71,0xef,0x76,0xef,
-0x77,0xef,0x78,0xef,0x8e,0xef,0x93,0xef,0x98,0xef,0x9b,0xef,0x9c,0xef,0x9d,0xef,
-0xa1,0xef,0xa2,0xef,0xa3,0xef,0xa4,0xef,0xb7,0xef,0xb8,0xef,0xbe,0xef,0xc0,0xef,
-0xc1,0xef,0xc4,0xef,0xc7,0xef,0xc8,0xef,0xc9,0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,
-0x14,0xf0,0x15,0xf0,0x17,0xf0,0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,
-0x6c,0xf0,0x74,0xf0,0xab,0xf0,0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,
-0x94,0xf1,0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,
-0x2f,0xc1,0xfb,0x1f,0xb0,0xfa,0x0f,0xa0,0xf9,0x06,0x31,0xd9,0x1e,0xa0,0x9a,0x8b,
-0x9a,0x8b,0x98,0x89,0x43,0x44,0x00,0x1f,0x0b,0x70,0x00,0x5d,0x0f,0x30,0x2f,0xff,
-0xff,0xf7,0x01,0xb8,0x6d,0x10,0x00,0xe4,0x7a,0x00,0x8f,0xff,0xff,0xf0,0x15,0xf2,
-0xd6,0x20,0x06,0xc0,0xf2,0x00,0x08,0xa2,0xf0,0x00,0x00,0x09,0x70,0x00,0x05,0xdb,
-0x30,0x09,0xfe,0xff,0x40,0xfd,0x02,0xfb,0x0f,0xe1,0x04,0x40,0x7f,0xf8,0x10,0x00,
-0x4b,0xfe,0x31,0x41,0x04,0xfb,0x4f,0x90,0x1f,0xc0,0xdf,0xce,0xf7,0x01,0x8e,0xc5,
-0x00,0x00,0xb5,0x00,0x0a,0xfc,0x10,0x00,0x00,0x5e,0x2c,0x80,0xb3,0x00,0x5e,0x0b,
-0x96,0xc0,0x00,0x0c,0xfe,0x4e,0x20,0x00,0x00,0x10,0xb7,0x00,0x00,0x00,0x06,0xc5,
-0xdd,0x50,0x00,0x2e,0x2e,0x77,0xf0,0x00,0xa7,0x0e,0x65,0xf0,0x00,0x00,0x06,0xee,
-0x70,0x01,0xbf,0xd5,0x00,0x00,0x9f,0x9d,0xf0,0x00,0x0a,0xf0,0x9f,0x00,0x00,0x4f,
-0xdf,0x50,0x00,0x05,0xff,0x90,0x66,0x04,0xfb,0xbf,0x6e,0xb0,0x8f,0x50,0xdf,0xf6,
-0x04,0xfd,0x6a,0xff,0x30,0x06,0xdf,0xe9,0xfd,0x10,0x9b,0x9b,0x9a,0x44,0x00,0x01,
-0x00,0x02,0xe2,0x00,0xd9,0x00,0x7f,0x10,0x0d,0xb0,0x00,0xf7,0x00,0x2f,0x60,0x03,
-0xf5,0x00,0x2f,0x60,0x00,0xf8,0x00,0x0b,0xc0,0x00,0x4f,0x30,0x00,0xad,0x10,0x00,
-0x91,0x10,0x00,0x9a,0x00,0x2e,0x70,0x07,0xf1,0x02,0xf6,0x00,0xea,0x00,0xdc,0x00,
-0xcd,0x00,0xdc,0x00,0xf9,0x03,0xf4,0x0a,0xd0,0x5f,0x30,0x74,0x00,0x00,0x99,0x00,
-0x43,0x88,0x23,0x8e,0xfe,0xf8,0x02,0xff,0x20,0x0d,0x79,0xc0,0x05,0x01,0x50,0x00,
-0x4b,0x40,0x00,0x05,0xf6,0x00,0x00,0x5f,0x60,0x0a,0xff,0xff,0xfb,0x6a,0xcf,0xca,
-0x70,0x0e,0x00,0xf0,0x17,0x00,0x1f,0x72,0xf6,0x5f,0x26,0x70,0x02,0x22,0x04,0xff,
-0xf4,0x15,0x55,0x10,0x1d,0x91,0xea,0x00,0x00,0xd8,0x00,0x03,0xf2,0x00,0x08,0xd0,
-0x00,0x0d,0x70,0x00,0x3f,0x20,0x00,0x8c,0x00,0x00,0xe7,0x11,0x00,0xf8,0x22,0x09,
-0xc0,0x00,0x0e,0x70,0x00,0x02,0xbf,0xd6,0x00,0xdf,0x8c,0xf5,0x3f,0x90,0x1f,0xa5,
-0xf7,0x00,0xfd,0x6f,0x70,0x0f,0xd5,0xf7,0x00,0xfc,0x3f,0x90,0x2f,0xa0,0xdf,0x8c,
-0xf5,0x02,0xbf,0xd7,0x00,0x02,0x8d,0x1c,0xff,0xf1,0x95,0xcf,0x10,0x0c,0xf1,0x00,
-0x05,0x00,0xf0,0xb5,0x04,0xcf,0xe8,0x02,0xfe,0x8c,0xf6,0x7f,0x50,0x3f,0xa0,0x00,
-0x06,0xf7,0x00,0x03,0xfd,0x00,0x03,0xee,0x10,0x03,0xee,0x20,0x02,0xef,0x97,0x77,
-0x6f,0xff,0xff,0xf0,0x05,0xdf,0xd7,0x03,0xfe,0x8c,0xf6,0x38,0x30,0x3f,0x90,0x01,
-0x29,0xf6,0x00,0x8f,0xfa,0x00,0x02,0x59,0xf7,0x5a,0x30,0x1f,0xc4,0xfe,0x8b,0xf8,
-0x05,0xdf,0xe8,0x00,0x00,0x02,0xff,0x10,0x00,0x0b,0xff,0x10,0x00,0x5f,0xff,0x10,
-0x01,0xea,0xcf,0x10,0x09,0xe1,0xcf,0x10,0x3f,0x82,0xcf,0x30,0x9f,0xff,0xff,0xf1,
-0x35,0x55,0xdf,0x50,0x00,0x00,0xcf,0x10,0x0a,0xff,0xff,0x90,0xbf,0x88,0x85,0x0d,
-0xc0,0x00,0x00,0xff,0xff,0xb1,0x09,0x95,0x9f,0x90,0x00,0x00,0xfd,0x2a,0x60,0x0f,
-0xd0,0xef,0x8b,0xf8,0x03,0xcf,0xe8,0x00,0x00,0x2a,0xe9,0x00,0x3f,0xfa,0x50,0x0d,
-0xe2,0x10,0x03,0xfd,0xef,0xd2,0x5f,0xe6,0x9f,0xb5,0xf7,0x00,0xee,0x3f,0x90,0x0e,
-0xe0,0xcf,0x9b,0xf9,0x01,0xae,0xe9,0x00,0x9f,0xff,0xff,0xe4,0x88,0x89,0xfb,0x00,
-0x00,0x7f,0x30,0x00,0x0e,0xc0,0x00,0x07,0xf5,0x00,0x00,0xee,0x00,0x00,0x6f,0x70,
-0x00,0x0d,0xf1,0x00,0x05,0xf9,0x00,0x00,0x44,0x00,0xf0,0x30,0xef,0x8c,0xf6,0x2f,
-0xa0,0x3f,0x90,0xee,0x38,0xf6,0x04,0xff,0xfc,0x01,0xed,0x69,0xf7,0x5f,0x70,0x0f,
-0xc2,0xfe,0x8b,0xf9,0x05,0xcf,0xe9,0x00,0x02,0xcf,0xd5,0x01,0xef,0x8d,0xf3,0x5f,
-0x80,0x3f,0x96,0xf6,0x01,0xfc,0x3f,0xc2,0x7f,0xc0,0x9f,0xfe,0xfa,0x00,0x23,0x7f,
-0x50,0x09,0xbf,0xc0,0x01,0xfd,0x80,0x00,0x1e,0xa1,0xd9,0x17,0x08,0x71,0x01,0xd9,
-0x1e,0xa0,0x2e,0x82,0xe8,0xab,0x21,0xf2,0x2e,0x85,0x0f,0x91,0xf6,0x6d,0x00,0x10,
-0x00,0x01,0x7a,0x02,0x9f,0xfb,0x8f,0xe9,0x40,0x9f,0xd7,0x10,0x04,0xbf,0xfa,0x00,
-0x02,0x9c,0x00,0x00,0x00,0x2f,0xff,0xff,0x81,0x88,0x88,0x84,0x18,0x88,0x88,0x42,
-0xff,0xff,0xf8,0x3b,0x40,0x00,0x03,0xff,0xd6,0x00,0x00,0x6b,0xff,0x30,0x04,0x9f,
-0xf4,0x2e,0xff,0x92,0x03,0xd6,0xee,0x21,0xf0,0x44,0x08,0xef,0xb2,0x7f,0xca,0xfc,
-0x69,0x10,0xee,0x00,0x06,0xf9,0x00,0x5f,0xb0,0x00,0xbf,0x00,0x00,0x12,0x00,0x00,
-0xbc,0x00,0x00,0xcd,0x00,0x00,0x04,0xbe,0xfd,0x70,0x00,0x00,0x8e,0x61,0x13,0xbc,
-0x00,0x05,0xe2,0x00,0x00,0x0b,0x70,0x0d,0x60,0x3c,0xea,0x14,0xd0,0x3f,0x11,0xf8,
-0x4f,0x21,0xf0,0x5e,0x07,0xe0,0x3f,0x00,0xf1,0x6c,0x0a,0xb0,0x5f,0x03,0xf0,0x6d,
-0x09,0xd1,0xbf,0x2a,0x90,0x2f,0x12,0xde,0x6b,0xfa,0x00,0x0d,0x90,0x57,0x00,0xf0,
-0x60,0x03,0xea,0x42,0x36,0x00,0x00,0x00,0x29,0xdf,0xea,0x00,0x00,0x00,0x0b,0xf7,
-0x00,0x00,0x01,0xff,0xd0,0x00,0x00,0x7f,0xcf,0x30,0x00,0x0d,0xe2,0xf9,0x00,0x03,
-0xf8,0x0c,0xf0,0x00,0x9f,0xa8,0xcf,0x50,0x0f,0xff,0xff,0xfb,0x06,0xf8,0x00,0x0c,
-0xf2,0xcf,0x30,0x00,0x7f,0x80,0x2f,0xff,0xfc,0x50,0x2f,0xe8,0x9f,0xf3,0x2f,0xb0,
-0x07,0xf7,0x2f,0xc1,0x2b,0xf3,0x2f,0xff,0xff,0xa0,0x2f,0xc4,0x4a,0xf6,0x2f,0xb0,
-0x04,0xfa,0x2f,0xe8,0x8d,0xf6,0x2f,0xff,0xfd,0x80,0x00,0x8e,0xfd,0x60,0x00,0xaf,
-0xc9,0xdf,0x70,0x2f,0xd0,0x00,0xfe,0x06,0xf8,0x00,0x01,0x20,0x7f,0x70,0x00,0x00,
-0x09,0x00,0xf1,0x14,0x10,0x2f,0xc0,0x00,0xfe,0x00,0xbf,0xc9,0xdf,0x70,0x00,0x9e,
-0xfd,0x60,0x00,0x2f,0xff,0xe9,0x10,0x2f,0xe8,0xbf,0xd0,0x2f,0xb0,0x08,0xf8,0x2f,
-0xb0,0x02,0xfc,0x2f,0xb0,0x00,0xfe,0x08,0x00,0x00,0x10,0x00,0x31,0xe8,0xbf,0xd1,
-0x20,0x00,0xe0,0xff,0xff,0xf0,0x2f,0xe8,0x88,0x80,0x2f,0xb0,0x00,0x00,0x2f,0xd8,
-0x88,0xd7,0x03,0x11,0x60,0x0c,0x00,0x00,0x04,0x00,0x00,0x18,0x00,0x00,0x20,0x00,
-0xf1,0x03,0xff,0xff,0xd2,0xfe,0x88,0x87,0x2f,0xb0,0x00,0x02,0xfe,0x88,0x83,0x2f,
-0xff,0xff,0x62,0xfb,0x21,0x00,0x22,0x02,0xfb,0x28,0x00,0xf0,0x19,0x00,0x7d,0xfd,
-0x80,0x00,0x9f,0xd9,0xcf,0xa0,0x1f,0xe0,0x00,0xab,0x05,0xf9,0x00,0x11,0x10,0x6f,
-0x80,0x8f,0xff,0x25,0xf9,0x02,0x4d,0xf2,0x1f,0xe0,0x00,0xcf,0x20,0x9f,0xd9,0xaf,
-0xf1,0x00,0x7d,0xfe,0xb3,0x2d,0x00,0x61,0x9f,0x52,0xfb,0x00,0x09,0xf5,0x09,0x00,
-0x86,0xfe,0x88,0x8c,0xf5,0x2f,0xff,0xff,0xff,0x12,0x00,0x04,0x09,0x00,0x46,0x50,
-0x0f,0xd0,0xfd,0x03,0x00,0x00,0x36,0x01,0x4a,0x70,0x00,0x07,0xf7,0x07,0x00,0xf0,
-0x0c,0x8c,0x20,0x8f,0x66,0xfd,0x9f,0xf2,0x08,0xef,0xc4,0x00,0x2f,0xb0,0x07,0xfc,
-0x02,0xfb,0x04,0xfe,0x10,0x2f,0xb2,0xef,0x30,0x02,0xfc,0xcf,0xfa,0x00,0xf6,0x06,
-0xf5,0x00,0x02,0xff,0xbf,0xe1,0x00,0x2f,0xc0,0x8f,0xa0,0x02,0xfb,0x00,0xdf,0x50,
-0x2f,0xb0,0x03,0xfe,0x10,0xb4,0x00,0x0b,0x07,0x00,0xf0,0x48,0xfe,0x88,0x86,0x2f,
-0xff,0xff,0xc0,0x2f,0xf7,0x00,0x02,0xff,0x82,0xff,0xd0,0x00,0x7f,0xf8,0x2f,0xef,
-0x30,0x0d,0xef,0x82,0xfa,0xf9,0x03,0xf9,0xf8,0x2f,0xaa,0xe0,0x9f,0x5f,0x82,0xfa,
-0x4f,0x5e,0xa5,0xf8,0x2f,0xb0,0xee,0xf4,0x5f,0x82,0xfb,0x08,0xfe,0x05,0xf8,0x2f,
-0xb0,0x2f,0x80,0x5f,0x80,0x2f,0xf1,0x00,0x9f,0x52,0xff,0xa0,0x09,0xf5,0x2f,0xff,
-0x40,0x9f,0x52,0xfc,0xed,0x09,0xf5,0x2f,0xb6,0xf8,0x9f,0x52,0xfb,0x0c,0xfb,0xf5,
-0x2f,0xb0,0x2f,0xdb,0x00,0x10,0x8f,0xd2,0x00,0xf0,0x0b,0xdf,0x50,0x00,0x7d,0xfd,
-0x70,0x00,0x9f,0xda,0xdf,0x80,0x2f,0xe0,0x00,0xef,0x15,0xf9,0x00,0x09,0xf5,0x7f,
-0x70,0x00,0x8f,0x66,0xf8,0xf2,0x00,0x81,0xd0,0x00,0xef,0x10,0x9f,0xd9,0xdf,0x90,
-0x24,0x00,0xf5,0x09,0x2f,0xff,0xfd,0x70,0x2f,0xe9,0x9d,0xf8,0x2f,0xb0,0x01,0xfd,
-0x2f,0xb0,0x05,0xfc,0x2f,0xff,0xff,0xf4,0x2f,0xe8,0x86,0x10,0x95,0x01,0x02,0x71,
-0x01,0x12,0x60,0x4d,0x00,0x5f,0xd0,0x01,0xef,0x16,0xf8,0x4d,0x00,0x01,0xe0,0x80,
-0x00,0x7d,0xff,0xf3,0x00,0x00,0x00,0x3e,0xf1,0x00,0x00,0x00,0x13,0x56,0x00,0xe0,
-0x60,0x02,0xfe,0x89,0xef,0x50,0x2f,0xb0,0x05,0xf9,0x02,0xfb,0x00,0x8f,0xd9,0x01,
-0xff,0x35,0xc1,0x02,0xfe,0x8d,0xf4,0x00,0x2f,0xb0,0x4f,0xc0,0x02,0xfb,0x00,0xcf,
-0x40,0x2f,0xb0,0x04,0xfc,0x00,0x03,0xbf,0xfc,0x40,0x1e,0xf9,0x9f,0xf2,0x3f,0xb0,
-0x05,0xc5,0x0e,0xf9,0x30,0x00,0x01,0xaf,0xfd,0x40,0x00,0x01,0x6e,0xf3,0x7e,0x60,
-0x06,0xf7,0x2f,0xf9,0x8e,0xf4,0x03,0xbe,0xfd,0x50,0xcf,0xff,0xff,0xfc,0x68,0x8f,
-0xf8,0x86,0x00,0x0f,0xf0,0x00,0x04,0x00,0x05,0x4f,0x4f,0xa0,0x01,0xfd,0x04,0x00,
-0x01,0xf0,0x49,0x2f,0xc0,0x03,0xfb,0x0c,0xfb,0x9e,0xf5,0x01,0x9e,0xfd,0x50,0xcf,
-0x40,0x00,0xdf,0x46,0xf9,0x00,0x2f,0xe0,0x1f,0xe0,0x06,0xf8,0x00,0xbf,0x30,0xbf,
-0x30,0x05,0xf8,0x0f,0xd0,0x00,0x0f,0xc5,0xf7,0x00,0x00,0xaf,0xbf,0x20,0x00,0x04,
-0xff,0xc0,0x00,0x00,0x0e,0xf6,0x00,0x00,0xaf,0x30,0x3f,0x90,0x0d,0xf1,0x7f,0x60,
-0x7f,0xd0,0x0f,0xd0,0x3f,0x90,0xbf,0xf1,0x3f,0x90,0x0f,0xc0,0xeb,0xf5,0x6f,0x50,
-0x0c,0xf3,0xf5,0xe8,0x9f,0x20,0x08,0xf9,0xf1,0xac,0xce,0x2d,0x00,0xf0,0x25,0x6f,
-0xfa,0x00,0x01,0xff,0x80,0x2f,0xf7,0x00,0x00,0xdf,0x40,0x0e,0xf3,0x00,0x7f,0xa0,
-0x06,0xfc,0x00,0xdf,0x30,0xef,0x20,0x04,0xfc,0x8f,0x80,0x00,0x0a,0xff,0xe0,0x00,
-0x00,0x3f,0xf8,0x00,0x00,0x0b,0xff,0xe1,0x00,0x05,0xfc,0x8f,0x90,0x00,0xef,0x30,
-0xef,0x30,0x8f,0x24,0x00,0xf0,0x06,0xbf,0x50,0x04,0xfc,0x03,0xfc,0x00,0xcf,0x30,
-0x0a,0xf3,0x3f,0xb0,0x00,0x2f,0xba,0xf2,0x00,0x00,0x9f,0xfa,0xb0,0x03,0x12,0x20,
-0xcf,0x00,0x31,0x00,0xff,0x00,0x09,0x00,0x00,0xe8,0x06,0xfd,0x1a,0xf6,0x48,0x88,
-0x9f,0xf2,0x00,0x00,0xaf,0x60,0x00,0x06,0xfa,0x00,0x00,0x2f,0xe1,0x00,0x00,0xcf,
-0x40,0x00,0x08,0xf8,0x00,0x00,0x4f,0xf8,0x88,0x84,0x8f,0xff,0xff,0xf8,0x01,0x10,
-0x3f,0xf8,0x3f,0xb2,0x3f,0x90,0x02,0x00,0x70,0xa1,0x3f,0xf8,0x14,0x42,0xcf,0x10,
-0x0f,0x05,0xf9,0x0d,0x1f,0xd0,0x00,0x0a,0xf3,0x00,0x04,0xf9,0x00,0x00,0xdf,0x00,
-0x00,0x7f,0x60,0x00,0x1f,0xc0,0x00,0x0b,0xf2,0x00,0x05,0xf8,0x11,0x1e,0xfd,0x4f,
-0xfa,0x02,0xf0,0x33,0xfd,0x2f,0xde,0xfd,0x44,0x30,0x00,0x74,0x00,0x04,0xfe,0x00,
-0x0a,0xbf,0x50,0x1f,0x49,0xc0,0x8e,0x03,0xf3,0x22,0x22,0x21,0xff,0xff,0xfc,0x55,
-0x55,0x53,0x4f,0x90,0x05,0xf4,0x05,0xdf,0xd4,0x03,0xfc,0x6e,0xf1,0x25,0x20,0xaf,
-0x30,0x7d,0xef,0xf4,0x6f,0x92,0xaf,0x47,0xfb,0x7e,0xf4,0x0a,0xfd,0xaf,0x60,0x4f,
-0x80,0x00,0x04,0xf8,0x00,0x00,0x07,0x00,0xf0,0x15,0xfb,0xde,0x90,0x4f,0xf9,0xcf,
-0x74,0xf9,0x01,0xfc,0x4f,0x80,0x0f,0xd4,0xf8,0x01,0xfc,0x4f,0xf8,0xcf,0x74,0xf9,
-0xde,0x90,0x03,0xcf,0xd5,0x01,0xfe,0x8e,0xf2,0x7f,0x60,0x3b,0x48,0xf4,0x88,0x00,
-0xf0,0x01,0x27,0x31,0xfe,0x8d,0xf3,0x03,0xcf,0xd5,0x00,0x00,0x00,0x3f,0x90,0x00,
-0x03,0xf9,0x07,0x00,0xf0,0x0a,0x5d,0xea,0xf9,0x2f,0xe9,0xdf,0x97,0xf6,0x04,0xf9,
-0x8f,0x40,0x3f,0x97,0xf5,0x03,0xf9,0x2f,0xd6,0xcf,0x90,0x5d,0xe9,0xf9,0x03,0xab,
-0x05,0xf3,0x17,0x8c,0xf3,0x6f,0x70,0x3f,0x88,0xff,0xff,0xfa,0x6f,0x93,0x33,0x21,
-0xef,0x99,0xe4,0x02,0xbf,0xe9,0x00,0x01,0xbf,0x90,0x9f,0xb5,0x0c,0xf1,0x0d,0xff,
-0xf6,0x4d,0xf6,0x20,0xcf,0x00,0x0c,0xf0,0x00,0x05,0x00,0xf0,0x1b,0x04,0xde,0x9f,
-0xb1,0xff,0x9c,0xfb,0x6f,0x70,0x2f,0xb8,0xf4,0x02,0xfb,0x6f,0x60,0x2f,0xb1,0xff,
-0x8c,0xfb,0x04,0xde,0xaf,0xb0,0x20,0x04,0xfa,0x0d,0xb7,0xdf,0x40,0x7d,0xfd,0x60,
-0x5f,0x80,0x00,0x05,0xf8,0x00,0x00,0x07,0x00,0xf4,0x01,0xfa,0xcf,0xa0,0x5f,0xe8,
-0xcf,0x65,0xf8,0x04,0xf9,0x5f,0x80,0x3f,0x95,0xf8,0x03,0x07,0x00,0x83,0x2e,0x82,
-0xd7,0x00,0x03,0xfa,0x3f,0xa3,0x03,0x00,0x89,0x02,0xf8,0x02,0xd7,0x00,0x00,0x03,
-0xfa,0x02,0x00,0x96,0xf9,0x5c,0xf7,0x9f,0xa0,0x4f,0x80,0x00,0x00,0x04,0x00,0xf5,
-0x0b,0xbf,0x60,0x4f,0x89,0xf9,0x00,0x4f,0xef,0xb0,0x00,0x4f,0xff,0xc0,0x00,0x4f,
-0xda,0xf6,0x00,0x4f,0x81,0xef,0x20,0x4f,0x80,0x5f,0xb0,0x4b,0x00,0x02,0x03,0x00,
-0xf7,0x0c,0x4f,0x9c,0xfb,0x4d,0xfa,0x04,0xff,0x8d,0xff,0x9c,0xf5,0x4f,0x80,0x5f,
-0x80,0x5f,0x84,0xf8,0x04,0xf8,0x04,0xf8,0x4f,0x80,0x4f,0x80,0x4f,0x0b,0x00,0xb6,
-0x80,0x5f,0x9c,0xfb,0x05,0xff,0x8c,0xf6,0x5f,0x80,0x4f,0x9c,0x00,0x00,0x07,0x00,
-0x50,0x90,0x03,0xcf,0xd6,0x01,0xa7,0x07,0xf0,0x10,0x60,0x1f,0xc8,0xf4,0x00,0xee,
-0x6f,0x60,0x1f,0xc1,0xfe,0x8c,0xf5,0x03,0xcf,0xd6,0x00,0x4f,0xbd,0xe9,0x04,0xfe,
-0x7b,0xf7,0x4f,0x80,0x1f,0xc4,0xf8,0x00,0xfd,0x07,0x00,0x30,0xff,0x8c,0xf7,0x15,
-0x00,0x02,0xa5,0x01,0x00,0x07,0x00,0xd0,0x05,0xde,0x8f,0x92,0xfe,0x8d,0xf9,0x7f,
-0x60,0x3f,0x98,0xf4,0x03,0x07,0x00,0x00,0x0e,0x00,0x34,0x05,0xde,0xaf,0x8c,0x01,
-0x01,0x07,0x00,0xc2,0x04,0xfa,0xd9,0x4f,0xfc,0x64,0xf9,0x00,0x4f,0x80,0x04,0xf8,
-0x05,0x00,0xf0,0x06,0x07,0xef,0xc4,0x04,0xfb,0x5e,0xf0,0x5f,0xa2,0x23,0x00,0x8f,
-0xfe,0x60,0x24,0x04,0xdf,0x16,0xfa,0x5d,0xf1,0x18,0x05,0xf1,0x08,0x07,0x70,0x00,
-0xfe,0x00,0xff,0xff,0x15,0xff,0x50,0x0f,0xe0,0x00,0xfe,0x00,0x0f,0xe0,0x00,0xdf,
-0x81,0x05,0xee,0x10,0xb5,0x00,0x26,0x04,0xf9,0x07,0x00,0x00,0x67,0x00,0xf2,0x5d,
-0x08,0xee,0x9f,0x90,0xcf,0x20,0x9f,0x46,0xf6,0x0d,0xf0,0x1f,0xb2,0xfa,0x00,0xcf,
-0x6f,0x40,0x06,0xfe,0xf0,0x00,0x1f,0xfa,0x00,0x00,0xcf,0x50,0x00,0xbf,0x00,0xf9,
-0x08,0xf3,0x7f,0x45,0xfd,0x0b,0xf0,0x3f,0x79,0xff,0x2e,0xb0,0x0e,0xae,0x8f,0x9f,
-0x70,0x0b,0xff,0x3a,0xff,0x30,0x07,0xfe,0x06,0xff,0x00,0x03,0xf9,0x01,0xfb,0x00,
-0x7f,0x70,0xcf,0x20,0xee,0x7f,0x90,0x05,0xff,0xe1,0x00,0x0f,0xfa,0x00,0x07,0xff,
-0xf2,0x01,0xee,0x5f,0xa0,0x9f,0x60,0xbf,0x30,0xdf,0x20,0x9f,0x57,0xf7,0x0e,0xf0,
-0x2f,0xb3,0xfa,0x00,0xdf,0x8f,0x50,0x07,0xff,0xf0,0x00,0x2f,0x55,0x00,0xf0,0x08,
-0x0b,0xf0,0x00,0x29,0xf9,0x00,0x03,0xfc,0x10,0x00,0x7f,0xff,0xff,0x13,0x77,0xbf,
-0xb0,0x00,0x1e,0xe1,0x00,0x0c,0xf4,0x4d,0x03,0xf6,0x1b,0x04,0xff,0x87,0x71,0x8f,
-0xff,0xff,0x20,0x00,0x16,0x00,0x1e,0xc0,0x07,0xf3,0x00,0x8f,0x10,0x09,0xf1,0x01,
-0xce,0x00,0xbf,0x40,0x03,0xec,0x00,0x09,0xf0,0x00,0x8f,0x10,0x07,0xf2,0x00,0x2f,
-0xa0,0x00,0x39,0x00,0xe3,0x01,0x00,0xf0,0x16,0x43,0x00,0x8f,0x40,0x0e,0xb0,0x0c,
-0xd0,0x0c,0xd0,0x09,0xf3,0x01,0xef,0x08,0xf6,0x0c,0xe0,0x0c,0xd0,0x0d,0xc0,0x6f,
-0x60,0x65,0x00,0x07,0xec,0x30,0xba,0x2f,0xbc,0xf9,0xf7,0x2a,0x10,0x9e,0x3c,0x05,
-0x10,0x30,0x9d,0x07,0xf0,0x15,0x4f,0x50,0x00,0x00,0x00,0x04,0xee,0x40,0x0c,0xff,
-0xff,0xfc,0x3e,0x40,0xe4,0x22,0x22,0x00,0x4e,0x3e,0x20,0x00,0x00,0x00,0x8d,0xe3,
-0x11,0x11,0x00,0x3e,0x4d,0xff,0xff,0xfb,0x3e,0x40,0x21,0x00,0x10,0x50,0x2c,0x00,
-0x10,0x60,0x74,0x08,0x24,0x40,0x00,0x3c,0x00,0x10,0x5f,0x0b,0x00,0x20,0x4e,0xe4,
-0x05,0x00,0x11,0x3c,0x3f,0x00,0xf0,0x08,0x02,0x22,0x24,0xed,0x80,0x00,0x00,0x00,
-0x2e,0x4e,0x30,0x01,0x11,0x13,0xe0,0x4e,0x3b,0xff,0xff,0xfd,0x00,0x5e,0xe4,0x2c,
-0x00,0x21,0x6f,0x40,0x58,0x2a,0x01,0x68,0x08,0x20,0x2b,0x20,0x24,0x00,0xf3,0x15,
-0xee,0x20,0x00,0x00,0x2e,0xa0,0xae,0x20,0x00,0x1d,0xa0,0x00,0xad,0x10,0x1d,0xd4,
-0x00,0x04,0xdd,0x13,0xcc,0xf2,0x02,0xfc,0xc3,0x00,0x0f,0x20,0x2f,0x00,0x00,0x00,
-0xf2,0x02,0xf0,0x00,0x0b,0x00,0xe0,0xf3,0x13,0xf0,0x00,0x00,0x0d,0xff,0xfd,0x00,
-0x00,0x00,0x0c,0xff,0xfc,0x11,0x00,0x3d,0x23,0xf0,0x00,0x27,0x00,0xf0,0x0a,0x33,
-0xf2,0x02,0xf3,0x30,0x3f,0xfd,0x10,0x1d,0xff,0x30,0x6e,0x30,0x00,0x3e,0x60,0x00,
-0x5e,0x40,0x4e,0x50,0x00,0x00,0x4e,0x8e,0x76,0x00,0x26,0x3c,0x30,0xde,0x2a,0x11,
-0xa0,0x91,0x00,0x00,0xd2,0x00,0x20,0x0e,0xfe,0x61,0x0b,0xf0,0x15,0xf4,0xf6,0x00,
-0x00,0x00,0xe9,0x09,0xe0,0x00,0x00,0x7f,0x10,0x1f,0x70,0x00,0x1f,0x80,0x00,0x8f,
-0x10,0x08,0xe0,0x00,0x00,0xe8,0x01,0xfc,0x88,0x88,0x8c,0xf1,0x9f,0xff,0xff,0xff,
-0xff,0xca,0x08,0xf0,0x2e,0x3b,0xc5,0x00,0x00,0x02,0x1e,0x86,0xf2,0x00,0x4d,0xf7,
-0xf0,0x0d,0x50,0x4f,0x60,0x7f,0xb9,0xf1,0x0e,0x60,0x09,0xff,0xe6,0x04,0xe0,0x00,
-0xcf,0xa1,0xd4,0x5c,0x00,0x0e,0x60,0x0c,0x63,0xe0,0x01,0x20,0x00,0xe4,0x0e,0x60,
-0x00,0x00,0x6e,0x00,0x4f,0x70,0x00,0x7f,0x50,0x00,0x4d,0xfe,0xfd,0x40,0x00,0x00,
-0x02,0x42,0x3b,0x01,0xf0,0x0b,0x11,0x10,0x00,0x00,0x00,0xbf,0xff,0x72,0x00,0x08,
-0xc1,0xdf,0xc3,0xf5,0x04,0x98,0x02,0xe2,0x07,0xb4,0x5d,0x00,0x01,0x00,0x1b,0x4d,
-0x5f,0x00,0xf0,0x3e,0xbe,0x68,0x00,0x00,0x00,0x09,0x6a,0xd0,0x00,0x00,0x00,0xb9,
-0x1a,0xa0,0x00,0x00,0x9d,0x00,0x88,0xc4,0x25,0xb9,0x60,0x00,0x69,0xe9,0xf6,0x70,
-0x00,0x00,0x05,0x25,0x00,0x00,0x00,0x28,0x01,0x32,0x00,0x00,0x01,0xee,0xef,0xef,
-0xd5,0x00,0x0d,0x90,0xbc,0x10,0x5f,0x70,0x0b,0xc1,0x0b,0xd0,0x03,0xf3,0x07,0xfd,
-0x1a,0xc0,0x00,0x99,0x0b,0x7a,0xfc,0x10,0x00,0x5c,0x0b,0x60,0x61,0x00,0x00,0x5c,
-0x08,0xe4,0x00,0xf3,0x04,0x89,0x01,0xf4,0x00,0x00,0x02,0xf3,0x00,0x6f,0x60,0x00,
-0x5e,0x70,0x00,0x04,0xdf,0xef,0xd5,0x00,0x8a,0x00,0xf0,0x20,0x0c,0xee,0xee,0xee,
-0x10,0x01,0xfa,0x66,0x6b,0xb0,0x00,0x6f,0x10,0x00,0xd5,0x00,0x0b,0xb0,0x00,0x5e,
-0x00,0x00,0x7e,0x00,0x6d,0x40,0x00,0x2d,0xf3,0x7b,0x10,0x00,0x0d,0x8b,0x3d,0xd0,
-0x00,0x03,0xf0,0xd4,0x8e,0x30,0x00,0x3f,0x15,0x10,0xf3,0xc8,0x0b,0x60,0x8d,0x00,
-0x00,0x02,0xdf,0xfd,0xba,0x01,0x20,0x33,0x00,0xa8,0x00,0xc0,0xaa,0x60,0x00,0x00,
-0xef,0xfa,0x10,0xcb,0xbb,0xba,0xaa,0xbc,0xd8,0x09,0xf0,0x03,0xc0,0x5f,0xff,0xd0,
-0xbc,0x00,0x22,0x21,0x0c,0xc0,0x13,0x33,0x20,0xcc,0x05,0xee,0xec,0x0c,0x64,0x02,
-0xd0,0xc9,0xcb,0xde,0xed,0xb9,0x00,0x0e,0xff,0xa0,0x00,0x00,0x56,0x63,0x38,0x00,
-0xf0,0x2a,0x57,0x62,0x04,0x00,0x06,0xef,0xff,0xf1,0xad,0x47,0xfb,0x30,0x24,0x0a,
-0x39,0xfa,0x00,0x00,0x00,0xa2,0x03,0xc5,0x00,0x00,0x0a,0x20,0x00,0xc8,0x00,0x00,
-0xa2,0x00,0x98,0x00,0x00,0x0a,0x22,0xc6,0x00,0x00,0x00,0xa7,0xcf,0xb0,0x00,0x00,
-0x0a,0xa0,0x5f,0xc5,0x23,0x50,0x20,0x00,0x4d,0xff,0xff,0x49,0x0a,0xf0,0x19,0x54,
-0x00,0x89,0x99,0x99,0x99,0x8c,0x2f,0xd1,0x11,0x2b,0xb0,0x65,0x06,0xef,0xfb,0x0b,
-0x93,0xdf,0xff,0xb0,0xfd,0x00,0x69,0xdb,0x02,0x20,0x00,0x0b,0xb0,0xeb,0x00,0x00,
-0xbb,0x0f,0xd0,0x00,0x0b,0xb0,0x76,0x09,0x00,0x81,0xe0,0x00,0x0b,0xea,0xff,0xaa,
-0xaa,0xe0,0xf2,0x01,0xf0,0x2b,0x18,0xde,0xd8,0x10,0x00,0x3e,0xad,0x6a,0xbe,0x30,
-0x1e,0x70,0xc5,0x70,0x7e,0x18,0xb0,0x0c,0x57,0x00,0xb8,0xc5,0x00,0xbd,0x60,0x05,
-0xce,0x30,0x24,0x06,0x90,0x2e,0xd4,0x4b,0xe3,0xe7,0xc7,0xd9,0xcb,0x8b,0x04,0xc6,
-0xd9,0x2f,0xa9,0x00,0x00,0xbf,0x20,0x5f,0x71,0x01,0x7e,0x50,0x00,0x3b,0xff,0xfb,
-0x37,0x02,0xf2,0x32,0x20,0x00,0x00,0x03,0xbd,0x80,0x00,0x00,0x03,0xe6,0x4b,0xb0,
-0x00,0x00,0xa7,0x00,0x0f,0x12,0x62,0x0a,0x60,0x00,0xe7,0xff,0xf4,0x6d,0x10,0x6d,
-0xbf,0xff,0xb0,0x9f,0xef,0x7a,0xff,0xfa,0x07,0xe9,0xcf,0xff,0xfe,0x23,0xe1,0x4f,
-0xff,0xff,0xe1,0x96,0x1e,0xff,0xff,0xff,0x8c,0x38,0xff,0xff,0xff,0xfb,0xcf,0xfd,
-0xdd,0xdd,0xdd,0x90,0x11,0x77,0x02,0x20,0x61,0x00,0x6b,0x03,0x11,0xd2,0x06,0x00,
-0xf1,0x05,0xe3,0x00,0x02,0x43,0x33,0x37,0xe3,0x00,0xaf,0xff,0xff,0xff,0xf4,0x03,
-0x66,0x66,0x66,0x66,0x60,0x09,0x67,0x02,0x90,0x08,0xf9,0x88,0x88,0x95,0x00,0x07,
-0xd1,0x00,0x99,0x02,0x01,0x06,0x00,0x25,0x05,0x90,0xb9,0x02,0x20,0x68,0x50,0xc1,
-0x01,0xf0,0x24,0x48,0xc9,0x10,0x00,0x00,0x8c,0xa4,0x4c,0x30,0x00,0x03,0x22,0x8b,
-0x20,0x00,0x00,0x5a,0xc5,0x10,0x00,0x06,0x86,0x97,0x30,0x00,0x1c,0xb0,0x10,0xab,
-0x00,0x0a,0xf2,0x7f,0x82,0xf9,0x00,0xaf,0x29,0xfa,0x1f,0x90,0x01,0xda,0x04,0x09,
-0xd1,0x00,0x01,0x8b,0x9a,0x81,0x76,0x02,0xfa,0x0a,0xfd,0x10,0x0d,0x63,0x36,0x9d,
-0x10,0xd3,0x00,0xb0,0xbd,0x0d,0x30,0x0a,0xc9,0xe3,0xd3,0x00,0x00,0x0d,0x3d,0x30,
-0x00,0x00,0xd3,0x09,0x00,0x60,0x40,0x00,0x00,0xd3,0xcf,0xff,0x74,0x04,0x01,0xbc,
-0x0b,0x10,0x53,0x06,0x00,0xf0,0x2b,0xa9,0x6a,0x90,0x00,0x00,0x06,0x70,0x00,0x8d,
-0xc7,0x00,0x0a,0x10,0x00,0x00,0x09,0x40,0x1d,0x10,0x00,0x47,0x33,0x90,0xa3,0x38,
-0xcf,0xda,0x33,0x80,0xc0,0x68,0x58,0x00,0x04,0xb0,0xb0,0x00,0x4f,0x90,0x00,0xa2,
-0xa1,0x00,0xdf,0xf3,0x00,0x83,0x2c,0x20,0x00,0x00,0x01,0xc0,0x02,0xbb,0xbb,0xbb,
-0xbb,0x3f,0x01,0x11,0x4d,0xf2,0x00,0xf0,0x1b,0xf0,0x87,0x00,0x00,0x00,0x7f,0x2f,
-0x40,0x19,0xd8,0x6e,0xae,0x30,0x0a,0xb3,0x7b,0x60,0xd4,0x01,0xf1,0x00,0x9b,0x4f,
-0x20,0x5b,0x00,0x01,0xbf,0x60,0x08,0x70,0x00,0x04,0xf0,0x00,0xa5,0x00,0x00,0x4f,
-0x00,0x0c,0x30,0x0b,0x00,0x10,0xe2,0x0b,0x00,0x02,0x01,0x00,0xf0,0x2e,0x07,0xe8,
-0x01,0xe0,0xd2,0x1e,0x0d,0x20,0x8e,0x80,0x00,0x10,0x0d,0xf9,0x1f,0xfd,0x0b,0xf7,
-0x01,0x00,0x00,0x01,0xfb,0x50,0x00,0x07,0xcf,0xe8,0x20,0x00,0x4e,0xf7,0x08,0xdf,
-0xd8,0x11,0xfa,0x40,0x00,0x09,0x88,0x88,0x31,0xff,0xff,0xf6,0x00,0x00,0x01,0xc8,
-0x00,0x2d,0xf9,0x00,0x1d,0xf6,0x00,0x2a,0x00,0x3f,0xff,0x01,0x00,0x20,0xa2,0xbb,
-0x01,0x00,0x20,0xb8,0x00,0x32,0x05,0x00,0x01,0x00,0x11,0x9f,0x06,0x00,0x0a,0x0d,
-0x00,0x30,0xff,0xff,0xf7,0x0d,0x00,0x3f,0x88,0x88,0x40,0x27,0x00,0x03,0x11,0xaf,
-0x46,0x0d,0x00,0x01,0x00,0x20,0xa1,0x88,0x01,0x00,0x12,0x85,0x9c,0x00,0x11,0x01,
-0x13,0x00,0x51,0xf7,0x08,0x88,0x8b,0xfa,0x3b,0x00,0x02,0xe6,0x04,0x31,0x06,0xfb,
-0x30,0x62,0x04,0x20,0xff,0xb2,0x0d,0x00,0x31,0xf5,0xaf,0xf7,0x00,0x05,0x20,0x4e,
-0x60,0x6b,0x04,0x16,0x00,0x0d,0x05,0x09,0x0d,0x00,0x06,0x4e,0x00,0xd0,0xf2,0x18,
-0x88,0x89,0xff,0x88,0x88,0x10,0x00,0x00,0xaf,0x80,0x00,0x34,0x01,0x20,0xf7,0x80,
-0x06,0x00,0xf0,0x08,0xff,0xcf,0xd2,0x00,0x01,0xaf,0xc6,0xf5,0x5f,0xf5,0x04,0xff,
-0xa0,0x5f,0x50,0x3e,0xf5,0x0a,0x40,0x05,0xf5,0x00,0x29,0x87,0x05,0x11,0x50,0x27,
-0x02,0x34,0xf5,0x00,0x00,0x0d,0x00,0xf0,0x06,0x09,0x60,0x00,0x0c,0x70,0x00,0x00,
-0xbf,0x10,0x07,0xf6,0x00,0x07,0x8b,0xfa,0x88,0xef,0x98,0x20,0xdf,0xff,0x6a,0x02,
-0xf1,0x19,0x00,0x00,0x6f,0x1a,0xd0,0x10,0x00,0x2f,0x46,0xf1,0xad,0x0e,0xc0,0x00,
-0xea,0x6f,0x1a,0xd2,0xf8,0x00,0x09,0xe7,0xf1,0xad,0x7f,0x20,0x00,0x6f,0x8f,0x1a,
-0xdb,0xb0,0x00,0x00,0x06,0xf1,0xad,0x00,0x00,0x1f,0x89,0x00,0x20,0x81,0xaa,0x01,
-0x00,0x50,0xa5,0x00,0x00,0x8f,0x10,0x1d,0x0e,0x90,0xf1,0x00,0x00,0x89,0x99,0xdf,
-0x99,0x99,0x3e,0x1c,0x00,0xf3,0x03,0xf6,0xea,0x00,0x8f,0x10,0x3f,0x6e,0xa0,0x08,
-0xf1,0x03,0xf6,0xed,0x77,0xcf,0x87,0x9f,0x6e,0x16,0x00,0x41,0x9f,0x10,0x3e,0x60,
-0x2c,0x00,0x07,0x37,0x00,0x30,0x00,0x00,0x1f,0x40,0x02,0x61,0x66,0x7f,0xc6,0x66,
-0x30,0x2f,0xe6,0x02,0x62,0x2f,0x70,0x1f,0x90,0x1f,0x90,0x0c,0x00,0x71,0x04,0x44,
-0x5f,0xb4,0x44,0x30,0xaf,0xfb,0x00,0xc2,0xaf,0x66,0x7f,0xc6,0x6b,0xf2,0xaf,0x33,
-0x4f,0xb3,0x39,0xf2,0x12,0x00,0x62,0x69,0x11,0x3f,0xa1,0x15,0x91,0x42,0x00,0xf2,
-0x18,0x00,0x5f,0xff,0xff,0xff,0xf0,0x00,0x05,0xf8,0x77,0x66,0xcf,0x00,0x00,0x5f,
-0x39,0xc0,0x09,0xf0,0x00,0x05,0xf3,0x5f,0xc0,0x9f,0x00,0x00,0x5f,0x30,0x6e,0x29,
-0xf0,0x00,0x7a,0xf9,0x77,0x87,0xcf,0x74,0xbe,0x00,0x31,0x90,0x09,0xf0,0xc4,0x01,
-0x11,0xdb,0xc4,0x01,0x20,0x4f,0x70,0x0d,0x00,0xc6,0x2e,0xe0,0x00,0x07,0x7d,0xe0,
-0x00,0xb3,0x00,0x00,0xcf,0xe7,0x0f,0x06,0x21,0xba,0x10,0x67,0x02,0x00,0xdc,0x04,
-0x70,0x48,0x88,0x8d,0xf9,0x88,0x70,0x08,0x40,0x00,0x10,0xfd,0xf2,0x01,0x01,0x81,
-0x01,0x20,0x02,0xf8,0x78,0x06,0x00,0x14,0x00,0x79,0x40,0x00,0x78,0x89,0xfc,0x88,
-0x82,0x1a,0x00,0x02,0xb5,0x01,0x30,0xf8,0x09,0x99,0x01,0x00,0x15,0x50,0x55,0x00,
-0x21,0x7e,0x10,0xf6,0x02,0x00,0xe0,0x04,0x71,0x79,0x99,0x9e,0xc9,0x98,0x10,0x0b,
-0x2a,0x02,0x02,0x1f,0x02,0x01,0xb0,0x01,0x11,0xfc,0x0c,0x00,0x10,0xfd,0x28,0x00,
-0x01,0xfd,0x11,0x40,0x00,0x3d,0xfa,0x00,0x1a,0x10,0x10,0xf6,0x06,0x00,0x90,0xfd,
-0x9f,0xc8,0x76,0x78,0xa5,0x0d,0x20,0x3b,0x76,0x00,0x00,0x1b,0x02,0x01,0x55,0x00,
-0x70,0x13,0x46,0x50,0x00,0x3e,0xff,0xff,0x03,0x07,0xc2,0x76,0x68,0xf6,0x10,0x00,
+0x00,0x60,0x3b,0xf4,0x10,0x0d,0x0e,0x09,0x88,0x19,0xf8,0xff,0xff,0xff,0xff,0xff,
+0x75,0x72,0x1f,0xb5,0x21,0x51,0x2f,0x50,0x4d,0x5a,0x4d,0x5b,0x4d,0x5d,0x4d,0x76,
+0x4d,0x7d,0x4d,0x82,0x4d,0x89,0x4d,0x8b,0x4d,0x9b,0x4d,0xa8,0x4d,0xdc,0x4d,0xf4,
+0x4d,0xfb,0x4d,0xfe,0x4d,0x1b,0x4e,0x26,0x4e,0x35,0x4e,0x40,0x4e,0x46,0x4e,0x4b,
+0x4e,0x4d,0x4e,0x60,0x4e,0x7f,0x4e,0x98,0x4e,0x9d,0x4e,0x9e,0x4e,0x9f,0x4e,0xa5,
+0x4e,0xac,0x4e,0xcf,0x4e,0xd6,0x4e,0xdb,0x4e,0xeb,0x4e,0x14,0x4f,0x2d,0x4f,0x31,
+0x4f,0x3e,0x4f,0x3f,0x4f,0x5b,0x4f,0x5d,0x4f,0x62,0x4f,0x8c,0x4f,0x9f,0x4f,0xac,
+0x4f,0xc4,0x4f,0xe9,0x4f,0x03,0x50,0x15,0x50,0x1f,0x50,0x50,0x50,0x6f,0x50,0x82,
+0x50,0x95,0x50,0x99,0x50,0x9b,0x50,0xb5,0x50,0xb7,0x50,0xb8,0x50,0xbc,0x50,0xc6,
+0x50,0xc7,0x50,0xc8,0x50,0xcc,0x50,0xda,0x50,0x16,0x51,0x4a,0x51,0x4d,0x51,0x56,
+0x51,0x57,0x51,0x67,0x51,0x6d,0x51,0x75,0x51,0x79,0x51,0x7a,0x51,0x80,0x51,0x86,
+0x51,0x87,0x51,0x9d,0x51,0x9e,0x51,0xbf,0x51,0xc5,0x51,0xef,0x51,0xf0,0x51,0x25,
+0x52,0x55,0x52,0x58,0x52,0x66,0x52,0x89,0x52,0x90,0x52,0x97,0x52,0x9a,0x52,0xa4,
+0x52,0xb1,0x52,0xef,0x52,0x13,0x53,0x19,0x53,0x1a,0x53,0x1d,0x53,0x26,0x53,0x33,
+0x53,0x3a,0x53,0x3f,0x53,0x40,0x53,0x43,0x53,0x58,0x53,0x5c,0x53,0x5d,0x53,0x5e,
+0x53,0x61,0x53,0x76,0x53,0x7b,0x53,0x7f,0x53,0x9a,0x53,0xdc,0x53,0x9f,0x54,0xaf,
+0x54,0xfe,0x54,0x1e,0x55,0xb8,0x55,0x2e,0x56,0x30,0x56,0x4a,0x56,0x4e,0x56,0x5b,
+0x56,0x5d,0x56,0x63,0x56,0x66,0x56,0x78,0x56,0x80,0x56,0x90,0x56,0x97,0x56,0xdb,
+0x56,0x47,0x57,0x4a,0x57,0x81,0x57,0x9a,0x57,0xbb,0x57,0xee,0x57,0x23,0x58,0x66,
+0x58,0x6a,0x58,0x77,0x58,0x79,0x58,0x7a,0x58,0x81,0x58,0x8e,0x58,0xcd,0x58,0x1b,
+0x59,0xa0,0x5a,0xa7,0x5a,0xa8,0x5a,0xc8,0x5a,0xd3,0x5a,0xd9,0x5a,0xdc,0x5a,0xea,
+0x5a,0x09,0x5b,0x36,0x5b,0x3b,0x5b,0x3c,0x5b,0x48,0x5b,0x49,0x5b,0x54,0x5b,0x57,
+0x5b,0x5d,0x5b,0x5e,0x5b,0x5f,0x5b,0x8a,0x5b,0x8e,0x5b,0x90,0x5b,0x9f,0x5b,0xa5,
+0x5b,0x35,0x5d,0x36,0x5d,0x3e,0x5d,0x42,0x5d,0x5c,0x5d,0x86,0x5d,0x88,0x5d,0x8d,
+0x5d,0x90,0x5d,0x95,0x5d,0xa5,0x5d,0xc3,0x5d,0xce,0x5d,0xdf,0x5d,0xf6,0x5d,0x30,
+0x5e,0x46,0x5e,0x4a,0x5e,0x50,0x5e,0x5f,0x5e,0x65,0x5e,0x81,0x5e,0x87,0x5e,0x98,
+0x5e,0xb2,0x5e,0xc1,0x5e,0xd5,0x5e,0xd8,0x5e,0xdc,0x5e,0xe1,0x5e,0xee,0x5e,0xf9,
+0x5e,0xfa,0x5e,0xfe,0x5e,0x07,0x5f,0x13,0x5f,0x15,0x5f,0x3b,0x5f,0x4d,0x5f,0x70,
+0x5f,0x75,0x5f,0xb2,0x5f,0xbf,0x5f,0x15,0x60,0x5f,0x60,0x6f,0x60,0x9b,0x60,0xb2,
+0x60,0x19,0x61,0x48,0x61,0x60,0x61,0x66,0x61,0x7a,0x61,0x82,0x61,0x86,0x61,0x90,
+0x61,0x97,0x61,0x9b,0x61,0xa3,0x61,0xce,0x61,0x19,0x62,0x22,0x62,0x4e,0x62,0x51,
+0x62,0x57,0x62,0x59,0x62,0x7f,0x62,0xc7,0x62,0xd3,0x62,0xe2,0x62,0xf1,0x62,0xf5,
+0x62,0xf7,0x62,0xf8,0x62,0x1f,0x63,0x20,0x63,0x22,0x63,0x2a,0x63,0x2b,0x63,0x44,
+0x63,0x66,0x63,0xc8,0x63,0xf5,0x63,0xfd,0x63,0x17,0x64,0x1a,0x64,0x1d,0x64,0x2a,
+0x64,0x36,0x64,0x3c,0x64,0x44,0x64,0x7f,0x64,0x86,0x64,0x89,0x64,0x8e,0x64,0x95,
+0x64,0x98,0x64,0x9f,0x64,0xa1,0x64,0xa7,0x64,0xa9,0x64,0xc4,0x64,0xc8,0x64,0xd7,
+0x64,0xec,0x64,0xff,0x64,0x00,0x65,0x07,0x65,0x09,0x65,0x0c,0x65,0x1b,0x65,0x35,
+0x65,0x5e,0x65,0x6f,0x65,0x70,0x65,0x7f,0x65,0x92,0x65,0xbe,0x65,0xbf,0x65,0xfb,
+0x65,0x42,0x66,0x44,0x66,0x4f,0x66,0x50,0x66,0x59,0x66,0x6f,0x66,0x7a,0x66,0x7c,
+0x66,0xcf,0x66,0xec,0x66,0x14,0x67,0x35,0x67,0x71,0x67,0x8c,0x67,0x96,0x67,0x98,
+0x67,0xcf,0x67,0xed,0x67,0xc5,0x68,0x52,0x69,0x69,0x69,0x71,0x69,0x73,0x69,0xaf,
+0x69,0xbb,0x69,0xe4,0x69,0xf2,0x69,0x54,0x6a,0xa0,0x6a,0xb2,0x6a,0xb3,0x6a,0xb4,
+0x6a,0xb5,0x6a,0xcb,0x6a,0xda,0x6a,0x05,0x6b,0x24,0x6b,0x84,0x6b,0xb0,0x6b,0xe2,
+0x6b,0xf1,0x6b,0x09,0x6c,0x0f,0x6c,0x25,0x6c,0x32,0x6c,0x38,0x6c,0x6b,0x6c,0x82,
+0x6c,0x8b,0x6c,0x91,0x6c,0xd8,0x6c,0x47,0x6d,0x4b,0x6d,0x55,0x6d,0x6b,0x6d,0x7c,
+0x6d,0xe0,0x6d,0xe6,0x6d,0xfb,0x6d,0x21,0x6e,0x3f,0x6e,0x4e,0x6e,0x4f,0x6e,0x88,
+0x6e,0x10,0x6f,0x4e,0x6f,0xb3,0x6f,0xbb,0x6f,0x09,0x70,0x0a,0x70,0x1f,0x70,0x71,
+0x70,0x76,0x70,0x86,0x70,0xd4,0x70,0x18,0x71,0x7c,0x71,0x97,0x71,0x98,0x71,0xa9,
+0x71,0xc9,0x71,0x10,0x72,0xd7,0x72,0x3d,0x73,0x4e,0x73,0x56,0x73,0xae,0x73,0x00,
+0x74,0x6f,0x74,0x78,0x74,0x9c,0x74,0xb5,0x74,0xc0,0x74,0xc6,0x74,0xda,0x74,0xcc,
+0x75,0xcd,0x75,0xd4,0x75,0x1a,0x76,0x33,0x76,0x34,0x76,0x3e,0x76,0x44,0x76,0x48,
+0x76,0x5b,0x76,0x6f,0x76,0xfc,0x76,0x35,0x77,0xbc,0x77,0x0a,0x78,0x0c,0x78,0x8a,
+0x78,0xd1,0x78,0x22,0x79,0x40,0x79,0x4b,0x79,0x5b,0x79,0x81,0x79,0x9d,0x79,0xb9,
+0x79,0xca,0x79,0xd1,0x79,0xe7,0x79,0x3f,0x7a,0x46,0x7a,0x7c,0x7a,0x99,0x7a,0xe7,
+0x7a,0xf1,0x7a,0x10,0x7b,0x14,0x7b,0x8d,0x7b,0xb4,0x7b,0xe8,0x7b,0x0e,0x7c,0x4b,
+0x7c,0x55,0x7c,0x6a,0x7c,0x7f,0x7c,0x80,0x7c,0x92,0x7c,0x94,0x7c,0xa0,0x7c,0xa5,
+0x7c,0xc1,0x7c,0xd1,0x7c,0xe3,0x7c,0xf0,0x7c,0x1a,0x7d,0x2a,0x7d,0x38,0x7d,0x39,
+0x7d,0x44,0x7d,0x7e,0x7d,0x81,0x7d,0x8d,0x7d,0xdc,0x7d,0x66,0x7e,0xbe,0x7e,0xde,
+0x7e,0xf9,0x7e,0x4b,0x7f,0x4c,0x7f,0x55,0x7f,0x67,0x7f,0x76,0x7f,0xbf,0x7f,0xc2,
+0x7f,0x1c,0x80,0x4d,0x80,0x58,0x80,0xc3,0x80,0x3a,0x81,0x43,0x81,0x57,0x81,0x7a,
+0x81,0x85,0x81,0xc2,0x81,0x41,0x82,0xc7,0x82,0x2c,0x83,0x54,0x83,0x8d,0x83,0xb1,
+0x83,0x1b,0x84,0x1d,0x85,0x1f,0x85,0x7d,0x85,0xaf,0x85,0x52,0x86,0x0a,0x87,0x9c,
+0x87,0xab,0x87,0xad,0x87,0xb8,0x87,0xc0,0x87,0xfb,0x87,0x2c,0x88,0x2d,0x88,0x4d,
+0x88,0x57,0x88,0xcf,0x88,0xd1,0x88,0xd6,0x88,0xdf,0x88,0xe6,0x88,0x18,0x89,0x22,
+0x89,0x33,0x89,0x48,0x89,0x50,0x89,0x58,0x89,0x68,0x89,0x7a,0x89,0x7d,0x89,0x8b,
+0x89,0xb2,0x89,0xb6,0x89,0xc1,0x89,0xc3,0x89,0xdc,0x89,0xdd,0x89,0xee,0x89,0xf4,
+0x89,0xfa,0x89,0x0f,0x8a,0x1b,0x8a,0x99,0x8a,0xac,0x8a,0xb6,0x8a,0xc0,0x8a,0xc7,
+0x8a,0xd0,0x8a,0xda,0x8a,0xf0,0x8b,0x0c,0x8c,0x75,0x8c,0xc7,0x8c,0xd5,0x8c,0x03,
+0x8d,0x2d,0x8d,0x2f,0x8d,0x3f,0x8d,0x43,0x8d,0xb4,0x8d,0xfb,0x8d,0x1a,0x8e,0x48,
+0x8e,0x53,0x8e,0x59,0x8e,0x7a,0x8e,0x7f,0x8e,0x88,0x8e,0x99,0x8e,0xc4,0x8e,0xe1,
+0x8e,0x40,0x8f,0x50,0x8f,0x56,0x8f,0x6a,0x8f,0x6f,0x8f,0x73,0x8f,0x81,0x8f,0x82,
+0x8f,0x9a,0x8f,0x9b,0x8f,0x9e,0x8f,0xa3,0x8f,0xa9,0x8f,0xc2,0x8f,0xc8,0x8f,0xda,
+0x8f,0xdf,0x8f,0x38,0x90,0x9d,0x90,0x1b,0x91,0x1d,0x91,0x1f,0x91,0x2d,0x91,0x65,
+0x91,0x54,0x92,0x7f,0x92,0xc5,0x92,0xe6,0x92,0x31,0x93,0x68,0x93,0xa1,0x93,0xc7,
+0x94,0xd0,0x94,0xd9,0x94,0xdb,0x94,0xe2,0x94,0xe3,0x94,0x2c,0x95,0x90,0x95,0x94,
+0x95,0x9d,0x95,0xa0,0x95,0xb4,0x95,0xc0,0x95,0xc7,0x95,0xde,0x95,0xe4,0x95,0xec,
+0x95,0xf8,0x95,0x16,0x96,0x29,0x96,0x32,0x96,0x46,0x96,0x4b,0x96,0x50,0x96,0x57,
+0x96,0x98,0x96,0xac,0x96,0xae,0x96,0xb2,0x96,0x1c,0x97,0x23,0x97,0x43,0x97,0x4f,
+0x97,0x51,0x97,0x52,0x97,0x55,0x97,0x56,0x97,0x58,0x97,0x60,0x97,0x8b,0x97,0x9c,
+0x97,0x9f,0x97,0xae,0x97,0xbf,0x97,0xd4,0x97,0xec,0x97,0x2b,0x98,0x9b,0x98,0x25,
+0x99,0x2b,0x99,0x95,0x99,0xa7,0x99,0x24,0x9a,0x28,0x9a,0x44,0x9c,0xf5,0x9d,0x28,
+0x9e,0x2e,0x9e,0x9a,0x9e,0xa0,0x9e,0x51,0xef,0x58,0xef,0x5b,0xef,0x5c,0xef,0x5d,
+0xef,0x61,0xef,0x63,0xef,0x65,0xef,0x69,0xef,0x6c,0xef,0x71,0xef,0x76,0xef,0x77,
+0xef,0x78,0xef,0x8e,0xef,0x93,0xef,0x98,0xef,0x9b,0xef,0x9c,0xef,0x9d,0xef,0xa1,
+0xef,0xa2,0xef,0xa3,0xef,0xa4,0xef,0xb7,0xef,0xb8,0xef,0xbe,0xef,0xc0,0xef,0xc1,
+0xef,0xc4,0xef,0xc7,0xef,0xc8,0xef,0xc9,0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,
+0xf0,0x15,0xf0,0x17,0xf0,0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,
+0xf0,0x74,0xf0,0xab,0xf0,0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,
+0xf1,0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x00,
+0x01,0x00,0x2f,0xfa,0x00,0x01,0x00,0x03,0x13,0xfc,0x08,0x00,0x17,0xf4,0x14,0x00,
+0x60,0xfb,0xfa,0x00,0xfe,0xf7,0x00,0x40,0x00,0x2e,0x01,0x00,0x01,0x00,0x4e,0x02,
+0x04,0x00,0x02,0x16,0x00,0x2f,0xe3,0x00,0x01,0x00,0x15,0x1f,0xe7,0x1e,0x00,0x0a,
+0x03,0x88,0x00,0xb2,0xf8,0x00,0xfe,0x00,0x00,0xf4,0xfe,0xf8,0xfc,0x00,0xf1,0x93,
+0x00,0x7d,0xff,0x00,0x00,0xfe,0xff,0xfb,0xfd,0x92,0x00,0x3f,0xfd,0x00,0xfe,0xdd,
+0x00,0x04,0x1c,0xfd,0x0a,0x00,0x19,0xff,0x1f,0x00,0x16,0xfe,0x70,0x00,0x00,0x0b,
+0x00,0x7f,0xf7,0x00,0xfe,0x00,0xfe,0xfc,0xfe,0x9c,0x00,0x0a,0x15,0x02,0x3c,0x00,
+0x11,0xfe,0x34,0x00,0x26,0xfe,0xfd,0x30,0x00,0x75,0xe4,0x00,0x00,0x00,0xed,0x00,
+0xeb,0x24,0x00,0x20,0xfd,0xfe,0x20,0x00,0x01,0x2b,0x00,0x0d,0x44,0x00,0x10,0xfd,
+0x08,0x00,0x1f,0xfd,0x68,0x00,0x07,0x1f,0xfe,0x43,0x01,0x0d,0x19,0xef,0xdf,0x00,
+0x01,0x0c,0x00,0x10,0xfd,0x38,0x00,0x29,0xfc,0xfa,0x8c,0x01,0xa6,0x02,0xfa,0x00,
+0x00,0xeb,0xfe,0xeb,0xf7,0x00,0xe4,0x2b,0x00,0x35,0xff,0xf4,0xfb,0x0c,0x00,0x72,
+0xd7,0x00,0x00,0x00,0xee,0x00,0xed,0x61,0x01,0x51,0x00,0xfc,0x00,0xff,0xff,0x25,
+0x01,0x1f,0x01,0xe0,0x01,0x01,0x10,0xfd,0xd2,0x00,0x1f,0xfc,0x97,0x00,0x0b,0x10,
+0xfb,0xba,0x00,0x06,0x5f,0x00,0x09,0x7b,0x02,0xc0,0xe6,0xe4,0x00,0x00,0xf4,0xfd,
+0xea,0xfe,0x02,0x00,0x02,0x02,0x60,0x00,0xd3,0xef,0xf7,0x00,0xf7,0xeb,0xf9,0xf8,
+0x00,0xf9,0xf8,0xfb,0xf8,0xfa,0x1a,0x01,0x66,0xea,0xf0,0x00,0x00,0xf8,0xff,0x2b,
+0x01,0x50,0xfb,0xfc,0x00,0x00,0xfb,0xdc,0x00,0x14,0xff,0x7d,0x01,0x42,0x02,0x00,
+0xf1,0xfa,0xb4,0x02,0x03,0x08,0x02,0x33,0x01,0xfd,0xfd,0x6c,0x01,0x17,0x00,0xaf,
+0x02,0x14,0xf0,0x20,0x01,0x15,0x01,0x20,0x01,0x02,0xb0,0x01,0x04,0xcd,0x00,0xf0,
+0x0a,0x02,0xfb,0xe9,0xf1,0x00,0x00,0xf1,0xfd,0xf6,0xfe,0x02,0xf6,0x02,0x02,0x01,
+0x02,0x00,0x02,0xfa,0xf9,0xfe,0xfc,0xf9,0xfc,0xfa,0x03,0x02,0x36,0xfe,0xfd,0x02,
+0xc5,0x00,0x2a,0x01,0xfd,0x99,0x01,0x02,0x48,0x00,0x1e,0xfd,0xb2,0x01,0x1f,0xfe,
+0xcc,0x01,0x20,0x1c,0xfe,0xaa,0x02,0x1e,0x00,0x01,0x00,0x12,0xff,0x43,0x02,0x1f,
+0xff,0x5a,0x03,0x10,0x1f,0xff,0x1d,0x00,0x10,0x1e,0x02,0xdd,0x01,0x19,0x02,0xa5,
+0x00,0x10,0x02,0x7d,0x03,0x0f,0x01,0x00,0x24,0x0b,0xed,0x00,0x1f,0xf7,0x2c,0x00,
+0x0b,0x23,0xfe,0xfe,0xd7,0x01,0x1c,0xee,0x6c,0x02,0x20,0xfe,0x02,0xe4,0x01,0x3e,
+0x05,0x00,0x02,0x89,0x02,0x0e,0xe2,0x03,0x06,0x58,0x03,0x1c,0xef,0x63,0x00,0x2d,
+0xff,0x01,0x80,0x01,0x1f,0xf3,0xd8,0x00,0x24,0x1f,0xfc,0x24,0x00,0x10,0x1f,0xfe,
+0x19,0x00,0x1b,0x04,0x69,0x03,0x10,0x02,0xb6,0x24,0x4d,0x04,0x00,0x04,0x05,0x21,
+0x00,0x30,0x06,0x07,0x08,0xc2,0x0c,0xf1,0x05,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,
+0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xff,
+0x0d,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,
+0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,0xff,
+0xff,0xc5,0x02,0x33,0x03,0x20,0x03,0x02,0x2e,0x03,0x4b,0x06,0x07,0x06,0x08,0x1f,
+0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,
+0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,
+0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,
+0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,0x00,
+0x02,0x1f,0x24,0x2d,0x03,0xff,0xff,0xa8,0x50,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const uint8_t lz4BitmapData[] ={
+0xf2,0xff,0x13,0x2f,0xc1,0xfb,0x1f,0xb0,0xfa,0x0f,0xa0,0xf9,0x06,0x31,0xd9,0x1e,
+0xa0,0x9a,0x8b,0x9a,0x8b,0x98,0x89,0x43,0x44,0x00,0x1f,0x0b,0x70,0x00,0x5d,0x0f,
+0x30,0x2f,0xff,0xff,0xf7,0x01,0xb8,0x6d,0x10,0x00,0xe4,0x7a,0x00,0x8f,0xff,0xff,
+0xf0,0x15,0xf2,0xd6,0x20,0x06,0xc0,0xf2,0x00,0x08,0xa2,0xf0,0x00,0x00,0x09,0x70,
+0x00,0x05,0xdb,0x30,0x09,0xfe,0xff,0x40,0xfd,0x02,0xfb,0x0f,0xe1,0x04,0x40,0x7f,
+0xf8,0x10,0x00,0x4b,0xfe,0x31,0x41,0x04,0xfb,0x4f,0x90,0x1f,0xc0,0xdf,0xce,0xf7,
+0x01,0x8e,0xc5,0x00,0x00,0xb5,0x00,0x0a,0xfc,0x10,0x00,0x00,0x5e,0x2c,0x80,0xb3,
+0x00,0x5e,0x0b,0x96,0xc0,0x00,0x0c,0xfe,0x4e,0x20,0x00,0x00,0x10,0xb7,0x00,0x00,
+0x00,0x06,0xc5,0xdd,0x50,0x00,0x2e,0x2e,0x77,0xf0,0x00,0xa7,0x0e,0x65,0xf0,0x00,
+0x00,0x06,0xee,0x70,0x01,0xbf,0xd5,0x00,0x00,0x9f,0x9d,0xf0,0x00,0x0a,0xf0,0x9f,
+0x00,0x00,0x4f,0xdf,0x50,0x00,0x05,0xff,0x90,0x66,0x04,0xfb,0xbf,0x6e,0xb0,0x8f,
+0x50,0xdf,0xf6,0x04,0xfd,0x6a,0xff,0x30,0x06,0xdf,0xe9,0xfd,0x10,0x9b,0x9b,0x9a,
+0x44,0x00,0x01,0x00,0x02,0xe2,0x00,0xd9,0x00,0x7f,0x10,0x0d,0xb0,0x00,0xf7,0x00,
+0x2f,0x60,0x03,0xf5,0x00,0x2f,0x60,0x00,0xf8,0x00,0x0b,0xc0,0x00,0x4f,0x30,0x00,
+0xad,0x10,0x00,0x91,0x10,0x00,0x9a,0x00,0x2e,0x70,0x07,0xf1,0x02,0xf6,0x00,0xea,
+0x00,0xdc,0x00,0xcd,0x00,0xdc,0x00,0xf9,0x03,0xf4,0x0a,0xd0,0x5f,0x30,0x74,0x00,
+0x00,0x99,0x00,0x43,0x88,0x23,0x8e,0xfe,0xf8,0x02,0xff,0x20,0x0d,0x79,0xc0,0x05,
+0x01,0x50,0x00,0x4b,0x40,0x00,0x05,0xf6,0x00,0x00,0x5f,0x60,0x0a,0xff,0xff,0xfb,
+0x6a,0xcf,0xca,0x70,0x0e,0x00,0xf0,0x17,0x00,0x1f,0x72,0xf6,0x5f,0x26,0x70,0x02,
+0x22,0x04,0xff,0xf4,0x15,0x55,0x10,0x1d,0x91,0xea,0x00,0x00,0xd8,0x00,0x03,0xf2,
+0x00,0x08,0xd0,0x00,0x0d,0x70,0x00,0x3f,0x20,0x00,0x8c,0x00,0x00,0xe7,0x11,0x00,
+0xf8,0x22,0x09,0xc0,0x00,0x0e,0x70,0x00,0x02,0xbf,0xd6,0x00,0xdf,0x8c,0xf5,0x3f,
+0x90,0x1f,0xa5,0xf7,0x00,0xfd,0x6f,0x70,0x0f,0xd5,0xf7,0x00,0xfc,0x3f,0x90,0x2f,
+0xa0,0xdf,0x8c,0xf5,0x02,0xbf,0xd7,0x00,0x02,0x8d,0x1c,0xff,0xf1,0x95,0xcf,0x10,
+0x0c,0xf1,0x00,0x05,0x00,0xf0,0xb5,0x04,0xcf,0xe8,0x02,0xfe,0x8c,0xf6,0x7f,0x50,
+0x3f,0xa0,0x00,0x06,0xf7,0x00,0x03,0xfd,0x00,0x03,0xee,0x10,0x03,0xee,0x20,0x02,
+0xef,0x97,0x77,0x6f,0xff,0xff,0xf0,0x05,0xdf,0xd7,0x03,0xfe,0x8c,0xf6,0x38,0x30,
+0x3f,0x90,0x01,0x29,0xf6,0x00,0x8f,0xfa,0x00,0x02,0x59,0xf7,0x5a,0x30,0x1f,0xc4,
+0xfe,0x8b,0xf8,0x05,0xdf,0xe8,0x00,0x00,0x02,0xff,0x10,0x00,0x0b,0xff,0x10,0x00,
+0x5f,0xff,0x10,0x01,0xea,0xcf,0x10,0x09,0xe1,0xcf,0x10,0x3f,0x82,0xcf,0x30,0x9f,
+0xff,0xff,0xf1,0x35,0x55,0xdf,0x50,0x00,0x00,0xcf,0x10,0x0a,0xff,0xff,0x90,0xbf,
+0x88,0x85,0x0d,0xc0,0x00,0x00,0xff,0xff,0xb1,0x09,0x95,0x9f,0x90,0x00,0x00,0xfd,
+0x2a,0x60,0x0f,0xd0,0xef,0x8b,0xf8,0x03,0xcf,0xe8,0x00,0x00,0x2a,0xe9,0x00,0x3f,
+0xfa,0x50,0x0d,0xe2,0x10,0x03,0xfd,0xef,0xd2,0x5f,0xe6,0x9f,0xb5,0xf7,0x00,0xee,
+0x3f,0x90,0x0e,0xe0,0xcf,0x9b,0xf9,0x01,0xae,0xe9,0x00,0x9f,0xff,0xff,0xe4,0x88,
+0x89,0xfb,0x00,0x00,0x7f,0x30,0x00,0x0e,0xc0,0x00,0x07,0xf5,0x00,0x00,0xee,0x00,
+0x00,0x6f,0x70,0x00,0x0d,0xf1,0x00,0x05,0xf9,0x00,0x00,0x44,0x00,0xf0,0x3c,0xef,
+0x8c,0xf6,0x2f,0xa0,0x3f,0x90,0xee,0x38,0xf6,0x04,0xff,0xfc,0x01,0xed,0x69,0xf7,
+0x5f,0x70,0x0f,0xc2,0xfe,0x8b,0xf9,0x05,0xcf,0xe9,0x00,0x02,0xcf,0xd5,0x01,0xef,
+0x8d,0xf3,0x5f,0x80,0x3f,0x96,0xf6,0x01,0xfc,0x3f,0xc2,0x7f,0xc0,0x9f,0xfe,0xfa,
+0x00,0x23,0x7f,0x50,0x09,0xbf,0xc0,0x01,0xfd,0x80,0x00,0x1e,0xa1,0xd9,0x00,0x00,
+0x00,0x00,0x01,0xd9,0x1e,0xa0,0x2e,0x82,0xe8,0x00,0x01,0x00,0xf1,0x2f,0x85,0x0f,
+0x91,0xf6,0x6d,0x00,0x10,0x00,0x01,0x7a,0x02,0x9f,0xfb,0x8f,0xe9,0x40,0x9f,0xd7,
+0x10,0x04,0xbf,0xfa,0x00,0x02,0x9c,0x00,0x00,0x00,0x2f,0xff,0xff,0x81,0x88,0x88,
+0x84,0x18,0x88,0x88,0x42,0xff,0xff,0xf8,0x3b,0x40,0x00,0x03,0xff,0xd6,0x00,0x00,
+0x6b,0xff,0x30,0x04,0x9f,0xf4,0x2e,0xff,0x92,0x03,0xd6,0x00,0x01,0x00,0xf0,0x44,
+0x08,0xef,0xb2,0x7f,0xca,0xfc,0x69,0x10,0xee,0x00,0x06,0xf9,0x00,0x5f,0xb0,0x00,
+0xbf,0x00,0x00,0x12,0x00,0x00,0xbc,0x00,0x00,0xcd,0x00,0x00,0x04,0xbe,0xfd,0x70,
+0x00,0x00,0x8e,0x61,0x13,0xbc,0x00,0x05,0xe2,0x00,0x00,0x0b,0x70,0x0d,0x60,0x3c,
+0xea,0x14,0xd0,0x3f,0x11,0xf8,0x4f,0x21,0xf0,0x5e,0x07,0xe0,0x3f,0x00,0xf1,0x6c,
+0x0a,0xb0,0x5f,0x03,0xf0,0x6d,0x09,0xd1,0xbf,0x2a,0x90,0x2f,0x12,0xde,0x6b,0xfa,
+0x00,0x0d,0x90,0x57,0x00,0xf0,0x60,0x03,0xea,0x42,0x36,0x00,0x00,0x00,0x29,0xdf,
+0xea,0x00,0x00,0x00,0x0b,0xf7,0x00,0x00,0x01,0xff,0xd0,0x00,0x00,0x7f,0xcf,0x30,
+0x00,0x0d,0xe2,0xf9,0x00,0x03,0xf8,0x0c,0xf0,0x00,0x9f,0xa8,0xcf,0x50,0x0f,0xff,
+0xff,0xfb,0x06,0xf8,0x00,0x0c,0xf2,0xcf,0x30,0x00,0x7f,0x80,0x2f,0xff,0xfc,0x50,
+0x2f,0xe8,0x9f,0xf3,0x2f,0xb0,0x07,0xf7,0x2f,0xc1,0x2b,0xf3,0x2f,0xff,0xff,0xa0,
+0x2f,0xc4,0x4a,0xf6,0x2f,0xb0,0x04,0xfa,0x2f,0xe8,0x8d,0xf6,0x2f,0xff,0xfd,0x80,
+0x00,0x8e,0xfd,0x60,0x00,0xaf,0xc9,0xdf,0x70,0x2f,0xd0,0x00,0xfe,0x06,0xf8,0x00,
+0x01,0x20,0x7f,0x70,0x00,0x00,0x09,0x00,0xf1,0x14,0x10,0x2f,0xc0,0x00,0xfe,0x00,
+0xbf,0xc9,0xdf,0x70,0x00,0x9e,0xfd,0x60,0x00,0x2f,0xff,0xe9,0x10,0x2f,0xe8,0xbf,
+0xd0,0x2f,0xb0,0x08,0xf8,0x2f,0xb0,0x02,0xfc,0x2f,0xb0,0x00,0xfe,0x08,0x00,0x00,
+0x10,0x00,0x31,0xe8,0xbf,0xd1,0x20,0x00,0xe0,0xff,0xff,0xf0,0x2f,0xe8,0x88,0x80,
+0x2f,0xb0,0x00,0x00,0x2f,0xd8,0x88,0xd7,0x03,0x11,0x60,0x0c,0x00,0x00,0x04,0x00,
+0x00,0x18,0x00,0x00,0x20,0x00,0xf1,0x03,0xff,0xff,0xd2,0xfe,0x88,0x87,0x2f,0xb0,
+0x00,0x02,0xfe,0x88,0x83,0x2f,0xff,0xff,0x62,0xfb,0x21,0x00,0x22,0x02,0xfb,0x28,
+0x00,0xf0,0x19,0x00,0x7d,0xfd,0x80,0x00,0x9f,0xd9,0xcf,0xa0,0x1f,0xe0,0x00,0xab,
+0x05,0xf9,0x00,0x11,0x10,0x6f,0x80,0x8f,0xff,0x25,0xf9,0x02,0x4d,0xf2,0x1f,0xe0,
+0x00,0xcf,0x20,0x9f,0xd9,0xaf,0xf1,0x00,0x7d,0xfe,0xb3,0x2d,0x00,0x61,0x9f,0x52,
+0xfb,0x00,0x09,0xf5,0x09,0x00,0x86,0xfe,0x88,0x8c,0xf5,0x2f,0xff,0xff,0xff,0x12,
+0x00,0x04,0x09,0x00,0x46,0x50,0x0f,0xd0,0xfd,0x03,0x00,0x00,0x36,0x01,0x4a,0x70,
+0x00,0x07,0xf7,0x07,0x00,0xf0,0x0c,0x8c,0x20,0x8f,0x66,0xfd,0x9f,0xf2,0x08,0xef,
+0xc4,0x00,0x2f,0xb0,0x07,0xfc,0x02,0xfb,0x04,0xfe,0x10,0x2f,0xb2,0xef,0x30,0x02,
+0xfc,0xcf,0xfa,0x00,0xf6,0x06,0xf5,0x00,0x02,0xff,0xbf,0xe1,0x00,0x2f,0xc0,0x8f,
+0xa0,0x02,0xfb,0x00,0xdf,0x50,0x2f,0xb0,0x03,0xfe,0x10,0xb4,0x00,0x0b,0x07,0x00,
+0xf0,0x48,0xfe,0x88,0x86,0x2f,0xff,0xff,0xc0,0x2f,0xf7,0x00,0x02,0xff,0x82,0xff,
+0xd0,0x00,0x7f,0xf8,0x2f,0xef,0x30,0x0d,0xef,0x82,0xfa,0xf9,0x03,0xf9,0xf8,0x2f,
+0xaa,0xe0,0x9f,0x5f,0x82,0xfa,0x4f,0x5e,0xa5,0xf8,0x2f,0xb0,0xee,0xf4,0x5f,0x82,
+0xfb,0x08,0xfe,0x05,0xf8,0x2f,0xb0,0x2f,0x80,0x5f,0x80,0x2f,0xf1,0x00,0x9f,0x52,
+0xff,0xa0,0x09,0xf5,0x2f,0xff,0x40,0x9f,0x52,0xfc,0xed,0x09,0xf5,0x2f,0xb6,0xf8,
+0x9f,0x52,0xfb,0x0c,0xfb,0xf5,0x2f,0xb0,0x2f,0xdb,0x00,0x10,0x8f,0xd2,0x00,0xf0,
+0x0b,0xdf,0x50,0x00,0x7d,0xfd,0x70,0x00,0x9f,0xda,0xdf,0x80,0x2f,0xe0,0x00,0xef,
+0x15,0xf9,0x00,0x09,0xf5,0x7f,0x70,0x00,0x8f,0x66,0xf8,0xf2,0x00,0x81,0xd0,0x00,
+0xef,0x10,0x9f,0xd9,0xdf,0x90,0x24,0x00,0xf5,0x09,0x2f,0xff,0xfd,0x70,0x2f,0xe9,
+0x9d,0xf8,0x2f,0xb0,0x01,0xfd,0x2f,0xb0,0x05,0xfc,0x2f,0xff,0xff,0xf4,0x2f,0xe8,
+0x86,0x10,0x95,0x01,0x02,0x71,0x01,0x12,0x60,0x4d,0x00,0x5f,0xd0,0x01,0xef,0x16,
+0xf8,0x4d,0x00,0x01,0xe0,0x80,0x00,0x7d,0xff,0xf3,0x00,0x00,0x00,0x3e,0xf1,0x00,
+0x00,0x00,0x13,0x56,0x00,0xe0,0x60,0x02,0xfe,0x89,0xef,0x50,0x2f,0xb0,0x05,0xf9,
+0x02,0xfb,0x00,0x8f,0xd9,0x01,0xff,0x35,0xc1,0x02,0xfe,0x8d,0xf4,0x00,0x2f,0xb0,
+0x4f,0xc0,0x02,0xfb,0x00,0xcf,0x40,0x2f,0xb0,0x04,0xfc,0x00,0x03,0xbf,0xfc,0x40,
+0x1e,0xf9,0x9f,0xf2,0x3f,0xb0,0x05,0xc5,0x0e,0xf9,0x30,0x00,0x01,0xaf,0xfd,0x40,
+0x00,0x01,0x6e,0xf3,0x7e,0x60,0x06,0xf7,0x2f,0xf9,0x8e,0xf4,0x03,0xbe,0xfd,0x50,
+0xcf,0xff,0xff,0xfc,0x68,0x8f,0xf8,0x86,0x00,0x0f,0xf0,0x00,0x04,0x00,0x05,0x4f,
+0x4f,0xa0,0x01,0xfd,0x04,0x00,0x01,0xf0,0x49,0x2f,0xc0,0x03,0xfb,0x0c,0xfb,0x9e,
+0xf5,0x01,0x9e,0xfd,0x50,0xcf,0x40,0x00,0xdf,0x46,0xf9,0x00,0x2f,0xe0,0x1f,0xe0,
+0x06,0xf8,0x00,0xbf,0x30,0xbf,0x30,0x05,0xf8,0x0f,0xd0,0x00,0x0f,0xc5,0xf7,0x00,
+0x00,0xaf,0xbf,0x20,0x00,0x04,0xff,0xc0,0x00,0x00,0x0e,0xf6,0x00,0x00,0xaf,0x30,
+0x3f,0x90,0x0d,0xf1,0x7f,0x60,0x7f,0xd0,0x0f,0xd0,0x3f,0x90,0xbf,0xf1,0x3f,0x90,
+0x0f,0xc0,0xeb,0xf5,0x6f,0x50,0x0c,0xf3,0xf5,0xe8,0x9f,0x20,0x08,0xf9,0xf1,0xac,
+0xce,0x2d,0x00,0xf0,0x25,0x6f,0xfa,0x00,0x01,0xff,0x80,0x2f,0xf7,0x00,0x00,0xdf,
+0x40,0x0e,0xf3,0x00,0x7f,0xa0,0x06,0xfc,0x00,0xdf,0x30,0xef,0x20,0x04,0xfc,0x8f,
+0x80,0x00,0x0a,0xff,0xe0,0x00,0x00,0x3f,0xf8,0x00,0x00,0x0b,0xff,0xe1,0x00,0x05,
+0xfc,0x8f,0x90,0x00,0xef,0x30,0xef,0x30,0x8f,0x24,0x00,0xf0,0x06,0xbf,0x50,0x04,
+0xfc,0x03,0xfc,0x00,0xcf,0x30,0x0a,0xf3,0x3f,0xb0,0x00,0x2f,0xba,0xf2,0x00,0x00,
+0x9f,0xfa,0xb0,0x03,0x12,0x20,0xcf,0x00,0x31,0x00,0xff,0x00,0x09,0x00,0x00,0xe8,
+0x06,0xfd,0x1a,0xf6,0x48,0x88,0x9f,0xf2,0x00,0x00,0xaf,0x60,0x00,0x06,0xfa,0x00,
+0x00,0x2f,0xe1,0x00,0x00,0xcf,0x40,0x00,0x08,0xf8,0x00,0x00,0x4f,0xf8,0x88,0x84,
+0x8f,0xff,0xff,0xf8,0x01,0x10,0x3f,0xf8,0x3f,0xb2,0x3f,0x90,0x02,0x00,0x70,0xa1,
+0x3f,0xf8,0x14,0x42,0xcf,0x10,0x0f,0x05,0xf9,0x0d,0x1f,0xd0,0x00,0x0a,0xf3,0x00,
+0x04,0xf9,0x00,0x00,0xdf,0x00,0x00,0x7f,0x60,0x00,0x1f,0xc0,0x00,0x0b,0xf2,0x00,
+0x05,0xf8,0x11,0x1e,0xfd,0x4f,0xfa,0x02,0xf0,0x33,0xfd,0x2f,0xde,0xfd,0x44,0x30,
+0x00,0x74,0x00,0x04,0xfe,0x00,0x0a,0xbf,0x50,0x1f,0x49,0xc0,0x8e,0x03,0xf3,0x22,
+0x22,0x21,0xff,0xff,0xfc,0x55,0x55,0x53,0x4f,0x90,0x05,0xf4,0x05,0xdf,0xd4,0x03,
+0xfc,0x6e,0xf1,0x25,0x20,0xaf,0x30,0x7d,0xef,0xf4,0x6f,0x92,0xaf,0x47,0xfb,0x7e,
+0xf4,0x0a,0xfd,0xaf,0x60,0x4f,0x80,0x00,0x04,0xf8,0x00,0x00,0x07,0x00,0xf0,0x15,
+0xfb,0xde,0x90,0x4f,0xf9,0xcf,0x74,0xf9,0x01,0xfc,0x4f,0x80,0x0f,0xd4,0xf8,0x01,
+0xfc,0x4f,0xf8,0xcf,0x74,0xf9,0xde,0x90,0x03,0xcf,0xd5,0x01,0xfe,0x8e,0xf2,0x7f,
+0x60,0x3b,0x48,0xf4,0x88,0x00,0xf0,0x01,0x27,0x31,0xfe,0x8d,0xf3,0x03,0xcf,0xd5,
+0x00,0x00,0x00,0x3f,0x90,0x00,0x03,0xf9,0x07,0x00,0xf0,0x0a,0x5d,0xea,0xf9,0x2f,
+0xe9,0xdf,0x97,0xf6,0x04,0xf9,0x8f,0x40,0x3f,0x97,0xf5,0x03,0xf9,0x2f,0xd6,0xcf,
+0x90,0x5d,0xe9,0xf9,0x03,0xab,0x05,0xf3,0x17,0x8c,0xf3,0x6f,0x70,0x3f,0x88,0xff,
+0xff,0xfa,0x6f,0x93,0x33,0x21,0xef,0x99,0xe4,0x02,0xbf,0xe9,0x00,0x01,0xbf,0x90,
+0x9f,0xb5,0x0c,0xf1,0x0d,0xff,0xf6,0x4d,0xf6,0x20,0xcf,0x00,0x0c,0xf0,0x00,0x05,
+0x00,0xf0,0x1b,0x04,0xde,0x9f,0xb1,0xff,0x9c,0xfb,0x6f,0x70,0x2f,0xb8,0xf4,0x02,
+0xfb,0x6f,0x60,0x2f,0xb1,0xff,0x8c,0xfb,0x04,0xde,0xaf,0xb0,0x20,0x04,0xfa,0x0d,
+0xb7,0xdf,0x40,0x7d,0xfd,0x60,0x5f,0x80,0x00,0x05,0xf8,0x00,0x00,0x07,0x00,0xf4,
+0x01,0xfa,0xcf,0xa0,0x5f,0xe8,0xcf,0x65,0xf8,0x04,0xf9,0x5f,0x80,0x3f,0x95,0xf8,
+0x03,0x07,0x00,0x83,0x2e,0x82,0xd7,0x00,0x03,0xfa,0x3f,0xa3,0x03,0x00,0x89,0x02,
+0xf8,0x02,0xd7,0x00,0x00,0x03,0xfa,0x02,0x00,0x96,0xf9,0x5c,0xf7,0x9f,0xa0,0x4f,
+0x80,0x00,0x00,0x04,0x00,0xf5,0x0b,0xbf,0x60,0x4f,0x89,0xf9,0x00,0x4f,0xef,0xb0,
+0x00,0x4f,0xff,0xc0,0x00,0x4f,0xda,0xf6,0x00,0x4f,0x81,0xef,0x20,0x4f,0x80,0x5f,
+0xb0,0x4b,0x00,0x02,0x03,0x00,0xf7,0x0c,0x4f,0x9c,0xfb,0x4d,0xfa,0x04,0xff,0x8d,
+0xff,0x9c,0xf5,0x4f,0x80,0x5f,0x80,0x5f,0x84,0xf8,0x04,0xf8,0x04,0xf8,0x4f,0x80,
+0x4f,0x80,0x4f,0x0b,0x00,0xb6,0x80,0x5f,0x9c,0xfb,0x05,0xff,0x8c,0xf6,0x5f,0x80,
+0x4f,0x9c,0x00,0x00,0x07,0x00,0x50,0x90,0x03,0xcf,0xd6,0x01,0xa7,0x07,0xf0,0x10,
+0x60,0x1f,0xc8,0xf4,0x00,0xee,0x6f,0x60,0x1f,0xc1,0xfe,0x8c,0xf5,0x03,0xcf,0xd6,
+0x00,0x4f,0xbd,0xe9,0x04,0xfe,0x7b,0xf7,0x4f,0x80,0x1f,0xc4,0xf8,0x00,0xfd,0x07,
+0x00,0x30,0xff,0x8c,0xf7,0x15,0x00,0x02,0xa5,0x01,0x00,0x07,0x00,0xd0,0x05,0xde,
+0x8f,0x92,0xfe,0x8d,0xf9,0x7f,0x60,0x3f,0x98,0xf4,0x03,0x07,0x00,0x00,0x0e,0x00,
+0x34,0x05,0xde,0xaf,0x8c,0x01,0x01,0x07,0x00,0xc2,0x04,0xfa,0xd9,0x4f,0xfc,0x64,
+0xf9,0x00,0x4f,0x80,0x04,0xf8,0x05,0x00,0xf0,0x06,0x07,0xef,0xc4,0x04,0xfb,0x5e,
+0xf0,0x5f,0xa2,0x23,0x00,0x8f,0xfe,0x60,0x24,0x04,0xdf,0x16,0xfa,0x5d,0xf1,0x18,
+0x05,0xf1,0x08,0x07,0x70,0x00,0xfe,0x00,0xff,0xff,0x15,0xff,0x50,0x0f,0xe0,0x00,
+0xfe,0x00,0x0f,0xe0,0x00,0xdf,0x81,0x05,0xee,0x10,0xb5,0x00,0x26,0x04,0xf9,0x07,
+0x00,0x00,0x67,0x00,0xf2,0x5d,0x08,0xee,0x9f,0x90,0xcf,0x20,0x9f,0x46,0xf6,0x0d,
+0xf0,0x1f,0xb2,0xfa,0x00,0xcf,0x6f,0x40,0x06,0xfe,0xf0,0x00,0x1f,0xfa,0x00,0x00,
+0xcf,0x50,0x00,0xbf,0x00,0xf9,0x08,0xf3,0x7f,0x45,0xfd,0x0b,0xf0,0x3f,0x79,0xff,
+0x2e,0xb0,0x0e,0xae,0x8f,0x9f,0x70,0x0b,0xff,0x3a,0xff,0x30,0x07,0xfe,0x06,0xff,
+0x00,0x03,0xf9,0x01,0xfb,0x00,0x7f,0x70,0xcf,0x20,0xee,0x7f,0x90,0x05,0xff,0xe1,
+0x00,0x0f,0xfa,0x00,0x07,0xff,0xf2,0x01,0xee,0x5f,0xa0,0x9f,0x60,0xbf,0x30,0xdf,
+0x20,0x9f,0x57,0xf7,0x0e,0xf0,0x2f,0xb3,0xfa,0x00,0xdf,0x8f,0x50,0x07,0xff,0xf0,
+0x00,0x2f,0x55,0x00,0xf0,0x08,0x0b,0xf0,0x00,0x29,0xf9,0x00,0x03,0xfc,0x10,0x00,
+0x7f,0xff,0xff,0x13,0x77,0xbf,0xb0,0x00,0x1e,0xe1,0x00,0x0c,0xf4,0x4d,0x03,0xf6,
+0x1b,0x04,0xff,0x87,0x71,0x8f,0xff,0xff,0x20,0x00,0x16,0x00,0x1e,0xc0,0x07,0xf3,
+0x00,0x8f,0x10,0x09,0xf1,0x01,0xce,0x00,0xbf,0x40,0x03,0xec,0x00,0x09,0xf0,0x00,
+0x8f,0x10,0x07,0xf2,0x00,0x2f,0xa0,0x00,0x39,0x00,0xe3,0x01,0x00,0xf0,0x16,0x43,
+0x00,0x8f,0x40,0x0e,0xb0,0x0c,0xd0,0x0c,0xd0,0x09,0xf3,0x01,0xef,0x08,0xf6,0x0c,
+0xe0,0x0c,0xd0,0x0d,0xc0,0x6f,0x60,0x65,0x00,0x07,0xec,0x30,0xba,0x2f,0xbc,0xf9,
+0xf7,0x2a,0x10,0x9e,0x3c,0x05,0x10,0x30,0x9d,0x07,0xf0,0x15,0x4f,0x50,0x00,0x00,
+0x00,0x04,0xee,0x40,0x0c,0xff,0xff,0xfc,0x3e,0x40,0xe4,0x22,0x22,0x00,0x4e,0x3e,
+0x20,0x00,0x00,0x00,0x8d,0xe3,0x11,0x11,0x00,0x3e,0x4d,0xff,0xff,0xfb,0x3e,0x40,
+0x21,0x00,0x10,0x50,0x2c,0x00,0x10,0x60,0x74,0x08,0x24,0x40,0x00,0x3c,0x00,0x10,
+0x5f,0x0b,0x00,0x20,0x4e,0xe4,0x05,0x00,0x11,0x3c,0x3f,0x00,0xf0,0x08,0x02,0x22,
+0x24,0xed,0x80,0x00,0x00,0x00,0x2e,0x4e,0x30,0x01,0x11,0x13,0xe0,0x4e,0x3b,0xff,
+0xff,0xfd,0x00,0x5e,0xe4,0x2c,0x00,0x11,0x6f,0x37,0x00,0x11,0x40,0x68,0x08,0x20,
+0x2b,0x20,0x24,0x00,0xf3,0x15,0xee,0x20,0x00,0x00,0x2e,0xa0,0xae,0x20,0x00,0x1d,
+0xa0,0x00,0xad,0x10,0x1d,0xd4,0x00,0x04,0xdd,0x13,0xcc,0xf2,0x02,0xfc,0xc3,0x00,
+0x0f,0x20,0x2f,0x00,0x00,0x00,0xf2,0x02,0xf0,0x00,0x0b,0x00,0xe0,0xf3,0x13,0xf0,
+0x00,0x00,0x0d,0xff,0xfd,0x00,0x00,0x00,0x0c,0xff,0xfc,0x11,0x00,0x3d,0x23,0xf0,
+0x00,0x27,0x00,0xf0,0x0a,0x33,0xf2,0x02,0xf3,0x30,0x3f,0xfd,0x10,0x1d,0xff,0x30,
+0x6e,0x30,0x00,0x3e,0x60,0x00,0x5e,0x40,0x4e,0x50,0x00,0x00,0x4e,0x8e,0x76,0x00,
+0x35,0x3c,0x30,0x00,0x01,0x00,0x11,0xa0,0x91,0x00,0x00,0xd2,0x00,0x20,0x0e,0xfe,
+0x61,0x0b,0xf0,0x15,0xf4,0xf6,0x00,0x00,0x00,0xe9,0x09,0xe0,0x00,0x00,0x7f,0x10,
+0x1f,0x70,0x00,0x1f,0x80,0x00,0x8f,0x10,0x08,0xe0,0x00,0x00,0xe8,0x01,0xfc,0x88,
+0x88,0x8c,0xf1,0x9f,0xff,0xff,0xff,0xff,0xca,0x08,0xf0,0x2e,0x3b,0xc5,0x00,0x00,
+0x02,0x1e,0x86,0xf2,0x00,0x4d,0xf7,0xf0,0x0d,0x50,0x4f,0x60,0x7f,0xb9,0xf1,0x0e,
+0x60,0x09,0xff,0xe6,0x04,0xe0,0x00,0xcf,0xa1,0xd4,0x5c,0x00,0x0e,0x60,0x0c,0x63,
+0xe0,0x01,0x20,0x00,0xe4,0x0e,0x60,0x00,0x00,0x6e,0x00,0x4f,0x70,0x00,0x7f,0x50,
+0x00,0x4d,0xfe,0xfd,0x40,0x00,0x00,0x02,0x42,0x3b,0x01,0xf0,0x0b,0x11,0x10,0x00,
+0x00,0x00,0xbf,0xff,0x72,0x00,0x08,0xc1,0xdf,0xc3,0xf5,0x04,0x98,0x02,0xe2,0x07,
+0xb4,0x5d,0x00,0x01,0x00,0x1b,0x4d,0x5f,0x00,0xf0,0x3e,0xbe,0x68,0x00,0x00,0x00,
+0x09,0x6a,0xd0,0x00,0x00,0x00,0xb9,0x1a,0xa0,0x00,0x00,0x9d,0x00,0x88,0xc4,0x25,
+0xb9,0x60,0x00,0x69,0xe9,0xf6,0x70,0x00,0x00,0x05,0x25,0x00,0x00,0x00,0x28,0x01,
+0x32,0x00,0x00,0x01,0xee,0xef,0xef,0xd5,0x00,0x0d,0x90,0xbc,0x10,0x5f,0x70,0x0b,
+0xc1,0x0b,0xd0,0x03,0xf3,0x07,0xfd,0x1a,0xc0,0x00,0x99,0x0b,0x7a,0xfc,0x10,0x00,
+0x5c,0x0b,0x60,0x61,0x00,0x00,0x5c,0x08,0xe4,0x00,0xf3,0x04,0x89,0x01,0xf4,0x00,
+0x00,0x02,0xf3,0x00,0x6f,0x60,0x00,0x5e,0x70,0x00,0x04,0xdf,0xef,0xd5,0x00,0x8a,
+0x00,0xf0,0x20,0x0c,0xee,0xee,0xee,0x10,0x01,0xfa,0x66,0x6b,0xb0,0x00,0x6f,0x10,
+0x00,0xd5,0x00,0x0b,0xb0,0x00,0x5e,0x00,0x00,0x7e,0x00,0x6d,0x40,0x00,0x2d,0xf3,
+0x7b,0x10,0x00,0x0d,0x8b,0x3d,0xd0,0x00,0x03,0xf0,0xd4,0x8e,0x30,0x00,0x3f,0x15,
+0x10,0xf3,0xc8,0x0b,0x60,0x8d,0x00,0x00,0x02,0xdf,0xfd,0xba,0x01,0x20,0x33,0x00,
+0xa8,0x00,0xc0,0xaa,0x60,0x00,0x00,0xef,0xfa,0x10,0xcb,0xbb,0xba,0xaa,0xbc,0xd8,
+0x09,0xf0,0x03,0xc0,0x5f,0xff,0xd0,0xbc,0x00,0x22,0x21,0x0c,0xc0,0x13,0x33,0x20,
+0xcc,0x05,0xee,0xec,0x0c,0x64,0x02,0xd0,0xc9,0xcb,0xde,0xed,0xb9,0x00,0x0e,0xff,
+0xa0,0x00,0x00,0x56,0x63,0x38,0x00,0xf0,0x2a,0x57,0x62,0x04,0x00,0x06,0xef,0xff,
+0xf1,0xad,0x47,0xfb,0x30,0x24,0x0a,0x39,0xfa,0x00,0x00,0x00,0xa2,0x03,0xc5,0x00,
+0x00,0x0a,0x20,0x00,0xc8,0x00,0x00,0xa2,0x00,0x98,0x00,0x00,0x0a,0x22,0xc6,0x00,
+0x00,0x00,0xa7,0xcf,0xb0,0x00,0x00,0x0a,0xa0,0x5f,0xc5,0x23,0x50,0x20,0x00,0x4d,
+0xff,0xff,0x49,0x0a,0xf0,0x19,0x54,0x00,0x89,0x99,0x99,0x99,0x8c,0x2f,0xd1,0x11,
+0x2b,0xb0,0x65,0x06,0xef,0xfb,0x0b,0x93,0xdf,0xff,0xb0,0xfd,0x00,0x69,0xdb,0x02,
+0x20,0x00,0x0b,0xb0,0xeb,0x00,0x00,0xbb,0x0f,0xd0,0x00,0x0b,0xb0,0x76,0x09,0x00,
+0x81,0xe0,0x00,0x0b,0xea,0xff,0xaa,0xaa,0xe0,0xf2,0x01,0xf0,0x2b,0x18,0xde,0xd8,
+0x10,0x00,0x3e,0xad,0x6a,0xbe,0x30,0x1e,0x70,0xc5,0x70,0x7e,0x18,0xb0,0x0c,0x57,
+0x00,0xb8,0xc5,0x00,0xbd,0x60,0x05,0xce,0x30,0x24,0x06,0x90,0x2e,0xd4,0x4b,0xe3,
+0xe7,0xc7,0xd9,0xcb,0x8b,0x04,0xc6,0xd9,0x2f,0xa9,0x00,0x00,0xbf,0x20,0x5f,0x71,
+0x01,0x7e,0x50,0x00,0x3b,0xff,0xfb,0x37,0x02,0xf2,0x32,0x20,0x00,0x00,0x03,0xbd,
+0x80,0x00,0x00,0x03,0xe6,0x4b,0xb0,0x00,0x00,0xa7,0x00,0x0f,0x12,0x62,0x0a,0x60,
+0x00,0xe7,0xff,0xf4,0x6d,0x10,0x6d,0xbf,0xff,0xb0,0x9f,0xef,0x7a,0xff,0xfa,0x07,
+0xe9,0xcf,0xff,0xfe,0x23,0xe1,0x4f,0xff,0xff,0xe1,0x96,0x1e,0xff,0xff,0xff,0x8c,
+0x38,0xff,0xff,0xff,0xfb,0xcf,0xfd,0xdd,0xdd,0xdd,0x90,0x11,0x77,0x02,0x20,0x61,
+0x00,0x6b,0x03,0x11,0xd2,0x06,0x00,0xf1,0x05,0xe3,0x00,0x02,0x43,0x33,0x37,0xe3,
+0x00,0xaf,0xff,0xff,0xff,0xf4,0x03,0x66,0x66,0x66,0x66,0x60,0x09,0x67,0x02,0x90,
+0x08,0xf9,0x88,0x88,0x95,0x00,0x07,0xd1,0x00,0x99,0x02,0x01,0x06,0x00,0x25,0x05,
+0x90,0xb9,0x02,0x20,0x68,0x50,0xc1,0x01,0xf0,0x24,0x48,0xc9,0x10,0x00,0x00,0x8c,
+0xa4,0x4c,0x30,0x00,0x03,0x22,0x8b,0x20,0x00,0x00,0x5a,0xc5,0x10,0x00,0x06,0x86,
+0x97,0x30,0x00,0x1c,0xb0,0x10,0xab,0x00,0x0a,0xf2,0x7f,0x82,0xf9,0x00,0xaf,0x29,
+0xfa,0x1f,0x90,0x01,0xda,0x04,0x09,0xd1,0x00,0x01,0x8b,0x9a,0x81,0x76,0x02,0xfa,
+0x0a,0xfd,0x10,0x0d,0x63,0x36,0x9d,0x10,0xd3,0x00,0xb0,0xbd,0x0d,0x30,0x0a,0xc9,
+0xe3,0xd3,0x00,0x00,0x0d,0x3d,0x30,0x00,0x00,0xd3,0x09,0x00,0x60,0x40,0x00,0x00,
+0xd3,0xcf,0xff,0x74,0x04,0x01,0xbc,0x0b,0x10,0x53,0x06,0x00,0xf0,0x2b,0xa9,0x6a,
+0x90,0x00,0x00,0x06,0x70,0x00,0x8d,0xc7,0x00,0x0a,0x10,0x00,0x00,0x09,0x40,0x1d,
+0x10,0x00,0x47,0x33,0x90,0xa3,0x38,0xcf,0xda,0x33,0x80,0xc0,0x68,0x58,0x00,0x04,
+0xb0,0xb0,0x00,0x4f,0x90,0x00,0xa2,0xa1,0x00,0xdf,0xf3,0x00,0x83,0x2c,0x20,0x00,
+0x00,0x01,0xc0,0x02,0xbb,0xbb,0xbb,0xbb,0x3f,0x01,0x11,0x4d,0xf2,0x00,0xf0,0x1b,
+0xf0,0x87,0x00,0x00,0x00,0x7f,0x2f,0x40,0x19,0xd8,0x6e,0xae,0x30,0x0a,0xb3,0x7b,
+0x60,0xd4,0x01,0xf1,0x00,0x9b,0x4f,0x20,0x5b,0x00,0x01,0xbf,0x60,0x08,0x70,0x00,
+0x04,0xf0,0x00,0xa5,0x00,0x00,0x4f,0x00,0x0c,0x30,0x0b,0x00,0x10,0xe2,0x0b,0x00,
+0x02,0x01,0x00,0xf0,0x2d,0x07,0xe8,0x01,0xe0,0xd2,0x1e,0x0d,0x20,0x8e,0x80,0x00,
+0x10,0x0d,0xf9,0x1f,0xfd,0x0b,0xf7,0x01,0x00,0x00,0x01,0xfb,0x50,0x00,0x07,0xcf,
+0xe8,0x20,0x00,0x4e,0xf7,0x08,0xdf,0xd8,0x11,0xfa,0x40,0x00,0x09,0x88,0x88,0x31,
+0xff,0xff,0xf6,0x00,0x00,0x01,0xc8,0x00,0x2d,0xf9,0x00,0x1d,0xf6,0x00,0x2a,0x00,
+0x3f,0x53,0x01,0x80,0xff,0xa2,0xbb,0xbb,0xbb,0xbb,0xbb,0xb8,0x50,0x00,0x00,0x09,
+0xf0,0x00,0x01,0x00,0x11,0x9f,0x06,0x00,0x0a,0x0d,0x00,0x30,0xff,0xff,0xf7,0x0d,
+0x00,0x3f,0x88,0x88,0x40,0x27,0x00,0x03,0x60,0xaf,0x00,0x00,0x00,0x2f,0xff,0x01,
+0x00,0x20,0xa1,0x88,0x01,0x00,0x21,0x85,0x00,0x01,0x00,0x11,0x01,0x13,0x00,0x51,
+0xf7,0x08,0x88,0x8b,0xfa,0x3b,0x00,0x20,0x6f,0x40,0x16,0x00,0x30,0x06,0xfb,0x30,
+0x07,0x00,0x30,0x6f,0xff,0xb2,0x0d,0x00,0x40,0xf5,0xaf,0xf7,0x00,0x1a,0x00,0x61,
+0x4e,0x60,0x00,0x00,0x06,0xf4,0x37,0x00,0x03,0x27,0x00,0x08,0x0d,0x00,0x06,0x4e,
+0x00,0xc0,0xf2,0x18,0x88,0x89,0xff,0x88,0x88,0x10,0x00,0x00,0xaf,0x80,0x16,0x00,
+0x30,0x7f,0xf7,0x80,0x06,0x00,0xf0,0x0d,0xff,0xcf,0xd2,0x00,0x01,0xaf,0xc6,0xf5,
+0x5f,0xf5,0x04,0xff,0xa0,0x5f,0x50,0x3e,0xf5,0x0a,0x40,0x05,0xf5,0x00,0x29,0x00,
+0x00,0x00,0x5f,0x50,0x27,0x00,0x44,0x05,0xf5,0x00,0x00,0x0d,0x00,0xf0,0x05,0x09,
+0x60,0x00,0x0c,0x70,0x00,0x00,0xbf,0x10,0x07,0xf6,0x00,0x07,0x8b,0xfa,0x88,0xef,
+0x98,0x20,0xdf,0x5b,0x00,0xf1,0x1a,0xf4,0x00,0x00,0x6f,0x1a,0xd0,0x10,0x00,0x2f,
+0x46,0xf1,0xad,0x0e,0xc0,0x00,0xea,0x6f,0x1a,0xd2,0xf8,0x00,0x09,0xe7,0xf1,0xad,
+0x7f,0x20,0x00,0x6f,0x8f,0x1a,0xdb,0xb0,0x00,0x00,0x06,0xf1,0xad,0x00,0x00,0x1f,
+0x89,0x00,0x20,0x81,0xaa,0x01,0x00,0xf0,0x03,0xa5,0x00,0x00,0x8f,0x10,0x00,0x00,
+0x00,0x08,0xf1,0x00,0x00,0x89,0x99,0xdf,0x99,0x99,0x3e,0x1c,0x00,0xf3,0x03,0xf6,
+0xea,0x00,0x8f,0x10,0x3f,0x6e,0xa0,0x08,0xf1,0x03,0xf6,0xed,0x77,0xcf,0x87,0x9f,
+0x6e,0x16,0x00,0x41,0x9f,0x10,0x3e,0x60,0x2c,0x00,0x07,0x37,0x00,0xc1,0x00,0x00,
+0x1f,0x90,0x00,0x00,0x06,0x66,0x7f,0xc6,0x66,0x30,0x45,0x01,0x72,0x90,0x2f,0x70,
+0x1f,0x90,0x1f,0x90,0x0c,0x00,0x71,0x04,0x44,0x5f,0xb4,0x44,0x30,0xaf,0xfb,0x00,
+0xc2,0xaf,0x66,0x7f,0xc6,0x6b,0xf2,0xaf,0x33,0x4f,0xb3,0x39,0xf2,0x12,0x00,0x62,
+0x69,0x11,0x3f,0xa1,0x15,0x91,0x42,0x00,0xf2,0x18,0x00,0x5f,0xff,0xff,0xff,0xf0,
+0x00,0x05,0xf8,0x77,0x66,0xcf,0x00,0x00,0x5f,0x39,0xc0,0x09,0xf0,0x00,0x05,0xf3,
+0x5f,0xc0,0x9f,0x00,0x00,0x5f,0x30,0x6e,0x29,0xf0,0x00,0x7a,0xf9,0x77,0x87,0xcf,
+0x74,0xbe,0x00,0x31,0x90,0x09,0xf0,0xc4,0x01,0x11,0xdb,0xc4,0x01,0x20,0x4f,0x70,
+0x0d,0x00,0xd5,0x2e,0xe0,0x00,0x07,0x7d,0xe0,0x00,0xb3,0x00,0x00,0xcf,0xe7,0x00,
+0x01,0x00,0x20,0xba,0x10,0x06,0x00,0xc0,0x07,0xfd,0x20,0x00,0x00,0x48,0x88,0x8d,
+0xf9,0x88,0x70,0x08,0x40,0x00,0x10,0xfd,0xf2,0x01,0x01,0x81,0x01,0x60,0x02,0xf8,
+0x00,0x00,0x00,0x0c,0x14,0x00,0x79,0x40,0x00,0x78,0x89,0xfc,0x88,0x82,0x1a,0x00,
+0x02,0xb5,0x01,0x30,0xf8,0x09,0x99,0x01,0x00,0x15,0x50,0x55,0x00,0x11,0x7e,0x55,
+0x00,0xc1,0x04,0xfa,0x00,0x00,0x00,0x79,0x99,0x9e,0xc9,0x98,0x10,0x0b,0x2a,0x02,
+0x02,0x1f,0x02,0x01,0xb0,0x01,0x11,0xfc,0x0c,0x00,0x10,0xfd,0x28,0x00,0x20,0x0a,
+0xfc,0x06,0x00,0x10,0x3d,0x2d,0x00,0x30,0x03,0xcf,0xf6,0x06,0x00,0x90,0xfd,0x9f,
+0xc8,0x76,0x78,0xa5,0x0d,0x20,0x3b,0x76,0x00,0x00,0x1b,0x02,0x01,0x55,0x00,0x40,
+0x13,0x46,0x50,0x00,0x7f,0x01,0xf2,0x00,0xfc,0x00,0x00,0x76,0x68,0xf6,0x10,0x00,
 0x01,0x66,0x66,0x9f,0x96,0x66,0x61,0x99,0x02,0xf4,0x25,0x20,0x00,0x78,0x4f,0x48,
 0x71,0x00,0x0b,0xff,0xc4,0xf4,0xce,0xf9,0x00,0x45,0xcc,0x4f,0x4c,0xd5,0x10,0x1b,
 0xdf,0xca,0xfa,0xbc,0x6e,0x30,0x96,0xaf,0xff,0xff,0xdd,0xa0,0x00,0x4d,0xe8,0xf8,
 0xed,0x40,0x04,0xef,0xb1,0x4f,0x41,0xbf,0xd4,0x08,0x20,0x04,0xf4,0x00,0x28,0xae,
 0x00,0x10,0x0f,0x41,0x00,0x20,0x50,0x00,0xf0,0x01,0x2f,0xa3,0x00,0x01,0x00,0x0d,
-0x11,0x0b,0x50,0x03,0x12,0x51,0xfb,0x02,0x06,0x17,0x00,0x12,0x20,0x36,0x03,0xa1,
-0x10,0x00,0x00,0x17,0x77,0x79,0xfb,0x77,0x77,0x13,0xce,0x02,0x00,0x08,0x13,0xf0,
-0x0d,0x01,0xa9,0x00,0x00,0x08,0xf9,0x00,0x09,0xfc,0x10,0x1d,0xfb,0x60,0x00,0x79,
-0xfd,0x10,0x55,0x2f,0x80,0x5f,0x65,0x60,0x00,0x00,0x8f,0x6f,0xd0,0x34,0x00,0x20,
-0xdf,0xe2,0xf3,0x00,0xfc,0x02,0xbf,0xff,0xb3,0x00,0x01,0x9d,0xfe,0x71,0x7f,0xfe,
-0xa2,0x0c,0xb6,0x10,0x00,0x16,0xab,0x78,0x00,0x24,0x6f,0x20,0x84,0x03,0x20,0x20,
-0x45,0x32,0x05,0x11,0x40,0x3e,0x05,0xe1,0xb0,0x00,0x0a,0xe6,0x66,0x66,0xeb,0x00,
-0x00,0x69,0x99,0x99,0x99,0x60,0xbb,0x02,0xf2,0x02,0xfa,0x00,0x00,0x33,0x34,0xbf,
-0xfa,0x20,0x01,0x55,0x55,0x9f,0xe7,0x55,0x51,0x5f,0xff,0xde,0x00,0x30,0x24,0x8f,
-0x40,0x78,0x01,0x28,0xff,0xc1,0x55,0x00,0x51,0x7f,0x20,0x00,0x00,0x9f,0x21,0x00,
-0x71,0x12,0x35,0x66,0x66,0x66,0x65,0x30,0x0e,0x00,0xf1,0x00,0x60,0x00,0x09,0xf4,
-0x33,0x36,0xf6,0x00,0x00,0x7c,0xcc,0xcc,0xcc,0x40,0x04,0xf1,0x00,0xf4,0x14,0xb0,
-0x6f,0x65,0x77,0x77,0x75,0xaf,0x03,0x91,0x6f,0xff,0xff,0x24,0x90,0x00,0x0b,0xe1,
-0x17,0xf2,0x16,0x01,0x5c,0xf7,0x00,0x6f,0x78,0xf1,0x3f,0xe6,0x00,0x02,0xef,0xfa,
-0x00,0x10,0x55,0x00,0x02,0x09,0x00,0x30,0x3f,0x70,0x00,0x1b,0x09,0x20,0xfe,0x20,
-0x67,0x00,0xf0,0x08,0xd4,0xdf,0x60,0x00,0x06,0xdf,0xb0,0x01,0xbf,0xe9,0x28,0xfe,
-0x60,0x00,0x00,0x5d,0xf7,0x06,0x08,0xc0,0x00,0x9b,0x04,0x5a,0x04,0x30,0x0b,0xe0,
-0x00,0x04,0x00,0x51,0xbe,0x00,0x00,0x00,0xfc,0x0d,0x00,0x20,0x9f,0x60,0x0d,0x00,
-0x20,0xaf,0xc0,0x0d,0x00,0x5b,0x07,0xb1,0x00,0x00,0xbe,0x09,0x01,0x40,0x01,0xe5,
-0x00,0x0f,0x3e,0x01,0xf5,0x36,0x29,0x60,0xf6,0x00,0x00,0x1f,0xa0,0xe9,0x0f,0x9a,
-0xf2,0x0b,0xf7,0x0e,0xb8,0xff,0xff,0x27,0xff,0x74,0xff,0xff,0x84,0xf2,0x5e,0xfb,
-0xff,0xc2,0xf6,0x4f,0x20,0x3f,0x74,0xe9,0x0f,0x66,0xf1,0x01,0xf7,0x0e,0x90,0xfb,
-0xfe,0x00,0x1f,0x70,0xe9,0x0f,0x74,0x20,0x01,0xf7,0x0e,0xa0,0x00,0x0c,0x80,0x1f,
-0x70,0xce,0x98,0x8a,0xf7,0x01,0xf7,0x03,0xbd,0xdd,0xc9,0xd6,0x01,0xf4,0x3d,0x60,
-0x00,0x00,0x6f,0x30,0x01,0xf9,0x1e,0x90,0x07,0xf2,0x00,0x1f,0x90,0x9f,0x40,0x9f,
-0x00,0x01,0xf9,0x01,0xeb,0x0a,0xf0,0x00,0x1f,0x90,0x04,0x00,0xec,0x00,0x01,0xf9,
-0x00,0x00,0x2f,0x70,0x00,0x1f,0x90,0x61,0x07,0xf3,0x00,0x01,0xfd,0xef,0x52,0xff,
-0x30,0x00,0x6f,0xfd,0x40,0xcf,0xfe,0x20,0x0d,0xe6,0x03,0xcf,0x83,0xfd,0x10,0x20,
-0x01,0xef,0x80,0x05,0xf7,0x00,0x00,0x03,0x20,0x00,0x04,0x55,0x00,0x30,0x08,0xb0,
-0x29,0x74,0x01,0xf1,0x0b,0xea,0xbf,0xd9,0x66,0x66,0x00,0x4f,0x5e,0x80,0x2f,0xff,
-0xf1,0x0d,0xf3,0xe7,0x02,0xf5,0x5f,0x17,0xff,0x3e,0x70,0x2f,0x55,0xf1,0x8f,0x0d,
-0x00,0x21,0x11,0x6f,0x0d,0x00,0xf5,0x10,0x03,0xf3,0xe7,0x23,0xf5,0x5f,0x10,0x3f,
-0x4f,0xff,0x7f,0x79,0xf1,0x03,0xf6,0xfa,0x42,0xf9,0xfd,0x00,0x3f,0x31,0x00,0x2f,
-0x51,0x00,0x03,0xf3,0x00,0x02,0xf5,0xff,0x00,0xf0,0x21,0x02,0xe5,0x32,0x7f,0x10,
-0x00,0x00,0x9f,0x2d,0xb7,0xf1,0x00,0x00,0x1f,0xb1,0xfc,0xbf,0x87,0x60,0x0a,0xf6,
-0x7f,0xff,0xff,0xfc,0x06,0xff,0x5d,0xc0,0x7f,0x10,0x00,0x7f,0xf5,0x64,0x07,0xf1,
-0x00,0x00,0x5f,0x58,0x88,0xcf,0x98,0x83,0x01,0xf5,0xdf,0xd0,0x01,0x90,0x1f,0x50,
-0x00,0x7f,0x10,0x00,0x01,0xf5,0x00,0x1a,0x00,0x09,0x0d,0x00,0xf0,0x07,0x00,0x0b,
-0x50,0x00,0x15,0xa1,0x00,0x05,0xfa,0x9b,0xef,0xfe,0x70,0x00,0xde,0x7d,0xbd,0xf2,
-0x00,0x00,0x8f,0xa0,0x3a,0x04,0x20,0x6f,0xf9,0x3a,0x04,0x90,0x0a,0xff,0xa8,0x88,
-0xdf,0x88,0x81,0x24,0xea,0x24,0x02,0x31,0x30,0x0e,0x90,0x18,0x06,0x11,0xe9,0x18,
-0x06,0x04,0x0d,0x00,0x00,0x32,0x02,0xfc,0x45,0x10,0x0e,0x95,0x88,0x88,0x88,0x80,
-0x00,0x0c,0x50,0x75,0x19,0x30,0x00,0x07,0xf3,0x1f,0x80,0xe8,0x00,0x00,0xeb,0x07,
-0xf3,0x0a,0xe0,0x00,0x9f,0x72,0xfb,0x00,0x3f,0x90,0x5f,0xf8,0xef,0x31,0x11,0xbf,
-0x85,0xff,0x8e,0xef,0xff,0xff,0xf6,0x03,0xf7,0x13,0xbf,0x58,0xf4,0x00,0x1f,0x70,
-0x0a,0xd0,0x4f,0x30,0x01,0xf7,0x00,0xf9,0x05,0xf2,0x00,0x1f,0x70,0x8f,0x30,0x7f,
-0x10,0x01,0xf7,0x8f,0x92,0x7d,0xe0,0x00,0x1f,0x79,0x90,0x1e,0xd5,0x01,0x03,0xf0,
-0x07,0xe9,0x07,0xf4,0xd6,0x00,0x00,0x7f,0x40,0x6f,0x38,0xf6,0x00,0x0e,0xd0,0x05,
-0xf3,0x07,0x40,0x0b,0xfa,0x9a,0xdf,0xf7,0x01,0xf5,0x23,0xad,0xcc,0xfb,0x67,0x30,
-0x6d,0xfa,0x00,0x0f,0x82,0xfb,0x00,0x1e,0xa0,0x00,0xdb,0xcf,0x20,0x00,0xea,0x00,
-0x0a,0xff,0x60,0x00,0x0e,0xa0,0x02,0xcf,0x80,0x81,0x00,0xea,0x18,0xff,0xfb,0x0e,
-0x70,0x0e,0xac,0xfa,0x17,0xfb,0xf4,0x00,0xea,0x23,0x00,0x0a,0xfb,0xa2,0x01,0x30,
-0x70,0x07,0xa1,0xcf,0x04,0xf1,0x07,0x0c,0xe0,0x00,0x00,0x8f,0x28,0x8f,0xc8,0x85,
-0x02,0xfb,0x1f,0xff,0xff,0xfb,0x0d,0xf9,0x1f,0x70,0x00,0xeb,0x8f,0x06,0x00,0x20,
-0x18,0xf9,0x12,0x00,0x80,0x00,0xe9,0x1f,0xc8,0x88,0xfb,0x00,0xe9,0x12,0x00,0x05,
-0x06,0x00,0x02,0x18,0x00,0x34,0xb7,0x77,0xd9,0x9b,0x01,0x11,0xd3,0xd5,0x06,0x70,
-0x9f,0x21,0xbf,0x21,0x11,0x00,0x2f,0x9f,0x03,0xf1,0x01,0xf9,0x0c,0xf5,0x4b,0xf7,
-0xb7,0x44,0x29,0xff,0x52,0xfa,0x1f,0x60,0x00,0x7d,0xf5,0x5b,0x08,0xf0,0x15,0x3f,
-0xdf,0xfb,0x7f,0xa9,0xf2,0x02,0xf6,0x6e,0x81,0xf6,0x5f,0x20,0x2f,0x50,0xe8,0x1f,
-0x65,0xf2,0x02,0xf5,0x0e,0x81,0xfa,0xff,0x00,0x2f,0x50,0x63,0x1f,0x74,0x20,0x02,
-0xf5,0x00,0x01,0x07,0x05,0x09,0x5c,0x04,0x31,0xd8,0x00,0xae,0x2e,0x07,0xf0,0x14,
-0x06,0xe2,0x00,0x00,0x0d,0xd4,0xff,0xff,0xff,0xe0,0x09,0xf9,0x28,0x88,0x88,0x88,
-0x05,0xff,0x90,0x5e,0x00,0x3f,0x50,0x3e,0xf9,0x04,0xf2,0x06,0xf3,0x00,0x1e,0x90,
-0x2f,0x60,0x8f,0xa1,0x01,0x90,0xf8,0x0b,0xc0,0x00,0x0e,0x90,0x0e,0xa0,0xe8,0x0d,
-0x00,0x70,0x74,0x1f,0x50,0x00,0x0e,0x9b,0xff,0x20,0x08,0x64,0xe9,0x68,0x88,0x88,
-0x88,0x30,0x4a,0x03,0xf0,0x12,0xd4,0x00,0x15,0x9e,0x70,0x00,0x7f,0x4c,0xff,0xff,
-0xb6,0x00,0x0e,0xb3,0xf9,0x59,0xf0,0x00,0x08,0xf8,0x3f,0x30,0x7f,0x00,0x03,0xff,
-0x83,0xf6,0x38,0xf3,0x31,0x8f,0xf8,0x43,0x08,0xfa,0x19,0x61,0x5f,0x83,0xf6,0x36,
-0xf6,0x31,0x00,0xf8,0x3f,0x30,0x1f,0x60,0x00,0x0f,0x83,0xf3,0x01,0xe9,0x20,0x00,
-0xf8,0x3f,0x38,0xca,0xd8,0x90,0x0f,0x86,0xff,0xaf,0x8f,0xf6,0x00,0xf8,0x7c,0x72,
-0x84,0x8c,0x10,0xae,0x01,0x31,0xb6,0x00,0x8b,0x67,0x0c,0x20,0x06,0xf4,0xb0,0x00,
-0xd0,0x88,0x9e,0x98,0x83,0x09,0xf8,0x7f,0xff,0xff,0xff,0x66,0xff,0x80,0x78,0x17,
-0x50,0x5e,0xf8,0x00,0x04,0xf3,0x7a,0x01,0x01,0xd4,0x06,0x71,0xf8,0x07,0x7a,0xf9,
-0x77,0x00,0x0f,0x1a,0x00,0x12,0x00,0x1a,0x00,0x93,0x0f,0x86,0x88,0xaf,0xa8,0x85,
-0x00,0xf8,0xbf,0x7e,0x0c,0x01,0xb0,0x00,0x21,0xe6,0x00,0x5a,0x07,0x00,0x72,0x02,
-0xf0,0x1d,0xa0,0x1e,0xc3,0x88,0x88,0x8d,0xf5,0x0b,0xf9,0x00,0x00,0x00,0x9e,0x06,
-0xff,0x94,0xff,0xff,0x09,0xe0,0x4d,0xf9,0x4f,0x79,0xf0,0x9e,0x00,0x2e,0x94,0xf2,
-0x5f,0x09,0xe0,0x00,0xe9,0x4f,0x8a,0xf0,0x9e,0x00,0x0e,0x94,0xfe,0xee,0x0d,0x00,
-0x40,0x28,0x10,0x00,0x9e,0xb3,0x02,0x9b,0x08,0x8d,0xd0,0x00,0xe9,0x00,0x00,0xcf,
-0xe6,0x5e,0x02,0x40,0xd7,0x07,0xb0,0x00,0x5e,0x02,0x10,0xec,0x18,0x0d,0xf0,0x1d,
-0xd0,0x5f,0xff,0xff,0xf9,0x09,0xf8,0x1e,0xdd,0xf8,0x88,0x56,0xff,0x8b,0xf3,0xae,
-0x00,0x00,0x5e,0xf8,0x89,0x0a,0xff,0xff,0x40,0x3f,0x80,0x00,0xaf,0x55,0x51,0x00,
-0xf8,0x00,0x0a,0xe2,0x22,0x10,0x0f,0x80,0x00,0xaf,0xff,0xf7,0x0d,0x00,0x50,0xf3,
-0x33,0x10,0x0f,0x80,0xa1,0x01,0x00,0x0d,0x00,0x16,0xe0,0x55,0x00,0x20,0xe8,0x00,
-0xab,0x03,0x10,0x7f,0x84,0x03,0xf1,0x0d,0x80,0x0e,0xb4,0x77,0xbf,0x77,0x74,0x0a,
-0xf8,0x14,0x49,0xf5,0x44,0x17,0xff,0x86,0xff,0xff,0xff,0xf3,0x7c,0xf8,0x6f,0x07,
-0xf1,0x4f,0x30,0x0e,0x0d,0x00,0xc0,0x00,0xe8,0x3b,0x5c,0xe4,0x44,0x10,0x0e,0x80,
-0xdb,0xe9,0x00,0x8d,0x37,0xf0,0x05,0xff,0x91,0x00,0x00,0x0e,0x98,0xef,0xbf,0xfc,
-0x94,0x00,0xe8,0x9a,0x30,0x17,0xad,0x30,0x00,0x00,0x05,0x5e,0x02,0x72,0x77,0x77,
-0xaf,0x97,0x77,0x71,0x1f,0x0a,0x06,0xf0,0x26,0x03,0xd5,0x6f,0x41,0xd6,0x00,0x00,
-0x8f,0x25,0xf4,0x6f,0x40,0x00,0x2e,0xfc,0x6f,0x5e,0xfe,0x30,0x1d,0xe6,0xbc,0xff,
-0xe5,0xdf,0x10,0x83,0x09,0xff,0xfb,0x00,0x30,0x00,0x1a,0xfc,0xfb,0xfb,0x10,0x00,
-0x7f,0xf6,0x5f,0x46,0xff,0x80,0x5f,0xd4,0x05,0xf4,0x04,0xdf,0x40,0x40,0xba,0x0e,
-0x31,0x40,0x00,0x31,0xa2,0x00,0xf5,0x3e,0x0e,0xbf,0xff,0xf4,0x04,0xf2,0x04,0xf4,
-0x9f,0x86,0x47,0x4f,0x20,0xaf,0x07,0xf0,0x05,0xf4,0xf2,0x3f,0xe0,0xaf,0xff,0x7f,
-0x4f,0x29,0xfe,0x0e,0xcb,0xf6,0xf4,0xf2,0x4e,0xe6,0xf3,0x7e,0x5f,0x4f,0x20,0x8e,
-0xcd,0x6b,0xa5,0xf4,0xf2,0x07,0xe4,0x8f,0xf6,0x5f,0x4f,0x20,0x7e,0x00,0x9f,0x15,
-0xf4,0xf2,0x07,0xe0,0x1e,0x80,0x00,0x4f,0x20,0x7e,0x1d,0xe1,0x02,0x9b,0xf1,0x07,
-0xe0,0xa2,0x00,0x0d,0xd8,0xa3,0x04,0xf0,0x05,0xe3,0x4f,0x30,0xe9,0x00,0x00,0x9f,
-0x14,0xf3,0x0e,0x90,0x00,0x1f,0xa5,0xaf,0x97,0xfc,0x72,0x0b,0xf7,0xc9,0x01,0x30,
-0x47,0xff,0x60,0x1a,0x00,0x30,0x6e,0xf6,0x04,0x1a,0x00,0x91,0x3f,0x67,0x9f,0x97,
-0xfc,0x72,0x01,0xf6,0xff,0xa3,0x04,0xf4,0x0a,0x60,0x15,0x10,0x22,0x00,0x01,0xf6,
-0x09,0xf2,0x0c,0xe1,0x00,0x1f,0x79,0xf5,0x00,0x1e,0xc0,0x01,0xf7,0x96,0x00,0x00,
-0x5b,0x10,0x09,0x0b,0xf1,0x0b,0xe0,0x28,0xa8,0xf3,0x50,0x00,0xdf,0xdf,0xfb,0xbf,
-0x6e,0x00,0x4f,0x88,0xbe,0x08,0xf0,0xf5,0x0d,0xf3,0x19,0xe1,0x8f,0x14,0x07,0xff,
-0x47,0x0c,0xf3,0x1f,0x9f,0xf5,0x3a,0xf3,0x8f,0x56,0x12,0x6f,0x30,0x8f,0x77,0xf9,
-0xf1,0x04,0xf7,0xcf,0xff,0x7f,0xf7,0x00,0x4f,0x7b,0xce,0x00,0xfd,0x10,0x04,0xf3,
-0x08,0xe0,0xbf,0xa7,0x80,0x4f,0x36,0xce,0xcf,0xbf,0xc8,0x04,0xf3,0xde,0x73,0x30,
-0xbe,0x20,0x55,0x00,0x22,0x05,0x20,0xc9,0x08,0x00,0x50,0x03,0xf0,0x07,0x00,0x9f,
-0x1f,0xa5,0x55,0xce,0x00,0x1f,0xb0,0xf7,0x00,0x09,0xe0,0x0c,0xf8,0x0f,0xa5,0x55,
-0xce,0x07,0xff,0x80,0x1a,0x00,0x21,0x6c,0xf8,0x2c,0x05,0x20,0x1e,0x8c,0xeb,0x08,
-0xa0,0x00,0xe8,0x67,0xbf,0xff,0x87,0x40,0x0e,0x80,0x2f,0x89,0x08,0xfa,0x03,0xe8,
-0x4e,0xd8,0xf5,0xfc,0x10,0x0e,0xaf,0xd1,0x7f,0x16,0xfa,0x00,0xe8,0x30,0x07,0xf1,
-0x03,0x57,0x02,0x40,0x02,0xd3,0x00,0xb7,0x4e,0x0b,0x00,0x06,0x1a,0x30,0x00,0x1f,
-0x9e,0xe9,0x01,0x90,0x0a,0xf7,0x34,0x44,0x44,0x44,0x05,0xff,0x70,0xdd,0x08,0x91,
-0x5c,0xf7,0x05,0x55,0x55,0x51,0x00,0x1e,0x70,0xea,0x08,0xf3,0x11,0xe7,0x04,0x44,
-0x44,0x41,0x00,0x0e,0x73,0xff,0xff,0xff,0x70,0x00,0xe7,0x3f,0x10,0x00,0xe7,0x00,
-0x0e,0x73,0xf6,0x44,0x4e,0x70,0x00,0xe7,0x3e,0xee,0xee,0xe6,0x00,0x0b,0x09,0x50,
-0x07,0xe1,0x02,0xf6,0x00,0xdc,0x09,0xf5,0x34,0xaf,0xfe,0xed,0x00,0x3f,0x60,0x6f,
-0xe5,0x6f,0x90,0x0c,0xf3,0x5d,0xbe,0xac,0xe1,0x06,0xff,0x4f,0x31,0x9f,0xf8,0x10,
-0x8f,0xf4,0xfc,0xfe,0x89,0xff,0x61,0x7f,0x4f,0x74,0x3b,0xa0,0x60,0x04,0xf4,0xf3,
-0xae,0x84,0xa1,0x00,0x4f,0x4f,0x22,0x6b,0xe4,0x30,0x04,0xf4,0xf2,0x9c,0x64,0xce,
-0x20,0x4f,0x30,0x16,0x9d,0xfa,0x10,0x04,0xf3,0x02,0xea,0x51,0xb3,0x07,0x40,0x08,
-0xc0,0x00,0xad,0xad,0x06,0x01,0x8e,0x01,0xf5,0x30,0x4f,0x5f,0x88,0xa6,0x6a,0x72,
-0x0c,0xf2,0xf4,0x8b,0x00,0xe5,0x05,0xff,0x1f,0x4c,0x96,0x6f,0x91,0x9f,0xf2,0xf7,
-0xf9,0xee,0xfe,0x42,0x9f,0x2f,0xef,0x65,0x0e,0x50,0x06,0xf3,0xf8,0xf6,0xf3,0xe5,
-0x00,0x6f,0x4f,0x1e,0x59,0xbe,0x50,0x06,0xf7,0xf0,0xe5,0x11,0xe5,0x00,0x6f,0xbc,
-0x0e,0x51,0x5f,0x50,0x06,0xf7,0x70,0xd5,0x0e,0x64,0x08,0x21,0x27,0x10,0x66,0x05,
-0x11,0xf9,0x0b,0x09,0xf1,0x22,0xec,0x7f,0x55,0x55,0x8f,0x20,0x4f,0x67,0xe0,0x39,
-0x04,0xf2,0x0c,0xf3,0x7e,0x26,0xe2,0x5f,0x26,0xff,0x37,0xeb,0xff,0xea,0xf2,0x9e,
-0xf3,0x7e,0x05,0xe1,0x4f,0x22,0x5f,0x37,0xe6,0xff,0xf6,0xf2,0x03,0xf3,0x7e,0x6a,
-0x0f,0x6f,0x20,0x3f,0x37,0xe6,0xeb,0x0d,0x00,0x90,0x25,0x55,0x5f,0x20,0x3f,0x37,
-0xff,0xff,0xff,0x0d,0x00,0xf0,0x05,0x55,0x55,0x7d,0x20,0x00,0x0a,0x30,0x08,0xb0,
-0x00,0x00,0x07,0xf6,0x66,0xbf,0x76,0x60,0x00,0xec,0x6f,0x7f,0x06,0xf0,0x00,0xaf,
-0x60,0x6d,0x00,0x7e,0x00,0x6f,0xf5,0x03,0xf2,0x0d,0xa0,0x06,0xef,0x5e,0xa8,0x01,
-0xf0,0x0a,0x03,0xf5,0x44,0x44,0x44,0x44,0x20,0x2f,0x50,0xef,0xff,0xff,0x70,0x02,
-0xf5,0x0e,0xb6,0x67,0xf7,0x00,0x2f,0x50,0xe8,0x00,0x0f,0x0d,0x00,0x20,0xc7,0x77,
-0x0d,0x00,0x61,0xef,0xee,0xef,0x70,0x00,0x21,0xa9,0x00,0xf2,0x26,0x0c,0xd4,0x44,
-0x42,0x03,0xf2,0x01,0xfa,0xff,0xff,0x8c,0x5f,0x20,0x7f,0x38,0xf5,0x73,0xf6,0xf2,
-0x0e,0xf0,0xc9,0x7f,0x3f,0x6f,0x27,0xfe,0x5f,0xff,0xfb,0xf6,0xf2,0x9f,0xe1,0x77,
-0x44,0x7f,0x6f,0x22,0xae,0x02,0xda,0x22,0xf6,0xf2,0x07,0xe6,0xff,0xff,0x8f,0x6f,
-0x20,0x7e,0x0d,0x00,0xf4,0x03,0xe2,0x4d,0xdb,0x80,0x3f,0x20,0x7e,0xaf,0xc9,0x63,
-0x7a,0xf1,0x07,0xe0,0x00,0x00,0x0a,0xc8,0xfe,0x00,0x21,0x03,0xd2,0x22,0x07,0x20,
-0xbe,0xcf,0xa3,0x00,0xf0,0x07,0x2f,0x84,0x55,0xfb,0x55,0x50,0x0c,0xf4,0x3c,0xcf,
-0xdc,0xc4,0x07,0xff,0x33,0xf6,0x55,0x5f,0x60,0x5e,0xf3,0x3f,0x94,0x05,0x72,0x4f,
-0x33,0xf4,0x33,0x3f,0x60,0x02,0x0d,0x00,0x46,0x2f,0x33,0xf4,0x22,0x0d,0x00,0x80,
-0x6a,0xf9,0x88,0x9f,0xb3,0x02,0xf7,0xcc,0x88,0x09,0x03,0x0a,0x06,0x21,0x01,0xf6,
-0x55,0x04,0xf0,0x06,0x8f,0x8e,0xee,0xfe,0xed,0x00,0x1f,0xa7,0xf5,0x55,0x5b,0xe0,
-0x0a,0xf6,0x7f,0x55,0x55,0xbe,0x06,0xff,0x67,0xad,0x02,0xf0,0x08,0x8f,0xf6,0x8f,
-0x55,0x55,0x55,0x01,0x4f,0x69,0xef,0xff,0xff,0xf1,0x01,0xf6,0xac,0xf4,0xd8,0x5f,
-0x10,0x1f,0x6d,0xaf,0x0d,0x00,0xf5,0x03,0xf7,0xf7,0xf7,0xea,0x7f,0x10,0x1f,0xcf,
-0x3f,0x4d,0x88,0xf1,0x01,0xf9,0x91,0xf4,0xd8,0xcb,0xa7,0x02,0x30,0xc2,0x00,0xbc,
-0x49,0x05,0x10,0xef,0xe6,0x07,0xf0,0x0d,0x1f,0x84,0x88,0x88,0x88,0x50,0x0c,0xf3,
-0x1f,0xb9,0x9a,0xf4,0x07,0xff,0x31,0xfd,0xbb,0xcf,0x40,0x4d,0xf3,0x36,0x66,0x66,
-0x63,0x00,0x4f,0x6f,0x6a,0x03,0xf0,0x09,0x02,0xf6,0xf5,0x44,0x44,0x5f,0x40,0x2f,
-0x45,0xef,0xff,0xff,0x51,0x02,0xf3,0x01,0x1b,0xe1,0x10,0x00,0x2f,0x30,0x26,0xce,
-0x6e,0x11,0x20,0x02,0xfe,0xf7,0x09,0x12,0x22,0x54,0x09,0xf0,0x21,0xde,0xff,0xf0,
-0x02,0xf3,0x01,0xf7,0xe7,0x7f,0x3a,0x3f,0x30,0x8f,0x3e,0xbb,0xf4,0xf3,0xf3,0x2f,
-0xf3,0xec,0xcf,0x4f,0x3f,0x3a,0xff,0x3e,0x66,0xf4,0xf3,0xf3,0x6c,0xf3,0xef,0xff,
-0x4f,0x3f,0x30,0x4f,0x3e,0x77,0xf4,0xf3,0xf3,0x04,0xf3,0xeb,0xbf,0x0d,0x00,0x30,
-0x3c,0xcc,0xd4,0x0d,0x00,0xf4,0x03,0x8b,0x7c,0x00,0x3f,0x30,0x4f,0x6f,0x63,0xf4,
-0x59,0xf2,0x04,0xf7,0x90,0x06,0x17,0xfa,0x00,0x07,0x04,0x71,0xd0,0x0f,0x70,0xf8,
-0x00,0x00,0xdc,0x54,0x01,0xf0,0x1f,0x4f,0x56,0x7f,0xb7,0xfb,0x70,0x0d,0xf6,0xcc,
-0xfe,0xcf,0xec,0x58,0xff,0x59,0xfd,0x88,0x88,0x83,0x6e,0xf5,0xcf,0xed,0xdd,0xdd,
-0x00,0x5f,0xdf,0xf8,0x9f,0x6a,0xf0,0x04,0xf5,0x8f,0xff,0xfe,0xff,0x00,0x4f,0x33,
-0xf7,0x8f,0x5a,0xf0,0x04,0x54,0x01,0x00,0x0d,0x00,0x30,0xf5,0x6f,0x4a,0x0d,0x00,
-0x35,0x35,0xf5,0xe9,0xff,0x00,0xf0,0x26,0xe7,0x33,0x8f,0x53,0x31,0x00,0xaf,0xbc,
-0xce,0xfd,0xcc,0x50,0x2f,0x83,0xbb,0xdf,0xcb,0xb0,0x0c,0xf5,0x4f,0x8a,0xf7,0xaf,
-0x09,0xff,0x54,0xfa,0xbf,0x9b,0xf0,0x7d,0xf5,0x4f,0xee,0xfd,0xef,0x00,0x3f,0x55,
-0x77,0xbf,0x9f,0xd1,0x02,0xf5,0x69,0x98,0x8c,0xfa,0x40,0x2f,0x6f,0x66,0x02,0xc0,
-0x02,0xf5,0x3b,0xe3,0x3a,0xf3,0x20,0x2f,0x50,0x2f,0x93,0xae,0xa6,0x09,0x25,0x31,
-0xff,0xb0,0x10,0xf0,0x1a,0x3b,0x25,0xf0,0x0c,0xb0,0x00,0x0a,0xfc,0xef,0xdd,0xff,
-0xd3,0x02,0xfa,0x49,0xf6,0x6d,0xd5,0x10,0xcf,0x50,0x5e,0xff,0xeb,0x00,0x7f,0xf5,
-0x4a,0xad,0xfa,0xa8,0x09,0xef,0x56,0xf3,0xbf,0x3b,0xd0,0x13,0xf5,0x6f,0x6e,0x0d,
-0xf0,0x00,0x2f,0x55,0x88,0xdf,0x88,0x80,0x02,0xf5,0x48,0x8d,0xf8,0x87,0x00,0x2f,
-0x53,0xf5,0x06,0xf0,0x02,0x02,0xf5,0x57,0x7c,0xf7,0x76,0x10,0x2f,0x5c,0xcc,0xcc,
-0xcc,0xc4,0x00,0x1b,0x32,0xc4,0x4a,0x03,0x20,0xf2,0xcf,0xcf,0x19,0x80,0xfb,0xbf,
-0x65,0xed,0x22,0x00,0x9f,0xbf,0xf0,0x01,0x90,0x5f,0xf4,0x7f,0x28,0xe2,0x9e,0x08,
-0xff,0x45,0x0d,0x00,0xf8,0x16,0x16,0xf4,0x3a,0xff,0x30,0x68,0x00,0x2f,0x5b,0x98,
-0xfe,0xcf,0x80,0x02,0xf5,0x8e,0xb8,0xf9,0xf6,0x00,0x2f,0x45,0x7b,0xee,0x88,0xe3,
-0x02,0xf6,0xdf,0xb6,0xf7,0x0c,0x80,0x2f,0x44,0x13,0xfd,0xaa,0x07,0xd0,0x10,0x01,
-0x00,0x00,0x02,0xf5,0x5e,0x10,0xbe,0x00,0x00,0xae,0xbf,0x28,0x0c,0xe0,0x3f,0x62,
-0x88,0xde,0x88,0x70,0x1d,0xf2,0x18,0x8d,0xe8,0x87,0x09,0xff,0x3d,0x0c,0xfa,0x20,
-0xfa,0x5b,0xf4,0x79,0xbb,0x7b,0x88,0x10,0x4f,0x38,0xaf,0x37,0xf3,0xd3,0x04,0xf6,
-0xef,0xfe,0xff,0xef,0xc0,0x4f,0x33,0x7f,0x85,0xf8,0xc3,0x04,0xf8,0xff,0xfb,0x2e,
-0xf8,0x00,0x4f,0x32,0x6f,0x2b,0xff,0x7b,0x04,0xf2,0x5f,0xa2,0xa2,0xaf,0x70,0xff,
-0x04,0xf0,0x29,0xe5,0xc4,0x8f,0x0a,0x90,0x00,0xaf,0x8d,0xdb,0xf7,0xfa,0x30,0x2f,
-0x9f,0xb9,0x99,0x99,0xe8,0x0d,0xf5,0xad,0xdb,0xbc,0xec,0x5a,0xff,0x50,0xcd,0xaa,
-0xbf,0x40,0x6c,0xf5,0x27,0x77,0x77,0x76,0x00,0x3f,0x55,0xf8,0x88,0x8c,0xe0,0x02,
-0xf5,0x5f,0xba,0xaa,0xde,0x00,0x2f,0x55,0xfa,0xaa,0xad,0x0d,0x00,0xe0,0xdd,0xdd,
-0xee,0x00,0x2f,0x54,0xaf,0x41,0xed,0x71,0x02,0xf6,0xda,0x40,0x92,0x12,0x08,0x01,
-0x00,0xf2,0x30,0x0a,0x96,0x90,0x08,0xb0,0x83,0x01,0xf6,0x2b,0x08,0xef,0xbf,0x20,
-0x6f,0x7e,0xee,0x5b,0xdd,0xb0,0x0d,0xe1,0x44,0x45,0xbd,0xf9,0x37,0xfe,0x0f,0xfe,
-0xcf,0xff,0xf9,0x7f,0xe0,0x55,0x40,0xaf,0x20,0x01,0x8e,0x0f,0xff,0xbf,0xfe,0xe2,
-0x05,0xe1,0x55,0x7d,0xea,0x6f,0x30,0x5e,0x3f,0xdf,0x1c,0xff,0xf3,0x05,0xe3,0xf1,
-0xf1,0xca,0x0d,0x00,0x98,0xb8,0xf3,0x05,0xe3,0xc7,0xe1,0xce,0xde,0x20,0x12,0x0d,
-0x00,0xba,0x03,0x10,0xf8,0x29,0x1f,0x01,0xc2,0x0d,0xf1,0x04,0x17,0x7a,0xfd,0x77,
-0xa9,0x77,0x10,0x01,0xee,0x10,0x1e,0xe2,0x00,0x02,0xdf,0x85,0x67,0xbf,0xe1,0x8a,
-0x0f,0xf3,0x15,0xef,0xc0,0x00,0x11,0xfb,0x0d,0xd0,0x53,0x00,0x00,0x5f,0x70,0xdd,
-0x00,0x40,0x00,0x2d,0xf2,0x0d,0xd0,0x0e,0x91,0x8e,0xf7,0x00,0xcf,0x77,0xf7,0x1e,
-0xd5,0x00,0x06,0xef,0xfd,0x10,0x10,0x64,0x01,0xf4,0x0d,0x05,0xf4,0x00,0x10,0x00,
-0x2f,0x70,0x5f,0x40,0x5f,0x60,0x00,0x9f,0x35,0xf4,0x1e,0xd0,0x00,0x00,0xd5,0x5f,
-0x46,0xe2,0x00,0x17,0x77,0x7a,0xfa,0x2a,0x0e,0x61,0xf3,0x00,0x02,0xf8,0x0b,0xd0,
-0x93,0x16,0x10,0xbd,0xde,0x00,0x10,0xf1,0x0d,0x00,0xf4,0x06,0x05,0xfb,0x00,0xbd,
-0x00,0x82,0x19,0xfe,0x10,0x0a,0xf7,0x8f,0x63,0xfa,0x20,0x00,0x4e,0xff,0xd1,0x01,
-0x00,0xbb,0x06,0x15,0xf3,0x33,0x11,0xf1,0x00,0x07,0x77,0x7a,0xf9,0x77,0x77,0x10,
-0x04,0x66,0x9f,0x86,0x65,0x00,0x00,0xcf,0xcd,0x06,0x21,0x0c,0xb0,0x3a,0x0d,0xf5,
-0x17,0xcf,0xee,0xee,0xef,0xe0,0x00,0x05,0x7f,0xc7,0xed,0x76,0x00,0x00,0x04,0xf6,
-0x0d,0xb0,0x02,0x00,0x01,0xdf,0x10,0xdb,0x00,0xf6,0x39,0xff,0x70,0x0d,0xe7,0x8f,
-0x52,0xfb,0x40,0x00,0x6f,0xff,0xc0,0xfe,0x00,0x12,0xa2,0xbb,0x0d,0x12,0xe2,0x4d,
-0x11,0x12,0xd0,0xd4,0x0e,0x21,0x70,0x00,0x02,0x10,0x10,0x10,0x7e,0x06,0x21,0xfd,
-0xfa,0x82,0x09,0x20,0x69,0xf4,0xd7,0x10,0xc0,0xe0,0x1e,0xe0,0x00,0x00,0x0c,0xf5,
-0x00,0x7f,0xa0,0x00,0x1b,0xcd,0x17,0x90,0xa0,0x3e,0xfb,0x00,0x00,0x01,0xdf,0x70,
-0x98,0x2a,0x00,0x14,0xb1,0x54,0x00,0x21,0x06,0x60,0x43,0x12,0x01,0xbe,0x01,0x40,
-0xce,0x10,0x00,0x0a,0xb3,0x00,0xf0,0x0e,0xfe,0xaf,0x77,0xdf,0xf7,0x7d,0xea,0xe0,
-0x1f,0xef,0x50,0xae,0xae,0x0a,0xf2,0xee,0x1a,0xea,0xfb,0xf8,0x05,0xfe,0xde,0xaf,
-0xc6,0x00,0x06,0xdb,0xea,0x41,0x09,0x70,0xae,0xae,0x00,0x00,0x06,0x8e,0xda,0x95,
-0x16,0x06,0xaa,0x09,0x11,0x4e,0x44,0x00,0x30,0x3e,0xfe,0x30,0x9d,0x00,0xf0,0x03,
+0x20,0x0b,0xbb,0x01,0x00,0x12,0x51,0xfb,0x02,0x06,0x17,0x00,0x12,0x20,0x36,0x03,
+0xa2,0x10,0x00,0x00,0x17,0x77,0x79,0xfb,0x77,0x77,0x13,0xce,0x02,0xf0,0x10,0x00,
+0x08,0xa2,0x01,0xa9,0x00,0x00,0x08,0xf9,0x00,0x09,0xfc,0x10,0x1d,0xfb,0x60,0x00,
+0x79,0xfd,0x10,0x55,0x2f,0x80,0x5f,0x65,0x60,0x00,0x00,0x8f,0x6f,0xd0,0x34,0x00,
+0x20,0xdf,0xe2,0xf3,0x00,0xfc,0x02,0xbf,0xff,0xb3,0x00,0x01,0x9d,0xfe,0x71,0x7f,
+0xfe,0xa2,0x0c,0xb6,0x10,0x00,0x16,0xab,0x78,0x00,0x24,0x6f,0x20,0x84,0x03,0x80,
+0x20,0x45,0x66,0x66,0x66,0x66,0x40,0x00,0x23,0x02,0xe1,0xb0,0x00,0x0a,0xe6,0x66,
+0x66,0xeb,0x00,0x00,0x69,0x99,0x99,0x99,0x60,0xbb,0x02,0xf2,0x02,0xfa,0x00,0x00,
+0x33,0x34,0xbf,0xfa,0x20,0x01,0x55,0x55,0x9f,0xe7,0x55,0x51,0x5f,0xff,0xde,0x00,
+0x30,0x24,0x8f,0x40,0x78,0x01,0x28,0xff,0xc1,0x55,0x00,0x51,0x7f,0x20,0x00,0x00,
+0x9f,0x21,0x00,0x71,0x12,0x35,0x66,0x66,0x66,0x65,0x30,0x0e,0x00,0xf1,0x00,0x60,
+0x00,0x09,0xf4,0x33,0x36,0xf6,0x00,0x00,0x7c,0xcc,0xcc,0xcc,0x40,0x04,0xf1,0x00,
+0xf4,0x14,0xb0,0x6f,0x65,0x77,0x77,0x75,0xaf,0x03,0x91,0x6f,0xff,0xff,0x24,0x90,
+0x00,0x0b,0xe1,0x17,0xf2,0x16,0x01,0x5c,0xf7,0x00,0x6f,0x78,0xf1,0x3f,0xe6,0x00,
+0x02,0xef,0xfa,0x00,0x10,0x55,0x00,0x02,0x09,0x00,0x20,0x3f,0x70,0x06,0x00,0x30,
+0x4e,0xfe,0x20,0x67,0x00,0xf0,0x08,0xd4,0xdf,0x60,0x00,0x06,0xdf,0xb0,0x01,0xbf,
+0xe9,0x28,0xfe,0x60,0x00,0x00,0x5d,0xf7,0x06,0x08,0xc0,0x00,0x9b,0x04,0x5a,0x04,
+0x30,0x0b,0xe0,0x00,0x04,0x00,0x51,0xbe,0x00,0x00,0x00,0xfc,0x0d,0x00,0x20,0x9f,
+0x60,0x0d,0x00,0x20,0xaf,0xc0,0x0d,0x00,0x5b,0x07,0xb1,0x00,0x00,0xbe,0x09,0x01,
+0x40,0x01,0xe5,0x00,0x0f,0x3e,0x01,0xf5,0x36,0x29,0x60,0xf6,0x00,0x00,0x1f,0xa0,
+0xe9,0x0f,0x9a,0xf2,0x0b,0xf7,0x0e,0xb8,0xff,0xff,0x27,0xff,0x74,0xff,0xff,0x84,
+0xf2,0x5e,0xfb,0xff,0xc2,0xf6,0x4f,0x20,0x3f,0x74,0xe9,0x0f,0x66,0xf1,0x01,0xf7,
+0x0e,0x90,0xfb,0xfe,0x00,0x1f,0x70,0xe9,0x0f,0x74,0x20,0x01,0xf7,0x0e,0xa0,0x00,
+0x0c,0x80,0x1f,0x70,0xce,0x98,0x8a,0xf7,0x01,0xf7,0x03,0xbd,0xdd,0xc9,0xd6,0x01,
+0xf4,0x3d,0x60,0x00,0x00,0x6f,0x30,0x01,0xf9,0x1e,0x90,0x07,0xf2,0x00,0x1f,0x90,
+0x9f,0x40,0x9f,0x00,0x01,0xf9,0x01,0xeb,0x0a,0xf0,0x00,0x1f,0x90,0x04,0x00,0xec,
+0x00,0x01,0xf9,0x00,0x00,0x2f,0x70,0x00,0x1f,0x90,0x61,0x07,0xf3,0x00,0x01,0xfd,
+0xef,0x52,0xff,0x30,0x00,0x6f,0xfd,0x40,0xcf,0xfe,0x20,0x0d,0xe6,0x03,0xcf,0x83,
+0xfd,0x10,0x20,0x01,0xef,0x80,0x05,0xf7,0x00,0x00,0x03,0x20,0x00,0x04,0x55,0x00,
+0x30,0x08,0xb0,0x29,0x74,0x01,0xf1,0x0b,0xea,0xbf,0xd9,0x66,0x66,0x00,0x4f,0x5e,
+0x80,0x2f,0xff,0xf1,0x0d,0xf3,0xe7,0x02,0xf5,0x5f,0x17,0xff,0x3e,0x70,0x2f,0x55,
+0xf1,0x8f,0x0d,0x00,0x21,0x11,0x6f,0x0d,0x00,0xf5,0x10,0x03,0xf3,0xe7,0x23,0xf5,
+0x5f,0x10,0x3f,0x4f,0xff,0x7f,0x79,0xf1,0x03,0xf6,0xfa,0x42,0xf9,0xfd,0x00,0x3f,
+0x31,0x00,0x2f,0x51,0x00,0x03,0xf3,0x00,0x02,0xf5,0xff,0x00,0xf0,0x21,0x02,0xe5,
+0x32,0x7f,0x10,0x00,0x00,0x9f,0x2d,0xb7,0xf1,0x00,0x00,0x1f,0xb1,0xfc,0xbf,0x87,
+0x60,0x0a,0xf6,0x7f,0xff,0xff,0xfc,0x06,0xff,0x5d,0xc0,0x7f,0x10,0x00,0x7f,0xf5,
+0x64,0x07,0xf1,0x00,0x00,0x5f,0x58,0x88,0xcf,0x98,0x83,0x01,0xf5,0xdf,0xd0,0x01,
+0x90,0x1f,0x50,0x00,0x7f,0x10,0x00,0x01,0xf5,0x00,0x1a,0x00,0x09,0x0d,0x00,0xf0,
+0x07,0x00,0x0b,0x50,0x00,0x15,0xa1,0x00,0x05,0xfa,0x9b,0xef,0xfe,0x70,0x00,0xde,
+0x7d,0xbd,0xf2,0x00,0x00,0x8f,0xa0,0x3a,0x04,0x20,0x6f,0xf9,0x3a,0x04,0x90,0x0a,
+0xff,0xa8,0x88,0xdf,0x88,0x81,0x24,0xea,0x24,0x02,0x31,0x30,0x0e,0x90,0x18,0x06,
+0x11,0xe9,0x18,0x06,0x04,0x0d,0x00,0x00,0x32,0x02,0xfc,0x45,0x10,0x0e,0x95,0x88,
+0x88,0x88,0x80,0x00,0x0c,0x50,0x75,0x19,0x30,0x00,0x07,0xf3,0x1f,0x80,0xe8,0x00,
+0x00,0xeb,0x07,0xf3,0x0a,0xe0,0x00,0x9f,0x72,0xfb,0x00,0x3f,0x90,0x5f,0xf8,0xef,
+0x31,0x11,0xbf,0x85,0xff,0x8e,0xef,0xff,0xff,0xf6,0x03,0xf7,0x13,0xbf,0x58,0xf4,
+0x00,0x1f,0x70,0x0a,0xd0,0x4f,0x30,0x01,0xf7,0x00,0xf9,0x05,0xf2,0x00,0x1f,0x70,
+0x8f,0x30,0x7f,0x10,0x01,0xf7,0x8f,0x92,0x7d,0xe0,0x00,0x1f,0x79,0x90,0x1e,0xd5,
+0x01,0x03,0xf0,0x07,0xe9,0x07,0xf4,0xd6,0x00,0x00,0x7f,0x40,0x6f,0x38,0xf6,0x00,
+0x0e,0xd0,0x05,0xf3,0x07,0x40,0x0b,0xfa,0x9a,0xdf,0xf7,0x01,0xf5,0x23,0xad,0xcc,
+0xfb,0x67,0x30,0x6d,0xfa,0x00,0x0f,0x82,0xfb,0x00,0x1e,0xa0,0x00,0xdb,0xcf,0x20,
+0x00,0xea,0x00,0x0a,0xff,0x60,0x00,0x0e,0xa0,0x02,0xcf,0x80,0x81,0x00,0xea,0x18,
+0xff,0xfb,0x0e,0x70,0x0e,0xac,0xfa,0x17,0xfb,0xf4,0x00,0xea,0x23,0x00,0x0a,0xfb,
+0xa2,0x01,0x30,0x70,0x07,0xa1,0xcf,0x04,0xf1,0x07,0x0c,0xe0,0x00,0x00,0x8f,0x28,
+0x8f,0xc8,0x85,0x02,0xfb,0x1f,0xff,0xff,0xfb,0x0d,0xf9,0x1f,0x70,0x00,0xeb,0x8f,
+0x06,0x00,0x20,0x18,0xf9,0x12,0x00,0x80,0x00,0xe9,0x1f,0xc8,0x88,0xfb,0x00,0xe9,
+0x12,0x00,0x05,0x06,0x00,0x02,0x18,0x00,0x34,0xb7,0x77,0xd9,0x9b,0x01,0x11,0xd3,
+0xd5,0x06,0x70,0x9f,0x21,0xbf,0x21,0x11,0x00,0x2f,0x9f,0x03,0xf0,0x02,0xf9,0x0c,
+0xf5,0x4b,0xf7,0xb7,0x44,0x29,0xff,0x52,0xfa,0x1f,0x60,0x00,0x7d,0xf5,0xcf,0xbf,
+0x03,0xf0,0x15,0x3f,0xdf,0xfb,0x7f,0xa9,0xf2,0x02,0xf6,0x6e,0x81,0xf6,0x5f,0x20,
+0x2f,0x50,0xe8,0x1f,0x65,0xf2,0x02,0xf5,0x0e,0x81,0xfa,0xff,0x00,0x2f,0x50,0x63,
+0x1f,0x74,0x20,0x02,0xf5,0x00,0x01,0x07,0x05,0x09,0x5c,0x04,0x31,0xd8,0x00,0xae,
+0x2e,0x07,0xf0,0x14,0x06,0xe2,0x00,0x00,0x0d,0xd4,0xff,0xff,0xff,0xe0,0x09,0xf9,
+0x28,0x88,0x88,0x88,0x05,0xff,0x90,0x5e,0x00,0x3f,0x50,0x3e,0xf9,0x04,0xf2,0x06,
+0xf3,0x00,0x1e,0x90,0x2f,0x60,0x8f,0xa1,0x01,0x90,0xf8,0x0b,0xc0,0x00,0x0e,0x90,
+0x0e,0xa0,0xe8,0x0d,0x00,0x60,0x74,0x1f,0x50,0x00,0x0e,0x9b,0xa2,0x06,0x74,0x00,
+0xe9,0x68,0x88,0x88,0x88,0x30,0x4a,0x03,0xfa,0x3e,0xd4,0x00,0x15,0x9e,0x70,0x00,
+0x7f,0x4c,0xff,0xff,0xb6,0x00,0x0e,0xb3,0xf9,0x59,0xf0,0x00,0x08,0xf8,0x3f,0x30,
+0x7f,0x00,0x03,0xff,0x83,0xf6,0x38,0xf3,0x31,0x8f,0xf8,0x3f,0xff,0xff,0xff,0x61,
+0x5f,0x83,0xf6,0x36,0xf6,0x31,0x00,0xf8,0x3f,0x30,0x1f,0x60,0x00,0x0f,0x83,0xf3,
+0x01,0xe9,0x20,0x00,0xf8,0x3f,0x38,0xca,0xd8,0x90,0x0f,0x86,0xff,0xaf,0x8f,0xf6,
+0x00,0xf8,0x7c,0x72,0x84,0x8c,0x10,0xae,0x01,0x30,0xb6,0x00,0x8b,0xb0,0x00,0x30,
+0x50,0x06,0xf4,0xb0,0x00,0xf0,0x07,0x88,0x9e,0x98,0x83,0x09,0xf8,0x7f,0xff,0xff,
+0xff,0x66,0xff,0x80,0x00,0x4f,0x30,0x00,0x5e,0xf8,0x00,0x04,0xf3,0x7a,0x01,0x01,
+0xd4,0x06,0x71,0xf8,0x07,0x7a,0xf9,0x77,0x00,0x0f,0x1a,0x00,0x12,0x00,0x1a,0x00,
+0x90,0x0f,0x86,0x88,0xaf,0xa8,0x85,0x00,0xf8,0xbf,0xcd,0x06,0x04,0xb0,0x00,0x21,
+0xe6,0x00,0x5a,0x07,0x00,0x72,0x02,0xf0,0x1d,0xa0,0x1e,0xc3,0x88,0x88,0x8d,0xf5,
+0x0b,0xf9,0x00,0x00,0x00,0x9e,0x06,0xff,0x94,0xff,0xff,0x09,0xe0,0x4d,0xf9,0x4f,
+0x79,0xf0,0x9e,0x00,0x2e,0x94,0xf2,0x5f,0x09,0xe0,0x00,0xe9,0x4f,0x8a,0xf0,0x9e,
+0x00,0x0e,0x94,0xfe,0xee,0x0d,0x00,0x40,0x28,0x10,0x00,0x9e,0xb3,0x02,0x9b,0x08,
+0x8d,0xd0,0x00,0xe9,0x00,0x00,0xcf,0xe6,0x5e,0x02,0x40,0xd7,0x07,0xb0,0x00,0x5e,
+0x02,0xf0,0x22,0xec,0x00,0x00,0x00,0x0e,0xd0,0x5f,0xff,0xff,0xf9,0x09,0xf8,0x1e,
+0xdd,0xf8,0x88,0x56,0xff,0x8b,0xf3,0xae,0x00,0x00,0x5e,0xf8,0x89,0x0a,0xff,0xff,
+0x40,0x3f,0x80,0x00,0xaf,0x55,0x51,0x00,0xf8,0x00,0x0a,0xe2,0x22,0x10,0x0f,0x80,
+0x00,0xaf,0xff,0xf7,0x0d,0x00,0x50,0xf3,0x33,0x10,0x0f,0x80,0xa1,0x01,0x00,0x0d,
+0x00,0x16,0xe0,0x55,0x00,0x20,0xe8,0x00,0xab,0x03,0x10,0x7f,0x84,0x03,0xf1,0x0d,
+0x80,0x0e,0xb4,0x77,0xbf,0x77,0x74,0x0a,0xf8,0x14,0x49,0xf5,0x44,0x17,0xff,0x86,
+0xff,0xff,0xff,0xf3,0x7c,0xf8,0x6f,0x07,0xf1,0x4f,0x30,0x0e,0x0d,0x00,0xb0,0x00,
+0xe8,0x3b,0x5c,0xe4,0x44,0x10,0x0e,0x80,0xdb,0xe9,0x3a,0x00,0xf0,0x06,0x02,0xff,
+0x91,0x00,0x00,0x0e,0x98,0xef,0xbf,0xfc,0x94,0x00,0xe8,0x9a,0x30,0x17,0xad,0x30,
+0x00,0x00,0x05,0x5e,0x02,0x72,0x77,0x77,0xaf,0x97,0x77,0x71,0x1f,0x0a,0x06,0xf1,
+0x2d,0x03,0xd5,0x6f,0x41,0xd6,0x00,0x00,0x8f,0x25,0xf4,0x6f,0x40,0x00,0x2e,0xfc,
+0x6f,0x5e,0xfe,0x30,0x1d,0xe6,0xbc,0xff,0xe5,0xdf,0x10,0x83,0x09,0xff,0xfb,0x00,
+0x30,0x00,0x1a,0xfc,0xfb,0xfb,0x10,0x00,0x7f,0xf6,0x5f,0x46,0xff,0x80,0x5f,0xd4,
+0x05,0xf4,0x04,0xdf,0x40,0x40,0x00,0x5f,0x40,0x00,0x40,0x00,0x31,0xa2,0x00,0xf5,
+0x3e,0x0e,0xbf,0xff,0xf4,0x04,0xf2,0x04,0xf4,0x9f,0x86,0x47,0x4f,0x20,0xaf,0x07,
+0xf0,0x05,0xf4,0xf2,0x3f,0xe0,0xaf,0xff,0x7f,0x4f,0x29,0xfe,0x0e,0xcb,0xf6,0xf4,
+0xf2,0x4e,0xe6,0xf3,0x7e,0x5f,0x4f,0x20,0x8e,0xcd,0x6b,0xa5,0xf4,0xf2,0x07,0xe4,
+0x8f,0xf6,0x5f,0x4f,0x20,0x7e,0x00,0x9f,0x15,0xf4,0xf2,0x07,0xe0,0x1e,0x80,0x00,
+0x4f,0x20,0x7e,0x1d,0xe1,0x02,0x9b,0xf1,0x07,0xe0,0xa2,0x00,0x0d,0xd8,0xa3,0x04,
+0xf0,0x05,0xe3,0x4f,0x30,0xe9,0x00,0x00,0x9f,0x14,0xf3,0x0e,0x90,0x00,0x1f,0xa5,
+0xaf,0x97,0xfc,0x72,0x0b,0xf7,0xc9,0x01,0x30,0x47,0xff,0x60,0x1a,0x00,0x30,0x6e,
+0xf6,0x04,0x1a,0x00,0x91,0x3f,0x67,0x9f,0x97,0xfc,0x72,0x01,0xf6,0xff,0xa3,0x04,
+0xf4,0x09,0x60,0x15,0x10,0x22,0x00,0x01,0xf6,0x09,0xf2,0x0c,0xe1,0x00,0x1f,0x79,
+0xf5,0x00,0x1e,0xc0,0x01,0xf7,0x96,0x00,0x00,0x5b,0x58,0x02,0xf0,0x0d,0x07,0xe0,
+0x28,0xa8,0xf3,0x50,0x00,0xdf,0xdf,0xfb,0xbf,0x6e,0x00,0x4f,0x88,0xbe,0x08,0xf0,
+0xf5,0x0d,0xf3,0x19,0xe1,0x8f,0x14,0x07,0xff,0xaf,0xdd,0x09,0xf3,0x1f,0x9f,0xf5,
+0x3a,0xf3,0x8f,0x56,0x12,0x6f,0x30,0x8f,0x77,0xf9,0xf1,0x04,0xf7,0xcf,0xff,0x7f,
+0xf7,0x00,0x4f,0x7b,0xce,0x00,0xfd,0x10,0x04,0xf3,0x08,0xe0,0xbf,0xa7,0x80,0x4f,
+0x36,0xce,0xcf,0xbf,0xc8,0x04,0xf3,0xde,0x73,0x30,0xbe,0x20,0x55,0x00,0x22,0x05,
+0x20,0xc9,0x08,0x00,0x50,0x03,0xf0,0x07,0x00,0x9f,0x1f,0xa5,0x55,0xce,0x00,0x1f,
+0xb0,0xf7,0x00,0x09,0xe0,0x0c,0xf8,0x0f,0xa5,0x55,0xce,0x07,0xff,0x80,0x1a,0x00,
+0x21,0x6c,0xf8,0x2c,0x05,0x20,0x1e,0x8c,0xeb,0x08,0xa0,0x00,0xe8,0x67,0xbf,0xff,
+0x87,0x40,0x0e,0x80,0x2f,0x89,0x08,0xfa,0x03,0xe8,0x4e,0xd8,0xf5,0xfc,0x10,0x0e,
+0xaf,0xd1,0x7f,0x16,0xfa,0x00,0xe8,0x30,0x07,0xf1,0x03,0x57,0x02,0x41,0x02,0xd3,
+0x00,0xb7,0x4e,0x0b,0x60,0x08,0xd0,0x00,0x00,0x1f,0x9e,0xe9,0x01,0x90,0x0a,0xf7,
+0x34,0x44,0x44,0x44,0x05,0xff,0x70,0xdd,0x08,0x91,0x5c,0xf7,0x05,0x55,0x55,0x51,
+0x00,0x1e,0x70,0xea,0x08,0xf3,0x11,0xe7,0x04,0x44,0x44,0x41,0x00,0x0e,0x73,0xff,
+0xff,0xff,0x70,0x00,0xe7,0x3f,0x10,0x00,0xe7,0x00,0x0e,0x73,0xf6,0x44,0x4e,0x70,
+0x00,0xe7,0x3e,0xee,0xee,0xe6,0x00,0x0b,0x09,0x50,0x07,0xe1,0x02,0xf6,0x00,0xdc,
+0x09,0xf5,0x34,0xaf,0xfe,0xed,0x00,0x3f,0x60,0x6f,0xe5,0x6f,0x90,0x0c,0xf3,0x5d,
+0xbe,0xac,0xe1,0x06,0xff,0x4f,0x31,0x9f,0xf8,0x10,0x8f,0xf4,0xfc,0xfe,0x89,0xff,
+0x61,0x7f,0x4f,0x74,0x3b,0xa0,0x60,0x04,0xf4,0xf3,0xae,0x84,0xa1,0x00,0x4f,0x4f,
+0x22,0x6b,0xe4,0x30,0x04,0xf4,0xf2,0x9c,0x64,0xce,0x20,0x4f,0x30,0x16,0x9d,0xfa,
+0x10,0x04,0xf3,0x02,0xea,0x51,0xb3,0x07,0x40,0x08,0xc0,0x00,0xad,0xad,0x06,0x01,
+0x8e,0x01,0xf5,0x30,0x4f,0x5f,0x88,0xa6,0x6a,0x72,0x0c,0xf2,0xf4,0x8b,0x00,0xe5,
+0x05,0xff,0x1f,0x4c,0x96,0x6f,0x91,0x9f,0xf2,0xf7,0xf9,0xee,0xfe,0x42,0x9f,0x2f,
+0xef,0x65,0x0e,0x50,0x06,0xf3,0xf8,0xf6,0xf3,0xe5,0x00,0x6f,0x4f,0x1e,0x59,0xbe,
+0x50,0x06,0xf7,0xf0,0xe5,0x11,0xe5,0x00,0x6f,0xbc,0x0e,0x51,0x5f,0x50,0x06,0xf7,
+0x70,0xd5,0x0e,0x64,0x08,0x21,0x27,0x10,0x66,0x05,0x11,0xf9,0x0b,0x09,0xf1,0x22,
+0xec,0x7f,0x55,0x55,0x8f,0x20,0x4f,0x67,0xe0,0x39,0x04,0xf2,0x0c,0xf3,0x7e,0x26,
+0xe2,0x5f,0x26,0xff,0x37,0xeb,0xff,0xea,0xf2,0x9e,0xf3,0x7e,0x05,0xe1,0x4f,0x22,
+0x5f,0x37,0xe6,0xff,0xf6,0xf2,0x03,0xf3,0x7e,0x6a,0x0f,0x6f,0x20,0x3f,0x37,0xe6,
+0xeb,0x0d,0x00,0x90,0x25,0x55,0x5f,0x20,0x3f,0x37,0xff,0xff,0xff,0x0d,0x00,0xf0,
+0x05,0x55,0x55,0x7d,0x20,0x00,0x0a,0x30,0x08,0xb0,0x00,0x00,0x07,0xf6,0x66,0xbf,
+0x76,0x60,0x00,0xec,0x6f,0x7f,0x06,0xf0,0x00,0xaf,0x60,0x6d,0x00,0x7e,0x00,0x6f,
+0xf5,0x03,0xf2,0x0d,0xa0,0x06,0xef,0x5e,0xa8,0x01,0xf0,0x0a,0x03,0xf5,0x44,0x44,
+0x44,0x44,0x20,0x2f,0x50,0xef,0xff,0xff,0x70,0x02,0xf5,0x0e,0xb6,0x67,0xf7,0x00,
+0x2f,0x50,0xe8,0x00,0x0f,0x0d,0x00,0x20,0xc7,0x77,0x0d,0x00,0x61,0xef,0xee,0xef,
+0x70,0x00,0x21,0xa9,0x00,0xf2,0x26,0x0c,0xd4,0x44,0x42,0x03,0xf2,0x01,0xfa,0xff,
+0xff,0x8c,0x5f,0x20,0x7f,0x38,0xf5,0x73,0xf6,0xf2,0x0e,0xf0,0xc9,0x7f,0x3f,0x6f,
+0x27,0xfe,0x5f,0xff,0xfb,0xf6,0xf2,0x9f,0xe1,0x77,0x44,0x7f,0x6f,0x22,0xae,0x02,
+0xda,0x22,0xf6,0xf2,0x07,0xe6,0xff,0xff,0x8f,0x6f,0x20,0x7e,0x0d,0x00,0xf4,0x03,
+0xe2,0x4d,0xdb,0x80,0x3f,0x20,0x7e,0xaf,0xc9,0x63,0x7a,0xf1,0x07,0xe0,0x00,0x00,
+0x0a,0xc8,0xfe,0x00,0x21,0x03,0xd2,0x22,0x07,0x20,0xbe,0xcf,0xa3,0x00,0xf0,0x07,
+0x2f,0x84,0x55,0xfb,0x55,0x50,0x0c,0xf4,0x3c,0xcf,0xdc,0xc4,0x07,0xff,0x33,0xf6,
+0x55,0x5f,0x60,0x5e,0xf3,0x3f,0x94,0x05,0x72,0x4f,0x33,0xf4,0x33,0x3f,0x60,0x02,
+0x0d,0x00,0x46,0x2f,0x33,0xf4,0x22,0x0d,0x00,0x80,0x6a,0xf9,0x88,0x9f,0xb3,0x02,
+0xf7,0xcc,0x88,0x09,0x03,0x0a,0x06,0x21,0x01,0xf6,0x55,0x04,0xf0,0x06,0x8f,0x8e,
+0xee,0xfe,0xed,0x00,0x1f,0xa7,0xf5,0x55,0x5b,0xe0,0x0a,0xf6,0x7f,0x55,0x55,0xbe,
+0x06,0xff,0x67,0xad,0x02,0xf0,0x08,0x8f,0xf6,0x8f,0x55,0x55,0x55,0x01,0x4f,0x69,
+0xef,0xff,0xff,0xf1,0x01,0xf6,0xac,0xf4,0xd8,0x5f,0x10,0x1f,0x6d,0xaf,0x0d,0x00,
+0xf5,0x03,0xf7,0xf7,0xf7,0xea,0x7f,0x10,0x1f,0xcf,0x3f,0x4d,0x88,0xf1,0x01,0xf9,
+0x91,0xf4,0xd8,0xcb,0xa7,0x02,0x30,0xc2,0x00,0xbc,0x49,0x05,0x10,0xef,0xe6,0x07,
+0xf0,0x0d,0x1f,0x84,0x88,0x88,0x88,0x50,0x0c,0xf3,0x1f,0xb9,0x9a,0xf4,0x07,0xff,
+0x31,0xfd,0xbb,0xcf,0x40,0x4d,0xf3,0x36,0x66,0x66,0x63,0x00,0x4f,0x6f,0x6a,0x03,
+0xf0,0x0f,0x02,0xf6,0xf5,0x44,0x44,0x5f,0x40,0x2f,0x45,0xef,0xff,0xff,0x51,0x02,
+0xf3,0x01,0x1b,0xe1,0x10,0x00,0x2f,0x30,0x26,0xce,0x00,0x00,0x02,0xf3,0x02,0xfe,
+0xf7,0x09,0x12,0x22,0x54,0x09,0xf0,0x21,0xde,0xff,0xf0,0x02,0xf3,0x01,0xf7,0xe7,
+0x7f,0x3a,0x3f,0x30,0x8f,0x3e,0xbb,0xf4,0xf3,0xf3,0x2f,0xf3,0xec,0xcf,0x4f,0x3f,
+0x3a,0xff,0x3e,0x66,0xf4,0xf3,0xf3,0x6c,0xf3,0xef,0xff,0x4f,0x3f,0x30,0x4f,0x3e,
+0x77,0xf4,0xf3,0xf3,0x04,0xf3,0xeb,0xbf,0x0d,0x00,0x30,0x3c,0xcc,0xd4,0x0d,0x00,
+0xf4,0x03,0x8b,0x7c,0x00,0x3f,0x30,0x4f,0x6f,0x63,0xf4,0x59,0xf2,0x04,0xf7,0x90,
+0x06,0x17,0xfa,0x00,0x07,0x04,0x71,0xd0,0x0f,0x70,0xf8,0x00,0x00,0xdc,0x54,0x01,
+0xf0,0x1f,0x4f,0x56,0x7f,0xb7,0xfb,0x70,0x0d,0xf6,0xcc,0xfe,0xcf,0xec,0x58,0xff,
+0x59,0xfd,0x88,0x88,0x83,0x6e,0xf5,0xcf,0xed,0xdd,0xdd,0x00,0x5f,0xdf,0xf8,0x9f,
+0x6a,0xf0,0x04,0xf5,0x8f,0xff,0xfe,0xff,0x00,0x4f,0x33,0xf7,0x8f,0x5a,0xf0,0x04,
+0x54,0x01,0x00,0x0d,0x00,0x30,0xf5,0x6f,0x4a,0x0d,0x00,0x35,0x35,0xf5,0xe9,0xff,
+0x00,0xf0,0x26,0xe7,0x33,0x8f,0x53,0x31,0x00,0xaf,0xbc,0xce,0xfd,0xcc,0x50,0x2f,
+0x83,0xbb,0xdf,0xcb,0xb0,0x0c,0xf5,0x4f,0x8a,0xf7,0xaf,0x09,0xff,0x54,0xfa,0xbf,
+0x9b,0xf0,0x7d,0xf5,0x4f,0xee,0xfd,0xef,0x00,0x3f,0x55,0x77,0xbf,0x9f,0xd1,0x02,
+0xf5,0x69,0x98,0x8c,0xfa,0x40,0x2f,0x6f,0x66,0x02,0xc0,0x02,0xf5,0x3b,0xe3,0x3a,
+0xf3,0x20,0x2f,0x50,0x2f,0x93,0xae,0xa6,0x09,0x15,0x31,0xad,0x06,0xf0,0x1b,0x00,
+0x3b,0x25,0xf0,0x0c,0xb0,0x00,0x0a,0xfc,0xef,0xdd,0xff,0xd3,0x02,0xfa,0x49,0xf6,
+0x6d,0xd5,0x10,0xcf,0x50,0x5e,0xff,0xeb,0x00,0x7f,0xf5,0x4a,0xad,0xfa,0xa8,0x09,
+0xef,0x56,0xf3,0xbf,0x3b,0xd0,0x13,0xf5,0x6f,0x6e,0x0d,0xf0,0x00,0x2f,0x55,0x88,
+0xdf,0x88,0x80,0x02,0xf5,0x48,0x8d,0xf8,0x87,0x00,0x2f,0x53,0xf5,0x06,0xd0,0x02,
+0xf5,0x57,0x7c,0xf7,0x76,0x10,0x2f,0x5c,0xcc,0xcc,0xcc,0xc4,0xf0,0x14,0x00,0x1b,
+0x32,0xc4,0x00,0x00,0x00,0x08,0xf2,0xcf,0xff,0xf3,0x00,0x00,0xfb,0xbf,0x65,0xed,
+0x22,0x00,0x9f,0xbf,0xff,0xff,0xff,0xe0,0x5f,0xf4,0x7f,0x28,0xe2,0x9e,0x08,0xff,
+0x45,0x0d,0x00,0xf6,0x18,0x16,0xf4,0x3a,0xff,0x30,0x68,0x00,0x2f,0x5b,0x98,0xfe,
+0xcf,0x80,0x02,0xf5,0x8e,0xb8,0xf9,0xf6,0x00,0x2f,0x45,0x7b,0xee,0x88,0xe3,0x02,
+0xf6,0xdf,0xb6,0xf7,0x0c,0x80,0x2f,0x44,0x13,0xfd,0x10,0x00,0x01,0x00,0xc0,0x10,
+0x01,0x00,0x00,0x02,0xf5,0x5e,0x10,0xbe,0x00,0x00,0xae,0x4f,0x00,0xf8,0x34,0x50,
+0x3f,0x62,0x88,0xde,0x88,0x70,0x1d,0xf2,0x18,0x8d,0xe8,0x87,0x09,0xff,0x5f,0xff,
+0xff,0xff,0xfa,0x5b,0xf4,0x79,0xbb,0x7b,0x88,0x10,0x4f,0x38,0xaf,0x37,0xf3,0xd3,
+0x04,0xf6,0xef,0xfe,0xff,0xef,0xc0,0x4f,0x33,0x7f,0x85,0xf8,0xc3,0x04,0xf8,0xff,
+0xfb,0x2e,0xf8,0x00,0x4f,0x32,0x6f,0x2b,0xff,0x7b,0x04,0xf2,0x5f,0xa2,0xa2,0xaf,
+0x70,0x00,0x01,0x00,0xf0,0x2a,0x02,0xe5,0xc4,0x8f,0x0a,0x90,0x00,0xaf,0x8d,0xdb,
+0xf7,0xfa,0x30,0x2f,0x9f,0xb9,0x99,0x99,0xe8,0x0d,0xf5,0xad,0xdb,0xbc,0xec,0x5a,
+0xff,0x50,0xcd,0xaa,0xbf,0x40,0x6c,0xf5,0x27,0x77,0x77,0x76,0x00,0x3f,0x55,0xf8,
+0x88,0x8c,0xe0,0x02,0xf5,0x5f,0xba,0xaa,0xde,0x00,0x2f,0x55,0xfa,0xaa,0xad,0x0d,
+0x00,0xf9,0x02,0xdd,0xdd,0xee,0x00,0x2f,0x54,0xaf,0x41,0xed,0x71,0x02,0xf6,0xda,
+0x40,0x01,0x7e,0x50,0x5b,0x00,0xf2,0x30,0x0a,0x96,0x90,0x08,0xb0,0x83,0x01,0xf6,
+0x2b,0x08,0xef,0xbf,0x20,0x6f,0x7e,0xee,0x5b,0xdd,0xb0,0x0d,0xe1,0x44,0x45,0xbd,
+0xf9,0x37,0xfe,0x0f,0xfe,0xcf,0xff,0xf9,0x7f,0xe0,0x55,0x40,0xaf,0x20,0x01,0x8e,
+0x0f,0xff,0xbf,0xfe,0xe2,0x05,0xe1,0x55,0x7d,0xea,0x6f,0x30,0x5e,0x3f,0xdf,0x1c,
+0xff,0xf3,0x05,0xe3,0xf1,0xf1,0xca,0x0d,0x00,0x95,0xb8,0xf3,0x05,0xe3,0xc7,0xe1,
+0xce,0xde,0x20,0x57,0x00,0x11,0x7f,0x0b,0x00,0x60,0x03,0xf8,0x00,0x00,0x02,0xff,
+0x01,0x00,0xf0,0x06,0xf2,0x17,0x7a,0xfd,0x77,0xa9,0x77,0x10,0x01,0xee,0x10,0x1e,
+0xe2,0x00,0x02,0xdf,0x85,0x67,0xbf,0xe1,0x00,0x17,0x01,0xf3,0x15,0xef,0xc0,0x00,
+0x11,0xfb,0x0d,0xd0,0x53,0x00,0x00,0x5f,0x70,0xdd,0x00,0x40,0x00,0x2d,0xf2,0x0d,
+0xd0,0x0e,0x91,0x8e,0xf7,0x00,0xcf,0x77,0xf7,0x1e,0xd5,0x00,0x06,0xef,0xfd,0x10,
+0x10,0x64,0x01,0xf1,0x10,0x05,0xf4,0x00,0x10,0x00,0x2f,0x70,0x5f,0x40,0x5f,0x60,
+0x00,0x9f,0x35,0xf4,0x1e,0xd0,0x00,0x00,0xd5,0x5f,0x46,0xe2,0x00,0x17,0x77,0x7a,
+0xfa,0x77,0x77,0x13,0x68,0x00,0xc0,0xf3,0x00,0x02,0xf8,0x0b,0xd0,0x00,0x00,0x00,
+0x4f,0x50,0xbd,0xde,0x00,0x10,0xf1,0x0d,0x00,0xf4,0x05,0x05,0xfb,0x00,0xbd,0x00,
+0x82,0x19,0xfe,0x10,0x0a,0xf7,0x8f,0x63,0xfa,0x20,0x00,0x4e,0xff,0xd1,0x01,0xa9,
+0x00,0x52,0x05,0xf3,0x00,0x00,0x01,0xa3,0x00,0xf0,0x00,0x07,0x77,0x7a,0xf9,0x77,
+0x77,0x10,0x04,0x66,0x9f,0x86,0x65,0x00,0x00,0xcf,0x09,0x02,0xf5,0x1f,0x00,0x0c,
+0xb0,0x00,0x00,0xbe,0x00,0x00,0xcf,0xee,0xee,0xef,0xe0,0x00,0x05,0x7f,0xc7,0xed,
+0x76,0x00,0x00,0x04,0xf6,0x0d,0xb0,0x02,0x00,0x01,0xdf,0x10,0xdb,0x00,0xf6,0x39,
+0xff,0x70,0x0d,0xe7,0x8f,0x52,0xfb,0x40,0x00,0x6f,0xff,0xc0,0xfe,0x00,0x11,0xa2,
+0x06,0x00,0x21,0x3f,0xe2,0x07,0x00,0x21,0x5f,0xd0,0x07,0x00,0x11,0x9f,0xd3,0x01,
+0x20,0x0c,0xff,0xce,0x00,0x30,0x01,0xfd,0xfa,0x0d,0x00,0xf0,0x11,0x8f,0x69,0xf4,
+0x00,0x00,0x00,0x1f,0xe0,0x1e,0xe0,0x00,0x00,0x0c,0xf5,0x00,0x7f,0xa0,0x00,0x1b,
+0xfa,0x00,0x00,0xcf,0xa0,0x3e,0xfb,0x00,0x00,0x01,0xdf,0x70,0x98,0x2a,0x00,0x14,
+0xb1,0x54,0x00,0x20,0x06,0x60,0x06,0x00,0x11,0xaf,0xbe,0x01,0x40,0xce,0x10,0x00,
+0x0a,0xb3,0x00,0xf5,0x1e,0xfe,0xaf,0x77,0xdf,0xf7,0x7d,0xea,0xe0,0x1f,0xef,0x50,
+0xae,0xae,0x0a,0xf2,0xee,0x1a,0xea,0xfb,0xf8,0x05,0xfe,0xde,0xaf,0xc6,0x00,0x06,
+0xdb,0xea,0xe0,0x00,0x00,0x00,0xae,0xae,0x00,0x00,0x06,0x8e,0xda,0xe0,0x00,0x00,
+0x7f,0xe6,0x9e,0x00,0x11,0x4e,0x44,0x00,0x30,0x3e,0xfe,0x30,0x9d,0x00,0xf0,0x0c,
 0xc3,0xdf,0x50,0x00,0x03,0xcf,0xa0,0x01,0xcf,0xa2,0x06,0xff,0xc5,0x55,0x55,0xdf,
-0xf7,0x1a,0x07,0x08,0x23,0xab,0x20,0x05,0x12,0x40,0x16,0x69,0xf9,0x66,0x3b,0x1c,
-0x01,0x15,0x13,0x20,0x00,0x04,0xb0,0x00,0x01,0x2f,0x10,0x10,0x60,0xed,0x0f,0x00,
-0x50,0x15,0xf2,0x1a,0x03,0x82,0x02,0x93,0x00,0x00,0x00,0xcf,0x20,0x2f,0xc0,0x00,
-0x00,0x4f,0xa0,0x00,0x8f,0x70,0x00,0x2e,0xf2,0x00,0x00,0xdf,0x50,0x1d,0xf5,0x0a,
-0xc2,0x02,0xef,0x41,0xc8,0x03,0xfd,0x00,0x04,0xd1,0x00,0x00,0xcf,0xce,0x12,0x70,
-0x90,0x1d,0xa0,0x00,0x00,0x3f,0xc0,0x9e,0x0e,0xf4,0x04,0x3e,0xfa,0x9a,0xbd,0xff,
-0x10,0x05,0xff,0xff,0xed,0xcb,0xfa,0x00,0x05,0x31,0x00,0x00,0x0b,0xa0,0xa2,0x00,
-0xf2,0x0c,0x0e,0xa0,0x00,0x4f,0x40,0x00,0x7a,0xfe,0xaa,0xac,0xfc,0xa2,0x09,0xdf,
-0xfd,0xdd,0xdf,0xed,0x20,0x00,0xec,0x55,0x58,0xf4,0x00,0x00,0x0e,0xcb,0x10,0x35,
-0xeb,0x33,0x36,0x0d,0x00,0x62,0x11,0xea,0x11,0x15,0xf5,0x10,0xca,0x09,0xf4,0x05,
-0x80,0x55,0x7d,0x85,0x5c,0x85,0x52,0x04,0xaf,0xf8,0x03,0xdf,0xc5,0x00,0xcd,0x71,
-0x00,0x00,0x4c,0xd2,0x55,0x00,0x03,0xf8,0x11,0x45,0xf6,0x33,0x33,0xcf,0x0d,0x00,
-0x30,0xf7,0x44,0x44,0x0d,0x00,0x3c,0xee,0xee,0xef,0x1a,0x00,0x43,0xf5,0x22,0x22,
-0xbf,0x29,0x10,0xf5,0x05,0xa0,0x55,0xbf,0x75,0x5d,0xe7,0x53,0x05,0xcf,0xc2,0x00,
-0x7e,0xfa,0x20,0xcc,0x50,0x00,0x00,0x08,0xe4,0x4d,0x01,0xc2,0xca,0x1f,0x50,0x00,
-0x00,0x37,0x7e,0xc8,0xfa,0x77,0x10,0x07,0xab,0x10,0xe1,0x7f,0x0c,0xa1,0xf5,0x6f,
-0x20,0x07,0xf7,0xec,0x8f,0xaa,0xf2,0x00,0x7f,0x60,0x0a,0xe1,0x07,0xf0,0xca,0x1f,
-0x56,0xf2,0x03,0xaf,0x4d,0xc6,0xf8,0x9f,0x61,0xcf,0x55,0x00,0xf0,0x02,0x51,0x23,
-0xcc,0x32,0x7f,0x82,0x20,0x18,0xef,0x90,0x03,0xcf,0xd4,0x04,0xfa,0x20,0x00,0x5e,
-0x17,0x09,0x01,0x00,0xe1,0x03,0xd6,0x00,0x02,0xd7,0x00,0x03,0x4e,0xf5,0x34,0xdf,
-0x63,0x10,0xff,0x1a,0x13,0x62,0x00,0x33,0xbe,0x3e,0xb3,0x31,0x5a,0x13,0x81,0x50,
-0x04,0x44,0xbe,0x4e,0xb7,0xf8,0x31,0x1a,0x00,0x10,0xfa,0x1a,0x00,0x42,0xb6,0xf5,
-0x00,0x3f,0xa5,0x10,0xf2,0x05,0x4e,0xfe,0x0e,0xff,0x60,0x01,0xaf,0xaa,0xe0,0xea,
-0x7f,0xd5,0x09,0x40,0x9e,0x0e,0x90,0x2a,0x10,0x01,0x27,0x00,0xf3,0x03,0x1f,0xbb,
-0xf8,0xde,0x8f,0xa0,0x01,0xf6,0x5f,0x0a,0xc0,0xea,0x00,0x1f,0x65,0xf0,0xac,0x0e,
-0x0d,0x00,0x72,0x03,0x9f,0xbb,0xf9,0xde,0x8f,0xd7,0xe7,0x10,0x18,0xc0,0x1a,0x00,
-0x07,0x27,0x00,0x93,0xc7,0xf9,0x00,0x1f,0x64,0xc0,0x89,0xae,0x40,0x49,0x0c,0xf0,
-0x21,0x70,0x00,0xad,0x0c,0x90,0x00,0x3f,0x80,0x1f,0x90,0x8f,0x10,0x00,0xbf,0x18,
-0xff,0xff,0xff,0xf5,0x04,0xe7,0xff,0x66,0xbf,0x66,0x20,0x01,0xef,0xf6,0x6b,0xf6,
-0x60,0x00,0x2e,0xbf,0xee,0xff,0xee,0x10,0x08,0x47,0xf0,0x09,0xe0,0x00,0x01,0xf9,
-0x7f,0x0d,0x00,0xe0,0x7f,0x47,0xf6,0x6c,0xf6,0x60,0x0e,0xe0,0x7f,0x11,0x9e,0x11,
-0x05,0xf8,0x34,0x01,0x40,0xf9,0x04,0x10,0x7f,0x64,0x08,0x01,0xf8,0x11,0xf1,0x07,
-0x02,0xc4,0x09,0xf1,0x07,0xc0,0x3f,0x50,0x9f,0x10,0x9f,0x13,0xf5,0x09,0xf1,0x09,
-0xf1,0x3f,0xb8,0xdf,0x98,0xdf,0xdd,0x03,0xf0,0x09,0xf1,0x98,0x00,0x9f,0x10,0x1a,
-0x6e,0xd0,0x09,0xf1,0x01,0xf9,0xed,0x00,0x9f,0x10,0x1f,0x9e,0xd3,0x3b,0xf4,0x35,
-0xf9,0xef,0x1c,0x00,0x63,0x94,0x44,0x44,0x44,0x46,0xf9,0x3a,0x01,0x12,0x09,0xa6,
-0x14,0xf1,0x2b,0x46,0x66,0x6c,0xfc,0x00,0x00,0x21,0x00,0x09,0xfa,0x01,0x30,0x0f,
-0x86,0x11,0xf9,0x18,0x9f,0x00,0xf8,0xce,0x3f,0x7a,0xd8,0xf0,0x0f,0x71,0xa6,0xff,
-0xe2,0x7f,0x00,0xf7,0x3b,0xff,0xef,0x37,0xf0,0x0f,0xcf,0xc4,0xf7,0xaf,0xaf,0x00,
-0xf8,0x65,0xaf,0x60,0x88,0xf0,0x0f,0x70,0x3b,0x80,0x00,0x7f,0x00,0x05,0x01,0x20,
-0xf0,0x06,0x20,0x12,0x17,0xbf,0x37,0x03,0x90,0x4e,0x40,0x00,0x00,0x0d,0xf2,0x00,
-0xee,0x00,0xdb,0x22,0xf0,0x02,0x05,0xfa,0x00,0x04,0xfe,0x10,0x00,0x0a,0xf8,0x04,
-0xff,0xb7,0x77,0x77,0x8f,0xf5,0x0b,0xd8,0x01,0x70,0xca,0x00,0x00,0x08,0xf3,0x01,
-0xf9,0xa1,0x19,0x00,0x02,0x1a,0x90,0x00,0x2f,0x90,0x02,0xf7,0x00,0x00,0x2e,0xf2,
-0xf6,0x1a,0xa4,0x8f,0xf5,0x05,0x8c,0xf3,0x00,0x0b,0xc3,0x00,0x6f,0xa8,0x00,0x04,
-0xa0,0x0e,0xf4,0x37,0x1f,0x60,0x9f,0xff,0xff,0xf5,0x01,0xf6,0x04,0x6d,0xe6,0x9f,
-0x51,0x5f,0xdd,0xa0,0xcb,0x04,0xf5,0x8f,0xfd,0x95,0x0d,0xa0,0x4f,0x42,0x4f,0x60,
-0x00,0xf9,0x05,0xf4,0x01,0xf6,0x00,0x1f,0x70,0x5f,0x30,0x1f,0x77,0x85,0xf4,0x06,
-0xf2,0x04,0xff,0xf8,0xce,0x00,0x8f,0x10,0x8f,0x81,0x5f,0x70,0x0a,0xf0,0x01,0x10,
-0x6f,0xe1,0x79,0xfc,0x00,0x00,0x06,0xd2,0x09,0xfd,0x02,0x16,0x11,0x1f,0xe8,0x01,
-0x70,0x70,0x7b,0xf8,0x77,0x46,0x61,0xf7,0x4e,0x0d,0xf0,0x14,0xcc,0x1f,0x70,0x0f,
-0xff,0xff,0x4c,0xc1,0xf7,0x05,0xfa,0x9b,0xf2,0xcc,0x1f,0x70,0xde,0x00,0x9e,0x0c,
-0xc1,0xf7,0x2f,0x8b,0x2e,0xa0,0xcc,0x1f,0x70,0x34,0xfe,0xf3,0x0c,0xc1,0xf7,0x49,
-0x14,0xf0,0x02,0xbb,0x1f,0x70,0x00,0xbf,0x20,0x00,0x01,0xf7,0x06,0xdf,0x40,0x00,
-0x06,0x9f,0x70,0x8c,0x91,0x01,0x1a,0xc2,0x94,0x02,0xf0,0x40,0x0c,0x90,0x02,0x22,
-0x22,0x20,0x00,0x6e,0x16,0xff,0xff,0xff,0x14,0xff,0xfe,0x55,0xdd,0x5a,0xf0,0x26,
-0x6d,0xe0,0x0d,0xb0,0x7f,0x00,0x03,0xf7,0x20,0xea,0x07,0xf0,0x01,0xdf,0x9d,0x0f,
-0x80,0x8f,0x01,0xdf,0xff,0x23,0xf5,0x08,0xf0,0x7f,0xef,0xea,0x6f,0x20,0x9e,0x00,
-0x4a,0xe3,0x4d,0xd0,0x0a,0xd0,0x00,0xae,0x05,0xf7,0x00,0xcc,0x00,0x0a,0xe3,0xfd,
-0x18,0x9f,0x90,0x00,0xae,0x0a,0x20,0xbd,0xb1,0x00,0x0e,0x24,0x13,0xfa,0x34,0x8f,
-0x0e,0xa5,0x6f,0x63,0x50,0x8f,0x0e,0x70,0x1f,0x69,0xe0,0x8f,0x0e,0xda,0xbf,0x69,
-0xe0,0x8f,0x0c,0xff,0xdd,0x59,0xe0,0x8f,0x00,0xbd,0x00,0x09,0xe0,0x8f,0x00,0xdf,
-0xff,0x89,0xe0,0x8f,0x00,0xfb,0x7f,0x79,0xe0,0x8f,0x03,0xf4,0x0f,0x68,0xe0,0x8f,
-0x0a,0xf0,0x1f,0x50,0x00,0x8f,0x5f,0x84,0x8f,0x30,0x68,0xde,0x3b,0x0c,0xfa,0x00,
-0x7f,0xe7,0xa4,0x00,0xf0,0x36,0x4a,0xf3,0x00,0x08,0xf0,0x4c,0xff,0xfb,0x41,0x41,
-0x8f,0x02,0xa7,0xfa,0x00,0x4f,0x48,0xf0,0x00,0x0e,0xa0,0x04,0xf4,0x8f,0x05,0xff,
-0xff,0xff,0x4f,0x48,0xf0,0x26,0x9f,0xc6,0x64,0xf4,0x8f,0x00,0x0c,0xff,0x60,0x4f,
-0x48,0xf0,0x06,0xff,0xef,0x84,0xf4,0x8f,0x03,0xf8,0xea,0x86,0x4f,0x48,0xf0,0x6d,
-0x0e,0xa0,0x00,0x00,0x8f,0x00,0x10,0xea,0x00,0x06,0x9d,0x34,0x00,0x00,0x5a,0x00,
-0x10,0x0f,0x76,0x03,0xc3,0x6f,0x0f,0x9e,0xba,0xf6,0x43,0x6f,0x0f,0x6d,0x87,0xe6,
-0xb9,0x06,0x00,0x60,0x1f,0x7e,0x98,0xe7,0xb9,0x6f,0x2b,0x05,0x77,0xc9,0x6f,0x4f,
-0xae,0xbb,0xfa,0xb9,0x1e,0x00,0x11,0xa9,0x06,0x00,0xe1,0x00,0x6f,0x0f,0x6d,0x8a,
-0xf6,0x17,0xbf,0x0f,0x6d,0x8c,0xd2,0x0e,0xe7,0x95,0x01,0xf4,0x3a,0x6f,0x10,0x5b,
-0xf6,0xb6,0x3a,0x66,0xf1,0x00,0xdb,0x1f,0x80,0xd8,0x6f,0x10,0x5f,0x62,0xcf,0x1d,
-0x86,0xf1,0x0a,0xff,0xff,0xf7,0xd8,0x6f,0x10,0x25,0x69,0x04,0x0d,0x86,0xf1,0x04,
-0x59,0xf6,0x52,0xd8,0x6f,0x10,0xcf,0xff,0xff,0x6d,0x86,0xf1,0x00,0x06,0xf1,0x00,
-0xd8,0x6f,0x10,0x00,0x7f,0x8a,0x70,0x06,0xf1,0x1d,0xff,0xff,0xc6,0x16,0xbf,0x00,
-0xa7,0x42,0x00,0x00,0xef,0x90,0xbc,0x06,0xf3,0x3e,0xa6,0xf0,0x00,0x00,0x2d,0x40,
-0xbe,0x9f,0x54,0x17,0xe2,0xf4,0x1f,0xff,0xff,0xf6,0x7f,0x2f,0x44,0xf2,0x7f,0x21,
-0x07,0xf2,0xf4,0x5f,0xef,0xfe,0xed,0x7f,0x2f,0x42,0x77,0xaf,0x87,0x67,0xf2,0xf4,
-0x08,0x9c,0xf9,0x95,0x7f,0x2f,0x40,0xde,0xdf,0xcf,0x97,0xf2,0xf4,0x0d,0x86,0xf0,
-0xc9,0x25,0x2f,0x40,0xd8,0x6f,0x2d,0x90,0x02,0xf4,0x0d,0x86,0xfa,0xf6,0x07,0xaf,
-0x40,0x10,0x6f,0x10,0x00,0xbf,0xb0,0x55,0x00,0xf1,0x41,0x0d,0xff,0xff,0xfc,0x13,
-0x3f,0x30,0xda,0x55,0x5c,0xc6,0xe3,0xf3,0x0d,0x81,0x11,0xbc,0x6e,0x3f,0x30,0xdf,
-0xff,0xff,0xc6,0xe3,0xf3,0x0e,0x94,0x8c,0x43,0x6e,0x3f,0x30,0xe9,0x49,0xe4,0x46,
-0xe3,0xf3,0x0f,0xcf,0xff,0xfc,0x6e,0x3f,0x30,0xfb,0xd6,0xd6,0xc6,0xe3,0xf3,0x3f,
-0xad,0x6d,0x6c,0x5c,0x3f,0x37,0xf7,0xd6,0xea,0xc0,0x03,0xf3,0xbc,0x5b,0x6d,0x95,
-0x07,0xaf,0x22,0x40,0x06,0xd0,0x00,0xaf,0xa0,0x00,0x01,0x6c,0x0d,0xd2,0x08,0xf4,
-0x00,0x09,0xf3,0x00,0x34,0x6f,0xc4,0x45,0xfd,0x44,0x09,0x6e,0x07,0xf1,0x0e,0x01,
-0x11,0x11,0x11,0x11,0x53,0x00,0xef,0xff,0xf3,0x9b,0x0f,0x70,0x0e,0xb4,0x7f,0x3a,
-0xc0,0xf7,0x00,0xef,0xee,0xf3,0xac,0x0f,0x70,0x0e,0xa3,0x6f,0x0d,0x00,0x13,0xef,
-0x0d,0x00,0xf4,0x01,0x34,0x50,0xf7,0x00,0xe9,0x27,0xf3,0x05,0x7f,0x60,0x0e,0x95,
-0xfc,0x00,0x8f,0xd2,0x3d,0x03,0xf0,0x32,0x00,0x09,0x50,0x00,0x7f,0x1e,0xd3,0x6f,
-0x60,0x51,0x7f,0x03,0xbf,0xfa,0x00,0xf5,0x7f,0x17,0xee,0xcf,0x70,0xf5,0x7f,0x5f,
-0x84,0x4b,0x40,0xf5,0x7f,0x00,0x09,0xca,0xd1,0xf5,0x7f,0x59,0x9d,0xea,0xc1,0xf5,
-0x7f,0x6c,0xdf,0xfc,0xc1,0xf5,0x7f,0x00,0xbf,0xf7,0x00,0xe5,0x7f,0x2c,0xfc,0xee,
-0xc0,0x00,0x7f,0x8d,0x39,0xc1,0x50,0x28,0xce,0x43,0x28,0xf0,0x11,0x0f,0xe7,0x4f,
-0xff,0xff,0xfe,0x00,0x6f,0x11,0x44,0x44,0x44,0x48,0xb6,0xf1,0x03,0x44,0x44,0x41,
-0x8b,0x6f,0x10,0x9f,0xdd,0xef,0x58,0xb6,0xf1,0x09,0xd3,0x35,0xf5,0x0d,0x00,0xfc,
-0x1d,0xff,0xff,0x58,0xb6,0xf1,0x07,0x77,0x77,0x76,0x8b,0x6f,0x10,0xfb,0xaf,0x8d,
-0xc8,0xb6,0xf1,0x0f,0xdd,0xfc,0xec,0x57,0x6f,0x10,0xf9,0x8f,0x5c,0xc0,0x06,0xf1,
-0x0f,0x99,0xf6,0xcc,0x28,0xcf,0x00,0xfe,0xdd,0xde,0xb1,0xfe,0x80,0x6f,0x16,0xf1,
-0x3c,0x30,0x00,0x04,0xf2,0x00,0x6f,0xdf,0x60,0xb8,0x4f,0x22,0xbf,0xaa,0x6f,0x9c,
-0x94,0xf2,0x3f,0x95,0xf6,0x72,0xc9,0x4f,0x20,0x5f,0xcc,0xcf,0x1c,0x94,0xf2,0x05,
-0xfb,0xbc,0xf1,0xc9,0x4f,0x20,0x6f,0x77,0x9f,0x1c,0x94,0xf2,0x07,0xeb,0xbb,0xb0,
-0xc9,0x4f,0x20,0xbe,0xcc,0xcc,0x24,0x34,0xf2,0x1f,0xbe,0x57,0xf2,0x00,0x4f,0x27,
-0xe6,0xfd,0xef,0x20,0x9c,0xf1,0x03,0x6e,0x46,0xf2,0x0c,0xd8,0x0d,0x0c,0xf0,0x04,
+0xf7,0x1a,0xaf,0xff,0xff,0xff,0xab,0x20,0x00,0x00,0x5f,0x27,0x00,0xf0,0x00,0x16,
+0x69,0xf9,0x66,0x20,0x00,0x04,0xff,0xff,0xff,0xf6,0x00,0x00,0x00,0x04,0xb0,0x00,
+0x71,0x66,0x66,0x9f,0x96,0x66,0x60,0x0f,0x34,0x01,0xf0,0x1d,0x00,0x00,0x03,0x82,
+0x02,0x93,0x00,0x00,0x00,0xcf,0x20,0x2f,0xc0,0x00,0x00,0x4f,0xa0,0x00,0x8f,0x70,
+0x00,0x2e,0xf2,0x00,0x00,0xdf,0x50,0x1d,0xf5,0x0a,0xc2,0x02,0xef,0x41,0xc8,0x03,
+0xfd,0x00,0x04,0xd1,0x00,0x00,0xcf,0x30,0x75,0x00,0xf4,0x10,0x6f,0x90,0x1d,0xa0,
+0x00,0x00,0x3f,0xc0,0x00,0x9f,0x60,0x00,0x3e,0xfa,0x9a,0xbd,0xff,0x10,0x05,0xff,
+0xff,0xed,0xcb,0xfa,0x00,0x05,0x31,0x00,0x00,0x0b,0xa0,0xa2,0x00,0xf5,0x15,0x0e,
+0xa0,0x00,0x4f,0x40,0x00,0x7a,0xfe,0xaa,0xac,0xfc,0xa2,0x09,0xdf,0xfd,0xdd,0xdf,
+0xed,0x20,0x00,0xec,0x55,0x58,0xf4,0x00,0x00,0x0e,0xff,0xff,0xff,0x40,0x00,0x00,
+0xeb,0x33,0x36,0x0d,0x00,0x71,0x11,0xea,0x11,0x15,0xf5,0x10,0x1f,0x90,0x00,0xf4,
+0x05,0x80,0x55,0x7d,0x85,0x5c,0x85,0x52,0x04,0xaf,0xf8,0x03,0xdf,0xc5,0x00,0xcd,
+0x71,0x00,0x00,0x4c,0xd2,0x55,0x00,0x00,0x6e,0x02,0x75,0xf0,0x00,0x05,0xf6,0x33,
+0x33,0xcf,0x0d,0x00,0x30,0xf7,0x44,0x44,0x0d,0x00,0x3c,0xee,0xee,0xef,0x1a,0x00,
+0x61,0xf5,0x22,0x22,0xbf,0x00,0x2f,0x55,0x00,0xf5,0x05,0xa0,0x55,0xbf,0x75,0x5d,
+0xe7,0x53,0x05,0xcf,0xc2,0x00,0x7e,0xfa,0x20,0xcc,0x50,0x00,0x00,0x08,0xe4,0x4d,
+0x01,0xc1,0xca,0x1f,0x50,0x00,0x00,0x37,0x7e,0xc8,0xfa,0x77,0x10,0x07,0x46,0x02,
+0xf0,0x00,0x00,0x7f,0x0c,0xa1,0xf5,0x6f,0x20,0x07,0xf7,0xec,0x8f,0xaa,0xf2,0x00,
+0x7f,0x14,0x00,0xf1,0x00,0x20,0x07,0xf0,0xca,0x1f,0x56,0xf2,0x03,0xaf,0x4d,0xc6,
+0xf8,0x9f,0x61,0xcf,0x55,0x00,0xfa,0x04,0x51,0x23,0xcc,0x32,0x7f,0x82,0x20,0x18,
+0xef,0x90,0x03,0xcf,0xd4,0x04,0xfa,0x20,0x00,0x00,0x5e,0xf4,0x03,0xe1,0x00,0x03,
+0xd6,0x00,0x02,0xd7,0x00,0x03,0x4e,0xf5,0x34,0xdf,0x63,0x10,0x34,0x00,0x81,0xf6,
+0x00,0x33,0xbe,0x3e,0xb3,0x31,0x00,0xec,0x00,0x81,0x50,0x04,0x44,0xbe,0x4e,0xb7,
+0xf8,0x31,0x1a,0x00,0x10,0xfa,0x1a,0x00,0x41,0xb6,0xf5,0x00,0x3f,0x1a,0x00,0xf2,
+0x06,0x00,0x4e,0xfe,0x0e,0xff,0x60,0x01,0xaf,0xaa,0xe0,0xea,0x7f,0xd5,0x09,0x40,
+0x9e,0x0e,0x90,0x2a,0x10,0x01,0x27,0x00,0xf3,0x03,0x1f,0xbb,0xf8,0xde,0x8f,0xa0,
+0x01,0xf6,0x5f,0x0a,0xc0,0xea,0x00,0x1f,0x65,0xf0,0xac,0x0e,0x0d,0x00,0x81,0x03,
+0x9f,0xbb,0xf9,0xde,0x8f,0xd7,0x5f,0x4f,0x00,0x18,0xc0,0x1a,0x00,0x07,0x27,0x00,
+0x92,0xc7,0xf9,0x00,0x1f,0x64,0xc0,0x89,0xae,0x40,0xa2,0x00,0xf0,0x22,0x01,0x70,
+0x00,0xad,0x0c,0x90,0x00,0x3f,0x80,0x1f,0x90,0x8f,0x10,0x00,0xbf,0x18,0xff,0xff,
+0xff,0xf5,0x04,0xe7,0xff,0x66,0xbf,0x66,0x20,0x01,0xef,0xf6,0x6b,0xf6,0x60,0x00,
+0x2e,0xbf,0xee,0xff,0xee,0x10,0x08,0x47,0xf0,0x09,0xe0,0x00,0x01,0xf9,0x7f,0x0d,
+0x00,0xe0,0x7f,0x47,0xf6,0x6c,0xf6,0x60,0x0e,0xe0,0x7f,0x11,0x9e,0x11,0x05,0xf8,
+0x34,0x01,0xf1,0x14,0xf9,0x04,0x10,0x7f,0x44,0x44,0x44,0x20,0x00,0x00,0x9f,0x10,
+0x00,0x02,0xc4,0x09,0xf1,0x07,0xc0,0x3f,0x50,0x9f,0x10,0x9f,0x13,0xf5,0x09,0xf1,
+0x09,0xf1,0x3f,0xb8,0xdf,0x98,0xdf,0xdd,0x03,0xf0,0x09,0xf1,0x98,0x00,0x9f,0x10,
+0x1a,0x6e,0xd0,0x09,0xf1,0x01,0xf9,0xed,0x00,0x9f,0x10,0x1f,0x9e,0xd3,0x3b,0xf4,
+0x35,0xf9,0xef,0x1c,0x00,0x63,0x94,0x44,0x44,0x44,0x46,0xf9,0x3a,0x01,0xf1,0x32,
+0x09,0xff,0xff,0xff,0xf4,0x00,0x00,0x46,0x66,0x6c,0xfc,0x00,0x00,0x21,0x00,0x09,
+0xfa,0x01,0x30,0x0f,0x86,0x11,0xf9,0x18,0x9f,0x00,0xf8,0xce,0x3f,0x7a,0xd8,0xf0,
+0x0f,0x71,0xa6,0xff,0xe2,0x7f,0x00,0xf7,0x3b,0xff,0xef,0x37,0xf0,0x0f,0xcf,0xc4,
+0xf7,0xaf,0xaf,0x00,0xf8,0x65,0xaf,0x60,0x88,0xf0,0x0f,0x70,0x3b,0x80,0x00,0x7f,
+0x00,0x05,0x01,0x77,0xf0,0x06,0x66,0x66,0x66,0x66,0xbf,0x37,0x03,0xf0,0x0f,0x4e,
+0x40,0x00,0x00,0x0d,0xf2,0x00,0xee,0x00,0x00,0x06,0xf9,0x00,0x05,0xfa,0x00,0x04,
+0xfe,0x10,0x00,0x0a,0xf8,0x04,0xff,0xb7,0x77,0x77,0x8f,0xf5,0x0b,0xd8,0x01,0x60,
+0xca,0x00,0x00,0x08,0xf3,0x01,0x88,0x00,0xb0,0xbf,0x00,0x1f,0x80,0x00,0x00,0x2f,
+0x90,0x02,0xf7,0x00,0x11,0x03,0xe4,0x4f,0x60,0x00,0x8f,0xf5,0x05,0x8c,0xf3,0x00,
+0x0b,0xc3,0x00,0x6f,0xf9,0x53,0x00,0x21,0x01,0xf6,0x07,0x00,0xf3,0x38,0x1f,0x60,
+0x9f,0xff,0xff,0xf5,0x01,0xf6,0x04,0x6d,0xe6,0x9f,0x51,0x5f,0xdd,0xa0,0xcb,0x04,
+0xf5,0x8f,0xfd,0x95,0x0d,0xa0,0x4f,0x42,0x4f,0x60,0x00,0xf9,0x05,0xf4,0x01,0xf6,
+0x00,0x1f,0x70,0x5f,0x30,0x1f,0x77,0x85,0xf4,0x06,0xf2,0x04,0xff,0xf8,0xce,0x00,
+0x8f,0x10,0x8f,0x81,0x5f,0x70,0x0a,0xf0,0x01,0x10,0x6f,0xe1,0x79,0xfc,0x00,0x00,
+0x06,0xd2,0x09,0xfd,0x40,0x55,0x00,0x11,0x1f,0xe8,0x01,0xf0,0x34,0x70,0x7b,0xf8,
+0x77,0x46,0x61,0xf7,0x00,0xae,0x00,0x00,0xcc,0x1f,0x70,0x0f,0xff,0xff,0x4c,0xc1,
+0xf7,0x05,0xfa,0x9b,0xf2,0xcc,0x1f,0x70,0xde,0x00,0x9e,0x0c,0xc1,0xf7,0x2f,0x8b,
+0x2e,0xa0,0xcc,0x1f,0x70,0x34,0xfe,0xf3,0x0c,0xc1,0xf7,0x00,0x05,0xfc,0x00,0xbb,
+0x1f,0x70,0x00,0xbf,0x20,0x00,0x01,0xf7,0x06,0xdf,0x40,0x00,0x06,0x9f,0x70,0x8c,
+0x91,0x01,0x1a,0xc2,0x94,0x02,0xf0,0x3e,0x0c,0x90,0x02,0x22,0x22,0x20,0x00,0x6e,
+0x16,0xff,0xff,0xff,0x14,0xff,0xfe,0x55,0xdd,0x5a,0xf0,0x26,0x6d,0xe0,0x0d,0xb0,
+0x7f,0x00,0x03,0xf7,0x20,0xea,0x07,0xf0,0x01,0xdf,0x9d,0x0f,0x80,0x8f,0x01,0xdf,
+0xff,0x23,0xf5,0x08,0xf0,0x7f,0xef,0xea,0x6f,0x20,0x9e,0x00,0x4a,0xe3,0x4d,0xd0,
+0x0a,0xd0,0x00,0xae,0x05,0xf7,0x00,0xcc,0x00,0x0a,0xe3,0xfd,0x18,0x9f,0x90,0x00,
+0xae,0x0a,0x20,0xbd,0xb1,0xc0,0x03,0xfa,0x36,0x60,0x00,0x8f,0x0e,0xa5,0x6f,0x63,
+0x50,0x8f,0x0e,0x70,0x1f,0x69,0xe0,0x8f,0x0e,0xda,0xbf,0x69,0xe0,0x8f,0x0c,0xff,
+0xdd,0x59,0xe0,0x8f,0x00,0xbd,0x00,0x09,0xe0,0x8f,0x00,0xdf,0xff,0x89,0xe0,0x8f,
+0x00,0xfb,0x7f,0x79,0xe0,0x8f,0x03,0xf4,0x0f,0x68,0xe0,0x8f,0x0a,0xf0,0x1f,0x50,
+0x00,0x8f,0x5f,0x84,0x8f,0x30,0x68,0xde,0x3b,0x0c,0xfa,0x00,0x7f,0xe7,0xa4,0x00,
+0xf0,0x36,0x4a,0xf3,0x00,0x08,0xf0,0x4c,0xff,0xfb,0x41,0x41,0x8f,0x02,0xa7,0xfa,
+0x00,0x4f,0x48,0xf0,0x00,0x0e,0xa0,0x04,0xf4,0x8f,0x05,0xff,0xff,0xff,0x4f,0x48,
+0xf0,0x26,0x9f,0xc6,0x64,0xf4,0x8f,0x00,0x0c,0xff,0x60,0x4f,0x48,0xf0,0x06,0xff,
+0xef,0x84,0xf4,0x8f,0x03,0xf8,0xea,0x86,0x4f,0x48,0xf0,0x6d,0x0e,0xa0,0x00,0x00,
+0x8f,0x00,0x10,0xea,0x00,0x06,0x9d,0x34,0x00,0x00,0x5a,0x00,0x10,0x0f,0x76,0x03,
+0xc3,0x6f,0x0f,0x9e,0xba,0xf6,0x43,0x6f,0x0f,0x6d,0x87,0xe6,0xb9,0x06,0x00,0x60,
+0x1f,0x7e,0x98,0xe7,0xb9,0x6f,0x2b,0x05,0x77,0xc9,0x6f,0x4f,0xae,0xbb,0xfa,0xb9,
+0x1e,0x00,0x11,0xa9,0x06,0x00,0xe1,0x00,0x6f,0x0f,0x6d,0x8a,0xf6,0x17,0xbf,0x0f,
+0x6d,0x8c,0xd2,0x0e,0xe7,0x95,0x01,0xf4,0x3a,0x6f,0x10,0x5b,0xf6,0xb6,0x3a,0x66,
+0xf1,0x00,0xdb,0x1f,0x80,0xd8,0x6f,0x10,0x5f,0x62,0xcf,0x1d,0x86,0xf1,0x0a,0xff,
+0xff,0xf7,0xd8,0x6f,0x10,0x25,0x69,0x04,0x0d,0x86,0xf1,0x04,0x59,0xf6,0x52,0xd8,
+0x6f,0x10,0xcf,0xff,0xff,0x6d,0x86,0xf1,0x00,0x06,0xf1,0x00,0xd8,0x6f,0x10,0x00,
+0x7f,0x8a,0x70,0x06,0xf1,0x1d,0xff,0xff,0xc6,0x16,0xbf,0x00,0xa7,0x42,0x00,0x00,
+0xef,0x90,0xbc,0x06,0xf3,0x3e,0xa6,0xf0,0x00,0x00,0x2d,0x40,0xbe,0x9f,0x54,0x17,
+0xe2,0xf4,0x1f,0xff,0xff,0xf6,0x7f,0x2f,0x44,0xf2,0x7f,0x21,0x07,0xf2,0xf4,0x5f,
+0xef,0xfe,0xed,0x7f,0x2f,0x42,0x77,0xaf,0x87,0x67,0xf2,0xf4,0x08,0x9c,0xf9,0x95,
+0x7f,0x2f,0x40,0xde,0xdf,0xcf,0x97,0xf2,0xf4,0x0d,0x86,0xf0,0xc9,0x25,0x2f,0x40,
+0xd8,0x6f,0x2d,0x90,0x02,0xf4,0x0d,0x86,0xfa,0xf6,0x07,0xaf,0x40,0x10,0x6f,0x10,
+0x00,0xbf,0xb0,0x55,0x00,0xf0,0x42,0x0d,0xff,0xff,0xfc,0x13,0x3f,0x30,0xda,0x55,
+0x5c,0xc6,0xe3,0xf3,0x0d,0x81,0x11,0xbc,0x6e,0x3f,0x30,0xdf,0xff,0xff,0xc6,0xe3,
+0xf3,0x0e,0x94,0x8c,0x43,0x6e,0x3f,0x30,0xe9,0x49,0xe4,0x46,0xe3,0xf3,0x0f,0xcf,
+0xff,0xfc,0x6e,0x3f,0x30,0xfb,0xd6,0xd6,0xc6,0xe3,0xf3,0x3f,0xad,0x6d,0x6c,0x5c,
+0x3f,0x37,0xf7,0xd6,0xea,0xc0,0x03,0xf3,0xbc,0x5b,0x6d,0x95,0x07,0xaf,0x22,0x40,
+0x06,0xd0,0x00,0xaf,0xa0,0x00,0x01,0x00,0x03,0x00,0xd2,0x08,0xf4,0x00,0x09,0xf3,
+0x00,0x34,0x6f,0xc4,0x45,0xfd,0x44,0x09,0x6e,0x07,0xf1,0x0e,0x01,0x11,0x11,0x11,
+0x11,0x53,0x00,0xef,0xff,0xf3,0x9b,0x0f,0x70,0x0e,0xb4,0x7f,0x3a,0xc0,0xf7,0x00,
+0xef,0xee,0xf3,0xac,0x0f,0x70,0x0e,0xa3,0x6f,0x0d,0x00,0x13,0xef,0x0d,0x00,0xf4,
+0x01,0x34,0x50,0xf7,0x00,0xe9,0x27,0xf3,0x05,0x7f,0x60,0x0e,0x95,0xfc,0x00,0x8f,
+0xd2,0x3d,0x03,0xf0,0x56,0x00,0x09,0x50,0x00,0x7f,0x1e,0xd3,0x6f,0x60,0x51,0x7f,
+0x03,0xbf,0xfa,0x00,0xf5,0x7f,0x17,0xee,0xcf,0x70,0xf5,0x7f,0x5f,0x84,0x4b,0x40,
+0xf5,0x7f,0x00,0x09,0xca,0xd1,0xf5,0x7f,0x59,0x9d,0xea,0xc1,0xf5,0x7f,0x6c,0xdf,
+0xfc,0xc1,0xf5,0x7f,0x00,0xbf,0xf7,0x00,0xe5,0x7f,0x2c,0xfc,0xee,0xc0,0x00,0x7f,
+0x8d,0x39,0xc1,0x50,0x28,0xce,0x00,0x09,0xc0,0x00,0x0f,0xe7,0x4f,0xff,0xff,0xfe,
+0x00,0x6f,0x11,0x44,0x44,0x44,0x48,0xb6,0xf1,0x03,0x44,0x44,0x41,0x8b,0x6f,0x10,
+0x9f,0xdd,0xef,0x58,0xb6,0xf1,0x09,0xd3,0x35,0xf5,0x0d,0x00,0xfa,0x1e,0xff,0xff,
+0x58,0xb6,0xf1,0x07,0x77,0x77,0x76,0x8b,0x6f,0x10,0xfb,0xaf,0x8d,0xc8,0xb6,0xf1,
+0x0f,0xdd,0xfc,0xec,0x57,0x6f,0x10,0xf9,0x8f,0x5c,0xc0,0x06,0xf1,0x0f,0x99,0xf6,
+0xcc,0x28,0xcf,0x00,0xfe,0xdd,0xde,0xb1,0xfe,0x80,0x00,0x01,0x00,0xf0,0x3d,0x6f,
+0x30,0x00,0x04,0xf2,0x00,0x6f,0xdf,0x60,0xb8,0x4f,0x22,0xbf,0xaa,0x6f,0x9c,0x94,
+0xf2,0x3f,0x95,0xf6,0x72,0xc9,0x4f,0x20,0x5f,0xcc,0xcf,0x1c,0x94,0xf2,0x05,0xfb,
+0xbc,0xf1,0xc9,0x4f,0x20,0x6f,0x77,0x9f,0x1c,0x94,0xf2,0x07,0xeb,0xbb,0xb0,0xc9,
+0x4f,0x20,0xbe,0xcc,0xcc,0x24,0x34,0xf2,0x1f,0xbe,0x57,0xf2,0x00,0x4f,0x27,0xe6,
+0xfd,0xef,0x20,0x9c,0xf1,0x03,0x6e,0x46,0xf2,0x0c,0xd8,0x50,0x00,0xf0,0x05,0x0b,
 0xd0,0x00,0x07,0xbb,0xbb,0x30,0xbd,0x00,0x00,0x8d,0xff,0xd6,0x3c,0xe3,0x33,0x00,
-0x0e,0x90,0x8f,0xb0,0x06,0x50,0xe9,0x02,0x3d,0xc3,0x9f,0x99,0x11,0xf5,0x1a,0xea,
-0x08,0xf0,0x00,0xe9,0x00,0x1f,0x70,0x9f,0x00,0x0e,0xca,0x66,0xf3,0x09,0xe0,0x8e,
-0xff,0xd5,0xce,0x00,0xbd,0x07,0xb7,0x20,0x7f,0x70,0x0d,0xb0,0x00,0x00,0x9f,0xc1,
-0x78,0xf9,0x00,0x00,0x0a,0xb0,0x0d,0xfd,0xac,0x09,0x12,0xcc,0xda,0x03,0x90,0xc0,
-0x00,0x56,0x66,0x60,0x38,0xee,0x88,0x5d,0xe3,0x20,0xf5,0x2a,0xff,0xf8,0xdb,0x19,
-0xf1,0x00,0xea,0x0f,0x8d,0xb0,0x8f,0x10,0x0f,0x81,0xf7,0xdb,0x08,0xf1,0x01,0xf6,
-0x2f,0x6d,0xb0,0x8f,0x10,0x3f,0x43,0xf5,0xdb,0x08,0xf1,0x07,0xf2,0x4f,0x4d,0xb0,
-0x8f,0x10,0xdd,0x06,0xf2,0xdd,0x8c,0xf1,0x5f,0x89,0xef,0x0d,0xff,0xff,0x14,0xd0,
-0xee,0x60,0xcb,0x07,0xd1,0xda,0x04,0x11,0x12,0x26,0x17,0xfc,0x3c,0xff,0xc5,0x0c,
-0xa0,0x00,0x01,0x0f,0x70,0x00,0xca,0x00,0x07,0xff,0xff,0xfe,0x3d,0xb3,0x31,0x27,
-0x7f,0xb7,0x7f,0xff,0xff,0x42,0xf9,0xfc,0xcc,0x2e,0xa5,0xf4,0x2f,0xdf,0xee,0xc0,
-0xf7,0x3f,0x32,0xf7,0xfb,0xbc,0x1f,0x64,0xf3,0x19,0x9f,0xc9,0x75,0xf3,0x4f,0x23,
-0xdd,0xfe,0xdb,0xbf,0x05,0xf1,0x03,0x3f,0xa5,0x7f,0x80,0x7f,0x06,0xde,0xff,0xff,
-0xf4,0x7d,0xe0,0x47,0x64,0x32,0xc3,0x2f,0x6a,0x12,0x21,0x9e,0x20,0x64,0x09,0x42,
-0xe5,0x55,0x55,0x53,0x58,0x19,0xf0,0x0c,0x80,0x1c,0xf7,0x11,0x11,0x12,0xf7,0x05,
-0xfe,0xff,0xff,0xf0,0x1f,0x70,0x03,0x8f,0x66,0xbf,0x02,0xf6,0x00,0x08,0xf2,0x29,
-0xf0,0x3f,0x50,0x6b,0x24,0xb0,0x5a,0xf3,0x00,0x08,0xf3,0x33,0x3a,0xfc,0x00,0x00,
-0x8f,0xe6,0x02,0xf1,0x02,0x40,0x06,0xf9,0x77,0x77,0x7a,0xf5,0x00,0x0a,0xef,0xff,
-0xff,0xea,0x00,0x00,0x09,0x90,0x6a,0x19,0x61,0xfe,0x66,0x66,0x66,0x61,0x01,0xe7,
-0x1a,0xf1,0x18,0x21,0xdf,0x60,0x03,0x10,0x07,0xf2,0x7f,0xe4,0x62,0xf5,0xa4,0x7f,
-0x20,0x7f,0xaf,0xed,0x0f,0x67,0xf1,0x00,0xf5,0x7f,0xd2,0xf6,0x8f,0x10,0x0f,0x8f,
-0xad,0xaf,0x68,0xf0,0x00,0xf7,0x93,0x44,0xf6,0x9f,0xf6,0x18,0x81,0x6b,0xd0,0x00,
-0x44,0x44,0x44,0xa8,0xfb,0xa2,0x01,0x15,0xfd,0x25,0x20,0x03,0x65,0x0a,0x30,0xbe,
-0x09,0xf1,0xaa,0x00,0xf1,0x0b,0xa0,0x9f,0x10,0x22,0x00,0x0c,0xf2,0x09,0xf1,0x1d,
-0xf2,0x09,0xff,0x00,0x9f,0x1c,0xf9,0x05,0xff,0xf0,0x09,0xfc,0xfb,0x00,0x1d,0xcf,
-0x20,0x25,0x31,0x09,0xf0,0x5e,0x3e,0x1c,0xf1,0x11,0xbf,0xff,0x10,0x03,0x00,0x09,
-0xf5,0x8a,0xf1,0x00,0xf7,0x00,0x9f,0x00,0x9f,0x10,0x2f,0x70,0x09,0xf0,0x07,0xfd,
-0xcd,0xf3,0x00,0x9f,0x00,0x19,0xcc,0xc7,0x00,0xef,0x9b,0x06,0xc3,0xec,0x7b,0xf8,
-0x8f,0xb7,0x70,0xe9,0x08,0xf0,0x1f,0x60,0x00,0x06,0x00,0x20,0x0a,0xd0,0x06,0x00,
-0xf1,0x09,0x0c,0xb0,0x1f,0x61,0x40,0xe9,0x2f,0x70,0x1f,0x72,0xf2,0xea,0xbf,0x10,
-0x0f,0xb9,0xf0,0xea,0xd6,0x00,0x09,0xef,0x90,0xe9,0x44,0x0b,0x11,0xef,0xbf,0x1b,
-0x71,0x67,0x77,0x77,0x77,0x77,0x71,0xef,0xda,0x08,0xf0,0x0e,0xeb,0x55,0x55,0x55,
-0x55,0x30,0xe9,0x04,0xcc,0xcc,0xb0,0x00,0xe9,0x04,0xf5,0x3b,0xd0,0x00,0xe9,0x04,
-0xfb,0xad,0xd0,0x00,0xe9,0x02,0x66,0x66,0x60,0x94,0x16,0xf1,0x07,0x5f,0xff,0x30,
-0xe9,0x9a,0x6f,0x5e,0x2f,0x30,0xe9,0x9d,0xbf,0x5f,0x9f,0x30,0xe9,0x36,0x66,0x26,
-0x66,0x10,0xef,0x6a,0x0b,0x20,0x56,0x66,0x2d,0x01,0x04,0xec,0x00,0xf1,0x08,0x04,
-0xbe,0x18,0xf0,0x00,0x04,0x8d,0xff,0xa2,0x8f,0x00,0x00,0xef,0xdf,0x30,0x08,0xf0,
-0x00,0x01,0x06,0xf2,0x00,0x8f,0x72,0x19,0x43,0x08,0xf0,0x00,0x3f,0xf7,0x1c,0x50,
-0xcf,0x98,0x8c,0xf8,0x85,0x76,0x22,0x00,0x1a,0x00,0x41,0xeb,0x00,0x08,0xf0,0xd3,
-0x0a,0x50,0x8f,0x00,0x01,0xbf,0xa0,0x0d,0x00,0x22,0x0b,0x80,0x9f,0x01,0x02,0x01,
-0x00,0xf0,0x03,0x66,0x01,0xf7,0x02,0x93,0x00,0x0b,0xf1,0x1f,0x70,0x9f,0x30,0x00,
-0x3f,0x81,0xf7,0x1f,0xb0,0xc5,0x32,0x20,0x70,0x62,0x59,0x02,0x00,0xb5,0x03,0xa4,
-0x28,0x88,0x9f,0xc8,0x88,0x80,0x00,0x00,0x01,0xf7,0xc4,0x0b,0x51,0xf9,0x19,0x99,
-0x9a,0xfc,0x42,0x1b,0x21,0x1f,0x70,0x82,0x01,0x12,0xf7,0x13,0x07,0x10,0x70,0x9f,
+0x0e,0x90,0x8f,0xb0,0x06,0xf5,0x23,0xe9,0x02,0x3d,0xc3,0x9f,0x00,0x0e,0x90,0x00,
+0xea,0x08,0xf0,0x00,0xe9,0x00,0x1f,0x70,0x9f,0x00,0x0e,0xca,0x66,0xf3,0x09,0xe0,
+0x8e,0xff,0xd5,0xce,0x00,0xbd,0x07,0xb7,0x20,0x7f,0x70,0x0d,0xb0,0x00,0x00,0x9f,
+0xc1,0x78,0xf9,0x00,0x00,0x0a,0xb0,0x0d,0xfd,0xac,0x09,0x12,0xcc,0xda,0x03,0xf5,
+0x37,0xc0,0x00,0x56,0x66,0x60,0x38,0xee,0x88,0x5d,0xff,0xff,0x15,0xff,0xff,0xf8,
+0xdb,0x19,0xf1,0x00,0xea,0x0f,0x8d,0xb0,0x8f,0x10,0x0f,0x81,0xf7,0xdb,0x08,0xf1,
+0x01,0xf6,0x2f,0x6d,0xb0,0x8f,0x10,0x3f,0x43,0xf5,0xdb,0x08,0xf1,0x07,0xf2,0x4f,
+0x4d,0xb0,0x8f,0x10,0xdd,0x06,0xf2,0xdd,0x8c,0xf1,0x5f,0x89,0xef,0x0d,0xff,0xff,
+0x14,0xd0,0xee,0x60,0xcb,0x07,0xd1,0xda,0x04,0x10,0x12,0xa0,0x02,0xfb,0x3e,0xff,
+0xff,0xc5,0x0c,0xa0,0x00,0x01,0x0f,0x70,0x00,0xca,0x00,0x07,0xff,0xff,0xfe,0x3d,
+0xb3,0x31,0x27,0x7f,0xb7,0x7f,0xff,0xff,0x42,0xf9,0xfc,0xcc,0x2e,0xa5,0xf4,0x2f,
+0xdf,0xee,0xc0,0xf7,0x3f,0x32,0xf7,0xfb,0xbc,0x1f,0x64,0xf3,0x19,0x9f,0xc9,0x75,
+0xf3,0x4f,0x23,0xdd,0xfe,0xdb,0xbf,0x05,0xf1,0x03,0x3f,0xa5,0x7f,0x80,0x7f,0x06,
+0xde,0xff,0xff,0xf4,0x7d,0xe0,0x47,0x64,0x32,0xc3,0x2f,0xe6,0x5a,0x01,0x21,0x9e,
+0x20,0x64,0x09,0x61,0xe5,0x55,0x55,0x53,0x00,0x0c,0xfc,0x07,0xf0,0x1a,0x1c,0xf7,
+0x11,0x11,0x12,0xf7,0x05,0xfe,0xff,0xff,0xf0,0x1f,0x70,0x03,0x8f,0x66,0xbf,0x02,
+0xf6,0x00,0x08,0xf2,0x29,0xf0,0x3f,0x50,0x00,0x8f,0xff,0xff,0x5a,0xf3,0x00,0x08,
+0xf3,0x33,0x3a,0xfc,0x00,0x00,0x8f,0xe6,0x02,0xf1,0x01,0x40,0x06,0xf9,0x77,0x77,
+0x7a,0xf5,0x00,0x0a,0xef,0xff,0xff,0xea,0x00,0x00,0x09,0x54,0x03,0x80,0x04,0xfe,
+0x66,0x66,0x66,0x61,0x01,0xdf,0x4f,0x00,0xf0,0x19,0x21,0xdf,0x60,0x03,0x10,0x07,
+0xf2,0x7f,0xe4,0x62,0xf5,0xa4,0x7f,0x20,0x7f,0xaf,0xed,0x0f,0x67,0xf1,0x00,0xf5,
+0x7f,0xd2,0xf6,0x8f,0x10,0x0f,0x8f,0xad,0xaf,0x68,0xf0,0x00,0xf7,0x93,0x44,0xf6,
+0x9f,0x00,0x09,0x09,0x81,0x6b,0xd0,0x00,0x44,0x44,0x44,0xa8,0xfb,0xa2,0x01,0x25,
+0xfd,0x30,0x05,0x01,0x02,0x07,0x00,0x30,0xbe,0x09,0xf1,0xaa,0x00,0xf0,0x16,0xa0,
+0x9f,0x10,0x22,0x00,0x0c,0xf2,0x09,0xf1,0x1d,0xf2,0x09,0xff,0x00,0x9f,0x1c,0xf9,
+0x05,0xff,0xf0,0x09,0xfc,0xfb,0x00,0x1d,0xcf,0x00,0x9f,0xfa,0x00,0x00,0x09,0xf0,
+0x5e,0xf7,0x00,0x00,0x8e,0x0c,0xf1,0x0f,0x10,0x03,0x00,0x09,0xf5,0x8a,0xf1,0x00,
+0xf7,0x00,0x9f,0x00,0x9f,0x10,0x2f,0x70,0x09,0xf0,0x07,0xfd,0xcd,0xf3,0x00,0x9f,
+0x00,0x19,0xcc,0xc7,0x00,0xef,0x9b,0x06,0xc3,0xec,0x7b,0xf8,0x8f,0xb7,0x70,0xe9,
+0x08,0xf0,0x1f,0x60,0x00,0x06,0x00,0x20,0x0a,0xd0,0x06,0x00,0xf1,0x09,0x0c,0xb0,
+0x1f,0x61,0x40,0xe9,0x2f,0x70,0x1f,0x72,0xf2,0xea,0xbf,0x10,0x0f,0xb9,0xf0,0xea,
+0xd6,0x00,0x09,0xef,0x90,0xe9,0x44,0x0b,0x01,0x3c,0x00,0x81,0xf4,0x67,0x77,0x77,
+0x77,0x77,0x71,0xef,0xda,0x08,0xf1,0x28,0xeb,0x55,0x55,0x55,0x55,0x30,0xe9,0x04,
+0xcc,0xcc,0xb0,0x00,0xe9,0x04,0xf5,0x3b,0xd0,0x00,0xe9,0x04,0xfb,0xad,0xd0,0x00,
+0xe9,0x02,0x66,0x66,0x60,0x00,0xe9,0x9f,0xff,0x5f,0xff,0x30,0xe9,0x9a,0x6f,0x5e,
+0x2f,0x30,0xe9,0x9d,0xbf,0x5f,0x9f,0x30,0xe9,0x36,0x66,0x26,0x66,0x10,0xef,0x6a,
+0x0b,0x20,0x56,0x66,0x2d,0x01,0x04,0xec,0x00,0xf1,0x06,0x04,0xbe,0x18,0xf0,0x00,
+0x04,0x8d,0xff,0xa2,0x8f,0x00,0x00,0xef,0xdf,0x30,0x08,0xf0,0x00,0x01,0x06,0xf2,
+0x6b,0x01,0x42,0x6f,0x20,0x08,0xf0,0x99,0x08,0xb1,0xff,0xa1,0x88,0xcf,0x98,0x8c,
+0xf8,0x85,0x00,0x09,0xf0,0x1a,0x00,0x41,0xeb,0x00,0x08,0xf0,0xd3,0x0a,0x50,0x8f,
+0x00,0x01,0xbf,0xa0,0x0d,0x00,0x22,0x0b,0x80,0x9f,0x01,0x02,0x01,0x00,0xf0,0x09,
+0x66,0x01,0xf7,0x02,0x93,0x00,0x0b,0xf1,0x1f,0x70,0x9f,0x30,0x00,0x3f,0x81,0xf7,
+0x1f,0xb0,0x00,0x00,0x72,0x1f,0x70,0x62,0x59,0x02,0x00,0xb5,0x03,0xa4,0x28,0x88,
+0x9f,0xc8,0x88,0x80,0x00,0x00,0x01,0xf7,0xc4,0x0b,0xc1,0xf9,0x19,0x99,0x9a,0xfc,
+0x99,0x99,0x50,0x00,0x00,0x1f,0x70,0x82,0x01,0x12,0xf7,0x13,0x07,0x10,0x70,0x9f,
 0x0d,0x01,0x6e,0x00,0xf6,0x37,0x2f,0x50,0xde,0xff,0xee,0xe0,0x02,0xf5,0x04,0x6f,
 0x84,0xbd,0x08,0xef,0xe8,0x1c,0xd0,0x0b,0xb0,0x5b,0xfc,0x9f,0xe3,0x5f,0xf6,0x00,
 0x2f,0x50,0xd2,0x00,0xa7,0x00,0x02,0xf5,0x4f,0x63,0x2c,0xa3,0x10,0x2f,0x6f,0xff,
 0xfb,0xff,0xf5,0x02,0xf5,0x4f,0x5e,0x0f,0x5f,0x50,0x2f,0x58,0xb5,0xe4,0xf1,0xf4,
-0x02,0xf7,0xf7,0x9d,0xdb,0x4f,0x30,0x2f,0x7a,0x6f,0x7a,0x1f,0xeb,0x0b,0x22,0x08,
-0xf0,0x4d,0x15,0x20,0x87,0x77,0xfd,0x11,0x00,0x00,0x0a,0x02,0xc2,0x00,0x72,0x17,
-0x77,0x7c,0xf8,0x77,0x77,0x42,0x9e,0x09,0x00,0x72,0x0e,0x02,0x17,0x0d,0x20,0xba,
-0x30,0x7d,0x0f,0x31,0xf9,0xef,0xd6,0x24,0x0d,0x65,0x6d,0x80,0x00,0x00,0x07,0xf2,
-0x31,0x0d,0x12,0x07,0x64,0x1a,0xe0,0x7f,0x66,0x6a,0xc8,0x66,0x62,0x07,0xf0,0x11,
-0xbf,0x41,0x10,0x00,0x8f,0x84,0x0a,0xa0,0x80,0x08,0xf2,0xf8,0x22,0x23,0xf8,0x00,
-0x9f,0x1f,0x0d,0x00,0x90,0x0a,0xe1,0xf8,0x22,0x24,0xf8,0x00,0xbc,0x1f,0xe0,0x12,
-0xf0,0x0f,0x0e,0xa0,0x56,0x1f,0x64,0x60,0x01,0xf7,0x3f,0xa1,0xf6,0x7f,0x50,0x7f,
-0x4f,0xc4,0x6f,0x60,0xaf,0x21,0x70,0x41,0x7f,0xd2,0x00,0x50,0x00,0x00,0x8a,0x13,
-0xca,0x2a,0xf0,0x05,0xdf,0x94,0x7f,0xc1,0x00,0x00,0xde,0xed,0xcc,0xbd,0xb0,0x00,
-0x2e,0x66,0x39,0x2b,0x96,0x40,0x0c,0xfe,0x3f,0x01,0xf6,0x1c,0x10,0x35,0xbf,0xa3,
-0xbf,0xa2,0x61,0x29,0xef,0xaa,0xe5,0x6e,0xfa,0x42,0xd7,0xcd,0x84,0xac,0x16,0xc3,
-0x00,0x05,0x9d,0xf9,0x39,0x40,0x00,0x00,0xca,0x53,0x8e,0xc2,0x00,0x00,0x58,0xbe,
-0xfd,0x60,0x00,0x00,0x07,0xc8,0x51,0x76,0x03,0x10,0xcf,0x3a,0x00,0xf0,0x03,0x40,
-0x07,0xfd,0x99,0x99,0x9c,0xf3,0x00,0x0a,0xf0,0x8a,0x00,0xde,0x00,0x00,0x3f,0x75,
-0xfa,0x1a,0x1d,0xa1,0xce,0x16,0x3c,0xe1,0x00,0x00,0x03,0xfc,0x0a,0xf4,0x93,0x1c,
-0x01,0x7a,0x01,0x20,0x1e,0xff,0x6b,0x11,0xf6,0x03,0x8f,0xfb,0xff,0x93,0x00,0x3b,
-0xff,0xc3,0x02,0xcf,0xfe,0x51,0xea,0x40,0x00,0x00,0x28,0xb0,0x32,0x1c,0x00,0x31,
-0x01,0x40,0x99,0xfd,0x99,0xdf,0xf6,0x0b,0x30,0xc0,0x0d,0xd0,0x1f,0x28,0xf0,0x14,
-0x10,0xfc,0x44,0x10,0x00,0x0f,0xf7,0x3f,0xff,0xfa,0x00,0x03,0xff,0xd1,0x22,0x7f,
-0x40,0x00,0x6f,0xbf,0x70,0x0d,0xe0,0x00,0x0c,0xf2,0xaf,0x47,0xf6,0x00,0x02,0xfc,
-0x01,0xee,0xfb,0xf3,0x24,0xf6,0x01,0x1b,0xff,0xa1,0x00,0x8f,0xb1,0xaf,0xfa,0xcf,
-0xfb,0x31,0xb0,0x0e,0x92,0x00,0x4a,0x94,0x01,0x41,0x12,0x35,0x8b,0xc1,0x5c,0x00,
-0x60,0xc8,0x30,0x00,0xfb,0x54,0x21,0x69,0x00,0x51,0xc7,0x77,0x77,0x77,0x10,0xd8,
-0x09,0xf0,0x1f,0xf5,0x00,0x1f,0x89,0xe1,0x00,0xbf,0x00,0x02,0xf6,0x2f,0x70,0x3f,
-0x90,0x00,0x3f,0x50,0x9f,0x5e,0xe1,0x00,0x06,0xf3,0x00,0xdf,0xf4,0x00,0x00,0xbf,
-0x01,0x8f,0xff,0xa2,0x00,0x2f,0xa9,0xff,0xb3,0x9f,0xfc,0x21,0xa2,0x5a,0x40,0x00,
-0x27,0xd9,0x29,0xf3,0x3c,0xc2,0x22,0x22,0x00,0xaf,0x6b,0xf6,0xff,0xff,0xf6,0x06,
-0xf0,0x8f,0x1d,0xd8,0x9f,0x30,0x6f,0xff,0xf0,0x7e,0x05,0xf1,0x06,0xf6,0xbf,0x04,
-0xf2,0x8e,0x00,0x6f,0x18,0xf0,0x1f,0x6c,0xa0,0x06,0xff,0xff,0x00,0xcc,0xf5,0x00,
-0x6f,0x4a,0xf0,0x06,0xff,0x00,0x07,0xf5,0xbf,0xc0,0x3f,0xc0,0x03,0xff,0xff,0xf8,
-0x1d,0xff,0x70,0x05,0x30,0x8f,0x2d,0xe2,0x9f,0x80,0x00,0x08,0xf2,0xc1,0x00,0x94,
-0xa1,0x00,0x10,0x59,0xe7,0x1d,0x11,0x69,0xb1,0x02,0x10,0x9f,0x9f,0x02,0x5f,0x99,
-0xf0,0x00,0x00,0x01,0x0b,0x00,0x05,0x56,0xaa,0xaa,0xaa,0xaf,0x99,0x2c,0x00,0x18,
-0x90,0x6e,0x1d,0x70,0x10,0x00,0xfb,0x66,0x66,0x6c,0xf1,0xf4,0x17,0x00,0x3d,0x0b,
-0xb2,0xf8,0x00,0x00,0x09,0xf1,0x00,0x0f,0xa4,0x44,0x44,0xbf,0xed,0x00,0xd0,0xf1,
-0x00,0x02,0x22,0x22,0x22,0x22,0x00,0x00,0x04,0xc5,0x02,0xc6,0xe0,0x04,0xfa,0x02,
+0x02,0xf7,0xf7,0x9d,0xdb,0x4f,0x30,0x2f,0x7a,0x6f,0x7a,0x1f,0xeb,0x0b,0x00,0x54,
+0x00,0x00,0xcb,0x0b,0x60,0x87,0x77,0x10,0x00,0x00,0x08,0x00,0x0a,0x02,0xc2,0x00,
+0x72,0x17,0x77,0x7c,0xf8,0x77,0x77,0x42,0x9e,0x09,0x00,0x72,0x0e,0x02,0x17,0x0d,
+0x10,0xba,0x1d,0x02,0x41,0x07,0xf9,0xef,0xd6,0x24,0x0d,0x65,0x6d,0x80,0x00,0x00,
+0x07,0xf2,0x31,0x0d,0x21,0x07,0xff,0xbf,0x09,0xe0,0x7f,0x66,0x6a,0xc8,0x66,0x62,
+0x07,0xf0,0x11,0xbf,0x41,0x10,0x00,0x8f,0x84,0x0a,0xa0,0x80,0x08,0xf2,0xf8,0x22,
+0x23,0xf8,0x00,0x9f,0x1f,0x0d,0x00,0x80,0x0a,0xe1,0xf8,0x22,0x24,0xf8,0x00,0xbc,
+0x0d,0x00,0xf0,0x28,0x70,0x0e,0xa0,0x56,0x1f,0x64,0x60,0x01,0xf7,0x3f,0xa1,0xf6,
+0x7f,0x50,0x7f,0x4f,0xc4,0x6f,0x60,0xaf,0x21,0x70,0x41,0x7f,0xd2,0x00,0x50,0x00,
+0x00,0x8a,0x13,0x70,0x00,0x00,0x06,0xdf,0x94,0x7f,0xc1,0x00,0x00,0xde,0xed,0xcc,
+0xbd,0xb0,0x00,0x2e,0x66,0x39,0x2b,0x96,0x40,0x0c,0xfe,0x3f,0x01,0xf6,0x1c,0x10,
+0x35,0xbf,0xa3,0xbf,0xa2,0x61,0x29,0xef,0xaa,0xe5,0x6e,0xfa,0x42,0xd7,0xcd,0x84,
+0xac,0x16,0xc3,0x00,0x05,0x9d,0xf9,0x39,0x40,0x00,0x00,0xca,0x53,0x8e,0xc2,0x00,
+0x00,0x58,0xbe,0xfd,0x60,0x00,0x00,0x07,0xc8,0x51,0x76,0x03,0x10,0xcf,0x3a,0x00,
+0xf0,0x11,0x40,0x07,0xfd,0x99,0x99,0x9c,0xf3,0x00,0x0a,0xf0,0x8a,0x00,0xde,0x00,
+0x00,0x3f,0x75,0xfa,0x4f,0x70,0x00,0x00,0xce,0x16,0x3c,0xe1,0x00,0x00,0x03,0xfc,
+0x0a,0xf4,0xae,0x0c,0x11,0xfd,0x7a,0x01,0xf4,0x08,0x1e,0xff,0x20,0x00,0x00,0x01,
+0x8f,0xfb,0xff,0x93,0x00,0x3b,0xff,0xc3,0x02,0xcf,0xfe,0x51,0xea,0x40,0x00,0x00,
+0x28,0x6c,0x06,0x21,0x0f,0xff,0x31,0x01,0x40,0x99,0xfd,0x99,0xdf,0xf6,0x0b,0x20,
+0xc0,0x0d,0x2b,0x0d,0xf0,0x31,0xff,0x10,0xfc,0x44,0x10,0x00,0x0f,0xf7,0x3f,0xff,
+0xfa,0x00,0x03,0xff,0xd1,0x22,0x7f,0x40,0x00,0x6f,0xbf,0x70,0x0d,0xe0,0x00,0x0c,
+0xf2,0xaf,0x47,0xf6,0x00,0x02,0xfc,0x01,0xee,0xfb,0x00,0x00,0xcf,0x50,0x1b,0xff,
+0xa1,0x00,0x8f,0xb1,0xaf,0xfa,0xcf,0xfb,0x31,0xb0,0x0e,0x92,0x00,0x4a,0xc0,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0xf2,0x8e,0x00,0x00,0x12,0x35,0x8b,0xc1,0x00,0x0f,
+0xff,0xff,0xff,0xc8,0x30,0x00,0xfb,0x54,0x21,0x00,0x00,0x00,0x0f,0xc7,0x77,0x77,
+0x77,0x10,0x00,0xff,0xff,0xff,0xff,0xf5,0x00,0x1f,0x89,0xe1,0x00,0xbf,0x00,0x02,
+0xf6,0x2f,0x70,0x3f,0x90,0x00,0x3f,0x50,0x9f,0x5e,0xe1,0x00,0x06,0xf3,0x00,0xdf,
+0xf4,0x00,0x00,0xbf,0x01,0x8f,0xff,0xa2,0x00,0x2f,0xa9,0xff,0xb3,0x9f,0xfc,0x21,
+0xa2,0x5a,0x40,0x00,0x27,0x80,0x2f,0xff,0xff,0xc2,0x22,0x22,0x00,0xaf,0x6b,0xf6,
+0xff,0xff,0xf6,0x06,0xf0,0x8f,0x1d,0xd8,0x9f,0x30,0x6f,0xff,0xf0,0x7e,0x05,0xf1,
+0x06,0xf6,0xbf,0x04,0xf2,0x8e,0x00,0x6f,0x18,0xf0,0x1f,0x6c,0xa0,0x06,0xff,0xff,
+0x00,0xcc,0xf5,0x00,0x6f,0x4a,0xf0,0x06,0xff,0x00,0x07,0xf5,0xbf,0xc0,0x3f,0xc0,
+0x03,0xff,0xff,0xf8,0x1d,0xff,0x70,0x05,0x30,0x8f,0x2d,0xe2,0x9f,0x80,0x00,0x08,
+0xf2,0xc1,0x00,0x94,0x00,0x01,0x00,0x60,0x59,0x99,0x99,0x99,0x99,0x69,0x8e,0x00,
+0xbf,0xf9,0x9f,0x00,0x00,0x00,0x1f,0x99,0xf0,0x00,0x00,0x01,0x0b,0x00,0x05,0x56,
+0xaa,0xaa,0xaa,0xaf,0x99,0x2c,0x00,0x13,0x90,0x44,0x00,0x10,0x0f,0x13,0x00,0xf2,
+0x0b,0x10,0x00,0xfb,0x66,0x66,0x6c,0xf1,0x00,0x0f,0x80,0x00,0x00,0x9f,0x10,0x00,
+0xf8,0x00,0x00,0x09,0xf1,0x00,0x0f,0xa4,0x44,0x44,0xbf,0xed,0x00,0xf8,0x14,0xf1,
+0x00,0x02,0x22,0x22,0x22,0x22,0x00,0x00,0x04,0xc5,0x02,0xc6,0x00,0x00,0x04,0xfe,
 0x20,0x0b,0xf8,0x00,0x08,0xfe,0x20,0x00,0x0a,0xf9,0x01,0xcb,0x10,0x00,0x00,0x0a,
-0xb1,0x14,0x1c,0x02,0x45,0x03,0xf0,0x08,0x18,0x88,0x88,0x88,0x8c,0xf8,0x40,0x01,
-0x11,0x11,0x10,0x8f,0x10,0x00,0xef,0xff,0xf9,0x08,0xf1,0x00,0x0e,0xb5,0x5f,0xe5,
-0x0b,0x21,0xe9,0x00,0x0d,0x00,0x35,0xc8,0x8f,0x90,0x1a,0x00,0x23,0x0d,0x80,0xa6,
-0x1f,0x31,0x19,0x9e,0xf0,0x89,0x1d,0x0a,0x90,0x09,0x00,0x12,0x0b,0x11,0x00,0x04,
-0x29,0xf1,0x01,0x19,0x10,0x00,0x01,0xeb,0x00,0x2e,0xd1,0x00,0x3d,0xf5,0x45,0x59,
-0xfd,0x00,0xbf,0x82,0x04,0xb1,0x36,0x43,0x22,0x10,0x08,0x60,0x07,0x88,0x88,0x88,
-0x86,0xd0,0x0d,0x20,0xfb,0x00,0x86,0x09,0x14,0xeb,0x06,0x00,0x02,0x12,0x00,0x45,
-0xc7,0x77,0x77,0xfb,0x50,0x05,0x25,0x02,0xf7,0xf2,0x20,0x12,0x03,0xf4,0x0f,0x91,
-0x28,0x8a,0xfc,0x88,0x88,0x88,0x20,0x00,0x9f,0x7a,0x05,0x21,0x2f,0xd0,0x87,0x05,
-0x01,0x4b,0x03,0x90,0x0a,0xff,0xf7,0x77,0x79,0xf5,0x07,0xfa,0xae,0x11,0x10,0x91,
-0x06,0x0a,0xe0,0x00,0x04,0xf5,0x00,0x00,0xaf,0x24,0x0d,0x56,0x0a,0xf6,0x66,0x68,
-0xe5,0xa5,0x00,0x11,0x1e,0x58,0x01,0x11,0x2d,0x17,0x07,0xb1,0x5e,0xf6,0xef,0x60,
-0x00,0x03,0xcf,0xe3,0x01,0xcf,0xc5,0x6a,0x04,0xe1,0xef,0xf5,0x09,0x45,0x77,0x77,
-0x75,0x16,0x00,0x02,0x44,0x44,0x44,0x43,0xb9,0x2a,0x21,0xff,0xb0,0x95,0x20,0x11,
-0xeb,0xed,0x03,0x41,0x0e,0xb0,0x00,0x08,0xa9,0x00,0x63,0x00,0x8f,0x77,0x77,0x7e,
-0xa0,0x3f,0x0c,0xf0,0x04,0xfb,0x77,0x77,0x77,0x7b,0xf0,0xf8,0x68,0x88,0x88,0x67,
-0xf0,0xf8,0xbe,0xee,0xee,0xb7,0xf0,0xf8,0xfc,0x03,0xb0,0xf0,0xf8,0x2e,0xee,0xee,
-0x27,0xf0,0xf8,0x2f,0x85,0x8f,0x06,0x00,0x20,0x40,0x4f,0x06,0x00,0x20,0xed,0xef,
-0x06,0x00,0xa0,0x96,0x66,0x17,0xf0,0xf8,0x04,0x10,0x03,0x7c,0xf0,0x13,0x20,0x25,
-0xfe,0x70,0xff,0x11,0x01,0x06,0x00,0x20,0xbf,0x50,0xd1,0x10,0x00,0x7b,0x00,0xf0,
-0x06,0x03,0xdf,0x97,0x77,0xbf,0x70,0x2f,0xe5,0x40,0x03,0xfd,0x00,0x05,0x1a,0xf6,
-0x4e,0xe3,0x00,0x00,0x01,0xcf,0x22,0x1e,0xe0,0x28,0xef,0xf9,0x77,0x70,0x5d,0xff,
-0xfe,0xee,0xef,0xf1,0x1a,0x6f,0x90,0xa2,0x00,0x12,0x0e,0x06,0x00,0x01,0x0b,0x02,
-0x50,0x0e,0xc6,0x66,0x6b,0xf1,0x00,0x20,0x20,0x8b,0xd3,0x3e,0x02,0x74,0xfe,0xb8,
-0x50,0x00,0xfb,0x43,0x10,0x1e,0x03,0x12,0x75,0xb7,0x00,0x22,0xb0,0x1f,0x95,0x20,
-0x21,0xf6,0x57,0x52,0x12,0x10,0x5b,0x06,0x11,0x30,0x06,0xf3,0xbd,0x06,0x11,0xfa,
-0x04,0xbe,0x0b,0xd0,0x00,0x0b,0xe0,0x3f,0x90,0xbf,0xff,0xff,0xfe,0x02,0xc1,0x0b,
-0xe7,0x77,0x7d,0xe0,0xe9,0x01,0x20,0x0d,0xf1,0x3a,0x00,0x12,0xfa,0x99,0x0f,0xd0,
-0xff,0xfe,0xed,0x88,0x88,0x88,0x8d,0xee,0x90,0x11,0x11,0x10,0xae,0xe5,0x1b,0xf0,
-0x01,0x0a,0xee,0x91,0xf7,0x49,0xf0,0xae,0xe9,0x1f,0x40,0x6f,0x0a,0xee,0x91,0xff,
-0xff,0x0b,0x00,0xf2,0x00,0x85,0x55,0x0a,0xee,0x90,0x41,0x00,0x78,0xed,0xe9,0x00,
-0x00,0x09,0xfe,0x60,0x70,0x0f,0x50,0x21,0x66,0x66,0xbf,0xe7,0x5a,0x06,0x30,0x9f,
-0xf5,0x63,0xc0,0x04,0xf6,0x02,0xdf,0x6d,0xfb,0x20,0x5f,0xfe,0x55,0xf4,0x06,0xef,
-0x50,0xa5,0x00,0x4f,0x40,0x01,0x70,0xaa,0x0a,0x00,0x82,0x10,0x90,0xdd,0x55,0x55,
-0x5d,0xf0,0x00,0x0d,0xc0,0x00,0x6b,0x30,0x11,0xdf,0xcb,0x0f,0x56,0x0d,0xd6,0x66,
-0x66,0xdf,0x98,0x00,0x11,0x3e,0x32,0x00,0x10,0x5e,0xf1,0x10,0xf1,0x06,0x04,0xbf,
+0xb1,0x00,0x01,0x00,0x21,0x01,0xff,0x68,0x00,0xf1,0x0e,0x18,0x88,0x88,0x88,0x8c,
+0xf8,0x40,0x01,0x11,0x11,0x10,0x8f,0x10,0x00,0xef,0xff,0xf9,0x08,0xf1,0x00,0x0e,
+0xb5,0x5f,0x90,0x8f,0x10,0x00,0xe9,0x00,0x0d,0x00,0x35,0xc8,0x8f,0x90,0x1a,0x00,
+0xc0,0x0d,0x80,0x00,0x00,0x8f,0x10,0x00,0x00,0x00,0x19,0x9e,0xf0,0x45,0x00,0x3a,
+0xdf,0xe7,0x00,0x01,0x00,0x20,0x08,0xf3,0x06,0x00,0xf0,0x03,0x3f,0x90,0x19,0x10,
+0x00,0x01,0xeb,0x00,0x2e,0xd1,0x00,0x3d,0xf5,0x45,0x59,0xfd,0x00,0xbf,0x6c,0x00,
+0xf4,0x09,0xa0,0x36,0x43,0x22,0x10,0x08,0x60,0x07,0x88,0x88,0x88,0x86,0x00,0x0e,
+0xff,0xff,0xff,0xfb,0x00,0x0e,0xa0,0x00,0x00,0xeb,0x06,0x00,0x02,0x12,0x00,0x40,
+0xc7,0x77,0x77,0xfb,0x9f,0x00,0x01,0x4f,0x00,0x21,0x02,0xf7,0x07,0x00,0x51,0x6f,
+0x40,0x00,0x00,0x03,0xb0,0x00,0xb0,0xf3,0x28,0x8a,0xfc,0x88,0x88,0x88,0x20,0x00,
+0x9f,0x30,0x19,0x00,0x20,0x2f,0xd0,0x06,0x00,0x10,0x0b,0x1a,0x00,0xf0,0x08,0x50,
+0x0a,0xff,0xf7,0x77,0x79,0xf5,0x07,0xfa,0xae,0x00,0x00,0x4f,0x50,0x06,0x0a,0xe0,
+0x00,0x04,0xf5,0x00,0x00,0xaf,0x1a,0x00,0x66,0x00,0x0a,0xf6,0x66,0x68,0xe5,0xa5,
+0x00,0x11,0x1e,0x58,0x01,0xf0,0x03,0x2d,0xfd,0x20,0x00,0x00,0x00,0x5e,0xf6,0xef,
+0x60,0x00,0x03,0xcf,0xe3,0x01,0xcf,0xc5,0x05,0x47,0x00,0xf0,0x09,0xef,0xf5,0x09,
+0x45,0x77,0x77,0x75,0x16,0x00,0x02,0x44,0x44,0x44,0x43,0x00,0x00,0x8f,0xff,0xff,
+0xff,0xb0,0x00,0x08,0xf1,0xa2,0x00,0x81,0x00,0x8f,0x00,0x00,0x0e,0xb0,0x00,0x08,
+0xa9,0x00,0x71,0x00,0x8f,0x77,0x77,0x7e,0xa0,0x00,0x96,0x00,0xf0,0x14,0xf0,0xfb,
+0x77,0x77,0x77,0x7b,0xf0,0xf8,0x68,0x88,0x88,0x67,0xf0,0xf8,0xbe,0xee,0xee,0xb7,
+0xf0,0xf8,0x00,0x00,0x00,0x07,0xf0,0xf8,0x2e,0xee,0xee,0x27,0xf0,0xf8,0x2f,0x85,
+0x8f,0x06,0x00,0x20,0x40,0x4f,0x06,0x00,0x20,0xed,0xef,0x06,0x00,0x90,0x96,0x66,
+0x17,0xf0,0xf8,0x04,0x10,0x03,0x7c,0x2a,0x00,0x34,0x01,0xfe,0x70,0x9c,0x00,0x11,
+0x02,0x06,0x00,0x60,0xbf,0x50,0x00,0x00,0x00,0x0a,0x7b,0x00,0xf0,0x19,0x03,0xdf,
+0x97,0x77,0xbf,0x70,0x2f,0xe5,0x40,0x03,0xfd,0x00,0x05,0x1a,0xf6,0x4e,0xe3,0x00,
+0x00,0x01,0xcf,0xfe,0x20,0x00,0x00,0x28,0xef,0xf9,0x77,0x70,0x5d,0xff,0xfe,0xee,
+0xef,0xf1,0x1a,0x6f,0x90,0x00,0xaa,0x01,0x02,0x06,0x00,0x01,0x0b,0x02,0xb0,0x0e,
+0xc6,0x66,0x6b,0xf1,0x00,0x00,0x13,0x46,0x8b,0xd3,0x3e,0x02,0x74,0xfe,0xb8,0x50,
+0x00,0xfb,0x43,0x10,0x1e,0x03,0x12,0x75,0xb7,0x00,0x31,0xb0,0x1f,0x80,0x73,0x00,
+0xfa,0x17,0xf6,0x57,0x77,0x77,0x76,0x00,0x3f,0x5b,0xff,0xff,0xff,0xe0,0x06,0xf3,
+0xbd,0x00,0x00,0xbe,0x00,0xbe,0x0b,0xd0,0x00,0x0b,0xe0,0x3f,0x90,0xbf,0xff,0xff,
+0xfe,0x02,0xc1,0x0b,0xe7,0x77,0x7d,0xe0,0xe9,0x01,0x20,0x0d,0xf1,0x3a,0x00,0x21,
+0xfa,0x00,0x70,0x00,0xf0,0x12,0xff,0xfe,0xed,0x88,0x88,0x88,0x8d,0xee,0x90,0x11,
+0x11,0x10,0xae,0xe9,0x1f,0xff,0xff,0x0a,0xee,0x91,0xf7,0x49,0xf0,0xae,0xe9,0x1f,
+0x40,0x6f,0x0a,0xee,0x91,0xff,0xff,0x0b,0x00,0xf1,0x01,0x85,0x55,0x0a,0xee,0x90,
+0x41,0x00,0x78,0xed,0xe9,0x00,0x00,0x09,0xfe,0x60,0x2f,0x83,0x00,0xf4,0x12,0x21,
+0x66,0x66,0xbf,0xe7,0x66,0x61,0x00,0x00,0x9f,0xf5,0x63,0x00,0x00,0x06,0xdf,0xdf,
+0x6d,0xfb,0x20,0x5f,0xfe,0x55,0xf4,0x06,0xef,0x50,0xa5,0x00,0x4f,0x40,0x01,0x70,
+0x6f,0x00,0x00,0x2d,0x00,0xf6,0x0b,0x00,0x00,0xdd,0x55,0x55,0x5d,0xf0,0x00,0x0d,
+0xc0,0x00,0x00,0xbf,0x00,0x00,0xdf,0xee,0xee,0xef,0xf0,0x00,0x0d,0xd6,0x66,0x66,
+0xdf,0x98,0x00,0x11,0x3e,0x32,0x00,0xf1,0x0b,0x5e,0xfe,0x30,0x00,0x00,0x04,0xbf,
 0xc3,0xaf,0x92,0x00,0x4d,0xff,0x87,0xe3,0x6f,0xfd,0x52,0xea,0x31,0x2d,0xa1,0x27,
-0xd3,0x00,0x8f,0x10,0x02,0xe1,0x02,0x33,0x33,0x6f,0xb0,0x00,0x00,0x55,0x55,0x5d,
-0xf7,0x50,0x00,0x0e,0x60,0x06,0x21,0x00,0xea,0x54,0x1f,0xb6,0x0e,0xfe,0xee,0xee,
-0xfe,0x00,0x00,0xec,0x66,0x66,0x6d,0xf1,0x00,0x30,0x04,0xe4,0x00,0x21,0x20,0x41,
-0xfc,0x33,0x32,0x00,0x34,0x03,0xf0,0x0b,0x00,0xfa,0x22,0x22,0x22,0xf9,0x00,0xfd,
-0x99,0x99,0x99,0xf9,0x00,0xfe,0xdd,0xdd,0xdd,0xd8,0x01,0xf8,0x33,0x33,0x33,0x32,
-0x03,0xf8,0x4b,0x00,0xe0,0x05,0xf6,0xf7,0x33,0x33,0xce,0x0a,0xf3,0xf5,0x00,0x00,
-0xae,0x2f,0xa2,0x12,0x00,0x63,0x2d,0x22,0xf9,0x66,0x66,0xce,0x4d,0x00,0x30,0x4d,
-0x30,0xfa,0x83,0x09,0x61,0xf6,0x5f,0xc5,0x55,0x20,0x05,0xea,0x0f,0xd4,0x01,0xfd,
-0x11,0x1f,0xa1,0x11,0x00,0x1a,0x96,0x66,0xfc,0x66,0x66,0xdb,0x12,0x00,0x33,0x0b,
-0x00,0x76,0x32,0x01,0xf7,0x00,0x50,0xbe,0x55,0x55,0x5c,0xf0,0x10,0x0a,0x00,0x57,
-0x24,0x11,0xbf,0xb5,0x10,0x54,0x0b,0xe7,0x77,0x77,0xcf,0xcb,0x03,0x20,0x47,0xcd,
-0x75,0x03,0xf3,0x4a,0xff,0xc6,0x8f,0xff,0xfe,0x03,0x2f,0x70,0x7f,0x88,0xde,0x02,
-0x3f,0x92,0x8f,0x10,0xae,0x6f,0xff,0xff,0xdf,0x10,0xae,0x14,0xbf,0xb4,0x8f,0x10,
-0xae,0x01,0xff,0xf5,0x7f,0x10,0xae,0x08,0xef,0xdf,0xaf,0x10,0xae,0x3f,0x7f,0x7a,
-0x8f,0x10,0xae,0x7d,0x1f,0x70,0x7f,0xff,0xfe,0x02,0x1f,0x70,0x7f,0x87,0xde,0x00,
-0x1f,0x70,0x25,0x00,0x23,0xef,0xff,0xf1,0xff,0xff,0xf0,0xea,0x28,0xf1,0xf7,0x29,
-0xf0,0xee,0xde,0xf1,0xfe,0xde,0xf0,0xeb,0x39,0xf1,0xf8,0x3a,0xf0,0x18,0x00,0xf0,
-0x00,0x22,0x20,0x22,0x29,0xf0,0xe9,0x0f,0xff,0xfe,0x08,0xf0,0xe9,0x0f,0x94,0xaf,
-0x06,0x00,0x30,0x50,0x7f,0x08,0x12,0x00,0xd6,0xff,0x08,0xf0,0xe9,0x0d,0x84,0x4a,
-0x8d,0xf0,0xe9,0x00,0x00,0x06,0xcc,0x02,0xa0,0xc6,0x00,0x0a,0xa0,0x00,0x04,0x6d,
-0xc6,0x20,0xe9,0x4d,0x06,0xf3,0x30,0xf6,0x2f,0xc8,0x83,0x0c,0x90,0x0e,0x66,0xfe,
-0xff,0x50,0xcc,0x66,0xf7,0xdf,0x0c,0xa0,0x0d,0xff,0xff,0xbf,0xf4,0xf7,0x00,0xe9,
-0x11,0x11,0x5d,0xbf,0x40,0x0e,0xef,0xff,0xa0,0x7f,0xe0,0x01,0xfc,0xe2,0xba,0x03,
-0xfa,0x00,0x5f,0x9e,0x0b,0xa0,0xaf,0xe1,0x09,0xd6,0xff,0xfb,0xaf,0x8d,0xd2,0x25,
-0x6e,0x3a,0x9e,0x70,0x2d,0x20,0x8b,0x01,0xc3,0xfe,0xef,0x5d,0xfe,0xfc,0x00,0x4f,
-0x01,0xf5,0xd7,0x0a,0xc0,0x0d,0x00,0x10,0x05,0x9d,0x08,0xf3,0x12,0x20,0x00,0xdf,
-0xee,0xff,0xef,0xf5,0x00,0x0d,0xc4,0x6f,0x94,0x7f,0x50,0x00,0xde,0xcd,0xfe,0xcd,
-0xf5,0x00,0x0d,0xd9,0xaf,0xc9,0xaf,0x50,0x00,0x67,0x78,0xfb,0x77,0x72,0x7a,0x25,
-0x80,0x05,0x55,0x57,0xfa,0x55,0x55,0x20,0x00,0xd2,0x34,0x03,0xa6,0x23,0xf0,0x0b,
-0x02,0xff,0xf6,0xcc,0x5f,0xa5,0x50,0x2f,0x9f,0x7c,0xd8,0xfc,0x85,0x02,0xf3,0xe7,
-0xcf,0xdf,0xed,0x90,0x2f,0x3e,0x7c,0xb3,0xf9,0x32,0x0d,0x00,0x00,0x47,0x32,0xf0,
-0x13,0x3e,0x7c,0xc6,0xfb,0x66,0x22,0xff,0xf7,0x9b,0xbb,0xcb,0xf5,0x2f,0x97,0x78,
-0x76,0x9b,0x4f,0x41,0x81,0x08,0xbb,0x6f,0x69,0xf3,0x00,0x00,0xe6,0x97,0x65,0x9f,
-0x10,0x00,0x06,0x7c,0x25,0xf3,0x3f,0x05,0xff,0xff,0x1d,0xff,0xfb,0x00,0x5f,0x59,
-0xf1,0xdb,0x4d,0xb0,0x05,0xf0,0x6f,0x1d,0x90,0xbb,0x00,0x5f,0xff,0xf1,0xdf,0xff,
-0xb0,0x01,0x44,0x4d,0xb3,0xce,0x63,0x01,0x66,0x68,0xfc,0x69,0xfc,0x64,0x2e,0xef,
-0xff,0xee,0xff,0xee,0x80,0x3a,0xf8,0x00,0x07,0xfb,0x51,0x2f,0xff,0xff,0x3d,0xff,
-0xff,0x90,0x3f,0x98,0xf3,0xeb,0x5f,0xa0,0x00,0xf9,0x8f,0x3e,0xa5,0xf8,0x00,0x0f,
-0xff,0xe3,0xef,0xfe,0x80,0x75,0x13,0x00,0x65,0x02,0x41,0x9d,0xf0,0x0f,0x80,0x12,
-0x1b,0xf1,0x08,0xf8,0x16,0x66,0x66,0x09,0xf0,0x0f,0x82,0xff,0xff,0xf1,0x9f,0x00,
-0xf8,0x2f,0x40,0x7f,0x19,0xf0,0x0f,0x82,0xf4,0x07,0x0d,0x00,0xc0,0xff,0xff,0x19,
-0xf0,0x0f,0x81,0x66,0x66,0x60,0x9f,0x00,0xf9,0x3d,0x04,0x12,0xf0,0x41,0x00,0x00,
-0x35,0x06,0x23,0x66,0x6c,0x0d,0x00,0xf0,0x06,0x10,0xfa,0x66,0x66,0x66,0x6a,0xf1,
-0x0f,0x60,0x02,0xb3,0x00,0x6f,0x10,0xf6,0x00,0x3f,0x40,0x06,0xf1,0x0f,0x95,0x17,
-0xc0,0x6f,0x10,0xf6,0x66,0xbf,0x66,0x66,0xf1,0x0f,0x60,0x0d,0xfa,0x1a,0x00,0xf3,
-0x10,0x06,0xf8,0xec,0x16,0xf1,0x0f,0x6a,0xfa,0x02,0xec,0x7f,0x10,0xf6,0x66,0x00,
-0x02,0x46,0xf1,0x0f,0xfe,0xee,0xee,0xee,0xff,0x10,0xf9,0x55,0x55,0x55,0x59,0xf1,
-0xf5,0x04,0x01,0x5a,0x00,0xf0,0x13,0xf8,0x00,0x29,0x20,0x09,0xf0,0xf8,0x34,0x7f,
-0x64,0x49,0xf0,0xf8,0xdf,0xff,0xff,0xd9,0xf0,0xf8,0x01,0x5f,0x41,0x09,0xf0,0xf8,
-0x4f,0xff,0xff,0x59,0xf0,0xf8,0x4f,0x10,0x1f,0x06,0x00,0xa2,0xed,0xef,0x59,0xf0,
-0xf8,0x03,0x33,0x33,0x19,0xf0,0x3c,0x00,0x54,0xfc,0x77,0x77,0x77,0x7c,0xa3,0x00,
-0xf0,0x2c,0xfa,0x66,0xd7,0x66,0x6b,0xf0,0x0f,0x60,0x9f,0x62,0x20,0x7f,0x00,0xf7,
-0x8f,0xff,0xff,0xc8,0xf0,0x0f,0xaf,0xdd,0x5c,0xd2,0x7f,0x00,0xf6,0x37,0xff,0xf7,
-0x28,0xf0,0x0f,0xdf,0xee,0x67,0xcf,0xcf,0x00,0xf7,0x31,0x9e,0xd3,0x17,0xf0,0x0f,
-0x63,0xec,0x9a,0x20,0x7f,0x00,0xf6,0x02,0x58,0xcf,0x27,0xf0,0x0f,0xaf,0x03,0x22,
-0xff,0x00,0x7f,0x05,0x05,0x4e,0x00,0xc0,0x66,0x6a,0x8b,0xf0,0x0f,0x60,0x00,0x9a,
-0x9b,0x7f,0x00,0xf8,0xb0,0x03,0xf7,0x18,0xf0,0x0f,0x66,0x77,0x8d,0x56,0x8f,0x00,
-0xf6,0xc9,0xf7,0xec,0x77,0xf0,0x0f,0x6c,0xcf,0x4f,0xe0,0x7f,0x00,0xf6,0x36,0x84,
-0xf9,0x79,0xf0,0x0f,0x9f,0xdd,0xfe,0xef,0xaf,0x00,0xf6,0x00,0x29,0x07,0x77,0x41,
-0x00,0x26,0x66,0x6b,0x0d,0x00,0xf0,0x03,0xd9,0x66,0x6a,0xf0,0x0f,0x63,0xaf,0xca,
-0xa0,0x7f,0x00,0xf6,0x58,0xf6,0xaf,0x57,0xf0,0x0f,0x39,0x24,0xf0,0x12,0x7f,0x00,
-0xf6,0x5f,0xaa,0xbf,0x47,0xf0,0x0f,0x64,0xda,0xcb,0xd3,0x7f,0x00,0xf6,0xcc,0xcf,
-0xdc,0xb7,0xf0,0x0f,0x68,0xc4,0xf9,0x44,0x7f,0x00,0xf6,0x67,0x7f,0xb7,0x77,0x9c,
-0x00,0x5b,0xff,0xee,0xff,0x00,0xfa,0x9c,0x00,0x01,0xea,0x00,0xf0,0x01,0xde,0xde,
-0xf0,0x7f,0x00,0xf6,0x0d,0xc9,0xcf,0x07,0xf0,0x0f,0x62,0x88,0x88,0x83,0x4e,0x00,
-0x91,0x77,0x7e,0x77,0xf0,0x0f,0x65,0xfa,0xaa,0xf7,0x5b,0x00,0xff,0x00,0xaf,0x77,
-0xf0,0x0f,0x64,0xef,0xbe,0xd5,0x7f,0x00,0xf6,0x9b,0x40,0x4c,0x78,0x9c,0x00,0x01,
-0xf0,0x33,0x10,0xf8,0x58,0x88,0x88,0x59,0xf1,0x0f,0x64,0xfa,0xaa,0xf4,0x6f,0x10,
-0xf6,0x4f,0xcc,0xcf,0x46,0xf1,0x0f,0x77,0x78,0xf8,0x77,0x8f,0x10,0xf7,0x88,0x9f,
-0x88,0x88,0xf1,0x0f,0x6b,0xed,0xdd,0xeb,0x6f,0x10,0xf6,0xb7,0xb8,0xb7,0xb6,0xf1,
-0x0f,0x6b,0x79,0xaa,0x7b,0x6f,0x10,0xf6,0xbe,0xdd,0xde,0xb6,0xf1,0x0f,0xa7,0x88,
-0x88,0x87,0xaf,0x10,0xbc,0x04,0x26,0xde,0xf1,0x7a,0x18,0x00,0x8a,0x14,0x62,0x33,
-0x9f,0x63,0x33,0x33,0x11,0x2d,0x03,0xc0,0x04,0x4a,0xf7,0x44,0x44,0x44,0x10,0x02,
-0xfc,0x00,0x3f,0x50,0xd7,0x15,0xf1,0x04,0x03,0xf5,0x00,0x01,0xdf,0xf0,0xdf,0xff,
-0xff,0xe0,0x3f,0xef,0x05,0x68,0xf9,0x65,0x00,0x49,0xf0,0x1a,0x00,0xe0,0x9f,0x00,
-0x03,0xf5,0x00,0x00,0x09,0xf2,0x66,0x8f,0xa6,0x63,0x00,0x9f,0x58,0x14,0x01,0x5d,
-0x03,0x20,0x21,0x00,0xd1,0x35,0x80,0x0e,0x80,0x00,0x00,0xd9,0x03,0xa0,0xe8,0x0d,
-0x00,0xf1,0x29,0x5f,0x0e,0x96,0xb2,0x5f,0xff,0xe5,0xf3,0xff,0xff,0x32,0x7e,0xc6,
-0x8f,0xff,0xb6,0xf3,0x00,0xd9,0x6f,0xf6,0xe8,0x3f,0x30,0x0d,0x91,0x8f,0x0e,0x84,
-0xf3,0x00,0xde,0xe6,0xf0,0xea,0xef,0x14,0xdf,0xf8,0x6f,0x0e,0x85,0x30,0x3f,0x91,
-0x05,0xf0,0x00,0x09,0xb0,0x20,0x00,0x4f,0x86,0x67,0xea,0x06,0x2d,0x02,0xc7,0x0e,
-0x20,0x11,0x00,0x0b,0x38,0x20,0x0a,0xe0,0x1a,0x38,0x20,0x00,0xae,0x0d,0x00,0xf0,
-0x0c,0x01,0x0a,0xe0,0x00,0x7f,0xff,0xf8,0xf0,0xae,0x00,0x05,0x9f,0xc9,0x8f,0x0a,
-0xf8,0x83,0x00,0xe7,0x08,0xf0,0xaf,0xff,0x60,0x0e,0x70,0x8f,0x27,0x00,0x20,0xfc,
-0xc9,0x1a,0x00,0xb0,0xdf,0xe8,0x9f,0x0a,0xe0,0x00,0x4b,0x50,0x08,0xf0,0xae,0x7f,
-0x0a,0x02,0xaa,0x0b,0x10,0x78,0xb6,0x1b,0x04,0x4b,0x13,0x40,0x50,0x01,0xf6,0x00,
-0xe4,0x23,0xf1,0x2f,0x8f,0x41,0x11,0x00,0x1f,0x60,0x3f,0xff,0xff,0xf3,0x7f,0xff,
-0xdd,0xe5,0x55,0x8f,0x23,0x8f,0xa7,0xf5,0x40,0x04,0xf2,0x01,0xf5,0x01,0x6f,0x70,
-0x4f,0x10,0x1f,0x50,0x00,0x6e,0x26,0xf1,0x01,0xfb,0xe2,0x01,0x9f,0xcf,0x02,0x9f,
-0xf7,0x28,0xfe,0x67,0xf0,0x6f,0x91,0x09,0xf8,0x00,0x9d,0x01,0x20,0x00,0x11,0x26,
-0x7e,0xa0,0x5a,0x09,0x16,0xd3,0xb8,0x09,0xf1,0x21,0xe4,0xf2,0xe8,0x00,0x5f,0xaa,
-0xf5,0x4f,0x2e,0x80,0x26,0xfa,0xaf,0x65,0xf2,0xe8,0x06,0xdf,0xee,0xfd,0x6f,0x2e,
-0x80,0x06,0xf1,0x7f,0x01,0x60,0xe8,0x02,0xec,0x07,0xf0,0x03,0x6f,0x80,0x7f,0x30,
-0x7f,0x00,0x5f,0xf6,0x00,0x32,0x23,0xaf,0x33,0x75,0x80,0x17,0xf0,0x02,0xff,0xd0,
-0x00,0x13,0x33,0x9f,0x43,0x33,0x00,0x47,0x77,0x7b,0xf8,0x77,0x77,0x08,0xee,0x01,
-0x00,0x14,0xe1,0x1d,0x18,0xf0,0x02,0xf0,0x00,0x7f,0x00,0x00,0x2e,0xff,0xfb,0x07,
-0xf0,0x00,0x00,0x49,0xf4,0x37,0xdf,0xaa,0x8a,0x38,0xf2,0x28,0x9d,0xfb,0xf4,0x03,
-0xd9,0x5d,0x80,0x8e,0x2f,0x40,0x08,0xa1,0xf3,0x9c,0xd2,0xf4,0x03,0xff,0xff,0xdb,
-0xfd,0x2f,0x40,0x15,0x9f,0x64,0x0e,0xf9,0xf4,0x03,0x59,0xf6,0x54,0xff,0xef,0x40,
-0x9f,0xff,0xff,0xcf,0x23,0xf9,0x40,0x05,0xf1,0x4f,0x90,0x0d,0xd9,0x00,0x5f,0x16,
-0xc0,0x00,0x8f,0xfe,0x00,0x10,0x30,0x83,0x17,0x13,0xae,0x13,0x0a,0x70,0xb0,0x04,
-0x7f,0x96,0x66,0xcf,0x43,0x89,0x00,0x00,0xf9,0x33,0x40,0x4f,0xa8,0x88,0xde,0x98,
-0x28,0x00,0x02,0x08,0x11,0xbf,0x21,0x00,0xf2,0x0b,0x53,0x5b,0xf8,0x67,0x5b,0xf8,
-0x41,0x19,0xfe,0x5b,0xf5,0x6f,0xf7,0x09,0xf7,0xbd,0xff,0xed,0x7a,0xf2,0x05,0x55,
-0x5a,0xf5,0x55,0x52,0x19,0x27,0xfa,0x40,0x40,0x26,0xaf,0x64,0x8f,0xff,0xfe,0x05,
-0xff,0xff,0xc8,0xe5,0x5b,0xe0,0x00,0x6f,0x00,0x8d,0x01,0x9e,0x09,0xef,0xfe,0xea,
-0xd2,0xff,0xa0,0x4d,0x96,0xea,0x9e,0x36,0x52,0x00,0xa9,0x2f,0x28,0xff,0xff,0xf2,
-0x5f,0xff,0xfc,0x8f,0xf4,0x9e,0x02,0x5a,0xf5,0x48,0xec,0x9d,0xa0,0x35,0xaf,0x55,
-0x9d,0x5f,0xf4,0x0a,0xff,0xff,0xfa,0xd0,0xff,0x10,0x00,0x6f,0x00,0x8e,0xbf,0xfe,
-0x30,0x06,0xf0,0x08,0xfd,0x32,0xb2,0xd6,0x23,0x21,0x0e,0x80,0x6d,0x15,0xf0,0x14,
-0xe8,0x0b,0xef,0xff,0xee,0x30,0x0e,0x80,0xbb,0x4f,0x96,0xf4,0x2d,0xff,0xab,0xb5,
-0xf9,0x7f,0x42,0xcf,0xe8,0xbe,0xdf,0xdd,0xf4,0x00,0xe8,0x0b,0xb6,0xf6,0x6f,0x40,
-0x0e,0x80,0xbf,0x18,0x16,0xfa,0x11,0xe8,0x10,0x0b,0xf8,0x83,0x00,0x2e,0xfe,0x03,
-0xff,0xae,0xa5,0x4f,0xfb,0x50,0xcd,0xce,0xfd,0xa0,0x71,0x02,0xcf,0x3b,0xb3,0x7a,
-0x00,0x00,0x3d,0x30,0x7f,0xff,0x70,0xd3,0x08,0x80,0x60,0x00,0x0f,0xa0,0x00,0x00,
-0xf7,0x0c,0x4b,0x1c,0xf0,0x10,0x0f,0x70,0x35,0x7f,0x75,0x52,0x4f,0xff,0xc3,0xfe,
-0xdd,0xee,0x02,0x7f,0xb5,0x3f,0xa9,0x9c,0xe0,0x00,0xf7,0x03,0xf7,0x66,0xae,0x00,
-0x0f,0x70,0x3f,0xcc,0xce,0x0d,0x00,0xd0,0xfc,0xbb,0xde,0x00,0x2f,0xed,0x7f,0x87,
-0x7b,0xf5,0x4f,0xfc,0x9f,0x2d,0x01,0xd1,0x82,0x00,0x5d,0xf3,0x7f,0x91,0x00,0x00,
-0x6f,0xb3,0x00,0x6e,0x90,0xae,0x00,0x13,0x10,0x2b,0x20,0xf0,0x21,0x0f,0x70,0x0e,
-0x80,0x3f,0x60,0x00,0xf7,0x03,0xbc,0x3b,0xf4,0x00,0x0f,0x70,0xfd,0xdf,0xdd,0xf3,
-0x2f,0xff,0x9f,0xa6,0xf5,0xaf,0x31,0x7f,0xb4,0xf6,0xcf,0xc5,0xf3,0x00,0xf7,0x0f,
-0xcb,0xfc,0xbf,0x30,0x0f,0x70,0x67,0x77,0x77,0x61,0x00,0xf7,0x25,0x9e,0x02,0xf0,
-0x04,0x5f,0xfb,0x5f,0x65,0x5d,0xa0,0x2f,0xd7,0x15,0xfa,0x99,0xea,0x00,0x30,0x00,
-0x5f,0xdd,0xdf,0xa0,0xb5,0x2b,0x22,0x44,0xda,0x73,0x09,0xf3,0x35,0xff,0x30,0xe8,
-0x88,0x88,0x12,0x94,0x30,0x0e,0x7e,0x99,0xf0,0x0f,0x9b,0x00,0xe7,0xeb,0xbf,0x36,
-0xf7,0xc0,0x0e,0x8b,0xbb,0xb7,0xaf,0xc9,0x00,0xe9,0xfb,0xbf,0x36,0xfd,0x00,0x0f,
-0x9f,0x99,0xf6,0xe7,0xea,0x00,0xf8,0xf0,0xae,0xdc,0x05,0xf1,0x1f,0x40,0x00,0x39,
-0x10,0x01,0x05,0xf2,0xde,0xef,0xfe,0xee,0x70,0x8f,0x14,0x44,0x9f,0x64,0x43,0x06,
-0xab,0xe3,0x2b,0x09,0xac,0x29,0x11,0xb0,0xe1,0x0b,0x20,0xfb,0x12,0xf3,0x0a,0xf0,
-0x1a,0x4f,0xff,0xfc,0x8f,0x10,0x00,0x09,0xf5,0x5f,0xa8,0xf1,0x00,0x02,0xf9,0x03,
-0xf7,0x8f,0xe5,0x00,0xaf,0x95,0x8f,0x38,0xfd,0xf4,0x00,0x4a,0xff,0xd0,0x8f,0x2d,
-0xf3,0x00,0x0a,0xf6,0x08,0xf1,0x28,0x00,0x03,0xfe,0x34,0x00,0x90,0x04,0xef,0x30,
-0x08,0xf1,0x00,0x07,0xff,0x50,0x0d,0x00,0x23,0x1a,0x20,0xc9,0x2b,0x03,0xa2,0x08,
-0x20,0xdc,0x10,0x24,0x12,0x10,0xef,0x7d,0x09,0xb0,0x4d,0xfa,0x66,0x8f,0xd1,0x00,
-0x03,0xc5,0xd7,0x5f,0xe2,0xdb,0x31,0xe0,0xff,0xd5,0x00,0x00,0x0a,0xef,0xfb,0x7e,
-0xf4,0x21,0x00,0x9a,0x62,0x7f,0x24,0x0e,0xb0,0x17,0xef,0x83,0x38,0xf9,0x00,0x03,
-0xf9,0x7d,0x57,0xfd,0x91,0x04,0xe4,0xef,0xf9,0x00,0x01,0x68,0xae,0xff,0xc4,0x00,
-0x00,0x0e,0xfd,0xa6,0x10,0x2d,0x29,0x00,0x1a,0x00,0x02,0x52,0x17,0x01,0x65,0x32,
-0x01,0xed,0x0b,0x71,0x00,0x88,0x88,0xbf,0xb8,0x88,0x83,0x1f,0x1a,0x00,0x82,0x04,
-0x12,0xcf,0x4b,0x2c,0x20,0xef,0x70,0x28,0x18,0x90,0xf4,0xdf,0x10,0x00,0x00,0x04,
-0xfc,0x05,0xfc,0xac,0x12,0xd4,0x20,0x09,0xfc,0x10,0x1b,0xfe,0x30,0x00,0x0a,0xff,
-0x50,0xaa,0x10,0x38,0x2f,0x06,0x01,0x00,0x11,0xaf,0xaf,0x0c,0x10,0x05,0xa5,0x2d,
-0x12,0x85,0xd9,0x13,0x00,0xce,0x0b,0x17,0xf3,0x71,0x2d,0x20,0x8f,0xfe,0x71,0x2d,
-0x31,0x03,0xff,0xf2,0x06,0x0d,0x20,0x3d,0xd1,0xec,0x30,0xf4,0x03,0x70,0x3f,0xd3,
-0x00,0x19,0xff,0x80,0x00,0x6f,0xfa,0x32,0xfc,0x30,0x00,0x00,0x3b,0xf3,0x01,0x19,
-0x12,0x28,0x03,0xf7,0xaa,0x00,0x00,0xb7,0x00,0x62,0xaa,0xaa,0xcf,0xca,0xaa,0xa5,
-0xaa,0x00,0x00,0x79,0x2d,0x11,0xf3,0x2f,0x04,0x20,0xdf,0x90,0x43,0x0d,0x30,0xf5,
-0xaf,0x30,0xd1,0x2b,0x20,0x02,0xfd,0xf5,0x0c,0xf4,0x02,0xf8,0x07,0xfc,0x10,0x19,
-0xff,0x5a,0xf8,0x09,0xfe,0x51,0xec,0x30,0x0c,0xa0,0x07,0xf5,0x55,0x00,0x30,0x3b,
-0x42,0xf7,0xd7,0x00,0x33,0xf3,0x2f,0x70,0xee,0x11,0xb0,0xf6,0x00,0x9f,0xb9,0xaf,
-0xc9,0x99,0x40,0x0b,0xb0,0x03,0x24,0x11,0x63,0x88,0x88,0xaf,0xb8,0x88,0x84,0x2b,
-0x1b,0x41,0x00,0x01,0xef,0xf6,0x58,0x0c,0x30,0x7d,0xe3,0x00,0x03,0x1c,0xf3,0x01,
-0x3f,0xf7,0x00,0x1c,0xff,0x80,0x00,0x3d,0xff,0x80,0xa9,0x20,0x00,0x00,0x06,0xc3,
-0x6a,0x0d,0x63,0x77,0x77,0x8f,0xb7,0x77,0x73,0x34,0x00,0xf0,0x28,0x02,0xc4,0x3f,
-0x70,0xb7,0x00,0x00,0x7f,0x12,0xf7,0x1f,0x70,0x00,0x0d,0xf9,0x3f,0x88,0xfd,0x20,
-0x0a,0xf7,0xfb,0xfd,0xfa,0xde,0x31,0xd6,0x03,0xee,0xf9,0x01,0xa1,0x00,0x00,0xaf,
-0x3d,0xe2,0x00,0x00,0x02,0xcf,0x70,0x2f,0xf6,0x00,0x1b,0xff,0x60,0x00,0x2d,0xfe,
-0x50,0xa9,0x20,0x00,0x8b,0x30,0xf0,0x0d,0xd9,0x00,0x23,0x33,0x33,0x00,0x0f,0x80,
-0x0a,0xff,0xff,0xf5,0x27,0xfa,0x75,0x12,0x25,0xfd,0x05,0xff,0xff,0xe0,0x01,0xde,
-0x10,0x08,0xf0,0xbc,0xcd,0x0d,0x90,0xbb,0x0f,0xb8,0x8b,0xf9,0x86,0x0f,0x93,0xf8,
-0x80,0x1a,0x40,0xbf,0xdf,0x00,0x06,0x43,0x29,0x10,0xe1,0xb0,0x2b,0xfb,0x03,0x0c,
-0xff,0xc0,0x06,0xf2,0x00,0x3d,0xf4,0x58,0x17,0xbf,0x20,0x01,0xc3,0x00,0x00,0xff,
-0xa0,0x61,0x0e,0x80,0x2f,0x40,0x00,0x8e,0x20,0x00,0x04,0xf2,0x26,0x3d,0xf0,0x15,
-0x03,0xaf,0x76,0x06,0xf3,0x5f,0x20,0x7f,0xff,0xf1,0xeb,0x00,0xdc,0x00,0xca,0x7e,
-0xaf,0xed,0xef,0xf5,0x0f,0x6a,0xc7,0xca,0x97,0x6d,0x83,0xf5,0xd9,0x04,0x44,0x44,
-0x50,0x1c,0xff,0x52,0xdc,0x0b,0xf5,0x0a,0x0c,0xf7,0x2f,0x40,0x09,0xe0,0x03,0xfd,
-0xf4,0xf4,0x00,0x8e,0x04,0xfd,0x05,0x2f,0xff,0xff,0xe0,0x1b,0x10,0x02,0xf9,0x66,
-0xbe,0x84,0x1c,0x01,0x4b,0x1b,0x00,0x0f,0x06,0x20,0xef,0xe2,0x5e,0x01,0x21,0xbf,
-0xd2,0x43,0x13,0x11,0xa0,0x95,0x01,0x10,0xa0,0xe1,0x11,0x54,0x78,0xfc,0x77,0x77,
-0x52,0xe1,0x11,0x22,0x00,0xf9,0xde,0x05,0x02,0x9f,0x0f,0x01,0x0d,0x00,0x40,0x49,
-0x9f,0x80,0x00,0x00,0x1f,0x1c,0xc2,0x85,0x28,0x00,0x21,0x27,0x04,0x20,0x2f,0x30,
-0x11,0xfb,0x88,0x1f,0x34,0x51,0x1f,0x63,0x44,0x44,0x42,0x53,0x0f,0x00,0xd7,0x3c,
-0x41,0x02,0x22,0x7f,0xd1,0xb3,0x1c,0x14,0xa1,0xad,0x2c,0x12,0x21,0xa5,0x2d,0x03,
-0xbd,0x26,0x40,0x00,0x58,0xbf,0x40,0x43,0x02,0x18,0xfe,0x0a,0x01,0x01,0xfb,0x02,
-0x72,0x06,0x66,0xbf,0x96,0x66,0x66,0x31,0x57,0x2d,0x00,0x77,0x17,0x01,0x92,0x0d,
-0xf1,0x0b,0x4f,0xff,0xff,0x90,0x01,0xcf,0x21,0x66,0x8f,0xe3,0x01,0xdf,0xf0,0x00,
-0x0d,0xe2,0x00,0x5f,0xef,0x27,0x77,0xfc,0x77,0x50,0x49,0xf4,0xbd,0x00,0x11,0x9f,
-0xb1,0x00,0x60,0x09,0xf0,0x05,0x7f,0x80,0x00,0x74,0x14,0x16,0xe3,0x79,0x20,0x20,
-0x11,0x13,0x3a,0x0d,0xf3,0x2b,0xe7,0xaf,0x9b,0xff,0x40,0x07,0xf9,0x7d,0x8a,0x59,
-0xf3,0x00,0x6f,0xa6,0xaa,0xa6,0xaf,0x30,0x05,0xfe,0xcc,0xfb,0xbf,0xf2,0x02,0xaf,
-0xa8,0xd9,0xb8,0xbf,0x80,0x5f,0xa8,0x88,0x88,0x88,0xcf,0x05,0xf3,0xce,0xee,0xee,
-0x87,0xf0,0x01,0x02,0x22,0x6f,0xd2,0x01,0x02,0x44,0x44,0x5f,0xe5,0x44,0x40,0x9f,
-0x55,0x2e,0x21,0x04,0x6f,0xe7,0x02,0x02,0x44,0x01,0x03,0xb3,0x06,0x10,0xf2,0x6d,
-0x0d,0x41,0x8f,0xa5,0x55,0x5f,0x2d,0x0e,0xf2,0x0b,0xfa,0x11,0x11,0x11,0x1b,0xea,
-0x9a,0x30,0x00,0x00,0x79,0x04,0xf5,0x00,0x4b,0xc0,0x00,0x4f,0x99,0xef,0xe9,0x20,
-0x04,0xff,0xea,0x50,0x24,0x03,0x10,0x41,0xcd,0x03,0xc2,0x0d,0xc0,0x2f,0xd8,0x88,
-0x8a,0xf9,0x00,0x8e,0xff,0xff,0xfb,0x6c,0x25,0x00,0xa0,0x02,0x43,0xcf,0xa7,0x77,
-0x70,0x0b,0x09,0xc3,0xf9,0x00,0xa6,0x00,0x0a,0xf0,0x06,0x40,0x6f,0x70,0x00,0x46,
-0x1d,0x10,0xf0,0x03,0x17,0x7d,0xf9,0x78,0xfe,0x77,0x10,0x03,0xfe,0x10,0x9f,0x40,
-0x00,0x00,0x4b,0xff,0xcf,0xa0,0x9a,0x16,0x00,0x87,0x53,0xdc,0x06,0xad,0xfe,0x65,
-0xdf,0xf8,0x00,0xae,0xa6,0x00,0x00,0x5e,0x90,0x27,0x2b,0x10,0x9c,0x29,0x35,0x62,
-0x88,0x8d,0xfa,0x88,0x86,0x03,0x13,0x1d,0xf3,0x03,0x3f,0x41,0x11,0x11,0x11,0xcc,
-0x02,0xa5,0xff,0xff,0xff,0x98,0x80,0x00,0x03,0x33,0x33,0x32,0xb0,0x13,0x70,0xf1,
-0x37,0x7a,0xfa,0x7f,0xc7,0x77,0xc3,0x13,0x10,0xf9,0x32,0x06,0xfc,0x02,0xe0,0x0f,
-0x90,0x1c,0x22,0x7d,0xf5,0x00,0xed,0x69,0xf2,0x5f,0xb4,0x00,0x08,0xff,0xfa,0x5b,
-0x00,0x10,0x4d,0x42,0x1e,0x53,0x88,0x89,0xfd,0x88,0x88,0x2a,0x10,0x21,0x0f,0x70,
-0x35,0x14,0x10,0xb6,0xb4,0x01,0xa1,0xb0,0x00,0x07,0x78,0xfb,0x77,0x00,0x00,0x06,
-0xd3,0x89,0x0f,0x21,0xaf,0x21,0xba,0x0f,0x80,0xf7,0x1f,0xb6,0x66,0x00,0x04,0xfe,
-0xf7,0x18,0x10,0xa4,0xde,0x1d,0xff,0xd9,0x88,0x84,0x4e,0x40,0x07,0xce,0x60,0x33,
-0x06,0x01,0x00,0x00,0x88,0x13,0x02,0x0b,0x01,0xf0,0x1a,0x40,0xfb,0x7a,0x76,0x68,
-0x69,0xf4,0x0d,0x69,0xf5,0x03,0xfa,0x5d,0x30,0x3c,0xf7,0x2e,0x74,0xee,0x30,0x04,
-0xd4,0x2d,0xff,0x72,0xc5,0x00,0x00,0x6e,0xd1,0x8f,0xb1,0x00,0x06,0xdf,0xe6,0x55,
-0xaf,0xfa,0x34,0xfe,0xa6,0x30,0xe1,0xf6,0x03,0x3f,0x50,0x00,0x1f,0x81,0x00,0x03,
-0xf9,0x66,0x67,0xf8,0x00,0xad,0x15,0x14,0x80,0xad,0x02,0x62,0x22,0x22,0x9f,0x32,
-0x22,0x20,0xad,0x02,0x20,0x01,0xf6,0xb9,0x12,0xf4,0x2c,0xf0,0x39,0xaf,0x9a,0xf9,
-0xaf,0x99,0x35,0xbd,0xf8,0xaf,0x8a,0xfb,0xb5,0x00,0x6c,0xcc,0xcc,0xcb,0x00,0x00,
-0x0a,0xdb,0xbb,0xbb,0xd9,0x00,0x00,0xce,0xbb,0xbb,0xbf,0xa0,0x00,0x0c,0xea,0xaa,
-0xaa,0xfa,0x00,0x00,0xce,0xaa,0xaa,0xaf,0xa0,0x00,0x38,0xdf,0x92,0xbf,0xd8,0x20,
-0x0c,0xc8,0x30,0x00,0x27,0xd7,0xa8,0x00,0x63,0x11,0x11,0x8f,0x31,0x11,0x10,0x55,
-0x00,0xf2,0x0c,0xf7,0x48,0xa3,0x44,0x48,0xf0,0x08,0xaf,0xb7,0x5d,0xdf,0xb8,0x00,
-0x08,0xfb,0xb0,0xbb,0xf7,0x00,0x00,0x8e,0x66,0x26,0x6f,0x70,0x00,0x08,0x1d,0x30,
-0x20,0x1c,0xf7,0x77,0x11,0x11,0x5d,0x81,0x05,0xf7,0x03,0x3f,0xcd,0x58,0x85,0xc2,
-0xe9,0x00,0x18,0xf4,0xf8,0xb9,0x8f,0x70,0x00,0x55,0x17,0x10,0xaf,0x5f,0x03,0x00,
-0x94,0x05,0xf0,0x16,0x44,0x44,0xcf,0x74,0x44,0x40,0x2f,0xed,0xdd,0xdd,0xdd,0xef,
+0xd3,0x00,0x8f,0x10,0x02,0xc1,0x02,0x33,0x33,0x6f,0xb0,0x00,0x00,0x55,0x55,0x5d,
+0xf7,0x50,0xc1,0x00,0xf6,0x05,0xfe,0x00,0x00,0xea,0x00,0x00,0x0b,0xe0,0x00,0x0e,
+0xfe,0xee,0xee,0xfe,0x00,0x00,0xec,0x66,0x66,0x6d,0xf1,0x00,0xb1,0x04,0xe4,0x00,
+0x00,0x00,0x33,0x34,0xfc,0x33,0x32,0x00,0x34,0x03,0xf0,0x0b,0x00,0xfa,0x22,0x22,
+0x22,0xf9,0x00,0xfd,0x99,0x99,0x99,0xf9,0x00,0xfe,0xdd,0xdd,0xdd,0xd8,0x01,0xf8,
+0x33,0x33,0x33,0x32,0x03,0xf8,0x4b,0x00,0xe0,0x05,0xf6,0xf7,0x33,0x33,0xce,0x0a,
+0xf3,0xf5,0x00,0x00,0xae,0x2f,0xa2,0x12,0x00,0x63,0x2d,0x22,0xf9,0x66,0x66,0xce,
+0x4d,0x00,0xc1,0x4d,0x30,0xfa,0x00,0x00,0x00,0x0c,0xf6,0x5f,0xc5,0x55,0x20,0x72,
+0x02,0xf2,0x00,0xf6,0x01,0xfd,0x11,0x1f,0xa1,0x11,0x00,0x1a,0x96,0x66,0xfc,0x66,
+0x66,0x13,0xe7,0x02,0x82,0x00,0x01,0x11,0x11,0x11,0x10,0x00,0x0b,0xf7,0x00,0xc1,
+0xbe,0x55,0x55,0x5c,0xf0,0x00,0x0b,0xd0,0x00,0x00,0xaf,0x00,0x4c,0x03,0x74,0xf0,
+0x00,0x0b,0xe7,0x77,0x77,0xcf,0xcb,0x03,0x20,0x47,0xcd,0x75,0x03,0xf3,0x4a,0xff,
+0xc6,0x8f,0xff,0xfe,0x03,0x2f,0x70,0x7f,0x88,0xde,0x02,0x3f,0x92,0x8f,0x10,0xae,
+0x6f,0xff,0xff,0xdf,0x10,0xae,0x14,0xbf,0xb4,0x8f,0x10,0xae,0x01,0xff,0xf5,0x7f,
+0x10,0xae,0x08,0xef,0xdf,0xaf,0x10,0xae,0x3f,0x7f,0x7a,0x8f,0x10,0xae,0x7d,0x1f,
+0x70,0x7f,0xff,0xfe,0x02,0x1f,0x70,0x7f,0x87,0xde,0x00,0x1f,0x70,0x25,0x00,0x23,
+0xef,0xff,0xf1,0xff,0xff,0xf0,0xea,0x28,0xf1,0xf7,0x29,0xf0,0xee,0xde,0xf1,0xfe,
+0xde,0xf0,0xeb,0x39,0xf1,0xf8,0x3a,0xf0,0x18,0x00,0xf0,0x00,0x22,0x20,0x22,0x29,
+0xf0,0xe9,0x0f,0xff,0xfe,0x08,0xf0,0xe9,0x0f,0x94,0xaf,0x06,0x00,0x30,0x50,0x7f,
+0x08,0x12,0x00,0xd6,0xff,0x08,0xf0,0xe9,0x0d,0x84,0x4a,0x8d,0xf0,0xe9,0x00,0x00,
+0x06,0xcc,0x02,0xf3,0x3e,0xc6,0x00,0x0a,0xa0,0x00,0x04,0x6d,0xc6,0x20,0xe9,0x00,
+0x00,0xcf,0xff,0xf6,0x2f,0xc8,0x83,0x0c,0x90,0x0e,0x66,0xfe,0xff,0x50,0xcc,0x66,
+0xf7,0xdf,0x0c,0xa0,0x0d,0xff,0xff,0xbf,0xf4,0xf7,0x00,0xe9,0x11,0x11,0x5d,0xbf,
+0x40,0x0e,0xef,0xff,0xa0,0x7f,0xe0,0x01,0xfc,0xe2,0xba,0x03,0xfa,0x00,0x5f,0x9e,
+0x0b,0xa0,0xaf,0xe1,0x09,0xd6,0xff,0xfb,0xaf,0x8d,0xd2,0x25,0x6e,0x3a,0x9e,0x70,
+0x2d,0x20,0x8b,0x01,0xc3,0xfe,0xef,0x5d,0xfe,0xfc,0x00,0x4f,0x01,0xf5,0xd7,0x0a,
+0xc0,0x0d,0x00,0xf2,0x17,0x05,0x66,0x66,0x66,0x66,0x20,0x00,0xdf,0xee,0xff,0xef,
+0xf5,0x00,0x0d,0xc4,0x6f,0x94,0x7f,0x50,0x00,0xde,0xcd,0xfe,0xcd,0xf5,0x00,0x0d,
+0xd9,0xaf,0xc9,0xaf,0x50,0x00,0x67,0x78,0xfb,0x77,0x72,0xf0,0x04,0xd0,0xf7,0x05,
+0x55,0x57,0xfa,0x55,0x55,0x20,0x00,0x00,0x2f,0x60,0x00,0x88,0x01,0xf0,0x0e,0xff,
+0xff,0xff,0x02,0xff,0xf6,0xcc,0x5f,0xa5,0x50,0x2f,0x9f,0x7c,0xd8,0xfc,0x85,0x02,
+0xf3,0xe7,0xcf,0xdf,0xed,0x90,0x2f,0x3e,0x7c,0xb3,0xf9,0x32,0x0d,0x00,0xf1,0x6a,
+0xff,0xff,0xa0,0x2f,0x3e,0x7c,0xc6,0xfb,0x66,0x22,0xff,0xf7,0x9b,0xbb,0xcb,0xf5,
+0x2f,0x97,0x78,0x76,0x9b,0x4f,0x41,0x81,0x08,0xbb,0x6f,0x69,0xf3,0x00,0x00,0xe6,
+0x97,0x65,0x9f,0x10,0x00,0x06,0x00,0x00,0xaf,0x80,0x05,0xff,0xff,0x1d,0xff,0xfb,
+0x00,0x5f,0x59,0xf1,0xdb,0x4d,0xb0,0x05,0xf0,0x6f,0x1d,0x90,0xbb,0x00,0x5f,0xff,
+0xf1,0xdf,0xff,0xb0,0x01,0x44,0x4d,0xb3,0xce,0x63,0x01,0x66,0x68,0xfc,0x69,0xfc,
+0x64,0x2e,0xef,0xff,0xee,0xff,0xee,0x80,0x3a,0xf8,0x00,0x07,0xfb,0x51,0x2f,0xff,
+0xff,0x3d,0xff,0xff,0x90,0x3f,0x98,0xf3,0xeb,0x5f,0xa0,0x00,0xf9,0x8f,0x3e,0xa5,
+0xf8,0x00,0x0f,0xff,0xe3,0xef,0xfe,0x80,0x0f,0xb0,0x00,0x01,0x65,0x02,0x30,0x9d,
+0xf0,0x0f,0xa9,0x03,0xf1,0x0a,0x9f,0x00,0xf8,0x16,0x66,0x66,0x09,0xf0,0x0f,0x82,
+0xff,0xff,0xf1,0x9f,0x00,0xf8,0x2f,0x40,0x7f,0x19,0xf0,0x0f,0x82,0xf4,0x07,0x0d,
+0x00,0xc0,0xff,0xff,0x19,0xf0,0x0f,0x81,0x66,0x66,0x60,0x9f,0x00,0xf9,0x3d,0x04,
+0x12,0xf0,0x41,0x00,0x00,0x35,0x06,0x23,0x66,0x6c,0x0d,0x00,0xf0,0x16,0x10,0xfa,
+0x66,0x66,0x66,0x6a,0xf1,0x0f,0x60,0x02,0xb3,0x00,0x6f,0x10,0xf6,0x00,0x3f,0x40,
+0x06,0xf1,0x0f,0x6f,0xff,0xff,0xff,0x6f,0x10,0xf6,0x66,0xbf,0x66,0x66,0xf1,0x0f,
+0x60,0x0d,0xfa,0x1a,0x00,0xf3,0x10,0x06,0xf8,0xec,0x16,0xf1,0x0f,0x6a,0xfa,0x02,
+0xec,0x7f,0x10,0xf6,0x66,0x00,0x02,0x46,0xf1,0x0f,0xfe,0xee,0xee,0xee,0xff,0x10,
+0xf9,0x55,0x55,0x55,0x59,0xf1,0xf5,0x04,0x01,0x5a,0x00,0xf0,0x13,0xf8,0x00,0x29,
+0x20,0x09,0xf0,0xf8,0x34,0x7f,0x64,0x49,0xf0,0xf8,0xdf,0xff,0xff,0xd9,0xf0,0xf8,
+0x01,0x5f,0x41,0x09,0xf0,0xf8,0x4f,0xff,0xff,0x59,0xf0,0xf8,0x4f,0x10,0x1f,0x06,
+0x00,0xa2,0xed,0xef,0x59,0xf0,0xf8,0x03,0x33,0x33,0x19,0xf0,0x3c,0x00,0x54,0xfc,
+0x77,0x77,0x77,0x7c,0xa3,0x00,0xf0,0x2c,0xfa,0x66,0xd7,0x66,0x6b,0xf0,0x0f,0x60,
+0x9f,0x62,0x20,0x7f,0x00,0xf7,0x8f,0xff,0xff,0xc8,0xf0,0x0f,0xaf,0xdd,0x5c,0xd2,
+0x7f,0x00,0xf6,0x37,0xff,0xf7,0x28,0xf0,0x0f,0xdf,0xee,0x67,0xcf,0xcf,0x00,0xf7,
+0x31,0x9e,0xd3,0x17,0xf0,0x0f,0x63,0xec,0x9a,0x20,0x7f,0x00,0xf6,0x02,0x58,0xcf,
+0x27,0xf0,0x0f,0xaf,0x03,0x22,0xff,0x00,0x7f,0x05,0x05,0x4e,0x00,0xc0,0x66,0x6a,
+0x8b,0xf0,0x0f,0x60,0x00,0x9a,0x9b,0x7f,0x00,0xf8,0xb0,0x03,0xf7,0x18,0xf0,0x0f,
+0x66,0x77,0x8d,0x56,0x8f,0x00,0xf6,0xc9,0xf7,0xec,0x77,0xf0,0x0f,0x6c,0xcf,0x4f,
+0xe0,0x7f,0x00,0xf6,0x36,0x84,0xf9,0x79,0xf0,0x0f,0x9f,0xdd,0xfe,0xef,0xaf,0x00,
+0xf6,0x00,0x29,0x07,0x77,0x41,0x00,0x26,0x66,0x6b,0x0d,0x00,0xf0,0x28,0xd9,0x66,
+0x6a,0xf0,0x0f,0x63,0xaf,0xca,0xa0,0x7f,0x00,0xf6,0x58,0xf6,0xaf,0x57,0xf0,0x0f,
+0x69,0x99,0x99,0x99,0x7f,0x00,0xf6,0x5f,0xaa,0xbf,0x47,0xf0,0x0f,0x64,0xda,0xcb,
+0xd3,0x7f,0x00,0xf6,0xcc,0xcf,0xdc,0xb7,0xf0,0x0f,0x68,0xc4,0xf9,0x44,0x7f,0x00,
+0xf6,0x67,0x7f,0xb7,0x77,0x9c,0x00,0x5b,0xff,0xee,0xff,0x00,0xfa,0x9c,0x00,0x01,
+0xea,0x00,0xf0,0x01,0xde,0xde,0xf0,0x7f,0x00,0xf6,0x0d,0xc9,0xcf,0x07,0xf0,0x0f,
+0x62,0x88,0x88,0x83,0x4e,0x00,0x91,0x77,0x7e,0x77,0xf0,0x0f,0x65,0xfa,0xaa,0xf7,
+0x5b,0x00,0xff,0x00,0xaf,0x77,0xf0,0x0f,0x64,0xef,0xbe,0xd5,0x7f,0x00,0xf6,0x9b,
+0x40,0x4c,0x78,0x9c,0x00,0x01,0xf0,0x33,0x10,0xf8,0x58,0x88,0x88,0x59,0xf1,0x0f,
+0x64,0xfa,0xaa,0xf4,0x6f,0x10,0xf6,0x4f,0xcc,0xcf,0x46,0xf1,0x0f,0x77,0x78,0xf8,
+0x77,0x8f,0x10,0xf7,0x88,0x9f,0x88,0x88,0xf1,0x0f,0x6b,0xed,0xdd,0xeb,0x6f,0x10,
+0xf6,0xb7,0xb8,0xb7,0xb6,0xf1,0x0f,0x6b,0x79,0xaa,0x7b,0x6f,0x10,0xf6,0xbe,0xdd,
+0xde,0xb6,0xf1,0x0f,0xa7,0x88,0x88,0x87,0xaf,0x10,0xbc,0x04,0x25,0xde,0xf1,0x7b,
+0x06,0x00,0x23,0x07,0x72,0x03,0x33,0x9f,0x63,0x33,0x33,0x11,0x2d,0x03,0xf1,0x14,
+0x04,0x4a,0xf7,0x44,0x44,0x44,0x10,0x02,0xfc,0x00,0x3f,0x50,0x00,0x00,0xcf,0x30,
+0x03,0xf5,0x00,0x01,0xdf,0xf0,0xdf,0xff,0xff,0xe0,0x3f,0xef,0x05,0x68,0xf9,0x65,
+0x00,0x49,0xf0,0x1a,0x00,0xf1,0x03,0x9f,0x00,0x03,0xf5,0x00,0x00,0x09,0xf2,0x66,
+0x8f,0xa6,0x63,0x00,0x9f,0x5f,0xff,0xff,0xff,0x5d,0x03,0xe0,0x21,0x00,0x00,0x0d,
+0x90,0x00,0x0e,0x80,0x00,0x00,0xd9,0x03,0xa0,0xe8,0x0d,0x00,0xf0,0x2a,0x5f,0x0e,
+0x96,0xb2,0x5f,0xff,0xe5,0xf3,0xff,0xff,0x32,0x7e,0xc6,0x8f,0xff,0xb6,0xf3,0x00,
+0xd9,0x6f,0xf6,0xe8,0x3f,0x30,0x0d,0x91,0x8f,0x0e,0x84,0xf3,0x00,0xde,0xe6,0xf0,
+0xea,0xef,0x14,0xdf,0xf8,0x6f,0x0e,0x85,0x30,0x3f,0x91,0x05,0xf0,0x00,0x09,0xb0,
+0x20,0x00,0x4f,0x86,0x67,0xea,0x00,0xf7,0x04,0x11,0xfd,0x04,0x04,0xe0,0x11,0x00,
+0x00,0x0e,0x70,0x00,0x0a,0xe0,0x00,0x00,0xe7,0x00,0x00,0xae,0x0d,0x00,0xf0,0x0c,
+0x01,0x0a,0xe0,0x00,0x7f,0xff,0xf8,0xf0,0xae,0x00,0x05,0x9f,0xc9,0x8f,0x0a,0xf8,
+0x83,0x00,0xe7,0x08,0xf0,0xaf,0xff,0x60,0x0e,0x70,0x8f,0x27,0x00,0x20,0xfc,0xc9,
+0x1a,0x00,0xc2,0xdf,0xe8,0x9f,0x0a,0xe0,0x00,0x4b,0x50,0x08,0xf0,0xae,0x00,0xb5,
+0x06,0x83,0xfa,0x00,0x00,0x78,0x88,0x88,0x88,0x50,0xfe,0x00,0xf1,0x38,0x1f,0x50,
+0x01,0xf6,0x00,0x00,0x01,0xf5,0x00,0x8f,0x41,0x11,0x00,0x1f,0x60,0x3f,0xff,0xff,
+0xf3,0x7f,0xff,0xdd,0xe5,0x55,0x8f,0x23,0x8f,0xa7,0xf5,0x40,0x04,0xf2,0x01,0xf5,
+0x01,0x6f,0x70,0x4f,0x10,0x1f,0x50,0x00,0x6e,0x26,0xf1,0x01,0xfb,0xe2,0x01,0x9f,
+0xcf,0x02,0x9f,0xf7,0x28,0xfe,0x67,0xf0,0x6f,0x91,0x09,0xf8,0x00,0x9d,0x01,0x20,
+0x00,0x11,0x26,0x7e,0xa0,0x5a,0x09,0x16,0xd3,0xb8,0x09,0xf0,0x23,0xe4,0xf2,0xe8,
+0x00,0x5f,0xaa,0xf5,0x4f,0x2e,0x80,0x26,0xfa,0xaf,0x65,0xf2,0xe8,0x06,0xdf,0xee,
+0xfd,0x6f,0x2e,0x80,0x06,0xf1,0x7f,0x01,0x60,0xe8,0x02,0xec,0x07,0xf0,0x03,0x6f,
+0x80,0x7f,0x30,0x7f,0x00,0x5f,0xf6,0x00,0x32,0x23,0xaf,0x33,0x75,0x00,0x04,0x7a,
+0x01,0xf0,0x01,0xd0,0x00,0x13,0x33,0x9f,0x43,0x33,0x00,0x47,0x77,0x7b,0xf8,0x77,
+0x77,0x08,0xee,0x01,0x00,0x13,0xe1,0x55,0x00,0xf2,0x3e,0x06,0xf0,0x00,0x7f,0x00,
+0x00,0x2e,0xff,0xfb,0x07,0xf0,0x00,0x00,0x49,0xf4,0x37,0xdf,0xaa,0x30,0x9f,0xff,
+0xff,0x9d,0xfb,0xf4,0x03,0xd9,0x5d,0x80,0x8e,0x2f,0x40,0x08,0xa1,0xf3,0x9c,0xd2,
+0xf4,0x03,0xff,0xff,0xdb,0xfd,0x2f,0x40,0x15,0x9f,0x64,0x0e,0xf9,0xf4,0x03,0x59,
+0xf6,0x54,0xff,0xef,0x40,0x9f,0xff,0xff,0xcf,0x23,0xf9,0x40,0x05,0xf1,0x4f,0x90,
+0x0d,0xd9,0x00,0x5f,0x16,0xc0,0x00,0x8f,0xfe,0x00,0x63,0x30,0x00,0x4f,0x40,0x00,
+0xae,0x13,0x0a,0x71,0xb0,0x04,0x7f,0x96,0x66,0xcf,0x43,0x89,0x00,0xb0,0xe0,0x00,
+0x00,0x4f,0xa8,0x88,0xde,0x00,0x00,0x04,0xfa,0x02,0x08,0x11,0xbf,0x21,0x00,0xf0,
+0x0d,0x53,0x5b,0xf8,0x67,0x5b,0xf8,0x41,0x19,0xfe,0x5b,0xf5,0x6f,0xf7,0x09,0xf7,
+0xbd,0xff,0xed,0x7a,0xf2,0x05,0x55,0x5a,0xf5,0x55,0x52,0x00,0x9f,0x20,0x00,0xf7,
+0x40,0x40,0x26,0xaf,0x64,0x8f,0xff,0xfe,0x05,0xff,0xff,0xc8,0xe5,0x5b,0xe0,0x00,
+0x6f,0x00,0x8d,0x01,0x9e,0x09,0xef,0xfe,0xea,0xd2,0xff,0xa0,0x4d,0x96,0xea,0x9e,
+0x36,0x52,0x00,0xa9,0x2f,0x28,0xff,0xff,0xf2,0x5f,0xff,0xfc,0x8f,0xf4,0x9e,0x02,
+0x5a,0xf5,0x48,0xec,0x9d,0xa0,0x35,0xaf,0x55,0x9d,0x5f,0xf4,0x0a,0xff,0xff,0xfa,
+0xd0,0xff,0x10,0x00,0x6f,0x00,0x8e,0xbf,0xfe,0x30,0x06,0xf0,0x08,0xfd,0x32,0xb2,
+0x75,0x08,0x20,0x20,0x00,0x4e,0x02,0x00,0xb6,0x08,0xfa,0x38,0xe8,0x0b,0xef,0xff,
+0xee,0x30,0x0e,0x80,0xbb,0x4f,0x96,0xf4,0x2d,0xff,0xab,0xb5,0xf9,0x7f,0x42,0xcf,
+0xe8,0xbe,0xdf,0xdd,0xf4,0x00,0xe8,0x0b,0xb6,0xf6,0x6f,0x40,0x0e,0x80,0xbf,0xff,
+0xff,0xf4,0x00,0xe8,0x10,0x0b,0xf8,0x83,0x00,0x2e,0xfe,0x03,0xff,0xae,0xa5,0x4f,
+0xfb,0x50,0xcd,0xce,0xfd,0xa0,0x71,0x02,0xcf,0x3b,0xb3,0x7a,0x00,0x00,0x3d,0x30,
+0x7f,0xff,0x70,0xd3,0x08,0x70,0x60,0x00,0x0f,0xa0,0x00,0x00,0xf7,0x14,0x06,0xf0,
+0x11,0x90,0x0f,0x70,0x35,0x7f,0x75,0x52,0x4f,0xff,0xc3,0xfe,0xdd,0xee,0x02,0x7f,
+0xb5,0x3f,0xa9,0x9c,0xe0,0x00,0xf7,0x03,0xf7,0x66,0xae,0x00,0x0f,0x70,0x3f,0xcc,
+0xce,0x0d,0x00,0xd0,0xfc,0xbb,0xde,0x00,0x2f,0xed,0x7f,0x87,0x7b,0xf5,0x4f,0xfc,
+0x9f,0x2d,0x01,0xd1,0x82,0x00,0x5d,0xf3,0x7f,0x91,0x00,0x00,0x6f,0xb3,0x00,0x6e,
+0x90,0xae,0x00,0x00,0x72,0x09,0x00,0x06,0x00,0xf0,0x21,0x0f,0x70,0x0e,0x80,0x3f,
+0x60,0x00,0xf7,0x03,0xbc,0x3b,0xf4,0x00,0x0f,0x70,0xfd,0xdf,0xdd,0xf3,0x2f,0xff,
+0x9f,0xa6,0xf5,0xaf,0x31,0x7f,0xb4,0xf6,0xcf,0xc5,0xf3,0x00,0xf7,0x0f,0xcb,0xfc,
+0xbf,0x30,0x0f,0x70,0x67,0x77,0x77,0x61,0x00,0xf7,0x25,0x9e,0x02,0xf2,0x0a,0x5f,
+0xfb,0x5f,0x65,0x5d,0xa0,0x2f,0xd7,0x15,0xfa,0x99,0xea,0x00,0x30,0x00,0x5f,0xdd,
+0xdf,0xa0,0x00,0x00,0x05,0xf5,0x44,0xda,0x73,0x09,0xf0,0x35,0xff,0x30,0xe8,0x88,
+0x88,0x12,0x94,0x30,0x0e,0x7e,0x99,0xf0,0x0f,0x9b,0x00,0xe7,0xeb,0xbf,0x36,0xf7,
+0xc0,0x0e,0x8b,0xbb,0xb7,0xaf,0xc9,0x00,0xe9,0xfb,0xbf,0x36,0xfd,0x00,0x0f,0x9f,
+0x99,0xf6,0xe7,0xea,0x00,0xf8,0xf0,0xae,0xdc,0x05,0xf1,0x1f,0x40,0x00,0x39,0x10,
+0x01,0x05,0xf2,0xde,0xef,0xfe,0xee,0x70,0x8f,0x14,0x44,0x9f,0x64,0x43,0x06,0xab,
+0x47,0x00,0x1a,0xf4,0xd8,0x09,0x21,0x0b,0xb0,0xe1,0x0b,0x20,0xfb,0x12,0xf3,0x0a,
+0xf0,0x1a,0x4f,0xff,0xfc,0x8f,0x10,0x00,0x09,0xf5,0x5f,0xa8,0xf1,0x00,0x02,0xf9,
+0x03,0xf7,0x8f,0xe5,0x00,0xaf,0x95,0x8f,0x38,0xfd,0xf4,0x00,0x4a,0xff,0xd0,0x8f,
+0x2d,0xf3,0x00,0x0a,0xf6,0x08,0xf1,0x28,0x00,0x03,0xfe,0x34,0x00,0x90,0x04,0xef,
+0x30,0x08,0xf1,0x00,0x07,0xff,0x50,0x0d,0x00,0x21,0x1a,0x20,0x34,0x0b,0x05,0x6d,
+0x0c,0x10,0xdc,0x0a,0x01,0x20,0x05,0xef,0x7d,0x09,0xf0,0x1d,0x4d,0xfa,0x66,0x8f,
+0xd1,0x00,0x03,0xc5,0xd7,0x5f,0xe2,0x00,0x00,0x00,0x2b,0xff,0xd5,0x00,0x00,0x0a,
+0xef,0xfb,0x7e,0xf4,0x21,0x00,0x9a,0x62,0x7f,0xff,0xff,0xf2,0x00,0x17,0xef,0x83,
+0x38,0xf9,0x00,0x03,0xf9,0x7d,0x57,0xfd,0x91,0x04,0xe1,0xef,0xf9,0x00,0x01,0x68,
+0xae,0xff,0xc4,0x00,0x00,0x0e,0xfd,0xa6,0x10,0x4f,0x01,0x02,0x01,0x00,0x21,0x03,
+0xf6,0x07,0x00,0x11,0x4f,0x6c,0x04,0x00,0xed,0x0b,0xa2,0x00,0x88,0x88,0xbf,0xb8,
+0x88,0x83,0x1f,0xff,0xff,0x82,0x04,0x21,0xcf,0xf1,0xd9,0x03,0x10,0xef,0xe7,0x01,
+0xfa,0x10,0x09,0xf4,0xdf,0x10,0x00,0x00,0x04,0xfc,0x05,0xfc,0x00,0x00,0x05,0xff,
+0x20,0x09,0xfc,0x10,0x1b,0xfe,0x30,0x00,0x0a,0xff,0x50,0xaa,0x10,0x00,0x00,0x06,
+0xd1,0x05,0x01,0x11,0xaf,0xaf,0x0c,0x60,0x05,0x88,0x8b,0xfa,0x88,0x85,0x7f,0x0c,
+0x01,0x6c,0x0c,0x24,0x07,0xf3,0x35,0x0d,0xc1,0xf2,0x18,0x88,0x8f,0xfe,0x88,0x88,
+0x10,0x00,0x03,0xff,0xf2,0x06,0x0d,0xf3,0x0a,0x3d,0xd1,0x00,0x00,0x02,0xdf,0x70,
+0x3f,0xd3,0x00,0x19,0xff,0x80,0x00,0x6f,0xfa,0x32,0xfc,0x30,0x00,0x00,0x3b,0xf3,
+0x01,0x00,0xc9,0x0c,0x28,0x03,0xf7,0xaa,0x00,0x00,0xb7,0x00,0x61,0xaa,0xaa,0xcf,
+0xca,0xaa,0xa5,0xaa,0x00,0x00,0x86,0x02,0x21,0xbf,0xf3,0x2f,0x04,0x20,0xdf,0x90,
+0x43,0x0d,0x90,0xf5,0xaf,0x30,0x00,0x00,0x03,0xfd,0x02,0xfd,0xf5,0x0c,0xf4,0x02,
+0xf8,0x07,0xfc,0x10,0x19,0xff,0x5a,0xf8,0x09,0xfe,0x51,0xec,0x30,0x0c,0xa0,0x07,
+0xf5,0x55,0x00,0x30,0x3b,0x42,0xf7,0xd7,0x00,0x20,0xf3,0x2f,0xde,0x00,0x10,0xef,
+0x48,0x0a,0x90,0x00,0x9f,0xb9,0xaf,0xc9,0x99,0x40,0x0b,0xb0,0x6f,0x00,0x72,0x01,
+0x88,0x88,0xaf,0xb8,0x88,0x84,0x62,0x00,0x51,0x80,0x00,0x01,0xef,0xf6,0x58,0x0c,
+0xf3,0x08,0x7d,0xe3,0x00,0x00,0x03,0xcf,0xa0,0x3f,0xf7,0x00,0x1c,0xff,0x80,0x00,
+0x3d,0xff,0x80,0xa9,0x20,0x00,0x00,0x06,0xc3,0x6a,0x0d,0x63,0x77,0x77,0x8f,0xb7,
+0x77,0x73,0x34,0x00,0xf0,0x25,0x02,0xc4,0x3f,0x70,0xb7,0x00,0x00,0x7f,0x12,0xf7,
+0x1f,0x70,0x00,0x0d,0xf9,0x3f,0x88,0xfd,0x20,0x0a,0xf7,0xfb,0xfd,0xfa,0xde,0x31,
+0xd6,0x03,0xee,0xf9,0x01,0xa1,0x00,0x00,0xaf,0x3d,0xe2,0x00,0x00,0x02,0xcf,0x70,
+0x2f,0xf6,0x00,0x1b,0xff,0x60,0x00,0x2d,0xfe,0x50,0x4e,0x00,0xf0,0x10,0x07,0xd1,
+0x00,0xd9,0x00,0x23,0x33,0x33,0x00,0x0f,0x80,0x0a,0xff,0xff,0xf5,0x27,0xfa,0x75,
+0x12,0x25,0xfd,0x05,0xff,0xff,0xe0,0x01,0xde,0x10,0x08,0xf0,0xbc,0xcd,0x0d,0x80,
+0xbb,0x0f,0xb8,0x8b,0xf9,0x86,0x0f,0x93,0x9e,0x07,0xf0,0x19,0xc0,0xbf,0xdf,0x00,
+0x06,0xf2,0x00,0x00,0x8f,0xe1,0x00,0x6f,0x20,0x00,0x0c,0xff,0xc0,0x06,0xf2,0x00,
+0x3d,0xf4,0x58,0x17,0xbf,0x20,0x01,0xc3,0x00,0x00,0xff,0xa0,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x12,0x00,0x01,0x00,0xf3,0x3f,0x2f,0x40,0x00,0x8e,0x20,0x00,
+0x04,0xf2,0x00,0x0e,0xc0,0x00,0x03,0xaf,0x76,0x06,0xf3,0x5f,0x20,0x7f,0xff,0xf1,
+0xeb,0x00,0xdc,0x00,0xca,0x7e,0xaf,0xed,0xef,0xf5,0x0f,0x6a,0xc7,0xca,0x97,0x6d,
+0x83,0xf5,0xd9,0x04,0x44,0x44,0x50,0x1c,0xff,0x52,0xff,0xff,0xfe,0x00,0x0c,0xf7,
+0x2f,0x40,0x09,0xe0,0x03,0xfd,0xf4,0xf4,0x00,0x8e,0x04,0xfd,0x05,0x2f,0xff,0xff,
+0xe0,0x1b,0x10,0x02,0xf9,0x66,0xbe,0x00,0x01,0x00,0xf0,0x03,0x0e,0xff,0xff,0xff,
+0xff,0x50,0x00,0x78,0x88,0x88,0xef,0xe2,0x00,0x00,0x00,0x01,0xbf,0xd2,0x16,0x00,
+0x20,0xef,0xa0,0x06,0x00,0xc0,0x0f,0xa0,0x00,0x00,0x17,0x77,0x78,0xfc,0x77,0x77,
+0x52,0xff,0x01,0x00,0x61,0xfa,0x00,0x00,0x00,0xf9,0x00,0x1a,0x00,0x34,0x90,0x00,
+0x00,0x0d,0x00,0xa7,0x49,0x9f,0x80,0x00,0x00,0x00,0x02,0xff,0xc2,0x00,0x01,0x00,
+0x11,0x20,0x06,0x00,0x51,0x7f,0x40,0x00,0x00,0x1f,0x3b,0x00,0xf0,0x0a,0x11,0xfb,
+0x88,0x88,0x88,0x8c,0xf1,0x1f,0x63,0x44,0x44,0x42,0x8f,0x10,0x00,0xef,0xff,0xff,
+0xd0,0x00,0x00,0x02,0x22,0x7f,0xd1,0x27,0x00,0x51,0x5f,0xa1,0x00,0x00,0x2f,0x27,
+0x00,0xb0,0x21,0x66,0x66,0x9f,0x96,0x66,0x61,0x00,0x00,0x05,0xf4,0x19,0x00,0x97,
+0x58,0xbf,0x40,0x00,0x00,0x00,0x03,0xfe,0xa0,0x5a,0x00,0xc1,0x03,0xf6,0x00,0x00,
+0x00,0x06,0x66,0xbf,0x96,0x66,0x66,0x31,0x34,0x00,0x31,0xf7,0x00,0x08,0x2d,0x00,
+0xf1,0x0d,0x02,0xfa,0x4f,0xff,0xff,0x90,0x01,0xcf,0x21,0x66,0x8f,0xe3,0x01,0xdf,
+0xf0,0x00,0x0d,0xe2,0x00,0x5f,0xef,0x27,0x77,0xfc,0x77,0x50,0x49,0xf4,0xbd,0x00,
+0x11,0x9f,0xb1,0x00,0xb5,0x09,0xf0,0x05,0x7f,0x80,0x00,0x00,0x9f,0x00,0x9f,0xe3,
+0x54,0x00,0xf1,0x32,0x02,0x11,0x13,0x00,0x00,0x00,0x5e,0xe7,0xaf,0x9b,0xff,0x40,
+0x07,0xf9,0x7d,0x8a,0x59,0xf3,0x00,0x6f,0xa6,0xaa,0xa6,0xaf,0x30,0x05,0xfe,0xcc,
+0xfb,0xbf,0xf2,0x02,0xaf,0xa8,0xd9,0xb8,0xbf,0x80,0x5f,0xa8,0x88,0x88,0x88,0xcf,
+0x05,0xf3,0xce,0xee,0xee,0x87,0xf0,0x01,0x02,0x22,0x6f,0xd2,0x01,0x02,0x44,0x44,
+0x5f,0xe5,0x44,0x40,0x9f,0x89,0x00,0x50,0x20,0x00,0x04,0x6f,0x60,0x4f,0x00,0x26,
+0xbf,0xd2,0xaf,0x00,0xa0,0x06,0xf2,0x00,0x00,0x55,0x55,0x8f,0xa5,0x55,0x5f,0x23,
+0x00,0xf1,0x32,0xfe,0xfa,0x11,0x11,0x11,0x1b,0xea,0x9a,0x30,0x00,0x00,0x79,0x04,
+0xf5,0x00,0x4b,0xc0,0x00,0x4f,0x99,0xef,0xe9,0x20,0x04,0xff,0xea,0x50,0x00,0x00,
+0x4f,0x60,0x00,0x00,0x41,0x04,0xf5,0x00,0x00,0x0d,0xc0,0x2f,0xd8,0x88,0x8a,0xf9,
+0x00,0x8e,0xff,0xff,0xfb,0x10,0x00,0x00,0x08,0xc0,0x00,0x00,0x00,0x77,0x77,0xcf,
+0xa7,0x77,0x70,0x0f,0x69,0x00,0xe1,0x00,0xf9,0x00,0xa6,0x00,0x0a,0xf0,0x06,0x40,
+0x6f,0x70,0x00,0x46,0x03,0x13,0x00,0xf0,0x03,0xf3,0x17,0x7d,0xf9,0x78,0xfe,0x77,
+0x10,0x03,0xfe,0x10,0x9f,0x40,0x00,0x00,0x4b,0xff,0xcf,0x34,0x01,0xfb,0x04,0x05,
+0xff,0xfe,0x71,0x00,0x06,0xad,0xfe,0x65,0xdf,0xf8,0x00,0xae,0xa6,0x00,0x00,0x5e,
+0x90,0x00,0x01,0x00,0xa2,0x9c,0x00,0x00,0x00,0x28,0x88,0x8d,0xfa,0x88,0x86,0x48,
+0x00,0xf1,0x06,0xc0,0x3f,0x41,0x11,0x11,0x11,0xcc,0x02,0xa5,0xff,0xff,0xff,0x98,
+0x80,0x00,0x03,0x33,0x33,0x32,0x00,0x07,0x1a,0x00,0xb0,0xf1,0x37,0x7a,0xfa,0x7f,
+0xc7,0x77,0x00,0x00,0x7f,0x20,0xf7,0x01,0xfc,0x03,0x0d,0xe0,0x0f,0x90,0x1c,0x22,
+0x7d,0xf5,0x00,0xed,0x69,0xf2,0x5f,0xb4,0x00,0x08,0xff,0xfa,0x5b,0x00,0xb1,0x4d,
+0x50,0x00,0x00,0x08,0x88,0x89,0xfd,0x88,0x88,0x00,0x41,0x00,0x90,0xf0,0x0f,0x70,
+0x00,0x00,0x00,0x8f,0x00,0xb6,0xb4,0x01,0xb0,0xb0,0x00,0x07,0x78,0xfb,0x77,0x00,
+0x00,0x06,0xd3,0x1f,0x3e,0x02,0xf0,0x0e,0xaf,0x21,0xff,0xff,0xf1,0x00,0x0e,0xf7,
+0x1f,0xb6,0x66,0x00,0x04,0xfe,0xf7,0xf8,0x00,0x00,0x01,0xde,0x1d,0xff,0xd9,0x88,
+0x84,0x4e,0x40,0x07,0xce,0x5a,0x01,0x0a,0x01,0x00,0x42,0x4f,0x70,0x00,0x00,0x0b,
+0x01,0xf4,0x32,0x40,0xfb,0x7a,0x76,0x68,0x69,0xf4,0x0d,0x69,0xf5,0x03,0xfa,0x5d,
+0x30,0x3c,0xf7,0x2e,0x74,0xee,0x30,0x04,0xd4,0x2d,0xff,0x72,0xc5,0x00,0x00,0x6e,
+0xd1,0x8f,0xb1,0x00,0x06,0xdf,0xe6,0x55,0xaf,0xfa,0x34,0xfe,0xff,0xff,0xff,0xfd,
+0xf6,0x03,0x3f,0x50,0x00,0x1f,0x81,0x00,0x03,0xf9,0x66,0x67,0xf8,0x00,0x00,0x3f,
+0xff,0xff,0xff,0x80,0xad,0x02,0x62,0x22,0x22,0x9f,0x32,0x22,0x20,0xad,0x02,0xf4,
+0x32,0x01,0xf6,0x99,0x99,0x99,0x99,0xf0,0x39,0xaf,0x9a,0xf9,0xaf,0x99,0x35,0xbd,
+0xf8,0xaf,0x8a,0xfb,0xb5,0x00,0x6c,0xcc,0xcc,0xcb,0x00,0x00,0x0a,0xdb,0xbb,0xbb,
+0xd9,0x00,0x00,0xce,0xbb,0xbb,0xbf,0xa0,0x00,0x0c,0xea,0xaa,0xaa,0xfa,0x00,0x00,
+0xce,0xaa,0xaa,0xaf,0xa0,0x00,0x38,0xdf,0x92,0xbf,0xd8,0x20,0x0c,0xc8,0x30,0x00,
+0x27,0xd7,0xa8,0x00,0x63,0x11,0x11,0x8f,0x31,0x11,0x10,0x55,0x00,0xf1,0x0c,0xf7,
+0x48,0xa3,0x44,0x48,0xf0,0x08,0xaf,0xb7,0x5d,0xdf,0xb8,0x00,0x08,0xfb,0xb0,0xbb,
+0xf7,0x00,0x00,0x8e,0x66,0x26,0x6f,0x70,0x00,0x08,0xc6,0x02,0x80,0x00,0x1c,0xf7,
+0x44,0x44,0x43,0x00,0x5d,0x2d,0x00,0xf7,0x04,0xa0,0x3f,0xcd,0x58,0x85,0xc2,0xe9,
+0x00,0x18,0xf4,0xf8,0xb9,0x8f,0x70,0x00,0x55,0x17,0x10,0xaf,0x5f,0x03,0xf7,0x42,
+0x30,0x00,0x00,0x00,0x44,0x44,0xcf,0x74,0x44,0x40,0x2f,0xed,0xdd,0xdd,0xdd,0xef,
 0x22,0xf6,0x3e,0x93,0xad,0x37,0xf2,0x08,0xdd,0xfe,0xdf,0xfd,0xd8,0x00,0x07,0xad,
-0xca,0xcd,0xa8,0x00,0x00,0xad,0x77,0x77,0x7e,0x51,0x24,0xe0,0xcc,0xcc,0xfb,0x00,
-0x00,0xae,0x99,0x99,0x9e,0xb0,0x00,0x0a,0xfe,0xee,0x54,0x14,0xf7,0x03,0x07,0xf6,
-0x1f,0x8d,0xf5,0x01,0x5a,0xfb,0x00,0xf8,0x18,0xd7,0x3f,0xc6,0x00,0x0b,0xff,0xfe,
-0x60,0x01,0x23,0xfa,0x00,0xfa,0x03,0x53,0x17,0x77,0x77,0x77,0xfd,0xda,0x15,0x13,
-0xf9,0x1a,0x00,0x21,0x07,0xc1,0x14,0x04,0x21,0x4f,0xb0,0x27,0x00,0x41,0x8f,0x60,
-0x0f,0xa0,0x06,0x22,0x04,0x34,0x00,0x00,0xc2,0x05,0x21,0xab,0xf9,0xf9,0x03,0x19,
-0xfc,0xb3,0x01,0xf0,0x36,0x07,0xf0,0x04,0xaa,0xaa,0x60,0x00,0x7f,0x00,0x5b,0xbb,
-0xfa,0x44,0x4a,0xf5,0x20,0x70,0x0f,0x7e,0xff,0xff,0xf6,0x3f,0x84,0xf4,0x22,0x29,
-0xf3,0x10,0x7f,0xdf,0x05,0x70,0x7f,0x00,0x00,0xbf,0xa0,0x7f,0x27,0xf0,0x00,0x08,
-0xfb,0x00,0xea,0x7f,0x00,0x02,0xfe,0xf6,0x07,0x77,0xf0,0x02,0xee,0x1c,0x90,0x00,
-0x7f,0x00,0x4f,0x40,0x10,0x03,0x8d,0xf0,0x00,0x10,0x5b,0x40,0x0c,0x64,0x02,0x10,
-0xda,0xea,0x16,0x30,0x05,0xbf,0xdb,0x06,0x2d,0xf7,0x30,0x7f,0x68,0xf6,0x66,0x8f,
-0x94,0x07,0xfe,0xff,0x9f,0xff,0xff,0x90,0x7f,0x47,0xf3,0x00,0x2f,0x50,0x07,0xff,
-0xff,0x4d,0x42,0xf5,0x01,0x9f,0x46,0xf3,0xbc,0x2f,0x50,0x5f,0xff,0xff,0x34,0xf5,
-0xf5,0x00,0x14,0xfc,0xf3,0x07,0x3f,0x50,0x04,0xeb,0x3f,0x30,0x02,0xf5,0x05,0xfa,
-0x36,0xf3,0x07,0x9f,0x40,0x04,0x06,0xfc,0x00,0xde,0x64,0x04,0x00,0x7b,0x39,0x20,
-0xf4,0xe7,0xcb,0x22,0x20,0x0f,0x4e,0x29,0x10,0xf0,0x15,0x00,0xf4,0xe9,0xbf,0xa9,
-0x3e,0x90,0x0f,0x8f,0xac,0x84,0xbf,0xe1,0x00,0xff,0xf7,0x06,0xfe,0xe2,0x00,0x00,
-0x0e,0x89,0xff,0xa7,0xe0,0x04,0x66,0xf8,0xbb,0x52,0x8f,0x21,0xbf,0xff,0x9f,0xcd,
-0x06,0xf4,0x0a,0xf5,0xe8,0x4d,0x62,0x8f,0x31,0x1f,0x4e,0x70,0xbf,0x26,0xf0,0x06,
-0xf0,0xe7,0x01,0xa8,0xbf,0x00,0x89,0x0e,0x70,0x00,0xee,0x90,0x0c,0x04,0xf4,0x3d,
-0xa8,0xd7,0x50,0x01,0xf6,0x01,0xef,0x8d,0xfc,0x00,0x1f,0x60,0x29,0xdb,0xed,0x70,
-0x01,0xf6,0x05,0xdf,0xcd,0xec,0xef,0xff,0xf6,0x03,0xf3,0x6f,0x16,0x78,0xfb,0x30,
-0x8e,0x9d,0xd5,0x47,0x1f,0x60,0x0c,0xcf,0xec,0x97,0xf2,0xf6,0x00,0x33,0xea,0x32,
-0x1f,0x7f,0x60,0x0c,0xff,0xff,0x80,0x94,0xf6,0x00,0x00,0xda,0x56,0x00,0x1f,0x60,
-0x5f,0xff,0xff,0xd1,0x68,0xf6,0x02,0x65,0x31,0x00,0x08,0xfc,0x0b,0x08,0x81,0x94,
-0x00,0x7d,0x00,0xe6,0x00,0x09,0xf6,0x19,0x04,0xf0,0x13,0x16,0x03,0xaa,0xfc,0xaa,
-0x10,0x9f,0xf4,0x4f,0xba,0xac,0xf1,0x00,0x1f,0x44,0xf8,0x77,0xaf,0x10,0x01,0xf5,
-0x4f,0x87,0x7a,0xf1,0x00,0xaf,0xe9,0xba,0x99,0xab,0x31,0x6d,0x13,0xc8,0x0a,0xf1,
-0x09,0x33,0x64,0x44,0x56,0x7f,0xb6,0x50,0x8d,0xdf,0xdd,0xdd,0xfe,0xdd,0x10,0x01,
-0xdd,0x14,0x5f,0x70,0x00,0x00,0x01,0x50,0x8f,0xbc,0x0b,0x01,0xd7,0x1f,0x04,0x81,
-0x15,0x01,0x0d,0x00,0xf0,0x0c,0x09,0xd2,0x1f,0x90,0xad,0x00,0x00,0xde,0x01,0xf9,
-0x07,0xf5,0x00,0x1f,0xa0,0x1f,0x90,0x1f,0xd0,0x07,0xf5,0x01,0xf9,0x00,0x9f,0x30,
-0xee,0xf0,0x30,0x81,0xf9,0x2c,0x60,0x01,0xf9,0x00,0x0f,0xc0,0x34,0x00,0x51,0x20,
-0x00,0x04,0x8a,0xf8,0xad,0x06,0x08,0x02,0x02,0x11,0xdf,0x0b,0x2b,0xc0,0x0d,0xe8,
-0x88,0x88,0x8f,0x80,0x00,0xdc,0x00,0x00,0x01,0xf8,0xc9,0x12,0x00,0xce,0x0a,0x52,
-0xee,0x88,0x88,0x89,0xf8,0xcc,0x03,0x30,0x80,0x01,0xf9,0x03,0x05,0x00,0x39,0x31,
-0x11,0xed,0xf1,0x35,0x20,0x06,0xf9,0x5f,0x44,0xc0,0x00,0x0c,0xf9,0x00,0x5f,0xa0,
-0x00,0x00,0x1c,0xfe,0x53,0xd2,0x4b,0x02,0x14,0xd2,0x54,0x02,0x02,0x92,0x06,0x70,
-0x7f,0x54,0x44,0x44,0x4f,0xa0,0x07,0xbf,0x29,0x12,0xfa,0x87,0x22,0xf0,0x21,0xa0,
-0x08,0xf2,0x35,0x8c,0xfd,0x10,0x00,0x8f,0x6f,0xdf,0xc4,0x12,0x00,0x09,0xf1,0x46,
-0xfe,0xef,0xf2,0x00,0xae,0x7f,0xdf,0xc6,0x43,0x40,0x0c,0xc2,0x46,0xfe,0xdf,0xff,
-0x10,0xf9,0xcf,0xef,0xd7,0x53,0x60,0x5f,0x52,0x10,0xdd,0x66,0x8f,0x46,0xe0,0x63,
-0x39,0x14,0xb0,0xaa,0x00,0x02,0x82,0x12,0x00,0x5b,0x16,0x41,0x8f,0x30,0x00,0xf7,
-0x38,0x25,0x11,0x0f,0x72,0x0a,0x30,0x01,0xfa,0x44,0x6e,0x2b,0x10,0x2f,0x0c,0x10,
-0xf1,0x19,0xe2,0x03,0xf8,0x55,0x55,0x55,0x9f,0x10,0x5f,0x2e,0xff,0xff,0x27,0xf1,
-0x09,0xf0,0xea,0x47,0xf2,0x8f,0x00,0xea,0x0e,0xa4,0x7f,0x2a,0xe0,0x6f,0x30,0xef,
-0xff,0xf8,0xec,0x00,0x60,0x06,0x30,0x04,0xfe,0x50,0xa3,0x00,0x11,0xfc,0xa3,0x00,
-0x21,0x4e,0xc0,0xa3,0x00,0x12,0xec,0xa3,0x00,0x10,0xc0,0xc9,0x2d,0xf1,0x09,0x2e,
-0x60,0x00,0x7f,0x8e,0xfd,0xde,0xfe,0xc0,0x08,0xf3,0x6f,0xb6,0xbf,0x75,0x00,0x9e,
-0x00,0xe9,0x07,0xf1,0x00,0x0b,0xdd,0xd7,0x04,0xf1,0x01,0xfa,0x39,0xf7,0x4a,0xf5,
-0x41,0x6f,0x56,0xfd,0x00,0x7f,0x10,0x05,0xc0,0x7b,0x10,0x7e,0x31,0x0c,0xf8,0x00,
-0x12,0x4e,0xf8,0x00,0x15,0xea,0xf8,0x00,0x42,0x3f,0x71,0x8e,0x11,0xe9,0x27,0xa0,
-0xc0,0x0a,0xf1,0x4f,0x72,0x9e,0x22,0x00,0xbe,0xef,0x0c,0x18,0xf4,0x0b,0x0d,0xb5,
-0xfa,0x5d,0xd6,0xea,0x21,0xf8,0x0e,0x70,0x3f,0xfd,0x30,0x8f,0x33,0xfd,0xcc,0x6f,
-0xe9,0x27,0xc0,0x4f,0xb7,0x30,0x3a,0xe1,0xe7,0x13,0x00,0xce,0x34,0x42,0xa9,0x00,
-0x6f,0xff,0xf9,0x0c,0x22,0x03,0xf8,0xda,0x25,0x01,0x1e,0x05,0x0f,0x0d,0x00,0x05,
-0x66,0x18,0x88,0x89,0xfc,0x88,0x88,0x1a,0x08,0x09,0x0c,0x17,0x12,0xf1,0x13,0x1c,
-0x15,0x00,0xbd,0x16,0x20,0x18,0x8a,0x02,0x08,0x13,0x10,0x32,0x27,0x81,0x0d,0xf5,
-0x55,0x55,0x55,0x00,0x03,0xfe,0xd0,0x13,0x80,0x9f,0x21,0x1d,0xc1,0x11,0x00,0x3f,
-0x90,0x7f,0x36,0xe1,0x1d,0xe1,0x00,0x0d,0xb0,0x00,0x08,0xf3,0x67,0x77,0xed,0x77,
-0x73,0x04,0xf1,0x1c,0x14,0x60,0x55,0x00,0x10,0xc7,0xa7,0x26,0x62,0x05,0x6d,0xf6,
-0x68,0xfb,0x63,0xe4,0x1b,0x72,0x90,0x01,0x55,0x5d,0xf5,0x55,0x50,0x76,0x1b,0x82,
-0x00,0x25,0x55,0xaf,0x85,0x55,0x55,0x06,0xad,0x06,0x10,0x01,0x4d,0x05,0x12,0x41,
-0x3f,0x26,0xf1,0x01,0x10,0x1c,0xfa,0x22,0x6f,0x72,0x20,0x07,0xfe,0x77,0x79,0xfa,
-0x77,0x71,0x05,0x6f,0xac,0x07,0x11,0x9f,0x34,0x00,0x10,0x58,0xd2,0x07,0x03,0xc2,
-0x38,0x20,0x08,0x40,0x06,0x00,0x21,0x1f,0x80,0x06,0x00,0x01,0x1e,0x00,0x61,0x1f,
-0xc8,0x88,0x88,0x76,0x00,0xa1,0x06,0x11,0x30,0x06,0x00,0x30,0xe9,0x0f,0x90,0x00,
-0x2e,0xc4,0x0e,0xe9,0x99,0x99,0x9d,0xf3,0x04,0xce,0xff,0xff,0xfd,0x60,0x96,0x01,
-0xf3,0x09,0xea,0x61,0x17,0xec,0x00,0x00,0x04,0xcf,0xff,0xfa,0x10,0x00,0x6c,0xff,
-0xfc,0x9e,0xfb,0x30,0x01,0xa7,0x6f,0x90,0x05,0xa0,0x7c,0x13,0xc2,0x06,0x6b,0xf9,
-0xab,0x66,0x66,0x30,0x04,0xfe,0x3b,0xe2,0x22,0x42,0x25,0xc0,0xf7,0x03,0xfb,0xf9,
-0x2b,0xe2,0x3f,0x70,0x02,0x0f,0x80,0x9d,0xc0,0x1b,0xf0,0x1f,0xf8,0x09,0xd6,0xff,
-0x40,0x00,0x07,0x30,0x9d,0x15,0x30,0x00,0x00,0x4f,0x3f,0x2c,0x99,0xb0,0x00,0x58,
-0xf8,0xf7,0xdb,0xcd,0x52,0x1d,0xef,0xdf,0xdf,0xee,0xfd,0x60,0x1c,0xb2,0xf7,0xd9,
-0x9d,0x75,0x0a,0xd2,0x2c,0xcc,0x75,0xee,0x50,0xbc,0x65,0x35,0xf0,0x06,0xb4,0x0e,
-0xa4,0x45,0xc8,0x44,0x5f,0x60,0xde,0xdd,0xef,0xed,0xde,0xf5,0x00,0xae,0x56,0xf9,
-0x59,0xf2,0x00,0x20,0x1d,0xf2,0x0e,0x5f,0x20,0x00,0xad,0x01,0xf6,0xcf,0xf1,0x00,
-0x03,0x40,0x1f,0x64,0x62,0x00,0x00,0x89,0x03,0xf5,0x08,0xa1,0x00,0x29,0xf4,0x5f,
-0x73,0xfb,0x20,0x0f,0x41,0x0d,0x00,0xc1,0x02,0x40,0x57,0xf3,0x0f,0x6e,0x01,0x13,
-0xf1,0x05,0x30,0x00,0xeb,0x44,0x4a,0xf1,0x00,0x00,0x0b,0xcd,0xfe,0xcc,0x10,0x00,
-0x16,0x66,0x7f,0xb6,0x66,0x30,0xcf,0x28,0x00,0x01,0x49,0xf0,0x05,0x1f,0x80,0x1f,
-0x70,0x02,0xf6,0x01,0xf8,0x9e,0xf6,0x00,0x05,0x20,0x1f,0x83,0x75,0x00,0x00,0x9a,
-0x04,0x6d,0x02,0xf0,0x28,0x09,0xa0,0x4f,0x82,0x22,0xda,0x16,0xbd,0x65,0xf9,0xaa,
-0x9d,0xa3,0xff,0xff,0x7f,0x86,0x66,0xda,0x3e,0x9a,0xd7,0xf9,0xee,0xcd,0xa3,0xe9,
-0xad,0x48,0x76,0x66,0x84,0x3e,0x9a,0xd3,0xdf,0xdd,0xef,0x53,0xe9,0xae,0x3d,0xea,
-0xaa,0xf5,0x3e,0x9e,0xf1,0xdd,0x66,0x7f,0x51,0x69,0xb2,0x0d,0x99,0x1a,0xc0,0x9a,
-0x00,0xdd,0x33,0x5f,0x50,0x09,0xa0,0x0d,0xfe,0xef,0xf5,0xe7,0x48,0x11,0xe8,0xe3,
-0x08,0xf0,0x14,0x0e,0xff,0xf5,0x16,0xbd,0x61,0x00,0xea,0x55,0x23,0xff,0xff,0x4e,
-0xef,0xfe,0xe1,0x3e,0x8c,0xd4,0xf9,0x55,0x9f,0x13,0xe8,0xcd,0x4f,0xff,0xff,0xf1,
-0x3e,0x8c,0xd4,0xf8,0x44,0x8f,0x0d,0x00,0xf5,0x0d,0xed,0xde,0xf1,0x3e,0x8d,0xf3,
-0xf9,0x55,0x9f,0x12,0x98,0xc5,0x0e,0xed,0xde,0xd1,0x00,0x8c,0x03,0xce,0x15,0xf7,
-0x00,0x08,0xc1,0xc9,0x20,0x05,0x77,0x09,0x20,0x8a,0x03,0x8f,0x05,0xf3,0x38,0x08,
-0xa0,0x03,0x33,0x33,0x31,0x16,0xbc,0x61,0x25,0x55,0x55,0x03,0xff,0xff,0x36,0xfc,
-0xce,0xf0,0x3e,0x8a,0xd3,0x6e,0x55,0x9f,0x03,0xe8,0xad,0x33,0x99,0x99,0x80,0x3e,
-0x8a,0xd7,0xdd,0xdd,0xdd,0x53,0xe8,0xad,0x7f,0x9a,0xd5,0xf6,0x3e,0x8e,0xf6,0xf9,
-0x9d,0x5f,0x62,0x98,0xb5,0x4f,0xee,0xfd,0xf6,0x00,0x8a,0x03,0xf8,0x9d,0x4f,0x60,
-0x08,0xa0,0x3f,0xfe,0xee,0xf6,0xaa,0x0c,0xf2,0x19,0xbb,0xcf,0xdb,0xbf,0xeb,0xb5,
-0x00,0x68,0xc9,0x77,0xca,0x71,0x00,0x0c,0xc6,0x66,0x66,0xaf,0x30,0x00,0xcf,0xdd,
-0xdd,0xde,0xf3,0x00,0x0c,0xd9,0x99,0x99,0xbf,0x30,0x04,0x78,0xdf,0x88,0x88,0x85,
-0x22,0xff,0xdc,0x01,0x70,0xcf,0xa3,0xb6,0x5f,0xe7,0x03,0xfd,0xf3,0x09,0xc1,0xf8,
-0x02,0x1f,0x61,0xf5,0x1e,0x91,0x00,0x01,0xf6,0x1f,0x5b,0x8a,0x19,0x17,0x31,0x52,
-0x37,0x01,0x71,0x03,0xf4,0x12,0x03,0x78,0x78,0xfc,0x78,0x76,0x00,0x06,0xe1,0x1f,
-0x80,0x9e,0x20,0x00,0x3f,0x71,0xf8,0x0f,0xb0,0x00,0x00,0xc7,0x1f,0x83,0xd3,0x00,
-0x19,0x99,0x9a,0xfd,0x99,0x99,0x62,0x85,0x07,0x12,0x01,0x7e,0x03,0x02,0xbc,0x18,
-0x09,0x0d,0x00,0x02,0x29,0x23,0xfa,0x3f,0x80,0x4f,0x30,0xd2,0x00,0x00,0xd5,0x43,
-0xf4,0x7b,0x57,0x00,0x7b,0x6d,0x3f,0x8f,0x8e,0x50,0x0e,0xff,0x52,0xf9,0xbf,0xa6,
-0x00,0x4e,0x7d,0x7e,0xac,0xea,0xf3,0x0c,0xff,0xdd,0xbc,0xcf,0xab,0x50,0x68,0xf9,
-0x6b,0xf5,0xce,0x53,0x2e,0xff,0xfe,0xff,0xff,0xfe,0x90,0x08,0xf5,0x00,0xea,0x9d,
-0x00,0x00,0xed,0xfa,0x07,0xff,0x44,0x40,0xbf,0x23,0x7a,0xff,0xf9,0xcb,0x1d,0x60,
-0x0a,0xd5,0x09,0xee,0x30,0x00,0x98,0x19,0x00,0xf5,0x34,0x80,0x07,0xee,0xee,0xff,
-0xee,0xee,0x60,0x7f,0xd6,0x3b,0xf1,0x0e,0x84,0x07,0xf0,0xdd,0xdd,0xdd,0xc2,0x00,
-0x8f,0x05,0x77,0x5a,0xfb,0x00,0x08,0xf0,0x0c,0xfa,0xf9,0x00,0x00,0x9f,0x34,0x5c,
-0xff,0x64,0x40,0x0a,0xd9,0x64,0x02,0xf9,0x07,0xcb,0x00,0x01,0xf7,0x1e,0x90,0x0f,
-0x80,0x00,0x1f,0x71,0x80,0x06,0xf4,0x01,0x67,0xf7,0x00,0x00,0x4c,0x00,0x1f,0x1a,
-0x08,0x16,0x01,0x5b,0x00,0x02,0xba,0x0e,0xe0,0x8f,0x77,0xa8,0x77,0xa8,0x73,0x08,
-0xf3,0x4f,0x94,0x5f,0x94,0x10,0x8f,0xca,0x04,0xa0,0xf5,0x09,0xf0,0x0f,0x81,0x3f,
-0x70,0x00,0x9f,0x00,0x91,0x02,0xf6,0x17,0x0a,0xd3,0x46,0x66,0x66,0x50,0x00,0xcc,
-0x8e,0xfe,0xee,0xff,0x60,0x0f,0x90,0x5f,0xb3,0x9f,0x90,0x03,0xf6,0x24,0xaf,0xff,
-0xd4,0x20,0x7f,0x2e,0xfd,0x97,0xbf,0xff,0x50,0x20,0x20,0x00,0x00,0x02,0x06,0x3a,
-0x00,0x67,0x06,0x12,0x0d,0x5b,0x00,0xf7,0x32,0xea,0x57,0x95,0x56,0x85,0x52,0x0e,
-0xba,0x6e,0x5b,0x4f,0x10,0x00,0xe9,0xf9,0xfd,0x78,0xf6,0x52,0x0e,0x99,0xaf,0xb7,
-0xdf,0xef,0x60,0xfa,0xe8,0x89,0xff,0xb7,0xd0,0x0f,0x9d,0xbf,0x7f,0x8f,0xc9,0x01,
-0xf8,0xda,0x57,0xe0,0xcf,0x30,0x5f,0x5d,0xbf,0x7e,0x0c,0xf2,0x09,0xe3,0xd5,0x15,
-0xea,0xed,0xd2,0x69,0x3d,0x05,0xeb,0xe2,0x1c,0x50,0x84,0x0c,0xd1,0x76,0x07,0xff,
-0xf5,0x9c,0xef,0xff,0xc1,0x25,0xcf,0x08,0xa8,0xce,0x0f,0x0d,0xf2,0x30,0x09,0xe0,
-0x00,0x06,0xf3,0x03,0x70,0x9e,0x00,0x00,0xdf,0x64,0x7e,0x09,0xfd,0xd4,0x3f,0xff,
-0xb7,0xe0,0x9f,0x99,0x30,0x50,0xe8,0x7e,0x09,0xe0,0x00,0x1f,0x9f,0x57,0xe0,0x9e,
-0x00,0x00,0x9f,0xf0,0x7f,0xff,0xff,0xf7,0x02,0xff,0x42,0x55,0x55,0x55,0x20,0xbf,
-0xef,0xda,0x97,0x77,0x75,0x5f,0x50,0x5b,0xde,0xff,0xff,0x60,0x20,0x56,0x05,0x20,
-0xff,0x80,0x48,0x22,0x21,0x5a,0xf2,0x99,0x0a,0x80,0xcd,0x25,0x5d,0xc5,0xe9,0x00,
-0x1f,0x7b,0x3e,0x05,0xf0,0x0e,0x07,0xf8,0x36,0x6d,0xc6,0xe8,0x00,0xce,0xf6,0xdd,
-0xff,0xdd,0x70,0x03,0x2f,0x48,0x8e,0xd8,0x85,0x01,0xfa,0xf1,0x77,0xed,0x77,0x40,
-0x09,0xfb,0xaf,0xe3,0x04,0xf2,0x01,0x5f,0xc4,0x44,0xdc,0x44,0x40,0x2e,0xee,0xfb,
-0x88,0x76,0x66,0x25,0xe2,0x17,0xbd,0xa2,0x1f,0x05,0x22,0x1c,0x80,0xff,0x30,0x57,
-0x9f,0xa7,0x7c,0xf7,0x71,0xad,0x14,0x10,0xaf,0x6a,0x00,0x42,0x50,0x0a,0xf0,0x00,
-0x0d,0x00,0x92,0x01,0x88,0xaf,0xb8,0x8d,0xf8,0x85,0x2f,0xff,0xba,0x41,0x40,0x7f,
-0x20,0x0a,0xf0,0xde,0x0b,0x00,0x27,0x00,0x81,0x08,0xf7,0x00,0x0a,0xf0,0x00,0x09,
-0xfc,0x7c,0x19,0x10,0x9b,0x59,0x17,0x0e,0xe1,0x3a,0x30,0xbe,0x3d,0x50,0x65,0x00,
-0x23,0xf0,0x9d,0xdc,0x3b,0x70,0x08,0x88,0x88,0x8c,0xf9,0x88,0x40,0x1f,0x0a,0x10,
-0x20,0xd9,0x0a,0x70,0xf6,0xf3,0x00,0x00,0x58,0xdf,0x88,0xd9,0x07,0x31,0x09,0xe0,
-0x01,0x80,0x35,0xf0,0x15,0x00,0x0d,0xd0,0x65,0x00,0x2b,0xfb,0xe6,0x8f,0x39,0xc0,
-0xef,0xff,0xc8,0x22,0xfe,0xe9,0x06,0x63,0x00,0x00,0x05,0xed,0x20,0x0a,0xff,0xff,
-0xf1,0x07,0xf1,0x04,0x66,0x6a,0xf1,0x07,0xf1,0x5d,0x3d,0x91,0x07,0xf1,0x03,0x77,
-0x7b,0xf1,0x07,0xf1,0x08,0x18,0x00,0xd0,0x0a,0xc0,0x00,0x00,0x07,0xf1,0x0d,0xd7,
-0x77,0x71,0x07,0xf1,0x0e,0xc7,0x2c,0x10,0xf1,0x96,0x20,0x20,0x07,0xf1,0xbc,0x1a,
-0xf0,0x1e,0x07,0xf1,0x00,0x58,0x9f,0xb0,0x07,0xf1,0x00,0x5f,0xfd,0x30,0x07,0xf1,
-0x0f,0xff,0xfe,0x2f,0xff,0xfe,0x00,0x55,0x5c,0xe1,0x55,0x5c,0xe0,0x05,0x77,0xde,
-0x07,0x77,0xde,0x00,0xbf,0xff,0xe0,0xff,0xff,0xe0,0x0c,0xb0,0x00,0x0f,0x70,0x3e,
-0x1b,0xf6,0x1c,0xe3,0xff,0xee,0xe1,0x09,0x86,0xbf,0x1a,0x76,0xbf,0x00,0xcf,0xa9,
-0xf1,0xff,0x88,0xf0,0x00,0x8e,0xee,0x01,0xad,0xef,0x03,0xdf,0xde,0xc4,0xef,0xdd,
-0xe0,0x1a,0x65,0xfa,0x19,0x63,0xdb,0x00,0x04,0xfe,0x30,0x0b,0xff,0x50,0xa7,0x02,
-0xe0,0x07,0x40,0x00,0x04,0xff,0xfe,0x04,0xf6,0x26,0x00,0x16,0x6b,0xe0,0xdb,0xa2,
-0x0e,0xf0,0x06,0x8e,0xaf,0xdd,0xff,0xe0,0x0b,0xbd,0xe8,0xec,0xea,0x7f,0x42,0xff,
-0xfe,0x00,0x0f,0x60,0x20,0x3f,0x20,0x08,0x08,0x1b,0xf0,0x04,0xf7,0x77,0x8d,0x5f,
-0x99,0xf0,0x7f,0xff,0xf8,0xd5,0xf9,0x9f,0x00,0x11,0xae,0x8f,0xff,0xff,0xe0,0x43,
-0x4e,0xf3,0x01,0xf6,0xba,0x00,0x46,0xfa,0x78,0x9f,0xde,0xf3,0x07,0xfe,0x3e,0xfd,
-0xca,0x9e,0x70,0xce,0x0c,0xe1,0xff,0xab,0xff,0x8f,0xff,0x41,0x55,0xea,0xb7,0xc8,
-0xf3,0xf4,0x00,0x0d,0x0d,0x00,0xf0,0x1a,0xcc,0xfa,0x46,0x63,0x66,0x61,0x2f,0xcb,
-0x88,0xff,0xff,0xff,0x22,0xf2,0x00,0x8e,0x7f,0xb9,0xf2,0x3f,0xee,0x98,0xe8,0xfb,
-0xaf,0x21,0x66,0xea,0x8f,0xcf,0xed,0xf2,0x00,0x0e,0x93,0x66,0xfa,0x66,0x00,0x00,
-0xf9,0x62,0x08,0x90,0x07,0x9f,0x55,0x55,0xfa,0x55,0x40,0xcf,0xa0,0x1f,0x16,0x03,
-0x7e,0x16,0x01,0x01,0x00,0x20,0x35,0x01,0xab,0x05,0xf0,0x06,0x2e,0xe1,0x06,0xec,
-0x6f,0xc4,0x5e,0xf2,0x00,0x0d,0x90,0xe9,0x3f,0xe3,0x00,0x00,0xd9,0x0e,0x90,0x61,
-0x04,0x0d,0x00,0xf0,0x0a,0x00,0x0a,0xf3,0x5f,0xff,0xff,0xfd,0x1a,0xf5,0x02,0x6e,
-0xb6,0xec,0x6e,0xf5,0x00,0x00,0xf6,0x0e,0x90,0x52,0x0a,0x50,0x2f,0x40,0x1a,0x00,
-0xfa,0x02,0x07,0xf1,0x0e,0x90,0x2b,0xf5,0x02,0xfb,0x00,0xe9,0x7f,0xf5,0x00,0x2d,
-0x20,0x0e,0x94,0x44,0x1f,0xf0,0x05,0x10,0x00,0xcf,0xee,0xff,0x70,0x1e,0xb0,0x0c,
-0xa0,0x00,0xf7,0x0b,0xf3,0x00,0xcf,0xee,0xef,0x8c,0xf5,0x11,0x0d,0xf0,0x01,0xf9,
-0xc4,0x00,0x01,0x66,0xaf,0x76,0x40,0x0b,0xe1,0x5f,0xff,0xff,0xfe,0x1b,0xf4,0x05,
-0x20,0x90,0x5f,0xe4,0x00,0x09,0xe5,0x58,0xf4,0x61,0x18,0x76,0x07,0xf0,0x05,0x40,
-0x0c,0xf2,0x07,0xb8,0xf7,0x90,0x1b,0xf4,0x02,0xfa,0x9f,0x4f,0x8f,0xf5,0x00,0x06,
-0x5e,0xa0,0x52,0xe9,0x14,0x30,0x6c,0x20,0x06,0x89,0x3a,0x80,0xa0,0x77,0xaf,0x87,
-0x60,0x6f,0xb0,0x1f,0x7d,0x1d,0x20,0x83,0xe5,0x72,0x43,0x30,0x01,0xde,0xdf,0x61,
-0x3f,0xf1,0x00,0xdf,0x95,0x66,0x66,0xce,0x63,0xaf,0xf8,0x47,0x77,0x7c,0xf7,0x34,
-0x5e,0x8a,0xf6,0x11,0xb0,0xe8,0x08,0xa0,0x0a,0xe0,0x00,0x0e,0x80,0x4f,0x70,0xae,
-0x47,0x06,0x30,0x76,0x6d,0xd0,0x25,0x15,0x52,0x2f,0xe7,0x00,0x00,0x23,0xfe,0x03,
-0x10,0xf2,0xf9,0x03,0xf0,0x08,0x1c,0xf4,0x0f,0xb4,0x45,0xf6,0x07,0xf5,0x40,0xfc,
-0x88,0x9f,0x60,0x04,0x6f,0x6f,0xed,0xdd,0xf6,0x00,0x3f,0xd0,0xf8,0xea,0x16,0x10,
-0xf9,0xf9,0x28,0xfa,0x19,0x09,0xff,0x90,0xfb,0xbe,0x57,0x50,0x23,0xe9,0x0f,0x83,
-0xf6,0xde,0x00,0x0e,0x90,0xf8,0x0c,0xfc,0x10,0x00,0xe9,0x0f,0x93,0x6f,0xc1,0x00,
-0x0e,0x94,0xff,0xf6,0x6f,0xe4,0x00,0xe9,0x3d,0x83,0x00,0x4b,0x10,0x51,0x30,0x30,
-0xe0,0x05,0xf6,0x5b,0x13,0xf0,0x02,0x06,0xf8,0x0a,0xb0,0x06,0xf6,0x45,0xff,0xde,
-0xf5,0x00,0x03,0x7f,0x57,0xaf,0xe7,0xd1,0x3e,0x4c,0xf0,0x04,0xc3,0x4f,0xb0,0x1e,
-0xf7,0x9f,0xff,0xff,0xef,0x48,0xff,0x72,0x4e,0xf4,0x33,0x92,0x04,0xf7,0x2c,0x6e,
-0x14,0xb0,0x0f,0x7d,0xef,0x83,0xeb,0x00,0x00,0xf7,0x10,0x5f,0xfd,0xb3,0x38,0xa4,
-0xbf,0xfd,0xfd,0x93,0x00,0xf7,0xcc,0x71,0x04,0xae,0x6c,0x05,0x11,0x26,0x06,0x00,
-0x20,0x1d,0xd3,0x52,0x09,0xf1,0x21,0x2d,0xf2,0x06,0x76,0x86,0x77,0x45,0xe3,0x72,
-0x6f,0x2f,0x78,0xe0,0x01,0x7f,0x4d,0x87,0xe2,0xf6,0x00,0x3f,0xa3,0xf4,0xda,0x7f,
-0x10,0x3f,0xf8,0x0b,0xb5,0xf3,0xdb,0x08,0xff,0x80,0x4f,0x3c,0xb3,0xf4,0x14,0xe8,
-0x06,0x86,0x86,0x58,0x00,0x0e,0x80,0x64,0x22,0x20,0xe8,0x00,0xec,0x35,0x90,0x0e,
-0x85,0x66,0x7f,0xa6,0x65,0x00,0xe8,0xcf,0x09,0x0a,0x03,0x36,0x14,0xf0,0x2f,0x0a,
-0xd0,0x0f,0x90,0x7f,0x00,0x09,0xf5,0x04,0xf5,0x0b,0xc0,0x06,0xf6,0x30,0xaf,0xc3,
-0xfe,0x10,0x03,0x7f,0x8f,0x9d,0xdf,0xde,0x10,0x3f,0xab,0xc0,0x4f,0x61,0xe5,0x4f,
-0xf8,0x02,0x02,0xf4,0x01,0x07,0xef,0x80,0xca,0x2f,0x40,0x00,0x02,0xe8,0x0f,0x92,
-0xff,0xfc,0x00,0x0e,0x81,0xfd,0x2f,0x85,0x40,0x00,0xe8,0x7f,0xfa,0x86,0x2e,0xc4,
-0xae,0x96,0xff,0xb9,0x94,0x00,0xe9,0xa1,0x03,0x8b,0xcc,0x30,0x05,0x01,0x70,0xe1,
-0x5f,0x30,0x00,0x00,0x08,0xf6,0xa8,0x09,0x30,0x36,0xf8,0x27,0x73,0x09,0x30,0x16,
-0x6f,0xef,0xec,0x0b,0xf4,0x25,0x1e,0xd0,0x8f,0x55,0x5f,0x80,0x1d,0xf8,0x07,0xfb,
-0xbb,0xf8,0x09,0xff,0x80,0x7f,0xbb,0xbf,0x80,0x25,0xe8,0x01,0xbf,0x65,0x51,0x00,
-0x0e,0x80,0x9f,0xfe,0xff,0x50,0x00,0xe8,0x8e,0xcd,0x6e,0xb0,0x00,0x0e,0x83,0x7a,
-0xff,0xf9,0x62,0x00,0xe8,0x8c,0x84,0x27,0xbd,0x20,0xb1,0x04,0xf1,0x05,0xa0,0x13,
-0x57,0xad,0x40,0x07,0xf4,0x7f,0xfe,0xff,0x74,0x06,0xf8,0x07,0xe0,0x0a,0xd0,0x00,
-0x27,0x8e,0xc5,0x39,0xfb,0x23,0x4f,0x87,0xf4,0x4d,0xc4,0x42,0x4f,0xf4,0x7e,0x6a,
-0xee,0xaa,0x06,0xef,0x48,0xd8,0xd7,0x7c,0xe0,0x03,0xf4,0x9d,0x8f,0xff,0xfe,0x00,
-0x1f,0x4a,0xc8,0xd6,0x6c,0xe0,0x01,0xf4,0xda,0x8e,0x99,0xde,0x00,0x1f,0x5f,0x88,
-0xfc,0xce,0xe0,0x01,0xf5,0xc4,0x8d,0x55,0x0e,0x3e,0xf9,0x40,0x1e,0x60,0xbb,0x00,
-0xb7,0x00,0x0c,0xe4,0xbb,0xba,0x5f,0x60,0x08,0xe5,0x4b,0xbb,0xa7,0xfa,0x84,0x13,
-0xde,0xff,0xff,0xcf,0xcf,0x70,0x7f,0x54,0x44,0x4e,0xe4,0xf0,0x4f,0xf7,0xff,0xff,
-0xff,0x7d,0x09,0xff,0x47,0x88,0x74,0xed,0xb0,0x16,0xf2,0xef,0xfe,0x0a,0xf6,0x00,
-0x3f,0x2f,0x54,0xf6,0x6f,0x10,0x03,0xf3,0xf3,0x8f,0xcd,0xf8,0x00,0x3f,0x9e,0x06,
-0x7c,0xd7,0xf6,0x03,0xf5,0x60,0x01,0xc1,0x08,0x30,0x00,0xe3,0x0e,0x10,0xb1,0xde,
-0x13,0x20,0x03,0xf8,0x8e,0x05,0x91,0x83,0xfb,0x02,0x55,0xaf,0x55,0x51,0x5c,0x4e,
-0x6e,0x36,0xf1,0x07,0x1d,0xd3,0xf1,0xf1,0xe1,0xf1,0x09,0xf8,0x2f,0xdf,0xdf,0xdf,
-0x17,0xff,0x72,0x66,0x66,0x66,0x62,0x4b,0xf7,0xcf,0x69,0x17,0xf0,0x09,0x74,0x34,
-0x8e,0x14,0x50,0x00,0xf7,0xba,0xf5,0x94,0x8e,0x10,0x0f,0xbf,0x4f,0x84,0xba,0xe7,
-0x00,0xf8,0x50,0x8c,0xdb,0x32,0x50,0x00,0x12,0x10,0xf4,0x1d,0x11,0x40,0x70,0x06,
-0x20,0xdf,0x60,0x06,0x00,0xf1,0x22,0x11,0xc8,0x00,0x00,0x02,0x41,0xf8,0x00,0x01,
+0xca,0xcd,0xa8,0x00,0x00,0xad,0x77,0x77,0x7e,0xb0,0x00,0x0a,0xfc,0xcc,0xcc,0xfb,
+0x00,0x00,0xae,0x99,0x99,0x9e,0xb0,0x00,0x0a,0xfe,0xee,0xee,0xfb,0x00,0x00,0x07,
+0xf6,0x1f,0x8d,0xf5,0x01,0x5a,0xfb,0x00,0xf8,0x18,0xd7,0x3f,0xc6,0x00,0x0b,0xff,
+0xfe,0x60,0x01,0x23,0xfa,0x00,0xfa,0x03,0x71,0x17,0x77,0x77,0x77,0xfd,0x77,0x42,
+0xbc,0x00,0x13,0xf9,0x1a,0x00,0x21,0x07,0xc1,0x14,0x04,0x21,0x4f,0xb0,0x27,0x00,
+0x30,0x8f,0x60,0x0f,0x65,0x02,0x16,0xa2,0x34,0x00,0x51,0x00,0x00,0x08,0xab,0xf9,
+0xf9,0x03,0x19,0xfc,0xb3,0x01,0xfc,0x3a,0x07,0xf0,0x04,0xaa,0xaa,0x60,0x00,0x7f,
+0x00,0x5b,0xbb,0xfa,0x44,0x4a,0xf5,0x20,0x70,0x0f,0x7e,0xff,0xff,0xf6,0x3f,0x84,
+0xf4,0x22,0x29,0xf3,0x10,0x7f,0xdf,0x05,0x70,0x7f,0x00,0x00,0xbf,0xa0,0x7f,0x27,
+0xf0,0x00,0x08,0xfb,0x00,0xea,0x7f,0x00,0x02,0xfe,0xf6,0x07,0x77,0xf0,0x02,0xee,
+0x1c,0x90,0x00,0x7f,0x00,0x4f,0x40,0x10,0x03,0x8d,0xf0,0x00,0x10,0x00,0x00,0x2f,
+0xe8,0x64,0x02,0xf8,0x3c,0xda,0x00,0x00,0x2f,0x50,0x05,0xbf,0xdb,0x20,0x02,0xf5,
+0x00,0x7f,0x68,0xf6,0x66,0x8f,0x94,0x07,0xfe,0xff,0x9f,0xff,0xff,0x90,0x7f,0x47,
+0xf3,0x00,0x2f,0x50,0x07,0xff,0xff,0x4d,0x42,0xf5,0x01,0x9f,0x46,0xf3,0xbc,0x2f,
+0x50,0x5f,0xff,0xff,0x34,0xf5,0xf5,0x00,0x14,0xfc,0xf3,0x07,0x3f,0x50,0x04,0xeb,
+0x3f,0x30,0x02,0xf5,0x05,0xfa,0x36,0xf3,0x07,0x9f,0x40,0x04,0x06,0xfc,0x00,0xde,
+0x64,0x04,0xf0,0x23,0x40,0x00,0x00,0xf4,0xe7,0x00,0x9f,0x70,0x00,0x0f,0x4e,0x70,
+0x7f,0xff,0xfe,0x00,0xf4,0xe9,0xbf,0xa9,0x3e,0x90,0x0f,0x8f,0xac,0x84,0xbf,0xe1,
+0x00,0xff,0xf7,0x06,0xfe,0xe2,0x00,0x00,0x0e,0x89,0xff,0xa7,0xe0,0x04,0x66,0xf8,
+0xbb,0x52,0x8f,0x21,0xbf,0xff,0x02,0x04,0xf4,0x0b,0x70,0xf5,0xe8,0x4d,0x62,0x8f,
+0x31,0x1f,0x4e,0x70,0xbf,0x26,0xf0,0x06,0xf0,0xe7,0x01,0xa8,0xbf,0x00,0x89,0x0e,
+0x70,0x00,0xee,0x90,0x0c,0x04,0xf3,0x3e,0xa8,0xd7,0x50,0x01,0xf6,0x01,0xef,0x8d,
+0xfc,0x00,0x1f,0x60,0x29,0xdb,0xed,0x70,0x01,0xf6,0x05,0xdf,0xcd,0xec,0xef,0xff,
+0xf6,0x03,0xf3,0x6f,0x16,0x78,0xfb,0x30,0x8e,0x9d,0xd5,0x47,0x1f,0x60,0x0c,0xcf,
+0xec,0x97,0xf2,0xf6,0x00,0x33,0xea,0x32,0x1f,0x7f,0x60,0x0c,0xff,0xff,0x80,0x94,
+0xf6,0x00,0x00,0xda,0x56,0x00,0x1f,0x60,0x5f,0xff,0xff,0xd1,0x68,0xf6,0x02,0x65,
+0x31,0x00,0x08,0xfc,0x10,0x55,0x00,0x81,0x94,0x00,0x7d,0x00,0xe6,0x00,0x09,0xf6,
+0x19,0x04,0xf0,0x31,0x16,0x03,0xaa,0xfc,0xaa,0x10,0x9f,0xf4,0x4f,0xba,0xac,0xf1,
+0x00,0x1f,0x44,0xf8,0x77,0xaf,0x10,0x01,0xf5,0x4f,0x87,0x7a,0xf1,0x00,0xaf,0xe9,
+0xba,0x99,0xab,0x31,0x6d,0x13,0xbf,0xff,0xff,0xff,0x33,0x64,0x44,0x56,0x7f,0xb6,
+0x50,0x8d,0xdf,0xdd,0xdd,0xfe,0xdd,0x10,0x01,0xdd,0x14,0x5f,0x70,0x00,0x00,0x01,
+0x50,0x8f,0xd3,0x00,0x02,0x06,0x02,0xe2,0x05,0x25,0x1f,0x90,0x0d,0x00,0xf1,0x18,
+0x09,0xd2,0x1f,0x90,0xad,0x00,0x00,0xde,0x01,0xf9,0x07,0xf5,0x00,0x1f,0xa0,0x1f,
+0x90,0x1f,0xd0,0x07,0xf5,0x01,0xf9,0x00,0x9f,0x30,0xee,0x00,0x1f,0x90,0x04,0xf9,
+0x2c,0x60,0x01,0xf9,0x00,0x0f,0xc0,0x34,0x00,0x51,0x20,0x00,0x04,0x8a,0xf8,0xad,
+0x06,0x08,0x02,0x02,0xf0,0x05,0xdf,0xff,0xff,0xff,0xf8,0x00,0x0d,0xe8,0x88,0x88,
+0x8f,0x80,0x00,0xdc,0x00,0x00,0x01,0xf8,0x00,0x0d,0x30,0x00,0x72,0x80,0x00,0xee,
+0x88,0x88,0x89,0xf8,0xcc,0x03,0x31,0x80,0x01,0xf9,0x03,0x05,0xf0,0x0c,0x2f,0x70,
+0x00,0xed,0x00,0x00,0x06,0xf4,0x00,0x06,0xf9,0x00,0x00,0xcf,0x10,0x00,0x0c,0xf9,
+0x00,0x5f,0xa0,0x00,0x00,0x1c,0xfe,0x53,0xd2,0x4b,0x02,0x14,0xd2,0x54,0x02,0x02,
+0x92,0x06,0xe1,0x7f,0x54,0x44,0x44,0x4f,0xa0,0x07,0xf5,0x44,0x44,0x44,0xfa,0x00,
+0x7f,0x3c,0x03,0xf4,0x25,0x08,0xf2,0x35,0x8c,0xfd,0x10,0x00,0x8f,0x6f,0xdf,0xc4,
+0x12,0x00,0x09,0xf1,0x46,0xfe,0xef,0xf2,0x00,0xae,0x7f,0xdf,0xc6,0x43,0x40,0x0c,
+0xc2,0x46,0xfe,0xdf,0xff,0x10,0xf9,0xcf,0xef,0xd7,0x53,0x60,0x5f,0x52,0x10,0xdd,
+0x66,0x8f,0x46,0xe0,0x00,0x06,0xef,0xff,0xb0,0xaa,0x00,0x01,0x4c,0x05,0xd2,0x00,
+0x0f,0xa4,0x44,0x44,0x8f,0x30,0x00,0xf7,0x00,0x00,0x05,0xf3,0x9d,0x00,0xf1,0x26,
+0x30,0x01,0xfa,0x44,0x44,0x44,0x41,0x00,0x2f,0xfe,0xee,0xee,0xee,0xe2,0x03,0xf8,
+0x55,0x55,0x55,0x9f,0x10,0x5f,0x2e,0xff,0xff,0x27,0xf1,0x09,0xf0,0xea,0x47,0xf2,
+0x8f,0x00,0xea,0x0e,0xa4,0x7f,0x2a,0xe0,0x6f,0x30,0xef,0xff,0xf8,0xec,0x00,0x60,
+0x06,0x30,0x04,0xfe,0x50,0xa3,0x00,0x11,0xfc,0xa3,0x00,0x21,0x4e,0xc0,0xa3,0x00,
+0x12,0xec,0xa3,0x00,0xf1,0x0e,0xc0,0x07,0xf1,0x4f,0x30,0x2e,0x60,0x00,0x7f,0x8e,
+0xfd,0xde,0xfe,0xc0,0x08,0xf3,0x6f,0xb6,0xbf,0x75,0x00,0x9e,0x00,0xe9,0x07,0xf1,
+0x00,0x0b,0xdd,0xd7,0x04,0xfe,0x04,0xfa,0x39,0xf7,0x4a,0xf5,0x41,0x6f,0x56,0xfd,
+0x00,0x7f,0x10,0x05,0xc0,0x7b,0x10,0x07,0xf1,0x00,0xf8,0x00,0x12,0x4e,0xf8,0x00,
+0x15,0xea,0xf8,0x00,0x70,0x3f,0x71,0x8e,0x11,0x00,0x9f,0xbf,0x62,0x00,0xf3,0x18,
+0x0a,0xf1,0x4f,0x72,0x9e,0x22,0x00,0xbe,0xef,0xff,0xff,0xff,0xf5,0x0d,0xb5,0xfa,
+0x5d,0xd6,0xea,0x21,0xf8,0x0e,0x70,0x3f,0xfd,0x30,0x8f,0x33,0xfd,0xcc,0x6f,0xe9,
+0x27,0xc0,0x4f,0xb7,0x30,0x3a,0xe1,0x55,0x00,0x80,0x04,0xaa,0xaa,0xaa,0xaa,0xa9,
+0x00,0x6f,0x48,0x00,0x51,0xe0,0x00,0x00,0x03,0xf8,0x16,0x00,0x11,0x3f,0x1e,0x05,
+0x0f,0x0d,0x00,0x05,0x66,0x18,0x88,0x89,0xfc,0x88,0x88,0x1a,0x08,0x08,0x01,0x00,
+0x12,0x08,0xaf,0x00,0x00,0x66,0x08,0x03,0xa0,0x06,0x20,0x18,0x8a,0x02,0x08,0x31,
+0x10,0x00,0x7f,0x17,0x02,0x80,0x0d,0xf5,0x55,0x55,0x55,0x00,0x03,0xfe,0x17,0x06,
+0xf0,0x0d,0x00,0x9f,0x21,0x1d,0xc1,0x11,0x00,0x3f,0x90,0x00,0xdb,0x00,0x00,0x1d,
+0xe1,0x00,0x0d,0xb0,0x00,0x08,0xf3,0x67,0x77,0xed,0x77,0x73,0x04,0x0c,0x3b,0x00,
+0x14,0x60,0x55,0x00,0xb0,0xc7,0x00,0x0c,0xb0,0x00,0x05,0x6d,0xf6,0x68,0xfb,0x63,
+0x41,0x08,0x00,0xed,0x07,0x71,0x55,0x5d,0xf5,0x55,0x50,0x00,0x3f,0xfc,0x02,0x72,
+0x25,0x55,0xaf,0x85,0x55,0x55,0x06,0xad,0x06,0x30,0x01,0x1c,0xf7,0xaf,0x01,0x10,
+0x0a,0x0d,0x00,0xf1,0x01,0x10,0x1c,0xfa,0x22,0x6f,0x72,0x20,0x07,0xfe,0x77,0x79,
+0xfa,0x77,0x71,0x05,0x6f,0xac,0x07,0x11,0x9f,0x34,0x00,0x10,0x58,0xd2,0x07,0x01,
+0x5d,0x00,0x40,0x9f,0x00,0x08,0x40,0x06,0x00,0x21,0x1f,0x80,0x06,0x00,0x01,0x1e,
+0x00,0x61,0x1f,0xc8,0x88,0x88,0x76,0x00,0xa1,0x06,0x11,0x30,0x06,0x00,0x10,0xe9,
+0xf8,0x08,0xe4,0x02,0xf8,0x0e,0xe9,0x99,0x99,0x9d,0xf3,0x04,0xce,0xff,0xff,0xfd,
+0x60,0x96,0x01,0xf2,0x0a,0xea,0x61,0x17,0xec,0x00,0x00,0x04,0xcf,0xff,0xfa,0x10,
+0x00,0x6c,0xff,0xfc,0x9e,0xfb,0x30,0x01,0xa7,0x6f,0x90,0x05,0xa0,0x01,0xa4,0x08,
+0xe1,0x06,0x6b,0xf9,0xab,0x66,0x66,0x30,0x04,0xfe,0x3b,0xe2,0x22,0x10,0x07,0x13,
+0x00,0xf2,0x67,0x03,0xfb,0xf9,0x2b,0xe2,0x3f,0x70,0x02,0x0f,0x80,0x9d,0x01,0xf7,
+0x00,0x00,0xf8,0x09,0xd6,0xff,0x40,0x00,0x07,0x30,0x9d,0x15,0x30,0x00,0x00,0x4f,
+0x3f,0x2c,0x99,0xb0,0x00,0x58,0xf8,0xf7,0xdb,0xcd,0x52,0x1d,0xef,0xdf,0xdf,0xee,
+0xfd,0x60,0x1c,0xb2,0xf7,0xd9,0x9d,0x75,0x0a,0xd2,0x2c,0xcc,0x75,0xee,0x50,0xbc,
+0xbb,0xbb,0xbb,0xbb,0xb4,0x0e,0xa4,0x45,0xc8,0x44,0x5f,0x60,0xde,0xdd,0xef,0xed,
+0xde,0xf5,0x00,0xae,0x56,0xf9,0x59,0xf2,0x00,0x0a,0xd0,0x1f,0x60,0x5f,0x20,0x00,
+0xad,0x01,0xf6,0xcf,0xf1,0x00,0x03,0x40,0x1f,0x64,0x62,0x00,0x00,0x89,0x03,0xf5,
+0x08,0xa1,0x00,0x29,0xf4,0x5f,0x73,0xfb,0x20,0x37,0x07,0x10,0x30,0xc1,0x02,0xf2,
+0x0e,0x57,0xf3,0x0f,0x6e,0xff,0xff,0xff,0x6f,0x30,0x00,0xeb,0x44,0x4a,0xf1,0x00,
+0x00,0x0b,0xcd,0xfe,0xcc,0x10,0x00,0x16,0x66,0x7f,0xb6,0x66,0x30,0x02,0x5a,0x09,
+0xf0,0x07,0x2f,0x60,0x1f,0x80,0x1f,0x70,0x02,0xf6,0x01,0xf8,0x9e,0xf6,0x00,0x05,
+0x20,0x1f,0x83,0x75,0x00,0x00,0x9a,0x04,0x6d,0x02,0xf1,0x3d,0x09,0xa0,0x4f,0x82,
+0x22,0xda,0x16,0xbd,0x65,0xf9,0xaa,0x9d,0xa3,0xff,0xff,0x7f,0x86,0x66,0xda,0x3e,
+0x9a,0xd7,0xf9,0xee,0xcd,0xa3,0xe9,0xad,0x48,0x76,0x66,0x84,0x3e,0x9a,0xd3,0xdf,
+0xdd,0xef,0x53,0xe9,0xae,0x3d,0xea,0xaa,0xf5,0x3e,0x9e,0xf1,0xdd,0x66,0x7f,0x51,
+0x69,0xb2,0x0d,0xff,0xff,0xf5,0x00,0x9a,0x00,0xdd,0x33,0x5f,0x50,0x09,0xa0,0x0d,
+0xfe,0xef,0xf5,0x00,0x8c,0x00,0x00,0xe8,0xe3,0x08,0xf0,0x14,0x0e,0xff,0xf5,0x16,
+0xbd,0x61,0x00,0xea,0x55,0x23,0xff,0xff,0x4e,0xef,0xfe,0xe1,0x3e,0x8c,0xd4,0xf9,
+0x55,0x9f,0x13,0xe8,0xcd,0x4f,0xff,0xff,0xf1,0x3e,0x8c,0xd4,0xf8,0x44,0x8f,0x0d,
+0x00,0xf5,0x0d,0xed,0xde,0xf1,0x3e,0x8d,0xf3,0xf9,0x55,0x9f,0x12,0x98,0xc5,0x0e,
+0xed,0xde,0xd1,0x00,0x8c,0x03,0xce,0x15,0xf7,0x00,0x08,0xc1,0xc9,0x20,0x05,0x77,
+0x09,0x20,0x8a,0x03,0x8f,0x05,0xf2,0x38,0x08,0xa0,0x03,0x33,0x33,0x31,0x16,0xbc,
+0x61,0x25,0x55,0x55,0x03,0xff,0xff,0x36,0xfc,0xce,0xf0,0x3e,0x8a,0xd3,0x6e,0x55,
+0x9f,0x03,0xe8,0xad,0x33,0x99,0x99,0x80,0x3e,0x8a,0xd7,0xdd,0xdd,0xdd,0x53,0xe8,
+0xad,0x7f,0x9a,0xd5,0xf6,0x3e,0x8e,0xf6,0xf9,0x9d,0x5f,0x62,0x98,0xb5,0x4f,0xee,
+0xfd,0xf6,0x00,0x8a,0x03,0xf8,0x9d,0x4f,0x60,0x08,0xa0,0x3f,0xfe,0xee,0xf6,0xbf,
+0x07,0xf2,0x1a,0x70,0xbb,0xcf,0xdb,0xbf,0xeb,0xb5,0x00,0x68,0xc9,0x77,0xca,0x71,
+0x00,0x0c,0xc6,0x66,0x66,0xaf,0x30,0x00,0xcf,0xdd,0xdd,0xde,0xf3,0x00,0x0c,0xd9,
+0x99,0x99,0xbf,0x30,0x04,0x78,0xdf,0x88,0x88,0x85,0x22,0xff,0xdc,0x01,0x70,0xcf,
+0xa3,0xb6,0x5f,0xe7,0x03,0xfd,0xf3,0x09,0xd0,0xf8,0x02,0x1f,0x61,0xf5,0x1e,0x91,
+0x00,0x01,0xf6,0x1f,0x5b,0xe5,0x9e,0x00,0x16,0x31,0x28,0x03,0x11,0x7f,0x71,0x03,
+0xf4,0x12,0x03,0x78,0x78,0xfc,0x78,0x76,0x00,0x06,0xe1,0x1f,0x80,0x9e,0x20,0x00,
+0x3f,0x71,0xf8,0x0f,0xb0,0x00,0x00,0xc7,0x1f,0x83,0xd3,0x00,0x19,0x99,0x9a,0xfd,
+0x99,0x99,0x62,0x85,0x07,0x12,0x01,0x7e,0x03,0x01,0x8c,0x02,0x0a,0x0d,0x00,0x01,
+0x01,0x00,0xf6,0x3f,0x05,0x80,0x4f,0x30,0xd2,0x00,0x00,0xd5,0x43,0xf4,0x7b,0x57,
+0x00,0x7b,0x6d,0x3f,0x8f,0x8e,0x50,0x0e,0xff,0x52,0xf9,0xbf,0xa6,0x00,0x4e,0x7d,
+0x7e,0xac,0xea,0xf3,0x0c,0xff,0xdd,0xbc,0xcf,0xab,0x50,0x68,0xf9,0x6b,0xf5,0xce,
+0x53,0x2e,0xff,0xfe,0xff,0xff,0xfe,0x90,0x08,0xf5,0x00,0xea,0x9d,0x00,0x00,0xed,
+0xfa,0x07,0xff,0x44,0x40,0xbf,0x23,0x7a,0xff,0xf9,0xcb,0x1d,0x60,0x0a,0xd5,0x09,
+0xee,0x30,0x1e,0x0b,0x01,0x06,0x00,0xf1,0x1e,0x0c,0xe0,0x00,0x00,0x07,0xee,0xee,
+0xff,0xee,0xee,0x60,0x7f,0x88,0x88,0x88,0x88,0x84,0x07,0xf0,0xdd,0xdd,0xdd,0xc2,
+0x00,0x8f,0x05,0x77,0x5a,0xfb,0x00,0x08,0xf0,0x0c,0xfa,0xf9,0x00,0x00,0x9f,0x34,
+0x5c,0xff,0x64,0x40,0x0a,0xd9,0x64,0x02,0xf9,0x07,0xcb,0x00,0x01,0xf7,0x1e,0x90,
+0x0f,0x80,0x00,0x1f,0x71,0x80,0x06,0xf4,0x01,0x67,0xf7,0x00,0x00,0x4c,0x00,0x1f,
+0x1a,0x08,0x16,0x01,0x5b,0x00,0x11,0xff,0xec,0x03,0xe0,0x8f,0x77,0xa8,0x77,0xa8,
+0x73,0x08,0xf3,0x4f,0x94,0x5f,0x94,0x10,0x8f,0xca,0x04,0xa0,0xf5,0x09,0xf0,0x0f,
+0x81,0x3f,0x70,0x00,0x9f,0x00,0x91,0x02,0xf5,0x18,0x0a,0xd3,0x46,0x66,0x66,0x50,
+0x00,0xcc,0x8e,0xfe,0xee,0xff,0x60,0x0f,0x90,0x5f,0xb3,0x9f,0x90,0x03,0xf6,0x24,
+0xaf,0xff,0xd4,0x20,0x7f,0x2e,0xfd,0x97,0xbf,0xff,0x50,0x20,0x20,0x00,0x00,0x02,
+0x40,0x5b,0x00,0x00,0x67,0x06,0x12,0x0d,0x5b,0x00,0xf7,0x32,0xea,0x57,0x95,0x56,
+0x85,0x52,0x0e,0xba,0x6e,0x5b,0x4f,0x10,0x00,0xe9,0xf9,0xfd,0x78,0xf6,0x52,0x0e,
+0x99,0xaf,0xb7,0xdf,0xef,0x60,0xfa,0xe8,0x89,0xff,0xb7,0xd0,0x0f,0x9d,0xbf,0x7f,
+0x8f,0xc9,0x01,0xf8,0xda,0x57,0xe0,0xcf,0x30,0x5f,0x5d,0xbf,0x7e,0x0c,0xf2,0x09,
+0xe3,0xd5,0x15,0xea,0xed,0xd2,0x69,0x3d,0x05,0xeb,0xe2,0x1c,0x50,0x84,0x0c,0xd1,
+0x76,0x07,0xff,0xf5,0x9c,0xef,0xff,0xc1,0x25,0xcf,0x08,0xa8,0xce,0x0f,0x0d,0xf2,
+0x30,0x09,0xe0,0x00,0x06,0xf3,0x03,0x70,0x9e,0x00,0x00,0xdf,0x64,0x7e,0x09,0xfd,
+0xd4,0x3f,0xff,0xb7,0xe0,0x9f,0x99,0x30,0x50,0xe8,0x7e,0x09,0xe0,0x00,0x1f,0x9f,
+0x57,0xe0,0x9e,0x00,0x00,0x9f,0xf0,0x7f,0xff,0xff,0xf7,0x02,0xff,0x42,0x55,0x55,
+0x55,0x20,0xbf,0xef,0xda,0x97,0x77,0x75,0x5f,0x50,0x5b,0xde,0xff,0xff,0x60,0x20,
+0x56,0x05,0x81,0xff,0x80,0x0c,0xa0,0x00,0x01,0x5a,0xf2,0x99,0x0a,0x80,0xcd,0x25,
+0x5d,0xc5,0xe9,0x00,0x1f,0x7b,0x3e,0x05,0xf0,0x0e,0x07,0xf8,0x36,0x6d,0xc6,0xe8,
+0x00,0xce,0xf6,0xdd,0xff,0xdd,0x70,0x03,0x2f,0x48,0x8e,0xd8,0x85,0x01,0xfa,0xf1,
+0x77,0xed,0x77,0x40,0x09,0xfb,0xaf,0xe3,0x04,0xf3,0x04,0x5f,0xc4,0x44,0xdc,0x44,
+0x40,0x2e,0xee,0xfb,0x88,0x76,0x66,0x25,0xe2,0x17,0xbd,0xff,0xff,0xf2,0xac,0x00,
+0x12,0x0b,0xf1,0x03,0xb0,0x57,0x9f,0xa7,0x7c,0xf7,0x71,0x00,0x03,0xf5,0x00,0xaf,
+0x6a,0x00,0x42,0x50,0x0a,0xf0,0x00,0x0d,0x00,0x72,0x01,0x88,0xaf,0xb8,0x8d,0xf8,
+0x85,0x80,0x0d,0x60,0x90,0x00,0x7f,0x20,0x0a,0xf0,0xde,0x0b,0x00,0x27,0x00,0x90,
+0x08,0xf7,0x00,0x0a,0xf0,0x00,0x09,0xfc,0x00,0x0d,0x00,0x20,0x9b,0x00,0x0d,0x00,
+0x0d,0x01,0x00,0x30,0xbe,0x3d,0x50,0x65,0x00,0x22,0xf0,0x9d,0xe9,0x04,0x80,0xf8,
+0x08,0x88,0x88,0x8c,0xf9,0x88,0x40,0x1f,0x0a,0x10,0x20,0xd9,0x0a,0x70,0xf6,0xf3,
+0x00,0x00,0x58,0xdf,0x88,0xd9,0x07,0x21,0x09,0xe0,0x4f,0x08,0xf0,0x14,0x9e,0x00,
+0x0d,0xd0,0x65,0x00,0x2b,0xfb,0xe6,0x8f,0x39,0xc0,0xef,0xff,0xc8,0x22,0xfe,0xe9,
+0x06,0x63,0x00,0x00,0x05,0xed,0x20,0x0a,0xff,0xff,0xf1,0x07,0xf1,0x04,0x66,0x6a,
+0xf1,0xee,0x06,0xb1,0x06,0xf1,0x07,0xf1,0x03,0x77,0x7b,0xf1,0x07,0xf1,0x08,0x18,
+0x00,0xf0,0x01,0x0a,0xc0,0x00,0x00,0x07,0xf1,0x0d,0xd7,0x77,0x71,0x07,0xf1,0x0e,
+0xff,0xff,0xf2,0x24,0x00,0x30,0x08,0xf0,0x07,0xb8,0x04,0xf0,0x1d,0xe0,0x07,0xf1,
+0x00,0x58,0x9f,0xb0,0x07,0xf1,0x00,0x5f,0xfd,0x30,0x07,0xf1,0x0f,0xff,0xfe,0x2f,
+0xff,0xfe,0x00,0x55,0x5c,0xe1,0x55,0x5c,0xe0,0x05,0x77,0xde,0x07,0x77,0xde,0x00,
+0xbf,0xff,0xe0,0xff,0xff,0xe0,0x0c,0xb0,0x00,0x85,0x0c,0xf6,0x1e,0xdf,0xee,0xe3,
+0xff,0xee,0xe1,0x09,0x86,0xbf,0x1a,0x76,0xbf,0x00,0xcf,0xa9,0xf1,0xff,0x88,0xf0,
+0x00,0x8e,0xee,0x01,0xad,0xef,0x03,0xdf,0xde,0xc4,0xef,0xdd,0xe0,0x1a,0x65,0xfa,
+0x19,0x63,0xdb,0x00,0x04,0xfe,0x30,0x0b,0xff,0x50,0xa7,0x02,0xe0,0x07,0x40,0x00,
+0x04,0xff,0xfe,0x04,0xf6,0x26,0x00,0x16,0x6b,0xe0,0xdb,0xa2,0x0e,0xf0,0x1a,0x8e,
+0xaf,0xdd,0xff,0xe0,0x0b,0xbd,0xe8,0xec,0xea,0x7f,0x42,0xff,0xfe,0x00,0x0f,0x60,
+0x20,0x3f,0x20,0x08,0xff,0xff,0xfe,0x05,0xf7,0x77,0x8d,0x5f,0x99,0xf0,0x7f,0xff,
+0xf8,0xd5,0xf9,0x9f,0x00,0x11,0xae,0x8f,0x56,0x07,0xf0,0x0a,0x0b,0xc0,0x00,0xf6,
+0xba,0x00,0x46,0xfa,0x78,0x9f,0xde,0xf3,0x07,0xfe,0x3e,0xfd,0xca,0x9e,0x70,0x00,
+0x00,0x00,0x00,0x00,0x00,0xf1,0x00,0x4f,0xff,0xab,0xff,0x8f,0xff,0x41,0x55,0xea,
+0xb7,0xc8,0xf3,0xf4,0x00,0x0d,0x0d,0x00,0xf0,0x2b,0xcc,0xfa,0x46,0x63,0x66,0x61,
+0x2f,0xcb,0x88,0xff,0xff,0xff,0x22,0xf2,0x00,0x8e,0x7f,0xb9,0xf2,0x3f,0xee,0x98,
+0xe8,0xfb,0xaf,0x21,0x66,0xea,0x8f,0xcf,0xed,0xf2,0x00,0x0e,0x93,0x66,0xfa,0x66,
+0x00,0x00,0xf9,0xff,0xff,0xff,0xfc,0x07,0x9f,0x55,0x55,0xfa,0x55,0x40,0xcf,0xa0,
+0x00,0x0e,0x70,0x00,0x01,0x00,0x22,0x21,0x00,0x01,0x00,0xf0,0x0c,0x35,0x01,0xff,
+0xff,0xff,0xa0,0x2e,0xe1,0x06,0xec,0x6f,0xc4,0x5e,0xf2,0x00,0x0d,0x90,0xe9,0x3f,
+0xe3,0x00,0x00,0xd9,0x0e,0x90,0x61,0x04,0x0d,0x00,0xf0,0x0a,0x00,0x0a,0xf3,0x5f,
+0xff,0xff,0xfd,0x1a,0xf5,0x02,0x6e,0xb6,0xec,0x6e,0xf5,0x00,0x00,0xf6,0x0e,0x90,
+0x52,0x0a,0x50,0x2f,0x40,0x1a,0x00,0xf8,0x04,0x07,0xf1,0x0e,0x90,0x2b,0xf5,0x02,
+0xfb,0x00,0xe9,0x7f,0xf5,0x00,0x2d,0x20,0x0e,0x94,0xb1,0x00,0x01,0x00,0xf1,0x91,
+0x10,0x00,0xcf,0xee,0xff,0x70,0x1e,0xb0,0x0c,0xa0,0x00,0xf7,0x0b,0xf3,0x00,0xcf,
+0xee,0xef,0x8c,0xf5,0x00,0x0c,0xea,0xaa,0xf9,0xc4,0x00,0x01,0x66,0xaf,0x76,0x40,
+0x0b,0xe1,0x5f,0xff,0xff,0xfe,0x1b,0xf4,0x00,0x59,0x99,0x99,0x5f,0xe4,0x00,0x09,
+0xe5,0x58,0xf4,0x61,0x18,0x20,0x9f,0xff,0xff,0x40,0x0c,0xf2,0x07,0xb8,0xf7,0x90,
+0x1b,0xf4,0x02,0xfa,0x9f,0x4f,0x8f,0xf5,0x00,0x06,0x5e,0xa0,0x52,0xb2,0x00,0x00,
+0x00,0x6c,0x20,0x06,0xf1,0x00,0x00,0x5f,0xa0,0x77,0xaf,0x87,0x60,0x6f,0xb0,0x1f,
+0xff,0xff,0xfe,0x02,0x83,0xe5,0x00,0x6f,0x10,0x00,0x01,0xde,0xdf,0xff,0xff,0xff,
+0x81,0xdf,0x95,0x66,0x66,0xce,0x63,0xaf,0xf8,0x47,0x77,0x7c,0xf7,0x34,0x5e,0x8a,
+0xff,0xff,0xff,0xf6,0x00,0xe8,0x08,0xa0,0x0a,0xe0,0x00,0x0e,0x80,0x4f,0x70,0xae,
+0x00,0x00,0xe8,0x00,0x76,0x6d,0xd0,0x00,0x0e,0x80,0x00,0x2f,0xe7,0x00,0x00,0x23,
+0xa5,0x00,0xf9,0x3f,0x0d,0xf2,0xff,0xff,0xff,0x60,0x1c,0xf4,0x0f,0xb4,0x45,0xf6,
+0x07,0xf5,0x40,0xfc,0x88,0x9f,0x60,0x04,0x6f,0x6f,0xed,0xdd,0xf6,0x00,0x3f,0xd0,
+0xf8,0x00,0x1f,0x60,0x3f,0xf9,0x0f,0xff,0xff,0xf6,0x09,0xff,0x90,0xfb,0xbe,0x57,
+0x50,0x23,0xe9,0x0f,0x83,0xf6,0xde,0x00,0x0e,0x90,0xf8,0x0c,0xfc,0x10,0x00,0xe9,
+0x0f,0x93,0x6f,0xc1,0x00,0x0e,0x94,0xff,0xf6,0x6f,0xe4,0x00,0xe9,0x3d,0x83,0x00,
+0x4b,0x10,0x00,0x01,0xf3,0x3f,0x0a,0xe0,0x05,0xf6,0x00,0x00,0x09,0xf4,0x06,0xf8,
+0x0a,0xb0,0x06,0xf6,0x45,0xff,0xde,0xf5,0x00,0x03,0x7f,0x57,0xaf,0xe7,0xd1,0x00,
+0x2f,0xc0,0x8f,0xc3,0x4f,0xb0,0x1e,0xf7,0x9f,0xff,0xff,0xef,0x48,0xff,0x72,0x4e,
+0xf4,0x33,0x92,0x04,0xf7,0x2c,0xff,0xff,0xf4,0x00,0x0f,0x7d,0xef,0x83,0xeb,0x00,
+0x00,0xf7,0x10,0x5f,0xfd,0x00,0x00,0x0f,0x86,0xbf,0xfd,0xfd,0x93,0x00,0xf7,0xcc,
+0x71,0x04,0xae,0x30,0x55,0x00,0x11,0x26,0x06,0x00,0xf0,0x3f,0x1d,0xd3,0xff,0xff,
+0xff,0xfa,0x2d,0xf2,0x06,0x76,0x86,0x77,0x45,0xe3,0x72,0x6f,0x2f,0x78,0xe0,0x01,
+0x7f,0x4d,0x87,0xe2,0xf6,0x00,0x3f,0xa3,0xf4,0xda,0x7f,0x10,0x3f,0xf8,0x0b,0xb5,
+0xf3,0xdb,0x08,0xff,0x80,0x4f,0x3c,0xb3,0xf4,0x14,0xe8,0x06,0x86,0x86,0x58,0x00,
+0x0e,0x80,0xff,0xff,0xff,0xf2,0x00,0xe8,0x00,0x02,0xf6,0x00,0x00,0x0e,0x85,0x66,
+0x7f,0xa6,0x65,0x00,0xe8,0xcf,0xff,0xff,0xff,0xc0,0xac,0x01,0x00,0xb0,0x00,0xf4,
+0x3e,0xd0,0x0f,0x90,0x7f,0x00,0x09,0xf5,0x04,0xf5,0x0b,0xc0,0x06,0xf6,0x30,0xaf,
+0xc3,0xfe,0x10,0x03,0x7f,0x8f,0x9d,0xdf,0xde,0x10,0x3f,0xab,0xc0,0x4f,0x61,0xe5,
+0x4f,0xf8,0x02,0x02,0xf4,0x01,0x07,0xef,0x80,0xca,0x2f,0x40,0x00,0x02,0xe8,0x0f,
+0x92,0xff,0xfc,0x00,0x0e,0x81,0xfd,0x2f,0x85,0x40,0x00,0xe8,0x7f,0xfa,0xf4,0x00,
+0x00,0x0e,0xae,0x96,0xff,0xb9,0x94,0x00,0xe9,0xa1,0x03,0x8b,0xcc,0x30,0x05,0x01,
+0xf3,0x3e,0xe1,0x5f,0x30,0x00,0x00,0x08,0xf6,0x0c,0xff,0xff,0xff,0x36,0xf8,0x27,
+0xf7,0x44,0x44,0x41,0x16,0x6f,0xef,0xff,0xff,0xf8,0x00,0x1e,0xd0,0x8f,0x55,0x5f,
+0x80,0x1d,0xf8,0x07,0xfb,0xbb,0xf8,0x09,0xff,0x80,0x7f,0xbb,0xbf,0x80,0x25,0xe8,
+0x01,0xbf,0x65,0x51,0x00,0x0e,0x80,0x9f,0xfe,0xff,0x50,0x00,0xe8,0x8e,0xcd,0x6e,
+0xb0,0x00,0x0e,0x83,0x7a,0xff,0xf9,0x62,0x00,0xe8,0x8c,0x84,0x27,0xbd,0x20,0x55,
+0x00,0xf0,0x07,0x0b,0xa0,0x13,0x57,0xad,0x40,0x07,0xf4,0x7f,0xfe,0xff,0x74,0x06,
+0xf8,0x07,0xe0,0x0a,0xd0,0x00,0x27,0x8e,0x9f,0xc9,0x02,0xf9,0x25,0x4f,0x87,0xf4,
+0x4d,0xc4,0x42,0x4f,0xf4,0x7e,0x6a,0xee,0xaa,0x06,0xef,0x48,0xd8,0xd7,0x7c,0xe0,
+0x03,0xf4,0x9d,0x8f,0xff,0xfe,0x00,0x1f,0x4a,0xc8,0xd6,0x6c,0xe0,0x01,0xf4,0xda,
+0x8e,0x99,0xde,0x00,0x1f,0x5f,0x88,0xfc,0xce,0xe0,0x01,0xf5,0xc4,0x8d,0x55,0xbe,
+0x00,0x01,0x00,0xf9,0x3f,0x1e,0x60,0xbb,0x00,0xb7,0x00,0x0c,0xe4,0xbb,0xba,0x5f,
+0x60,0x08,0xe5,0x4b,0xbb,0xa7,0xfa,0x84,0x13,0xde,0xff,0xff,0xcf,0xcf,0x70,0x7f,
+0x54,0x44,0x4e,0xe4,0xf0,0x4f,0xf7,0xff,0xff,0xff,0x7d,0x09,0xff,0x47,0x88,0x74,
+0xed,0xb0,0x16,0xf2,0xef,0xfe,0x0a,0xf6,0x00,0x3f,0x2f,0x54,0xf6,0x6f,0x10,0x03,
+0xf3,0xf3,0x8f,0xcd,0xf8,0x00,0x3f,0x9e,0x06,0x7c,0xd7,0xf6,0x03,0xf5,0x60,0x01,
+0xc1,0x08,0x30,0x5b,0x00,0xf0,0x20,0x07,0xb1,0x00,0x6f,0x40,0x00,0x03,0xf8,0xaf,
+0xff,0xff,0xff,0x83,0xfb,0x02,0x55,0xaf,0x55,0x51,0x5c,0x4e,0x6f,0xff,0xff,0xff,
+0x10,0x1d,0xd3,0xf1,0xf1,0xe1,0xf1,0x09,0xf8,0x2f,0xdf,0xdf,0xdf,0x17,0xff,0x72,
+0x66,0x66,0x66,0x62,0x4b,0xf7,0x9b,0x01,0xf0,0x0b,0x90,0x0f,0x74,0x34,0x8e,0x14,
+0x50,0x00,0xf7,0xba,0xf5,0x94,0x8e,0x10,0x0f,0xbf,0x4f,0x84,0xba,0xe7,0x00,0xf8,
+0x50,0x8c,0xdb,0x32,0x50,0x00,0x01,0x6f,0x02,0x30,0x04,0xfe,0x40,0x07,0x00,0x30,
+0x03,0xdf,0x60,0x06,0x00,0xf5,0x28,0x11,0xc8,0x00,0x00,0x02,0x41,0xf8,0x00,0x01,
 0x93,0x00,0x8f,0x1f,0x80,0x00,0x1f,0xa0,0x0b,0xd1,0xf8,0x00,0x00,0xaf,0x10,0xeb,
 0x1f,0x80,0x00,0x05,0xf5,0x2f,0x81,0xf8,0x00,0x0a,0x3f,0xa3,0xf4,0x1f,0x80,0x02,
-0xf5,0x61,0x00,0x00,0xfd,0x77,0xaf,0x20,0xab,0x25,0x16,0x90,0x96,0x0b,0x12,0x90,
-0xc5,0x25,0x20,0xd3,0x08,0xd0,0x15,0xf0,0x1e,0x5e,0xb2,0xfc,0x00,0x02,0x44,0xf6,
-0x21,0xbf,0x20,0x00,0x8f,0x4f,0x60,0x7f,0x86,0x00,0x0c,0xd3,0xf6,0x6f,0xb6,0xf5,
-0x01,0xf8,0x3f,0xbf,0xb0,0x0d,0xe0,0x7f,0x23,0xff,0xc0,0x00,0x6f,0x50,0x31,0xaf,
-0xc0,0x00,0x82,0xc4,0x06,0xef,0x9b,0x2d,0xa1,0x05,0xfd,0x6f,0xd8,0x8b,0xf4,0x00,
-0x05,0x00,0x9f,0xf0,0x0b,0x11,0xf8,0xd8,0x3d,0x20,0x0f,0x80,0x1d,0x06,0x20,0x15,
-0xfd,0x04,0x3b,0xf1,0x07,0x03,0xef,0xed,0x65,0xcf,0x5f,0x90,0x6c,0xfa,0xe1,0x09,
-0xf0,0xe9,0x0a,0x9f,0x82,0x33,0xbf,0x3f,0xa1,0x12,0xf8,0x24,0x40,0xf5,0x11,0x0f,
-0x82,0x34,0xff,0xb3,0x31,0x00,0xf8,0x00,0x6f,0xbf,0x30,0x00,0x0f,0x80,0x3f,0xa0,
-0xed,0x20,0x00,0xf8,0x7f,0xd1,0x05,0xff,0x50,0x0f,0x89,0xb1,0x00,0x03,0xc1,0xa3,
-0x00,0x02,0x66,0x0c,0x51,0xfd,0x66,0x66,0x66,0x50,0xa1,0x28,0xf5,0x29,0xfb,0x01,
-0xee,0x39,0xf2,0xae,0x0e,0xa0,0x06,0x38,0xf5,0x5f,0x50,0xf8,0x00,0x2c,0xf6,0x4f,
-0xb0,0x3f,0x60,0x00,0xa3,0x3f,0xc1,0xdf,0xf2,0x00,0x20,0x35,0x7a,0x26,0x84,0x00,
-0x0a,0xc9,0xe0,0xdd,0x01,0xe7,0x00,0xe8,0x9e,0x03,0x95,0x9b,0xe0,0x5f,0x38,0xf6,
-0x56,0xce,0x4f,0x50,0x30,0x3d,0x55,0x07,0x00,0xc1,0x0e,0xe0,0xe3,0x09,0x30,0x00,
-0x00,0x2c,0xf6,0x01,0xbf,0x70,0x00,0x3f,0xff,0xef,0x13,0x01,0x72,0x98,0x76,0x54,
-0x43,0x76,0x00,0x08,0x00,0x21,0xf5,0x1e,0x8e,0x22,0x22,0x2a,0xe0,0x00,0x08,0xfd,
-0xdd,0xdd,0xfe,0x00,0x00,0x35,0x59,0xe6,0x55,0x50,0x00,0x34,0x46,0x5f,0xc0,0x05,
-0x70,0x0a,0xea,0xe0,0x3e,0x34,0x9f,0x21,0xf9,0x9f,0x65,0x67,0xf8,0xf9,0x1a,0x33,
-0xdf,0xff,0xfc,0x17,0x40,0x84,0x12,0x20,0x91,0x11,0x74,0x21,0x01,0x32,0x32,0x72,
-0x7f,0xd3,0x22,0xde,0x10,0x00,0x0c,0x3e,0x0d,0x30,0x03,0x55,0x55,0x78,0x02,0x11,
-0x6f,0x0d,0x00,0x12,0x04,0x0d,0x00,0x02,0x66,0x33,0xf0,0x0f,0x11,0x34,0x5f,0x50,
-0x07,0x60,0x0a,0xea,0xe0,0xbf,0x25,0xbe,0x12,0xf8,0x9f,0x66,0x89,0xf6,0xf7,0x19,
-0x14,0xdf,0xff,0xfa,0x07,0x20,0x00,0xf6,0x00,0xf6,0x43,0x11,0x80,0x61,0x4f,0x73,
-0x33,0x30,0x06,0xfd,0xcf,0x63,0x41,0xfd,0x2b,0xff,0xe9,0x8f,0x23,0x93,0x20,0x4d,
-0xfb,0xaa,0xc4,0x5f,0x25,0x08,0xaf,0x70,0xd8,0xe9,0xf5,0xd0,0x01,0xf6,0x2f,0x6f,
-0x8d,0x99,0x00,0x0f,0x69,0xe5,0xab,0xbc,0x40,0x00,0xf9,0xf5,0x02,0xff,0x30,0x00,
-0x0f,0x9c,0x00,0xce,0xcc,0x00,0x00,0xf6,0x04,0xdf,0x32,0xfd,0x20,0x0f,0x60,0x5c,
-0x20,0x02,0xb0,0x0d,0x42,0x10,0x50,0xfe,0x4f,0x90,0xdf,0xfe,0xdd,0x80,0x00,0x09,
-0xf6,0x66,0x66,0xa8,0x09,0x01,0xec,0x07,0x51,0x09,0xf7,0x77,0x77,0xf9,0xca,0x45,
-0xf1,0x1d,0x8f,0x90,0x00,0x09,0xfe,0xee,0xee,0xf9,0x00,0x00,0x24,0x48,0xf6,0x44,
+0xf5,0x61,0x00,0x00,0xfd,0x77,0xaf,0x20,0x00,0x00,0x08,0xff,0xff,0x90,0xa4,0x00,
+0x12,0x08,0x0b,0x00,0xf0,0x61,0x8f,0xd3,0x08,0xf3,0x00,0x00,0x01,0x5e,0xb2,0xfc,
+0x00,0x02,0x44,0xf6,0x21,0xbf,0x20,0x00,0x8f,0x4f,0x60,0x7f,0x86,0x00,0x0c,0xd3,
+0xf6,0x6f,0xb6,0xf5,0x01,0xf8,0x3f,0xbf,0xb0,0x0d,0xe0,0x7f,0x23,0xff,0xc0,0x00,
+0x6f,0x50,0x31,0xaf,0xc0,0x00,0x82,0xc4,0x06,0xef,0xf6,0x00,0x1f,0x70,0x05,0xfd,
+0x6f,0xd8,0x8b,0xf4,0x00,0x05,0x00,0x9f,0xff,0xfa,0x00,0x00,0x00,0xf8,0x00,0x09,
+0xf0,0x00,0x00,0x0f,0x80,0x00,0xaf,0x00,0x00,0x15,0xfd,0x5f,0xff,0xff,0xf9,0x03,
+0xef,0xed,0x65,0xcf,0x5f,0x90,0x6c,0xfa,0xe1,0x09,0xf0,0xe9,0x0a,0x9f,0x82,0x33,
+0xbf,0x3f,0xa1,0x12,0xf8,0x9f,0x84,0x03,0xf5,0x11,0x0f,0x82,0x34,0xff,0xb3,0x31,
+0x00,0xf8,0x00,0x6f,0xbf,0x30,0x00,0x0f,0x80,0x3f,0xa0,0xed,0x20,0x00,0xf8,0x7f,
+0xd1,0x05,0xff,0x50,0x0f,0x89,0xb1,0x00,0x03,0xc1,0xa3,0x00,0x11,0x80,0xf0,0x00,
+0x60,0xfd,0x66,0x66,0x66,0x50,0x01,0xf8,0x03,0xf4,0x2d,0xfb,0x01,0xee,0x39,0xf2,
+0xae,0x0e,0xa0,0x06,0x38,0xf5,0x5f,0x50,0xf8,0x00,0x2c,0xf6,0x4f,0xb0,0x3f,0x60,
+0x00,0xa3,0x3f,0xc1,0xdf,0xf2,0x00,0x20,0x35,0x7a,0x26,0x84,0x00,0x0a,0xc9,0xe0,
+0xdd,0x01,0xe7,0x00,0xe8,0x9e,0x03,0x95,0x9b,0xe0,0x5f,0x38,0xf6,0x56,0xce,0x4f,
+0x50,0x30,0x3d,0xff,0xff,0x60,0x20,0x55,0x00,0xf0,0x00,0x09,0xe3,0x09,0x30,0x00,
+0x00,0x2c,0xf6,0x01,0xbf,0x70,0x00,0x3f,0xff,0xef,0x13,0x01,0x50,0x98,0x76,0x54,
+0x43,0x76,0x1e,0x01,0xf4,0x22,0xff,0xfe,0x00,0x00,0x8e,0x22,0x22,0x2a,0xe0,0x00,
+0x08,0xfd,0xdd,0xdd,0xfe,0x00,0x00,0x35,0x59,0xe6,0x55,0x50,0x00,0x34,0x46,0x5f,
+0xc0,0x05,0x70,0x0a,0xea,0xe0,0x3e,0x34,0x9f,0x21,0xf9,0x9f,0x65,0x67,0xf8,0xf9,
+0x1a,0x33,0xdf,0xff,0xfc,0x17,0x40,0x55,0x00,0x70,0x4f,0x91,0x11,0x00,0x00,0x00,
+0x3e,0x87,0x04,0x70,0x00,0x7f,0xd3,0x22,0xde,0x10,0x00,0x06,0x03,0x60,0xff,0xe0,
+0x00,0x03,0x55,0x55,0x78,0x02,0x11,0x6f,0x0d,0x00,0x12,0x04,0x0d,0x00,0x11,0xcf,
+0x0d,0x00,0xf0,0x1a,0x11,0x34,0x5f,0x50,0x07,0x60,0x0a,0xea,0xe0,0xbf,0x25,0xbe,
+0x12,0xf8,0x9f,0x66,0x89,0xf6,0xf7,0x19,0x14,0xdf,0xff,0xfa,0x07,0x20,0x00,0xf6,
+0x00,0xf6,0x00,0x00,0x00,0x0f,0x61,0x4f,0x73,0x33,0x30,0x06,0xfd,0x2f,0x00,0xfb,
+0x2d,0x12,0xff,0xe9,0x8f,0x23,0x93,0x20,0x4d,0xfb,0xaa,0xc4,0x5f,0x25,0x08,0xaf,
+0x70,0xd8,0xe9,0xf5,0xd0,0x01,0xf6,0x2f,0x6f,0x8d,0x99,0x00,0x0f,0x69,0xe5,0xab,
+0xbc,0x40,0x00,0xf9,0xf5,0x02,0xff,0x30,0x00,0x0f,0x9c,0x00,0xce,0xcc,0x00,0x00,
+0xf6,0x04,0xdf,0x32,0xfd,0x20,0x0f,0x60,0x5c,0x20,0x02,0xb0,0x00,0x01,0x00,0xf0,
+0x05,0x6f,0x50,0x00,0x00,0x00,0x7d,0xdf,0xfe,0xdd,0x80,0x00,0x09,0xf6,0x66,0x66,
+0xf9,0x00,0x00,0x9f,0xff,0x05,0x01,0x40,0x09,0xf7,0x77,0x77,0x0d,0x00,0xf1,0x1f,
+0x88,0x88,0x8f,0x90,0x00,0x09,0xfe,0xee,0xee,0xf9,0x00,0x00,0x24,0x48,0xf6,0x44,
 0x30,0x00,0x68,0x68,0x1e,0xc0,0x1f,0x70,0x0d,0xca,0xe0,0x5b,0x38,0xcf,0x05,0xf6,
 0xaf,0x66,0x6b,0xf5,0xf4,0x06,0x04,0xdf,0xff,0xf8,0x02,0x00,0x01,0xf4,0xf7,0x01,
-0x21,0x1f,0x49,0x64,0x39,0xf2,0x0c,0xfe,0x66,0x6b,0xf6,0x66,0x04,0xef,0xcc,0xbb,
-0xef,0xbb,0x90,0x6d,0xf5,0xbb,0xbd,0xfb,0xbb,0x69,0xaf,0x45,0x88,0x88,0x88,0x73,
-0x24,0xf4,0xa0,0x2f,0xe0,0x41,0xfa,0x77,0x7e,0xa0,0x01,0xf4,0x1f,0xa7,0x77,0xea,
-0x00,0x1f,0x41,0xc5,0x03,0x50,0x01,0xf4,0x1f,0x61,0x36,0x0d,0x00,0x84,0xf4,0x01,
-0xfe,0x50,0x00,0x00,0x04,0xc3,0x07,0x0b,0xf1,0x00,0x70,0x01,0x29,0xe3,0x23,0xfa,
-0x21,0x01,0xbb,0xdf,0xcb,0xcf,0xdb,0xb1,0x1b,0x48,0x42,0x22,0x10,0x07,0x8e,0x46,
-0xf7,0x1d,0xae,0x66,0x66,0x6e,0xb0,0x00,0x0a,0xfb,0xbb,0xbb,0xfb,0x00,0x00,0xaf,
-0xbb,0xbb,0xbf,0xb0,0x00,0x03,0x33,0xbf,0x63,0x36,0x00,0x04,0xf7,0xf6,0xcd,0x24,
-0xf5,0x01,0xdc,0x4f,0x74,0x5d,0x8a,0xe0,0x19,0x21,0xcf,0xff,0xe3,0x26,0xf9,0x00,
-0x34,0x8e,0x4d,0x20,0x6d,0x28,0xf4,0x30,0x44,0x44,0x8f,0x56,0x51,0x08,0xec,0xff,
+0x20,0x1f,0x49,0x70,0x04,0xf0,0x24,0x03,0xfe,0x66,0x6b,0xf6,0x66,0x04,0xef,0xcc,
+0xbb,0xef,0xbb,0x90,0x6d,0xf5,0xbb,0xbd,0xfb,0xbb,0x69,0xaf,0x45,0x88,0x88,0x88,
+0x73,0x24,0xf4,0x1f,0xff,0xff,0xfa,0x00,0x1f,0x41,0xfa,0x77,0x7e,0xa0,0x01,0xf4,
+0x1f,0xa7,0x77,0xea,0x00,0x1f,0x41,0xff,0xff,0xff,0x0d,0x00,0x20,0x61,0x36,0x0d,
+0x00,0xc0,0xf4,0x01,0xfe,0x50,0x00,0x00,0x04,0xc3,0x00,0x00,0x00,0x7f,0x3a,0x01,
+0xf0,0x01,0x70,0x01,0x29,0xe3,0x23,0xfa,0x21,0x01,0xbb,0xdf,0xcb,0xcf,0xdb,0xb1,
+0x1b,0xbb,0x01,0x00,0xf7,0x25,0x10,0x07,0xbb,0xbb,0xbb,0xb8,0x00,0x00,0xae,0x66,
+0x66,0x6e,0xb0,0x00,0x0a,0xfb,0xbb,0xbb,0xfb,0x00,0x00,0xaf,0xbb,0xbb,0xbf,0xb0,
+0x00,0x03,0x33,0xbf,0x63,0x36,0x00,0x04,0xf7,0xf6,0xcd,0x24,0xf5,0x01,0xdc,0x4f,
+0x74,0x5d,0x8a,0xe0,0x19,0x21,0xcf,0xff,0xe3,0x26,0xf9,0x00,0x50,0x8e,0x4d,0x20,
+0x07,0xff,0x01,0x00,0xf1,0x32,0x50,0x7f,0x44,0x44,0x8f,0x56,0x51,0x08,0xec,0xff,
 0xf8,0xf3,0xcb,0x00,0x9c,0x45,0x55,0x2f,0x9f,0x20,0x0b,0xbb,0xed,0xf2,0xdf,0x93,
 0x00,0xf7,0xbb,0x6f,0x6e,0xf7,0xc8,0x5f,0x27,0x99,0xa9,0xcb,0xff,0x30,0x50,0x56,
 0x4f,0x40,0x07,0x40,0x0a,0xeb,0xe0,0xae,0x37,0xea,0x03,0xf7,0xaf,0x33,0x48,0xf8,
-0xf3,0x17,0x15,0xef,0xff,0xf9,0x05,0x7b,0x19,0xf0,0x69,0x0d,0xc3,0x20,0xf6,0x39,
-0x20,0x2d,0xe3,0xcd,0x1f,0xfe,0x93,0x07,0xff,0xfe,0xf9,0xf8,0x07,0x80,0x0b,0xbb,
-0xbc,0x2a,0xff,0xe7,0x00,0xe8,0x15,0xf2,0xe5,0x02,0x00,0x0e,0xed,0xef,0x2f,0xaa,
-0xf8,0x00,0xec,0xab,0xf2,0xfb,0x55,0x60,0x0e,0x72,0xcf,0x1e,0xed,0xfb,0x00,0x62,
-0x05,0x7d,0x25,0x68,0x30,0x0e,0x6e,0x91,0xf6,0x52,0xf9,0x08,0xf2,0xeb,0x35,0x4e,
-0x6a,0xf0,0x26,0x07,0xff,0xff,0xd1,0x36,0x00,0x00,0xf6,0x0d,0xfe,0xee,0xf8,0x00,
-0x0f,0x60,0xda,0x00,0x0f,0x80,0x03,0xfb,0x5d,0xeb,0xbb,0xf8,0x04,0xcf,0xcb,0xac,
-0xaa,0xac,0x70,0x69,0xf7,0x9e,0xee,0xee,0xee,0x29,0x7f,0x66,0xe3,0xe4,0xe2,0xf3,
-0x01,0xf6,0x6f,0xc3,0x09,0xfa,0x11,0x0f,0x63,0x66,0x66,0x67,0x40,0x00,0xf6,0x8f,
-0xfe,0xef,0xfc,0x00,0x0f,0x60,0x4f,0xb6,0xed,0x10,0x00,0xf7,0x47,0xcf,0xff,0x96,
-0x20,0x0f,0x6b,0xc8,0x53,0x6b,0xe3,0x57,0x0b,0x63,0x01,0x11,0x1b,0xd1,0x11,0x10,
-0x57,0x0b,0xf8,0x31,0x7e,0x2a,0xc8,0xe4,0xf5,0x21,0x07,0xe4,0xf9,0xfe,0xdf,0xdd,
-0x10,0x8f,0xff,0xff,0xda,0xfc,0x70,0x08,0xe7,0xf7,0xdb,0x7f,0x95,0x00,0x9c,0x0f,
-0x4c,0xb7,0xfa,0x50,0x0a,0xb0,0xf4,0xcf,0xef,0xfe,0x30,0xba,0x06,0x15,0xf9,0x01,
-0x00,0x0e,0x76,0xd7,0xe3,0xd5,0xe7,0x04,0xf5,0xea,0x7f,0x33,0xda,0xf2,0x3c,0x2a,
-0x13,0xef,0xfd,0x29,0xec,0x04,0xf6,0x41,0x12,0x00,0x5f,0xee,0xf5,0xac,0xee,0xa0,
-0x05,0xe6,0x7f,0x37,0xda,0x30,0x00,0x5e,0x77,0xf2,0x7e,0x4e,0x50,0x05,0xfa,0xaf,
-0x2c,0xff,0x63,0x00,0x5e,0x99,0xf3,0xaf,0xbb,0xf2,0x1e,0xfd,0xdf,0xab,0x9f,0x99,
-0x40,0x7a,0x8b,0xc4,0xd5,0xe8,0xe2,0x1e,0x9e,0x96,0x99,0xaf,0x36,0x40,0x13,0x52,
-0x2f,0x83,0x34,0x00,0x06,0xf6,0xf3,0x5e,0x32,0xfa,0x02,0xf9,0x4f,0x63,0x3b,0xb5,
-0xf7,0x06,0x01,0xcf,0xff,0xf5,0x05,0x00,0x6c,0x24,0x21,0xf6,0xd9,0x59,0x03,0x42,
-0x66,0xf7,0x00,0x8f,0x2b,0x48,0x10,0xf8,0x95,0x19,0x60,0x30,0x8f,0x32,0x21,0xf9,
-0x0b,0xf3,0x49,0xfd,0x1b,0x4e,0xb5,0xf5,0x00,0x9f,0x47,0xf3,0xce,0xce,0x00,0x0a,
-0xf0,0x4f,0x38,0xff,0x60,0x00,0xbd,0x28,0xf2,0x6f,0xc0,0x71,0x0f,0xbc,0xfd,0x5f,
-0xfc,0x0d,0x75,0xf7,0x23,0x8f,0xe9,0xfc,0xf4,0x4e,0x10,0x04,0xc1,0x08,0xeb,0xa7,
-0x0a,0x94,0xeb,0x5d,0x50,0x03,0x33,0x33,0x3e,0xc4,0xce,0xdf,0x1f,0xf0,0x23,0x44,
-0x44,0x4d,0xe4,0x44,0x20,0x6f,0xff,0xf5,0xaf,0x0b,0xd0,0x07,0xf5,0x6f,0x58,0xf3,
-0xf9,0x00,0x7f,0x01,0xf5,0x6f,0xcf,0x30,0x07,0xff,0xff,0x52,0xff,0xb0,0x00,0x25,
-0x55,0x64,0x0f,0xf2,0x52,0x05,0x8b,0xef,0xca,0xff,0x2a,0xb0,0xff,0xc9,0x7e,0xf9,
-0xfe,0xfd,0x02,0x3b,0xc6,0x05,0xdd,0xba,0x40,0xf3,0x03,0x8f,0x10,0x4f,0x59,0x20,
-0x09,0xff,0xff,0xf5,0xf4,0xde,0x10,0x23,0x9f,0x43,0x4f,0x32,0x90,0x4a,0x0b,0xfb,
-0x24,0x4b,0xa9,0x94,0x6f,0x85,0x42,0x03,0xfc,0xde,0x83,0xf7,0x8f,0x01,0xef,0x9c,
-0xd8,0x2f,0x9e,0xa0,0x1b,0xfe,0xff,0xe1,0xcf,0xf3,0x00,0x2f,0x8b,0xd6,0x09,0xfa,
-0x20,0x02,0xf8,0xbd,0x71,0xcf,0x57,0xa0,0x2f,0xff,0xff,0xdf,0xfd,0xc8,0x02,0xf5,
-0x33,0x3c,0x54,0xef,0xe7,0x16,0xf5,0x3e,0xcf,0xff,0x98,0xe9,0x90,0x00,0x0c,0xa0,
-0x00,0x7e,0x2f,0x30,0xee,0xff,0xee,0xd7,0xf0,0x92,0x0f,0x7c,0xa7,0xbd,0xaf,0xbd,
-0x60,0xf9,0xdb,0x68,0xaf,0xfa,0x83,0x0f,0x44,0xbb,0x90,0x4f,0x2d,0x30,0xfd,0xee,
-0xee,0xb2,0xf9,0xf1,0x1f,0x6b,0x99,0xb3,0x0f,0xfa,0x02,0xf7,0xe9,0x9f,0x40,0xdf,
-0x41,0x6f,0x0e,0x3a,0xa0,0x7f,0xd6,0xb9,0xc3,0xc9,0xed,0xcf,0xcf,0xf8,0x55,0xac,
-0xa8,0x68,0x80,0x8e,0x20,0x1b,0x02,0x51,0x36,0xab,0x10,0x00,0x9d,0x34,0x2a,0x20,
-0xdd,0x53,0xcc,0x00,0x71,0xdd,0x77,0x77,0x77,0x70,0x00,0xdf,0x8a,0x11,0x11,0xeb,
-0xe9,0x2b,0x61,0xfb,0x33,0x33,0x3a,0xf0,0x01,0xb3,0x17,0x62,0x03,0xf6,0x22,0x22,
-0x29,0xe0,0xd8,0x49,0x21,0x2f,0xa0,0x5f,0x26,0x17,0x10,0xf3,0x2d,0x12,0x00,0x6a,
-0x47,0xd1,0x6a,0xc0,0x14,0x7c,0xc0,0x0e,0xff,0xc8,0x4f,0xff,0xc8,0x10,0xea,0x34,
-0x14,0x30,0x0e,0xff,0xfe,0x98,0x0e,0xf3,0x22,0xec,0x6b,0xf1,0xff,0xdd,0xd7,0x0e,
-0xa0,0x8f,0x2f,0xda,0xfc,0x50,0xff,0xff,0xf3,0xf7,0x1f,0x70,0x0f,0xb6,0x66,0x5f,
-0x51,0xf7,0x01,0xf7,0x00,0x08,0xf2,0x1f,0x70,0x5f,0x50,0x00,0xed,0x01,0xf7,0x09,
-0xf1,0x00,0xaf,0x60,0x1f,0x70,0x5a,0x00,0x08,0xa0,0xc9,0x2c,0x05,0x19,0x46,0x00,
-0xb2,0x2a,0x22,0x00,0x06,0x42,0x11,0xc1,0xf7,0x66,0x66,0x67,0xf8,0x07,0xf7,0x77,
-0x77,0x77,0xf8,0x07,0x6b,0x0c,0xfa,0x1b,0x07,0xf4,0x55,0x54,0x55,0x55,0x08,0xfa,
-0xef,0xf9,0xee,0xff,0x0a,0xd4,0xa4,0xf2,0xb5,0x7f,0x0c,0xc1,0xc8,0xf2,0x5b,0x9f,
-0x0f,0x86,0xbf,0xf6,0xaf,0xff,0x5f,0x3b,0x87,0xf5,0xa6,0x9f,0x4c,0x00,0x3f,0xc0,
-0x07,0xf9,0xfe,0x29,0x41,0x23,0x46,0x8a,0xdc,0xe3,0x1f,0x60,0xc9,0x61,0x00,0x05,
-0x43,0x3f,0x5a,0x2d,0x82,0x55,0x56,0xfb,0x55,0x55,0x00,0x4f,0xff,0xa7,0x05,0xc2,
-0x13,0xf9,0x11,0x11,0x01,0x77,0x77,0x8f,0xc7,0x77,0x75,0x3f,0x1b,0x37,0x05,0x10,
-0x15,0x11,0xf8,0x97,0x1a,0x01,0xe5,0x38,0x27,0x06,0xff,0xa0,0x1f,0x03,0x17,0x1b,
-0x00,0x35,0x28,0xb0,0xf2,0x58,0xfd,0x86,0x88,0xdf,0x98,0x19,0xff,0xff,0x10,0x12,
-0x2f,0x11,0xf9,0xb3,0x2a,0x20,0x0f,0xb6,0x0d,0x00,0xa7,0x5b,0xff,0xf3,0x00,0x9f,
-0x10,0x08,0xef,0xb1,0x00,0x1a,0x00,0x10,0x90,0x0d,0x00,0xc7,0x27,0xf9,0x00,0x79,
-0xef,0x00,0x02,0xfe,0x40,0x07,0xfe,0x80,0xde,0x16,0xf0,0x21,0x1f,0x77,0x70,0x00,
-0x0d,0xa0,0x00,0xf8,0x8f,0x60,0x37,0xed,0x70,0x0f,0x90,0x96,0x17,0xff,0xff,0x79,
-0xfe,0xef,0xf9,0x00,0xda,0x09,0xdf,0xe9,0x86,0x20,0x0d,0xb5,0x00,0xbe,0x0a,0xc0,
-0x4a,0xff,0xf2,0x09,0xf5,0xf8,0x06,0xdf,0xc1,0x00,0x5f,0xfd,0x34,0x00,0xfb,0x08,
-0x03,0xff,0x24,0x30,0x0d,0xa0,0x06,0xff,0xf2,0x9c,0x16,0xea,0x1d,0xfb,0x5f,0xff,
-0x81,0xfe,0x40,0x45,0x00,0x4c,0xe2,0xe2,0x34,0x10,0xb0,0xf8,0x20,0x20,0x00,0xcb,
-0x86,0x00,0xf0,0x1e,0x01,0x7e,0xd7,0x8c,0xce,0xcc,0xc6,0x3f,0xff,0xe7,0xaa,0xaa,
-0xaa,0x50,0x0c,0xb0,0x08,0x70,0x0c,0x70,0x00,0xcc,0x40,0xbb,0x01,0xf8,0x02,0xaf,
-0xfe,0x08,0xe0,0x3f,0x40,0x2d,0xfc,0x10,0x5f,0x16,0xf1,0x00,0x0c,0xb0,0x04,0xf4,
-0x9d,0x34,0x00,0x60,0x18,0x1c,0x90,0x00,0x6e,0xa4,0x9d,0x07,0xa0,0x0c,0xe5,0x27,
-0x77,0x77,0x77,0x60,0x00,0xda,0x0a,0x54,0x13,0xb0,0x0d,0xa0,0xaf,0x77,0x77,0x71,
-0x6f,0xff,0xea,0xe0,0x00,0xd2,0x3a,0x40,0xaf,0x66,0x66,0x30,0x1a,0x00,0x00,0xfb,
-0x15,0xf0,0x00,0xc6,0xae,0x00,0x0e,0x80,0x4b,0xff,0xfb,0xe1,0x11,0xe8,0x05,0xdf,
-0xb0,0xaf,0xe0,0x0e,0x20,0xda,0x0a,0x37,0x21,0x30,0x0d,0xa0,0xae,0x80,0x39,0x20,
-0xea,0x0a,0x02,0x06,0x69,0xfe,0x40,0x68,0x88,0x88,0x84,0xaa,0x00,0x00,0xdb,0x29,
-0x21,0x1e,0x60,0x46,0x46,0xf1,0x03,0xfe,0x10,0x04,0x9f,0xd9,0x05,0xf9,0xdc,0x00,
-0x5c,0xfe,0xc7,0xfd,0x03,0xfc,0x20,0x0e,0x95,0x7a,0x14,0xf0,0x00,0xeb,0x87,0x47,
-0x77,0x64,0x04,0xbf,0xff,0x25,0x55,0x55,0x30,0x5d,0xfb,0x12,0x6f,0x00,0xe0,0x0e,
-0x90,0x2f,0x60,0x0f,0x80,0x00,0xe9,0x02,0xf6,0x00,0xf8,0x01,0x6f,0x92,0x03,0x71,
-0x80,0x1f,0xe4,0x02,0xfa,0x66,0xf8,0xce,0x10,0x40,0x01,0x10,0x03,0xf2,0x47,0x1d,
-0xf1,0x08,0x00,0x3f,0x20,0x77,0x9f,0x87,0x50,0x59,0xf9,0x2e,0xff,0xff,0xfb,0x0a,
-0xef,0xe3,0x00,0x4f,0x20,0x00,0x03,0xf2,0x8f,0xd8,0x3c,0xe1,0x65,0x66,0x66,0xce,
-0x62,0x6b,0xff,0x87,0x77,0x7c,0xe7,0x2b,0xef,0x56,0x79,0x4e,0xf6,0x08,0xf2,0x05,
-0xc0,0x09,0xd0,0x00,0x3f,0x20,0x2f,0x90,0x9d,0x00,0x39,0xf2,0x00,0x67,0x5c,0xd0,
-0x04,0xfb,0x00,0x00,0x1f,0xb2,0x02,0xf0,0x2a,0xea,0x05,0xf3,0x00,0x40,0x00,0x0e,
-0xa0,0x5f,0x79,0xef,0x60,0x37,0xfc,0x75,0xff,0xc8,0x22,0x07,0xff,0xfe,0x5f,0x30,
-0x00,0xe7,0x00,0xea,0x02,0xff,0xdd,0xef,0x30,0x0e,0xc8,0x02,0x56,0x65,0x30,0x6d,
-0xff,0xe7,0xff,0xff,0xfe,0x06,0xbf,0xa0,0x5f,0x65,0x5b,0xe0,0x00,0xea,0x05,0xfe,
-0xee,0xfe,0x34,0x00,0xc1,0x54,0x4b,0xe0,0x16,0xf9,0x05,0xfe,0xdd,0xfe,0x01,0xfe,
-0x40,0x1a,0x00,0x0c,0xaf,0x01,0xf0,0x11,0x3f,0x60,0x00,0x00,0xcb,0x06,0x77,0xfc,
-0x77,0x32,0x7e,0xd7,0xdf,0xee,0xee,0xf8,0x5f,0xff,0xed,0x96,0x80,0x0f,0x80,0x0c,
-0xb0,0x32,0xec,0x00,0x32,0x00,0xcb,0x4f,0xbf,0x22,0xf0,0x03,0x3d,0xff,0x6d,0xf6,
-0x8f,0xa4,0x7f,0xfe,0x72,0xf9,0x09,0xf3,0x02,0x4d,0xb0,0x4e,0xf9,0xfc,0xaf,0x01,
-0xf4,0x01,0x0a,0xff,0xa0,0x01,0x6e,0xa1,0x7c,0xfd,0x9f,0xe4,0x0e,0xe5,0x0c,0xb5,
-0x00,0x3d,0x0c,0x04,0x20,0xd9,0x0b,0x6a,0x16,0xfa,0x38,0x0d,0x90,0xbd,0x66,0x66,
-0x61,0x2e,0xff,0xbb,0xc8,0xbb,0xbb,0x02,0xbf,0xe8,0xbc,0x9d,0xdd,0xd0,0x00,0xd9,
-0x0b,0xd3,0x33,0x33,0x10,0x0d,0xa3,0xbf,0xff,0xff,0xf6,0x29,0xff,0xdc,0xcb,0xbc,
-0x76,0x04,0xef,0xb1,0xca,0xbb,0x7e,0xf4,0x00,0xd9,0x0d,0x9b,0xb2,0xf6,0x00,0x0d,
-0x90,0xf8,0xbb,0x4d,0xb0,0x06,0xf9,0x4f,0x5e,0xff,0x5f,0x60,0xbe,0x45,0xd1,0xd8,
-0x10,0x61,0xb0,0x00,0x80,0x5f,0x00,0x00,0x8e,0x00,0x00,0x05,0xf0,0x68,0x08,0xa0,
-0x05,0xbf,0x84,0x66,0xbf,0x66,0x40,0xbf,0xff,0x5f,0xc1,0x11,0xf4,0x24,0x5f,0x13,
-0x55,0xaf,0x5f,0xa1,0x05,0xf3,0xbe,0xef,0xfe,0xff,0x47,0xcf,0xf4,0x88,0xcf,0x8f,
-0x70,0x8b,0xf1,0x2c,0x7b,0xf6,0x63,0x00,0x5f,0x06,0xf2,0x8f,0xff,0x90,0x05,0xf0,
-0xaf,0xa8,0xf3,0x32,0x03,0xaf,0x4f,0xaf,0xff,0x77,0x71,0x5f,0xa4,0xc0,0x28,0xac,
-0xdd,0x55,0x00,0x20,0xe7,0x0a,0xef,0x01,0xf0,0x3e,0x0e,0x70,0x25,0x55,0x5d,0xa0,
-0x29,0xfc,0x77,0xff,0xff,0xfa,0x04,0xff,0xfc,0x34,0x44,0x4d,0xa0,0x01,0xe8,0x1b,
-0xdd,0xdd,0xd9,0x00,0x0e,0xa7,0xbb,0xbb,0xbb,0xb5,0x4c,0xff,0xed,0x46,0xf7,0x4f,
-0x73,0xbf,0x84,0xef,0xff,0xff,0xe5,0x00,0xe7,0x0a,0xc5,0xf6,0xaa,0x00,0x0e,0x70,
-0xab,0x2f,0x39,0xa0,0x06,0xf7,0x0a,0xb2,0xfa,0xf9,0x00,0xed,0x20,0x11,0x2f,0x42,
-0x00,0x00,0xbb,0x00,0x0d,0x69,0xa0,0xf4,0x21,0xf2,0x22,0xf7,0xab,0x00,0x18,0xee,
-0x7a,0xff,0x7a,0xff,0x62,0xef,0xfc,0x46,0xf7,0xad,0x62,0x00,0xbb,0x02,0x3f,0x7a,
-0xc3,0x10,0x0b,0xc5,0xaf,0xf7,0xaf,0xf4,0x29,0xff,0xf1,0x2f,0x7a,0xc2,0x03,0xef,
-0xd2,0x66,0xf7,0xad,0x63,0x00,0xbb,0x0e,0xff,0x7a,0xff,0x80,0x34,0x00,0x90,0x05,
-0xdb,0x00,0x0f,0x7a,0xb0,0x00,0xce,0x60,0x0d,0x00,0x04,0x81,0x13,0xf0,0x20,0xf0,
-0x00,0x23,0x68,0xc4,0x00,0x5f,0x07,0xff,0xff,0xda,0x50,0x5a,0xf7,0x48,0x39,0x40,
-0x5a,0x1a,0xff,0xf7,0xf2,0xaa,0x0c,0xc0,0x05,0xf0,0x0e,0x76,0x95,0xf3,0x00,0x5f,
-0x61,0x30,0x5e,0x35,0x00,0x6c,0xff,0x65,0x5a,0xf6,0x55,0x1b,0xef,0x47,0x44,0x09,
-0xf0,0x0c,0x05,0xf0,0x00,0xbf,0xff,0x50,0x00,0x5f,0x03,0xce,0x9f,0x9f,0x70,0x3a,
-0xf1,0xee,0x36,0xf0,0x9f,0x46,0xfa,0x03,0x10,0x6f,0x00,0x30,0x06,0x05,0x26,0x40,
-0x00,0x00,0x6f,0x03,0x96,0x04,0xe1,0x7c,0xfa,0x27,0xf6,0x5c,0xb5,0x08,0xef,0xc1,
-0x0e,0x61,0xf6,0x00,0x06,0x59,0x01,0xf0,0x01,0x30,0x6f,0x63,0x56,0xf9,0x55,0x51,
-0x6d,0xff,0x65,0x8f,0x85,0x55,0x1b,0xef,0x4c,0x2d,0x13,0xfd,0x0b,0x06,0xf0,0x09,
-0xf3,0x0e,0xa0,0x00,0x6f,0x00,0x9e,0xfd,0xf2,0x00,0x3a,0xf0,0x46,0xaf,0xff,0xd5,
-0x06,0xf9,0x0b,0xda,0x50,0x3b,0x90,0xa1,0x01,0x10,0x9c,0xb0,0x00,0xf1,0x1e,0x36,
-0x6b,0xf7,0x66,0x15,0xbf,0x99,0xfe,0xee,0xef,0xf2,0x9e,0xfd,0xad,0x33,0x05,0x4f,
-0x20,0x5f,0x00,0x4f,0xa3,0xfb,0x00,0x05,0xf1,0x4f,0xb0,0x03,0xeb,0x01,0x8f,0xf3,
-0xc6,0x66,0x69,0x50,0xbf,0xf7,0x1e,0xff,0xff,0xf6,0x04,0x8f,0x06,0x2e,0x20,0x05,
-0xf0,0x24,0x06,0xa1,0x04,0xaf,0x08,0x99,0xdf,0x99,0x93,0x6f,0x90,0xbc,0x6d,0x42,
-0xf0,0x00,0xd9,0x00,0x6b,0x3c,0x10,0x00,0x0d,0x90,0x0d,0xb1,0xe7,0x00,0x3c,0xfe,
-0xb4,0x64,0x1a,0xf0,0x21,0xaf,0xda,0xdf,0xa8,0xfa,0x71,0x00,0xda,0xaf,0xf7,0x4f,
-0x83,0x00,0x0d,0xbd,0xbf,0xff,0xff,0xf1,0x2a,0xff,0xd2,0xf7,0x3f,0x72,0x04,0xff,
-0xc2,0x2f,0xa7,0xfa,0x70,0x01,0xd9,0x02,0xff,0xef,0xfe,0x00,0x0d,0x90,0x2f,0x62,
-0xf6,0x10,0x08,0xf9,0x02,0xf4,0x12,0x65,0xde,0x40,0x2f,0x95,0x55,0x52,0x4d,0x01,
-0x00,0x90,0x10,0x90,0x00,0x5f,0x02,0x5f,0x94,0xfb,0x40,0x5b,0xf9,0x59,0x0d,0xf0,
-0x01,0x1a,0xef,0xe4,0x2f,0x71,0xea,0x10,0x05,0xf0,0x01,0x95,0x19,0x60,0x00,0x5f,
-0x53,0xf4,0x02,0xf1,0x00,0x7d,0xff,0x6f,0x79,0xe4,0xdb,0x0b,0xff,0x41,0xf8,0x9e,
-0x5d,0xb0,0x05,0xf0,0x67,0x49,0x71,0x5f,0x01,0xf4,0x6e,0x0c,0xb0,0x4a,0x0d,0x00,
-0x74,0x06,0xf9,0x01,0xf8,0x55,0x5d,0xb0,0xb4,0x06,0x20,0xe7,0x07,0xf3,0x0b,0xf4,
-0x04,0x0e,0x70,0x7f,0x11,0x19,0xe0,0x27,0xfb,0x57,0xff,0xff,0xfe,0x04,0xff,0xfc,
-0x7f,0x55,0x5b,0xe0,0x1a,0x00,0xf1,0x07,0x82,0x55,0x55,0x55,0x52,0x17,0xff,0xee,
-0xef,0xff,0xee,0x84,0xef,0xa1,0x5a,0x0f,0x72,0x20,0x00,0xe7,0x0a,0xe0,0x34,0x00,
-0xf5,0x01,0xef,0x6f,0x71,0x10,0x17,0xf7,0x9f,0x7f,0xfa,0x55,0x50,0xed,0x3b,0x60,
-0x4b,0xdf,0xf6,0x18,0xf0,0x34,0xf8,0x01,0x35,0x69,0xcb,0x00,0x0f,0x80,0x8f,0xff,
-0xea,0x70,0x17,0xfc,0x40,0x10,0xe7,0x00,0x02,0xff,0xf9,0xee,0xef,0xfe,0xe9,0x00,
-0xf8,0x05,0x76,0xfa,0x55,0x30,0x0f,0xb5,0x8f,0x9e,0xaf,0xf3,0x3c,0xff,0xbc,0x90,
-0xe8,0x6f,0x33,0xef,0xa0,0xca,0x2e,0x86,0xf3,0x00,0xf8,0x0c,0xf7,0xea,0xff,0x30,
-0x0f,0x80,0xc7,0x0e,0x72,0xf3,0x06,0xf8,0x0c,0xd0,0x01,0x64,0xbd,0x30,0xcb,0x66,
-0x68,0xf3,0xc2,0x09,0x20,0xbc,0x02,0x90,0x00,0xf0,0x00,0x0b,0xc0,0x2f,0x52,0x29,
-0xe0,0x2a,0xee,0x82,0xff,0xff,0xfe,0x03,0xff,0xfd,0x0d,0x00,0xf0,0x08,0x01,0xbc,
-0x12,0xee,0xee,0xed,0x00,0x0b,0xc3,0x99,0x99,0x99,0x98,0x39,0xef,0xd7,0xec,0x77,
-0x77,0x63,0xce,0xc0,0x8f,0x8a,0x0c,0xf1,0x0c,0xbc,0x7f,0x7f,0x7f,0x8f,0x50,0x0b,
-0xc0,0x4d,0x98,0xd2,0xf3,0x07,0xeb,0x4e,0xa6,0xf7,0x8f,0x10,0xde,0x51,0x60,0xa6,
-0x9f,0x90,0x04,0xf0,0xb0,0x45,0xf0,0x00,0x4f,0x00,0x3f,0xff,0xf6,0x00,0x5b,0xfa,
-0x3e,0xb2,0x9e,0x10,0x06,0xdf,0xcb,0x59,0x02,0xf1,0x0e,0x04,0xf0,0x1f,0x79,0x78,
-0x8e,0x00,0x4f,0x70,0xe7,0xf3,0xe6,0xe0,0x6d,0xff,0x1e,0xe9,0x1a,0xce,0x08,0xdf,
-0x20,0xe5,0x5f,0x36,0xe0,0x04,0xf0,0xcf,0x76,0x0f,0xfb,0x03,0x02,0x34,0xff,0xd4,
-0x32,0x2a,0xf0,0x27,0xed,0x2c,0xd7,0x23,0xfa,0x0e,0xe8,0x10,0x07,0xd7,0x4c,0x02,
-0xf0,0x0c,0x17,0xff,0xff,0xed,0x40,0x05,0xf1,0x0a,0x48,0x70,0xf6,0x09,0xef,0xd3,
-0xd7,0x9a,0x5f,0x20,0xbf,0xff,0x5b,0xa9,0xac,0xc3,0x00,0x6f,0x25,0x82,0x10,0xf0,
-0x01,0x05,0xf1,0x57,0xec,0x77,0x77,0x13,0x9f,0xe9,0xaf,0xc9,0x99,0x91,0xcf,0xf7,
-0x15,0x15,0x44,0xf3,0x0b,0x6f,0x10,0xbf,0xe3,0x9f,0x10,0x05,0xf1,0x4f,0x8d,0xdf,
-0x60,0x03,0xaf,0x5f,0xe7,0xdf,0xfc,0x82,0x5f,0xa3,0xb2,0xd8,0x23,0x9d,0x10,0xfd,
-0x01,0x10,0xf1,0x9b,0x03,0xf0,0x22,0x00,0x5f,0x10,0x3c,0xff,0xff,0xc0,0x5a,0xf8,
-0xbf,0xb7,0x29,0xf4,0x0a,0xff,0xf6,0x74,0xae,0xf6,0x00,0x05,0xf1,0x28,0xff,0xb3,
-0x00,0x00,0x5f,0x69,0xff,0xa4,0x44,0x40,0x8d,0xff,0x5e,0xff,0xfe,0xed,0x0a,0xdf,
-0x25,0xe3,0x8f,0x32,0x21,0x05,0xf1,0xcf,0x45,0x06,0xf0,0x0d,0x5f,0x11,0xd5,0x7f,
-0x26,0xd0,0x3a,0xf0,0x0f,0xcc,0xfb,0xdf,0x05,0xfa,0x00,0x99,0x99,0x9c,0xf0,0x00,
-0xe7,0x01,0x8f,0x18,0xf1,0x00,0x0e,0x71,0x37,0x08,0xf0,0x1b,0x17,0xfb,0x53,0x8d,
-0x38,0xe3,0x23,0xff,0xfb,0x8d,0xdd,0xdd,0xc0,0x00,0xe7,0x09,0xe5,0x55,0xbe,0x00,
-0x0e,0x82,0x9f,0xff,0xff,0xe0,0x28,0xff,0xd9,0xe8,0x88,0xde,0x03,0xcf,0x90,0x36,
-0x7f,0x96,0x50,0x00,0xe7,0x4f,0xc7,0x09,0xfb,0x03,0x0e,0x71,0x46,0xfe,0xfc,0x53,
-0x17,0xf7,0x27,0xef,0x47,0xfb,0x40,0xed,0x25,0xfb,0x20,0x06,0xa2,0x37,0xfe,0x3e,
-0x3f,0x1a,0xff,0xbd,0xac,0x20,0x03,0xf1,0x44,0xe7,0x8f,0xa4,0x06,0xff,0xd9,0xff,
-0x11,0xfd,0xf4,0x4b,0xfa,0x7f,0x60,0x05,0xfc,0x10,0x3f,0x5f,0xff,0x5e,0xff,0xf6,
-0x03,0xf9,0x22,0xd6,0xf5,0xf4,0x05,0xef,0xea,0xef,0xde,0x1c,0xe0,0x5b,0xf2,0xb7,
-0x34,0xb7,0x79,0x00,0x3f,0x1d,0xff,0x8f,0xbd,0xd0,0x03,0xf1,0x12,0xf4,0xae,0xf6,
-0x02,0x7f,0x12,0x4f,0x37,0xff,0x40,0x3f,0xa0,0x9f,0xa7,0xd6,0x6c,0x59,0x01,0xf1,
-0x03,0xcc,0x20,0x05,0xf1,0x0a,0xa7,0xe2,0xf3,0x0b,0xff,0xf3,0x8d,0x7e,0x7d,0x00,
-0x7c,0xfb,0xcf,0xef,0x15,0xf0,0x06,0x13,0x5e,0xff,0xf9,0x40,0x05,0xf8,0x4d,0xd9,
-0xe7,0xf7,0x06,0xdf,0xff,0xe3,0x7b,0x19,0xf3,0xce,0xf2,0x3f,0xfb,0x06,0xf0,0x0e,
-0x5f,0x11,0xf7,0x8d,0x3f,0x70,0x05,0xf1,0x1f,0xff,0xfe,0xf7,0x03,0x7f,0x01,0xf7,
-0x9d,0x3f,0x70,0x5f,0xa0,0x1f,0xdd,0xdd,0xe7,0x00,0x05,0xf1,0x3f,0x51,0x02,0xf2,
-0x06,0x5f,0x13,0xf3,0xe4,0xd5,0xe0,0x5a,0xf8,0x5f,0xcf,0xcf,0xce,0x0a,0xff,0xf4,
-0x77,0xbf,0x77,0x60,0x05,0xf1,0x36,0x03,0xf0,0x19,0x43,0x55,0xaf,0x55,0x50,0x5b,
-0xff,0xbe,0xfe,0xef,0xee,0x19,0xdf,0x41,0x5f,0x84,0xbd,0x30,0x05,0xf1,0x3a,0xad,
-0xfa,0xa8,0x00,0x5f,0x1a,0xdd,0xef,0xdd,0xd3,0x3a,0xf1,0x34,0x4a,0xf4,0x44,0x15,
-0xfa,0x00,0x85,0x29,0xf0,0x37,0x4c,0xcf,0xcc,0x5c,0xff,0xc0,0x00,0x9a,0xfa,0x92,
-0xf4,0x7e,0x62,0x0f,0xaf,0x9f,0xfb,0x02,0xde,0x40,0xd9,0xf9,0xd4,0xed,0xde,0x50,
-0x8b,0xcf,0xcb,0x59,0xdb,0xd0,0x01,0xe5,0xf4,0xe7,0xaf,0xfc,0x72,0x0a,0xaa,0xaa,
-0x8a,0x79,0xed,0x10,0xdd,0xdd,0xef,0xdb,0x97,0x00,0x07,0xbb,0xbc,0xfc,0xbb,0xa0,
-0x0b,0xdd,0xdd,0xef,0xed,0xdd,0xd5,0x11,0x12,0x38,0xf5,0x11,0xd2,0x2a,0x00,0xca,
-0x1e,0x30,0x03,0xf1,0x04,0xab,0x12,0xf0,0x21,0x3f,0x10,0x4f,0x11,0x7c,0x00,0x9e,
+0xf3,0x17,0x15,0xef,0xff,0xf9,0x05,0x45,0x05,0x00,0x52,0x06,0xf0,0x67,0xc3,0x20,
+0xf6,0x39,0x20,0x2d,0xe3,0xcd,0x1f,0xfe,0x93,0x07,0xff,0xfe,0xf9,0xf8,0x07,0x80,
+0x0b,0xbb,0xbc,0x2a,0xff,0xe7,0x00,0xe8,0x15,0xf2,0xe5,0x02,0x00,0x0e,0xed,0xef,
+0x2f,0xaa,0xf8,0x00,0xec,0xab,0xf2,0xfb,0x55,0x60,0x0e,0x72,0xcf,0x1e,0xed,0xfb,
+0x00,0x62,0x05,0x7d,0x25,0x68,0x30,0x0e,0x6e,0x91,0xf6,0x52,0xf9,0x08,0xf2,0xeb,
+0x35,0x4e,0x6a,0xf0,0x26,0x07,0xff,0xff,0xd1,0x36,0x00,0x00,0xf6,0x0d,0xfe,0xee,
+0xf8,0x00,0x0f,0x60,0xda,0x00,0x0f,0x80,0x03,0xfb,0x5d,0xeb,0xbb,0xf8,0x04,0xcf,
+0xcb,0xac,0xaa,0xac,0x70,0x69,0xf7,0x9e,0xee,0xee,0xee,0x29,0x7f,0x66,0xe3,0xe4,
+0xe2,0xf3,0x01,0xf6,0x4d,0x02,0xf6,0x12,0x30,0x0f,0x63,0x66,0x66,0x67,0x40,0x00,
+0xf6,0x8f,0xfe,0xef,0xfc,0x00,0x0f,0x60,0x4f,0xb6,0xed,0x10,0x00,0xf7,0x47,0xcf,
+0xff,0x96,0x20,0x0f,0x6b,0xc8,0x53,0x6b,0xe3,0xf8,0x00,0x10,0x01,0x04,0x00,0x52,
+0x11,0x1b,0xd1,0x11,0x10,0xff,0x00,0xf8,0x32,0x60,0x7e,0x2a,0xc8,0xe4,0xf5,0x21,
+0x07,0xe4,0xf9,0xfe,0xdf,0xdd,0x10,0x8f,0xff,0xff,0xda,0xfc,0x70,0x08,0xe7,0xf7,
+0xdb,0x7f,0x95,0x00,0x9c,0x0f,0x4c,0xb7,0xfa,0x50,0x0a,0xb0,0xf4,0xcf,0xef,0xfe,
+0x30,0xba,0x06,0x15,0xf9,0x01,0x00,0x0e,0x76,0xd7,0xe3,0xd5,0xe7,0x04,0xf5,0xea,
+0x7f,0x33,0xda,0xf2,0x3c,0x2a,0x13,0xef,0xfd,0x29,0xec,0x04,0xf6,0x40,0x12,0x00,
+0x5f,0xee,0xf5,0xac,0xee,0xa0,0x05,0xe6,0x7f,0x37,0xda,0x30,0x00,0x5e,0x77,0xf2,
+0x7e,0x4e,0x50,0x05,0xfa,0xaf,0x2c,0xff,0x63,0x00,0x5e,0x99,0xf3,0xaf,0xbb,0xf2,
+0x1e,0xfd,0xdf,0xab,0x9f,0x99,0x40,0x7a,0x8b,0xc4,0xd5,0xe8,0xe2,0x1e,0x9e,0x96,
+0x99,0xaf,0x36,0x40,0x13,0x52,0x2f,0x83,0x34,0x00,0x06,0xf6,0xf3,0x5e,0x32,0xfa,
+0x02,0xf9,0x4f,0x63,0x3b,0xb5,0xf7,0x06,0x01,0xcf,0xff,0xf5,0x05,0x59,0x00,0x31,
+0x04,0xf6,0xd9,0x59,0x03,0x40,0x66,0xf7,0x00,0x8f,0xb6,0x00,0xfc,0x2d,0xf7,0x08,
+0xf8,0x77,0x8f,0xb7,0x77,0x30,0x8f,0x32,0x21,0xf9,0x0b,0x60,0x09,0xff,0xff,0x4e,
+0xb5,0xf5,0x00,0x9f,0x47,0xf3,0xce,0xce,0x00,0x0a,0xf0,0x4f,0x38,0xff,0x60,0x00,
+0xbd,0x28,0xf2,0x6f,0xc0,0x71,0x0f,0xbc,0xfd,0x5f,0xfc,0x0d,0x75,0xf7,0x23,0x8f,
+0xe9,0xfc,0xf4,0x4e,0x10,0x04,0xc1,0x08,0xeb,0x00,0x01,0x00,0xb1,0xeb,0x5d,0x50,
+0x03,0x33,0x33,0x3e,0xc4,0xce,0x11,0xff,0x5b,0x00,0xf0,0x24,0x04,0x44,0x44,0x4d,
+0xe4,0x44,0x20,0x6f,0xff,0xf5,0xaf,0x0b,0xd0,0x07,0xf5,0x6f,0x58,0xf3,0xf9,0x00,
+0x7f,0x01,0xf5,0x6f,0xcf,0x30,0x07,0xff,0xff,0x52,0xff,0xb0,0x00,0x25,0x55,0x64,
+0x0f,0xf2,0x52,0x05,0x8b,0xef,0xca,0xff,0x2a,0xb0,0xff,0xc9,0x7e,0xf9,0xfe,0xfd,
+0x02,0x4a,0xc6,0x05,0xdd,0x10,0x59,0x00,0xf1,0x04,0x8f,0x10,0x4f,0x59,0x20,0x09,
+0xff,0xff,0xf5,0xf4,0xde,0x10,0x23,0x9f,0x43,0x4f,0x32,0x90,0x2f,0x62,0x00,0xfa,
+0x26,0x90,0x4b,0xa9,0x94,0x6f,0x85,0x42,0x03,0xfc,0xde,0x83,0xf7,0x8f,0x01,0xef,
+0x9c,0xd8,0x2f,0x9e,0xa0,0x1b,0xfe,0xff,0xe1,0xcf,0xf3,0x00,0x2f,0x8b,0xd6,0x09,
+0xfa,0x20,0x02,0xf8,0xbd,0x71,0xcf,0x57,0xa0,0x2f,0xff,0xff,0xdf,0xfd,0xc8,0x02,
+0xf5,0x33,0x3c,0x54,0xef,0x20,0x5b,0x00,0xf5,0x3e,0xcf,0xff,0x98,0xe9,0x90,0x00,
+0x0c,0xa0,0x00,0x7e,0x2f,0x30,0xee,0xff,0xee,0xd7,0xf0,0x92,0x0f,0x7c,0xa7,0xbd,
+0xaf,0xbd,0x60,0xf9,0xdb,0x68,0xaf,0xfa,0x83,0x0f,0x44,0xbb,0x90,0x4f,0x2d,0x30,
+0xfd,0xee,0xee,0xb2,0xf9,0xf1,0x1f,0x6b,0x99,0xb3,0x0f,0xfa,0x02,0xf7,0xe9,0x9f,
+0x40,0xdf,0x41,0x6f,0x0e,0x3a,0xa0,0x7f,0xd6,0xb9,0xc3,0xc9,0xed,0xcf,0xcf,0xf8,
+0x55,0xac,0xa8,0x68,0x80,0x8e,0x20,0x1b,0x02,0xc0,0x36,0xab,0x10,0x00,0x9d,0xff,
+0xff,0xc8,0x30,0x00,0xdd,0x53,0xcc,0x00,0x60,0xdd,0x77,0x77,0x77,0x70,0x00,0x6b,
+0x05,0xe0,0xf0,0x00,0xeb,0x00,0x00,0x08,0xf0,0x00,0xfb,0x33,0x33,0x3a,0xf0,0x01,
+0xc5,0x00,0x90,0xf0,0x03,0xf6,0x22,0x22,0x29,0xe0,0x09,0xf0,0x3a,0x00,0x20,0x2f,
+0xa0,0x06,0x00,0x24,0x5e,0x10,0x61,0x02,0x05,0x01,0x00,0xf7,0x3e,0x13,0x6a,0xc0,
+0x14,0x7c,0xc0,0x0e,0xff,0xc8,0x4f,0xff,0xc8,0x10,0xea,0x00,0x01,0xf9,0x00,0x00,
+0x0e,0xff,0xfe,0x1f,0x80,0x00,0x00,0xec,0x6b,0xf1,0xff,0xdd,0xd7,0x0e,0xa0,0x8f,
+0x2f,0xda,0xfc,0x50,0xff,0xff,0xf3,0xf7,0x1f,0x70,0x0f,0xb6,0x66,0x5f,0x51,0xf7,
+0x01,0xf7,0x00,0x08,0xf2,0x1f,0x70,0x5f,0x50,0x00,0xed,0x01,0xf7,0x09,0xf1,0x00,
+0xaf,0x60,0x1f,0x70,0x5a,0x00,0x08,0xa0,0x01,0xf7,0x62,0x0a,0x00,0x05,0x00,0x51,
+0x06,0xf3,0x00,0x00,0x06,0xb2,0x01,0xc1,0x06,0xf7,0x66,0x66,0x67,0xf8,0x07,0xf7,
+0x77,0x77,0x77,0xf8,0xd6,0x02,0xf9,0x1c,0xf8,0x07,0xf4,0x55,0x54,0x55,0x55,0x08,
+0xfa,0xef,0xf9,0xee,0xff,0x0a,0xd4,0xa4,0xf2,0xb5,0x7f,0x0c,0xc1,0xc8,0xf2,0x5b,
+0x9f,0x0f,0x86,0xbf,0xf6,0xaf,0xff,0x5f,0x3b,0x87,0xf5,0xa6,0x9f,0x4c,0x00,0x3f,
+0xc0,0x07,0xf9,0x57,0x01,0xf2,0x0d,0x01,0x23,0x46,0x8a,0xdc,0x00,0x04,0xff,0xff,
+0xff,0xc9,0x61,0x00,0x05,0x43,0x3f,0x80,0x00,0x00,0x01,0x55,0x56,0xfb,0x55,0x55,
+0x00,0x4f,0xff,0xa7,0x05,0xc1,0x13,0xf9,0x11,0x11,0x01,0x77,0x77,0x8f,0xc7,0x77,
+0x75,0x3f,0xcd,0x01,0x51,0xa0,0x00,0x00,0x1f,0x90,0x3c,0x00,0x10,0xf8,0x06,0x00,
+0x40,0x58,0x9f,0x70,0x00,0x97,0x00,0x16,0xb2,0x55,0x00,0x02,0x63,0x00,0xf1,0x03,
+0x0f,0x90,0xbf,0xff,0xff,0xf2,0x58,0xfd,0x86,0x88,0xdf,0x98,0x19,0xff,0xff,0x10,
+0x09,0xf1,0x1a,0x00,0x50,0x9f,0x10,0x00,0x0f,0xb6,0x0d,0x00,0xa7,0x5b,0xff,0xf3,
+0x00,0x9f,0x10,0x08,0xef,0xb1,0x00,0x1a,0x00,0x10,0x90,0x0d,0x00,0xc5,0x27,0xf9,
+0x00,0x79,0xef,0x00,0x02,0xfe,0x40,0x07,0xfe,0x80,0x55,0x00,0xf0,0x23,0xda,0x00,
+0x1f,0x77,0x70,0x00,0x0d,0xa0,0x00,0xf8,0x8f,0x60,0x37,0xed,0x70,0x0f,0x90,0x96,
+0x17,0xff,0xff,0x79,0xfe,0xef,0xf9,0x00,0xda,0x09,0xdf,0xe9,0x86,0x20,0x0d,0xb5,
+0x00,0xbe,0x0a,0xc0,0x4a,0xff,0xf2,0x09,0xf5,0xf8,0x06,0xdf,0xc1,0x00,0x5f,0xfd,
+0x34,0x00,0xfa,0x08,0x03,0xff,0x24,0x30,0x0d,0xa0,0x06,0xff,0xf2,0x9c,0x16,0xea,
+0x1d,0xfb,0x5f,0xff,0x81,0xfe,0x40,0x45,0x00,0x4c,0xe2,0x5c,0x02,0x80,0x0c,0xb0,
+0x00,0x4f,0x40,0x00,0x00,0xcb,0x86,0x00,0xf0,0x1e,0x01,0x7e,0xd7,0x8c,0xce,0xcc,
+0xc6,0x3f,0xff,0xe7,0xaa,0xaa,0xaa,0x50,0x0c,0xb0,0x08,0x70,0x0c,0x70,0x00,0xcc,
+0x40,0xbb,0x01,0xf8,0x02,0xaf,0xfe,0x08,0xe0,0x3f,0x40,0x2d,0xfc,0x10,0x5f,0x16,
+0xf1,0x00,0x0c,0xb0,0x04,0xf4,0x9d,0x34,0x00,0x60,0x18,0x1c,0x90,0x00,0x6e,0xa4,
+0x9d,0x07,0xf1,0x12,0x0c,0xe5,0x27,0x77,0x77,0x77,0x60,0x00,0xda,0x0a,0xff,0xff,
+0xff,0x20,0x0d,0xa0,0xaf,0x77,0x77,0x71,0x6f,0xff,0xea,0xe0,0x00,0x00,0x06,0xef,
+0xfd,0xaf,0x66,0x66,0x30,0x1a,0x00,0xf0,0x16,0xf8,0x00,0x0d,0xc6,0xae,0x00,0x0e,
+0x80,0x4b,0xff,0xfb,0xe1,0x11,0xe8,0x05,0xdf,0xb0,0xaf,0xff,0xff,0x80,0x00,0xda,
+0x0a,0xf5,0x55,0x52,0x00,0x0d,0xa0,0xae,0x00,0x00,0x00,0x16,0xea,0x0a,0x02,0x06,
+0x6a,0xfe,0x40,0x68,0x88,0x88,0x84,0xaa,0x00,0xf0,0x0e,0x0e,0x90,0x00,0x1e,0x60,
+0x00,0x00,0xe9,0x00,0x09,0xfe,0x10,0x04,0x9f,0xd9,0x05,0xf9,0xdc,0x00,0x5c,0xfe,
+0xc7,0xfd,0x03,0xfc,0x20,0x0e,0x95,0xff,0x64,0x06,0xf0,0x00,0xeb,0x87,0x47,0x77,
+0x64,0x04,0xbf,0xff,0x25,0x55,0x55,0x30,0x5d,0xfb,0x12,0x6f,0x00,0xe0,0x0e,0x90,
+0x2f,0x60,0x0f,0x80,0x00,0xe9,0x02,0xf6,0x00,0xf8,0x01,0x6f,0x92,0x03,0x60,0x80,
+0x1f,0xe4,0x02,0xfa,0x66,0xbe,0x01,0xf0,0x12,0x02,0x00,0x01,0x10,0x03,0xf2,0x00,
+0x04,0xf2,0x00,0x00,0x3f,0x20,0x77,0x9f,0x87,0x50,0x59,0xf9,0x2e,0xff,0xff,0xfb,
+0x0a,0xef,0xe3,0x00,0x4f,0x20,0x00,0x03,0xf2,0x8f,0x2f,0x06,0xf6,0x1c,0x3f,0x65,
+0x66,0x66,0xce,0x62,0x6b,0xff,0x87,0x77,0x7c,0xe7,0x2b,0xef,0x56,0xff,0xff,0xff,
+0xf4,0x03,0xf2,0x05,0xc0,0x09,0xd0,0x00,0x3f,0x20,0x2f,0x90,0x9d,0x00,0x39,0xf2,
+0x00,0x67,0x5c,0xd0,0x04,0xfb,0x00,0x00,0x1f,0xb2,0x02,0xf0,0x2a,0xea,0x05,0xf3,
+0x00,0x40,0x00,0x0e,0xa0,0x5f,0x79,0xef,0x60,0x37,0xfc,0x75,0xff,0xc8,0x22,0x07,
+0xff,0xfe,0x5f,0x30,0x00,0xe7,0x00,0xea,0x02,0xff,0xdd,0xef,0x30,0x0e,0xc8,0x02,
+0x56,0x65,0x30,0x6d,0xff,0xe7,0xff,0xff,0xfe,0x06,0xbf,0xa0,0x5f,0x65,0x5b,0xe0,
+0x00,0xea,0x05,0xfe,0xee,0xfe,0x34,0x00,0xc1,0x54,0x4b,0xe0,0x16,0xf9,0x05,0xfe,
+0xdd,0xfe,0x01,0xfe,0x40,0x1a,0x00,0x0c,0xaf,0x01,0xf0,0x10,0x3f,0x60,0x00,0x00,
+0xcb,0x06,0x77,0xfc,0x77,0x32,0x7e,0xd7,0xdf,0xee,0xee,0xf8,0x5f,0xff,0xed,0x96,
+0x80,0x0f,0x80,0x0c,0xb0,0x32,0xec,0x00,0x32,0x00,0xcb,0xbc,0x02,0xf0,0x04,0xb0,
+0x3d,0xff,0x6d,0xf6,0x8f,0xa4,0x7f,0xfe,0x72,0xf9,0x09,0xf3,0x02,0x4d,0xb0,0x4e,
+0xf9,0xfc,0xaf,0x01,0xf4,0x01,0x0a,0xff,0xa0,0x01,0x6e,0xa1,0x7c,0xfd,0x9f,0xe4,
+0x0e,0xe5,0x0c,0xb5,0x00,0x3d,0x0c,0x04,0xfa,0x3e,0xd9,0x0b,0xff,0xff,0xff,0x40,
+0x0d,0x90,0xbd,0x66,0x66,0x61,0x2e,0xff,0xbb,0xc8,0xbb,0xbb,0x02,0xbf,0xe8,0xbc,
+0x9d,0xdd,0xd0,0x00,0xd9,0x0b,0xd3,0x33,0x33,0x10,0x0d,0xa3,0xbf,0xff,0xff,0xf6,
+0x29,0xff,0xdc,0xcb,0xbc,0x76,0x04,0xef,0xb1,0xca,0xbb,0x7e,0xf4,0x00,0xd9,0x0d,
+0x9b,0xb2,0xf6,0x00,0x0d,0x90,0xf8,0xbb,0x4d,0xb0,0x06,0xf9,0x4f,0x5e,0xff,0x5f,
+0x60,0xbe,0x45,0xd1,0xd8,0x10,0x61,0xb0,0x00,0x80,0x5f,0x00,0x00,0x8e,0x00,0x00,
+0x05,0xf0,0x68,0x08,0xf4,0x32,0x05,0xbf,0x84,0x66,0xbf,0x66,0x40,0xbf,0xff,0x5f,
+0xff,0xff,0xf7,0x00,0x5f,0x13,0x55,0xaf,0x5f,0xa1,0x05,0xf3,0xbe,0xef,0xfe,0xff,
+0x47,0xcf,0xf4,0x88,0xcf,0x8f,0x70,0x8b,0xf1,0x2c,0x7b,0xf6,0x63,0x00,0x5f,0x06,
+0xf2,0x8f,0xff,0x90,0x05,0xf0,0xaf,0xa8,0xf3,0x32,0x03,0xaf,0x4f,0xaf,0xff,0x77,
+0x71,0x5f,0xa4,0xc0,0x28,0xac,0xdd,0x55,0x00,0x20,0xe7,0x0a,0xef,0x01,0xf2,0x73,
+0x0e,0x70,0x25,0x55,0x5d,0xa0,0x29,0xfc,0x77,0xff,0xff,0xfa,0x04,0xff,0xfc,0x34,
+0x44,0x4d,0xa0,0x01,0xe8,0x1b,0xdd,0xdd,0xd9,0x00,0x0e,0xa7,0xbb,0xbb,0xbb,0xb5,
+0x4c,0xff,0xed,0x46,0xf7,0x4f,0x73,0xbf,0x84,0xef,0xff,0xff,0xe5,0x00,0xe7,0x0a,
+0xc5,0xf6,0xaa,0x00,0x0e,0x70,0xab,0x2f,0x39,0xa0,0x06,0xf7,0x0a,0xb2,0xfa,0xf9,
+0x00,0xed,0x20,0x11,0x2f,0x42,0x00,0x00,0xbb,0x00,0x0d,0x69,0xa0,0x00,0x0b,0xb0,
+0x00,0xf7,0xab,0x00,0x18,0xee,0x7a,0xff,0x7a,0xff,0x62,0xef,0xfc,0x46,0xf7,0xad,
+0x62,0x00,0xbb,0x02,0x3f,0x7a,0xc3,0x10,0x0b,0xc5,0xaf,0xf7,0xaf,0xf4,0x29,0xff,
+0xf1,0x2f,0x7a,0xc2,0x03,0xef,0xd2,0x66,0xf7,0xad,0x63,0x00,0xbb,0x0e,0xff,0x7a,
+0xff,0x80,0x34,0x00,0xf0,0x05,0x05,0xdb,0x00,0x0f,0x7a,0xb0,0x00,0xce,0x60,0x00,
+0xf7,0xab,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0x8e,0x05,0xf0,0x00,0x23,
+0x68,0xc4,0x00,0x5f,0x07,0xff,0xff,0xda,0x50,0x5a,0xf7,0x48,0x39,0x40,0x5a,0x1a,
+0xff,0xf7,0xf2,0xaa,0x0c,0xc0,0x05,0xf0,0x0e,0x76,0x95,0xf3,0x00,0x5f,0x61,0x30,
+0x5e,0x35,0x00,0x6c,0xff,0x65,0x5a,0xf6,0x55,0x1b,0xef,0x47,0xff,0xff,0xff,0xf2,
+0x05,0xf0,0x00,0xbf,0xff,0x50,0x00,0x5f,0x03,0xce,0x9f,0x9f,0x70,0x3a,0xf1,0xee,
+0x36,0xf0,0x9f,0x46,0xfa,0x03,0x10,0x6f,0x00,0x30,0x06,0xf0,0x00,0x09,0xb0,0x00,
+0x00,0x6f,0x03,0xff,0xff,0xff,0xe0,0x7c,0xfa,0x27,0xf6,0x5c,0xb5,0x08,0xef,0xc1,
+0x0e,0x61,0xf6,0x00,0x06,0xf0,0x9f,0xff,0xff,0xff,0x30,0x6f,0x63,0x56,0xf9,0x55,
+0x51,0x6d,0xff,0x65,0x8f,0x85,0x55,0x1b,0xef,0x4c,0xff,0xff,0xff,0xf5,0x06,0xf0,
+0x09,0xf3,0x0e,0xa0,0x00,0x6f,0x00,0x9e,0xfd,0xf2,0x00,0x3a,0xf0,0x46,0xaf,0xff,
+0xd5,0x06,0xf9,0x0b,0xda,0x50,0x3b,0x90,0x00,0x01,0x00,0xf0,0x29,0x5f,0x00,0x00,
+0x9c,0x00,0x00,0x05,0xf0,0x36,0x6b,0xf7,0x66,0x15,0xbf,0x99,0xfe,0xee,0xef,0xf2,
+0x9e,0xfd,0xad,0x33,0x05,0x4f,0x20,0x5f,0x00,0x4f,0xa3,0xfb,0x00,0x05,0xf1,0x4f,
+0xb0,0x03,0xeb,0x01,0x8f,0xf3,0xc6,0x66,0x69,0x50,0xbf,0xf7,0x1e,0xff,0xff,0xf6,
+0x04,0x8f,0x00,0x00,0x8f,0x34,0x00,0xf2,0x51,0x00,0x08,0xf0,0x00,0x04,0xaf,0x08,
+0x99,0xdf,0x99,0x93,0x6f,0x90,0xbc,0xcc,0xcc,0xcc,0x40,0x00,0xd9,0x00,0x6b,0x3c,
+0x10,0x00,0x0d,0x90,0x0d,0xb1,0xe7,0x00,0x3c,0xfe,0xb4,0xff,0xff,0xff,0x33,0xaf,
+0xda,0xdf,0xa8,0xfa,0x71,0x00,0xda,0xaf,0xf7,0x4f,0x83,0x00,0x0d,0xbd,0xbf,0xff,
+0xff,0xf1,0x2a,0xff,0xd2,0xf7,0x3f,0x72,0x04,0xff,0xc2,0x2f,0xa7,0xfa,0x70,0x01,
+0xd9,0x02,0xff,0xef,0xfe,0x00,0x0d,0x90,0x2f,0x62,0xf6,0x10,0x08,0xf9,0x02,0xff,
+0xff,0xff,0x80,0xde,0x40,0x2f,0x95,0x55,0x52,0xa3,0x00,0x00,0x69,0x00,0xf1,0x30,
+0xf6,0x0e,0x90,0x00,0x5f,0x02,0x5f,0x94,0xfb,0x40,0x5b,0xf9,0xaf,0xff,0xff,0xff,
+0x1a,0xef,0xe4,0x2f,0x71,0xea,0x10,0x05,0xf0,0x01,0x95,0x19,0x60,0x00,0x5f,0x53,
+0xff,0xff,0xff,0xb0,0x7d,0xff,0x6f,0x79,0xe4,0xdb,0x0b,0xff,0x41,0xf8,0x9e,0x5d,
+0xb0,0x05,0xf0,0x1f,0xff,0xff,0xfb,0x00,0x5f,0x01,0xf4,0x6e,0x0c,0xb0,0x4a,0x0d,
+0x00,0xa1,0x06,0xf9,0x01,0xf8,0x55,0x5d,0xb0,0x00,0x00,0x01,0x56,0x00,0xf4,0x0a,
+0xe7,0x07,0xff,0xff,0xfe,0x00,0x0e,0x70,0x7f,0x11,0x19,0xe0,0x27,0xfb,0x57,0xff,
+0xff,0xfe,0x04,0xff,0xfc,0x7f,0x55,0x5b,0xe0,0x1a,0x00,0xf1,0x07,0x82,0x55,0x55,
+0x55,0x52,0x17,0xff,0xee,0xef,0xff,0xee,0x84,0xef,0xa1,0x5a,0x0f,0x72,0x20,0x00,
+0xe7,0x0a,0xe0,0x34,0x00,0xf4,0x02,0xef,0x6f,0x71,0x10,0x17,0xf7,0x9f,0x7f,0xfa,
+0x55,0x50,0xed,0x3b,0x60,0x4b,0xdf,0xfa,0x4e,0x01,0xf0,0x34,0xf8,0x01,0x35,0x69,
+0xcb,0x00,0x0f,0x80,0x8f,0xff,0xea,0x70,0x17,0xfc,0x40,0x10,0xe7,0x00,0x02,0xff,
+0xf9,0xee,0xef,0xfe,0xe9,0x00,0xf8,0x05,0x76,0xfa,0x55,0x30,0x0f,0xb5,0x8f,0x9e,
+0xaf,0xf3,0x3c,0xff,0xbc,0x90,0xe8,0x6f,0x33,0xef,0xa0,0xca,0x2e,0x86,0xf3,0x00,
+0xf8,0x0c,0xf7,0xea,0xff,0x30,0x0f,0x80,0xc7,0x0e,0x72,0xf3,0x06,0xf8,0x0c,0xd0,
+0x01,0x60,0xbd,0x30,0xcb,0x66,0x68,0xf3,0x52,0x00,0x00,0xad,0x00,0x20,0xbc,0x02,
+0x90,0x00,0xf0,0x00,0x0b,0xc0,0x2f,0x52,0x29,0xe0,0x2a,0xee,0x82,0xff,0xff,0xfe,
+0x03,0xff,0xfd,0x0d,0x00,0xf0,0x3b,0x01,0xbc,0x12,0xee,0xee,0xed,0x00,0x0b,0xc3,
+0x99,0x99,0x99,0x98,0x39,0xef,0xd7,0xec,0x77,0x77,0x63,0xce,0xc0,0x8f,0xff,0xff,
+0xf6,0x00,0xbc,0x7f,0x7f,0x7f,0x8f,0x50,0x0b,0xc0,0x4d,0x98,0xd2,0xf3,0x07,0xeb,
+0x4e,0xa6,0xf7,0x8f,0x10,0xde,0x51,0x60,0xa6,0x9f,0x90,0x04,0xf0,0x00,0xad,0x00,
+0x00,0x00,0x4f,0x00,0x3f,0xff,0xf6,0x00,0x5b,0xfa,0x3e,0xb2,0x9e,0x10,0x06,0xdf,
+0xcb,0x59,0x02,0xfb,0x25,0x04,0xf0,0x1f,0x79,0x78,0x8e,0x00,0x4f,0x70,0xe7,0xf3,
+0xe6,0xe0,0x6d,0xff,0x1e,0xe9,0x1a,0xce,0x08,0xdf,0x20,0xe5,0x5f,0x36,0xe0,0x04,
+0xf0,0xcf,0xff,0xff,0xff,0xa0,0x4f,0x02,0x34,0xff,0xd4,0x32,0x2a,0xf0,0x27,0xed,
+0x2c,0xd7,0x23,0xfa,0x0e,0xe8,0x10,0x07,0xd7,0x4c,0x02,0xf3,0x3e,0x17,0xff,0xff,
+0xed,0x40,0x05,0xf1,0x0a,0x48,0x70,0xf6,0x09,0xef,0xd3,0xd7,0x9a,0x5f,0x20,0xbf,
+0xff,0x5b,0xa9,0xac,0xc3,0x00,0x6f,0x25,0xff,0xff,0xff,0xc0,0x05,0xf1,0x57,0xec,
+0x77,0x77,0x13,0x9f,0xe9,0xaf,0xc9,0x99,0x91,0xcf,0xf7,0x15,0xff,0xff,0xf4,0x02,
+0x6f,0x10,0xbf,0xe3,0x9f,0x10,0x05,0xf1,0x4f,0x8d,0xdf,0x60,0x03,0xaf,0x5f,0xe7,
+0xdf,0xfc,0x82,0x5f,0xa3,0xb2,0xd8,0x23,0x9d,0x10,0xfd,0x01,0xf0,0x26,0xf1,0x00,
+0x0b,0xb0,0x00,0x00,0x5f,0x10,0x3c,0xff,0xff,0xc0,0x5a,0xf8,0xbf,0xb7,0x29,0xf4,
+0x0a,0xff,0xf6,0x74,0xae,0xf6,0x00,0x05,0xf1,0x28,0xff,0xb3,0x00,0x00,0x5f,0x69,
+0xff,0xa4,0x44,0x40,0x8d,0xff,0x5e,0xff,0xfe,0xed,0x0a,0xdf,0x25,0xe3,0x8f,0x32,
+0x21,0x05,0xf1,0xb0,0x00,0xfa,0x53,0x70,0x5f,0x11,0xd5,0x7f,0x26,0xd0,0x3a,0xf0,
+0x0f,0xcc,0xfb,0xdf,0x05,0xfa,0x00,0x99,0x99,0x9c,0xf0,0x00,0xe7,0x01,0x8f,0x18,
+0xf1,0x00,0x0e,0x71,0xff,0xff,0xff,0xf8,0x17,0xfb,0x53,0x8d,0x38,0xe3,0x23,0xff,
+0xfb,0x8d,0xdd,0xdd,0xc0,0x00,0xe7,0x09,0xe5,0x55,0xbe,0x00,0x0e,0x82,0x9f,0xff,
+0xff,0xe0,0x28,0xff,0xd9,0xe8,0x88,0xde,0x03,0xcf,0x90,0x36,0x7f,0x96,0x50,0x00,
+0xe7,0x4f,0xff,0xff,0xff,0x90,0x0e,0x71,0x46,0xfe,0xfc,0x53,0x17,0xf7,0x27,0xef,
+0x47,0xfb,0x40,0xed,0x25,0xfb,0x20,0x06,0xe6,0xfe,0x00,0xfe,0x3e,0x3f,0x1a,0xff,
+0xbd,0xac,0x20,0x03,0xf1,0x44,0xe7,0x8f,0xa4,0x06,0xff,0xd9,0xff,0x11,0xfd,0xf4,
+0x4b,0xfa,0x7f,0x60,0x05,0xfc,0x10,0x3f,0x5f,0xff,0x5e,0xff,0xf6,0x03,0xf9,0x22,
+0xd6,0xf5,0xf4,0x05,0xef,0xea,0xef,0xde,0x1c,0xe0,0x5b,0xf2,0xb7,0x34,0xb7,0x79,
+0x00,0x3f,0x1d,0xff,0x8f,0xbd,0xd0,0x03,0xf1,0x12,0xf4,0xae,0xf6,0x02,0x7f,0x12,
+0x4f,0x37,0xff,0x40,0x3f,0xa0,0x9f,0xa7,0xd6,0x6c,0x59,0x01,0xf0,0x02,0xcc,0x20,
+0x05,0xf1,0x0a,0xa7,0xe2,0xf3,0x0b,0xff,0xf3,0x8d,0x7e,0x7d,0x00,0x7c,0xfb,0xe4,
+0x00,0xf0,0x29,0x10,0x5f,0x13,0x5e,0xff,0xf9,0x40,0x05,0xf8,0x4d,0xd9,0xe7,0xf7,
+0x06,0xdf,0xff,0xe3,0x7b,0x19,0xf3,0xce,0xf2,0x3f,0xff,0xff,0xf8,0x00,0x5f,0x11,
+0xf7,0x8d,0x3f,0x70,0x05,0xf1,0x1f,0xff,0xfe,0xf7,0x03,0x7f,0x01,0xf7,0x9d,0x3f,
+0x70,0x5f,0xa0,0x1f,0xdd,0xdd,0xe7,0x00,0x05,0xf1,0x3f,0x51,0x02,0xf2,0x06,0x5f,
+0x13,0xf3,0xe4,0xd5,0xe0,0x5a,0xf8,0x5f,0xcf,0xcf,0xce,0x0a,0xff,0xf4,0x77,0xbf,
+0x77,0x60,0x05,0xf1,0x36,0x03,0xf0,0xa2,0x43,0x55,0xaf,0x55,0x50,0x5b,0xff,0xbe,
+0xfe,0xef,0xee,0x19,0xdf,0x41,0x5f,0x84,0xbd,0x30,0x05,0xf1,0x3a,0xad,0xfa,0xa8,
+0x00,0x5f,0x1a,0xdd,0xef,0xdd,0xd3,0x3a,0xf1,0x34,0x4a,0xf4,0x44,0x15,0xfa,0x00,
+0x00,0x7f,0x00,0x00,0x4c,0xcf,0xcc,0x5c,0xff,0xc0,0x00,0x9a,0xfa,0x92,0xf4,0x7e,
+0x62,0x0f,0xaf,0x9f,0xfb,0x02,0xde,0x40,0xd9,0xf9,0xd4,0xed,0xde,0x50,0x8b,0xcf,
+0xcb,0x59,0xdb,0xd0,0x01,0xe5,0xf4,0xe7,0xaf,0xfc,0x72,0x0a,0xaa,0xaa,0x8a,0x79,
+0xed,0x10,0xdd,0xdd,0xef,0xdb,0x97,0x00,0x07,0xbb,0xbc,0xfc,0xbb,0xa0,0x0b,0xdd,
+0xdd,0xef,0xed,0xdd,0xd5,0x11,0x12,0x38,0xf5,0x11,0x11,0x00,0x00,0x0e,0xfc,0x10,
+0x00,0x00,0x03,0xf1,0x04,0xff,0xff,0xc0,0x00,0x3f,0x10,0x4f,0x11,0x7c,0x00,0x9e,
 0xfd,0x14,0xfe,0xee,0xc0,0x09,0xef,0xd1,0x27,0x76,0x75,0x00,0x03,0xf1,0x7f,0xff,
 0x6f,0xff,0x00,0x3f,0x77,0xa4,0xf6,0xd4,0xf0,0x6c,0xff,0x9f,0xff,0x7f,0xff,0x09,
-0xef,0x22,0x33,0x9f,0x53,0x30,0x03,0xf1,0xaf,0x35,0x03,0xf1,0x03,0x3f,0x10,0x2c,
-0xff,0xf7,0x00,0x18,0xf4,0xaf,0xd9,0xf8,0xfc,0x21,0xfb,0x1c,0x60,0x7f,0x23,0x89,
-0x2a,0x16,0x20,0xa1,0x01,0xf4,0x3e,0x10,0x00,0xaf,0xff,0xb0,0x03,0xf1,0x00,0x0a,
-0xd0,0x00,0x03,0x9f,0x86,0xdd,0xff,0xdd,0xd3,0x7f,0xff,0x7e,0x6c,0xc8,0x9f,0x10,
-0x3f,0x17,0xda,0xee,0xa6,0xa0,0x03,0xf8,0x7d,0x04,0xdc,0xc8,0x05,0xef,0xe9,0xcd,
-0xee,0xee,0xe0,0x5c,0xf1,0x9b,0x7d,0xf2,0x28,0x00,0x3f,0x1a,0xa7,0x9e,0xdf,0x90,
-0x03,0xf1,0xea,0xd8,0xcf,0x9a,0x02,0x8f,0x5f,0x7b,0xd7,0xf2,0xe7,0x3f,0xa4,0xa4,
-0x53,0xf9,0x03,0x20,0xfe,0x0f,0x00,0x02,0x58,0x21,0x00,0x04,0x88,0x05,0xf0,0x1a,
-0x14,0xbf,0x9a,0xeb,0x38,0x67,0xf1,0x6e,0xfe,0x2d,0xef,0xef,0xfd,0x00,0x4f,0x09,
-0xc9,0xf3,0xfb,0x80,0x04,0xf5,0x48,0xe9,0x19,0xf1,0x04,0xbf,0xf4,0xfd,0xff,0xed,
-0xc1,0x7f,0xf3,0xbd,0x45,0x55,0x5e,0x30,0x5f,0xb6,0x1c,0xfb,0x05,0x40,0x04,0xf0,
-0x08,0x85,0xf3,0xb1,0x01,0x8f,0x08,0xf5,0x8f,0x1b,0xd0,0x1f,0xb0,0x74,0x7f,0xc0,
-0x17,0x51,0x02,0xfa,0x3e,0x1c,0x88,0x6f,0xff,0xf2,0x03,0xf1,0xcf,0xe5,0x22,0xbc,
-0x03,0x9f,0x7c,0xa0,0x36,0xaf,0x40,0x7f,0xfe,0xbd,0xaf,0x4c,0xf2,0x00,0x3f,0x18,
-0xa5,0x46,0x6d,0x92,0x05,0xfd,0xef,0xeb,0xbd,0xee,0x59,0xff,0xef,0xca,0x27,0x8a,
-0xc2,0x6d,0xf3,0x9b,0xa3,0xf8,0xc4,0x00,0x3f,0x6f,0xff,0xcf,0x7f,0xf2,0x03,0xf1,
-0x1f,0x95,0xfb,0xa0,0x02,0x7f,0x3c,0xbd,0xfd,0xfd,0x64,0x3f,0xb5,0xb0,0x0b,0x15,
-0xac,0x60,0x09,0x10,0x30,0x00,0x00,0x6d,0x46,0x2b,0xf0,0x00,0x7e,0xef,0xff,0xee,
-0x76,0xbf,0x89,0xd4,0xc5,0xab,0x42,0xae,0xfd,0xac,0xdf,0x19,0x3c,0xf5,0x23,0x08,
-0xd5,0xf6,0xce,0x53,0x06,0xf7,0x9e,0x99,0xfb,0x99,0x69,0xff,0xeb,0xbd,0xdf,0xed,
-0xc0,0x8c,0xf0,0xa9,0xf8,0xf8,0x9e,0x00,0x6f,0x0c,0x7f,0x9f,0x9a,0xe0,0x06,0xf0,
-0xf4,0xfe,0xfe,0xee,0x04,0xaf,0x7f,0x3a,0xf2,0xae,0x50,0x6f,0x87,0x8a,0xd4,0x01,
-0xaf,0x14,0x0e,0x06,0x69,0x4c,0x04,0xa0,0x24,0x02,0xef,0x5a,0x10,0x03,0x69,0x44,
-0x11,0x40,0x09,0x11,0x11,0xfe,0x8a,0x5c,0x20,0x7f,0x60,0xb0,0x51,0x20,0x4f,0xc0,
-0x23,0x25,0x10,0xbf,0x06,0x00,0xf4,0x03,0x39,0xff,0xfa,0x40,0x00,0x5c,0xff,0xfa,
-0x6b,0xff,0xfd,0x41,0xd9,0x61,0x00,0x01,0x69,0xa0,0x5c,0x0c,0x30,0x0f,0x80,0xbe,
-0x9b,0x55,0x01,0x0a,0x1b,0xf6,0x32,0xe9,0x0f,0x82,0xfc,0x88,0x84,0x0e,0x90,0xf8,
-0x8f,0xff,0xff,0x80,0xe9,0x0f,0x9f,0xf1,0x0e,0x90,0x0e,0x90,0xfe,0xff,0x72,0xf5,
-0x00,0xe9,0x0f,0x88,0xad,0x7f,0x10,0x0f,0xb8,0xf8,0x02,0xff,0xa0,0x03,0xff,0xef,
-0x80,0x0c,0xf4,0x00,0x0a,0x40,0xf8,0x07,0xff,0xd1,0x00,0x00,0x0f,0x9b,0xfa,0x3e,
-0xe4,0x00,0x00,0xf8,0xb7,0x00,0x1b,0x10,0xa5,0x13,0x10,0xa0,0xc7,0x28,0xf0,0x09,
-0x90,0xdc,0x00,0x00,0x07,0x77,0xf9,0x1f,0xd8,0x88,0x30,0x00,0x0e,0x98,0xfd,0xcf,
-0xf4,0x07,0x77,0xfa,0xff,0x40,0xf9,0x00,0x64,0x1b,0x90,0x3f,0x50,0x0f,0x90,0x00,
-0x79,0xe9,0xf1,0x00,0x3c,0x5d,0xfb,0x0c,0xfb,0x00,0x0f,0x90,0x56,0x00,0xef,0x40,
+0xef,0x22,0x33,0x9f,0x53,0x30,0x03,0xf1,0xaf,0x35,0x03,0xf0,0x04,0x3f,0x10,0x2c,
+0xff,0xf7,0x00,0x18,0xf4,0xaf,0xd9,0xf8,0xfc,0x21,0xfb,0x1c,0x60,0x7f,0x23,0xa0,
+0x40,0x03,0x16,0x20,0xa1,0x01,0xf4,0x3d,0x10,0x00,0xaf,0xff,0xb0,0x03,0xf1,0x00,
+0x0a,0xd0,0x00,0x03,0x9f,0x86,0xdd,0xff,0xdd,0xd3,0x7f,0xff,0x7e,0x6c,0xc8,0x9f,
+0x10,0x3f,0x17,0xda,0xee,0xa6,0xa0,0x03,0xf8,0x7d,0x04,0xdc,0xc8,0x05,0xef,0xe9,
+0xcd,0xee,0xee,0xe0,0x5c,0xf1,0x9b,0x7d,0xf2,0x28,0x00,0x3f,0x1a,0xa7,0x9e,0xdf,
+0x90,0x03,0xf1,0xea,0xd8,0xcf,0x9a,0x02,0x8f,0x5f,0x7b,0xd7,0xf2,0xe7,0x3f,0xa4,
+0xa4,0x53,0xf9,0x03,0x57,0x00,0x71,0x4f,0x00,0x00,0x7e,0x00,0x00,0x04,0x88,0x05,
+0xfb,0x32,0x14,0xbf,0x9a,0xeb,0x38,0x67,0xf1,0x6e,0xfe,0x2d,0xef,0xef,0xfd,0x00,
+0x4f,0x09,0xc9,0xf3,0xfb,0x80,0x04,0xf5,0x48,0xe9,0x19,0xf1,0x04,0xbf,0xf4,0xfd,
+0xff,0xed,0xc1,0x7f,0xf3,0xbd,0x45,0x55,0x5e,0x30,0x5f,0x00,0xef,0xff,0xff,0x40,
+0x04,0xf0,0x08,0x85,0xf3,0xb1,0x01,0x8f,0x08,0xf5,0x8f,0x1b,0xd0,0x1f,0xb0,0x74,
+0x7f,0xc0,0x17,0x51,0x02,0xf9,0x3e,0x1c,0x88,0x6f,0xff,0xf2,0x03,0xf1,0xcf,0xe5,
+0x22,0xbc,0x03,0x9f,0x7c,0xa0,0x36,0xaf,0x40,0x7f,0xfe,0xbd,0xaf,0x4c,0xf2,0x00,
+0x3f,0x18,0xa5,0x46,0x6d,0x92,0x05,0xfd,0xef,0xeb,0xbd,0xee,0x59,0xff,0xef,0xca,
+0x27,0x8a,0xc2,0x6d,0xf3,0x9b,0xa3,0xf8,0xc4,0x00,0x3f,0x6f,0xff,0xcf,0x7f,0xf2,
+0x03,0xf1,0x1f,0x95,0xfb,0xa0,0x02,0x7f,0x3c,0xbd,0xfd,0xfd,0x64,0x3f,0xb5,0xb0,
+0x0b,0x15,0xac,0x60,0x5b,0x00,0xf4,0x40,0x6f,0x00,0x00,0x6d,0x00,0x00,0x06,0xf0,
+0x7e,0xef,0xff,0xee,0x76,0xbf,0x89,0xd4,0xc5,0xab,0x42,0xae,0xfd,0xac,0xdf,0xff,
+0xfe,0x00,0x6f,0x08,0xd5,0xf6,0xce,0x53,0x06,0xf7,0x9e,0x99,0xfb,0x99,0x69,0xff,
+0xeb,0xbd,0xdf,0xed,0xc0,0x8c,0xf0,0xa9,0xf8,0xf8,0x9e,0x00,0x6f,0x0c,0x7f,0x9f,
+0x9a,0xe0,0x06,0xf0,0xf4,0xfe,0xfe,0xee,0x04,0xaf,0x7f,0x3a,0xf2,0xae,0x50,0x6f,
+0x87,0x8a,0xd4,0x01,0xaf,0x30,0x00,0xa9,0x05,0xc0,0xf4,0x00,0x00,0x00,0x77,0x77,
+0xaf,0x97,0x77,0x70,0x0f,0xff,0x01,0x00,0x00,0xbb,0x02,0xc0,0x40,0x00,0x00,0x03,
+0x77,0x7a,0xf9,0x77,0x40,0x00,0x6f,0xff,0x77,0x02,0xf0,0x02,0x00,0x3f,0x90,0x00,
+0x7f,0x60,0x00,0x00,0x9f,0x60,0x4f,0xc0,0x00,0x00,0x00,0xbf,0xbf,0x06,0x00,0xf3,
+0x04,0x39,0xff,0xfa,0x40,0x00,0x5c,0xff,0xfa,0x6b,0xff,0xfd,0x41,0xd9,0x61,0x00,
+0x01,0x69,0xa0,0x00,0xa8,0x05,0xf5,0x3e,0x0f,0x80,0xbe,0x00,0x00,0x09,0x60,0xf8,
+0x0f,0xb0,0x00,0x00,0xe9,0x0f,0x82,0xfc,0x88,0x84,0x0e,0x90,0xf8,0x8f,0xff,0xff,
+0x80,0xe9,0x0f,0x9f,0xf1,0x0e,0x90,0x0e,0x90,0xfe,0xff,0x72,0xf5,0x00,0xe9,0x0f,
+0x88,0xad,0x7f,0x10,0x0f,0xb8,0xf8,0x02,0xff,0xa0,0x03,0xff,0xef,0x80,0x0c,0xf4,
+0x00,0x0a,0x40,0xf8,0x07,0xff,0xd1,0x00,0x00,0x0f,0x9b,0xfa,0x3e,0xe4,0x00,0x00,
+0xf8,0xb7,0x00,0x1b,0x10,0x00,0x01,0xfa,0x3c,0x07,0xa0,0x00,0x01,0xff,0xff,0x90,
+0xdc,0x00,0x00,0x07,0x77,0xf9,0x1f,0xd8,0x88,0x30,0x00,0x0e,0x98,0xfd,0xcf,0xf4,
+0x07,0x77,0xfa,0xff,0x40,0xf9,0x00,0xff,0xff,0xff,0xf9,0x3f,0x50,0x0f,0x90,0x00,
+0x79,0xe9,0xf1,0x00,0xf9,0x00,0x00,0x3f,0xfb,0x00,0x0f,0x90,0x56,0x00,0xef,0x40,
 0x00,0xfe,0xef,0xa0,0x9f,0xfc,0x10,0x4f,0xfa,0x33,0xdf,0xb7,0xfe,0x40,0x81,0x00,
-0x1e,0x70,0x05,0x36,0x29,0x40,0x07,0xd0,0x00,0x9d,0x1d,0x0d,0x30,0x20,0x0d,0xc0,
-0x74,0x1e,0xf0,0x02,0xf2,0xfe,0xaa,0xa4,0x49,0xf7,0x66,0x7f,0xcc,0xfd,0x40,0x5f,
-0x65,0x3e,0xf5,0x4f,0x40,0xc3,0x0c,0xf0,0x05,0xa8,0xf0,0x00,0x7f,0x1d,0xaa,0x8f,
-0xdc,0x00,0x08,0xe0,0xd9,0x02,0xff,0x60,0x00,0xbc,0x0e,0x80,0x0e,0x3e,0x52,0xf5,
-0x02,0xf8,0x0a,0xff,0xc1,0x0a,0xf5,0x7f,0x9d,0xf7,0x6f,0xe3,0x68,0x3f,0xd3,0xd5,
-0x00,0x5b,0x5b,0x0e,0x30,0x00,0x0c,0xa0,0x91,0x0d,0x00,0x51,0x0d,0xa0,0x56,0xbf,
-0x76,0x6f,0xb8,0x88,0x2c,0xff,0xff,0xfd,0x42,0x1d,0xf7,0x24,0x8f,0x03,0xff,0x12,
-0xf6,0x00,0x29,0xf3,0xcf,0xf7,0x7f,0x20,0x4f,0xff,0xfc,0x4c,0xcc,0xe0,0x04,0xf6,
-0x3c,0xb0,0x6f,0xf7,0x00,0x4f,0x20,0xbb,0x01,0xff,0x10,0x04,0xf9,0x7d,0xb0,0xaf,
-0xf8,0x00,0x4f,0xff,0xfd,0xdf,0x8b,0xfa,0x12,0x81,0x00,0x7d,0x40,0x08,0xe1,0x1b,
-0x10,0x10,0x20,0x26,0x3a,0x00,0x9f,0x2e,0x50,0x16,0x6e,0xb6,0x60,0xf6,0x0a,0x0d,
-0xf0,0x12,0xfe,0x4f,0xff,0xf8,0x02,0xe2,0x7c,0x0a,0xe7,0xce,0x40,0xac,0x02,0xf8,
-0xfb,0x0d,0xb0,0x5f,0x81,0xed,0xef,0xf2,0xf7,0x01,0x9e,0xef,0x32,0x9f,0xbf,0x30,
-0x00,0x3f,0xe0,0x61,0x53,0xf0,0x08,0x06,0xff,0x90,0x07,0xf9,0x00,0x04,0xfa,0x9f,
-0x34,0xff,0xf4,0x04,0xfc,0x00,0x6a,0xfc,0x1b,0xf6,0x06,0x00,0x00,0xa8,0x8e,0x5a,
-0x11,0x10,0x55,0x00,0x10,0x6f,0xed,0x2b,0x00,0x65,0x24,0xf0,0x0f,0xe5,0xf3,0x00,
+0x1e,0x70,0x05,0xd1,0xb4,0x01,0xf4,0x3e,0x07,0xd0,0x00,0x9d,0x00,0x00,0x00,0x5e,
+0x20,0x0d,0xc0,0x00,0x0a,0xff,0xff,0xf2,0xfe,0xaa,0xa4,0x49,0xf7,0x66,0x7f,0xcc,
+0xfd,0x40,0x5f,0x65,0x3e,0xf5,0x4f,0x40,0x06,0xff,0xff,0xff,0xa8,0xf0,0x00,0x7f,
+0x1d,0xaa,0x8f,0xdc,0x00,0x08,0xe0,0xd9,0x02,0xff,0x60,0x00,0xbc,0x0e,0x80,0x0e,
+0xf2,0x00,0x1f,0x90,0xf8,0x0a,0xff,0xc1,0x0a,0xf5,0x7f,0x9d,0xf7,0x6f,0xe3,0x68,
+0x3f,0xd3,0xd5,0x00,0x5b,0x55,0x00,0xf3,0x3e,0x8f,0x00,0x0c,0xa0,0x00,0x00,0x08,
+0xf0,0x01,0xf9,0x00,0x00,0x56,0xbf,0x76,0x6f,0xb8,0x88,0x2c,0xff,0xff,0xfd,0xff,
+0xff,0xf5,0x00,0x8f,0x03,0xff,0x12,0xf6,0x00,0x29,0xf3,0xcf,0xf7,0x7f,0x20,0x4f,
+0xff,0xfc,0x4c,0xcc,0xe0,0x04,0xf6,0x3c,0xb0,0x6f,0xf7,0x00,0x4f,0x20,0xbb,0x01,
+0xff,0x10,0x04,0xf9,0x7d,0xb0,0xaf,0xf8,0x00,0x4f,0xff,0xfd,0xdf,0x8b,0xfa,0x12,
+0x81,0x00,0x7d,0x40,0x08,0xe1,0x55,0x00,0x00,0x5e,0x01,0xf1,0x44,0x20,0x00,0x00,
+0x02,0xf5,0x00,0x0d,0x90,0x00,0x16,0x6e,0xb6,0x60,0xf6,0x00,0x04,0xff,0xff,0xfe,
+0x4f,0xff,0xf8,0x02,0xe2,0x7c,0x0a,0xe7,0xce,0x40,0xac,0x02,0xf8,0xfb,0x0d,0xb0,
+0x5f,0x81,0xed,0xef,0xf2,0xf7,0x01,0x9e,0xef,0x32,0x9f,0xbf,0x30,0x00,0x3f,0xe0,
+0x00,0xaf,0xc0,0x00,0x06,0xff,0x90,0x07,0xf9,0x00,0x04,0xfa,0x9f,0x34,0xff,0xf4,
+0x04,0xfc,0x00,0x6a,0xfc,0x1b,0xf6,0x06,0x00,0x00,0xa8,0x00,0x0a,0x20,0x00,0x10,
+0x55,0x00,0xf4,0x3e,0x6f,0x10,0x00,0x0f,0x70,0x00,0x0a,0xfe,0xee,0xe5,0xf3,0x00,
 0x01,0xfa,0x66,0x66,0x7f,0xdd,0xd5,0x8f,0x64,0x44,0x1d,0xff,0xff,0x65,0xff,0xff,
-0xfa,0xfd,0x0c,0xb0,0x0b,0xbb,0x5f,0xcf,0xf2,0xf8,0x0a,0xa0,0x40,0xe0,0xbf,0x40,
-0x3e,0xbe,0x6f,0x80,0xaf,0xe0,0x00,0xf7,0xc9,0xf4,0x05,0xf9,0xfd,0x27,0xf4,0x02,
-0xf1,0xcf,0xe1,0x00,0x22,0x6b,0xf5,0xdf,0x6e,0xd2,0x00,0x0a,0xf9,0x2c,0x20,0x3c,
-0x10,0xff,0x0b,0x30,0xab,0x40,0xd8,0x5c,0x0b,0xf7,0x36,0xac,0x1f,0x80,0x00,0x5b,
-0xbf,0xec,0xc4,0xfa,0x77,0x44,0xbb,0xfe,0xbb,0x8f,0xff,0xf8,0x08,0x1e,0xa9,0x5e,
-0xe0,0xbb,0x00,0xda,0xee,0xf9,0xff,0x2f,0x80,0x05,0xae,0xf5,0x3c,0xeb,0xf5,0x00,
-0x09,0xff,0xc2,0x09,0xff,0x00,0x4e,0xef,0xce,0xd0,0x5f,0xa0,0x04,0xb1,0xe9,0x12,
-0x2e,0xff,0x40,0x02,0x5f,0x90,0x8f,0xf5,0xdf,0x50,0x2f,0xe4,0x08,0xc3,0x01,0xc2,
-0x6c,0x10,0x10,0x50,0x3a,0x2a,0xf0,0x22,0xe0,0xbf,0x00,0x00,0x0e,0xa3,0xae,0x0e,
-0xc0,0x00,0x00,0xe9,0x19,0xe3,0xff,0xff,0xf8,0x0e,0xff,0xfe,0xaf,0xdc,0xfe,0x60,
-0xe8,0x09,0xff,0xf6,0x3f,0x70,0x0e,0xff,0xff,0xfe,0xb7,0xf3,0x00,0xea,0x3a,0xe2,
-0x8f,0xcf,0x00,0x0e,0xa4,0xbe,0x02,0xff,0x90,0x34,0x00,0xf0,0x0b,0x0e,0xf4,0x00,
-0x05,0xc3,0xc3,0x07,0xff,0xc0,0x01,0xec,0x0b,0xeb,0xfc,0x9f,0xd3,0x7f,0x20,0x28,
-0xf9,0x00,0x8f,0x40,0x10,0x00,0x01,0xb4,0x0e,0x40,0x6f,0x01,0x93,0xd8,0xf1,0x22,
-0xf6,0x36,0xcf,0x4f,0x70,0x00,0x04,0x9f,0x6f,0xa5,0xfd,0xcc,0x92,0x6a,0xfa,0xf9,
-0xbf,0xff,0xfb,0x5e,0xef,0xfe,0xef,0xf0,0xbd,0x00,0x3d,0xff,0xcc,0xff,0x4f,0xa0,
-0x2c,0xfd,0xfe,0x59,0xeb,0xf6,0x02,0xd5,0x9e,0x10,0x09,0xff,0x10,0x39,0xaf,0xfe,
-0xe0,0x5f,0xb0,0x03,0xa9,0xec,0x54,0x3e,0xff,0x40,0x00,0x4e,0xa0,0x9f,0xe4,0xcf,
-0x70,0x0f,0xe5,0x07,0xb1,0x00,0xb3,0xeb,0x42,0xf1,0x1d,0xc1,0xf5,0x00,0x00,0x45,
-0xdb,0x53,0x8f,0xee,0xe8,0x0c,0xff,0xff,0xcf,0xe5,0xfa,0x30,0xc6,0xc9,0xbd,0xef,
-0x9f,0x10,0x0a,0xef,0xfe,0x71,0xaf,0xa0,0x00,0x8f,0xfc,0xe6,0x9f,0xdf,0xb4,0x0b,
-0x49,0x63,0x3c,0x51,0x4c,0x40,0x6f,0xca,0x2e,0xf2,0x05,0x01,0x47,0x35,0xf8,0x55,
-0x41,0x00,0x05,0xf1,0x2f,0xff,0xf8,0x00,0x04,0x8f,0x56,0xf7,0x44,0x44,0x23,0xab,
-0x21,0xb1,0x02,0x3d,0x83,0x10,0xc6,0x00,0x00,0x9d,0xec,0xf7,0x0f,0x32,0x3e,0xf0,
-0x14,0xf7,0xfd,0xcc,0x30,0x9d,0xeb,0xf7,0x5f,0x9f,0xc2,0x05,0x9e,0xb9,0x4a,0xf2,
-0xf4,0x00,0xef,0xff,0xfd,0xff,0x7f,0x20,0x0e,0xbe,0xbd,0xca,0xbd,0xf0,0x00,0x69,
-0xf7,0x74,0x06,0xfa,0xa1,0x01,0xf5,0x09,0x50,0x2f,0x60,0x00,0x5f,0x5a,0xb0,0x0a,
-0xfd,0x00,0x03,0xcf,0xf8,0x19,0xf5,0xdb,0x14,0xfd,0x66,0xa4,0xf5,0x01,0xc1,0x02,
-0x0d,0x10,0x12,0x11,0xbe,0x04,0x02,0x69,0x0a,0x14,0xed,0x12,0x49,0xa1,0xfa,0x18,
-0x9f,0xd8,0x88,0xaf,0xc8,0x50,0x00,0xae,0x21,0x39,0x40,0x03,0xf8,0x01,0xec,0x39,
-0x18,0x31,0xf4,0xbf,0x30,0xdb,0x36,0x11,0x70,0x74,0x2a,0x10,0xf7,0x77,0x5c,0xd1,
-0xff,0x9c,0xfd,0x50,0x02,0xcf,0xfc,0x30,0x07,0xff,0xf8,0x0b,0x93,0x11,0x1a,0x04,
-0xad,0x01,0x11,0x8d,0x06,0x0e,0xf0,0x2e,0x5f,0xfa,0x15,0xd1,0xe9,0x00,0x8f,0xa5,
-0xfe,0x4c,0xdf,0x90,0x5f,0xfa,0x9c,0xc1,0x15,0xe9,0x01,0xab,0xfe,0xb0,0x96,0x0e,
-0x90,0x04,0x4e,0xb4,0x49,0xf7,0xe9,0x01,0xff,0xff,0xfe,0x07,0x2e,0x90,0x03,0x3e,
-0x95,0x10,0x47,0xff,0xa0,0xb9,0xd9,0xe7,0xef,0xff,0xc4,0x1f,0x3d,0x99,0xe5,0x30,
-0xe9,0x03,0xd6,0xf8,0x36,0x41,0x00,0x00,0xd3,0x1e,0x15,0xe9,0x0b,0x05,0xe0,0x04,
-0xf2,0x00,0x4c,0xe2,0x2a,0xf6,0x9f,0x76,0xef,0xe7,0x15,0xff,0xff,0xe8,0x82,0xf0,
-0x12,0x06,0xf6,0x9f,0x29,0xd0,0x00,0x00,0x6f,0x9b,0xf2,0x9f,0xff,0xf8,0x06,0xf8,
-0xaf,0x29,0xe7,0xfb,0x40,0x6f,0xbc,0xf2,0x9c,0x0f,0x70,0x29,0xf4,0x7f,0x6b,0xa0,
-0xf7,0x08,0x33,0x10,0xf4,0x06,0x0f,0x70,0x03,0xc4,0x97,0x2f,0x60,0xf7,0x01,0xdd,
-0x08,0xfa,0xf1,0x0f,0x70,0x2b,0x20,0x03,0xd7,0x00,0xf7,0xb6,0x04,0x23,0x02,0x00,
-0x8e,0x3d,0xf1,0x06,0x04,0x8d,0xc0,0x1e,0xef,0xfe,0xbb,0xfc,0x83,0x00,0x7e,0x58,
-0xe4,0xbb,0x00,0x00,0x02,0xf2,0x9c,0x0b,0xb0,0x6a,0x03,0xf2,0x21,0xbf,0xdd,0xd7,
-0x14,0x4d,0xb4,0x4b,0xea,0xfd,0x51,0x55,0xeb,0x54,0xba,0x0f,0x80,0x3e,0xef,0xfe,
-0xac,0x90,0xf8,0x00,0x66,0xca,0xa1,0xe8,0x0f,0x80,0x1f,0x6c,0x9c,0xaf,0x60,0xf8,
-0x01,0x93,0xd9,0x39,0xf2,0x0f,0x80,0x00,0xad,0x40,0x5a,0x00,0xf8,0x82,0x1f,0xf0,
-0x3a,0x10,0x00,0x02,0x00,0x20,0x00,0x20,0x03,0xf2,0xd1,0x68,0x03,0x9f,0xb0,0x3f,
-0xac,0xbe,0xc5,0xfd,0x60,0x03,0xf8,0xe3,0xbc,0x1f,0x30,0x00,0x3f,0xbe,0xae,0xd7,
-0xf3,0x00,0x03,0xf9,0x8a,0x97,0x7f,0xdc,0xc6,0x3f,0xdd,0xdd,0xd8,0xfa,0xfb,0x43,
-0xf1,0xc1,0x68,0x0f,0x3e,0x60,0x3f,0xad,0xbe,0xc5,0xf2,0xe6,0x03,0xf7,0xd4,0xbc,
-0x4f,0x1e,0x60,0x3f,0xaa,0xbc,0xbc,0xe0,0xe6,0x03,0xc3,0x00,0x87,0x0e,0x60,0x03,
-0x33,0x33,0x36,0x40,0xe6,0x73,0x06,0x12,0x50,0x25,0x13,0x05,0xa5,0x5b,0x92,0x09,
-0x99,0xfe,0x99,0x99,0x99,0x40,0x00,0x0f,0x4c,0x16,0x01,0x58,0x39,0x51,0x00,0x3f,
-0xb8,0x88,0xcf,0x0c,0x2e,0x21,0x09,0xf0,0xa3,0x69,0x10,0xbd,0x7e,0x57,0x00,0x16,
-0x3a,0x50,0xbf,0xb0,0x07,0x79,0xf7,0xad,0x04,0x3b,0xaf,0xfb,0x10,0x08,0x24,0x11,
-0xd0,0xcb,0x50,0x20,0x4f,0x40,0x96,0x04,0xf0,0x14,0xff,0xff,0xf1,0x8f,0xfb,0x00,
-0x29,0xf8,0x66,0x8f,0xa4,0xf9,0x00,0x5f,0x52,0x6f,0xc0,0x08,0xf8,0x05,0xff,0xfc,
-0x72,0xc6,0x06,0x00,0x6f,0x4c,0xb0,0x0a,0xf8,0x00,0x07,0xf0,0xbb,0x85,0x23,0x40,
-0xac,0x0c,0xa0,0x42,0xf1,0x01,0xf5,0x02,0xd9,0x0e,0xf8,0x00,0x06,0xf5,0x6f,0x80,
-0x1a,0xfd,0x20,0x4b,0x0f,0xd2,0x00,0x06,0xd0,0xde,0x21,0x30,0x00,0x2e,0x60,0x59,
-0x2b,0xf7,0x36,0x08,0xfa,0x66,0x63,0x7f,0xff,0xfe,0xef,0xff,0xff,0x73,0x8f,0x86,
+0xfa,0xfd,0x0c,0xb0,0x0b,0xbb,0x5f,0xcf,0xf2,0xf8,0x0a,0xff,0xff,0xff,0x4f,0xbf,
+0x40,0x3e,0xbe,0x6f,0x80,0xaf,0xe0,0x00,0xf7,0xc9,0xf4,0x05,0xf9,0x00,0x2f,0xff,
+0xff,0xf1,0xcf,0xe1,0x00,0x22,0x6b,0xf5,0xdf,0x6e,0xd2,0x00,0x0a,0xf9,0x2c,0x20,
+0x3c,0xb5,0x01,0xf6,0x3e,0x0e,0xab,0x40,0xd8,0x00,0x00,0x00,0xea,0xac,0x1f,0x80,
+0x00,0x5b,0xbf,0xec,0xc4,0xfa,0x77,0x44,0xbb,0xfe,0xbb,0x8f,0xff,0xf8,0x08,0x1e,
+0xa9,0x5e,0xe0,0xbb,0x00,0xda,0xee,0xf9,0xff,0x2f,0x80,0x05,0xae,0xf5,0x3c,0xeb,
+0xf5,0x00,0x09,0xff,0xc2,0x09,0xff,0x00,0x4e,0xef,0xce,0xd0,0x5f,0xa0,0x04,0xb1,
+0xe9,0x12,0x2e,0xff,0x40,0x02,0x5f,0x90,0x8f,0xf5,0xdf,0x50,0x2f,0xe4,0x08,0xc3,
+0x01,0xc2,0xb1,0x01,0xf0,0x28,0x04,0x50,0x00,0x00,0xef,0xff,0xe0,0xbf,0x00,0x00,
+0x0e,0xa3,0xae,0x0e,0xc0,0x00,0x00,0xe9,0x19,0xe3,0xff,0xff,0xf8,0x0e,0xff,0xfe,
+0xaf,0xdc,0xfe,0x60,0xe8,0x09,0xff,0xf6,0x3f,0x70,0x0e,0xff,0xff,0xfe,0xb7,0xf3,
+0x00,0xea,0x3a,0xe2,0x8f,0xcf,0x00,0x0e,0xa4,0xbe,0x02,0xff,0x90,0x34,0x00,0xf0,
+0x09,0x0e,0xf4,0x00,0x05,0xc3,0xc3,0x07,0xff,0xc0,0x01,0xec,0x0b,0xeb,0xfc,0x9f,
+0xd3,0x7f,0x20,0x28,0xf9,0x00,0x8f,0x40,0x10,0x5b,0x01,0xf3,0x40,0x10,0x00,0x6f,
+0x01,0x93,0xd8,0x00,0x00,0xdf,0xff,0xcf,0x4f,0x70,0x00,0x04,0x9f,0x6f,0xa5,0xfd,
+0xcc,0x92,0x6a,0xfa,0xf9,0xbf,0xff,0xfb,0x5e,0xef,0xfe,0xef,0xf0,0xbd,0x00,0x3d,
+0xff,0xcc,0xff,0x4f,0xa0,0x2c,0xfd,0xfe,0x59,0xeb,0xf6,0x02,0xd5,0x9e,0x10,0x09,
+0xff,0x10,0x39,0xaf,0xfe,0xe0,0x5f,0xb0,0x03,0xa9,0xec,0x54,0x3e,0xff,0x40,0x00,
+0x4e,0xa0,0x9f,0xe4,0xcf,0x70,0x0f,0xe5,0x07,0xb1,0x00,0xb3,0xad,0x00,0xf0,0x21,
+0x1f,0xff,0xff,0xc1,0xf5,0x00,0x00,0x45,0xdb,0x53,0x8f,0xee,0xe8,0x0c,0xff,0xff,
+0xcf,0xe5,0xfa,0x30,0xc6,0xc9,0xbd,0xef,0x9f,0x10,0x0a,0xef,0xfe,0x71,0xaf,0xa0,
+0x00,0x8f,0xfc,0xe6,0x9f,0xdf,0xb4,0x0b,0x49,0x63,0x3c,0x51,0x4c,0x40,0x6f,0xff,
+0x17,0x09,0xf1,0x05,0x01,0x47,0x35,0xf8,0x55,0x41,0x00,0x05,0xf1,0x2f,0xff,0xf8,
+0x00,0x04,0x8f,0x56,0xf7,0x44,0x44,0x23,0x9d,0x03,0xf0,0x25,0xfa,0x02,0x3d,0x83,
+0x10,0xc6,0x00,0x00,0x9d,0xec,0xf7,0x0f,0x50,0x00,0x8f,0xff,0xff,0xf7,0xfd,0xcc,
+0x30,0x9d,0xeb,0xf7,0x5f,0x9f,0xc2,0x05,0x9e,0xb9,0x4a,0xf2,0xf4,0x00,0xef,0xff,
+0xfd,0xff,0x7f,0x20,0x0e,0xbe,0xbd,0xca,0xbd,0xf0,0x00,0x69,0xf7,0x74,0x06,0xfa,
+0xa1,0x01,0xf4,0x09,0x50,0x2f,0x60,0x00,0x5f,0x5a,0xb0,0x0a,0xfd,0x00,0x03,0xcf,
+0xf8,0x19,0xf5,0xdb,0x14,0xfd,0x66,0xa4,0xf5,0x01,0xc1,0x02,0x59,0x09,0x22,0x00,
+0x11,0xbe,0x04,0x02,0x69,0x0a,0x42,0xed,0x00,0x00,0x02,0x6f,0x00,0xf0,0x09,0x18,
+0x9f,0xd8,0x88,0xaf,0xc8,0x50,0x00,0xae,0x00,0x08,0xf3,0x00,0x00,0x03,0xf8,0x01,
+0xec,0x00,0x00,0x00,0x0a,0xf4,0xbf,0x3f,0x04,0x30,0x0d,0xff,0x70,0x93,0x02,0xf5,
+0x08,0xbf,0xf7,0x00,0x00,0x00,0x18,0xff,0x9c,0xfd,0x50,0x02,0xcf,0xfc,0x30,0x07,
+0xff,0xf8,0x0b,0x93,0x00,0x00,0x00,0x6c,0xc3,0x05,0x30,0x8d,0x00,0x00,0x09,0x0a,
+0xf0,0x2d,0xfa,0x15,0xd1,0xe9,0x00,0x8f,0xa5,0xfe,0x4c,0xdf,0x90,0x5f,0xfa,0x9c,
+0xc1,0x15,0xe9,0x01,0xab,0xfe,0xb0,0x96,0x0e,0x90,0x04,0x4e,0xb4,0x49,0xf7,0xe9,
+0x01,0xff,0xff,0xfe,0x07,0x2e,0x90,0x03,0x3e,0x95,0x10,0x47,0xff,0xa0,0xb9,0xd9,
+0xe7,0xef,0xff,0xc4,0x1f,0x3d,0x99,0xe5,0x30,0xe9,0x03,0xd6,0xf8,0x36,0x41,0x00,
+0x55,0xee,0x30,0x00,0x00,0xe9,0x0b,0x05,0xf4,0x3d,0x04,0xf2,0x00,0x4c,0xe2,0x2a,
+0xf6,0x9f,0x76,0xef,0xe7,0x15,0xff,0xff,0xfe,0x9e,0x30,0x00,0x06,0xf6,0x9f,0x29,
+0xd0,0x00,0x00,0x6f,0x9b,0xf2,0x9f,0xff,0xf8,0x06,0xf8,0xaf,0x29,0xe7,0xfb,0x40,
+0x6f,0xbc,0xf2,0x9c,0x0f,0x70,0x29,0xf4,0x7f,0x6b,0xa0,0xf7,0x08,0xff,0xff,0xff,
+0xc9,0x0f,0x70,0x03,0xc4,0x97,0x2f,0x60,0xf7,0x01,0xdd,0x08,0xfa,0xf1,0x0f,0x70,
+0x2b,0x20,0x03,0xd7,0x00,0xf7,0xb6,0x04,0x12,0x02,0x63,0x03,0xf1,0x08,0xf7,0x00,
+0x04,0x8d,0xc0,0x1e,0xef,0xfe,0xbb,0xfc,0x83,0x00,0x7e,0x58,0xe4,0xbb,0x00,0x00,
+0x02,0xf2,0x9c,0x0b,0xb0,0x6a,0x03,0xf1,0x22,0xbf,0xdd,0xd7,0x14,0x4d,0xb4,0x4b,
+0xea,0xfd,0x51,0x55,0xeb,0x54,0xba,0x0f,0x80,0x3e,0xef,0xfe,0xac,0x90,0xf8,0x00,
+0x66,0xca,0xa1,0xe8,0x0f,0x80,0x1f,0x6c,0x9c,0xaf,0x60,0xf8,0x01,0x93,0xd9,0x39,
+0xf2,0x0f,0x80,0x00,0xad,0x40,0x5a,0x00,0xf8,0x00,0x58,0x00,0xf0,0x3a,0x10,0x00,
+0x02,0x00,0x20,0x00,0x20,0x03,0xf2,0xd1,0x68,0x03,0x9f,0xb0,0x3f,0xac,0xbe,0xc5,
+0xfd,0x60,0x03,0xf8,0xe3,0xbc,0x1f,0x30,0x00,0x3f,0xbe,0xae,0xd7,0xf3,0x00,0x03,
+0xf9,0x8a,0x97,0x7f,0xdc,0xc6,0x3f,0xdd,0xdd,0xd8,0xfa,0xfb,0x43,0xf1,0xc1,0x68,
+0x0f,0x3e,0x60,0x3f,0xad,0xbe,0xc5,0xf2,0xe6,0x03,0xf7,0xd4,0xbc,0x4f,0x1e,0x60,
+0x3f,0xaa,0xbc,0xbc,0xe0,0xe6,0x03,0xc3,0x00,0x87,0x0e,0x60,0x03,0x33,0x33,0x36,
+0x40,0xe6,0x73,0x06,0x11,0x50,0x07,0x00,0x41,0xeb,0x00,0x00,0x01,0xb5,0x01,0xb0,
+0xf7,0x09,0x99,0xfe,0x99,0x99,0x99,0x40,0x00,0x0f,0xb0,0x19,0x00,0x00,0x1a,0x05,
+0xf0,0x05,0xf1,0x00,0x00,0x3f,0xb8,0x88,0xcf,0x00,0x00,0x07,0xf3,0x00,0x09,0xf0,
+0x00,0x00,0xee,0x00,0x00,0xbd,0xce,0x05,0x90,0x00,0x0e,0xb0,0x00,0xbf,0xb0,0x07,
+0x79,0xf7,0xad,0x04,0x3a,0xaf,0xfb,0x10,0x18,0x05,0x20,0x08,0xd0,0x03,0x00,0x30,
+0x00,0x4f,0x40,0x96,0x04,0xf0,0x1c,0xff,0xff,0xf1,0x8f,0xfb,0x00,0x29,0xf8,0x66,
+0x8f,0xa4,0xf9,0x00,0x5f,0x52,0x6f,0xc0,0x08,0xf8,0x05,0xff,0xfc,0x72,0xc6,0x06,
+0x00,0x6f,0x4c,0xb0,0x0a,0xf8,0x00,0x07,0xf0,0xbb,0x00,0x08,0x40,0x00,0xac,0x0c,
+0xa0,0x42,0xf1,0x01,0xf4,0x02,0xd9,0x0e,0xf8,0x00,0x06,0xf5,0x6f,0x80,0x1a,0xfd,
+0x20,0x4b,0x0f,0xd2,0x00,0x06,0xd0,0x55,0x00,0xf3,0x3e,0x8a,0x00,0x2e,0x60,0x00,
+0x00,0x06,0xf2,0x08,0xfa,0x66,0x63,0x7f,0xff,0xfe,0xef,0xff,0xff,0x73,0x8f,0x86,
 0xcf,0x61,0x11,0x10,0x04,0xf6,0x33,0xcf,0xff,0xff,0x60,0x5f,0xff,0x82,0x39,0xf7,
 0xf2,0x06,0xf3,0xe7,0x79,0x7e,0x27,0x00,0x7e,0x0e,0x7b,0xb7,0xff,0xf1,0x0a,0xc0,
 0xf6,0xcd,0x7f,0x55,0x00,0xe8,0x0f,0x6f,0xfd,0xe0,0x00,0x7f,0x47,0xfa,0xf7,0xff,
-0x99,0x53,0x93,0xfb,0x47,0x04,0x9c,0xc5,0xf8,0x25,0x61,0xf0,0xfd,0x88,0x88,0x8d,
-0xf0,0x23,0x2c,0x06,0x05,0x00,0x02,0x19,0x00,0x00,0x89,0x36,0x06,0x14,0x00,0x00,
-0xea,0x60,0x02,0x19,0x00,0x13,0xfa,0xf5,0x5c,0xf3,0x0f,0x12,0x22,0x22,0x01,0xff,
-0xff,0x38,0xff,0xff,0xf1,0x1f,0x98,0xf3,0x8f,0x33,0x9f,0x11,0xf5,0x2f,0x38,0xf0,
-0x07,0xf1,0x1f,0x63,0xf3,0x8f,0x88,0xbf,0x11,0x1a,0x00,0xf0,0x0a,0x86,0xf3,0x8f,
-0x00,0x7f,0x11,0xf5,0x2f,0x39,0xf7,0x7b,0xf1,0x1f,0xff,0xf3,0xcf,0xdd,0xef,0x11,
-0xfa,0x77,0x2f,0x80,0x07,0xf1,0x55,0x01,0x00,0xa7,0x4f,0x96,0x03,0xfb,0x02,0x7c,
-0xf0,0x00,0x00,0x3d,0x10,0xe9,0x28,0x02,0x92,0x12,0x5f,0x0f,0xa3,0x33,0x33,0xbe,
-0x0d,0x00,0x02,0xf3,0x17,0x0a,0xd4,0x48,0x53,0x33,0x00,0x03,0xff,0x9b,0xfb,0x99,
-0x94,0x03,0xfd,0x77,0x9f,0xa7,0x77,0x30,0x06,0x9d,0xde,0xfe,0xdd,0xb0,0x00,0x03,
-0x55,0x8f,0x95,0x54,0x00,0x15,0x55,0x58,0xf9,0x55,0x55,0x5a,0x39,0xf0,0x01,0x03,
-0x33,0x10,0x00,0xf6,0x00,0x02,0xff,0xf7,0x01,0x1f,0x71,0x10,0x2f,0x6e,0x76,0x01,
-0x38,0xf8,0x2c,0xf4,0xe7,0x6f,0x4f,0x99,0xf0,0x2f,0x9f,0x76,0xf0,0xf6,0x6f,0x02,
-0xff,0xf7,0x6f,0x0f,0x66,0xf0,0x2f,0x4e,0x9e,0xfc,0xfe,0xef,0x72,0xf4,0xe8,0x66,
-0xaf,0xf6,0x63,0x2f,0xff,0x70,0x0c,0xef,0x60,0x02,0xf9,0x63,0x09,0xf5,0x9e,0x20,
-0x1c,0x30,0x4c,0xf8,0x01,0xee,0x40,0x00,0x08,0xd5,0x00,0x02,0xd4,0x00,0x3b,0x01,
-0x6f,0x00,0x0f,0x93,0x33,0x33,0xaf,0x0d,0x00,0x01,0x21,0x01,0x77,0x89,0x41,0xf1,
-0x01,0x3e,0xee,0xee,0xfe,0xee,0xee,0x30,0x05,0xb2,0x2f,0x82,0x22,0x00,0x00,0xbf,
-0x12,0xb1,0x50,0xf6,0x00,0xfa,0x3f,0x82,0x22,0x10,0x2e,0xf7,0xff,0xfb,0x76,0x77,
-0x34,0xe4,0x03,0xad,0x92,0x31,0x20,0x01,0x11,0x84,0x3d,0xf0,0x01,0x02,0xff,0xfe,
-0x26,0x6f,0xc6,0x61,0x2f,0x8b,0xe6,0xee,0xff,0xee,0x22,0xf4,0x8e,0xc5,0x03,0xf1,
-0x1e,0x2f,0x8b,0xed,0xff,0xff,0xff,0x82,0xff,0xfe,0x45,0x55,0x8f,0x73,0x2f,0x48,
-0xe8,0x99,0x9b,0xfa,0x42,0xf4,0x8e,0x7a,0x98,0xaf,0xa4,0x2f,0xff,0xe1,0xf9,0x04,
-0xf3,0x02,0xf9,0x66,0x08,0xf4,0x4f,0x30,0x1c,0x30,0x00,0x06,0x79,0xf3,0x3b,0x11,
-0x16,0xfb,0x8c,0x2d,0xc2,0x90,0x00,0x5a,0x10,0x00,0x24,0xaf,0x64,0x5e,0xe5,0x40,
-0x07,0x5c,0x41,0xc3,0x0c,0x84,0xf2,0xca,0x4f,0x20,0x00,0x7c,0x4f,0x2c,0xa8,0xb0,
-0xb1,0x04,0x10,0x03,0xf2,0x41,0x32,0x63,0x20,0x09,0xca,0x08,0x64,0x9f,0x22,0x22,
-0x29,0xf0,0x00,0x0d,0x00,0x00,0x1a,0x15,0x04,0x0d,0x00,0x00,0x83,0x26,0x00,0x7d,
-0x1e,0x01,0x8b,0x35,0x11,0xef,0x3a,0x4d,0xd3,0x0e,0xc9,0x99,0x99,0xde,0x00,0x02,
-0x77,0x7b,0xf9,0x77,0x72,0x04,0xd3,0x5b,0x11,0x59,0x6b,0x5b,0x12,0x09,0x78,0x5b,
-0xf0,0x13,0x9f,0xee,0xee,0xef,0xb0,0x00,0x03,0xb6,0x5f,0x68,0x82,0x00,0x2a,0xfd,
-0x56,0xf4,0x7e,0xf7,0x00,0xa6,0x0a,0xfc,0x10,0x08,0x90,0x1e,0xef,0xfe,0xc7,0xff,
-0xd8,0x00,0x00,0xc8,0x0d,0x5d,0xf2,0x13,0x0b,0xce,0xdd,0x98,0xe2,0x22,0x10,0xbc,
-0xed,0xd9,0x9f,0xff,0xf6,0x0a,0xbe,0xdc,0x8c,0xc0,0xf5,0x02,0xbb,0xfe,0xba,0xf8,
-0x0f,0x40,0x01,0x1b,0x81,0x3b,0x10,0xe4,0x00,0x06,0x53,0x09,0x5f,0x6f,0x54,0x44,
-0x4c,0xe0,0x0d,0x00,0x02,0x30,0x0e,0x90,0xe9,0xaf,0x26,0x91,0x0e,0x90,0x00,0x67,
-0x7f,0xc7,0xfc,0x77,0x6e,0xed,0x00,0xb1,0xe9,0x0e,0xa0,0xea,0x09,0xee,0x80,0xe9,
-0x0e,0x90,0x9e,0x3f,0x27,0xf3,0x01,0xee,0xc8,0xfc,0x8f,0xc8,0xce,0xe8,0x0e,0x90,
-0xe9,0x09,0xee,0x90,0xea,0x0e,0xa0,0x16,0x00,0x00,0x26,0x3d,0x13,0xce,0x8f,0x2f,
-0x01,0xba,0x2e,0x74,0x51,0x00,0x44,0x47,0xf9,0x44,0x41,0xf9,0x5c,0x5f,0xf8,0x36,
-0xf8,0x35,0xf5,0x0d,0x00,0x02,0x30,0x8d,0x3c,0xe1,0xbc,0x01,0x20,0xef,0xf8,0xd2,
-0x13,0xc3,0xaf,0xff,0xfe,0xb9,0x88,0x51,0xee,0x92,0x15,0x9c,0xde,0xf4,0x2f,0x16,
-0x00,0x8a,0x5b,0x10,0x8f,0x39,0x01,0x10,0xf4,0xf5,0x24,0xf2,0x12,0x5f,0x83,0x13,
-0xaf,0x33,0x05,0xff,0xff,0xf9,0xff,0xff,0xf5,0x02,0xdf,0xd3,0x17,0xff,0xe3,0x00,
-0xaf,0x7e,0xc8,0xfb,0x2f,0xd3,0x4f,0xb6,0x88,0xae,0x66,0x9e,0x40,0x1d,0x59,0x5e,
-0xf2,0x09,0xdb,0x44,0x44,0x4c,0xd0,0x00,0x0d,0xfd,0xdd,0xdd,0xfd,0x00,0x00,0xdc,
-0x55,0x55,0x5d,0xd0,0x00,0x0d,0xfe,0xee,0xee,0xfd,0x5f,0x02,0x10,0x90,0xde,0x5b,
-0x00,0xad,0x09,0xd0,0xff,0xee,0xee,0xef,0x90,0x00,0x0f,0xb8,0x88,0x88,0xf9,0x00,
-0x12,0xa0,0x24,0x13,0x51,0x81,0x47,0xf0,0x0a,0x08,0xf8,0xbf,0x68,0x88,0x86,0x00,
-0x7f,0x8b,0xf6,0xfc,0xaf,0xa0,0x07,0xff,0xff,0x1b,0xc6,0xf3,0x00,0x8f,0x5a,0xf6,
-0x1f,0xf9,0x05,0x1b,0xa5,0xbb,0xfe,0xfa,0x22,0x42,0x06,0xf4,0xb3,0x07,0xb0,0xdb,
-0x23,0x20,0xe4,0x00,0x1e,0x0a,0x43,0xbf,0x97,0x77,0x77,0x5f,0x30,0x00,0xd3,0x47,
-0x04,0xc8,0x28,0xf0,0x0e,0x00,0x03,0xef,0xe6,0x66,0x6b,0xf0,0x03,0xfe,0xdf,0xdd,
-0xdd,0xef,0x00,0x08,0x1b,0xd5,0x55,0x5a,0xf0,0x00,0x00,0xbf,0xdd,0xdd,0xff,0x00,
-0x00,0x0b,0x1a,0x00,0x00,0x03,0x6e,0x20,0x27,0xcf,0xe3,0x63,0xf6,0x42,0x02,0xfe,
-0x80,0x00,0x06,0xf0,0x6f,0x0a,0xff,0xff,0x16,0xff,0xff,0xfe,0xad,0x6a,0xf1,0x4d,
-0xfb,0xdf,0xaa,0xb0,0x6f,0x10,0x6f,0x38,0xf0,0xad,0x5a,0xf1,0x06,0xff,0xff,0x0a,
-0xff,0xff,0x10,0x6f,0x48,0xf0,0xab,0x06,0xf1,0x06,0xfd,0xef,0x0b,0xd7,0xbf,0x12,
-0x9f,0x48,0xf4,0xcf,0xde,0xf1,0x8f,0xff,0xff,0xde,0x80,0x6f,0x10,0x4c,0x39,0x83,
-0xf6,0x06,0xf1,0x1d,0xd0,0x5f,0xbf,0x26,0xbf,0x03,0xd2,0x00,0x55,0xa0,0xbf,0xc2,
-0x11,0x03,0x1b,0x40,0x10,0x2f,0xba,0x16,0x02,0x1a,0x26,0x10,0x07,0x29,0x19,0x12,
-0x40,0x1a,0x00,0x05,0xc3,0x05,0x50,0x9f,0xff,0xc9,0x99,0x40,0x96,0x1c,0x10,0x30,
-0x5c,0x2e,0xf0,0x03,0xf9,0xdf,0x40,0x00,0x7f,0xf5,0x2f,0x71,0xdf,0xa1,0x3f,0xd3,
-0x02,0xf7,0x00,0x9f,0x80,0x30,0x6a,0x2b,0x13,0x30,0x3f,0x34,0x02,0xdd,0x66,0x73,
-0x18,0x88,0x8a,0xfa,0x88,0x88,0x12,0x88,0x3d,0x40,0x05,0xfb,0xfb,0xf4,0x86,0x4f,
-0xf0,0x0a,0x5f,0x6f,0xc0,0x00,0x00,0x5f,0x74,0xf5,0x8f,0x60,0x00,0x2f,0xd0,0x4f,
-0x50,0xdf,0x40,0x3e,0xfc,0x9b,0xfb,0x9c,0xff,0x43,0xe4,0x71,0x12,0x18,0xd1,0x41,
-0x00,0x00,0x85,0x21,0xf0,0x0b,0x13,0x47,0xa9,0x00,0x0e,0x80,0x8f,0xff,0xfc,0x81,
-0x49,0xfc,0x88,0xf3,0x10,0x00,0x06,0xdf,0xec,0x8f,0x66,0x66,0x50,0x02,0xfc,0x09,
-0x9a,0x02,0xf8,0x1e,0x8f,0xf8,0xae,0xe8,0x0d,0xa0,0x0d,0xfc,0xdb,0xc9,0xe4,0xf6,
-0x06,0xde,0x82,0xcb,0x3f,0xde,0x00,0xa7,0xe8,0x0f,0x80,0xcf,0x70,0x02,0x0e,0x85,
-0xf3,0x4f,0xfb,0x00,0x00,0xe8,0xdf,0x9f,0xc7,0xfe,0x40,0x0e,0x9a,0x79,0x70,0x03,
-0xd2,0x8e,0x43,0xe4,0xf4,0x00,0x0c,0xd4,0x5f,0xa4,0x8f,0x40,0x00,0xcd,0x35,0xfa,
-0x38,0xf4,0x63,0x60,0x26,0xcd,0x34,0x0d,0x00,0x45,0x03,0x33,0x35,0xfa,0xbf,0x39,
-0xf0,0x06,0x03,0x34,0xcf,0xff,0xf7,0x33,0x10,0x06,0xee,0x6f,0x9a,0xfa,0x30,0x2e,
-0xfb,0x11,0xf8,0x06,0xef,0x80,0x63,0x2c,0x27,0x40,0x60,0x00,0xe8,0x0f,0xad,0x02,
-0x80,0x1e,0x80,0x66,0x6f,0xb6,0x62,0x6f,0xff,0xe7,0x71,0xf6,0x2b,0x04,0x9f,0xd7,
-0xae,0xef,0xfe,0xe2,0x02,0xfc,0x0b,0xd7,0xfa,0x9f,0x20,0x7f,0xf8,0xbb,0x0f,0x84,
-0xf2,0x0d,0xfa,0xfc,0xb4,0xff,0x5f,0x25,0xff,0x82,0xbb,0xbc,0xeb,0xf2,0x69,0xe8,
-0x0b,0xdf,0x48,0xef,0x20,0x2e,0x80,0xbb,0x20,0x04,0xf2,0x00,0xe8,0x0b,0xb0,0x05,
-0x9f,0x20,0x0e,0x80,0xbb,0x00,0xaf,0x6b,0x1d,0x00,0x86,0x5a,0xf0,0x2e,0x02,0x88,
-0x88,0xbf,0xa8,0x88,0x82,0x3c,0xcc,0xff,0xff,0xfc,0xcc,0x30,0x00,0xaf,0xaf,0x9f,
-0x90,0x00,0x06,0xee,0x34,0xf3,0x3e,0xe7,0x15,0xfe,0xa8,0x8a,0x88,0xac,0xf3,0x02,
-0x4f,0x97,0x77,0xaf,0x31,0x00,0x04,0xff,0xee,0xef,0xf3,0x00,0x00,0x4f,0x63,0x33,
-0x8f,0x30,0x00,0x04,0xee,0xee,0xee,0xe3,0x00,0x16,0x66,0x01,0x00,0x02,0x7a,0x01,
-0x03,0xba,0x25,0x00,0xcd,0x23,0x10,0x8e,0xb2,0x12,0x81,0x02,0x36,0xf7,0x33,0x03,
-0x7f,0xb5,0xef,0x97,0x39,0xf0,0x1a,0xc3,0xb9,0x3a,0xa3,0x00,0x5f,0xa0,0x5f,0x70,
+0x99,0x53,0x93,0xfb,0x47,0x04,0x9c,0xc5,0x54,0x00,0x00,0xf6,0x00,0xa7,0xf0,0xfd,
+0x88,0x88,0x8d,0xf0,0xf9,0x00,0x00,0x09,0x05,0x00,0x02,0x19,0x00,0x37,0x99,0x99,
+0x9d,0x14,0x00,0x42,0xfc,0x88,0x88,0x8c,0x19,0x00,0x21,0xfa,0x00,0x0d,0x01,0xf3,
+0x10,0x00,0x12,0x22,0x22,0x01,0xff,0xff,0x38,0xff,0xff,0xf1,0x1f,0x98,0xf3,0x8f,
+0x33,0x9f,0x11,0xf5,0x2f,0x38,0xf0,0x07,0xf1,0x1f,0x63,0xf3,0x8f,0x88,0xbf,0x11,
+0x1a,0x00,0xf1,0x0a,0x86,0xf3,0x8f,0x00,0x7f,0x11,0xf5,0x2f,0x39,0xf7,0x7b,0xf1,
+0x1f,0xff,0xf3,0xcf,0xdd,0xef,0x11,0xfa,0x77,0x2f,0x80,0x07,0xf1,0x55,0x01,0xf7,
+0x00,0x7f,0x10,0x00,0x03,0xfb,0x02,0x7c,0xf0,0x00,0x00,0x3d,0x10,0x2f,0xe8,0x00,
+0x98,0x00,0x7f,0xe0,0x00,0x0f,0xa3,0x33,0x33,0xbe,0x0d,0x00,0x02,0xf1,0x18,0x0a,
+0xd4,0x48,0x53,0x33,0x00,0x03,0xff,0x9b,0xfb,0x99,0x94,0x03,0xfd,0x77,0x9f,0xa7,
+0x77,0x30,0x06,0x9d,0xde,0xfe,0xdd,0xb0,0x00,0x03,0x55,0x8f,0x95,0x54,0x00,0x15,
+0x55,0x58,0xf9,0x55,0x55,0x13,0xd6,0x01,0xf8,0x41,0xf3,0x03,0x33,0x10,0x00,0xf6,
+0x00,0x02,0xff,0xf7,0x01,0x1f,0x71,0x10,0x2f,0x6e,0x76,0xff,0xff,0xff,0x02,0xf4,
+0xe7,0x6f,0x4f,0x99,0xf0,0x2f,0x9f,0x76,0xf0,0xf6,0x6f,0x02,0xff,0xf7,0x6f,0x0f,
+0x66,0xf0,0x2f,0x4e,0x9e,0xfc,0xfe,0xef,0x72,0xf4,0xe8,0x66,0xaf,0xf6,0x63,0x2f,
+0xff,0x70,0x0c,0xef,0x60,0x02,0xf9,0x63,0x09,0xf5,0x9e,0x20,0x1c,0x30,0x4c,0xf8,
+0x01,0xee,0x40,0x00,0x08,0xd5,0x00,0x02,0xd4,0x00,0x3b,0x01,0x6f,0x00,0x0f,0x93,
+0x33,0x33,0xaf,0x0d,0x00,0x01,0x20,0x01,0x77,0x01,0x00,0xf0,0x02,0x71,0x3e,0xee,
+0xee,0xfe,0xee,0xee,0x30,0x05,0xb2,0x2f,0x82,0x22,0x00,0x00,0xbf,0x12,0xae,0x0c,
+0xf4,0x04,0x2f,0xfa,0x3f,0x82,0x22,0x10,0x2e,0xf7,0xff,0xfb,0x76,0x77,0x34,0xe4,
+0x03,0xad,0xff,0xff,0xf4,0xa6,0x06,0xf0,0x06,0x11,0x10,0x00,0xe9,0x00,0x02,0xff,
+0xfe,0x26,0x6f,0xc6,0x61,0x2f,0x8b,0xe6,0xee,0xff,0xee,0x22,0xf4,0x8e,0xc5,0x03,
+0xf1,0x1d,0x2f,0x8b,0xed,0xff,0xff,0xff,0x82,0xff,0xfe,0x45,0x55,0x8f,0x73,0x2f,
+0x48,0xe8,0x99,0x9b,0xfa,0x42,0xf4,0x8e,0x7a,0x98,0xaf,0xa4,0x2f,0xff,0xe1,0xf9,
+0x04,0xf3,0x02,0xf9,0x66,0x08,0xf4,0x4f,0x30,0x1c,0x30,0x00,0x06,0x79,0x4b,0x0d,
+0x25,0x0c,0xfb,0x8e,0x02,0xe1,0x06,0x90,0x00,0x5a,0x10,0x00,0x24,0xaf,0x64,0x5e,
+0xe5,0x40,0x07,0xff,0x97,0x08,0xc3,0x0c,0x84,0xf2,0xca,0x4f,0x20,0x00,0x7c,0x4f,
+0x2c,0xa8,0xb0,0xb1,0x04,0x82,0x03,0x56,0x66,0x66,0x66,0x63,0x20,0x09,0xca,0x08,
+0x64,0x9f,0x22,0x22,0x29,0xf0,0x00,0x0d,0x00,0xb0,0x33,0x33,0x3a,0xf0,0x00,0x09,
+0xff,0xff,0xff,0xff,0x00,0xf0,0x13,0x00,0xef,0xff,0xff,0xff,0xe0,0x00,0x0e,0x80,
+0x00,0x00,0xae,0x00,0x00,0xef,0xee,0xee,0xef,0xe0,0x00,0x0e,0xc9,0x99,0x99,0xde,
+0x00,0x02,0x77,0x7b,0xf9,0x77,0x72,0x04,0xff,0x01,0x00,0xff,0x53,0xf2,0x00,0x59,
+0x99,0x99,0x99,0x60,0x00,0x09,0xe6,0x66,0x66,0xeb,0x00,0x00,0x9f,0xee,0xee,0xef,
+0xb0,0x00,0x03,0xb6,0x5f,0x68,0x82,0x00,0x2a,0xfd,0x56,0xf4,0x7e,0xf7,0x00,0xa6,
+0x0a,0xfc,0x10,0x08,0x90,0x1e,0xef,0xfe,0xc7,0xff,0xd8,0x00,0x00,0xc8,0x00,0x7e,
+0x10,0x00,0x0b,0xce,0xdd,0x98,0xe2,0x22,0x10,0xbc,0xed,0xd9,0x9f,0xff,0xf6,0x0a,
+0xbe,0xdc,0x8c,0xc0,0xf5,0x02,0xbb,0xfe,0xba,0xf8,0x0f,0x40,0x01,0x1b,0x81,0x3b,
+0x10,0xe4,0x00,0x06,0xff,0xff,0xff,0xfe,0x00,0x00,0x6f,0x54,0x44,0x4c,0xe0,0x0d,
+0x00,0x02,0xf0,0x02,0x0e,0x90,0xe9,0x00,0x00,0x00,0xe9,0x0e,0x90,0x00,0x67,0x7f,
+0xc7,0xfc,0x77,0x6e,0xff,0x17,0x00,0xc0,0xe9,0x0e,0xa0,0xea,0x09,0xee,0x80,0xe9,
+0x0e,0x90,0x9e,0xef,0x11,0x00,0xf3,0x01,0xee,0xc8,0xfc,0x8f,0xc8,0xce,0xe8,0x0e,
+0x90,0xe9,0x09,0xee,0x90,0xea,0x0e,0xa0,0x16,0x00,0x61,0xc7,0x77,0x77,0x77,0xce,
+0x2f,0xbe,0x00,0xf0,0x00,0x21,0x55,0x55,0x8f,0xa5,0x55,0x51,0x00,0x44,0x47,0xf9,
+0x44,0x41,0x00,0x0f,0x13,0x00,0x7f,0x50,0x00,0xf8,0x36,0xf8,0x35,0xf5,0x0d,0x00,
+0x02,0xf2,0x0c,0x8d,0x3c,0xe1,0x00,0x00,0x00,0x01,0xef,0xf8,0x00,0x00,0x00,0x16,
+0xaf,0xff,0xfe,0xb9,0x88,0x51,0xee,0x92,0x15,0x9c,0xde,0xf4,0x01,0x00,0x01,0x00,
+0xf0,0x3f,0x0f,0x60,0x00,0x8f,0x00,0x00,0xef,0xff,0xf4,0xff,0xff,0xe0,0x03,0x5f,
+0x83,0x13,0xaf,0x33,0x05,0xff,0xff,0xf9,0xff,0xff,0xf5,0x02,0xdf,0xd3,0x17,0xff,
+0xe3,0x00,0xaf,0x7e,0xc8,0xfb,0x2f,0xd3,0x4f,0xb6,0x88,0xae,0x66,0x9e,0x40,0x1d,
+0xff,0xff,0xff,0xfd,0x00,0x00,0xdb,0x44,0x44,0x4c,0xd0,0x00,0x0d,0xfd,0xdd,0xdd,
+0xfd,0x00,0x00,0xdc,0x55,0x55,0x5d,0xd0,0x00,0x0d,0xfe,0xee,0xee,0xfd,0x00,0x00,
+0x75,0x00,0x10,0x90,0x54,0x00,0xf2,0x08,0x00,0xf9,0x00,0x00,0xff,0xee,0xee,0xef,
+0x90,0x00,0x0f,0xb8,0x88,0x88,0xf9,0x00,0x12,0x88,0x88,0x88,0x88,0x51,0x09,0x81,
+0x01,0xf3,0x19,0x08,0xf8,0xbf,0x68,0x88,0x86,0x00,0x7f,0x8b,0xf6,0xfc,0xaf,0xa0,
+0x07,0xff,0xff,0x1b,0xc6,0xf3,0x00,0x8f,0x5a,0xf6,0x1f,0xf9,0x00,0x9f,0xff,0xff,
+0xbb,0xfe,0xfa,0x22,0x42,0x06,0xf4,0xb3,0x07,0xb0,0x00,0x01,0x00,0xc1,0x03,0xe4,
+0x00,0x00,0x00,0x07,0x77,0xbf,0x97,0x77,0x77,0x31,0x41,0x00,0x41,0xf7,0x00,0x09,
+0xf3,0x19,0x00,0x00,0x0d,0x00,0xf0,0x0e,0x00,0x03,0xef,0xe6,0x66,0x6b,0xf0,0x03,
+0xfe,0xdf,0xdd,0xdd,0xef,0x00,0x08,0x1b,0xd5,0x55,0x5a,0xf0,0x00,0x00,0xbf,0xdd,
+0xdd,0xff,0x00,0x00,0x0b,0x1a,0x00,0xf4,0x4e,0x00,0x00,0xbc,0x00,0x27,0xcf,0x00,
+0x00,0x0b,0xc0,0x02,0xfe,0x80,0x00,0x06,0xf0,0x6f,0x0a,0xff,0xff,0x16,0xff,0xff,
+0xfe,0xad,0x6a,0xf1,0x4d,0xfb,0xdf,0xaa,0xb0,0x6f,0x10,0x6f,0x38,0xf0,0xad,0x5a,
+0xf1,0x06,0xff,0xff,0x0a,0xff,0xff,0x10,0x6f,0x48,0xf0,0xab,0x06,0xf1,0x06,0xfd,
+0xef,0x0b,0xd7,0xbf,0x12,0x9f,0x48,0xf4,0xcf,0xde,0xf1,0x8f,0xff,0xff,0xde,0x80,
+0x6f,0x10,0x4c,0x39,0x83,0xf6,0x06,0xf1,0x1d,0xd0,0x5f,0xbf,0x26,0xbf,0x03,0xd2,
+0x00,0x55,0xa0,0xbf,0x90,0x00,0x01,0x00,0x21,0x02,0xf7,0x07,0x00,0x50,0x2f,0x80,
+0x00,0x00,0x01,0x96,0x00,0x82,0xf9,0x00,0x07,0x77,0x8f,0xb7,0x77,0x40,0x1a,0x00,
+0x12,0x01,0xb7,0x00,0xf1,0x1c,0x09,0x99,0x9f,0xff,0xc9,0x99,0x40,0x00,0x0c,0xff,
+0xff,0x30,0x00,0x00,0x1c,0xf7,0xf9,0xdf,0x40,0x00,0x7f,0xf5,0x2f,0x71,0xdf,0xa1,
+0x3f,0xd3,0x02,0xf7,0x00,0x9f,0x80,0x30,0x00,0x2f,0x70,0x00,0x30,0x00,0x00,0x04,
+0xf5,0x4e,0x00,0xb1,0x4f,0x50,0x00,0x00,0x18,0x88,0x8a,0xfa,0x88,0x88,0x12,0x41,
+0x00,0xf9,0x19,0xf3,0x00,0x05,0xfb,0xfb,0xf4,0x00,0x00,0x00,0xce,0x5f,0x6f,0xc0,
+0x00,0x00,0x5f,0x74,0xf5,0x8f,0x60,0x00,0x2f,0xd0,0x4f,0x50,0xdf,0x40,0x3e,0xfc,
+0x9b,0xfb,0x9c,0xff,0x43,0xe4,0xff,0xff,0xff,0xf5,0xd1,0x41,0x00,0xf0,0x0e,0x00,
+0xe8,0x00,0x13,0x47,0xa9,0x00,0x0e,0x80,0x8f,0xff,0xfc,0x81,0x49,0xfc,0x88,0xf3,
+0x10,0x00,0x06,0xdf,0xec,0x8f,0x66,0x66,0x50,0x02,0xfc,0x09,0x9a,0x02,0xf4,0x1e,
+0x8f,0xf8,0xae,0xe8,0x0d,0xa0,0x0d,0xfc,0xdb,0xc9,0xe4,0xf6,0x06,0xde,0x82,0xcb,
+0x3f,0xde,0x00,0xa7,0xe8,0x0f,0x80,0xcf,0x70,0x02,0x0e,0x85,0xf3,0x4f,0xfb,0x00,
+0x00,0xe8,0xdf,0x9f,0xc7,0xfe,0x40,0x0e,0x9a,0x79,0x70,0x03,0xd2,0xf0,0x00,0xf0,
+0x05,0xcf,0xff,0xff,0xff,0xf4,0x00,0x0c,0xd4,0x5f,0xa4,0x8f,0x40,0x00,0xcd,0x35,
+0xfa,0x38,0xf4,0x00,0x0c,0xa3,0x00,0x46,0x40,0x00,0xcd,0x34,0x0d,0x00,0x72,0x03,
+0x33,0x35,0xfa,0x33,0x33,0x11,0xfe,0x00,0xf0,0x0e,0x03,0x34,0xcf,0xff,0xf7,0x33,
+0x10,0x06,0xee,0x6f,0x9a,0xfa,0x30,0x2e,0xfb,0x11,0xf8,0x06,0xef,0x80,0x63,0x00,
+0x1f,0x80,0x00,0x60,0x00,0xe8,0x0f,0xad,0x02,0xf5,0x38,0x1e,0x80,0x66,0x6f,0xb6,
+0x62,0x6f,0xff,0xb0,0x00,0xf7,0x00,0x04,0x9f,0xd7,0xae,0xef,0xfe,0xe2,0x02,0xfc,
+0x0b,0xd7,0xfa,0x9f,0x20,0x7f,0xf8,0xbb,0x0f,0x84,0xf2,0x0d,0xfa,0xfc,0xb4,0xff,
+0x5f,0x25,0xff,0x82,0xbb,0xbc,0xeb,0xf2,0x69,0xe8,0x0b,0xdf,0x48,0xef,0x20,0x2e,
+0x80,0xbb,0x20,0x04,0xf2,0x00,0xe8,0x0b,0xb0,0x05,0x9f,0x20,0x0e,0x80,0xbb,0x00,
+0xaf,0xb0,0x94,0x01,0xf0,0x32,0x04,0xf3,0x00,0x00,0x02,0x88,0x88,0xbf,0xa8,0x88,
+0x82,0x3c,0xcc,0xff,0xff,0xfc,0xcc,0x30,0x00,0xaf,0xaf,0x9f,0x90,0x00,0x06,0xee,
+0x34,0xf3,0x3e,0xe7,0x15,0xfe,0xa8,0x8a,0x88,0xac,0xf3,0x02,0x4f,0x97,0x77,0xaf,
+0x31,0x00,0x04,0xff,0xee,0xef,0xf3,0x00,0x00,0x4f,0x63,0x33,0x8f,0x30,0x00,0x04,
+0xee,0xee,0xee,0xe3,0x00,0x16,0x66,0x01,0x00,0x13,0x12,0x34,0x04,0x02,0x01,0x00,
+0xf9,0x3f,0x0e,0x70,0x00,0x8e,0x00,0x00,0x00,0xe7,0x02,0x36,0xf7,0x33,0x03,0x7f,
+0xb5,0xef,0xff,0xff,0xf3,0x7f,0xff,0xc3,0xb9,0x3a,0xa3,0x00,0x5f,0xa0,0x5f,0x70,
 0x7f,0x60,0x0a,0xff,0x7f,0xd2,0x04,0xcf,0x10,0xef,0xed,0x7d,0xb0,0xfb,0x40,0x7d,
 0xe8,0x90,0x4f,0xbf,0x20,0x0b,0x7e,0x70,0x00,0xcf,0xa0,0x00,0x41,0xe7,0x00,0x5f,
-0xd1,0x5c,0xbb,0x73,0xbf,0xc4,0xdf,0xd3,0x00,0xe7,0x2d,0x60,0x00,0x6b,0x55,0x17,
-0x31,0x80,0x05,0xe1,0xae,0x01,0xf0,0x18,0xdf,0xcc,0xc9,0x03,0x7f,0xc5,0xaf,0xc9,
-0xaf,0xb0,0x7f,0xff,0xcf,0xee,0x3c,0xe2,0x00,0x4f,0xe2,0x30,0xdf,0xf3,0x00,0x09,
-0xff,0xd6,0xcf,0xdf,0xea,0x30,0xef,0x9a,0xfa,0x30,0x16,0xd6,0x8d,0xe8,0x09,0xb5,
-0x61,0xc0,0x7e,0x80,0x8f,0x55,0x5f,0x90,0x21,0xe8,0x08,0xe0,0x00,0xf9,0xe2,0x01,
-0x00,0x7d,0x03,0x81,0xe8,0x08,0xe5,0x55,0xe8,0x00,0x00,0xe7,0x53,0x01,0xf2,0x2b,
-0x0e,0x70,0xfa,0x66,0x66,0x62,0x7d,0xfe,0x9f,0x72,0x22,0x22,0x08,0xff,0xfa,0xf9,
-0xff,0xff,0xf0,0x02,0xfc,0x0f,0x72,0x6f,0x32,0x00,0x8f,0xf9,0xf7,0x59,0xf7,0x40,
-0x0e,0xfc,0xdf,0x7d,0xef,0xea,0x09,0xef,0x71,0xf7,0x05,0xf1,0x00,0x76,0xe7,0x0f,
-0xad,0xef,0xdd,0x10,0x0e,0x70,0xf8,0x55,0x55,0x50,0x41,0x00,0x74,0x80,0x0e,0x70,
-0x77,0x77,0x77,0x73,0x67,0x1c,0x62,0x22,0x6f,0x42,0x22,0x20,0x0d,0xe6,0x31,0x63,
-0xb8,0x22,0xea,0x22,0x24,0xd3,0xde,0x36,0xf2,0x0b,0x44,0xcf,0x64,0x7f,0xb4,0x41,
-0x00,0x2a,0xdf,0xff,0xf5,0x00,0x00,0xac,0xef,0xea,0x8b,0xff,0xb0,0x07,0x86,0x44,
-0xf8,0x23,0x85,0x12,0x28,0x29,0xf0,0x08,0x01,0x16,0xdf,0xfe,0xf9,0x21,0x02,0x9e,
-0xf9,0x3f,0x65,0xef,0xc7,0x0b,0x82,0x01,0xf6,0x00,0x5b,0x30,0x00,0xe7,0x08,0xbf,
-0x03,0xf1,0x26,0x0e,0x70,0x8f,0x22,0x28,0xf0,0x35,0xfa,0x58,0xfc,0xcc,0xef,0x08,
-0xff,0xfe,0x8f,0x66,0x6b,0xf0,0x04,0xf8,0x18,0xfd,0xdd,0xef,0x00,0x7f,0xe1,0x25,
-0x55,0x55,0x50,0x0c,0xff,0xbd,0xff,0xff,0xff,0x44,0xff,0x9e,0x65,0x6f,0xb5,0x51,
-0xb9,0xe7,0x27,0x77,0xfb,0x77,0x46,0x2e,0x36,0x12,0x00,0x73,0x3b,0x11,0xf8,0x94,
-0x01,0x00,0x91,0x3e,0x30,0x6c,0x00,0x07,0x59,0x28,0xf0,0x19,0xc1,0x03,0xff,0xdd,
-0xa0,0x03,0xf8,0xf7,0xff,0x68,0xf7,0x00,0xcf,0x5f,0x7a,0xcd,0xec,0x00,0x7f,0xf5,
-0xf3,0x3a,0xff,0x93,0x07,0xef,0x5f,0xcf,0xc8,0x9e,0xf7,0x06,0xf5,0xf5,0x41,0xda,
-0x15,0x00,0x4f,0x5f,0xdc,0x37,0xf4,0x0b,0x04,0xf5,0xf4,0x85,0xeb,0x66,0x00,0x4f,
-0x5f,0x9f,0x5d,0x9b,0xd0,0x04,0xf3,0x1f,0x96,0xe9,0x1e,0x60,0x4f,0x30,0x10,0xad,
-0x30,0x10,0xdf,0x35,0x20,0x29,0xff,0x7c,0x58,0xf0,0x33,0xf2,0x24,0x44,0x9f,0xd1,
-0x06,0xef,0xe2,0x00,0x8f,0xc1,0x00,0x7f,0xff,0x63,0x2e,0xcc,0xb9,0x00,0x3f,0x3c,
-0xeb,0xe8,0x8b,0xc0,0x08,0xfb,0xc4,0xbe,0x9b,0xa9,0x00,0xdf,0xee,0x6b,0xe7,0xcf,
-0x40,0x5f,0xf4,0xcf,0xbe,0x68,0xf4,0x0a,0xaf,0x2b,0x36,0xeb,0xfc,0xc0,0x44,0xf2,
-0x02,0xdf,0x87,0x15,0x00,0x2f,0x36,0x6c,0xa6,0x66,0x62,0x02,0xf6,0x32,0x3b,0x14,
-0x40,0x14,0x42,0xf2,0x1d,0x00,0x6e,0x00,0x8a,0x00,0x0a,0x96,0x8f,0xff,0x2e,0x44,
-0x04,0xfa,0xe9,0xd5,0xfa,0xea,0xd0,0x4c,0xf4,0x8f,0xff,0xbd,0xf2,0x00,0xb8,0xe9,
-0xc4,0xf2,0xd8,0xa0,0x7f,0xff,0xcf,0xff,0xcf,0xdf,0x01,0x31,0x53,0x6b,0x23,0x52,
-0x71,0xc7,0x34,0xf0,0x06,0x13,0x55,0x6e,0xff,0xfb,0x55,0x50,0x01,0x7e,0xd9,0xf7,
-0xfd,0x50,0x07,0xff,0x90,0x7f,0x12,0xbf,0xe2,0x18,0x81,0x2e,0x42,0x36,0x00,0x00,
-0xe7,0x8d,0x47,0xf0,0x20,0x70,0x33,0xf7,0xf6,0x31,0x48,0xfc,0x69,0xdf,0xef,0xed,
-0x17,0xff,0xfc,0xba,0xd7,0xf6,0xf2,0x04,0xf8,0x1b,0xad,0x7f,0x6f,0x20,0x7f,0xd0,
-0x9d,0xdd,0xdd,0xd1,0x0c,0xff,0x93,0xbb,0xbb,0xb9,0x04,0xff,0x9c,0x58,0x88,0x88,
-0x72,0xa9,0xe7,0x2f,0x13,0x23,0x50,0x1e,0x70,0x4b,0x2f,0x6a,0x55,0x13,0xf0,0x04,
-0xb4,0xf6,0x9f,0x40,0x0e,0x71,0x70,0xee,0x20,0x71,0x00,0xf6,0x01,0xad,0x1a,0xd1,
-0x00,0x0f,0x62,0xdf,0x03,0xf0,0x1b,0x37,0xfb,0x53,0xac,0x3a,0xc3,0x16,0xff,0xf9,
-0xad,0xdd,0xdd,0x90,0x01,0xf8,0x0c,0xc5,0x55,0xdb,0x00,0x6f,0xf3,0xcf,0xff,0xff,
-0xb0,0x0c,0xfe,0xcc,0xd8,0x88,0xeb,0x05,0xff,0x84,0x46,0x9f,0x76,0x40,0x89,0xf6,
-0x5f,0x56,0x52,0xf0,0x82,0x2f,0x61,0x48,0xfd,0xfa,0x41,0x00,0xf6,0x49,0xfd,0x19,
-0xfb,0x40,0x0f,0x66,0xd7,0x00,0x06,0xc2,0x00,0xe7,0x00,0xb7,0x02,0xe3,0x00,0x0e,
-0x70,0xae,0xfc,0xef,0xc4,0x38,0xfb,0x65,0x67,0xfa,0x66,0x27,0xff,0xfc,0x6f,0xff,
-0xff,0xf1,0x15,0xf9,0x24,0x67,0xfa,0x66,0x20,0x7f,0xe2,0xee,0xff,0xfe,0xe9,0x0d,
-0xff,0xc0,0x28,0xdf,0x80,0x06,0xef,0x88,0x2a,0xbf,0x95,0xd3,0xa8,0xe7,0x2f,0xf9,
-0xff,0xf7,0x02,0x0e,0x70,0x5f,0x3f,0xee,0x40,0x00,0xe7,0x3e,0xa4,0xf6,0xaf,0x70,
-0x0e,0x72,0x62,0xfd,0x20,0x61,0x02,0xf0,0x08,0x1b,0x62,0x80,0x00,0x2f,0x02,0xd0,
-0xc7,0x88,0x20,0x39,0xf8,0xba,0xec,0xbf,0xca,0x06,0xff,0xf9,0xe6,0xaa,0x8e,0x20,
-0x08,0xf2,0x4c,0xba,0xbb,0xae,0x00,0xcf,0xbc,0xee,0xcd,0xde,0xd2,0x1f,0xfd,0x6d,
-0x67,0xf6,0xf6,0x08,0xcf,0x2e,0xb7,0x03,0xf5,0x0b,0x86,0xf0,0x4f,0x80,0xe8,0xe5,
-0x01,0x2f,0x09,0xde,0x79,0xfb,0x41,0x02,0xf5,0xf5,0x39,0xff,0xbd,0x60,0x2f,0x88,
-0x04,0xc4,0x3c,0xd0,0xe2,0x5d,0x70,0x01,0xad,0x1a,0xe1,0x00,0x0e,0x81,0x51,0x02,
-0xf0,0x22,0x36,0xfb,0x50,0x9e,0x5b,0xd0,0x09,0xff,0xfe,0x06,0xbb,0xba,0x00,0x02,
-0xf8,0x2d,0xdd,0xdd,0xdd,0x80,0x7f,0xe2,0x67,0x8f,0xa7,0x74,0x0c,0xff,0xdc,0xff,
-0xff,0xff,0x04,0xff,0xbd,0xcc,0x8f,0xaa,0xf0,0xaa,0xe8,0x1b,0xc7,0xf9,0xaf,0x03,
-0x2e,0x80,0xbf,0x59,0x09,0xc5,0xe8,0x17,0xeb,0x07,0xf9,0x10,0x0e,0x87,0xd8,0x10,
-0x07,0xd4,0x17,0x19,0xd0,0x06,0x92,0xf4,0x89,0x00,0x0e,0x70,0x5f,0x4f,0x5e,0x60,
-0x13,0xf9,0x1f,0x01,0xf0,0x0e,0x56,0xff,0xfc,0xf7,0x55,0x56,0xf6,0x15,0xf9,0x36,
-0xff,0xff,0xf9,0x20,0x6f,0xd0,0x0f,0x85,0x7f,0x40,0x0b,0xff,0x90,0x99,0x99,0x92,
-0x03,0xff,0x98,0xe9,0x59,0xa0,0x9a,0xe7,0x0e,0x95,0xf6,0x8f,0x13,0x3e,0x70,0xef,
-0xd9,0x0b,0x01,0x0d,0x00,0x74,0x10,0x0e,0x70,0xef,0xee,0xef,0xf1,0x20,0x04,0xf0,
-0x1f,0x40,0x00,0xce,0x20,0x00,0x00,0xe4,0x00,0xaf,0xfd,0x40,0x01,0x7f,0xa4,0xdf,
-0x71,0xcf,0xb4,0x3f,0xff,0xce,0xdf,0xff,0xae,0x70,0x4f,0x50,0x23,0x43,0x42,0x20,
-0x08,0xfe,0x3f,0xff,0x6f,0xfe,0x00,0xef,0xc9,0xe3,0xf6,0xc4,0xe0,0x5c,0xe5,0x0d,
-0x00,0xf3,0x0c,0x05,0x7e,0x40,0x5c,0x10,0x9b,0x00,0x00,0xe4,0x0d,0xf7,0x1f,0xe2,
-0x00,0x0e,0x5b,0xe6,0xcc,0xec,0xf4,0x00,0xe7,0xc2,0x01,0xc2,0x08,0x20,0x5a,0x07,
-0xd0,0xf0,0xef,0xfe,0xaf,0xfe,0x03,0xf0,0xe7,0x6e,0xa7,0x8e,0x2a,0xf6,0x0c,0x00,
-0xf6,0x27,0x3f,0xfc,0xe7,0x6e,0xa7,0x7e,0x05,0xf3,0xee,0xde,0xdd,0xee,0x08,0xfb,
-0xe9,0xcd,0xec,0xae,0x0d,0xfa,0xe5,0xbc,0xeb,0x6e,0x5f,0xf0,0xe5,0xe9,0xbd,0x7e,
-0x9b,0xf0,0xe5,0xfc,0xee,0x7e,0x25,0xf0,0xe5,0x6f,0xf6,0x5e,0x03,0xf0,0xe9,0xd7,
-0xa9,0x6e,0x03,0xf0,0xe5,0x02,0x40,0xd9,0xc6,0x04,0x11,0x73,0x64,0x0e,0xf0,0x18,
-0x2f,0x60,0x00,0x2f,0x64,0x44,0x45,0xf9,0x77,0x12,0xf2,0xab,0xb3,0x9f,0xff,0xf5,
-0x2f,0x2d,0x7c,0x4e,0xb2,0x6f,0x22,0xf2,0xdb,0xea,0xf7,0xa9,0xe0,0x2f,0x25,0x66,
-0x27,0x6f,0x12,0x02,0xf8,0xe9,0xdc,0xfe,0x6d,0xf0,0x03,0x96,0xaa,0xc0,0x9f,0x80,
-0x02,0xf9,0xca,0xdd,0x0e,0xfe,0x00,0x2f,0x45,0x35,0x44,0xf6,0xf7,0x41,0x00,0x96,
-0xec,0x09,0xf4,0x05,0x55,0x55,0x5b,0x10,0x0a,0x34,0x14,0x12,0xec,0x06,0x01,0x00,
-0xa4,0x12,0x31,0x53,0x00,0xec,0xdd,0x34,0x21,0x0e,0xc0,0x04,0x35,0x30,0xef,0xff,
-0xfa,0x0d,0x00,0x5a,0xe9,0x99,0x70,0x00,0xfa,0x1a,0x00,0x01,0x0d,0x00,0x33,0xb0,
-0x0e,0xc0,0x44,0x3b,0x22,0xff,0x35,0xf9,0x0a,0x03,0x52,0x00,0x11,0xbf,0x54,0x07,
-0x40,0x05,0x77,0x77,0xee,0xa2,0x49,0x01,0x98,0x2c,0x41,0x00,0x7a,0x00,0xdc,0x36,
-0x69,0x10,0x0d,0x3d,0x09,0x50,0x9f,0x00,0xde,0x88,0x83,0x0d,0x00,0x11,0xc0,0x8e,
-0x30,0x03,0x1a,0x00,0x14,0xc0,0x1a,0x39,0x11,0x91,0x34,0x67,0x40,0x95,0x00,0x01,
-0xf7,0x8b,0x4b,0x00,0x01,0x63,0x00,0x0c,0x26,0x01,0x0d,0x00,0xf3,0x06,0x8e,0x1f,
-0x92,0x8f,0x2b,0xc0,0x08,0xe1,0xff,0xf8,0xfe,0xf9,0x10,0x8e,0x1f,0xa4,0x8f,0xb2,
-0x00,0x08,0xe1,0x1a,0x00,0x00,0x27,0x00,0x01,0x0d,0x00,0xf5,0x06,0x06,0x20,0x8e,
-0x1f,0xa6,0x8f,0x00,0xda,0x3c,0xfe,0xff,0xf7,0xf9,0x8f,0x75,0xfd,0xa7,0x41,0x2d,
-0xff,0xd1,0xd3,0x21,0x01,0xb7,0x67,0x30,0x0b,0xe0,0x2f,0x89,0x00,0xd2,0xbe,0x02,
-0xfc,0x77,0x72,0x02,0x4c,0xe4,0x5f,0xa4,0x44,0x40,0x8f,0xbd,0x39,0xf0,0x09,0x23,
-0x74,0x7f,0x72,0x35,0x20,0x00,0x7f,0x75,0xf5,0x07,0xf4,0x00,0x9f,0xa0,0x5f,0x55,
-0xfb,0x00,0x0c,0x90,0x05,0xfc,0xfd,0xba,0x15,0xd7,0x9e,0xf9,0x00,0x00,0x38,0xbe,
-0xff,0xb4,0x00,0x00,0x02,0xfd,0xa7,0xff,0x0d,0x03,0x4b,0x3b,0x90,0x78,0xfd,0x77,
-0xbf,0x97,0x74,0x00,0x3f,0x80,0x09,0x39,0xf0,0x0f,0x09,0xf8,0x43,0x6f,0x20,0x10,
-0x02,0xff,0xff,0xf8,0xf3,0xae,0x10,0xcf,0x52,0xcc,0x6f,0xef,0x80,0x2f,0x9a,0x2f,
-0x86,0xfc,0x20,0x00,0x24,0xff,0xf1,0x6f,0x41,0x3b,0xd0,0xf8,0x06,0xf2,0x05,0x20,
-0x07,0xfc,0x00,0x6f,0x30,0xca,0x1d,0xfb,0x74,0x09,0xf0,0x19,0x60,0x65,0x00,0x00,
-0x04,0x77,0x50,0x1f,0xff,0xfe,0x6b,0x7f,0x00,0x00,0x06,0xeb,0x65,0xac,0x7f,0x00,
-0x00,0x00,0xf7,0x00,0xef,0xff,0xee,0x40,0x04,0xff,0xfe,0xf8,0xbf,0x77,0x20,0x08,
-0xf8,0xde,0xd0,0x7f,0xf4,0x0a,0x80,0xda,0x87,0xbf,0x77,0x50,0x5f,0x99,0xf9,0x00,
-0x11,0x61,0x18,0x7f,0xf0,0x08,0xff,0xe1,0x79,0x41,0xf0,0x02,0xdf,0xda,0x00,0x00,
-0x9f,0x28,0xf9,0x7f,0x4f,0x90,0x1c,0xf5,0x1d,0x90,0x7f,0x08,0x80,0xbb,0x27,0x11,
-0x7f,0x2b,0x80,0x00,0x05,0x00,0xf1,0x3f,0x3a,0xff,0xa2,0xff,0xff,0x00,0x08,0xf9,
-0x20,0x2f,0x79,0xf0,0x00,0x8e,0x00,0x04,0xf2,0x7f,0x00,0x08,0xff,0xf8,0x7f,0x06,
-0xf0,0x00,0x8f,0x55,0x6f,0xa0,0x4f,0xf7,0x08,0xf5,0x54,0xd4,0x33,0x55,0x10,0x8f,
-0xff,0x7f,0xff,0xff,0xc0,0x08,0xe0,0x00,0x5f,0x24,0xf7,0x02,0xbf,0xbd,0xb0,0xda,
-0xcf,0x10,0x7f,0xfb,0x84,0x05,0xff,0x60,0x01,0x9e,0x00,0x29,0xff,0xfe,0x82,0x08,
-0xe0,0x08,0xf9,0x22,0xaf,0x40,0x0a,0x10,0x04,0x07,0x01,0x11,0x9f,0x31,0x20,0x23,
-0x09,0xf0,0x56,0x32,0x90,0x01,0xf8,0x05,0xa0,0x09,0xf1,0x00,0x1f,0x83,0x7f,0x32,
-0xa0,0xf1,0xfb,0xfe,0x30,0x09,0xf8,0x77,0x1f,0xfc,0x10,0x1a,0x00,0x13,0xfb,0x27,
-0x00,0x11,0x02,0x27,0x00,0xf0,0x02,0x02,0xf4,0x09,0xf6,0xad,0x1f,0x80,0x3f,0x40,
-0xdf,0xff,0x90,0xfd,0x8b,0xf1,0x0e,0xc5,0x92,0x00,0x05,0x56,0x00,0x0c,0xa2,0x35,
-0xf0,0x05,0x93,0x00,0xff,0xff,0x7f,0xc0,0x8f,0xa0,0x09,0x9c,0xf5,0xff,0xaf,0x90,
-0x00,0x00,0xaf,0x2f,0xff,0x70,0xed,0x65,0x20,0xfd,0xf7,0x92,0x52,0xf0,0x0b,0x1f,
-0x99,0xf5,0x00,0x04,0xfb,0x01,0xf9,0x0d,0xf9,0x03,0xfe,0x20,0x1f,0x90,0x1c,0xfa,
-0x07,0x30,0xac,0xf8,0x00,0x08,0x10,0x00,0x09,0x8a,0x2f,0x21,0x04,0xb3,0x3d,0x4e,
-0x30,0x6e,0xf2,0x95,0x3d,0x4e,0xf0,0x09,0x16,0x0f,0x81,0xf8,0x8b,0x10,0x20,0x00,
-0xf9,0x6f,0xff,0xf1,0x4f,0xb2,0x3f,0xff,0xfa,0x6f,0x10,0x6e,0x5f,0xfc,0x4f,0x76,
-0x10,0x3f,0xf0,0x03,0x81,0xf7,0x7f,0x00,0x03,0xc1,0xf8,0x1f,0xcf,0xe0,0x00,0xbe,
-0x0f,0x81,0xf8,0x63,0x00,0x4f,0x5a,0x5d,0xc5,0xe7,0x0d,0xe0,0x0e,0xd7,0x66,0x9f,
-0x60,0x66,0x00,0x6e,0xff,0x46,0x35,0x91,0x6c,0x40,0x0e,0xb0,0x00,0x00,0x04,0xdf,
-0x32,0x7e,0x69,0x90,0x50,0x6f,0x86,0x6e,0xc0,0x05,0x00,0x0d,0xd0,0xed,0x1e,0xb2,
-0x49,0xf5,0x0b,0xdf,0x70,0x03,0xd3,0x59,0x00,0x59,0x60,0x22,0x12,0xfa,0x12,0xa0,
+0xff,0x60,0x00,0x0e,0x73,0xbf,0xc4,0xdf,0xd3,0x00,0xe7,0x2d,0x60,0x00,0x6b,0x00,
+0x01,0x00,0x41,0x0e,0x80,0x05,0xe1,0xae,0x01,0xf0,0x28,0xdf,0xcc,0xc9,0x03,0x7f,
+0xc5,0xaf,0xc9,0xaf,0xb0,0x7f,0xff,0xcf,0xee,0x3c,0xe2,0x00,0x4f,0xe2,0x30,0xdf,
+0xf3,0x00,0x09,0xff,0xd6,0xcf,0xdf,0xea,0x30,0xef,0x9a,0xfa,0x30,0x16,0xd6,0x8d,
+0xe8,0x09,0xff,0xff,0xf8,0x09,0x7e,0x80,0x8f,0x55,0x5f,0x90,0x21,0xe8,0x08,0xe0,
+0x00,0xf9,0xe2,0x01,0x00,0x7d,0x03,0x81,0xe8,0x08,0xe5,0x55,0xe8,0x00,0x00,0xe7,
+0x53,0x01,0xf2,0x2b,0x0e,0x70,0xfa,0x66,0x66,0x62,0x7d,0xfe,0x9f,0x72,0x22,0x22,
+0x08,0xff,0xfa,0xf9,0xff,0xff,0xf0,0x02,0xfc,0x0f,0x72,0x6f,0x32,0x00,0x8f,0xf9,
+0xf7,0x59,0xf7,0x40,0x0e,0xfc,0xdf,0x7d,0xef,0xea,0x09,0xef,0x71,0xf7,0x05,0xf1,
+0x00,0x76,0xe7,0x0f,0xad,0xef,0xdd,0x10,0x0e,0x70,0xf8,0x55,0x55,0x50,0x41,0x00,
+0x73,0x80,0x0e,0x70,0x77,0x77,0x77,0x73,0xa3,0x00,0x81,0x12,0x22,0x6f,0x42,0x22,
+0x20,0x0d,0xff,0xdc,0x01,0x71,0xb8,0x22,0xea,0x22,0x24,0xd3,0x1f,0x0d,0x00,0xf2,
+0x0b,0x60,0x44,0xcf,0x64,0x7f,0xb4,0x41,0x00,0x2a,0xdf,0xff,0xf5,0x00,0x00,0xac,
+0xef,0xea,0x8b,0xff,0xb0,0x07,0x86,0x44,0xf8,0x23,0x85,0x3f,0x01,0xf0,0x09,0xf9,
+0x01,0x16,0xdf,0xfe,0xf9,0x21,0x02,0x9e,0xf9,0x3f,0x65,0xef,0xc7,0x0b,0x82,0x01,
+0xf6,0x00,0x5b,0x30,0x00,0xe7,0x08,0xbf,0x03,0xf1,0x30,0x0e,0x70,0x8f,0x22,0x28,
+0xf0,0x35,0xfa,0x58,0xfc,0xcc,0xef,0x08,0xff,0xfe,0x8f,0x66,0x6b,0xf0,0x04,0xf8,
+0x18,0xfd,0xdd,0xef,0x00,0x7f,0xe1,0x25,0x55,0x55,0x50,0x0c,0xff,0xbd,0xff,0xff,
+0xff,0x44,0xff,0x9e,0x65,0x6f,0xb5,0x51,0xb9,0xe7,0x27,0x77,0xfb,0x77,0x46,0x2e,
+0x71,0xff,0xff,0xff,0xf8,0x00,0xe7,0x00,0x00,0xf8,0x94,0x01,0xf3,0x42,0x0f,0x80,
+0x00,0x00,0x6c,0x00,0x07,0xc0,0x00,0x00,0x0d,0xc1,0x03,0xff,0xdd,0xa0,0x03,0xf8,
+0xf7,0xff,0x68,0xf7,0x00,0xcf,0x5f,0x7a,0xcd,0xec,0x00,0x7f,0xf5,0xf3,0x3a,0xff,
+0x93,0x07,0xef,0x5f,0xcf,0xc8,0x9e,0xf7,0x06,0xf5,0xf5,0x41,0xda,0x15,0x00,0x4f,
+0x5f,0x7f,0xff,0xff,0xf2,0x04,0xf5,0xf4,0x85,0xeb,0x66,0x00,0x4f,0x5f,0x9f,0x5d,
+0x9b,0xd0,0x04,0xf3,0x1f,0x96,0xe9,0x1e,0x60,0x4f,0x30,0x10,0xad,0x30,0x10,0xf1,
+0x00,0xf3,0x3f,0x2f,0x29,0xff,0xff,0xff,0x70,0x02,0xf2,0x24,0x44,0x9f,0xd1,0x06,
+0xef,0xe2,0x00,0x8f,0xc1,0x00,0x7f,0xff,0x63,0x2e,0xcc,0xb9,0x00,0x3f,0x3c,0xeb,
+0xe8,0x8b,0xc0,0x08,0xfb,0xc4,0xbe,0x9b,0xa9,0x00,0xdf,0xee,0x6b,0xe7,0xcf,0x40,
+0x5f,0xf4,0xcf,0xbe,0x68,0xf4,0x0a,0xaf,0x2b,0x36,0xeb,0xfc,0xc0,0x44,0xf2,0x02,
+0xdf,0x87,0x15,0x00,0x2f,0x36,0x6c,0xa6,0x66,0x62,0x02,0xf6,0xee,0xee,0xee,0xee,
+0x40,0x55,0x00,0xf1,0x1f,0x3e,0x00,0x6e,0x00,0x8a,0x00,0x0a,0x96,0x8f,0xff,0x2e,
+0x44,0x04,0xfa,0xe9,0xd5,0xfa,0xea,0xd0,0x4c,0xf4,0x8f,0xff,0xbd,0xf2,0x00,0xb8,
+0xe9,0xc4,0xf2,0xd8,0xa0,0x7f,0xff,0xcf,0xff,0xcf,0xdf,0x01,0x31,0x53,0x6b,0x23,
+0x52,0x71,0x9f,0x40,0x01,0xf0,0x0f,0x13,0x55,0x6e,0xff,0xfb,0x55,0x50,0x01,0x7e,
+0xd9,0xf7,0xfd,0x50,0x07,0xff,0x90,0x7f,0x12,0xbf,0xe2,0x18,0x10,0x07,0xf1,0x00,
+0x36,0x00,0x00,0xe7,0x1f,0xa4,0x00,0xf0,0x20,0x0e,0x70,0x33,0xf7,0xf6,0x31,0x48,
+0xfc,0x69,0xdf,0xef,0xed,0x17,0xff,0xfc,0xba,0xd7,0xf6,0xf2,0x04,0xf8,0x1b,0xad,
+0x7f,0x6f,0x20,0x7f,0xd0,0x9d,0xdd,0xdd,0xd1,0x0c,0xff,0x93,0xbb,0xbb,0xb9,0x04,
+0xff,0x9c,0x58,0x88,0x88,0x72,0xa9,0xe7,0x4c,0x06,0xf0,0x0e,0x83,0x1e,0x70,0x4b,
+0x2f,0x6a,0x50,0x00,0xe7,0x4f,0xb4,0xf6,0x9f,0x40,0x0e,0x71,0x70,0xee,0x20,0x71,
+0x00,0xf6,0x01,0xad,0x1a,0xd1,0x00,0x0f,0x62,0xdf,0x03,0xf0,0xb0,0x37,0xfb,0x53,
+0xac,0x3a,0xc3,0x16,0xff,0xf9,0xad,0xdd,0xdd,0x90,0x01,0xf8,0x0c,0xc5,0x55,0xdb,
+0x00,0x6f,0xf3,0xcf,0xff,0xff,0xb0,0x0c,0xfe,0xcc,0xd8,0x88,0xeb,0x05,0xff,0x84,
+0x46,0x9f,0x76,0x40,0x89,0xf6,0x5f,0xff,0xff,0xff,0x51,0x2f,0x61,0x48,0xfd,0xfa,
+0x41,0x00,0xf6,0x49,0xfd,0x19,0xfb,0x40,0x0f,0x66,0xd7,0x00,0x06,0xc2,0x00,0xe7,
+0x00,0xb7,0x02,0xe3,0x00,0x0e,0x70,0xae,0xfc,0xef,0xc4,0x38,0xfb,0x65,0x67,0xfa,
+0x66,0x27,0xff,0xfc,0x6f,0xff,0xff,0xf1,0x15,0xf9,0x24,0x67,0xfa,0x66,0x20,0x7f,
+0xe2,0xee,0xff,0xfe,0xe9,0x0d,0xff,0xc0,0x28,0xdf,0x80,0x06,0xef,0x88,0x2a,0xbf,
+0x95,0xd3,0xa8,0xe7,0x2f,0xf9,0xff,0xf7,0x02,0x0e,0x70,0x5f,0x3f,0xee,0x40,0x00,
+0xe7,0x3e,0xa4,0xf6,0xaf,0x70,0x0e,0x72,0x62,0xfd,0x20,0x61,0x02,0xf0,0x08,0x1b,
+0x62,0x80,0x00,0x2f,0x02,0xd0,0xc7,0x88,0x20,0x39,0xf8,0xba,0xec,0xbf,0xca,0x06,
+0xff,0xf9,0xe6,0xaa,0x8e,0x20,0x08,0xf2,0x4c,0xba,0xbb,0xae,0x00,0xcf,0xbc,0xee,
+0xcd,0xde,0xd2,0x1f,0xfd,0x6d,0x67,0xf6,0xf6,0x08,0xcf,0x2e,0xb7,0x03,0xf4,0x0b,
+0x86,0xf0,0x4f,0x80,0xe8,0xe5,0x01,0x2f,0x09,0xde,0x79,0xfb,0x41,0x02,0xf5,0xf5,
+0x39,0xff,0xbd,0x60,0x2f,0x88,0x04,0xc4,0x3c,0xd0,0x77,0x03,0x80,0xe8,0x01,0xad,
+0x1a,0xe1,0x00,0x0e,0x81,0x51,0x02,0xf4,0x32,0x36,0xfb,0x50,0x9e,0x5b,0xd0,0x09,
+0xff,0xfe,0x06,0xbb,0xba,0x00,0x02,0xf8,0x2d,0xdd,0xdd,0xdd,0x80,0x7f,0xe2,0x67,
+0x8f,0xa7,0x74,0x0c,0xff,0xdc,0xff,0xff,0xff,0x04,0xff,0xbd,0xcc,0x8f,0xaa,0xf0,
+0xaa,0xe8,0x1b,0xc7,0xf9,0xaf,0x03,0x2e,0x80,0xbf,0xff,0xff,0xf0,0x00,0xe8,0x17,
+0xeb,0x07,0xf9,0x10,0x0e,0x87,0xd8,0x10,0x07,0xd4,0x55,0x00,0xe0,0xe7,0x06,0x92,
+0xf4,0x89,0x00,0x0e,0x70,0x5f,0x4f,0x5e,0x60,0x13,0xf9,0x1f,0x01,0xf0,0x1b,0x56,
+0xff,0xfc,0xf7,0x55,0x56,0xf6,0x15,0xf9,0x36,0xff,0xff,0xf9,0x20,0x6f,0xd0,0x0f,
+0x85,0x7f,0x40,0x0b,0xff,0x90,0x99,0x99,0x92,0x03,0xff,0x98,0xef,0xff,0xff,0xf1,
+0x9a,0xe7,0x0e,0x95,0xf6,0x8f,0x13,0x3e,0x70,0x0d,0x00,0x11,0x00,0x0d,0x00,0x74,
+0x10,0x0e,0x70,0xef,0xee,0xef,0xf1,0x20,0x04,0xf0,0x1f,0x40,0x00,0xce,0x20,0x00,
+0x00,0xe4,0x00,0xaf,0xfd,0x40,0x01,0x7f,0xa4,0xdf,0x71,0xcf,0xb4,0x3f,0xff,0xce,
+0xdf,0xff,0xae,0x70,0x4f,0x50,0x23,0x43,0x42,0x20,0x08,0xfe,0x3f,0xff,0x6f,0xfe,
+0x00,0xef,0xc9,0xe3,0xf6,0xc4,0xe0,0x5c,0xe5,0x0d,0x00,0xf3,0x0c,0x05,0x7e,0x40,
+0x5c,0x10,0x9b,0x00,0x00,0xe4,0x0d,0xf7,0x1f,0xe2,0x00,0x0e,0x5b,0xe6,0xcc,0xec,
+0xf4,0x00,0xe7,0xc2,0x01,0xc2,0x08,0x20,0x5a,0x07,0xd0,0xf0,0xef,0xfe,0xaf,0xfe,
+0x03,0xf0,0xe7,0x6e,0xa7,0x8e,0x2a,0xf6,0x0c,0x00,0xf6,0x27,0x3f,0xfc,0xe7,0x6e,
+0xa7,0x7e,0x05,0xf3,0xee,0xde,0xdd,0xee,0x08,0xfb,0xe9,0xcd,0xec,0xae,0x0d,0xfa,
+0xe5,0xbc,0xeb,0x6e,0x5f,0xf0,0xe5,0xe9,0xbd,0x7e,0x9b,0xf0,0xe5,0xfc,0xee,0x7e,
+0x25,0xf0,0xe5,0x6f,0xf6,0x5e,0x03,0xf0,0xe9,0xd7,0xa9,0x6e,0x03,0xf0,0xe5,0x02,
+0x40,0xd9,0xc6,0x04,0xf0,0x34,0x73,0x00,0x02,0xff,0xff,0xff,0x2f,0x60,0x00,0x2f,
+0x64,0x44,0x45,0xf9,0x77,0x12,0xf2,0xab,0xb3,0x9f,0xff,0xf5,0x2f,0x2d,0x7c,0x4e,
+0xb2,0x6f,0x22,0xf2,0xdb,0xea,0xf7,0xa9,0xe0,0x2f,0x25,0x66,0x27,0x6f,0x12,0x02,
+0xf8,0xe9,0xdc,0x07,0xf2,0x00,0x2f,0x96,0xaa,0xc0,0x9f,0x80,0x02,0xf9,0xca,0xdd,
+0x0e,0xfe,0x00,0x2f,0x45,0x35,0x44,0xf6,0xf7,0x41,0x00,0xa5,0xec,0x09,0xf4,0x05,
+0x55,0x55,0x5b,0x10,0x0a,0x20,0x5a,0x00,0x12,0xec,0x06,0x01,0x51,0xc0,0x00,0x00,
+0x00,0x53,0x0d,0x00,0x21,0x0f,0xa0,0x0d,0x00,0x50,0xfa,0x00,0xef,0xff,0xfa,0x0d,
+0x00,0x5a,0xe9,0x99,0x70,0x00,0xfa,0x1a,0x00,0x01,0x0d,0x00,0x10,0xb0,0x0d,0x00,
+0x11,0xaf,0x48,0x03,0x20,0x35,0x77,0x01,0x00,0x13,0x71,0x52,0x00,0x11,0xbf,0x54,
+0x07,0xa0,0x05,0x77,0x77,0xee,0x77,0x77,0x10,0x00,0x00,0x0d,0x34,0x00,0x90,0x7a,
+0x00,0xdc,0x00,0x00,0x00,0x09,0xf0,0x0d,0x3d,0x09,0x50,0x9f,0x00,0xde,0x88,0x83,
+0x0d,0x00,0x00,0x1a,0x00,0x13,0x9f,0x1a,0x00,0x00,0x0d,0x00,0x02,0x8b,0x09,0x20,
+0x91,0x99,0x01,0x00,0xf1,0x01,0x95,0x00,0x01,0xf7,0x08,0xf0,0x00,0x00,0x00,0x1f,
+0x70,0x8f,0x00,0x00,0x02,0x41,0x0d,0x00,0xf3,0x06,0x8e,0x1f,0x92,0x8f,0x2b,0xc0,
+0x08,0xe1,0xff,0xf8,0xfe,0xf9,0x10,0x8e,0x1f,0xa4,0x8f,0xb2,0x00,0x08,0xe1,0x1a,
+0x00,0x00,0x27,0x00,0x01,0x0d,0x00,0xf4,0x07,0x06,0x20,0x8e,0x1f,0xa6,0x8f,0x00,
+0xda,0x3c,0xfe,0xff,0xf7,0xf9,0x8f,0x75,0xfd,0xa7,0x41,0x2d,0xff,0xd1,0x00,0x6c,
+0x05,0x10,0x02,0xb3,0x09,0x30,0x0b,0xe0,0x2f,0x89,0x00,0xd1,0xbe,0x02,0xfc,0x77,
+0x72,0x02,0x4c,0xe4,0x5f,0xa4,0x44,0x40,0x8f,0x7c,0x00,0xf6,0x1c,0x11,0x23,0x74,
+0x7f,0x72,0x35,0x20,0x00,0x7f,0x75,0xf5,0x07,0xf4,0x00,0x9f,0xa0,0x5f,0x55,0xfb,
+0x00,0x0c,0x90,0x05,0xfc,0xfd,0x10,0x00,0x00,0x03,0x9e,0xf9,0x00,0x00,0x38,0xbe,
+0xff,0xb4,0x00,0x00,0x02,0xfd,0xa7,0x10,0x9d,0x01,0x02,0xad,0x05,0xf0,0x2e,0x80,
+0x78,0xfd,0x77,0xbf,0x97,0x74,0x00,0x3f,0x80,0x06,0xf2,0x00,0x00,0x09,0xf8,0x43,
+0x6f,0x20,0x10,0x02,0xff,0xff,0xf8,0xf3,0xae,0x10,0xcf,0x52,0xcc,0x6f,0xef,0x80,
+0x2f,0x9a,0x2f,0x86,0xfc,0x20,0x00,0x24,0xff,0xf1,0x6f,0x20,0x00,0x00,0x07,0xf8,
+0x06,0xf2,0x05,0x20,0x07,0xfc,0x00,0x6f,0x30,0xca,0x1d,0xfb,0x74,0x09,0xf0,0x19,
+0x60,0x65,0x00,0x00,0x04,0x77,0x50,0x1f,0xff,0xfe,0x6b,0x7f,0x00,0x00,0x06,0xeb,
+0x65,0xac,0x7f,0x00,0x00,0x00,0xf7,0x00,0xef,0xff,0xee,0x40,0x04,0xff,0xfe,0xf8,
+0xbf,0x77,0x20,0x08,0xf8,0xde,0xd0,0x7f,0xf4,0x0a,0xf0,0x1e,0xda,0x87,0xbf,0x77,
+0x50,0x5f,0x99,0xf9,0xff,0xff,0xff,0xb0,0x18,0x7f,0xf0,0x08,0xff,0xe1,0x00,0x00,
+0x0d,0x90,0x5f,0xdf,0xda,0x00,0x00,0x9f,0x28,0xf9,0x7f,0x4f,0x90,0x1c,0xf5,0x1d,
+0x90,0x7f,0x08,0x80,0x08,0x30,0x00,0x00,0x7f,0xa4,0x00,0x10,0x72,0x05,0x00,0xf4,
+0x44,0x3a,0xff,0xa2,0xff,0xff,0x00,0x08,0xf9,0x20,0x2f,0x79,0xf0,0x00,0x8e,0x00,
+0x04,0xf2,0x7f,0x00,0x08,0xff,0xf8,0x7f,0x06,0xf0,0x00,0x8f,0x55,0x6f,0xa0,0x4f,
+0xf7,0x08,0xf5,0x54,0xd4,0x33,0x55,0x10,0x8f,0xff,0x7f,0xff,0xff,0xc0,0x08,0xe0,
+0x00,0x5f,0x24,0xf7,0x02,0xbf,0xbd,0xb0,0xda,0xcf,0x10,0x7f,0xfb,0x84,0x05,0xff,
+0x60,0x01,0x9e,0x00,0x29,0xff,0xfe,0x82,0x08,0xe0,0x08,0xf9,0x22,0xaf,0x40,0x00,
+0x00,0x01,0x00,0x00,0x07,0x01,0x40,0x9f,0x00,0x01,0xf8,0xc7,0x01,0x00,0x79,0x08,
+0x01,0x0d,0x00,0xf0,0x06,0x05,0xa0,0x09,0xf1,0x00,0x1f,0x83,0xff,0x20,0x9f,0xff,
+0xf1,0xfb,0xfe,0x30,0x09,0xf8,0x77,0x1f,0xfc,0x10,0x1a,0x00,0x13,0xfb,0x27,0x00,
+0x11,0x02,0x27,0x00,0xf0,0x02,0x02,0xf4,0x09,0xf6,0xad,0x1f,0x80,0x3f,0x40,0xdf,
+0xff,0x90,0xfd,0x8b,0xf1,0x0e,0xc5,0x92,0x00,0x05,0x56,0x00,0x22,0x01,0xf9,0x61,
+0x01,0x13,0x90,0x0d,0x00,0xf4,0x7a,0x93,0x00,0xff,0xff,0x7f,0xc0,0x8f,0xa0,0x09,
+0x9c,0xf5,0xff,0xaf,0x90,0x00,0x00,0xaf,0x2f,0xff,0x70,0x00,0x00,0x1f,0xb1,0xfd,
+0xf7,0x00,0x00,0x08,0xf4,0x1f,0x99,0xf5,0x00,0x04,0xfb,0x01,0xf9,0x0d,0xf9,0x03,
+0xfe,0x20,0x1f,0x90,0x1c,0xfa,0x07,0x30,0xac,0xf8,0x00,0x08,0x10,0x00,0x09,0xfc,
+0x20,0x00,0x00,0x04,0xb3,0x00,0x01,0xf7,0x00,0x00,0x6e,0xf2,0x95,0x1f,0x70,0x00,
+0x00,0x16,0x0f,0x81,0xf8,0x8b,0x10,0x20,0x00,0xf9,0x6f,0xff,0xf1,0x4f,0xb2,0x3f,
+0xff,0xfa,0x6f,0x10,0x6e,0x5f,0xfc,0x4f,0x76,0xf1,0x00,0x00,0x4f,0x81,0xf7,0x7f,
+0x00,0x03,0xc1,0xf8,0x1f,0xcf,0xe0,0x00,0xbe,0x0f,0x81,0xf8,0x63,0x00,0x4f,0x70,
+0xf8,0x00,0x00,0xe7,0x0d,0xe0,0x0e,0xd7,0x66,0x9f,0x60,0x66,0x00,0x6e,0xff,0xff,
+0x0e,0x09,0xf1,0x18,0x6c,0x40,0x0e,0xb0,0x00,0x00,0x04,0xdf,0x32,0xff,0xff,0xfc,
+0x00,0x00,0x50,0x6f,0x86,0x6e,0xc0,0x05,0x00,0x0d,0xd0,0x00,0xea,0x05,0xfe,0x49,
+0xf5,0x0b,0xdf,0x70,0x03,0xd3,0x59,0x00,0x59,0x60,0x00,0xbe,0x03,0xf9,0x13,0xa0,
 0x00,0x2c,0x28,0xf9,0x6a,0xf6,0x00,0x0a,0xf1,0x0c,0xe5,0xfc,0x00,0x04,0xf7,0x00,
 0x3f,0xff,0x20,0x00,0xde,0x07,0xcf,0xfd,0xff,0xa4,0x07,0x60,0xbe,0x92,0x02,0x9e,
-0x15,0x23,0xa0,0xcd,0x40,0x6f,0xff,0xf7,0x00,0x03,0xde,0x07,0xf7,0xbf,0x78,0xf2,
-0x09,0x20,0xaf,0x01,0xf7,0x00,0x05,0x00,0x4f,0xa0,0x0f,0xec,0x58,0xfc,0x3e,0xe1,
-0x00,0x8e,0xe6,0x07,0xe2,0x67,0x66,0x66,0x62,0x1c,0x57,0xd0,0x70,0x00,0x5b,0x1d,
-0xc1,0x1c,0xf1,0x00,0x0d,0xc0,0x4f,0xaa,0xf6,0x51,0x36,0xf3,0x02,0xaf,0xfb,0x00,
-0x01,0xfb,0x29,0xef,0xee,0xff,0xa3,0x09,0x31,0xfc,0x60,0x07,0xce,0x10,0x99,0x04,
-0x20,0xa2,0x00,0x7b,0x2c,0x20,0x5e,0xf5,0xc2,0x14,0x71,0x00,0x19,0x24,0x49,0xf5,
-0x44,0x00,0xa0,0x48,0xe2,0xf0,0x3f,0xc4,0x5f,0x38,0xf3,0x9f,0x00,0x4d,0x75,0xf1,
-0x6f,0x17,0xf0,0x34,0x59,0xf1,0x07,0x00,0x03,0x76,0xf9,0xbf,0x9c,0xf0,0x00,0xbf,
-0x6f,0x16,0xf1,0x7f,0x00,0x3f,0x85,0xf4,0x8f,0x49,0xf0,0x0c,0xf1,0x1a,0x00,0x63,
-0x57,0x05,0xf5,0x44,0x49,0xe0,0xa7,0x01,0xa0,0xae,0x50,0x4f,0xff,0xff,0x00,0x01,
-0xbf,0x35,0xf8,0xd3,0x0f,0xf0,0x13,0x40,0x7f,0x10,0x9f,0x00,0x04,0x00,0x0b,0xe0,
-0x09,0xf0,0x06,0xfb,0x16,0xf8,0x00,0x8f,0x83,0x07,0xf8,0xed,0x00,0x02,0xde,0x50,
-0x03,0x03,0x87,0x77,0x77,0x50,0x00,0x1a,0x0e,0x81,0x19,0xe0,0x0a,0xf2,0xe8,0x00,
-0x0d,0xb0,0x05,0xf8,0x0e,0x80,0x00,0xdb,0x01,0xfe,0x61,0x0e,0x74,0xb0,0x0a,0x40,
-0x0e,0xb6,0x66,0xea,0x69,0x17,0x11,0x92,0x6e,0x10,0x90,0x6e,0xf3,0x11,0xaf,0x11,
-0x00,0x00,0x17,0x3f,0xfa,0x0b,0x81,0x40,0x01,0x55,0xcf,0x55,0x30,0x5f,0xd3,0x1a,
-0x00,0x21,0x3c,0x2a,0xaa,0x11,0xf0,0x0a,0x01,0x57,0xbf,0xb7,0x77,0x00,0x03,0xe2,
+0x20,0xb9,0x08,0xf0,0x1a,0xcd,0x40,0x6f,0xff,0xf7,0x00,0x03,0xde,0x07,0xf7,0x7f,
+0x70,0x00,0x00,0x20,0xaf,0x01,0xf7,0x00,0x05,0x00,0x4f,0xa0,0x0f,0xec,0x58,0xfc,
+0x3e,0xe1,0x00,0x8e,0xe6,0x07,0xe2,0x67,0x66,0x66,0x62,0x00,0x00,0x09,0xa8,0x06,
+0xf3,0x12,0x00,0x5b,0x1d,0xc1,0x1c,0xf1,0x00,0x0d,0xc0,0x4f,0xaa,0xf6,0x00,0x06,
+0xf4,0x00,0xaf,0xfb,0x00,0x01,0xfb,0x29,0xef,0xee,0xff,0xa3,0x09,0x31,0xfc,0x60,
+0x07,0xce,0x10,0x99,0x04,0xf1,0x1a,0xa2,0x00,0x06,0xf1,0x00,0x00,0x5e,0xf5,0x00,
+0x6f,0x10,0x00,0x00,0x19,0x24,0x49,0xf5,0x44,0x00,0x20,0x05,0xff,0xff,0xff,0xf0,
+0x3f,0xc4,0x5f,0x38,0xf3,0x9f,0x00,0x4d,0x75,0xf1,0x6f,0x17,0xf0,0x00,0x00,0x5f,
+0x02,0x0c,0xf1,0x05,0x76,0xf9,0xbf,0x9c,0xf0,0x00,0xbf,0x6f,0x16,0xf1,0x7f,0x00,
+0x3f,0x85,0xf4,0x8f,0x49,0xf0,0x0c,0xf1,0x1a,0x00,0x63,0x57,0x05,0xf5,0x44,0x49,
+0xe0,0xa7,0x01,0xf0,0x33,0xae,0x50,0x4f,0xff,0xff,0x00,0x01,0xbf,0x35,0xf8,0x7c,
+0xf0,0x00,0x00,0x40,0x7f,0x10,0x9f,0x00,0x04,0x00,0x0b,0xe0,0x09,0xf0,0x06,0xfb,
+0x16,0xf8,0x00,0x8f,0x83,0x07,0xf8,0xed,0x00,0x02,0xde,0x50,0x03,0x03,0x87,0x77,
+0x77,0x50,0x00,0x1a,0x0e,0xff,0xff,0xfb,0x00,0x0a,0xf2,0xe8,0x00,0x0d,0xb0,0x05,
+0xf8,0x0e,0x80,0x00,0xdb,0x01,0xfe,0x61,0x0e,0x73,0xb0,0x0a,0x40,0x0e,0xb6,0x66,
+0xea,0xfd,0x00,0x20,0x05,0x92,0x25,0x02,0xa0,0x00,0x6e,0xf3,0x11,0xaf,0x11,0x00,
+0x00,0x17,0x3f,0xfa,0x0b,0x81,0x40,0x01,0x55,0xcf,0x55,0x30,0x5f,0xd3,0x1a,0x00,
+0x30,0x3c,0x2a,0xff,0xd1,0x05,0xf0,0x1b,0x01,0x57,0xbf,0xb7,0x77,0x00,0x03,0xe2,
 0x0b,0xe1,0x12,0x00,0x00,0xce,0x03,0xf7,0x0d,0xc0,0x00,0x5f,0x60,0xcf,0x45,0xaf,
-0x70,0xab,0x64,0xb1,0xfe,0xee,0x00,0x54,0x00,0x85,0x20,0x03,0xa1,0x05,0xa2,0xa8,
-0x62,0x90,0x5e,0xf3,0x44,0x9f,0x54,0x51,0x00,0x15,0x6f,0xc3,0x09,0xf2,0x00,0x40,
-0x06,0xf2,0x8f,0x39,0xf1,0x5f,0xd3,0x6f,0x17,0xf2,0x66,0x00,0x5d,0x27,0x4e,0x65,
-0xf4,0x16,0x8f,0xfb,0x47,0xf5,0x00,0x08,0x79,0xe7,0xf2,0xce,0x00,0x00,0xea,0xbc,
-0x0d,0xef,0x60,0x00,0x7f,0x3f,0x80,0x9f,0xf3,0x00,0x1f,0xb6,0xf8,0xdf,0xbe,0xfb,
-0x31,0xa3,0x7c,0x6d,0x40,0x07,0xe2,0x3f,0x0d,0xf1,0x04,0x81,0x00,0x09,0xa0,0x00,
-0x00,0x7f,0xf3,0x00,0x8f,0x30,0x00,0x00,0x28,0x48,0x89,0xe9,0x88,0x10,0x67,0x29,
-0x31,0xf2,0x4f,0xa2,0xcd,0x23,0x22,0x6e,0x50,0x54,0x40,0x10,0x0f,0xcc,0x1f,0xb0,
-0x02,0xd1,0x88,0xbf,0xa8,0x50,0x00,0xaf,0x10,0x06,0xf3,0x03,0x6a,0x00,0x1a,0x00,
-0x80,0x0c,0xe0,0x78,0x8b,0xf9,0x88,0x40,0xc7,0x98,0x3e,0x0b,0x0d,0x24,0x30,0x4b,
-0x20,0x6f,0xc8,0x40,0x20,0xef,0x5e,0x8f,0x09,0xf0,0x14,0x01,0x8c,0xfc,0x66,0xbf,
-0x50,0x03,0x00,0xdb,0xf7,0x6f,0xa0,0x04,0xfc,0x31,0x09,0xff,0xc0,0x00,0x05,0xe6,
-0x7c,0xfe,0xdf,0xea,0x30,0x00,0x2f,0xd6,0x00,0x28,0xe4,0x00,0x1e,0xbf,0x27,0x00,
-0x90,0x09,0xf9,0xf7,0x66,0x6f,0x80,0x02,0xf9,0x6f,0xbe,0x09,0x20,0xcf,0x16,0x92,
-0x04,0x65,0x06,0x70,0x6f,0x65,0x55,0xf8,0x51,0x02,0xe0,0x50,0xd9,0x1f,0x56,0xf0,
-0x01,0xa7,0x0d,0x91,0xf5,0x6f,0x00,0x00,0x00,0x0d,0x00,0xf4,0x2b,0x2d,0x50,0xae,
-0xc5,0xfc,0x7f,0x02,0xbf,0x6f,0xef,0xdf,0xfe,0xf0,0x00,0x39,0xce,0xcf,0xfc,0xff,
-0x00,0x04,0x75,0xf7,0x8f,0x6a,0xf0,0x01,0xf6,0x1f,0x61,0xf5,0x6f,0x00,0x7f,0x15,
-0xf4,0x1f,0x56,0xf0,0x0d,0xb0,0xbf,0x01,0xf5,0x6f,0x03,0xf5,0x2f,0xb0,0x1f,0x56,
-0xf0,0x02,0x00,0x83,0x00,0x20,0x6f,0x55,0x00,0xf0,0x02,0x77,0x00,0x01,0x36,0xae,
-0x30,0x09,0xfd,0x4e,0xff,0xfd,0x94,0x00,0x03,0x50,0x75,0x9f,0x16,0x04,0x70,0x33,
-0x39,0xf3,0x33,0x17,0xf9,0x1e,0xed,0x08,0x20,0x08,0xf3,0x0d,0x00,0x92,0x10,0x01,
-0x00,0x11,0x8f,0x21,0x10,0x00,0x7a,0x2b,0x29,0xe1,0xb1,0xf7,0x44,0x4d,0xa0,0x0a,
-0xf2,0x1f,0x40,0x00,0xca,0x04,0xf8,0x01,0x64,0x35,0xa0,0x00,0x1f,0x97,0x77,0xd9,
-0x00,0x08,0x60,0x00,0x0b,0xd7,0x03,0x80,0xc6,0x66,0xcf,0x66,0x60,0x00,0x55,0xef,
-0x6b,0x23,0xf4,0x2b,0x30,0x00,0x4f,0x70,0x9c,0x00,0x6f,0xc3,0x8f,0xfd,0xef,0xfb,
-0x00,0x3c,0x27,0xa8,0x76,0x56,0xd1,0x00,0x00,0x0d,0x5b,0x78,0xa0,0x00,0x06,0xb0,
-0xf5,0xc8,0xac,0x00,0x00,0xeb,0x2f,0x3c,0x8a,0xc0,0x00,0x9f,0x36,0xf1,0xc8,0xac,
-0x64,0x3f,0xa3,0xec,0x0c,0x89,0xda,0x71,0xc2,0x3d,0x20,0x42,0x5f,0xe2,0x0c,0x11,
-0xf0,0x0d,0x91,0x16,0x07,0xf1,0x46,0x00,0x7f,0xe4,0xf8,0x7f,0x1c,0xd0,0x00,0x27,
-0x0a,0xe7,0xf4,0xf5,0x00,0x40,0x00,0x87,0xaf,0x78,0x30,0x4f,0xd3,0x1f,0x59,0x02,
-0x40,0x3d,0x41,0xf7,0x11,0x2e,0x4e,0x01,0x0d,0x00,0x81,0x05,0xd2,0xf8,0x22,0x2e,
-0x90,0x00,0xcc,0x0d,0x00,0xf3,0x04,0x5f,0x51,0xfa,0x55,0x5e,0x90,0x0e,0xd0,0x1f,
-0x60,0x37,0xf9,0x00,0x75,0x01,0xf6,0x03,0xfd,0x30,0xf5,0x02,0x21,0x9e,0x56,0xe2,
-0x29,0x80,0xce,0x7f,0x43,0x33,0xea,0x00,0x00,0x26,0x0d,0x00,0x10,0x04,0x99,0x10,
-0xb0,0xea,0x04,0xfc,0x36,0xfe,0xee,0xef,0xa0,0x05,0xf4,0x25,0xc8,0x54,0xf3,0x18,
-0x01,0x15,0xf1,0x08,0xe0,0x40,0x00,0x4e,0x7f,0xfe,0x9f,0xdf,0x50,0x0c,0xd6,0xf7,
-0x69,0xf9,0x10,0x05,0xf5,0x6f,0x10,0x9e,0x06,0x50,0xed,0x0b,0xfc,0xe9,0xf5,0xca,
-0x0a,0x50,0xbe,0xa7,0x4e,0xff,0x40,0x59,0x16,0x12,0x30,0x2a,0x35,0x11,0xa8,0x1a,
-0x0d,0x62,0x8c,0x36,0x7f,0xc6,0x66,0x10,0x57,0x42,0x11,0x06,0xea,0x0e,0xf6,0x22,
-0xa3,0xfe,0x37,0xaf,0xb7,0xfd,0x75,0x02,0xa0,0x2e,0xe3,0x07,0xf9,0x00,0x01,0x3f,
-0xe4,0xf5,0x08,0xf9,0x00,0xb8,0x8b,0x4f,0x85,0xca,0x00,0x2f,0x74,0xf3,0xfc,0xe8,
-0xf1,0x09,0xf1,0xea,0x0f,0x6f,0x4f,0x70,0xfa,0x04,0x36,0xf5,0x50,0x51,0x03,0x30,
-0x02,0xd2,0x60,0x21,0x02,0x70,0x36,0x03,0x21,0x8f,0xca,0x36,0x03,0x80,0x68,0x26,
-0x6c,0xf6,0x65,0x00,0x10,0x02,0xcc,0x2a,0x90,0x2f,0xa2,0xbb,0xbe,0xfb,0xbb,0x70,
-0x6f,0x66,0xcc,0x2a,0x21,0x00,0x10,0xa1,0x01,0x30,0x05,0x92,0xfa,0xf6,0x4e,0x20,
-0xcd,0x2f,0xcc,0x2a,0x20,0x5f,0x61,0xdd,0x00,0xc4,0x0c,0xe0,0x1f,0x62,0x37,0xea,
-0x00,0x25,0x01,0xf4,0x01,0xfe,0x72,0x0b,0xe0,0x8b,0x20,0x00,0x0b,0xdc,0x90,0x06,
-0xec,0x11,0x11,0xbd,0x5e,0x40,0x02,0x44,0x1e,0xf4,0x2b,0xf6,0x04,0x02,0xf6,0x44,
-0xaf,0x33,0x15,0xfd,0x4f,0x9f,0xfa,0xf3,0xc2,0x04,0xb2,0xf5,0x44,0x7f,0x9f,0x00,
-0x01,0x3f,0x9f,0xf9,0xff,0xa0,0x02,0xf7,0xf8,0x7b,0x6f,0xf3,0x00,0x7f,0x6f,0x7e,
-0xf6,0xfb,0x43,0x0e,0xa8,0xd7,0x94,0xdf,0xd7,0xb5,0xf5,0xe9,0x12,0xce,0x8f,0xf7,
-0x18,0x1b,0x20,0x1b,0x20,0x0e,0x1f,0xf1,0x15,0x0b,0xa2,0xff,0xfe,0x12,0x4f,0x10,
-0x2c,0x6f,0x89,0xe6,0xe4,0xf1,0x00,0x00,0xfa,0xbe,0x6e,0x4f,0x11,0xa2,0x0f,0xee,
-0xe6,0xe4,0xf1,0x4f,0xf1,0xf4,0x6e,0x6e,0x4f,0x10,0x16,0x0f,0xff,0x1a,0x00,0xf4,
-0x16,0xf8,0x9e,0x6e,0x4f,0x10,0x0b,0x2f,0x8a,0xe6,0xe4,0xf1,0x04,0xf4,0xff,0xfe,
-0x5b,0x4f,0x10,0xae,0x0c,0x67,0xb0,0x04,0xf1,0x2f,0x88,0xf2,0x2f,0x77,0xaf,0x11,
-0x93,0xb7,0x00,0x51,0xce,0x90,0xb2,0x0e,0x12,0x20,0x9c,0x3b,0x10,0x6d,0x92,0x02,
-0xf0,0x0f,0x01,0xc6,0xdc,0x66,0xea,0x66,0x10,0x00,0x0d,0xa0,0x1f,0x90,0x00,0x04,
+0x70,0x0e,0xd0,0x5f,0xff,0xfe,0xee,0x00,0x54,0x00,0x85,0x20,0x03,0xa1,0x05,0xa2,
+0x00,0x07,0xf7,0x00,0x80,0xf3,0x44,0x9f,0x54,0x51,0x00,0x15,0x6f,0xc3,0x09,0xf1,
+0x00,0x40,0x06,0xf2,0x8f,0x39,0xf1,0x5f,0xd3,0x6f,0x17,0xf2,0x66,0x00,0x5d,0x27,
+0x61,0x0d,0xf4,0x17,0x00,0x8f,0xfb,0x47,0xf5,0x00,0x08,0x79,0xe7,0xf2,0xce,0x00,
+0x00,0xea,0xbc,0x0d,0xef,0x60,0x00,0x7f,0x3f,0x80,0x9f,0xf3,0x00,0x1f,0xb6,0xf8,
+0xdf,0xbe,0xfb,0x31,0xa3,0x7c,0x6d,0x40,0x07,0xe2,0x3f,0x0d,0xf0,0x06,0x81,0x00,
+0x09,0xa0,0x00,0x00,0x7f,0xf3,0x00,0x8f,0x30,0x00,0x00,0x28,0x48,0x89,0xe9,0x88,
+0x10,0x00,0x08,0x1e,0x07,0xe0,0x4f,0xa2,0x00,0x06,0xf3,0x00,0x00,0x6e,0x50,0x00,
+0x6f,0x30,0x00,0x00,0x33,0x0e,0xb0,0xfa,0x00,0x02,0xd1,0x88,0xbf,0xa8,0x50,0x00,
+0xaf,0x10,0x1a,0x00,0x20,0x3f,0x70,0x1a,0x00,0x91,0x0c,0xe0,0x78,0x8b,0xf9,0x88,
+0x40,0xc7,0x0e,0x7b,0x0d,0x05,0x01,0x00,0x00,0x55,0x01,0x20,0x4b,0x20,0xa0,0x01,
+0x30,0x04,0xef,0x5e,0x8f,0x09,0xf0,0x14,0x01,0x8c,0xfc,0x66,0xbf,0x50,0x03,0x00,
+0xdb,0xf7,0x6f,0xa0,0x04,0xfc,0x31,0x09,0xff,0xc0,0x00,0x05,0xe6,0x7c,0xfe,0xdf,
+0xea,0x30,0x00,0x2f,0xd6,0x00,0x28,0xe4,0x00,0x1e,0xbf,0x27,0x00,0x90,0x09,0xf9,
+0xf7,0x66,0x6f,0x80,0x02,0xf9,0x6f,0xbe,0x09,0xd0,0xcf,0x16,0xff,0xff,0xff,0x80,
+0x06,0x70,0x6f,0x65,0x55,0xf8,0x00,0x12,0x00,0x01,0x00,0xf0,0x00,0xcd,0x50,0xd9,
+0x1f,0x56,0xf0,0x01,0xa7,0x0d,0x91,0xf5,0x6f,0x00,0x00,0x00,0x0d,0x00,0xf3,0x2c,
+0x2d,0x50,0xae,0xc5,0xfc,0x7f,0x02,0xbf,0x6f,0xef,0xdf,0xfe,0xf0,0x00,0x39,0xce,
+0xcf,0xfc,0xff,0x00,0x04,0x75,0xf7,0x8f,0x6a,0xf0,0x01,0xf6,0x1f,0x61,0xf5,0x6f,
+0x00,0x7f,0x15,0xf4,0x1f,0x56,0xf0,0x0d,0xb0,0xbf,0x01,0xf5,0x6f,0x03,0xf5,0x2f,
+0xb0,0x1f,0x56,0xf0,0x02,0x00,0x83,0x00,0x20,0x6f,0x00,0x01,0x00,0xf0,0x13,0x77,
+0x00,0x01,0x36,0xae,0x30,0x09,0xfd,0x4e,0xff,0xfd,0x94,0x00,0x03,0x50,0x75,0x9f,
+0x00,0x00,0x01,0x00,0x33,0x39,0xf3,0x33,0x17,0xf9,0x1e,0xff,0xff,0xff,0xf4,0x08,
+0xf3,0x0d,0x00,0xf3,0x67,0x10,0x01,0x00,0x11,0x8f,0x21,0x10,0x00,0x7a,0x1f,0xff,
+0xff,0xfa,0x00,0x1f,0xb1,0xf7,0x44,0x4d,0xa0,0x0a,0xf2,0x1f,0x40,0x00,0xca,0x04,
+0xf8,0x01,0xff,0xff,0xff,0xa0,0x09,0x00,0x1f,0x97,0x77,0xd9,0x00,0x08,0x60,0x00,
+0x0b,0x90,0x00,0x00,0xaf,0xc6,0x66,0xcf,0x66,0x60,0x00,0x55,0xef,0xff,0xff,0xff,
+0x20,0x30,0x00,0x4f,0x70,0x9c,0x00,0x6f,0xc3,0x8f,0xfd,0xef,0xfb,0x00,0x3c,0x27,
+0xa8,0x76,0x56,0xd1,0x00,0x00,0x0d,0x5b,0x78,0xa0,0x00,0x06,0xb0,0xf5,0xc8,0xac,
+0x00,0x00,0xeb,0x2f,0x3c,0x8a,0xc0,0x00,0x9f,0x36,0xf1,0xc8,0xac,0x64,0x3f,0xa3,
+0xec,0x0c,0x89,0xda,0x71,0xc2,0x3d,0x20,0x42,0x5f,0xe2,0xa3,0x00,0xf1,0x1a,0x06,
+0x91,0x16,0x07,0xf1,0x46,0x00,0x7f,0xe4,0xf8,0x7f,0x1c,0xd0,0x00,0x27,0x0a,0xe7,
+0xf4,0xf5,0x00,0x40,0x00,0x87,0xaf,0x78,0x30,0x4f,0xd3,0x1f,0xff,0xff,0xf9,0x00,
+0x3d,0x41,0xf7,0x11,0x1e,0x90,0x00,0x00,0x0d,0x00,0x81,0x05,0xd2,0xf8,0x22,0x2e,
+0x90,0x00,0xcc,0x0d,0x00,0xf1,0x06,0x5f,0x51,0xfa,0x55,0x5e,0x90,0x0e,0xd0,0x1f,
+0x60,0x37,0xf9,0x00,0x75,0x01,0xf6,0x03,0xfd,0x30,0x00,0x10,0x55,0x00,0x20,0x9e,
+0x56,0xb7,0x00,0x90,0x01,0xce,0x7f,0x43,0x33,0xea,0x00,0x00,0x26,0x0d,0x00,0xf1,
+0x2e,0x04,0x00,0x6f,0x54,0x44,0xea,0x04,0xfc,0x36,0xfe,0xee,0xef,0xa0,0x05,0xf4,
+0x25,0x55,0x55,0x53,0x00,0x01,0x15,0xf1,0x08,0xe0,0x40,0x00,0x4e,0x7f,0xfe,0x9f,
+0xdf,0x50,0x0c,0xd6,0xf7,0x69,0xf9,0x10,0x05,0xf5,0x6f,0x10,0x9e,0x06,0x50,0xed,
+0x0b,0xfc,0xe9,0xf5,0xca,0x0a,0x50,0xbe,0xa7,0x4e,0xff,0x40,0x00,0x01,0x55,0x00,
+0x11,0x30,0x06,0x00,0xf0,0x05,0x7f,0xa8,0xff,0xff,0xff,0xf2,0x00,0x8c,0x36,0x7f,
+0xc6,0x66,0x10,0x00,0x00,0x03,0xf7,0x00,0x00,0x06,0x25,0x01,0xf4,0x25,0xff,0xa3,
+0xfe,0x37,0xaf,0xb7,0xfd,0x75,0x02,0xa0,0x2e,0xe3,0x07,0xf9,0x00,0x01,0x3f,0xe4,
+0xf5,0x08,0xf9,0x00,0xb8,0x8b,0x4f,0x85,0xca,0x00,0x2f,0x74,0xf3,0xfc,0xe8,0xf1,
+0x09,0xf1,0xea,0x0f,0x6f,0x4f,0x70,0xfa,0x04,0x36,0xf5,0x50,0x51,0x03,0x30,0x02,
+0xfd,0x10,0xa7,0x01,0xf1,0x1a,0x02,0x70,0x00,0x09,0xf0,0x00,0x00,0x8f,0xca,0xff,
+0xff,0xff,0xf1,0x00,0x68,0x26,0x6c,0xf6,0x65,0x00,0x10,0x02,0xbb,0xef,0xbb,0x90,
+0x2f,0xa2,0xbb,0xbe,0xfb,0xbb,0x70,0x6f,0x66,0x88,0x88,0x88,0x73,0x00,0x10,0xa1,
+0x01,0xf0,0x00,0x05,0x92,0xfa,0x77,0x7e,0xa0,0x00,0xcd,0x2f,0xa7,0x77,0xea,0x00,
+0x5f,0x61,0xdd,0x00,0xd3,0x0c,0xe0,0x1f,0x62,0x37,0xea,0x00,0x25,0x01,0xf4,0x01,
+0xfe,0x40,0x55,0x00,0xf3,0x3e,0x8b,0x20,0x00,0x0b,0xdc,0x90,0x06,0xec,0x11,0x11,
+0xbd,0x5e,0x40,0x02,0x4f,0xff,0xff,0xff,0xf6,0x04,0x02,0xf6,0x44,0xaf,0x33,0x15,
+0xfd,0x4f,0x9f,0xfa,0xf3,0xc2,0x04,0xb2,0xf5,0x44,0x7f,0x9f,0x00,0x01,0x3f,0x9f,
+0xf9,0xff,0xa0,0x02,0xf7,0xf8,0x7b,0x6f,0xf3,0x00,0x7f,0x6f,0x7e,0xf6,0xfb,0x43,
+0x0e,0xa8,0xd7,0x94,0xdf,0xd7,0xb5,0xf5,0xe9,0x12,0xce,0x8f,0xf7,0x18,0x1b,0x20,
+0x1b,0x20,0x9d,0xab,0x00,0xf1,0x15,0x0b,0xa2,0xff,0xfe,0x12,0x4f,0x10,0x2c,0x6f,
+0x89,0xe6,0xe4,0xf1,0x00,0x00,0xfa,0xbe,0x6e,0x4f,0x11,0xa2,0x0f,0xee,0xe6,0xe4,
+0xf1,0x4f,0xf1,0xf4,0x6e,0x6e,0x4f,0x10,0x16,0x0f,0xff,0x1a,0x00,0xf3,0x16,0xf8,
+0x9e,0x6e,0x4f,0x10,0x0b,0x2f,0x8a,0xe6,0xe4,0xf1,0x04,0xf4,0xff,0xfe,0x5b,0x4f,
+0x10,0xae,0x0c,0x67,0xb0,0x04,0xf1,0x2f,0x88,0xf2,0x2f,0x77,0xaf,0x11,0x93,0xb7,
+0x00,0x51,0xce,0x90,0xa9,0x00,0x21,0x04,0x20,0x07,0x00,0x20,0xdf,0x6d,0x92,0x02,
+0xf0,0x1b,0x01,0xc6,0xdc,0x66,0xea,0x66,0x10,0x00,0x0d,0xa0,0x1f,0x90,0x00,0x04,
 0x00,0xda,0xef,0xff,0xfe,0x08,0xfb,0x1e,0x9e,0x83,0x39,0xe0,0x07,0xb0,0xf9,0xef,
-0x53,0x12,0x90,0x0f,0x7e,0x83,0x39,0xe0,0x00,0xa3,0xf5,0xef,0x2e,0x1c,0xfb,0x08,
-0x9f,0x37,0x2e,0x86,0x50,0x0d,0xca,0xe6,0xf4,0xe8,0x9f,0x15,0xf7,0xf9,0xcc,0x5f,
-0x82,0xf5,0x19,0x2c,0x20,0x1f,0xe4,0x75,0x29,0x30,0x2e,0x80,0xae,0x23,0x73,0xe1,
-0x7c,0x5f,0xfc,0xfe,0xbb,0x00,0xb5,0x4f,0xf7,0x7f,0xa6,0x60,0x19,0xe7,0xb9,0x31,
-0xf1,0x00,0x01,0x95,0xf8,0x8f,0xa7,0x30,0x00,0xbe,0x7f,0x77,0xfa,0x62,0x00,0xcf,
-0x45,0x97,0x60,0xc3,0x70,0x5f,0x95,0x44,0x44,0x01,0x77,0x67,0x9f,0xa6,0x66,0x64,
-0x92,0x5e,0x04,0x9a,0x16,0x20,0x03,0xf5,0x05,0x00,0x03,0xb0,0x00,0x10,0x74,0x01,
-0x1f,0xf1,0x0e,0x01,0xa7,0x4f,0x3a,0x67,0xf1,0x00,0x00,0x04,0xf2,0xe7,0x5f,0x10,
-0x28,0x00,0x4f,0xc9,0xda,0xf1,0x08,0xfe,0x14,0xfa,0x79,0xaf,0x10,0x06,0xb0,0x4e,
-0x31,0x48,0x10,0x04,0xf3,0x55,0x30,0x00,0x93,0xbf,0xb2,0x02,0xf0,0x06,0x2f,0x7b,
-0x9a,0x7c,0x6d,0x90,0x0a,0xf1,0xb9,0xa7,0xc6,0xd9,0x03,0xf8,0x5d,0xcc,0xbd,0xae,
-0xb2,0x4e,0x1c,0x27,0x0d,0x19,0x50,0x85,0x6e,0x20,0x8e,0x30,0x5b,0x00,0xf2,0x04,
-0x02,0xdf,0x2f,0x72,0x26,0xf1,0x00,0x01,0x60,0xff,0xed,0x4f,0x10,0x01,0x00,0x3f,
-0x87,0xe6,0xf4,0x57,0x0b,0xf0,0x0f,0xf6,0x08,0xf8,0xf6,0x55,0x55,0x6f,0x60,0x02,
-0x17,0xff,0xff,0xff,0x72,0x00,0x48,0x2f,0xb8,0x8a,0xf2,0x00,0x0c,0xe2,0xfa,0x77,
-0x9f,0x20,0x04,0xf6,0x1f,0x9e,0x02,0xca,0xde,0x01,0xf6,0x13,0x7f,0x20,0x03,0x50,
-0x1f,0x50,0x7f,0xc0,0x8e,0x2b,0xf1,0x00,0x45,0x00,0xf8,0xd7,0xbc,0x60,0x0b,0xf7,
-0x5f,0xbe,0xad,0xd9,0x20,0x0a,0xae,0xfc,0x4e,0xf1,0x00,0x00,0x7e,0x5e,0xbb,0xc9,
-0x55,0xf8,0x1d,0x42,0x88,0x65,0xa4,0x06,0xc0,0xef,0x43,0x13,0xf5,0x15,0x0e,0x94,
-0xaf,0x45,0xf5,0x00,0xd5,0x79,0x5a,0xf5,0x5c,0x20,0x4f,0x31,0xff,0xff,0xef,0x90,
-0x0b,0xe0,0x1f,0x47,0xf0,0xd9,0x02,0xf8,0x01,0xf4,0x7f,0xaf,0x70,0x08,0x20,0x03,
-0x17,0xf2,0x12,0x07,0x40,0x37,0x00,0x01,0xe4,0x84,0x54,0x02,0xb4,0x44,0xf2,0x09,
+0xff,0xfe,0x00,0x00,0x0f,0x7e,0x83,0x39,0xe0,0x00,0xa3,0xf5,0x0d,0x00,0xfa,0x0a,
+0x6f,0x9f,0x37,0x2e,0x86,0x50,0x0d,0xca,0xe6,0xf4,0xe8,0x9f,0x15,0xf7,0xf9,0xcc,
+0x5f,0x82,0xf5,0x19,0x2c,0x20,0x1f,0xe4,0x00,0x01,0x00,0xf0,0x06,0x2e,0x80,0xae,
+0x3d,0x40,0x00,0x00,0x7c,0x5f,0xfc,0xfe,0xbb,0x00,0xb5,0x4f,0xf7,0x7f,0xa6,0x60,
+0x19,0xe7,0x11,0x01,0xf0,0x01,0x00,0x01,0x95,0xf8,0x8f,0xa7,0x30,0x00,0xbe,0x7f,
+0x77,0xfa,0x62,0x00,0xcf,0x45,0xdb,0x01,0xe0,0x07,0x70,0x5f,0x95,0x44,0x44,0x01,
+0x77,0x67,0x9f,0xa6,0x66,0x64,0x2f,0xda,0x01,0x60,0xff,0xa0,0x00,0x00,0x3f,0x50,
+0x49,0x00,0x20,0x03,0xf5,0x05,0x00,0x03,0xb0,0x00,0xf0,0x20,0x74,0xff,0xff,0xff,
+0x10,0x01,0xa7,0x4f,0x3a,0x67,0xf1,0x00,0x00,0x04,0xf2,0xe7,0x5f,0x10,0x28,0x00,
+0x4f,0xc9,0xda,0xf1,0x08,0xfe,0x14,0xfa,0x79,0xaf,0x10,0x06,0xb0,0x4e,0xee,0xee,
+0xe1,0x00,0x00,0x04,0x55,0x55,0x55,0x30,0x00,0x93,0xbf,0xb2,0x02,0xf3,0x0b,0x2f,
+0x7b,0x9a,0x7c,0x6d,0x90,0x0a,0xf1,0xb9,0xa7,0xc6,0xd9,0x03,0xf8,0x5d,0xcc,0xbd,
+0xae,0xb2,0x4e,0x1c,0xee,0xee,0xee,0xee,0x50,0xaa,0x00,0x02,0x68,0x01,0x20,0x8e,
+0x30,0x5b,0x00,0xf0,0x07,0x02,0xdf,0x2f,0x72,0x26,0xf1,0x00,0x01,0x60,0xff,0xed,
+0x4f,0x10,0x01,0x00,0x3f,0x87,0xe6,0xf4,0x13,0xf9,0x5f,0xb7,0x00,0xf0,0x0e,0x08,
+0xf8,0xf6,0x55,0x55,0x6f,0x60,0x02,0x17,0xff,0xff,0xff,0x72,0x00,0x48,0x2f,0xb8,
+0x8a,0xf2,0x00,0x0c,0xe2,0xfa,0x77,0x9f,0x20,0x04,0xf6,0x1f,0x9e,0x02,0xc6,0xde,
+0x01,0xf6,0x13,0x7f,0x20,0x03,0x50,0x1f,0x50,0x7f,0xc0,0x07,0x01,0x00,0xc7,0x02,
+0xf0,0x00,0x45,0x00,0xf8,0xd7,0xbc,0x60,0x0b,0xf7,0x5f,0xbe,0xad,0xd9,0x20,0x0a,
+0xae,0x4e,0x00,0xf0,0x00,0x01,0x00,0x7e,0x5e,0xbb,0xc9,0x55,0xf8,0x1d,0x42,0x88,
+0x65,0xa4,0x06,0xc0,0xd7,0x03,0xf4,0x18,0x50,0x00,0x0e,0x94,0xaf,0x45,0xf5,0x00,
+0xd5,0x79,0x5a,0xf5,0x5c,0x20,0x4f,0x31,0xff,0xff,0xef,0x90,0x0b,0xe0,0x1f,0x47,
+0xf0,0xd9,0x02,0xf8,0x01,0xf4,0x7f,0xaf,0x70,0x08,0x20,0x03,0x17,0xf2,0x20,0x59,
+0x00,0x80,0x37,0x00,0x01,0xe4,0x00,0x00,0x06,0xfd,0x2c,0x01,0xf0,0x0e,0x80,0x02,
 0x54,0xab,0x45,0xd6,0x42,0x02,0x00,0x8f,0x40,0x07,0xf8,0x03,0xfb,0x7f,0xfe,0xee,
-0xef,0xe5,0x04,0xc0,0x4e,0x33,0x35,0xf2,0xbb,0x12,0xf1,0x1c,0x20,0x00,0xa6,0x05,
-0xed,0xf5,0x59,0x10,0x1f,0x99,0xf9,0x0a,0xdf,0xa1,0x08,0xe7,0xbf,0x40,0x2e,0xe4,
-0x00,0xf8,0x01,0xfd,0xf9,0x2c,0xf9,0x05,0x10,0x0c,0x84,0x00,0x05,0x10,0x06,0x60,
-0x16,0xf3,0x1a,0xd1,0x00,0x9f,0x9f,0x56,0x27,0x70,0x52,0x37,0xf5,0x4b,0xe3,0x20,
-0x20,0x45,0x1c,0xa2,0x00,0x4f,0xa0,0x12,0x5a,0xe5,0x51,0x00,0x6d,0x0e,0x20,0x61,
-0xf4,0x64,0xe9,0x59,0xe7,0x3f,0x60,0x07,0x7e,0x8c,0x7d,0x95,0xe6,0x00,0xe7,0xe8,
-0xfa,0xda,0xbe,0x60,0x8f,0x1e,0xfb,0xff,0xce,0xf6,0x1f,0x80,0xe8,0x19,0xe1,0x3f,
-0x60,0x61,0x0e,0x60,0x7d,0x0e,0xe2,0x08,0x40,0x0e,0x50,0x02,0x6a,0x20,0x6f,0x9e,
-0xff,0xe8,0xfa,0x50,0x00,0x21,0x3e,0x73,0x7d,0x00,0x00,0x20,0x5d,0xfe,0xb6,0xd0,
-0x00,0x4f,0x56,0x9b,0x5e,0x6f,0xff,0x80,0x98,0x6f,0xfe,0xe7,0xd6,0xf1,0x00,0x06,
-0x9a,0x4e,0x7c,0x3e,0x00,0x07,0x7d,0xfe,0xc8,0xb3,0xe0,0x01,0xf5,0x3f,0x73,0xba,
-0x3e,0x00,0x8c,0xbf,0xff,0xff,0x73,0xe0,0x0e,0x50,0x0e,0x54,0xf2,0x3e,0x00,0x80,
-0x00,0xe5,0x18,0x03,0xe0,0xb5,0x04,0xf5,0x3e,0x00,0x0b,0x50,0x1b,0x20,0x01,0xdd,
-0x5a,0xfb,0x74,0xf1,0x00,0x01,0xa8,0xe8,0xcc,0x7f,0x76,0x30,0x00,0x7f,0xde,0xcc,
-0xff,0xf7,0x5c,0x27,0xd5,0xae,0xf9,0x5e,0x01,0xba,0x6d,0xfd,0xef,0xc8,0xc0,0x00,
-0x06,0x9f,0x98,0x6f,0xc9,0x00,0x1a,0x8e,0xc8,0x80,0xdf,0x40,0x06,0xe0,0xdf,0xfb,
-0x08,0xf0,0x00,0xc9,0x1f,0x7b,0xb0,0xef,0x80,0x3f,0x3a,0xd2,0xca,0xae,0xaf,0x43,
-0xb2,0xd3,0xbe,0x6d,0x30,0xb2,0xed,0x5d,0xe0,0x00,0x0d,0xfe,0xed,0x00,0x4f,0x81,
-0x11,0xda,0x11,0x10,0x00,0x30,0xdf,0x3a,0x08,0xf4,0x2b,0x40,0x0d,0x97,0xec,0xb7,
-0xe3,0x6f,0xc1,0xd9,0x7d,0xc8,0x6b,0x00,0x7c,0x0e,0x70,0x4a,0xaa,0x50,0x00,0x00,
-0xf6,0xfc,0xfd,0xdd,0x00,0x0b,0x2f,0x5f,0xae,0xcc,0xd0,0x04,0xf6,0xf4,0xfc,0xfe,
-0xdd,0x00,0xae,0x6f,0x35,0x8e,0xc3,0x60,0x2f,0x8c,0xc9,0xbf,0x54,0xbf,0x42,0xb2,
-0xa5,0xa3,0xaf,0xfb,0x76,0xaa,0x00,0xf0,0x30,0x10,0x60,0x08,0x00,0x70,0x02,0xdf,
-0x78,0x47,0xf9,0x69,0x50,0x00,0x47,0xe5,0x9d,0xb8,0xe7,0x00,0x50,0x9d,0xe7,0xa8,
-0x9e,0xe1,0x6f,0xb5,0x36,0x7a,0x96,0x46,0x00,0x58,0xca,0xaa,0x8d,0xcb,0xa1,0x00,
-0x08,0x51,0x58,0x77,0x74,0x10,0x07,0x1c,0xdd,0xdd,0xef,0x40,0x03,0xf4,0xab,0xaa,
-0xaa,0xc3,0x00,0xae,0x0f,0xed,0xdd,0xdd,0xa0,0x52,0x80,0x02,0x22,0xe9,0x01,0x82,
-0x00,0x00,0x5f,0xa8,0x09,0x26,0x05,0xf6,0xb2,0x74,0xf0,0x10,0x43,0x06,0xf4,0x00,
-0x42,0x00,0x0c,0xe0,0x6f,0x30,0x0e,0xe0,0x02,0xf9,0x09,0xf2,0x04,0xf7,0x00,0xaf,
-0x30,0xcf,0x50,0xbe,0x00,0x04,0x70,0x0f,0xfb,0x06,0x50,0x9f,0x73,0x10,0xf4,0xde,
-0x04,0x40,0xfe,0x1e,0xe2,0x00,0x9b,0x48,0x40,0x3f,0xf5,0x00,0x2b,0x59,0x1c,0x86,
-0xfe,0x50,0xca,0x20,0x00,0x00,0x17,0xc1,0xb6,0x1e,0x14,0xf1,0x85,0x3a,0x10,0xa0,
-0x7b,0x0b,0x8b,0x77,0x75,0x00,0x02,0x22,0x9f,0x42,0x22,0xc6,0x17,0x72,0xf8,0x11,
-0x11,0x19,0xf0,0x00,0x0f,0xf5,0x16,0x00,0x49,0x59,0xfb,0x06,0x60,0x00,0x4f,0x4a,
-0x61,0xd5,0x4f,0x50,0x0d,0xe0,0xcb,0x0d,0xc0,0xbe,0x04,0xe4,0x0a,0xb0,0x7c,0x13,
-0xd2,0xd5,0x61,0x31,0xf3,0x04,0xf5,0xe1,0x62,0x21,0xaf,0x10,0xbf,0x13,0x00,0x4e,
-0x14,0x40,0x66,0x6e,0xf6,0x9f,0xce,0x44,0x61,0xfc,0x6a,0xf6,0x10,0x00,0x05,0xce,
-0x05,0x20,0x07,0xfd,0xf0,0x4a,0x12,0x2c,0x2f,0x0d,0xf6,0x0a,0xfb,0x54,0x45,0x5a,
-0x59,0xf1,0x04,0xf5,0xd3,0xf4,0xe5,0x8f,0x00,0xbe,0x0f,0x5b,0x87,0x8d,0xc0,0x1a,
-0x40,0x73,0x10,0x4f,0xd4,0x57,0x00,0x22,0x9f,0x20,0xf1,0x47,0x00,0xdc,0x12,0x40,
-0xb3,0x33,0x34,0xf7,0x22,0x63,0x30,0x33,0x4f,0x70,0xbb,0x52,0x00,0xf0,0x6a,0x20,
-0xed,0x88,0x20,0x55,0x21,0x0e,0xc7,0x77,0x0d,0x11,0xef,0x7c,0x3f,0xf5,0x0a,0x37,
-0x56,0x56,0x6a,0x4c,0xb0,0x0b,0xb8,0xb4,0xe1,0xf3,0xca,0x04,0xf5,0x6e,0x0f,0x38,
-0x6f,0x80,0x4a,0x03,0x60,0x30,0x5f,0xd2,0xc8,0x35,0x11,0x50,0x22,0x32,0x10,0xfa,
-0xe5,0x59,0x02,0x14,0x18,0xd2,0x22,0xee,0xf1,0xf3,0xd7,0x8d,0x00,0x06,0xaf,0x7f,
-0x8e,0xab,0xe6,0xcc,0x0d,0xe3,0xf1,0x00,0x5f,0x1f,0x3d,0x78,0xd0,0x00,0x6a,0xf7,
-0xf8,0xea,0xbe,0x63,0x11,0x3c,0xf1,0x07,0x0a,0x42,0x60,0x54,0x19,0x50,0x06,0xf5,
-0x5f,0x2a,0xe0,0xcf,0x11,0xec,0x04,0xf3,0x6f,0x23,0xf8,0x01,0x10,0x01,0x05,0x1c,
-0x40,0x09,0xa0,0x3c,0x10,0x24,0x58,0x61,0x46,0xf9,0x44,0x40,0x00,0xdf,0x84,0x3e,
-0x40,0xcf,0xf4,0x45,0xf9,0x70,0x2e,0x01,0x43,0x03,0xe0,0x39,0xf5,0x56,0xfa,0x55,
-0x20,0x00,0x9f,0xdd,0xef,0xed,0xd6,0x00,0x09,0x0d,0x00,0x12,0x50,0x40,0x4c,0xf0,
-0x06,0x10,0x1d,0x83,0x40,0x44,0x2a,0x20,0x09,0xf2,0x9f,0x0a,0xd0,0xec,0x03,0xf9,
-0x08,0xf1,0x6f,0x15,0xf5,0x02,0x5a,0x1d,0x13,0x02,0x5d,0x1c,0x00,0xf9,0x06,0xf9,
-0x3c,0x09,0xdb,0x60,0x00,0xaf,0xff,0xe0,0x9d,0x8f,0x10,0x3f,0xa4,0xdf,0x7c,0xe8,
-0xb1,0x1e,0xd9,0xdf,0xdf,0xff,0xff,0x46,0xe7,0x2b,0xf1,0x0d,0xf2,0x00,0x01,0xaf,
-0xf8,0x03,0xff,0x90,0x00,0x07,0xfc,0x01,0xde,0xaf,0x40,0x1d,0xfc,0x13,0xdf,0x41,
-0xef,0x40,0x87,0x00,0x6d,0x30,0x02,0xa0,0x04,0xd3,0x56,0x09,0x43,0xe4,0x00,0xdd,
-0x09,0xd0,0xcb,0x0d,0xe0,0x4f,0x40,0x8d,0x08,0xc0,0x4e,0x40,0xb5,0x01,0x21,0x09,
-0xa0,0x53,0x16,0xf0,0x00,0xab,0x01,0xdd,0xfe,0xdc,0x00,0x2a,0xb8,0x7f,0x74,0x4b,
-0xe0,0x2e,0xab,0xf7,0x22,0x27,0xf0,0x01,0xda,0xee,0x2f,0x96,0x6c,0xe0,0x79,0xcb,
-0x02,0xf9,0x77,0xce,0x00,0x0d,0xa0,0x2f,0xec,0x18,0xfa,0x10,0xfe,0x20,0x27,0xf5,
-0x22,0x00,0x3f,0xee,0x77,0xab,0xd3,0x60,0x09,0xf2,0x7f,0xbd,0x04,0x6f,0x34,0xf8,
-0x07,0xe8,0xe4,0x6f,0xda,0x3b,0x00,0x15,0x4e,0xff,0xa3,0x1e,0x35,0xf0,0x14,0x0f,
-0x14,0xff,0xba,0xdc,0x10,0x00,0xf1,0x26,0xe8,0x5f,0xa3,0x01,0x6f,0x7a,0xff,0x30,
-0xfe,0xf2,0x3a,0xfd,0x3f,0xfe,0xef,0xf9,0x05,0x9f,0xdd,0xf6,0x66,0x4c,0xf4,0x77,
-0xf3,0x9e,0xae,0x09,0x90,0x2f,0x00,0xcb,0x22,0x8f,0x00,0x02,0xf2,0x0c,0x7f,0x02,
-0xf1,0x05,0x5f,0xa0,0x5d,0x44,0xe9,0x00,0x09,0x9f,0x33,0xf4,0x3f,0x70,0x01,0xf4,
-0x86,0x5f,0x9a,0xf6,0x50,0x3c,0x4d,0x01,0x1a,0x10,0x65,0x1c,0x30,0x38,0xd7,0x00,
-0x47,0x4b,0xf3,0x04,0xef,0x6f,0xff,0xfe,0x00,0xe9,0xf7,0xf2,0xf8,0xf8,0xe0,0x0e,
-0x6f,0x7f,0x2f,0x5f,0x5e,0x00,0xe6,0x0d,0x00,0xf4,0x1d,0x6f,0x3f,0xff,0xfe,0x00,
-0xf6,0xf6,0xf5,0xf4,0x00,0x50,0x0f,0x5f,0x5d,0x8f,0x95,0x6f,0x30,0xf4,0xf5,0x8e,
-0xaf,0xff,0xa0,0x4f,0x2f,0x51,0xfc,0x20,0x00,0x09,0xe0,0xf5,0x04,0xef,0xb7,0x52,
-0x79,0x0f,0x50,0x01,0x7c,0xef,0x30,0x2f,0x30,0x01,0x5e,0x0d,0x08,0x06,0x00,0x54,
-0xee,0xaa,0xaf,0xda,0xa6,0x04,0x55,0x01,0xd6,0x05,0x00,0x9f,0x52,0x21,0x10,0x03,
-0xb6,0x01,0x20,0x07,0xf5,0xcb,0x2d,0x20,0x0d,0xf0,0x06,0x00,0x20,0x7f,0x90,0x06,
-0x00,0x13,0x2c,0xdf,0x75,0x07,0x01,0x00,0xb0,0xd8,0x8d,0x0d,0xff,0xff,0xc1,0x0d,
-0x88,0xd0,0xdb,0x32,0x0d,0x00,0x00,0xf0,0x85,0xf4,0x2b,0x0d,0xbb,0xe4,0xdb,0x33,
-0x33,0x00,0xdf,0xff,0xad,0xff,0xff,0xf1,0x0e,0x80,0x00,0xef,0xd2,0x9e,0x00,0xef,
-0xff,0x1f,0xaf,0x3e,0xa0,0x0f,0xa9,0xf1,0xf7,0xad,0xf5,0x01,0xf5,0x5f,0x3f,0x55,
-0xfd,0x00,0x5f,0x35,0xf6,0xf3,0xaf,0xe2,0x09,0xe0,0x5f,0xbf,0xcf,0xaf,0xe3,0x58,
-0x05,0xfa,0x9b,0x60,0x3d,0xbb,0x0c,0x02,0x7e,0x77,0x60,0x18,0x87,0x77,0x7e,0xe7,
-0x60,0xd2,0x2d,0x11,0xcc,0x7c,0x41,0x21,0x0c,0xc0,0x9e,0x1d,0x13,0xcc,0x26,0x47,
-0xd0,0xf7,0x01,0x88,0x88,0xef,0xfe,0x88,0x30,0x00,0x01,0xbf,0x6c,0xc0,0x8c,0x4c,
-0xf0,0x00,0x50,0xcc,0x00,0x00,0x6d,0xfd,0x30,0x0c,0xc0,0x00,0x1e,0xe6,0x00,0x78,
-0xfb,0x00,0x07,0x2a,0x08,0xfd,0x31,0x69,0x00,0x81,0x3b,0x00,0xdd,0x1a,0xf0,0x07,
-0x0e,0x8f,0x12,0xdd,0xfe,0xdb,0x02,0xfb,0xf8,0x28,0x8f,0xc8,0x70,0x4f,0xff,0xf6,
-0x55,0xfb,0x55,0x28,0xc6,0xf1,0x98,0x73,0x80,0x35,0x6f,0x10,0x00,0x07,0xf0,0x00,
-0x29,0x51,0x6f,0xd0,0xf4,0x5f,0xff,0x85,0xb8,0x7b,0xf7,0x22,0x78,0xf1,0x0e,0xb0,
-0x7f,0x0a,0x22,0x30,0x4f,0x27,0xf0,0x41,0x00,0x21,0x28,0xcf,0x17,0x22,0x1b,0xef,
-0x30,0x60,0xc1,0xf5,0x6f,0x00,0x0f,0x7d,0x40,0x0f,0x56,0xf0,0x00,0xf6,0x9e,0x0d,
-0x00,0xc0,0x62,0xd2,0x0f,0xbb,0xf4,0x78,0xfb,0x77,0x40,0xdd,0xef,0x9f,0x09,0x02,
-0xfc,0x1d,0x06,0xf1,0x03,0xfc,0x00,0x03,0x66,0xaf,0x00,0x4f,0xf0,0x00,0x7f,0xff,
-0xf0,0x09,0xff,0x40,0x00,0xca,0x6f,0x01,0xec,0xfb,0x00,0x0e,0x86,0xf0,0xaf,0x38,
-0xf6,0x05,0xf3,0x6f,0xaf,0x90,0x1d,0xf6,0x38,0x06,0xfa,0x80,0x00,0x1b,0x1d,0x48,
-0x24,0x3e,0x70,0xf3,0x3d,0xf1,0x19,0x70,0x57,0x66,0xce,0x7a,0x67,0x73,0x08,0xe4,
+0xef,0xe5,0x04,0xc0,0x4e,0x33,0x35,0xf2,0x00,0x00,0x03,0x32,0x04,0xf0,0x1c,0x00,
+0xa6,0x05,0xed,0xf5,0x59,0x10,0x1f,0x99,0xf9,0x0a,0xdf,0xa1,0x08,0xe7,0xbf,0x40,
+0x2e,0xe4,0x00,0xf8,0x01,0xfd,0xf9,0x2c,0xf9,0x05,0x10,0x0c,0x84,0x00,0x05,0x10,
+0x06,0x60,0x16,0xf3,0x1a,0xd1,0x00,0x9f,0x9f,0xff,0xee,0x02,0xf1,0x06,0x52,0x37,
+0xf5,0x4b,0xe3,0x20,0x20,0x00,0x4f,0xff,0xfd,0x00,0x4f,0xa0,0x12,0x5a,0xe5,0x51,
+0x00,0x6d,0x0e,0xbc,0x01,0xf4,0x65,0x00,0xe9,0x59,0xe7,0x3f,0x60,0x07,0x7e,0x8c,
+0x7d,0x95,0xe6,0x00,0xe7,0xe8,0xfa,0xda,0xbe,0x60,0x8f,0x1e,0xfb,0xff,0xce,0xf6,
+0x1f,0x80,0xe8,0x19,0xe1,0x3f,0x60,0x61,0x0e,0x60,0x7d,0x0e,0xe2,0x08,0x40,0x0e,
+0x50,0x02,0x6a,0x20,0x6f,0x9e,0xff,0xe8,0xfa,0x50,0x00,0x21,0x3e,0x73,0x7d,0x00,
+0x00,0x20,0x5d,0xfe,0xb6,0xd0,0x00,0x4f,0x56,0x9b,0x5e,0x6f,0xff,0x80,0x98,0x6f,
+0xfe,0xe7,0xd6,0xf1,0x00,0x06,0x9a,0x4e,0x7c,0x3e,0x00,0x07,0x7d,0xfe,0xc8,0xb3,
+0xe0,0x01,0xf5,0x3f,0x73,0xba,0x3e,0x00,0x8c,0xbf,0xff,0xff,0x73,0xe0,0x0e,0x50,
+0x0e,0x54,0xf2,0x3e,0x00,0x80,0x00,0xe5,0x18,0x03,0xe0,0xb5,0x04,0xf3,0x3e,0x00,
+0x0b,0x50,0x1b,0x20,0x01,0xdd,0x5a,0xfb,0x74,0xf1,0x00,0x01,0xa8,0xe8,0xcc,0x7f,
+0x76,0x30,0x00,0x7f,0xde,0xcc,0xff,0xf7,0x5c,0x27,0xd5,0xae,0xf9,0x5e,0x01,0xba,
+0x6d,0xfd,0xef,0xc8,0xc0,0x00,0x06,0x9f,0x98,0x6f,0xc9,0x00,0x1a,0x8e,0xc8,0x80,
+0xdf,0x40,0x06,0xe0,0xdf,0xfb,0x08,0xf0,0x00,0xc9,0x1f,0x7b,0xb0,0xef,0x80,0x3f,
+0x3a,0xd2,0xca,0xae,0xaf,0x43,0xb2,0xd3,0xbe,0x6d,0x30,0xb2,0x55,0x00,0xf4,0x3f,
+0x0c,0x90,0x00,0x0d,0xfe,0xed,0x00,0x4f,0x81,0x11,0xda,0x11,0x10,0x00,0x30,0xdf,
+0xff,0xff,0xff,0x70,0x40,0x0d,0x97,0xec,0xb7,0xe3,0x6f,0xc1,0xd9,0x7d,0xc8,0x6b,
+0x00,0x7c,0x0e,0x70,0x4a,0xaa,0x50,0x00,0x00,0xf6,0xfc,0xfd,0xdd,0x00,0x0b,0x2f,
+0x5f,0xae,0xcc,0xd0,0x04,0xf6,0xf4,0xfc,0xfe,0xdd,0x00,0xae,0x6f,0x35,0x8e,0xc3,
+0x60,0x2f,0x8c,0xc9,0xbf,0x54,0xbf,0x42,0xb2,0xa5,0xa3,0xaf,0xfb,0x76,0xaa,0x00,
+0xf1,0x42,0x10,0x60,0x08,0x00,0x70,0x02,0xdf,0x78,0x47,0xf9,0x69,0x50,0x00,0x47,
+0xe5,0x9d,0xb8,0xe7,0x00,0x50,0x9d,0xe7,0xa8,0x9e,0xe1,0x6f,0xb5,0x36,0x7a,0x96,
+0x46,0x00,0x58,0xca,0xaa,0x8d,0xcb,0xa1,0x00,0x08,0x51,0x58,0x77,0x74,0x10,0x07,
+0x1c,0xdd,0xdd,0xef,0x40,0x03,0xf4,0xab,0xaa,0xaa,0xc3,0x00,0xae,0x0f,0xed,0xdd,
+0xdd,0xb0,0x1f,0x80,0x00,0x02,0x22,0xe9,0x01,0x82,0x00,0x00,0x5f,0xfc,0x20,0x00,
+0x00,0x05,0xf6,0x57,0x00,0x10,0x5f,0xb1,0x02,0xf0,0x15,0x43,0x06,0xf4,0x00,0x42,
+0x00,0x0c,0xe0,0x6f,0x30,0x0e,0xe0,0x02,0xf9,0x09,0xf2,0x04,0xf7,0x00,0xaf,0x30,
+0xcf,0x50,0xbe,0x00,0x04,0x70,0x0f,0xfb,0x06,0x50,0x00,0x00,0x07,0xfd,0xf4,0xde,
+0x04,0xf5,0x09,0xfe,0x1e,0xe2,0x00,0x00,0x04,0xef,0x30,0x3f,0xf5,0x00,0x2b,0xff,
+0x40,0x00,0x4e,0xfe,0x50,0xca,0x20,0x00,0x00,0x17,0xc1,0x99,0x02,0x22,0x07,0xf1,
+0x5b,0x05,0x01,0x6a,0x03,0xc0,0x07,0xf8,0x77,0x75,0x00,0x02,0x22,0x9f,0x42,0x22,
+0x00,0x00,0x51,0x02,0xf0,0x01,0xf0,0x00,0x0f,0x93,0x33,0x33,0xaf,0x00,0x00,0xf8,
+0x11,0x11,0x19,0xf0,0x00,0x0f,0x14,0x00,0xfa,0x0c,0x00,0x00,0x55,0x55,0x55,0x55,
+0x60,0x00,0x4f,0x4a,0x61,0xd5,0x4f,0x50,0x0d,0xe0,0xcb,0x0d,0xc0,0xbe,0x04,0xe4,
+0x0a,0xb0,0x7c,0x13,0xd2,0xfa,0x03,0x30,0x03,0xf3,0x04,0xb3,0x03,0xf1,0x0c,0x0e,
+0xa0,0xaf,0x10,0x00,0x00,0xcf,0xff,0xff,0xff,0xf3,0x00,0x05,0x66,0x6e,0xf6,0x9f,
+0x10,0x00,0x00,0x08,0xfc,0x6a,0xf6,0x10,0x00,0x05,0xce,0x05,0x71,0x07,0xfd,0x10,
+0x00,0x6f,0x00,0x2c,0xed,0x03,0xf6,0x0b,0x35,0xfb,0x54,0x45,0x5a,0x59,0xf1,0x04,
+0xf5,0xd3,0xf4,0xe5,0x8f,0x00,0xbe,0x0f,0x5b,0x87,0x8d,0xc0,0x1a,0x40,0x73,0x10,
+0x4f,0xd4,0x57,0x00,0x10,0x9f,0xfb,0x02,0x00,0x29,0x03,0xf1,0x13,0x60,0x00,0x0e,
+0xb3,0x33,0x34,0xf7,0x00,0x00,0xeb,0x33,0x33,0x4f,0x70,0x00,0x0e,0xfe,0xee,0xee,
+0xe6,0x00,0x00,0xed,0x88,0x88,0x88,0x88,0x20,0x0e,0xc7,0x77,0x77,0x77,0x71,0x27,
+0x00,0xf5,0x0b,0xfc,0x00,0x37,0x56,0x56,0x6a,0x4c,0xb0,0x0b,0xb8,0xb4,0xe1,0xf3,
+0xca,0x04,0xf5,0x6e,0x0f,0x38,0x6f,0x80,0x4a,0x03,0x60,0x30,0x5f,0xb0,0x00,0x11,
+0x0a,0x03,0x04,0x70,0x09,0xfa,0x66,0x66,0x66,0x61,0x07,0x88,0x00,0xf1,0x02,0xfe,
+0x22,0xee,0xf1,0xf3,0xd7,0x8d,0x00,0x06,0xaf,0x7f,0x8e,0xab,0xe6,0x00,0xaf,0xff,
+0x1d,0x06,0xd1,0x5f,0x1f,0x3d,0x78,0xd0,0x00,0x6a,0xf7,0xf8,0xea,0xbe,0x63,0x1f,
+0xb0,0x00,0xf0,0x10,0x70,0x0a,0x42,0x60,0x54,0x19,0x50,0x06,0xf5,0x5f,0x2a,0xe0,
+0xcf,0x11,0xec,0x04,0xf3,0x6f,0x23,0xf8,0x01,0x10,0x01,0x00,0x00,0x02,0x00,0x00,
+0x09,0xa0,0x3c,0xa4,0x06,0x80,0xfc,0x46,0xf9,0x44,0x40,0x00,0xdf,0xff,0x56,0x04,
+0x81,0xcf,0xf4,0x45,0xf9,0x44,0x20,0x6f,0xff,0x43,0x03,0xe0,0x39,0xf5,0x56,0xfa,
+0x55,0x20,0x00,0x9f,0xdd,0xef,0xed,0xd6,0x00,0x09,0x0d,0x00,0x31,0x50,0x00,0x9f,
+0x27,0x00,0xf1,0x07,0x1d,0x83,0x40,0x44,0x2a,0x20,0x09,0xf2,0x9f,0x0a,0xd0,0xec,
+0x03,0xf9,0x08,0xf1,0x6f,0x15,0xf5,0x02,0x00,0x11,0x55,0x00,0x12,0x02,0x5a,0x01,
+0xf9,0x3e,0xf7,0x00,0x09,0xdb,0x60,0x00,0xaf,0xff,0xe0,0x9d,0x8f,0x10,0x3f,0xa4,
+0xdf,0x7c,0xe8,0xb1,0x1e,0xd9,0xdf,0xdf,0xff,0xff,0x46,0xe7,0x2b,0xf1,0x0d,0xf2,
+0x00,0x01,0xaf,0xf8,0x03,0xff,0x90,0x00,0x07,0xfc,0x01,0xde,0xaf,0x40,0x1d,0xfc,
+0x13,0xdf,0x41,0xef,0x40,0x87,0x00,0x6d,0x30,0x02,0xa0,0x04,0xd3,0x56,0x09,0x43,
+0xe4,0x00,0xdd,0x09,0xd0,0xcb,0x0d,0xe0,0x4f,0x40,0x8d,0x08,0xc0,0x4e,0x40,0xb5,
+0x01,0xf9,0x3f,0x09,0xa0,0x00,0x2f,0x80,0x00,0x00,0xab,0x01,0xdd,0xfe,0xdc,0x00,
+0x2a,0xb8,0x7f,0x74,0x4b,0xe0,0x2e,0xab,0xf7,0xff,0xff,0xfe,0x04,0xda,0xee,0x2f,
+0x96,0x6c,0xe0,0x79,0xcb,0x02,0xf9,0x77,0xce,0x00,0x0d,0xa0,0x2f,0xee,0xef,0xe0,
+0x00,0xfe,0x20,0x27,0xf5,0x22,0x00,0x3f,0xee,0x77,0xab,0xd3,0x60,0x09,0xf2,0x7f,
+0xbd,0x04,0x6f,0x34,0xf8,0x07,0xe8,0xe4,0x6f,0xda,0x3b,0x00,0x15,0x4e,0xff,0xa3,
+0x30,0x5b,0x00,0xf0,0x21,0x0f,0x14,0xff,0xba,0xdc,0x10,0x00,0xf1,0x26,0xe8,0x5f,
+0xa3,0x01,0x6f,0x7a,0xff,0x30,0xfe,0xf2,0x3a,0xfd,0x3f,0xfe,0xef,0xf9,0x05,0x9f,
+0xdd,0xf6,0x66,0x4c,0xf4,0x77,0xf3,0x9e,0xff,0xff,0xf8,0x00,0x2f,0x00,0xcb,0x22,
+0x8f,0x00,0x02,0xf2,0x0c,0x7f,0x02,0xf1,0x05,0x5f,0xa0,0x5d,0x44,0xe9,0x00,0x09,
+0x9f,0x33,0xf4,0x3f,0x70,0x01,0xf4,0x86,0x5f,0x9a,0xf6,0x50,0x3c,0x4d,0x01,0x29,
+0x10,0x10,0x5c,0x00,0x20,0x38,0xd7,0xc7,0x01,0xf3,0x05,0xef,0xef,0x6f,0xff,0xfe,
+0x00,0xe9,0xf7,0xf2,0xf8,0xf8,0xe0,0x0e,0x6f,0x7f,0x2f,0x5f,0x5e,0x00,0xe6,0x0d,
+0x00,0xf4,0x1c,0x6f,0x3f,0xff,0xfe,0x00,0xf6,0xf6,0xf5,0xf4,0x00,0x50,0x0f,0x5f,
+0x5d,0x8f,0x95,0x6f,0x30,0xf4,0xf5,0x8e,0xaf,0xff,0xa0,0x4f,0x2f,0x51,0xfc,0x20,
+0x00,0x09,0xe0,0xf5,0x04,0xef,0xb7,0x52,0x79,0x0f,0x50,0x01,0x7c,0xef,0xb6,0x00,
+0x4a,0xeb,0x00,0x1f,0x90,0x06,0x00,0x51,0xee,0xaa,0xaf,0xda,0xa6,0x19,0x03,0x31,
+0xf9,0x00,0xfa,0xd6,0x05,0x61,0xfd,0x99,0x99,0x99,0x10,0x03,0xb6,0x01,0x80,0x07,
+0xf5,0x00,0x00,0x9f,0x10,0x0d,0xf0,0x06,0x00,0x20,0x7f,0x90,0x06,0x00,0x10,0x2c,
+0xae,0x02,0x0a,0xa8,0x00,0xb1,0xd8,0x8d,0x0d,0xff,0xff,0xc1,0x0d,0x88,0xd0,0xdb,
+0x32,0x0d,0x00,0xf3,0x2e,0x90,0x00,0x00,0x0d,0xbb,0xe4,0xdb,0x33,0x33,0x00,0xdf,
+0xff,0xad,0xff,0xff,0xf1,0x0e,0x80,0x00,0xef,0xd2,0x9e,0x00,0xef,0xff,0x1f,0xaf,
+0x3e,0xa0,0x0f,0xa9,0xf1,0xf7,0xad,0xf5,0x01,0xf5,0x5f,0x3f,0x55,0xfd,0x00,0x5f,
+0x35,0xf6,0xf3,0xaf,0xe2,0x09,0xe0,0x5f,0xbf,0xcf,0xaf,0xe3,0x58,0x05,0xfa,0x9b,
+0x60,0x3d,0x5b,0x00,0x01,0x7f,0x00,0xf0,0x09,0xfd,0x00,0x18,0x87,0x77,0x7e,0xe7,
+0x60,0x00,0x4f,0x40,0x00,0xcc,0x00,0x00,0x08,0xf1,0x00,0x0c,0xc0,0x00,0x00,0xbd,
+0x00,0x0d,0x00,0x01,0xb7,0x03,0xf0,0x11,0xf7,0x01,0x88,0x88,0xef,0xfe,0x88,0x30,
+0x00,0x01,0xbf,0x6c,0xc0,0x00,0x00,0x05,0xef,0x50,0xcc,0x00,0x00,0x6d,0xfd,0x30,
+0x0c,0xc0,0x00,0x1e,0xe6,0x00,0x78,0xfb,0x00,0x07,0x3b,0x08,0xfd,0x50,0xbe,0x07,
+0xf0,0x31,0x06,0xf1,0x00,0x0e,0x80,0x00,0x0e,0x8f,0x12,0xdd,0xfe,0xdb,0x02,0xfb,
+0xf8,0x28,0x8f,0xc8,0x70,0x4f,0xff,0xf6,0x55,0xfb,0x55,0x28,0xc6,0xf1,0xef,0xff,
+0xff,0xf6,0x35,0x6f,0x10,0x00,0x07,0xf0,0x00,0x29,0xff,0xaf,0xff,0xff,0xf4,0x5f,
+0xff,0x85,0xb8,0x7b,0xf7,0x22,0x78,0xf1,0x0e,0xb0,0x7f,0x00,0x00,0x6f,0x10,0x4f,
+0x27,0xf0,0x41,0x00,0x20,0x28,0xcf,0x0d,0x00,0x3a,0x00,0xef,0x80,0x5b,0x00,0xc1,
+0xf5,0x6f,0x00,0x0f,0x7d,0x40,0x0f,0x56,0xf0,0x00,0xf6,0x9e,0x0d,0x00,0xc0,0x62,
+0xd2,0x0f,0xbb,0xf4,0x78,0xfb,0x77,0x40,0xdd,0xef,0x9f,0x09,0x02,0xfb,0x1e,0x06,
+0xf1,0x03,0xfc,0x00,0x03,0x66,0xaf,0x00,0x4f,0xf0,0x00,0x7f,0xff,0xf0,0x09,0xff,
+0x40,0x00,0xca,0x6f,0x01,0xec,0xfb,0x00,0x0e,0x86,0xf0,0xaf,0x38,0xf6,0x05,0xf3,
+0x6f,0xaf,0x90,0x1d,0xf6,0x38,0x06,0xfa,0x80,0x00,0x1b,0x20,0xb8,0x00,0x52,0x3e,
+0x70,0x00,0x00,0x0d,0xa3,0x03,0xf2,0x1e,0x57,0x66,0xce,0x7a,0x67,0x73,0x08,0xe4,
 0x3f,0x98,0xf3,0xdb,0x00,0x1b,0xc8,0xff,0xf4,0x8e,0x20,0x00,0x18,0x27,0xf9,0xa5,
-0x70,0x00,0xaf,0xdc,0xfe,0xdf,0xdf,0xc1,0x09,0x50,0x7a,0xc8,0x87,0x3a,0x11,0xeb,
-0x2f,0x14,0x74,0x02,0x3d,0x08,0x5f,0x3f,0xf0,0x23,0x03,0x33,0x20,0x6f,0x23,0x33,
-0x23,0xff,0xfd,0x06,0xfa,0xff,0xf9,0x03,0xf9,0x34,0x6f,0x16,0xf5,0x10,0x0e,0x72,
-0xf6,0xf0,0x4f,0x20,0x00,0xe7,0x2f,0x6f,0x04,0xf2,0x01,0xdf,0xeb,0xf6,0xf3,0x9f,
-0x82,0x19,0xfc,0xdb,0x6f,0x7f,0xff,0x60,0x0e,0x74,0x68,0xe0,0x1a,0x00,0xf3,0x09,
-0x00,0xbb,0x04,0xf2,0x01,0x4f,0xda,0x2f,0x70,0x4f,0x20,0x6f,0xeb,0x7c,0xe2,0x7a,
-0xf9,0x61,0x20,0x07,0xe3,0x3e,0xee,0xeb,0xc4,0x03,0x30,0x6f,0xff,0xf7,0x7a,0x1d,
-0xc0,0x6e,0xc6,0x6f,0x54,0x4a,0xf0,0x00,0xd9,0x05,0xf4,0x33,0x9f,0xa7,0x10,0xd0,
-0xfe,0xef,0xf0,0x26,0xec,0x65,0xf5,0x44,0xaf,0x04,0xff,0xff,0x5f,0xdf,0x57,0x90,
-0xd9,0x05,0xf6,0x44,0xaf,0x00,0x0d,0x91,0x6f,0x29,0x8b,0xf4,0x0b,0xef,0xf4,0x8f,
-0x1f,0x60,0x09,0xfc,0x84,0x1e,0xc1,0xf6,0x44,0x11,0x00,0x6d,0xf3,0x1f,0x9b,0xa0,
-0x00,0x0e,0xb3,0x00,0xcf,0xf5,0x00,0x45,0x3c,0x00,0x52,0x4c,0xf0,0x0f,0x41,0x6e,
-0xc6,0x8d,0x4f,0x97,0xf4,0x00,0xd9,0x08,0xea,0xfc,0xbf,0x40,0x0d,0x90,0x8f,0xbf,
-0xdc,0xf4,0x2e,0xff,0xb8,0xc0,0xe5,0x2f,0x41,0xaf,0xd8,0x8f,0x46,0x19,0xe0,0xd9,
-0x03,0x56,0xfb,0x55,0x10,0x0d,0x90,0x24,0x5f,0xa4,0x42,0x00,0xdd,0xfa,0x0a,0xe1,
-0x63,0xdf,0xfd,0x11,0x2f,0x81,0x10,0x3e,0x93,0x37,0x77,0xfb,0x77,0x60,0x89,0x3f,
-0xf1,0x07,0xfd,0x8c,0xcc,0x5f,0x27,0xf0,0x8e,0x06,0xcf,0x95,0xf2,0x7f,0x08,0xe0,
-0x07,0xe0,0x3f,0x7a,0xf6,0xbe,0x00,0x7e,0x88,0x2c,0x90,0x4b,0xf6,0x46,0x66,0x66,
-0x66,0x28,0xff,0xcb,0xfd,0x19,0x91,0x07,0xe0,0x13,0x3c,0xd3,0x33,0x00,0x7e,0x06,
-0xa4,0x3e,0xf5,0x0a,0xf7,0x7f,0x5f,0x5f,0x3f,0x38,0xff,0xe9,0xf4,0xe4,0xf2,0xf3,
-0x57,0x20,0x6f,0x4e,0x4f,0x6f,0x30,0x00,0x06,0xf4,0xd4,0xea,0xc0,0xed,0x40,0x10,
-0x3f,0xd8,0x36,0xf0,0x06,0x9f,0x53,0xf2,0xe1,0xe3,0xf1,0x05,0xf0,0x2f,0xef,0xef,
-0xef,0x10,0x5f,0x03,0x77,0x77,0x77,0x72,0x29,0xf5,0xfe,0x04,0xe1,0x85,0xff,0xe0,
-0x88,0x88,0x88,0x70,0x05,0xf0,0x0e,0xb7,0x77,0xdc,0x00,0x2e,0x27,0xf1,0x10,0xc0,
-0x06,0xf9,0x18,0xec,0xbe,0x5c,0x18,0xff,0xcd,0xfe,0x01,0xef,0x91,0x35,0x10,0x19,
-0xfc,0xc4,0xee,0x60,0x00,0x00,0x8a,0x62,0x01,0x92,0x00,0x2b,0x31,0xf8,0x76,0x5b,
-0x01,0xaf,0x01,0x10,0xef,0x8c,0x44,0x03,0x4f,0x41,0x21,0x2f,0xd0,0xbc,0x01,0x12,
-0x52,0xc9,0x01,0x11,0x9f,0x72,0x05,0x10,0x05,0x44,0x5f,0x19,0x30,0x35,0x41,0x03,
-0xfb,0x7a,0x03,0xa3,0x7c,0x11,0x22,0x41,0x5c,0x02,0x15,0x1e,0xb4,0xfa,0x55,0xfa,
-0x55,0xbe,0x00,0xf9,0x23,0xf9,0x22,0xae,0x12,0x00,0xb1,0x45,0xfa,0x44,0xbe,0x01,
-0xf8,0x12,0xf9,0x11,0xae,0x02,0x12,0x00,0x20,0x04,0xf7,0x24,0x00,0xf2,0x03,0x09,
-0xf0,0x00,0xf8,0x00,0x9e,0x1f,0xa0,0x00,0xf8,0x45,0xce,0x3e,0x20,0x00,0xf8,0x9f,
-0xf7,0xf0,0x09,0x12,0x01,0x35,0x06,0xf2,0x0c,0x1f,0x93,0x4f,0x93,0xaf,0x10,0x01,
-0xfd,0xab,0xfd,0xad,0xf1,0x00,0x1f,0xc9,0xaf,0xc9,0xdf,0x10,0x01,0xfa,0x45,0xfa,
-0x4a,0xf1,0x00,0x1f,0xd6,0x5c,0xf0,0x06,0x2b,0xf7,0x02,0xec,0x20,0x02,0xaf,0xfd,
-0x50,0x0c,0xff,0xc3,0x0c,0x73,0xf9,0x01,0xf6,0x7b,0x00,0x00,0x8f,0x80,0x77,0x90,
-0x02,0x9f,0xd0,0x01,0xf5,0x00,0x00,0x1e,0x91,0x80,0x77,0x07,0xb6,0x24,0xf0,0x2f,
-0xa0,0x00,0x01,0xdd,0xdd,0x20,0xde,0x77,0x71,0x2f,0xab,0xf3,0xaf,0xfe,0xff,0x42,
-0xf5,0x7e,0xcf,0xf9,0x2e,0xb0,0x2f,0x89,0xf5,0x74,0xfe,0xd0,0x02,0xff,0xff,0x35,
-0xbf,0xfd,0x61,0x2f,0x57,0xee,0xfe,0x63,0xaf,0xa2,0xf5,0x7e,0x6a,0xff,0xff,0xf3,
-0x2f,0xbc,0xf2,0x6f,0x66,0xbe,0x02,0xfd,0xdd,0x26,0xe0,0x07,0xe0,0x1b,0x7b,0x02,
-0x11,0xfe,0x67,0x7d,0x41,0x5a,0xe0,0x00,0xef,0x25,0x5e,0x81,0x0e,0xa2,0x3f,0x82,
-0x5f,0x50,0x00,0xef,0x41,0x58,0x63,0x0e,0xa3,0x4f,0x83,0x6f,0x50,0x1a,0x00,0x72,
-0x01,0x4f,0x71,0x1f,0xa1,0x00,0x04,0xc3,0x46,0xd3,0x15,0x7f,0xa5,0x5f,0xb5,0x50,
-0x05,0x57,0xfa,0x55,0xfb,0x55,0x31,0x8e,0x42,0xe2,0x4a,0xf8,0x02,0xfe,0x93,0x00,
-0xbf,0xd6,0x00,0x02,0x8e,0xf3,0x01,0x20,0xfe,0x22,0xc2,0x97,0x04,0xf3,0x08,0xa0,
-0x00,0x3b,0xf5,0x7f,0x65,0xfb,0x30,0x60,0x01,0xf0,0x01,0x31,0xf6,0x45,0x55,0x55,
-0x55,0xf3,0x1d,0x4e,0xff,0xff,0xff,0x4d,0x30,0x00,0xea,0x41,0x1f,0x20,0x00,0x0c,
-0xc0,0x2c,0x20,0x00,0x19,0xd2,0x14,0x72,0x30,0x02,0xf9,0x68,0xf8,0x68,0xf5,0xe6,
-0x14,0x64,0x50,0x02,0xf6,0x25,0xf5,0x25,0x0d,0x00,0xf1,0x18,0x00,0x9e,0xbd,0xfb,
-0xbf,0x40,0x00,0x09,0xea,0xcf,0xab,0xf4,0x00,0x00,0x9e,0xac,0xfa,0xaf,0x40,0x02,
-0xaa,0xaa,0xa4,0xaa,0xaa,0x80,0x3f,0xbe,0xaf,0x6e,0xcd,0xbd,0x03,0xfb,0xeb,0xf6,
-0xec,0xec,0xd0,0x47,0x00,0x30,0x97,0x01,0xf9,0x87,0x5b,0xf4,0x04,0xb0,0x19,0x5f,
-0xcb,0xbb,0xed,0x67,0x00,0x03,0xfb,0x99,0x9d,0xd0,0x00,0x00,0x3f,0xba,0xaa,0xdd,
-0xbf,0x4c,0x00,0xa9,0x34,0x10,0x02,0x02,0x01,0xf0,0x34,0xe7,0xf8,0xf3,0x00,0x05,
-0xa5,0xfc,0x0d,0xf5,0x6a,0x00,0x7f,0xff,0x20,0x3f,0xcf,0x70,0x06,0xef,0x40,0x12,
-0x9f,0xe6,0x08,0xff,0xff,0x76,0xff,0xfd,0xf3,0x02,0x11,0xe7,0x9c,0x2f,0x12,0x00,
-0x4f,0xff,0xcf,0x70,0xfd,0x80,0x06,0xd2,0x21,0xb6,0x58,0x93,0x00,0x9f,0xff,0x6d,
-0xca,0xee,0x00,0x01,0x23,0xf5,0xaf,0x9f,0x60,0x00,0x13,0x7f,0x35,0xcf,0x28,0x8a,
-0x35,0x97,0xe8,0x27,0x55,0x27,0x00,0xae,0x15,0x00,0xfb,0x62,0x03,0xca,0x38,0x20,
-0x17,0xf9,0xec,0x4e,0x01,0x78,0x71,0x20,0x17,0xf1,0xac,0x5e,0x02,0x16,0x00,0x43,
-0xf8,0x77,0x77,0x7c,0x16,0x00,0x11,0xf8,0x21,0x00,0x01,0x16,0x00,0x01,0x21,0x00,
-0x04,0xe0,0x01,0x10,0xf5,0xec,0x24,0x00,0x7e,0x8e,0x01,0x4d,0x8d,0xf0,0x09,0xe3,
+0x70,0x00,0xaf,0xdc,0xfe,0xdf,0xdf,0xc1,0x09,0x50,0x7a,0xc8,0x87,0x3a,0x11,0x77,
+0x77,0x8f,0xc7,0x77,0x74,0x74,0x08,0x00,0xf2,0x0a,0x11,0x80,0xe0,0x01,0x10,0xf8,
+0x60,0x01,0xf0,0x22,0x33,0x20,0x6f,0x23,0x33,0x23,0xff,0xfd,0x06,0xfa,0xff,0xf9,
+0x03,0xf9,0x34,0x6f,0x16,0xf5,0x10,0x0e,0x72,0xf6,0xf0,0x4f,0x20,0x00,0xe7,0x2f,
+0x6f,0x04,0xf2,0x01,0xdf,0xeb,0xf6,0xf3,0x9f,0x82,0x19,0xfc,0xdb,0x6f,0x7f,0xff,
+0x60,0x0e,0x74,0x68,0xe0,0x1a,0x00,0xf3,0x09,0x00,0xbb,0x04,0xf2,0x01,0x4f,0xda,
+0x2f,0x70,0x4f,0x20,0x6f,0xeb,0x7c,0xe2,0x7a,0xf9,0x61,0x20,0x07,0xe3,0x3e,0xee,
+0xeb,0xc4,0x03,0xf0,0x17,0x6f,0xff,0xf7,0xff,0xff,0xff,0x02,0x6e,0xc6,0x6f,0x54,
+0x4a,0xf0,0x00,0xd9,0x05,0xf4,0x33,0x9f,0x00,0x0d,0x90,0x5f,0xfe,0xef,0xf0,0x26,
+0xec,0x65,0xf5,0x44,0xaf,0x04,0xff,0xff,0x5f,0xee,0xef,0x1a,0x00,0xf3,0x15,0xf6,
+0x44,0xaf,0x00,0x0d,0x91,0x6f,0xff,0xff,0xf0,0x15,0xef,0xf4,0x8f,0x1f,0x60,0x09,
+0xfc,0x84,0x1e,0xc1,0xf6,0x44,0x11,0x00,0x6d,0xf3,0x1f,0x9b,0xa0,0x00,0x0e,0xb3,
+0x00,0xcf,0xf5,0xf6,0x00,0xf0,0x27,0x4f,0xff,0xf8,0xff,0xff,0xff,0x41,0x6e,0xc6,
+0x8d,0x4f,0x97,0xf4,0x00,0xd9,0x08,0xea,0xfc,0xbf,0x40,0x0d,0x90,0x8f,0xbf,0xdc,
+0xf4,0x2e,0xff,0xb8,0xc0,0xe5,0x2f,0x41,0xaf,0xd8,0x8f,0xff,0xff,0xf4,0x00,0xd9,
+0x03,0x56,0xfb,0x55,0x10,0x0d,0x90,0x24,0x5f,0xa4,0x42,0x00,0xdd,0xfa,0x0a,0xf0,
+0x01,0x63,0xdf,0xfd,0x11,0x2f,0x81,0x10,0x3e,0x93,0x37,0x77,0xfb,0x77,0x60,0x00,
+0x07,0x52,0x02,0xf0,0x06,0x8c,0xcc,0x5f,0x27,0xf0,0x8e,0x06,0xcf,0x95,0xf2,0x7f,
+0x08,0xe0,0x07,0xe0,0x3f,0x7a,0xf6,0xbe,0x00,0x7e,0x6d,0x02,0xf0,0x08,0xe0,0x4b,
+0xf6,0x46,0x66,0x66,0x66,0x28,0xff,0xcb,0xff,0xff,0xff,0xf5,0x07,0xe0,0x13,0x3c,
+0xd3,0x33,0x00,0x7e,0x06,0xe2,0x05,0xf4,0x0a,0x07,0xf7,0x7f,0x5f,0x5f,0x3f,0x38,
+0xff,0xe9,0xf4,0xe4,0xf2,0xf3,0x57,0x20,0x6f,0x4e,0x4f,0x6f,0x30,0x00,0x06,0xf4,
+0xd4,0xea,0x0b,0x09,0xf0,0x0d,0x7f,0xff,0x3f,0xff,0xff,0xff,0x12,0x9f,0x53,0xf2,
+0xe1,0xe3,0xf1,0x05,0xf0,0x2f,0xef,0xef,0xef,0x10,0x5f,0x03,0x77,0x77,0x77,0x72,
+0x29,0xf5,0xfe,0x04,0xf0,0x00,0x85,0xff,0xe0,0x88,0x88,0x88,0x70,0x05,0xf0,0x0e,
+0xb7,0x77,0xdc,0x00,0x5f,0xc2,0x05,0xf0,0x0f,0xc0,0x06,0xf9,0x18,0xec,0xbe,0x5c,
+0x18,0xff,0xcd,0xfe,0x01,0xef,0x91,0x35,0x10,0x19,0xfc,0xc4,0xee,0x60,0x00,0x00,
+0x8a,0x62,0x01,0x92,0x00,0x2b,0x31,0xa2,0x01,0x21,0x08,0xf3,0xaf,0x01,0x80,0xef,
+0x89,0xfc,0x88,0x88,0x00,0x7f,0xff,0xa3,0x00,0x21,0x2f,0xd0,0xbc,0x01,0x12,0x52,
+0xc9,0x01,0x11,0x9f,0x72,0x05,0x63,0x05,0x88,0x9f,0xc8,0x88,0x30,0xd6,0x01,0x02,
+0xe3,0x01,0x12,0x1f,0xf0,0x01,0x10,0x88,0x01,0x00,0x30,0x85,0x00,0x22,0x01,0x00,
+0x11,0x00,0x01,0x06,0xc4,0x00,0xfa,0x55,0xfa,0x55,0xbe,0x00,0xf9,0x23,0xf9,0x22,
+0xae,0x12,0x00,0xb1,0x45,0xfa,0x44,0xbe,0x01,0xf8,0x12,0xf9,0x11,0xae,0x02,0x12,
+0x00,0x20,0x04,0xf7,0x24,0x00,0xf2,0x03,0x09,0xf0,0x00,0xf8,0x00,0x9e,0x1f,0xa0,
+0x00,0xf8,0x45,0xce,0x3e,0x20,0x00,0xf8,0x9f,0xf7,0xf0,0x09,0x12,0x01,0x35,0x06,
+0xf2,0x0a,0x1f,0x93,0x4f,0x93,0xaf,0x10,0x01,0xfd,0xab,0xfd,0xad,0xf1,0x00,0x1f,
+0xc9,0xaf,0xc9,0xdf,0x10,0x01,0xfa,0x45,0xfa,0x4a,0xf1,0x7c,0x00,0xf8,0x17,0x10,
+0x00,0x2b,0xf7,0x02,0xec,0x20,0x02,0xaf,0xfd,0x50,0x0c,0xff,0xc3,0x0c,0x73,0xf9,
+0x01,0xf6,0x7b,0x00,0x00,0x8f,0x60,0x1f,0x50,0x00,0x02,0x9f,0xd0,0x01,0xf5,0x00,
+0x00,0x1e,0x91,0x00,0x1f,0x97,0x03,0xf0,0x30,0x04,0xa0,0x00,0x01,0xdd,0xdd,0x20,
+0xde,0x77,0x71,0x2f,0xab,0xf3,0xaf,0xfe,0xff,0x42,0xf5,0x7e,0xcf,0xf9,0x2e,0xb0,
+0x2f,0x89,0xf5,0x74,0xfe,0xd0,0x02,0xff,0xff,0x35,0xbf,0xfd,0x61,0x2f,0x57,0xee,
+0xfe,0x63,0xaf,0xa2,0xf5,0x7e,0x6a,0xff,0xff,0xf3,0x2f,0xbc,0xf2,0x6f,0x66,0xbe,
+0x02,0xfd,0xdd,0x26,0xe0,0x07,0xe0,0x1b,0x7b,0x02,0x10,0xfe,0xda,0x03,0x31,0xf5,
+0x5a,0xe0,0x20,0x07,0xf3,0x06,0xf5,0x00,0x0e,0xa2,0x3f,0x82,0x5f,0x50,0x00,0xef,
+0xee,0xff,0xef,0xf5,0x00,0x0e,0xa3,0x4f,0x83,0x6f,0x50,0x1a,0x00,0x81,0x01,0x4f,
+0x71,0x1f,0xa1,0x00,0x04,0xff,0x47,0x07,0xe2,0x15,0x7f,0xa5,0x5f,0xb5,0x50,0x05,
+0x57,0xfa,0x55,0xfb,0x55,0x31,0xff,0x06,0x05,0xf1,0x00,0x4a,0xf8,0x02,0xfe,0x93,
+0x00,0xbf,0xd6,0x00,0x02,0x8e,0xf3,0x01,0x20,0x00,0xdd,0x02,0xc2,0x97,0x04,0xf3,
+0x08,0xa0,0x00,0x3b,0xf5,0x7f,0x65,0xfb,0x30,0x60,0x01,0xf1,0x19,0x31,0xf6,0x45,
+0x55,0x55,0x55,0xf3,0x1d,0x4e,0xff,0xff,0xff,0x4d,0x30,0x00,0xea,0x33,0x3a,0xf0,
+0x00,0x00,0x0c,0xee,0xee,0xed,0x00,0x00,0x19,0x99,0x99,0x99,0x99,0x30,0x02,0xf9,
+0x68,0xf8,0x68,0xf5,0x00,0x7e,0x03,0x64,0x50,0x02,0xf6,0x25,0xf5,0x25,0x0d,0x00,
+0xf1,0x18,0x00,0x9e,0xbd,0xfb,0xbf,0x40,0x00,0x09,0xea,0xcf,0xab,0xf4,0x00,0x00,
+0x9e,0xac,0xfa,0xaf,0x40,0x02,0xaa,0xaa,0xa4,0xaa,0xaa,0x80,0x3f,0xbe,0xaf,0x6e,
+0xcd,0xbd,0x03,0xfb,0xeb,0xf6,0xec,0xec,0xd0,0x47,0x00,0xf0,0x13,0x97,0x01,0xf9,
+0x88,0x88,0x88,0x8d,0xb0,0x19,0x5f,0xcb,0xbb,0xed,0x67,0x00,0x03,0xfb,0x99,0x9d,
+0xd0,0x00,0x00,0x3f,0xba,0xaa,0xdd,0x00,0x07,0xff,0xff,0xff,0xff,0xff,0xf1,0xf4,
+0x46,0x00,0x00,0x00,0x13,0x02,0x00,0x00,0x6f,0xff,0xe7,0xf8,0xf3,0x00,0x05,0xa5,
+0xfc,0x0d,0xf5,0x6a,0x00,0x7f,0xff,0x20,0x3f,0xcf,0x70,0x06,0xef,0x40,0x12,0x9f,
+0xe6,0x08,0xff,0xff,0x76,0xff,0xfd,0xf3,0x02,0x11,0xe7,0x9c,0x2f,0x12,0x00,0x4f,
+0xff,0xcf,0x70,0xfd,0x80,0x06,0xd2,0x21,0xb6,0x58,0x93,0x00,0x9f,0xff,0x6d,0xca,
+0xee,0x00,0x01,0x23,0xf5,0xaf,0x9f,0x60,0x00,0x13,0x7f,0x35,0xcf,0xf5,0x00,0x02,
+0xff,0x97,0xe8,0x27,0xe1,0x00,0x01,0x00,0x10,0xdc,0x05,0x00,0xf2,0x0b,0x3f,0xa0,
+0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0x17,0xf9,0x88,0x88,0x8c,0xf1,0x7f,0x10,0x00,
+0x00,0x8f,0x17,0xf1,0x00,0x00,0x09,0xf1,0x16,0x00,0x43,0xf8,0x77,0x77,0x7c,0x16,
+0x00,0x11,0xf8,0x21,0x00,0x01,0x16,0x00,0x01,0x21,0x00,0x03,0x47,0x00,0xf4,0x3e,
+0x04,0xf5,0x00,0x8d,0x00,0x00,0x00,0x7f,0x10,0x0d,0xc0,0x00,0x00,0xff,0xff,0xe3,
 0xff,0xff,0xf3,0x0f,0xa6,0xbe,0xbe,0x55,0x7f,0x30,0xf6,0x07,0xff,0x70,0x04,0xf2,
-0x0f,0x95,0xae,0x37,0x70,0x4f,0x20,0xb8,0x71,0xf4,0x12,0x25,0xf1,0x0f,0x60,0x7e,
+0x0f,0x95,0xae,0x37,0x70,0x4f,0x20,0xff,0xff,0xe0,0x8f,0x25,0xf1,0x0f,0x60,0x7e,
 0x00,0xec,0x6f,0x00,0xf6,0x07,0xe0,0x05,0x67,0xf0,0x0f,0xa6,0xbe,0x00,0x00,0xad,
-0x00,0xff,0xff,0xe0,0x27,0x7f,0xa0,0x0b,0x40,0x00,0x00,0xff,0xe2,0x08,0x00,0xe1,
-0x7e,0xf3,0x01,0x2b,0x40,0x00,0x00,0xaf,0x20,0x0a,0xf1,0x00,0x06,0x68,0xf9,0x66,
-0xeb,0x66,0x21,0x67,0x6b,0xf2,0x05,0x05,0xc4,0x00,0xb9,0x30,0x00,0x7d,0xf8,0x00,
-0x06,0xcf,0xd3,0x09,0xe7,0x55,0x55,0x55,0x9b,0x10,0x0b,0xc9,0x4e,0x80,0xb9,0x4f,
-0x1c,0x94,0xf2,0x00,0x0b,0x94,0xb6,0x65,0x76,0x16,0xdc,0x9f,0x7e,0xc9,0xf8,0x43,
-0x09,0x4c,0x10,0x51,0xe0,0x26,0xf0,0x07,0xfc,0x2f,0x40,0x00,0x0d,0x99,0xc3,0x26,
-0xf9,0x88,0x50,0xdf,0xff,0xf6,0xdf,0xff,0xfa,0x0d,0x92,0x2d,0xcf,0x31,0x1a,0x00,
-0x30,0xe8,0x84,0xf6,0x1a,0x00,0x70,0x30,0x09,0xf5,0x00,0xdf,0xff,0xfd,0x61,0x09,
-0x50,0x45,0x55,0x54,0x44,0x40,0x68,0x4c,0x00,0x42,0x0a,0xd3,0xba,0x6f,0x0f,0x68,
-0xf0,0x01,0x5d,0xca,0xf6,0xfa,0xbf,0x63,0x3f,0x73,0x05,0x12,0x03,0x89,0x08,0x40,
-0xb9,0x00,0x9f,0xff,0x72,0x02,0xf2,0x1d,0x4a,0x84,0xf0,0x00,0x4e,0x73,0xf8,0xf4,
-0x1f,0xb8,0x06,0xe5,0x6f,0xbb,0x22,0x79,0x55,0xff,0xee,0xf7,0xef,0xef,0xa0,0x09,
-0xaa,0x3f,0x49,0xda,0xe2,0x01,0xe6,0x3a,0xfb,0xcf,0xfe,0xa5,0x2a,0x23,0xaa,0x98,
-0x43,0x79,0x40,0x0c,0xb0,0x00,0xc3,0xca,0x4f,0x2c,0x95,0xf2,0x00,0x3d,0xc7,0xf5,
-0xdb,0x7f,0x52,0x55,0x00,0x11,0x1f,0xba,0x16,0x01,0x95,0x84,0x00,0xdb,0x14,0x72,
-0x8f,0x11,0xfa,0x44,0x44,0x4b,0xf1,0x16,0x00,0x60,0xf9,0x22,0x22,0x2a,0xf1,0x1f,
-0x40,0x60,0x11,0x11,0x1c,0x02,0x70,0x1f,0x82,0x22,0x22,0x9f,0x11,0xfb,0xa0,0x01,
-0x02,0x21,0x00,0x02,0x62,0x60,0x04,0xc5,0x4d,0x52,0x4f,0x81,0x11,0x10,0x0d,0x48,
-0x3a,0x81,0x35,0x55,0xaf,0x65,0x55,0x41,0x00,0x8f,0x21,0x0b,0x67,0x08,0xf4,0x44,
-0x44,0xaf,0x00,0x0d,0x00,0x15,0xbf,0x0d,0x00,0x30,0xf5,0x55,0x55,0x0d,0x00,0xb4,
-0xcc,0xcc,0xce,0xf0,0x01,0x6b,0xf6,0x66,0x66,0xcf,0x74,0x4a,0x36,0x20,0x8f,0x00,
-0xfb,0x03,0xf0,0x07,0x08,0xf0,0x0f,0xb7,0x7b,0xf1,0x4c,0xef,0xc7,0xf8,0x00,0x7f,
-0x15,0xff,0xff,0x9f,0xa3,0x39,0xf1,0x01,0xef,0x11,0x1a,0x00,0xf5,0x11,0x3f,0xf7,
-0x0f,0x92,0x29,0xf1,0x09,0xff,0xf5,0xfa,0x33,0x9f,0x12,0xfc,0xf9,0x7f,0xff,0xff,
-0xf1,0x9d,0x8f,0x00,0xfa,0x33,0x9f,0x13,0x48,0xf0,0x0f,0x91,0x18,0xf1,0x41,0x00,
-0x40,0x0d,0x94,0x48,0xc1,0x6e,0x04,0x21,0x24,0x50,0x30,0x03,0x60,0xfd,0x50,0x00,
-0x55,0x5f,0xc3,0x4b,0x7a,0x02,0x00,0x28,0x53,0x55,0xbf,0x65,0x55,0x54,0x0c,0x20,
-0xf0,0x07,0x02,0x2b,0xfa,0x88,0x88,0x84,0x10,0x07,0xff,0xbb,0xbb,0xcf,0x30,0x1b,
-0xff,0xfc,0xcc,0xcd,0xf3,0x02,0xf8,0x8f,0xe4,0x4a,0x21,0x02,0x07,0x9d,0x0b,0x21,
-0x00,0x7f,0xf1,0x4a,0x41,0x07,0xfe,0xee,0xee,0xed,0x20,0x10,0xb7,0xc2,0x14,0xf3,
-0x24,0xee,0xef,0xfe,0xee,0xe2,0x04,0x66,0x68,0xf9,0x66,0x65,0x00,0x05,0xfe,0xee,
-0xee,0xfc,0x00,0x00,0x5f,0x98,0x88,0x8e,0xc0,0x00,0x05,0xf9,0x77,0x77,0xec,0x00,
-0x00,0x5f,0xbb,0xbb,0xbe,0xc0,0x00,0x05,0xfc,0xcc,0xcc,0xfc,0x00,0x04,0x8f,0x76,
-0x66,0x6d,0xd4,0x21,0x32,0x21,0x88,0x29,0xe5,0x01,0xee,0x82,0x00,0xbf,0xd7,0x1b,
-0x04,0x00,0x80,0x03,0xf5,0x40,0x63,0x03,0xff,0xf7,0xef,0xff,0xec,0x70,0x3f,0x5f,
-0x2c,0x58,0xa0,0x9c,0x03,0xe0,0xf2,0xa9,0x6f,0x1f,0x70,0x3f,0x6f,0x49,0xb6,0xe8,
-0xf6,0x13,0xfe,0xfa,0xfe,0xee,0xee,0xf6,0x3e,0x0f,0x7e,0x82,0x12,0xec,0x43,0xff,
-0xf5,0xfe,0xff,0xff,0xf2,0x3f,0x5f,0xca,0x5d,0x93,0xf5,0x03,0xf5,0xfd,0xae,0x8f,
-0x7f,0x80,0x3f,0xff,0x29,0xf2,0xdd,0xfe,0x21,0x50,0x0c,0xf5,0x00,0x0f,0x40,0x00,
-0x00,0x65,0x00,0x00,0xf4,0xf2,0x07,0x11,0x40,0xce,0x0c,0xf0,0x1a,0xf7,0x55,0x3b,
-0xee,0xee,0x10,0xcf,0xff,0xf8,0xdd,0x8c,0xf1,0x4f,0x6d,0xb0,0x0d,0xa0,0x7f,0x10,
-0x70,0xdb,0x00,0xda,0x07,0xf1,0x4f,0xff,0xff,0xcd,0xa0,0x7f,0x12,0x78,0xfc,0x76,
-0xda,0x07,0xf1,0x00,0x4f,0xd0,0x1a,0x00,0xfa,0x0a,0x08,0xff,0xb0,0xda,0x07,0xf1,
-0x01,0xfb,0x5f,0x8d,0xd7,0xbf,0x11,0xcf,0x30,0x97,0xdf,0xff,0xf1,0x1d,0x40,0x00,
-0x09,0x70,0x48,0xc0,0x26,0x20,0xff,0xff,0x04,0x35,0xf0,0x01,0x37,0xf9,0x63,0x55,
-0xfb,0x55,0x20,0x5f,0x20,0x13,0x3f,0xa3,0x30,0x09,0xe0,0x06,0x81,0x01,0xf1,0x00,
-0xed,0x55,0x7f,0x3f,0xa7,0xf1,0x6f,0xff,0xf7,0xfe,0xff,0xff,0x1a,0xfa,0x4f,0x0d,
-0x00,0x20,0x93,0xf7,0x1a,0x00,0xf3,0x0a,0xb9,0x3f,0x5c,0x6f,0x30,0x00,0x0b,0xff,
-0xf1,0xbf,0xe0,0x00,0x00,0xab,0x67,0x9e,0xde,0xfb,0x83,0x00,0x00,0x05,0x40,0x03,
-0x68,0x6b,0x10,0x40,0x01,0x44,0x44,0x00,0xa4,0x33,0x30,0xff,0xed,0xff,0x25,0x7a,
-0xf0,0x2e,0x61,0xd9,0xee,0x77,0xf4,0x05,0xf2,0x05,0x9f,0x6f,0x96,0x10,0x9f,0x76,
-0x5f,0xff,0xff,0xf0,0x1e,0xfe,0xff,0xfa,0x3f,0x93,0x08,0xfc,0x6e,0x5f,0xff,0xff,
-0xd0,0x7f,0xc6,0xe0,0xe9,0x2e,0x92,0x00,0x9c,0x6e,0x0e,0xfe,0xff,0xc0,0x08,0xff,
-0xe0,0xea,0x3f,0x93,0x00,0x8d,0x55,0x0e,0xed,0xfe,0xd4,0x02,0x30,0x00,0xeb,0xfe,
-0x5d,0x04,0x0a,0x0a,0xf0,0x06,0xae,0xff,0xff,0xf6,0x16,0xfa,0x64,0xe9,0x8f,0x64,
-0x10,0x1f,0x50,0x0e,0x88,0xf5,0x30,0x04,0xf3,0x00,0xef,0x42,0x74,0xf0,0x06,0x43,
-0x0e,0x98,0xf6,0x40,0x0c,0xff,0xf4,0xee,0xef,0xda,0x03,0xff,0x2f,0x4e,0x99,0xf6,
-0x53,0x6f,0xe0,0xf4,0x07,0x3f,0xf0,0x04,0xbe,0x0f,0x69,0x54,0x5a,0xd8,0x06,0xff,
-0xfa,0xbd,0x7c,0x7f,0x70,0x6f,0x66,0xd7,0xa3,0x76,0xf5,0xe4,0x73,0x25,0x08,0xfb,
-0x7e,0x2b,0x02,0x67,0x21,0x10,0x67,0xa5,0x07,0x09,0xd8,0x19,0x11,0x70,0x34,0x09,
-0xf2,0x17,0x73,0x00,0x36,0x11,0xf9,0x04,0x50,0x00,0x0c,0xf1,0x1f,0x90,0xcf,0x20,
+0x00,0xff,0xff,0xe0,0x27,0x7f,0xa0,0x0b,0x40,0x00,0x00,0xff,0xd2,0x9c,0x00,0xf0,
+0x05,0x09,0x60,0x00,0x2b,0x40,0x00,0x00,0xaf,0x20,0x0a,0xf1,0x00,0x06,0x68,0xf9,
+0x66,0xeb,0x66,0x21,0xff,0x01,0x00,0xf0,0x07,0xf6,0x00,0x05,0xc4,0x00,0xb9,0x30,
+0x00,0x7d,0xf8,0x00,0x06,0xcf,0xd3,0x09,0xe7,0x55,0x55,0x55,0x9b,0x10,0x0b,0x1a,
+0x00,0xf1,0x06,0x20,0x00,0xb9,0x4f,0x1c,0x94,0xf2,0x00,0x0b,0x94,0xf1,0xc9,0x4f,
+0x20,0x16,0xdc,0x9f,0x7e,0xc9,0xf8,0x43,0x34,0x00,0x10,0xf9,0x51,0x00,0xf0,0x0c,
+0x51,0x00,0x00,0xdf,0xff,0xfc,0x2f,0x40,0x00,0x0d,0x99,0xc3,0x26,0xf9,0x88,0x50,
+0xdf,0xff,0xf6,0xdf,0xff,0xfa,0x0d,0x92,0x2d,0xcf,0x31,0x1a,0x00,0x30,0xe8,0x84,
+0xf6,0x1a,0x00,0xf1,0x16,0x30,0x09,0xf5,0x00,0xdf,0xff,0xfd,0x00,0x0a,0x50,0x00,
+0x45,0x55,0x54,0x44,0x40,0x00,0x0b,0xff,0xfe,0xff,0xff,0x00,0x00,0xba,0x6f,0x0f,
+0x68,0xf0,0x01,0x5d,0xca,0xf6,0xfa,0xbf,0x63,0x3f,0x55,0x00,0x41,0x90,0x00,0x03,
+0x40,0xaa,0x00,0xf2,0x25,0xb9,0x00,0x9f,0xff,0x00,0x04,0xff,0xff,0x4a,0x84,0xf0,
+0x00,0x4e,0x73,0xf8,0xf4,0x1f,0xb8,0x06,0xe5,0x6f,0xbb,0x22,0x79,0x55,0xff,0xee,
+0xf7,0xef,0xef,0xa0,0x09,0xaa,0x3f,0x49,0xda,0xe2,0x01,0xe6,0x3a,0xfb,0xcf,0xfe,
+0xa5,0x2a,0x23,0xaa,0x98,0x43,0x79,0x40,0x0c,0xb0,0x00,0xc3,0xca,0x4f,0x2c,0x95,
+0xf2,0x00,0x3d,0xc7,0xf5,0xdb,0x7f,0x52,0x55,0x00,0x10,0x1f,0x06,0x00,0x20,0x11,
+0xfc,0x69,0x01,0xb2,0x1f,0x70,0x00,0x00,0x8f,0x11,0xfa,0x44,0x44,0x4b,0xf1,0x16,
+0x00,0xb0,0xf9,0x22,0x22,0x2a,0xf1,0x1f,0xa4,0x44,0x44,0xbf,0x11,0x10,0x00,0x80,
+0xf1,0x1f,0x82,0x22,0x22,0x9f,0x11,0xfb,0xa0,0x01,0x02,0x21,0x00,0x17,0xf8,0x95,
+0x01,0x71,0x11,0x11,0x4f,0x81,0x11,0x10,0x0d,0x56,0x00,0xf7,0x05,0x50,0x35,0x55,
+0xaf,0x65,0x55,0x41,0x00,0x8f,0xff,0xff,0xff,0xf0,0x00,0x08,0xf4,0x44,0x44,0xaf,
+0x00,0x0d,0x00,0x15,0xbf,0x0d,0x00,0x30,0xf5,0x55,0x55,0x0d,0x00,0xb2,0xcc,0xcc,
+0xce,0xf0,0x01,0x6b,0xf6,0x66,0x66,0xcf,0x74,0x97,0x00,0xf0,0x0f,0xa0,0x00,0x8f,
+0x00,0xff,0xff,0xff,0x10,0x08,0xf0,0x0f,0xb7,0x7b,0xf1,0x4c,0xef,0xc7,0xf8,0x00,
+0x7f,0x15,0xff,0xff,0x9f,0xa3,0x39,0xf1,0x01,0xef,0x11,0x1a,0x00,0xf5,0x11,0x3f,
+0xf7,0x0f,0x92,0x29,0xf1,0x09,0xff,0xf5,0xfa,0x33,0x9f,0x12,0xfc,0xf9,0x7f,0xff,
+0xff,0xf1,0x9d,0x8f,0x00,0xfa,0x33,0x9f,0x13,0x48,0xf0,0x0f,0x91,0x18,0xf1,0x41,
+0x00,0xf1,0x08,0x0d,0x94,0x48,0xc1,0x00,0x00,0x00,0x01,0x24,0x50,0x00,0x2f,0xff,
+0xff,0xff,0xfd,0x50,0x00,0x55,0x5f,0xc3,0x21,0x11,0x0d,0x00,0x91,0xff,0xb0,0x01,
+0x55,0xbf,0x65,0x55,0x54,0x01,0x75,0x00,0xf0,0x15,0xf7,0x02,0x2b,0xfa,0x88,0x88,
+0x84,0x10,0x07,0xff,0xbb,0xbb,0xcf,0x30,0x1b,0xff,0xfc,0xcc,0xcd,0xf3,0x02,0xf8,
+0x8f,0x44,0x44,0x8f,0x30,0x02,0x07,0xff,0xff,0xff,0xf3,0x00,0x00,0x7f,0x0d,0x00,
+0x60,0x00,0x07,0xfe,0xee,0xee,0xf3,0xf4,0x00,0xf2,0x29,0xb7,0x00,0x00,0x00,0xae,
+0xee,0xef,0xfe,0xee,0xe2,0x04,0x66,0x68,0xf9,0x66,0x65,0x00,0x05,0xfe,0xee,0xee,
+0xfc,0x00,0x00,0x5f,0x98,0x88,0x8e,0xc0,0x00,0x05,0xf9,0x77,0x77,0xec,0x00,0x00,
+0x5f,0xbb,0xbb,0xbe,0xc0,0x00,0x05,0xfc,0xcc,0xcc,0xfc,0x00,0x04,0x8f,0x76,0x66,
+0x6d,0xd4,0x21,0x6f,0x00,0xf1,0x04,0x00,0x29,0xe5,0x01,0xee,0x82,0x00,0xbf,0xd7,
+0x00,0x02,0x8e,0xf3,0x01,0x20,0x00,0x00,0x00,0x02,0x4a,0x01,0xf4,0x41,0x13,0x63,
+0x03,0xff,0xf7,0xef,0xff,0xec,0x70,0x3f,0x5f,0x2c,0x58,0xa0,0x9c,0x03,0xe0,0xf2,
+0xa9,0x6f,0x1f,0x70,0x3f,0x6f,0x49,0xb6,0xe8,0xf6,0x13,0xfe,0xfa,0xfe,0xee,0xee,
+0xf6,0x3e,0x0f,0x7e,0x82,0x12,0xec,0x43,0xff,0xf5,0xfe,0xff,0xff,0xf2,0x3f,0x5f,
+0xca,0x5d,0x93,0xf5,0x03,0xf5,0xfd,0xae,0x8f,0x7f,0x80,0x3f,0xff,0x29,0xf2,0xdd,
+0xfe,0x21,0x50,0x0c,0xf5,0x00,0x0f,0x40,0x00,0x00,0x65,0x00,0x00,0xf4,0xe2,0x02,
+0x11,0x3e,0x3f,0x02,0xf0,0x1b,0x07,0xf7,0x55,0x3b,0xee,0xee,0x10,0xcf,0xff,0xf8,
+0xdd,0x8c,0xf1,0x4f,0x6d,0xb0,0x0d,0xa0,0x7f,0x10,0x70,0xdb,0x00,0xda,0x07,0xf1,
+0x4f,0xff,0xff,0xcd,0xa0,0x7f,0x12,0x78,0xfc,0x76,0xda,0x07,0xf1,0x00,0x4f,0xd0,
+0x1a,0x00,0xf8,0x0b,0x08,0xff,0xb0,0xda,0x07,0xf1,0x01,0xfb,0x5f,0x8d,0xd7,0xbf,
+0x11,0xcf,0x30,0x97,0xdf,0xff,0xf1,0x1d,0x40,0x00,0x09,0x70,0x48,0x00,0x01,0x00,
+0xf0,0x08,0x08,0xff,0xff,0xbf,0xff,0xff,0xf6,0x37,0xf9,0x63,0x55,0xfb,0x55,0x20,
+0x5f,0x20,0x13,0x3f,0xa3,0x30,0x09,0xe0,0x06,0x81,0x01,0xf1,0x00,0xed,0x55,0x7f,
+0x3f,0xa7,0xf1,0x6f,0xff,0xf7,0xfe,0xff,0xff,0x1a,0xfa,0x4f,0x0d,0x00,0x20,0x93,
+0xf7,0x1a,0x00,0xf1,0x0a,0xb9,0x3f,0x5c,0x6f,0x30,0x00,0x0b,0xff,0xf1,0xbf,0xe0,
+0x00,0x00,0xab,0x67,0x9e,0xde,0xfb,0x83,0x00,0x00,0x05,0x40,0x03,0x68,0x53,0x00,
+0xf2,0x42,0x10,0x00,0x01,0x44,0x44,0x00,0x0e,0xa0,0x00,0x6f,0xff,0xed,0xff,0xff,
+0xff,0x40,0x3f,0x61,0xd9,0xee,0x77,0xf4,0x05,0xf2,0x05,0x9f,0x6f,0x96,0x10,0x9f,
+0x76,0x5f,0xff,0xff,0xf0,0x1e,0xfe,0xff,0xfa,0x3f,0x93,0x08,0xfc,0x6e,0x5f,0xff,
+0xff,0xd0,0x7f,0xc6,0xe0,0xe9,0x2e,0x92,0x00,0x9c,0x6e,0x0e,0xfe,0xff,0xc0,0x08,
+0xff,0xe0,0xea,0x3f,0x93,0x00,0x8d,0x55,0x0e,0xed,0xfe,0xd4,0x02,0x30,0x00,0xeb,
+0x66,0x66,0x20,0xaa,0x00,0xf3,0x40,0x03,0xff,0xff,0xae,0xff,0xff,0xf6,0x16,0xfa,
+0x64,0xe9,0x8f,0x64,0x10,0x1f,0x50,0x0e,0x88,0xf5,0x30,0x04,0xf3,0x00,0xef,0xff,
+0xeb,0x00,0x7f,0x43,0x0e,0x98,0xf6,0x40,0x0c,0xff,0xf4,0xee,0xef,0xda,0x03,0xff,
+0x2f,0x4e,0x99,0xf6,0x53,0x6f,0xe0,0xf4,0xef,0xff,0xff,0x90,0xbe,0x0f,0x69,0x54,
+0x5a,0xd8,0x06,0xff,0xfa,0xbd,0x7c,0x7f,0x70,0x6f,0x66,0xd7,0xa3,0x76,0xf5,0x00,
+0x10,0x01,0x00,0x08,0xfb,0x10,0x00,0x01,0x20,0x0e,0xff,0xa3,0x00,0x63,0x00,0x67,
+0x77,0x77,0x77,0x72,0x13,0x00,0x11,0x1f,0xe4,0x01,0xf0,0x1c,0x70,0x77,0x77,0x8f,
+0xc7,0x77,0x73,0x00,0x36,0x11,0xf9,0x04,0x50,0x00,0x0c,0xf1,0x1f,0x90,0xcf,0x20,
 0x05,0xf9,0x01,0xf9,0x03,0xfb,0x03,0xfd,0x10,0x1f,0x90,0x0a,0xf3,0x08,0x32,0x9b,
-0xf8,0x00,0x39,0x20,0x00,0x0e,0xfc,0x20,0xbb,0x54,0x10,0x6f,0x16,0x07,0x10,0xe9,
-0x09,0x1f,0xf2,0x0a,0xef,0xd5,0x27,0xff,0xc4,0x00,0x9f,0xfe,0xe3,0xee,0xff,0x80,
-0x5f,0x5f,0x55,0xda,0x7f,0x4f,0x40,0x24,0x95,0x45,0x46,0x94,0x10,0x27,0x3f,0x20,
-0x01,0x55,0x01,0x00,0x22,0x51,0x2f,0xb8,0x46,0xf0,0x3a,0x08,0xa0,0x3f,0x53,0xb4,
-0x00,0x2b,0xf6,0x47,0xf4,0x09,0xf9,0x00,0x94,0x0c,0xfc,0x10,0x07,0x60,0x00,0x37,
-0xc1,0x00,0xe8,0x00,0x04,0xff,0xfb,0x30,0x0e,0x80,0x00,0x04,0xae,0x00,0x95,0xe8,
-0xc8,0x03,0x5b,0xf5,0x3f,0x6e,0x89,0xe0,0x8f,0xff,0xfc,0xf3,0xe8,0x4f,0x40,0x1f,
-0xf4,0x8f,0x0e,0x80,0xc4,0x06,0xff,0xe3,0x50,0xe8,0x46,0x01,0xee,0xeb,0x40,0x0e,
-0x9d,0xc0,0x8e,0x9e,0x75,0x2a,0xf0,0x03,0x03,0x58,0xe0,0x00,0x4c,0xf6,0x00,0x00,
-0x8e,0x19,0xdf,0xd4,0x00,0x00,0x08,0xe0,0xba,0x50,0x40,0x0c,0xd0,0xd2,0x3d,0x40,
-0x00,0x01,0xff,0xfa,0x37,0xf8,0x66,0x64,0x03,0x8e,0x62,0x0c,0xf0,0x24,0x81,0x5a,
-0xf5,0x7f,0x59,0xe3,0xf2,0x3f,0xff,0xfc,0xc0,0x9e,0x26,0x00,0x1e,0xf4,0x08,0x89,
-0xe6,0xa0,0x05,0xff,0xe2,0xd9,0x9e,0x6f,0x10,0xde,0xeb,0x6f,0x59,0xe1,0xf6,0x6e,
-0x8e,0x09,0xe0,0x9e,0x0d,0x91,0x57,0xe0,0x77,0x09,0xe0,0x87,0x00,0x7e,0x00,0x07,
-0xde,0x72,0x7a,0x25,0x00,0xbe,0x55,0x59,0xa0,0x26,0xbd,0x00,0x5f,0x70,0x00,0x1f,
-0xff,0x81,0x6f,0x9e,0x0b,0xf0,0x27,0xe0,0xbf,0xa5,0x8f,0x90,0x26,0xbf,0x65,0x5d,
-0xcf,0xc0,0x05,0xff,0xff,0x65,0xcf,0xc0,0x00,0x02,0xff,0x4a,0xfb,0xdf,0x52,0x00,
-0x7f,0xfe,0x22,0x8f,0xff,0xf8,0x0e,0xde,0xc6,0xcf,0x72,0xaf,0x26,0xe8,0xe0,0x5c,
-0x7e,0x9f,0x90,0x16,0x8e,0x00,0x01,0xdf,0xa0,0x00,0x08,0xe0,0x59,0xfb,0x80,0x4b,
-0x8e,0x0a,0xc7,0x10,0x55,0x55,0xf0,0x07,0x6a,0xfd,0x3f,0xff,0xff,0xe0,0x0d,0xef,
-0x33,0xf7,0x44,0xbe,0x00,0x08,0xe0,0x2f,0x30,0x08,0xe0,0x18,0xcf,0x85,0x2f,0x45,
-0xf1,0x21,0xff,0xff,0x55,0x55,0x55,0x50,0x03,0xef,0x43,0x77,0x77,0x77,0x20,0x4f,
+0xf8,0x00,0x39,0x20,0x00,0x0e,0xfc,0xa1,0x00,0xf0,0x1f,0x2f,0x40,0x00,0x6f,0x00,
+0x01,0xff,0xff,0xe9,0xff,0xff,0xf2,0x04,0xef,0xd5,0x27,0xff,0xc4,0x00,0x9f,0xfe,
+0xe3,0xee,0xff,0x80,0x5f,0x5f,0x55,0xda,0x7f,0x4f,0x40,0x24,0x95,0x45,0x46,0x94,
+0x10,0x00,0xcf,0xff,0xff,0xff,0xe0,0x01,0x55,0x01,0x00,0x21,0x51,0x2f,0x68,0x00,
+0xf4,0xa0,0x30,0x08,0xa0,0x3f,0x53,0xb4,0x00,0x2b,0xf6,0x47,0xf4,0x09,0xf9,0x00,
+0x94,0x0c,0xfc,0x10,0x07,0x60,0x00,0x37,0xc1,0x00,0xe8,0x00,0x04,0xff,0xfb,0x30,
+0x0e,0x80,0x00,0x04,0xae,0x00,0x95,0xe8,0xc8,0x03,0x5b,0xf5,0x3f,0x6e,0x89,0xe0,
+0x8f,0xff,0xfc,0xf3,0xe8,0x4f,0x40,0x1f,0xf4,0x8f,0x0e,0x80,0xc4,0x06,0xff,0xe3,
+0x50,0xe8,0x46,0x01,0xee,0xeb,0x40,0x0e,0x9d,0xc0,0x8e,0x9e,0x00,0x00,0x0a,0xf4,
+0x03,0x58,0xe0,0x00,0x4c,0xf6,0x00,0x00,0x8e,0x19,0xdf,0xd4,0x00,0x00,0x08,0xe0,
+0xba,0x50,0x00,0x00,0x00,0x38,0xd2,0x3d,0x40,0x00,0x01,0xff,0xfa,0x37,0xf8,0x66,
+0x64,0x03,0x8e,0x00,0xdf,0xff,0xff,0x81,0x5a,0xf5,0x7f,0x59,0xe3,0xf2,0x3f,0xff,
+0xfc,0xc0,0x9e,0x26,0x00,0x1e,0xf4,0x08,0x89,0xe6,0xa0,0x05,0xff,0xe2,0xd9,0x9e,
+0x6f,0x10,0xde,0xeb,0x6f,0x59,0xe1,0xf6,0x6e,0x8e,0x09,0xe0,0x9e,0x0d,0x91,0x57,
+0xe0,0x77,0x09,0xe0,0x87,0x00,0x7e,0x00,0x07,0xde,0x00,0x00,0x07,0xe0,0x00,0xbe,
+0x70,0x38,0x02,0xf6,0x3d,0x26,0xbd,0x00,0x5f,0x70,0x00,0x1f,0xff,0x81,0x6f,0xff,
+0xfd,0x00,0x18,0xe0,0xbf,0xa5,0x8f,0x90,0x26,0xbf,0x65,0x5d,0xcf,0xc0,0x05,0xff,
+0xff,0x65,0xcf,0xc0,0x00,0x02,0xff,0x4a,0xfb,0xdf,0x52,0x00,0x7f,0xfe,0x22,0x8f,
+0xff,0xf8,0x0e,0xde,0xc6,0xcf,0x72,0xaf,0x26,0xe8,0xe0,0x5c,0x7e,0x9f,0x90,0x16,
+0x8e,0x00,0x01,0xdf,0xa0,0x00,0x08,0xe0,0x59,0xfe,0x60,0x00,0x00,0x8e,0x0a,0xc7,
+0x10,0x8e,0x02,0x01,0xeb,0x01,0xf1,0x3b,0x6a,0xfd,0x3f,0xff,0xff,0xe0,0x0d,0xef,
+0x33,0xf7,0x44,0xbe,0x00,0x08,0xe0,0x2f,0x30,0x08,0xe0,0x18,0xcf,0x85,0xff,0xff,
+0xfe,0x02,0xff,0xff,0x55,0x55,0x55,0x50,0x03,0xef,0x43,0x77,0x77,0x77,0x20,0x4f,
 0xfb,0x4e,0xef,0xfe,0xe4,0x0c,0xff,0xe4,0x22,0xdc,0x22,0x05,0xfa,0xe4,0x0f,0xff,
 0xff,0xf0,0x1a,0x8e,0x00,0x33,0xdc,0x33,0x00,0x08,0xe0,0x67,0x7e,0xd7,0x74,0x00,
-0x8e,0x0e,0x7b,0x05,0xf1,0x5b,0x49,0x50,0x13,0x57,0xba,0x08,0xff,0xe7,0xbf,0xfd,
+0x8e,0x0e,0x7b,0x05,0xf4,0x8c,0x49,0x50,0x13,0x57,0xba,0x08,0xff,0xe7,0xbf,0xfd,
 0xb9,0x91,0x13,0xe8,0x05,0xc2,0xd3,0x8f,0x32,0x4f,0xa4,0x3f,0x6d,0x8f,0x90,0x9f,
 0xff,0xf2,0x94,0xc7,0x75,0x01,0x6f,0xb1,0x8f,0xef,0xff,0xf1,0x0a,0xff,0x98,0xe3,
 0xf9,0x7f,0x12,0xff,0xcf,0xaf,0xef,0xff,0xf1,0xac,0xe8,0x3a,0xe4,0xf9,0x8f,0x47,
 0x4e,0x83,0xff,0xee,0xef,0xfb,0x00,0xe8,0x08,0xe0,0x04,0x9f,0x10,0x0e,0x80,0x8e,
 0x00,0x8f,0xb0,0x39,0xbd,0xd8,0xee,0xff,0xee,0x32,0xcd,0xf1,0x17,0x7f,0xc7,0x70,
 0x00,0x9e,0x02,0xaa,0xfd,0xaa,0x02,0x7c,0xf7,0xbb,0xbf,0xeb,0xb6,0x4f,0xff,0xf7,
-0x9c,0x0f,0xf0,0x0d,0xf2,0x0f,0xb9,0x9d,0xe0,0x06,0xff,0xe3,0xfe,0xee,0xfe,0x01,
-0xef,0xeb,0x3f,0x96,0x6b,0xe0,0x8e,0x9e,0x00,0xfa,0x77,0xce,0x02,0x59,0xe0,0x0f,
-0x4f,0x27,0xb5,0x9e,0x03,0xbf,0x36,0xe6,0x00,0x09,0xe2,0xea,0x20,0x06,0xf8,0x0f,
-0xf6,0x45,0x17,0x00,0x12,0x35,0x78,0x03,0xcf,0xf7,0xff,0xff,0xcc,0x91,0x3f,0xf6,
-0x05,0xd3,0xf0,0xb9,0x00,0x0e,0x50,0x4e,0x3e,0x4f,0x50,0x12,0xe7,0x19,0xdd,0xfe,
-0xdd,0x07,0xff,0xfa,0xbb,0xbf,0xcb,0xb5,0x05,0xf9,0x09,0xbb,0xbb,0xbb,0x00,0xbf,
-0xf5,0x58,0x88,0x8b,0xf0,0x3f,0xfc,0x84,0x77,0x77,0xbf,0x0a,0xae,0x61,0xcd,0xef,
-0xde,0xd0,0x52,0xe5,0x1a,0xba,0xe6,0x58,0x00,0x0e,0x58,0xdc,0xa5,0x9b,0xf3,0x00,
-0xe5,0x65,0x6e,0xed,0x68,0x30,0xa6,0x54,0x10,0x60,0xef,0x25,0x62,0x78,0xfd,0x77,
-0x77,0x01,0xff,0x0c,0x06,0xf1,0x0a,0x70,0x23,0x00,0x50,0x8f,0x10,0xb6,0x8f,0xd0,
-0x5f,0xd9,0x70,0x09,0xff,0xa1,0x00,0x3c,0xfa,0x00,0x6d,0x96,0x66,0x66,0x7a,0x30,
-0x00,0x1a,0x1a,0x70,0x1c,0x51,0x01,0x07,0x03,0x21,0x70,0x0e,0xa6,0x5c,0x06,0xf8,
-0x56,0x00,0x7a,0x43,0x12,0x4f,0x28,0x0a,0xf2,0x12,0xf8,0x69,0x66,0x78,0x6d,0xe0,
-0x4c,0x4a,0xf5,0x0b,0xf9,0x89,0x00,0x7f,0xe4,0x01,0x07,0xfe,0x20,0x03,0x80,0x08,
-0xf4,0xe5,0x80,0x01,0x33,0x33,0xbf,0x4d,0xc3,0x30,0x7f,0x62,0x1d,0xfc,0x0a,0x22,
-0x27,0xff,0xc2,0x22,0x20,0x00,0x06,0xfd,0x4f,0xa1,0x00,0x02,0x8d,0xfc,0x10,0x5f,
-0xfb,0x71,0x2e,0xb5,0x00,0x00,0x18,0xdc,0xc9,0x3e,0x24,0x8f,0x20,0x83,0x03,0xf1,
-0x2b,0x01,0xf9,0x4b,0x72,0x7d,0x6a,0xf0,0x09,0xcf,0xd6,0x12,0xaf,0xe7,0x00,0xcc,
-0x61,0xea,0x00,0x2a,0xc0,0x00,0xee,0xff,0xfe,0xee,0xe1,0x00,0x0f,0xa4,0xc3,0x33,
-0xaf,0x10,0x00,0xf9,0xbe,0xef,0xd9,0xf1,0x00,0x0f,0x98,0xc9,0xe4,0x8f,0x10,0x00,
-0xf9,0x6c,0xef,0x99,0xf1,0x00,0x0f,0xac,0x72,0x48,0xaf,0x35,0x67,0xf0,0x0a,0xfe,
-0xe1,0x00,0x01,0xf4,0x0b,0xa3,0xf4,0x6f,0x10,0x0b,0xa0,0xba,0x3f,0x46,0xf1,0x5d,
-0xed,0xcb,0xc8,0xf9,0x9f,0x14,0xaa,0xaa,0xaa,0x37,0x90,0x0b,0x08,0x86,0x66,0x66,
-0x66,0x30,0xf3,0xba,0xcf,0x05,0xa0,0x0d,0x5d,0x53,0x39,0xf6,0x33,0x00,0xc6,0xf2,
-0xef,0xe6,0x0b,0xf0,0x02,0x6f,0x5e,0x7e,0x4f,0x5f,0x35,0xdf,0xfd,0xe6,0xe4,0xf4,
-0xf3,0x4a,0x63,0x0e,0x6e,0x4f,0xcf,0x19,0x3b,0xe6,0xd3,0xec,0x12,0x31,0x80,0x25,
-0xf4,0x21,0x28,0xe2,0x20,0x1f,0xff,0x1a,0x53,0xf0,0x16,0x10,0x5c,0x0c,0x60,0x89,
-0x1e,0x30,0x4e,0xfd,0xfe,0xbe,0xfe,0xfe,0x51,0x78,0x88,0x74,0x88,0x88,0x72,0x0c,
-0xfe,0xfd,0x3f,0xee,0xfe,0x00,0xc7,0x07,0xd3,0xf1,0x08,0xe0,0x0c,0xff,0xfd,0x3f,
-0xd7,0x78,0xf9,0x0a,0x4f,0x30,0x9d,0x8d,0x00,0x05,0xf2,0xfc,0x4d,0xa8,0xd1,0x11,
-0xda,0x5f,0xba,0xf3,0x8e,0x7b,0x4d,0x11,0x53,0xf6,0x04,0xef,0x60,0x72,0x3e,0x20,
-0x0d,0xa0,0x18,0x25,0x11,0x06,0xf1,0x04,0xd2,0x54,0xf9,0x8f,0x3b,0xf3,0xec,0x10,
-0x2b,0x56,0xd6,0x9b,0x49,0xb0,0x7e,0x09,0xf2,0x07,0x10,0x00,0x55,0x59,0xf6,0x5a,
-0xf1,0x00,0x2f,0xfe,0xff,0xee,0xee,0x10,0x04,0xf8,0x5a,0xf6,0x55,0x53,0x00,0x6f,
-0x7d,0x07,0xf5,0x03,0x08,0xfd,0xf1,0x01,0xf8,0x02,0x9f,0xe5,0x6f,0x1b,0xef,0x40,
-0x0b,0x71,0x06,0xf1,0x47,0x40,0x62,0x3b,0x61,0xc1,0x10,0x9e,0x21,0x10,0x06,0xf0,
-0x05,0xd2,0x93,0xfb,0xcd,0x3d,0xe4,0xfb,0x21,0x07,0x58,0x85,0xfa,0x49,0x72,0x4c,
-0x0e,0x83,0x60,0x04,0x44,0x45,0xfa,0x44,0x44,0x22,0x43,0x2f,0x71,0x33,0x33,0x33,
-0xaf,0x43,0x10,0xaf,0xd4,0x1f,0x60,0x01,0x1b,0xe5,0x11,0x9f,0x21,0xb7,0x47,0x20,
-0x6c,0xf0,0x2f,0x08,0x26,0x1f,0xe9,0xaa,0x00,0xf0,0x04,0xb2,0x21,0x9e,0x32,0x21,
-0x08,0xff,0xff,0xcf,0xff,0xff,0x83,0xf8,0x9d,0x1a,0xd1,0xbc,0x10,0x02,0x03,0x2a,
-0xf3,0x13,0xf5,0x00,0x09,0xf8,0x88,0x88,0xaf,0x50,0x00,0x9f,0x77,0x77,0x79,0xf5,
-0x00,0x09,0xfd,0xdd,0xdd,0xef,0x50,0x00,0x9f,0xbb,0xbb,0xbc,0xf5,0x00,0x34,0x5f,
-0xa4,0x4d,0xe4,0x31,0x9d,0x0c,0x30,0x37,0xee,0x10,0x0b,0x6f,0x4c,0xd8,0x10,0x00,
-0xbd,0x0d,0x5a,0xf2,0x0a,0x71,0x10,0x8e,0x11,0x10,0x09,0xff,0xff,0x8e,0xff,0xff,
-0x54,0xf7,0x7f,0x28,0xe1,0xbd,0x00,0x0a,0x33,0x98,0xf6,0x36,0x73,0x00,0xc7,0x02,
-0x00,0x0a,0x29,0x70,0x88,0xbf,0x10,0x07,0xf8,0x77,0x78,0xfd,0x94,0x01,0xba,0x02,
-0x51,0x07,0xf6,0x55,0x55,0x54,0x0d,0x00,0x00,0x7c,0x13,0x53,0xf4,0x33,0x33,0x8f,
-0x20,0x0d,0x00,0x05,0x05,0x01,0x60,0x11,0x3f,0x51,0x11,0x05,0xff,0x81,0x22,0xf6,
-0x31,0x92,0xfb,0xae,0x19,0xf4,0xdb,0x00,0x09,0x56,0xe5,0x57,0x38,0xd4,0x00,0x7f,
-0xff,0xfe,0x7f,0xff,0xf3,0x07,0xf4,0x4a,0xe7,0xf3,0x6f,0x30,0x7f,0xcc,0xee,0x7e,
-0x03,0xf3,0x07,0xf8,0x8c,0xe7,0xe0,0x3f,0x30,0x7f,0x7b,0xd6,0x7e,0x03,0xf3,0x08,
-0xe2,0xaf,0x47,0xe9,0xef,0x20,0xef,0xff,0xed,0x7e,0x48,0x40,0x07,0x83,0x02,0x77,
-0xe0,0x05,0x01,0x10,0xb1,0x5a,0x01,0x11,0x07,0x05,0x01,0xe0,0x92,0xf9,0xbb,0x3d,
-0xc3,0xec,0x21,0x04,0x2d,0x82,0x24,0x47,0x64,0x01,0xf5,0x8b,0xf4,0x21,0xff,0xf2,
-0x07,0x8e,0xb8,0x4c,0xa0,0x5f,0x20,0xda,0xeb,0xd8,0xca,0x04,0xf2,0x0d,0xef,0xef,
-0x8c,0xa3,0x9f,0x20,0xdb,0xec,0xe8,0xca,0x6f,0xb0,0x06,0x7e,0xb7,0x5c,0xa0,0x05,
-0x63,0xff,0xff,0xfd,0xcd,0x66,0xcc,0x00,0x0d,0x70,0x06,0xff,0xfe,0x50,0xca,0x47,
-0x61,0x80,0x00,0xae,0x10,0x00,0x09,0x55,0x00,0xf0,0x1c,0xa5,0xf8,0xde,0x2c,0xd2,
-0xed,0x21,0x07,0x04,0x8b,0xfd,0x23,0x50,0x00,0x04,0x9f,0xe4,0xaf,0xb6,0x10,0x3e,
-0xfb,0x9f,0xff,0xd9,0xef,0x60,0x6b,0x99,0x94,0x99,0x9a,0x60,0x00,0xf9,0x6f,0x6f,
-0xa7,0xf4,0x00,0x0f,0xff,0xf6,0xcd,0x06,0xfb,0x03,0x4f,0xe1,0x04,0xf9,0x10,0x01,
-0x8f,0xef,0xb6,0xef,0xfd,0x71,0x1d,0x60,0x45,0xc8,0x03,0x9c,0xdf,0x67,0x70,0xb1,
-0x10,0x9f,0x31,0x10,0x07,0xff,0xd8,0x10,0xf3,0x05,0x82,0xf9,0xad,0x2c,0xd1,0x9c,
-0x00,0x04,0xdc,0x0b,0xd2,0xf6,0xc8,0x00,0xa9,0xc9,0xdc,0x8f,0x64,0x90,0xc9,0x09,
-0xf4,0x18,0x69,0xf6,0xf7,0x4e,0xa4,0xa2,0x07,0xae,0x4f,0x84,0xbb,0x9d,0x00,0x9d,
-0xe4,0xfc,0x59,0xff,0x60,0x0b,0xce,0x4f,0xc7,0x5f,0xb2,0x00,0x59,0xf9,0xf9,0x8e,
-0xfc,0xaa,0x1d,0xcb,0xa9,0x7e,0x94,0xde,0x40,0xcb,0x37,0xf0,0x18,0x21,0x00,0xf8,
-0x00,0x03,0xe6,0xf6,0xf1,0x0f,0x80,0x00,0x0f,0x8f,0xbc,0x00,0xfc,0x77,0x40,0xdb,
-0xfe,0x50,0x0f,0xff,0xf9,0x39,0xbf,0x98,0x00,0xf8,0x00,0x05,0xdf,0xfd,0xc0,0x0f,
-0x80,0x00,0x01,0xff,0x6c,0x26,0x00,0x6b,0x20,0xf1,0x03,0xb7,0x7b,0xf1,0x3f,0xcf,
-0x8b,0xf6,0x00,0x7f,0x17,0xd6,0xf1,0x2f,0x60,0x07,0xf1,0x13,0x5f,0x1d,0x0a,0x64,
-0x05,0xf1,0x1f,0xb7,0x7b,0xe1,0xbb,0x14,0x10,0xa1,0xa1,0x11,0x31,0x3d,0xaa,0xeb,
-0x08,0x59,0xf0,0x20,0xcf,0x26,0x6f,0xb6,0x61,0x0d,0xef,0xb1,0xcc,0xfe,0xcc,0x02,
+0x88,0x88,0x88,0x20,0x0e,0xf2,0x0f,0xb9,0x9d,0xe0,0x06,0xff,0xe3,0xfe,0xee,0xfe,
+0x01,0xef,0xeb,0x3f,0x96,0x6b,0xe0,0x8e,0x9e,0x00,0xfa,0x77,0xce,0x02,0x59,0xe0,
+0x0f,0xff,0xff,0xe0,0x00,0x9e,0x03,0xbf,0x36,0xe6,0x00,0x09,0xe2,0xea,0x20,0x06,
+0xd4,0xf7,0x00,0xf5,0x45,0x17,0x00,0x12,0x35,0x78,0x03,0xcf,0xf7,0xff,0xff,0xcc,
+0x91,0x3f,0xf6,0x05,0xd3,0xf0,0xb9,0x00,0x0e,0x50,0x4e,0x3e,0x4f,0x50,0x12,0xe7,
+0x19,0xdd,0xfe,0xdd,0x07,0xff,0xfa,0xbb,0xbf,0xcb,0xb5,0x05,0xf9,0x09,0xbb,0xbb,
+0xbb,0x00,0xbf,0xf5,0x58,0x88,0x8b,0xf0,0x3f,0xfc,0x84,0x77,0x77,0xbf,0x0a,0xae,
+0x61,0xcd,0xef,0xde,0xd0,0x52,0xe5,0x1a,0xba,0xe6,0x58,0x00,0x0e,0x58,0xdc,0xa5,
+0x9b,0xf3,0x00,0xe5,0x65,0x6e,0xed,0x68,0x30,0x54,0x01,0xc2,0x4d,0x60,0x00,0x00,
+0x07,0x77,0x78,0xfd,0x77,0x77,0x01,0xff,0x0c,0x06,0xf0,0x0c,0x70,0x23,0x00,0x50,
+0x8f,0x10,0xb6,0x8f,0xd0,0x5f,0xd9,0x70,0x09,0xff,0xa1,0x00,0x3c,0xfa,0x00,0x6d,
+0x96,0x66,0x66,0x7a,0x30,0x00,0x5f,0xf9,0x02,0x00,0x03,0x03,0x20,0x90,0x00,0x79,
+0x05,0x00,0x0d,0x07,0x01,0x07,0x03,0x30,0x70,0x0e,0xee,0x01,0x00,0x04,0xa3,0x01,
+0x00,0x6c,0x07,0x30,0x00,0x00,0x4f,0x4e,0x00,0xf1,0x15,0xfe,0x04,0xf8,0x69,0x66,
+0x78,0x6d,0xe0,0x4c,0x4a,0xf5,0x0b,0xf9,0x89,0x00,0x7f,0xe4,0x01,0x07,0xfe,0x20,
+0x03,0x80,0x08,0xf4,0xe5,0x80,0x01,0x33,0x33,0xbf,0x4d,0xc3,0x30,0x7f,0xff,0x71,
+0x06,0xfb,0x0b,0x22,0x27,0xff,0xc2,0x22,0x20,0x00,0x06,0xfd,0x4f,0xa1,0x00,0x02,
+0x8d,0xfc,0x10,0x5f,0xfb,0x71,0x2e,0xb5,0x00,0x00,0x18,0xdc,0x00,0x01,0x00,0x24,
+0x8f,0x20,0x83,0x03,0xf0,0x2d,0x01,0xf9,0x4b,0x72,0x7d,0x6a,0xf0,0x09,0xcf,0xd6,
+0x12,0xaf,0xe7,0x00,0xcc,0x61,0xea,0x00,0x2a,0xc0,0x00,0xee,0xff,0xfe,0xee,0xe1,
+0x00,0x0f,0xa4,0xc3,0x33,0xaf,0x10,0x00,0xf9,0xbe,0xef,0xd9,0xf1,0x00,0x0f,0x98,
+0xc9,0xe4,0x8f,0x10,0x00,0xf9,0x6c,0xef,0x99,0xf1,0x00,0x0f,0xac,0x72,0x48,0xaf,
+0x10,0x00,0x9b,0x00,0xf0,0x16,0xe1,0x00,0x01,0xf4,0x0b,0xa3,0xf4,0x6f,0x10,0x0b,
+0xa0,0xba,0x3f,0x46,0xf1,0x5d,0xed,0xcb,0xc8,0xf9,0x9f,0x14,0xaa,0xaa,0xbf,0xff,
+0xff,0xf1,0x0b,0x08,0x86,0x66,0x66,0x66,0x30,0xf3,0xba,0xcf,0x05,0xfa,0x18,0x0d,
+0x5d,0x53,0x39,0xf6,0x33,0x00,0xc6,0xf2,0xef,0xff,0xff,0xf3,0x07,0x6f,0x5e,0x7e,
+0x4f,0x5f,0x35,0xdf,0xfd,0xe6,0xe4,0xf4,0xf3,0x4a,0x63,0x0e,0x6e,0x4f,0x6f,0x30,
+0x00,0x00,0xe6,0xd3,0xec,0xd1,0xa8,0x00,0xf6,0x42,0x25,0xf4,0x21,0x28,0xe2,0x20,
+0x1f,0xff,0xff,0x9f,0xff,0xff,0x10,0x5c,0x0c,0x60,0x89,0x1e,0x30,0x4e,0xfd,0xfe,
+0xbe,0xfe,0xfe,0x51,0x78,0x88,0x74,0x88,0x88,0x72,0x0c,0xfe,0xfd,0x3f,0xee,0xfe,
+0x00,0xc7,0x07,0xd3,0xf1,0x08,0xe0,0x0c,0xff,0xfd,0x3f,0xff,0xfd,0x00,0x2f,0x4f,
+0x30,0x9d,0x8d,0x00,0x05,0xf2,0xfc,0x4d,0xa8,0xd1,0x11,0xda,0x5f,0xba,0xf3,0x8e,
+0x7b,0x4d,0x11,0x53,0xf6,0x04,0xef,0x60,0x00,0x00,0x01,0x5b,0x00,0x71,0x0d,0xa0,
+0x00,0x8e,0x00,0x00,0x06,0xf1,0x04,0xd2,0x54,0xf9,0x8f,0x3b,0xf3,0xec,0x10,0x2b,
+0x56,0xd6,0x9b,0x49,0xb0,0x7e,0x09,0xf2,0x07,0x10,0x00,0x55,0x59,0xf6,0x5a,0xf1,
+0x00,0x2f,0xfe,0xff,0xee,0xee,0x10,0x04,0xf8,0x5a,0xf6,0x55,0x53,0x00,0x6f,0x7d,
+0x07,0xf4,0x03,0x08,0xfd,0xf1,0x01,0xf8,0x02,0x9f,0xe5,0x6f,0x1b,0xef,0x40,0x0b,
+0x71,0x06,0xf1,0x47,0x40,0x55,0x00,0x71,0x0c,0xc1,0x10,0x9e,0x21,0x10,0x06,0xf0,
+0x05,0xe1,0x93,0xfb,0xcd,0x3d,0xe4,0xfb,0x21,0x07,0x58,0x85,0xfa,0x49,0x72,0x00,
+0xfa,0x07,0x81,0x60,0x04,0x44,0x45,0xfa,0x44,0x44,0x22,0x7a,0x01,0xa0,0xfa,0x02,
+0x33,0x33,0x33,0xaf,0x43,0x10,0xaf,0xff,0x3d,0x07,0xc0,0x01,0x1b,0xe5,0x11,0x9f,
+0x21,0x00,0x00,0x1d,0xd3,0x6c,0xf0,0x2f,0x08,0x26,0x1f,0xe9,0xaa,0x00,0xf2,0x2b,
+0xb2,0x21,0x9e,0x32,0x21,0x08,0xff,0xff,0xcf,0xff,0xff,0x83,0xf8,0x9d,0x1a,0xd1,
+0xbc,0x10,0x02,0x9f,0xee,0xee,0xef,0xf5,0x00,0x09,0xf8,0x88,0x88,0xaf,0x50,0x00,
+0x9f,0x77,0x77,0x79,0xf5,0x00,0x09,0xfd,0xdd,0xdd,0xef,0x50,0x00,0x9f,0xbb,0xbb,
+0xbc,0xf5,0x00,0x34,0x5f,0xa4,0x4d,0xe4,0x31,0x1f,0xc5,0x08,0xbb,0x37,0xee,0x10,
+0x0b,0xd0,0x00,0x07,0xd8,0x10,0x00,0xbd,0x08,0x02,0xf2,0x0b,0x2f,0x71,0x10,0x8e,
+0x11,0x10,0x09,0xff,0xff,0x8e,0xff,0xff,0x54,0xf7,0x7f,0x28,0xe1,0xbd,0x00,0x0a,
+0x33,0x98,0xf6,0x36,0x73,0x00,0xc7,0x02,0xc2,0x0f,0xb8,0x88,0x88,0x88,0xbf,0x10,
+0x07,0xf8,0x77,0x78,0xf7,0x97,0x0a,0x72,0x70,0x00,0x07,0xf6,0x55,0x55,0x54,0x0d,
+0x00,0x83,0xf2,0x00,0x07,0xf4,0x33,0x33,0x8f,0x20,0x0d,0x00,0x05,0x05,0x01,0xf6,
+0x3b,0x11,0x3f,0x51,0x11,0x05,0xff,0xff,0xdc,0xff,0xff,0x92,0xfb,0xae,0x19,0xf4,
+0xdb,0x00,0x09,0x56,0xe5,0x57,0x38,0xd4,0x00,0x7f,0xff,0xfe,0x7f,0xff,0xf3,0x07,
+0xf4,0x4a,0xe7,0xf3,0x6f,0x30,0x7f,0xcc,0xee,0x7e,0x03,0xf3,0x07,0xf8,0x8c,0xe7,
+0xe0,0x3f,0x30,0x7f,0x7b,0xd6,0x7e,0x03,0xf3,0x08,0xe2,0xaf,0x47,0xe9,0xef,0x20,
+0xef,0xff,0xed,0x7e,0x48,0x40,0x07,0x83,0x02,0x77,0xe0,0x05,0x01,0x10,0xb1,0x5a,
+0x01,0x11,0x07,0x05,0x01,0xf3,0x33,0x92,0xf9,0xbb,0x3d,0xc3,0xec,0x21,0x04,0x2d,
+0x82,0x24,0x47,0x64,0x01,0xff,0xff,0xfb,0xcf,0xff,0xf2,0x07,0x8e,0xb8,0x4c,0xa0,
+0x5f,0x20,0xda,0xeb,0xd8,0xca,0x04,0xf2,0x0d,0xef,0xef,0x8c,0xa3,0x9f,0x20,0xdb,
+0xec,0xe8,0xca,0x6f,0xb0,0x06,0x7e,0xb7,0x5c,0xa0,0x05,0x63,0xff,0xff,0xfd,0xcd,
+0x66,0xcc,0x00,0x0d,0x70,0x06,0xff,0xfe,0x50,0x55,0x00,0x71,0x1e,0x80,0x00,0xae,
+0x10,0x00,0x09,0x55,0x00,0xf0,0x1c,0xa5,0xf8,0xde,0x2c,0xd2,0xed,0x21,0x07,0x04,
+0x8b,0xfd,0x23,0x50,0x00,0x04,0x9f,0xe4,0xaf,0xb6,0x10,0x3e,0xfb,0x9f,0xff,0xd9,
+0xef,0x60,0x6b,0x99,0x94,0x99,0x9a,0x60,0x00,0xf9,0x6f,0x6f,0xa7,0xf4,0x00,0x0f,
+0xff,0xf6,0xcd,0x06,0xf9,0x03,0x4f,0xe1,0x04,0xf9,0x10,0x01,0x8f,0xef,0xb6,0xef,
+0xfd,0x71,0x1d,0x60,0x45,0xc8,0x03,0x9c,0x5a,0x01,0x00,0xb0,0x00,0x20,0x9f,0x31,
+0xb0,0x00,0xf3,0x08,0xaf,0xff,0xff,0x82,0xf9,0xad,0x2c,0xd1,0x9c,0x00,0x04,0xdc,
+0x0b,0xd2,0xf6,0xc8,0x00,0xa9,0xc9,0xdc,0x8f,0x64,0x90,0xc9,0x09,0xf4,0x17,0x69,
+0xf6,0xf7,0x4e,0xa4,0xa2,0x07,0xae,0x4f,0x84,0xbb,0x9d,0x00,0x9d,0xe4,0xfc,0x59,
+0xff,0x60,0x0b,0xce,0x4f,0xc7,0x5f,0xb2,0x00,0x59,0xf9,0xf9,0x8e,0xfc,0xaa,0x1d,
+0xcb,0xa9,0x7e,0x94,0xde,0x60,0x02,0xf0,0x1a,0x5f,0x21,0x00,0xf8,0x00,0x03,0xe6,
+0xf6,0xf1,0x0f,0x80,0x00,0x0f,0x8f,0xbc,0x00,0xfc,0x77,0x40,0xdb,0xfe,0x50,0x0f,
+0xff,0xf9,0x39,0xbf,0x98,0x00,0xf8,0x00,0x05,0xdf,0xfd,0xc0,0x0f,0x80,0x00,0x01,
+0xff,0x71,0xc1,0x02,0xf1,0x06,0x8f,0xff,0x7f,0xb7,0x7b,0xf1,0x3f,0xcf,0x8b,0xf6,
+0x00,0x7f,0x17,0xd6,0xf1,0x2f,0x60,0x07,0xf1,0x13,0x5f,0x1d,0x0a,0x54,0x05,0xf1,
+0x1f,0xb7,0x7b,0x77,0x0c,0x90,0x0a,0xa1,0x00,0x0e,0x80,0x00,0x3d,0xaa,0xeb,0xa4,
+0x07,0xfa,0x31,0xfb,0xcf,0x26,0x6f,0xb6,0x61,0x0d,0xef,0xb1,0xcc,0xfe,0xcc,0x02,
 0x9d,0xd8,0x8a,0xaf,0xda,0xa6,0x3c,0xff,0xb4,0x88,0x88,0x87,0x30,0x2f,0xf3,0x0f,
 0xff,0xff,0xd0,0x09,0xff,0xe2,0xf9,0x77,0xcd,0x03,0xfe,0xbc,0x3f,0x97,0x7c,0xd0,
-0x5c,0xba,0x00,0x37,0x12,0xcb,0x2a,0xa0,0x0f,0x50,0x3b,0xd0,0x00,0xaa,0x00,0xf4,
-0x0b,0xf8,0x89,0x80,0x41,0x34,0x57,0x9b,0xec,0xcc,0x70,0xe1,0xc9,0x61,0x00,0x13,
-0x3c,0xe4,0x05,0x60,0x00,0x00,0x4d,0xf6,0x59,0xfb,0x4f,0x4e,0xf0,0x1c,0xf6,0x20,
-0x00,0x00,0x13,0xaf,0x91,0x3f,0x70,0x00,0x3b,0xff,0xed,0xef,0xff,0x60,0x03,0xda,
-0x98,0xfa,0x32,0x9d,0x00,0x02,0xc6,0x1f,0x75,0xc3,0x00,0x04,0xee,0x21,0xf7,0x2d,
-0xf5,0x01,0xee,0x37,0x8f,0x70,0x1c,0xe2,0x01,0xb7,0x58,0x15,0x01,0x51,0x12,0x13,
-0xb1,0x5c,0x13,0x00,0xca,0x00,0xf0,0x00,0x8e,0x3e,0x57,0x7d,0xe7,0x70,0x7f,0xbb,
-0xf3,0x00,0xbd,0x00,0x08,0xff,0xf6,0xe2,0x67,0xf0,0x01,0x04,0xf8,0xe5,0x00,0xbd,
-0x00,0x05,0xff,0xbf,0xa0,0x0b,0xd0,0x00,0x7e,0xb8,0x99,0xf4,0x02,0x20,0x63,0x79,
-0x0d,0x00,0xf1,0x01,0x2f,0x7f,0x8e,0x00,0xbd,0x00,0x06,0xf1,0xf4,0xaf,0xff,0xff,
-0xf5,0x69,0x05,0x05,0x96,0x84,0x22,0x34,0x00,0x2a,0x72,0x10,0x7f,0x38,0x0e,0xf4,
-0x37,0xf4,0x73,0xaf,0x69,0xf2,0x00,0xbc,0x5f,0x47,0xf0,0x9e,0x00,0x6f,0xbd,0xa0,
-0x8f,0x0c,0xa0,0x06,0xef,0xe1,0x09,0xe1,0xff,0xf5,0x03,0xf6,0xf1,0xaf,0x55,0x9f,
-0x23,0xee,0xbf,0x7b,0xfb,0x0b,0xd0,0x5e,0xb8,0xa7,0xee,0xf5,0xf7,0x01,0x64,0x5d,
-0x4f,0x5d,0xfe,0x00,0x3f,0x8c,0xcd,0xf1,0x9f,0xc1,0x06,0xf5,0xe3,0xed,0xbf,0xbf,
-0xe3,0x59,0x25,0x0b,0x7c,0x60,0x2c,0x6a,0x67,0x02,0x1f,0x0d,0x64,0x4f,0x63,0x9f,
-0x43,0x4f,0x60,0x0d,0x00,0x26,0x53,0x8f,0x0d,0x00,0x60,0x05,0xcf,0x94,0x9f,0x52,
-0x00,0x72,0x32,0x00,0xc3,0x5a,0x60,0xaf,0xe8,0x26,0xfc,0x10,0x0a,0x53,0x05,0xf4,
-0x06,0xfd,0x00,0x28,0xb4,0x7f,0x34,0x73,0x30,0x2b,0xfa,0x5a,0xf2,0x6e,0xe6,0x00,
-0x94,0x09,0xfb,0x00,0x08,0x70,0xa9,0x00,0x20,0xb0,0x1f,0xf5,0x19,0xf0,0x20,0xf4,
-0x71,0xfb,0xde,0x9f,0x60,0x8b,0x6f,0x3f,0x4a,0xb1,0xf6,0x3f,0xbe,0x81,0xf4,0xab,
-0x1f,0x65,0xff,0xf1,0x1f,0x4a,0xb1,0xf6,0x02,0xe8,0xb1,0xfa,0xdd,0x8f,0x60,0xbd,
-0x5f,0x5f,0xff,0xff,0xf6,0x4f,0xeb,0xc6,0xf4,0xab,0x1f,0x60,0x62,0x4a,0x1a,0x00,
-0xf0,0x05,0x2f,0x89,0xe5,0xf8,0xcd,0x5f,0x65,0xd6,0xb7,0x6f,0xff,0xff,0xf6,0x69,
-0x23,0x01,0xf6,0x22,0x3e,0x50,0x47,0x0a,0x00,0x03,0x02,0x30,0xc0,0x00,0xdc,0xce,
-0x35,0xf0,0x32,0x10,0x6f,0xff,0xfb,0x00,0xac,0x7e,0x4f,0xf6,0x8f,0x80,0x6f,0xbe,
-0x9d,0xdf,0x9d,0xd1,0x05,0xcf,0xe1,0x21,0x6f,0xf3,0x00,0x06,0xfb,0xa0,0x8f,0xef,
-0xd3,0x05,0xfe,0xdf,0xbf,0x92,0x3e,0xf7,0x3c,0x86,0xd3,0x36,0xfa,0x26,0x01,0x85,
-0x6e,0x00,0x04,0xe8,0x00,0x3f,0x7a,0xd5,0xbc,0x72,0x00,0x06,0xd5,0xc5,0x33,0x9e,
-0xfa,0x30,0x46,0x12,0x8a,0x5b,0x04,0xa8,0x01,0x12,0x47,0xb0,0x00,0xf0,0x0d,0xc0,
-0x0e,0xff,0xff,0xa0,0x02,0xf5,0x70,0xea,0x66,0xea,0x00,0xac,0x5f,0x3e,0x70,0x0c,
-0xa0,0x6f,0xbd,0x90,0xe8,0x11,0xda,0x06,0xff,0xe0,0x0e,0xd9,0x1d,0xf0,0x00,0xf4,
-0xd2,0xea,0x44,0xda,0x04,0xfe,0xbf,0x7e,0x70,0x0c,0xa0,0x4d,0x97,0x97,0x19,0x25,
-0xf3,0x07,0x74,0x7b,0x4e,0xb6,0x6e,0xa0,0x2f,0x7e,0xa8,0xe7,0x00,0xca,0x05,0xf3,
-0xf4,0x9f,0xa6,0x6e,0xc3,0x5a,0x17,0x0e,0x36,0x07,0x07,0x56,0x0b,0x11,0xa0,0x83,
-0x68,0xf0,0x1a,0xe7,0x05,0x68,0xfa,0x66,0x10,0x8d,0x4b,0xcf,0xff,0xff,0xf3,0x3f,
-0xad,0x90,0x02,0xf6,0x00,0x06,0xff,0xe0,0x37,0x8f,0xb7,0x60,0x03,0xf7,0xb6,0xff,
-0xff,0xfd,0x03,0xee,0xaf,0x11,0x11,0x11,0x00,0x5e,0xc9,0xd6,0xd4,0x29,0xf2,0x0a,
-0x63,0x6a,0x2f,0x74,0x4f,0x90,0x3f,0x8b,0xf4,0xf4,0x00,0xe9,0x06,0xd5,0xd8,0x5f,
-0xff,0xff,0x90,0x47,0x25,0x02,0xf9,0x66,0xe8,0x64,0x91,0x00,0x37,0x4c,0x10,0x8f,
-0x6e,0x30,0xf0,0x07,0xf4,0x32,0x5e,0xc4,0xaf,0x00,0x9b,0x6d,0x06,0xf3,0x2b,0xc0,
-0x3f,0xad,0x56,0xfa,0x0e,0xf6,0x03,0xde,0xc0,0xaf,0x89,0x75,0xf0,0x00,0xe5,0xa1,
-0xf9,0xcc,0x8f,0x20,0xce,0xbf,0x1f,0x6a,0xb5,0xf2,0x3e,0xb7,0xb2,0x38,0x0e,0xf1,
-0x0d,0x74,0x68,0x0f,0x73,0x34,0x81,0x0f,0x79,0xe1,0xf5,0x00,0x09,0x42,0xd4,0xa9,
-0x2f,0xa5,0x45,0xe7,0x37,0x12,0x00,0x8f,0xff,0xfc,0x10,0x00,0x89,0xcf,0x7b,0xf0,
-0x37,0x1f,0x80,0x56,0x8f,0xa6,0x61,0x08,0xe5,0xad,0xff,0xff,0xff,0x24,0xfa,0xc9,
-0x03,0xf7,0x59,0x00,0x7f,0xfe,0x12,0xde,0x38,0xf6,0x00,0x3f,0x7a,0xcf,0xff,0xfe,
-0xe0,0x2d,0xe8,0xf6,0x98,0x35,0x28,0x05,0xfe,0xbe,0x5b,0xc4,0xf2,0x00,0x15,0x24,
-0x70,0xda,0x4f,0x21,0x02,0xf9,0xbd,0x1f,0x64,0xf2,0xd4,0x5e,0x6a,0x9b,0xf1,0x4f,
-0x7f,0x47,0xa4,0x77,0xf5,0x01,0xef,0xeb,0x5e,0x08,0x0d,0x17,0xf3,0x40,0x40,0x0a,
-0xa0,0xef,0xe2,0x04,0xd4,0x03,0xcb,0x3e,0x8f,0x50,0xa7,0xe8,0xff,0xfc,0xe7,0xf2,
-0x3f,0x8f,0x21,0xba,0x0e,0x9e,0x07,0xff,0x90,0x4c,0xc3,0xeb,0xb0,0x15,0xfa,0x1b,
-0xff,0x9e,0xbb,0x02,0xeb,0xe6,0x0b,0x90,0xe5,0xf2,0x5e,0xbb,0x89,0xed,0x8e,0x4d,
-0x61,0x56,0x84,0xaf,0xc9,0xe4,0xd7,0x4b,0xf8,0x84,0xf2,0x0e,0xdf,0x37,0x8d,0x56,
-0xdc,0x00,0xe6,0x30,0x53,0x20,0x1b,0x20,0x0e,0x40,0x00,0x00,0x43,0x15,0x07,0x10,
-0xaf,0x97,0x7a,0xf0,0x1a,0xf4,0x53,0x98,0x88,0x7a,0x20,0xc9,0xae,0x1e,0x7c,0xa9,
-0xd0,0x7f,0xef,0x57,0xe6,0xf5,0xf4,0x04,0x9f,0xb3,0x9d,0x6f,0x5f,0x40,0x07,0xf5,
-0xf1,0xe7,0xcb,0x8e,0x05,0xfe,0xdf,0x46,0x63,0x71,0x91,0x3c,0x96,0xa8,0x41,0x08,
-0xf0,0x07,0x85,0x7d,0x26,0x6f,0xc6,0x60,0x3f,0x8b,0xf2,0x00,0xf9,0x00,0x05,0xf6,
-0xc6,0x76,0x6f,0xb6,0x63,0x7b,0x36,0x0e,0x4d,0x1c,0x19,0x10,0xeb,0x4e,0xf0,0x06,
+0x5c,0xba,0x00,0xff,0xff,0xfd,0x00,0x2a,0xa0,0x0f,0x50,0x3b,0xd0,0x00,0xaa,0x00,
+0xf4,0x0b,0xf8,0x04,0x01,0xf6,0x3c,0x02,0x34,0x57,0x9b,0xec,0x00,0x07,0xff,0xff,
+0xfe,0xc9,0x61,0x00,0x13,0x3c,0xe4,0x05,0x60,0x00,0x00,0x4d,0xf6,0x59,0xfb,0x00,
+0x00,0x0b,0xff,0xff,0xf6,0x20,0x00,0x00,0x13,0xaf,0x91,0x3f,0x70,0x00,0x3b,0xff,
+0xed,0xef,0xff,0x60,0x03,0xda,0x98,0xfa,0x32,0x9d,0x00,0x02,0xc6,0x1f,0x75,0xc3,
+0x00,0x04,0xee,0x21,0xf7,0x2d,0xf5,0x01,0xee,0x37,0x8f,0x70,0x1c,0xe2,0x01,0x10,
+0xaf,0xc2,0xba,0x03,0x21,0x06,0xb1,0x07,0x00,0x11,0xeb,0xc0,0x0a,0xf0,0x14,0x8e,
+0x3e,0x57,0x7d,0xe7,0x70,0x7f,0xbb,0xf3,0x00,0xbd,0x00,0x08,0xff,0xf6,0x00,0x0b,
+0xd0,0x00,0x04,0xf8,0xe5,0x00,0xbd,0x00,0x05,0xff,0xbf,0xa0,0x0b,0xd0,0x00,0x7e,
+0xb8,0x99,0xf4,0x02,0x20,0x63,0x79,0x0d,0x00,0xf1,0x07,0x2f,0x7f,0x8e,0x00,0xbd,
+0x00,0x06,0xf1,0xf4,0xaf,0xff,0xff,0xf5,0x69,0x05,0x05,0x88,0x88,0x88,0x30,0x00,
+0x34,0x4e,0x00,0xf3,0x3f,0x0b,0xd0,0x7f,0xff,0xff,0x50,0x02,0xf4,0x73,0xaf,0x69,
+0xf2,0x00,0xbc,0x5f,0x47,0xf0,0x9e,0x00,0x6f,0xbd,0xa0,0x8f,0x0c,0xa0,0x06,0xef,
+0xe1,0x09,0xe1,0xff,0xf5,0x03,0xf6,0xf1,0xaf,0x55,0x9f,0x23,0xee,0xbf,0x7b,0xfb,
+0x0b,0xd0,0x5e,0xb8,0xa7,0xee,0xf5,0xf7,0x01,0x64,0x5d,0x4f,0x5d,0xfe,0x00,0x3f,
+0x8c,0xcd,0xf1,0x9f,0xc1,0x06,0xf5,0xe3,0xed,0xbf,0xbf,0xe3,0x59,0x25,0x0b,0x7c,
+0x60,0x2c,0x20,0x87,0x0d,0x02,0x1f,0x0d,0x64,0x4f,0x63,0x9f,0x43,0x4f,0x60,0x0d,
+0x00,0x26,0x53,0x8f,0x0d,0x00,0x50,0x05,0xcf,0x94,0x9f,0x52,0xd0,0x08,0xb0,0xfe,
+0x77,0x00,0x00,0x06,0xaf,0xe8,0x26,0xfc,0x10,0x0a,0x53,0x05,0xf4,0x06,0xfd,0x00,
+0x28,0xb4,0x7f,0x34,0x73,0x30,0x2b,0xfa,0x5a,0xf2,0x6e,0xe6,0x00,0x94,0x09,0xfb,
+0x00,0x08,0x70,0xa9,0x00,0xf0,0x26,0xb0,0x1f,0xff,0xff,0xf6,0x01,0xf4,0x71,0xfb,
+0xde,0x9f,0x60,0x8b,0x6f,0x3f,0x4a,0xb1,0xf6,0x3f,0xbe,0x81,0xf4,0xab,0x1f,0x65,
+0xff,0xf1,0x1f,0x4a,0xb1,0xf6,0x02,0xe8,0xb1,0xfa,0xdd,0x8f,0x60,0xbd,0x5f,0x5f,
+0xff,0xff,0xf6,0x4f,0xeb,0xc6,0xf4,0xab,0x1f,0x60,0x62,0x4a,0x1a,0x00,0xf0,0x05,
+0x2f,0x89,0xe5,0xf8,0xcd,0x5f,0x65,0xd6,0xb7,0x6f,0xff,0xff,0xf6,0x69,0x23,0x01,
+0xf6,0x22,0x3e,0x50,0x47,0x0a,0x00,0x03,0x02,0x10,0xc0,0x7b,0x0e,0xf4,0x38,0x02,
+0xf5,0x10,0x6f,0xff,0xfb,0x00,0xac,0x7e,0x4f,0xf6,0x8f,0x80,0x6f,0xbe,0x9d,0xdf,
+0x9d,0xd1,0x05,0xcf,0xe1,0x21,0x6f,0xf3,0x00,0x06,0xfb,0xa0,0x8f,0xef,0xd3,0x05,
+0xfe,0xdf,0xbf,0x92,0x3e,0xf7,0x3c,0x86,0xd3,0x36,0xfa,0x26,0x01,0x85,0x6e,0x00,
+0x04,0xe8,0x00,0x3f,0x7a,0xd5,0xbc,0x72,0x00,0x06,0xd5,0xc5,0x33,0x9e,0xfa,0x30,
+0x46,0x12,0x00,0x00,0x06,0xd3,0xa8,0x01,0x12,0x47,0xb0,0x00,0xf0,0x0c,0xc0,0x0e,
+0xff,0xff,0xa0,0x02,0xf5,0x70,0xea,0x66,0xea,0x00,0xac,0x5f,0x3e,0x70,0x0c,0xa0,
+0x6f,0xbd,0x90,0xe8,0x11,0xda,0x06,0xff,0xe0,0x1a,0x00,0xf3,0x1b,0x04,0xf4,0xd2,
+0xea,0x44,0xda,0x04,0xfe,0xbf,0x7e,0x70,0x0c,0xa0,0x4d,0x97,0x97,0xef,0xff,0xfa,
+0x00,0x74,0x7b,0x4e,0xb6,0x6e,0xa0,0x2f,0x7e,0xa8,0xe7,0x00,0xca,0x05,0xf3,0xf4,
+0x9f,0xa6,0x6e,0xc3,0x5a,0x17,0x0e,0x36,0x07,0x07,0x56,0x0b,0xf0,0x3e,0xa0,0x00,
+0x2f,0x60,0x00,0x00,0xe7,0x05,0x68,0xfa,0x66,0x10,0x8d,0x4b,0xcf,0xff,0xff,0xf3,
+0x3f,0xad,0x90,0x02,0xf6,0x00,0x06,0xff,0xe0,0x37,0x8f,0xb7,0x60,0x03,0xf7,0xb6,
+0xff,0xff,0xfd,0x03,0xee,0xaf,0x11,0x11,0x11,0x00,0x5e,0xc9,0xd6,0xff,0xff,0xf9,
+0x01,0x63,0x6a,0x2f,0x74,0x4f,0x90,0x3f,0x8b,0xf4,0xf4,0x00,0xe9,0x06,0xd5,0xd8,
+0x5f,0xff,0xff,0x90,0x47,0x25,0x02,0xf9,0x66,0xe8,0x00,0x30,0x00,0x33,0x00,0x01,
+0x00,0xf6,0x91,0x0b,0xa0,0x8f,0xff,0xff,0xf0,0x01,0xf4,0x32,0x5e,0xc4,0xaf,0x00,
+0x9b,0x6d,0x06,0xf3,0x2b,0xc0,0x3f,0xad,0x56,0xfa,0x0e,0xf6,0x03,0xde,0xc0,0xaf,
+0xff,0xff,0xf2,0x01,0xe5,0xa1,0xf9,0xcc,0x8f,0x20,0xce,0xbf,0x1f,0x6a,0xb5,0xf2,
+0x3e,0xb7,0xb2,0xff,0xff,0xff,0x20,0x74,0x68,0x0f,0x73,0x34,0x81,0x0f,0x79,0xe1,
+0xf5,0x00,0x09,0x42,0xd4,0xa9,0x2f,0xa5,0x45,0xe7,0x37,0x12,0x00,0x8f,0xff,0xfc,
+0x10,0x00,0x89,0x00,0x04,0xd1,0x00,0x00,0x1f,0x80,0x56,0x8f,0xa6,0x61,0x08,0xe5,
+0xad,0xff,0xff,0xff,0x24,0xfa,0xc9,0x03,0xf7,0x59,0x00,0x7f,0xfe,0x12,0xde,0x38,
+0xf6,0x00,0x3f,0x7a,0xcf,0xff,0xfe,0xe0,0x2d,0xe8,0xf6,0x98,0x35,0x28,0x05,0xfe,
+0xbe,0x5b,0xc4,0xf2,0x00,0x15,0x24,0x70,0xda,0x4f,0x21,0x02,0xf9,0xbd,0x1f,0x64,
+0xf2,0xd4,0x5e,0x6a,0x9b,0xf1,0x4f,0x7f,0x47,0xa4,0x77,0xf5,0x01,0xef,0xd0,0x00,
+0x00,0x02,0x00,0x01,0x00,0xf1,0x41,0x0f,0x40,0x0a,0xa0,0xef,0xe2,0x04,0xd4,0x03,
+0xcb,0x3e,0x8f,0x50,0xa7,0xe8,0xff,0xfc,0xe7,0xf2,0x3f,0x8f,0x21,0xba,0x0e,0x9e,
+0x07,0xff,0x90,0x4c,0xc3,0xeb,0xb0,0x15,0xfa,0x1b,0xff,0x9e,0xbb,0x02,0xeb,0xe6,
+0x0b,0x90,0xe5,0xf2,0x5e,0xbb,0x89,0xed,0x8e,0x4d,0x61,0x56,0x84,0xaf,0xc9,0xe4,
+0xd7,0x4b,0xf8,0x84,0xf2,0x0e,0xdf,0x37,0x8d,0x56,0xdc,0x00,0xe6,0x30,0x53,0x20,
+0x1b,0x20,0x0e,0x40,0x00,0x00,0x43,0x55,0x00,0xf7,0x41,0x0d,0xa0,0xaf,0xff,0xff,
+0xf5,0x04,0xf4,0x53,0x98,0x88,0x7a,0x20,0xc9,0xae,0x1e,0x7c,0xa9,0xd0,0x7f,0xef,
+0x57,0xe6,0xf5,0xf4,0x04,0x9f,0xb3,0x9d,0x6f,0x5f,0x40,0x07,0xf5,0xf1,0xe7,0xcb,
+0x8e,0x05,0xfe,0xdf,0x46,0x63,0x71,0x91,0x3c,0x96,0xa8,0xff,0xff,0xff,0x01,0x85,
+0x7d,0x26,0x6f,0xc6,0x60,0x3f,0x8b,0xf2,0x00,0xf9,0x00,0x05,0xf6,0xc6,0x76,0x6f,
+0xb6,0x63,0x7b,0x36,0x0e,0xff,0xff,0xff,0x80,0x10,0x00,0x01,0x00,0xfa,0x3e,0x0a,
 0x60,0x04,0xe5,0x22,0x00,0x01,0xf3,0x00,0x9f,0xff,0xf6,0x00,0x8a,0x8a,0x0e,0xb2,
-0x6f,0x20,0x3f,0x9f,0x33,0x3b,0x3e,0x90,0xef,0xa0,0x46,0x66,0xdc,0x31,0x03,0xe8,
-0x9e,0x91,0x9b,0xfb,0x16,0xec,0xbe,0x5b,0x1e,0xc6,0xd1,0x3c,0x96,0x72,0xe6,0xef,
-0xf7,0x01,0x86,0x89,0x04,0xaf,0xee,0x20,0x3d,0xa8,0xe9,0xfb,0xf8,0xce,0x36,0xb8,
-0x61,0x88,0x5f,0x71,0xd7,0x34,0x00,0x00,0x5f,0xd3,0xc6,0x06,0x10,0xff,0xb6,0x14,
-0xf0,0x18,0xd0,0x0f,0x65,0xe0,0x08,0xc4,0xea,0x00,0xfe,0xdd,0xf3,0x7f,0x5f,0x40,
-0x0f,0xb8,0x8f,0x30,0xdf,0xc0,0x00,0xfa,0x9f,0x62,0x6e,0xfe,0x71,0x0e,0xff,0xff,
-0xbe,0x72,0x8e,0x30,0x00,0x4a,0xe4,0x49,0x10,0x5c,0x10,0xf5,0x0f,0xfa,0x67,0x10,
-0x00,0x5a,0xcf,0xfd,0xde,0xff,0x70,0x05,0x8b,0x64,0xf9,0x37,0x46,0x00,0x6d,0xd5,
-0x2f,0x84,0xcf,0x80,0x06,0x60,0x7f,0xd3,0x00,0x45,0x00,0x41,0x4e,0x00,0x8c,0x5c,
-0xf0,0x01,0x01,0xf6,0x10,0xcc,0xfd,0xcc,0x10,0x9d,0x5f,0x4f,0x96,0x69,0xf2,0x5f,
-0xbe,0xc1,0xc2,0x01,0x80,0xdf,0xf2,0x1f,0x84,0x48,0xf2,0x03,0xfc,0x0d,0x00,0xf7,
-0x18,0x23,0xef,0xbf,0x22,0x29,0xe1,0x80,0x3f,0xc9,0xeb,0xff,0xcf,0xcf,0x30,0x74,
-0x6a,0x1b,0xc9,0xff,0x20,0x1f,0x9a,0xf7,0xf5,0x9e,0xfa,0x04,0xe6,0xb1,0xf7,0x5c,
-0xd5,0xf7,0x48,0x12,0x01,0x0b,0xf7,0x03,0x81,0x22,0x10,0x10,0x5b,0x00,0x00,0x02,
-0x2c,0xf0,0x15,0x01,0xf5,0x25,0xee,0xff,0xee,0x20,0x7d,0x5f,0x8f,0x44,0x45,0xf2,
-0x2e,0xac,0xa6,0xf3,0x33,0x4f,0x23,0xff,0xf1,0x6f,0xff,0xff,0xf2,0x02,0xeb,0xa6,
-0xe1,0x11,0x11,0x01,0xcf,0xaf,0x8f,0x16,0x71,0xf4,0x10,0xa8,0xcb,0xf9,0xc3,0xd8,
-0x80,0x86,0x8b,0xbf,0xff,0xef,0xe8,0x0f,0x9b,0xfe,0xcc,0xd8,0xea,0x82,0xf6,0xb8,
-0xf8,0x9c,0x3d,0x88,0x4d,0x24,0x1b,0x49,0x61,0x6d,0xcc,0x06,0xf5,0x44,0x63,0x00,
-0x12,0x46,0x94,0x00,0x0e,0x60,0xef,0xff,0xdd,0x70,0x04,0xf6,0x45,0xc4,0xc0,0xda,
-0x00,0xba,0xaa,0x6f,0x5f,0x5f,0x40,0x5f,0x6f,0x24,0xd5,0xda,0xf4,0x06,0xff,0x90,
-0x9f,0xff,0xff,0xf0,0x04,0xe7,0x76,0x8f,0xa7,0x77,0x23,0xec,0xce,0x8b,0xf9,0x99,
-0x92,0x4b,0x85,0x90,0x9f,0xee,0xe7,0x02,0x87,0x99,0x0d,0xfb,0x8f,0x20,0x5c,0xb8,
-0xd5,0xf8,0xff,0x90,0x08,0xa9,0x6a,0xfe,0xaf,0xff,0xa2,0x44,0x10,0x08,0x5c,0x40,
-0x7b,0xfc,0x11,0x01,0x20,0x31,0xf0,0x1b,0x01,0xf6,0x1c,0xdd,0xfe,0xdd,0x40,0x9c,
-0x7e,0x66,0x6f,0xa6,0x61,0x5f,0xcf,0x89,0xef,0xff,0xee,0x16,0xdf,0xe1,0xab,0x8f,
-0x8c,0xf1,0x03,0xf9,0xba,0x9c,0xea,0xbf,0x12,0xee,0x9f,0xba,0xaf,0xb8,0xf1,0x5f,
-0xeb,0xfc,0x8b,0x0a,0xf4,0x0a,0x62,0x48,0x02,0xff,0xfa,0x00,0x2f,0x8a,0xe3,0xeb,
-0xf8,0xe9,0x05,0xe6,0xbb,0xec,0x1f,0x74,0xf4,0x58,0x35,0x02,0x00,0xf7,0x01,0x08,
-0x01,0x90,0x0d,0x30,0x00,0x6e,0x10,0x00,0x04,0xe2,0x2f,0xc8,0x05,0xf5,0x32,0xb6,
-0xca,0xf7,0x55,0x59,0xf1,0x4f,0x8f,0x36,0xf9,0x77,0x9b,0x06,0xdf,0x90,0x4f,0xac,
-0xfd,0xb0,0x06,0xdc,0x4b,0xc2,0x7f,0x53,0x03,0xfa,0xdb,0xfc,0x8f,0xff,0xd0,0x5d,
-0xa8,0xbf,0xc8,0xb0,0x6d,0x01,0x58,0x76,0x8c,0x8f,0xff,0xd0,0x4a,0xe7,0xb6,0xc8,
-0xc1,0x7d,0x08,0x8d,0x47,0x6c,0x8f,0xde,0xd0,0x43,0x10,0x06,0xc8,0xd5,0x9d,0x00,
-0xa9,0x2c,0xf0,0x42,0x5d,0x3f,0x1c,0x70,0x08,0xb1,0x0b,0x85,0xf0,0xf5,0x00,0xd5,
-0xf8,0xf5,0x9f,0xaf,0xa0,0x6f,0xad,0x7d,0xdf,0x8d,0xcf,0x28,0xdf,0x50,0xc8,0xb0,
-0xb4,0x60,0x07,0xdc,0x3f,0x43,0x2e,0x60,0x02,0xf8,0xfd,0xf4,0xc8,0xe9,0x40,0x8f,
-0xee,0xaf,0x4d,0x6e,0xff,0x02,0x54,0x91,0xe4,0xf5,0xe6,0x00,0x5c,0xeb,0x4e,0x7f,
-0xdf,0x60,0x08,0xad,0x96,0xec,0xdb,0xfc,0x92,0x85,0x71,0x0e,0xa6,0x06,0xac,0x10,
-0x00,0x66,0x00,0x00,0xc4,0xe7,0x2e,0xf0,0x12,0x2c,0xdf,0xdc,0xc1,0x06,0xe3,0xa4,
-0xf6,0xe7,0x8f,0x12,0xe8,0xba,0x3f,0x8d,0xdb,0xf1,0x5f,0xfe,0x13,0xf5,0xbe,0x4f,
-0x10,0x2e,0x6a,0x3f,0x7a,0x87,0xf1,0x2d,0xed,0xf5,0xf1,0x2c,0xf5,0x11,0xfa,0x5c,
-0x44,0x4b,0xa4,0x40,0x04,0x35,0x82,0x6b,0x8f,0x6a,0x00,0xf9,0xaf,0x7c,0xf4,0x84,
-0xf4,0x2f,0x6b,0x7e,0x7f,0x73,0xed,0x94,0xa2,0x40,0x21,0xbf,0xfd,0x20,0x20,0x1b,
-0x01,0xdd,0x10,0x11,0xf4,0x81,0x72,0xf0,0x06,0x8c,0x6d,0x8e,0xee,0xee,0xe1,0x3f,
-0xad,0x8b,0xbb,0xbb,0xbb,0x57,0xff,0xd0,0xf6,0xd7,0xd7,0xe7,0x02,0xf8,0xb4,0x4b,
-0xf0,0x18,0x72,0xde,0xaf,0x6a,0xaa,0xaa,0xa0,0x4e,0xb8,0xea,0xf9,0x99,0xcf,0x01,
-0x85,0x7a,0x8e,0x77,0x7b,0xf0,0x3f,0x8a,0xf9,0xfc,0xcc,0xdf,0x06,0xe5,0xb7,0x6b,
-0xf3,0x7e,0x92,0x58,0x24,0x0d,0x82,0x00,0x4a,0xc2,0x05,0x02,0xd5,0x67,0x00,0xf5,
-0x5c,0xf0,0x0d,0x03,0xf2,0x0c,0xee,0xff,0xed,0x00,0x9b,0x41,0xea,0x55,0x5a,0xe0,
-0x1f,0x4d,0x9e,0xc9,0x99,0xce,0x0a,0xff,0xf1,0xee,0xdd,0xdd,0xc0,0x5a,0xf8,0x8d,
-0x5c,0x30,0x00,0x8e,0x21,0xd5,0x09,0xf4,0x11,0x6f,0xfe,0x6f,0xf6,0xe8,0x7f,0x14,
-0x72,0x46,0xfe,0xff,0xff,0xf1,0x16,0xdf,0xde,0xc8,0xf9,0x9f,0x1a,0xfa,0x3e,0x9c,
-0x6e,0x88,0xf1,0x32,0x00,0xa2,0xc6,0xe7,0xcd,0x28,0x26,0x02,0xb5,0x16,0x63,0x5f,
-0x17,0xf0,0x9d,0x0a,0xe0,0x0d,0x00,0xf0,0x06,0x57,0x77,0x8f,0xa7,0x77,0x71,0x0a,
-0xbb,0xbd,0xfc,0xbb,0xbb,0x20,0x07,0xcc,0xdf,0xcc,0xcc,0x00,0x00,0x9e,0x89,0x6c,
-0x70,0x00,0x09,0xf9,0x99,0x99,0xcf,0x00,0x7e,0x0a,0x21,0xbe,0xf0,0x98,0x0a,0x92,
-0xcf,0x00,0x02,0xae,0x77,0x77,0x7c,0xf2,0x11,0xd2,0x55,0x06,0x2b,0x62,0xb2,0x07,
-0xe2,0x00,0x03,0x5a,0xf8,0x56,0xfe,0x65,0x00,0x8f,0x22,0x1e,0x52,0x55,0x56,0xfa,
-0x55,0x52,0x25,0x10,0x20,0x70,0x05,0x0d,0x00,0x30,0x55,0x41,0xee,0x82,0x0c,0xa2,
-0xea,0x04,0x66,0x69,0xf8,0x66,0x66,0x20,0xbf,0xff,0x32,0x20,0xf4,0x03,0x8f,0xae,
-0xd3,0x00,0x01,0x6a,0xef,0xa0,0x3e,0xfc,0x95,0x0e,0xe9,0x30,0x00,0x18,0xdf,0x60,
-0x13,0x08,0xc0,0xb0,0x00,0xac,0x00,0x00,0x5b,0xdf,0xcb,0xbf,0xeb,0xa0,0x03,0x7d,
-0x32,0x22,0x86,0x00,0xd2,0x13,0xf1,0x28,0x09,0x99,0x9b,0xfb,0x99,0x99,0x40,0x89,
+0x6f,0x20,0x3f,0x9f,0x33,0xff,0xff,0xe0,0x04,0xef,0xa0,0x46,0x66,0xdc,0x31,0x03,
+0xe8,0x9e,0xff,0xff,0xff,0x52,0xec,0xbe,0x5b,0x1e,0xc6,0xd1,0x3c,0x96,0x72,0xe6,
+0xef,0xf7,0x01,0x86,0x89,0x04,0xaf,0xee,0x20,0x3d,0xa8,0xe9,0xfb,0xf8,0xce,0x36,
+0xb8,0x61,0x88,0x5f,0x71,0xd7,0x34,0x00,0x00,0x5f,0xd3,0x00,0x01,0x00,0xf4,0x3e,
+0xff,0xff,0xf8,0xff,0xff,0xd0,0x0f,0x65,0xe0,0x08,0xc4,0xea,0x00,0xfe,0xdd,0xf3,
+0x7f,0x5f,0x40,0x0f,0xb8,0x8f,0x30,0xdf,0xc0,0x00,0xfa,0x9f,0x62,0x6e,0xfe,0x71,
+0x0e,0xff,0xff,0xbe,0x72,0x8e,0x30,0x00,0x4a,0xe4,0x49,0x10,0x00,0x00,0xdf,0xff,
+0xfa,0x67,0x10,0x00,0x5a,0xcf,0xfd,0xde,0xff,0x70,0x05,0x8b,0x64,0xf9,0x37,0x46,
+0x00,0x6d,0xd5,0x2f,0x84,0xcf,0x80,0x06,0x60,0x7f,0xd3,0x00,0x45,0x55,0x00,0xf0,
+0x07,0x0b,0xa0,0x00,0x0f,0xa0,0x00,0x01,0xf6,0x10,0xcc,0xfd,0xcc,0x10,0x9d,0x5f,
+0x4f,0x96,0x69,0xf2,0x5f,0xbe,0xc1,0xc2,0x01,0x80,0xdf,0xf2,0x1f,0x84,0x48,0xf2,
+0x03,0xfc,0x0d,0x00,0xf4,0x18,0x23,0xef,0xbf,0x22,0x29,0xe1,0x80,0x3f,0xc9,0xeb,
+0xff,0xcf,0xcf,0x30,0x74,0x6a,0x1b,0xc9,0xff,0x20,0x1f,0x9a,0xf7,0xf5,0x9e,0xfa,
+0x04,0xe6,0xb1,0xf7,0x5c,0xd5,0xf7,0x48,0x12,0x01,0x0b,0xf7,0x03,0x55,0x00,0x10,
+0x10,0x03,0x00,0x00,0x5b,0x00,0xf3,0x3c,0x0e,0x70,0x00,0x01,0xf5,0x25,0xee,0xff,
+0xee,0x20,0x7d,0x5f,0x8f,0x44,0x45,0xf2,0x2e,0xac,0xa6,0xf3,0x33,0x4f,0x23,0xff,
+0xf1,0x6f,0xff,0xff,0xf2,0x02,0xeb,0xa6,0xe1,0x11,0x11,0x01,0xcf,0xaf,0x8f,0xff,
+0xff,0xf8,0x1d,0xa8,0xcb,0xf9,0xc3,0xd8,0x80,0x86,0x8b,0xbf,0xff,0xef,0xe8,0x0f,
+0x9b,0xfe,0xcc,0xd8,0xea,0x82,0xf6,0xb8,0xf8,0x9c,0x3d,0x88,0x4d,0x24,0x1b,0x49,
+0x61,0x6d,0x50,0x5b,0x00,0xf4,0x44,0x63,0x00,0x12,0x46,0x94,0x00,0x0e,0x60,0xef,
+0xff,0xdd,0x70,0x04,0xf6,0x45,0xc4,0xc0,0xda,0x00,0xba,0xaa,0x6f,0x5f,0x5f,0x40,
+0x5f,0x6f,0x24,0xd5,0xda,0xf4,0x06,0xff,0x90,0x9f,0xff,0xff,0xf0,0x04,0xe7,0x76,
+0x8f,0xa7,0x77,0x23,0xec,0xce,0x8b,0xf9,0x99,0x92,0x4b,0x85,0x90,0x9f,0xee,0xe7,
+0x02,0x87,0x99,0x0d,0xfb,0x8f,0x20,0x5c,0xb8,0xd5,0xf8,0xff,0x90,0x08,0xa9,0x6a,
+0xfe,0xaf,0xff,0xa2,0x44,0x10,0x08,0x5c,0x40,0x7b,0xb6,0x00,0xf4,0x3e,0x09,0x90,
+0x00,0x0f,0x60,0x00,0x01,0xf6,0x1c,0xdd,0xfe,0xdd,0x40,0x9c,0x7e,0x66,0x6f,0xa6,
+0x61,0x5f,0xcf,0x89,0xef,0xff,0xee,0x16,0xdf,0xe1,0xab,0x8f,0x8c,0xf1,0x03,0xf9,
+0xba,0x9c,0xea,0xbf,0x12,0xee,0x9f,0xba,0xaf,0xb8,0xf1,0x5f,0xeb,0xfc,0xff,0xff,
+0xff,0x11,0x62,0x48,0x02,0xff,0xfa,0x00,0x2f,0x8a,0xe3,0xeb,0xf8,0xe9,0x05,0xe6,
+0xbb,0xec,0x1f,0x74,0xf4,0x58,0x35,0x02,0x00,0xf7,0x01,0x08,0x01,0xf4,0x3e,0x0d,
+0x30,0x00,0x6e,0x10,0x00,0x04,0xe2,0x2f,0xff,0xff,0xff,0x10,0xb6,0xca,0xf7,0x55,
+0x59,0xf1,0x4f,0x8f,0x36,0xf9,0x77,0x9b,0x06,0xdf,0x90,0x4f,0xac,0xfd,0xb0,0x06,
+0xdc,0x4b,0xc2,0x7f,0x53,0x03,0xfa,0xdb,0xfc,0x8f,0xff,0xd0,0x5d,0xa8,0xbf,0xc8,
+0xb0,0x6d,0x01,0x58,0x76,0x8c,0x8f,0xff,0xd0,0x4a,0xe7,0xb6,0xc8,0xc1,0x7d,0x08,
+0x8d,0x47,0x6c,0x8f,0xde,0xd0,0x43,0x10,0x06,0xc8,0xd5,0x9d,0xaa,0x00,0xf4,0x8d,
+0x3e,0x00,0x5d,0x3f,0x1c,0x70,0x08,0xb1,0x0b,0x85,0xf0,0xf5,0x00,0xd5,0xf8,0xf5,
+0x9f,0xaf,0xa0,0x6f,0xad,0x7d,0xdf,0x8d,0xcf,0x28,0xdf,0x50,0xc8,0xb0,0xb4,0x60,
+0x07,0xdc,0x3f,0x43,0x2e,0x60,0x02,0xf8,0xfd,0xf4,0xc8,0xe9,0x40,0x8f,0xee,0xaf,
+0x4d,0x6e,0xff,0x02,0x54,0x91,0xe4,0xf5,0xe6,0x00,0x5c,0xeb,0x4e,0x7f,0xdf,0x60,
+0x08,0xad,0x96,0xec,0xdb,0xfc,0x92,0x85,0x71,0x0e,0xa6,0x06,0xac,0x10,0x00,0x66,
+0x00,0x00,0xc4,0x00,0x00,0x0e,0x80,0x2c,0xdf,0xdc,0xc1,0x06,0xe3,0xa4,0xf6,0xe7,
+0x8f,0x12,0xe8,0xba,0x3f,0x8d,0xdb,0xf1,0x5f,0xfe,0x13,0xf5,0xbe,0x4f,0x10,0x2e,
+0x6a,0x3f,0x7a,0x87,0xf1,0x2d,0xed,0xf5,0xff,0xff,0xff,0x13,0xfa,0x5c,0x44,0x4b,
+0xa4,0x40,0x04,0x35,0x82,0x6b,0x8f,0x6a,0x00,0xf9,0xaf,0x7c,0xf4,0x84,0xf4,0x2f,
+0x6b,0x7e,0x7f,0x73,0xed,0x94,0xa2,0x40,0x21,0xbf,0xfd,0x20,0x4d,0x01,0xf0,0x3e,
+0xa0,0xff,0xff,0xff,0xf7,0x00,0xf4,0x10,0x00,0xf8,0x00,0x00,0x8c,0x6d,0x8e,0xee,
+0xee,0xe1,0x3f,0xad,0x8b,0xbb,0xbb,0xbb,0x57,0xff,0xd0,0xf6,0xd7,0xd7,0xe7,0x02,
+0xf8,0x9e,0xee,0xee,0xee,0x72,0xde,0xaf,0x6a,0xaa,0xaa,0xa0,0x4e,0xb8,0xea,0xf9,
+0x99,0xcf,0x01,0x85,0x7a,0x8e,0x77,0x7b,0xf0,0x3f,0x8a,0xf9,0xfc,0xcc,0xdf,0x06,
+0xe5,0xb7,0x6b,0xf3,0x7e,0x92,0x58,0x24,0x0d,0x82,0x00,0x4a,0x50,0x4a,0x01,0x10,
+0x20,0xa3,0x00,0xf3,0x3c,0x00,0x4f,0x60,0x00,0x03,0xf2,0x0c,0xee,0xff,0xed,0x00,
+0x9b,0x41,0xea,0x55,0x5a,0xe0,0x1f,0x4d,0x9e,0xc9,0x99,0xce,0x0a,0xff,0xf1,0xee,
+0xdd,0xdd,0xc0,0x5a,0xf8,0x0f,0xa4,0x44,0x44,0x00,0x8e,0x21,0xff,0xff,0xff,0xf1,
+0x6f,0xfe,0x6f,0xf6,0xe8,0x7f,0x14,0x72,0x46,0xfe,0xff,0xff,0xf1,0x16,0xdf,0xde,
+0xc8,0xf9,0x9f,0x1a,0xfa,0x3e,0x9c,0x6e,0x88,0xf1,0x32,0x00,0xa2,0xc6,0xe7,0xcd,
+0xa9,0x00,0xd3,0x05,0xff,0xff,0xff,0xff,0xfe,0x00,0x5f,0x17,0xf0,0x9d,0x0a,0xe0,
+0x0d,0x00,0xf0,0x26,0x57,0x77,0x8f,0xa7,0x77,0x71,0x0a,0xbb,0xbd,0xfc,0xbb,0xbb,
+0x20,0x07,0xcc,0xdf,0xcc,0xcc,0x00,0x00,0x9e,0x77,0x77,0x7c,0xf0,0x00,0x09,0xf9,
+0x99,0x99,0xcf,0x00,0x00,0x9f,0xbb,0xbb,0xbe,0xf0,0x00,0x09,0xf8,0x88,0x88,0xcf,
+0x00,0x02,0xae,0x77,0x77,0x7c,0xf2,0x11,0xff,0x01,0x00,0x14,0xf8,0xa2,0x01,0xd0,
+0x9c,0x00,0x07,0xe2,0x00,0x03,0x5a,0xf8,0x56,0xfe,0x65,0x00,0x8f,0x1a,0x00,0x90,
+0xf0,0x00,0x55,0x56,0xfa,0x55,0x52,0x00,0x0e,0x0d,0x00,0x20,0x70,0x05,0x0d,0x00,
+0xf0,0x01,0x55,0x41,0xee,0xee,0xff,0xfe,0xee,0xea,0x04,0x66,0x69,0xf8,0x66,0x66,
+0x20,0xbf,0x1a,0x00,0xf3,0x06,0xf6,0x00,0x00,0x8f,0xae,0xd3,0x00,0x01,0x6a,0xef,
+0xa0,0x3e,0xfc,0x95,0x0e,0xe9,0x30,0x00,0x18,0xdf,0x60,0x54,0x00,0xf0,0x06,0x06,
+0xb0,0x00,0xac,0x00,0x00,0x5b,0xdf,0xcb,0xbf,0xeb,0xa0,0x03,0x88,0x8a,0xfa,0x88,
+0x86,0x00,0x0c,0xff,0x9a,0x05,0xf0,0x28,0x09,0x99,0x9b,0xfb,0x99,0x99,0x40,0x89,
 0xad,0xe9,0xda,0xcb,0x84,0x0b,0xef,0xf9,0x4f,0x7b,0xf8,0x01,0x99,0xde,0x9a,0xfd,
 0x9d,0xc5,0x06,0x6c,0xe9,0x8c,0xf8,0xea,0x31,0xef,0xff,0xf9,0x3f,0xfd,0x30,0x04,
-0x5c,0xc3,0x9e,0xff,0xbb,0xa0,0x1f,0xe7,0x3d,0x71,0x7e,0xe4,0x00,0x13,0x64,0x97,
-0x49,0xf0,0x1c,0xfc,0x99,0xff,0xbf,0xf2,0x0d,0x4f,0x6c,0x25,0xf5,0x5f,0x20,0xd6,
-0xfa,0x80,0x1f,0x42,0xf2,0x9f,0xff,0xff,0xb8,0xfc,0x8f,0x21,0x6f,0xfe,0x55,0xdf,
-0x8d,0xf2,0x5f,0xaf,0xaf,0x18,0xf4,0x7f,0x28,0xa4,0xc2,0x50,0x6f,0x28,0x34,0x41,
-0xf0,0x0e,0x5f,0xfb,0xff,0x23,0xf7,0xf8,0xf8,0x5f,0x84,0xf2,0x3f,0x8f,0x9f,0x00,
-0xf2,0x1f,0x23,0xfe,0xfe,0xf1,0x6f,0x56,0xf2,0x3e,0x44,0x6d,0x1e,0xb4,0xfa,0x6c,
-0x0d,0x00,0x61,0x52,0xf1,0x38,0x5e,0x39,0xf0,0xbc,0x3b,0xe0,0x07,0xdf,0xef,0x39,
-0xff,0xde,0x00,0x95,0x02,0x64,0xd6,0x03,0x60,0x00,0xfe,0xde,0xfe,0xde,0xf0,0x00,
-0x0f,0xb9,0xbf,0xa9,0xcf,0x00,0x00,0xfa,0x7a,0xf9,0x7b,0xf0,0x00,0x0b,0xcf,0xcb,
-0xcf,0xcb,0x00,0x08,0xbc,0xfc,0xbc,0xfc,0xba,0x04,0xcc,0xdf,0xdc,0xdf,0xdc,0xc6,
-0x17,0xae,0xf6,0x27,0xff,0xb6,0x10,0xbb,0x71,0x00,0x01,0x5b,0x90,0xc9,0x3a,0x81,
-0x32,0x00,0x06,0x66,0xfc,0x66,0x4e,0xc0,0xaa,0x0b,0x74,0xd1,0x00,0x11,0x11,0xfa,
-0x3d,0xe2,0xd9,0x81,0xf0,0x00,0x44,0x5a,0xff,0x84,0x44,0x42,0x02,0x8e,0xff,0xeb,
-0xbb,0xb0,0x03,0xff,0xef,0x99,0x7f,0x50,0x04,0x19,0xfc,0xcc,0xce,0x5b,0x1c,0x01,
-0x53,0x14,0x52,0x09,0xf5,0x55,0x5b,0xf0,0xd6,0x18,0x00,0x1f,0x43,0xf0,0x3e,0x00,
-0x06,0xd7,0x03,0xef,0xff,0xa7,0xcf,0xe8,0x10,0x15,0x9f,0x63,0xa9,0xf8,0x00,0x00,
-0xbd,0xfc,0x40,0x0e,0xb6,0x90,0x0a,0xcf,0xb4,0xae,0xff,0xff,0x22,0x59,0xf6,0x58,
-0xaf,0xa1,0x00,0x5f,0xff,0xfe,0x00,0xea,0x68,0x60,0x2f,0xfc,0x1c,0xef,0xff,0xd8,
-0x0c,0xff,0xfa,0x97,0xf9,0x00,0x07,0xf8,0xf6,0x60,0x0e,0x80,0x78,0x14,0x5f,0x10,
-0x00,0xeb,0x4c,0xa0,0x05,0xf1,0x00,0x08,0xff,0xe4,0x00,0x8f,0xfc,0x10,0xf8,0x39,
-0x71,0xef,0xfe,0x7d,0xa7,0xf3,0xf7,0x05,0xbf,0x52,0xde,0xdf,0xcf,0x70,0x4a,0xf5,
-0x1d,0xed,0xfc,0xf7,0x0c,0xff,0xf3,0xdc,0x9f,0x7f,0x71,0x6b,0xf6,0x36,0x8a,0xf8,
-0x83,0x2b,0xef,0xd9,0xee,0xff,0xee,0xd0,0x1f,0xfd,0x3f,0x68,0xf8,0xae,0x0a,0xff,
-0xdc,0xf3,0x7f,0xcc,0xe4,0xfb,0xf4,0x5f,0xff,0xed,0xfe,0x18,0x8f,0x02,0xf3,0x00,
-0x18,0xe0,0x08,0xf0,0x2f,0x10,0x06,0xf9,0xae,0x62,0xf4,0x40,0x20,0x06,0xff,0xff,
-0x1f,0x20,0x4d,0x00,0x2e,0xad,0xb9,0x9a,0x1c,0x7a,0x00,0xd6,0xbb,0xfc,0xd7,0xfc,
-0x90,0x0d,0xff,0x8c,0xf4,0x3a,0xf4,0x00,0xd9,0xd9,0xc9,0xc5,0xd9,0xd3,0x0d,0x9d,
-0xaf,0xed,0xcf,0xdc,0x80,0xdf,0xf8,0x84,0xa6,0xa3,0x81,0x0d,0x6b,0x8b,0x7e,0x7f,
-0x5f,0x11,0xda,0xed,0xbe,0xf7,0xfe,0xf1,0x7f,0xff,0xc5,0xaf,0x5f,0xaf,0x11,0x20,
-0xb8,0x3d,0xc2,0xf3,0x00,0x00,0x0b,0x86,0xb1,0x1f,0x30,0xad,0x0c,0xf0,0x27,0xcf,
-0xec,0x8a,0xff,0xf0,0x00,0x11,0xe9,0x10,0xd7,0x2f,0x21,0x07,0xaa,0xaa,0x8f,0x42,
-0xde,0x50,0x9d,0xec,0xf6,0xce,0xaf,0x70,0x0b,0xee,0xde,0x66,0xff,0xe4,0x11,0xf5,
-0x33,0x36,0xea,0x8b,0xf4,0x0c,0xdf,0xdc,0xcc,0xcf,0xec,0x40,0x04,0xfd,0xcc,0xcc,
-0xf9,0x00,0x00,0x4f,0x98,0xec,0x50,0x90,0x04,0xfa,0x88,0x88,0xfa,0x00,0x1e,0xef,
-0xfe,0xd3,0x15,0xf0,0x1b,0x55,0x44,0x43,0x32,0xea,0x10,0x00,0x00,0xf9,0x0f,0x80,
-0x42,0x00,0xff,0xff,0x90,0xfd,0xef,0x90,0x02,0x22,0xf9,0x0f,0xc4,0x02,0x02,0xac,
-0xef,0x90,0xfb,0x56,0xf5,0x19,0x64,0xf9,0x08,0xee,0xeb,0x10,0x09,0xef,0xee,0xc2,
-0x1b,0x51,0xaf,0x44,0x44,0x4d,0xc0,0x58,0x5e,0x00,0x17,0x59,0x35,0x33,0x33,0x3d,
-0x0d,0x00,0x50,0xae,0x00,0x03,0x5d,0xc0,0x9e,0x6d,0x26,0x6f,0xe6,0xbc,0x4a,0x00,
-0x1c,0x3c,0xf0,0x16,0x07,0xf4,0xe9,0x0f,0x98,0xf7,0x04,0xfd,0x8d,0xf2,0xff,0xc6,
-0x10,0x2e,0xcb,0x9f,0x6f,0x80,0x0a,0x20,0x45,0x55,0x60,0xfd,0x8a,0xf3,0x0e,0xff,
-0xff,0x07,0xcc,0xc9,0x00,0xeb,0x6b,0xf0,0xf8,0x3b,0x50,0xb0,0xff,0x0f,0x98,0xfa,
-0x00,0xea,0x4a,0xf0,0xff,0xe8,0x10,0x0d,0x00,0xf1,0x01,0xa0,0x06,0x10,0xe7,0x5b,
-0xf0,0xfc,0x77,0xf6,0x0e,0x78,0xd8,0x08,0xee,0xec,0x10,0x99,0x0b,0xf5,0x3f,0x62,
-0x00,0xef,0xfe,0x19,0xbe,0xff,0xc0,0x0e,0x9a,0xe3,0xfd,0xa7,0x30,0x00,0xe5,0x6e,
-0x3f,0x10,0x02,0x10,0x0e,0xaa,0xe3,0xf2,0x5a,0xfc,0x00,0xef,0xfe,0x3f,0x8f,0xfd,
-0x50,0x0e,0x56,0xe4,0xf7,0xe7,0xb5,0x20,0xfa,0xbe,0x4f,0x7e,0x4f,0xf8,0x0f,0xff,
-0xe5,0xf6,0xe2,0xf7,0x00,0xf3,0x6e,0x7d,0x6e,0x0e,0x60,0x4f,0x16,0xea,0xa6,0xf6,
-0xad,0x07,0xf3,0xae,0xe7,0xaf,0xe5,0xf7,0x6a,0x4f,0x9e,0x27,0x70,0x9c,0x2f,0x30,
-0x33,0x02,0x03,0x8f,0x07,0xfa,0x3e,0xf3,0xd6,0xf2,0xff,0xf1,0x0f,0x5f,0x6f,0x0a,
-0xaf,0x9f,0x10,0xf3,0xfe,0xa6,0x4f,0xf6,0xf1,0x0f,0x9f,0xb6,0xf4,0x8f,0x6f,0x10,
-0xff,0xf3,0xaf,0xd1,0xf6,0xf1,0x0f,0x3f,0x9f,0x3d,0xcf,0x6f,0x11,0xfa,0xff,0xa3,
-0x5d,0xf6,0xf1,0x1f,0xdf,0x6f,0xff,0x4f,0x6f,0x12,0xf1,0xf4,0xf1,0xe3,0xf6,0xf1,
-0x5e,0x0f,0x4f,0x0e,0x3f,0x95,0x08,0xc6,0xf4,0xff,0xf3,0xf4,0x00,0x68,0xcc,0x1e,
-0x5d,0x3f,0x40,0x00,0x5d,0x20,0x9f,0xe2,0x00,0x00,0x05,0x55,0xde,0x55,0x55,0x01,
-0x72,0x17,0x03,0x00,0xac,0x2c,0x03,0x0b,0x00,0x02,0x16,0x00,0x01,0xb4,0x17,0x02,
-0x2c,0x00,0x62,0xb7,0x77,0x77,0xcf,0x10,0x0c,0x64,0x67,0xc0,0x56,0x8f,0xe7,0x69,
-0x96,0x61,0x00,0x09,0xf5,0x00,0xee,0x20,0x4e,0xa1,0x41,0x06,0xfe,0x20,0x02,0xca,
-0x5c,0x73,0x10,0x07,0x87,0x8e,0x95,0x47,0x80,0x0d,0x7b,0x12,0x0e,0x3a,0x60,0x53,
-0x77,0x78,0xfb,0x77,0x73,0x1a,0x7b,0x03,0x48,0x2f,0x01,0x96,0x2f,0x13,0x74,0x96,
-0x00,0xf1,0x25,0x2b,0xe6,0xf8,0x57,0xff,0xa0,0x04,0xf1,0x0f,0xff,0x65,0xea,0x00,
-0x4f,0x01,0xf6,0x31,0x0d,0xa0,0x03,0xff,0x7f,0xa8,0x6f,0xfa,0x00,0x3f,0x42,0xbc,
-0xf4,0x4e,0xa0,0x02,0xf7,0x38,0x2f,0x56,0xf9,0x00,0x2f,0xd7,0xf3,0xf8,0xef,0x80,
-0x05,0xf6,0x5f,0x7f,0x74,0xfa,0x33,0x47,0x00,0xfc,0x05,0xfb,0x02,0x29,0xd3,0x24,
-0xfa,0x32,0x10,0x5d,0xfa,0x10,0x18,0xff,0x80,0x0c,0xb3,0x00,0x00,0x01,0xab,0xfb,
-0x3c,0x00,0x90,0x1f,0x30,0x06,0xdd,0x73,0x9e,0x38,0xf0,0x14,0xed,0xbf,0xcf,0xff,
-0xff,0xf4,0x0e,0xc6,0xe8,0x55,0x55,0x55,0x10,0xea,0xce,0x63,0x88,0x88,0x00,0x3f,
-0x97,0xf6,0x6f,0xef,0xf0,0x0b,0xff,0xef,0x66,0xf0,0x6f,0x00,0x0f,0xb5,0xe6,0x71,
-0x2e,0xfc,0x0b,0xf8,0xde,0x69,0xd0,0x6f,0x00,0x2f,0x22,0xe6,0xcb,0x06,0xf6,0x58,
-0xe0,0x4f,0xaf,0x60,0x6f,0xa7,0x99,0x0d,0xd8,0xd0,0x02,0xdd,0x20,0xa9,0x6c,0xfc,
-0x3b,0x1f,0x60,0x00,0x06,0xec,0x63,0x22,0xcc,0x22,0x00,0xed,0xbf,0x9f,0xff,0xff,
-0xf3,0x0e,0xc6,0xe9,0xf4,0x22,0x5f,0x30,0xea,0xde,0x78,0xb3,0x01,0x61,0x3f,0x97,
-0xf5,0x2f,0x40,0x72,0x0b,0xff,0xef,0x52,0xf7,0xcf,0x80,0x0f,0xa4,0xe5,0x2f,0xfb,
-0x30,0x00,0xf9,0xce,0x52,0xf5,0x00,0x00,0x2f,0x25,0xe5,0x2f,0x40,0x0d,0x48,0xe0,
-0x4f,0x51,0xf9,0x56,0xf4,0x97,0x0d,0xd2,0x0a,0xff,0xfc,0xb4,0x27,0x12,0x70,0x74,
-0x76,0x00,0x7d,0x2b,0xd2,0x1b,0xf7,0x56,0xef,0x20,0x00,0x3e,0xfc,0x66,0xaf,0xa6,
-0x62,0x05,0x7c,0x35,0xe2,0x02,0xf7,0x01,0xf7,0x02,0xf6,0x00,0x0f,0xb6,0x7f,0xa6,
-0x8f,0x60,0x00,0xdf,0x05,0x00,0x53,0x5b,0x20,0x17,0x60,0x06,0x3f,0x00,0x45,0x92,
-0x50,0xd6,0x66,0x66,0x69,0xf5,0x85,0x9c,0x30,0xff,0xe9,0x00,0x73,0x45,0x13,0xea,
-0x02,0x62,0xd2,0xf2,0x15,0x5c,0xe6,0x76,0xfc,0x55,0x10,0x00,0x57,0x5f,0x47,0x50,
-0x22,0x1d,0xe2,0xf2,0x00,0x1f,0xa6,0x9f,0x86,0xaf,0x20,0x01,0xf6,0x05,0xf4,0x06,
-0xf2,0x62,0x00,0xf4,0x0c,0xf5,0x27,0x77,0x8f,0xff,0x97,0x77,0x20,0x00,0x3d,0xf7,
-0xee,0x40,0x00,0x38,0xdf,0xe4,0x01,0xdf,0xea,0x41,0xeb,0x60,0x00,0x00,0x6c,0xe1,
-0x9c,0x0e,0x54,0x27,0xf4,0x22,0xdc,0x22,0xe8,0x37,0xe0,0x38,0xf5,0x33,0xdc,0x33,
-0x10,0x00,0xda,0x54,0x47,0x74,0x42,0x00,0x8f,0xce,0x10,0xf0,0x10,0x80,0x5f,0xc0,
-0x22,0x22,0x2f,0x80,0x3f,0xfb,0x3f,0xff,0xf2,0xf7,0x01,0xde,0xb3,0xf6,0x7f,0x2f,
-0x70,0x00,0xbb,0x3f,0x78,0xf2,0xf7,0x00,0x0b,0xb3,0xff,0xff,0x0d,0x00,0x40,0x17,
-0x10,0x78,0xf7,0x46,0x01,0x23,0x0c,0xeb,0xf2,0x67,0x70,0x71,0xdd,0xef,0xed,0xdf,
-0xfd,0xd6,0xfe,0x39,0xf0,0x00,0xdc,0x60,0x00,0x8c,0xdd,0xef,0xff,0xfe,0x60,0x04,
-0xa9,0x78,0xc4,0x31,0xa6,0x9c,0x4d,0xb0,0x40,0x6f,0x50,0x00,0x7e,0x01,0xe5,0x09,
-0x90,0x00,0x67,0x1d,0x61,0x04,0x01,0x24,0xf3,0x09,0x01,0x8f,0xdf,0xdf,0xa2,0x00,
-0x2c,0xff,0x62,0xf7,0x3d,0xfd,0x50,0x86,0x00,0x2f,0x70,0x04,0x91,0x03,0x38,0xf4,
-0x33,0xdc,0x84,0x38,0x72,0xf6,0x01,0x5b,0xd3,0x11,0xba,0x11,0x8b,0x02,0xf0,0x1a,
-0xf0,0x0b,0xeb,0xb4,0x44,0x44,0xbf,0x02,0xe6,0xff,0xee,0xee,0x39,0xf0,0x01,0x5b,
-0x3e,0x93,0x30,0x9e,0x00,0x5e,0xee,0xff,0xee,0xba,0xd0,0x01,0x56,0x3e,0x94,0x73,
-0xbd,0x00,0x09,0xc1,0xe8,0x4f,0x3c,0xb0,0x00,0x23,0x85,0x15,0xf9,0x64,0x99,0x08,
-0x72,0x17,0xf0,0x21,0xcc,0xdf,0xdc,0xcf,0xec,0xc5,0x00,0x25,0xe2,0x33,0xc9,0x00,
-0x00,0x5f,0x90,0x1e,0xe4,0x44,0x10,0x00,0x8f,0x5d,0xfd,0xde,0xfb,0x00,0x61,0x2d,
-0xee,0xd7,0xec,0x10,0x2d,0xf6,0x44,0x8f,0xff,0x94,0x00,0x07,0x2d,0xfd,0x72,0x6c,
-0xf9,0x00,0x2c,0x5f,0xae,0x1b,0xf2,0x04,0x1d,0xd1,0xf8,0x11,0x2f,0x70,0x0d,0xe2,
-0x0f,0xec,0xcd,0xf7,0x00,0x64,0x00,0xfa,0x55,0x6f,0x70,0x4e,0x00,0xf5,0x37,0x61,
-0xdd,0xef,0xdd,0xdf,0xfd,0xd5,0x00,0x4b,0xe1,0x00,0xb9,0x00,0x00,0x0d,0xfb,0xbb,
-0xbb,0xbb,0xb1,0x09,0xfb,0xab,0xbe,0xca,0xcf,0x14,0xfe,0xdd,0xff,0xff,0xb6,0xf1,
-0x04,0x67,0x7d,0xc7,0x74,0x6f,0x10,0x0c,0xc7,0xdc,0x7d,0x87,0xf0,0x00,0xce,0xdf,
-0xed,0xf8,0x8f,0x00,0x0c,0xd9,0xed,0x9e,0x89,0xe0,0x00,0xca,0x3c,0xb5,0xd9,0xcc,
-0x00,0x0c,0x90,0xa8,0x5a,0x8f,0x11,0x11,0x6f,0x55,0x00,0xf0,0x00,0x15,0xbb,0xef,
-0xbb,0xcf,0xdb,0xb0,0x00,0x08,0x96,0xd3,0xb3,0x00,0x00,0x4e,0x2c,0x60,0x82,0x00,
-0x03,0x55,0x5a,0xf6,0x55,0x52,0x06,0x03,0x02,0xe0,0x02,0x9f,0xd6,0x56,0xff,0x70,
-0x00,0x4d,0xcc,0xbb,0xba,0xae,0x40,0x00,0x34,0x15,0xf1,0x01,0xa0,0x00,0x0f,0x89,
-0xc4,0xf3,0xda,0x00,0x23,0xf9,0x9c,0x6f,0x4e,0xc3,0x19,0xff,0x97,0x6f,0x04,0x72,
-0x61,0x20,0xdf,0xbb,0x72,0x61,0xf0,0x14,0x15,0x91,0x11,0xc5,0x00,0x00,0x8e,0xcf,
-0xc9,0x6f,0x74,0x30,0x08,0xe9,0xcc,0x6d,0xdb,0xa9,0x00,0x8e,0xcc,0xfd,0xf3,0xf3,
-0x00,0x08,0xd7,0xf7,0x53,0x0a,0xb0,0x00,0x49,0x99,0x98,0x63,0x0f,0x11,0xdf,0x51,
-0x02,0xe1,0x0d,0x96,0xe2,0xe8,0x7f,0x20,0x14,0xea,0x8f,0x4e,0x98,0xf6,0x35,0xff,
-0xbd,0x1e,0x03,0x4e,0x00,0xe1,0x44,0x6e,0x74,0x4f,0xd8,0xd2,0x07,0x17,0x77,0x77,
-0xbf,0x9f,0x60,0xe3,0xcd,0x1c,0xf9,0x25,0x0e,0x3f,0x74,0x44,0x8f,0x33,0x20,0xef,
-0xf8,0xff,0xfa,0xf3,0xf2,0x01,0x1f,0x8d,0xbb,0x6f,0x9e,0x08,0xee,0xf8,0xd7,0xc9,
-0xfe,0xa0,0x3d,0x9f,0x7f,0xce,0x7e,0xf3,0x00,0xe5,0xf6,0xc9,0x91,0xdc,0x33,0x5d,
-0x6d,0x4e,0xee,0xff,0xfb,0xa1,0x27,0x80,0x00,0x3d,0x5b,0xf4,0x94,0x01,0xf0,0x3b,
-0x61,0xcc,0xef,0xdc,0xcf,0xfc,0xc5,0x01,0x25,0xa4,0x02,0x97,0x22,0x00,0x9f,0xac,
-0xf2,0xfd,0xad,0xe0,0x09,0xfa,0xbf,0x2f,0xda,0xde,0x00,0x9f,0xdd,0xd7,0xdd,0xdf,
-0xe0,0x09,0xd5,0xbb,0xfc,0xba,0x8e,0x00,0x9d,0x2c,0xcf,0xdc,0x68,0xe0,0x09,0xd3,
-0xc8,0xd8,0x98,0x8e,0x00,0x9d,0x2d,0xef,0xfd,0x78,0xe0,0x09,0xd5,0xda,0xfa,0xd5,
-0xbe,0x00,0x9d,0x24,0x0c,0x23,0x6e,0x80,0x2f,0xff,0x0d,0x08,0xf0,0x23,0x02,0xe1,
-0x6c,0x00,0x0f,0x93,0x30,0x2e,0x05,0xc2,0x44,0xfa,0x44,0x22,0xfb,0xcc,0x7f,0xef,
-0xfe,0xf9,0x26,0x66,0x57,0xf5,0xfb,0x7d,0x4c,0xff,0xff,0x9f,0x6f,0xa5,0x80,0x2e,
-0x93,0x38,0xe0,0xcf,0xfd,0x01,0xfd,0xb7,0x9d,0x15,0x65,0x00,0x18,0x8e,0x8a,0xc7,
-0xde,0x5b,0xfb,0x03,0xd7,0xd9,0x98,0x8c,0x35,0x02,0x4f,0x8f,0x8f,0x48,0xea,0xb0,
-0x6f,0xc5,0xd8,0xa0,0x5e,0xe5,0xd2,0x03,0x50,0x99,0x00,0x08,0xf3,0x20,0x07,0x00,
-0xf0,0x23,0x5f,0xff,0xfc,0x00,0x2d,0xfe,0xda,0xff,0xb6,0xf4,0x00,0x2f,0xba,0xf5,
-0x83,0xff,0x90,0x00,0x2e,0x76,0xe5,0x9e,0xfd,0xfd,0x70,0x2e,0x76,0xed,0xe9,0x7a,
-0x6d,0x90,0x2f,0xff,0xf3,0xbd,0xef,0xdd,0x20,0x19,0xbb,0x70,0x59,0xcf,0x99,0x00,
-0x00,0x99,0xf3,0x7f,0x2e,0x20,0xf1,0x01,0xab,0xe8,0x44,0xaf,0x44,0x30,0x5e,0xff,
-0xfe,0xdd,0xef,0xdd,0x90,0x25,0x30,0x34,0x94,0x3a,0x20,0xb8,0x07,0x80,0x08,0x72,
-0x0b,0x80,0x7e,0x3f,0x88,0xf0,0x2f,0xcf,0x22,0x20,0xfc,0xbf,0x0d,0x00,0x21,0x2e,
-0x86,0x0d,0x00,0xf0,0x16,0xe8,0x6f,0x08,0xf5,0x8a,0x00,0x2f,0xff,0xf4,0xff,0xfd,
-0x61,0x02,0xbc,0xb7,0x19,0xfb,0x4c,0xc0,0x00,0xba,0xe9,0xff,0xff,0xce,0x62,0x7e,
-0xff,0x4c,0x5d,0x9a,0x60,0x6f,0xc9,0xad,0xf5,0xe9,0xf7,0x9b,0x71,0x74,0xee,0x40,
-0x81,0x00,0x19,0x30,0xd6,0x04,0x00,0x8d,0x5e,0x91,0xe0,0x0b,0xf8,0x02,0x77,0x77,
-0x77,0x07,0xfb,0x25,0x63,0x31,0x1b,0x1e,0xe0,0x3c,0x06,0x70,0xf6,0x78,0x88,0x88,
-0x82,0x07,0xff,0x4a,0x03,0x30,0x46,0xff,0xe0,0xe2,0x05,0x21,0x3c,0xbe,0xd5,0x05,
-0x21,0x09,0xe0,0xef,0x05,0x13,0x9e,0x0d,0x00,0x31,0x01,0x9a,0xf7,0x60,0x60,0x70,
-0xeb,0x10,0x00,0x00,0x84,0x08,0x50,0x4b,0x1f,0xf1,0x56,0x4c,0xfe,0xd4,0xdf,0xf3,
-0x6f,0xa0,0x3f,0x6e,0x55,0x55,0x16,0xc7,0x9e,0xfe,0xfe,0x10,0x00,0x02,0xfc,0xaa,
-0xaa,0xa0,0x00,0x00,0x9f,0x3b,0xcc,0xc9,0xff,0xf6,0x5f,0xf2,0xe5,0x2a,0xa7,0xfb,
-0x29,0xff,0x2e,0xff,0xf9,0x0e,0x80,0x27,0xf3,0x44,0xea,0x30,0xe8,0x00,0x3f,0x7f,
-0xff,0xfe,0x0e,0x80,0x03,0xf2,0xf5,0xd9,0x20,0xe8,0x00,0x3f,0x4e,0xef,0xff,0x9f,
-0x80,0x03,0xf2,0x00,0xd7,0x0d,0xc2,0x00,0x00,0x73,0x01,0x36,0x30,0x00,0x00,0x6f,
-0x7f,0xff,0xd8,0xcf,0xf2,0x5f,0xb1,0x67,0xf5,0x45,0x66,0x17,0xd7,0x7f,0xff,0xff,
-0xec,0x27,0xf0,0x13,0xf5,0x40,0x00,0x00,0x8f,0x4e,0xef,0xec,0xff,0xf6,0x4f,0xf2,
-0xf9,0xf9,0xd5,0xfb,0x29,0xff,0x2f,0x8f,0x9d,0x0e,0x80,0x16,0xf2,0xee,0xfe,0xc0,
-0xe8,0x00,0x3f,0x28,0xaf,0x97,0x55,0x00,0xf2,0x09,0x79,0xf8,0x60,0xe8,0x00,0x3f,
-0x5c,0xdf,0xef,0x7f,0x70,0x03,0xf3,0x65,0x43,0x1d,0xe3,0x00,0x00,0x11,0x15,0xf4,
-0x11,0x10,0x69,0x28,0x72,0xc0,0x02,0x55,0x58,0xf7,0x55,0x53,0xb7,0x25,0x73,0x40,
-0x02,0x44,0x47,0xf7,0x44,0x42,0x41,0x67,0xf1,0x0a,0x02,0x26,0xee,0xbf,0x42,0x74,
-0x00,0x29,0xfe,0x21,0xf9,0x8f,0xa0,0x6f,0xff,0xb0,0x08,0xff,0x60,0x00,0x61,0xeb,
-0x38,0x7c,0xf8,0xfc,0x23,0x60,0x0a,0xff,0x50,0x03,0xe9,0x40,0x21,0x22,0x0c,0x30,
-0x18,0x14,0x30,0xfa,0x06,0x91,0x00,0x34,0x55,0x55,0x55,0x54,0x30,0x00,0x6f,0xbc,
-0x04,0xf0,0x24,0x8b,0xf7,0x66,0x67,0xfc,0x82,0x19,0xcf,0x88,0x88,0x8f,0xc9,0x20,
-0x06,0xfe,0xdd,0xde,0xf7,0x00,0x00,0x17,0xfe,0x8f,0x84,0xb6,0x00,0x5b,0xff,0x20,
-0xce,0xce,0x50,0x4f,0xcc,0xe1,0x46,0xef,0x81,0x00,0x10,0xcf,0xff,0x92,0xcf,0xf5,
-0x00,0x08,0x84,0x10,0x00,0x48,0xf8,0x91,0x20,0x00,0xe8,0x31,0x2b,0x70,0x25,0x5f,
-0xb5,0x62,0x5f,0xff,0x97,0xf6,0x0f,0xf0,0x1b,0x67,0xf6,0x7e,0x0e,0x86,0xf1,0x00,
-0x8e,0x27,0xe0,0xe8,0x48,0x00,0x3f,0xae,0xcf,0xff,0xff,0xe0,0x2e,0xff,0x99,0xff,
-0x65,0xeb,0x07,0xef,0xde,0xbb,0xd9,0x5f,0x50,0x12,0xf6,0x6e,0x85,0xfe,0xc0,0x00,
-0x0f,0x63,0xf5,0x47,0xa9,0xb3,0xf6,0xce,0xaf,0xdb,0xfe,0x40,0x0f,0x68,0x59,0x70,
-0x04,0x8d,0x47,0x00,0x58,0x5f,0xc0,0x0f,0x7c,0x80,0x01,0xf7,0x05,0x56,0xfa,0x9f,
-0x74,0xce,0xd6,0x5c,0x07,0x90,0x28,0xaf,0x41,0x12,0xf7,0x11,0x00,0x0b,0xc1,0x35,
-0x07,0x90,0x04,0xfa,0xed,0xb4,0xf9,0x5f,0x41,0xef,0xf7,0x0d,0x00,0xa0,0x9e,0xfc,
-0xcc,0xb3,0xf8,0x5f,0x42,0x4f,0x51,0xcf,0xb4,0x2e,0xb0,0xf4,0x0c,0xb4,0xf9,0x6f,
-0x40,0x1f,0x40,0xca,0x0f,0x77,0x0d,0x00,0x44,0xa0,0xf6,0xed,0x10,0xa9,0x99,0x10,
-0xf5,0x3d,0x14,0x90,0xac,0x7f,0x75,0x5d,0xe5,0x52,0x07,0xbc,0xf9,0x40,0x60,0xf4,
-0x0a,0x99,0xaf,0x50,0x0b,0xd0,0x00,0x1c,0xfa,0xf5,0x55,0xde,0x55,0x11,0xda,0x0f,
-0x5e,0xff,0xff,0xf3,0x1a,0x22,0x98,0xe5,0x22,0x22,0x36,0x3c,0xf4,0x0a,0x4a,0xfa,
-0x5f,0x53,0xda,0x02,0xfe,0xed,0x00,0x9f,0xf9,0x10,0x01,0x0c,0xea,0xd5,0x9f,0xd7,
-0x20,0x01,0xfd,0x96,0x10,0x3a,0xf6,0xc2,0x14,0x21,0x01,0x10,0x02,0x9f,0xf2,0x1e,
-0xb9,0x00,0x2f,0x57,0xe0,0x3f,0xff,0xfe,0xb2,0xf5,0x7e,0x04,0xe8,0xec,0x88,0x2f,
-0x57,0xe0,0x38,0x8e,0xc8,0x82,0xf5,0x7e,0x00,0xef,0xff,0xfe,0x04,0x17,0xe0,0x0e,
-0x4b,0xaf,0xe0,0x1f,0xfd,0x00,0x21,0x75,0x5f,0x50,0x78,0x30,0x6f,0x5e,0x06,0xf9,
-0x0b,0x35,0xaf,0xd9,0xf6,0x5d,0xb1,0x4e,0xff,0xb0,0x0b,0xff,0xb2,0x00,0x52,0xfc,
-0xac,0x0a,0xfe,0x93,0x00,0x3f,0xc8,0x40,0x03,0x9d,0x30,0xe1,0x32,0x40,0x3f,0x20,
-0x0d,0xb0,0x3c,0x7c,0x00,0x2e,0x05,0xf0,0x0d,0x39,0xff,0xfa,0xfe,0x77,0x77,0x61,
-0x36,0x7f,0x9e,0xfc,0xcc,0xf8,0x00,0x09,0xd3,0x5f,0xbb,0xbf,0x80,0x04,0xfa,0xf7,
-0xf6,0x55,0xf8,0x03,0xff,0x04,0x3b,0xf3,0x12,0x80,0xcf,0xfe,0xd0,0x6f,0xa4,0x51,
-0x05,0x3f,0x69,0x7f,0xec,0xef,0x60,0x00,0xf5,0x4f,0xbf,0x8f,0xa0,0x00,0x0f,0x51,
-0x69,0xff,0xf9,0x61,0x00,0xf5,0x5d,0x94,0x17,0xbd,0x0b,0x01,0x02,0xc2,0x37,0x20,
-0x14,0x77,0xbb,0x8d,0x40,0x70,0x00,0x00,0xd8,0x50,0x24,0x72,0x56,0x6e,0xb7,0xf9,
-0x66,0x30,0x0e,0xd1,0x21,0xf3,0x11,0xe9,0x0f,0x71,0xf6,0x0f,0x90,0x0e,0x96,0xf3,
-0x1f,0x72,0xf9,0x00,0xee,0xf9,0x00,0xef,0xff,0x90,0x0e,0xb6,0x00,0x01,0x44,0xf9,
-0x00,0xea,0x11,0x11,0x11,0x1f,0x90,0x27,0x00,0x00,0x43,0x85,0x32,0x5f,0x90,0x0f,
-0x06,0x21,0xe1,0x55,0x5b,0xf5,0xce,0x55,0x51,0x01,0x44,0xae,0x4b,0xd4,0x43,0x00,
-0x5f,0x75,0x25,0x80,0x05,0xf1,0x8e,0x09,0xd0,0x9e,0x00,0x5f,0xf0,0x91,0x73,0xe0,
-0x02,0x44,0x8f,0x94,0x44,0x44,0x59,0x01,0xf4,0x0a,0x03,0x3c,0xf6,0x34,0xee,0x43,
-0x20,0x03,0xef,0xfc,0xcf,0x40,0x00,0x03,0x46,0xaf,0xff,0xff,0xa5,0x00,0xaf,0xec,
-0x83,0x03,0x8e,0xac,0x02,0x03,0xa8,0x9e,0xf6,0x38,0x11,0x1c,0xa1,0xda,0x11,0x10,
-0x09,0xfd,0xff,0xdf,0xfd,0xfb,0x00,0x9e,0x9e,0xd9,0xed,0x9e,0xb0,0x02,0xab,0x4b,
-0xe7,0x77,0x76,0x00,0x7f,0x63,0xfd,0xcc,0xcc,0xc0,0x4e,0x8b,0xef,0xc9,0x99,0xd6,
-0x00,0x3e,0xa1,0xae,0xaa,0xaf,0x60,0x5f,0xf5,0x06,0xef,0xaa,0xa4,0x01,0x6f,0x55,
-0xcf,0xed,0xff,0x20,0x00,0xf5,0x37,0xde,0xcf,0x72,0x00,0x0f,0x6d,0xda,0x76,0x8b,
-0xd2,0xec,0x4c,0xf0,0x07,0xbf,0xff,0xfe,0x00,0x59,0xf5,0x3b,0xc5,0x5b,0xe0,0x1f,
-0xff,0xfa,0xbb,0x44,0xbe,0x00,0x7b,0xf8,0x5b,0xff,0xff,0x96,0x77,0xf0,0x05,0xbb,
+0x5c,0xc3,0x9e,0xff,0xbb,0xa0,0x1f,0xe7,0x3d,0x71,0x7e,0xe4,0x00,0x13,0x64,0x53,
+0x00,0xf0,0x9b,0xff,0xfc,0x99,0xff,0xbf,0xf2,0x0d,0x4f,0x6c,0x25,0xf5,0x5f,0x20,
+0xd6,0xfa,0x80,0x1f,0x42,0xf2,0x9f,0xff,0xff,0xb8,0xfc,0x8f,0x21,0x6f,0xfe,0x55,
+0xdf,0x8d,0xf2,0x5f,0xaf,0xaf,0x18,0xf4,0x7f,0x28,0xa4,0xc2,0x50,0x6f,0x28,0xf2,
+0x3f,0xff,0xff,0x5f,0xfb,0xff,0x23,0xf7,0xf8,0xf8,0x5f,0x84,0xf2,0x3f,0x8f,0x9f,
+0x00,0xf2,0x1f,0x23,0xfe,0xfe,0xf1,0x6f,0x56,0xf2,0x3e,0x44,0x6d,0x1e,0xb4,0xfa,
+0x00,0x1f,0xff,0xff,0x8f,0xff,0xfe,0x00,0x5e,0x39,0xf0,0xbc,0x3b,0xe0,0x07,0xdf,
+0xef,0x39,0xff,0xde,0x00,0x95,0x02,0x64,0xd6,0x03,0x60,0x00,0xfe,0xde,0xfe,0xde,
+0xf0,0x00,0x0f,0xb9,0xbf,0xa9,0xcf,0x00,0x00,0xfa,0x7a,0xf9,0x7b,0xf0,0x00,0x0b,
+0xcf,0xcb,0xcf,0xcb,0x00,0x08,0xbc,0xfc,0xbc,0xfc,0xba,0x04,0xcc,0xdf,0xdc,0xdf,
+0xdc,0xc6,0x17,0xae,0xf6,0x27,0xff,0xb6,0x10,0xbb,0x71,0x00,0x01,0x5b,0x90,0x00,
+0x00,0x0e,0x90,0x00,0x32,0x00,0x06,0x66,0xfc,0x66,0x4e,0xc0,0x00,0xea,0x00,0x91,
+0xd1,0x00,0x11,0x11,0xfa,0x3d,0xe2,0x10,0x1f,0x6d,0x01,0xf0,0x17,0x80,0x44,0x5a,
+0xff,0x84,0x44,0x42,0x02,0x8e,0xff,0xeb,0xbb,0xb0,0x03,0xff,0xef,0x66,0x66,0xbf,
+0x00,0x04,0x19,0xfc,0xcc,0xce,0xf0,0x00,0x00,0x9f,0x55,0x55,0xbf,0x00,0x00,0x09,
+0xf5,0x55,0x5b,0x0d,0x00,0xf6,0x91,0xff,0xff,0xff,0x00,0x00,0x5f,0x10,0x00,0x06,
+0xd7,0x03,0xef,0xff,0xa7,0xcf,0xe8,0x10,0x15,0x9f,0x63,0xa9,0xf8,0x00,0x00,0xbd,
+0xfc,0x40,0x0e,0xb6,0x90,0x0a,0xcf,0xb4,0xae,0xff,0xff,0x22,0x59,0xf6,0x58,0xaf,
+0xa1,0x00,0x5f,0xff,0xfe,0x00,0xea,0x68,0x60,0x2f,0xfc,0x1c,0xef,0xff,0xd8,0x0c,
+0xff,0xfa,0x97,0xf9,0x00,0x07,0xf8,0xf6,0x60,0x0e,0x80,0x78,0x14,0x5f,0x10,0x00,
+0xeb,0x4c,0xa0,0x05,0xf1,0x00,0x08,0xff,0xe4,0x00,0x8f,0x00,0xdf,0xff,0xff,0x71,
+0xef,0xfe,0x7d,0xa7,0xf3,0xf7,0x05,0xbf,0x52,0xde,0xdf,0xcf,0x70,0x4a,0xf5,0x1d,
+0xed,0xfc,0xf7,0x0c,0xff,0xf3,0xdc,0x9f,0x7f,0x71,0x6b,0xf6,0x36,0x8a,0xf8,0x83,
+0x2b,0xef,0xd9,0xee,0xff,0xee,0xd0,0x1f,0xfd,0x3f,0x68,0xf8,0xae,0x0a,0xff,0xdc,
+0xf3,0x7f,0xcc,0xe4,0xfb,0xf4,0x5f,0xff,0xed,0xfe,0x18,0x8f,0x02,0xf3,0x00,0x18,
+0xe0,0x08,0xf0,0x2f,0x10,0x06,0xf9,0xe4,0x05,0xf3,0x42,0x30,0x00,0x20,0x06,0xff,
+0xff,0x1f,0x20,0x4d,0x00,0x2e,0xad,0xb9,0x9a,0x1c,0x7a,0x00,0xd6,0xbb,0xfc,0xd7,
+0xfc,0x90,0x0d,0xff,0x8c,0xf4,0x3a,0xf4,0x00,0xd9,0xd9,0xc9,0xc5,0xd9,0xd3,0x0d,
+0x9d,0xaf,0xed,0xcf,0xdc,0x80,0xdf,0xf8,0x84,0xa6,0xa3,0x81,0x0d,0x6b,0x8b,0x7e,
+0x7f,0x5f,0x11,0xda,0xed,0xbe,0xf7,0xfe,0xf1,0x7f,0xff,0xc5,0xaf,0x5f,0xaf,0x11,
+0x20,0xb8,0x3d,0xc2,0xf3,0x00,0x00,0x0b,0x86,0xb1,0x1f,0x30,0x58,0x00,0xf5,0x78,
+0x0c,0xcf,0xec,0x8a,0xff,0xf0,0x00,0x11,0xe9,0x10,0xd7,0x2f,0x21,0x07,0xaa,0xaa,
+0x8f,0x42,0xde,0x50,0x9d,0xec,0xf6,0xce,0xaf,0x70,0x0b,0xee,0xde,0x66,0xff,0xe4,
+0x11,0xf5,0x33,0x36,0xea,0x8b,0xf4,0x0c,0xdf,0xdc,0xcc,0xcf,0xec,0x40,0x04,0xfd,
+0xcc,0xcc,0xf9,0x00,0x00,0x4f,0x98,0x88,0x8f,0x90,0x00,0x04,0xfa,0x88,0x88,0xfa,
+0x00,0x1e,0xef,0xfe,0xff,0xff,0xff,0x50,0x55,0x44,0x43,0x32,0xea,0x10,0x00,0x00,
+0xf9,0x0f,0x80,0x42,0x00,0xff,0xff,0x90,0xfd,0xef,0x90,0x02,0x22,0xf9,0x0f,0xc4,
+0x02,0x02,0xac,0xef,0x90,0xfb,0x56,0xf5,0x19,0x64,0xf9,0x08,0xee,0xeb,0x10,0x09,
+0xef,0xee,0xee,0xeb,0x00,0x00,0xaf,0x44,0x44,0x4d,0xc0,0x00,0x0a,0xff,0xff,0xff,
+0xfc,0x00,0x00,0xaf,0x33,0x33,0x3d,0x0d,0x00,0xb3,0xae,0x00,0x03,0x5d,0xc0,0x00,
+0x0a,0xe0,0x00,0x6f,0xe6,0xfb,0x00,0x00,0xed,0x01,0xf0,0x28,0xf7,0x00,0x00,0x07,
+0xf4,0xe9,0x0f,0x98,0xf7,0x04,0xfd,0x8d,0xf2,0xff,0xc6,0x10,0x2e,0xcb,0x9f,0x6f,
+0x80,0x0a,0x20,0x45,0x55,0x60,0xfd,0x8a,0xf3,0x0e,0xff,0xff,0x07,0xcc,0xc9,0x00,
+0xeb,0x6b,0xf0,0xf8,0x02,0x00,0x0e,0xed,0xff,0x0f,0x98,0xfa,0x00,0xea,0x4a,0xf0,
+0xff,0xe8,0x10,0x0d,0x00,0xf1,0x00,0xa0,0x06,0x10,0xe7,0x5b,0xf0,0xfc,0x77,0xf6,
+0x0e,0x78,0xd8,0x08,0xee,0xec,0x94,0x07,0xf3,0x41,0x02,0x62,0x00,0xef,0xfe,0x19,
+0xbe,0xff,0xc0,0x0e,0x9a,0xe3,0xfd,0xa7,0x30,0x00,0xe5,0x6e,0x3f,0x10,0x02,0x10,
+0x0e,0xaa,0xe3,0xf2,0x5a,0xfc,0x00,0xef,0xfe,0x3f,0x8f,0xfd,0x50,0x0e,0x56,0xe4,
+0xf7,0xe7,0xb5,0x20,0xfa,0xbe,0x4f,0x7e,0x4f,0xf8,0x0f,0xff,0xe5,0xf6,0xe2,0xf7,
+0x00,0xf3,0x6e,0x7d,0x6e,0x0e,0x60,0x4f,0x16,0xea,0xa6,0xf6,0xad,0x07,0xf3,0xae,
+0xe7,0xaf,0xe5,0xf7,0x6a,0x4f,0x9e,0x27,0x70,0x08,0xdc,0x04,0x40,0x03,0x33,0x02,
+0x03,0x8f,0x07,0xfa,0x3d,0xf3,0xd6,0xf2,0xff,0xf1,0x0f,0x5f,0x6f,0x0a,0xaf,0x9f,
+0x10,0xf3,0xfe,0xa6,0x4f,0xf6,0xf1,0x0f,0x9f,0xb6,0xf4,0x8f,0x6f,0x10,0xff,0xf3,
+0xaf,0xd1,0xf6,0xf1,0x0f,0x3f,0x9f,0x3d,0xcf,0x6f,0x11,0xfa,0xff,0xa3,0x5d,0xf6,
+0xf1,0x1f,0xdf,0x6f,0xff,0x4f,0x6f,0x12,0xf1,0xf4,0xf1,0xe3,0xf6,0xf1,0x5e,0x0f,
+0x4f,0x0e,0x3f,0x95,0x08,0xc6,0xf4,0xff,0xf3,0xf4,0x00,0x68,0xcc,0x1e,0x5d,0x3f,
+0x40,0xea,0x07,0xb0,0x09,0xe2,0x00,0x00,0x05,0x55,0xde,0x55,0x55,0x01,0xff,0xca,
+0x04,0xb1,0x1f,0x82,0x22,0x22,0x9f,0x11,0xfb,0x77,0x77,0x7c,0xf1,0xfa,0x02,0x53,
+0x11,0xf7,0x00,0x00,0x08,0x0b,0x00,0x02,0x16,0x00,0x52,0x70,0x00,0x00,0x8f,0x11,
+0x2c,0x00,0x71,0xb7,0x77,0x77,0xcf,0x10,0x0c,0xff,0x19,0x04,0xf2,0x17,0x56,0x8f,
+0xe7,0x69,0x96,0x61,0x00,0x09,0xf5,0x00,0xee,0x20,0x00,0x06,0xfa,0x00,0x06,0xfe,
+0x20,0x02,0xff,0xfe,0xff,0xff,0xfe,0x10,0x07,0x87,0x8e,0x95,0x47,0x80,0x00,0x00,
+0x01,0xf7,0x00,0x00,0x94,0x04,0xa0,0x60,0x00,0x77,0x78,0xfb,0x77,0x73,0x00,0x00,
+0x00,0x4e,0x00,0x11,0x2f,0x41,0x00,0x20,0x91,0x77,0x01,0x00,0x13,0x74,0x96,0x00,
+0xf1,0x25,0x2b,0xe6,0xf8,0x57,0xff,0xa0,0x04,0xf1,0x0f,0xff,0x65,0xea,0x00,0x4f,
+0x01,0xf6,0x31,0x0d,0xa0,0x03,0xff,0x7f,0xa8,0x6f,0xfa,0x00,0x3f,0x42,0xbc,0xf4,
+0x4e,0xa0,0x02,0xf7,0x38,0x2f,0x56,0xf9,0x00,0x2f,0xd7,0xf3,0xf8,0xef,0x80,0x05,
+0xf6,0x5f,0x7f,0x74,0xfa,0x33,0x47,0x00,0xfa,0x05,0xfb,0x02,0x29,0xd3,0x24,0xfa,
+0x32,0x10,0x5d,0xfa,0x10,0x18,0xff,0x80,0x0c,0xb3,0x00,0x00,0x01,0xab,0xf1,0x00,
+0xf9,0x3f,0x08,0xd0,0x00,0x4f,0x40,0x00,0x06,0xdd,0x73,0x00,0xf9,0x00,0x00,0xed,
+0xbf,0xcf,0xff,0xff,0xf4,0x0e,0xc6,0xe8,0x55,0x55,0x55,0x10,0xea,0xce,0x63,0x88,
+0x88,0x00,0x3f,0x97,0xf6,0x6f,0xef,0xf0,0x0b,0xff,0xef,0x66,0xf0,0x6f,0x00,0x0f,
+0xb5,0xe6,0x7f,0x06,0xf0,0x00,0xf8,0xde,0x69,0xd0,0x6f,0x00,0x2f,0x22,0xe6,0xcb,
+0x06,0xf6,0x58,0xe0,0x4f,0xaf,0x60,0x6f,0xa7,0x99,0x0d,0xd8,0xd0,0x02,0xdd,0x20,
+0x5b,0x00,0xfb,0x3e,0x0b,0xb0,0x00,0x1f,0x60,0x00,0x06,0xec,0x63,0x22,0xcc,0x22,
+0x00,0xed,0xbf,0x9f,0xff,0xff,0xf3,0x0e,0xc6,0xe9,0xf4,0x22,0x5f,0x30,0xea,0xde,
+0x78,0xb3,0x01,0x61,0x3f,0x97,0xf5,0x2f,0x40,0x72,0x0b,0xff,0xef,0x52,0xf7,0xcf,
+0x80,0x0f,0xa4,0xe5,0x2f,0xfb,0x30,0x00,0xf9,0xce,0x52,0xf5,0x00,0x00,0x2f,0x25,
+0xe5,0x2f,0x40,0x0d,0x48,0xe0,0x4f,0x51,0xf9,0x56,0xf4,0x97,0x0d,0xd2,0x0a,0xff,
+0xfc,0x92,0x09,0x21,0x2e,0x70,0x4e,0x0a,0x00,0xe9,0x06,0xe1,0x00,0x1b,0xf7,0x56,
+0xef,0x20,0x00,0x3e,0xfc,0x66,0xaf,0xa6,0x62,0x05,0xf7,0x00,0xf2,0x00,0x60,0x02,
+0xf7,0x01,0xf7,0x02,0xf6,0x00,0x0f,0xb6,0x7f,0xa6,0x8f,0x60,0x00,0xdf,0x05,0x81,
+0x0f,0x70,0x00,0x00,0x17,0x60,0x00,0xf7,0xf1,0x02,0xf1,0x05,0x0e,0xd6,0x66,0x66,
+0x69,0xf5,0x00,0x4d,0xff,0xff,0xff,0xe9,0x00,0x00,0x0a,0xd0,0x00,0xea,0x00,0x03,
+0x3b,0x00,0xe1,0xf2,0x15,0x5c,0xe6,0x76,0xfc,0x55,0x10,0x00,0x57,0x5f,0x47,0x50,
+0x00,0x06,0x02,0xe2,0xf2,0x00,0x1f,0xa6,0x9f,0x86,0xaf,0x20,0x01,0xf6,0x05,0xf4,
+0x06,0xf2,0x62,0x00,0xf3,0x0c,0xf5,0x27,0x77,0x8f,0xff,0x97,0x77,0x20,0x00,0x3d,
+0xf7,0xee,0x40,0x00,0x38,0xdf,0xe4,0x01,0xdf,0xea,0x41,0xeb,0x60,0x00,0x00,0x6c,
+0xe1,0xa2,0x00,0x62,0x02,0x27,0xf4,0x22,0xdc,0x22,0x9d,0x06,0xf0,0x02,0xf7,0x03,
+0x38,0xf5,0x33,0xdc,0x33,0x10,0x00,0xda,0x54,0x47,0x74,0x42,0x00,0x8f,0x7f,0x44,
+0x05,0xf0,0x0f,0x5f,0xc0,0x22,0x22,0x2f,0x80,0x3f,0xfb,0x3f,0xff,0xf2,0xf7,0x01,
+0xde,0xb3,0xf6,0x7f,0x2f,0x70,0x00,0xbb,0x3f,0x78,0xf2,0xf7,0x00,0x0b,0xb3,0xff,
+0xff,0x0d,0x00,0x40,0x17,0x10,0x78,0xf7,0x46,0x01,0x32,0x0c,0xeb,0x20,0x78,0x05,
+0xf2,0x1f,0x71,0xdd,0xef,0xed,0xdf,0xfd,0xd6,0x00,0x03,0xe4,0x00,0xdc,0x60,0x00,
+0x8c,0xdd,0xef,0xff,0xfe,0x60,0x04,0xa9,0x78,0xc4,0x31,0xa6,0x00,0x0e,0xa0,0x5f,
+0x40,0x6f,0x50,0x00,0x7e,0x01,0xe5,0x09,0x90,0x00,0x67,0x66,0x7f,0xb6,0x66,0x63,
+0x34,0x00,0xf2,0x0b,0x70,0x01,0x8f,0xdf,0xdf,0xa2,0x00,0x2c,0xff,0x62,0xf7,0x3d,
+0xfd,0x50,0x86,0x00,0x2f,0x70,0x04,0x91,0x03,0x38,0xf4,0x33,0xdc,0x33,0x9c,0x00,
+0x72,0xf6,0x01,0x5b,0xd3,0x11,0xba,0x11,0x8b,0x02,0xf0,0x19,0xf0,0x0b,0xeb,0xb4,
+0x44,0x44,0xbf,0x02,0xe6,0xff,0xee,0xee,0x39,0xf0,0x01,0x5b,0x3e,0x93,0x30,0x9e,
+0x00,0x5e,0xee,0xff,0xee,0xba,0xd0,0x01,0x56,0x3e,0x94,0x73,0xbd,0x00,0x09,0xc1,
+0xe8,0x4f,0x3c,0xb0,0xd9,0x05,0x11,0xf5,0x3d,0x05,0x15,0x07,0x78,0x08,0x03,0x6f,
+0x00,0xf2,0x38,0xcc,0xdf,0xdc,0xcf,0xec,0xc5,0x00,0x25,0xe2,0x33,0xc9,0x00,0x00,
+0x5f,0x90,0x1e,0xe4,0x44,0x10,0x00,0x8f,0x5d,0xfd,0xde,0xfb,0x00,0x61,0x2d,0xee,
+0xd7,0xec,0x10,0x2d,0xf6,0x44,0x8f,0xff,0x94,0x00,0x07,0x2d,0xfd,0x72,0x6c,0xf9,
+0x00,0x2c,0x5f,0xff,0xff,0xf9,0x00,0x1d,0xd1,0xf8,0x11,0x2f,0x70,0x0d,0xe2,0x0f,
+0xec,0xcd,0xf7,0x00,0x64,0x00,0xfa,0x55,0x6f,0x70,0x4e,0x00,0xf4,0x38,0x61,0xdd,
+0xef,0xdd,0xdf,0xfd,0xd5,0x00,0x4b,0xe1,0x00,0xb9,0x00,0x00,0x0d,0xfb,0xbb,0xbb,
+0xbb,0xb1,0x09,0xfb,0xab,0xbe,0xca,0xcf,0x14,0xfe,0xdd,0xff,0xff,0xb6,0xf1,0x04,
+0x67,0x7d,0xc7,0x74,0x6f,0x10,0x0c,0xc7,0xdc,0x7d,0x87,0xf0,0x00,0xce,0xdf,0xed,
+0xf8,0x8f,0x00,0x0c,0xd9,0xed,0x9e,0x89,0xe0,0x00,0xca,0x3c,0xb5,0xd9,0xcc,0x00,
+0x0c,0x90,0xa8,0x5a,0xfe,0xc3,0x0a,0x11,0x6f,0x55,0x00,0xf2,0x0c,0x15,0xbb,0xef,
+0xbb,0xcf,0xdb,0xb0,0x00,0x08,0x96,0xd3,0xb3,0x00,0x00,0x4e,0xee,0xff,0xee,0xee,
+0x00,0x03,0x55,0x5a,0xf6,0x55,0x52,0x06,0x03,0x02,0xf1,0x12,0x02,0x9f,0xd6,0x56,
+0xff,0x70,0x00,0x4d,0xcc,0xbb,0xba,0xae,0x40,0x00,0xee,0xee,0xee,0xee,0xa0,0x00,
+0x0f,0x89,0xc4,0xf3,0xda,0x00,0x23,0xf9,0x9c,0x6f,0x4e,0xc3,0x19,0x27,0x00,0x13,
+0xf4,0xf1,0x00,0xf0,0x1d,0xbb,0xdf,0xbb,0xbf,0xeb,0xb5,0x00,0x15,0x91,0x11,0xc5,
+0x00,0x00,0x8e,0xcf,0xc9,0x6f,0x74,0x30,0x08,0xe9,0xcc,0x6d,0xdb,0xa9,0x00,0x8e,
+0xcc,0xfd,0xf3,0xf3,0x00,0x08,0xd7,0xf7,0x53,0x0a,0xb0,0x00,0x49,0x99,0x98,0x00,
+0x34,0x1d,0x0c,0x00,0x51,0x02,0xd1,0x0d,0x96,0xe2,0xe8,0x7f,0x20,0x14,0xea,0x8f,
+0x4e,0x98,0xf6,0x35,0x47,0x00,0x13,0xfc,0x4e,0x00,0xe0,0x44,0x6e,0x74,0x4f,0xd8,
+0xd2,0x07,0x17,0x77,0x77,0xbf,0x9f,0x60,0xe3,0x13,0x00,0xf9,0x26,0xf9,0x0e,0x3f,
+0x74,0x44,0x8f,0x33,0x20,0xef,0xf8,0xff,0xfa,0xf3,0xf2,0x01,0x1f,0x8d,0xbb,0x6f,
+0x9e,0x08,0xee,0xf8,0xd7,0xc9,0xfe,0xa0,0x3d,0x9f,0x7f,0xce,0x7e,0xf3,0x00,0xe5,
+0xf6,0xc9,0x91,0xdc,0x33,0x5d,0x6d,0x4e,0xee,0xff,0xfb,0xa1,0x27,0x80,0x00,0x3d,
+0x5b,0xf4,0x94,0x01,0xf0,0x3b,0x61,0xcc,0xef,0xdc,0xcf,0xfc,0xc5,0x01,0x25,0xa4,
+0x02,0x97,0x22,0x00,0x9f,0xac,0xf2,0xfd,0xad,0xe0,0x09,0xfa,0xbf,0x2f,0xda,0xde,
+0x00,0x9f,0xdd,0xd7,0xdd,0xdf,0xe0,0x09,0xd5,0xbb,0xfc,0xba,0x8e,0x00,0x9d,0x2c,
+0xcf,0xdc,0x68,0xe0,0x09,0xd3,0xc8,0xd8,0x98,0x8e,0x00,0x9d,0x2d,0xef,0xfd,0x78,
+0xe0,0x09,0xd5,0xda,0xfa,0xd5,0xbe,0x00,0x9d,0x24,0x0c,0x23,0x6e,0x80,0x2f,0xff,
+0x0d,0x08,0xfb,0x39,0x02,0xe1,0x6c,0x00,0x0f,0x93,0x30,0x2e,0x05,0xc2,0x44,0xfa,
+0x44,0x22,0xfb,0xcc,0x7f,0xef,0xfe,0xf9,0x26,0x66,0x57,0xf5,0xfb,0x7d,0x4c,0xff,
+0xff,0x9f,0x6f,0xa5,0x80,0x2e,0x93,0x38,0xe0,0xcf,0xfd,0x01,0xfd,0xb7,0x9d,0x15,
+0x65,0x00,0x18,0x8e,0x8a,0xc7,0xff,0xc0,0x00,0x00,0xd7,0xd9,0x98,0x8c,0x35,0x02,
+0x4f,0x8f,0x8f,0x48,0xea,0xb0,0x6f,0xc5,0xd8,0xa0,0x5e,0xe5,0xd2,0x03,0x50,0x99,
+0x00,0x08,0xf3,0x20,0x07,0x00,0xf0,0x3e,0x5f,0xff,0xfc,0x00,0x2d,0xfe,0xda,0xff,
+0xb6,0xf4,0x00,0x2f,0xba,0xf5,0x83,0xff,0x90,0x00,0x2e,0x76,0xe5,0x9e,0xfd,0xfd,
+0x70,0x2e,0x76,0xed,0xe9,0x7a,0x6d,0x90,0x2f,0xff,0xf3,0xbd,0xef,0xdd,0x20,0x19,
+0xbb,0x70,0x59,0xcf,0x99,0x00,0x00,0x99,0xf3,0x7f,0xff,0xfe,0x00,0x00,0xab,0xe8,
+0x44,0xaf,0x44,0x30,0x5e,0xff,0xfe,0xdd,0xef,0xdd,0x90,0x25,0x30,0x34,0x00,0x8e,
+0x00,0x00,0x00,0xb8,0x07,0x80,0x08,0xf0,0x00,0x0b,0x80,0x7e,0x3f,0x88,0xf0,0x2f,
+0xff,0xf7,0xff,0xff,0xff,0x02,0xfc,0xbf,0x0d,0x00,0x21,0x2e,0x86,0x0d,0x00,0xf0,
+0x1e,0xe8,0x6f,0x08,0xf5,0x8a,0x00,0x2f,0xff,0xf4,0xff,0xfd,0x61,0x02,0xbc,0xb7,
+0x19,0xfb,0x4c,0xc0,0x00,0xba,0xe9,0xff,0xff,0xce,0x62,0x7e,0xff,0x4c,0x5d,0x9a,
+0x60,0x6f,0xc9,0xad,0xf5,0xe9,0x7e,0x10,0x00,0x00,0x74,0xee,0x40,0x81,0xf0,0x07,
+0x00,0x19,0x30,0x00,0x00,0x00,0x00,0x0b,0xf3,0x5f,0xff,0xff,0xe0,0x0b,0xf8,0x02,
+0x77,0x77,0x77,0x07,0xfb,0x31,0x13,0x00,0x30,0x1b,0x1e,0xe0,0x07,0x00,0xf1,0x0c,
+0x09,0xf6,0x78,0x88,0x88,0x82,0x07,0xff,0x0e,0xff,0xff,0xff,0x46,0xff,0xe0,0x00,
+0x01,0xf7,0x00,0x3c,0xbe,0x00,0x00,0x1f,0x70,0x00,0x09,0x0d,0x00,0x23,0x00,0x9e,
+0x0d,0x00,0x21,0x01,0x9a,0x0d,0x00,0xf0,0x89,0x0d,0xeb,0x10,0x00,0x00,0x84,0x08,
+0x50,0x00,0x00,0x00,0x7f,0x4c,0xfe,0xd4,0xdf,0xf3,0x6f,0xa0,0x3f,0x6e,0x55,0x55,
+0x16,0xc7,0x9e,0xfe,0xfe,0x10,0x00,0x02,0xfc,0xaa,0xaa,0xa0,0x00,0x00,0x9f,0x3b,
+0xcc,0xc9,0xff,0xf6,0x5f,0xf2,0xe5,0x2a,0xa7,0xfb,0x29,0xff,0x2e,0xff,0xf9,0x0e,
+0x80,0x27,0xf3,0x44,0xea,0x30,0xe8,0x00,0x3f,0x7f,0xff,0xfe,0x0e,0x80,0x03,0xf2,
+0xf5,0xd9,0x20,0xe8,0x00,0x3f,0x4e,0xef,0xff,0x9f,0x80,0x03,0xf2,0x00,0xd7,0x0d,
+0xc2,0x00,0x00,0x73,0x01,0x36,0x30,0x00,0x00,0x6f,0x7f,0xff,0xd8,0xcf,0xf2,0x5f,
+0xb1,0x67,0xf5,0x45,0x66,0x17,0xd7,0x7f,0xff,0xff,0x00,0x00,0x03,0xfc,0x46,0xf5,
+0x40,0x00,0x00,0x8f,0x4e,0xef,0xec,0xff,0xf6,0x4f,0xf2,0xf9,0xf9,0xd5,0xfb,0x29,
+0xff,0x2f,0x8f,0x9d,0x0e,0x80,0x16,0xf2,0xee,0xfe,0xc0,0xe8,0x00,0x3f,0x28,0xaf,
+0x97,0x55,0x00,0xf0,0x18,0x79,0xf8,0x60,0xe8,0x00,0x3f,0x5c,0xdf,0xef,0x7f,0x70,
+0x03,0xf3,0x65,0x43,0x1d,0xe3,0x00,0x00,0x11,0x15,0xf4,0x11,0x10,0x00,0xaf,0xff,
+0xff,0xff,0xff,0xc0,0x02,0x55,0x58,0xf7,0x55,0x53,0x00,0x0f,0x0d,0x00,0x90,0x40,
+0x02,0x44,0x47,0xf7,0x44,0x42,0x03,0xff,0x01,0x00,0xfb,0x1a,0xf3,0x02,0x26,0xee,
+0xbf,0x42,0x74,0x00,0x29,0xfe,0x21,0xf9,0x8f,0xa0,0x6f,0xff,0xb0,0x08,0xff,0x60,
+0x00,0x61,0xeb,0x38,0x7c,0xf8,0x00,0x00,0x4f,0xff,0xf8,0x0a,0xff,0x50,0x03,0xe9,
+0x40,0x00,0x04,0xa0,0x00,0x01,0x00,0x51,0x8f,0x30,0x00,0x00,0x2f,0x42,0x00,0xf3,
+0x81,0x00,0x34,0x55,0x55,0x55,0x54,0x30,0x00,0x6f,0xff,0xff,0xff,0x70,0x01,0x8b,
+0xf7,0x66,0x67,0xfc,0x82,0x19,0xcf,0x88,0x88,0x8f,0xc9,0x20,0x06,0xfe,0xdd,0xde,
+0xf7,0x00,0x00,0x17,0xfe,0x8f,0x84,0xb6,0x00,0x5b,0xff,0x20,0xce,0xce,0x50,0x4f,
+0xcc,0xe1,0x46,0xef,0x81,0x00,0x10,0xcf,0xff,0x92,0xcf,0xf5,0x00,0x08,0x84,0x10,
+0x00,0x48,0x00,0x02,0xc2,0x00,0x00,0xe8,0x00,0x00,0x0c,0x90,0x25,0x5f,0xb5,0x62,
+0x5f,0xff,0x97,0xff,0xff,0xff,0x52,0x67,0xf6,0x7e,0x0e,0x86,0xf1,0x00,0x8e,0x27,
+0xe0,0xe8,0x48,0x00,0x3f,0xae,0xcf,0xff,0xff,0xe0,0x2e,0xff,0x99,0xff,0x65,0xeb,
+0x07,0xef,0xde,0xbb,0xd9,0x5f,0x50,0x12,0xf6,0x6e,0x85,0xfe,0xc0,0x00,0x0f,0x63,
+0xf5,0x3f,0xf8,0x00,0x00,0xf6,0xce,0xaf,0xdb,0xfe,0x40,0x0f,0x68,0x59,0x70,0x04,
+0xc2,0xa1,0x00,0xf0,0x1a,0x4b,0x10,0x00,0x0f,0x7c,0x80,0x01,0xf7,0x05,0x56,0xfa,
+0x9f,0x74,0xce,0xd6,0xff,0xff,0xff,0xfb,0x28,0xaf,0x41,0x12,0xf7,0x11,0x00,0x0b,
+0xc1,0xcf,0xff,0xff,0xf4,0x04,0xfa,0xed,0xb4,0xf9,0x5f,0x41,0xef,0xf7,0x0d,0x00,
+0x90,0x9e,0xfc,0xcc,0xb3,0xf8,0x5f,0x42,0x4f,0x51,0x0d,0x00,0xc0,0x01,0xf4,0x0c,
+0xb4,0xf9,0x6f,0x40,0x1f,0x40,0xca,0x0f,0x77,0x0d,0x00,0x42,0xa0,0xf6,0xed,0x10,
+0x54,0x00,0xf1,0x1f,0x08,0x70,0xf5,0x00,0xbd,0x00,0x00,0xac,0x7f,0x75,0x5d,0xe5,
+0x52,0x07,0xbc,0xf9,0xff,0xff,0xff,0x81,0x99,0xaf,0x50,0x0b,0xd0,0x00,0x1c,0xfa,
+0xf5,0x55,0xde,0x55,0x11,0xda,0x0f,0x5e,0xff,0xff,0xf3,0x1a,0x22,0x98,0xe5,0x22,
+0x22,0x12,0x1e,0x01,0xf2,0x0e,0xf9,0x01,0x4a,0xfa,0x5f,0x53,0xda,0x02,0xfe,0xed,
+0x00,0x9f,0xf9,0x10,0x01,0x0c,0xea,0xd5,0x9f,0xd7,0x20,0x01,0xfd,0x96,0x10,0x3a,
+0xf6,0x00,0x01,0x56,0x00,0x11,0x01,0x5e,0x00,0xf1,0x1f,0xba,0xb9,0x00,0x2f,0x57,
+0xe0,0x3f,0xff,0xfe,0xb2,0xf5,0x7e,0x04,0xe8,0xec,0x88,0x2f,0x57,0xe0,0x38,0x8e,
+0xc8,0x82,0xf5,0x7e,0x00,0xef,0xff,0xfe,0x04,0x17,0xe0,0x0e,0x4b,0xaf,0xe0,0x1f,
+0xfd,0x00,0x21,0x75,0x5f,0x50,0x78,0x30,0x6f,0x5c,0x00,0xf5,0x0c,0x71,0x35,0xaf,
+0xd9,0xf6,0x5d,0xb1,0x4e,0xff,0xb0,0x0b,0xff,0xb2,0x00,0x52,0xfc,0xac,0x0a,0xfe,
+0x93,0x00,0x3f,0xc8,0x40,0x03,0x9d,0x30,0xa8,0x01,0x00,0x5c,0x00,0xf3,0x3f,0x3f,
+0x20,0x0d,0xb0,0x00,0x00,0x00,0xc6,0x06,0xff,0xff,0xff,0x39,0xff,0xfa,0xfe,0x77,
+0x77,0x61,0x36,0x7f,0x9e,0xfc,0xcc,0xf8,0x00,0x09,0xd3,0x5f,0xbb,0xbf,0x80,0x04,
+0xfa,0xf7,0xf6,0x55,0xf8,0x03,0xff,0xf6,0x5f,0xff,0xff,0x80,0xcf,0xfe,0xd0,0x6f,
+0xa4,0x51,0x05,0x3f,0x69,0x7f,0xec,0xef,0x60,0x00,0xf5,0x4f,0xbf,0x8f,0xa0,0x00,
+0x0f,0x51,0x69,0xff,0xf9,0x61,0x00,0xf5,0x5d,0x94,0x17,0xbd,0x10,0x00,0x02,0x01,
+0x82,0x00,0xf1,0x06,0x14,0x77,0x7e,0xc8,0xfa,0x77,0x70,0x00,0x00,0xd8,0x1f,0x50,
+0x00,0x00,0x56,0x6e,0xb7,0xf9,0x66,0x30,0x0e,0xf7,0x00,0xf3,0x12,0x00,0xe9,0x0f,
+0x71,0xf6,0x0f,0x90,0x0e,0x96,0xf3,0x1f,0x72,0xf9,0x00,0xee,0xf9,0x00,0xef,0xff,
+0x90,0x0e,0xb6,0x00,0x01,0x44,0xf9,0x00,0xea,0x11,0x11,0x11,0x1f,0x90,0x27,0x00,
+0x71,0xeb,0x55,0x55,0x55,0x5f,0x90,0x0f,0x4e,0x00,0xf0,0x00,0x50,0x55,0x5b,0xf5,
+0xce,0x55,0x51,0x01,0x44,0xae,0x4b,0xd4,0x43,0x00,0x5f,0x13,0x00,0xf3,0x05,0xe0,
+0x05,0xf1,0x8e,0x09,0xd0,0x9e,0x00,0x5f,0xef,0xfe,0xff,0xef,0xe0,0x02,0x44,0x8f,
+0x94,0x44,0x44,0x59,0x01,0xf4,0x0a,0x03,0x3c,0xf6,0x34,0xee,0x43,0x20,0x03,0xef,
+0xfc,0xcf,0x40,0x00,0x03,0x46,0xaf,0xff,0xff,0xa5,0x00,0xaf,0xec,0x83,0x03,0x8e,
+0xac,0x02,0x02,0x9f,0x02,0xf4,0x39,0x20,0x11,0x1c,0xa1,0xda,0x11,0x10,0x09,0xfd,
+0xff,0xdf,0xfd,0xfb,0x00,0x9e,0x9e,0xd9,0xed,0x9e,0xb0,0x02,0xab,0x4b,0xe7,0x77,
+0x76,0x00,0x7f,0x63,0xfd,0xcc,0xcc,0xc0,0x4e,0x8b,0xef,0xc9,0x99,0xd6,0x00,0x3e,
+0xa1,0xae,0xaa,0xaf,0x60,0x5f,0xf5,0x06,0xef,0xaa,0xa4,0x01,0x6f,0x55,0xcf,0xed,
+0xff,0x20,0x00,0xf5,0x37,0xde,0xcf,0x72,0x00,0x0f,0x6d,0xda,0x76,0x8b,0xd2,0x51,
+0x01,0xf3,0x3f,0x6f,0x00,0xbf,0xff,0xfe,0x00,0x59,0xf5,0x3b,0xc5,0x5b,0xe0,0x1f,
+0xff,0xfa,0xbb,0x44,0xbe,0x00,0x7b,0xf8,0x5b,0xff,0xff,0xe0,0x00,0x6f,0x00,0xbb,
 0x44,0xbe,0x04,0xef,0xfe,0xcb,0xed,0xde,0xe0,0x16,0xbf,0x75,0xbc,0x66,0xce,0x00,
-0x0b,0xfa,0x0b,0x92,0x72,0xf4,0x0a,0xfc,0xf7,0x0f,0x7e,0x80,0x00,0x5f,0x38,0xb5,
+0x0b,0xfa,0x0b,0xff,0xff,0xd0,0x00,0xfc,0xf7,0x0f,0x7e,0x80,0x00,0x5f,0x38,0xb5,
 0xf3,0xe8,0x10,0x2e,0xb0,0x04,0xec,0x0e,0xbc,0x81,0xb1,0x00,0xec,0x10,0x9f,0xe4,
-0x80,0x1a,0x12,0x22,0x6c,0x13,0x20,0xd0,0x0e,0x2e,0x00,0xf0,0x23,0x5e,0x10,0xe9,
-0x33,0xbd,0x06,0xff,0xff,0x3e,0x93,0x3b,0xd0,0x5c,0xcd,0xf3,0xef,0xee,0xfd,0x00,
-0x01,0xda,0x0e,0x93,0x3b,0xd0,0x00,0xbf,0x40,0xef,0xee,0xfd,0x02,0xdf,0xfe,0x2e,
-0xa4,0x4b,0xd0,0x9f,0xdf,0xd7,0xef,0xff,0xfd,0x02,0x29,0xe2,0x02,0xf3,0xe7,0x9d,
-0x04,0xe8,0x8f,0x0e,0x75,0x30,0x09,0xe1,0x8f,0x80,0xeb,0xc9,0x00,0x9e,0x2d,0x60,
-0x68,0x67,0x00,0x60,0x02,0xf0,0x0a,0x9e,0x0e,0x90,0xbf,0x99,0x92,0x09,0xe0,0xe9,
-0x1f,0xdb,0xbb,0x30,0x9e,0x0e,0x9b,0xf2,0xd7,0x00,0x07,0xb0,0xe9,0xa9,0x0b,0xf1,
-0x47,0xb0,0x22,0x00,0x35,0x5c,0x3a,0x10,0xf0,0xc7,0x9f,0x00,0xb3,0x8d,0x30,0xad,
-0x05,0xe6,0x76,0x9d,0xf7,0x06,0xd0,0x7f,0x92,0x9f,0x00,0x00,0x22,0x3e,0xef,0x70,
-0x06,0x00,0x26,0xbf,0xc3,0xfa,0x45,0xf4,0x0b,0xfb,0x50,0xdb,0x09,0x23,0x02,0xb4,
-0x09,0x66,0x00,0x01,0x0d,0xb1,0x93,0x38,0xf7,0x00,0x03,0xff,0x20,0x0d,0xe1,0x00,
-0x2e,0xa6,0x08,0xe1,0x0a,0xdf,0x55,0xfc,0x56,0xf6,0x00,0x9f,0x55,0xfc,0x57,0xf6,
-0x00,0xaf,0xd1,0x09,0x71,0xbe,0x00,0xea,0x02,0xf6,0x00,0xdf,0xc4,0x08,0x10,0xfa,
-0x1e,0x00,0xb4,0x0a,0xf2,0x00,0xea,0x69,0xf6,0x0b,0x80,0x00,0xea,0x9f,0x3e,0x2e,
-0x12,0x92,0xd7,0x18,0xf0,0x1a,0x30,0x09,0xff,0xff,0xf0,0x0a,0xff,0xf7,0x27,0xf5,
-0x8f,0x01,0xf9,0x5f,0x30,0x8d,0x06,0xf0,0xaf,0xcd,0xfb,0x5f,0x84,0xbd,0x04,0xfa,
-0xf9,0xfc,0xb0,0x9e,0x60,0x0e,0xbf,0xaf,0x3f,0x4f,0x60,0x00,0xeb,0xfb,0xf7,0xe1,
-0x2a,0xf1,0x0d,0x6e,0x4f,0xdb,0x5f,0x95,0x00,0xff,0xff,0xf6,0x86,0xfa,0x52,0x1f,
-0x4e,0x5f,0x9f,0xff,0xff,0x56,0xe0,0xe7,0xf1,0x00,0xf6,0x00,0x88,0x04,0xbb,0xc8,
-0x43,0x02,0xae,0x00,0x02,0x3a,0x0c,0xfa,0x3d,0x8c,0x53,0x5f,0xff,0xff,0xf1,0x0d,
-0xff,0xd5,0xf5,0xbb,0x7f,0x15,0xe0,0xc6,0x5f,0xde,0xed,0xf1,0xbf,0xef,0xe5,0xbf,
-0x87,0x77,0x02,0xe9,0x9e,0x3e,0xfd,0xdd,0xd2,0x0e,0x89,0xed,0xfb,0xcb,0xbf,0x20,
-0xef,0xff,0xca,0x7d,0x43,0xf2,0x0f,0x89,0xe5,0xf9,0xec,0x7f,0x10,0xff,0xff,0x5f,
-0xef,0xf8,0xf1,0x2e,0x58,0xe2,0x04,0xca,0x5f,0x07,0xb5,0x9f,0x8e,0xfe,0xeb,0xe0,
-0x66,0x17,0xd1,0x10,0x03,0x01,0x5a,0x04,0x9f,0x4e,0x63,0x33,0x34,0xfd,0x43,0x33,
-0x22,0xc0,0x6c,0x51,0x13,0x33,0x33,0x33,0x30,0x3a,0x11,0x11,0xfe,0xcf,0x47,0x24,
-0x22,0x20,0x0d,0x00,0x02,0x8f,0x80,0x12,0x07,0x00,0x2f,0x11,0x7f,0x02,0x46,0x21,
-0x07,0xf6,0x7f,0x01,0x54,0x7f,0xed,0xdd,0xde,0xf0,0x1b,0x02,0x20,0x09,0xc0,0xf6,
-0x6c,0x00,0xba,0xb3,0x10,0x8f,0x16,0x2c,0x90,0xf3,0x08,0xf1,0x00,0x04,0x44,0x44,
-0x00,0x8f,0xda,0x05,0xf0,0x05,0xa7,0x8c,0xf9,0x84,0x04,0x66,0x64,0xcf,0xff,0xff,
-0x70,0xaf,0xff,0xa0,0x08,0xf1,0x00,0x03,0x55,0x53,0x1a,0x00,0x91,0x9f,0xef,0xb0,
-0x08,0xf1,0x00,0x09,0xa0,0x9b,0x0d,0x00,0x11,0xff,0x0d,0x00,0x22,0xc4,0x43,0x67,
-0x84,0x01,0xc3,0x50,0x12,0x63,0x70,0x02,0x20,0xb0,0x0a,0xdb,0x16,0x60,0x7d,0x11,
-0x47,0x77,0xcf,0x07,0xc2,0x02,0x50,0x09,0xf0,0x14,0x44,0x42,0x52,0x3a,0xf1,0x08,
-0xdf,0xff,0x41,0x22,0x2a,0xf0,0x04,0x44,0x42,0x9f,0xff,0xff,0x01,0xff,0xff,0x79,
-0xf4,0x4b,0xf0,0x03,0x44,0x41,0x9f,0x26,0x2f,0xf4,0x09,0x49,0xf0,0x00,0x10,0x0e,
-0x61,0xf4,0x9f,0x00,0x0c,0x80,0xef,0xef,0x48,0xf9,0x89,0xf7,0x0e,0x94,0x41,0x2c,
-0xee,0xeb,0x10,0x71,0x13,0xa0,0x10,0x00,0x1d,0x40,0x00,0x00,0xe5,0x00,0x00,0xd9,
-0xc2,0x0e,0x00,0xc5,0x2b,0x90,0x36,0x66,0x54,0x8f,0xc8,0x88,0x22,0xff,0xf9,0xcc,
-0x0b,0xf0,0x0f,0x16,0x66,0x40,0x0f,0xff,0xfb,0x02,0xdd,0xd8,0x02,0xf9,0x7d,0xb0,
-0x04,0x44,0x20,0x5f,0x00,0xca,0x02,0xff,0xf9,0x0a,0xc0,0x0d,0x90,0x2f,0x09,0x92,
-0xf8,0x73,0x9c,0xa5,0xfa,0xde,0x15,0x7f,0x60,0x2f,0x54,0x4d,0x40,0xbf,0xfc,0x1d,
-0x13,0x22,0x3b,0x18,0x90,0x04,0xff,0xff,0x10,0x03,0x7d,0x42,0x5f,0x79,0xd8,0x51,
-0xf0,0x0b,0xc7,0xe0,0x5f,0x10,0x04,0x44,0x44,0xdb,0x04,0xf5,0x20,0xbf,0xff,0xdf,
-0x30,0x1e,0xf7,0x04,0x55,0x54,0x85,0x55,0x55,0x00,0xbf,0xff,0x68,0x98,0xf0,0x03,
-0x03,0x44,0x42,0xcc,0x34,0xfa,0x00,0xaf,0xff,0x44,0xf6,0xaf,0x20,0x0a,0x90,0xf4,
-0x0a,0xff,0x29,0x9d,0xba,0xad,0xfd,0xff,0xd7,0x0a,0xb4,0x47,0xd5,0x01,0x9e,0x40,
-0x09,0x59,0x31,0x40,0x00,0x6c,0x2a,0x26,0x20,0x03,0xf7,0xd1,0x02,0xd0,0x7a,0xae,
-0xba,0xa0,0x24,0x44,0x46,0xcd,0xfe,0xcc,0x11,0xff,0xff,0x9a,0x41,0x50,0x03,0x33,
-0x30,0x00,0xf8,0xc1,0x19,0xb2,0x3e,0xef,0xfe,0xb0,0x03,0x33,0x32,0xaa,0xfd,0xa8,
-0x01,0x1a,0x00,0x20,0x1f,0x47,0xad,0x29,0x11,0x01,0x91,0x1e,0x40,0xf5,0x1f,0x62,
-0x24,0x25,0x21,0x05,0x22,0x52,0x10,0x09,0xa4,0x2a,0x61,0xd6,0x00,0xec,0x44,0x44,
-0x0a,0x21,0x00,0xf6,0x2c,0xf2,0x36,0x66,0x7f,0xc1,0x11,0x6f,0x12,0xff,0xfb,0xbf,
-0xff,0x55,0xf1,0x15,0x55,0x34,0xe4,0xf5,0x6f,0x02,0xff,0xf9,0x4f,0xbf,0x56,0xf0,
-0x04,0x44,0x24,0xfa,0xf5,0x7f,0x02,0xff,0xf9,0x4e,0x7f,0x59,0xe0,0x2f,0x09,0x94,
-0xd8,0x82,0xbd,0x02,0xff,0xf9,0x00,0x06,0x6f,0xa0,0x2f,0x54,0x20,0x00,0xef,0xe3,
-0x2a,0x06,0x01,0xcc,0x65,0x50,0x20,0x00,0x01,0xf8,0x80,0xa8,0x72,0xc0,0x1f,0x9f,
-0x44,0xbd,0xca,0x57,0x78,0xfa,0xc5,0x38,0x88,0x7b,0xdb,0x1d,0xf1,0x21,0xcd,0xda,
-0x00,0x00,0xf6,0x00,0x07,0x88,0x6c,0xff,0xbf,0x70,0x00,0xab,0xb8,0x5d,0xc4,0xf8,
-0x00,0x04,0x44,0x30,0xca,0x0d,0x90,0x00,0xdf,0xfc,0x0c,0xa0,0xbb,0x00,0x0d,0x68,
-0xd6,0xee,0xdb,0xe6,0x70,0xdf,0xfc,0xec,0x83,0x5f,0xc9,0x0d,0x94,0x30,0x34,0xb0,
-0x17,0x00,0x04,0x7a,0xf0,0x1a,0x2d,0x20,0x01,0x36,0x9d,0x40,0x00,0xd8,0x04,0xff,
-0xfe,0x94,0x0a,0xdf,0xdd,0x33,0x1f,0x70,0x00,0x46,0x66,0x62,0x11,0xf8,0x11,0x03,
-0xff,0xfc,0xbf,0xff,0xff,0xf5,0x15,0x55,0x43,0x55,0xfa,0x55,0x13,0xff,0xfc,0xa1,
-0x0d,0xf0,0x04,0x14,0x44,0x41,0xaa,0xfd,0xa7,0x03,0xff,0xfd,0x1f,0xdc,0xcf,0xb0,
-0x3f,0x18,0xd1,0xf4,0x00,0xcb,0x0d,0x00,0x93,0xff,0xff,0xb0,0x3f,0x32,0x21,0xf9,
-0x77,0xeb,0x19,0x5b,0x04,0x5b,0x00,0xf0,0x06,0x10,0x1b,0x40,0x0c,0x90,0x00,0xe8,
-0x00,0xcd,0x04,0xf6,0x0a,0xde,0xdd,0x6a,0xf8,0xaf,0x71,0x56,0x66,0x6a,0x35,0x17,
-0x20,0xee,0xea,0x4c,0x01,0x30,0x28,0x88,0x53,0x03,0x0f,0x81,0xbb,0xb8,0x17,0x7f,
-0xc7,0x50,0x14,0x44,0x73,0x01,0xf1,0x00,0xfe,0xfc,0x8b,0xbf,0xdb,0xb3,0x4f,0x08,
-0xc6,0x88,0xfc,0x88,0x24,0xff,0xfc,0xa0,0x9f,0x26,0x44,0x30,0xc1,0x4c,0x04,0x77,
-0x02,0x10,0x30,0xbc,0x0e,0x90,0x00,0xc9,0x04,0x56,0xf9,0x55,0x27,0xff,0xfe,0x5e,
-0x25,0x30,0x25,0x55,0x40,0xb8,0x46,0x90,0xff,0xf8,0x36,0x7f,0xa6,0x60,0x06,0x66,
-0x37,0x57,0x16,0x21,0xdd,0xd7,0xe0,0xae,0xf4,0x10,0x44,0x22,0x2e,0xbf,0x44,0x00,
-0xff,0xf9,0xbb,0xf4,0x27,0xf1,0x0f,0x29,0xaf,0x8f,0x45,0x9e,0x70,0xff,0xfb,0xc2,
-0xfb,0xcb,0x85,0x0f,0x64,0x20,0x08,0xcb,0x30,0x25,0xad,0x30,0x5f,0x30,0x5f,0xe2,
-0x29,0xf4,0x37,0xd4,0x01,0x55,0xf8,0x9f,0x0b,0xff,0xff,0x5e,0x5f,0x37,0xf0,0x35,
-0x55,0x5d,0x8a,0xe0,0x8e,0x02,0xff,0xfa,0x45,0xf7,0x4c,0xc0,0x16,0x66,0x45,0xfb,
-0x0e,0xf5,0x02,0xff,0xfa,0x18,0x17,0x00,0x00,0x04,0x44,0x33,0x49,0xf6,0x43,0x03,
-0xff,0xfb,0xdc,0xe7,0xd8,0xc0,0x3f,0x08,0xdf,0x9e,0x01,0x9f,0x43,0xff,0xff,0xd6,
-0xf4,0x5f,0x94,0x3f,0x54,0x30,0x2f,0xff,0xb0,0xc1,0x01,0x12,0x50,0x9d,0x06,0xf0,
-0x06,0x60,0xaf,0xff,0xff,0xf0,0x12,0xc8,0x23,0x4e,0xc4,0x44,0x0c,0xff,0xff,0x54,
-0xeb,0x44,0x10,0x46,0x66,0x66,0x4d,0x4b,0xf0,0x17,0xff,0xfc,0x04,0xf3,0x2f,0x30,
-0x15,0x55,0x46,0xaf,0x78,0xf8,0x23,0xff,0xfc,0xdd,0xdd,0xdd,0xd5,0x15,0x55,0x52,
-0x88,0x88,0x85,0x03,0xff,0xfd,0x5f,0xdc,0xcf,0xa0,0x3f,0x17,0xd5,0xf1,0x00,0xda,
-0x0d,0x00,0x93,0xee,0xef,0xa0,0x3f,0x32,0x25,0xf7,0x66,0xea,0x66,0x01,0x23,0x01,
-0x70,0x5b,0x00,0x10,0x4f,0xcd,0x03,0xf0,0x0d,0xc5,0x04,0xf6,0x44,0xbe,0x0c,0xff,
-0xff,0x7f,0x20,0x08,0xe0,0x47,0x77,0x65,0xfe,0xdd,0xfe,0x03,0xee,0xea,0x16,0x66,
-0x66,0x50,0x18,0x88,0x58,0xfe,0x69,0xf0,0x00,0xcc,0xc8,0x36,0x6f,0xc6,0x61,0x14,
-0x44,0x34,0x44,0xfa,0x44,0x23,0xff,0xfc,0x5f,0x67,0xfa,0x04,0x3f,0x08,0xc0,0x1c,
-0xff,0x50,0x03,0xff,0xfd,0x7d,0xf3,0x9f,0xa3,0x3f,0x54,0x3a,0xb3,0x00,0x7e,0x70,
-0x31,0xf7,0x3e,0x2d,0x10,0x05,0x70,0xc2,0x00,0x00,0xd7,0x00,0xd8,0x09,0xc0,0x09,
-0xdf,0xdd,0xae,0x00,0x1e,0xa0,0x46,0x66,0xaf,0xb7,0x77,0xbf,0x42,0xff,0xfa,0x7f,
-0xed,0xdf,0x80,0x15,0x55,0x32,0xf3,0x00,0xf6,0x02,0xff,0xf9,0x2f,0xba,0xaf,0x60,
-0x04,0x44,0x32,0xdf,0xdf,0xc4,0x02,0xff,0xfb,0x08,0xf4,0xf2,0x00,0x2f,0x08,0xb0,
-0xdc,0x3f,0x29,0x22,0xff,0xfc,0xaf,0x53,0xf6,0xf4,0x2f,0x54,0x5e,0x60,0x1e,0xfe,
-0x16,0x75,0x01,0x2d,0x80,0x10,0x7f,0x6c,0x01,0xf8,0x37,0xb6,0x07,0xd5,0x65,0x7f,
-0x18,0xff,0xff,0x7c,0x1c,0x72,0xf1,0x25,0x55,0x57,0xcb,0xff,0x7f,0x10,0xff,0xf9,
-0x7c,0x1c,0x63,0xf1,0x06,0x66,0x47,0xce,0xff,0xbf,0x10,0xff,0xf9,0x8b,0x11,0x12,
-0xf1,0x04,0x44,0x39,0xad,0xff,0x8f,0x11,0xff,0xfa,0xb9,0xd3,0xb8,0xf1,0x1f,0x18,
-0xbf,0x6d,0xde,0x7f,0x11,0xff,0xfe,0xf2,0x71,0x25,0xf1,0x1f,0x64,0x6a,0x00,0x05,
-0xfd,0x40,0x8e,0x00,0x88,0x03,0x01,0xe5,0x8f,0xf1,0x29,0xd6,0x00,0x12,0xf7,0x11,
-0x0b,0xff,0xff,0x3d,0xdf,0xed,0xa0,0x47,0x77,0x64,0x78,0xfb,0x77,0x13,0xee,0xe9,
-0x9b,0xbb,0xbb,0xb2,0x18,0x88,0x50,0xbc,0xcc,0xc6,0x02,0xcc,0xc8,0x0f,0xa4,0x4f,
-0x80,0x14,0x44,0x30,0xfe,0xdd,0xf8,0x03,0xff,0xfb,0x0f,0xa6,0x6f,0x80,0x3f,0x09,
-0xb0,0xfd,0xbb,0x0d,0x00,0x91,0x70,0x1f,0x80,0x3f,0x44,0x30,0xf7,0x1f,0xf4,0x76,
-0x02,0x02,0xc7,0x01,0x10,0x04,0x81,0x26,0xf4,0x3d,0x9f,0xf8,0xfd,0x70,0x00,0xb6,
-0x03,0x4f,0x3c,0xd5,0x08,0xff,0xfe,0xcd,0xe0,0x7e,0xf4,0x27,0x77,0x55,0xfd,0x8a,
-0xfb,0x00,0xee,0xe8,0xec,0x89,0x98,0xf7,0x08,0x88,0x46,0xed,0xdd,0xd8,0x00,0xcc,
-0xc6,0x0f,0x84,0x5f,0x50,0x04,0x44,0x20,0xf8,0x45,0xf5,0x01,0xff,0xf9,0x0d,0xed,
-0xee,0x40,0x1f,0x19,0x90,0x6e,0x08,0xe0,0x01,0xff,0xf9,0x56,0xf7,0xeb,0x52,0x1f,
-0x54,0x2d,0xee,0xee,0xee,0x60,0xb9,0x08,0xf1,0x12,0x30,0x06,0xd0,0x4f,0x30,0x00,
-0xc7,0x08,0xcf,0xbe,0xfb,0x66,0xff,0xff,0x7a,0xfa,0xfb,0xb4,0x15,0x55,0x58,0x8e,
-0x3f,0x7f,0x20,0xff,0xf9,0x5a,0xe6,0xfb,0xb1,0x06,0x66,0x96,0x5d,0x90,0xff,0xf9,
-0x36,0x66,0x66,0x51,0x04,0x44,0x23,0x4f,0x06,0xc0,0xff,0xf9,0x3f,0x54,0x4a,0xe0,
-0x0f,0x3a,0x93,0xfb,0xaa,0xde,0x0d,0x00,0x92,0xbb,0xbd,0xe0,0x0f,0x63,0x23,0xf8,
-0x77,0xce,0x26,0x29,0x15,0x10,0x82,0x1e,0xf1,0x16,0xfe,0x2f,0x20,0x00,0x17,0xf8,
+0x00,0x04,0x02,0x11,0x22,0x06,0x00,0x30,0x0d,0xd0,0x0e,0x2e,0x00,0xf0,0x23,0x5e,
+0x10,0xe9,0x33,0xbd,0x06,0xff,0xff,0x3e,0x93,0x3b,0xd0,0x5c,0xcd,0xf3,0xef,0xee,
+0xfd,0x00,0x01,0xda,0x0e,0x93,0x3b,0xd0,0x00,0xbf,0x40,0xef,0xee,0xfd,0x02,0xdf,
+0xfe,0x2e,0xa4,0x4b,0xd0,0x9f,0xdf,0xd7,0xef,0xff,0xfd,0x02,0x29,0xe2,0x02,0xf3,
+0xe7,0x9d,0x04,0xf6,0x01,0x8f,0x0e,0x75,0x30,0x09,0xe1,0x8f,0x80,0xeb,0xc9,0x00,
+0x9e,0x2d,0x60,0x09,0xee,0x03,0x02,0x00,0x60,0x02,0xf1,0x11,0x9e,0x0e,0x90,0xbf,
+0x99,0x92,0x09,0xe0,0xe9,0x1f,0xdb,0xbb,0x30,0x9e,0x0e,0x9b,0xf2,0xd7,0x00,0x07,
+0xb0,0xe9,0xa9,0x0b,0xf1,0x00,0x00,0x0b,0x70,0x00,0x35,0x00,0x27,0x04,0xf4,0x19,
+0xf0,0x00,0x0a,0xe6,0x66,0x66,0xbf,0x00,0x00,0xad,0x05,0xe6,0x09,0xf0,0x00,0x0a,
+0xd0,0x7f,0x92,0x9f,0x00,0x00,0x22,0x3e,0xef,0x70,0x06,0x00,0x26,0xbf,0xc3,0xfa,
+0x45,0xf4,0x0b,0xfb,0x50,0x0a,0xff,0xfc,0x59,0x00,0x21,0x02,0xb4,0x60,0x05,0x00,
+0xc7,0x01,0xd0,0x00,0x4f,0x93,0x38,0xf7,0x00,0x03,0xff,0x20,0x0d,0xe1,0x00,0x2e,
+0x77,0x01,0xd1,0xf6,0x0a,0xdf,0x55,0xfc,0x56,0xf6,0x00,0x9f,0x55,0xfc,0x57,0xf6,
+0x5e,0x00,0x90,0xf6,0x00,0xbe,0x00,0xea,0x02,0xf6,0x00,0xdf,0x0c,0x00,0x20,0x01,
+0xfa,0x1e,0x00,0xc3,0x0a,0xf2,0x00,0xea,0x69,0xf6,0x0b,0x80,0x00,0xea,0x9f,0xc1,
+0x54,0x00,0x11,0x92,0x06,0x00,0xf4,0x3e,0x5f,0x30,0x09,0xff,0xff,0xf0,0x0a,0xff,
+0xf7,0x27,0xf5,0x8f,0x01,0xf9,0x5f,0x30,0x8d,0x06,0xf0,0xaf,0xcd,0xfb,0x5f,0x84,
+0xbd,0x04,0xfa,0xf9,0xfc,0xb0,0x9e,0x60,0x0e,0xbf,0xaf,0x3f,0x4f,0x60,0x00,0xeb,
+0xfb,0xf7,0xff,0xff,0xf1,0x0e,0x6e,0x4f,0xdb,0x5f,0x95,0x00,0xff,0xff,0xf6,0x86,
+0xfa,0x52,0x1f,0x4e,0x5f,0x9f,0xff,0xff,0x56,0xe0,0xe7,0xf1,0x00,0xf6,0x00,0x88,
+0x04,0xbb,0x00,0x0f,0x60,0xae,0x00,0x11,0x40,0x07,0x00,0xfc,0x3e,0x8c,0x53,0x5f,
+0xff,0xff,0xf1,0x0d,0xff,0xd5,0xf5,0xbb,0x7f,0x15,0xe0,0xc6,0x5f,0xde,0xed,0xf1,
+0xbf,0xef,0xe5,0xbf,0x87,0x77,0x02,0xe9,0x9e,0x3e,0xfd,0xdd,0xd2,0x0e,0x89,0xed,
+0xfb,0xcb,0xbf,0x20,0xef,0xff,0xca,0x7d,0x43,0xf2,0x0f,0x89,0xe5,0xf9,0xec,0x7f,
+0x10,0xff,0xff,0x5f,0xef,0xf8,0xf1,0x2e,0x58,0xe2,0x04,0xca,0x5f,0x07,0xb5,0x9f,
+0x8e,0xfe,0xeb,0xe0,0x66,0x17,0xd1,0x10,0x03,0xf9,0x16,0x05,0xb1,0x5f,0x40,0x00,
+0x00,0x03,0x33,0x34,0xfd,0x43,0x33,0x22,0x7d,0x02,0xf4,0x05,0xfa,0x00,0x13,0x33,
+0x33,0x33,0x30,0x00,0x05,0xff,0xff,0xff,0xfe,0x00,0x00,0x12,0x22,0x22,0x22,0x20,
+0x0d,0x00,0x71,0x01,0x11,0x11,0x11,0x10,0x00,0x07,0x43,0x05,0x91,0x00,0x7f,0x33,
+0x33,0x3a,0xf0,0x00,0x07,0xf6,0x7f,0x01,0x54,0x7f,0xed,0xdd,0xde,0xf0,0x1b,0x02,
+0x50,0x09,0xc0,0x00,0x08,0xf1,0xc4,0x03,0xf0,0x00,0x00,0x8f,0x10,0x03,0xff,0xff,
+0xf3,0x08,0xf1,0x00,0x04,0x44,0x44,0x00,0x8f,0xda,0x05,0xf0,0x05,0xa7,0x8c,0xf9,
+0x84,0x04,0x66,0x64,0xcf,0xff,0xff,0x70,0xaf,0xff,0xa0,0x08,0xf1,0x00,0x03,0x55,
+0x53,0x1a,0x00,0x91,0x9f,0xef,0xb0,0x08,0xf1,0x00,0x09,0xa0,0x9b,0x0d,0x00,0x11,
+0xff,0x0d,0x00,0x20,0xc4,0x43,0x0d,0x00,0x00,0x0f,0x02,0x42,0x20,0x00,0x00,0x63,
+0x70,0x02,0xc0,0xb0,0x0a,0xff,0xff,0xf0,0x01,0x7d,0x11,0x47,0x77,0xcf,0x07,0xc2,
+0x02,0xf3,0x2e,0x09,0xf0,0x14,0x44,0x42,0x00,0x00,0x9f,0x00,0xdf,0xff,0x41,0x22,
+0x2a,0xf0,0x04,0x44,0x42,0x9f,0xff,0xff,0x01,0xff,0xff,0x79,0xf4,0x4b,0xf0,0x03,
+0x44,0x41,0x9f,0x00,0x00,0x00,0xef,0xff,0x49,0xf0,0x00,0x10,0x0e,0x61,0xf4,0x9f,
+0x00,0x0c,0x80,0xef,0xef,0x48,0xf9,0x89,0xf7,0x0e,0x94,0x41,0x2c,0xee,0xeb,0x10,
+0x03,0x01,0xf4,0x3e,0x3e,0x10,0x00,0x1d,0x40,0x00,0x00,0xe5,0x00,0x00,0xd9,0x00,
+0x0a,0xff,0xff,0xaf,0xff,0xff,0xf4,0x36,0x66,0x54,0x8f,0xc8,0x88,0x22,0xff,0xf9,
+0x00,0xf7,0x00,0x00,0x16,0x66,0x40,0x0f,0xff,0xfb,0x02,0xdd,0xd8,0x02,0xf9,0x7d,
+0xb0,0x04,0x44,0x20,0x5f,0x00,0xca,0x02,0xff,0xf9,0x0a,0xc0,0x0d,0x90,0x2f,0x09,
+0x92,0xf8,0x00,0xe8,0x02,0xff,0xfa,0xde,0x15,0x7f,0x60,0x2f,0x54,0x4d,0x40,0xbf,
+0xd1,0x58,0x01,0x02,0x20,0x03,0xf0,0x19,0x0b,0xc0,0x04,0xff,0xff,0x10,0x03,0x7d,
+0x42,0x5f,0x79,0xf1,0x04,0xff,0xff,0xc7,0xe0,0x5f,0x10,0x04,0x44,0x44,0xdb,0x04,
+0xf5,0x20,0xbf,0xff,0xdf,0x30,0x1e,0xf7,0x04,0x55,0x54,0x85,0x55,0x55,0x00,0xbf,
+0x75,0x00,0xf9,0x13,0xf1,0x03,0x44,0x42,0xcc,0x34,0xfa,0x00,0xaf,0xff,0x44,0xf6,
+0xaf,0x20,0x0a,0x90,0xf4,0x0a,0xff,0x80,0x00,0xaf,0xff,0xad,0xfd,0xff,0xd7,0x0a,
+0xb4,0x47,0xd5,0x01,0x9e,0x40,0xb9,0x01,0xb0,0x0c,0x40,0x00,0x6c,0x00,0x00,0x00,
+0xb9,0x00,0x03,0xf7,0xd1,0x02,0xf2,0x16,0x7a,0xae,0xba,0xa0,0x24,0x44,0x46,0xcd,
+0xfe,0xcc,0x11,0xff,0xff,0x00,0x0f,0x80,0x00,0x03,0x33,0x30,0x00,0xf8,0x00,0x04,
+0xff,0xff,0x3e,0xef,0xfe,0xb0,0x03,0x33,0x32,0xaa,0xfd,0xa8,0x01,0x1a,0x00,0xf3,
+0x05,0x1f,0x47,0xf0,0x00,0xf8,0x00,0x01,0xff,0xff,0x9f,0xff,0xff,0xf5,0x1f,0x62,
+0x24,0x77,0x77,0x77,0x20,0x55,0x00,0xd1,0x3f,0x10,0x09,0xc0,0x00,0x00,0x00,0xd6,
+0x00,0xec,0x44,0x44,0x0a,0x21,0x00,0xf6,0x2c,0xf2,0x36,0x66,0x7f,0xc1,0x11,0x6f,
+0x12,0xff,0xfb,0xbf,0xff,0x55,0xf1,0x15,0x55,0x34,0xe4,0xf5,0x6f,0x02,0xff,0xf9,
+0x4f,0xbf,0x56,0xf0,0x04,0x44,0x24,0xfa,0xf5,0x7f,0x02,0xff,0xf9,0x4e,0x7f,0x59,
+0xe0,0x2f,0x09,0x94,0xd8,0x82,0xbd,0x02,0xff,0xf9,0x00,0x06,0x6f,0xa0,0x2f,0x54,
+0x20,0x00,0xef,0xe3,0x2a,0x06,0x00,0x01,0x00,0xf2,0x3e,0x1d,0x20,0x00,0x01,0xf8,
+0x80,0x00,0xda,0x00,0x00,0x1f,0x9f,0x44,0xbd,0xca,0x57,0x78,0xfa,0xc5,0x38,0x88,
+0x7b,0xff,0xff,0xff,0x90,0xcd,0xda,0x00,0x00,0xf6,0x00,0x07,0x88,0x6c,0xff,0xbf,
+0x70,0x00,0xab,0xb8,0x5d,0xc4,0xf8,0x00,0x04,0x44,0x30,0xca,0x0d,0x90,0x00,0xdf,
+0xfc,0x0c,0xa0,0xbb,0x00,0x0d,0x68,0xd6,0xee,0xdb,0xe6,0x70,0xdf,0xfc,0xec,0x83,
+0x5f,0xc9,0x0d,0x94,0x30,0x00,0x00,0xcf,0x0b,0x01,0x04,0x5c,0x00,0xf0,0x31,0x2d,
+0x20,0x01,0x36,0x9d,0x40,0x00,0xd8,0x04,0xff,0xfe,0x94,0x0a,0xdf,0xdd,0x33,0x1f,
+0x70,0x00,0x46,0x66,0x62,0x11,0xf8,0x11,0x03,0xff,0xfc,0xbf,0xff,0xff,0xf5,0x15,
+0x55,0x43,0x55,0xfa,0x55,0x13,0xff,0xfc,0x00,0x0f,0x70,0x00,0x14,0x44,0x41,0xaa,
+0xfd,0xa7,0x03,0xff,0xfd,0x1f,0xdc,0xcf,0xb0,0x3f,0x18,0xd1,0xf4,0x00,0xcb,0x0d,
+0x00,0x90,0xff,0xff,0xb0,0x3f,0x32,0x21,0xf9,0x77,0xeb,0x78,0x03,0x06,0xb7,0x00,
+0xf0,0x0d,0x2d,0x10,0x1b,0x40,0x0c,0x90,0x00,0xe8,0x00,0xcd,0x04,0xf6,0x0a,0xde,
+0xdd,0x6a,0xf8,0xaf,0x71,0x56,0x66,0x6a,0xff,0xff,0xff,0x23,0xee,0xea,0x4c,0x01,
+0xf1,0x00,0x28,0x88,0x53,0xff,0xff,0xfb,0x02,0xbb,0xb8,0x17,0x7f,0xc7,0x50,0x14,
+0x44,0x73,0x01,0xd0,0xfe,0xfc,0x8b,0xbf,0xdb,0xb3,0x4f,0x08,0xc6,0x88,0xfc,0x88,
+0x24,0x75,0x00,0x31,0x80,0x00,0x4f,0x1a,0x00,0x01,0xd4,0x03,0x05,0x11,0x01,0xf3,
+0x41,0x3e,0x30,0x00,0x1f,0x60,0x00,0x00,0xc9,0x04,0x56,0xf9,0x55,0x27,0xff,0xfe,
+0xbf,0xff,0xff,0xf6,0x25,0x55,0x40,0x02,0xf7,0x00,0x00,0xff,0xf8,0x36,0x7f,0xa6,
+0x60,0x06,0x66,0x37,0xff,0xff,0xff,0x10,0xdd,0xd7,0x00,0x4f,0x80,0x00,0x04,0x44,
+0x22,0x2e,0xbf,0x44,0x00,0xff,0xf9,0xbb,0xf4,0x27,0xf1,0x0f,0x29,0xaf,0x8f,0x45,
+0x9e,0x70,0xff,0xfb,0xc2,0xfb,0xcb,0x85,0x0f,0x64,0x20,0x08,0xcb,0x30,0x00,0x00,
+0x40,0x87,0x04,0x00,0x2c,0x04,0xf4,0x38,0x00,0xd4,0x01,0x55,0xf8,0x9f,0x0b,0xff,
+0xff,0x5e,0x5f,0x37,0xf0,0x35,0x55,0x5d,0x8a,0xe0,0x8e,0x02,0xff,0xfa,0x45,0xf7,
+0x4c,0xc0,0x16,0x66,0x45,0xfb,0x0e,0xf5,0x02,0xff,0xfa,0x18,0x17,0x00,0x00,0x04,
+0x44,0x33,0x49,0xf6,0x43,0x03,0xff,0xfb,0xdc,0xe7,0xd8,0xc0,0x3f,0x08,0xdf,0x9e,
+0x01,0x9f,0x43,0xff,0xff,0xd6,0xf4,0x5f,0x94,0x3f,0x54,0x30,0x2f,0xff,0xb0,0xc1,
+0x01,0x12,0x50,0x9d,0x06,0xf0,0x30,0x60,0xaf,0xff,0xff,0xf0,0x12,0xc8,0x23,0x4e,
+0xc4,0x44,0x0c,0xff,0xff,0x54,0xeb,0x44,0x10,0x46,0x66,0x66,0xff,0xff,0xf3,0x03,
+0xff,0xfc,0x04,0xf3,0x2f,0x30,0x15,0x55,0x46,0xaf,0x78,0xf8,0x23,0xff,0xfc,0xdd,
+0xdd,0xdd,0xd5,0x15,0x55,0x52,0x88,0x88,0x85,0x03,0xff,0xfd,0x5f,0xdc,0xcf,0xa0,
+0x3f,0x17,0xd5,0xf1,0x00,0xda,0x0d,0x00,0x93,0xee,0xef,0xa0,0x3f,0x32,0x25,0xf7,
+0x66,0xea,0x66,0x01,0x23,0x01,0x70,0x5b,0x00,0x10,0x4f,0xcd,0x03,0xf6,0x37,0xc5,
+0x04,0xf6,0x44,0xbe,0x0c,0xff,0xff,0x7f,0x20,0x08,0xe0,0x47,0x77,0x65,0xfe,0xdd,
+0xfe,0x03,0xee,0xea,0x16,0x66,0x66,0x50,0x18,0x88,0x58,0xff,0xff,0xff,0x22,0xcc,
+0xc8,0x36,0x6f,0xc6,0x61,0x14,0x44,0x34,0x44,0xfa,0x44,0x23,0xff,0xfc,0xef,0xff,
+0xff,0xf8,0x3f,0x08,0xc0,0x1c,0xff,0x50,0x03,0xff,0xfd,0x7d,0xf3,0x9f,0xa3,0x3f,
+0x54,0x3a,0xb3,0x00,0x7e,0x47,0x06,0x02,0xc1,0x01,0xf4,0x3c,0x05,0x70,0xc2,0x00,
+0x00,0xd7,0x00,0xd8,0x09,0xc0,0x09,0xdf,0xdd,0xae,0x00,0x1e,0xa0,0x46,0x66,0xaf,
+0xb7,0x77,0xbf,0x42,0xff,0xfa,0x7f,0xed,0xdf,0x80,0x15,0x55,0x32,0xf3,0x00,0xf6,
+0x02,0xff,0xf9,0x2f,0xba,0xaf,0x60,0x04,0x44,0x32,0xdf,0xdf,0xc4,0x02,0xff,0xfb,
+0x08,0xf4,0xf2,0x00,0x2f,0x08,0xb0,0xdc,0x3f,0x29,0x22,0xff,0xfc,0xaf,0x53,0xf6,
+0xf4,0x2f,0x54,0x5e,0x60,0x1e,0xfe,0x55,0x00,0x02,0x6c,0x01,0x30,0x1f,0x50,0x7f,
+0x6c,0x01,0xf2,0x37,0xb6,0x07,0xd5,0x65,0x7f,0x18,0xff,0xff,0x7c,0x1c,0x72,0xf1,
+0x25,0x55,0x57,0xcb,0xff,0x7f,0x10,0xff,0xf9,0x7c,0x1c,0x63,0xf1,0x06,0x66,0x47,
+0xce,0xff,0xbf,0x10,0xff,0xf9,0x8b,0x11,0x12,0xf1,0x04,0x44,0x39,0xad,0xff,0x8f,
+0x11,0xff,0xfa,0xb9,0xd3,0xb8,0xf1,0x1f,0x18,0xbf,0x6d,0xde,0x7f,0x11,0xff,0xfe,
+0xf2,0x71,0x25,0xf1,0x1f,0x64,0x6a,0x00,0x05,0xfd,0xf8,0x06,0x15,0x00,0x88,0x03,
+0x10,0x8f,0xdd,0x06,0xf1,0x29,0xd6,0x00,0x12,0xf7,0x11,0x0b,0xff,0xff,0x3d,0xdf,
+0xed,0xa0,0x47,0x77,0x64,0x78,0xfb,0x77,0x13,0xee,0xe9,0x9b,0xbb,0xbb,0xb2,0x18,
+0x88,0x50,0xbc,0xcc,0xc6,0x02,0xcc,0xc8,0x0f,0xa4,0x4f,0x80,0x14,0x44,0x30,0xfe,
+0xdd,0xf8,0x03,0xff,0xfb,0x0f,0xa6,0x6f,0x80,0x3f,0x09,0xb0,0xfd,0xbb,0x0d,0x00,
+0x91,0x70,0x1f,0x80,0x3f,0x44,0x30,0xf7,0x1f,0xf4,0x76,0x02,0x02,0xc7,0x01,0xf4,
+0x42,0x04,0x00,0x00,0x2f,0x40,0x9f,0xf8,0xfd,0x70,0x00,0xb6,0x03,0x4f,0x3c,0xd5,
+0x08,0xff,0xfe,0xcd,0xe0,0x7e,0xf4,0x27,0x77,0x55,0xfd,0x8a,0xfb,0x00,0xee,0xe8,
+0xec,0x89,0x98,0xf7,0x08,0x88,0x46,0xed,0xdd,0xd8,0x00,0xcc,0xc6,0x0f,0x84,0x5f,
+0x50,0x04,0x44,0x20,0xf8,0x45,0xf5,0x01,0xff,0xf9,0x0d,0xed,0xee,0x40,0x1f,0x19,
+0x90,0x6e,0x08,0xe0,0x01,0xff,0xf9,0x56,0xf7,0xeb,0x52,0x1f,0x54,0x2d,0xee,0xee,
+0xee,0x60,0xb9,0x08,0xf0,0x20,0x30,0x06,0xd0,0x4f,0x30,0x00,0xc7,0x08,0xcf,0xbe,
+0xfb,0x66,0xff,0xff,0x7a,0xfa,0xfb,0xb4,0x15,0x55,0x58,0x8e,0x3f,0x7f,0x20,0xff,
+0xf9,0x5a,0xe6,0xfb,0xb1,0x06,0x66,0x4f,0xff,0xff,0xff,0xb0,0xff,0xf9,0x36,0x66,
+0x66,0x51,0x04,0x44,0x23,0x4f,0x06,0xc0,0xff,0xf9,0x3f,0x54,0x4a,0xe0,0x0f,0x3a,
+0x93,0xfb,0xaa,0xde,0x0d,0x00,0x91,0xbb,0xbd,0xe0,0x0f,0x63,0x23,0xf8,0x77,0xce,
+0x1c,0x02,0x03,0xdd,0x03,0x00,0xc1,0x04,0xf0,0x17,0xfe,0x2f,0x20,0x00,0x17,0xf8,
 0x99,0x5a,0xff,0xff,0x60,0xbe,0xcc,0xed,0xfe,0x4f,0x50,0x5f,0xcc,0x6e,0x63,0xbf,
-0xc0,0x00,0x8c,0xcb,0xf4,0xbf,0xcf,0xd5,0x04,0x52,0x7a,0xb8,0x20,0x28,0x12,0x78,
-0x24,0x80,0xe4,0x00,0x6a,0xaa,0xaa,0xaa,0x80,0x00,0x2c,0x65,0x12,0xb9,0xdc,0xa7,
-0x41,0x90,0x00,0x0b,0xc4,0x9c,0x2a,0x10,0xbe,0x82,0x2a,0x05,0x8f,0x14,0x70,0x30,
-0x07,0xc0,0x0e,0x60,0x00,0xb6,0xb1,0x14,0xf0,0x01,0x75,0xff,0xfe,0x28,0x8f,0xc8,
-0x81,0x16,0x66,0x51,0x88,0xfc,0x88,0x00,0xdf,0xfa,0x78,0x0b,0xf1,0x1f,0x05,0x55,
-0x35,0x7b,0x8a,0x68,0x10,0xdf,0xf9,0xce,0xf6,0xf8,0xf5,0x03,0x44,0x38,0xbf,0x8f,
-0xac,0x60,0xee,0xfa,0xac,0xfa,0xed,0xc7,0x0e,0x28,0xac,0xef,0xc9,0xed,0x10,0xef,
-0xf9,0x27,0xe3,0xdf,0x4c,0x0e,0x53,0x28,0xfb,0xa7,0xbf,0x90,0xb0,0x00,0x14,0x20,
-0x0b,0x01,0x11,0x20,0x2b,0x18,0xf3,0x38,0xc6,0x08,0xbf,0x9c,0xf8,0x4b,0xff,0xff,
-0x2d,0x8a,0xa5,0x00,0x46,0x66,0x68,0xfe,0xff,0xee,0x22,0xff,0xfc,0xff,0x9b,0xf8,
-0x60,0x15,0x55,0x4c,0xf8,0xaf,0x76,0x02,0xff,0xfa,0x2f,0xab,0xf9,0x70,0x15,0x55,
-0x42,0xfe,0xff,0xee,0x53,0xff,0xfb,0x6d,0xa9,0x9a,0x80,0x3f,0x09,0xb2,0x8f,0xac,
-0xf6,0x03,0xff,0xfb,0x58,0xef,0xfc,0x62,0x3f,0x54,0x3d,0xd8,0x36,0xbf,0x40,0x95,
-0x14,0x10,0xf4,0xea,0x80,0x30,0x80,0x0b,0xd0,0xa9,0x4a,0xf9,0x2f,0x4d,0xee,0xc5,
-0xee,0xee,0xee,0x22,0x66,0x66,0x8b,0xbb,0xbb,0xb5,0x0d,0xff,0x9b,0x6c,0x2c,0x3c,
-0x70,0x67,0x75,0xac,0xdb,0xec,0xe6,0x0c,0xcc,0x94,0xcc,0xcc,0xcc,0x10,0x78,0x85,
-0x5f,0x99,0x9b,0xf1,0x0d,0xce,0x95,0xf9,0x99,0xbf,0x10,0xd5,0xa9,0x5f,0xaa,0xac,
-0xf1,0x0d,0xff,0x94,0xcd,0x18,0xe9,0x20,0xd7,0x34,0xeb,0xb6,0x59,0x01,0x40,0xaa,
-0xf1,0x25,0x00,0x6d,0x00,0x5b,0x00,0x0c,0x6a,0xac,0xcc,0x6e,0x59,0x05,0xff,0x86,
-0xcc,0xcb,0xff,0x70,0x07,0xca,0x47,0x77,0x1b,0xad,0x14,0xfe,0xf7,0x66,0x6a,0xff,
-0xf5,0x27,0x67,0x8e,0xcf,0x55,0x58,0x15,0x8d,0xb9,0xb7,0xfb,0x6e,0x94,0x34,0x5b,
-0xc6,0x55,0x64,0x63,0x00,0x2b,0xe9,0x0a,0xf2,0x06,0x3f,0xdc,0xd6,0x2a,0xf8,0x00,
-0x00,0x74,0x6e,0xff,0xfc,0x64,0x20,0x3f,0xfe,0xa6,0x47,0xbe,0xff,0x30,0x20,0x57,
-0x00,0x31,0x09,0xd5,0x22,0x7e,0x19,0x00,0x68,0x09,0x54,0x07,0xfc,0x11,0xaf,0x30,
-0x8a,0x19,0x30,0x05,0xeb,0x44,0x9d,0x4d,0x02,0x6f,0x89,0x00,0xb4,0x36,0x1f,0x3c,
-0x0d,0x00,0x02,0xe2,0x02,0x7d,0xe3,0x04,0xfb,0x50,0x02,0xff,0xa2,0x00,0x03,0xbf,
-0xb0,0x02,0x4f,0x26,0x30,0x0e,0xff,0xf8,0xb5,0x52,0xf0,0x0a,0xe9,0x3f,0x80,0x0e,
-0x90,0x00,0x0e,0x81,0xe8,0x00,0xea,0x33,0x10,0xef,0xff,0x80,0x0e,0xff,0xf6,0x0e,
-0x70,0xe8,0x00,0xea,0x22,0x0d,0x00,0x00,0x1a,0x00,0x30,0x92,0xe8,0xcf,0x00,0x35,
-0xf7,0x10,0x4f,0x8c,0xeb,0xbe,0xe0,0x0e,0xff,0xf8,0xc8,0x00,0x9e,0x00,0x7d,0x4d,
-0x2c,0x80,0x09,0xe0,0x2f,0xa0,0xcc,0xcf,0xff,0xfe,0x04,0xc1,0x02,0x2c,0xc6,0x6b,
-0xd0,0x23,0x04,0x10,0x51,0x7e,0x1d,0x61,0xf1,0x3f,0x30,0x00,0x0f,0x86,0xa6,0x2e,
-0xf0,0x2c,0xf4,0x13,0xf1,0xcf,0x77,0x72,0x0f,0x5f,0x6f,0x4f,0xfe,0xff,0x50,0xf5,
-0xf6,0xfb,0xf2,0x0c,0x80,0x0f,0x5f,0x6f,0xdf,0x70,0xf4,0x00,0xf6,0xf6,0xf2,0x8e,
-0x6f,0x10,0x0f,0x8f,0x4e,0x10,0xef,0x90,0x00,0x09,0xd8,0x10,0x09,0xf6,0x00,0x04,
-0xf6,0xcb,0x06,0xfd,0xf5,0x04,0xf9,0x03,0xe8,0xf8,0x08,0xf5,0x05,0x62,0x03,0x10,
-0x04,0xcb,0x1a,0xf0,0x0a,0x0d,0xff,0xff,0x00,0xce,0xff,0xe7,0x45,0x5b,0xf0,0x05,
-0x6f,0xb6,0x30,0x00,0x8f,0x00,0x22,0xe9,0x21,0x22,0x29,0xf0,0x3f,0xff,0x2f,0x32,
-0xf0,0x1b,0x00,0x32,0xad,0x22,0xbc,0x22,0x20,0x0c,0x99,0xe6,0x4b,0xb0,0x07,0x30,
-0xd9,0x9f,0xe9,0xbc,0x22,0xd8,0x0e,0xfa,0xd0,0x08,0xff,0xff,0x40,0xff,0xfd,0x00,
-0x02,0x33,0x20,0x2f,0x9f,0xfb,0x97,0x77,0x77,0x66,0xf0,0x3a,0xe3,0x04,0x14,0x04,
-0xd8,0x32,0xf0,0x08,0x20,0x8f,0xff,0xff,0x32,0xee,0xfe,0xe2,0x7f,0x68,0xf2,0x16,
-0x9f,0x86,0x08,0xe0,0x6f,0x11,0x26,0xf4,0x23,0xf9,0x5b,0x4b,0x71,0xf0,0x1f,0xed,
-0x1c,0xfa,0x03,0x66,0xf9,0x63,0x75,0x66,0x50,0x1e,0x4f,0x72,0x3f,0xee,0xfe,0x01,
-0xf4,0xfe,0xd4,0xf3,0x09,0xe0,0x2f,0xcf,0x50,0x3f,0xfe,0xfe,0x04,0xff,0xf5,0x01,
-0x44,0x44,0x40,0x7e,0x9f,0xe9,0x87,0x77,0x78,0x59,0xa0,0x5b,0xef,0x7c,0x98,0x03,
-0x55,0x00,0x12,0xef,0x29,0x8c,0x10,0xc7,0x58,0x16,0x20,0x00,0xe9,0xec,0x2d,0x00,
-0x50,0x38,0x00,0x33,0x27,0x02,0x1a,0x00,0xe0,0x03,0x44,0x5f,0xa4,0x44,0x00,0x00,
-0x7d,0x21,0xf9,0x22,0x21,0x00,0x0b,0x47,0x5e,0xf5,0x0c,0xc0,0x00,0xef,0x61,0xfa,
-0x44,0x43,0x00,0x5f,0xdf,0x8f,0x80,0x00,0x00,0x2e,0xd0,0xbf,0xfc,0x87,0x77,0x52,
-0xd2,0x00,0x4a,0xdf,0xff,0xf6,0xf1,0x84,0x10,0xf7,0x1b,0x0d,0x90,0xf7,0x4f,0x7f,
-0xc8,0x88,0x82,0x0f,0x40,0xe7,0xf9,0x06,0x20,0xfb,0x9f,0x4c,0x75,0x30,0x0b,0xcf,
-0xc5,0x1c,0x03,0xe0,0x24,0xf1,0x0f,0x80,0x0e,0x80,0x1f,0x6f,0xc6,0xf8,0x00,0xe8,
-0x01,0xf6,0xad,0x7e,0xb0,0x80,0x1f,0x6f,0x10,0xfb,0x77,0x73,0x01,0xf9,0xfe,0x9f,
-0x5d,0x8e,0xd0,0xfc,0x82,0xff,0xff,0xff,0x84,0x61,0x00,0x08,0x88,0x88,0x85,0x0f,
-0x19,0x1f,0xf0,0x02,0xfe,0x00,0xf7,0x4f,0x8f,0xa5,0x5a,0xe0,0x0f,0x40,0xe8,0xf8,
-0x33,0x9e,0x00,0xf8,0x5f,0x48,0x70,0xf6,0x23,0x0f,0xff,0xf8,0xf9,0x44,0xae,0x00,
-0x44,0xf0,0x1f,0xdb,0xbd,0xe0,0x1f,0x5f,0xf7,0xfa,0xcc,0x59,0x01,0xf5,0xf6,0x4f,
-0x64,0xf8,0xf4,0x1f,0x5f,0x01,0xf6,0x0e,0xf5,0x01,0xf9,0xfd,0x8f,0x73,0xaf,0x40,
-0x9f,0xfd,0x89,0xff,0xf6,0xdf,0x53,0x61,0x00,0x5d,0x83,0x5d,0x9d,0x02,0x5d,0x0b,
-0x00,0x86,0x0a,0xf7,0x89,0x10,0x00,0x0f,0x95,0xf7,0x0f,0xff,0xfc,0x00,0xf6,0x0e,
-0x79,0xf8,0x6f,0x80,0x0f,0x95,0xfb,0xff,0xa7,0xf2,0x00,0xef,0xff,0xac,0x7f,0xf9,
-0x00,0x04,0x3f,0x30,0x06,0xff,0xb3,0x00,0xf5,0xfd,0xad,0xf8,0x4d,0xf9,0x0f,0x5f,
-0x86,0xef,0xee,0xef,0x10,0xf5,0xf3,0x08,0xf6,0x6b,0xe0,0x0f,0x7f,0xcc,0x8e,0x00,
-0x8e,0x07,0xff,0xfe,0x98,0xf6,0x6c,0xe0,0x5a,0x62,0x00,0x8f,0xdd,0xee,0x00,0x0f,
-0xff,0xf0,0x3f,0x5f,0x40,0x00,0xf8,0x8f,0x86,0xf5,0xf5,0xb2,0x0f,0x45,0xfe,0xcf,
-0x5f,0x9f,0x40,0xf8,0x8f,0x8f,0xf5,0xfe,0xc0,0x0e,0xff,0xf3,0xef,0x5f,0xf5,0x00,
-0x56,0xd0,0x03,0xf5,0xf6,0x00,0x0f,0x7f,0xf3,0xbf,0x4f,0xf8,0x00,0xf7,0xe9,0xff,
-0xf3,0xfb,0xf7,0x0f,0x7d,0x09,0xae,0x2f,0x46,0x10,0xfb,0xff,0x5e,0xa2,0xf4,0x64,
-0x8f,0xfb,0x7c,0xf2,0x1f,0x9c,0x92,0x30,0x00,0xd6,0x00,0xcf,0xf3,0xa0,0x02,0xf5,
-0x42,0x43,0x26,0x01,0xff,0xf5,0x5f,0x2b,0x76,0xd0,0x1f,0x5f,0x7e,0xa0,0xd7,0x8b,
-0x01,0xf1,0xef,0xf3,0x0f,0xeb,0xe0,0x1f,0x6f,0xb6,0xfb,0xfc,0xff,0x71,0xff,0xf5,
-0x9f,0xa7,0x5a,0x5a,0x16,0xa5,0x5f,0xd0,0x05,0xe0,0x02,0xfa,0xdf,0xed,0x3d,0x6e,
-0x00,0x2f,0xac,0x56,0xd4,0xe5,0xff,0x72,0xfa,0x50,0x5d,0x5f,0x6f,0x52,0x3f,0xcd,
-0xa5,0xd7,0xfc,0xe0,0x08,0xfd,0x95,0x5d,0xcb,0xff,0x75,0x11,0x00,0x05,0xeb,0x06,
-0xbd,0x70,0x68,0x0d,0x06,0x7e,0xad,0x01,0xff,0x26,0x10,0x10,0x19,0x27,0x70,0x59,
-0xf1,0x00,0x00,0x7f,0xfe,0xee,0x0d,0x00,0x71,0xf3,0x22,0x28,0xf9,0xd0,0x00,0x7f,
-0xed,0x1d,0x52,0x07,0xf4,0x22,0x29,0xfb,0x61,0x78,0xf7,0x0a,0x10,0x01,0x66,0x66,
-0x8e,0xfe,0xf1,0x00,0x00,0x01,0x9f,0xd4,0x6f,0x10,0x01,0x6c,0xfe,0x85,0x7c,0xf0,
-0x00,0x2f,0xb5,0x00,0x6f,0x96,0x7c,0x01,0x7c,0x18,0x11,0xcf,0xc5,0x14,0x82,0x05,
-0x66,0x68,0xfb,0x66,0x66,0x10,0x0d,0x42,0x2d,0x64,0xdb,0x45,0xf9,0x47,0xf4,0x00,
-0x0d,0x00,0x35,0x34,0xf9,0x36,0x0d,0x00,0x53,0x34,0x45,0xf9,0x44,0x41,0x7b,0x52,
-0x40,0x06,0x66,0x67,0xfa,0xac,0xad,0x03,0xd7,0x93,0x03,0xf4,0x86,0x00,0x66,0x37,
-0xf0,0x00,0x5d,0xef,0xdc,0x00,0x7f,0x00,0x02,0x6a,0xf6,0x63,0x5a,0xf5,0x51,0x2f,
-0xff,0xf5,0x73,0xd0,0x42,0xf6,0xd7,0xca,0xa6,0xe1,0xf4,0x2f,0xff,0xfc,0xaa,0x6e,
-0x1f,0x0d,0x00,0xf0,0x0b,0xed,0xfc,0xf4,0x2f,0xff,0xfb,0xae,0xdf,0xbf,0x42,0x49,
-0xf4,0x4a,0xa6,0xe1,0xf4,0x9f,0xff,0xff,0xca,0x6e,0x1f,0x40,0x17,0xf1,0x1a,0xf9,
-0x35,0x65,0x6f,0x00,0xac,0x55,0x6e,0x30,0x55,0x00,0x00,0xb0,0x0c,0xfa,0x38,0x2c,
-0xdf,0xca,0x44,0x9f,0x54,0x21,0x8b,0xf8,0x6f,0xff,0xff,0xf9,0x0b,0xdf,0xb7,0x2d,
-0x82,0xb7,0x10,0xf9,0xea,0xa7,0xf4,0x0a,0xf2,0x0f,0xff,0xfc,0xfc,0x30,0x6f,0xa0,
-0xf8,0xea,0xa4,0xbd,0x4f,0x80,0x0f,0xff,0xfa,0x03,0xfd,0xe0,0x00,0x28,0xf2,0x20,
-0x0c,0xf7,0x00,0x5f,0xff,0xfd,0x04,0xff,0xd1,0x00,0x27,0xf2,0x28,0xfb,0x5e,0xf7,
-0x00,0x6f,0x00,0xc6,0x00,0x1a,0x39,0x38,0xf3,0x04,0x11,0x6f,0x31,0x1f,0x8a,0x50,
-0x08,0xff,0xff,0xf4,0xf7,0x9f,0x30,0x44,0x8f,0x64,0x4f,0x94,0xb3,0x5a,0x37,0xf0,
-0x18,0x12,0x6e,0x32,0x1e,0x90,0x00,0x0c,0xef,0xff,0xe9,0xdb,0x7f,0x10,0x5a,0xbf,
-0x9a,0x3b,0xcd,0xb0,0x08,0xec,0xfb,0xf4,0x9f,0xf5,0x00,0x8c,0x9f,0x7e,0x46,0xfc,
-0x20,0x04,0x79,0xf7,0x73,0xbf,0x76,0xb0,0x2c,0x00,0x94,0xdf,0xea,0x00,0x04,0xf0,
-0x0b,0x51,0xac,0x20,0x73,0x20,0x10,0x70,0x80,0x91,0xf4,0x38,0x9f,0xff,0xf3,0x0a,
-0xef,0x40,0x03,0x5e,0xa5,0x18,0xf3,0xaf,0x30,0x49,0xfc,0x9a,0xfc,0x56,0xff,0x56,
-0xdd,0xbf,0xbc,0xee,0xee,0xc3,0x6e,0xec,0xf3,0x44,0x44,0x44,0x06,0xcc,0x9f,0x7f,
-0xff,0xff,0xf0,0x6f,0xfe,0xf7,0xd8,0x8e,0x6f,0x02,0x4e,0xa4,0x6f,0xee,0xfe,0xf0,
-0xbf,0xff,0xf9,0xea,0xae,0x9f,0x01,0x2e,0x92,0x6d,0x88,0xe9,0xf0,0x00,0xd7,0x05,
-0xd6,0x6a,0xaa,0xac,0x01,0xf0,0x01,0x8f,0x11,0x4f,0xff,0xfe,0x07,0xff,0xff,0xe4,
-0xf4,0x1a,0xe0,0x24,0x9f,0x44,0x4f,0x61,0x61,0x70,0xff,0xb5,0x77,0x77,0x73,0x3f,
-0x5c,0xa2,0x0b,0xf0,0x05,0x93,0xff,0xff,0xb4,0xf5,0x2a,0xe0,0x3f,0x7c,0x8b,0x3f,
-0xff,0xfd,0x03,0xff,0xff,0xb3,0xf7,0x5b,0xd0,0x27,0x00,0x20,0xba,0xdd,0x0f,0x4f,
-0x80,0xf9,0x8d,0xf6,0x01,0x7f,0x13,0xfe,0xcb,0x61,0x3e,0x01,0xed,0x19,0x03,0x63,
-0x07,0x10,0x60,0xb3,0x40,0xe0,0x8d,0xfe,0xd2,0x3e,0xbf,0x40,0x03,0x5f,0xa6,0xaf,
-0x81,0x6f,0xb2,0x6f,0xe2,0x52,0x80,0xfa,0x06,0xbc,0x8f,0x26,0x64,0x13,0x60,0xfc,
-0x37,0xf0,0x20,0x9c,0x6e,0x06,0xcd,0x9f,0x7a,0x99,0xe6,0xe0,0x6f,0xfe,0xf7,0xfe,
-0x9e,0x6e,0x03,0x5f,0xa5,0x8d,0xc9,0xe6,0xe0,0xcf,0xff,0xfa,0xbb,0x9d,0x6e,0x01,
-0x2f,0x72,0x89,0x99,0x17,0xe0,0x00,0xe6,0x07,0x9c,0x44,0xd8,0x00,0x00,0x4f,0x10,
-0x34,0x8f,0x38,0x08,0xf6,0x34,0xea,0xcd,0xfc,0xc7,0x16,0x8f,0x75,0x6b,0xcf,0xbb,
-0x40,0xbc,0xfc,0x99,0xb8,0xf5,0xf5,0x0f,0xaf,0xac,0x9e,0xdf,0xcf,0x50,0xfc,0xfc,
-0xc9,0xdc,0xfa,0xf5,0x0f,0x8e,0x8c,0x46,0x9f,0xaf,0x20,0xcd,0xfc,0xac,0xdd,0xdf,
-0xe7,0x14,0x7f,0x54,0xdd,0xde,0xfe,0xa5,0xff,0xff,0xf7,0xf7,0x6f,0x83,0x01,0x5f,
-0x21,0x0b,0xb4,0xf4,0x00,0x04,0xf1,0x00,0x07,0xf7,0x42,0x10,0x8c,0x5b,0x5c,0xf0,
-0x02,0x02,0xad,0xfa,0x60,0x08,0xf0,0x00,0x2c,0xfd,0xc8,0x22,0x9f,0x32,0x10,0x3f,
-0x85,0x0e,0x33,0x52,0xf0,0x1b,0xcb,0x90,0xe9,0x8f,0x2f,0x71,0xfe,0xee,0x8e,0x77,
-0xe0,0xf7,0x09,0x8d,0xd5,0xef,0xff,0xef,0x70,0x00,0xbb,0x3e,0xbb,0xf7,0xf7,0x2a,
-0xdf,0xfb,0xe7,0x7e,0x0f,0x72,0xfc,0xeb,0x2e,0x77,0xe0,0xf7,0x00,0x0b,0x90,0xef,
-0xd3,0x25,0x45,0xb9,0x0e,0xa5,0x55,0xa3,0x45,0x12,0x41,0x05,0x05,0x21,0x70,0x2f,
-0xe4,0x0e,0xe0,0xf5,0xf4,0x12,0xf7,0x07,0xdf,0xaa,0x4f,0xff,0xff,0x70,0x0b,0xc8,
-0x12,0xd7,0x80,0xb0,0xf9,0xf3,0xdf,0xff,0xff,0xf2,0x6f,0xaf,0x85,0xf8,0x45,0xbf,
-0x69,0x10,0x1f,0xe0,0x35,0xf0,0x0d,0x3f,0x31,0xf7,0x45,0xf5,0x03,0x69,0xfd,0x5f,
-0xfe,0xff,0x50,0xaf,0xef,0x96,0xf8,0x68,0xfb,0x20,0x03,0xf3,0xef,0xed,0xcf,0xb2,
-0x00,0x3f,0x30,0x8f,0x8a,0x09,0x01,0x00,0xf9,0x3f,0x60,0x00,0x00,0x9e,0x5d,0x10,
+0xc0,0x00,0x8c,0xcb,0xf4,0xbf,0xcf,0xd5,0x04,0x52,0x7a,0xb8,0x20,0x28,0x12,0xee,
+0x01,0x00,0xf4,0x12,0xe4,0x00,0x6a,0xaa,0xaa,0xaa,0x80,0x00,0x07,0xbb,0xbb,0xbb,
+0xb9,0x00,0x00,0x69,0x99,0x99,0x99,0x90,0x00,0x0b,0xc4,0x44,0x44,0xaf,0x00,0x00,
+0xbe,0xcc,0xcc,0xce,0xf0,0x60,0x01,0xf0,0x0d,0x0e,0x30,0x07,0xc0,0x0e,0x60,0x00,
+0xb6,0x0a,0xff,0xff,0xff,0x75,0xff,0xfe,0x28,0x8f,0xc8,0x81,0x16,0x66,0x51,0x88,
+0xfc,0x88,0x00,0xdf,0xfa,0x78,0x0b,0xf1,0x1f,0x05,0x55,0x35,0x7b,0x8a,0x68,0x10,
+0xdf,0xf9,0xce,0xf6,0xf8,0xf5,0x03,0x44,0x38,0xbf,0x8f,0xac,0x60,0xee,0xfa,0xac,
+0xfa,0xed,0xc7,0x0e,0x28,0xac,0xef,0xc9,0xed,0x10,0xef,0xf9,0x27,0xe3,0xdf,0x4c,
+0x0e,0x53,0x28,0xfb,0xa7,0xbf,0x90,0xb0,0x00,0x14,0x20,0x0b,0x01,0xf3,0x3d,0x20,
+0xff,0xff,0xff,0xf8,0x00,0xc6,0x08,0xbf,0x9c,0xf8,0x4b,0xff,0xff,0x2d,0x8a,0xa5,
+0x00,0x46,0x66,0x68,0xfe,0xff,0xee,0x22,0xff,0xfc,0xff,0x9b,0xf8,0x60,0x15,0x55,
+0x4c,0xf8,0xaf,0x76,0x02,0xff,0xfa,0x2f,0xab,0xf9,0x70,0x15,0x55,0x42,0xfe,0xff,
+0xee,0x53,0xff,0xfb,0x6d,0xa9,0x9a,0x80,0x3f,0x09,0xb2,0x8f,0xac,0xf6,0x03,0xff,
+0xfb,0x58,0xef,0xfc,0x62,0x3f,0x54,0x3d,0xd8,0x36,0xbf,0xf3,0x05,0xf9,0x40,0x03,
+0xf4,0x0b,0xef,0xff,0xee,0x80,0x0b,0xd0,0x00,0x2f,0x70,0x00,0x4d,0xee,0xc5,0xee,
+0xee,0xee,0x22,0x66,0x66,0x8b,0xbb,0xbb,0xb5,0x0d,0xff,0x9b,0x6c,0x2c,0x3c,0x70,
+0x67,0x75,0xac,0xdb,0xec,0xe6,0x0c,0xcc,0x94,0xcc,0xcc,0xcc,0x10,0x78,0x85,0x5f,
+0x99,0x9b,0xf1,0x0d,0xce,0x95,0xf9,0x99,0xbf,0x10,0xd5,0xa9,0x5f,0xaa,0xac,0xf1,
+0x0d,0xff,0x94,0xcd,0x18,0xe9,0x20,0xd7,0x34,0xeb,0x20,0x06,0xe6,0x00,0x6b,0x0b,
+0xf1,0x26,0x3d,0x00,0x6d,0x00,0x5b,0x00,0x0c,0x6a,0xac,0xcc,0x6e,0x59,0x05,0xff,
+0x86,0xcc,0xcb,0xff,0x70,0x07,0xca,0x47,0x77,0x1b,0xad,0x14,0xfe,0xf7,0x66,0x6a,
+0xff,0xf5,0x27,0x67,0x8e,0xcf,0x55,0x58,0x15,0x8d,0xb9,0xb7,0xfb,0x6e,0x94,0x34,
+0x5b,0xc6,0x55,0x64,0x63,0x00,0x2b,0xe9,0x0a,0xf2,0x06,0x3f,0xdc,0xd6,0x2a,0xf8,
+0x00,0x00,0x74,0x6e,0xff,0xfc,0x64,0x20,0x3f,0xfe,0xa6,0x47,0xbe,0xff,0x30,0x20,
+0x57,0x00,0x20,0x09,0xd5,0x00,0x07,0x11,0x05,0x68,0x09,0x41,0x07,0xfc,0x11,0xaf,
+0x50,0x08,0x00,0xf5,0x01,0x82,0x05,0xeb,0x44,0x44,0x4c,0xe0,0x00,0x0e,0x51,0x08,
+0x4f,0xeb,0x33,0x33,0x3c,0x0d,0x00,0x02,0xe0,0x02,0x7d,0xe3,0x04,0xfb,0x50,0x02,
+0xff,0xa2,0x00,0x03,0xbf,0xb0,0x02,0x54,0x00,0xf0,0x13,0x20,0x00,0x0e,0xff,0xf8,
+0x00,0xe9,0x00,0x00,0xe9,0x3f,0x80,0x0e,0x90,0x00,0x0e,0x81,0xe8,0x00,0xea,0x33,
+0x10,0xef,0xff,0x80,0x0e,0xff,0xf6,0x0e,0x70,0xe8,0x00,0xea,0x22,0x0d,0x00,0x00,
+0x1a,0x00,0xf7,0x17,0x92,0xe8,0xcf,0xff,0xfe,0x00,0xe9,0x4f,0x8c,0xeb,0xbe,0xe0,
+0x0e,0xff,0xf8,0xc8,0x00,0x9e,0x00,0x7d,0x4d,0x2c,0x80,0x09,0xe0,0x2f,0xa0,0xcc,
+0xcf,0xff,0xfe,0x04,0xc1,0x02,0x2c,0xc6,0x6b,0xd0,0x23,0x04,0xf0,0x42,0x51,0x00,
+0x00,0xff,0xff,0xf1,0x3f,0x30,0x00,0x0f,0x86,0x8f,0x17,0xf1,0x00,0x00,0xf4,0x13,
+0xf1,0xcf,0x77,0x72,0x0f,0x5f,0x6f,0x4f,0xfe,0xff,0x50,0xf5,0xf6,0xfb,0xf2,0x0c,
+0x80,0x0f,0x5f,0x6f,0xdf,0x70,0xf4,0x00,0xf6,0xf6,0xf2,0x8e,0x6f,0x10,0x0f,0x8f,
+0x4e,0x10,0xef,0x90,0x00,0x09,0xd8,0x10,0x09,0xf6,0x00,0x04,0xf6,0xcb,0x06,0xfd,
+0xf5,0x04,0xf9,0x03,0xe8,0xf8,0x08,0xf5,0x05,0x00,0x00,0x04,0x00,0x04,0x00,0xf2,
+0x41,0x00,0x0e,0x80,0x0d,0xff,0xff,0x00,0xce,0xff,0xe7,0x45,0x5b,0xf0,0x05,0x6f,
+0xb6,0x30,0x00,0x8f,0x00,0x22,0xe9,0x21,0x22,0x29,0xf0,0x3f,0xff,0xff,0xcb,0xff,
+0xff,0x00,0x32,0xad,0x22,0xbc,0x22,0x20,0x0c,0x99,0xe6,0x4b,0xb0,0x07,0x30,0xd9,
+0x9f,0xe9,0xbc,0x22,0xd8,0x0e,0xfa,0xd0,0x08,0xff,0xff,0x40,0xff,0xfd,0x00,0x02,
+0x33,0x20,0x2f,0x9f,0xfb,0x97,0x77,0x77,0x66,0xf0,0x3a,0xef,0xff,0xff,0xf8,0x04,
+0x00,0x01,0x00,0xf3,0x3f,0x4f,0x20,0x8f,0xff,0xff,0x32,0xee,0xfe,0xe2,0x7f,0x68,
+0xf2,0x16,0x9f,0x86,0x08,0xe0,0x6f,0x11,0x26,0xf4,0x23,0xf9,0x5b,0xf0,0x7f,0xff,
+0xff,0xed,0x1c,0xfa,0x03,0x66,0xf9,0x63,0x75,0x66,0x50,0x1e,0x4f,0x72,0x3f,0xee,
+0xfe,0x01,0xf4,0xfe,0xd4,0xf3,0x09,0xe0,0x2f,0xcf,0x50,0x3f,0xfe,0xfe,0x04,0xff,
+0xf5,0x01,0x44,0x44,0x40,0x7e,0x9f,0xe9,0x87,0x77,0x78,0x59,0xa0,0x5b,0xef,0xff,
+0xff,0xf5,0x01,0x55,0x00,0xf3,0x0a,0xef,0xff,0xff,0xff,0xf1,0x00,0x0e,0xc7,0x77,
+0x77,0xcf,0x10,0x00,0xe9,0x00,0x00,0x09,0xf1,0x00,0x0e,0xb3,0x33,0x33,0xaf,0x10,
+0x1a,0x00,0xf3,0x1e,0x03,0x44,0x5f,0xa4,0x44,0x00,0x00,0x7d,0x21,0xf9,0x22,0x21,
+0x00,0x0b,0xf0,0x1f,0xff,0xff,0xc0,0x00,0xef,0x61,0xfa,0x44,0x43,0x00,0x5f,0xdf,
+0x8f,0x80,0x00,0x00,0x2e,0xd0,0xbf,0xfc,0x87,0x77,0x52,0xd2,0x00,0x4a,0xdf,0xff,
+0xf6,0x54,0x00,0xf5,0x8e,0x0f,0xff,0xf7,0xff,0xff,0xff,0x50,0xf7,0x4f,0x7f,0xc8,
+0x88,0x82,0x0f,0x40,0xe7,0xf8,0x00,0x00,0x00,0xfb,0x9f,0x7f,0xb6,0x66,0x30,0x0b,
+0xcf,0xc5,0xff,0xff,0xf8,0x00,0x24,0xf1,0x0f,0x80,0x0e,0x80,0x1f,0x6f,0xc6,0xf8,
+0x00,0xe8,0x01,0xf6,0xfa,0x4f,0xff,0xff,0x80,0x1f,0x6f,0x10,0xfb,0x77,0x73,0x01,
+0xf9,0xfe,0x9f,0x80,0x00,0x00,0x8f,0xfc,0x82,0xff,0xff,0xff,0x84,0x61,0x00,0x08,
+0x88,0x88,0x85,0x0f,0xff,0xf8,0xff,0xff,0xfe,0x00,0xf7,0x4f,0x8f,0xa5,0x5a,0xe0,
+0x0f,0x40,0xe8,0xf8,0x33,0x9e,0x00,0xf8,0x5f,0x8f,0xff,0xff,0xe0,0x0f,0xff,0xf8,
+0xf9,0x44,0xae,0x00,0x44,0xf0,0x1f,0xdb,0xbd,0xe0,0x1f,0x5f,0xf7,0xfa,0xcc,0x59,
+0x01,0xf5,0xf6,0x4f,0x64,0xf8,0xf4,0x1f,0x5f,0x01,0xf6,0x0e,0xf5,0x01,0xf9,0xfd,
+0x8f,0x73,0xaf,0x40,0x9f,0xfd,0x89,0xff,0xf6,0xdf,0x53,0x61,0x00,0x5d,0x83,0x01,
+0xb1,0x00,0x01,0x00,0xf6,0x91,0x02,0x40,0x00,0x00,0xff,0xff,0x70,0xaf,0x10,0x00,
+0x0f,0x95,0xf7,0x0f,0xff,0xfc,0x00,0xf6,0x0e,0x79,0xf8,0x6f,0x80,0x0f,0x95,0xfb,
+0xff,0xa7,0xf2,0x00,0xef,0xff,0xac,0x7f,0xf9,0x00,0x04,0x3f,0x30,0x06,0xff,0xb3,
+0x00,0xf5,0xfd,0xad,0xf8,0x4d,0xf9,0x0f,0x5f,0x86,0xef,0xee,0xef,0x10,0xf5,0xf3,
+0x08,0xf6,0x6b,0xe0,0x0f,0x7f,0xcc,0x8e,0x00,0x8e,0x07,0xff,0xfe,0x98,0xf6,0x6c,
+0xe0,0x5a,0x62,0x00,0x8f,0xdd,0xee,0x00,0x0f,0xff,0xf0,0x3f,0x5f,0x40,0x00,0xf8,
+0x8f,0x86,0xf5,0xf5,0xb2,0x0f,0x45,0xfe,0xcf,0x5f,0x9f,0x40,0xf8,0x8f,0x8f,0xf5,
+0xfe,0xc0,0x0e,0xff,0xf3,0xef,0x5f,0xf5,0x00,0x56,0xd0,0x03,0xf5,0xf6,0x00,0x0f,
+0x7f,0xf3,0xbf,0x4f,0xf8,0x00,0xf7,0xe9,0xff,0xf3,0xfb,0xf7,0x0f,0x7d,0x09,0xae,
+0x2f,0x46,0x10,0xfb,0xff,0x5e,0xa2,0xf4,0x64,0x8f,0xfb,0x7c,0xf2,0x1f,0x9c,0x92,
+0x30,0x00,0xd6,0x00,0xcf,0xf3,0xaa,0x00,0xf4,0x43,0x51,0x43,0x26,0x01,0xff,0xf5,
+0x5f,0x2b,0x76,0xd0,0x1f,0x5f,0x7e,0xa0,0xd7,0x8b,0x01,0xf1,0xef,0xf3,0x0f,0xeb,
+0xe0,0x1f,0x6f,0xb6,0xfb,0xfc,0xff,0x71,0xff,0xf5,0x9f,0xa7,0x5a,0x5a,0x16,0xa5,
+0x5f,0xd0,0x05,0xe0,0x02,0xfa,0xdf,0xed,0x3d,0x6e,0x00,0x2f,0xac,0x56,0xd4,0xe5,
+0xff,0x72,0xfa,0x50,0x5d,0x5f,0x6f,0x52,0x3f,0xcd,0xa5,0xd7,0xfc,0xe0,0x08,0xfd,
+0x95,0x5d,0xcb,0xff,0x75,0x11,0x00,0x05,0xeb,0x06,0xbd,0x70,0x5a,0x00,0x21,0x01,
+0x20,0x07,0x00,0xf0,0x06,0x9f,0x10,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0x10,0x00,
+0x07,0xf6,0x55,0x59,0xf1,0x00,0x00,0x7f,0xfe,0xee,0x0d,0x00,0x51,0xf3,0x22,0x28,
+0xf9,0xd0,0x1a,0x00,0xa0,0xf7,0x00,0x07,0xf4,0x22,0x29,0xfb,0x00,0x3f,0xff,0x27,
+0x00,0xf6,0x0a,0x01,0x66,0x66,0x8e,0xfe,0xf1,0x00,0x00,0x01,0x9f,0xd4,0x6f,0x10,
+0x01,0x6c,0xfe,0x85,0x7c,0xf0,0x00,0x2f,0xb5,0x00,0x6f,0xe8,0xb5,0x00,0x60,0x01,
+0xf7,0x00,0x00,0x00,0xcf,0x2e,0x00,0x90,0xf4,0x05,0x66,0x68,0xfb,0x66,0x66,0x10,
+0x0d,0x0d,0x00,0x84,0x40,0x00,0xdb,0x45,0xf9,0x47,0xf4,0x00,0x0d,0x00,0x35,0x34,
+0xf9,0x36,0x0d,0x00,0x70,0x34,0x45,0xf9,0x44,0x41,0x02,0xff,0x01,0x00,0xc5,0xfa,
+0x06,0x66,0x67,0xfa,0x66,0x66,0x40,0x00,0x00,0x1f,0x70,0x53,0x00,0xf0,0x17,0x06,
+0xf0,0x00,0x07,0xf0,0x00,0x5d,0xef,0xdc,0x00,0x7f,0x00,0x02,0x6a,0xf6,0x63,0x5a,
+0xf5,0x51,0x2f,0xff,0xfb,0xaf,0xff,0xff,0x42,0xf6,0xd7,0xca,0xa6,0xe1,0xf4,0x2f,
+0xff,0xfc,0xaa,0x6e,0x1f,0x0d,0x00,0xf6,0x15,0xed,0xfc,0xf4,0x2f,0xff,0xfb,0xae,
+0xdf,0xbf,0x42,0x49,0xf4,0x4a,0xa6,0xe1,0xf4,0x9f,0xff,0xff,0xca,0x6e,0x1f,0x40,
+0x17,0xf1,0x1a,0xff,0xff,0xf4,0x00,0x6f,0x00,0xac,0x55,0x6e,0x30,0x55,0x00,0xf8,
+0x3d,0x09,0xc0,0x00,0x2c,0xdf,0xca,0x44,0x9f,0x54,0x21,0x8b,0xf8,0x6f,0xff,0xff,
+0xf9,0x0b,0xdf,0xb7,0x2d,0x82,0xb7,0x10,0xf9,0xea,0xa7,0xf4,0x0a,0xf2,0x0f,0xff,
+0xfc,0xfc,0x30,0x6f,0xa0,0xf8,0xea,0xa4,0xbd,0x4f,0x80,0x0f,0xff,0xfa,0x03,0xfd,
+0xe0,0x00,0x28,0xf2,0x20,0x0c,0xf7,0x00,0x5f,0xff,0xfd,0x04,0xff,0xd1,0x00,0x27,
+0xf2,0x28,0xfb,0x5e,0xf7,0x00,0x6f,0x00,0xc6,0x00,0x1a,0x50,0x00,0x01,0x00,0xf1,
+0x05,0x11,0x6f,0x31,0x1f,0x8a,0x50,0x08,0xff,0xff,0xf4,0xf7,0x9f,0x30,0x44,0x8f,
+0x64,0x4f,0x94,0xb3,0x2f,0xde,0x00,0xf0,0x19,0x90,0x12,0x6e,0x32,0x1e,0x90,0x00,
+0x0c,0xef,0xff,0xe9,0xdb,0x7f,0x10,0x5a,0xbf,0x9a,0x3b,0xcd,0xb0,0x08,0xec,0xfb,
+0xf4,0x9f,0xf5,0x00,0x8c,0x9f,0x7e,0x46,0xfc,0x20,0x04,0x79,0xf7,0x73,0xbf,0x76,
+0xb0,0x2c,0x00,0x81,0xdf,0xea,0x00,0x04,0xf0,0x0b,0x51,0xac,0xaa,0x01,0xf4,0x41,
+0x10,0x00,0x00,0x0d,0x70,0x00,0x0d,0x80,0x00,0x9f,0xff,0xf3,0x0a,0xef,0x40,0x03,
+0x5e,0xa5,0x18,0xf3,0xaf,0x30,0x49,0xfc,0x9a,0xfc,0x56,0xff,0x56,0xdd,0xbf,0xbc,
+0xee,0xee,0xc3,0x6e,0xec,0xf3,0x44,0x44,0x44,0x06,0xcc,0x9f,0x7f,0xff,0xff,0xf0,
+0x6f,0xfe,0xf7,0xd8,0x8e,0x6f,0x02,0x4e,0xa4,0x6f,0xee,0xfe,0xf0,0xbf,0xff,0xf9,
+0xea,0xae,0x9f,0x01,0x2e,0x92,0x6d,0x88,0xe9,0xf0,0x00,0xd7,0x05,0xd6,0x6a,0xaa,
+0xac,0x01,0xf0,0x24,0x8f,0x11,0x4f,0xff,0xfe,0x07,0xff,0xff,0xe4,0xf4,0x1a,0xe0,
+0x24,0x9f,0x44,0x4f,0xff,0xfe,0x03,0xff,0xff,0xb5,0x77,0x77,0x73,0x3f,0x5c,0x7b,
+0xff,0xff,0xff,0x93,0xff,0xff,0xb4,0xf5,0x2a,0xe0,0x3f,0x7c,0x8b,0x3f,0xff,0xfd,
+0x03,0xff,0xff,0xb3,0xf7,0x5b,0xd0,0x27,0x00,0xf3,0x07,0xba,0xdd,0x09,0xff,0xff,
+0xf8,0xf9,0x8d,0xf6,0x01,0x7f,0x13,0xfe,0xcb,0xdf,0x40,0x06,0xe0,0x00,0x00,0x08,
+0xd0,0x55,0x00,0xf0,0x07,0x0e,0x60,0x00,0x3f,0x50,0x00,0x8d,0xfe,0xd2,0x3e,0xbf,
+0x40,0x03,0x5f,0xa6,0xaf,0x81,0x6f,0xb2,0x6f,0xff,0xf9,0xdb,0x01,0xf4,0x73,0xbc,
+0x8f,0x26,0x64,0x13,0x60,0x6f,0xff,0xf7,0xff,0x9c,0x6e,0x06,0xcd,0x9f,0x7a,0x99,
+0xe6,0xe0,0x6f,0xfe,0xf7,0xfe,0x9e,0x6e,0x03,0x5f,0xa5,0x8d,0xc9,0xe6,0xe0,0xcf,
+0xff,0xfa,0xbb,0x9d,0x6e,0x01,0x2f,0x72,0x89,0x99,0x17,0xe0,0x00,0xe6,0x07,0x9c,
+0x44,0xd8,0x00,0x00,0x4f,0x10,0x34,0x8f,0x44,0x23,0xff,0xff,0xea,0xcd,0xfc,0xc7,
+0x16,0x8f,0x75,0x6b,0xcf,0xbb,0x40,0xbc,0xfc,0x99,0xb8,0xf5,0xf5,0x0f,0xaf,0xac,
+0x9e,0xdf,0xcf,0x50,0xfc,0xfc,0xc9,0xdc,0xfa,0xf5,0x0f,0x8e,0x8c,0x46,0x9f,0xaf,
+0x20,0xcd,0xfc,0xac,0xdd,0xdf,0xe7,0x14,0x7f,0x54,0xdd,0xde,0xfe,0xa5,0xff,0xff,
+0xf7,0xf7,0x6f,0x83,0x01,0x5f,0x21,0x0b,0xb4,0xf4,0x00,0x04,0xf1,0x00,0x07,0xfd,
+0x10,0xa2,0x01,0xf4,0x3e,0x8c,0x00,0x00,0x8f,0x00,0x02,0xad,0xfa,0x60,0x08,0xf0,
+0x00,0x2c,0xfd,0xc8,0x22,0x9f,0x32,0x10,0x3f,0x85,0x0e,0xff,0xff,0xf7,0x09,0xcb,
+0x90,0xe9,0x8f,0x2f,0x71,0xfe,0xee,0x8e,0x77,0xe0,0xf7,0x09,0x8d,0xd5,0xef,0xff,
+0xef,0x70,0x00,0xbb,0x3e,0xbb,0xf7,0xf7,0x2a,0xdf,0xfb,0xe7,0x7e,0x0f,0x72,0xfc,
+0xeb,0x2e,0x77,0xe0,0xf7,0x00,0x0b,0x90,0xef,0xff,0xff,0x70,0x00,0xb9,0x0e,0xa5,
+0x55,0xf7,0x55,0x00,0x12,0x41,0x05,0x05,0x20,0x70,0x2f,0x5e,0x04,0xf9,0x38,0xff,
+0xf5,0xf4,0x12,0xf7,0x07,0xdf,0xaa,0x4f,0xff,0xff,0x70,0x0b,0xc8,0x12,0x44,0x44,
+0x43,0x00,0xf9,0xf3,0xdf,0xff,0xff,0xf2,0x6f,0xaf,0x85,0xf8,0x45,0xf8,0x07,0xff,
+0xff,0x1f,0xff,0xff,0x50,0x00,0x3f,0x31,0xf7,0x45,0xf5,0x03,0x69,0xfd,0x5f,0xfe,
+0xff,0x50,0xaf,0xef,0x96,0xf8,0x68,0xfb,0x20,0x03,0xf3,0xef,0xed,0xcf,0xb2,0x00,
+0x3f,0x30,0x00,0x01,0xf5,0x00,0x01,0x00,0xf8,0x3f,0x60,0x00,0x00,0x9e,0x5d,0x10,
 0x2f,0xa0,0x00,0x09,0xe1,0xea,0x00,0x6f,0x6a,0xbb,0xef,0xbd,0xb2,0x00,0x71,0xbb,
 0xdf,0xfd,0xbb,0x23,0x55,0x30,0x0b,0xff,0xc0,0x00,0x8f,0xf8,0x03,0xfe,0xfe,0xb0,
 0x00,0x0e,0x80,0xdc,0x9e,0x4f,0x80,0x00,0xe9,0xbf,0x39,0xe0,0x8f,0x20,0x0e,0x9b,
 0x60,0x9e,0x00,0x50,0x05,0xfd,0x30,0x07,0xb0,0x00,0x06,0xfc,0xcf,0xc9,0x88,0x89,
-0xb5,0x3b,0x00,0x49,0xcd,0xed,0xdc,0x20,0x11,0x6a,0x20,0xb6,0x00,0x6a,0x30,0xf9,
-0x35,0x0a,0xf5,0x0f,0xa3,0x36,0xf3,0x00,0x0d,0x70,0xfe,0xcc,0xdf,0x30,0x00,0x00,
-0x0f,0xa5,0x57,0xf3,0x02,0x66,0x30,0xfd,0xbb,0xcf,0x30,0x6f,0xf8,0x0f,0xc9,0xb8,
-0xc6,0x00,0x0e,0x80,0xf8,0x7f,0x9f,0xc0,0x00,0xe8,0x0f,0x80,0x9f,0xc0,0x00,0x0e,
-0x86,0xff,0xf7,0x6f,0x70,0x00,0xfb,0x5d,0x95,0x10,0x78,0x04,0xed,0xde,0x96,0x54,
-0x56,0x74,0x3d,0x00,0x6c,0x82,0xb2,0x02,0x34,0x0b,0xf0,0x27,0x9b,0x00,0x6b,0x20,
-0x3f,0xb0,0x06,0xf5,0x0e,0xc0,0x00,0x5f,0x6e,0xef,0xef,0xff,0xe5,0x00,0x40,0x67,
-0x6c,0xf6,0x77,0x21,0x44,0x27,0xf0,0x9e,0x09,0xe0,0x7f,0xf7,0x7f,0x09,0xe0,0x9e,
-0x01,0x2f,0x77,0xf9,0xdf,0x9d,0xe0,0x00,0xf7,0x5b,0xbf,0xeb,0xba,0x00,0x0f,0x70,
-0x07,0xf5,0x52,0x4c,0x20,0x1c,0xfa,0x5b,0x87,0x97,0xee,0xeb,0x65,0x66,0x86,0x3d,
-0x10,0x6b,0xef,0x0a,0x7d,0x01,0xb6,0x00,0x20,0xb3,0x03,0x87,0x2a,0xa0,0x1c,0xf4,
-0x03,0xb8,0x5e,0xd2,0x00,0x1d,0xb0,0x18,0xee,0x4a,0x11,0x20,0x89,0x48,0x80,0x11,
-0x05,0xf5,0x8f,0x49,0xf0,0x8f,0xf8,0x0d,0x00,0xa1,0x03,0x5f,0x85,0xf5,0x8f,0x39,
-0xf0,0x00,0xe8,0x5f,0x00,0x51,0xf3,0x06,0x85,0xf2,0x6f,0x19,0xf0,0x02,0xfa,0x5f,
-0x25,0xf6,0xfb,0x05,0xfb,0xdd,0x75,0x44,0x56,0x74,0x3c,0x00,0x7d,0xb6,0x00,0x00,
-0xbc,0x08,0x10,0x00,0x53,0x17,0xe1,0x02,0xfd,0x1c,0xee,0xff,0xee,0xe4,0x03,0xf7,
-0x55,0x5b,0xf5,0x55,0x10,0x23,0x34,0xf0,0x0b,0xe0,0x35,0x53,0x8f,0x3a,0xf3,0xbe,
-0x08,0xff,0x88,0xf5,0xbf,0x5b,0xe0,0x24,0xf8,0x6d,0xef,0xfe,0xdc,0x00,0x0e,0x80,
-0x2e,0xff,0xf8,0xd4,0xaf,0xf0,0x05,0xb9,0xe4,0xed,0x10,0x2f,0xb8,0x60,0x9e,0x01,
-0x60,0x5f,0xdd,0xea,0x66,0x56,0x68,0x64,0xc0,0x06,0xbe,0x7e,0x67,0x04,0x8e,0x15,
-0x42,0x11,0x1a,0xe1,0x11,0x1d,0x8d,0xf1,0x1b,0xf2,0x00,0xca,0x46,0x6c,0xf6,0x64,
-0x00,0x01,0x07,0xfe,0xff,0xef,0x80,0x37,0x73,0x7f,0x5b,0xf5,0xf8,0x06,0xef,0x77,
-0xfa,0xdf,0xaf,0x80,0x00,0xf7,0x7f,0xbe,0xfb,0xf8,0x00,0x0f,0x86,0x77,0xcf,0x77,
-0x61,0x00,0xf9,0x1e,0x05,0x20,0x6f,0x90,0xdc,0x17,0x93,0x6f,0xdf,0xd8,0x67,0x87,
-0x8a,0x75,0xb0,0x4b,0xa0,0xa3,0x16,0x01,0x05,0x01,0x30,0xc4,0x08,0xff,0x0e,0x31,
-0xf5,0x35,0xf2,0x8e,0x35,0x53,0xae,0x00,0x2f,0x98,0xd3,0xac,0x48,0xe0,0x00,0x40,
-0x8d,0x9e,0xec,0x9e,0x00,0x00,0x09,0xc7,0xcd,0x89,0xe0,0x5d,0xd7,0xab,0x67,0x77,
-0x9e,0x03,0x8f,0x8c,0xab,0xff,0xd8,0xe0,0x00,0xf9,0xf7,0xb7,0x6d,0x8e,0x00,0x0f,
-0xef,0x39,0xdd,0xda,0xe0,0x00,0xfd,0x90,0x00,0x0b,0xf9,0x03,0xde,0xbf,0xb6,0x54,
-0x56,0x74,0x2e,0x20,0x39,0xef,0x05,0x01,0xe0,0x07,0x20,0x05,0xd3,0x85,0x00,0x02,
-0xee,0x20,0xde,0x0c,0xd0,0x00,0x02,0x95,0x8f,0xf1,0x16,0xff,0x40,0x01,0x6f,0xf9,
-0x5f,0xb5,0x51,0x00,0x05,0xef,0xfe,0xff,0xeb,0x05,0xff,0x81,0xf9,0x5f,0xb5,0x40,
-0x26,0xf8,0x1f,0xed,0xfe,0xd9,0x00,0x0f,0x81,0xf9,0x4f,0xa4,0x30,0x00,0xf8,0x1f,
-0x98,0xac,0xf0,0x00,0xd4,0xf9,0x55,0x55,0x52,0x3e,0xeb,0xfb,0x65,0x45,0x56,0x42,
-0xe2,0x03,0x9e,0x49,0x39,0x07,0x1b,0x05,0x00,0x10,0x02,0xf0,0x39,0xd7,0x08,0xe0,
-0x00,0x2f,0xb3,0x8d,0xd7,0xef,0xee,0x40,0x5e,0x7c,0xfb,0xcf,0x55,0x51,0x00,0x00,
-0x4f,0x54,0xae,0xed,0x15,0xcc,0x65,0xff,0xd2,0x6f,0x90,0x5d,0xf8,0x6e,0x6c,0x18,
-0xe1,0x00,0x0f,0x87,0xc6,0xce,0xff,0xf5,0x00,0xf8,0xb9,0x7b,0x18,0xd1,0x00,0x0f,
-0xcf,0x59,0xa2,0x9d,0x00,0x02,0xfe,0xb8,0xf5,0x8f,0x90,0x04,0xfd,0xdf,0xb8,0x66,
-0x78,0xa4,0x2d,0x10,0x6c,0xf3,0x1e,0x02,0x57,0x00,0x30,0x1a,0x40,0xef,0x9f,0x06,
-0xf0,0x04,0xde,0x1e,0x71,0x66,0x16,0xf1,0x03,0xf6,0x8e,0xdf,0xfd,0xc9,0x10,0x02,
-0x01,0x77,0xdd,0x76,0x10,0xf0,0xc6,0xf1,0x09,0xfd,0xf7,0x07,0xff,0x74,0xf9,0xee,
-0x9f,0x70,0x37,0xf7,0x4f,0x8d,0xe8,0xf7,0x00,0x0f,0x73,0x99,0xee,0x99,0x40,0x00,
-0xf7,0x34,0x00,0xfa,0x04,0x7f,0xc3,0x22,0xcc,0x22,0x20,0x5f,0x9d,0xfa,0x78,0x86,
-0x79,0x51,0xb0,0x06,0xce,0xff,0xff,0xe3,0x98,0xb3,0x10,0xcc,0x2f,0x18,0xd0,0x10,
-0x04,0xfa,0x06,0xe2,0x26,0xf1,0x00,0x07,0x60,0x6f,0xed,0x4f,0x34,0x8a,0xf3,0x25,
+0xb5,0x3b,0x00,0x49,0xcd,0xed,0xdc,0x20,0x5a,0x00,0xf0,0x3c,0x01,0xb6,0x00,0xff,
+0xff,0xff,0x30,0x0a,0xf5,0x0f,0xa3,0x36,0xf3,0x00,0x0d,0x70,0xfe,0xcc,0xdf,0x30,
+0x00,0x00,0x0f,0xa5,0x57,0xf3,0x02,0x66,0x30,0xfd,0xbb,0xcf,0x30,0x6f,0xf8,0x0f,
+0xc9,0xb8,0xc6,0x00,0x0e,0x80,0xf8,0x7f,0x9f,0xc0,0x00,0xe8,0x0f,0x80,0x9f,0xc0,
+0x00,0x0e,0x86,0xff,0xf7,0x6f,0x70,0x00,0xfb,0x5d,0x95,0x10,0x78,0x04,0xed,0xde,
+0x96,0x54,0x56,0x74,0x3d,0x00,0x6c,0xd2,0x03,0x00,0x52,0x00,0x05,0x5c,0x00,0xf0,
+0x28,0x40,0x00,0x9b,0x00,0x6b,0x20,0x3f,0xb0,0x06,0xf5,0x0e,0xc0,0x00,0x5f,0x6e,
+0xef,0xef,0xff,0xe5,0x00,0x40,0x67,0x6c,0xf6,0x77,0x21,0x44,0x27,0xf0,0x9e,0x09,
+0xe0,0x7f,0xf7,0x7f,0x09,0xe0,0x9e,0x01,0x2f,0x77,0xf9,0xdf,0x9d,0xe0,0x00,0xf7,
+0x5b,0xbf,0xeb,0xba,0x00,0x0f,0x70,0x07,0xfc,0x00,0xf9,0x04,0xfa,0x1c,0xfa,0x00,
+0x00,0x02,0xdf,0xee,0xeb,0x65,0x66,0x86,0x3d,0x10,0x6b,0xef,0xff,0xff,0x60,0xb6,
+0x00,0xf0,0x13,0xb3,0x03,0xff,0xff,0xff,0xa0,0x1c,0xf4,0x03,0xb8,0x5e,0xd2,0x00,
+0x1d,0xb0,0x18,0xff,0xe1,0x00,0x00,0x20,0x5f,0xff,0xff,0xff,0x00,0x11,0x05,0xf5,
+0x8f,0x49,0xf0,0x8f,0xf8,0x0d,0x00,0x91,0x03,0x5f,0x85,0xf5,0x8f,0x39,0xf0,0x00,
+0xe8,0x1a,0x00,0xf2,0x07,0x0e,0x85,0xf2,0x6f,0x19,0xf0,0x02,0xfa,0x5f,0x25,0xf6,
+0xfb,0x05,0xfb,0xdd,0x75,0x44,0x56,0x74,0x3c,0x00,0x7d,0xb6,0x00,0x00,0x01,0x00,
+0xf3,0x3f,0x05,0x00,0x00,0x09,0xe0,0x00,0x02,0xfd,0x1c,0xee,0xff,0xee,0xe4,0x03,
+0xf7,0x55,0x5b,0xf5,0x55,0x10,0x02,0x07,0xff,0xff,0xff,0xe0,0x35,0x53,0x8f,0x3a,
+0xf3,0xbe,0x08,0xff,0x88,0xf5,0xbf,0x5b,0xe0,0x24,0xf8,0x6d,0xef,0xfe,0xdc,0x00,
+0x0e,0x80,0x2e,0xff,0xf8,0x00,0x00,0xe9,0x9f,0xb9,0xe4,0xed,0x10,0x2f,0xb8,0x60,
+0x9e,0x01,0x60,0x5f,0xdd,0xea,0x66,0x56,0x68,0x64,0xc0,0x06,0xbe,0xff,0xff,0xe5,
+0xaa,0x00,0x80,0x08,0x70,0x11,0x1a,0xe1,0x11,0x00,0x9f,0x82,0x00,0xf1,0x1b,0xf2,
+0x00,0xca,0x46,0x6c,0xf6,0x64,0x00,0x01,0x07,0xfe,0xff,0xef,0x80,0x37,0x73,0x7f,
+0x5b,0xf5,0xf8,0x06,0xef,0x77,0xfa,0xdf,0xaf,0x80,0x00,0xf7,0x7f,0xbe,0xfb,0xf8,
+0x00,0x0f,0x86,0x77,0xcf,0x77,0x61,0x00,0xf9,0x1e,0x05,0xf9,0x04,0x6f,0x90,0x00,
+0x9e,0x00,0x00,0x6f,0xdf,0xd8,0x67,0x87,0x8a,0x75,0xb0,0x4b,0xff,0xff,0xff,0xf6,
+0x5f,0x01,0x30,0x01,0xc4,0x08,0x9d,0x00,0xf5,0x36,0x0d,0xf2,0x8e,0x35,0x53,0xae,
+0x00,0x2f,0x98,0xd3,0xac,0x48,0xe0,0x00,0x40,0x8d,0x9e,0xec,0x9e,0x00,0x00,0x09,
+0xc7,0xcd,0x89,0xe0,0x5d,0xd7,0xab,0x67,0x77,0x9e,0x03,0x8f,0x8c,0xab,0xff,0xd8,
+0xe0,0x00,0xf9,0xf7,0xb7,0x6d,0x8e,0x00,0x0f,0xef,0x39,0xdd,0xda,0xe0,0x00,0xfd,
+0x90,0x00,0x0b,0xf9,0x03,0xde,0xbf,0xb6,0x54,0x56,0x74,0x2e,0x20,0x39,0xef,0x05,
+0x01,0xf0,0x01,0x07,0x20,0x05,0xd3,0x85,0x00,0x02,0xee,0x20,0xde,0x0c,0xd0,0x00,
+0x02,0xf7,0x8f,0x89,0x00,0xf8,0x2b,0x01,0x6f,0xf9,0x5f,0xb5,0x51,0x00,0x05,0xef,
+0xfe,0xff,0xeb,0x05,0xff,0x81,0xf9,0x5f,0xb5,0x40,0x26,0xf8,0x1f,0xed,0xfe,0xd9,
+0x00,0x0f,0x81,0xf9,0x4f,0xa4,0x30,0x00,0xf8,0x1f,0xff,0xff,0xff,0x60,0x1f,0xd4,
+0xf9,0x55,0x55,0x52,0x3e,0xeb,0xfb,0x65,0x45,0x56,0x42,0xe2,0x03,0x9e,0xff,0xff,
+0xf5,0x1b,0x05,0x00,0x10,0x02,0xf3,0x3c,0xd7,0x08,0xe0,0x00,0x2f,0xb3,0x8d,0xd7,
+0xef,0xee,0x40,0x5e,0x7c,0xfb,0xcf,0x55,0x51,0x00,0x00,0x4f,0x54,0xae,0xed,0x15,
+0xcc,0x65,0xff,0xd2,0x6f,0x90,0x5d,0xf8,0x6e,0x6c,0x18,0xe1,0x00,0x0f,0x87,0xc6,
+0xce,0xff,0xf5,0x00,0xf8,0xb9,0x7b,0x18,0xd1,0x00,0x0f,0xcf,0x59,0xa2,0x9d,0x00,
+0x02,0xfe,0xb8,0xf5,0x8f,0x90,0x04,0xfd,0xdf,0xb8,0x66,0x78,0xa4,0x2d,0x10,0x6c,
+0xff,0xff,0xfe,0xd2,0x03,0x30,0x1a,0x40,0xef,0x9f,0x06,0xf1,0x20,0xde,0x1e,0x71,
+0x66,0x16,0xf1,0x03,0xf6,0x8e,0xdf,0xfd,0xc9,0x10,0x02,0x01,0x77,0xdd,0x76,0x10,
+0x00,0x00,0x4f,0xdf,0xfd,0xf7,0x07,0xff,0x74,0xf9,0xee,0x9f,0x70,0x37,0xf7,0x4f,
+0x8d,0xe8,0xf7,0x00,0x0f,0x73,0x99,0xee,0x99,0x40,0x00,0xf7,0x34,0x00,0xf4,0x04,
+0x7f,0xc3,0x22,0xcc,0x22,0x20,0x5f,0x9d,0xfa,0x78,0x86,0x79,0x51,0xb0,0x06,0xce,
+0xff,0xff,0xe3,0xad,0x00,0x02,0x5d,0x00,0xf2,0x3f,0xcc,0x00,0x6f,0xff,0xff,0x10,
+0x04,0xfa,0x06,0xe2,0x26,0xf1,0x00,0x07,0x60,0x6f,0xed,0x4f,0x10,0x00,0x00,0x06,
 0xe3,0xe4,0xf1,0x06,0xdd,0x66,0xdf,0xdf,0xdf,0xc0,0x4a,0xf7,0x7f,0x77,0x77,0xaf,
 0x00,0x0f,0x77,0xf5,0xff,0xe5,0xf0,0x00,0xf7,0x7f,0x6b,0x4e,0x5f,0x00,0x0f,0x77,
 0xf6,0xfe,0xe7,0xf0,0x07,0xf9,0x8f,0x23,0x03,0xfb,0x08,0xfa,0xfd,0x86,0x66,0x78,
-0xaa,0x59,0x02,0x9e,0x6d,0x85,0x10,0x10,0x37,0x0c,0xd2,0x07,0xa0,0x08,0x80,0x02,
-0xf9,0x04,0x9f,0x66,0xfa,0x41,0x07,0xf5,0xe6,0xa3,0xf0,0x0b,0x00,0x66,0xfc,0x66,
-0x20,0x37,0x74,0x2f,0xa8,0x89,0xf6,0x06,0xdf,0x82,0xfe,0xdd,0xdf,0x60,0x00,0xe8,
-0x2f,0x73,0x34,0xf6,0x00,0x0e,0x16,0x09,0x00,0x0d,0x00,0x60,0x72,0x24,0xf6,0x00,
-0x0f,0xa2,0x0d,0x00,0xa3,0x3d,0xee,0xd8,0x54,0x45,0x57,0x44,0xd0,0x07,0xcf,0x60,
-0x01,0x11,0x10,0x14,0x02,0xf0,0x2b,0x2b,0x70,0x00,0x00,0xed,0x24,0xaf,0xee,0xff,
-0x50,0x03,0xdc,0x69,0x49,0x5e,0x90,0x00,0x01,0x10,0xc9,0xee,0x70,0x00,0x3a,0xa6,
-0xdf,0xfd,0x87,0x75,0x03,0xaf,0x92,0xeb,0xbf,0x98,0x60,0x00,0xf9,0x9e,0xce,0xfc,
-0xcc,0x30,0x0f,0x94,0x85,0x9f,0x67,0x81,0x00,0xf9,0x3f,0x58,0xf4,0xae,0x00,0x2f,
-0xc5,0x44,0x02,0xa7,0x4f,0xdd,0xfa,0x76,0x67,0x89,0x52,0xd1,0x06,0xcf,0x05,0x01,
-0x02,0x65,0x02,0x20,0xc5,0x0c,0x98,0x8e,0x30,0x0b,0xf3,0xc7,0x63,0x39,0xf0,0x21,
-0x1e,0x7c,0xff,0xee,0xef,0xc0,0x00,0x10,0xc8,0xe5,0xd7,0xc8,0x01,0x22,0x1d,0x9c,
-0xce,0xcd,0x50,0x5f,0xf7,0xe7,0xd2,0xb5,0x48,0x01,0x2f,0x9f,0x9f,0xef,0xed,0x90,
-0x00,0xfd,0xe9,0xa4,0xf9,0x44,0x00,0x0f,0xe9,0xde,0xef,0xee,0xe2,0x02,0xfd,0x50,
-0x72,0x5b,0xa0,0xec,0x8f,0xb6,0x56,0x66,0xa3,0x3d,0x10,0x29,0xef,0x6e,0x08,0x08,
-0x68,0x2d,0x10,0xd5,0x72,0x54,0xa0,0xf0,0x0c,0xf3,0xc9,0x8b,0xd8,0x6f,0x00,0x2f,
-0x9c,0x0d,0x00,0xf0,0x1d,0x00,0x40,0xba,0x49,0xd9,0x49,0x31,0x33,0x15,0xcf,0xb9,
-0xfd,0xa1,0x5f,0xf8,0x8d,0xfe,0xef,0xdb,0x01,0x2f,0x82,0x5f,0x89,0xf5,0x30,0x00,
-0xf9,0xee,0xff,0xff,0xee,0x40,0x0f,0x83,0x9f,0x88,0xf8,0x31,0x00,0xfc,0x9f,0xa0,
-0x08,0xc0,0x02,0x60,0xd6,0x44,0x49,0x74,0x2e,0x20,0x35,0x0b,0x0a,0x2b,0x13,0xf0,
-0x03,0xb8,0x01,0xfb,0x99,0xbf,0x40,0x03,0xf7,0x1f,0x50,0x04,0xf4,0x00,0x09,0x91,
-0xfc,0xbb,0xcf,0x59,0x08,0xf3,0x25,0xca,0xab,0xf4,0x07,0xee,0x78,0x99,0xee,0x99,
-0x82,0x37,0xf8,0xf9,0xc5,0x6c,0x5f,0x40,0x0f,0x83,0xf8,0x99,0x9c,0x10,0x00,0xf8,
-0xdd,0xff,0xdd,0xdd,0x40,0x0f,0x70,0x3f,0xca,0xbc,0x00,0x08,0xfb,0xae,0x70,0xad,
-0xb0,0x07,0xf7,0xef,0xc7,0x69,0xa9,0xca,0x3a,0x01,0x9e,0x85,0x81,0x16,0x10,0x0e,
-0xa6,0x10,0x0d,0x86,0x16,0xf6,0x36,0x09,0xf2,0xd7,0xa8,0x8a,0x6f,0x00,0x2f,0x8d,
-0xee,0xef,0xee,0xe0,0x00,0x40,0x7a,0x00,0xe8,0xc0,0x04,0xaa,0x5e,0x8e,0x6f,0xbf,
-0xa3,0x6d,0xf9,0xef,0xbe,0xf8,0xf7,0x20,0x2f,0x6b,0xec,0xaf,0xff,0xe0,0x02,0xf9,
-0xda,0xa8,0xf9,0xf8,0x00,0x2f,0x7b,0xcb,0x4f,0x8f,0x70,0x07,0xfc,0x9c,0x87,0xff,
-0xff,0x68,0xfa,0xfe,0x97,0x7c,0x78,0x96,0x3b,0x01,0x8e,0xff,0xb6,0x00,0x22,0x05,
-0x60,0x39,0x4d,0xf0,0x15,0x00,0x0d,0xff,0xf3,0x06,0x6b,0xf8,0x62,0xda,0x7f,0xa0,
-0xdf,0xff,0xff,0x5d,0x75,0xf4,0x00,0xe6,0x0d,0xb0,0xd7,0x9e,0x00,0x1c,0xb4,0xf6,
-0x1d,0x7e,0x80,0x3f,0xff,0xff,0xfa,0xd8,0xda,0xaf,0x3d,0xf1,0x06,0x1d,0x74,0xf3,
-0x09,0xff,0xff,0xf2,0xd7,0x0e,0x70,0x9e,0x66,0xaf,0x2d,0x94,0xf7,0x09,0xd0,0x05,
-0xf2,0xda,0xd9,0x81,0x81,0x2d,0x73,0x00,0x09,0xe6,0x69,0xe2,0xd7,0xe3,0x87,0xf0,
+0xaa,0x59,0x02,0x9e,0xff,0xff,0xff,0x80,0x57,0x00,0xf0,0x01,0x02,0x00,0x07,0xa0,
+0x08,0x80,0x02,0xf9,0x04,0x9f,0x66,0xfa,0x41,0x07,0xf5,0xff,0x37,0x09,0xf0,0x0c,
+0x04,0x00,0x66,0xfc,0x66,0x20,0x37,0x74,0x2f,0xa8,0x89,0xf6,0x06,0xdf,0x82,0xfe,
+0xdd,0xdf,0x60,0x00,0xe8,0x2f,0x73,0x34,0xf6,0x00,0x0e,0x16,0x09,0x00,0x0d,0x00,
+0x60,0x72,0x24,0xf6,0x00,0x0f,0xa2,0x0d,0x00,0xa3,0x3d,0xee,0xd8,0x54,0x45,0x57,
+0x44,0xd0,0x07,0xcf,0x60,0x01,0x11,0x10,0x14,0x02,0xf0,0x2b,0x2b,0x70,0x00,0x00,
+0xed,0x24,0xaf,0xee,0xff,0x50,0x03,0xdc,0x69,0x49,0x5e,0x90,0x00,0x01,0x10,0xc9,
+0xee,0x70,0x00,0x3a,0xa6,0xdf,0xfd,0x87,0x75,0x03,0xaf,0x92,0xeb,0xbf,0x98,0x60,
+0x00,0xf9,0x9e,0xce,0xfc,0xcc,0x30,0x0f,0x94,0x85,0x9f,0x67,0x81,0x00,0xf9,0x3f,
+0x58,0xf4,0xae,0x00,0x2f,0xc5,0x44,0x02,0xa7,0x4f,0xdd,0xfa,0x76,0x67,0x89,0x52,
+0xd1,0x06,0xcf,0x05,0x01,0x02,0x65,0x02,0xf0,0x3c,0xc5,0x0c,0xff,0xff,0xff,0xd0,
+0x0b,0xf3,0xc7,0x00,0x00,0xad,0x00,0x1e,0x7c,0xff,0xee,0xef,0xc0,0x00,0x10,0xc8,
+0xe5,0xd7,0xc8,0x01,0x22,0x1d,0x9c,0xce,0xcd,0x50,0x5f,0xf7,0xe7,0xd2,0xb5,0x48,
+0x01,0x2f,0x9f,0x9f,0xef,0xed,0x90,0x00,0xfd,0xe9,0xa4,0xf9,0x44,0x00,0x0f,0xe9,
+0xde,0xef,0xee,0xe2,0x02,0xfd,0x50,0x00,0xf6,0x00,0x02,0xec,0x8f,0xb6,0x56,0x66,
+0xa3,0x3d,0x10,0x29,0xef,0x6e,0x08,0x17,0x00,0x8f,0x09,0xf0,0x00,0xd5,0x0c,0xff,
+0xbd,0xff,0xf0,0x0c,0xf3,0xc9,0x8b,0xd8,0x6f,0x00,0x2f,0x9c,0x0d,0x00,0xf0,0x1d,
+0x00,0x40,0xba,0x49,0xd9,0x49,0x31,0x33,0x15,0xcf,0xb9,0xfd,0xa1,0x5f,0xf8,0x8d,
+0xfe,0xef,0xdb,0x01,0x2f,0x82,0x5f,0x89,0xf5,0x30,0x00,0xf9,0xee,0xff,0xff,0xee,
+0x40,0x0f,0x83,0x9f,0x88,0xf8,0x31,0x00,0xfc,0x9f,0xa0,0x08,0xc0,0x02,0x76,0xd6,
+0x44,0x49,0x74,0x2e,0x20,0x3a,0xc0,0x02,0x03,0x01,0x00,0xf0,0x03,0xb8,0x01,0xfb,
+0x99,0xbf,0x40,0x03,0xf7,0x1f,0x50,0x04,0xf4,0x00,0x09,0x91,0xfc,0xbb,0xcf,0x59,
+0x08,0xf2,0x26,0xca,0xab,0xf4,0x07,0xee,0x78,0x99,0xee,0x99,0x82,0x37,0xf8,0xf9,
+0xc5,0x6c,0x5f,0x40,0x0f,0x83,0xf8,0x99,0x9c,0x10,0x00,0xf8,0xdd,0xff,0xdd,0xdd,
+0x40,0x0f,0x70,0x3f,0xca,0xbc,0x00,0x08,0xfb,0xae,0x70,0xad,0xb0,0x07,0xf7,0xef,
+0xc7,0x69,0xa9,0xca,0x3a,0x01,0x9e,0xff,0x7b,0x04,0x06,0xba,0x00,0x10,0xca,0xbc,
+0x08,0xf6,0x37,0xf0,0x09,0xf2,0xd7,0xa8,0x8a,0x6f,0x00,0x2f,0x8d,0xee,0xef,0xee,
+0xe0,0x00,0x40,0x7a,0x00,0xe8,0xc0,0x04,0xaa,0x5e,0x8e,0x6f,0xbf,0xa3,0x6d,0xf9,
+0xef,0xbe,0xf8,0xf7,0x20,0x2f,0x6b,0xec,0xaf,0xff,0xe0,0x02,0xf9,0xda,0xa8,0xf9,
+0xf8,0x00,0x2f,0x7b,0xcb,0x4f,0x8f,0x70,0x07,0xfc,0x9c,0x87,0xff,0xff,0x68,0xfa,
+0xfe,0x97,0x7c,0x78,0x96,0x3b,0x01,0x8e,0xff,0xb6,0x00,0x12,0x05,0xdf,0x04,0xf0,
+0x3d,0xae,0x00,0x0d,0xff,0xf3,0x06,0x6b,0xf8,0x62,0xda,0x7f,0xa0,0xdf,0xff,0xff,
+0x5d,0x75,0xf4,0x00,0xe6,0x0d,0xb0,0xd7,0x9e,0x00,0x1c,0xb4,0xf6,0x1d,0x7e,0x80,
+0x3f,0xff,0xff,0xfa,0xd8,0xda,0x00,0x22,0x22,0x22,0x1d,0x74,0xf3,0x09,0xff,0xff,
+0xf2,0xd7,0x0e,0x70,0x9e,0x66,0xaf,0x2d,0x94,0xf7,0x09,0xd0,0x05,0xf2,0xda,0xff,
+0x20,0x9f,0xff,0xff,0x2d,0x73,0x00,0x09,0xe6,0x69,0xe2,0xd7,0x00,0xb9,0x09,0xf0,
 0x02,0xbc,0xff,0xff,0x61,0x5a,0xbf,0x64,0x67,0x78,0xf6,0x02,0x89,0xe3,0x10,0x00,
-0x1f,0x60,0xd7,0x09,0xf2,0x0a,0x01,0xf6,0x0f,0x89,0xbc,0x76,0x88,0x8f,0x60,0xf7,
-0x7a,0xc7,0xcf,0xdd,0xf6,0x0f,0xd3,0xdf,0x7c,0xc0,0x03,0x10,0xf5,0x00,0xc7,0x33,
-0x41,0xf0,0x0b,0x7c,0xc0,0x03,0x20,0xf4,0x11,0xc7,0xcc,0x00,0x8d,0x0f,0xff,0xff,
-0x7b,0xf8,0x8e,0xa0,0xf6,0x33,0xb6,0x4d,0xee,0xd3,0x00,0x01,0x51,0xb4,0x01,0x20,
-0xbd,0xfe,0xbe,0x86,0xf0,0x15,0x1a,0x9f,0x10,0xe6,0xe8,0x7e,0x60,0xc5,0xf5,0xde,
-0x8e,0x99,0xf6,0x0d,0x8f,0x99,0xcd,0xef,0xdd,0x50,0x88,0xf8,0x35,0xad,0xfa,0xa0,
-0x5f,0xff,0xfe,0x47,0xbf,0x77,0x01,0x2c,0xf5,0x6f,0x25,0x13,0xf3,0x0a,0xff,0xe2,
-0x0d,0x50,0xe5,0x00,0xbe,0xf9,0xbc,0xee,0xcf,0xc7,0x4f,0x6f,0x01,0x66,0xbf,0x66,
-0x21,0x74,0xf0,0x0a,0xef,0xfe,0xe2,0x44,0x66,0x01,0xc9,0x9b,0xe3,0x60,0x00,0x0d,
-0xef,0xff,0xff,0xec,0x10,0x01,0x56,0x56,0xf8,0x11,0x11,0x4b,0x7d,0x02,0x0e,0x0a,
-0x14,0x30,0xeb,0x58,0xb3,0x67,0xfa,0x69,0xf4,0x00,0x0c,0xd7,0x8f,0xb7,0x9f,0x40,
-0x12,0x59,0x72,0x05,0x55,0x6f,0xa5,0x55,0x40,0x03,0xa3,0x3d,0x64,0x44,0x44,0x5f,
-0x94,0x44,0x42,0xc5,0x40,0x20,0x8f,0xcc,0xa9,0x8f,0x20,0x08,0xf9,0x90,0x5c,0x80,
-0x00,0x8f,0x88,0x88,0x8d,0xe0,0x00,0x04,0xe9,0x3e,0x13,0x00,0x21,0x00,0x21,0x17,
-0x88,0x44,0x2f,0xf2,0x03,0xbd,0x78,0xfb,0x7a,0xf3,0x00,0x0b,0xeb,0xbf,0xdb,0xcf,
-0x30,0x00,0x8b,0xaa,0xfc,0xaa,0xb2,0x7b,0x1c,0x54,0x70,0x02,0x22,0x23,0xf8,0x1b,
-0x1b,0x15,0xfa,0xf8,0xac,0x00,0xe2,0x16,0xa1,0x01,0xcf,0xf9,0x00,0x8f,0x10,0x01,
-0xdf,0x26,0xf7,0x72,0x99,0x10,0xfb,0x3f,0x08,0x30,0x15,0xf8,0x3d,0x60,0x96,0x63,
-0x5f,0x95,0xbb,0xef,0xcb,0x50,0xfc,0x16,0x20,0x2f,0x69,0xc8,0x16,0x30,0x98,0xfa,
-0xc0,0x0d,0x00,0x90,0x7f,0xba,0x20,0x8f,0x10,0x01,0xce,0xff,0xc3,0xe2,0x16,0x12,
-0x63,0x49,0x9b,0x12,0x36,0xd1,0x15,0x20,0xf4,0x0c,0xdf,0x7d,0xf0,0x2c,0xfc,0xf9,
-0x59,0xf8,0xbf,0x04,0xf7,0x0b,0xb0,0x5f,0x18,0xf0,0x3f,0xff,0xd2,0x06,0xf0,0x9f,
-0x00,0x3a,0xc4,0x01,0x8f,0x1a,0xe0,0x05,0xbd,0x52,0xcf,0xff,0xfd,0x01,0xff,0xff,
-0x77,0xde,0x9e,0xc0,0x06,0x8b,0x83,0x0c,0xa0,0xda,0x00,0xe9,0xbf,0x30,0xe8,0x0e,
-0x90,0x07,0xad,0xc3,0x1f,0x60,0xf8,0x02,0xdf,0x01,0x60,0x41,0xfd,0x09,0x52,0x04,
-0x89,0x70,0x03,0x6d,0x24,0x40,0xb0,0x03,0xe4,0x23,0xb1,0x64,0xf1,0x0b,0x7f,0xff,
-0xf4,0x07,0xf9,0x4e,0x6c,0xb4,0x6f,0x10,0x8f,0xff,0xd1,0xee,0xef,0xd0,0x01,0x2b,
-0xc4,0x46,0x66,0xbc,0x62,0x25,0xbc,0x5c,0x27,0x55,0xf4,0x15,0xff,0x5a,0x3f,0xa5,
+0x1f,0x60,0xd7,0x09,0xf0,0x0b,0x01,0xf6,0x0f,0x89,0xbc,0x76,0x88,0x8f,0x60,0xf7,
+0x7a,0xc7,0xcf,0xdd,0xf6,0x0f,0xd3,0xdf,0x7c,0xc0,0x03,0x10,0xf5,0x00,0xc7,0xcc,
+0xc9,0x0b,0xf0,0x0c,0xff,0x7c,0xc0,0x03,0x20,0xf4,0x11,0xc7,0xcc,0x00,0x8d,0x0f,
+0xff,0xff,0x7b,0xf8,0x8e,0xa0,0xf6,0x33,0xb6,0x4d,0xee,0xd3,0x00,0x01,0x51,0xb4,
+0x01,0xf1,0x3d,0xbd,0xfe,0x7e,0xff,0xff,0xf6,0x1a,0x9f,0x10,0xe6,0xe8,0x7e,0x60,
+0xc5,0xf5,0xde,0x8e,0x99,0xf6,0x0d,0x8f,0x99,0xcd,0xef,0xdd,0x50,0x88,0xf8,0x35,
+0xad,0xfa,0xa0,0x5f,0xff,0xfe,0x47,0xbf,0x77,0x01,0x2c,0xf5,0x6f,0xff,0xff,0xfb,
+0x02,0xff,0xe2,0x0d,0x50,0xe5,0x00,0xbe,0xf9,0xbc,0xee,0xcf,0xc7,0x4f,0x6f,0x01,
+0x66,0xbf,0x66,0x21,0x74,0xf0,0x0a,0xef,0xfe,0xe2,0x00,0x4f,0x00,0x00,0x7e,0xf3,
+0x00,0xf1,0x02,0x12,0x35,0x60,0x00,0x0d,0xef,0xff,0xff,0xec,0x10,0x01,0x56,0x56,
+0xf8,0x11,0x11,0x01,0x30,0x09,0x12,0xf8,0x0e,0x0a,0x22,0x30,0x0c,0x28,0x0a,0xc1,
+0xcd,0x67,0xfa,0x69,0xf4,0x00,0x0c,0xd7,0x8f,0xb7,0x9f,0x40,0x63,0x0a,0x90,0xf4,
+0x00,0x05,0x55,0x6f,0xa5,0x55,0x40,0x03,0x20,0x00,0x83,0xfc,0x00,0x44,0x44,0x5f,
+0x94,0x44,0x42,0x6b,0x09,0xf3,0x0b,0x00,0x8f,0xcc,0xcc,0xce,0xe0,0x00,0x08,0xf9,
+0x99,0x99,0xde,0x00,0x00,0x8f,0x88,0x88,0x8d,0xe0,0x00,0x04,0x88,0x88,0x88,0x88,
+0x00,0x21,0x00,0x10,0x17,0x0d,0x00,0xf0,0x07,0x30,0x00,0xbd,0x78,0xfb,0x7a,0xf3,
+0x00,0x0b,0xeb,0xbf,0xdb,0xcf,0x30,0x00,0x8b,0xaa,0xfc,0xaa,0xb2,0x00,0x0f,0x20,
+0x00,0x82,0x70,0x02,0x22,0x23,0xf8,0x22,0x22,0x12,0x97,0x0a,0x04,0xad,0x02,0xf0,
+0x06,0xe7,0x00,0x08,0xf1,0x00,0x01,0xcf,0xf9,0x00,0x8f,0x10,0x01,0xdf,0x26,0xf7,
+0x08,0xf1,0x00,0x0e,0xff,0xfb,0x3f,0x08,0xf0,0x0e,0x15,0xf8,0x3d,0xff,0xff,0xf7,
+0x05,0x5f,0x95,0xbb,0xef,0xcb,0x50,0xff,0xff,0xf3,0x08,0xf1,0x00,0x04,0x2f,0x69,
+0x00,0x8f,0x10,0x00,0x98,0xfa,0xc0,0x0d,0x00,0xf0,0x00,0x7f,0xba,0x20,0x8f,0x10,
+0x01,0xce,0xff,0xc3,0x08,0xf1,0x00,0x09,0x63,0x00,0x1a,0x00,0x21,0x00,0x36,0x55,
+0x00,0xf4,0x3e,0x0c,0xf4,0x0c,0xff,0xff,0xf1,0x07,0xfc,0xf9,0x59,0xf8,0xbf,0x04,
+0xf7,0x0b,0xb0,0x5f,0x18,0xf0,0x3f,0xff,0xd2,0x06,0xf0,0x9f,0x00,0x3a,0xc4,0x01,
+0x8f,0x1a,0xe0,0x05,0xbd,0x52,0xcf,0xff,0xfd,0x01,0xff,0xff,0x77,0xde,0x9e,0xc0,
+0x06,0x8b,0x83,0x0c,0xa0,0xda,0x00,0xe9,0xbf,0x30,0xe8,0x0e,0x90,0x07,0xad,0xc3,
+0x1f,0x60,0xf8,0x02,0xdf,0xfe,0xef,0xff,0xff,0xfd,0x09,0x52,0x04,0x77,0x77,0x77,
+0x21,0x07,0xf5,0x3d,0x09,0xb0,0x03,0xe4,0x23,0x00,0x06,0xff,0x90,0x7f,0xff,0xf4,
+0x07,0xf9,0x4e,0x6c,0xb4,0x6f,0x10,0x8f,0xff,0xd1,0xee,0xef,0xd0,0x01,0x2b,0xc4,
+0x46,0x66,0xbc,0x62,0x25,0xbc,0x5c,0xff,0xff,0xff,0x56,0xff,0xff,0x5a,0x3f,0xa5,
 0xc1,0x16,0x8a,0x82,0xf4,0xee,0xea,0x00,0xf9,0xbd,0x04,0x8f,0xed,0x00,0x08,0xad,
 0xb7,0xec,0xf6,0xfa,0x06,0xef,0xfc,0x78,0x6f,0x34,0xf3,0x37,0x30,0x00,0x3f,0xc1,
-0x6d,0x06,0x00,0xf2,0x57,0xf0,0x0a,0xe6,0x1f,0x30,0x03,0xff,0xc2,0x9f,0xca,0xfb,
+0x6d,0x06,0xf0,0x0d,0x07,0xc0,0x00,0xe6,0x1f,0x30,0x03,0xff,0xc2,0x9f,0xca,0xfb,
 0x33,0xf9,0x2d,0xca,0xfc,0xbf,0xc4,0x3f,0xff,0xd2,0x2e,0x83,0xf5,0x10,0x3a,0xd4,
 0x96,0x02,0xf5,0x1e,0x05,0xbd,0x55,0x99,0x99,0x99,0x61,0xff,0xff,0x75,0xaa,0xaa,
 0xa0,0x08,0x8b,0x94,0x7e,0x66,0xaf,0x00,0xe9,0xcf,0x27,0xfe,0xef,0xf0,0x06,0x9d,
 0xb4,0x7e,0x44,0x9f,0x01,0xae,0xff,0x87,0xe5,0x59,0xf0,0x0c,0x96,0x30,0x7f,0xdd,
-0xef,0x4b,0x03,0xf7,0x42,0x88,0x03,0x33,0x1a,0x81,0x00,0x03,0xff,0x7f,0xf8,0xef,
+0xef,0x4b,0x03,0xfa,0x44,0x88,0x03,0x33,0x1a,0x81,0x00,0x03,0xff,0x7f,0xf8,0xef,
 0xff,0x30,0x2e,0x85,0xf2,0xf6,0x7d,0xce,0x90,0x1f,0xff,0x75,0xd3,0x9d,0xce,0xa0,
 0x03,0xaa,0x1b,0xd7,0xce,0xef,0x30,0x05,0xbb,0x4e,0xfb,0xae,0xda,0x20,0x1f,0xff,
 0xa0,0x8a,0xbe,0xeb,0x40,0x06,0x89,0x8d,0xc8,0x7c,0xb7,0x20,0x0b,0xac,0xaa,0xf8,
 0xff,0xff,0x90,0x06,0xbc,0x86,0xf7,0x1a,0x91,0x10,0x1c,0xff,0xce,0xcf,0xba,0x73,
-0x40,0x0b,0x73,0x7b,0x04,0xad,0xa0,0xab,0x02,0x57,0x03,0xf0,0x06,0xd0,0x07,0x0e,
+0x40,0x0b,0x73,0x7b,0x04,0xad,0xff,0xc0,0x38,0x09,0xf0,0x07,0x05,0xd0,0x07,0x0e,
 0x74,0x50,0x03,0xff,0xc3,0xe5,0xe7,0xda,0x04,0xfa,0x1b,0xea,0x9e,0x9e,0x40,0x4e,
-0xff,0xf4,0xd6,0x01,0xc0,0x29,0xe5,0x0f,0x74,0x4d,0xa0,0x05,0x9f,0x53,0xff,0xff,
-0xfa,0x18,0x17,0xf5,0x15,0x85,0x5d,0xa0,0x08,0x6e,0x76,0xfb,0x99,0xea,0x00,0xd8,
-0xed,0x4f,0xfe,0xef,0xa0,0x05,0x9f,0xd7,0x4c,0x68,0x92,0x02,0xff,0xeb,0xbd,0xd1,
-0x4f,0x90,0x06,0x20,0x07,0xa1,0x00,0x3b,0x30,0x0b,0x2b,0x70,0x03,0x3a,0xd3,0x31,
-0x04,0xff,0xa3,0xb2,0x0e,0x90,0xf9,0x5e,0xc0,0xe7,0x1f,0x60,0x4f,0xff,0xfb,0xc1,
-0x1e,0xf9,0x25,0x4a,0xd5,0x15,0x66,0x66,0x63,0x05,0xae,0x53,0xcf,0xee,0xff,0x41,
-0xff,0xff,0x9c,0xc7,0x78,0xf4,0x06,0x8c,0x64,0xcb,0x66,0x7f,0x40,0xf9,0xcd,0x6c,
-0xff,0xff,0xe4,0x0a,0xad,0xa4,0x0e,0x97,0xe1,0x01,0xae,0xff,0xec,0xf3,0x7f,0x6e,
-0x0a,0x74,0x2e,0xc4,0x04,0xef,0x90,0x63,0x2d,0x90,0x0c,0xa0,0x12,0x4f,0x82,0x20,
-0x07,0xff,0x98,0xed,0x1f,0x90,0xf6,0x4f,0x36,0xd0,0x5f,0x30,0x6f,0xff,0xac,0xeb,
-0x08,0xf0,0x14,0x3c,0xa2,0x39,0x99,0x99,0x92,0x3a,0xed,0xa3,0xf9,0xfb,0xbf,0x03,
-0xae,0xda,0x3f,0xdf,0xee,0xf0,0x19,0xa9,0xc3,0xf6,0xfa,0x9f,0x00,0xeb,0xbb,0x18,
-0x8f,0xc8,0x80,0x08,0xbc,0xa5,0xe5,0x2d,0x91,0xcf,0xff,0x12,0x2f,0x92,0x21,0x3c,
-0x85,0x1d,0x09,0x03,0x11,0x11,0x82,0x28,0xf0,0x21,0x0a,0xb0,0xdf,0xfe,0x3f,0x50,
-0x04,0xff,0x7d,0x5e,0x37,0xf9,0x51,0xe9,0x5f,0xef,0xfb,0xdf,0xfb,0x2f,0xed,0x8d,
-0x86,0xef,0xa2,0x00,0x4b,0xb2,0xdb,0xfc,0xdc,0xc0,0x09,0xcc,0x8d,0xbf,0xa1,0x2f,
-0x30,0xbe,0xea,0x78,0x88,0x00,0x20,0x08,0x89,0xa8,0x72,0x03,0xf1,0x07,0xca,0xca,
-0x8b,0xb8,0xf5,0xf4,0x07,0xac,0x78,0x99,0x5f,0x1f,0x41,0xae,0xfd,0xab,0xb8,0xf5,
-0xf6,0x0d,0x84,0x8f,0x53,0x7d,0x11,0x0f,0x85,0x1b,0x90,0x00,0xfa,0x33,0x33,0x33,
-0x00,0x00,0x0f,0xb5,0x69,0x4c,0x00,0x0d,0x9b,0x50,0xd8,0x00,0x00,0x0f,0xc9,0xee,
-0x5f,0x00,0x7a,0x98,0x14,0x64,0x61,0x42,0xf4,0x10,0x69,0xf8,0x6e,0xe6,0x7e,0xa4,
-0x00,0x4f,0x30,0x5f,0x9d,0xf7,0x00,0x04,0xf3,0x14,0x9f,0xf3,0x00,0x00,0xbf,0xef,
-0xe0,0x7f,0xfb,0x60,0x08,0xc8,0x41,0x00,0x28,0x13,0x2f,0x02,0x6a,0x9a,0x26,0xeb,
-0x38,0x76,0x9a,0x03,0x0c,0x00,0xc1,0xef,0xf1,0xff,0xef,0xf0,0xeb,0x44,0x40,0x55,
-0x5b,0xf0,0xe9,0x8a,0xa1,0x0f,0x06,0x00,0x02,0x11,0x07,0x82,0x9a,0x41,0x09,0xfd,
-0x60,0xff,0x3c,0x00,0x6c,0xfa,0x28,0xf1,0xf8,0x29,0xf0,0x0c,0x00,0xf0,0x0e,0xef,
-0xf0,0xfa,0x22,0x23,0xb2,0x29,0xf0,0xf9,0x35,0x59,0xf5,0x48,0xf0,0xf9,0x9e,0xef,
-0xfe,0xa8,0xf0,0xf9,0x01,0xbf,0xf0,0x08,0xf0,0xf9,0x6e,0xd7,0x06,0x00,0x30,0x99,
-0x6b,0xf6,0x02,0x63,0x44,0x6f,0xa6,0xfe,0x70,0xa1,0x2f,0x10,0xf2,0x42,0x00,0x52,
-0x38,0xf2,0xf8,0x39,0xf0,0x0c,0x00,0x54,0xf9,0x27,0xf2,0xf7,0x19,0x0c,0x00,0x50,
-0x35,0x54,0x55,0x49,0xf0,0xe2,0x7b,0x71,0x98,0xf0,0xf8,0x08,0xd0,0xf7,0x08,0x07,
-0x99,0xfd,0x10,0xd8,0xf0,0xf8,0x2b,0xb3,0xf8,0x28,0xf0,0xf8,0x3f,0x50,0xe7,0x8d,
-0xf0,0xf8,0x79,0x00,0xe6,0xde,0x70,0xef,0xff,0xc1,0xff,0xff,0xee,0xb4,0xcc,0x1f,
-0x84,0xbe,0x0b,0x00,0xf0,0x09,0xb3,0x87,0x58,0x73,0xbe,0xe9,0x0e,0xca,0xdc,0x09,
-0xee,0x90,0xee,0xdf,0xc0,0x9e,0xe9,0x0f,0x96,0xcc,0x09,0xee,0x90,0xfe,0x0b,0x00,
-0xa3,0x6f,0x13,0xbd,0x7d,0xee,0x95,0x90,0xbe,0x6e,0xe7,0xcc,0x00,0x20,0x17,0xf1,
-0x7e,0x00,0x11,0xef,0xcc,0x00,0x17,0x38,0xe4,0x00,0x10,0x12,0xa2,0x9b,0x11,0xf9,
-0x90,0x9b,0x55,0xf9,0x0f,0x83,0x9f,0x08,0x0c,0x00,0x13,0x82,0x0c,0x00,0xf3,0x05,
-0x8d,0xf0,0xf9,0x09,0x30,0x03,0xfe,0x70,0xff,0xff,0xf0,0xff,0xff,0xf3,0xf9,0x28,
-0xf0,0xfa,0x26,0xf3,0x0c,0x00,0xf5,0x25,0x38,0xf0,0xfa,0x36,0xf3,0xff,0xef,0xe0,
-0xef,0xef,0xf3,0xf8,0x5c,0x51,0xa8,0x53,0xf3,0xf8,0x9f,0xb3,0xcf,0x73,0xf3,0xf8,
-0xce,0xd8,0xfc,0xe4,0xf3,0xf8,0x73,0xd5,0xe1,0x94,0xf3,0xf8,0x9a,0xf4,0xf9,0xd3,
-0xf3,0xf8,0x3a,0xe2,0xf7,0xca,0xf3,0xf8,0x2d,0x42,0xd0,0x5f,0xfa,0x5d,0x00,0x1f,
-0xac,0xf0,0x02,0x01,0xff,0xfe,0x30,0x4f,0x60,0x00,0x1f,0xaa,0xf5,0x23,0xf9,0x22,
-0x11,0xf6,0xbc,0xdf,0x63,0x1a,0xf4,0x2a,0x7f,0x7d,0x93,0x22,0x2f,0x51,0xf9,0xf4,
-0x5b,0xf0,0x00,0x52,0x1f,0x6a,0xd0,0x9f,0x03,0xd5,0x01,0xf6,0x3f,0x39,0xfb,0xfe,
-0x50,0x1f,0x86,0xf3,0x9f,0xc5,0x00,0x01,0xfb,0xfd,0x09,0xf0,0x00,0x30,0x1f,0x72,
-0x00,0x9f,0x00,0x0f,0x71,0xf6,0x00,0x08,0xf9,0x8a,0xf4,0x1f,0x60,0x00,0x2b,0xdd,
-0xda,0x49,0x1b,0xf0,0x2f,0xff,0xfb,0x0b,0xc0,0x0e,0x80,0x0f,0x9d,0xb1,0xf7,0x00,
-0xe8,0x00,0xf5,0xe7,0x7f,0x32,0x2e,0xa1,0x0f,0x6f,0x5f,0xf9,0xff,0xff,0x80,0xf9,
-0xf9,0xff,0x23,0x3f,0xa2,0x0f,0x6e,0x8c,0xf4,0x90,0xe8,0x00,0xf5,0xaa,0x5f,0x4f,
-0x2e,0x80,0x0f,0x5a,0xc5,0xf0,0xe8,0xe8,0x00,0xfb,0xf9,0x5f,0x04,0x1e,0x80,0x0f,
-0x75,0x05,0xf0,0x34,0x00,0xb1,0x00,0x5f,0x03,0x9f,0x80,0x0f,0x50,0x05,0xe0,0x2f,
-0xc2,0x0b,0x04,0x50,0x30,0x00,0x01,0xff,0xf9,0x0e,0x1d,0xf0,0x22,0x1f,0x8e,0xd1,
-0xdf,0xff,0xf8,0x01,0xf4,0xf9,0xdf,0xd4,0xbf,0x10,0x1f,0x8f,0x2a,0x6f,0xdf,0x50,
-0x01,0xfb,0xe0,0x49,0xff,0xfb,0x62,0x1f,0x4e,0xdf,0xf9,0x7b,0xef,0x41,0xf3,0x9c,
-0xa7,0x6f,0xb6,0x90,0x1f,0x39,0xd8,0xff,0xff,0xfd,0x01,0xfd,0xf7,0x79,0x7c,0x96,
-0x20,0x41,0x0d,0xd0,0x43,0x60,0xf3,0x00,0x55,0x5f,0xb5,0x51,0x86,0x2b,0x0b,0x8e,
-0x8d,0x00,0x22,0x38,0xf0,0x0d,0xff,0x90,0xf9,0xaf,0x5f,0x75,0x5f,0x90,0xf5,0xab,
-0x4f,0xa8,0x8f,0x90,0xf6,0xe7,0x4f,0xed,0xdf,0x90,0xf6,0xf6,0x4f,0x30,0x0e,0x90,
-0xf5,0x8d,0x9e,0x91,0xf8,0x15,0xf5,0x4f,0x5f,0x8e,0xa6,0x60,0xf6,0x7f,0x6f,0x3a,
-0xba,0xf1,0xf8,0xfb,0x4f,0x34,0xfe,0x40,0xf6,0x10,0x4f,0x32,0xcd,0x10,0xf5,0x00,
-0x9f,0xff,0x3f,0xe4,0xf5,0x00,0x8c,0x73,0x03,0xc1,0xe0,0x59,0xf0,0x0f,0x01,0xff,
-0xfb,0x00,0x7f,0x90,0x00,0x1f,0x8e,0xa0,0x3f,0xbf,0x80,0x01,0xf3,0xf6,0x6f,0xb0,
-0x8f,0x90,0x1f,0x6f,0x7f,0xd2,0x11,0xbf,0x81,0xf8,0xf0,0x8f,0x42,0x13,0xf8,0x1c,
-0x4e,0x60,0x33,0xf9,0x30,0x01,0xf3,0xab,0xaa,0xaf,0xda,0xa4,0x1f,0x5c,0xcb,0xbb,
-0xfd,0xbb,0x41,0xfc,0xf6,0x4b,0x0f,0x8a,0x50,0x1f,0x41,0x0d,0xa0,0xf7,0x8f,0x21,
-0xf3,0x07,0xe4,0x6f,0x70,0xd7,0x1f,0x30,0x01,0x3f,0xd2,0xa0,0x4c,0xf0,0x24,0x70,
-0x00,0x00,0xff,0xfc,0x01,0xef,0x60,0x00,0x0f,0x8d,0xb3,0xdc,0x5f,0x91,0x00,0xf4,
-0xfd,0xfd,0x89,0x4e,0xf6,0x0f,0x7f,0x69,0x04,0xf2,0x1a,0x10,0xfa,0xf0,0x7d,0xdf,
-0xdd,0x20,0x0f,0x5e,0x72,0x33,0x3c,0xd0,0x00,0xf4,0x9b,0x5c,0xcc,0xfe,0x70,0x0f,
-0x5b,0xc2,0xba,0x52,0xf7,0x09,0xfc,0xfb,0xee,0xee,0xee,0xe6,0x0f,0x52,0x03,0xde,
-0x4a,0xe4,0x10,0xf4,0x00,0x9f,0x95,0x9f,0xa0,0x0f,0x40,0x0e,0xff,0xed,0x13,0xb2,
-0x01,0x65,0x01,0x30,0xf8,0x01,0xfa,0x65,0x01,0x70,0xc0,0x9f,0xa6,0x66,0x01,0xf3,
-0xf7,0x90,0xcf,0xf0,0x19,0x1f,0x6f,0x3d,0xf2,0x07,0xf2,0x01,0xf9,0xe9,0xf6,0x11,
-0xf7,0x00,0x1f,0x4f,0x57,0xaf,0x59,0x65,0x01,0xf3,0xaa,0xec,0x44,0xef,0xf0,0x1f,
-0x4b,0xbe,0x91,0x11,0x8f,0x01,0xfb,0xf5,0xef,0xf9,0xff,0xf0,0x1f,0xd4,0x3e,0x20,
-0x7f,0x01,0xb9,0x3f,0x01,0x0d,0x00,0x35,0xa4,0x44,0x9f,0x60,0x01,0xf0,0x20,0xf9,
-0xd9,0x07,0xf0,0x30,0x0f,0x8d,0xbd,0xc5,0x8f,0xbf,0x40,0xf3,0xf7,0xdf,0xfb,0xff,
-0x50,0x0f,0x6f,0x2d,0x90,0x7f,0x25,0x10,0xf9,0xe1,0xfd,0xca,0xf5,0xe7,0x0f,0x4e,
-0x6f,0xdb,0x9f,0xfe,0x20,0xf3,0xaa,0x43,0xaf,0x43,0x20,0x0f,0x3a,0xb9,0x15,0x08,
-0xf1,0x06,0xfc,0xf8,0x9d,0x33,0x3d,0xc0,0x0f,0x54,0x09,0xfe,0xee,0xfc,0x00,0xf3,
-0x00,0x9d,0x44,0x4d,0xc0,0x0f,0x30,0x0d,0x00,0x0a,0x10,0xa3,0xf0,0x00,0xfa,0xef,
-0xff,0xff,0xf7,0x1f,0x8e,0xa4,0x44,0x44,0x44,0x21,0xf3,0xf5,0x5f,0x1b,0xaf,0x80,
-0x7f,0x15,0xf1,0x11,0x9d,0x01,0xf9,0xe0,0x84,0x40,0xf7,0x1d,0x1f,0x4f,0x54,0x77,
-0x77,0x76,0x11,0xf3,0xba,0xdf,0xdd,0xde,0xf4,0x1f,0x3b,0xbd,0x8b,0x38,0x7f,0x41,
-0xfc,0xf7,0xd8,0x9a,0xf5,0xf4,0x1f,0x54,0x0d,0x9c,0xfd,0x8f,0x41,0xf3,0x00,0xd8,
-0x0e,0x64,0xf4,0x1f,0x30,0x0d,0x80,0xe6,0x21,0x7b,0xf0,0x0a,0x01,0x71,0x00,0x03,
-0xff,0xfc,0x79,0xbf,0xc9,0x90,0x3f,0x7d,0xb8,0xdd,0xac,0xda,0x03,0xf2,0xf7,0x1a,
-0xc1,0x8f,0x20,0x3f,0x5f,0x17,0x23,0xf0,0x15,0x73,0xf8,0xf1,0x57,0x77,0x77,0x61,
-0x3f,0x2d,0x78,0xf9,0x99,0xec,0x03,0xf2,0x9c,0x8f,0xdd,0xdf,0xc0,0x3f,0x4c,0xc8,
-0xf7,0x77,0xdc,0x03,0xf9,0xe5,0x37,0x7f,0xb7,0x50,0x3f,0x20,0x3f,0x27,0x00,0x80,
-0xf2,0x01,0x44,0x5f,0xa4,0x42,0x3f,0x20,0xf5,0x59,0x07,0x01,0x00,0x00,0x7f,0x37,
-0xfb,0x3d,0xf5,0x50,0x0e,0x60,0x00,0x1f,0x7f,0xcf,0x4f,0xff,0xff,0xc1,0xf4,0xf3,
-0xe6,0xbf,0x88,0x83,0x1f,0x7e,0x03,0x7f,0x7a,0xf8,0x21,0xfa,0xb3,0x59,0x9e,0xee,
-0xeb,0x1f,0x5f,0xbf,0x94,0x99,0x99,0x21,0xf1,0xd6,0xc9,0x6f,0x89,0xf3,0x1f,0x2d,
-0x7c,0x96,0xfb,0xbf,0x31,0xfd,0xf3,0xc9,0x6f,0xcc,0xf3,0x1f,0x30,0x0d,0xb6,0xe0,
-0xbf,0x21,0xf1,0x0b,0xee,0xea,0x68,0x87,0x1f,0x10,0x92,0x18,0xce,0xed,0xa2,0x4a,
-0x11,0xcb,0x12,0x1e,0xd2,0x7f,0xeb,0xef,0xcb,0xb8,0x00,0x7f,0xe7,0x7c,0xe7,0x77,
-0x40,0x3f,0x46,0x46,0xe2,0x3b,0xe7,0x7d,0xe7,0x77,0x00,0x00,0xbe,0x77,0xde,0x77,
-0x70,0x00,0x0b,0xe2,0x66,0x53,0x78,0x46,0xf8,0x44,0x44,0xb5,0x09,0xf3,0x05,0x02,
-0x28,0xff,0xff,0xfa,0x32,0x13,0xae,0xf9,0x3f,0x57,0xff,0xb5,0x0c,0x82,0x02,0xf5,
-0x00,0x6b,0x20,0x3a,0x0b,0xf2,0x1f,0x1f,0x6f,0x30,0x9b,0xaa,0x00,0x08,0xfe,0xfe,
-0x7f,0xee,0xfd,0x14,0xff,0x8f,0x8c,0xfa,0xdb,0x60,0x3e,0xf9,0xf9,0xbf,0xbe,0xc7,
-0x00,0x6f,0xef,0xe2,0xef,0xff,0xb0,0x05,0xf9,0xf8,0x4e,0xad,0xc7,0x20,0x27,0x77,
-0x74,0x77,0x77,0x72,0x0a,0xb1,0x3c,0x50,0x35,0xff,0x74,0x6e,0xf5,0x0a,0x98,0xf5,
-0x01,0xbf,0xe4,0x00,0x01,0x79,0xbe,0xff,0xff,0xdb,0x91,0x0f,0xeb,0x84,0x03,0x8b,
-0xda,0x0c,0x2c,0xf2,0x3e,0x30,0x00,0x95,0x70,0x04,0xdd,0xfe,0xdc,0x3f,0x4f,0x40,
-0x29,0x87,0x99,0x79,0xf6,0xb7,0x20,0xc9,0xec,0xd9,0xff,0xff,0xf6,0x0c,0xaa,0xbd,
-0xdf,0xc3,0xf4,0x00,0xcf,0xff,0xf7,0xbf,0xff,0xf4,0x03,0x3b,0xa3,0x28,0xd5,0xf5,
-0x12,0xff,0xff,0xfc,0x8d,0x6f,0x71,0x2f,0x6e,0x87,0xc8,0xff,0xff,0x42,0xfc,0xee,
-0xac,0x8c,0x2f,0x20,0x2f,0x43,0x5b,0xc8,0xff,0xff,0x82,0xf0,0x05,0xc6,0x8d,0x77,
-0x73,0x04,0x16,0x99,0x34,0x01,0x11,0x8f,0x48,0x44,0xf0,0x14,0xff,0x32,0xf6,0x88,
-0x8f,0x58,0x86,0xf3,0x18,0x57,0x74,0x74,0x77,0x58,0x10,0x08,0xbc,0x7b,0x8b,0xb7,
-0x00,0x01,0x59,0xed,0xce,0xa6,0x41,0x06,0xfe,0x93,0x7d,0x26,0xae,0xf5,0x02,0x28,
-0x22,0x71,0xc1,0x00,0x02,0x47,0x33,0x9f,0xd3,0x01,0x8d,0x01,0xd7,0x23,0x34,0x15,
-0xbf,0x60,0xd4,0x07,0x03,0x55,0x00,0xf5,0x10,0x57,0x77,0xbf,0x77,0x77,0x51,0x2f,
-0xdd,0xde,0xfd,0xdd,0xef,0x32,0xf6,0xaa,0x8f,0x5a,0xa5,0xf3,0x2b,0x45,0x57,0xf3,
-0x55,0x4b,0x20,0x05,0x99,0x6b,0x49,0x95,0x75,0x50,0xa3,0xa7,0xbf,0x77,0xbf,0x00,
-0x00,0xfb,0x8c,0xf8,0x8c,0x75,0x50,0xf2,0x00,0x52,0x00,0xc6,0x18,0xf6,0x44,0x5d,
-0x80,0x00,0x00,0x2d,0xff,0xff,0xd2,0x01,0x62,0x44,0x72,0x02,0x22,0x3f,0x72,0x22,
-0x10,0x0f,0x95,0x2c,0xf3,0x03,0xf7,0x88,0x6f,0x88,0x85,0xf6,0x0a,0x58,0x85,0xf7,
-0x88,0x5a,0x40,0x06,0xdd,0x7f,0x8d,0xdb,0x78,0xc3,0x91,0x50,0x77,0x77,0x9f,0x97,
-0x77,0x73,0x01,0xff,0xb7,0xa4,0xf8,0x04,0x1f,0x87,0xf4,0xae,0x3c,0xc0,0x01,0xf5,
-0x5f,0x08,0xd3,0xcc,0x00,0x1f,0x54,0xe0,0x8c,0x8e,0x70,0x31,0x33,0xf0,0x14,0xf2,
+0xff,0xf4,0xd6,0x01,0xf0,0x25,0x29,0xe5,0x0f,0x74,0x4d,0xa0,0x05,0x9f,0x53,0xff,
+0xff,0xfa,0x01,0xff,0xff,0x9f,0x85,0x5d,0xa0,0x08,0x6e,0x76,0xfb,0x99,0xea,0x00,
+0xd8,0xed,0x4f,0xfe,0xef,0xa0,0x05,0x9f,0xd7,0x4c,0x68,0x92,0x02,0xff,0xeb,0xbd,
+0xd1,0x4f,0x90,0x06,0x20,0x07,0xa1,0x00,0x3b,0x30,0x12,0x00,0x01,0x00,0xf3,0x3f,
+0x09,0xa0,0x03,0x3a,0xd3,0x31,0x04,0xff,0xa3,0xff,0xff,0xff,0x84,0xf9,0x5e,0xc0,
+0xe7,0x1f,0x60,0x4f,0xff,0xfb,0xff,0xff,0xff,0xc0,0x4a,0xd5,0x15,0x66,0x66,0x63,
+0x05,0xae,0x53,0xcf,0xee,0xff,0x41,0xff,0xff,0x9c,0xc7,0x78,0xf4,0x06,0x8c,0x64,
+0xcb,0x66,0x7f,0x40,0xf9,0xcd,0x6c,0xff,0xff,0xe4,0x0a,0xad,0xa4,0x0e,0x97,0xe1,
+0x01,0xae,0xff,0xec,0xf3,0x7f,0x6e,0x0a,0x74,0x2e,0xc4,0x04,0xef,0x90,0x55,0x00,
+0x11,0x10,0x03,0x00,0xf0,0x90,0x0c,0xa0,0x12,0x4f,0x82,0x20,0x07,0xff,0x98,0xff,
+0xff,0xff,0x46,0xf6,0x4f,0x36,0xd0,0x5f,0x30,0x6f,0xff,0xac,0xff,0xff,0xff,0xa0,
+0x3c,0xa2,0x39,0x99,0x99,0x92,0x3a,0xed,0xa3,0xf9,0xfb,0xbf,0x03,0xae,0xda,0x3f,
+0xdf,0xee,0xf0,0x19,0xa9,0xc3,0xf6,0xfa,0x9f,0x00,0xeb,0xbb,0x18,0x8f,0xc8,0x80,
+0x08,0xbc,0xa5,0xff,0xff,0xff,0x24,0xcf,0xff,0x12,0x2f,0x92,0x21,0x3c,0x85,0x1d,
+0xff,0xff,0xff,0x90,0x00,0x11,0x00,0x00,0x00,0x30,0x00,0x0a,0xb0,0xdf,0xfe,0x3f,
+0x50,0x04,0xff,0x7d,0x5e,0x37,0xf9,0x51,0xe9,0x5f,0xef,0xfb,0xdf,0xfb,0x2f,0xed,
+0x8d,0x86,0xef,0xa2,0x00,0x4b,0xb2,0xdb,0xfc,0xdc,0xc0,0x09,0xcc,0x8d,0xbf,0xa1,
+0x2f,0x30,0xbe,0xea,0x78,0x88,0x00,0x20,0x08,0x89,0xa8,0xff,0xff,0xff,0x40,0xca,
+0xca,0x8b,0xb8,0xf5,0xf4,0x07,0xac,0x78,0x99,0x5f,0x1f,0x41,0xae,0xfd,0xab,0xb8,
+0xf5,0xf6,0x0d,0x84,0x8f,0xe4,0x00,0xf0,0x1b,0x00,0x0f,0xff,0xff,0xff,0xf0,0x00,
+0x00,0xfa,0x33,0x33,0x33,0x00,0x00,0x0f,0xb5,0x55,0x55,0x30,0x00,0x00,0xfe,0xdd,
+0xdd,0xd8,0x00,0x00,0x0f,0xc9,0x99,0x99,0x60,0x00,0x00,0xfb,0x66,0x66,0x64,0x00,
+0x1f,0xff,0xff,0x83,0x00,0xf3,0x11,0x69,0xf8,0x6e,0xe6,0x7e,0xa4,0x00,0x4f,0x30,
+0x5f,0x9d,0xf7,0x00,0x04,0xf3,0x14,0x9f,0xf3,0x00,0x00,0xbf,0xef,0xe0,0x7f,0xfb,
+0x60,0x08,0xc8,0x41,0x00,0x28,0xd3,0xfe,0x00,0xc9,0xef,0xff,0xf1,0xff,0xff,0xf0,
+0xeb,0x38,0xf1,0xf8,0x3a,0xf0,0x0c,0x00,0xff,0x01,0xef,0xf1,0xff,0xef,0xf0,0xeb,
+0x44,0x40,0x55,0x5b,0xf0,0xe9,0x00,0x00,0x00,0x08,0x06,0x00,0x03,0x20,0x07,0x8d,
+0x06,0x00,0x41,0x09,0xfd,0x60,0xff,0x3c,0x00,0x6c,0xfa,0x28,0xf1,0xf8,0x29,0xf0,
+0x0c,0x00,0xf0,0x0e,0xef,0xf0,0xfa,0x22,0x23,0xb2,0x29,0xf0,0xf9,0x35,0x59,0xf5,
+0x48,0xf0,0xf9,0x9e,0xef,0xfe,0xa8,0xf0,0xf9,0x01,0xbf,0xf0,0x08,0xf0,0xf9,0x6e,
+0xd7,0x06,0x00,0xb2,0x99,0x6b,0xf6,0x8d,0xf0,0xf9,0x00,0x6f,0xa6,0xfe,0x70,0x96,
+0x00,0x30,0xff,0xff,0xf2,0x42,0x00,0x52,0x38,0xf2,0xf8,0x39,0xf0,0x0c,0x00,0x54,
+0xf9,0x27,0xf2,0xf7,0x19,0x0c,0x00,0xfd,0x25,0x35,0x54,0x55,0x49,0xf0,0xf8,0x9f,
+0xff,0xff,0x98,0xf0,0xf8,0x08,0xd0,0xf7,0x08,0xf0,0xf8,0xdf,0xff,0xff,0xd8,0xf0,
+0xf8,0x2b,0xb3,0xf8,0x28,0xf0,0xf8,0x3f,0x50,0xe7,0x8d,0xf0,0xf8,0x79,0x00,0xe6,
+0xde,0x70,0xef,0xff,0xc1,0xff,0xff,0xee,0xb4,0xcc,0x1f,0x84,0xbe,0x0b,0x00,0xf0,
+0x09,0xb3,0x87,0x58,0x73,0xbe,0xe9,0x0e,0xca,0xdc,0x09,0xee,0x90,0xee,0xdf,0xc0,
+0x9e,0xe9,0x0f,0x96,0xcc,0x09,0xee,0x90,0xfe,0x0b,0x00,0xa3,0x6f,0x13,0xbd,0x7d,
+0xee,0x95,0x90,0xbe,0x6e,0xe7,0xcc,0x00,0x20,0x17,0xf1,0x7e,0x00,0x11,0xef,0xcc,
+0x00,0x17,0x38,0xe4,0x00,0xf5,0x01,0x12,0x20,0x22,0x29,0xf0,0xf9,0x0f,0xff,0xff,
+0x08,0xf0,0xf9,0x0f,0x83,0x9f,0x08,0x0c,0x00,0x13,0x82,0x0c,0x00,0xf3,0x05,0x8d,
+0xf0,0xf9,0x09,0x30,0x03,0xfe,0x70,0xff,0xff,0xf0,0xff,0xff,0xf3,0xf9,0x28,0xf0,
+0xfa,0x26,0xf3,0x0c,0x00,0xf4,0x27,0x38,0xf0,0xfa,0x36,0xf3,0xff,0xef,0xe0,0xef,
+0xef,0xf3,0xf8,0x5c,0x51,0xa8,0x53,0xf3,0xf8,0x9f,0xb3,0xcf,0x73,0xf3,0xf8,0xce,
+0xd8,0xfc,0xe4,0xf3,0xf8,0x73,0xd5,0xe1,0x94,0xf3,0xf8,0x9a,0xf4,0xf9,0xd3,0xf3,
+0xf8,0x3a,0xe2,0xf7,0xca,0xf3,0xf8,0x2d,0x42,0xd0,0x5f,0xb0,0x00,0x01,0x00,0xf0,
+0x42,0x01,0x70,0x00,0x01,0xff,0xfe,0x30,0x4f,0x60,0x00,0x1f,0xaa,0xf5,0x23,0xf9,
+0x22,0x11,0xf6,0xbc,0xdf,0xff,0xff,0xf5,0x1f,0x7f,0x7d,0x93,0x22,0x2f,0x51,0xf9,
+0xf4,0x5b,0xf0,0x00,0x52,0x1f,0x6a,0xd0,0x9f,0x03,0xd5,0x01,0xf6,0x3f,0x39,0xfb,
+0xfe,0x50,0x1f,0x86,0xf3,0x9f,0xc5,0x00,0x01,0xfb,0xfd,0x09,0xf0,0x00,0x30,0x1f,
+0x72,0x00,0x9f,0x00,0x0f,0x71,0xf6,0x00,0x08,0xf9,0x8a,0xf4,0x1f,0x60,0x00,0x2b,
+0xdd,0xda,0x55,0x00,0x10,0x22,0x7c,0x01,0xf0,0x2e,0xfb,0x0b,0xc0,0x0e,0x80,0x0f,
+0x9d,0xb1,0xf7,0x00,0xe8,0x00,0xf5,0xe7,0x7f,0x32,0x2e,0xa1,0x0f,0x6f,0x5f,0xf9,
+0xff,0xff,0x80,0xf9,0xf9,0xff,0x23,0x3f,0xa2,0x0f,0x6e,0x8c,0xf4,0x90,0xe8,0x00,
+0xf5,0xaa,0x5f,0x4f,0x2e,0x80,0x0f,0x5a,0xc5,0xf0,0xe8,0xe8,0x00,0xfb,0xf9,0x5f,
+0x04,0x1e,0x80,0x0f,0x75,0x05,0xf0,0x34,0x00,0xb0,0x00,0x5f,0x03,0x9f,0x80,0x0f,
+0x50,0x05,0xe0,0x2f,0xc2,0x55,0x00,0xf9,0x42,0x05,0x30,0x00,0x01,0xff,0xf9,0x03,
+0xf9,0x00,0x00,0x1f,0x8e,0xd1,0xdf,0xff,0xf8,0x01,0xf4,0xf9,0xdf,0xd4,0xbf,0x10,
+0x1f,0x8f,0x2a,0x6f,0xdf,0x50,0x01,0xfb,0xe0,0x49,0xff,0xfb,0x62,0x1f,0x4e,0xdf,
+0xf9,0x7b,0xef,0x41,0xf3,0x9c,0xa7,0x6f,0xb6,0x90,0x1f,0x39,0xd8,0xff,0xff,0xfd,
+0x01,0xfd,0xf7,0x79,0x0e,0x80,0x00,0x1f,0x41,0x0d,0xff,0xff,0xff,0x31,0xf3,0x00,
+0x55,0x5f,0xb5,0x51,0x1f,0x30,0x00,0x00,0xe8,0x00,0x01,0x00,0xf6,0x39,0xff,0xfe,
+0x7f,0xff,0xff,0x90,0xf9,0xaf,0x5f,0x75,0x5f,0x90,0xf5,0xab,0x4f,0xa8,0x8f,0x90,
+0xf6,0xe7,0x4f,0xed,0xdf,0x90,0xf6,0xf6,0x4f,0x30,0x0e,0x90,0xf5,0x8d,0x4f,0xff,
+0xff,0x90,0xf5,0x4f,0x5f,0x8e,0xa6,0x60,0xf6,0x7f,0x6f,0x3a,0xba,0xf1,0xf8,0xfb,
+0x4f,0x34,0xfe,0x40,0xf6,0x10,0x4f,0x32,0xcd,0x10,0xf5,0x00,0x9f,0xff,0x3f,0xe4,
+0xf5,0x00,0x8c,0x73,0x03,0xc1,0x52,0x00,0xf7,0x40,0x73,0x00,0x01,0xff,0xfb,0x00,
+0x7f,0x90,0x00,0x1f,0x8e,0xa0,0x3f,0xbf,0x80,0x01,0xf3,0xf6,0x6f,0xb0,0x8f,0x90,
+0x1f,0x6f,0x7f,0xd2,0x11,0xbf,0x81,0xf8,0xf0,0x8f,0xff,0xff,0x80,0x1f,0x4e,0x60,
+0x33,0xf9,0x30,0x01,0xf3,0xab,0xaa,0xaf,0xda,0xa4,0x1f,0x5c,0xcb,0xbb,0xfd,0xbb,
+0x41,0xfc,0xf6,0x4b,0x0f,0x8a,0x50,0x1f,0x41,0x0d,0xa0,0xf7,0x8f,0x21,0xf3,0x07,
+0xe4,0x6f,0x70,0xd7,0x1f,0x30,0x01,0x3f,0xd2,0xac,0x00,0xf5,0x43,0x03,0x70,0x00,
+0x00,0xff,0xfc,0x01,0xef,0x60,0x00,0x0f,0x8d,0xb3,0xdc,0x5f,0x91,0x00,0xf4,0xfd,
+0xfd,0x89,0x4e,0xf6,0x0f,0x7f,0x69,0x04,0xf2,0x1a,0x10,0xfa,0xf0,0x7d,0xdf,0xdd,
+0x20,0x0f,0x5e,0x72,0x33,0x3c,0xd0,0x00,0xf4,0x9b,0x5c,0xcc,0xfe,0x70,0x0f,0x5b,
+0xc2,0x55,0x55,0x53,0x00,0xfc,0xfb,0xee,0xee,0xee,0xe6,0x0f,0x52,0x03,0xde,0x4a,
+0xe4,0x10,0xf4,0x00,0x9f,0x95,0x9f,0xa0,0x0f,0x40,0x0e,0xff,0xed,0xde,0x20,0x5b,
+0x00,0x01,0x65,0x01,0x30,0xf8,0x01,0xfa,0x65,0x01,0xf1,0x2e,0xc0,0x9f,0xa6,0x66,
+0x01,0xf3,0xf7,0x2f,0xff,0xff,0xa0,0x1f,0x6f,0x3d,0xf2,0x07,0xf2,0x01,0xf9,0xe9,
+0xf6,0x11,0xf7,0x00,0x1f,0x4f,0x57,0xaf,0x59,0x65,0x01,0xf3,0xaa,0xec,0x44,0xef,
+0xf0,0x1f,0x4b,0xbe,0x91,0x11,0x8f,0x01,0xfb,0xf5,0xef,0xf9,0xff,0xf0,0x1f,0x30,
+0x0e,0x80,0x00,0x7f,0x01,0xf3,0x00,0xef,0xff,0x0d,0x00,0x35,0xa4,0x44,0x9f,0x60,
+0x01,0xf1,0x39,0xf9,0xd9,0x07,0xf0,0x30,0x0f,0x8d,0xbd,0xc5,0x8f,0xbf,0x40,0xf3,
+0xf7,0xdf,0xfb,0xff,0x50,0x0f,0x6f,0x2d,0x90,0x7f,0x25,0x10,0xf9,0xe1,0xfd,0xca,
+0xf5,0xe7,0x0f,0x4e,0x6f,0xdb,0x9f,0xfe,0x20,0xf3,0xaa,0x43,0xaf,0x43,0x20,0x0f,
+0x3a,0xb9,0xff,0xff,0xfc,0x00,0xfc,0xf8,0x9d,0x33,0x3d,0xc0,0x0f,0x54,0x09,0xfe,
+0xee,0xfc,0x00,0xf3,0x00,0x9d,0x44,0x4d,0xc0,0x0f,0x30,0x0d,0x00,0x08,0x01,0x00,
+0xf6,0x40,0x01,0xff,0xfa,0xef,0xff,0xff,0xf7,0x1f,0x8e,0xa4,0x44,0x44,0x44,0x21,
+0xf3,0xf5,0x5f,0xff,0xff,0xc0,0x1f,0x7f,0x15,0xf1,0x11,0x9d,0x01,0xf9,0xe0,0x5f,
+0xff,0xff,0xd0,0x1f,0x4f,0x54,0x77,0x77,0x76,0x11,0xf3,0xba,0xdf,0xdd,0xde,0xf4,
+0x1f,0x3b,0xbd,0x8b,0x38,0x7f,0x41,0xfc,0xf7,0xd8,0x9a,0xf5,0xf4,0x1f,0x54,0x0d,
+0x9c,0xfd,0x8f,0x41,0xf3,0x00,0xd8,0x0e,0x64,0xf4,0x1f,0x30,0x0d,0x80,0xe6,0xdd,
+0x10,0x58,0x00,0xf0,0x31,0x71,0x00,0x03,0xff,0xfc,0x79,0xbf,0xc9,0x90,0x3f,0x7d,
+0xb8,0xdd,0xac,0xda,0x03,0xf2,0xf7,0x1a,0xc1,0x8f,0x20,0x3f,0x5f,0x6f,0xff,0xff,
+0xff,0x73,0xf8,0xf1,0x57,0x77,0x77,0x61,0x3f,0x2d,0x78,0xf9,0x99,0xec,0x03,0xf2,
+0x9c,0x8f,0xdd,0xdf,0xc0,0x3f,0x4c,0xc8,0xf7,0x77,0xdc,0x03,0xf9,0xe5,0x37,0x7f,
+0xb7,0x50,0x3f,0x20,0x3f,0x27,0x00,0xb8,0xf2,0x01,0x44,0x5f,0xa4,0x42,0x3f,0x20,
+0x00,0x00,0xf7,0xb4,0x00,0xfa,0x42,0x52,0x00,0x01,0xff,0xf5,0x50,0x0e,0x60,0x00,
+0x1f,0x7f,0xcf,0x4f,0xff,0xff,0xc1,0xf4,0xf3,0xe6,0xbf,0x88,0x83,0x1f,0x7e,0x03,
+0x7f,0x7a,0xf8,0x21,0xfa,0xb3,0x59,0x9e,0xee,0xeb,0x1f,0x5f,0xbf,0x94,0x99,0x99,
+0x21,0xf1,0xd6,0xc9,0x6f,0x89,0xf3,0x1f,0x2d,0x7c,0x96,0xfb,0xbf,0x31,0xfd,0xf3,
+0xc9,0x6f,0xcc,0xf3,0x1f,0x30,0x0d,0xb6,0xe0,0xbf,0x21,0xf1,0x0b,0xee,0xea,0x68,
+0x87,0x1f,0x10,0x92,0x18,0xce,0xed,0x80,0xcd,0x02,0xf0,0x04,0xcb,0x09,0xc0,0x00,
+0x00,0x00,0x7f,0xeb,0xef,0xcb,0xb8,0x00,0x7f,0xe7,0x7c,0xe7,0x77,0x40,0x3f,0xcd,
+0x05,0xf0,0x02,0xf1,0x00,0x3b,0xe7,0x7d,0xe7,0x77,0x00,0x00,0xbe,0x77,0xde,0x77,
+0x70,0x00,0x0b,0xff,0x09,0x06,0x71,0x01,0x78,0x46,0xf8,0x44,0x44,0x01,0xee,0x05,
+0xf2,0x07,0xf8,0x02,0x28,0xff,0xff,0xfa,0x32,0x13,0xae,0xf9,0x3f,0x57,0xff,0xb5,
+0x0c,0x82,0x02,0xf5,0x00,0x6b,0x20,0x00,0x13,0x01,0xf0,0x20,0x1f,0x6f,0x30,0x9b,
+0xaa,0x00,0x08,0xfe,0xfe,0x7f,0xee,0xfd,0x14,0xff,0x8f,0x8c,0xfa,0xdb,0x60,0x3e,
+0xf9,0xf9,0xbf,0xbe,0xc7,0x00,0x6f,0xef,0xe2,0xef,0xff,0xb0,0x05,0xf9,0xf8,0x4e,
+0xad,0xc7,0x20,0x27,0x77,0x74,0x77,0x77,0x72,0x0a,0xff,0xf3,0x06,0xf4,0x0b,0x00,
+0x35,0xff,0x74,0x6e,0xf5,0x00,0x00,0x03,0xef,0xbf,0xe4,0x00,0x01,0x79,0xbe,0xff,
+0xff,0xdb,0x91,0x0f,0xeb,0x84,0x03,0x8b,0xda,0xa9,0x00,0xf0,0x3f,0x0b,0x30,0x00,
+0x95,0x70,0x04,0xdd,0xfe,0xdc,0x3f,0x4f,0x40,0x29,0x87,0x99,0x79,0xf6,0xb7,0x20,
+0xc9,0xec,0xd9,0xff,0xff,0xf6,0x0c,0xaa,0xbd,0xdf,0xc3,0xf4,0x00,0xcf,0xff,0xf7,
+0xbf,0xff,0xf4,0x03,0x3b,0xa3,0x28,0xd5,0xf5,0x12,0xff,0xff,0xfc,0x8d,0x6f,0x71,
+0x2f,0x6e,0x87,0xc8,0xff,0xff,0x42,0xfc,0xee,0xac,0x8c,0x2f,0x20,0x2f,0x43,0x5b,
+0xc8,0xff,0xff,0x82,0xf0,0x05,0xc6,0x8d,0x77,0x73,0x04,0x75,0x00,0x91,0xf4,0x00,
+0x01,0x11,0x8f,0x21,0x11,0x00,0x2f,0xd1,0x00,0xf0,0x24,0x32,0xf6,0x88,0x8f,0x58,
+0x86,0xf3,0x18,0x57,0x74,0x74,0x77,0x58,0x10,0x08,0xbc,0x7b,0x8b,0xb7,0x00,0x01,
+0x59,0xed,0xce,0xa6,0x41,0x06,0xfe,0x93,0x7d,0x26,0xae,0xf5,0x02,0xdf,0xff,0xff,
+0xff,0xc1,0x00,0x02,0x47,0x33,0x9f,0xd3,0x00,0x00,0x04,0xcf,0xff,0xa0,0x97,0x00,
+0x34,0x15,0xbf,0x60,0xd4,0x07,0x03,0x55,0x00,0xf0,0x10,0x57,0x77,0xbf,0x77,0x77,
+0x51,0x2f,0xdd,0xde,0xfd,0xdd,0xef,0x32,0xf6,0xaa,0x8f,0x5a,0xa5,0xf3,0x2b,0x45,
+0x57,0xf3,0x55,0x4b,0x20,0x05,0x99,0x6b,0x49,0x95,0x6b,0x06,0x00,0x55,0x07,0xc1,
+0x0f,0xa7,0xbf,0x77,0xbf,0x00,0x00,0xfb,0x8c,0xf8,0x8c,0xf0,0x68,0x07,0xf1,0x00,
+0xff,0x52,0x00,0xc6,0x18,0xf6,0x44,0x5d,0x80,0x00,0x00,0x2d,0xff,0xff,0xd2,0x67,
+0x01,0x91,0xf7,0x00,0x02,0x22,0x3f,0x72,0x22,0x10,0x0f,0xa3,0x00,0xf0,0x07,0x60,
+0xf7,0x88,0x6f,0x88,0x85,0xf6,0x0a,0x58,0x85,0xf7,0x88,0x5a,0x40,0x06,0xdd,0x7f,
+0x8d,0xdb,0x00,0x0b,0xbb,0x01,0x00,0x71,0x50,0x77,0x77,0x9f,0x97,0x77,0x73,0x34,
+0x00,0xf4,0x06,0xfb,0x00,0x1f,0x87,0xf4,0xae,0x3c,0xc0,0x01,0xf5,0x5f,0x08,0xd3,
+0xcc,0x00,0x1f,0x54,0xe0,0x8c,0x8e,0x70,0xb4,0x03,0x00,0x21,0x00,0xf2,0x21,0xf2,
 0x01,0x78,0x88,0xbf,0x88,0x88,0x61,0x2f,0xb9,0x9c,0xfa,0x99,0xcf,0x22,0xf9,0xcc,
 0x8f,0x7c,0xca,0xf2,0x00,0x7b,0xb8,0xf7,0xbb,0x50,0x00,0x17,0x88,0x7b,0x68,0x86,
-0x30,0x06,0xa2,0xc8,0x30,0xdc,0x00,0x6f,0x6f,0x1b,0x22,0x00,0x08,0x7c,0x00,0xf4,
-0x04,0xba,0x8f,0x13,0xfa,0x8e,0x40,0x4f,0x6d,0xfb,0xd8,0xbf,0xda,0x44,0xa0,0xba,
-0x75,0x00,0x26,0x91,0x9b,0x01,0x00,0xf2,0x68,0xf3,0x34,0xe6,0x00,0x89,0x99,0x9f,
-0xb9,0x99,0x93,0x0f,0xa8,0x89,0xfb,0x88,0x8f,0x60,0xd6,0xbb,0x7f,0x8b,0xb7,0xc5,
-0x00,0x6a,0xa6,0xd7,0xaa,0xa0,0x00,0x5c,0xc8,0xbb,0xd7,0xdb,0xd0,0x06,0xba,0xad,
-0x8d,0x8e,0x7f,0x00,0x49,0x96,0x89,0x95,0x99,0x80,0x05,0xce,0xdd,0xfe,0xdf,0xdb,
-0x00,0x02,0xe7,0x1f,0x66,0xf2,0x00,0x01,0xe8,0xc6,0xf9,0xe7,0xd3,0x02,0x79,0x47,
-0xf0,0x19,0x4f,0x10,0x01,0x35,0x9a,0x03,0xde,0xfd,0xdb,0xff,0xfc,0x91,0x17,0xaf,
-0x87,0x77,0xa5,0x3f,0x20,0xce,0xfd,0xa6,0xa7,0x99,0xa0,0x4a,0xcf,0xba,0x9e,0xdd,
-0xdc,0x02,0x89,0x99,0x74,0x6f,0xa8,0xe1,0x0c,0xed,0x29,0xb2,0xf1,0x0f,0xa0,0xcc,
-0x9e,0x93,0x3f,0x86,0xf2,0x0c,0xb6,0xd9,0xaf,0xff,0xfe,0x00,0xcf,0xff,0x92,0x3f,
-0x83,0x20,0x0c,0x83,0xc9,0x26,0xf5,0x00,0x00,0xc7,0x8e,0x42,0x0a,0x14,0x10,0xbe,
-0xcd,0x89,0xa0,0x77,0x7d,0xe0,0xaf,0x77,0x72,0x0f,0xff,0xfe,0x0a,0x8f,0x13,0x30,
-0x0b,0xe0,0xaf,0x1e,0x1f,0xf0,0x03,0xce,0x0a,0xf4,0x44,0x00,0xdf,0xff,0xe0,0xaf,
-0xff,0xf1,0x02,0x22,0xce,0x0a,0xf2,0x22,0x00,0x1a,0x00,0x31,0x11,0x11,0x4f,0x27,
-0x00,0x10,0x92,0x34,0x00,0x23,0x66,0x63,0x41,0x00,0x02,0x34,0x00,0x09,0x14,0x2b,
-0xd2,0x90,0x77,0x77,0xaf,0xa7,0x77,0x74,0x01,0x11,0x18,0xf3,0x11,0x11,0xd6,0x50,
-0xf8,0x0a,0xf0,0x09,0xfa,0xed,0xac,0xfa,0xdf,0x00,0x9e,0x0b,0xb3,0x8f,0x09,0xf0,
-0x09,0xe0,0xbf,0xff,0xf0,0x9f,0x00,0x9e,0x0b,0xa1,0x6f,0x0d,0x00,0x32,0x7f,0x09,
-0xf0,0xb2,0x67,0x00,0x15,0x3f,0x00,0x98,0x34,0x10,0x6e,0x35,0x22,0x40,0x10,0xdf,
-0xff,0xf4,0xcc,0x20,0xf0,0x23,0xdc,0x7f,0x60,0x4f,0x2f,0x54,0xcc,0xcc,0xcb,0x56,
-0xf2,0xf4,0x0a,0xcc,0xcc,0x4f,0xbf,0x1f,0x40,0xcb,0x24,0xf7,0xfa,0xe1,0xf3,0x0c,
-0xfe,0xef,0xbd,0x9c,0x2f,0x30,0x56,0xaf,0x63,0x1c,0x92,0xf2,0x4f,0xff,0xff,0xb1,
-0xf4,0x4f,0x20,0xbb,0x9f,0x32,0x8e,0x05,0x56,0x5f,0xf0,0x03,0xdf,0x67,0xde,0x00,
-0x00,0x7f,0x05,0x90,0xbc,0x50,0x00,0x4f,0x20,0x02,0xbb,0x22,0x02,0xff,0x4e,0x00,
-0xf0,0x2a,0xf0,0x16,0x9f,0x86,0x45,0xfa,0x8f,0x40,0xde,0xfe,0xc8,0xcc,0xcc,0xc9,
-0x0e,0xa6,0xbd,0x0d,0xdd,0xdd,0x30,0xef,0xff,0xd0,0xf8,0x25,0xf4,0x0e,0x94,0xad,
-0x0f,0xec,0xdf,0x40,0xef,0xff,0xd2,0x88,0xcf,0x85,0x15,0x8f,0x75,0x7e,0xde,0xfd,
-0xc4,0xff,0xff,0xf2,0xe8,0xaf,0x32,0x00,0x4f,0x30,0x0f,0xf6,0x3a,0x11,0xf3,0xda,
-0x7a,0x05,0xb2,0x1e,0x15,0x80,0x6e,0x35,0x60,0x26,0xbe,0x66,0x6a,0xe8,0x60,0xca,
-0x6b,0x25,0xbf,0x10,0xc1,0x0d,0x10,0x66,0x46,0x41,0x60,0x06,0xdd,0xdd,0xdd,0xdd,
-0x10,0xb2,0x91,0x21,0x4b,0xf1,0x63,0x47,0x20,0xff,0x10,0x70,0x47,0x21,0x4a,0xf1,
-0x91,0x3f,0x51,0xbf,0x10,0x00,0x7f,0xee,0x7a,0x61,0x11,0x31,0xf6,0xca,0xf0,0x26,
-0x1e,0x75,0xff,0xfa,0xff,0xf8,0x0d,0xbb,0x7f,0x18,0xaf,0x4f,0x40,0x9f,0x55,0xfb,
-0xda,0xf7,0xf0,0x0c,0xce,0xaf,0x9f,0x8f,0x4b,0x70,0x5d,0x98,0xfe,0xbd,0xfb,0xf8,
-0x0b,0x85,0x77,0xda,0x6b,0x74,0x00,0x0a,0xef,0xee,0xef,0xfe,0x60,0x02,0x23,0xf8,
-0x23,0xea,0x22,0x11,0xcc,0x01,0x00,0xc0,0xc7,0x00,0x4e,0xaa,0xaa,0xab,0xe0,0x00,
-0x05,0xfa,0xaa,0xaa,0xe1,0xb5,0x33,0xcb,0xbb,0xbd,0x42,0x03,0xe1,0xfe,0x00,0x66,
-0x66,0xaf,0x96,0x66,0x50,0x00,0x89,0x9c,0xfa,0x99,0x90,0x3f,0x69,0x85,0xff,0x00,
-0x00,0xdc,0x22,0x22,0x2c,0xf0,0x5e,0xa6,0xa4,0x66,0x66,0x6d,0xf0,0x00,0x0d,0xe7,
-0x77,0x77,0xdf,0x5e,0xa6,0xe0,0x04,0xaf,0x74,0x7e,0x94,0x00,0x29,0xef,0xd5,0x05,
-0xcf,0xe8,0x10,0xa9,0xd6,0x9b,0x40,0x80,0xbf,0xff,0xfe,0xaa,0x53,0xf0,0x01,0x6f,
-0xc6,0x44,0x8f,0x84,0x41,0x00,0xe9,0x01,0x28,0xf5,0x22,0x00,0x0e,0x90,0x7f,0x0d,
-0x27,0x50,0xe9,0x07,0xe1,0x11,0xbd,0x0d,0x00,0x20,0xee,0xef,0x0d,0x00,0x30,0xf3,
-0x33,0xcd,0x0d,0x00,0x20,0xdd,0xdf,0x0d,0x00,0x20,0xf5,0x55,0x0d,0x00,0xf0,0x01,
-0x6d,0xcc,0xdc,0xa0,0x48,0xf8,0x06,0xeb,0x0c,0xd4,0x05,0xec,0x2a,0xf9,0x10,0x1b,
-0x84,0x86,0x01,0x10,0x21,0x31,0x11,0x1e,0xff,0x24,0x72,0x90,0x54,0x7f,0xa4,0x42,
-0x5e,0xff,0xe2,0x26,0xf7,0x55,0x00,0x11,0x6f,0xef,0xaf,0x40,0x06,0xf2,0x11,0x9f,
-0x0d,0x00,0x20,0xee,0xef,0x0d,0x00,0xf7,0x15,0xf4,0x33,0xaf,0x00,0x0e,0xdc,0x8f,
-0xdd,0xde,0xf0,0x5d,0xff,0xa8,0xf5,0x55,0xbf,0x05,0xc6,0x10,0x4d,0xdc,0xcd,0xb0,
-0x00,0x00,0x05,0xec,0x0a,0xe5,0x00,0x00,0x09,0xfb,0x20,0x1a,0xf4,0x2b,0x53,0x00,
-0xfc,0xce,0xf0,0x10,0x04,0xea,0xff,0xff,0xf6,0x0f,0x5c,0x5e,0x35,0xaf,0x55,0x20,
-0xf5,0xf5,0xe4,0xce,0xfc,0xc0,0x0f,0x5f,0x5e,0x5f,0x65,0xaf,0x00,0xf5,0xf5,0xe5,
-0xfc,0xcd,0xf0,0x0d,0x00,0x20,0x54,0x9f,0x0d,0x00,0xb1,0xfd,0xde,0xf0,0x1f,0x4f,
-0x5e,0x5f,0x44,0x9f,0x02,0xf3,0x0d,0x00,0xf3,0x05,0x6e,0x2f,0x5e,0x19,0x85,0xa6,
-0x0a,0x90,0x15,0xf9,0xf9,0x1c,0xe4,0x13,0x00,0x13,0x74,0x00,0x08,0x20,0x58,0x00,
-0x20,0x04,0xf9,0xff,0x50,0xe1,0x02,0xed,0x14,0x46,0xfa,0x44,0x24,0xfe,0x30,0x12,
-0x6f,0x72,0x20,0x2c,0x30,0x5e,0xf3,0x26,0x00,0x00,0xb9,0x6f,0x32,0x29,0xf0,0x01,
-0xcf,0x45,0xfe,0xdd,0xff,0x03,0xfe,0x30,0x5f,0x76,0x6b,0xf0,0x05,0x13,0x87,0xf8,
-0x77,0xcf,0x00,0x02,0xed,0x6f,0xdd,0xde,0xf0,0x05,0xef,0x21,0x9a,0x47,0xa4,0x05,
-0xfd,0x35,0xcf,0xb1,0x7f,0xd3,0x07,0x00,0x5b,0x40,0x00,0x2b,0x30,0x5c,0x0f,0x01,
-0x79,0x42,0xf0,0x0b,0xf8,0x16,0x59,0xf6,0x44,0xbf,0x54,0x20,0x9a,0xdb,0x06,0xbe,
-0xfb,0xb1,0x06,0xff,0x50,0x9e,0xaa,0xcf,0x23,0x47,0xfd,0x4a,0xe6,0x69,0xc3,0x36,
-0xf4,0x1c,0xbe,0xaa,0xcf,0x20,0x09,0xe7,0xd9,0xe8,0x8a,0xf2,0x00,0x9e,0x66,0x9e,
-0x66,0x9f,0x20,0x09,0xe0,0x09,0xfc,0xcd,0xf2,0x00,0x9e,0x00,0x3b,0x65,0xb6,0x00,
-0x7c,0xe0,0x3b,0xf7,0x2e,0xe2,0x0d,0xe7,0x09,0xc4,0x00,0x1d,0x70,0x94,0x1c,0xf0,
-0x08,0x50,0xaf,0xff,0xff,0x40,0xe4,0xfd,0xc6,0x49,0xf4,0x41,0x0f,0x5f,0xed,0x32,
-0x9d,0x22,0x00,0xf5,0xf6,0x03,0xff,0xff,0xd9,0x79,0x30,0x8f,0x41,0x7f,0xc8,0xa2,
-0xf0,0x1c,0xff,0xef,0xf0,0x0e,0x9f,0x5b,0x6f,0x53,0x8f,0x04,0xf5,0xfa,0xf4,0xfd,
+0x30,0x06,0xfd,0xdd,0xdd,0xdd,0xdc,0x00,0x6f,0x6a,0xaa,0xaa,0xaa,0x00,0x08,0x7c,
+0x00,0xf4,0x04,0xba,0x8f,0x13,0xfa,0x8e,0x40,0x4f,0x6d,0xfb,0xd8,0xbf,0xda,0x44,
+0xa0,0xba,0x75,0x00,0x26,0x91,0x9b,0x01,0xf1,0x38,0xee,0xee,0xfe,0xee,0xe6,0x00,
+0x89,0x99,0x9f,0xb9,0x99,0x93,0x0f,0xa8,0x89,0xfb,0x88,0x8f,0x60,0xd6,0xbb,0x7f,
+0x8b,0xb7,0xc5,0x00,0x6a,0xa6,0xd7,0xaa,0xa0,0x00,0x5c,0xc8,0xbb,0xd7,0xdb,0xd0,
+0x06,0xba,0xad,0x8d,0x8e,0x7f,0x00,0x49,0x96,0x89,0x95,0x99,0x80,0x05,0xce,0xdd,
+0xfe,0xdf,0xdb,0x00,0x02,0xe7,0x1f,0x66,0xf2,0x00,0x01,0xe8,0xc6,0xf9,0xe7,0xd3,
+0x02,0x68,0x00,0xf0,0x3e,0xf9,0x00,0x4f,0x10,0x01,0x35,0x9a,0x03,0xde,0xfd,0xdb,
+0xff,0xfc,0x91,0x17,0xaf,0x87,0x77,0xa5,0x3f,0x20,0xce,0xfd,0xa6,0xa7,0x99,0xa0,
+0x4a,0xcf,0xba,0x9e,0xdd,0xdc,0x02,0x89,0x99,0x74,0x6f,0xa8,0xe1,0x0c,0xed,0xf9,
+0xef,0xff,0xff,0xa0,0xcc,0x9e,0x93,0x3f,0x86,0xf2,0x0c,0xb6,0xd9,0xaf,0xff,0xfe,
+0x00,0xcf,0xff,0x92,0x3f,0x83,0x20,0x0c,0x83,0xc9,0x26,0xf5,0x00,0x00,0xc7,0x8e,
+0x42,0xfd,0x8f,0x02,0xf0,0x1d,0xbe,0x0a,0xf0,0x00,0x00,0x77,0x7d,0xe0,0xaf,0x77,
+0x72,0x0f,0xff,0xfe,0x0a,0xff,0xff,0x50,0x00,0x0b,0xe0,0xaf,0x00,0x00,0x04,0x44,
+0xce,0x0a,0xf4,0x44,0x00,0xdf,0xff,0xe0,0xaf,0xff,0xf1,0x02,0x22,0xce,0x0a,0xf2,
+0x22,0x00,0x1a,0x00,0x31,0x11,0x11,0x4f,0x27,0x00,0x10,0x92,0x34,0x00,0x23,0x66,
+0x63,0x41,0x00,0x02,0x34,0x00,0x03,0x01,0x00,0x03,0xf0,0x08,0xe1,0x77,0x77,0xaf,
+0xa7,0x77,0x74,0x01,0x11,0x18,0xf3,0x11,0x11,0x00,0x9f,0xd6,0x01,0xf8,0x09,0x09,
+0xfa,0xed,0xac,0xfa,0xdf,0x00,0x9e,0x0b,0xb3,0x8f,0x09,0xf0,0x09,0xe0,0xbf,0xff,
+0xf0,0x9f,0x00,0x9e,0x0b,0xa1,0x6f,0x0d,0x00,0x41,0x7f,0x09,0xf0,0x09,0x41,0x00,
+0xf0,0x4e,0x00,0x9f,0x77,0x77,0x77,0x7c,0xf0,0x00,0x6e,0x10,0x04,0x44,0x44,0x10,
+0xdf,0xff,0xf4,0xff,0xff,0xf5,0x15,0xdc,0x7f,0x60,0x4f,0x2f,0x54,0xcc,0xcc,0xcb,
+0x56,0xf2,0xf4,0x0a,0xcc,0xcc,0x4f,0xbf,0x1f,0x40,0xcb,0x24,0xf7,0xfa,0xe1,0xf3,
+0x0c,0xfe,0xef,0xbd,0x9c,0x2f,0x30,0x56,0xaf,0x63,0x1c,0x92,0xf2,0x4f,0xff,0xff,
+0xb1,0xf4,0x4f,0x20,0xbb,0x9f,0x32,0x8e,0x05,0xf0,0x0d,0xff,0xff,0xdf,0x67,0xde,
+0x00,0x00,0x7f,0x05,0x90,0xbc,0x50,0x00,0x4f,0x20,0x02,0xbb,0x22,0x02,0xff,0x4e,
+0x00,0xf6,0x32,0xf0,0x16,0x9f,0x86,0x45,0xfa,0x8f,0x40,0xde,0xfe,0xc8,0xcc,0xcc,
+0xc9,0x0e,0xa6,0xbd,0x0d,0xdd,0xdd,0x30,0xef,0xff,0xd0,0xf8,0x25,0xf4,0x0e,0x94,
+0xad,0x0f,0xec,0xdf,0x40,0xef,0xff,0xd2,0x88,0xcf,0x85,0x15,0x8f,0x75,0x7e,0xde,
+0xfd,0xc4,0xff,0xff,0xf2,0xe8,0xaf,0x32,0x00,0x4f,0x30,0x0f,0xff,0xff,0xa0,0x04,
+0xf3,0x00,0x00,0x8e,0x27,0x04,0x23,0x3f,0x80,0x3d,0x02,0xe3,0xfe,0x00,0x26,0xbe,
+0x66,0x6a,0xe8,0x60,0x00,0x07,0xf3,0x00,0xbf,0x10,0x0c,0x04,0x20,0x06,0x66,0x01,
+0x00,0xf0,0x55,0x30,0x06,0xdd,0xdd,0xdd,0xdd,0x10,0x00,0x7f,0x54,0x44,0x4b,0xf1,
+0x00,0x07,0xfe,0xee,0xee,0xff,0x10,0x00,0x7f,0x44,0x44,0x4a,0xf1,0x00,0x07,0xf6,
+0x55,0x55,0xbf,0x10,0x00,0x7f,0xee,0xee,0xef,0xf1,0x00,0x00,0x31,0x00,0x61,0x00,
+0x00,0x00,0x1e,0x75,0xff,0xfa,0xff,0xf8,0x0d,0xbb,0x7f,0x18,0xaf,0x4f,0x40,0x9f,
+0x55,0xfb,0xda,0xf7,0xf0,0x0c,0xce,0xaf,0x9f,0x8f,0x4b,0x70,0x5d,0x98,0xfe,0xbd,
+0xfb,0xf8,0x0b,0x85,0x77,0xda,0x6b,0x74,0x00,0x0a,0xef,0xee,0xef,0xfe,0x60,0x02,
+0x23,0xf8,0x23,0xea,0x22,0x11,0xcc,0x01,0x00,0xf3,0x04,0xc7,0x00,0x4e,0xaa,0xaa,
+0xab,0xe0,0x00,0x05,0xfa,0xaa,0xaa,0xcf,0x00,0x00,0x5f,0xcb,0xbb,0xbd,0x42,0x03,
+0xf0,0x01,0xfe,0x00,0x66,0x66,0xaf,0x96,0x66,0x50,0x00,0x89,0x9c,0xfa,0x99,0x90,
+0x00,0x0d,0x83,0x00,0x91,0x00,0x00,0xdc,0x22,0x22,0x2c,0xf0,0x00,0x0d,0x73,0x01,
+0xf0,0x38,0x00,0xdd,0x66,0x66,0x6d,0xf0,0x00,0x0d,0xe7,0x77,0x77,0xdf,0x00,0x00,
+0xdf,0xee,0xee,0xef,0xf0,0x00,0x04,0xaf,0x74,0x7e,0x94,0x00,0x29,0xef,0xd5,0x05,
+0xcf,0xe8,0x10,0xa9,0x30,0x00,0x00,0x3b,0x80,0xbf,0xff,0xfe,0xff,0xff,0xff,0x35,
+0x6f,0xc6,0x44,0x8f,0x84,0x41,0x00,0xe9,0x01,0x28,0xf5,0x22,0x00,0x0e,0x90,0x7f,
+0xff,0xff,0xd0,0x00,0xe9,0x07,0xe1,0x11,0xbd,0x0d,0x00,0x20,0xee,0xef,0x0d,0x00,
+0x30,0xf3,0x33,0xcd,0x0d,0x00,0x20,0xdd,0xdf,0x0d,0x00,0x20,0xf5,0x55,0x0d,0x00,
+0xf0,0x1b,0x6d,0xcc,0xdc,0xa0,0x48,0xf8,0x06,0xeb,0x0c,0xd4,0x05,0xec,0x2a,0xf9,
+0x10,0x1b,0xf3,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x01,0x11,0x1e,0xff,0xff,0xff,
+0x65,0xff,0xff,0x54,0x7f,0xa4,0x42,0x5e,0xff,0xe2,0x26,0xf7,0x55,0x00,0x10,0x6f,
+0x0d,0x04,0x50,0xe9,0x06,0xf2,0x11,0x9f,0x0d,0x00,0x20,0xee,0xef,0x0d,0x00,0xf0,
+0x15,0xf4,0x33,0xaf,0x00,0x0e,0xdc,0x8f,0xdd,0xde,0xf0,0x5d,0xff,0xa8,0xf5,0x55,
+0xbf,0x05,0xc6,0x10,0x4d,0xdc,0xcd,0xb0,0x00,0x00,0x05,0xec,0x0a,0xe5,0x00,0x00,
+0x09,0xfb,0x20,0x1a,0xf4,0x52,0x00,0x24,0x00,0x02,0xa0,0x01,0xf0,0x11,0xf3,0x04,
+0xea,0xff,0xff,0xf6,0x0f,0x5c,0x5e,0x35,0xaf,0x55,0x20,0xf5,0xf5,0xe4,0xce,0xfc,
+0xc0,0x0f,0x5f,0x5e,0x5f,0x65,0xaf,0x00,0xf5,0xf5,0xe5,0xfc,0xcd,0xf0,0x0d,0x00,
+0x20,0x54,0x9f,0x0d,0x00,0xb1,0xfd,0xde,0xf0,0x1f,0x4f,0x5e,0x5f,0x44,0x9f,0x02,
+0xf3,0x0d,0x00,0xf3,0x05,0x6e,0x2f,0x5e,0x19,0x85,0xa6,0x0a,0x90,0x15,0xf9,0xf9,
+0x1c,0xe4,0x13,0x00,0x13,0x74,0x00,0x08,0x20,0x58,0x00,0x10,0x04,0x63,0x03,0xf1,
+0x02,0xf6,0x02,0xed,0x14,0x46,0xfa,0x44,0x24,0xfe,0x30,0x12,0x6f,0x72,0x20,0x2c,
+0x20,0x05,0x47,0x01,0xf2,0x24,0xb9,0x6f,0x32,0x29,0xf0,0x01,0xcf,0x45,0xfe,0xdd,
+0xff,0x03,0xfe,0x30,0x5f,0x76,0x6b,0xf0,0x05,0x13,0x87,0xf8,0x77,0xcf,0x00,0x02,
+0xed,0x6f,0xdd,0xde,0xf0,0x05,0xef,0x21,0x9a,0x47,0xa4,0x05,0xfd,0x35,0xcf,0xb1,
+0x7f,0xd3,0x07,0x00,0x5b,0x40,0x00,0x2b,0x30,0xa9,0x00,0xf4,0x3f,0x02,0xff,0xff,
+0xbf,0xff,0xff,0xf8,0x16,0x59,0xf6,0x44,0xbf,0x54,0x20,0x9a,0xdb,0x06,0xbe,0xfb,
+0xb1,0x06,0xff,0x50,0x9e,0xaa,0xcf,0x23,0x47,0xfd,0x4a,0xe6,0x69,0xf2,0x9f,0xff,
+0xff,0xbe,0xaa,0xcf,0x20,0x09,0xe7,0xd9,0xe8,0x8a,0xf2,0x00,0x9e,0x66,0x9e,0x66,
+0x9f,0x20,0x09,0xe0,0x09,0xfc,0xcd,0xf2,0x00,0x9e,0x00,0x3b,0x65,0xb6,0x00,0x7c,
+0xe0,0x3b,0xf7,0x2e,0xe2,0x0d,0xe7,0x09,0xc4,0x00,0x1d,0xd8,0x04,0xf4,0x44,0x0f,
+0x50,0xaf,0xff,0xff,0x40,0xe4,0xfd,0xc6,0x49,0xf4,0x41,0x0f,0x5f,0xed,0x32,0x9d,
+0x22,0x00,0xf5,0xf6,0x03,0xff,0xff,0xf0,0xcf,0xff,0xff,0x8f,0x41,0x7f,0x05,0x68,
+0xf9,0x65,0xff,0xef,0xf0,0x0e,0x9f,0x5b,0x6f,0x53,0x8f,0x04,0xf5,0xfa,0xf4,0xfd,
 0xde,0xf0,0x8a,0x2f,0xfb,0x3f,0x75,0x9f,0x00,0x01,0xcf,0x22,0xcd,0xcd,0xc0,0x03,
-0xbf,0x50,0x1b,0xc2,0xf8,0x04,0xfd,0x40,0x0e,0xb2,0x05,0xf3,0x03,0x8f,0x1e,0x15,
-0x01,0x8b,0x55,0x20,0xff,0xd7,0x15,0x68,0xf0,0x07,0xc2,0x9d,0x01,0x4f,0x31,0x00,
-0x9f,0xef,0xd0,0xef,0xfe,0xe2,0x09,0xc5,0xad,0x0f,0x84,0x7f,0x20,0x8d,0xdd,0xc0,
-0x1b,0x86,0xf0,0x1a,0x33,0x33,0x2f,0x84,0x7f,0x22,0xdd,0xfe,0xd9,0xfd,0xcd,0xf2,
-0x06,0x5d,0x72,0x0f,0xca,0xbf,0x20,0xb8,0xdf,0xf2,0x8b,0x6c,0x90,0x0d,0xee,0x50,
-0x8f,0xa0,0x7f,0x53,0xfa,0xfa,0x59,0xa3,0x33,0x96,0x4b,0x05,0xbe,0x34,0x04,0x13,
-0x10,0x63,0x0f,0x01,0x0e,0x01,0x32,0x78,0xfc,0x79,0xb7,0x2f,0xe0,0xa4,0x5f,0x94,
-0x30,0x5e,0x5c,0xb0,0x25,0xf6,0x21,0x03,0xdf,0xf7,0x0e,0x09,0x21,0xf0,0x00,0x79,
-0xd3,0xe8,0x33,0xf6,0x0d,0xff,0xff,0xae,0xfe,0xef,0x60,0xd8,0x5d,0x80,0x0d,0x00,
-0xf2,0x14,0xbd,0x75,0x0e,0xed,0xdf,0x60,0xe7,0x5e,0xa0,0xe9,0x55,0xf6,0x0f,0x8c,
-0x68,0x4c,0xec,0xdd,0x54,0xf2,0x2c,0xe3,0xae,0x2b,0xc1,0x4c,0x7f,0xa2,0xde,0x50,
-0x2e,0xb0,0x01,0x30,0x02,0x0a,0xbf,0x01,0x6f,0x13,0x20,0xf7,0xec,0x1b,0x07,0xf4,
-0x86,0x8f,0x66,0x35,0xbf,0x55,0x27,0xff,0xff,0xf2,0x3c,0xd3,0x30,0x49,0xff,0xb8,
-0x6f,0xff,0xff,0x00,0xbf,0xff,0x86,0xf2,0x27,0xf0,0x6b,0x4b,0x39,0x6f,0xee,0xff,
-0x00,0x04,0xc8,0xb6,0xf8,0x8b,0xf0,0x5d,0xef,0xde,0x8f,0x66,0xaf,0x02,0x4b,0xf7,
-0x47,0xfd,0xde,0xf0,0x02,0xff,0xf6,0x2c,0x85,0xb6,0x06,0xfd,0x18,0xcb,0xf7,0x2d,
-0xd2,0x27,0x00,0x03,0xc4,0x00,0x1b,0x40,0x0f,0xfe,0xef,0xea,0xff,0xff,0x60,0xf8,
-0x55,0xae,0x34,0xf9,0x41,0x0f,0xff,0xff,0xe1,0x3f,0x73,0x00,0xf9,0x66,0xae,0x5f,
-0xff,0xf2,0x0d,0xca,0xbe,0x95,0xd3,0x4f,0x20,0xe6,0x48,0xb6,0x6f,0xde,0xf2,0x6f,
-0xe6,0xff,0xb6,0xe6,0x8f,0x22,0xdb,0x89,0xeb,0x8e,0x78,0xf2,0x6d,0xbd,0xdb,0xce,
-0xfd,0xef,0x20,0xb5,0x6b,0x8b,0x1a,0x67,0x70,0x5f,0x6c,0xc7,0xc9,0xf5,0x9f,0x25,
-0x83,0x83,0x20,0xb4,0x00,0xa4,0xc8,0x49,0x00,0x16,0x27,0xf0,0x02,0xfb,0x16,0x6a,
-0xf7,0x55,0xaf,0x65,0x40,0x67,0xec,0x04,0x8c,0xf8,0x81,0x09,0xff,0x30,0x05,0x1f,
-0xf8,0x23,0x38,0xfc,0x38,0xe2,0x45,0xf3,0xaf,0xff,0xff,0xbe,0x6f,0x4f,0x31,0x2a,
-0xe8,0xe8,0xe6,0xf4,0xf3,0x00,0x9e,0x89,0x8e,0x7f,0x4f,0x30,0x09,0xe0,0x08,0xeb,
-0xd4,0xf3,0x00,0x9e,0x00,0x06,0xf8,0x91,0x00,0x7c,0xe0,0x2a,0xfa,0x2d,0xe3,0x0d,
-0xe7,0x02,0xc5,0x00,0xb4,0x90,0x02,0x80,0x66,0xf0,0x07,0x66,0x66,0x62,0x1f,0xff,
-0xff,0xbc,0xcf,0xdc,0x50,0x5e,0x57,0xd3,0x03,0xf0,0x00,0x00,0xe5,0x8c,0x0e,0xff,
-0xee,0x5a,0x3d,0xfa,0x22,0xf5,0x86,0xf0,0x0d,0xa4,0x9d,0x4f,0x2f,0x3f,0x00,0xdc,
-0xdf,0x70,0xf3,0xf3,0xf0,0x0e,0x86,0x7d,0x3f,0x4f,0x2f,0x00,0xfc,0xee,0x60,0xf7,
-0xd2,0xf0,0x1f,0x87,0x8f,0x64,0xb9,0x53,0x05,0xf9,0xef,0x72,0xae,0x3d,0xc1,0x5c,
-0x58,0x12,0xfb,0x20,0x0c,0x60,0x67,0x2e,0x00,0x30,0x9c,0x10,0xe1,0xfb,0x88,0xf0,
-0x0e,0xcf,0xf6,0x00,0x02,0x8c,0x6a,0x08,0xff,0xe3,0x0d,0xff,0xcc,0xf0,0x4f,0x7b,
-0x10,0x4a,0xf0,0x8f,0x00,0xdd,0x7a,0x17,0xbf,0x7b,0xf7,0x78,0xcf,0x82,0x6d,0x04,
-0x80,0xd2,0xa2,0x00,0xac,0x08,0xf0,0x8f,0xea,0xd4,0xb3,0xf7,0x08,0x06,0xfd,0xf5,
-0x03,0xf6,0x08,0xf0,0x3f,0x64,0x11,0xde,0x00,0x8f,0x00,0xdd,0x6c,0x1d,0x40,0x08,
-0xf0,0x02,0xdf,0x90,0x43,0x9e,0x00,0x22,0x12,0xf3,0x3d,0x0f,0xef,0xee,0xf0,0x0b,
-0xca,0xf3,0xf8,0xfa,0x8f,0x0b,0xf7,0x7e,0x4e,0xef,0xfe,0xe0,0x7a,0x9c,0x43,0x66,
-0xfb,0x66,0x30,0xef,0xfe,0x5b,0xbb,0xbb,0xb5,0x0e,0xbb,0xe0,0xdc,0xaa,0xcd,0x00,
-0xeb,0xae,0x0f,0xed,0xde,0xe0,0x0e,0xee,0xe0,0xfb,0x77,0xce,0x00,0xeb,0x9a,0x0f,
-0xb7,0x7c,0xe0,0x0e,0x7a,0xd0,0xde,0xde,0xfd,0x04,0xff,0xef,0x59,0xf2,0x8f,0x60,
-0x3d,0x50,0x18,0xd4,0x00,0x6e,0x40,0x6f,0x03,0xf0,0x12,0x5f,0x52,0x29,0xff,0xff,
-0x11,0xff,0xff,0xfd,0x9c,0x17,0xf1,0x00,0xda,0x0b,0xb9,0xc2,0x8f,0x13,0xdf,0x2c,
-0xf6,0x9f,0xff,0xf1,0x1a,0x98,0xaa,0x88,0x88,0x82,0x00,0x0b,0xf4,0x09,0xd0,0x20,
-0x00,0xbf,0xcc,0xef,0xcc,0x90,0x00,0x0b,0xfa,0xae,0xfa,0xa8,0xf4,0x09,0xf5,0x08,
-0xce,0x77,0x64,0x00,0x0a,0xbb,0xbc,0xcd,0xcd,0xf1,0x0a,0xe2,0xe3,0xd5,0xc7,0xae,
-0x01,0xc4,0x0b,0x46,0x40,0xcf,0x70,0x02,0x20,0x10,0xfd,0xd1,0x13,0xf5,0x0a,0xf7,
-0xe8,0x33,0x39,0xf3,0x31,0x0f,0x8e,0x93,0xcf,0xff,0xff,0x50,0xfe,0xfe,0x8c,0xcb,
-0xf8,0xf5,0x0f,0x8e,0x93,0xc8,0x7e,0x1f,0x0d,0x00,0xfc,0x16,0x95,0xad,0xef,0xdd,
-0x40,0xdd,0xde,0xf5,0x89,0xd0,0x00,0x16,0x67,0xbf,0x2f,0xea,0x00,0x05,0x9b,0xad,
-0xd0,0xaf,0x90,0x00,0x85,0x76,0xac,0x7f,0xdf,0xd8,0x30,0x00,0xce,0x5c,0x80,0x3a,
-0xe3,0x29,0x3f,0x10,0x4e,0xc9,0x04,0xf1,0x35,0x7f,0x41,0xe8,0x11,0x11,0x00,0xf9,
-0xf7,0x0e,0x67,0xee,0x90,0x0f,0xdf,0xc1,0xe6,0x77,0x8a,0x00,0xf7,0xf4,0x0e,0x67,
-0xab,0xa0,0x0f,0xef,0xd2,0xe6,0x49,0x95,0x00,0xf7,0xf4,0x2e,0x8b,0x8a,0xb3,0x0e,
-0xee,0xf6,0xe9,0xaa,0xd9,0x41,0x77,0x8d,0x5e,0x9a,0xac,0x94,0x5b,0xb9,0xf5,0xe8,
-0xa7,0x9a,0x38,0x65,0x3f,0x3e,0xec,0xcc,0xc7,0x00,0x0d,0xc0,0x55,0xae,0x10,0x01,
-0x41,0x4d,0xf4,0x3f,0xff,0xff,0x40,0x4f,0xe3,0x00,0x0f,0x7f,0x41,0x4e,0xbb,0xf7,
-0x00,0xfb,0xfa,0x9f,0xf6,0x5e,0xf8,0x0f,0xdf,0xc8,0xaf,0xff,0xe8,0x30,0xf7,0xf4,
-0x01,0x22,0x22,0x10,0x0f,0xef,0xd4,0xfe,0xbd,0xef,0x00,0xf9,0xf6,0x5f,0x5b,0xd3,
-0xf0,0x0c,0xcc,0xf8,0xee,0xbc,0xee,0x02,0x88,0x9d,0x54,0xb0,0x1d,0x30,0x6a,0xca,
-0xf5,0xaf,0x36,0xf2,0x08,0x66,0x4f,0x8f,0xad,0xef,0xd2,0x00,0x0d,0xd8,0x90,0x2c,
-0x3a,0x10,0x6f,0x92,0xf0,0x20,0xf6,0x69,0xfc,0xc7,0x10,0xb9,0x3e,0x6e,0xdf,0xed,
-0xf3,0x0b,0xfb,0xd6,0xe7,0xf9,0x8f,0x30,0xba,0xcd,0x6e,0xcf,0xdd,0xf3,0x4f,0xcc,
-0xdf,0xfe,0xfe,0xef,0x32,0xdc,0xcd,0xcb,0xaa,0xaa,0xa5,0x09,0xc5,0xf6,0x77,0x77,
-0x77,0x30,0x9f,0xff,0x59,0x1f,0x08,0xf1,0x06,0xc4,0xf5,0x9e,0x33,0x9f,0x00,0x9f,
-0xff,0x56,0xed,0xbf,0xb0,0x09,0xa2,0xf6,0x1d,0x93,0xf5,0x10,0x9a,0x8a,0xc1,0x34,
-0x08,0xb1,0x2b,0x80,0x3c,0xcc,0xcd,0xfe,0xcc,0xcc,0x22,0x78,0xbb,0x14,0x11,0x71,
-0x72,0x02,0x11,0xa0,0x69,0x4f,0x23,0xfa,0x00,0x65,0x71,0x10,0xde,0x0e,0x25,0xf1,
-0x05,0xd0,0x0e,0xb6,0x77,0x77,0x75,0xce,0x00,0xe9,0x6f,0xff,0xff,0x3a,0xe0,0x0e,
-0x96,0xf3,0x24,0xf3,0xae,0x0d,0x00,0x86,0x6b,0xe0,0x0e,0x93,0x70,0x00,0x0d,0xd7,
-0xa1,0x29,0x00,0xa8,0x49,0x30,0x2f,0xff,0x6c,0x21,0x4f,0xc2,0xf9,0xf7,0xce,0x88,
-0x8f,0x70,0x2f,0x3e,0x7c,0xe8,0x88,0xf7,0xfb,0xaa,0x02,0x0d,0x00,0xf7,0x17,0x87,
+0xbf,0x50,0x1b,0xc2,0xf8,0x04,0xfd,0x40,0x0e,0xb2,0x05,0xf3,0x03,0x00,0x00,0x20,
+0x00,0x01,0x5a,0x01,0xf0,0x3b,0x9f,0xff,0xd7,0xff,0xff,0xf8,0x09,0xc2,0x9d,0x01,
+0x4f,0x31,0x00,0x9f,0xef,0xd0,0xef,0xfe,0xe2,0x09,0xc5,0xad,0x0f,0x84,0x7f,0x20,
+0x8d,0xdd,0xc0,0xff,0xff,0xf2,0x03,0x33,0x33,0x2f,0x84,0x7f,0x22,0xdd,0xfe,0xd9,
+0xfd,0xcd,0xf2,0x06,0x5d,0x72,0x0f,0xca,0xbf,0x20,0xb8,0xdf,0xf2,0x8b,0x6c,0x90,
+0x0d,0xee,0x50,0x8f,0xa0,0x7f,0x53,0xfa,0xfa,0x59,0xa3,0x33,0x96,0x4b,0x05,0xbe,
+0x34,0x04,0x03,0x34,0x08,0x11,0x07,0x0e,0x01,0xf0,0x1b,0x78,0xfc,0x79,0xff,0xff,
+0xfc,0x1f,0xff,0xff,0xa4,0x5f,0x94,0x30,0x5e,0x5c,0xb0,0x25,0xf6,0x21,0x03,0xdf,
+0xf7,0x0e,0xff,0xff,0x60,0xbe,0x79,0xd3,0xe8,0x33,0xf6,0x0d,0xff,0xff,0xae,0xfe,
+0xef,0x60,0xd8,0x5d,0x80,0x0d,0x00,0xf0,0x14,0xbd,0x75,0x0e,0xed,0xdf,0x60,0xe7,
+0x5e,0xa0,0xe9,0x55,0xf6,0x0f,0x8c,0x68,0x4c,0xec,0xdd,0x54,0xf2,0x2c,0xe3,0xae,
+0x2b,0xc1,0x4c,0x7f,0xa2,0xde,0x50,0x2e,0xb0,0x01,0x30,0x02,0xb9,0x00,0x01,0xba,
+0x00,0x40,0x02,0xd5,0xf7,0xec,0x1b,0x07,0xf3,0x86,0x8f,0x66,0x35,0xbf,0x55,0x27,
+0xff,0xff,0xf2,0x3c,0xd3,0x30,0x49,0xff,0xb8,0x6f,0xff,0xff,0x00,0xbf,0xff,0x86,
+0xf2,0x27,0xf0,0x6b,0x4b,0x39,0x6f,0xee,0xff,0x00,0x04,0xc8,0xb6,0xf8,0x8b,0xf0,
+0x5d,0xef,0xde,0x8f,0x66,0xaf,0x02,0x4b,0xf7,0x47,0xfd,0xde,0xf0,0x02,0xff,0xf6,
+0x2c,0x85,0xb6,0x06,0xfd,0x18,0xcb,0xf7,0x2d,0xd2,0x27,0x00,0x03,0xc4,0x00,0x1b,
+0x40,0x0f,0xfe,0xef,0xea,0xff,0xff,0x60,0xf8,0x55,0xae,0x34,0xf9,0x41,0x0f,0xff,
+0xff,0xe1,0x3f,0x73,0x00,0xf9,0x66,0xae,0x5f,0xff,0xf2,0x0d,0xca,0xbe,0x95,0xd3,
+0x4f,0x20,0xe6,0x48,0xb6,0x6f,0xde,0xf2,0x6f,0xe6,0xff,0xb6,0xe6,0x8f,0x22,0xdb,
+0x89,0xeb,0x8e,0x78,0xf2,0x6d,0xbd,0xdb,0xce,0xfd,0xef,0x20,0xb5,0x6b,0x8b,0x1a,
+0x67,0x70,0x5f,0x6c,0xc7,0xc9,0xf5,0x9f,0x25,0x83,0x83,0x20,0xb4,0x00,0xa4,0x9a,
+0x0a,0xf0,0x45,0xff,0xff,0xaf,0xff,0xff,0xfb,0x16,0x6a,0xf7,0x55,0xaf,0x65,0x40,
+0x67,0xec,0x04,0x8c,0xf8,0x81,0x09,0xff,0x30,0x8f,0xff,0xff,0x32,0x38,0xfc,0x38,
+0xe2,0x45,0xf3,0xaf,0xff,0xff,0xbe,0x6f,0x4f,0x31,0x2a,0xe8,0xe8,0xe6,0xf4,0xf3,
+0x00,0x9e,0x89,0x8e,0x7f,0x4f,0x30,0x09,0xe0,0x08,0xeb,0xd4,0xf3,0x00,0x9e,0x00,
+0x06,0xf8,0x91,0x00,0x7c,0xe0,0x2a,0xfa,0x2d,0xe3,0x0d,0xe7,0x02,0xc5,0x00,0x1c,
+0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x01,0x00,0xf8,0x3f,0xe8,0x01,0x66,
+0x66,0x62,0x1f,0xff,0xff,0xbc,0xcf,0xdc,0x50,0x5e,0x57,0xd3,0x03,0xf0,0x00,0x00,
+0xe5,0x8c,0x0e,0xff,0xee,0x00,0xdf,0xff,0xfa,0xf5,0x86,0xf0,0x0d,0xa4,0x9d,0x4f,
+0x2f,0x3f,0x00,0xdc,0xdf,0x70,0xf3,0xf3,0xf0,0x0e,0x86,0x7d,0x3f,0x4f,0x2f,0x00,
+0xfc,0xee,0x60,0xf7,0xd2,0xf0,0x1f,0x87,0x8f,0x64,0xb9,0x53,0x05,0xf9,0xef,0x72,
+0xae,0x3d,0xc1,0x5c,0x58,0x12,0xfb,0x20,0x0c,0x60,0x00,0x01,0x00,0xf1,0x3f,0x8f,
+0xff,0xff,0xff,0x98,0xe1,0x03,0x55,0x55,0x55,0xcf,0xf6,0x00,0x02,0x8c,0x6a,0x08,
+0xff,0xe3,0x0d,0xff,0xcc,0xf0,0x4f,0x7b,0x10,0x4a,0xf0,0x8f,0x00,0xdd,0x7a,0x17,
+0xbf,0x7b,0xf7,0x78,0xcf,0x82,0xff,0xff,0xff,0xff,0xd2,0xa2,0x00,0xac,0x08,0xf0,
+0x8f,0xea,0x00,0x0e,0x90,0x8f,0x06,0xfd,0xf5,0x03,0xf6,0x08,0xf0,0x3f,0x64,0x11,
+0xde,0x00,0x8f,0x00,0xdd,0x6c,0x1d,0x40,0x08,0xf0,0x02,0xdf,0x90,0x53,0x00,0x13,
+0x20,0x5b,0x00,0xf2,0x3f,0x0c,0xf4,0x0f,0xef,0xee,0xf0,0x0b,0xca,0xf3,0xf8,0xfa,
+0x8f,0x0b,0xf7,0x7e,0x4e,0xef,0xfe,0xe0,0x7a,0x9c,0x43,0x66,0xfb,0x66,0x30,0xef,
+0xfe,0x5b,0xbb,0xbb,0xb5,0x0e,0xbb,0xe0,0xdc,0xaa,0xcd,0x00,0xeb,0xae,0x0f,0xed,
+0xde,0xe0,0x0e,0xee,0xe0,0xfb,0x77,0xce,0x00,0xeb,0x9a,0x0f,0xb7,0x7c,0xe0,0x0e,
+0x7a,0xd0,0xde,0xde,0xfd,0x04,0xff,0xef,0x59,0xf2,0x8f,0x60,0x3d,0x50,0x18,0xd4,
+0x00,0x6e,0x40,0x54,0x00,0xf3,0x3f,0x02,0x5f,0x52,0x29,0xff,0xff,0x11,0xff,0xff,
+0xfd,0x9c,0x17,0xf1,0x00,0xda,0x0b,0xb9,0xc2,0x8f,0x13,0xdf,0x2c,0xf6,0x9f,0xff,
+0xf1,0x1a,0x98,0xaa,0x88,0x88,0x82,0x00,0x0b,0xe7,0x7c,0xe7,0x77,0x20,0x00,0xbf,
+0xcc,0xef,0xcc,0x90,0x00,0x0b,0xfa,0xae,0xfa,0xa8,0x00,0x00,0xbe,0x77,0xce,0x77,
+0x64,0x00,0x0a,0xbb,0xbc,0xcd,0xcd,0xf1,0x0a,0xe2,0xe3,0xd5,0xc7,0xae,0x01,0xc4,
+0x0b,0x46,0x40,0xcf,0x70,0xa9,0x00,0xf5,0x11,0x0f,0xff,0xfd,0x00,0x7e,0x00,0x00,
+0xf7,0xe8,0x33,0x39,0xf3,0x31,0x0f,0x8e,0x93,0xcf,0xff,0xff,0x50,0xfe,0xfe,0x8c,
+0xcb,0xf8,0xf5,0x0f,0x8e,0x93,0xc8,0x7e,0x1f,0x0d,0x00,0xf9,0x17,0x95,0xad,0xef,
+0xdd,0x40,0xdd,0xde,0xf5,0x89,0xd0,0x00,0x16,0x67,0xbf,0x2f,0xea,0x00,0x05,0x9b,
+0xad,0xd0,0xaf,0x90,0x00,0x85,0x76,0xac,0x7f,0xdf,0xd8,0x30,0x00,0xce,0x5c,0x80,
+0x3a,0xe3,0x00,0x01,0x00,0xf0,0x3f,0xff,0xff,0x4e,0xff,0xff,0xf6,0x0f,0x7f,0x41,
+0xe8,0x11,0x11,0x00,0xf9,0xf7,0x0e,0x67,0xee,0x90,0x0f,0xdf,0xc1,0xe6,0x77,0x8a,
+0x00,0xf7,0xf4,0x0e,0x67,0xab,0xa0,0x0f,0xef,0xd2,0xe6,0x49,0x95,0x00,0xf7,0xf4,
+0x2e,0x8b,0x8a,0xb3,0x0e,0xee,0xf6,0xe9,0xaa,0xd9,0x41,0x77,0x8d,0x5e,0x9a,0xac,
+0x94,0x5b,0xb9,0xf5,0xe8,0xa7,0x9a,0x38,0x65,0x3f,0x3e,0xec,0xcc,0xc7,0x00,0x0d,
+0xc0,0x55,0x55,0x55,0x30,0x52,0x00,0x10,0x65,0x55,0x00,0xf2,0x3d,0x40,0x4f,0xe3,
+0x00,0x0f,0x7f,0x41,0x4e,0xbb,0xf7,0x00,0xfb,0xfa,0x9f,0xf6,0x5e,0xf8,0x0f,0xdf,
+0xc8,0xaf,0xff,0xe8,0x30,0xf7,0xf4,0x01,0x22,0x22,0x10,0x0f,0xef,0xd4,0xfe,0xbd,
+0xef,0x00,0xf9,0xf6,0x5f,0x5b,0xd3,0xf0,0x0c,0xcc,0xf8,0xee,0xbc,0xee,0x02,0x88,
+0x9d,0x54,0xb0,0x1d,0x30,0x6a,0xca,0xf5,0xaf,0x36,0xf2,0x08,0x66,0x4f,0x8f,0xad,
+0xef,0xd2,0x00,0x0d,0xd8,0x90,0x2c,0x3a,0x10,0xa9,0x00,0xf5,0x3f,0x0b,0xff,0xf6,
+0x69,0xfc,0xc7,0x10,0xb9,0x3e,0x6e,0xdf,0xed,0xf3,0x0b,0xfb,0xd6,0xe7,0xf9,0x8f,
+0x30,0xba,0xcd,0x6e,0xcf,0xdd,0xf3,0x4f,0xcc,0xdf,0xfe,0xfe,0xef,0x32,0xdc,0xcd,
+0xcb,0xaa,0xaa,0xa5,0x09,0xc5,0xf6,0x77,0x77,0x77,0x30,0x9f,0xff,0x59,0xff,0xff,
+0xf0,0x09,0xc4,0xf5,0x9e,0x33,0x9f,0x00,0x9f,0xff,0x56,0xed,0xbf,0xb0,0x09,0xa2,
+0xf6,0x1d,0x93,0xf5,0x10,0x9a,0x8a,0x5f,0xff,0xff,0xf9,0x00,0x01,0xf1,0x02,0x5f,
+0x40,0x00,0x00,0x3c,0xcc,0xcd,0xfe,0xcc,0xcc,0x22,0x78,0x88,0x88,0x88,0x88,0x71,
+0x72,0x02,0xf1,0x19,0xa0,0x00,0x08,0xf5,0x55,0x55,0xfa,0x00,0x00,0x59,0x99,0x99,
+0x99,0x60,0x00,0xde,0xee,0xee,0xee,0xee,0xd0,0x0e,0xb6,0x77,0x77,0x75,0xce,0x00,
+0xe9,0x6f,0xff,0xff,0x3a,0xe0,0x0e,0x96,0xf3,0x24,0xf3,0xae,0x0d,0x00,0x80,0x6b,
+0xe0,0x0e,0x93,0x70,0x00,0x0d,0xd7,0x4f,0x00,0x12,0x01,0xae,0x00,0xf2,0x0d,0xaf,
+0x20,0x00,0x2f,0xff,0x6c,0xff,0xff,0xf7,0x02,0xf9,0xf7,0xce,0x88,0x8f,0x70,0x2f,
+0x3e,0x7c,0xe8,0x88,0xf7,0x02,0xf3,0xe7,0xcf,0xff,0xff,0x0d,0x00,0xf5,0x19,0x87,
 0x32,0xf3,0xe7,0xce,0xbb,0xbb,0xb6,0x2f,0xff,0x7c,0xfc,0xcc,0xcc,0x22,0xf9,0x76,
 0x66,0x68,0xb8,0xf2,0x18,0x10,0xda,0xe8,0xbc,0xaf,0x10,0x00,0x6f,0x4e,0x6b,0x49,
-0xf0,0x00,0x04,0x70,0x41,0x3f,0x45,0x24,0x04,0xf2,0xfa,0x76,0xf0,0x22,0xf3,0x16,
-0x9e,0x68,0xf8,0x6e,0x96,0x10,0x0c,0xe1,0x7f,0x68,0xf8,0x00,0x1c,0xec,0xef,0xff,
-0xfa,0xeb,0x10,0x83,0x9f,0xaf,0x9f,0x82,0x80,0x28,0xee,0x6c,0xa0,0x4f,0xe7,0x13,
-0xd7,0x6e,0xff,0xff,0x98,0xf5,0x03,0xdf,0x97,0x3b,0xf2,0x00,0x00,0x08,0x19,0x4c,
-0x1b,0xd6,0x04,0x69,0xef,0xbd,0xfd,0x70,0x00,0xae,0xb8,0x20,0x04,0xce,0x30,0x85,
-0x4d,0xf0,0x0b,0x30,0x4f,0xa1,0x00,0xe7,0xe5,0xf3,0x04,0xfb,0xb0,0x0e,0xbe,0xbf,
-0x30,0x4f,0x2b,0x00,0xe7,0xe6,0xe8,0xac,0xfa,0xa3,0x0e,0xef,0xef,0x4b,0x02,0x50,
-0x56,0xf7,0x51,0x07,0xf3,0x27,0x00,0xf6,0x15,0x20,0xaf,0x70,0x00,0x46,0xf8,0x62,
-0x0e,0xfc,0x00,0x3f,0xff,0xfe,0x45,0xf7,0xf2,0x00,0x97,0x55,0xb0,0xdd,0x0d,0xa0,
-0x1f,0x88,0xbb,0xcf,0x40,0x5f,0x64,0xa4,0x55,0x09,0x80,0x00,0x93,0xad,0x09,0xf2,
-0x08,0x40,0x7f,0x00,0x01,0xf6,0xe5,0xf4,0x07,0xf0,0x00,0x1f,0xbe,0xbe,0x40,0x7f,
-0xa9,0x51,0xf6,0xe5,0xe4,0x07,0xfe,0xe8,0x1a,0x00,0x40,0x00,0x57,0xf7,0x51,0x1a,
-0x00,0x10,0xff,0xf7,0x66,0xf4,0x16,0x11,0x46,0xf8,0x66,0xfb,0x9b,0xf1,0x6f,0xff,
-0xed,0x9f,0x30,0x5f,0x10,0x98,0x68,0xd5,0xf3,0x05,0xf1,0x2f,0x98,0xd9,0xbf,0xff,
-0xff,0x15,0x83,0x33,0x03,0xf9,0x69,0xe1,0x00,0x00,0x05,0xd2,0x1f,0x96,0xf2,0x14,
-0xe1,0x26,0x66,0x8d,0x6e,0x56,0xb6,0x04,0xff,0xfe,0xad,0x9d,0xff,0x40,0x09,0xc5,
-0xc3,0xf2,0xf4,0xe6,0x08,0xf9,0xf8,0x3f,0x5f,0xf9,0xf4,0x23,0x5c,0x00,0x30,0x29,
-0x52,0x00,0x07,0x6b,0x8c,0x71,0xaf,0x54,0x44,0x4f,0x90,0x00,0x0e,0xde,0x0a,0x81,
-0x1b,0xf7,0x22,0x22,0x2f,0x90,0x01,0xd8,0x30,0xcc,0x0c,0x47,0xa2,0x22,0x5f,0x60,
-0xad,0x9f,0x00,0x91,0x72,0xa1,0xee,0x65,0x6f,0xe5,0x51,0x00,0x02,0xee,0x6e,0xe2,
-0x0c,0x9b,0xf0,0x01,0xfa,0x30,0x00,0x3a,0xdf,0xfc,0x7b,0xff,0xfe,0x50,0xc9,0xc7,
-0x00,0x05,0xa7,0x90,0x3e,0x9a,0x11,0xbe,0x8f,0x69,0x20,0x0b,0xe0,0x9f,0x09,0x00,
-0x0d,0x00,0x20,0x4e,0xf2,0x0d,0x00,0x27,0x02,0xc4,0x1d,0xce,0x21,0x10,0x00,0xa3,
-0x72,0x00,0x04,0x95,0x10,0x7c,0x69,0x08,0x22,0x06,0xef,0x5a,0xae,0x40,0xff,0xff,
-0xfe,0xac,0x07,0x00,0x50,0xd8,0x30,0x09,0xf0,0x00,0x75,0x2f,0x00,0x07,0x00,0x1b,
-0xe0,0x07,0x00,0xf0,0x05,0x3d,0xff,0xf0,0x03,0x6c,0xe0,0x00,0xcf,0xff,0xf0,0xaf,
-0xff,0xe0,0x00,0x5f,0xff,0x80,0xdf,0xff,0xd0,0x74,0x93,0x21,0x2a,0xda,0xaf,0x00,
-0x20,0x80,0x9c,0x13,0x83,0xe0,0x8f,0xdf,0xb7,0x77,0x77,0xfe,0xdf,0xd0,0xc7,0x00,
-0x00,0x0d,0x50,0xde,0x6a,0x0c,0xf0,0x07,0xdb,0x8e,0xe5,0xdb,0x77,0x77,0x7f,0x95,
-0xed,0x1c,0xeb,0xbb,0xbb,0xf6,0x1d,0xfc,0xf7,0x00,0x00,0x0d,0xdc,0xfd,0x7c,0xd2,
-0xa0,0xd5,0x0d,0xfa,0xe9,0x33,0x33,0x3e,0xca,0xfc,0x3d,0x36,0x0a,0xa2,0x3c,0x35,
-0x52,0x05,0x55,0x55,0x55,0x3f,0xff,0xc6,0xc0,0x36,0x10,0x6f,0x05,0x00,0xcf,0xee,
-0x94,0xee,0xee,0xee,0xec,0x34,0x42,0x04,0x44,0x44,0x44,0x1a,0x00,0x14,0x32,0xfd,
-0xff,0xa4,0x9b,0xd1,0x00,0x50,0xe0,0x11,0x10,0xdc,0x39,0x11,0xfc,0x06,0x00,0x31,
-0xff,0x90,0x50,0x06,0x00,0x20,0xaf,0xc0,0x06,0x00,0xa0,0x0c,0xff,0xc0,0x2e,0xff,
-0x90,0x00,0x1c,0xff,0xce,0xfc,0x58,0x12,0x1c,0x30,0x90,0x12,0x1c,0x36,0x90,0x13,
-0x0b,0x9b,0x15,0x00,0x6f,0x3b,0xf0,0x06,0x06,0xf8,0xdf,0xf5,0x06,0xff,0xc2,0xef,
-0xf9,0xff,0xd1,0x02,0xef,0xff,0xd1,0x00,0x08,0xff,0xf7,0x00,0x06,0x72,0x84,0xa1,
-0xff,0xe4,0xef,0xf5,0xef,0xe1,0x02,0xef,0xd4,0xa1,0x69,0x30,0x21,0x02,0x50,0xb9,
-0x01,0xf1,0x1c,0xbf,0x40,0x30,0x00,0x01,0xcf,0x1b,0xf4,0x7f,0x80,0x00,0xbf,0xd0,
-0xbf,0x45,0xff,0x40,0x4f,0xe1,0x0b,0xf4,0x07,0xfd,0x09,0xf8,0x00,0xbf,0x40,0x0e,
-0xf2,0xcf,0x40,0x0b,0xf4,0x00,0xbf,0x4b,0xf4,0x00,0x9e,0x30,0x0b,0xf4,0x40,0xa4,
-0x20,0xff,0x23,0xe6,0xa1,0x70,0x8f,0xc0,0x0a,0xfe,0x40,0x01,0x8f,0xd3,0x71,0x10,
-0xed,0xeb,0x1d,0x41,0x07,0xef,0xff,0xc3,0x22,0x19,0x17,0x10,0xd8,0x94,0x01,0xa3,
-0xde,0xd2,0x10,0x3f,0xff,0x70,0x11,0x00,0x7f,0xbf,0xff,0xff,0xce,0xb0,0x1f,0x9c,
-0xa9,0xf0,0x0e,0xff,0xff,0x82,0x5f,0xff,0xf7,0x03,0xff,0xc0,0x00,0x7f,0xf8,0x00,
-0x3f,0xfa,0x00,0x06,0xff,0x70,0x2c,0xff,0xf4,0x01,0xdf,0xfe,0x42,0xff,0xff,0xfe,
-0xea,0x30,0x02,0x2d,0x5b,0x50,0x05,0x07,0xff,0xfa,0x13,0xa5,0xdd,0x02,0x7a,0x1a,
-0x22,0x46,0x50,0xb0,0x4c,0x30,0x00,0x36,0x20,0x6f,0x26,0x30,0xfc,0x1a,0xf6,0xf9,
-0x0f,0x90,0xe9,0xfe,0xcf,0x60,0x00,0x00,0xaf,0xc3,0x64,0xad,0x62,0xf1,0x08,0xcf,
-0xa3,0xef,0xa3,0xdf,0x90,0x03,0xef,0x75,0xff,0xff,0xc3,0xcf,0xb0,0xdf,0x48,0xff,
-0xff,0xff,0xe3,0x9f,0x72,0x27,0x35,0x0e,0x00,0xb9,0x5d,0xb0,0xcb,0xef,0xff,0x30,
-0x00,0x09,0xff,0xf1,0x07,0xff,0xf3,0x19,0x09,0x91,0x10,0x7f,0xff,0x30,0x00,0x07,
-0xff,0xe0,0x06,0x59,0x4b,0x23,0x04,0x54,0x70,0x03,0x12,0x10,0xec,0x32,0x1d,0x20,
-0x07,0x00,0x54,0x47,0x8f,0xff,0x87,0x40,0x94,0x8f,0x11,0x00,0xe5,0x86,0x01,0x89,
-0xa7,0x10,0xa0,0xdc,0xbf,0x91,0x3a,0xfa,0x36,0x66,0x50,0xff,0xff,0xf4,0x54,0x72,
-0x15,0x00,0xef,0x4a,0x11,0xf2,0x5d,0x04,0x31,0xb8,0xf2,0x9b,0xe3,0x0e,0x71,0xa0,
-0x00,0x08,0xaa,0xaa,0xaa,0xa4,0xab,0x52,0x00,0x5f,0x1f,0x22,0x03,0xfb,0x1c,0xb4,
-0x20,0xdf,0x10,0x04,0x33,0x22,0x80,0x8f,0x91,0xa4,0xd1,0x3f,0xfe,0xee,0x40,0x00,
-0x9e,0xee,0xf9,0xff,0xff,0xfc,0x44,0x5f,0x62,0x08,0x01,0xd9,0x19,0x12,0xff,0x01,
-0x00,0x22,0x9a,0xff,0x7b,0x3b,0x01,0x19,0x03,0xf2,0x0d,0x07,0x90,0x00,0x6d,0xff,
-0xfb,0x40,0xcf,0x00,0xbf,0xfd,0xbd,0xff,0xac,0xf0,0xbf,0xd3,0x00,0x03,0xcf,0xff,
-0x4f,0xd1,0x00,0x07,0xaa,0xff,0xf9,0x56,0xb4,0x11,0x01,0x15,0x55,0x03,0xf0,0x05,
-0x01,0xae,0x00,0xf0,0x0b,0x4f,0x9f,0xff,0xab,0x70,0x00,0x0d,0xf4,0xff,0xfb,0x20,
-0x00,0x3c,0xfb,0x0f,0xcb,0xff,0xca,0xcf,0xfc,0x10,0xfc,0x05,0xcf,0xff,0xd7,0xd5,
-0xe5,0x23,0x12,0x10,0x3d,0xcb,0x61,0x06,0xf7,0x01,0x16,0xff,0x8f,0xf4,0x45,0x04,
-0x07,0x00,0x80,0x8a,0xcc,0xef,0xf8,0x00,0x02,0xef,0x80,0x5d,0x1a,0x23,0x00,0x01,
-0x96,0x64,0x00,0xee,0xde,0x40,0x01,0x16,0xff,0x80,0x05,0x13,0x20,0x82,0xb1,0x39,
-0x1e,0x10,0xc9,0x05,0x00,0x10,0x9b,0xf9,0x77,0x30,0xf3,0xbd,0xdf,0x9f,0x46,0x34,
-0x03,0xef,0x80,0xf2,0xb2,0x1a,0x01,0x2a,0x07,0x22,0x04,0xc2,0x6d,0x00,0x30,0x0b,
-0xe1,0x00,0xf3,0xe4,0x30,0xb7,0x0c,0xb0,0x4b,0x00,0x30,0x05,0xf5,0x2f,0x1f,0x83,
-0x40,0x2c,0x17,0xd0,0xb8,0x4b,0x00,0x40,0xba,0x2f,0x18,0xbf,0xbf,0x0a,0x31,0xb1,
-0xf2,0x7b,0x55,0x00,0x30,0x5e,0x0a,0x9a,0x89,0x00,0x30,0x2e,0x80,0xe4,0x8d,0x00,
-0x31,0x0c,0xa0,0x8d,0xee,0x1a,0x20,0x10,0x7f,0x32,0x5a,0x00,0xbf,0x7a,0x04,0x36,
-0x04,0x02,0x22,0x71,0x32,0x9f,0xf9,0xbf,0x1a,0x43,0x11,0xdf,0xb4,0x41,0x20,0x0d,
-0xff,0xf6,0x93,0x30,0x9b,0xff,0xf8,0x1d,0x01,0x20,0x6d,0xf8,0x01,0x26,0x30,0x40,
-0x17,0x00,0x77,0x89,0x01,0xc8,0x01,0x10,0xfd,0x5c,0x9f,0x24,0xad,0xfa,0x4b,0x1b,
-0x13,0x40,0x91,0x91,0x20,0x0c,0xfb,0xed,0x09,0x10,0xf3,0xb9,0x3a,0x10,0xc0,0xcd,
-0x06,0x10,0x70,0x70,0x11,0x10,0x2a,0x0d,0x05,0xf0,0x04,0xef,0xef,0xff,0xff,0xdf,
-0xb7,0xff,0xff,0xfe,0xce,0x2d,0xff,0xff,0xb5,0xfc,0x36,0xff,0xf3,0x07,0xf8,0x20,
-0xf0,0x09,0x02,0x89,0x72,0x00,0x06,0x40,0x00,0x02,0x42,0xfa,0x00,0x03,0xef,0x2f,
-0xa0,0x04,0xff,0xf2,0xfa,0x05,0xff,0xff,0x2f,0xa6,0x6f,0x80,0x00,0x07,0x6f,0x00,
-0xff,0x01,0xf2,0x06,0xfc,0xdf,0xff,0xff,0x2f,0xa1,0xdf,0xff,0xf2,0xfa,0x01,0xcf,
-0xff,0x2f,0xa0,0x00,0xbf,0xf2,0xf9,0x00,0x00,0xe0,0x4c,0x12,0x24,0x66,0x18,0x12,
-0xc3,0xb5,0x01,0x00,0xa5,0x10,0x02,0x98,0x49,0x00,0x14,0x03,0x21,0x40,0x00,0x9d,
-0x00,0x12,0x10,0xa6,0x3b,0x02,0xbe,0x06,0x01,0x39,0x0e,0x11,0x50,0x43,0xa9,0x00,
-0x1e,0x00,0x10,0xb2,0x2a,0x00,0x00,0x93,0x51,0x02,0x96,0x69,0x21,0x48,0x10,0xe7,
-0x52,0x90,0x66,0x10,0x16,0x66,0x30,0xef,0xff,0xc0,0xaf,0x85,0x17,0x4f,0xe0,0xbf,
-0xff,0xf2,0x06,0x00,0x19,0xc0,0xd0,0xbf,0xff,0xf2,0xaf,0xff,0x80,0x6e,0xff,0xc0,
-0x26,0x66,0xf0,0x93,0x02,0xb8,0xbb,0x02,0x3c,0x3d,0x0f,0x06,0x00,0x1c,0x21,0xf5,
-0xaf,0x4c,0x43,0xf3,0x08,0x05,0x00,0x00,0x06,0x45,0xfb,0x00,0x01,0xfc,0x6f,0xfc,
-0x10,0x1f,0xc6,0xff,0xfd,0x11,0xfc,0x6f,0xff,0xfd,0x3f,0xc6,0x12,0x05,0x00,0x1d,
-0x05,0xf6,0x05,0xfa,0xfc,0x6f,0xff,0xf7,0x1f,0xc6,0xff,0xf6,0x01,0xfc,0x6f,0xf5,
-0x00,0x1f,0xc3,0xe4,0x00,0x00,0xfb,0x53,0x14,0x01,0xb0,0x01,0x12,0xe2,0xdf,0x0c,
-0x12,0xd1,0xd6,0x0a,0x12,0xd1,0xdd,0x3c,0x12,0xc0,0xe7,0x36,0x22,0xb0,0x0e,0x90,
-0x74,0x10,0x8e,0x6a,0x08,0x30,0xc1,0x02,0x44,0x01,0x00,0x12,0x00,0x82,0x00,0x03,
-0x8c,0x12,0x01,0xfd,0x27,0x11,0xe3,0x63,0x06,0x00,0x9f,0xe1,0x70,0x00,0xbf,0xf2,
-0x00,0x0b,0xff,0x30,0xe6,0xaa,0x00,0x07,0x00,0x50,0x2f,0xf9,0x00,0x00,0x06,0x08,
-0x21,0x24,0x6f,0xf8,0x09,0x00,0x60,0xf4,0x00,0x00,0x05,0xb0,0x01,0xf9,0x0f,0xa2,
-0xc0,0x00,0x00,0x1e,0xfc,0x00,0x00,0x02,0xef,0xc0,0xab,0x05,0x01,0x09,0x00,0x20,
-0x7f,0xf4,0xc8,0x04,0x31,0x00,0x6f,0xf7,0x07,0x00,0x00,0xa7,0xe2,0x11,0x0a,0x70,
-0x0a,0x02,0x89,0x94,0x2f,0x8f,0xe0,0x06,0x00,0x01,0x15,0xdf,0xc1,0x01,0x8f,0xff,
-0xf5,0x36,0x66,0xbf,0xf6,0x66,0x50,0x2a,0x00,0x01,0x00,0x48,0xdd,0x01,0x9e,0xc0,
-0x09,0x30,0x00,0x10,0x35,0x7d,0x55,0x70,0x40,0x00,0x00,0x5a,0xcd,0xc8,0x20,0x7f,
-0x24,0xf0,0x28,0xd7,0x69,0xff,0x90,0x00,0x04,0xff,0xa0,0x01,0x02,0xef,0xc1,0x02,
-0xff,0xf1,0x02,0xfc,0x16,0xff,0xb0,0xcf,0xfb,0x05,0xaf,0xf9,0x1f,0xff,0x6d,0xff,
-0xb1,0xff,0xff,0xb1,0xff,0xf7,0x4f,0xfe,0x0b,0xff,0xf5,0x5f,0xfc,0x00,0x6f,0xf9,
-0x08,0xa5,0x1d,0xfd,0x20,0x00,0x5e,0xfb,0x53,0x6e,0x42,0x56,0x74,0x07,0xce,0xfe,
-0xa4,0x00,0x00,0x32,0xc6,0x08,0x14,0xf5,0x02,0x32,0x50,0xf9,0x05,0xac,0xdb,0x71,
-0xde,0x3b,0x51,0xff,0xfd,0x76,0xaf,0xf7,0x66,0x57,0xf0,0x08,0x31,0x30,0x4f,0xfa,
-0x00,0x00,0x32,0x04,0xef,0xbf,0xc0,0x9f,0xf8,0x00,0x0e,0xf5,0x02,0xcf,0xff,0x64,
-0xff,0xf3,0x01,0xd9,0xab,0x50,0xf8,0x4f,0xff,0x40,0x06,0x8c,0x96,0xb0,0xeb,0xff,
-0xa0,0x00,0x09,0xff,0x60,0x00,0x3e,0xff,0xc0,0xfa,0x07,0x40,0xa4,0x30,0x1b,0xfb,
-0x4d,0x22,0x63,0x8d,0xff,0x80,0x08,0xfe,0x30,0xfc,0x03,0x25,0xef,0x20,0xda,0x69,
-0x03,0x7e,0xdf,0x00,0x3f,0x35,0x14,0xf8,0x80,0x5e,0x13,0x20,0xfe,0xb9,0x11,0xa0,
-0xd7,0x4a,0x03,0x6f,0x7c,0x41,0x3f,0xf5,0x1a,0xfd,0x66,0x78,0x40,0xf4,0x0a,0xff,
-0x60,0xcf,0x11,0x40,0xf5,0x0a,0xff,0xe1,0x76,0x09,0x40,0xf6,0x0b,0xff,0xf9,0x04,
-0x02,0x10,0xfd,0x56,0xe0,0x30,0x02,0xff,0xff,0x6f,0x20,0x10,0xb0,0xc8,0xc2,0x10,
-0x1c,0xcc,0x41,0x12,0xff,0xe4,0x11,0x21,0x04,0x9a,0xfa,0xd9,0x13,0x91,0x0a,0x1a,
-0x02,0x08,0x5c,0x40,0xef,0xfa,0x00,0x05,0x66,0x05,0xf0,0x02,0xf9,0x04,0xff,0xff,
-0xfb,0x11,0x3f,0xa4,0xff,0x84,0xfc,0x00,0x00,0x33,0xff,0x90,0x19,0xd5,0x01,0xd0,
-0xa2,0x01,0x70,0x00,0x02,0xef,0xa4,0xf6,0x3f,0xa0,0xef,0xff,0xb0,0x8d,0x05,0x00,
-0xdd,0x00,0x20,0xff,0xfb,0x51,0x05,0x12,0x14,0x98,0x17,0x15,0x19,0xd6,0x04,0x12,
-0x5f,0xc6,0xa9,0x10,0xfa,0x0b,0x00,0x30,0xfa,0xff,0xa0,0xbb,0xea,0x81,0x3f,0xfa,
-0x00,0x4f,0xf9,0x00,0x03,0xff,0x11,0x7a,0x30,0x3f,0xf1,0x15,0x34,0x0e,0x21,0x30,
-0x01,0x9f,0x04,0x20,0x9f,0x50,0x41,0xa3,0x10,0x8f,0xaa,0xb2,0x50,0xd0,0x08,0xff,
-0x50,0x1d,0x05,0xa5,0x30,0xf6,0xdf,0xd1,0x61,0x01,0x01,0xf4,0x13,0x12,0x8f,0x24,
-0xdd,0x10,0x10,0x0e,0x96,0x13,0x10,0x14,0x01,0x21,0xfd,0x18,0xe2,0x03,0xb0,0x6f,
-0xff,0xfd,0x4a,0xaa,0xaa,0xfb,0x00,0x0c,0xda,0xf7,0xec,0x99,0x00,0x43,0xc1,0x12,
-0x11,0x12,0x80,0x01,0x08,0x5b,0x22,0x0e,0xb0,0xb6,0xc6,0x31,0xe6,0xeb,0x9d,0x30,
-0x48,0x40,0x4d,0xff,0xff,0xa0,0x22,0x2b,0x24,0xfb,0x1d,0xa6,0xac,0x17,0x1d,0x7a,
-0x3c,0x32,0x6b,0xcc,0xc7,0xe2,0x6d,0x32,0xf8,0x22,0x22,0x54,0x04,0x00,0xb8,0x06,
-0x0f,0x01,0x00,0x11,0x05,0x26,0x05,0x03,0xf6,0x6b,0x23,0x08,0xf8,0x5e,0x0e,0x12,
-0x80,0x8d,0x59,0x24,0xf8,0x00,0xcc,0x52,0x6f,0x00,0x69,0x9f,0xff,0x99,0x60,0x52,
-0x07,0x03,0x50,0x46,0x66,0x2f,0xff,0x26,0x36,0x07,0x30,0x46,0x76,0x4f,0x69,0x04,
-0x2e,0xfc,0xbc,0x36,0x07,0x14,0x00,0x9d,0xdf,0x00,0xfe,0x18,0x03,0x58,0xa5,0x02,
-0x6d,0x0b,0x12,0xfd,0x1d,0xb7,0x12,0xfa,0xb7,0x73,0x12,0xf6,0x07,0x00,0x11,0xf1,
-0x36,0x2b,0x00,0x4e,0xae,0xb0,0x50,0x00,0x4f,0xfd,0x00,0x03,0xaf,0xf8,0x07,0xff,
-0xf2,0xbc,0x0a,0x31,0xef,0xfe,0x30,0x07,0x18,0x11,0xc2,0xa0,0x00,0x01,0x35,0xe0,
-0x21,0x98,0x62,0x67,0x01,0x10,0x84,0xc5,0x01,0xf2,0x04,0x8f,0xff,0x60,0x00,0xaf,
-0xf3,0xec,0x2e,0xc0,0x1c,0xff,0xa0,0xde,0x9f,0xd1,0xdf,0xfa,0x00,0x3e,0xd9,0x6a,
-0x11,0x2d,0x61,0x00,0x10,0x1c,0x4e,0x05,0x11,0x2d,0x60,0x23,0xf1,0x0e,0xcf,0xaf,
+0xf0,0x00,0x04,0x70,0x41,0x0b,0xf8,0xa9,0x00,0x60,0x04,0xf2,0x00,0x00,0x02,0xff,
+0x01,0x00,0xf3,0x33,0xf3,0x16,0x9e,0x68,0xf8,0x6e,0x96,0x10,0x0c,0xe1,0x7f,0x68,
+0xf8,0x00,0x1c,0xec,0xef,0xff,0xfa,0xeb,0x10,0x83,0x9f,0xaf,0x9f,0x82,0x80,0x28,
+0xee,0x6c,0xa0,0x4f,0xe7,0x13,0xd7,0x6e,0xff,0xff,0x98,0xf5,0x03,0xdf,0x97,0x3b,
+0xf2,0x00,0x00,0x08,0x19,0xff,0xf8,0x00,0x00,0x04,0x69,0xef,0xbd,0xfd,0x70,0x00,
+0xae,0xb8,0x20,0x04,0xce,0x30,0x53,0x00,0xf0,0x0e,0x0e,0xff,0xff,0x30,0x4f,0xa1,
+0x00,0xe7,0xe5,0xf3,0x04,0xfb,0xb0,0x0e,0xbe,0xbf,0x30,0x4f,0x2b,0x00,0xe7,0xe6,
+0xe8,0xac,0xfa,0xa3,0x0e,0xef,0xef,0x4b,0x02,0x50,0x56,0xf7,0x51,0x07,0xf3,0x27,
+0x00,0xf3,0x15,0x20,0xaf,0x70,0x00,0x46,0xf8,0x62,0x0e,0xfc,0x00,0x3f,0xff,0xfe,
+0x45,0xf7,0xf2,0x00,0x97,0x55,0xb0,0xdd,0x0d,0xa0,0x1f,0x88,0xbb,0xcf,0x40,0x5f,
+0x64,0xa4,0x55,0x09,0x80,0x00,0x93,0x55,0x00,0xf2,0x0b,0x1f,0xff,0xff,0x40,0x7f,
+0x00,0x01,0xf6,0xe5,0xf4,0x07,0xf0,0x00,0x1f,0xbe,0xbe,0x40,0x7f,0xa9,0x51,0xf6,
+0xe5,0xe4,0x07,0xfe,0xe8,0x1a,0x00,0x60,0x00,0x57,0xf7,0x51,0x07,0xf0,0x27,0x00,
+0xf0,0x52,0x7f,0xff,0xff,0x11,0x46,0xf8,0x66,0xfb,0x9b,0xf1,0x6f,0xff,0xed,0x9f,
+0x30,0x5f,0x10,0x98,0x68,0xd5,0xf3,0x05,0xf1,0x2f,0x98,0xd9,0xbf,0xff,0xff,0x15,
+0x83,0x33,0x03,0xf9,0x69,0xe1,0x00,0x00,0x05,0xd2,0x00,0x00,0x07,0xee,0xee,0xff,
+0xee,0xee,0xe1,0x26,0x66,0x8d,0x6e,0x56,0xb6,0x04,0xff,0xfe,0xad,0x9d,0xff,0x40,
+0x09,0xc5,0xc3,0xf2,0xf4,0xe6,0x08,0xf9,0xf8,0x3f,0x5f,0xf9,0xf4,0x23,0x5c,0x00,
+0x30,0x29,0x52,0x00,0x07,0xfe,0xee,0xee,0xf9,0x00,0x00,0xaf,0x54,0x44,0x4f,0x90,
+0x00,0x0e,0xff,0xe8,0x01,0xc7,0x1b,0xf7,0x22,0x22,0x2f,0x90,0x01,0xd8,0x00,0x00,
+0x00,0xe9,0xf7,0x02,0x12,0x20,0xfd,0x01,0x41,0x60,0x00,0x00,0x3f,0x54,0x01,0xf0,
+0x22,0x21,0x55,0xee,0x65,0x6f,0xe5,0x51,0x00,0x02,0xee,0x6e,0xe2,0x00,0x00,0x00,
+0x07,0xff,0xfa,0x30,0x00,0x3a,0xdf,0xfc,0x7b,0xff,0xfe,0x50,0xc9,0xc7,0x00,0x05,
+0xa7,0x90,0x00,0x0d,0xb0,0x00,0xbe,0x00,0x00,0x00,0xfa,0x00,0x0b,0xe0,0x00,0x00,
+0x3f,0x80,0x0d,0x00,0x20,0x4e,0xf2,0x0d,0x00,0x54,0x02,0xc4,0x00,0x00,0xbe,0x58,
+0x00,0x01,0xff,0x01,0xe0,0x16,0xaf,0xf0,0x00,0x00,0x03,0x7c,0xff,0xff,0xf0,0x00,
+0x06,0xef,0xff,0x07,0x00,0x50,0x0b,0xff,0xff,0xfe,0xac,0x07,0x00,0x90,0xd8,0x30,
+0x09,0xf0,0x00,0x0b,0xf1,0x00,0x00,0x07,0x00,0x1b,0xe0,0x07,0x00,0xf1,0x0b,0x3d,
+0xff,0xf0,0x03,0x6c,0xe0,0x00,0xcf,0xff,0xf0,0xaf,0xff,0xe0,0x00,0x5f,0xff,0x80,
+0xdf,0xff,0xd0,0x00,0x00,0x21,0x00,0x2a,0xda,0xaf,0x00,0xf1,0x3b,0x80,0x9c,0xcc,
+0xcc,0xcc,0x40,0x8f,0xdf,0xb7,0x77,0x77,0xfe,0xdf,0xd0,0xc7,0x00,0x00,0x0d,0x50,
+0xde,0x8e,0x70,0x00,0x00,0xdb,0x8e,0xe5,0xdb,0x77,0x77,0x7f,0x95,0xed,0x1c,0xeb,
+0xbb,0xbb,0xf6,0x1d,0xfc,0xf7,0x00,0x00,0x0d,0xdc,0xfd,0x0c,0x70,0x00,0x00,0xd5,
+0x0d,0xfa,0xe9,0x33,0x33,0x3e,0xca,0xfc,0x3d,0xff,0xff,0xff,0xf8,0x3c,0x35,0x52,
+0x05,0x55,0x55,0x55,0x3f,0xff,0xc6,0xf3,0x00,0x20,0xfc,0x6f,0x05,0x00,0xcf,0xee,
+0x94,0xee,0xee,0xee,0xec,0x34,0x42,0x04,0x44,0x44,0x44,0x1a,0x00,0x14,0x30,0xfd,
+0xff,0xa4,0x06,0x00,0x01,0xf0,0x00,0x11,0x29,0xf1,0x00,0x21,0x2e,0xfc,0x06,0x00,
+0x31,0xff,0x90,0x50,0x06,0x00,0x20,0xaf,0xc0,0x06,0x00,0xf0,0x04,0x0c,0xff,0xc0,
+0x2e,0xff,0x90,0x00,0x1c,0xff,0xce,0xff,0x90,0x00,0x00,0x1c,0xff,0xff,0x90,0x00,
+0x07,0x00,0x11,0x90,0xcd,0x03,0x13,0x90,0x30,0x01,0xf1,0x1e,0x09,0xf5,0x00,0x06,
+0xf8,0xdf,0xf5,0x06,0xff,0xc2,0xef,0xf9,0xff,0xd1,0x02,0xef,0xff,0xd1,0x00,0x08,
+0xff,0xf7,0x00,0x06,0xff,0xff,0xf5,0x06,0xff,0xe4,0xef,0xf5,0xef,0xe1,0x02,0xef,
+0xd4,0xa1,0x00,0x02,0xb4,0x00,0x00,0x02,0x50,0xb9,0x01,0xf0,0x1e,0xbf,0x40,0x30,
+0x00,0x01,0xcf,0x1b,0xf4,0x7f,0x80,0x00,0xbf,0xd0,0xbf,0x45,0xff,0x40,0x4f,0xe1,
+0x0b,0xf4,0x07,0xfd,0x09,0xf8,0x00,0xbf,0x40,0x0e,0xf2,0xcf,0x40,0x0b,0xf4,0x00,
+0xbf,0x4b,0xf4,0x00,0x9e,0x30,0x0b,0xf4,0x9f,0x80,0xe1,0x04,0xf0,0x0a,0x23,0xff,
+0x20,0x00,0x00,0x8f,0xc0,0x0a,0xfe,0x40,0x01,0x8f,0xf4,0x00,0x0c,0xff,0xed,0xff,
+0xf6,0x00,0x00,0x07,0xef,0xff,0xc3,0x4f,0x00,0x12,0x12,0xb0,0x03,0x12,0x21,0x0c,
+0x05,0x10,0xf3,0xc2,0x01,0xc1,0x3f,0xff,0x70,0x11,0x00,0x7f,0xbf,0xff,0xff,0xce,
+0xb0,0x1f,0xf5,0x00,0xf1,0x14,0x53,0xff,0xff,0x82,0x5f,0xff,0xf7,0x03,0xff,0xc0,
+0x00,0x7f,0xf8,0x00,0x3f,0xfa,0x00,0x06,0xff,0x70,0x2c,0xff,0xf4,0x01,0xdf,0xfe,
+0x42,0xff,0xff,0xfe,0xff,0xff,0xf6,0x0a,0xff,0x10,0x01,0x60,0x05,0x07,0xff,0xfa,
+0x13,0x20,0xaf,0x05,0x01,0x0d,0x06,0x21,0x46,0x50,0x55,0x00,0x30,0x25,0x00,0x36,
+0xbe,0x01,0xf0,0x1d,0x4f,0xfc,0x1a,0xf6,0x00,0x00,0x00,0x7f,0xe9,0xfe,0xcf,0x60,
+0x00,0x00,0xaf,0xc3,0x64,0xff,0xf6,0x00,0x01,0xcf,0xa3,0xef,0xa3,0xdf,0x90,0x03,
+0xef,0x75,0xff,0xff,0xc3,0xcf,0xb0,0xdf,0x48,0xff,0xff,0xff,0xe3,0x9f,0x72,0x27,
+0x4f,0x00,0xe0,0xf2,0x50,0x00,0x9f,0xff,0xcb,0xef,0xff,0x30,0x00,0x09,0xff,0xf1,
+0x07,0x9a,0x00,0xd0,0x9f,0xff,0x10,0x7f,0xff,0x30,0x00,0x07,0xff,0xe0,0x06,0xff,
+0xf2,0x11,0x04,0x13,0x54,0x70,0x03,0x01,0xc3,0x00,0x3d,0x2f,0xff,0x20,0x07,0x00,
+0x50,0x47,0x8f,0xff,0x87,0x40,0x39,0x00,0x01,0x7c,0x01,0x41,0x0a,0xff,0xff,0xfa,
+0x9c,0x04,0xf2,0x07,0xff,0xa0,0x00,0x00,0x46,0x66,0x3a,0xfa,0x36,0x66,0x50,0xff,
+0xff,0xf4,0x54,0xff,0xff,0xf2,0xff,0xff,0xff,0xcf,0x07,0x00,0x60,0xff,0xf3,0xb8,
+0xf2,0x9b,0xbb,0x01,0x00,0xa1,0xa0,0x00,0x08,0xaa,0xaa,0xaa,0xa4,0x00,0x00,0x08,
+0x8f,0x00,0x30,0x00,0x03,0xfb,0x58,0x00,0x30,0xd0,0x00,0xdf,0x6f,0x00,0x31,0x6f,
+0x80,0x8f,0xa7,0x07,0xf1,0x03,0xbf,0x3f,0xfe,0xee,0x40,0x00,0x9e,0xee,0xf9,0xff,
+0xff,0xfc,0x44,0x5f,0xff,0xff,0xaf,0xff,0x01,0x00,0x22,0xfa,0xff,0x01,0x00,0x12,
+0x9a,0x07,0x00,0x11,0xf5,0x19,0x03,0xf0,0x0e,0x07,0x90,0x00,0x6d,0xff,0xfb,0x40,
+0xcf,0x00,0xbf,0xfd,0xbd,0xff,0xac,0xf0,0xbf,0xd3,0x00,0x03,0xcf,0xff,0x4f,0xd1,
+0x00,0x07,0xaa,0xff,0xf9,0xf5,0x97,0x00,0x73,0xff,0x01,0x00,0x00,0x00,0x11,0x11,
+0xf0,0x05,0x01,0xae,0x00,0xf3,0x0e,0x4f,0x9f,0xff,0xab,0x70,0x00,0x0d,0xf4,0xff,
+0xfb,0x20,0x00,0x3c,0xfb,0x0f,0xcb,0xff,0xca,0xcf,0xfc,0x10,0xfc,0x05,0xcf,0xff,
+0xd7,0x00,0x09,0x70,0xbd,0x01,0xe4,0x05,0x20,0x00,0x06,0xf7,0x01,0x16,0xff,0x8f,
+0xff,0xff,0xf8,0xff,0xff,0x07,0x00,0xe0,0x8a,0xcc,0xef,0xf8,0x00,0x02,0xef,0x80,
+0x00,0x02,0xe7,0x00,0x00,0x01,0x2f,0x01,0x10,0x20,0xb8,0x00,0xf0,0x02,0x70,0x00,
+0x01,0x16,0xff,0x80,0x00,0xef,0xff,0xff,0x82,0xb1,0xff,0xff,0xff,0x80,0xc9,0x05,
+0x00,0xe0,0x9b,0xff,0xff,0xff,0x82,0xf3,0xbd,0xdf,0xff,0x80,0x10,0x00,0x03,0xef,
+0x35,0x02,0x20,0x3e,0x70,0xcc,0x05,0x0a,0x2a,0x07,0x22,0x04,0xc2,0x6d,0x00,0xa0,
+0x0b,0xe1,0x00,0x00,0x06,0xf7,0x00,0xb7,0x0c,0xb0,0x4b,0x00,0xb0,0x05,0xf5,0x2f,
+0x3f,0xff,0xff,0xf8,0x2c,0x17,0xd0,0xb8,0x4b,0x00,0xb1,0xba,0x2f,0x18,0xbf,0xff,
+0xff,0xf8,0x09,0xb1,0xf2,0x7b,0x55,0x00,0x30,0x5e,0x0a,0x9a,0x89,0x00,0x30,0x2e,
+0x80,0xe4,0x8d,0x00,0x40,0x0c,0xa0,0x8d,0x00,0x91,0x00,0x31,0x10,0x7f,0x30,0x5f,
+0x00,0x24,0x4f,0x40,0x36,0x04,0x11,0x9f,0x29,0x01,0x40,0x9f,0xf9,0xbf,0xff,0xaa,
+0x03,0x30,0x00,0xdf,0xff,0x4d,0x00,0x90,0x0d,0xff,0xf8,0xaf,0xff,0xff,0x9b,0xff,
+0xf8,0x1d,0x01,0x80,0x6d,0xf8,0x00,0x00,0xcf,0xff,0x40,0x17,0xc9,0x01,0x11,0xa0,
+0xc8,0x01,0x61,0xfd,0xaa,0xaa,0xaa,0xaa,0xad,0x6c,0x01,0x00,0x2c,0x01,0x10,0x40,
+0xe0,0x00,0x80,0x50,0x00,0x00,0x0c,0xfb,0x00,0x00,0x03,0x31,0x02,0x50,0xdf,0xff,
+0xc0,0x00,0x8f,0x70,0x06,0x40,0xff,0xff,0xff,0x2a,0x0d,0x05,0xf0,0x28,0xef,0xef,
+0xff,0xff,0xdf,0xb7,0xff,0xff,0xfe,0xce,0x2d,0xff,0xff,0xb5,0xfc,0x36,0xff,0xf3,
+0x07,0xff,0xff,0xf6,0x00,0x02,0x89,0x72,0x00,0x06,0x40,0x00,0x02,0x42,0xfa,0x00,
+0x03,0xef,0x2f,0xa0,0x04,0xff,0xf2,0xfa,0x05,0xff,0xff,0x2f,0xa6,0xff,0xff,0xf2,
+0xfe,0xff,0xff,0xff,0x2f,0xff,0x01,0xf1,0x07,0xfc,0xdf,0xff,0xff,0x2f,0xa1,0xdf,
+0xff,0xf2,0xfa,0x01,0xcf,0xff,0x2f,0xa0,0x00,0xbf,0xf2,0xf9,0x00,0x00,0x9c,0xbd,
+0x00,0x11,0x24,0x06,0x00,0x22,0xef,0xc3,0xb5,0x01,0x11,0x91,0x06,0x00,0x21,0xff,
+0x70,0x06,0x00,0x31,0xfd,0x40,0x00,0x9d,0x00,0x21,0x10,0xff,0x44,0x02,0x02,0xbe,
+0x06,0x00,0x05,0x00,0x21,0xfe,0x50,0xe1,0x00,0x00,0x1e,0x00,0x10,0xb2,0x2a,0x00,
+0x10,0xd4,0x36,0x00,0x10,0xf7,0x42,0x00,0x11,0x48,0xd4,0x01,0xff,0x03,0x26,0x66,
+0x10,0x16,0x66,0x30,0xef,0xff,0xc0,0xaf,0xff,0xf1,0xff,0xff,0xe0,0xbf,0xff,0xf2,
+0x06,0x00,0x19,0xf0,0x02,0xd0,0xbf,0xff,0xf2,0xaf,0xff,0x80,0x6e,0xff,0xc0,0x26,
+0x66,0x66,0x66,0x66,0x50,0xef,0x6d,0x00,0x11,0xf4,0x7e,0x00,0x1f,0xf6,0x06,0x00,
+0x1c,0x11,0xf5,0xd2,0x02,0xf3,0x09,0xd1,0x05,0x00,0x00,0x06,0x45,0xfb,0x00,0x01,
+0xfc,0x6f,0xfc,0x10,0x1f,0xc6,0xff,0xfd,0x11,0xfc,0x6f,0xff,0xfd,0x3f,0xc6,0x12,
+0x05,0x00,0x1d,0x05,0xf4,0x05,0xfa,0xfc,0x6f,0xff,0xf7,0x1f,0xc6,0xff,0xf6,0x01,
+0xfc,0x6f,0xf5,0x00,0x1f,0xc3,0xe4,0x00,0x00,0xfb,0x3a,0x02,0x12,0x52,0x14,0x08,
+0x30,0xe2,0x00,0x00,0x8d,0x03,0x11,0xd1,0xd6,0x0a,0x00,0x07,0x00,0x00,0x3b,0x00,
+0x30,0xc0,0x00,0x5f,0x62,0x00,0x21,0xb0,0x0e,0x6f,0x00,0x20,0x40,0x8e,0x6a,0x08,
+0x30,0xc1,0x02,0x44,0x01,0x00,0x12,0x00,0x82,0x00,0x11,0x0f,0x07,0x00,0x30,0x60,
+0xcf,0xff,0x1e,0x04,0x02,0x63,0x06,0xd1,0x0b,0xf2,0x00,0x00,0xbf,0xf2,0x00,0x0b,
+0xff,0x30,0x00,0xbf,0xf3,0x07,0x00,0xb4,0x2f,0xf9,0x00,0x00,0x06,0xff,0x80,0x00,
+0x00,0x6f,0xf8,0x09,0x00,0x50,0xf4,0x00,0x00,0x05,0xb0,0xc4,0x02,0xb2,0x1e,0xc0,
+0x00,0x00,0x1e,0xfc,0x00,0x00,0x02,0xef,0xc0,0xab,0x05,0x01,0x09,0x00,0x20,0x7f,
+0xf4,0xc8,0x04,0x31,0x00,0x6f,0xf7,0x07,0x00,0x51,0x2f,0xf7,0x00,0x00,0x0a,0x70,
+0x0a,0x21,0x17,0x40,0x77,0x0b,0x1f,0xe0,0x06,0x00,0x01,0x15,0xdf,0xc1,0x01,0x8f,
+0xff,0xf5,0x36,0x66,0xbf,0xf6,0x66,0x50,0x2a,0x00,0x01,0x99,0x4d,0x90,0x00,0x00,
+0x01,0x11,0x11,0x11,0x11,0x30,0x00,0xf4,0x43,0x35,0x55,0x55,0x55,0x55,0x40,0x00,
+0x00,0x5a,0xcd,0xc8,0x20,0x00,0x00,0x02,0xdf,0xd7,0x69,0xff,0x90,0x00,0x04,0xff,
+0xa0,0x01,0x02,0xef,0xc1,0x02,0xff,0xf1,0x02,0xfc,0x16,0xff,0xb0,0xcf,0xfb,0x05,
+0xaf,0xf9,0x1f,0xff,0x6d,0xff,0xb1,0xff,0xff,0xb1,0xff,0xf7,0x4f,0xfe,0x0b,0xff,
+0xf5,0x5f,0xfc,0x00,0x6f,0xf9,0x08,0xa5,0x1d,0xfd,0x20,0x00,0x5e,0xfb,0x53,0x6e,
+0xfb,0x10,0x00,0x00,0x07,0xce,0xfe,0xa4,0x00,0x00,0x32,0xc6,0x08,0x13,0xf5,0x09,
+0x00,0xe0,0x3e,0xf9,0x05,0xac,0xdb,0x71,0x00,0x00,0x00,0x1b,0xff,0xfd,0x76,0xaf,
+0x4e,0x02,0xf0,0x22,0x08,0xff,0x31,0x30,0x4f,0xfa,0x00,0x00,0x32,0x04,0xef,0xbf,
+0xc0,0x9f,0xf8,0x00,0x0e,0xf5,0x02,0xcf,0xff,0x64,0xff,0xf3,0x01,0xff,0xf6,0x00,
+0x9f,0xf8,0x4f,0xff,0x40,0x06,0xff,0xc0,0x00,0x6f,0xeb,0xff,0xa0,0x00,0x09,0xff,
+0x60,0x00,0x3e,0xff,0xc0,0xfa,0x07,0x30,0xa4,0x30,0x1b,0x65,0x00,0x73,0x02,0x8d,
+0xff,0x80,0x08,0xfe,0x30,0xfc,0x03,0x23,0xef,0x20,0xe0,0x0b,0x01,0x19,0x04,0x03,
+0xb7,0x03,0x13,0x0d,0x9e,0x09,0x12,0x7f,0x75,0x05,0x21,0x01,0xff,0x99,0x03,0x00,
+0x69,0x05,0x10,0xf4,0x08,0x00,0x31,0x3f,0xf5,0x1a,0x25,0x07,0xd0,0xcf,0xf4,0x0a,
+0xff,0x60,0x00,0x00,0x05,0xff,0xf5,0x0a,0xff,0xe1,0x76,0x09,0x40,0xf6,0x0b,0xff,
+0xf9,0x04,0x02,0xf2,0x07,0xfd,0x8f,0xff,0xff,0x20,0x02,0xff,0xff,0xf3,0x09,0xff,
+0xff,0xb0,0x0a,0xff,0xff,0xf7,0x1c,0xff,0xff,0xf4,0x0e,0x34,0x05,0x40,0xf8,0x04,
+0x9a,0xaa,0x01,0x00,0x11,0x91,0x5a,0x00,0x02,0x0a,0x0c,0x60,0x3f,0xa0,0xef,0xfa,
+0x00,0x05,0x66,0x05,0xf0,0x02,0xf9,0x04,0xff,0xff,0xfb,0x11,0x3f,0xa4,0xff,0x84,
+0xfc,0x00,0x00,0x33,0xff,0x90,0x19,0xd5,0x01,0xd0,0xa2,0x01,0x70,0x00,0x02,0xef,
+0xa4,0xf6,0x3f,0xa0,0xef,0xff,0xb0,0x8d,0x05,0x00,0xdd,0x00,0x20,0xff,0xfb,0x51,
+0x05,0x21,0x14,0xfc,0x41,0x00,0x15,0x19,0xd6,0x04,0x20,0x5f,0xa0,0xcd,0x04,0x01,
+0x11,0x06,0xf1,0x0f,0x5f,0xfa,0xff,0xa0,0x00,0x05,0xff,0x90,0x3f,0xfa,0x00,0x4f,
+0xf9,0x00,0x03,0xff,0xa0,0xbf,0x90,0x00,0x00,0x3f,0xf1,0x15,0x00,0x00,0x00,0x03,
+0x30,0x01,0x9f,0x04,0xf0,0x08,0x9f,0x50,0x00,0x00,0x1d,0xe1,0x8f,0xf5,0x00,0x01,
+0xdf,0xd0,0x08,0xff,0x50,0x1d,0xfd,0x10,0x00,0x8f,0xf6,0xdf,0xd1,0x61,0x01,0x20,
+0xfd,0x10,0xf8,0x01,0x11,0xd1,0x89,0x05,0x00,0x0b,0x00,0x23,0x7d,0x10,0x14,0x01,
+0x21,0xfd,0x18,0xe2,0x03,0xf3,0x0e,0x6f,0xff,0xfd,0x4a,0xaa,0xaa,0xfb,0x00,0x0c,
+0xda,0xf7,0xf4,0x00,0x00,0x0e,0xb0,0x00,0x00,0x9f,0x11,0x00,0x00,0x00,0xeb,0x00,
+0x00,0x09,0xf1,0x00,0x11,0x00,0xc0,0x10,0x00,0x02,0xe6,0xeb,0x9d,0x00,0x09,0xf9,
+0x99,0x99,0x4d,0x44,0x01,0x72,0x7f,0xff,0xff,0xfb,0x1d,0xff,0xa0,0x49,0x00,0x26,
+0x1d,0xa0,0x83,0x05,0x31,0x6b,0xcc,0xc7,0x0f,0x0d,0x42,0xff,0xf8,0x22,0x22,0x54,
+0x04,0x00,0xb8,0x06,0x0f,0x01,0x00,0x11,0x05,0x26,0x05,0x12,0x00,0xd2,0x01,0x23,
+0x08,0xf8,0x5e,0x0e,0x21,0x80,0x00,0xe2,0x06,0x11,0xf8,0xc7,0x01,0x01,0xb8,0x04,
+0x5f,0x69,0x9f,0xff,0x99,0x60,0x52,0x07,0x03,0x50,0x46,0x66,0x2f,0xff,0x26,0x36,
+0x07,0x30,0x46,0x76,0x4f,0x69,0x04,0x2e,0xfc,0xbc,0x36,0x07,0x00,0x01,0x00,0x22,
+0x33,0x00,0x10,0x02,0x21,0xfa,0x00,0x4c,0x0a,0x12,0xff,0x6d,0x0b,0x11,0xfd,0x75,
+0x0e,0x02,0x15,0x00,0x32,0x00,0xbf,0xf6,0x07,0x00,0x00,0x05,0x01,0x01,0xb1,0x03,
+0xc0,0x01,0x50,0x00,0x4f,0xfd,0x00,0x03,0xaf,0xf8,0x07,0xff,0xf2,0xbc,0x0a,0x30,
+0xef,0xfe,0x30,0x37,0x0a,0x21,0xff,0xc2,0xa0,0x00,0x10,0xd5,0x7c,0x02,0x21,0x98,
+0x62,0x67,0x01,0x10,0x84,0xc5,0x01,0xf1,0x05,0x8f,0xff,0x60,0x00,0xaf,0xf3,0xec,
+0x2e,0xc0,0x1c,0xff,0xa0,0xde,0x9f,0xd1,0xdf,0xfa,0x00,0x3e,0xff,0x80,0x02,0x11,
+0x2d,0x61,0x00,0x10,0x1c,0x4e,0x05,0x10,0x2d,0x38,0x04,0xf0,0x0a,0x00,0xcf,0xaf,
 0xd2,0xef,0xf6,0x00,0xfb,0x0d,0xd0,0x2e,0xff,0x60,0xbf,0xef,0x80,0x02,0xef,0xf3,
-0x19,0xc8,0x00,0x00,0x16,0x40,0x00,0x02,0x66,0x66,0x12,0xbe,0x39,0x11,0x3f,0xcd,
-0x7b,0xa1,0x3f,0xf2,0xdf,0x6c,0xff,0xff,0x53,0x31,0xff,0x7c,0xfe,0x04,0x0f,0x06,
-0x00,0x0b,0x10,0x7b,0xd3,0x03,0x62,0xff,0xc2,0x33,0x33,0x33,0x20,0x29,0x5d,0x10,
-0x8a,0xe7,0xa5,0x21,0x00,0x49,0x2f,0x0d,0x02,0xc4,0x06,0x01,0xb4,0xe6,0x20,0x80,
-0xfa,0x1c,0x06,0x11,0xf3,0x06,0x00,0x61,0xf5,0xfe,0xaa,0xaa,0xaa,0xff,0x97,0x25,
-0x00,0x06,0x00,0x20,0x80,0x4f,0x06,0x00,0x40,0x10,0x0c,0xff,0xf5,0x36,0x7b,0x00,
-0x06,0x00,0x51,0xfb,0xef,0xff,0xf5,0x9f,0x70,0x05,0x10,0xcd,0xda,0x14,0x11,0xd4,
-0xb8,0x05,0x09,0xae,0x29,0x10,0xbc,0x90,0x14,0x2f,0xc3,0xff,0x18,0x00,0x10,0x10,
-0x6b,0x12,0x00,0x22,0xcb,0x6f,0xfe,0x01,0x02,0x5e,0x07,0x11,0x95,0x0e,0x00,0x70,
-0x65,0xf9,0x3d,0xff,0xff,0xfd,0x39,0x03,0x00,0x20,0xf9,0x3d,0x10,0x00,0x11,0xa4,
-0x17,0x00,0x2c,0xb7,0xbf,0x2b,0x02,0x30,0x55,0x55,0x20,0x35,0x11,0x10,0x90,0x72,
-0x03,0x10,0x40,0x84,0x01,0x00,0xda,0x03,0x21,0xfc,0x44,0x1a,0x5e,0x22,0xf0,0x0e,
-0xa0,0x07,0x01,0xf6,0x60,0x10,0x8f,0xcb,0x01,0x01,0x77,0x88,0x20,0xff,0x30,0xfe,
-0xe5,0x04,0x01,0x69,0x15,0x03,0x25,0x11,0x40,0x35,0x6e,0xf7,0x54,0x68,0x1b,0x21,
-0x8f,0xff,0x57,0xbe,0x00,0x06,0x00,0xb0,0xfa,0x24,0x44,0x01,0x00,0xff,0xf4,0xef,
-0xff,0x3e,0x20,0x9b,0x06,0x20,0x3f,0xe2,0x06,0x00,0x21,0x43,0x31,0xa7,0x06,0x18,
-0xf6,0x06,0x00,0x22,0x23,0x30,0x9d,0x28,0x02,0x06,0x00,0x74,0x7a,0xaa,0xaa,0xa2,
-0x00,0x00,0x03,0x96,0xc1,0x00,0xc9,0x0a,0x21,0xfa,0x10,0x50,0x06,0x11,0xd0,0xfb,
-0x44,0x11,0xf7,0x16,0x19,0x12,0xfb,0x6d,0x63,0x03,0x51,0x80,0x01,0x8a,0x15,0x02,
-0x10,0x58,0x12,0xd0,0x0b,0x07,0x20,0x13,0x33,0xb9,0x01,0x41,0x00,0x00,0xcf,0xf2,
-0xc4,0x0b,0x51,0x50,0x00,0x00,0x5a,0xaa,0x01,0x00,0x22,0x2f,0xff,0x15,0x18,0xf0,
-0x19,0xfa,0x0d,0x01,0xb0,0xd0,0xa2,0x0f,0xaf,0xeb,0xfb,0xcf,0xbf,0xbe,0xcb,0xfa,
-0xff,0xe1,0x98,0x1c,0x1c,0x15,0xff,0xaf,0xfd,0x08,0x70,0xb0,0xb0,0x3f,0xfa,0xff,
-0xdf,0xdd,0xdd,0xdd,0xfd,0xdf,0xaf,0xa0,0xd0,0x33,0xe2,0x87,0xfa,0xfe,0xaf,0xaa,
-0xaa,0xaa,0xeb,0xaf,0xed,0x09,0x05,0xb7,0x2b,0x31,0x07,0xef,0xd0,0x11,0x2d,0x01,
-0x33,0x3c,0x11,0x29,0x7c,0x61,0x21,0x03,0xbf,0xdf,0x80,0x12,0x3c,0x6f,0x19,0x03,
-0x47,0x16,0x33,0x00,0x9e,0xff,0x34,0xad,0x00,0xde,0xb9,0x02,0x3a,0x19,0x13,0xf9,
-0x76,0xcc,0x12,0x20,0x0f,0x00,0x12,0xa0,0xb6,0x31,0x03,0xc9,0x2f,0x00,0x0f,0x6b,
-0x30,0x34,0x44,0x43,0x4f,0x01,0x20,0xfb,0x8a,0x05,0x00,0xc1,0x8f,0xa0,0xff,0xff,
-0xfb,0x7f,0xf8,0xff,0xff,0xfc,0x11,0x11,0xaa,0x0c,0x0f,0x05,0x00,0x10,0x10,0xbd,
-0x67,0xbc,0x00,0x9f,0x01,0x11,0x54,0xb5,0x04,0x00,0x65,0x2b,0x10,0xd8,0x74,0xb3,
-0x30,0xff,0xdb,0xbc,0xe6,0xa5,0x30,0xff,0xd6,0x10,0xf1,0xae,0xf0,0x02,0xb0,0xbf,
-0x70,0x00,0x13,0x32,0x00,0x05,0xed,0x10,0x30,0x06,0xdf,0xff,0xfe,0x80,0x01,0x43,
-0xbc,0x21,0xfc,0xce,0x08,0x61,0x51,0xbe,0x60,0x00,0x04,0xde,0x40,0xb3,0x42,0x03,
-0x40,0x00,0x10,0x61,0x35,0x13,0x80,0x27,0x3e,0x13,0xfa,0xac,0x1c,0x23,0xac,0x30,
-0xfe,0xb2,0x00,0xa3,0x12,0x21,0x0f,0xea,0x68,0x01,0x40,0xcf,0x90,0xfa,0x48,0x6e,
-0x10,0x41,0x65,0xff,0x1f,0xa9,0x3d,0x0c,0x32,0x1a,0xf1,0xfa,0xfa,0x02,0x40,0xaf,
-0x1f,0xa5,0x99,0x7f,0x8f,0x31,0x5f,0xf1,0xfd,0x99,0x77,0x10,0x9b,0x41,0x3e,0x02,
-0xb2,0x5c,0x0a,0x4b,0xb3,0x0d,0x4d,0x00,0x22,0x30,0x05,0x4d,0x00,0x23,0xf7,0x00,
-0x4d,0x00,0x22,0x70,0x01,0x4d,0x00,0x2f,0x94,0x00,0x4d,0x00,0x1e,0x22,0x00,0x00,
-0x4d,0x00,0x23,0xf0,0x00,0x4d,0x00,0x22,0x00,0x00,0x4d,0x00,0x2f,0x90,0x00,0x4d,
-0x00,0x1d,0x23,0x85,0x00,0x4d,0x00,0x22,0xa0,0x00,0x4d,0x00,0x23,0xfa,0x00,0x4d,
-0x00,0x2f,0x60,0x00,0x4d,0x00,0x1d,0x03,0x54,0x1b,0x11,0x1f,0x0c,0x02,0x00,0x4d,
-0x00,0x02,0x62,0x01,0x13,0xaf,0x11,0x00,0x0e,0x4d,0x00,0x0a,0xbd,0x38,0x23,0x5c,
-0x50,0x95,0x02,0x12,0xfc,0x12,0x15,0x11,0xd0,0x11,0x00,0x31,0x64,0x00,0xa5,0x56,
-0x09,0xf0,0x0a,0xbf,0xf6,0x4e,0x21,0x11,0x11,0x17,0xd3,0x0f,0xff,0xec,0xce,0xec,
-0xcc,0xcc,0xef,0xe1,0x7f,0xe3,0x00,0x2d,0x00,0x00,0x06,0x80,0xd9,0x01,0x33,0x97,
-0x0a,0xa6,0xee,0xc7,0x04,0x98,0x06,0x2a,0x2f,0xfa,0xeb,0x1e,0x10,0x10,0x89,0x00,
-0xf0,0x10,0xff,0xe8,0x00,0x00,0xdf,0xf8,0xcf,0xf8,0x00,0x7f,0xff,0x81,0xdf,0xf1,
-0x0c,0xfa,0xf8,0x52,0xdf,0x60,0xff,0x64,0x78,0x3a,0xf8,0x0f,0xff,0x50,0x08,0xff,
-0xa1,0x7d,0x9d,0xf0,0x0b,0xfa,0x0f,0xff,0x41,0x15,0xff,0xa0,0xef,0x46,0x88,0x48,
-0xf8,0x0b,0xfc,0xf8,0x42,0xef,0x50,0x5f,0xff,0x82,0xef,0xf1,0x00,0xaf,0xfa,0x4f,
-0xb4,0x60,0x5a,0xdc,0xa4,0x00,0x00,0x01,0xa6,0xe5,0x62,0x78,0x8b,0xff,0xfe,0x88,
-0x82,0x53,0x03,0x10,0x12,0x44,0x66,0x00,0xb6,0x1e,0x00,0xd7,0xbc,0xaf,0xfc,0xfc,
-0xfe,0xdf,0x90,0x3f,0xd5,0xf4,0xeb,0x7f,0x06,0x00,0x07,0x42,0xe6,0xf5,0xec,0x8f,
-0x30,0x9a,0x62,0x80,0x07,0x9a,0xaa,0xaa,0xa9,0x95,0x07,0x12,0x14,0xf7,0x00,0x02,
-0x84,0xb3,0x11,0x0c,0x61,0x03,0x40,0x03,0xc3,0xdf,0xff,0x3b,0x09,0x21,0xfd,0x3d,
-0x0d,0x1e,0x31,0xff,0xd3,0x50,0x7b,0x9e,0x02,0x0d,0x00,0x24,0xff,0x60,0x88,0x9e,
-0x03,0x0d,0x00,0x12,0x0b,0x27,0x2d,0x12,0x0d,0xb7,0x29,0x12,0x0f,0xa3,0x34,0x33,
-0x08,0x86,0x30,0xa1,0x72,0x00,0x73,0x05,0x14,0xb6,0xb8,0x01,0xf0,0x02,0xf2,0x00,
-0xbf,0xff,0xf8,0xbf,0xf6,0xef,0xff,0x40,0xbf,0xff,0xff,0x10,0xa4,0x09,0xff,0x64,
-0x57,0x20,0xfd,0x10,0x3a,0xaf,0x01,0xb7,0x1d,0xb0,0xbf,0xff,0xf4,0x1d,0xff,0xff,
-0xf4,0x06,0x10,0xbf,0xff,0x92,0x83,0x74,0x47,0xfd,0x2b,0xff,0xf4,0x00,0x1d,0xb7,
-0x01,0x23,0x1c,0xff,0x58,0x5b,0x40,0x99,0x99,0x70,0x00,0x52,0x0d,0x60,0x0a,0xd0,
-0xd0,0xd0,0xeb,0x9f,0x05,0x00,0x51,0xff,0xd1,0xd1,0xd1,0xeb,0x79,0x1d,0x0f,0x05,
-0x00,0x0b,0x10,0xef,0xc6,0x05,0x43,0x5c,0xdd,0xdd,0xdd,0x90,0x6f,0x31,0xb0,0x00,
-0x03,0x51,0xa6,0x01,0xa0,0x33,0xa2,0x0f,0xf0,0x0a,0xff,0x21,0x11,0x11,0x1f,0xf0,
-0xaf,0x43,0xb2,0x02,0x22,0x06,0x23,0xd0,0x08,0x46,0x2b,0x2a,0x7f,0x10,0x41,0x3a,
-0x0c,0xc7,0xb0,0x0e,0x01,0x00,0x04,0xf9,0x20,0x08,0xfb,0xb7,0x56,0xfb,0xfa,0x00,
-0xfe,0xf7,0xc5,0x89,0x1b,0x00,0x0b,0x59,0x3e,0x04,0x00,0x02,0x16,0x00,0x2f,0xe3,
-0x00,0x01,0x00,0x15,0x1f,0xe7,0x1e,0x00,0x0a,0x13,0xf4,0x41,0x94,0xa2,0x00,0xfe,
-0x00,0x00,0xf4,0xfe,0xf8,0xfc,0x00,0xf1,0x93,0x00,0x7d,0xff,0x00,0x00,0xfe,0xff,
-0xfb,0xfd,0x92,0x00,0x3f,0xfd,0x00,0xfe,0xdd,0x00,0x04,0x1c,0xfd,0x0a,0x00,0x19,
-0xff,0x1f,0x00,0x16,0xfe,0x70,0x00,0x11,0xfe,0x41,0x7b,0x5f,0xfe,0x00,0xfe,0xfc,
-0xfe,0x9c,0x00,0x0a,0x15,0x02,0x3c,0x00,0x11,0xfe,0x34,0x00,0x26,0xfe,0xfd,0x30,
-0x00,0x11,0xe4,0xe4,0x8b,0x15,0xeb,0x24,0x00,0x20,0xfd,0xfe,0x20,0x00,0x01,0x2b,
-0x00,0x0d,0x44,0x00,0x20,0xfd,0x00,0x1c,0x7c,0x0f,0x68,0x00,0x07,0x1f,0xfe,0x43,
-0x01,0x0d,0x19,0xef,0xdf,0x00,0x01,0x0c,0x00,0x10,0xfd,0x38,0x00,0x29,0xfc,0xfa,
-0x8c,0x01,0x00,0x93,0xc3,0x67,0xeb,0xfe,0xeb,0xf7,0x00,0xe4,0x38,0x17,0x26,0xf4,
-0xfb,0xb5,0xdd,0x10,0x00,0xb7,0x8a,0x12,0xed,0x61,0x01,0x30,0x00,0xfc,0x00,0x2f,
-0x05,0x00,0x32,0x05,0x0f,0xe0,0x01,0x01,0x10,0xfd,0xd2,0x00,0x1f,0xfc,0x97,0x00,
-0x0b,0x37,0xfb,0x00,0xfe,0x3e,0x0e,0x0a,0x7b,0x02,0xc0,0xe6,0xe4,0x00,0x00,0xf4,
-0xfd,0xea,0xfe,0x02,0x00,0x02,0x02,0x60,0x00,0xd3,0xef,0xf7,0x00,0xf7,0xeb,0xf9,
-0xf8,0x00,0xf9,0xf8,0xfb,0xf8,0xfa,0x1a,0x01,0x66,0xea,0xf0,0x00,0x00,0xf8,0xff,
-0x2b,0x01,0x50,0xfb,0xfc,0x00,0x00,0xfb,0xdc,0x00,0x14,0xff,0x7d,0x01,0x42,0x02,
-0x00,0xf1,0xfa,0xb4,0x02,0x04,0x83,0x46,0x23,0xfd,0xfd,0x6c,0x01,0x08,0xf8,0x02,
-0x14,0xf0,0x20,0x01,0x15,0x01,0x20,0x01,0x02,0xb0,0x01,0x04,0xcd,0x00,0xf0,0x0a,
-0x02,0xfb,0xe9,0xf1,0x00,0x00,0xf1,0xfd,0xf6,0xfe,0x02,0xf6,0x02,0x02,0x01,0x02,
-0x00,0x02,0xfa,0xf9,0xfe,0xfc,0xf9,0xfc,0xfa,0x03,0x02,0x46,0xfe,0xfd,0x02,0xfb,
-0x20,0x05,0x1a,0xfd,0x99,0x01,0x02,0x48,0x00,0x1e,0xfd,0xb2,0x01,0x1f,0xfe,0xcc,
-0x01,0x20,0x03,0x1d,0x00,0x0e,0x0b,0x02,0x08,0xe9,0x18,0x02,0x43,0x02,0x1f,0xff,
-0x5a,0x03,0x10,0x1f,0xff,0x1d,0x00,0x10,0x1e,0x02,0xdd,0x01,0x19,0x02,0xa5,0x00,
-0x11,0x02,0xd7,0x83,0x0f,0x01,0x00,0x23,0x0b,0xed,0x00,0x1f,0xf7,0x2c,0x00,0x0b,
-0x23,0xfe,0xfe,0xd7,0x01,0x1c,0xee,0x6c,0x02,0x40,0xfe,0x02,0x00,0xfc,0x7c,0x33,
-0x1e,0x02,0x89,0x02,0x0e,0xe2,0x03,0x06,0x58,0x03,0x1c,0xef,0x63,0x00,0x2d,0xff,
-0x01,0x80,0x01,0x1f,0xf3,0xd8,0x00,0x24,0x1f,0xfc,0x24,0x00,0x10,0x1f,0xfe,0x19,
-0x00,0x1b,0x04,0x69,0x03,0x00,0x6a,0x52,0x00,0x31,0x3c,0x1d,0x05,0x21,0x00,0xf2,
-0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,
-0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x4a,0x08,0x70,0x1b,
-0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x18,0x18,0xe5,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,
-0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x9d,0xe7,0x0f,0x01,0x00,0xff,0xff,0xbe,0x02,
-0x33,0x03,0x20,0x03,0x02,0x2e,0x03,0x5b,0x06,0x07,0x06,0x08,0x00,0x55,0x55,0x60,
-0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xd0,0x0b,0x00,
-0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0xe4,0x1a,0x62,0x00,0x17,
-0x17,0x17,0x18,0x17,0x57,0x12,0xd4,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,
-0x20,0x21,0x1f,0x22,0x24,0xad,0x0c,0x01,0x00,0x1f,0x24,0x2d,0x03,0xff,0xff,0xa8,
-0x50,0x00,0x00,0x00,0x00,0x00,
+0x19,0xc8,0x00,0x00,0x16,0x40,0xff,0x0f,0x00,0x02,0x66,0x66,0x12,0x00,0x00,0x0b,
+0xff,0xff,0x3f,0x40,0x00,0x0c,0xff,0xff,0x3f,0xf2,0xdf,0x6c,0xff,0xff,0x53,0x31,
+0xff,0x7c,0xff,0xff,0xff,0xf6,0x06,0x00,0x0c,0xf0,0x0e,0x7b,0xff,0xff,0xff,0xf5,
+0xff,0xc2,0x33,0x33,0x33,0x20,0xff,0xff,0xff,0xff,0x20,0x00,0x8a,0xaa,0xaa,0xa9,
+0x00,0x00,0x49,0x99,0x99,0x99,0x60,0x00,0x12,0x00,0xe1,0xf8,0x00,0xfa,0x00,0x00,
+0x01,0xff,0x80,0xfa,0x00,0x00,0x00,0xef,0xf3,0x06,0x00,0x70,0xf5,0xfe,0xaa,0xaa,
+0xaa,0xff,0xf5,0x1e,0x00,0x00,0x06,0x00,0x20,0x80,0x4f,0x06,0x00,0x20,0x10,0x0c,
+0x06,0x00,0x20,0x50,0x1e,0x06,0x00,0x50,0xfb,0xef,0xff,0xf5,0x9f,0x1e,0x00,0x81,
+0xd1,0xcd,0xdd,0xdd,0xdd,0xdd,0xd4,0xef,0x2a,0x00,0x17,0x00,0x01,0x00,0x7f,0xbc,
+0xcc,0xcc,0xcc,0xcc,0xc3,0xff,0x18,0x00,0x10,0x10,0x6b,0x12,0x00,0x31,0xcb,0x6f,
+0xff,0x01,0x00,0x11,0x9f,0x06,0x00,0x11,0x95,0x0e,0x00,0x70,0x65,0xf9,0x3d,0xff,
+0xff,0xfd,0x39,0x03,0x00,0x20,0xf9,0x3d,0x10,0x00,0x11,0xa4,0x17,0x00,0x33,0xb7,
+0xbf,0xff,0x01,0x00,0x12,0xfa,0x06,0x00,0xf0,0x2a,0x00,0x55,0x55,0x20,0x00,0x03,
+0xff,0xff,0x90,0x00,0x05,0xff,0xff,0x40,0x00,0x08,0xff,0xff,0x00,0x00,0x0a,0xff,
+0xfc,0x44,0x40,0x0c,0xff,0xff,0xff,0xf0,0x0e,0xff,0xff,0xff,0x80,0x0d,0xff,0xff,
+0xfe,0x00,0x00,0x00,0x8f,0xf6,0x00,0x00,0x00,0xbf,0xc0,0x00,0x00,0x00,0xff,0x30,
+0x00,0x00,0x03,0xec,0x00,0x74,0x07,0xf1,0x00,0x00,0x00,0x03,0x50,0x9f,0x00,0xb0,
+0x35,0x6e,0xf7,0x54,0x00,0x00,0xff,0xf9,0x8f,0xff,0x10,0x1d,0x01,0x00,0x06,0x00,
+0xf0,0x02,0xfa,0x24,0x44,0x01,0x00,0xff,0xf4,0xef,0xff,0x3e,0x20,0xff,0xf4,0xff,
+0xff,0x3f,0xe2,0x06,0x00,0x41,0x43,0x31,0xff,0xf4,0x5f,0x01,0x07,0x06,0x00,0x20,
+0x23,0x30,0x06,0x00,0x22,0x00,0x00,0x06,0x00,0x71,0x7a,0xaa,0xaa,0xa2,0x00,0x00,
+0x03,0x56,0x00,0x20,0x1f,0x70,0x6a,0x00,0xf0,0x0e,0xef,0xfa,0x10,0x00,0x00,0x8f,
+0xff,0xff,0xd0,0x00,0x01,0xff,0xff,0xff,0xf7,0x00,0x04,0xff,0xff,0xff,0xfb,0x00,
+0x07,0xff,0xff,0xff,0xfd,0x00,0x09,0x6d,0x00,0x20,0x00,0x0d,0x06,0x00,0x20,0x30,
+0x7f,0x06,0x00,0x11,0xd0,0x53,0x01,0x30,0xf4,0x13,0x33,0xb9,0x01,0x40,0x00,0x00,
+0xcf,0xf2,0x48,0x00,0x61,0x29,0x50,0x00,0x00,0x5a,0xaa,0x01,0x00,0x12,0x2f,0x03,
+0x01,0xf8,0x28,0xf9,0xfa,0x0d,0x01,0xb0,0xd0,0xa2,0x0f,0xaf,0xeb,0xfb,0xcf,0xbf,
+0xbe,0xcb,0xfa,0xff,0xe1,0x98,0x1c,0x1c,0x15,0xff,0xaf,0xfd,0x08,0x70,0xb0,0xb0,
+0x3f,0xfa,0xff,0xdf,0xdd,0xdd,0xdd,0xfd,0xdf,0xaf,0xa0,0xd0,0x00,0x00,0x0a,0x20,
+0xfa,0xfe,0xaf,0xaa,0xaa,0xaa,0xeb,0xaf,0x9a,0xff,0x80,0x01,0x31,0x41,0x00,0x00,
+0x9e,0x00,0x80,0xd0,0x00,0x00,0x00,0x01,0x8f,0xff,0xfc,0x68,0x00,0x60,0xff,0xff,
+0xff,0x50,0x00,0x03,0x69,0x01,0x41,0xe0,0x00,0x3c,0xff,0xae,0x00,0x31,0x0f,0xff,
+0xff,0x45,0x01,0x20,0x9e,0xff,0x51,0x01,0x00,0x33,0x00,0x30,0x5f,0xff,0xf1,0x07,
+0x00,0x42,0x05,0xff,0xf9,0x00,0x0f,0x00,0x12,0x20,0x0f,0x00,0x11,0xa0,0x0f,0x00,
+0x22,0x4f,0xf3,0x5f,0x00,0x70,0x76,0x00,0x00,0x00,0x34,0x44,0x43,0x4f,0x01,0x20,
+0xfb,0x8a,0x05,0x00,0xc0,0x8f,0xa0,0xff,0xff,0xfb,0x7f,0xf8,0xff,0xff,0xfc,0x11,
+0x11,0x4c,0x00,0x1f,0xfc,0x05,0x00,0x10,0x50,0xbd,0xdd,0xdd,0xdd,0xd8,0x9f,0x01,
+0x20,0x54,0x10,0x54,0x00,0xf0,0x29,0x6c,0xff,0xff,0xff,0xd8,0x10,0x00,0x04,0xef,
+0xff,0xdb,0xbc,0xff,0xff,0x70,0x08,0xff,0xd6,0x10,0x00,0x00,0x4b,0xff,0xb0,0xbf,
+0x70,0x00,0x13,0x32,0x00,0x05,0xed,0x10,0x30,0x06,0xdf,0xff,0xfe,0x80,0x01,0x10,
+0x00,0x0b,0xff,0xfc,0xce,0xff,0xd2,0x00,0x00,0x00,0xbe,0x60,0x00,0x04,0xde,0x3d,
+0x00,0x41,0x10,0x03,0x40,0x00,0x45,0x00,0x32,0x04,0xff,0x80,0xa2,0x00,0x22,0x6f,
+0xfa,0x08,0x00,0x72,0x01,0xac,0x30,0x00,0x00,0x00,0xaf,0x1d,0x01,0x31,0xd2,0x0f,
+0xea,0x68,0x01,0xd0,0xcf,0x90,0xfa,0x48,0x88,0x88,0x88,0x88,0x65,0xff,0x1f,0xa9,
+0xff,0xab,0x01,0x32,0x1a,0xf1,0xfa,0xfa,0x02,0xc0,0xaf,0x1f,0xa5,0x99,0x99,0x99,
+0x99,0x98,0x5f,0xf1,0xfd,0x99,0x01,0x00,0x33,0x9b,0xfa,0x0b,0x98,0x02,0x15,0x30,
+0xee,0x02,0x0f,0x4d,0x00,0x03,0x22,0x30,0x05,0x4d,0x00,0x23,0xf7,0x00,0x4d,0x00,
+0x22,0x70,0x01,0x4d,0x00,0x2f,0x94,0x00,0x4d,0x00,0x1e,0x22,0x00,0x00,0x4d,0x00,
+0x23,0xf0,0x00,0x4d,0x00,0x22,0x00,0x00,0x4d,0x00,0x2f,0x90,0x00,0x4d,0x00,0x1d,
+0x23,0x85,0x00,0x4d,0x00,0x22,0xa0,0x00,0x4d,0x00,0x23,0xfa,0x00,0x4d,0x00,0x2f,
+0x60,0x00,0x4d,0x00,0x1d,0x22,0x00,0x00,0x4d,0x00,0x01,0x0c,0x02,0x00,0x4d,0x00,
+0x02,0x62,0x01,0x13,0xaf,0x11,0x00,0x0f,0x4d,0x00,0x09,0x00,0x01,0x00,0x23,0x5c,
+0x50,0x95,0x02,0x11,0xfc,0x08,0x00,0x21,0x03,0xd0,0x11,0x00,0x30,0x64,0x00,0xa5,
+0xc1,0x01,0xf0,0x0b,0x00,0xbf,0xf6,0x4e,0x21,0x11,0x11,0x17,0xd3,0x0f,0xff,0xec,
+0xce,0xec,0xcc,0xcc,0xef,0xe1,0x7f,0xe3,0x00,0x2d,0x00,0x00,0x06,0x80,0xd9,0x01,
+0x32,0x97,0x0a,0xa6,0x44,0x00,0x13,0xcc,0x89,0x02,0x39,0x00,0x2f,0xfa,0x5c,0x00,
+0x20,0x01,0x10,0x89,0x00,0xf2,0x42,0xff,0xe8,0x00,0x00,0xdf,0xf8,0xcf,0xf8,0x00,
+0x7f,0xff,0x81,0xdf,0xf1,0x0c,0xfa,0xf8,0x52,0xdf,0x60,0xff,0x64,0x78,0x3a,0xf8,
+0x0f,0xff,0x50,0x08,0xff,0xa1,0xff,0xff,0x12,0xff,0xfa,0x0f,0xff,0x41,0x15,0xff,
+0xa0,0xef,0x46,0x88,0x48,0xf8,0x0b,0xfc,0xf8,0x42,0xef,0x50,0x5f,0xff,0x82,0xef,
+0xf1,0x00,0xaf,0xfa,0xef,0xf6,0x00,0x00,0x5a,0xdc,0xa4,0x00,0x00,0x01,0x56,0x63,
+0x00,0x00,0x78,0x8b,0xff,0xfe,0x88,0x82,0x53,0x03,0x70,0x12,0x22,0x22,0x22,0x22,
+0x20,0x3f,0x0c,0x00,0xcf,0x90,0x3f,0xfc,0xfc,0xfe,0xdf,0x90,0x3f,0xd5,0xf4,0xeb,
+0x7f,0x06,0x00,0x07,0x61,0xe6,0xf5,0xec,0x8f,0x90,0x2f,0x54,0x03,0x61,0x07,0x9a,
+0xaa,0xaa,0xa9,0x10,0xa4,0x00,0x12,0x14,0xf7,0x00,0x11,0xef,0xc2,0x00,0x11,0x0c,
+0x61,0x03,0xb0,0x03,0xc3,0xdf,0xff,0x00,0x00,0x00,0x3e,0xfd,0x3d,0xf5,0x1a,0x00,
+0x82,0xff,0xd3,0x50,0x00,0x00,0x3e,0xff,0xff,0x0d,0x00,0x21,0xff,0x60,0x0d,0x00,
+0x15,0xf6,0x0d,0x00,0x11,0x0b,0x0d,0x00,0x00,0x51,0x04,0x00,0xbc,0x01,0x11,0x0f,
+0x0d,0x00,0x33,0x00,0x08,0x86,0x66,0x01,0x10,0x8b,0x73,0x05,0x14,0xb6,0xb8,0x01,
+0xf0,0x0c,0xf2,0x00,0xbf,0xff,0xf8,0xbf,0xf6,0xef,0xff,0x40,0xbf,0xff,0xff,0x10,
+0xa4,0x09,0xff,0xf4,0xaf,0xff,0xff,0xfd,0x10,0x07,0xff,0xff,0x4d,0x83,0x04,0xf4,
+0x08,0x00,0xbf,0xff,0xf4,0x1d,0xff,0xff,0xf4,0x06,0x10,0xbf,0xff,0x40,0x1d,0xff,
+0xff,0x47,0xfd,0x2b,0xff,0xf4,0x00,0x1d,0xb7,0x01,0x11,0x1c,0x08,0x00,0xf0,0x02,
+0xa0,0x00,0x08,0x99,0x99,0x70,0x00,0xbf,0xff,0xff,0xf8,0x0a,0xd0,0xd0,0xd0,0xeb,
+0x9f,0x05,0x00,0x60,0xff,0xd1,0xd1,0xd1,0xeb,0xff,0xe6,0x04,0x0f,0x05,0x00,0x0b,
+0x10,0xef,0xc6,0x05,0x52,0x5c,0xdd,0xdd,0xdd,0xb2,0x9f,0x00,0x11,0xb0,0x37,0x05,
+0xf2,0x01,0x0b,0xf0,0x00,0x9f,0x10,0x00,0x00,0x0f,0xf0,0x0a,0xff,0x21,0x11,0x11,
+0x1f,0xf0,0xad,0x00,0x12,0xf0,0x22,0x06,0x32,0xd0,0x08,0xff,0x2a,0x01,0x12,0x7f,
+0x07,0x00,0x60,0x01,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const etxFontBlock blocks[] = {
+{ .bitmap_index = 0, .comp_offset = 0, .size = 4038, .comp_size = 3692 },
+{ .bitmap_index = 4038, .comp_offset = 3692, .size = 4031, .comp_size = 3472 },
+{ .bitmap_index = 8069, .comp_offset = 7164, .size = 4068, .comp_size = 3658 },
+{ .bitmap_index = 12137, .comp_offset = 10822, .size = 4075, .comp_size = 3614 },
+{ .bitmap_index = 16212, .comp_offset = 14436, .size = 4063, .comp_size = 3537 },
+{ .bitmap_index = 20275, .comp_offset = 17973, .size = 4042, .comp_size = 3717 },
+{ .bitmap_index = 24317, .comp_offset = 21690, .size = 4076, .comp_size = 3755 },
+{ .bitmap_index = 28393, .comp_offset = 25445, .size = 4032, .comp_size = 3714 },
+{ .bitmap_index = 32425, .comp_offset = 29159, .size = 4080, .comp_size = 3736 },
+{ .bitmap_index = 36505, .comp_offset = 32895, .size = 4057, .comp_size = 3708 },
+{ .bitmap_index = 40562, .comp_offset = 36603, .size = 4033, .comp_size = 3779 },
+{ .bitmap_index = 44595, .comp_offset = 40382, .size = 4039, .comp_size = 3713 },
+{ .bitmap_index = 48634, .comp_offset = 44095, .size = 4069, .comp_size = 3787 },
+{ .bitmap_index = 52703, .comp_offset = 47882, .size = 4022, .comp_size = 3709 },
+{ .bitmap_index = 56725, .comp_offset = 51591, .size = 4028, .comp_size = 3327 },
+{ .bitmap_index = 60753, .comp_offset = 54918, .size = 1833, .comp_size = 1251 },
 };
 
 static const etxFontCmap cmaps[] = {
@@ -3741,11 +3929,11 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 63475, .glyph_id_start = 115, .list_length = 704, .type = 3, .unicode_list = 6552, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[73888] __SDRAMFONTS;
+static uint8_t etxUncompBuf[11302] __SDRAMFONTS;
 
 const etxLz4Font lv_font_tw_bold_STD = {
-.uncomp_size = 73624,
-.comp_size = 59670,
+.uncomp_size = 11038,
+.comp_size = 6158,
 .line_height = 15,
 .base_line = 3,
 .subpx = 0,
@@ -3758,12 +3946,15 @@ const etxLz4Font lv_font_tw_bold_STD = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 7960,
-.class_pair_values = 70546,
-.left_class_mapping = 71986,
-.right_class_mapping = 72805,
+.glyph_bitmap = 0,
+.class_pair_values = 7960,
+.left_class_mapping = 9400,
+.right_class_mapping = 10219,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 73888,
+.lvglFontBufSize = 11302,
+.block_count = 16,
+.blocks = blocks,
+.compressed_bitmap = lz4BitmapData,
 };
@@ -212,2835 +212,3089 @@ static const uint8_t lz4FontData[] ={
 0xe3,0x2f,0x00,0x01,0x02,0x03,0x00,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,
 0x0c,0x0d,0x0e,0x0f,0x10,0x00,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,
 0x1b,0x1c,0x1d,0x00,0x1e,0x1f,0x00,0x20,0x21,0x22,0x23,0x24,0x25,0x00,0x26,0x27,
-0x28,0x29,0x2a,0xb8,0x12,0xf0,0xff,0xff,0xff,0x76,0x0d,0x00,0x11,0x1d,0x1b,0x1d,
-0x1c,0x1d,0x1e,0x1d,0x32,0x1d,0x3e,0x1d,0x68,0x1d,0x97,0x1d,0xe7,0x1d,0xe9,0x1d,
-0x07,0x1e,0x0c,0x1e,0x5e,0x1e,0x5f,0x1e,0x64,0x1e,0x6d,0x1e,0x90,0x1e,0xee,0x1e,
-0xf2,0x1e,0xff,0x1e,0x1e,0x1f,0x35,0x1f,0x60,0x1f,0x6d,0x1f,0x85,0x1f,0xaa,0x1f,
-0xe0,0x1f,0x54,0x20,0x56,0x20,0x59,0x20,0x76,0x20,0x79,0x20,0x7d,0x20,0x82,0x20,
-0x88,0x20,0x96,0x20,0x97,0x20,0x9e,0x20,0x0b,0x21,0x17,0x21,0x2e,0x21,0x36,0x21,
-0x3a,0x21,0x4c,0x21,0x5b,0x21,0x5e,0x21,0x83,0x21,0xac,0x21,0xb0,0x21,0xb1,0x21,
-0xca,0x21,0xe6,0x21,0x27,0x22,0x69,0x22,0xcc,0x22,0xe8,0x22,0x04,0x23,0x08,0x23,
-0x19,0x23,0x1d,0x23,0x1e,0x23,0x22,0x23,0x37,0x23,0x3c,0x23,0x5b,0x23,0x79,0x23,
-0x60,0x24,0x79,0x25,0xef,0x25,0x03,0x26,0x0b,0x26,0x0e,0x26,0x38,0x26,0x39,0x26,
-0x58,0x26,0xdc,0x26,0x42,0x27,0x68,0x27,0xa8,0x27,0x01,0x28,0x1a,0x28,0x27,0x28,
-0x2b,0x28,0x38,0x28,0x3f,0x28,0x42,0x28,0x79,0x28,0x69,0x2a,0x9d,0x2a,0xab,0x2a,
-0xb0,0x2a,0xca,0x2a,0x0f,0x2b,0x20,0x2b,0x22,0x2b,0xf7,0x2c,0xff,0x2c,0x49,0x2d,
-0x84,0x2d,0xb7,0x2d,0xb8,0x2d,0x07,0x2e,0x20,0x2e,0x42,0x2e,0x46,0x2e,0x48,0x2e,
-0x64,0x2e,0x73,0x2e,0x82,0x2e,0x96,0x2e,0x9d,0x2e,0xba,0x2e,0xbf,0x2e,0xd6,0x2e,
-0xed,0x2e,0x36,0x2f,0xd6,0x2f,0x04,0x30,0x20,0x30,0x5c,0x30,0x21,0x31,0x5c,0x31,
-0xaf,0x31,0xcd,0x31,0xe3,0x31,0xf2,0x31,0x12,0x32,0x50,0x32,0xb6,0x32,0xb9,0x32,
-0xd4,0x32,0xec,0x32,0xde,0x33,0x68,0x34,0x81,0x34,0x98,0x34,0xc1,0x34,0xca,0x34,
-0xf3,0x34,0xf6,0x34,0x1f,0x35,0x53,0x35,0x80,0x35,0x05,0x36,0x09,0x36,0x11,0x36,
-0x1a,0x36,0x30,0x36,0x3b,0x36,0x3c,0x36,0x3d,0x36,0x72,0x36,0xb1,0x36,0x4d,0x37,
-0x2d,0x38,0x86,0x38,0x93,0x38,0xdc,0x38,0x2a,0x39,0x70,0x39,0x73,0x3a,0x74,0x3a,
-0x9c,0x3a,0xdf,0x3a,0xe5,0x3a,0x28,0x3b,0x71,0x3b,0xe6,0x3b,0xf3,0x3b,0x99,0x3c,
-0x2c,0x3d,0x3a,0x3d,0xa1,0x3d,0xa7,0x3d,0x25,0x3e,0x81,0x3e,0x32,0x40,0xc7,0x41,
-0x98,0x42,0x0f,0x43,0x17,0x43,0x30,0x44,0x39,0x44,0x4c,0x44,0x7b,0x44,0x8c,0x45,
-0x51,0x46,0xcb,0x47,0x4b,0x48,0xe3,0x48,0x01,0x49,0x0c,0x49,0x8b,0x49,0x92,0x49,
-0x00,0x4a,0x3d,0x4a,0x65,0x4a,0xa8,0x4a,0xb2,0x4a,0xd5,0x4a,0xcf,0x4b,0x31,0x4c,
-0x33,0x4c,0x41,0x4c,0x53,0x4c,0x5d,0x4c,0x82,0x4c,0xaa,0x4c,0xab,0x4c,0xdb,0x4c,
-0xe2,0x4c,0xeb,0x4c,0xf9,0x4c,0x7f,0x4e,0x83,0x4e,0x14,0x4f,0x16,0x4f,0xdd,0x4f,
-0x0e,0x50,0xfb,0x50,0x80,0x51,0x83,0x51,0x46,0x54,0x5d,0x57,0x6e,0x57,0x79,0x57,
-0x81,0x57,0xd6,0x57,0x0e,0x58,0x18,0x58,0x92,0x58,0x9c,0x58,0xa0,0x58,0xa7,0x58,
-0xf4,0x58,0x11,0x59,0x19,0x59,0x29,0x59,0x3e,0x59,0x4d,0x59,0x83,0x59,0x84,0x59,
-0x9e,0x59,0xaf,0x59,0xbd,0x59,0xbe,0x59,0xe7,0x59,0x69,0x5a,0x77,0x5a,0xcc,0x5b,
-0xcd,0x5b,0x75,0x5c,0x88,0x5c,0x96,0x5c,0xee,0x5c,0x09,0x5e,0x14,0x5e,0x2e,0x5e,
-0xcd,0x5e,0x0e,0x5f,0x12,0x5f,0x2b,0x5f,0x30,0x5f,0x56,0x5f,0x5f,0x5f,0x7a,0x5f,
-0x89,0x5f,0xf9,0x5f,0xe0,0x60,0x43,0x62,0x88,0x64,0x9c,0x64,0xa4,0x64,0x75,0x65,
-0xd7,0x65,0xf3,0x65,0x0c,0x66,0x63,0x66,0x6f,0x66,0x73,0x66,0xe4,0x66,0x04,0x67,
-0x17,0x67,0x5d,0x67,0xec,0x67,0xe9,0x69,0x12,0xbf,0x19,0xbf,0x1c,0xbf,0x1d,0xbf,
-0x1e,0xbf,0x22,0xbf,0x24,0xbf,0x26,0xbf,0x2a,0xbf,0x2d,0xbf,0x32,0xbf,0x37,0xbf,
-0x38,0xbf,0x39,0xbf,0x4f,0xbf,0x54,0xbf,0x59,0xbf,0x5c,0xbf,0x5d,0xbf,0x5e,0xbf,
-0x62,0xbf,0x63,0xbf,0x64,0xbf,0x65,0xbf,0x78,0xbf,0x79,0xbf,0x7f,0xbf,0x81,0xbf,
-0x82,0xbf,0x85,0xbf,0x88,0xbf,0x89,0xbf,0x8a,0xbf,0x8c,0xbf,0xa4,0xbf,0xa6,0xbf,
-0xd5,0xbf,0xd6,0xbf,0xd8,0xbf,0xda,0xbf,0xf1,0xbf,0xf8,0xbf,0xfb,0xbf,0x04,0xc0,
-0x2d,0xc0,0x35,0xc0,0x6c,0xc0,0xfc,0xc0,0x51,0xc1,0x52,0xc1,0x53,0xc1,0x54,0xc1,
-0x55,0xc1,0x98,0xc1,0xa4,0xc1,0xfe,0xc1,0x15,0xc2,0x6b,0xc4,0xd3,0xc6,0xb3,0xc7,
-0x0f,0xf6,0x0e,0xf6,0x0e,0xf5,0x0d,0xf5,0x0d,0xf4,0x0c,0xf4,0x0c,0xf3,0x0b,0xf3,
-0x02,0x30,0x03,0x60,0x0f,0xf6,0x0b,0xe3,0x8f,0x1f,0xa8,0xf0,0xf9,0x8f,0x0f,0x78,
-0xd0,0xf6,0x36,0x07,0x20,0x00,0x06,0xf0,0x7f,0x00,0x00,0x09,0xd0,0xac,0x00,0x00,
-0x0c,0xa0,0xd9,0x00,0x0e,0xff,0xff,0xff,0xf3,0x06,0x8f,0x98,0xf8,0x61,0x00,0x4f,
-0x25,0xf1,0x00,0x01,0x7f,0x28,0xf1,0x10,0x8f,0xff,0xff,0xff,0xa0,0x24,0xdc,0x4e,
-0xb4,0x20,0x00,0xe8,0x0f,0x70,0x00,0x00,0xf5,0x1f,0x40,0x00,0x03,0xf3,0x4f,0x20,
-0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x0c,0x70,0x00,0x00,0x3a,0xfe,0x70,0x00,0x3f,
-0xff,0xff,0xa0,0x0a,0xfb,0x05,0xff,0x20,0xcf,0x70,0x0d,0xf5,0x0a,0xfc,0x10,0x00,
-0x00,0x3f,0xff,0x91,0x00,0x00,0x3c,0xff,0xf4,0x00,0x00,0x03,0xcf,0xf1,0x18,0x70,
-0x00,0xef,0x52,0xff,0x30,0x0e,0xf5,0x0c,0xfe,0x8b,0xff,0x20,0x2d,0xff,0xff,0x60,
-0x00,0x03,0xf8,0x10,0x00,0x00,0x0e,0x50,0x00,0x05,0xdf,0xa0,0x00,0x00,0x00,0x1f,
-0xb7,0xf7,0x01,0x80,0x00,0x3f,0x40,0xda,0x0a,0xc0,0x00,0x2f,0x82,0xf9,0x3f,0x30,
-0x00,0x09,0xff,0xe2,0xd9,0x00,0x00,0x00,0x23,0x07,0xe1,0x00,0x20,0x00,0x10,0x60,
-0x06,0x00,0xf1,0x56,0xac,0x2c,0xfe,0x50,0x00,0x04,0xf3,0xae,0x5b,0xf0,0x00,0x0d,
-0x90,0xcb,0x06,0xf1,0x00,0x2c,0x10,0xae,0x6c,0xf0,0x00,0x00,0x00,0x1b,0xfd,0x40,
-0x00,0x3c,0xfd,0x50,0x00,0x00,0x1e,0xff,0xff,0x30,0x00,0x05,0xfb,0x08,0xf7,0x00,
-0x00,0x6f,0xa0,0x8f,0x60,0x00,0x02,0xff,0xaf,0xd0,0x00,0x00,0x09,0xff,0xb1,0x00,
-0x00,0x05,0xff,0xfc,0x04,0xd8,0x02,0xff,0x6e,0xf9,0x7f,0x80,0x6f,0xe0,0x3f,0xff,
-0xf4,0x05,0xff,0x10,0x6f,0xfd,0x00,0x0d,0xfe,0xcf,0xff,0xe2,0x00,0x19,0xef,0xd8,
-0xaf,0xd0,0x8f,0x28,0xf2,0x8f,0x18,0xf0,0x47,0xa8,0x16,0xf1,0x07,0x03,0xe1,0x00,
-0x1e,0xd1,0x00,0xaf,0x20,0x02,0xfa,0x00,0x08,0xf5,0x00,0x0b,0xf2,0x00,0x0e,0xf0,
-0x00,0x0f,0xe0,0x03,0x00,0xf0,0x36,0xf0,0x00,0x0d,0xf0,0x00,0x0a,0xf3,0x00,0x05,
-0xf7,0x00,0x00,0xee,0x00,0x00,0x6f,0x70,0x00,0x09,0xf2,0x00,0x00,0x70,0x00,0x00,
-0x07,0xb0,0x00,0x4f,0xa0,0x00,0x8f,0x50,0x01,0xfd,0x00,0x0c,0xf3,0x00,0x8f,0x70,
-0x06,0xfa,0x00,0x5f,0xb0,0x04,0xfc,0x00,0x5f,0xa0,0x06,0xf8,0x00,0x9f,0x50,0x0d,
-0xf0,0x04,0xf9,0x00,0xcf,0x10,0x8f,0x40,0x04,0x30,0x00,0x00,0x4b,0x01,0xf1,0x08,
-0x0f,0x60,0x00,0x8d,0x6e,0x89,0xd0,0x5b,0xff,0xfe,0x90,0x00,0xaf,0xe1,0x00,0x07,
-0xf4,0xeb,0x00,0x09,0x90,0x6d,0x10,0x80,0x00,0xf0,0x02,0x07,0xa4,0x00,0x00,0x00,
-0xbf,0x60,0x00,0x00,0x0b,0xf6,0x00,0x01,0x22,0xcf,0x72,0x20,0x88,0x01,0x50,0x48,
-0xff,0xff,0xff,0xf4,0x12,0x00,0x05,0x1b,0x00,0xf9,0x1a,0x00,0x0e,0xf0,0xef,0x0f,
-0xd4,0xf8,0x5c,0x00,0x2e,0xee,0xe3,0x2f,0xff,0xf4,0x03,0x70,0x0f,0xf7,0x0a,0xf4,
-0x00,0x00,0x1f,0x90,0x00,0x06,0xf4,0x00,0x00,0xbe,0x00,0x00,0x0f,0xa0,0x00,0x05,
-0xf5,0x00,0x00,0xaf,0x0a,0x00,0xff,0x41,0xb0,0x00,0x04,0xf6,0x00,0x00,0xaf,0x10,
-0x00,0x0e,0xb0,0x00,0x00,0x00,0x6d,0xfe,0x80,0x00,0x6f,0xff,0xff,0x90,0x0e,0xf8,
-0x05,0xff,0x12,0xff,0x10,0x0e,0xf4,0x3f,0xf0,0x00,0xdf,0x64,0xff,0x00,0x0d,0xf7,
-0x4f,0xf0,0x00,0xdf,0x73,0xff,0x00,0x0d,0xf6,0x2f,0xf1,0x00,0xef,0x40,0xef,0x80,
-0x5f,0xf1,0x06,0xff,0xff,0xf9,0x00,0x06,0xdf,0xe8,0x00,0x00,0x16,0xc4,0x3a,0xff,
-0xf4,0xbf,0xff,0xf4,0x65,0x0f,0xf4,0x00,0x03,0x00,0x05,0xf1,0x35,0x7d,0xfd,0x80,
-0x00,0xaf,0xff,0xff,0xa0,0x2f,0xf4,0x06,0xff,0x05,0xec,0x00,0x1f,0xf2,0x00,0x00,
-0x04,0xff,0x00,0x00,0x00,0xdf,0x80,0x00,0x00,0xbf,0xd0,0x00,0x00,0xaf,0xe2,0x00,
-0x00,0x8f,0xf3,0x00,0x00,0x6f,0xf4,0x00,0x00,0x2f,0xff,0xee,0xee,0x83,0xff,0xff,
-0xff,0xf9,0x01,0x9e,0xfd,0x70,0x00,0xcf,0xfe,0xff,0xa0,0x3f,0xf3,0x05,0xff,0x11,
-0x33,0x36,0x00,0xf0,0x37,0x08,0xfe,0x00,0x00,0xef,0xfd,0x20,0x00,0x0c,0xef,0xf7,
-0x00,0x00,0x00,0x3f,0xf2,0x25,0x40,0x00,0xef,0x56,0xff,0x20,0x4f,0xf4,0x0d,0xff,
-0xef,0xfc,0x00,0x19,0xdf,0xd8,0x00,0x00,0x00,0x2f,0xf7,0x00,0x00,0x0c,0xff,0x70,
-0x00,0x06,0xff,0xf7,0x00,0x01,0xee,0xdf,0x70,0x00,0xaf,0x5c,0xf7,0x00,0x4f,0xb0,
-0xcf,0x70,0x0d,0xf1,0x0c,0xf7,0x07,0xff,0xee,0xff,0xfa,0x43,0x01,0xa0,0xc0,0x00,
-0x00,0xcf,0x70,0x00,0x00,0x0c,0xf7,0x00,0x09,0x00,0xf0,0x11,0x04,0xff,0xff,0xff,
-0x20,0x6f,0xff,0xff,0xf2,0x08,0xf9,0x00,0x00,0x00,0x9f,0x70,0x00,0x00,0x0b,0xfc,
-0xef,0xb1,0x00,0xdf,0xfd,0xff,0xd0,0x01,0x51,0x03,0xff,0x40,0x29,0x00,0xf0,0x31,
-0x17,0x70,0x00,0xcf,0x70,0xff,0x70,0x3f,0xf4,0x07,0xff,0xff,0xfc,0x00,0x06,0xdf,
-0xe9,0x00,0x00,0x02,0x9d,0xe0,0x00,0x05,0xff,0xfe,0x00,0x02,0xff,0x92,0x00,0x00,
-0xaf,0xa0,0x00,0x00,0x0f,0xf8,0xdf,0xc3,0x02,0xff,0xff,0xff,0xe0,0x3f,0xf7,0x02,
-0xff,0x63,0xff,0x00,0x0b,0xf8,0x1f,0xf2,0x00,0xbf,0x90,0xdf,0x90,0x2f,0xf5,0x04,
-0x36,0x00,0x31,0x04,0xcf,0xe9,0x49,0x03,0xf0,0x07,0x87,0xee,0xee,0xef,0xf6,0x00,
-0x00,0x02,0xff,0x10,0x00,0x00,0x8f,0x90,0x00,0x00,0x0f,0xf3,0x00,0x00,0x06,0xfc,
-0x12,0x01,0x90,0x60,0x00,0x00,0x4f,0xe0,0x00,0x00,0x0b,0xf8,0x1e,0x00,0x90,0x20,
-0x00,0x00,0x9f,0xb0,0x00,0x00,0x1f,0xf5,0x9e,0x01,0xf0,0x13,0xfd,0x80,0x00,0x7f,
-0xff,0xff,0xa0,0x0d,0xf8,0x05,0xff,0x00,0xff,0x40,0x1f,0xf2,0x0c,0xf9,0x07,0xfe,
-0x00,0x2d,0xff,0xfe,0x30,0x04,0xff,0xff,0xf6,0x00,0xef,0x60,0x3f,0xf2,0xb0,0x01,
-0xf0,0x03,0x62,0xff,0x50,0x3f,0xf5,0x0b,0xff,0xef,0xfd,0x00,0x08,0xdf,0xe9,0x10,
-0x00,0x6d,0xfd,0x50,0x36,0x00,0xf0,0x00,0x50,0x0f,0xf7,0x07,0xfe,0x04,0xff,0x00,
-0x0f,0xf3,0x4f,0xf0,0x00,0xef,0x51,0x24,0x00,0xf2,0x12,0x0a,0xff,0xdf,0xff,0x40,
-0x0a,0xfe,0x8f,0xf2,0x00,0x00,0x05,0xfe,0x00,0x00,0x15,0xef,0x70,0x00,0x9f,0xff,
-0xb0,0x00,0x09,0xfc,0x60,0x00,0x0a,0xe3,0x0f,0xf7,0x03,0x70,0xa8,0x19,0x01,0x4a,
-0x02,0x74,0xe3,0x0c,0xe2,0x1f,0xf5,0x04,0x60,0xc3,0x19,0xa5,0x0b,0xf2,0x0b,0xf2,
-0x0d,0xf0,0x2f,0xa0,0x3d,0x20,0xd5,0x19,0xf0,0x16,0xb2,0x00,0x06,0xdf,0xf2,0x18,
-0xef,0xfe,0x80,0x9f,0xfa,0x40,0x00,0x9f,0xfc,0x60,0x00,0x06,0xdf,0xff,0xa1,0x00,
-0x04,0xbf,0xf2,0x00,0x00,0x02,0x92,0xff,0xff,0xff,0xf0,0xde,0xee,0xee,0xe0,0x2a,
-0x00,0x00,0x08,0x00,0x00,0x10,0x00,0xf0,0x3f,0x0c,0x50,0x00,0x00,0x1f,0xfd,0x70,
-0x00,0x07,0xdf,0xff,0x92,0x00,0x03,0x9e,0xfc,0x00,0x05,0xbf,0xfb,0x09,0xef,0xfe,
-0x71,0x1f,0xfc,0x50,0x00,0x0a,0x30,0x00,0x00,0x03,0xbf,0xeb,0x20,0x2f,0xff,0xff,
-0xe0,0x8f,0xd0,0x2f,0xf4,0x24,0x20,0x0f,0xf5,0x00,0x00,0x6f,0xf1,0x00,0x05,0xff,
-0x50,0x00,0x0f,0xf6,0x00,0x00,0x3f,0xd0,0x00,0x00,0x14,0x30,0x00,0x00,0x06,0x30,
-0x00,0x00,0x7f,0xf0,0x00,0x00,0x3e,0xbf,0x02,0xf2,0x45,0x3a,0xdf,0xeb,0x40,0x00,
-0x00,0x08,0xfc,0x75,0x6b,0xf9,0x00,0x00,0x8f,0x60,0x01,0x00,0x4f,0x70,0x03,0xf8,
-0x01,0xcf,0xfa,0x07,0xf1,0x0a,0xe0,0x0c,0xf6,0xbf,0x01,0xf5,0x0f,0x90,0x5f,0x60,
-0x9f,0x00,0xd8,0x2f,0x50,0xaf,0x10,0xae,0x00,0xb9,0x4f,0x30,0xde,0x00,0xbd,0x00,
-0xca,0x4f,0x30,0xed,0x00,0xcc,0x00,0xd7,0x3f,0x50,0xde,0x00,0xfb,0x02,0xf4,0x0f,
-0x80,0x9f,0x8b,0xfe,0x6d,0xc0,0x0b,0xe1,0x1c,0xfa,0x2d,0xfb,0x10,0x02,0xfc,0x84,
-0x03,0xb0,0x5f,0xfa,0x77,0x99,0x00,0x00,0x00,0x02,0x8d,0xff,0xc6,0x0f,0x00,0x30,
-0xef,0xa0,0x00,0xd6,0x04,0x10,0x00,0x4f,0x04,0x10,0xf5,0x10,0x00,0xf0,0x71,0xdf,
-0xb0,0x00,0x00,0x4f,0xf4,0xff,0x10,0x00,0x0a,0xfb,0x0e,0xf6,0x00,0x00,0xff,0x60,
-0xaf,0xc0,0x00,0x5f,0xf1,0x05,0xff,0x20,0x0b,0xff,0xff,0xff,0xf7,0x01,0xff,0xff,
-0xff,0xff,0xd0,0x6f,0xf2,0x00,0x05,0xff,0x2c,0xfb,0x00,0x00,0x0e,0xf8,0xff,0xff,
-0xfd,0x80,0x0f,0xff,0xff,0xff,0xb0,0xff,0x50,0x08,0xff,0x1f,0xf5,0x00,0x2f,0xf2,
-0xff,0x50,0x08,0xfe,0x0f,0xff,0xff,0xfe,0x30,0xff,0xdc,0xcf,0xfa,0x0f,0xf5,0x00,
-0x2f,0xf4,0xff,0x50,0x00,0xef,0x7f,0xf5,0x00,0x5f,0xf5,0xff,0xff,0xff,0xfd,0x0f,
-0xff,0xff,0xd9,0x10,0x00,0x19,0xef,0xe9,0x10,0x01,0xdf,0xff,0xff,0xd1,0x0a,0xfe,
-0x30,0x3e,0xf8,0x0f,0xf6,0x00,0x08,0xfd,0x3f,0xf2,0x00,0x00,0x21,0x4f,0xf0,0xa3,
-0x00,0x00,0x05,0x00,0x00,0x0f,0x00,0xf1,0x01,0x11,0x0f,0xf5,0x00,0x08,0xfd,0x0a,
-0xfd,0x30,0x3e,0xf9,0x01,0xef,0xff,0xff,0xd1,0x37,0x00,0x00,0x40,0x00,0x02,0x60,
-0x00,0x30,0x50,0x3c,0xfd,0x60,0x00,0xf0,0x1a,0xf5,0xff,0x50,0x00,0xcf,0x9f,0xf5,
-0x00,0x0a,0xfb,0xff,0x50,0x00,0xaf,0xbf,0xf5,0x00,0x0c,0xf9,0xff,0x50,0x02,0xff,
-0x5f,0xf5,0x03,0xcf,0xd0,0xff,0xff,0xff,0xe3,0x0f,0xff,0xfe,0x92,0x00,0xff,0xff,
-0xff,0xfa,0x89,0x03,0x44,0xff,0x50,0x00,0x00,0x04,0x00,0x00,0xcb,0x00,0x4b,0xff,
-0xfe,0xee,0xc0,0x14,0x00,0x13,0xf9,0x2c,0x00,0x11,0xf6,0x04,0x00,0x0c,0x30,0x00,
-0x00,0x04,0x00,0x08,0x14,0x00,0x03,0x04,0x00,0xf0,0x09,0x00,0x18,0xdf,0xea,0x20,
-0x00,0x1d,0xff,0xff,0xfe,0x10,0x09,0xff,0x40,0x2e,0xf9,0x00,0xef,0x70,0x00,0x6f,
-0xe0,0x2f,0xf3,0x76,0x02,0x10,0xff,0x5b,0x02,0xf0,0x09,0x4f,0xf2,0x07,0xff,0xff,
-0x02,0xff,0x30,0x5d,0xdf,0xf0,0x0e,0xf8,0x00,0x05,0xff,0x00,0x8f,0xf5,0x00,0x8f,
-0xf0,0x00,0xdf,0x4a,0x03,0x40,0x00,0x8d,0xfe,0xc6,0x46,0x00,0x2f,0x1f,0xf4,0x05,
-0x00,0x02,0x00,0x21,0x05,0x02,0x05,0x00,0x0f,0x23,0x00,0x05,0x3b,0xdf,0x8d,0xf8,
-0x03,0x00,0x4f,0x00,0x00,0x06,0xff,0x04,0x00,0x09,0xf0,0x01,0x6a,0x70,0x06,0xfe,
-0x8f,0xe1,0x1c,0xfb,0x1f,0xff,0xff,0xf3,0x02,0xbe,0xfc,0x40,0x32,0x01,0xf0,0x09,
-0xc0,0xff,0x50,0x0c,0xfe,0x10,0xff,0x50,0x8f,0xf4,0x00,0xff,0x54,0xff,0x80,0x00,
-0xff,0x7e,0xfc,0x00,0x00,0xff,0xef,0xf5,0xfa,0x00,0xf0,0x08,0xfd,0x00,0x00,0xff,
-0xf8,0xff,0x70,0x00,0xff,0x80,0xaf,0xf2,0x00,0xff,0x50,0x1e,0xfb,0x00,0xff,0x50,
-0x06,0xff,0x50,0x7b,0x01,0x1e,0xe1,0x10,0x01,0x0e,0x04,0x00,0x03,0x40,0x01,0x11,
-0xf5,0x04,0x00,0x40,0xf3,0x00,0x00,0x4f,0x74,0x05,0x40,0x00,0x9f,0xff,0xff,0x05,
-0x05,0xf0,0x1a,0xff,0xff,0xdf,0x40,0x04,0xfd,0xff,0xff,0x9f,0x90,0x09,0xf9,0xff,
-0xff,0x4f,0xe0,0x0e,0xf4,0xff,0xff,0x4b,0xf4,0x4f,0xb4,0xff,0xff,0x45,0xf9,0x9f,
-0x54,0xff,0xff,0x50,0xfe,0xef,0x05,0xff,0xff,0x50,0xaf,0xfa,0x06,0x00,0x30,0x5f,
-0xf5,0x05,0x04,0x04,0x50,0xf0,0x05,0xff,0xff,0xa0,0x00,0x01,0x10,0xf3,0x05,0x00,
-0x11,0xfc,0x28,0x01,0xf0,0x0d,0x60,0x1f,0xf4,0xff,0xcf,0xe0,0x1f,0xf4,0xff,0x5d,
-0xf8,0x1f,0xf4,0xff,0x54,0xff,0x3f,0xf4,0xff,0x50,0xaf,0xcf,0xf4,0xff,0x50,0x2f,
-0xff,0xf4,0xa0,0x02,0x01,0x8a,0x02,0x00,0x05,0x00,0xf0,0x21,0x5f,0xf4,0x00,0x08,
-0xdf,0xd8,0x10,0x00,0x0d,0xff,0xff,0xfd,0x10,0x09,0xff,0x51,0x4e,0xf9,0x00,0xff,
-0x70,0x00,0x7f,0xf0,0x3f,0xf2,0x00,0x02,0xff,0x34,0xff,0x10,0x00,0x0f,0xf5,0x4f,
-0xf1,0x00,0x00,0xff,0x53,0xff,0x20,0x00,0x2f,0xf3,0x0f,0xf7,0x35,0x01,0x70,0x9f,
-0xf5,0x04,0xef,0x90,0x00,0xdf,0x87,0x02,0x53,0x00,0x8d,0xfd,0x81,0x00,0xfa,0x02,
-0x00,0x0f,0x02,0xf0,0x01,0x05,0xff,0x6f,0xf5,0x00,0x0b,0xfa,0xff,0x50,0x00,0xbf,
-0xbf,0xf5,0x00,0x4f,0xf7,0xe8,0x02,0x50,0x1f,0xff,0xff,0xe9,0x10,0xf6,0x00,0x10,
-0x0f,0x57,0x03,0x05,0x09,0x00,0x20,0x00,0x08,0xd8,0x05,0x13,0x1d,0x78,0x00,0x18,
-0x5f,0x78,0x00,0x20,0x35,0xff,0x24,0x00,0x28,0x5f,0xf0,0x78,0x00,0x57,0x07,0xff,
-0x00,0x9f,0xf4,0x78,0x00,0x20,0xff,0xfd,0x4c,0x02,0x20,0x2d,0xfe,0xcc,0x03,0x90,
-0x0a,0x50,0xff,0xff,0xfd,0x70,0x0f,0xff,0xff,0xb9,0x01,0x60,0x07,0xff,0x4f,0xf5,
-0x00,0x0f,0xaf,0x02,0x00,0x8c,0x00,0x20,0x8f,0xf2,0xad,0x03,0x10,0x0f,0x64,0x01,
-0xc0,0xff,0x50,0x7f,0xf1,0x0f,0xf5,0x00,0xef,0x80,0xff,0x50,0x06,0xa1,0x03,0xf0,
-0x11,0x0e,0xf9,0x00,0x5c,0xff,0xc6,0x00,0x07,0xff,0xff,0xff,0x80,0x0f,0xf9,0x00,
-0x8f,0xf1,0x1f,0xf5,0x00,0x1a,0xa2,0x0c,0xfe,0x60,0x00,0x00,0x02,0xdf,0xff,0xa2,
-0x00,0xc5,0x04,0x10,0x40,0xdf,0x08,0xc0,0xe0,0x5d,0xc0,0x00,0x2f,0xf3,0x2f,0xf7,
-0x00,0x6f,0xf2,0x09,0xe1,0x03,0x60,0x00,0x5c,0xff,0xd7,0x00,0xbf,0x20,0x03,0x20,
-0xaf,0xff,0x59,0x00,0x10,0x04,0xf0,0x05,0x0f,0x05,0x00,0x19,0x5f,0x1f,0xf4,0x00,
-0x0b,0xfa,0x05,0x00,0x0f,0xc1,0xf9,0x0f,0xf5,0x00,0x0d,0xf8,0x0c,0xfc,0x20,0x5f,
-0xf5,0x03,0x78,0x00,0xf2,0x00,0x3b,0xff,0xd8,0x00,0xcf,0xc0,0x00,0x05,0xff,0x37,
-0xff,0x10,0x00,0xaf,0xe0,0xc4,0x00,0xf0,0x0f,0xcf,0xa0,0x03,0xff,0x40,0x07,0xfe,
-0x00,0x8f,0xe0,0x00,0x2f,0xf3,0x0c,0xf9,0x00,0x00,0xcf,0x81,0xff,0x40,0x00,0x07,
-0xfc,0x5f,0xe0,0x00,0x00,0x2f,0xfc,0xf9,0x06,0x01,0xc7,0x00,0x30,0x07,0xff,0xe0,
-0x46,0x07,0x10,0xf9,0x7c,0x06,0xf0,0x31,0x01,0xff,0x10,0x0b,0xfa,0x6f,0xe0,0x04,
-0xff,0x50,0x0d,0xf6,0x3f,0xf1,0x08,0xff,0x90,0x0f,0xf3,0x0f,0xf3,0x0b,0xff,0xc0,
-0x3f,0xf0,0x0c,0xf6,0x0f,0xed,0xf0,0x6f,0xc0,0x09,0xf9,0x2f,0xaa,0xf3,0x9f,0x90,
-0x05,0xfc,0x6f,0x66,0xf7,0xcf,0x60,0x02,0xff,0xaf,0x32,0xfa,0xff,0x20,0x00,0xef,
-0xff,0x00,0xff,0xff,0x00,0x00,0xbf,0xfb,0x03,0x00,0x60,0x00,0x8f,0xf8,0x00,0x7f,
-0xf8,0x22,0x05,0xf0,0x08,0x00,0x4f,0xf5,0x00,0x7f,0xf3,0x00,0x1f,0xfa,0x0d,0xfb,
-0x00,0x8f,0xf1,0x05,0xff,0x41,0xff,0x80,0x00,0xcf,0xc9,0xfe,0x4d,0x05,0xb0,0xf6,
-0x00,0x00,0x0a,0xff,0xd0,0x00,0x00,0x0b,0xff,0xe0,0xe9,0x02,0xf0,0x1f,0xf7,0x00,
-0x00,0xdf,0xb8,0xff,0x10,0x06,0xff,0x31,0xff,0x90,0x0e,0xfa,0x00,0x8f,0xf2,0x8f,
-0xf2,0x00,0x0e,0xfb,0xbf,0xc0,0x00,0x0e,0xfa,0x4f,0xf3,0x00,0x5f,0xf2,0x0c,0xfa,
-0x00,0xcf,0xa0,0x04,0xff,0x23,0xff,0x20,0x00,0xcf,0x8a,0xfa,0x32,0x00,0x10,0xf3,
-0xf5,0x07,0x10,0xb0,0xdd,0x09,0x10,0x30,0x3b,0x01,0x1b,0x20,0x05,0x00,0x00,0xd9,
-0x08,0x30,0xff,0xf1,0x6f,0x7a,0x06,0x00,0x59,0x07,0xa0,0x60,0x00,0x00,0x0c,0xfb,
-0x00,0x00,0x00,0x7f,0xf2,0x0e,0x00,0x00,0x08,0x08,0x00,0x7d,0x07,0x60,0x6f,0xf2,
-0x00,0x00,0x01,0xff,0xfd,0x07,0x10,0xfd,0x53,0x05,0x00,0x05,0x0b,0x10,0x6f,0x05,
-0x00,0xaf,0x0d,0xdd,0x41,0xff,0xf5,0x1f,0xf3,0x01,0xff,0x30,0x05,0x00,0x0a,0xf2,
-0x03,0xd4,0x1f,0xff,0x50,0xdf,0x70,0x00,0x00,0x7f,0xd0,0x00,0x00,0x1f,0xf3,0x00,
-0x00,0x0b,0xf9,0x5b,0x07,0x01,0xca,0x02,0x00,0x1e,0x08,0x00,0x20,0x03,0x20,0x0e,
-0xf6,0xa4,0x06,0x03,0xdd,0x07,0xbf,0xcf,0x80,0x00,0x00,0x6f,0xd0,0xbd,0xd6,0xef,
-0xf7,0x0c,0x02,0x00,0x06,0xf0,0x25,0xbf,0xf7,0xef,0xf7,0x00,0x8f,0x80,0x00,0x0e,
-0xfe,0x00,0x04,0xfc,0xf4,0x00,0xaf,0x2f,0xa0,0x1f,0xa0,0xaf,0x17,0xf5,0x04,0xf7,
-0xdd,0xdd,0xdd,0xd1,0xff,0xff,0xff,0xf2,0x38,0x80,0x00,0xbf,0x80,0x00,0xdf,0x20,
-0x01,0x9e,0xfc,0x50,0x00,0xcf,0xed,0xff,0x40,0x3f,0xf1,0x7a,0x00,0xf3,0x0d,0x01,
-0x9f,0xb0,0x04,0xcf,0xff,0xfb,0x02,0xff,0x74,0xaf,0xb0,0x6f,0xd0,0x0a,0xfb,0x03,
-0xff,0xee,0xff,0xb0,0x05,0xdf,0xb7,0xfe,0x00,0x2f,0xf2,0x7f,0x00,0x02,0x09,0x00,
-0xf0,0x08,0x7d,0xfb,0x10,0x2f,0xff,0xff,0xfc,0x02,0xff,0x60,0x4f,0xf3,0x2f,0xf2,
-0x00,0xdf,0x52,0xff,0x20,0x0c,0xf7,0x2f,0xf2,0x4b,0x08,0x32,0x60,0x3f,0xf3,0x1b,
-0x00,0xf0,0x06,0x6e,0xfb,0x10,0x00,0x8e,0xfd,0x50,0x0a,0xff,0xff,0xf5,0x2f,0xf4,
-0x08,0xfc,0x6f,0xd0,0x01,0x65,0x7f,0xc0,0xbc,0x00,0xe9,0x00,0x22,0x2f,0xf4,0x07,
-0xfc,0x0a,0xff,0xef,0xf6,0x00,0x8e,0xfd,0x60,0x58,0x00,0x50,0x20,0x1a,0xfd,0x7f,
-0xf2,0x02,0x07,0xf0,0x0b,0x22,0xff,0x50,0x7f,0xf2,0x5f,0xe0,0x02,0xff,0x27,0xfc,
-0x00,0x2f,0xf2,0x5f,0xd0,0x02,0xff,0x22,0xff,0x30,0x5f,0xf2,0x0b,0xff,0xdf,0x24,
-0x00,0xf0,0x05,0x6f,0xf2,0x00,0x6d,0xfd,0x70,0x00,0x8f,0xff,0xff,0x70,0x1f,0xf5,
-0x04,0xff,0x05,0xff,0x99,0x9f,0xf2,0x76,0x01,0x20,0x35,0xff,0xee,0x0b,0x30,0xf9,
-0x00,0x85,0x1b,0x00,0xfe,0x09,0xd0,0x00,0x6d,0xfe,0xa1,0x00,0x00,0x6d,0xfa,0x04,
-0xff,0xfa,0x07,0xfd,0x00,0xcf,0xff,0xf7,0x8d,0xfe,0xb5,0x08,0xfc,0x00,0x03,0x00,
-0xf2,0x06,0x00,0xaf,0xe7,0xdf,0x40,0xaf,0xff,0xff,0xf4,0x2f,0xf6,0x04,0xff,0x45,
-0xfe,0x00,0x0f,0xf4,0x6f,0xd0,0x00,0x09,0x00,0x00,0x12,0x00,0x01,0x1b,0x00,0xf0,
-0x05,0x00,0x9f,0xe7,0xff,0x30,0x15,0x00,0x6f,0xf1,0x0b,0xff,0xef,0xf9,0x00,0x1a,
-0xef,0xd7,0x00,0x3f,0xf1,0x74,0x06,0x23,0x10,0x00,0x09,0x00,0xf0,0x06,0x5d,0xfb,
-0x20,0x3f,0xff,0xff,0xfb,0x03,0xff,0x50,0x6f,0xf0,0x3f,0xf1,0x02,0xff,0x13,0xff,
-0x10,0x2f,0xf2,0x09,0x00,0x19,0x23,0x09,0x00,0x8c,0x0c,0xe2,0x1f,0xf4,0x04,0x50,
-0x0f,0xf4,0x02,0x00,0x70,0x00,0xde,0x20,0x1f,0xf4,0x00,0x45,0xfa,0x0a,0x2d,0xff,
-0x40,0x05,0x00,0x7c,0x02,0xff,0x3b,0xff,0xe0,0xaf,0xc3,0x87,0x01,0xf0,0x02,0x20,
-0xaf,0xe1,0x2f,0xf2,0x7f,0xf3,0x02,0xff,0x6f,0xf6,0x00,0x2f,0xff,0xfa,0x00,0x02,
-0xf6,0x00,0xfe,0x03,0x2f,0xfc,0xef,0x70,0x02,0xff,0x26,0xff,0x20,0x2f,0xf2,0x0c,
-0xfc,0x02,0xff,0x20,0x3f,0xf6,0x6e,0x00,0x02,0x02,0x00,0xff,0x12,0x2f,0xf4,0xdf,
-0xc2,0x6e,0xfb,0x12,0xff,0xff,0xff,0xef,0xff,0xfa,0x2f,0xf6,0x06,0xff,0x50,0x8f,
-0xe2,0xff,0x20,0x3f,0xf0,0x04,0xff,0x2f,0xf2,0x03,0xff,0x00,0x4f,0xf2,0x0d,0x00,
-0x06,0x10,0xf0,0x3b,0x00,0x10,0x02,0x13,0x05,0x00,0x37,0x00,0xa0,0x02,0xff,0x10,
-0x2f,0xf1,0x2f,0xf1,0x02,0xff,0x22,0xe2,0x00,0x09,0x09,0x00,0x50,0x20,0x00,0x7d,
-0xfd,0x70,0x80,0x06,0xf0,0x0a,0x90,0x2f,0xf6,0x05,0xff,0x26,0xfe,0x00,0x0d,0xf6,
-0x7f,0xc0,0x00,0xcf,0x86,0xfe,0x00,0x0d,0xf7,0x2f,0xf5,0x05,0xff,0x30,0x9f,0x5f,
-0x06,0xf0,0x10,0x7d,0xfe,0x80,0x00,0x2f,0xf7,0xdf,0xb1,0x02,0xff,0xfd,0xff,0xb0,
-0x2f,0xf4,0x03,0xff,0x32,0xff,0x20,0x0d,0xf5,0x2f,0xf2,0x00,0xcf,0x72,0xff,0x20,
-0x0e,0xf5,0x3b,0x00,0x10,0x22,0xa4,0x04,0x48,0x2f,0xf7,0xdf,0xa1,0xff,0x00,0xf0,
-0x01,0x00,0x00,0x01,0xaf,0xe6,0xef,0x20,0xbf,0xff,0xff,0xf2,0x3f,0xf5,0x06,0xff,
-0x25,0xa8,0x02,0x32,0x7f,0xc0,0x02,0x09,0x00,0x41,0x2f,0xf5,0x06,0xff,0x1b,0x00,
-0x39,0x01,0xaf,0xd7,0x34,0x00,0x21,0x2f,0xf2,0xf2,0x0b,0xab,0xea,0x2f,0xff,0xfa,
-0x2f,0xfa,0x31,0x2f,0xf2,0x00,0x03,0x00,0xf0,0x17,0x02,0xae,0xfc,0x40,0x0d,0xfd,
-0xcf,0xf3,0x3f,0xf0,0x0a,0xd7,0x1f,0xfa,0x51,0x00,0x05,0xef,0xff,0x90,0x00,0x04,
-0x8f,0xf7,0x7f,0xb0,0x0a,0xf9,0x2f,0xfc,0xbf,0xf4,0x03,0xbf,0xfc,0x50,0x0b,0xf9,
-0xab,0x03,0x62,0xef,0xff,0xf0,0xae,0xfe,0xb0,0x0c,0x00,0x02,0x03,0x00,0x9e,0x0a,
-0xfa,0x00,0x07,0xff,0xf1,0x01,0xbf,0xe1,0xfa,0x01,0x14,0x3f,0x18,0x01,0xf0,0x01,
-0x1f,0xf4,0x06,0xff,0x20,0xdf,0xff,0xff,0xf2,0x02,0xcf,0xd6,0xff,0x20,0xbf,0x90,
-0x1c,0x03,0xf0,0x36,0x0c,0xf7,0x1f,0xf1,0x1f,0xf2,0x0c,0xf6,0x5f,0xd0,0x07,0xfa,
-0x9f,0x80,0x02,0xfe,0xdf,0x30,0x00,0xdf,0xfe,0x00,0x00,0x8f,0xf9,0x00,0x00,0x3f,
-0xf4,0x00,0xaf,0x70,0x1f,0xd0,0x0c,0xf6,0x6f,0xb0,0x5f,0xf1,0x0f,0xf2,0x2f,0xe0,
-0xaf,0xf5,0x2f,0xe0,0x0e,0xf1,0xee,0xfa,0x5f,0xa0,0x0b,0xf6,0xf8,0xce,0x8f,0x60,
-0x07,0xfe,0xf3,0x8f,0xef,0x30,0x03,0xff,0xf0,0x60,0x0a,0x40,0xff,0xa0,0x0f,0xfb,
-0xe2,0x0d,0xf0,0x3e,0x0a,0xf7,0x00,0x7f,0xe0,0x0c,0xfa,0x00,0xef,0x74,0xff,0x20,
-0x05,0xff,0xdf,0x80,0x00,0x0d,0xff,0xe1,0x00,0x00,0x7f,0xfa,0x00,0x00,0x0e,0xff,
-0xf2,0x00,0x07,0xfe,0xbf,0xa0,0x01,0xff,0x63,0xff,0x30,0x8f,0xd0,0x0a,0xfc,0x00,
-0xcf,0x90,0x08,0xfd,0x07,0xfe,0x00,0xdf,0x70,0x1f,0xf2,0x1f,0xf2,0x00,0xcf,0x76,
-0xfc,0x00,0x06,0xfb,0xaf,0x70,0x00,0x1f,0xff,0xf2,0x00,0x00,0xbf,0xfc,0x00,0x00,
-0x06,0xfc,0x04,0xf1,0x00,0x1f,0xf1,0x00,0x00,0x08,0xfb,0x00,0x00,0x1f,0xff,0x50,
-0x00,0x01,0xee,0x70,0x5b,0x08,0x30,0xf7,0x4e,0xee,0xce,0x0a,0x60,0xdf,0xb0,0x00,
-0x08,0xfe,0x10,0xad,0x05,0x60,0x01,0xef,0x90,0x00,0x0a,0xfd,0x1c,0x00,0x30,0xee,
-0xe8,0x6f,0xbe,0x06,0xd0,0x05,0x80,0x00,0x7f,0xc0,0x00,0xff,0x10,0x02,0xfd,0x00,
-0x03,0xfc,0x03,0x00,0x20,0x06,0xfa,0xcf,0x05,0x83,0xaf,0xc0,0x00,0x09,0xf8,0x00,
-0x04,0xfc,0x15,0x00,0xd9,0x01,0xff,0x00,0x00,0xaf,0x90,0x00,0x0a,0xc0,0x00,0x00,
-0x00,0xab,0x01,0x00,0xf0,0x03,0x01,0x57,0x00,0x07,0xfb,0x00,0x0c,0xf4,0x00,0x8f,
-0x70,0x08,0xf8,0x00,0x8f,0x80,0x05,0xfb,0x85,0x05,0x50,0x8f,0xe0,0x4f,0xd1,0x07,
-0x0f,0x00,0x90,0x08,0xf7,0x00,0xaf,0x50,0x4f,0xe0,0x08,0xc2,0xf3,0x07,0xf0,0x05,
-0x01,0xae,0xa0,0x01,0x94,0x0a,0xff,0xfc,0x27,0xf6,0x0f,0xd1,0x8f,0xff,0xf1,0x1a,
-0x50,0x07,0xed,0x40,0x68,0x0c,0x02,0x72,0x0c,0x22,0x0e,0xe2,0x07,0x00,0xf1,0x03,
-0xfe,0x30,0x00,0x16,0x77,0x77,0x7f,0x7c,0xe3,0x00,0x6f,0xee,0xee,0xee,0x40,0xbf,
-0x30,0x7e,0x9f,0x0c,0x21,0xf4,0x7e,0x43,0x00,0x11,0xfc,0x07,0x00,0x20,0x1c,0xe2,
-0x4e,0x04,0x92,0x41,0xce,0x20,0x05,0x55,0x55,0x5f,0x8d,0xe2,0x38,0x00,0x11,0x20,
-0x07,0x00,0x12,0xd1,0xe2,0x0c,0x01,0xe5,0x0b,0x21,0x05,0xb0,0x0d,0x00,0x21,0x4f,
-0xf0,0xcf,0x0c,0x11,0xfc,0x07,0x00,0xe1,0x3f,0x95,0xfe,0xee,0xee,0xea,0x02,0xea,
-0x00,0x67,0x77,0x77,0xae,0x1e,0x21,0x00,0x31,0x7e,0x4f,0x60,0x07,0x00,0x21,0x08,
-0xf4,0x07,0x00,0x40,0x00,0x9f,0x33,0xff,0xe9,0x09,0xa2,0x0a,0xe8,0xf5,0x55,0x55,
-0x52,0x00,0x00,0xaf,0xf0,0x21,0x0d,0x12,0xf0,0x17,0x0d,0x21,0x30,0x00,0x89,0x00,
-0x01,0x6e,0x00,0x20,0x3e,0xe3,0x6c,0x00,0x30,0xeb,0xbe,0x30,0xaf,0x0c,0x40,0x0b,
-0xf3,0x00,0x03,0xdb,0x01,0xff,0x0a,0x30,0x3f,0xb0,0x00,0x00,0x0b,0xf3,0xef,0xff,
-0x30,0x03,0xff,0xfe,0x35,0x5f,0x50,0x05,0xf5,0x53,0x00,0x0f,0x50,0x05,0xf0,0x00,
-0x06,0x00,0x01,0x70,0x85,0x58,0xf0,0x00,0x00,0x0d,0xff,0x27,0x07,0x30,0x03,0x55,
-0x55,0x3c,0x10,0x2e,0xff,0xff,0x2a,0x00,0x0a,0x06,0x00,0xc0,0xce,0xef,0x50,0x05,
-0xfe,0xec,0xaf,0xb6,0x00,0x00,0x6b,0xfa,0x11,0x10,0x70,0x4f,0xb0,0x00,0xbf,0x40,
-0x04,0xfb,0x75,0x00,0x00,0x7b,0x00,0x00,0xa0,0x07,0x00,0xb0,0x00,0x17,0xb0,0xa1,
-0x27,0x12,0x11,0x07,0x00,0x12,0x88,0xbc,0x00,0x00,0x15,0x05,0x00,0xe9,0x0c,0x20,
-0x90,0x00,0x69,0x03,0x20,0xcc,0xf2,0x07,0x00,0x30,0xaf,0x44,0xfa,0x0f,0x0d,0x40,
-0xfb,0x00,0xbf,0x20,0x49,0x00,0x10,0x00,0x4a,0x00,0x20,0x3f,0xa0,0x0b,0x11,0x30,
-0x00,0xbf,0x20,0x18,0x00,0x11,0x04,0x46,0x0f,0xb0,0x40,0x0c,0xfe,0xdd,0xdd,0xdd,
-0xef,0xc0,0x5f,0xff,0xff,0xc3,0x0a,0x01,0x4f,0x00,0x02,0x51,0x0d,0x10,0x9f,0x59,
-0x0d,0xf0,0x3c,0x02,0x26,0xf7,0x4d,0xb0,0x00,0x04,0xdf,0xbb,0xd0,0x07,0xf0,0x00,
-0x6f,0xc4,0x0d,0xf5,0x2c,0xd0,0x02,0xfa,0x00,0x0f,0xff,0xfe,0x30,0x0a,0xe0,0x00,
-0x3f,0xff,0xc6,0x60,0x0e,0x80,0x00,0x6f,0xf8,0x08,0xe0,0x0f,0x60,0x00,0x9e,0x40,
-0x06,0xf0,0x0e,0x80,0x00,0x71,0x00,0x08,0xe0,0x0a,0xd0,0x00,0x00,0x00,0x0d,0xa0,
-0x03,0xf8,0x00,0x00,0x00,0x8f,0x30,0x00,0x7f,0xa3,0x00,0x3a,0xf7,0x00,0xd7,0x03,
-0x20,0xfe,0x50,0xb9,0x01,0x20,0x66,0x40,0x66,0x00,0xf0,0x14,0x66,0x66,0x63,0x00,
-0x00,0x00,0x20,0xcf,0xff,0xf2,0x50,0x00,0x03,0xf8,0x1e,0xff,0x65,0xf9,0x00,0x16,
-0xb8,0x03,0xfb,0x02,0xa7,0x70,0x6f,0xa0,0x00,0x51,0x00,0x3f,0xb0,0x49,0x30,0x5b,
-0x11,0x30,0x93,0xef,0x20,0x5e,0x0a,0x30,0xf6,0x49,0x10,0x0e,0x00,0x31,0x71,0xaf,
-0x60,0x3d,0x02,0xf0,0x0b,0x36,0xa1,0x00,0x00,0x00,0x6b,0x30,0x0a,0xf8,0x20,0x00,
-0x06,0x8f,0x50,0x01,0x4c,0xe7,0x68,0x8f,0xb1,0x00,0x00,0x0a,0x6e,0xac,0xc6,0x62,
-0x00,0x36,0x06,0x44,0x40,0x2b,0x01,0xf0,0x1c,0x8e,0x34,0x78,0x61,0x00,0x00,0x07,
-0xfd,0xff,0xfe,0xff,0x91,0x00,0x6f,0x70,0xbf,0x40,0x06,0xed,0x10,0x8f,0x50,0x0a,
-0xf5,0x00,0x2e,0xb0,0x0d,0xf6,0x00,0xed,0x00,0x03,0xf4,0x1f,0xcf,0x7a,0xf4,0x00,
-0x00,0xd9,0x3f,0x37,0x5a,0x09,0x40,0xab,0x3f,0x20,0x53,0x16,0x03,0x20,0x1f,0x50,
-0x3d,0x00,0x30,0xd8,0x0b,0xc0,0xb2,0x00,0x20,0xf3,0x02,0xcb,0x00,0xf0,0x00,0x2e,
-0xa0,0x00,0x6f,0xb4,0x00,0x17,0xfc,0x10,0x00,0x03,0xcf,0xff,0xff,0x80,0x5f,0x01,
-0x21,0x56,0x40,0x8e,0x01,0x10,0x10,0xf0,0x00,0x00,0x5f,0x0d,0xf0,0x00,0x00,0x2f,
-0xe9,0x99,0x9b,0xf4,0x00,0x7f,0x70,0x00,0x09,0xd0,0x00,0xcf,0x10,0x3a,0x12,0xf0,
-0x1f,0xfc,0x00,0x00,0x9f,0x10,0x00,0x9f,0x10,0x1c,0xd3,0x00,0x06,0xff,0x70,0xe9,
-0x00,0x00,0x3f,0x8c,0x75,0xf9,0x00,0x00,0xbc,0x0e,0x2c,0xaf,0x00,0x00,0xd9,0x2d,
-0x1a,0x3f,0x20,0x00,0xbc,0x01,0x00,0x6f,0x00,0x00,0x4f,0x80,0x04,0xe9,0x00,0xc1,
-0x0a,0x00,0xe9,0x01,0x31,0x27,0x74,0x00,0xc6,0x01,0x21,0xff,0xa0,0x06,0x00,0x90,
-0xb1,0x10,0x1f,0xee,0xed,0xdd,0xdd,0xf2,0x1d,0x15,0x00,0xd1,0xb2,0x1d,0x01,0x77,
-0x77,0x60,0xb2,0x1d,0x03,0xff,0xff,0xe0,0xb3,0x12,0x00,0x11,0xb3,0x12,0x00,0x12,
-0xb3,0x12,0x00,0x11,0x1e,0x12,0x00,0xc4,0x0e,0x11,0x11,0x11,0x11,0xb3,0x0d,0xdd,
-0xff,0xff,0xec,0xc2,0x48,0x00,0x31,0x7b,0xbb,0x70,0x47,0x03,0x40,0xbd,0xdb,0x50,
-0x07,0x16,0x0b,0xd0,0xff,0xf0,0x0f,0xd3,0x2f,0xfa,0x30,0x03,0x20,0x0e,0x4d,0xef,
-0x80,0x6d,0x03,0x31,0x00,0x8f,0x40,0x07,0x00,0x21,0x03,0xd9,0x07,0x00,0x30,0x00,
-0x1e,0x90,0x07,0x00,0x21,0x02,0xd7,0x0e,0x00,0x11,0x5d,0x1c,0x00,0x20,0x08,0xfd,
-0x43,0x00,0x50,0x0f,0xca,0xaf,0xa0,0x00,0x15,0x13,0x60,0x0d,0xfd,0x63,0x37,0x60,
-0x03,0x61,0x00,0x01,0x92,0x0a,0xf1,0x1a,0x02,0x7a,0xa7,0x10,0xbd,0xef,0xfd,0xdd,
-0xdd,0xf1,0xc2,0x6f,0xe0,0x00,0x11,0xc2,0xc2,0x39,0x80,0x1a,0xff,0xf2,0xc2,0x16,
-0x52,0xef,0xff,0xf2,0xc2,0x6f,0xf0,0x19,0xff,0xf2,0xc2,0x5f,0xe0,0x00,0x11,0xb2,
-0xc2,0xc8,0x00,0x30,0xc2,0x5f,0xe0,0x06,0x00,0x20,0x6f,0xf0,0x06,0x00,0x20,0x15,
-0x40,0x06,0x00,0x21,0x4f,0xe0,0x18,0x00,0x00,0x12,0x00,0x70,0xcc,0xdf,0xfc,0xcc,
-0xcc,0xf1,0x01,0xc8,0x00,0x00,0x60,0x01,0x11,0x22,0x08,0x04,0xf0,0x36,0xbf,0xff,
-0xfa,0x20,0x00,0x00,0x7f,0xea,0xce,0x8d,0xf5,0x00,0x06,0xf9,0x03,0xbd,0x10,0xaf,
-0x30,0x1f,0xa0,0x04,0xbd,0x10,0x0c,0xd0,0x7f,0x10,0x04,0xce,0x10,0x03,0xf3,0xab,
-0x00,0x02,0xcc,0x00,0x00,0xe7,0xba,0x00,0x36,0x00,0xb9,0x00,0xc8,0xab,0x05,0xeb,
-0x76,0xc8,0xd3,0xe7,0x7f,0x8e,0x5c,0x61,0xbb,0x5d,0xf4,0x1f,0xd4,0xd5,0x00,0x05,
-0xdc,0xd0,0x06,0x7f,0x0a,0x81,0x9f,0x30,0x00,0x7f,0xc6,0x33,0x6d,0xf4,0x54,0x00,
-0x11,0xf9,0xfe,0x03,0x16,0x22,0x09,0x04,0x40,0x01,0xaf,0xfe,0x60,0x31,0x15,0x30,
-0xd4,0x28,0xf5,0x64,0x04,0xf0,0x16,0x20,0x00,0x9c,0x00,0x32,0x00,0x5f,0x00,0x00,
-0x6e,0x3e,0xff,0x90,0x3f,0x30,0x00,0xac,0xdf,0xff,0xf4,0x0c,0xe5,0x28,0xf5,0xff,
-0xff,0xf8,0x00,0xaf,0xff,0xd3,0xdf,0xff,0xf5,0x00,0xce,0xa9,0x31,0x07,0x40,0x0a,
-0xd1,0x1d,0xff,0x25,0x09,0x20,0x40,0xbf,0xcb,0x0a,0x21,0x5e,0x05,0x55,0x03,0x30,
-0x7c,0x1b,0xff,0xb7,0x0c,0xa9,0x6f,0xff,0xdd,0xdd,0xdd,0xdd,0xd6,0x02,0x22,0x00,
-0x01,0x00,0x22,0x06,0x90,0xc5,0x03,0x12,0xda,0x0f,0x00,0x22,0x1c,0xb0,0x0f,0x00,
-0x90,0xcc,0x00,0x00,0x3c,0xbb,0xbb,0xba,0xbf,0xc1,0xe4,0x0a,0x00,0x57,0x0d,0x20,
-0x14,0x44,0x01,0x00,0x10,0x30,0x3c,0x0c,0x00,0x1f,0x09,0x92,0x3e,0xfd,0xde,0xee,
-0xef,0xf4,0x00,0x02,0xea,0x37,0x00,0x22,0x1d,0xa0,0x37,0x00,0x13,0xdb,0x46,0x00,
-0x05,0x08,0x12,0x07,0x69,0x00,0x22,0xee,0xb6,0x09,0x00,0x21,0x49,0xe8,0x0e,0x00,
-0x30,0xa4,0x19,0xd2,0x32,0x00,0x30,0x5b,0xd3,0x30,0xd8,0x12,0x21,0x60,0x45,0x55,
-0x05,0x10,0xbc,0xf3,0x0f,0x30,0xa8,0x9c,0x71,0x07,0x05,0xf0,0x10,0x00,0x01,0xcd,
-0x10,0x00,0x1e,0xf2,0x5f,0xd0,0x3f,0xc0,0x00,0x5f,0xf0,0xbf,0xf3,0x1f,0xf1,0x00,
-0x0d,0xf3,0x4e,0xb0,0x4f,0xa0,0x00,0x02,0xdd,0x10,0x02,0xdc,0x90,0x03,0x91,0xcb,
-0xab,0x60,0x00,0x00,0x01,0x33,0x33,0x32,0xe9,0x04,0xf0,0x0d,0xff,0x70,0x00,0x1f,
-0x63,0x33,0xc8,0xf7,0x00,0x1f,0x40,0x00,0xe0,0x6f,0x70,0x1f,0x40,0x00,0xed,0xd7,
-0xf1,0x1f,0x40,0x00,0x01,0x13,0xf1,0x1f,0x7c,0x0d,0x0f,0x06,0x00,0x0d,0x72,0x74,
-0x44,0x44,0x47,0xf1,0x0e,0xff,0x01,0x0c,0x02,0xf8,0x05,0x20,0xbd,0xb4,0x07,0x00,
-0xf0,0x38,0x4d,0x41,0x3c,0x61,0x00,0x00,0x00,0xe2,0x00,0x01,0xed,0xe9,0x00,0x03,
-0xc0,0x00,0x00,0x10,0x0a,0x70,0x05,0xc0,0x00,0x00,0x01,0x01,0xe0,0x1e,0x30,0x02,
-0x69,0xdf,0x40,0xe0,0x88,0x09,0xef,0xfb,0x84,0x02,0xd0,0xc2,0x08,0x73,0x65,0x00,
-0x02,0xe2,0xc2,0x00,0x01,0xee,0x10,0x00,0x5a,0x95,0x00,0x0a,0xff,0x90,0x00,0x2c,
-0x3d,0x00,0x17,0x88,0x70,0x00,0x4a,0x08,0xd3,0xa1,0x02,0x87,0xd3,0x00,0x4c,0xed,
-0xde,0xee,0xed,0x40,0x19,0x01,0x22,0x02,0x10,0x57,0x06,0x13,0x60,0x07,0x00,0x11,
-0xb4,0x07,0x00,0xf0,0x15,0x64,0xf2,0x00,0x02,0x64,0x04,0xff,0xf6,0x80,0x00,0x6f,
-0xef,0x7e,0xa2,0x9e,0x00,0x01,0xf8,0x01,0x3f,0x50,0x4f,0x10,0x06,0xe0,0x00,0x0c,
-0xd7,0xdd,0x00,0x0b,0x90,0x00,0x01,0xcf,0xc2,0x13,0x17,0x00,0x38,0x00,0x21,0x1f,
-0x20,0x07,0x00,0x12,0x3f,0x46,0x00,0x12,0x4f,0x07,0x00,0x16,0x6d,0x54,0x00,0x00,
-0xca,0x00,0xb1,0xde,0x60,0x0e,0x85,0xf1,0x0e,0x52,0xf1,0x06,0xff,0x90,0xbf,0x05,
-0x80,0x6f,0xe4,0xef,0xfb,0xdf,0xfb,0x5e,0xd3,0x1d,0x00,0x50,0x1e,0x82,0x00,0x00,
-0x0f,0xb9,0x12,0xf1,0x02,0x5a,0xef,0xf8,0x00,0x01,0x7e,0xfc,0x07,0xcf,0xfe,0x92,
-0x1f,0xfb,0x50,0x00,0x08,0x20,0x58,0x01,0xf0,0x05,0xfb,0x0c,0xcc,0xcc,0xc8,0x03,
-0x90,0x00,0x1f,0xfb,0x00,0x06,0xff,0xb0,0x00,0x5f,0xf8,0x00,0x07,0xb0,0xad,0x01,
-0xe5,0xde,0x90,0x1f,0x75,0xd8,0x5e,0x00,0x7b,0x2f,0x74,0xd8,0x05,0xde,0x90,0xd0,
-0x00,0x20,0x4f,0xb0,0x70,0x00,0x71,0x21,0x6f,0x93,0x45,0x8b,0x00,0x0f,0x2f,0x02,
-0x80,0x00,0x08,0xaa,0xdf,0xa8,0x76,0x31,0x00,0x48,0x16,0x20,0x4f,0xa0,0x4e,0x15,
-0xf2,0x2f,0xef,0xff,0xe6,0x00,0x00,0x3d,0xff,0xb9,0xff,0xef,0xb0,0x03,0xff,0xef,
-0x05,0xfa,0x1c,0xf5,0x0d,0xf5,0xaf,0x3e,0xf1,0x06,0xfa,0x5f,0x80,0x9f,0xef,0x70,
-0x05,0xfa,0x9f,0x40,0x9f,0xf8,0x00,0x0d,0xf7,0x8f,0xef,0xff,0xc0,0x04,0xdf,0xd0,
-0x1d,0xff,0xaf,0xb5,0xff,0xfc,0x20,0x00,0x10,0x00,0x00,0xba,0x50,0x00,0x18,0x81,
-0x37,0x01,0x30,0xff,0x00,0x00,0xf5,0x0c,0x21,0x1f,0xf0,0xbe,0x0d,0x20,0x01,0xff,
-0xbc,0x0f,0x11,0xf9,0x0f,0x00,0x00,0xa3,0x07,0x01,0x95,0x06,0x60,0xef,0x40,0x0e,
-0xf3,0x00,0x20,0x17,0x00,0xb0,0xbf,0x50,0x0d,0x40,0x00,0x6f,0xc0,0x08,0xfa,0x03,
-0xfe,0x58,0x16,0xb1,0x3f,0xf8,0xdf,0x90,0x00,0x17,0x10,0x00,0xbf,0xff,0xf1,0xb8,
-0x02,0x22,0xbf,0xe4,0xbc,0x00,0x13,0x10,0xc4,0x00,0x20,0xa7,0x53,0x88,0x03,0x00,
-0xf2,0x0a,0x00,0x42,0x01,0x33,0x24,0x68,0xab,0xa7,0x07,0x90,0x00,0x00,0x02,0xbb,
-0xbc,0xde,0xff,0x70,0x00,0xb2,0x13,0x00,0x84,0x05,0x51,0x64,0x21,0x4f,0xf6,0x00,
-0x8e,0x12,0x11,0x40,0xc2,0x07,0x20,0xfd,0x30,0x38,0x00,0x11,0xef,0x8e,0x04,0x40,
-0x2e,0xf8,0x1e,0xf4,0x0d,0x00,0xf5,0x04,0x90,0x08,0xfb,0x22,0x43,0x1e,0xfc,0x00,
-0x03,0xff,0xff,0xf9,0x04,0xc1,0x00,0x00,0x6b,0xdd,0xc6,0xfc,0x01,0x12,0xfe,0x08,
-0x00,0x21,0x1f,0xd0,0x45,0x00,0x60,0x23,0xfd,0x7b,0xa0,0xe9,0x10,0x64,0x03,0xf0,
-0x0b,0xfb,0x2d,0xff,0x70,0x2a,0xbc,0xfd,0x64,0x10,0x06,0xff,0x10,0x00,0x2f,0xb0,
-0x00,0x00,0x01,0x50,0x00,0x02,0xfe,0xac,0xed,0xa2,0x00,0xfe,0x05,0xf0,0x00,0xfd,
-0xff,0xf3,0x00,0x06,0xff,0xfc,0x10,0x00,0x7f,0xc0,0x04,0xfe,0x5f,0xc0,0x51,0x09,
-0xf0,0x0e,0xaf,0x60,0xfc,0x00,0x00,0x5f,0xe0,0x08,0xfc,0x7f,0xc0,0x45,0xaf,0xf8,
-0x00,0x1c,0xff,0xfa,0x0e,0xff,0xfa,0x00,0x00,0x07,0xcc,0x20,0x7a,0x83,0x00,0x20,
-0x06,0x13,0xb3,0x6a,0x00,0x12,0xf2,0x08,0x00,0xd2,0x3f,0xf0,0x00,0x08,0xf3,0x00,
-0x06,0x66,0xaf,0xfb,0xb7,0x08,0xfc,0xa8,0x01,0xb0,0x80,0xef,0x40,0x0a,0x97,0xef,
-0x51,0x6f,0xd0,0x8f,0xb0,0x52,0x00,0xc0,0x0f,0xf0,0x1f,0xf2,0x00,0x05,0xfb,0x00,
-0x0f,0xe0,0x0c,0xf7,0x40,0x18,0x40,0x1f,0xd0,0x05,0x60,0x17,0x0a,0x20,0x3f,0xc0,
-0x79,0x01,0x40,0xb0,0x00,0x7f,0x90,0xfc,0x07,0xb0,0x45,0x44,0xef,0x50,0x00,0x00,
-0x09,0xfd,0x09,0xff,0xfe,0xd0,0x00,0x4d,0x94,0x04,0xab,0x82,0xfb,0x03,0xa1,0x18,
-0xa0,0x00,0x00,0x1d,0xb2,0x00,0x08,0xe5,0xf5,0x78,0x00,0x71,0x01,0xf8,0x73,0x00,
-0x00,0x4f,0xd0,0x80,0x00,0x80,0x67,0xbf,0xeb,0xa6,0x0a,0xfa,0x00,0x1f,0x80,0x00,
-0xb0,0x62,0xff,0x20,0x0b,0x96,0xff,0x31,0x7f,0xb0,0xaf,0x90,0x19,0x01,0xc0,0x2f,
-0xd0,0x4f,0xf0,0x00,0x07,0xf9,0x00,0x2f,0xc0,0x0e,0xf5,0x13,0x0a,0xa0,0x3f,0xb0,
-0x08,0x60,0x00,0x2f,0xf0,0x00,0x5f,0xa0,0x1f,0x08,0x50,0x90,0x00,0x8f,0x70,0x00,
-0xdf,0x11,0xa0,0x34,0xef,0x30,0x00,0x00,0x0a,0xfc,0x0b,0xff,0xfd,0x94,0x02,0x41,
-0xb4,0x06,0xbc,0x92,0x74,0x00,0xe0,0x0a,0xd3,0x00,0x00,0x01,0x43,0x22,0xbf,0xb9,
-0xdb,0x00,0x2f,0xff,0xff,0x76,0x0c,0x42,0x88,0x99,0x8c,0xf7,0xfb,0x00,0x50,0xc6,
-0xad,0x04,0xff,0xee,0x64,0x12,0x43,0x3c,0xdd,0xdc,0xbc,0xe9,0x09,0xe0,0xf3,0x00,
-0x05,0x61,0x00,0x3c,0xef,0xb0,0x00,0xef,0x00,0x04,0xce,0xf9,0xbd,0x19,0x00,0xee,
-0x01,0x81,0xef,0xa3,0x22,0x34,0x50,0x00,0x06,0xff,0x4f,0x14,0x53,0x03,0x9b,0xdd,
-0xcb,0x70,0xd3,0x00,0xf0,0x03,0x84,0x00,0x00,0x00,0x8c,0x50,0x08,0xb9,0xe0,0x03,
-0x21,0x18,0xfc,0x8c,0x7f,0x5b,0x20,0xff,0xd7,0x14,0x73,0x62,0x00,0x08,0x9a,0xaa,
-0xcf,0xa1,0xdb,0x01,0xf2,0x01,0x48,0xc0,0x00,0x2e,0xdc,0xcc,0xdf,0xff,0xff,0x20,
-0x01,0xef,0xff,0xfe,0xdf,0xf4,0x3a,0x00,0x91,0xdf,0x50,0x00,0x00,0x34,0x10,0x01,
-0xac,0xfc,0x18,0x09,0x10,0x3e,0x66,0x18,0xc3,0xef,0x10,0x00,0x00,0x31,0x00,0x00,
-0x0c,0xf9,0x20,0x00,0x24,0x56,0x10,0x00,0x40,0x02,0x47,0x4a,0xdf,0xfe,0xda,0x46,
-0x01,0x20,0x0b,0x90,0x41,0x03,0xf0,0x03,0xf6,0x00,0x00,0x1b,0xff,0x70,0x00,0x02,
-0xdf,0xe4,0x00,0x00,0x4e,0xfc,0x10,0x00,0x05,0xff,0x54,0x18,0x10,0xfb,0xe2,0x01,
-0x70,0xfe,0x30,0x00,0x00,0x01,0xdf,0xf5,0x80,0x05,0x01,0x1f,0x08,0x21,0xaf,0xfa,
-0x97,0x09,0x10,0xc1,0xaf,0x01,0x10,0xfb,0xc6,0x08,0x02,0xcd,0x0a,0xa0,0x0d,0xc3,
-0x00,0x00,0x0e,0xf4,0x00,0x0f,0xf1,0x00,0x56,0x01,0x30,0x2f,0xe0,0x00,0x82,0x1a,
-0xa0,0x4f,0xc0,0x05,0x43,0x3c,0xf8,0x86,0x5f,0x90,0x0e,0x86,0x12,0x90,0x6f,0x80,
-0x09,0xbb,0xbe,0xfb,0x84,0x7f,0x70,0xed,0x08,0x31,0x00,0x8f,0x66,0xab,0x00,0xa0,
-0x7f,0xbf,0x20,0x00,0x0d,0xf2,0x00,0x6f,0xfd,0x00,0xd8,0x1a,0x20,0x4f,0xf8,0xdc,
-0x0f,0x00,0x7e,0x12,0xd2,0x03,0xff,0x60,0x00,0x0e,0xf2,0x00,0x7f,0xfc,0x00,0x00,
-0x04,0x40,0xfe,0x03,0x01,0x3c,0x01,0x80,0x00,0x01,0x53,0x33,0x33,0x45,0x30,0x04,
-0x1a,0x01,0x7e,0x90,0x03,0xcd,0xde,0xed,0xdc,0x70,0x16,0x06,0x03,0x30,0x06,0x11,
-0xa0,0x39,0x04,0x01,0x05,0x03,0x00,0x95,0x07,0x00,0xf8,0x17,0x61,0x75,0x56,0x78,
-0xb8,0x06,0xff,0x14,0x13,0x92,0x28,0xac,0xcc,0xba,0x73,0x00,0x00,0x06,0xc9,0x6a,
-0x03,0x91,0x10,0x12,0x45,0x43,0x34,0xdf,0xcd,0xfa,0x8f,0x1e,0x00,0x41,0x5a,0xab,
-0xba,0xae,0xd8,0x01,0x01,0x1d,0x19,0x00,0xf4,0x03,0xf1,0x05,0x01,0x00,0x00,0x39,
+0x28,0x29,0x2a,0xb8,0x12,0xf8,0xff,0xff,0xaa,0x0d,0x00,0x11,0x1d,0x1b,0x1d,0x1c,
+0x1d,0x1e,0x1d,0x32,0x1d,0x3e,0x1d,0x68,0x1d,0x97,0x1d,0xe7,0x1d,0xe9,0x1d,0x07,
+0x1e,0x0c,0x1e,0x5e,0x1e,0x5f,0x1e,0x64,0x1e,0x6d,0x1e,0x90,0x1e,0xee,0x1e,0xf2,
+0x1e,0xff,0x1e,0x1e,0x1f,0x35,0x1f,0x60,0x1f,0x6d,0x1f,0x85,0x1f,0xaa,0x1f,0xe0,
+0x1f,0x54,0x20,0x56,0x20,0x59,0x20,0x76,0x20,0x79,0x20,0x7d,0x20,0x82,0x20,0x88,
+0x20,0x96,0x20,0x97,0x20,0x9e,0x20,0x0b,0x21,0x17,0x21,0x2e,0x21,0x36,0x21,0x3a,
+0x21,0x4c,0x21,0x5b,0x21,0x5e,0x21,0x83,0x21,0xac,0x21,0xb0,0x21,0xb1,0x21,0xca,
+0x21,0xe6,0x21,0x27,0x22,0x69,0x22,0xcc,0x22,0xe8,0x22,0x04,0x23,0x08,0x23,0x19,
+0x23,0x1d,0x23,0x1e,0x23,0x22,0x23,0x37,0x23,0x3c,0x23,0x5b,0x23,0x79,0x23,0x60,
+0x24,0x79,0x25,0xef,0x25,0x03,0x26,0x0b,0x26,0x0e,0x26,0x38,0x26,0x39,0x26,0x58,
+0x26,0xdc,0x26,0x42,0x27,0x68,0x27,0xa8,0x27,0x01,0x28,0x1a,0x28,0x27,0x28,0x2b,
+0x28,0x38,0x28,0x3f,0x28,0x42,0x28,0x79,0x28,0x69,0x2a,0x9d,0x2a,0xab,0x2a,0xb0,
+0x2a,0xca,0x2a,0x0f,0x2b,0x20,0x2b,0x22,0x2b,0xf7,0x2c,0xff,0x2c,0x49,0x2d,0x84,
+0x2d,0xb7,0x2d,0xb8,0x2d,0x07,0x2e,0x20,0x2e,0x42,0x2e,0x46,0x2e,0x48,0x2e,0x64,
+0x2e,0x73,0x2e,0x82,0x2e,0x96,0x2e,0x9d,0x2e,0xba,0x2e,0xbf,0x2e,0xd6,0x2e,0xed,
+0x2e,0x36,0x2f,0xd6,0x2f,0x04,0x30,0x20,0x30,0x5c,0x30,0x21,0x31,0x5c,0x31,0xaf,
+0x31,0xcd,0x31,0xe3,0x31,0xf2,0x31,0x12,0x32,0x50,0x32,0xb6,0x32,0xb9,0x32,0xd4,
+0x32,0xec,0x32,0xde,0x33,0x68,0x34,0x81,0x34,0x98,0x34,0xc1,0x34,0xca,0x34,0xf3,
+0x34,0xf6,0x34,0x1f,0x35,0x53,0x35,0x80,0x35,0x05,0x36,0x09,0x36,0x11,0x36,0x1a,
+0x36,0x30,0x36,0x3b,0x36,0x3c,0x36,0x3d,0x36,0x72,0x36,0xb1,0x36,0x4d,0x37,0x2d,
+0x38,0x86,0x38,0x93,0x38,0xdc,0x38,0x2a,0x39,0x70,0x39,0x73,0x3a,0x74,0x3a,0x9c,
+0x3a,0xdf,0x3a,0xe5,0x3a,0x28,0x3b,0x71,0x3b,0xe6,0x3b,0xf3,0x3b,0x99,0x3c,0x2c,
+0x3d,0x3a,0x3d,0xa1,0x3d,0xa7,0x3d,0x25,0x3e,0x81,0x3e,0x32,0x40,0xc7,0x41,0x98,
+0x42,0x0f,0x43,0x17,0x43,0x30,0x44,0x39,0x44,0x4c,0x44,0x7b,0x44,0x8c,0x45,0x51,
+0x46,0xcb,0x47,0x4b,0x48,0xe3,0x48,0x01,0x49,0x0c,0x49,0x8b,0x49,0x92,0x49,0x00,
+0x4a,0x3d,0x4a,0x65,0x4a,0xa8,0x4a,0xb2,0x4a,0xd5,0x4a,0xcf,0x4b,0x31,0x4c,0x33,
+0x4c,0x41,0x4c,0x53,0x4c,0x5d,0x4c,0x82,0x4c,0xaa,0x4c,0xab,0x4c,0xdb,0x4c,0xe2,
+0x4c,0xeb,0x4c,0xf9,0x4c,0x7f,0x4e,0x83,0x4e,0x14,0x4f,0x16,0x4f,0xdd,0x4f,0x0e,
+0x50,0xfb,0x50,0x80,0x51,0x83,0x51,0x46,0x54,0x5d,0x57,0x6e,0x57,0x79,0x57,0x81,
+0x57,0xd6,0x57,0x0e,0x58,0x18,0x58,0x92,0x58,0x9c,0x58,0xa0,0x58,0xa7,0x58,0xf4,
+0x58,0x11,0x59,0x19,0x59,0x29,0x59,0x3e,0x59,0x4d,0x59,0x83,0x59,0x84,0x59,0x9e,
+0x59,0xaf,0x59,0xbd,0x59,0xbe,0x59,0xe7,0x59,0x69,0x5a,0x77,0x5a,0xcc,0x5b,0xcd,
+0x5b,0x75,0x5c,0x88,0x5c,0x96,0x5c,0xee,0x5c,0x09,0x5e,0x14,0x5e,0x2e,0x5e,0xcd,
+0x5e,0x0e,0x5f,0x12,0x5f,0x2b,0x5f,0x30,0x5f,0x56,0x5f,0x5f,0x5f,0x7a,0x5f,0x89,
+0x5f,0xf9,0x5f,0xe0,0x60,0x43,0x62,0x88,0x64,0x9c,0x64,0xa4,0x64,0x75,0x65,0xd7,
+0x65,0xf3,0x65,0x0c,0x66,0x63,0x66,0x6f,0x66,0x73,0x66,0xe4,0x66,0x04,0x67,0x17,
+0x67,0x5d,0x67,0xec,0x67,0xe9,0x69,0x12,0xbf,0x19,0xbf,0x1c,0xbf,0x1d,0xbf,0x1e,
+0xbf,0x22,0xbf,0x24,0xbf,0x26,0xbf,0x2a,0xbf,0x2d,0xbf,0x32,0xbf,0x37,0xbf,0x38,
+0xbf,0x39,0xbf,0x4f,0xbf,0x54,0xbf,0x59,0xbf,0x5c,0xbf,0x5d,0xbf,0x5e,0xbf,0x62,
+0xbf,0x63,0xbf,0x64,0xbf,0x65,0xbf,0x78,0xbf,0x79,0xbf,0x7f,0xbf,0x81,0xbf,0x82,
+0xbf,0x85,0xbf,0x88,0xbf,0x89,0xbf,0x8a,0xbf,0x8c,0xbf,0xa4,0xbf,0xa6,0xbf,0xd5,
+0xbf,0xd6,0xbf,0xd8,0xbf,0xda,0xbf,0xf1,0xbf,0xf8,0xbf,0xfb,0xbf,0x04,0xc0,0x2d,
+0xc0,0x35,0xc0,0x6c,0xc0,0xfc,0xc0,0x51,0xc1,0x52,0xc1,0x53,0xc1,0x54,0xc1,0x55,
+0xc1,0x98,0xc1,0xa4,0xc1,0xfe,0xc1,0x15,0xc2,0x6b,0xc4,0xd3,0xc6,0xb3,0xc7,0x00,
+0x01,0x00,0x2f,0xf9,0x00,0x01,0x00,0x56,0x13,0xfb,0x08,0x00,0x17,0xf1,0x14,0x00,
+0xbf,0xfa,0xf9,0x00,0xfe,0xf5,0x00,0xf5,0x00,0x00,0x00,0x01,0x85,0x00,0x53,0x4f,
+0x03,0x05,0x00,0x03,0x69,0x00,0x52,0x2f,0xdc,0x00,0x01,0x00,0x68,0x1f,0xe1,0x71,
+0x00,0x5d,0x03,0xd4,0x01,0xb2,0xf6,0x00,0xfd,0x00,0x00,0xf1,0xfe,0xf6,0xfb,0x00,
+0xed,0xdf,0x01,0x9f,0xff,0x00,0x00,0xfe,0xff,0xfa,0xfc,0x00,0x02,0x83,0x00,0x4f,
+0x3f,0xfd,0x00,0xfd,0xcf,0x02,0x57,0x15,0xfd,0x0a,0x00,0x12,0xfc,0x07,0x00,0x19,
+0xff,0x1f,0x00,0x1f,0xfe,0x69,0x01,0x4a,0x00,0x7d,0x00,0x10,0xf5,0xf0,0x00,0x2f,
+0xfb,0xfd,0xe8,0x01,0x5d,0x15,0x03,0xe2,0x00,0x11,0xfe,0xe5,0x00,0x2f,0xfe,0xfd,
+0x83,0x00,0x4a,0x75,0xde,0x00,0x00,0x00,0xe8,0x00,0xe6,0x77,0x00,0x53,0xfc,0xfd,
+0x00,0x00,0xfd,0x04,0x00,0x0f,0x01,0x00,0x4c,0x13,0x02,0xdc,0x01,0x1f,0x02,0x64,
+0x01,0x5b,0x1f,0xfd,0x2e,0x04,0x60,0x16,0xec,0xc7,0x02,0x04,0x84,0x00,0x10,0xfd,
+0x07,0x00,0x2f,0xfb,0xf8,0x1d,0x05,0x4d,0xa7,0x02,0xf8,0x00,0x00,0xe6,0xfd,0xe6,
+0xf4,0x00,0xdd,0x3c,0x03,0x2f,0xf1,0xfa,0xed,0x00,0x49,0x72,0xce,0x00,0x00,0x00,
+0xea,0x00,0xe9,0x9f,0x04,0x51,0x00,0xfc,0x00,0xff,0xfe,0xaf,0x03,0x1f,0x02,0xa3,
+0x04,0x51,0x01,0x68,0x01,0x4f,0xfd,0xfe,0x00,0xfc,0xe3,0x01,0x5e,0x10,0xfa,0xe4,
+0x00,0x0f,0x58,0x01,0x4a,0x09,0x51,0x08,0xb1,0xe0,0xde,0x00,0x00,0xf1,0xfd,0xe5,
+0xfe,0x02,0x00,0x02,0x59,0x01,0xdf,0xeb,0xf5,0x00,0xf5,0xe6,0xf8,0xf7,0x00,0xf8,
+0xf6,0xfa,0xf6,0xf9,0x9c,0x04,0x47,0x66,0xe5,0xec,0x00,0x00,0xf7,0xfe,0xc3,0x03,
+0xa3,0xfa,0xfb,0x00,0x00,0xfa,0xfc,0x00,0x00,0xfd,0xff,0xd1,0x03,0x0f,0x29,0x04,
+0x43,0x22,0xee,0xf9,0xdd,0x08,0x13,0x02,0x11,0x00,0x22,0xfc,0xfc,0xaa,0x04,0x01,
+0x8a,0x00,0x0f,0x57,0x02,0x48,0x14,0xed,0x30,0x04,0x1a,0x02,0xb8,0x03,0x1f,0xfc,
+0xbf,0x02,0x48,0xe0,0x03,0xfa,0xe3,0xed,0x00,0x00,0xed,0xfc,0xf4,0xfe,0x02,0xf4,
+0x02,0x02,0xde,0x01,0xef,0xf8,0xf8,0xfd,0xfb,0xf8,0xfb,0xf9,0xfd,0xfb,0xfe,0x00,
+0xfd,0xfc,0x02,0x64,0x02,0x4a,0x2e,0x02,0xfd,0xa6,0x04,0x0f,0x82,0x06,0x4c,0x05,
+0xd0,0x07,0x1f,0xfe,0xac,0x03,0x56,0x0e,0x6a,0x00,0x0f,0x5a,0x08,0x52,0x0f,0x36,
+0x02,0x0a,0x3f,0xff,0x00,0xfe,0x7a,0x00,0x44,0x0a,0x39,0x09,0x0f,0x65,0x01,0xcd,
+0x1e,0x02,0x7e,0x0c,0x19,0x02,0xf4,0x07,0x0f,0x2f,0x04,0x43,0x2f,0xf6,0x00,0x01,
+0x00,0x77,0x0f,0x49,0x03,0x4f,0x1f,0xf5,0x7f,0x00,0x0b,0x2f,0xfd,0xfe,0x32,0x0a,
+0x47,0x1c,0xea,0x55,0x03,0x20,0xfe,0x03,0x59,0x03,0x10,0x06,0x08,0x07,0x0f,0x01,
+0x00,0x5c,0x1f,0xfc,0x20,0x0b,0x4f,0x1c,0xeb,0x5c,0x01,0x2f,0xfe,0x02,0x28,0x05,
+0x51,0x1f,0xf1,0xca,0x02,0x77,0x1f,0xfb,0x77,0x00,0x63,0x1f,0xfe,0x6c,0x00,0xc1,
+0x0f,0x55,0x12,0x23,0x0f,0x82,0x01,0x0c,0x0b,0x1e,0x08,0x0f,0xb0,0x01,0x35,0x2f,
+0xf8,0xf8,0xe3,0x00,0x57,0x15,0xf8,0x6d,0x00,0x21,0xf8,0xf3,0x0a,0x00,0x10,0xee,
+0x0b,0x00,0x0c,0x25,0x00,0x0f,0x1d,0x01,0x04,0x3f,0xfb,0xfb,0xfb,0x54,0x01,0x34,
+0x1f,0xf6,0xcb,0x01,0x6d,0x0f,0x01,0x00,0x44,0x2f,0xee,0xf3,0xe7,0x00,0x06,0x0f,
+0x91,0x00,0x49,0x13,0xf3,0x77,0x00,0x1f,0x05,0xa2,0x07,0x6c,0x04,0x5d,0x02,0x1f,
+0x0a,0xee,0x00,0x52,0x0f,0x1e,0x04,0x5d,0x0a,0x5c,0x02,0x1f,0xee,0x9e,0x04,0x64,
+0x1e,0xf1,0x2f,0x04,0x0f,0x63,0x02,0x41,0x2b,0xec,0xe6,0xca,0x02,0x2e,0x03,0x03,
+0xf6,0x00,0x0e,0x2b,0x04,0x08,0x54,0x07,0x3f,0xe9,0xee,0xe9,0x41,0x03,0x1f,0x1f,
+0xe6,0xc1,0x12,0x02,0x1f,0xf3,0x3c,0x00,0x12,0x03,0x07,0x00,0x2f,0xee,0xee,0xd1,
+0x02,0x37,0x0f,0x30,0x03,0x53,0x0e,0xc9,0x01,0x0f,0x01,0x00,0x5b,0x00,0x5f,0x01,
+0x1f,0x08,0x66,0x00,0x4e,0x1f,0xf6,0x98,0x04,0x63,0x52,0xf3,0xf8,0xf8,0x00,0xf8,
+0xf9,0x06,0x00,0xd0,0x01,0x23,0xf1,0xfb,0x63,0x01,0x10,0xf3,0xf7,0x00,0x1f,0xfb,
+0xee,0x00,0x48,0x1f,0xfd,0xee,0x00,0x61,0x16,0xf6,0xe9,0x07,0x00,0xee,0x00,0x20,
+0xf8,0xf6,0x08,0x00,0x3f,0xfd,0x00,0xf3,0xfa,0x05,0x4d,0x03,0xb7,0x02,0x3f,0xfb,
+0x03,0x03,0xc8,0x0a,0x5f,0x1f,0xf8,0x36,0x0a,0x8a,0x0f,0x6f,0x08,0x49,0x2f,0xee,
+0xf3,0x64,0x02,0x62,0x1f,0xf6,0x66,0x00,0x5c,0x1f,0xf8,0xd5,0x08,0x58,0x18,0xf8,
+0xea,0x07,0x01,0x87,0x00,0x2f,0xf6,0xfb,0x4f,0x02,0x5b,0x1f,0xfb,0x16,0x0c,0x58,
+0x0c,0xdc,0x00,0x0f,0xd0,0x1e,0x53,0x0f,0x10,0x0c,0x23,0x1f,0xfb,0x46,0x0c,0x2e,
+0x2b,0x03,0x03,0x52,0x00,0x0e,0x7b,0x0d,0x0f,0x9e,0x06,0x5e,0x0f,0xba,0x0a,0x58,
+0x0f,0x39,0x0b,0x53,0x2f,0xe6,0xe6,0xba,0x01,0x0c,0x17,0xf3,0x8d,0x00,0x18,0xf6,
+0x1d,0x00,0x32,0xfb,0x00,0xe9,0x6d,0x03,0x10,0xfb,0x6d,0x0e,0x23,0xee,0xf3,0x04,
+0x0a,0x2f,0xf6,0xf1,0x87,0x05,0x34,0x00,0x50,0x0a,0x07,0x5e,0x03,0x00,0x62,0x04,
+0x13,0xfb,0xb7,0x06,0x18,0xfb,0xf4,0x03,0x1f,0xf8,0xc3,0x06,0x18,0x1f,0xf8,0xfe,
+0x05,0x63,0x2f,0xf1,0xf1,0x9c,0x06,0x33,0x1f,0xf8,0x04,0x0d,0x24,0x0f,0x71,0x06,
+0x89,0x1e,0xf8,0x16,0x0c,0x0f,0xf7,0x00,0x23,0x2f,0xe9,0xec,0x63,0x1f,0x12,0x26,
+0xf6,0xf6,0x0a,0x02,0x05,0xaa,0x00,0x26,0xf1,0xf3,0x6e,0x03,0x2f,0xec,0xf6,0x6c,
+0x01,0x1a,0x2f,0xee,0xec,0xdc,0x01,0x1d,0x1e,0x03,0xa1,0x01,0x0f,0xad,0x01,0x1f,
+0x2f,0xec,0xe9,0xfd,0x01,0x21,0x02,0x86,0x00,0x44,0xf1,0xf6,0xf6,0xf6,0x75,0x0a,
+0x24,0xee,0xf8,0x5d,0x05,0x0f,0x77,0x00,0x13,0x1f,0xec,0x61,0x03,0x0e,0x1f,0xfb,
+0x1c,0x00,0x07,0x05,0x05,0x01,0x3f,0xfd,0xf3,0xf8,0xe8,0x18,0x91,0x2f,0xe9,0xe9,
+0x6f,0x03,0x27,0x12,0xfb,0x65,0x01,0x0f,0xdc,0x01,0x22,0x1f,0xee,0x38,0x22,0x27,
+0x0e,0x53,0x02,0x0f,0x1b,0x0b,0x53,0x06,0xab,0x14,0x0f,0x51,0x15,0x50,0x05,0xaa,
+0x00,0x28,0xfb,0xf1,0x5b,0x05,0x1f,0xf3,0xe7,0x11,0x5b,0x00,0xbc,0x10,0x1f,0xf8,
+0xdb,0x12,0x66,0x1f,0xfb,0x5d,0x24,0x1b,0x1f,0xfd,0xb1,0x0d,0x2e,0x1f,0xfd,0xf9,
+0x06,0x47,0x0f,0x19,0x06,0x0e,0x1f,0xfb,0x77,0x00,0x63,0x0f,0x1b,0x18,0x58,0x1f,
+0xf8,0x84,0x00,0x27,0x0f,0x4c,0x05,0x1a,0x1f,0x05,0x77,0x00,0x36,0x2f,0xf1,0xf3,
+0xdc,0x01,0x35,0x1f,0xfd,0xca,0x02,0x55,0x0f,0x62,0x15,0x29,0x1f,0xf8,0x98,0x16,
+0x3c,0x0f,0x53,0x02,0x33,0x1f,0xf1,0xed,0x0a,0x14,0x1f,0xf8,0x77,0x00,0x3b,0x1f,
+0xee,0xee,0x00,0x43,0x0f,0xbc,0x0f,0x29,0x1f,0xfb,0xa3,0x18,0x63,0x1f,0xf3,0xda,
+0x12,0x51,0x1f,0xfb,0x02,0x13,0x57,0x12,0xfb,0xe5,0x0d,0x1f,0xf8,0x80,0x00,0x13,
+0x1f,0xfb,0xe5,0x00,0x4f,0x1f,0x08,0xc5,0x0c,0x63,0x1f,0x08,0x78,0x00,0x05,0x1f,
+0x0d,0xd2,0x01,0x7f,0x0f,0x7b,0x0d,0x17,0x1f,0xfb,0x6d,0x2c,0x14,0x1e,0xf8,0x2f,
+0x06,0x0f,0x2f,0x04,0x29,0x0f,0x19,0x03,0x44,0x0f,0x77,0x00,0x39,0x0f,0x2c,0x0f,
+0x46,0x2f,0x05,0x05,0x1a,0x19,0x36,0x0f,0x74,0x17,0xa2,0x09,0xa2,0x0b,0x0f,0x41,
+0x13,0x17,0x2f,0xec,0xec,0xb1,0x01,0x27,0x17,0xec,0x21,0x12,0x0f,0xf2,0x11,0x1c,
+0x1f,0xfb,0x26,0x02,0x3c,0x1f,0xfb,0x7b,0x0d,0x40,0x0b,0xd9,0x21,0x4f,0xfb,0xfd,
+0xfd,0xfd,0x82,0x0a,0x24,0x2f,0xf1,0xf6,0xe0,0x23,0x88,0x1f,0xf8,0x3f,0x01,0x0e,
+0x1f,0xfb,0xe9,0x12,0x63,0x0f,0x8d,0x0c,0x3c,0x1f,0xf8,0xf4,0x03,0x09,0x1e,0xfd,
+0x95,0x0f,0x0f,0x04,0x0d,0x42,0x19,0xfb,0x38,0x10,0x17,0xf3,0xd1,0x0f,0x2f,0xfb,
+0xf8,0x69,0x0e,0x2b,0x2e,0xf1,0xf1,0xa1,0x06,0x05,0xc8,0x02,0x28,0xf3,0xf3,0x52,
+0x01,0x44,0xf1,0xfb,0xfd,0xfd,0x2f,0x04,0x26,0xf8,0xf6,0x32,0x04,0x12,0x01,0x1c,
+0x2b,0x21,0x02,0x03,0x33,0x4e,0x1e,0x04,0x51,0x05,0x04,0xbc,0x3b,0x00,0xbd,0x3b,
+0x92,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0xc1,0x3b,0x01,0x20,0x00,0xff,
+0x0c,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,
+0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0xcb,0x00,0x08,0xf0,
+0x4e,0x29,0x2a,0x2b,0x00,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x00,0x33,0x00,0x34,
+0x35,0x00,0x00,0x36,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x00,0x3d,0x3e,0x3f,0x40,0x41,
+0x42,0x00,0x00,0x00,0x43,0x44,0x45,0x46,0x47,0x48,0x00,0x49,0x31,0x4a,0x00,0x4b,
+0x4c,0x00,0x00,0x31,0x4d,0x4e,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,
+0x58,0x59,0x00,0x5a,0x5b,0x5c,0x5d,0x5e,0x5f,0x60,0x61,0x62,0x63,0x64,0x2d,0x65,
+0x66,0x00,0x67,0x68,0x69,0x6a,0x6a,0x6b,0x00,0x6c,0x6d,0x6e,0x00,0x6f,0x61,0x00,
+0xff,0x05,0x70,0x00,0x71,0x00,0x00,0x2d,0x72,0x73,0x00,0x00,0x00,0x74,0x75,0x76,
+0x77,0x00,0x78,0x79,0x7a,0x00,0x01,0x00,0xff,0x48,0x02,0x46,0x02,0x20,0x03,0x02,
+0x41,0x02,0x3c,0x06,0x07,0x06,0xe0,0x09,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,
+0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0x20,0x0b,0x00,0x0c,0x3e,0x00,0x0b,0x3e,0xd1,
+0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,
+0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,
+0x00,0x23,0x73,0x00,0x02,0xf1,0x03,0x24,0x00,0x25,0x26,0x27,0x28,0x00,0x29,0x00,
+0x2a,0x2b,0x2c,0x2d,0x00,0x2a,0x2a,0x00,0x00,0x4e,0x02,0x30,0x33,0x34,0x35,0x4a,
+0x02,0xf3,0x01,0x00,0x3a,0x3b,0x3c,0x3c,0x3d,0x3e,0x00,0x00,0x3f,0x00,0x00,0x40,
+0x41,0x00,0x42,0x4e,0x02,0x91,0x49,0x4a,0x00,0x4b,0x4b,0x00,0x4c,0x4d,0x00,0x4b,
+0x02,0x00,0x4c,0x02,0x01,0x4d,0x02,0x22,0x55,0x43,0x4e,0x02,0x11,0x55,0x4f,0x02,
+0x40,0x00,0x00,0x65,0x66,0x4f,0x02,0x41,0x00,0x00,0x00,0x6b,0x50,0x02,0xdf,0x70,
+0x71,0x72,0x00,0x00,0x73,0x00,0x74,0x75,0x00,0x00,0x76,0x77,0x40,0x02,0xff,0x43,
+0x50,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const uint8_t lz4BitmapData[] ={
+0xf0,0xbd,0x0f,0xf6,0x0e,0xf6,0x0e,0xf5,0x0d,0xf5,0x0d,0xf4,0x0c,0xf4,0x0c,0xf3,
+0x0b,0xf3,0x02,0x30,0x03,0x60,0x0f,0xf6,0x0b,0xe3,0x8f,0x1f,0xa8,0xf0,0xf9,0x8f,
+0x0f,0x78,0xd0,0xf6,0x36,0x07,0x20,0x00,0x06,0xf0,0x7f,0x00,0x00,0x09,0xd0,0xac,
+0x00,0x00,0x0c,0xa0,0xd9,0x00,0x0e,0xff,0xff,0xff,0xf3,0x06,0x8f,0x98,0xf8,0x61,
+0x00,0x4f,0x25,0xf1,0x00,0x01,0x7f,0x28,0xf1,0x10,0x8f,0xff,0xff,0xff,0xa0,0x24,
+0xdc,0x4e,0xb4,0x20,0x00,0xe8,0x0f,0x70,0x00,0x00,0xf5,0x1f,0x40,0x00,0x03,0xf3,
+0x4f,0x20,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x0c,0x70,0x00,0x00,0x3a,0xfe,0x70,
+0x00,0x3f,0xff,0xff,0xa0,0x0a,0xfb,0x05,0xff,0x20,0xcf,0x70,0x0d,0xf5,0x0a,0xfc,
+0x10,0x00,0x00,0x3f,0xff,0x91,0x00,0x00,0x3c,0xff,0xf4,0x00,0x00,0x03,0xcf,0xf1,
+0x18,0x70,0x00,0xef,0x52,0xff,0x30,0x0e,0xf5,0x0c,0xfe,0x8b,0xff,0x20,0x2d,0xff,
+0xff,0x60,0x00,0x03,0xf8,0x10,0x00,0x00,0x0e,0x50,0x00,0x05,0xdf,0xa0,0x00,0x00,
+0x00,0x1f,0xb7,0xf7,0x01,0x80,0x00,0x3f,0x40,0xda,0x0a,0xc0,0x00,0x2f,0x82,0xf9,
+0x3f,0x30,0x00,0x09,0xff,0xe2,0xd9,0x00,0x00,0x00,0x23,0x07,0xe1,0x00,0x20,0x00,
+0x10,0x60,0x06,0x00,0xf0,0x57,0xac,0x2c,0xfe,0x50,0x00,0x04,0xf3,0xae,0x5b,0xf0,
+0x00,0x0d,0x90,0xcb,0x06,0xf1,0x00,0x2c,0x10,0xae,0x6c,0xf0,0x00,0x00,0x00,0x1b,
+0xfd,0x40,0x00,0x3c,0xfd,0x50,0x00,0x00,0x1e,0xff,0xff,0x30,0x00,0x05,0xfb,0x08,
+0xf7,0x00,0x00,0x6f,0xa0,0x8f,0x60,0x00,0x02,0xff,0xaf,0xd0,0x00,0x00,0x09,0xff,
+0xb1,0x00,0x00,0x05,0xff,0xfc,0x04,0xd8,0x02,0xff,0x6e,0xf9,0x7f,0x80,0x6f,0xe0,
+0x3f,0xff,0xf4,0x05,0xff,0x10,0x6f,0xfd,0x00,0x0d,0xfe,0xcf,0xff,0xe2,0x00,0x19,
+0xef,0xd8,0xaf,0xd0,0x8f,0x28,0xf2,0x8f,0x18,0xf0,0x47,0x00,0x01,0x00,0xf1,0x07,
+0x03,0xe1,0x00,0x1e,0xd1,0x00,0xaf,0x20,0x02,0xfa,0x00,0x08,0xf5,0x00,0x0b,0xf2,
+0x00,0x0e,0xf0,0x00,0x0f,0xe0,0x03,0x00,0xf0,0x36,0xf0,0x00,0x0d,0xf0,0x00,0x0a,
+0xf3,0x00,0x05,0xf7,0x00,0x00,0xee,0x00,0x00,0x6f,0x70,0x00,0x09,0xf2,0x00,0x00,
+0x70,0x00,0x00,0x07,0xb0,0x00,0x4f,0xa0,0x00,0x8f,0x50,0x01,0xfd,0x00,0x0c,0xf3,
+0x00,0x8f,0x70,0x06,0xfa,0x00,0x5f,0xb0,0x04,0xfc,0x00,0x5f,0xa0,0x06,0xf8,0x00,
+0x9f,0x50,0x0d,0xf0,0x04,0xf9,0x00,0xcf,0x10,0x8f,0x40,0x04,0x30,0x00,0x00,0x4b,
+0x01,0xf1,0x08,0x0f,0x60,0x00,0x8d,0x6e,0x89,0xd0,0x5b,0xff,0xfe,0x90,0x00,0xaf,
+0xe1,0x00,0x07,0xf4,0xeb,0x00,0x09,0x90,0x6d,0x10,0x80,0x00,0xf0,0x02,0x07,0xa4,
+0x00,0x00,0x00,0xbf,0x60,0x00,0x00,0x0b,0xf6,0x00,0x01,0x22,0xcf,0x72,0x20,0x88,
+0x01,0x50,0x48,0xff,0xff,0xff,0xf4,0x12,0x00,0x05,0x1b,0x00,0xf9,0x1a,0x00,0x0e,
+0xf0,0xef,0x0f,0xd4,0xf8,0x5c,0x00,0x2e,0xee,0xe3,0x2f,0xff,0xf4,0x03,0x70,0x0f,
+0xf7,0x0a,0xf4,0x00,0x00,0x1f,0x90,0x00,0x06,0xf4,0x00,0x00,0xbe,0x00,0x00,0x0f,
+0xa0,0x00,0x05,0xf5,0x00,0x00,0xaf,0x0a,0x00,0xff,0x41,0xb0,0x00,0x04,0xf6,0x00,
+0x00,0xaf,0x10,0x00,0x0e,0xb0,0x00,0x00,0x00,0x6d,0xfe,0x80,0x00,0x6f,0xff,0xff,
+0x90,0x0e,0xf8,0x05,0xff,0x12,0xff,0x10,0x0e,0xf4,0x3f,0xf0,0x00,0xdf,0x64,0xff,
+0x00,0x0d,0xf7,0x4f,0xf0,0x00,0xdf,0x73,0xff,0x00,0x0d,0xf6,0x2f,0xf1,0x00,0xef,
+0x40,0xef,0x80,0x5f,0xf1,0x06,0xff,0xff,0xf9,0x00,0x06,0xdf,0xe8,0x00,0x00,0x16,
+0xc4,0x3a,0xff,0xf4,0xbf,0xff,0xf4,0x65,0x0f,0xf4,0x00,0x03,0x00,0x05,0xf1,0x35,
+0x7d,0xfd,0x80,0x00,0xaf,0xff,0xff,0xa0,0x2f,0xf4,0x06,0xff,0x05,0xec,0x00,0x1f,
+0xf2,0x00,0x00,0x04,0xff,0x00,0x00,0x00,0xdf,0x80,0x00,0x00,0xbf,0xd0,0x00,0x00,
+0xaf,0xe2,0x00,0x00,0x8f,0xf3,0x00,0x00,0x6f,0xf4,0x00,0x00,0x2f,0xff,0xee,0xee,
+0x83,0xff,0xff,0xff,0xf9,0x01,0x9e,0xfd,0x70,0x00,0xcf,0xfe,0xff,0xa0,0x3f,0xf3,
+0x05,0xff,0x11,0x33,0x36,0x00,0xf0,0x37,0x08,0xfe,0x00,0x00,0xef,0xfd,0x20,0x00,
+0x0c,0xef,0xf7,0x00,0x00,0x00,0x3f,0xf2,0x25,0x40,0x00,0xef,0x56,0xff,0x20,0x4f,
+0xf4,0x0d,0xff,0xef,0xfc,0x00,0x19,0xdf,0xd8,0x00,0x00,0x00,0x2f,0xf7,0x00,0x00,
+0x0c,0xff,0x70,0x00,0x06,0xff,0xf7,0x00,0x01,0xee,0xdf,0x70,0x00,0xaf,0x5c,0xf7,
+0x00,0x4f,0xb0,0xcf,0x70,0x0d,0xf1,0x0c,0xf7,0x07,0xff,0xee,0xff,0xfa,0x43,0x01,
+0xa0,0xc0,0x00,0x00,0xcf,0x70,0x00,0x00,0x0c,0xf7,0x00,0x09,0x00,0xf0,0x11,0x04,
+0xff,0xff,0xff,0x20,0x6f,0xff,0xff,0xf2,0x08,0xf9,0x00,0x00,0x00,0x9f,0x70,0x00,
+0x00,0x0b,0xfc,0xef,0xb1,0x00,0xdf,0xfd,0xff,0xd0,0x01,0x51,0x03,0xff,0x40,0x29,
+0x00,0xf0,0x31,0x17,0x70,0x00,0xcf,0x70,0xff,0x70,0x3f,0xf4,0x07,0xff,0xff,0xfc,
+0x00,0x06,0xdf,0xe9,0x00,0x00,0x02,0x9d,0xe0,0x00,0x05,0xff,0xfe,0x00,0x02,0xff,
+0x92,0x00,0x00,0xaf,0xa0,0x00,0x00,0x0f,0xf8,0xdf,0xc3,0x02,0xff,0xff,0xff,0xe0,
+0x3f,0xf7,0x02,0xff,0x63,0xff,0x00,0x0b,0xf8,0x1f,0xf2,0x00,0xbf,0x90,0xdf,0x90,
+0x2f,0xf5,0x04,0x36,0x00,0x31,0x04,0xcf,0xe9,0x49,0x03,0xf0,0x07,0x87,0xee,0xee,
+0xef,0xf6,0x00,0x00,0x02,0xff,0x10,0x00,0x00,0x8f,0x90,0x00,0x00,0x0f,0xf3,0x00,
+0x00,0x06,0xfc,0x12,0x01,0x90,0x60,0x00,0x00,0x4f,0xe0,0x00,0x00,0x0b,0xf8,0x1e,
+0x00,0x90,0x20,0x00,0x00,0x9f,0xb0,0x00,0x00,0x1f,0xf5,0x9e,0x01,0xf0,0x13,0xfd,
+0x80,0x00,0x7f,0xff,0xff,0xa0,0x0d,0xf8,0x05,0xff,0x00,0xff,0x40,0x1f,0xf2,0x0c,
+0xf9,0x07,0xfe,0x00,0x2d,0xff,0xfe,0x30,0x04,0xff,0xff,0xf6,0x00,0xef,0x60,0x3f,
+0xf2,0xb0,0x01,0xf0,0x03,0x62,0xff,0x50,0x3f,0xf5,0x0b,0xff,0xef,0xfd,0x00,0x08,
+0xdf,0xe9,0x10,0x00,0x6d,0xfd,0x50,0x36,0x00,0xf0,0x00,0x50,0x0f,0xf7,0x07,0xfe,
+0x04,0xff,0x00,0x0f,0xf3,0x4f,0xf0,0x00,0xef,0x51,0x24,0x00,0xf2,0x13,0x0a,0xff,
+0xdf,0xff,0x40,0x0a,0xfe,0x8f,0xf2,0x00,0x00,0x05,0xfe,0x00,0x00,0x15,0xef,0x70,
+0x00,0x9f,0xff,0xb0,0x00,0x09,0xfc,0x60,0x00,0x0a,0xe3,0x0f,0xf7,0x03,0x70,0x00,
+0x00,0x03,0x00,0x4a,0x02,0x83,0xe3,0x0c,0xe2,0x1f,0xf5,0x04,0x60,0x00,0x01,0x00,
+0xa4,0x0b,0xf2,0x0b,0xf2,0x0d,0xf0,0x2f,0xa0,0x3d,0x20,0x12,0x00,0xf0,0x17,0x04,
+0xb2,0x00,0x06,0xdf,0xf2,0x18,0xef,0xfe,0x80,0x9f,0xfa,0x40,0x00,0x9f,0xfc,0x60,
+0x00,0x06,0xdf,0xff,0xa1,0x00,0x04,0xbf,0xf2,0x00,0x00,0x02,0x92,0xff,0xff,0xff,
+0xf0,0xde,0xee,0xee,0xe0,0x2a,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0xf0,0x3f,0x0c,
+0x50,0x00,0x00,0x1f,0xfd,0x70,0x00,0x07,0xdf,0xff,0x92,0x00,0x03,0x9e,0xfc,0x00,
+0x05,0xbf,0xfb,0x09,0xef,0xfe,0x71,0x1f,0xfc,0x50,0x00,0x0a,0x30,0x00,0x00,0x03,
+0xbf,0xeb,0x20,0x2f,0xff,0xff,0xe0,0x8f,0xd0,0x2f,0xf4,0x24,0x20,0x0f,0xf5,0x00,
+0x00,0x6f,0xf1,0x00,0x05,0xff,0x50,0x00,0x0f,0xf6,0x00,0x00,0x3f,0xd0,0x00,0x00,
+0x14,0x30,0x00,0x00,0x06,0x30,0x00,0x00,0x7f,0xf0,0x00,0x00,0x3e,0xbf,0x02,0xf2,
+0x45,0x3a,0xdf,0xeb,0x40,0x00,0x00,0x08,0xfc,0x75,0x6b,0xf9,0x00,0x00,0x8f,0x60,
+0x01,0x00,0x4f,0x70,0x03,0xf8,0x01,0xcf,0xfa,0x07,0xf1,0x0a,0xe0,0x0c,0xf6,0xbf,
+0x01,0xf5,0x0f,0x90,0x5f,0x60,0x9f,0x00,0xd8,0x2f,0x50,0xaf,0x10,0xae,0x00,0xb9,
+0x4f,0x30,0xde,0x00,0xbd,0x00,0xca,0x4f,0x30,0xed,0x00,0xcc,0x00,0xd7,0x3f,0x50,
+0xde,0x00,0xfb,0x02,0xf4,0x0f,0x80,0x9f,0x8b,0xfe,0x6d,0xc0,0x0b,0xe1,0x1c,0xfa,
+0x2d,0xfb,0x10,0x02,0xfc,0x84,0x03,0xb0,0x5f,0xfa,0x77,0x99,0x00,0x00,0x00,0x02,
+0x8d,0xff,0xc6,0x0f,0x00,0x30,0xef,0xa0,0x00,0xd6,0x04,0x10,0x00,0x4f,0x04,0x10,
+0xf5,0x10,0x00,0xf0,0x71,0xdf,0xb0,0x00,0x00,0x4f,0xf4,0xff,0x10,0x00,0x0a,0xfb,
+0x0e,0xf6,0x00,0x00,0xff,0x60,0xaf,0xc0,0x00,0x5f,0xf1,0x05,0xff,0x20,0x0b,0xff,
+0xff,0xff,0xf7,0x01,0xff,0xff,0xff,0xff,0xd0,0x6f,0xf2,0x00,0x05,0xff,0x2c,0xfb,
+0x00,0x00,0x0e,0xf8,0xff,0xff,0xfd,0x80,0x0f,0xff,0xff,0xff,0xb0,0xff,0x50,0x08,
+0xff,0x1f,0xf5,0x00,0x2f,0xf2,0xff,0x50,0x08,0xfe,0x0f,0xff,0xff,0xfe,0x30,0xff,
+0xdc,0xcf,0xfa,0x0f,0xf5,0x00,0x2f,0xf4,0xff,0x50,0x00,0xef,0x7f,0xf5,0x00,0x5f,
+0xf5,0xff,0xff,0xff,0xfd,0x0f,0xff,0xff,0xd9,0x10,0x00,0x19,0xef,0xe9,0x10,0x01,
+0xdf,0xff,0xff,0xd1,0x0a,0xfe,0x30,0x3e,0xf8,0x0f,0xf6,0x00,0x08,0xfd,0x3f,0xf2,
+0x00,0x00,0x21,0x4f,0xf0,0xa3,0x00,0x00,0x05,0x00,0x00,0x0f,0x00,0xf1,0x01,0x11,
+0x0f,0xf5,0x00,0x08,0xfd,0x0a,0xfd,0x30,0x3e,0xf9,0x01,0xef,0xff,0xff,0xd1,0x37,
+0x00,0x00,0x40,0x00,0x02,0x60,0x00,0x30,0x50,0x3c,0xfd,0x60,0x00,0xf0,0x1a,0xf5,
+0xff,0x50,0x00,0xcf,0x9f,0xf5,0x00,0x0a,0xfb,0xff,0x50,0x00,0xaf,0xbf,0xf5,0x00,
+0x0c,0xf9,0xff,0x50,0x02,0xff,0x5f,0xf5,0x03,0xcf,0xd0,0xff,0xff,0xff,0xe3,0x0f,
+0xff,0xfe,0x92,0x00,0xff,0xff,0xff,0xfa,0x89,0x03,0x44,0xff,0x50,0x00,0x00,0x04,
+0x00,0x00,0xcb,0x00,0x4b,0xff,0xfe,0xee,0xc0,0x14,0x00,0x13,0xf9,0x2c,0x00,0x11,
+0xf6,0x04,0x00,0x0c,0x30,0x00,0x00,0x04,0x00,0x08,0x14,0x00,0x03,0x04,0x00,0xf0,
+0x09,0x00,0x18,0xdf,0xea,0x20,0x00,0x1d,0xff,0xff,0xfe,0x10,0x09,0xff,0x40,0x2e,
+0xf9,0x00,0xef,0x70,0x00,0x6f,0xe0,0x2f,0xf3,0x76,0x02,0x10,0xff,0x5b,0x02,0xf0,
+0x09,0x4f,0xf2,0x07,0xff,0xff,0x02,0xff,0x30,0x5d,0xdf,0xf0,0x0e,0xf8,0x00,0x05,
+0xff,0x00,0x8f,0xf5,0x00,0x8f,0xf0,0x00,0xdf,0x4a,0x03,0x40,0x00,0x8d,0xfe,0xc6,
+0x46,0x00,0x2f,0x1f,0xf4,0x05,0x00,0x02,0x00,0x21,0x05,0x02,0x05,0x00,0x0f,0x23,
+0x00,0x05,0x3b,0xdf,0x8d,0xf8,0x03,0x00,0x4f,0x00,0x00,0x06,0xff,0x04,0x00,0x09,
+0xf0,0x01,0x6a,0x70,0x06,0xfe,0x8f,0xe1,0x1c,0xfb,0x1f,0xff,0xff,0xf3,0x02,0xbe,
+0xfc,0x40,0x32,0x01,0xf0,0x09,0xc0,0xff,0x50,0x0c,0xfe,0x10,0xff,0x50,0x8f,0xf4,
+0x00,0xff,0x54,0xff,0x80,0x00,0xff,0x7e,0xfc,0x00,0x00,0xff,0xef,0xf5,0xfa,0x00,
+0xf0,0x08,0xfd,0x00,0x00,0xff,0xf8,0xff,0x70,0x00,0xff,0x80,0xaf,0xf2,0x00,0xff,
+0x50,0x1e,0xfb,0x00,0xff,0x50,0x06,0xff,0x50,0x7b,0x01,0x1e,0xe1,0x10,0x01,0x0e,
+0x04,0x00,0x03,0x40,0x01,0x11,0xf5,0x04,0x00,0x40,0xf3,0x00,0x00,0x4f,0x74,0x05,
+0x40,0x00,0x9f,0xff,0xff,0x05,0x05,0xf0,0x1a,0xff,0xff,0xdf,0x40,0x04,0xfd,0xff,
+0xff,0x9f,0x90,0x09,0xf9,0xff,0xff,0x4f,0xe0,0x0e,0xf4,0xff,0xff,0x4b,0xf4,0x4f,
+0xb4,0xff,0xff,0x45,0xf9,0x9f,0x54,0xff,0xff,0x50,0xfe,0xef,0x05,0xff,0xff,0x50,
+0xaf,0xfa,0x06,0x00,0x30,0x5f,0xf5,0x05,0x04,0x04,0x50,0xf0,0x05,0xff,0xff,0xa0,
+0x00,0x01,0x10,0xf3,0x05,0x00,0x11,0xfc,0x28,0x01,0xf0,0x0d,0x60,0x1f,0xf4,0xff,
+0xcf,0xe0,0x1f,0xf4,0xff,0x5d,0xf8,0x1f,0xf4,0xff,0x54,0xff,0x3f,0xf4,0xff,0x50,
+0xaf,0xcf,0xf4,0xff,0x50,0x2f,0xff,0xf4,0xa0,0x02,0x01,0x8a,0x02,0x00,0x05,0x00,
+0xf0,0x21,0x5f,0xf4,0x00,0x08,0xdf,0xd8,0x10,0x00,0x0d,0xff,0xff,0xfd,0x10,0x09,
+0xff,0x51,0x4e,0xf9,0x00,0xff,0x70,0x00,0x7f,0xf0,0x3f,0xf2,0x00,0x02,0xff,0x34,
+0xff,0x10,0x00,0x0f,0xf5,0x4f,0xf1,0x00,0x00,0xff,0x53,0xff,0x20,0x00,0x2f,0xf3,
+0x0f,0xf7,0x35,0x01,0x70,0x9f,0xf5,0x04,0xef,0x90,0x00,0xdf,0x87,0x02,0x53,0x00,
+0x8d,0xfd,0x81,0x00,0xfa,0x02,0x00,0x0f,0x02,0xf0,0x01,0x05,0xff,0x6f,0xf5,0x00,
+0x0b,0xfa,0xff,0x50,0x00,0xbf,0xbf,0xf5,0x00,0x4f,0xf7,0xe8,0x02,0x50,0x1f,0xff,
+0xff,0xe9,0x10,0xf6,0x00,0x10,0x0f,0x57,0x03,0x05,0x09,0x00,0x20,0x00,0x08,0xd8,
+0x05,0x13,0x1d,0x78,0x00,0x18,0x5f,0x78,0x00,0x20,0x35,0xff,0x24,0x00,0x28,0x5f,
+0xf0,0x78,0x00,0x57,0x07,0xff,0x00,0x9f,0xf4,0x78,0x00,0x20,0xff,0xfd,0x4c,0x02,
+0x20,0x2d,0xfe,0xcc,0x03,0x90,0x0a,0x50,0xff,0xff,0xfd,0x70,0x0f,0xff,0xff,0xb9,
+0x01,0x60,0x07,0xff,0x4f,0xf5,0x00,0x0f,0xaf,0x02,0x00,0x8c,0x00,0x20,0x8f,0xf2,
+0xad,0x03,0x10,0x0f,0x64,0x01,0xc0,0xff,0x50,0x7f,0xf1,0x0f,0xf5,0x00,0xef,0x80,
+0xff,0x50,0x06,0xa1,0x03,0xf0,0x11,0x0e,0xf9,0x00,0x5c,0xff,0xc6,0x00,0x07,0xff,
+0xff,0xff,0x80,0x0f,0xf9,0x00,0x8f,0xf1,0x1f,0xf5,0x00,0x1a,0xa2,0x0c,0xfe,0x60,
+0x00,0x00,0x02,0xdf,0xff,0xa2,0x00,0xc5,0x04,0x10,0x40,0xdf,0x08,0xc0,0xe0,0x5d,
+0xc0,0x00,0x2f,0xf3,0x2f,0xf7,0x00,0x6f,0xf2,0x09,0xe1,0x03,0x60,0x00,0x5c,0xff,
+0xd7,0x00,0xbf,0x20,0x03,0x20,0xaf,0xff,0x59,0x00,0x10,0x04,0xf0,0x05,0x0f,0x05,
+0x00,0x19,0x5f,0x1f,0xf4,0x00,0x0b,0xfa,0x05,0x00,0x0f,0xc1,0xf9,0x0f,0xf5,0x00,
+0x0d,0xf8,0x0c,0xfc,0x20,0x5f,0xf5,0x03,0x78,0x00,0xf2,0x00,0x3b,0xff,0xd8,0x00,
+0xcf,0xc0,0x00,0x05,0xff,0x37,0xff,0x10,0x00,0xaf,0xe0,0xc4,0x00,0xf0,0x0f,0xcf,
+0xa0,0x03,0xff,0x40,0x07,0xfe,0x00,0x8f,0xe0,0x00,0x2f,0xf3,0x0c,0xf9,0x00,0x00,
+0xcf,0x81,0xff,0x40,0x00,0x07,0xfc,0x5f,0xe0,0x00,0x00,0x2f,0xfc,0xf9,0x06,0x01,
+0xc7,0x00,0x30,0x07,0xff,0xe0,0x46,0x07,0x10,0xf9,0x7c,0x06,0xf0,0x31,0x01,0xff,
+0x10,0x0b,0xfa,0x6f,0xe0,0x04,0xff,0x50,0x0d,0xf6,0x3f,0xf1,0x08,0xff,0x90,0x0f,
+0xf3,0x0f,0xf3,0x0b,0xff,0xc0,0x3f,0xf0,0x0c,0xf6,0x0f,0xed,0xf0,0x6f,0xc0,0x09,
+0xf9,0x2f,0xaa,0xf3,0x9f,0x90,0x05,0xfc,0x6f,0x66,0xf7,0xcf,0x60,0x02,0xff,0xaf,
+0x32,0xfa,0xff,0x20,0x00,0xef,0xff,0x00,0xff,0xff,0x00,0x00,0xbf,0xfb,0x03,0x00,
+0x60,0x00,0x8f,0xf8,0x00,0x7f,0xf8,0x22,0x05,0xf0,0x08,0x00,0x4f,0xf5,0x00,0x7f,
+0xf3,0x00,0x1f,0xfa,0x0d,0xfb,0x00,0x8f,0xf1,0x05,0xff,0x41,0xff,0x80,0x00,0xcf,
+0xc9,0xfe,0x4d,0x05,0xb0,0xf6,0x00,0x00,0x0a,0xff,0xd0,0x00,0x00,0x0b,0xff,0xe0,
+0xe9,0x02,0xf0,0x1f,0xf7,0x00,0x00,0xdf,0xb8,0xff,0x10,0x06,0xff,0x31,0xff,0x90,
+0x0e,0xfa,0x00,0x8f,0xf2,0x8f,0xf2,0x00,0x0e,0xfb,0xbf,0xc0,0x00,0x0e,0xfa,0x4f,
+0xf3,0x00,0x5f,0xf2,0x0c,0xfa,0x00,0xcf,0xa0,0x04,0xff,0x23,0xff,0x20,0x00,0xcf,
+0x8a,0xfa,0x32,0x00,0x10,0xf3,0xf5,0x07,0x10,0xb0,0xdd,0x09,0x10,0x30,0x3b,0x01,
+0x1b,0x20,0x05,0x00,0x00,0xd9,0x08,0x30,0xff,0xf1,0x6f,0x7a,0x06,0x00,0x59,0x07,
+0xa0,0x60,0x00,0x00,0x0c,0xfb,0x00,0x00,0x00,0x7f,0xf2,0x0e,0x00,0x00,0x08,0x08,
+0x00,0x7d,0x07,0x60,0x6f,0xf2,0x00,0x00,0x01,0xff,0xfd,0x07,0x10,0xfd,0x53,0x05,
+0x00,0x05,0x0b,0x10,0x6f,0x05,0x00,0xaf,0x0d,0xdd,0x41,0xff,0xf5,0x1f,0xf3,0x01,
+0xff,0x30,0x05,0x00,0x0a,0xf2,0x03,0xd4,0x1f,0xff,0x50,0xdf,0x70,0x00,0x00,0x7f,
+0xd0,0x00,0x00,0x1f,0xf3,0x00,0x00,0x0b,0xf9,0x5b,0x07,0x01,0xca,0x02,0x00,0x1e,
+0x08,0x00,0x20,0x03,0x20,0x0e,0xf6,0xa4,0x06,0x03,0xdd,0x07,0xbf,0xcf,0x80,0x00,
+0x00,0x6f,0xd0,0xbd,0xd6,0xef,0xf7,0x0c,0x02,0x00,0x06,0xf0,0x25,0xbf,0xf7,0xef,
+0xf7,0x00,0x8f,0x80,0x00,0x0e,0xfe,0x00,0x04,0xfc,0xf4,0x00,0xaf,0x2f,0xa0,0x1f,
+0xa0,0xaf,0x17,0xf5,0x04,0xf7,0xdd,0xdd,0xdd,0xd1,0xff,0xff,0xff,0xf2,0x38,0x80,
+0x00,0xbf,0x80,0x00,0xdf,0x20,0x01,0x9e,0xfc,0x50,0x00,0xcf,0xed,0xff,0x40,0x3f,
+0xf1,0x7a,0x00,0xf3,0x0d,0x01,0x9f,0xb0,0x04,0xcf,0xff,0xfb,0x02,0xff,0x74,0xaf,
+0xb0,0x6f,0xd0,0x0a,0xfb,0x03,0xff,0xee,0xff,0xb0,0x05,0xdf,0xb7,0xfe,0x00,0x2f,
+0xf2,0x7f,0x00,0x02,0x09,0x00,0xf0,0x08,0x7d,0xfb,0x10,0x2f,0xff,0xff,0xfc,0x02,
+0xff,0x60,0x4f,0xf3,0x2f,0xf2,0x00,0xdf,0x52,0xff,0x20,0x0c,0xf7,0x2f,0xf2,0x4b,
+0x08,0x32,0x60,0x3f,0xf3,0x1b,0x00,0xf0,0x06,0x6e,0xfb,0x10,0x00,0x8e,0xfd,0x50,
+0x0a,0xff,0xff,0xf5,0x2f,0xf4,0x08,0xfc,0x6f,0xd0,0x01,0x65,0x7f,0xc0,0xbc,0x00,
+0xe9,0x00,0x22,0x2f,0xf4,0x07,0xfc,0x0a,0xff,0xef,0xf6,0x00,0x8e,0xfd,0x60,0x58,
+0x00,0x50,0x20,0x1a,0xfd,0x7f,0xf2,0x02,0x07,0xf0,0x0b,0x22,0xff,0x50,0x7f,0xf2,
+0x5f,0xe0,0x02,0xff,0x27,0xfc,0x00,0x2f,0xf2,0x5f,0xd0,0x02,0xff,0x22,0xff,0x30,
+0x5f,0xf2,0x0b,0xff,0xdf,0x24,0x00,0xf0,0x05,0x6f,0xf2,0x00,0x6d,0xfd,0x70,0x00,
+0x8f,0xff,0xff,0x70,0x1f,0xf5,0x04,0xff,0x05,0xff,0x99,0x9f,0xf2,0x76,0x01,0x20,
+0x35,0xff,0xee,0x0b,0x30,0xf9,0x00,0x85,0x1b,0x00,0xfe,0x09,0xd0,0x00,0x6d,0xfe,
+0xa1,0x00,0x00,0x6d,0xfa,0x04,0xff,0xfa,0x07,0xfd,0x00,0xcf,0xff,0xf7,0x8d,0xfe,
+0xb5,0x08,0xfc,0x00,0x03,0x00,0xf2,0x06,0x00,0xaf,0xe7,0xdf,0x40,0xaf,0xff,0xff,
+0xf4,0x2f,0xf6,0x04,0xff,0x45,0xfe,0x00,0x0f,0xf4,0x6f,0xd0,0x00,0x09,0x00,0x00,
+0x12,0x00,0x01,0x1b,0x00,0xf0,0x05,0x00,0x9f,0xe7,0xff,0x30,0x15,0x00,0x6f,0xf1,
+0x0b,0xff,0xef,0xf9,0x00,0x1a,0xef,0xd7,0x00,0x3f,0xf1,0x74,0x06,0x23,0x10,0x00,
+0x09,0x00,0xf0,0x06,0x5d,0xfb,0x20,0x3f,0xff,0xff,0xfb,0x03,0xff,0x50,0x6f,0xf0,
+0x3f,0xf1,0x02,0xff,0x13,0xff,0x10,0x2f,0xf2,0x09,0x00,0x19,0x23,0x09,0x00,0x8c,
+0x0c,0xe2,0x1f,0xf4,0x04,0x50,0x0f,0xf4,0x02,0x00,0x70,0x00,0xde,0x20,0x1f,0xf4,
+0x00,0x45,0xfa,0x0a,0x2d,0xff,0x40,0x05,0x00,0x7c,0x02,0xff,0x3b,0xff,0xe0,0xaf,
+0xc3,0x87,0x01,0xf0,0x02,0x20,0xaf,0xe1,0x2f,0xf2,0x7f,0xf3,0x02,0xff,0x6f,0xf6,
+0x00,0x2f,0xff,0xfa,0x00,0x02,0xf6,0x00,0xfe,0x03,0x2f,0xfc,0xef,0x70,0x02,0xff,
+0x26,0xff,0x20,0x2f,0xf2,0x0c,0xfc,0x02,0xff,0x20,0x3f,0xf6,0x6e,0x00,0x02,0x02,
+0x00,0xff,0x12,0x2f,0xf4,0xdf,0xc2,0x6e,0xfb,0x12,0xff,0xff,0xff,0xef,0xff,0xfa,
+0x2f,0xf6,0x06,0xff,0x50,0x8f,0xe2,0xff,0x20,0x3f,0xf0,0x04,0xff,0x2f,0xf2,0x03,
+0xff,0x00,0x4f,0xf2,0x0d,0x00,0x06,0x10,0xf0,0x3b,0x00,0x10,0x02,0x13,0x05,0x00,
+0x37,0x00,0xa0,0x02,0xff,0x10,0x2f,0xf1,0x2f,0xf1,0x02,0xff,0x22,0xe2,0x00,0x09,
+0x09,0x00,0x50,0x20,0x00,0x7d,0xfd,0x70,0x80,0x06,0xf0,0x0a,0x90,0x2f,0xf6,0x05,
+0xff,0x26,0xfe,0x00,0x0d,0xf6,0x7f,0xc0,0x00,0xcf,0x86,0xfe,0x00,0x0d,0xf7,0x2f,
+0xf5,0x05,0xff,0x30,0x9f,0x5f,0x06,0xf0,0x10,0x7d,0xfe,0x80,0x00,0x2f,0xf7,0xdf,
+0xb1,0x02,0xff,0xfd,0xff,0xb0,0x2f,0xf4,0x03,0xff,0x32,0xff,0x20,0x0d,0xf5,0x2f,
+0xf2,0x00,0xcf,0x72,0xff,0x20,0x0e,0xf5,0x3b,0x00,0x10,0x22,0xa4,0x04,0x48,0x2f,
+0xf7,0xdf,0xa1,0xff,0x00,0xf0,0x01,0x00,0x00,0x01,0xaf,0xe6,0xef,0x20,0xbf,0xff,
+0xff,0xf2,0x3f,0xf5,0x06,0xff,0x25,0xa8,0x02,0x32,0x7f,0xc0,0x02,0x09,0x00,0x41,
+0x2f,0xf5,0x06,0xff,0x1b,0x00,0x39,0x01,0xaf,0xd7,0x34,0x00,0x21,0x2f,0xf2,0xf2,
+0x0b,0xab,0xea,0x2f,0xff,0xfa,0x2f,0xfa,0x31,0x2f,0xf2,0x00,0x03,0x00,0xf0,0x17,
+0x02,0xae,0xfc,0x40,0x0d,0xfd,0xcf,0xf3,0x3f,0xf0,0x0a,0xd7,0x1f,0xfa,0x51,0x00,
+0x05,0xef,0xff,0x90,0x00,0x04,0x8f,0xf7,0x7f,0xb0,0x0a,0xf9,0x2f,0xfc,0xbf,0xf4,
+0x03,0xbf,0xfc,0x50,0x0b,0xf9,0xab,0x03,0x62,0xef,0xff,0xf0,0xae,0xfe,0xb0,0x0c,
+0x00,0x02,0x03,0x00,0x9e,0x0a,0xfa,0x00,0x07,0xff,0xf1,0x01,0xbf,0xe1,0xfa,0x01,
+0x14,0x3f,0x18,0x01,0xf0,0x01,0x1f,0xf4,0x06,0xff,0x20,0xdf,0xff,0xff,0xf2,0x02,
+0xcf,0xd6,0xff,0x20,0xbf,0x90,0x1c,0x03,0xf0,0x36,0x0c,0xf7,0x1f,0xf1,0x1f,0xf2,
+0x0c,0xf6,0x5f,0xd0,0x07,0xfa,0x9f,0x80,0x02,0xfe,0xdf,0x30,0x00,0xdf,0xfe,0x00,
+0x00,0x8f,0xf9,0x00,0x00,0x3f,0xf4,0x00,0xaf,0x70,0x1f,0xd0,0x0c,0xf6,0x6f,0xb0,
+0x5f,0xf1,0x0f,0xf2,0x2f,0xe0,0xaf,0xf5,0x2f,0xe0,0x0e,0xf1,0xee,0xfa,0x5f,0xa0,
+0x0b,0xf6,0xf8,0xce,0x8f,0x60,0x07,0xfe,0xf3,0x8f,0xef,0x30,0x03,0xff,0xf0,0x60,
+0x0a,0x40,0xff,0xa0,0x0f,0xfb,0xe2,0x0d,0xf0,0x1d,0x0a,0xf7,0x00,0x7f,0xe0,0x0c,
+0xfa,0x00,0xef,0x74,0xff,0x20,0x05,0xff,0xdf,0x80,0x00,0x0d,0xff,0xe1,0x00,0x00,
+0x7f,0xfa,0x00,0x00,0x0e,0xff,0xf2,0x00,0x07,0xfe,0xbf,0xa0,0x01,0xff,0x63,0xff,
+0x30,0x8f,0xd0,0x0a,0xfc,0x00,0xf0,0x41,0xcf,0x90,0x08,0xfd,0x07,0xfe,0x00,0xdf,
+0x70,0x1f,0xf2,0x1f,0xf2,0x00,0xcf,0x76,0xfc,0x00,0x06,0xfb,0xaf,0x70,0x00,0x1f,
+0xff,0xf2,0x00,0x00,0xbf,0xfc,0x00,0x00,0x06,0xff,0x60,0x00,0x00,0x1f,0xf1,0x00,
+0x00,0x08,0xfb,0x00,0x00,0x1f,0xff,0x50,0x00,0x01,0xee,0x70,0x00,0x00,0x4f,0xff,
+0xff,0xf7,0x4e,0xee,0xff,0xf5,0x00,0x00,0xdf,0xb0,0x00,0x08,0xfe,0x10,0x00,0x4f,
+0xf4,0x00,0x01,0xef,0x90,0x00,0x0a,0xfd,0x1c,0x00,0xf0,0x05,0xee,0xe8,0x6f,0xff,
+0xff,0xf9,0x00,0x05,0x80,0x00,0x7f,0xc0,0x00,0xff,0x10,0x02,0xfd,0x00,0x03,0xfc,
+0x03,0x00,0xe3,0x06,0xfa,0x00,0x7f,0xf3,0x00,0xaf,0xc0,0x00,0x09,0xf8,0x00,0x04,
+0xfc,0x15,0x00,0xd9,0x01,0xff,0x00,0x00,0xaf,0x90,0x00,0x0a,0xc0,0x00,0x00,0x00,
+0xab,0x01,0x00,0xf0,0x0c,0x01,0x57,0x00,0x07,0xfb,0x00,0x0c,0xf4,0x00,0x8f,0x70,
+0x08,0xf8,0x00,0x8f,0x80,0x05,0xfb,0x00,0x0c,0xfb,0x00,0x8f,0xe0,0x4f,0xd1,0x07,
+0x0f,0x00,0xf0,0x18,0x08,0xf7,0x00,0xaf,0x50,0x4f,0xe0,0x08,0xc2,0x00,0x00,0x00,
+0x00,0x01,0xae,0xa0,0x01,0x94,0x0a,0xff,0xfc,0x27,0xf6,0x0f,0xd1,0x8f,0xff,0xf1,
+0x1a,0x50,0x07,0xed,0x40,0x00,0x00,0x00,0x04,0x20,0x00,0x01,0x00,0x22,0x0e,0xe2,
+0x07,0x00,0xf0,0x03,0xfe,0x30,0x00,0x16,0x77,0x77,0x7f,0x7c,0xe3,0x00,0x6f,0xee,
+0xee,0xee,0x40,0xbf,0x30,0x7e,0x17,0x00,0x31,0x0b,0xf4,0x7e,0x43,0x00,0x11,0xfc,
+0x07,0x00,0xf2,0x00,0x1c,0xe2,0x6f,0xff,0xff,0xff,0x41,0xce,0x20,0x05,0x55,0x55,
+0x5f,0x8d,0xe2,0x38,0x00,0x11,0x20,0x07,0x00,0x11,0xd1,0x46,0x00,0x20,0x03,0x10,
+0x06,0x00,0x21,0x05,0xb0,0x0d,0x00,0x30,0x4f,0xf0,0x00,0x67,0x00,0x11,0xfc,0x07,
+0x00,0xe1,0x3f,0x95,0xfe,0xee,0xee,0xea,0x02,0xea,0x00,0x67,0x77,0x77,0xae,0x1e,
+0x21,0x00,0x31,0x7e,0x4f,0x60,0x07,0x00,0x21,0x08,0xf4,0x07,0x00,0xf1,0x04,0x00,
+0x9f,0x33,0xff,0xff,0xff,0xfd,0x00,0x0a,0xe8,0xf5,0x55,0x55,0x52,0x00,0x00,0xaf,
+0xf0,0x00,0x82,0x00,0x02,0x07,0x00,0x31,0x00,0x30,0x00,0x89,0x00,0x01,0x6e,0x00,
+0x20,0x3e,0xe3,0x6c,0x00,0xff,0x19,0xeb,0xbe,0x30,0x00,0x00,0x3e,0xb0,0x0b,0xf3,
+0x00,0x03,0xfb,0x00,0x00,0xbf,0x30,0x3f,0xb0,0x00,0x00,0x0b,0xf3,0xef,0xff,0x30,
+0x03,0xff,0xfe,0x35,0x5f,0x50,0x05,0xf5,0x53,0x00,0x0f,0x50,0x05,0xf0,0x00,0x06,
+0x00,0x01,0xfe,0x05,0x85,0x58,0xf0,0x00,0x00,0x0d,0xff,0xff,0xd0,0x00,0x00,0x03,
+0x55,0x55,0x30,0x00,0x00,0x0f,0xff,0xff,0x2a,0x00,0x0a,0x06,0x00,0xf0,0x08,0xce,
+0xef,0x50,0x05,0xfe,0xec,0xaf,0xb6,0x00,0x00,0x6b,0xfa,0x0a,0xf4,0x00,0x00,0x4f,
+0xb0,0x00,0xbf,0x40,0x04,0xfb,0x75,0x00,0x10,0x3f,0xd1,0x00,0x21,0xbf,0xfb,0xb0,
+0x00,0x26,0xb0,0x00,0x01,0x00,0x12,0x11,0x07,0x00,0x12,0x88,0xbc,0x00,0x11,0xff,
+0x1e,0x01,0x30,0x09,0xff,0x90,0x07,0x00,0x30,0x2f,0xcc,0xf2,0x07,0x00,0xb0,0xaf,
+0x44,0xfa,0x00,0x00,0x00,0x02,0xfb,0x00,0xbf,0x20,0x49,0x00,0x10,0x00,0x4a,0x00,
+0x90,0x3f,0xa0,0x00,0x0a,0xf3,0x00,0x00,0xbf,0x20,0x18,0x00,0xf0,0x01,0x04,0xf9,
+0x00,0x00,0x00,0x9f,0x40,0x0c,0xfe,0xdd,0xdd,0xdd,0xef,0xc0,0x5f,0xff,0x01,0x00,
+0x11,0xf5,0x4f,0x00,0x11,0x10,0x56,0x00,0xf0,0x47,0x9f,0xfc,0x10,0x00,0x00,0x02,
+0x26,0xf7,0x4d,0xb0,0x00,0x04,0xdf,0xbb,0xd0,0x07,0xf0,0x00,0x6f,0xc4,0x0d,0xf5,
+0x2c,0xd0,0x02,0xfa,0x00,0x0f,0xff,0xfe,0x30,0x0a,0xe0,0x00,0x3f,0xff,0xc6,0x60,
+0x0e,0x80,0x00,0x6f,0xf8,0x08,0xe0,0x0f,0x60,0x00,0x9e,0x40,0x06,0xf0,0x0e,0x80,
+0x00,0x71,0x00,0x08,0xe0,0x0a,0xd0,0x00,0x00,0x00,0x0d,0xa0,0x03,0xf8,0x00,0x00,
+0x00,0x8f,0x30,0x00,0x7f,0xa3,0x00,0x3a,0xf7,0x00,0x00,0x05,0xef,0xff,0xfe,0x50,
+0xb9,0x01,0x20,0x66,0x40,0x66,0x00,0xf0,0x13,0x66,0x66,0x63,0x00,0x00,0x00,0x20,
+0xcf,0xff,0xf2,0x50,0x00,0x03,0xf8,0x1e,0xff,0x65,0xf9,0x00,0x16,0xb8,0x03,0xfb,
+0x02,0xa7,0x70,0x6f,0xa0,0x00,0x51,0x00,0x3f,0xb0,0x49,0x9a,0x01,0x30,0x07,0x93,
+0xef,0x9a,0x01,0x40,0x08,0xf6,0x49,0x10,0x0e,0x00,0x31,0x71,0xaf,0x60,0x3d,0x02,
+0xf0,0x0b,0x36,0xa1,0x00,0x00,0x00,0x6b,0x30,0x0a,0xf8,0x20,0x00,0x06,0x8f,0x50,
+0x01,0x4c,0xe7,0x68,0x8f,0xb1,0x00,0x00,0x0a,0x6e,0xac,0xc6,0x62,0x00,0x36,0x06,
+0x44,0x40,0x2b,0x01,0xf0,0x24,0x8e,0x34,0x78,0x61,0x00,0x00,0x07,0xfd,0xff,0xfe,
+0xff,0x91,0x00,0x6f,0x70,0xbf,0x40,0x06,0xed,0x10,0x8f,0x50,0x0a,0xf5,0x00,0x2e,
+0xb0,0x0d,0xf6,0x00,0xed,0x00,0x03,0xf4,0x1f,0xcf,0x7a,0xf4,0x00,0x00,0xd9,0x3f,
+0x37,0xff,0x40,0x00,0x00,0xab,0x3f,0x20,0x53,0x16,0x03,0x20,0x1f,0x50,0x3d,0x00,
+0x30,0xd8,0x0b,0xc0,0xb2,0x00,0x20,0xf3,0x02,0xcb,0x00,0xf0,0x00,0x2e,0xa0,0x00,
+0x6f,0xb4,0x00,0x17,0xfc,0x10,0x00,0x03,0xcf,0xff,0xff,0x80,0x5f,0x01,0x21,0x56,
+0x40,0x8e,0x01,0x21,0x10,0x00,0xf5,0x01,0xf0,0x38,0xff,0xfa,0x00,0x2f,0xe9,0x99,
+0x9b,0xf4,0x00,0x7f,0x70,0x00,0x09,0xd0,0x00,0xcf,0x10,0x00,0x0f,0x70,0x00,0xfc,
+0x00,0x00,0x9f,0x10,0x00,0x9f,0x10,0x1c,0xd3,0x00,0x06,0xff,0x70,0xe9,0x00,0x00,
+0x3f,0x8c,0x75,0xf9,0x00,0x00,0xbc,0x0e,0x2c,0xaf,0x00,0x00,0xd9,0x2d,0x1a,0x3f,
+0x20,0x00,0xbc,0x01,0x00,0x6f,0x00,0x00,0x4f,0x80,0x04,0xe9,0x00,0x00,0x07,0xff,
+0xff,0xe9,0x01,0x31,0x27,0x74,0x00,0xc6,0x01,0x21,0xff,0xa0,0x06,0x00,0x90,0xb1,
+0x10,0x1f,0xee,0xed,0xdd,0xdd,0xf2,0x1d,0x15,0x00,0xd1,0xb2,0x1d,0x01,0x77,0x77,
+0x60,0xb2,0x1d,0x03,0xff,0xff,0xe0,0xb3,0x12,0x00,0x11,0xb3,0x12,0x00,0x12,0xb3,
+0x12,0x00,0x11,0x1e,0x12,0x00,0xc4,0x0e,0x11,0x11,0x11,0x11,0xb3,0x0d,0xdd,0xff,
+0xff,0xec,0xc2,0x48,0x00,0x31,0x7b,0xbb,0x70,0x47,0x03,0xf0,0x06,0xbd,0xdb,0x50,
+0x07,0x00,0x02,0xdf,0xff,0xff,0xf0,0x0f,0xd3,0x2f,0xfa,0x30,0x03,0x20,0x0e,0x4d,
+0xef,0x80,0x6d,0x03,0x31,0x00,0x8f,0x40,0x07,0x00,0x21,0x03,0xd9,0x07,0x00,0x30,
+0x00,0x1e,0x90,0x07,0x00,0x21,0x02,0xd7,0x0e,0x00,0x11,0x5d,0x1c,0x00,0x20,0x08,
+0xfd,0x43,0x00,0x40,0x0f,0xca,0xaf,0xa0,0x07,0x00,0x70,0x60,0x0d,0xfd,0x63,0x37,
+0x60,0x03,0x61,0x00,0x20,0xff,0xe0,0x11,0x01,0xf1,0x19,0x7a,0xa7,0x10,0xbd,0xef,
+0xfd,0xdd,0xdd,0xf1,0xc2,0x6f,0xe0,0x00,0x11,0xc2,0xc2,0x39,0x80,0x1a,0xff,0xf2,
+0xc2,0x16,0x52,0xef,0xff,0xf2,0xc2,0x6f,0xf0,0x19,0xff,0xf2,0xc2,0x5f,0xe0,0x00,
+0x11,0xb2,0xc2,0xc8,0x00,0x30,0xc2,0x5f,0xe0,0x06,0x00,0x20,0x6f,0xf0,0x06,0x00,
+0x20,0x15,0x40,0x06,0x00,0x21,0x4f,0xe0,0x18,0x00,0x00,0x12,0x00,0x70,0xcc,0xdf,
+0xfc,0xcc,0xcc,0xf1,0x01,0xc8,0x00,0x00,0x60,0x01,0x11,0x22,0x08,0x04,0xf1,0x42,
+0xbf,0xff,0xfa,0x20,0x00,0x00,0x7f,0xea,0xce,0x8d,0xf5,0x00,0x06,0xf9,0x03,0xbd,
+0x10,0xaf,0x30,0x1f,0xa0,0x04,0xbd,0x10,0x0c,0xd0,0x7f,0x10,0x04,0xce,0x10,0x03,
+0xf3,0xab,0x00,0x02,0xcc,0x00,0x00,0xe7,0xba,0x00,0x36,0x00,0xb9,0x00,0xc8,0xab,
+0x05,0xeb,0x76,0xc8,0xd3,0xe7,0x7f,0x8e,0x5c,0x61,0xbb,0x5d,0xf4,0x1f,0xd4,0xd5,
+0x00,0x05,0xdc,0xd0,0x06,0xff,0x30,0x00,0x00,0x9f,0x30,0x00,0x7f,0xc6,0x33,0x6d,
+0xf4,0x54,0x00,0x11,0xf9,0xfe,0x03,0x16,0x22,0x09,0x04,0x30,0x01,0xaf,0xfe,0x69,
+0x02,0x40,0x0c,0xd4,0x28,0xf5,0x64,0x04,0xf1,0x2a,0x20,0x00,0x9c,0x00,0x32,0x00,
+0x5f,0x00,0x00,0x6e,0x3e,0xff,0x90,0x3f,0x30,0x00,0xac,0xdf,0xff,0xf4,0x0c,0xe5,
+0x28,0xf5,0xff,0xff,0xf8,0x00,0xaf,0xff,0xd3,0xdf,0xff,0xf5,0x00,0xce,0xa9,0xff,
+0xff,0xff,0xb0,0x0a,0xd1,0x1d,0xff,0xff,0xff,0x70,0x1f,0x40,0xbf,0xff,0xff,0xff,
+0xf1,0x5e,0x05,0x55,0x03,0x20,0x7c,0x1b,0x07,0x00,0xb9,0xf7,0x6f,0xff,0xdd,0xdd,
+0xdd,0xdd,0xd6,0x02,0x22,0x00,0x01,0x00,0x22,0x06,0x90,0xc5,0x03,0x12,0xda,0x0f,
+0x00,0x22,0x1c,0xb0,0x0f,0x00,0xa1,0xcc,0x00,0x00,0x3c,0xbb,0xbb,0xba,0xbf,0xc1,
+0x00,0x9b,0x03,0x40,0xfd,0x10,0x14,0x44,0x01,0x00,0x21,0x30,0x03,0xa9,0x03,0xb2,
+0xf4,0x00,0x3e,0xfd,0xde,0xee,0xef,0xf4,0x00,0x02,0xea,0x37,0x00,0x22,0x1d,0xa0,
+0x37,0x00,0x13,0xdb,0x46,0x00,0x01,0x02,0x05,0x0b,0x69,0x00,0x22,0xee,0xb6,0x09,
+0x00,0x21,0x49,0xe8,0x0e,0x00,0x30,0xa4,0x19,0xd2,0x32,0x00,0x91,0x5b,0xd3,0x30,
+0x00,0x00,0x06,0xfc,0x60,0x45,0x55,0x05,0x80,0xbc,0x00,0x00,0x00,0x18,0xa8,0x9c,
+0x71,0x07,0x05,0xf0,0x10,0x00,0x01,0xcd,0x10,0x00,0x1e,0xf2,0x5f,0xd0,0x3f,0xc0,
+0x00,0x5f,0xf0,0xbf,0xf3,0x1f,0xf1,0x00,0x0d,0xf3,0x4e,0xb0,0x4f,0xa0,0x00,0x02,
+0xdd,0x10,0x02,0xdc,0x90,0x03,0x91,0xcb,0xab,0x60,0x00,0x00,0x01,0x33,0x33,0x32,
+0xe9,0x04,0xf0,0x0b,0xff,0x70,0x00,0x1f,0x63,0x33,0xc8,0xf7,0x00,0x1f,0x40,0x00,
+0xe0,0x6f,0x70,0x1f,0x40,0x00,0xed,0xd7,0xf1,0x1f,0x40,0x00,0x01,0x13,0x06,0x00,
+0x2f,0x00,0x03,0x06,0x00,0x0d,0x81,0x74,0x44,0x44,0x47,0xf1,0x0e,0xff,0xff,0x33,
+0x05,0x02,0xf8,0x05,0x20,0xbd,0xb4,0x07,0x00,0xf0,0x38,0x4d,0x41,0x3c,0x61,0x00,
+0x00,0x00,0xe2,0x00,0x01,0xed,0xe9,0x00,0x03,0xc0,0x00,0x00,0x10,0x0a,0x70,0x05,
+0xc0,0x00,0x00,0x01,0x01,0xe0,0x1e,0x30,0x02,0x69,0xdf,0x40,0xe0,0x88,0x09,0xef,
+0xfb,0x84,0x02,0xd0,0xc2,0x08,0x73,0x65,0x00,0x02,0xe2,0xc2,0x00,0x01,0xee,0x10,
+0x00,0x5a,0x95,0x00,0x0a,0xff,0x90,0x00,0x2c,0x3d,0x00,0x17,0x88,0x70,0x00,0x4a,
+0x08,0xd3,0xa1,0x02,0x87,0xd3,0x00,0x4c,0xed,0xde,0xee,0xed,0x40,0x19,0x01,0x22,
+0x02,0x10,0x57,0x06,0x13,0x60,0x07,0x00,0x11,0xb4,0x07,0x00,0xf1,0x18,0x64,0xf2,
+0x00,0x02,0x64,0x04,0xff,0xf6,0x80,0x00,0x6f,0xef,0x7e,0xa2,0x9e,0x00,0x01,0xf8,
+0x01,0x3f,0x50,0x4f,0x10,0x06,0xe0,0x00,0x0c,0xd7,0xdd,0x00,0x0b,0x90,0x00,0x01,
+0xcf,0xc2,0x00,0x0e,0x50,0x38,0x00,0x21,0x1f,0x20,0x07,0x00,0x12,0x3f,0x46,0x00,
+0x12,0x4f,0x07,0x00,0x16,0x6d,0x54,0x00,0x00,0xca,0x00,0xb1,0xde,0x60,0x0e,0x85,
+0xf1,0x0e,0x52,0xf1,0x06,0xff,0x90,0xbf,0x05,0x80,0x6f,0xe4,0xef,0xfb,0xdf,0xfb,
+0x5e,0xd3,0x1d,0x00,0x20,0x1e,0x82,0x40,0x01,0xf1,0x05,0xc6,0x00,0x00,0x5a,0xef,
+0xf8,0x00,0x01,0x7e,0xfc,0x07,0xcf,0xfe,0x92,0x1f,0xfb,0x50,0x00,0x08,0x20,0x58,
+0x01,0xf0,0x05,0xfb,0x0c,0xcc,0xcc,0xc8,0x03,0x90,0x00,0x1f,0xfb,0x00,0x06,0xff,
+0xb0,0x00,0x5f,0xf8,0x00,0x07,0xb0,0xad,0x01,0xe5,0xde,0x90,0x1f,0x75,0xd8,0x5e,
+0x00,0x7b,0x2f,0x74,0xd8,0x05,0xde,0x90,0xd0,0x00,0x20,0x4f,0xb0,0x70,0x00,0x71,
+0x21,0x6f,0x93,0x45,0x8b,0x00,0x0f,0x2f,0x02,0x70,0x00,0x08,0xaa,0xdf,0xa8,0x76,
+0x31,0x4b,0x04,0x20,0x10,0x4f,0x2a,0x02,0xf2,0x30,0xcf,0xef,0xff,0xe6,0x00,0x00,
+0x3d,0xff,0xb9,0xff,0xef,0xb0,0x03,0xff,0xef,0x05,0xfa,0x1c,0xf5,0x0d,0xf5,0xaf,
+0x3e,0xf1,0x06,0xfa,0x5f,0x80,0x9f,0xef,0x70,0x05,0xfa,0x9f,0x40,0x9f,0xf8,0x00,
+0x0d,0xf7,0x8f,0xef,0xff,0xc0,0x04,0xdf,0xd0,0x1d,0xff,0xaf,0xb5,0xff,0xfc,0x20,
+0x00,0x10,0x00,0x00,0xba,0x50,0x00,0x18,0x81,0x37,0x01,0x10,0xff,0xdf,0x05,0xa0,
+0x80,0x00,0x1f,0xf0,0x00,0x00,0x04,0xff,0x20,0x01,0x0f,0x00,0x21,0x0a,0xf9,0x0f,
+0x00,0x00,0xa3,0x07,0x01,0x95,0x06,0x60,0xef,0x40,0x0e,0xf3,0x00,0x20,0x17,0x00,
+0xf1,0x0b,0xbf,0x50,0x0d,0x40,0x00,0x6f,0xc0,0x08,0xfa,0x03,0xfe,0x00,0x04,0xff,
+0x00,0x3f,0xf8,0xdf,0x90,0x00,0x17,0x10,0x00,0xbf,0xff,0xf1,0xb8,0x02,0x22,0xbf,
+0xe4,0xbc,0x00,0x13,0x10,0xc4,0x00,0x31,0xa7,0x53,0x20,0x63,0x00,0x20,0xff,0xff,
+0x42,0x01,0x33,0x24,0x68,0xab,0xa7,0x07,0xc1,0x00,0x00,0x02,0xbb,0xbc,0xde,0xff,
+0x70,0x00,0x01,0xff,0xff,0x84,0x05,0x41,0x64,0x21,0x4f,0xf6,0x60,0x01,0x21,0xff,
+0x40,0xc2,0x07,0x20,0xfd,0x30,0x38,0x00,0x11,0xef,0x8e,0x04,0x40,0x2e,0xf8,0x1e,
+0xf4,0x0d,0x00,0xf5,0x04,0x90,0x08,0xfb,0x22,0x43,0x1e,0xfc,0x00,0x03,0xff,0xff,
+0xf9,0x04,0xc1,0x00,0x00,0x6b,0xdd,0xc6,0xfc,0x01,0x12,0xfe,0x08,0x00,0x21,0x1f,
+0xd0,0x45,0x00,0x60,0x23,0xfd,0x7b,0xa0,0xe9,0x10,0x64,0x03,0xf0,0x0b,0xfb,0x2d,
+0xff,0x70,0x2a,0xbc,0xfd,0x64,0x10,0x06,0xff,0x10,0x00,0x2f,0xb0,0x00,0x00,0x01,
+0x50,0x00,0x02,0xfe,0xac,0xed,0xa2,0x00,0xfe,0x05,0xf0,0x00,0xfd,0xff,0xf3,0x00,
+0x06,0xff,0xfc,0x10,0x00,0x7f,0xc0,0x04,0xfe,0x5f,0xc0,0x51,0x09,0xf0,0x0e,0xaf,
+0x60,0xfc,0x00,0x00,0x5f,0xe0,0x08,0xfc,0x7f,0xc0,0x45,0xaf,0xf8,0x00,0x1c,0xff,
+0xfa,0x0e,0xff,0xfa,0x00,0x00,0x07,0xcc,0x20,0x7a,0x83,0x00,0x20,0x06,0x13,0xb3,
+0x6a,0x00,0x12,0xf2,0x08,0x00,0xd2,0x3f,0xf0,0x00,0x08,0xf3,0x00,0x06,0x66,0xaf,
+0xfb,0xb7,0x08,0xfc,0xa8,0x01,0xb0,0x80,0xef,0x40,0x0a,0x97,0xef,0x51,0x6f,0xd0,
+0x8f,0xb0,0x52,0x00,0xf0,0x05,0x0f,0xf0,0x1f,0xf2,0x00,0x05,0xfb,0x00,0x0f,0xe0,
+0x0c,0xf7,0x00,0x0b,0xf6,0x00,0x1f,0xd0,0x05,0x60,0x17,0x0a,0x20,0x3f,0xc0,0x79,
+0x01,0x40,0xb0,0x00,0x7f,0x90,0xfc,0x07,0xb0,0x45,0x44,0xef,0x50,0x00,0x00,0x09,
+0xfd,0x09,0xff,0xfe,0xd0,0x00,0x4d,0x94,0x04,0xab,0x82,0xfb,0x03,0xa1,0x18,0xa0,
+0x00,0x00,0x1d,0xb2,0x00,0x08,0xe5,0xf5,0x78,0x00,0x71,0x01,0xf8,0x73,0x00,0x00,
+0x4f,0xd0,0x80,0x00,0x80,0x67,0xbf,0xeb,0xa6,0x0a,0xfa,0x00,0x1f,0x80,0x00,0xb0,
+0x62,0xff,0x20,0x0b,0x96,0xff,0x31,0x7f,0xb0,0xaf,0x90,0x19,0x01,0xc0,0x2f,0xd0,
+0x4f,0xf0,0x00,0x07,0xf9,0x00,0x2f,0xc0,0x0e,0xf5,0x13,0x0a,0xa0,0x3f,0xb0,0x08,
+0x60,0x00,0x2f,0xf0,0x00,0x5f,0xa0,0x1f,0x08,0x40,0x90,0x00,0x8f,0x70,0xa2,0x01,
+0xb0,0x35,0x34,0xef,0x30,0x00,0x00,0x0a,0xfc,0x0b,0xff,0xfd,0x94,0x02,0x41,0xb4,
+0x06,0xbc,0x92,0x74,0x00,0xc0,0x0a,0xd3,0x00,0x00,0x01,0x43,0x22,0xbf,0xb9,0xdb,
+0x00,0x2f,0x5d,0x00,0x62,0xa0,0x00,0x88,0x99,0x8c,0xf7,0xfb,0x00,0xd3,0xc6,0xad,
+0x04,0xff,0xee,0xff,0xff,0xff,0xd0,0x3c,0xdd,0xdc,0xbc,0xe9,0x09,0xf1,0x02,0xf3,
+0x00,0x05,0x61,0x00,0x3c,0xef,0xb0,0x00,0xef,0x00,0x04,0xce,0xf9,0x00,0x0f,0xe0,
+0xee,0x01,0xf3,0x03,0xef,0xa3,0x22,0x34,0x50,0x00,0x06,0xff,0xff,0xff,0xfc,0x00,
+0x00,0x03,0x9b,0xdd,0xcb,0x70,0xd3,0x00,0xf0,0x02,0x84,0x00,0x00,0x00,0x8c,0x50,
+0x08,0xb9,0xe0,0x03,0x21,0x18,0xfc,0x8c,0x7f,0x5b,0x20,0x64,0x00,0x83,0xf6,0x62,
+0x00,0x08,0x9a,0xaa,0xcf,0xa1,0xdb,0x01,0xf2,0x01,0x48,0xc0,0x00,0x2e,0xdc,0xcc,
+0xdf,0xff,0xff,0x20,0x01,0xef,0xff,0xfe,0xdf,0xf4,0x3a,0x00,0x91,0xdf,0x50,0x00,
+0x00,0x34,0x10,0x01,0xac,0xfc,0x18,0x09,0xf1,0x04,0x3e,0xff,0xc0,0x00,0x00,0xef,
+0x10,0x00,0x00,0x31,0x00,0x00,0x0c,0xf9,0x20,0x00,0x24,0x00,0x00,0x72,0x05,0x00,
+0x40,0x02,0x47,0x4a,0xdf,0xfe,0xda,0x46,0x01,0x20,0x0b,0x90,0x41,0x03,0xf0,0x02,
+0xf6,0x00,0x00,0x1b,0xff,0x70,0x00,0x02,0xdf,0xe4,0x00,0x00,0x4e,0xfc,0x10,0x00,
+0x05,0x5b,0x07,0x20,0x0f,0xfb,0xe2,0x01,0x70,0xfe,0x30,0x00,0x00,0x01,0xdf,0xf5,
+0x80,0x05,0x01,0x1f,0x08,0x21,0xaf,0xfa,0x97,0x09,0x10,0xc1,0xaf,0x01,0x10,0xfb,
+0xc6,0x08,0x02,0xcd,0x0a,0xa0,0x0d,0xc3,0x00,0x00,0x0e,0xf4,0x00,0x0f,0xf1,0x00,
+0x56,0x01,0xf0,0x01,0x2f,0xe0,0x00,0x00,0x0c,0xf3,0x00,0x4f,0xc0,0x05,0x43,0x3c,
+0xf8,0x86,0x5f,0x90,0x00,0x05,0xa0,0xf9,0x6f,0x80,0x09,0xbb,0xbe,0xfb,0x84,0x7f,
+0x70,0xed,0x08,0x31,0x00,0x8f,0x66,0xab,0x00,0xf3,0x18,0x7f,0xbf,0x20,0x00,0x0d,
+0xf2,0x00,0x6f,0xfd,0x00,0x00,0x0f,0xf0,0x00,0x4f,0xf8,0x00,0x00,0x6f,0xd0,0x00,
+0x1f,0xf4,0x00,0x03,0xff,0x60,0x00,0x0e,0xf2,0x00,0x7f,0xfc,0x00,0x00,0x04,0x40,
+0x00,0x4f,0x41,0x06,0x00,0x04,0x00,0x60,0x53,0x33,0x33,0x45,0x30,0x04,0x1a,0x01,
+0x7e,0x90,0x03,0xcd,0xde,0xed,0xdc,0x70,0x16,0x06,0x03,0x30,0x06,0x11,0xa0,0x39,
+0x04,0x01,0x05,0x03,0x21,0x5f,0xe0,0xa7,0x02,0x80,0xfd,0x75,0x56,0x78,0xb8,0x06,
+0xff,0xff,0x56,0x0c,0x92,0x28,0xac,0xcc,0xba,0x73,0x00,0x00,0x06,0xc9,0x6a,0x03,
+0x91,0x10,0x12,0x45,0x43,0x34,0xdf,0xcd,0xfa,0x8f,0x1e,0x00,0x51,0x5a,0xab,0xba,
+0xae,0xf7,0x61,0x06,0x31,0xfc,0x00,0x00,0xf4,0x03,0xf1,0x05,0x01,0x00,0x00,0x39,
 0xcf,0xc0,0x0f,0xf1,0x00,0x7f,0xff,0xe1,0x2f,0xd0,0x00,0x01,0x36,0x20,0x3f,0xd0,
-0x54,0x00,0x40,0xfa,0x42,0x23,0x57,0xa3,0x13,0x00,0xab,0x02,0x43,0x39,0xbd,0xdc,
+0x54,0x00,0x40,0xfa,0x42,0x23,0x57,0xe2,0x08,0x00,0xab,0x02,0x43,0x39,0xbd,0xdc,
 0xa7,0x7e,0x00,0x23,0x5f,0xf2,0x11,0x03,0x00,0xbf,0x0a,0x02,0xd6,0x0b,0x17,0xe0,
 0x06,0x00,0x16,0xd0,0x9c,0x00,0x25,0x4f,0xc0,0x06,0x00,0x70,0x30,0x5f,0xc0,0x00,
 0x00,0x06,0xf3,0x31,0x08,0xa0,0x7f,0xf9,0x1f,0xfa,0x44,0x7d,0xff,0xb0,0x08,0xff,
 0x91,0x07,0x81,0x00,0x6c,0xee,0xb8,0x10,0x00,0x09,0x94,0x04,0x01,0xf2,0x0c,0xff,
 0x60,0x00,0x25,0xf4,0x00,0x0d,0xf4,0x00,0x8f,0x3e,0xd0,0x00,0xdf,0x40,0x01,0xfb,
-0x5a,0x10,0x0e,0xf3,0x00,0x07,0x70,0x00,0x00,0xef,0x77,0x02,0x02,0x8e,0x03,0x01,
-0xcb,0x16,0x01,0x92,0x01,0x21,0x00,0x10,0xba,0x04,0x40,0x1e,0x60,0x0f,0xf4,0x91,
-0x14,0x60,0x00,0xcf,0xd4,0x35,0x9f,0xff,0x44,0x01,0x00,0xa3,0x14,0x41,0x04,0xbe,
-0xfd,0xa4,0x30,0x00,0x22,0x0c,0xf6,0xba,0x00,0x61,0xbf,0x51,0x11,0x10,0x4f,0xff,
-0x01,0x00,0x80,0x14,0xff,0xee,0xdd,0xff,0xdc,0xdd,0xd1,0xe1,0x1c,0x11,0xf4,0x28,
-0x01,0x12,0xdf,0x93,0x04,0x31,0xef,0xac,0xf7,0xd9,0x00,0x11,0xc0,0x1a,0x05,0x11,
-0x01,0xef,0x13,0x00,0x45,0x13,0x21,0xff,0xe0,0x3c,0x1c,0x21,0xbf,0xf9,0x4a,0x00,
-0x11,0x5e,0xfc,0x14,0x22,0x04,0xff,0x0e,0x03,0x3c,0x09,0xe7,0x10,0xa3,0x01,0x21,
-0x41,0xa8,0x7c,0x01,0x30,0x1e,0xa8,0xf2,0x4a,0x01,0x62,0xf0,0x7d,0x25,0x0c,0xee,
-0xef,0x35,0x04,0x01,0x7f,0x00,0x52,0xf8,0x02,0x21,0x00,0x00,0xcd,0x04,0x12,0x6d,
-0x5a,0x00,0x31,0x7f,0xfc,0xff,0x6e,0x02,0x31,0xf2,0x0c,0xf4,0xf7,0x02,0x10,0x30,
-0xb8,0x1a,0x00,0x7e,0x01,0x11,0xf4,0x78,0x00,0x11,0xdf,0x36,0x0c,0x00,0x94,0x0a,
-0x00,0x96,0x00,0x12,0x9e,0x3d,0x0c,0x32,0x07,0xfd,0x50,0x3c,0x03,0x03,0x75,0x00,
-0x51,0x33,0x00,0x00,0x9b,0x20,0x95,0x01,0x31,0x0c,0xf2,0x00,0x37,0x0e,0xc1,0xcf,
-0x20,0x00,0x00,0x1f,0xe2,0x34,0x6d,0xfb,0xba,0x2b,0xcd,0x79,0x00,0xe0,0xd2,0xff,
-0xff,0xfb,0x98,0x6e,0xf3,0x21,0x04,0x11,0xfe,0x00,0x00,0xdf,0x9c,0x00,0x20,0xe0,
-0x07,0xd2,0x09,0x50,0x01,0xfe,0x00,0xef,0xfc,0x55,0x01,0x43,0xe0,0x03,0x55,0x10,
-0x63,0x01,0x10,0x10,0x01,0x14,0x20,0xdc,0xdd,0x0b,0x00,0x10,0x3c,0x17,0x13,0x11,
-0x00,0x3d,0x08,0x00,0x57,0x10,0x41,0x11,0x23,0x46,0x20,0xd4,0x05,0x61,0xfe,0x10,
-0x00,0x0d,0xba,0x9d,0x3f,0x03,0x30,0x08,0xfe,0x40,0x4d,0x01,0x01,0xe1,0x19,0x71,
-0x4e,0xfd,0x67,0x89,0x9a,0x6d,0xef,0x49,0x09,0x70,0xff,0xdb,0xef,0xc5,0x32,0x22,
-0x11,0xd3,0x0c,0x00,0x2b,0x01,0x12,0xf5,0x2a,0x0b,0x12,0x70,0xce,0x00,0x20,0x95,
-0x33,0x7c,0x04,0x02,0x5d,0x01,0x36,0x04,0x9c,0xca,0x40,0x01,0x22,0x9c,0x70,0xb2,
-0x01,0x00,0x07,0x00,0x41,0x26,0x66,0xef,0xcd,0xc4,0x14,0x01,0xa9,0x0d,0x40,0x28,
-0x8b,0xfd,0x41,0x9b,0x00,0x30,0x08,0xf9,0x04,0x03,0x0d,0x91,0x0d,0xf5,0x04,0xed,
-0xcd,0xe5,0x00,0x2f,0xf1,0x30,0x00,0x00,0x43,0x13,0x01,0x7f,0x1c,0x21,0x6f,0x70,
-0xcf,0x10,0x21,0x8f,0x60,0x1c,0x14,0xf1,0x0a,0x7f,0xc4,0x34,0x64,0x1f,0xf7,0x00,
-0x2e,0xff,0xff,0xf9,0x17,0xc1,0x00,0x01,0x7a,0xbb,0xa4,0x00,0x03,0xa9,0x00,0x00,
-0x00,0x94,0x95,0x03,0xb1,0x0c,0x9a,0xd0,0x33,0x29,0xfd,0x9c,0x40,0x6f,0x4b,0x2e,
-0xad,0x09,0x63,0x71,0x00,0xab,0xbf,0xf8,0x52,0x35,0x07,0x80,0xbd,0xde,0xdb,0x00,
-0x00,0x6f,0xc0,0x0f,0x7c,0x00,0xa2,0x0b,0xf7,0x00,0x10,0x00,0x01,0x00,0x01,0xff,
-0x20,0x09,0x03,0x40,0xd0,0x0d,0xb0,0x00,0x59,0x1c,0x21,0x01,0xfc,0x2c,0x00,0xf0,
-0x0e,0x30,0x2f,0xf5,0x23,0x46,0x00,0x9f,0xd0,0x00,0xcf,0xff,0xff,0xf1,0x06,0xc6,
-0x00,0x00,0x6a,0xcc,0xba,0x00,0x00,0x00,0x25,0x79,0x84,0x00,0x04,0x9d,0x70,0x0a,
-0x84,0x7f,0xff,0xc8,0x43,0x6e,0xf7,0x1e,0x82,0x7d,0x03,0x21,0x05,0xfc,0xa9,0x04,
-0x10,0xf9,0xfd,0x00,0xc0,0xcf,0xf2,0x00,0x03,0xbc,0xff,0xfe,0x40,0x00,0x01,0xff,
-0xfd,0xfa,0x01,0x12,0x32,0x18,0x04,0x70,0x48,0xac,0xa7,0x10,0x00,0x02,0x7c,0x4a,
-0x01,0xb0,0x50,0x0d,0xff,0xff,0xb7,0x42,0x4c,0xff,0x20,0x8f,0xc6,0x29,0x02,0x12,
-0xf7,0xfc,0x0a,0x22,0x8f,0xb0,0xc0,0x05,0x13,0xfa,0xe6,0x07,0x02,0x34,0x0c,0x00,
-0xce,0x10,0x60,0x02,0x45,0x9e,0xff,0xe3,0x00,0xd9,0x18,0x20,0xfe,0x81,0x2d,0x02,
-0x30,0xeb,0x96,0x00,0xf5,0x1f,0x61,0x46,0x78,0xab,0xcd,0xe2,0xaf,0x0d,0x02,0xb2,
-0xf2,0x9f,0xdb,0x97,0x9f,0xf9,0x42,0x10,0x10,0x00,0x02,0xfd,0x02,0x12,0x0b,0x29,
-0x03,0x01,0xfb,0x02,0x04,0xc5,0x03,0x03,0xc1,0x0f,0x42,0x00,0x1f,0xf7,0x00,0xb8,
-0x0e,0x12,0xa3,0x9a,0x01,0x21,0xff,0xfa,0x6a,0x00,0x22,0xdf,0xf7,0xa9,0x00,0xa2,
-0x41,0x00,0x00,0x13,0x45,0x78,0x9b,0xcd,0xe2,0x0a,0x61,0x03,0x10,0x20,0x5c,0x00,
-0xc0,0xfa,0x42,0x20,0x01,0x00,0x00,0x2f,0xf4,0x03,0x3e,0x20,0x00,0x3e,0x01,0x21,
-0xe7,0xcc,0x97,0x02,0x31,0x06,0xe3,0x40,0x29,0x04,0x23,0x01,0x00,0xb6,0x1e,0x06,
-0x5f,0x00,0x43,0x00,0x9f,0xf9,0x20,0x60,0x00,0x11,0xe9,0x08,0x00,0x32,0x5d,0xff,
-0x70,0xda,0x00,0x56,0x51,0x00,0x00,0x00,0x40,0xce,0x03,0xf0,0x0d,0x07,0xfc,0x00,
-0x00,0x1a,0x20,0x01,0xff,0x40,0x07,0xff,0xb0,0x00,0x8f,0xc6,0xef,0xfb,0x20,0x00,
-0x1f,0xff,0xfb,0x30,0x00,0x00,0x4f,0xfc,0x40,0x56,0x00,0x01,0x22,0x0d,0x1d,0xf6,
-0x28,0x05,0x51,0xfc,0x64,0x45,0x68,0xb3,0x28,0x05,0xc2,0xf3,0x00,0x28,0xbc,0xdc,
-0xba,0x81,0x00,0x00,0x9b,0x40,0x00,0x72,0x03,0x00,0x1e,0x01,0x60,0x23,0xff,0x9c,
-0x02,0x60,0x00,0x2b,0x05,0xa0,0x0c,0xfe,0x70,0x4a,0xae,0xf8,0x30,0x02,0x9f,0xfa,
-0x6f,0x08,0x30,0xde,0x02,0xb2,0xc5,0x1e,0x12,0xdf,0x62,0x1e,0xf0,0x0e,0xdf,0x10,
-0x00,0x0d,0xf8,0x01,0x57,0xdf,0x10,0x00,0x8f,0xe0,0x5f,0xff,0xff,0xb3,0x00,0x3b,
-0x50,0xff,0x53,0xcf,0xff,0x90,0x00,0x01,0xfe,0x01,0xef,0x77,0x1f,0x30,0xcf,0xff,
-0xfe,0xef,0x1d,0x60,0x19,0xde,0xb3,0x00,0x00,0x02,0x4b,0x02,0x00,0xb0,0x02,0x20,
-0x00,0x10,0x0b,0x0b,0x30,0xf5,0x00,0xdf,0xad,0x1d,0x10,0xf2,0x26,0x02,0x22,0xe0,
-0x0e,0x5c,0x01,0x22,0x0f,0xd0,0x04,0x01,0x02,0xcc,0x01,0x22,0x2f,0xa4,0x78,0x07,
-0x30,0xcf,0x33,0x72,0x0e,0x00,0x31,0xfe,0x08,0xf4,0x8e,0x05,0x80,0x09,0xf8,0x00,
-0x02,0x42,0x0f,0xf6,0x06,0x3a,0x07,0x93,0x0d,0xf3,0x00,0x7d,0xff,0xff,0xe6,0x06,
-0x81,0x01,0x10,0x80,0x49,0xcc,0xa7,0x10,0x00,0x00,0x1a,0xff,0xb8,0x1e,0xf1,0x36,
-0x01,0xef,0xd6,0xff,0x58,0xff,0x60,0x0c,0xfa,0x02,0xff,0x00,0x5f,0xe1,0x6f,0xd0,
-0x05,0xfc,0x00,0x0c,0xf6,0xbf,0x60,0x09,0xf8,0x00,0x08,0xf9,0xef,0x30,0x0e,0xf4,
-0x00,0x07,0xfb,0xdf,0x30,0x4f,0xe0,0x00,0x09,0xf9,0xbf,0x90,0xcf,0x90,0x00,0x1f,
-0xf6,0x5f,0xff,0xfe,0x10,0x02,0xdf,0xd0,0x0a,0xff,0xf4,0x16,0xaf,0xff,0x30,0x00,
-0x57,0x20,0x1e,0xff,0xc1,0x5f,0x0c,0x91,0x62,0x00,0x00,0x04,0x74,0x00,0x00,0x04,
-0x86,0x3a,0x0a,0x40,0x00,0x7f,0xa0,0x00,0xf1,0x10,0xd0,0x06,0xf9,0x02,0x00,0xcf,
-0x20,0x7d,0xcb,0xdf,0xff,0xf0,0x0e,0xf0,0xc5,0x05,0x81,0xec,0x00,0xfd,0x00,0x00,
-0x11,0x7f,0x90,0xc0,0x00,0x70,0x05,0xf9,0x00,0x02,0xfa,0x10,0x00,0x77,0x08,0xf0,
-0x05,0x3f,0xbe,0x30,0x28,0x9b,0xfb,0x00,0x02,0xff,0xf1,0x6f,0xfe,0xff,0xf9,0x10,
-0x1f,0xfb,0x0e,0xf2,0x04,0x32,0x1d,0xf1,0x04,0x70,0xff,0x53,0xbf,0xca,0xf7,0x0d,
-0xf3,0x08,0xff,0xff,0xf5,0x07,0x00,0x8b,0x10,0x04,0x9b,0x94,0xe2,0x01,0x12,0x84,
-0x02,0x02,0x10,0x2e,0xbc,0x01,0x00,0x9b,0x07,0x21,0xff,0xf6,0x94,0x02,0x21,0xfe,
-0x29,0xdb,0x1c,0x50,0x9f,0xf3,0x00,0xbf,0xf3,0x80,0x02,0x80,0x70,0x00,0x0d,0xfe,
-0x20,0x00,0x1e,0xfb,0x2c,0x0a,0x40,0xe2,0x00,0x02,0xd1,0x2b,0x01,0x01,0x88,0x05,
-0x00,0xf8,0x02,0x13,0xe2,0xa4,0x06,0x03,0x7f,0x11,0x13,0x05,0x4f,0x04,0x12,0x6a,
-0x3c,0x12,0xb0,0xaa,0x5f,0x60,0x00,0x00,0x1d,0xfe,0x30,0x8f,0x4c,0xc0,0xa4,0x01,
-0xa0,0xe2,0x0e,0x81,0x00,0x00,0x0a,0xfe,0x5d,0xfd,0x10,0x3b,0x04,0x42,0xf4,0x01,
-0xef,0xc0,0x62,0x05,0x71,0x3f,0xfa,0x00,0x00,0x3f,0xfb,0x00,0x2d,0x08,0x32,0x07,
-0xf1,0x00,0x19,0x14,0x11,0x20,0xaa,0x04,0x13,0xa0,0x4a,0x06,0x22,0xc0,0x00,0x77,
-0x03,0x50,0x10,0x00,0x00,0x06,0xfa,0x7b,0x05,0x71,0x11,0x6f,0xa3,0x56,0x20,0x09,
-0xff,0x82,0x01,0xf0,0x05,0x49,0xaa,0xcf,0xd9,0x76,0x20,0x00,0x00,0x06,0xf8,0x00,
-0x01,0x02,0xec,0xbb,0xdf,0xed,0xef,0xc0,0x1f,0x2d,0x05,0x50,0xd9,0x00,0x00,0x01,
-0x6f,0xba,0x05,0x50,0x15,0x7a,0xfa,0x00,0x00,0x46,0x20,0xf3,0x0a,0xfb,0x50,0x00,
-0x2f,0xe5,0x26,0xff,0xff,0xd2,0x04,0xfd,0x10,0x8f,0xc4,0xdf,0xe0,0x0d,0xff,0xff,
-0xf7,0x00,0xa5,0x00,0x18,0xbd,0xfd,0x0d,0x11,0x01,0x07,0x04,0x00,0x65,0x01,0x01,
-0x5f,0x11,0x42,0xed,0xce,0xfd,0x00,0xd2,0x06,0x13,0xf5,0x97,0x0a,0x31,0xe0,0x01,
-0x53,0x50,0x05,0x31,0x80,0x02,0xfd,0x26,0x06,0xf0,0x17,0xfc,0x75,0xfb,0x00,0x00,
-0xdf,0xee,0xfd,0xdf,0xff,0xfa,0x00,0x09,0xf8,0x0e,0xf3,0x02,0x8f,0xff,0x90,0x0e,
-0xd0,0x7f,0xc0,0x00,0x0e,0xff,0xf1,0x1f,0xe6,0xff,0x40,0x00,0x9f,0xb6,0x90,0x0d,
-0xff,0x87,0x15,0x82,0x10,0x00,0x02,0xac,0x80,0x03,0xbf,0xf6,0x5e,0x03,0x23,0xde,
-0x40,0x71,0x00,0x01,0x73,0x01,0x03,0x5e,0x00,0xf1,0x08,0xaf,0x42,0x60,0x02,0x10,
-0x00,0xae,0xde,0xff,0xff,0x01,0xee,0x30,0x08,0xff,0xff,0xeb,0x80,0x0a,0xff,0x40,
-0x00,0x0a,0x86,0x01,0x30,0x10,0x3c,0xff,0x49,0x0a,0x41,0x60,0x2f,0xed,0xf6,0xa3,
-0x00,0x31,0xf3,0x2f,0xa0,0xbf,0x03,0xd2,0x24,0xf9,0x00,0x00,0x4a,0x50,0x06,0xfe,
-0xff,0x40,0x00,0x04,0xfd,0x7d,0x1a,0x90,0x6f,0xc0,0x00,0x02,0xdf,0x42,0x23,0x6e,
-0xf9,0x38,0x00,0x11,0xff,0x34,0x07,0x42,0x06,0xbc,0xcb,0xa6,0x34,0x07,0x50,0x97,
-0x00,0x00,0x03,0x97,0xd9,0x0b,0x00,0x0e,0x05,0x20,0x27,0xfc,0xb0,0x04,0xf1,0x34,
+0x5a,0x10,0x0e,0xf3,0x00,0x07,0x70,0x00,0x00,0xef,0x77,0x02,0x02,0x8e,0x03,0x21,
+0xff,0x20,0xd6,0x08,0x11,0xf1,0x82,0x04,0x00,0xba,0x04,0xe1,0x1e,0x60,0x0f,0xf4,
+0x00,0x00,0x2d,0xfe,0x00,0xcf,0xd4,0x35,0x9f,0xff,0x44,0x01,0x71,0xfd,0x20,0x00,
+0x04,0xbe,0xfd,0xa4,0x30,0x00,0x22,0x0c,0xf6,0xba,0x00,0x61,0xbf,0x51,0x11,0x10,
+0x4f,0xff,0x01,0x00,0x70,0x14,0xff,0xee,0xdd,0xff,0xdc,0xdd,0xe3,0x01,0x21,0x1b,
+0xf4,0x28,0x01,0x12,0xdf,0x93,0x04,0x31,0xef,0xac,0xf7,0xd9,0x00,0x31,0xc0,0x1f,
+0xf0,0xad,0x0b,0x11,0x37,0x1a,0x05,0x12,0x0b,0x63,0x02,0x41,0x00,0x07,0xbf,0xf9,
+0x4a,0x00,0x40,0x5e,0xfe,0x10,0x00,0x48,0x05,0x02,0x0e,0x03,0x3c,0x09,0xe7,0x10,
+0xa3,0x01,0x21,0x41,0xa8,0x7c,0x01,0x30,0x1e,0xa8,0xf2,0x4a,0x01,0x62,0xf0,0x7d,
+0x25,0x0c,0xee,0xef,0x35,0x04,0x01,0x7f,0x00,0x52,0xf8,0x02,0x21,0x00,0x00,0xcd,
+0x04,0x12,0x6d,0x5a,0x00,0x31,0x7f,0xfc,0xff,0x6e,0x02,0x31,0xf2,0x0c,0xf4,0xf7,
+0x02,0x41,0x30,0xdf,0x60,0x00,0x60,0x0a,0x11,0xf4,0x78,0x00,0x11,0xdf,0x36,0x0c,
+0x00,0x94,0x0a,0x00,0x96,0x00,0x12,0x9e,0x3d,0x0c,0x32,0x07,0xfd,0x50,0x3c,0x03,
+0x03,0x75,0x00,0x51,0x33,0x00,0x00,0x9b,0x20,0x95,0x01,0x31,0x0c,0xf2,0x00,0x37,
+0x0e,0xc1,0xcf,0x20,0x00,0x00,0x1f,0xe2,0x34,0x6d,0xfb,0xba,0x2b,0xcd,0x79,0x00,
+0xe0,0xd2,0xff,0xff,0xfb,0x98,0x6e,0xf3,0x21,0x04,0x11,0xfe,0x00,0x00,0xdf,0x9c,
+0x00,0x20,0xe0,0x07,0xd2,0x09,0x50,0x01,0xfe,0x00,0xef,0xfc,0x55,0x01,0x42,0xe0,
+0x03,0x55,0x10,0x63,0x01,0x00,0xde,0x05,0x40,0x0c,0xff,0xdc,0xdd,0x0b,0x00,0x30,
+0x3c,0xff,0xff,0xef,0x0e,0x00,0x3d,0x08,0x81,0x20,0x00,0x00,0x01,0x11,0x23,0x46,
+0x20,0xd4,0x05,0x61,0xfe,0x10,0x00,0x0d,0xba,0x9d,0x3f,0x03,0x30,0x08,0xfe,0x40,
+0x4d,0x01,0x10,0xfc,0x3e,0x00,0x71,0x4e,0xfd,0x67,0x89,0x9a,0x6d,0xef,0x49,0x09,
+0x70,0xff,0xdb,0xef,0xc5,0x32,0x22,0x11,0xd3,0x0c,0x00,0x2b,0x01,0x12,0xf5,0x2a,
+0x0b,0x12,0x70,0xce,0x00,0x20,0x95,0x33,0x7c,0x04,0x02,0x5d,0x01,0x36,0x04,0x9c,
+0xca,0x40,0x01,0x22,0x9c,0x70,0xb2,0x01,0x00,0x07,0x00,0x51,0x26,0x66,0xef,0xcd,
+0xe0,0x52,0x0f,0x00,0xa9,0x0d,0x40,0x28,0x8b,0xfd,0x41,0x9b,0x00,0x30,0x08,0xf9,
+0x04,0x03,0x0d,0x81,0x0d,0xf5,0x04,0xed,0xcd,0xe5,0x00,0x2f,0x99,0x06,0x00,0x4e,
+0x0f,0x10,0x00,0x31,0x07,0x21,0x70,0x6f,0xee,0x04,0xf0,0x0b,0x20,0x8f,0x60,0x00,
+0x00,0x08,0xfc,0x00,0x7f,0xc4,0x34,0x64,0x1f,0xf7,0x00,0x2e,0xff,0xff,0xf9,0x17,
+0xc1,0x00,0x01,0x7a,0xbb,0xa4,0xf0,0x31,0x00,0x03,0xa9,0x00,0x00,0x00,0x94,0x00,
+0x00,0x6f,0xd0,0x00,0x0c,0x9a,0xd0,0x33,0x29,0xfd,0x9c,0x40,0x6f,0x4b,0x2e,0xff,
+0xff,0xff,0xf4,0x00,0x71,0x00,0xab,0xbf,0xf8,0x52,0x00,0x00,0x00,0x00,0x02,0xff,
+0x00,0xbd,0xde,0xdb,0x00,0x00,0x6f,0xc0,0x0f,0xff,0xff,0xd0,0x00,0x0b,0xf7,0x00,
+0x10,0x00,0x01,0x00,0x01,0xff,0x20,0x00,0x01,0x00,0xb1,0x5f,0xd0,0x0d,0xb0,0x00,
+0x00,0x00,0x0b,0xf8,0x01,0xfc,0x2c,0x00,0xf0,0x1e,0x30,0x2f,0xf5,0x23,0x46,0x00,
+0x9f,0xd0,0x00,0xcf,0xff,0xff,0xf1,0x06,0xc6,0x00,0x00,0x6a,0xcc,0xba,0x00,0x00,
+0x00,0x25,0x79,0x84,0x00,0x04,0x9d,0xff,0xff,0xff,0xb0,0x7f,0xff,0xc8,0x43,0x6e,
+0xf7,0x1e,0x82,0x00,0x00,0x06,0xfc,0x41,0x00,0x11,0x05,0x06,0x00,0xf1,0x08,0x0b,
+0xf9,0x00,0x00,0x00,0x04,0xcf,0xf2,0x00,0x03,0xbc,0xff,0xfe,0x40,0x00,0x01,0xff,
+0xfd,0x60,0x00,0x00,0x00,0x32,0x63,0x00,0xf1,0x0e,0x01,0x48,0xac,0xa7,0x10,0x00,
+0x02,0x7c,0xff,0xff,0xff,0xff,0x50,0x0d,0xff,0xff,0xb7,0x42,0x4c,0xff,0x20,0x8f,
+0xc6,0x00,0x00,0x00,0x0d,0xf7,0x01,0x86,0x00,0x21,0x8f,0xb0,0x29,0x00,0x32,0x0a,
+0xfa,0x00,0xb1,0x00,0x11,0x70,0x59,0x00,0xf0,0x07,0xff,0xe1,0x00,0x00,0x02,0x45,
+0x9e,0xff,0xe3,0x00,0x00,0x00,0xef,0xff,0xfe,0x81,0x00,0x00,0x00,0x07,0xeb,0x96,
+0x1b,0x00,0x80,0x23,0x46,0x78,0xab,0xcd,0xe2,0xaf,0xff,0x01,0x00,0xd1,0xf2,0x9f,
+0xdb,0x97,0x9f,0xf9,0x42,0x10,0x10,0x00,0x02,0xff,0x40,0x8b,0x00,0x11,0xf6,0x46,
+0x00,0x21,0x1f,0xf0,0x07,0x00,0x22,0x4f,0xd0,0x07,0x00,0x12,0xf0,0x15,0x00,0x11,
+0xf7,0x07,0x00,0x31,0x09,0xff,0xa3,0x08,0x00,0x31,0xbf,0xff,0xfa,0x6a,0x00,0x22,
+0xdf,0xf7,0xa9,0x00,0xb1,0x41,0x00,0x00,0x13,0x45,0x78,0x9b,0xcd,0xe2,0x0a,0xff,
+0x01,0x00,0x10,0x20,0x5c,0x00,0xc0,0xfa,0x42,0x20,0x01,0x00,0x00,0x2f,0xf4,0x03,
+0x3e,0x20,0x00,0x3e,0x01,0xf0,0x01,0xe7,0xcc,0x00,0x00,0x01,0xff,0x00,0x06,0xe3,
+0x40,0x00,0x00,0x3f,0xd0,0x00,0x01,0xf9,0x00,0x28,0xff,0x00,0x5f,0x00,0x43,0x00,
+0x9f,0xf9,0x20,0x60,0x00,0x11,0xe9,0x08,0x00,0x32,0x5d,0xff,0x70,0xda,0x00,0x41,
+0x51,0x00,0x00,0x00,0xa5,0x00,0x11,0x0c,0xa5,0x00,0xf0,0x0d,0x07,0xfc,0x00,0x00,
+0x1a,0x20,0x01,0xff,0x40,0x07,0xff,0xb0,0x00,0x8f,0xc6,0xef,0xfb,0x20,0x00,0x1f,
+0xff,0xfb,0x30,0x00,0x00,0x4f,0xfc,0x40,0x56,0x00,0x66,0x80,0x00,0x00,0x00,0x0e,
+0xf6,0xc7,0x00,0x21,0x5f,0xe0,0x66,0x00,0x60,0xfc,0x64,0x45,0x68,0xb3,0x06,0xa1,
+0x00,0xb1,0xf3,0x00,0x28,0xbc,0xdc,0xba,0x81,0x00,0x00,0x9b,0x40,0x61,0x00,0x20,
+0xdf,0x30,0x1e,0x01,0xf0,0x11,0x23,0xff,0x9c,0x02,0x60,0x00,0x8f,0xff,0xff,0xff,
+0x0c,0xfe,0x70,0x4a,0xae,0xf8,0x30,0x02,0x9f,0xfa,0x00,0x1f,0xd0,0x00,0xde,0x02,
+0xb2,0x00,0x9f,0x70,0x00,0xdf,0x63,0x01,0xf1,0x22,0x10,0x00,0xdf,0x10,0x00,0x0d,
+0xf8,0x01,0x57,0xdf,0x10,0x00,0x8f,0xe0,0x5f,0xff,0xff,0xb3,0x00,0x3b,0x50,0xff,
+0x53,0xcf,0xff,0x90,0x00,0x01,0xfe,0x01,0xef,0x8f,0xf3,0x00,0x00,0xcf,0xff,0xfe,
+0x03,0x70,0x00,0x00,0x19,0xde,0xb3,0x00,0x00,0x02,0x52,0x60,0x00,0xf0,0x01,0x08,
+0xf9,0x00,0x10,0x00,0x00,0x10,0x0a,0xf5,0x00,0xdf,0xff,0xff,0xf0,0x0c,0xf2,0x26,
+0x02,0x22,0xe0,0x0e,0x5c,0x01,0x22,0x0f,0xd0,0x04,0x01,0x02,0xcc,0x01,0x21,0x2f,
+0xa4,0x07,0x00,0x40,0x3f,0xcf,0x33,0x72,0x0e,0x00,0x30,0xfe,0x08,0xf4,0x1c,0x00,
+0x80,0xfa,0x09,0xf8,0x00,0x02,0x42,0x0f,0xf6,0xbd,0x00,0xf0,0x09,0xf6,0x0d,0xf3,
+0x00,0x7d,0xff,0xff,0xe6,0x06,0x81,0x00,0x00,0x01,0x10,0x00,0x00,0x00,0x49,0xcc,
+0xa7,0x10,0x00,0x00,0x1a,0x1b,0x00,0xf0,0x38,0x00,0x01,0xef,0xd6,0xff,0x58,0xff,
+0x60,0x0c,0xfa,0x02,0xff,0x00,0x5f,0xe1,0x6f,0xd0,0x05,0xfc,0x00,0x0c,0xf6,0xbf,
+0x60,0x09,0xf8,0x00,0x08,0xf9,0xef,0x30,0x0e,0xf4,0x00,0x07,0xfb,0xdf,0x30,0x4f,
+0xe0,0x00,0x09,0xf9,0xbf,0x90,0xcf,0x90,0x00,0x1f,0xf6,0x5f,0xff,0xfe,0x10,0x02,
+0xdf,0xd0,0x0a,0xff,0xf4,0x16,0xaf,0xff,0x30,0x00,0x57,0x20,0x1e,0xff,0xc1,0x00,
+0x9b,0x01,0xf1,0x20,0x62,0x00,0x00,0x04,0x74,0x00,0x00,0x04,0x86,0x00,0x00,0x8f,
+0x80,0x00,0x00,0x7f,0xa0,0x00,0x0a,0xf4,0x00,0x00,0x06,0xf9,0x02,0x00,0xcf,0x20,
+0x7d,0xcb,0xdf,0xff,0xf0,0x0e,0xf0,0x08,0xff,0xff,0xff,0xec,0x00,0xfd,0x00,0x00,
+0x11,0x7f,0x90,0xc0,0x00,0xf1,0x27,0x05,0xf9,0x00,0x02,0xfa,0x10,0x00,0x00,0x5f,
+0xa0,0x00,0x3f,0xbe,0x30,0x28,0x9b,0xfb,0x00,0x02,0xff,0xf1,0x6f,0xfe,0xff,0xf9,
+0x10,0x1f,0xfb,0x0e,0xf2,0x04,0xff,0xfe,0x30,0xff,0x70,0xff,0x53,0xbf,0xca,0xf7,
+0x0d,0xf3,0x08,0xff,0xff,0xf5,0x07,0x00,0x8b,0x10,0x04,0x9b,0x94,0xe2,0x01,0x12,
+0x84,0x02,0x02,0x31,0x2e,0xff,0x80,0x52,0x02,0x31,0xdf,0xff,0xf6,0x94,0x02,0x40,
+0xfe,0x29,0xff,0x50,0x19,0x02,0x40,0xf3,0x00,0xbf,0xf3,0x80,0x02,0xf0,0x01,0x70,
+0x00,0x0d,0xfe,0x20,0x00,0x1e,0xfb,0x00,0x00,0x02,0xef,0xe2,0x00,0x02,0xd1,0x2b,
+0x01,0x32,0xfe,0x20,0x00,0xf8,0x02,0x22,0xe2,0x00,0x9b,0x03,0x22,0xb0,0x00,0x11,
+0x00,0x12,0x00,0x01,0x00,0x10,0x6a,0x05,0x00,0xd0,0x30,0x00,0xaa,0x5f,0x60,0x00,
+0x00,0x1d,0xfe,0x30,0x8f,0x4c,0xc0,0xa4,0x01,0x90,0xe2,0x0e,0x81,0x00,0x00,0x0a,
+0xfe,0x5d,0xfd,0x43,0x01,0xf0,0x02,0x7f,0xf4,0x01,0xef,0xc0,0x00,0x00,0x06,0xff,
+0x70,0x00,0x3f,0xfa,0x00,0x00,0x3f,0xfb,0x4f,0x00,0x40,0xa0,0x00,0x07,0xf1,0x1c,
+0x00,0x40,0xfa,0x00,0x00,0x20,0x66,0x03,0x32,0xff,0xa0,0x00,0x9e,0x02,0x22,0xc0,
+0x00,0x77,0x03,0x40,0x10,0x00,0x00,0x06,0x09,0x03,0x81,0x33,0x11,0x6f,0xa3,0x56,
+0x20,0x09,0xff,0x82,0x01,0xf0,0x15,0x49,0xaa,0xcf,0xd9,0x76,0x20,0x00,0x00,0x06,
+0xf8,0x00,0x01,0x02,0xec,0xbb,0xdf,0xed,0xef,0xc0,0x1f,0xff,0xff,0xff,0xfe,0xd9,
+0x00,0x00,0x01,0x6f,0x90,0x00,0x00,0x00,0x15,0x7a,0xfa,0x56,0x00,0xf2,0x0e,0xff,
+0xff,0xfb,0x50,0x00,0x2f,0xe5,0x26,0xff,0xff,0xd2,0x04,0xfd,0x10,0x8f,0xc4,0xdf,
+0xe0,0x0d,0xff,0xff,0xf7,0x00,0xa5,0x00,0x18,0xbd,0xb6,0x00,0x57,0x03,0x01,0x07,
+0x04,0x00,0x65,0x01,0x10,0x30,0xf4,0x02,0x32,0xed,0xce,0xfd,0x18,0x00,0x32,0x0c,
+0xf5,0x00,0x24,0x02,0x30,0xe0,0x01,0x53,0x08,0x00,0xf2,0x2c,0xaf,0x80,0x02,0xfd,
+0x00,0x00,0x07,0xdf,0xff,0xfc,0x75,0xfb,0x00,0x00,0xdf,0xee,0xfd,0xdf,0xff,0xfa,
+0x00,0x09,0xf8,0x0e,0xf3,0x02,0x8f,0xff,0x90,0x0e,0xd0,0x7f,0xc0,0x00,0x0e,0xff,
+0xf1,0x1f,0xe6,0xff,0x40,0x00,0x9f,0xb6,0x90,0x0d,0xff,0xfa,0x00,0x07,0xff,0x10,
+0x00,0x02,0xac,0x80,0x03,0xbf,0xf6,0x5e,0x03,0x23,0xde,0x40,0x71,0x00,0x01,0x73,
+0x01,0x03,0x5e,0x00,0xf1,0x08,0xaf,0x42,0x60,0x02,0x10,0x00,0xae,0xde,0xff,0xff,
+0x01,0xee,0x30,0x08,0xff,0xff,0xeb,0x80,0x0a,0xff,0x40,0x00,0x0a,0x86,0x01,0x20,
+0x10,0x3c,0x93,0x00,0x51,0x0a,0x60,0x2f,0xed,0xf6,0xa3,0x00,0x31,0xf3,0x2f,0xa0,
+0xbf,0x03,0xf0,0x02,0x24,0xf9,0x00,0x00,0x4a,0x50,0x06,0xfe,0xff,0x40,0x00,0x04,
+0xfd,0x00,0x0b,0xff,0xe0,0x3e,0x05,0xa0,0x00,0x02,0xdf,0x42,0x23,0x6e,0xf9,0x00,
+0x00,0x09,0x07,0x01,0x00,0x1a,0x01,0x41,0xbc,0xcb,0xa6,0x10,0x64,0x00,0x81,0x97,
+0x00,0x00,0x03,0x97,0x00,0x02,0xfe,0x0e,0x05,0x20,0x27,0xfc,0xb0,0x04,0xf0,0x34,
 0x9e,0xff,0xff,0xd5,0x00,0x00,0xaf,0xfe,0x9f,0xfb,0xff,0x70,0x03,0xff,0xd0,0x3f,
 0xd0,0x4f,0xf2,0x0d,0xfe,0xf2,0xaf,0x70,0x09,0xf8,0x7f,0x87,0xfb,0xff,0x10,0x05,
 0xfb,0xbf,0x21,0xef,0xf9,0x00,0x05,0xfb,0xdf,0x00,0x9f,0xf2,0x00,0x0a,0xf8,0xcf,
 0x77,0xff,0xf9,0x00,0x5f,0xf4,0x6f,0xff,0xf7,0x81,0x4a,0xff,0x90,0x07,0xca,0x30,
-0x0d,0xff,0xf8,0xd2,0x07,0x15,0xc8,0x4d,0x21,0x02,0x13,0x22,0x00,0x07,0x00,0x10,
-0x70,0xb5,0x01,0x32,0x74,0xbf,0x62,0xec,0x13,0x00,0xcf,0x0c,0x41,0x02,0x58,0xff,
-0xbb,0xbb,0x00,0x01,0x8f,0x07,0x80,0x3a,0x75,0xfd,0x23,0x41,0xbe,0x20,0x5f,0xd6,
-0x0e,0x90,0x9f,0xb0,0x03,0x6b,0xfe,0xba,0x90,0x1f,0xf1,0xc9,0x01,0x00,0x96,0x08,
-0x21,0x06,0xfa,0x87,0x1a,0x50,0x03,0xff,0x73,0x36,0xef,0x64,0x23,0x03,0xcc,0x00,
-0x26,0xbd,0xca,0xc8,0x21,0x20,0xc8,0x52,0xcf,0x03,0x00,0xd9,0x08,0x53,0x01,0x00,
-0x37,0xad,0xf6,0x4b,0x01,0x21,0x0c,0xf3,0xbe,0x08,0x80,0xf1,0x05,0x8a,0x84,0x00,
-0x0f,0xf7,0xef,0xac,0x17,0xd1,0xff,0xd7,0x42,0x6e,0xf8,0x4f,0xf9,0x00,0x00,0x06,
-0xfd,0x3b,0x90,0xcf,0x04,0x00,0x38,0x07,0x80,0xf9,0x00,0x48,0x76,0x9c,0xff,0xf2,
-0x00,0x2c,0x19,0x69,0x20,0x00,0x08,0x89,0x86,0x20,0x14,0x10,0x11,0xfa,0xe4,0x06,
-0xf1,0x0c,0x71,0xaf,0xfa,0x10,0x09,0xf6,0xdf,0xef,0xfd,0x00,0xbf,0xee,0x40,0x1e,
-0xf6,0x0d,0xff,0x30,0x00,0x7f,0xb0,0xdf,0xb0,0x00,0x04,0xfe,0x0e,0x32,0x0c,0xf0,
-0x00,0xef,0x20,0x00,0x05,0xfd,0x0d,0xf2,0x00,0x00,0x8f,0xa0,0x33,0x00,0x00,0x2e,
-0xa0,0x01,0xb0,0x3d,0xfc,0x00,0x00,0x26,0xbf,0xfe,0x20,0x00,0x0c,0xff,0x6e,0x06,
-0x21,0x2a,0x61,0xec,0x01,0x62,0x11,0x12,0x24,0x20,0x00,0x06,0xc7,0x07,0x31,0x5d,
-0xcb,0xad,0x55,0x08,0x00,0x11,0x22,0x00,0x5a,0x08,0x02,0xef,0x02,0x20,0x99,0x62,
-0x1e,0x0b,0x00,0xcf,0x00,0x70,0x2d,0xfd,0x51,0x00,0x6f,0xf6,0x3f,0xc5,0x04,0xf0,
-0x06,0x5f,0xc0,0xc9,0x09,0xff,0xe5,0x02,0xfe,0x00,0x06,0xfb,0x8e,0xf3,0x7f,0xb0,
-0x00,0x8f,0x80,0x7f,0xdf,0xf5,0xfe,0x0d,0x00,0x65,0x1c,0x47,0x02,0x8b,0xca,0x81,
-0xb3,0x00,0x23,0xaf,0x90,0xd7,0x05,0x11,0x60,0x67,0x02,0x60,0x24,0xcf,0x80,0x17,
-0xb9,0x30,0x7e,0x13,0xc0,0x96,0xff,0xff,0xe1,0x00,0x09,0xb9,0xef,0xcf,0xc5,0x4f,
-0xf4,0xf5,0x01,0x11,0xf9,0x25,0x01,0x10,0x07,0xde,0x03,0x42,0xf1,0x00,0x00,0x3f,
-0x36,0x0b,0x40,0x01,0xdf,0xfd,0x00,0x5c,0x0c,0xa0,0x0b,0xfb,0xfd,0x00,0x00,0x2f,
-0xd0,0x00,0x1f,0xe2,0xdb,0x1c,0x41,0xd1,0x77,0x05,0x50,0xe3,0x1c,0x11,0xf9,0xe4,
-0x08,0x50,0x0c,0xff,0xd3,0x00,0x01,0x4e,0x22,0x18,0x31,0x78,0x00,0x18,0x80,0x78,
-0x00,0x20,0x01,0x13,0x9a,0x24,0x01,0xf6,0x13,0x90,0x91,0x7a,0xca,0x60,0x00,0x0a,
-0xda,0xef,0x8f,0xa4,0x0c,0x00,0xfb,0x24,0x81,0x62,0x15,0xef,0x90,0x00,0x07,0xff,
-0x90,0x26,0x24,0x21,0x3f,0xfd,0xff,0x06,0x31,0x01,0xef,0xfd,0xe0,0x07,0x30,0x0b,
-0xfa,0xfd,0x1a,0x06,0xf1,0x01,0xa0,0x1e,0xe1,0xfe,0x00,0x00,0x5d,0xfe,0x10,0x04,
-0x40,0xfe,0x00,0x8f,0xff,0xd3,0xc5,0x06,0x20,0x3f,0xc7,0x59,0x00,0x12,0x99,0x32,
-0x03,0x31,0x00,0x4c,0x80,0x9b,0x10,0x30,0x7f,0xa3,0x56,0x1a,0x18,0x01,0x92,0x0c,
-0x60,0x1a,0xbd,0xfe,0xa9,0x87,0x40,0x13,0x0c,0xf1,0x0f,0x10,0x00,0x02,0x50,0x00,
-0x6f,0xff,0xfe,0x33,0xaf,0xf1,0x04,0xff,0xd8,0x9f,0xff,0xfd,0x81,0x4f,0xf8,0x01,
-0xaf,0xfb,0x40,0x00,0x3d,0x90,0x4e,0xff,0xf0,0xb7,0x07,0x20,0x5d,0xf0,0x45,0x03,
-0x30,0xf8,0x09,0xb0,0x63,0x07,0x60,0xfb,0x20,0x13,0x56,0x00,0x00,0x0a,0x0c,0x00,
-0xf6,0x09,0x21,0x39,0xbc,0x47,0x08,0x33,0x00,0x2c,0x50,0xdb,0x00,0x13,0xe1,0xeb,
-0x07,0x12,0x40,0x83,0x04,0x01,0x70,0x16,0x03,0xb8,0x19,0x06,0x72,0x01,0x42,0x02,
-0xff,0xce,0xe3,0xb0,0x07,0x00,0xf2,0x01,0x00,0xf8,0x1b,0xa0,0x04,0xfd,0x00,0x09,
-0x60,0x00,0x8f,0xd0,0x02,0xfd,0x48,0x0b,0xf1,0x00,0xef,0x50,0x01,0xfe,0x00,0x7f,
-0xc0,0x06,0xfe,0x00,0x00,0xff,0x78,0xff,0x40,0xbd,0x1e,0xa4,0xff,0xf8,0x00,0x05,
-0xa4,0x00,0x00,0x2a,0xda,0x50,0x85,0x24,0xf1,0x01,0xff,0xee,0xee,0xee,0xff,0xb0,
-0x4f,0xee,0xee,0xee,0xef,0xfe,0x10,0x00,0x01,0x43,0x75,0x00,0xa0,0x5f,0xc2,0xef,
-0x70,0x00,0x00,0x05,0xfb,0x9f,0x90,0x8e,0x02,0x25,0x90,0x40,0x32,0x04,0x00,0x9b,
-0x1d,0x00,0xc4,0x01,0x01,0x38,0x16,0x02,0xb8,0x07,0x27,0x03,0x30,0x95,0x01,0x30,
-0x01,0xfe,0xee,0x4a,0x00,0x22,0xa0,0x1f,0x23,0x08,0x20,0x10,0x11,0x24,0x0b,0x00,
-0x2e,0x00,0x50,0x05,0xb9,0x01,0xdf,0x90,0x66,0x11,0x30,0xc3,0xef,0xc0,0xe8,0x02,
-0x31,0xfb,0x4e,0xb0,0xae,0x03,0x21,0xa0,0x10,0x55,0x03,0x19,0xf7,0xf1,0x00,0x21,
-0xbf,0xd0,0x0e,0x00,0x22,0xcf,0xf3,0x15,0x00,0x12,0xf5,0xb1,0x11,0x16,0xa2,0x67,
-0x00,0x02,0x94,0x0b,0x11,0xf4,0xa9,0x10,0x10,0xf6,0xad,0x0b,0x00,0x9a,0x0a,0xf2,
-0x05,0x4c,0xff,0xc1,0x00,0x04,0x9e,0xff,0xff,0x40,0x00,0x3f,0xff,0xd6,0xef,0x40,
-0x00,0x09,0x93,0x00,0xef,0xf1,0x0b,0x0d,0x06,0x00,0x23,0xff,0x50,0xaf,0x00,0x22,
-0xa1,0x00,0x89,0x06,0x02,0x6e,0x10,0x22,0xef,0xf3,0xde,0x00,0x12,0xd2,0x97,0x08,
-0x00,0x34,0x04,0x11,0x38,0xba,0x10,0x50,0x08,0xef,0xff,0xda,0xfe,0x0b,0x01,0x21,
-0xfb,0x50,0x66,0x08,0x13,0x61,0x09,0x01,0x04,0x75,0x08,0x0c,0x0f,0x00,0x13,0x06,
-0xf3,0x08,0x22,0x4b,0xb0,0x64,0x01,0x12,0x10,0xa8,0x0d,0x00,0x05,0x00,0x72,0x22,
-0x25,0xff,0x32,0x23,0x20,0x3f,0xdf,0x17,0x91,0x2f,0xfb,0xbb,0xbb,0xbb,0xcf,0xf4,
-0x2f,0xe0,0x8e,0x24,0x01,0x07,0x00,0x21,0x8f,0xc0,0x78,0x0d,0x40,0xef,0x70,0x04,
-0x40,0x48,0x00,0x11,0x10,0xe0,0x08,0x12,0xf9,0xfb,0x06,0x10,0xd0,0x59,0x06,0x31,
-0xcf,0xfd,0x20,0x89,0x11,0x11,0xa1,0x70,0x00,0x17,0xa3,0x0f,0x0f,0x61,0xdc,0xcc,
-0xcc,0xcd,0xd0,0x0d,0xaf,0x13,0x64,0x01,0x10,0x2f,0xf1,0x01,0x10,0xe8,0x09,0x0c,
-0x06,0x00,0x61,0x8c,0xcc,0xcf,0xfc,0xcc,0xc9,0x22,0x0a,0x21,0xfb,0x22,0x01,0x00,
-0x01,0xd6,0x15,0x41,0x11,0x20,0x0c,0xff,0x3e,0x00,0x03,0x07,0x00,0x03,0x6c,0x27,
-0x0f,0x07,0x00,0x10,0x81,0x45,0x44,0x46,0xff,0x54,0x44,0x54,0xcf,0x38,0x00,0x30,
-0xfc,0xbd,0xcc,0x01,0x00,0x10,0xdb,0xee,0x00,0x01,0xa9,0x01,0x01,0x18,0x0c,0x00,
-0xb4,0x11,0x20,0x0c,0xcc,0x44,0x16,0x01,0x51,0x14,0x10,0xfe,0x68,0x01,0x11,0xc0,
-0x23,0x07,0x10,0xc0,0xd7,0x08,0xf1,0x03,0x4f,0xd0,0x00,0x06,0xff,0xe3,0x0f,0xd0,
-0x00,0x4f,0xfa,0x10,0x0f,0xd0,0x00,0x07,0x50,0x3c,0x94,0x01,0x27,0x2f,0xff,0x39,
-0x15,0x25,0x03,0xff,0x23,0x12,0x11,0x01,0xd0,0x0c,0x12,0x11,0x67,0x02,0x80,0xf9,
+0x0d,0xff,0xf8,0x5a,0x00,0x45,0x03,0xc8,0x20,0x00,0x01,0x00,0x22,0x8f,0x90,0x07,
+0x00,0x10,0x70,0xb5,0x01,0xf1,0x02,0x74,0xbf,0x62,0x30,0x00,0x00,0x0f,0xff,0xff,
+0xff,0xf1,0x00,0x00,0x02,0x58,0xff,0xbb,0xbb,0x00,0x10,0xfe,0x05,0x00,0xf0,0x06,
+0x3a,0x75,0xfd,0x23,0x41,0xbe,0x20,0x5f,0xff,0xff,0xff,0xf0,0x9f,0xb0,0x03,0x6b,
+0xfe,0xba,0x90,0x1f,0xf1,0xc9,0x01,0x31,0x00,0x0d,0xf4,0xea,0x01,0xc3,0x1f,0xf3,
+0x00,0x03,0xff,0x73,0x36,0xef,0xd0,0x00,0x00,0xaf,0xcc,0x00,0x34,0xbd,0xca,0x60,
+0x67,0x00,0x41,0x0b,0xc8,0x52,0x00,0x5a,0x00,0x73,0xf8,0x00,0x01,0x00,0x37,0xad,
+0xf6,0x4b,0x01,0x30,0x0c,0xf3,0x00,0x8f,0x04,0xf2,0x0a,0xf1,0x05,0x8a,0x84,0x00,
+0x0f,0xf7,0xef,0xff,0xff,0xb0,0x2f,0xff,0xd7,0x42,0x6e,0xf8,0x4f,0xf9,0x00,0x00,
+0x06,0xfd,0x3b,0x90,0xcf,0x04,0xf7,0x05,0x00,0x00,0x4e,0xf9,0x00,0x48,0x76,0x9c,
+0xff,0xf2,0x00,0x3f,0xff,0xff,0xfb,0x20,0x00,0x08,0x89,0x86,0xc3,0x00,0x03,0x6a,
+0x02,0xf0,0x22,0x00,0x7f,0x71,0xaf,0xfa,0x10,0x09,0xf6,0xdf,0xef,0xfd,0x00,0xbf,
+0xee,0x40,0x1e,0xf6,0x0d,0xff,0x30,0x00,0x7f,0xb0,0xdf,0xb0,0x00,0x04,0xfe,0x0e,
+0xf5,0x00,0x00,0x3f,0xf0,0xef,0x20,0x00,0x05,0xfd,0x0d,0xf2,0x00,0x00,0x8f,0xa0,
+0x33,0x00,0x00,0x2e,0xa0,0x01,0xb0,0x3d,0xfc,0x00,0x00,0x26,0xbf,0xfe,0x20,0x00,
+0x0c,0xff,0x6e,0x06,0x21,0x2a,0x61,0xec,0x01,0x60,0x11,0x12,0x24,0x20,0x00,0x06,
+0x93,0x01,0x71,0x10,0x00,0x5d,0xcb,0xad,0xff,0x90,0x43,0x03,0x10,0x50,0x6a,0x02,
+0x12,0xfd,0xef,0x02,0x60,0x99,0x62,0x00,0x00,0x1c,0xff,0xcf,0x00,0x70,0x2d,0xfd,
+0x51,0x00,0x6f,0xf6,0x3f,0xc5,0x04,0xf0,0x09,0x5f,0xc0,0xc9,0x09,0xff,0xe5,0x02,
+0xfe,0x00,0x06,0xfb,0x8e,0xf3,0x7f,0xb0,0x00,0x8f,0x80,0x7f,0xdf,0xf5,0x00,0x02,
+0xff,0xbc,0x02,0x57,0x00,0x02,0x8b,0xca,0x81,0xb3,0x00,0x23,0xaf,0x90,0xd7,0x05,
+0x11,0x60,0x67,0x02,0xf0,0x07,0x24,0xcf,0x80,0x17,0xb9,0x30,0x00,0x0d,0xff,0xff,
+0x96,0xff,0xff,0xe1,0x00,0x09,0xb9,0xef,0xcf,0xc5,0x4f,0xf4,0xf5,0x01,0x11,0xf9,
+0x25,0x01,0x10,0x07,0xde,0x03,0xc0,0xf1,0x00,0x00,0x3f,0xfd,0x00,0x00,0x0f,0xf0,
+0x00,0x01,0xdf,0x08,0x00,0xf0,0x05,0xe0,0x00,0x0b,0xfb,0xfd,0x00,0x00,0x2f,0xd0,
+0x00,0x1f,0xe2,0xfe,0x00,0x00,0x3f,0xd1,0x77,0x05,0x50,0x08,0x00,0x20,0xff,0xf9,
+0x4d,0x06,0xb8,0x00,0x0c,0xff,0xd3,0x00,0x01,0x99,0x00,0x00,0x00,0x31,0x78,0x00,
+0x18,0x80,0x78,0x00,0x30,0x01,0x13,0xcf,0x46,0x06,0x00,0x78,0x00,0xb1,0x91,0x7a,
+0xca,0x60,0x00,0x0a,0xda,0xef,0x8f,0xff,0xff,0x6d,0x02,0x70,0xfd,0x62,0x15,0xef,
+0x90,0x00,0x07,0xfc,0x00,0x20,0x4f,0xe0,0x78,0x00,0x00,0xff,0x06,0x31,0x01,0xef,
+0xfd,0xe0,0x07,0x30,0x0b,0xfa,0xfd,0x1a,0x06,0xf1,0x01,0xa0,0x1e,0xe1,0xfe,0x00,
+0x00,0x5d,0xfe,0x10,0x04,0x40,0xfe,0x00,0x8f,0xff,0xd3,0xc5,0x06,0x20,0x3f,0xc7,
+0x59,0x00,0x12,0x99,0x32,0x03,0x30,0x00,0x4c,0x80,0xdf,0x00,0x70,0x10,0x7f,0xa3,
+0x56,0x70,0x00,0x1f,0x06,0x04,0xf1,0x1b,0xe0,0x00,0x1a,0xbd,0xfe,0xa9,0x87,0x40,
+0x00,0x00,0x0b,0xf4,0x10,0x00,0x02,0x50,0x00,0x6f,0xff,0xfe,0x33,0xaf,0xf1,0x04,
+0xff,0xd8,0x9f,0xff,0xfd,0x81,0x4f,0xf8,0x01,0xaf,0xfb,0x40,0x00,0x3d,0x90,0x4e,
+0xff,0xf0,0xb7,0x07,0x20,0x5d,0xf0,0x45,0x03,0x30,0xf8,0x09,0xb0,0x63,0x07,0x70,
+0xfb,0x20,0x13,0x56,0x00,0x00,0x04,0x47,0x00,0x51,0x10,0x00,0x00,0x39,0xbc,0x47,
+0x08,0x33,0x00,0x2c,0x50,0xdb,0x00,0x13,0xe1,0xeb,0x07,0x12,0x40,0x83,0x04,0x22,
+0xfb,0x00,0x36,0x06,0x19,0xf2,0x72,0x01,0x42,0x02,0xff,0xce,0xe3,0xb0,0x07,0x21,
+0xff,0xf9,0x5c,0x06,0xf0,0x11,0xf9,0x04,0xfd,0x00,0x09,0x60,0x00,0x8f,0xd0,0x02,
+0xfd,0x00,0x0e,0xf2,0x00,0xef,0x50,0x01,0xfe,0x00,0x7f,0xc0,0x06,0xfe,0x00,0x00,
+0xff,0x78,0xff,0x40,0x0c,0xf9,0x11,0x05,0x82,0xf8,0x00,0x05,0xa4,0x00,0x00,0x2a,
+0xda,0x6a,0x00,0x00,0x83,0x00,0xf1,0x00,0xee,0xee,0xee,0xff,0xb0,0x4f,0xee,0xee,
+0xee,0xef,0xfe,0x10,0x00,0x01,0x43,0x75,0x00,0xa0,0x5f,0xc2,0xef,0x70,0x00,0x00,
+0x05,0xfb,0x9f,0x90,0x8e,0x02,0x25,0x90,0x40,0x32,0x04,0x21,0x05,0xfe,0x9a,0x07,
+0x01,0x42,0x02,0x12,0x04,0xb8,0x07,0x27,0x03,0x30,0x95,0x01,0x30,0x01,0xfe,0xee,
+0x4a,0x00,0x22,0xa0,0x1f,0x23,0x08,0x20,0x10,0x11,0x21,0x00,0x00,0x2e,0x00,0x40,
+0x05,0xb9,0x01,0xdf,0x4d,0x00,0x40,0x6f,0xc3,0xef,0xc0,0xe8,0x02,0x31,0xfb,0x4e,
+0xb0,0xae,0x03,0x21,0xa0,0x10,0x55,0x03,0x19,0xf7,0xf1,0x00,0x21,0xbf,0xd0,0x0e,
+0x00,0x22,0xcf,0xf3,0x15,0x00,0x02,0xac,0x04,0x26,0x03,0xa2,0x67,0x00,0x11,0x20,
+0xf8,0x00,0x10,0xf4,0x71,0x00,0x01,0xdf,0x04,0xf1,0x0a,0x5e,0xfe,0x40,0x00,0x00,
+0x4c,0xff,0xc1,0x00,0x04,0x9e,0xff,0xff,0x40,0x00,0x3f,0xff,0xd6,0xef,0x40,0x00,
+0x09,0x93,0x00,0xef,0x50,0x00,0x0e,0x06,0x00,0x23,0xff,0x50,0xaf,0x00,0x22,0xa1,
+0x00,0x89,0x06,0x11,0xd0,0x62,0x00,0x22,0xef,0xf3,0xde,0x00,0x12,0xd2,0x97,0x08,
+0x00,0x34,0x04,0x20,0x38,0xef,0xe0,0x04,0x50,0x08,0xef,0xff,0xda,0xfe,0x0b,0x01,
+0x21,0xfb,0x50,0x66,0x08,0x13,0x61,0x09,0x01,0x04,0x75,0x08,0x0c,0x0f,0x00,0x13,
+0x06,0xf3,0x08,0x22,0x4b,0xb0,0x64,0x01,0x21,0x10,0x00,0x08,0x01,0x00,0x05,0x00,
+0x71,0x22,0x25,0xff,0x32,0x23,0x20,0x3f,0x1f,0x01,0xa0,0xf5,0x2f,0xfb,0xbb,0xbb,
+0xbb,0xcf,0xf4,0x2f,0xe0,0x3b,0x00,0x11,0xf0,0x07,0x00,0x40,0x8f,0xc0,0x3f,0xf0,
+0xa8,0x00,0x30,0x70,0x04,0x40,0x48,0x00,0x11,0x10,0xe0,0x08,0x12,0xf9,0xfb,0x06,
+0x10,0xd0,0x59,0x06,0x40,0xcf,0xfd,0x20,0x00,0x8b,0x03,0x11,0xa1,0x70,0x00,0x16,
+0xa3,0x15,0x01,0x80,0x0b,0xdc,0xcc,0xcc,0xcd,0xd0,0x0d,0xff,0xd9,0x04,0x64,0x01,
+0x10,0x2f,0xf1,0x01,0x10,0xe8,0x09,0x0c,0x06,0x00,0x61,0x8c,0xcc,0xcf,0xfc,0xcc,
+0xc9,0x22,0x0a,0x21,0xfb,0x22,0x01,0x00,0x20,0x01,0x11,0x01,0x00,0x31,0x20,0x0c,
+0xff,0x3e,0x00,0x03,0x07,0x00,0x02,0x0a,0x09,0x1f,0x00,0x07,0x00,0x10,0x81,0x45,
+0x44,0x46,0xff,0x54,0x44,0x54,0xcf,0x38,0x00,0x30,0xfc,0xbd,0xcc,0x01,0x00,0x10,
+0xdb,0xee,0x00,0x11,0x20,0xc3,0x06,0x11,0xb0,0xbe,0x02,0xa0,0xb0,0x00,0x0c,0xcc,
+0xcc,0xdf,0xfc,0xcc,0x0e,0xff,0x90,0x04,0x00,0x68,0x01,0x11,0xc0,0x23,0x07,0x10,
+0xc0,0xd7,0x08,0xf1,0x03,0x4f,0xd0,0x00,0x06,0xff,0xe3,0x0f,0xd0,0x00,0x4f,0xfa,
+0x10,0x0f,0xd0,0x00,0x07,0x50,0x3c,0x94,0x01,0x25,0x2f,0xff,0x79,0x05,0x03,0x41,
+0x01,0x11,0x00,0x4a,0x06,0x10,0x01,0x6b,0x02,0x22,0x00,0x11,0x67,0x02,0x80,0xf9,
 0x1f,0xee,0xee,0xef,0xff,0xee,0xe9,0x5f,0x02,0x12,0xff,0x71,0x01,0x11,0xff,0x1d,
-0x01,0x21,0xf6,0xff,0x5b,0x07,0x20,0x70,0xff,0x24,0x12,0x10,0xf6,0x48,0x0e,0x30,
-0x9f,0xfe,0x40,0x07,0x00,0x40,0x4f,0xb1,0x02,0x22,0x1f,0x07,0x00,0x3c,0x03,0x01,
-0xb0,0x01,0x21,0xde,0xd7,0xa5,0x09,0x13,0xf5,0x31,0x0f,0x03,0x01,0x11,0x02,0xa1,
-0x03,0x42,0xff,0xfa,0x4f,0xff,0xf0,0x03,0x50,0x04,0xfe,0x00,0x03,0xfd,0xb5,0x02,
-0x00,0xf3,0x11,0x20,0x0d,0xf6,0x0c,0x12,0x00,0xdc,0x01,0x20,0x6f,0x90,0xf7,0x1b,
-0xf0,0x06,0x09,0xf7,0x01,0xcf,0xe1,0x00,0x00,0xdf,0x54,0xef,0xf4,0x02,0xed,0xdf,
-0xf1,0x4e,0xf4,0x00,0x0f,0xff,0xf8,0xc4,0x16,0x23,0x23,0x41,0xc0,0x00,0x20,0x94,
-0x00,0x59,0x0c,0x31,0x0c,0x8b,0xd0,0xda,0x0e,0x31,0x7f,0x4d,0x20,0xdd,0x04,0xb1,
-0xa2,0x00,0x7f,0xee,0xef,0xfe,0xee,0xed,0x30,0x07,0xff,0x5c,0x08,0x00,0xc6,0x00,
-0x20,0xb0,0x00,0x58,0x19,0x22,0x0a,0xf8,0x76,0x03,0x51,0xef,0x50,0x00,0xcf,0x40,
-0xa6,0x0b,0x70,0x0d,0xf3,0x00,0x00,0x0d,0xf9,0x00,0xc3,0x00,0x30,0x09,0xff,0x20,
-0x07,0x0e,0x60,0x08,0xff,0x60,0x24,0x39,0xfc,0xb7,0x08,0x10,0x04,0xef,0x15,0x6e,
-0x1c,0x80,0x00,0x2c,0xdd,0x90,0x50,0x10,0x24,0x4c,0xc0,0xe4,0x12,0x01,0xe8,0x00,
-0xa0,0xf6,0x7a,0xdf,0x00,0x37,0x9b,0xdf,0xff,0xff,0xff,0x08,0x07,0x82,0xfd,0x85,
-0x30,0x00,0x2a,0x74,0x26,0xfb,0x65,0x01,0xc0,0xfe,0x00,0x36,0xa2,0x00,0x01,0x36,
-0xff,0xef,0xff,0xf6,0x5c,0xe0,0x0d,0x50,0xca,0x73,0x4f,0xff,0xc9,0x75,0x21,0x43,
-0x05,0x20,0x00,0x7f,0xf1,0x1b,0x18,0xe0,0x3a,0x13,0x04,0x49,0x13,0x02,0x7b,0x2b,
-0x12,0xfa,0x66,0x1c,0x12,0xf9,0x9c,0x05,0x61,0xfd,0xcc,0xce,0x70,0x00,0x05,0x8a,
-0x0c,0x01,0x21,0x11,0xa0,0xcf,0xb0,0x06,0xff,0xa0,0x00,0x02,0xff,0x50,0x8f,0x2b,
-0x08,0x10,0xfe,0xaf,0x04,0x32,0x00,0x3f,0xf5,0x84,0x03,0x11,0xb0,0x38,0x17,0x01,
-0xe8,0x09,0x31,0x05,0xef,0xe2,0x32,0x0d,0x21,0xfd,0x20,0x61,0x23,0x20,0x91,0x00,
-0x8d,0x24,0x07,0xeb,0x02,0x0b,0x01,0x00,0x10,0x29,0xaa,0x03,0x50,0xdb,0x40,0x09,
-0xe5,0xf4,0x26,0x03,0xb0,0x20,0x01,0xf7,0x72,0x00,0x00,0x1e,0xfe,0x99,0xab,0xd2,
-0x66,0x0c,0x00,0xe5,0x02,0x00,0x25,0x05,0x90,0x42,0x22,0x5f,0xf4,0x00,0x00,0xaf,
-0xf4,0x00,0xcc,0x23,0x10,0x1d,0xc5,0x1d,0x51,0xef,0x70,0x00,0x05,0xd3,0x87,0x00,
-0x02,0xbc,0x03,0x13,0xf5,0x12,0x05,0x12,0xa0,0x49,0x08,0x26,0xfa,0x00,0x07,0x04,
-0x20,0x00,0x5e,0xfa,0x06,0x01,0x51,0x15,0x1a,0x10,0x19,0x15,0x04,0xb9,0x07,0x13,
-0xda,0x8e,0x06,0x13,0xc0,0x62,0x01,0x01,0x15,0x1c,0x02,0xd3,0x01,0x31,0xc0,0x01,
-0xef,0x18,0x03,0x00,0xd8,0x04,0x00,0xbf,0x0e,0x40,0xbf,0xf4,0x00,0x09,0xff,0x00,
-0x40,0xf6,0x00,0x00,0xdf,0xc5,0x0e,0x02,0x85,0x28,0x13,0x00,0x5f,0x23,0x00,0xb2,
-0x02,0x12,0x40,0xd8,0x05,0x11,0x80,0xd7,0x03,0x03,0x90,0x00,0x17,0x08,0x2d,0x12,
+0x01,0x21,0xf6,0xff,0x5b,0x07,0xe0,0x70,0xff,0x00,0x00,0x03,0xcf,0xf6,0x00,0xff,
+0x10,0x00,0x9f,0xfe,0x40,0x07,0x00,0x40,0x4f,0xb1,0x02,0x22,0x1f,0x07,0x00,0x3c,
+0x03,0x01,0xb0,0x01,0x21,0xde,0xd7,0xa5,0x09,0x26,0xf5,0x00,0x24,0x02,0x23,0x0e,
+0xf3,0xa1,0x03,0x42,0xff,0xfa,0x4f,0xff,0xf0,0x03,0x50,0x04,0xfe,0x00,0x03,0xfd,
+0xb5,0x02,0x91,0x00,0x3f,0xc0,0x00,0x0d,0xf6,0x00,0x05,0xfb,0xdc,0x01,0xf3,0x12,
+0x6f,0x90,0x01,0xef,0x90,0x00,0x09,0xf7,0x01,0xcf,0xe1,0x00,0x00,0xdf,0x54,0xef,
+0xf4,0x02,0xed,0xdf,0xf1,0x4e,0xf4,0x00,0x0f,0xff,0xf8,0x00,0x22,0x00,0x00,0x23,
+0x41,0xc0,0x00,0x20,0x94,0x00,0x59,0x0c,0xb1,0x0c,0x8b,0xd0,0x00,0x00,0x0f,0xf1,
+0x00,0x7f,0x4d,0x20,0xdd,0x04,0xb1,0xa2,0x00,0x7f,0xee,0xef,0xfe,0xee,0xed,0x30,
+0x07,0xff,0x5c,0x08,0x00,0xc6,0x00,0x82,0xb0,0x00,0xaf,0x60,0x00,0x00,0x0a,0xf8,
+0x76,0x03,0x51,0xef,0x50,0x00,0xcf,0x40,0xa6,0x0b,0x70,0x0d,0xf3,0x00,0x00,0x0d,
+0xf9,0x00,0xc3,0x00,0xd0,0x09,0xff,0x20,0x00,0x2f,0xf0,0x00,0x08,0xff,0x60,0x24,
+0x39,0xfc,0xb7,0x08,0xcd,0x04,0xff,0xff,0x70,0x00,0x1c,0x80,0x00,0x2c,0xdd,0x90,
+0x00,0x01,0x00,0x22,0x4c,0xc0,0x4d,0x08,0x03,0x8d,0x0a,0xa0,0xf6,0x7a,0xdf,0x00,
+0x37,0x9b,0xdf,0xff,0xff,0xff,0x08,0x07,0x82,0xfd,0x85,0x30,0x00,0x2a,0x74,0x26,
+0xfb,0x65,0x01,0xf2,0x0f,0xfe,0x00,0x36,0xa2,0x00,0x01,0x36,0xff,0xef,0xff,0xf6,
+0x5c,0xef,0xff,0xff,0xff,0xca,0x73,0x4f,0xff,0xc9,0xcf,0x80,0x00,0x00,0x05,0x20,
+0x00,0x7f,0xb0,0x30,0x0c,0x12,0xe0,0xcd,0x0a,0x02,0x90,0x04,0x27,0x0d,0xb3,0x69,
+0x00,0x12,0x07,0xa6,0x0c,0x22,0x0e,0xf9,0x9c,0x05,0x61,0xfd,0xcc,0xce,0x70,0x00,
+0x05,0x8a,0x0c,0xf0,0x00,0x00,0x4f,0xf8,0x00,0x00,0xcf,0xb0,0x06,0xff,0xa0,0x00,
+0x02,0xff,0x50,0x8f,0x2b,0x08,0x10,0xfe,0xaf,0x04,0x32,0x00,0x3f,0xf5,0x84,0x03,
+0x01,0x5c,0x00,0x11,0x1d,0xe8,0x09,0x31,0x05,0xef,0xe2,0x32,0x0d,0x01,0xa4,0x06,
+0x30,0xdf,0xff,0x91,0x1a,0x00,0x17,0x2d,0xeb,0x02,0x0b,0x01,0x00,0x10,0x29,0xaa,
+0x03,0x50,0xdb,0x40,0x09,0xe5,0xf4,0x26,0x03,0xb0,0x20,0x01,0xf7,0x72,0x00,0x00,
+0x1e,0xfe,0x99,0xab,0xd2,0x66,0x0c,0x00,0xe5,0x02,0x00,0x25,0x05,0xf1,0x08,0x42,
+0x22,0x5f,0xf4,0x00,0x00,0xaf,0xf4,0x00,0x00,0x8f,0xe0,0x00,0x1d,0xff,0x50,0x00,
+0x01,0xef,0x70,0x00,0x05,0xd3,0x87,0x00,0x02,0xbc,0x03,0x13,0xf5,0x12,0x05,0x12,
+0xa0,0x49,0x08,0x26,0xfa,0x00,0x07,0x04,0x42,0x00,0x5e,0xff,0xf7,0x8c,0x05,0x12,
+0xf9,0xd5,0x08,0x00,0xea,0x0b,0x09,0xb9,0x07,0x13,0xda,0x8e,0x06,0x12,0xc0,0x62,
+0x01,0x00,0xc7,0x01,0x22,0x11,0x00,0xd3,0x01,0x31,0xc0,0x01,0xef,0x18,0x03,0x00,
+0xd8,0x04,0x80,0x7f,0xc0,0x00,0x00,0xbf,0xf4,0x00,0x09,0xff,0x00,0xc2,0xf6,0x00,
+0x00,0xdf,0x70,0x00,0x00,0x02,0x00,0x00,0x3f,0xf2,0xf4,0x09,0x12,0xfb,0x48,0x0c,
+0x02,0x07,0x05,0x12,0x09,0x26,0x0b,0x13,0x0b,0x90,0x00,0x26,0x08,0x70,0x6e,0x00,
 0xf0,0x05,0x08,0x60,0x00,0x00,0x6a,0x70,0x00,0x0a,0xb8,0xf1,0x00,0x00,0xbf,0xa0,
-0x00,0x04,0xf5,0xa2,0x00,0x01,0x35,0x00,0x10,0x61,0x3d,0x00,0x00,0x81,0x05,0x12,
-0x90,0xe4,0x13,0xd1,0xff,0x90,0x00,0xcf,0xd1,0x11,0x9f,0xa1,0x11,0x10,0x0b,0xff,
-0x30,0x6b,0x0f,0x21,0x2d,0xf6,0x50,0x02,0x00,0x69,0x0d,0x32,0x05,0xff,0x10,0xc0,
-0x01,0x02,0xe9,0x00,0x01,0x4d,0x2c,0x06,0x77,0x00,0x23,0x00,0xdf,0x76,0x06,0x28,
-0x2c,0x80,0xe8,0x00,0x71,0x12,0x21,0x11,0x11,0x11,0x22,0x7f,0xc3,0x03,0x20,0x7f,
-0xfe,0x35,0x06,0x01,0x34,0x01,0x0f,0x06,0x00,0x0c,0x71,0x9d,0xcc,0xcc,0xcc,0xcd,
-0xfe,0xbf,0x36,0x00,0x61,0x45,0x44,0x44,0x44,0x48,0xfe,0xc9,0x03,0x72,0x77,0x00,
-0x00,0xdd,0x10,0x02,0xff,0xea,0x11,0x01,0x9f,0x04,0x90,0xff,0x10,0x01,0xff,0x00,
-0x01,0xdc,0xcf,0xfc,0xa2,0x04,0x03,0x45,0x06,0x90,0xe0,0x33,0x2f,0xf4,0x22,0x4f,
-0xf2,0x33,0x00,0x47,0x1f,0x12,0xfe,0x2d,0x00,0x21,0x4f,0xd0,0xc2,0x10,0x13,0x07,
-0xa4,0x00,0x27,0xef,0x60,0x38,0x07,0x22,0x04,0xcf,0xef,0x11,0x04,0x38,0x06,0x02,
-0xff,0x14,0x10,0x22,0xdc,0x06,0x10,0x90,0x44,0x04,0x60,0x05,0xfd,0xb7,0xe4,0x00,
-0x02,0x1a,0x24,0x84,0x6d,0x65,0x02,0x13,0xfe,0x11,0x15,0xfd,0x90,0x05,0xa2,0xff,
-0xb0,0x3e,0xde,0xff,0xdd,0xde,0xff,0xdd,0xa0,0x20,0x00,0x02,0x6d,0x04,0x22,0x06,
-0xfb,0x08,0x00,0x11,0x08,0xc1,0x1d,0x12,0xbb,0xff,0x2c,0x12,0x00,0x9a,0x24,0x06,
-0x30,0x02,0x10,0x03,0x29,0x20,0x01,0xeb,0x16,0x12,0xa1,0x1f,0x00,0x12,0x23,0x7e,
-0x00,0x13,0x50,0xda,0x01,0x12,0x20,0xda,0x01,0x12,0xf4,0x54,0x01,0x10,0xe1,0x14,
-0x00,0x10,0x60,0xc8,0x06,0x20,0xa0,0x7f,0x22,0x17,0x20,0x07,0xf8,0x42,0x26,0x00,
-0x4a,0x18,0x21,0x1b,0x40,0x54,0x18,0x00,0xce,0x00,0x01,0x51,0x00,0x11,0x3d,0x5f,
-0x00,0x10,0x4b,0x18,0x04,0x50,0x06,0xae,0xff,0xfc,0x20,0xa1,0x01,0x11,0xfb,0xb1,
-0x1d,0x29,0xa6,0x20,0x82,0x02,0xf0,0x18,0x42,0x00,0x00,0x01,0x3e,0x30,0x00,0x1e,
-0xf8,0x00,0x06,0xf2,0xcd,0x00,0x01,0xbf,0xfd,0x20,0x0e,0xb3,0xb1,0x00,0x00,0x5e,
-0xc0,0x00,0x57,0x00,0x01,0xb3,0x00,0x12,0x00,0x00,0x09,0x00,0xaf,0xf9,0x10,0x38,
-0x07,0x32,0x01,0xaf,0xfb,0xc5,0x07,0x22,0x4d,0x20,0x18,0x09,0x00,0x43,0x15,0x11,
-0xa0,0x9f,0x0a,0x01,0x0e,0x00,0x41,0x04,0xbf,0xfe,0x40,0x6f,0x00,0x30,0xfb,0x10,
-0x00,0x35,0x08,0x11,0xb4,0xca,0x00,0x19,0xb6,0x70,0x00,0x92,0x02,0xed,0xdd,0xdd,
-0xdd,0xeb,0x10,0x02,0xff,0xc4,0x08,0x52,0x43,0x33,0x33,0x4f,0xf7,0xa1,0x11,0x11,
-0xe0,0xcf,0x03,0x02,0x93,0x01,0x22,0x0b,0xfc,0x16,0x03,0x12,0xf8,0xa9,0x08,0x00,
-0x32,0x08,0x40,0x01,0xcf,0xf4,0x9f,0x2b,0x15,0x60,0xfe,0x30,0x0a,0xff,0x70,0x5d,
-0x6c,0x07,0x40,0xbf,0xf5,0x2e,0xf7,0x88,0x02,0x36,0xe2,0x02,0x10,0xfe,0x19,0x32,
-0x00,0x17,0x70,0xd6,0x06,0xa0,0xc7,0xf2,0x00,0x23,0x33,0x33,0x33,0x38,0xf5,0xa3,
-0x4f,0x0d,0x01,0x49,0x12,0x43,0x7e,0xdd,0xdd,0xdd,0xa6,0x02,0x13,0x07,0xc5,0x02,
-0x14,0x0e,0x5d,0x10,0x13,0xd0,0x27,0x0e,0x12,0x40,0xa4,0x01,0x22,0xff,0x80,0x90,
-0x07,0x21,0xdf,0xf8,0x46,0x1c,0x11,0xf8,0x95,0x1f,0x30,0x6e,0xff,0x70,0x93,0x00,
-0x30,0x0c,0xff,0xd4,0x5f,0x03,0x30,0x20,0x02,0xd8,0x1c,0x00,0x17,0xd5,0xdd,0x00,
-0x11,0x5f,0x28,0x05,0x00,0xdf,0x0c,0x04,0x27,0x11,0x20,0x01,0x56,0x0f,0x00,0x71,
-0x36,0xad,0xff,0xf8,0x01,0x46,0xbf,0xac,0x11,0xb0,0xef,0xff,0xff,0xda,0x63,0x9f,
-0xb0,0x0b,0xeb,0xaf,0xd0,0xc0,0x03,0x30,0x10,0x04,0xfd,0x7c,0x01,0x00,0x2d,0x00,
-0x22,0x06,0xfb,0x3c,0x00,0x26,0x02,0x10,0x63,0x11,0x50,0x03,0xff,0x52,0x23,0x57,
-0xbe,0x1d,0x02,0xfc,0x06,0x63,0x00,0x29,0xcd,0xdc,0xba,0x70,0xcd,0x03,0x70,0x40,
-0x00,0x00,0x44,0x10,0x00,0x0b,0x18,0x06,0x00,0x5c,0x28,0x40,0xf4,0xc2,0x00,0x00,
-0xc3,0x17,0x20,0x81,0x00,0x08,0x00,0x30,0x03,0x7a,0xe6,0x4e,0x01,0x10,0xcd,0x37,
-0x00,0x00,0x90,0x05,0x80,0xeb,0x9f,0xf5,0x00,0x6f,0xfe,0xff,0x72,0x6a,0x04,0x71,
-0x25,0x20,0xef,0x30,0x06,0xff,0x20,0x28,0x00,0x31,0x2f,0xf6,0x00,0x08,0x00,0x22,
-0x02,0x60,0x08,0x00,0x03,0x5c,0x17,0x41,0x91,0x11,0x24,0x72,0xb2,0x1e,0x02,0x67,
-0x14,0x55,0x18,0xde,0xee,0xdc,0xa2,0xb4,0x04,0x10,0xb0,0x8f,0x1f,0x30,0xb0,0x3f,
-0xf8,0x21,0x00,0x40,0xc0,0x09,0xff,0x20,0x77,0x08,0x11,0x01,0xa0,0x05,0x41,0x30,
-0x00,0x8f,0xf2,0x39,0x30,0x52,0x0b,0x30,0x00,0x1f,0xf8,0x1f,0x04,0x12,0xf1,0x59,
-0x01,0x11,0x80,0x12,0x01,0x12,0xfb,0x57,0x01,0x11,0xd1,0xfa,0x02,0x01,0xb4,0x05,
-0x00,0x27,0x32,0x00,0x01,0x00,0x15,0x64,0x46,0x01,0x22,0x21,0x86,0x27,0x06,0x40,
-0x99,0xf1,0x02,0x30,0x19,0x02,0x30,0x3a,0x26,0xfe,0x71,0x14,0x11,0xb3,0x28,0x29,
-0x40,0x01,0xff,0x50,0x00,0x48,0x2f,0x50,0x5f,0xf1,0x00,0x00,0xef,0x43,0x2f,0x42,
-0x00,0x00,0x07,0xf7,0x4a,0x28,0x11,0x01,0xa3,0x05,0x13,0x00,0x97,0x30,0x00,0x15,
-0x06,0x02,0x88,0x01,0x31,0x3e,0xff,0x30,0x89,0x00,0x21,0xff,0x40,0x61,0x02,0x21,
-0xfd,0x30,0x59,0x01,0x1b,0xe8,0x0d,0x06,0x22,0x12,0x00,0xc7,0x04,0x13,0xfc,0x53,
-0x0a,0x32,0x60,0x01,0x20,0x07,0x06,0x00,0xf3,0x10,0xf2,0x12,0x8f,0xfc,0xcc,0xce,
-0xff,0x10,0x00,0x7f,0xf4,0x00,0x00,0xcf,0x90,0x00,0x8f,0xf6,0x22,0x00,0x3f,0xf3,
-0x00,0xbf,0xf6,0x2e,0xf8,0x1c,0xfb,0x00,0x01,0xb3,0x01,0xaf,0xff,0xf9,0x13,0x12,
-0x4e,0x03,0x0a,0x12,0x05,0xb7,0x14,0x41,0x08,0xff,0xb5,0xe4,0x0a,0x06,0x11,0x90,
-0xe0,0x03,0x21,0xfe,0x60,0x1c,0x00,0x2e,0xe7,0x00,0xd7,0x19,0x00,0x21,0x00,0x53,
-0xdc,0x50,0x08,0xd6,0xf3,0x88,0x06,0x10,0x83,0x54,0x33,0x33,0xcc,0xcd,0xf5,0x81,
-0x00,0x10,0xfc,0x26,0x01,0x90,0x30,0x00,0x2f,0xf5,0x00,0x00,0x9f,0xf4,0x10,0x2a,
-0x03,0xe2,0x1c,0xff,0x53,0xfa,0x11,0xef,0x70,0x00,0x08,0xe3,0x07,0xff,0xfc,0xfd,
-0x1c,0x04,0x02,0xdc,0x0e,0x00,0xb6,0x0d,0x12,0x70,0x88,0x06,0x20,0xcf,0x20,0x73,
-0x1d,0x31,0xff,0x80,0x03,0x85,0x00,0x02,0xcf,0x0f,0x13,0x2d,0x88,0x06,0x25,0x01,
-0x10,0x7b,0x0b,0x91,0x47,0xc2,0x00,0x06,0xab,0xcd,0xef,0xff,0xfc,0xf1,0x0d,0x53,
-0xa6,0x30,0x00,0x00,0x21,0x55,0x17,0x01,0x07,0x00,0x82,0xcc,0xcc,0xcc,0xff,0xdc,
-0xcc,0xc8,0xef,0xd3,0x08,0xb2,0x22,0x11,0x13,0xff,0x21,0x11,0x21,0x00,0x00,0x05,
-0xfd,0x05,0x06,0x03,0xe5,0x01,0x01,0x89,0x06,0x36,0x19,0xff,0x70,0xb6,0x03,0x33,
-0x00,0x05,0x50,0x6a,0x11,0x10,0x10,0x0c,0x00,0xf0,0x09,0xaf,0x70,0x06,0xd7,0x5f,
-0xd0,0x4f,0xd0,0x0a,0xfb,0x0e,0xf4,0x0e,0xf3,0x0d,0xf5,0x08,0xfa,0x05,0x40,0x4f,
-0xf0,0x02,0x71,0x51,0x01,0x00,0xb6,0x00,0x01,0x37,0x17,0x10,0x6f,0xf2,0x00,0x10,
-0x1a,0xbc,0x09,0x11,0x2a,0x86,0x05,0x11,0x1d,0xff,0x04,0x13,0x01,0x34,0x1c,0x01,
-0x95,0x24,0x10,0x10,0x70,0x1b,0xf1,0x10,0x94,0xbf,0x80,0x0d,0xf6,0x00,0x0d,0xfa,
-0x5f,0xf0,0x07,0xfc,0x00,0x1f,0xf5,0x0e,0xf6,0x01,0xff,0x10,0x5f,0xf0,0x08,0xfc,
-0x00,0x51,0x00,0xbf,0xa0,0x02,0x82,0x73,0x15,0x01,0x3f,0x05,0x12,0xfa,0xdd,0x03,
-0x11,0xf2,0x83,0x07,0x01,0xbe,0x0b,0x11,0x03,0xd8,0x19,0x41,0x05,0xbf,0xff,0x50,
-0x24,0x07,0x14,0xc2,0x62,0x09,0x03,0x9b,0x07,0x10,0x01,0xb8,0x04,0x01,0x9a,0x04,
-0x54,0xbe,0xdd,0xdd,0xdd,0xde,0x26,0x01,0x03,0x35,0x01,0x02,0x1d,0x15,0x80,0xfd,
-0x9e,0xee,0xee,0xff,0xfe,0xee,0xec,0xe4,0x04,0x12,0x60,0x77,0x18,0x17,0x40,0xb0,
-0x0b,0x03,0x75,0x00,0x22,0xbf,0xf2,0x7c,0x02,0x11,0x50,0xac,0x03,0x1d,0xd3,0xf5,
-0x01,0x12,0x5a,0xae,0x01,0x30,0xe5,0xf6,0x00,0x54,0x00,0x9c,0xce,0x98,0x50,0x0f,
-0xfe,0xee,0xef,0xfa,0x43,0x27,0x00,0x20,0xde,0xee,0x01,0x00,0x32,0xe9,0x0d,0xff,
-0x98,0x07,0x14,0x10,0x6d,0x00,0x01,0x58,0x26,0x01,0x39,0x01,0x03,0xb2,0x03,0x12,
-0x80,0x76,0x00,0x02,0xcb,0x06,0x13,0xdf,0x30,0x06,0x09,0x77,0x00,0x01,0xdb,0x32,
-0x2a,0x0f,0xf3,0x05,0x00,0x30,0xfa,0x40,0x00,0x08,0x24,0xfb,0x02,0x93,0x00,0x0f,
-0xfc,0xff,0xff,0xd6,0x0f,0xf3,0x17,0xdf,0xf9,0x0f,0xf3,0x00,0x04,0xc2,0x28,0x00,
-0x20,0x1f,0xf4,0x36,0x01,0x10,0x51,0x74,0x17,0xf1,0x08,0x60,0x00,0x00,0x65,0x05,
-0xff,0x00,0x09,0x5a,0xe1,0x4f,0xe0,0x00,0xbe,0x2f,0x74,0xfe,0x00,0x02,0xf4,0x10,
-0x4f,0xe0,0x01,0x01,0x21,0xe9,0x40,0x8e,0x17,0xe0,0xe8,0x20,0x04,0xff,0x6c,0xff,
-0xff,0x60,0x4f,0xe0,0x02,0x9f,0xf2,0x04,0xf2,0x32,0x12,0x00,0x21,0x00,0x15,0xfe,
-0x26,0x05,0x23,0x05,0xff,0x96,0x00,0x01,0xb2,0x22,0x02,0xd2,0x08,0x03,0x51,0x01,
-0x11,0x11,0x2f,0x34,0x22,0x01,0xbf,0x16,0x0c,0x03,0x07,0x00,0x03,0xf1,0x1b,0x00,
-0x6d,0x01,0x12,0x30,0x64,0x03,0x17,0x10,0xfb,0x08,0x27,0x8f,0xf4,0x3a,0x25,0x22,
-0xbf,0xfa,0xca,0x03,0x18,0x60,0x60,0x0a,0x00,0xdf,0x08,0x32,0xfc,0x00,0x07,0x4c,
-0x00,0x20,0x02,0x33,0x01,0x00,0x1f,0x00,0x01,0x00,0x10,0x11,0xdf,0x7e,0x00,0x13,
-0xf1,0x07,0x00,0x11,0x44,0x01,0x00,0x14,0x50,0x15,0x01,0x00,0x08,0x00,0x01,0xe6,
-0x01,0x63,0xce,0xed,0xdf,0xfe,0xde,0xd1,0x3b,0x02,0x11,0xf6,0x2f,0x02,0x13,0x06,
-0x69,0x06,0x12,0x6f,0xd2,0x0a,0x12,0x1a,0x0f,0x00,0xf4,0x0f,0x18,0xff,0xf6,0x1b,
-0x50,0x00,0x01,0x5a,0xff,0xff,0xf1,0x9f,0xfc,0x20,0x0d,0xff,0xfa,0x3f,0xf1,0x07,
-0xff,0xf1,0x03,0xd6,0x10,0x0f,0xf1,0x00,0x2c,0x60,0xbb,0x1a,0x07,0x08,0x00,0x12,
-0x0c,0xa1,0x02,0x05,0x05,0x03,0x21,0x6f,0xe2,0xdd,0x06,0x02,0x7d,0x03,0x02,0x6f,
-0x03,0x00,0x0a,0x05,0x02,0xdf,0x0b,0x00,0xe7,0x00,0x11,0x20,0x35,0x06,0x11,0x80,
-0x72,0x04,0x11,0xd0,0x94,0x01,0x10,0xf3,0xd7,0x11,0x01,0xf0,0x17,0x11,0xaf,0x9f,
-0x04,0x03,0xba,0x07,0x13,0x06,0x97,0x07,0x41,0x13,0x00,0x01,0x61,0x96,0x01,0x00,
-0xf8,0x31,0x01,0x49,0x0e,0x21,0x07,0xfe,0x46,0x01,0x10,0x90,0x75,0x1b,0x01,0xf4,
-0x0e,0x22,0x9f,0xd0,0xb0,0x01,0x22,0x2f,0xf4,0x55,0x10,0x10,0x0c,0xee,0x12,0x20,
-0xf6,0x00,0xfe,0x2f,0x31,0x00,0x9f,0xe0,0xaa,0x0f,0x31,0x02,0xff,0x80,0xae,0x33,
-0x11,0x0c,0xc8,0x03,0x41,0x9f,0xf0,0x07,0xd6,0x05,0x0b,0x0b,0xa9,0x1c,0x22,0x02,
-0x30,0x20,0x07,0x12,0x7a,0xa7,0x05,0xb0,0x25,0xf5,0xf6,0x00,0x00,0x8d,0x90,0x2d,
-0xf2,0xb6,0x10,0xb5,0x2d,0x02,0x39,0x03,0x21,0xdf,0x60,0xdb,0x01,0x31,0x01,0xff,
+0x00,0x04,0xf5,0xa2,0x00,0x01,0x35,0x00,0x10,0x61,0x3d,0x00,0x00,0x81,0x05,0x31,
+0x90,0x00,0x2f,0x7b,0x00,0xf1,0x04,0x90,0x00,0xcf,0xd1,0x11,0x9f,0xa1,0x11,0x10,
+0x0b,0xff,0x30,0x00,0xbf,0x70,0x00,0x00,0x2d,0xf6,0x50,0x02,0x00,0x69,0x0d,0x32,
+0x05,0xff,0x10,0xc0,0x01,0x13,0xfa,0x41,0x09,0x27,0xf3,0x00,0x77,0x00,0x23,0x00,
+0xdf,0x76,0x06,0x28,0x2c,0x80,0xe8,0x00,0x71,0x12,0x21,0x11,0x11,0x11,0x22,0x7f,
+0xc3,0x03,0x20,0x7f,0xfe,0x35,0x06,0x01,0x34,0x01,0x0f,0x06,0x00,0x0c,0x71,0x9d,
+0xcc,0xcc,0xcc,0xcd,0xfe,0xbf,0x36,0x00,0xc0,0x45,0x44,0x44,0x44,0x48,0xfe,0x00,
+0x00,0x00,0x00,0x02,0x77,0xf1,0x11,0x00,0x00,0xdd,0x10,0x02,0xff,0x00,0x00,0x00,
+0x0f,0xf1,0x00,0x1f,0xf0,0x00,0x00,0x00,0xff,0x10,0x01,0xff,0x00,0x01,0xdc,0xcf,
+0xfc,0xcc,0xcf,0xfc,0xcc,0x1f,0xff,0x01,0x00,0x80,0xe0,0x33,0x2f,0xf4,0x22,0x4f,
+0xf2,0x33,0x1e,0x00,0x22,0x02,0xfe,0x2d,0x00,0x20,0x4f,0xd0,0x2d,0x00,0x41,0x20,
+0x07,0xfb,0x00,0x01,0x00,0x21,0xef,0x60,0x07,0x00,0x20,0xaf,0xe1,0x06,0x00,0x30,
+0x04,0xcf,0xf4,0x07,0x00,0x41,0x03,0xff,0xf5,0x00,0x08,0x00,0x11,0x92,0x07,0x00,
+0xf2,0x10,0x22,0x00,0x01,0x43,0x02,0x90,0x00,0x03,0xff,0x00,0x05,0xfd,0xb7,0xe4,
+0x00,0x02,0xfe,0x00,0x04,0xfc,0x6d,0x65,0x02,0x13,0xfe,0x11,0x15,0xfd,0x23,0x20,
+0x3f,0x6b,0x00,0x92,0xb0,0x3e,0xde,0xff,0xdd,0xde,0xff,0xdd,0xa0,0x20,0x00,0x20,
+0x00,0x00,0x08,0x00,0x22,0x06,0xfb,0x08,0x00,0x20,0x08,0xfa,0x08,0x00,0x42,0xbb,
+0x00,0x0c,0xf7,0x75,0x00,0x31,0x4f,0xf1,0x00,0x6f,0x00,0x21,0xff,0xa0,0x67,0x00,
+0x21,0xbf,0xfc,0x0f,0x00,0x32,0x02,0xef,0xa1,0x1f,0x00,0x12,0x23,0x7e,0x00,0x11,
+0x50,0x07,0x00,0x30,0x0c,0xfb,0x20,0x07,0x00,0x31,0x08,0xff,0xf4,0x0f,0x00,0x20,
+0x2c,0xe1,0x14,0x00,0xf1,0x0c,0x60,0x00,0x20,0x00,0x00,0xa0,0x7f,0xfd,0x30,0x00,
+0x00,0x07,0xf8,0x07,0xff,0xe0,0x00,0x00,0x5f,0xf8,0x00,0x1b,0x40,0x00,0x06,0xff,
+0xb0,0xce,0x00,0x01,0x51,0x00,0x11,0x3d,0x5f,0x00,0xf8,0x08,0x4b,0xff,0xf6,0x00,
+0x00,0x06,0xae,0xff,0xfc,0x20,0x00,0x00,0x09,0xff,0xfb,0x40,0x00,0x00,0x00,0x01,
+0xa6,0x20,0x00,0x01,0x00,0xf0,0x2b,0x42,0x00,0x00,0x01,0x3e,0x30,0x00,0x1e,0xf8,
+0x00,0x06,0xf2,0xcd,0x00,0x01,0xbf,0xfd,0x20,0x0e,0xb3,0xb1,0x00,0x00,0x5e,0xc0,
+0x00,0x57,0x00,0x01,0xb3,0x00,0x12,0x00,0x00,0x09,0x00,0xaf,0xf9,0x10,0x00,0x00,
+0x09,0xf4,0x01,0xaf,0xfb,0x00,0x00,0x07,0xff,0x50,0x00,0x4d,0x20,0x00,0x07,0xff,
+0x90,0x3e,0x00,0x12,0x1b,0xc6,0x00,0x11,0x4e,0x0e,0x00,0x41,0x04,0xbf,0xfe,0x40,
+0x6f,0x00,0x81,0xfb,0x10,0x00,0x00,0x00,0xcf,0xff,0xb4,0xca,0x00,0x19,0xb6,0x70,
+0x00,0x81,0x02,0xed,0xdd,0xdd,0xdd,0xeb,0x10,0x02,0x38,0x01,0x62,0x10,0x00,0x43,
+0x33,0x33,0x4f,0x18,0x01,0x30,0x7f,0xe0,0x00,0x9e,0x00,0x02,0x93,0x01,0x12,0x0b,
+0x15,0x01,0x40,0x9f,0xf8,0x00,0x00,0xb9,0x00,0x70,0xff,0x70,0x00,0x00,0x01,0xcf,
+0xf4,0x0f,0x00,0xe0,0x6f,0xfe,0x30,0x0a,0xff,0x70,0x5d,0xff,0xd2,0x00,0x00,0xbf,
+0xf5,0x2e,0x3b,0x00,0x40,0x0d,0xe2,0x02,0x10,0x59,0x00,0x12,0x10,0x61,0x00,0x31,
+0x17,0x70,0x00,0x42,0x00,0xc1,0xc7,0xf2,0x00,0x23,0x33,0x33,0x33,0x38,0xf5,0xa3,
+0x00,0x7f,0x0f,0x02,0x81,0x00,0x00,0x7e,0xdd,0xdd,0xdd,0xff,0x80,0x1f,0x00,0x22,
+0x07,0xff,0x2f,0x00,0x13,0x0e,0x95,0x01,0x21,0x9f,0xd0,0x07,0x00,0x32,0x05,0xff,
+0x40,0xa4,0x01,0x02,0x27,0x00,0x40,0x06,0xff,0xdf,0xf8,0x95,0x00,0x30,0xaf,0xf8,
+0x09,0xe1,0x00,0x30,0x6e,0xff,0x70,0x93,0x00,0xa0,0x0c,0xff,0xd4,0x00,0x00,0x0b,
+0xff,0x20,0x02,0xd8,0x1c,0x00,0x17,0xd5,0xdd,0x00,0x22,0x5f,0xf0,0xdb,0x01,0x13,
+0xfd,0xea,0x01,0x40,0xd0,0x00,0x01,0x56,0x0f,0x00,0x70,0x36,0xad,0xff,0xf8,0x01,
+0x46,0xbf,0x87,0x00,0xf0,0x04,0x50,0xef,0xff,0xff,0xda,0x63,0x9f,0xb0,0x0b,0xeb,
+0xaf,0xd0,0x00,0x3f,0xf2,0x00,0x10,0x04,0xfd,0x7c,0x01,0x00,0x2d,0x00,0x22,0x06,
+0xfb,0x3c,0x00,0x22,0x02,0x10,0x3c,0x00,0x02,0x8e,0x02,0xa0,0x52,0x23,0x57,0x90,
+0x00,0x00,0x0e,0xff,0xff,0xff,0xc4,0x02,0x52,0x29,0xcd,0xdc,0xba,0x70,0x5e,0x00,
+0xf0,0x0b,0x08,0x40,0x00,0x00,0x44,0x10,0x00,0x0b,0x8b,0xd0,0x00,0x00,0xff,0x40,
+0x00,0x07,0xf4,0xc2,0x00,0x00,0xef,0x30,0x00,0x00,0x81,0x00,0x08,0x00,0x30,0x03,
+0x7a,0xe6,0x4e,0x01,0x10,0xcd,0x37,0x00,0xf1,0x08,0x5c,0xef,0xff,0xff,0xeb,0x9f,
+0xf5,0x00,0x6f,0xfe,0xff,0x72,0x00,0x9f,0xc0,0x00,0x25,0x20,0xef,0x30,0x06,0xff,
+0x20,0x28,0x00,0x31,0x2f,0xf6,0x00,0x08,0x00,0x22,0x02,0x60,0x08,0x00,0x02,0x5c,
+0x00,0x50,0xdf,0x91,0x11,0x24,0x72,0x4c,0x02,0x21,0xff,0xff,0x7b,0x02,0x54,0x18,
+0xde,0xee,0xdc,0xa2,0xe6,0x00,0x10,0x06,0x67,0x02,0x40,0x8e,0xb0,0x3f,0xf8,0x21,
+0x00,0x20,0xc0,0x09,0x49,0x00,0xf1,0x07,0xef,0x70,0x01,0xff,0xa0,0x00,0x02,0xff,
+0x30,0x00,0x8f,0xf2,0x00,0x08,0xfe,0x00,0x00,0x0b,0x30,0x00,0x1f,0xf8,0x2e,0x00,
+0x22,0x8f,0xf1,0x59,0x01,0x11,0x80,0x12,0x01,0x12,0xfb,0x57,0x01,0x11,0xd1,0xfa,
+0x02,0x21,0xfe,0x20,0xde,0x01,0x11,0xb1,0x28,0x00,0x15,0x64,0x46,0x01,0x21,0x21,
+0x86,0x07,0x00,0x50,0x1f,0x99,0xf1,0x02,0x30,0x19,0x02,0xf0,0x01,0x3a,0x26,0xfe,
+0x10,0x00,0x00,0x0c,0xb3,0x00,0x2f,0xf9,0x00,0x00,0x01,0xff,0x50,0x64,0x00,0xf1,
+0x01,0x00,0x5f,0xf1,0x00,0x00,0xef,0xb0,0x00,0x09,0xfc,0x00,0x00,0x07,0xf7,0x00,
+0x01,0x22,0x02,0x41,0x00,0x00,0x8f,0xe0,0x3b,0x00,0x12,0x2f,0xd6,0x01,0x12,0x1d,
+0x88,0x01,0x31,0x3e,0xff,0x30,0x89,0x00,0x21,0xff,0x40,0x61,0x02,0x21,0xfd,0x30,
+0x59,0x01,0x2a,0xe8,0x00,0x01,0x00,0x12,0x12,0x07,0x00,0x13,0x09,0x8f,0x03,0x30,
+0xff,0x60,0x01,0x9e,0x00,0x00,0xb4,0x01,0xf2,0x17,0xc1,0x00,0x00,0x8f,0xfc,0xcc,
+0xce,0xff,0x10,0x00,0x7f,0xf4,0x00,0x00,0xcf,0x90,0x00,0x8f,0xf6,0x22,0x00,0x3f,
+0xf3,0x00,0xbf,0xf6,0x2e,0xf8,0x1c,0xfb,0x00,0x01,0xb3,0x01,0xaf,0xff,0xff,0x20,
+0x07,0x03,0x12,0xd2,0xed,0x00,0x21,0xff,0xe0,0xb6,0x03,0x81,0xb5,0xe4,0x00,0x00,
+0x00,0x5d,0xff,0x90,0xe0,0x03,0x21,0xfe,0x60,0x1c,0x00,0x2d,0xe7,0x00,0x01,0x00,
+0x10,0x18,0x21,0x00,0x50,0xdc,0x50,0x08,0xd6,0xf3,0x3c,0x00,0xb3,0x20,0x01,0xf7,
+0x83,0x00,0x00,0x1e,0xff,0xcc,0xcd,0xf5,0x81,0x00,0x10,0xfc,0x26,0x01,0x90,0x30,
+0x00,0x2f,0xf5,0x00,0x00,0x9f,0xf4,0x10,0x2a,0x03,0xe2,0x1c,0xff,0x53,0xfa,0x11,
+0xef,0x70,0x00,0x08,0xe3,0x07,0xff,0xfc,0xfd,0x1c,0x04,0x22,0xff,0xf8,0x9e,0x01,
+0x00,0x2e,0x03,0x00,0xef,0x00,0x20,0xfa,0xcf,0x94,0x00,0x41,0x4d,0xff,0x80,0x03,
+0x85,0x00,0x11,0xf6,0x1e,0x00,0x22,0x2d,0xf9,0xf8,0x02,0x24,0x01,0x10,0x7d,0x00,
+0xa0,0x01,0x47,0xc2,0x00,0x06,0xab,0xcd,0xef,0xff,0xfc,0x3b,0x00,0x82,0xff,0xa6,
+0x30,0x00,0x00,0x21,0x00,0xef,0xb4,0x03,0x00,0x07,0x00,0x81,0xcc,0xcc,0xcc,0xff,
+0xdc,0xcc,0xc8,0xef,0xb1,0x03,0xb2,0xfa,0x22,0x11,0x13,0xff,0x21,0x11,0x21,0x00,
+0x00,0x05,0x76,0x00,0x13,0x0d,0xe5,0x01,0x10,0xf2,0x06,0x00,0x36,0x19,0xff,0x70,
+0xb6,0x03,0x42,0x00,0x05,0x50,0x00,0x08,0x00,0x10,0x10,0x0c,0x00,0xf0,0x09,0xaf,
+0x70,0x06,0xd7,0x5f,0xd0,0x4f,0xd0,0x0a,0xfb,0x0e,0xf4,0x0e,0xf3,0x0d,0xf5,0x08,
+0xfa,0x05,0x40,0x4f,0xf0,0x02,0x71,0x51,0x01,0x00,0xb6,0x00,0x10,0xfe,0x91,0x00,
+0x10,0x6f,0xf2,0x00,0x61,0x1a,0xff,0x60,0x00,0x00,0x2a,0x86,0x05,0x11,0x1d,0xff,
+0x04,0x22,0x01,0x30,0xa9,0x00,0x10,0x40,0x1f,0x03,0xf1,0x16,0x10,0x3f,0xf0,0x00,
+0x08,0x94,0xbf,0x80,0x0d,0xf6,0x00,0x0d,0xfa,0x5f,0xf0,0x07,0xfc,0x00,0x1f,0xf5,
+0x0e,0xf6,0x01,0xff,0x10,0x5f,0xf0,0x08,0xfc,0x00,0x51,0x00,0xbf,0xa0,0x02,0x82,
+0x00,0x8a,0x02,0x00,0x2b,0x05,0x12,0xfa,0xdd,0x03,0x01,0x9e,0x00,0x30,0x0a,0xff,
+0x50,0xf8,0x01,0x20,0xdf,0xf5,0x94,0x00,0x11,0xbf,0x0d,0x00,0x31,0x0b,0xff,0xc2,
+0x21,0x00,0x11,0x94,0x06,0x00,0x21,0x10,0x00,0x44,0x02,0x12,0xcf,0x9a,0x04,0x54,
+0xbe,0xdd,0xdd,0xdd,0xde,0x26,0x01,0x03,0x35,0x01,0x11,0xaf,0x05,0x01,0x80,0xfd,
+0x9e,0xee,0xee,0xff,0xfe,0xee,0xec,0xe4,0x04,0x02,0x41,0x06,0x22,0xff,0x40,0xd2,
+0x05,0x17,0x10,0x75,0x00,0x22,0xbf,0xf2,0x7c,0x02,0x11,0x50,0xac,0x03,0x1d,0xd3,
+0xf5,0x01,0x12,0x5a,0xae,0x01,0x30,0xe5,0xf6,0x00,0x54,0x00,0x9c,0xce,0x98,0x50,
+0x0f,0xfe,0xee,0xef,0xfa,0x43,0x27,0x00,0x20,0xde,0xee,0x01,0x00,0x22,0xe9,0x0d,
+0x69,0x06,0x24,0x90,0x10,0x6d,0x00,0x32,0x00,0x1f,0xf1,0x41,0x00,0x13,0xfe,0xb2,
+0x03,0x12,0x80,0x76,0x00,0x02,0xcb,0x06,0x13,0xdf,0x30,0x06,0x09,0x77,0x00,0x20,
+0x1f,0xf5,0x05,0x07,0x1a,0xf3,0x05,0x00,0xfb,0x09,0xfa,0x40,0x00,0x00,0x0f,0xff,
+0xfe,0x93,0x00,0x0f,0xfc,0xff,0xff,0xd6,0x0f,0xf3,0x17,0xdf,0xf9,0x0f,0xf3,0x00,
+0x04,0xc2,0x28,0x00,0x20,0x1f,0xf4,0x36,0x01,0xf1,0x0d,0x51,0x00,0x00,0x00,0x26,
+0x60,0x00,0x00,0x65,0x05,0xff,0x00,0x09,0x5a,0xe1,0x4f,0xe0,0x00,0xbe,0x2f,0x74,
+0xfe,0x00,0x02,0xf4,0x10,0x4f,0xe0,0x01,0x01,0x20,0xe9,0x40,0x3c,0x05,0xf2,0x05,
+0xff,0xe8,0x20,0x04,0xff,0x6c,0xff,0xff,0x60,0x4f,0xe0,0x02,0x9f,0xf2,0x04,0xfe,
+0x00,0x00,0x15,0x00,0x21,0x00,0x15,0xfe,0x26,0x05,0x33,0x05,0xff,0x00,0x84,0x07,
+0x12,0x80,0xc0,0x00,0x02,0xd6,0x04,0x00,0x51,0x01,0x81,0x11,0x00,0x00,0xcf,0x70,
+0x00,0x01,0xbf,0xf2,0x00,0x13,0xfc,0x07,0x00,0x00,0x23,0x00,0x02,0x51,0x02,0x02,
+0xdb,0x01,0x13,0x05,0x6d,0x01,0x12,0xfb,0x80,0x02,0x12,0xf4,0x29,0x06,0x11,0x90,
+0x04,0x01,0x12,0xfa,0xca,0x03,0x17,0x60,0xfc,0x00,0x82,0x07,0xff,0xee,0xee,0xee,
+0xfc,0x00,0x07,0x4c,0x00,0x20,0x02,0x33,0x01,0x00,0x1f,0x00,0x01,0x00,0x10,0x11,
+0xdf,0x7e,0x00,0x13,0xf1,0x07,0x00,0x11,0x44,0x01,0x00,0x14,0x50,0x15,0x01,0x00,
+0x08,0x00,0x01,0xe6,0x01,0x63,0xce,0xed,0xdf,0xfe,0xde,0xd1,0x3b,0x02,0x11,0xf6,
+0x2f,0x02,0x13,0x06,0x69,0x06,0x21,0x6f,0xf9,0x07,0x00,0x12,0x1a,0x0f,0x00,0xf2,
+0x0f,0x18,0xff,0xf6,0x1b,0x50,0x00,0x01,0x5a,0xff,0xff,0xf1,0x9f,0xfc,0x20,0x0d,
+0xff,0xfa,0x3f,0xf1,0x07,0xff,0xf1,0x03,0xd6,0x10,0x0f,0xf1,0x00,0x2c,0x60,0xa4,
+0x08,0x27,0x00,0x00,0x08,0x00,0x12,0x0c,0xa1,0x02,0x05,0x05,0x03,0x21,0x6f,0xe2,
+0xdd,0x06,0x02,0x7d,0x03,0x02,0x6f,0x03,0x21,0x5f,0xf1,0x89,0x03,0x12,0xf9,0xe7,
+0x00,0x11,0x20,0x35,0x06,0x11,0x80,0x72,0x04,0x11,0xd0,0x94,0x01,0x20,0xf3,0x00,
+0x4f,0x03,0x11,0xe3,0xce,0x05,0x00,0x9f,0x04,0x03,0xba,0x07,0x13,0x06,0x97,0x07,
+0x42,0x13,0x00,0x01,0x61,0x96,0x01,0x21,0x0e,0xf8,0x4b,0x01,0x31,0xc0,0x07,0xfe,
+0x46,0x01,0x40,0x90,0x00,0xff,0x60,0x65,0x00,0x11,0x50,0x1d,0x07,0x00,0xb0,0x01,
+0x62,0x2f,0xf4,0x00,0x00,0x0a,0xfb,0xe2,0x02,0x20,0x1f,0xf6,0x4a,0x00,0x40,0x00,
+0x00,0x9f,0xe0,0x70,0x00,0x21,0x50,0x02,0x73,0x00,0x31,0xef,0xa0,0x0c,0xc8,0x03,
+0x50,0x9f,0xf0,0x07,0xd6,0x00,0x76,0x04,0x1a,0x70,0x4e,0x01,0x22,0x02,0x30,0x20,
+0x07,0x12,0x7a,0xa7,0x05,0xf2,0x00,0x25,0xf5,0xf6,0x00,0x00,0x8d,0x90,0x2d,0xf2,
+0xb6,0x10,0x00,0x00,0xaf,0xa0,0x39,0x03,0x21,0xdf,0x60,0xdb,0x01,0x31,0x01,0xff,
 0x30,0x1b,0x02,0x22,0x06,0xfe,0xd6,0x05,0x22,0x0c,0xf9,0xc1,0x02,0x22,0x2f,0xf4,
-0xf5,0x01,0x21,0xaf,0xe0,0xc5,0x07,0x01,0xd7,0x18,0x10,0x03,0x19,0x32,0x02,0x2e,
-0x34,0x10,0x2d,0xbd,0x09,0x00,0xc9,0x35,0x17,0x40,0x5f,0x27,0x32,0x00,0x6e,0xc1,
-0x08,0x00,0x20,0xf2,0x89,0xd1,0x09,0x40,0x02,0x71,0xe0,0x6a,0xe8,0x00,0x40,0x2f,
-0xf5,0x9e,0xe3,0xe8,0x00,0x31,0x0b,0xfc,0x01,0x0c,0x0a,0x32,0x03,0xff,0x30,0x0e,
-0x33,0x00,0x1d,0x39,0x21,0x08,0xfd,0x06,0x35,0x01,0xe1,0x04,0x62,0x0f,0xf7,0x00,
-0x00,0x4f,0xf3,0x77,0x01,0x11,0xbf,0x0a,0x16,0x40,0x20,0x04,0xff,0x50,0x66,0x04,
-0x31,0x80,0x0e,0xfd,0xb4,0x00,0x21,0xd0,0x1a,0x10,0x02,0x19,0x8d,0xf4,0x0a,0x03,
-0x7f,0x4f,0x30,0x18,0x4f,0x60,0x29,0x19,0x30,0x0e,0xa9,0xd0,0x08,0x1d,0x21,0x05,
-0xc1,0x0f,0x1d,0x20,0x2a,0x60,0xa2,0x15,0xa0,0x6c,0xff,0xd0,0x00,0x3f,0xf8,0xcf,
-0xff,0xfa,0x40,0xd8,0x13,0x10,0xb6,0x14,0x2d,0x26,0xf9,0x40,0x32,0x1d,0x0b,0x07,
-0x00,0x82,0x2f,0xf7,0x43,0x34,0x57,0x94,0x00,0x0d,0xe2,0x27,0x53,0x01,0x7c,0xde,
-0xed,0xdc,0xdc,0x0c,0x30,0x7e,0x70,0x4f,0xaa,0x1b,0x30,0xe3,0xe1,0x3f,0x8e,0x01,
-0x21,0xc0,0xd2,0x31,0x00,0x20,0xe6,0xe0,0x07,0x00,0x9f,0x18,0xdb,0x40,0x3f,0xe0,
-0x01,0x6b,0xff,0xf0,0x69,0x00,0x26,0x12,0x00,0x69,0x00,0x71,0x55,0x44,0x44,0x44,
-0x45,0x60,0x0e,0x09,0x03,0x72,0xd1,0xbc,0xbb,0xbb,0xbb,0xbe,0xfe,0xb2,0x03,0x16,
-0xa0,0x03,0x0f,0x22,0x07,0xff,0xc4,0x09,0x11,0x80,0x88,0x0a,0x11,0xe0,0x8b,0x01,
-0x20,0xf6,0x00,0x46,0x0f,0x10,0xf9,0xa2,0x24,0x21,0xff,0xf7,0x5b,0x09,0x10,0xd4,
-0x18,0x00,0x26,0x5b,0x50,0x28,0x01,0x12,0x45,0x8b,0x09,0x30,0x99,0xf2,0x13,0x54,
-0x10,0x33,0x9f,0x3d,0x55,0xd2,0x0e,0x10,0x5f,0xfb,0x04,0x03,0x48,0x03,0x29,0x2f,
-0xf3,0x22,0x11,0x22,0xcf,0xa0,0x71,0x09,0x12,0xf3,0xe9,0x07,0x12,0xfa,0xfe,0x1e,
-0x04,0x86,0x07,0x16,0x50,0xe3,0x05,0x10,0x0c,0xfc,0x0a,0x00,0x23,0x00,0x1d,0xb5,
-0xdc,0x03,0x22,0x05,0xec,0xd7,0x05,0x21,0xe3,0x89,0x78,0x00,0x32,0x4f,0x05,0xb5,
-0x6b,0x04,0x12,0xe5,0x78,0x00,0x12,0xb3,0x78,0x00,0x1a,0xf4,0x78,0x00,0x19,0xb0,
-0x78,0x00,0x13,0xfb,0x78,0x00,0x1f,0x30,0x78,0x00,0x01,0x1f,0x30,0x78,0x00,0x01,
-0x28,0x02,0x73,0xcc,0x18,0x00,0x61,0x04,0x12,0xf9,0xcc,0x18,0x32,0x27,0xff,0x80,
-0xcc,0x18,0x22,0x7f,0xf8,0xcc,0x18,0x30,0x09,0xff,0x60,0xcc,0x18,0x00,0xe8,0x0a,
-0x02,0xcc,0x18,0x13,0x0d,0xfa,0x05,0x24,0x01,0xef,0x7b,0x22,0x19,0xb0,0xe7,0x51,
-0x22,0x00,0x7b,0xcc,0x18,0x30,0xbb,0x6f,0x70,0xfc,0x08,0x40,0x30,0x7f,0x5c,0xb0,
-0x40,0x08,0x30,0xf3,0x0d,0x70,0xad,0x0e,0x10,0x5c,0xa5,0x00,0x00,0xc2,0x08,0x22,
-0xcf,0xf3,0x9e,0x04,0x00,0x33,0x0f,0x20,0x2f,0xfc,0x28,0x04,0x50,0xe1,0x00,0x06,
-0xf2,0x00,0x5b,0x15,0x31,0x10,0x00,0x20,0x5b,0x05,0x13,0xc0,0xda,0x0d,0x13,0xd0,
-0x14,0x09,0x12,0x10,0x30,0x01,0x20,0xcb,0x10,0xc0,0x1e,0x40,0x00,0x2f,0x5a,0xb0,
-0x3b,0x07,0x40,0x60,0x3e,0x06,0xc0,0x54,0x04,0x20,0xf7,0x0a,0x7e,0x0a,0x50,0xff,
-0x59,0xff,0x70,0x20,0x3c,0x11,0x32,0x00,0x8f,0xf6,0xdd,0x0c,0x00,0x70,0x07,0x00,
-0x1f,0x03,0x00,0xb8,0x0e,0x30,0x03,0xe3,0x00,0x56,0x34,0x11,0x30,0x49,0x07,0x00,
-0x9d,0x19,0x02,0x20,0x0b,0x13,0xe1,0x51,0x0a,0x17,0x20,0x52,0x05,0x21,0x0e,0xf2,
-0x9f,0x08,0x00,0x48,0x11,0x32,0x01,0x10,0x08,0xf7,0x06,0x30,0x70,0x08,0xee,0xec,
-0x10,0x25,0xee,0x70,0xea,0x1f,0x40,0x04,0x50,0x0e,0xf2,0x48,0x1b,0x50,0x1e,0xf5,
-0x0e,0xf2,0x1f,0xa0,0x0f,0x50,0xb0,0x0e,0xf2,0x07,0xfe,0x00,0x05,0x70,0x0e,0xf2,
-0x00,0xdf,0x90,0x1e,0xf5,0x28,0x00,0x91,0x4f,0xc0,0x01,0x50,0x13,0x2f,0xf2,0x00,
-0x04,0x44,0x38,0x02,0x52,0x05,0x26,0x1b,0xcc,0x17,0x06,0x21,0x16,0x60,0x8e,0x10,
-0x31,0x0c,0xa8,0xf1,0x72,0x05,0x32,0x06,0xf4,0xe4,0x7a,0x05,0x11,0x71,0x8e,0x18,
-0x00,0xad,0x0b,0x04,0x08,0x00,0x05,0x92,0x05,0x60,0x04,0x30,0x0f,0xf1,0x03,0x50,
-0xed,0x17,0x40,0x0f,0xf1,0x2f,0xf2,0xb6,0x04,0x30,0x0f,0xf1,0x09,0x58,0x06,0x00,
-0xc2,0x05,0x40,0xef,0x60,0x1f,0xf5,0x28,0x00,0x71,0x6f,0xc0,0x02,0x60,0x11,0x2f,
-0xf1,0x64,0x1a,0x13,0x5f,0x04,0x27,0x35,0x3d,0xdd,0x70,0x03,0x02,0x12,0xde,0x78,
-0x00,0x31,0x0a,0x72,0xf0,0x58,0x00,0x22,0x09,0xa6,0x08,0x00,0x3f,0x01,0xac,0x40,
-0x78,0x00,0x0a,0x22,0x04,0x40,0x78,0x00,0x22,0x5f,0xe1,0x78,0x00,0x22,0x0b,0xfb,
-0x78,0x00,0x23,0x02,0xff,0x78,0x00,0x1f,0x8f,0x78,0x00,0x06,0x12,0x11,0x13,0x29,
-0x03,0x4f,0x01,0x30,0x80,0x8f,0xfe,0xe1,0x02,0x12,0xfd,0x9a,0x10,0x02,0xbd,0x02,
-0x01,0xb0,0x06,0x30,0x44,0x00,0x04,0x44,0x0e,0x31,0x5f,0xf7,0x04,0x4b,0x0e,0x32,
-0xaf,0xfb,0xff,0x6e,0x15,0x01,0x07,0x00,0x00,0xc7,0x14,0x18,0x00,0xe3,0x10,0x23,
-0x00,0x9f,0x3d,0x0d,0x17,0xbb,0xe0,0x02,0x22,0x46,0x30,0xd6,0x02,0x52,0xd9,0x62,
-0x00,0x00,0x7a,0x16,0x36,0x60,0x00,0x48,0xcf,0xd0,0x00,0x10,0x80,0x00,0x41,0x07,
-0xfe,0xb7,0x40,0xd6,0x1f,0x72,0xff,0xc7,0x00,0x00,0x02,0x69,0xef,0xcf,0x0f,0x51,
-0x76,0x00,0x18,0x52,0x00,0xd3,0x13,0xe2,0xfb,0x83,0x00,0x00,0x59,0xcf,0xff,0xff,
-0xfa,0x50,0x00,0x00,0x37,0xbf,0x22,0x03,0x01,0x31,0x2c,0x23,0x55,0x20,0x8f,0x07,
-0x13,0xa0,0x2a,0x2d,0x19,0x40,0xfd,0x08,0x23,0x0b,0xf9,0x36,0x07,0x15,0xf4,0x4f,
-0x15,0x22,0x6b,0x10,0xc4,0x06,0x22,0xdf,0x90,0xa0,0x09,0x21,0x4f,0xf2,0x2f,0x00,
-0x00,0xb6,0x10,0x82,0x04,0x4c,0xfd,0x9b,0xde,0xff,0xff,0x30,0x51,0x14,0x71,0xff,
-0xa0,0x0b,0xec,0xb9,0x75,0x42,0xed,0x05,0x01,0xab,0x09,0x02,0xed,0x02,0x27,0x71,
-0x00,0x8e,0x26,0x10,0x09,0x39,0x00,0x20,0xa1,0x00,0x21,0x07,0x50,0x5f,0xfe,0x40,
-0x7f,0xf1,0x47,0x0a,0x11,0xfa,0xe6,0x04,0x10,0x09,0x22,0x19,0x01,0x5b,0x07,0x12,
-0x40,0x95,0x21,0x11,0xf6,0x28,0x01,0xd0,0x2e,0xff,0x70,0x00,0x1a,0xff,0xb0,0x02,
-0xef,0xf4,0x06,0xff,0xfa,0x72,0x2c,0x12,0x2e,0xa1,0x0c,0x22,0x02,0xa2,0x57,0x00,
-0x10,0xdd,0x01,0x00,0x12,0x60,0x04,0x2a,0x74,0x60,0x00,0x10,0x0f,0xf4,0x00,0x01,
-0x03,0x03,0x12,0x01,0xc6,0x00,0x13,0x4f,0x43,0x14,0x01,0xf8,0x02,0x15,0xe9,0x1f,
-0x03,0x26,0x0f,0xf3,0x28,0x12,0x00,0x12,0x04,0x31,0xcb,0xcd,0xe2,0x70,0x0c,0x01,
-0xde,0x02,0x44,0x03,0x55,0x54,0x30,0xf0,0x08,0x23,0xe8,0x00,0x62,0x23,0xf1,0x0a,
-0x04,0x72,0x00,0x00,0xff,0x7a,0xdf,0xff,0xd0,0x8b,0xef,0xff,0xfe,0xbf,0xf6,0x09,
-0xff,0xdf,0xb1,0x06,0xfc,0x00,0x22,0x03,0xfe,0xaf,0x35,0x41,0x0e,0xf2,0xaf,0x50,
-0x76,0x21,0x11,0x20,0x5e,0x17,0x16,0x00,0xbb,0x23,0x03,0x6f,0x09,0x29,0x06,0x51,
-0x33,0x05,0x14,0xcd,0x53,0x15,0x00,0xd0,0x01,0x01,0x64,0x14,0x80,0x14,0x7a,0xef,
-0x80,0x00,0x02,0xcf,0xee,0x07,0x11,0x00,0x35,0x2b,0xf0,0x01,0xea,0x79,0xff,0x20,
-0x0e,0xfe,0xbf,0xf4,0x00,0x1e,0xf7,0x00,0x03,0x20,0x0d,0xf7,0x1c,0x37,0x00,0x02,
-0x31,0x13,0x0b,0x19,0x23,0x27,0x01,0x74,0x33,0x0b,0x03,0xfe,0x0b,0x12,0x00,0xc9,
-0x35,0x13,0x00,0x58,0x3b,0x01,0x07,0x04,0x08,0x1e,0x14,0x00,0x3e,0x02,0x11,0x20,
-0x48,0x1a,0x10,0xfd,0xd9,0x52,0x26,0xee,0xff,0x25,0x12,0x02,0xcb,0x11,0x23,0x09,
-0xf9,0x00,0x20,0x10,0x9f,0xd3,0x15,0x23,0xfe,0x9f,0x2b,0x16,0x04,0x3c,0x00,0x00,
-0xee,0x0c,0x02,0x02,0x25,0x13,0x00,0x4d,0x0a,0x12,0x11,0x52,0x08,0x06,0x02,0x10,
-0x28,0x0f,0xf4,0x7f,0x00,0x03,0xc9,0x0f,0x32,0x8f,0xc0,0x00,0x9c,0x16,0x13,0xfe,
-0x07,0x00,0x02,0xf6,0x16,0x12,0x23,0x24,0x00,0x00,0x8f,0x00,0x50,0x5d,0xdd,0xdd,
-0xdd,0xfd,0xb6,0x01,0x10,0xfd,0xd3,0x28,0x20,0xfd,0x0f,0x14,0x00,0x42,0x0b,0xcc,
-0xcc,0xcc,0x14,0x00,0x60,0x11,0x11,0x11,0x12,0xfd,0x8f,0x14,0x00,0xc1,0x7c,0xcc,
-0xcc,0xcc,0xfe,0x9c,0xcb,0xbb,0xbb,0xbb,0xc4,0xbf,0x57,0x07,0x00,0x9c,0x10,0x12,
-0x3d,0x03,0x1c,0x03,0x06,0x00,0x01,0x7a,0x13,0x03,0x06,0x00,0x08,0x18,0x00,0x10,
-0x11,0xe9,0x01,0x21,0xf5,0xef,0x18,0x00,0x10,0xef,0xa5,0x13,0x11,0xf5,0xfe,0x00,
-0x11,0x52,0x4c,0x05,0x12,0x10,0xdd,0x10,0x20,0x10,0x07,0xb3,0x06,0x13,0xe1,0xf2,
-0x00,0x10,0x32,0xa5,0x00,0x12,0x31,0x33,0x2a,0x20,0xe3,0xcc,0x44,0x13,0x16,0xff,
-0x01,0x1a,0x00,0xba,0x0e,0x01,0x54,0x29,0x11,0x00,0x8f,0x23,0x00,0xe3,0x01,0x12,
-0xbf,0x3b,0x42,0x11,0xf9,0x67,0x2f,0x08,0xa4,0x1b,0x00,0xd7,0x23,0xae,0xff,0x50,
-0x00,0x05,0xfe,0xef,0x50,0x00,0x04,0xfe,0x05,0x00,0x92,0x05,0xfd,0xef,0x50,0x00,
-0x06,0xfc,0xef,0x50,0x81,0x01,0x20,0x1f,0xf5,0x7e,0x19,0x90,0xe0,0x00,0x01,0x7f,
-0xff,0x30,0x00,0x5f,0xff,0x24,0x15,0x06,0xee,0x0e,0x42,0x33,0x00,0x33,0x10,0x8d,
-0x17,0x22,0xff,0x40,0x19,0x13,0x01,0x6d,0x10,0x1c,0x03,0x08,0x00,0x12,0xfd,0x08,
-0x00,0x22,0x05,0xfc,0x08,0x00,0x20,0x06,0xfb,0xcd,0x10,0x10,0x60,0xd5,0x16,0x40,
-0xef,0x30,0x2e,0xf2,0x89,0x0c,0x40,0xef,0x34,0xef,0xd0,0x94,0x0a,0x50,0xef,0xcf,
-0xfc,0x10,0x07,0x33,0x3b,0xf0,0x01,0xff,0xa0,0x00,0x1e,0xf9,0x00,0x00,0xef,0xe5,
-0x00,0x00,0x01,0x70,0x00,0x00,0x28,0x5f,0x00,0x12,0x21,0x66,0x02,0x11,0x60,0xe3,
-0x01,0x18,0xf4,0xa0,0x17,0x07,0x0d,0x00,0x11,0x10,0x0d,0x00,0x20,0x5e,0x10,0x0d,
-0x00,0xf1,0x05,0x6f,0xf6,0x0e,0xf4,0x00,0x01,0xaf,0xf9,0x00,0xef,0x40,0x06,0xef,
-0xf8,0x00,0x0e,0xf6,0x7e,0xff,0xe3,0x23,0x23,0x10,0x70,0x68,0x03,0x11,0xc6,0x1b,
-0x04,0x11,0x20,0x55,0x0a,0x01,0x01,0x00,0x12,0x0f,0x12,0x0c,0x20,0xff,0xfe,0x71,
-0x02,0x12,0x1f,0xcc,0x25,0x01,0x59,0x35,0x2f,0xff,0x0f,0x0d,0x00,0x07,0x00,0xa4,
-0x31,0x22,0xdf,0xf0,0x85,0x05,0x20,0x1f,0xf5,0x74,0x08,0x20,0xf1,0x77,0x15,0x01,
-0x30,0x77,0x00,0x2d,0xa7,0x01,0x32,0xde,0x80,0x2f,0x16,0x2e,0x91,0x2f,0xf3,0x22,
-0x22,0x22,0x7f,0xf1,0x2f,0xf0,0x85,0x07,0x01,0x07,0x00,0x40,0xbf,0xa0,0x3f,0xf1,
-0x44,0x00,0x30,0x60,0x02,0x20,0x5a,0x10,0x11,0x10,0xca,0x01,0x12,0xf8,0x7f,0x1a,
-0x11,0xd0,0x41,0x03,0x10,0xfe,0xe0,0x19,0x31,0x8e,0xff,0xd2,0x15,0x17,0x12,0xf8,
-0x0c,0x13,0x18,0x10,0xf7,0x28,0x13,0xa0,0xe3,0x12,0x13,0xd2,0x08,0x00,0x11,0xf4,
-0x9c,0x0f,0x10,0x03,0x63,0x3f,0x54,0xe8,0x00,0x00,0x02,0x90,0xb3,0x09,0x00,0xfb,
-0x3d,0x01,0x07,0x00,0x12,0xf9,0xf5,0x0e,0x02,0xcf,0x23,0x01,0x06,0x42,0x30,0x02,
-0x7e,0xff,0x24,0x07,0x41,0xae,0xff,0xff,0xa2,0xe1,0x10,0x21,0xfa,0x20,0x84,0x03,
-0x12,0x30,0xc7,0x09,0x10,0x54,0x23,0x0a,0x22,0x51,0xbf,0xc4,0x00,0x03,0x07,0x00,
-0x12,0x10,0x84,0x03,0x22,0x01,0x11,0x01,0x00,0x03,0x9c,0x15,0x14,0xf9,0x08,0x00,
-0x00,0xd3,0x0c,0x03,0x02,0x04,0x0f,0x08,0x00,0x0e,0x41,0xfe,0xee,0xee,0x20,0xac,
-0x19,0x02,0x6e,0x11,0x0f,0x38,0x00,0x12,0x83,0x01,0x11,0x11,0x7f,0xa1,0x11,0x11,
-0x10,0x70,0x00,0x43,0xf7,0x1d,0xdd,0xdd,0xbe,0x2f,0x01,0x01,0x00,0x13,0x20,0x18,
-0x00,0x97,0xf2,0x1b,0xbb,0xbb,0xdf,0xeb,0xbb,0xbb,0xb1,0x22,0x22,0x05,0x08,0x00,
-0x23,0xfe,0x70,0xf0,0x03,0x02,0xc2,0x11,0x51,0x5f,0xb3,0xcf,0xfc,0x20,0x20,0x00,
-0x32,0x06,0xfd,0x10,0x28,0x00,0x2e,0x22,0x00,0x38,0x00,0x0a,0x08,0x00,0x21,0x0a,
-0xbb,0x01,0x00,0x23,0xa0,0x0e,0x9c,0x16,0x71,0x03,0x33,0x33,0x4d,0xfc,0x33,0x33,
-0x93,0x09,0x13,0xf3,0x10,0x16,0x22,0xf2,0x60,0x7b,0x14,0x21,0xfe,0xfa,0x40,0x0e,
-0x40,0xbf,0xf4,0xef,0xd3,0x91,0x02,0x30,0x0f,0xf0,0x1c,0x22,0x3e,0x80,0x70,0x0f,
-0xf0,0x00,0xaf,0xf4,0x0a,0xc2,0xfe,0x1e,0x20,0x0a,0x90,0xb2,0x04,0x03,0x5d,0x2f,
-0x0f,0x08,0x00,0x02,0x21,0x2a,0xaa,0x01,0x00,0x11,0xa2,0x51,0x02,0x00,0x44,0x3f,
-0x74,0x22,0x22,0x2f,0xe2,0x22,0x22,0x20,0x53,0x24,0x04,0x0a,0x08,0xf8,0x07,0x08,
-0xfc,0xbb,0xbf,0xfb,0xbb,0xdf,0x80,0x08,0xf5,0x23,0x0f,0xd0,0x11,0x5f,0x80,0x08,
-0xf5,0xbd,0x0f,0xd0,0xfb,0x08,0x00,0x13,0xbe,0x08,0x00,0x31,0xbf,0xff,0xff,0x08,
-0x00,0x40,0x79,0x99,0x99,0x96,0x08,0x00,0x01,0x58,0x2b,0x11,0x70,0x08,0x00,0x20,
-0x2f,0xfb,0x64,0x05,0x02,0x70,0x05,0x08,0x07,0x00,0x82,0xad,0xdd,0xdd,0xff,0xdd,
-0xdd,0xd2,0xcf,0x63,0x01,0xa8,0xcf,0x20,0x02,0xfe,0x00,0x0d,0xf2,0xcf,0x20,0x01,
-0x07,0x00,0x64,0xba,0xab,0xff,0xaa,0xaf,0xf2,0x23,0x00,0x70,0x42,0x24,0xfe,0x22,
-0x2d,0xf2,0x23,0x3f,0x00,0x2e,0x02,0x20,0x54,0x00,0x04,0xcb,0x02,0x50,0x24,0x70,
-0x00,0x01,0x89,0xb4,0x12,0x02,0xd1,0x05,0xd2,0xfb,0x97,0x41,0x00,0x00,0x55,0x43,
-0x3f,0xe3,0x33,0x33,0x00,0x03,0xd9,0x00,0xf3,0x02,0x40,0x01,0x59,0xf9,0x5f,0xe5,
-0xaf,0x95,0x10,0x19,0x9c,0xfc,0x9f,0xf9,0xcf,0xc9,0x91,0xe9,0x01,0xa2,0xf1,0x00,
-0x07,0xf7,0x0f,0xe0,0x8f,0x60,0x00,0x04,0x18,0x00,0x23,0x50,0x07,0x09,0x01,0x00,
-0x2a,0x13,0x01,0x9a,0x0c,0xf0,0x02,0x4a,0xff,0x6f,0xe8,0xff,0xb5,0x00,0x2e,0xff,
-0xb2,0x0f,0xe0,0x3c,0xff,0xf2,0x07,0x92,0x67,0x20,0x31,0x3a,0x60,0x5a,0x50,0x01,
-0x22,0x60,0x7f,0xd6,0x02,0x51,0x13,0x33,0x33,0x33,0x3c,0x9f,0x09,0x32,0x01,0xcf,
-0xe4,0x1b,0x09,0x21,0x10,0x00,0x7f,0x1d,0x02,0x5d,0x04,0x1f,0x10,0x07,0x00,0x13,
-0x32,0x0d,0xee,0xff,0x83,0x09,0x18,0xc5,0x13,0x1a,0x41,0xb3,0x00,0x02,0xf9,0xf1,
-0x29,0x31,0x12,0x02,0xf9,0x07,0x30,0xf1,0x2e,0xdf,0x02,0xf9,0x03,0x10,0x00,0xcf,
-0x40,0xdf,0x02,0xfc,0xbf,0xd0,0x06,0xff,0x10,0xdf,0x28,0xff,0xff,0xd0,0x2f,0xff,
-0x10,0xdf,0xff,0xfd,0x5f,0xc0,0xaf,0xff,0x7d,0xff,0xeb,0xf9,0x0f,0xc0,0x3d,0xdf,
-0x7f,0xff,0x12,0xf9,0x0f,0xc0,0x01,0xcf,0x23,0xdf,0x02,0xf9,0x0f,0xb0,0x00,0xcf,
-0x10,0xdf,0x02,0xfb,0xff,0x90,0x08,0x00,0x30,0xf9,0xa9,0x10,0x08,0x00,0x90,0x00,
-0x10,0x05,0xc3,0x00,0xcf,0x10,0xcf,0x20,0x05,0x1f,0xf1,0x04,0xcf,0x10,0x9f,0xfe,
-0xee,0xff,0xe0,0x00,0xcf,0x10,0x19,0xbc,0xcc,0xca,0x30,0x00,0x00,0xaa,0x20,0xeb,
-0x22,0x01,0x9a,0x1d,0x13,0xfe,0x39,0x28,0x12,0xfe,0x5f,0x3d,0x00,0x7b,0x01,0x21,
-0xbf,0xe2,0x92,0x08,0xb1,0x06,0xff,0xd2,0xdd,0xdd,0xde,0xff,0xd9,0x2f,0xff,0xd0,
-0x20,0x00,0xd1,0x0c,0xcf,0xd0,0x2b,0x90,0x00,0xfe,0x00,0x02,0x2f,0xd0,0x0e,0xf4,
-0x30,0x00,0x32,0xd0,0x05,0xfd,0x08,0x00,0x32,0x00,0xce,0x20,0x08,0x00,0x13,0x10,
-0x10,0x00,0x22,0x00,0x01,0x08,0x00,0x31,0x5d,0xcd,0xfc,0x08,0x00,0x4e,0x1f,0xff,
-0xc4,0x00,0xe0,0x32,0x40,0xd5,0x10,0x0a,0xf3,0x00,0x01,0x41,0xf3,0x8f,0x5a,0xf3,
-0x0a,0x17,0x31,0xcf,0x2a,0xf3,0x7e,0x47,0x81,0xff,0xae,0xfc,0xaa,0x60,0x05,0xff,
-0x15,0x0a,0x13,0xc0,0x1e,0xff,0x1c,0xf5,0x2b,0xf6,0x22,0x10,0x8f,0xff,0x2d,0xc0,
-0x30,0x00,0x40,0x2e,0xdf,0x10,0x20,0x08,0x00,0xb2,0x02,0xbf,0x1d,0xdd,0xdf,0xfe,
-0xdd,0xd4,0x00,0xbf,0x1f,0x4b,0x07,0x21,0xbf,0x10,0x9d,0x26,0x01,0x08,0x00,0x1f,
-0xf3,0x08,0x00,0x08,0x08,0x12,0x19,0x21,0x00,0x02,0x82,0x10,0x20,0x02,0x59,0xa3,
-0x39,0xc0,0xfd,0xbd,0xff,0xff,0xfc,0x81,0x00,0x1f,0xf4,0xce,0xca,0xfd,0x46,0x07,
-0x40,0xd0,0x00,0x01,0xfd,0xa1,0x03,0x11,0xc0,0x08,0x00,0x13,0x4f,0x08,0x00,0x30,
-0x1e,0xbf,0xc8,0x03,0x1a,0x42,0xdb,0x04,0x1f,0xc9,0x64,0x08,0x12,0x1f,0x18,0x00,
-0x0f,0x08,0x00,0x08,0x11,0xff,0x6b,0x36,0x20,0x1f,0xc0,0x92,0x04,0x10,0xd9,0x78,
-0x00,0x21,0x06,0xa0,0xe7,0x02,0x00,0x2c,0x2e,0x10,0x00,0xe9,0x39,0x21,0x06,0xf7,
-0xe9,0x13,0x81,0xdd,0xde,0xed,0xdd,0xc0,0x00,0xaf,0xb0,0x3a,0x04,0xf0,0x10,0x06,
-0xff,0xa0,0x03,0x50,0x00,0x56,0x10,0x1f,0xff,0xa0,0x0e,0xe0,0x00,0xdf,0x20,0x0b,
-0xcf,0xa0,0x0c,0xf1,0x00,0xff,0x00,0x02,0x4f,0xa0,0x09,0xf4,0x01,0xfc,0x1e,0x38,
-0x40,0x06,0xf7,0x04,0xf9,0x08,0x00,0x40,0x04,0xf9,0x07,0xf5,0x08,0x00,0x40,0x02,
-0xfb,0x0a,0xf1,0x08,0x00,0x91,0x01,0x61,0x0e,0xe0,0x00,0x00,0x3f,0xa8,0xff,0x91,
-0x23,0x20,0x3f,0xa6,0x74,0x06,0x51,0xc6,0x00,0x03,0x51,0x00,0xa7,0x18,0x90,0x0b,
-0xf5,0x03,0x69,0xcf,0xff,0x80,0x00,0x2f,0xea,0x3e,0x80,0x84,0x00,0x00,0x9f,0x61,
-0xfd,0x52,0xcf,0x0f,0x02,0x20,0x21,0xfa,0x24,0x01,0xf1,0x04,0x0c,0xff,0x11,0xfa,
-0x00,0xaf,0x20,0x00,0x9f,0xff,0x11,0xfe,0xbb,0xef,0xcb,0xb2,0x7f,0xdf,0x11,0x5a,
-0x04,0x50,0x04,0xbf,0x11,0xfb,0x00,0x72,0x0e,0x62,0xbf,0x11,0xfa,0x00,0x4f,0x90,
-0x08,0x00,0x21,0x1f,0xc0,0x08,0x00,0xf6,0x0c,0x0b,0x5d,0xf1,0xc4,0x00,0xbf,0x12,
-0xfc,0x7e,0xd8,0xfb,0xf7,0x00,0xbf,0x19,0xff,0xfa,0xf5,0xef,0xf2,0x00,0xbf,0x15,
-0xd7,0x30,0xa3,0x4c,0x2a,0x11,0x21,0x09,0xa2,0x25,0x30,0x00,0xd1,0x14,0x01,0x08,
-0x00,0x22,0x7f,0xa0,0x08,0x00,0x20,0xdf,0x4c,0xcd,0x1b,0x41,0xc3,0x06,0xff,0x1f,
-0x73,0x03,0x20,0x1e,0xff,0x35,0x1a,0x00,0x80,0x00,0x00,0x16,0x0e,0x10,0x80,0xf0,
-0x01,0xd0,0x0f,0xbf,0xec,0xe0,0x00,0x02,0xbf,0x10,0x7f,0x4f,0xe4,0xf7,0x00,0x68,
-0x00,0xf0,0x0d,0x0f,0xe0,0xdf,0x20,0x00,0xbf,0x1c,0xf5,0x0f,0xe0,0x5f,0xc0,0x00,
-0xbf,0xaf,0xcf,0xff,0xff,0xfc,0xf8,0x00,0xbf,0x3b,0x1b,0xbf,0xfb,0xb2,0xa0,0xc4,
-0x00,0x22,0x0f,0xe0,0xf0,0x01,0x20,0x0e,0xd0,0xe3,0x01,0x31,0x40,0x00,0x41,0x7e,
-0x03,0x31,0xf8,0x04,0xfc,0xf7,0x0a,0x32,0xf1,0x0b,0xf6,0x26,0x09,0x10,0x3f,0x7e,
-0x10,0xd1,0x06,0xff,0x20,0xcf,0xef,0xfd,0xdd,0xd5,0x3f,0xff,0x28,0xfd,0x1f,0xd4,
-0x25,0xb0,0x4f,0xf3,0x1f,0xfa,0xaa,0xa0,0x2d,0xdf,0x23,0x50,0x1f,0x2b,0x21,0x22,
-0xcf,0x20,0x6e,0x32,0x08,0x08,0x00,0x00,0x3d,0x2a,0x00,0x08,0x00,0x39,0xfc,0xcc,
-0xc2,0x18,0x00,0x08,0x08,0x00,0x0d,0xf0,0x02,0x10,0xd4,0xe8,0x4a,0x00,0xe4,0x09,
-0x02,0x08,0x00,0x22,0x5f,0xee,0x85,0x2a,0x20,0xcf,0x7b,0x9b,0x05,0x10,0xb2,0xd3,
-0x13,0x20,0x0e,0xf0,0xa0,0x09,0x11,0x29,0x15,0x1e,0xf2,0x03,0xcf,0xff,0x29,0xf9,
-0x8f,0xf8,0x8f,0xc0,0x6c,0xbf,0x29,0xf1,0x0e,0xf0,0x0f,0xc0,0x00,0xaf,0x18,0x00,
-0xd1,0x00,0xaf,0x25,0xb8,0x9f,0xe8,0x88,0x60,0x00,0xaf,0x24,0xfa,0x6f,0x6e,0x38,
-0x41,0x20,0x7f,0xff,0x40,0x08,0x00,0x21,0x3e,0xff,0x61,0x13,0xf3,0x02,0x6d,0xff,
-0x99,0xff,0xfe,0xc2,0x00,0xaf,0x2b,0xa3,0x00,0x05,0x9c,0xa0,0x00,0x03,0x71,0x18,
-0x08,0x00,0x49,0x46,0x00,0x16,0x20,0xa0,0xe1,0xfe,0xaa,0xaa,0xef,0x20,0x00,0xaf,
-0x70,0xfc,0xad,0x00,0x31,0x04,0xff,0x20,0x08,0x00,0x20,0x2e,0xff,0x93,0x31,0x00,
-0x12,0x3e,0x82,0x20,0xaa,0xaf,0xfa,0xaa,0x10,0x4d,0xbf,0x90,0x00,0x32,0x01,0xaf,
-0x3f,0x57,0x1b,0xb0,0xaf,0x3c,0xcc,0xff,0xff,0xcc,0xb0,0x00,0xaf,0x20,0x07,0xe6,
-0x33,0x00,0x78,0x00,0x20,0xce,0xfb,0xf5,0x4a,0xf2,0x05,0x4b,0xfd,0x1e,0xf1,0xef,
-0x90,0x00,0xaf,0x6f,0xc1,0x0e,0xf0,0x2e,0xd1,0x00,0xaf,0x23,0x00,0x0e,0xf0,0x9b,
-0x2c,0x04,0x83,0x18,0x01,0x0f,0x3c,0x00,0xd5,0x3a,0x11,0x80,0x59,0x2f,0x30,0x00,
-0x0c,0xe0,0x56,0x0e,0x10,0x6e,0xf4,0x0c,0xf0,0x01,0xe0,0x02,0xff,0x29,0x99,0x99,
-0x99,0x99,0x90,0x0d,0xff,0x10,0x78,0x88,0x88,0x87,0xf8,0x01,0x10,0xcf,0xff,0x3b,
-0x31,0x4d,0xbf,0x10,0xbd,0x15,0x41,0x01,0xaf,0x10,0xdf,0xf8,0x45,0x20,0xaf,0x10,
-0xca,0x07,0x42,0x00,0x00,0xaf,0x11,0xb9,0x17,0x60,0xaf,0x11,0xfc,0x88,0x88,0xdf,
-0x08,0x00,0x11,0xf8,0xb3,0x39,0x06,0x10,0x00,0x50,0xee,0xff,0xff,0xed,0x10,0xd8,
-0x3c,0x40,0x26,0x20,0x00,0x00,0xc5,0x00,0x01,0xfc,0x0c,0x32,0x5f,0x90,0x03,0xf2,
-0x1e,0xf0,0x2e,0x30,0x1e,0xfd,0x88,0xdf,0x60,0x04,0xff,0x00,0xbf,0xef,0x56,0xfc,
-0x00,0x0d,0xfe,0x2f,0x76,0x0c,0xff,0xd1,0x00,0x8f,0xfe,0x2f,0x64,0xaf,0xff,0xfa,
-0x51,0x5f,0xfe,0x2f,0xef,0xf9,0x35,0xcf,0xf5,0x04,0xde,0x2f,0x86,0x04,0xde,0x12,
-0x50,0x00,0xde,0x2f,0x64,0xef,0xb2,0x74,0x00,0x00,0xde,0x2f,0x60,0x73,0x5d,0xf5,
-0x08,0x00,0xf0,0x03,0x63,0xbf,0xfa,0x2a,0x91,0x00,0xde,0x2b,0x40,0x96,0x27,0xef,
-0x70,0x00,0xde,0x00,0x17,0xae,0x27,0x09,0x52,0xde,0x00,0x0b,0xd9,0x50,0xc2,0x15,
-0x20,0x06,0x70,0x7b,0x07,0x10,0xf7,0xc9,0x26,0x00,0x2e,0x0b,0x81,0xbb,0xbe,0xfc,
-0xbb,0xa0,0x00,0x8f,0x84,0x48,0x01,0xf2,0x0c,0x04,0xff,0x20,0x2d,0x80,0x03,0xf9,
-0x00,0x2e,0xff,0x10,0x0e,0xe0,0x09,0xf4,0x00,0x8f,0xff,0x19,0x9d,0xda,0x9f,0xfa,
-0x94,0x1c,0xcf,0x1f,0xb0,0x03,0x23,0xbf,0x10,0x62,0x2a,0xa0,0x10,0x7a,0xaa,0xaa,
-0xaa,0x10,0x00,0xbf,0x10,0xaf,0xb8,0x01,0x00,0x08,0x00,0x39,0x10,0x00,0xbf,0x08,
-0x00,0x31,0xbb,0xbb,0xef,0x08,0x00,0x02,0x87,0x28,0x04,0x13,0x0e,0x41,0xb3,0x00,
-0x00,0xff,0x01,0x0b,0x82,0x44,0x45,0xfe,0x44,0x42,0x00,0x5f,0xc4,0x66,0x13,0x70,
-0xcf,0x62,0x88,0x8a,0xfd,0x88,0x83,0x76,0x15,0xf0,0x09,0x59,0xfc,0x66,0x50,0x1e,
-0xff,0x17,0xb0,0xdf,0xff,0xff,0xc0,0xaf,0xff,0x1a,0xf1,0xdf,0x33,0x4f,0xc0,0x4e,
-0xdf,0x1a,0xf1,0x10,0x00,0xa2,0x02,0xbf,0x1a,0xf1,0xde,0x22,0x3f,0xc0,0x00,0xbf,
-0x10,0x00,0x11,0x00,0x10,0x00,0x19,0x4f,0x10,0x00,0x10,0x33,0x05,0x30,0x31,0xbf,
-0x1a,0xff,0x18,0x28,0x20,0xbf,0x17,0x32,0x07,0x10,0xa5,0x68,0x03,0x20,0x16,0x30,
-0xb8,0x00,0x30,0x40,0x02,0xfc,0xe7,0x01,0x11,0xea,0x46,0x34,0xb0,0x09,0xf7,0xaf,
-0xa9,0x99,0x9c,0xfb,0x03,0xff,0x1a,0xf1,0xb9,0x22,0xf0,0x0b,0xdf,0xf1,0xaf,0xee,
-0xee,0xef,0xfb,0x9f,0xff,0x1b,0xfc,0xcc,0xcc,0xcc,0x85,0xfd,0xf1,0xbf,0x87,0x77,
-0x77,0x77,0x04,0xbf,0x1c,0xef,0x1c,0x01,0xf1,0x03,0x0b,0xf1,0xdc,0xf6,0xd5,0xd5,
-0x8e,0x00,0xbf,0x1f,0xaf,0xbe,0xae,0xac,0xe0,0x0b,0xf3,0xf8,0xe0,0x0d,0xf1,0x07,
-0xbf,0x8f,0x3f,0x6d,0x5d,0x58,0xe0,0x0b,0xfc,0xe0,0xf6,0xd5,0xda,0xce,0x00,0xbf,
-0x58,0x0f,0x6d,0x5d,0x9c,0x60,0x70,0x0a,0x81,0x10,0x00,0x00,0x03,0x60,0x00,0x19,
-0x90,0x1d,0x10,0x82,0x88,0x8f,0xf8,0x88,0x80,0x00,0x2f,0xbe,0x01,0x08,0x60,0x9f,
-0x50,0x55,0x55,0x55,0x55,0xc2,0x2f,0x01,0x53,0x37,0x93,0x0c,0xff,0x00,0xfc,0x11,
-0x11,0xdf,0x00,0x7f,0x10,0x00,0xb3,0x1e,0xef,0x02,0x66,0x66,0x66,0x66,0x20,0x01,
-0xcf,0x3f,0x88,0x03,0x90,0x3f,0x83,0x33,0x33,0x39,0xf3,0x00,0xcf,0x2c,0x70,0x02,
-0xb1,0xc2,0x00,0xcf,0x00,0x58,0x8f,0xf8,0x84,0x00,0x00,0xcf,0x43,0x02,0x00,0x08,
-0x00,0x22,0x0a,0xbf,0x08,0x00,0x28,0x0b,0xed,0xf0,0x16,0x11,0x0d,0xf8,0x09,0x60,
-0xf0,0x00,0x4f,0xae,0xff,0xfe,0x08,0x00,0xf0,0x0c,0xaf,0x5e,0xd7,0xde,0x3f,0x5a,
-0xf0,0x01,0xff,0x0e,0xa1,0xce,0x3f,0x5a,0xf0,0x09,0xfe,0x0e,0xff,0xfe,0x3f,0x5a,
-0xf0,0x3f,0xfe,0x0e,0xc5,0x18,0x00,0x40,0xaf,0xfe,0x0e,0xb3,0x18,0x00,0x22,0x3c,
-0xee,0x18,0x00,0x22,0x01,0xde,0x10,0x00,0x52,0x00,0xde,0x0e,0xc4,0xde,0x08,0x00,
-0x21,0xff,0xfe,0x08,0x00,0xb0,0x07,0xb5,0x97,0x29,0x3a,0xf0,0x00,0xde,0x0c,0xf4,
-0xed,0xfe,0x3e,0xe6,0xde,0x8f,0x80,0x6f,0x56,0xcf,0xf0,0x00,0xde,0x4a,0x00,0x05,
-0x03,0xfd,0xde,0x12,0xb1,0x0c,0x90,0x09,0xf3,0x0d,0xf0,0x00,0x00,0x2f,0xe0,0x0a,
-0x08,0x00,0x22,0x8f,0x8d,0xb0,0x03,0xf1,0x03,0xef,0x39,0xae,0xfc,0xaf,0xfa,0xa0,
-0x06,0xff,0x25,0x5c,0xf8,0x5e,0xf5,0x51,0x0e,0xff,0x5f,0x60,0x05,0xb1,0x8f,0xff,
-0x14,0xef,0x74,0x44,0x44,0x41,0x3f,0xff,0x1b,0xd3,0x20,0xf0,0x08,0x03,0xdf,0xdf,
-0xfe,0x8c,0xfa,0x9f,0xb0,0x00,0xdf,0x5b,0xfe,0xad,0xfb,0xaf,0xb0,0x00,0xdf,0x01,
-0xfe,0xbd,0xfc,0xbf,0x08,0x00,0x40,0xfd,0x6b,0xf7,0x6f,0x08,0x00,0x00,0x28,0x00,
-0x00,0x08,0x00,0x42,0xfb,0x08,0xf4,0x8f,0x08,0x00,0x82,0xf3,0xed,0x50,0x00,0x02,
-0x40,0x03,0x61,0x9d,0x27,0x40,0x1e,0xf8,0x67,0x10,0x58,0x05,0x20,0xbf,0xff,0x26,
-0x20,0xa1,0xaf,0x9c,0xfc,0x33,0xef,0x43,0x20,0x04,0xff,0xbf,0x01,0x02,0xb1,0x1e,
-0xff,0x16,0xf9,0x19,0xf2,0x2f,0xa0,0x8f,0xff,0x01,0x10,0x00,0xf7,0x2f,0x1d,0xdf,
-0x00,0x6c,0xff,0x66,0x68,0x40,0x00,0xcf,0x28,0xdf,0xcf,0x70,0x7f,0x90,0x00,0xcf,
-0x19,0x96,0xbf,0xfe,0xfd,0x20,0x00,0xcf,0x15,0xbf,0xb7,0xfc,0xce,0x00,0x00,0xcf,
-0x19,0xb5,0x9f,0xfb,0x4f,0x80,0x00,0xcf,0x14,0xaf,0xf6,0xec,0x0c,0xf7,0x00,0xcf,
-0x3e,0xf9,0x7a,0xfa,0x01,0xc3,0x00,0xcf,0x02,0x10,0x6f,0xc2,0x78,0x01,0x10,0x7a,
-0x77,0x02,0x12,0xa7,0xbc,0x1e,0x00,0x7d,0x11,0x02,0xea,0x0b,0x0d,0x77,0x05,0x04,
-0xfa,0x0b,0x80,0x1c,0xcc,0xef,0xec,0xdf,0xfc,0xcc,0xc2,0x8b,0x4e,0x00,0x20,0x06,
-0x00,0xa9,0x02,0x22,0x0f,0xe0,0x8f,0x3f,0x31,0x0f,0xe0,0x01,0xbd,0x41,0x40,0x0f,
-0xe0,0x05,0xf4,0xa8,0x0b,0x50,0x0f,0xf0,0x07,0xf5,0x2d,0x18,0x4d,0xc6,0xfd,0xcf,
-0xf1,0x0d,0xd4,0x00,0x00,0x06,0xef,0xff,0x80,0x01,0x53,0x00,0x2a,0x15,0x40,0xd8,
-0x14,0x22,0x0c,0xe5,0xf3,0x2b,0x02,0x1d,0x27,0xd0,0xcc,0xef,0xfd,0xcc,0xdd,0xcc,
-0xc0,0x00,0x01,0xdf,0x90,0x03,0xdb,0x0f,0x15,0xa0,0xf9,0x00,0x00,0xaf,0xd1,0x00,
-0x01,0xff,0xfe,0xef,0xd8,0x10,0xf0,0x00,0x00,0xdf,0xff,0xfd,0xdf,0xfa,0xdf,0xa0,
-0x00,0x44,0x4f,0xf0,0x2f,0xe0,0x2a,0x29,0x2f,0x32,0xc0,0x2f,0xe0,0xb4,0x32,0xf0,
-0x08,0x2f,0xe0,0x04,0xc4,0x00,0x1c,0xfe,0x10,0x2f,0xe0,0x06,0xf7,0x1b,0xff,0xe3,
-0x00,0x1f,0xfd,0xcf,0xf3,0x0a,0xfb,0x20,0x60,0x28,0x15,0x90,0xca,0x1d,0x22,0x06,
-0x71,0x02,0x0c,0x32,0x0d,0xf4,0x0f,0xb2,0x27,0x52,0xf3,0x2f,0xf2,0x22,0x22,0x30,
-0x0d,0x00,0x28,0x05,0x60,0xdf,0xba,0xaf,0xfa,0xaa,0xa9,0x61,0x32,0x02,0x20,0x00,
-0x12,0x62,0x08,0x00,0x04,0x19,0x0b,0x60,0x1d,0xdd,0xef,0xfd,0xdf,0xfd,0xf8,0x34,
-0x22,0x6f,0x80,0x21,0x00,0x21,0xbf,0x50,0x08,0x00,0x10,0x03,0xc2,0x38,0xa0,0x06,
-0x70,0x00,0x3e,0xf8,0x00,0x0f,0xf0,0x09,0xf2,0xf2,0x21,0x60,0x0e,0xfd,0xcf,0xf0,
-0x0b,0xe7,0x00,0x01,0x36,0xfe,0x60,0x01,0x68,0x27,0x13,0x00,0x70,0x2a,0x13,0x90,
-0x07,0x01,0x13,0xf9,0x35,0x12,0x04,0x8d,0x27,0x04,0x63,0x13,0x23,0x6f,0xfa,0xca,
-0x04,0x02,0x05,0x12,0x11,0x01,0x2f,0x52,0x00,0x73,0x19,0x21,0x0d,0xf7,0xb9,0x00,
-0x11,0xf6,0x9b,0x12,0x00,0xf7,0x24,0x23,0xbf,0xc0,0xfb,0x1e,0x50,0xfa,0x00,0x01,
-0xaf,0xf6,0x75,0x09,0x12,0xc1,0x39,0x17,0x41,0x8f,0xf6,0x07,0xe5,0x5c,0x00,0x18,
-0xe0,0x9e,0x12,0x13,0x40,0x44,0x12,0x03,0xc2,0x23,0x12,0xef,0x60,0x00,0x51,0x4f,
-0xf7,0x6f,0xf6,0x00,0x54,0x17,0x70,0x05,0xff,0xa2,0x00,0x07,0xef,0xe4,0x1e,0x23,
-0xb1,0x91,0x4f,0xff,0xdb,0xbb,0xbb,0xbc,0xff,0xf7,0x06,0x4c,0xe7,0x03,0x12,0x80,
-0x12,0x06,0x07,0x7d,0x1b,0x01,0x84,0x15,0x00,0xfa,0x1a,0x64,0x99,0x9f,0xfa,0x99,
-0x80,0x00,0x20,0x00,0x20,0x07,0xbb,0x97,0x07,0x33,0xbb,0xa0,0x0a,0xca,0x0d,0x06,
-0x20,0x1e,0x42,0x9f,0x80,0x08,0xf8,0x8e,0x2a,0x01,0x53,0x4d,0x22,0x0a,0xfb,0x57,
-0x22,0x00,0x3a,0x1a,0x10,0x0e,0x64,0x46,0x72,0x90,0x39,0x20,0x04,0xff,0x90,0x1e,
-0xd0,0x25,0x96,0xf3,0x04,0xc1,0x04,0xff,0x40,0x00,0x09,0x50,0x49,0x25,0x43,0x7f,
-0xe1,0x02,0xcc,0xce,0x2a,0x10,0xef,0xc2,0x17,0x50,0xf7,0x00,0x01,0x7f,0xf3,0xea,
-0x2c,0x10,0xef,0xb3,0x12,0x00,0x87,0x4c,0x70,0xdc,0xb9,0xef,0x60,0x00,0x55,0x32,
-0x2c,0x00,0x25,0x80,0x00,0xe1,0x35,0x21,0xaf,0x50,0xd8,0x05,0x0b,0x08,0x00,0x71,
-0x05,0xbb,0xef,0xcb,0xbb,0xff,0xbb,0x4d,0x37,0x01,0xdb,0x29,0x7c,0x22,0xbf,0x62,
-0x22,0xff,0x22,0x20,0x28,0x00,0x84,0x0c,0xcc,0xef,0xdc,0xcc,0xff,0xcc,0xc6,0x22,
-0x0f,0x00,0x12,0x1c,0x02,0xd1,0x0e,0x30,0xbf,0xa0,0x04,0xd0,0x23,0x30,0x2c,0xfd,
-0x20,0x57,0x4a,0x30,0x07,0xff,0xc1,0xcb,0x01,0x31,0xb0,0x04,0xe8,0x63,0x01,0x16,
-0x91,0xe8,0x04,0x03,0xf5,0x1c,0x60,0x0d,0xf8,0x77,0x77,0x7c,0xf6,0x8a,0x1c,0x30,
-0x88,0x88,0x8d,0x08,0x00,0x50,0xfd,0xdd,0xdd,0xdf,0xf6,0x90,0x02,0x47,0x33,0x33,
-0x3b,0xf6,0x28,0x00,0x48,0xf3,0x11,0x11,0x1a,0x10,0x00,0xe5,0xf6,0x55,0x55,0x5b,
-0xf6,0x00,0x0b,0xbf,0xfc,0xbb,0xbb,0xbe,0xfd,0xb5,0x88,0x00,0xf1,0x01,0x04,0xcf,
-0x50,0x02,0xee,0x81,0x00,0x05,0xcf,0xfb,0x20,0x00,0x6e,0xff,0x81,0x0b,0xbe,0x24,
-0x44,0x7f,0xe3,0x00,0x20,0xc0,0x20,0x01,0x4f,0x06,0x0a,0x07,0x00,0x75,0xae,0xee,
-0xee,0xff,0xee,0xee,0xe2,0x72,0x0e,0x91,0x04,0xfa,0x00,0x0b,0xf2,0xcf,0x20,0x07,
-0xf9,0x07,0x00,0x30,0x0c,0xff,0x60,0x07,0x00,0xf1,0x0b,0x6f,0xde,0xf7,0x0b,0xf2,
-0xcf,0x25,0xff,0x32,0xef,0x6b,0xf2,0xcf,0xaf,0xf5,0x00,0x3f,0xec,0xf2,0xcf,0x3b,
-0x30,0x00,0x04,0x2b,0xf2,0x32,0x21,0x11,0x0c,0x07,0x00,0x50,0x2e,0xef,0xf0,0xcf,
-0x20,0xc5,0x00,0x21,0x70,0xac,0x97,0x2a,0x22,0xca,0xdf,0xfc,0x1f,0xdc,0xdf,0x31,
-0x13,0xfd,0x11,0x13,0xfd,0xdf,0x10,0x01,0xfc,0x00,0x01,0x07,0x00,0x01,0xf0,0x0e,
-0x14,0xfd,0x2a,0x00,0x01,0x50,0x20,0x0f,0x07,0x00,0x07,0x50,0x09,0xde,0xfb,0xdf,
+0xf5,0x01,0x21,0xaf,0xe0,0xc5,0x07,0x31,0x02,0xff,0x70,0x80,0x00,0x31,0x0c,0xfe,
+0x00,0x80,0x00,0x21,0x2d,0xf5,0xf1,0x03,0x21,0xb0,0x00,0x25,0x03,0x13,0x11,0x78,
+0x00,0x22,0x6e,0xc1,0x08,0x00,0x20,0xf2,0x89,0xd1,0x09,0x40,0x02,0x71,0xe0,0x6a,
+0xe8,0x00,0x40,0x2f,0xf5,0x9e,0xe3,0xe8,0x00,0x31,0x0b,0xfc,0x01,0x0c,0x0a,0x30,
+0x03,0xff,0x30,0x4c,0x00,0xc2,0x20,0x00,0xdf,0xa0,0x00,0x00,0x08,0xfd,0x00,0x00,
+0x6f,0xf1,0xe1,0x04,0x62,0x0f,0xf7,0x00,0x00,0x4f,0xf3,0x77,0x01,0x20,0xbf,0xc0,
+0xdc,0x01,0x40,0x20,0x04,0xff,0x50,0x66,0x04,0x31,0x80,0x0e,0xfd,0xb4,0x00,0x21,
+0xd0,0x1a,0x10,0x02,0x29,0x8d,0x80,0xef,0x00,0x12,0x04,0xde,0x05,0xf0,0x01,0x4f,
+0x60,0x4f,0xf0,0x00,0x00,0x0e,0xa9,0xd0,0x3f,0xe0,0x00,0x00,0x05,0xc1,0x00,0x07,
+0x00,0xf0,0x05,0x2a,0x60,0x00,0x3f,0xe0,0x01,0x6c,0xff,0xd0,0x00,0x3f,0xf8,0xcf,
+0xff,0xfa,0x40,0x00,0x3f,0xff,0xff,0x06,0x01,0x21,0x3f,0xf9,0xb9,0x00,0x00,0x23,
+0x00,0x0d,0x07,0x00,0x71,0x2f,0xf7,0x43,0x34,0x57,0x94,0x00,0x0b,0x04,0x82,0xf5,
+0x00,0x01,0x7c,0xde,0xed,0xdc,0xa3,0x69,0x00,0x20,0x7e,0x70,0x62,0x00,0x40,0x01,
+0xe3,0xe1,0x3f,0x8e,0x01,0x21,0xc0,0xd2,0x31,0x00,0x20,0xe6,0xe0,0x07,0x00,0x9f,
+0x18,0xdb,0x40,0x3f,0xe0,0x01,0x6b,0xff,0xf0,0x69,0x00,0x26,0x12,0x00,0x69,0x00,
+0x71,0x55,0x44,0x44,0x44,0x45,0x60,0x0e,0x09,0x03,0x72,0xd1,0xbc,0xbb,0xbb,0xbb,
+0xbe,0xfe,0xb2,0x03,0x11,0xa0,0xb0,0x02,0x12,0xf5,0x7f,0x02,0x02,0xc4,0x09,0x11,
+0x80,0x88,0x0a,0x11,0xe0,0x8b,0x01,0x10,0xf6,0x91,0x02,0x10,0xcf,0xba,0x07,0x31,
+0x5b,0xff,0xf7,0x5b,0x09,0x10,0xd4,0x18,0x00,0x26,0x5b,0x50,0x28,0x01,0x12,0x45,
+0x8b,0x09,0xb2,0x99,0xf2,0x13,0x22,0x22,0x22,0x22,0x9f,0x3d,0x55,0xff,0x48,0x03,
+0x10,0x5f,0xfb,0x04,0x03,0x48,0x03,0x23,0x2f,0xf3,0xde,0x06,0x17,0x00,0x76,0x00,
+0x32,0x00,0x5f,0xf3,0xe9,0x07,0x02,0xf2,0x03,0x14,0x1c,0x86,0x07,0x16,0x50,0xe3,
+0x05,0x10,0x0c,0xfc,0x0a,0x00,0x23,0x00,0x1d,0xb5,0xdc,0x03,0x22,0x05,0xec,0xd7,
+0x05,0x21,0xe3,0x89,0x78,0x00,0x32,0x4f,0x05,0xb5,0x6b,0x04,0x12,0xe5,0x78,0x00,
+0x12,0xb3,0x78,0x00,0x1a,0xf4,0x78,0x00,0x19,0xb0,0x78,0x00,0x13,0xfb,0x78,0x00,
+0x1f,0x30,0x78,0x00,0x01,0x1f,0x30,0x78,0x00,0x01,0x22,0x02,0x73,0x08,0x00,0x33,
+0x2e,0xff,0x80,0x61,0x04,0x11,0xf9,0xd2,0x03,0x21,0xfe,0x27,0x11,0x00,0x50,0x9f,
+0xf3,0x00,0x7f,0xf8,0xca,0x04,0x90,0x70,0x00,0x09,0xff,0x60,0x00,0x1e,0xfb,0x00,
+0xe8,0x0a,0x30,0x00,0x02,0xd1,0xe3,0x03,0x03,0xfa,0x05,0x42,0x01,0xef,0xf2,0x00,
+0xaf,0x01,0x18,0xb0,0x68,0x02,0x30,0x00,0x00,0x7b,0x05,0x00,0x50,0x30,0x00,0xbb,
+0x6f,0x70,0xfc,0x08,0x40,0x30,0x7f,0x5c,0xb0,0x40,0x08,0x80,0xf3,0x0d,0x70,0x00,
+0x00,0x09,0xfe,0x5c,0xa5,0x00,0x00,0xc2,0x08,0x22,0xcf,0xf3,0x9e,0x04,0x60,0x1d,
+0xfe,0x20,0x00,0x2f,0xfc,0x28,0x04,0x40,0xe1,0x00,0x06,0xf2,0x4f,0x00,0x41,0xfd,
+0x10,0x00,0x20,0x5b,0x05,0x22,0xc0,0x00,0x56,0x05,0x13,0xd0,0x14,0x09,0x12,0x10,
+0x30,0x01,0x10,0xcb,0x08,0x00,0x50,0x41,0x00,0x2f,0x5a,0xb0,0x3b,0x07,0x40,0x60,
+0x3e,0x06,0xc0,0x54,0x04,0x20,0xf7,0x0a,0x7e,0x0a,0xc2,0xff,0x59,0xff,0x70,0x20,
+0x00,0x00,0x5f,0xf6,0x00,0x8f,0xf6,0xdd,0x0c,0x00,0x70,0x07,0x01,0x1f,0x03,0x50,
+0xbf,0xf4,0x00,0x03,0xe3,0x0b,0x01,0x41,0xff,0x30,0x00,0x10,0x99,0x04,0x13,0xe2,
+0x20,0x0b,0x13,0xe1,0x51,0x0a,0x17,0x20,0x52,0x05,0x22,0x0e,0xf2,0x9f,0x08,0x62,
+0x0e,0xf3,0x00,0x01,0x10,0x08,0xf7,0x06,0x94,0x70,0x08,0xee,0xee,0xef,0xfe,0xee,
+0xee,0x70,0x20,0x00,0xd0,0x00,0x04,0x50,0x0e,0xf2,0x03,0x70,0x00,0x00,0x1e,0xf5,
+0x0e,0xf2,0x9c,0x06,0x60,0xaf,0xb0,0x0e,0xf2,0x07,0xfe,0x00,0x05,0x70,0x0e,0xf2,
+0x00,0xdf,0x90,0x1e,0xf5,0x28,0x00,0x71,0x4f,0xc0,0x01,0x50,0x13,0x2f,0xf2,0x20,
+0x01,0x22,0x3f,0xff,0x52,0x05,0x26,0x1b,0xcc,0x17,0x06,0x20,0x16,0x60,0xda,0x06,
+0x41,0xf2,0x0c,0xa8,0xf1,0x72,0x05,0x32,0x06,0xf4,0xe4,0x7a,0x05,0x10,0x71,0x73,
+0x0c,0x01,0xad,0x0b,0x04,0x08,0x00,0x05,0x92,0x05,0x40,0x04,0x30,0x0f,0xf1,0x9c,
+0x0d,0x60,0x1f,0xf3,0x0f,0xf1,0x2f,0xf2,0xb6,0x04,0x30,0x0f,0xf1,0x09,0x58,0x06,
+0x00,0xc2,0x05,0x40,0xef,0x60,0x1f,0xf5,0x28,0x00,0x90,0x6f,0xc0,0x02,0x60,0x11,
+0x2f,0xf1,0x00,0x05,0x2a,0x02,0x12,0xff,0x14,0x0c,0x35,0x3d,0xdd,0x70,0x03,0x02,
+0x12,0xde,0x78,0x00,0x31,0x0a,0x72,0xf0,0x58,0x00,0x22,0x09,0xa6,0x08,0x00,0x3f,
+0x01,0xac,0x40,0x78,0x00,0x0a,0x22,0x04,0x40,0x78,0x00,0x22,0x5f,0xe1,0x78,0x00,
+0x22,0x0b,0xfb,0x78,0x00,0x23,0x02,0xff,0x78,0x00,0x1f,0x8f,0x78,0x00,0x06,0x11,
+0x11,0x38,0x02,0x13,0x20,0x4f,0x01,0x30,0x80,0x8f,0xfe,0xe1,0x02,0x02,0x45,0x06,
+0x12,0x0a,0xbd,0x02,0x01,0xb0,0x06,0x30,0x44,0x00,0x04,0x44,0x0e,0x31,0x5f,0xf7,
+0x04,0x4b,0x0e,0x42,0xaf,0xfb,0xff,0xb0,0x3a,0x0b,0x12,0xb0,0xa3,0x0d,0x13,0xfb,
+0x18,0x02,0x13,0xfa,0x35,0x0d,0x03,0x3d,0x0d,0x17,0xbb,0xe0,0x02,0x22,0x46,0x30,
+0xd6,0x02,0x71,0xd9,0x62,0x00,0x00,0x7a,0xdf,0xff,0xea,0x0b,0x50,0x48,0xcf,0xd0,
+0x00,0x10,0x80,0x00,0x40,0x07,0xfe,0xb7,0x40,0x72,0x00,0x91,0xff,0xff,0xc7,0x00,
+0x00,0x02,0x69,0xef,0xfe,0x0f,0x01,0x41,0x76,0x00,0x18,0x52,0x5f,0x00,0xf0,0x08,
+0xff,0xfb,0x83,0x00,0x00,0x59,0xcf,0xff,0xff,0xfa,0x50,0x00,0x00,0x37,0xbf,0xff,
+0x80,0x00,0x00,0x00,0x00,0x49,0x10,0x61,0x00,0x00,0x00,0x55,0x20,0x00,0x01,0x00,
+0x21,0xdf,0xa0,0x07,0x00,0x31,0x01,0xff,0x40,0x08,0x00,0x22,0x06,0xfe,0x17,0x00,
+0x22,0x0b,0xf9,0x08,0x00,0x22,0x0f,0xf4,0x08,0x00,0xf2,0x06,0x5f,0xe0,0x00,0x6b,
+0x10,0x00,0x00,0x00,0xbf,0x90,0x00,0xdf,0x90,0x00,0x00,0x00,0xff,0x40,0x00,0x4f,
+0xf2,0x2f,0x00,0xf2,0x0c,0x0d,0xfa,0x00,0x04,0x4c,0xfd,0x9b,0xde,0xff,0xff,0x30,
+0x0e,0xff,0xff,0xff,0xff,0xfe,0xff,0xa0,0x0b,0xec,0xb9,0x75,0x42,0x00,0x6f,0xf1,
+0x3c,0x00,0x21,0x08,0x10,0x07,0x00,0x11,0x71,0x06,0x00,0x12,0x03,0x69,0x00,0x10,
+0x09,0x39,0x00,0xf0,0x03,0xa1,0x00,0x0e,0xf8,0x00,0x00,0x5f,0xfe,0x40,0x7f,0xf1,
+0x00,0x00,0x03,0xdf,0xfa,0xef,0x80,0x1a,0x00,0x21,0xff,0xfe,0x30,0x00,0x11,0xaf,
+0x29,0x00,0xf0,0x0b,0x07,0xff,0xff,0xf6,0x00,0x00,0x00,0x7f,0xfb,0x2e,0xff,0x70,
+0x00,0x1a,0xff,0xb0,0x02,0xef,0xf4,0x06,0xff,0xfa,0x00,0x00,0x2e,0xa0,0x11,0x00,
+0x52,0x00,0x01,0x00,0x02,0xa2,0x57,0x00,0x10,0xdd,0x01,0x00,0x30,0x60,0x03,0xff,
+0x01,0x00,0x70,0x60,0x00,0x10,0x0f,0xf4,0x00,0x01,0xbf,0x00,0x10,0xf3,0xdc,0x00,
+0x02,0xc6,0x00,0x11,0x4f,0x1c,0x00,0x83,0xfa,0x4f,0xee,0xef,0xfe,0xee,0xee,0xe9,
+0x1c,0x00,0x06,0x07,0x00,0x11,0xf6,0x07,0x00,0xc0,0x0d,0xff,0xcb,0xcd,0xe2,0x00,
+0x00,0x05,0xff,0xff,0xff,0xf1,0x57,0x00,0x42,0x55,0x54,0x30,0x00,0x01,0x00,0x21,
+0x07,0xe8,0x07,0x00,0xf0,0x16,0x4f,0xc0,0x00,0x04,0x72,0x00,0x00,0xff,0x7a,0xdf,
+0xff,0xd0,0x8b,0xef,0xff,0xfe,0xbf,0xf6,0x09,0xff,0xdf,0xb1,0x06,0xfc,0x00,0x22,
+0x03,0xfe,0x04,0xff,0x20,0x00,0x00,0x0e,0xf2,0xaf,0x50,0xbf,0x00,0x20,0x70,0x20,
+0x4f,0x01,0x11,0xfb,0x35,0x00,0x22,0x2f,0xf0,0x6c,0x01,0x11,0x50,0x63,0x01,0x27,
+0x51,0x00,0x01,0x00,0x33,0x05,0xcd,0x00,0x18,0x01,0x21,0x10,0x00,0xb3,0x00,0xf0,
+0x16,0xef,0x50,0x14,0x7a,0xef,0x80,0x00,0x02,0xcf,0xee,0xff,0xff,0xff,0xb0,0x1d,
+0xff,0xff,0xff,0xea,0x79,0xff,0x20,0x0e,0xfe,0xbf,0xf4,0x00,0x1e,0xf7,0x00,0x03,
+0x20,0x0d,0xf7,0x00,0xcf,0xc0,0x56,0x01,0x21,0xfb,0x0b,0x29,0x01,0x41,0x04,0xff,
+0x01,0x74,0x42,0x00,0x03,0xc2,0x01,0x32,0x00,0xcf,0x90,0x08,0x00,0x22,0x7f,0xd0,
+0x08,0x00,0x22,0x3f,0xf2,0x08,0x00,0x28,0x0e,0xb3,0x78,0x00,0xf0,0x02,0x10,0x00,
+0x00,0x20,0x00,0x02,0xff,0xff,0xff,0xfd,0x10,0x02,0xfe,0xee,0xee,0xff,0x00,0x4b,
+0x00,0x11,0xfe,0xe9,0x00,0x11,0xfb,0xa1,0x01,0x01,0x01,0x02,0xa1,0x0c,0xf6,0x00,
+0x9f,0xee,0xee,0xef,0xff,0xfe,0x9f,0xda,0x01,0x06,0x3c,0x00,0x40,0x01,0x10,0x00,
+0x00,0x13,0x00,0x12,0xf9,0x07,0x00,0x82,0xfc,0x00,0x00,0x11,0x00,0x00,0x0c,0xf9,
+0x69,0x00,0x18,0xf7,0x3b,0x02,0x03,0x7f,0x00,0x12,0x5f,0x03,0x01,0x51,0x8f,0xc0,
+0x00,0xcf,0xff,0x4c,0x00,0x03,0x07,0x00,0x11,0x22,0x01,0x00,0x12,0x23,0x24,0x00,
+0x00,0x8f,0x00,0x50,0x5d,0xdd,0xdd,0xdd,0xfd,0xb6,0x01,0x70,0xfd,0x01,0x00,0x00,
+0x02,0xfd,0x0f,0x14,0x00,0x42,0x0b,0xcc,0xcc,0xcc,0x14,0x00,0x60,0x11,0x11,0x11,
+0x12,0xfd,0x8f,0x14,0x00,0xc0,0x7c,0xcc,0xcc,0xcc,0xfe,0x9c,0xcb,0xbb,0xbb,0xbb,
+0xc4,0xbf,0x4a,0x00,0x71,0xf5,0x23,0x33,0x33,0x33,0x3d,0xf5,0xb6,0x00,0x03,0x06,
+0x00,0x11,0x2f,0x18,0x00,0x02,0x06,0x00,0x08,0x18,0x00,0x10,0x11,0xe9,0x01,0x21,
+0xf5,0xef,0x18,0x00,0x61,0xef,0xee,0xee,0xee,0xef,0xf5,0xfe,0x00,0x31,0x52,0x00,
+0x10,0xdd,0x00,0x10,0x7f,0x19,0x00,0x73,0x10,0x07,0xee,0xee,0xee,0xee,0xe1,0xf2,
+0x00,0x10,0x32,0xa5,0x00,0x21,0x31,0x0f,0xb3,0x00,0x81,0xe3,0xcc,0xcc,0xcc,0xcc,
+0xcd,0xff,0x00,0xa5,0x02,0x11,0x90,0xe3,0x00,0x01,0x43,0x02,0x20,0x2e,0xf8,0x06,
+0x00,0x20,0x4e,0xfd,0xe3,0x01,0x71,0xbf,0xfc,0x10,0x00,0x00,0x3f,0xff,0x10,0x01,
+0x38,0x8e,0x81,0x00,0x01,0x00,0xce,0x01,0x33,0xff,0x50,0x00,0x05,0xfe,0xef,0x50,
+0x00,0x04,0xfe,0x05,0x00,0x92,0x05,0xfd,0xef,0x50,0x00,0x06,0xfc,0xef,0x50,0x81,
+0x01,0xf5,0x05,0x1f,0xf5,0x00,0x00,0x02,0xcf,0xe0,0x00,0x01,0x7f,0xff,0x30,0x00,
+0x5f,0xff,0xd3,0x00,0x00,0x09,0xe7,0x4a,0x00,0x41,0x33,0x00,0x33,0x10,0x3a,0x02,
+0x02,0xfb,0x01,0x50,0x02,0xfe,0x00,0xef,0x30,0x10,0x00,0x0c,0x08,0x00,0x12,0xfd,
+0x08,0x00,0x21,0x05,0xfc,0x08,0x00,0x00,0x94,0x02,0xf0,0x22,0xef,0x30,0x03,0x60,
+0x00,0x0a,0xf8,0x00,0xef,0x30,0x2e,0xf2,0x00,0x1f,0xf4,0x00,0xef,0x34,0xef,0xd0,
+0x00,0x9f,0xd0,0x00,0xef,0xcf,0xfc,0x10,0x07,0xff,0x50,0x00,0xef,0xff,0xa0,0x00,
+0x1e,0xf9,0x00,0x00,0xef,0xe5,0x00,0x00,0x01,0x70,0x00,0x00,0x28,0x5f,0x00,0x12,
+0x21,0x66,0x02,0x11,0x60,0xe3,0x01,0x02,0xdc,0x01,0x2c,0xef,0x40,0x0d,0x00,0x11,
+0x10,0x0d,0x00,0x20,0x5e,0x10,0x0d,0x00,0xf0,0x0b,0x6f,0xf6,0x0e,0xf4,0x00,0x01,
+0xaf,0xf9,0x00,0xef,0x40,0x06,0xef,0xf8,0x00,0x0e,0xf6,0x7e,0xff,0xe3,0x00,0x00,
+0xef,0xff,0xfe,0x70,0x68,0x03,0x11,0xc6,0x1b,0x04,0x01,0x86,0x04,0x11,0x11,0x01,
+0x00,0x02,0x5e,0x01,0x30,0xf1,0xff,0xfe,0x71,0x02,0x20,0x1f,0xf2,0xfe,0x00,0x30,
+0xf0,0xff,0x20,0x9b,0x04,0x1f,0x0f,0x0d,0x00,0x07,0x71,0xfe,0xdd,0xdd,0xdd,0xdf,
+0xf0,0xff,0x01,0x00,0x80,0x1f,0xf5,0x22,0x22,0x22,0x4f,0xf1,0x77,0x15,0x01,0x30,
+0x77,0x00,0x2d,0xa7,0x01,0x31,0xde,0x80,0x2f,0x1b,0x00,0x81,0xf4,0x2f,0xf3,0x22,
+0x22,0x22,0x7f,0xf1,0x89,0x03,0x21,0x8f,0xd0,0x07,0x00,0x40,0xbf,0xa0,0x3f,0xf1,
+0x44,0x00,0x81,0x60,0x02,0x20,0x00,0x00,0x08,0xff,0x10,0xca,0x01,0x11,0xf8,0x8c,
+0x03,0x21,0xef,0xd0,0x41,0x03,0x80,0xfe,0x20,0x00,0x00,0x02,0x8e,0xff,0xd2,0xb6,
+0x01,0x21,0xdf,0xf8,0xe5,0x00,0x27,0x17,0x10,0xcb,0x01,0x22,0x0b,0xa0,0xc3,0x03,
+0x23,0xff,0xd2,0x08,0x00,0xf2,0x05,0xf4,0x00,0x00,0x05,0x10,0x00,0x03,0xef,0xa0,
+0x00,0x00,0xe8,0x00,0x00,0x02,0x90,0x00,0x00,0xaf,0xe0,0xf7,0x02,0x12,0xf5,0x07,
+0x00,0x11,0xf9,0x02,0x02,0x21,0xaf,0xfa,0x2f,0x00,0x20,0xef,0xf7,0x57,0x01,0xb0,
+0x7e,0xff,0xe4,0x00,0x00,0x00,0xae,0xff,0xff,0xa2,0x00,0x87,0x00,0x21,0xfa,0x20,
+0x84,0x03,0x02,0x76,0x04,0x82,0x45,0x54,0x44,0x44,0x44,0x45,0x51,0xbf,0xc4,0x00,
+0x03,0x07,0x00,0x12,0x10,0x84,0x03,0x22,0x01,0x11,0x01,0x00,0x12,0x1f,0xfd,0x00,
+0x13,0xf9,0x08,0x00,0x00,0x62,0x00,0x13,0x6f,0x02,0x04,0x0f,0x08,0x00,0x0e,0x40,
+0xfe,0xee,0xee,0x20,0x08,0x00,0x4f,0xff,0xff,0xff,0x20,0x38,0x00,0x15,0x83,0x01,
+0x11,0x11,0x7f,0xa1,0x11,0x11,0x10,0x70,0x00,0x31,0xf7,0x1d,0xdd,0x01,0x00,0x22,
+0xd6,0x02,0xca,0x03,0x13,0x20,0x18,0x00,0x90,0xf2,0x1b,0xbb,0xbb,0xdf,0xeb,0xbb,
+0xbb,0xb1,0xd8,0x03,0x13,0xb0,0x45,0x06,0x04,0x08,0x00,0x23,0xfe,0x70,0xf0,0x03,
+0x21,0xfe,0x60,0x08,0x00,0x41,0xb3,0xcf,0xfc,0x20,0x20,0x00,0x32,0x06,0xfd,0x10,
+0x28,0x00,0x2e,0x22,0x00,0x38,0x00,0x0a,0x08,0x00,0x21,0x0a,0xbb,0x01,0x00,0x22,
+0xa0,0x0e,0x70,0x00,0x90,0xe0,0x03,0x33,0x33,0x4d,0xfc,0x33,0x33,0x30,0xb9,0x01,
+0x02,0xd3,0x05,0x51,0x04,0xff,0xf2,0x60,0x00,0xf9,0x05,0xb0,0xfe,0xfa,0x10,0x00,
+0x00,0x06,0xff,0xbf,0xf4,0xef,0xd3,0x91,0x02,0xf0,0x06,0x0f,0xf0,0x1c,0xff,0x50,
+0x2f,0xff,0x70,0x0f,0xf0,0x00,0xaf,0xf4,0x0a,0xc2,0x00,0x0f,0xf0,0x00,0x0a,0x90,
+0xb2,0x04,0x02,0xa4,0x04,0x0f,0x08,0x00,0x03,0x21,0x2a,0xaa,0x01,0x00,0x22,0xa2,
+0x2f,0x70,0x00,0x90,0xf3,0x02,0x22,0x22,0x2f,0xe2,0x22,0x22,0x20,0x20,0x00,0x11,
+0xd0,0xbb,0x01,0x01,0x01,0x00,0xf8,0x08,0x80,0x08,0xfc,0xbb,0xbf,0xfb,0xbb,0xdf,
+0x80,0x08,0xf5,0x23,0x0f,0xd0,0x11,0x5f,0x80,0x08,0xf5,0xbd,0x0f,0xd0,0xfb,0x08,
+0x00,0x13,0xbe,0x08,0x00,0x31,0xbf,0xff,0xff,0x08,0x00,0x70,0x79,0x99,0x99,0x96,
+0x5f,0x80,0x08,0x23,0x02,0x31,0x4a,0xdf,0x70,0x08,0x00,0x20,0x2f,0xfb,0x64,0x05,
+0x02,0x70,0x05,0x08,0x07,0x00,0x82,0xad,0xdd,0xdd,0xff,0xdd,0xdd,0xd2,0xcf,0x63,
+0x01,0xa8,0xcf,0x20,0x02,0xfe,0x00,0x0d,0xf2,0xcf,0x20,0x01,0x07,0x00,0x64,0xba,
+0xab,0xff,0xaa,0xaf,0xf2,0x23,0x00,0x70,0x42,0x24,0xfe,0x22,0x2d,0xf2,0x23,0x3f,
+0x00,0x2e,0x02,0x20,0x54,0x00,0x04,0xcb,0x02,0x83,0x24,0x70,0x00,0x01,0x89,0xab,
+0xcd,0xef,0xd1,0x05,0xd2,0xfb,0x97,0x41,0x00,0x00,0x55,0x43,0x3f,0xe3,0x33,0x33,
+0x00,0x03,0xd9,0x00,0xf3,0x02,0x40,0x01,0x59,0xf9,0x5f,0xe5,0xaf,0x95,0x10,0x19,
+0x9c,0xfc,0x9f,0xf9,0xcf,0xc9,0x91,0xe9,0x01,0xa2,0xf1,0x00,0x07,0xf7,0x0f,0xe0,
+0x8f,0x60,0x00,0x04,0x18,0x00,0x23,0x50,0x07,0x09,0x01,0x60,0x00,0x00,0x4d,0xff,
+0xff,0xd4,0xd5,0x00,0xf1,0x08,0xff,0x6f,0xe8,0xff,0xb5,0x00,0x2e,0xff,0xb2,0x0f,
+0xe0,0x3c,0xff,0xf2,0x07,0x92,0x00,0x0f,0xe0,0x00,0x3a,0x60,0x5a,0x50,0x01,0x22,
+0x60,0x7f,0xd6,0x02,0x70,0x13,0x33,0x33,0x33,0x3c,0xff,0x50,0x95,0x00,0x31,0xcf,
+0xe4,0x00,0xf3,0x07,0x11,0x10,0x56,0x04,0x12,0x70,0x5d,0x04,0x1f,0x10,0x07,0x00,
+0x13,0x12,0x0d,0xca,0x06,0x37,0x0a,0xff,0xc5,0xa8,0x03,0x50,0x06,0xb3,0x00,0x02,
+0xf9,0x1d,0x00,0x21,0xf2,0x12,0x08,0x00,0xf1,0x30,0x4f,0xb0,0xdf,0x02,0xf9,0x03,
+0x10,0x00,0xcf,0x40,0xdf,0x02,0xfc,0xbf,0xd0,0x06,0xff,0x10,0xdf,0x28,0xff,0xff,
+0xd0,0x2f,0xff,0x10,0xdf,0xff,0xfd,0x5f,0xc0,0xaf,0xff,0x7d,0xff,0xeb,0xf9,0x0f,
+0xc0,0x3d,0xdf,0x7f,0xff,0x12,0xf9,0x0f,0xc0,0x01,0xcf,0x23,0xdf,0x02,0xf9,0x0f,
+0xb0,0x00,0xcf,0x10,0xdf,0x02,0xfb,0xff,0x90,0x08,0x00,0x30,0xf9,0xa9,0x10,0x08,
+0x00,0xf1,0x19,0x00,0x10,0x05,0xc3,0x00,0xcf,0x10,0xcf,0x20,0x00,0x09,0xf4,0x00,
+0xcf,0x10,0x9f,0xfe,0xee,0xff,0xe0,0x00,0xcf,0x10,0x19,0xbc,0xcc,0xca,0x30,0x00,
+0x00,0xaa,0x20,0x00,0x00,0xfe,0x00,0x00,0x02,0xff,0x10,0x08,0x00,0x31,0x0a,0xfa,
+0x00,0x08,0x00,0x22,0x1f,0xf3,0x7b,0x01,0x21,0xbf,0xe2,0x92,0x08,0xb1,0x06,0xff,
+0xd2,0xdd,0xdd,0xde,0xff,0xd9,0x2f,0xff,0xd0,0x20,0x00,0xd1,0x0c,0xcf,0xd0,0x2b,
+0x90,0x00,0xfe,0x00,0x02,0x2f,0xd0,0x0e,0xf4,0x30,0x00,0x32,0xd0,0x05,0xfd,0x08,
+0x00,0x32,0x00,0xce,0x20,0x08,0x00,0x13,0x10,0x10,0x00,0x22,0x00,0x01,0x08,0x00,
+0x31,0x5d,0xcd,0xfc,0x08,0x00,0x4d,0x1f,0xff,0xc4,0x00,0x01,0x00,0x50,0x06,0xd5,
+0x10,0x0a,0xf3,0x00,0x01,0x40,0xf3,0x8f,0x5a,0xf3,0x00,0x01,0x40,0xd0,0xcf,0x2a,
+0xf3,0x02,0x05,0x90,0x60,0xff,0xae,0xfc,0xaa,0x60,0x05,0xff,0x15,0x88,0x00,0xd0,
+0x90,0x1e,0xff,0x1c,0xf5,0x2b,0xf6,0x22,0x10,0x8f,0xff,0x2d,0xc0,0x30,0x00,0x40,
+0x2e,0xdf,0x10,0x20,0x08,0x00,0xb2,0x02,0xbf,0x1d,0xdd,0xdf,0xfe,0xdd,0xd4,0x00,
+0xbf,0x1f,0x4b,0x07,0x40,0xbf,0x10,0x00,0x0a,0xe7,0x05,0x00,0x08,0x00,0x1f,0xf3,
+0x08,0x00,0x08,0x05,0x01,0x00,0x10,0x42,0xe9,0x04,0x00,0x6c,0x05,0xf0,0x04,0x30,
+0x02,0x59,0xdf,0xb0,0x00,0x08,0xfd,0xbd,0xff,0xff,0xfc,0x81,0x00,0x1f,0xf4,0xce,
+0xca,0xfd,0x46,0x07,0x40,0xd0,0x00,0x01,0xfd,0xa1,0x03,0x11,0xc0,0x08,0x00,0x13,
+0x4f,0x08,0x00,0xb2,0x1e,0xbf,0xc8,0xdd,0xde,0xff,0xdd,0xdb,0x04,0x1f,0xc9,0x64,
+0x08,0x12,0x1f,0x18,0x00,0x0f,0x08,0x00,0x08,0x01,0x50,0x01,0x30,0x00,0x1f,0xc0,
+0x92,0x04,0x10,0xd9,0x78,0x00,0x22,0x06,0xa0,0xe7,0x02,0x20,0x0b,0xf4,0xd4,0x08,
+0x40,0xf8,0x00,0x06,0xf7,0x28,0x00,0x91,0xf1,0xdd,0xde,0xed,0xdd,0xc0,0x00,0xaf,
+0xb0,0x3a,0x04,0xf0,0x18,0x06,0xff,0xa0,0x03,0x50,0x00,0x56,0x10,0x1f,0xff,0xa0,
+0x0e,0xe0,0x00,0xdf,0x20,0x0b,0xcf,0xa0,0x0c,0xf1,0x00,0xff,0x00,0x02,0x4f,0xa0,
+0x09,0xf4,0x01,0xfc,0x00,0x00,0x3f,0xa0,0x06,0xf7,0x04,0xf9,0x08,0x00,0x40,0x04,
+0xf9,0x07,0xf5,0x08,0x00,0x40,0x02,0xfb,0x0a,0xf1,0x08,0x00,0x81,0x01,0x61,0x0e,
+0xe0,0x00,0x00,0x3f,0xa8,0x0a,0x05,0x30,0x00,0x3f,0xa6,0x74,0x06,0xf0,0x10,0xc6,
+0x00,0x03,0x51,0x00,0x00,0x01,0x56,0x00,0x00,0x0b,0xf5,0x03,0x69,0xcf,0xff,0x80,
+0x00,0x2f,0xd1,0xff,0xff,0xff,0x84,0x00,0x00,0x9f,0x61,0xfd,0x52,0xcf,0x0f,0x02,
+0x20,0x21,0xfa,0x24,0x01,0xf1,0x04,0x0c,0xff,0x11,0xfa,0x00,0xaf,0x20,0x00,0x9f,
+0xff,0x11,0xfe,0xbb,0xef,0xcb,0xb2,0x7f,0xdf,0x11,0x5a,0x04,0xf2,0x00,0x04,0xbf,
+0x11,0xfb,0x00,0x6f,0x70,0x00,0x00,0xbf,0x11,0xfa,0x00,0x4f,0x90,0x08,0x00,0x21,
+0x1f,0xc0,0x08,0x00,0xf5,0x0d,0x0b,0x5d,0xf1,0xc4,0x00,0xbf,0x12,0xfc,0x7e,0xd8,
+0xfb,0xf7,0x00,0xbf,0x19,0xff,0xfa,0xf5,0xef,0xf2,0x00,0xbf,0x15,0xd7,0x30,0xa3,
+0x4c,0x80,0x6f,0x01,0x20,0x09,0xa2,0x62,0x03,0x00,0xe8,0x00,0x02,0x08,0x00,0x22,
+0x7f,0xa0,0x08,0x00,0xa1,0xdf,0x4c,0xcc,0xcf,0xfc,0xcc,0xc3,0x06,0xff,0x1f,0x73,
+0x03,0x60,0x1e,0xff,0x10,0x02,0xff,0xff,0x80,0x00,0x50,0x10,0x08,0xff,0xff,0x80,
+0xf0,0x01,0xd0,0x0f,0xbf,0xec,0xe0,0x00,0x02,0xbf,0x10,0x7f,0x4f,0xe4,0xf7,0x00,
+0x68,0x00,0xf0,0x0d,0x0f,0xe0,0xdf,0x20,0x00,0xbf,0x1c,0xf5,0x0f,0xe0,0x5f,0xc0,
+0x00,0xbf,0xaf,0xcf,0xff,0xff,0xfc,0xf8,0x00,0xbf,0x3b,0x1b,0xbf,0xfb,0xb2,0xa0,
+0xc4,0x00,0x22,0x0f,0xe0,0xf0,0x01,0x20,0x0e,0xd0,0xe3,0x01,0x31,0x40,0x00,0x41,
+0x7e,0x03,0x31,0xf8,0x04,0xfc,0xf7,0x0a,0x32,0xf1,0x0b,0xf6,0x26,0x09,0xf0,0x04,
+0x3f,0xff,0xff,0xff,0xf6,0x06,0xff,0x20,0xcf,0xef,0xfd,0xdd,0xd5,0x3f,0xff,0x28,
+0xfd,0x1f,0xd0,0xe2,0x0b,0xf1,0x02,0x4f,0xf3,0x1f,0xfa,0xaa,0xa0,0x2d,0xdf,0x23,
+0x50,0x1f,0xff,0xff,0xf0,0x01,0xcf,0x20,0xd3,0x02,0x18,0x00,0x08,0x00,0x31,0xff,
+0xff,0xf3,0x08,0x00,0x39,0xfc,0xcc,0xc2,0x18,0x00,0x08,0x08,0x00,0x0d,0xf0,0x02,
+0x41,0xd4,0x00,0x0e,0xf0,0xe4,0x09,0x02,0x08,0x00,0x10,0x5f,0x4b,0x0b,0x00,0x48,
+0x00,0x10,0x7b,0x9b,0x05,0x41,0xb2,0x07,0xff,0x20,0x18,0x00,0x30,0x3f,0xff,0x29,
+0x18,0x00,0xf2,0x04,0xc0,0xcf,0xff,0x29,0xf9,0x8f,0xf8,0x8f,0xc0,0x6c,0xbf,0x29,
+0xf1,0x0e,0xf0,0x0f,0xc0,0x00,0xaf,0x18,0x00,0xe0,0x00,0xaf,0x25,0xb8,0x9f,0xe8,
+0x88,0x60,0x00,0xaf,0x24,0xfa,0x6f,0xa0,0xc8,0x00,0x41,0x20,0x7f,0xff,0x40,0x08,
+0x00,0xf3,0x09,0x3e,0xff,0xb6,0x10,0x00,0x00,0xaf,0x6d,0xff,0x99,0xff,0xfe,0xc2,
+0x00,0xaf,0x2b,0xa3,0x00,0x05,0x9c,0xa0,0x00,0x03,0x71,0x18,0x08,0x21,0xf6,0xff,
+0x52,0x07,0xb0,0x2f,0xe1,0xfe,0xaa,0xaa,0xef,0x20,0x00,0xaf,0x70,0xfc,0xad,0x00,
+0x31,0x04,0xff,0x20,0x08,0x00,0x31,0x2e,0xff,0x20,0x20,0x00,0xa2,0xbf,0xff,0x20,
+0xaa,0xaf,0xfa,0xaa,0x10,0x4d,0xbf,0x90,0x00,0x31,0x01,0xaf,0x3f,0x90,0x02,0xc0,
+0x00,0xaf,0x3c,0xcc,0xff,0xff,0xcc,0xb0,0x00,0xaf,0x20,0x07,0xcd,0x0c,0x00,0x78,
+0x00,0xf6,0x0d,0xce,0xfb,0xf5,0x00,0x00,0xaf,0x4b,0xfd,0x1e,0xf1,0xef,0x90,0x00,
+0xaf,0x6f,0xc1,0x0e,0xf0,0x2e,0xd1,0x00,0xaf,0x23,0x00,0x0e,0xf0,0x01,0x20,0x5b,
+0x0a,0x40,0x10,0x00,0x03,0x10,0x80,0x00,0x40,0xf3,0x00,0x3f,0x80,0x80,0x01,0x30,
+0xc0,0x00,0x0c,0xa0,0x01,0x20,0x9f,0x6e,0xf4,0x0c,0xf0,0x01,0xe0,0x02,0xff,0x29,
+0x99,0x99,0x99,0x99,0x90,0x0d,0xff,0x10,0x78,0x88,0x88,0x87,0xf8,0x01,0xf0,0x02,
+0xcf,0xff,0xff,0xfd,0x00,0x4d,0xbf,0x10,0x33,0x33,0x33,0x33,0x00,0x01,0xaf,0x10,
+0xdf,0x10,0x00,0x30,0x00,0xaf,0x10,0xca,0x07,0x41,0x00,0x00,0xaf,0x11,0x0a,0x0b,
+0x70,0x00,0xaf,0x11,0xfc,0x88,0x88,0xdf,0x08,0x00,0x48,0xf8,0x00,0x00,0x9f,0x10,
+0x00,0xd0,0xee,0xff,0xff,0xed,0x10,0x00,0x04,0x20,0x00,0x26,0x20,0x00,0x00,0xc5,
+0x00,0x01,0xfc,0x0c,0x50,0x5f,0x90,0x03,0xff,0xff,0x28,0x05,0xf0,0x2e,0x30,0x1e,
+0xfd,0x88,0xdf,0x60,0x04,0xff,0x00,0xbf,0xef,0x56,0xfc,0x00,0x0d,0xfe,0x2f,0x76,
+0x0c,0xff,0xd1,0x00,0x8f,0xfe,0x2f,0x64,0xaf,0xff,0xfa,0x51,0x5f,0xfe,0x2f,0xef,
+0xf9,0x35,0xcf,0xf5,0x04,0xde,0x2f,0x86,0x04,0xde,0x12,0x50,0x00,0xde,0x2f,0x64,
+0xef,0xb2,0x74,0x00,0x00,0xde,0x2f,0x60,0x73,0x5d,0xf5,0x08,0x00,0xf0,0x03,0x63,
+0xbf,0xfa,0x2a,0x91,0x00,0xde,0x2b,0x40,0x96,0x27,0xef,0x70,0x00,0xde,0x00,0x17,
+0xae,0x27,0x09,0x41,0xde,0x00,0x0b,0xd9,0x2a,0x06,0x40,0x30,0x00,0x06,0x70,0x7b,
+0x07,0x41,0xf7,0x00,0x0d,0xf1,0x2e,0x0b,0x81,0xbb,0xbe,0xfc,0xbb,0xa0,0x00,0x8f,
+0x84,0x48,0x01,0xf2,0x0c,0x04,0xff,0x20,0x2d,0x80,0x03,0xf9,0x00,0x2e,0xff,0x10,
+0x0e,0xe0,0x09,0xf4,0x00,0x8f,0xff,0x19,0x9d,0xda,0x9f,0xfa,0x94,0x1c,0xcf,0x1f,
+0xb0,0x03,0x13,0xbf,0xcd,0x09,0xb0,0xbf,0x10,0x7a,0xaa,0xaa,0xaa,0x10,0x00,0xbf,
+0x10,0xaf,0xb8,0x01,0x00,0x08,0x00,0x39,0x10,0x00,0xbf,0x08,0x00,0x42,0xbb,0xbb,
+0xef,0x20,0x20,0x00,0x16,0xfe,0x70,0x01,0x51,0x07,0xb3,0x00,0x00,0xff,0x01,0x0b,
+0xa0,0x44,0x45,0xfe,0x44,0x42,0x00,0x5f,0xc4,0xff,0xff,0xb0,0x0e,0xf0,0x14,0xcf,
+0x62,0x88,0x8a,0xfd,0x88,0x83,0x05,0xff,0x10,0x00,0x59,0xfc,0x66,0x50,0x1e,0xff,
+0x17,0xb0,0xdf,0xff,0xff,0xc0,0xaf,0xff,0x1a,0xf1,0xdf,0x33,0x4f,0xc0,0x4e,0xdf,
+0x1a,0xf1,0x10,0x00,0xa2,0x02,0xbf,0x1a,0xf1,0xde,0x22,0x3f,0xc0,0x00,0xbf,0x10,
+0x00,0x11,0x00,0x10,0x00,0x19,0x4f,0x10,0x00,0x70,0x33,0x33,0x33,0x20,0x00,0xbf,
+0x1a,0x58,0x00,0x90,0xf8,0x00,0xbf,0x17,0xaa,0xaa,0xaa,0xaa,0xa5,0xf0,0x7c,0x00,
+0x02,0x40,0x00,0x16,0x30,0x00,0x00,0x00,0xbf,0x40,0x02,0xfc,0x00,0x00,0x00,0x2f,
+0xea,0xff,0xff,0xff,0xff,0xa0,0x09,0xf7,0xaf,0xa9,0x99,0x9c,0xfb,0x03,0xff,0x1a,
+0xf1,0x00,0x00,0x6f,0xb0,0xdf,0xf1,0xaf,0xee,0xee,0xef,0xfb,0x9f,0xff,0x1b,0xfc,
+0xcc,0xcc,0xcc,0x85,0xfd,0xf1,0xbf,0x87,0x77,0x77,0x77,0x04,0xbf,0x1c,0xef,0xff,
+0xff,0xff,0xe0,0x0b,0xf1,0xdc,0xf6,0xd5,0xd5,0x8e,0x00,0xbf,0x1f,0xaf,0xbe,0xae,
+0xac,0xe0,0x0b,0xf3,0xf8,0xff,0xff,0xff,0xfe,0x00,0xbf,0x8f,0x3f,0x6d,0x5d,0x58,
+0xe0,0x0b,0xfc,0xe0,0xf6,0xd5,0xda,0xce,0x00,0xbf,0x58,0x0f,0x6d,0x5d,0x9c,0x60,
+0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x03,0x60,0x00,0x19,0x90,0x00,0x00,0x00,
+0x0b,0xf9,0x88,0x8f,0xf8,0x88,0x80,0x00,0x2f,0xbe,0x79,0x00,0xc0,0xf1,0x00,0x9f,
+0x50,0x55,0x55,0x55,0x55,0x00,0x02,0xff,0x00,0x10,0x00,0xa3,0x00,0x0c,0xff,0x00,
+0xfc,0x11,0x11,0xdf,0x00,0x7f,0x10,0x00,0xb0,0x1e,0xef,0x02,0x66,0x66,0x66,0x66,
+0x20,0x01,0xcf,0x3f,0x10,0x00,0xf0,0x11,0xf3,0x00,0xcf,0x3f,0x83,0x33,0x33,0x39,
+0xf3,0x00,0xcf,0x2c,0xdf,0xff,0xff,0xfd,0xc2,0x00,0xcf,0x00,0x58,0x8f,0xf8,0x84,
+0x00,0x00,0xcf,0x00,0x00,0x0e,0xf0,0x00,0x08,0x00,0x22,0x0a,0xbf,0x08,0x00,0x46,
+0x0b,0xed,0x70,0x00,0x01,0x00,0xc0,0x0d,0xb0,0x00,0x00,0x00,0x0a,0xf0,0x00,0x4f,
+0xae,0xff,0xfe,0x08,0x00,0xf0,0x0c,0xaf,0x5e,0xd7,0xde,0x3f,0x5a,0xf0,0x01,0xff,
+0x0e,0xa1,0xce,0x3f,0x5a,0xf0,0x09,0xfe,0x0e,0xff,0xfe,0x3f,0x5a,0xf0,0x3f,0xfe,
+0x0e,0xc5,0x18,0x00,0x40,0xaf,0xfe,0x0e,0xb3,0x18,0x00,0x22,0x3c,0xee,0x18,0x00,
+0x22,0x01,0xde,0x10,0x00,0x52,0x00,0xde,0x0e,0xc4,0xde,0x08,0x00,0x21,0xff,0xfe,
+0x08,0x00,0xf5,0x0f,0x07,0xb5,0x97,0x29,0x3a,0xf0,0x00,0xde,0x0c,0xf4,0xed,0x00,
+0x0b,0xf0,0x00,0xde,0x8f,0x80,0x6f,0x56,0xcf,0xf0,0x00,0xde,0x4a,0x00,0x05,0x03,
+0xfd,0x60,0x80,0x00,0xb1,0x0c,0x90,0x09,0xf3,0x0d,0xf0,0x00,0x00,0x2f,0xe0,0x0a,
+0x08,0x00,0x30,0x8f,0x8d,0xff,0x4c,0x01,0xf0,0x04,0x00,0xef,0x39,0xae,0xfc,0xaf,
+0xfa,0xa0,0x06,0xff,0x25,0x5c,0xf8,0x5e,0xf5,0x51,0x0e,0xff,0x5f,0x18,0x00,0xc0,
+0xf4,0x8f,0xff,0x14,0xef,0x74,0x44,0x44,0x41,0x3f,0xff,0x1b,0x10,0x00,0xf0,0x09,
+0xb0,0x03,0xdf,0xdf,0xfe,0x8c,0xfa,0x9f,0xb0,0x00,0xdf,0x5b,0xfe,0xad,0xfb,0xaf,
+0xb0,0x00,0xdf,0x01,0xfe,0xbd,0xfc,0xbf,0x08,0x00,0x40,0xfd,0x6b,0xf7,0x6f,0x08,
+0x00,0x00,0x28,0x00,0x00,0x08,0x00,0x42,0xfb,0x08,0xf4,0x8f,0x08,0x00,0x90,0xf3,
+0xed,0x50,0x00,0x02,0x40,0x03,0x61,0x00,0x78,0x01,0xf1,0x0a,0xf7,0x1e,0xf8,0x67,
+0x10,0x00,0x00,0x2f,0xf1,0xbf,0xff,0xff,0xa0,0x00,0x00,0xaf,0x9c,0xfc,0x33,0xef,
+0x43,0x20,0x04,0xff,0xbf,0x01,0x02,0xb1,0x1e,0xff,0x16,0xf9,0x19,0xf2,0x2f,0xa0,
+0x8f,0xff,0x01,0x10,0x00,0xf7,0x2f,0x1d,0xdf,0x00,0x6c,0xff,0x66,0x68,0x40,0x00,
+0xcf,0x28,0xdf,0xcf,0x70,0x7f,0x90,0x00,0xcf,0x19,0x96,0xbf,0xfe,0xfd,0x20,0x00,
+0xcf,0x15,0xbf,0xb7,0xfc,0xce,0x00,0x00,0xcf,0x19,0xb5,0x9f,0xfb,0x4f,0x80,0x00,
+0xcf,0x14,0xaf,0xf6,0xec,0x0c,0xf7,0x00,0xcf,0x3e,0xf9,0x7a,0xfa,0x01,0xc3,0x00,
+0xcf,0x02,0x10,0x6f,0xc2,0x78,0x01,0x90,0x7a,0xaa,0xaa,0xaa,0xaa,0xa7,0x00,0x00,
+0xaf,0x57,0x00,0x41,0xfa,0x00,0x00,0x22,0x01,0x00,0x1c,0x00,0x01,0x00,0x21,0x1f,
+0xff,0x01,0x00,0xf1,0x01,0xf2,0x1c,0xcc,0xef,0xec,0xdf,0xfc,0xcc,0xc2,0x00,0x00,
+0x9f,0x70,0x0f,0xe0,0x00,0xa9,0x02,0x01,0x08,0x00,0xf6,0x19,0x01,0xff,0x10,0x0f,
+0xe0,0x01,0x00,0x00,0x08,0xfb,0x00,0x0f,0xe0,0x05,0xf4,0x00,0x7f,0xf3,0x00,0x0f,
+0xf0,0x07,0xf5,0x2d,0xff,0x50,0x00,0x0f,0xfd,0xcf,0xf1,0x0d,0xd4,0x00,0x00,0x06,
+0xef,0xff,0x80,0x01,0x53,0x00,0x22,0x15,0x40,0x08,0x00,0x23,0x4f,0xe1,0x82,0x01,
+0x52,0xe5,0x00,0x00,0x00,0x0f,0x68,0x00,0xf1,0x27,0xf0,0x0c,0xcc,0xef,0xfd,0xcc,
+0xdd,0xcc,0xc0,0x00,0x01,0xdf,0x90,0x03,0xdb,0x00,0x00,0x00,0x1d,0xf9,0x00,0x00,
+0xaf,0xd1,0x00,0x01,0xff,0xfe,0xef,0xff,0xff,0xfd,0x10,0x00,0xdf,0xff,0xfd,0xdf,
+0xfa,0xdf,0xa0,0x00,0x44,0x4f,0xf0,0x2f,0xe0,0x2a,0x10,0x00,0x00,0x5f,0xc0,0x2f,
+0x90,0x00,0xf3,0x11,0xcf,0x70,0x2f,0xe0,0x04,0xc4,0x00,0x1c,0xfe,0x10,0x2f,0xe0,
+0x06,0xf7,0x1b,0xff,0xe3,0x00,0x1f,0xfd,0xcf,0xf3,0x0a,0xfb,0x20,0x00,0x08,0xef,
+0xff,0x90,0x01,0x10,0x7e,0x00,0x41,0x06,0x71,0x0f,0xf0,0x78,0x02,0x12,0xf4,0x08,
+0x00,0x40,0x1f,0xf3,0x2f,0xf2,0xf8,0x00,0x10,0x6f,0x7f,0x00,0xd2,0xfd,0x00,0x00,
+0xdf,0xba,0xaf,0xfa,0xaa,0xa9,0x00,0x06,0xfc,0x00,0x20,0x00,0x12,0x62,0x08,0x00,
+0x03,0x08,0x01,0xd2,0xf1,0x1d,0xdd,0xef,0xfd,0xdf,0xfd,0xdd,0xd1,0x00,0x00,0x6f,
+0x80,0x21,0x00,0x21,0xbf,0x50,0x08,0x00,0xf0,0x0a,0x03,0xff,0x00,0x0f,0xf0,0x06,
+0x70,0x00,0x3e,0xf8,0x00,0x0f,0xf0,0x09,0xf2,0x1b,0xff,0xa0,0x00,0x0e,0xfd,0xcf,
+0xf0,0x0b,0xe7,0x00,0x01,0x26,0xfe,0x60,0x00,0x01,0x13,0x03,0x08,0x00,0x23,0x2f,
+0x90,0x07,0x01,0x12,0xf9,0x08,0x00,0x23,0x05,0xff,0x95,0x02,0x23,0x6f,0xf1,0x08,
+0x00,0x12,0xfa,0x08,0x00,0x41,0xbf,0xff,0x40,0x00,0x69,0x01,0x20,0xaf,0xd0,0x08,
+0x00,0x41,0x08,0xfd,0x0d,0xf7,0xb9,0x00,0x40,0xf6,0x04,0xff,0x20,0x1f,0x00,0xf1,
+0x10,0xd0,0x00,0xbf,0xc0,0x00,0x00,0x09,0xff,0x30,0x00,0x2f,0xfa,0x00,0x01,0xaf,
+0xf6,0x00,0x00,0x06,0xff,0xc1,0x2e,0xff,0x80,0x00,0x00,0x00,0x8f,0xf6,0x07,0xe5,
+0x5c,0x00,0x17,0xe0,0xd3,0x01,0x13,0x05,0x80,0x01,0x22,0x3f,0xf5,0x90,0x00,0x12,
+0xef,0x60,0x00,0x50,0x4f,0xf7,0x6f,0xf6,0x00,0x48,0x00,0xf1,0x08,0x70,0x05,0xff,
+0xa2,0x00,0x07,0xef,0xe4,0x00,0x00,0x3d,0xff,0x91,0x4f,0xff,0xdb,0xbb,0xbb,0xbc,
+0xff,0xf7,0x06,0x4c,0xe7,0x03,0x23,0x80,0x00,0xcf,0x03,0x00,0xb3,0x01,0x01,0xa8,
+0x00,0x10,0x09,0x18,0x00,0xa4,0xd0,0x00,0x00,0x05,0x99,0x9f,0xfa,0x99,0x80,0x00,
+0x20,0x00,0x92,0x07,0xbb,0xbb,0xbf,0xfb,0xbb,0xbb,0xa0,0x0a,0x38,0x01,0x02,0x80,
+0x00,0x01,0x84,0x01,0xb0,0x9f,0x80,0x08,0xf8,0x00,0x00,0x00,0x02,0xff,0x40,0x03,
+0xc0,0x00,0xf0,0x0a,0x0a,0xfb,0x00,0x00,0x9f,0xd0,0x00,0x00,0x4f,0xf3,0x00,0x00,
+0x0e,0xfa,0x00,0x02,0xff,0x90,0x39,0x20,0x04,0xff,0x90,0x1e,0xfc,0xd9,0x00,0xd3,
+0x7f,0xf3,0x04,0xc1,0x04,0xff,0x40,0x00,0x09,0x50,0x00,0x00,0x0d,0x0f,0x01,0x42,
+0x7f,0xe1,0x02,0xcc,0x40,0x00,0xf0,0x10,0x00,0xef,0x70,0x00,0x00,0x1d,0xf7,0x00,
+0x01,0x7f,0xf3,0x00,0x01,0xdf,0xfd,0xef,0xff,0xff,0xfc,0x00,0x00,0xef,0xff,0xff,
+0xdc,0xb9,0xef,0x60,0x00,0x55,0x32,0x2c,0x00,0x12,0x80,0x34,0x00,0x9d,0x02,0x00,
+0x00,0x00,0xaf,0x50,0x00,0xff,0x00,0x08,0x00,0x93,0x05,0xbb,0xef,0xcb,0xbb,0xff,
+0xbb,0xb0,0x08,0x80,0x02,0x8c,0x01,0x22,0xbf,0x62,0x22,0xff,0x22,0x20,0x28,0x00,
+0x83,0x0c,0xcc,0xef,0xdc,0xcc,0xff,0xcc,0xc6,0x08,0x02,0x71,0xf7,0x00,0x00,0x13,
+0x00,0x00,0x22,0x9f,0x01,0xf0,0x01,0xa0,0x04,0xfe,0x40,0x00,0x00,0x2c,0xfd,0x20,
+0x00,0x8f,0xf8,0x00,0x07,0xff,0xc1,0xcb,0x01,0x31,0xb0,0x04,0xe8,0x63,0x01,0x16,
+0x91,0xe8,0x04,0x00,0x37,0x00,0x80,0xf6,0x00,0x00,0x0d,0xf8,0x77,0x77,0x7c,0x08,
+0x00,0x40,0xf9,0x88,0x88,0x8d,0x08,0x00,0x50,0xfd,0xdd,0xdd,0xdf,0xf6,0x90,0x02,
+0x47,0x33,0x33,0x3b,0xf6,0x28,0x00,0x48,0xf3,0x11,0x11,0x1a,0x10,0x00,0xe5,0xf6,
+0x55,0x55,0x5b,0xf6,0x00,0x0b,0xbf,0xfc,0xbb,0xbb,0xbe,0xfd,0xb5,0x88,0x00,0xf0,
+0x03,0x04,0xcf,0x50,0x02,0xee,0x81,0x00,0x05,0xcf,0xfb,0x20,0x00,0x6e,0xff,0x81,
+0x0b,0xfb,0x40,0xf8,0x00,0x30,0xe3,0x00,0x20,0x34,0x02,0x00,0xf6,0x02,0x01,0x4f,
+0x06,0x0a,0x07,0x00,0x82,0xae,0xee,0xee,0xff,0xee,0xee,0xe2,0xcf,0xdb,0x03,0xb1,
+0xcf,0x20,0x04,0xfa,0x00,0x0b,0xf2,0xcf,0x20,0x07,0xf9,0x07,0x00,0x30,0x0c,0xff,
+0x60,0x07,0x00,0xf0,0x0d,0x6f,0xde,0xf7,0x0b,0xf2,0xcf,0x25,0xff,0x32,0xef,0x6b,
+0xf2,0xcf,0xaf,0xf5,0x00,0x3f,0xec,0xf2,0xcf,0x3b,0x30,0x00,0x04,0x2b,0xf2,0xcf,
+0x20,0xb6,0x03,0x01,0x07,0x00,0x50,0x2e,0xef,0xf0,0xcf,0x20,0xc5,0x00,0x30,0x70,
+0xac,0xcc,0x01,0x00,0x31,0xca,0xdf,0xff,0x48,0x03,0xdc,0xdf,0x31,0x13,0xfd,0x11,
+0x13,0xfd,0xdf,0x10,0x01,0xfc,0x00,0x01,0x07,0x00,0x64,0xdd,0xdd,0xff,0xdd,0xdd,
+0xfd,0x2a,0x00,0x10,0x10,0xa8,0x00,0x0f,0x07,0x00,0x07,0x50,0x09,0xde,0xfb,0xdf,
 0x10,0x53,0x01,0x23,0xc3,0x09,0xa3,0x01,0x30,0x07,0xbb,0xbb,0x05,0x01,0x10,0xb0,
-0x85,0x00,0x01,0x83,0x02,0x04,0xbb,0x03,0x10,0x6f,0xda,0x26,0x00,0x08,0x00,0x57,
-0x60,0x0c,0xf1,0x00,0xfd,0x18,0x00,0xe3,0xca,0xae,0xfb,0xaa,0xfd,0x00,0x00,0x7f,
-0x70,0x0c,0xf1,0x00,0xfe,0x00,0xc2,0x38,0x31,0xfb,0x3b,0xdf,0xdb,0x02,0x30,0xb8,
-0x00,0x6f,0x79,0x03,0x01,0x38,0x00,0x20,0x00,0x05,0x73,0x0d,0x10,0x6f,0x9c,0x55,
-0x12,0xd4,0x6e,0x13,0x03,0xb5,0x29,0x00,0x30,0x10,0x5b,0x03,0xfe,0x00,0x3f,0xd0,
-0x07,0x00,0x62,0xf1,0x03,0xfe,0x00,0x4f,0xd0,0xbd,0x04,0xf1,0x01,0xd0,0x0c,0xcc,
-0xcd,0xff,0xcc,0xcc,0xa0,0xce,0x40,0x03,0xfe,0x00,0x09,0xe7,0xdf,0x07,0x00,0x1b,
-0xf8,0x07,0x00,0x72,0xdb,0xbc,0xff,0xbb,0xbe,0xf8,0xdf,0xc5,0x38,0x10,0x12,0x73,
-0x05,0x53,0x2a,0xf8,0x00,0x00,0x14,0x9b,0x35,0x33,0x9f,0xc0,0x09,0x1c,0x03,0x21,
-0x01,0xff,0x67,0x3c,0x02,0xf2,0x15,0x21,0x6f,0xf2,0xce,0x1d,0x11,0x05,0x1e,0x17,
-0x31,0xef,0xa0,0x2f,0x5b,0x41,0x41,0xff,0xf3,0x05,0xae,0x03,0x02,0x11,0x40,0x18,
-0x2a,0x01,0x85,0x04,0x21,0x0a,0xf6,0x08,0x00,0x00,0xce,0x37,0x21,0x1f,0xe0,0x9c,
-0x02,0x00,0xf6,0x2f,0x40,0x00,0x3c,0xfe,0x10,0xf6,0x2a,0xe7,0x0a,0xff,0xe2,0x01,
-0xed,0xff,0x70,0x00,0x04,0xf9,0x10,0x00,0xcf,0xfa,0x66,0x29,0x13,0x07,0xba,0x1a,
-0x20,0xfb,0x00,0xd4,0x07,0x30,0x00,0x0b,0xd1,0xd1,0x00,0xf0,0x2b,0xe1,0xff,0xff,
-0xf6,0x67,0xfe,0x66,0xfe,0x0b,0xbb,0xef,0x50,0x1f,0xc0,0x0f,0xe0,0x00,0x2f,0xc0,
-0x02,0xfb,0x00,0xfd,0x00,0x0d,0xf5,0x91,0x3f,0xa0,0x0f,0xd0,0x0a,0xff,0xbe,0x36,
-0xf8,0x00,0xfc,0x0b,0xff,0xff,0x50,0x9f,0x50,0x1f,0xc4,0xfe,0xff,0xee,0x1d,0xf2,
-0x02,0xfb,0x0a,0x2f,0xe4,0xb3,0xfd,0x44,0x0d,0xf0,0x0d,0xfe,0x00,0xbf,0x70,0x04,
-0xf9,0x00,0x1f,0xe0,0x7f,0xf0,0x00,0x8f,0x70,0x01,0xfe,0x2f,0xf5,0x1e,0xef,0xf3,
-0x00,0x1f,0xe0,0x57,0x00,0xbe,0xd6,0xdb,0x18,0x10,0xfe,0xda,0x0d,0xf0,0x07,0xaf,
-0xba,0xaf,0xe0,0xbd,0x01,0xfc,0x0a,0xf1,0x00,0xee,0x0d,0xf0,0x1f,0xc0,0xaf,0x32,
-0x2e,0xe0,0xdf,0x01,0xfc,0x1e,0x00,0x00,0x0f,0x00,0xb0,0x59,0xfe,0x88,0x80,0xdf,
-0x01,0xfc,0x00,0x2f,0xc2,0x22,0x0f,0x00,0x40,0x03,0xff,0xff,0xf0,0x0f,0x00,0x30,
-0x6f,0xb8,0xef,0x0f,0x00,0x30,0x0a,0xf2,0x0c,0x0f,0x00,0xfd,0x0f,0x01,0xfe,0x00,
-0xed,0x02,0x20,0x1f,0xc0,0x9f,0x80,0x0f,0xc0,0x00,0x01,0xfc,0x5f,0xe3,0x9b,0xf9,
-0x00,0xbe,0xef,0xb0,0xc3,0x0f,0xfd,0x20,0x07,0xff,0xc3,0xcf,0x06,0x80,0x01,0x7d,
-0xb0,0x00,0x00,0xef,0x04,0x8c,0x10,0x34,0x20,0x0e,0xf0,0xf8,0x0e,0xb0,0x4d,0x70,
-0xef,0x04,0x31,0xfd,0x00,0x05,0xf8,0x0e,0xf0,0x34,0x01,0x30,0x5f,0x80,0xef,0x5b,
-0x03,0xf0,0x00,0xb5,0xf8,0x0e,0xf0,0xbb,0xdf,0xfb,0xb8,0x5f,0x80,0xef,0x00,0x0c,
-0xff,0x30,0x1e,0x00,0x01,0xb6,0x50,0xf1,0x0c,0x80,0xef,0x01,0xee,0xfe,0xef,0x55,
+0x85,0x00,0x01,0x83,0x02,0x04,0xbb,0x03,0x50,0x6f,0xdc,0xcf,0xfc,0xcc,0x08,0x00,
+0x57,0x60,0x0c,0xf1,0x00,0xfd,0x18,0x00,0xf2,0x00,0xca,0xae,0xfb,0xaa,0xfd,0x00,
+0x00,0x7f,0x70,0x0c,0xf1,0x00,0xfe,0x00,0x4f,0x48,0x00,0x31,0xfb,0x3b,0xdf,0xdb,
+0x02,0x30,0xb8,0x00,0x6f,0x79,0x03,0x01,0x38,0x00,0x41,0x00,0x05,0xcd,0xfc,0x08,
+0x00,0x30,0x02,0xff,0xd4,0x1b,0x03,0x34,0xfe,0x00,0x00,0x07,0x00,0x7b,0x0f,0xf0,
+0x03,0xfe,0x00,0x3f,0xd0,0x07,0x00,0x62,0xf1,0x03,0xfe,0x00,0x4f,0xd0,0xbd,0x04,
+0xf1,0x01,0xd0,0x0c,0xcc,0xcd,0xff,0xcc,0xcc,0xa0,0xce,0x40,0x03,0xfe,0x00,0x09,
+0xe7,0xdf,0x07,0x00,0x1b,0xf8,0x07,0x00,0x62,0xdb,0xbc,0xff,0xbb,0xbe,0xf8,0xfc,
+0x00,0x20,0xf8,0x12,0x73,0x05,0x81,0x2a,0xf8,0x00,0x00,0x14,0x00,0x00,0x40,0x1c,
+0x03,0x23,0xc0,0x09,0x1c,0x03,0xf1,0x17,0x01,0xff,0x30,0x00,0x00,0x0a,0xfc,0x00,
+0x00,0x7f,0xd0,0x00,0x00,0x6f,0xf2,0x00,0x00,0x0c,0xfb,0x00,0x05,0xff,0x70,0x00,
+0x00,0x01,0xef,0xa0,0x2f,0xff,0xdd,0xdd,0xdd,0xdd,0xff,0xf3,0x05,0xae,0x03,0x02,
+0x52,0x40,0x00,0x00,0x07,0xfa,0xa6,0x04,0x22,0x0a,0xf6,0x08,0x00,0x51,0x2f,0xf1,
+0x00,0x1f,0xe0,0x9c,0x02,0xf4,0x0b,0x00,0x2f,0xd0,0x00,0x00,0x3c,0xfe,0x10,0x00,
+0x6f,0xb0,0x00,0x0a,0xff,0xe2,0x01,0xed,0xff,0x70,0x00,0x04,0xf9,0x10,0x00,0xcf,
+0xfa,0x90,0x03,0x00,0xad,0x03,0x12,0x10,0x19,0x04,0x20,0xfb,0x00,0xd4,0x07,0x30,
+0x00,0x0b,0xd1,0xd1,0x00,0xf0,0x4d,0xe1,0xff,0xff,0xf6,0x67,0xfe,0x66,0xfe,0x0b,
+0xbb,0xef,0x50,0x1f,0xc0,0x0f,0xe0,0x00,0x2f,0xc0,0x02,0xfb,0x00,0xfd,0x00,0x0d,
+0xf5,0x91,0x3f,0xa0,0x0f,0xd0,0x0a,0xff,0xbe,0x36,0xf8,0x00,0xfc,0x0b,0xff,0xff,
+0x50,0x9f,0x50,0x1f,0xc4,0xfe,0xff,0xee,0x1d,0xf2,0x02,0xfb,0x0a,0x2f,0xe4,0xb3,
+0xfd,0x00,0x3f,0xa0,0x01,0xfe,0x00,0xbf,0x70,0x04,0xf9,0x00,0x1f,0xe0,0x7f,0xf0,
+0x00,0x8f,0x70,0x01,0xfe,0x2f,0xf5,0x1e,0xef,0xf3,0x00,0x1f,0xe0,0x57,0x00,0xbe,
+0xd6,0x00,0x0a,0x97,0x08,0xf0,0x0a,0x00,0x1f,0xc0,0xaf,0xba,0xaf,0xe0,0xbd,0x01,
+0xfc,0x0a,0xf1,0x00,0xee,0x0d,0xf0,0x1f,0xc0,0xaf,0x32,0x2e,0xe0,0xdf,0x01,0xfc,
+0x1e,0x00,0x00,0x0f,0x00,0xb0,0x59,0xfe,0x88,0x80,0xdf,0x01,0xfc,0x00,0x2f,0xc2,
+0x22,0x0f,0x00,0x40,0x03,0xff,0xff,0xf0,0x0f,0x00,0x30,0x6f,0xb8,0xef,0x0f,0x00,
+0x30,0x0a,0xf2,0x0c,0x0f,0x00,0xfd,0x0f,0x01,0xfe,0x00,0xed,0x02,0x20,0x1f,0xc0,
+0x9f,0x80,0x0f,0xc0,0x00,0x01,0xfc,0x5f,0xe3,0x9b,0xf9,0x00,0xbe,0xef,0xb0,0xc3,
+0x0f,0xfd,0x20,0x07,0xff,0xc3,0xcf,0x06,0xf0,0x0e,0x01,0x7d,0xb0,0x00,0x00,0xef,
+0x04,0x8c,0xff,0xff,0x30,0x00,0x0e,0xf0,0xff,0xff,0xf5,0x00,0x4d,0x70,0xef,0x04,
+0x31,0xfd,0x00,0x05,0xf8,0x0e,0xf0,0x34,0x01,0x30,0x5f,0x80,0xef,0x5b,0x03,0xf0,
+0x00,0xb5,0xf8,0x0e,0xf0,0xbb,0xdf,0xfb,0xb8,0x5f,0x80,0xef,0x00,0x0c,0xff,0x30,
+0x1e,0x00,0xf0,0x11,0x05,0xff,0xff,0x50,0x5f,0x80,0xef,0x01,0xee,0xfe,0xef,0x55,
 0xf8,0x0e,0xf0,0xcf,0x6f,0xd2,0xe2,0x5f,0x80,0xef,0x3f,0xb0,0xfd,0x01,0x00,0x10,
-0x0e,0xf0,0xa1,0x0f,0x34,0x29,0x01,0x48,0x02,0x30,0x9f,0xff,0xd0,0x3f,0x12,0x36,
-0x04,0xfe,0xb3,0x5b,0x3a,0x22,0xdf,0x10,0xae,0x02,0x10,0x8f,0xda,0x4d,0x01,0x46,
-0x06,0xf0,0x0e,0xdb,0x7f,0x3c,0xf1,0x1e,0xef,0xff,0xee,0xec,0x7f,0x3c,0xf1,0x00,
-0x0d,0xf4,0x06,0x20,0x7f,0x3c,0xf1,0x01,0xcf,0x50,0x6f,0x90,0x7f,0x3c,0xf1,0x0b,
-0x53,0x32,0x80,0x7f,0x3c,0xf1,0x06,0xca,0xbf,0xf5,0x61,0x20,0x00,0x40,0x03,0xef,
-0x68,0xfa,0x08,0x00,0x40,0x8f,0xf6,0x5f,0xd0,0x20,0x00,0xc0,0xfe,0x46,0xff,0x30,
-0x7f,0x3c,0xf1,0x02,0x91,0x9f,0xfe,0x20,0x58,0x00,0xf7,0x06,0x5d,0xfd,0x7f,0xf5,
-0x00,0x0d,0xf1,0x0c,0xff,0xa0,0x03,0xfd,0x1c,0xcf,0xf0,0x06,0xc4,0x00,0x00,0x31,
-0x0c,0xe6,0x08,0x21,0x04,0xf8,0xfe,0x00,0xf0,0x12,0x73,0x4f,0x81,0xb6,0x00,0x01,
-0xfc,0x1f,0xb4,0xf8,0x6f,0x65,0x70,0x1f,0xc0,0xbf,0x6f,0x8c,0xf1,0xcf,0x11,0xfc,
-0x06,0x87,0xfa,0x88,0x0c,0xf1,0x1f,0xc0,0xcf,0xff,0xff,0x0f,0x00,0x50,0x0c,0xf8,
-0x77,0xdf,0x1c,0x0f,0x00,0x20,0x98,0x8e,0x0f,0x00,0x00,0xaf,0x2e,0x01,0x0f,0x00,
-0x21,0x10,0x0c,0x0f,0x00,0x43,0xfa,0xaa,0xef,0x1c,0x2d,0x00,0x50,0x56,0x01,0xfc,
-0x0c,0xf0,0x72,0x0b,0xf2,0x01,0x1f,0xc0,0xcf,0x05,0xcf,0xf0,0x0b,0xcc,0xfb,0x0c,
-0xf0,0x2f,0xd6,0x00,0xaf,0xfe,0xb1,0x06,0x12,0x21,0x72,0x38,0x10,0x05,0xfb,0x00,
-0x00,0x94,0x28,0x10,0xe0,0x4b,0x03,0x63,0x10,0x01,0xef,0x50,0x00,0x3f,0x70,0x13,
-0x04,0x80,0x13,0x10,0x02,0x6b,0x0a,0x30,0x00,0x7f,0x50,0xa3,0x19,0x81,0x0a,0xf1,
+0x0e,0xf0,0xa1,0x0f,0x9d,0x05,0x11,0xff,0x48,0x02,0xa2,0x9f,0xff,0xd0,0x00,0x0f,
+0xd0,0x00,0x04,0xfe,0xb3,0x7a,0x04,0x00,0x01,0x00,0x22,0xdf,0x10,0xae,0x02,0x20,
+0x8f,0x70,0x08,0x00,0x00,0x46,0x06,0xf0,0x1a,0xdb,0x7f,0x3c,0xf1,0x1e,0xef,0xff,
+0xee,0xec,0x7f,0x3c,0xf1,0x00,0x0d,0xf4,0x06,0x20,0x7f,0x3c,0xf1,0x01,0xcf,0x50,
+0x6f,0x90,0x7f,0x3c,0xf1,0x0b,0xff,0xff,0xfe,0x10,0x7f,0x3c,0xf1,0x06,0xca,0xbf,
+0xf5,0x61,0x20,0x00,0x40,0x03,0xef,0x68,0xfa,0x08,0x00,0x40,0x8f,0xf6,0x5f,0xd0,
+0x20,0x00,0xc0,0xfe,0x46,0xff,0x30,0x7f,0x3c,0xf1,0x02,0x91,0x9f,0xfe,0x20,0x58,
+0x00,0xf7,0x06,0x5d,0xfd,0x7f,0xf5,0x00,0x0d,0xf1,0x0c,0xff,0xa0,0x03,0xfd,0x1c,
+0xcf,0xf0,0x06,0xc4,0x00,0x00,0x31,0x0c,0xe6,0x08,0x21,0x04,0xf8,0xfe,0x00,0xf0,
+0x12,0x73,0x4f,0x81,0xb6,0x00,0x01,0xfc,0x1f,0xb4,0xf8,0x6f,0x65,0x70,0x1f,0xc0,
+0xbf,0x6f,0x8c,0xf1,0xcf,0x11,0xfc,0x06,0x87,0xfa,0x88,0x0c,0xf1,0x1f,0xc0,0xcf,
+0xff,0xff,0x0f,0x00,0x50,0x0c,0xf8,0x77,0xdf,0x1c,0x0f,0x00,0x21,0x98,0x8e,0x0f,
+0x00,0x31,0xff,0xff,0xff,0x0f,0x00,0x21,0x10,0x0c,0x0f,0x00,0x43,0xfa,0xaa,0xef,
+0x1c,0x2d,0x00,0xf2,0x0a,0x56,0x01,0xfc,0x0c,0xf0,0x00,0xbf,0x10,0x00,0x1f,0xc0,
+0xcf,0x05,0xcf,0xf0,0x0b,0xcc,0xfb,0x0c,0xf0,0x2f,0xd6,0x00,0xaf,0xfe,0xb1,0x06,
+0x21,0x21,0x00,0xd7,0x02,0x10,0x05,0xfb,0x00,0x50,0xf8,0x00,0x00,0x6f,0xe0,0x4b,
+0x03,0x62,0x10,0x01,0xef,0x50,0x00,0x3f,0x83,0x03,0x31,0xf3,0x2a,0xaa,0x01,0x00,
+0x20,0xa2,0x02,0x6b,0x0a,0xf1,0x00,0x00,0x7f,0x50,0x05,0xff,0xff,0xff,0x0a,0xf1,
 0x7f,0x60,0x05,0xfa,0x66,0xef,0x08,0x00,0x22,0xfc,0x99,0x10,0x00,0x22,0xfe,0xcc,
-0x08,0x00,0x22,0xf8,0x22,0x18,0x00,0x04,0x28,0x00,0xfe,0x07,0xf8,0x33,0xef,0x05,
+0x08,0x00,0x22,0xf8,0x22,0x18,0x00,0x04,0x28,0x00,0xfe,0x08,0xf8,0x33,0xef,0x05,
 0x70,0x7f,0x60,0x05,0xf6,0x48,0xfe,0x00,0x7b,0xef,0x40,0x05,0xf6,0x3f,0xf7,0x00,
-0x4f,0xfa,0x3f,0x0e,0x00,0xe2,0x0c,0xc0,0x00,0x0a,0xf1,0x01,0x11,0xaf,0x71,0x11,
-0x00,0x0a,0xf1,0x1f,0xf4,0x08,0xf0,0x0c,0x46,0x0a,0xf1,0x1f,0xa3,0x6a,0x43,0xfa,
-0x9f,0x1a,0xf1,0x0b,0xeb,0xdf,0xcb,0xf6,0x9f,0x1a,0xf1,0x01,0x77,0xbf,0x97,0x70,
-0x9f,0x1a,0xf1,0x50,0x26,0x10,0x50,0x08,0x00,0x80,0x45,0x9f,0x85,0x20,0x9f,0x1a,
-0xf1,0x0f,0x68,0x03,0x80,0x9f,0x1a,0xf1,0x06,0x66,0xaf,0x86,0x62,0x28,0x00,0x80,
-0xaa,0xcf,0xba,0x90,0x9f,0x1a,0xf1,0x02,0x90,0x04,0x50,0x47,0x0a,0xf1,0x02,0xf6,
-0xbb,0x0a,0xf6,0x03,0x0b,0xf1,0x02,0xff,0xee,0xef,0xf0,0x0c,0xdf,0xf0,0x02,0xfa,
-0x77,0x7b,0xd0,0x09,0xec,0x50,0xc9,0x12,0x13,0x0e,0xd5,0x07,0x04,0x0f,0x00,0x16,
-0xf2,0xf4,0x08,0x11,0x60,0xb6,0x1d,0x00,0xb0,0x18,0x01,0xa9,0x4a,0x11,0x40,0x90,
-0x1a,0x21,0x0b,0xf3,0x5f,0x42,0x31,0x00,0xdf,0x20,0xe4,0x21,0x22,0x0e,0xf1,0x54,
-0x21,0x12,0xff,0x49,0x2c,0x21,0x3f,0xd0,0x32,0x20,0x70,0x08,0xfa,0x02,0xdf,0xf8,
-0x00,0x06,0x0a,0x1d,0x59,0xe4,0x00,0x00,0x1f,0xfe,0x58,0x21,0x10,0x0b,0xe6,0x11,
-0x60,0x22,0x22,0x20,0x0b,0xf3,0x00,0xaf,0x2c,0x14,0xd0,0x08,0x00,0x00,0x36,0x11,
-0x41,0x01,0x2f,0xd1,0x1e,0xb6,0x0b,0x70,0x1f,0xc0,0x0b,0xcf,0xfc,0xce,0xf3,0x8a,
-0x10,0x70,0x0d,0xf0,0x0b,0xf2,0x00,0x1f,0xc0,0x80,0x41,0x10,0xf1,0x08,0x00,0x20,
-0x2f,0xc0,0x08,0x00,0xf0,0x0c,0xe8,0xc0,0x7f,0x80,0x0d,0xf0,0x29,0xdf,0xff,0xf3,
-0xdf,0x30,0x0e,0xf0,0x2f,0xfd,0x95,0x18,0xfd,0x00,0x0f,0xe0,0x06,0x20,0x00,0x6f,
-0xf3,0x7c,0x3f,0x00,0x00,0x30,0x10,0xcd,0x6b,0x08,0x42,0x03,0xe5,0x00,0x9f,0xdd,
-0x13,0x08,0x74,0x1f,0x23,0x03,0xfa,0x0f,0x00,0x10,0xa0,0x7b,0x00,0x80,0xe2,0xcd,
-0xff,0xdd,0xd3,0xff,0xff,0xfe,0x6e,0x15,0x90,0x3f,0xc0,0x1f,0xe0,0x05,0xf9,0x0d,
-0xf3,0xfc,0x46,0x33,0xa0,0x70,0xef,0x2f,0xc0,0x1f,0xe0,0x08,0xf6,0x0e,0xf2,0x0f,
-0x00,0x30,0xaf,0x40,0xfe,0x0f,0x00,0x40,0x0c,0xf1,0x0f,0xd2,0x0f,0x00,0x30,0xff,
-0x02,0xfc,0x0f,0x00,0xf5,0x0f,0x4f,0xa0,0x4f,0xa2,0xfc,0x01,0xfe,0x0b,0xf5,0x08,
-0xf8,0x2f,0xfe,0xef,0xe4,0xfe,0x7f,0xff,0x42,0xff,0xff,0xfe,0x2d,0x52,0xfe,0x90,
-0x2f,0xb0,0x1d,0xc0,0x7a,0x00,0x13,0x30,0x9f,0x1c,0x12,0xf2,0xf3,0x01,0x21,0x04,
+0x4f,0xfa,0x00,0x01,0x00,0xe0,0x9f,0x10,0x00,0x00,0x0a,0xf1,0x01,0x11,0xaf,0x71,
+0x11,0x00,0x0a,0xf1,0xe3,0x01,0xf0,0x12,0xfa,0x46,0x0a,0xf1,0x1f,0xa3,0x6a,0x43,
+0xfa,0x9f,0x1a,0xf1,0x0b,0xeb,0xdf,0xcb,0xf6,0x9f,0x1a,0xf1,0x01,0x77,0xbf,0x97,
+0x70,0x9f,0x1a,0xf1,0x00,0xbf,0xff,0xff,0x50,0x08,0x00,0x80,0x45,0x9f,0x85,0x20,
+0x9f,0x1a,0xf1,0x0f,0x68,0x03,0x80,0x9f,0x1a,0xf1,0x06,0x66,0xaf,0x86,0x62,0x28,
+0x00,0x80,0xaa,0xcf,0xba,0x90,0x9f,0x1a,0xf1,0x02,0x90,0x04,0x50,0x47,0x0a,0xf1,
+0x02,0xf6,0xbb,0x0a,0xf2,0x07,0x0b,0xf1,0x02,0xff,0xee,0xef,0xf0,0x0c,0xdf,0xf0,
+0x02,0xfa,0x77,0x7b,0xd0,0x09,0xec,0x50,0x00,0x00,0x00,0xef,0x5c,0x03,0x13,0x0e,
+0xd5,0x07,0x04,0x0f,0x00,0x16,0xf2,0xf4,0x08,0x80,0x60,0xee,0xee,0xef,0xfe,0xee,
+0xef,0xf5,0xe3,0x07,0xf0,0x05,0x00,0x00,0xaf,0x40,0x00,0x00,0x4f,0xc0,0x00,0x0b,
+0xf3,0x00,0x00,0x0a,0xf9,0x00,0x00,0xdf,0x20,0x00,0x0b,0x04,0x00,0x3f,0x00,0x21,
+0xbf,0xc0,0x61,0x02,0xf8,0x0d,0x8f,0xf3,0x00,0x00,0x3f,0xd0,0x00,0x9f,0xf6,0x00,
+0x00,0x08,0xfa,0x02,0xdf,0xf8,0x00,0x06,0xff,0xff,0x50,0x09,0xe4,0x00,0x00,0x1f,
+0xfe,0x80,0xf2,0x00,0x00,0x42,0x00,0x40,0x02,0x22,0x22,0x20,0x08,0x00,0x45,0x2f,
+0xff,0xff,0xd0,0x08,0x00,0x71,0xf4,0x00,0x00,0x01,0x2f,0xd1,0x1e,0xb6,0x0b,0x60,
+0x1f,0xc0,0x0b,0xcf,0xfc,0xce,0x08,0x00,0x50,0x00,0x0d,0xf0,0x0b,0xf2,0x08,0x00,
+0x40,0x0f,0xe0,0x0c,0xf1,0x08,0x00,0x20,0x2f,0xc0,0x08,0x00,0xf0,0x15,0xe8,0xc0,
+0x7f,0x80,0x0d,0xf0,0x29,0xdf,0xff,0xf3,0xdf,0x30,0x0e,0xf0,0x2f,0xfd,0x95,0x18,
+0xfd,0x00,0x0f,0xe0,0x06,0x20,0x00,0x6f,0xf3,0x00,0x4f,0xb0,0x00,0x00,0x08,0xff,
+0x70,0xcd,0x6b,0x08,0x65,0x03,0xe5,0x00,0x9f,0xfb,0x10,0x7d,0x00,0x22,0x3f,0xb0,
+0x3a,0x05,0x13,0xfa,0x0f,0x00,0x10,0xa0,0x7b,0x00,0xf0,0x05,0xe2,0xcd,0xff,0xdd,
+0xd3,0xff,0xff,0xfe,0x2f,0xff,0xff,0xff,0x3f,0xc0,0x1f,0xe0,0x05,0xf9,0x0d,0xf3,
+0xc1,0x03,0xb0,0x7f,0x70,0xef,0x2f,0xc0,0x1f,0xe0,0x08,0xf6,0x0e,0xf2,0x0f,0x00,
+0x30,0xaf,0x40,0xfe,0x0f,0x00,0x40,0x0c,0xf1,0x0f,0xd2,0x0f,0x00,0x30,0xff,0x02,
+0xfc,0x0f,0x00,0xf5,0x0f,0x4f,0xa0,0x4f,0xa2,0xfc,0x01,0xfe,0x0b,0xf5,0x08,0xf8,
+0x2f,0xfe,0xef,0xe4,0xfe,0x7f,0xff,0x42,0xff,0xff,0xfe,0x2d,0x52,0xfe,0x90,0x2f,
+0xb0,0x1d,0xc0,0x7a,0x00,0x12,0x30,0x07,0x00,0x22,0x08,0xf2,0xf3,0x01,0x21,0x04,
 0xfa,0x08,0x00,0x71,0x09,0x99,0xfc,0x99,0x50,0xaf,0x10,0xc6,0x09,0x90,0x80,0xaf,
-0x10,0x00,0x05,0x9b,0x66,0xc6,0x6f,0xe6,0x0c,0xf0,0x2f,0xde,0x05,0xf9,0x2c,0xef,
+0x10,0x00,0x05,0x9b,0x66,0xc6,0x6f,0xe6,0x0c,0xfd,0x40,0xde,0x05,0xf9,0x2c,0xef,
 0xce,0xf1,0x0a,0xf5,0x00,0xaf,0x50,0xbf,0x0a,0xf0,0x2f,0xa3,0x0b,0xde,0xb0,0xdd,
 0x0a,0xf0,0x05,0x8f,0x8f,0xb3,0x00,0xfc,0x0b,0xf0,0x00,0x1c,0xff,0x50,0x03,0xf8,
 0x0c,0xe0,0x00,0x04,0xff,0x60,0x07,0xf4,0x0c,0xe0,0x00,0x1e,0xfe,0xf3,0x0e,0xf0,
-0x0e,0xd0,0x02,0xdf,0x73,0xe3,0x8f,0x80,0x0f,0xdd,0x29,0xdd,0x16,0xfe,0x3b,0xdf,
-0x80,0x09,0x50,0x00,0x03,0xe3,0x0e,0xfc,0x10,0x77,0x02,0x60,0x13,0x58,0xcf,0x10,
-0xbf,0x20,0xea,0x01,0x81,0xfd,0x50,0xbf,0x20,0x00,0x04,0x54,0xfc,0x5a,0x11,0x10,
-0x2f,0x8b,0x10,0xf0,0x0d,0xbf,0x10,0x00,0x18,0x88,0xfd,0x88,0xaf,0xff,0xff,0xf5,
-0x09,0xdd,0xff,0xdd,0xac,0xff,0xce,0xf5,0x0b,0xd5,0xfd,0x6f,0x80,0xdf,0x08,0xf4,
-0x0b,0xa8,0x00,0xb0,0xfe,0x08,0xf4,0x0b,0xd4,0xfc,0x4f,0x81,0xfc,0x09,0xf3,0x10,
-0x00,0xc0,0x83,0xf9,0x09,0xf3,0x04,0x55,0xfd,0x55,0x38,0xf5,0x0a,0xf2,0x94,0x03,
-0xd0,0xae,0xf1,0x0c,0xf1,0x01,0x23,0xfd,0x68,0xbf,0x80,0x0e,0xf0,0x2f,0xe9,0x06,
-0x92,0x2c,0xdf,0xc0,0x06,0x54,0x20,0x02,0xd2,0x0d,0xbb,0x29,0x0a,0x49,0x2f,0x42,
-0xdf,0x40,0xff,0x10,0x4a,0x33,0x21,0xff,0x10,0xfe,0x3c,0x70,0x00,0xff,0x10,0x1d,
-0x40,0x00,0x7f,0xba,0x44,0xb0,0xbf,0xd0,0x03,0xff,0xe0,0x00,0xff,0x18,0xff,0x30,
-0x2e,0x08,0x00,0x70,0x8f,0xf5,0x00,0x2f,0xef,0xe0,0x00,0x21,0x29,0x61,0x07,0x4f,
-0xe0,0x00,0xff,0xf6,0xe6,0x3e,0x31,0x4d,0xff,0x60,0x46,0x3b,0xf0,0x06,0xff,0xff,
-0x10,0x01,0x00,0x00,0x1f,0xe8,0xf8,0xff,0x10,0x09,0xb2,0x00,0x1f,0xe0,0x10,0xff,
-0x10,0x0a,0xf3,0x3a,0x05,0x31,0xff,0x20,0x0d,0x76,0x06,0x40,0xcf,0xfe,0xef,0xd0,
-0x08,0x00,0x60,0x4d,0xff,0xfd,0x30,0x00,0x02,0x56,0x20,0x10,0x30,0x89,0x09,0x41,
-0xaf,0x70,0x05,0xfd,0x6e,0x0b,0xb3,0xf1,0x0d,0xf4,0x00,0x00,0x7d,0xf9,0x9e,0xd9,
-0xbf,0xe9,0x0b,0x26,0x00,0x68,0x3f,0x57,0x32,0x2f,0xf2,0x22,0xff,0x10,0x00,0x40,
-0x54,0x5f,0xf4,0x45,0x08,0x00,0x44,0x99,0x9f,0xf9,0x99,0x18,0x00,0x01,0x8e,0x07,
-0x01,0x75,0x0c,0x04,0xb0,0x17,0x20,0x2c,0xcc,0xfd,0x12,0x24,0xcc,0xc2,0x18,0x00,
-0x07,0x08,0x00,0x28,0x0d,0xf2,0x08,0x00,0x64,0x12,0x22,0x2e,0xf4,0x22,0x22,0xa9,
-0x26,0x98,0x40,0x00,0xac,0xcc,0xcf,0xfd,0xcc,0xcc,0x30,0x28,0x00,0x01,0xc0,0x27,
-0x05,0x00,0x19,0x20,0xdf,0xff,0x00,0x19,0x00,0x3a,0x21,0x22,0x00,0x46,0xef,0x12,
-0x01,0x4e,0x1f,0x00,0x72,0x3e,0x00,0x59,0x20,0x84,0x4f,0xf6,0x45,0x67,0x8e,0xfb,
-0x00,0x01,0x81,0x20,0x7a,0xce,0xca,0x98,0x65,0x43,0x7f,0x90,0xe2,0x0b,0x00,0x04,
-0x05,0x62,0x23,0x45,0x68,0x9c,0xe8,0x00,0x06,0x0b,0xc0,0xca,0x10,0x05,0xad,0xb7,
-0x7d,0xa2,0x13,0x94,0x00,0x00,0x4f,0x42,0x07,0xb3,0xf7,0x00,0x00,0x0d,0xe0,0x0c,
-0xe1,0x0f,0xe0,0x00,0x0e,0xdb,0x08,0x20,0x0f,0xfa,0x0f,0x05,0x40,0xaf,0xf0,0x0f,
-0xc0,0x3c,0x00,0x50,0x0d,0xf0,0x07,0x6a,0xff,0x6d,0x2a,0x80,0x70,0x00,0x08,0xfe,
-0xaa,0xab,0xff,0x80,0x48,0x17,0x12,0x90,0xd6,0x26,0x41,0x0c,0xfc,0xdf,0xd1,0xbc,
-0x1a,0xf5,0x08,0xff,0xff,0x83,0x00,0x00,0x18,0xad,0xff,0xfb,0xbf,0xff,0xec,0xa1,
-0x0a,0xff,0xb7,0x10,0x02,0x7b,0xef,0x90,0x01,0x20,0xd7,0x40,0x26,0x74,0x00,0xbf,
-0x46,0x05,0x03,0x39,0x40,0x0d,0xdd,0xde,0xfe,0xad,0x53,0x14,0x0f,0xef,0x17,0x00,
-0x4f,0x14,0x17,0x00,0xdb,0x2c,0x20,0x08,0xfe,0x1e,0x1d,0x04,0x69,0x01,0x00,0x4c,
-0x3c,0x80,0xaa,0xaa,0xaa,0xff,0x00,0x2d,0xfc,0xef,0xe6,0x06,0x00,0x6d,0x17,0x01,
-0x08,0x00,0x74,0x04,0x00,0xdf,0x11,0x11,0x11,0xff,0x02,0x28,0x00,0x08,0x00,0x52,
-0xcb,0xbb,0xbc,0xee,0x00,0xe1,0x05,0x00,0xa9,0x04,0x51,0xea,0xaa,0xaa,0xae,0xf3,
-0x01,0x04,0x01,0xa0,0x38,0x04,0x18,0x00,0x10,0x2b,0xe7,0x19,0x1c,0xb2,0x66,0x0e,
-0x40,0xf0,0x1a,0xab,0xff,0x01,0x01,0x14,0xa0,0x5d,0x43,0x23,0x00,0x0b,0x30,0x00,
-0x11,0x0a,0x17,0x01,0x17,0x00,0x57,0x3f,0x33,0x0b,0xbb,0xef,0xc1,0x31,0x1a,0xfa,
-0x4e,0x26,0x13,0x91,0x5f,0x0d,0x13,0xf6,0xde,0x0c,0x21,0xfe,0x30,0x24,0x0a,0x20,
-0xf8,0x7f,0x36,0x0d,0x10,0x3c,0xde,0x0c,0xc0,0xd6,0x00,0x2b,0xff,0xfe,0xaa,0xaa,
-0xdf,0xff,0xe2,0x1d,0xfa,0x39,0x03,0x40,0x6e,0x90,0x03,0x30,0x76,0x1b,0x02,0x09,
-0x1b,0x01,0x80,0x4b,0x13,0x0f,0x17,0x01,0x62,0x0f,0xf9,0x99,0x99,0x9f,0xf1,0x56,
-0x02,0x22,0x0e,0xf1,0x36,0x1a,0x27,0x0e,0xf1,0x20,0x00,0x63,0xfb,0xbb,0xbb,0xbe,
-0xe1,0x00,0x9b,0x35,0x20,0xcf,0xdc,0x46,0x1e,0x31,0xfc,0xcf,0x10,0xec,0x4f,0x20,
-0xcf,0x1d,0x04,0x26,0x75,0xfc,0xcf,0x19,0xaa,0xaa,0xaa,0x91,0x15,0x00,0x00,0x7f,
-0x13,0xa0,0x11,0xfc,0xcf,0x11,0xfd,0x88,0xdf,0x11,0xfc,0xcf,0x2d,0x16,0x00,0x07,
-0x00,0x48,0xfb,0x00,0xbf,0x11,0x1c,0x00,0xc0,0x88,0x01,0xfc,0xcf,0x10,0x53,0x00,
-0x07,0xde,0xfa,0xcf,0x10,0x5c,0x0e,0x07,0xba,0x0f,0x21,0x85,0x10,0x8f,0x15,0x13,
-0xfd,0x32,0x4d,0x00,0x04,0x0c,0x20,0x3d,0xfe,0xe8,0x36,0x30,0x0a,0xff,0xb1,0xcc,
-0x21,0x70,0x04,0xe5,0x7e,0x40,0x1b,0xfd,0x00,0x28,0x44,0x21,0xef,0xb1,0xc4,0x1a,
-0x10,0xf8,0x62,0x4d,0x62,0xdf,0xff,0xfc,0xcc,0xcb,0x2e,0xa0,0x1f,0x31,0x0c,0xd9,
-0xfd,0x41,0x17,0x1a,0x01,0x07,0x00,0x02,0x64,0x03,0xa3,0x01,0xff,0xaa,0xaa,0xab,
-0xfe,0x00,0x00,0x03,0x63,0x93,0x33,0x06,0xc2,0x29,0x45,0xbd,0xdd,0xef,0xfd,0xaa,
-0x1a,0x22,0xf3,0xcf,0x97,0x14,0x70,0xcf,0x11,0x99,0x99,0x98,0x0b,0xf3,0xbd,0x00,
-0x10,0xfe,0x07,0x00,0x37,0xf9,0x00,0xde,0x07,0x00,0x39,0xfd,0xaa,0xfe,0x1c,0x00,
-0x21,0x00,0x0b,0x38,0x00,0x40,0x1d,0xdf,0xf1,0xcf,0x17,0x08,0x05,0xb3,0x06,0x06,
-0x00,0x10,0x50,0xcc,0xcf,0xff,0xcc,0xcc,0xee,0x4a,0x00,0x4d,0x34,0x01,0x30,0x26,
-0xf0,0x07,0xe1,0xda,0x20,0x00,0x00,0x5c,0xff,0xcf,0xe3,0xcf,0xfa,0x20,0x4e,0xff,
-0xe5,0x0f,0xe0,0x05,0xdf,0xf3,0x0c,0xd6,0x94,0x01,0x25,0x08,0xa0,0x42,0x2d,0x13,
-0x5f,0x97,0x0d,0x60,0x5f,0xeb,0xbb,0xbb,0xbe,0xf7,0xb0,0x14,0x38,0x00,0x00,0x09,
-0x08,0x00,0x04,0x20,0x00,0x51,0xea,0xaa,0xaa,0xad,0xf7,0x13,0x03,0x03,0xc4,0x1f,
-0x01,0xb7,0x3e,0x01,0xbc,0x1d,0x11,0xef,0xc1,0x03,0xf2,0x11,0x3b,0xff,0x70,0x9f,
-0xe6,0x10,0x00,0x06,0xcf,0xfe,0x5c,0xc1,0x5f,0xff,0xb5,0x01,0xef,0xe7,0x00,0x9f,
-0xc0,0x18,0xef,0xa0,0x03,0x57,0x99,0x99,0xeb,0x99,0x71,0x60,0x8e,0x04,0x28,0xfe,
-0x10,0xfb,0x22,0x00,0x99,0x03,0x01,0x3f,0x25,0x03,0xbb,0x47,0x62,0xfd,0x99,0x99,
-0x99,0xaf,0xc0,0x08,0x07,0x10,0x03,0x11,0x00,0x02,0xab,0x34,0x02,0x11,0x03,0x20,
-0xab,0xfc,0x38,0x0f,0x32,0xa3,0x09,0xf6,0xe7,0x35,0x02,0x08,0x00,0x83,0x7f,0xfa,
-0xae,0xfd,0xaa,0xaa,0x00,0x02,0xdb,0x39,0x50,0x0d,0xf9,0x00,0x0a,0xf6,0xcf,0x02,
-0x11,0xc0,0xca,0x34,0x08,0x20,0x01,0x00,0x01,0x00,0x16,0xc0,0x6a,0x07,0x12,0xff,
-0x07,0x46,0x10,0x3f,0xf8,0x00,0x12,0xf8,0x72,0x00,0x10,0x08,0x08,0x00,0x13,0xc0,
-0x08,0x00,0x07,0x20,0x00,0x21,0xbd,0xf8,0x20,0x0f,0x00,0x10,0x15,0x20,0x0e,0xfb,
-0x9c,0x28,0x30,0xf2,0x00,0xef,0xf1,0x1e,0xf0,0x30,0xbf,0x20,0x0e,0xf3,0xff,0xff,
-0xff,0x4b,0xf2,0x00,0xef,0x17,0x7f,0xe7,0x72,0xbf,0x20,0x0f,0xf3,0x66,0xfe,0x66,
-0x4b,0xf2,0x00,0xfe,0x8f,0xff,0xff,0xf9,0xbf,0x20,0x1f,0xe0,0x11,0x11,0x11,0x1b,
-0xf2,0x02,0xfc,0x0e,0xff,0xff,0xf0,0xbf,0x20,0x3f,0xa0,0xfd,0x77,0xdf,0x0b,0xf2,
-0x07,0xf7,0x0f,0xb0,0x0a,0xf0,0xbf,0x20,0xcf,0xfa,0x16,0xf5,0x00,0x0b,0xf2,0x3f,
-0xc0,0x0f,0xd7,0x77,0xfc,0xff,0x12,0xc4,0x00,0x32,0x00,0x0a,0x8b,0x08,0x00,0x2c,
-0x01,0xf2,0x0c,0x5b,0xff,0xff,0xfd,0xcf,0x77,0x9f,0x5b,0xf7,0x67,0xfd,0xcf,0xba,
-0xcf,0x5b,0xfb,0xab,0xfd,0xcf,0xaa,0xbf,0x5b,0xfa,0xaa,0xfd,0xcf,0x76,0x15,0x00,
-0x03,0x23,0x00,0x02,0xf5,0x0d,0x00,0x2d,0x02,0x10,0xfd,0x07,0x00,0x21,0xfe,0x99,
-0x07,0x00,0x21,0xfb,0x00,0x07,0x00,0x37,0xfd,0x88,0xfd,0x1c,0x00,0x70,0xfb,0x00,
-0x1e,0xef,0xfb,0xcf,0x10,0x74,0x24,0x22,0xb2,0x03,0x15,0x59,0xf4,0x02,0x20,0x03,
-0xfc,0x9d,0xf3,0x6f,0xb9,0xdf,0x20,0x03,0xf7,0x09,0xf3,0x6f,0x40,0x9f,0x20,0x18,
-0x00,0x80,0x02,0xaa,0xaa,0xe9,0x6a,0xfe,0xaa,0x10,0x4e,0x21,0x36,0x11,0xcf,0x90,
-0x7d,0x0a,0xf0,0x07,0xad,0xff,0xca,0xae,0xff,0xba,0xa2,0x00,0x7f,0xf7,0x00,0x01,
-0xcf,0xd5,0x00,0x4f,0xff,0xda,0xa3,0x5a,0xaf,0xff,0x7d,0x07,0x20,0xf5,0x8f,0x8c,
-0x13,0x60,0xed,0x07,0xf5,0x8f,0x30,0xef,0xd3,0x46,0x40,0xf5,0x8f,0xba,0xff,0x3b,
-0x01,0x43,0xe5,0x8f,0xff,0xed,0x42,0x01,0x14,0xfe,0x07,0x00,0x01,0xac,0x27,0x05,
-0x07,0x00,0x00,0xef,0x56,0x61,0x12,0xfe,0xef,0x12,0xfd,0x99,0x07,0x00,0x37,0xf9,
-0x00,0xdf,0x07,0x00,0x45,0xfe,0xaa,0xff,0x12,0x23,0x00,0x07,0x38,0x00,0x15,0x03,
-0x4d,0x00,0x00,0xfb,0x22,0x32,0xbc,0xfe,0xdf,0x0e,0x00,0x13,0xdf,0x0e,0x00,0xe0,
-0x10,0x5b,0x00,0xb6,0x01,0xfe,0xdf,0x10,0x8f,0x11,0xf9,0x01,0xfe,0xdf,0xbf,0x00,
-0x85,0xf4,0xfe,0xdf,0x28,0xcf,0x99,0xfc,0x83,0x15,0x00,0x10,0x5f,0xc4,0x1b,0xc0,
-0xfe,0xdf,0x38,0xfe,0x78,0xfc,0x73,0xfe,0xdf,0x14,0xf9,0x01,0x15,0x00,0x21,0x2f,
-0xe2,0x07,0x00,0x5c,0x16,0x30,0x00,0x64,0x01,0x54,0x00,0x0b,0x62,0x00,0x40,0x00,
-0x98,0x00,0x01,0x07,0x00,0x26,0xfd,0x00,0x4d,0x00,0xf0,0x0a,0x37,0x77,0xfe,0x77,
-0x73,0xfe,0xdf,0x12,0x44,0xfd,0x44,0x21,0xfe,0xdf,0x19,0xff,0xff,0xff,0x91,0xfe,
-0xdf,0x19,0xf3,0x11,0x5f,0x07,0x00,0xc2,0xf7,0x77,0x9f,0x91,0xfe,0xdf,0x18,0xff,
-0xff,0xff,0x81,0xfe,0xae,0x0f,0x0f,0x62,0x00,0x02,0x12,0xfc,0x0e,0x00,0x20,0xfc,
-0xdf,0x58,0x05,0x21,0x03,0xfc,0x5b,0x00,0xf0,0x02,0xa3,0xfc,0xdf,0x39,0x9b,0xfc,
-0x99,0x63,0xfc,0xdf,0x10,0x05,0xf7,0x00,0x03,0xfc,0xdf,0x8b,0x0a,0xf0,0x0a,0x23,
-0xfc,0xdf,0x18,0x8a,0xfc,0xcc,0x13,0xfc,0xdf,0x10,0x04,0xf7,0xaf,0x33,0xfc,0xdf,
-0x59,0x9b,0xfc,0xaf,0xa3,0xfc,0xdf,0x7f,0xaa,0x01,0x31,0xfc,0xdf,0x10,0x03,0x55,
-0x04,0x54,0x00,0x11,0xbb,0x54,0x00,0x23,0x00,0xff,0x49,0x3b,0x11,0xff,0xad,0x20,
-0x33,0xd0,0x00,0xfe,0x17,0x36,0x12,0xfe,0x6f,0x0d,0x0d,0x08,0x00,0x22,0xfd,0x8f,
-0xf4,0x1e,0x70,0xfc,0x6c,0xcc,0xff,0xcc,0xcc,0x30,0xef,0x54,0x01,0x5b,0x10,0x12,
-0xf9,0x08,0x00,0x23,0x08,0xf6,0xa7,0x0d,0x12,0xf2,0x08,0x00,0x21,0x3f,0xe8,0xd4,
-0x31,0x32,0xc4,0x5f,0x89,0x4f,0x3c,0x06,0x0d,0x32,0x04,0x66,0x0a,0x22,0x05,0xfc,
-0x07,0x40,0x36,0x1a,0xf8,0x11,0x3d,0x21,0x90,0xf1,0x1b,0xbb,0xef,0xdb,0xbb,0xbb,
-0xbb,0xb1,0x23,0x1e,0x22,0x08,0xc3,0x6d,0x09,0x22,0x0a,0xf4,0x13,0x1d,0x21,0x0a,
-0xf5,0x73,0x38,0x10,0xef,0xae,0x29,0xb2,0x6f,0xff,0xa0,0xab,0xbe,0xfc,0xbb,0x50,
-0x0b,0x6f,0xa0,0x20,0x00,0x1c,0x3f,0x08,0x00,0x63,0xa6,0xbb,0xbe,0xfd,0xbb,0xb0,
-0x8b,0x1c,0x15,0xf1,0xd9,0x0b,0x42,0xf1,0x00,0x07,0xe5,0xa2,0x1b,0x21,0xef,0x20,
-0x0f,0x00,0x80,0x5f,0xe6,0x66,0x65,0x00,0xbf,0x10,0x1e,0x2a,0x12,0xa0,0xdf,0xfd,
-0xaa,0xfd,0x99,0x99,0xee,0x6f,0xff,0xfe,0x5c,0x48,0x80,0xe0,0x0b,0xf1,0x0a,0x4c,
-0x70,0x00,0xed,0x2d,0x00,0xf1,0x17,0xaf,0xa0,0x0e,0xd0,0x0b,0xf1,0x00,0x00,0x9d,
-0x33,0xfc,0x00,0xbf,0x9f,0x30,0x01,0x9f,0xbf,0xb0,0x3d,0xff,0xc2,0x18,0xff,0xb4,
-0xfa,0x7f,0xfc,0x40,0x6f,0xfc,0x30,0x3f,0x92,0xd5,0x00,0x03,0xc4,0x4e,0x1d,0x00,
-0xc9,0x4d,0x02,0xf1,0x28,0x36,0x4f,0xfe,0x70,0x04,0x42,0x14,0x30,0x08,0x00,0x01,
-0xaf,0x64,0x00,0x08,0x00,0x31,0xba,0xfd,0x9f,0x08,0x00,0xf9,0x00,0x41,0xfa,0x0f,
-0xc0,0x3d,0xef,0xec,0x8f,0xee,0xff,0xef,0xc0,0x4f,0xff,0xfe,0x18,0x00,0x07,0x30,
-0x00,0x81,0x59,0x9a,0xfe,0x99,0x70,0x00,0x8f,0xcd,0xfc,0x35,0x40,0x06,0xdf,0xfd,
-0xbf,0xc0,0x01,0xa1,0x4f,0xfd,0x60,0x6a,0xab,0xff,0xaa,0xa0,0x0b,0x50,0xd8,0x24,
-0x00,0x1c,0x05,0x00,0x49,0x11,0x13,0xc6,0xfe,0x07,0x43,0xf8,0x00,0x06,0xf5,0xbc,
-0x08,0x10,0xf6,0xf0,0x06,0xf0,0x23,0xf0,0x0b,0xff,0xff,0xf8,0xaf,0xaa,0xae,0xf0,
-0x05,0x8b,0xfb,0x84,0xaf,0x10,0x0c,0xf0,0x18,0x8b,0xfb,0x88,0xaf,0x1b,0xcf,0xd0,
-0x2f,0xff,0xff,0xfe,0xaf,0x18,0xdb,0x40,0x01,0xe6,0x08,0xf2,0xaf,0x87,0x77,0x60,
-0x00,0xda,0x0e,0xb0,0xaf,0xff,0xff,0xf3,0x0c,0xed,0x5e,0xb1,0xfa,0x1d,0xf0,0x07,
-0x9c,0xfb,0x95,0xaf,0xbf,0x3f,0xb0,0x48,0x00,0x31,0x4f,0xef,0x50,0x30,0x00,0x32,
-0x1b,0xfe,0x00,0x40,0x00,0x20,0xfe,0x40,0x68,0x00,0x41,0xaf,0xcf,0xcf,0xf8,0x08,
-0x00,0x38,0xc8,0x02,0xb2,0xee,0x01,0x20,0x2a,0x30,0xad,0x03,0x40,0x40,0x03,0xef,
-0xd2,0x6b,0x06,0xf2,0x12,0x82,0x9f,0xe6,0xdf,0xa5,0x00,0x04,0x42,0xaf,0xff,0x87,
-0x7f,0xff,0xf5,0x0d,0xfa,0x5b,0x8d,0xef,0xfd,0xb7,0xa0,0x00,0xaa,0x05,0x55,0x6f,
-0xb5,0x55,0x20,0x00,0x05,0x1e,0xb1,0x28,0xf4,0x0d,0x3f,0x81,0xc7,0x2f,0x94,0xc3,
-0x00,0x01,0xde,0x2b,0xf7,0x4f,0x91,0xde,0x20,0x09,0xf4,0x6f,0x5a,0xff,0x40,0x1d,
-0x60,0x00,0x60,0x01,0x09,0xd1,0xb8,0x12,0x00,0x35,0x09,0x91,0x38,0x88,0x8e,0xf8,
-0x88,0x88,0x00,0x08,0x88,0x08,0x00,0x13,0x83,0x48,0x02,0x01,0x16,0x06,0x01,0x85,
-0x50,0x41,0x7f,0x40,0x0a,0xf4,0xc2,0x53,0x50,0x40,0x04,0xfd,0x00,0xed,0x10,0x00,
-0x91,0x8a,0xfd,0xaa,0xfd,0xa0,0x00,0x7f,0x40,0xdf,0x93,0x16,0xb1,0xef,0xea,0xdf,
-0x12,0xfb,0x1b,0xf1,0x1f,0xff,0xfb,0xdf,0x28,0x02,0x73,0x8f,0x50,0xdf,0x34,0xfb,
-0x3c,0xf1,0x20,0x00,0x00,0x08,0x00,0x90,0x56,0x66,0x66,0x66,0x60,0x00,0x7f,0x89,
-0x1f,0x78,0x02,0xf1,0x07,0x04,0xcf,0xff,0x3f,0xe8,0x88,0xaf,0x70,0x4f,0xff,0xa4,
-0x1f,0xeb,0xbb,0xcf,0x70,0x0d,0x81,0x00,0x1f,0xea,0xaa,0xe1,0x41,0x10,0x1f,0x18,
-0x00,0x03,0x90,0x09,0x14,0x70,0x4d,0x0b,0x74,0x89,0x99,0x99,0xff,0x99,0x99,0x98,
-0x82,0x06,0x04,0xea,0x43,0x02,0x0f,0x00,0x30,0x30,0x09,0x99,0x01,0x00,0x40,0x92,
-0x00,0x57,0x77,0x01,0x00,0x23,0x00,0x0b,0x25,0x00,0x60,0xbf,0x30,0x0f,0xe0,0x00,
-0xef,0x56,0x0b,0x10,0xfe,0x11,0x16,0x12,0xef,0xeb,0x00,0x91,0x2f,0xe8,0x88,0x88,
-0x88,0x8f,0xf0,0x08,0xf8,0x34,0x3a,0x13,0x04,0x08,0x4a,0x2c,0x2d,0x60,0xf5,0x3b,
-0x27,0x05,0x50,0x94,0x41,0x13,0x0d,0x43,0x16,0xf0,0x13,0x08,0x99,0x9f,0xf9,0x9f,
-0xf9,0x99,0x80,0x00,0x09,0x4d,0xf1,0x1f,0xe5,0x80,0x00,0x00,0x8f,0x7d,0xf1,0x1f,
-0xeb,0xfb,0x00,0x07,0xfc,0x0d,0xf1,0x1f,0xe0,0xaf,0xb0,0x04,0xc1,0x08,0x00,0x00,
-0xaa,0x65,0x01,0x4c,0x3a,0x02,0x1e,0x09,0x00,0x53,0x19,0xd1,0x7e,0xff,0xb7,0x78,
-0xff,0x80,0x00,0x0a,0xfd,0x7f,0xf6,0x4e,0xfa,0xe9,0x7f,0x10,0xff,0xdd,0x31,0x20,
-0x15,0x79,0x2a,0x1d,0xc1,0xa8,0x72,0x2f,0xff,0xfb,0x61,0x17,0xcf,0xff,0xf1,0x05,
-0x52,0x35,0x23,0x06,0x2c,0x53,0x22,0x1e,0x90,0x79,0x44,0x22,0x5f,0xb0,0x08,0x00,
-0x12,0xaf,0x10,0x00,0x00,0xcd,0x00,0x20,0x6c,0xf3,0xd4,0x07,0x51,0xcc,0xff,0x4c,
-0xf3,0x00,0x74,0x27,0xf0,0x15,0x1c,0xf8,0x20,0x00,0x3f,0xf1,0x03,0xfd,0x0c,0xff,
-0xe2,0x00,0x8f,0x9d,0x68,0xfa,0x0c,0xfb,0xfe,0x20,0x05,0x3e,0xff,0xf3,0x0c,0xf3,
-0x9f,0xe2,0x00,0x01,0xdf,0xc0,0x0c,0xf3,0x0a,0x80,0x2c,0x08,0x01,0x40,0x00,0x14,
-0x2e,0xac,0x43,0x11,0xc0,0x08,0x00,0x32,0x6f,0xfa,0x10,0x10,0x00,0x14,0x50,0xe9,
-0x44,0x23,0x00,0x14,0xb5,0x0b,0x33,0xdf,0xa0,0x01,0x29,0x02,0x00,0x5c,0x2c,0xd0,
-0x5c,0xfe,0xa9,0x9a,0xff,0x60,0x00,0x02,0xee,0x89,0x50,0x3d,0xf8,0x1d,0x02,0x21,
-0x1c,0xfd,0x63,0x58,0x41,0x47,0xbf,0xff,0xbe,0x6c,0x39,0x81,0xfd,0x74,0xdf,0xf9,
-0x99,0x50,0x03,0x95,0xd1,0x67,0xf0,0x01,0xe1,0x00,0x03,0x9e,0xfd,0x41,0x14,0xff,
-0x60,0x00,0x0a,0xfd,0x7a,0x90,0x4e,0xf9,0x8d,0x11,0x21,0x1b,0xfe,0x17,0x18,0x20,
-0x14,0x8d,0x76,0x28,0x60,0x0a,0xde,0xff,0xff,0xb6,0x00,0xc1,0x47,0x2a,0xc9,0x61,
-0xed,0x36,0x04,0xc1,0x4a,0x04,0xe4,0x2a,0x01,0xb6,0x4f,0x07,0xfa,0x30,0x02,0x83,
-0x0b,0x04,0x3d,0x0c,0x52,0x0e,0xee,0xee,0xff,0xff,0x57,0x29,0x23,0xcf,0xfb,0x79,
-0x2c,0x12,0xff,0x91,0x3b,0x22,0xfb,0x9f,0x9d,0x40,0x32,0xf5,0x2f,0xf5,0x85,0x3e,
-0x01,0x7d,0x3d,0x00,0xf9,0x62,0x60,0xcf,0xf5,0x00,0x08,0xff,0xe2,0x15,0x30,0x41,
-0xc2,0x0c,0xfb,0x10,0x23,0x39,0x01,0xba,0x36,0x02,0xd5,0x40,0x04,0x63,0x18,0x02,
-0x08,0x00,0x10,0x4b,0x4b,0x18,0x17,0xb9,0xd0,0x15,0x50,0x92,0x2e,0xf3,0x24,0xfd,
-0xdf,0x6a,0x31,0x0e,0xf0,0x02,0x08,0x00,0x12,0x0f,0x08,0x00,0x64,0x80,0x1f,0xf0,
-0x03,0xfd,0x00,0x40,0x03,0x80,0x1c,0xcc,0xcc,0xff,0xff,0xdc,0xcc,0xc5,0x90,0x00,
-0x22,0xef,0x60,0x89,0x30,0x21,0x3f,0xf4,0xf8,0x35,0x80,0xd1,0x07,0xff,0x81,0x00,
-0x06,0xcf,0xfc,0x18,0x2a,0x21,0xa5,0x0c,0x26,0x60,0x32,0xbf,0xf4,0x02,0xb6,0x12,
-0x62,0x50,0x00,0x09,0x71,0x1f,0xe0,0xeb,0x20,0x22,0x1f,0xe0,0x75,0x2b,0x02,0x08,
-0x00,0x12,0xdf,0x80,0x00,0x20,0x05,0xff,0xb0,0x11,0x10,0xec,0xba,0x2b,0x01,0x18,
-0x00,0x21,0x03,0x90,0x65,0x15,0x31,0x00,0x2c,0xcc,0xc4,0x57,0x16,0xc2,0x4d,0x26,
-0x10,0x23,0x0b,0x2b,0x10,0x20,0xaf,0x52,0x02,0xc0,0x2b,0x41,0x9f,0xf4,0x2f,0xf9,
-0x6d,0x38,0x80,0x60,0x04,0xff,0xd5,0x00,0x2e,0xff,0xe4,0x0c,0x00,0x21,0xf5,0x0b,
-0x05,0x34,0x26,0x7d,0xc0,0x83,0x1e,0x80,0xf4,0x01,0x23,0x57,0x98,0x00,0x07,0x37,
-0x73,0x20,0xf1,0x0e,0xdb,0x20,0x0e,0xc7,0xf4,0x79,0x4c,0x50,0x6f,0x50,0x08,0xf9,
-0xf4,0x9f,0x1e,0xb2,0xfd,0x00,0x02,0x57,0xf4,0x2d,0x37,0x76,0xf5,0x00,0x00,0x1a,
-0xf7,0x93,0x1c,0xf0,0x08,0x18,0xff,0xf6,0x7e,0xc6,0x69,0xfb,0x61,0x2f,0xa9,0xf4,
-0x0a,0xf5,0x16,0xf7,0x00,0x01,0x07,0xf4,0x06,0xb1,0xdf,0xf3,0xf3,0x4b,0xd2,0x3f,
-0xc0,0x12,0x00,0x00,0x19,0x99,0x99,0xbf,0xe9,0x99,0x99,0x91,0x98,0x00,0x00,0x87,
-0x4e,0x20,0x19,0xfe,0x48,0x36,0xf1,0x03,0x14,0x7b,0xff,0xd3,0x2e,0xfe,0xa7,0x62,
-0x2f,0xff,0xc7,0x00,0x01,0x8e,0xff,0xe1,0x04,0x30,0x00,0x03,0x00,0xea,0x04,0x24,
-0xa5,0x00,0x73,0x4b,0x00,0x0c,0x30,0x30,0xbb,0xbe,0xfd,0xd0,0x06,0x04,0xe0,0x06,
-0x41,0x01,0x12,0xdf,0x61,0x26,0x0d,0x70,0x07,0xfc,0x1a,0xaa,0xaa,0xa8,0x00,0x60,
-0x64,0x00,0x0a,0x04,0xf2,0x0c,0x03,0xef,0xb0,0x01,0x11,0x7f,0xe2,0x00,0x4f,0xff,
-0xa0,0x00,0x04,0xfd,0x10,0x00,0x5f,0xdf,0xa4,0x99,0x9c,0xfd,0x99,0x93,0x07,0x4f,
-0xa6,0x63,0x24,0x70,0x4f,0xa1,0x22,0x27,0xfa,0x22,0x20,0x8a,0x6c,0x11,0x05,0xb3,
-0x25,0x41,0xa0,0x07,0xce,0xf8,0x08,0x00,0x18,0x05,0xe1,0x0c,0x04,0x73,0x30,0x04,
-0x0b,0x41,0x83,0x0b,0xdd,0xdd,0xef,0xfe,0xdd,0xdd,0xb0,0x08,0x04,0x22,0xc0,0x0d,
-0x34,0x51,0x30,0xc0,0x0d,0xf3,0x0f,0x00,0x40,0x4f,0xc0,0x01,0x12,0x12,0x0b,0x15,
-0x11,0xbe,0x02,0x13,0x2f,0xa8,0x00,0x80,0x1c,0xcc,0xdf,0xfc,0xdf,0xfc,0xcc,0xc1,
-0x61,0x00,0x22,0x1f,0xd0,0xbe,0x48,0x40,0x1f,0xd0,0x02,0x30,0x15,0x37,0xf2,0x00,
-0x1f,0xd0,0x06,0xf5,0x19,0xdf,0xf6,0x00,0x0f,0xfc,0xbe,0xf2,0x0c,0xfb,0x30,0x23,
-0x1c,0x0e,0x80,0x00,0x21,0x2f,0xf0,0x80,0x00,0x00,0x2a,0x25,0x24,0xdd,0xc0,0x88,
-0x04,0x12,0x0d,0x38,0x1c,0x30,0xe0,0x0d,0xf5,0x78,0x00,0x40,0x6f,0xe0,0x02,0x26,
-0x17,0x00,0x72,0x72,0x20,0x00,0x01,0x10,0x0f,0xf0,0xec,0x13,0x13,0x0f,0xdd,0x51,
-0x11,0x0f,0xa5,0x2c,0x60,0x6f,0xf3,0x0f,0xfd,0xdd,0xd4,0x73,0x3e,0x02,0x2a,0x1c,
-0x40,0xfe,0xaf,0xdf,0xf0,0x07,0x04,0x20,0xf7,0x0a,0x38,0x03,0x64,0xe4,0x1c,0xa0,
-0x00,0x39,0xde,0x23,0x1b,0x03,0xc5,0x0e,0x17,0x50,0x3e,0x55,0x03,0x78,0x00,0x92,
-0xd0,0x0d,0xfa,0x99,0x9a,0xa9,0x99,0xaf,0xd0,0x67,0x11,0x32,0x2f,0xd0,0x04,0x63,
-0x44,0xf3,0x01,0x40,0x00,0x37,0x77,0x8f,0xf7,0x77,0x74,0x00,0x00,0x18,0x88,0x9f,
-0xf8,0x88,0x81,0x01,0x01,0x11,0xf3,0x82,0x00,0x17,0xd0,0x3b,0x0c,0xf0,0x0c,0x08,
-0x88,0x8b,0xff,0xff,0x98,0x88,0x80,0x00,0x00,0x5e,0xf7,0xaf,0xb2,0x00,0x00,0x03,
-0x7d,0xff,0x70,0x0b,0xff,0xa5,0x30,0x0c,0xff,0xa2,0x46,0x51,0x21,0xc0,0x02,0x75,
-0x00,0x11,0x36,0x1b,0x37,0x03,0x00,0x01,0x01,0xd0,0x38,0x14,0x0c,0x7b,0x0c,0x03,
-0x9d,0x10,0xf1,0x10,0x0c,0xf0,0x5d,0x70,0x03,0xc5,0x0e,0xf0,0x05,0x67,0xfe,0x33,
-0x44,0xef,0xa6,0x60,0x02,0xdf,0xe3,0x2e,0xf6,0x1a,0xfe,0x20,0x00,0xba,0x12,0xdf,
-0xff,0x80,0x8b,0x1b,0x44,0x30,0x1c,0xfc,0x20,0x33,0x46,0x63,0x40,0x01,0xaf,0xfa,
-0x30,0x3d,0x90,0x03,0x81,0x0b,0xab,0xfb,0x99,0x99,0xaf,0xe6,0xa0,0x5b,0x46,0x20,
-0x1f,0xd0,0x45,0x3c,0x46,0xbb,0xbb,0xbf,0xd0,0x43,0x1c,0x01,0xd8,0x25,0x13,0xdf,
-0x46,0x4f,0x60,0xdf,0x00,0x01,0x13,0xfa,0x11,0x08,0x00,0x11,0x1f,0xfa,0x11,0x10,
-0xdf,0xe0,0x44,0x12,0xcb,0x0d,0x2b,0xa0,0x0a,0xe3,0xcd,0xdd,0xff,0xd8,0x04,0xe4,
-0x0d,0xf1,0x18,0x00,0x70,0x03,0xff,0x5f,0xd0,0x8c,0x00,0xdf,0xe3,0x0d,0x51,0x70,
-0x8f,0x70,0xdf,0x00,0xdf,0x32,0x20,0xe0,0xdf,0x07,0x1d,0x40,0xa0,0x08,0xa1,0xdf,
-0x02,0x4e,0x11,0xf5,0x28,0x00,0x30,0xef,0x65,0xfa,0x08,0x00,0xa0,0x3f,0xf9,0x00,
-0x70,0x01,0xff,0xfe,0x00,0x09,0x70,0xb2,0x04,0x08,0x99,0x3e,0x0d,0x58,0x38,0x02,
-0x08,0x00,0x10,0x02,0x08,0x00,0x10,0x40,0xd0,0x48,0x30,0x0f,0xf1,0x0e,0x59,0x14,
-0x00,0xce,0x32,0x10,0xfa,0xfb,0x2f,0x10,0x0f,0x84,0x62,0x11,0x02,0xd6,0x32,0x41,
-0xbf,0x90,0x08,0xfb,0x3c,0x41,0x12,0xf0,0x66,0x32,0x40,0x0f,0xf5,0x4e,0xc0,0x08,
-0x00,0x40,0x0a,0xf9,0x01,0x20,0x08,0x00,0x17,0x05,0xb8,0x38,0x13,0xce,0x76,0x32,
-0x3b,0x7f,0xfc,0x50,0x6e,0x1f,0x18,0xc0,0x08,0x00,0x60,0x06,0x61,0x1f,0xc0,0x03,
-0x70,0x50,0x02,0x40,0x1f,0xc0,0x0c,0xf4,0xab,0x2b,0x40,0x1f,0xc0,0x03,0xfd,0x70,
-0x3c,0x71,0x1f,0xc0,0x00,0xaf,0x60,0x09,0xf9,0xa7,0x15,0x30,0xe0,0x0d,0xe1,0x08,
-0x00,0x92,0x09,0xe3,0x00,0x30,0x00,0x1f,0xc0,0x06,0x72,0x40,0x00,0x23,0x4f,0xf3,
-0xd1,0x39,0x11,0x40,0x66,0x50,0x00,0x62,0x1c,0x61,0x01,0x35,0x7c,0xff,0xfa,0x10,
-0x34,0x31,0x20,0xd8,0x30,0xd8,0x02,0x12,0xb8,0x59,0x4f,0x05,0xeb,0x0f,0x10,0x00,
-0x9b,0x70,0x02,0xaf,0x60,0x02,0x25,0x12,0x20,0xdf,0xfe,0x58,0x0b,0x06,0xf9,0x07,
-0x04,0x4f,0x1d,0x23,0xdf,0x30,0xfc,0x0e,0x00,0x01,0x03,0x42,0x80,0x00,0x09,0xfc,
-0xe3,0x20,0x22,0x1e,0xe1,0xad,0x57,0x21,0x9f,0x70,0x08,0x00,0x31,0x04,0xfe,0x10,
-0x08,0x00,0x22,0x3f,0xf3,0x8e,0x0e,0x30,0x4f,0x60,0xdd,0x40,0x10,0x33,0xd4,0x03,
-0x00,0xd5,0x5b,0x51,0x00,0x34,0x00,0x00,0x45,0x97,0x0d,0x10,0x10,0x64,0x42,0x93,
-0x03,0x88,0xdf,0xb8,0x8b,0xfe,0x88,0x40,0x06,0xce,0x34,0xa3,0x01,0x33,0x33,0x7f,
-0xc3,0x33,0x33,0x10,0x00,0x9f,0xa3,0x20,0x30,0x6a,0xaa,0xff,0xb3,0x20,0x40,0x09,
-0x99,0x9b,0xfe,0xf3,0x24,0x04,0x90,0x04,0x40,0x02,0x23,0xcf,0xb2,0xa5,0x2c,0x02,
-0xae,0x2b,0x00,0x80,0x19,0x60,0xfa,0xcc,0xef,0xec,0xcb,0x00,0x83,0x20,0x00,0xb2,
-0x00,0xa2,0x1d,0xeb,0xcc,0xcc,0xef,0xec,0xcc,0xc2,0x02,0x19,0x00,0x05,0xf2,0x07,
-0x02,0x96,0x00,0xfe,0x00,0x98,0x20,0x03,0xff,0x10,0xfe,0x04,0xfe,0x20,0x79,0xee,
-0x99,0xff,0x9b,0xfc,0x96,0xdf,0x14,0x1c,0x10,0xdf,0x35,0x25,0x40,0x35,0xfb,0xdf,
-0x4f,0x42,0x03,0x90,0xfb,0x67,0x4f,0xb6,0x66,0x6e,0xf2,0x75,0x00,0x07,0x00,0x80,
-0xf1,0x00,0x00,0x3e,0xee,0xff,0xfe,0xe1,0x23,0x12,0x52,0xef,0x21,0x11,0x10,0x0c,
-0x8d,0x04,0xd1,0x0c,0xfa,0x99,0xff,0xa9,0xaf,0xc0,0x0c,0xf2,0x00,0xef,0x10,0x2f,
-0x07,0x00,0xb2,0x2e,0xff,0xb0,0x07,0x91,0x00,0xef,0x19,0xb9,0x20,0x03,0xac,0x0f,
-0x02,0xc1,0x32,0x00,0x51,0x09,0x60,0x12,0x41,0x1d,0xf3,0x13,0x52,0xfd,0x02,0x40,
-0x0d,0xf1,0x08,0xfa,0x10,0x57,0x40,0x0d,0xf1,0x0d,0xf2,0x12,0x50,0x20,0x0d,0xf1,
-0x67,0x58,0x82,0x01,0x61,0x0d,0xf1,0x15,0x10,0x00,0x1e,0xc7,0x35,0x17,0xe6,0x09,
-0x0a,0x05,0xa6,0x14,0x1f,0xf1,0x08,0x00,0x0b,0x37,0x01,0x54,0x00,0x32,0x49,0x04,
-0x40,0x00,0x11,0xff,0x56,0x2d,0x60,0xb4,0x00,0xfd,0x00,0xbf,0x10,0xd3,0x09,0x22,
-0xfd,0xcf,0x22,0x04,0x70,0xfd,0x68,0xdf,0x88,0x8f,0xf8,0x82,0x18,0x00,0x60,0x87,
-0x7f,0xe0,0x00,0x01,0xfc,0x1a,0x1e,0x40,0xd0,0x00,0x02,0xfb,0xcd,0x09,0x51,0x75,
-0x00,0x04,0xf9,0xbf,0x2c,0x10,0x70,0x07,0xf7,0x05,0xfd,0x40,0x5e,0xf6,0x00,0x2a,
-0x20,0x5f,0xfc,0xaa,0x6c,0xf1,0x00,0xf3,0x8a,0xdf,0xff,0xff,0xca,0x83,0x2d,0x91,
-0xff,0xd9,0x53,0x7c,0xff,0xf1,0x48,0x24,0x03,0x4b,0x5e,0x14,0x58,0x54,0x11,0x24,
-0x50,0x00,0x1e,0x15,0x31,0xfb,0x01,0xfe,0x80,0x00,0xf1,0x25,0xb8,0x01,0xfb,0x02,
+0x0e,0xd0,0x02,0xdf,0x73,0xe3,0x8f,0x80,0x0f,0xb0,0x3f,0xf8,0x00,0x16,0xfe,0x3b,
+0xdf,0x80,0x09,0x50,0x00,0x03,0xe3,0x0e,0xfc,0x10,0x77,0x02,0x60,0x13,0x58,0xcf,
+0x10,0xbf,0x20,0xea,0x01,0x90,0xfd,0x50,0xbf,0x20,0x00,0x04,0x54,0xfc,0x00,0x30,
+0x03,0x00,0x02,0x01,0xf0,0x0e,0xc0,0xbf,0x10,0x00,0x18,0x88,0xfd,0x88,0xaf,0xff,
+0xff,0xf5,0x09,0xdd,0xff,0xdd,0xac,0xff,0xce,0xf5,0x0b,0xd5,0xfd,0x6f,0x80,0xdf,
+0x08,0xf4,0x0b,0xa8,0x00,0xb0,0xfe,0x08,0xf4,0x0b,0xd4,0xfc,0x4f,0x81,0xfc,0x09,
+0xf3,0x10,0x00,0xc0,0x83,0xf9,0x09,0xf3,0x04,0x55,0xfd,0x55,0x38,0xf5,0x0a,0xf2,
+0x94,0x03,0xd0,0xae,0xf1,0x0c,0xf1,0x01,0x23,0xfd,0x68,0xbf,0x80,0x0e,0xf0,0x2f,
+0xe9,0x06,0xb6,0x2c,0xdf,0xc0,0x06,0x54,0x20,0x02,0xd2,0x0d,0xfd,0x30,0x81,0x00,
+0x14,0x10,0x80,0x04,0x30,0x40,0xff,0x10,0xe3,0x05,0x21,0xfe,0x00,0x08,0x00,0xf0,
+0x09,0x0d,0xf7,0x00,0xff,0x10,0x1d,0x40,0x00,0x7f,0xf0,0x00,0xff,0x10,0xbf,0xd0,
+0x03,0xff,0xe0,0x00,0xff,0x18,0xff,0x30,0x2e,0x08,0x00,0xf0,0x02,0x8f,0xf5,0x00,
+0x2f,0xef,0xe0,0x00,0xff,0xff,0x70,0x00,0x07,0x4f,0xe0,0x00,0xff,0xf6,0x6d,0x0a,
+0x21,0xe0,0x4d,0x9f,0x0a,0xf0,0x08,0x1f,0xfa,0xff,0xff,0x10,0x01,0x00,0x00,0x1f,
+0xe8,0xf8,0xff,0x10,0x09,0xb2,0x00,0x1f,0xe0,0x10,0xff,0x10,0x0a,0xf3,0x3a,0x05,
+0x31,0xff,0x20,0x0d,0x76,0x06,0x40,0xcf,0xfe,0xef,0xd0,0x08,0x00,0x81,0x4d,0xff,
+0xfd,0x30,0x00,0x02,0x00,0x04,0x94,0x01,0x61,0x7f,0x80,0xaf,0x70,0x05,0xfd,0x6e,
+0x0b,0xd2,0xf1,0x0d,0xf4,0x00,0x00,0x7d,0xf9,0x9e,0xd9,0xbf,0xe9,0x00,0x00,0x83,
+0x08,0x87,0x00,0x00,0xcf,0x32,0x2f,0xf2,0x22,0xff,0x10,0x00,0x40,0x54,0x5f,0xf4,
+0x45,0x08,0x00,0x44,0x99,0x9f,0xf9,0x99,0x18,0x00,0x01,0x8e,0x07,0x01,0x75,0x0c,
+0x13,0x2f,0x40,0x04,0x84,0x2c,0xcc,0xcc,0xcf,0xfc,0xcc,0xcc,0xc2,0x18,0x00,0x07,
+0x08,0x00,0x28,0x0d,0xf2,0x08,0x00,0x40,0x12,0x22,0x2e,0xf4,0xe6,0x0b,0x02,0x79,
+0x07,0x98,0x40,0x00,0xac,0xcc,0xcf,0xfd,0xcc,0xcc,0x30,0x28,0x00,0x16,0xf3,0xe6,
+0x0b,0x40,0xf7,0x1d,0xdd,0xdf,0x64,0x07,0x71,0xd6,0x00,0x00,0x1e,0xf5,0x00,0x46,
+0x06,0x0a,0x30,0x90,0x01,0xff,0xcc,0x04,0xf2,0x00,0xfc,0x00,0x00,0x5f,0xe1,0x00,
+0x00,0x4f,0xf6,0x45,0x67,0x8e,0xfb,0x00,0x01,0x30,0x00,0xf0,0x02,0x50,0x00,0xce,
+0xca,0x98,0x65,0x43,0x7f,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x14,0x00,
+0x01,0x00,0x90,0x01,0x23,0x45,0x68,0x9c,0xe8,0x00,0x0a,0xff,0x01,0x00,0xf1,0x0d,
+0xca,0x10,0x05,0xad,0xb7,0x7d,0xa2,0x13,0x94,0x00,0x00,0x4f,0xa0,0x0f,0xd0,0x0a,
+0xf7,0x00,0x00,0x0d,0xe0,0x0c,0xe1,0x0f,0xe0,0x00,0x0e,0xff,0x01,0x00,0xb0,0xf0,
+0x0f,0xfa,0xaa,0xaa,0xaa,0xaa,0xaf,0xf0,0x0f,0xc0,0x3c,0x00,0x40,0x0d,0xf0,0x07,
+0x6a,0x17,0x00,0xf0,0x01,0xa6,0x70,0x00,0x08,0xfe,0xaa,0xab,0xff,0x80,0x00,0x00,
+0x01,0xcf,0x90,0x0b,0xfd,0x59,0x00,0x40,0x0c,0xfc,0xdf,0xd1,0x08,0x00,0xf0,0x09,
+0x17,0xff,0xff,0x83,0x00,0x00,0x18,0xad,0xff,0xfb,0xbf,0xff,0xec,0xa1,0x0a,0xff,
+0xb7,0x10,0x02,0x7b,0xef,0x90,0x01,0x20,0x1c,0x00,0x10,0x02,0x05,0x00,0x12,0x74,
+0x89,0x00,0x22,0x02,0xff,0x08,0x00,0x20,0x06,0xfa,0x06,0x00,0x92,0x0d,0xdd,0xde,
+0xfe,0xdd,0xdd,0xdd,0xd1,0x0f,0x78,0x00,0x52,0xf1,0x00,0x00,0x7f,0xa0,0x20,0x00,
+0x21,0xef,0x30,0x07,0x00,0x91,0x08,0xfe,0x32,0x22,0x22,0x22,0x00,0x00,0x2f,0x20,
+0x00,0xf1,0x05,0x00,0x01,0xdf,0xff,0xaa,0xaa,0xaa,0xff,0x00,0x2d,0xfc,0xef,0x00,
+0x00,0x00,0xff,0x00,0x4f,0xb0,0xdf,0x08,0x00,0x60,0x04,0x00,0xdf,0x11,0x11,0x11,
+0x5b,0x00,0x10,0xdf,0x28,0x00,0x00,0x08,0x00,0x70,0xcb,0xbb,0xbc,0xee,0x00,0x00,
+0x3f,0x0f,0x00,0x80,0xf3,0x00,0x00,0x3f,0xea,0xaa,0xaa,0xae,0x08,0x00,0x56,0xa0,
+0x00,0x00,0x0c,0xf3,0x18,0x00,0x65,0x2b,0xbb,0xbb,0xbb,0xbb,0xb2,0x27,0x01,0x13,
+0x1f,0x00,0x01,0x30,0x1a,0xab,0xff,0x01,0x01,0x42,0xa0,0x00,0x06,0xfc,0x19,0x00,
+0x13,0x0b,0x30,0x00,0x11,0x0a,0x17,0x01,0x02,0x14,0x00,0x21,0x4f,0xd0,0x1a,0x00,
+0x32,0xbb,0xef,0x80,0x22,0x00,0x28,0xfa,0x00,0x01,0x00,0x22,0x04,0x91,0x08,0x00,
+0x21,0x2f,0xf6,0x07,0x00,0x31,0x03,0xef,0xfe,0xd2,0x00,0xf0,0x15,0x6f,0xf8,0x7f,
+0xf7,0x00,0x00,0x00,0x3c,0xff,0x70,0x05,0xff,0xd6,0x00,0x2b,0xff,0xfe,0xaa,0xaa,
+0xdf,0xff,0xe2,0x1d,0xfa,0xff,0xff,0xff,0xfd,0x6e,0x90,0x03,0x30,0x11,0x11,0x11,
+0x11,0x74,0x01,0x00,0x08,0x00,0x43,0x10,0x00,0x00,0x0f,0x17,0x01,0x50,0x0f,0xf9,
+0x99,0x99,0x9f,0x08,0x00,0x40,0xe0,0x00,0x00,0x0e,0x08,0x00,0x13,0xf0,0x08,0x00,
+0x04,0x20,0x00,0x71,0xfb,0xbb,0xbb,0xbe,0xe1,0x00,0xcf,0xbf,0x00,0xa0,0xfc,0xcf,
+0xdc,0xcc,0xcc,0xcc,0xcd,0xfc,0xcf,0x10,0x4a,0x00,0xe5,0xfc,0xcf,0x1d,0xff,0xff,
+0xff,0xd1,0xfc,0xcf,0x19,0xaa,0xaa,0xaa,0x91,0x15,0x00,0xb0,0x11,0xff,0xff,0xff,
+0x11,0xfc,0xcf,0x11,0xfd,0x88,0xdf,0x07,0x00,0x30,0xfa,0x00,0xaf,0x07,0x00,0x48,
+0xfb,0x00,0xbf,0x11,0x1c,0x00,0xa0,0x88,0x01,0xfc,0xcf,0x10,0x53,0x00,0x07,0xde,
+0xfa,0x38,0x00,0x36,0x03,0xff,0xc2,0xe1,0x00,0x20,0x85,0x10,0x06,0x00,0x21,0x0a,
+0xfd,0x0d,0x00,0xf0,0x09,0xaf,0xff,0xff,0xff,0xf7,0x00,0x3d,0xfe,0xbb,0xbb,0xcf,
+0xf4,0x0a,0xff,0xb1,0x00,0x00,0xbf,0x90,0x04,0xe5,0x7e,0x40,0x1b,0x1e,0x00,0x40,
+0x7f,0xf9,0xef,0xb1,0xcb,0x01,0xc1,0xff,0xf8,0x00,0x00,0x00,0x27,0xdf,0xff,0xfc,
+0xcc,0xcb,0x2e,0xa8,0x00,0xaa,0xfe,0x0c,0xd9,0xfd,0x00,0x00,0x01,0xfe,0x00,0x01,
+0x07,0x00,0x00,0x1c,0x00,0x00,0x07,0x00,0x91,0xaa,0xaa,0xab,0xfe,0x00,0x00,0x03,
+0x63,0x00,0x69,0x00,0x11,0xf9,0x07,0x00,0xc2,0x0f,0xf2,0x00,0x00,0x00,0xbd,0xdd,
+0xef,0xfd,0xdd,0xdd,0xd2,0xee,0x00,0x11,0xf3,0xd2,0x00,0x90,0x0b,0xf3,0xcf,0x11,
+0x99,0x99,0x98,0x0b,0xf3,0xbd,0x00,0x10,0xfe,0x07,0x00,0x37,0xf9,0x00,0xde,0x07,
+0x00,0x39,0xfd,0xaa,0xfe,0x1c,0x00,0x21,0x00,0x0b,0x38,0x00,0x30,0x1d,0xdf,0xf1,
+0x07,0x00,0x33,0x0c,0xfe,0x80,0xd6,0x00,0x13,0x0f,0x02,0x02,0xd1,0x0c,0xcc,0xcc,
+0xcf,0xff,0xcc,0xcc,0xc0,0x00,0x00,0x01,0xaf,0xf4,0x1a,0x00,0xf0,0x09,0x4e,0xff,
+0xe1,0xda,0x20,0x00,0x00,0x5c,0xff,0xcf,0xe3,0xcf,0xfa,0x20,0x4e,0xff,0xe5,0x0f,
+0xe0,0x05,0xdf,0xf3,0x0c,0xd6,0x94,0x01,0x10,0x08,0xb6,0x02,0x20,0x05,0x50,0x27,
+0x00,0x21,0x5f,0xff,0x0b,0x01,0x60,0x00,0x5f,0xeb,0xbb,0xbb,0xbe,0x08,0x00,0x48,
+0x90,0x00,0x00,0x09,0x08,0x00,0x04,0x20,0x00,0x51,0xea,0xaa,0xaa,0xad,0xf7,0x13,
+0x03,0x13,0x81,0xa4,0x03,0x21,0xef,0xc0,0x08,0x00,0x40,0x05,0xef,0xef,0x90,0x08,
+0x00,0xf1,0x12,0x3b,0xff,0x70,0x9f,0xe6,0x10,0x00,0x06,0xcf,0xfe,0x5c,0xc1,0x5f,
+0xff,0xb5,0x01,0xef,0xe7,0x00,0x9f,0xc0,0x18,0xef,0xa0,0x03,0x57,0x99,0x99,0xeb,
+0x99,0x71,0x60,0x00,0xef,0x01,0x22,0xfe,0x10,0x60,0x02,0x22,0xff,0x40,0x45,0x00,
+0x33,0xcf,0x90,0x00,0xdf,0x02,0xf0,0x02,0xfc,0x00,0x00,0x03,0xfd,0x99,0x99,0x99,
+0xaf,0xc0,0x00,0x00,0x3f,0xb0,0x00,0x00,0x03,0x11,0x00,0x01,0xde,0x00,0x12,0xc0,
+0x11,0x03,0x10,0xab,0xdd,0x02,0x41,0x09,0xa3,0x09,0xf6,0xfb,0x02,0x12,0xf2,0x08,
+0x00,0x82,0x7f,0xfa,0xae,0xfd,0xaa,0xaa,0x00,0x02,0x08,0x01,0x60,0x10,0x0d,0xf9,
+0x00,0x0a,0xf6,0xcf,0x02,0x4a,0xc0,0x00,0x09,0xf6,0x20,0x01,0x00,0x01,0x00,0x15,
+0xc0,0x0f,0x02,0x00,0x73,0x00,0x00,0xe2,0x01,0x10,0x3f,0xf8,0x00,0x12,0xf8,0x72,
+0x00,0x10,0x08,0x08,0x00,0x13,0xc0,0x08,0x00,0x07,0x20,0x00,0x51,0xbd,0xf8,0x00,
+0x00,0xef,0x48,0x00,0xf5,0x51,0x20,0x0e,0xfb,0xbb,0xbb,0xbb,0xbe,0xf2,0x00,0xef,
+0x00,0x0b,0xa0,0x00,0xbf,0x20,0x0e,0xf3,0xff,0xff,0xff,0x4b,0xf2,0x00,0xef,0x17,
+0x7f,0xe7,0x72,0xbf,0x20,0x0f,0xf3,0x66,0xfe,0x66,0x4b,0xf2,0x00,0xfe,0x8f,0xff,
+0xff,0xf9,0xbf,0x20,0x1f,0xe0,0x11,0x11,0x11,0x1b,0xf2,0x02,0xfc,0x0e,0xff,0xff,
+0xf0,0xbf,0x20,0x3f,0xa0,0xfd,0x77,0xdf,0x0b,0xf2,0x07,0xf7,0x0f,0xb0,0x0a,0xf0,
+0xbf,0x20,0xcf,0x20,0xff,0xff,0xff,0x0b,0xf2,0x3f,0xc0,0x0f,0xd7,0x77,0xfc,0xff,
+0x12,0xc4,0x00,0x32,0x00,0x0a,0xd8,0x01,0x00,0x2c,0x01,0xf2,0x0c,0x5b,0xff,0xff,
+0xfd,0xcf,0x77,0x9f,0x5b,0xf7,0x67,0xfd,0xcf,0xba,0xcf,0x5b,0xfb,0xab,0xfd,0xcf,
+0xaa,0xbf,0x5b,0xfa,0xaa,0xfd,0xcf,0x76,0x15,0x00,0x03,0x23,0x00,0x01,0x22,0x03,
+0x10,0xfd,0x2d,0x02,0x10,0xfd,0x07,0x00,0x21,0xfe,0x99,0x07,0x00,0x21,0xfb,0x00,
+0x07,0x00,0x37,0xfd,0x88,0xfd,0x1c,0x00,0x50,0xfb,0x00,0x1e,0xef,0xfb,0x31,0x00,
+0xf4,0x0c,0x09,0xfe,0xb2,0x03,0xff,0xff,0xf3,0x6f,0xff,0xff,0x20,0x03,0xfc,0x9d,
+0xf3,0x6f,0xb9,0xdf,0x20,0x03,0xf7,0x09,0xf3,0x6f,0x40,0x9f,0x20,0x18,0x00,0xf1,
+0x00,0x02,0xaa,0xaa,0xe9,0x6a,0xfe,0xaa,0x10,0x00,0x00,0x02,0xfe,0x11,0xcf,0x90,
+0x12,0x01,0x00,0xc0,0x02,0xf0,0x20,0x2a,0xad,0xff,0xca,0xae,0xff,0xba,0xa2,0x00,
+0x7f,0xf7,0x00,0x01,0xcf,0xd5,0x00,0x4f,0xff,0xda,0xa3,0x5a,0xaf,0xff,0xf4,0x0b,
+0xff,0xff,0xf5,0x8f,0xff,0xff,0xa0,0x00,0xed,0x07,0xf5,0x8f,0x30,0xef,0x00,0x00,
+0xef,0xac,0xf5,0x8f,0xba,0xff,0x3b,0x01,0x43,0xe5,0x8f,0xff,0xed,0x42,0x01,0x14,
+0xfe,0x07,0x00,0x10,0x10,0x4b,0x02,0x05,0x07,0x00,0xa1,0x12,0xff,0xff,0xff,0x12,
+0xfe,0xef,0x12,0xfd,0x99,0x07,0x00,0x37,0xf9,0x00,0xdf,0x07,0x00,0x45,0xfe,0xaa,
+0xff,0x12,0x23,0x00,0x07,0x38,0x00,0x15,0x03,0x4d,0x00,0x72,0xcb,0xbb,0xbb,0xbb,
+0xbc,0xfe,0xdf,0x0e,0x00,0x13,0xdf,0x0e,0x00,0xe0,0x10,0x5b,0x00,0xb6,0x01,0xfe,
+0xdf,0x10,0x8f,0x11,0xf9,0x01,0xfe,0xdf,0xbf,0x00,0x85,0xf4,0xfe,0xdf,0x28,0xcf,
+0x99,0xfc,0x83,0x15,0x00,0x00,0xde,0x02,0xd0,0xf5,0xfe,0xdf,0x38,0xfe,0x78,0xfc,
+0x73,0xfe,0xdf,0x14,0xf9,0x01,0x15,0x00,0x21,0x2f,0xe2,0x07,0x00,0x5c,0x16,0x30,
+0x00,0x64,0x01,0x54,0x00,0x0b,0x62,0x00,0x40,0x00,0x98,0x00,0x01,0x07,0x00,0x26,
+0xfd,0x00,0x4d,0x00,0xf0,0x0a,0x37,0x77,0xfe,0x77,0x73,0xfe,0xdf,0x12,0x44,0xfd,
+0x44,0x21,0xfe,0xdf,0x19,0xff,0xff,0xff,0x91,0xfe,0xdf,0x19,0xf3,0x11,0x5f,0x07,
+0x00,0xd1,0xf7,0x77,0x9f,0x91,0xfe,0xdf,0x18,0xff,0xff,0xff,0x81,0xfe,0xdf,0xb9,
+0x01,0x0f,0x62,0x00,0x02,0x12,0xfc,0x0e,0x00,0x20,0xfc,0xdf,0x58,0x05,0x21,0x03,
+0xfc,0x5b,0x00,0xf0,0x1f,0xa3,0xfc,0xdf,0x39,0x9b,0xfc,0x99,0x63,0xfc,0xdf,0x10,
+0x05,0xf7,0x00,0x03,0xfc,0xdf,0x1e,0xff,0xff,0xff,0x23,0xfc,0xdf,0x18,0x8a,0xfc,
+0xcc,0x13,0xfc,0xdf,0x10,0x04,0xf7,0xaf,0x33,0xfc,0xdf,0x59,0x9b,0xfc,0xaf,0xa3,
+0xfc,0xdf,0x7f,0xaa,0x01,0x11,0xfc,0x62,0x00,0x24,0x04,0xfc,0x54,0x00,0x11,0xbb,
+0x54,0x00,0x13,0x00,0x13,0x03,0x30,0x00,0xff,0xdd,0x01,0x00,0x90,0xd0,0x00,0xfe,
+0x00,0x00,0x23,0x00,0x00,0x00,0x08,0x00,0x01,0x31,0x00,0x0c,0x08,0x00,0x20,0xfd,
+0x8f,0x30,0x00,0xb2,0x40,0x01,0xfc,0x6c,0xcc,0xff,0xcc,0xcc,0x30,0x03,0xfb,0x18,
+0x00,0x22,0x05,0xf9,0x08,0x00,0x22,0x08,0xf6,0x08,0x00,0x22,0x0c,0xf2,0x08,0x00,
+0xa1,0x3f,0xe8,0xcc,0xcc,0xff,0xdc,0xcc,0xc4,0x5f,0x89,0x68,0x00,0x35,0xf5,0x01,
+0x10,0x75,0x03,0x22,0x30,0x00,0x32,0x04,0x21,0xfc,0x00,0x34,0x06,0x20,0x1a,0xf8,
+0x36,0x06,0x13,0x1f,0x4d,0x07,0xe0,0x1b,0xbb,0xef,0xdb,0xbb,0xbb,0xbb,0xb1,0x00,
+0x02,0xff,0x10,0x08,0xc3,0x6e,0x07,0x40,0xf7,0x00,0x0a,0xf4,0xad,0x05,0x40,0xd0,
+0x00,0x0a,0xf5,0xb2,0x06,0x10,0xa0,0xef,0x01,0xc2,0x70,0x6f,0xff,0xa0,0xab,0xbe,
+0xfc,0xbb,0x50,0x0b,0x6f,0xa0,0x20,0x00,0x1c,0x3f,0x08,0x00,0x93,0xa6,0xbb,0xbe,
+0xfd,0xbb,0xb0,0x00,0x3f,0xa8,0x6e,0x06,0x03,0x14,0x07,0xc1,0xf1,0x00,0x07,0xe5,
+0x00,0x00,0x00,0xbf,0x10,0x00,0xef,0x20,0x0f,0x00,0x70,0x5f,0xe6,0x66,0x65,0x00,
+0xbf,0x10,0x48,0x01,0xf0,0x08,0xf6,0xdf,0xfd,0xaa,0xfd,0x99,0x99,0xee,0x6f,0xff,
+0xfe,0xfe,0x10,0x00,0x0d,0xe0,0x0b,0xf1,0x0a,0x4c,0x70,0x00,0xed,0x2d,0x00,0xf1,
+0x19,0xaf,0xa0,0x0e,0xd0,0x0b,0xf1,0x00,0x00,0x9d,0x33,0xfc,0x00,0xbf,0x9f,0x30,
+0x01,0x9f,0xbf,0xb0,0x3d,0xff,0xc2,0x18,0xff,0xb4,0xfa,0x7f,0xfc,0x40,0x6f,0xfc,
+0x30,0x3f,0x92,0xd5,0x00,0x03,0xc4,0x00,0x06,0x1d,0x05,0x41,0x07,0xcc,0xff,0x30,
+0x6d,0x07,0x25,0xfe,0x70,0xf6,0x00,0x24,0x8f,0x30,0x08,0x00,0x10,0x8f,0xcd,0x04,
+0x00,0x08,0x00,0x31,0xba,0xfd,0x9f,0x08,0x00,0xf9,0x00,0x41,0xfa,0x0f,0xc0,0x3d,
+0xef,0xec,0x8f,0xee,0xff,0xef,0xc0,0x4f,0xff,0xfe,0x18,0x00,0x07,0x30,0x00,0xf0,
+0x02,0x59,0x9a,0xfe,0x99,0x70,0x00,0x8f,0xcd,0x00,0x04,0xfd,0x00,0x00,0x06,0xdf,
+0xfd,0xbf,0xc0,0x01,0xa0,0x4f,0xfd,0x60,0x6a,0xab,0xff,0xaa,0xa0,0x0b,0x50,0x39,
+0x05,0x10,0x00,0x1c,0x05,0x53,0xcc,0xcd,0xff,0xcc,0xc6,0xfe,0x07,0x43,0xf8,0x00,
+0x06,0xf5,0xbc,0x08,0x10,0xf6,0xf0,0x06,0xf1,0x32,0xf0,0x0b,0xff,0xff,0xf8,0xaf,
+0xaa,0xae,0xf0,0x05,0x8b,0xfb,0x84,0xaf,0x10,0x0c,0xf0,0x18,0x8b,0xfb,0x88,0xaf,
+0x1b,0xcf,0xd0,0x2f,0xff,0xff,0xfe,0xaf,0x18,0xdb,0x40,0x01,0xe6,0x08,0xf2,0xaf,
+0x87,0x77,0x60,0x00,0xda,0x0e,0xb0,0xaf,0xff,0xff,0xf3,0x0c,0xff,0xff,0xf9,0xaf,
+0xfa,0x1d,0xf0,0x07,0x9c,0xfb,0x95,0xaf,0xbf,0x3f,0xb0,0x48,0x00,0x31,0x4f,0xef,
+0x50,0x30,0x00,0x32,0x1b,0xfe,0x00,0x40,0x00,0x20,0xfe,0x40,0x68,0x00,0x41,0xaf,
+0xcf,0xcf,0xf8,0x08,0x00,0x38,0xc8,0x02,0xb2,0xee,0x01,0x20,0x2a,0x30,0xad,0x03,
+0x40,0x40,0x03,0xef,0xd2,0x6b,0x06,0xf0,0x12,0x82,0x9f,0xe6,0xdf,0xa5,0x00,0x04,
+0x42,0xaf,0xff,0x87,0x7f,0xff,0xf5,0x0d,0xfa,0x5b,0x8d,0xef,0xfd,0xb7,0xa0,0x00,
+0xaa,0x05,0x55,0x6f,0xb5,0x55,0x20,0x00,0x05,0x1e,0xb8,0x00,0xf1,0x0f,0x60,0x00,
+0x3f,0x81,0xc7,0x2f,0x94,0xc3,0x00,0x01,0xde,0x2b,0xf7,0x4f,0x91,0xde,0x20,0x09,
+0xf4,0x6f,0x5a,0xff,0x40,0x1d,0x60,0x00,0x60,0x01,0x09,0xd1,0x94,0x08,0x12,0xff,
+0x35,0x09,0x91,0x38,0x88,0x8e,0xf8,0x88,0x88,0x00,0x08,0x88,0x08,0x00,0x13,0x83,
+0x48,0x02,0x01,0x16,0x06,0xf0,0x04,0x20,0x00,0x10,0x00,0x00,0x7f,0x40,0x0a,0xf4,
+0x00,0x9f,0x30,0x00,0x7f,0x40,0x04,0xfd,0x00,0xed,0x10,0x00,0x90,0x8a,0xfd,0xaa,
+0xfd,0xa0,0x00,0x7f,0x40,0xdf,0x18,0x02,0xc1,0x1d,0xef,0xea,0xdf,0x12,0xfb,0x1b,
+0xf1,0x1f,0xff,0xfb,0xdf,0x28,0x02,0x73,0x8f,0x50,0xdf,0x34,0xfb,0x3c,0xf1,0x20,
+0x00,0x00,0x08,0x00,0x90,0x56,0x66,0x66,0x66,0x60,0x00,0x7f,0x89,0x1f,0x78,0x02,
+0xf0,0x09,0x04,0xcf,0xff,0x3f,0xe8,0x88,0xaf,0x70,0x4f,0xff,0xa4,0x1f,0xeb,0xbb,
+0xcf,0x70,0x0d,0x81,0x00,0x1f,0xea,0xaa,0xcf,0x70,0x8d,0x06,0x00,0x18,0x00,0x03,
+0x90,0x09,0x22,0x70,0x00,0xf7,0x08,0x84,0x00,0x89,0x99,0x99,0xff,0x99,0x99,0x98,
+0x82,0x06,0x02,0x51,0x03,0x13,0x00,0x7e,0x03,0x30,0x30,0x09,0x99,0x01,0x00,0x40,
+0x92,0x00,0x57,0x77,0x01,0x00,0x23,0x00,0x0b,0x25,0x00,0xe3,0xbf,0x30,0x0f,0xe0,
+0x00,0xef,0x00,0x0d,0xf3,0x00,0xfe,0x00,0x0e,0xf0,0x34,0x05,0xa0,0x00,0x2f,0xe8,
+0x88,0x88,0x88,0x8f,0xf0,0x08,0xf8,0x41,0x00,0x41,0x22,0x04,0xff,0x20,0x60,0x01,
+0x22,0x2d,0x60,0x68,0x01,0x06,0x60,0x03,0x23,0x05,0x50,0xc5,0x09,0x10,0xf2,0x3f,
+0x03,0x02,0x6a,0x00,0xf0,0x14,0xe0,0x08,0x99,0x9f,0xf9,0x9f,0xf9,0x99,0x80,0x00,
+0x09,0x4d,0xf1,0x1f,0xe5,0x80,0x00,0x00,0x8f,0x7d,0xf1,0x1f,0xeb,0xfb,0x00,0x07,
+0xfc,0x0d,0xf1,0x1f,0xe0,0xaf,0xb0,0x04,0xc1,0x08,0x00,0x75,0x0a,0x30,0x00,0x00,
+0x08,0xfa,0x00,0x1e,0x09,0xf0,0x00,0xa0,0x00,0x00,0x7e,0xff,0xb7,0x78,0xff,0x80,
+0x00,0x0a,0xfd,0x7f,0xf6,0x4e,0x1a,0x00,0xf0,0x0a,0x60,0x04,0xff,0xff,0x90,0x00,
+0x00,0x15,0x79,0xcf,0xff,0xff,0xfd,0xa8,0x72,0x2f,0xff,0xfb,0x61,0x17,0xcf,0xff,
+0xf1,0x05,0x52,0x34,0x00,0x25,0x24,0x40,0x86,0x00,0x21,0x1e,0x90,0xb4,0x0a,0x32,
+0x00,0x5f,0xb0,0x08,0x00,0x12,0xaf,0x10,0x00,0x00,0xcd,0x00,0x20,0x6c,0xf3,0xd4,
+0x07,0x30,0xcc,0xff,0x4c,0x9c,0x0a,0xf0,0x18,0xf8,0x00,0xef,0x1c,0xf8,0x20,0x00,
+0x3f,0xf1,0x03,0xfd,0x0c,0xff,0xe2,0x00,0x8f,0x9d,0x68,0xfa,0x0c,0xfb,0xfe,0x20,
+0x05,0x3e,0xff,0xf3,0x0c,0xf3,0x9f,0xe2,0x00,0x01,0xdf,0xc0,0x0c,0xf3,0x0a,0x80,
+0x2c,0x08,0x01,0x40,0x00,0x21,0x2e,0xf9,0x48,0x00,0x31,0x07,0xff,0xc0,0x08,0x00,
+0x32,0x6f,0xfa,0x10,0x10,0x00,0x11,0x50,0x24,0x0b,0x00,0x01,0x00,0x13,0x14,0xb5,
+0x0b,0x34,0xdf,0xa0,0x01,0x29,0x02,0xf0,0x01,0xb0,0x00,0x00,0x5c,0xfe,0xa9,0x9a,
+0xff,0x60,0x00,0x02,0xee,0x89,0x50,0x3d,0xf8,0x1d,0x02,0x30,0x1c,0xfd,0xfe,0x29,
+0x01,0x50,0x47,0xbf,0xff,0xbe,0xd4,0x2e,0x03,0x90,0xfd,0x74,0xdf,0xf9,0x99,0x50,
+0x03,0x95,0x10,0x70,0x03,0xf0,0x00,0xe1,0x00,0x03,0x9e,0xfd,0x41,0x14,0xff,0x60,
+0x00,0x0a,0xfd,0x7a,0x90,0x4e,0xc7,0x09,0x50,0x40,0x1b,0xfe,0xff,0x80,0x5f,0x00,
+0xa0,0x8d,0xff,0xd3,0x00,0x00,0x0a,0xde,0xff,0xff,0xb6,0xe2,0x09,0x31,0xfe,0xc9,
+0x61,0xc8,0x04,0x16,0x10,0x90,0x0b,0x13,0xf0,0x80,0x01,0x04,0x08,0x00,0x13,0xe0,
+0x6d,0x08,0x17,0xe0,0x83,0x0b,0x04,0x3d,0x0c,0x80,0x0e,0xee,0xee,0xff,0xff,0xee,
+0xee,0xe1,0xed,0x07,0x12,0xfb,0x0d,0x09,0x12,0xff,0xda,0x01,0x41,0x08,0xfb,0x9f,
+0xb0,0x3f,0x00,0x30,0xf5,0x2f,0xf5,0x17,0x00,0x30,0xdf,0xb0,0x08,0x2f,0x09,0xf0,
+0x03,0x2d,0xfe,0x10,0x00,0xcf,0xf5,0x00,0x08,0xff,0xe2,0x00,0x00,0x1c,0xff,0xc2,
+0x0c,0xfb,0x10,0x5d,0x01,0x31,0xc0,0x01,0x40,0x51,0x09,0x00,0x3a,0x00,0x13,0x0e,
+0x78,0x00,0x02,0x08,0x00,0x63,0x4b,0xbb,0xbf,0xfb,0xbb,0xb9,0x30,0x03,0x80,0xfd,
+0x00,0x00,0x6f,0x92,0x2e,0xf3,0x24,0x08,0x00,0x41,0x70,0x0e,0xf0,0x02,0x08,0x00,
+0x12,0x0f,0x08,0x00,0x64,0x80,0x1f,0xf0,0x03,0xfd,0x00,0x40,0x03,0x80,0x1c,0xcc,
+0xcc,0xff,0xff,0xdc,0xcc,0xc5,0x90,0x00,0x11,0xef,0x63,0x02,0x40,0x1d,0xfb,0x3f,
+0xf4,0x49,0x06,0xf1,0x09,0xdf,0xd1,0x07,0xff,0x81,0x00,0x06,0xcf,0xfc,0x10,0x00,
+0x7f,0xff,0xa5,0x0c,0xfd,0x60,0x00,0x00,0x02,0xbf,0xf4,0x02,0x40,0xbc,0x00,0x61,
+0x50,0x00,0x09,0x71,0x1f,0xe0,0xb7,0x00,0x12,0xf1,0x08,0x00,0x22,0x7f,0xd0,0x08,
+0x00,0x12,0xdf,0x80,0x00,0xb1,0x05,0xff,0xee,0xef,0xfe,0xee,0xec,0x00,0x1e,0xf7,
+0x00,0x18,0x00,0x40,0x03,0x90,0x00,0x2f,0x10,0x01,0x93,0x2c,0xcc,0xcc,0xdf,0xfc,
+0xcc,0xcc,0xc2,0x2f,0x60,0x08,0xd1,0x02,0x22,0x23,0xff,0xfe,0x22,0x22,0x20,0x00,
+0x00,0x09,0xfd,0xcf,0x5a,0x0a,0x30,0x9f,0xf4,0x2f,0x87,0x01,0xa0,0x4d,0xff,0x60,
+0x04,0xff,0xd5,0x00,0x2e,0xff,0xe4,0x0c,0x00,0x30,0xf5,0x0b,0xd6,0x1c,0x00,0x16,
+0x7d,0xd3,0x09,0xf0,0x1c,0x07,0xf4,0x01,0x23,0x57,0x98,0x00,0x07,0x37,0xf6,0xff,
+0xff,0xff,0xdb,0x20,0x0e,0xc7,0xf4,0x79,0x4c,0x50,0x6f,0x50,0x08,0xf9,0xf4,0x9f,
+0x1e,0xb2,0xfd,0x00,0x02,0x57,0xf4,0x2d,0x37,0x76,0xf5,0x00,0x00,0x1a,0xf7,0xff,
+0x0c,0x08,0xf3,0x19,0x18,0xff,0xf6,0x7e,0xc6,0x69,0xfb,0x61,0x2f,0xa9,0xf4,0x0a,
+0xf5,0x16,0xf7,0x00,0x01,0x07,0xf4,0x06,0xb1,0xdf,0xf3,0x00,0x00,0x02,0x51,0x3f,
+0xc0,0x12,0x00,0x00,0x19,0x99,0x99,0xbf,0xe9,0x99,0x99,0x91,0x98,0x00,0xf1,0x0c,
+0xf2,0x00,0x00,0x19,0xfe,0xdf,0x70,0x00,0x00,0x14,0x7b,0xff,0xd3,0x2e,0xfe,0xa7,
+0x62,0x2f,0xff,0xc7,0x00,0x01,0x8e,0xff,0xe1,0x04,0x30,0x00,0x03,0x00,0xea,0x04,
+0x22,0xa5,0x00,0x06,0x0e,0x01,0xfc,0x0b,0x40,0x1b,0xbb,0xbe,0xfd,0xd0,0x06,0x04,
+0xe0,0x06,0x41,0x01,0x12,0xdf,0x61,0x26,0x0d,0xb0,0x07,0xfc,0x1a,0xaa,0xaa,0xa8,
+0x00,0x00,0x2f,0xf3,0x2f,0x0a,0x04,0xf1,0x0c,0x03,0xef,0xb0,0x01,0x11,0x7f,0xe2,
+0x00,0x4f,0xff,0xa0,0x00,0x04,0xfd,0x10,0x00,0x5f,0xdf,0xa4,0x99,0x9c,0xfd,0x99,
+0x93,0x07,0x4f,0xa6,0x40,0x07,0xb0,0x00,0x4f,0xa1,0x22,0x27,0xfa,0x22,0x20,0x00,
+0x4f,0xa0,0x74,0x07,0x00,0x05,0x0f,0x31,0x07,0xce,0xf8,0x08,0x00,0x39,0x05,0xff,
+0xc2,0xc5,0x0d,0x23,0x16,0x60,0x68,0x02,0x10,0xe0,0xf0,0x06,0x73,0xdd,0xdd,0xef,
+0xfe,0xdd,0xdd,0xb0,0x08,0x04,0x31,0xc0,0x0d,0xf0,0x8b,0x02,0x30,0xc0,0x0d,0xf3,
+0x0f,0x00,0x40,0x4f,0xc0,0x01,0x12,0x12,0x0b,0x15,0x11,0xbe,0x02,0x13,0x2f,0xa8,
+0x00,0x80,0x1c,0xcc,0xdf,0xfc,0xdf,0xfc,0xcc,0xc1,0x61,0x00,0x21,0x1f,0xd0,0xb9,
+0x06,0xf0,0x16,0x70,0x1f,0xd0,0x02,0x30,0x00,0x05,0xff,0x10,0x1f,0xd0,0x06,0xf5,
+0x19,0xdf,0xf6,0x00,0x0f,0xfc,0xbe,0xf2,0x0c,0xfb,0x30,0x00,0x08,0xef,0xff,0x90,
+0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x16,0x60,0x00,0x01,
+0x00,0xf1,0x00,0x2f,0xf0,0x00,0x00,0x00,0x0b,0xdd,0xdd,0xdf,0xfe,0xdd,0xdd,0xc0,
+0x0d,0xff,0x01,0x00,0x30,0xe0,0x0d,0xf0,0x1b,0x00,0xc0,0x1f,0xe0,0x0d,0xf5,0xcc,
+0xcc,0xcc,0xcc,0x6f,0xe0,0x02,0x26,0x17,0x00,0x61,0x72,0x20,0x00,0x01,0x10,0x0f,
+0x1b,0x00,0x42,0x0e,0xf1,0x0f,0xf0,0x3e,0x00,0xf1,0x01,0x0f,0xff,0xff,0xf5,0x00,
+0x00,0x6f,0xf3,0x0f,0xfd,0xdd,0xd4,0x00,0x00,0xaf,0xfc,0x18,0x00,0x40,0x03,0xfe,
+0xaf,0xdf,0x08,0x00,0xf6,0x02,0x2e,0xf7,0x0a,0xff,0xff,0xee,0xee,0xe4,0x1c,0xa0,
+0x00,0x39,0xde,0xff,0xff,0xe0,0x00,0x01,0x00,0x22,0x04,0x50,0x08,0x00,0x53,0x1f,
+0xf2,0x00,0x00,0x00,0x78,0x00,0xf0,0x04,0xd0,0x0d,0xfa,0x99,0x9a,0xa9,0x99,0xaf,
+0xd0,0x0d,0xf1,0x00,0x1f,0xe0,0x00,0x2f,0xd0,0x04,0xaf,0x17,0x00,0xf0,0x05,0xfb,
+0x40,0x00,0x37,0x77,0x8f,0xf7,0x77,0x74,0x00,0x00,0x18,0x88,0x9f,0xf8,0x88,0x81,
+0x00,0x00,0x2f,0x18,0x00,0x11,0xf3,0x82,0x00,0x52,0xd0,0x00,0x00,0x00,0x0f,0x40,
+0x00,0xf1,0x13,0xf0,0x08,0x88,0x8b,0xff,0xff,0x98,0x88,0x80,0x00,0x00,0x5e,0xf7,
+0xaf,0xb2,0x00,0x00,0x03,0x7d,0xff,0x70,0x0b,0xff,0xa5,0x30,0x0c,0xff,0xa2,0x00,
+0x00,0x6d,0xff,0xc0,0x02,0x75,0x00,0x20,0x36,0x20,0xa3,0x00,0x13,0x60,0x80,0x00,
+0x53,0xf4,0x00,0x00,0x00,0x0c,0x40,0x00,0xf2,0x2a,0x0c,0xfa,0xaa,0xaa,0xaa,0xaa,
+0xaf,0xf0,0x0c,0xf0,0x5d,0x70,0x03,0xc5,0x0e,0xf0,0x05,0x67,0xfe,0x33,0x44,0xef,
+0xa6,0x60,0x02,0xdf,0xe3,0x2e,0xf6,0x1a,0xfe,0x20,0x00,0xba,0x12,0xdf,0xff,0x80,
+0x8b,0x00,0x00,0x00,0x5f,0xf6,0x1c,0xfc,0x20,0x00,0x00,0x4c,0xff,0x40,0x01,0xaf,
+0xfa,0x30,0x3d,0x40,0x00,0xf0,0x08,0xf6,0x0b,0xab,0xfb,0x99,0x99,0xaf,0xe6,0xa0,
+0x00,0x09,0xf4,0x00,0x00,0x1f,0xd0,0x00,0x00,0x09,0xfc,0xbb,0xbb,0xbf,0x08,0x00,
+0x01,0xdf,0x00,0xc1,0x00,0x00,0x06,0xa0,0x00,0x00,0x00,0xdf,0x00,0x00,0x0b,0xf6,
+0x08,0x00,0x40,0x01,0x13,0xfa,0x11,0x08,0x00,0x40,0x1f,0xff,0xff,0xfe,0x08,0x00,
+0xf0,0x05,0x0c,0xcc,0xcc,0xcb,0xff,0xff,0xff,0xf9,0x00,0x00,0x0a,0xe3,0xcd,0xdd,
+0xff,0xd8,0x04,0xe4,0x0d,0xf1,0x18,0x00,0x50,0x03,0xff,0x5f,0xd0,0x8c,0x38,0x00,
+0xf1,0x0c,0x5f,0xff,0x70,0x8f,0x70,0xdf,0x00,0x00,0x07,0xff,0x20,0x0e,0xe0,0xdf,
+0x00,0x00,0x06,0xff,0xa0,0x08,0xa1,0xdf,0x00,0x00,0x2f,0xfe,0xf5,0x28,0x00,0x30,
+0xef,0x65,0xfa,0x08,0x00,0xf7,0x01,0x3f,0xf9,0x00,0x70,0x01,0xff,0xfe,0x00,0x09,
+0x70,0x00,0x00,0x00,0xcf,0xd5,0x00,0x01,0x00,0x2f,0x0f,0xf1,0x08,0x00,0x01,0x10,
+0x02,0x08,0x00,0xf0,0x01,0x40,0x00,0x00,0x5f,0xd0,0x0f,0xf1,0x0e,0xf2,0x00,0x00,
+0x9f,0xa0,0x0f,0xf1,0x09,0x4b,0x00,0xf0,0x01,0x50,0x0f,0xf1,0x02,0xff,0x20,0x02,
+0xff,0x10,0x0f,0xf1,0x00,0xbf,0x90,0x08,0xfb,0x28,0x00,0x40,0x4f,0xf0,0x1f,0xf5,
+0x08,0x00,0x40,0x0f,0xf5,0x4e,0xc0,0x08,0x00,0x40,0x0a,0xf9,0x01,0x20,0x08,0x00,
+0x26,0x05,0x60,0x58,0x00,0x31,0xce,0xff,0xf0,0x08,0x00,0x49,0x7f,0xfc,0x50,0x00,
+0x01,0x00,0x28,0x1f,0xc0,0x08,0x00,0x60,0x06,0x61,0x1f,0xc0,0x03,0x70,0x50,0x02,
+0xf0,0x08,0x1f,0xc0,0x0c,0xf4,0x00,0x00,0x6f,0x90,0x1f,0xc0,0x03,0xfd,0x00,0x00,
+0xef,0x20,0x1f,0xc0,0x00,0xaf,0x60,0x09,0xf9,0x28,0x00,0x40,0x2f,0xe0,0x0d,0xe1,
+0x08,0x00,0x92,0x09,0xe3,0x00,0x30,0x00,0x1f,0xc0,0x06,0x72,0x40,0x00,0x10,0x4f,
+0x00,0x02,0x00,0x0b,0x01,0x10,0x40,0x07,0x00,0xf0,0x03,0x05,0xdf,0xf6,0x00,0x00,
+0x01,0x35,0x7c,0xff,0xfa,0x10,0x00,0x00,0x4f,0xff,0xff,0xd8,0x30,0xd8,0x02,0x23,
+0xb8,0x52,0x77,0x00,0x22,0x03,0x63,0x08,0x00,0x22,0x08,0xf7,0x08,0x00,0x30,0x0b,
+0xf4,0x00,0x78,0x02,0x01,0xf7,0x02,0x24,0xdd,0xd0,0x40,0x02,0x42,0x00,0x00,0x7f,
+0x80,0x20,0x00,0x22,0xdf,0x30,0x37,0x00,0x10,0xff,0x01,0x03,0x40,0x80,0x00,0x09,
+0xfc,0x20,0x00,0x60,0xb0,0x00,0x1e,0xe1,0x00,0x3f,0xb9,0x00,0x21,0x9f,0x70,0x08,
+0x00,0x31,0x04,0xfe,0x10,0x08,0x00,0x31,0x3f,0xf3,0x00,0x08,0x00,0xa1,0x4f,0x60,
+0xdd,0xdd,0xef,0xfd,0xdd,0xd4,0x03,0x00,0x50,0x00,0xf2,0x0b,0xf4,0x00,0x00,0x34,
+0x00,0x00,0x45,0x10,0x00,0x00,0x02,0xfe,0x10,0x00,0xef,0x60,0x00,0x03,0x88,0xdf,
+0xb8,0x8b,0xfe,0x88,0x40,0x06,0x70,0x00,0xb0,0x70,0x01,0x33,0x33,0x7f,0xc3,0x33,
+0x33,0x10,0x00,0x9f,0x0f,0x00,0xf2,0x04,0xfa,0x00,0x00,0x6a,0xaa,0xff,0xaa,0xaa,
+0xa7,0x00,0x09,0x99,0x9b,0xfe,0x99,0x99,0x99,0x90,0x1f,0x28,0x00,0xb0,0xf1,0x02,
+0x23,0xcf,0xb2,0x22,0x22,0x22,0x20,0x00,0x08,0x0f,0x00,0xd1,0xfd,0x00,0x00,0x9f,
+0xfa,0xcc,0xef,0xec,0xcb,0x00,0x2d,0xff,0x50,0xb2,0x00,0xa1,0x1d,0xeb,0xcc,0xcc,
+0xef,0xec,0xcc,0xc2,0x02,0x19,0x30,0x00,0xf1,0x09,0xf2,0x02,0x96,0x00,0xfe,0x00,
+0x98,0x20,0x03,0xff,0x10,0xfe,0x04,0xfe,0x20,0x79,0xee,0x99,0xff,0x9b,0xfc,0x96,
+0xdf,0xff,0x4d,0x03,0x90,0xdf,0x33,0x33,0x33,0x33,0x35,0xfb,0xdf,0x4f,0x42,0x03,
+0x90,0xfb,0x67,0x4f,0xb6,0x66,0x6e,0xf2,0x75,0x00,0x07,0x00,0xf2,0x01,0xf1,0x00,
+0x00,0x3e,0xee,0xff,0xfe,0xe1,0x00,0x01,0x11,0x11,0xef,0x21,0x11,0x10,0x16,0x03,
+0xe1,0xc0,0x0c,0xfa,0x99,0xff,0xa9,0xaf,0xc0,0x0c,0xf2,0x00,0xef,0x10,0x2f,0x07,
+0x00,0xc1,0x2e,0xff,0xb0,0x07,0x91,0x00,0xef,0x19,0xb9,0x20,0x03,0xcc,0x01,0x00,
+0x23,0x60,0x03,0xd1,0x00,0x70,0x00,0x12,0x41,0x1d,0xf3,0x13,0x52,0xfd,0x02,0xf3,
+0x16,0x0d,0xf1,0x08,0xfa,0x00,0x00,0x0c,0xf4,0x0d,0xf1,0x0d,0xf2,0x00,0x00,0x06,
+0xf9,0x0d,0xf1,0x5f,0xa0,0x00,0x00,0x01,0x61,0x0d,0xf1,0x15,0x10,0x00,0x1e,0xee,
+0xee,0xef,0xfe,0xee,0xee,0xe6,0xe1,0x00,0x00,0x0e,0x03,0x00,0x26,0x00,0x01,0x94,
+0x01,0x1f,0xf1,0x08,0x00,0x0b,0x22,0x01,0x54,0x08,0x00,0x20,0x05,0xfe,0x06,0x00,
+0x04,0x40,0x00,0x20,0xff,0xbb,0x01,0x00,0xc2,0xb4,0x00,0xfd,0x00,0xbf,0x10,0x0f,
+0xe0,0x00,0x00,0xfd,0xcf,0x22,0x04,0x70,0xfd,0x68,0xdf,0x88,0x8f,0xf8,0x82,0x18,
+0x00,0xf0,0x08,0x87,0x7f,0xe0,0x00,0x01,0xfc,0x00,0xae,0xee,0xee,0xd0,0x00,0x02,
+0xfb,0x57,0x77,0x77,0x77,0x75,0x00,0x04,0xf9,0xbf,0x28,0x00,0xf0,0x15,0x20,0x07,
+0xf7,0x05,0xfd,0x40,0x5e,0xf6,0x00,0x0a,0xf3,0x00,0x5f,0xfc,0xff,0x50,0x00,0x1f,
+0xf3,0x8a,0xdf,0xff,0xff,0xca,0x83,0x2d,0x91,0xff,0xd9,0x53,0x7c,0xff,0xf1,0x00,
+0x10,0x10,0x7b,0x00,0x10,0x20,0x73,0x00,0x13,0x58,0x88,0x00,0x62,0xef,0x50,0x00,
+0x00,0x01,0xff,0x55,0x01,0x21,0x01,0xfe,0x80,0x00,0xf1,0x25,0xb8,0x01,0xfb,0x02,
 0x94,0x1d,0x90,0x68,0x00,0x01,0xfb,0x08,0xf5,0x1f,0xb0,0xde,0x00,0x02,0xfb,0x0d,
 0xf7,0x1f,0xb3,0xfd,0x00,0x03,0xfb,0x8f,0xff,0x9f,0xcd,0xff,0xd1,0x03,0xfc,0xfd,
 0x1b,0xaf,0xff,0x75,0xf9,0x04,0xf8,0x22,0x00,0x1f,0xb3,0x00,0x30,0x06,0xf6,0x5f,
-0x71,0x05,0xa2,0x09,0xf4,0x3b,0xbb,0xbf,0xeb,0xbb,0xa0,0x0d,0xf1,0xe3,0x51,0xa2,
-0x3f,0xb4,0xaa,0xaa,0xaf,0xea,0xaa,0xa8,0x2c,0x66,0x43,0x1e,0x09,0x43,0x03,0xf2,
-0x03,0x14,0x7b,0x20,0x2f,0xff,0xf8,0x5a,0xce,0xff,0xff,0xb0,0x1a,0xaf,0xf2,0x5f,
-0xec,0xff,0x51,0x7e,0x14,0x20,0xcf,0x10,0x5c,0x19,0xf0,0x19,0x02,0x10,0xcf,0x10,
-0x00,0x02,0xfd,0x00,0x1f,0xb0,0xcf,0x98,0x80,0x09,0xff,0xff,0x1f,0xb0,0xcf,0xff,
-0xf0,0x09,0x99,0xfe,0x1f,0xb0,0xcf,0x32,0x20,0x03,0x51,0xfb,0x1f,0xb0,0xcf,0x10,
-0x00,0x0b,0xf6,0xf8,0x08,0x00,0x00,0x15,0x3c,0x91,0x1f,0xd8,0xef,0x98,0x82,0x00,
-0xbf,0xe0,0x1f,0xb1,0x02,0x31,0xaf,0xfb,0x51,0x9f,0x0c,0xa0,0xfd,0xbf,0xff,0xfe,
-0xdc,0xdd,0xd5,0x2d,0xe2,0x03,0x22,0x35,0x17,0xf1,0x39,0x09,0x06,0xe4,0x42,0x22,
-0xb1,0xc5,0xc2,0x06,0x13,0xb4,0x5e,0x21,0x50,0xb0,0x4f,0x50,0x1d,0xdd,0x01,0x03,
-0x26,0xde,0xd2,0x89,0x07,0x06,0x5a,0x09,0x22,0x0f,0xf0,0x6e,0x2e,0xa1,0x5e,0xf1,
-0x00,0x00,0x06,0xcd,0xff,0xcc,0x4c,0xf4,0x2f,0x14,0x01,0xbb,0x12,0x00,0x08,0x00,
-0xf1,0x0f,0x04,0xfb,0x00,0x30,0x00,0x01,0xfc,0x25,0x60,0xff,0x12,0xf6,0x06,0x8b,
-0xff,0xff,0xd0,0xbf,0x96,0xf6,0x0e,0xff,0xeb,0x74,0x00,0x2f,0xff,0xf2,0x05,0x51,
-0xd5,0x08,0x20,0x80,0x0d,0x95,0x13,0x91,0xff,0xff,0xc0,0x9a,0xaa,0xef,0x38,0xbb,
-0xbb,0xf1,0x59,0x00,0x30,0x28,0xf0,0x02,0x7f,0xff,0xff,0x38,0xff,0xff,0xfc,0x08,
-0xfc,0xaa,0xa2,0x9f,0xca,0xaa,0x80,0x9f,0x40,0x81,0x05,0x00,0x93,0x16,0xf2,0x2a,
-0xf6,0xbf,0xff,0xff,0xf0,0x7a,0xaa,0xdf,0x58,0xaa,0xaa,0xff,0x08,0xfa,0x39,0xf4,
-0x7f,0xa5,0x0f,0xe0,0x29,0xec,0xbf,0x32,0x8e,0xe6,0xfd,0x04,0x8d,0xff,0xf2,0x38,
-0xdf,0xff,0xc3,0xff,0xb6,0xff,0x0e,0xfd,0x76,0xfa,0x05,0x19,0xbf,0xc0,0x44,0x77,
-0xcf,0x70,0x00,0xaf,0xe4,0x00,0x0e,0xff,0xd1,0x0a,0x42,0x16,0x10,0x37,0x05,0x30,
-0xff,0xfa,0x0d,0x22,0x04,0xf2,0x03,0x0a,0xab,0xfa,0x0d,0xf7,0x77,0x77,0x70,0x00,
-0x00,0xfa,0x0d,0xfb,0xbb,0xbb,0x40,0x04,0x56,0x08,0x00,0x30,0x0d,0xff,0xfa,0xbf,
-0x20,0x51,0x20,0x0d,0xe6,0x64,0x0d,0x89,0x55,0xb0,0xc0,0x00,0x3d,0xf4,0x33,0x33,
-0x30,0x0e,0xea,0xa8,0xef,0x89,0x02,0xf9,0x20,0x0e,0xff,0xfb,0x6f,0xc8,0xf9,0x5a,
-0x71,0x00,0x01,0xfa,0x1f,0xa0,0xce,0x7f,0xc0,0x00,0x03,0xf8,0x1f,0xa0,0x3f,0xf9,
-0x10,0x00,0x06,0xf6,0x2f,0xc7,0x88,0xfe,0x50,0x09,0xdf,0xf3,0xaf,0xff,0xa0,0x9f,
-0xf4,0x06,0xff,0x90,0x5c,0x61,0x00,0x05,0xe7,0x1a,0x21,0x1a,0x60,0xaf,0x0c,0xa1,
-0x00,0x9f,0x70,0x50,0x00,0x1b,0xbb,0xef,0x03,0xfc,0x74,0x1a,0xf2,0x10,0xbf,0x3e,
-0xf8,0x79,0xef,0x70,0x04,0x44,0xdf,0x6f,0xff,0xff,0xee,0xf2,0x0e,0xff,0xff,0x06,
-0x43,0xe9,0x03,0x70,0x0f,0xd7,0x77,0x17,0x78,0xfd,0x77,0x50,0x1f,0x05,0x12,0xf0,
-0x00,0xb0,0x3f,0xdb,0xbb,0x5f,0x71,0xfb,0x0f,0xb0,0x6f,0xff,0xff,0x5f,0xb8,0xfd,
-0x7f,0x49,0x22,0xcf,0x4f,0x6b,0x0b,0x60,0xef,0x00,0x01,0xfb,0x5d,0x30,0x1a,0x15,
-0xf6,0x05,0x01,0xfb,0x6f,0xb0,0x03,0xbd,0xf9,0x9d,0xee,0xff,0xff,0xf3,0x01,0xff,
-0xc2,0xaf,0xed,0xb9,0x89,0xe5,0x5e,0x19,0x00,0x04,0x17,0x30,0x10,0x1e,0xd0,0x07,
-0x88,0x50,0xf2,0x0b,0xf8,0x00,0xff,0xd5,0x38,0xa0,0xfe,0x00,0xff,0x00,0xdf,0x40,
-0x00,0xcf,0x30,0xff,0xd6,0x64,0x53,0x31,0x01,0xff,0x10,0x32,0xe1,0x17,0x30,0xf1,
-0x0c,0xdd,0xdb,0x32,0x13,0xf1,0x12,0x1c,0x10,0x04,0x1e,0x04,0x46,0xcf,0xf1,0x05,
-0xff,0xdf,0x0f,0x14,0x0e,0x07,0x00,0x12,0x4f,0x15,0x00,0x17,0x3d,0x31,0x00,0x31,
-0x00,0x47,0x10,0x2e,0x6c,0x80,0x04,0xff,0x40,0x4c,0xff,0xcd,0xfe,0xc0,0x07,0x42,
-0x61,0xce,0x03,0xfa,0x0c,0xff,0x50,0x08,0x00,0x20,0x06,0xc2,0x5a,0x06,0x00,0xfe,
-0x00,0xb0,0x5f,0x80,0x69,0xef,0x9b,0xfd,0x91,0x05,0xfe,0x20,0xaf,0x5e,0x01,0xa0,
-0x9f,0xe3,0x00,0x12,0xee,0x25,0xfb,0x2b,0xfc,0x20,0x26,0x8c,0x90,0xfa,0x01,0x70,
-0x0b,0x91,0x03,0xfa,0x03,0xfa,0x6e,0x20,0xfb,0x0e,0x07,0xf7,0x03,0xfa,0x00,0x09,
-0xfe,0x10,0x0d,0xf2,0x03,0xfa,0x04,0xdf,0xe2,0x00,0x9f,0xb0,0x03,0xfa,0x7f,0xfa,
-0x10,0x00,0x3d,0x10,0x03,0xfa,0x1b,0x9c,0x06,0x00,0x08,0x07,0x11,0x05,0xc8,0x09,
-0xa1,0x8f,0x90,0x05,0xfa,0x55,0x5b,0xf5,0x06,0xfe,0x20,0x10,0x00,0x30,0x9f,0xf3,
-0x00,0x10,0x00,0xf0,0x05,0xf9,0xfe,0x30,0x00,0x04,0xcc,0xdf,0xdc,0xc4,0x41,0x08,
-0x60,0x08,0x88,0xdf,0xb8,0x88,0x00,0xaf,0xc0,0xb7,0x17,0x90,0xa9,0x4d,0xfc,0x00,
-0x01,0xee,0xee,0xee,0xe5,0xdf,0x55,0xf0,0x05,0xfc,0x55,0x5d,0xf1,0x75,0x01,0x20,
-0x01,0xfc,0x66,0x6d,0xf1,0x00,0x0c,0xf4,0x01,0xfd,0xef,0xed,0xd1,0xb4,0x16,0xf0,
-0x06,0xfa,0x8f,0x7f,0x70,0x5e,0xfb,0x00,0x0d,0xf8,0xcf,0x59,0xfa,0xff,0x80,0x00,
-0x01,0x38,0xfc,0x11,0x31,0xb3,0xd6,0x02,0x31,0xa3,0x00,0x05,0x8d,0x64,0x11,0xf4,
-0x08,0x00,0x90,0x02,0xdf,0x70,0x7b,0xbd,0xfe,0xbb,0xb0,0x1e,0x89,0x62,0x00,0x0b,
-0x10,0x22,0x61,0xd8,0x20,0x00,0xa1,0x0c,0xfd,0xaa,0xac,0xfd,0xaa,0xa8,0x00,0xaf,
-0xd8,0x72,0x04,0x40,0x1c,0xff,0xb0,0x00,0xcf,0x66,0x30,0x3f,0xff,0xb4,0xcd,0x16,
-0x42,0xa6,0x09,0x3f,0xb5,0x48,0x33,0x60,0x1f,0xb0,0x2a,0x60,0x03,0xfb,0x47,0x04,
-0x31,0x1e,0xf3,0x02,0x08,0x00,0x22,0x04,0xfa,0x08,0x00,0x42,0x00,0x33,0xcd,0xfa,
-0x5f,0x04,0x29,0xff,0xc3,0x9c,0x3e,0x12,0x21,0x9e,0x32,0x31,0x01,0xef,0x30,0xd3,
-0x06,0xf0,0x05,0x2e,0xf5,0x08,0xb3,0x00,0x5f,0xe2,0x06,0xff,0xb7,0xbf,0xb1,0x00,
-0x2c,0x2a,0xb5,0xff,0xff,0xf7,0x51,0xd1,0x77,0xf1,0x12,0x39,0xfa,0x13,0xfc,0x00,
-0x05,0xff,0x1a,0xff,0xfe,0xff,0xff,0x80,0x6f,0xff,0x19,0xdd,0xfe,0x76,0x5c,0xf1,
-0x7f,0xff,0x10,0x1d,0xfa,0x44,0x45,0x40,0x06,0xbf,0x12,0xcf,0x29,0x4b,0x50,0xbf,
-0x4f,0xff,0xc2,0x4e,0x95,0x66,0x50,0x18,0x57,0xfc,0xdf,0x60,0xc4,0x11,0x11,0x04,
-0x6a,0x45,0xe6,0xbf,0x4b,0xff,0xfa,0xbf,0xfe,0xa2,0x00,0xbf,0x2d,0xb7,0x10,0x02,
-0x8c,0xfc,0x66,0x42,0x05,0x10,0x26,0x20,0x7f,0x53,0x21,0x9f,0x80,0xb5,0x57,0x11,
-0x01,0x8b,0x07,0xb0,0x7f,0xc1,0x0b,0xfa,0x77,0x77,0x77,0x70,0x2b,0x1c,0xdf,0x09,
-0x2a,0xd0,0x00,0x00,0x8f,0x94,0xbf,0x65,0x55,0xcf,0x10,0x06,0xff,0x20,0x9f,0x3e,
-0x16,0xb1,0x7f,0xff,0x10,0x9f,0x54,0x44,0xcf,0x10,0x9f,0xef,0x10,0x10,0x00,0x51,
-0x15,0xaf,0x10,0x0a,0xfa,0xfe,0x2b,0x21,0x10,0x8f,0x4e,0x09,0xb1,0xaf,0x2c,0xff,
-0xe6,0x5d,0xf7,0x00,0x00,0xaf,0x16,0x63,0xea,0x0f,0x20,0xaf,0x29,0x06,0x2e,0x60,
-0xa2,0x00,0xaf,0x1c,0xc9,0x50,0xf6,0x2c,0x50,0x29,0x20,0x2f,0x10,0x0b,0x36,0x05,
-0x20,0x50,0x3f,0x31,0x4e,0xf0,0x0b,0x09,0xfa,0x2f,0x4f,0x4f,0x2f,0xa0,0x00,0x6f,
-0xc1,0x2f,0x4f,0x4f,0x5f,0xa4,0x41,0x1c,0x3e,0xbf,0xaf,0xaf,0xaf,0xff,0xf7,0x00,
-0xaf,0x5f,0x00,0xc0,0x5d,0xe2,0x05,0xff,0x13,0x33,0x36,0xff,0x1e,0xb0,0x4f,0xfe,
-0xb8,0x02,0xf0,0x08,0x6f,0x80,0x7f,0xfe,0x16,0x77,0x76,0x3e,0xcf,0x50,0x06,0xce,
-0x0a,0xff,0xf8,0x0a,0xff,0x10,0x00,0xce,0x0a,0xe3,0xf8,0x03,0x4d,0x50,0xce,0x0c,
-0xc0,0xff,0xd8,0x08,0x00,0xf7,0x07,0x0f,0xa3,0xfc,0x8f,0xff,0x70,0x00,0xce,0x8f,
-0x50,0x68,0xfd,0x1c,0xf6,0x00,0xce,0x19,0x00,0x04,0xb1,0x01,0xa0,0x6c,0x02,0x13,
-0x80,0x1d,0x28,0x42,0xfd,0x30,0x00,0xa5,0x8a,0x50,0x20,0x07,0xfd,0x18,0x00,0x20,
-0x28,0xf8,0x4c,0x0e,0xf0,0x2c,0x41,0x4f,0xc0,0x30,0xbf,0xb0,0x00,0x00,0xfe,0x4f,
-0xc0,0x06,0xfe,0x22,0x00,0x04,0xfa,0x4f,0xc0,0x5f,0xf7,0xfc,0x00,0x08,0xf7,0x4f,
-0xc3,0xff,0x70,0xdf,0x50,0x0e,0xf2,0x4f,0xee,0xf9,0x00,0x4f,0xe0,0x4f,0xb0,0x4f,
-0xff,0x90,0x00,0x0d,0xf4,0x03,0x30,0x8f,0xf8,0x00,0x05,0x17,0xe5,0x00,0x2c,0xff,
-0xc0,0x64,0x03,0x22,0x19,0xff,0xa4,0x1c,0xd2,0x1e,0xe6,0x1f,0xff,0xee,0xff,0x90,
-0x00,0x02,0x10,0x07,0xef,0xff,0xbf,0x1e,0x23,0x01,0x72,0xfa,0x01,0x01,0xdc,0x13,
-0x20,0xcc,0xcc,0x2b,0x14,0x14,0xc5,0x4a,0x07,0x00,0xc1,0x31,0x01,0xe4,0x36,0x00,
-0x44,0x3d,0x12,0xc2,0x0a,0x11,0x30,0x2b,0xfe,0x10,0xf6,0x21,0x30,0x0e,0xd0,0x73,
-0xa9,0x05,0xf0,0x21,0x38,0x2f,0xe0,0x00,0x9e,0x10,0x02,0xfb,0x6f,0x5f,0xe0,0x00,
-0x8f,0x70,0x04,0xf9,0x8f,0x3f,0xe0,0x01,0x2f,0xe0,0x07,0xf6,0xdf,0x1f,0xe0,0x0a,
-0xcb,0xf5,0x0c,0xf6,0xfc,0x0f,0xe0,0x0b,0xe6,0xfa,0x2f,0xe1,0x86,0x0e,0xfb,0xbf,
-0xb2,0xa3,0x2c,0x80,0x1d,0x28,0x08,0xe3,0x51,0x23,0x3a,0x60,0x40,0x07,0x30,0xd8,
-0x88,0x70,0x1b,0x11,0x02,0x00,0x08,0x00,0xa4,0x59,0x00,0x21,0x35,0x13,0x2e,0x2b,
-0x04,0xf0,0x00,0x02,0x69,0x99,0x99,0x99,0x9e,0xf1,0x00,0x00,0x1a,0xaa,0xaa,0xaa,
-0xae,0xf1,0xa4,0x0d,0x51,0xbb,0xbb,0xbf,0xf1,0x00,0x86,0x11,0x10,0x7e,0x2c,0x20,
-0x04,0x53,0x04,0xf0,0x17,0x11,0x3e,0xa0,0x00,0x46,0x00,0x07,0xe5,0xff,0x0c,0xf7,
-0x00,0xef,0x30,0x0d,0xf4,0xff,0x01,0xd6,0x8c,0x8f,0xb0,0x6f,0xc0,0xdf,0xca,0xab,
-0xff,0x1f,0xf1,0x06,0x30,0x5d,0xff,0xff,0xe7,0x05,0x20,0x7b,0x79,0x01,0xd7,0x0c,
-0x20,0xaf,0x06,0x6c,0x0f,0x40,0xa0,0x00,0xaf,0x38,0x83,0x08,0xc1,0xd0,0x03,0xbf,
-0xf5,0x55,0x5e,0xf5,0x55,0x20,0x1f,0xef,0xcd,0xc2,0x08,0x92,0x3f,0xdf,0x59,0x55,
-0x5e,0xf6,0x55,0x52,0x6f,0x36,0x32,0x41,0xf6,0x9d,0xaf,0x00,0x06,0x2c,0x32,0x02,
-0xaf,0x00,0x08,0x1d,0x8f,0xaf,0x00,0xfd,0x44,0x44,0x9f,0x50,0x00,0x10,0x00,0x07,
-0x51,0xfc,0x00,0x29,0xcf,0x40,0x08,0x00,0x52,0x0e,0xea,0x00,0x00,0x07,0xdb,0x13,
-0x00,0x08,0x00,0x10,0xcf,0x79,0x05,0xf1,0x04,0x07,0xf6,0x00,0xcf,0x77,0x8f,0xb0,
-0x1f,0xff,0xff,0xf9,0xcf,0x44,0x5f,0xb0,0x08,0x9f,0xfb,0x85,0x18,0x00,0xb0,0x5f,
-0xfd,0x30,0xcf,0x33,0x4f,0xb0,0x01,0xef,0xff,0xf7,0x10,0x00,0xf0,0x05,0x2d,0xfa,
-0xf6,0xc6,0xcf,0x66,0x7f,0xb0,0x1e,0x77,0xf5,0x10,0xcf,0x88,0x9f,0xb0,0x01,0x04,
-0x93,0x03,0x18,0x00,0xfa,0x16,0x01,0xb2,0x46,0x3f,0xd2,0x00,0x9f,0x20,0x06,0xf8,
-0xaf,0x26,0xfc,0x22,0x7f,0xb0,0x0d,0xf3,0xaf,0x30,0x51,0x6f,0x6e,0xf4,0x2e,0xc0,
-0x9f,0xdb,0xab,0xff,0x26,0xd4,0x00,0x20,0x2c,0xff,0xff,0xd3,0x48,0x12,0x0d,0xc5,
-0x2a,0x03,0x69,0x4b,0xf4,0x00,0x77,0xcf,0x77,0x77,0xfd,0x77,0x00,0x04,0x44,0xcf,
-0x74,0x47,0xfd,0x44,0x40,0x88,0x36,0x21,0x04,0x55,0x01,0x00,0x33,0x50,0x00,0x1f,
-0x5b,0x0d,0x40,0x1f,0xc4,0x44,0x44,0xfc,0x11,0x0f,0x10,0x00,0x05,0xf5,0x10,0x77,
-0x4a,0x8e,0xe7,0x01,0x97,0x00,0x02,0xfd,0x6f,0x70,0x93,0x85,0xcf,0x40,0x1e,0xf4,
-0x5f,0xc8,0x89,0xfb,0x2f,0xd0,0x05,0x60,0x0b,0xff,0xff,0xe4,0x04,0x10,0x17,0x24,
-0xf1,0x07,0x2f,0xd0,0x10,0x2f,0x90,0x26,0x00,0x01,0xdf,0x4a,0xe2,0x2f,0xcb,0xff,
-0x60,0x3e,0xf9,0x4a,0xfc,0x2f,0xfe,0xa4,0xa3,0x26,0xf9,0x4d,0x7f,0xa0,0x0b,0x90,
-0x08,0x98,0x77,0x7a,0x0f,0xfe,0xef,0xa0,0x09,0xfd,0xcc,0xfc,0x07,0xba,0xa8,0x10,
-0x09,0xfd,0xdd,0xfc,0x2f,0xa3,0x8d,0x40,0x09,0xf6,0x55,0xfc,0x2f,0xff,0xfa,0x30,
-0x09,0xff,0xff,0xfc,0x2f,0xc3,0x08,0x70,0x09,0xf1,0x14,0xfc,0x1f,0xd7,0x7e,0xd0,
-0x09,0xf1,0x1f,0xe9,0x3a,0xff,0xff,0x60,0x06,0x82,0xa8,0x0d,0xf3,0x00,0x5b,0x30,
-0x0e,0xf2,0xfc,0x02,0xb2,0xab,0x5f,0xb0,0x8f,0x90,0xff,0x88,0x89,0xfc,0x0e,0xf2,
-0x06,0x00,0x7e,0xff,0xff,0xd4,0x04,0x30,0x1a,0x23,0x22,0x68,0xc2,0x08,0x00,0x12,
-0x7c,0x89,0x02,0x53,0x9f,0x71,0xaf,0x40,0x00,0x5e,0x28,0x00,0x5b,0x17,0x60,0xef,
-0xed,0xdd,0xd6,0x00,0xff,0x49,0x1b,0xf0,0x02,0x35,0x10,0x00,0xff,0xaa,0xa9,0x3f,
-0xb0,0xbf,0x60,0x00,0xff,0xff,0xfe,0x1f,0xe2,0xff,0x36,0x1c,0x40,0xfd,0x0e,0xfa,
-0xf9,0x56,0x28,0xf8,0x1e,0xfd,0x0b,0xff,0xf2,0x00,0x03,0xfb,0x01,0xfc,0x07,0xff,
-0x70,0x30,0x06,0xf9,0xac,0xfa,0x0b,0xff,0x00,0xf6,0x0b,0xf5,0xbf,0xf6,0xcf,0xff,
-0x84,0xf7,0x2f,0xf1,0x01,0x4f,0xfc,0x5f,0xff,0xf3,0x0a,0xa0,0x00,0x0a,0x80,0x04,
-0xdf,0x90,0xe0,0x4f,0x80,0x02,0x47,0xa1,0x00,0x00,0x79,0xab,0xce,0x20,0x05,0x00,
-0x63,0x11,0x83,0xfb,0x85,0x20,0x00,0x00,0x22,0x10,0x0b,0x6d,0x34,0x02,0xcf,0x5f,
-0x13,0xff,0x70,0x4f,0x11,0xcc,0xb8,0x1f,0x13,0x70,0xdf,0x22,0x00,0xe0,0x22,0x53,
-0x2c,0xf5,0x22,0x22,0x21,0x2a,0x0b,0x30,0xf8,0x0b,0xbb,0x2d,0x30,0x24,0xbb,0xb6,
-0x20,0x00,0x15,0x00,0x52,0x13,0x33,0xcd,0xdf,0xf1,0x34,0x51,0x19,0x70,0xf1,0x0d,
-0x14,0xd0,0x08,0x00,0x10,0x09,0x31,0x03,0x00,0x08,0x00,0xb0,0xfd,0xcc,0xcf,0xf1,
-0x1b,0xbf,0xfb,0x89,0xf3,0x00,0x0d,0x28,0x24,0x10,0xc9,0x08,0x00,0x00,0x18,0x00,
-0x04,0x08,0x00,0x10,0xfc,0x69,0x03,0x31,0x0f,0xe9,0x9a,0x9f,0x07,0xe0,0xff,0xff,
-0xdb,0xf3,0x7f,0x80,0x00,0x1f,0xcf,0xe3,0x0d,0xf1,0x2f,0xe0,0x48,0x00,0x40,0x0f,
-0xe0,0x0e,0xf4,0x08,0x00,0x40,0x5f,0xa0,0x07,0xfc,0x08,0x00,0x90,0xdf,0x40,0x01,
-0xef,0x90,0x0a,0xcf,0xc7,0xfd,0xea,0x2b,0x41,0x0a,0xfd,0x40,0xb3,0xd4,0x1b,0x04,
-0x01,0x00,0x24,0x6f,0x60,0x08,0x00,0x10,0x9f,0x80,0x00,0x00,0x08,0x00,0xf1,0x00,
-0xdc,0xfe,0xbf,0xf1,0x2b,0xdf,0xdb,0x9f,0x51,0xfb,0x0d,0xf1,0x2f,0xff,0xfe,0x08,
-0x00,0x35,0x16,0xaf,0xa6,0x20,0x00,0x71,0xcb,0xfe,0xaf,0xf1,0x00,0x6f,0x96,0x18,
-0x00,0x31,0x2a,0xef,0xfe,0x30,0x00,0x41,0x1f,0xff,0xa3,0x9f,0x9b,0x11,0x70,0x7f,
-0x60,0x36,0x21,0xfb,0x05,0x50,0x58,0x00,0x10,0x01,0x8c,0x13,0x03,0x08,0x00,0x31,
-0x0a,0xdf,0x50,0x08,0x00,0x32,0x0b,0xfb,0x10,0x18,0x00,0x01,0x41,0x4c,0x11,0x00,
-0x22,0x7e,0x02,0x80,0x00,0x20,0x70,0x8f,0xa6,0x2b,0x00,0x08,0x00,0x92,0xed,0xdd,
-0xdd,0xc0,0x39,0xcf,0xc9,0x8f,0x60,0x55,0x1d,0x01,0xf2,0x59,0x40,0x25,0x9f,0xa5,
-0x8f,0x20,0x03,0x00,0x20,0x00,0xf1,0x08,0xdb,0xbb,0xef,0x10,0x00,0x6f,0xb9,0x8f,
-0x60,0x00,0xaf,0x10,0x4a,0xef,0xff,0x9f,0x70,0x00,0xbf,0x10,0x4f,0xff,0xa2,0x20,
-0x00,0x11,0x03,0x20,0x00,0x11,0xbb,0x50,0x00,0x13,0x60,0x58,0x00,0x10,0x70,0x43,
-0x12,0x31,0xdf,0x60,0x8f,0x77,0x5d,0x40,0xfb,0x10,0x6c,0xcc,0x50,0x05,0x0c,0x01,
-0x00,0x52,0x7f,0x40,0x00,0x05,0xd4,0x08,0x00,0x21,0x04,0xfb,0x08,0x00,0x81,0x8c,
-0xcc,0xff,0xcc,0xc2,0x1b,0xdf,0xc8,0xc3,0x08,0x61,0x2f,0xff,0xfb,0xaf,0x20,0x34,
-0x18,0x00,0x40,0xaf,0x10,0xaf,0x40,0x08,0x00,0x30,0xbf,0x10,0xef,0x10,0x00,0x40,
-0xc8,0xcf,0x02,0xfb,0xa9,0x2c,0xd0,0xfa,0xdf,0x07,0xf6,0x22,0x00,0x2f,0xef,0x50,
-0xed,0x0c,0xf2,0xfb,0x20,0x00,0xf0,0x0a,0xfb,0x2f,0xb0,0x9f,0x20,0x00,0x7f,0x44,
-0xf8,0x8f,0x50,0x3f,0x80,0x00,0x7f,0x4a,0xf7,0xff,0x78,0x9f,0xe0,0x0b,0xef,0x5f,
-0xd4,0xca,0x0b,0x85,0x0a,0xe9,0x08,0x60,0xa7,0x53,0x13,0xd4,0xaf,0x0b,0x00,0xd8,
-0x5c,0x13,0xeb,0x08,0x00,0x11,0xfc,0x08,0x00,0x10,0x3b,0x16,0x2c,0x40,0x18,0xbf,
-0xb6,0x4f,0x70,0x07,0x10,0x2f,0x9c,0x02,0x00,0x05,0x44,0xb1,0x7f,0x72,0xaa,0xab,
-0xfe,0xaa,0xa7,0x00,0x5f,0x60,0xff,0xfa,0x52,0x21,0x5f,0xb8,0x3b,0x2a,0xc0,0x3b,
-0xff,0xfc,0x9a,0xaa,0xaa,0xff,0xa6,0x2f,0xff,0x80,0xdf,0x68,0x08,0x70,0x02,0x5f,
-0x60,0x06,0xb1,0x00,0xfd,0x48,0x00,0x22,0x08,0xf9,0x08,0x00,0xe1,0x00,0xdf,0x10,
-0xfd,0x00,0x0a,0xef,0x50,0x00,0x32,0xab,0xfc,0x00,0x09,0xb1,0x44,0x26,0xe5,0x00,
-0xc6,0x1d,0xb0,0x90,0x00,0x12,0x46,0x8b,0x30,0x00,0x3f,0x90,0xaf,0xff,0x74,0x7f,
-0xf1,0x04,0x3f,0x90,0x37,0x66,0xfb,0x10,0x00,0x1c,0xdf,0xea,0xbb,0xbc,0xfe,0xbb,
-0xb5,0x1f,0xff,0xfd,0xff,0xb9,0x7b,0xb1,0x5f,0xa1,0x11,0x12,0xfb,0x11,0x10,0x00,
-0x3f,0x90,0x8f,0x10,0x02,0xf1,0x03,0x3f,0xc7,0x9f,0xa9,0xfd,0x8e,0xf1,0x29,0xdf,
-0xff,0x9f,0x98,0xfd,0x8d,0xf1,0x3f,0xff,0xb2,0x08,0x02,0xc2,0x04,0x4f,0x90,0x9f,
-0x31,0xfb,0x0b,0xf1,0x00,0x3f,0x90,0x9f,0x28,0x00,0x11,0x90,0x20,0x00,0x60,0x0b,
-0xef,0x80,0x01,0x01,0xfa,0x7a,0x11,0x37,0x20,0x00,0x01,0x38,0x21,0x00,0xdc,0x00,
-0x22,0x19,0x80,0x08,0x00,0x01,0x9b,0x26,0x12,0xfc,0xb6,0x30,0xf2,0x0c,0x47,0xfe,
+0x71,0x05,0x80,0x09,0xf4,0x3b,0xbb,0xbf,0xeb,0xbb,0xa0,0xe5,0x00,0xe1,0x1f,0xb0,
+0x00,0x00,0x3f,0xb4,0xaa,0xaa,0xaf,0xea,0xaa,0xa8,0x2c,0x66,0x60,0x00,0x19,0xfd,
+0x43,0x03,0xf1,0x37,0x14,0x7b,0x20,0x2f,0xff,0xf8,0x5a,0xce,0xff,0xff,0xb0,0x1a,
+0xaf,0xf2,0x5f,0xec,0xff,0x51,0x00,0x00,0x3f,0xa0,0x00,0x00,0xcf,0x10,0x00,0x00,
+0xaf,0x40,0x02,0x10,0xcf,0x10,0x00,0x02,0xfd,0x00,0x1f,0xb0,0xcf,0x98,0x80,0x09,
+0xff,0xff,0x1f,0xb0,0xcf,0xff,0xf0,0x09,0x99,0xfe,0x1f,0xb0,0xcf,0x32,0x20,0x03,
+0x51,0xfb,0x1f,0xb0,0xcf,0x10,0x00,0x0b,0xf6,0xf8,0x08,0x00,0xc1,0x04,0xff,0xf3,
+0x1f,0xd8,0xef,0x98,0x82,0x00,0xbf,0xe0,0x1f,0xb1,0x02,0x30,0xaf,0xfb,0x51,0x63,
+0x00,0xfd,0x04,0x09,0xfd,0xbf,0xff,0xfe,0xdc,0xdd,0xd5,0x2d,0xe2,0x03,0x9b,0xde,
+0xff,0xff,0xf1,0x01,0x10,0x00,0x01,0x00,0x31,0x5f,0xb1,0xc5,0x08,0x00,0x22,0x4f,
+0xb4,0x82,0x03,0x60,0x4f,0xb0,0x4f,0x50,0x1d,0xdd,0x01,0x03,0x42,0xde,0xd2,0x2f,
+0xff,0x89,0x02,0x01,0xa2,0x05,0x03,0xf7,0x05,0x00,0x1a,0x06,0x00,0xc0,0x02,0xc0,
+0x5e,0xf1,0x00,0x00,0x06,0xcd,0xff,0xcc,0x4c,0xf4,0x00,0x00,0x91,0x01,0x22,0x09,
+0xf7,0x08,0x00,0xf0,0x0f,0x04,0xfb,0x00,0x30,0x00,0x01,0xfc,0x25,0x60,0xff,0x12,
+0xf6,0x06,0x8b,0xff,0xff,0xd0,0xbf,0x96,0xf6,0x0e,0xff,0xeb,0x74,0x00,0x2f,0xff,
+0xf2,0x05,0x51,0x33,0x06,0xf1,0x1b,0xdf,0x80,0x0d,0xff,0xff,0xf3,0xcf,0xff,0xff,
+0xc0,0x9a,0xaa,0xef,0x38,0xbb,0xbb,0xfc,0x00,0x00,0x0b,0xf3,0x00,0x00,0x2f,0xc0,
+0x7f,0xff,0xff,0x38,0xff,0xff,0xfc,0x08,0xfc,0xaa,0xa2,0x9f,0xca,0xaa,0x80,0x9f,
+0x40,0x81,0x05,0xf1,0x2d,0x0a,0xff,0xff,0xf6,0xbf,0xff,0xff,0xf0,0x7a,0xaa,0xdf,
+0x58,0xaa,0xaa,0xff,0x08,0xfa,0x39,0xf4,0x7f,0xa5,0x0f,0xe0,0x29,0xec,0xbf,0x32,
+0x8e,0xe6,0xfd,0x04,0x8d,0xff,0xf2,0x38,0xdf,0xff,0xc3,0xff,0xb6,0xff,0x0e,0xfd,
+0x76,0xfa,0x05,0x19,0xbf,0xc0,0x44,0x77,0xcf,0x70,0x00,0xaf,0xe4,0x00,0x0e,0xff,
+0xd1,0xb2,0x00,0x26,0x12,0x10,0x37,0x05,0x30,0xff,0xfa,0x0d,0x22,0x04,0xf2,0x03,
+0x0a,0xab,0xfa,0x0d,0xf7,0x77,0x77,0x70,0x00,0x00,0xfa,0x0d,0xfb,0xbb,0xbb,0x40,
+0x04,0x56,0x08,0x00,0xb0,0x0d,0xff,0xfa,0x0d,0xf6,0x55,0x55,0x20,0x0d,0xe6,0x64,
+0x28,0x00,0xd0,0x50,0x0d,0xc0,0x00,0x3d,0xf4,0x33,0x33,0x30,0x0e,0xea,0xa8,0xef,
+0x89,0x02,0xf8,0x21,0x0e,0xff,0xfb,0x6f,0xc8,0xf9,0x5a,0x71,0x00,0x01,0xfa,0x1f,
+0xa0,0xce,0x7f,0xc0,0x00,0x03,0xf8,0x1f,0xa0,0x3f,0xf9,0x10,0x00,0x06,0xf6,0x2f,
+0xc7,0x88,0xfe,0x50,0x09,0xdf,0xf3,0xaf,0xff,0xa0,0x9f,0xf4,0x06,0xff,0x90,0x5c,
+0x61,0x00,0x05,0x80,0x69,0x01,0x30,0x1a,0x60,0x00,0x22,0x06,0xf0,0x22,0x00,0x9f,
+0x70,0x50,0x00,0x1b,0xbb,0xef,0x03,0xfc,0x03,0xfa,0x00,0x00,0x00,0xbf,0x3e,0xf8,
+0x79,0xef,0x70,0x04,0x44,0xdf,0x6f,0xff,0xff,0xee,0xf2,0x0e,0xff,0xff,0x06,0x43,
+0xe9,0x03,0x70,0x0f,0xd7,0x77,0x17,0x78,0xfd,0x77,0x50,0x1f,0x90,0x00,0x3f,0xb2,
+0x04,0xf1,0x05,0x3f,0xdb,0xbb,0x5f,0x71,0xfb,0x0f,0xb0,0x6f,0xff,0xff,0x5f,0xb8,
+0xfd,0x7f,0xb0,0x00,0x00,0xcf,0x4f,0xca,0x04,0xf5,0x10,0x00,0xef,0x00,0x01,0xfb,
+0x5d,0x30,0x00,0x01,0xfd,0x00,0x01,0xfb,0x6f,0xb0,0x03,0xbd,0xf9,0x9d,0xee,0xff,
+0xff,0xf3,0x01,0xff,0xc2,0xaf,0xed,0xb9,0x89,0xe5,0x7d,0x00,0xf2,0x1b,0x10,0x00,
+0xff,0x00,0x04,0x10,0x1e,0xd0,0x00,0xff,0x00,0x1f,0xf2,0x0b,0xf8,0x00,0xff,0x00,
+0x6f,0xc0,0x02,0xfe,0x00,0xff,0x00,0xdf,0x40,0x00,0xcf,0x30,0xff,0x04,0xfb,0x00,
+0x00,0x31,0x01,0xff,0x10,0x32,0x00,0x0e,0xab,0x04,0x82,0x0c,0xdd,0xdd,0xdd,0xdd,
+0xdf,0xf1,0x00,0x26,0x08,0x10,0x04,0x1e,0x04,0x32,0xcf,0xf1,0x05,0x1c,0x00,0x03,
+0x15,0x00,0x03,0x07,0x00,0x12,0x4f,0x15,0x00,0x17,0x3d,0x31,0x00,0x40,0x00,0x47,
+0x10,0x6f,0x66,0x01,0xf1,0x03,0x04,0xff,0x40,0x4c,0xff,0xcd,0xfe,0xc0,0x6f,0xf5,
+0x00,0x00,0xce,0x03,0xfa,0x0c,0xff,0x50,0x08,0x00,0x20,0x06,0xc2,0x5a,0x06,0x00,
+0xfe,0x00,0xb0,0x5f,0x80,0x69,0xef,0x9b,0xfd,0x91,0x05,0xfe,0x20,0xaf,0x5e,0x01,
+0x80,0x9f,0xe3,0x00,0x12,0xee,0x25,0xfb,0x2b,0x93,0x07,0x90,0xfd,0x03,0xfa,0x01,
+0x70,0x0b,0x91,0x03,0xfa,0x28,0x00,0xfb,0x10,0x9f,0xc0,0x07,0xf7,0x03,0xfa,0x00,
+0x09,0xfe,0x10,0x0d,0xf2,0x03,0xfa,0x04,0xdf,0xe2,0x00,0x9f,0xb0,0x03,0xfa,0x7f,
+0xfa,0x10,0x00,0x3d,0x10,0x03,0xfa,0x1b,0x9c,0x06,0x00,0x08,0x07,0x20,0x05,0xff,
+0xd1,0x08,0xa1,0x8f,0x90,0x05,0xfa,0x55,0x5b,0xf5,0x06,0xfe,0x20,0x10,0x00,0x30,
+0x9f,0xf3,0x00,0x10,0x00,0xf0,0x43,0xf9,0xfe,0x30,0x00,0x04,0xcc,0xdf,0xdc,0xc4,
+0x41,0x08,0x60,0x08,0x88,0xdf,0xb8,0x88,0x00,0xaf,0xc0,0x0a,0xaa,0xaa,0xaa,0xa9,
+0x4d,0xfc,0x00,0x01,0xee,0xee,0xee,0xe5,0xff,0x90,0x00,0x01,0xfc,0x55,0x5d,0xf1,
+0x75,0x01,0x20,0x01,0xfc,0x66,0x6d,0xf1,0x00,0x0c,0xf4,0x01,0xfd,0xef,0xed,0xd1,
+0x00,0xbf,0x90,0x04,0xfa,0x8f,0x7f,0x70,0x5e,0xfb,0x00,0x0d,0xf8,0xcf,0x59,0xfa,
+0xff,0x80,0x00,0x01,0x38,0xfc,0x11,0x31,0xb3,0xd6,0x02,0x40,0xa3,0x00,0x05,0xf8,
+0x2c,0x09,0x11,0xf4,0x08,0x00,0xc0,0x02,0xdf,0x70,0x7b,0xbd,0xfe,0xbb,0xb0,0x1e,
+0xf8,0x00,0xaf,0x0b,0x01,0x32,0x0b,0x61,0xd8,0x20,0x00,0xa1,0x0c,0xfd,0xaa,0xac,
+0xfd,0xaa,0xa8,0x00,0xaf,0xd8,0x72,0x04,0x10,0x1c,0xc4,0x01,0xf1,0x00,0x03,0xfb,
+0x00,0x3f,0xff,0xb4,0xaa,0xaa,0xab,0xfe,0xa6,0x09,0x3f,0xb5,0xff,0x3b,0x08,0x60,
+0x1f,0xb0,0x2a,0x60,0x03,0xfb,0x47,0x04,0x31,0x1e,0xf3,0x02,0x08,0x00,0x22,0x04,
+0xfa,0x08,0x00,0x42,0x00,0x33,0xcd,0xfa,0x5f,0x04,0x27,0xff,0xc3,0x89,0x09,0x31,
+0x00,0x00,0x21,0xcf,0x03,0x41,0xb0,0x01,0xef,0x30,0xd3,0x06,0xf5,0x56,0x2e,0xf5,
+0x08,0xb3,0x00,0x5f,0xe2,0x06,0xff,0xb7,0xbf,0xb1,0x00,0x2c,0x2a,0xb5,0xff,0xff,
+0xf7,0x51,0x00,0x00,0x6f,0xa0,0x39,0xfa,0x13,0xfc,0x00,0x05,0xff,0x1a,0xff,0xfe,
+0xff,0xff,0x80,0x6f,0xff,0x19,0xdd,0xfe,0x76,0x5c,0xf1,0x7f,0xff,0x10,0x1d,0xfa,
+0x44,0x45,0x40,0x06,0xbf,0x12,0xcf,0xff,0xff,0xfb,0x00,0x00,0xbf,0x4f,0xff,0xc2,
+0x4e,0xf3,0x00,0x00,0xbf,0x18,0x57,0xfc,0xdf,0x60,0x00,0x00,0xbf,0x10,0x04,0xef,
+0xfd,0x30,0x00,0x00,0xbf,0x4b,0xff,0xfa,0xbf,0xfe,0xa2,0x00,0xbf,0x2d,0xb7,0x10,
+0x02,0x8c,0xb0,0x80,0x00,0x31,0x05,0x10,0x26,0x57,0x05,0x40,0x8f,0x90,0x9f,0x80,
+0xcf,0x07,0x21,0xfc,0x01,0x8b,0x07,0xf0,0x0c,0x7f,0xc1,0x0b,0xfa,0x77,0x77,0x77,
+0x70,0x2b,0x1c,0xdf,0xfc,0xcc,0xcc,0xcc,0x00,0x00,0x8f,0x94,0xbf,0x65,0x55,0xcf,
+0x10,0x06,0xff,0x20,0x2d,0x07,0xc1,0x10,0x7f,0xff,0x10,0x9f,0x54,0x44,0xcf,0x10,
+0x9f,0xef,0x10,0x10,0x00,0xc1,0x15,0xaf,0x10,0x0a,0xfa,0x22,0x22,0x00,0x00,0xaf,
+0x10,0x8f,0x4e,0x09,0xb0,0xaf,0x2c,0xff,0xe6,0x5d,0xf7,0x00,0x00,0xaf,0x16,0x63,
+0x99,0x06,0xf0,0x07,0x00,0xaf,0x29,0xcf,0xff,0xff,0xfc,0xa2,0x00,0xaf,0x1c,0xc9,
+0x50,0x05,0x9c,0xa0,0x00,0x29,0x20,0x2f,0x10,0x0b,0x36,0x05,0xf0,0x11,0x50,0x3f,
+0x10,0x0f,0xd0,0x00,0x09,0xfa,0x2f,0x4f,0x4f,0x2f,0xa0,0x00,0x6f,0xc1,0x2f,0x4f,
+0x4f,0x5f,0xa4,0x41,0x1c,0x3e,0xbf,0xaf,0xaf,0xaf,0xff,0xf7,0x00,0xaf,0x5f,0x00,
+0xc0,0x5d,0xe2,0x05,0xff,0x13,0x33,0x36,0xff,0x1e,0xb0,0x4f,0xfe,0xb8,0x02,0xf0,
+0x11,0x6f,0x80,0x7f,0xfe,0x16,0x77,0x76,0x3e,0xcf,0x50,0x06,0xce,0x0a,0xff,0xf8,
+0x0a,0xff,0x10,0x00,0xce,0x0a,0xe3,0xf8,0x26,0xfb,0x00,0x00,0xce,0x0c,0xc0,0xff,
+0xd8,0x08,0x00,0xf7,0x07,0x0f,0xa3,0xfc,0x8f,0xff,0x70,0x00,0xce,0x8f,0x50,0x68,
+0xfd,0x1c,0xf6,0x00,0xce,0x19,0x00,0x04,0xb1,0x01,0xa0,0x6c,0x02,0x03,0xe5,0x03,
+0x50,0x0c,0xfd,0x30,0x00,0xa5,0x03,0x05,0x40,0xbf,0xf6,0x07,0xfd,0x18,0x00,0xf0,
+0x32,0x28,0xf8,0x2f,0xf5,0x00,0x00,0x41,0x4f,0xc0,0x30,0xbf,0xb0,0x00,0x00,0xfe,
+0x4f,0xc0,0x06,0xfe,0x22,0x00,0x04,0xfa,0x4f,0xc0,0x5f,0xf7,0xfc,0x00,0x08,0xf7,
+0x4f,0xc3,0xff,0x70,0xdf,0x50,0x0e,0xf2,0x4f,0xee,0xf9,0x00,0x4f,0xe0,0x4f,0xb0,
+0x4f,0xff,0x90,0x00,0x0d,0xf4,0x03,0x30,0x8f,0xf8,0x00,0x05,0x17,0xe5,0x00,0x2c,
+0xff,0xc0,0x64,0x03,0x40,0x19,0xff,0xef,0xd0,0x45,0x0b,0xe1,0x1e,0xe6,0x1f,0xff,
+0xee,0xff,0x90,0x00,0x02,0x10,0x07,0xef,0xff,0xfb,0xd1,0x04,0x23,0x01,0x72,0xfa,
+0x01,0x10,0xfc,0x06,0x00,0x75,0xcc,0xcc,0xcc,0xff,0xcc,0xcc,0xc5,0x4a,0x07,0x40,
+0xfe,0x00,0x02,0xc6,0x18,0x00,0x51,0xfe,0x00,0x07,0xff,0xc2,0x08,0x00,0xb0,0x00,
+0x2b,0xfe,0x10,0x00,0x00,0xfd,0x00,0x0e,0xd0,0x73,0xa9,0x05,0xf7,0x26,0x38,0x2f,
+0xe0,0x00,0x9e,0x10,0x02,0xfb,0x6f,0x5f,0xe0,0x00,0x8f,0x70,0x04,0xf9,0x8f,0x3f,
+0xe0,0x01,0x2f,0xe0,0x07,0xf6,0xdf,0x1f,0xe0,0x0a,0xcb,0xf5,0x0c,0xf6,0xfc,0x0f,
+0xe0,0x0b,0xe6,0xfa,0x2f,0xe1,0x86,0x0e,0xfb,0xbf,0xb2,0xa3,0x2c,0x80,0x00,0x06,
+0xef,0xfe,0x30,0x64,0x03,0x23,0x3a,0x60,0x40,0x07,0x20,0xd8,0x88,0x9f,0x0a,0x12,
+0x2d,0x00,0x08,0x93,0x07,0xff,0xb0,0x00,0x5f,0xb0,0x00,0x00,0x2e,0x2b,0x04,0xf0,
+0x0a,0x02,0x69,0x99,0x99,0x99,0x9e,0xf1,0x00,0x00,0x1a,0xaa,0xaa,0xaa,0xae,0xf1,
+0x00,0x00,0x1b,0xbb,0xbb,0xbb,0xbf,0xf1,0x00,0x00,0xb9,0x07,0x54,0x7e,0xf1,0x00,
+0x00,0xbf,0x53,0x04,0xf1,0x1b,0x11,0x3e,0xa0,0x00,0x46,0x00,0x07,0xe5,0xff,0x0c,
+0xf7,0x00,0xef,0x30,0x0d,0xf4,0xff,0x01,0xd6,0x8c,0x8f,0xb0,0x6f,0xc0,0xdf,0xca,
+0xab,0xff,0x1f,0xf1,0x06,0x30,0x5d,0xff,0xff,0xe7,0x05,0x20,0x00,0xaf,0x00,0x00,
+0xd7,0x0c,0xa0,0xaf,0x06,0xbb,0xbf,0xfb,0xbb,0xa0,0x00,0xaf,0x38,0x83,0x08,0xc1,
+0xd0,0x03,0xbf,0xf5,0x55,0x5e,0xf5,0x55,0x20,0x1f,0xef,0xcd,0xc2,0x08,0xb1,0x3f,
+0xdf,0x59,0x55,0x5e,0xf6,0x55,0x52,0x6f,0xbf,0x1f,0x10,0x01,0xa1,0x9d,0xaf,0x00,
+0x66,0x66,0x66,0x66,0x20,0x02,0xaf,0x22,0x01,0xaf,0x50,0x00,0xaf,0x00,0xfd,0x44,
+0x44,0x9f,0x50,0x00,0x10,0x00,0x07,0x51,0xfc,0x00,0x29,0xcf,0x40,0x08,0x00,0x61,
+0x0e,0xea,0x00,0x00,0x07,0xf5,0xf7,0x00,0x00,0x08,0x00,0x10,0xcf,0x79,0x05,0xf1,
+0x04,0x07,0xf6,0x00,0xcf,0x77,0x8f,0xb0,0x1f,0xff,0xff,0xf9,0xcf,0x44,0x5f,0xb0,
+0x08,0x9f,0xfb,0x85,0x18,0x00,0xb0,0x5f,0xfd,0x30,0xcf,0x33,0x4f,0xb0,0x01,0xef,
+0xff,0xf7,0x10,0x00,0xf0,0x05,0x2d,0xfa,0xf6,0xc6,0xcf,0x66,0x7f,0xb0,0x1e,0x77,
+0xf5,0x10,0xcf,0x88,0x9f,0xb0,0x01,0x04,0x93,0x03,0x18,0x00,0xf9,0x17,0x01,0xb2,
+0x46,0x3f,0xd2,0x00,0x9f,0x20,0x06,0xf8,0xaf,0x26,0xfc,0x22,0x7f,0xb0,0x0d,0xf3,
+0xaf,0x30,0x51,0x6f,0x6e,0xf4,0x2e,0xc0,0x9f,0xdb,0xab,0xff,0x26,0xd4,0x00,0x20,
+0x2c,0xff,0xff,0xe8,0xd5,0x04,0x35,0x0d,0xe0,0x00,0xaa,0x08,0xf3,0x03,0x10,0x00,
+0x77,0xcf,0x77,0x77,0xfd,0x77,0x00,0x04,0x44,0xcf,0x74,0x47,0xfd,0x44,0x40,0x0e,
+0xf3,0x0d,0x21,0x04,0x55,0x01,0x00,0x33,0x50,0x00,0x1f,0x5b,0x0d,0x7f,0x1f,0xc4,
+0x44,0x44,0x4c,0xf3,0x00,0x10,0x00,0x06,0xf3,0x13,0x77,0x4a,0x8e,0xe7,0x01,0x97,
+0x00,0x02,0xfd,0x6f,0x70,0x93,0x85,0xcf,0x40,0x1e,0xf4,0x5f,0xc8,0x89,0xfb,0x2f,
+0xd0,0x05,0x60,0x0b,0xff,0xff,0xe4,0x04,0x10,0x00,0x02,0x00,0x61,0x0e,0xf0,0x07,
+0xd0,0x10,0x2f,0x90,0x26,0x00,0x01,0xdf,0x4a,0xe2,0x2f,0xcb,0xff,0x60,0x3e,0xf9,
+0x4a,0xfc,0x2f,0xfe,0xa4,0x00,0x46,0x03,0xf8,0x4d,0x7f,0xa0,0x0b,0x90,0x08,0x98,
+0x77,0x7a,0x0f,0xfe,0xef,0xa0,0x09,0xfd,0xcc,0xfc,0x07,0xba,0xa8,0x10,0x09,0xfd,
+0xdd,0xfc,0x2f,0xa3,0x8d,0x40,0x09,0xf6,0x55,0xfc,0x2f,0xff,0xfa,0x30,0x09,0xff,
+0xff,0xfc,0x2f,0xc3,0x08,0x70,0x09,0xf1,0x14,0xfc,0x1f,0xd7,0x7e,0xd0,0x09,0xf1,
+0x1f,0xe9,0x3a,0xff,0xff,0x60,0x06,0x82,0xa8,0x0d,0xf3,0x00,0x5b,0x30,0x0e,0xf2,
+0xfc,0x02,0xb2,0xab,0x5f,0xb0,0x8f,0x90,0xff,0x88,0x89,0xfc,0x0e,0xf2,0x06,0x00,
+0x7e,0xff,0xff,0xd4,0x04,0x30,0x01,0x01,0x32,0x9f,0x68,0xc2,0x08,0x00,0x12,0x7c,
+0x89,0x02,0x43,0x9f,0x71,0xaf,0x40,0xf0,0x02,0xf7,0x4c,0xf7,0x00,0xff,0xdd,0xdd,
+0xef,0xed,0xdd,0xd6,0x00,0xff,0x00,0x00,0x5f,0x90,0x35,0x10,0x00,0xff,0xaa,0xa9,
+0x3f,0xb0,0xbf,0x60,0x00,0xff,0xff,0xfe,0x1f,0xe2,0xff,0x00,0x01,0xfe,0x00,0xfd,
+0x0e,0xfa,0xf9,0x00,0x02,0xfc,0x00,0xfd,0x0b,0xff,0xf2,0x00,0x03,0xfb,0x01,0xfc,
+0x07,0xff,0x70,0x30,0x06,0xf9,0xac,0xfa,0x0b,0xff,0x00,0xf6,0x0b,0xf5,0xbf,0xf6,
+0xcf,0xff,0x84,0xf7,0x2f,0xf1,0x01,0x4f,0xfc,0x5f,0xff,0xf3,0x0a,0xa0,0x00,0x0a,
+0x80,0x04,0xdf,0x90,0x00,0x10,0xea,0x03,0x71,0x47,0xa1,0x00,0x00,0x79,0xab,0xce,
+0x20,0x05,0xc3,0xdf,0xff,0xff,0xfb,0x85,0x20,0x00,0x00,0x22,0x10,0x0b,0xf3,0x01,
+0x04,0x16,0xf4,0xca,0x0a,0x80,0x90,0x00,0xcc,0xcc,0xcf,0xfd,0xcc,0xcc,0x1a,0x03,
+0x01,0x20,0x00,0x83,0x02,0x22,0x22,0x2c,0xf5,0x22,0x22,0x21,0x2a,0x0b,0x94,0xf8,
+0x0b,0xbb,0xbb,0xbe,0xfc,0xbb,0xbb,0xb6,0x20,0x00,0x00,0x40,0x00,0x02,0x08,0x00,
+0x13,0xcd,0x45,0x07,0x20,0x9f,0xfd,0x3d,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x41,0x00,0x0f,0xd0,0x00,0x01,0x00,0x70,0x0f,0xd0,0x09,0xff,0xff,0xff,
+0xf1,0x08,0x00,0xf0,0x01,0xfd,0xcc,0xcf,0xf1,0x1b,0xbf,0xfb,0x89,0xf3,0x00,0x0d,
+0xf1,0x1f,0xff,0xff,0xc9,0x08,0x00,0x00,0x18,0x00,0x04,0x08,0x00,0x80,0xfc,0xbb,
+0xbf,0xf1,0x00,0x0f,0xe9,0x9a,0x30,0x00,0xf0,0x00,0x3d,0xff,0xff,0xdb,0xf3,0x7f,
+0x80,0x00,0x1f,0xcf,0xe3,0x0d,0xf1,0x2f,0xe0,0x48,0x00,0x40,0x0f,0xe0,0x0e,0xf4,
+0x08,0x00,0x40,0x5f,0xa0,0x07,0xfc,0x08,0x00,0xf4,0x07,0xdf,0x40,0x01,0xef,0x90,
+0x0a,0xcf,0xc7,0xfd,0x00,0x00,0x4f,0xf9,0x0a,0xfd,0x40,0xb3,0x00,0x00,0x04,0xc0,
+0x00,0x01,0x00,0x24,0x6f,0x60,0x08,0x00,0x10,0x9f,0x80,0x00,0x00,0x08,0x00,0xf1,
+0x00,0xdc,0xfe,0xbf,0xf1,0x2b,0xdf,0xdb,0x9f,0x51,0xfb,0x0d,0xf1,0x2f,0xff,0xfe,
+0x08,0x00,0x35,0x16,0xaf,0xa6,0x20,0x00,0x71,0xcb,0xfe,0xaf,0xf1,0x00,0x6f,0x96,
+0x18,0x00,0x31,0x2a,0xef,0xfe,0x30,0x00,0x31,0x1f,0xff,0xa3,0x20,0x00,0x80,0x01,
+0x7f,0x60,0x36,0x21,0xfb,0x05,0x50,0x58,0x00,0x44,0x01,0xfb,0x00,0x00,0x08,0x00,
+0x31,0x0a,0xdf,0x50,0x08,0x00,0x32,0x0b,0xfb,0x10,0x18,0x00,0x00,0x01,0x00,0x10,
+0x21,0x20,0x00,0x13,0x70,0x80,0x00,0x60,0x70,0x8f,0xff,0xff,0xff,0xe0,0x08,0x00,
+0x80,0xed,0xdd,0xdd,0xc0,0x39,0xcf,0xc9,0x8f,0x9a,0x00,0x40,0x5f,0xff,0xff,0x8f,
+0x22,0x00,0x30,0x25,0x9f,0xa5,0x20,0x00,0x10,0x10,0x20,0x00,0xf1,0x08,0xdb,0xbb,
+0xef,0x10,0x00,0x6f,0xb9,0x8f,0x60,0x00,0xaf,0x10,0x4a,0xef,0xff,0x9f,0x70,0x00,
+0xbf,0x10,0x4f,0xff,0xa2,0x20,0x00,0x11,0x03,0x20,0x00,0x11,0xbb,0x50,0x00,0x13,
+0x60,0x58,0x00,0x00,0x40,0x00,0x30,0x1b,0xdf,0x60,0x20,0x00,0xac,0xf6,0x0d,0xfb,
+0x10,0x6c,0xcc,0xcc,0xcc,0xc5,0x00,0x01,0x00,0x52,0x7f,0x40,0x00,0x05,0xd4,0x08,
+0x00,0x21,0x04,0xfb,0x08,0x00,0xf1,0x04,0x8c,0xcc,0xff,0xcc,0xc2,0x1b,0xdf,0xc8,
+0xaf,0xff,0xff,0xff,0xf3,0x2f,0xff,0xfb,0xaf,0x20,0x34,0x18,0x00,0x40,0xaf,0x10,
+0xaf,0x40,0x08,0x00,0x30,0xbf,0x10,0xef,0x10,0x00,0xf0,0x06,0xc8,0xcf,0x02,0xfb,
+0x00,0x00,0x3d,0xff,0xfa,0xdf,0x07,0xf6,0x22,0x00,0x2f,0xef,0x50,0xed,0x0c,0xf2,
+0xfb,0x20,0x00,0xf5,0x16,0xfb,0x2f,0xb0,0x9f,0x20,0x00,0x7f,0x44,0xf8,0x8f,0x50,
+0x3f,0x80,0x00,0x7f,0x4a,0xf7,0xff,0x78,0x9f,0xe0,0x0b,0xef,0x5f,0xd4,0xff,0xff,
+0xff,0xf4,0x0a,0xe9,0x08,0x60,0xa7,0x53,0x13,0xd4,0x80,0x00,0x53,0x5f,0x60,0x00,
+0x00,0xeb,0x08,0x00,0x11,0xfc,0x08,0x00,0xf1,0x01,0x3b,0xbb,0xff,0xbb,0xb0,0x18,
+0xbf,0xb6,0x4f,0xff,0xff,0xff,0xf0,0x2f,0xff,0xfb,0x18,0x00,0xf0,0x20,0x02,0x7f,
+0x72,0xaa,0xab,0xfe,0xaa,0xa7,0x00,0x5f,0x60,0xff,0xff,0xff,0xff,0xfb,0x00,0x5f,
+0xb8,0x00,0x00,0x00,0xfd,0x00,0x3b,0xff,0xfc,0x9a,0xaa,0xaa,0xff,0xa6,0x2f,0xff,
+0x80,0xdf,0xff,0xff,0xff,0xf9,0x02,0x5f,0x60,0x06,0xb1,0x00,0xfd,0x48,0x00,0x22,
+0x08,0xf9,0x08,0x00,0xe0,0x00,0xdf,0x10,0xfd,0x00,0x0a,0xef,0x50,0x00,0x32,0xab,
+0xfc,0x00,0x09,0xe4,0x00,0x26,0xbf,0xe5,0x00,0x01,0xf0,0x13,0x3f,0x90,0x00,0x12,
+0x46,0x8b,0x30,0x00,0x3f,0x90,0xaf,0xff,0xff,0xfe,0x90,0x00,0x3f,0x90,0x37,0x66,
+0xfb,0x10,0x00,0x1c,0xdf,0xea,0xbb,0xbc,0xfe,0xbb,0xb5,0x1f,0xff,0xfd,0x70,0x00,
+0xd1,0xf7,0x01,0x5f,0xa1,0x11,0x12,0xfb,0x11,0x10,0x00,0x3f,0x90,0x8f,0x10,0x02,
+0xf1,0x03,0x3f,0xc7,0x9f,0xa9,0xfd,0x8e,0xf1,0x29,0xdf,0xff,0x9f,0x98,0xfd,0x8d,
+0xf1,0x3f,0xff,0xb2,0x08,0x02,0xc2,0x04,0x4f,0x90,0x9f,0x31,0xfb,0x0b,0xf1,0x00,
+0x3f,0x90,0x9f,0x28,0x00,0x11,0x90,0x20,0x00,0xe6,0x0b,0xef,0x80,0x01,0x01,0xfa,
+0x00,0x00,0x09,0xfc,0x20,0x00,0x01,0xfa,0x80,0x01,0x00,0xdc,0x00,0x22,0x19,0x80,
+0x08,0x00,0x20,0x0e,0xf2,0x08,0x00,0x10,0x01,0x70,0x00,0xf0,0x0e,0xb0,0x47,0xfe,
 0x71,0x8c,0xd8,0x8b,0xe9,0x60,0x9f,0xff,0xf1,0x0b,0xf2,0x0d,0xf2,0x00,0x12,0xfd,
-0x25,0x9b,0xfa,0xaf,0xd9,0x90,0x00,0xfc,0x08,0x13,0x10,0xf2,0x03,0xfe,0xa0,0x00,
-0x7f,0x60,0x00,0x00,0x8e,0xff,0xf8,0x88,0xef,0x98,0x88,0x82,0x9f,0xfd,0x1c,0xcf,
-0x3c,0x60,0xfc,0x00,0x3f,0xd1,0x0b,0xf4,0x50,0x00,0x20,0xbf,0xfa,0x62,0x61,0x10,
-0xfc,0x78,0x6c,0xf6,0x03,0xa1,0x00,0x4c,0xfb,0x09,0xbe,0xff,0xbd,0xff,0x70,0x2f,
-0xd4,0x09,0xeb,0x71,0x00,0x6e,0x40,0x00,0x02,0x50,0x50,0x00,0xc7,0x29,0x30,0x08,
-0x00,0x40,0x06,0xfb,0x5f,0xa0,0x08,0x00,0xf1,0x02,0x0c,0xf5,0x0e,0xf0,0x00,0x29,
-0xcf,0xb8,0x3f,0xfd,0xce,0xec,0xc2,0x4f,0xff,0xfe,0xbf,0x53,0x15,0x40,0x9f,0x78,
-0xff,0xe0,0xa4,0x09,0xb0,0x7f,0x7f,0xff,0xf9,0xaf,0xe9,0x90,0x00,0x7f,0xae,0x8e,
-0x88,0x00,0x40,0x3b,0xff,0xfc,0x0e,0x18,0x00,0xc1,0x3f,0xff,0x70,0x0e,0xfa,0xaf,
-0xea,0xa0,0x01,0x7f,0x50,0x0e,0xa0,0x00,0x31,0x7f,0x50,0x0e,0x30,0x00,0xb1,0x8f,
-0x50,0x0e,0xe1,0x2f,0xb1,0x10,0x0d,0xff,0x40,0x0e,0x28,0x04,0x40,0xea,0x00,0x0e,
-0xfa,0x76,0x33,0x04,0xf6,0x16,0x60,0xdd,0x00,0x2b,0x50,0x00,0xda,0x08,0x00,0x40,
-0x1f,0xe0,0x05,0xfa,0x08,0x00,0xf1,0x01,0x09,0xf4,0x0b,0xf3,0x00,0x37,0xee,0x78,
-0xbc,0xeb,0xbf,0xfb,0xb4,0x7f,0xff,0xfb,0xc3,0x14,0x50,0x24,0xee,0x42,0x55,0x55,
-0xa0,0x34,0xf0,0x0d,0xdd,0x06,0xff,0xff,0x2f,0x5c,0xe0,0x00,0xdf,0xb7,0xf2,0x8f,
+0x25,0x9b,0xfa,0xaf,0xd9,0x90,0x00,0xfc,0x08,0xff,0x18,0x01,0xf0,0x05,0x00,0xfe,
+0xa0,0x00,0x7f,0x60,0x00,0x00,0x8e,0xff,0xf8,0x88,0xef,0x98,0x88,0x82,0x9f,0xfd,
+0x1c,0xff,0x60,0x01,0x70,0x10,0xfc,0x00,0x3f,0xd1,0x0b,0xf4,0x50,0x00,0x40,0xbf,
+0xfa,0x8f,0xb0,0x08,0x00,0xf6,0x06,0x03,0xbf,0xff,0xa1,0x00,0x4c,0xfb,0x09,0xbe,
+0xff,0xbd,0xff,0x70,0x2f,0xd4,0x09,0xeb,0x71,0x00,0x6e,0x40,0x00,0x02,0x50,0x50,
+0x00,0xc7,0x29,0x30,0x08,0x00,0x40,0x06,0xfb,0x5f,0xa0,0x08,0x00,0xf0,0x02,0x0c,
+0xf5,0x0e,0xf0,0x00,0x29,0xcf,0xb8,0x3f,0xfd,0xce,0xec,0xc2,0x4f,0xff,0xfe,0xbf,
+0x08,0x02,0xf0,0x05,0x02,0x9f,0x78,0xff,0xe0,0x1f,0xb0,0x00,0x00,0x7f,0x7f,0xff,
+0xf9,0xaf,0xe9,0x90,0x00,0x7f,0xae,0x8e,0x88,0x00,0x40,0x3b,0xff,0xfc,0x0e,0x18,
+0x00,0xc1,0x3f,0xff,0x70,0x0e,0xfa,0xaf,0xea,0xa0,0x01,0x7f,0x50,0x0e,0xa0,0x00,
+0x31,0x7f,0x50,0x0e,0x30,0x00,0xa0,0x8f,0x50,0x0e,0xe1,0x2f,0xb1,0x10,0x0d,0xff,
+0x40,0x18,0x00,0xe0,0xf8,0x0b,0xea,0x00,0x0e,0xfa,0xaa,0xaa,0xa5,0x00,0x00,0x00,
+0x01,0x10,0x80,0x00,0x60,0xdd,0x00,0x2b,0x50,0x00,0xda,0x08,0x00,0x40,0x1f,0xe0,
+0x05,0xfa,0x08,0x00,0xf0,0x01,0x09,0xf4,0x0b,0xf3,0x00,0x37,0xee,0x78,0xbc,0xeb,
+0xbf,0xfb,0xb4,0x7f,0xff,0xfb,0xd8,0x00,0xf0,0x17,0xf5,0x24,0xee,0x42,0x55,0x55,
+0x00,0x06,0x70,0x00,0xdd,0x06,0xff,0xff,0x2f,0x5c,0xe0,0x00,0xdf,0xb7,0xf2,0x8f,
 0x2f,0x5c,0xe0,0x6e,0xff,0xf9,0xfc,0xef,0x2f,0x5c,0xe0,0x6f,0xfe,0x16,0xf7,0xbf,
-0x18,0x00,0x33,0xdd,0x06,0xf6,0x08,0x00,0x22,0xfe,0xef,0x08,0x00,0xf6,0x05,0xf0,
+0x18,0x00,0x33,0xdd,0x06,0xf6,0x08,0x00,0x22,0xfe,0xef,0x08,0x00,0xf5,0x06,0xf0,
 0x7f,0x02,0x0c,0xe0,0x3b,0xfc,0x06,0xf5,0xcf,0x04,0x9f,0xd0,0x1f,0xd5,0x06,0xf5,
-0xe8,0x02,0xfe,0xa0,0x29,0x42,0xdc,0x00,0x00,0xda,0x08,0x00,0x40,0x06,0xfc,0x44,
-0x10,0x08,0x00,0x01,0x56,0x71,0xf2,0x04,0x37,0xee,0x70,0xbf,0x93,0x9f,0x60,0x00,
-0x6f,0xff,0xf9,0xff,0x99,0xff,0x98,0x50,0x25,0xed,0x53,0x08,0x05,0xf1,0x1b,0xdc,
-0x00,0x7f,0x0a,0x49,0x0f,0x90,0x00,0xdd,0x70,0x7f,0x7e,0x1f,0x5f,0x90,0x3a,0xff,
-0xf0,0x7f,0xe7,0x08,0xdf,0x90,0x7f,0xfe,0x40,0x7f,0x57,0xe4,0x4f,0x90,0x24,0xdc,
-0x07,0xcf,0x9d,0xfa,0x9f,0xd4,0x00,0xdc,0x0b,0xc8,0x05,0x00,0x60,0x00,0xf3,0x05,
-0x9f,0xdf,0x60,0x00,0x2c,0xfb,0x05,0x9e,0xf9,0x09,0xfd,0xa4,0x0e,0xd4,0x0d,0xea,
-0x30,0x00,0x4a,0xe2,0xb0,0x5e,0x00,0xf0,0x00,0x04,0x08,0x00,0x10,0x0f,0x71,0x08,
-0x00,0x08,0x00,0xf0,0x0d,0xc5,0x59,0xf6,0x00,0x5a,0xff,0xa0,0x0f,0xea,0xad,0xf6,
-0x00,0x8f,0xff,0xf1,0x08,0x88,0x88,0x83,0x00,0x00,0xdd,0x05,0xee,0xec,0x7e,0xee,
-0xd0,0xe0,0x00,0x20,0xcd,0x8f,0x00,0x01,0xf2,0x01,0xe6,0xf7,0xdd,0x8f,0x6c,0xe0,
-0x8e,0xff,0xe7,0xdd,0xdd,0xae,0xdd,0xc0,0x8f,0xfd,0x6a,0x72,0x32,0x12,0xdd,0x09,
-0xe2,0x0e,0x90,0xdd,0x05,0x99,0xff,0xff,0xa9,0x91,0x00,0xdd,0x38,0x3c,0xf7,0x03,
-0xe5,0x00,0x09,0xfc,0x5d,0xfe,0x5b,0xf3,0xdf,0xe2,0x0c,0xe5,0x1c,0x71,0x0b,0xf0,
-0x06,0x80,0xee,0x4a,0x00,0x76,0x55,0x00,0x3e,0x1a,0x30,0xf1,0x3f,0xd0,0x13,0x64,
-0x40,0x7e,0xf1,0x7f,0x90,0xdc,0x1c,0xa0,0x0c,0xf1,0xbf,0xdb,0xbb,0xb2,0x0b,0xff,
-0xff,0xf3,0x00,0x02,0x40,0x0b,0xf7,0x6e,0xfb,0x09,0x82,0x71,0x0b,0xf2,0x1c,0xff,
-0xff,0x43,0xfc,0x6e,0x1a,0x20,0xdf,0x96,0xc9,0x57,0x51,0x4d,0xf4,0x1f,0xec,0xf4,
-0x30,0x00,0x00,0x33,0x5f,0x00,0x48,0x00,0x00,0x4c,0x51,0x40,0x05,0xc8,0x7b,0x70,
-0xb3,0x45,0xf0,0x0c,0x03,0xfc,0x6f,0x80,0x6f,0xff,0xf7,0x00,0x0d,0xf4,0x0c,0xfc,
-0xff,0x77,0xff,0xc2,0x7f,0x90,0x04,0x9e,0xf6,0x00,0x6f,0xd0,0x05,0x00,0x00,0x8d,
-0x07,0x70,0x20,0x02,0x70,0xfb,0x27,0x11,0xd7,0x87,0x08,0xa0,0xfb,0x9f,0x35,0xf8,
-0x00,0x00,0x01,0xf6,0xfb,0xc8,0xb4,0x3d,0xf1,0x20,0x1d,0xed,0xff,0xdd,0xab,0xfc,
-0xbb,0xb5,0x0a,0xaf,0xff,0xea,0x8f,0xff,0xff,0xf7,0x02,0xbf,0xfe,0xfb,0x7f,0xf2,
-0x6f,0x60,0x2f,0xe5,0xfb,0x38,0xdf,0xf5,0x9f,0x30,0x06,0x15,0xa3,0x02,0xfa,0xf9,
-0xcf,0x00,0x06,0x7d,0xf8,0x77,0x52,0xbe,0xfb,0x2b,0x15,0x20,0x10,0x6f,0x6e,0x14,
-0x40,0x13,0xfb,0x00,0x2f,0xb7,0x2b,0x50,0xbd,0xf2,0x00,0xaf,0xf8,0xd9,0x00,0xf3,
-0x07,0xc1,0x09,0xfc,0xef,0x60,0x18,0xef,0xea,0xf7,0xdf,0xd1,0x3f,0xf8,0x0e,0xd7,
-0x00,0x13,0xf9,0x10,0x04,0xd2,0x01,0x6e,0x5b,0x00,0xea,0x0b,0x13,0x90,0xf3,0x18,
-0x13,0xf5,0xf0,0x39,0x10,0xfa,0xb1,0x18,0x75,0xdd,0xdd,0xde,0xfd,0xdd,0xdd,0xd6,
-0xee,0x2f,0x20,0x05,0xfa,0xf1,0x32,0x02,0x83,0x13,0x30,0xcf,0x50,0x00,0x1c,0x60,
-0x12,0x05,0x10,0x26,0x32,0xf8,0x1e,0xf5,0xe8,0x25,0x23,0xdf,0x90,0x08,0x40,0x03,
-0x01,0x14,0x01,0xcf,0x0c,0xf0,0x03,0x16,0xdf,0xf9,0x5e,0xff,0xa4,0x00,0x1b,0xff,
-0xfd,0x40,0x00,0x9f,0xff,0xe6,0x0b,0xfb,0x50,0x06,0x41,0x33,0xe1,0x01,0x10,0xc7,
-0x0e,0x21,0x04,0x80,0xed,0x0c,0x00,0x1a,0x10,0x50,0x03,0x6a,0xff,0x80,0x1f,0x59,
-0x17,0x80,0xff,0xc7,0x20,0x19,0xdb,0x9c,0xea,0x4f,0x78,0x6b,0x30,0xf8,0x0b,0xf1,
-0x7e,0x38,0x80,0x28,0xed,0x8f,0xe8,0x6f,0xb6,0x66,0x62,0x98,0x11,0x10,0x8f,0x29,
-0x02,0xe1,0x05,0xf6,0x00,0x4f,0xb6,0xff,0x62,0x29,0x9b,0xfc,0x99,0x5f,0x70,0xef,
-0x56,0x0f,0xf0,0x0a,0x5f,0x60,0xef,0x00,0x02,0x76,0xf7,0x81,0x6f,0x50,0xef,0x00,
-0x0b,0xe5,0xf7,0xea,0x9f,0x30,0xef,0x00,0x4f,0x64,0xf6,0x7d,0xef,0xeb,0x6a,0xe6,
-0x5b,0xf5,0x05,0xfb,0x00,0xef,0x00,0x00,0x5f,0xc1,0x01,0xb3,0x00,0xef,0x77,0x67,
-0x15,0x00,0xd6,0x0f,0x04,0x31,0x6c,0x27,0x09,0xf6,0x7e,0x34,0x11,0x1d,0x02,0x18,
-0x26,0xdd,0xd2,0x92,0x1a,0x04,0x8a,0x1a,0x12,0x5f,0x81,0x58,0x62,0x00,0x8f,0xec,
-0xcc,0xcd,0xf9,0x1a,0x4f,0x22,0x06,0xf8,0x65,0x50,0x22,0x08,0xf7,0xf0,0x4d,0x22,
-0x0b,0xf4,0xf1,0x4f,0x20,0x0f,0xf1,0x5c,0x49,0x93,0x07,0xdc,0xef,0xd0,0x00,0x09,
-0xd3,0x00,0x02,0xf2,0x4a,0x04,0x67,0x26,0xf1,0x05,0xe3,0xdd,0xdd,0xdd,0xc0,0x0b,
-0xfa,0x9e,0xe2,0xcc,0xdf,0xec,0xb0,0x0b,0xf1,0x0c,0xe0,0x34,0x3f,0x80,0xb7,0x68,
-0x30,0xce,0x3f,0x70,0x90,0x02,0x40,0xe0,0xfa,0x5f,0x50,0x60,0x02,0x90,0xe5,0xfb,
-0xaf,0xa7,0x70,0x0b,0xff,0xff,0xe6,0x58,0x05,0xc0,0x0b,0xfa,0x99,0x90,0x43,0xfe,
-0x22,0x20,0x0b,0xf1,0x2b,0x40,0xed,0x62,0x40,0x0b,0xf1,0x1f,0xb0,0x52,0x58,0xf4,
-0x11,0x0c,0xf7,0xcf,0xf2,0x3f,0xcd,0xa0,0x60,0x0e,0xff,0xfa,0xf7,0xdf,0x4d,0xa0,
-0xe4,0x2f,0xf9,0x10,0x4b,0xfa,0x0d,0xea,0xf2,0x07,0x20,0x00,0x0c,0xc0,0x07,0xef,
-0xa0,0xee,0x1c,0x11,0xbf,0xde,0x00,0x10,0xbf,0x1e,0x43,0x30,0xf2,0xbf,0x30,0x7c,
-0x05,0x09,0x06,0x00,0x11,0x40,0x06,0x00,0x02,0x24,0x00,0x4e,0xed,0xdd,0xdd,0xdf,
-0x24,0x00,0x04,0x18,0x00,0x02,0x24,0x00,0x13,0x40,0x29,0x14,0x80,0x03,0x33,0x33,
-0x33,0xdf,0xff,0xfa,0x0f,0x8e,0x21,0xc1,0xbc,0xfa,0x0f,0xf8,0x88,0xfe,0xde,0x01,
-0xfa,0x0f,0xe0,0x00,0x07,0x00,0x51,0xe2,0x22,0xfe,0xdf,0xab,0x1c,0x00,0x00,0x23,
-0x00,0x27,0xf9,0x99,0x1c,0x00,0x30,0x1f,0xe5,0x55,0x1c,0x00,0x12,0x3f,0x1c,0x00,
-0xc1,0x6f,0xa5,0x55,0xfe,0xde,0x00,0x00,0xcf,0x30,0x00,0xfe,0x22,0x51,0x14,0x10,
-0xfe,0x56,0x27,0x40,0x04,0xcd,0xfc,0x00,0x5a,0x41,0x28,0xff,0xd4,0x47,0x09,0x10,
-0xc0,0x9e,0x17,0x01,0x3f,0x06,0x30,0xff,0xff,0xf2,0x8d,0x00,0x40,0x0f,0xc0,0xbf,
-0x2b,0x42,0x07,0x30,0xfc,0x0b,0xf0,0x1e,0x00,0xb0,0x0f,0xc0,0xbf,0x9c,0xcd,0xff,
-0xcc,0xc5,0xff,0xff,0xfa,0x04,0x13,0x31,0x6f,0xe9,0xef,0x6d,0x06,0x30,0xfc,0x0b,
-0xf8,0xc2,0x29,0xe0,0x4f,0xc0,0xbf,0x8b,0xbb,0xbb,0xff,0xb3,0xfe,0x9e,0xf0,0x8e,
-0x20,0x0f,0x2c,0x68,0xc0,0x06,0xfd,0x00,0xfc,0x00,0xfd,0x11,0x10,0x0b,0xe3,0x0f,
-0xc0,0xc7,0x41,0x32,0x23,0xcc,0xfb,0xae,0x0b,0x17,0xfd,0x34,0x06,0x03,0x1d,0x15,
-0x6e,0x7f,0x95,0x55,0x55,0x5a,0xf6,0x10,0x00,0x60,0x5c,0xcc,0xcf,0xec,0xcc,0xc5,
-0x57,0x1f,0x64,0xaf,0xe8,0x88,0x88,0x80,0x1f,0xc7,0x16,0x10,0x07,0xa9,0x1e,0x20,
-0x71,0x00,0x7f,0x3c,0xa0,0xcc,0xcf,0xf2,0x00,0x00,0x1f,0xd5,0x55,0x55,0x5d,0x08,
-0x00,0x04,0x1e,0x1b,0xf4,0x07,0xe7,0x0e,0xf0,0x8a,0x50,0x00,0x2c,0xff,0xa7,0x7f,
-0xf0,0x6c,0xff,0x80,0x07,0x92,0x09,0xfe,0x80,0x00,0x3a,0x30,0x07,0x17,0x50,0x0a,
-0xaa,0xaa,0xaf,0xfb,0xa4,0x28,0x04,0x65,0x4b,0x13,0x9f,0xc7,0x1f,0xa3,0x9f,0x97,
-0x7e,0xf8,0x77,0xef,0x00,0x00,0x9f,0x87,0x08,0x00,0x04,0x18,0x00,0x10,0x30,0x2f,
-0x60,0x06,0x10,0x00,0x60,0x5c,0xd8,0xbf,0xe8,0x88,0x88,0xda,0x36,0x01,0xa3,0x6a,
-0x00,0x1c,0x26,0x10,0x63,0x7d,0x66,0xe4,0xdf,0xff,0xcf,0xff,0xff,0xee,0xe5,0x0a,
-0xfb,0x60,0x01,0x59,0xbc,0xef,0x14,0x72,0x06,0xd4,0x2a,0x13,0x8f,0xf4,0x46,0x74,
-0x01,0x11,0x1f,0xe1,0x19,0xf5,0x00,0x46,0x14,0x00,0x45,0x78,0x63,0xe5,0x5b,0xf9,
-0x50,0x00,0xbf,0x20,0x00,0x64,0x56,0x66,0x6f,0xe6,0x66,0x64,0x34,0x0b,0x30,0x00,
-0x18,0x88,0xd9,0x39,0x41,0x88,0x81,0x19,0x99,0x01,0x00,0x33,0x91,0x00,0x2f,0x28,
+0xe8,0x02,0xfe,0x60,0x00,0x01,0x42,0xdc,0x00,0x00,0xda,0x08,0x00,0x40,0x06,0xfc,
+0x44,0x10,0x08,0x00,0xf0,0x09,0x0d,0xff,0xff,0xd0,0x00,0x37,0xee,0x70,0xbf,0x93,
+0x9f,0x60,0x00,0x6f,0xff,0xf9,0xff,0x99,0xff,0x98,0x50,0x25,0xed,0x53,0x88,0x00,
+0xf1,0x1d,0x90,0x00,0xdc,0x00,0x7f,0x0a,0x49,0x0f,0x90,0x00,0xdd,0x70,0x7f,0x7e,
+0x1f,0x5f,0x90,0x3a,0xff,0xf0,0x7f,0xe7,0x08,0xdf,0x90,0x7f,0xfe,0x40,0x7f,0x57,
+0xe4,0x4f,0x90,0x24,0xdc,0x07,0xcf,0x9d,0xfa,0x9f,0xd4,0x00,0xdc,0x0b,0x38,0x02,
+0x00,0x60,0x00,0xf2,0x0a,0x9f,0xdf,0x60,0x00,0x2c,0xfb,0x05,0x9e,0xf9,0x09,0xfd,
+0xa4,0x0e,0xd4,0x0d,0xea,0x30,0x00,0x4a,0xe2,0x00,0x00,0x01,0x00,0x00,0x00,0x01,
+0x04,0x08,0x00,0x41,0x0f,0xff,0xff,0xf6,0x08,0x00,0xf0,0x0d,0xc5,0x59,0xf6,0x00,
+0x5a,0xff,0xa0,0x0f,0xea,0xad,0xf6,0x00,0x8f,0xff,0xf1,0x08,0x88,0x88,0x83,0x00,
+0x00,0xdd,0x05,0xee,0xec,0x7e,0xee,0xd0,0xe0,0x00,0x20,0xcd,0x8f,0x00,0x01,0xf0,
+0x0a,0xe6,0xf7,0xdd,0x8f,0x6c,0xe0,0x8e,0xff,0xe7,0xdd,0xdd,0xae,0xdd,0xc0,0x8f,
+0xfd,0x00,0x00,0x0b,0xf0,0x00,0x00,0x12,0xdd,0x09,0x78,0x00,0xf0,0x12,0xf2,0x00,
+0xdd,0x05,0x99,0xff,0xff,0xa9,0x91,0x00,0xdd,0x00,0x4d,0xff,0xff,0xe5,0x00,0x09,
+0xfc,0x5d,0xfe,0x5b,0xf3,0xdf,0xe2,0x0c,0xe5,0x1c,0x71,0x0b,0xf0,0x06,0x80,0x73,
+0x00,0x22,0x02,0x30,0x7b,0x00,0xf0,0x11,0x08,0x60,0x00,0x00,0x0b,0xff,0xff,0xf1,
+0x3f,0xd0,0x00,0x00,0x0b,0xf8,0x7e,0xf1,0x7f,0x90,0x00,0x00,0x0b,0xf1,0x0c,0xf1,
+0xbf,0xdb,0xbb,0xb2,0x0b,0xff,0xff,0xf3,0x00,0x02,0xf0,0x01,0x0b,0xf7,0x6e,0xfb,
+0xff,0x12,0xff,0x10,0x0b,0xf2,0x1c,0xff,0xff,0x43,0xfc,0x00,0xde,0x00,0xb1,0xdf,
+0x96,0xf8,0x00,0x0b,0xf5,0x4d,0xf4,0x1f,0xec,0xf4,0x30,0x00,0x31,0x0b,0xff,0xe0,
+0x48,0x00,0xf0,0x66,0x05,0xff,0x80,0x00,0x05,0xc8,0x7b,0x70,0x06,0xff,0x80,0x00,
+0x03,0xfc,0x6f,0x80,0x6f,0xff,0xf7,0x00,0x0d,0xf4,0x0c,0xfc,0xff,0x77,0xff,0xc2,
+0x7f,0x90,0x04,0x9e,0xf6,0x00,0x6f,0xd0,0x05,0x00,0x00,0x04,0x10,0x00,0x02,0x20,
+0x02,0x70,0xfb,0x27,0x11,0xd7,0x00,0x00,0x07,0xf5,0xfb,0x9f,0x35,0xf8,0x00,0x00,
+0x01,0xf6,0xfb,0xc8,0x08,0xf5,0x00,0x00,0x1d,0xed,0xff,0xdd,0xab,0xfc,0xbb,0xb5,
+0x0a,0xaf,0xff,0xea,0x8f,0xff,0xff,0xf7,0x02,0xbf,0xfe,0xfb,0x7f,0xf2,0x6f,0x60,
+0x2f,0xe5,0xfb,0x38,0xdf,0xf5,0x9f,0x30,0x06,0x15,0xa3,0x02,0xfa,0xf9,0xcf,0x00,
+0x06,0x7d,0xf8,0x77,0x52,0xbe,0xfb,0x00,0x0c,0x05,0x05,0xf0,0x03,0x6f,0xf5,0x00,
+0x00,0xdf,0x13,0xfb,0x00,0x2f,0xf1,0x00,0x03,0xef,0xbd,0xf2,0x00,0xaf,0xf8,0xd9,
+0x00,0xf0,0x06,0xc1,0x09,0xfc,0xef,0x60,0x18,0xef,0xea,0xf7,0xdf,0xd1,0x3f,0xf8,
+0x0e,0xd7,0x00,0x13,0xf9,0x10,0x04,0xd2,0x7e,0x01,0x12,0x20,0xff,0x00,0x22,0x05,
+0x90,0x08,0x00,0x22,0x0e,0xf5,0x08,0x00,0x10,0x09,0x9f,0x03,0xb2,0x1d,0xdd,0xdd,
+0xde,0xfd,0xdd,0xdd,0xd6,0x1f,0xff,0xff,0xc8,0x01,0x00,0x9c,0x02,0x10,0x5f,0x3f,
+0x06,0x50,0xdf,0x30,0x00,0xcf,0x50,0x61,0x05,0x30,0xc0,0x05,0xfd,0x2f,0x00,0x41,
+0x0c,0xf8,0x1e,0xf5,0x4e,0x01,0x32,0xff,0xdf,0x90,0xd2,0x05,0x11,0xfe,0x07,0x00,
+0xf2,0x0f,0x07,0xff,0xff,0xc3,0x00,0x00,0x00,0x16,0xdf,0xf9,0x5e,0xff,0xa4,0x00,
+0x1b,0xff,0xfd,0x40,0x00,0x9f,0xff,0xe6,0x0b,0xfb,0x50,0x00,0x00,0x02,0x8e,0xe1,
+0xfd,0x02,0x40,0x00,0x10,0x00,0x04,0x8b,0x01,0xa0,0x04,0x00,0x00,0x09,0xf4,0x00,
+0x03,0x6a,0xff,0x80,0x70,0x00,0xf0,0x12,0x4f,0xff,0xc7,0x20,0x19,0xdb,0x9c,0xea,
+0x4f,0x90,0x00,0x00,0x01,0xf8,0x0b,0xf1,0x3f,0x80,0x00,0x00,0x28,0xed,0x8f,0xe8,
+0x6f,0xb6,0x66,0x62,0x5f,0xff,0xff,0xff,0x8f,0x29,0x02,0xf3,0x2f,0x05,0xf6,0x00,
+0x4f,0xb6,0xff,0x62,0x29,0x9b,0xfc,0x99,0x5f,0x70,0xef,0x00,0x3f,0xff,0xff,0xff,
+0x5f,0x60,0xef,0x00,0x02,0x76,0xf7,0x81,0x6f,0x50,0xef,0x00,0x0b,0xe5,0xf7,0xea,
+0x9f,0x30,0xef,0x00,0x4f,0x64,0xf6,0x7d,0xef,0x00,0xef,0x00,0x04,0x5b,0xf5,0x05,
+0xfb,0x00,0xef,0x00,0x00,0x5f,0xc1,0x01,0xb3,0x00,0xef,0x75,0x02,0x11,0x33,0x00,
+0x01,0x12,0x80,0x0d,0x00,0x23,0x1f,0xf2,0x00,0x01,0x10,0xf6,0x0d,0x00,0x02,0xf8,
+0x00,0xd3,0xf2,0x1d,0xdd,0xef,0xfe,0xdd,0xdd,0xdd,0xd2,0x00,0x00,0x2f,0xf0,0x31,
+0x05,0x13,0xe0,0xb9,0x05,0x01,0x87,0x05,0xf0,0x0e,0x00,0x00,0x8f,0xec,0xcc,0xcd,
+0xf9,0x00,0x00,0x00,0xcf,0x60,0x00,0x06,0xf8,0x00,0x00,0x04,0xff,0x10,0x00,0x08,
+0xf7,0x00,0x00,0x0d,0xf9,0x00,0x00,0x88,0x04,0xf4,0x07,0xbf,0xe1,0x00,0x00,0x0f,
+0xf1,0x00,0x1d,0xff,0x30,0x07,0xdc,0xef,0xd0,0x00,0x09,0xd3,0x00,0x02,0xff,0xfc,
+0x20,0x7f,0x03,0x00,0x30,0x02,0xf0,0x05,0xe3,0xdd,0xdd,0xdd,0xc0,0x0b,0xfa,0x9e,
+0xe2,0xcc,0xdf,0xec,0xb0,0x0b,0xf1,0x0c,0xe0,0x34,0x3f,0x80,0x18,0x00,0x40,0xe0,
+0xce,0x3f,0x70,0x90,0x02,0x40,0xe0,0xfa,0x5f,0x50,0x60,0x02,0x90,0xe5,0xfb,0xaf,
+0xa7,0x70,0x0b,0xff,0xff,0xe6,0x58,0x05,0xf1,0x29,0x0b,0xfa,0x99,0x90,0x43,0xfe,
+0x22,0x20,0x0b,0xf1,0x2b,0x40,0x05,0xff,0xa0,0x00,0x0b,0xf1,0x1f,0xb0,0x0b,0xff,
+0xa0,0x00,0x0c,0xf7,0xcf,0xf2,0x3f,0xcd,0xa0,0x60,0x0e,0xff,0xfa,0xf7,0xdf,0x4d,
+0xa0,0xe4,0x2f,0xf9,0x10,0x4b,0xfa,0x0d,0xea,0xf2,0x07,0x20,0x00,0x0c,0xc0,0x07,
+0xef,0xa0,0x75,0x01,0x00,0x03,0x06,0x01,0xde,0x00,0x80,0xbf,0xfe,0xee,0xee,0xef,
+0xf2,0xbf,0x30,0x7c,0x05,0x09,0x06,0x00,0x11,0x40,0x06,0x00,0x02,0x24,0x00,0x4e,
+0xed,0xdd,0xdd,0xdf,0x24,0x00,0x04,0x18,0x00,0x01,0x24,0x00,0x00,0x30,0x00,0x10,
+0x0d,0x3f,0x01,0xf1,0x09,0x03,0x33,0x33,0x33,0xdf,0xff,0xfa,0x0f,0xff,0xff,0xfe,
+0xdf,0xbc,0xfa,0x0f,0xf8,0x88,0xfe,0xde,0x01,0xfa,0x0f,0xe0,0x00,0x07,0x00,0x51,
+0xe2,0x22,0xfe,0xdf,0xab,0x1c,0x00,0x00,0x23,0x00,0x27,0xf9,0x99,0x1c,0x00,0x30,
+0x1f,0xe5,0x55,0x1c,0x00,0x12,0x3f,0x1c,0x00,0xf7,0x11,0x6f,0xa5,0x55,0xfe,0xde,
+0x00,0x00,0xcf,0x30,0x00,0xfe,0x22,0x00,0x05,0xfe,0x00,0x00,0xfe,0x00,0x00,0x2f,
+0xf6,0x04,0xcd,0xfc,0x00,0x00,0x0a,0x90,0x00,0xff,0xd4,0x3f,0x06,0x61,0x0f,0xc0,
+0x00,0x0c,0xcc,0xcc,0x3f,0x06,0x30,0xff,0xff,0xf2,0x8d,0x00,0x40,0x0f,0xc0,0xbf,
+0x2b,0x42,0x07,0x30,0xfc,0x0b,0xf0,0x1e,0x00,0xf1,0x03,0x0f,0xc0,0xbf,0x9c,0xcd,
+0xff,0xcc,0xc5,0xff,0xff,0xfa,0xdd,0xdd,0xef,0xfd,0x6f,0xe9,0xef,0x6d,0x06,0xf2,
+0x1c,0xfc,0x0b,0xf8,0xcc,0xcc,0xcf,0xfc,0x4f,0xc0,0xbf,0x8b,0xbb,0xbb,0xff,0xb3,
+0xfe,0x9e,0xf0,0x8e,0x20,0x0f,0xc0,0x0f,0xff,0xff,0x06,0xfd,0x00,0xfc,0x00,0xfd,
+0x11,0x10,0x0b,0xe3,0x0f,0xc0,0x0a,0x90,0x00,0x00,0x23,0xcc,0xb6,0x08,0x27,0x0d,
+0xfd,0x34,0x06,0x21,0xff,0xff,0xac,0x04,0x6e,0x7f,0x95,0x55,0x55,0x5a,0xf6,0x10,
+0x00,0xe1,0x5c,0xcc,0xcf,0xec,0xcc,0xc5,0x00,0x08,0x88,0x88,0xaf,0xe8,0x88,0x88,
+0xd4,0x02,0x01,0x14,0x06,0xf0,0x06,0x07,0x77,0x77,0x77,0x77,0x71,0x00,0x00,0x1f,
+0xfc,0xcc,0xcc,0xcf,0xf2,0x00,0x00,0x1f,0xd5,0x55,0x55,0x5d,0x08,0x00,0x02,0xb3,
+0x04,0xf3,0x0a,0x00,0x19,0xe7,0x0e,0xf0,0x8a,0x50,0x00,0x2c,0xff,0xa7,0x7f,0xf0,
+0x6c,0xff,0x80,0x07,0x92,0x09,0xfe,0x80,0x00,0x3a,0x30,0x0f,0x40,0x00,0x93,0x0a,
+0xaa,0xaa,0xaf,0xfb,0xaa,0xaa,0xa0,0x00,0x2b,0x07,0x21,0x00,0x9f,0x18,0x00,0xc3,
+0x00,0x00,0x9f,0x97,0x7e,0xf8,0x77,0xef,0x00,0x00,0x9f,0x87,0x08,0x00,0x04,0x18,
+0x00,0x47,0x30,0x0e,0xf2,0x00,0x10,0x00,0xb1,0x5c,0xd8,0xbf,0xe8,0x88,0x88,0x00,
+0x00,0x1d,0xf9,0xdf,0x01,0x06,0xf8,0x08,0x03,0xff,0xff,0x63,0x10,0x00,0x00,0x1a,
+0xdf,0xff,0xcf,0xff,0xff,0xee,0xe5,0x0a,0xfb,0x60,0x01,0x59,0xbc,0xef,0xf0,0x5f,
+0x01,0x01,0xed,0x02,0x11,0x8f,0x83,0x06,0xa3,0x00,0x00,0x01,0x11,0x1f,0xe1,0x19,
+0xf5,0x00,0x2f,0x1c,0x03,0xa3,0x05,0x55,0x55,0x5f,0xe5,0x5b,0xf9,0x50,0x00,0xbf,
+0x20,0x00,0x60,0x56,0x66,0x6f,0xe6,0x66,0x64,0x8a,0x01,0x01,0x70,0x00,0xa1,0x18,
+0x88,0x88,0x8f,0xf8,0x88,0x88,0x81,0x19,0x99,0x01,0x00,0x33,0x91,0x00,0x2f,0x28,
 0x01,0x22,0x2f,0xc5,0x28,0x01,0x0f,0x10,0x00,0x05,0x13,0x7f,0x10,0x01,0x67,0x7f,
 0x96,0x66,0x66,0x6d,0xf2,0x10,0x00,0x12,0x95,0x30,0x01,0x21,0x6d,0xdd,0x93,0x03,
-0x21,0x38,0x88,0x01,0x00,0x24,0x80,0x6f,0x4c,0x2a,0xc0,0xfd,0x58,0xf9,0x56,0x66,
-0x66,0x20,0x00,0xff,0xff,0xf9,0xdf,0xac,0x06,0x70,0xfd,0x57,0xf9,0x4f,0x81,0xaf,
-0x30,0x10,0x00,0xb0,0x0a,0xf8,0xfa,0x00,0x03,0xfd,0x69,0xfe,0x41,0xff,0xf1,0xd0,
-0x61,0xd6,0xfd,0xae,0xfd,0xff,0xa1,0x14,0x21,0x03,0xf9,0x7a,0x30,0x39,0x90,0xc1,
-0x66,0x12,0x08,0xec,0x4d,0x0b,0x77,0x1c,0x23,0x00,0x01,0xda,0x52,0x10,0x08,0x24,
-0x2a,0x13,0xa3,0xda,0x26,0x60,0xf5,0x00,0x03,0xff,0xfb,0x00,0x09,0x89,0x22,0x3f,
-0xfc,0x10,0x00,0xa2,0x1e,0x93,0xfe,0xaa,0xaa,0xad,0xf5,0x00,0x02,0x03,0x18,0x00,
-0x02,0x7c,0x27,0x10,0xf5,0x5c,0x22,0x41,0x88,0x88,0x8c,0xf5,0x95,0x2e,0x31,0x0a,
-0xce,0xf4,0x08,0x00,0x37,0x08,0xfe,0xa0,0x44,0x54,0x24,0x01,0xf9,0x08,0x00,0x10,
-0x0b,0x57,0x21,0xf0,0x08,0xff,0xdd,0xfe,0x9b,0xfb,0xbe,0xf1,0x1e,0xff,0xee,0xff,
-0xab,0xf0,0x0b,0xf1,0x00,0xde,0x13,0xf9,0x0b,0xf3,0x3c,0xf1,0x8c,0x4e,0x11,0x0b,
-0x3c,0x2e,0xd1,0x67,0xf9,0x0c,0xf6,0x6d,0xf1,0x00,0xdf,0x78,0xf9,0x0c,0xf0,0x0b,
-0x18,0x00,0xb1,0x0d,0xf7,0x7d,0xf1,0x00,0xde,0x02,0xfa,0x0e,0xff,0xff,0xc2,0x13,
-0xa0,0x9f,0xc1,0x1c,0xf1,0x29,0xcc,0x9a,0xc9,0x8f,0x90,0x20,0x00,0xf7,0x05,0x39,
-0xf5,0x7f,0x60,0x0c,0xf1,0x1c,0xf9,0x00,0xdf,0xef,0x17,0xcf,0xf0,0x09,0xa0,0x00,
-0x21,0x59,0x05,0x5f,0x23,0x0e,0xa4,0x44,0x02,0x87,0x1f,0x13,0xef,0x38,0x02,0x6d,
-0xcd,0xdd,0xdf,0xfd,0xdd,0xdd,0x20,0x00,0x06,0x24,0x05,0x20,0xdd,0xff,0x48,0x44,
-0x01,0xdb,0x15,0x02,0xe2,0x53,0x30,0xdf,0xfc,0xfb,0x6f,0x1e,0xf0,0x01,0xfb,0x1f,
-0xf0,0xbf,0xd4,0x00,0x3c,0xff,0xa0,0x0f,0xf0,0x0a,0xff,0xb2,0x2e,0xd4,0x40,0x00,
-0x32,0x5e,0xe1,0x02,0x48,0x00,0x1f,0x20,0x1c,0x45,0x05,0x04,0xdf,0x1f,0x21,0x0d,
-0xdd,0x78,0x00,0x1c,0xd1,0x20,0x00,0x13,0x03,0xfc,0x2c,0x12,0x03,0x78,0x00,0x02,
-0xb2,0x4c,0x11,0xc1,0x0b,0x29,0x20,0xbf,0xf9,0xf3,0x45,0xf0,0x02,0x5d,0xfa,0x0f,
-0xf0,0x9f,0xe6,0x00,0x2c,0xff,0x90,0x0f,0xf0,0x08,0xff,0xd3,0x1d,0xe4,0x38,0x00,
-0x32,0x3d,0xd0,0x01,0x40,0x00,0x1f,0x10,0x78,0x00,0x04,0x00,0xbd,0x04,0x45,0x3f,
-0xf3,0x33,0x33,0x70,0x03,0x20,0x0b,0xbb,0x3b,0x13,0x10,0xbb,0xc5,0x09,0x31,0x8f,
-0xf9,0xf7,0xe3,0x06,0x40,0x1f,0xf2,0xff,0x10,0x9a,0x2a,0x40,0x0f,0xf0,0xaf,0xa0,
-0x90,0x2d,0x40,0x0f,0xf0,0x1f,0xf5,0xa3,0x2f,0x61,0x0f,0xf0,0x07,0xff,0x50,0x4f,
-0x2b,0x0b,0x40,0xdf,0xf3,0x0c,0x85,0xc3,0x10,0x2e,0x49,0x70,0x68,0x00,0x04,0x72,
-0x08,0x22,0x0d,0xf9,0xff,0x08,0x12,0xcf,0xf4,0x15,0xc0,0x3d,0xff,0xa8,0x8a,0xff,
-0x70,0x00,0x08,0xff,0xaf,0xf6,0x5e,0x04,0x08,0x31,0x82,0x04,0xff,0xda,0x30,0xf1,
-0x0b,0x58,0xcf,0xfe,0xdf,0xfe,0xa7,0x51,0x3f,0xff,0xfc,0x67,0x64,0xaf,0xff,0xf1,
-0x0b,0xa6,0x20,0x0f,0xf0,0x00,0x37,0x50,0x00,0x7a,0xaa,0x2a,0x3a,0x02,0x42,0x3b,
-0x00,0x31,0x2b,0x40,0xc5,0x0f,0xf0,0x4a,0x3e,0x89,0xb0,0xe2,0x0f,0xf0,0x6f,0xe3,
-0x00,0x07,0xfb,0x16,0xaf,0xe0,0x04,0x1b,0x10,0x40,0xe5,0x01,0x17,0x43,0xe5,0x1b,
-0x13,0xb0,0xca,0x41,0x12,0xb0,0x7f,0x0e,0xe0,0x1f,0xb0,0x0a,0xaf,0xfa,0xa5,0x00,
-0x04,0x5f,0xc4,0x3f,0xff,0xff,0xf7,0x7f,0x03,0xf0,0x03,0x80,0x9f,0x63,0xf7,0x10,
-0x15,0x9f,0xd5,0x34,0xff,0x13,0xf8,0xb7,0x00,0xaf,0xe1,0x9f,0xf5,0xa7,0x63,0xb0,
-0xff,0xfd,0x3c,0x42,0xea,0x48,0x60,0x05,0xff,0xdf,0x70,0xf4,0x0c,0xc0,0x0d,0xdf,
-0xb6,0x99,0x9a,0xfe,0x99,0x93,0x6f,0x6f,0xb0,0xef,0xe1,0x02,0xd0,0x2c,0x1f,0xb0,
-0x22,0x24,0xfc,0x22,0x20,0x01,0x1f,0xb0,0x00,0x02,0xf8,0x01,0x0c,0x08,0x00,0x05,
-0x71,0x0f,0x42,0xf9,0x00,0x08,0xe4,0x82,0x3a,0x50,0x01,0xff,0x86,0x67,0x40,0x11,
-0x00,0x10,0x9f,0xc1,0x1f,0xe0,0x1b,0xcf,0xeb,0x7f,0xfa,0x66,0xbf,0xb0,0x01,0xff,
-0xff,0xfc,0xff,0xf4,0xa7,0x70,0x60,0x9f,0xe3,0x15,0x4f,0xff,0xf4,0x83,0x1e,0xf1,
-0x14,0xd0,0x05,0xdf,0xfe,0x61,0x00,0x01,0xff,0xdf,0xde,0xff,0xcb,0xff,0xfb,0x00,
-0x7f,0xfa,0x9f,0xfc,0x50,0x03,0xbf,0xb0,0x0e,0xdf,0x90,0x6d,0xaa,0xaa,0xaa,0x82,
-0x05,0xf8,0xf9,0x01,0x8a,0x07,0x50,0x1d,0x3f,0x90,0x1f,0xb0,0x8e,0x62,0x41,0x22,
-0xf9,0x01,0xfb,0x52,0x7c,0x31,0x2f,0x90,0x1f,0x60,0x01,0xe0,0x02,0xf9,0x01,0xed,
-0x99,0x9a,0xea,0x00,0x00,0x1f,0xa0,0x00,0x00,0xc9,0x98,0x00,0x11,0xa0,0xd8,0x7d,
-0x00,0x08,0x00,0x30,0x4f,0xff,0xd1,0xa8,0x00,0xf1,0x10,0x07,0xff,0x46,0xfe,0x50,
-0x0f,0xff,0xff,0xcf,0xfd,0x88,0xef,0xf9,0x0b,0xcf,0xeb,0xbb,0xdf,0xff,0xfc,0xb3,
-0x00,0x7f,0xf3,0x03,0x33,0xfc,0x33,0x30,0x00,0xcf,0x39,0x32,0xf1,0x04,0xf0,0x02,
+0x21,0x38,0x88,0x01,0x00,0x22,0x80,0x6f,0x70,0x00,0xe0,0xf1,0x00,0xfd,0x58,0xf9,
+0x56,0x66,0x66,0x20,0x00,0xff,0xff,0xf9,0xdf,0xac,0x06,0x70,0xfd,0x57,0xf9,0x4f,
+0x81,0xaf,0x30,0x10,0x00,0x90,0x0a,0xf8,0xfa,0x00,0x03,0xfd,0x69,0xfe,0x41,0xcb,
+0x0a,0xf3,0x04,0xff,0xfe,0xfd,0xae,0xfd,0xff,0xa1,0x14,0x21,0x03,0xf9,0x7a,0x30,
+0x39,0x90,0x00,0x00,0x02,0x84,0x0a,0x06,0x11,0xf9,0x94,0x03,0x84,0xbb,0xbe,0xfd,
+0xbb,0xbb,0xbb,0xb1,0x1f,0x58,0x00,0x32,0x01,0xdf,0x50,0x1f,0x00,0x82,0xff,0xaa,
+0xaa,0xaa,0xa3,0x00,0x00,0x3f,0xf0,0x00,0x10,0x03,0x00,0x04,0x52,0x08,0xf5,0x00,
+0x3f,0xfc,0x10,0x00,0xa2,0x1e,0x93,0xfe,0xaa,0xaa,0xad,0xf5,0x00,0x02,0x03,0x18,
+0x00,0x23,0x00,0x03,0x18,0x01,0x50,0x03,0xfd,0x88,0x88,0x8c,0x08,0x00,0x51,0xfa,
+0x00,0x0a,0xce,0xf4,0x08,0x00,0x36,0x08,0xfe,0xa0,0x66,0x01,0x34,0xde,0x01,0xf9,
+0x08,0x00,0x00,0x40,0x06,0xf1,0x0c,0x1d,0xff,0xdd,0xfe,0x9b,0xfb,0xbe,0xf1,0x1e,
+0xff,0xee,0xff,0xab,0xf0,0x0b,0xf1,0x00,0xde,0x13,0xf9,0x0b,0xf3,0x3c,0xf1,0x00,
+0xdf,0xff,0x20,0x00,0xf1,0x00,0x00,0xde,0x67,0xf9,0x0c,0xf6,0x6d,0xf1,0x00,0xdf,
+0x78,0xf9,0x0c,0xf0,0x0b,0x18,0x00,0xc0,0x0d,0xf7,0x7d,0xf1,0x00,0xde,0x02,0xfa,
+0x0e,0xff,0xff,0xf1,0x39,0x0a,0xa0,0x9f,0xc1,0x1c,0xf1,0x29,0xcc,0x9a,0xc9,0x8f,
+0x90,0x20,0x00,0xf8,0x07,0x39,0xf5,0x7f,0x60,0x0c,0xf1,0x1c,0xf9,0x00,0xdf,0xef,
+0x17,0xcf,0xf0,0x09,0xa0,0x00,0x21,0x59,0x05,0xfe,0x70,0xe8,0x01,0x1a,0xf0,0x08,
+0x00,0x11,0x1f,0x08,0x00,0x13,0xef,0x38,0x02,0x6d,0xcd,0xdd,0xdf,0xfd,0xdd,0xdd,
+0x20,0x00,0x06,0x24,0x05,0x31,0xdd,0xff,0xff,0x24,0x05,0x10,0x0a,0x76,0x01,0x00,
+0x5e,0x04,0x20,0xdf,0xfc,0x36,0x03,0xf0,0x02,0x4d,0xfb,0x1f,0xf0,0xbf,0xd4,0x00,
+0x3c,0xff,0xa0,0x0f,0xf0,0x0a,0xff,0xb2,0x2e,0xd4,0x40,0x00,0x32,0x5e,0xe1,0x02,
+0x48,0x00,0x1e,0x20,0x78,0x00,0x02,0x08,0x00,0x13,0x0f,0x78,0x01,0x21,0x0d,0xdd,
+0x78,0x00,0x1c,0xd1,0x20,0x00,0x12,0x03,0x20,0x00,0x22,0x50,0x03,0x78,0x00,0x11,
+0x40,0x78,0x00,0x10,0xc1,0x52,0x09,0xf0,0x09,0xcf,0xbf,0xf9,0xfd,0x10,0x00,0x00,
+0x5d,0xfa,0x0f,0xf0,0x9f,0xe6,0x00,0x2c,0xff,0x90,0x0f,0xf0,0x08,0xff,0xd3,0x1d,
+0xe4,0x38,0x00,0x32,0x3d,0xd0,0x01,0x40,0x00,0x1f,0x10,0x78,0x00,0x04,0x00,0xbd,
+0x04,0x45,0x3f,0xf3,0x33,0x33,0x70,0x03,0x70,0x0b,0xbb,0xcf,0xff,0xff,0xfb,0xbb,
+0xc5,0x09,0x31,0x8f,0xf9,0xf7,0xe3,0x06,0xf1,0x0f,0x1f,0xf2,0xff,0x10,0x00,0x00,
+0x0a,0xf9,0x0f,0xf0,0xaf,0xa0,0x00,0x00,0x5f,0xe1,0x0f,0xf0,0x1f,0xf5,0x00,0x04,
+0xff,0x60,0x0f,0xf0,0x07,0xff,0x50,0x4f,0x2b,0x0b,0xae,0xdf,0xf3,0x0c,0x85,0xee,
+0xef,0xfe,0xee,0x49,0x70,0x68,0x00,0x04,0x72,0x08,0x22,0x0d,0xf9,0xff,0x08,0x10,
+0xcf,0xeb,0x0a,0x00,0x45,0x0c,0xa0,0xa8,0x8a,0xff,0x70,0x00,0x08,0xff,0xaf,0xf6,
+0x5e,0x04,0x08,0xf0,0x1a,0x82,0x04,0xff,0xff,0x80,0x00,0x00,0x03,0x58,0xcf,0xfe,
+0xdf,0xfe,0xa7,0x51,0x3f,0xff,0xfc,0x67,0x64,0xaf,0xff,0xf1,0x0b,0xa6,0x20,0x0f,
+0xf0,0x00,0x37,0x50,0x00,0x7a,0xaa,0xaf,0xfa,0xaa,0xa9,0x00,0x00,0xaf,0x70,0x00,
+0xf0,0x0d,0xfe,0x00,0x00,0x03,0xc5,0x0f,0xf0,0x4a,0x10,0x00,0x00,0x8f,0xe2,0x0f,
+0xf0,0x6f,0xe3,0x00,0x07,0xfb,0x16,0xaf,0xe0,0x04,0xfe,0x10,0x00,0x40,0xe5,0x01,
+0x16,0x43,0xe6,0x01,0x22,0x1f,0xb0,0xd1,0x03,0x00,0x08,0x00,0x11,0xd0,0x08,0x00,
+0xc0,0x0a,0xaf,0xfa,0xa5,0x00,0x04,0x5f,0xc4,0x3f,0xff,0xff,0xf7,0x7f,0x03,0xf0,
+0x12,0x80,0x9f,0x63,0xf7,0x10,0x15,0x9f,0xd5,0x34,0xff,0x13,0xf8,0xb7,0x00,0xaf,
+0xe1,0x9f,0xf5,0x02,0xff,0xf5,0x00,0xff,0xfd,0x3c,0x42,0xea,0x48,0x60,0x05,0xff,
+0xdf,0x70,0xf4,0x0c,0xc0,0x0d,0xdf,0xb6,0x99,0x9a,0xfe,0x99,0x93,0x6f,0x6f,0xb0,
+0xef,0xe1,0x02,0xd0,0x2c,0x1f,0xb0,0x22,0x24,0xfc,0x22,0x20,0x01,0x1f,0xb0,0x00,
+0x02,0xf8,0x01,0x0c,0x08,0x00,0x04,0x01,0x00,0x50,0x02,0xf9,0x00,0x08,0xe4,0x09,
+0x00,0x70,0x2f,0x90,0x01,0xff,0x86,0x67,0x40,0x11,0x00,0x00,0x9c,0x04,0xf1,0x31,
+0x30,0x1b,0xcf,0xeb,0x7f,0xfa,0x66,0xbf,0xb0,0x01,0xff,0xff,0xfc,0xff,0xf4,0x5f,
+0xf2,0x00,0x00,0x9f,0xe3,0x15,0x4f,0xff,0xf4,0x00,0x00,0x0d,0xff,0xd0,0x05,0xdf,
+0xfe,0x61,0x00,0x01,0xff,0xdf,0xde,0xff,0xcb,0xff,0xfb,0x00,0x7f,0xfa,0x9f,0xfc,
+0x50,0x03,0xbf,0xb0,0x0e,0xdf,0x90,0x6d,0xaa,0xaa,0xaa,0x82,0x05,0xf8,0xf9,0x01,
+0x8a,0x07,0xe0,0x1d,0x3f,0x90,0x1f,0xb0,0x00,0x2f,0xb0,0x00,0x22,0xf9,0x01,0xfb,
+0x00,0x83,0x03,0x31,0x2f,0x90,0x1f,0x60,0x01,0xf1,0x00,0x02,0xf9,0x01,0xed,0x99,
+0x9a,0xea,0x00,0x00,0x1f,0xa0,0x00,0x00,0xc9,0x00,0x08,0x00,0x31,0x08,0xfe,0x10,
+0x08,0x00,0x30,0x4f,0xff,0xd1,0xa8,0x00,0xf0,0x12,0x07,0xff,0x46,0xfe,0x50,0x0f,
+0xff,0xff,0xcf,0xfd,0x88,0xef,0xf9,0x0b,0xcf,0xeb,0xbb,0xdf,0xff,0xfc,0xb3,0x00,
+0x7f,0xf3,0x03,0x33,0xfc,0x33,0x30,0x00,0xcf,0xfe,0x2f,0x10,0x02,0xf0,0x05,0x02,
 0xff,0xdf,0x6f,0xa3,0xfc,0x3c,0xf0,0x09,0xef,0xa5,0x1f,0xa4,0xfc,0x4c,0xf0,0x3f,
-0x8f,0x10,0x65,0xf5,0x12,0xf0,0x0d,0x2f,0xa0,0x02,0x29,0xff,0xa2,0x20,0x01,0x1f,
-0xa0,0x00,0x7f,0xdb,0xf7,0x00,0x00,0x1f,0xa1,0x7d,0xfd,0x11,0xcf,0xe6,0x00,0x1f,
-0xa0,0xad,0x70,0x00,0x06,0xd2,0x00,0x01,0x14,0xae,0x08,0x00,0x12,0x01,0xa7,0x25,
-0xb0,0xae,0x00,0x99,0x99,0x9f,0xfd,0x20,0x3b,0xef,0xb2,0x00,0x9b,0x10,0xf0,0x37,
-0x4f,0xff,0xf4,0x33,0x1e,0xec,0x9a,0x80,0x01,0xcf,0x15,0xff,0x9e,0xa9,0xce,0xd0,
-0x00,0xff,0x74,0xd8,0x9e,0xa5,0x1b,0xb0,0x04,0xff,0xf8,0xc6,0x9e,0xbd,0xcf,0x70,
-0x0a,0xfe,0xed,0xc8,0x9e,0xa3,0xff,0x20,0x1f,0xfe,0x45,0xff,0x9e,0xa1,0xef,0x20,
-0x8f,0xbe,0x04,0xd6,0x7e,0xbc,0xfe,0xb0,0x4a,0xae,0x00,0x13,0x8f,0xdf,0x66,0xa0,
-0x02,0xae,0x00,0x04,0xfe,0x42,0x60,0x00,0x30,0x3a,0xab,0xba,0x64,0x0c,0x13,0xae,
-0x7b,0x2c,0x13,0xcd,0x78,0x00,0x40,0xcd,0x09,0xff,0xf7,0x88,0x06,0xf0,0x0e,0xcd,
-0x09,0xf8,0xf7,0x99,0xed,0x90,0x27,0xee,0x7a,0xd0,0xf6,0x65,0xd9,0x00,0x4f,0xff,
-0xfa,0xff,0xf6,0xe7,0xe8,0x00,0x15,0xef,0x59,0xe6,0xf6,0xf5,0xad,0x5b,0x90,0x59,
-0xe2,0xfa,0xf8,0xf9,0x50,0x05,0xff,0xea,0xfe,0x0d,0xf0,0x22,0xf2,0x0a,0xfe,0xfe,
-0xe6,0x83,0x3a,0xf4,0x20,0x1f,0xfd,0x79,0xd5,0xf2,0x0e,0xf5,0x00,0x8f,0xdd,0x09,
-0xd3,0xf9,0x4f,0xf5,0x00,0x49,0xcd,0x0b,0xff,0xfe,0xbe,0xf5,0x30,0x01,0xcd,0x2f,
-0xf6,0x27,0xf6,0xf5,0xb3,0x00,0xcd,0x08,0x20,0x2f,0xc0,0xfb,0xe2,0x70,0x00,0x35,
-0x6d,0x10,0xaf,0x4c,0x16,0x00,0x68,0x01,0x30,0xbf,0x03,0xf8,0x08,0x00,0x91,0x25,
-0xdf,0x67,0xfb,0x51,0x00,0x1f,0xa0,0x5f,0x19,0x05,0x60,0x2f,0xa0,0x03,0xcf,0x46,
-0xfa,0x70,0x03,0x11,0x4f,0xd4,0x08,0xb1,0xcf,0xeb,0x55,0xdf,0x57,0xfb,0x52,0x00,
-0x7f,0xb0,0xbf,0x78,0x1d,0xb1,0xcf,0xf5,0x06,0x66,0xfd,0x66,0x60,0x01,0xff,0xfe,
-0x1f,0x87,0x25,0xf3,0x0b,0xff,0xbe,0x5f,0xc5,0xfd,0x5e,0xe0,0x2f,0x9f,0xa3,0x0f,
-0xfc,0xff,0xcf,0xe0,0x2f,0x3f,0xa0,0x7f,0xd6,0xfd,0x6e,0xf5,0x03,0x1f,0xa0,0xd2,
-0x45,0xe1,0xa0,0x0f,0xa0,0x03,0x7e,0xe0,0x00,0x1f,0xa0,0x0e,0x90,0x03,0xfe,0x80,
-0xf0,0x01,0x02,0x80,0x00,0x11,0xdf,0x59,0x06,0xf0,0x04,0x1f,0xa0,0x78,0x9f,0xae,
-0xd8,0x83,0x00,0x1f,0xa0,0x26,0x8f,0x9e,0xc6,0x60,0x0f,0xff,0xff,0x9f,0xc0,0x01,
-0xb2,0x09,0xbf,0xd9,0x8f,0x2f,0x4d,0x79,0xf0,0x00,0x8f,0xd0,0x15,0x85,0x30,0xdf,
-0xf7,0x26,0xb7,0x26,0x40,0x02,0xff,0xff,0x2e,0xf4,0x0c,0xc1,0x09,0xef,0xae,0x45,
-0x55,0x55,0x55,0x30,0x2f,0x8f,0xa2,0xef,0xa4,0x31,0xf0,0x37,0x2f,0xa0,0x7c,0xa9,
-0xfd,0x8b,0x83,0x01,0x1f,0xa0,0x3f,0xc2,0xf9,0x9f,0x70,0x00,0x1f,0xa1,0xfd,0x59,
-0xf9,0x0c,0xf4,0x00,0x1f,0xa0,0x51,0x3f,0xe4,0x01,0x50,0x00,0x9e,0x00,0x45,0x0d,
-0x70,0x73,0x00,0x00,0x9e,0x00,0xc8,0x0f,0x91,0xf4,0x00,0x00,0x9e,0x02,0xf4,0x4f,
-0x97,0xc7,0x70,0x1b,0xef,0xbc,0xdd,0xae,0xbf,0xef,0x60,0x1f,0xff,0xfa,0xce,0x1d,
-0xb7,0xcd,0xec,0x19,0xf1,0x11,0xd9,0x9b,0xc2,0xf8,0xb0,0x02,0xff,0x59,0xfb,0xfb,
-0xed,0xfe,0xf0,0x06,0xff,0xe9,0xc9,0xca,0xf7,0xe9,0x91,0x0c,0xfe,0xd7,0xec,0x59,
-0xf6,0xdf,0x50,0x3f,0xbe,0x2d,0x08,0x05,0xf8,0x19,0x6d,0x9e,0x02,0xfd,0x22,0xfa,
-0x8e,0x40,0x05,0x9e,0x04,0xff,0xd2,0xaf,0xfb,0x10,0x00,0x9e,0x0b,0xf4,0xd4,0x9f,
-0xe1,0xc4,0x00,0x9e,0x8f,0x70,0x7e,0xfe,0xfd,0xf4,0x00,0x9e,0x68,0x00,0x7a,0x20,
-0x8e,0xb0,0x4f,0x59,0x1f,0xf9,0x08,0x00,0x09,0x25,0x7f,0x80,0x08,0x00,0x40,0xfe,
-0xcc,0xcc,0x50,0x08,0x00,0x00,0x90,0x02,0x00,0x08,0x00,0x01,0xac,0x17,0x07,0x20,
-0x00,0x0f,0x08,0x00,0x01,0x93,0x01,0x8f,0x91,0x18,0xfa,0x11,0x11,0x10,0x8f,0xa8,
-0x05,0x12,0x6c,0x6e,0x1e,0x22,0xc1,0x06,0x44,0x4b,0x06,0xd2,0x3c,0x42,0x11,0x11,
-0x18,0xf9,0x55,0x7c,0x22,0x06,0xf8,0x01,0x7a,0x22,0x06,0xf8,0xa3,0x73,0x23,0x06,
-0xf9,0x08,0x00,0x00,0x60,0x06,0x00,0x08,0x00,0x31,0xfe,0xcc,0xcc,0x08,0x00,0x04,
-0x20,0x00,0x0a,0x08,0x00,0x11,0xd0,0x78,0x00,0x0c,0x24,0x4c,0x02,0x7f,0x1e,0x30,
-0x91,0x00,0x5f,0x2c,0x06,0xb0,0xf6,0xfe,0x20,0x3b,0xef,0xcb,0xb1,0x0c,0xf1,0x4a,
-0x20,0x72,0x1d,0x80,0x3d,0xfc,0xef,0xb0,0x00,0xff,0xaa,0x6e,0x66,0x89,0xf1,0x19,
-0x04,0xff,0xff,0xa8,0x9c,0xf5,0x00,0x00,0x0a,0xf4,0x3f,0x70,0x08,0xf9,0x9b,0xe1,
-0x3f,0xd0,0x6f,0x7b,0xdf,0xff,0xfe,0xb2,0x8f,0x9d,0xcf,0x3f,0xdb,0xfb,0x17,0x70,
-0x1a,0x4e,0xfb,0x00,0x00,0xfd,0x6f,0xd1,0xe3,0x72,0x30,0xdf,0xfe,0x20,0x06,0x37,
-0xf0,0x0b,0x03,0xdf,0xd2,0x20,0x04,0xef,0x20,0x05,0xbf,0xff,0xd1,0xe5,0x3f,0xf6,
-0x00,0xcf,0xfa,0x29,0xff,0xf4,0x08,0x40,0x00,0x28,0x10,0x00,0xfd,0x17,0x14,0x99,
-0xb5,0x6e,0x11,0x65,0x9c,0x15,0x14,0x0d,0x7b,0x28,0x11,0xc5,0xac,0x15,0xa3,0x0a,
-0xff,0xa9,0x99,0x99,0x99,0x96,0x00,0x06,0xe6,0x3f,0x20,0xe4,0x05,0xf9,0x16,0xf7,
-0x15,0xf9,0x00,0x00,0x07,0xf6,0x06,0xf5,0x05,0xf8,0x40,0x09,0xe1,0xfa,0x1a,0xaf,
-0xfb,0xae,0xfb,0xad,0xfc,0xa7,0x00,0x0e,0xf0,0x0c,0xf0,0x9b,0x22,0x63,0xf9,0x9f,
-0xf9,0x9d,0xfb,0x92,0x28,0x3c,0x11,0xf3,0x15,0x23,0x13,0x8f,0xcb,0x71,0x29,0xfd,
-0x30,0x4e,0x3a,0x03,0xd1,0x4b,0x20,0xdf,0x20,0x10,0x24,0x01,0x7c,0x0b,0x02,0x0f,
-0x00,0x12,0x03,0x0f,0x00,0x21,0x02,0xf9,0x0f,0x00,0xf1,0x02,0x22,0xef,0xf2,0x1f,
-0xfd,0xdd,0x7d,0xf5,0xef,0xd2,0x01,0xff,0xff,0xf8,0xdf,0xff,0xb1,0x1e,0x00,0x22,
-0xff,0x60,0x2d,0x00,0x14,0x30,0x3c,0x00,0x12,0x20,0x3c,0x00,0xf5,0x12,0x09,0xd2,
-0x1f,0xe0,0x38,0x4d,0xf2,0x00,0xaf,0x33,0xff,0xef,0xf6,0xcf,0x20,0x0d,0xf1,0xaf,
-0xff,0xc7,0x1a,0xff,0xde,0xfd,0x07,0xf9,0x30,0x00,0x2d,0xff,0xfd,0x30,0x01,0x49,
-0x40,0x13,0x72,0xbd,0x0c,0x17,0xf7,0xf8,0x24,0x00,0xe2,0x46,0x10,0xc8,0x90,0x09,
-0x30,0x60,0x06,0xfe,0x7b,0x2d,0x51,0xb3,0x00,0x4f,0xf4,0xab,0x08,0x00,0x21,0x06,
-0xd8,0x17,0x00,0x03,0x75,0x0c,0x10,0xb0,0x66,0x82,0x30,0x09,0xa3,0x3f,0xc8,0x54,
-0x51,0xd5,0x5f,0xe0,0x2f,0xc0,0x7f,0x1e,0x31,0x30,0x1f,0xd0,0x59,0x0b,0xf0,0x0a,
-0x60,0x0e,0xf0,0x80,0x00,0x19,0xff,0xaf,0xfa,0x0b,0xf4,0xf5,0x07,0xff,0xe3,0x04,
-0xfc,0x15,0xff,0xf2,0x05,0xf9,0x10,0x00,0x30,0x34,0x5a,0x03,0xbc,0x15,0x00,0x97,
-0x19,0x20,0x02,0xfa,0x7f,0x01,0x11,0xc1,0x08,0x00,0x61,0x00,0x6e,0xe0,0xdf,0x02,
-0xfa,0xc2,0x45,0x41,0xdf,0x02,0xfb,0x7e,0xa5,0x0e,0x10,0x05,0x2f,0x25,0xf0,0x08,
-0xa2,0x00,0xdf,0xef,0xff,0x7e,0xe0,0x2d,0xff,0x5b,0xff,0xfd,0xfa,0x0e,0xe0,0x00,
-0x7a,0x2f,0xff,0x22,0xfa,0x0e,0xd0,0x1e,0x54,0xf0,0x0f,0x02,0xfa,0x0f,0xd0,0x00,
-0x08,0x90,0xdf,0x02,0xfb,0xef,0xb0,0x00,0x1f,0xf1,0xdf,0x02,0xfa,0xbb,0x30,0x00,
-0x9f,0x80,0xdf,0x00,0x10,0x04,0xc4,0x02,0xff,0xac,0x1f,0xf0,0x00,0x07,0xf5,0x0b,
-0xf8,0x00,0xaf,0xdc,0xbb,0xcf,0xf1,0x01,0xa0,0x00,0x2c,0xff,0x5d,0x4e,0x10,0x74,
-0xef,0x8f,0x00,0x80,0x08,0x11,0xa1,0x08,0x00,0x00,0x88,0x4f,0x11,0x0c,0xa2,0x8d,
-0x23,0xa0,0xef,0xb7,0x2a,0x72,0xbc,0xcf,0xfc,0xcc,0x50,0x0b,0x92,0x28,0x00,0x00,
-0x07,0x22,0x01,0x20,0x00,0x23,0x6d,0x18,0xc7,0x22,0x90,0x06,0xbb,0xef,0xeb,0xbb,
-0xb0,0x00,0x02,0xb0,0xa7,0x1d,0x00,0x35,0x3d,0x40,0x05,0xfb,0x04,0xb1,0x55,0x39,
-0x31,0x0d,0xf3,0x06,0xd7,0x23,0x81,0x8f,0xc3,0x57,0xff,0x50,0x08,0xfc,0x02,0x98,
-0x24,0xa2,0x04,0xe3,0x00,0xcc,0xa8,0x64,0x2c,0xf2,0x00,0x10,0x3d,0x03,0x22,0x01,
-0xa3,0x98,0x28,0x32,0x08,0xff,0x90,0xa0,0x28,0xa1,0x7f,0x96,0xaa,0xaf,0xfa,0xab,
-0x91,0x00,0x02,0x09,0x2c,0x18,0xf3,0x0c,0x02,0x00,0x09,0xf4,0x1f,0xf1,0x5f,0x90,
-0x4f,0xc3,0x09,0xf3,0x0e,0xf0,0x6e,0x30,0x3c,0xfe,0x09,0xfb,0x9f,0xf9,0xa8,0x00,
-0x00,0x64,0x0a,0x91,0x6c,0xc0,0x0c,0xfd,0xf3,0x05,0xfb,0x00,0x00,0x2d,0x3d,0xf3,
-0xfc,0x0d,0x02,0x48,0xf3,0x17,0x6e,0xe0,0x9f,0xbf,0xb0,0x00,0x01,0xfe,0x3f,0xb0,
-0x1e,0xff,0x20,0x00,0x0a,0xf7,0x7f,0x60,0x8f,0xff,0xa1,0x00,0x3f,0xf1,0xef,0x9e,
-0xfe,0x7d,0xff,0xb1,0x08,0x81,0xb9,0x5f,0xa1,0x00,0x8e,0x90,0x5d,0x70,0x00,0xd3,
-0x68,0xf1,0x0a,0x21,0x0d,0xf1,0x05,0x00,0x8f,0xf6,0x4f,0xa0,0xdf,0x14,0xfb,0x00,
-0x8f,0xe1,0xdf,0x2d,0xf1,0xaf,0x40,0x00,0x54,0x07,0xf7,0xdf,0x7f,0x23,0x81,0x26,
-0x0d,0xf2,0x33,0x01,0xda,0x10,0x0f,0x21,0x37,0xb2,0xfe,0x30,0xff,0xbb,0xbb,0xef,
-0x30,0x08,0xd0,0x0f,0xe0,0xc0,0x4b,0x11,0xff,0x0c,0x71,0xf1,0x02,0x75,0x0f,0xf8,
-0x88,0x8d,0xf3,0x00,0x1f,0xd0,0xff,0x88,0x88,0xdf,0x30,0x0a,0xf5,0x0f,0xa4,0x4a,
-0x01,0x91,0x4c,0xf6,0x01,0xaf,0x30,0xdf,0x50,0x0f,0xd0,0x06,0xcf,0xf2,0x02,0xa0,
-0x00,0xfd,0x00,0x3f,0xe9,0x0c,0x1d,0x10,0xd3,0x54,0x0a,0x21,0x6c,0x10,0x71,0x1e,
-0x50,0xbf,0x8f,0xc0,0x02,0xcf,0x08,0x00,0x54,0x19,0xb0,0x00,0x07,0x7f,0x20,0x24,
-0xf0,0x0e,0xba,0xaa,0xdf,0xba,0xa0,0x2d,0x70,0x7f,0x58,0x88,0x9f,0x33,0x20,0x5e,
-0xfb,0x7f,0x6c,0xcc,0x9f,0x4e,0xc0,0x00,0x82,0x7f,0x55,0x55,0x7f,0x9f,0x70,0xc1,
-0x09,0xf6,0x24,0xff,0x8f,0xff,0x20,0x00,0xc7,0x9f,0x7e,0x0f,0x6f,0xfa,0x00,0x03,
-0xfb,0xaf,0x5e,0x4f,0x4f,0xf3,0x00,0x09,0xf4,0xdd,0x5f,0xff,0x8f,0xf0,0xb2,0x1f,
-0xe2,0xf9,0x5e,0x16,0xff,0xf9,0xf5,0x7f,0x88,0xf5,0x00,0x8f,0xc2,0xff,0xf1,0x06,
-0x23,0xb0,0x00,0x2a,0x00,0x5e,0xee,0x1f,0x13,0x40,0x07,0x2e,0x21,0xfd,0x42,0xf6,
-0x21,0x70,0x01,0x9f,0xe3,0xfd,0x88,0x89,0xfd,0xe5,0x53,0x31,0xfc,0x66,0x67,0x1d,
-0x1c,0x01,0x18,0x00,0xb2,0x2d,0x70,0x02,0xfa,0x11,0x12,0xfd,0x00,0x5e,0xfe,0x12,
-0x1e,0x22,0x60,0x9a,0x01,0x77,0x77,0x77,0x76,0x2a,0x04,0x00,0x02,0x03,0x42,0x30,
-0x00,0x1c,0x2a,0x8d,0x1a,0xf2,0x02,0x8f,0x7a,0xf2,0xf5,0xca,0x7f,0x50,0x01,0xfe,
-0x0a,0xf1,0xf5,0xba,0x6f,0x50,0x09,0xf7,0x08,0x00,0xb3,0x2f,0xe0,0x9e,0xfb,0xfc,
-0xee,0xdf,0xc2,0x09,0x80,0xcf,0xa8,0x24,0x03,0x01,0x00,0x13,0x81,0xbe,0x05,0x22,
-0xfe,0x5b,0x18,0x00,0xb2,0x8f,0xaa,0xfb,0xbb,0xec,0xbb,0xb3,0x00,0x04,0x0a,0xf2,
-0x38,0x37,0xf0,0x0b,0x0a,0xf4,0x67,0xff,0x66,0x50,0x0a,0x70,0x0b,0xf6,0xff,0xee,
-0xef,0xd0,0x3e,0xfd,0x0b,0xf6,0xf8,0x33,0x3f,0xd0,0x00,0x96,0x0c,0xf5,0x10,0x00,
-0x00,0xe4,0x41,0x01,0x10,0x00,0x31,0x49,0x0f,0xd4,0xf1,0x26,0xf7,0x16,0xbf,0x7f,
-0xb1,0x52,0xcf,0x25,0x30,0x02,0xfd,0x7f,0x77,0xf6,0xcf,0x5f,0xb0,0x0a,0xf7,0xdf,
-0x5f,0xe0,0xcf,0x1c,0xf4,0x1f,0xf6,0xfb,0x4e,0x79,0xef,0x04,0xc4,0x04,0x72,0xb3,
-0x00,0x1f,0xe9,0x6f,0x04,0x50,0x67,0x00,0x3b,0x52,0x72,0x57,0x03,0x91,0xe1,0xcf,
-0x78,0xfa,0x11,0x10,0x00,0x06,0x78,0xca,0x03,0xf0,0x04,0x0c,0xb3,0x8f,0xfa,0x47,
-0xfa,0x44,0x30,0x19,0xfc,0xaf,0xff,0xef,0xff,0xee,0x10,0x00,0x22,0x27,0x10,0x00,
-0x42,0x00,0x00,0x09,0xe6,0x71,0x02,0xa1,0x8f,0xb5,0xf9,0x26,0xf9,0x22,0x00,0x09,
-0xfd,0x05,0xa1,0x02,0x40,0x07,0xf2,0x05,0xfc,0xb1,0x0d,0x57,0x00,0x30,0x02,0x4f,
-0xf0,0xd1,0x05,0x00,0xd9,0x0e,0x03,0x15,0x15,0x09,0x31,0x0b,0x00,0x00,0x4c,0x11,
-0x5c,0x40,0x5e,0x92,0x77,0x77,0xaf,0xe7,0x77,0x72,0x00,0x7f,0xbf,0x00,0x01,0x32,
-0x02,0x1f,0xa0,0x28,0x6e,0x10,0x07,0x79,0x03,0xf1,0x05,0x71,0x0d,0xb2,0x00,0x9a,
-0xaf,0xea,0xaa,0x00,0x2d,0xfd,0x03,0x66,0x7f,0xe6,0x66,0x40,0x00,0x84,0x08,0x0a,
-0x7d,0x00,0x86,0x0d,0x72,0x3f,0xd3,0x4f,0xa0,0x00,0x0d,0x38,0x10,0x00,0xa1,0x6f,
+0x8f,0xa0,0x1f,0x18,0x00,0xf0,0x19,0x0d,0x2f,0xa0,0x02,0x29,0xff,0xa2,0x20,0x01,
+0x1f,0xa0,0x00,0x7f,0xdb,0xf7,0x00,0x00,0x1f,0xa1,0x7d,0xfd,0x11,0xcf,0xe6,0x00,
+0x1f,0xa0,0xad,0x70,0x00,0x06,0xd2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,
+0x00,0xae,0x00,0x01,0x00,0xf0,0x4e,0xae,0x01,0xff,0xff,0xff,0xff,0x60,0x00,0xae,
+0x00,0x99,0x99,0x9f,0xfd,0x20,0x3b,0xef,0xb2,0x00,0x04,0xdf,0x90,0x00,0x4f,0xff,
+0xf4,0x33,0x1e,0xec,0x9a,0x80,0x01,0xcf,0x15,0xff,0x9e,0xa9,0xce,0xd0,0x00,0xff,
+0x74,0xd8,0x9e,0xa5,0x1b,0xb0,0x04,0xff,0xf8,0xc6,0x9e,0xbd,0xcf,0x70,0x0a,0xfe,
+0xed,0xc8,0x9e,0xa3,0xff,0x20,0x1f,0xfe,0x45,0xff,0x9e,0xa1,0xef,0x20,0x8f,0xbe,
+0x04,0xd6,0x7e,0xbc,0xfe,0xb0,0x4a,0xae,0x00,0x13,0x8f,0xdf,0x66,0xa0,0x02,0xae,
+0x00,0x04,0xfe,0x42,0x60,0x00,0x90,0x3a,0xab,0xba,0xaa,0xaa,0xa5,0x00,0xae,0x5f,
+0x68,0x00,0x33,0xf7,0x00,0xcd,0x78,0x00,0xf0,0x58,0xcd,0x09,0xff,0xf7,0xff,0xff,
+0xf0,0x00,0xcd,0x09,0xf8,0xf7,0x99,0xed,0x90,0x27,0xee,0x7a,0xd0,0xf6,0x65,0xd9,
+0x00,0x4f,0xff,0xfa,0xff,0xf6,0xe7,0xe8,0x00,0x15,0xef,0x59,0xe6,0xf6,0xf5,0xf7,
+0x00,0x01,0xff,0x59,0xe2,0xfa,0xf8,0xf9,0x50,0x05,0xff,0xea,0xff,0xfd,0xff,0xff,
+0xf2,0x0a,0xfe,0xfe,0xe6,0x83,0x3a,0xf4,0x20,0x1f,0xfd,0x79,0xd5,0xf2,0x0e,0xf5,
+0x00,0x8f,0xdd,0x09,0xd3,0xf9,0x4f,0xf5,0x00,0x49,0xcd,0x0b,0xff,0xfe,0xbe,0xf5,
+0x30,0x01,0xcd,0x2f,0xf6,0x27,0xf6,0xf5,0xb3,0x00,0xcd,0x08,0x20,0x2f,0xc0,0xfb,
+0xe2,0x70,0x00,0x54,0x6d,0x10,0xaf,0xb0,0x00,0x01,0x00,0x60,0x1f,0xa0,0x00,0xbf,
+0x03,0xf8,0x08,0x00,0x80,0x25,0xdf,0x67,0xfb,0x51,0x00,0x1f,0xa0,0x99,0x00,0xf0,
+0x3d,0xf5,0x00,0x2f,0xa0,0x03,0xcf,0x46,0xfa,0x30,0x0f,0xff,0xff,0x4f,0xff,0xff,
+0xff,0xf1,0x0b,0xcf,0xeb,0x55,0xdf,0x57,0xfb,0x52,0x00,0x7f,0xb0,0xbf,0xff,0xff,
+0xff,0xfa,0x00,0xcf,0xf5,0x06,0x66,0xfd,0x66,0x60,0x01,0xff,0xfe,0x1f,0xff,0xff,
+0xff,0xe0,0x08,0xff,0xbe,0x5f,0xc5,0xfd,0x5e,0xe0,0x2f,0x9f,0xa3,0x0f,0xfc,0xff,
+0xcf,0xe0,0x2f,0x3f,0xa0,0x7f,0xd6,0xfd,0x6e,0xf5,0x03,0x1f,0xa0,0xe8,0x00,0xf0,
+0x02,0xfc,0x00,0x1f,0xa0,0x0f,0xa0,0x03,0x7e,0xe0,0x00,0x1f,0xa0,0x0e,0x90,0x03,
+0xfe,0x80,0x78,0x00,0x03,0x80,0x00,0xf0,0x1b,0xdf,0xff,0xff,0xff,0xf6,0x00,0x1f,
+0xa0,0x78,0x9f,0xae,0xd8,0x83,0x00,0x1f,0xa0,0x26,0x8f,0x9e,0xc6,0x60,0x0f,0xff,
+0xff,0x9f,0xff,0xff,0xff,0xf0,0x09,0xbf,0xd9,0x8f,0x2f,0x4d,0x79,0xf0,0x00,0x8f,
+0xd0,0x6f,0xff,0x20,0x01,0xf0,0x0c,0xdf,0xf7,0x26,0x66,0x66,0x66,0x60,0x02,0xff,
+0xff,0x2e,0xff,0xff,0xff,0x90,0x09,0xef,0xae,0x45,0x55,0x55,0x55,0x30,0x2f,0x8f,
+0xa2,0xef,0x50,0x01,0xf0,0x5d,0x1d,0x2f,0xa0,0x7c,0xa9,0xfd,0x8b,0x83,0x01,0x1f,
+0xa0,0x3f,0xc2,0xf9,0x9f,0x70,0x00,0x1f,0xa1,0xfd,0x59,0xf9,0x0c,0xf4,0x00,0x1f,
+0xa0,0x51,0x3f,0xe4,0x01,0x50,0x00,0x9e,0x00,0x45,0x0d,0x70,0x73,0x00,0x00,0x9e,
+0x00,0xc8,0x0f,0x91,0xf4,0x00,0x00,0x9e,0x02,0xf4,0x4f,0x97,0xc7,0x70,0x1b,0xef,
+0xbc,0xdd,0xae,0xbf,0xef,0x60,0x1f,0xff,0xfa,0xce,0x1d,0xb7,0xcd,0x00,0x00,0xef,
+0x00,0xd9,0x9b,0xc2,0xf8,0xb0,0x02,0xff,0x59,0xfb,0xfb,0xed,0xfe,0xf0,0x06,0xff,
+0xe9,0xc9,0xca,0xf7,0xe9,0x91,0x0c,0xfe,0xd7,0xec,0x59,0xf6,0xdf,0x50,0x3f,0xbe,
+0x2d,0xff,0x18,0x01,0xf6,0x1a,0x6d,0x9e,0x02,0xfd,0x22,0xfa,0x8e,0x40,0x05,0x9e,
+0x04,0xff,0xd2,0xaf,0xfb,0x10,0x00,0x9e,0x0b,0xf4,0xd4,0x9f,0xe1,0xc4,0x00,0x9e,
+0x8f,0x70,0x7e,0xfe,0xfd,0xf4,0x00,0x9e,0x68,0x00,0x7a,0x20,0x8e,0xb0,0x00,0x01,
+0x00,0x2f,0x07,0xf9,0x08,0x00,0x09,0x25,0x7f,0x80,0x08,0x00,0x40,0xfe,0xcc,0xcc,
+0x50,0x08,0x00,0x00,0x90,0x02,0x00,0x08,0x00,0x39,0xfa,0x22,0x22,0x20,0x00,0x0f,
+0x08,0x00,0x01,0xb1,0x01,0x8f,0x91,0x18,0xfa,0x11,0x11,0x10,0x8f,0xff,0xff,0xa0,
+0x00,0x21,0x6c,0xcc,0x01,0x00,0x31,0xc1,0x06,0xbb,0x01,0x00,0x22,0xb0,0x08,0x18,
+0x00,0xe0,0xf0,0x01,0x11,0x11,0x18,0xf9,0x11,0x11,0x10,0x00,0x00,0x00,0x06,0xf8,
+0x40,0x00,0x22,0x02,0x10,0x08,0x00,0x43,0x2f,0xc0,0x06,0xf9,0x08,0x00,0x31,0xff,
+0xff,0xff,0x08,0x00,0x31,0xfe,0xcc,0xcc,0x08,0x00,0x04,0x20,0x00,0x0a,0x08,0x00,
+0x11,0xd0,0x78,0x00,0x00,0x05,0x02,0x01,0x80,0x01,0x11,0xdd,0x01,0x00,0x10,0xd6,
+0x1b,0x00,0xf1,0x69,0x0d,0xf1,0x91,0x00,0x5f,0xff,0xff,0xf1,0x0d,0xf6,0xfe,0x20,
+0x3b,0xef,0xcb,0xb1,0x0c,0xf1,0x4a,0x20,0x00,0xcf,0x10,0x00,0x3d,0xfc,0xef,0xb0,
+0x00,0xff,0xaa,0x6e,0xff,0xff,0xfd,0x80,0x04,0xff,0xff,0xa8,0x9c,0xf5,0x00,0x00,
+0x0a,0xf4,0x3f,0x70,0x08,0xf9,0x9b,0xe1,0x3f,0xd0,0x6f,0x7b,0xdf,0xff,0xfe,0xb2,
+0x8f,0x9d,0xcf,0x3f,0xdb,0xfb,0x17,0x70,0x1a,0x4e,0xfb,0x00,0x00,0xfd,0x6f,0xd1,
+0x00,0x09,0xf5,0x00,0x00,0xdf,0xfe,0x20,0x00,0x4f,0xc0,0x00,0x03,0xdf,0xd2,0x20,
+0x04,0xef,0x20,0x05,0xbf,0xff,0xd1,0xe5,0x3f,0xf6,0x00,0xcf,0xfa,0x29,0xff,0xf4,
+0x08,0x40,0x00,0x28,0x10,0x00,0xbf,0xb0,0x00,0x00,0x99,0x20,0x4e,0x01,0x92,0x05,
+0xff,0x65,0x55,0x55,0x55,0x50,0x00,0x0d,0xf0,0x00,0x40,0x00,0xbf,0xc5,0x55,0x10,
+0x00,0xb1,0x0a,0xff,0xa9,0x99,0x99,0x99,0x96,0x00,0x06,0xe6,0xff,0xc7,0x02,0xf2,
+0x02,0x00,0x05,0xf9,0x16,0xf7,0x15,0xf9,0x00,0x00,0x07,0xf6,0x06,0xf5,0x05,0xf8,
+0x00,0x2f,0xc8,0x00,0xf1,0x0c,0xfa,0x1a,0xaf,0xfb,0xae,0xfb,0xad,0xfc,0xa7,0x00,
+0x0e,0xf0,0x0c,0xf0,0x09,0xf4,0x00,0x00,0x1f,0xf9,0x9f,0xf9,0x9d,0xfb,0x92,0x00,
+0x4f,0x20,0x00,0x10,0xf3,0x63,0x00,0x31,0x36,0x8f,0xd0,0x6b,0x00,0x47,0x4f,0xfd,
+0x30,0x00,0x01,0x00,0xf4,0x02,0x01,0x10,0x00,0x00,0x01,0xfe,0x00,0x00,0xdf,0x20,
+0x00,0x00,0x1f,0xe0,0x00,0x0d,0xf2,0x0f,0x00,0x12,0x03,0x0f,0x00,0x21,0x02,0xf9,
+0x0f,0x00,0xf1,0x02,0x22,0xef,0xf2,0x1f,0xfd,0xdd,0x7d,0xf5,0xef,0xd2,0x01,0xff,
+0xff,0xf8,0xdf,0xff,0xb1,0x1e,0x00,0x22,0xff,0x60,0x2d,0x00,0x14,0x30,0x3c,0x00,
+0x12,0x20,0x3c,0x00,0xf4,0x12,0x09,0xd2,0x1f,0xe0,0x38,0x4d,0xf2,0x00,0xaf,0x33,
+0xff,0xef,0xf6,0xcf,0x20,0x0d,0xf1,0xaf,0xff,0xc7,0x1a,0xff,0xde,0xfd,0x07,0xf9,
+0x30,0x00,0x2d,0xff,0xfd,0x30,0x01,0x7e,0x00,0x22,0x03,0x72,0x08,0x00,0x22,0x0b,
+0xf7,0x08,0x00,0x02,0xd1,0x00,0xf1,0x05,0xc0,0x00,0xaf,0xc8,0x88,0x88,0x88,0x88,
+0x60,0x06,0xfe,0xcb,0xbb,0xbb,0xbb,0xb3,0x00,0x4f,0xf4,0xab,0x08,0x00,0x21,0x06,
+0xd8,0x17,0x00,0x30,0x00,0x00,0xbf,0x27,0x00,0xf0,0x0a,0xb0,0x00,0x00,0x03,0x10,
+0x09,0xa3,0x3f,0xb0,0x00,0x00,0x5f,0xd5,0x5f,0xe0,0x2f,0xc0,0x00,0x00,0x08,0xff,
+0xff,0x30,0x1f,0xd0,0x61,0x02,0xf3,0x10,0xff,0x60,0x0e,0xf0,0x80,0x00,0x19,0xff,
+0xaf,0xfa,0x0b,0xf4,0xf5,0x07,0xff,0xe3,0x04,0xfc,0x15,0xff,0xf2,0x05,0xf9,0x10,
+0x00,0x30,0x00,0x9f,0xb0,0x00,0x10,0x80,0x00,0x50,0xa5,0x00,0x00,0x02,0xfa,0x7f,
+0x01,0x11,0xc1,0x08,0x00,0x41,0x00,0x6e,0xe0,0xdf,0x08,0x00,0xf1,0x5b,0x01,0x30,
+0xdf,0x02,0xfb,0x7e,0xc0,0x00,0x00,0x00,0xdf,0x05,0xff,0xff,0xe0,0x0d,0xa2,0x00,
+0xdf,0xef,0xff,0x7e,0xe0,0x2d,0xff,0x5b,0xff,0xfd,0xfa,0x0e,0xe0,0x00,0x7a,0x2f,
+0xff,0x22,0xfa,0x0e,0xd0,0x00,0x00,0x03,0xdf,0x02,0xfa,0x0f,0xd0,0x00,0x08,0x90,
+0xdf,0x02,0xfb,0xef,0xb0,0x00,0x1f,0xf1,0xdf,0x02,0xfa,0xbb,0x30,0x00,0x9f,0x80,
+0xdf,0x00,0x10,0x04,0xc4,0x02,0xff,0x10,0xcf,0x10,0x00,0x07,0xf5,0x0b,0xf8,0x00,
+0xaf,0xdc,0xbb,0xcf,0xf1,0x01,0xa0,0x00,0x2c,0xff,0xff,0xfe,0x60,0x00,0x74,0x00,
+0x00,0x0b,0xf2,0x00,0x00,0x03,0xff,0xa1,0x08,0x00,0x60,0x00,0x8f,0xf5,0x00,0x0c,
+0xf3,0x10,0x01,0x10,0xa0,0x18,0x04,0xb2,0x70,0x00,0x00,0x00,0xbc,0xcf,0xfc,0xcc,
+0x50,0x0b,0x92,0x28,0x00,0x32,0x2d,0xff,0x50,0x20,0x00,0x22,0x6d,0x18,0x20,0x02,
+0xf0,0x1b,0x00,0x06,0xbb,0xef,0xeb,0xbb,0xb0,0x00,0x02,0xb0,0x00,0xdf,0x40,0x00,
+0x00,0x00,0x0a,0xf6,0x05,0xfb,0x04,0xb1,0x00,0x00,0x3f,0xd0,0x0d,0xf3,0x06,0xfa,
+0x00,0x00,0xdf,0x50,0x8f,0xc3,0x57,0xff,0x50,0x08,0xfc,0x02,0x30,0x00,0xb2,0xd0,
+0x04,0xe3,0x00,0xcc,0xa8,0x64,0x2c,0xf2,0x00,0x10,0x3d,0x03,0x60,0x01,0xa3,0x00,
+0x00,0x0e,0xf0,0x2f,0x01,0x11,0x90,0x08,0x00,0xc0,0x00,0x7f,0x96,0xaa,0xaf,0xfa,
+0xab,0x91,0x00,0x02,0x09,0xff,0x20,0x05,0xf0,0x0c,0x02,0x00,0x09,0xf4,0x1f,0xf1,
+0x5f,0x90,0x4f,0xc3,0x09,0xf3,0x0e,0xf0,0x6e,0x30,0x3c,0xfe,0x09,0xfb,0x9f,0xf9,
+0xa8,0x00,0x00,0x64,0x0a,0x20,0x00,0xf0,0x2a,0x10,0x00,0x00,0x0c,0xfd,0xf3,0x05,
+0xfb,0x00,0x00,0x2d,0x3d,0xf3,0xfc,0x0d,0xf5,0x00,0x00,0xaf,0x6e,0xe0,0x9f,0xbf,
+0xb0,0x00,0x01,0xfe,0x3f,0xb0,0x1e,0xff,0x20,0x00,0x0a,0xf7,0x7f,0x60,0x8f,0xff,
+0xa1,0x00,0x3f,0xf1,0xef,0x9e,0xfe,0x7d,0xff,0xb1,0x08,0x81,0xb9,0x5f,0xa1,0x00,
+0x8e,0x90,0x5a,0x01,0x01,0x78,0x01,0xf0,0x0d,0xa2,0x00,0x21,0x0d,0xf1,0x05,0x00,
+0x8f,0xf6,0x4f,0xa0,0xdf,0x14,0xfb,0x00,0x8f,0xe1,0xdf,0x2d,0xf1,0xaf,0x40,0x00,
+0x54,0x07,0xf7,0xdf,0x3f,0x76,0x01,0x80,0x26,0x0d,0xf2,0x33,0x01,0xda,0x10,0x0f,
+0xbd,0x02,0xe0,0x2c,0xfe,0x30,0xff,0xbb,0xbb,0xef,0x30,0x08,0xd0,0x0f,0xe0,0x00,
+0x0a,0x06,0x01,0x00,0x84,0x00,0xf1,0x03,0x30,0x00,0x75,0x0f,0xf8,0x88,0x8d,0xf3,
+0x00,0x1f,0xd0,0xff,0x88,0x88,0xdf,0x30,0x0a,0xf5,0x2d,0x00,0xf5,0x07,0x04,0xfd,
+0x00,0xfe,0x00,0x00,0xaf,0x30,0xdf,0x50,0x0f,0xd0,0x06,0xcf,0xf2,0x02,0xa0,0x00,
+0xfd,0x00,0x3f,0xe9,0xee,0x02,0xf0,0x03,0x04,0xd3,0x00,0x00,0x00,0xbf,0x6c,0x10,
+0x0c,0xff,0x50,0x00,0x00,0xbf,0x8f,0xc0,0x02,0xcf,0x08,0x00,0x53,0x19,0xb0,0x00,
+0x07,0x7f,0x59,0x01,0xf5,0x47,0x7f,0xba,0xaa,0xdf,0xba,0xa0,0x2d,0x70,0x7f,0x58,
+0x88,0x9f,0x33,0x20,0x5e,0xfb,0x7f,0x6c,0xcc,0x9f,0x4e,0xc0,0x00,0x82,0x7f,0x55,
+0x55,0x7f,0x9f,0x70,0x00,0x00,0x8f,0x8f,0xff,0x8f,0xff,0x20,0x00,0xc7,0x9f,0x7e,
+0x0f,0x6f,0xfa,0x00,0x03,0xfb,0xaf,0x5e,0x4f,0x4f,0xf3,0x00,0x09,0xf4,0xdd,0x5f,
+0xff,0x8f,0xf0,0xb2,0x1f,0xe2,0xf9,0x5e,0x16,0xff,0xf9,0xf5,0x7f,0x88,0xf5,0x00,
+0x8f,0xc2,0xff,0xf1,0x06,0x23,0xb0,0x00,0x2a,0x00,0x5e,0x80,0x81,0x00,0x12,0x40,
+0x07,0x00,0xf0,0x08,0x06,0xfd,0x42,0xff,0xff,0xff,0xfd,0x00,0x01,0x9f,0xe3,0xfd,
+0x88,0x89,0xfd,0x00,0x00,0x04,0x52,0xfc,0x66,0x67,0xfd,0x9d,0x01,0x01,0x18,0x00,
+0xb1,0x2d,0x70,0x02,0xfa,0x11,0x12,0xfd,0x00,0x5e,0xfe,0x12,0x10,0x00,0x70,0x00,
+0x9a,0x01,0x77,0x77,0x77,0x76,0x2a,0x04,0x00,0x02,0x03,0x40,0x30,0x00,0x1c,0x2a,
+0xb0,0x00,0xf2,0x04,0x50,0x00,0x8f,0x7a,0xf2,0xf5,0xca,0x7f,0x50,0x01,0xfe,0x0a,
+0xf1,0xf5,0xba,0x6f,0x50,0x09,0xf7,0x08,0x00,0xb0,0x2f,0xe0,0x9e,0xfb,0xfc,0xee,
+0xdf,0xc2,0x09,0x80,0xcf,0x28,0x00,0x15,0xf4,0x80,0x00,0x13,0x81,0xbe,0x05,0x22,
+0xfe,0x5b,0x18,0x00,0xe0,0x8f,0xaa,0xfb,0xbb,0xec,0xbb,0xb3,0x00,0x04,0x0a,0xf2,
+0x00,0xef,0x30,0x4a,0x02,0xf0,0x0a,0xf4,0x67,0xff,0x66,0x50,0x0a,0x70,0x0b,0xf6,
+0xff,0xee,0xef,0xd0,0x3e,0xfd,0x0b,0xf6,0xf8,0x33,0x3f,0xd0,0x00,0x96,0x0c,0xf5,
+0x10,0x00,0x41,0x00,0x00,0x0d,0xf4,0x10,0x00,0x30,0x49,0x0f,0xd4,0x59,0x02,0xf7,
+0x17,0x00,0xbf,0x7f,0xb1,0x52,0xcf,0x25,0x30,0x02,0xfd,0x7f,0x77,0xf6,0xcf,0x5f,
+0xb0,0x0a,0xf7,0xdf,0x5f,0xe0,0xcf,0x1c,0xf4,0x1f,0xf6,0xfb,0x4e,0x79,0xef,0x04,
+0xc4,0x04,0x72,0xb3,0x00,0x1f,0xe9,0x6f,0x04,0x50,0x67,0x00,0x3b,0x52,0x72,0x57,
+0x03,0x91,0xe1,0xcf,0x78,0xfa,0x11,0x10,0x00,0x06,0x78,0xca,0x03,0xf0,0x04,0x0c,
+0xb3,0x8f,0xfa,0x47,0xfa,0x44,0x30,0x19,0xfc,0xaf,0xff,0xef,0xff,0xee,0x10,0x00,
+0x22,0x27,0x10,0x00,0x42,0x00,0x00,0x09,0xe6,0x71,0x02,0xa1,0x8f,0xb5,0xf9,0x26,
+0xf9,0x22,0x00,0x09,0xfd,0x05,0xa1,0x02,0xd7,0x07,0xf2,0x05,0xfc,0x88,0x88,0x88,
+0x80,0x00,0x30,0x02,0x4f,0xf0,0xd1,0x05,0x50,0x0a,0xaa,0xaa,0xaf,0xfa,0xb1,0x08,
+0x30,0x00,0x00,0x0f,0x18,0x00,0x05,0x08,0x00,0x50,0x41,0x00,0x00,0x5c,0x70,0x71,
+0x03,0x92,0x77,0x77,0xaf,0xe7,0x77,0x72,0x00,0x7f,0xbf,0x00,0x01,0x10,0x02,0xda,
+0x07,0x00,0x32,0x05,0x10,0x07,0x79,0x03,0xf1,0x04,0x71,0x0d,0xb2,0x00,0x9a,0xaf,
+0xea,0xaa,0x00,0x2d,0xfd,0x03,0x66,0x7f,0xe6,0x66,0x40,0x00,0x84,0x83,0x06,0xc2,
+0xa0,0x00,0x00,0x08,0xf5,0x3f,0xd3,0x4f,0xa0,0x00,0x0d,0x38,0x10,0x00,0xa1,0x6f,
 0x98,0xf5,0x3f,0xd2,0x4f,0xa0,0x00,0xdf,0x28,0x10,0x00,0xf3,0x09,0x05,0xfb,0x02,
 0x6e,0xa5,0x5d,0xf7,0x30,0x0d,0xf4,0x4a,0xff,0xa1,0x1a,0xff,0x80,0x04,0xb0,0x6f,
-0xc4,0x00,0x00,0x4d,0xe3,0xf0,0x02,0x32,0x10,0x00,0xa6,0x55,0x14,0x41,0x04,0xff,
-0xc1,0xdf,0xbd,0x39,0xd1,0x3d,0xe0,0xdc,0x2c,0xf3,0x7f,0x40,0x00,0x00,0x30,0xdf,
-0xef,0xff,0x5f,0x23,0x72,0x45,0x5d,0xf6,0x55,0x20,0x0d,0xc3,0x03,0x4a,0x30,0x2c,
-0xff,0x47,0xe2,0x0f,0x53,0x73,0x00,0x6c,0x00,0xdf,0x52,0x7f,0xf0,0x12,0xde,0x66,
-0x66,0x9f,0x60,0x00,0x05,0x60,0xdf,0xdd,0xdd,0xef,0x60,0x00,0x0e,0xf1,0xdf,0xaa,
-0xaa,0xcf,0x60,0x00,0x7f,0xa0,0xde,0x66,0x66,0xaf,0x60,0x01,0xff,0x20,0xcf,0x28,
-0x00,0xd0,0x0a,0xf9,0x01,0x6e,0xf5,0x0c,0xfb,0x20,0x07,0xf1,0x2f,0xfd,0x50,0x2c,
-0x61,0x31,0x10,0x04,0x30,0x00,0x4d,0x2a,0x04,0x61,0x9b,0x13,0x02,0xe0,0x62,0xf3,
-0x0a,0xa0,0x0a,0xff,0xec,0xfd,0xdf,0xce,0xfc,0x80,0x3f,0xff,0xa3,0xf6,0x6f,0x29,
-0xf1,0x00,0x03,0x4f,0xa3,0xf6,0x7f,0x3a,0xf2,0x00,0xf3,0x44,0xb2,0xa0,0x06,0xaf,
-0xeb,0xfc,0xcf,0xbd,0xfa,0x60,0x00,0x0f,0x20,0x00,0x11,0x1a,0x10,0x00,0x34,0xfb,
-0xa1,0x1f,0xff,0x23,0xf0,0x03,0x66,0x11,0x31,0x13,0x21,0x67,0x00,0x01,0xff,0x19,
-0xf3,0x5f,0x91,0xef,0x40,0x0a,0xf9,0x07,0x93,0x4d,0x8d,0xe0,0x1c,0xe1,0x06,0xe5,
-0x0c,0xc1,0x0c,0x0c,0x63,0x00,0xc6,0x0b,0x33,0x0c,0xf1,0x24,0x08,0x00,0x40,0xee,
-0x10,0x03,0x52,0x08,0x00,0x40,0x7f,0x80,0x0e,0xe4,0x08,0x00,0xe1,0x0e,0xb0,0x07,
-0xfc,0xfb,0x00,0x0d,0xf1,0x03,0x00,0x00,0xef,0xfb,0xef,0xa0,0x01,0x30,0x33,0xfb,
-0xcd,0xe3,0x4f,0x00,0x86,0x0b,0x20,0x0f,0xf8,0x81,0x5d,0xf0,0x0e,0xfb,0x00,0x3f,
-0xfe,0x00,0x00,0x04,0xef,0xfb,0x00,0x8f,0xef,0x50,0x00,0x1f,0xf8,0xfb,0x00,0xef,
-0x2f,0xd0,0x00,0x07,0x32,0xfb,0x08,0xf9,0x08,0xf9,0x58,0x00,0x30,0x4f,0xf2,0x01,
-0xa7,0x58,0xe8,0xfd,0xff,0x60,0x00,0x2e,0xf7,0x00,0x02,0xfb,0xa7,0x00,0x00,0x02,
-0xa0,0x82,0x00,0x03,0x83,0x03,0x00,0x69,0x80,0x04,0xe8,0x00,0xf7,0x2f,0xf4,0x06,
-0xaa,0xaa,0xcf,0xda,0xba,0xaa,0xa2,0x02,0xc6,0x00,0xce,0x19,0xe2,0x4d,0x40,0x02,
-0xcf,0xaa,0xff,0xff,0x85,0xfe,0x30,0x00,0x09,0x35,0xae,0xf8,0x12,0xa2,0x00,0x00,
-0x17,0xd0,0x8f,0x8b,0xd8,0xd4,0x00,0x0a,0xff,0xbd,0xff,0xef,0xfd,0xef,0xa0,0x08,
-0xb3,0x0a,0xcc,0xb7,0xbb,0x1b,0xa0,0x01,0x11,0x11,0x1d,0xf4,0x75,0x54,0x03,0x59,
-0x11,0x14,0xa5,0x8d,0x3b,0x04,0x08,0x00,0x21,0x4f,0xff,0x7c,0x49,0xf1,0x01,0xb0,
-0x3c,0xdf,0xec,0x4f,0xd8,0x88,0x9f,0xb0,0x00,0x5f,0x70,0x1f,0xd6,0x66,0x7f,0x08,
-0x00,0x00,0x18,0x00,0x31,0x02,0x7f,0x82,0x73,0x0c,0x31,0x2f,0xff,0xff,0xd6,0x23,
-0x71,0x19,0xbf,0xc9,0x2f,0xd7,0x77,0x8f,0x20,0x00,0x03,0x30,0x00,0x11,0x2f,0xf2,
-0x06,0xf0,0x08,0x8f,0xef,0x70,0xfd,0x1f,0xc0,0x00,0x7f,0xff,0xea,0x35,0xfa,0x0f,
-0xc0,0x20,0x4b,0x72,0x00,0x3e,0xf3,0x0f,0xc0,0xe8,0xf2,0x37,0x30,0x80,0x0f,0xea,
-0xa3,0x74,0x34,0xc5,0x00,0x09,0x02,0x77,0x01,0xca,0x54,0x10,0x7f,0xa8,0x03,0xf1,
-0x00,0x4c,0xef,0xdb,0x7f,0xba,0xfc,0x9f,0xd0,0x00,0x9f,0x30,0x7f,0x41,0xf8,0x0e,
-0x08,0x00,0x01,0xc0,0x03,0xa1,0x9f,0x40,0x7f,0xa9,0xfc,0x8f,0xd0,0x3f,0xff,0xfa,
-0x18,0x00,0x33,0x2b,0xef,0xc7,0x18,0x00,0x60,0x30,0x49,0x9a,0xfd,0x99,0x80,0xb3,
-0x31,0x01,0xcd,0x1a,0x31,0x9f,0x56,0x9f,0xb8,0x23,0xa1,0xcf,0xff,0x6a,0xab,0xfe,
-0xaa,0xa0,0x7f,0xff,0xc6,0x19,0x3f,0x83,0x3c,0x71,0x08,0xcc,0xcd,0xfe,0xcc,0xc7,
-0x4a,0x01,0x43,0xf9,0x00,0x09,0x81,0x93,0x48,0x03,0x40,0x2c,0x22,0x7f,0xc0,0x08,
-0x00,0x20,0xcf,0xec,0xf5,0x1c,0x23,0x50,0x04,0x2f,0x40,0x22,0x0d,0xf7,0x48,0x2a,
-0x22,0x3e,0xc0,0xa0,0x03,0x23,0x01,0x20,0xa8,0x03,0x13,0x4f,0x7e,0x38,0x10,0x4d,
-0xb1,0x0f,0x1f,0xdb,0xf5,0x54,0x06,0x04,0xa0,0x2e,0x21,0x2e,0xee,0x01,0x00,0x31,
-0xe3,0x00,0x8b,0x31,0x0a,0x23,0x10,0x0c,0x68,0x11,0xb0,0xcf,0x31,0x1e,0xf2,0x11,
-0xdf,0x10,0x0c,0xf1,0x00,0xdf,0x5b,0x42,0x65,0xcf,0xdc,0xcf,0xfd,0xcc,0xff,0x1e,
-0x00,0xb0,0xdf,0x10,0x0d,0xf0,0x00,0xcf,0x10,0x0e,0xf1,0x00,0xef,0x23,0x00,0x03,
-0x39,0x1f,0xa1,0x1f,0xfb,0xbb,0xff,0xcb,0xbf,0xf1,0x05,0xfa,0x00,0x1e,0x00,0x21,
-0xbf,0x50,0x3c,0x00,0xf3,0x01,0x4f,0xe1,0x00,0x0d,0xf2,0xbb,0xff,0x03,0xd5,0x00,
-0x00,0xdf,0x0e,0xff,0x70,0x01,0x6d,0x62,0x12,0xff,0x01,0x00,0x12,0xbc,0xb1,0x0a,
-0x05,0xe1,0x4f,0x01,0x9e,0x08,0xf0,0x07,0xad,0x2c,0xff,0xff,0xff,0xc2,0xeb,0xcf,
-0x3c,0xc0,0xdc,0x0d,0xc2,0xfc,0xcf,0x3c,0xd7,0xee,0x7e,0xc2,0xfc,0xcf,0x3f,0x7d,
-0x00,0x07,0x00,0x36,0xb0,0xdc,0x0d,0x0e,0x00,0x81,0x37,0x99,0x99,0x99,0x72,0xfc,
-0xcf,0x30,0xd6,0x46,0x03,0x82,0x3b,0x12,0x8b,0x1b,0x36,0x00,0x16,0x01,0x90,0x24,
-0x68,0xa1,0x00,0x00,0xde,0xff,0xff,0xff,0x09,0x7b,0x60,0x8b,0xe8,0x8f,0xf4,0x2c,
-0x70,0x0e,0x1e,0xd4,0x0f,0xe0,0x5f,0xd0,0x00,0x01,0x16,0xf9,0x1f,0xf1,0xcf,0x51,
-0x10,0x8b,0x03,0x10,0x18,0x86,0x3f,0xf1,0x06,0xfa,0x88,0x81,0x00,0x3a,0xfd,0x4f,
-0xf6,0xff,0xa5,0x10,0x3e,0xff,0x90,0x09,0x90,0x1a,0xff,0xf2,0x0a,0xcf,0x56,0x00,
-0xf0,0x00,0x50,0x00,0x5f,0xc7,0x7f,0xf7,0x7c,0xf5,0x00,0x00,0x5f,0xda,0xaf,0xfa,
-0xae,0x08,0x00,0x66,0xd9,0x9f,0xf9,0x9d,0xf5,0x00,0x18,0x00,0x00,0x28,0x00,0x02,
-0xd0,0x1b,0x50,0x35,0x01,0x20,0x00,0x07,0xe8,0x09,0xf0,0x0c,0x3d,0xf2,0x00,0x03,
-0x88,0x8e,0xf5,0x4f,0xff,0x54,0x20,0x04,0xe5,0x5f,0xc0,0x0a,0xf8,0x6f,0xd0,0x01,
-0xcf,0xff,0x95,0x57,0xff,0xfb,0x10,0x64,0x6a,0x00,0xa2,0x76,0x91,0x3b,0xfe,0x41,
-0x22,0x22,0x23,0xef,0xf6,0x3f,0xca,0x45,0x30,0xc9,0xe1,0x01,0x16,0x48,0x22,0xbf,
-0xb0,0xd0,0x29,0x10,0x5f,0x08,0x00,0x03,0xac,0x09,0x61,0x07,0xaf,0x98,0x89,0xeb,
-0x60,0x82,0x84,0xd5,0x07,0xf7,0x00,0x00,0x09,0x99,0xbf,0xd9,0x9e,0xfa,0x99,0x90,
-0x0f,0x1c,0x13,0x51,0x68,0x00,0x00,0x66,0x20,0xb1,0x59,0x00,0x85,0x8e,0x13,0x05,
-0x2b,0x02,0x50,0x02,0x88,0x88,0xcf,0xc8,0xf3,0x06,0x40,0x6c,0xcc,0xef,0xdc,0x6a,
-0x02,0xa1,0x6b,0xbd,0xfe,0xbb,0xbb,0xb7,0x00,0x08,0x88,0x8c,0x03,0x06,0x05,0xdb,
-0x2b,0x60,0x03,0xff,0xb8,0x88,0x88,0x86,0x54,0x13,0x70,0xa9,0x99,0x9b,0xfb,0x00,
-0x08,0xff,0x09,0x66,0xd3,0xfb,0x00,0x4f,0xf4,0xcf,0x75,0x55,0x58,0xfb,0x00,0x06,
-0x30,0xcf,0x68,0x17,0x53,0xcf,0x76,0x66,0x69,0xfb,0x34,0x11,0x03,0x55,0x10,0x60,
-0x75,0x00,0x00,0x17,0x77,0x77,0xbb,0x35,0x00,0x82,0x02,0x10,0xcf,0x50,0x00,0xf0,
-0x02,0x14,0xbf,0x54,0xbd,0xaf,0xf8,0x8c,0xf0,0x00,0xdf,0x00,0x99,0xbf,0x8b,0xb7,
-0xc0,0x01,0x84,0x5f,0x71,0x8e,0xf8,0x50,0x06,0xfe,0xcc,0x7f,0xb3,0x06,0xb0,0xfd,
-0xef,0xff,0xf2,0x0d,0xe0,0x00,0x4f,0xf5,0x9f,0x6c,0xb4,0x09,0x93,0x8f,0xf5,0x9f,
-0x0a,0xf8,0x6e,0xf6,0x30,0x1b,0x08,0x00,0xc0,0x03,0xf8,0xbf,0x0a,0xfe,0xef,0xfe,
-0x70,0x03,0xff,0xff,0x0a,0x28,0x00,0x41,0x03,0xf9,0x44,0x0a,0xe0,0x1e,0x90,0x62,
-0x00,0x0a,0xfa,0x99,0x99,0x90,0x00,0x7b,0xe8,0x01,0x16,0xb7,0xbe,0x4c,0x01,0x4a,
-0x47,0x15,0x21,0xa8,0x04,0x03,0x9c,0x0c,0x15,0xd1,0x3c,0x14,0x04,0x83,0x66,0x60,
-0x1b,0x70,0x0f,0xf1,0x07,0xa0,0xb3,0x5c,0x30,0x0f,0xf1,0x0d,0xeb,0x7b,0x91,0x40,
-0x0f,0xf1,0x04,0xff,0x10,0x0c,0xfb,0x00,0xc3,0x2d,0x21,0x4f,0xd1,0xc3,0x2d,0x90,
-0xe0,0x02,0x20,0x9f,0xff,0xf0,0x00,0x06,0x10,0xf2,0x0b,0x19,0x50,0xf2,0x0b,0xb0,
-0x6b,0x10,0x00,0xfb,0x00,0x00,0x19,0xcf,0xff,0xa0,0x00,0xae,0x8e,0x00,0xc3,0x31,
-0xf1,0x2f,0xfb,0x03,0x00,0x02,0x1f,0xc0,0x06,0xc4,0xfb,0x9f,0x30,0x00,0x1f,0xd0,
-0x0a,0xf3,0xfb,0x4f,0xa0,0x6f,0xff,0xff,0xcc,0xf1,0xfb,0x0e,0xf0,0x4b,0xdf,0xfb,
-0xaf,0xb0,0xfb,0x09,0xf5,0x00,0xaf,0xf6,0x4f,0x60,0xfb,0x03,0x61,0x02,0xff,0xff,
-0x61,0x10,0xfb,0x1d,0x80,0x0d,0xef,0xdb,0x50,0x00,0xda,0x9f,0x80,0x7f,0x6f,0xc0,
-0x70,0x5f,0x31,0x2c,0x0f,0xc0,0x9e,0x67,0x41,0x01,0x0f,0xc0,0x03,0x81,0x6b,0x51,
-0x0f,0xc1,0xff,0xff,0x91,0x59,0x17,0x22,0x8b,0x61,0x35,0x4d,0x20,0x00,0x54,0xc1,
-0x08,0x41,0x8b,0xff,0x60,0xef,0x9c,0x13,0xa2,0xe7,0x23,0xfe,0x99,0x99,0x93,0x02,
-0x3f,0xa0,0x09,0xc8,0x43,0x71,0xa0,0x2f,0xf2,0xef,0x2e,0xd0,0x3f,0x22,0x81,0xf0,
-0x2d,0x2e,0x70,0x2b,0xdf,0xeb,0x69,0x10,0xef,0x02,0x00,0x00,0xaf,0xe3,0x06,0xf5,
+0xc4,0x00,0x00,0x4d,0xe3,0xf0,0x02,0xc0,0x10,0x00,0xa6,0x00,0x00,0x0b,0xf0,0x00,
+0x00,0x04,0xff,0xc1,0x41,0x08,0xe0,0x40,0x00,0x3d,0xe0,0xdc,0x2c,0xf3,0x7f,0x40,
+0x00,0x00,0x30,0xdf,0xef,0x10,0x00,0xa1,0x00,0x00,0x45,0x5d,0xf6,0x55,0x20,0x0d,
+0xc3,0x1f,0xc8,0x00,0xc1,0x2c,0xff,0x47,0x77,0x77,0x77,0x77,0x73,0x00,0x6c,0x00,
+0xdf,0x51,0x07,0xf0,0x14,0x00,0x00,0xde,0x66,0x66,0x9f,0x60,0x00,0x05,0x60,0xdf,
+0xdd,0xdd,0xef,0x60,0x00,0x0e,0xf1,0xdf,0xaa,0xaa,0xcf,0x60,0x00,0x7f,0xa0,0xde,
+0x66,0x66,0xaf,0x60,0x01,0xff,0x20,0xcf,0x28,0x00,0xf2,0x0c,0x0a,0xf9,0x01,0x6e,
+0xf5,0x0c,0xfb,0x20,0x07,0xf1,0x2f,0xfd,0x50,0x00,0x8f,0xf4,0x00,0x10,0x04,0x30,
+0x00,0x00,0x02,0x40,0x00,0x04,0x61,0x0e,0x01,0x22,0x0e,0xf5,0x08,0x00,0x21,0xaf,
+0xff,0xb8,0x00,0xf2,0x0b,0x0a,0xff,0xec,0xfd,0xdf,0xce,0xfc,0x80,0x3f,0xff,0xa3,
+0xf6,0x6f,0x29,0xf1,0x00,0x03,0x4f,0xa3,0xf6,0x7f,0x3a,0xf2,0x00,0x0a,0xff,0x20,
+0x00,0xa2,0x06,0xaf,0xeb,0xfc,0xcf,0xbd,0xfa,0x60,0x00,0x0f,0x20,0x00,0x11,0x1a,
+0x10,0x00,0x23,0xfb,0xa1,0x70,0x01,0xfc,0x13,0xf2,0x00,0x66,0x11,0x31,0x13,0x21,
+0x67,0x00,0x01,0xff,0x19,0xf3,0x5f,0x91,0xef,0x40,0x0a,0xf9,0x07,0xf5,0x0f,0xe0,
+0x5f,0xe0,0x1c,0xe1,0x06,0xe5,0x0c,0xc1,0x0c,0xd3,0x00,0x01,0x00,0x63,0x02,0xfb,
+0x00,0x0c,0xf1,0x24,0x08,0x00,0x40,0xee,0x10,0x03,0x52,0x08,0x00,0x40,0x7f,0x80,
+0x0e,0xe4,0x08,0x00,0xe1,0x0e,0xb0,0x07,0xfc,0xfb,0x00,0x0d,0xf1,0x03,0x00,0x00,
+0xef,0xfb,0xef,0xa0,0x01,0xc0,0x33,0xfb,0xcd,0xdf,0xfe,0xdd,0xd4,0x00,0x03,0xfb,
+0x00,0x0f,0xc2,0x07,0xf0,0x0f,0x1c,0xfb,0x00,0x3f,0xfe,0x00,0x00,0x04,0xef,0xfb,
+0x00,0x8f,0xef,0x50,0x00,0x1f,0xf8,0xfb,0x00,0xef,0x2f,0xd0,0x00,0x07,0x32,0xfb,
+0x08,0xf9,0x08,0xf9,0x58,0x00,0xf8,0x06,0x4f,0xf2,0x01,0xef,0x80,0x00,0x02,0xfd,
+0xff,0x60,0x00,0x2e,0xf7,0x00,0x02,0xfb,0xa7,0x00,0x00,0x02,0xa0,0x82,0x00,0x03,
+0x83,0x03,0x10,0x1e,0x15,0x03,0x03,0xe8,0x00,0xf8,0x32,0xf4,0x06,0xaa,0xaa,0xcf,
+0xda,0xba,0xaa,0xa2,0x02,0xc6,0x00,0xce,0x19,0xe2,0x4d,0x40,0x02,0xcf,0xaa,0xff,
+0xff,0x85,0xfe,0x30,0x00,0x09,0x35,0xae,0xf8,0x12,0xa2,0x00,0x00,0x17,0xd0,0x8f,
+0x8b,0xd8,0xd4,0x00,0x0a,0xff,0xbd,0xff,0xef,0xfd,0xef,0xa0,0x08,0xb3,0x0a,0xcc,
+0xb7,0xbb,0x1b,0xa0,0x01,0x11,0x11,0x1d,0xf4,0x11,0x11,0x10,0x80,0x02,0x12,0xfb,
+0x80,0x02,0x11,0x0d,0x76,0x07,0x02,0x08,0x00,0x00,0x88,0x07,0x10,0x5f,0xe8,0x02,
+0xf1,0x00,0x3c,0xdf,0xec,0x4f,0xd8,0x88,0x9f,0xb0,0x00,0x5f,0x70,0x1f,0xd6,0x66,
+0x7f,0x08,0x00,0x00,0x18,0x00,0xc0,0x02,0x7f,0x82,0x1f,0xb0,0x00,0x2f,0xb0,0x2f,
+0xff,0xff,0x3f,0x10,0x00,0x71,0x19,0xbf,0xc9,0x2f,0xd7,0x77,0x8f,0x20,0x00,0x03,
+0x30,0x00,0x11,0x2f,0xf2,0x06,0xf4,0x18,0x8f,0xef,0x70,0xfd,0x1f,0xc0,0x00,0x7f,
+0xff,0xea,0x35,0xfa,0x0f,0xc0,0x20,0x4b,0x72,0x00,0x3e,0xf3,0x0f,0xc0,0xe8,0x00,
+0x00,0x3b,0xff,0x80,0x0f,0xea,0xf8,0x00,0x00,0x0d,0xc5,0x00,0x09,0xff,0xe2,0xed,
+0x00,0x40,0x5f,0xff,0xfe,0x7f,0xa8,0x03,0xf1,0x00,0x4c,0xef,0xdb,0x7f,0xba,0xfc,
+0x9f,0xd0,0x00,0x9f,0x30,0x7f,0x41,0xf8,0x0e,0x08,0x00,0x01,0xc0,0x03,0xa1,0x9f,
+0x40,0x7f,0xa9,0xfc,0x8f,0xd0,0x3f,0xff,0xfa,0x18,0x00,0x33,0x2b,0xef,0xc7,0x18,
+0x00,0xf1,0x02,0x30,0x49,0x9a,0xfd,0x99,0x80,0x00,0x9f,0x30,0x00,0x04,0xfb,0x00,
+0x00,0x00,0x9f,0x56,0xe1,0x0a,0xf3,0x09,0x04,0xcf,0xff,0x6a,0xab,0xfe,0xaa,0xa0,
+0x7f,0xff,0xc6,0x00,0x03,0xfa,0x00,0x00,0x3c,0x71,0x08,0xcc,0xcd,0xfe,0xcc,0xc7,
+0x4a,0x01,0x42,0xf9,0x00,0x09,0x81,0x70,0x03,0x22,0x1f,0xf1,0x08,0x00,0x22,0x7f,
+0xc0,0x08,0x00,0x82,0xcf,0xec,0xcf,0xfd,0xcc,0xcc,0x50,0x04,0x28,0x01,0xb2,0x60,
+0x0d,0xf7,0x00,0x0f,0xf1,0x00,0x00,0x00,0x3e,0xc0,0xa0,0x03,0x23,0x01,0x20,0xa8,
+0x03,0x12,0x4f,0x80,0x0b,0x76,0x00,0x4d,0xdd,0xdf,0xfd,0xdd,0xdb,0xc0,0x03,0x0b,
+0x08,0x00,0x03,0xf9,0x08,0x31,0xf3,0x2e,0xee,0x01,0x00,0x31,0xe3,0x00,0x8b,0x31,
+0x0a,0x22,0x10,0x0c,0x48,0x0a,0xf5,0x07,0x00,0xcf,0x31,0x1e,0xf2,0x11,0xdf,0x10,
+0x0c,0xf1,0x00,0xdf,0x00,0x0c,0xf1,0x00,0xcf,0xdc,0xcf,0xfd,0xcc,0xff,0x1e,0x00,
+0xb0,0xdf,0x10,0x0d,0xf0,0x00,0xcf,0x10,0x0e,0xf1,0x00,0xef,0x23,0x00,0x02,0x4c,
+0x00,0xb1,0x10,0x1f,0xfb,0xbb,0xff,0xcb,0xbf,0xf1,0x05,0xfa,0x00,0x1e,0x00,0x21,
+0xbf,0x50,0x3c,0x00,0xf1,0x00,0x4f,0xe1,0x00,0x0d,0xf2,0xbb,0xff,0x03,0xd5,0x00,
+0x00,0xdf,0x0e,0xff,0x70,0xcf,0x03,0x23,0x11,0x00,0x34,0x00,0x22,0xff,0xbc,0xb1,
+0x0a,0x04,0x6f,0x01,0x11,0x06,0x9e,0x08,0xf0,0x04,0xad,0x2c,0xff,0xff,0xff,0xc2,
+0xeb,0xcf,0x3c,0xc0,0xdc,0x0d,0xc2,0xfc,0xcf,0x3c,0xd7,0xee,0x7e,0x07,0x00,0x30,
+0xff,0xff,0xff,0x07,0x00,0x36,0xb0,0xdc,0x0d,0x0e,0x00,0x80,0x37,0x99,0x99,0x99,
+0x72,0xfc,0xcf,0x30,0x98,0x02,0x31,0xfc,0xcf,0xff,0xfd,0x00,0x01,0xcb,0x00,0x20,
+0xbc,0xfc,0x16,0x01,0x60,0x24,0x68,0xa1,0x00,0x00,0xde,0x16,0x00,0xf4,0x0b,0xe9,
+0x00,0x00,0x8b,0xe8,0x8f,0xf4,0x2c,0x70,0x00,0x00,0x0c,0xf3,0x0f,0xe0,0x5f,0xd0,
+0x00,0x01,0x16,0xf9,0x1f,0xf1,0xcf,0x51,0x10,0x8b,0x03,0xf1,0x0b,0x18,0x88,0xaf,
+0xff,0xff,0xfa,0x88,0x81,0x00,0x3a,0xfd,0x4f,0xf6,0xff,0xa5,0x10,0x3e,0xff,0x90,
+0x09,0x90,0x1a,0xff,0xf2,0x0a,0xcf,0x56,0x00,0xf0,0x00,0x50,0x00,0x5f,0xc7,0x7f,
+0xf7,0x7c,0xf5,0x00,0x00,0x5f,0xda,0xaf,0xfa,0xae,0x08,0x00,0x66,0xd9,0x9f,0xf9,
+0x9d,0xf5,0x00,0x18,0x00,0x00,0x28,0x00,0x11,0xe5,0xc8,0x00,0x50,0x35,0x01,0x20,
+0x00,0x07,0xe8,0x09,0xf0,0x1e,0x3d,0xf2,0x00,0x03,0x88,0x8e,0xf5,0x4f,0xff,0x54,
+0x20,0x04,0xe5,0x5f,0xc0,0x0a,0xf8,0x6f,0xd0,0x01,0xcf,0xff,0x95,0x57,0xff,0xfb,
+0x10,0x00,0x6f,0xfe,0xff,0xff,0xff,0xfb,0x20,0x3b,0xfe,0x41,0x22,0x22,0x23,0xef,
+0xf6,0x3f,0xae,0x40,0x00,0x90,0xc9,0xe1,0x01,0x0d,0xf9,0x88,0x88,0xbf,0xb0,0x51,
+0x0b,0x30,0x00,0x00,0x5f,0x08,0x00,0x03,0xac,0x09,0x60,0x07,0xaf,0x98,0x89,0xeb,
+0x60,0xed,0x08,0xe3,0x80,0x07,0xf7,0x00,0x00,0x09,0x99,0xbf,0xd9,0x9e,0xfa,0x99,
+0x90,0x0f,0xfc,0x0b,0x60,0x00,0x01,0x68,0x00,0x00,0x66,0x0f,0x0b,0x73,0xef,0x40,
+0x02,0xff,0x20,0x00,0x05,0x2b,0x02,0x50,0x02,0x88,0x88,0xcf,0xc8,0xf3,0x06,0x40,
+0x6c,0xcc,0xef,0xdc,0x6a,0x02,0xa1,0x6b,0xbd,0xfe,0xbb,0xbb,0xb7,0x00,0x08,0x88,
+0x8c,0x03,0x06,0x23,0x0f,0xff,0x34,0x0b,0xe0,0x03,0xff,0xb8,0x88,0x88,0x86,0x00,
+0x00,0x3f,0xff,0xa9,0x99,0x9b,0xfb,0x0b,0x0a,0xf0,0x01,0xee,0xee,0xee,0xfb,0x00,
+0x4f,0xf4,0xcf,0x75,0x55,0x58,0xfb,0x00,0x06,0x30,0xcf,0xb0,0x00,0x00,0x8c,0x02,
+0x31,0x76,0x66,0x69,0x08,0x00,0x02,0x10,0x00,0x00,0x01,0x00,0x91,0x75,0x00,0x00,
+0x17,0x77,0x77,0x00,0x03,0xfd,0x82,0x02,0x10,0xcf,0x50,0x00,0xf1,0x0d,0x14,0xbf,
+0x54,0xbd,0xaf,0xf8,0x8c,0xf0,0x00,0xdf,0x00,0x99,0xbf,0x8b,0xb7,0xc0,0x01,0xfb,
+0x00,0x07,0xff,0x8e,0xf8,0x50,0x06,0xfe,0xcc,0x7f,0xb3,0x06,0xb0,0xfd,0xef,0xff,
+0xf2,0x0d,0xe0,0x00,0x4f,0xf5,0x9f,0x6c,0xb4,0x09,0x93,0x8f,0xf5,0x9f,0x0a,0xf8,
+0x6e,0xf6,0x30,0x1b,0x08,0x00,0xc0,0x03,0xf8,0xbf,0x0a,0xfe,0xef,0xfe,0x70,0x03,
+0xff,0xff,0x0a,0x28,0x00,0x40,0x03,0xf9,0x44,0x0a,0xe8,0x00,0x80,0x01,0x62,0x00,
+0x0a,0xfa,0x99,0x99,0x90,0xf4,0x09,0x00,0x7b,0xbb,0xbb,0xbb,0xbb,0xb7,0x00,0x00,
+0xaf,0xff,0xff,0xff,0xff,0xfa,0x00,0x00,0x12,0x22,0x22,0x22,0x22,0x21,0x00,0x01,
+0x00,0x21,0x1d,0xdd,0x01,0x00,0x31,0xd1,0x1f,0xff,0x01,0x00,0x60,0xf1,0x00,0x00,
+0x00,0x0f,0xf2,0x19,0x00,0xf0,0x12,0x1b,0x70,0x0f,0xf1,0x07,0xa0,0x00,0x00,0x8f,
+0xc0,0x0f,0xf1,0x0d,0xf6,0x00,0x01,0xef,0x40,0x0f,0xf1,0x04,0xff,0x10,0x0c,0xfb,
+0x00,0x0f,0xf1,0x00,0xbf,0x90,0x4f,0xd1,0x08,0x00,0xf7,0x01,0x4f,0xe0,0x02,0x20,
+0x9f,0xff,0xf0,0x00,0x06,0x10,0x00,0x00,0x4f,0xfd,0x50,0x00,0x01,0x00,0xb0,0x01,
+0x6b,0x10,0x00,0xfb,0x00,0x00,0x19,0xcf,0xff,0xa0,0x08,0x00,0xf0,0x4f,0x1f,0xff,
+0xe4,0x00,0x00,0xfb,0x03,0x00,0x02,0x1f,0xc0,0x06,0xc4,0xfb,0x9f,0x30,0x00,0x1f,
+0xd0,0x0a,0xf3,0xfb,0x4f,0xa0,0x6f,0xff,0xff,0xcc,0xf1,0xfb,0x0e,0xf0,0x4b,0xdf,
+0xfb,0xaf,0xb0,0xfb,0x09,0xf5,0x00,0xaf,0xf6,0x4f,0x60,0xfb,0x03,0x61,0x02,0xff,
+0xff,0x61,0x10,0xfb,0x1d,0x80,0x0d,0xef,0xdb,0x50,0x00,0xda,0x9f,0x80,0x7f,0x6f,
+0xc0,0x00,0x00,0x06,0xfe,0x00,0x2c,0x0f,0xc0,0x00,0x00,0x8f,0xf4,0x00,0x01,0x0f,
+0xc0,0x03,0x8f,0xff,0x40,0x00,0x00,0x0f,0xc1,0xff,0xff,0x91,0xb6,0x00,0x31,0xc0,
+0x8b,0x61,0x79,0x00,0xb0,0x15,0x00,0x54,0x00,0x00,0x00,0x05,0x8b,0xff,0x60,0xef,
+0x17,0x00,0xf0,0x50,0xff,0xe7,0x23,0xfe,0x99,0x99,0x93,0x02,0x3f,0xa0,0x09,0xff,
+0xff,0xff,0xf3,0x00,0x1f,0xa0,0x2f,0xf2,0xef,0x2e,0xd0,0x3f,0xff,0xff,0xff,0x80,
+0xef,0x2e,0x70,0x2b,0xdf,0xeb,0x69,0x10,0xef,0x02,0x00,0x00,0xaf,0xe3,0x06,0xf5,
 0xef,0x6f,0x50,0x02,0xff,0xff,0x3a,0xf2,0xef,0x2f,0xa0,0x0b,0xef,0xbe,0x6e,0xe0,
 0xef,0x0d,0xf0,0x5f,0x7f,0xa2,0x6f,0x80,0xef,0x09,0xf3,0x3c,0x1f,0xa0,0xbf,0x10,
-0xef,0x06,0xf7,0x01,0x1f,0xa0,0x03,0x00,0xef,0x01,0x20,0x00,0x1f,0x2e,0x91,0x02,
-0x2c,0x10,0x23,0x4e,0xc5,0xf8,0x66,0x00,0xc6,0x7c,0x50,0x7b,0xff,0x20,0x0c,0xf9,
-0x60,0x6d,0xf0,0x08,0xe7,0x13,0xdf,0xff,0xff,0x80,0x03,0x3f,0xb0,0x8f,0xf9,0x89,
-0xff,0x30,0x01,0x2f,0xb1,0x5c,0x8d,0x7c,0xf7,0x00,0x5f,0x1c,0x24,0x80,0xff,0x60,
-0x00,0x39,0xdf,0xe9,0xac,0xff,0x32,0x01,0xf0,0x1a,0xef,0xf5,0x4e,0x86,0xff,0xa8,
-0x71,0x05,0xff,0xff,0x40,0x4f,0xff,0xff,0xf5,0x0d,0xdf,0xbe,0x6a,0xfe,0x40,0x4f,
-0xc0,0x6f,0x6f,0xb2,0x5f,0xb9,0xd6,0xef,0x40,0x3d,0x1f,0xb0,0x02,0x04,0xef,0xf6,
-0x00,0x02,0x1f,0x19,0x96,0x10,0x60,0xfc,0x11,0x31,0x8d,0xff,0xa2,0xac,0x12,0x2a,
-0x7d,0x83,0xb1,0x47,0x13,0x66,0xe4,0x0d,0x00,0x41,0x61,0x20,0xbb,0xbc,0x8e,0x4c,
-0x03,0x3f,0x04,0xf0,0x08,0xfe,0x00,0x11,0x00,0x22,0x00,0xff,0xfe,0x07,0xfe,0x11,
-0xdf,0xa3,0xdd,0x4a,0xef,0xf5,0x00,0x5d,0xff,0xb3,0x9f,0xf9,0x79,0x14,0x30,0xf8,
-0x19,0xcb,0x20,0x02,0x12,0x50,0x3b,0x15,0x12,0x00,0x59,0x45,0x0b,0x07,0x00,0x11,
-0xac,0xda,0x25,0x13,0xcb,0xb2,0x5e,0x00,0x23,0x1b,0x26,0x70,0x00,0x43,0x65,0x04,
-0xf9,0x23,0xf0,0x03,0x0e,0xf9,0x9a,0x99,0x99,0xa9,0xaf,0xe0,0x0e,0xf0,0x3d,0xb0,
-0x09,0xd5,0x1f,0xe0,0x05,0x79,0xa5,0x97,0xf2,0x02,0xd6,0x20,0x02,0xff,0xc2,0x04,
-0x40,0x3a,0xff,0x10,0x00,0x65,0x00,0x1f,0xd5,0xf8,0x45,0x91,0x32,0x36,0xbf,0x30,
-0x00,0x04,0x3a,0x31,0xbb,0xff,0xfd,0x29,0x5b,0x22,0x05,0xfe,0x2a,0x3e,0xf0,0x02,
-0x7f,0xf6,0x5f,0xe5,0x00,0x00,0x05,0x9e,0xff,0x60,0x06,0xff,0xe9,0x61,0x0d,0xff,
-0xa2,0x6f,0x68,0x20,0xe1,0x03,0x51,0x07,0x00,0x39,0x9c,0x12,0x5a,0xa4,0x47,0x00,
-0x5c,0x06,0x10,0x34,0x64,0x06,0x21,0x3f,0x90,0x08,0x00,0x92,0x3b,0xcf,0xcb,0x8f,
-0x78,0xfa,0x5f,0xd0,0x4f,0x25,0x11,0x50,0xd0,0x04,0x30,0x64,0x24,0x18,0x8b,0x22,
-0x0d,0x90,0x91,0x1e,0xb1,0x0b,0xb0,0xf8,0xbb,0xbe,0xfe,0xbb,0xb4,0x09,0xd2,0xf5,
-0x37,0x31,0x31,0x08,0xe4,0xf2,0x8c,0x8b,0xf0,0x05,0x07,0xf7,0xf0,0xbf,0xaf,0xaf,
-0xcd,0xf1,0x27,0xae,0xfd,0xbf,0x3f,0x3e,0x89,0xf1,0x5f,0xff,0xda,0xcf,0x08,0x00,
-0x80,0x17,0x40,0x00,0xbf,0x3f,0x3e,0xbc,0xf1,0xca,0x0b,0x27,0x2e,0x3c,0x1d,0x12,
-0x50,0x08,0x50,0x00,0x05,0x72,0x37,0x1c,0x81,0xc4,0x44,0x1d,0xf8,0x55,0x52,0x01,
-0xef,0x71,0x00,0xf2,0x01,0xf6,0x0c,0xf6,0x9f,0x63,0xff,0x39,0xf7,0x00,0x19,0xb1,
-0x3d,0x63,0xb9,0x12,0xd7,0x8d,0x16,0x00,0x54,0x0b,0xd0,0x67,0x77,0x8f,0xe7,0x77,
-0xfd,0x00,0x00,0x39,0x99,0xaf,0xe9,0x99,0x5c,0x4b,0x04,0x7c,0x2f,0x12,0x40,0xbc,
-0x30,0x13,0xcf,0xb1,0x23,0xf1,0x0f,0x78,0x8e,0xff,0xe8,0x88,0xbf,0x80,0x00,0x03,
-0xdf,0xaf,0xc0,0x00,0x9f,0x60,0x06,0xcf,0xe4,0x1f,0xc0,0xbe,0xff,0x20,0x07,0xc5,
-0x00,0x1f,0xc0,0x6b,0xb6,0xea,0x36,0x01,0xe3,0x78,0x30,0x8f,0x91,0x11,0x4e,0x19,
-0x00,0x7b,0x14,0x10,0x6f,0xb4,0x39,0xf1,0x05,0xfb,0xfe,0x78,0xff,0x9f,0xf8,0x81,
-0x4f,0xb0,0xbf,0x35,0xc6,0x09,0xf5,0x00,0x02,0x10,0x22,0x6f,0xf5,0x62,0x2e,0x40,
-0x1b,0xfe,0xef,0xa3,0x28,0x27,0x71,0xff,0xd2,0x2a,0xff,0xc7,0x10,0x2c,0x77,0x00,
-0xc0,0xff,0xf6,0x0c,0xd6,0x17,0x77,0x77,0x72,0x28,0xb0,0x00,0x08,0xa4,0x32,0x13,
-0x90,0x3b,0x3a,0x11,0xd0,0x1e,0x3b,0x01,0x6c,0x32,0x51,0x0b,0xfb,0xaa,0xaa,0xbf,
-0xce,0x97,0x02,0x88,0x3f,0x20,0x47,0x20,0x71,0x1e,0x00,0xd4,0x97,0x80,0x86,0x4f,
-0xf8,0x88,0x81,0x0a,0xff,0xff,0x40,0x4e,0xf1,0x06,0xf2,0x5f,0xc2,0xfc,0x09,0xf7,
-0x0d,0xf1,0x00,0x04,0x5c,0xfd,0xcc,0xfd,0xce,0xe9,0x00,0x00,0x5f,0xc6,0x66,0xf1,
-0x04,0x11,0x5f,0xf0,0x21,0x00,0xf1,0x05,0x38,0x77,0x77,0x7a,0x08,0x00,0x03,0x18,
-0x00,0xf4,0x00,0x02,0x7f,0x92,0x24,0xfe,0x21,0x00,0x18,0x88,0xbf,0xc8,0x89,0xfe,
-0x88,0x82,0x64,0x3e,0x32,0x03,0x6c,0xfc,0x07,0x59,0x48,0xeb,0x50,0x00,0x01,0xa9,
-0x2e,0x50,0x57,0x20,0x00,0x06,0x61,0xb0,0x05,0x90,0x85,0x55,0x0f,0xf6,0x55,0x51,
-0x06,0xff,0xff,0x6c,0x3f,0xf2,0x01,0xf3,0x3f,0xe1,0x9f,0x42,0xdd,0x09,0xf6,0x00,
-0x07,0x61,0x38,0x4f,0xd2,0x12,0x93,0x76,0x07,0x00,0x5b,0x4c,0x10,0xf6,0xd4,0x10,
-0x31,0x6f,0xd0,0x08,0x29,0x06,0x93,0xea,0x90,0x00,0x0d,0xf5,0x44,0x44,0x4f,0xd0,
-0x21,0x06,0x10,0xd0,0x64,0x3c,0x42,0x66,0x66,0x66,0x50,0x4f,0x4e,0x20,0xdd,0xd9,
-0x2e,0x4f,0x10,0x99,0xc9,0x05,0x01,0x18,0x00,0x10,0x68,0x08,0x00,0x03,0xa8,0x00,
-0x41,0x59,0x30,0x00,0x0a,0x84,0x6a,0x60,0xb8,0x86,0x8f,0xe8,0x88,0x82,0x69,0x4a,
-0x00,0xc4,0x09,0xf0,0x02,0x4f,0xb4,0xe7,0x09,0xf4,0x2e,0xe1,0x00,0x05,0x48,0xf6,
-0x33,0x36,0x69,0x76,0x40,0x2f,0x81,0x26,0xa0,0xff,0xff,0xb0,0x05,0x59,0xf7,0x55,
-0x7f,0xa6,0x7f,0x7c,0x35,0x91,0xfb,0x6f,0x50,0x1f,0xb0,0x0d,0xca,0xf8,0xeb,0x08,
-0x00,0xc0,0xec,0xfc,0xfb,0x6f,0x56,0xaf,0xb0,0x0d,0xdc,0xfb,0xeb,0x6f,0x2d,0x0f,
-0xf1,0x00,0x9c,0xfb,0x97,0x6f,0x50,0x20,0x30,0x27,0x7a,0xf9,0x77,0x7f,0x60,0x02,
-0xf6,0xc1,0x26,0x60,0xeb,0xbe,0xf6,0x00,0x05,0xf3,0x73,0x01,0x05,0x68,0x02,0x00,
-0x23,0x8c,0xf0,0x11,0x03,0xf9,0x00,0x00,0x2c,0x5f,0x6e,0x8b,0xbc,0xfe,0xbb,0xb0,
-0x1f,0x9f,0x9f,0x7e,0xef,0xff,0xee,0xe0,0x0d,0xcf,0xcf,0x04,0x47,0xfb,0x44,0x30,
-0x0b,0xef,0xfa,0x0e,0x38,0x02,0xc0,0x06,0x9f,0xa5,0x45,0x58,0xfb,0x55,0x52,0x4f,
-0xff,0xfe,0xaf,0xe8,0x02,0x50,0x28,0xdf,0xc7,0x05,0x66,0x55,0x1a,0x10,0xef,0xcd,
-0x2d,0x00,0xc5,0x43,0xa1,0xfc,0x0e,0xe4,0x44,0x7f,0x70,0x0d,0xff,0xbf,0x4e,0x4c,
-0x3d,0xb1,0xaf,0x68,0x0e,0xe3,0x33,0x7f,0x70,0x2d,0x5f,0x60,0x0e,0x3c,0x32,0x80,
-0x4f,0x60,0x0e,0xd0,0x07,0xaf,0x60,0x00,0x08,0x00,0x17,0x0b,0xea,0x1d,0x02,0xdf,
-0x3d,0x02,0x7b,0x78,0x00,0x3c,0x76,0x91,0x55,0x55,0x5d,0xf7,0x55,0x55,0x40,0x00,
-0x6e,0x73,0x31,0x31,0x00,0x00,0x5b,0x5c,0x4e,0x00,0x24,0x1c,0x80,0x7e,0xf9,0x77,
-0x77,0x74,0x1e,0xee,0xef,0xbc,0x60,0x82,0xe8,0x00,0x03,0x8e,0xfa,0x22,0x7d,0x50,
-0x3d,0x09,0x10,0xe8,0x21,0x83,0x81,0x6a,0xff,0xa4,0x09,0xf7,0x00,0x02,0xbf,0x09,
-0x40,0xf5,0x12,0xb0,0x01,0xdb,0xd9,0x8a,0xfa,0x45,0x28,0xb2,0x00,0x2b,0xfc,0x06,
-0xf7,0x5f,0xd5,0x00,0x0b,0xff,0x98,0xbd,0xf6,0x05,0xdf,0xc2,0x04,0xa2,0x05,0xfe,
-0xb1,0x00,0x09,0x80,0xdb,0x2d,0x83,0x11,0x11,0x1e,0xf2,0x11,0x11,0x00,0x0b,0x12,
-0x75,0x83,0x06,0x88,0x88,0x8f,0xf9,0x88,0x88,0x60,0x7c,0x0d,0x14,0xa0,0x40,0x04,
-0xf0,0x01,0x1f,0xb0,0x08,0xfd,0x30,0x71,0x0c,0xf1,0x0a,0x88,0xef,0xa5,0x7e,0xf8,
-0x08,0xa0,0x8e,0x19,0x20,0xfa,0x39,0x39,0x9a,0x92,0x9e,0xf9,0x21,0x4f,0xf3,0x00,
-0x02,0xcf,0xff,0xc9,0x0f,0xf0,0x05,0xcb,0xd8,0x7b,0xf7,0x34,0x3e,0x70,0x00,0x3c,
-0xfa,0x08,0xf4,0xaf,0xc4,0x00,0x0b,0xff,0x79,0xbe,0xf3,0xfc,0x5a,0x72,0xa2,0x07,
-0xfe,0xa0,0x00,0x19,0x20,0x8d,0x61,0x00,0xcd,0x0a,0x21,0x70,0x0e,0x09,0x07,0xf0,
-0x04,0xbe,0x12,0x0e,0xfe,0xff,0xef,0xf1,0x04,0xf6,0x8f,0x2e,0xc0,0xce,0x0b,0xf1,
-0x0d,0xe3,0xfb,0x0e,0x08,0x00,0x31,0x7f,0xff,0xf2,0x08,0x00,0xc1,0x28,0xaf,0x94,
-0x0e,0xc0,0xde,0x0c,0xf1,0x01,0xec,0x7f,0x0e,0x44,0x37,0xb0,0xfa,0xbf,0x5e,0xfb,
-0xff,0xbe,0xf1,0x4f,0xfd,0xbc,0x5e,0x20,0x00,0x31,0x04,0x01,0x27,0x28,0x00,0x31,
-0x2f,0x7f,0x6f,0x40,0x00,0x40,0x4f,0x3f,0x5e,0x7e,0x20,0x00,0x40,0x7f,0x0e,0x76,
-0x3e,0x30,0x00,0x80,0x6b,0x04,0x00,0x0e,0xc0,0x00,0x0a,0xd1,0xad,0x68,0x22,0x07,
-0x50,0x98,0x7a,0x01,0xc0,0x88,0x20,0xaf,0x30,0x13,0x04,0xf1,0x0d,0x70,0x02,0xf9,
-0x7e,0x38,0xfe,0x99,0xef,0x50,0x0c,0xf3,0xee,0x8f,0xff,0x45,0xfd,0x00,0x6f,0xff,
-0xf5,0x6e,0x5e,0xef,0xf2,0x00,0x1a,0xbf,0xc2,0x1b,0x77,0xf5,0x30,0x01,0xee,0xcc,
-0x02,0xbf,0xff,0xfa,0x10,0x2d,0xfc,0xdf,0x8f,0xfc,0x23,0xdf,0xf6,0x2f,0xfe,0xcf,
-0x6b,0x56,0xd6,0x07,0xc1,0x04,0x10,0x1b,0x10,0x06,0xdf,0xd2,0x00,0x0d,0x8d,0x8f,
-0x50,0x30,0x07,0xa0,0x00,0x0f,0x8c,0x9b,0xa5,0xfe,0x94,0x00,0x00,0x3f,0x5a,0xb6,
-0x71,0x6c,0xff,0xd6,0x00,0x4e,0x15,0x50,0x00,0x00,0x29,0xff,0xad,0x6d,0x24,0x00,
-0x19,0xac,0x3e,0x21,0x80,0x7f,0x15,0x12,0xf0,0x09,0xee,0x34,0x4b,0xfb,0x9a,0xff,
-0x50,0x07,0xf6,0x9f,0x34,0xfc,0x07,0xfd,0x00,0x3f,0xf6,0xfc,0x00,0x9f,0xaf,0xf3,
-0x00,0x6f,0x3c,0x07,0xf0,0x18,0xff,0x70,0x00,0x18,0xbf,0xb4,0x17,0xef,0xff,0xfa,
-0x40,0x02,0xfd,0x7f,0xcf,0xfc,0x49,0xff,0xf2,0x2d,0xfd,0xef,0x8b,0x42,0xfb,0x28,
-0x70,0x4f,0xff,0xef,0x91,0x13,0xfb,0x11,0x00,0x08,0x41,0x08,0x1d,0x5c,0x07,0xd0,
-0x0b,0x6c,0xaf,0x07,0x8a,0xfe,0x88,0x40,0x2f,0x6f,0x8f,0x40,0x02,0xff,0x03,0xa1,
-0x3e,0x97,0x9a,0xab,0xfe,0xaa,0xa2,0x8f,0x09,0x50,0xa9,0x26,0x04,0xd8,0x29,0x00,
-0x3c,0x08,0x21,0x02,0x70,0xdc,0x38,0x00,0xd4,0x2a,0x00,0x86,0x94,0x91,0x6a,0xac,
-0xfe,0xaa,0xa0,0x03,0xf8,0x7b,0xbf,0xb4,0x3d,0xf3,0x44,0xf3,0xed,0x00,0x7f,0xa1,
+0xef,0x06,0xf7,0x01,0x1f,0xa0,0x03,0x00,0xef,0x01,0x20,0x00,0x1f,0xa0,0x00,0x7d,
+0xfe,0x00,0x00,0x08,0x00,0x20,0x4e,0xc5,0x78,0x00,0xf0,0x24,0x13,0x00,0x01,0x62,
+0x00,0x00,0x04,0x7b,0xff,0x20,0x0c,0xf9,0x00,0x00,0x0e,0xff,0xe7,0x13,0xdf,0xff,
+0xff,0x80,0x03,0x3f,0xb0,0x8f,0xf9,0x89,0xff,0x30,0x01,0x2f,0xb1,0x5c,0x8d,0x7c,
+0xf7,0x00,0x5f,0xff,0xff,0x70,0x3f,0xff,0x60,0x00,0x39,0xdf,0xe9,0xac,0xff,0x32,
+0x01,0xf0,0x27,0xef,0xf5,0x4e,0x86,0xff,0xa8,0x71,0x05,0xff,0xff,0x40,0x4f,0xff,
+0xff,0xf5,0x0d,0xdf,0xbe,0x6a,0xfe,0x40,0x4f,0xc0,0x6f,0x6f,0xb2,0x5f,0xb9,0xd6,
+0xef,0x40,0x3d,0x1f,0xb0,0x02,0x04,0xef,0xf6,0x00,0x02,0x1f,0xb0,0x00,0x3b,0xff,
+0x60,0x00,0x00,0x1f,0xb0,0x8d,0xff,0xa2,0x00,0x08,0x00,0x39,0x7d,0x83,0x00,0x71,
+0x01,0x11,0x66,0x07,0x00,0xd2,0x05,0xff,0x00,0x00,0x00,0xbb,0xbb,0xbc,0xff,0xdb,
+0xbb,0xbb,0xff,0x01,0x00,0xf0,0x0f,0xfe,0x00,0x11,0x00,0x22,0x00,0xff,0xfe,0x07,
+0xfe,0x11,0xdf,0xa3,0xdd,0x4a,0xef,0xf5,0x00,0x5d,0xff,0xb3,0x9f,0xf9,0x10,0x00,
+0x00,0x5d,0xf8,0x19,0xcb,0x20,0x02,0x30,0x50,0x00,0xef,0x29,0x00,0x00,0x46,0x00,
+0x00,0x05,0x00,0x0a,0x07,0x00,0x83,0xac,0xcc,0xcc,0xff,0xcc,0xcc,0xcb,0xcf,0x4c,
+0x00,0x42,0x00,0x00,0x16,0x70,0x72,0x00,0x30,0x2f,0xf3,0x00,0xe9,0x00,0x01,0x01,
+0x00,0xf0,0x19,0xe0,0x0e,0xf9,0x9a,0x99,0x99,0xa9,0xaf,0xe0,0x0e,0xf0,0x3d,0xb0,
+0x09,0xd5,0x1f,0xe0,0x05,0x79,0xff,0x50,0x07,0xff,0xd6,0x20,0x02,0xff,0xc2,0x04,
+0x40,0x3a,0xff,0x10,0x00,0x65,0x00,0x1f,0xd5,0xf8,0x45,0x38,0x00,0x54,0x3f,0xc0,
+0xbf,0x30,0x00,0x71,0x02,0xe0,0x1b,0xbb,0xbb,0xff,0xfd,0xbb,0xbb,0xb1,0x00,0x00,
+0x05,0xfe,0xfe,0x10,0x1f,0x00,0xf0,0x00,0x7f,0xf6,0x5f,0xe5,0x00,0x00,0x05,0x9e,
+0xff,0x60,0x06,0xff,0xe9,0x61,0x0d,0xee,0x00,0x50,0x2a,0xff,0xe1,0x03,0x40,0x1c,
+0x00,0xf1,0x06,0x14,0x30,0x00,0x5a,0x00,0x00,0x04,0xf8,0x00,0x00,0x00,0x9f,0x30,
+0x7f,0x34,0xf8,0x0e,0xd0,0x00,0x3f,0x90,0x08,0x00,0xf0,0x0c,0x3b,0xcf,0xcb,0x8f,
+0x78,0xfa,0x5f,0xd0,0x4f,0xff,0xff,0x9f,0xff,0xff,0xff,0xd0,0x04,0x30,0x64,0x24,
+0x44,0x44,0x44,0x30,0x0d,0x90,0xfb,0x68,0x00,0xf0,0x06,0xf5,0x0b,0xb0,0xf8,0xbb,
+0xbe,0xfe,0xbb,0xb4,0x09,0xd2,0xf5,0x00,0x0b,0xf6,0x00,0x00,0x08,0xe4,0xf2,0xbf,
+0x80,0x00,0xf0,0x05,0x07,0xf7,0xf0,0xbf,0xaf,0xaf,0xcd,0xf1,0x27,0xae,0xfd,0xbf,
+0x3f,0x3e,0x89,0xf1,0x5f,0xff,0xda,0xcf,0x08,0x00,0x70,0x17,0x40,0x00,0xbf,0x3f,
+0x3e,0xbc,0x11,0x03,0x55,0xbf,0x2e,0x3c,0xaf,0xb0,0x68,0x01,0xf1,0x02,0x08,0x50,
+0x00,0x05,0x72,0x00,0x00,0x00,0x6f,0xc4,0x44,0x1d,0xf8,0x55,0x52,0x01,0xef,0x71,
+0x00,0xf2,0x02,0xf6,0x0c,0xf6,0x9f,0x63,0xff,0x39,0xf7,0x00,0x19,0xb1,0x3d,0x63,
+0xb9,0x12,0xd7,0x00,0x52,0x01,0xf3,0x05,0xfd,0x00,0x00,0x67,0x77,0x8f,0xe7,0x77,
+0xfd,0x00,0x00,0x39,0x99,0xaf,0xe9,0x99,0xfd,0x00,0x00,0x7f,0x18,0x00,0x40,0x9f,
+0x40,0x1f,0xc0,0x50,0x00,0x02,0x58,0x01,0xf0,0x20,0x90,0x00,0x78,0x8e,0xff,0xe8,
+0x88,0xbf,0x80,0x00,0x03,0xdf,0xaf,0xc0,0x00,0x9f,0x60,0x06,0xcf,0xe4,0x1f,0xc0,
+0xbe,0xff,0x20,0x07,0xc5,0x00,0x1f,0xc0,0x6b,0xb6,0x00,0x00,0x14,0x00,0x00,0x03,
+0x30,0x00,0x00,0x00,0x8f,0x91,0x11,0x0e,0xf2,0x9b,0x01,0xf0,0x0e,0xff,0xfc,0x6f,
+0xff,0xff,0xf3,0x0c,0xfb,0xfe,0x78,0xff,0x9f,0xf8,0x81,0x4f,0xb0,0xbf,0x35,0xc6,
+0x09,0xf5,0x00,0x02,0x10,0x22,0x6f,0xf5,0x01,0x20,0xc2,0x03,0xe1,0xfe,0xef,0xa3,
+0x00,0x00,0x00,0x3a,0xff,0xd2,0x2a,0xff,0xc7,0x10,0x2c,0x77,0x00,0xf0,0x06,0xff,
+0xf6,0x0c,0xd6,0x17,0x77,0x77,0x72,0x28,0xb0,0x00,0x08,0xaa,0xaa,0xaa,0xaa,0x90,
+0x00,0x00,0x0b,0xff,0x2f,0x01,0x70,0x00,0x00,0x0b,0xf1,0x00,0x00,0x1f,0x08,0x00,
+0x53,0xfb,0xaa,0xaa,0xbf,0xd0,0x18,0x00,0xf0,0x25,0xc0,0x00,0x00,0x47,0x20,0x00,
+0x08,0x60,0x00,0x00,0x00,0xdf,0xb8,0x86,0x4f,0xf8,0x88,0x81,0x0a,0xff,0xff,0xfd,
+0xef,0xff,0xff,0xf2,0x5f,0xc2,0xfc,0x09,0xf7,0x0d,0xf1,0x00,0x04,0x5c,0xfd,0xcc,
+0xfd,0xce,0xe9,0x00,0x00,0x5f,0xc6,0x66,0x66,0x69,0xfb,0x00,0x00,0x5f,0x38,0x00,
+0x00,0x08,0x00,0x48,0xc7,0x77,0x77,0x7a,0x08,0x00,0x03,0x18,0x00,0xf2,0x01,0x02,
+0x7f,0x92,0x24,0xfe,0x21,0x00,0x18,0x88,0xbf,0xc8,0x89,0xfe,0x88,0x82,0x3f,0x08,
+0x02,0xc1,0xf3,0x03,0x6c,0xfc,0x00,0x01,0xfd,0x00,0x00,0x06,0xeb,0x50,0x08,0x00,
+0x05,0x01,0x00,0x40,0x57,0x20,0x00,0x06,0xda,0x03,0xf2,0x11,0xef,0x85,0x55,0x0f,
+0xf6,0x55,0x51,0x06,0xff,0xff,0xfe,0x8f,0xff,0xff,0xf3,0x3f,0xe1,0x9f,0x42,0xdd,
+0x09,0xf6,0x00,0x07,0x61,0x38,0x4f,0xd2,0x12,0x93,0x10,0x0c,0x48,0x00,0xb0,0xd0,
+0x0c,0xf6,0x55,0x55,0x55,0x55,0x6f,0xd0,0x08,0xae,0x0f,0x00,0xc3,0xea,0x90,0x00,
+0x0d,0xf5,0x44,0x44,0x4f,0xd0,0x00,0x00,0x0d,0xe8,0x00,0xf2,0x07,0x0d,0xf7,0x66,
+0x66,0x66,0x50,0x00,0x00,0x0d,0xfd,0xdd,0xdd,0xdd,0xd9,0x00,0x00,0x0d,0xfa,0x99,
+0x99,0x9b,0xfb,0x18,0x00,0x10,0x68,0x08,0x00,0x03,0xa8,0x00,0x50,0x59,0x30,0x00,
+0x0a,0x80,0x78,0x00,0xf1,0x2b,0xb8,0x86,0x8f,0xe8,0x88,0x82,0x0b,0xff,0xff,0xfe,
+0xff,0xff,0xff,0xf4,0x4f,0xb4,0xe7,0x09,0xf4,0x2e,0xe1,0x00,0x05,0x48,0xf6,0x33,
+0x36,0x69,0x76,0x40,0x2f,0xff,0xff,0xff,0x7f,0xff,0xff,0xb0,0x05,0x59,0xf7,0x55,
+0x7f,0xa6,0x7f,0xb0,0x0d,0xff,0xff,0xfb,0x6f,0x50,0x1f,0xb0,0x0d,0xca,0xf8,0xeb,
+0x08,0x00,0xf0,0x11,0xec,0xfc,0xfb,0x6f,0x56,0xaf,0xb0,0x0d,0xdc,0xfb,0xeb,0x6f,
+0x57,0xff,0x50,0x08,0x9c,0xfb,0x97,0x6f,0x50,0x20,0x30,0x27,0x7a,0xf9,0x77,0x7f,
+0x60,0x02,0xf6,0x4f,0x40,0x00,0x60,0xeb,0xbe,0xf6,0x00,0x05,0xf3,0x73,0x01,0x06,
+0x68,0x02,0xf0,0x14,0x4f,0x60,0x00,0x03,0xf9,0x00,0x00,0x2c,0x5f,0x6e,0x8b,0xbc,
+0xfe,0xbb,0xb0,0x1f,0x9f,0x9f,0x7e,0xef,0xff,0xee,0xe0,0x0d,0xcf,0xcf,0x04,0x47,
+0xfb,0x44,0x30,0x0b,0xef,0xfa,0x0e,0x38,0x02,0xc0,0x06,0x9f,0xa5,0x45,0x58,0xfb,
+0x55,0x52,0x4f,0xff,0xfe,0xaf,0xe8,0x02,0xb0,0x28,0xdf,0xc7,0x05,0x66,0x66,0x66,
+0x20,0x00,0xef,0xf2,0x20,0x00,0xd0,0x70,0x05,0xff,0xfc,0x0e,0xe4,0x44,0x7f,0x70,
+0x0d,0xff,0xbf,0x4e,0x10,0x00,0xb1,0x6f,0xaf,0x68,0x0e,0xe3,0x33,0x7f,0x70,0x2d,
+0x5f,0x60,0x20,0x00,0x90,0x01,0x4f,0x60,0x0e,0xd0,0x07,0xaf,0x60,0x00,0x08,0x00,
+0x37,0x0b,0xfc,0x20,0x7a,0x01,0x10,0x0c,0x09,0x06,0x12,0x04,0x58,0x01,0xf0,0x23,
+0xc0,0x01,0x55,0x55,0x5d,0xf7,0x55,0x55,0x40,0x00,0x6e,0xee,0xef,0xfe,0xee,0xee,
+0x00,0x00,0x5b,0xbb,0xbf,0xfc,0xbb,0xbb,0x00,0x07,0x77,0x77,0x7e,0xf9,0x77,0x77,
+0x74,0x1e,0xee,0xef,0xff,0xfe,0xee,0xee,0xe8,0x00,0x03,0x8e,0xfa,0x22,0x7d,0x50,
+0x00,0x00,0x19,0x01,0xf0,0x24,0xe8,0x40,0x00,0x00,0x04,0x6a,0xff,0xa4,0x09,0xf7,
+0x00,0x02,0xbf,0xff,0xfe,0xef,0xff,0xff,0xb0,0x01,0xdb,0xd9,0x8a,0xfa,0x45,0x28,
+0xb2,0x00,0x2b,0xfc,0x06,0xf7,0x5f,0xd5,0x00,0x0b,0xff,0x98,0xbd,0xf6,0x05,0xdf,
+0xc2,0x04,0xa2,0x05,0xfe,0xb1,0x00,0x09,0x80,0x53,0x04,0x10,0xf1,0x7e,0x00,0x82,
+0x11,0x11,0x1e,0xf2,0x11,0x11,0x00,0x0b,0x80,0x00,0xf4,0x02,0xb0,0x06,0x88,0x88,
+0x8f,0xf9,0x88,0x88,0x60,0x0a,0xaa,0xaa,0xaf,0xfa,0xaa,0xaa,0xa0,0x40,0x04,0xf2,
+0x12,0x1f,0xb0,0x08,0xfd,0x30,0x71,0x0c,0xf1,0x0a,0x88,0xef,0xa5,0x7e,0xf8,0x08,
+0xa0,0x00,0x0f,0xff,0xff,0xfa,0x39,0x20,0x00,0x00,0x04,0x9e,0xf9,0x21,0x4f,0xf3,
+0x00,0x02,0x60,0x03,0xf3,0x14,0x30,0x00,0xcb,0xd8,0x7b,0xf7,0x34,0x3e,0x70,0x00,
+0x3c,0xfa,0x08,0xf4,0xaf,0xc4,0x00,0x0b,0xff,0x79,0xbe,0xf3,0x06,0xff,0xa0,0x03,
+0xa2,0x07,0xfe,0xa0,0x00,0x19,0x20,0x00,0x08,0xfb,0x00,0x31,0x5f,0x70,0x0e,0x09,
+0x07,0xf0,0x04,0xbe,0x12,0x0e,0xfe,0xff,0xef,0xf1,0x04,0xf6,0x8f,0x2e,0xc0,0xce,
+0x0b,0xf1,0x0d,0xe3,0xfb,0x0e,0x08,0x00,0x31,0x7f,0xff,0xf2,0x08,0x00,0xb1,0x28,
+0xaf,0x94,0x0e,0xc0,0xde,0x0c,0xf1,0x01,0xec,0x7f,0x30,0x00,0xc0,0x1c,0xfa,0xbf,
+0x5e,0xfb,0xff,0xbe,0xf1,0x4f,0xfd,0xbc,0x5e,0x20,0x00,0x31,0x04,0x01,0x27,0x28,
+0x00,0x31,0x2f,0x7f,0x6f,0x40,0x00,0x40,0x4f,0x3f,0x5e,0x7e,0x20,0x00,0x40,0x7f,
+0x0e,0x76,0x3e,0x30,0x00,0xe0,0x6b,0x04,0x00,0x0e,0xc0,0x00,0x0a,0xd1,0x00,0x06,
+0x20,0x00,0x07,0x50,0x4e,0x05,0x30,0xb0,0x00,0x4f,0x11,0x04,0x20,0xaf,0x30,0x13,
+0x04,0xf3,0x51,0x70,0x02,0xf9,0x7e,0x38,0xfe,0x99,0xef,0x50,0x0c,0xf3,0xee,0x8f,
+0xff,0x45,0xfd,0x00,0x6f,0xff,0xf5,0x6e,0x5e,0xef,0xf2,0x00,0x1a,0xbf,0xc2,0x00,
+0x09,0xff,0x80,0x00,0x01,0xee,0xcc,0x02,0xbf,0xff,0xfa,0x10,0x2d,0xfc,0xdf,0x8f,
+0xfc,0x23,0xdf,0xf6,0x2f,0xfe,0xcf,0x6b,0x56,0xd6,0x07,0xc1,0x04,0x10,0x1b,0x10,
+0x06,0xdf,0xd2,0x00,0x0d,0x8d,0x8f,0x50,0x30,0x07,0xa0,0x00,0x0f,0x8c,0x9b,0xa5,
+0xfe,0x94,0x00,0x00,0x3f,0x5a,0xb6,0x71,0x6c,0xff,0xd6,0x00,0x4e,0x15,0x50,0x00,
+0x00,0x29,0xff,0xed,0x00,0x52,0x13,0x00,0x00,0x19,0x30,0x0b,0x00,0x30,0x8f,0x80,
+0x7f,0x10,0x02,0xf0,0x0a,0x00,0xee,0x34,0x4b,0xfb,0x9a,0xff,0x50,0x07,0xf6,0x9f,
+0x34,0xfc,0x07,0xfd,0x00,0x3f,0xf6,0xfc,0x00,0x9f,0xaf,0xf3,0x00,0x6f,0x3c,0x07,
+0xf0,0x18,0xff,0x70,0x00,0x18,0xbf,0xb4,0x17,0xef,0xff,0xfa,0x40,0x02,0xfd,0x7f,
+0xcf,0xfc,0x49,0xff,0xf2,0x2d,0xfd,0xef,0x8b,0x42,0xfb,0x28,0x70,0x4f,0xff,0xef,
+0x91,0x13,0xfb,0x11,0x00,0x08,0x41,0x08,0x1d,0x5c,0x07,0xd0,0x0b,0x6c,0xaf,0x07,
+0x8a,0xfe,0x88,0x40,0x2f,0x6f,0x8f,0x40,0x02,0xff,0x03,0xb0,0x3e,0x97,0x9a,0xab,
+0xfe,0xaa,0xa2,0x8f,0x09,0x50,0xaf,0xf0,0x03,0x13,0x02,0x66,0x02,0x00,0x3c,0x08,
+0x20,0x02,0x70,0xf0,0x02,0x40,0xa0,0x00,0x07,0xf6,0x6e,0x05,0x91,0x20,0x6a,0xac,
+0xfe,0xaa,0xa0,0x03,0xf8,0x7b,0xa0,0x05,0xf2,0x4c,0x1d,0xf3,0xed,0x00,0x7f,0xa1,
 0x93,0x00,0x7f,0xff,0xf4,0x03,0xfe,0x12,0xfd,0x00,0x19,0xbf,0xa4,0x5f,0xfe,0xce,
 0xff,0x70,0x01,0xed,0x5f,0x7f,0xfd,0xca,0x8d,0xf0,0x2d,0xfc,0xcf,0x73,0x96,0x18,
 0x53,0x20,0x3f,0xfe,0xbe,0xa2,0xf9,0x3f,0x90,0x00,0x04,0x00,0x27,0x04,0xf8,0x3f,
 0x90,0x00,0x0e,0x8f,0xae,0x08,0xf5,0x3f,0x93,0x91,0x0f,0x5f,0x8f,0x3e,0xf1,0x3f,
-0x94,0xf4,0x3f,0x3d,0x85,0xcf,0x80,0x2f,0xdc,0xf2,0x5f,0x08,0x44,0xfa,0xcc,0x78,
-0x03,0x3d,0x6e,0x13,0x10,0x70,0x03,0xf0,0x1b,0x80,0x2f,0xa2,0x1b,0xe1,0x50,0x00,
-0xbe,0x20,0x2f,0xae,0x9b,0xe7,0xf4,0x03,0xf6,0xbe,0x5f,0xa9,0xfb,0xeb,0xd0,0x0d,
-0xe5,0xfc,0x2f,0xa5,0xdd,0xfd,0x60,0x7f,0xff,0xf3,0x2f,0xaa,0xae,0xfa,0xa3,0x18,
-0xbf,0x93,0x2f,0x89,0x4a,0xf1,0x2d,0x02,0xfb,0x8e,0x3f,0xa0,0x7f,0xf3,0x00,0x1d,
-0xfc,0xef,0x7f,0xa0,0xef,0xfe,0x20,0x4f,0xfd,0xae,0xbf,0xa9,0xfe,0xfe,0xd1,0x06,
-0x10,0x17,0x2f,0xef,0xbb,0xe5,0xf5,0x0a,0x7e,0x8f,0x3f,0xbe,0x2b,0xe0,0x60,0x0e,
-0x6e,0x6f,0x9f,0xa1,0x0b,0xe0,0x00,0x2f,0x3d,0x76,0x5f,0xeb,0xbd,0xeb,0xb7,0x4c,
-0x04,0x10,0x2f,0x8a,0x09,0x20,0x2b,0x30,0x7a,0xa6,0x00,0x71,0x25,0x90,0x38,0x88,
-0xff,0x88,0x70,0x00,0xdc,0x10,0x7f,0x11,0x0a,0x40,0x05,0xf4,0x9d,0x10,0x18,0x00,
-0x21,0x0d,0xd2,0x2a,0x32,0x50,0x70,0x7f,0xff,0xf1,0x09,0xa2,0x07,0x40,0x3c,0xcf,
-0x60,0x48,0x89,0x0a,0x41,0x01,0xda,0x99,0x7f,0x70,0x02,0xf2,0x25,0xfc,0xee,0x8f,
-0x48,0x35,0x79,0xf1,0x4f,0xfe,0xcf,0x8a,0x6f,0x5b,0xe6,0xa0,0x05,0x10,0x29,0x00,
-0x7f,0x4b,0xe0,0x00,0x0d,0x8f,0x8f,0x10,0xcf,0x2b,0xe0,0x30,0x0f,0x6e,0x7e,0x75,
-0xfc,0x0b,0xe1,0xf6,0x4f,0x3d,0x85,0xaf,0xf2,0x0a,0xfb,0xf4,0x4c,0x03,0x10,0xce,
-0x40,0x8a,0x6b,0x19,0x01,0xfd,0x4c,0x02,0xa1,0x22,0x90,0x60,0x0b,0xf5,0xaf,0x54,
-0x5e,0xb8,0xdf,0x20,0x34,0x40,0xf0,0x12,0x0d,0xd2,0xfc,0x00,0x0b,0xf6,0x66,0xe8,
-0x03,0xff,0xf2,0x00,0x0b,0xf7,0xbf,0x84,0x06,0xff,0xe7,0x10,0x0b,0xfd,0xef,0xed,
-0xdf,0xa5,0xcf,0xe0,0x04,0x55,0x58,0xfd,0x43,0xf0,0x0f,0x50,0x27,0xcf,0xf9,0x7d,
-0xe1,0x30,0x03,0xf1,0x01,0xdd,0xff,0xfb,0x6a,0x20,0x00,0x00,0x03,0x9f,0xfb,0x52,
-0x7f,0xf5,0x00,0x04,0xdf,0x9f,0x43,0xf1,0x09,0x50,0x02,0x8a,0xe8,0x3d,0xf1,0x48,
+0x94,0xf4,0x3f,0x3d,0x85,0xcf,0x80,0x2f,0xdc,0xf2,0x5f,0x08,0x44,0xfa,0x00,0x0b,
+0xff,0xa0,0x00,0x00,0x00,0xf9,0x00,0x23,0x04,0x10,0x70,0x03,0xf1,0x5b,0x80,0x2f,
+0xa2,0x1b,0xe1,0x50,0x00,0xbe,0x20,0x2f,0xae,0x9b,0xe7,0xf4,0x03,0xf6,0xbe,0x5f,
+0xa9,0xfb,0xeb,0xd0,0x0d,0xe5,0xfc,0x2f,0xa5,0xdd,0xfd,0x60,0x7f,0xff,0xf3,0x2f,
+0xaa,0xae,0xfa,0xa3,0x18,0xbf,0x93,0x2f,0xaf,0xff,0xff,0xf5,0x02,0xfb,0x8e,0x3f,
+0xa0,0x7f,0xf3,0x00,0x1d,0xfc,0xef,0x7f,0xa0,0xef,0xfe,0x20,0x4f,0xfd,0xae,0xbf,
+0xa9,0xfe,0xfe,0xd1,0x06,0x10,0x17,0x2f,0xef,0xbb,0xe5,0xf5,0x0a,0x7e,0x8f,0x3f,
+0xbe,0x2b,0xe0,0x60,0x0e,0x6e,0x6f,0x9f,0xa1,0x0b,0xe0,0x00,0x2f,0x3d,0x76,0x5f,
+0xeb,0xbd,0xeb,0xb7,0x4c,0x04,0x10,0x2f,0x8a,0x09,0x50,0x2b,0x30,0x00,0x00,0xee,
+0x78,0x01,0x90,0x50,0x38,0x88,0xff,0x88,0x70,0x00,0xdc,0x10,0x80,0x01,0x50,0xf0,
+0x05,0xf4,0x9d,0x10,0x18,0x00,0x40,0x0d,0xd2,0xfa,0x0d,0x90,0x01,0x40,0x7f,0xff,
+0xf1,0x09,0xa2,0x07,0xc1,0x3c,0xcf,0x60,0x48,0x88,0x88,0x88,0x80,0x01,0xda,0x99,
+0x7f,0x70,0x02,0xf0,0x28,0xfc,0xee,0x8f,0x48,0x35,0x79,0xf1,0x4f,0xfe,0xcf,0x8a,
+0x6f,0x5b,0xe6,0xa0,0x05,0x10,0x29,0x00,0x7f,0x4b,0xe0,0x00,0x0d,0x8f,0x8f,0x10,
+0xcf,0x2b,0xe0,0x30,0x0f,0x6e,0x7e,0x75,0xfc,0x0b,0xe1,0xf6,0x4f,0x3d,0x85,0xaf,
+0xf2,0x0a,0xfb,0xf4,0x4c,0x03,0x10,0xce,0x40,0x05,0xff,0xc0,0xd6,0x07,0x08,0x37,
+0x08,0x00,0x60,0x03,0xf0,0x2b,0x8f,0xff,0xff,0x60,0x0b,0xf5,0xaf,0x54,0x5e,0xb8,
+0xdf,0x20,0x0b,0xff,0xff,0xf8,0x0d,0xd2,0xfc,0x00,0x0b,0xf6,0x66,0xe8,0x03,0xff,
+0xf2,0x00,0x0b,0xf7,0xbf,0x84,0x06,0xff,0xe7,0x10,0x0b,0xfd,0xef,0xed,0xdf,0xa5,
+0xcf,0xe0,0x04,0x55,0x58,0xfd,0x43,0x10,0x04,0x30,0x00,0x27,0xcf,0xf9,0x7d,0xe1,
+0x30,0x03,0xf0,0x01,0xdd,0xff,0xfb,0x6a,0x20,0x00,0x00,0x03,0x9f,0xfb,0x52,0x7f,
+0xf5,0x00,0x04,0xdf,0x26,0x08,0xf1,0x0a,0xef,0x50,0x02,0x8a,0xe8,0x3d,0xf1,0x48,
 0x47,0x10,0x08,0xdf,0xb6,0x6e,0xf1,0x5b,0xfe,0x50,0x02,0x72,0x05,0xfe,0xa0,0x00,
-0x16,0xf0,0x01,0x02,0x3e,0x08,0x00,0x27,0x3a,0x00,0x0b,0x7d,0xf2,0x03,0x30,0x08,
-0x99,0x99,0xdf,0x10,0x02,0xf9,0x3e,0x43,0x77,0x77,0xcf,0x10,0x0c,0xf3,0xdf,0x37,
-0x99,0x2f,0x01,0xe5,0x07,0x51,0x20,0x2b,0xbf,0xd2,0xaf,0xd1,0x0a,0xf7,0x2d,0xde,
-0x6f,0x69,0x99,0xfe,0x99,0x90,0x2d,0xfc,0xbf,0x6c,0x90,0xfb,0x0b,0x90,0x3f,0xfd,
-0xbe,0x89,0xf7,0xfe,0xbf,0x60,0x05,0x01,0x38,0x00,0x7b,0xff,0xf4,0x00,0x0f,0xaf,
-0x9e,0x07,0xff,0xff,0xfb,0x10,0x1f,0x6f,0x7f,0xdf,0xc2,0xfb,0x7f,0xf2,0x4f,0x3e,
-0x77,0x26,0x49,0xfb,0x04,0x70,0x3b,0x04,0x10,0x00,0x2f,0x40,0x28,0x00,0xc3,0x51,
-0x30,0x01,0x85,0x00,0x04,0x3d,0x02,0xa0,0x68,0x30,0xcf,0x21,0x0c,0xe0,0x04,0xf0,
-0x15,0x03,0xf8,0x7f,0x4d,0xf7,0x77,0x7f,0xd0,0x0c,0xf1,0xee,0x1d,0xf6,0x66,0x6f,
-0xd0,0x7f,0xff,0xf6,0x0d,0xfe,0xee,0xef,0xd0,0x2c,0xcf,0xc1,0x0d,0xf4,0x44,0x4f,
-0xd0,0x01,0xee,0xcd,0x0d,0x41,0x06,0xf0,0x22,0x2d,0xfc,0xdf,0x21,0x10,0xcf,0x16,
-0x50,0x3f,0xfe,0xcf,0xcf,0xfe,0xcf,0xaf,0xe1,0x05,0x10,0x29,0x39,0xfa,0xcf,0xfc,
-0x20,0x0e,0x9f,0x9f,0x0a,0xf3,0xcf,0xfa,0x00,0x1f,0x6f,0x6b,0xcf,0xa0,0xcf,0x9f,
-0xc2,0x4f,0x3e,0x70,0xca,0x4b,0xff,0x0b,0xe2,0x3a,0x97,0x88,0x26,0xe8,0x00,0x58,
-0x05,0x10,0x25,0x5e,0x50,0x00,0xf8,0x01,0x12,0x40,0x59,0x28,0x11,0xdc,0x98,0x18,
-0xf1,0x05,0x90,0x04,0xf5,0xbd,0x8f,0x87,0x77,0x7f,0x90,0x0d,0xd4,0xf9,0x8f,0x10,
-0x00,0x0e,0x90,0x6f,0xff,0xf1,0x18,0x00,0xf1,0x04,0x1a,0xbf,0x81,0x8f,0x77,0x77,
-0x77,0x40,0x01,0xec,0xca,0x9f,0x65,0x55,0x55,0x50,0x1d,0xfb,0xde,0xa9,0x28,0xf0,
-0x05,0x3f,0xff,0xdf,0xcf,0xf2,0xe3,0xf3,0xf1,0x05,0x10,0x46,0xdf,0xf6,0xf6,0xf6,
-0xf1,0x0e,0x9f,0xa9,0xfd,0x18,0x00,0x40,0x0f,0x7f,0x9e,0xfa,0x10,0x00,0xf5,0x01,
-0x3f,0x3f,0x69,0xf6,0xf2,0xe3,0xf5,0xf1,0x5f,0x06,0x12,0xa3,0xf2,0x81,0x7b,0xd0,
-0x9c,0x14,0x03,0x8d,0x1e,0x84,0x04,0xfa,0x3c,0xf4,0x5f,0xb3,0xaf,0x50,0x10,0x00,
-0x94,0x01,0x55,0x55,0x6f,0xe5,0x55,0x55,0x10,0x0e,0x70,0x05,0x92,0x66,0x66,0x9f,
-0xb6,0x66,0x66,0x40,0x00,0x4f,0xdb,0x13,0x00,0xdb,0x37,0x20,0x66,0x6c,0x08,0x00,
-0x40,0xda,0xaa,0xaa,0xae,0x08,0x00,0x40,0xdb,0xbb,0xbb,0xbe,0x08,0x00,0x64,0xa4,
-0x44,0x44,0x4b,0xf4,0x00,0x28,0x00,0x20,0x06,0x9f,0x28,0x00,0x24,0xf8,0x61,0x3c,
-0x0f,0x06,0x70,0x00,0xf0,0x02,0x4c,0xf5,0x6f,0xb4,0xaf,0x50,0x04,0xfd,0xae,0xfa,
-0xbf,0xda,0xdf,0x50,0x03,0xbb,0xbb,0x56,0x54,0x00,0x94,0x3b,0x42,0xbf,0xb7,0x75,
-0x4b,0xe5,0x9f,0xb4,0xfe,0xfe,0x30,0x04,0x44,0x44,0x9f,0x95,0xbf,0xf7,0x40,0x71,
-0x0e,0xa2,0x01,0x11,0x49,0xef,0xfc,0x65,0x54,0x10,0x27,0xae,0xb4,0x0f,0xa0,0x2f,
-0xfd,0xfe,0x55,0x55,0x56,0xfc,0x00,0x04,0x10,0xbc,0x68,0x00,0xc0,0x0e,0x41,0xee,
-0x66,0x66,0x66,0x61,0x83,0x03,0xd7,0x73,0x07,0xd9,0x5c,0x31,0x00,0x8d,0x20,0x0d,
-0x22,0x82,0xfa,0xfc,0x00,0x00,0x59,0x99,0xef,0xa9,0x0a,0x4c,0x43,0xcf,0x27,0xfe,
-0x20,0xb8,0x0a,0x00,0xae,0x27,0x60,0x89,0xdf,0xfb,0x88,0x88,0x80,0xf2,0x4a,0x30,
-0xa4,0x44,0x42,0xe3,0x7a,0x01,0x84,0x1c,0x40,0x3e,0xff,0xbf,0xf3,0x29,0x0d,0x40,
-0x0f,0xa3,0x5f,0xf9,0x48,0x0d,0x11,0x01,0xa9,0x09,0x18,0xc0,0x13,0x66,0x42,0x4b,
-0xbb,0xff,0x30,0xd5,0x35,0x0a,0x84,0x77,0x00,0x25,0x4a,0x03,0x08,0x00,0xa2,0x9e,
+0x16,0xf0,0x01,0x02,0x3e,0x08,0x10,0xc0,0xe0,0x00,0xf0,0x06,0x10,0x00,0x9f,0x30,
+0x08,0x99,0x99,0xdf,0x10,0x02,0xf9,0x3e,0x43,0x77,0x77,0xcf,0x10,0x0c,0xf3,0xdf,
+0x37,0x18,0x00,0x21,0x7f,0xff,0xe5,0x07,0x50,0x20,0x2b,0xbf,0xd2,0xaf,0xf0,0x00,
+0xf7,0x2f,0x01,0xde,0x6f,0x69,0x99,0xfe,0x99,0x90,0x2d,0xfc,0xbf,0x6c,0x90,0xfb,
+0x0b,0x90,0x3f,0xfd,0xbe,0x89,0xf7,0xfe,0xbf,0x60,0x05,0x01,0x38,0x00,0x7b,0xff,
+0xf4,0x00,0x0f,0xaf,0x9e,0x07,0xff,0xff,0xfb,0x10,0x1f,0x6f,0x7f,0xdf,0xc2,0xfb,
+0x7f,0xf2,0x4f,0x3e,0x77,0x26,0x49,0xfb,0x04,0x70,0x3b,0x04,0x10,0x00,0x2f,0xe5,
+0xf1,0x00,0x50,0x07,0x10,0x00,0x01,0x85,0xc0,0x07,0x40,0x80,0x00,0x06,0xfb,0x80,
+0x07,0x20,0x21,0x0c,0xe0,0x04,0xf0,0x15,0x03,0xf8,0x7f,0x4d,0xf7,0x77,0x7f,0xd0,
+0x0c,0xf1,0xee,0x1d,0xf6,0x66,0x6f,0xd0,0x7f,0xff,0xf6,0x0d,0xfe,0xee,0xef,0xd0,
+0x2c,0xcf,0xc1,0x0d,0xf4,0x44,0x4f,0xd0,0x01,0xee,0xcd,0x0d,0x41,0x06,0xf6,0x28,
+0x2d,0xfc,0xdf,0x21,0x10,0xcf,0x16,0x50,0x3f,0xfe,0xcf,0xcf,0xfe,0xcf,0xaf,0xe1,
+0x05,0x10,0x29,0x39,0xfa,0xcf,0xfc,0x20,0x0e,0x9f,0x9f,0x0a,0xf3,0xcf,0xfa,0x00,
+0x1f,0x6f,0x6b,0xcf,0xa0,0xcf,0x9f,0xc2,0x4f,0x3e,0x70,0xca,0x4b,0xff,0x0b,0xe2,
+0x3a,0x01,0x00,0x00,0x2f,0xe8,0x00,0x58,0x05,0x50,0x25,0x00,0x00,0x01,0x73,0xf8,
+0x01,0xa0,0x40,0x00,0x01,0xfa,0x00,0x00,0x00,0xdc,0x10,0x8f,0xc8,0x05,0xf1,0x04,
+0x04,0xf5,0xbd,0x8f,0x87,0x77,0x7f,0x90,0x0d,0xd4,0xf9,0x8f,0x10,0x00,0x0e,0x90,
+0x6f,0xff,0xf1,0x18,0x00,0xf0,0x05,0x1a,0xbf,0x81,0x8f,0x77,0x77,0x77,0x40,0x01,
+0xec,0xca,0x9f,0x65,0x55,0x55,0x50,0x1d,0xfb,0xde,0x9f,0x10,0x01,0xf0,0x05,0x3f,
+0xff,0xdf,0xcf,0xf2,0xe3,0xf3,0xf1,0x05,0x10,0x46,0xdf,0xf6,0xf6,0xf6,0xf1,0x0e,
+0x9f,0xa9,0xfd,0x18,0x00,0x40,0x0f,0x7f,0x9e,0xfa,0x10,0x00,0xf4,0x01,0x3f,0x3f,
+0x69,0xf6,0xf2,0xe3,0xf5,0xf1,0x5f,0x06,0x12,0xa3,0xf2,0x81,0x7b,0xd0,0x7f,0x00,
+0x03,0xd0,0x05,0x94,0x50,0x04,0xfa,0x3c,0xf4,0x5f,0xb3,0xaf,0x50,0x10,0x00,0x94,
+0x01,0x55,0x55,0x6f,0xe5,0x55,0x55,0x10,0x0e,0x70,0x05,0xa0,0x66,0x66,0x9f,0xb6,
+0x66,0x66,0x40,0x00,0x4f,0xff,0xf7,0x06,0x70,0x00,0x00,0x4f,0xb6,0x66,0x66,0x6c,
+0x08,0x00,0x40,0xda,0xaa,0xaa,0xae,0x08,0x00,0x40,0xdb,0xbb,0xbb,0xbe,0x08,0x00,
+0x64,0xa4,0x44,0x44,0x4b,0xf4,0x00,0x28,0x00,0x20,0x06,0x9f,0x28,0x00,0x33,0xf8,
+0x61,0x2f,0xd8,0x07,0x06,0x70,0x00,0xf0,0x11,0x4c,0xf5,0x6f,0xb4,0xaf,0x50,0x04,
+0xfd,0xae,0xfa,0xbf,0xda,0xdf,0x50,0x03,0xbb,0xbb,0xdf,0xdb,0xbb,0xbb,0x40,0x00,
+0x37,0x77,0xbf,0xb7,0x75,0x4b,0x20,0x00,0x6f,0x38,0x02,0xa3,0xfe,0x30,0x04,0x44,
+0x44,0x9f,0x95,0xbf,0xf7,0x40,0xe0,0x05,0xa1,0xf2,0x01,0x11,0x49,0xef,0xfc,0x65,
+0x54,0x10,0x27,0xd0,0x07,0xf0,0x0a,0xfc,0x00,0x2f,0xfd,0xfe,0x55,0x55,0x56,0xfc,
+0x00,0x04,0x10,0xef,0xee,0xee,0xee,0xfc,0x00,0x00,0x00,0xee,0x66,0x66,0x66,0xfc,
+0xa9,0x07,0x01,0x20,0x00,0x00,0x42,0x04,0x02,0x62,0x02,0x00,0x08,0x00,0x40,0x8d,
+0x20,0x00,0x8f,0x6e,0x03,0x91,0xfc,0x00,0x00,0x59,0x99,0xef,0xa9,0xdf,0xd1,0x72,
+0x09,0x34,0x27,0xfe,0x20,0xb8,0x0a,0xf0,0x04,0xf1,0x08,0x88,0x89,0xdf,0xfb,0x88,
+0x88,0x80,0x00,0x00,0x3c,0xff,0xa4,0x44,0x42,0x00,0x00,0x4b,0x17,0x00,0x60,0xf7,
+0x00,0x3e,0xff,0xbf,0xf3,0x29,0x0d,0x91,0x0f,0xa3,0x5f,0xf9,0x99,0x99,0x90,0x00,
+0x01,0xa9,0x09,0x12,0xc0,0x5a,0x00,0x20,0x6f,0x90,0x06,0x00,0x52,0x4b,0xbb,0xff,
+0x30,0x00,0x64,0x0c,0x09,0x8a,0x0b,0x12,0xfd,0x63,0x03,0x00,0x08,0x00,0xa2,0x9e,
 0x30,0x00,0x8b,0xbb,0xff,0xbb,0xb8,0xfd,0x10,0xe8,0x09,0x11,0xe2,0x18,0x00,0x40,
-0x04,0xef,0x30,0x00,0xf8,0x0a,0x47,0xbf,0xfe,0xbb,0xb1,0x6c,0x3e,0x22,0xff,0xa0,
-0xd3,0x73,0x00,0xb0,0x0c,0x23,0x00,0x3b,0x79,0x99,0x61,0x2e,0xd7,0xfd,0x22,0x22,
-0x2b,0x54,0xa3,0x03,0xc9,0x69,0x41,0xfe,0x33,0x33,0x3b,0x10,0x00,0x34,0x99,0x99,
-0x9d,0x18,0x00,0x11,0xe4,0xb3,0x10,0x10,0x2f,0x4c,0x3a,0x81,0x55,0x5f,0xf0,0x2f,
-0xc2,0x9f,0x50,0x0b,0x8d,0x2b,0xf0,0x08,0xfd,0x80,0x01,0x11,0x1f,0xf0,0x2f,0xe5,
-0x10,0x20,0x09,0xac,0xef,0xf0,0x1f,0xe4,0x48,0xf6,0x0b,0xa8,0x5f,0xf0,0x0a,0x89,
-0x00,0x63,0x06,0x69,0x96,0x66,0x67,0x74,0xd5,0x14,0x00,0xed,0x1c,0x57,0xe1,0x11,
-0x11,0x17,0xf8,0x10,0x00,0x48,0xe5,0x55,0x55,0x59,0x08,0x00,0x00,0x7c,0x25,0x11,
-0xf8,0x24,0x0a,0x31,0x07,0xac,0xf7,0x08,0x00,0x36,0x06,0xfe,0xb1,0xf6,0x00,0x41,
-0x6e,0x50,0x00,0x3f,0x97,0x3c,0xf0,0x1b,0x5b,0x60,0x3f,0xa0,0x4b,0x10,0x06,0xfa,
-0x2f,0xf1,0x3f,0xdc,0xff,0x70,0x3f,0xfb,0xaf,0xf9,0x3f,0xfd,0x71,0x00,0x0f,0xfe,
-0xdb,0xff,0x4f,0xb0,0x02,0x81,0x02,0x00,0x00,0x51,0x2f,0xd3,0x38,0xf5,0x0a,0xff,
-0xff,0xf1,0xfd,0x21,0xf0,0x11,0x0a,0xfa,0x9e,0xf1,0x18,0xb7,0x77,0x20,0x0a,0xfb,
-0xae,0xf1,0x2f,0xb0,0x07,0x00,0x0a,0xfe,0xef,0xf1,0x2f,0xb6,0xef,0xa0,0x0a,0xf2,
-0x0c,0xf1,0x2f,0xff,0xf9,0x20,0x28,0x00,0xf2,0x11,0x2f,0xe6,0x10,0x10,0x0a,0xf6,
-0x5d,0xf1,0x2f,0xb0,0x01,0xf6,0x0a,0xf2,0xbf,0xf1,0x1f,0xfc,0xce,0xf6,0x0a,0xf1,
-0xde,0x80,0x07,0xde,0xee,0xa0,0x00,0x00,0x4b,0x90,0xc2,0x83,0x30,0x00,0x00,0x9b,
-0x50,0x46,0x22,0xba,0xdf,0x5d,0x47,0x41,0x31,0x11,0x11,0x13,0x71,0x47,0x03,0x70,
-0x47,0x01,0x6f,0x47,0x14,0xbc,0x12,0x00,0x00,0xf6,0x0c,0x04,0x18,0x00,0x01,0x59,
-0x3b,0x03,0x06,0x00,0x02,0x12,0x00,0x00,0x1e,0x00,0x00,0xea,0x0c,0x13,0x59,0x5d,
-0x13,0x15,0xf6,0xc6,0x21,0x41,0xb0,0x00,0x3f,0xe9,0x30,0x0a,0x22,0x03,0xfc,0xbd,
-0x51,0x12,0x3f,0x2f,0x0a,0x66,0x03,0xfe,0x77,0x77,0x77,0x9f,0x1e,0x00,0x04,0x2d,
-0x00,0xd0,0xc0,0x1e,0xf4,0x00,0x5b,0x10,0x03,0xfc,0x00,0x6f,0xe3,0x8f,0xf8,0xdd,
-0x3b,0xb1,0x9f,0xff,0xd4,0x00,0x05,0xfd,0x37,0xb5,0x8f,0xfd,0x61,0xe8,0x07,0xa5,
-0x4d,0xff,0xf7,0x0b,0xfd,0x95,0x20,0x00,0x04,0xac,0x5e,0x74,0x05,0x80,0x71,0x43,
-0x7f,0xb1,0x11,0x10,0xb3,0x03,0x11,0xf6,0xcb,0xa8,0x31,0x99,0xbf,0xf2,0x49,0x52,
-0x33,0x02,0xef,0x40,0xe6,0x24,0x00,0x49,0x20,0x60,0xef,0xbb,0xbf,0xfb,0xbc,0xfb,
-0xf0,0x02,0x30,0x0e,0xe0,0x01,0x08,0x00,0x53,0xba,0xaf,0xfa,0xab,0xfb,0xbf,0x1a,
-0x00,0x08,0x00,0x53,0x32,0x22,0x22,0x23,0xfb,0x18,0x03,0x21,0x06,0x81,0xfa,0x9b,
-0x00,0xdd,0x09,0x90,0x8f,0xec,0xbb,0xbb,0xbb,0xdf,0xd0,0x00,0x09,0x3a,0x03,0x20,
-0xeb,0x20,0x9d,0x61,0x10,0x06,0xe3,0x60,0x03,0x92,0x02,0x60,0x46,0x66,0xdf,0x86,
-0x6a,0xfb,0xc9,0x97,0x60,0x56,0x00,0x02,0x62,0xbf,0x30,0x77,0x12,0x53,0x8b,0xfc,
-0x9e,0x70,0x0b,0xf2,0x0d,0x71,0x0b,0xf2,0x44,0x44,0x44,0xf9,0x12,0xf0,0x61,0xf0,
-0x26,0xf5,0xfa,0x7f,0x60,0x0b,0xf6,0xf1,0xd8,0x10,0xfb,0xcf,0x10,0x0c,0xf6,0xff,
-0xff,0xf1,0xef,0xfb,0x00,0x0d,0xe6,0xf2,0x25,0xf1,0xbf,0xf3,0x00,0x0e,0xd6,0xff,
-0xff,0xf1,0x8f,0xb0,0x00,0x1f,0xa6,0xf3,0xe9,0x35,0xff,0xb0,0xc1,0x6f,0x56,0xff,
-0xee,0xff,0xc9,0xfe,0xf3,0x7d,0x80,0x1a,0x27,0x00,0xaf,0xc3,0x35,0x13,0xb4,0xb2,
-0x28,0x21,0xf4,0x0f,0x31,0x5e,0x20,0xef,0x80,0xc4,0x4b,0x34,0x90,0x3f,0xfa,0x65,
-0x44,0x12,0xdc,0xc0,0x84,0x02,0x53,0x7b,0x00,0x35,0x73,0x11,0xbf,0xd7,0x25,0xa1,
-0xff,0xd0,0x8b,0xbb,0xbf,0xfb,0xb1,0x5f,0xff,0xd0,0xb8,0x13,0x32,0x2e,0x9f,0xd0,
-0xc0,0x13,0x1f,0x1f,0x08,0x00,0x07,0x31,0x7f,0xff,0xd0,0x08,0x00,0x10,0x3e,0x77,
-0xaa,0x40,0x39,0x20,0x13,0x58,0x82,0x09,0x00,0x03,0x39,0xe1,0xc3,0xff,0xf7,0x1c,
-0xf8,0x05,0x4d,0xc0,0x02,0xaa,0xa4,0x6f,0xa4,0x4f,0x08,0x4d,0x60,0x08,0x4f,0xda,
-0xae,0xea,0xa4,0x38,0x04,0xf0,0x12,0x59,0x9e,0xe9,0x95,0xaa,0xa8,0x07,0xfe,0x1f,
-0xae,0xea,0xf8,0xff,0xfc,0x4f,0xfe,0x1f,0xdf,0xfd,0xf2,0x2f,0xa0,0x7f,0xfe,0x1f,
-0x7d,0xd7,0xf1,0x2f,0xa0,0x06,0xce,0x1f,0xac,0x02,0x70,0xa0,0x00,0xce,0x04,0x4d,
-0xd4,0x40,0x08,0x00,0x00,0xe4,0x9d,0x00,0x08,0x00,0x31,0x03,0x3c,0xc4,0x10,0x00,
-0xe4,0x4d,0xdf,0xff,0xfc,0xdf,0x90,0x00,0xce,0x3a,0x98,0x64,0x36,0xfd,0x30,0xaf,
-0x26,0x20,0x03,0x99,0xbb,0x51,0x34,0x99,0x40,0x05,0xfd,0x3c,0x20,0x11,0x11,0x8c,
-0x03,0x02,0x89,0x01,0x00,0x2a,0x0e,0x82,0x47,0x77,0x7f,0xf7,0x77,0x76,0x00,0x08,
-0x9f,0x26,0x16,0x80,0x66,0x3e,0x60,0x5e,0xf8,0xfe,0x10,0x27,0x00,0x18,0x10,0x50,
-0x9f,0x73,0xef,0x70,0x3c,0x52,0x20,0x50,0xff,0xf6,0x00,0x1e,0xc8,0x7a,0x7b,0x10,
-0x50,0xfb,0x7d,0x50,0x7b,0xf6,0x9f,0xf9,0x20,0xe3,0x07,0x81,0xc4,0x06,0xff,0xf4,
-0x00,0x08,0xfb,0x61,0xa4,0x82,0x06,0x86,0x3b,0x20,0x28,0x60,0x5f,0x02,0x64,0x44,
-0x44,0x7f,0xf5,0x44,0x44,0x47,0x24,0x10,0xd0,0x14,0x29,0x01,0x79,0x61,0x13,0x0c,
-0x90,0x5c,0x82,0x0d,0xf5,0x55,0x55,0x6f,0xe0,0x00,0x0f,0x9c,0x6c,0x95,0xf1,0x06,
-0x6e,0xf4,0x44,0x44,0x5f,0xf6,0x60,0x20,0x00,0xf0,0x04,0x06,0x8f,0xfc,0xef,0x97,
-0x88,0x00,0x00,0x17,0xef,0xa0,0x6f,0xb3,0xef,0x60,0x3b,0xff,0xff,0x10,0x2a,0x89,
-0x71,0x0d,0xc6,0xcf,0x46,0x95,0xdf,0xe6,0x6d,0x1a,0x20,0xf6,0x1a,0x1f,0x1e,0x57,
-0xdb,0x74,0x00,0x00,0x39,0x16,0x84,0x11,0xec,0xf7,0x22,0x22,0x07,0xb1,0x08,0x00,
-0xc2,0x0a,0xfc,0xec,0x7b,0xbc,0xfe,0xbb,0xb3,0x00,0x85,0xec,0x9f,0x36,0x19,0x11,
-0xfc,0x18,0x00,0x20,0x04,0xbf,0xd5,0x3b,0x00,0xd6,0xa6,0x20,0xfc,0x3f,0x71,0x00,
-0x61,0x05,0x10,0x98,0x3e,0xd9,0x99,0x42,0x5d,0x26,0x1f,0xe1,0x96,0x19,0xf0,0x17,
-0xf6,0x07,0x77,0x8e,0xfc,0xff,0x77,0x9e,0x73,0x00,0x49,0xff,0x80,0x7f,0x97,0xff,
-0x50,0x1f,0xff,0xfd,0x00,0x0c,0xff,0xb1,0x00,0x04,0x42,0xfe,0xad,0xf3,0xaf,0xfa,
-0x51,0x00,0x0b,0xff,0xeb,0x70,0x95,0x81,0x23,0x04,0x52,0xfe,0x7b,0x03,0x71,0x03,
-0x30,0xe5,0xcd,0x00,0x5a,0xaf,0xf2,0x0b,0x05,0xf9,0xde,0x44,0x22,0xf8,0x0f,0xa0,
-0x0d,0xfe,0xff,0xee,0x72,0xf8,0x0f,0xa0,0x0c,0xc8,0xee,0x88,0x82,0xf8,0x0f,0xa0,
-0x08,0x88,0x08,0x00,0x00,0xfc,0x1f,0x10,0xa2,0x08,0x00,0xe0,0xf2,0xcd,0x5e,0xa0,
-0x44,0x3f,0xa0,0x05,0xc0,0xcd,0x7f,0xc0,0x0c,0xfe,0x48,0x00,0x44,0x0b,0xf4,0x00,
-0x10,0x07,0x26,0xf3,0x1a,0xf5,0x08,0x88,0x9e,0xff,0xef,0x98,0xaf,0x93,0x04,0x7b,
-0xff,0x91,0x4f,0xb7,0xff,0x50,0x0d,0xfd,0xfd,0x00,0x18,0xff,0xc1,0x00,0x01,0x11,
-0xfe,0xbe,0xc0,0x7f,0xfd,0x83,0x00,0x06,0xff,0xb8,0x30,0x01,0x9d,0xf1,0xa7,0x1b,
-0x10,0x10,0x3a,0x12,0x11,0x51,0xed,0x40,0x02,0xcb,0x2c,0x21,0x00,0x5f,0xfd,0x06,
-0x90,0xf6,0x1b,0xce,0xc5,0xcf,0xc9,0x99,0x99,0x94,0x0d,0x00,0x30,0xcb,0xbb,0xbb,
-0xa2,0xb0,0x30,0x8f,0xd6,0x66,0xf5,0x85,0x21,0x97,0x1f,0x1e,0x1a,0xa1,0xcf,0xaf,
-0x4f,0xc5,0x55,0x7f,0xa0,0x0c,0xff,0xf6,0x10,0x00,0xc1,0x5f,0xff,0xee,0x10,0xcf,
-0xc5,0x55,0x00,0x0b,0x9f,0x4c,0x2c,0x52,0x10,0x50,0x8f,0x15,0xff,0xfc,0x28,0x28,
-0x86,0x31,0x10,0x73,0x7f,0x75,0x7e,0xe9,0x14,0x9d,0xff,0xef,0xfe,0xb6,0x00,0x8f,
-0x13,0xea,0x51,0x02,0x8b,0xe2,0x70,0x5d,0x00,0x0a,0x07,0xf3,0x01,0xaa,0xad,0xfb,
-0xaf,0xea,0xaa,0xa1,0x00,0x77,0x7c,0xf8,0x7f,0xe7,0x77,0x40,0x01,0x4b,0x34,0xf4,
-0x02,0x01,0xfb,0x0a,0xf3,0x1f,0xc0,0x5f,0x90,0x01,0xfd,0x7c,0xf8,0x7f,0xd7,0x9f,
-0x90,0x01,0x63,0x34,0x37,0x11,0x15,0xfd,0xce,0x4b,0xd1,0xf6,0x09,0x99,0xef,0xc9,
-0x99,0xff,0xb9,0x94,0x00,0x05,0xff,0x83,0xb7,0x31,0x22,0x07,0xbe,0x4e,0x28,0x20,
-0x46,0x8b,0x8a,0x0f,0x20,0x40,0x08,0x29,0x78,0x51,0x5a,0xff,0x60,0x01,0x53,0xca,
-0x4d,0x03,0xb9,0x01,0x00,0x4a,0x06,0x03,0x69,0x50,0x00,0x5f,0x2a,0x27,0x5a,0xf7,
-0x18,0x00,0x48,0xc1,0x11,0x11,0x18,0x10,0x00,0x5e,0xe9,0x99,0x99,0x9c,0xf7,0x18,
-0x00,0x60,0x08,0xaf,0xf8,0x9f,0xe8,0x84,0x30,0x05,0x40,0xb0,0x1f,0xd0,0x00,0x16,
-0x98,0xf1,0x00,0x40,0x1f,0xd0,0x03,0xf9,0x1b,0xef,0xf8,0x00,0x0f,0xfd,0xce,0xf6,
-0x0a,0xfa,0xb6,0x44,0x18,0xb0,0x84,0x2b,0x03,0x08,0x00,0x10,0x07,0xc8,0x00,0x70,
-0x02,0x2f,0xc2,0x17,0xfc,0xaa,0xbf,0x7d,0x25,0x90,0xc7,0xf9,0x77,0x9f,0x90,0x07,
-0x7f,0xe7,0x67,0xe0,0x00,0x00,0x20,0x00,0x80,0xf5,0x11,0x4f,0x90,0x28,0x8f,0xe8,
-0x87,0x10,0x00,0xf1,0x05,0x5f,0xff,0xff,0xf7,0xf9,0x66,0x8f,0x90,0x02,0x5f,0xc2,
-0x27,0xfb,0x99,0xbf,0x90,0x00,0x6f,0xf7,0x07,0x28,0x00,0xf1,0x16,0xaf,0xdf,0x50,
-0x6f,0x7d,0xe0,0x00,0x00,0xed,0x1e,0xf0,0xaf,0x3d,0xe0,0x00,0x08,0xf8,0x05,0x53,
-0xfd,0x0d,0xe0,0x81,0x4f,0xd0,0x00,0x7f,0xf4,0x0c,0xfb,0xf7,0x0b,0x30,0x00,0xcd,
-0x40,0x06,0xfb,0x07,0x19,0x10,0x2b,0x90,0x22,0x6f,0xa0,0x69,0xaa,0xa0,0x0c,0xe1,
-0x09,0xf8,0x77,0x8f,0xb0,0x5e,0xef,0xfe,0x44,0x10,0x51,0xb0,0x5d,0xdd,0xef,0x59,
-0x18,0x00,0x41,0x01,0xec,0x09,0xf2,0xaf,0x88,0x11,0xf4,0x28,0x00,0x31,0x01,0xbf,
-0xf6,0x28,0x00,0x40,0x4e,0xff,0xff,0x79,0x08,0x00,0x40,0x9f,0xcf,0xde,0xb9,0x18,
-0x00,0x71,0x36,0x1f,0xc3,0x10,0xaf,0x3b,0xf0,0x0c,0x43,0x30,0xdf,0x0b,0xf0,0x64,
-0x5a,0xf6,0x05,0x07,0xfa,0x0b,0xf0,0xd8,0x00,0x1f,0xc3,0xcf,0xd1,0x0b,0xfc,0xf8,
-0x00,0x1f,0xc1,0xd8,0x10,0x05,0xee,0xd7,0x25,0x23,0x6a,0x20,0x71,0x50,0x21,0x21,
-0x00,0xf7,0x22,0xf0,0x07,0xff,0xff,0xd0,0x8b,0xfb,0x8e,0xf0,0x08,0xf9,0x7f,0x90,
-0x09,0xf2,0x0c,0xe0,0x3f,0xf7,0xaf,0x94,0x2e,0xd0,0x0e,0x5c,0x24,0xf0,0x0b,0xfc,
-0xee,0x27,0xff,0x90,0x08,0xf2,0xf2,0xea,0x99,0x2a,0xf6,0x00,0x07,0xfe,0xfe,0xfa,
-0x6f,0x4d,0xf0,0x00,0x07,0xfb,0xfb,0xfa,0xaf,0x26,0x45,0xc0,0xf1,0xf2,0xec,0xfd,
-0x9e,0xf9,0x90,0x09,0xfb,0xfc,0xfb,0x92,0x4e,0xb3,0x40,0xfb,0xfb,0xfa,0xdf,0xc3,
-0x14,0xb0,0xb0,0xf2,0xea,0x9a,0xaf,0xfa,0xa4,0x2f,0x70,0xfa,0xf9,0xe5,0x18,0x42,
-0x5e,0x10,0x6a,0xe4,0x34,0x39,0x06,0x29,0x87,0x03,0xc3,0x2e,0x00,0x0b,0x6c,0x00,
-0xd8,0x04,0x2b,0x8d,0xfd,0xce,0x4b,0x06,0x99,0x02,0x00,0x35,0x1d,0x00,0x8d,0x1e,
-0x00,0xcb,0x94,0x00,0xad,0x1c,0x16,0x72,0x18,0x00,0x04,0x01,0x00,0x10,0x0a,0xca,
-0x12,0x13,0xa4,0x88,0x29,0x12,0xf7,0xab,0x36,0x10,0x07,0x08,0x00,0x03,0x30,0x02,
-0x04,0x18,0x00,0x14,0x01,0x4b,0x38,0x12,0x60,0xaf,0x96,0x22,0x0e,0xd0,0x08,0x00,
-0x21,0x09,0xc0,0x08,0x00,0x00,0x39,0x10,0x00,0x08,0x00,0x10,0x08,0xe0,0x17,0x20,
-0xcf,0x20,0x98,0x05,0x10,0x70,0xd4,0x2d,0x41,0x05,0xee,0xee,0xb9,0x0e,0x43,0xb0,
-0x55,0x55,0x47,0xcc,0xff,0xdc,0xc1,0x05,0xdd,0xdd,0xa0,0x20,0x00,0x40,0x02,0x77,
-0x77,0x60,0x08,0x00,0x10,0x04,0x57,0x12,0x00,0x08,0x00,0x2a,0xf4,0x0c,0x08,0x00,
-0x04,0x18,0x00,0x21,0xfa,0x88,0x28,0x00,0x05,0x8e,0x85,0x24,0x4b,0x00,0x72,0x0f,
-0x11,0x05,0xe8,0x01,0x81,0x1f,0x90,0x04,0xcc,0xcc,0xdf,0xb0,0x9f,0x7f,0x17,0x31,
-0x2f,0xb0,0x47,0x18,0x40,0x63,0x2f,0xb0,0x08,0xaa,0xaa,0x30,0x08,0x00,0xc0,0x32,
-0x88,0x88,0x9f,0xb0,0x07,0x77,0x77,0x45,0xff,0xff,0xff,0xf3,0x39,0x50,0x85,0xfb,
-0x33,0x6f,0xb0,0x4a,0x02,0x12,0xfa,0x27,0x01,0x11,0x45,0x08,0x00,0xf6,0x12,0xe7,
-0xaf,0x45,0xfa,0x00,0x01,0x72,0x0d,0xc0,0x6f,0x44,0xfb,0x00,0x05,0xf8,0x0d,0xff,
-0xff,0x42,0xff,0xee,0xef,0xf4,0x0d,0xe8,0x88,0x20,0x8d,0xee,0xed,0x80,0x00,0x06,
-0x43,0x34,0x01,0x0b,0x18,0xf1,0x24,0x1e,0xb0,0x00,0xff,0xcc,0xfa,0x00,0x4d,0xdf,
-0xdd,0xc1,0xfb,0x01,0xfa,0x00,0x3a,0xaa,0xaa,0xa6,0xf7,0x01,0xfa,0x00,0x05,0x99,
-0x99,0x8f,0xf1,0x00,0xff,0xc4,0x08,0xdd,0xdd,0x8e,0x40,0x00,0x6c,0xc4,0x04,0x77,
-0x77,0x5a,0x99,0x99,0x99,0x60,0x08,0xcc,0xcc,0x8f,0x5a,0x15,0x80,0x77,0x77,0x29,
-0xf5,0x01,0xbf,0x60,0x09,0x60,0x00,0xa1,0x38,0xfe,0x00,0x09,0xf0,0x6f,0x40,0x6f,
-0xef,0xf3,0x08,0x00,0x30,0x4f,0xff,0xd3,0xa5,0x46,0xd5,0xad,0xff,0xdf,0xff,0xd6,
-0x09,0xf8,0x88,0x8f,0x93,0x01,0x7c,0xf2,0xa8,0x01,0x15,0x75,0x3b,0x33,0x02,0x49,
-0x9b,0x80,0x8d,0x20,0x5c,0xcc,0xff,0xcc,0xb0,0xbf,0x9e,0x11,0x11,0xfe,0x92,0x3b,
-0x01,0xd8,0x6d,0x60,0x09,0x99,0x96,0x09,0x80,0xfe,0xcd,0x6e,0x40,0xe9,0x0e,0xd0,
-0xfe,0xe7,0x2a,0x31,0x32,0x0e,0xd0,0xc9,0x90,0x61,0xfc,0x0e,0xd0,0xff,0xbb,0x80,
-0x10,0x00,0x10,0xfe,0xd7,0x01,0x12,0xfc,0x08,0x00,0x22,0xc7,0xec,0x08,0x00,0x22,
-0x90,0xdc,0x08,0x00,0x11,0xeb,0xe4,0x1a,0x40,0xf4,0x0f,0xec,0xc9,0x6b,0x61,0x11,
-0xc3,0xf8,0x00,0x13,0x38,0xb3,0x36,0x20,0x9f,0x40,0x82,0xa4,0x90,0x08,0xaa,0xcf,
-0xda,0xa5,0x2e,0xef,0xee,0xdc,0xeb,0x0a,0x40,0x2a,0xaa,0xaa,0x90,0x46,0x50,0x70,
-0x04,0x77,0x77,0x10,0x3f,0xb0,0x69,0x0e,0x6c,0xa0,0x35,0xef,0x85,0xfc,0x00,0x03,
-0x66,0x66,0x18,0xff,0xa4,0xa7,0xf0,0x17,0xdd,0xdd,0x32,0x35,0xef,0x4a,0xb2,0x04,
-0x77,0x77,0x21,0x8f,0xe4,0x5f,0xc0,0x08,0xff,0xff,0x4d,0xfc,0x14,0xfe,0x20,0x08,
-0xf1,0x4f,0x44,0x50,0x6f,0xf5,0x00,0x08,0xf1,0x4f,0x40,0x1b,0xff,0xfe,0x0d,0x79,
-0xd5,0x7a,0xff,0xa1,0x7f,0xe1,0x08,0xf8,0x88,0xaf,0xa3,0x00,0x07,0xe4,0x6a,0x0f,
-0x10,0x03,0xf9,0x03,0x10,0x03,0x80,0x00,0x50,0x03,0xf9,0x00,0x1f,0xe1,0x78,0x02,
-0xf0,0x01,0xdf,0x20,0x8f,0x80,0x2b,0xbe,0xcb,0x83,0x9f,0x84,0xcf,0x41,0x3c,0xcc,
-0xcc,0xad,0xf8,0x02,0x90,0x04,0x77,0x77,0x16,0x77,0xdf,0x97,0x73,0x08,0x10,0x01,
-0x20,0xaf,0x30,0x80,0x00,0xf0,0x05,0x15,0xee,0xff,0xee,0xd0,0x07,0xdd,0xdd,0x34,
-0xaa,0xef,0xba,0x90,0x04,0x77,0x77,0x20,0x00,0xaf,0x30,0x60,0x01,0x90,0x6b,0xbb,
-0xef,0xcb,0xb7,0x09,0xf0,0x4f,0x6f,0xdc,0x0c,0x90,0x09,0xf0,0x4f,0x51,0x11,0xbf,
-0x41,0x10,0x09,0x37,0x3c,0x00,0x20,0x00,0x21,0xf8,0x88,0x28,0x00,0x05,0x70,0x02,
-0x13,0x43,0x21,0x18,0x02,0xf1,0x4b,0xf0,0x31,0xd0,0x00,0x6e,0x30,0x0b,0x9b,0xfd,
-0x9f,0xc0,0xaf,0xff,0xff,0x3e,0x85,0xf6,0x0f,0xb0,0x68,0x88,0x88,0x9f,0x3b,0xf2,
-0x1f,0xa0,0x0b,0xbb,0xb8,0x89,0x4f,0xb0,0x3f,0x90,0x0c,0xcc,0xc8,0x04,0xef,0x3a,
-0xdf,0x60,0x08,0x88,0x86,0x3f,0xe4,0x0c,0xea,0x00,0x0c,0xcc,0xc9,0x05,0x14,0xa0,
-0x00,0x00,0x07,0x77,0x76,0x35,0xab,0xf8,0x3a,0x78,0x01,0xf6,0x15,0x8d,0xeb,0x9f,
-0x4f,0x60,0x0f,0x80,0xcc,0xbb,0xeb,0x15,0x1b,0xe0,0x0f,0x80,0xcd,0xf7,0xeb,0x00,
-0xcd,0xf3,0x0f,0xff,0xfe,0xd2,0xee,0x89,0xf9,0x81,0x0f,0xc8,0x86,0x00,0x8f,0xff,
-0xf2,0x91,0xa6,0x14,0x07,0x62,0x11,0x21,0x90,0x0f,0xb8,0x08,0xe0,0x0c,0xd0,0x08,
-0x8e,0xf9,0x88,0x80,0x3e,0xef,0xee,0xd1,0x2e,0xe2,0x22,0xe2,0x58,0x10,0xa8,0xf2,
-0x0f,0x90,0x04,0x77,0x77,0x24,0xaf,0xc8,0xdf,0x10,0x08,0x3f,0x60,0xf0,0x0b,0x60,
-0xaf,0x10,0x03,0x66,0x66,0x6b,0xdf,0xdb,0xef,0xc5,0x07,0xdd,0xdd,0x89,0x99,0x99,
-0x99,0x94,0x04,0x77,0x77,0x36,0xbb,0xbb,0xbb,0x78,0x02,0xf2,0x01,0x78,0xfe,0xee,
-0xef,0x90,0x09,0xf0,0x3f,0x78,0xf2,0x00,0x4f,0x90,0x09,0xf0,0x2f,0x08,0x00,0xb1,
-0xfe,0xef,0x78,0xfb,0xaa,0xcf,0x90,0x09,0xfa,0xaa,0x48,0x98,0x05,0x01,0x23,0x6b,
-0x22,0x02,0x10,0x80,0x01,0x11,0x02,0x80,0x01,0x40,0xf8,0x00,0x6f,0x90,0x80,0x01,
-0xf3,0x01,0xef,0x10,0xcf,0x30,0x2b,0xbe,0xcb,0x81,0x9f,0x64,0xfd,0x20,0x3c,0xcc,
-0xcc,0x99,0xd8,0x02,0xf0,0x05,0x19,0xf9,0x77,0x7f,0xd0,0x08,0xff,0xff,0x39,0xf2,
-0x00,0x0f,0xd0,0x03,0x66,0x66,0x19,0xf8,0x66,0x6f,0x80,0x01,0x13,0x39,0x20,0x00,
-0x40,0x20,0x7f,0x7b,0xf2,0x68,0x01,0xfc,0x16,0x40,0x9f,0x4a,0xf1,0x00,0x09,0xf0,
-0x5f,0x40,0xdf,0x1a,0xf1,0x30,0x09,0xf0,0x5f,0x45,0xfc,0x0a,0xf1,0xe9,0x09,0xff,
-0xff,0x9f,0xf3,0x0a,0xfc,0xf8,0x09,0xf8,0x88,0x9f,0x50,0x04,0xef,0xe2,0x6a,0x11,
-0x21,0x00,0xba,0xa0,0x44,0x00,0x6c,0x04,0x71,0x5a,0xaa,0xfe,0xaa,0xa0,0x00,0x5e,
-0x1e,0x1f,0x00,0xe7,0x0f,0x91,0x21,0x13,0xfd,0x11,0x10,0x59,0x99,0x99,0x0e,0xbf,
-0x29,0x30,0xaa,0xa5,0x0a,0x1b,0x72,0x30,0x0e,0xff,0xf8,0xf2,0x11,0x51,0x81,0x05,
-0x66,0x63,0x8f,0xca,0xae,0xf0,0x01,0xee,0xe8,0x8f,0x39,0x37,0x86,0xf3,0x07,0x77,
-0x75,0x5a,0x6f,0x5c,0xe4,0xa2,0x0e,0x5e,0x2c,0xf7,0x14,0x4c,0xe0,0x00,0x0e,0xb0,
-0xeb,0x00,0xbf,0x1c,0xe0,0x50,0x0e,0xb0,0xeb,0x05,0xfc,0x0c,0xe0,0xf7,0x0e,0xff,
-0xfc,0x6f,0xf2,0x0c,0xfb,0xf5,0x0e,0xd8,0x87,0xcd,0x30,0x06,0xef,0xc0,0x96,0x42,
-0x02,0xf4,0x12,0x13,0xce,0x6f,0x5e,0xf0,0x1b,0x5f,0x70,0x00,0x2e,0xfe,0x20,0x00,
-0x3b,0xbf,0xba,0x03,0xef,0xbf,0xe2,0x00,0x3c,0xcc,0xcc,0x7f,0xf8,0x08,0xff,0x92,
-0x05,0x77,0x79,0xff,0xfe,0xee,0xff,0xf6,0x0a,0xff,0xf6,0xa5,0xbb,0xbb,0xb5,0x70,
-0x04,0x66,0x62,0xba,0x30,0xf0,0x0d,0x40,0x09,0xdd,0xd5,0x7f,0xef,0xef,0xef,0x90,
-0x06,0x77,0x74,0x7f,0x3f,0x3f,0x3f,0x90,0x0c,0xff,0xf8,0x7f,0xbf,0xbf,0xbf,0x90,
-0x0c,0xb0,0xf8,0xc8,0x00,0x01,0x08,0x00,0x04,0x18,0x00,0xc2,0x3f,0x3f,0x8f,0x80,
-0x0c,0xd8,0x84,0x7f,0x3e,0x2e,0xae,0x40,0x67,0x14,0x07,0x01,0x00,0x60,0xa7,0x00,
-0x0a,0xb0,0x2f,0x80,0xda,0xb8,0xf0,0x19,0x4b,0xf5,0x4f,0xbb,0x30,0x00,0x5d,0x12,
-0xff,0xff,0xaf,0xaf,0xa0,0x1f,0xff,0xf9,0xbb,0x8e,0x5f,0xaa,0xf1,0x08,0x88,0x84,
-0x9b,0x6f,0x0f,0xa3,0x50,0x06,0xaa,0xa7,0xef,0xef,0xcf,0xfc,0xc5,0x08,0xee,0xe9,
-0xe7,0x47,0xfe,0x32,0xe6,0x02,0x44,0x41,0x66,0x66,0x4d,0xd2,0x20,0x09,0xff,0xf3,
-0xef,0xdf,0x9b,0xe9,0xf1,0x03,0x55,0x51,0xeb,0x5f,0x99,0xff,0x90,0x09,0xff,0xf4,
-0xef,0xef,0x97,0xff,0x10,0x09,0xc3,0xf4,0xea,0x1f,0x95,0xf9,0x50,0x09,0xb1,0xf4,
-0xef,0xff,0xbe,0xfa,0xd7,0x09,0xff,0xf4,0xe9,0x0c,0xff,0xdf,0xf4,0x09,0xd7,0x72,
-0x42,0x09,0xc2,0x3e,0xc0,0x4b,0x3b,0xf0,0x03,0x19,0xf0,0x02,0xe6,0x00,0x00,0x1c,
-0xef,0xde,0xfc,0x79,0xfb,0x88,0x83,0x00,0xe9,0x01,0x20,0x58,0x2e,0x10,0x08,0x88,
-0xad,0xf4,0x14,0xf3,0x8f,0x20,0x4f,0xe9,0x95,0xbe,0x75,0xdf,0xf9,0x00,0x09,0xf5,
+0x04,0xef,0x30,0x00,0xf8,0x0a,0x53,0xbf,0xfe,0xbb,0xb1,0x2f,0xe8,0x00,0x31,0x00,
+0x00,0x19,0x95,0x04,0x30,0x00,0x18,0xff,0xb0,0x0c,0x31,0x00,0x3b,0xff,0xb7,0x0a,
+0xb2,0x00,0x2e,0xd7,0xfd,0x22,0x22,0x2b,0xf5,0x00,0x00,0x00,0x10,0x00,0x61,0x00,
+0x00,0xfe,0x33,0x33,0x3b,0x10,0x00,0x34,0x99,0x99,0x9d,0x18,0x00,0x10,0xe4,0x87,
+0x00,0xf0,0x1b,0xf0,0x2f,0xc0,0x00,0x00,0x04,0x55,0x5f,0xf0,0x2f,0xc2,0x9f,0x50,
+0x0b,0xff,0xff,0xf0,0x2f,0xff,0xfd,0x80,0x01,0x11,0x1f,0xf0,0x2f,0xe5,0x10,0x20,
+0x09,0xac,0xef,0xf0,0x1f,0xe4,0x48,0xf6,0x0b,0xa8,0x5f,0xf0,0x0a,0x89,0x00,0x71,
+0x06,0x69,0x96,0x66,0x67,0x74,0x00,0x89,0x0b,0x00,0x6c,0x03,0x67,0x1f,0xe1,0x11,
+0x11,0x17,0xf8,0x10,0x00,0x48,0xe5,0x55,0x55,0x59,0x08,0x00,0x51,0xfe,0xee,0xee,
+0xef,0xf8,0x24,0x0a,0x31,0x07,0xac,0xf7,0x08,0x00,0x36,0x06,0xfe,0xb1,0xf6,0x00,
+0x50,0x6e,0x50,0x00,0x3f,0xa0,0x28,0x0a,0xf0,0x3f,0x5b,0x60,0x3f,0xa0,0x4b,0x10,
+0x06,0xfa,0x2f,0xf1,0x3f,0xdc,0xff,0x70,0x3f,0xfb,0xaf,0xf9,0x3f,0xfd,0x71,0x00,
+0x0f,0xfe,0xdb,0xff,0x4f,0xb0,0x02,0x81,0x02,0x00,0x00,0x51,0x2f,0xd3,0x38,0xf5,
+0x0a,0xff,0xff,0xf1,0x0e,0xff,0xff,0xf1,0x0a,0xfa,0x9e,0xf1,0x18,0xb7,0x77,0x20,
+0x0a,0xfb,0xae,0xf1,0x2f,0xb0,0x07,0x00,0x0a,0xfe,0xef,0xf1,0x2f,0xb6,0xef,0xa0,
+0x0a,0xf2,0x0c,0xf1,0x2f,0xff,0xf9,0x20,0x28,0x00,0xf1,0x11,0x2f,0xe6,0x10,0x10,
+0x0a,0xf6,0x5d,0xf1,0x2f,0xb0,0x01,0xf6,0x0a,0xf2,0xbf,0xf1,0x1f,0xfc,0xce,0xf6,
+0x0a,0xf1,0xde,0x80,0x07,0xde,0xee,0xa0,0x00,0x00,0x4b,0x90,0xbf,0x06,0xa1,0xa0,
+0x00,0x00,0x9b,0xbb,0xef,0xdb,0xbb,0xba,0xdf,0xa8,0x0c,0xc3,0xdf,0x31,0x11,0x11,
+0x13,0xfe,0xdf,0x10,0x00,0x00,0x01,0xfe,0x12,0x00,0x44,0xcb,0xbb,0xbb,0xbc,0x12,
+0x00,0x00,0xf6,0x0c,0x03,0x18,0x00,0x00,0x12,0x00,0x14,0x02,0x06,0x00,0x02,0x12,
+0x00,0x00,0x1e,0x00,0x00,0xea,0x0c,0x12,0x59,0xdb,0x00,0x10,0x0d,0x98,0x06,0x12,
+0x03,0x18,0x03,0x31,0x00,0x3f,0xe9,0x30,0x0a,0x20,0x03,0xfc,0xca,0x0c,0x32,0xb0,
+0x00,0x3f,0x2f,0x0a,0x66,0x03,0xfe,0x77,0x77,0x77,0x9f,0x1e,0x00,0x04,0x2d,0x00,
+0xf1,0x0d,0xc0,0x1e,0xf4,0x00,0x5b,0x10,0x03,0xfc,0x00,0x6f,0xe3,0x8f,0xf8,0x00,
+0x3f,0xc0,0x00,0x9f,0xff,0xd4,0x00,0x05,0xfd,0x37,0xb5,0x8f,0xfd,0x61,0xe8,0x07,
+0xf0,0x03,0x4d,0xff,0xf7,0x0b,0xfd,0x95,0x20,0x00,0x04,0xac,0x00,0x11,0x00,0x00,
+0x00,0x00,0x00,0x00,0x42,0x00,0x00,0x04,0x00,0x01,0x00,0xf0,0x11,0x7f,0xb1,0x11,
+0x10,0x00,0x00,0x00,0x04,0xff,0xff,0xff,0xf6,0x00,0x00,0x00,0x5f,0xfa,0x99,0xbf,
+0xf2,0x00,0x00,0x08,0xff,0x70,0x02,0xef,0x40,0x00,0x00,0x8f,0xff,0x01,0x00,0xf0,
+0x01,0xfb,0x00,0x1d,0xef,0xbb,0xbf,0xfb,0xbc,0xfb,0x00,0x00,0xbf,0x10,0x0e,0xe0,
+0x01,0x08,0x00,0x40,0xba,0xaf,0xfa,0xab,0x08,0x00,0x02,0x20,0x00,0x60,0x00,0xbf,
+0x32,0x22,0x22,0x23,0x20,0x00,0x00,0x4d,0x00,0xf1,0x15,0x06,0x81,0x00,0xbf,0x20,
+0x00,0x00,0x00,0x0c,0xf2,0x00,0x8f,0xec,0xbb,0xbb,0xbb,0xdf,0xd0,0x00,0x09,0xef,
+0xff,0xff,0xff,0xeb,0x20,0x00,0x00,0xcf,0x20,0x06,0xf8,0x00,0x00,0x9f,0xff,0x01,
+0x00,0xf2,0x0b,0xf2,0x46,0x66,0xdf,0x86,0x6a,0xfb,0xab,0x60,0x00,0x00,0x56,0x00,
+0x02,0x62,0xbf,0x30,0x06,0x88,0x88,0x88,0x8b,0xfc,0x9e,0x70,0x0b,0x20,0x00,0xf4,
+0x3b,0xe0,0x0b,0xf2,0x44,0x44,0x44,0xf9,0x12,0x00,0x0b,0xf6,0xff,0xff,0xf5,0xfa,
+0x7f,0x60,0x0b,0xf6,0xf1,0xd8,0x10,0xfb,0xcf,0x10,0x0c,0xf6,0xff,0xff,0xf1,0xef,
+0xfb,0x00,0x0d,0xe6,0xf2,0x25,0xf1,0xbf,0xf3,0x00,0x0e,0xd6,0xff,0xff,0xf1,0x8f,
+0xb0,0x00,0x1f,0xa6,0xf3,0xe9,0x35,0xff,0xb0,0xc1,0x6f,0x56,0xff,0xee,0xff,0xc9,
+0xfe,0xf3,0x7d,0x00,0x00,0x00,0xbc,0x00,0xaf,0xb0,0x00,0x01,0x00,0x22,0x05,0xb4,
+0x08,0x00,0xf2,0x02,0x3f,0xf4,0x0f,0xff,0xff,0xff,0xb0,0x03,0xef,0x80,0x0c,0xcc,
+0xcc,0xcc,0x90,0x3f,0xfa,0x17,0x00,0x40,0x1e,0x90,0xdc,0x10,0x08,0x00,0x32,0x03,
+0x09,0xfc,0x11,0x00,0x30,0x5f,0xf3,0xbf,0xa8,0x00,0xf2,0x03,0x05,0xff,0xd0,0x8b,
+0xbb,0xbf,0xfb,0xb1,0x5f,0xff,0xd0,0x00,0x00,0x0f,0xf0,0x00,0x2e,0x9f,0x08,0x00,
+0x2f,0x00,0x1f,0x08,0x00,0x07,0x31,0x7f,0xff,0xd0,0x08,0x00,0xf0,0x4b,0x3e,0xeb,
+0x40,0x00,0x00,0x39,0x20,0x13,0x58,0x50,0x00,0x00,0x00,0xdf,0x6f,0xff,0xff,0xc3,
+0xff,0xf7,0x1c,0xf8,0x05,0x4d,0xc0,0x02,0xaa,0xa4,0x6f,0xa4,0x4f,0xff,0xff,0xf7,
+0x00,0x00,0x08,0x4f,0xda,0xae,0xea,0xa4,0x00,0x00,0x00,0xcf,0x59,0x9e,0xe9,0x95,
+0xaa,0xa8,0x07,0xfe,0x1f,0xae,0xea,0xf8,0xff,0xfc,0x4f,0xfe,0x1f,0xdf,0xfd,0xf2,
+0x2f,0xa0,0x7f,0xfe,0x1f,0x7d,0xd7,0xf1,0x2f,0xa0,0x06,0xce,0x1f,0xff,0xff,0xf1,
+0x2f,0xa0,0x00,0xce,0x04,0x4d,0xd4,0x40,0x08,0x00,0x40,0x0f,0xff,0xff,0xf0,0x08,
+0x00,0x31,0x03,0x3c,0xc4,0x10,0x00,0xf0,0x04,0x4d,0xdf,0xff,0xfc,0xdf,0x90,0x00,
+0xce,0x3a,0x98,0x64,0x36,0xfd,0x30,0x00,0x00,0x00,0x0f,0xe0,0xd0,0x00,0x82,0x99,
+0x99,0x9f,0xf9,0x99,0x99,0x40,0x05,0x58,0x01,0x83,0x70,0x00,0x11,0x11,0x1f,0xe1,
+0x11,0x11,0x89,0x01,0xf2,0x04,0xfd,0x00,0x00,0x47,0x77,0x7f,0xf7,0x77,0x76,0x00,
+0x08,0x88,0x88,0x8f,0xf8,0x88,0x88,0x80,0x0f,0x28,0x00,0xf4,0x2d,0xf0,0x00,0x00,
+0x5e,0xf8,0xfe,0x10,0x27,0x00,0x00,0x3b,0xff,0x60,0x9f,0x73,0xef,0x70,0x3c,0xff,
+0xfc,0x00,0x1f,0xff,0xf6,0x00,0x1e,0xc8,0xfc,0x00,0x06,0xff,0x50,0x00,0x00,0x04,
+0xfd,0x7b,0xf6,0x9f,0xf9,0x20,0x00,0x0b,0xff,0xff,0xc4,0x06,0xff,0xf4,0x00,0x08,
+0xfb,0x61,0x00,0x00,0x29,0xa0,0x00,0x01,0x10,0x72,0x01,0x20,0x28,0x60,0x5f,0x02,
+0x73,0x44,0x44,0x7f,0xf5,0x44,0x44,0x30,0x58,0x00,0x31,0xd0,0x03,0x33,0x01,0x00,
+0x31,0x20,0x00,0x0c,0xe7,0x01,0xf5,0x0a,0x00,0x00,0x0d,0xf5,0x55,0x55,0x6f,0xe0,
+0x00,0x0f,0xff,0xfe,0xee,0xee,0xef,0xff,0xf1,0x06,0x6e,0xf4,0x44,0x44,0x5f,0xf6,
+0x60,0x20,0x00,0xf5,0x21,0x06,0x8f,0xfc,0xef,0x97,0x88,0x00,0x00,0x17,0xef,0xa0,
+0x6f,0xb3,0xef,0x60,0x3b,0xff,0xff,0x10,0x0c,0xff,0xd3,0x00,0x0d,0xc6,0xcf,0x46,
+0x95,0xdf,0xe6,0x00,0x00,0x02,0xff,0xff,0xf6,0x1a,0xff,0xf3,0x00,0x00,0xdb,0x74,
+0x00,0x00,0x39,0x90,0x00,0x01,0x00,0x82,0xec,0x00,0x03,0xfb,0x00,0x00,0x07,0xb1,
+0x08,0x00,0xb0,0x0a,0xfc,0xec,0x7b,0xbc,0xfe,0xbb,0xb3,0x00,0x85,0xec,0xfa,0x00,
+0x41,0xf4,0x00,0x02,0xfc,0x18,0x00,0xc0,0x04,0xbf,0xfc,0x00,0x04,0xfb,0x00,0x00,
+0x2f,0xf9,0xfc,0x3f,0x71,0x00,0xd0,0x05,0x10,0x98,0x3e,0xd9,0x99,0x99,0x80,0x00,
+0x00,0x00,0x1f,0xe1,0x05,0x00,0x02,0xb8,0x00,0xf2,0x25,0xf6,0x07,0x77,0x8e,0xfc,
+0xff,0x77,0x9e,0x73,0x00,0x49,0xff,0x80,0x7f,0x97,0xff,0x50,0x1f,0xff,0xfd,0x00,
+0x0c,0xff,0xb1,0x00,0x04,0x42,0xfe,0xad,0xf3,0xaf,0xfa,0x51,0x00,0x0b,0xff,0xeb,
+0x70,0x04,0xcf,0xf4,0x00,0x04,0x52,0x00,0x00,0x00,0x01,0x40,0x00,0x00,0x11,0x87,
+0x00,0x20,0xe5,0xcd,0x8b,0x01,0xf2,0x0c,0xa0,0x05,0xf9,0xde,0x44,0x22,0xf8,0x0f,
+0xa0,0x0d,0xfe,0xff,0xee,0x72,0xf8,0x0f,0xa0,0x0c,0xc8,0xee,0x88,0x82,0xf8,0x0f,
+0xa0,0x08,0x88,0x08,0x00,0x50,0x06,0xff,0xff,0xff,0xa2,0x08,0x00,0xe0,0xf2,0xcd,
+0x5e,0xa0,0x44,0x3f,0xa0,0x05,0xc0,0xcd,0x7f,0xc0,0x0c,0xfe,0x48,0x00,0x53,0x0b,
+0xf4,0x00,0x10,0x00,0x40,0x01,0xf0,0x1d,0xf5,0x08,0x88,0x9e,0xff,0xef,0x98,0xaf,
+0x93,0x04,0x7b,0xff,0x91,0x4f,0xb7,0xff,0x50,0x0d,0xfd,0xfd,0x00,0x18,0xff,0xc1,
+0x00,0x01,0x11,0xfe,0xbe,0xc0,0x7f,0xfd,0x83,0x00,0x06,0xff,0xb8,0x30,0x01,0x9d,
+0xf1,0x00,0x00,0x40,0x7e,0x00,0x60,0x10,0x00,0x13,0x00,0x01,0x51,0x0a,0x00,0x41,
+0xce,0x00,0x09,0xfa,0xd8,0x02,0x20,0x40,0x1f,0xd0,0x00,0x80,0x1b,0xce,0xc5,0xcf,
+0xc9,0x99,0x99,0x94,0x0d,0x00,0xf0,0x00,0xcb,0xbb,0xbb,0x70,0x00,0x09,0xf2,0x8f,
+0xd6,0x66,0x8f,0xa0,0x00,0x3f,0x97,0x13,0x00,0xc1,0xa0,0x00,0xcf,0xaf,0x4f,0xc5,
+0x55,0x7f,0xa0,0x0c,0xff,0xf6,0x10,0x00,0xf4,0x21,0x5f,0xff,0xee,0x10,0xcf,0xc5,
+0x55,0x00,0x0b,0x9f,0x4c,0x2c,0xff,0xff,0xff,0x90,0x00,0x8f,0x15,0xff,0xfc,0x28,
+0xfd,0x00,0x00,0x8f,0x10,0x73,0x7f,0xff,0xc1,0x00,0x00,0x8f,0x14,0x9d,0xff,0xef,
+0xfe,0xb6,0x00,0x8f,0x13,0xea,0x51,0x02,0x8b,0xe2,0x86,0x01,0x12,0x0d,0xb8,0x00,
+0xf2,0x03,0xf1,0x08,0xaa,0xad,0xfb,0xaf,0xea,0xaa,0xa1,0x00,0x77,0x7c,0xf8,0x7f,
+0xe7,0x77,0x40,0x01,0x18,0x00,0xf4,0x02,0x90,0x01,0xfb,0x0a,0xf3,0x1f,0xc0,0x5f,
+0x90,0x01,0xfd,0x7c,0xf8,0x7f,0xd7,0x9f,0x90,0x18,0x00,0x84,0x00,0x11,0x15,0xfd,
+0x11,0x11,0x11,0x10,0x80,0x01,0xf0,0x1c,0x09,0x99,0xef,0xc9,0x99,0xff,0xb9,0x94,
+0x00,0x05,0xff,0x83,0x09,0xfb,0x00,0x00,0x00,0x07,0xbe,0xff,0xff,0xf5,0x00,0x00,
+0x03,0x46,0x8b,0xff,0xff,0xff,0xea,0x40,0x08,0xff,0xff,0xb6,0x10,0x5a,0xff,0x60,
+0x01,0x53,0x10,0xf6,0x02,0x02,0xb9,0x01,0x00,0x61,0x03,0x50,0x1f,0xea,0xaa,0xaa,
+0xad,0x08,0x00,0x57,0xd5,0x55,0x55,0x5a,0xf7,0x18,0x00,0x48,0xc1,0x11,0x11,0x18,
+0x10,0x00,0x5e,0xe9,0x99,0x99,0x9c,0xf7,0x18,0x00,0x60,0x08,0xaf,0xf8,0x9f,0xe8,
+0x84,0x30,0x05,0xf6,0x0d,0xb0,0x1f,0xd0,0x00,0x50,0x00,0x06,0xff,0x40,0x1f,0xd0,
+0x03,0xf9,0x1b,0xef,0xf8,0x00,0x0f,0xfd,0xce,0xf6,0x0a,0xfa,0x30,0x00,0x08,0xef,
+0xff,0x68,0x04,0x24,0x0f,0xc0,0x08,0x00,0x10,0x07,0xc8,0x00,0xf0,0x05,0x02,0x2f,
+0xc2,0x17,0xfc,0xaa,0xbf,0x90,0x1f,0xff,0xff,0xc7,0xf9,0x77,0x9f,0x90,0x07,0x7f,
+0xe7,0x67,0xe0,0x00,0x00,0x20,0x00,0x80,0xf5,0x11,0x4f,0x90,0x28,0x8f,0xe8,0x87,
+0x10,0x00,0xf1,0x05,0x5f,0xff,0xff,0xf7,0xf9,0x66,0x8f,0x90,0x02,0x5f,0xc2,0x27,
+0xfb,0x99,0xbf,0x90,0x00,0x6f,0xf7,0x07,0x28,0x00,0xf1,0x18,0xaf,0xdf,0x50,0x6f,
+0x7d,0xe0,0x00,0x00,0xed,0x1e,0xf0,0xaf,0x3d,0xe0,0x00,0x08,0xf8,0x05,0x53,0xfd,
+0x0d,0xe0,0x81,0x4f,0xd0,0x00,0x7f,0xf4,0x0c,0xfb,0xf7,0x0b,0x30,0x00,0xcd,0x40,
+0x06,0xff,0xe2,0xec,0x01,0x01,0xe8,0x04,0x03,0x88,0x00,0x30,0x6f,0xa0,0x09,0xe8,
+0x04,0xf1,0x05,0x00,0x0c,0xe1,0x09,0xf8,0x77,0x8f,0xb0,0x5e,0xef,0xfe,0x59,0xf7,
+0x55,0x7f,0xb0,0x5d,0xdd,0xef,0x59,0x18,0x00,0xa1,0x01,0xec,0x09,0xf2,0x00,0x2f,
+0xb0,0x00,0x0c,0xf4,0x28,0x00,0x31,0x01,0xbf,0xf6,0x28,0x00,0x40,0x4e,0xff,0xff,
+0x79,0x08,0x00,0x40,0x9f,0xcf,0xde,0xb9,0x18,0x00,0x60,0x36,0x1f,0xc3,0x10,0xaf,
+0x3b,0xd8,0x04,0xf5,0x0f,0xc0,0x00,0xdf,0x0b,0xf0,0x10,0x00,0x1f,0xc0,0x07,0xfa,
+0x0b,0xf0,0xd8,0x00,0x1f,0xc3,0xcf,0xd1,0x0b,0xfc,0xf8,0x00,0x1f,0xc1,0xd8,0x10,
+0x05,0xee,0xd2,0x00,0x01,0x22,0x6a,0x20,0x08,0x00,0x30,0xcf,0x21,0x00,0x48,0x04,
+0xf0,0x55,0x01,0xff,0xff,0xd0,0x8b,0xfb,0x8e,0xf0,0x08,0xf9,0x7f,0x90,0x09,0xf2,
+0x0c,0xe0,0x3f,0xf7,0xaf,0x94,0x2e,0xd0,0x0e,0xd0,0x6f,0xff,0xff,0xfc,0xee,0x27,
+0xff,0x90,0x08,0xf2,0xf2,0xea,0x99,0x2a,0xf6,0x00,0x07,0xfe,0xfe,0xfa,0x6f,0x4d,
+0xf0,0x00,0x07,0xfb,0xfb,0xfa,0xaf,0xff,0xff,0xf0,0x08,0xf1,0xf2,0xec,0xfd,0x9e,
+0xf9,0x90,0x09,0xfb,0xfc,0xfb,0x92,0x0d,0xf0,0x00,0x0a,0xfb,0xfb,0xfa,0xdf,0xff,
+0xff,0xf5,0x0d,0xb0,0xf2,0xea,0x9a,0xaf,0xfa,0xa4,0x2f,0x70,0xfa,0xf9,0x00,0x0d,
+0xf0,0x00,0x5e,0x10,0x6a,0xe4,0x08,0x00,0x07,0x01,0x00,0x22,0x29,0x80,0x08,0x00,
+0x40,0x1f,0xf3,0x00,0x00,0xd8,0x04,0x54,0x8d,0xfd,0x88,0x88,0x83,0x48,0x02,0x19,
+0x00,0x99,0x02,0xf6,0x02,0xf4,0x00,0x00,0x07,0x88,0x88,0x88,0x88,0x82,0x00,0x00,
+0x06,0x77,0x77,0x77,0x77,0x72,0x18,0x00,0x04,0x01,0x00,0x93,0x0a,0xaa,0xaa,0xaa,
+0xaa,0xa4,0x00,0x00,0x0f,0x10,0x02,0x50,0x0f,0xd0,0x00,0x00,0x07,0x08,0x00,0x03,
+0x30,0x02,0x04,0x18,0x00,0x13,0x01,0x30,0x00,0x20,0x2f,0x60,0xeb,0x06,0x42,0x00,
+0x00,0x0e,0xd0,0x08,0x00,0x20,0x09,0xc0,0x08,0x00,0x00,0x27,0x00,0x40,0xfa,0x00,
+0xcf,0x20,0x90,0x00,0x40,0x86,0x00,0xcf,0x20,0x98,0x05,0x90,0x70,0x00,0xcf,0x30,
+0x00,0x05,0xee,0xee,0xb9,0x68,0x06,0xc0,0x02,0x55,0x55,0x47,0xcc,0xff,0xdc,0xc1,
+0x05,0xdd,0xdd,0xa0,0x20,0x00,0x70,0x02,0x77,0x77,0x60,0x00,0xcf,0x20,0x9f,0x07,
+0x11,0xd0,0x08,0x00,0x2a,0xf4,0x0c,0x08,0x00,0x04,0x18,0x00,0x21,0xfa,0x88,0x28,
+0x00,0x01,0x01,0x00,0x53,0x23,0x00,0x00,0x00,0x4b,0x88,0x00,0x31,0x8f,0x80,0x05,
+0xe8,0x01,0xf0,0x04,0x1f,0x90,0x04,0xcc,0xcc,0xdf,0xb0,0x9f,0xff,0xff,0xf1,0x00,
+0x00,0x2f,0xb0,0x47,0x77,0x77,0x70,0x08,0x00,0x43,0x08,0xaa,0xaa,0x30,0x08,0x00,
+0x90,0x32,0x88,0x88,0x9f,0xb0,0x07,0x77,0x77,0x45,0x30,0x00,0x80,0x1f,0xff,0xff,
+0x85,0xfb,0x33,0x6f,0xb0,0x4a,0x02,0x12,0xfa,0x27,0x01,0x11,0x45,0x08,0x00,0xf4,
+0x12,0xe7,0xaf,0x45,0xfa,0x00,0x01,0x72,0x0d,0xc0,0x6f,0x44,0xfb,0x00,0x05,0xf8,
+0x0d,0xff,0xff,0x42,0xff,0xee,0xef,0xf4,0x0d,0xe8,0x88,0x20,0x8d,0xee,0xed,0x80,
+0x00,0x06,0x57,0x08,0x20,0x50,0x00,0xeb,0x00,0xf0,0x25,0x00,0x1e,0xb0,0x00,0xff,
+0xcc,0xfa,0x00,0x4d,0xdf,0xdd,0xc1,0xfb,0x01,0xfa,0x00,0x3a,0xaa,0xaa,0xa6,0xf7,
+0x01,0xfa,0x00,0x05,0x99,0x99,0x8f,0xf1,0x00,0xff,0xc4,0x08,0xdd,0xdd,0x8e,0x40,
+0x00,0x6c,0xc4,0x04,0x77,0x77,0x5a,0x99,0x99,0x99,0x60,0x08,0xcc,0xcc,0x8f,0x20,
+0x06,0x90,0x04,0x77,0x77,0x29,0xf5,0x01,0xbf,0x60,0x09,0x60,0x00,0xa1,0x38,0xfe,
+0x00,0x09,0xf0,0x6f,0x40,0x6f,0xef,0xf3,0x08,0x00,0xf5,0x05,0x4f,0xff,0xd3,0x00,
+0x09,0xff,0xff,0xad,0xff,0xdf,0xff,0xd6,0x09,0xf8,0x88,0x8f,0x93,0x01,0x7c,0xf2,
+0xa8,0x01,0x13,0x75,0x08,0x00,0x31,0xdd,0x00,0x5f,0x39,0x06,0xf0,0x04,0x8d,0x20,
+0x5c,0xcc,0xff,0xcc,0xb0,0xbf,0xff,0xff,0x30,0x00,0xfe,0x00,0x00,0x57,0x77,0x77,
+0x10,0x08,0x00,0xf1,0x11,0x09,0x99,0x96,0x09,0x80,0xfe,0x00,0x00,0x0d,0xee,0xe9,
+0x0e,0xd0,0xfe,0x00,0x00,0x03,0x33,0x32,0x0e,0xd0,0xff,0xff,0xb0,0x2f,0xff,0xfc,
+0x0e,0xd0,0xff,0xbb,0x80,0x10,0x00,0x10,0xfe,0xd7,0x01,0x12,0xfc,0x08,0x00,0x22,
+0xc7,0xec,0x08,0x00,0x22,0x90,0xdc,0x08,0x00,0x30,0xeb,0xfc,0xcf,0x21,0x02,0x81,
+0x0f,0xec,0xc9,0xac,0xcc,0xcc,0xcc,0xc3,0xf8,0x00,0x10,0x38,0x58,0x05,0xf4,0x60,
+0x60,0x00,0x00,0x9f,0x40,0x00,0x00,0x0d,0xa0,0x08,0xaa,0xcf,0xda,0xa5,0x2e,0xef,
+0xee,0xdc,0xff,0xff,0xff,0xf8,0x2a,0xaa,0xaa,0x90,0x0a,0xf4,0x00,0x00,0x04,0x77,
+0x77,0x10,0x3f,0xb0,0x69,0x10,0x08,0xff,0xff,0x35,0xef,0x85,0xfc,0x00,0x03,0x66,
+0x66,0x18,0xff,0xff,0xf2,0x00,0x07,0xdd,0xdd,0x32,0x35,0xef,0x4a,0xb2,0x04,0x77,
+0x77,0x21,0x8f,0xe4,0x5f,0xc0,0x08,0xff,0xff,0x4d,0xfc,0x14,0xfe,0x20,0x08,0xf1,
+0x4f,0x44,0x50,0x6f,0xf5,0x00,0x08,0xf1,0x4f,0x40,0x1b,0xff,0xfe,0x20,0x08,0xff,
+0xff,0x7a,0xff,0xa1,0x7f,0xe1,0x08,0xf8,0x88,0xaf,0xa3,0x00,0x07,0xe4,0x00,0x72,
+0x02,0x10,0x03,0xf9,0x03,0x10,0x03,0x80,0x00,0x50,0x03,0xf9,0x00,0x1f,0xe1,0x78,
+0x02,0xf0,0x01,0xdf,0x20,0x8f,0x80,0x2b,0xbe,0xcb,0x83,0x9f,0x84,0xcf,0x41,0x3c,
+0xcc,0xcc,0xad,0xf8,0x02,0x90,0x04,0x77,0x77,0x16,0x77,0xdf,0x97,0x73,0x08,0x10,
+0x01,0x20,0xaf,0x30,0x80,0x00,0xf0,0x05,0x15,0xee,0xff,0xee,0xd0,0x07,0xdd,0xdd,
+0x34,0xaa,0xef,0xba,0x90,0x04,0x77,0x77,0x20,0x00,0xaf,0x30,0x60,0x01,0xf1,0x0a,
+0x6b,0xbb,0xef,0xcb,0xb7,0x09,0xf0,0x4f,0x6f,0xff,0xff,0xff,0xfa,0x09,0xf0,0x4f,
+0x51,0x11,0xbf,0x41,0x10,0x09,0xff,0xff,0x50,0x20,0x00,0x21,0xf8,0x88,0x28,0x00,
+0x05,0x70,0x02,0x12,0x43,0x0b,0x00,0x21,0x01,0xfd,0x32,0x05,0xf0,0x31,0xd0,0x00,
+0x6e,0x30,0x0b,0x9b,0xfd,0x9f,0xc0,0xaf,0xff,0xff,0x3e,0x85,0xf6,0x0f,0xb0,0x68,
+0x88,0x88,0x9f,0x3b,0xf2,0x1f,0xa0,0x0b,0xbb,0xb8,0x89,0x4f,0xb0,0x3f,0x90,0x0c,
+0xcc,0xc8,0x04,0xef,0x3a,0xdf,0x60,0x08,0x88,0x86,0x3f,0xe4,0x0c,0xea,0x00,0x0c,
+0xcc,0xc9,0x05,0x14,0xa0,0x00,0x00,0x07,0x77,0x76,0x35,0xab,0xf8,0x3a,0x78,0x01,
+0xf3,0x14,0x8d,0xeb,0x9f,0x4f,0x60,0x0f,0x80,0xcc,0xbb,0xeb,0x15,0x1b,0xe0,0x0f,
+0x80,0xcd,0xf7,0xeb,0x00,0xcd,0xf3,0x0f,0xff,0xfe,0xd2,0xee,0x89,0xf9,0x81,0x0f,
+0xc8,0x86,0x00,0x8f,0xff,0xf7,0x01,0x10,0x11,0x08,0x06,0x03,0x70,0x08,0x31,0x4f,
+0x90,0x0f,0xb8,0x08,0xf0,0x0f,0x0c,0xd0,0x08,0x8e,0xf9,0x88,0x80,0x3e,0xef,0xee,
+0xd1,0x2e,0xe2,0x22,0x00,0x2b,0xbb,0xbb,0xa8,0xff,0xff,0xff,0x10,0x04,0x77,0x77,
+0x24,0xaf,0xc8,0xdf,0x80,0x01,0xf0,0x0d,0x50,0x5f,0x60,0xaf,0x10,0x03,0x66,0x66,
+0x6b,0xdf,0xdb,0xef,0xc5,0x07,0xdd,0xdd,0x89,0x99,0x99,0x99,0x94,0x04,0x77,0x77,
+0x36,0xbb,0xbb,0xbb,0x78,0x02,0xf2,0x01,0x78,0xfe,0xee,0xef,0x90,0x09,0xf0,0x3f,
+0x78,0xf2,0x00,0x4f,0x90,0x09,0xf0,0x2f,0x08,0x00,0xb0,0xfe,0xef,0x78,0xfb,0xaa,
+0xcf,0x90,0x09,0xfa,0xaa,0x48,0x98,0x05,0x00,0xf3,0x00,0x42,0x30,0x00,0x02,0x10,
+0x80,0x01,0x11,0x02,0x80,0x01,0x40,0xf8,0x00,0x6f,0x90,0x80,0x01,0xf3,0x01,0xef,
+0x10,0xcf,0x30,0x2b,0xbe,0xcb,0x81,0x9f,0x64,0xfd,0x20,0x3c,0xcc,0xcc,0x99,0xd8,
+0x02,0xf0,0x05,0x19,0xf9,0x77,0x7f,0xd0,0x08,0xff,0xff,0x39,0xf2,0x00,0x0f,0xd0,
+0x03,0x66,0x66,0x19,0xf8,0x66,0x6f,0x80,0x01,0x13,0x39,0x20,0x00,0x40,0x20,0x7f,
+0x7b,0xf2,0x68,0x01,0xf5,0x16,0x40,0x9f,0x4a,0xf1,0x00,0x09,0xf0,0x5f,0x40,0xdf,
+0x1a,0xf1,0x30,0x09,0xf0,0x5f,0x45,0xfc,0x0a,0xf1,0xe9,0x09,0xff,0xff,0x9f,0xf3,
+0x0a,0xfc,0xf8,0x09,0xf8,0x88,0x9f,0x50,0x04,0xef,0xe2,0x00,0x02,0x04,0x01,0x00,
+0x60,0xba,0x00,0x00,0x01,0xfc,0x00,0x6c,0x04,0xa0,0x5a,0xaa,0xfe,0xaa,0xa0,0x00,
+0x5e,0x30,0x7f,0xff,0x1b,0x0b,0xb0,0xff,0xff,0x21,0x13,0xfd,0x11,0x10,0x59,0x99,
+0x99,0x0e,0xb8,0x00,0x30,0x09,0xaa,0xa5,0xd2,0x04,0xc0,0x60,0x0e,0xff,0xf8,0x48,
+0x88,0x88,0x88,0x81,0x05,0x66,0x63,0x78,0x03,0xf4,0x2a,0xf3,0x0d,0xee,0xe8,0x8f,
+0x39,0x37,0x86,0xf3,0x07,0x77,0x75,0x5a,0x6f,0x5c,0xe4,0xa2,0x0e,0xff,0xfb,0x00,
+0x7f,0x4c,0xe0,0x00,0x0e,0xb0,0xeb,0x00,0xbf,0x1c,0xe0,0x50,0x0e,0xb0,0xeb,0x05,
+0xfc,0x0c,0xe0,0xf7,0x0e,0xff,0xfc,0x6f,0xf2,0x0c,0xfb,0xf5,0x0e,0xd8,0x87,0xcd,
+0x30,0x06,0xef,0xc0,0x80,0x00,0x00,0x03,0x01,0x21,0x00,0x30,0x68,0x08,0x30,0x00,
+0x03,0xfa,0x10,0x03,0xf0,0x3a,0x70,0x00,0x2e,0xfe,0x20,0x00,0x3b,0xbf,0xba,0x03,
+0xef,0xbf,0xe2,0x00,0x3c,0xcc,0xcc,0x7f,0xf8,0x08,0xff,0x92,0x05,0x77,0x79,0xff,
+0xfe,0xee,0xff,0xf6,0x0a,0xff,0xf6,0xa5,0xbb,0xbb,0xb5,0x70,0x04,0x66,0x62,0x38,
+0x88,0x88,0x88,0x40,0x09,0xdd,0xd5,0x7f,0xef,0xef,0xef,0x90,0x06,0x77,0x74,0x7f,
+0x3f,0x3f,0x3f,0x90,0x0c,0xff,0xf8,0x7f,0xbf,0xbf,0xbf,0x90,0x0c,0xb0,0xf8,0xc8,
+0x00,0x01,0x08,0x00,0x04,0x18,0x00,0xb0,0x3f,0x3f,0x8f,0x80,0x0c,0xd8,0x84,0x7f,
+0x3e,0x2e,0xae,0xe5,0x08,0x19,0x13,0x08,0x01,0xfc,0x69,0xa7,0x00,0x0a,0xb0,0x2f,
+0x80,0x00,0x00,0xbe,0x00,0x4b,0xf5,0x4f,0xbb,0x30,0x00,0x5d,0x12,0xff,0xff,0xaf,
+0xaf,0xa0,0x1f,0xff,0xf9,0xbb,0x8e,0x5f,0xaa,0xf1,0x08,0x88,0x84,0x9b,0x6f,0x0f,
+0xa3,0x50,0x06,0xaa,0xa7,0xef,0xef,0xcf,0xfc,0xc5,0x08,0xee,0xe9,0xee,0xee,0xef,
+0xfe,0xe6,0x02,0x44,0x41,0x66,0x66,0x4d,0xd2,0x20,0x09,0xff,0xf3,0xef,0xdf,0x9b,
+0xe9,0xf1,0x03,0x55,0x51,0xeb,0x5f,0x99,0xff,0x90,0x09,0xff,0xf4,0xef,0xef,0x97,
+0xff,0x10,0x09,0xc3,0xf4,0xea,0x1f,0x95,0xf9,0x50,0x09,0xb1,0xf4,0xef,0xff,0xbe,
+0xfa,0xd7,0x09,0xff,0xf4,0xe9,0x0c,0xff,0xdf,0xf4,0x09,0xd7,0x72,0x42,0x09,0xc2,
+0x3e,0xc0,0x00,0x01,0x00,0xf4,0x30,0x7f,0x19,0xf0,0x02,0xe6,0x00,0x00,0x1c,0xef,
+0xde,0xfc,0x79,0xfb,0x88,0x83,0x00,0xe9,0x01,0x20,0x3f,0xff,0xff,0xf7,0x08,0xff,
+0xff,0xff,0xef,0xf3,0x8f,0x20,0x4f,0xe9,0x95,0xbe,0x75,0xdf,0xf9,0x00,0x09,0xf5,
 0xc8,0xdc,0x04,0xbf,0xfb,0x50,0x02,0xfd,0xde,0xf8,0x6f,0xe7,0x8e,0xf8,0x03,0x63,
 0x27,0x8d,0xd7,0x32,0x23,0x81,0xf0,0x09,0x20,0x00,0x08,0xa0,0x06,0x25,0x84,0x00,
-0x08,0x00,0x10,0x0e,0x2d,0x20,0x13,0xe7,0x34,0x75,0x10,0xa7,0x86,0x47,0x43,0x44,
-0x44,0x45,0xfb,0x87,0x31,0x01,0x19,0x09,0x10,0xf3,0x83,0x08,0x14,0x03,0x4b,0x3f,
-0x60,0x34,0x4a,0xf7,0x4f,0xd4,0xbf,0xf4,0xa2,0x02,0x10,0x00,0x84,0xde,0x3a,0xf5,
-0x3f,0xd3,0x33,0x20,0x00,0x46,0x4e,0x82,0x49,0xff,0x81,0x1f,0xd1,0xaf,0xe0,0x1f,
-0xb9,0x1f,0x82,0x30,0x05,0x8f,0xd4,0x44,0x44,0x49,0xf7,0x97,0x33,0x13,0xcd,0x40,
-0x09,0x01,0x92,0x0f,0x46,0xd6,0x66,0x66,0x6a,0x18,0x09,0xb0,0x01,0x49,0xef,0xa0,
-0x04,0xff,0xc6,0x00,0x0b,0xff,0xb4,0x43,0x54,0x03,0xc3,0x82,0x13,0x03,0x99,0x4a,
-0x01,0x4c,0x21,0x11,0xd0,0x08,0x00,0x22,0xf8,0x7f,0x08,0x00,0x72,0xf0,0x0f,0xd0,
-0x00,0xdf,0x11,0x10,0x18,0x00,0xe9,0xff,0xf7,0x0a,0xf7,0x6f,0xd0,0x00,0xdf,0x99,
-0x94,0x0a,0xf2,0x1f,0xd0,0x30,0x00,0x92,0xf6,0x5f,0xd4,0xdd,0xff,0xdd,0xb0,0x0a,
-0xf1,0x9e,0x25,0xd0,0x0a,0xff,0xff,0xd4,0xf7,0x00,0x0f,0xd0,0x04,0xc9,0x7c,0x64,
-0xf7,0x38,0x03,0x30,0xfb,0x6f,0x84,0x08,0x00,0x40,0x0d,0xf2,0x0c,0xf7,0x20,0x00,
-0x8d,0x4d,0x50,0x03,0x75,0xfd,0xbb,0xbe,0xc0,0x3e,0x4c,0x62,0x35,0x55,0x5f,0xf6,
-0x55,0x54,0xc9,0x0e,0x00,0x18,0x01,0x65,0x37,0x77,0x7f,0xf8,0x77,0x75,0x20,0x00,
-0x12,0x0e,0xdd,0x49,0xf1,0x2f,0xe2,0x0e,0xee,0xef,0xff,0xef,0xfe,0xee,0xe2,0x00,
-0x10,0x0a,0xf4,0x0e,0xf1,0x11,0x00,0x00,0xbf,0x5a,0xf4,0x0e,0xf5,0xfb,0x00,0x02,
-0xfe,0x0c,0xf3,0x0e,0xf2,0xdf,0x40,0x0d,0xf6,0x1f,0xf0,0x0e,0xf1,0x4f,0xc0,0x4f,
-0xa0,0x9f,0xb0,0x0e,0xf1,0x0d,0xf3,0x03,0x05,0xff,0x30,0x0e,0xf1,0x05,0x50,0x00,
-0x5f,0xf8,0x0b,0xef,0xec,0x65,0x29,0x70,0x07,0x3d,0x32,0x25,0x07,0xf4,0x08,0x00,
-0x00,0x95,0xb9,0xf2,0x01,0x0c,0xff,0xff,0xfa,0x4a,0xaa,0xbf,0xa0,0x09,0xbd,0xfc,
-0xb7,0x00,0x00,0x2f,0xa0,0x20,0x00,0xf2,0x05,0x2f,0xa0,0x4e,0xef,0xff,0xee,0x5f,
-0xff,0xff,0xa0,0x3b,0xbc,0xfe,0xbb,0x5f,0xda,0xaa,0x70,0x02,0x21,0x90,0x72,0xf3,
-0x12,0x0c,0xf1,0xfd,0x66,0x4f,0x90,0x02,0xa2,0x0d,0xf1,0xff,0xfe,0x4f,0x90,0x03,
-0xf6,0x0e,0xf3,0xfc,0x54,0x3f,0xfb,0xbd,0xf3,0x0e,0xfb,0xfa,0x00,0x09,0xef,0xfe,
-0x90,0x1f,0xef,0x1f,0xc1,0x4f,0x7b,0xff,0xfd,0xdc,0xcc,0xcd,0xd8,0x9f,0x20,0x4a,
-0xdf,0xfe,0x23,0x05,0xe8,0x0e,0x15,0xf6,0x08,0x00,0x10,0xff,0xaf,0x2e,0xf0,0x00,
-0xff,0xff,0xfa,0x9b,0xfc,0x9d,0xf1,0x07,0xbd,0xfd,0xb7,0x09,0xf3,0x0c,0xf0,0x18,
-0x00,0xf1,0x07,0x2f,0xd1,0x1e,0xf0,0x1d,0xde,0xfe,0xdd,0xef,0x4a,0xff,0xb0,0x0c,
-0xcc,0xfe,0xcb,0x83,0x03,0x75,0x00,0x03,0x51,0x7e,0x30,0xf2,0x0c,0xc0,0x09,0xf2,
+0x08,0x00,0x90,0x0e,0xee,0xee,0xee,0xee,0xe7,0x00,0x00,0x2a,0x98,0x06,0xc3,0xa7,
+0x00,0x00,0x3f,0xb4,0x44,0x44,0x45,0xfb,0x00,0x00,0x3f,0x90,0x0d,0x30,0x00,0x07,
+0xf3,0x83,0x08,0x12,0x03,0x40,0x00,0xb3,0x10,0x00,0x34,0x4a,0xf7,0x4f,0xd4,0xbf,
+0x10,0x00,0xbf,0x10,0x00,0x83,0xde,0x3a,0xf5,0x3f,0xd3,0x33,0x20,0x00,0x98,0x09,
+0x82,0x01,0x49,0xff,0x81,0x1f,0xd1,0xaf,0xe0,0x20,0x07,0x80,0xfc,0x30,0x05,0x8f,
+0xd4,0x44,0x44,0x49,0x00,0x09,0x43,0xfc,0xcc,0xcc,0xcd,0x40,0x09,0x10,0xac,0x08,
+0x00,0x46,0xd6,0x66,0x66,0x6a,0x18,0x09,0xf2,0x01,0x01,0x49,0xef,0xa0,0x04,0xff,
+0xc6,0x00,0x0b,0xff,0xb4,0x00,0x00,0x06,0xdf,0xb0,0x6f,0x0a,0x12,0x03,0xfc,0x00,
+0x40,0xdf,0x00,0x00,0x0a,0x0c,0x04,0x00,0x08,0x00,0x22,0xf8,0x7f,0x08,0x00,0x72,
+0xf0,0x0f,0xd0,0x00,0xdf,0x11,0x10,0x18,0x00,0xe9,0xff,0xf7,0x0a,0xf7,0x6f,0xd0,
+0x00,0xdf,0x99,0x94,0x0a,0xf2,0x1f,0xd0,0x30,0x00,0xb0,0xf6,0x5f,0xd4,0xdd,0xff,
+0xdd,0xb0,0x0a,0xf1,0x0f,0xd4,0x18,0x03,0xd0,0x0a,0xff,0xff,0xd4,0xf7,0x00,0x0f,
+0xd0,0x04,0xc9,0x7c,0x64,0xf7,0x38,0x03,0x30,0xfb,0x6f,0x84,0x08,0x00,0x40,0x0d,
+0xf2,0x0c,0xf7,0x20,0x00,0x78,0x4d,0x50,0x03,0x75,0xfd,0xbb,0xbe,0x80,0x01,0x20,
+0x0f,0xf1,0x06,0x00,0x62,0x35,0x55,0x5f,0xf6,0x55,0x54,0xc9,0x0e,0x00,0x18,0x01,
+0x65,0x37,0x77,0x7f,0xf8,0x77,0x75,0x20,0x00,0x10,0x0e,0xf6,0x01,0xf0,0x32,0xee,
+0xee,0xe2,0x0e,0xee,0xef,0xff,0xef,0xfe,0xee,0xe2,0x00,0x10,0x0a,0xf4,0x0e,0xf1,
+0x11,0x00,0x00,0xbf,0x5a,0xf4,0x0e,0xf5,0xfb,0x00,0x02,0xfe,0x0c,0xf3,0x0e,0xf2,
+0xdf,0x40,0x0d,0xf6,0x1f,0xf0,0x0e,0xf1,0x4f,0xc0,0x4f,0xa0,0x9f,0xb0,0x0e,0xf1,
+0x0d,0xf3,0x03,0x05,0xff,0x30,0x0e,0xf1,0x05,0x50,0x00,0x5f,0xf8,0x0b,0xef,0xf0,
+0x20,0x08,0x47,0x70,0x07,0xfe,0x70,0x7e,0x00,0x25,0x07,0xf4,0x08,0x00,0xf2,0x05,
+0x7f,0xff,0xff,0xa0,0x0c,0xff,0xff,0xfa,0x4a,0xaa,0xbf,0xa0,0x09,0xbd,0xfc,0xb7,
+0x00,0x00,0x2f,0xa0,0x20,0x00,0xf2,0x2e,0x2f,0xa0,0x4e,0xef,0xff,0xee,0x5f,0xff,
+0xff,0xa0,0x3b,0xbc,0xfe,0xbb,0x5f,0xda,0xaa,0x70,0x02,0x21,0xfa,0x00,0x4f,0x90,
+0x00,0x00,0x0c,0xf1,0xfd,0x66,0x4f,0x90,0x02,0xa2,0x0d,0xf1,0xff,0xfe,0x4f,0x90,
+0x03,0xf6,0x0e,0xf3,0xfc,0x54,0x3f,0xfb,0xbd,0xf3,0x0e,0xfb,0xfa,0x00,0x09,0xef,
+0xfe,0x90,0x1f,0xff,0xfb,0xef,0x04,0xb0,0x7b,0xff,0xfd,0xdc,0xcc,0xcd,0xd8,0x9f,
+0x20,0x4a,0xdf,0x90,0x06,0x80,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,
+0x05,0xf6,0x00,0x01,0x00,0x00,0x08,0x00,0xf0,0x05,0xff,0xff,0xff,0xf2,0x0a,0xff,
+0xff,0xfa,0x9b,0xfc,0x9d,0xf1,0x07,0xbd,0xfd,0xb7,0x09,0xf3,0x0c,0xf0,0x18,0x00,
+0xf2,0x27,0x2f,0xd1,0x1e,0xf0,0x1d,0xde,0xfe,0xdd,0xef,0x4a,0xff,0xb0,0x0c,0xcc,
+0xfe,0xcb,0x83,0x03,0x75,0x00,0x03,0x51,0xf9,0x00,0x9f,0xff,0xff,0xc0,0x09,0xf2,
 0xfc,0x75,0x9f,0xa9,0x9f,0xc0,0x0a,0xf2,0xff,0xfb,0x9f,0x30,0x1f,0xc0,0x0b,0xf7,
-0xfa,0x21,0x9f,0x97,0x8f,0xc0,0x0c,0xfe,0x20,0x00,0x23,0x0e,0xff,0x77,0x7d,0x30,
-0x88,0xff,0xfe,0x80,0x00,0x31,0x4f,0x40,0x3a,0x80,0x00,0x03,0x72,0x17,0x00,0xfa,
-0x12,0x01,0xd0,0x08,0xc1,0x0e,0xd9,0x9f,0xb9,0xfe,0xdd,0xdd,0xd2,0x0e,0xa0,0x0f,
-0xb9,0xca,0x1d,0x46,0xb2,0x2f,0xb9,0xf4,0x20,0x00,0xf2,0x06,0x10,0x06,0x6d,0xf7,
-0x59,0xfc,0xbb,0xef,0x10,0x04,0x2a,0xf0,0x09,0xf3,0x00,0xaf,0x10,0x0f,0x9a,0xfd,
-0xa9,0x08,0x00,0x20,0xfc,0x99,0x20,0x00,0xc1,0x0f,0x9a,0xf0,0x09,0xfd,0xcc,0xcc,
-0x10,0x0f,0x9a,0xf4,0x69,0xd8,0x87,0x41,0xcd,0xff,0xf9,0xf4,0xe6,0x35,0x20,0xd8,
-0x39,0x81,0x02,0x41,0x5a,0x61,0x00,0x07,0x11,0x74,0x05,0x99,0x73,0x12,0xf1,0xcc,
-0x6b,0x02,0x08,0x00,0x00,0xa7,0x02,0x10,0xf8,0x08,0x00,0x40,0x09,0x9d,0xfa,0x95,
-0x08,0x00,0x41,0x04,0x5b,0xf6,0x52,0xfe,0x4e,0x00,0x33,0xb7,0xa1,0xcf,0xed,0xf6,
-0x0b,0xb7,0xe3,0xf5,0xfc,0x1f,0x84,0x10,0x00,0x01,0x08,0x00,0x22,0xa7,0xe3,0x18,
-0x00,0x00,0x20,0x00,0x70,0xef,0xfe,0xf6,0x02,0x3b,0xf4,0x31,0x18,0x00,0x40,0x2b,
-0xbe,0xfc,0xb8,0x08,0x00,0x00,0xca,0x98,0x40,0xfc,0x1f,0x94,0xf6,0xca,0xbd,0x00,
-0x48,0x0a,0x00,0x68,0x00,0x48,0xfe,0xaa,0xab,0xe6,0xd7,0x2f,0xb0,0x01,0xcb,0x00,
-0x00,0x14,0x5f,0xc4,0x40,0x00,0xdf,0x20,0xb1,0x14,0x90,0xe9,0xaa,0xde,0xaa,0xa2,
-0x15,0x6f,0xc5,0x5d,0x20,0x01,0xf0,0x09,0x0b,0xcf,0xeb,0x80,0x6c,0x41,0x7a,0x10,
-0x0f,0xdf,0xde,0xb0,0xef,0x30,0xcf,0x50,0x0f,0x8e,0x9d,0xb8,0xf9,0x00,0x2f,0xe1,
-0x67,0x31,0xd0,0xf7,0x20,0x7c,0xf5,0x0f,0x7e,0x8c,0xb2,0x8f,0xa3,0xfb,0x30,0x0f,
-0x97,0x21,0x70,0xfb,0xf4,0x00,0x05,0x6f,0xc5,0x40,0x0c,0x95,0x70,0x4a,0xaf,0xea,
-0x90,0x01,0xff,0xa0,0xc1,0x14,0x40,0xe0,0x3e,0xff,0xf9,0x4b,0x0e,0xc3,0x19,0xff,
-0x83,0xef,0xe5,0x00,0x0f,0xa0,0x0a,0xb3,0x00,0x18,0x2b,0x86,0x03,0x78,0x0a,0x00,
-0x87,0x05,0x30,0x2f,0x62,0x2f,0x20,0x01,0xf0,0x05,0x3f,0x4f,0x6c,0xdf,0xb6,0xff,
-0x78,0xf7,0x0f,0x8f,0x7f,0x7d,0x93,0xcf,0x45,0xe5,0x0d,0xbf,0xbf,0x1b,0x20,0x07,
-0xf0,0x0d,0x19,0x9f,0xba,0x34,0x77,0xdf,0x77,0x70,0x6f,0xff,0xff,0xd8,0xfa,0xef,
-0xad,0xf0,0x05,0xf4,0xf9,0x08,0xf1,0xbf,0x2a,0xf0,0x05,0xf3,0xf8,0x08,0x20,0x00,
-0xf1,0x0d,0x06,0xf2,0xf8,0x08,0xf4,0xcf,0x5b,0xf0,0x08,0xf1,0xf8,0x17,0xcc,0xff,
-0xcc,0xc0,0x0b,0xe6,0xff,0xd8,0x88,0xdf,0x88,0x85,0x0f,0xa4,0xfd,0x8f,0x24,0xa4,
-0x22,0x50,0x60,0x85,0x76,0x01,0x04,0x15,0x11,0x00,0xd6,0xbe,0x11,0x40,0x13,0x47,
-0x03,0xcf,0x2e,0x41,0xaf,0xc0,0x02,0xdf,0xae,0x8a,0x16,0x60,0x55,0x4b,0x13,0xf5,
-0xa3,0x07,0x10,0xfc,0x4f,0x36,0x00,0x29,0xb2,0x90,0x30,0x00,0x0f,0xff,0xa0,0x01,
-0xff,0x6f,0xa0,0x15,0x4c,0x40,0x09,0xf8,0x0e,0xf2,0x13,0x03,0xf0,0x0a,0x5f,0xf1,
-0x08,0xfd,0x10,0x00,0x2f,0xa7,0xff,0x50,0x01,0xef,0xe3,0x00,0x3f,0xa4,0xf5,0x00,
-0x00,0x2d,0xe0,0x05,0xef,0xf7,0x30,0x5a,0x06,0xd4,0x1f,0xe4,0x8f,0xfd,0xbb,0xbb,
-0xcc,0xe9,0x09,0x60,0x02,0x8d,0xef,0xe4,0x23,0x04,0xfb,0x01,0x12,0x82,0x16,0x2b,
-0x21,0x1f,0xf1,0xe6,0xb5,0x00,0xa0,0x09,0x00,0xb9,0x9d,0x40,0xcf,0x98,0x88,0xff,
-0xef,0x12,0x44,0xcf,0x21,0x11,0xdf,0x0c,0x1f,0xd0,0x00,0x2f,0xff,0xb0,0xcf,0x76,
-0x66,0x66,0x00,0x2a,0xbf,0xb0,0xcf,0x78,0x06,0x00,0x83,0x4c,0x01,0xd0,0x07,0x01,
-0x6b,0x4c,0x19,0x4f,0x08,0x00,0x01,0x18,0x00,0x30,0x6f,0xd2,0x68,0x28,0x00,0xc4,
-0x0b,0xfc,0xef,0xda,0xa9,0x9a,0xab,0xc9,0x0a,0xa0,0x06,0xcf,0x48,0x0c,0x12,0x01,
-0xf8,0x06,0x00,0x66,0x92,0x10,0x10,0xf3,0x12,0x20,0x7f,0x80,0xf4,0x17,0x10,0x6f,
-0x01,0x08,0x00,0x8b,0x2e,0x60,0xbf,0x56,0xce,0xec,0xcf,0xfc,0x63,0x70,0x11,0x8f,
-0x32,0x00,0x23,0x12,0x22,0x0f,0x5e,0xb2,0xff,0xf1,0x22,0x25,0xfc,0x22,0x22,0x00,
-0x5a,0xef,0x2f,0x6c,0x11,0x70,0x0b,0xf2,0x99,0x9d,0xff,0xb9,0x99,0x59,0x01,0x40,
-0x01,0xef,0xfe,0x40,0x2f,0x1f,0x40,0x03,0xdf,0x74,0xff,0x4a,0x0c,0xb0,0x1a,0xff,
-0x80,0x03,0xef,0x30,0x01,0xcf,0xfb,0x8b,0x30,0x3c,0xa0,0xc2,0xdf,0xbb,0xff,0xfd,
-0xdc,0xdd,0xef,0xf3,0x06,0xc0,0x03,0x9e,0x27,0x60,0x09,0x32,0x56,0x00,0x48,0x8a,
-0x01,0x42,0x0f,0x00,0x35,0xbb,0xa0,0x78,0xc7,0x8e,0xfc,0x10,0x02,0xdf,0x70,0x09,
-0xfe,0xa1,0x6d,0x70,0x18,0x02,0x99,0xcf,0xff,0xb9,0x70,0x80,0x37,0xf2,0x10,0xae,
-0xfa,0xaf,0xb0,0x7a,0xaa,0x23,0xfc,0x8e,0xf8,0x9f,0xb0,0xaf,0xff,0x23,0xfe,0xcf,
-0xfc,0xdf,0xb0,0x01,0xaf,0x23,0xfb,0x4d,0xf4,0x5f,0xb0,0x00,0xaf,0x23,0x5d,0x14,
-0xf1,0x12,0xaf,0x23,0xf9,0x0c,0xe0,0x2f,0xb0,0x00,0xaf,0x33,0xf8,0x0c,0xe7,0xff,
-0x90,0x08,0xff,0xc5,0x74,0x05,0x51,0x86,0x00,0x8f,0xc5,0xdf,0xda,0x98,0x99,0xab,
-0xd5,0x2e,0x10,0x08,0x01,0x15,0xf1,0x80,0x00,0x03,0x59,0x69,0x22,0x06,0xf3,0x08,
-0x00,0x32,0x0a,0xfe,0x2a,0xc0,0x06,0xa0,0xaf,0xb5,0x88,0x8e,0xf9,0x88,0x82,0x00,
-0x0a,0x11,0x57,0x59,0x13,0x60,0x9a,0x06,0xc2,0xc0,0x1b,0xbb,0x83,0xf8,0x0c,0xf1,
-0x0f,0xc0,0x1c,0xdf,0xb3,0x0b,0x20,0x80,0x1f,0xb1,0x77,0xef,0xff,0x97,0x60,0x00,
-0xba,0x3b,0x01,0x22,0x16,0xf0,0x13,0xb7,0xef,0x6c,0xf2,0xaf,0xd1,0x00,0x2f,0xc6,
-0xd4,0x0c,0xf1,0x06,0x80,0x03,0xef,0xfc,0x40,0x04,0x50,0x00,0x01,0x2f,0xfb,0xbf,
-0xfe,0xba,0xab,0xbd,0xf9,0x0c,0x80,0x03,0x8d,0x9b,0x16,0x15,0x01,0xab,0x53,0x11,
-0x0b,0xb8,0x00,0x60,0x0d,0xfb,0x1b,0xf5,0x55,0x55,0x5c,0x96,0x12,0x7b,0xc8,0x00,
-0x70,0x04,0x0b,0xf6,0xdb,0x55,0xec,0x40,0xbc,0x2a,0x80,0xde,0x13,0xf9,0x00,0x6f,
-0xff,0x2c,0xef,0x18,0x00,0xc2,0x4a,0xef,0x2d,0xd4,0x45,0xfd,0x44,0x30,0x00,0xaf,
-0x3f,0xca,0x13,0x47,0xa2,0x5f,0x92,0x45,0xfd,0x44,0x10,0x00,0xaf,0x9f,0xcf,0x29,
-0x76,0x91,0xef,0x35,0x56,0xfd,0x55,0x50,0x03,0xef,0xc9,0xab,0x43,0xf8,0x02,0x6f,
-0xe9,0xef,0xfc,0xcb,0xbc,0xde,0xe1,0x2e,0x30,0x06,0xbe,0xff,0xff,0xfe,0xc0,0x01,
-0xf8,0x08,0x11,0x00,0x75,0x2c,0x00,0x6b,0x06,0x10,0xf1,0x61,0x14,0x30,0x08,0xf6,
-0x66,0xe7,0x4e,0x61,0x4d,0x30,0x8f,0xee,0x59,0xf1,0xd6,0x21,0xf1,0x02,0xf4,0xf6,
-0x9f,0x10,0x00,0x36,0x66,0x03,0xbf,0x5f,0x9b,0xf6,0x10,0x08,0xff,0xf1,0xbf,0x2e,
-0x24,0xf0,0x00,0x36,0xdf,0x1b,0xf3,0x44,0x44,0x9f,0x30,0x00,0x0b,0xf1,0xbe,0x5f,
-0xff,0xa7,0x90,0x4a,0x52,0x1b,0xe5,0xe1,0xba,0x7f,0x11,0x00,0x20,0xae,0xa7,0x81,
-0xa1,0xf2,0x0c,0x1b,0xe5,0xe8,0x8b,0xcf,0x30,0x01,0xbf,0xf7,0xcd,0x00,0x00,0x7e,
-0xa0,0x00,0xcf,0xac,0xff,0xdc,0xbb,0xbc,0xcd,0xe2,0x06,0xc0,0x05,0xaf,0x7e,0x2d,
-0x07,0x39,0x8a,0x20,0x29,0x10,0xca,0xad,0x92,0x17,0x77,0x9f,0xc7,0x77,0x70,0x1c,
-0xfc,0x4f,0x5c,0x02,0x82,0xdd,0x20,0x2f,0x90,0x1e,0xd0,0x00,0x00,0xc4,0x20,0x10,
-0xa0,0xb0,0xc0,0xf0,0x0b,0x7e,0xc7,0x8f,0xa0,0x11,0x11,0x0c,0xe4,0x6e,0xb6,0x4f,
-0xa0,0x8f,0xff,0x1c,0xe8,0xcf,0xec,0x6f,0xa0,0x5a,0xef,0x1c,0xe1,0x5d,0xb5,0x9c,
-0x34,0x42,0x1c,0xe4,0xf8,0xaf,0x08,0x00,0xfd,0x16,0xfd,0xef,0x3f,0xa0,0x00,0xcf,
-0x1c,0xe3,0xc3,0x38,0xff,0x90,0x0a,0xff,0xcc,0x90,0x00,0x02,0xb9,0x10,0x7f,0xda,
-0xff,0xec,0xba,0xab,0xbc,0xd4,0x1d,0x20,0x28,0xce,0xff,0xff,0xfe,0xe0,0x01,0xd4,
-0xa7,0xf1,0x02,0x0f,0xff,0xf6,0xcf,0xff,0xc0,0x1d,0xfa,0x0f,0xa5,0xf6,0xcd,0x4c,
-0xc0,0x01,0xef,0x3f,0x10,0x00,0x81,0x00,0x33,0x0f,0xa3,0x78,0xce,0x34,0xb2,0x20,
-0x59,0xe1,0x8f,0xff,0xf2,0x25,0x55,0x00,0x2b,0xa0,0x1c,0x82,0x00,0x7f,0xff,0x2c,
-0xf0,0x11,0xb0,0x25,0xcf,0x25,0x6f,0xe6,0x8f,0xc6,0x40,0x00,0xaf,0x46,0x08,0x00,
-0x33,0x61,0x00,0xaf,0xe8,0x3a,0xf1,0x0a,0xaf,0x21,0x8f,0xc0,0x2f,0xe6,0x00,0x01,
-0xdf,0xdc,0xf8,0x10,0x01,0xae,0x50,0x5f,0xf9,0xbf,0xfc,0xa9,0x99,0xab,0xc4,0x2e,
-0x50,0x00,0x02,0x16,0xf1,0x88,0x01,0x14,0xa7,0x89,0x0c,0x00,0x62,0x02,0x90,0xc1,
-0x0a,0xcc,0xff,0xcc,0xa3,0xfd,0xbf,0xf4,0xcf,0x0f,0xf1,0x0c,0xc3,0xf6,0x0f,0xd0,
-0x00,0xcd,0x00,0xde,0x13,0xf6,0x5f,0x70,0x00,0x9f,0x43,0xfa,0x03,0xf6,0xaf,0x10,
-0x3a,0xcf,0xbd,0xfc,0xa5,0xf6,0xfc,0x59,0x1a,0x41,0xf6,0xf6,0x8f,0x50,0x44,0x02,
-0xa1,0xf6,0x0e,0xd0,0x05,0xaa,0xaa,0xaa,0x53,0xf6,0x0b,0x11,0xa2,0xf2,0x05,0x83,
-0xf6,0x09,0xf2,0x08,0xf4,0x00,0x5f,0x83,0xf9,0x8f,0xf0,0x08,0xf3,0x00,0x5f,0x83,
-0xf8,0xff,0x80,0x18,0x00,0x83,0x31,0x00,0x08,0xfb,0xaa,0xbe,0x83,0xf6,0xf9,0x61,
-0x00,0x90,0x0c,0x22,0x3f,0xec,0xc7,0x3c,0x22,0x3f,0xc5,0x97,0x3b,0x03,0x18,0x00,
-0x21,0x16,0x66,0x01,0x00,0x24,0x61,0x3e,0xe6,0x29,0x10,0x49,0xfe,0x3b,0x10,0x95,
-0xaf,0x30,0x40,0x6f,0xf6,0x69,0xf8,0x0a,0x81,0x30,0xef,0xfe,0xef,0x08,0x00,0x80,
-0xa8,0x8f,0xf8,0x8b,0xf8,0x00,0x00,0x58,0x88,0x15,0x15,0x85,0xe6,0x58,0x20,0x15,
-0x66,0x47,0x3c,0x33,0x66,0x51,0x3f,0xe6,0x2b,0x01,0xc7,0x6b,0x02,0xe8,0x24,0x11,
-0x0b,0x5a,0x1b,0xf1,0x14,0xdf,0xfb,0x17,0x99,0x99,0xbf,0x50,0x1d,0xf6,0x8f,0xe3,
-0x77,0x77,0xaf,0x50,0x7f,0xe8,0x8b,0x76,0xee,0xee,0xff,0x50,0x1b,0xff,0xfd,0x02,
-0x22,0x22,0x6f,0x70,0x00,0x0f,0x80,0x3f,0x6b,0x45,0xf0,0x2a,0xaf,0xda,0x6a,0x99,
-0xfe,0x99,0x92,0x1f,0xff,0xff,0x6a,0x70,0xec,0x08,0x90,0x05,0x1f,0x87,0x29,0xf6,
-0xee,0x9f,0x90,0x0d,0x6f,0x9f,0x30,0x8a,0xff,0xf5,0x00,0x0a,0xaf,0xbd,0x06,0xee,
-0xfe,0xfc,0x20,0x05,0x6f,0xee,0xef,0xb1,0xec,0x4f,0xf6,0x2f,0xff,0xc8,0x36,0x39,
-0xfc,0x02,0x90,0x06,0x30,0xa5,0x19,0x04,0x84,0x7f,0x10,0xf8,0x4d,0x5a,0x03,0x90,
-0x0a,0x11,0xfb,0xbd,0x2e,0x02,0x18,0x00,0x10,0xf1,0xe5,0x62,0x11,0x33,0x22,0x80,
-0x0b,0x10,0x00,0x04,0x82,0x23,0xf0,0x01,0x2b,0xbf,0xfb,0xbe,0xfd,0xbb,0xce,0xb2,
-0x00,0x0d,0xf0,0x04,0xfd,0x04,0xef,0x50,0xb4,0x11,0x30,0xaf,0xdf,0xe5,0xc4,0x31,
-0x41,0x25,0x4c,0xff,0x70,0xba,0x24,0xc2,0x60,0xaf,0xfe,0xa3,0x00,0x3f,0xfc,0x84,
-0x00,0x04,0xbf,0xd0,0xa7,0x18,0x10,0x01,0x13,0x2e,0x10,0x58,0xd3,0x65,0x64,0x65,
-0xaf,0x58,0xf8,0x56,0xfc,0x0e,0x00,0xf1,0x0c,0x54,0x9f,0x58,0xf7,0x45,0xfc,0xcf,
-0xcc,0xdf,0x58,0xfc,0xbc,0xfc,0xcf,0xba,0xaa,0x46,0xbb,0xbb,0xfc,0xcf,0x17,0x77,
-0x77,0x77,0x51,0xfc,0x81,0x78,0xf1,0x01,0xc1,0xfc,0xcf,0x10,0x8f,0x26,0xf5,0x01,
-0xfc,0xcf,0x29,0xcf,0xac,0xfb,0x91,0xfc,0x1e,0x77,0xf4,0x08,0xf2,0xfc,0xcf,0x10,
-0xcd,0x06,0xf4,0x01,0xfc,0xcf,0x18,0xf7,0x06,0xf5,0xef,0xfb,0xcf,0x19,0x90,0x06,
-0xf4,0xce,0xb2,0xf7,0x62,0xc5,0x65,0x9f,0x5b,0xf6,0x56,0xfd,0xcf,0xfe,0xff,0x5b,
-0xff,0xef,0x0e,0x00,0x12,0x76,0x07,0x00,0x04,0x1a,0x63,0x00,0x45,0x9c,0x11,0xfd,
-0x47,0x65,0x01,0xfe,0x62,0x27,0x22,0xfe,0x0e,0x00,0x27,0xfc,0x66,0x07,0x00,0x00,
-0x43,0x66,0x00,0x1a,0x63,0x30,0xb7,0x00,0x05,0x7f,0x6e,0x00,0x62,0xa2,0x10,0x00,
-0x9a,0xad,0x00,0x88,0xba,0xf0,0x13,0xee,0xbf,0xc0,0x06,0xfe,0xfa,0x00,0x0e,0xb2,
-0xf7,0x08,0xfd,0x1a,0xfc,0x20,0xeb,0x6f,0x6c,0xfd,0x10,0x0a,0xff,0x6e,0xba,0xd2,
-0xef,0xca,0xaa,0xae,0xe1,0xeb,0x9f,0x11,0xaf,0x68,0x09,0x21,0xb2,0xf7,0xd0,0x0d,
-0xa1,0xeb,0x0e,0xbb,0xbb,0xcf,0xfb,0xbb,0x4e,0xb0,0xec,0x5e,0x3a,0xf0,0x10,0xec,
+0xfa,0x21,0x9f,0x97,0x8f,0xc0,0x0c,0xfe,0x20,0x00,0x31,0x0e,0xff,0xfb,0x5f,0x00,
+0xf2,0x03,0x2f,0x88,0xff,0xfe,0xdc,0xcc,0xcd,0xd8,0x4f,0x40,0x3a,0xdf,0xff,0xff,
+0xff,0xf4,0x02,0x00,0x01,0x00,0x40,0x0e,0xff,0xff,0xb9,0x78,0x00,0xd0,0x0e,0xd9,
+0x9f,0xb9,0xfe,0xdd,0xdd,0xd2,0x0e,0xa0,0x0f,0xb9,0xf3,0x18,0x00,0x46,0xb2,0x2f,
+0xb9,0xf4,0x20,0x00,0xf2,0x06,0x10,0x06,0x6d,0xf7,0x59,0xfc,0xbb,0xef,0x10,0x04,
+0x2a,0xf0,0x09,0xf3,0x00,0xaf,0x10,0x0f,0x9a,0xfd,0xa9,0x08,0x00,0x20,0xfc,0x99,
+0x20,0x00,0xc0,0x0f,0x9a,0xf0,0x09,0xfd,0xcc,0xcc,0x10,0x0f,0x9a,0xf4,0x69,0x40,
+0x00,0x40,0x0f,0xcd,0xff,0xf9,0x40,0x00,0xf4,0x02,0x9f,0xff,0xd8,0x39,0xff,0xff,
+0xff,0xf7,0x5a,0x61,0x00,0x07,0xcc,0xcc,0xcc,0xc6,0x00,0x01,0x00,0x65,0x09,0xf1,
+0x00,0x00,0x2f,0x90,0x08,0x00,0x40,0x1f,0xff,0xff,0xf8,0x08,0x00,0x40,0x09,0x9d,
+0xfa,0x95,0x08,0x00,0xf1,0x08,0x04,0x5b,0xf6,0x52,0xff,0xff,0xff,0xf6,0x0b,0xff,
+0xff,0xf5,0xff,0xcf,0xed,0xf6,0x0b,0xb7,0xe3,0xf5,0xfc,0x1f,0x84,0x10,0x00,0x01,
+0x08,0x00,0x22,0xa7,0xe3,0x18,0x00,0x00,0x20,0x00,0x70,0xef,0xfe,0xf6,0x02,0x3b,
+0xf4,0x31,0x18,0x00,0x40,0x2b,0xbe,0xfc,0xb8,0x08,0x00,0xc0,0x3f,0xff,0xff,0xfb,
+0xfc,0x1f,0x94,0xf6,0x00,0x09,0xf2,0x00,0x48,0x00,0x00,0x68,0x00,0x45,0xfe,0xaa,
+0xab,0xe6,0x80,0x00,0xf0,0x0c,0x1f,0xa0,0x00,0x01,0xcb,0x00,0x00,0x14,0x5f,0xc4,
+0x40,0x00,0xdf,0x20,0x00,0x4f,0xff,0xff,0xe9,0xaa,0xde,0xaa,0xa2,0x15,0x6f,0xc5,
+0x5d,0x20,0x01,0xf5,0x49,0x0b,0xcf,0xeb,0x80,0x6c,0x41,0x7a,0x10,0x0f,0xdf,0xde,
+0xb0,0xef,0x30,0xcf,0x50,0x0f,0x8e,0x9d,0xb8,0xf9,0x00,0x2f,0xe1,0x0f,0xff,0xff,
+0xcf,0xf7,0x20,0x7c,0xf5,0x0f,0x7e,0x8c,0xb2,0x8f,0xa3,0xfb,0x30,0x0f,0xff,0xff,
+0xb0,0x0c,0xfb,0xf4,0x00,0x05,0x6f,0xc5,0x40,0x05,0xff,0xd0,0x00,0x4a,0xaf,0xea,
+0x90,0x01,0xff,0xa0,0x00,0x6f,0xff,0xff,0xe0,0x3e,0xff,0xf9,0x00,0x00,0x0f,0xa0,
+0x19,0xff,0x83,0xef,0xe5,0x00,0x0f,0xa0,0x0a,0xb3,0x00,0x18,0xc1,0x80,0x00,0x21,
+0x2f,0x60,0x07,0x00,0x40,0x02,0x2f,0x62,0x2f,0x20,0x01,0xf0,0x25,0x3f,0x4f,0x6c,
+0xdf,0xb6,0xff,0x78,0xf7,0x0f,0x8f,0x7f,0x7d,0x93,0xcf,0x45,0xe5,0x0d,0xbf,0xbf,
+0x1b,0xff,0xff,0xff,0xf0,0x19,0x9f,0xba,0x34,0x77,0xdf,0x77,0x70,0x6f,0xff,0xff,
+0xd8,0xfa,0xef,0xad,0xf0,0x05,0xf4,0xf9,0x08,0xf1,0xbf,0x2a,0xf0,0x05,0xf3,0xf8,
+0x08,0x20,0x00,0xf0,0x1a,0x06,0xf2,0xf8,0x08,0xf4,0xcf,0x5b,0xf0,0x08,0xf1,0xf8,
+0x17,0xcc,0xff,0xcc,0xc0,0x0b,0xe6,0xff,0xd8,0x88,0xdf,0x88,0x85,0x0f,0xa4,0xfd,
+0x8f,0xff,0xff,0xff,0xf9,0x6f,0x50,0x60,0x00,0x00,0xbf,0x10,0x00,0x0a,0x6d,0x00,
+0xf0,0x01,0xbf,0x00,0x00,0x00,0x70,0x00,0x00,0x40,0x00,0x00,0x00,0x07,0xfc,0x10,
+0x06,0xf8,0x14,0x00,0xd2,0xaf,0xc0,0x02,0xdf,0x50,0x00,0x00,0x00,0x0b,0x60,0x00,
+0x2f,0xe0,0x9b,0x00,0x22,0x0f,0xf5,0x08,0x00,0xf7,0x3e,0x4f,0xfc,0x00,0x00,0x0b,
+0xbb,0x70,0x00,0x9f,0xff,0x30,0x00,0x0f,0xff,0xa0,0x01,0xff,0x6f,0xa0,0x00,0x00,
+0x3f,0xa0,0x09,0xf8,0x0e,0xf2,0x00,0x00,0x2f,0xa0,0x5f,0xf1,0x08,0xfd,0x10,0x00,
+0x2f,0xa7,0xff,0x50,0x01,0xef,0xe3,0x00,0x3f,0xa4,0xf5,0x00,0x00,0x2d,0xe0,0x05,
+0xef,0xf7,0x30,0x00,0x00,0x00,0x30,0x1f,0xe4,0x8f,0xfd,0xbb,0xbb,0xcc,0xe9,0x09,
+0x60,0x02,0x8d,0xef,0xff,0xff,0xe5,0x00,0x01,0x00,0xf0,0x14,0x09,0x82,0x00,0x00,
+0x04,0xd3,0x00,0x00,0x1f,0xf1,0x00,0x00,0x05,0xff,0x30,0xcf,0xff,0xff,0xff,0x00,
+0x00,0x5f,0xa0,0xcf,0x98,0x88,0xff,0x00,0x00,0x04,0x00,0xcf,0x21,0x11,0xdf,0x27,
+0x00,0x01,0x18,0x00,0xf0,0x04,0x2f,0xff,0xb0,0xcf,0x76,0x66,0x66,0x00,0x2a,0xbf,
+0xb0,0xcf,0x88,0x88,0x88,0x40,0x00,0x1f,0xb0,0x18,0x00,0x10,0x90,0x08,0x00,0x39,
+0x10,0x00,0x4f,0x08,0x00,0x01,0x18,0x00,0x30,0x6f,0xd2,0x68,0x28,0x00,0xb0,0x0b,
+0xfc,0xef,0xda,0xa9,0x9a,0xab,0xc9,0x0a,0xa0,0x06,0x18,0x00,0x01,0x65,0x03,0x11,
+0x01,0x71,0x01,0x00,0x00,0x01,0xf1,0x11,0x05,0x10,0x00,0x0c,0xf2,0x00,0x7f,0x80,
+0x06,0xfb,0x00,0x00,0x6f,0xd0,0x00,0xef,0x10,0xdf,0x20,0x00,0x00,0xbf,0x56,0xce,
+0xec,0xcf,0xfc,0x50,0x00,0x02,0x40,0x8f,0x32,0x00,0xf0,0x06,0x12,0x22,0x00,0x00,
+0x3f,0xc0,0x00,0x00,0x08,0xff,0xf1,0x22,0x25,0xfc,0x22,0x22,0x00,0x5a,0xef,0x2f,
+0xff,0x74,0x01,0x80,0x00,0x0b,0xf2,0x99,0x9d,0xff,0xb9,0x99,0x59,0x01,0xf1,0x20,
+0x01,0xef,0xfe,0x40,0x00,0x00,0x0b,0xf1,0x03,0xdf,0x74,0xff,0x60,0x00,0x00,0xcf,
+0x1a,0xff,0x80,0x03,0xef,0x30,0x01,0xcf,0xfb,0x8b,0x30,0x00,0x02,0x51,0x00,0xdf,
+0xbb,0xff,0xfd,0xdc,0xdd,0xef,0xf3,0x06,0xc0,0x03,0x9e,0xff,0xff,0xff,0xfe,0x84,
+0x00,0x27,0x01,0x10,0x0c,0x01,0x20,0x60,0x01,0x54,0x00,0xf0,0x2d,0x40,0x2e,0xf9,
+0x00,0x78,0xc7,0x8e,0xfc,0x10,0x02,0xdf,0x70,0x09,0xfe,0xef,0x70,0x00,0x00,0x18,
+0x02,0x99,0xcf,0xff,0xb9,0x70,0x00,0x00,0x03,0xfd,0xae,0xfa,0xaf,0xb0,0x7a,0xaa,
+0x23,0xfc,0x8e,0xf8,0x9f,0xb0,0xaf,0xff,0x23,0xfe,0xcf,0xfc,0xdf,0xb0,0x01,0xaf,
+0x23,0xfb,0x4d,0xf4,0x5f,0xb0,0x00,0xaf,0x23,0x40,0x00,0x00,0x08,0x00,0xf1,0x10,
+0xf9,0x0c,0xe0,0x2f,0xb0,0x00,0xaf,0x33,0xf8,0x0c,0xe7,0xff,0x90,0x08,0xff,0xc5,
+0x74,0x05,0x51,0x86,0x00,0x8f,0xc5,0xdf,0xda,0x98,0x99,0xab,0xd5,0x2e,0x10,0x08,
+0x01,0x15,0xf1,0x80,0x00,0x92,0x10,0x00,0x00,0x0c,0xf1,0x00,0x00,0x06,0xf3,0x08,
+0x00,0x30,0x0a,0xfe,0x2a,0x48,0x00,0xf0,0x05,0xf5,0x00,0xaf,0xb5,0x88,0x8e,0xf9,
+0x88,0x82,0x00,0x0a,0x11,0x88,0x8e,0xf8,0x88,0x60,0x00,0x00,0x03,0x18,0x00,0xc1,
+0xc0,0x1b,0xbb,0x83,0xf8,0x0c,0xf1,0x0f,0xc0,0x1c,0xdf,0xb3,0x10,0x00,0xc0,0x00,
+0x1f,0xb1,0x77,0xef,0xff,0x97,0x60,0x00,0x1f,0xb0,0x0b,0xbb,0x03,0xf3,0x1a,0x00,
+0x1f,0xb7,0xef,0x6c,0xf2,0xaf,0xd1,0x00,0x2f,0xc6,0xd4,0x0c,0xf1,0x06,0x80,0x03,
+0xef,0xfc,0x40,0x04,0x50,0x00,0x01,0x2f,0xfb,0xbf,0xfe,0xba,0xab,0xbd,0xf9,0x0c,
+0x80,0x03,0x8d,0xff,0xff,0xff,0xe4,0x01,0xf8,0x00,0x31,0x04,0x50,0x0b,0xb8,0x00,
+0xb2,0x0d,0xfb,0x1b,0xf5,0x55,0x55,0x6f,0xb0,0x00,0xaf,0x7b,0xc8,0x00,0x60,0x04,
+0x0b,0xf6,0xdb,0x55,0xec,0x54,0x01,0x90,0xf0,0xde,0x13,0xf9,0x00,0x6f,0xff,0x2c,
+0xef,0x18,0x00,0xf0,0x0c,0x4a,0xef,0x2d,0xd4,0x45,0xfd,0x44,0x30,0x00,0xaf,0x3f,
+0xca,0xff,0xff,0xff,0x50,0x00,0xaf,0x5f,0x92,0x45,0xfd,0x44,0x10,0x00,0xaf,0x9f,
+0xd8,0x00,0xe0,0xe0,0x00,0xaf,0xef,0x35,0x56,0xfd,0x55,0x50,0x03,0xef,0xc9,0x00,
+0x01,0xd6,0x01,0xf4,0x01,0xe9,0xef,0xfc,0xcb,0xbc,0xde,0xe1,0x2e,0x30,0x06,0xbe,
+0xff,0xff,0xfe,0xc0,0x01,0x71,0x01,0x04,0xf9,0x04,0xf0,0x09,0x0a,0xf4,0x00,0x8f,
+0xff,0xff,0xf1,0x00,0x00,0x3f,0xf4,0x08,0xf6,0x66,0xcf,0x10,0x00,0x00,0x4d,0x30,
+0x8f,0xee,0x59,0xf1,0x1c,0x00,0xf2,0x20,0x08,0xf4,0xf6,0x9f,0x10,0x00,0x36,0x66,
+0x03,0xbf,0x5f,0x9b,0xf6,0x10,0x08,0xff,0xf1,0xbf,0xff,0xff,0xff,0xf3,0x00,0x36,
+0xdf,0x1b,0xf3,0x44,0x44,0x9f,0x30,0x00,0x0b,0xf1,0xbe,0x5f,0xff,0xa7,0xf3,0x00,
+0x00,0xbf,0x1b,0xe5,0xe1,0xba,0x7f,0x11,0x00,0x10,0xae,0x11,0x00,0xf1,0x11,0xcf,
+0x1b,0xe5,0xe8,0x8b,0xcf,0x30,0x01,0xbf,0xf7,0xcd,0x00,0x00,0x7e,0xa0,0x00,0xcf,
+0xac,0xff,0xdc,0xbb,0xbc,0xcd,0xe2,0x06,0xc0,0x05,0xaf,0xff,0xff,0xff,0xfd,0x00,
+0x02,0x13,0x11,0x83,0x00,0xf2,0x00,0x29,0x10,0x00,0x00,0x1c,0xb0,0x17,0x77,0x9f,
+0xc7,0x77,0x70,0x1c,0xfc,0x4f,0x5c,0x02,0xa0,0xdd,0x20,0x2f,0x90,0x1e,0xd0,0x00,
+0x00,0x10,0x0c,0x10,0x00,0xf2,0x18,0xa0,0x00,0x00,0x0c,0xf7,0x7e,0xc7,0x8f,0xa0,
+0x11,0x11,0x0c,0xe4,0x6e,0xb6,0x4f,0xa0,0x8f,0xff,0x1c,0xe8,0xcf,0xec,0x6f,0xa0,
+0x5a,0xef,0x1c,0xe1,0x5d,0xb5,0x1f,0xa0,0x00,0xbf,0x1c,0xe4,0xf8,0xaf,0x08,0x00,
+0xfa,0x17,0xfd,0xef,0x3f,0xa0,0x00,0xcf,0x1c,0xe3,0xc3,0x38,0xff,0x90,0x0a,0xff,
+0xcc,0x90,0x00,0x02,0xb9,0x10,0x7f,0xda,0xff,0xec,0xba,0xab,0xbc,0xd4,0x1d,0x20,
+0x28,0xce,0xff,0xff,0xfe,0xe0,0x01,0x00,0x01,0x00,0xf1,0x04,0x1c,0xa0,0x0f,0xff,
+0xf6,0xcf,0xff,0xc0,0x1d,0xfa,0x0f,0xa5,0xf6,0xcd,0x4c,0xc0,0x01,0xef,0x3f,0x10,
+0x00,0xf0,0x0d,0x00,0x33,0x0f,0xa3,0x78,0xce,0x34,0xb2,0x00,0x00,0x0b,0xff,0xfd,
+0x8f,0xff,0xf2,0x25,0x55,0x00,0x2b,0xa0,0x1c,0x82,0x00,0x7f,0xff,0x2c,0xff,0x68,
+0x03,0xb0,0x25,0xcf,0x25,0x6f,0xe6,0x8f,0xc6,0x40,0x00,0xaf,0x46,0x08,0x00,0x50,
+0x61,0x00,0xaf,0x7f,0xff,0x48,0x06,0xf1,0x0b,0x00,0xaf,0x21,0x8f,0xc0,0x2f,0xe6,
+0x00,0x01,0xdf,0xdc,0xf8,0x10,0x01,0xae,0x50,0x5f,0xf9,0xbf,0xfc,0xa9,0x99,0xab,
+0xc4,0x2e,0x50,0x00,0x02,0x16,0xf1,0x88,0x01,0x12,0xa7,0x08,0x00,0x20,0x01,0xfd,
+0x62,0x02,0xf0,0x1b,0xc1,0x0a,0xcc,0xff,0xcc,0xa3,0xfd,0xbf,0xf4,0x0d,0xff,0xff,
+0xff,0xc3,0xf6,0x0f,0xd0,0x00,0xcd,0x00,0xde,0x13,0xf6,0x5f,0x70,0x00,0x9f,0x43,
+0xfa,0x03,0xf6,0xaf,0x10,0x3a,0xcf,0xbd,0xfc,0xa5,0xf6,0xfc,0x00,0x4f,0x9b,0x03,
+0x31,0xf6,0x8f,0x50,0x44,0x02,0xb0,0xf6,0x0e,0xd0,0x05,0xaa,0xaa,0xaa,0x53,0xf6,
+0x0b,0xf0,0x0d,0x05,0xf2,0x05,0x83,0xf6,0x09,0xf2,0x08,0xf4,0x00,0x5f,0x83,0xf9,
+0x8f,0xf0,0x08,0xf3,0x00,0x5f,0x83,0xf8,0xff,0x80,0x18,0x00,0x70,0x31,0x00,0x08,
+0xfb,0xaa,0xbe,0x83,0x06,0x04,0x12,0x3f,0xa7,0x00,0x60,0x00,0x3f,0xec,0xcc,0xcc,
+0xcf,0x08,0x00,0x55,0xc5,0x55,0x55,0x5d,0xf2,0x18,0x00,0x21,0x16,0x66,0x01,0x00,
+0x31,0x61,0x3e,0xee,0x01,0x00,0xf0,0x08,0xe3,0x00,0x49,0x99,0x99,0x99,0x99,0x95,
+0x00,0x00,0x7f,0x96,0x6f,0xf6,0x69,0xf8,0x00,0x00,0x7f,0xfe,0xef,0xfe,0xef,0x08,
+0x00,0xf1,0x02,0xa8,0x8f,0xf8,0x8b,0xf8,0x00,0x00,0x58,0x88,0x8f,0xf8,0x88,0x85,
+0x00,0x00,0xdf,0xff,0xe0,0x01,0x80,0x15,0x66,0x66,0x6f,0xe6,0x66,0x66,0x51,0x4f,
+0x00,0x00,0x48,0x06,0x23,0x00,0x05,0xed,0x03,0x30,0x3f,0xc0,0x0b,0xb8,0x02,0xf0,
+0x15,0x01,0xdf,0xfb,0x17,0x99,0x99,0xbf,0x50,0x1d,0xf6,0x8f,0xe3,0x77,0x77,0xaf,
+0x50,0x7f,0xe8,0x8b,0x76,0xee,0xee,0xff,0x50,0x1b,0xff,0xfd,0x02,0x22,0x22,0x6f,
+0x70,0x00,0x0f,0x80,0x3f,0x38,0x00,0xf0,0x2e,0x0a,0xaf,0xda,0x6a,0x99,0xfe,0x99,
+0x92,0x1f,0xff,0xff,0x6a,0x70,0xec,0x08,0x90,0x05,0x1f,0x87,0x29,0xf6,0xee,0x9f,
+0x90,0x0d,0x6f,0x9f,0x30,0x8a,0xff,0xf5,0x00,0x0a,0xaf,0xbd,0x06,0xee,0xfe,0xfc,
+0x20,0x05,0x6f,0xee,0xef,0xb1,0xec,0x4f,0xf6,0x2f,0xff,0xc8,0x36,0x39,0xfc,0x02,
+0x90,0x06,0x30,0x00,0x00,0x1f,0x6e,0x05,0x00,0xf9,0x00,0x00,0x98,0x03,0x63,0x08,
+0xfb,0x88,0x88,0x88,0x84,0x08,0x00,0x12,0x80,0x18,0x00,0x00,0xf7,0x02,0x6d,0x08,
+0xf8,0x33,0x33,0x33,0x30,0x10,0x00,0x03,0xb8,0x00,0xf1,0x24,0xf3,0x2b,0xbf,0xfb,
+0xbe,0xfd,0xbb,0xce,0xb2,0x00,0x0d,0xf0,0x04,0xfd,0x04,0xef,0x50,0x00,0x0d,0xf0,
+0x00,0xaf,0xdf,0xe5,0x00,0x00,0x0e,0xf0,0x25,0x4c,0xff,0x70,0x00,0x00,0x7f,0xff,
+0xff,0x60,0xaf,0xfe,0xa3,0x00,0x3f,0xfc,0x84,0x00,0x04,0xbf,0xd0,0x00,0x04,0xcd,
+0x01,0xf4,0x00,0x20,0xcf,0xff,0xff,0x58,0xff,0xff,0xfc,0xcf,0x65,0xaf,0x58,0xf8,
+0x56,0xfc,0x0e,0x00,0xf0,0x23,0x54,0x9f,0x58,0xf7,0x45,0xfc,0xcf,0xcc,0xdf,0x58,
+0xfc,0xbc,0xfc,0xcf,0xba,0xaa,0x46,0xbb,0xbb,0xfc,0xcf,0x17,0x77,0x77,0x77,0x51,
+0xfc,0xcf,0x1f,0xff,0xff,0xff,0xc1,0xfc,0xcf,0x10,0x8f,0x26,0xf5,0x01,0xfc,0xcf,
+0x29,0xcf,0xac,0xfb,0x91,0xfc,0xcf,0x3f,0x8d,0x01,0xf5,0x1b,0xfc,0xcf,0x10,0xcd,
+0x06,0xf4,0x01,0xfc,0xcf,0x18,0xf7,0x06,0xf5,0xef,0xfb,0xcf,0x19,0x90,0x06,0xf4,
+0xce,0xb2,0xcf,0xff,0xff,0x5b,0xff,0xff,0xfd,0xcf,0x65,0x9f,0x5b,0xf6,0x56,0xfd,
+0xcf,0xfe,0xff,0x5b,0xff,0xef,0x0e,0x00,0x12,0x76,0x07,0x00,0x03,0x23,0x00,0xb0,
+0x10,0x22,0x22,0x22,0x01,0xfd,0xcf,0x11,0xff,0xff,0xfe,0x07,0x00,0x37,0xfb,0x22,
+0xfe,0x0e,0x00,0x28,0xfc,0x66,0x07,0x00,0xc1,0xff,0xff,0xff,0xef,0xfb,0xcf,0x10,
+0xb7,0x00,0x05,0xfe,0xb3,0x1f,0x04,0xf0,0x1d,0x60,0x00,0x0e,0xff,0xfa,0x00,0x08,
+0xfc,0x00,0x00,0xee,0xbf,0xc0,0x06,0xfe,0xfa,0x00,0x0e,0xb2,0xf7,0x08,0xfd,0x1a,
+0xfc,0x20,0xeb,0x6f,0x6c,0xfd,0x10,0x0a,0xff,0x6e,0xba,0xd2,0xef,0xca,0xaa,0xae,
+0xe1,0xeb,0x9f,0x11,0xaf,0x68,0x09,0xf0,0x03,0xb2,0xf7,0x00,0x01,0xfc,0x00,0x00,
+0xeb,0x0e,0xbb,0xbb,0xcf,0xfb,0xbb,0x4e,0xb0,0xec,0xef,0x4f,0x05,0xf7,0x15,0xec,
 0xef,0x90,0x52,0x1f,0xc1,0x70,0x0e,0xb9,0x91,0x5f,0xa1,0xfc,0x6f,0x90,0xeb,0x00,
-0x3f,0xe1,0x1f,0xc0,0xaf,0x5e,0xb0,0x05,0xe3,0x9c,0xfb,0x01,0xc4,0xeb,0x97,0x74,
-0x08,0x65,0xb0,0x32,0x86,0x02,0x83,0xc5,0x42,0x43,0x15,0xfb,0x11,0x11,0x26,0x25,
-0x00,0xfa,0x26,0x61,0xa5,0x58,0xfb,0x55,0x55,0x20,0x0f,0x00,0x00,0x61,0xa3,0x10,
-0xaf,0x10,0x00,0x13,0x53,0xda,0x5b,0x00,0xed,0x04,0x54,0x94,0x47,0xfa,0x44,0x43,
-0x1a,0x5f,0xa3,0xc0,0x00,0x37,0x66,0x6f,0xf6,0x66,0x66,0x50,0x3f,0xbc,0x19,0xf0,
-0x0b,0x17,0x77,0x9f,0xff,0xff,0xfa,0x77,0x71,0x00,0x4a,0xff,0x9f,0xf8,0xff,0xa4,
-0x00,0x6f,0xff,0xc3,0x0f,0xe0,0x2b,0xff,0xf4,0x0b,0x82,0x74,0x18,0x21,0x28,0x90,
-0xbd,0x4d,0xa1,0x52,0x01,0x00,0x04,0x46,0xfa,0x44,0x31,0xfa,0xdc,0x33,0x0c,0xf0,
-0x02,0xa6,0xf4,0x8f,0x20,0x05,0x95,0x47,0x79,0x2c,0xf9,0xaa,0x92,0x06,0xf7,0xee,
-0x9f,0x6f,0xb4,0x0a,0xf0,0x00,0xf8,0xee,0xbf,0xdf,0xf1,0xbe,0x10,0x06,0xf8,0x68,
-0xaf,0x9f,0xf6,0xdf,0x60,0x04,0x17,0x10,0x1b,0x35,0x03,0x61,0x11,0xcc,0x11,0x0b,
-0xf3,0xcf,0xf3,0x88,0x90,0x8b,0xf0,0xbe,0x00,0x0e,0xdb,0xf9,0x8f,0x8b,0xd2,0x1b,
-0xb1,0xac,0xbb,0x5f,0x8b,0xf8,0xdf,0x81,0x0e,0xcf,0xff,0xcf,0x18,0x00,0xf3,0x00,
-0xa2,0x04,0xbf,0x7b,0xff,0xff,0xf6,0x0e,0xa0,0x02,0xcb,0x2b,0xfa,0xaa,0xa4,0xa3,
-0x3d,0x12,0x10,0x7b,0x3f,0x14,0x66,0x34,0x17,0x30,0xf4,0x0f,0xc6,0x10,0x00,0xf6,
-0x0a,0x6a,0xf4,0x0f,0xaa,0xff,0x6f,0xd7,0xff,0xc7,0xf4,0x04,0x29,0x99,0x4f,0xd4,
-0x99,0x93,0x41,0x00,0x07,0x77,0x39,0x83,0x77,0x71,0x24,0x0c,0x67,0x8f,0x85,0x6f,
-0xd5,0x56,0xfb,0x10,0x00,0x45,0x84,0x5f,0xd4,0x46,0x10,0x00,0xa1,0x73,0x00,0x7d,
-0x52,0x2f,0xf9,0x99,0x9b,0xfa,0x00,0x2c,0x9f,0x01,0x9a,0x84,0x03,0x7c,0x77,0x03,
-0xcf,0x6a,0x11,0x66,0x28,0x01,0x00,0xea,0x05,0x20,0x6f,0xf6,0x69,0xb6,0x12,0x7f,
-0x34,0x03,0x00,0x1b,0x40,0x45,0xf5,0x55,0x55,0x50,0x07,0x2b,0x12,0x05,0xc6,0x4c,
-0x06,0xbf,0x68,0x5a,0xe4,0x44,0x44,0x4e,0xf1,0x10,0x00,0x18,0x4d,0x10,0x00,0x51,
-0xd0,0x00,0x18,0x8e,0xf0,0x08,0x00,0x21,0x0c,0xed,0x57,0x8c,0x03,0x13,0x5d,0x02,
-0x08,0x00,0x61,0x03,0x33,0x3e,0xf1,0x1f,0xf3,0xab,0x3d,0x20,0xf1,0x1f,0xf6,0x1c,
-0x30,0xaa,0xaf,0xf1,0xfd,0x7d,0x04,0x20,0x00,0x92,0x09,0xcc,0xcf,0xf1,0x1f,0xfc,
-0xcc,0x80,0x0c,0x20,0x00,0x1c,0xb0,0x40,0x00,0x12,0x5f,0x18,0x00,0x40,0xf5,0x4e,
-0xee,0xef,0x28,0x00,0x1c,0xc4,0x20,0x00,0x06,0x08,0x00,0x09,0xda,0x5b,0x14,0xf3,
-0x6a,0x5d,0x12,0x00,0xb8,0x6a,0x00,0xdc,0x13,0x55,0xdf,0xc9,0x99,0x99,0x40,0x08,
-0x8d,0xe0,0xf6,0x2f,0xb2,0x2e,0xd2,0x8f,0x70,0x08,0xf5,0x0f,0xd8,0x8f,0xd0,0x6f,
-0x08,0x00,0x22,0xff,0xff,0x08,0x00,0x2a,0xa0,0x0d,0x10,0x00,0x03,0x20,0x00,0x65,
-0x1f,0xa0,0x0e,0xd0,0x7f,0x70,0x40,0x00,0x20,0xfc,0xbb,0x44,0x1c,0x10,0x70,0x3b,
-0x3d,0xd2,0x05,0xe5,0x00,0x00,0x25,0x6f,0xd5,0x52,0xac,0xfc,0xaa,0x20,0x6f,0x87,
-0x46,0xd0,0x30,0x38,0x9f,0xd8,0x81,0x1b,0xf2,0x7f,0x40,0x07,0x8f,0xd7,0x6b,0x98,
-0x02,0x40,0x1f,0xfe,0xef,0xc4,0xbe,0x2e,0x30,0x1f,0xb5,0x5f,0xae,0x80,0x00,0x97,
-0x30,0x20,0xc0,0xfc,0x7f,0x30,0x61,0xa4,0x4e,0xc0,0xff,0xdd,0xef,0x10,0x00,0x80,
-0x66,0x6f,0xe6,0x40,0x02,0x3f,0xc2,0x27,0x18,0x02,0xf1,0x00,0x8e,0xef,0xfe,0xe4,
-0xcc,0x5f,0xe5,0x51,0x7c,0xcf,0xfc,0xc1,0xed,0x7f,0xe7,0x68,0x00,0x10,0xef,0x34,
-0x07,0x22,0x1f,0xb0,0xc0,0x15,0x07,0x2d,0x79,0x08,0x0a,0x61,0x14,0x04,0xd7,0x2d,
-0x70,0x9a,0xdd,0x99,0x99,0xde,0xb9,0x40,0x41,0x38,0x00,0xa3,0x87,0x95,0x17,0x77,
-0xef,0xa7,0x79,0xff,0x87,0x71,0x2f,0x5e,0x20,0x12,0x11,0xc8,0x6a,0x04,0x27,0x89,
-0x22,0x2f,0xe9,0x56,0x1f,0x76,0x2f,0xc4,0x44,0x44,0x4b,0xf5,0x00,0x18,0x00,0x12,
-0xc2,0x86,0x1f,0x05,0x20,0x00,0x05,0x57,0x89,0x02,0xab,0x16,0x30,0xa0,0x08,0xf7,
-0x50,0x00,0xf0,0x05,0x0d,0xa9,0xa8,0xf4,0x99,0xdf,0xc9,0x91,0x0d,0xaa,0xa8,0xf0,
-0x55,0xdf,0x75,0x40,0x0d,0xaa,0xa8,0xf1,0xf4,0x08,0x00,0x08,0x00,0x31,0xfa,0x00,
-0x1f,0x08,0x00,0x00,0xcc,0xbf,0xf2,0x13,0x0e,0xaa,0xa8,0xf1,0xfc,0x55,0x6f,0xb0,
-0x0e,0x9a,0xa8,0xf1,0xfd,0x99,0xaf,0xb0,0x0f,0x9a,0xa8,0xf1,0xfe,0xbb,0xbf,0xb0,
-0x0f,0x8a,0xa8,0xf1,0xfb,0x44,0x5f,0xb0,0x1f,0x7a,0x38,0x00,0xf0,0x06,0x5f,0x5a,
-0xa8,0xf0,0x2b,0x41,0x78,0x10,0x9f,0x20,0x08,0xf4,0xdf,0x91,0xdf,0x90,0x6d,0x00,
-0x07,0xde,0xf7,0x0f,0x54,0x02,0xa0,0x9a,0x15,0x20,0x95,0x2a,0x02,0x6b,0xc4,0xf0,
-0x0a,0xf2,0x08,0xf6,0x5b,0xf3,0x55,0xaf,0x75,0x50,0x08,0xff,0xff,0xf2,0x9e,0xff,
-0xee,0xa0,0x08,0xf5,0x3a,0xf2,0xaf,0x65,0x6f,0xb0,0x10,0x00,0xc0,0xaf,0xee,0xef,
-0xb0,0x01,0x22,0x22,0x20,0xaf,0x55,0x5f,0xb0,0xb9,0x44,0x00,0x10,0x00,0xf0,0x26,
-0x16,0x69,0xf9,0x66,0xaf,0x54,0x5f,0xb0,0x07,0xc4,0xf5,0x00,0xaf,0xdc,0xdf,0xb0,
-0x0a,0xe4,0xff,0xf9,0x5b,0xa9,0xac,0x60,0x0b,0xf8,0xf8,0x53,0x6f,0xc0,0xbf,0x60,
-0x0e,0xff,0xf4,0x07,0xfb,0x10,0x0a,0xf3,0x4f,0x7c,0xfd,0xa9,0xc8,0x88,0x88,0xa4,
-0x4e,0x10,0x6b,0xdf,0xff,0xe0,0x55,0x0c,0xfb,0x90,0x01,0xa7,0x04,0xf2,0x23,0x2e,
-0xa0,0x03,0xaa,0xab,0xaa,0xaa,0xfe,0xed,0x20,0x00,0x04,0xad,0x6d,0x60,0xcf,0xff,
-0x90,0x0b,0xff,0xfe,0xcf,0x70,0x8f,0x8a,0xc0,0x07,0xaf,0xc0,0x5f,0x70,0x2f,0xe2,
-0x73,0x00,0x0f,0xb0,0x5f,0x70,0x08,0xff,0xf9,0x1c,0xcf,0xfc,0xdf,0xec,0xcb,0x5b,
-0xc2,0x70,0x03,0x90,0x0b,0x80,0x00,0x3f,0xa0,0x5f,0x70,0xbf,0xdf,0xd3,0x3b,0xf0,
-0x00,0x5f,0x70,0x9f,0xff,0xa1,0x00,0xbf,0x40,0x5f,0x70,0x6f,0x87,0xb0,0x04,0xfd,
-0x94,0x32,0xf7,0x03,0xd0,0x42,0x2e,0xf5,0x00,0x5f,0x70,0x0b,0xfb,0xca,0x0b,0x80,
-0x00,0x5f,0x70,0x01,0xbf,0xf5,0xff,0x93,0x22,0x17,0x80,0xdf,0x4e,0x26,0x3f,0xf4,
-0x7f,0x87,0x22,0xf0,0x06,0xd4,0x07,0x12,0x60,0xe7,0x21,0x10,0xf2,0xe1,0x0c,0x30,
-0x55,0x55,0x5e,0x08,0x00,0x03,0xcb,0x44,0x12,0x06,0x1f,0x00,0x23,0x09,0xff,0xa2,
-0x34,0x10,0xfa,0xf4,0x07,0xf1,0x01,0xbf,0xa0,0x0a,0xf3,0x7c,0xcc,0xcc,0xc4,0x3f,
-0xa0,0x0a,0xf3,0x9f,0xba,0xac,0xf5,0x08,0x00,0x21,0x75,0x58,0x08,0x00,0x00,0x50,
-0x05,0xaa,0xaf,0x90,0x0a,0xf3,0x59,0x10,0x00,0x0c,0xdb,0x30,0xfe,0x00,0x21,0x49,
-0xdc,0x0b,0x5f,0x10,0xbf,0xd5,0x0c,0x01,0xf4,0x08,0x07,0xa0,0x6f,0x10,0xff,0x9d,
-0x8e,0x01,0x08,0x00,0x20,0xfa,0x51,0x1d,0x50,0x00,0x0a,0x83,0x01,0x08,0x00,0x1f,
-0x00,0x08,0x00,0x06,0x21,0x2b,0xee,0x08,0x00,0x00,0x60,0x08,0x01,0x0b,0x00,0x00,
-0xc9,0x7b,0x10,0xff,0x18,0x00,0x33,0xff,0xb2,0xdf,0xc4,0x59,0x22,0x2b,0xff,0x75,
-0x65,0x02,0x73,0x5c,0x80,0xf0,0x0d,0xff,0xff,0xc8,0x88,0x88,0x8c,0x18,0x6f,0x00,
-0xf0,0x07,0x24,0xf0,0x0f,0x08,0x00,0x01,0x98,0x41,0x10,0x08,0x18,0x00,0x64,0xec,
-0xcc,0xcc,0xce,0xf0,0x0f,0x08,0x00,0x06,0x18,0x00,0x0c,0x30,0x00,0x02,0x48,0x00,
-0x04,0x58,0x00,0x32,0xdf,0xff,0x73,0x38,0x2c,0x23,0xff,0xa5,0x4d,0x2e,0x02,0x08,
-0x00,0x04,0x18,0x00,0x06,0xd7,0x96,0x0f,0x28,0x00,0x39,0x23,0x0a,0xb1,0xc1,0x23,
-0x13,0xfc,0xa3,0x26,0x13,0xfb,0xdf,0x7b,0x30,0xc0,0x1b,0xa0,0x0f,0x00,0x11,0xfc,
-0x3f,0x63,0x10,0xbf,0x24,0x80,0x30,0xff,0xb0,0x0b,0xf5,0x23,0x10,0x0c,0xd6,0x6f,
-0x12,0xc0,0x42,0x0e,0x11,0xfb,0xbc,0x2a,0x04,0x4b,0x2b,0x02,0x25,0xbd,0x04,0x27,
-0xbd,0x10,0x03,0x04,0x00,0xf2,0x02,0x08,0xfc,0x10,0x00,0x1c,0xf8,0xff,0xfc,0x10,
-0x1c,0xff,0xf5,0xff,0xfc,0x2c,0xff,0xf5,0xad,0x57,0x11,0x05,0xd1,0x03,0x10,0x1d,
-0x3b,0x7d,0x21,0x1c,0xff,0x1e,0x00,0x40,0xf9,0xff,0xfc,0x1c,0x1e,0x00,0x20,0xfc,
-0xdf,0x1e,0x00,0x65,0xd1,0xa4,0x00,0x00,0x04,0xa1,0x77,0xa2,0x60,0x02,0x10,0x6f,
-0xf1,0x03,0x10,0xec,0x5e,0xc0,0x6f,0xf1,0x3f,0xd1,0x00,0x03,0xff,0xf1,0x6f,0xf1,
-0x5f,0xfd,0x55,0x93,0x70,0x6f,0xf1,0x09,0xff,0x70,0x4f,0xf7,0x9f,0x7c,0x70,0xcf,
-0xe0,0x9f,0xf0,0x00,0x6f,0xf1,0xab,0x20,0x10,0xc0,0x08,0x00,0x40,0x2f,0xf5,0xbf,
-0xc0,0x40,0x00,0x22,0x1f,0xf6,0x1b,0x8b,0x20,0x4f,0xf4,0x37,0xcd,0x00,0x7c,0xbe,
-0x31,0x0f,0xfe,0x10,0x07,0xac,0x10,0x06,0x71,0x64,0x11,0x7f,0x98,0x84,0x30,0xda,
-0xbe,0xff,0x05,0xad,0x00,0x18,0x01,0x01,0xe9,0x02,0x22,0xbd,0xca,0xe3,0x04,0x22,
-0x8b,0xb8,0xd3,0x00,0x02,0x34,0xa4,0xa0,0x30,0x06,0xff,0xff,0x60,0x03,0x00,0x04,
-0xfd,0xdf,0x9a,0x2d,0x14,0x40,0x04,0x61,0x00,0x71,0xc8,0x50,0x9f,0xff,0xff,0xf4,
-0x08,0xd8,0x6b,0x00,0xef,0x01,0x02,0x80,0xc8,0x14,0x00,0x08,0x00,0x04,0x18,0x00,
-0x04,0x28,0x00,0x04,0x38,0x00,0x30,0x04,0xfe,0xdf,0x6c,0x7a,0x14,0x40,0x58,0x00,
-0x05,0x68,0x00,0x06,0x78,0x00,0x31,0x03,0xdd,0x30,0xf4,0x8d,0x00,0x94,0x2a,0x21,
-0x4f,0xf4,0xda,0x7c,0x41,0x99,0xff,0xbf,0xf4,0x7b,0x56,0x31,0x22,0x6f,0xff,0x20,
-0xb3,0x50,0x35,0xff,0x53,0xef,0xf4,0x89,0x38,0x80,0x8f,0xff,0xf8,0x1c,0xfe,0x40,
-0x7f,0xfa,0xc5,0x81,0x60,0xa1,0xaf,0xf7,0xcf,0x82,0xdf,0xd0,0x00,0x42,0x28,0xfc,
-0x14,0x0e,0x46,0x22,0x13,0x41,0x04,0x08,0x10,0xf0,0x4c,0x07,0x32,0xf9,0x00,0x8f,
-0x09,0x00,0x1b,0xf8,0x09,0x00,0x62,0x0e,0xff,0xf6,0x00,0x6f,0xff,0x5c,0x64,0x18,
-0xfd,0xfe,0x00,0x0f,0x08,0x00,0x0d,0x04,0xbe,0x26,0x02,0x7b,0x0e,0x02,0x49,0x4a,
-0x02,0x37,0xbf,0x09,0x21,0x02,0x61,0xdf,0xff,0xfc,0x1b,0xb1,0xcf,0x3c,0x50,0x3b,
-0xc2,0x2c,0xff,0x01,0x00,0x53,0xf0,0xe0,0xff,0xdf,0xff,0x41,0x5d,0x20,0x04,0xef,
-0xd4,0x0f,0x11,0x40,0xa4,0xd0,0x01,0x3b,0x66,0x02,0xc1,0x22,0x22,0x0b,0xfa,0x41,
-0x9a,0x00,0x4f,0x9e,0x22,0x1e,0xf6,0xde,0x1d,0x13,0xe1,0xdb,0x22,0x21,0x0b,0xfa,
-0xd6,0x21,0x03,0x33,0x07,0x00,0x48,0x21,0x0f,0x01,0x00,0x0a,0x23,0x8f,0xff,0xa3,
-0x53,0x00,0xf0,0xab,0x40,0xda,0x50,0x02,0xff,0x21,0xbf,0xc0,0xff,0xfe,0x42,0xff,
-0x00,0x7f,0xff,0xa7,0x7b,0xff,0xf9,0xff,0x47,0x3e,0x00,0xe1,0x3d,0x20,0x0e,0xfc,
-0xf8,0x04,0x42,0xdf,0xff,0x5f,0xf2,0x87,0x08,0x22,0x8f,0xb0,0x08,0x00,0x0c,0xe7,
-0x16,0x02,0x5d,0x01,0x21,0x0b,0xf8,0x08,0x00,0x00,0x9f,0xcc,0x20,0xfd,0x22,0xec,
-0x23,0x40,0xe0,0xff,0xff,0xc2,0x48,0x00,0x60,0x40,0xff,0x9f,0xff,0xb7,0x6a,0xc2,
-0x54,0x30,0x24,0xdf,0xff,0x8a,0xbf,0x56,0xff,0x20,0x05,0xac,0xdb,0x71,0x4f,0x10,
-0x8d,0x29,0x04,0x00,0x61,0x09,0x1e,0xdf,0xad,0x00,0x01,0x14,0x00,0x02,0x57,0x02,
-0x22,0x09,0xff,0x2c,0x00,0x07,0x01,0x00,0x12,0x8d,0x9a,0x06,0x02,0x92,0x49,0x02,
-0x12,0x05,0x20,0x01,0x50,0x36,0x00,0x21,0x06,0xf7,0x1c,0x05,0x11,0xbe,0x06,0x00,
-0x01,0xd8,0x27,0x11,0x05,0xe9,0x7b,0x22,0x02,0x60,0x4c,0x00,0x03,0x4e,0x00,0x00,
-0x91,0x42,0x0a,0xda,0x86,0x14,0x10,0xca,0x13,0x13,0xd2,0x60,0x00,0x31,0x03,0xee,
-0x10,0x63,0x00,0x41,0x0a,0xb1,0x2f,0xb0,0x66,0x00,0x41,0x05,0xfc,0x07,0xf4,0x4b,
-0x00,0x42,0x50,0x5f,0x60,0xf9,0x6c,0x00,0x32,0x0d,0xc0,0xbd,0x69,0x00,0x33,0x09,
-0xf0,0x9f,0x09,0x00,0x24,0xe0,0x8f,0x1b,0x00,0x14,0xad,0x2d,0x00,0x11,0xe9,0x7b,
-0x00,0x20,0x05,0xfc,0x73,0xd1,0x14,0x09,0x51,0x00,0x00,0x63,0x00,0x38,0x02,0xee,
-0x10,0x75,0x00,0x02,0x87,0x00,0x13,0x8f,0xa4,0x01,0x33,0xff,0xfc,0xff,0x85,0xb2,
-0x12,0x2f,0x57,0x9c,0x00,0x79,0x04,0x12,0xee,0x10,0x00,0x40,0xfe,0x12,0xef,0xff,
-0x20,0x00,0x10,0xe1,0x8d,0x58,0x40,0xfe,0x4e,0xfe,0x10,0x09,0x23,0x31,0xe1,0x02,
-0xc1,0x93,0x01,0x1b,0x10,0xac,0x02,0x09,0xfd,0x01,0x00,0xfc,0x01,0x11,0x4e,0xed,
-0xaa,0x11,0xfb,0x53,0x02,0x11,0xf1,0x56,0x15,0x11,0x90,0x76,0x08,0x10,0x30,0x62,
-0x00,0x02,0x79,0x9c,0x22,0xf8,0x02,0x5b,0xb3,0x00,0x06,0x00,0x12,0x9e,0x7c,0x94,
-0x10,0x2f,0x06,0x00,0x00,0xd9,0x32,0xd2,0xfe,0x9f,0xa1,0xbf,0xff,0xff,0x92,0xff,
-0xa2,0x2f,0xff,0xf2,0x04,0x4e,0x23,0x44,0x9e,0xfe,0x92,0x00,0xf1,0x9c,0x40,0x01,
-0xcc,0xff,0x40,0x33,0x59,0x20,0x40,0x03,0x18,0x3c,0x00,0x36,0x0c,0x20,0x44,0xff,
-0x86,0x49,0x0a,0xde,0x01,0x01,0x34,0x36,0x00,0x74,0x1e,0x01,0x9c,0x34,0x03,0x2d,
-0x00,0x00,0x37,0x00,0x11,0x30,0x88,0xbe,0x07,0xf4,0xae,0x13,0x91,0xc7,0x00,0x12,
-0x70,0x07,0x00,0x01,0xe2,0x0c,0x00,0x12,0x08,0x03,0x28,0x93,0x13,0xf7,0xe3,0x00,
-0x13,0xd5,0xea,0x00,0x13,0xb2,0x4f,0x03,0x09,0x07,0x00,0x17,0xb2,0x23,0x00,0x12,
-0xf7,0x3f,0x00,0x17,0x20,0x4d,0x00,0x11,0x70,0x4e,0x92,0x2e,0xa1,0x00,0x01,0x00,
-0x11,0x8f,0x26,0x04,0x00,0xe0,0x02,0x04,0xca,0x4b,0x0f,0x07,0x00,0x36,0x83,0x7f,
-0xff,0xf7,0x00,0x7f,0xff,0xf7,0x8f,0xee,0x01,0x0f,0x01,0x00,0x40,0x14,0x8f,0xf1,
-0x01,0x00,0x44,0x5b,0x30,0x10,0x00,0x03,0xb5,0x0c,0x10,0x04,0xef,0xcf,0x01,0xb6,
-0x01,0x01,0xc8,0x0a,0x11,0x54,0x5d,0x09,0x0a,0x37,0x00,0x23,0xf9,0xff,0xb4,0x01,
-0x14,0xf3,0x2d,0x00,0x00,0x37,0x00,0x01,0x41,0x00,0x04,0x17,0x01,0x23,0x2d,0xd2,
-0x21,0x5b,0x01,0x57,0x35,0x00,0x84,0xcd,0x02,0xfe,0x2a,0x02,0x26,0x2b,0x04,0x11,
-0x05,0x13,0xaf,0x61,0x0e,0x03,0xd5,0x23,0x05,0x03,0x67,0x05,0xc7,0x8e,0x03,0x0c,
-0x32,0x03,0x07,0x32,0x04,0x20,0x00,0x05,0x66,0x73,0x03,0x18,0x00,0x00,0x60,0x60,
-0x10,0x40,0xb9,0x6a,0x10,0xf0,0x6a,0x00,0x57,0xa0,0x00,0x01,0xdf,0xfa,0x09,0x00,
-0x30,0x0c,0xff,0xa0,0xa8,0x20,0x14,0x80,0x4a,0x92,0x1d,0x1d,0x0b,0x00,0x01,0x00,
-0xd6,0x11,0x50,0x5f,0x07,0x20,0x0f,0xfc,0xb3,0x4a,0x01,0x21,0x4b,0x1d,0xaf,0x0b,
-0x00,0x00,0x9d,0x15,0x00,0xbc,0x27,0x77,0x8f,0xfd,0x10,0x00,0x08,0xff,0xd1,0x09,
-0x00,0x20,0x0f,0xfd,0x41,0x07,0x13,0xb1,0xe5,0x2c,0x12,0x40,0x7c,0x04,0x1f,0x80,
-0x07,0x00,0x04,0x7a,0x48,0x88,0x8c,0xff,0xc8,0x88,0x84,0x54,0x01,0x03,0x15,0x00,
-0x0f,0x38,0x00,0x09,0x03,0x5b,0x00,0x02,0x74,0xc1,0x13,0x41,0x8c,0x72,0x03,0x3f,
-0x00,0x23,0x7b,0xbb,0x6b,0x39,0x51,0x05,0xad,0xff,0xda,0x50,0x69,0x62,0x50,0xfc,
-0x88,0xcf,0xfd,0x40,0x41,0x12,0x40,0x40,0x00,0x04,0xef,0xde,0xce,0x80,0xf4,0x00,
-0x9e,0x80,0x4f,0xff,0x70,0x4f,0x7d,0x44,0xb0,0xf8,0x0c,0xff,0xf4,0xdf,0xff,0x80,
-0x9a,0xff,0xfe,0x08,0xe1,0x09,0x21,0x80,0xef,0x09,0x00,0x50,0x4f,0xff,0xc0,0x8f,
-0xff,0x1b,0x00,0x50,0x07,0xff,0xf4,0x08,0xee,0x2d,0x00,0x03,0x3f,0x00,0x17,0xf8,
-0x51,0x00,0x04,0x63,0x00,0x25,0x8c,0x20,0x59,0x09,0x03,0x28,0xbf,0x00,0x42,0xa7,
-0x53,0x80,0x49,0xdf,0xfd,0xa5,0xf8,0x4f,0x21,0xd8,0x8c,0x7f,0x50,0x01,0x3f,0x00,
-0x31,0x4e,0xff,0x70,0x5d,0x9c,0x30,0x69,0xe8,0x04,0x0f,0x83,0xd0,0xe3,0x00,0x9f,
-0xfe,0xff,0x80,0xcf,0xff,0x40,0x0d,0xff,0x70,0x05,0xae,0xd3,0x71,0xff,0xd0,0x0d,
-0xff,0xf7,0x00,0x2d,0x0a,0x00,0x20,0x04,0xff,0x8f,0xcb,0x20,0xf8,0xcf,0xf2,0xb1,
-0x20,0xff,0x40,0x85,0x08,0x13,0xf7,0x37,0xa8,0x31,0x3e,0xff,0xa0,0x9a,0x6b,0x51,
-0xc8,0x82,0x01,0xbf,0xf7,0x79,0xa2,0x46,0xdf,0xfc,0x10,0x08,0x5f,0x25,0x25,0x4e,
-0xfd,0xf0,0x13,0x17,0xc8,0x87,0x02,0x07,0x8b,0x09,0x10,0x00,0x21,0x80,0x05,0xe3,
-0x23,0x15,0xd0,0xa4,0x50,0x13,0xf7,0x74,0x38,0x21,0xd8,0x8d,0x1f,0x05,0x00,0x4d,
-0xac,0x03,0x07,0xb5,0x10,0x3f,0xe7,0x09,0x12,0xf3,0xbe,0x02,0x21,0xc0,0x0c,0xc0,
-0x02,0x10,0x05,0xe8,0x69,0x01,0x48,0x00,0x12,0x0e,0xc2,0x08,0x11,0xe0,0x05,0x10,
-0x20,0xe2,0x2e,0x4d,0x03,0x11,0x02,0x48,0x1f,0x00,0x69,0x10,0x10,0x0a,0xb3,0x96,
-0x10,0x3e,0xe3,0x0b,0x05,0x77,0x07,0x04,0xdc,0x02,0x07,0xde,0x02,0x02,0x01,0x00,
-0x14,0xd8,0x31,0x07,0x11,0x80,0xd2,0x7b,0x01,0xf1,0x03,0x10,0xf6,0x62,0x11,0xf0,
-0x00,0xfd,0x78,0x8e,0xff,0x15,0xff,0xe8,0xff,0xe2,0x00,0x02,0xe5,0x4f,0xfe,0x20,
-0x04,0x8b,0x51,0x13,0xff,0xf3,0x00,0x52,0x9a,0x00,0x30,0x31,0x00,0x52,0x83,0x9c,
-0x90,0xf4,0x5e,0x20,0xfe,0x20,0x78,0x8e,0xff,0x51,0x28,0x00,0x04,0x38,0x00,0x04,
-0x48,0x00,0x04,0x58,0x00,0x0a,0x68,0x00,0x08,0xbd,0x39,0x13,0xdd,0xa4,0x03,0x12,
-0xd1,0x90,0xb6,0x20,0xfd,0x10,0x0d,0x00,0xf1,0x04,0x99,0xff,0xd1,0x00,0x01,0xdf,
-0xf9,0x00,0x9f,0xfd,0x10,0x1d,0xff,0x90,0x00,0x09,0xff,0xd1,0xbf,0x9d,0xc7,0x36,
-0xfb,0x5f,0x90,0xe1,0xba,0x06,0x9a,0x59,0x02,0x15,0x00,0x03,0x23,0x00,0x03,0x31,
-0x00,0x03,0x3f,0x00,0x03,0x4d,0x00,0x04,0x5b,0x00,0x03,0x69,0x00,0x04,0x77,0x00,
-0x0c,0x01,0x00,0x24,0x1d,0xd1,0x97,0x00,0x41,0xdf,0xfd,0x10,0xef,0x34,0x22,0x00,
-0x3e,0x04,0x11,0xaf,0x42,0x08,0x42,0xcf,0xcf,0xfc,0xfc,0x21,0x3f,0x43,0x6b,0x1f,
-0xf1,0xb6,0x2b,0x3f,0x02,0x37,0x3f,0x0e,0x0a,0x00,0x02,0x24,0x00,0x01,0x0a,0x00,
-0x01,0x38,0x00,0x10,0x0f,0x6d,0x04,0x01,0x8a,0x04,0x10,0x0d,0x3a,0x03,0x00,0x60,
-0x00,0x0c,0x74,0x00,0x03,0xc1,0x51,0x01,0x0f,0x00,0x01,0xa1,0x99,0x06,0x20,0x07,
-0x0f,0x81,0x05,0x2e,0x06,0x5f,0x07,0x05,0x37,0xc9,0x03,0x95,0x02,0x04,0x0f,0x0a,
-0x03,0x1f,0x0a,0x04,0x1e,0x05,0x04,0x3f,0x0a,0x0f,0x6f,0x0a,0x14,0x84,0xdf,0xff,
-0xf0,0xdf,0xfd,0x0f,0xff,0xfd,0xed,0xd3,0x0f,0x47,0x0a,0x06,0x09,0x01,0x00,0x33,
-0x0a,0xea,0x62,0x7a,0x7c,0x03,0xee,0x6a,0x13,0x9f,0x55,0x00,0x01,0x0b,0xbc,0x02,
-0x19,0x00,0x14,0xfb,0x82,0x88,0x14,0x70,0xdd,0x95,0x0a,0x54,0x03,0x31,0x6f,0xff,
-0x30,0xe9,0x18,0x10,0x4f,0xa4,0x61,0x10,0x8f,0xaf,0x35,0x10,0xd0,0xb1,0x1f,0x43,
-0xe4,0xbf,0xff,0xd1,0x8b,0x3a,0x13,0xd1,0x3e,0x41,0x12,0x90,0x27,0x71,0x21,0xfb,
-0x30,0x59,0x00,0x22,0xdb,0x72,0x40,0x10,0x20,0xee,0x80,0x46,0x6b,0x01,0x09,0x91,
-0xf0,0x02,0x2d,0xff,0xd0,0xef,0x33,0xfe,0x00,0x2e,0xff,0xf3,0x0e,0xf3,0x3f,0xe0,
-0x2e,0xff,0xf3,0x8f,0x01,0x10,0x6e,0x7f,0x03,0x12,0x8e,0xe6,0x49,0x00,0x47,0xc3,
-0x02,0xf4,0x99,0x01,0x2d,0xb8,0x20,0x08,0xef,0x60,0x37,0x00,0xe0,0x0a,0x20,0xf6,
-0xef,0x65,0xa3,0x60,0x33,0xfe,0x02,0xef,0xff,0x30,0x3c,0x00,0x00,0x08,0x00,0x10,
-0x8f,0x8f,0x03,0x40,0xdf,0xfd,0x00,0x8e,0x4d,0x60,0x21,0x66,0x10,0xd6,0x0e,0x12,
-0x0d,0x17,0x08,0x22,0x0f,0xd1,0x07,0x00,0x31,0xfd,0xdf,0xf0,0x79,0x8e,0x13,0xff,
-0xca,0x98,0x0f,0x07,0x00,0x1f,0x11,0xdf,0x46,0x08,0x16,0xf9,0x4c,0x09,0x02,0x9d,
-0x17,0x13,0xfd,0x18,0x14,0x32,0xc1,0x00,0xff,0x2c,0xc7,0x02,0xe2,0x3c,0x12,0xd1,
-0x6c,0x0f,0x02,0x07,0xbf,0x03,0x31,0x0b,0x0e,0x2c,0x02,0x23,0xfb,0x11,0x1b,0x62,
-0x17,0x1f,0x07,0x00,0x03,0x15,0x00,0x08,0xba,0x07,0x21,0x12,0x22,0x52,0x3f,0x0a,
-0x3d,0x00,0x28,0x12,0x22,0x67,0x3f,0x0f,0x23,0x00,0x2c,0x1b,0x8f,0xfe,0x02,0x22,
-0xcf,0xff,0x6c,0x0a,0x04,0xb4,0x07,0x21,0xd2,0x5f,0x8d,0x12,0x30,0x2d,0xff,0x62,
-0xdc,0x07,0x90,0x26,0xff,0xff,0xfa,0x18,0xff,0xff,0x81,0xaf,0xfa,0x04,0x31,0x4d,
-0xd4,0x3e,0x24,0x00,0x2f,0x81,0x18,0x0e,0x03,0x09,0x01,0x56,0x10,0x12,0x01,0x90,
-0x7b,0x01,0x87,0x05,0x11,0x06,0x34,0x11,0x11,0x08,0x7f,0x02,0x12,0x0a,0x57,0x3b,
-0x01,0x27,0x11,0x11,0x0e,0xeb,0x0a,0x13,0x0d,0x43,0x03,0x31,0x0a,0xff,0xe0,0x2f,
-0x20,0x01,0xbe,0x38,0x16,0xfc,0xc7,0xa2,0x24,0x9f,0xa0,0xc8,0x85,0x41,0x00,0x00,
-0xd7,0x00,0x91,0xc6,0x11,0x40,0x1d,0x03,0x11,0x99,0x57,0xd7,0x24,0xff,0x99,0x18,
-0x11,0x01,0x07,0x00,0x12,0x90,0x7f,0x01,0x10,0x0d,0x17,0x02,0x30,0xff,0xff,0x0f,
-0x17,0x02,0x02,0x07,0x00,0x11,0xfd,0x07,0x00,0x00,0x07,0x23,0x03,0xbb,0x05,0x08,
-0x07,0x00,0x32,0xdf,0xff,0x0f,0x41,0x00,0x0a,0x07,0x00,0x13,0x0d,0x5e,0x03,0x13,
-0xcc,0x51,0x03,0x11,0x30,0x11,0x65,0x01,0xc1,0x58,0x12,0x1e,0xaf,0x0d,0x00,0x96,
-0x03,0x03,0xdd,0x7b,0x14,0xfd,0x86,0x00,0x02,0x1e,0x16,0x03,0x91,0x23,0x22,0x30,
-0x08,0x1c,0x06,0x03,0xe1,0x0d,0x04,0xb1,0x7e,0x05,0x36,0xa8,0x04,0x45,0x21,0x11,
-0xe0,0xda,0x00,0x15,0xee,0x89,0x31,0x09,0x9f,0x04,0x30,0x00,0xf0,0x0f,0x03,0x00,
-0x07,0x09,0x00,0x05,0x01,0x00,0x77,0xf8,0x08,0x80,0x88,0x08,0x80,0x8f,0x09,0x00,
-0x07,0x36,0x00,0x00,0xf5,0x03,0x17,0x00,0x09,0x00,0x0e,0x15,0x0e,0x0a,0x01,0x00,
-0x23,0x03,0xaf,0x10,0x04,0x12,0xcf,0x3b,0x04,0x20,0x06,0xdf,0x41,0x1c,0x00,0x8b,
-0x2f,0x02,0xc9,0xbb,0x13,0x18,0xb6,0x00,0x13,0x2a,0x9b,0x1a,0x13,0x08,0xe6,0x0f,
-0x05,0x52,0x85,0x03,0x12,0x00,0x14,0xfe,0xc5,0x04,0x03,0x22,0x4d,0x05,0x45,0x79,
-0x05,0x25,0x07,0x04,0xb3,0x0c,0x15,0x00,0x46,0x80,0x25,0xff,0xf2,0xc8,0x2a,0x0b,
-0xe2,0xa8,0x21,0xf0,0xd1,0x75,0x0e,0x21,0xfd,0x10,0xa3,0x03,0x11,0xd1,0x06,0x00,
-0x12,0xfd,0x88,0x13,0x0f,0xbe,0x05,0x29,0x1d,0xdf,0x3c,0x05,0x51,0x04,0x9c,0xef,
-0xfe,0xc9,0xdc,0x20,0x11,0xef,0xc6,0x00,0x10,0x70,0x7f,0x38,0x80,0xfc,0xa8,0x8a,
-0xcf,0xff,0xfd,0x40,0x6f,0xdb,0xbb,0x01,0xa9,0xac,0x23,0xcf,0xf6,0x24,0x05,0x50,
-0xfc,0x1a,0x30,0x00,0x5a,0x1c,0x09,0x21,0x03,0xa1,0x9f,0x99,0x01,0xa1,0x99,0x00,
-0x05,0xde,0x50,0xa8,0x8a,0xef,0xff,0x50,0xef,0x06,0x10,0x70,0x91,0xba,0x14,0x10,
-0xbe,0xad,0x13,0x21,0xd2,0x08,0x05,0x5c,0x09,0x2e,0xef,0xfe,0x0a,0x00,0x02,0x1e,
-0x00,0x15,0x8f,0x54,0x08,0x06,0xf0,0x05,0x14,0xff,0xee,0x24,0x17,0xfd,0xbb,0x02,
-0x03,0x0a,0x00,0x06,0xd6,0x02,0x09,0xe0,0x02,0x06,0x32,0x00,0x05,0x46,0x00,0x06,
-0x5a,0x00,0x0f,0x64,0x00,0x11,0x24,0xf0,0x00,0x64,0x00,0x00,0x58,0xd9,0x0e,0x0a,
-0x00,0x0f,0x64,0x00,0x30,0x02,0x99,0x06,0x04,0x6a,0x10,0x0e,0x0a,0x00,0x0f,0x64,
-0x00,0x2f,0x24,0xf0,0x00,0x64,0x00,0x02,0x10,0x07,0x0e,0x0a,0x00,0x0f,0x64,0x00,
-0x2d,0x06,0x4c,0x81,0x06,0x26,0x11,0x0d,0x0a,0x00,0x0f,0x64,0x00,0x0d,0x29,0x00,
-0x00,0xe3,0x29,0x02,0x39,0x02,0x01,0xd7,0x57,0x05,0x1a,0x18,0x34,0xb9,0x29,0xfe,
-0x0d,0x1e,0x22,0x10,0x02,0xfd,0xc5,0x31,0x80,0x0a,0x90,0x9b,0xdf,0x50,0x00,0xdf,
-0xff,0x77,0xf7,0x66,0x1a,0x80,0x8f,0xd3,0x0f,0xff,0xfd,0xcc,0xdf,0xdc,0x57,0xa1,
-0x60,0xb0,0x8f,0xfe,0x10,0x00,0xaa,0x60,0x0b,0xa3,0x40,0x00,0x46,0x10,0x00,0x01,
-0xf2,0x02,0x33,0x10,0x36,0x22,0x23,0xb1,0xcf,0x14,0x53,0x05,0xb6,0x58,0x01,0x00,
-0x08,0x15,0xf9,0x43,0x0a,0x21,0x22,0x00,0x97,0xdd,0x40,0xfd,0x92,0x00,0x02,0xd8,
-0x4a,0x00,0x4c,0x6e,0xf0,0x0c,0x2e,0xff,0xe0,0x4f,0xff,0xfa,0x03,0xff,0xf5,0x9f,
-0xfa,0xfa,0x35,0x4f,0xfa,0xcf,0xc0,0x8a,0x3d,0x0b,0xfd,0xef,0xfb,0x03,0x11,0x8f,
-0xfe,0xe3,0x39,0x01,0x17,0x08,0xf0,0x0d,0x08,0xff,0xff,0xef,0xfd,0x11,0x10,0x9f,
-0xff,0xdf,0xd1,0x59,0x3b,0x0b,0xfd,0xaf,0xd6,0xfa,0x37,0x1d,0xfb,0x5f,0xff,0xfa,
-0x01,0xdf,0xf7,0x0d,0xac,0x09,0xb0,0xf1,0x03,0xef,0xfc,0xdf,0xff,0x50,0x00,0x18,
-0xdf,0xfe,0x4f,0x42,0x00,0x12,0x0f,0x0b,0xd9,0x7f,0x09,0x99,0x82,0x14,0xf0,0x07,
-0x00,0xcf,0xf9,0x9f,0x99,0xf9,0x9f,0xf0,0x0f,0xf8,0x8f,0x88,0xf8,0x8f,0x07,0x00,
-0x12,0x03,0x31,0x00,0x08,0xa4,0x0b,0x13,0x80,0x1c,0x0c,0x14,0xa0,0x24,0x0c,0x14,
-0xb0,0x36,0x0c,0x11,0xa0,0x9a,0x93,0x32,0x1d,0xff,0xff,0x12,0x82,0x31,0x1d,0xff,
-0x70,0x20,0x00,0x22,0xfa,0x1d,0x08,0x00,0x02,0xa5,0x04,0x02,0xd1,0x3e,0x0f,0x08,
-0x00,0x07,0x13,0x6f,0x08,0x00,0x13,0x0b,0x08,0x00,0x00,0xbc,0x04,0x13,0x70,0x23,
-0x27,0x12,0x70,0xe2,0x5a,0x1d,0xdb,0x31,0xcf,0x12,0x1b,0xfe,0x01,0x10,0xe4,0x4c,
-0x0b,0x02,0x00,0x01,0x00,0x1d,0x0b,0x20,0xfa,0xef,0x7f,0x41,0x10,0x01,0x7f,0x05,
-0x10,0x2e,0x99,0xc4,0x10,0x1d,0xed,0x39,0x32,0x02,0x20,0x2e,0xae,0x07,0x48,0xfe,
-0x20,0x02,0xef,0x0a,0x00,0x06,0x1e,0x00,0x06,0x32,0x00,0x06,0x46,0x00,0x07,0x5a,
-0x00,0x06,0x6e,0x00,0x11,0x07,0x06,0x00,0x10,0x7f,0x16,0x00,0x71,0x07,0xf8,0x0f,
-0x0b,0x40,0xff,0x7f,0x06,0x00,0x12,0xff,0x06,0x00,0x0f,0x01,0x00,0x22,0x02,0x34,
-0x05,0x14,0x4e,0x40,0x3a,0x08,0xce,0x02,0x33,0x03,0xe0,0x00,0x5b,0xa9,0x31,0x10,
-0x00,0xbf,0x4b,0x01,0x41,0xf1,0x00,0xcf,0xf1,0x26,0x61,0x30,0x11,0xcf,0xff,0x88,
-0x31,0x33,0xbf,0xf1,0xcf,0x47,0x00,0x23,0x17,0xff,0xda,0x14,0x14,0x07,0x35,0x06,
-0x14,0x06,0x2c,0x06,0x3e,0x05,0xa0,0x00,0x01,0x00,0x2f,0xf9,0x00,0x01,0x00,0x56,
-0x04,0x71,0x0e,0x17,0xf1,0x14,0x00,0x61,0xfa,0xf9,0x00,0xfe,0xf5,0x00,0x66,0x7b,
-0x0f,0x85,0x00,0x53,0x4f,0x03,0x05,0x00,0x03,0x69,0x00,0x52,0x2f,0xdc,0x00,0x01,
-0x00,0x68,0x1f,0xe1,0x71,0x00,0x5d,0x03,0xd4,0x01,0x10,0xf6,0x67,0x3d,0x62,0xf1,
-0xfe,0xf6,0xfb,0x00,0xed,0xdf,0x01,0x40,0xff,0x00,0x00,0xfe,0xf1,0x3d,0x1f,0x02,
-0x83,0x00,0x4f,0x3f,0xfd,0x00,0xfd,0xcf,0x02,0x57,0x06,0xf9,0x08,0x03,0x86,0x0a,
-0x0a,0xe9,0x17,0x1f,0xfe,0x69,0x01,0x4a,0x00,0x7d,0x00,0x10,0xf5,0xf0,0x00,0x2f,
-0xfb,0xfd,0xe8,0x01,0x5d,0x15,0x03,0xe2,0x00,0x11,0xfe,0xe5,0x00,0x2f,0xfe,0xfd,
-0x83,0x00,0x4a,0x20,0xde,0x00,0xbe,0xa6,0x15,0xe6,0x77,0x00,0x00,0x0e,0xb7,0x00,
-0x72,0x00,0x0f,0x76,0x00,0x4b,0x05,0xa8,0x28,0x01,0xec,0xbb,0x0f,0x64,0x01,0x5b,
-0x1f,0xfd,0x2e,0x04,0x60,0x16,0xec,0xc7,0x02,0x04,0x84,0x00,0x10,0xfd,0x07,0x00,
-0x2f,0xfb,0xf8,0x1d,0x05,0x4d,0x00,0xb2,0xd9,0x67,0xe6,0xfd,0xe6,0xf4,0x00,0xdd,
-0x3c,0x03,0x2f,0xf1,0xfa,0xed,0x00,0x48,0x00,0x70,0x33,0x42,0x00,0xea,0x00,0xe9,
-0x9f,0x04,0x52,0x00,0xfc,0x00,0xff,0xfe,0x18,0xa5,0x0f,0xa3,0x04,0x51,0x01,0x68,
-0x01,0x4f,0xfd,0xfe,0x00,0xfc,0xe3,0x01,0x5e,0x10,0xfa,0xe4,0x00,0x0f,0x58,0x01,
-0x4a,0x09,0x51,0x08,0xb1,0xe0,0xde,0x00,0x00,0xf1,0xfd,0xe5,0xfe,0x02,0x00,0x02,
-0x59,0x01,0xdf,0xeb,0xf5,0x00,0xf5,0xe6,0xf8,0xf7,0x00,0xf8,0xf6,0xfa,0xf6,0xf9,
-0x9c,0x04,0x47,0x66,0xe5,0xec,0x00,0x00,0xf7,0xfe,0xc3,0x03,0x40,0xfa,0xfb,0x00,
-0x00,0x6e,0x44,0x01,0x63,0x0c,0x1f,0x02,0x29,0x04,0x46,0x22,0xee,0xf9,0xdd,0x08,
-0x23,0x02,0x00,0xac,0x9a,0x12,0xfc,0xaa,0x04,0x02,0x01,0xb1,0x0f,0x6b,0x01,0x47,
-0x14,0xed,0x30,0x04,0x1a,0x02,0xb8,0x03,0x1f,0xfc,0xbf,0x02,0x48,0xe0,0x03,0xfa,
-0xe3,0xed,0x00,0x00,0xed,0xfc,0xf4,0xfe,0x02,0xf4,0x02,0x02,0xde,0x01,0xef,0xf8,
-0xf8,0xfd,0xfb,0xf8,0xfb,0xf9,0xfd,0xfb,0xfe,0x00,0xfd,0xfc,0x02,0x64,0x02,0x4a,
-0x2e,0x02,0xfd,0xa6,0x04,0x0f,0x82,0x06,0x4c,0x05,0xd0,0x07,0x1f,0xfe,0xac,0x03,
-0x56,0x0e,0x6a,0x00,0x0f,0x5a,0x08,0x52,0x0f,0x36,0x02,0x0a,0x3f,0xff,0x00,0xfe,
-0x7a,0x00,0x44,0x0d,0x22,0x21,0x0f,0x65,0x01,0xca,0x1e,0x02,0x7e,0x0c,0x19,0x02,
-0xf4,0x07,0x0f,0x2f,0x04,0x43,0x2f,0xf6,0x00,0x01,0x00,0x77,0x0f,0x49,0x03,0x4f,
-0x1f,0xf5,0x7f,0x00,0x0b,0x2f,0xfd,0xfe,0x32,0x0a,0x47,0x1c,0xea,0x55,0x03,0x30,
-0xfe,0x03,0x00,0x2c,0xe6,0x00,0x08,0x07,0x0f,0x01,0x00,0x5c,0x1f,0xfc,0x20,0x0b,
-0x4f,0x1c,0xeb,0x5c,0x01,0x2f,0xfe,0x02,0x28,0x05,0x51,0x1f,0xf1,0xca,0x02,0x77,
-0x1f,0xfb,0x77,0x00,0x63,0x1f,0xfe,0x6c,0x00,0xc1,0x0f,0x55,0x12,0x23,0x0f,0x82,
-0x01,0x0c,0x0b,0x1e,0x08,0x0f,0xb0,0x01,0x35,0x2f,0xf8,0xf8,0xe3,0x00,0x57,0x15,
-0xf8,0x6d,0x00,0x21,0xf8,0xf3,0x0a,0x00,0x10,0xee,0x0b,0x00,0x0c,0x25,0x00,0x0f,
-0x1d,0x01,0x04,0x3f,0xfb,0xfb,0xfb,0x54,0x01,0x34,0x1f,0xf6,0xcb,0x01,0x6d,0x0f,
-0x01,0x00,0x44,0x2f,0xee,0xf3,0xe7,0x00,0x06,0x0f,0x91,0x00,0x49,0x29,0xf3,0xf3,
-0xab,0xd8,0x0f,0xa2,0x07,0x66,0x04,0x5d,0x02,0x1f,0x0a,0xee,0x00,0x52,0x0f,0x1e,
-0x04,0x5d,0x0a,0x5c,0x02,0x1f,0xee,0x9e,0x04,0x64,0x1e,0xf1,0x2f,0x04,0x0f,0x63,
-0x02,0x41,0x2b,0xec,0xe6,0xca,0x02,0x2e,0x03,0x03,0xf6,0x00,0x0e,0x2b,0x04,0x08,
-0x54,0x07,0x3f,0xe9,0xee,0xe9,0x41,0x03,0x1f,0x1f,0xe6,0xc1,0x12,0x02,0x1f,0xf3,
-0x3c,0x00,0x12,0x03,0x07,0x00,0x2f,0xee,0xee,0xd1,0x02,0x37,0x0f,0x30,0x03,0x53,
-0x0e,0xc9,0x01,0x0f,0x01,0x00,0x5b,0x01,0xad,0x4b,0x0f,0x66,0x00,0x4e,0x1f,0xf6,
-0x98,0x04,0x63,0x52,0xf3,0xf8,0xf8,0x00,0xf8,0xf9,0x06,0x00,0xd0,0x01,0x23,0xf1,
-0xfb,0x63,0x01,0x10,0xf3,0xf7,0x00,0x1f,0xfb,0xee,0x00,0x48,0x1f,0xfd,0xee,0x00,
-0x61,0x16,0xf6,0xe9,0x07,0x00,0xee,0x00,0x20,0xf8,0xf6,0x08,0x00,0x3f,0xfd,0x00,
-0xf3,0xfa,0x05,0x4d,0x03,0xb7,0x02,0x3f,0xfb,0x03,0x03,0xc8,0x0a,0x5f,0x1f,0xf8,
-0x36,0x0a,0x8a,0x0f,0x6f,0x08,0x49,0x2f,0xee,0xf3,0x64,0x02,0x62,0x1f,0xf6,0x66,
-0x00,0x5c,0x1f,0xf8,0xd5,0x08,0x58,0x18,0xf8,0xea,0x07,0x01,0x87,0x00,0x2f,0xf6,
-0xfb,0x4f,0x02,0x5b,0x1f,0xfb,0x16,0x0c,0x58,0x0c,0xdc,0x00,0x0f,0xd0,0x1e,0x53,
-0x0f,0x10,0x0c,0x23,0x1f,0xfb,0x46,0x0c,0x2e,0x2b,0x03,0x03,0x52,0x00,0x0e,0x7b,
-0x0d,0x0f,0x9e,0x06,0x5e,0x0f,0xba,0x0a,0x58,0x0f,0x39,0x0b,0x53,0x2f,0xe6,0xe6,
-0xba,0x01,0x0c,0x17,0xf3,0x8d,0x00,0x18,0xf6,0x1d,0x00,0x32,0xfb,0x00,0xe9,0x6d,
-0x03,0x10,0xfb,0x6d,0x0e,0x23,0xee,0xf3,0x04,0x0a,0x2f,0xf6,0xf1,0x87,0x05,0x34,
-0x00,0x50,0x0a,0x07,0x5e,0x03,0x00,0x62,0x04,0x13,0xfb,0xb7,0x06,0x18,0xfb,0xf4,
-0x03,0x1f,0xf8,0xc3,0x06,0x18,0x1f,0xf8,0xfe,0x05,0x63,0x2f,0xf1,0xf1,0x9c,0x06,
-0x33,0x1f,0xf8,0x04,0x0d,0x24,0x0f,0x71,0x06,0x89,0x1e,0xf8,0x16,0x0c,0x0f,0xf7,
-0x00,0x23,0x2f,0xe9,0xec,0x63,0x1f,0x12,0x26,0xf6,0xf6,0x0a,0x02,0x05,0xaa,0x00,
-0x26,0xf1,0xf3,0x6e,0x03,0x2f,0xec,0xf6,0x6c,0x01,0x1a,0x2f,0xee,0xec,0xdc,0x01,
-0x1d,0x1e,0x03,0xa1,0x01,0x0f,0xad,0x01,0x1f,0x2f,0xec,0xe9,0xfd,0x01,0x21,0x02,
-0x86,0x00,0x44,0xf1,0xf6,0xf6,0xf6,0x75,0x0a,0x24,0xee,0xf8,0x5d,0x05,0x0f,0x77,
-0x00,0x13,0x1f,0xec,0x61,0x03,0x0e,0x1f,0xfb,0x1c,0x00,0x07,0x05,0x05,0x01,0x3f,
-0xfd,0xf3,0xf8,0xe8,0x18,0x91,0x2f,0xe9,0xe9,0x6f,0x03,0x27,0x12,0xfb,0x65,0x01,
-0x0f,0xdc,0x01,0x22,0x1f,0xee,0x38,0x22,0x27,0x0e,0x53,0x02,0x0f,0x1b,0x0b,0x53,
-0x06,0xab,0x14,0x0f,0x51,0x15,0x50,0x05,0xaa,0x00,0x28,0xfb,0xf1,0x5b,0x05,0x1f,
-0xf3,0xe7,0x11,0x5b,0x00,0xbc,0x10,0x1f,0xf8,0xdb,0x12,0x66,0x1f,0xfb,0x5d,0x24,
-0x1b,0x1f,0xfd,0xb1,0x0d,0x2e,0x1f,0xfd,0xf9,0x06,0x47,0x0f,0x19,0x06,0x0e,0x1f,
-0xfb,0x77,0x00,0x63,0x0f,0x1b,0x18,0x58,0x1f,0xf8,0x84,0x00,0x27,0x0f,0x4c,0x05,
-0x1a,0x1f,0x05,0x77,0x00,0x36,0x2f,0xf1,0xf3,0xdc,0x01,0x35,0x1f,0xfd,0xca,0x02,
-0x55,0x0f,0x62,0x15,0x29,0x1f,0xf8,0x98,0x16,0x3c,0x0f,0x53,0x02,0x33,0x1f,0xf1,
-0xed,0x0a,0x14,0x1f,0xf8,0x77,0x00,0x3b,0x1f,0xee,0xee,0x00,0x43,0x0f,0xbc,0x0f,
-0x29,0x1f,0xfb,0xa3,0x18,0x63,0x1f,0xf3,0xda,0x12,0x51,0x1f,0xfb,0x02,0x13,0x57,
-0x12,0xfb,0xe5,0x0d,0x1f,0xf8,0x80,0x00,0x13,0x1f,0xfb,0xe5,0x00,0x4f,0x1f,0x08,
-0xc5,0x0c,0x63,0x1f,0x08,0x78,0x00,0x05,0x1f,0x0d,0xd2,0x01,0x7f,0x0f,0x7b,0x0d,
-0x17,0x1f,0xfb,0x6d,0x2c,0x14,0x1e,0xf8,0x2f,0x06,0x0f,0x2f,0x04,0x29,0x0f,0x19,
-0x03,0x44,0x0f,0x77,0x00,0x39,0x0f,0x2c,0x0f,0x46,0x2f,0x05,0x05,0x1a,0x19,0x36,
-0x0f,0x74,0x17,0xa2,0x09,0xa2,0x0b,0x0f,0x41,0x13,0x17,0x2f,0xec,0xec,0xb1,0x01,
-0x27,0x17,0xec,0x21,0x12,0x0f,0xf2,0x11,0x1c,0x1f,0xfb,0x26,0x02,0x3c,0x1f,0xfb,
-0x7b,0x0d,0x40,0x0b,0xd9,0x21,0x4f,0xfb,0xfd,0xfd,0xfd,0x82,0x0a,0x24,0x2f,0xf1,
-0xf6,0xe0,0x23,0x88,0x1f,0xf8,0x3f,0x01,0x0e,0x1f,0xfb,0xe9,0x12,0x63,0x0f,0x8d,
-0x0c,0x3c,0x1f,0xf8,0xf4,0x03,0x09,0x1e,0xfd,0x95,0x0f,0x0f,0x04,0x0d,0x42,0x19,
-0xfb,0x38,0x10,0x17,0xf3,0xd1,0x0f,0x2f,0xfb,0xf8,0x69,0x0e,0x2b,0x2e,0xf1,0xf1,
-0xa1,0x06,0x05,0xc8,0x02,0x28,0xf3,0xf3,0x52,0x01,0x44,0xf1,0xfb,0xfd,0xfd,0x2f,
-0x04,0x26,0xf8,0xf6,0x32,0x04,0x12,0x01,0x1c,0x2b,0x21,0x02,0x03,0x94,0x71,0x2e,
-0x04,0x05,0x6b,0xd3,0xf2,0x0b,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,
-0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,
-0x73,0xa9,0x70,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0xaa,0x53,0xe0,0x1f,0x1f,0x21,
-0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x54,0xdc,0x0f,0x47,0xf2,
-0x06,0xf0,0x10,0x2a,0x2b,0x00,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x00,0x33,0x00,
-0x34,0x35,0x00,0x00,0x36,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x00,0x3d,0x3e,0x3f,0x40,
-0x41,0x42,0xd3,0x67,0xf0,0x2b,0x44,0x45,0x46,0x47,0x48,0x00,0x49,0x31,0x4a,0x00,
-0x4b,0x4c,0x00,0x00,0x31,0x4d,0x4e,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,
-0x57,0x58,0x59,0x00,0x5a,0x5b,0x5c,0x5d,0x5e,0x5f,0x60,0x61,0x62,0x63,0x64,0x2d,
-0x65,0x66,0x00,0x67,0x68,0x69,0x6a,0x6a,0x6b,0x00,0x6c,0x6d,0x6e,0x00,0x6f,0x00,
-0x11,0x60,0x00,0x8e,0xe0,0x30,0x2d,0x72,0x73,0xf5,0xc0,0x8f,0x75,0x76,0x77,0x00,
-0x78,0x79,0x7a,0x00,0x01,0x00,0xff,0x48,0x02,0x46,0x02,0x20,0x03,0x02,0x41,0x02,
-0x3c,0x06,0x07,0x06,0xe0,0x09,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,
-0x21,0x0c,0x00,0x08,0x00,0xd0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,
-0x00,0x00,0x15,0x59,0x54,0x71,0x00,0x17,0x17,0x17,0x18,0x17,0x00,0x13,0xed,0xd4,
-0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0xde,0xf1,0x0c,
-0x01,0x00,0xf1,0x03,0x24,0x00,0x25,0x26,0x27,0x28,0x00,0x29,0x00,0x2a,0x2b,0x2c,
-0x2d,0x00,0x2a,0x2a,0x00,0x00,0x4e,0x02,0x30,0x33,0x34,0x35,0x4a,0x02,0xf3,0x01,
-0x00,0x3a,0x3b,0x3c,0x3c,0x3d,0x3e,0x00,0x00,0x3f,0x00,0x00,0x40,0x41,0x00,0x42,
-0x4e,0x02,0x91,0x49,0x4a,0x00,0x4b,0x4b,0x00,0x4c,0x4d,0x00,0x4b,0x02,0x00,0x4c,
-0x02,0x01,0x4d,0x02,0x22,0x55,0x43,0x4e,0x02,0x11,0x55,0x4f,0x02,0x40,0x00,0x00,
-0x65,0x66,0x4f,0x02,0x00,0xdb,0x47,0x01,0x50,0x02,0xdf,0x70,0x71,0x72,0x00,0x00,
-0x73,0x00,0x74,0x75,0x00,0x00,0x76,0x77,0x40,0x02,0xff,0x43,0x50,0x00,0x00,0x00,
-0x00,0x00,
+0x3f,0xe1,0x1f,0xc0,0xaf,0x5e,0xb0,0x05,0xe3,0x9c,0xfb,0x01,0xc4,0xeb,0x00,0x00,
+0x08,0xfd,0x40,0x8e,0x03,0x31,0x86,0x02,0x83,0x15,0x06,0x81,0xfa,0x15,0xfb,0x11,
+0x11,0x00,0x00,0x5f,0x8c,0x01,0x92,0x60,0x06,0xff,0xa5,0x58,0xfb,0x55,0x55,0x20,
+0x0f,0x00,0x40,0xfa,0x00,0x09,0xaf,0x10,0x00,0x40,0x53,0x00,0x00,0x6f,0x10,0x00,
+0x00,0xed,0x04,0x52,0x94,0x47,0xfa,0x44,0x43,0x10,0x00,0x00,0x9c,0x05,0x73,0x37,
+0x66,0x6f,0xf6,0x66,0x66,0x50,0xcc,0x01,0xf0,0x22,0xf2,0x17,0x77,0x9f,0xff,0xff,
+0xfa,0x77,0x71,0x00,0x4a,0xff,0x9f,0xf8,0xff,0xa4,0x00,0x6f,0xff,0xc3,0x0f,0xe0,
+0x2b,0xff,0xf4,0x0b,0x82,0x00,0x0f,0xe0,0x00,0x28,0x90,0x00,0x01,0x72,0x00,0x00,
+0x52,0x01,0x00,0x04,0x46,0xfa,0x44,0x31,0xfa,0xdc,0x00,0x92,0x01,0xf0,0x1a,0xa6,
+0xf4,0x8f,0x20,0x05,0x95,0x47,0x79,0x2c,0xf9,0xaa,0x92,0x06,0xf7,0xee,0x9f,0x6f,
+0xff,0xff,0xf4,0x06,0xf8,0xee,0xbf,0xdf,0xf1,0xbe,0x10,0x06,0xf8,0x68,0xaf,0x9f,
+0xf6,0xdf,0x60,0x06,0xff,0xff,0xff,0x1b,0x35,0x03,0xf1,0x14,0x11,0xcc,0x11,0x0b,
+0xf3,0xcf,0x30,0x0e,0xff,0xff,0xff,0x8b,0xf0,0xbe,0x00,0x0e,0xdb,0xf9,0x8f,0x8b,
+0xff,0xff,0xf1,0x0e,0xac,0xbb,0x5f,0x8b,0xf8,0xdf,0x81,0x0e,0xcf,0xff,0xcf,0x18,
+0x00,0xf1,0x02,0xa2,0x04,0xbf,0x7b,0xff,0xff,0xf6,0x0e,0xa0,0x02,0xcb,0x2b,0xfa,
+0xaa,0xa4,0x00,0xef,0xa0,0x00,0x31,0x10,0x00,0x56,0x34,0x03,0x23,0x00,0x0f,0x34,
+0x03,0x20,0x0f,0xc6,0x10,0x00,0xf3,0x0d,0x6a,0xf4,0x0f,0xaa,0xff,0x6f,0xd7,0xff,
+0xc7,0xf4,0x04,0x29,0x99,0x4f,0xd4,0x99,0x93,0x41,0x00,0x07,0x77,0x39,0x83,0x77,
+0x71,0x00,0x00,0x8f,0xf8,0x00,0x67,0x8f,0x85,0x6f,0xd5,0x56,0xfb,0x10,0x00,0x45,
+0x84,0x5f,0xd4,0x46,0x10,0x00,0x90,0x73,0x00,0x7d,0x52,0x2f,0xf9,0x99,0x9b,0xfa,
+0x0e,0x03,0x40,0xef,0xff,0xff,0xd2,0xdb,0x08,0x10,0xe0,0xa6,0x02,0x02,0x68,0x00,
+0x31,0x40,0x00,0x66,0x28,0x01,0x30,0x10,0x00,0x36,0x08,0x00,0x11,0x63,0xd4,0x02,
+0x00,0x34,0x03,0x92,0x05,0x55,0x55,0x5f,0xf5,0x55,0x55,0x50,0x1f,0x28,0x00,0x10,
+0xf1,0x11,0x00,0x63,0x55,0x55,0x50,0x00,0x00,0x0f,0x2c,0x03,0x6a,0x0f,0xe4,0x44,
+0x44,0x4e,0xf1,0x10,0x00,0x18,0x4d,0x10,0x00,0x51,0xd0,0x00,0x18,0x8e,0xf0,0x08,
+0x00,0x30,0x0c,0xed,0x70,0x46,0x0b,0x45,0xf1,0x1f,0xe0,0x00,0x08,0x00,0x70,0x03,
+0x33,0x3e,0xf1,0x1f,0xf3,0x33,0x3c,0x0a,0xd4,0xf1,0x1f,0xff,0xff,0xf1,0x0a,0xaa,
+0xaf,0xf1,0x1f,0xfa,0xaa,0xa0,0x20,0x00,0x92,0x09,0xcc,0xcf,0xf1,0x1f,0xfc,0xcc,
+0x80,0x0c,0x20,0x00,0x1c,0xb0,0x40,0x00,0x12,0x5f,0x18,0x00,0x40,0xf5,0x4e,0xee,
+0xef,0x28,0x00,0x1c,0xc4,0x20,0x00,0x06,0x08,0x00,0x03,0x6b,0x0a,0x03,0xd4,0x03,
+0xd0,0x2c,0xcc,0xcc,0xdf,0xfc,0xcc,0xcc,0xc2,0x00,0x00,0x00,0x7f,0xa0,0x73,0x0c,
+0x82,0x99,0x99,0xdf,0xc9,0x99,0x99,0x40,0x08,0x20,0x00,0xf0,0x01,0x70,0x08,0xf6,
+0x2f,0xb2,0x2e,0xd2,0x8f,0x70,0x08,0xf5,0x0f,0xd8,0x8f,0xd0,0x6f,0x08,0x00,0x22,
+0xff,0xff,0x08,0x00,0x2a,0xa0,0x0d,0x10,0x00,0x03,0x20,0x00,0x65,0x1f,0xa0,0x0e,
+0xd0,0x7f,0x70,0x40,0x00,0xf0,0x1c,0xfc,0xbb,0xbb,0xbb,0xbb,0xdf,0x70,0x00,0x1f,
+0xb0,0x00,0x05,0xe5,0x00,0x00,0x25,0x6f,0xd5,0x52,0xac,0xfc,0xaa,0x20,0x6f,0xff,
+0xff,0xf3,0xff,0xff,0xff,0x30,0x38,0x9f,0xd8,0x81,0x1b,0xf2,0x7f,0x40,0x07,0x8f,
+0xd7,0x6b,0x98,0x02,0xc0,0x1f,0xfe,0xef,0xc4,0x88,0x88,0x88,0x60,0x1f,0xb5,0x5f,
+0xc0,0x40,0x00,0xf1,0x00,0x1f,0xff,0xff,0xc0,0xfc,0x00,0x5f,0x70,0x1f,0xa4,0x4e,
+0xc0,0xff,0xdd,0xef,0x10,0x00,0x80,0x66,0x6f,0xe6,0x40,0x02,0x3f,0xc2,0x27,0x18,
+0x02,0xf1,0x00,0x8e,0xef,0xfe,0xe4,0xcc,0x5f,0xe5,0x51,0x7c,0xcf,0xfc,0xc1,0xed,
+0x7f,0xe7,0x68,0x00,0x10,0xef,0x34,0x07,0x10,0x1f,0x23,0x01,0x18,0xd0,0xd7,0x06,
+0x23,0x15,0x50,0xfb,0x00,0x10,0xf2,0x28,0x06,0x12,0xff,0x48,0x03,0xf3,0x0a,0x02,
+0x9a,0xdd,0x99,0x99,0xde,0xb9,0x40,0x00,0x01,0xfe,0x00,0x00,0xef,0x40,0x00,0x17,
+0x77,0xef,0xa7,0x79,0xff,0x87,0x71,0x2f,0x28,0x03,0x21,0x01,0x11,0x01,0x00,0x32,
+0x10,0x00,0x2f,0x0b,0x09,0x60,0x00,0x2f,0xe9,0x99,0x99,0x9d,0x08,0x00,0x66,0xc4,
+0x44,0x44,0x4b,0xf5,0x00,0x18,0x00,0x48,0xc2,0x22,0x22,0x2b,0x20,0x00,0x03,0x18,
+0x00,0x03,0x01,0x00,0x40,0x0d,0xa0,0x08,0xf7,0x50,0x00,0xf0,0x05,0x0d,0xa9,0xa8,
+0xf4,0x99,0xdf,0xc9,0x91,0x0d,0xaa,0xa8,0xf0,0x55,0xdf,0x75,0x40,0x0d,0xaa,0xa8,
+0xf1,0xf4,0x08,0x00,0x08,0x00,0x41,0xfa,0x00,0x1f,0xb0,0x10,0x00,0xf2,0x16,0xee,
+0xff,0xb0,0x0e,0xaa,0xa8,0xf1,0xfc,0x55,0x6f,0xb0,0x0e,0x9a,0xa8,0xf1,0xfd,0x99,
+0xaf,0xb0,0x0f,0x9a,0xa8,0xf1,0xfe,0xbb,0xbf,0xb0,0x0f,0x8a,0xa8,0xf1,0xfb,0x44,
+0x5f,0xb0,0x1f,0x7a,0x38,0x00,0xf3,0x11,0x5f,0x5a,0xa8,0xf0,0x2b,0x41,0x78,0x10,
+0x9f,0x20,0x08,0xf4,0xdf,0x91,0xdf,0x90,0x6d,0x00,0x07,0xde,0xf7,0x00,0x0c,0xf4,
+0x01,0x00,0x00,0x02,0x10,0x00,0x00,0x20,0x80,0x00,0x00,0xd3,0x05,0x10,0xf5,0x80,
+0x00,0xf0,0x09,0x08,0xf6,0x5b,0xf3,0x55,0xaf,0x75,0x50,0x08,0xff,0xff,0xf2,0x9e,
+0xff,0xee,0xa0,0x08,0xf5,0x3a,0xf2,0xaf,0x65,0x6f,0xb0,0x10,0x00,0xf0,0x01,0xaf,
+0xee,0xef,0xb0,0x01,0x22,0x22,0x20,0xaf,0x55,0x5f,0xb0,0x3f,0xff,0xff,0xfe,0x10,
+0x00,0xf0,0x25,0x16,0x69,0xf9,0x66,0xaf,0x54,0x5f,0xb0,0x07,0xc4,0xf5,0x00,0xaf,
+0xdc,0xdf,0xb0,0x0a,0xe4,0xff,0xf9,0x5b,0xa9,0xac,0x60,0x0b,0xf8,0xf8,0x53,0x6f,
+0xc0,0xbf,0x60,0x0e,0xff,0xf4,0x07,0xfb,0x10,0x0a,0xf3,0x4f,0x7c,0xfd,0xa9,0xc8,
+0x88,0x88,0xa4,0x4e,0x10,0x6b,0xdf,0x58,0x02,0x0c,0x54,0x08,0x11,0x05,0xa7,0x04,
+0xf2,0x23,0x2e,0xa0,0x03,0xaa,0xab,0xaa,0xaa,0xfe,0xed,0x20,0x00,0x04,0xad,0x6d,
+0x60,0xcf,0xff,0x90,0x0b,0xff,0xfe,0xcf,0x70,0x8f,0x8a,0xc0,0x07,0xaf,0xc0,0x5f,
+0x70,0x2f,0xe2,0x73,0x00,0x0f,0xb0,0x5f,0x70,0x08,0xff,0xf9,0x1c,0xcf,0xfc,0xdf,
+0xec,0xcb,0x5b,0xc2,0x70,0x03,0xf3,0x23,0x0b,0x80,0x00,0x3f,0xa0,0x5f,0x70,0xbf,
+0xdf,0x60,0x00,0x7f,0x80,0x5f,0x70,0x9f,0xff,0xa1,0x00,0xbf,0x40,0x5f,0x70,0x6f,
+0x87,0xb0,0x04,0xfd,0x00,0x5f,0x70,0x2f,0xd0,0x42,0x2e,0xf5,0x00,0x5f,0x70,0x0b,
+0xfb,0xca,0x0b,0x80,0x00,0x5f,0x70,0x01,0xbf,0xf5,0x51,0x08,0x00,0x78,0x0c,0x20,
+0x17,0x80,0x0a,0x00,0x73,0x22,0x22,0x3f,0xf4,0x22,0x22,0x20,0xc0,0x03,0x22,0xf0,
+0x06,0xd4,0x07,0x00,0xd2,0x05,0x02,0xfc,0x07,0x50,0x0f,0xf5,0x55,0x55,0x5e,0x08,
+0x00,0x12,0xfc,0x04,0x08,0x12,0x06,0x1f,0x00,0x12,0x09,0x30,0x00,0x30,0xa0,0x0a,
+0xfa,0xf4,0x07,0xf1,0x01,0xbf,0xa0,0x0a,0xf3,0x7c,0xcc,0xcc,0xc4,0x3f,0xa0,0x0a,
+0xf3,0x9f,0xba,0xac,0xf5,0x08,0x00,0x21,0x75,0x58,0x08,0x00,0x00,0x50,0x05,0xa0,
+0xaf,0x90,0x0a,0xf3,0x59,0x10,0x00,0x0c,0xdb,0x30,0x19,0x00,0x01,0x00,0x20,0x49,
+0xdc,0x06,0x00,0xa0,0x16,0xbf,0xff,0xff,0x00,0x00,0x03,0x8d,0xff,0xff,0x08,0x00,
+0x22,0xcf,0xff,0x08,0x00,0x00,0x06,0x00,0x11,0xc7,0x08,0x00,0x30,0xfa,0x51,0x00,
+0x08,0x00,0x31,0x84,0x00,0x00,0x08,0x00,0x1f,0x00,0x08,0x00,0x06,0x22,0x2b,0xee,
+0x08,0x00,0x51,0xdf,0xff,0xff,0x2b,0xee,0x08,0x00,0x30,0xfd,0xdf,0xff,0x18,0x00,
+0x50,0xff,0xb2,0xdf,0xff,0xfd,0x72,0x00,0x00,0x0b,0x00,0x01,0x08,0x00,0x20,0xd0,
+0x0f,0x60,0x00,0xf4,0x03,0xf0,0x0d,0xff,0xff,0xc8,0x88,0x88,0x8c,0xff,0xff,0xf0,
+0x0f,0x80,0x00,0x00,0x08,0xf0,0x0f,0x08,0x00,0x20,0xff,0xff,0x08,0x00,0x00,0x18,
+0x00,0x64,0xec,0xcc,0xcc,0xce,0xf0,0x0f,0x08,0x00,0x06,0x18,0x00,0x0c,0x30,0x00,
+0x02,0x48,0x00,0x04,0x58,0x00,0x30,0xdf,0xff,0x73,0x09,0x00,0x41,0xfd,0xff,0xff,
+0xa5,0xd0,0x00,0x04,0x08,0x00,0x04,0x18,0x00,0x04,0x02,0x01,0x0f,0x28,0x00,0x3b,
+0x22,0x0a,0xb1,0x08,0x00,0x21,0xbf,0xfc,0x07,0x00,0x32,0x0b,0xff,0xfb,0x0f,0x00,
+0x40,0xff,0xc0,0x1b,0xa0,0x0f,0x00,0x41,0xfc,0x00,0xcf,0xfb,0x0f,0x00,0x40,0x00,
+0xbf,0xff,0xb0,0x0f,0x00,0x40,0x00,0x0c,0xff,0xfb,0x0f,0x00,0x01,0x77,0x01,0x01,
+0x2d,0x00,0x42,0x0c,0xff,0xff,0xb0,0x35,0x00,0x22,0xfb,0x00,0x45,0x00,0x01,0x0f,
+0x00,0x10,0x03,0x04,0x00,0xf0,0x09,0x08,0xfc,0x10,0x00,0x1c,0xf8,0xff,0xfc,0x10,
+0x1c,0xff,0xf5,0xff,0xfc,0x2c,0xff,0xf5,0x05,0xff,0xff,0xff,0xf5,0x00,0x05,0x05,
+0x00,0x81,0x00,0x1d,0xff,0xfd,0x10,0x00,0x1c,0xff,0x1e,0x00,0x40,0xf9,0xff,0xfc,
+0x1c,0x1e,0x00,0x20,0xfc,0xdf,0x1e,0x00,0xb0,0xd1,0xa4,0x00,0x00,0x04,0xa1,0x00,
+0x00,0x00,0x4f,0xe0,0x4b,0x00,0xf0,0x1a,0x02,0x10,0x6f,0xf1,0x03,0x10,0x00,0x00,
+0x5f,0xd0,0x6f,0xf1,0x3f,0xd1,0x00,0x03,0xff,0xf1,0x6f,0xf1,0x5f,0xfd,0x00,0x0d,
+0xff,0x40,0x6f,0xf1,0x09,0xff,0x70,0x4f,0xf7,0x00,0x6f,0xf1,0x00,0xcf,0xe0,0x9f,
+0xf0,0x08,0x00,0x40,0x5f,0xf3,0xbf,0xc0,0x08,0x00,0x40,0x2f,0xf5,0xbf,0xc0,0x40,
+0x00,0x31,0x1f,0xf6,0xaf,0x45,0x00,0x40,0x4f,0xf4,0x6f,0xf4,0x08,0x00,0xf0,0x0d,
+0xaf,0xf0,0x0f,0xfe,0x10,0x00,0x00,0x05,0xff,0xa0,0x06,0xff,0xd3,0x00,0x00,0x7f,
+0xff,0x20,0x00,0x9f,0xff,0xda,0xbe,0xff,0xf4,0x00,0x00,0x06,0x18,0x01,0x81,0x30,
+0x00,0x00,0x00,0x17,0xbd,0xca,0x50,0xcb,0x00,0x22,0x8b,0xb8,0xd3,0x00,0x11,0xff,
+0x34,0x02,0x80,0x30,0x06,0xff,0xff,0x60,0x03,0x00,0x04,0x24,0x02,0x42,0xfd,0xef,
+0x40,0x0d,0x57,0x01,0xe0,0xd0,0x4f,0xff,0xff,0xf9,0x9f,0xff,0xff,0xf4,0x08,0xff,
+0xff,0x20,0x02,0xef,0x01,0x74,0xff,0xf9,0x00,0x00,0x9f,0xff,0x00,0x08,0x00,0x04,
+0x18,0x00,0x04,0x28,0x00,0x04,0x38,0x00,0x20,0x04,0xfe,0x48,0x00,0x24,0xdf,0x40,
+0x58,0x00,0x05,0x68,0x00,0x06,0x78,0x00,0x50,0x03,0xdd,0x30,0x3f,0xf3,0x09,0x00,
+0x40,0x6f,0xff,0xf5,0x4f,0xbf,0x00,0xd0,0x09,0xff,0x99,0xff,0xbf,0xf4,0x00,0x00,
+0x01,0xbf,0xf6,0x22,0x6f,0xb4,0x00,0xf0,0x0e,0x2d,0xfe,0x35,0xff,0x53,0xef,0xf4,
+0x00,0x04,0xff,0xc1,0x8f,0xff,0xf8,0x1c,0xfe,0x40,0x7f,0xfa,0x1a,0xff,0xff,0xff,
+0xa1,0xaf,0xf7,0xcf,0x82,0xdf,0xd0,0x00,0x41,0x28,0xfc,0x14,0x0e,0x70,0x00,0x51,
+0xe0,0x41,0x00,0x0f,0xff,0x6c,0x02,0x72,0x00,0x00,0x0f,0xff,0xf9,0x00,0x8f,0x09,
+0x00,0x1b,0xf8,0x09,0x00,0x71,0x0e,0xff,0xf6,0x00,0x6f,0xff,0xe0,0x43,0x02,0x18,
+0xfd,0xfe,0x00,0x0f,0x08,0x00,0x0d,0x10,0x4f,0x5c,0x00,0x10,0xf4,0x35,0x02,0x12,
+0xff,0x12,0x02,0x13,0xbf,0x21,0x02,0x19,0x0b,0x21,0x02,0x60,0xdf,0xff,0xfc,0x1b,
+0xb1,0xcf,0x98,0x02,0x4b,0xff,0xc2,0x2c,0xff,0x01,0x00,0x30,0xf0,0xe0,0xff,0xb5,
+0x00,0x01,0xa0,0x02,0xa1,0x04,0xef,0xff,0xff,0xff,0xfe,0x40,0x00,0x00,0x1e,0x11,
+0x00,0x50,0xe1,0x00,0x00,0xaf,0xb0,0x4e,0x00,0xe1,0xfa,0x00,0x05,0xff,0x10,0x00,
+0x00,0x00,0x01,0xff,0x50,0x1e,0xf6,0x00,0x1d,0x01,0x11,0xe1,0x1a,0x00,0x00,0x1c,
+0x00,0x40,0xff,0xff,0xff,0x70,0x71,0x01,0x01,0xf1,0x00,0x03,0xf0,0x00,0x0f,0x01,
+0x00,0x06,0x13,0x8f,0x08,0x00,0xf1,0x1d,0xf8,0x00,0x00,0x06,0xbd,0xda,0x50,0x02,
+0xff,0x00,0x05,0xef,0xff,0xff,0xfe,0x42,0xff,0x00,0x7f,0xff,0xa7,0x7b,0xff,0xf9,
+0xff,0x05,0xff,0xc1,0x00,0x00,0x2c,0xff,0xff,0x0e,0xfc,0x00,0x00,0x02,0x22,0xdf,
+0xff,0x5f,0xf2,0x00,0x54,0x00,0x22,0x8f,0xb0,0x08,0x00,0x1b,0x00,0x01,0x00,0x02,
+0x5d,0x01,0x22,0x0b,0xf8,0x08,0x00,0xd0,0x2f,0xf4,0xff,0xfd,0x22,0x20,0x00,0x00,
+0xcf,0xe0,0xff,0xff,0xc2,0x48,0x00,0xf5,0x08,0x40,0xff,0x9f,0xff,0xb7,0x6a,0xff,
+0xf7,0x00,0xff,0x24,0xdf,0xff,0xff,0xfe,0x50,0x00,0xff,0x20,0x05,0xac,0xdb,0x60,
+0x3f,0x00,0x10,0x8d,0x29,0x04,0x5e,0x00,0x00,0x8f,0xff,0xdf,0xad,0x00,0x01,0x14,
+0x00,0x02,0x57,0x02,0x22,0x09,0xff,0x2c,0x00,0x28,0x00,0x00,0x3a,0x00,0x02,0x3c,
+0x00,0x00,0x3e,0x00,0x02,0x12,0x05,0x20,0x01,0x50,0x36,0x00,0x21,0x06,0xf7,0x1c,
+0x05,0x11,0xbe,0x06,0x00,0x10,0xae,0x06,0x00,0x20,0x05,0xf8,0x4a,0x00,0x22,0x02,
+0x60,0x4c,0x00,0x03,0x4e,0x00,0x3a,0x00,0x00,0x9e,0xca,0x00,0x23,0x06,0x10,0x09,
+0x00,0x23,0x1f,0xd2,0x60,0x00,0x31,0x03,0xee,0x10,0x63,0x00,0x41,0x0a,0xb1,0x2f,
+0xb0,0x66,0x00,0x41,0x05,0xfc,0x07,0xf4,0x4b,0x00,0x42,0x50,0x5f,0x60,0xf9,0x6c,
+0x00,0x32,0x0d,0xc0,0xbd,0x69,0x00,0x33,0x09,0xf0,0x9f,0x09,0x00,0x24,0xe0,0x8f,
+0x1b,0x00,0x14,0xad,0x2d,0x00,0x11,0xe9,0x7b,0x00,0x41,0x05,0xfc,0x06,0xf4,0x7e,
+0x00,0x02,0x51,0x00,0x00,0x63,0x00,0x38,0x02,0xee,0x10,0x75,0x00,0x02,0x87,0x00,
+0x13,0x8f,0xa4,0x01,0x23,0xff,0xfc,0x09,0x01,0x21,0x20,0x2f,0x07,0x00,0x10,0xfc,
+0x79,0x04,0x12,0xee,0x10,0x00,0x60,0xfe,0x12,0xef,0xff,0xff,0xfc,0x24,0x02,0xe1,
+0x2e,0xff,0xff,0xfe,0x4e,0xfe,0x10,0x00,0x02,0xff,0xff,0xe1,0x02,0xc1,0x93,0x01,
+0x1b,0x10,0xac,0x02,0x09,0xfd,0x01,0x00,0xfc,0x01,0x20,0x4e,0x40,0x3b,0x02,0x11,
+0xfb,0x53,0x02,0x20,0xf1,0x00,0x9d,0x00,0x90,0x90,0x00,0x00,0x2f,0xff,0xff,0x30,
+0x00,0x0c,0x67,0x00,0x10,0x07,0x26,0x00,0x10,0x02,0x2c,0x00,0x11,0xf2,0xd5,0x00,
+0x20,0x9e,0xff,0x98,0x02,0x20,0xff,0x2f,0x06,0x00,0xf1,0x02,0xf2,0xbf,0xff,0xff,
+0xfe,0x9f,0xa1,0xbf,0xff,0xff,0x92,0xff,0xa2,0x2f,0xff,0xf2,0x04,0x03,0x03,0x43,
+0x02,0x9e,0xfe,0x92,0x6e,0x00,0xf0,0x06,0x30,0x00,0x01,0xcc,0xff,0x40,0x00,0x2d,
+0xff,0xff,0x40,0x03,0xef,0xff,0xff,0x40,0x3f,0xff,0xff,0xff,0x44,0x41,0x00,0x1a,
+0x9f,0xde,0x01,0x10,0xaf,0x05,0x00,0x10,0x45,0x05,0x00,0x34,0x40,0x4f,0xff,0x2d,
+0x00,0x00,0x37,0x00,0x00,0x41,0x00,0x08,0x99,0x01,0x23,0x8f,0x91,0xc7,0x00,0x12,
+0x70,0x07,0x00,0x22,0xfd,0x40,0xd5,0x00,0x22,0xfa,0x10,0xdc,0x00,0x13,0xf7,0xe3,
+0x00,0x13,0xd5,0xea,0x00,0x13,0xb2,0x4f,0x03,0x09,0x07,0x00,0x17,0xb2,0x23,0x00,
+0x12,0xf7,0x3f,0x00,0x17,0x20,0x4d,0x00,0x01,0x5b,0x00,0x3e,0x8e,0xa1,0x00,0x01,
+0x00,0x11,0x8f,0x26,0x04,0x00,0xe0,0x02,0x03,0x5f,0x00,0x0f,0x07,0x00,0x37,0x83,
+0x7f,0xff,0xf7,0x00,0x7f,0xff,0xf7,0x8f,0xee,0x01,0x0f,0x01,0x00,0x40,0x03,0x5b,
+0x00,0x01,0xc9,0x00,0xd1,0xcc,0x10,0x00,0x03,0xff,0xff,0xd2,0x00,0x04,0xff,0xff,
+0xfe,0x30,0xb6,0x01,0x10,0x04,0x1d,0x00,0x20,0x54,0xff,0x0c,0x01,0x0a,0x37,0x00,
+0x23,0xf9,0xff,0xb4,0x01,0x14,0xf3,0x2d,0x00,0x00,0x37,0x00,0x01,0x41,0x00,0x04,
+0x17,0x01,0x12,0x2d,0xb0,0x02,0x20,0x01,0xef,0x5a,0x06,0x00,0xd9,0x06,0x32,0xff,
+0xd1,0x00,0x22,0x07,0x26,0xfc,0x00,0x11,0x05,0x11,0xaf,0x5d,0x00,0x22,0x00,0x09,
+0x57,0x00,0x23,0x90,0x0f,0xf3,0x04,0x03,0xae,0x04,0x14,0x80,0x4d,0x00,0x12,0x0c,
+0x10,0x00,0x14,0xc0,0x20,0x00,0x04,0x08,0x00,0x03,0x18,0x00,0x00,0x7b,0x07,0x70,
+0x1a,0x40,0x00,0x00,0x01,0xdf,0xf0,0x6a,0x00,0x57,0xa0,0x00,0x01,0xdf,0xfa,0x09,
+0x00,0x80,0x0c,0xff,0xa0,0x00,0x00,0x0d,0xff,0x80,0x21,0x00,0x11,0xf8,0x8c,0x00,
+0x0b,0x0b,0x00,0x00,0x37,0x00,0x31,0x00,0x1b,0x50,0x5f,0x07,0x80,0x0f,0xfc,0x10,
+0x00,0x00,0x0a,0xff,0xc1,0x17,0x07,0x0d,0x0b,0x00,0x10,0xc0,0xef,0x03,0xa7,0xd0,
+0x00,0x00,0x8f,0xfd,0x10,0x00,0x08,0xff,0xd1,0x09,0x00,0x20,0x0f,0xfd,0x41,0x07,
+0x02,0x3a,0x08,0x32,0x04,0xff,0x40,0x7c,0x04,0x1f,0x80,0x07,0x00,0x04,0x7a,0x48,
+0x88,0x8c,0xff,0xc8,0x88,0x84,0x54,0x01,0x03,0x15,0x00,0x0f,0x38,0x00,0x09,0x03,
+0x5b,0x00,0x20,0x14,0x44,0x01,0x00,0x32,0x41,0xef,0xff,0x76,0x03,0x02,0x01,0x00,
+0x20,0x7b,0xbb,0x01,0x00,0x80,0xb7,0x00,0x00,0x05,0xad,0xff,0xda,0x50,0x2b,0x00,
+0x40,0xdf,0xfc,0x88,0xcf,0xbe,0x02,0xf0,0x12,0x7f,0xfe,0x40,0x00,0x04,0xef,0xf7,
+0x00,0x07,0xff,0xf4,0x00,0x9e,0x80,0x4f,0xff,0x70,0x4f,0xff,0xc0,0x00,0xaf,0xf8,
+0x0c,0xff,0xf4,0xdf,0xff,0x80,0x9a,0xff,0xfe,0x08,0xe1,0x09,0x21,0x80,0xef,0x09,
+0x00,0x50,0x4f,0xff,0xc0,0x8f,0xff,0x1b,0x00,0x50,0x07,0xff,0xf4,0x08,0xee,0x2d,
+0x00,0x03,0x3f,0x00,0x17,0xf8,0x51,0x00,0x04,0x63,0x00,0x25,0x8c,0x20,0x59,0x09,
+0x14,0xe4,0x0a,0x00,0x90,0x1b,0xff,0x80,0x49,0xdf,0xfd,0xa5,0x00,0x00,0x47,0x08,
+0x72,0xff,0xd8,0x8c,0xff,0xd4,0x00,0x00,0x3f,0x00,0x11,0x4e,0x44,0x03,0xf1,0x12,
+0x1c,0xff,0x69,0xe8,0x04,0xff,0xf7,0x00,0x04,0xe3,0x00,0x9f,0xfe,0xff,0x80,0xcf,
+0xff,0x40,0x0d,0xff,0x70,0x05,0xff,0xff,0xe0,0x8f,0xff,0xd0,0x0d,0xff,0xf7,0x00,
+0x2d,0x0a,0x00,0x10,0x04,0x25,0x02,0xb1,0xaf,0xf8,0xcf,0xff,0x30,0x00,0x7f,0xff,
+0x40,0x00,0x06,0x93,0x03,0x10,0x08,0x4a,0x07,0x10,0x3e,0xcc,0x01,0x80,0x00,0x4d,
+0xff,0xc8,0x82,0x01,0xbf,0xf7,0x66,0x00,0x74,0x5a,0xdf,0xfc,0x10,0x08,0xff,0xb0,
+0x80,0x00,0x15,0x4e,0xed,0x09,0x27,0x02,0xc8,0x87,0x02,0x07,0x8b,0x09,0x00,0x6a,
+0x09,0x01,0xca,0x08,0x00,0x14,0x02,0x00,0xcd,0x01,0x03,0xac,0x00,0x12,0xf7,0xb0,
+0x02,0x32,0xff,0xd8,0x8d,0x1f,0x05,0x41,0x0a,0xff,0xa0,0x0a,0x6d,0x00,0x20,0x00,
+0x3f,0xe7,0x09,0x12,0xf3,0xbe,0x02,0x42,0xc0,0x0c,0xff,0xfc,0x44,0x00,0x21,0xd0,
+0x0d,0x48,0x00,0x12,0x0e,0xc2,0x08,0x20,0xe0,0x00,0x96,0x05,0x20,0xe2,0x2e,0x4d,
+0x03,0x10,0x02,0xcb,0x02,0x00,0xd3,0x02,0xb5,0x10,0x0a,0xff,0xff,0xff,0xe3,0x3e,
+0xff,0xff,0xff,0xa0,0x77,0x07,0x04,0xdc,0x02,0x07,0xde,0x02,0x02,0x01,0x00,0x14,
+0xd8,0x31,0x07,0x10,0x80,0x6e,0x04,0x11,0x07,0xf1,0x03,0x00,0x77,0x08,0xf1,0x0a,
+0xff,0xfd,0x78,0x8e,0xff,0x15,0xff,0xe8,0xff,0xe2,0x00,0x02,0xe5,0x4f,0xfe,0x20,
+0xfe,0x20,0x00,0x00,0x13,0xff,0xf3,0x00,0x52,0x9a,0x00,0x10,0x31,0x08,0x00,0xb0,
+0x02,0xef,0xf4,0x5e,0x20,0xfe,0x20,0x78,0x8e,0xff,0x51,0x28,0x00,0x04,0x38,0x00,
+0x04,0x48,0x00,0x04,0x58,0x00,0x0a,0x68,0x00,0x07,0x01,0x00,0x23,0x01,0xdd,0xa4,
+0x03,0x20,0xd1,0x00,0x0e,0x03,0x30,0xff,0xfd,0x10,0x0d,0x00,0xf0,0x05,0x99,0xff,
+0xd1,0x00,0x01,0xdf,0xf9,0x00,0x9f,0xfd,0x10,0x1d,0xff,0x90,0x00,0x09,0xff,0xd1,
+0xbf,0xf9,0x0b,0x06,0x30,0xfb,0x5f,0x90,0x24,0x07,0x1a,0xf5,0x44,0x00,0x03,0x15,
+0x00,0x03,0x23,0x00,0x03,0x31,0x00,0x03,0x3f,0x00,0x03,0x4d,0x00,0x04,0x5b,0x00,
+0x03,0x69,0x00,0x04,0x77,0x00,0x0c,0x01,0x00,0x24,0x1d,0xd1,0x97,0x00,0x40,0xdf,
+0xfd,0x10,0xef,0x16,0x0a,0x01,0x3e,0x04,0x11,0xaf,0x42,0x08,0x40,0xcf,0xcf,0xfc,
+0xfc,0xa6,0x03,0x62,0xf0,0x00,0x6b,0x1f,0xf1,0xb6,0x0a,0x00,0x01,0x04,0x00,0x0f,
+0x0a,0x00,0x02,0x01,0x24,0x00,0x01,0x0a,0x00,0x01,0x38,0x00,0x10,0x0f,0x6d,0x04,
+0x01,0x8a,0x04,0x10,0x0d,0x3a,0x03,0x00,0x60,0x00,0x0c,0x74,0x00,0x02,0xd2,0x05,
+0x02,0xa0,0x00,0x00,0x1d,0x06,0x16,0x10,0x20,0x07,0x0f,0x81,0x05,0x2e,0x06,0x5f,
+0x07,0x03,0x10,0x0c,0x05,0x95,0x02,0x04,0x0f,0x0a,0x03,0x1f,0x0a,0x04,0x1e,0x05,
+0x04,0x3f,0x0a,0x0f,0x6f,0x0a,0x14,0x60,0xdf,0xff,0xf0,0xdf,0xfd,0x0f,0xf8,0x01,
+0x01,0x65,0x0b,0x0f,0x47,0x0a,0x07,0x09,0x01,0x00,0x32,0x0a,0xea,0x62,0x30,0x03,
+0x01,0xa1,0x09,0x01,0xec,0x07,0x02,0x55,0x00,0x13,0x0f,0x1e,0x03,0x23,0x02,0xff,
+0x02,0x0d,0x43,0x03,0xef,0xff,0x70,0xe1,0x04,0x1a,0xf2,0x54,0x03,0x60,0x6f,0xff,
+0x30,0x00,0x00,0x02,0xb1,0x00,0xf0,0x00,0x90,0x00,0x02,0x8f,0xf3,0x00,0x6f,0xff,
+0xd0,0x00,0x0a,0xff,0xff,0xe4,0xbf,0x49,0x01,0x01,0xa8,0x04,0x10,0xd1,0x51,0x03,
+0x00,0x18,0x03,0x01,0x2e,0x00,0x31,0xff,0xfb,0x30,0x59,0x00,0x31,0xdb,0x72,0x00,
+0xdd,0x04,0x70,0xee,0x80,0x00,0x00,0x06,0x61,0x08,0x14,0x03,0xf0,0x02,0x2d,0xff,
+0xd0,0xef,0x33,0xfe,0x00,0x2e,0xff,0xf3,0x0e,0xf3,0x3f,0xe0,0x2e,0xff,0xf3,0x8f,
+0x01,0x10,0x6e,0x7f,0x03,0x10,0x8e,0x70,0x06,0x10,0x00,0xee,0x02,0x02,0x8d,0x03,
+0x20,0x2e,0xff,0x76,0x00,0x10,0x08,0x5f,0x00,0x10,0x30,0xe0,0x0a,0xc0,0xf6,0xef,
+0xff,0x30,0x00,0xef,0x33,0xfe,0x02,0xef,0xff,0x30,0x3c,0x00,0x00,0x08,0x00,0x10,
+0x8f,0x8f,0x03,0xa1,0xdf,0xfd,0x00,0x8e,0xe8,0x00,0x00,0x00,0x66,0x10,0xd6,0x0e,
+0x12,0x0d,0x17,0x08,0x22,0x0f,0xd1,0x07,0x00,0x30,0xfd,0xdf,0xf0,0x32,0x09,0x33,
+0x00,0xff,0xf0,0x29,0x01,0x0f,0x07,0x00,0x1e,0x11,0xdf,0x46,0x08,0x16,0xf9,0x4c,
+0x09,0x90,0x00,0x00,0xdf,0xff,0xff,0xff,0xfd,0x00,0x00,0x80,0x8f,0xff,0xff,0xff,
+0xff,0xc1,0x00,0xff,0x01,0x00,0x90,0xfd,0x10,0xff,0x00,0x00,0x00,0x01,0xff,0xd1,
+0x07,0x00,0x32,0x00,0xff,0xfc,0x07,0x00,0x14,0xff,0x07,0x00,0x0b,0x01,0x00,0x30,
+0xfb,0x11,0xbf,0x07,0x00,0x37,0xf1,0x00,0x1f,0x07,0x00,0x03,0x15,0x00,0x01,0x01,
+0x00,0x11,0x8f,0x06,0x00,0x30,0xf8,0x12,0x22,0x01,0x00,0x1a,0x21,0x3d,0x00,0x03,
+0x15,0x00,0x12,0x00,0x01,0x00,0x0f,0x23,0x00,0x2c,0x22,0x8f,0xff,0x6a,0x00,0x04,
+0x17,0x00,0x12,0xcf,0x07,0x00,0x22,0xfc,0x09,0x08,0x00,0x30,0x90,0xd2,0x5f,0x07,
+0x00,0xf1,0x09,0xf5,0x2d,0xff,0x62,0xcf,0xff,0xff,0xfc,0x26,0xff,0xff,0xfa,0x18,
+0xff,0xff,0x81,0xaf,0xff,0xff,0xff,0xe3,0x4d,0xd4,0x3e,0x24,0x00,0x3e,0x81,0x18,
+0xff,0x01,0x00,0x04,0x58,0x00,0x40,0x00,0xdf,0xff,0xfd,0x18,0x01,0xf0,0x08,0xff,
+0xfc,0x00,0x00,0x03,0xff,0xff,0xf7,0x00,0x00,0x06,0xff,0xff,0xf2,0x00,0x00,0x08,
+0xff,0xff,0xd0,0x00,0x00,0x0a,0x24,0x00,0x20,0xd0,0x0c,0x06,0x00,0x20,0xa0,0x0e,
+0x06,0x00,0x21,0x20,0x0d,0x35,0x00,0x00,0x1a,0x00,0xc0,0xe0,0x00,0x00,0x00,0x0e,
+0xff,0x50,0x00,0x00,0x00,0x2f,0xfc,0xc6,0x00,0x20,0x5f,0xf3,0x06,0x00,0x20,0x9f,
+0xa0,0x06,0x00,0x20,0xdf,0x10,0x06,0x00,0x10,0xd7,0x05,0x00,0x30,0x04,0xde,0x40,
+0x11,0x00,0x40,0xff,0x99,0xff,0xfd,0x6a,0x01,0x33,0x99,0xff,0xff,0x71,0x01,0x00,
+0x07,0x00,0x12,0x90,0x7f,0x01,0xc2,0x0d,0xff,0xff,0x0d,0x10,0xff,0xff,0x0f,0xff,
+0xff,0x0f,0xd1,0x07,0x00,0x11,0xfd,0x07,0x00,0x21,0x20,0x00,0x07,0x00,0x2a,0xff,
+0xff,0x07,0x00,0x32,0xdf,0xff,0x0f,0x41,0x00,0x0a,0x07,0x00,0x30,0x0d,0xff,0xff,
+0x64,0x00,0x21,0x00,0xcc,0x55,0x01,0x30,0x02,0xff,0x30,0xf1,0x01,0xe2,0xbf,0xff,
+0xfc,0x20,0x00,0x00,0x1e,0xff,0xff,0xff,0xe1,0x00,0x00,0x9f,0xbd,0x00,0x12,0xef,
+0x29,0x00,0x02,0x86,0x00,0x12,0x01,0x07,0x00,0x11,0x03,0x07,0x00,0x21,0x30,0x08,
+0x07,0x00,0x21,0x80,0x1e,0x07,0x00,0x22,0xe1,0xcf,0x6c,0x01,0x03,0x07,0x00,0x03,
+0xae,0x01,0x00,0xf6,0x00,0x11,0xe0,0xda,0x00,0x6a,0xee,0x40,0x00,0x00,0x8f,0xff,
+0xa1,0x01,0x00,0x4c,0x00,0x20,0xf0,0x0f,0x03,0x00,0x07,0x09,0x00,0x05,0x01,0x00,
+0x77,0xf8,0x08,0x80,0x88,0x08,0x80,0x8f,0x09,0x00,0x07,0x36,0x00,0x57,0x00,0x00,
+0x00,0x0f,0x00,0x09,0x00,0x0b,0xab,0x01,0x01,0x77,0x01,0x08,0x01,0x00,0x41,0x03,
+0xaf,0x70,0x00,0x88,0x00,0x30,0xcf,0xff,0xf0,0x08,0x00,0x40,0x06,0xdf,0xff,0xff,
+0x7e,0x01,0x40,0x17,0xef,0xff,0xff,0xfd,0x00,0x13,0x18,0xb6,0x00,0x11,0x2a,0x3e,
+0x00,0x21,0xf4,0x00,0xdc,0x00,0x00,0xd7,0x01,0x03,0x4c,0x01,0x13,0x60,0x12,0x00,
+0x12,0xfe,0x4f,0x00,0x01,0xfd,0x01,0x02,0x09,0x00,0x14,0xf1,0x09,0x00,0x14,0x80,
+0x09,0x00,0x13,0x10,0x09,0x00,0x23,0xfa,0x00,0x09,0x00,0x13,0xf2,0x09,0x00,0x28,
+0x8f,0x80,0x93,0x00,0x50,0xdf,0xff,0xff,0xf0,0xd1,0xbb,0x00,0x30,0xf0,0xfd,0x10,
+0x06,0x00,0x21,0xff,0xd1,0x06,0x00,0x21,0xfd,0xff,0x54,0x02,0x1f,0xff,0x01,0x00,
+0x28,0x11,0xdf,0xc5,0x03,0x08,0x6c,0x00,0x50,0x04,0x9c,0xef,0xfe,0xc9,0x5c,0x02,
+0x21,0x07,0xef,0xc6,0x00,0xf0,0x00,0x70,0x00,0x04,0xdf,0xff,0xfc,0xa8,0x8a,0xcf,
+0xff,0xfd,0x40,0x6f,0xff,0xd5,0x23,0x00,0x52,0x5d,0xff,0xf6,0xcf,0xf6,0x2e,0x00,
+0xf0,0x00,0x6f,0xfc,0x1a,0x30,0x00,0x5a,0xdf,0xfd,0xa5,0x00,0x03,0xa1,0x00,0x00,
+0x4d,0x32,0x00,0xa0,0xd4,0x00,0x00,0x00,0x05,0xff,0xfe,0xa8,0x8a,0xef,0xc6,0x02,
+0x80,0x01,0xdf,0x70,0x00,0x00,0x07,0xfd,0x10,0x90,0x03,0x00,0x31,0x00,0x03,0x9d,
+0x03,0x24,0x4e,0xe4,0x70,0x00,0x2e,0xef,0xfe,0x0a,0x00,0x02,0x1e,0x00,0x05,0xc7,
+0x01,0x15,0x80,0xaf,0x00,0x23,0xf0,0xff,0x22,0x00,0x27,0x0f,0xfd,0xbb,0x02,0x03,
+0x0a,0x00,0x06,0xd6,0x02,0x09,0xe0,0x02,0x06,0x32,0x00,0x05,0x46,0x00,0x06,0x5a,
+0x00,0x0f,0x64,0x00,0x11,0x24,0xf0,0x00,0x64,0x00,0x10,0xf0,0x6d,0x01,0x0d,0x0a,
+0x00,0x0f,0x64,0x00,0x30,0x24,0x00,0x00,0x64,0x00,0x02,0x18,0x02,0x0d,0x0a,0x00,
+0x0f,0x64,0x00,0x2e,0x24,0xf0,0x00,0x64,0x00,0x13,0xf0,0x7c,0x02,0x0d,0x0a,0x00,
+0x0f,0x64,0x00,0x2c,0x04,0x0a,0x00,0x05,0x46,0x00,0x1e,0x00,0x0a,0x00,0x0f,0x64,
+0x00,0x0e,0x01,0x1b,0x00,0x15,0x01,0x8d,0x02,0x02,0x39,0x02,0x00,0x13,0x00,0x33,
+0xcf,0xff,0xf5,0x14,0x00,0x33,0xb9,0x29,0xfe,0x15,0x00,0x31,0x3f,0x10,0x02,0xb1,
+0x03,0x40,0xdf,0x80,0x0a,0x90,0x08,0x00,0xf3,0x1a,0x70,0x00,0xdf,0xff,0x77,0xf7,
+0x55,0x55,0x55,0x55,0x8f,0xd3,0x0f,0xff,0xfd,0xcc,0xdf,0xdc,0xcc,0xcc,0xcd,0xff,
+0xb0,0x8f,0xfe,0x10,0x00,0xaa,0x00,0x00,0x00,0x4d,0x40,0x00,0x46,0x10,0x00,0x01,
+0xf2,0x02,0x33,0x40,0x00,0x43,0x09,0xb1,0xcf,0xf9,0x55,0x00,0x13,0x0a,0x35,0x05,
+0x00,0x01,0x00,0x24,0xbf,0xf9,0x0a,0x00,0x20,0x01,0x22,0x06,0x00,0xf0,0x1e,0x18,
+0xdf,0xfd,0x92,0x00,0x02,0xef,0xfb,0xef,0xff,0x40,0x0d,0xff,0xfa,0x2e,0xff,0xe0,
+0x4f,0xff,0xfa,0x03,0xff,0xf5,0x9f,0xfa,0xfa,0x35,0x4f,0xfa,0xcf,0xc0,0x8a,0x3d,
+0x0b,0xfd,0xef,0xfb,0x03,0x11,0x8f,0xfe,0xff,0xff,0xb0,0x06,0xc6,0x00,0xf0,0x22,
+0xd1,0x08,0xff,0xff,0xef,0xfd,0x11,0x10,0x9f,0xff,0xdf,0xd1,0x59,0x3b,0x0b,0xfd,
+0xaf,0xd6,0xfa,0x37,0x1d,0xfb,0x5f,0xff,0xfa,0x01,0xdf,0xf7,0x0d,0xff,0xfa,0x1d,
+0xff,0xf1,0x03,0xef,0xfc,0xdf,0xff,0x50,0x00,0x18,0xdf,0xfe,0xa3,0x00,0x00,0x00,
+0x7f,0x23,0x04,0x12,0xef,0x35,0x04,0x18,0xef,0x3c,0x04,0x03,0x53,0x04,0x14,0xf0,
+0x07,0x00,0xcf,0xf9,0x9f,0x99,0xf9,0x9f,0xf0,0x0f,0xf8,0x8f,0x88,0xf8,0x8f,0x07,
+0x00,0x12,0x03,0x31,0x00,0x02,0x3f,0x00,0x17,0x08,0x63,0x01,0x33,0x00,0x7f,0xa0,
+0x08,0x00,0x21,0xff,0xb0,0x08,0x00,0x12,0x0d,0xe5,0x04,0x32,0x00,0x7a,0x1d,0xa2,
+0x01,0x51,0x7f,0xfa,0x1d,0xff,0x70,0x20,0x00,0x22,0xfa,0x1d,0x08,0x00,0x01,0xa5,
+0x04,0x00,0x08,0x00,0x2f,0xff,0x70,0x08,0x00,0x08,0x13,0x6f,0x08,0x00,0x13,0x0b,
+0x08,0x00,0x23,0x00,0xdf,0x08,0x00,0x13,0x0e,0x08,0x00,0x5b,0x00,0xde,0xdb,0x60,
+0x00,0x01,0x00,0x12,0x1b,0xfe,0x01,0x53,0xe4,0x00,0x01,0xdf,0xff,0x00,0x01,0xa0,
+0x1d,0xff,0xff,0xfa,0xef,0xfe,0xaf,0xff,0xff,0x01,0x7f,0x05,0xd2,0x2e,0xe2,0x0a,
+0xff,0xff,0x1d,0xff,0xff,0xff,0xe2,0x02,0x20,0x2e,0xae,0x07,0x48,0xfe,0x20,0x02,
+0xef,0x0a,0x00,0x06,0x1e,0x00,0x06,0x32,0x00,0x06,0x46,0x00,0x07,0x5a,0x00,0x06,
+0x6e,0x00,0x11,0x07,0x06,0x00,0x10,0x7f,0x16,0x00,0x71,0x07,0xf8,0x0f,0x0b,0x40,
+0xff,0x7f,0x06,0x00,0x12,0xff,0x06,0x00,0x0f,0x01,0x00,0x22,0x02,0x34,0x05,0x12,
+0x4e,0x60,0x00,0x19,0x00,0xce,0x02,0x50,0x03,0xe0,0x00,0x00,0x10,0x42,0x07,0x41,
+0xef,0x10,0x00,0xbf,0x4b,0x01,0x40,0xf1,0x00,0xcf,0xf1,0xe5,0x02,0xb3,0xff,0x11,
+0xcf,0xff,0x77,0x77,0x77,0x77,0xbf,0xf1,0xcf,0x47,0x00,0x13,0x17,0x08,0x00,0x24,
+0xe0,0x07,0x35,0x06,0x14,0x06,0x2c,0x06,0x80,0x05,0xa0,0x00,0x00,0x00,0x00,0x00,
+0x00,
+};
+
+static const etxFontBlock blocks[] = {
+{ .bitmap_index = 0, .comp_offset = 0, .size = 4079, .comp_size = 3398 },
+{ .bitmap_index = 4079, .comp_offset = 3398, .size = 4053, .comp_size = 3360 },
+{ .bitmap_index = 8132, .comp_offset = 6758, .size = 4004, .comp_size = 3167 },
+{ .bitmap_index = 12136, .comp_offset = 9925, .size = 4078, .comp_size = 2834 },
+{ .bitmap_index = 16214, .comp_offset = 12759, .size = 4030, .comp_size = 2982 },
+{ .bitmap_index = 20244, .comp_offset = 15741, .size = 4046, .comp_size = 3313 },
+{ .bitmap_index = 24290, .comp_offset = 19054, .size = 4029, .comp_size = 3146 },
+{ .bitmap_index = 28319, .comp_offset = 22200, .size = 4075, .comp_size = 3466 },
+{ .bitmap_index = 32394, .comp_offset = 25666, .size = 4084, .comp_size = 3373 },
+{ .bitmap_index = 36478, .comp_offset = 29039, .size = 4036, .comp_size = 3462 },
+{ .bitmap_index = 40514, .comp_offset = 32501, .size = 4019, .comp_size = 3567 },
+{ .bitmap_index = 44533, .comp_offset = 36068, .size = 4064, .comp_size = 3498 },
+{ .bitmap_index = 48597, .comp_offset = 39566, .size = 4036, .comp_size = 3468 },
+{ .bitmap_index = 52633, .comp_offset = 43034, .size = 4009, .comp_size = 2321 },
+{ .bitmap_index = 56642, .comp_offset = 45355, .size = 2438, .comp_size = 1222 },
 };
 
 static const etxFontCmap cmaps[] = {
@@ -3053,11 +3307,11 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 12527, .range_length = 51124, .glyph_id_start = 233, .list_length = 349, .type = 3, .unicode_list = 4801, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[80621] __SDRAMFONTS;
+static uint8_t etxUncompBuf[21541] __SDRAMFONTS;
 
 const etxLz4Font lv_font_jp_bold_STD = {
-.uncomp_size = 80261,
-.comp_size = 48610,
+.uncomp_size = 21181,
+.comp_size = 5750,
 .line_height = 19,
 .base_line = 4,
 .subpx = 0,
@@ -3070,12 +3324,15 @@ const etxLz4Font lv_font_jp_bold_STD = {
 .bitmap_format = 0,
 .left_class_cnt = 122,
 .right_class_cnt = 119,
-.glyph_bitmap = 5499,
-.class_pair_values = 64579,
-.left_class_mapping = 79097,
-.right_class_mapping = 79679,
+.glyph_bitmap = 0,
+.class_pair_values = 5499,
+.left_class_mapping = 20017,
+.right_class_mapping = 20599,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 80621,
+.lvglFontBufSize = 21541,
+.block_count = 15,
+.blocks = blocks,
+.compressed_bitmap = lz4BitmapData,
 };
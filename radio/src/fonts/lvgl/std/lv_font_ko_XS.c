@@ -210,217 +210,260 @@ static const uint8_t lz4FontData[] ={
 0x00,0x0d,0x88,0x08,0x00,0x13,0x5a,0x08,0x00,0x13,0xa7,0x08,0x00,0x13,0xf4,0x08,
 0x00,0x22,0x41,0x89,0xa8,0x00,0xa2,0x9f,0x89,0x60,0x0b,0x0b,0x0e,0x00,0xfe,0xec,
 0x89,0x60,0x00,0x22,0x40,0x8a,0xa8,0x00,0xa2,0xa2,0x8a,0x40,0x10,0x11,0x0a,0x00,
-0x00,0xf7,0x8a,0x60,0x00,0x60,0x3d,0x8b,0x10,0x0d,0x0e,0x09,0x98,0x13,0xf0,0xff,
-0xff,0xff,0xff,0xc9,0x72,0x1f,0xb5,0x21,0x50,0xab,0x54,0xab,0x58,0xab,0x60,0xab,
-0x62,0xab,0x65,0xab,0x69,0xab,0x6c,0xab,0x81,0xab,0xc0,0xab,0xc4,0xab,0xd0,0xab,
-0xdc,0xab,0xf0,0xab,0xf8,0xab,0xf9,0xab,0x00,0xac,0x0d,0xac,0x14,0xac,0x30,0xac,
-0x31,0xac,0x41,0xac,0x45,0xac,0x4c,0xac,0x50,0xac,0xa0,0xac,0xbc,0xac,0xbd,0xac,
-0xc5,0xac,0xdc,0xac,0x10,0xad,0x2c,0xad,0x30,0xad,0x48,0xad,0x49,0xad,0x4c,0xad,
-0x50,0xad,0x59,0xad,0x80,0xad,0x88,0xad,0x91,0xad,0x9c,0xad,0x0c,0xae,0x08,0xaf,
-0x94,0xaf,0xa4,0xaf,0xad,0xaf,0xe8,0xaf,0xf0,0xaf,0xf8,0xaf,0x04,0xb0,0x58,0xb0,
-0x60,0xb0,0x73,0xb0,0x74,0xb0,0xc8,0xb0,0xe2,0xb0,0x54,0xb1,0x5c,0xb1,0xc4,0xb1,
-0xe0,0xb1,0xe4,0xb1,0xf5,0xb1,0x18,0xb2,0x28,0xb2,0x29,0xb2,0x34,0xb2,0x38,0xb2,
-0x45,0xb2,0x50,0xb2,0xa4,0xb2,0xac,0xb2,0xbe,0xb2,0xc0,0xb2,0xc1,0xb2,0xc4,0xb2,
-0xc8,0xb2,0x14,0xb3,0x15,0xb3,0x29,0xb3,0x68,0xb3,0x6c,0xb3,0x78,0xb3,0xa0,0xb3,
-0xa8,0xb3,0xf4,0xb3,0x10,0xb4,0x18,0xb4,0x2c,0xb4,0x2d,0xb4,0x30,0xb4,0x34,0xb4,
-0x41,0xb4,0x64,0xb4,0x79,0xb4,0x80,0xb4,0x9c,0xb4,0x60,0xb5,0xec,0xb5,0x40,0xb6,
-0xcc,0xb6,0xd0,0xb6,0xdc,0xb6,0xe1,0xb6,0xe8,0xb6,0xe9,0xb6,0x19,0xb7,0x3c,0xb7,
-0x4c,0xb7,0x4d,0xb7,0x58,0xb7,0x59,0xb7,0x5c,0xb7,0x74,0xb7,0x75,0xb7,0x7c,0xb7,
-0xac,0xb7,0xad,0xb7,0xb0,0xb7,0xb4,0xb7,0xbf,0xb7,0x1c,0xb8,0x38,0xb8,0x49,0xb8,
-0xa8,0xb8,0xb8,0xb8,0xc4,0xb8,0xc8,0xb8,0xcc,0xb8,0xd4,0xb8,0xfc,0xb8,0xfd,0xb8,
-0x00,0xb9,0x0c,0xb9,0x0d,0xb9,0x0f,0xb9,0x11,0xb9,0x18,0xb9,0x19,0xb9,0x1c,0xb9,
-0x1e,0xb9,0x20,0xb9,0x2e,0xb9,0x34,0xb9,0x45,0xb9,0x47,0xb9,0x88,0xb9,0x8c,0xb9,
-0x90,0xb9,0xa4,0xb9,0xc4,0xb9,0xd5,0xb9,0xf8,0xb9,0xf9,0xb9,0x0b,0xba,0x84,0xba,
-0x88,0xba,0xfc,0xba,0x48,0xbb,0x49,0xbb,0x50,0xbb,0x5b,0xbb,0x5d,0xbb,0x5f,0xbb,
-0x64,0xbb,0x65,0xbb,0x68,0xbb,0x6c,0xbb,0x6d,0xbb,0x79,0xbb,0x80,0xbb,0x81,0xbb,
-0xd4,0xbb,0xd8,0xbb,0xdc,0xbb,0xe4,0xbb,0xe5,0xbb,0xf0,0xbb,0xf8,0xbb,0x10,0xbc,
-0x14,0xbc,0x44,0xbc,0x45,0xbc,0x48,0xbc,0x4c,0xbc,0x57,0xbc,0xd0,0xbc,0xd4,0xbc,
-0xd8,0xbc,0xe9,0xbc,0x40,0xbd,0x5c,0xbd,0x64,0xbd,0x94,0xbd,0x98,0xbd,0x9c,0xbd,
-0xb0,0xbd,0xb8,0xbd,0xe0,0xbf,0xfc,0xbf,0xfd,0xbf,0x00,0xc0,0x0d,0xc0,0x11,0xc0,
-0x18,0xc0,0x19,0xc0,0x28,0xc0,0x2d,0xc0,0x47,0xc0,0x6c,0xc0,0x6d,0xc0,0x70,0xc0,
-0x74,0xc0,0x81,0xc0,0x88,0xc0,0x89,0xc0,0x8c,0xc0,0x90,0xc0,0x9b,0xc0,0xa8,0xc0,
-0xdc,0xc0,0xdd,0xc0,0xe0,0xc0,0xf1,0xc0,0x30,0xc1,0x68,0xc1,0x6c,0xc1,0x7b,0xc1,
-0xf4,0xc1,0xfc,0xc1,0x05,0xc2,0x09,0xc2,0x2c,0xc2,0x2d,0xc2,0x30,0xc2,0x34,0xc2,
-0x3c,0xc2,0x41,0xc2,0x48,0xc2,0x40,0xc4,0x94,0xc4,0x95,0xc4,0x98,0xc4,0x9a,0xc4,
-0x9c,0xc4,0xa4,0xc4,0xa5,0xc4,0xa9,0xc4,0xae,0xc4,0xc0,0xc4,0xcc,0xc4,0xe1,0xc4,
-0x04,0xc5,0x08,0xc5,0x0c,0xc5,0x15,0xc5,0x16,0xc5,0x18,0xc5,0x20,0xc5,0x28,0xc5,
-0x3c,0xc5,0x3d,0xc5,0x40,0xc5,0x44,0xc5,0x51,0xc5,0x58,0xc5,0x74,0xc5,0x78,0xc5,
-0x7c,0xc5,0x85,0xc5,0x90,0xc5,0x94,0xc5,0xc8,0xc5,0xcc,0xc5,0xe4,0xc5,0xf9,0xc5,
-0x00,0xc6,0x04,0xc6,0x08,0xc6,0x10,0xc6,0x13,0xc6,0x1c,0xc6,0x20,0xc6,0x24,0xc6,
-0x38,0xc6,0x54,0xc6,0x70,0xc6,0x78,0xc6,0x8c,0xc6,0x90,0xc6,0x94,0xc6,0x9c,0xc6,
-0xa1,0xc6,0xa8,0xc6,0xc4,0xc6,0xc5,0xc6,0xc8,0xc6,0xcc,0xc6,0xcd,0xc6,0xd4,0xc6,
-0xd5,0xc6,0xd8,0xc6,0xe0,0xc6,0xe1,0xc6,0xe4,0xc6,0xe8,0xc6,0xf5,0xc6,0xfc,0xc6,
-0xfd,0xc6,0x50,0xc7,0x51,0xc7,0x54,0xc7,0x58,0xc7,0x60,0xc7,0x61,0xc7,0x65,0xc7,
-0x6c,0xc7,0x7f,0xc7,0x88,0xc7,0xc0,0xc7,0xc1,0xc7,0xc4,0xc7,0xd5,0xc7,0xdc,0xc7,
-0x4c,0xc8,0x50,0xc8,0x61,0xc8,0xd9,0xc8,0xe0,0xc8,0xed,0xc8,0x10,0xc9,0x11,0xc9,
-0x14,0xc9,0x20,0xc9,0x21,0xc9,0x2c,0xc9,0x48,0xc9,0x49,0xc9,0x0d,0xca,0x5d,0xcb,
-0x78,0xcb,0x88,0xcb,0x8c,0xcb,0x8e,0xcb,0x94,0xcb,0xfb,0xcb,0xfd,0xcb,0x04,0xcc,
-0x58,0xcc,0xac,0xcc,0xe4,0xcc,0xe5,0xcc,0xe8,0xcc,0xec,0xcc,0xf9,0xcc,0x38,0xcd,
-0x71,0xcd,0xa8,0xcd,0xbd,0xcd,0xc4,0xcd,0xe0,0xcd,0x34,0xce,0x38,0xce,0x3c,0xce,
-0x44,0xce,0x47,0xce,0x50,0xce,0x6c,0xce,0x7c,0xce,0xa4,0xce,0xac,0xce,0xbc,0xcf,
-0xc4,0xcf,0xcc,0xcf,0xf4,0xcf,0xfc,0xcf,0x10,0xd0,0x18,0xd0,0x20,0xd0,0x2c,0xd0,
-0x2d,0xd0,0x3d,0xd0,0x80,0xd0,0x84,0xd0,0x88,0xd0,0x90,0xd0,0x9c,0xd0,0x9d,0xd0,
-0xa0,0xd0,0xa4,0xd0,0xac,0xd0,0xf0,0xd0,0xf4,0xd0,0x05,0xd1,0x7c,0xd1,0x08,0xd2,
-0x09,0xd2,0x0c,0xd2,0x10,0xd2,0x40,0xd2,0x41,0xd2,0x5c,0xd2,0x6d,0xd2,0x78,0xd2,
-0xd4,0xd2,0xdc,0xd2,0xe8,0xd2,0xe9,0xd2,0x08,0xd3,0x19,0xd3,0x3c,0xd3,0x44,0xd3,
-0xac,0xd3,0xc8,0xd3,0x54,0xd4,0x5c,0xd4,0x8c,0xd4,0x90,0xd4,0x94,0xd4,0xa1,0xd4,
-0xa8,0xd4,0xa9,0xd4,0xac,0xd4,0xb0,0xd4,0xb8,0xd4,0xb9,0xd4,0xbd,0xd4,0xc4,0xd4,
-0xd9,0xd4,0xf5,0xd4,0x18,0xd5,0x28,0xd5,0x2d,0xd5,0x3c,0xd5,0x54,0xd5,0x65,0xd5,
-0x88,0xd5,0x90,0xd5,0x9d,0xd5,0xa4,0xd5,0xa5,0xd5,0xa8,0xd5,0xac,0xd5,0xb9,0xd5,
-0xdc,0xd5,0xf8,0xd5,0x14,0xd6,0x70,0xd6,0x84,0xd6,0xc0,0xd6,0xd8,0xd6,0x51,0xef,
-0x58,0xef,0x5b,0xef,0x5c,0xef,0x5d,0xef,0x61,0xef,0x63,0xef,0x65,0xef,0x69,0xef,
-0x6c,0xef,0x71,0xef,0x76,0xef,0x77,0xef,0x78,0xef,0x8e,0xef,0x93,0xef,0x98,0xef,
-0x9b,0xef,0x9c,0xef,0x9d,0xef,0xa1,0xef,0xa2,0xef,0xa3,0xef,0xa4,0xef,0xb7,0xef,
-0xb8,0xef,0xbe,0xef,0xc0,0xef,0xc1,0xef,0xc4,0xef,0xc7,0xef,0xc8,0xef,0xc9,0xef,
-0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,0x15,0xf0,0x17,0xf0,0x19,0xf0,0x30,0xf0,
-0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,0x74,0xf0,0xab,0xf0,0x3b,0xf1,0x90,0xf1,
-0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,0x54,0xf2,
-0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0xe4,0xe4,0xe4,0xe3,0xe3,0xd3,0x82,0x30,0xd4,0x2c,
-0x67,0x2b,0x66,0x29,0x65,0x01,0x00,0x00,0x09,0x50,0xe0,0x00,0x0d,0x13,0xa0,0x0a,
-0xef,0xef,0xec,0x00,0x3a,0x0a,0x40,0x00,0x77,0x0d,0x00,0x3d,0xfe,0xdf,0xd4,0x00,
-0xd1,0x3a,0x00,0x00,0xe0,0x68,0x00,0x02,0xc0,0x95,0x00,0x00,0x0a,0x40,0x00,0x05,
-0xda,0x20,0x08,0xd7,0xae,0x10,0xe4,0x00,0xc6,0x0d,0x70,0x03,0x20,0x5f,0xa4,0x00,
-0x00,0x28,0xeb,0x00,0x00,0x01,0xd7,0x3f,0x00,0x09,0x80,0xd9,0x46,0xf4,0x01,0x9f,
-0xb4,0x00,0x00,0xc2,0x00,0x0a,0xcb,0x00,0x00,0x04,0xa0,0x86,0x09,0x10,0x4a,0x08,
-0x64,0x90,0x00,0x8c,0xa1,0xc0,0x00,0x00,0x00,0xa4,0x00,0x00,0x00,0x4a,0x3b,0xb4,
-0x00,0x1c,0x1c,0x21,0xd0,0x09,0x50,0xc2,0x0d,0x00,0x00,0x04,0xcc,0x50,0x00,0xbf,
-0xd4,0x00,0x00,0x7c,0x06,0xd0,0x00,0x08,0xb0,0x7b,0x00,0x00,0x1e,0xbc,0x10,0x00,
-0x03,0xef,0x40,0x22,0x01,0xf4,0x4e,0x2a,0x60,0x5d,0x00,0x7d,0xe2,0x01,0xf3,0x01,
-0xee,0x00,0x04,0xcd,0xd8,0xc9,0x00,0x59,0x58,0x58,0x00,0x00,0x02,0x00,0x02,0xd1,
-0x00,0xd3,0x00,0x6b,0x00,0x0c,0x60,0x00,0xf2,0x00,0x1f,0x00,0x02,0xf0,0x00,0x1f,
-0x20,0x00,0xe3,0x00,0x09,0x80,0x00,0x2d,0x48,0x18,0xf0,0x0e,0x00,0xa1,0x20,0x00,
-0x88,0x00,0x0c,0x40,0x05,0xd0,0x00,0xe3,0x00,0xb6,0x00,0x98,0x00,0x99,0x00,0xa8,
-0x00,0xc5,0x01,0xf1,0x07,0x90,0x2d,0x10,0x83,0x82,0x00,0xf2,0x12,0x42,0xa4,0x31,
-0x6d,0xfe,0xc3,0x04,0xdc,0x00,0x0e,0x2a,0x70,0x01,0x01,0x10,0x00,0x0a,0x20,0x00,
-0x00,0xe4,0x00,0x00,0x0e,0x40,0x07,0xff,0xff,0xfc,0x12,0x2e,0x52,0x10,0x0e,0x00,
-0xf0,0x09,0x00,0x3f,0x4d,0x96,0x00,0xbf,0xf5,0x04,0x00,0xe3,0x00,0x03,0xc0,0x00,
-0x96,0x00,0x0e,0x00,0x06,0xa0,0x00,0xc3,0x00,0x2d,0x4b,0x08,0xf0,0x14,0xe1,0x00,
-0x5b,0x00,0x0b,0x50,0x00,0x02,0xcf,0xd5,0x00,0xc8,0x04,0xf2,0x2f,0x00,0x0b,0x63,
-0xe0,0x00,0xa8,0x4e,0x00,0x09,0x93,0xe0,0x00,0xa8,0x2f,0x00,0x0b,0x60,0xc8,0x03,
-0xf1,0x1c,0x00,0x77,0x04,0xa9,0xdc,0xca,0x10,0x8a,0x00,0x02,0x00,0xf0,0x19,0x04,
-0xcf,0xd6,0x01,0xf5,0x04,0xf3,0x4a,0x00,0x0d,0x50,0x00,0x01,0xf1,0x00,0x00,0xc7,
-0x00,0x00,0xba,0x00,0x00,0xaa,0x00,0x00,0x9b,0x00,0x00,0x3f,0xff,0xff,0xc0,0x04,
-0xcf,0xd4,0x01,0xf5,0x04,0xf1,0x26,0x80,0x00,0xf0,0x25,0x05,0xe1,0x00,0x8f,0xf5,
-0x00,0x00,0x04,0xf3,0x25,0x00,0x0c,0x62,0xf3,0x03,0xf3,0x05,0xdf,0xd5,0x00,0x00,
-0x00,0xdb,0x00,0x00,0x08,0xfb,0x00,0x00,0x3e,0x8b,0x00,0x00,0xc5,0x7b,0x00,0x07,
-0xa0,0x7b,0x00,0x2e,0x10,0x7b,0x00,0x9f,0xff,0xff,0xf0,0x00,0x00,0x7b,0x00,0x04,
-0x00,0xf1,0x50,0x04,0xff,0xff,0x80,0x6c,0x11,0x10,0x07,0x90,0x00,0x00,0x9d,0xdd,
-0x70,0x05,0x72,0x4e,0x60,0x00,0x00,0x7b,0x07,0x10,0x07,0xb0,0xb9,0x01,0xd6,0x01,
-0xae,0xe8,0x00,0x00,0x3b,0xf5,0x00,0x3f,0x71,0x00,0x0b,0x70,0x00,0x00,0xf9,0xee,
-0x70,0x2f,0x90,0x3e,0x52,0xf0,0x00,0x99,0x0f,0x20,0x08,0x90,0xab,0x02,0xe4,0x00,
-0xae,0xe6,0x00,0x7f,0xff,0xff,0xb0,0x00,0x00,0xc5,0x00,0x00,0x3d,0x00,0x00,0x0b,
-0x60,0x00,0x03,0xe0,0x00,0x00,0xa8,0x00,0x00,0x2f,0x10,0x00,0x09,0x90,0x00,0x01,
-0xf2,0x00,0xf6,0x00,0xf1,0x30,0xd8,0x04,0xf2,0x0f,0x20,0x0d,0x50,0xc8,0x04,0xe1,
-0x02,0xff,0xf6,0x00,0xe6,0x03,0xe3,0x3e,0x00,0x0a,0x81,0xf5,0x02,0xe5,0x04,0xcf,
-0xe7,0x00,0x03,0xcf,0xc2,0x00,0xe6,0x07,0xe0,0x4e,0x00,0x0d,0x44,0xd0,0x00,0xb6,
-0x1f,0x60,0x5f,0x60,0x4d,0xf9,0xd5,0x00,0x00,0x1f,0x10,0x00,0x3c,0x90,0x01,0xfd,
-0x70,0x00,0x0e,0x30,0x50,0x19,0x1a,0x51,0x40,0x1e,0x30,0x2e,0x10,0x0b,0x00,0xf0,
-0x11,0x01,0x90,0x2f,0x06,0xb0,0x41,0x00,0x00,0x00,0x68,0x01,0x8e,0xc4,0x6e,0x92,
-0x00,0x4d,0xc5,0x00,0x00,0x4c,0xe6,0x00,0x00,0x36,0x0e,0xee,0xee,0x30,0x11,0x11,
-0x10,0x24,0x00,0xf0,0x33,0xee,0xee,0xe3,0x01,0x11,0x11,0x00,0x2a,0x30,0x00,0x00,
-0x7d,0xc5,0x00,0x00,0x04,0xae,0x20,0x02,0x8e,0xa1,0x1b,0xf9,0x20,0x01,0x71,0x00,
-0x00,0x08,0xee,0xa0,0x5e,0x21,0xd7,0x12,0x00,0x99,0x00,0x02,0xe4,0x00,0x1e,0x70,
-0x00,0x9a,0x00,0x00,0x43,0x00,0x00,0x21,0x00,0x00,0xa7,0x00,0x00,0x03,0xbd,0xdc,
-0x70,0x00,0x00,0x6b,0x20,0x00,0x7b,0xc7,0x01,0xf1,0x1a,0x00,0x07,0x60,0x0a,0x30,
-0x2b,0xd9,0x00,0xb0,0x0e,0x00,0xd4,0x0e,0x00,0xc0,0x2b,0x04,0xb0,0x0e,0x00,0xc0,
-0x3a,0x07,0x80,0x1c,0x00,0xc0,0x2b,0x06,0x90,0x6c,0x04,0x90,0x0e,0x01,0xcb,0x5b,
-0xca,0x10,0x09,0x60,0x97,0x00,0xf0,0x21,0xd6,0x00,0x02,0x00,0x00,0x00,0x18,0xcc,
-0xda,0x00,0x00,0x00,0x07,0xf0,0x00,0x00,0x00,0xdc,0x50,0x00,0x00,0x4b,0x4c,0x00,
-0x00,0x0a,0x50,0xd2,0x00,0x01,0xd0,0x07,0x80,0x00,0x7f,0xee,0xee,0x00,0x0d,0x31,
-0x11,0xb5,0x03,0xe0,0x00,0x06,0xb0,0xa9,0xe5,0x00,0xf0,0x21,0xef,0xff,0xc3,0x0e,
-0x40,0x18,0xe0,0xe4,0x00,0x2f,0x1e,0x40,0x09,0xc0,0xef,0xff,0xf4,0x0e,0x40,0x05,
-0xf1,0xe4,0x00,0x0e,0x5e,0x40,0x05,0xf2,0xef,0xff,0xd4,0x00,0x00,0x7d,0xfd,0x60,
-0x08,0xe4,0x04,0xe5,0x0f,0x40,0x00,0x7b,0x3f,0x00,0x00,0x00,0x04,0x00,0xf2,0x27,
-0x2f,0x00,0x00,0x00,0x0f,0x40,0x00,0x7a,0x07,0xd3,0x03,0xe5,0x00,0x7e,0xfd,0x60,
-0xef,0xfe,0x91,0x0e,0x40,0x2a,0xd0,0xe4,0x00,0x0d,0x6e,0x40,0x00,0x8a,0xe4,0x00,
-0x07,0xbe,0x40,0x00,0x9a,0xe4,0x00,0x0d,0x7e,0x40,0x2a,0xd0,0xef,0xfe,0x91,0x00,
-0xef,0xff,0xfe,0xe4,0x00,0x00,0x03,0x00,0x37,0xef,0xff,0xf4,0x0c,0x00,0x47,0xff,
-0xef,0xff,0xfc,0x0f,0x00,0x15,0xf2,0x0c,0x00,0x20,0xe4,0x00,0x7a,0x00,0xb0,0x70,
-0x07,0xd4,0x03,0xd8,0x0f,0x40,0x00,0x36,0x2f,0x10,0x7a,0x00,0xf8,0x07,0x7f,0xfe,
-0x2f,0x10,0x00,0x5e,0x0e,0x50,0x00,0x5e,0x06,0xe4,0x01,0xad,0x00,0x6d,0xfe,0xa2,
-0xe4,0x00,0x00,0xf2,0x04,0x00,0x4c,0xef,0xff,0xff,0xf2,0x14,0x00,0x14,0xd6,0x01,
-0x00,0x10,0x00,0x79,0x03,0x2a,0x01,0xf2,0x07,0x00,0xf8,0x20,0x55,0x00,0x1f,0x26,
-0xe2,0x09,0xd0,0x08,0xef,0xb2,0x00,0xe4,0x00,0x2e,0x60,0xe4,0x01,0xd7,0x00,0xe4,
-0x1d,0x90,0x00,0xe5,0xca,0x00,0x00,0xee,0xfa,0x00,0x00,0xeb,0x2e,0x60,0x00,0xe4,
-0x04,0xf3,0x00,0xe4,0x00,0x7e,0x10,0xe4,0x00,0x0a,0xb0,0xa1,0x00,0x08,0x03,0x00,
-0xf0,0x22,0xef,0xff,0xfa,0xed,0x00,0x00,0x08,0xf4,0xef,0x40,0x00,0x0e,0xf4,0xeb,
-0xa0,0x00,0x5d,0xd4,0xe5,0xf1,0x00,0xc6,0xe4,0xe4,0xa7,0x02,0xf0,0xe4,0xe4,0x4e,
-0x09,0x90,0xf4,0xe4,0x0d,0x5e,0x20,0xf4,0xe4,0x06,0xfc,0x00,0xf4,0xe4,0x00,0xf5,
-0x00,0xf4,0xea,0xad,0x00,0xf0,0x27,0x40,0x00,0xf2,0xeb,0xe1,0x00,0xf2,0xe4,0xba,
-0x00,0xf2,0xe4,0x1f,0x50,0xf2,0xe4,0x06,0xe1,0xf2,0xe4,0x00,0xba,0xf2,0xe4,0x00,
-0x1f,0xf2,0xe4,0x00,0x06,0xf2,0x00,0x6d,0xfd,0x60,0x00,0x7e,0x41,0x5e,0x60,0x0f,
-0x50,0x00,0x6e,0x02,0xf0,0x00,0x01,0xf1,0x3f,0x00,0x00,0x0f,0x22,0x09,0x00,0x91,
-0x0f,0x50,0x00,0x5e,0x00,0x7e,0x41,0x4e,0x60,0x24,0x00,0xf3,0x04,0xef,0xff,0xd7,
-0x0e,0x40,0x03,0xe6,0xe4,0x00,0x08,0xae,0x40,0x02,0xd7,0xef,0xff,0xd8,0x0e,0x40,
-0x23,0x04,0x01,0x49,0x01,0x00,0x4a,0x01,0xf0,0x05,0x50,0x00,0x8e,0x41,0x5f,0x50,
-0x0f,0x40,0x00,0x7d,0x03,0xf0,0x00,0x02,0xf0,0x4e,0x00,0x00,0x1f,0x13,0x09,0x00,
-0xc0,0x0f,0x40,0x00,0x6d,0x00,0x8d,0x41,0x5e,0x50,0x00,0x7d,0xff,0xf1,0x04,0x10,
-0x1c,0x05,0x00,0xf0,0x21,0x03,0x00,0xff,0xff,0xc4,0x0f,0x40,0x06,0xf2,0xf4,0x00,
-0x0e,0x5f,0x40,0x06,0xf2,0xff,0xff,0xe3,0x0f,0x40,0x4e,0x00,0xf4,0x00,0xc8,0x0f,
-0x40,0x04,0xf1,0xf4,0x00,0x0c,0x80,0x02,0xbf,0xfa,0x10,0x0e,0x81,0x19,0xd0,0x2f,
-0x10,0x00,0xb1,0x0c,0xb3,0x62,0x00,0xf1,0x07,0xe8,0x00,0x00,0x00,0x2b,0xd0,0x48,
-0x00,0x00,0xf2,0x2f,0x60,0x07,0xf0,0x03,0xbf,0xfb,0x30,0xbf,0xff,0xff,0xf7,0xb6,
-0x03,0x0f,0x04,0x00,0x07,0x00,0x65,0x03,0x1f,0xa9,0x04,0x00,0x01,0xf0,0x1b,0x0f,
-0x20,0x00,0xb7,0x0b,0xb2,0x05,0xf2,0x01,0x9e,0xfc,0x40,0xaa,0x00,0x00,0x6e,0x04,
-0xf0,0x00,0x0c,0x80,0x0d,0x50,0x01,0xf2,0x00,0x8b,0x00,0x7c,0x00,0x01,0xf1,0x0c,
-0x60,0x00,0x0b,0x62,0xf0,0x00,0x00,0x5b,0x7a,0x6b,0x03,0x50,0x30,0x00,0x00,0x09,
-0xd0,0x4b,0x04,0x20,0x0d,0x70,0x24,0x01,0xf5,0x5e,0x1f,0xc0,0x05,0xe0,0x0f,0x30,
-0x6b,0xf1,0x08,0xa0,0x0b,0x60,0xb6,0xb5,0x0c,0x60,0x07,0xa0,0xf1,0x6a,0x0f,0x20,
-0x03,0xe4,0xc0,0x1e,0x4e,0x00,0x00,0xfa,0x70,0x0d,0xaa,0x00,0x00,0xcf,0x20,0x08,
-0xf6,0x00,0x00,0x8e,0x00,0x03,0xf2,0x00,0x3f,0x30,0x01,0xe6,0x09,0xc0,0x0a,0xb0,
-0x00,0xe6,0x4f,0x20,0x00,0x4f,0xd7,0x00,0x00,0x0c,0xf0,0x00,0x00,0x5f,0xd7,0x00,
-0x01,0xe6,0x4f,0x20,0x0a,0xc0,0x09,0xc0,0x4f,0x20,0x01,0xe7,0xab,0x00,0x00,0xe6,
-0x1f,0x40,0x07,0xd0,0x07,0xc0,0x1e,0x40,0x00,0xe4,0x8b,0x00,0x00,0x5d,0xe2,0x00,
-0x00,0x0d,0x90,0x00,0x00,0x0b,0x80,0x04,0x00,0xf0,0x08,0x6f,0xff,0xff,0xf1,0x00,
-0x00,0x0b,0xa0,0x00,0x00,0x7d,0x00,0x00,0x03,0xf3,0x00,0x00,0x0d,0x70,0x00,0x00,
-0x9c,0x00,0x17,0x05,0x40,0x00,0x1e,0x50,0x00,0xa7,0x04,0x5f,0xf4,0x1f,0xf4,0x1f,
-0x10,0x02,0x00,0x02,0xf0,0x00,0xf4,0x89,0x00,0x00,0x2e,0x00,0x00,0x0c,0x50,0x00,
-0x06,0xb0,0x00,0x00,0xf1,0x0a,0x04,0x00,0xcf,0x04,0xca,0x0d,0x40,0x00,0x07,0xa0,
-0x00,0x01,0xf1,0xef,0x70,0xb7,0x0b,0x03,0x00,0xf1,0x22,0xef,0x70,0x00,0x61,0x00,
-0x2f,0x80,0x08,0x9e,0x00,0xe1,0xa5,0x6b,0x04,0xc0,0xef,0xff,0xfc,0x4f,0x20,0x06,
-0xb0,0x02,0xcf,0xd4,0x00,0xf5,0x06,0xf0,0x02,0x00,0x1f,0x10,0x4b,0xdd,0xf2,0x2f,
-0x30,0x1f,0x23,0xf3,0x17,0xf2,0x08,0xee,0x7d,0x30,0x1f,0x10,0xbf,0x05,0x00,0x07,
-0x00,0xe0,0xf8,0xee,0x70,0x1f,0x80,0x3f,0x41,0xf1,0x00,0x99,0x1f,0x10,0x07,0xa1,
-0x07,0x00,0x60,0x80,0x3f,0x41,0xf7,0xee,0x70,0x3c,0x00,0xf0,0x02,0xe7,0x04,0xf1,
-0x4e,0x00,0x05,0x26,0xc0,0x00,0x00,0x4e,0x00,0x03,0x10,0xe6,0x03,0xe2,0x15,0x00,
-0x10,0x00,0xba,0x06,0x20,0x00,0xc6,0x07,0x00,0xd0,0x3c,0xfa,0xd6,0x0e,0x80,0x4f,
-0x64,0xe0,0x00,0xc6,0x5c,0x00,0x0c,0x07,0x00,0xd0,0x0e,0x60,0x3f,0x60,0x3c,0xeb,
-0xc6,0x02,0xbf,0xd3,0x00,0xd7,0x05,0x43,0x05,0x60,0x46,0xff,0xff,0xf6,0x4d,0x00,
-0xa8,0x1e,0xf6,0x05,0x91,0x02,0xbf,0xe7,0x00,0x00,0x9d,0x60,0x5d,0x20,0x08,0xa0,
-0x09,0xff,0xe1,0x08,0xa0,0x00,0x8a,0x00,0x05,0x00,0xf0,0x02,0x03,0xcf,0xac,0x60,
-0xe7,0x04,0xf6,0x4e,0x00,0x0c,0x65,0xd0,0x00,0xc6,0x4e,0x00,0x0c,0x0e,0x00,0xe7,
-0x03,0xcf,0xad,0x60,0x00,0x00,0xd5,0x0c,0x30,0x6f,0x10,0x4d,0xfc,0x40,0xb4,0x00,
-0xe6,0xf7,0xde,0x70,0x1f,0x90,0x4f,0x21,0xf1,0x00,0xe4,0x1f,0x10,0x0e,0x41,0x07,
-0x00,0x64,0x0e,0x20,0x30,0x0f,0x20,0xf2,0x03,0x00,0x6a,0x01,0xe1,0x00,0x40,0x01,
-0xf1,0x02,0x00,0x47,0x04,0xf0,0x5f,0x80,0x49,0x00,0xf7,0x09,0xf1,0x09,0xc0,0x1f,
-0x18,0xd1,0x01,0xf8,0xe1,0x00,0x1f,0xfe,0x10,0x01,0xf3,0xab,0x00,0x1f,0x10,0xd7,
-0x01,0xf1,0x03,0xf3,0x46,0x00,0x00,0x03,0x00,0xfc,0x07,0x2f,0x7e,0xf7,0x5e,0xfa,
-0x02,0xf8,0x04,0xfb,0x12,0xe5,0x2f,0x10,0x0e,0x40,0x0a,0x82,0xf1,0x00,0xe4,0x00,
-0xa8,0x0b,0x00,0x89,0x80,0x1f,0x6d,0xe7,0x01,0xf9,0x04,0xf2,0x94,0x00,0x00,0x07,
-0x00,0xf5,0x23,0x40,0x02,0xbf,0xd5,0x00,0xd8,0x03,0xe4,0x4e,0x00,0x08,0xa6,0xc0,
-0x00,0x6c,0x4e,0x00,0x08,0xb0,0xd7,0x03,0xe5,0x02,0xbf,0xd6,0x00,0x1f,0x8d,0xe7,
-0x01,0xf6,0x02,0xf4,0x1f,0x10,0x09,0x91,0xf1,0x00,0x8a,0x1f,0x10,0x0a,0x91,0xf7,
-0x03,0xf3,0x1f,0x9e,0xe7,0xa0,0x00,0x54,0x00,0x00,0x03,0xcf,0xbc,0x1a,0x01,0x13,
-0xc0,0x1a,0x01,0x54,0x03,0xf6,0x03,0xcf,0xbd,0x84,0x01,0x01,0x07,0x00,0xa4,0x01,
-0xf9,0xf3,0x1f,0x81,0x01,0xf1,0x00,0x1f,0x10,0x05,0x00,0xf2,0x12,0x05,0xdf,0xc3,
-0x00,0xf4,0x08,0xd0,0x0f,0x60,0x01,0x00,0x3b,0xeb,0x30,0x12,0x00,0x7e,0x03,0xf3,
-0x05,0xe0,0x06,0xdf,0xd4,0x00,0x05,0x30,0x0b,0x70,0xdf,0xfb,0x0b,0x70,0x02,0x00,
-0xb3,0x0a,0x90,0x04,0xeb,0x2f,0x00,0x0e,0x42,0xf0,0x00,0xe4,0x07,0x00,0xf0,0x63,
-0x1f,0x00,0x0e,0x40,0xf6,0x06,0xf4,0x05,0xee,0x9e,0x40,0x99,0x00,0x4e,0x04,0xe0,
-0x0a,0x80,0x0e,0x30,0xe2,0x00,0x89,0x4d,0x00,0x03,0xe9,0x70,0x00,0x0d,0xf2,0x00,
-0x00,0x7c,0x00,0x00,0x99,0x00,0xc7,0x00,0xd5,0x4d,0x01,0xfc,0x01,0xf0,0x0f,0x15,
-0x9e,0x15,0xc0,0x0b,0x5a,0x49,0x69,0x70,0x07,0xae,0x04,0xbd,0x20,0x02,0xfa,0x00,
-0xee,0x00,0x00,0xe5,0x00,0xa9,0x00,0x5e,0x10,0x9c,0x00,0xb9,0x3f,0x20,0x01,0xed,
-0x70,0x00,0x09,0xf0,0x00,0x02,0xfc,0x80,0x00,0xb8,0x2f,0x30,0x6e,0x00,0x8c,0x00,
-0xb9,0x00,0x6d,0x5e,0x00,0xb7,0x0f,0x40,0xf2,0x0a,0x95,0xd0,0x04,0xea,0x70,0x00,
-0xef,0x20,0x16,0x03,0xb1,0x97,0x00,0x03,0xe1,0x00,0x6e,0x60,0x00,0x6f,0xff,0xfd,
-0x1f,0x03,0x50,0x0c,0x90,0x00,0x08,0xd0,0x8f,0x03,0x30,0x01,0xe6,0x00,0x4b,0x03,
-0xf0,0x05,0x00,0x00,0x08,0x10,0x0b,0x80,0x02,0xf0,0x00,0x3e,0x00,0x04,0xe0,0x00,
-0x9b,0x00,0x9f,0x30,0x00,0x8b,0x0a,0x00,0x40,0x3e,0x00,0x02,0xf0,0x6e,0x03,0x36,
-0x08,0x10,0xe1,0x01,0x00,0xf5,0x18,0x72,0x00,0x3e,0x20,0x0a,0x80,0x08,0x90,0x08,
-0xa0,0x05,0xd1,0x00,0xcf,0x05,0xd1,0x08,0xa0,0x08,0x90,0x0a,0x80,0x3e,0x20,0x73,
-0x00,0x03,0xdc,0x20,0x0d,0x00,0xe5,0x6e,0x25,0xb0,0x1c,0x00,0x6f,0xe3,0xea,0x21,
-0x00,0x05,0x00,0x10,0x4f,0xca,0x07,0xf0,0x10,0x04,0xee,0x40,0x0c,0xff,0xff,0xfc,
+0x00,0xf7,0x8a,0x60,0x00,0x60,0x3d,0x8b,0x10,0x0d,0x0e,0x09,0x98,0x13,0xf8,0xff,
+0xff,0xff,0xf7,0x72,0x1f,0xb5,0x21,0x50,0xab,0x54,0xab,0x58,0xab,0x60,0xab,0x62,
+0xab,0x65,0xab,0x69,0xab,0x6c,0xab,0x81,0xab,0xc0,0xab,0xc4,0xab,0xd0,0xab,0xdc,
+0xab,0xf0,0xab,0xf8,0xab,0xf9,0xab,0x00,0xac,0x0d,0xac,0x14,0xac,0x30,0xac,0x31,
+0xac,0x41,0xac,0x45,0xac,0x4c,0xac,0x50,0xac,0xa0,0xac,0xbc,0xac,0xbd,0xac,0xc5,
+0xac,0xdc,0xac,0x10,0xad,0x2c,0xad,0x30,0xad,0x48,0xad,0x49,0xad,0x4c,0xad,0x50,
+0xad,0x59,0xad,0x80,0xad,0x88,0xad,0x91,0xad,0x9c,0xad,0x0c,0xae,0x08,0xaf,0x94,
+0xaf,0xa4,0xaf,0xad,0xaf,0xe8,0xaf,0xf0,0xaf,0xf8,0xaf,0x04,0xb0,0x58,0xb0,0x60,
+0xb0,0x73,0xb0,0x74,0xb0,0xc8,0xb0,0xe2,0xb0,0x54,0xb1,0x5c,0xb1,0xc4,0xb1,0xe0,
+0xb1,0xe4,0xb1,0xf5,0xb1,0x18,0xb2,0x28,0xb2,0x29,0xb2,0x34,0xb2,0x38,0xb2,0x45,
+0xb2,0x50,0xb2,0xa4,0xb2,0xac,0xb2,0xbe,0xb2,0xc0,0xb2,0xc1,0xb2,0xc4,0xb2,0xc8,
+0xb2,0x14,0xb3,0x15,0xb3,0x29,0xb3,0x68,0xb3,0x6c,0xb3,0x78,0xb3,0xa0,0xb3,0xa8,
+0xb3,0xf4,0xb3,0x10,0xb4,0x18,0xb4,0x2c,0xb4,0x2d,0xb4,0x30,0xb4,0x34,0xb4,0x41,
+0xb4,0x64,0xb4,0x79,0xb4,0x80,0xb4,0x9c,0xb4,0x60,0xb5,0xec,0xb5,0x40,0xb6,0xcc,
+0xb6,0xd0,0xb6,0xdc,0xb6,0xe1,0xb6,0xe8,0xb6,0xe9,0xb6,0x19,0xb7,0x3c,0xb7,0x4c,
+0xb7,0x4d,0xb7,0x58,0xb7,0x59,0xb7,0x5c,0xb7,0x74,0xb7,0x75,0xb7,0x7c,0xb7,0xac,
+0xb7,0xad,0xb7,0xb0,0xb7,0xb4,0xb7,0xbf,0xb7,0x1c,0xb8,0x38,0xb8,0x49,0xb8,0xa8,
+0xb8,0xb8,0xb8,0xc4,0xb8,0xc8,0xb8,0xcc,0xb8,0xd4,0xb8,0xfc,0xb8,0xfd,0xb8,0x00,
+0xb9,0x0c,0xb9,0x0d,0xb9,0x0f,0xb9,0x11,0xb9,0x18,0xb9,0x19,0xb9,0x1c,0xb9,0x1e,
+0xb9,0x20,0xb9,0x2e,0xb9,0x34,0xb9,0x45,0xb9,0x47,0xb9,0x88,0xb9,0x8c,0xb9,0x90,
+0xb9,0xa4,0xb9,0xc4,0xb9,0xd5,0xb9,0xf8,0xb9,0xf9,0xb9,0x0b,0xba,0x84,0xba,0x88,
+0xba,0xfc,0xba,0x48,0xbb,0x49,0xbb,0x50,0xbb,0x5b,0xbb,0x5d,0xbb,0x5f,0xbb,0x64,
+0xbb,0x65,0xbb,0x68,0xbb,0x6c,0xbb,0x6d,0xbb,0x79,0xbb,0x80,0xbb,0x81,0xbb,0xd4,
+0xbb,0xd8,0xbb,0xdc,0xbb,0xe4,0xbb,0xe5,0xbb,0xf0,0xbb,0xf8,0xbb,0x10,0xbc,0x14,
+0xbc,0x44,0xbc,0x45,0xbc,0x48,0xbc,0x4c,0xbc,0x57,0xbc,0xd0,0xbc,0xd4,0xbc,0xd8,
+0xbc,0xe9,0xbc,0x40,0xbd,0x5c,0xbd,0x64,0xbd,0x94,0xbd,0x98,0xbd,0x9c,0xbd,0xb0,
+0xbd,0xb8,0xbd,0xe0,0xbf,0xfc,0xbf,0xfd,0xbf,0x00,0xc0,0x0d,0xc0,0x11,0xc0,0x18,
+0xc0,0x19,0xc0,0x28,0xc0,0x2d,0xc0,0x47,0xc0,0x6c,0xc0,0x6d,0xc0,0x70,0xc0,0x74,
+0xc0,0x81,0xc0,0x88,0xc0,0x89,0xc0,0x8c,0xc0,0x90,0xc0,0x9b,0xc0,0xa8,0xc0,0xdc,
+0xc0,0xdd,0xc0,0xe0,0xc0,0xf1,0xc0,0x30,0xc1,0x68,0xc1,0x6c,0xc1,0x7b,0xc1,0xf4,
+0xc1,0xfc,0xc1,0x05,0xc2,0x09,0xc2,0x2c,0xc2,0x2d,0xc2,0x30,0xc2,0x34,0xc2,0x3c,
+0xc2,0x41,0xc2,0x48,0xc2,0x40,0xc4,0x94,0xc4,0x95,0xc4,0x98,0xc4,0x9a,0xc4,0x9c,
+0xc4,0xa4,0xc4,0xa5,0xc4,0xa9,0xc4,0xae,0xc4,0xc0,0xc4,0xcc,0xc4,0xe1,0xc4,0x04,
+0xc5,0x08,0xc5,0x0c,0xc5,0x15,0xc5,0x16,0xc5,0x18,0xc5,0x20,0xc5,0x28,0xc5,0x3c,
+0xc5,0x3d,0xc5,0x40,0xc5,0x44,0xc5,0x51,0xc5,0x58,0xc5,0x74,0xc5,0x78,0xc5,0x7c,
+0xc5,0x85,0xc5,0x90,0xc5,0x94,0xc5,0xc8,0xc5,0xcc,0xc5,0xe4,0xc5,0xf9,0xc5,0x00,
+0xc6,0x04,0xc6,0x08,0xc6,0x10,0xc6,0x13,0xc6,0x1c,0xc6,0x20,0xc6,0x24,0xc6,0x38,
+0xc6,0x54,0xc6,0x70,0xc6,0x78,0xc6,0x8c,0xc6,0x90,0xc6,0x94,0xc6,0x9c,0xc6,0xa1,
+0xc6,0xa8,0xc6,0xc4,0xc6,0xc5,0xc6,0xc8,0xc6,0xcc,0xc6,0xcd,0xc6,0xd4,0xc6,0xd5,
+0xc6,0xd8,0xc6,0xe0,0xc6,0xe1,0xc6,0xe4,0xc6,0xe8,0xc6,0xf5,0xc6,0xfc,0xc6,0xfd,
+0xc6,0x50,0xc7,0x51,0xc7,0x54,0xc7,0x58,0xc7,0x60,0xc7,0x61,0xc7,0x65,0xc7,0x6c,
+0xc7,0x7f,0xc7,0x88,0xc7,0xc0,0xc7,0xc1,0xc7,0xc4,0xc7,0xd5,0xc7,0xdc,0xc7,0x4c,
+0xc8,0x50,0xc8,0x61,0xc8,0xd9,0xc8,0xe0,0xc8,0xed,0xc8,0x10,0xc9,0x11,0xc9,0x14,
+0xc9,0x20,0xc9,0x21,0xc9,0x2c,0xc9,0x48,0xc9,0x49,0xc9,0x0d,0xca,0x5d,0xcb,0x78,
+0xcb,0x88,0xcb,0x8c,0xcb,0x8e,0xcb,0x94,0xcb,0xfb,0xcb,0xfd,0xcb,0x04,0xcc,0x58,
+0xcc,0xac,0xcc,0xe4,0xcc,0xe5,0xcc,0xe8,0xcc,0xec,0xcc,0xf9,0xcc,0x38,0xcd,0x71,
+0xcd,0xa8,0xcd,0xbd,0xcd,0xc4,0xcd,0xe0,0xcd,0x34,0xce,0x38,0xce,0x3c,0xce,0x44,
+0xce,0x47,0xce,0x50,0xce,0x6c,0xce,0x7c,0xce,0xa4,0xce,0xac,0xce,0xbc,0xcf,0xc4,
+0xcf,0xcc,0xcf,0xf4,0xcf,0xfc,0xcf,0x10,0xd0,0x18,0xd0,0x20,0xd0,0x2c,0xd0,0x2d,
+0xd0,0x3d,0xd0,0x80,0xd0,0x84,0xd0,0x88,0xd0,0x90,0xd0,0x9c,0xd0,0x9d,0xd0,0xa0,
+0xd0,0xa4,0xd0,0xac,0xd0,0xf0,0xd0,0xf4,0xd0,0x05,0xd1,0x7c,0xd1,0x08,0xd2,0x09,
+0xd2,0x0c,0xd2,0x10,0xd2,0x40,0xd2,0x41,0xd2,0x5c,0xd2,0x6d,0xd2,0x78,0xd2,0xd4,
+0xd2,0xdc,0xd2,0xe8,0xd2,0xe9,0xd2,0x08,0xd3,0x19,0xd3,0x3c,0xd3,0x44,0xd3,0xac,
+0xd3,0xc8,0xd3,0x54,0xd4,0x5c,0xd4,0x8c,0xd4,0x90,0xd4,0x94,0xd4,0xa1,0xd4,0xa8,
+0xd4,0xa9,0xd4,0xac,0xd4,0xb0,0xd4,0xb8,0xd4,0xb9,0xd4,0xbd,0xd4,0xc4,0xd4,0xd9,
+0xd4,0xf5,0xd4,0x18,0xd5,0x28,0xd5,0x2d,0xd5,0x3c,0xd5,0x54,0xd5,0x65,0xd5,0x88,
+0xd5,0x90,0xd5,0x9d,0xd5,0xa4,0xd5,0xa5,0xd5,0xa8,0xd5,0xac,0xd5,0xb9,0xd5,0xdc,
+0xd5,0xf8,0xd5,0x14,0xd6,0x70,0xd6,0x84,0xd6,0xc0,0xd6,0xd8,0xd6,0x51,0xef,0x58,
+0xef,0x5b,0xef,0x5c,0xef,0x5d,0xef,0x61,0xef,0x63,0xef,0x65,0xef,0x69,0xef,0x6c,
+0xef,0x71,0xef,0x76,0xef,0x77,0xef,0x78,0xef,0x8e,0xef,0x93,0xef,0x98,0xef,0x9b,
+0xef,0x9c,0xef,0x9d,0xef,0xa1,0xef,0xa2,0xef,0xa3,0xef,0xa4,0xef,0xb7,0xef,0xb8,
+0xef,0xbe,0xef,0xc0,0xef,0xc1,0xef,0xc4,0xef,0xc7,0xef,0xc8,0xef,0xc9,0xef,0xcb,
+0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,0x15,0xf0,0x17,0xf0,0x19,0xf0,0x30,0xf0,0x37,
+0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,0x74,0xf0,0xab,0xf0,0x3b,0xf1,0x90,0xf1,0x91,
+0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,0x54,0xf2,0xaa,
+0xf4,0x12,0xf7,0xf2,0xf7,0x00,0x01,0x00,0x2f,0xfc,0x00,0x01,0x00,0x03,0x13,0xf5,
+0x08,0x00,0x17,0xf4,0x14,0x00,0xce,0xfb,0xfa,0x00,0xfe,0xfa,0x00,0xf8,0x00,0x00,
+0x00,0x01,0x00,0x01,0x00,0x4e,0x02,0x02,0x00,0x02,0x16,0x00,0x2f,0xef,0x00,0x01,
+0x00,0x15,0x1f,0xe9,0x1e,0x00,0x0a,0x03,0x88,0x00,0xb1,0xfa,0x00,0xff,0x00,0x00,
+0xf3,0xfe,0xf7,0xf9,0x00,0xf6,0x11,0x00,0x00,0x0f,0x00,0x4d,0xfe,0xff,0xfb,0xfd,
+0x92,0x00,0x30,0xfd,0x00,0xfe,0x2e,0x00,0x1e,0x00,0x01,0x00,0x1c,0xfd,0x0a,0x00,
+0x19,0xff,0x1f,0x00,0x12,0xfe,0x07,0x00,0x13,0xf6,0x0b,0x00,0x00,0x48,0x00,0x3f,
+0xfe,0xfc,0xfe,0x9c,0x00,0x0a,0x15,0x02,0x3c,0x00,0x11,0xfe,0x34,0x00,0x26,0xfe,
+0xfd,0x30,0x00,0x11,0xe8,0x04,0x01,0x15,0xe5,0x24,0x00,0x20,0xfd,0xfe,0x20,0x00,
+0x01,0x2b,0x00,0x0d,0x44,0x00,0x10,0xfd,0x08,0x00,0x1f,0xfd,0x68,0x00,0x07,0x1f,
+0xfe,0x43,0x01,0x0d,0x19,0xfa,0xdf,0x00,0x01,0xbd,0x00,0x10,0xfd,0x38,0x00,0x12,
+0xfc,0x09,0x01,0x14,0xde,0x6c,0x00,0x97,0xf9,0x00,0x00,0xe4,0xfb,0xee,0xf1,0x00,
+0xe8,0x08,0x02,0x07,0x18,0x02,0x73,0xdf,0x00,0x00,0x00,0xf2,0x00,0xec,0x43,0x00,
+0x41,0xfd,0x00,0xff,0xff,0x25,0x01,0x1f,0x01,0xe0,0x01,0x01,0x10,0xfc,0xd2,0x00,
+0x1f,0xfc,0x97,0x00,0x0b,0x10,0xf8,0xba,0x00,0x1e,0xfb,0x3b,0x00,0x00,0x05,0x00,
+0x93,0xea,0xe8,0x00,0x00,0xf8,0xfd,0xe8,0xfe,0x02,0x40,0x02,0xd3,0xf5,0xf6,0x00,
+0xf5,0xf6,0xf8,0xf4,0x00,0xf6,0xf9,0xfa,0xf8,0xfa,0x1a,0x01,0x66,0xe9,0xfc,0x00,
+0x00,0xf8,0xff,0x2b,0x01,0xa4,0xfb,0xfc,0x00,0x00,0xfb,0xfd,0x00,0x00,0xfd,0xff,
+0x7d,0x01,0x42,0x02,0x00,0xf4,0xfa,0x51,0x00,0x03,0x08,0x02,0x33,0x01,0xfd,0xfd,
+0x6c,0x01,0x17,0x00,0xaf,0x02,0x14,0xfb,0x20,0x01,0x15,0x01,0x01,0x02,0x02,0xb0,
+0x01,0x04,0x30,0x01,0xf0,0x0a,0x02,0xfb,0xeb,0xfb,0x00,0x00,0xf6,0xfd,0xf6,0xfe,
+0x02,0xf6,0x02,0x02,0x01,0x02,0x00,0x02,0xf9,0xf9,0xfe,0xfc,0xf9,0xfc,0xfa,0x03,
+0x02,0x36,0xfe,0xfd,0x02,0xc5,0x00,0x2a,0x01,0xfd,0x99,0x01,0x02,0x48,0x00,0x1e,
+0xfd,0xb2,0x01,0x0f,0xb5,0x01,0x04,0x1e,0xf9,0x31,0x01,0x0d,0xe9,0x01,0x1f,0xfd,
+0x24,0x00,0x09,0x12,0xff,0x43,0x02,0x1f,0xff,0x5a,0x03,0x10,0x1f,0xff,0x1d,0x00,
+0x10,0x1e,0x02,0xdd,0x01,0x19,0x02,0xbc,0x00,0x16,0x02,0x14,0x04,0x0f,0x01,0x00,
+0x1e,0x0b,0x04,0x01,0x1f,0xf2,0x2c,0x00,0x0b,0x23,0xfe,0xfe,0xd7,0x01,0x1c,0xf4,
+0x31,0x02,0x11,0xfe,0x93,0x00,0x10,0x05,0x2b,0x02,0x0f,0x6f,0x00,0x15,0x2e,0x02,
+0x00,0xb8,0x00,0x3d,0xfe,0xff,0x01,0x97,0x01,0x1f,0xf3,0xd8,0x00,0x24,0x1f,0xfe,
+0x24,0x00,0x26,0x0f,0x3d,0x00,0x07,0x13,0x01,0xd5,0x02,0x00,0x4a,0x1d,0x4d,0x04,
+0x00,0x04,0x05,0x21,0x00,0x30,0x06,0x07,0x08,0x46,0x0b,0xf1,0x05,0x0c,0x0c,0x0d,
+0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,
+0x19,0x20,0x00,0xff,0x0d,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,
+0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,
+0x00,0x01,0x00,0xff,0xfe,0x0a,0x75,0x02,0x20,0x03,0x02,0x70,0x02,0x4b,0x06,0x07,
+0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,
+0x00,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,
+0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,
+0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,
+0x23,0x73,0x00,0x02,0x1f,0x24,0x6f,0x02,0xff,0xe9,0x50,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const uint8_t lz4BitmapData[] ={
+0xf0,0xe4,0xe4,0xe4,0xe4,0xe3,0xe3,0xd3,0x82,0x30,0xd4,0x2c,0x67,0x2b,0x66,0x29,
+0x65,0x01,0x00,0x00,0x09,0x50,0xe0,0x00,0x0d,0x13,0xa0,0x0a,0xef,0xef,0xec,0x00,
+0x3a,0x0a,0x40,0x00,0x77,0x0d,0x00,0x3d,0xfe,0xdf,0xd4,0x00,0xd1,0x3a,0x00,0x00,
+0xe0,0x68,0x00,0x02,0xc0,0x95,0x00,0x00,0x0a,0x40,0x00,0x05,0xda,0x20,0x08,0xd7,
+0xae,0x10,0xe4,0x00,0xc6,0x0d,0x70,0x03,0x20,0x5f,0xa4,0x00,0x00,0x28,0xeb,0x00,
+0x00,0x01,0xd7,0x3f,0x00,0x09,0x80,0xd9,0x46,0xf4,0x01,0x9f,0xb4,0x00,0x00,0xc2,
+0x00,0x0a,0xcb,0x00,0x00,0x04,0xa0,0x86,0x09,0x10,0x4a,0x08,0x64,0x90,0x00,0x8c,
+0xa1,0xc0,0x00,0x00,0x00,0xa4,0x00,0x00,0x00,0x4a,0x3b,0xb4,0x00,0x1c,0x1c,0x21,
+0xd0,0x09,0x50,0xc2,0x0d,0x00,0x00,0x04,0xcc,0x50,0x00,0xbf,0xd4,0x00,0x00,0x7c,
+0x06,0xd0,0x00,0x08,0xb0,0x7b,0x00,0x00,0x1e,0xbc,0x10,0x00,0x03,0xef,0x40,0x22,
+0x01,0xf4,0x4e,0x2a,0x60,0x5d,0x00,0x7d,0xe2,0x01,0xf3,0x01,0xee,0x00,0x04,0xcd,
+0xd8,0xc9,0x00,0x59,0x58,0x58,0x00,0x00,0x02,0x00,0x02,0xd1,0x00,0xd3,0x00,0x6b,
+0x00,0x0c,0x60,0x00,0xf2,0x00,0x1f,0x00,0x02,0xf0,0x00,0x1f,0x20,0x00,0xe3,0x00,
+0x09,0x80,0x00,0x2d,0x00,0x00,0x88,0x00,0x00,0xa1,0x20,0x00,0x88,0x00,0x0c,0x40,
+0x05,0xd0,0x00,0xe3,0x00,0xb6,0x00,0x98,0x00,0x99,0x00,0xa8,0x00,0xc5,0x01,0xf1,
+0x07,0x90,0x2d,0x10,0x83,0x82,0x00,0xf2,0x12,0x42,0xa4,0x31,0x6d,0xfe,0xc3,0x04,
+0xdc,0x00,0x0e,0x2a,0x70,0x01,0x01,0x10,0x00,0x0a,0x20,0x00,0x00,0xe4,0x00,0x00,
+0x0e,0x40,0x07,0xff,0xff,0xfc,0x12,0x2e,0x52,0x10,0x0e,0x00,0xf0,0x30,0x00,0x3f,
+0x4d,0x96,0x00,0xbf,0xf5,0x04,0x00,0xe3,0x00,0x03,0xc0,0x00,0x96,0x00,0x0e,0x00,
+0x06,0xa0,0x00,0xc3,0x00,0x2d,0x00,0x08,0x70,0x00,0xe1,0x00,0x5b,0x00,0x0b,0x50,
+0x00,0x02,0xcf,0xd5,0x00,0xc8,0x04,0xf2,0x2f,0x00,0x0b,0x63,0xe0,0x00,0xa8,0x4e,
+0x00,0x09,0x93,0xe0,0x00,0xa8,0x2f,0x00,0x0b,0x60,0xc8,0x03,0xf1,0x1c,0x00,0x77,
+0x04,0xa9,0xdc,0xca,0x10,0x8a,0x00,0x02,0x00,0xf0,0x19,0x04,0xcf,0xd6,0x01,0xf5,
+0x04,0xf3,0x4a,0x00,0x0d,0x50,0x00,0x01,0xf1,0x00,0x00,0xc7,0x00,0x00,0xba,0x00,
+0x00,0xaa,0x00,0x00,0x9b,0x00,0x00,0x3f,0xff,0xff,0xc0,0x04,0xcf,0xd4,0x01,0xf5,
+0x04,0xf1,0x26,0x80,0x00,0xf0,0x25,0x05,0xe1,0x00,0x8f,0xf5,0x00,0x00,0x04,0xf3,
+0x25,0x00,0x0c,0x62,0xf3,0x03,0xf3,0x05,0xdf,0xd5,0x00,0x00,0x00,0xdb,0x00,0x00,
+0x08,0xfb,0x00,0x00,0x3e,0x8b,0x00,0x00,0xc5,0x7b,0x00,0x07,0xa0,0x7b,0x00,0x2e,
+0x10,0x7b,0x00,0x9f,0xff,0xff,0xf0,0x00,0x00,0x7b,0x00,0x04,0x00,0xf1,0x50,0x04,
+0xff,0xff,0x80,0x6c,0x11,0x10,0x07,0x90,0x00,0x00,0x9d,0xdd,0x70,0x05,0x72,0x4e,
+0x60,0x00,0x00,0x7b,0x07,0x10,0x07,0xb0,0xb9,0x01,0xd6,0x01,0xae,0xe8,0x00,0x00,
+0x3b,0xf5,0x00,0x3f,0x71,0x00,0x0b,0x70,0x00,0x00,0xf9,0xee,0x70,0x2f,0x90,0x3e,
+0x52,0xf0,0x00,0x99,0x0f,0x20,0x08,0x90,0xab,0x02,0xe4,0x00,0xae,0xe6,0x00,0x7f,
+0xff,0xff,0xb0,0x00,0x00,0xc5,0x00,0x00,0x3d,0x00,0x00,0x0b,0x60,0x00,0x03,0xe0,
+0x00,0x00,0xa8,0x00,0x00,0x2f,0x10,0x00,0x09,0x90,0x00,0x01,0xf2,0x00,0xf6,0x00,
+0xf0,0x31,0xd8,0x04,0xf2,0x0f,0x20,0x0d,0x50,0xc8,0x04,0xe1,0x02,0xff,0xf6,0x00,
+0xe6,0x03,0xe3,0x3e,0x00,0x0a,0x81,0xf5,0x02,0xe5,0x04,0xcf,0xe7,0x00,0x03,0xcf,
+0xc2,0x00,0xe6,0x07,0xe0,0x4e,0x00,0x0d,0x44,0xd0,0x00,0xb6,0x1f,0x60,0x5f,0x60,
+0x4d,0xf9,0xd5,0x00,0x00,0x1f,0x10,0x00,0x3c,0x90,0x01,0xfd,0x70,0x00,0x0e,0x30,
+0x50,0x00,0x01,0x00,0x51,0x40,0x1e,0x30,0x2e,0x10,0x0b,0x00,0xf0,0x11,0x01,0x90,
+0x2f,0x06,0xb0,0x41,0x00,0x00,0x00,0x68,0x01,0x8e,0xc4,0x6e,0x92,0x00,0x4d,0xc5,
+0x00,0x00,0x4c,0xe6,0x00,0x00,0x36,0x0e,0xee,0xee,0x30,0x11,0x11,0x10,0x24,0x00,
+0xf0,0x33,0xee,0xee,0xe3,0x01,0x11,0x11,0x00,0x2a,0x30,0x00,0x00,0x7d,0xc5,0x00,
+0x00,0x04,0xae,0x20,0x02,0x8e,0xa1,0x1b,0xf9,0x20,0x01,0x71,0x00,0x00,0x08,0xee,
+0xa0,0x5e,0x21,0xd7,0x12,0x00,0x99,0x00,0x02,0xe4,0x00,0x1e,0x70,0x00,0x9a,0x00,
+0x00,0x43,0x00,0x00,0x21,0x00,0x00,0xa7,0x00,0x00,0x03,0xbd,0xdc,0x70,0x00,0x00,
+0x6b,0x20,0x00,0x7b,0xc7,0x01,0xf1,0x1a,0x00,0x07,0x60,0x0a,0x30,0x2b,0xd9,0x00,
+0xb0,0x0e,0x00,0xd4,0x0e,0x00,0xc0,0x2b,0x04,0xb0,0x0e,0x00,0xc0,0x3a,0x07,0x80,
+0x1c,0x00,0xc0,0x2b,0x06,0x90,0x6c,0x04,0x90,0x0e,0x01,0xcb,0x5b,0xca,0x10,0x09,
+0x60,0x97,0x00,0xf0,0x21,0xd6,0x00,0x02,0x00,0x00,0x00,0x18,0xcc,0xda,0x00,0x00,
+0x00,0x07,0xf0,0x00,0x00,0x00,0xdc,0x50,0x00,0x00,0x4b,0x4c,0x00,0x00,0x0a,0x50,
+0xd2,0x00,0x01,0xd0,0x07,0x80,0x00,0x7f,0xee,0xee,0x00,0x0d,0x31,0x11,0xb5,0x03,
+0xe0,0x00,0x06,0xb0,0xa9,0xe5,0x00,0xf0,0x21,0xef,0xff,0xc3,0x0e,0x40,0x18,0xe0,
+0xe4,0x00,0x2f,0x1e,0x40,0x09,0xc0,0xef,0xff,0xf4,0x0e,0x40,0x05,0xf1,0xe4,0x00,
+0x0e,0x5e,0x40,0x05,0xf2,0xef,0xff,0xd4,0x00,0x00,0x7d,0xfd,0x60,0x08,0xe4,0x04,
+0xe5,0x0f,0x40,0x00,0x7b,0x3f,0x00,0x00,0x00,0x04,0x00,0xf2,0x27,0x2f,0x00,0x00,
+0x00,0x0f,0x40,0x00,0x7a,0x07,0xd3,0x03,0xe5,0x00,0x7e,0xfd,0x60,0xef,0xfe,0x91,
+0x0e,0x40,0x2a,0xd0,0xe4,0x00,0x0d,0x6e,0x40,0x00,0x8a,0xe4,0x00,0x07,0xbe,0x40,
+0x00,0x9a,0xe4,0x00,0x0d,0x7e,0x40,0x2a,0xd0,0xef,0xfe,0x91,0x00,0xef,0xff,0xfe,
+0xe4,0x00,0x00,0x03,0x00,0x37,0xef,0xff,0xf4,0x0c,0x00,0x47,0xff,0xef,0xff,0xfc,
+0x0f,0x00,0x15,0xf2,0x0c,0x00,0x20,0xe4,0x00,0x7a,0x00,0xb0,0x70,0x07,0xd4,0x03,
+0xd8,0x0f,0x40,0x00,0x36,0x2f,0x10,0x7a,0x00,0xf8,0x07,0x7f,0xfe,0x2f,0x10,0x00,
+0x5e,0x0e,0x50,0x00,0x5e,0x06,0xe4,0x01,0xad,0x00,0x6d,0xfe,0xa2,0xe4,0x00,0x00,
+0xf2,0x04,0x00,0x4c,0xef,0xff,0xff,0xf2,0x14,0x00,0x14,0xd6,0x01,0x00,0x10,0x00,
+0x79,0x03,0x2a,0x01,0xf2,0x07,0x00,0xf8,0x20,0x55,0x00,0x1f,0x26,0xe2,0x09,0xd0,
+0x08,0xef,0xb2,0x00,0xe4,0x00,0x2e,0x60,0xe4,0x01,0xd7,0x00,0xe4,0x1d,0x90,0x00,
+0xe5,0xca,0x00,0x00,0xee,0xfa,0x00,0x00,0xeb,0x2e,0x60,0x00,0xe4,0x04,0xf3,0x00,
+0xe4,0x00,0x7e,0x10,0xe4,0x00,0x0a,0xb0,0xa1,0x00,0x08,0x03,0x00,0xf0,0x22,0xef,
+0xff,0xfa,0xed,0x00,0x00,0x08,0xf4,0xef,0x40,0x00,0x0e,0xf4,0xeb,0xa0,0x00,0x5d,
+0xd4,0xe5,0xf1,0x00,0xc6,0xe4,0xe4,0xa7,0x02,0xf0,0xe4,0xe4,0x4e,0x09,0x90,0xf4,
+0xe4,0x0d,0x5e,0x20,0xf4,0xe4,0x06,0xfc,0x00,0xf4,0xe4,0x00,0xf5,0x00,0xf4,0xea,
+0xad,0x00,0xf0,0x27,0x40,0x00,0xf2,0xeb,0xe1,0x00,0xf2,0xe4,0xba,0x00,0xf2,0xe4,
+0x1f,0x50,0xf2,0xe4,0x06,0xe1,0xf2,0xe4,0x00,0xba,0xf2,0xe4,0x00,0x1f,0xf2,0xe4,
+0x00,0x06,0xf2,0x00,0x6d,0xfd,0x60,0x00,0x7e,0x41,0x5e,0x60,0x0f,0x50,0x00,0x6e,
+0x02,0xf0,0x00,0x01,0xf1,0x3f,0x00,0x00,0x0f,0x22,0x09,0x00,0x91,0x0f,0x50,0x00,
+0x5e,0x00,0x7e,0x41,0x4e,0x60,0x24,0x00,0xf3,0x04,0xef,0xff,0xd7,0x0e,0x40,0x03,
+0xe6,0xe4,0x00,0x08,0xae,0x40,0x02,0xd7,0xef,0xff,0xd8,0x0e,0x40,0x23,0x04,0x01,
+0x49,0x01,0x00,0x4a,0x01,0xf0,0x05,0x50,0x00,0x8e,0x41,0x5f,0x50,0x0f,0x40,0x00,
+0x7d,0x03,0xf0,0x00,0x02,0xf0,0x4e,0x00,0x00,0x1f,0x13,0x09,0x00,0xc0,0x0f,0x40,
+0x00,0x6d,0x00,0x8d,0x41,0x5e,0x50,0x00,0x7d,0xff,0xf1,0x04,0x10,0x1c,0x05,0x00,
+0xf0,0x21,0x03,0x00,0xff,0xff,0xc4,0x0f,0x40,0x06,0xf2,0xf4,0x00,0x0e,0x5f,0x40,
+0x06,0xf2,0xff,0xff,0xe3,0x0f,0x40,0x4e,0x00,0xf4,0x00,0xc8,0x0f,0x40,0x04,0xf1,
+0xf4,0x00,0x0c,0x80,0x02,0xbf,0xfa,0x10,0x0e,0x81,0x19,0xd0,0x2f,0x10,0x00,0xb1,
+0x0c,0xb3,0x62,0x00,0xf1,0x07,0xe8,0x00,0x00,0x00,0x2b,0xd0,0x48,0x00,0x00,0xf2,
+0x2f,0x60,0x07,0xf0,0x03,0xbf,0xfb,0x30,0xbf,0xff,0xff,0xf7,0xb6,0x03,0x0f,0x04,
+0x00,0x07,0x00,0x65,0x03,0x1f,0xa9,0x04,0x00,0x01,0xf0,0x1b,0x0f,0x20,0x00,0xb7,
+0x0b,0xb2,0x05,0xf2,0x01,0x9e,0xfc,0x40,0xaa,0x00,0x00,0x6e,0x04,0xf0,0x00,0x0c,
+0x80,0x0d,0x50,0x01,0xf2,0x00,0x8b,0x00,0x7c,0x00,0x01,0xf1,0x0c,0x60,0x00,0x0b,
+0x62,0xf0,0x00,0x00,0x5b,0x7a,0x6b,0x03,0x50,0x30,0x00,0x00,0x09,0xd0,0x4b,0x04,
+0x20,0x0d,0x70,0x24,0x01,0xf5,0x5e,0x1f,0xc0,0x05,0xe0,0x0f,0x30,0x6b,0xf1,0x08,
+0xa0,0x0b,0x60,0xb6,0xb5,0x0c,0x60,0x07,0xa0,0xf1,0x6a,0x0f,0x20,0x03,0xe4,0xc0,
+0x1e,0x4e,0x00,0x00,0xfa,0x70,0x0d,0xaa,0x00,0x00,0xcf,0x20,0x08,0xf6,0x00,0x00,
+0x8e,0x00,0x03,0xf2,0x00,0x3f,0x30,0x01,0xe6,0x09,0xc0,0x0a,0xb0,0x00,0xe6,0x4f,
+0x20,0x00,0x4f,0xd7,0x00,0x00,0x0c,0xf0,0x00,0x00,0x5f,0xd7,0x00,0x01,0xe6,0x4f,
+0x20,0x0a,0xc0,0x09,0xc0,0x4f,0x20,0x01,0xe7,0xab,0x00,0x00,0xe6,0x1f,0x40,0x07,
+0xd0,0x07,0xc0,0x1e,0x40,0x00,0xe4,0x8b,0x00,0x00,0x5d,0xe2,0x00,0x00,0x0d,0x90,
+0x00,0x00,0x0b,0x80,0x04,0x00,0xf0,0x08,0x6f,0xff,0xff,0xf1,0x00,0x00,0x0b,0xa0,
+0x00,0x00,0x7d,0x00,0x00,0x03,0xf3,0x00,0x00,0x0d,0x70,0x00,0x00,0x9c,0x00,0x17,
+0x05,0x40,0x00,0x1e,0x50,0x00,0xa7,0x04,0x5f,0xf4,0x1f,0xf4,0x1f,0x10,0x02,0x00,
+0x02,0xf0,0x00,0xf4,0x89,0x00,0x00,0x2e,0x00,0x00,0x0c,0x50,0x00,0x06,0xb0,0x00,
+0x00,0xf1,0x0a,0x04,0x00,0xcf,0x04,0xca,0x0d,0x40,0x00,0x07,0xa0,0x00,0x01,0xf1,
+0xef,0x70,0xb7,0x0b,0x03,0x00,0xf1,0x22,0xef,0x70,0x00,0x61,0x00,0x2f,0x80,0x08,
+0x9e,0x00,0xe1,0xa5,0x6b,0x04,0xc0,0xef,0xff,0xfc,0x4f,0x20,0x06,0xb0,0x02,0xcf,
+0xd4,0x00,0xf5,0x06,0xf0,0x02,0x00,0x1f,0x10,0x4b,0xdd,0xf2,0x2f,0x30,0x1f,0x23,
+0xf3,0x17,0xf2,0x08,0xee,0x7d,0x30,0x1f,0x10,0xbf,0x05,0x00,0x07,0x00,0xe0,0xf8,
+0xee,0x70,0x1f,0x80,0x3f,0x41,0xf1,0x00,0x99,0x1f,0x10,0x07,0xa1,0x07,0x00,0x60,
+0x80,0x3f,0x41,0xf7,0xee,0x70,0x3c,0x00,0xf0,0x02,0xe7,0x04,0xf1,0x4e,0x00,0x05,
+0x26,0xc0,0x00,0x00,0x4e,0x00,0x03,0x10,0xe6,0x03,0xe2,0x15,0x00,0x10,0x00,0xba,
+0x06,0x20,0x00,0xc6,0x07,0x00,0xd0,0x3c,0xfa,0xd6,0x0e,0x80,0x4f,0x64,0xe0,0x00,
+0xc6,0x5c,0x00,0x0c,0x07,0x00,0xd0,0x0e,0x60,0x3f,0x60,0x3c,0xeb,0xc6,0x02,0xbf,
+0xd3,0x00,0xd7,0x05,0x43,0x05,0xf6,0x0f,0x46,0xff,0xff,0xf6,0x4d,0x00,0x00,0x00,
+0xd7,0x01,0x91,0x02,0xbf,0xe7,0x00,0x00,0x9d,0x60,0x5d,0x20,0x08,0xa0,0x09,0xff,
+0xe1,0x08,0xa0,0x00,0x8a,0x00,0x05,0x00,0xf0,0x02,0x03,0xcf,0xac,0x60,0xe7,0x04,
+0xf6,0x4e,0x00,0x0c,0x65,0xd0,0x00,0xc6,0x4e,0x00,0x0c,0x0e,0x00,0xe7,0x03,0xcf,
+0xad,0x60,0x00,0x00,0xd5,0x0c,0x30,0x6f,0x10,0x4d,0xfc,0x40,0xb4,0x00,0xe6,0xf7,
+0xde,0x70,0x1f,0x90,0x4f,0x21,0xf1,0x00,0xe4,0x1f,0x10,0x0e,0x41,0x07,0x00,0x64,
+0x0e,0x20,0x30,0x0f,0x20,0xf2,0x03,0x00,0x6a,0x01,0xe1,0x00,0x40,0x01,0xf1,0x02,
+0x00,0x47,0x04,0xf0,0x5f,0x80,0x49,0x00,0xf7,0x09,0xf1,0x09,0xc0,0x1f,0x18,0xd1,
+0x01,0xf8,0xe1,0x00,0x1f,0xfe,0x10,0x01,0xf3,0xab,0x00,0x1f,0x10,0xd7,0x01,0xf1,
+0x03,0xf3,0x46,0x00,0x00,0x03,0x00,0xfc,0x07,0x2f,0x7e,0xf7,0x5e,0xfa,0x02,0xf8,
+0x04,0xfb,0x12,0xe5,0x2f,0x10,0x0e,0x40,0x0a,0x82,0xf1,0x00,0xe4,0x00,0xa8,0x0b,
+0x00,0x89,0x80,0x1f,0x6d,0xe7,0x01,0xf9,0x04,0xf2,0x94,0x00,0x00,0x07,0x00,0xf5,
+0x23,0x40,0x02,0xbf,0xd5,0x00,0xd8,0x03,0xe4,0x4e,0x00,0x08,0xa6,0xc0,0x00,0x6c,
+0x4e,0x00,0x08,0xb0,0xd7,0x03,0xe5,0x02,0xbf,0xd6,0x00,0x1f,0x8d,0xe7,0x01,0xf6,
+0x02,0xf4,0x1f,0x10,0x09,0x91,0xf1,0x00,0x8a,0x1f,0x10,0x0a,0x91,0xf7,0x03,0xf3,
+0x1f,0x9e,0xe7,0xa0,0x00,0x54,0x00,0x00,0x03,0xcf,0xbc,0x1a,0x01,0x13,0xc0,0x1a,
+0x01,0x54,0x03,0xf6,0x03,0xcf,0xbd,0x84,0x01,0x01,0x07,0x00,0xa4,0x01,0xf9,0xf3,
+0x1f,0x81,0x01,0xf1,0x00,0x1f,0x10,0x05,0x00,0xf2,0x12,0x05,0xdf,0xc3,0x00,0xf4,
+0x08,0xd0,0x0f,0x60,0x01,0x00,0x3b,0xeb,0x30,0x12,0x00,0x7e,0x03,0xf3,0x05,0xe0,
+0x06,0xdf,0xd4,0x00,0x05,0x30,0x0b,0x70,0xdf,0xfb,0x0b,0x70,0x02,0x00,0xb3,0x0a,
+0x90,0x04,0xeb,0x2f,0x00,0x0e,0x42,0xf0,0x00,0xe4,0x07,0x00,0xf0,0x63,0x1f,0x00,
+0x0e,0x40,0xf6,0x06,0xf4,0x05,0xee,0x9e,0x40,0x99,0x00,0x4e,0x04,0xe0,0x0a,0x80,
+0x0e,0x30,0xe2,0x00,0x89,0x4d,0x00,0x03,0xe9,0x70,0x00,0x0d,0xf2,0x00,0x00,0x7c,
+0x00,0x00,0x99,0x00,0xc7,0x00,0xd5,0x4d,0x01,0xfc,0x01,0xf0,0x0f,0x15,0x9e,0x15,
+0xc0,0x0b,0x5a,0x49,0x69,0x70,0x07,0xae,0x04,0xbd,0x20,0x02,0xfa,0x00,0xee,0x00,
+0x00,0xe5,0x00,0xa9,0x00,0x5e,0x10,0x9c,0x00,0xb9,0x3f,0x20,0x01,0xed,0x70,0x00,
+0x09,0xf0,0x00,0x02,0xfc,0x80,0x00,0xb8,0x2f,0x30,0x6e,0x00,0x8c,0x00,0xb9,0x00,
+0x6d,0x5e,0x00,0xb7,0x0f,0x40,0xf2,0x0a,0x95,0xd0,0x04,0xea,0x70,0x00,0xef,0x20,
+0x16,0x03,0xb1,0x97,0x00,0x03,0xe1,0x00,0x6e,0x60,0x00,0x6f,0xff,0xfd,0x1f,0x03,
+0x50,0x0c,0x90,0x00,0x08,0xd0,0x8f,0x03,0x30,0x01,0xe6,0x00,0x4b,0x03,0xf0,0x05,
+0x00,0x00,0x08,0x10,0x0b,0x80,0x02,0xf0,0x00,0x3e,0x00,0x04,0xe0,0x00,0x9b,0x00,
+0x9f,0x30,0x00,0x8b,0x0a,0x00,0x40,0x3e,0x00,0x02,0xf0,0x6e,0x03,0x36,0x08,0x10,
+0xe1,0x01,0x00,0xf3,0x19,0x72,0x00,0x3e,0x20,0x0a,0x80,0x08,0x90,0x08,0xa0,0x05,
+0xd1,0x00,0xcf,0x05,0xd1,0x08,0xa0,0x08,0x90,0x0a,0x80,0x3e,0x20,0x73,0x00,0x03,
+0xdc,0x20,0x0d,0x00,0xe5,0x6e,0x25,0xb0,0x1c,0x00,0x6f,0xe3,0x00,0x01,0x00,0x10,
+0x30,0x05,0x00,0x10,0x4f,0xca,0x07,0xf0,0x10,0x04,0xee,0x40,0x0c,0xff,0xff,0xfc,
 0x3e,0x40,0xe4,0x22,0x22,0x00,0x4e,0x3e,0x20,0x00,0x00,0x00,0x8d,0xe3,0x11,0x11,
 0x00,0x3e,0x4d,0xff,0xff,0xfb,0x3e,0x40,0x21,0x00,0x10,0x50,0x2c,0x00,0x10,0x60,
 0x5e,0x07,0x15,0x40,0x3c,0x00,0x10,0x5f,0x0b,0x00,0x20,0x4e,0xe4,0x05,0x00,0x11,
@@ -432,1444 +475,1592 @@ static const uint8_t lz4FontData[] ={
 0x00,0x80,0xf3,0x13,0xf0,0x00,0x00,0x0d,0xff,0xfd,0x84,0x03,0x20,0xff,0xfc,0x11,
 0x00,0x3d,0x23,0xf0,0x00,0x27,0x00,0xf0,0x0a,0x33,0xf2,0x02,0xf3,0x30,0x3f,0xfd,
 0x10,0x1d,0xff,0x30,0x6e,0x30,0x00,0x3e,0x60,0x00,0x5e,0x40,0x4e,0x50,0x00,0x00,
-0x4e,0x8e,0x76,0x00,0x26,0x3c,0x30,0xe3,0x22,0x11,0xa0,0x91,0x00,0x00,0xd2,0x00,
-0xf0,0x5c,0x0e,0xfe,0x00,0x00,0x00,0x06,0xf4,0xf6,0x00,0x00,0x00,0xe9,0x09,0xe0,
-0x00,0x00,0x7f,0x10,0x1f,0x70,0x00,0x1f,0x80,0x00,0x8f,0x10,0x08,0xe0,0x00,0x00,
-0xe8,0x01,0xfc,0x88,0x88,0x8c,0xf1,0x9f,0xff,0xff,0xff,0xff,0x90,0x00,0x00,0x00,
-0x3b,0xc5,0x00,0x00,0x02,0x1e,0x86,0xf2,0x00,0x4d,0xf7,0xf0,0x0d,0x50,0x4f,0x60,
-0x7f,0xb9,0xf1,0x0e,0x60,0x09,0xff,0xe6,0x04,0xe0,0x00,0xcf,0xa1,0xd4,0x5c,0x00,
-0x0e,0x60,0x0c,0x63,0xe0,0x01,0x20,0x00,0xe4,0x0e,0x60,0x00,0x00,0x6e,0x00,0x4f,
-0x70,0x00,0x7f,0x50,0x00,0x4d,0xfe,0xfd,0x40,0x00,0x00,0x02,0x42,0x3b,0x01,0x01,
-0x13,0x09,0xf0,0x06,0xbf,0xff,0x72,0x00,0x08,0xc1,0xdf,0xc3,0xf5,0x04,0x98,0x02,
-0xe2,0x07,0xb4,0x5d,0x00,0x01,0x00,0x1b,0x4d,0x5f,0x00,0xf0,0x12,0xbe,0x68,0x00,
-0x00,0x00,0x09,0x6a,0xd0,0x00,0x00,0x00,0xb9,0x1a,0xa0,0x00,0x00,0x9d,0x00,0x88,
-0xc4,0x25,0xb9,0x60,0x00,0x69,0xe9,0xf6,0x70,0x00,0x00,0x05,0x25,0x00,0x27,0x23,
-0xf0,0x19,0x32,0x00,0x00,0x01,0xee,0xef,0xef,0xd5,0x00,0x0d,0x90,0xbc,0x10,0x5f,
-0x70,0x0b,0xc1,0x0b,0xd0,0x03,0xf3,0x07,0xfd,0x1a,0xc0,0x00,0x99,0x0b,0x7a,0xfc,
-0x10,0x00,0x5c,0x0b,0x60,0x61,0x00,0x00,0x5c,0x08,0xe4,0x00,0xf3,0x04,0x89,0x01,
-0xf4,0x00,0x00,0x02,0xf3,0x00,0x6f,0x60,0x00,0x5e,0x70,0x00,0x04,0xdf,0xef,0xd5,
-0x00,0x8a,0x00,0xf0,0x2a,0x0c,0xee,0xee,0xee,0x10,0x01,0xfa,0x66,0x6b,0xb0,0x00,
-0x6f,0x10,0x00,0xd5,0x00,0x0b,0xb0,0x00,0x5e,0x00,0x00,0x7e,0x00,0x6d,0x40,0x00,
-0x2d,0xf3,0x7b,0x10,0x00,0x0d,0x8b,0x3d,0xd0,0x00,0x03,0xf0,0xd4,0x8e,0x30,0x00,
-0x3f,0x15,0x10,0xf3,0x00,0x00,0xd8,0x00,0x8d,0x00,0x00,0x02,0xdf,0xfd,0xba,0x01,
-0x20,0x33,0x00,0xa8,0x00,0xf0,0x24,0xaa,0x60,0x00,0x00,0xef,0xfa,0x10,0xcb,0xbb,
-0xba,0xaa,0xbc,0x00,0x00,0x00,0x0b,0xc0,0x5f,0xff,0xd0,0xbc,0x00,0x22,0x21,0x0c,
-0xc0,0x13,0x33,0x20,0xcc,0x05,0xee,0xec,0x0c,0xb0,0x00,0x00,0x00,0xc9,0xcb,0xde,
-0xed,0xb9,0x00,0x0e,0xff,0xa0,0x00,0x00,0x56,0x63,0x38,0x00,0xf0,0x08,0x57,0x62,
-0x04,0x00,0x06,0xef,0xff,0xf1,0xad,0x47,0xfb,0x30,0x24,0x0a,0x39,0xfa,0x00,0x00,
-0x00,0xa2,0x03,0xc5,0x00,0xce,0x0b,0xf0,0x0f,0xc8,0x00,0x00,0xa2,0x00,0x98,0x00,
-0x00,0x0a,0x22,0xc6,0x00,0x00,0x00,0xa7,0xcf,0xb0,0x00,0x00,0x0a,0xa0,0x5f,0xc5,
-0x23,0x50,0x20,0x00,0x4d,0xff,0xff,0x90,0x07,0xf0,0x19,0x54,0x00,0x89,0x99,0x99,
-0x99,0x8c,0x2f,0xd1,0x11,0x2b,0xb0,0x65,0x06,0xef,0xfb,0x0b,0x93,0xdf,0xff,0xb0,
-0xfd,0x00,0x69,0xdb,0x02,0x20,0x00,0x0b,0xb0,0xeb,0x00,0x00,0xbb,0x0f,0xd0,0x00,
-0x0b,0xb0,0x76,0x09,0x00,0x81,0xe0,0x00,0x0b,0xea,0xff,0xaa,0xaa,0xe0,0xf2,0x01,
-0xf0,0x2b,0x18,0xde,0xd8,0x10,0x00,0x3e,0xad,0x6a,0xbe,0x30,0x1e,0x70,0xc5,0x70,
-0x7e,0x18,0xb0,0x0c,0x57,0x00,0xb8,0xc5,0x00,0xbd,0x60,0x05,0xce,0x30,0x24,0x06,
-0x90,0x2e,0xd4,0x4b,0xe3,0xe7,0xc7,0xd9,0xcb,0x8b,0x04,0xc6,0xd9,0x2f,0xa9,0x00,
-0x00,0xbf,0x20,0x5f,0x71,0x01,0x7e,0x50,0x00,0x3b,0xff,0xfb,0x37,0x02,0x10,0x20,
-0x8f,0x0a,0x70,0x80,0x00,0x00,0x03,0xe6,0x4b,0xb0,0x93,0x06,0xf2,0x22,0x0f,0x12,
-0x62,0x0a,0x60,0x00,0xe7,0xff,0xf4,0x6d,0x10,0x6d,0xbf,0xff,0xb0,0x9f,0xef,0x7a,
-0xff,0xfa,0x07,0xe9,0xcf,0xff,0xfe,0x23,0xe1,0x4f,0xff,0xff,0xe1,0x96,0x1e,0xff,
-0xff,0xff,0x8c,0x38,0xff,0xff,0xff,0xfb,0xcf,0xfd,0xdd,0xdd,0xdd,0x90,0x11,0x77,
-0x02,0x20,0x61,0x00,0x6b,0x03,0x11,0xd2,0x06,0x00,0xf1,0x05,0xe3,0x00,0x02,0x43,
-0x33,0x37,0xe3,0x00,0xaf,0xff,0xff,0xff,0xf4,0x03,0x66,0x66,0x66,0x66,0x60,0x09,
-0x67,0x02,0x90,0x08,0xf9,0x88,0x88,0x95,0x00,0x07,0xd1,0x00,0x99,0x02,0x01,0x06,
-0x00,0x25,0x05,0x90,0xb9,0x02,0x20,0x68,0x50,0xc1,0x01,0xf0,0x24,0x48,0xc9,0x10,
-0x00,0x00,0x8c,0xa4,0x4c,0x30,0x00,0x03,0x22,0x8b,0x20,0x00,0x00,0x5a,0xc5,0x10,
-0x00,0x06,0x86,0x97,0x30,0x00,0x1c,0xb0,0x10,0xab,0x00,0x0a,0xf2,0x7f,0x82,0xf9,
-0x00,0xaf,0x29,0xfa,0x1f,0x90,0x01,0xda,0x04,0x09,0xd1,0x00,0x01,0x8b,0x9a,0x81,
-0x76,0x02,0xfa,0x0a,0xfd,0x10,0x0d,0x63,0x36,0x9d,0x10,0xd3,0x00,0xb0,0xbd,0x0d,
-0x30,0x0a,0xc9,0xe3,0xd3,0x00,0x00,0x0d,0x3d,0x30,0x00,0x00,0xd3,0x09,0x00,0x91,
-0x40,0x00,0x00,0xd3,0xcf,0xff,0xff,0xff,0x20,0x72,0x00,0x20,0x03,0x53,0x06,0x00,
-0xf0,0x2b,0xa9,0x6a,0x90,0x00,0x00,0x06,0x70,0x00,0x8d,0xc7,0x00,0x0a,0x10,0x00,
-0x00,0x09,0x40,0x1d,0x10,0x00,0x47,0x33,0x90,0xa3,0x38,0xcf,0xda,0x33,0x80,0xc0,
-0x68,0x58,0x00,0x04,0xb0,0xb0,0x00,0x4f,0x90,0x00,0xa2,0xa1,0x00,0xdf,0xf3,0x00,
-0x83,0x2c,0x20,0x00,0x00,0x01,0xc0,0x02,0xbb,0xbb,0xbb,0xbb,0x3f,0x01,0x11,0x4d,
-0xf2,0x00,0xf0,0x1b,0xf0,0x87,0x00,0x00,0x00,0x7f,0x2f,0x40,0x19,0xd8,0x6e,0xae,
-0x30,0x0a,0xb3,0x7b,0x60,0xd4,0x01,0xf1,0x00,0x9b,0x4f,0x20,0x5b,0x00,0x01,0xbf,
-0x60,0x08,0x70,0x00,0x04,0xf0,0x00,0xa5,0x00,0x00,0x4f,0x00,0x0c,0x30,0x0b,0x00,
-0x10,0xe2,0x0b,0x00,0x02,0x01,0x00,0xe0,0x08,0xd7,0x01,0xc0,0xd0,0x09,0xd7,0x00,
-0x08,0xa1,0x1f,0xf7,0x0c,0xe3,0x01,0x01,0xf1,0x00,0xc5,0x00,0x00,0x05,0xae,0x82,
-0x00,0x00,0x09,0xf3,0x02,0x8d,0xb4,0x02,0xe7,0x68,0x0c,0xd0,0x02,0xff,0xff,0xf2,
-0x00,0x00,0x00,0x0a,0x00,0x02,0xbb,0xbd,0x50,0x43,0x03,0xf1,0x14,0xa3,0x0d,0x00,
-0x00,0x00,0x0d,0x00,0xd0,0x00,0x00,0x07,0x70,0x0d,0x11,0x00,0x01,0xc0,0x00,0xcb,
-0xb2,0x00,0xb3,0x00,0x0c,0x00,0x00,0x96,0x00,0x00,0xc0,0x00,0x66,0x00,0x00,0x0c,
-0x5f,0x00,0x00,0xe9,0x09,0x03,0x0b,0x00,0xa1,0x90,0x00,0x02,0x33,0x30,0x0c,0x00,
-0x00,0x88,0x8c,0x42,0x00,0x20,0xb1,0x0d,0xf4,0x03,0x00,0x42,0x00,0xe1,0x1c,0x20,
-0x0d,0xdd,0x10,0x1c,0x30,0x00,0xd0,0x00,0x3b,0x20,0x00,0x0d,0x2c,0x00,0x10,0xd0,
-0x3a,0x00,0x25,0x07,0x00,0x0e,0x00,0x00,0x13,0x03,0xc1,0xcc,0xcc,0xc2,0x00,0x00,
-0x11,0x10,0x09,0x00,0x00,0xaa,0xad,0x42,0x00,0x10,0xc1,0x1e,0x00,0xb0,0x69,0x00,
-0xdc,0xc0,0x00,0x6b,0x00,0x0d,0x00,0x01,0xa8,0x34,0x00,0x20,0x11,0x00,0x9e,0x0c,
-0x30,0x0b,0xdd,0xdc,0x9a,0x02,0x00,0x3f,0x00,0x71,0x0e,0xdd,0xdd,0xb0,0x00,0x00,
-0xe0,0x87,0x00,0x00,0x42,0x00,0x00,0x4d,0x03,0x60,0x00,0x00,0xbb,0xbd,0x60,0xc0,
-0xc6,0x00,0x00,0x9a,0x00,0xf0,0x0a,0x1d,0x00,0xcd,0xc1,0x00,0x0b,0x40,0x0c,0x00,
-0x00,0x2c,0x50,0x00,0xc0,0x00,0x29,0x20,0x00,0x09,0x00,0x00,0x0b,0xcc,0xcc,0xb0,
-0x79,0x00,0x00,0x42,0x00,0x01,0x81,0x00,0x10,0xe0,0xc6,0x00,0x31,0x09,0xbb,0xbb,
-0x2f,0x02,0xf0,0x24,0x07,0x40,0x00,0x9b,0xbc,0x80,0x84,0x00,0x00,0x00,0x76,0x08,
-0x40,0x00,0x00,0x0c,0x10,0x8d,0xc1,0x00,0x08,0x80,0x08,0x40,0x00,0x1a,0x90,0x00,
-0x84,0x00,0x0a,0x30,0x00,0x06,0x30,0x00,0x08,0x00,0x80,0x90,0x00,0x00,0xc0,0x0b,
-0x0d,0x00,0x00,0x0f,0xdd,0xb3,0xf2,0x0b,0x00,0x72,0xb6,0xa0,0x00,0x0c,0xbb,0xa7,
-0x08,0xfc,0x01,0x02,0xd9,0x00,0x40,0x0b,0xbb,0xd5,0x0d,0x59,0x01,0xb0,0x30,0xd0,
-0x00,0x00,0x01,0xd0,0x0d,0xdc,0x00,0x00,0xb4,0x6e,0x00,0xf4,0x15,0xa6,0x00,0x0d,
-0x00,0x02,0xb4,0x00,0x00,0xb0,0x00,0x00,0x05,0xaa,0x71,0x00,0x00,0x06,0xa1,0x05,
-0xb0,0x00,0x00,0xb2,0x00,0x0c,0x10,0x00,0x09,0x50,0x01,0xd0,0x00,0x00,0x1a,0xbb,
-0xb3,0x45,0x00,0x4e,0x11,0x10,0x0b,0x00,0x13,0x01,0x10,0x5c,0xbb,0x00,0x10,0x9a,
-0x63,0x00,0x41,0x23,0x00,0x00,0x04,0xd1,0x00,0x13,0xb1,0x4a,0x01,0x43,0x0f,0xcc,
-0xcc,0xc0,0x9a,0x01,0x45,0x0d,0xcc,0xcc,0xc3,0x47,0x00,0xf0,0x1b,0x90,0xb0,0x1a,
-0xaa,0xc0,0xc0,0xc0,0x00,0x03,0xa0,0xc0,0xc0,0x00,0x07,0x60,0xc0,0xc0,0x00,0x0c,
-0x10,0xda,0xe0,0x00,0x3b,0x00,0xc1,0xc0,0x00,0xb2,0x00,0xb0,0xc0,0x06,0x80,0x00,
-0xb0,0xc0,0x3b,0x00,0x00,0xb0,0xc0,0xd9,0x01,0x05,0x05,0x00,0x10,0x40,0xb8,0x06,
-0xf0,0x1b,0x80,0x73,0x0b,0xbb,0xe0,0xd0,0x84,0x00,0x02,0xc0,0xc0,0x84,0x00,0x09,
-0x50,0xcb,0xd4,0x00,0x4c,0x00,0xc0,0x84,0x03,0xc1,0x00,0xc0,0x84,0x2a,0x10,0x00,
-0x60,0x73,0x00,0x00,0x5a,0xa7,0x10,0x00,0x07,0xa2,0x15,0xc0,0xc4,0x00,0x30,0xb2,
-0x00,0x0a,0xc6,0x00,0x42,0x01,0xab,0xbb,0x40,0x7d,0x00,0xf3,0x15,0x01,0x10,0x00,
-0xa0,0xab,0xab,0xb0,0x0c,0x00,0x00,0x58,0x00,0xc0,0x00,0x0a,0x30,0x0c,0x00,0x02,
-0xb2,0x66,0xc0,0x00,0xb3,0x26,0x6c,0x00,0x77,0x00,0x00,0xc0,0x5a,0x00,0x00,0x0c,
-0x19,0x4e,0x02,0x01,0x4d,0x02,0x10,0xb0,0xba,0x03,0xf0,0x10,0x00,0x01,0x10,0x07,
-0x02,0xaa,0xae,0x00,0xb1,0x00,0x02,0xb0,0x0a,0x10,0x00,0x76,0x8a,0xe1,0x00,0x2c,
-0x01,0x2b,0x10,0x2c,0x20,0x00,0xa1,0x4c,0x20,0x00,0x0a,0x18,0x04,0x80,0xa1,0x00,
-0x93,0x00,0x07,0x00,0x0a,0x30,0xec,0x01,0x00,0xf3,0x03,0x30,0xcc,0xcc,0xb2,0x4b,
-0x02,0xf0,0x1a,0x13,0xbb,0xbe,0x10,0xa2,0x00,0x00,0xd0,0x0a,0x20,0x00,0x69,0x9c,
-0xe2,0x00,0x2d,0x10,0x0a,0x20,0x4c,0x20,0x00,0xa2,0x59,0x10,0x00,0x05,0x00,0x06,
-0xaa,0xab,0xb0,0x00,0xb4,0x11,0x1b,0x20,0x0b,0x20,0x00,0xa2,0xaa,0x00,0xd4,0x20,
-0x06,0xbb,0xbb,0xa0,0x00,0x01,0x00,0x70,0xa0,0x3b,0xbc,0x80,0x1a,0x01,0xf0,0x0a,
-0x0a,0x20,0xc0,0xc0,0x00,0x0d,0x69,0xe0,0xc0,0x00,0x58,0x12,0xc0,0xc0,0x00,0xc1,
-0x00,0xc0,0xc0,0x08,0x70,0x00,0xc0,0xc0,0x4a,0x15,0x01,0x19,0x10,0x1f,0x01,0x10,
-0x70,0xef,0x29,0x60,0x70,0x0b,0xbb,0xe0,0xc0,0xc1,0x1f,0x01,0x60,0xb1,0x00,0x09,
-0xbc,0xf0,0xb1,0x1f,0x01,0xf0,0x04,0xb1,0x03,0xc1,0x00,0xc1,0xc0,0x2a,0x10,0x00,
-0x70,0x80,0x00,0x00,0x80,0x08,0x00,0x00,0x03,0xa0,0x64,0x02,0xd0,0xd1,0x6f,0x30,
-0x00,0x3a,0x4b,0xc2,0xc3,0x00,0x80,0x07,0x30,0x16,0x1a,0x01,0x13,0xa1,0x1a,0x01,
-0xf8,0x0a,0x55,0xc0,0x00,0x0b,0x37,0x7c,0x00,0x03,0xb0,0x00,0xc0,0x00,0xc2,0x00,
-0x0c,0x00,0x86,0x06,0xcc,0xc0,0x78,0x00,0x00,0x0b,0x37,0x1a,0x01,0x11,0xc0,0x1a,
-0x01,0xf2,0x0d,0x11,0x20,0x00,0x90,0x8a,0x9b,0x80,0x0c,0x00,0x00,0x95,0xbc,0xc0,
-0x00,0x1d,0x00,0x0c,0x00,0x0b,0x55,0xbb,0xc0,0x1b,0x60,0x00,0x0c,0x0a,0x20,0x24,
-0x00,0x62,0x01,0x00,0x4c,0xbb,0xbb,0xc0,0x24,0x03,0x02,0x18,0x02,0x14,0x0c,0x08,
-0x02,0xf0,0x0a,0x07,0x03,0xaa,0xae,0x10,0xb2,0x00,0x01,0xc2,0xbe,0x20,0x00,0xa4,
-0x00,0xb2,0x00,0x97,0x08,0xce,0x23,0xb5,0x00,0x00,0xb1,0x20,0xb4,0x0d,0x12,0x0a,
-0x5b,0x03,0x30,0x0c,0x00,0x0c,0x59,0x03,0x10,0xd1,0xbc,0x02,0x00,0x44,0x02,0xf5,
-0x26,0x11,0x10,0x00,0x80,0x8a,0xab,0x90,0x1c,0x00,0x00,0x85,0xbc,0xc0,0x00,0x0d,
-0x10,0x0c,0x00,0x09,0x65,0xbb,0xc0,0x09,0x80,0x00,0x1c,0x0b,0x50,0x00,0x01,0xb0,
-0x00,0x18,0xba,0x50,0x00,0x0c,0x40,0x1a,0x60,0x02,0xb0,0x00,0x1b,0x00,0x1d,0x10,
-0x06,0x90,0x00,0x5c,0xbb,0xa1,0x34,0x08,0x00,0x8f,0x00,0xf0,0x04,0x90,0xb0,0x4b,
-0xbc,0x80,0xb0,0xc0,0x00,0x07,0x50,0xb0,0xc0,0x00,0x0a,0x6c,0xf0,0xc0,0x00,0x0d,
-0x6a,0x02,0x10,0x67,0x05,0x00,0xa0,0xd1,0xbb,0xe0,0xc0,0x09,0x60,0x00,0xb0,0xc0,
-0x59,0x7e,0x02,0x13,0x20,0x83,0x02,0x01,0x05,0x00,0x74,0x50,0x80,0x02,0xbb,0xcc,
-0xca,0x00,0xc9,0x00,0x13,0x0d,0x70,0x04,0x30,0x03,0x90,0x1b,0x68,0x13,0x62,0x29,
-0x00,0x00,0x04,0x90,0x00,0x05,0x00,0x94,0x8c,0xcc,0xcc,0xcc,0xc8,0x00,0xbc,0xcc,
-0xcb,0x28,0x00,0x20,0x10,0x0c,0x30,0x01,0x01,0x05,0x00,0xc2,0x02,0x00,0x7a,0xaa,
-0xea,0xaa,0xa7,0x12,0x22,0x22,0x22,0x21,0x90,0x00,0x40,0xcc,0xcc,0xce,0x20,0x2b,
-0x02,0x15,0x30,0x05,0x00,0x03,0xb7,0x03,0x03,0x41,0x00,0x1c,0x0c,0x41,0x00,0x70,
-0x7b,0xbb,0xeb,0xbb,0xb7,0x01,0x11,0x99,0x11,0x10,0x60,0x71,0x03,0x10,0xd0,0x32,
-0x00,0x60,0xfc,0xcc,0xbe,0x20,0x00,0xd0,0x7f,0x07,0x66,0xcb,0xbb,0xbc,0x00,0x00,
-0xcc,0x7d,0x00,0x00,0x0a,0x05,0x21,0x01,0xb0,0x05,0x00,0x72,0x03,0x00,0x8c,0xcc,
-0xec,0xcc,0xc7,0x5f,0x00,0x80,0x06,0xaa,0x70,0x00,0x00,0x98,0x11,0x7b,0x72,0x04,
-0x21,0x0d,0x00,0x5b,0x13,0x46,0x00,0x2b,0xbb,0xb2,0x2a,0x01,0xa0,0x37,0x00,0x0b,
-0xbc,0xd8,0x03,0x90,0x00,0x00,0x03,0xde,0x00,0xf0,0x06,0x00,0x39,0x02,0xa0,0x00,
-0x03,0x03,0x80,0x2a,0x00,0x00,0xb0,0x57,0x02,0xec,0x60,0x0b,0x16,0x50,0x2a,0x00,
-0x12,0x03,0xb1,0xa0,0x00,0x1b,0x33,0x44,0x2a,0x00,0x4a,0xa9,0x97,0x33,0x91,0x09,
-0x11,0x3a,0xd6,0x00,0x12,0x70,0x6c,0x01,0xb0,0x00,0x8a,0xaa,0x60,0xa2,0x00,0x01,
-0x22,0x2d,0x0a,0x20,0xfd,0x01,0xf0,0x07,0x92,0x00,0x00,0x51,0x0c,0x09,0x20,0x00,
-0x09,0x30,0x70,0x9d,0xc1,0x00,0x93,0x12,0x2a,0x30,0x07,0xbb,0xba,0x84,0x31,0x03,
-0x01,0xcc,0x04,0x32,0x20,0x00,0x72,0x3f,0x03,0x02,0x49,0x03,0xa8,0x00,0x6c,0xcc,
-0xcc,0x30,0x00,0x03,0xbb,0xcc,0xc9,0x71,0x01,0xd0,0x00,0x00,0x1b,0x00,0x00,0x55,
-0x0b,0x29,0x00,0x00,0x76,0x0c,0x26,0x05,0x00,0x12,0x00,0x05,0x00,0x00,0x76,0x01,
-0x03,0xdb,0x00,0x46,0x03,0xbb,0xbb,0xbc,0xd0,0x05,0x07,0x20,0x06,0x89,0x05,0x00,
-0x0a,0xbb,0xbb,0xbb,0xbc,0x80,0x66,0x00,0x11,0xa2,0x0b,0x00,0x13,0x20,0xdb,0x07,
-0x26,0x01,0xbb,0x77,0x01,0x07,0x05,0x00,0xa1,0x02,0x00,0x7c,0xcc,0xdd,0xcc,0xc8,
-0x00,0x00,0x57,0xfe,0x08,0x01,0xb8,0x01,0x24,0xbe,0x30,0x44,0x00,0x02,0x05,0x00,
+0x4e,0x8e,0x76,0x00,0x35,0x3c,0x30,0x00,0x01,0x00,0x11,0xa0,0x91,0x00,0x00,0xd2,
+0x00,0xf0,0x5c,0x0e,0xfe,0x00,0x00,0x00,0x06,0xf4,0xf6,0x00,0x00,0x00,0xe9,0x09,
+0xe0,0x00,0x00,0x7f,0x10,0x1f,0x70,0x00,0x1f,0x80,0x00,0x8f,0x10,0x08,0xe0,0x00,
+0x00,0xe8,0x01,0xfc,0x88,0x88,0x8c,0xf1,0x9f,0xff,0xff,0xff,0xff,0x90,0x00,0x00,
+0x00,0x3b,0xc5,0x00,0x00,0x02,0x1e,0x86,0xf2,0x00,0x4d,0xf7,0xf0,0x0d,0x50,0x4f,
+0x60,0x7f,0xb9,0xf1,0x0e,0x60,0x09,0xff,0xe6,0x04,0xe0,0x00,0xcf,0xa1,0xd4,0x5c,
+0x00,0x0e,0x60,0x0c,0x63,0xe0,0x01,0x20,0x00,0xe4,0x0e,0x60,0x00,0x00,0x6e,0x00,
+0x4f,0x70,0x00,0x7f,0x50,0x00,0x4d,0xfe,0xfd,0x40,0x00,0x00,0x02,0x42,0x3b,0x01,
+0x01,0x13,0x09,0xf0,0x06,0xbf,0xff,0x72,0x00,0x08,0xc1,0xdf,0xc3,0xf5,0x04,0x98,
+0x02,0xe2,0x07,0xb4,0x5d,0x00,0x01,0x00,0x1b,0x4d,0x5f,0x00,0xf0,0x3e,0xbe,0x68,
+0x00,0x00,0x00,0x09,0x6a,0xd0,0x00,0x00,0x00,0xb9,0x1a,0xa0,0x00,0x00,0x9d,0x00,
+0x88,0xc4,0x25,0xb9,0x60,0x00,0x69,0xe9,0xf6,0x70,0x00,0x00,0x05,0x25,0x00,0x00,
+0x00,0x28,0x01,0x32,0x00,0x00,0x01,0xee,0xef,0xef,0xd5,0x00,0x0d,0x90,0xbc,0x10,
+0x5f,0x70,0x0b,0xc1,0x0b,0xd0,0x03,0xf3,0x07,0xfd,0x1a,0xc0,0x00,0x99,0x0b,0x7a,
+0xfc,0x10,0x00,0x5c,0x0b,0x60,0x61,0x00,0x00,0x5c,0x08,0xe4,0x00,0xf3,0x04,0x89,
+0x01,0xf4,0x00,0x00,0x02,0xf3,0x00,0x6f,0x60,0x00,0x5e,0x70,0x00,0x04,0xdf,0xef,
+0xd5,0x00,0x8a,0x00,0xf0,0x2a,0x0c,0xee,0xee,0xee,0x10,0x01,0xfa,0x66,0x6b,0xb0,
+0x00,0x6f,0x10,0x00,0xd5,0x00,0x0b,0xb0,0x00,0x5e,0x00,0x00,0x7e,0x00,0x6d,0x40,
+0x00,0x2d,0xf3,0x7b,0x10,0x00,0x0d,0x8b,0x3d,0xd0,0x00,0x03,0xf0,0xd4,0x8e,0x30,
+0x00,0x3f,0x15,0x10,0xf3,0x00,0x00,0xd8,0x00,0x8d,0x00,0x00,0x02,0xdf,0xfd,0xba,
+0x01,0x20,0x33,0x00,0xa8,0x00,0xf0,0x24,0xaa,0x60,0x00,0x00,0xef,0xfa,0x10,0xcb,
+0xbb,0xba,0xaa,0xbc,0x00,0x00,0x00,0x0b,0xc0,0x5f,0xff,0xd0,0xbc,0x00,0x22,0x21,
+0x0c,0xc0,0x13,0x33,0x20,0xcc,0x05,0xee,0xec,0x0c,0xb0,0x00,0x00,0x00,0xc9,0xcb,
+0xde,0xed,0xb9,0x00,0x0e,0xff,0xa0,0x00,0x00,0x56,0x63,0x38,0x00,0xf0,0x08,0x57,
+0x62,0x04,0x00,0x06,0xef,0xff,0xf1,0xad,0x47,0xfb,0x30,0x24,0x0a,0x39,0xfa,0x00,
+0x00,0x00,0xa2,0x03,0xc5,0x00,0xce,0x0b,0xf0,0x0f,0xc8,0x00,0x00,0xa2,0x00,0x98,
+0x00,0x00,0x0a,0x22,0xc6,0x00,0x00,0x00,0xa7,0xcf,0xb0,0x00,0x00,0x0a,0xa0,0x5f,
+0xc5,0x23,0x50,0x20,0x00,0x4d,0xff,0xff,0x90,0x07,0xf0,0x19,0x54,0x00,0x89,0x99,
+0x99,0x99,0x8c,0x2f,0xd1,0x11,0x2b,0xb0,0x65,0x06,0xef,0xfb,0x0b,0x93,0xdf,0xff,
+0xb0,0xfd,0x00,0x69,0xdb,0x02,0x20,0x00,0x0b,0xb0,0xeb,0x00,0x00,0xbb,0x0f,0xd0,
+0x00,0x0b,0xb0,0x76,0x09,0x00,0x81,0xe0,0x00,0x0b,0xea,0xff,0xaa,0xaa,0xe0,0xf2,
+0x01,0xf0,0x2b,0x18,0xde,0xd8,0x10,0x00,0x3e,0xad,0x6a,0xbe,0x30,0x1e,0x70,0xc5,
+0x70,0x7e,0x18,0xb0,0x0c,0x57,0x00,0xb8,0xc5,0x00,0xbd,0x60,0x05,0xce,0x30,0x24,
+0x06,0x90,0x2e,0xd4,0x4b,0xe3,0xe7,0xc7,0xd9,0xcb,0x8b,0x04,0xc6,0xd9,0x2f,0xa9,
+0x00,0x00,0xbf,0x20,0x5f,0x71,0x01,0x7e,0x50,0x00,0x3b,0xff,0xfb,0x37,0x02,0x10,
+0x20,0x8f,0x0a,0x70,0x80,0x00,0x00,0x03,0xe6,0x4b,0xb0,0x93,0x06,0xf2,0x22,0x0f,
+0x12,0x62,0x0a,0x60,0x00,0xe7,0xff,0xf4,0x6d,0x10,0x6d,0xbf,0xff,0xb0,0x9f,0xef,
+0x7a,0xff,0xfa,0x07,0xe9,0xcf,0xff,0xfe,0x23,0xe1,0x4f,0xff,0xff,0xe1,0x96,0x1e,
+0xff,0xff,0xff,0x8c,0x38,0xff,0xff,0xff,0xfb,0xcf,0xfd,0xdd,0xdd,0xdd,0x90,0x11,
+0x77,0x02,0x20,0x61,0x00,0x6b,0x03,0x11,0xd2,0x06,0x00,0xf1,0x05,0xe3,0x00,0x02,
+0x43,0x33,0x37,0xe3,0x00,0xaf,0xff,0xff,0xff,0xf4,0x03,0x66,0x66,0x66,0x66,0x60,
+0x09,0x67,0x02,0x90,0x08,0xf9,0x88,0x88,0x95,0x00,0x07,0xd1,0x00,0x99,0x02,0x01,
+0x06,0x00,0x25,0x05,0x90,0xb9,0x02,0x20,0x68,0x50,0xc1,0x01,0xf0,0x24,0x48,0xc9,
+0x10,0x00,0x00,0x8c,0xa4,0x4c,0x30,0x00,0x03,0x22,0x8b,0x20,0x00,0x00,0x5a,0xc5,
+0x10,0x00,0x06,0x86,0x97,0x30,0x00,0x1c,0xb0,0x10,0xab,0x00,0x0a,0xf2,0x7f,0x82,
+0xf9,0x00,0xaf,0x29,0xfa,0x1f,0x90,0x01,0xda,0x04,0x09,0xd1,0x00,0x01,0x8b,0x9a,
+0x81,0x76,0x02,0xfa,0x0a,0xfd,0x10,0x0d,0x63,0x36,0x9d,0x10,0xd3,0x00,0xb0,0xbd,
+0x0d,0x30,0x0a,0xc9,0xe3,0xd3,0x00,0x00,0x0d,0x3d,0x30,0x00,0x00,0xd3,0x09,0x00,
+0x91,0x40,0x00,0x00,0xd3,0xcf,0xff,0xff,0xff,0x20,0x72,0x00,0x20,0x03,0x53,0x06,
+0x00,0xf0,0x2b,0xa9,0x6a,0x90,0x00,0x00,0x06,0x70,0x00,0x8d,0xc7,0x00,0x0a,0x10,
+0x00,0x00,0x09,0x40,0x1d,0x10,0x00,0x47,0x33,0x90,0xa3,0x38,0xcf,0xda,0x33,0x80,
+0xc0,0x68,0x58,0x00,0x04,0xb0,0xb0,0x00,0x4f,0x90,0x00,0xa2,0xa1,0x00,0xdf,0xf3,
+0x00,0x83,0x2c,0x20,0x00,0x00,0x01,0xc0,0x02,0xbb,0xbb,0xbb,0xbb,0x3f,0x01,0x11,
+0x4d,0xf2,0x00,0xf0,0x1b,0xf0,0x87,0x00,0x00,0x00,0x7f,0x2f,0x40,0x19,0xd8,0x6e,
+0xae,0x30,0x0a,0xb3,0x7b,0x60,0xd4,0x01,0xf1,0x00,0x9b,0x4f,0x20,0x5b,0x00,0x01,
+0xbf,0x60,0x08,0x70,0x00,0x04,0xf0,0x00,0xa5,0x00,0x00,0x4f,0x00,0x0c,0x30,0x0b,
+0x00,0x10,0xe2,0x0b,0x00,0x02,0x01,0x00,0xe0,0x08,0xd7,0x01,0xc0,0xd0,0x09,0xd7,
+0x00,0x08,0xa1,0x1f,0xf7,0x0c,0xe3,0x01,0x01,0xf1,0x00,0xc5,0x00,0x00,0x05,0xae,
+0x82,0x00,0x00,0x09,0xf3,0x02,0x8d,0xb4,0x02,0xe7,0x68,0x0c,0xd0,0x02,0xff,0xff,
+0xf2,0x00,0x00,0x00,0x0a,0x00,0x02,0xbb,0xbd,0x50,0x43,0x03,0xf1,0x14,0xa3,0x0d,
+0x00,0x00,0x00,0x0d,0x00,0xd0,0x00,0x00,0x07,0x70,0x0d,0x11,0x00,0x01,0xc0,0x00,
+0xcb,0xb2,0x00,0xb3,0x00,0x0c,0x00,0x00,0x96,0x00,0x00,0xc0,0x00,0x66,0x00,0x00,
+0x0c,0x5f,0x00,0x00,0xe9,0x09,0x03,0x0b,0x00,0xa1,0x90,0x00,0x02,0x33,0x30,0x0c,
+0x00,0x00,0x88,0x8c,0x42,0x00,0x20,0xb1,0x0d,0xf4,0x03,0x00,0x42,0x00,0xe1,0x1c,
+0x20,0x0d,0xdd,0x10,0x1c,0x30,0x00,0xd0,0x00,0x3b,0x20,0x00,0x0d,0x2c,0x00,0x10,
+0xd0,0x3a,0x00,0x25,0x07,0x00,0x0e,0x00,0x00,0x13,0x03,0xc1,0xcc,0xcc,0xc2,0x00,
+0x00,0x11,0x10,0x09,0x00,0x00,0xaa,0xad,0x42,0x00,0x10,0xc1,0x1e,0x00,0xb0,0x69,
+0x00,0xdc,0xc0,0x00,0x6b,0x00,0x0d,0x00,0x01,0xa8,0x34,0x00,0x20,0x11,0x00,0x9e,
+0x0c,0x30,0x0b,0xdd,0xdc,0x9a,0x02,0x00,0x3f,0x00,0xf0,0x01,0x0e,0xdd,0xdd,0xb0,
+0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x0c,0xcc,0xcc,0xc2,0x00,0xf0,0x24,0x00,0x00,
+0x00,0x0b,0x00,0x00,0xbb,0xbd,0x60,0xc0,0x00,0x00,0x00,0xa3,0x0c,0x00,0x00,0x00,
+0x1d,0x00,0xcd,0xc1,0x00,0x0b,0x40,0x0c,0x00,0x00,0x2c,0x50,0x00,0xc0,0x00,0x29,
+0x20,0x00,0x09,0x00,0x00,0x0b,0xcc,0xcc,0xb0,0x00,0x00,0xd0,0x00,0x0d,0x00,0x00,
+0x0e,0x08,0x00,0xf0,0x32,0x00,0xe0,0x00,0x0c,0x00,0x00,0x09,0xbb,0xbb,0x90,0x00,
+0x00,0x00,0x00,0x07,0x40,0x00,0x9b,0xbc,0x80,0x84,0x00,0x00,0x00,0x76,0x08,0x40,
+0x00,0x00,0x0c,0x10,0x8d,0xc1,0x00,0x08,0x80,0x08,0x40,0x00,0x1a,0x90,0x00,0x84,
+0x00,0x0a,0x30,0x00,0x06,0x30,0x00,0x08,0x00,0x80,0x90,0x00,0x00,0xc0,0x0b,0x0d,
+0x00,0x00,0x0f,0xdd,0xb3,0xf2,0x0b,0x00,0x94,0xb6,0xa0,0x00,0x0c,0xbb,0xa7,0x08,
+0x20,0x00,0x01,0x00,0xf0,0x06,0xd0,0x00,0x0b,0xbb,0xd5,0x0d,0x00,0x00,0x00,0x0a,
+0x30,0xd0,0x00,0x00,0x01,0xd0,0x0d,0xdc,0x00,0x00,0xb4,0x6e,0x00,0xf4,0x15,0xa6,
+0x00,0x0d,0x00,0x02,0xb4,0x00,0x00,0xb0,0x00,0x00,0x05,0xaa,0x71,0x00,0x00,0x06,
+0xa1,0x05,0xb0,0x00,0x00,0xb2,0x00,0x0c,0x10,0x00,0x09,0x50,0x01,0xd0,0x00,0x00,
+0x1a,0xbb,0xb3,0x45,0x00,0xd0,0x11,0x10,0x0b,0x00,0x00,0xaa,0xad,0x50,0xd0,0x00,
+0x00,0x00,0xc1,0x4d,0x00,0x60,0x69,0x00,0xdc,0xc0,0x00,0x5c,0xbb,0x00,0x10,0x9a,
+0x63,0x00,0x41,0x23,0x00,0x00,0x04,0xd1,0x00,0x11,0xb1,0xc9,0x00,0x90,0x00,0x00,
+0x0f,0xcc,0xcc,0xc0,0x00,0x00,0xc0,0x0b,0x00,0x45,0x0d,0xcc,0xcc,0xc3,0x47,0x00,
+0xf0,0x1a,0x90,0xb0,0x1a,0xaa,0xc0,0xc0,0xc0,0x00,0x03,0xa0,0xc0,0xc0,0x00,0x07,
+0x60,0xc0,0xc0,0x00,0x0c,0x10,0xda,0xe0,0x00,0x3b,0x00,0xc1,0xc0,0x00,0xb2,0x00,
+0xb0,0xc0,0x06,0x80,0x00,0xb0,0xc0,0x3b,0x00,0x00,0xb0,0x3b,0x00,0x15,0xc0,0x05,
+0x00,0xf0,0x20,0x40,0x60,0x00,0x00,0x00,0x80,0x73,0x0b,0xbb,0xe0,0xd0,0x84,0x00,
+0x02,0xc0,0xc0,0x84,0x00,0x09,0x50,0xcb,0xd4,0x00,0x4c,0x00,0xc0,0x84,0x03,0xc1,
+0x00,0xc0,0x84,0x2a,0x10,0x00,0x60,0x73,0x00,0x00,0x5a,0xa7,0x10,0x00,0x07,0xa2,
+0x15,0xc0,0xc4,0x00,0x30,0xb2,0x00,0x0a,0xc6,0x00,0x42,0x01,0xab,0xbb,0x40,0x7d,
+0x00,0xf2,0x16,0x01,0x10,0x00,0xa0,0xab,0xab,0xb0,0x0c,0x00,0x00,0x58,0x00,0xc0,
+0x00,0x0a,0x30,0x0c,0x00,0x02,0xb2,0x66,0xc0,0x00,0xb3,0x26,0x6c,0x00,0x77,0x00,
+0x00,0xc0,0x5a,0x00,0x00,0x0c,0x19,0x00,0xb4,0x00,0x00,0xb3,0x01,0x00,0x18,0x01,
+0xf0,0x1e,0x00,0x05,0x00,0x01,0x10,0x07,0x02,0xaa,0xae,0x00,0xb1,0x00,0x02,0xb0,
+0x0a,0x10,0x00,0x76,0x8a,0xe1,0x00,0x2c,0x01,0x2b,0x10,0x2c,0x20,0x00,0xa1,0x4c,
+0x20,0x00,0x0a,0x11,0x00,0x00,0x00,0xa1,0x00,0x93,0x00,0x07,0x00,0x0a,0x30,0xec,
+0x01,0xf0,0x25,0x00,0x00,0x00,0x06,0xcc,0xcc,0xb2,0x00,0x00,0x00,0x09,0x13,0xbb,
+0xbe,0x10,0xa2,0x00,0x00,0xd0,0x0a,0x20,0x00,0x69,0x9c,0xe2,0x00,0x2d,0x10,0x0a,
+0x20,0x4c,0x20,0x00,0xa2,0x59,0x10,0x00,0x05,0x00,0x06,0xaa,0xab,0xb0,0x00,0xb4,
+0x11,0x1b,0x20,0x0b,0x20,0x00,0xa2,0xaa,0x00,0xd4,0x20,0x06,0xbb,0xbb,0xa0,0x00,
+0x01,0x00,0x70,0xa0,0x3b,0xbc,0x80,0x1a,0x01,0xf0,0x0a,0x0a,0x20,0xc0,0xc0,0x00,
+0x0d,0x69,0xe0,0xc0,0x00,0x58,0x12,0xc0,0xc0,0x00,0xc1,0x00,0xc0,0xc0,0x08,0x70,
+0x00,0xc0,0xc0,0x4a,0x15,0x01,0x19,0x10,0x1f,0x01,0xb0,0x70,0x00,0x00,0x00,0x60,
+0x70,0x0b,0xbb,0xe0,0xc0,0xc1,0x1f,0x01,0x60,0xb1,0x00,0x09,0xbc,0xf0,0xb1,0x1f,
+0x01,0xf0,0x04,0xb1,0x03,0xc1,0x00,0xc1,0xc0,0x2a,0x10,0x00,0x70,0x80,0x00,0x00,
+0x80,0x08,0x00,0x00,0x03,0xa0,0x64,0x02,0xd0,0xd1,0x6f,0x30,0x00,0x3a,0x4b,0xc2,
+0xc3,0x00,0x80,0x07,0x30,0x16,0x1a,0x01,0x13,0xa1,0x1a,0x01,0xf8,0x0a,0x55,0xc0,
+0x00,0x0b,0x37,0x7c,0x00,0x03,0xb0,0x00,0xc0,0x00,0xc2,0x00,0x0c,0x00,0x86,0x06,
+0xcc,0xc0,0x78,0x00,0x00,0x0b,0x37,0x1a,0x01,0x11,0xc0,0x1a,0x01,0xf2,0x0d,0x11,
+0x20,0x00,0x90,0x8a,0x9b,0x80,0x0c,0x00,0x00,0x95,0xbc,0xc0,0x00,0x1d,0x00,0x0c,
+0x00,0x0b,0x55,0xbb,0xc0,0x1b,0x60,0x00,0x0c,0x0a,0x20,0x24,0x00,0x60,0x01,0x00,
+0x4c,0xbb,0xbb,0xc0,0x03,0x02,0x02,0x89,0x02,0x03,0x3f,0x00,0x00,0x08,0x02,0xf1,
+0x12,0x07,0x03,0xaa,0xae,0x10,0xb2,0x00,0x01,0xc2,0xbe,0x20,0x00,0xa4,0x00,0xb2,
+0x00,0x97,0x08,0xce,0x23,0xb5,0x00,0x00,0xb1,0x20,0x00,0x00,0x03,0x00,0x0a,0xdd,
+0xdc,0xe0,0x2d,0x00,0x60,0x0c,0xdd,0xdd,0xb0,0x00,0xd1,0xbc,0x02,0x00,0x44,0x02,
+0xf5,0x26,0x11,0x10,0x00,0x80,0x8a,0xab,0x90,0x1c,0x00,0x00,0x85,0xbc,0xc0,0x00,
+0x0d,0x10,0x0c,0x00,0x09,0x65,0xbb,0xc0,0x09,0x80,0x00,0x1c,0x0b,0x50,0x00,0x01,
+0xb0,0x00,0x18,0xba,0x50,0x00,0x0c,0x40,0x1a,0x60,0x02,0xb0,0x00,0x1b,0x00,0x1d,
+0x10,0x06,0x90,0x00,0x5c,0xbb,0xa1,0x08,0x03,0x00,0x8f,0x00,0xf0,0x04,0x90,0xb0,
+0x4b,0xbc,0x80,0xb0,0xc0,0x00,0x07,0x50,0xb0,0xc0,0x00,0x0a,0x6c,0xf0,0xc0,0x00,
+0x0d,0x6a,0x02,0x10,0x67,0x05,0x00,0xa0,0xd1,0xbb,0xe0,0xc0,0x09,0x60,0x00,0xb0,
+0xc0,0x59,0x7e,0x02,0x13,0x20,0x83,0x02,0x01,0x05,0x00,0x61,0x50,0x80,0x02,0xbb,
+0xcc,0xca,0xcc,0x02,0x04,0x05,0x00,0x00,0xca,0x00,0xd2,0x03,0x90,0x1b,0x00,0x00,
+0x04,0xa0,0x29,0x00,0x00,0x04,0x90,0x00,0x05,0x00,0x94,0x8c,0xcc,0xcc,0xcc,0xc8,
+0x00,0xbc,0xcc,0xcb,0x28,0x00,0x20,0x10,0x0c,0x30,0x01,0x01,0x05,0x00,0xc2,0x02,
+0x00,0x7a,0xaa,0xea,0xaa,0xa7,0x12,0x22,0x22,0x22,0x21,0x90,0x00,0x40,0xcc,0xcc,
+0xce,0x20,0x2b,0x02,0x15,0x30,0x05,0x00,0x03,0xb7,0x03,0x03,0x41,0x00,0x1c,0x0c,
+0x41,0x00,0xc0,0x7b,0xbb,0xeb,0xbb,0xb7,0x01,0x11,0x11,0x11,0x10,0x00,0x60,0x71,
+0x03,0x10,0xd0,0x32,0x00,0xf6,0x01,0xfc,0xcc,0xbe,0x20,0x00,0xd0,0x00,0x0a,0x20,
+0x00,0xcb,0xbb,0xbc,0x00,0x00,0xcc,0x7d,0x00,0x61,0x30,0x0c,0x00,0x00,0x01,0xb0,
+0x05,0x00,0x72,0x03,0x00,0x8c,0xcc,0xec,0xcc,0xc7,0x5f,0x00,0xb0,0x06,0xaa,0x70,
+0x00,0x00,0x98,0x11,0x7b,0x00,0x00,0xe0,0x28,0x00,0x86,0xc3,0x00,0x2d,0x00,0x00,
+0x2b,0xbb,0xb2,0x2a,0x01,0xa0,0x37,0x00,0x0b,0xbc,0xd8,0x03,0x90,0x00,0x00,0x03,
+0xde,0x00,0xf0,0x06,0x00,0x39,0x02,0xa0,0x00,0x03,0x03,0x80,0x2a,0x00,0x00,0xb0,
+0x57,0x02,0xec,0x60,0x0b,0x16,0x50,0x2a,0x00,0x12,0x03,0xc0,0xa0,0x00,0x1b,0x33,
+0x44,0x2a,0x00,0x4a,0xa9,0x97,0x33,0xa0,0x37,0x00,0x11,0x3a,0xd6,0x00,0x12,0x70,
+0x6c,0x01,0xb0,0x00,0x8a,0xaa,0x60,0xa2,0x00,0x01,0x22,0x2d,0x0a,0x20,0xfd,0x01,
+0xf0,0x07,0x92,0x00,0x00,0x51,0x0c,0x09,0x20,0x00,0x09,0x30,0x70,0x9d,0xc1,0x00,
+0x93,0x12,0x2a,0x30,0x07,0xbb,0xba,0x84,0x31,0x03,0x01,0xcc,0x04,0x32,0x20,0x00,
+0x72,0x3f,0x03,0x02,0x49,0x03,0xa8,0x00,0x6c,0xcc,0xcc,0x30,0x00,0x03,0xbb,0xcc,
+0xc9,0x71,0x01,0xd0,0x00,0x00,0x1b,0x00,0x00,0x55,0x0b,0x29,0x00,0x00,0x76,0x0c,
+0x26,0x05,0x00,0x12,0x00,0x05,0x00,0x00,0x76,0x01,0x03,0xdb,0x00,0x43,0x03,0xbb,
+0xbb,0xbc,0xf7,0x04,0x05,0x6f,0x02,0x21,0xc0,0x00,0xb0,0x02,0x69,0x0a,0xbb,0xbb,
+0xbb,0xbc,0x80,0x66,0x00,0x11,0xa2,0x0b,0x00,0x01,0x75,0x01,0x56,0x61,0x00,0x00,
+0x01,0xbb,0x77,0x01,0x07,0x05,0x00,0xa0,0x02,0x00,0x7c,0xcc,0xdd,0xcc,0xc8,0x00,
+0x00,0x57,0x0e,0x00,0x11,0x57,0xb8,0x01,0x24,0xbe,0x30,0x44,0x00,0x02,0x05,0x00,
 0x03,0xb8,0x01,0x16,0xac,0x7c,0x01,0x04,0x41,0x00,0xd0,0x01,0x11,0x11,0x12,0x11,
 0x4a,0xaa,0xad,0xaa,0x96,0x00,0x00,0x09,0x3c,0x00,0xf0,0x33,0xe6,0xcd,0x60,0x00,
 0x00,0xc0,0x05,0x70,0x02,0xeb,0xa0,0x04,0x70,0x03,0xa0,0x00,0x04,0x70,0x01,0xdc,
 0xc4,0x03,0x50,0x00,0x00,0x10,0x01,0x70,0x9b,0xbc,0x90,0x1a,0x00,0x00,0x39,0x01,
 0xb0,0x00,0x04,0x80,0x1b,0x12,0x22,0x47,0x51,0xb5,0x9b,0xc7,0x63,0x1a,0x00,0x57,
 0x07,0xbc,0xa0,0x03,0x40,0x00,0x1b,0x00,0x50,0x00,0x00,0x90,0x0c,0x10,0x84,0x05,
-0x00,0x56,0x07,0xc0,0xcc,0xcc,0xca,0x00,0x11,0x11,0x00,0x80,0x7a,0xaa,0xe0,0x0c,
-0x75,0x00,0x80,0xc0,0x00,0x00,0xd0,0x0c,0x00,0x00,0x0c,0x09,0x00,0x90,0x70,0x0c,
-0x2b,0xbb,0xbb,0xb1,0xc0,0x00,0xb1,0x97,0x03,0x22,0x10,0x00,0x09,0x00,0x10,0x0c,
-0x09,0x00,0x32,0x20,0x00,0x05,0xad,0x00,0x3c,0xab,0xbb,0xbc,0xad,0x00,0x01,0x28,
-0x01,0x70,0x5b,0xbb,0xbb,0xbb,0xc8,0x00,0x1c,0x64,0x00,0x1a,0x0c,0x05,0x00,0xda,
-0x07,0x00,0x70,0x00,0x01,0x9a,0xaa,0xa9,0x00,0x00,0x12,0x22,0x1d,0x3c,0x00,0x13,
-0x04,0x85,0x01,0xd3,0x02,0xa0,0x85,0x00,0x00,0x12,0xa0,0x84,0x00,0x00,0xc2,0x90,
-0x74,0x86,0x01,0x12,0xd0,0xd3,0x02,0x61,0xcc,0x50,0x02,0xbb,0xcc,0xc8,0x3e,0x0c,
-0x00,0x05,0x00,0x20,0x2a,0x00,0x5a,0x02,0x23,0x00,0x00,0x58,0x01,0x12,0x54,0x95,
-0x00,0x34,0x7b,0xbb,0xbb,0xe2,0x02,0x0e,0x73,0x03,0x02,0x8e,0x01,0x02,0x64,0x03,
-0x01,0x01,0x00,0x30,0x22,0x22,0x22,0x91,0x00,0x1b,0x9d,0x8e,0x01,0x13,0x30,0x66,
-0x04,0x7a,0x12,0x21,0x00,0x00,0x9a,0xaa,0x9d,0x46,0x00,0xc2,0x08,0x00,0x69,0x99,
-0x99,0x99,0x96,0x12,0x22,0x23,0x33,0x31,0xce,0x0c,0x1a,0xd0,0x05,0x00,0x49,0x9c,
-0xcc,0xcc,0x50,0xca,0x01,0x06,0x7d,0x00,0x74,0x01,0x10,0x6b,0xcc,0xcc,0xcb,0xb8,
-0xa5,0x03,0x20,0xce,0x50,0x50,0x00,0x62,0x50,0x00,0xec,0xcc,0xcb,0x20,0xff,0x07,
-0x6f,0xcc,0xcb,0xcc,0x70,0x00,0xbc,0xb9,0x00,0x04,0x16,0x7c,0xb9,0x00,0x10,0x70,
-0x85,0x01,0x01,0xb4,0x03,0x09,0xbe,0x03,0xd0,0x10,0x00,0x00,0x10,0x00,0xa0,0x7b,
-0xaa,0xf0,0x0c,0x00,0x00,0x1c,0x9e,0x08,0x20,0x70,0x0c,0xbf,0x02,0xe0,0xc0,0x00,
-0x86,0x00,0x0c,0x00,0x4b,0x00,0x00,0xc0,0x3c,0x10,0x00,0x0c,0xc0,0x09,0x0b,0xa5,
-0x06,0xf1,0x0c,0x11,0x20,0x09,0x10,0xaa,0x9d,0x50,0xb2,0x00,0x00,0xc2,0x0a,0x20,
-0x00,0x5b,0x00,0xa2,0x00,0x5c,0x10,0x0b,0x21,0xa9,0x00,0x00,0xb1,0x12,0xfa,0x02,
-0x0f,0x50,0x05,0x03,0x03,0xa5,0x06,0xf0,0x08,0xb2,0x00,0x00,0xd0,0x0b,0x20,0x00,
-0x78,0x00,0xb2,0x00,0x3d,0x00,0x0a,0x20,0x6c,0x10,0x00,0xa2,0x57,0x00,0x00,0x06,
-0xae,0x02,0xa0,0x80,0x00,0xc0,0x00,0x0b,0x10,0x0c,0xcc,0xcc,0xf1,0x09,0x00,0x00,
-0x9b,0x08,0x01,0xd7,0x05,0xf0,0x1e,0x80,0x03,0xce,0x7c,0xe4,0x2b,0x00,0x00,0xa3,
-0x0a,0x42,0xb0,0x00,0x0d,0x00,0xc1,0x1b,0x00,0x01,0xc0,0x0d,0x01,0xfc,0x90,0x67,
-0x04,0x90,0x1b,0x00,0x0c,0x10,0xa3,0x01,0xb0,0x06,0x70,0x2c,0x00,0x1b,0x00,0x10,
-0x0b,0x30,0x01,0xb0,0xd3,0x00,0x11,0x1b,0x3d,0x01,0x12,0xb0,0x29,0x02,0xfb,0x17,
-0x01,0x10,0x11,0x00,0xa3,0xad,0x7a,0xe1,0x0c,0x00,0xc2,0x0d,0x00,0xc0,0x0e,0x00,
-0xd0,0x0c,0x03,0xa0,0x49,0xac,0xd0,0x84,0x09,0x50,0x0c,0x1c,0x00,0xd0,0x00,0xd8,
-0x50,0x68,0x00,0x0c,0x00,0x0d,0x6f,0x06,0xf0,0x00,0x06,0x00,0x12,0x20,0x23,0x20,
-0x00,0x08,0xac,0x69,0x9e,0x00,0x00,0x00,0x94,0xaa,0x01,0x01,0x25,0x00,0x20,0x01,
-0xb0,0x1f,0x00,0x31,0x34,0x00,0x04,0xdf,0x03,0x2f,0xcc,0x50,0xdf,0x03,0x08,0xf0,
-0x07,0x07,0xcc,0x79,0xcd,0x30,0x00,0x06,0x70,0x09,0x40,0x00,0x08,0x40,0x0a,0x30,
-0x00,0x0c,0x10,0x0b,0x20,0x00,0x1c,0x63,0x00,0x30,0x66,0x00,0x0c,0xa6,0x00,0x12,
-0x01,0x9c,0x01,0x01,0x60,0x02,0xf0,0x00,0x07,0xcc,0x78,0xcc,0x20,0x00,0x04,0x80,
-0x0a,0x30,0x00,0x09,0x40,0x0a,0x20,0x3c,0x01,0x00,0xc3,0x01,0x11,0x04,0xc5,0x01,
-0x17,0xc7,0x7e,0x02,0x50,0xea,0xaa,0xae,0x20,0x01,0xac,0x07,0x01,0x05,0x00,0x80,
-0x00,0xbc,0xbb,0xba,0x00,0x07,0xcc,0x88,0x3c,0x00,0x28,0x90,0x09,0x3c,0x00,0x00,
-0x13,0x05,0x43,0x6b,0xbb,0xbb,0xbb,0x3d,0x02,0x42,0xdc,0xcc,0xcb,0x10,0x99,0x04,
-0x62,0xfc,0xcc,0xcc,0x20,0x00,0xc0,0x14,0x00,0x24,0xcc,0x40,0xd7,0x0f,0x10,0xb0,
-0xe2,0x00,0x15,0xd0,0x05,0x00,0x10,0xc0,0x05,0x00,0x24,0xcc,0xc1,0x0a,0x00,0xb5,
-0xc0,0x00,0xd1,0x12,0x40,0xc0,0x00,0x9b,0xa9,0x70,0xc0,0xe1,0x04,0x12,0xc0,0x00,
-0x0b,0x11,0x03,0x67,0x04,0x13,0xd0,0x58,0x0a,0x21,0x0c,0x10,0x39,0x00,0xb2,0xb0,
-0x0d,0x11,0x24,0x0c,0x00,0x00,0xab,0xba,0x70,0xd0,0xe4,0x03,0x04,0x13,0x02,0x00,
-0x1c,0x04,0x11,0x0d,0x87,0x0a,0x02,0x0e,0x00,0x00,0x17,0x02,0x19,0x01,0x42,0x00,
-0x11,0x0d,0x0b,0x00,0x60,0xdc,0xc0,0x0d,0x00,0x01,0x0d,0xa3,0x00,0x21,0xa1,0xd0,
-0x42,0x06,0x01,0x43,0x02,0x19,0xb0,0x24,0x00,0x01,0x0b,0x00,0x04,0xbe,0x0a,0x00,
-0x88,0x00,0xb3,0x90,0x91,0xd0,0x00,0x0c,0x0a,0x2d,0x00,0x00,0xc0,0xa2,0x09,0x00,
-0x61,0xea,0xe2,0xd0,0x00,0x0c,0x1b,0x12,0x00,0xa2,0xd4,0x46,0x2c,0x0a,0x24,0x76,
-0x40,0xc0,0xa2,0x00,0x30,0x08,0x00,0x09,0x00,0x70,0x04,0x06,0x10,0x30,0x00,0x00,
-0xa0,0x4c,0x00,0x01,0x04,0x00,0x74,0x02,0x33,0xd0,0xd0,0x06,0x88,0xe0,0x10,0x00,
-0x70,0xd4,0x46,0x80,0xd0,0x57,0x76,0x30,0x81,0x00,0x04,0x04,0x00,0xf0,0x0b,0x60,
-0x60,0x00,0x00,0x83,0xd0,0x00,0x00,0x94,0xd0,0x04,0xcc,0xe4,0xd0,0x00,0x00,0x84,
-0xd0,0x01,0x30,0x93,0xac,0xcb,0x91,0x93,0x00,0xb9,0x30,0x30,0xcc,0xcc,0xe1,0x95,
-0x09,0xf0,0x09,0x09,0xdc,0xcc,0xc1,0x0b,0x30,0x00,0x00,0x08,0xdc,0xcc,0xc4,0x60,
-0x00,0x00,0x46,0xd0,0x00,0x00,0x57,0xd0,0x04,0xcc,0xd7,0x08,0x00,0xf5,0x10,0xd6,
-0x68,0xa2,0x57,0x35,0x54,0x20,0x66,0x00,0x4b,0x99,0x11,0x03,0x34,0x54,0x21,0x18,
-0x88,0x88,0x96,0x00,0x7b,0xba,0x50,0x06,0xa0,0x01,0xc2,0x01,0xbc,0xbc,0xb9,0x0d,
-0x00,0xcf,0x00,0x40,0xa1,0xd0,0x00,0x0d,0xc6,0x00,0x12,0xd0,0xcf,0x00,0x45,0x02,
-0xbb,0xe0,0xa2,0xe1,0x00,0x3f,0xd5,0x57,0x3c,0xcf,0x00,0x01,0x2e,0x00,0x10,0x61,
-0x04,0x02,0x05,0x00,0x02,0xa7,0x07,0x21,0x31,0x00,0xce,0x02,0x02,0x05,0x00,0x02,
-0xd9,0x04,0x1c,0xa0,0x28,0x00,0x21,0xcc,0x20,0x2d,0x05,0xb0,0x12,0x22,0x4b,0x22,
-0x22,0x7a,0xaa,0xaa,0xaa,0xa9,0x00,0x8f,0x19,0x90,0x01,0xbb,0xbb,0xbb,0x40,0x00,
-0x0e,0x00,0x65,0x3d,0x0c,0x70,0x75,0x00,0x02,0xcb,0xbb,0xbb,0x80,0x20,0x06,0x09,
-0xd0,0x0c,0x02,0x0b,0x00,0x47,0xec,0xbb,0xbc,0x30,0x07,0x09,0x63,0x05,0xcc,0xcc,
-0xeb,0xbb,0xa0,0x86,0x05,0x25,0x02,0xb0,0x91,0x05,0x10,0x01,0xf8,0x11,0x20,0x81,
-0x00,0x37,0x0d,0x05,0x05,0x00,0x32,0x7c,0xbb,0xbb,0x35,0x00,0x52,0x3b,0xbb,0xbe,
-0xbb,0xb6,0x90,0x03,0x42,0x9c,0xcc,0xbe,0x10,0x3a,0x02,0x10,0xec,0xc4,0x00,0x02,
-0xf8,0x04,0x00,0x34,0x05,0x1d,0x50,0xe7,0x00,0x00,0x7c,0x00,0x17,0xca,0x7b,0x00,
-0x70,0x7c,0xcd,0xcc,0xfb,0xb5,0x00,0x39,0xac,0x02,0x06,0x05,0x00,0x10,0x26,0xf3,
-0x00,0x0f,0x28,0x01,0x06,0x12,0xdc,0x89,0x05,0x08,0x01,0x00,0x02,0x6a,0x06,0x1a,
-0x90,0x28,0x00,0x30,0xca,0xaa,0xaa,0x24,0x01,0x02,0x5a,0x09,0x08,0x6b,0x05,0x15,
-0xc0,0x23,0x00,0x13,0xe0,0x88,0x06,0x3c,0x30,0x00,0x90,0xa5,0x00,0x17,0xbb,0x7e,
-0x06,0x03,0x26,0x01,0x66,0x99,0x60,0x00,0x00,0x89,0x22,0x24,0x09,0x10,0x1d,0x24,
-0x09,0x11,0xb3,0x9c,0x03,0x00,0x82,0x03,0x0f,0x04,0x00,0x01,0x71,0xd4,0x46,0x81,
-0xc0,0x57,0x76,0x30,0x97,0x0b,0x03,0x04,0x00,0x13,0x70,0x34,0x13,0x22,0x93,0xd0,
-0x04,0x00,0x23,0x94,0xd0,0x0c,0x00,0x40,0xcc,0xcc,0xc3,0x93,0x98,0x04,0x00,0x0b,
-0x0c,0x40,0x0b,0x31,0x11,0xb2,0x0a,0x0c,0x00,0x04,0x00,0x00,0x09,0x0c,0x12,0x40,
-0xd5,0x02,0x16,0x93,0x04,0x00,0x50,0x10,0x93,0xbc,0xcc,0xb2,0x30,0x00,0xf1,0x03,
-0x41,0x08,0x00,0x00,0x61,0x0b,0x10,0x00,0x92,0x0b,0xdc,0xcc,0xe2,0x0b,0x10,0x00,
-0xa2,0x08,0x94,0x05,0x00,0xb2,0x03,0x3c,0xec,0xcb,0x30,0x8e,0x03,0x35,0x0d,0xcc,
-0x10,0x0a,0x04,0xbe,0x00,0x00,0xd0,0x01,0x30,0xc0,0x00,0x0a,0xcb,0xa9,0x0c,0x36,
-0x0f,0x97,0x01,0x22,0x20,0x08,0x00,0x00,0xe9,0x99,0x10,0x42,0x00,0x20,0xda,0xa0,
-0x0b,0x00,0x10,0x22,0x6b,0x04,0x64,0xd0,0x00,0x08,0xaa,0x96,0x0d,0x37,0x00,0x3c,
-0xb0,0x00,0x08,0x36,0x0f,0x6c,0xb1,0x00,0x01,0x11,0x20,0x0c,0x42,0x00,0x22,0xdc,
-0xc0,0x0b,0x00,0x34,0xcc,0xce,0xc0,0x78,0x04,0x00,0x55,0x06,0x00,0x45,0x00,0x11,
-0x0c,0x18,0x0e,0x13,0xf0,0x0b,0x00,0x02,0x4c,0x04,0x01,0x90,0x02,0x80,0x22,0x20,
-0x90,0xa0,0x0e,0x89,0x70,0xc0,0xbb,0x0f,0x06,0x05,0x00,0x62,0xea,0xe1,0x0d,0x00,
-0x00,0xc1,0x0f,0x00,0x90,0x0e,0x55,0x72,0xc0,0xb1,0x05,0x76,0x40,0xc0,0xa2,0x02,
-0x06,0x05,0x00,0xd2,0x40,0x60,0x12,0x22,0x10,0x28,0xda,0xaa,0x60,0x39,0xd0,0x00,
-0x00,0x04,0x00,0x70,0x02,0xcc,0xc9,0xd0,0x00,0x00,0x3a,0x04,0x00,0x83,0xd4,0x45,
-0x63,0x2a,0x57,0x76,0x51,0x2a,0x79,0x08,0x00,0xd6,0x0a,0x80,0x15,0x11,0x11,0x10,
-0x09,0x0d,0x99,0x96,0xbc,0x01,0xf2,0x00,0x11,0x1c,0x0d,0x00,0x08,0xaa,0xc0,0xd0,
-0x00,0x21,0x0c,0x08,0xbb,0xbb,0x30,0x3b,0x1a,0x12,0x5c,0x96,0x00,0x70,0x0c,0x00,
-0x6d,0xcc,0xdc,0x80,0x07,0xca,0x01,0xb1,0x5d,0xcc,0xcc,0xb0,0x11,0x11,0x00,0x08,
-0x0d,0x99,0x94,0xf2,0x01,0x51,0x0c,0x0d,0x00,0x0b,0xcc,0x09,0x00,0xb0,0x0c,0xbb,
-0xce,0x10,0xc0,0x00,0x01,0x00,0x06,0x00,0x9b,0x02,0x05,0x32,0x51,0x00,0x50,0xf7,
-0x05,0x00,0xbd,0x07,0xe0,0xac,0xbb,0xbb,0xa2,0x01,0x22,0x10,0x80,0xa0,0x0e,0xaa,
-0x70,0xc0,0xb0,0x1b,0x01,0x10,0xc0,0xc9,0x00,0x60,0xb0,0x0c,0x00,0xbc,0xf0,0xb0,
-0x24,0x00,0x02,0x05,0x00,0xb0,0x0d,0x34,0x61,0xc0,0xb0,0x06,0x87,0x50,0xc0,0xb0,
-0x00,0x0f,0x00,0x06,0xd8,0x00,0x92,0x24,0x42,0x09,0x09,0x1d,0x77,0x30,0xd0,0xb2,
-0x80,0x04,0x22,0xbc,0xf0,0x77,0x04,0xf4,0x02,0x78,0xa1,0xc0,0xa2,0x24,0x31,0x09,
-0x0a,0x10,0x03,0x33,0x44,0x30,0x01,0x88,0x88,0x8e,0x91,0x01,0x13,0x0d,0x22,0x15,
-0x61,0x08,0x08,0x0c,0xbb,0x60,0xd0,0xb6,0x04,0x50,0x1d,0x00,0xbc,0xf0,0xa1,0x36,
-0x00,0xa0,0x1d,0x01,0x30,0xc0,0xa1,0x8b,0xa8,0x1c,0x0b,0x10,0x5f,0x00,0x41,0x02,
-0x90,0x05,0x08,0x84,0x09,0x20,0x02,0x90,0x32,0x1b,0x01,0xba,0x0e,0x54,0x0a,0x09,
-0x1c,0xbb,0x50,0x6c,0x00,0x11,0xbb,0x6c,0x00,0x40,0x0b,0x2a,0xcb,0xb1,0x8c,0x00,
-0x20,0x02,0x03,0x22,0x06,0x11,0xe0,0x63,0x00,0x10,0x0c,0x1d,0x01,0x14,0xe0,0x34,
-0x06,0x02,0x68,0x04,0x2e,0xcc,0xb6,0xbf,0x03,0x01,0x0c,0x09,0x01,0x96,0x03,0x20,
-0x75,0x00,0xaf,0x0b,0x04,0xe7,0x04,0x33,0x9b,0xbb,0xba,0x92,0x03,0x01,0x05,0x00,
-0x70,0xcb,0xbb,0xbb,0x20,0x00,0x00,0x67,0x0b,0x00,0x18,0x67,0xbf,0x03,0x00,0x24,
-0x0d,0x1c,0x30,0x24,0x0d,0x1a,0xab,0x3c,0x00,0x41,0xdb,0xbb,0xbb,0x10,0x5a,0x00,
-0xc5,0x36,0x66,0xaa,0x66,0x63,0x46,0x66,0x66,0x66,0x63,0x00,0x04,0xbf,0x03,0x10,
-0xd0,0x05,0x07,0x14,0xb3,0xbf,0x03,0x01,0xef,0x02,0x50,0xeb,0xbb,0x90,0x0c,0x0e,
-0x60,0x01,0x32,0xe0,0x00,0x00,0x09,0x00,0x61,0xbc,0xcc,0xb1,0x0c,0x00,0x02,0xaf,
-0x01,0x00,0xb8,0x01,0x65,0x02,0x30,0xc4,0xbb,0xbb,0x96,0xb6,0x0e,0xa0,0x08,0x07,
-0xaa,0xa9,0x01,0x70,0xd1,0x11,0x00,0x1b,0x72,0x08,0x00,0xff,0x03,0x41,0x1b,0x08,
-0xce,0xca,0x7b,0x08,0x50,0x1b,0x5b,0xbf,0xbb,0x71,0xac,0x01,0x00,0x9d,0x0b,0x28,
-0x01,0xa0,0x9d,0x0b,0x01,0x26,0x08,0x46,0x10,0x8c,0xcc,0x90,0x36,0x00,0xf1,0x02,
-0x0c,0x99,0x9a,0x01,0xb0,0x02,0xd2,0x10,0x1b,0x00,0x0c,0x02,0x21,0xb5,0xbb,0xcb,
-0x94,0x19,0x09,0xb0,0x20,0x0c,0xcc,0xcc,0xd9,0x00,0xd0,0x00,0x03,0xa0,0x0e,0x13,
-0x05,0x60,0x9c,0xcc,0xcb,0x50,0x00,0xaa,0xcf,0x04,0x38,0xd1,0x11,0x10,0x4c,0x01,
-0x46,0xeb,0xbb,0xa9,0x20,0x06,0x05,0x51,0x5c,0xcc,0xce,0xcc,0xba,0x12,0x0d,0x08,
-0x05,0x00,0x11,0x18,0xa1,0x05,0x12,0xb9,0x85,0x00,0x02,0x05,0x00,0x11,0x8b,0x1f,
-0x01,0x03,0xc4,0x05,0x1c,0xb7,0xc4,0x05,0x1a,0xdc,0xc4,0x05,0x00,0xb3,0x00,0xd0,
-0x5a,0xaa,0xa0,0x0c,0x0a,0x41,0x10,0x00,0xc0,0xa3,0x00,0x00,0x0c,0x4a,0x09,0x41,
-0xc0,0x7c,0xcc,0xb3,0x2a,0x04,0x45,0xc3,0xbb,0xbb,0xba,0xd7,0x02,0x07,0x09,0x00,
-0x10,0x02,0xe4,0x04,0x4e,0xaa,0xaa,0xa7,0x00,0xb3,0x00,0x18,0xcb,0xb9,0x05,0x01,
-0xff,0x05,0x10,0x38,0x44,0x04,0x06,0x05,0x00,0x01,0xff,0x05,0x0f,0xb3,0x00,0x05,
-0x52,0x5b,0xbe,0xbb,0xeb,0xb7,0x7d,0x0c,0x40,0xbc,0xcc,0xbe,0x20,0xb3,0x00,0x10,
-0x30,0x77,0x06,0x1a,0x10,0xb3,0x00,0x03,0x7c,0x02,0x0b,0x0d,0x09,0x12,0xec,0x3e,
-0x0e,0x0e,0x3b,0x06,0x0b,0x7c,0x02,0x32,0xcc,0xbb,0xcb,0x58,0x01,0x01,0x78,0x0c,
-0x5f,0x7a,0xaa,0xaa,0xab,0xb7,0x7c,0x02,0x07,0x38,0xac,0xcc,0xc9,0x3c,0x00,0x01,
-0x05,0x00,0x32,0x9b,0xbc,0xcb,0xaf,0x00,0x07,0x9b,0x0c,0x00,0x4d,0x07,0x0b,0xff,
-0x0c,0x61,0x00,0x8c,0xbc,0xba,0x00,0x00,0x67,0x0f,0x12,0xb2,0x6e,0x06,0x2b,0xcb,
-0x30,0x77,0x06,0x41,0x01,0xcd,0xcc,0xcf,0x98,0x05,0x0b,0x5d,0x07,0x1f,0x40,0xb4,
-0x00,0x06,0xa2,0x47,0x77,0x77,0x77,0x75,0x24,0x44,0x44,0x44,0x42,0xf4,0x02,0x30,
-0x7a,0x32,0x7c,0x45,0x01,0x40,0x0b,0x20,0x00,0xa4,0xf4,0x02,0x41,0x1b,0xbb,0xb3,
-0x00,0x18,0x05,0x8b,0x99,0x50,0x2a,0xd0,0x00,0x00,0x2a,0xc0,0x04,0x00,0x74,0xd5,
-0x56,0x72,0x2a,0x47,0x65,0x40,0x18,0x05,0x10,0x2a,0x18,0x05,0x01,0x3c,0x0d,0x65,
-0x11,0x00,0x39,0xd9,0x99,0x40,0x4c,0x05,0x00,0x04,0x00,0xf5,0x0c,0xcb,0xbc,0xe2,
-0x39,0x00,0x02,0x20,0x27,0x00,0x29,0xb9,0x40,0x01,0xd3,0x02,0xb4,0x05,0x80,0x00,
-0x49,0x03,0xb0,0x00,0x87,0x00,0x7c,0xbb,0x28,0x09,0x80,0x90,0x01,0xec,0x5c,0xc9,
-0x0c,0x00,0x1b,0xb7,0x0a,0xc0,0x02,0xb0,0x0d,0x00,0x0d,0x00,0x2b,0x00,0xd0,0x00,
-0xea,0x72,0x0b,0x00,0x10,0x21,0x0b,0x00,0x10,0xc0,0x16,0x00,0x67,0x0c,0x00,0x0a,
-0xb5,0x8b,0xa0,0x82,0x06,0x02,0x48,0x06,0x03,0x03,0x06,0xc5,0x31,0x32,0x09,0x0b,
-0x0e,0x8a,0x95,0x0c,0x0c,0x0c,0x0a,0x20,0x05,0x00,0x81,0x10,0x0f,0xcc,0x0c,0x0a,
-0x10,0x0c,0x0c,0x05,0x00,0x90,0x0d,0x3a,0x54,0x0c,0x0c,0x05,0x73,0x75,0x0c,0x3e,
-0x00,0x06,0x05,0x00,0xc6,0x04,0x06,0x08,0xdc,0x5b,0xcc,0x40,0x0a,0x30,0x0d,0x00,
-0x00,0x05,0x00,0x53,0x08,0xdb,0x7b,0xcc,0x60,0x84,0x04,0x13,0x76,0x89,0x04,0x02,
-0xa9,0x01,0xe0,0xab,0x93,0xbb,0x70,0x00,0x1c,0x10,0x67,0x10,0x00,0x01,0xc0,0x06,
-0x60,0x73,0x0d,0x10,0x66,0xb4,0x02,0x37,0xb6,0xdc,0xa0,0x33,0x02,0x7e,0x03,0xcc,
-0xcc,0xec,0xcb,0xb0,0x00,0x57,0x09,0x03,0x25,0x00,0xf0,0x00,0x10,0x89,0x48,0x95,
-0x0c,0x0c,0x21,0xc2,0x10,0xc0,0xc0,0x0b,0x00,0x0c,0x0c,0x16,0x04,0x31,0xdc,0x6d,
-0xc7,0xd7,0x00,0x5f,0xc4,0xbb,0xbb,0xbb,0x1c,0x2f,0x03,0x03,0x11,0x50,0xf0,0x00,
-0x31,0x02,0xcc,0xce,0xab,0x02,0x40,0xd0,0x0c,0x10,0x00,0x49,0x0d,0x80,0x00,0x0c,
-0xcc,0xd0,0x0c,0xcc,0x21,0xb0,0xc2,0x01,0x10,0x1b,0x06,0x02,0xb5,0x01,0xb0,0x00,
-0x20,0xb1,0x00,0x0b,0xbb,0xa8,0x0b,0x10,0x94,0x09,0x02,0x0b,0x00,0x30,0x60,0x00,
-0x02,0xb4,0x07,0x51,0x01,0xaa,0x9e,0x00,0xc1,0x22,0x12,0x30,0x10,0x00,0x89,0x0b,
-0x00,0xe5,0x0d,0x22,0x10,0x0b,0xdc,0x10,0xc0,0x01,0x30,0xb1,0x00,0x0a,0xbb,0x85,
-0x37,0x00,0x39,0x80,0x00,0x09,0x0f,0x11,0x13,0x08,0xa8,0x16,0x10,0x01,0x49,0x0a,
-0x00,0x13,0x00,0x10,0x10,0x42,0x00,0x01,0x6a,0x03,0x70,0x0e,0xcc,0xb0,0x0c,0xdc,
-0x10,0xc0,0x37,0x00,0x82,0x0e,0xab,0xcc,0x0b,0x10,0x00,0x01,0x02,0xce,0x02,0x00,
-0x7c,0x00,0x10,0xdc,0x53,0x0b,0x00,0x15,0x0e,0x00,0x4d,0x00,0x10,0xb1,0xb9,0x03,
-0x26,0xbb,0x00,0x48,0x00,0x16,0xc1,0x48,0x00,0x10,0xb1,0x48,0x00,0x2e,0x0b,0xdc,
-0x48,0x00,0xc0,0x04,0xab,0x81,0x00,0x00,0x05,0xa1,0x04,0xc0,0x00,0x00,0xa2,0xa7,
-0x02,0x40,0x07,0x60,0x01,0xd0,0x38,0x0c,0x23,0xb4,0x00,0xff,0x01,0x70,0x33,0x20,
-0x80,0x0b,0x08,0x98,0xd0,0xf4,0x12,0x02,0x05,0x00,0xf6,0x0b,0xb0,0x0c,0x0a,0xbb,
-0xd0,0xba,0xac,0x0d,0x11,0x00,0xb1,0x1c,0x0d,0x00,0x00,0xb0,0x0c,0x0d,0x01,0x21,
-0xb0,0x0c,0x09,0xba,0x82,0xb0,0x1c,0x13,0x10,0x0c,0x2a,0x07,0xb0,0x06,0x04,0x55,
-0x40,0x80,0x91,0x05,0x66,0xc0,0xd0,0xa2,0x92,0x09,0x70,0xa2,0x0c,0xcc,0xa0,0xdc,
-0xe2,0x0d,0x8d,0x0b,0xb0,0x0e,0x45,0x73,0xc0,0xa2,0x04,0x66,0x40,0x90,0x91,0x00,
-0x2e,0x07,0x5a,0x00,0x18,0x88,0x88,0xe0,0xa1,0x03,0x40,0xa0,0x04,0x44,0x40,0x86,
-0x2c,0x12,0x7e,0x4f,0x01,0x51,0x0b,0xcb,0x00,0xc9,0x9a,0x35,0x11,0xd0,0x00,0x0b,
-0xbb,0x00,0xe9,0xab,0xb0,0xb2,0x00,0x03,0x43,0x20,0x0a,0x45,0x27,0x71,0xb8,0x10,
-0x00,0x00,0x5a,0x10,0x4c,0x5a,0x0e,0x10,0xb2,0x53,0x02,0x10,0x1d,0x03,0x04,0x20,
-0xbb,0x40,0x91,0x01,0x41,0x00,0xa1,0xaa,0x9e,0x6b,0x09,0x02,0xf1,0x01,0x70,0x09,
-0xaa,0xe0,0xcc,0xc0,0xd2,0x21,0x28,0x08,0x01,0x23,0x0a,0x51,0x20,0x0c,0x0a,0xbb,
-0xb9,0x81,0x01,0x15,0x0b,0x48,0x15,0x71,0x0a,0xbb,0xb0,0x00,0xb0,0x01,0x0d,0xf2,
-0x0e,0x70,0x11,0xd0,0xec,0xcb,0x1a,0xae,0x0d,0x94,0x00,0x40,0xea,0xbb,0xb1,0x0c,
-0x16,0x0b,0xe0,0x80,0x03,0xaa,0xab,0xb8,0x00,0x77,0x11,0x11,0xd0,0x07,0x60,0x00,
-0x0d,0xc1,0x02,0x50,0xd0,0x03,0xbb,0xbb,0xb7,0x36,0x00,0x13,0xa0,0x36,0x00,0x61,
-0x22,0xd0,0xec,0xcb,0x19,0xad,0x36,0x00,0x10,0xdb,0x36,0x00,0x00,0xb2,0x14,0x40,
-0x05,0x40,0x00,0x08,0xe9,0x02,0x51,0xc0,0x07,0xdc,0xcc,0xcc,0x09,0x00,0xe0,0x05,
-0xcb,0xbb,0xb9,0x01,0x22,0x20,0x71,0x0b,0x07,0xa9,0xc0,0xa2,0x0c,0xc6,0x0c,0x10,
-0x0c,0x1a,0x01,0xa0,0x0c,0x09,0xab,0xea,0xe2,0x0c,0x0d,0x22,0x11,0xa2,0xa5,0x00,
-0xc0,0x92,0x0c,0x0d,0x00,0x10,0x92,0x0c,0x0a,0xbb,0x92,0xa2,0x0c,0xdb,0x16,0x05,
-0x05,0x00,0xf3,0x15,0x40,0x07,0x04,0x56,0x30,0x80,0x91,0x04,0x67,0xb0,0xc0,0xa2,
-0x00,0x01,0xb1,0xc0,0xa2,0x0c,0xcc,0xba,0xe0,0xa2,0x0d,0x00,0x00,0xb1,0xa2,0x0d,
-0x45,0x65,0xb1,0xa2,0x04,0x66,0x41,0x80,0x5c,0x01,0x1e,0x08,0x5c,0x01,0x00,0x09,
-0x0b,0xf0,0x00,0x80,0x07,0xbc,0xa0,0xc1,0xb0,0x00,0x01,0xb0,0xc1,0xb1,0x0a,0xcc,
-0xcb,0xf1,0x08,0x09,0x00,0x0d,0x09,0x62,0x10,0xc0,0xb0,0x0a,0xbb,0xa1,0xef,0x08,
-0x00,0x34,0x01,0x30,0x70,0xa0,0x00,0x92,0x07,0x02,0x05,0x00,0x00,0x65,0x08,0x62,
-0x01,0x22,0x20,0x00,0xa0,0x9a,0x56,0x01,0xf0,0x04,0x88,0xc0,0x00,0x0c,0x04,0x4c,
-0x09,0xaa,0xe0,0x00,0xc0,0xd2,0x21,0x01,0x2c,0x0d,0x00,0x00,0xaa,0x56,0x01,0x19,
-0x0b,0x56,0x01,0x01,0x13,0x11,0xf0,0x01,0x07,0x77,0x70,0x00,0xb0,0x44,0x4d,0x04,
-0x4d,0x00,0x00,0xc0,0x77,0xd0,0xcc,0xcc,0x83,0x01,0xf8,0x06,0x01,0xcc,0xd0,0xe3,
-0x35,0x70,0x0c,0x06,0x87,0x64,0x00,0xc0,0x01,0x34,0x44,0x43,0x00,0x48,0x88,0x88,
-0xd0,0x9e,0x16,0x90,0x0a,0x0a,0xbb,0xa0,0x00,0xc0,0x00,0x10,0xd2,0x74,0x1c,0xf2,
-0x01,0xc0,0x44,0xd0,0x0e,0xcc,0xb0,0x44,0xd0,0x0d,0x00,0x02,0x66,0xd0,0x0c,0xcb,
-0xba,0x38,0x03,0x10,0x30,0x16,0x0a,0x03,0xa3,0x0d,0x41,0x5c,0xcc,0xdc,0xa0,0x52,
-0x04,0x00,0x18,0x0a,0x11,0xc1,0xe3,0x11,0x04,0x55,0x13,0x13,0x0c,0xe1,0x0d,0x03,
-0x8d,0x06,0x10,0x14,0x21,0x02,0x30,0xa9,0x10,0x00,0xae,0x0d,0x00,0x6f,0x10,0x03,
-0x88,0x06,0x03,0x3d,0x03,0x10,0x0c,0x39,0x14,0x15,0xce,0x29,0x06,0x21,0xbc,0x30,
-0xcc,0x07,0x54,0x5c,0xcb,0xce,0xbc,0xc7,0x88,0x06,0x29,0xcd,0x20,0xdd,0x12,0x63,
-0x08,0x10,0x00,0xac,0xcb,0xbb,0x8b,0x04,0x33,0xab,0xbb,0xbe,0x3c,0x00,0x40,0xdb,
-0xbb,0xbd,0x20,0xde,0x18,0xc1,0x00,0x7a,0xaa,0xcd,0xaa,0xa6,0x11,0x11,0x11,0x22,
-0x20,0x00,0xf1,0x1f,0x10,0xc0,0x9d,0x00,0x13,0xc0,0x4c,0x06,0x35,0x30,0x00,0x9c,
-0xe8,0x14,0x01,0x69,0x16,0xf2,0x05,0xb3,0x11,0x12,0x00,0x00,0x5a,0xae,0x99,0x20,
-0x26,0x55,0x5d,0x55,0x66,0x14,0x44,0x54,0x44,0x43,0x01,0x77,0x0e,0x00,0x6e,0x00,
-0x10,0xbc,0x7d,0x00,0x06,0x6e,0x07,0x15,0x9c,0x19,0x13,0x07,0xb4,0x00,0x13,0xbc,
-0xb4,0x00,0x30,0x7c,0xcc,0xcf,0xf0,0x09,0x10,0x02,0x15,0x00,0x10,0x2c,0x05,0x00,
-0x00,0xec,0x21,0x99,0x2c,0x70,0xa9,0x00,0x01,0xb3,0x00,0x06,0x80,0x77,0x14,0x11,
-0x0c,0xc4,0x06,0x02,0x9b,0x00,0x02,0x54,0x1b,0x81,0x9b,0xbb,0xaa,0x10,0x00,0x09,
-0x00,0x80,0xcb,0x14,0x00,0x2c,0x08,0x10,0xdc,0x22,0x01,0x13,0xba,0x2d,0x00,0x80,
-0x89,0x99,0xae,0x00,0x00,0xd2,0x22,0x21,0x73,0x00,0x20,0x02,0x00,0x0f,0x07,0x02,
-0x3c,0x07,0x50,0x4c,0xcc,0xcc,0xcc,0xc9,0xbb,0x05,0x17,0x00,0x05,0x00,0x00,0xd7,
-0x1b,0x09,0x5e,0x01,0x15,0xcd,0x4e,0x0f,0x23,0xbb,0x20,0xaa,0x07,0x60,0xdd,0xcc,
+0xf0,0x04,0x00,0x00,0x00,0x08,0xcc,0xcc,0xca,0x00,0x11,0x11,0x00,0x80,0x7a,0xaa,
+0xe0,0x0c,0x00,0x00,0x0d,0xe8,0x00,0x50,0xd0,0x0c,0x00,0x00,0x0c,0x09,0x00,0x90,
+0x70,0x0c,0x2b,0xbb,0xbb,0xb1,0xc0,0x00,0xb1,0x97,0x03,0x22,0x10,0x00,0x09,0x00,
+0x10,0x0c,0x09,0x00,0x32,0x20,0x00,0x05,0xad,0x00,0x3c,0xab,0xbb,0xbc,0xad,0x00,
+0x01,0x28,0x01,0x70,0x5b,0xbb,0xbb,0xbb,0xc8,0x00,0x1c,0x64,0x00,0x1a,0x0c,0x05,
+0x00,0xda,0x07,0x00,0x70,0x00,0x01,0x9a,0xaa,0xa9,0x00,0x00,0x12,0x22,0x1d,0x3c,
+0x00,0x13,0x04,0x85,0x01,0xd3,0x02,0xa0,0x85,0x00,0x00,0x12,0xa0,0x84,0x00,0x00,
+0xc2,0x90,0x74,0x86,0x01,0x12,0xd0,0xd3,0x02,0x60,0xcc,0x50,0x02,0xbb,0xcc,0xc8,
+0x0c,0x00,0x10,0x2b,0x05,0x00,0x20,0x2a,0x00,0x5a,0x02,0x23,0x00,0x00,0x58,0x01,
+0x12,0x54,0x95,0x00,0x34,0x7b,0xbb,0xbb,0xe2,0x02,0x0e,0x73,0x03,0x02,0x8e,0x01,
+0x02,0x64,0x03,0x01,0x01,0x00,0x30,0x22,0x22,0x22,0x91,0x00,0x1b,0x9d,0x8e,0x01,
+0x13,0x30,0x66,0x04,0x7a,0x12,0x21,0x00,0x00,0x9a,0xaa,0x9d,0x46,0x00,0xe5,0x08,
+0x00,0x69,0x99,0x99,0x99,0x96,0x12,0x22,0x23,0x33,0x31,0x00,0x40,0xa0,0x00,0x06,
+0x05,0x00,0x49,0x9c,0xcc,0xcc,0x50,0xca,0x01,0x06,0x7d,0x00,0x74,0x01,0x10,0x6b,
+0xcc,0xcc,0xcb,0xb8,0xa5,0x03,0x20,0xce,0x50,0x50,0x00,0x80,0x50,0x00,0xec,0xcc,
+0xcb,0x20,0x00,0xe0,0x14,0x00,0x6f,0xcc,0xcb,0xcc,0x70,0x00,0xbc,0xb9,0x00,0x04,
+0x16,0x7c,0xb9,0x00,0x10,0x70,0x85,0x01,0x01,0xb4,0x03,0x09,0xbe,0x03,0xf0,0x04,
+0x10,0x00,0x00,0x10,0x00,0xa0,0x7b,0xaa,0xf0,0x0c,0x00,0x00,0x1c,0x00,0xc0,0x00,
+0x07,0x70,0x0c,0xbf,0x02,0xfd,0x01,0xc0,0x00,0x86,0x00,0x0c,0x00,0x4b,0x00,0x00,
+0xc0,0x3c,0x10,0x00,0x0c,0x0a,0x10,0xa5,0x06,0xf1,0x0c,0x11,0x20,0x09,0x10,0xaa,
+0x9d,0x50,0xb2,0x00,0x00,0xc2,0x0a,0x20,0x00,0x5b,0x00,0xa2,0x00,0x5c,0x10,0x0b,
+0x21,0xa9,0x00,0x00,0xb1,0x12,0xfa,0x02,0x0f,0x50,0x05,0x03,0x03,0xa5,0x06,0xf0,
+0x08,0xb2,0x00,0x00,0xd0,0x0b,0x20,0x00,0x78,0x00,0xb2,0x00,0x3d,0x00,0x0a,0x20,
+0x6c,0x10,0x00,0xa2,0x57,0x00,0x00,0x06,0xae,0x02,0xa0,0x80,0x00,0xc0,0x00,0x0b,
+0x10,0x0c,0xcc,0xcc,0xf1,0x09,0x00,0x00,0x9b,0x08,0x01,0xd7,0x05,0xf0,0x1e,0x80,
+0x03,0xce,0x7c,0xe4,0x2b,0x00,0x00,0xa3,0x0a,0x42,0xb0,0x00,0x0d,0x00,0xc1,0x1b,
+0x00,0x01,0xc0,0x0d,0x01,0xfc,0x90,0x67,0x04,0x90,0x1b,0x00,0x0c,0x10,0xa3,0x01,
+0xb0,0x06,0x70,0x2c,0x00,0x1b,0x00,0x10,0x0b,0x30,0x01,0xb0,0xd3,0x00,0x11,0x1b,
+0x3d,0x01,0x12,0xb0,0x29,0x02,0xfb,0x17,0x01,0x10,0x11,0x00,0xa3,0xad,0x7a,0xe1,
+0x0c,0x00,0xc2,0x0d,0x00,0xc0,0x0e,0x00,0xd0,0x0c,0x03,0xa0,0x49,0xac,0xd0,0x84,
+0x09,0x50,0x0c,0x1c,0x00,0xd0,0x00,0xd8,0x50,0x68,0x00,0x0c,0x00,0x0d,0x6f,0x06,
+0xf0,0x00,0x06,0x00,0x12,0x20,0x23,0x20,0x00,0x08,0xac,0x69,0x9e,0x00,0x00,0x00,
+0x94,0xaa,0x01,0x01,0x25,0x00,0x20,0x01,0xb0,0x1f,0x00,0x31,0x34,0x00,0x04,0xdf,
+0x03,0x2f,0xcc,0x50,0xdf,0x03,0x08,0xf0,0x07,0x07,0xcc,0x79,0xcd,0x30,0x00,0x06,
+0x70,0x09,0x40,0x00,0x08,0x40,0x0a,0x30,0x00,0x0c,0x10,0x0b,0x20,0x00,0x1c,0x63,
+0x00,0x30,0x66,0x00,0x0c,0xa6,0x00,0x12,0x01,0x9c,0x01,0x01,0x60,0x02,0xf0,0x00,
+0x07,0xcc,0x78,0xcc,0x20,0x00,0x04,0x80,0x0a,0x30,0x00,0x09,0x40,0x0a,0x20,0x3c,
+0x01,0x00,0xc3,0x01,0x11,0x04,0xc5,0x01,0x17,0xc7,0x7e,0x02,0x50,0xea,0xaa,0xae,
+0x20,0x01,0xac,0x07,0x01,0x05,0x00,0x80,0x00,0xbc,0xbb,0xba,0x00,0x07,0xcc,0x88,
+0x3c,0x00,0x28,0x90,0x09,0x3c,0x00,0x00,0x13,0x05,0x43,0x6b,0xbb,0xbb,0xbb,0x3d,
+0x02,0x42,0xdc,0xcc,0xcb,0x10,0x99,0x04,0x62,0xfc,0xcc,0xcc,0x20,0x00,0xc0,0x14,
+0x00,0x12,0xcc,0xab,0x08,0x10,0x30,0xd8,0x01,0x10,0xd0,0x21,0x02,0x04,0x05,0x00,
+0x10,0xc0,0x05,0x00,0x24,0xcc,0xc1,0x0a,0x00,0xa1,0xc0,0x00,0xd1,0x12,0x40,0xc0,
+0x00,0x9b,0xa9,0x70,0x39,0x00,0x06,0x05,0x00,0x31,0x90,0x00,0x03,0x67,0x04,0x13,
+0xd0,0x58,0x0a,0x21,0x0c,0x10,0x39,0x00,0xb2,0xb0,0x0d,0x11,0x24,0x0c,0x00,0x00,
+0xab,0xba,0x70,0xd0,0xe4,0x03,0x04,0x13,0x02,0x00,0x1c,0x04,0x11,0x0d,0x87,0x0a,
+0x02,0x0e,0x00,0x00,0x17,0x02,0x19,0x01,0x42,0x00,0x11,0x0d,0x0b,0x00,0x60,0xdc,
+0xc0,0x0d,0x00,0x01,0x0d,0xa3,0x00,0x21,0xa1,0xd0,0x42,0x06,0x01,0x43,0x02,0x19,
+0xb0,0x24,0x00,0x01,0x0b,0x00,0x04,0xbe,0x0a,0x00,0x88,0x00,0xb3,0x90,0x91,0xd0,
+0x00,0x0c,0x0a,0x2d,0x00,0x00,0xc0,0xa2,0x09,0x00,0x61,0xea,0xe2,0xd0,0x00,0x0c,
+0x1b,0x12,0x00,0xa2,0xd4,0x46,0x2c,0x0a,0x24,0x76,0x40,0xc0,0xa2,0x00,0x30,0x08,
+0x00,0x09,0x00,0x70,0x04,0x06,0x10,0x30,0x00,0x00,0xa0,0x4c,0x00,0x01,0x04,0x00,
+0x74,0x02,0x33,0xd0,0xd0,0x06,0x88,0xe0,0x10,0x00,0x70,0xd4,0x46,0x80,0xd0,0x57,
+0x76,0x30,0x81,0x00,0x04,0x04,0x00,0xf0,0x12,0x60,0x60,0x00,0x00,0x83,0xd0,0x00,
+0x00,0x94,0xd0,0x04,0xcc,0xe4,0xd0,0x00,0x00,0x84,0xd0,0x01,0x30,0x93,0xac,0xcb,
+0x91,0x93,0x00,0x00,0x00,0x20,0x08,0xcc,0xcc,0xe1,0x95,0x09,0xf0,0x09,0x09,0xdc,
+0xcc,0xc1,0x0b,0x30,0x00,0x00,0x08,0xdc,0xcc,0xc4,0x60,0x00,0x00,0x46,0xd0,0x00,
+0x00,0x57,0xd0,0x04,0xcc,0xd7,0x08,0x00,0xf2,0x10,0xd6,0x68,0xa2,0x57,0x35,0x54,
+0x20,0x66,0x00,0x4b,0x99,0x11,0x03,0x34,0x54,0x21,0x18,0x88,0x88,0x96,0x00,0x7b,
+0xba,0x50,0x06,0xa0,0x01,0xc2,0x01,0xbc,0xbc,0xcc,0x00,0x03,0xcf,0x00,0x40,0xa1,
+0xd0,0x00,0x0d,0xc6,0x00,0x12,0xd0,0xcf,0x00,0x45,0x02,0xbb,0xe0,0xa2,0xe1,0x00,
+0x3f,0xd5,0x57,0x3c,0xcf,0x00,0x01,0x2e,0x00,0x10,0x61,0x04,0x02,0x05,0x00,0x02,
+0xa7,0x07,0x21,0x31,0x00,0xce,0x02,0x02,0x05,0x00,0x02,0xd9,0x04,0x1c,0xa0,0x28,
+0x00,0x21,0xcc,0x20,0x2d,0x05,0xa0,0x12,0x22,0x4b,0x22,0x22,0x7a,0xaa,0xaa,0xaa,
+0xa9,0x54,0x06,0xa0,0x00,0x01,0xbb,0xbb,0xbb,0x40,0x00,0x0e,0x00,0x65,0x3d,0x0c,
+0x95,0x75,0x00,0x02,0xcb,0xbb,0xbb,0x80,0x00,0x50,0x73,0x04,0x26,0x00,0xd0,0x0b,
+0x00,0x47,0xec,0xbb,0xbc,0x30,0x07,0x09,0x63,0x05,0xcc,0xcc,0xeb,0xbb,0xa0,0x86,
+0x05,0x25,0x02,0xb0,0x91,0x05,0x60,0x01,0x80,0x00,0x00,0x00,0x81,0x0a,0x00,0x15,
+0xb1,0x05,0x00,0x32,0x7c,0xbb,0xbb,0x35,0x00,0x52,0x3b,0xbb,0xbe,0xbb,0xb6,0x90,
+0x03,0x42,0x9c,0xcc,0xbe,0x10,0x3a,0x02,0x10,0xec,0xc4,0x00,0x02,0xf8,0x04,0x00,
+0x34,0x05,0x1d,0x50,0xe7,0x00,0x00,0x7c,0x00,0x17,0xca,0x7b,0x00,0x70,0x7c,0xcd,
+0xcc,0xfb,0xb5,0x00,0x39,0xac,0x02,0x06,0x05,0x00,0x10,0x26,0xf3,0x00,0x0f,0x28,
+0x01,0x06,0x12,0xdc,0x89,0x05,0x08,0x01,0x00,0x02,0x6a,0x06,0x1a,0x90,0x28,0x00,
+0x30,0xca,0xaa,0xaa,0x24,0x01,0x02,0x5a,0x09,0x08,0x6b,0x05,0x15,0xc0,0x23,0x00,
+0x13,0xe0,0x88,0x06,0x3c,0x30,0x00,0x90,0xa5,0x00,0x17,0xbb,0x7e,0x06,0x03,0x26,
+0x01,0x66,0x99,0x60,0x00,0x00,0x89,0x22,0x24,0x09,0x10,0x1d,0x24,0x09,0x11,0xb3,
+0x9c,0x03,0x00,0x82,0x03,0x0f,0x04,0x00,0x01,0x71,0xd4,0x46,0x81,0xc0,0x57,0x76,
+0x30,0x97,0x0b,0x03,0x04,0x00,0x00,0x0d,0x09,0x00,0x66,0x06,0x22,0x93,0xd0,0x04,
+0x00,0x23,0x94,0xd0,0x0c,0x00,0x40,0xcc,0xcc,0xc3,0x93,0x98,0x04,0x00,0x0b,0x0c,
+0x40,0x0b,0x31,0x11,0xb2,0x0a,0x0c,0x00,0x04,0x00,0x00,0x09,0x0c,0x12,0x40,0xd5,
+0x02,0x16,0x93,0x04,0x00,0x50,0x10,0x93,0xbc,0xcc,0xb2,0x30,0x00,0xf1,0x03,0x41,
+0x08,0x00,0x00,0x61,0x0b,0x10,0x00,0x92,0x0b,0xdc,0xcc,0xe2,0x0b,0x10,0x00,0xa2,
+0x08,0x94,0x05,0x00,0xb2,0x03,0x3c,0xec,0xcb,0x30,0x8e,0x03,0x35,0x0d,0xcc,0x10,
+0x0a,0x04,0xa7,0x00,0x00,0xd0,0x01,0x30,0xc0,0x00,0x0a,0xcb,0xa9,0x16,0x09,0x22,
+0x0c,0x00,0x36,0x04,0x97,0x01,0x22,0x20,0x08,0x00,0x00,0xe9,0x99,0x10,0x42,0x00,
+0x20,0xda,0xa0,0x0b,0x00,0x10,0x22,0x6b,0x04,0x64,0xd0,0x00,0x08,0xaa,0x96,0x0d,
+0x37,0x00,0x39,0xb0,0x00,0x08,0x66,0x02,0x10,0x09,0xf7,0x0d,0x4c,0x01,0x11,0x20,
+0x0c,0x42,0x00,0x22,0xdc,0xc0,0x0b,0x00,0x34,0xcc,0xce,0xc0,0x78,0x04,0x00,0x55,
+0x06,0x00,0x45,0x00,0x11,0x0c,0x18,0x0e,0x13,0xf0,0x0b,0x00,0x02,0x4c,0x04,0x01,
+0x90,0x02,0x90,0x22,0x20,0x90,0xa0,0x0e,0x89,0x70,0xc0,0xb1,0x02,0x06,0x05,0x05,
+0x00,0x62,0xea,0xe1,0x0d,0x00,0x00,0xc1,0x0f,0x00,0x90,0x0e,0x55,0x72,0xc0,0xb1,
+0x05,0x76,0x40,0xc0,0xa2,0x02,0x06,0x05,0x00,0xd2,0x40,0x60,0x12,0x22,0x10,0x28,
+0xda,0xaa,0x60,0x39,0xd0,0x00,0x00,0x04,0x00,0x70,0x02,0xcc,0xc9,0xd0,0x00,0x00,
+0x3a,0x04,0x00,0x83,0xd4,0x45,0x63,0x2a,0x57,0x76,0x51,0x2a,0x79,0x08,0x00,0xd6,
+0x0a,0x80,0x15,0x11,0x11,0x10,0x09,0x0d,0x99,0x96,0xbc,0x01,0xe1,0x11,0x1c,0x0d,
+0x00,0x08,0xaa,0xc0,0xd0,0x00,0x21,0x0c,0x08,0xbb,0xbb,0xc2,0x01,0x32,0x03,0x00,
+0x5c,0x96,0x00,0xf0,0x00,0x0c,0x00,0x6d,0xcc,0xdc,0x80,0x07,0x70,0x00,0x00,0x00,
+0x5d,0xcc,0xcc,0xb0,0xf1,0x02,0x11,0x11,0x00,0x08,0x0d,0x99,0x94,0x00,0xc0,0xd0,
+0x00,0x00,0x0c,0x0d,0x00,0x0b,0xcc,0x09,0x00,0xf0,0x2a,0x0c,0xbb,0xce,0x10,0xc0,
+0x00,0x01,0x00,0x06,0x00,0x9b,0xbb,0xbb,0x90,0x00,0x51,0x00,0x50,0x00,0x0c,0x00,
+0x0c,0x00,0x00,0xc0,0x00,0xc0,0x00,0xac,0xbb,0xbb,0xa2,0x01,0x22,0x10,0x80,0xa0,
+0x0e,0xaa,0x70,0xc0,0xb0,0x0d,0x00,0x00,0xd0,0xc0,0x0d,0x00,0x00,0xc0,0xb0,0x0c,
+0x00,0xbc,0xf0,0xb0,0x24,0x00,0x02,0x05,0x00,0xd2,0x0d,0x34,0x61,0xc0,0xb0,0x06,
+0x87,0x50,0xc0,0xb0,0x00,0x00,0x00,0x05,0x00,0xf0,0x28,0xb1,0x00,0x00,0x00,0x40,
+0x60,0x24,0x42,0x09,0x09,0x1d,0x77,0x30,0xd0,0xb2,0xd0,0x00,0x0d,0x0a,0x2d,0x00,
+0xbc,0xf0,0xa2,0xd0,0x00,0x0c,0x0a,0x2d,0x78,0xa1,0xc0,0xa2,0x24,0x31,0x09,0x0a,
+0x10,0x03,0x33,0x44,0x30,0x01,0x88,0x88,0x8e,0x00,0x00,0x00,0x00,0xd0,0x00,0x00,
+0x00,0x0d,0x09,0x00,0xa0,0xa0,0x00,0x00,0x08,0x08,0x0c,0xbb,0x60,0xd0,0xa1,0x36,
+0x00,0x50,0x1d,0x00,0xbc,0xf0,0xa1,0x36,0x00,0xa0,0x1d,0x01,0x30,0xc0,0xa1,0x8b,
+0xa8,0x1c,0x0b,0x10,0x5f,0x00,0xf4,0x0a,0x02,0x90,0x05,0x08,0x00,0x39,0x00,0x00,
+0x00,0x02,0x90,0x00,0x00,0x00,0x1c,0xcc,0xcc,0xb2,0x00,0x00,0x0a,0x09,0x1c,0xbb,
+0x50,0x6c,0x00,0x11,0xbb,0x6c,0x00,0x40,0x0b,0x2a,0xcb,0xb1,0x8c,0x00,0x71,0x02,
+0x03,0x00,0x0b,0xcc,0xcc,0xe0,0x63,0x00,0x80,0x0c,0xcc,0xcc,0xb0,0x00,0xe0,0x00,
+0x00,0x12,0x00,0x21,0xc3,0x00,0x01,0x00,0x32,0xec,0xcc,0xb6,0x81,0x00,0x07,0x05,
+0x00,0x70,0xdc,0xcc,0xca,0x00,0x00,0x00,0x21,0x0b,0x00,0x10,0x75,0x05,0x00,0xd1,
+0x76,0x00,0x00,0x8c,0xcc,0xcc,0xcc,0xc8,0x00,0x9b,0xbb,0xba,0x00,0x40,0x00,0x02,
+0x05,0x00,0x91,0xcb,0xbb,0xbb,0x20,0x00,0x00,0x67,0x00,0x00,0x05,0x00,0x11,0x7c,
+0x23,0x00,0x00,0x01,0x00,0x96,0x01,0xcc,0xcc,0xce,0x30,0x00,0x00,0x00,0x09,0x05,
+0x00,0x3a,0x20,0x00,0xab,0x3c,0x00,0x41,0xdb,0xbb,0xbb,0x10,0x5a,0x00,0xf0,0x04,
+0x36,0x66,0xaa,0x66,0x63,0x46,0x66,0x66,0x66,0x63,0x00,0x04,0x99,0x60,0x00,0x00,
+0x89,0x22,0x7b,0x87,0x00,0xb1,0x0c,0x10,0x00,0xb3,0x00,0x1d,0x00,0x00,0x2b,0xbb,
+0xb3,0x54,0x00,0x60,0x90,0xeb,0xbb,0x90,0x0c,0x0e,0x60,0x01,0x32,0xe0,0x00,0x00,
+0x09,0x00,0x61,0xbc,0xcc,0xb1,0x0c,0x00,0x02,0xaf,0x01,0x00,0xb8,0x01,0x74,0x02,
+0x30,0xc4,0xbb,0xbb,0x96,0x0d,0xc6,0x00,0xf0,0x11,0x08,0x07,0xaa,0xa9,0x01,0x70,
+0xd1,0x11,0x00,0x1b,0x0d,0x00,0x00,0x01,0xb0,0xd0,0x00,0x00,0x1b,0x08,0xce,0xca,
+0x01,0xb0,0x00,0xc0,0x00,0x1b,0x5b,0xbf,0xbb,0x71,0xac,0x01,0xc0,0x1b,0x00,0x50,
+0x00,0x01,0xa0,0x0c,0x10,0x00,0x00,0x00,0xc1,0x33,0x00,0x30,0xcc,0xcc,0xc7,0x3f,
+0x00,0x46,0x10,0x8c,0xcc,0x90,0x36,0x00,0xf0,0x03,0x0c,0x99,0x9a,0x01,0xb0,0x02,
+0xd2,0x10,0x1b,0x00,0x0c,0x02,0x21,0xb5,0xbb,0xcb,0x94,0x1b,0x24,0x00,0xf8,0x0d,
+0x20,0x0c,0xcc,0xcc,0xd9,0x00,0xd0,0x00,0x03,0xa0,0x0e,0x00,0x00,0x39,0x00,0x9c,
+0xcc,0xcb,0x50,0x00,0xaa,0xaa,0xaa,0x00,0x00,0xd1,0x11,0x10,0x4c,0x01,0x55,0xeb,
+0xbb,0xa9,0x20,0x00,0x01,0x00,0x50,0x5c,0xcc,0xce,0xcc,0xba,0x78,0x00,0x18,0x00,
+0x05,0x00,0x72,0x18,0x00,0x00,0x00,0x9c,0xcc,0xb9,0x85,0x00,0x02,0x05,0x00,0x10,
+0x8b,0x1f,0x01,0x00,0x01,0x00,0x81,0x3b,0xbb,0xbe,0xbb,0xb7,0x00,0x00,0x0c,0x23,
+0x00,0x20,0xbe,0x10,0xbc,0x01,0x53,0x10,0x00,0xdc,0xcc,0xcb,0x47,0x01,0x41,0xcc,
+0xcc,0xcc,0x50,0xb3,0x00,0xf0,0x07,0x5a,0xaa,0xa0,0x0c,0x0a,0x41,0x10,0x00,0xc0,
+0xa3,0x00,0x00,0x0c,0x0a,0x30,0x00,0x00,0xc0,0x7c,0xcc,0xb3,0x0c,0x1b,0x00,0x45,
+0xc3,0xbb,0xbb,0xba,0xd7,0x02,0x06,0x09,0x00,0x00,0x3a,0x01,0x6e,0x40,0x00,0xaa,
+0xaa,0xa7,0x00,0xb3,0x00,0x26,0xcb,0x00,0x01,0x00,0xa7,0x8c,0xcd,0xcc,0xfb,0xb5,
+0x00,0x38,0x00,0xc0,0x00,0x05,0x00,0x3f,0x26,0x00,0xa0,0xb3,0x00,0x07,0x70,0x5b,
+0xbe,0xbb,0xeb,0xb7,0x00,0x0c,0x16,0x00,0x40,0xbc,0xcc,0xbe,0x20,0xb3,0x00,0x6a,
+0x30,0x00,0xec,0xcc,0xcb,0x10,0xb3,0x00,0x02,0x7c,0x02,0x00,0x4e,0x00,0x08,0x05,
+0x00,0x4b,0xec,0xcc,0xc9,0x00,0x01,0x00,0x00,0x7c,0x02,0x1c,0xc7,0x7c,0x02,0x42,
+0xcc,0xbb,0xcb,0x20,0x6d,0x02,0x9f,0x11,0x11,0x11,0x10,0x7a,0xaa,0xaa,0xab,0xb7,
+0x7c,0x02,0x07,0x38,0xac,0xcc,0xc9,0x3c,0x00,0x01,0x05,0x00,0x45,0x9b,0xbc,0xcb,
+0x10,0x5f,0x00,0x12,0xc8,0x6a,0x00,0x1a,0x80,0x08,0x03,0x10,0xbc,0xaa,0x00,0x83,
+0x8c,0xbc,0xba,0x00,0x00,0xb2,0x00,0x00,0x05,0x00,0x52,0x7b,0xbb,0xcb,0x30,0x00,
+0x09,0x00,0x23,0xbb,0xbb,0x73,0x00,0x60,0xcd,0xcc,0xcf,0x00,0x00,0x00,0xb3,0x02,
+0x18,0xec,0x99,0x01,0x1f,0x40,0xb4,0x00,0x06,0xa2,0x47,0x77,0x77,0x77,0x75,0x24,
+0x44,0x44,0x44,0x42,0xf4,0x02,0x30,0x7a,0x32,0x7c,0x45,0x01,0x40,0x0b,0x20,0x00,
+0xa4,0xf4,0x02,0xfb,0x02,0x1b,0xbb,0xb3,0x00,0x12,0x22,0x10,0x28,0xda,0x99,0x50,
+0x2a,0xd0,0x00,0x00,0x2a,0xc0,0x04,0x00,0xb4,0xd5,0x56,0x72,0x2a,0x47,0x65,0x40,
+0x2a,0x00,0x00,0x00,0x04,0x00,0x10,0x15,0x57,0x00,0xb5,0x11,0x11,0x00,0x39,0xd9,
+0x99,0x40,0x39,0xd0,0x00,0x00,0x04,0x00,0xf4,0x0d,0xcb,0xbc,0xe2,0x39,0x00,0x02,
+0x20,0x27,0x00,0x29,0xb9,0x40,0x01,0xd3,0x02,0xb4,0x05,0x80,0x00,0x49,0x03,0xb0,
+0x00,0x87,0x00,0x7c,0xbb,0x90,0x61,0x01,0xf0,0x09,0x90,0x01,0xec,0x5c,0xc9,0x0c,
+0x00,0x1b,0x00,0xd0,0x00,0xd0,0x02,0xb0,0x0d,0x00,0x0d,0x00,0x2b,0x00,0xd0,0x00,
+0xea,0x72,0x0b,0x00,0x10,0x21,0x0b,0x00,0x10,0xc0,0x16,0x00,0x71,0x0c,0x00,0x0a,
+0xb5,0x8b,0xa0,0xc0,0xea,0x00,0x15,0x00,0x24,0x01,0x12,0x09,0x43,0x00,0xd5,0x02,
+0x31,0x32,0x09,0x0b,0x0e,0x8a,0x95,0x0c,0x0c,0x0c,0x0a,0x20,0x05,0x00,0x81,0x10,
+0x0f,0xcc,0x0c,0x0a,0x10,0x0c,0x0c,0x05,0x00,0x90,0x0d,0x3a,0x54,0x0c,0x0c,0x05,
+0x73,0x75,0x0c,0x3e,0x00,0x06,0x05,0x00,0xc6,0x04,0x06,0x08,0xdc,0x5b,0xcc,0x40,
+0x0a,0x30,0x0d,0x00,0x00,0x05,0x00,0x53,0x08,0xdb,0x7b,0xcc,0x60,0x84,0x04,0x13,
+0x76,0x89,0x04,0x02,0xa9,0x01,0xf0,0x04,0xab,0x93,0xbb,0x70,0x00,0x1c,0x10,0x67,
+0x10,0x00,0x01,0xc0,0x06,0x60,0x00,0x00,0x1c,0x00,0x66,0xb4,0x02,0x37,0xb6,0xdc,
+0xa0,0x33,0x02,0x63,0x03,0xcc,0xcc,0xec,0xcb,0xb0,0x56,0x05,0x02,0xa9,0x00,0x02,
+0x0b,0x00,0x03,0x25,0x00,0xf0,0x00,0x10,0x89,0x48,0x95,0x0c,0x0c,0x21,0xc2,0x10,
+0xc0,0xc0,0x0b,0x00,0x0c,0x0c,0x16,0x04,0x31,0xdc,0x6d,0xc7,0xd7,0x00,0x5f,0xc4,
+0xbb,0xbb,0xbb,0x1c,0x2f,0x03,0x03,0x11,0x50,0xf0,0x00,0x31,0x02,0xcc,0xce,0xab,
+0x02,0x30,0xd0,0x0c,0x10,0x56,0x00,0x90,0xc1,0x00,0x0c,0xcc,0xd0,0x0c,0xcc,0x21,
+0xb0,0xc2,0x01,0x10,0x1b,0x06,0x02,0xa1,0x01,0xb0,0x00,0x20,0xb1,0x00,0x0b,0xbb,
+0xa8,0x0b,0x61,0x02,0x10,0xb1,0x05,0x00,0x02,0x0b,0x00,0xa1,0x60,0x00,0x02,0x22,
+0x20,0x08,0x00,0x01,0xaa,0x9e,0x33,0x03,0x50,0xc0,0x0c,0x10,0x00,0x89,0x0b,0x00,
+0xe5,0x0d,0x22,0x10,0x0b,0xdc,0x10,0xc0,0x01,0x30,0xb1,0x00,0x0a,0xbb,0x85,0x37,
+0x00,0x34,0x80,0x00,0x09,0x6c,0x01,0x22,0xc0,0x00,0xa0,0x04,0x11,0xc2,0x71,0x02,
+0x40,0x00,0x01,0xbb,0xbb,0x13,0x00,0x10,0x10,0x42,0x00,0x01,0x6a,0x03,0x70,0x0e,
+0xcc,0xb0,0x0c,0xdc,0x10,0xc0,0x37,0x00,0x82,0x0e,0xab,0xcc,0x0b,0x10,0x00,0x01,
+0x02,0xce,0x02,0x00,0x7c,0x00,0x30,0xdc,0xcc,0xe1,0x42,0x00,0x20,0x0b,0x10,0x4d,
+0x00,0x10,0xb1,0xb9,0x03,0x26,0xbb,0x00,0x48,0x00,0x16,0xc1,0x48,0x00,0x10,0xb1,
+0x48,0x00,0x2e,0x0b,0xdc,0x48,0x00,0xc0,0x04,0xab,0x81,0x00,0x00,0x05,0xa1,0x04,
+0xc0,0x00,0x00,0xa2,0xa7,0x02,0xa3,0x07,0x60,0x01,0xd0,0x00,0x00,0x09,0xbb,0xb4,
+0x00,0xff,0x01,0xb2,0x33,0x20,0x80,0x0b,0x08,0x98,0xd0,0xc0,0x0c,0x00,0x00,0x05,
+0x00,0xf1,0x0c,0xb0,0x0c,0x0a,0xbb,0xd0,0xba,0xac,0x0d,0x11,0x00,0xb1,0x1c,0x0d,
+0x00,0x00,0xb0,0x0c,0x0d,0x01,0x21,0xb0,0x0c,0x09,0xba,0x82,0xb0,0x0c,0xfa,0x00,
+0x04,0x05,0x00,0xf0,0x07,0x40,0x06,0x04,0x55,0x40,0x80,0x91,0x05,0x66,0xc0,0xd0,
+0xa2,0x00,0x00,0xc0,0xd0,0xa2,0x0c,0xcc,0xa0,0xdc,0xe2,0x6b,0x07,0xc0,0xa2,0x0e,
+0x45,0x73,0xc0,0xa2,0x04,0x66,0x40,0x90,0x91,0x00,0x2e,0x07,0x5a,0x00,0x18,0x88,
+0x88,0xe0,0xa1,0x03,0x92,0xa0,0x04,0x44,0x40,0x08,0x00,0x01,0x78,0x7e,0x4f,0x01,
+0x70,0x0b,0xcb,0x00,0xc9,0x9a,0x00,0xb1,0xe6,0x00,0xf0,0x0e,0x0b,0xbb,0x00,0xe9,
+0xab,0xb0,0xb2,0x00,0x03,0x43,0x20,0x0a,0x00,0x00,0x00,0x4a,0xb8,0x10,0x00,0x00,
+0x5a,0x10,0x4c,0x00,0x00,0x0a,0x20,0x00,0xb2,0x53,0x02,0x10,0x1d,0x03,0x04,0x20,
+0xbb,0x40,0x91,0x01,0x50,0x00,0xa1,0xaa,0x9e,0x00,0xb4,0x00,0x02,0xf1,0x01,0x70,
+0x09,0xaa,0xe0,0xcc,0xc0,0xd2,0x21,0x28,0x08,0x10,0x00,0x31,0x08,0x51,0x20,0x0c,
+0x0a,0xbb,0xb9,0x81,0x01,0x14,0x0b,0x8a,0x01,0x90,0x05,0x0a,0xbb,0xb0,0x00,0xb0,
+0x01,0x0d,0x00,0xa8,0x00,0x70,0x11,0xd0,0xec,0xcb,0x1a,0xae,0x0d,0x94,0x00,0xf0,
+0x07,0xea,0xbb,0xb1,0x0c,0x00,0x10,0x00,0x00,0x80,0x03,0xaa,0xab,0xb8,0x00,0x77,
+0x11,0x11,0xd0,0x07,0x60,0x00,0x0d,0xc1,0x02,0x50,0xd0,0x03,0xbb,0xbb,0xb7,0x36,
+0x00,0x13,0xa0,0x36,0x00,0x61,0x22,0xd0,0xec,0xcb,0x19,0xad,0x36,0x00,0x31,0xdb,
+0xbb,0xb1,0xe5,0x01,0x50,0x50,0x05,0x40,0x00,0x08,0xe9,0x02,0x51,0xc0,0x07,0xdc,
+0xcc,0xcc,0x09,0x00,0xd0,0x05,0xcb,0xbb,0xb9,0x01,0x22,0x20,0x71,0x0b,0x07,0xa9,
+0xc0,0xa2,0xa3,0x00,0x20,0xa2,0x0c,0x1a,0x01,0xa0,0x0c,0x09,0xab,0xea,0xe2,0x0c,
+0x0d,0x22,0x11,0xa2,0xa5,0x00,0xb0,0x92,0x0c,0x0d,0x00,0x10,0x92,0x0c,0x0a,0xbb,
+0x92,0xa2,0x48,0x00,0x15,0xa1,0x05,0x00,0xf3,0x15,0x40,0x07,0x04,0x56,0x30,0x80,
+0x91,0x04,0x67,0xb0,0xc0,0xa2,0x00,0x01,0xb1,0xc0,0xa2,0x0c,0xcc,0xba,0xe0,0xa2,
+0x0d,0x00,0x00,0xb1,0xa2,0x0d,0x45,0x65,0xb1,0xa2,0x04,0x66,0x41,0x80,0x5c,0x01,
+0x1d,0x08,0x5c,0x01,0x00,0x2a,0x03,0xf0,0x01,0x70,0x80,0x07,0xbc,0xa0,0xc1,0xb0,
+0x00,0x01,0xb0,0xc1,0xb1,0x0a,0xcc,0xcb,0xf1,0x08,0x09,0x00,0x0d,0x09,0x62,0x10,
+0xc0,0xb0,0x0a,0xbb,0xa1,0xef,0x08,0x00,0x34,0x01,0x30,0x70,0xa0,0x00,0x92,0x07,
+0x02,0x05,0x00,0x00,0x65,0x08,0x62,0x01,0x22,0x20,0x00,0xa0,0x9a,0x56,0x01,0xf0,
+0x04,0x88,0xc0,0x00,0x0c,0x04,0x4c,0x09,0xaa,0xe0,0x00,0xc0,0xd2,0x21,0x01,0x2c,
+0x0d,0x00,0x00,0xaa,0x56,0x01,0x19,0x0b,0x56,0x01,0x10,0xb0,0x56,0x01,0xf0,0x01,
+0x07,0x77,0x70,0x00,0xb0,0x44,0x4d,0x04,0x4d,0x00,0x00,0xc0,0x77,0xd0,0xcc,0xcc,
+0x83,0x01,0xf5,0x05,0x01,0xcc,0xd0,0xe3,0x35,0x70,0x0c,0x06,0x87,0x64,0x00,0xc0,
+0x01,0x34,0x44,0x43,0x00,0x48,0x88,0x88,0x30,0x09,0x00,0x09,0x00,0xf2,0x0e,0x0a,
+0x0a,0xbb,0xa0,0x00,0xc0,0x00,0x10,0xd2,0xaa,0xe0,0x00,0x00,0xc0,0x44,0xd0,0x0e,
+0xcc,0xb0,0x44,0xd0,0x0d,0x00,0x02,0x66,0xd0,0x0c,0xcb,0xba,0x38,0x03,0x62,0x30,
+0x00,0x5c,0xcc,0xcc,0xa0,0x31,0x00,0x42,0x5c,0xcc,0xdc,0xa0,0x52,0x04,0x60,0x5d,
+0xcc,0xcc,0xc1,0x00,0x00,0xd8,0x03,0x33,0xab,0xbb,0xbc,0xd6,0x04,0x35,0xcc,0xcc,
+0xcb,0x8d,0x06,0x10,0x14,0x21,0x02,0x50,0xa9,0x10,0x00,0x00,0x65,0x10,0x00,0x14,
+0x66,0x88,0x06,0x02,0x3d,0x03,0x00,0x2d,0x00,0x35,0xac,0xcc,0xce,0x29,0x06,0x21,
+0xbc,0x30,0xcc,0x07,0x54,0x5c,0xcb,0xce,0xbc,0xc7,0x88,0x06,0x30,0xcd,0x20,0x00,
+0xce,0x04,0x04,0x05,0x00,0x63,0x08,0x10,0x00,0xac,0xcb,0xbb,0x8b,0x04,0x33,0xab,
+0xbb,0xbe,0x3c,0x00,0xf0,0x06,0xdb,0xbb,0xbd,0x20,0x00,0x00,0x58,0x00,0x00,0x7a,
+0xaa,0xcd,0xaa,0xa6,0x11,0x11,0x11,0x22,0x20,0x00,0x60,0x41,0x00,0x10,0xc0,0x9d,
+0x00,0x13,0xc0,0x4c,0x06,0x10,0x30,0x62,0x08,0x03,0x78,0x00,0x10,0xbc,0x0a,0x00,
+0xf3,0x08,0xb3,0x11,0x12,0x00,0x00,0x5a,0xae,0x99,0x20,0x26,0x55,0x5d,0x55,0x66,
+0x14,0x44,0x54,0x44,0x43,0x01,0xcc,0xcc,0xcc,0x73,0x00,0x10,0xbc,0x7d,0x00,0x06,
+0x6e,0x07,0x03,0x3c,0x00,0x19,0x0d,0xb4,0x00,0x13,0xbc,0xb4,0x00,0x30,0x7c,0xcc,
+0xcf,0xf0,0x09,0x10,0x02,0x15,0x00,0x10,0x2c,0x05,0x00,0xc3,0xbd,0x60,0x00,0x00,
+0x2c,0x70,0xa9,0x00,0x01,0xb3,0x00,0x06,0x44,0x04,0x07,0x22,0x01,0x43,0xbb,0xcb,
+0x00,0x01,0x22,0x01,0x10,0x11,0x22,0x01,0x60,0xaa,0x10,0x00,0x09,0x00,0x80,0x5d,
+0x00,0x10,0xc0,0x2c,0x08,0x10,0xdc,0x22,0x01,0x13,0xba,0x2d,0x00,0x80,0x89,0x99,
+0xae,0x00,0x00,0xd2,0x22,0x21,0x73,0x00,0x20,0x02,0x00,0x0f,0x07,0x02,0x3c,0x07,
+0x50,0x4c,0xcc,0xcc,0xcc,0xc9,0xbb,0x05,0x18,0x00,0x05,0x00,0x39,0x07,0x00,0x00,
+0x5e,0x01,0x13,0xcd,0xaa,0x00,0x43,0xcc,0xcc,0xbb,0x20,0xaa,0x07,0x60,0xdd,0xcc,
 0xc7,0x00,0x10,0x48,0x7d,0x00,0x81,0x13,0x0a,0x10,0x01,0xfc,0xcc,0xce,0x10,0xd8,
 0x04,0x00,0xe6,0x00,0x00,0x32,0x00,0x13,0xc8,0x53,0x09,0x30,0x89,0x99,0xab,0x78,
-0x00,0x16,0x20,0x78,0x00,0x23,0x10,0x00,0xa1,0x16,0x40,0xcc,0xc6,0x00,0x2a,0x04,
-0x05,0x06,0x05,0x00,0x38,0x16,0x00,0x70,0x05,0x16,0x14,0xbc,0x78,0x00,0x00,0xf5,
-0x00,0x03,0x78,0x00,0x41,0xce,0xcc,0xec,0xc7,0xa3,0x15,0x58,0x01,0xec,0xcc,0xce,
-0x10,0x3a,0x12,0x02,0x37,0x00,0x10,0x02,0x41,0x00,0x15,0xbc,0xb9,0x00,0x18,0xcc,
-0x48,0x03,0x14,0xab,0x7d,0x00,0x07,0xcc,0x08,0x3d,0xbc,0xcc,0xb9,0x6e,0x00,0x41,
-0xea,0xaa,0xab,0x20,0xab,0x20,0x00,0x2f,0x10,0x12,0xa6,0x4e,0x15,0x0b,0x9d,0x0f,
-0x10,0xac,0x08,0x02,0x38,0x8c,0xcc,0xbd,0x08,0x02,0xf0,0x04,0xc0,0x00,0x02,0x10,
-0x00,0x7b,0xbc,0xbb,0x30,0x25,0x44,0x44,0x44,0x54,0x25,0x55,0x55,0x55,0x53,0x19,
-0x00,0x10,0x20,0x71,0x02,0x10,0x40,0x5f,0x00,0x15,0x30,0xcc,0x08,0x00,0xe5,0x14,
-0x13,0xba,0x78,0x00,0x01,0x31,0x01,0x03,0xc1,0x12,0x27,0xbc,0x10,0x9b,0x00,0x01,
-0xcf,0x00,0x91,0xdc,0xcc,0xdd,0x10,0x03,0xa0,0x00,0x0a,0x20,0x05,0x00,0x40,0x01,
-0xbb,0xbb,0xba,0x28,0x05,0x50,0x09,0x12,0xaa,0x9e,0x00,0x2c,0x1c,0x00,0x80,0x12,
-0xb0,0x00,0xa1,0x09,0xaa,0xf0,0x0a,0x10,0xd2,0x21,0x00,0xa1,0xb4,0x07,0xa1,0x10,
-0xd0,0x00,0x20,0xa1,0x0a,0xcb,0xb9,0x2a,0x20,0x5d,0x1b,0x11,0x00,0xb1,0x1e,0x02,
-0xc0,0x00,0x00,0x64,0x06,0x40,0x0c,0x00,0x10,0xb1,0xd5,0x1c,0x51,0x10,0x0d,0x0e,
-0xcc,0xb1,0x19,0x12,0xa2,0x0c,0x0e,0xab,0xcd,0x00,0xc0,0x01,0x02,0x00,0x0a,0x6e,
-0x1e,0x34,0xcb,0xbb,0xcb,0xf5,0x02,0x15,0x1c,0x78,0x14,0x90,0x06,0x66,0x60,0x00,
-0xb0,0x55,0x5c,0x10,0x0d,0x77,0x06,0x92,0xc0,0x9a,0xae,0x10,0x0c,0x0d,0x11,0x10,
-0x00,0xbc,0x0d,0x23,0xcb,0xbb,0x6d,0x14,0x50,0x53,0x00,0x00,0x70,0x07,0x84,0x13,
-0x20,0x74,0x00,0x20,0x2d,0x02,0xc8,0x15,0x5d,0x11,0xbb,0xbb,0x00,0x0d,0x75,0x00,
-0x14,0x0d,0x75,0x00,0xf0,0x02,0x06,0x00,0x5a,0xaa,0xbb,0x70,0x09,0x41,0x11,0x1c,
-0x00,0x93,0x00,0x00,0xc0,0x09,0x30,0xab,0x15,0x34,0xbb,0xbb,0x60,0xb0,0x00,0xf0,
-0x00,0x39,0x00,0x10,0xb1,0x03,0x90,0x00,0x0b,0x10,0x39,0x0e,0xcc,0xb0,0x03,0x90,
-0x49,0x09,0x40,0x0d,0xbb,0xdc,0x03,0x32,0x09,0xf0,0x00,0x13,0x00,0x53,0x00,0x02,
-0x60,0x07,0x40,0x00,0x48,0x00,0x7d,0xcc,0xcd,0x80,0x09,0x00,0x00,0x7e,0x17,0x12,
-0x50,0x76,0x00,0x17,0xb9,0x76,0x00,0x33,0x0d,0xcc,0xc0,0x76,0x00,0x71,0x99,0xab,
-0x00,0xd0,0x12,0x21,0x00,0xf1,0x17,0x11,0x60,0x93,0x27,0xa3,0x02,0xd7,0xc2,0x00,
-0x03,0xd4,0x03,0xc3,0x00,0x81,0x7c,0x19,0x19,0x11,0x26,0x01,0x33,0x0d,0xcc,0xc1,
-0x3b,0x00,0xf0,0x05,0x55,0x68,0x00,0xc0,0x46,0x54,0x20,0x0c,0x00,0x01,0x8b,0xa6,
-0x00,0x01,0xc3,0x01,0x7a,0x00,0x48,0x00,0xa6,0x09,0x63,0x00,0x3c,0x00,0x06,0xcb,
-0xba,0x5b,0x0c,0x00,0x44,0x00,0xf0,0x00,0xeb,0xbe,0x00,0x2a,0x00,0x0c,0x00,0xb0,
-0x02,0xa0,0x00,0xc0,0x0b,0x00,0x2b,0xce,0x07,0x70,0x02,0xfc,0xa0,0xc0,0x0b,0x10,
-0x1b,0x0b,0x00,0x00,0xe2,0x08,0x00,0x0b,0x00,0x32,0x0b,0xbb,0xa0,0x5b,0x01,0x07,
-0xde,0x15,0xa0,0x09,0x00,0x08,0x99,0x90,0x0b,0x00,0x00,0xd2,0x2d,0xcd,0x08,0x00,
-0x96,0x08,0x00,0x9b,0x07,0x30,0xbd,0xc1,0x0c,0x33,0x00,0x33,0x00,0xdb,0xbd,0xc2,
-0x08,0x04,0xc3,0x02,0x3c,0xbc,0xbb,0xbe,0x56,0x09,0x13,0xc0,0x3e,0x1a,0xa1,0x04,
-0x56,0x50,0x0b,0x00,0x00,0xd6,0x5d,0x00,0xd0,0x48,0x00,0x01,0xe3,0x07,0x11,0xc0,
-0x0b,0x00,0xa5,0xcc,0x10,0xc1,0x1c,0x10,0xc0,0x00,0x08,0xa9,0x91,0xd0,0x08,0x39,
-0xa0,0x00,0x08,0xde,0x08,0x01,0x92,0x10,0x05,0x8a,0x00,0x16,0xc0,0x42,0x00,0x22,
-0xcd,0xc1,0x0b,0x00,0x21,0xdb,0xbd,0x27,0x06,0x20,0x03,0x76,0x91,0x16,0x10,0x15,
-0xba,0x0d,0xf8,0x0d,0x3a,0xdc,0xa0,0x00,0x1a,0x00,0x99,0xc3,0x00,0x01,0xc5,0x3c,
-0x06,0x60,0x00,0x06,0x63,0x6b,0xb2,0x00,0x08,0x99,0x80,0x0a,0x00,0x00,0xc2,0x2d,
-0x84,0x00,0x60,0xcc,0xb0,0x0c,0x00,0xc1,0x0c,0x8c,0x03,0x23,0x10,0xc0,0xb0,0x03,
-0x12,0x0a,0x14,0x0f,0x01,0x2c,0x08,0x24,0xcc,0xdc,0xf7,0x1e,0x00,0x63,0x17,0x00,
-0x42,0x00,0x0f,0x84,0x00,0x09,0x13,0xc0,0x16,0x11,0x90,0x07,0xaa,0xaa,0x80,0x00,
-0x00,0x01,0x13,0xd5,0x0f,0x00,0x10,0xe4,0xab,0x0d,0x84,0x96,0xd6,0x00,0x00,0x18,
-0x20,0x00,0x65,0x14,0x09,0x60,0x10,0x90,0xa0,0x0e,0x88,0xb0,0x2a,0x10,0x16,0xc0,
-0x05,0x00,0x60,0xda,0xe0,0x0c,0x00,0xc0,0xc1,0x0a,0x00,0xb6,0xb0,0xb0,0x0d,0x66,
-0xc0,0xb0,0xb0,0x04,0x55,0x30,0xb0,0x3e,0x10,0x11,0xb0,0x3e,0x10,0xf0,0x05,0x08,
-0x99,0x60,0x70,0x64,0x0d,0x22,0xc0,0xd0,0x75,0x0c,0x00,0xc0,0xd0,0x76,0x0c,0x00,
-0xc0,0xcc,0xd5,0x41,0x00,0x60,0x75,0x0e,0xbb,0xb0,0xc0,0x75,0x23,0x00,0x10,0x32,
-0x1c,0x0a,0x10,0x52,0xbf,0x00,0x10,0x83,0x72,0x07,0x10,0xe3,0x0a,0x00,0x10,0x93,
-0x50,0x17,0x12,0xc1,0x50,0x03,0x40,0x99,0x70,0xb0,0xb2,0x41,0x00,0x20,0xb2,0x0c,
-0x55,0x09,0x00,0x41,0x00,0x10,0xe2,0x41,0x00,0x60,0xa2,0x0e,0xbb,0xc0,0xc0,0xa2,
-0x8b,0x0a,0xa0,0xa1,0x00,0x00,0x04,0x60,0x10,0x00,0x00,0x0a,0x70,0x98,0x0e,0xf0,
-0x04,0xc6,0x00,0x00,0x06,0xc1,0x0a,0x80,0x00,0x38,0x00,0x00,0x63,0x02,0x33,0x20,
-0x00,0xa0,0xe8,0x8d,0x9f,0x0b,0x22,0xb0,0x00,0x21,0x0b,0x80,0x00,0xb1,0xcc,0xc0,
-0xc0,0x0b,0x10,0x0c,0x23,0x0a,0x8b,0xc0,0xc2,0x3c,0x10,0x0c,0x07,0x88,0x70,0xec,
-0x17,0x80,0x05,0x66,0x50,0x00,0xa0,0x0e,0x76,0xe0,0xcf,0x1a,0x10,0xc0,0x2c,0x01,
-0x20,0xc1,0xbb,0x0a,0x00,0xa4,0x01,0xc0,0x0c,0x11,0xc1,0x00,0xc0,0x08,0xaa,0x91,
-0x58,0x07,0x10,0x46,0x61,0x13,0x15,0x57,0x44,0x1a,0xc1,0x2c,0xcc,0xcc,0xb0,0x08,
-0x99,0x80,0x00,0xb0,0x0d,0x22,0xd0,0x30,0x02,0x80,0x11,0xd0,0x0c,0x00,0xc2,0xab,
-0xd0,0x0c,0x3c,0x1f,0x32,0x0a,0xbb,0xb2,0x37,0x00,0x10,0x40,0xbc,0x05,0x12,0xb0,
-0x77,0x02,0x63,0x6d,0xcc,0xcc,0x90,0x00,0x83,0xd0,0x05,0x12,0xc0,0xa5,0x11,0x11,
-0x99,0x67,0x01,0x20,0xb0,0xc0,0x41,0x00,0x00,0x05,0x00,0x36,0xfc,0xf0,0xc0,0x76,
-0x01,0x7e,0x0d,0x33,0xc0,0xc0,0xb0,0x07,0x88,0xa5,0x11,0x00,0xa7,0x08,0x32,0x80,
-0x0e,0xaa,0xb4,0x00,0x10,0x9c,0x99,0x01,0x06,0xbe,0x00,0x54,0xbc,0xd0,0x0a,0xbb,
-0xb1,0xb4,0x00,0x10,0x73,0x70,0x13,0x00,0xd7,0x21,0x02,0x05,0x00,0x02,0x65,0x12,
-0x00,0x47,0x0c,0xd0,0x99,0x00,0x0c,0x0d,0x22,0xc0,0x9a,0xc0,0xd0,0x0c,0x01,0x2c,
-0x0d,0x3a,0x00,0x60,0xc0,0x0c,0x0c,0xcc,0x0d,0xbb,0x4b,0x0a,0x01,0x16,0x23,0x20,
-0x8b,0xa5,0xb5,0x03,0x30,0x97,0x00,0x57,0x9a,0x23,0x30,0xb0,0x00,0x5a,0xb5,0x03,
-0x05,0x0f,0x06,0x00,0x4f,0x06,0x10,0xcd,0xce,0x15,0x17,0x0c,0x05,0x00,0x21,0x01,
-0xeb,0x6c,0x07,0x15,0x11,0xfa,0x0c,0x04,0x7e,0x11,0x00,0xff,0x05,0x12,0x10,0x76,
-0x1a,0x01,0x05,0x00,0x20,0xdb,0xaa,0x0f,0x10,0x10,0x58,0x23,0x00,0x1f,0x48,0x7e,
-0x11,0x02,0x19,0x40,0x02,0x0f,0x11,0xcb,0x56,0x11,0x03,0x05,0x00,0x37,0xcb,0xbb,
-0xbd,0x82,0x10,0x21,0x8c,0xcc,0x36,0x05,0x15,0x03,0x02,0x08,0xc3,0xbe,0x50,0x00,
-0x00,0x0a,0x81,0xb7,0x00,0x01,0xc5,0x00,0x08,0x02,0x08,0x01,0x42,0x1c,0x33,0xd1,
-0x11,0x1d,0x9a,0x14,0x01,0x05,0x00,0x37,0xeb,0xbb,0xbd,0x74,0x0d,0x5d,0x4c,0xcc,
-0xce,0xcc,0xb8,0x89,0x1d,0x00,0x20,0x0e,0x0b,0x7d,0x00,0x34,0xda,0x9a,0xad,0x95,
-0x27,0x01,0x77,0x06,0x10,0xce,0xb9,0x00,0x05,0x11,0x0c,0x27,0xd0,0x06,0xef,0x06,
-0x10,0x50,0xd9,0x1b,0x03,0x70,0x14,0x01,0x05,0x00,0x10,0x8b,0x52,0x0f,0x04,0x65,
-0x10,0x15,0xb6,0x65,0x10,0x0f,0xdc,0x16,0x01,0xbe,0x40,0x23,0x33,0x00,0x64,0xd8,
-0x8d,0x10,0x75,0xc0,0x0b,0x04,0x00,0x61,0xc2,0x3c,0x10,0x75,0x78,0x87,0xdf,0x12,
-0x13,0x65,0xe7,0x12,0xc0,0x32,0x08,0x99,0x90,0x00,0xb0,0xd2,0x2c,0x00,0x0d,0x0d,
-0x00,0xb9,0x05,0x31,0x0c,0x00,0x0d,0x11,0x02,0x22,0xdb,0xbd,0xe6,0x04,0x12,0xb0,
-0xa5,0x16,0x0f,0x1d,0x21,0x02,0x05,0xc1,0x02,0x19,0xd0,0x44,0x02,0x07,0xc1,0x02,
-0x11,0x20,0xad,0x02,0x0c,0xc1,0x02,0x13,0x5c,0x14,0x00,0x13,0x00,0x49,0x02,0x02,
-0x77,0x00,0x01,0x80,0x00,0x10,0xc0,0x09,0x00,0x24,0xbb,0xd0,0x65,0x00,0xf4,0x06,
-0x0c,0x00,0x80,0x00,0x05,0xd0,0x00,0x00,0x02,0xd9,0xb0,0x00,0x03,0xd4,0x05,0xc1,
-0x00,0x92,0x00,0x02,0x70,0x3b,0x00,0x80,0x1b,0x0d,0x22,0xc0,0x01,0xb0,0xd0,0x0c,
-0xec,0x12,0x40,0xc0,0x01,0xb0,0xc0,0x09,0x00,0x21,0xbb,0xd0,0xde,0x05,0x14,0x19,
-0x84,0x02,0xe5,0xa6,0x00,0x47,0x00,0x02,0xa0,0x02,0xb0,0x00,0x69,0x00,0x06,0xcb,
-0xb9,0xb6,0x01,0x10,0x10,0x95,0x0c,0x33,0xc0,0x0d,0x10,0xb6,0x00,0x03,0x05,0x00,
-0x70,0x22,0xc1,0x00,0xd0,0x07,0x99,0x81,0xf2,0x08,0xb1,0x43,0x20,0x40,0x00,0x01,
-0x67,0x83,0x00,0x00,0x5b,0xbb,0x5a,0x19,0xc4,0x8c,0x20,0x00,0x02,0x8d,0xe5,0x00,
-0x00,0xa9,0x40,0x17,0xb3,0x67,0x19,0x75,0x03,0x01,0xb0,0x00,0x0b,0x00,0x1b,0x06,
-0x00,0xf1,0x00,0x0d,0x44,0x4b,0x01,0xb0,0x00,0x0e,0x77,0x8b,0x00,0xfc,0xb0,0x0c,
-0x00,0x1a,0xbb,0x01,0x02,0x06,0x00,0x72,0x2a,0x00,0xc0,0x00,0x09,0xbb,0xb6,0x14,
-0x01,0x09,0x06,0x00,0x14,0x90,0x8d,0x10,0x11,0x08,0xc2,0x0d,0x00,0x7b,0x06,0x40,
-0xd7,0x7e,0x00,0xb2,0x17,0x33,0x00,0x92,0x0e,0x00,0x7a,0x04,0x20,0x0d,0xbb,0x16,
-0x00,0x07,0x2c,0x00,0x34,0x1c,0xbb,0xbb,0xcf,0x25,0x0a,0x3e,0x20,0x00,0xb0,0x23,
-0x20,0x30,0x09,0x13,0x0e,0x05,0xc5,0x05,0x23,0xeb,0xbe,0x0b,0x00,0x12,0xdc,0x96,
-0x06,0x35,0x09,0xbb,0x90,0x7d,0x06,0x3c,0x70,0x00,0x0b,0x8b,0x06,0x23,0xb0,0x00,
-0x13,0x12,0x30,0x07,0x00,0xa1,0x57,0x07,0x50,0x0b,0x10,0x00,0xe9,0x9e,0x69,0x25,
-0x10,0x22,0x8f,0x00,0x30,0xb0,0x0c,0x00,0xab,0x0f,0x11,0x90,0x8f,0x00,0x00,0xa9,
-0x28,0x34,0xbd,0xdd,0xcd,0x84,0x00,0x34,0xcd,0xdd,0xdc,0x92,0x00,0x12,0xbc,0x91,
-0x0b,0x01,0x48,0x00,0x20,0x05,0x10,0xde,0x03,0x10,0x92,0x70,0x17,0xf0,0x02,0x9d,
-0x20,0xc0,0x00,0x0c,0x33,0xa1,0x0c,0xdc,0x00,0xb0,0x09,0x10,0xc0,0x00,0x0a,0xbb,
-0xdf,0x23,0x01,0x48,0x00,0x41,0x04,0xcc,0xc7,0xcd,0x8a,0x0f,0x40,0xa1,0x00,0x04,
-0xcb,0xbc,0x24,0x20,0x66,0x00,0x0b,0x00,0x35,0xcc,0xb2,0x09,0x45,0x2b,0x11,0x07,
-0xc7,0x00,0x30,0xb0,0x0c,0x00,0x1f,0x01,0x10,0xc0,0x1f,0x01,0x30,0x0c,0xdc,0x00,
-0xe8,0x04,0x00,0x1f,0x01,0x04,0x1b,0x18,0x02,0x57,0x12,0x50,0x06,0x91,0x16,0xb0,
-0x00,0x38,0x01,0x00,0x0d,0x04,0x10,0x01,0xcc,0x14,0x06,0x1d,0x26,0x02,0x07,0x07,
-0x40,0x30,0x90,0x0b,0x0c,0xb4,0x04,0x00,0x05,0x00,0x00,0x80,0x02,0xd0,0xb0,0x0c,
-0x0e,0x99,0xc0,0xba,0xbc,0x0c,0x00,0xc0,0xb1,0x1c,0x0c,0xe4,0x16,0x81,0x0d,0x44,
-0xc0,0xb0,0x0c,0x05,0x67,0x40,0xb6,0x0f,0x06,0x05,0x00,0x70,0x40,0x06,0x06,0x00,
-0x50,0x80,0x91,0x5c,0x06,0x93,0xb2,0x0d,0x44,0xc0,0xd0,0xa2,0x0d,0x66,0xd0,0x61,
-0x06,0xaf,0x0d,0x66,0xc0,0xc0,0xa2,0x03,0x44,0x20,0x90,0xa1,0xb6,0x0f,0x06,0xf5,
-0x08,0x01,0x00,0x02,0x00,0x90,0xc0,0x00,0xb0,0x0c,0x0c,0x00,0x0b,0x00,0xc0,0xc2,
-0x22,0xb0,0x0c,0x0e,0xaa,0xab,0x8c,0xe0,0x12,0x00,0x7a,0xd3,0x34,0xb0,0x0c,0x06,
-0x77,0x74,0x74,0x0f,0x70,0x06,0x06,0x00,0x40,0x00,0xa0,0x0c,0x65,0x1d,0x90,0x0c,
-0x12,0xc0,0x00,0xc0,0x0e,0x99,0xe1,0x77,0xc9,0x01,0x11,0x44,0xe4,0x01,0x4f,0xc0,
-0x0b,0xbb,0xa0,0x61,0x06,0x09,0x41,0x00,0x50,0x00,0xb0,0x3c,0x00,0xa1,0x0e,0x88,
-0xe0,0x11,0xd0,0x0d,0x33,0xd2,0xab,0xe0,0x37,0x00,0x3f,0x0a,0xbb,0x90,0xa0,0x03,
-0x04,0x00,0xe9,0x05,0x00,0x0a,0x00,0xf1,0x04,0xc0,0x09,0x00,0x50,0x00,0x90,0xc0,
-0x0b,0x00,0x0d,0x0d,0x56,0xd0,0x00,0xd0,0xd6,0x6d,0x1b,0xce,0xdf,0x03,0x32,0xdb,
-0xbc,0x00,0xb6,0x0f,0x10,0x04,0xec,0x0f,0x80,0x85,0x11,0x11,0xd0,0x08,0x40,0x00,
-0x0d,0x37,0x00,0x90,0xd0,0x04,0xbb,0xbb,0xb7,0x70,0x04,0x00,0x08,0x35,0x00,0x80,
-0xd5,0x6d,0x00,0x0d,0xd6,0x6d,0x0b,0xbd,0xcf,0x03,0x00,0xe3,0x09,0x00,0xa4,0x0a,
-0xc0,0x05,0x30,0x00,0x09,0x06,0x50,0x00,0x0c,0x06,0xdd,0xcc,0xcc,0x08,0x00,0x90,
-0x04,0xbb,0xbb,0xb9,0x01,0x00,0x20,0x80,0xa1,0x41,0x01,0x11,0xb1,0x05,0x00,0xa6,
-0x0d,0x22,0xc0,0xc0,0xb1,0x0e,0xaa,0xec,0xf0,0xb1,0x14,0x00,0x00,0xc7,0x06,0x3e,
-0xb1,0x06,0x77,0x44,0x19,0x50,0x05,0x00,0x30,0x80,0x91,0xfe,0x06,0x40,0xb2,0x0d,
-0x44,0xb0,0x82,0x01,0xd0,0xec,0xf0,0xa2,0x0c,0x00,0xb0,0xc1,0xb2,0x0c,0xbb,0x80,
-0xb0,0xb1,0xdd,0x00,0x14,0x30,0x04,0x18,0x22,0x00,0xd0,0x05,0x18,0x14,0x0e,0x3a,
-0x1e,0x33,0x05,0x00,0x30,0x1a,0x01,0x72,0x0c,0x00,0xb0,0xbc,0xe0,0x0e,0xbb,0x0d,
+0x00,0x16,0x20,0x78,0x00,0x02,0xeb,0x07,0x70,0x6c,0xcc,0xcc,0xcc,0xc6,0x00,0x2a,
+0x04,0x05,0x06,0x05,0x00,0x30,0x16,0x00,0x70,0x3c,0x00,0x04,0x22,0x01,0x14,0xbc,
+0x78,0x00,0x00,0xf5,0x00,0x03,0x78,0x00,0xf1,0x04,0xce,0xcc,0xec,0xc7,0x00,0x0c,
+0x00,0xc0,0x00,0x01,0xec,0xcc,0xce,0x10,0x01,0xc0,0x00,0x0a,0x20,0x05,0x00,0x02,
+0x8b,0x01,0x01,0x3c,0x01,0x35,0xac,0xcc,0xbc,0xb9,0x00,0x18,0xcc,0x48,0x03,0x14,
+0xab,0x7d,0x00,0x07,0xcc,0x08,0x3d,0xbc,0xcc,0xb9,0x6e,0x00,0xe1,0xea,0xaa,0xab,
+0x20,0x00,0x01,0x11,0x10,0x00,0x7a,0xaa,0xaa,0xaa,0xa6,0xd6,0x08,0x2a,0x00,0x50,
+0x93,0x03,0x10,0xac,0x08,0x02,0x38,0x8c,0xcc,0xbd,0x08,0x02,0xf0,0x04,0xc0,0x00,
+0x02,0x10,0x00,0x7b,0xbc,0xbb,0x30,0x25,0x44,0x44,0x44,0x54,0x25,0x55,0x55,0x55,
+0x53,0x19,0x00,0x10,0x20,0x71,0x02,0x10,0x40,0x5f,0x00,0x15,0x30,0xcc,0x08,0x53,
+0x70,0x00,0xbc,0xcc,0xba,0x78,0x00,0x01,0x31,0x01,0x12,0xc0,0xed,0x0b,0x27,0xbc,
+0x10,0x9b,0x00,0x01,0xcf,0x00,0x91,0xdc,0xcc,0xdd,0x10,0x03,0xa0,0x00,0x0a,0x20,
+0x05,0x00,0x40,0x01,0xbb,0xbb,0xba,0x28,0x05,0x40,0x09,0x12,0xaa,0x9e,0x31,0x01,
+0xf0,0x01,0xd0,0x0b,0x10,0x00,0x0d,0x00,0xa1,0x09,0xaa,0xf0,0x0a,0x10,0xd2,0x21,
+0x00,0xa1,0xb4,0x07,0xa0,0x10,0xd0,0x00,0x20,0xa1,0x0a,0xcb,0xb9,0x2a,0x20,0x7d,
+0x04,0x10,0x00,0x12,0x00,0x12,0x00,0x31,0x07,0x01,0x64,0x06,0xf0,0x01,0x0c,0x00,
+0x10,0xb1,0x00,0xd0,0x00,0x0b,0x10,0x0d,0x0e,0xcc,0xb1,0x00,0xd0,0xd0,0xc3,0x0b,
+0x91,0xab,0xcd,0x00,0xc0,0x01,0x02,0x00,0x0a,0x00,0xdb,0x06,0x34,0xcb,0xbb,0xcb,
+0xf5,0x02,0x20,0x1c,0x00,0x7b,0x0b,0x00,0x16,0x00,0x90,0x06,0x66,0x60,0x00,0xb0,
+0x55,0x5c,0x10,0x0d,0x77,0x06,0x92,0xc0,0x9a,0xae,0x10,0x0c,0x0d,0x11,0x10,0x00,
+0xbc,0x0d,0x10,0xcb,0x02,0x07,0x00,0x08,0x01,0xa0,0x53,0x00,0x00,0x70,0x07,0x40,
+0x00,0x00,0x00,0x74,0x4e,0x08,0x31,0xcc,0xcc,0xca,0x0b,0x09,0x4d,0xbb,0xbb,0x00,
+0x0d,0x75,0x00,0x14,0x0d,0x75,0x00,0xf4,0x09,0x06,0x00,0x5a,0xaa,0xbb,0x70,0x09,
+0x41,0x11,0x1c,0x00,0x93,0x00,0x00,0xc0,0x09,0x30,0x00,0x0c,0x00,0x4b,0xbb,0xbb,
+0x60,0xb0,0x00,0xf0,0x00,0x39,0x00,0x10,0xb1,0x03,0x90,0x00,0x0b,0x10,0x39,0x0e,
+0xcc,0xb0,0x03,0x90,0x49,0x09,0x40,0x0d,0xbb,0xdc,0x03,0x32,0x09,0xf1,0x00,0x13,
+0x00,0x53,0x00,0x02,0x60,0x07,0x40,0x00,0x48,0x00,0x7d,0xcc,0xcd,0x80,0x09,0x00,
+0x42,0x5b,0xbb,0xbb,0x50,0x76,0x00,0x17,0xb9,0x76,0x00,0x33,0x0d,0xcc,0xc0,0x76,
+0x00,0x80,0x99,0xab,0x00,0xd0,0x12,0x21,0x00,0x0c,0x7b,0x01,0xf4,0x04,0x60,0x00,
+0x05,0xe1,0x00,0x00,0x02,0xd7,0xc2,0x00,0x03,0xd4,0x03,0xc3,0x00,0x81,0x00,0x01,
+0x70,0xb1,0x00,0x17,0x0c,0x3b,0x00,0x13,0xc1,0x3b,0x00,0xf0,0x05,0x55,0x68,0x00,
+0xc0,0x46,0x54,0x20,0x0c,0x00,0x01,0x8b,0xa6,0x00,0x01,0xc3,0x01,0x7a,0x00,0x48,
+0x00,0xa6,0x09,0x63,0x00,0x3c,0x00,0x06,0xcb,0xba,0x5b,0x0c,0x00,0x44,0x00,0xf0,
+0x00,0xeb,0xbe,0x00,0x2a,0x00,0x0c,0x00,0xb0,0x02,0xa0,0x00,0xc0,0x0b,0x00,0x2b,
+0xce,0x07,0x70,0x02,0xfc,0xa0,0xc0,0x0b,0x10,0x1b,0x0b,0x00,0x00,0xe2,0x08,0x00,
+0x0b,0x00,0x55,0x0b,0xbb,0xa0,0x01,0xb0,0x79,0x0c,0x22,0x01,0xb0,0xc3,0x09,0x80,
+0x08,0x99,0x90,0x0b,0x00,0x00,0xd2,0x2d,0xcd,0x08,0x00,0x96,0x08,0x00,0x9b,0x07,
+0x30,0xbd,0xc1,0x0c,0x33,0x00,0x33,0x00,0xdb,0xbd,0xc2,0x08,0x04,0xc3,0x02,0x3c,
+0xbc,0xbb,0xbe,0x56,0x09,0x12,0xc0,0x4e,0x08,0xb1,0x00,0x04,0x56,0x50,0x0b,0x00,
+0x00,0xd6,0x5d,0x00,0xd0,0x48,0x00,0x01,0xe3,0x07,0x11,0xc0,0x0b,0x00,0xa5,0xcc,
+0x10,0xc1,0x1c,0x10,0xc0,0x00,0x08,0xa9,0x91,0xd0,0x08,0x39,0xa0,0x00,0x08,0xde,
+0x08,0x46,0x09,0xcc,0xcc,0xb1,0x8a,0x00,0x16,0xc0,0x42,0x00,0x22,0xcd,0xc1,0x0b,
+0x00,0x21,0xdb,0xbd,0x27,0x06,0x70,0x03,0x76,0x00,0x00,0x04,0x00,0x15,0xba,0x0d,
+0xf0,0x05,0x3a,0xdc,0xa0,0x00,0x1a,0x00,0x99,0xc3,0x00,0x01,0xc5,0x3c,0x06,0x60,
+0x00,0x06,0x63,0x6b,0xb2,0x00,0xf0,0x01,0x08,0x99,0x80,0x0a,0x00,0x00,0xc2,0x2d,
+0x00,0xd0,0x00,0x0c,0x00,0xc0,0x0c,0x00,0x04,0x00,0xf0,0x08,0xcc,0xb0,0x0c,0x00,
+0xc1,0x0c,0x00,0x00,0xab,0xbb,0x10,0xc0,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x0a,
+0xcc,0xcc,0xe0,0x0b,0x00,0x90,0x0c,0x00,0x00,0x0b,0xcc,0xdc,0xc0,0x00,0x00,0x19,
+0x00,0x00,0x16,0x00,0xc6,0xc3,0x00,0x08,0x99,0x80,0x0b,0x00,0x00,0xd2,0x2d,0x00,
+0xc0,0x42,0x00,0x22,0xcd,0xc1,0x0b,0x00,0x22,0xdb,0xbd,0x29,0x00,0xc0,0x05,0x00,
+0x00,0x07,0xaa,0xaa,0x80,0x00,0x00,0x01,0x13,0xd5,0x0f,0x00,0xe1,0xe4,0x00,0x00,
+0x00,0x3b,0x96,0xd6,0x00,0x00,0x18,0x20,0x00,0x65,0x00,0x01,0x00,0xd6,0x02,0x33,
+0x10,0x90,0xa0,0x0e,0x88,0xb0,0xc0,0xb0,0x0c,0x00,0xc0,0x05,0x00,0x60,0xda,0xe0,
+0x0c,0x00,0xc0,0xc1,0x0a,0x00,0xf5,0x01,0xb0,0xb0,0x0d,0x66,0xc0,0xb0,0xb0,0x04,
+0x55,0x30,0xb0,0xb0,0x00,0x00,0x00,0xc0,0x05,0x00,0xf0,0x07,0x40,0x60,0x08,0x99,
+0x60,0x70,0x64,0x0d,0x22,0xc0,0xd0,0x75,0x0c,0x00,0xc0,0xd0,0x76,0x0c,0x00,0xc0,
+0xcc,0xd5,0x41,0x00,0x60,0x75,0x0e,0xbb,0xb0,0xc0,0x75,0x23,0x00,0x60,0x32,0x00,
+0x09,0x00,0x00,0x52,0xbf,0x00,0x60,0x83,0x00,0x0c,0xcc,0xcc,0xe3,0x0a,0x00,0x61,
+0x93,0x00,0x0a,0xbb,0xbb,0xc1,0x7d,0x00,0x50,0x08,0x99,0x70,0xb0,0xb2,0x41,0x00,
+0x10,0xb2,0x41,0x00,0x10,0xa2,0x41,0x00,0x10,0xe2,0x41,0x00,0xf0,0x25,0xa2,0x0e,
+0xbb,0xc0,0xc0,0xa2,0x00,0x00,0x00,0x60,0xa1,0x00,0x00,0x04,0x60,0x10,0x00,0x00,
+0x0a,0x70,0x00,0x00,0x00,0x5c,0xc6,0x00,0x00,0x06,0xc1,0x0a,0x80,0x00,0x38,0x00,
+0x00,0x63,0x02,0x33,0x20,0x00,0xa0,0xe8,0x8d,0x00,0x0c,0x0c,0x00,0xb0,0x00,0xc0,
+0xc0,0x0b,0x09,0x00,0x60,0xb1,0xcc,0xc0,0xc0,0x0b,0x10,0x09,0x00,0xb2,0x00,0xc0,
+0xc2,0x3c,0x10,0x0c,0x07,0x88,0x70,0x00,0xc0,0x3f,0x01,0x02,0x3b,0x01,0xe0,0x06,
+0x05,0x66,0x50,0x00,0xa0,0x0e,0x76,0xe0,0x00,0xd0,0x0c,0x00,0xc0,0x2c,0x01,0x20,
+0xc1,0xbb,0x0a,0x00,0xc2,0x01,0xc0,0x0c,0x11,0xc1,0x00,0xc0,0x08,0xaa,0x91,0x00,
+0xc0,0x2c,0x00,0x60,0x46,0x00,0x00,0x70,0x00,0x57,0x0c,0x00,0x01,0x05,0x00,0xc0,
+0x2c,0xcc,0xcc,0xb0,0x08,0x99,0x80,0x00,0xb0,0x0d,0x22,0xd0,0x37,0x00,0xf2,0x01,
+0xc0,0x11,0xd0,0x0c,0x00,0xc2,0xab,0xd0,0x0c,0x00,0xc1,0x00,0xc0,0x0a,0xbb,0xb2,
+0x37,0x00,0x60,0x40,0x00,0x6c,0xcc,0xcc,0xb0,0x0a,0x00,0xb0,0xd0,0x00,0x6d,0xcc,
+0xcc,0x90,0x00,0x83,0x00,0x00,0x00,0x14,0x00,0x81,0xc0,0x01,0x22,0x10,0x80,0xa0,
+0x0e,0x99,0x67,0x01,0x20,0xb0,0xc0,0x41,0x00,0x00,0x05,0x00,0x36,0xfc,0xf0,0xc0,
+0x76,0x01,0x96,0x0d,0x33,0xc0,0xc0,0xb0,0x07,0x88,0x50,0xc0,0x67,0x01,0x11,0xb1,
+0x67,0x01,0x72,0x01,0x22,0x20,0x00,0x80,0x0e,0xaa,0xb4,0x00,0x10,0x9c,0x99,0x01,
+0x06,0xbe,0x00,0x54,0xbc,0xd0,0x0a,0xbb,0xb1,0xb4,0x00,0x60,0x73,0x00,0x00,0x90,
+0x00,0x84,0x0c,0x00,0x01,0x05,0x00,0x13,0x5c,0x8c,0x00,0xf0,0x00,0x10,0x89,0x99,
+0x00,0x0c,0x0d,0x22,0xc0,0x9a,0xc0,0xd0,0x0c,0x01,0x2c,0x0d,0x3a,0x00,0x71,0xc0,
+0x0c,0x0c,0xcc,0x0d,0xbb,0xd0,0x39,0x00,0xf4,0x0a,0x0a,0x00,0x02,0x8b,0xa5,0x00,
+0x01,0xc3,0x01,0x97,0x00,0x57,0x00,0x01,0xc0,0x02,0xb0,0x00,0x5a,0x00,0x06,0xcb,
+0xba,0x10,0x00,0x01,0x00,0x97,0x01,0xec,0xcc,0xcd,0x00,0x02,0xb0,0x00,0x0c,0x05,
+0x00,0x80,0x01,0xeb,0xbb,0xbc,0x00,0x00,0x00,0x11,0x20,0x00,0x13,0x76,0x05,0x00,
+0xf2,0x00,0x8c,0xcc,0xcc,0xcc,0xc8,0x00,0xac,0xcc,0xcc,0x10,0x00,0xd0,0x00,0x0a,
+0x20,0x05,0x00,0x70,0xdb,0xaa,0xbe,0x10,0x00,0x00,0x58,0x23,0x00,0x41,0x48,0x00,
+0x00,0x7c,0x23,0x00,0x01,0x55,0x00,0x90,0xcc,0xcc,0xce,0x30,0x00,0x00,0x00,0x09,
+0x40,0x05,0x00,0x01,0x0a,0x00,0x61,0x20,0x00,0xac,0xcc,0xcb,0x00,0x12,0x03,0x02,
+0x05,0x00,0x82,0xcb,0xbb,0xbd,0x00,0x00,0x00,0x1b,0x00,0x05,0x00,0x00,0x5f,0x00,
+0x41,0xca,0x00,0x00,0x03,0x8f,0x01,0x00,0x05,0x00,0xd2,0xbe,0x50,0x00,0x00,0x0a,
+0x81,0xb7,0x00,0x01,0xc5,0x00,0x08,0x80,0xab,0x00,0x80,0x9a,0xaa,0xa9,0x00,0x00,
+0xd1,0x11,0x1d,0x41,0x00,0x13,0x0d,0x05,0x00,0x11,0xeb,0x46,0x00,0x04,0x01,0x00,
+0x53,0x4c,0xcc,0xce,0xcc,0xb8,0x12,0x02,0x05,0x05,0x00,0x00,0xa6,0x02,0x0c,0x7d,
+0x00,0x73,0xda,0x9a,0xad,0x00,0x00,0x01,0x11,0x07,0x01,0x52,0x8c,0xcc,0xce,0xcc,
+0xc8,0x2d,0x00,0x20,0xc0,0x0c,0xe0,0x01,0x11,0x06,0xe5,0x01,0x01,0x37,0x00,0x71,
+0xcc,0x50,0x00,0x9c,0xcc,0xcc,0x00,0x89,0x03,0x02,0x05,0x00,0x32,0x8b,0xbb,0xba,
+0x37,0x00,0x60,0x5b,0xbe,0xbb,0xeb,0xb6,0x00,0x25,0x02,0x40,0x00,0xbc,0xcc,0xbe,
+0x4c,0x00,0x40,0x0b,0x10,0x00,0xec,0x69,0x00,0x01,0xd7,0x03,0xee,0xcc,0xcc,0xcc,
+0x40,0x23,0x33,0x00,0x64,0xd8,0x8d,0x10,0x75,0xc0,0x0b,0x04,0x00,0x70,0xc2,0x3c,
+0x10,0x75,0x78,0x87,0x00,0x4b,0x03,0x00,0xaf,0x03,0x00,0x08,0x00,0xb0,0x32,0x08,
+0x99,0x90,0x00,0xb0,0xd2,0x2c,0x00,0x0d,0x0d,0x08,0x02,0x41,0xd0,0x0c,0x00,0x0d,
+0x11,0x02,0x40,0xdb,0xbd,0x00,0x0d,0x53,0x00,0x11,0xb0,0x78,0x00,0x30,0x7c,0xbb,
+0xbb,0xdb,0x01,0x12,0x0d,0x8b,0x02,0x03,0xe5,0x00,0x15,0x00,0xc1,0x02,0x19,0xd0,
+0x44,0x02,0x07,0xc1,0x02,0x11,0x20,0xad,0x02,0x0c,0xc1,0x02,0x13,0x5c,0x14,0x00,
+0x13,0x00,0x49,0x02,0x02,0x77,0x00,0x01,0x80,0x00,0x10,0xc0,0x09,0x00,0x24,0xbb,
+0xd0,0x65,0x00,0xf4,0x06,0x0c,0x00,0x80,0x00,0x05,0xd0,0x00,0x00,0x02,0xd9,0xb0,
+0x00,0x03,0xd4,0x05,0xc1,0x00,0x92,0x00,0x02,0x70,0x3b,0x00,0xf0,0x01,0x1b,0x0d,
+0x22,0xc0,0x01,0xb0,0xd0,0x0c,0x00,0x1b,0x0d,0x00,0xc0,0x01,0xb0,0xc0,0x09,0x00,
+0x30,0xbb,0xd0,0x01,0xb2,0x00,0x14,0x19,0x84,0x02,0xe5,0xa6,0x00,0x47,0x00,0x02,
+0xa0,0x02,0xb0,0x00,0x69,0x00,0x06,0xcb,0xb9,0xb6,0x01,0x83,0x10,0x0a,0xbb,0xb0,
+0x00,0xc0,0x0d,0x10,0xb6,0x00,0x03,0x05,0x00,0xf0,0x09,0x22,0xc1,0x00,0xd0,0x07,
+0x99,0x81,0x00,0xc0,0x00,0x01,0x43,0x20,0x40,0x00,0x01,0x67,0x83,0x00,0x00,0x5b,
+0xbb,0xbc,0x90,0xb0,0x01,0xb2,0x20,0x00,0x02,0x8d,0xe5,0x00,0x00,0xa9,0x40,0x17,
+0xb3,0x43,0x00,0x95,0x03,0x00,0x03,0x01,0xb0,0x00,0x0b,0x00,0x1b,0x06,0x00,0xf1,
+0x00,0x0d,0x44,0x4b,0x01,0xb0,0x00,0x0e,0x77,0x8b,0x00,0xfc,0xb0,0x0c,0x00,0x1a,
+0xbb,0x01,0x02,0x06,0x00,0x72,0x2a,0x00,0xc0,0x00,0x09,0xbb,0xb6,0x14,0x01,0x09,
+0x06,0x00,0x13,0x90,0x91,0x00,0x40,0x90,0x08,0x00,0xb1,0x78,0x05,0xf0,0x00,0x0b,
+0x10,0x00,0xd7,0x7e,0x00,0xb2,0x00,0x0d,0x44,0xd0,0x0b,0xdc,0x10,0xc0,0x7a,0x04,
+0x20,0x0d,0xbb,0x16,0x00,0x07,0x2c,0x00,0x54,0x1c,0xbb,0xbb,0xe0,0x00,0x8e,0x01,
+0x02,0x35,0x02,0x12,0x0c,0xd6,0x00,0x95,0x00,0x05,0x00,0x30,0x09,0x00,0x00,0xc0,
+0x0b,0xc5,0x05,0x23,0xeb,0xbe,0x0b,0x00,0x10,0xdc,0x66,0x04,0x00,0x86,0x00,0x24,
+0x90,0x0c,0x7f,0x00,0x34,0x70,0x00,0x0b,0x3a,0x00,0x11,0xc0,0xb5,0x02,0x02,0xe0,
+0x03,0x00,0x01,0x00,0xf0,0x03,0x80,0x07,0x00,0xa1,0x00,0x0c,0x00,0xb0,0x0b,0x10,
+0x00,0xe9,0x9e,0x00,0xb2,0x00,0x0c,0x22,0x8f,0x00,0x10,0xb0,0x8f,0x00,0x52,0x0a,
+0xbb,0x90,0x0b,0x10,0xdc,0x01,0x44,0x00,0xbd,0xdd,0xcd,0x84,0x00,0x34,0xcd,0xdd,
+0xdc,0x92,0x00,0x44,0xbc,0xcc,0xcc,0x20,0x48,0x00,0x20,0x05,0x10,0xde,0x03,0xf2,
+0x0a,0x92,0x0c,0x00,0x00,0xe9,0x9d,0x20,0xc0,0x00,0x0c,0x33,0xa1,0x0c,0xdc,0x00,
+0xb0,0x09,0x10,0xc0,0x00,0x0a,0xbb,0xa0,0x0c,0x00,0x48,0x00,0x50,0x04,0xcc,0xc7,
+0xcd,0x10,0x8b,0x00,0xa0,0xa1,0x00,0x04,0xcb,0xb0,0x0a,0x10,0x00,0x66,0x00,0x0b,
+0x00,0x34,0xcc,0xb2,0x09,0xb0,0x01,0x21,0xa0,0x07,0xc7,0x00,0x30,0xb0,0x0c,0x00,
+0x1f,0x01,0x10,0xc0,0x1f,0x01,0x30,0x0c,0xdc,0x00,0xe8,0x04,0x00,0x1f,0x01,0x14,
+0x0c,0x4b,0x01,0xa0,0x04,0x99,0x60,0x00,0x00,0x06,0x91,0x16,0xb0,0x00,0x38,0x01,
+0x00,0x0d,0x04,0x76,0x01,0xd0,0x00,0x00,0x1b,0xbb,0xb3,0xb1,0x03,0x00,0x07,0x07,
+0x40,0x30,0x90,0x0b,0x0c,0xb4,0x04,0x00,0x05,0x00,0x00,0x80,0x02,0xc0,0xb0,0x0c,
+0x0e,0x99,0xc0,0xba,0xbc,0x0c,0x00,0xc0,0xb1,0x1c,0xa2,0x06,0xa0,0x0c,0x0d,0x44,
+0xc0,0xb0,0x0c,0x05,0x67,0x40,0xb0,0x5a,0x00,0x06,0x05,0x00,0x70,0x40,0x06,0x06,
+0x00,0x50,0x80,0x91,0x5c,0x06,0x93,0xb2,0x0d,0x44,0xc0,0xd0,0xa2,0x0d,0x66,0xd0,
+0x61,0x06,0xf5,0x05,0x0d,0x66,0xc0,0xc0,0xa2,0x03,0x44,0x20,0x90,0xa1,0x00,0x03,
+0x33,0x44,0x30,0x00,0x18,0x88,0x88,0xe0,0x9e,0x01,0x11,0xd0,0xc3,0x00,0xf5,0x08,
+0x01,0x00,0x02,0x00,0x90,0xc0,0x00,0xb0,0x0c,0x0c,0x00,0x0b,0x00,0xc0,0xc2,0x22,
+0xb0,0x0c,0x0e,0xaa,0xab,0x8c,0xe0,0x12,0x00,0x71,0xd3,0x34,0xb0,0x0c,0x06,0x77,
+0x74,0x8c,0x01,0x15,0x0b,0x61,0x06,0x50,0x06,0x00,0x40,0x00,0xa0,0x93,0x06,0xa0,
+0xd0,0x0c,0x12,0xc0,0x00,0xc0,0x0e,0x99,0xe1,0x77,0xc9,0x01,0x11,0x44,0xe4,0x01,
+0x4f,0xc0,0x0b,0xbb,0xa0,0x61,0x06,0x09,0x41,0x00,0x50,0x00,0xb0,0x3c,0x00,0xa1,
+0x0e,0x88,0xe0,0x11,0xd0,0x0d,0x33,0xd2,0xab,0xe0,0x37,0x00,0x3f,0x0a,0xbb,0x90,
+0xa0,0x03,0x04,0x00,0xe9,0x05,0x00,0x0a,0x00,0xf1,0x04,0xc0,0x09,0x00,0x50,0x00,
+0x90,0xc0,0x0b,0x00,0x0d,0x0d,0x56,0xd0,0x00,0xd0,0xd6,0x6d,0x1b,0xce,0xdf,0x03,
+0x22,0xdb,0xbc,0x32,0x02,0xe0,0x50,0x04,0xaa,0xab,0xb8,0x00,0x85,0x11,0x11,0xd0,
+0x08,0x40,0x00,0x0d,0x37,0x00,0x90,0xd0,0x04,0xbb,0xbb,0xb7,0x70,0x04,0x00,0x08,
+0x35,0x00,0x80,0xd5,0x6d,0x00,0x0d,0xd6,0x6d,0x0b,0xbd,0xcf,0x03,0x21,0xbb,0xbb,
+0x33,0x00,0xd0,0x04,0x05,0x30,0x00,0x09,0x06,0x50,0x00,0x0c,0x06,0xdd,0xcc,0xcc,
+0x08,0x00,0x90,0x04,0xbb,0xbb,0xb9,0x01,0x00,0x20,0x80,0xa1,0x41,0x01,0x11,0xb1,
+0x05,0x00,0xa6,0x0d,0x22,0xc0,0xc0,0xb1,0x0e,0xaa,0xec,0xf0,0xb1,0x14,0x00,0x00,
+0xc7,0x06,0x64,0xb1,0x06,0x77,0x40,0xc0,0xb1,0xc2,0x06,0x03,0xc7,0x06,0x50,0x05,
+0x00,0x30,0x80,0x91,0xfe,0x06,0x40,0xb2,0x0d,0x44,0xb0,0x82,0x01,0xd0,0xec,0xf0,
+0xa2,0x0c,0x00,0xb0,0xc1,0xb2,0x0c,0xbb,0x80,0xb0,0xb1,0xdd,0x00,0x32,0x30,0x00,
+0x0b,0xf0,0x08,0x00,0x82,0x05,0x00,0xdd,0x02,0x40,0x0e,0x00,0x00,0x00,0x14,0x00,
+0x43,0xc3,0x05,0x00,0x30,0x1a,0x01,0x72,0x0c,0x00,0xb0,0xbc,0xe0,0x0e,0xbb,0x0d,
 0x07,0x10,0x11,0x56,0x01,0x57,0x9a,0xd0,0x09,0xbb,0x90,0x56,0x01,0x1a,0x90,0x56,
 0x01,0x41,0xb1,0x08,0x00,0x70,0x3c,0x00,0x61,0x77,0xd0,0x0e,0xbb,0xe0,0x44,0xee,
-0x07,0x65,0xd0,0x0b,0x00,0xc0,0xbb,0xe0,0x56,0x01,0x1f,0x40,0x56,0x01,0x06,0x02,
-0xbb,0x1f,0x06,0x15,0x06,0x33,0xeb,0xbc,0xcc,0x0a,0x00,0x30,0xd1,0x11,0x2c,0x0d,
-0x0f,0x21,0xa6,0x00,0x97,0x36,0x07,0xfa,0x13,0x12,0x10,0xed,0x17,0x00,0x42,0x06,
-0xa0,0xaa,0xae,0x00,0x00,0xc1,0x11,0x1c,0x00,0x00,0xca,0x2a,0x22,0x32,0x01,0x77,
-0x11,0xa2,0x0f,0x0f,0x05,0x07,0x0c,0x33,0x70,0x00,0x07,0x64,0x00,0x34,0xdb,0xbb,
-0xbe,0x51,0x06,0x10,0xed,0x0c,0x05,0x14,0x85,0x5d,0x0e,0x03,0xe9,0x21,0x0c,0x77,
-0x0d,0x12,0x60,0xe0,0x0a,0x11,0x0a,0x06,0x06,0x31,0xbb,0xbb,0xbe,0x98,0x02,0x10,
-0xc0,0xaf,0x0e,0x13,0xbd,0xa0,0x02,0x65,0x3b,0xba,0xbe,0xab,0xbb,0x00,0xfb,0x0f,
-0x13,0x30,0x1f,0x1e,0x01,0x93,0x0f,0x23,0x0e,0x00,0x93,0x06,0x24,0x60,0x00,0xf7,
-0x00,0x10,0x0b,0xc5,0x00,0x10,0xad,0xed,0x00,0x10,0x1c,0xca,0x00,0x64,0x0c,0x00,
-0x00,0x7a,0xdc,0xb8,0x67,0x10,0x01,0x89,0x00,0x10,0x14,0x34,0x00,0x10,0x78,0xa6,
-0x03,0xa0,0xdd,0x30,0x00,0x00,0x3d,0x31,0xc6,0x00,0x04,0xa1,0xb8,0x22,0x17,0x80,
-0xc5,0x00,0x13,0xbd,0x0a,0x00,0x01,0xca,0x00,0x12,0x8c,0x55,0x0e,0x00,0x16,0x09,
-0x33,0xcd,0xcc,0xc9,0xac,0x23,0x06,0x05,0x00,0x11,0x16,0xe0,0x16,0x1d,0x08,0x01,
-0x01,0x03,0xae,0x0f,0x05,0x00,0x0e,0x10,0x0c,0x28,0x00,0x10,0x0c,0xb3,0x16,0x14,
-0x09,0xb8,0x16,0x10,0xac,0x3c,0x0e,0x00,0xb9,0x00,0x00,0xfd,0x13,0x03,0x01,0x0c,
-0x12,0xb1,0x73,0x00,0x14,0xbd,0x6a,0x1e,0x33,0xbd,0xbb,0xb8,0xa6,0x18,0x14,0xce,
-0xf8,0x10,0x01,0xfc,0x00,0x15,0xe0,0xfb,0x00,0x01,0x41,0x00,0x00,0x04,0x05,0x02,
-0x41,0x01,0x12,0xb0,0x7d,0x00,0x12,0xbc,0x41,0x00,0x12,0x4b,0x41,0x00,0x10,0x1b,
-0x31,0x0f,0x20,0xcf,0xcc,0xe2,0x08,0x0e,0x66,0x21,0x03,0xfa,0x00,0x10,0x0b,0xbe,
-0x00,0x01,0x51,0x08,0x13,0x1b,0x05,0x00,0x34,0x8c,0xcc,0xb6,0xc3,0x00,0x50,0xbb,
-0xdb,0xc5,0x00,0x39,0x3e,0x00,0x06,0x05,0x00,0x10,0x25,0x9e,0x10,0x0b,0x6e,0x02,
-0x21,0xfb,0xbc,0x56,0x08,0x10,0x1c,0x81,0x01,0x10,0x2b,0xf6,0x26,0x1b,0xa5,0x70,
-0x18,0x12,0xc9,0xf1,0x01,0x33,0x90,0x00,0x0c,0xac,0x11,0x12,0x90,0xf0,0x00,0x13,
-0xbc,0x63,0x01,0x35,0xcb,0xbb,0xbb,0x70,0x18,0x07,0xf0,0x00,0x15,0x10,0xb0,0x1e,
-0x11,0x60,0xf0,0x15,0x01,0xd3,0x04,0x00,0x76,0x06,0x00,0xdb,0x0a,0x32,0x0f,0xcc,
-0xcc,0x09,0x00,0x01,0xe5,0x04,0x00,0x1b,0x00,0x04,0x0a,0x07,0x05,0x46,0x0b,0x13,
-0x08,0xe5,0x04,0x10,0xa2,0xe5,0x04,0x60,0xb2,0x00,0xd0,0x0e,0x99,0xd1,0xae,0x06,
-0x10,0xa1,0xc9,0x06,0x10,0xb1,0xe5,0x04,0x14,0xb0,0x8f,0x03,0x10,0x54,0xa7,0x02,
-0x15,0x75,0xa3,0x1b,0x11,0x4c,0xe5,0x04,0x31,0x61,0x00,0xb0,0x3c,0x00,0x56,0x0e,
-0xbb,0xe2,0x00,0xd0,0x37,0x00,0x02,0x22,0x13,0x01,0xe5,0x04,0x42,0x7c,0xcc,0xcd,
-0xa0,0x42,0x20,0x42,0x8d,0xcc,0xcc,0x80,0x6d,0x23,0x14,0x7c,0xee,0x06,0xf1,0x0a,
-0x30,0x32,0x03,0x0c,0x00,0xc0,0xb8,0x3b,0x0d,0x00,0xc0,0xb8,0x4b,0x0c,0x00,0xc4,
-0xb8,0x7c,0x0c,0x00,0xc7,0xc8,0xad,0x0c,0xc9,0x0f,0x00,0x02,0x05,0x00,0x7b,0xb7,
-0x4b,0x0c,0x00,0x7b,0x74,0xba,0xe6,0x09,0x13,0x08,0x3b,0x01,0xf3,0x11,0x41,0x13,
-0x22,0x83,0x00,0x2a,0x55,0xb5,0x59,0x40,0x01,0xc9,0x5c,0x85,0x84,0x00,0x1c,0xa5,
-0xd9,0x58,0xdc,0x11,0xa6,0x5b,0x55,0x84,0x00,0x0b,0xb2,0x9b,0x28,0x30,0x2e,0x07,
-0x43,0x8d,0xdd,0xce,0x10,0xec,0x23,0x40,0x9d,0xdd,0xdd,0x10,0x52,0x16,0x02,0x78,
-0x01,0xc1,0x40,0x00,0x01,0x10,0x10,0x10,0x90,0x1a,0x75,0xc2,0x90,0xc0,0x05,0x00,
-0x80,0x1b,0x85,0xc4,0x90,0xc0,0x1e,0xc5,0xcb,0x0a,0x00,0x14,0xc3,0x05,0x00,0x81,
-0x94,0xc4,0x80,0xb0,0x09,0x91,0x69,0x40,0xb6,0x00,0x06,0x05,0x00,0x12,0x60,0x89,
-0x00,0x40,0x03,0x90,0x00,0xd0,0x13,0x0b,0x10,0x0d,0x3c,0x2f,0x00,0x0b,0x00,0xe0,
-0xab,0x00,0x0d,0x11,0x00,0x0d,0xb2,0x00,0xcb,0xb2,0x06,0x74,0x90,0x0c,0x15,0x08,
-0x6d,0x20,0xc0,0x00,0x74,0x00,0x28,0x53,0x1f,0x00,0x3c,0x29,0x00,0x5f,0x02,0x20,
-0x02,0xa0,0x57,0x0a,0x10,0x67,0xd1,0x19,0xf2,0x04,0x0c,0xb0,0x00,0xbd,0xc1,0x06,
-0x97,0x80,0x0b,0x10,0x04,0xc0,0x08,0x70,0xb1,0x00,0x71,0x00,0x03,0xf4,0x07,0x10,
-0x10,0xbe,0x21,0x0f,0x09,0x0f,0x06,0x00,0x10,0x2b,0x00,0x89,0x29,0x00,0x11,0x00,
-0x11,0x68,0x64,0x0e,0x00,0x11,0x05,0xe0,0x04,0xaa,0x50,0x0c,0xcc,0x12,0xc1,0x0b,
-0x40,0xc0,0x00,0x92,0x00,0x05,0xe3,0x29,0x11,0x00,0x00,0x28,0x06,0x9b,0x1f,0x04,
-0xd1,0x23,0x10,0xb0,0x42,0x00,0x14,0x0c,0xcc,0x00,0x11,0x67,0x9e,0x1f,0xe0,0xc0,
-0x00,0xdc,0xc0,0x07,0x75,0xa0,0x0d,0x00,0x05,0xa0,0x06,0x80,0xd0,0xba,0x1c,0x0a,
-0x9b,0x1f,0x34,0x0e,0xbb,0xbb,0x9b,0x1f,0x30,0x0c,0xbb,0xbb,0x21,0x2e,0x0a,0x42,
-0x00,0x00,0xcc,0x00,0x10,0xdc,0xcc,0x00,0x20,0x0d,0x00,0xcc,0x00,0x10,0xd0,0xcc,
-0x00,0x22,0x0c,0x00,0x80,0x2d,0x42,0x00,0x79,0x11,0x6b,0x6f,0x20,0x00,0xf3,0x3d,
-0x11,0x2d,0x05,0x11,0x08,0x7f,0x22,0x00,0xf5,0x22,0x40,0x90,0xb0,0x00,0x93,0xb7,
-0x02,0x23,0xa2,0x00,0xd8,0x2c,0xfa,0x09,0x00,0xf6,0x00,0xea,0xe0,0x06,0x8c,0x00,
-0xc1,0xc0,0x0c,0x19,0x30,0xc0,0xc0,0x67,0x01,0xb0,0xc0,0xc0,0x70,0x00,0x60,0xc0,
-0x06,0x2e,0x10,0x30,0xf5,0x2a,0x90,0x80,0x91,0x00,0x3a,0x00,0xd0,0xb2,0x00,0x58,
-0x64,0x23,0xff,0x02,0xbb,0x00,0xcc,0xe2,0x03,0xb8,0x60,0xc0,0xa2,0x1c,0x20,0xb3,
-0xc0,0xa2,0x53,0x00,0x03,0x2b,0x08,0x08,0x70,0x00,0x16,0x00,0xb0,0xa1,0x00,0x3a,
-0x37,0x00,0x10,0x68,0x05,0x00,0x16,0xbc,0x3c,0x00,0x11,0xb4,0x3c,0x00,0x40,0x50,
-0x50,0x00,0x08,0x87,0x2d,0x42,0x0e,0x11,0x10,0xd0,0x92,0x2f,0x01,0x86,0x26,0x10,
-0x08,0xd1,0x1f,0x40,0x04,0x00,0x90,0x73,0x78,0x00,0x30,0x84,0x00,0x58,0x05,0x00,
-0xf0,0x0d,0xba,0x00,0xdc,0xe4,0x03,0xb9,0x50,0xd0,0x84,0x1c,0x10,0xc3,0xd0,0x84,
-0x53,0x00,0x12,0x70,0x83,0x00,0x00,0x48,0x85,0x00,0x00,0x07,0xa3,0x37,0x13,0x27,
-0x00,0x82,0x1b,0x55,0x30,0x01,0xd0,0x00,0x02,0xfc,0x00,0x31,0x06,0x00,0x0b,0x25,
-0x11,0x10,0xd0,0x68,0x0d,0xf1,0x05,0x0c,0xba,0x00,0x0c,0xd1,0x00,0xc0,0x00,0x06,
-0x94,0xb0,0x0c,0x32,0x04,0xb0,0x04,0xa0,0xc9,0x80,0x50,0x60,0x25,0x50,0x00,0x04,
-0x50,0xc0,0x00,0x9b,0x2f,0x00,0x75,0x31,0x10,0xd3,0x5a,0x16,0x21,0x11,0xc5,0x26,
-0x29,0x11,0x93,0x54,0x0d,0x00,0x71,0x11,0x10,0x0c,0xae,0x23,0xfc,0x0b,0xc0,0x04,
-0xa0,0x00,0x0c,0x00,0x8e,0x06,0xcc,0xc0,0x0c,0x86,0x00,0x0c,0x05,0x80,0xc0,0x00,
-0xc0,0xc1,0x07,0x70,0x0c,0x54,0x00,0x07,0x37,0x27,0x10,0x03,0xd6,0x01,0x13,0xd0,
-0x52,0x27,0xf3,0x01,0x05,0xe1,0x4c,0xcc,0x00,0xc6,0xa0,0x00,0xc0,0xa6,0x07,0x90,
-0x0c,0x66,0x00,0x05,0xa6,0x2d,0x48,0x8c,0xbb,0xbc,0xb0,0x2d,0x13,0x15,0x1b,0xf4,
-0x24,0x10,0xa0,0x8d,0x04,0x12,0xd0,0x47,0x26,0xf3,0x03,0x1f,0x22,0xcc,0xd0,0x00,
-0x99,0xc0,0x00,0xd0,0x04,0xb0,0x69,0x00,0xd0,0x2b,0x00,0x07,0x40,0x5d,0x01,0x10,
-0x2a,0x9e,0x13,0x15,0x3a,0x01,0x2c,0x10,0x1c,0x74,0x02,0xf1,0x0b,0x16,0x00,0x0a,
-0x00,0x03,0x80,0x00,0xb1,0x00,0x89,0x0a,0xbe,0x10,0x2c,0xb3,0x00,0xb1,0x1c,0x21,
-0xc2,0x0b,0x1a,0x30,0x01,0x60,0xb1,0x04,0x28,0x41,0x08,0xdd,0xdc,0xd0,0x68,0x0d,
-0x60,0x0a,0xdd,0xdd,0xc0,0x00,0xc2,0x54,0x07,0x32,0xdc,0xcc,0xc3,0xad,0x00,0xf0,
-0x15,0xa3,0x00,0x0d,0x00,0x0d,0x10,0x00,0xd0,0x02,0xf3,0x1c,0xcd,0x00,0xb6,0xc1,
-0x00,0xd0,0x88,0x03,0xb0,0x0d,0x38,0x00,0x03,0x20,0xc0,0x00,0x17,0xba,0x60,0x00,
-0x0c,0x51,0x18,0x80,0x02,0x64,0x01,0x84,0x1d,0x10,0x04,0xb0,0x00,0x4c,0xbb,0xa1,
-0x0b,0x37,0x40,0x80,0xa0,0x00,0xa3,0x28,0x02,0x10,0xb1,0x05,0x00,0x10,0xc0,0x05,
-0x00,0x60,0xf4,0x8b,0xf0,0xc0,0x05,0xaa,0x78,0x10,0xe9,0x1b,0x10,0xc0,0xc0,0x58,
-0x04,0x80,0xc0,0xc0,0x80,0x00,0x70,0xc0,0xc0,0x22,0x11,0x64,0x50,0x70,0x00,0x03,
-0x00,0x90,0x55,0x02,0xb6,0x01,0xd0,0xa2,0x00,0xbc,0x4a,0xe0,0xa2,0x03,0xb8,0x70,
-0x19,0x02,0xbd,0x90,0x91,0x00,0x04,0x55,0x55,0x40,0x00,0x17,0x77,0x77,0x55,0x02,
-0xb0,0x02,0x00,0x70,0x70,0x00,0x2a,0x00,0xd0,0xa1,0x00,0x49,0x05,0x00,0xf2,0x04,
-0x99,0x4b,0xf0,0xa1,0x01,0xdb,0x40,0xc0,0xa1,0x0b,0x41,0xc2,0xc0,0xa1,0x66,0x00,
-0x25,0xc0,0xa1,0x5d,0x09,0x47,0x1c,0x00,0x50,0x80,0xa1,0x16,0x10,0x0c,0x6c,0x21,
-0x13,0x05,0x78,0x00,0x40,0xa1,0x00,0x58,0x02,0x78,0x00,0x51,0x49,0xe0,0xa2,0x03,
-0xc7,0x78,0x00,0x87,0xa5,0xc0,0xa1,0x53,0x00,0x02,0x40,0x50,0x6c,0x09,0x01,0xa7,
-0x27,0x02,0x4f,0x2a,0x02,0xa6,0x27,0x11,0x60,0x78,0x00,0x30,0xb2,0x00,0x49,0x05,
-0x00,0x40,0x99,0x4c,0xf0,0xa2,0x78,0x00,0x10,0xa2,0x78,0x00,0x40,0xb2,0x66,0x00,
-0x25,0xad,0x09,0x20,0x03,0x30,0x7d,0x0f,0x00,0xb7,0x08,0xd7,0x3e,0xc1,0x00,0x00,
-0x03,0xd2,0x4c,0x20,0x00,0x4c,0x20,0x02,0xc1,0xde,0x01,0x21,0x0b,0x20,0xe6,0x02,
-0x40,0xbc,0xe0,0x00,0x2f,0xe3,0x01,0xd3,0xa9,0xb0,0x66,0xd0,0x05,0xa0,0x78,0x45,
-0xd0,0x3b,0x00,0x08,0x30,0xe6,0x00,0x10,0x1c,0xde,0x01,0x09,0xb9,0x00,0x13,0xb0,
-0xe2,0x17,0x10,0x49,0x05,0x00,0x10,0x98,0x4b,0x00,0x00,0x57,0x08,0xec,0x1d,0x22,
-0xd3,0x00,0x03,0xc3,0x00,0x2c,0x50,0x03,0x10,0x44,0x00,0x20,0x6b,0x1d,0x20,0x00,
-0x55,0x0f,0x00,0x10,0xc8,0x57,0x05,0xdf,0xab,0x60,0x00,0x01,0xa9,0x00,0x99,0x00,
-0x04,0x30,0x65,0x04,0x20,0x6c,0x09,0x11,0x20,0x00,0x56,0x1b,0x00,0x10,0xb7,0xcf,
-0x02,0xd3,0xbc,0x50,0x00,0x00,0x8a,0x00,0xb8,0x00,0x05,0x50,0x55,0x05,0x30,0x3c,
-0x00,0x1e,0xdd,0x73,0x1f,0x04,0x3a,0x07,0x03,0x1d,0x20,0x01,0xd7,0x1d,0x20,0x00,
-0xd9,0x5b,0x07,0xf2,0x08,0x89,0x90,0x00,0x02,0xc7,0x11,0x7b,0x10,0x03,0x10,0x66,
-0x02,0x20,0x46,0x66,0xaa,0x66,0x64,0x35,0x44,0x44,0x44,0x53,0x02,0x33,0x33,0x79,
-0x10,0x5c,0x3c,0x1f,0x33,0xa5,0x00,0x1d,0x00,0x33,0x00,0xf9,0x27,0x01,0xac,0x08,
-0x10,0x0d,0x76,0x03,0xf3,0x01,0xf6,0x00,0x0c,0x00,0xd2,0xc3,0x00,0xc0,0xb4,0x01,
-0xc1,0x0c,0x23,0x08,0x01,0x10,0xd9,0x1d,0x65,0x12,0x40,0xc2,0xbb,0xba,0x96,0x76,
-0x03,0x11,0x07,0xd5,0x13,0x03,0x0f,0x03,0x70,0x9e,0x10,0x00,0x00,0x05,0xc4,0xc1,
-0xd5,0x3d,0x78,0x3c,0x30,0x03,0x60,0x00,0x01,0x50,0xbf,0x21,0x0b,0x5a,0x09,0x15,
-0x18,0x0b,0x2d,0x10,0xa6,0x0b,0x14,0x00,0xfc,0x09,0x30,0x7c,0x12,0xc5,0x7d,0x06,
-0x28,0x08,0x30,0xe3,0x10,0x10,0x2a,0x6a,0x00,0x01,0x05,0x00,0x10,0x15,0xd4,0x33,
-0x0b,0xef,0x00,0x15,0x75,0xef,0x00,0x60,0x7a,0x80,0x00,0x03,0xc6,0x00,0xef,0x00,
-0x33,0x00,0x02,0x10,0x96,0x09,0x01,0x74,0x0b,0x19,0x23,0x13,0x0a,0x15,0x4c,0x13,
-0x0a,0x25,0x00,0x00,0x2d,0x12,0x10,0xa4,0x90,0x01,0x10,0xe9,0xa6,0x03,0x70,0x4a,
-0x70,0x00,0x01,0xb7,0x00,0xa8,0x93,0x34,0x2a,0x06,0x30,0xdd,0x08,0x13,0xc5,0x0c,
-0x00,0x11,0x49,0x83,0x00,0x00,0xb0,0x01,0x71,0x96,0xc1,0x00,0x02,0xc7,0x00,0x3c,
-0x4b,0x00,0x00,0x0d,0x25,0x22,0xbb,0xb5,0x21,0x0e,0x33,0xcc,0xcc,0xce,0xdd,0x06,
-0x21,0xdb,0xbc,0x73,0x09,0x04,0x8e,0x1a,0x20,0x00,0x27,0x0b,0x00,0x10,0x8a,0x18,
-0x04,0xe0,0xca,0x80,0x00,0x00,0x7c,0x10,0x8a,0x10,0x03,0x60,0x00,0x03,0x40,0x13,
-0x29,0x31,0x52,0x59,0x9a,0xaa,0x99,0x96,0xed,0x30,0x12,0xc0,0x2f,0x2d,0x10,0xce,
-0xc8,0x09,0x05,0x2f,0x2d,0x01,0x01,0x00,0x10,0x93,0xaa,0x00,0x10,0xf7,0xa2,0x02,
-0x90,0x5b,0x70,0x00,0x05,0xc4,0x00,0x8b,0x00,0x03,0xa3,0x02,0xa3,0x69,0x88,0x88,
-0x88,0x96,0x13,0x33,0x33,0x33,0x31,0x1b,0x21,0x00,0x0f,0x24,0x10,0xd1,0xcd,0x04,
-0x14,0xb4,0x1b,0x21,0x01,0xdf,0x01,0x00,0xfa,0x09,0x00,0xdd,0x35,0x20,0xb0,0x01,
-0x09,0x00,0xf5,0x06,0x5f,0x30,0x01,0xb0,0x0b,0x6a,0x00,0x1c,0x03,0xb0,0xb3,0x01,
-0xc0,0xb2,0x02,0xb0,0x1c,0x26,0x00,0x06,0x11,0x4c,0x18,0x02,0x55,0x05,0x12,0x04,
-0x55,0x05,0x13,0x1c,0x55,0x05,0xc3,0x00,0x0c,0x00,0xc6,0xb0,0x00,0xc0,0xa5,0x06,
-0x90,0x0c,0x65,0x55,0x05,0x10,0x03,0x55,0x05,0x13,0xa0,0x5b,0x29,0x1a,0x02,0x55,
-0x05,0x18,0x90,0x55,0x05,0x00,0x81,0x03,0xb8,0x89,0xc0,0x00,0xd0,0x03,0xc0,0x69,
-0x00,0xd0,0x2c,0x10,0x55,0x05,0x12,0x70,0x98,0x29,0x15,0x2b,0x55,0x05,0xf0,0x0d,
-0x07,0x00,0x09,0x10,0x02,0xa0,0x00,0xb2,0x00,0x69,0x00,0x0a,0x20,0x0c,0xc3,0x00,
-0xa2,0x09,0x61,0xc1,0x0b,0x28,0x80,0x02,0x80,0xb2,0x10,0x00,0x02,0x2d,0x03,0x55,
-0x05,0x72,0x20,0x0b,0xdd,0xdd,0xd0,0x00,0xe0,0x84,0x16,0x12,0xc4,0x46,0x08,0xf1,
-0x0b,0x80,0x00,0xa1,0x00,0x1b,0x00,0x0b,0x20,0x05,0x90,0x00,0xb2,0x00,0xbd,0x10,
-0x0a,0x10,0x69,0x3b,0x00,0xa1,0x4b,0x00,0x4a,0x0a,0x14,0x5c,0x19,0xf3,0x06,0x6a,
-0xaa,0xbb,0x10,0x0a,0x41,0x11,0xa3,0x00,0xa3,0x00,0x0a,0x30,0x0a,0x30,0x00,0xa2,
-0x00,0x6b,0xbb,0xba,0xff,0x10,0x31,0x81,0x00,0x0d,0xac,0x00,0x00,0x09,0x29,0x00,
-0xe9,0x3c,0xb1,0xd0,0x1c,0x1b,0x30,0x0d,0x1c,0x30,0x1b,0x10,0xd2,0x20,0xe1,0x30,
-0x90,0x7b,0xa6,0x00,0x00,0xc5,0x11,0x88,0x00,0x2b,0x62,0x28,0x54,0xd1,0x00,0x4b,
-0x00,0x04,0x98,0x14,0x20,0x10,0x01,0x94,0x03,0x30,0x83,0x0b,0x00,0xc5,0x28,0x10,
-0x0c,0x06,0x00,0x11,0xa3,0xcf,0x37,0xf0,0x06,0xc5,0x0f,0x20,0xd1,0x10,0x00,0xd9,
-0x1f,0x60,0xcb,0xa0,0x02,0xab,0x58,0xa0,0xc0,0x00,0x08,0x4a,0xc1,0xc0,0xdb,0x1d,
-0x2f,0x90,0x63,0xcd,0x11,0x07,0x30,0x1b,0x00,0x93,0xcc,0x37,0x10,0xb2,0xe5,0x3a,
-0xf2,0x00,0xf7,0x00,0x00,0xc8,0x56,0x9d,0x00,0x09,0x50,0xcc,0x15,0x80,0x06,0x00,
-0x33,0x1d,0x1a,0x0a,0xfa,0x29,0x13,0x01,0x50,0x09,0xa0,0x09,0xcd,0x30,0x0d,0x00,
-0x05,0x90,0x1c,0x00,0xd0,0x73,0x08,0x81,0x0d,0x00,0x0a,0x20,0x0b,0x10,0xdc,0xc1,
-0x0b,0x00,0x30,0x05,0x70,0x1c,0xf3,0x1b,0x25,0xac,0x30,0x3f,0x09,0x08,0xba,0x11,
-0x00,0xe5,0x01,0x70,0x03,0xab,0x30,0x0b,0x00,0x00,0xd1,0x0c,0x31,0xc1,0x2a,0x00,
-0xa2,0x0c,0x10,0x03,0xa0,0x09,0x30,0xbd,0xc1,0x0d,0x52,0x12,0x22,0x6c,0xc6,0xcd,
-0x18,0x14,0x0a,0x81,0x15,0x0f,0xc4,0x09,0x09,0x31,0x23,0x00,0x0a,0x5e,0x13,0x00,
-0x28,0x0c,0x81,0xb1,0x0c,0x00,0x03,0x90,0x09,0x30,0xc0,0x53,0x00,0x40,0xdc,0x00,
-0xd3,0x2c,0x79,0x1b,0x27,0xaa,0x20,0xcd,0x18,0x1c,0x09,0x5f,0x29,0x43,0xb0,0x00,
-0x03,0xbc,0x8a,0x00,0x11,0xd0,0x37,0x00,0x10,0x00,0x8a,0x00,0x31,0xcd,0xc1,0x0d,
-0x8f,0x12,0x21,0x6c,0xc6,0x62,0x1f,0x20,0x04,0x87,0xb4,0x00,0x10,0x14,0xcd,0x18,
-0xe0,0x2b,0xfd,0x90,0x00,0x1a,0x00,0x97,0xb3,0x00,0x01,0xc5,0x3b,0x06,0x50,0xcd,
-0x18,0x40,0xb1,0x00,0x00,0x67,0xe3,0x29,0x30,0xc5,0x3c,0x20,0xcc,0x00,0xfc,0x04,
-0x57,0x0c,0x10,0x02,0xa0,0x04,0x80,0xbd,0xc2,0x0d,0x20,0xa4,0x0b,0x10,0x00,0x2a,
-0xb6,0x00,0xb0,0xcd,0x18,0x10,0x10,0xeb,0x05,0x17,0xc0,0x19,0x2e,0x00,0x0e,0x01,
-0x16,0x0c,0x84,0x00,0x11,0x0d,0x84,0x00,0x30,0xdc,0xb0,0x0d,0x4b,0x01,0x00,0x84,
-0x00,0x05,0xe3,0x29,0x33,0xaa,0xab,0xa0,0xe0,0x15,0x0c,0x19,0x2e,0x0f,0x42,0x00,
-0x02,0x15,0xc0,0x42,0x00,0x13,0xc0,0x21,0x03,0x08,0x8a,0x0a,0x06,0x25,0x2a,0x10,
-0x0b,0x8a,0x0a,0x05,0x92,0x01,0x08,0x42,0x00,0x1a,0xc1,0x84,0x00,0x00,0x6d,0x0e,
-0x10,0x6a,0x8a,0x0a,0x42,0x78,0x10,0x5b,0x00,0xd4,0x0e,0x01,0x0d,0x25,0x00,0x0c,
-0x38,0x50,0x30,0x00,0x03,0xab,0x40,0x93,0x19,0x20,0x0b,0x00,0x81,0x01,0x10,0x74,
-0x4a,0x01,0x51,0x06,0x40,0xcc,0xc1,0x0d,0xe7,0x20,0x25,0x5c,0xc7,0x93,0x19,0x40,
-0x1b,0xbb,0xbb,0xb1,0x09,0x00,0x14,0x50,0x4d,0x16,0x01,0x57,0x33,0xf0,0x01,0x2c,
-0xbb,0xbb,0xb4,0x00,0x01,0x65,0x00,0xb0,0x91,0x0b,0x47,0x80,0xd0,0xa2,0x2a,0x11,
-0x19,0x10,0x39,0x11,0x19,0x70,0x1b,0x00,0xb0,0xc0,0xa2,0x08,0xab,0x01,0x2e,0x24,
-0x10,0x00,0x49,0x0a,0x22,0x0d,0x11,0x0e,0x2b,0x08,0x49,0x0a,0x04,0x9a,0x02,0x16,
-0xc0,0x9a,0x02,0x70,0xca,0xa0,0x93,0x00,0xc0,0x0c,0x21,0x9a,0x02,0x20,0xc0,0x00,
-0x0b,0x00,0x01,0x9a,0x02,0x2f,0xcc,0xc1,0x9a,0x02,0x0c,0x11,0x08,0x08,0x01,0x02,
-0x47,0x02,0x30,0xcb,0x03,0xa0,0x52,0x02,0x00,0x10,0x02,0x10,0x98,0x08,0x01,0x14,
-0xc1,0x67,0x1b,0x80,0x39,0x97,0x10,0x00,0x00,0x4b,0x32,0x5c,0x56,0x0e,0x00,0x3c,
-0x03,0x31,0x86,0x00,0x1d,0x49,0x1e,0x12,0x50,0x5c,0x03,0xfd,0x12,0x1a,0xb6,0x00,
-0x0b,0x0a,0x40,0xa3,0x00,0xb0,0xc0,0x04,0x80,0x0b,0x1b,0x00,0x2a,0x9a,0xb1,0xb0,
-0x03,0x92,0x2c,0x0c,0x00,0x66,0x00,0xc0,0x6a,0x7c,0x10,0x0c,0x00,0x34,0x87,0x31,
-0x10,0x24,0x38,0x14,0x20,0xa7,0xc1,0x14,0x0e,0xf4,0x06,0x56,0x00,0xc0,0x2b,0x00,
-0x38,0xab,0xd0,0x1c,0x00,0x47,0x01,0xc0,0x0c,0x52,0xb3,0x00,0xc0,0x01,0x9a,0x50,
-0x55,0x0e,0x10,0x0b,0xc0,0x04,0x06,0x03,0x33,0x01,0x89,0x0c,0xf2,0x0c,0x67,0x20,
-0x00,0xb0,0x0b,0x63,0xc2,0x00,0xd0,0x1b,0x00,0x57,0x01,0xd0,0x2a,0x00,0x48,0xab,
-0xd0,0x0c,0x30,0xa4,0x00,0xc0,0x02,0xab,0x60,0x37,0x00,0x15,0x60,0x0f,0x19,0x10,
-0xd0,0x54,0x21,0x15,0x90,0x5e,0x21,0x10,0xc0,0x3c,0x00,0x50,0x80,0xb6,0x3c,0x20,
-0x0d,0x3b,0x00,0x51,0xd2,0xa0,0x04,0x8a,0xbd,0x3a,0x00,0x24,0x2a,0xb6,0x3a,0x13,
-0x30,0x40,0x00,0x08,0xe7,0x07,0x51,0xc0,0x06,0xec,0xcc,0xcc,0x09,0x00,0x40,0x04,
-0xcb,0xbb,0xb8,0x36,0x00,0x10,0x70,0x72,0x00,0x10,0xc0,0x37,0x00,0x10,0xc0,0x72,
-0x00,0xb2,0xc0,0x0c,0x30,0xa4,0x01,0xb0,0x02,0xab,0x60,0x01,0xb0,0x56,0x12,0xf0,
-0x13,0x91,0x09,0x08,0x20,0x00,0xb1,0x0b,0x0a,0x20,0x00,0xbd,0xdd,0x0e,0x60,0x00,
-0xa1,0x0c,0x68,0xc1,0x00,0x8b,0xb9,0x90,0x37,0x00,0x79,0x30,0x00,0x70,0x0b,0x62,
-0xb2,0x01,0xc0,0xe0,0x00,0x00,0xea,0x00,0xb3,0xbb,0xc0,0x0d,0x10,0x74,0x01,0xc0,
-0x04,0xcc,0x90,0x01,0x25,0x0e,0xf0,0x09,0x01,0x60,0x08,0x00,0x00,0x05,0x80,0x1c,
-0x00,0x00,0x0b,0xb0,0x6e,0x20,0x00,0x59,0x79,0xc3,0xc2,0x00,0x90,0x09,0x20,0x26,
-0xf9,0x11,0xb0,0x81,0x02,0xab,0x20,0xb0,0xa2,0x0b,0x22,0xb0,0xb0,0xa2,0x04,0x15,
-0x50,0xa2,0x0c,0x00,0xcb,0xe1,0x4b,0x13,0x12,0xb1,0x05,0x00,0xa0,0x06,0x99,0x50,
-0xa1,0xa2,0x00,0x43,0x00,0xa1,0xa2,0xe6,0x1e,0x10,0x92,0xa6,0x25,0x10,0x92,0x90,
-0x00,0xc0,0x61,0x01,0x65,0x00,0x80,0x91,0x0c,0x57,0x80,0xb1,0xa1,0x2a,0x28,0x00,
-0x30,0x39,0x00,0xcc,0x37,0x00,0x80,0xa0,0xa2,0xa2,0x06,0xcc,0x30,0xa1,0xa1,0x56,
-0x05,0x1f,0x20,0x82,0x13,0x06,0x01,0x93,0x0a,0x02,0xd4,0x01,0xfd,0x0a,0xb3,0x55,
+0x07,0x65,0xd0,0x0b,0x00,0xc0,0xbb,0xe0,0x56,0x01,0x1f,0x40,0x56,0x01,0x06,0x48,
+0x00,0x10,0x00,0x01,0x15,0x06,0x33,0xeb,0xbc,0xcc,0x0a,0x00,0xd2,0xd1,0x11,0x2c,
+0x00,0x00,0x7a,0xaa,0xa6,0x00,0x00,0x00,0x43,0x00,0x9c,0x05,0x02,0x00,0x07,0x33,
+0x10,0x00,0x02,0x06,0x06,0xf0,0x02,0xda,0xaa,0xae,0x00,0x00,0xc1,0x11,0x1c,0x00,
+0x00,0xca,0xaa,0x9d,0x00,0x00,0x01,0x77,0x2e,0x07,0x1f,0x66,0x05,0x07,0x0e,0x33,
+0x70,0x00,0x07,0x64,0x00,0x34,0xdb,0xbb,0xbe,0x51,0x06,0x10,0xed,0x0c,0x05,0x10,
+0x85,0x64,0x00,0x32,0xdd,0xcc,0xc7,0x18,0x03,0x19,0x70,0xb0,0x02,0x00,0x88,0x06,
+0x10,0x60,0x53,0x00,0x00,0xd1,0x07,0x00,0x06,0x06,0x10,0xbb,0x3d,0x00,0x11,0x0b,
+0x96,0x02,0x33,0x9c,0xcc,0xbd,0xa0,0x02,0x64,0x3b,0xba,0xbe,0xab,0xbb,0x00,0x7c,
+0x00,0x20,0xcd,0x30,0x09,0x00,0x11,0x94,0x88,0x06,0x12,0x20,0x6d,0x01,0x21,0x00,
+0xcc,0x47,0x00,0x03,0xf7,0x00,0x10,0x0b,0xc5,0x00,0x10,0xad,0xed,0x00,0x10,0x1c,
+0xca,0x00,0x62,0x0c,0x00,0x00,0x7a,0xdc,0xb8,0xc5,0x00,0x03,0x89,0x00,0x10,0x14,
+0x34,0x00,0x10,0x78,0xa6,0x03,0xf7,0x00,0xdd,0x30,0x00,0x00,0x3d,0x31,0xc6,0x00,
+0x04,0xa1,0x00,0x08,0x50,0x00,0x80,0xc5,0x00,0x13,0xbd,0x0a,0x00,0x01,0xca,0x00,
+0x23,0x8c,0xcc,0xd6,0x05,0xa8,0x6c,0xcc,0xcd,0xcc,0xc9,0x00,0x00,0x2a,0x00,0x00,
+0x05,0x00,0x10,0x16,0x85,0x04,0x2d,0x00,0x08,0x01,0x01,0x23,0x9c,0xcc,0x52,0x07,
+0x00,0x65,0x01,0x12,0xc7,0x07,0x05,0x10,0x80,0x05,0x00,0x20,0xe0,0x09,0x05,0x00,
+0x03,0x01,0x01,0x12,0x70,0xb9,0x00,0x10,0xa2,0xb9,0x00,0x10,0xbc,0x3c,0x00,0x12,
+0xb1,0x73,0x00,0x03,0x01,0x08,0x43,0x3b,0xbb,0xbd,0xbb,0xfc,0x07,0x40,0x9c,0xce,
+0xcd,0x20,0xfc,0x08,0x12,0x30,0xfc,0x00,0x15,0xe0,0xfb,0x00,0x01,0x41,0x00,0x00,
+0x04,0x05,0x02,0x41,0x01,0x12,0xb0,0x7d,0x00,0x12,0xbc,0x41,0x00,0x12,0x4b,0x41,
+0x00,0x00,0x92,0x08,0x42,0xab,0xcf,0xcc,0x20,0x79,0x01,0x10,0xfc,0x41,0x00,0x01,
+0x3e,0x02,0x44,0xdc,0xcc,0xcc,0x40,0xfa,0x00,0x10,0x0b,0xbe,0x00,0x01,0x51,0x08,
+0x13,0x1b,0x05,0x00,0x34,0x8c,0xcc,0xb6,0xc3,0x00,0x50,0xbb,0xdb,0xc5,0x00,0x39,
+0x3e,0x00,0x06,0x05,0x00,0x4c,0x25,0x00,0x80,0x00,0x6e,0x02,0x21,0xfb,0xbc,0x56,
+0x08,0x10,0x1c,0x81,0x01,0x67,0x2b,0x00,0x00,0x8a,0xaa,0xa5,0x17,0x05,0x00,0x09,
+0x01,0x12,0xc9,0xf1,0x01,0x21,0x90,0x00,0x36,0x0c,0x13,0xbe,0x0a,0x00,0x14,0x8c,
+0xaf,0x00,0x55,0x6c,0xcb,0xbb,0xbb,0xb7,0xed,0x01,0x06,0xf0,0x00,0x12,0x10,0xf0,
+0x00,0x12,0xbc,0x32,0x02,0x21,0x00,0x60,0xd3,0x04,0x00,0x76,0x06,0x00,0xdb,0x0a,
+0x32,0x0f,0xcc,0xcc,0x09,0x00,0x01,0xe5,0x04,0x00,0x1b,0x00,0x04,0x0a,0x07,0x05,
+0x46,0x0b,0x13,0x08,0xe5,0x04,0x10,0xa2,0xe5,0x04,0x60,0xb2,0x00,0xd0,0x0e,0x99,
+0xd1,0xae,0x06,0x10,0xa1,0xc9,0x06,0x10,0xb1,0xe5,0x04,0x14,0xb0,0x8f,0x03,0x10,
+0x54,0xa7,0x02,0x13,0x75,0x20,0x03,0x00,0x7d,0x09,0x00,0xe5,0x04,0x31,0x61,0x00,
+0xb0,0x3c,0x00,0x56,0x0e,0xbb,0xe2,0x00,0xd0,0x37,0x00,0x34,0x0a,0xbb,0xa0,0xe5,
+0x04,0x60,0x7c,0xcc,0xcd,0xa0,0x00,0x00,0x6a,0x0a,0x61,0x8d,0xcc,0xcc,0x80,0x00,
+0xa2,0xd3,0x08,0x04,0xee,0x06,0xf1,0x0a,0x30,0x32,0x03,0x0c,0x00,0xc0,0xb8,0x3b,
+0x0d,0x00,0xc0,0xb8,0x4b,0x0c,0x00,0xc4,0xb8,0x7c,0x0c,0x00,0xc7,0xc8,0xad,0x0c,
+0xc9,0x0f,0x00,0x02,0x05,0x00,0x7b,0xb7,0x4b,0x0c,0x00,0x7b,0x74,0xba,0xe6,0x09,
+0x13,0x08,0x3b,0x01,0xf3,0x11,0x41,0x13,0x22,0x83,0x00,0x2a,0x55,0xb5,0x59,0x40,
+0x01,0xc9,0x5c,0x85,0x84,0x00,0x1c,0xa5,0xd9,0x58,0xdc,0x11,0xa6,0x5b,0x55,0x84,
+0x00,0x0b,0xb2,0x9b,0x28,0x30,0x2e,0x07,0x30,0x8d,0xdd,0xce,0x39,0x07,0x00,0x7f,
+0x00,0x73,0x9d,0xdd,0xdd,0x10,0x00,0x0b,0x20,0x78,0x01,0xc1,0x40,0x00,0x01,0x10,
+0x10,0x10,0x90,0x1a,0x75,0xc2,0x90,0xc0,0x05,0x00,0x80,0x1b,0x85,0xc4,0x90,0xc0,
+0x1e,0xc5,0xcb,0x0a,0x00,0x14,0xc3,0x05,0x00,0x81,0x94,0xc4,0x80,0xb0,0x09,0x91,
+0x69,0x40,0xb6,0x00,0x06,0x05,0x00,0x12,0x60,0x89,0x00,0x20,0x03,0x90,0xf6,0x01,
+0x10,0x48,0xf6,0x06,0x20,0x06,0x70,0x0b,0x00,0xe0,0xab,0x00,0x0d,0x11,0x00,0x0d,
+0xb2,0x00,0xcb,0xb2,0x06,0x74,0x90,0x0c,0x15,0x08,0x67,0x20,0xc0,0x00,0x74,0x00,
+0x28,0xf1,0x07,0x05,0x38,0x07,0x10,0x03,0x5f,0x02,0x20,0x02,0xa0,0x57,0x0a,0xf1,
+0x09,0x67,0x00,0x0c,0x10,0x00,0x0c,0xb0,0x00,0xbd,0xc1,0x06,0x97,0x80,0x0b,0x10,
+0x04,0xc0,0x08,0x70,0xb1,0x00,0x71,0x00,0x03,0xf4,0x07,0x00,0x8d,0x04,0x36,0xcb,
+0xbb,0xbe,0x78,0x08,0x16,0x0d,0x4d,0x00,0x10,0x01,0x14,0x09,0x00,0x2c,0x04,0x11,
+0x03,0x77,0x01,0x11,0x68,0x64,0x0e,0x00,0x11,0x05,0xf1,0x00,0x04,0xaa,0x50,0x0c,
+0xcc,0x12,0xc1,0x0b,0x40,0xc0,0x00,0x92,0x00,0x05,0x0c,0x2a,0x00,0x10,0xc0,0x40,
+0x00,0x14,0x08,0x40,0x00,0x13,0xe0,0x97,0x05,0x10,0xb0,0x42,0x00,0x14,0x0c,0xcc,
+0x00,0x10,0x67,0x1e,0x00,0xf1,0x05,0x0d,0xc0,0x00,0xdc,0xc0,0x07,0x75,0xa0,0x0d,
+0x00,0x05,0xa0,0x06,0x80,0xd0,0x00,0x50,0x00,0x01,0x05,0x5f,0x0b,0x13,0x80,0xc9,
+0x03,0x43,0x0e,0xbb,0xbb,0xf0,0x0b,0x00,0x40,0x0c,0xbb,0xbb,0xb0,0xa4,0x0e,0x09,
+0x42,0x00,0x00,0xcc,0x00,0x10,0xdc,0xcc,0x00,0x20,0x0d,0x00,0xcc,0x00,0x10,0xd0,
+0xcc,0x00,0x00,0xf8,0x00,0x92,0x5a,0xa7,0x10,0x00,0x00,0x79,0x11,0x6b,0x00,0x1e,
+0x03,0xb8,0x00,0xa4,0x00,0x2d,0x00,0x00,0x01,0xbb,0xbb,0x30,0x00,0x01,0x00,0x60,
+0x31,0x00,0x90,0xb0,0x00,0x93,0xb7,0x02,0x10,0xa2,0x05,0x00,0x10,0xc1,0x05,0x00,
+0xf0,0x08,0xf6,0x00,0xea,0xe0,0x06,0x8c,0x00,0xc1,0xc0,0x0c,0x19,0x30,0xc0,0xc0,
+0x67,0x01,0xb0,0xc0,0xc0,0x70,0x00,0x60,0xc0,0x05,0x01,0x06,0x05,0x00,0xff,0x14,
+0x30,0x60,0x00,0x04,0x00,0x80,0x91,0x00,0x3a,0x00,0xd0,0xb2,0x00,0x58,0x00,0xc0,
+0xa2,0x00,0xbb,0x00,0xcc,0xe2,0x03,0xb8,0x60,0xc0,0xa2,0x1c,0x20,0xb3,0xc0,0xa2,
+0x53,0x00,0x03,0x2b,0x08,0x03,0x50,0x00,0x00,0x00,0x00,0xa0,0xc0,0x00,0x16,0x00,
+0xb0,0xa1,0x00,0x3a,0x00,0xc0,0xa2,0x00,0x68,0x05,0x00,0xf0,0x18,0xbc,0x00,0xcc,
+0xe2,0x03,0xb8,0x60,0xc0,0xa2,0x1c,0x20,0xb4,0xc0,0xa2,0x53,0x00,0x03,0x50,0x50,
+0x00,0x08,0xbb,0xbb,0xa0,0x00,0x0e,0x11,0x10,0xd0,0x00,0x0e,0x00,0x00,0xd0,0x00,
+0x0d,0x00,0x00,0xc0,0x14,0x00,0xd0,0x90,0x00,0x04,0x00,0x90,0x73,0x00,0x3a,0x00,
+0xd0,0x84,0x00,0x58,0x05,0x00,0xf0,0x0e,0xba,0x00,0xdc,0xe4,0x03,0xb9,0x50,0xd0,
+0x84,0x1c,0x10,0xc3,0xd0,0x84,0x53,0x00,0x12,0x70,0x83,0x00,0x00,0x48,0x85,0x00,
+0x00,0x07,0xa3,0x37,0xb0,0x37,0x00,0xc1,0xc1,0x00,0x0b,0x30,0x01,0xd0,0x00,0x02,
+0xbb,0xbb,0x30,0x00,0x01,0x00,0xf0,0x1f,0x06,0x00,0x0b,0x00,0x00,0x01,0xb0,0x00,
+0xd0,0x00,0x00,0x58,0x00,0x0c,0xba,0x00,0x0c,0xd1,0x00,0xc0,0x00,0x06,0x94,0xb0,
+0x0c,0x32,0x04,0xb0,0x04,0xa0,0xc9,0x80,0x50,0x00,0x01,0x0d,0x00,0x00,0x00,0x04,
+0x50,0xc0,0x00,0x00,0x00,0xa6,0x32,0x00,0xf0,0x28,0x4d,0xd3,0x00,0x00,0x00,0x5d,
+0x11,0xc5,0x00,0x00,0x39,0x00,0x00,0x93,0x00,0x00,0x03,0x00,0x00,0xa0,0x01,0xb0,
+0x00,0x0c,0x00,0x2b,0x00,0x00,0xc0,0x04,0xa0,0x00,0x0c,0x00,0x8e,0x06,0xcc,0xc0,
+0x0c,0x86,0x00,0x0c,0x05,0x80,0xc0,0x00,0xc0,0xc1,0x07,0x70,0x0c,0x54,0x00,0x07,
+0x00,0x40,0x00,0x10,0x0c,0x40,0x00,0x10,0xc0,0x76,0x00,0x00,0x36,0x00,0x51,0x80,
+0x00,0xd0,0x00,0x0c,0xcc,0x00,0xf1,0x01,0x05,0xe1,0x4c,0xcc,0x00,0xc6,0xa0,0x00,
+0xc0,0xa6,0x07,0x90,0x0c,0x66,0x00,0x05,0x24,0x00,0xa0,0x01,0x00,0x8c,0xbb,0xbc,
+0xb0,0x00,0x00,0x00,0x1c,0x0d,0x00,0x00,0x09,0x00,0x12,0x1b,0xb3,0x00,0x00,0x71,
+0x00,0x30,0x00,0x0a,0x30,0x3e,0x00,0xf0,0x0a,0x10,0x00,0xd0,0x00,0x1f,0x22,0xcc,
+0xd0,0x00,0x99,0xc0,0x00,0xd0,0x04,0xb0,0x69,0x00,0xd0,0x2b,0x00,0x07,0x40,0xd0,
+0x00,0x00,0x26,0x01,0x60,0x2a,0x00,0x00,0x50,0x00,0x3a,0x0c,0x00,0x01,0x05,0x00,
+0xf0,0x10,0x1c,0xcc,0xcc,0xb0,0x00,0x16,0x00,0x0a,0x00,0x03,0x80,0x00,0xb1,0x00,
+0x89,0x0a,0xbe,0x10,0x2c,0xb3,0x00,0xb1,0x1c,0x21,0xc2,0x0b,0x1a,0x30,0x01,0x60,
+0xb1,0xe5,0x00,0x40,0x00,0x08,0xdd,0xdc,0x3d,0x00,0xf2,0x00,0x0b,0x10,0x0a,0xdd,
+0xdd,0xc0,0x00,0xc2,0x00,0x00,0x00,0x09,0xdc,0xcc,0xc3,0xad,0x00,0xf0,0x15,0xa3,
+0x00,0x0d,0x00,0x0d,0x10,0x00,0xd0,0x02,0xf3,0x1c,0xcd,0x00,0xb6,0xc1,0x00,0xd0,
+0x88,0x03,0xb0,0x0d,0x38,0x00,0x03,0x20,0xc0,0x00,0x17,0xba,0x60,0x00,0x0c,0x51,
+0x18,0x80,0x02,0x64,0x01,0x82,0x1d,0x10,0x04,0xb0,0x00,0x4c,0xbb,0xa1,0xad,0x00,
+0xb0,0x30,0x00,0x80,0xa0,0x00,0xa3,0x00,0xc0,0xc0,0x00,0xb1,0x05,0x00,0x10,0xc0,
+0x05,0x00,0xf0,0x09,0xf4,0x8b,0xf0,0xc0,0x05,0xaa,0x00,0xc0,0xc0,0x0b,0x1b,0x10,
+0xc0,0xc0,0x58,0x04,0x80,0xc0,0xc0,0x80,0x00,0x70,0xc0,0xc0,0x1d,0x01,0x14,0xb0,
+0x05,0x00,0x70,0x50,0x70,0x00,0x03,0x00,0x90,0x91,0xdd,0x01,0xe6,0xb2,0x00,0x58,
+0x01,0xd0,0xa2,0x00,0xbc,0x4a,0xe0,0xa2,0x03,0xb8,0x70,0x19,0x02,0xc2,0x90,0x91,
+0x00,0x04,0x55,0x55,0x40,0x00,0x17,0x77,0x77,0xe0,0xf3,0x00,0x04,0x05,0x00,0xd0,
+0xa0,0x00,0x02,0x00,0x70,0x70,0x00,0x2a,0x00,0xd0,0xa1,0x00,0x49,0x05,0x00,0xf0,
+0x04,0x99,0x4b,0xf0,0xa1,0x01,0xdb,0x40,0xc0,0xa1,0x0b,0x41,0xc2,0xc0,0xa1,0x66,
+0x00,0x25,0xc0,0xa1,0x69,0x00,0x61,0xb1,0x00,0x1c,0x00,0x50,0x80,0x62,0x01,0x02,
+0x05,0x00,0x63,0x0c,0xcc,0xcc,0xb2,0x00,0x05,0x78,0x00,0x40,0xa1,0x00,0x58,0x02,
+0x78,0x00,0x51,0x49,0xe0,0xa2,0x03,0xc7,0x78,0x00,0xc3,0xa5,0xc0,0xa1,0x53,0x00,
+0x02,0x40,0x50,0x00,0x0b,0xcc,0xcc,0x73,0x00,0x10,0x0d,0x57,0x01,0x13,0x0d,0x3c,
+0x00,0x51,0xc3,0x00,0x01,0x00,0x60,0x78,0x00,0x30,0xb2,0x00,0x49,0x05,0x00,0x40,
+0x99,0x4c,0xf0,0xa2,0x78,0x00,0x10,0xa2,0x78,0x00,0xf7,0x10,0xb2,0x66,0x00,0x25,
+0xb0,0xb1,0x00,0x00,0x03,0x30,0x50,0x00,0x00,0x0a,0x40,0x00,0x00,0x00,0x3e,0xc1,
+0x00,0x00,0x03,0xd2,0x4c,0x20,0x00,0x4c,0x20,0x02,0xc1,0xde,0x01,0x21,0x0b,0x20,
+0xe6,0x02,0x40,0xbc,0xe0,0x00,0x2f,0xe3,0x01,0xd3,0xa9,0xb0,0x66,0xd0,0x05,0xa0,
+0x78,0x45,0xd0,0x3b,0x00,0x08,0x30,0xe6,0x00,0x10,0x1c,0xde,0x01,0x09,0xb9,0x00,
+0x40,0xb0,0x00,0x00,0x02,0x0b,0x00,0x10,0x49,0x05,0x00,0x10,0x98,0x4b,0x00,0xf0,
+0x06,0xdd,0x30,0x00,0x00,0x1d,0x22,0xd3,0x00,0x03,0xc3,0x00,0x2c,0x50,0x03,0x10,
+0x44,0x00,0x20,0x00,0x00,0x76,0x1e,0x00,0xb0,0x75,0x00,0x00,0x8c,0xcc,0xcc,0xcc,
+0xc8,0x00,0x00,0x55,0x0f,0x00,0xf2,0x09,0xc8,0x00,0x00,0x00,0x08,0xab,0x60,0x00,
+0x01,0xa9,0x00,0x99,0x00,0x04,0x30,0x65,0x04,0x20,0x00,0x00,0x66,0x00,0x00,0x7c,
+0x23,0x00,0x00,0x7f,0x02,0x40,0xcc,0xcc,0xce,0x30,0x0e,0x02,0x10,0x40,0x05,0x00,
+0x01,0x0a,0x00,0x40,0x20,0x00,0x00,0x56,0x1b,0x00,0x10,0xb7,0xcf,0x02,0xd3,0xbc,
+0x50,0x00,0x00,0x8a,0x00,0xb8,0x00,0x05,0x50,0x55,0x05,0x30,0x3c,0x00,0x13,0xdd,
+0x3c,0x00,0x25,0x00,0x80,0x97,0x01,0x01,0x33,0x01,0x52,0xbc,0xcc,0xcc,0x50,0x00,
+0x01,0x00,0x10,0x66,0x05,0x00,0xf1,0x16,0xd9,0x00,0x00,0x00,0x0a,0x89,0x90,0x00,
+0x02,0xc7,0x11,0x7b,0x10,0x03,0x10,0x66,0x02,0x20,0x46,0x66,0xaa,0x66,0x64,0x35,
+0x44,0x44,0x44,0x53,0x00,0x05,0xaa,0x71,0x00,0x00,0x79,0x10,0x5c,0xba,0x03,0xa1,
+0x20,0x00,0xa5,0x00,0x1d,0x00,0x00,0x1a,0xbb,0xb3,0x27,0x01,0x51,0x90,0x00,0xa2,
+0x00,0x0b,0x40,0x03,0xf0,0x02,0x04,0xf6,0x00,0x0c,0x00,0xd2,0xc3,0x00,0xc0,0xb4,
+0x01,0xc1,0x0c,0x23,0x08,0x01,0x10,0x69,0x02,0x95,0x0c,0x00,0x0c,0x12,0x40,0xc2,
+0xbb,0xba,0x96,0x76,0x03,0x45,0x07,0x00,0x00,0x05,0x0f,0x03,0xf2,0x02,0x9e,0x10,
+0x00,0x00,0x05,0xc4,0xc1,0x00,0x00,0x7b,0x00,0x3c,0x30,0x03,0x60,0x00,0x01,0x95,
+0x00,0x60,0x5c,0xcc,0xce,0xcc,0xba,0x00,0x3c,0x03,0x08,0x05,0x00,0x10,0x18,0x05,
+0x00,0x23,0x54,0x00,0x03,0x04,0xd2,0x05,0xcd,0x30,0x00,0x00,0x7c,0x12,0xc5,0x00,
+0x06,0x70,0x00,0x08,0x48,0x04,0x52,0x8c,0xcc,0xce,0xcc,0xc8,0x2d,0x00,0x11,0xc0,
+0x05,0x00,0x5b,0x15,0x00,0x00,0x01,0xd0,0xef,0x00,0x15,0x75,0xef,0x00,0x60,0x7a,
+0x80,0x00,0x03,0xc6,0x00,0xef,0x00,0x30,0x00,0x02,0x10,0x8a,0x01,0x40,0xc7,0x00,
+0x00,0x57,0x1e,0x00,0x10,0x23,0x05,0x00,0x50,0x78,0x00,0x00,0x00,0x02,0xbc,0x01,
+0x84,0x4c,0x31,0xc6,0x00,0x04,0xa1,0x00,0x08,0x41,0x00,0x01,0xbc,0x01,0x10,0xa4,
+0x90,0x01,0x10,0xe9,0xa6,0x03,0xe5,0x4a,0x70,0x00,0x01,0xb7,0x00,0xa8,0x00,0x07,
+0x40,0x00,0x06,0x30,0x00,0x01,0x00,0x00,0x50,0x00,0x13,0xc5,0x0c,0x00,0x11,0x49,
+0x83,0x00,0x00,0xb0,0x01,0x72,0x96,0xc1,0x00,0x02,0xc7,0x00,0x3c,0x4b,0x00,0x51,
+0x9b,0xbb,0xbb,0xbb,0xb5,0x0a,0x00,0x70,0x02,0xcc,0xcc,0xce,0x00,0x00,0x00,0x47,
+0x01,0x33,0xdb,0xbc,0xcb,0xa8,0x01,0x70,0xcc,0xcc,0xcc,0x30,0x00,0x00,0x27,0x0b,
+0x00,0x10,0x8a,0x18,0x04,0xf0,0x0c,0xca,0x80,0x00,0x00,0x7c,0x10,0x8a,0x10,0x03,
+0x60,0x00,0x03,0x40,0x13,0x22,0x22,0x22,0x21,0x59,0x9a,0xaa,0x99,0x96,0x00,0x60,
+0x00,0x04,0x5a,0x01,0x72,0x0a,0x20,0x00,0xfc,0xcc,0xce,0x20,0x0a,0x00,0x43,0xcb,
+0xbb,0xbc,0x10,0x7d,0x00,0x10,0x93,0xaa,0x00,0x10,0xf7,0xa2,0x02,0x90,0x5b,0x70,
+0x00,0x05,0xc4,0x00,0x8b,0x00,0x03,0xa3,0x02,0xf0,0x07,0x69,0x88,0x88,0x88,0x96,
+0x13,0x33,0x33,0x33,0x31,0x00,0x04,0x99,0x60,0x00,0x00,0x7a,0x22,0x7b,0x00,0x00,
+0xd1,0xcd,0x04,0x10,0xb4,0xdf,0x01,0x15,0x1b,0xdf,0x01,0x90,0xd0,0x00,0x1b,0x00,
+0x0d,0x00,0x01,0xb0,0x01,0x09,0x00,0xf4,0x07,0x5f,0x30,0x01,0xb0,0x0b,0x6a,0x00,
+0x1c,0x03,0xb0,0xb3,0x01,0xc0,0xb2,0x02,0xb0,0x1c,0x26,0x00,0x06,0x11,0xc0,0x1f,
+0x05,0x02,0x55,0x05,0x12,0x04,0x55,0x05,0x13,0x1c,0x55,0x05,0xc3,0x00,0x0c,0x00,
+0xc6,0xb0,0x00,0xc0,0xa5,0x06,0x90,0x0c,0x65,0x55,0x05,0x10,0x03,0x55,0x05,0x50,
+0xa0,0x00,0x00,0x00,0x2b,0xfc,0x00,0x0a,0x55,0x05,0x18,0x90,0x55,0x05,0x00,0x81,
+0x03,0xb8,0x89,0xc0,0x00,0xd0,0x03,0xc0,0x69,0x00,0xd0,0x2c,0x10,0x55,0x05,0x11,
+0x70,0x3d,0x00,0x25,0x00,0x2b,0x55,0x05,0xf0,0x0c,0x07,0x00,0x09,0x10,0x02,0xa0,
+0x00,0xb2,0x00,0x69,0x00,0x0a,0x20,0x0c,0xc3,0x00,0xa2,0x09,0x61,0xc1,0x0b,0x28,
+0x80,0x02,0x80,0xb2,0x10,0x55,0x05,0x13,0x0a,0x55,0x05,0x51,0x20,0x0b,0xdd,0xdd,
+0xd0,0x04,0x03,0x40,0x0a,0xcc,0xcc,0xc4,0xe2,0x05,0x00,0xaf,0x00,0xf0,0x0a,0xa1,
+0x00,0x1b,0x00,0x0b,0x20,0x05,0x90,0x00,0xb2,0x00,0xbd,0x10,0x0a,0x10,0x69,0x3b,
+0x00,0xa1,0x4b,0x00,0x4a,0x0a,0x14,0x00,0xe0,0x03,0xf1,0x06,0x6a,0xaa,0xbb,0x10,
+0x0a,0x41,0x11,0xa3,0x00,0xa3,0x00,0x0a,0x30,0x0a,0x30,0x00,0xa2,0x00,0x6b,0xbb,
+0xba,0xb0,0x00,0x52,0x10,0x00,0x81,0x00,0x0d,0xac,0x00,0xf0,0x03,0xe0,0x00,0x0d,
+0x00,0x6e,0x60,0x00,0xd0,0x1c,0x1b,0x30,0x0d,0x1c,0x30,0x1b,0x10,0xd2,0x20,0x6a,
+0x06,0x80,0x01,0x7b,0xa6,0x00,0x00,0xc5,0x11,0x88,0xa8,0x00,0xa2,0xd0,0x01,0xd1,
+0x00,0x4b,0x00,0x04,0xcb,0xba,0x10,0x3c,0x00,0x10,0x01,0x94,0x03,0x20,0x83,0x0b,
+0xed,0x01,0x20,0x93,0x0c,0x06,0x00,0x20,0xa3,0x0d,0x06,0x00,0xf1,0x0d,0xc5,0x0f,
+0x20,0xd1,0x10,0x00,0xd9,0x1f,0x60,0xcb,0xa0,0x02,0xab,0x58,0xa0,0xc0,0x00,0x08,
+0x4a,0xc1,0xc0,0xc0,0x00,0x0c,0x04,0x90,0x63,0xc0,0x39,0x00,0x08,0x06,0x00,0x13,
+0x90,0xe5,0x01,0x10,0x1b,0xe7,0x01,0xf6,0x09,0x3b,0x00,0xb2,0x00,0x00,0x7e,0x00,
+0xf7,0x00,0x00,0xc8,0x56,0x9d,0x00,0x09,0x50,0xcc,0x15,0x80,0x06,0x00,0x33,0x00,
+0x50,0x95,0x02,0x04,0x4c,0x04,0x22,0x01,0x00,0x48,0x01,0xf1,0x07,0x09,0xcd,0x30,
+0x0d,0x00,0x05,0x90,0x1c,0x00,0xd0,0x00,0x93,0x00,0xc0,0x0d,0x00,0x0a,0x20,0x0b,
+0x10,0xdc,0xc1,0x0b,0x00,0xa1,0x05,0x70,0x1c,0x00,0xc0,0x00,0x0b,0xac,0x30,0x0c,
+0x2f,0x00,0x11,0xc0,0xdf,0x04,0x05,0x7a,0x00,0x00,0xe5,0x01,0xf0,0x12,0x03,0xab,
+0x30,0x0b,0x00,0x00,0xd1,0x1c,0x00,0xc1,0x00,0x2a,0x00,0xa2,0x0c,0x10,0x03,0xa0,
+0x09,0x30,0xbd,0xc1,0x0d,0x00,0xc0,0x0b,0x10,0x00,0x6c,0xc6,0x00,0xb1,0x00,0x64,
+0x01,0x03,0x79,0x00,0x55,0x01,0xcb,0xbb,0xbe,0x00,0x82,0x04,0x16,0x0d,0x48,0x00,
+0x10,0x01,0x6f,0x03,0x00,0x27,0x00,0xf1,0x00,0x89,0x99,0x00,0xc0,0x00,0x1c,0x00,
+0xb1,0x0c,0x00,0x03,0x90,0x09,0x30,0xc0,0x53,0x00,0xa5,0xdc,0x00,0xd3,0x2c,0x00,
+0xc0,0x00,0x02,0xaa,0x20,0x7a,0x00,0x34,0xa0,0x00,0x09,0x40,0x00,0x01,0x4b,0x00,
+0x10,0x09,0xfb,0x01,0x23,0x03,0xbc,0x8a,0x00,0x11,0xd0,0x37,0x00,0x10,0x00,0x8a,
+0x00,0x10,0xcd,0x8a,0x00,0x20,0x0c,0x00,0x8a,0x00,0x10,0xa0,0xb0,0x00,0x10,0x87,
+0xb4,0x00,0xf0,0x13,0x14,0x50,0x00,0x01,0xa0,0x2b,0xfd,0x90,0x00,0x1a,0x00,0x97,
+0xb3,0x00,0x01,0xc5,0x3b,0x06,0x50,0x00,0x06,0x63,0x6b,0xb1,0x00,0x00,0x67,0x20,
+0x08,0x00,0x00,0xc5,0x3c,0x20,0xcc,0x00,0xf1,0x04,0x57,0x0c,0x10,0x02,0xa0,0x04,
+0x80,0xbd,0xc2,0x0d,0x20,0xa4,0x0b,0x10,0x00,0x2a,0xb6,0x00,0xb0,0xa5,0x03,0x01,
+0x33,0x02,0x11,0xe0,0x09,0x01,0x10,0x10,0xeb,0x05,0x12,0xc0,0x4c,0x05,0x00,0x87,
+0x06,0x10,0xc3,0x0e,0x01,0x16,0x0c,0x84,0x00,0x11,0x0d,0x84,0x00,0x30,0xdc,0xb0,
+0x0d,0x4b,0x01,0x00,0x84,0x00,0x00,0xad,0x00,0x00,0xf8,0x04,0x91,0x09,0xaa,0xab,
+0xa0,0x00,0x00,0xd1,0x11,0x1d,0xc6,0x00,0x13,0xd0,0x48,0x09,0x10,0x09,0x46,0x09,
+0x0f,0x42,0x00,0x02,0x15,0xc0,0x42,0x00,0x13,0xc0,0x21,0x03,0x11,0x09,0xcc,0x05,
+0x10,0xc0,0x8d,0x01,0x43,0x0e,0xcc,0xcc,0xf0,0x0b,0x00,0x46,0x0b,0xbb,0xbb,0xb0,
+0x92,0x01,0x08,0x42,0x00,0x19,0xc1,0x84,0x00,0x00,0x3f,0x00,0x90,0x00,0x6a,0xa7,
+0x10,0x00,0x00,0x78,0x10,0x5b,0xd2,0x01,0x00,0x58,0x00,0x10,0xa4,0xf2,0x03,0xe0,
+0x01,0xab,0xbb,0x30,0x00,0x03,0xab,0x40,0x0b,0x00,0x00,0xd2,0x0b,0x00,0x81,0x01,
+0x10,0x74,0x4a,0x01,0xc2,0x06,0x40,0xcc,0xc1,0x0d,0x00,0xa1,0x0c,0x00,0x00,0x5c,
+0xc7,0x84,0x00,0x10,0x05,0x1e,0x04,0x20,0xbb,0xb1,0x09,0x00,0x10,0x50,0x95,0x01,
+0x10,0x0c,0x1a,0x02,0x00,0x1b,0x00,0xf4,0x17,0x2c,0xbb,0xbb,0xb4,0x00,0x01,0x65,
+0x00,0xb0,0x91,0x0b,0x47,0x80,0xd0,0xa2,0x2a,0x00,0xc0,0xd0,0xa2,0x39,0x00,0xc0,
+0xcc,0xe2,0x1b,0x00,0xb0,0xc0,0xa2,0x08,0xab,0x40,0xc0,0xa2,0x00,0x10,0x00,0x49,
+0x0a,0x10,0x0d,0x49,0x0a,0x1a,0x0d,0x49,0x0a,0x04,0x9a,0x02,0x16,0xc0,0x9a,0x02,
+0x70,0xca,0xa0,0x93,0x00,0xc0,0x0c,0x21,0x9a,0x02,0x20,0xc0,0x00,0x0b,0x00,0x01,
+0x9a,0x02,0x2f,0xcc,0xc1,0x9a,0x02,0x0c,0x11,0x08,0x08,0x01,0x02,0x47,0x02,0x30,
+0xcb,0x03,0xa0,0x52,0x02,0x00,0x10,0x02,0x10,0x98,0x08,0x01,0x00,0xe4,0x07,0x00,
+0x71,0x0a,0xd0,0x00,0x39,0x97,0x10,0x00,0x00,0x4b,0x32,0x5c,0x00,0x00,0x0a,0x30,
+0x3c,0x03,0x10,0x86,0x08,0x01,0x42,0x00,0xab,0xbb,0x50,0x5c,0x03,0xfc,0x13,0x1a,
+0xb6,0x00,0x0b,0x0a,0x40,0xa3,0x00,0xb0,0xc0,0x04,0x80,0x0b,0x1b,0x00,0x2a,0x9a,
+0xb1,0xb0,0x03,0x92,0x2c,0x0c,0x00,0x66,0x00,0xc0,0x6a,0x7c,0x10,0x0c,0x00,0x34,
+0x00,0x50,0x0a,0xf1,0x11,0x24,0x00,0x00,0xa0,0x07,0xa7,0xc1,0x00,0xd0,0x0c,0x00,
+0x56,0x00,0xc0,0x2b,0x00,0x38,0xab,0xd0,0x1c,0x00,0x47,0x01,0xc0,0x0c,0x52,0xb3,
+0x00,0xc0,0x01,0x9a,0x50,0xa2,0x00,0x00,0x57,0x03,0x00,0xc0,0x04,0x15,0x0d,0x0b,
+0x03,0x10,0x0b,0xc5,0x02,0xf2,0x0c,0x67,0x20,0x00,0xb0,0x0b,0x63,0xc2,0x00,0xd0,
+0x1b,0x00,0x57,0x01,0xd0,0x2a,0x00,0x48,0xab,0xd0,0x0c,0x30,0xa4,0x00,0xc0,0x02,
+0xab,0x60,0x37,0x00,0x31,0x60,0x00,0x5c,0x5f,0x08,0x00,0x33,0x01,0x41,0x5d,0xcc,
+0xcc,0x90,0x89,0x06,0x00,0x0a,0x00,0x10,0xc0,0x3c,0x00,0x50,0x80,0xb6,0x3c,0x20,
+0x0d,0x3b,0x00,0x51,0xd2,0xa0,0x04,0x8a,0xbd,0x3a,0x00,0x22,0x2a,0xb6,0x9c,0x00,
+0x50,0x50,0x04,0x40,0x00,0x08,0xe7,0x07,0x51,0xc0,0x06,0xec,0xcc,0xcc,0x09,0x00,
+0x40,0x04,0xcb,0xbb,0xb8,0x36,0x00,0x10,0x70,0x72,0x00,0x10,0xc0,0x37,0x00,0x10,
+0xc0,0x72,0x00,0xa1,0xc0,0x0c,0x30,0xa4,0x01,0xb0,0x02,0xab,0x60,0x01,0x68,0x00,
+0xf0,0x15,0x40,0x00,0x91,0x09,0x08,0x20,0x00,0xb1,0x0b,0x0a,0x20,0x00,0xbd,0xdd,
+0x0e,0x60,0x00,0xa1,0x0c,0x68,0xc1,0x00,0x8b,0xb9,0x90,0x37,0x00,0x79,0x30,0x00,
+0x70,0x0b,0x62,0xb2,0x01,0xc0,0xe0,0x00,0x00,0xea,0x00,0xc2,0xbb,0xc0,0x0d,0x10,
+0x74,0x01,0xc0,0x04,0xcc,0x90,0x01,0xb0,0xae,0x00,0xf2,0x26,0x01,0x60,0x08,0x00,
+0x00,0x05,0x80,0x1c,0x00,0x00,0x0b,0xb0,0x6e,0x20,0x00,0x59,0x79,0xc3,0xc2,0x00,
+0x90,0x09,0x20,0x26,0x00,0x00,0x00,0x70,0x81,0x02,0xab,0x20,0xb0,0xa2,0x0b,0x22,
+0xb0,0xb0,0xa2,0x0c,0x00,0xc0,0xb1,0xa2,0x0c,0x00,0xcb,0xe1,0xa2,0x0c,0x00,0xb0,
+0xb1,0x05,0x00,0xf0,0x05,0x06,0x99,0x50,0xa1,0xa2,0x00,0x43,0x00,0xa1,0xa2,0x00,
+0x00,0x00,0xa1,0x92,0x00,0x00,0x00,0xb1,0x92,0x90,0x00,0xc0,0x61,0x01,0x65,0x00,
+0x80,0x91,0x0c,0x57,0x80,0xb1,0xa1,0x2a,0x28,0x00,0x30,0x39,0x00,0xcc,0x37,0x00,
+0x80,0xa0,0xa2,0xa2,0x06,0xcc,0x30,0xa1,0xa1,0x56,0x05,0x17,0x20,0x16,0x0a,0x01,
+0x8f,0x09,0x15,0x0e,0xa3,0x03,0x00,0x93,0x0a,0x02,0xd4,0x01,0xfd,0x0a,0xb3,0x55,
 0xb0,0xc0,0x05,0x77,0x7b,0x1b,0x00,0x39,0x00,0xb1,0xb0,0x04,0x80,0x0c,0x0c,0x00,
-0x75,0xcc,0xc0,0x69,0x7c,0x00,0x0b,0xd4,0x01,0x11,0x05,0xab,0x05,0xf0,0x09,0x2a,
+0x75,0xcc,0xc0,0x69,0x7c,0x00,0x0b,0xd4,0x01,0x11,0x05,0xab,0x05,0xf1,0x0b,0x2a,
 0xc6,0x00,0x0d,0x0c,0x20,0xb3,0xbb,0xd1,0xa0,0x05,0x70,0x0d,0x2a,0x00,0x47,0x00,
-0xd0,0xc1,0x08,0x5c,0xcd,0x04,0xcc,0xe8,0x06,0x04,0xb2,0x1d,0x11,0x06,0x61,0x38,
-0x07,0x65,0x2c,0x02,0xa2,0x05,0x10,0x13,0xdb,0x16,0xe1,0xb9,0xb0,0x00,0xd0,0x1c,
-0x00,0x75,0x9c,0xd0,0x39,0x00,0x48,0x00,0xd0,0x41,0x00,0x75,0x0c,0x31,0xb3,0xbc,
-0xc0,0x02,0xab,0x13,0x02,0x10,0x56,0xcd,0x05,0x04,0xe3,0x2b,0x01,0x68,0x10,0x13,
-0xa0,0x13,0x02,0x20,0xc3,0x9a,0x13,0x02,0x10,0x11,0x13,0x02,0x75,0x00,0xc0,0x0c,
-0x30,0xa6,0xcd,0xd0,0x13,0x02,0x1f,0x30,0x13,0x02,0x07,0x00,0xb7,0x00,0xa0,0x18,
-0xa5,0x00,0x0d,0x0c,0x41,0xc3,0xac,0xd2,0xb0,0xb7,0x00,0x00,0x7b,0x00,0x31,0xd1,
-0x08,0x4b,0xb7,0x00,0x11,0xc0,0xc3,0x0f,0xf5,0x04,0x01,0x8b,0xa5,0x00,0x00,0xc4,
-0x01,0x97,0x00,0x2b,0x00,0x01,0xc0,0x01,0xd1,0x00,0x5a,0x00,0x05,0x36,0x1b,0x00,
-0xa4,0x01,0x70,0xaa,0x20,0xb1,0xa2,0x0b,0x21,0xc2,0x95,0x01,0x60,0xc9,0xd1,0xa2,
-0x0c,0x00,0xa1,0x0a,0x00,0x10,0xb1,0x05,0x00,0xd4,0xdc,0xe1,0xa2,0x06,0x99,0x70,
-0xb1,0xa2,0x00,0x34,0x00,0xb1,0xa2,0x9f,0x01,0x03,0xa4,0x01,0x02,0x54,0x1b,0x30,
-0x1c,0xaa,0xc2,0x59,0x04,0x21,0x2b,0x00,0xec,0x1e,0x20,0x00,0x94,0x0a,0x00,0x34,
-0x2c,0xaa,0xc2,0x72,0x1b,0x17,0x66,0xec,0x23,0x50,0xc8,0x00,0x07,0xbb,0x60,0x24,
-0x4d,0x13,0x78,0x36,0x12,0x84,0xa6,0x00,0x79,0x00,0x00,0x18,0xdc,0x70,0x24,0x0b,
-0x14,0xdc,0x31,0x14,0x1d,0xa0,0x8d,0x36,0x04,0xbf,0x3c,0x30,0xab,0xab,0x30,0xfa,
-0x3e,0x20,0x1c,0x00,0xd9,0x3c,0x10,0xc0,0xcf,0x2c,0x13,0xc4,0xb1,0x0d,0x00,0x33,
-0x13,0x29,0xbb,0x00,0x96,0x36,0x21,0x00,0x85,0xea,0x12,0x16,0x30,0x31,0x14,0xe0,
-0x70,0x00,0x00,0x19,0xbb,0x91,0x00,0x00,0xa5,0x00,0x4a,0x00,0x00,0xc1,0x47,0x00,
-0x20,0x4c,0x9a,0x41,0x00,0x28,0x77,0x00,0xf1,0x14,0x35,0x50,0x00,0x03,0x99,0x36,
-0x18,0xce,0x57,0x3a,0x02,0x15,0x31,0xe0,0x84,0x00,0xa2,0x00,0x08,0x83,0xa4,0x0a,
-0x20,0x00,0xc0,0x02,0x90,0x92,0x8b,0x19,0xf0,0x01,0x09,0x20,0x00,0xb2,0x05,0x70,
-0x96,0x30,0x02,0xbb,0xa0,0x09,0xa8,0x20,0x00,0x10,0xa6,0x07,0x11,0x0c,0xbb,0x0b,
-0x94,0xc0,0x23,0x93,0x00,0xab,0xbb,0xb9,0x69,0x30,0xa3,0x09,0x24,0x00,0x06,0x79,
-0x01,0x90,0x07,0xa8,0x00,0xa1,0x00,0x08,0x60,0x67,0x0b,0xcc,0x09,0xe0,0xb0,0xa2,
-0x00,0x0a,0x40,0x49,0x0a,0x20,0x00,0x1a,0xea,0x10,0xad,0xc0,0x1c,0x2a,0x54,0x20,
-0x09,0xbb,0xfb,0xb7,0xbd,0x35,0x11,0x06,0x95,0x32,0x13,0xd1,0x94,0x06,0x02,0x13,
-0x01,0x12,0x20,0x5f,0x08,0xc0,0x03,0x86,0x00,0x0c,0x03,0xb3,0x88,0x00,0xc0,0x93,
-0x00,0xc0,0x27,0x2a,0x30,0x00,0xc0,0x76,0xef,0x3a,0x20,0xab,0xb2,0xc5,0x25,0x04,
-0x71,0x29,0x75,0xc1,0x24,0x0c,0x2b,0xbb,0xa9,0x60,0xf3,0x02,0x12,0x70,0xcb,0x02,
-0xf0,0x06,0xa8,0x10,0x0c,0x06,0x80,0x4a,0x00,0xd0,0xa2,0x00,0xc0,0x0d,0x08,0x60,
-0x2b,0x00,0xd0,0x09,0xea,0x10,0x0d,0x22,0x00,0x42,0xd4,0xbb,0xfb,0xb8,0x93,0x1b,
-0x01,0x14,0x11,0x14,0xa2,0x43,0x36,0x10,0x7c,0xe5,0x12,0x01,0xbd,0x05,0x15,0x1b,
-0xf8,0x01,0x10,0xc0,0x07,0x03,0x17,0xa4,0xf8,0x01,0x20,0x10,0x00,0x90,0x13,0x00,
-0x6a,0x00,0x10,0xd0,0xc2,0x24,0xb3,0xec,0xc8,0x00,0x08,0xbb,0x80,0x00,0x00,0x95,
-0x00,0x68,0x60,0x14,0x90,0x98,0x11,0x88,0x00,0x00,0x2d,0xa9,0xe0,0x00,0xbc,0x0d,
-0x08,0x4d,0x36,0x10,0x3b,0x8e,0x0a,0x10,0xd1,0x30,0x11,0x10,0xd1,0xa3,0x05,0x10,
-0x4b,0x0f,0x00,0x83,0x02,0x66,0x20,0x00,0x00,0x5b,0x54,0xb5,0x01,0x07,0x01,0x47,
-0x06,0x30,0x89,0x22,0x89,0x9d,0x32,0x16,0x50,0x05,0x2e,0x1d,0xb8,0x46,0x0c,0x10,
-0x27,0xe1,0x00,0x01,0x70,0x02,0x23,0x01,0x87,0xc3,0x0d,0x10,0x96,0x70,0x02,0x39,
-0x07,0xbb,0x70,0x29,0x1d,0x10,0x1b,0x97,0x03,0x10,0x1b,0x30,0x0d,0x17,0x06,0xa0,
-0x15,0x03,0x70,0x02,0x33,0x1a,0xba,0xb3,0x6f,0x02,0x18,0xa5,0x3d,0x2f,0x01,0x46,
-0x2e,0x14,0xb8,0x46,0x2e,0x22,0xce,0x40,0x1d,0x24,0x18,0xdc,0xa0,0x15,0x50,0x70,
-0x00,0x06,0xaa,0x81,0xed,0x02,0x21,0x4c,0x00,0xcd,0x0f,0xf2,0x05,0x00,0x5c,0x77,
-0xa9,0x00,0x00,0x01,0x34,0x10,0x00,0x3b,0xaa,0xaa,0xaa,0xa8,0x01,0x11,0x1d,0x11,
-0x10,0x41,0x04,0x10,0xec,0xee,0x0d,0x10,0xe0,0x41,0x00,0x01,0x05,0x00,0x01,0x6d,
-0x24,0x01,0xa5,0x02,0x10,0xa4,0x3c,0x0d,0x10,0xc1,0x24,0x00,0x9f,0x6b,0x77,0xb7,
-0x00,0x00,0x01,0x44,0x10,0x00,0xbe,0x0c,0x0c,0x14,0x91,0xbe,0x0c,0xe0,0x05,0xa8,
-0x00,0x0b,0x05,0x90,0x59,0x00,0xc0,0x92,0x00,0xc0,0x0c,0x09,0x15,0x02,0xf2,0x07,
-0x59,0x05,0x90,0x0c,0x00,0x6a,0x80,0x00,0xc0,0x44,0x45,0x68,0x1c,0x16,0x6e,0x54,
-0x20,0xc0,0x00,0xd0,0x4c,0xcc,0x94,0x07,0x14,0xd0,0xbe,0x2e,0x01,0x01,0x00,0x91,
-0x69,0x70,0x00,0xa0,0x06,0x81,0x59,0x00,0xc0,0x4d,0x02,0xf0,0x03,0x07,0x70,0x4a,
-0x00,0xc0,0x00,0x7b,0x91,0x00,0xc0,0x36,0x66,0x78,0x90,0xc0,0x35,0x7c,0x43,0xf1,
-0x2f,0x50,0x06,0xbc,0xc0,0x00,0x12,0x3b,0x00,0x10,0x94,0x37,0x00,0x13,0x94,0x3c,
-0x20,0x12,0xb0,0xa4,0x03,0xe0,0x9b,0xa2,0x00,0xb0,0x09,0x40,0x1c,0x00,0xd0,0x09,
-0x50,0x1c,0x00,0xc0,0x0f,0x00,0x90,0xc0,0x36,0x66,0x79,0xa0,0xd0,0x25,0x7c,0x42,
-0x00,0x02,0x21,0x05,0xbc,0x45,0x26,0x12,0x60,0xad,0x1d,0x90,0x26,0x66,0x67,0xc0,
-0x00,0x88,0x44,0x44,0x20,0xc6,0x18,0x12,0xc1,0x41,0x00,0xc3,0x89,0x30,0x62,0x92,
-0x0b,0x42,0xc0,0x82,0x92,0x0c,0x00,0x83,0x05,0x00,0xfa,0x19,0x0a,0x86,0xb0,0x92,
-0x92,0x00,0x45,0x00,0x82,0x92,0x26,0x66,0x88,0x82,0x92,0x15,0x99,0x30,0x82,0x92,
-0x00,0x57,0x29,0xc2,0x92,0x00,0x57,0x02,0x92,0x92,0x00,0x57,0x00,0x83,0x92,0x00,
-0x12,0x00,0x30,0x51,0xfe,0x00,0x14,0xa2,0x13,0x03,0x61,0x59,0x06,0x80,0x0c,0x00,
-0x6a,0x63,0x21,0x62,0x24,0x0c,0x2b,0xbf,0xb9,0x70,0xf5,0x00,0x05,0xfe,0x00,0x10,
-0x04,0x13,0x03,0x80,0x02,0x66,0x10,0x00,0x00,0x5b,0x44,0xc3,0x15,0x00,0x13,0x39,
-0x7f,0x0c,0x95,0x88,0x12,0xa5,0x00,0x00,0x06,0x99,0x40,0x00,0xb9,0x26,0x30,0xb5,
-0x00,0x2a,0x5a,0x08,0x01,0x05,0x00,0x10,0x29,0x51,0x00,0x15,0x17,0x9e,0x0b,0x30,
-0x1a,0xbb,0xa1,0x02,0x05,0x10,0x49,0x05,0x00,0x17,0x4a,0x4e,0x3e,0x11,0x6b,0x5c,
-0x1f,0x01,0x14,0x03,0x10,0xcd,0x63,0x27,0x0e,0x74,0x30,0x12,0x40,0x55,0x03,0x83,
-0x2b,0xaa,0xb1,0x00,0x00,0xb3,0x00,0x58,0xb0,0x02,0x01,0x2d,0x03,0x37,0x79,0x22,
-0xb4,0x82,0x00,0x07,0x62,0x2f,0x30,0x06,0xbb,0x70,0xae,0x0f,0x20,0x7a,0x00,0xd5,
-0x1d,0x00,0x6a,0x02,0x10,0x6a,0xdd,0x02,0x14,0x80,0xb4,0x18,0x05,0x85,0x2f,0x1e,
-0xb0,0xfc,0x35,0x07,0xdd,0x02,0x30,0x95,0x00,0x1c,0xaf,0x00,0x17,0x1d,0xcd,0x1c,
-0x00,0xa2,0x39,0x15,0xb9,0x49,0x05,0x12,0x40,0xdf,0x3b,0x01,0x48,0x05,0x15,0xd0,
-0xdd,0x02,0x17,0x08,0x46,0x05,0x14,0x1d,0x46,0x05,0x12,0x11,0x3e,0x30,0x64,0x11,
-0x7b,0xbb,0xaa,0xaa,0xb7,0x93,0x30,0x01,0x41,0x05,0x40,0x09,0x30,0x01,0xd0,0x10,
-0x05,0x10,0xbc,0xb6,0x30,0x10,0x19,0x02,0x0a,0x10,0xb4,0x27,0x01,0x10,0xd1,0x1f,
-0x21,0x32,0x5c,0x9a,0xc3,0x3c,0x00,0x03,0x93,0x3c,0x00,0x1a,0x40,0x01,0xdc,0x03,
-0x33,0x99,0x22,0x8a,0x79,0x36,0x18,0xc2,0x9d,0x3f,0x03,0xf2,0x04,0x1b,0x78,0xf2,
-0x04,0x36,0x01,0xba,0xc3,0xd3,0x07,0x77,0xc2,0xaa,0xab,0xbb,0x1c,0x01,0x11,0xe5,
-0x07,0x11,0x40,0xc8,0x0d,0x00,0xf6,0x00,0xf0,0x03,0x03,0xdc,0x80,0x01,0xa0,0xc1,
-0x09,0x40,0x1b,0x2a,0x00,0x48,0x01,0xa3,0x90,0x03,0x90,0x1a,0x09,0x00,0xc1,0xa0,
-0xd0,0x09,0x40,0x1a,0x05,0xca,0xa0,0x01,0xa0,0x00,0x10,0x41,0x04,0x24,0x02,0xa0,
-0xb0,0x0e,0x02,0x7b,0x01,0xe0,0x2a,0xc6,0x00,0x0c,0x0c,0x30,0xa3,0x00,0xc1,0xb0,
-0x04,0x70,0x0c,0x1b,0xa4,0x07,0x62,0xd1,0x08,0x40,0x0c,0x04,0xcc,0x9a,0x1b,0x0e,
-0x76,0x27,0x15,0x1b,0x10,0x26,0x03,0x2f,0x0a,0x90,0xc0,0x00,0xd0,0x0d,0x00,0x65,
-0x00,0xd0,0x2b,0x3c,0x00,0x80,0x1c,0x00,0x57,0x00,0xc0,0x0c,0x52,0xb2,0x2f,0x0a,
-0x14,0x40,0x1c,0x08,0x10,0x47,0x86,0x02,0x01,0x81,0x22,0x01,0x05,0x00,0x13,0x3c,
-0x2f,0x0a,0x14,0xa0,0xbd,0x09,0x23,0x00,0xc0,0x1c,0x08,0x08,0x2f,0x0a,0x10,0x30,
-0xec,0x01,0x12,0xa0,0x6d,0x00,0x10,0x7d,0x9b,0x01,0x13,0x94,0x13,0x1c,0xf0,0x03,
-0xb0,0x00,0x77,0x20,0x00,0xa0,0xb5,0x4d,0x10,0x0c,0x1b,0x00,0x95,0x00,0xc2,0xa0,
-0x08,0x60,0xa2,0x2f,0x42,0x00,0xc0,0x2a,0xb5,0x12,0x01,0x51,0x30,0x3c,0xcd,0x2b,
-0xca,0x8e,0x2f,0xd4,0x3c,0xbc,0x00,0x0c,0x05,0x70,0x00,0x00,0xc0,0x3d,0xcb,0x40,
-0x0a,0x09,0x09,0x0f,0xed,0x00,0x08,0x01,0xee,0x27,0xe2,0x60,0x08,0x61,0x11,0x2b,
-0x00,0x85,0x00,0x01,0xb0,0x08,0x50,0x00,0x1b,0xee,0x27,0xf2,0x09,0x67,0x20,0x02,
-0x90,0xb6,0x3c,0x20,0x2a,0x1b,0x00,0x57,0x02,0xa2,0xa0,0x04,0x80,0x2a,0x0c,0x30,
-0xa4,0x02,0xa0,0x2a,0xb6,0x92,0x05,0x70,0x40,0x06,0x30,0x00,0x16,0x00,0x94,0xf9,
-0x0d,0xf2,0x1b,0xdc,0xcc,0xd9,0x00,0x84,0x00,0x03,0x90,0x06,0xbb,0xbb,0xb6,0x01,
-0x89,0x20,0x03,0x80,0x0c,0x53,0xd0,0x04,0x90,0x2a,0x00,0x84,0x04,0x90,0x3a,0x00,
-0x65,0x04,0x80,0x0d,0x00,0xa2,0x04,0x80,0x05,0xcc,0x70,0x04,0x80,0xab,0x4b,0x30,
-0x06,0x10,0x16,0xfa,0x06,0xf2,0x02,0x49,0x00,0x00,0x1e,0x80,0xad,0x00,0x00,0xa3,
-0xa9,0xa4,0xc0,0x02,0x70,0x0a,0x00,0x44,0x41,0x30,0x40,0xbc,0xcd,0x00,0xd0,0x1e,
-0x18,0x11,0x0d,0xb6,0x11,0x00,0xe7,0x27,0x00,0xa2,0x18,0x20,0x05,0xf1,0x2b,0x47,
-0x10,0xc7,0x7c,0x1b,0xbc,0x86,0x0c,0x20,0xc0,0x00,0x3a,0x00,0x3a,0x0c,0x00,0x01,
-0xa2,0x18,0x10,0x15,0x63,0x27,0x30,0x01,0x66,0x7d,0x16,0x00,0x40,0x08,0x60,0x0c,
-0x10,0x71,0x54,0x90,0xcc,0xc1,0x01,0xdb,0x60,0x0c,0x10,0x01,0xc4,0x5a,0x18,0x30,
-0x64,0x00,0x04,0xf7,0x17,0x53,0x34,0x44,0x40,0x00,0x02,0x60,0x36,0x0d,0x01,0x31,
-0x00,0xaf,0x47,0x30,0xbf,0x00,0xc0,0x07,0x0b,0x00,0xad,0x0c,0x01,0xae,0x24,0xd5,
-0xcc,0x40,0x0c,0xcb,0x10,0xb6,0x1c,0x20,0xc0,0x00,0x75,0x00,0x27,0xb8,0x0c,0x1b,
-0xc0,0xd8,0x0e,0x10,0x0a,0xa5,0x27,0x40,0x1b,0xbb,0xb0,0x0a,0x2b,0x24,0x00,0x13,
-0x00,0x20,0x0b,0x50,0x68,0x19,0xd0,0xf1,0x00,0xcc,0xc2,0x04,0xb5,0xb0,0x0c,0x00,
-0x05,0xb0,0x05,0x90,0xc8,0x07,0x03,0x5a,0x46,0x04,0x9e,0x21,0x16,0x0d,0x96,0x0e,
-0x01,0x6d,0x47,0x01,0xbb,0x38,0x30,0x02,0x99,0x9f,0x42,0x00,0x20,0x06,0x80,0xa6,
-0x3d,0x00,0xc6,0x00,0x20,0x00,0xca,0x0b,0x00,0x30,0xc5,0x0a,0x50,0xdf,0x1a,0x20,
-0x04,0x0c,0x79,0x4b,0x71,0x86,0x10,0x00,0x00,0x4c,0x32,0x6c,0x5d,0x14,0x20,0xa3,
-0x00,0x53,0x3f,0x10,0x20,0x0a,0x0d,0x19,0x60,0x9c,0x18,0xd1,0x12,0x00,0x90,0xa0,
-0x0a,0xbc,0x80,0xc0,0xb1,0x00,0x08,0x50,0xc0,0x3d,0x22,0xfd,0x09,0xb1,0x00,0x3a,
-0x00,0xda,0xe1,0x00,0xad,0x00,0xc1,0xb1,0x02,0xb8,0x50,0xc0,0xb1,0x0b,0x31,0xc0,
-0xc0,0xb1,0x38,0x00,0x83,0x3b,0x1f,0xf0,0x02,0x03,0x34,0x10,0x80,0x91,0x28,0x7b,
-0x80,0xd0,0xb2,0x00,0x0d,0x20,0xc0,0xa2,0x00,0x7b,0x60,0x18,0x20,0xca,0x40,0xcf,
-0x15,0x6f,0xc2,0xc0,0xa2,0x63,0x00,0x13,0xc7,0x20,0x09,0xf3,0x19,0x22,0x30,0x00,
-0x80,0x89,0x9d,0x40,0x1a,0x00,0x00,0xc1,0x01,0xa0,0x00,0x2b,0x00,0x1a,0x00,0x08,
-0x64,0xbb,0xa0,0x01,0xe9,0x01,0x2b,0x00,0x95,0xc1,0x01,0xb0,0x3b,0x05,0x80,0x0b,
-0x0b,0x10,0x0b,0x00,0xb0,0x8c,0x0b,0x11,0x01,0xf1,0x0f,0xf9,0x19,0x04,0x56,0x60,
-0x00,0xa0,0x66,0x5e,0x20,0x0c,0x00,0x04,0xa0,0x00,0xd0,0x00,0xd2,0x2b,0xbc,0x00,
-0xac,0x80,0x01,0xc0,0x89,0x0a,0x50,0x0c,0x58,0x00,0x08,0x00,0xc0,0x01,0x23,0x33,
-0x32,0x00,0x79,0x99,0x9a,0x88,0x12,0x81,0x18,0x01,0x33,0x31,0x00,0xa0,0x06,0x88,
-0x2d,0x0f,0x10,0xd1,0x32,0x1a,0xf0,0x00,0x70,0x77,0xd0,0x00,0x3e,0x80,0x44,0xc0,
-0x02,0xd2,0xb4,0x00,0xc0,0x1c,0x30,0xb9,0x06,0x01,0xb2,0x01,0x1e,0x19,0x83,0x12,
-0xf3,0x0d,0x2a,0xbb,0xa0,0x09,0x20,0x00,0x3a,0x00,0xa3,0x00,0x0c,0x26,0xad,0x30,
-0x09,0xe3,0x02,0xb2,0x08,0x92,0xc1,0x0a,0x27,0x80,0x03,0x80,0xa2,0x00,0xba,0x45,
-0x11,0xe1,0x31,0x09,0x10,0x0c,0xd8,0x17,0x04,0x83,0x12,0x10,0x01,0xf1,0x2b,0xf0,
-0x19,0x99,0x9f,0x10,0xa2,0x00,0x06,0xa0,0x0a,0x20,0x02,0xf1,0x2c,0xe2,0x01,0xd9,
-0x90,0x0a,0x22,0xc3,0x09,0x60,0xa2,0x62,0x00,0x05,0x09,0x10,0x06,0xaa,0xaa,0x90,
-0x00,0xc4,0x22,0x2c,0x10,0x0c,0x10,0x00,0xb1,0x81,0x15,0xe0,0x10,0x07,0xbb,0xbb,
-0xa0,0x18,0x99,0x90,0x06,0x30,0x22,0x3e,0x00,0x85,0xf7,0x48,0xf0,0x05,0x50,0x03,
-0xf1,0x3c,0xe5,0x01,0xd8,0xa0,0x08,0x42,0xc3,0x07,0x80,0x84,0x52,0x00,0x02,0x04,
-0x20,0x08,0xb5,0x28,0xf0,0x2a,0xc1,0x00,0x08,0x30,0x0c,0xdc,0xcc,0xe3,0x00,0xb1,
-0x00,0x09,0x30,0x09,0xbb,0xbb,0xc1,0x01,0x22,0x20,0x06,0x12,0x99,0x9e,0x00,0xa3,
-0x00,0x06,0x60,0x0a,0x30,0x01,0xe0,0x7c,0xe3,0x00,0xca,0x70,0x0a,0x30,0xc5,0x0b,
-0x40,0xa3,0x74,0x00,0x04,0x0a,0x20,0x00,0x27,0x86,0x20,0x00,0x3c,0x42,0x6c,0x06,
-0x02,0x32,0xb2,0x00,0x77,0x41,0x2f,0x14,0x50,0x21,0x46,0xa0,0x80,0xa0,0x1b,0xce,
-0x40,0xc0,0xc0,0x00,0x0b,0x20,0x8d,0x30,0x00,0x44,0x18,0x10,0x58,0x26,0x46,0xf5,
-0x03,0xcb,0x00,0xc0,0xc0,0x04,0xaa,0x20,0xc0,0xc0,0x0c,0x23,0xa0,0xc0,0xc0,0x57,
-0x00,0xa1,0xc0,0x1c,0x46,0x02,0x99,0x1a,0x11,0x70,0x26,0x46,0x52,0x4b,0xbe,0x50,
-0xc0,0xd0,0xa3,0x1d,0xf0,0x03,0x9a,0x4b,0xe0,0xc0,0x05,0xab,0x40,0xc0,0xc0,0x3c,
-0x01,0xc1,0xc0,0xd0,0x61,0x00,0x11,0x80,0x23,0x03,0x60,0x40,0x30,0x00,0x00,0x0c,
-0x40,0xa4,0x06,0x70,0xd2,0x00,0x00,0x06,0xc0,0x2c,0x40,0xee,0x04,0x18,0x91,0xfd,
-0x01,0xf4,0x04,0x23,0xa0,0x00,0x2b,0x19,0xaa,0x00,0x08,0x50,0x01,0xb0,0x01,0xe9,
-0x02,0x3b,0x00,0x95,0xc2,0x89,0xfd,0x01,0x05,0x9b,0x19,0x22,0x01,0xa0,0x04,0x10,
-0x02,0x2a,0x37,0x10,0xe7,0x0d,0x00,0x10,0xd0,0xc2,0x4f,0xf6,0x02,0x20,0x00,0x00,
-0x07,0xdb,0x90,0x00,0x02,0xb9,0x00,0x6c,0x20,0x03,0x10,0x34,0x01,0x30,0xb3,0x44,
-0x02,0x37,0x07,0x11,0x8b,0x69,0x1e,0xf7,0x03,0x07,0xd2,0x00,0x00,0x02,0xbf,0x40,
-0x00,0x02,0xac,0x43,0xba,0x20,0x03,0x20,0x55,0x02,0x20,0xa7,0x0c,0x08,0x85,0x17,
-0x05,0x70,0x30,0x00,0x85,0x17,0x10,0x7a,0xde,0x37,0xff,0x03,0x01,0x16,0xe3,0x00,
-0x00,0x01,0x9f,0x40,0x00,0x01,0x8c,0x53,0xc9,0x10,0x03,0x40,0x44,0x03,0x85,0x17,
-0x12,0x02,0x78,0x00,0x10,0x06,0x78,0x00,0xf4,0x08,0xaf,0x70,0x00,0x01,0xac,0x41,
-0x9c,0x30,0x01,0x20,0x39,0x01,0x20,0x24,0x44,0x7b,0x44,0x42,0x46,0x66,0x66,0x67,
-0x74,0x6f,0x3d,0x1c,0x7a,0x6f,0x3d,0x02,0x88,0x1d,0x40,0xbc,0xbe,0x50,0xc0,0x5d,
-0x04,0x00,0xc8,0x03,0x10,0xc6,0x05,0x03,0xe0,0xba,0xc0,0x0b,0x00,0x00,0xb7,0x06,
-0x90,0xbc,0xc1,0x44,0x06,0x05,0x0b,0x73,0x38,0x00,0x8d,0x13,0x87,0x0d,0x02,0x3b,
-0x10,0x09,0xbb,0xbb,0x96,0x27,0x35,0x13,0x70,0x92,0x1f,0x20,0x11,0x13,0xb6,0x4d,
-0x10,0x2d,0x09,0x51,0x10,0xdc,0x23,0x01,0x30,0x10,0x6c,0x30,0xf8,0x00,0x06,0x0d,
-0x30,0x07,0xe0,0x45,0x03,0x05,0x00,0x20,0x45,0x00,0x3c,0x00,0x14,0xa6,0xf6,0x00,
-0x10,0xaf,0xf6,0x00,0x7f,0x54,0xc9,0x10,0x04,0x30,0x00,0x04,0x8c,0x17,0x04,0x19,
-0x04,0x8c,0x17,0x02,0xf6,0x00,0xe0,0x08,0xc2,0x00,0x00,0x04,0xce,0x60,0x00,0x03,
-0xc9,0x11,0x8c,0x30,0x01,0x61,0x06,0x03,0xa2,0x14,0x10,0x57,0x6a,0x01,0x81,0x9a,
-0x30,0x00,0x00,0x5a,0x43,0x7a,0x00,0xf5,0x02,0x00,0xa5,0x12,0x30,0x10,0x00,0x1b,
-0x0a,0x35,0x06,0xaa,0x01,0x70,0x03,0xcf,0x40,0x00,0x02,0xab,0x32,0xaa,0x01,0x34,
-0x00,0x02,0x20,0xa2,0x38,0x06,0x32,0x20,0x0e,0xaa,0x01,0x30,0x8b,0xbb,0xc9,0xe7,
-0x03,0xc4,0xc1,0x00,0x00,0x28,0xcc,0x81,0x00,0x08,0xa4,0x00,0x4a,0x50,0x69,0x20,
-0x25,0xcc,0xc6,0x8c,0x17,0x05,0x8b,0x09,0x27,0xcc,0x10,0x8b,0x09,0x06,0xb4,0x00,
-0x72,0x05,0xce,0x60,0x00,0x04,0xc9,0x10,0xb4,0x00,0x42,0x00,0x6a,0xaa,0xaa,0x51,
-0x32,0x1f,0x21,0x19,0x3f,0x06,0x81,0x01,0x12,0x30,0x01,0x80,0x8a,0x9d,0x30,0x07,
-0x16,0x50,0xb0,0x00,0x2b,0x00,0x1b,0x47,0x4c,0xf8,0x04,0xb0,0x02,0xe8,0x00,0x1b,
-0x00,0xa4,0xd1,0x01,0xb0,0x4a,0x05,0x90,0x1b,0x0b,0x00,0x09,0x11,0xb0,0x21,0x08,
-0xf3,0x1b,0x05,0x15,0x56,0x50,0x08,0x31,0x66,0x7d,0x00,0x94,0x00,0x09,0x60,0x09,
-0x40,0x03,0xe0,0x00,0x94,0x02,0xda,0x70,0x09,0x42,0xc3,0x0b,0x40,0x94,0x62,0x00,
-0x04,0x09,0x30,0x01,0x22,0x22,0x20,0x00,0xaa,0xaa,0xae,0x20,0x5e,0x4b,0x01,0xe5,
-0x00,0x80,0x81,0x02,0x33,0x30,0x0a,0x02,0x88,0x8e,0x42,0x1d,0x22,0x70,0x0c,0x75,
-0x06,0xb3,0xbd,0x40,0x0c,0x00,0xa7,0x1c,0x10,0xc0,0x86,0x00,0x37,0xda,0x10,0x18,
-0x82,0x96,0x4b,0xb0,0x07,0xcc,0xcc,0xc2,0x01,0x22,0x10,0x09,0x03,0x99,0xad,0x34,
-0x04,0xf6,0x0e,0x50,0x0b,0x10,0x04,0xe0,0x00,0xb1,0x03,0xd8,0x80,0x0b,0x13,0xc2,
-0x0a,0x50,0xc1,0x51,0x00,0x02,0x08,0x00,0x07,0x99,0x9a,0x90,0x00,0xd3,0x22,0x2d,
-0x1c,0x0b,0xf0,0x15,0x07,0xbb,0xbb,0x90,0x01,0x22,0x20,0x07,0x32,0x99,0xae,0x00,
-0x85,0x00,0x07,0x70,0x08,0x50,0x03,0xe0,0x00,0x85,0x02,0xd9,0x80,0x08,0x52,0xc3,
-0x0a,0x50,0x84,0x62,0x00,0x04,0x04,0x20,0x3c,0x2d,0x00,0x46,0x05,0x50,0x30,0x0d,
-0xcc,0xcc,0xe3,0xe5,0x06,0x13,0x30,0x3a,0x2d,0xd0,0x02,0x70,0x02,0xce,0x6b,0xe3,
-0x2a,0x00,0x00,0xb2,0x0b,0x22,0xa0,0xc8,0x4e,0xf6,0x13,0x2a,0x00,0x01,0xc0,0x1b,
-0x02,0xb1,0x00,0x6d,0x06,0xd0,0x2e,0xb6,0x0b,0xc3,0xbd,0x22,0xa0,0x01,0xc4,0xac,
-0x58,0x2a,0x00,0x75,0x0d,0x50,0xc2,0xa0,0x02,0x00,0x10,0x01,0x2a,0x92,0x41,0x13,
-0x19,0x57,0x27,0xf0,0x1c,0x11,0x20,0x81,0xa0,0x39,0xd7,0xc3,0xa1,0xb1,0x01,0xb0,
-0x81,0xa1,0xb1,0x04,0x90,0xa0,0xa1,0xb1,0x07,0x60,0xb0,0xab,0xe1,0x0a,0x92,0xf1,
-0xa2,0xb1,0x0c,0xc6,0xb5,0xa1,0xb1,0x47,0x9d,0x2a,0xa1,0xb1,0x91,0x39,0x09,0xa1,
-0xf6,0x02,0x06,0x05,0x00,0xf7,0x20,0x30,0x60,0x03,0x31,0x31,0x16,0x37,0x28,0xd4,
-0xa8,0x29,0x48,0x02,0xa0,0x85,0x29,0x48,0x06,0x80,0xc3,0x2e,0xc8,0x0c,0xc2,0xc9,
-0x2a,0x38,0x48,0x7d,0x3a,0x4a,0x38,0x51,0x06,0x02,0x37,0x37,0x00,0x03,0x44,0x44,
-0x40,0x00,0x18,0x88,0x87,0xb6,0xb1,0x10,0x00,0x82,0x1a,0xf0,0x08,0x05,0xab,0x68,
-0xbb,0x00,0x00,0x0b,0x40,0x59,0x00,0x00,0x5e,0x01,0xe3,0x00,0x03,0xc5,0xbb,0x4c,
-0x20,0x05,0x00,0x86,0x53,0x04,0x1c,0x85,0xb0,0x1b,0x1b,0x20,0x81,0x02,0xfe,0x10,
-0x09,0x94,0x98,0x00,0x90,0x2c,0x22,0xd0,0x0d,0x00,0xd0,0x3a,0x00,0xc0,0x4f,0x08,
-0xc0,0x0c,0x0b,0xa6,0xca,0x20,0xd3,0xa1,0xe6,0x39,0x0d,0x31,0x05,0x00,0x10,0x19,
-0x4c,0x05,0xa9,0x0a,0x03,0x01,0x00,0x20,0x88,0x72,0xe3,0x03,0x90,0x22,0x00,0x0d,
-0x00,0x05,0xcc,0xcf,0x00,0xd0,0xbb,0x34,0x00,0x28,0x00,0x10,0x95,0x0b,0x00,0x10,
-0x2e,0xd4,0x40,0x20,0x0c,0xc4,0x68,0x01,0x81,0x61,0xc0,0x0c,0x00,0x06,0x80,0x06,
-0x70,0x00,0x26,0x07,0x47,0x3a,0x14,0x07,0x48,0x00,0xd1,0x6b,0xa2,0x00,0xc0,0x00,
-0x16,0x67,0x60,0x0d,0x00,0x01,0x55,0x6d,0x32,0x46,0x60,0x40,0x0d,0xcb,0x00,0x0a,
-0xd6,0xd6,0x10,0x90,0x80,0xb5,0x0d,0x00,0x05,0x50,0x00,0x40,0xc0,0xeb,0x3a,0x41,
-0x21,0x00,0x00,0x0e,0x68,0x52,0x07,0x8c,0x4f,0x35,0x9b,0xbb,0xb9,0x48,0x00,0x30,
-0xb3,0x00,0xb0,0x48,0x00,0x11,0x0c,0x48,0x00,0x40,0xc1,0x10,0x00,0x0c,0xe0,0x08,
-0x20,0x0a,0xd6,0xe6,0x14,0x90,0x70,0xa6,0x0c,0x00,0x05,0x40,0x00,0x40,0x80,0x78,
-0x00,0x10,0x51,0xcb,0x39,0x00,0x56,0x08,0xd5,0x6e,0x11,0xf6,0x00,0x00,0x1c,0x4c,
-0xa5,0xb5,0x00,0x07,0x30,0x57,0x3d,0x39,0x20,0x6b,0xb3,0x75,0x09,0x90,0x66,0x60,
-0x0b,0x10,0x01,0x66,0x7e,0x00,0xb1,0xf1,0x08,0x50,0x0b,0xcc,0x10,0x0a,0xd6,0x00,
-0x2a,0x40,0x70,0xa6,0x0b,0x10,0x90,0x00,0x13,0x60,0x1f,0x2d,0x30,0x00,0x11,0x2c,
-0x99,0x08,0x00,0xfe,0x54,0x93,0x04,0xb9,0x6d,0x60,0x00,0x02,0x81,0x00,0x06,0xaa,
-0x08,0xc1,0x04,0xa8,0x10,0x90,0xb0,0x00,0x23,0x00,0xc0,0xc0,0x0a,0xbc,0x46,0x4f,
-0x14,0x70,0x46,0x4f,0x10,0x3e,0x46,0x4f,0xdd,0xcb,0x40,0xc0,0xc0,0x07,0x81,0xb0,
-0xc0,0xc0,0x2b,0x00,0x83,0xc0,0x46,0x4f,0x00,0x81,0x04,0xd0,0x02,0xbb,0x70,0x00,
-0xc0,0x06,0x77,0x83,0x00,0xc0,0x03,0x33,0xc4,0x98,0x16,0x50,0xa0,0xbb,0xc0,0x00,
-0x8b,0x62,0x2c,0x71,0x80,0x3c,0x00,0xc0,0x23,0x00,0x02,0x11,0x0a,0x60,0x20,0x70,
-0x00,0x00,0x1e,0x30,0xca,0x54,0x71,0xd3,0x00,0x00,0x1b,0x70,0x1c,0x50,0x1e,0x33,
-0x02,0x75,0x06,0xf0,0x17,0xa1,0x00,0x92,0x27,0x77,0x70,0x0a,0x31,0x33,0x5c,0x00,
-0xa3,0x00,0x1d,0x27,0xce,0x30,0x1c,0xb7,0x00,0xa3,0x3c,0x30,0xa5,0x0a,0x35,0x10,
-0x00,0x30,0xa2,0x00,0x02,0x78,0x62,0x00,0x03,0xc4,0x26,0x23,0x0f,0x40,0x0b,0x20,
-0x07,0x70,0x70,0x01,0x03,0x06,0x1c,0xe0,0x04,0x97,0x10,0x70,0xa0,0x00,0x23,0x00,
-0xb0,0xc0,0x0a,0xcc,0xa0,0xb0,0xbf,0x03,0xf0,0x0b,0xb0,0xc0,0x00,0x0c,0x23,0xc0,
-0xc0,0x00,0x3e,0x29,0xd1,0xc0,0x00,0xbc,0x40,0xb1,0xc0,0x06,0x92,0xb0,0xa1,0xc0,
-0x1c,0x00,0x93,0xa1,0x86,0x08,0x01,0xbb,0x60,0x13,0xa1,0xe3,0x4e,0x34,0x0b,0xba,
-0x40,0xe5,0x12,0x20,0xcb,0xf4,0xa7,0x04,0x13,0xa0,0x5f,0x1d,0x98,0x3c,0x77,0xd4,
-0x00,0x07,0x92,0x11,0x19,0x40,0x75,0x13,0x13,0xdc,0xa3,0x02,0x40,0x2b,0xb5,0x00,
-0x0a,0x9d,0x2f,0xff,0x07,0xc0,0x89,0x9e,0x40,0x0c,0x00,0x04,0xb0,0x00,0xc0,0x03,
-0xda,0x00,0x0c,0x03,0xc1,0x97,0x00,0xc0,0xa1,0x50,0x81,0x25,0x12,0x06,0x71,0x06,
-0x65,0x10,0x00,0x00,0x02,0x55,0x23,0x0a,0x10,0xc5,0xaa,0x04,0x00,0x82,0x12,0x80,
-0x8f,0x30,0x00,0x01,0x7c,0x65,0xd7,0x00,0x54,0x19,0x15,0x40,0x3b,0x06,0x11,0xb8,
-0x15,0x03,0x08,0x05,0x00,0x10,0x52,0x31,0x00,0x10,0x54,0x41,0x00,0x20,0x56,0x20,
-0x4b,0x02,0x13,0xca,0xcd,0x05,0x93,0x06,0xde,0x70,0x00,0x06,0xc7,0x10,0x7c,0x40,
-0xab,0x1a,0x01,0x9e,0x27,0x10,0x58,0x7d,0x05,0x17,0xcd,0xf7,0x1e,0x10,0x40,0x2e,
-0x00,0x40,0x30,0x00,0x04,0x43,0x53,0x09,0x24,0x67,0x30,0x8c,0x02,0xe0,0x06,0xd3,
-0x00,0x00,0x04,0xcf,0x40,0x00,0x05,0xb9,0x22,0xab,0x20,0x02,0x8d,0x4a,0x03,0xb3,
-0x07,0x10,0x2a,0x8c,0x16,0x10,0x2a,0x7c,0x02,0x0a,0x81,0x06,0x20,0x03,0x64,0xc6,
-0x53,0x20,0x56,0x30,0x61,0x3e,0x10,0xc9,0x54,0x00,0xf2,0x02,0xc2,0x00,0x00,0x5a,
-0xb8,0xb8,0x30,0x01,0x51,0x00,0x03,0x40,0x2b,0xbb,0xbb,0xbb,0xb6,0x81,0x03,0x41,
-0x9c,0xcf,0xcc,0x10,0x38,0x1c,0x48,0x00,0xab,0xbc,0xce,0x0e,0x06,0x0e,0xc3,0x00,
-0x00,0x18,0x06,0x62,0x70,0x00,0x06,0xc8,0x11,0x8c,0x55,0x0e,0x07,0x1a,0x4d,0x33,
-0x2a,0xbb,0xb4,0x0e,0x06,0x15,0xc2,0xbd,0x07,0xfb,0x18,0x43,0x20,0x00,0x10,0x05,
-0x77,0x00,0x0b,0x06,0xaa,0xa6,0x00,0xc0,0x01,0x1c,0x50,0x0c,0x00,0x0b,0xe0,0x00,
-0xc0,0x2c,0x55,0xb1,0x0c,0x09,0x20,0x02,0x10,0xc0,0x11,0x12,0x45,0x0c,0x3a,0xae,
-0x21,0x00,0x92,0x10,0x10,0x07,0x9d,0x0c,0x0c,0x7c,0x00,0x00,0x94,0x06,0x94,0x17,
-0xde,0x80,0x00,0x07,0xb6,0x00,0x6c,0x40,0x0b,0x10,0x16,0xcb,0x07,0x07,0x0b,0x21,
-0x39,0xf8,0x1c,0x20,0x01,0xa8,0x70,0x01,0x80,0x00,0x22,0x00,0x1b,0x0a,0xcc,0xda,
-0x01,0xb0,0x00,0x08,0x60,0x1b,0x00,0x00,0xd1,0x01,0xb0,0x00,0x99,0x00,0x1b,0x00,
-0x4c,0xd1,0x01,0xb0,0x2c,0x15,0xa0,0x1b,0x0c,0x20,0x09,0x41,0xb0,0x10,0x8f,0x06,
-0x20,0x03,0x21,0x03,0x31,0xa0,0x92,0x00,0x93,0x39,0xaa,0xa0,0x09,0x40,0x11,0x4c,
-0x1f,0x10,0xf8,0x01,0x30,0x09,0x40,0x1c,0xa8,0x00,0x94,0x3c,0x30,0xa6,0x09,0x45,
-0x10,0x00,0x30,0x93,0xdf,0x02,0x65,0x0a,0x30,0x07,0x70,0x00,0xd1,0xdf,0x02,0x01,
-0x10,0x0d,0x31,0x03,0xbb,0xbe,0x28,0x53,0x32,0xb2,0x0d,0x00,0xcb,0x38,0x50,0x6c,
-0xcd,0x70,0x0c,0x11,0x6c,0x0b,0x21,0xcb,0xb2,0xc9,0x4b,0x20,0x00,0x5a,0xea,0x00,
-0x22,0x4b,0x00,0x7b,0x12,0x0b,0x36,0x26,0x12,0x00,0x66,0x58,0x70,0x90,0xa1,0x1a,
-0xaa,0xf0,0xc0,0xa1,0x03,0x3d,0x10,0xa1,0x2d,0x53,0x50,0xa1,0x4b,0xbe,0x40,0xc8,
-0x1a,0x14,0x60,0xc3,0xb1,0x00,0x95,0x00,0xb0,0xab,0x53,0x70,0xb0,0xa1,0x2c,0x00,
-0x00,0xb0,0xa1,0xea,0x0f,0x01,0x64,0x22,0x13,0xa2,0xe2,0x03,0x41,0x11,0x00,0xa0,
-0x8b,0x12,0x4e,0x12,0x1b,0x42,0x4c,0x90,0x0a,0xbb,0xf3,0x77,0xd0,0x00,0x78,0x15,
-0x5d,0x72,0x10,0x7c,0xd0,0x1c,0x20,0x00,0x0c,0x0b,0x30,0xd7,0x19,0x00,0xdd,0x01,
-0x30,0x04,0xbb,0xbf,0xd5,0x4f,0xf3,0x02,0xd0,0x0a,0x15,0x99,0xd7,0x8a,0xe1,0x00,
-0x4d,0x01,0x2b,0x10,0x6c,0x10,0x00,0xa1,0x78,0x81,0x37,0x1e,0xa1,0xe7,0x52,0xf0,
-0x07,0x19,0xaa,0xa1,0x09,0x20,0x11,0x1c,0x00,0xa2,0x17,0x77,0xa0,0x0a,0x21,0x55,
-0xe2,0x5b,0xe2,0x00,0xa5,0x00,0x0a,0xb5,0x11,0x20,0xa2,0x11,0x0e,0x0c,0x11,0x09,
-0xb6,0x0d,0x00,0x69,0x4b,0x52,0xdc,0xcc,0xc0,0x00,0xd1,0xcc,0x1c,0xf0,0x08,0xc3,
-0x38,0x99,0x90,0x09,0x11,0x22,0x2e,0x00,0xa2,0x13,0x34,0xc0,0x0a,0x26,0x99,0xe5,
-0x9c,0xe2,0x00,0x7a,0x00,0x0a,0xae,0x4c,0x3f,0xa2,0x63,0x00,0x1d,0x53,0x07,0xf0,
-0x06,0x12,0x20,0x00,0x70,0x08,0x99,0xb8,0x00,0xc0,0x01,0x22,0xa4,0x00,0xc0,0x07,
-0x8a,0xc0,0xbc,0xc0,0x00,0x1c,0x88,0x16,0x00,0xb5,0x12,0x50,0x1a,0x10,0x01,0x00,
-0xc0,0xfc,0x01,0x50,0x90,0x00,0x00,0x0f,0x10,0xf0,0x56,0x92,0xc1,0x00,0x00,0x09,
-0x90,0x3c,0x20,0x00,0x86,0xce,0x10,0x02,0xde,0x0b,0xf0,0x0a,0xb0,0x4b,0xbc,0xa0,
-0xa1,0xc0,0x00,0x05,0x80,0xb1,0xc0,0x00,0x08,0x50,0xb1,0xc0,0x6b,0xbe,0x59,0xd1,
-0xc0,0x00,0x49,0x13,0xb1,0x84,0x24,0x10,0xb1,0x5e,0x53,0x30,0xa1,0xc0,0x4a,0x71,
-0x04,0x19,0x30,0x7b,0x04,0x17,0x80,0x55,0x01,0x10,0x2b,0x55,0x01,0xf1,0x01,0x7b,
-0xcc,0x0a,0xbb,0xe0,0x00,0xc0,0x00,0x77,0x00,0x0c,0x00,0x2c,0x06,0xcc,0xc0,0x55,
-0x01,0x1c,0x20,0x55,0x01,0xf2,0x09,0x02,0x33,0x30,0x07,0x14,0x88,0x8f,0x10,0xa2,
-0x00,0x02,0xc7,0xce,0x26,0xaa,0xe6,0x00,0xa2,0x00,0x7a,0x0b,0xce,0x21,0x99,0xe9,
-0x00,0x2f,0x07,0x10,0xe9,0x00,0x04,0x03,0x7e,0x12,0x12,0xcd,0xf0,0x0e,0x40,0x01,
-0xaa,0xaa,0xae,0xa4,0x06,0x10,0x1d,0x6f,0x03,0x10,0x0d,0xeb,0x0f,0x1d,0x0a,0x70,
-0x52,0x08,0x72,0x3a,0x10,0xbe,0x0d,0x04,0x01,0xfd,0x32,0x17,0x02,0x87,0x39,0x33,
-0x01,0xcd,0xdc,0x22,0x03,0x40,0x01,0xed,0xdd,0xdc,0x77,0x3a,0x05,0x7d,0x13,0x02,
-0x40,0x03,0x17,0xdc,0xb2,0x4e,0x00,0x88,0x2a,0x08,0x72,0x51,0x00,0x6d,0x0c,0x01,
-0x9c,0x12,0x00,0x4f,0x3a,0x19,0xa7,0x02,0x3c,0x15,0xcf,0x28,0x00,0x11,0x03,0xc6,
-0x42,0x1c,0xb6,0x90,0x03,0x0b,0xac,0x43,0x06,0x1a,0x53,0x37,0xbb,0xbb,0xce,0x74,
-0x50,0x07,0x39,0x43,0xaa,0x99,0x99,0xa9,0x00,0x02,0xc2,0x22,0x2b,0x20,0x02,0x56,
-0x4d,0x0d,0xd9,0x02,0xa4,0x0d,0x0a,0xbb,0xf1,0x00,0xd0,0x00,0x78,0x00,0x0d,0xd9,
-0x02,0x1e,0x0d,0xd9,0x02,0x81,0x01,0x11,0x10,0x08,0x11,0xaa,0xae,0x20,0x8a,0x55,
-0xf0,0x00,0x32,0xbb,0xe8,0x00,0xa2,0x00,0x4c,0x00,0x0a,0x20,0x6b,0x00,0x00,0xb2,
-0x26,0xd8,0x00,0x05,0xa3,0x02,0x45,0x0c,0xdc,0xcc,0xb0,0xa3,0x02,0x03,0x51,0x49,
-0x36,0xcc,0x40,0xc0,0xcd,0x48,0x93,0xc0,0x00,0x0f,0xcc,0xb4,0x0c,0xcc,0x20,0xd0,
-0xf7,0x17,0x01,0x91,0x17,0x6d,0x20,0xc0,0x00,0x0b,0xcb,0x96,0xfe,0x29,0xc0,0x70,
-0x00,0x0a,0xbb,0xb4,0x09,0x00,0x00,0xd1,0x10,0x00,0xb1,0x06,0x1e,0x70,0x0b,0x10,
-0x00,0xfb,0xba,0x40,0xbc,0x9c,0x3f,0x00,0x62,0x3c,0x33,0xbb,0xb0,0xb1,0xc7,0x1d,
-0x12,0x09,0xc8,0x1a,0x00,0x16,0x00,0x46,0x09,0xcc,0xdd,0xd0,0x34,0x32,0x13,0xc3,
-0x3a,0x20,0x41,0xab,0xbb,0x40,0xd0,0x74,0x2a,0x03,0x4a,0x1f,0x52,0x0f,0xcc,0xc5,
-0x0d,0xdc,0xd5,0x49,0x30,0x0e,0xaa,0xbd,0xd4,0x1e,0x24,0x12,0x10,0x60,0x08,0x43,
-0x0c,0xdc,0xcc,0xe0,0x5f,0x1a,0x02,0x3f,0x4f,0x35,0xac,0xcb,0xba,0x54,0x41,0x47,
-0x90,0x91,0xe8,0x87,0x8d,0x4d,0x91,0x2e,0xcc,0xa0,0xc9,0xd2,0xd0,0x00,0x0c,0x2b,
-0x12,0x00,0x7a,0xd2,0x35,0x1c,0x0a,0x27,0x98,0x71,0xbe,0x4c,0xc2,0x05,0x10,0x56,
-0x65,0x08,0x09,0x1d,0x55,0x40,0xd0,0xa2,0xc0,0x32,0x00,0x21,0xcc,0xe2,0x79,0x48,
-0x63,0x45,0x72,0xd0,0xa2,0x56,0x64,0x79,0x48,0x1d,0x02,0x79,0x48,0xf0,0x12,0x89,
-0x99,0x08,0x08,0x3d,0x22,0x10,0xd0,0x94,0xc0,0x00,0x0d,0x08,0x4e,0xcc,0xa0,0xdc,
-0xe4,0xd0,0x00,0x0d,0x08,0x4d,0xab,0xc3,0xd0,0x94,0x01,0x00,0x05,0x04,0x10,0x04,
-0xb9,0x13,0x00,0x6b,0x3d,0x10,0x0e,0xa0,0x4d,0x00,0x09,0x00,0xc0,0x0b,0xbb,0xbb,
-0xc0,0x12,0x22,0x10,0x09,0xda,0xaa,0x50,0x0b,0x08,0x12,0x00,0x04,0x00,0x80,0xdb,
-0xba,0x29,0xab,0xd1,0x10,0x02,0x2c,0xb7,0x09,0x72,0xd1,0x11,0x31,0x0c,0x7b,0xaa,
-0x81,0x86,0x1f,0x02,0x04,0x00,0xb1,0x06,0x04,0x55,0x52,0x00,0xa0,0x0e,0x66,0x62,
-0x00,0xd0,0x5c,0x41,0x42,0x0f,0xcc,0xb2,0xac,0x0a,0x00,0x84,0x0d,0x44,0x57,0x20,
-0xc0,0x06,0x77,0x65,0x5a,0x14,0x10,0x29,0x8f,0x01,0x0a,0x9e,0x28,0x81,0x0a,0xbb,
-0xb4,0x00,0xc0,0x0d,0x11,0x00,0x3c,0x00,0x62,0x11,0xd0,0x0f,0xcc,0xb2,0xaa,0x3c,
-0x00,0x43,0x0c,0xcb,0xee,0x20,0x6d,0x30,0x2e,0x4c,0xcc,0xe7,0x3f,0x40,0x4d,0xcc,
-0xcc,0xc1,0x3c,0x00,0x30,0xa0,0xd1,0x10,0x5a,0x35,0x71,0x00,0x44,0xd0,0xfc,0xcb,
-0x27,0x8d,0x3a,0x00,0x31,0xdb,0xbd,0xe2,0x44,0x50,0x0f,0xaf,0x41,0x04,0x00,0x5a,
-0x38,0x70,0x19,0x0e,0x99,0x60,0xc0,0x2a,0x0d,0x2d,0x0e,0x00,0xc6,0x42,0x93,0x2a,
-0x0f,0xbb,0x5a,0xe0,0x2a,0x0d,0x00,0x01,0x0f,0x00,0x82,0x0d,0x01,0x30,0xb0,0x2a,
-0x09,0xba,0x81,0x4b,0x0e,0x14,0x1a,0x05,0x00,0x41,0x40,0x06,0x56,0x64,0x86,0x01,
-0xb3,0xc0,0xa2,0xc0,0x00,0x1c,0x0a,0x2e,0xcc,0x8a,0xe0,0xa2,0x86,0x01,0x1e,0xc0,
-0x86,0x01,0x08,0xff,0x49,0x60,0x07,0x08,0x0d,0xbb,0x80,0xc0,0x91,0x10,0x51,0x0c,
-0x0e,0xcc,0x8c,0xf0,0x09,0x00,0x91,0x0d,0x00,0x20,0xc0,0xc0,0xab,0xba,0x2c,0x0c,
-0x13,0x0a,0x60,0x02,0x60,0x07,0x0a,0x00,0x48,0x8a,0x02,0x13,0x80,0xdd,0x32,0x70,
-0x89,0x97,0x09,0x0a,0x1d,0x22,0x10,0xff,0x49,0x61,0x2d,0x0a,0x2e,0xcc,0x79,0xe0,
-0xff,0x49,0x50,0x2d,0xbb,0xb3,0xc0,0xb2,0x12,0x02,0x00,0x88,0x13,0x02,0xb7,0x0b,
-0x01,0x09,0x00,0x03,0xff,0x49,0x80,0xc2,0x89,0x97,0x06,0x09,0x1d,0x22,0x10,0x5a,
-0x02,0x35,0x1c,0x0a,0x3e,0xa2,0x00,0x71,0x12,0x41,0xc0,0xa2,0x8a,0x97,0x1b,0x3e,
-0x1b,0x10,0x10,0x0f,0x17,0x02,0x5b,0x0b,0x00,0x37,0x0e,0x05,0x27,0x50,0x20,0x00,
-0xeb,0xdc,0x08,0x03,0x09,0x51,0x13,0xc8,0x0a,0x00,0x43,0xd1,0x11,0x24,0x10,0x31,
-0x41,0x13,0x43,0x8f,0x26,0x31,0x9c,0xcc,0xdd,0x35,0x4a,0x14,0xb8,0xb3,0x4d,0x00,
-0x2d,0x00,0x13,0xd0,0x3a,0x4a,0x1e,0x00,0xf5,0x40,0x0c,0x7d,0x47,0x00,0x5d,0x1a,
-0x15,0xc7,0x3c,0x00,0x14,0xc7,0x8f,0x31,0x22,0xdd,0xcb,0x8e,0x1e,0x33,0x8c,0xcc,
-0xcd,0x1c,0x0f,0x20,0x00,0x2b,0xef,0x09,0x11,0xc2,0x7b,0x17,0x00,0x87,0x2a,0x10,
-0x3b,0xdb,0x07,0x10,0x9c,0xd4,0x38,0x12,0xd0,0x9b,0x00,0x65,0x11,0x00,0x00,0xea,
-0xba,0xa8,0x9f,0x1d,0x23,0xbb,0x10,0x89,0x1b,0x01,0xf0,0x41,0x0e,0x29,0x31,0x04,
-0xe6,0x00,0x12,0xb8,0x1b,0x17,0x10,0x01,0xe6,0x00,0x02,0x0a,0x00,0x30,0xc1,0x11,
-0x12,0xe0,0x03,0x1d,0xa9,0xd3,0x3f,0x35,0x9c,0xcc,0xc9,0x3e,0x4b,0x04,0x0a,0x00,
-0x4c,0x9b,0xbb,0xcb,0x10,0xda,0x4e,0x03,0xcf,0x18,0x24,0x08,0x40,0x05,0x00,0x10,
-0x06,0x1b,0x4b,0x13,0xb8,0x7a,0x11,0x01,0x4f,0x01,0x04,0x20,0x4b,0x06,0x1c,0x25,
-0x13,0xc7,0x1c,0x84,0x0a,0xc2,0x48,0x01,0x22,0x01,0x10,0x8c,0x32,0x00,0x01,0x16,
-0x46,0x01,0xb5,0x30,0x88,0xb6,0x55,0x55,0x00,0x00,0x25,0x55,0x54,0xb7,0x52,0x03,
-0x0f,0x40,0x13,0x09,0x17,0x42,0x05,0x6c,0x0a,0x0d,0xbe,0x03,0x71,0xbb,0x60,0x0b,
-0xd1,0x10,0x00,0x0c,0xbe,0x03,0x69,0x12,0x31,0x0c,0x7a,0xa9,0x82,0xbe,0x03,0x00,
-0x46,0x03,0x13,0xb0,0x46,0x03,0x62,0x00,0xd0,0xfc,0xcc,0x50,0x0d,0xbf,0x44,0x20,
-0xbc,0xe4,0x92,0x03,0x03,0x58,0x20,0x1f,0x6c,0x3d,0x5a,0x03,0x00,0x12,0x12,0x90,
-0x06,0xcc,0xcb,0x80,0xc0,0x00,0x05,0x10,0x80,0xab,0x3c,0x00,0x1e,0x39,0x80,0x09,
-0x30,0xc0,0x0c,0xcc,0x20,0x93,0x0c,0xcf,0x0c,0x20,0x30,0xc0,0xcb,0x3c,0x10,0x0c,
-0x45,0x42,0x37,0xbb,0xba,0x2c,0x9c,0x05,0x12,0x10,0xa1,0x12,0x82,0x59,0x99,0xa7,
-0x0b,0x00,0x00,0x32,0x23,0xd7,0x3d,0x11,0x0d,0xe0,0x23,0xb9,0xdc,0xc0,0x0c,0x00,
-0xb0,0x0d,0x00,0x07,0xeb,0xbd,0xb0,0xab,0x4e,0x11,0x01,0x7a,0x1d,0x10,0x1f,0x26,
-0x06,0x17,0x01,0x10,0x2f,0x01,0x2b,0x16,0xb0,0x22,0x20,0x90,0xb0,0x79,0x99,0x80,
-0xc0,0xc0,0x07,0x07,0x64,0x2c,0x21,0x0b,0x10,0x05,0x00,0x80,0xda,0xe0,0x0b,0x0b,
-0x10,0xc1,0xc0,0x0b,0x98,0x31,0x8d,0x2c,0x5d,0x51,0xc0,0xc0,0x47,0x77,0x61,0x88,
-0x0d,0x71,0x2b,0xbb,0xcb,0x00,0xb0,0x00,0x20,0x47,0x1f,0xf3,0x02,0xb0,0x00,0xd0,
-0x02,0x90,0xb1,0xbb,0xe0,0x02,0x90,0xc0,0x00,0xc0,0x2c,0xcb,0xcb,0x30,0x0b,0x23,
-0x15,0x2c,0xef,0x34,0x10,0x3d,0xf8,0x20,0x20,0x48,0x00,0xc1,0x12,0xc1,0xcc,0xcc,
-0xc0,0x29,0x99,0x9a,0x00,0xb0,0x24,0x25,0x10,0x0d,0x3b,0x00,0xb2,0x29,0x0b,0x1c,
-0xce,0x02,0xa0,0xc0,0x00,0xc2,0xbe,0xbe,0xa4,0x4b,0x20,0x80,0x01,0x82,0x04,0x81,
-0x39,0x11,0x11,0xd0,0x03,0x90,0x00,0x0d,0xce,0x1b,0x8e,0x01,0xbb,0xbb,0xb7,0x12,
-0x22,0x20,0x80,0xae,0x00,0x81,0x2a,0xe0,0xc0,0x0b,0x0b,0x02,0xc0,0xc0,0xbb,0x37,
-0x8c,0x2c,0x4d,0x40,0xc0,0xc0,0x58,0x87,0x70,0xae,0x00,0xfe,0x1c,0x70,0x46,0x66,
-0x60,0x80,0x91,0x47,0x67,0x40,0xd0,0xb2,0x0b,0x1a,0x11,0xd0,0xa2,0x0b,0x1b,0x4a,
-0xe0,0xa2,0x0b,0x1b,0x00,0xc0,0xa2,0x6d,0x9e,0xa2,0xc0,0xb1,0x23,0x22,0x10,0x90,
-0xa1,0x00,0x14,0x44,0x55,0x30,0x00,0x37,0x21,0x2d,0x80,0x06,0x66,0x66,0x10,0xb0,
-0x05,0x66,0x75,0xe5,0x00,0x22,0xb0,0x7c,0xe5,0x00,0xe3,0x02,0x90,0xc0,0x7b,0xe0,
-0x05,0xb4,0xd5,0x20,0xc0,0x08,0x88,0x87,0x10,0xa8,0x05,0x10,0x0a,0xf4,0x00,0x15,
-0x1b,0x1f,0x40,0x00,0x4c,0x5e,0xf3,0x0b,0x03,0x33,0x33,0x00,0x82,0x9a,0x88,0x70,
-0x0d,0x02,0x90,0xa0,0x7c,0xe0,0x29,0x0b,0x00,0x0d,0x02,0x90,0xc0,0x6a,0xe0,0xbe,
-0xbe,0xb3,0xe4,0x04,0x70,0x07,0xba,0x60,0x00,0x0b,0x50,0x17,0x9b,0x19,0x00,0xa4,
-0x28,0x69,0x03,0xc0,0x00,0x3b,0xbb,0xb2,0xbb,0x49,0x60,0xcb,0x30,0x00,0x09,0x00,
-0xa0,0xbd,0x29,0x20,0xb0,0x00,0x7c,0x27,0x68,0x00,0x05,0xbe,0xbb,0xec,0x60,0xa2,
-0x21,0x04,0x14,0x3d,0x12,0x03,0x92,0x53,0x20,0x70,0x06,0x7d,0x46,0x00,0x33,0x00,
-0x41,0x2c,0xdb,0xdd,0xb3,0x01,0x09,0x00,0x55,0x5a,0x14,0xdb,0xf6,0x01,0x12,0x2c,
-0x55,0x54,0x0b,0x39,0x55,0x12,0x0c,0x69,0x29,0x07,0x74,0x00,0x12,0x90,0x6f,0x00,
-0x25,0x00,0x0c,0x74,0x00,0x10,0x03,0x6e,0x14,0x14,0x0d,0x14,0x00,0x01,0xc8,0x03,
-0x40,0x04,0xbb,0xbb,0xbb,0x90,0x59,0x13,0x60,0xbf,0x59,0x10,0x0d,0xda,0x31,0x39,
-0xbf,0xbb,0xfc,0xd0,0x28,0x38,0xdd,0xcc,0xb7,0x97,0x14,0x14,0x56,0x9c,0x14,0x03,
-0xcc,0x53,0x22,0xcb,0x20,0x8c,0x1d,0x14,0x3a,0x05,0x00,0x5b,0x07,0xce,0xcb,0xeb,
-0x50,0xf8,0x4c,0x10,0x9c,0x6e,0x00,0x20,0x01,0xcc,0x8d,0x09,0x32,0x06,0x00,0x70,
-0xcd,0x26,0x52,0x02,0xcd,0xbb,0xdb,0x40,0x01,0x3d,0x08,0xe1,0x03,0x04,0xf6,0x1c,
-0x19,0xec,0xd3,0x1f,0x00,0x8b,0x01,0xf4,0x02,0xa2,0x99,0x98,0x82,0x0c,0x01,0x70,
-0x81,0x00,0xc0,0x29,0x0b,0x10,0x0c,0x02,0x90,0xb1,0x09,0x00,0xb9,0xb0,0x00,0xc0,
-0x3a,0x1c,0x21,0x0c,0x1a,0xaa,0xa9,0x40,0x7e,0x09,0x55,0x07,0x06,0x66,0x66,0x00,
-0xfd,0x01,0x24,0x00,0xd0,0xfd,0x01,0x24,0x00,0xc0,0xfd,0x01,0x16,0x20,0xfd,0x01,
-0x1b,0x70,0xfd,0x01,0x05,0x23,0x03,0x11,0xd0,0x61,0x00,0x03,0x05,0x00,0x02,0x23,
-0x03,0x12,0x40,0xfd,0x23,0x0f,0x23,0x03,0x06,0x01,0xf4,0x08,0x70,0x99,0x99,0xa0,
-0x0c,0x02,0x42,0x41,0x23,0x03,0x13,0x00,0x2c,0x03,0x00,0xd3,0x85,0x42,0xeb,0xeb,
-0x50,0xd0,0xb6,0x1c,0x00,0xb9,0x2a,0x32,0xb5,0x01,0x79,0xca,0x09,0x30,0xc1,0x00,
-0x3c,0xe8,0x01,0x11,0x20,0x99,0x09,0x20,0x98,0x60,0xad,0x31,0x30,0x32,0x00,0xd0,
-0x8a,0x4e,0x50,0x1d,0x00,0x00,0x03,0x61,0x6b,0x14,0x30,0xa5,0xc1,0x0c,0x61,0x26,
-0x60,0x60,0xcc,0xc2,0x0c,0x00,0x47,0x0b,0x00,0x7d,0x08,0x50,0xc0,0x00,0x04,0xcb,
-0xa0,0xff,0x09,0x40,0x40,0x00,0x01,0x31,0xbd,0x09,0x20,0x28,0x95,0x40,0x20,0x70,
-0xbb,0xb9,0x0c,0x10,0x00,0x04,0x50,0xe6,0x11,0x20,0xa9,0xc0,0x8c,0x5b,0x33,0x0a,
-0x10,0xbc,0x11,0x43,0x22,0x4b,0xb5,0xa3,0x1e,0x11,0x03,0x58,0x02,0x1b,0xd0,0x80,
-0x3c,0x14,0x0a,0xbe,0x01,0xf2,0x04,0x4b,0xa5,0x00,0xc0,0x00,0x35,0x54,0x43,0x0d,
-0x00,0x04,0x66,0x66,0x50,0xd0,0x00,0x06,0xcc,0x60,0xb6,0x04,0xa0,0xda,0xa1,0x0b,
-0x00,0xb0,0x0d,0x21,0x00,0xb5,0x5b,0x32,0x00,0x11,0x66,0xa8,0x34,0x03,0x08,0x34,
-0x14,0x01,0x4b,0x00,0x10,0x9c,0xe2,0x15,0x10,0x01,0x69,0x56,0x00,0x90,0x00,0x50,
-0xb0,0x00,0x7b,0xbb,0xb8,0x27,0x00,0x10,0x61,0xfe,0x04,0x60,0x55,0xc0,0x0d,0xdc,
-0x01,0xb0,0x72,0x45,0x20,0x0c,0x33,0x09,0x05,0x20,0x18,0x82,0xe2,0x5b,0x03,0x53,
-0x46,0x00,0x45,0x00,0x01,0x87,0x0c,0x11,0x2c,0x8c,0x0a,0x46,0xdb,0xbb,0xcc,0x20,
-0x48,0x00,0x10,0xd0,0xd8,0x00,0x50,0x0d,0x00,0x00,0x05,0x60,0x47,0x37,0x52,0x66,
-0xc0,0x0d,0xdc,0x10,0x48,0x00,0x01,0x51,0x05,0x22,0x4b,0xb5,0xc3,0x05,0x00,0x4b,
-0x03,0x0c,0x95,0x0a,0x10,0xbc,0x95,0x0a,0x05,0x20,0x01,0x04,0x48,0x00,0x20,0x06,
-0x71,0x48,0x00,0x16,0x43,0x90,0x00,0x04,0x48,0x00,0x10,0xb0,0xa5,0x17,0x10,0x03,
-0x5a,0x01,0x00,0x0b,0x00,0x34,0xed,0xcc,0xcf,0xd2,0x29,0x01,0x05,0x52,0x02,0x90,
-0x00,0x12,0x27,0x48,0x00,0x20,0xb8,0x0d,0xf3,0x30,0x00,0x6e,0x12,0x20,0x55,0xa0,
-0x90,0x00,0x10,0x0b,0x77,0x00,0x10,0x22,0x48,0x00,0x20,0x29,0x92,0x32,0x00,0x30,
-0x04,0x88,0x51,0xa1,0x33,0x10,0x27,0x5f,0x4d,0x00,0x0d,0x06,0x11,0x0b,0xc9,0x3c,
-0x15,0x2b,0x7a,0x4c,0xf0,0x09,0x06,0xa9,0x20,0x80,0xa1,0x00,0x12,0x00,0xa0,0xb1,
-0x7b,0xbb,0xb5,0xa0,0xb1,0x00,0x65,0x00,0xa0,0xb1,0x0a,0x67,0x80,0xa0,0x33,0x3b,
-0xf0,0x01,0xbb,0xe1,0x0b,0x00,0xc0,0xa0,0xb1,0x0c,0x01,0xc0,0xa0,0xb1,0x05,0xbc,
-0x40,0xa0,0xc1,0x0b,0x01,0x05,0x00,0x12,0xb0,0x6d,0x15,0x03,0xa3,0x25,0xff,0x12,
-0x50,0x81,0x64,0x28,0x88,0x85,0xb2,0x75,0x02,0x56,0x31,0xb2,0x75,0x07,0x96,0xc0,
-0xbc,0xd5,0x0c,0x00,0xa2,0xb2,0x65,0x09,0x53,0xc0,0xb2,0x75,0x00,0x67,0x10,0x50,
-0x54,0xa4,0x62,0x0c,0x11,0x00,0xa8,0x0a,0xf0,0x03,0xa5,0x00,0x80,0x00,0x45,0x55,
-0x54,0x0d,0x00,0x04,0x69,0x96,0x50,0xdb,0xb0,0x0a,0x54,0xa0,0x22,0x0a,0x60,0x0b,
-0x00,0xcb,0xa0,0x0c,0x22,0xdc,0x06,0x2f,0x28,0x82,0xcf,0x00,0x0c,0xf7,0x1c,0x02,
-0xa8,0x70,0x00,0xa0,0x01,0x23,0x00,0x0b,0x7b,0xbb,0xbb,0x20,0xb0,0x02,0x62,0x00,
-0x0b,0x04,0xb5,0xb3,0x00,0xb0,0xb1,0x02,0xa6,0x8b,0x0c,0x00,0x0c,0x24,0xb0,0xb1,
-0x02,0xa0,0x0b,0x04,0xb7,0xc3,0x00,0xb0,0x01,0x41,0x34,0x4b,0xc0,0x00,0x42,0x10,
-0x00,0x00,0x07,0x87,0x00,0x0c,0x4b,0xbb,0xba,0x2d,0x56,0xf0,0x07,0x00,0x0d,0x05,
-0xb8,0xc0,0x00,0xd0,0xb0,0x07,0x4b,0xcd,0x0b,0x00,0x74,0x00,0xc0,0x4b,0x7b,0x00,
-0x0c,0x00,0x13,0x93,0x0a,0x00,0xd6,0x53,0x11,0x85,0x01,0x03,0x02,0xed,0x46,0x12,
-0x70,0x3b,0x00,0xf0,0x0d,0x88,0x00,0x0a,0x4b,0xbb,0xbb,0x10,0xd0,0x01,0x31,0x00,
-0x0d,0x06,0xa6,0xb2,0x00,0xc0,0xb0,0x05,0x7a,0xcd,0x09,0x40,0x85,0x00,0xd0,0x08,
-0xa6,0xb6,0x01,0x72,0x69,0x95,0x00,0x00,0xb7,0x22,0x88,0xe0,0x21,0x63,0xd1,0x00,
-0x3c,0x00,0x04,0xcb,0x8f,0x49,0x11,0x20,0x16,0x28,0xf2,0x14,0x20,0x36,0x73,0x2b,
-0xbb,0xb7,0x46,0x84,0x00,0x67,0x20,0x47,0x84,0x08,0x52,0xc7,0xd7,0x84,0x0b,0x00,
-0xb1,0x47,0x84,0x07,0x97,0xb0,0x47,0x84,0x00,0x34,0x00,0x24,0x52,0x00,0x0b,0x96,
-0x0b,0x00,0x91,0x31,0x00,0x88,0x05,0x19,0x0d,0x7c,0x05,0xd0,0x01,0xbb,0x80,0x00,
-0xb0,0x14,0x55,0x44,0x00,0xd0,0x26,0x66,0x66,0xf6,0x06,0x60,0xb0,0x9c,0xd0,0x09,
-0x30,0x86,0xba,0x38,0xa0,0x57,0x22,0xc0,0x07,0x60,0xa4,0x79,0xc0,0x00,0x8a,0x3b,
-0x20,0x01,0x53,0x2b,0x10,0x58,0x76,0x00,0x02,0x6d,0x20,0x32,0xcb,0xbc,0xb0,0x20,
-0x21,0xf1,0x0e,0xb9,0x00,0x08,0x28,0x88,0x88,0x00,0xd0,0x24,0x63,0x20,0x0d,0x04,
-0xc8,0xc1,0x9c,0xd0,0xa1,0x05,0x70,0x0d,0x0a,0x20,0x66,0x9c,0xd0,0x3c,0x9c,0x10,
-0xfc,0x00,0xb0,0x90,0x00,0x5b,0xbb,0xb2,0x00,0x2c,0x00,0x03,0xb0,0x02,0xc3,0x11,
-0x01,0x83,0x43,0xf0,0x03,0x0a,0xbb,0x60,0x00,0x02,0x44,0x44,0x44,0x10,0x04,0x76,
-0x66,0x67,0x30,0x00,0x19,0xbb,0x80,0xca,0x22,0x10,0x67,0x97,0x01,0x10,0x57,0x30,
-0x25,0x17,0xa0,0x02,0x55,0x25,0x8c,0xbb,0x1b,0x3c,0x11,0x01,0x74,0x02,0x23,0xab,
-0x90,0xcb,0x59,0x01,0x58,0x19,0x30,0x4a,0x10,0x96,0x05,0x00,0xf0,0x02,0x77,0x00,
-0x00,0x05,0xbc,0x60,0x00,0x6a,0xa9,0xbc,0x9a,0xa7,0x00,0x11,0x11,0x13,0x10,0xd9,
-0x0f,0xa3,0x40,0x00,0x66,0x77,0x7c,0x40,0x00,0xe4,0x44,0x43,0x06,0x3b,0x06,0x41,
-0x00,0x42,0xaa,0xaa,0xaa,0x40,0x39,0x22,0x20,0x4b,0x11,0x41,0x00,0x13,0x00,0x41,
-0x00,0xf3,0x04,0x36,0x65,0x9a,0x56,0x64,0x25,0x56,0x65,0x55,0x53,0x00,0x19,0xbb,
-0xa3,0x00,0x00,0xc4,0x00,0x2d,0xdc,0x0a,0x15,0x3b,0xb2,0x12,0xf1,0x02,0x2b,0xb9,
-0x00,0xb0,0x00,0x36,0x66,0x65,0x0c,0x00,0x02,0x66,0x66,0x50,0xc0,0x00,0x03,0x43,
-0x4e,0xc1,0xb1,0x05,0x70,0xc3,0x30,0x0c,0x10,0x56,0x0c,0x88,0x00,0x3b,0xfb,0x4c,
-0x01,0x44,0x38,0x01,0xf3,0x54,0x46,0x9b,0xcd,0xbb,0x8c,0xf2,0x04,0x14,0x06,0xbe,
-0x01,0xd1,0x09,0xa8,0x00,0x90,0x00,0x49,0x99,0x99,0x1c,0x00,0x00,0x18,0xa6,0x00,
-0x37,0xf4,0x0f,0x85,0x0c,0x86,0x00,0xc0,0x07,0x60,0xc7,0x50,0x03,0xbd,0x90,0x0c,
-0x10,0x02,0x45,0xd5,0x76,0xc1,0x00,0x36,0x65,0x43,0x17,0x00,0x00,0x0a,0xab,0xbb,
-0x90,0xd5,0x10,0x07,0xb6,0x17,0x21,0x03,0x21,0x52,0x00,0x50,0x98,0x00,0xc0,0x00,
-0x05,0xbe,0x60,0x00,0x71,0x28,0x00,0x66,0x00,0x20,0x97,0x28,0xff,0x1b,0x91,0xd1,
-0x03,0x80,0xcc,0xb0,0x00,0x4c,0x9b,0x20,0xa1,0x4f,0x81,0x11,0xc1,0x00,0x0a,0xbb,
-0xcb,0x94,0xc1,0xb5,0x2e,0x11,0xb0,0xbe,0x14,0x23,0x10,0x00,0xfe,0x39,0x11,0x08,
-0x4f,0x25,0x02,0x0b,0x00,0xd0,0xa8,0x00,0xa0,0x00,0x5a,0xaa,0xa9,0x1d,0x00,0x00,
-0x18,0x96,0x00,0xd9,0x1d,0xf1,0x08,0x86,0x0c,0x76,0x00,0xb2,0x08,0x50,0xc8,0x60,
-0x02,0x9e,0x60,0x0c,0x10,0x06,0x78,0xd9,0xa5,0xc0,0x00,0x23,0x32,0x10,0x65,0x20,
-0xd4,0xbb,0xe1,0x00,0x00,0x56,0x66,0x6d,0x10,0x00,0x0e,0x44,0x44,0x30,0x21,0x11,
-0x12,0x02,0x74,0x0a,0xe0,0xa9,0x00,0x90,0x00,0x04,0x99,0x99,0x91,0xc0,0x00,0x00,
-0x18,0xa7,0x00,0xad,0x24,0x31,0x07,0x60,0xb1,0x10,0x06,0x50,0xbd,0xc0,0x00,0x3a,
-0xd9,0x3b,0x13,0xa0,0x33,0xc4,0x55,0xb1,0x00,0x08,0x88,0x76,0x52,0xa1,0x25,0x17,
-0x10,0xba,0xcd,0x71,0x31,0x70,0x02,0xd0,0x83,0x35,0x00,0xc6,0x18,0x03,0xda,0x49,
-0x01,0x73,0x01,0xf0,0x0f,0x19,0x36,0x66,0x65,0x01,0xa2,0x66,0x66,0x50,0x1b,0x03,
-0xbb,0xb1,0x01,0xb0,0xc1,0x05,0x70,0x1b,0x0c,0x10,0x56,0x01,0xb0,0x3b,0xba,0x00,
-0x1b,0x00,0x03,0x8c,0x32,0x75,0xb0,0x02,0x1b,0x4b,0xbd,0xbb,0x81,0x3b,0x32,0x41,
-0x60,0x00,0x0a,0xba,0x68,0x02,0x68,0x43,0x10,0x04,0x77,0x77,0x77,0x68,0x02,0x12,
-0xc0,0x68,0x02,0x10,0x90,0xa1,0x3c,0x12,0x60,0xdf,0x66,0x20,0x8c,0xde,0x68,0x4c,
-0x03,0x9a,0x01,0x81,0xab,0x10,0x00,0x00,0x57,0x77,0x77,0x71,0xa6,0x02,0x31,0x00,
-0x00,0x04,0xed,0x07,0x10,0xd0,0x41,0x3f,0x91,0x0c,0x30,0x1b,0x20,0x00,0x00,0x28,
-0xa9,0x40,0xbe,0x24,0x73,0x22,0x10,0x8a,0xaa,0xdb,0xa9,0x94,0x7a,0x35,0x02,0xb4,
-0x29,0x22,0x08,0x20,0x4a,0x19,0xe0,0x10,0x05,0x55,0x55,0x20,0xc0,0x16,0x66,0x66,
-0x30,0xd0,0x02,0xba,0xa6,0x1d,0x27,0x00,0xe4,0x53,0xc0,0x8a,0x92,0x00,0xd0,0x49,
-0x9a,0xbb,0xa0,0xd0,0x01,0x2c,0x00,0xbc,0x08,0x00,0x72,0x00,0x10,0x4c,0x17,0x09,
-0x91,0x15,0x55,0x66,0xc0,0x00,0x6a,0x55,0x55,0x30,0x35,0x0f,0x24,0x00,0x02,0x88,
-0x00,0x52,0x05,0x77,0x77,0x77,0x10,0x87,0x00,0x33,0x4b,0xbb,0x80,0x86,0x00,0x32,
-0xc3,0x01,0xb2,0x85,0x00,0xc2,0x12,0x21,0x11,0x22,0x21,0x8a,0xbd,0xaa,0xe9,0x93,
-0x00,0x48,0x7a,0x3b,0x10,0xd0,0x8d,0x64,0x12,0xa0,0xb0,0x09,0x92,0x05,0xaa,0x10,
-0x0b,0x19,0x99,0x99,0x40,0xd0,0xbd,0x29,0x50,0x3b,0x00,0xc0,0x75,0x00,0xfd,0x24,
-0x10,0xb4,0x24,0x02,0x80,0x23,0x0d,0x4b,0xbb,0xa9,0x50,0xd0,0x02,0x1f,0x06,0x10,
-0xa3,0x8c,0x44,0x12,0x30,0xf1,0x0c,0x21,0x90,0x03,0x0c,0x05,0x13,0x32,0x0c,0x05,
-0xf8,0x0e,0x03,0x61,0x00,0x0b,0x05,0xb5,0xc2,0x00,0xb0,0xb0,0x04,0x70,0x0b,0x0c,
-0x00,0x29,0x00,0xb0,0xc0,0x05,0x70,0x0b,0x05,0xb7,0xc1,0x00,0xb0,0x02,0x40,0x0c,
-0x05,0x03,0xfd,0x32,0x00,0xc5,0x0d,0x90,0xaf,0xf0,0x00,0x00,0x03,0x7c,0xff,0xff,
-0xf0,0xf7,0x6c,0x00,0x07,0x00,0x50,0x0b,0xff,0xff,0xfe,0xac,0x07,0x00,0x90,0xd8,
-0x30,0x09,0xf0,0x00,0x0b,0xf1,0x00,0x00,0x07,0x00,0x1b,0xe0,0x07,0x00,0xf0,0x05,
-0x3d,0xff,0xf0,0x03,0x6c,0xe0,0x00,0xcf,0xff,0xf0,0xaf,0xff,0xe0,0x00,0x5f,0xff,
-0x80,0xdf,0xff,0xd0,0x09,0x04,0x31,0x2a,0xda,0x20,0xa8,0x0b,0x10,0x9c,0x5f,0x02,
-0xf0,0x36,0x8f,0xdf,0xb7,0x77,0x77,0xfe,0xdf,0xd0,0xc7,0x00,0x00,0x0d,0x50,0xde,
-0x8e,0x70,0x00,0x00,0xdb,0x8e,0xe5,0xdb,0x77,0x77,0x7f,0x95,0xed,0x1c,0xeb,0xbb,
-0xbb,0xf6,0x1d,0xfc,0xf7,0x00,0x00,0x0d,0xdc,0xfd,0x0c,0x70,0x00,0x00,0xd5,0x0d,
-0xfa,0xe9,0x33,0x33,0x3e,0xca,0xfc,0x3d,0xff,0xff,0xff,0xf8,0x3c,0x35,0x52,0x05,
-0x55,0x55,0x55,0x3f,0xff,0xc6,0xff,0x01,0x00,0x20,0xfc,0x6f,0x05,0x00,0xcf,0xee,
-0x94,0xee,0xee,0xee,0xec,0x34,0x42,0x04,0x44,0x44,0x44,0x1a,0x00,0x14,0x30,0xfd,
-0xff,0xa4,0x06,0x00,0x01,0xf0,0x00,0x11,0x29,0xf1,0x00,0x21,0x2e,0xfc,0x06,0x00,
-0x31,0xff,0x90,0x50,0x06,0x00,0x20,0xaf,0xc0,0x06,0x00,0xb0,0x0c,0xff,0xc0,0x2e,
-0xff,0x90,0x00,0x1c,0xff,0xce,0xff,0xdb,0x0a,0x02,0x4f,0x6f,0x31,0x1c,0xff,0x90,
-0xaf,0x09,0x04,0x06,0x28,0xf1,0x17,0x09,0xf5,0x00,0x06,0xf8,0xdf,0xf5,0x06,0xff,
-0xc2,0xef,0xf9,0xff,0xd1,0x02,0xef,0xff,0xd1,0x00,0x08,0xff,0xf7,0x00,0x06,0xff,
-0xff,0xf5,0x06,0xff,0xe4,0xef,0xf5,0xef,0xe1,0x02,0xef,0xd4,0xa1,0x76,0x6a,0x21,
-0x02,0x50,0xf8,0x05,0xf0,0x1d,0xbf,0x40,0x30,0x00,0x01,0xcf,0x1b,0xf4,0x7f,0x80,
-0x00,0xbf,0xd0,0xbf,0x45,0xff,0x40,0x4f,0xe1,0x0b,0xf4,0x07,0xfd,0x09,0xf8,0x00,
-0xbf,0x40,0x0e,0xf2,0xcf,0x40,0x0b,0xf4,0x00,0xbf,0x4b,0xf4,0x00,0x9e,0x30,0x0b,
-0xf4,0x9f,0xa5,0x10,0x20,0xff,0x23,0xd7,0x6c,0xf1,0x05,0x8f,0xc0,0x0a,0xfe,0x40,
-0x01,0x8f,0xf4,0x00,0x0c,0xff,0xed,0xff,0xf6,0x00,0x00,0x07,0xef,0xff,0xc3,0x93,
-0x0d,0x02,0x24,0x0f,0x02,0x05,0x5e,0x20,0xff,0xf3,0xc2,0x01,0xc1,0x3f,0xff,0x70,
+0xd0,0xc1,0x08,0x5c,0xcd,0x04,0xcc,0x80,0x00,0x54,0x06,0x02,0xc4,0x0c,0x34,0xcb,
+0xbb,0xbc,0x97,0x04,0x16,0x0d,0xa2,0x05,0xf1,0x04,0x13,0x00,0x00,0x80,0x07,0xb9,
+0xb0,0x00,0xd0,0x1c,0x00,0x75,0x9c,0xd0,0x39,0x00,0x48,0x00,0xd0,0x41,0x00,0x75,
+0x0c,0x31,0xb3,0xbc,0xc0,0x02,0xab,0x13,0x02,0x10,0x56,0xcd,0x05,0x10,0x67,0x0c,
+0x00,0x01,0x05,0x00,0x43,0x4c,0xcc,0xcc,0xa0,0x13,0x02,0x20,0xc3,0x9a,0x13,0x02,
+0x10,0x11,0x13,0x02,0x75,0x00,0xc0,0x0c,0x30,0xa6,0xcd,0xd0,0x13,0x02,0x1f,0x30,
+0x13,0x02,0x07,0x00,0xb7,0x00,0xa0,0x18,0xa5,0x00,0x0d,0x0c,0x41,0xc3,0xac,0xd2,
+0xb0,0xb7,0x00,0x00,0x7b,0x00,0x31,0xd1,0x08,0x4b,0xb7,0x00,0x10,0xc0,0x6c,0x0a,
+0xf4,0x05,0x00,0x01,0x8b,0xa5,0x00,0x00,0xc4,0x01,0x97,0x00,0x2b,0x00,0x01,0xc0,
+0x01,0xd1,0x00,0x5a,0x00,0x05,0x9e,0x06,0x01,0xa4,0x01,0x70,0xaa,0x20,0xb1,0xa2,
+0x0b,0x21,0xc2,0x95,0x01,0x60,0xc9,0xd1,0xa2,0x0c,0x00,0xa1,0x0a,0x00,0x10,0xb1,
+0x05,0x00,0xd4,0xdc,0xe1,0xa2,0x06,0x99,0x70,0xb1,0xa2,0x00,0x34,0x00,0xb1,0xa2,
+0x9f,0x01,0x03,0xa4,0x01,0x30,0x00,0x00,0x11,0x94,0x07,0x50,0xaa,0xc2,0x00,0x00,
+0xa4,0xf8,0x06,0x10,0xc1,0x4e,0x01,0x10,0x94,0x0a,0x00,0x20,0x2c,0xaa,0xcd,0x0c,
+0x15,0x11,0x75,0x0a,0x14,0x66,0x01,0x0b,0x81,0x07,0xbb,0x60,0x00,0x00,0x88,0x00,
+0x78,0xb5,0x01,0x00,0xdf,0x09,0x64,0x79,0x00,0x00,0x18,0xdc,0x70,0x24,0x0b,0x10,
+0xdc,0x9a,0x09,0x02,0x52,0x0c,0x09,0x61,0x0c,0x43,0x9c,0xcc,0xcc,0x40,0x60,0x06,
+0x60,0xab,0xab,0x30,0x00,0x00,0x96,0x87,0x08,0x20,0x0a,0x50,0x88,0x08,0x33,0x2b,
+0xbb,0xc4,0xb1,0x0d,0x53,0x3b,0xbb,0xbd,0xbb,0xbb,0xd4,0x00,0x31,0xbc,0xcc,0xce,
+0xdc,0x03,0x40,0x85,0x00,0x00,0xdc,0x5e,0x09,0x23,0x0e,0x00,0x69,0x09,0xe0,0x70,
+0x00,0x00,0x19,0xbb,0x91,0x00,0x00,0xa5,0x00,0x4a,0x00,0x00,0xc1,0x47,0x00,0x20,
+0x4c,0x9a,0x41,0x00,0x37,0x77,0x00,0x00,0x85,0x0b,0x10,0x50,0x80,0x05,0x15,0xd0,
+0x6a,0x09,0x13,0xd0,0x6a,0x09,0x03,0x5d,0x00,0xf0,0x14,0x05,0x84,0x00,0xa2,0x00,
+0x08,0x83,0xa4,0x0a,0x20,0x00,0xc0,0x02,0x90,0x92,0x00,0x0c,0x00,0x1a,0x09,0x20,
+0x00,0xb2,0x05,0x70,0x96,0x30,0x02,0xbb,0xa0,0x09,0xa8,0x20,0x00,0x10,0xa6,0x07,
+0x11,0x0c,0xbb,0x0b,0x94,0xc0,0x23,0x93,0x00,0xab,0xbb,0xb9,0x69,0x30,0xa3,0x09,
+0x24,0x00,0x06,0x79,0x01,0x90,0x07,0xa8,0x00,0xa1,0x00,0x08,0x60,0x67,0x0b,0xcc,
+0x09,0xd0,0xb0,0xa2,0x00,0x0a,0x40,0x49,0x0a,0x20,0x00,0x1a,0xea,0x10,0xad,0xea,
+0x05,0x60,0x0a,0x20,0x09,0xbb,0xfb,0xb7,0x74,0x01,0x00,0x7e,0x00,0x40,0x06,0x00,
+0x00,0x81,0xb7,0x09,0x02,0x94,0x06,0x80,0x00,0x00,0x00,0x9c,0xcc,0xcc,0x20,0x00,
+0xf0,0x27,0x00,0x00,0x00,0x00,0x10,0x03,0x86,0x00,0x0c,0x03,0xb3,0x88,0x00,0xc0,
+0x93,0x00,0xc0,0x0c,0x0a,0x20,0x0c,0x00,0xc0,0x76,0x01,0xb0,0x0c,0x00,0xab,0xb2,
+0x00,0xc0,0x00,0x10,0x00,0x0c,0x00,0x0c,0x00,0x00,0xc0,0x00,0xc1,0x24,0x0c,0x2b,
+0xbb,0xa9,0x60,0xc0,0x00,0x00,0x00,0x0c,0x36,0x00,0x20,0x70,0x00,0x01,0x00,0xf0,
+0x07,0x06,0xa8,0x10,0x0c,0x06,0x80,0x4a,0x00,0xd0,0xa2,0x00,0xc0,0x0d,0x08,0x60,
+0x2b,0x00,0xd0,0x09,0xea,0x10,0x0d,0x22,0x00,0x50,0xd4,0xbb,0xfb,0xb8,0x0d,0x23,
+0x00,0xf0,0x12,0xd0,0x05,0x00,0x00,0x09,0x00,0xa2,0x00,0x00,0x00,0x0a,0x20,0x00,
+0x00,0x00,0x7c,0xcc,0xcc,0x80,0x00,0x00,0x01,0x00,0x00,0x00,0x1b,0xaa,0xc2,0x00,
+0x00,0xa4,0x00,0x2b,0x5e,0x00,0x13,0x0d,0x0a,0x00,0x10,0x2c,0x14,0x00,0x80,0x00,
+0x11,0x10,0x00,0x00,0x0b,0x00,0xc0,0x6a,0x00,0xf0,0x15,0xd0,0x00,0x8c,0xcd,0xcc,
+0xec,0xc8,0x00,0x08,0xbb,0x80,0x00,0x00,0x95,0x00,0x68,0x00,0x00,0xd0,0x00,0x1b,
+0x00,0x00,0x98,0x11,0x88,0x00,0x00,0x2d,0xa9,0xe0,0x00,0x00,0x2a,0x00,0xd0,0x54,
+0x00,0x31,0xcc,0xc7,0x00,0x01,0x00,0x80,0x3b,0xbb,0xb3,0x00,0x00,0xd1,0x00,0x2d,
+0x05,0x00,0x40,0x1d,0x00,0x00,0x4b,0x0f,0x00,0xb0,0x02,0x66,0x20,0x00,0x00,0x5b,
+0x54,0xb5,0x00,0x00,0xc0,0x9a,0x00,0x10,0xd0,0x6e,0x00,0x82,0x89,0x22,0x89,0x00,
+0x00,0x05,0x99,0x50,0x36,0x00,0x50,0x5c,0xcc,0xce,0xcc,0xb8,0x4c,0x00,0x18,0x00,
+0x05,0x00,0x10,0x27,0xe1,0x00,0x70,0xbb,0x60,0x00,0x00,0x88,0x01,0x87,0x37,0x00,
+0xb2,0x1c,0x00,0x00,0x96,0x00,0x79,0x00,0x00,0x07,0xbb,0x70,0x37,0x00,0x60,0x8c,
+0xcc,0xce,0xcc,0xc8,0x00,0x90,0x00,0x20,0x00,0xc0,0x05,0x00,0x20,0xe0,0x06,0x05,
+0x00,0x00,0x1a,0x00,0x42,0xac,0xcc,0xcc,0x40,0x24,0x00,0x60,0x1a,0xba,0xb3,0x00,
+0x00,0x96,0x3c,0x00,0x10,0xa5,0x91,0x00,0x34,0x2b,0xbb,0xb3,0xa9,0x00,0x32,0xbe,
+0xbb,0xb8,0x4c,0x01,0x30,0x9c,0xcc,0xce,0x2d,0x00,0x72,0x08,0x40,0x00,0xdc,0xcc,
+0xcc,0x20,0x41,0x00,0xf0,0x01,0xcc,0xcc,0xcc,0x70,0x00,0x06,0xaa,0x81,0x00,0x00,
+0x88,0x00,0x4c,0x00,0x00,0xa3,0xb4,0x00,0xf0,0x02,0x5c,0x77,0xa9,0x00,0x00,0x01,
+0x34,0x10,0x00,0x3b,0xaa,0xaa,0xaa,0xa8,0x01,0x11,0x1d,0x28,0x01,0x00,0x64,0x01,
+0x60,0xec,0xcc,0xce,0x30,0x00,0xe0,0x41,0x00,0x01,0x05,0x00,0x80,0xbc,0xcc,0xcb,
+0x20,0x00,0x19,0xbb,0x91,0x54,0x01,0x40,0x3a,0x00,0x00,0xc1,0x24,0x00,0xa2,0x6b,
+0x77,0xb7,0x00,0x00,0x01,0x44,0x10,0x00,0x8c,0x2c,0x01,0x10,0x57,0x65,0x00,0x10,
+0x23,0x05,0x00,0xf2,0x02,0x78,0x00,0x00,0x00,0x02,0xdd,0x30,0x00,0x00,0x4c,0x31,
+0xc6,0x00,0x04,0x91,0x00,0x08,0x14,0x01,0xe0,0x05,0xa8,0x00,0x0b,0x05,0x90,0x59,
+0x00,0xc0,0x92,0x00,0xc0,0x0c,0x09,0x15,0x02,0xf0,0x09,0x59,0x05,0x90,0x0c,0x00,
+0x6a,0x80,0x00,0xc0,0x44,0x45,0x68,0x1c,0x16,0x6e,0x54,0x20,0xc0,0x00,0xd0,0x4c,
+0xcc,0x00,0x0d,0x57,0x01,0x73,0xd0,0x00,0x0c,0x00,0x02,0x00,0x00,0xf4,0x00,0x91,
+0x69,0x70,0x00,0xa0,0x06,0x81,0x59,0x00,0xc0,0x4d,0x02,0xf0,0x0c,0x07,0x70,0x4a,
+0x00,0xc0,0x00,0x7b,0x91,0x00,0xc0,0x36,0x66,0x78,0x90,0xc0,0x35,0x7c,0x43,0x00,
+0xc0,0x00,0x1b,0x06,0xbc,0xc0,0x00,0x12,0x3b,0x00,0x10,0x94,0x37,0x00,0x10,0x94,
+0x37,0x00,0x41,0x6c,0xcc,0xcc,0xb0,0x40,0x00,0xf0,0x03,0x01,0x9b,0xa2,0x00,0xb0,
+0x09,0x40,0x1c,0x00,0xd0,0x09,0x50,0x1c,0x00,0xc0,0x01,0x9b,0xa2,0x3c,0x00,0x60,
+0x79,0xa0,0xd0,0x25,0x7c,0x42,0x00,0x02,0x30,0x05,0xbc,0xd0,0x6e,0x00,0xf2,0x06,
+0x60,0x00,0x5c,0xcc,0xcc,0xc0,0x00,0x26,0x66,0x67,0xc0,0x00,0x88,0x44,0x44,0x20,
+0x00,0x6d,0xcc,0xcc,0xc1,0x41,0x00,0xc3,0x89,0x30,0x62,0x92,0x0b,0x42,0xc0,0x82,
+0x92,0x0c,0x00,0x83,0x05,0x00,0xfa,0x19,0x0a,0x86,0xb0,0x92,0x92,0x00,0x45,0x00,
+0x82,0x92,0x26,0x66,0x88,0x82,0x92,0x15,0x99,0x30,0x82,0x92,0x00,0x57,0x29,0xc2,
+0x92,0x00,0x57,0x02,0x92,0x92,0x00,0x57,0x00,0x83,0x92,0x00,0x12,0x00,0x30,0x51,
+0xfe,0x00,0x14,0xa2,0x13,0x03,0x70,0x59,0x06,0x80,0x0c,0x00,0x6a,0x70,0x96,0x02,
+0x62,0x24,0x0c,0x2b,0xbf,0xb9,0x70,0xf5,0x00,0x05,0xfe,0x00,0x10,0x04,0x13,0x03,
+0x80,0x02,0x66,0x10,0x00,0x00,0x5b,0x44,0xc3,0x15,0x00,0x40,0x39,0x00,0x00,0xd0,
+0x48,0x02,0x83,0x88,0x12,0xa5,0x00,0x00,0x06,0x99,0x40,0x33,0x02,0x92,0xce,0xcc,
+0xec,0xb5,0x00,0x2a,0x00,0xc1,0x00,0x05,0x00,0x10,0x29,0x51,0x00,0x43,0x17,0x00,
+0x90,0x00,0x2e,0x02,0x70,0xbb,0xa1,0x00,0x00,0x94,0x00,0x49,0x05,0x00,0x10,0x4a,
+0x2e,0x02,0x12,0xb2,0x18,0x00,0x52,0x6b,0xbe,0xbb,0xeb,0xb6,0x14,0x03,0xe5,0xcd,
+0xcc,0xce,0x10,0x00,0x00,0x00,0x0b,0x10,0x00,0xdc,0xcc,0xcb,0x00,0x2e,0x02,0x12,
+0x40,0x55,0x03,0x83,0x2b,0xaa,0xb1,0x00,0x00,0xb3,0x00,0x58,0xb0,0x02,0x01,0x2d,
+0x03,0x37,0x79,0x22,0xb4,0x82,0x00,0x03,0xba,0x02,0x50,0xcc,0xcc,0xc8,0x00,0x06,
+0xc9,0x02,0x80,0x79,0x10,0x7a,0x00,0x00,0xb2,0x00,0x0d,0x6a,0x02,0x10,0x6a,0xdd,
+0x02,0x12,0x80,0x23,0x00,0x11,0x6c,0x23,0x00,0x01,0x01,0x00,0x11,0xb0,0xc8,0x03,
+0x14,0x00,0xdd,0x02,0x47,0xbc,0xcc,0xcc,0x30,0xdd,0x02,0x10,0x95,0x69,0x00,0x10,
+0x94,0xdd,0x02,0x14,0x1b,0xdd,0x02,0x52,0x6b,0xbb,0xbb,0xbb,0xb9,0x0b,0x00,0x13,
+0xbc,0xdd,0x02,0x30,0x50,0x00,0xdc,0x37,0x00,0x15,0xd0,0xdd,0x02,0x10,0x08,0xa1,
+0x02,0x10,0xa5,0xe6,0x00,0x10,0xc1,0x3c,0x00,0x30,0x4c,0x9a,0xc4,0xfa,0x03,0xc1,
+0x00,0x00,0x01,0x11,0x11,0x11,0x11,0x7b,0xbb,0xaa,0xaa,0xb7,0x41,0x00,0x00,0xdd,
+0x02,0x70,0x20,0x00,0xd0,0x00,0x09,0x30,0x01,0x05,0x00,0x00,0xdd,0x02,0xa0,0x10,
+0x00,0x19,0xbb,0x90,0x00,0x00,0xb4,0x00,0x49,0xe6,0x03,0x62,0x2c,0x00,0x00,0x5c,
+0x9a,0xc3,0x3c,0x00,0xa2,0x69,0x99,0x99,0x99,0x96,0x12,0x22,0x22,0x22,0x21,0xdc,
+0x03,0x60,0x99,0x22,0x8a,0x00,0x00,0xe0,0xdc,0x00,0x36,0xc2,0x00,0x2d,0x4f,0x01,
+0x03,0xf2,0x04,0x1b,0x78,0xf2,0x04,0x45,0x01,0xba,0xc3,0x00,0xe0,0x04,0x86,0xc2,
+0xaa,0xab,0xbb,0x1c,0x01,0x11,0x00,0x12,0x00,0x11,0x40,0x3b,0x00,0x00,0xf6,0x00,
+0xf0,0x03,0x03,0xdc,0x80,0x01,0xa0,0xc1,0x09,0x40,0x1b,0x2a,0x00,0x48,0x01,0xa3,
+0x90,0x03,0x90,0x1a,0x09,0x00,0xc1,0xa0,0xd0,0x09,0x40,0x1a,0x05,0xca,0xa0,0x01,
+0xa0,0x00,0x10,0x41,0x04,0x32,0x02,0xa0,0x00,0x1d,0x04,0x03,0x18,0x03,0xf1,0x0a,
+0x2a,0xc6,0x00,0x0c,0x0c,0x30,0xa3,0x00,0xc1,0xb0,0x04,0x70,0x0c,0x1b,0x00,0x48,
+0x00,0xc0,0xd1,0x08,0x40,0x0c,0x04,0xcc,0x90,0x64,0x00,0x11,0x0a,0x24,0x00,0x40,
+0x08,0xcb,0xbb,0xcb,0xc1,0x02,0x13,0xc0,0x3b,0x00,0x12,0x01,0x12,0x03,0xf0,0x00,
+0x24,0x00,0x00,0xa0,0x07,0xa7,0xc0,0x00,0xd0,0x0d,0x00,0x65,0x00,0xd0,0x2b,0x3c,
+0x00,0xd0,0x1c,0x00,0x57,0x00,0xc0,0x0c,0x52,0xb2,0x00,0xc0,0x01,0x9a,0x40,0x42,
+0x00,0x00,0xab,0x00,0x10,0x47,0x86,0x02,0x10,0x58,0x0c,0x00,0x01,0x05,0x00,0x10,
+0x3c,0x52,0x03,0xa0,0x67,0x20,0x00,0xa0,0x0b,0x63,0xc2,0x00,0xc0,0x1b,0x32,0x00,
+0x10,0x2a,0x3c,0x00,0x82,0x0c,0x30,0xa4,0x00,0xc0,0x02,0xab,0x60,0x37,0x00,0x10,
+0x30,0xec,0x01,0x12,0xa0,0x6d,0x00,0x10,0x7d,0x9b,0x01,0x01,0x8e,0x03,0x10,0x6d,
+0x3c,0x00,0xf2,0x09,0x77,0x20,0x00,0xa0,0xb5,0x4d,0x10,0x0c,0x1b,0x00,0x95,0x00,
+0xc2,0xa0,0x08,0x60,0x0c,0x0c,0x21,0xc2,0x00,0xc0,0x2a,0xb5,0x12,0x01,0x50,0x30,
+0x3c,0xcd,0x2b,0xca,0x77,0x00,0xe1,0xc0,0x3c,0xbc,0x00,0x0c,0x05,0x70,0x00,0x00,
+0xc0,0x3d,0xcb,0x40,0x0a,0x28,0x01,0x0f,0xed,0x00,0x0b,0xf2,0x22,0x06,0x00,0x5a,
+0xaa,0xbb,0x60,0x08,0x61,0x11,0x2b,0x00,0x85,0x00,0x01,0xb0,0x08,0x50,0x00,0x1b,
+0x00,0x4b,0xbb,0xbb,0x60,0x00,0x67,0x20,0x02,0x90,0xb6,0x3c,0x20,0x2a,0x1b,0x00,
+0x57,0x02,0xa2,0xa0,0x04,0x80,0x2a,0x0c,0x30,0xa4,0x02,0xa0,0x2a,0xb6,0x92,0x05,
+0xf0,0x26,0x40,0x06,0x30,0x00,0x16,0x00,0x94,0x00,0x03,0x90,0x09,0xdc,0xcc,0xd9,
+0x00,0x84,0x00,0x03,0x90,0x06,0xbb,0xbb,0xb6,0x01,0x89,0x20,0x03,0x80,0x0c,0x53,
+0xd0,0x04,0x90,0x2a,0x00,0x84,0x04,0x90,0x3a,0x00,0x65,0x04,0x80,0x0d,0x00,0xa2,
+0x04,0x80,0x05,0xcc,0x70,0x04,0x80,0xd9,0x00,0xf0,0x0c,0x40,0x00,0x06,0x10,0x16,
+0x00,0x00,0x0c,0x10,0x49,0x00,0x00,0x1e,0x80,0xad,0x00,0x00,0xa3,0xa9,0xa4,0xc0,
+0x02,0x70,0x0a,0x00,0x44,0x00,0x9e,0x06,0x30,0x02,0xbc,0xcd,0x9a,0x02,0x20,0x03,
+0xa0,0x4e,0x05,0x30,0x76,0x00,0xd0,0x57,0x05,0xf1,0x0a,0x0d,0x11,0x00,0x05,0xf1,
+0x00,0xcb,0xb2,0x00,0xc7,0x80,0x0c,0x00,0x00,0x86,0x0c,0x20,0xc0,0x00,0x3a,0x00,
+0x3a,0x0c,0x00,0x01,0x69,0x01,0x04,0x15,0x02,0xb0,0x00,0x90,0x00,0x15,0x56,0x50,
+0x0b,0x00,0x01,0x66,0x7d,0x16,0x00,0xf5,0x16,0x08,0x60,0x0c,0x10,0x00,0x03,0xe0,
+0x00,0xcc,0xc1,0x01,0xdb,0x60,0x0c,0x10,0x01,0xc4,0x0b,0x40,0xc0,0x00,0x64,0x00,
+0x04,0x0c,0x00,0x00,0x03,0x34,0x44,0x40,0x00,0x02,0x88,0x88,0x8e,0x00,0x4e,0x03,
+0x11,0x0d,0x0b,0x00,0x21,0xa0,0x00,0xfe,0x01,0x30,0x02,0xbb,0xbf,0x42,0x00,0x10,
+0x05,0x6e,0x00,0x20,0x01,0xd0,0x0b,0x00,0xd2,0xcc,0x40,0x0c,0xcb,0x10,0xb6,0x1c,
+0x20,0xc0,0x00,0x75,0x00,0x27,0x6e,0x00,0x10,0xc0,0x03,0x00,0x14,0x09,0x3a,0x00,
+0x11,0xd0,0x3a,0x00,0x70,0xcc,0xcc,0xb1,0x00,0x1b,0xbb,0xb0,0x77,0x01,0x10,0x2c,
+0x13,0x00,0xf0,0x04,0x0b,0x50,0x0d,0x00,0x00,0x06,0xf1,0x00,0xcc,0xc2,0x04,0xb5,
+0xb0,0x0c,0x00,0x05,0xb0,0x05,0x90,0xc8,0x07,0x00,0xa2,0x04,0x43,0x0b,0xcc,0xcc,
+0xe0,0x79,0x00,0x10,0x0d,0x3b,0x05,0x02,0xd0,0x03,0xd0,0x0c,0xcc,0xcc,0xc2,0x00,
+0x01,0x22,0x20,0x08,0x00,0x02,0x99,0x9f,0x42,0x00,0x10,0x06,0x84,0x00,0x10,0x02,
+0xc6,0x00,0x20,0x00,0xca,0x0b,0x00,0x61,0xc5,0x0a,0x50,0xc0,0x00,0x54,0xc6,0x00,
+0xf0,0x09,0x00,0x28,0x86,0x10,0x00,0x00,0x4c,0x32,0x6c,0x00,0x00,0x09,0x40,0x00,
+0xa3,0x00,0x00,0x86,0x00,0x0c,0x20,0x00,0x00,0xab,0x27,0x07,0x07,0x01,0x00,0xf0,
+0x1d,0x12,0x00,0x90,0xa0,0x0a,0xbc,0x80,0xc0,0xb1,0x00,0x08,0x50,0xc0,0xb1,0x00,
+0x0c,0x00,0xc0,0xb1,0x00,0x3a,0x00,0xda,0xe1,0x00,0xad,0x00,0xc1,0xb1,0x02,0xb8,
+0x50,0xc0,0xb1,0x0b,0x31,0xc0,0xc0,0xb1,0x38,0x00,0x83,0xc0,0xb1,0xd7,0x00,0x05,
+0x05,0x00,0xf5,0x20,0x40,0x60,0x03,0x34,0x10,0x80,0x91,0x28,0x7b,0x80,0xd0,0xb2,
+0x00,0x0d,0x20,0xc0,0xa2,0x00,0x7b,0x00,0xcc,0xe2,0x03,0xca,0x40,0xc0,0xa2,0x1c,
+0x20,0xc2,0xc0,0xa2,0x63,0x00,0x13,0x90,0xa1,0x00,0x03,0x33,0x44,0x30,0x00,0x18,
+0x88,0x88,0xe0,0x06,0x01,0x11,0xd0,0x4a,0x01,0xf1,0x18,0x01,0x22,0x30,0x00,0x80,
+0x89,0x9d,0x40,0x1a,0x00,0x00,0xc1,0x01,0xa0,0x00,0x2b,0x00,0x1a,0x00,0x08,0x64,
+0xbb,0xa0,0x01,0xe9,0x01,0x2b,0x00,0x95,0xc1,0x01,0xb0,0x3b,0x05,0x80,0x0b,0x0b,
+0x10,0x0b,0xd1,0x04,0x10,0x0b,0x18,0x02,0x00,0x7c,0x01,0xf0,0x1b,0x04,0x04,0x56,
+0x60,0x00,0xa0,0x66,0x5e,0x20,0x0c,0x00,0x04,0xa0,0x00,0xd0,0x00,0xd2,0x2b,0xbc,
+0x00,0xac,0x80,0x01,0xc0,0x89,0x0a,0x50,0x0c,0x58,0x00,0x08,0x00,0xc0,0x01,0x23,
+0x33,0x32,0x00,0x79,0x99,0x9a,0xa0,0x60,0x05,0x00,0xd8,0x03,0x00,0x3f,0x00,0xb0,
+0x18,0x01,0x33,0x31,0x00,0xa0,0x06,0x88,0xc6,0x00,0xd0,0x86,0x04,0xf0,0x03,0xd0,
+0x00,0x08,0x70,0x77,0xd0,0x00,0x3e,0x80,0x44,0xc0,0x02,0xd2,0xb4,0x00,0xc0,0x1c,
+0x30,0xb9,0x06,0x01,0xb2,0x01,0x10,0x19,0x94,0x03,0x00,0x38,0x00,0x02,0x05,0x00,
+0xf0,0x0f,0x1c,0xcc,0xcc,0xb0,0x2a,0xbb,0xa0,0x09,0x20,0x00,0x3a,0x00,0xa3,0x00,
+0x0c,0x26,0xad,0x30,0x09,0xe3,0x02,0xb2,0x08,0x92,0xc1,0x0a,0x27,0x80,0x03,0x80,
+0x28,0x09,0x61,0x03,0x00,0x0a,0xdd,0xdc,0xe1,0x31,0x09,0x62,0x0c,0xdd,0xdd,0xc0,
+0x00,0xe0,0xe6,0x01,0xf0,0x86,0xc4,0x01,0x22,0x20,0x09,0x12,0x99,0x9f,0x10,0xa2,
+0x00,0x06,0xa0,0x0a,0x20,0x02,0xf1,0x2c,0xe2,0x01,0xd9,0x90,0x0a,0x22,0xc3,0x09,
+0x60,0xa2,0x62,0x00,0x05,0x09,0x10,0x06,0xaa,0xaa,0x90,0x00,0xc4,0x22,0x2c,0x10,
+0x0c,0x10,0x00,0xb1,0x00,0xc1,0x00,0x0b,0x10,0x07,0xbb,0xbb,0xa0,0x18,0x99,0x90,
+0x06,0x30,0x22,0x3e,0x00,0x85,0x00,0x08,0x80,0x08,0x50,0x03,0xf1,0x3c,0xe5,0x01,
+0xd8,0xa0,0x08,0x42,0xc3,0x07,0x80,0x84,0x52,0x00,0x02,0x04,0x20,0x08,0x00,0x00,
+0x52,0x00,0xc1,0x00,0x08,0x30,0x0c,0xdc,0xcc,0xe3,0x00,0xb1,0x00,0x09,0x30,0x09,
+0xbb,0xbb,0xc1,0x01,0x22,0x20,0x06,0x12,0x99,0x9e,0x00,0xa3,0x00,0x06,0x60,0x0a,
+0x30,0x01,0xe0,0x7c,0xe3,0x00,0xca,0x70,0x0a,0x30,0xc5,0x0b,0x40,0xa3,0x74,0x00,
+0x04,0x0a,0x20,0x00,0x27,0x86,0x20,0x00,0x3c,0x42,0x6c,0x06,0x02,0x50,0xb2,0x00,
+0x77,0x00,0x0d,0x04,0x02,0x03,0x4e,0x09,0xe0,0x01,0x00,0x80,0xa0,0x1b,0xce,0x40,
+0xc0,0xc0,0x00,0x0b,0x20,0xc0,0xc0,0xfd,0x01,0xf0,0x0b,0xc0,0x00,0x58,0x6c,0xf0,
+0xc0,0x00,0xcb,0x00,0xc0,0xc0,0x04,0xaa,0x20,0xc0,0xc0,0x0c,0x23,0xa0,0xc0,0xc0,
+0x57,0x00,0xa1,0xc0,0xc0,0x5e,0x06,0x00,0x05,0x00,0x01,0x0a,0x00,0x10,0x30,0x58,
+0x09,0x70,0x50,0x80,0x4b,0xbe,0x50,0xc0,0xd0,0x37,0x00,0xf0,0x05,0xd0,0x00,0x9a,
+0x4b,0xe0,0xc0,0x05,0xab,0x40,0xc0,0xc0,0x3c,0x01,0xc1,0xc0,0xd0,0x61,0x00,0x11,
+0x80,0x23,0x03,0x60,0x40,0x30,0x00,0x00,0x0c,0x40,0xa4,0x06,0x70,0xd2,0x00,0x00,
+0x06,0xc0,0x2c,0x40,0xee,0x04,0x18,0x91,0xfd,0x01,0xf4,0x04,0x23,0xa0,0x00,0x2b,
+0x19,0xaa,0x00,0x08,0x50,0x01,0xb0,0x01,0xe9,0x02,0x3b,0x00,0x95,0xc2,0x89,0xfd,
+0x01,0x01,0x52,0x05,0x15,0x1b,0xfd,0x01,0x02,0xb3,0x00,0x30,0x8b,0xbb,0xe7,0x0d,
+0x00,0x00,0x46,0x02,0xf3,0x03,0x4e,0x20,0x00,0x00,0x07,0xdb,0x90,0x00,0x02,0xb9,
+0x00,0x6c,0x20,0x03,0x10,0x34,0x01,0x30,0x2e,0x09,0x14,0x57,0x37,0x07,0x20,0x8b,
+0xbb,0x9b,0x06,0xf4,0x06,0x07,0xd2,0x00,0x00,0x02,0xbf,0x40,0x00,0x02,0xac,0x43,
+0xba,0x20,0x03,0x20,0x55,0x02,0x20,0x00,0x00,0x66,0x23,0x00,0x01,0x07,0x01,0x40,
+0xcc,0xcc,0xce,0x30,0xbb,0x01,0x05,0x05,0x00,0xf1,0x0c,0x09,0x20,0x00,0x7a,0xaa,
+0xa7,0x00,0x00,0x01,0x16,0xe3,0x00,0x00,0x01,0x9f,0x40,0x00,0x01,0x8c,0x53,0xc9,
+0x10,0x03,0x40,0x44,0x03,0x30,0x3c,0x00,0x34,0x7c,0xcc,0xdd,0x73,0x07,0x1d,0x80,
+0x73,0x07,0x13,0x50,0x78,0x00,0x10,0x06,0x78,0x00,0xf0,0x0c,0xaf,0x70,0x00,0x01,
+0xac,0x41,0x9c,0x30,0x01,0x20,0x39,0x01,0x20,0x24,0x44,0x7b,0x44,0x42,0x46,0x66,
+0x66,0x67,0x74,0x00,0x05,0x99,0x60,0xdc,0x0a,0x13,0x7a,0xf6,0x06,0x17,0xc3,0x73,
+0x0a,0x70,0x08,0x00,0x00,0xbc,0xbe,0x50,0xc0,0x5d,0x04,0x00,0xc8,0x03,0x10,0xc6,
+0x05,0x03,0xf0,0x00,0xba,0xc0,0x0b,0x00,0x00,0xb7,0x06,0x90,0xbc,0xc1,0x44,0x06,
+0x05,0x0b,0x10,0x72,0x00,0xd2,0xb1,0x00,0x00,0x0d,0x02,0x3b,0x10,0x09,0xbb,0xbb,
+0x96,0xb1,0x00,0x68,0x08,0x02,0xee,0x0b,0xf0,0x02,0x8a,0xaa,0xa5,0x00,0x00,0x11,
+0x13,0xd2,0x00,0x00,0x00,0x2d,0x40,0x00,0x00,0x04,0xdc,0x23,0x01,0x30,0x10,0x6c,
+0x30,0xf8,0x00,0x13,0x20,0x55,0x08,0x01,0xbf,0x00,0x04,0x2d,0x01,0x03,0x05,0x00,
+0x20,0x45,0x00,0x3c,0x00,0x14,0xa6,0xf6,0x00,0x10,0xaf,0xf6,0x00,0x88,0x54,0xc9,
+0x10,0x04,0x30,0x00,0x04,0x30,0x46,0x0b,0x10,0x2a,0x06,0x02,0x01,0x05,0x00,0x11,
+0x04,0x01,0x05,0x0a,0xf6,0x00,0xe0,0x08,0xc2,0x00,0x00,0x04,0xce,0x60,0x00,0x03,
+0xc9,0x11,0x8c,0x30,0x01,0x61,0x06,0x00,0xf5,0x0b,0x03,0x6e,0x00,0x91,0x01,0x9a,
+0x30,0x00,0x00,0x5a,0x43,0x7a,0x00,0xf5,0x02,0xa7,0x00,0xa4,0x00,0x1d,0x10,0x00,
+0x1b,0xbb,0xb4,0x00,0xaa,0x01,0x70,0x03,0xcf,0x40,0x00,0x02,0xab,0x32,0xaa,0x01,
+0x30,0x00,0x02,0x20,0x64,0x08,0x6f,0x10,0x7a,0xaa,0xaa,0xbb,0xb7,0xaa,0x01,0x07,
+0x30,0x8b,0xbb,0xc9,0xe7,0x03,0xc2,0xc1,0x00,0x00,0x28,0xcc,0x81,0x00,0x08,0xa4,
+0x00,0x4a,0x50,0x18,0x09,0x41,0xcb,0xbb,0xcc,0xc6,0x0a,0x00,0x27,0x02,0xcc,0x8b,
+0x09,0x27,0xcc,0x10,0x8b,0x09,0x06,0xb4,0x00,0x72,0x05,0xce,0x60,0x00,0x04,0xc9,
+0x10,0xb4,0x00,0xb4,0x00,0x6a,0xaa,0xaa,0xaa,0xa6,0x11,0x11,0x11,0x22,0x21,0xaa,
+0x01,0x1c,0x7b,0xaa,0x01,0xf8,0x1a,0x01,0x12,0x30,0x01,0x80,0x8a,0x9d,0x30,0x2b,
+0x00,0x00,0xd0,0x01,0xb0,0x00,0x2b,0x00,0x1b,0x00,0x09,0x50,0x01,0xb0,0x02,0xe8,
+0x00,0x1b,0x00,0xa4,0xd1,0x01,0xb0,0x4a,0x05,0x90,0x1b,0x0b,0x00,0x09,0x11,0xb0,
+0x21,0x08,0xf0,0x1a,0x05,0x15,0x56,0x50,0x08,0x31,0x66,0x7d,0x00,0x94,0x00,0x09,
+0x60,0x09,0x40,0x03,0xe0,0x00,0x94,0x02,0xda,0x70,0x09,0x42,0xc3,0x0b,0x40,0x94,
+0x62,0x00,0x04,0x09,0x30,0x01,0x22,0x22,0x20,0x00,0xaa,0xaa,0xae,0xa9,0x01,0x14,
+0xa3,0xe5,0x00,0xe2,0x81,0x02,0x33,0x30,0x0a,0x02,0x88,0x8e,0x00,0xc0,0x00,0x06,
+0x70,0x0c,0x75,0x06,0xc2,0xbd,0x40,0x0c,0x00,0xa7,0x1c,0x10,0xc0,0x86,0x00,0x37,
+0x0c,0x71,0x06,0x32,0x82,0x00,0x07,0x2f,0x00,0x10,0xa3,0x4b,0x01,0xa0,0xcc,0xcc,
+0xc2,0x01,0x22,0x10,0x09,0x03,0x99,0xad,0x34,0x04,0xf6,0x0e,0x50,0x0b,0x10,0x04,
+0xe0,0x00,0xb1,0x03,0xd8,0x80,0x0b,0x13,0xc2,0x0a,0x50,0xc1,0x51,0x00,0x02,0x08,
+0x00,0x07,0x99,0x9a,0x90,0x00,0xd3,0x22,0x2d,0x1c,0x0b,0xf0,0x19,0x07,0xbb,0xbb,
+0x90,0x01,0x22,0x20,0x07,0x32,0x99,0xae,0x00,0x85,0x00,0x07,0x70,0x08,0x50,0x03,
+0xe0,0x00,0x85,0x02,0xd9,0x80,0x08,0x52,0xc3,0x0a,0x50,0x84,0x62,0x00,0x04,0x04,
+0x20,0x09,0x00,0x00,0x52,0x46,0x05,0x50,0x30,0x0d,0xcc,0xcc,0xe3,0xe5,0x06,0x50,
+0x30,0x0a,0xbb,0xbb,0xc1,0x66,0x01,0xf4,0x24,0x70,0x02,0xce,0x6b,0xe3,0x2a,0x00,
+0x00,0xb2,0x0b,0x22,0xa0,0x00,0x0d,0x00,0xd0,0x2a,0x00,0x01,0xc0,0x1b,0x02,0xb1,
+0x00,0x6d,0x06,0xd0,0x2e,0xb6,0x0b,0xc3,0xbd,0x22,0xa0,0x01,0xc4,0xac,0x58,0x2a,
+0x00,0x75,0x0d,0x50,0xc2,0xa0,0x02,0x00,0x10,0x01,0x2a,0x00,0xa5,0x05,0x00,0x7c,
+0x05,0x01,0x0d,0x00,0xf0,0x1c,0x11,0x20,0x81,0xa0,0x39,0xd7,0xc3,0xa1,0xb1,0x01,
+0xb0,0x81,0xa1,0xb1,0x04,0x90,0xa0,0xa1,0xb1,0x07,0x60,0xb0,0xab,0xe1,0x0a,0x92,
+0xf1,0xa2,0xb1,0x0c,0xc6,0xb5,0xa1,0xb1,0x47,0x9d,0x2a,0xa1,0xb1,0x91,0x39,0x09,
+0xa1,0xf6,0x02,0x06,0x05,0x00,0xf0,0x20,0x30,0x60,0x03,0x31,0x31,0x16,0x37,0x28,
+0xd4,0xa8,0x29,0x48,0x02,0xa0,0x85,0x29,0x48,0x06,0x80,0xc3,0x2e,0xc8,0x0c,0xc2,
+0xc9,0x2a,0x38,0x48,0x7d,0x3a,0x4a,0x38,0x51,0x06,0x02,0x37,0x37,0x00,0x03,0x44,
+0x44,0x40,0x00,0x18,0x88,0x87,0xb6,0x6d,0x00,0x15,0x66,0x05,0x00,0xf0,0x09,0x54,
+0x05,0xab,0x68,0xbb,0x00,0x00,0x0b,0x40,0x59,0x00,0x00,0x5e,0x01,0xe3,0x00,0x03,
+0xc5,0xbb,0x4c,0x20,0x05,0x00,0x86,0x53,0x04,0x11,0x85,0x0b,0x0f,0x07,0x2b,0x04,
+0x1b,0x20,0x81,0x02,0xf1,0x11,0x09,0x94,0x98,0x00,0x90,0x2c,0x22,0xd0,0x0d,0x00,
+0xd0,0x3a,0x00,0xc0,0x4f,0x08,0xc0,0x0c,0x0b,0xa6,0xca,0x20,0xd3,0xa1,0xe6,0x39,
+0x0d,0x31,0x05,0x00,0x10,0xc0,0x69,0x05,0x44,0x4c,0xbb,0xbb,0xc0,0x49,0x08,0xa0,
+0xc0,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x01,0x00,0xf0,0x09,
+0x88,0x72,0x00,0xb0,0x00,0x00,0x22,0x00,0x0d,0x00,0x05,0xcc,0xcf,0x00,0xd0,0x00,
+0x00,0x02,0xc0,0x0d,0x00,0x00,0x00,0x95,0x0b,0x00,0xf1,0x0a,0x2e,0x00,0x0d,0xcc,
+0x10,0x0c,0xc4,0x00,0xc0,0x00,0x09,0x61,0xc0,0x0c,0x00,0x06,0x80,0x06,0x70,0xc0,
+0x00,0x10,0x00,0x01,0x0c,0x3a,0x00,0x10,0xd0,0x05,0x00,0x23,0x07,0x00,0x01,0x00,
+0xd0,0x6b,0xa2,0x00,0xc0,0x00,0x16,0x67,0x60,0x0d,0x00,0x01,0x55,0x6d,0x1c,0x00,
+0xf0,0x10,0x0c,0x40,0x0d,0xcb,0x00,0x0a,0xd6,0x00,0xd0,0x00,0x0a,0x80,0xb5,0x0d,
+0x00,0x05,0x50,0x00,0x40,0xc0,0x00,0x00,0x11,0x11,0x21,0x00,0x00,0x0e,0xaa,0xaa,
+0xe0,0x40,0x00,0x41,0x0d,0x00,0x00,0x0e,0x48,0x00,0x35,0x9b,0xbb,0xb9,0x48,0x00,
+0x30,0xb3,0x00,0xb0,0x48,0x00,0x11,0x0c,0x48,0x00,0xf0,0x08,0xc1,0x10,0x00,0x0c,
+0x40,0x0c,0xcb,0x10,0x0a,0xd6,0x00,0xc0,0x00,0x0b,0x70,0xa6,0x0c,0x00,0x05,0x40,
+0x00,0x40,0x80,0x78,0x00,0x10,0x51,0x83,0x00,0xf6,0x04,0x0c,0x20,0x00,0x00,0x6e,
+0x11,0xf6,0x00,0x00,0x1c,0x4c,0xa5,0xb5,0x00,0x07,0x30,0x57,0x00,0x80,0x48,0x00,
+0xf0,0x03,0x90,0x00,0x15,0x66,0x60,0x0b,0x10,0x01,0x66,0x7e,0x00,0xb1,0x00,0x00,
+0x0b,0x50,0x0b,0xcc,0x48,0x00,0x70,0xb1,0x00,0x0a,0x70,0xa6,0x0b,0x10,0x90,0x00,
+0xf2,0x0e,0x60,0x00,0x00,0x9a,0xaa,0xa9,0x00,0x00,0x00,0x11,0x2c,0x60,0x00,0x00,
+0x00,0x4e,0x50,0x00,0x00,0x04,0xb9,0x6d,0x60,0x00,0x02,0x81,0x00,0x06,0x60,0x47,
+0x00,0xf6,0x21,0x04,0xa8,0x10,0x90,0xb0,0x00,0x23,0x00,0xc0,0xc0,0x0a,0xbc,0xa0,
+0xc0,0xc0,0x00,0x07,0x70,0xc0,0xc0,0x00,0x0c,0x10,0xda,0xe0,0x00,0x3e,0x00,0xc1,
+0xc0,0x00,0xcb,0x40,0xc0,0xc0,0x07,0x81,0xb0,0xc0,0xc0,0x2b,0x00,0x83,0xc0,0xc0,
+0x00,0x00,0x00,0x05,0x00,0x11,0x40,0x42,0x00,0xd0,0x10,0x02,0xbb,0x70,0x00,0xc0,
+0x06,0x77,0x83,0x00,0xc0,0x03,0x33,0x4a,0x01,0xf1,0x1d,0x08,0xa0,0xbb,0xc0,0x00,
+0x8b,0xc1,0x00,0xc0,0x0a,0x80,0x3c,0x00,0xc0,0x23,0x00,0x02,0x00,0xc0,0x00,0x00,
+0x08,0x20,0x70,0x00,0x00,0x1e,0x30,0x00,0x00,0x00,0xb9,0xd3,0x00,0x00,0x1b,0x70,
+0x1c,0x50,0x00,0x53,0x00,0x00,0x70,0x82,0x00,0xf0,0x20,0x8b,0xa1,0x00,0x92,0x27,
+0x77,0x70,0x0a,0x31,0x33,0x5c,0x00,0xa3,0x00,0x1d,0x27,0xce,0x30,0x1c,0xb7,0x00,
+0xa3,0x3c,0x30,0xa5,0x0a,0x35,0x10,0x00,0x30,0xa2,0x00,0x02,0x78,0x62,0x00,0x03,
+0xc4,0x26,0xc0,0x00,0x94,0x00,0x0b,0x20,0x07,0x70,0x70,0x01,0x22,0xbb,0xb5,0xbc,
+0x00,0xf3,0x23,0x97,0x10,0x70,0xa0,0x00,0x23,0x00,0xb0,0xc0,0x0a,0xcc,0xa0,0xb0,
+0xc0,0x00,0x06,0x70,0xb0,0xc0,0x00,0x0c,0x23,0xc0,0xc0,0x00,0x3e,0x29,0xd1,0xc0,
+0x00,0xbc,0x40,0xb1,0xc0,0x06,0x92,0xb0,0xa1,0xc0,0x1c,0x00,0x93,0xa1,0xc0,0x01,
+0x00,0x00,0xa1,0xc0,0x00,0x05,0x00,0x63,0x40,0x70,0x00,0x0b,0xba,0x40,0x4a,0x01,
+0xf1,0x0e,0xbc,0xcb,0xf4,0x00,0x00,0x00,0x08,0xa0,0x00,0x00,0x00,0x9e,0x10,0x00,
+0x00,0x3c,0x77,0xd4,0x00,0x07,0x92,0x11,0x19,0x40,0x00,0x00,0x66,0x00,0x00,0x05,
+0x00,0x51,0x8c,0xcc,0xdc,0xcc,0xc8,0x2c,0x00,0xf0,0x1d,0x2b,0xb5,0x00,0x0a,0x01,
+0x22,0x20,0x00,0xc0,0x89,0x9e,0x40,0x0c,0x00,0x04,0xb0,0x00,0xc0,0x03,0xda,0x00,
+0x0c,0x03,0xc1,0x97,0x00,0xc0,0xa1,0x50,0x81,0x0c,0x00,0x0c,0x00,0x00,0xc0,0x00,
+0xc1,0x24,0x0c,0x2b,0xbb,0xa9,0x60,0x69,0x00,0x01,0x4a,0x02,0xf2,0x14,0x70,0x00,
+0x06,0x65,0x10,0x00,0x00,0x02,0x55,0x20,0x00,0x00,0xab,0xbb,0xc5,0x00,0x00,0x00,
+0x05,0xd1,0x00,0x00,0x00,0x8f,0x30,0x00,0x01,0x7c,0x65,0xd7,0x00,0x06,0x50,0x00,
+0x06,0x8c,0x00,0xa8,0x8c,0xcc,0xdd,0xcc,0xb8,0x00,0x00,0x85,0x00,0x00,0x05,0x00,
+0x10,0x52,0x31,0x00,0x10,0x54,0x41,0x00,0x20,0x56,0x20,0x4b,0x02,0x10,0xca,0x97,
+0x02,0xb2,0xd2,0x00,0x00,0x06,0xde,0x70,0x00,0x06,0xc7,0x10,0x7c,0x3c,0x00,0xe0,
+0x7c,0xcc,0xdd,0xcc,0xc7,0x00,0x00,0x58,0x00,0x00,0x00,0xcc,0xcd,0xce,0x6b,0x01,
+0x24,0x09,0x40,0x05,0x00,0xb4,0x07,0x30,0x00,0x04,0x43,0x00,0x00,0x00,0x03,0x67,
+0x30,0x8c,0x02,0xf0,0x06,0x06,0xd3,0x00,0x00,0x04,0xcf,0x40,0x00,0x05,0xb9,0x22,
+0xab,0x20,0x02,0x00,0x00,0x01,0x10,0x8c,0xcc,0xcc,0xe5,0x00,0x60,0x2a,0x00,0x00,
+0x00,0x60,0x2a,0x7c,0x02,0x51,0x04,0x00,0x00,0x01,0xd0,0x21,0x01,0xf0,0x02,0xcc,
+0xcc,0x50,0x00,0x03,0x64,0x20,0x00,0x00,0x01,0x56,0x30,0x00,0x00,0x7b,0xbb,0xc9,
+0x54,0x00,0xf0,0x04,0xc2,0x00,0x00,0x5a,0xb8,0xb8,0x30,0x01,0x51,0x00,0x03,0x40,
+0x2b,0xbb,0xbb,0xbb,0xb6,0x00,0x00,0x59,0x03,0xf0,0x02,0x9c,0xcf,0xcc,0x10,0x00,
+0x00,0x00,0x0b,0x20,0x00,0xab,0xbc,0xce,0x10,0x00,0xe0,0x00,0x91,0x00,0x3f,0xcc,
+0xcc,0x40,0xc3,0x00,0x02,0x91,0x05,0xce,0x70,0x00,0x06,0xc8,0x11,0x8c,0x40,0x4b,
+0x02,0x30,0x7c,0xcc,0xdd,0x82,0x00,0xf0,0x00,0x57,0x00,0x00,0x00,0x2a,0xbb,0xb4,
+0x00,0x00,0xc3,0x00,0x1d,0x00,0x00,0xc2,0x05,0x00,0xf0,0x22,0x2b,0xbb,0xb3,0x00,
+0x00,0x43,0x20,0x00,0x10,0x05,0x77,0x00,0x0b,0x06,0xaa,0xa6,0x00,0xc0,0x01,0x1c,
+0x50,0x0c,0x00,0x0b,0xe0,0x00,0xc0,0x2c,0x55,0xb1,0x0c,0x09,0x20,0x02,0x10,0xc0,
+0x11,0x12,0x45,0x0c,0x3a,0xae,0x21,0x00,0xc0,0x00,0xd0,0x00,0x0c,0x8b,0x00,0x01,
+0x09,0x00,0x00,0xc1,0x03,0x1d,0x90,0x7c,0x00,0xc4,0x08,0xc2,0x00,0x00,0x17,0xde,
+0x80,0x00,0x07,0xb6,0x00,0x6c,0x7b,0x01,0x31,0xcc,0xcb,0xb7,0x0a,0x00,0xa4,0x01,
+0xcc,0xcc,0xce,0x20,0x00,0x00,0x00,0x0a,0x30,0x05,0x00,0xf0,0x20,0x08,0x20,0x01,
+0xa8,0x70,0x01,0x80,0x00,0x22,0x00,0x1b,0x0a,0xcc,0xda,0x01,0xb0,0x00,0x08,0x60,
+0x1b,0x00,0x00,0xd1,0x01,0xb0,0x00,0x99,0x00,0x1b,0x00,0x4c,0xd1,0x01,0xb0,0x2c,
+0x15,0xa0,0x1b,0x0c,0x20,0x09,0x41,0xb0,0x10,0x00,0x00,0x1b,0x44,0x00,0x10,0xb0,
+0xb4,0x01,0xf8,0x15,0x03,0x21,0x00,0x00,0x00,0x48,0x92,0x00,0x93,0x39,0xaa,0xa0,
+0x09,0x40,0x11,0x4c,0x00,0x94,0x00,0x1d,0x30,0x09,0x40,0x1c,0xa8,0x00,0x94,0x3c,
+0x30,0xa6,0x09,0x45,0x10,0x00,0x30,0x93,0xdf,0x02,0x65,0x0a,0x30,0x07,0x70,0x00,
+0xd1,0xdf,0x02,0x00,0x7f,0x00,0x50,0x00,0x03,0xbb,0xbe,0x50,0x85,0x01,0x30,0xb2,
+0x0d,0x00,0x60,0x01,0xf0,0x00,0xc0,0x00,0x6c,0xcd,0x70,0x0c,0x11,0x00,0x00,0xd1,
+0x00,0xcb,0xb2,0x00,0x86,0x60,0x02,0x10,0x5a,0xea,0x00,0x10,0x4b,0x6b,0x02,0x20,
+0x02,0x00,0x0b,0x00,0x03,0x76,0x02,0x00,0xf7,0x00,0x02,0xd0,0x00,0xf0,0x22,0x11,
+0x10,0x90,0xa1,0x1a,0xaa,0xf0,0xc0,0xa1,0x00,0x00,0xd0,0xc0,0xa1,0x00,0x03,0xa0,
+0xc0,0xa1,0x4b,0xbe,0x40,0xc8,0xd1,0x00,0x1d,0x00,0xc3,0xb1,0x00,0x95,0x00,0xb0,
+0xa1,0x05,0xb0,0x00,0xb0,0xa1,0x2c,0x00,0x00,0xb0,0xa1,0x11,0x00,0x00,0xc0,0xa1,
+0x47,0x00,0x13,0xa2,0xe2,0x03,0x70,0x11,0x00,0xa0,0x8b,0xaa,0xe0,0x0c,0xd7,0x00,
+0x00,0x1d,0x04,0xf5,0x08,0x0c,0x0a,0xbb,0xf3,0x77,0xd0,0x00,0x78,0x15,0x5d,0x00,
+0x2c,0x00,0x00,0xd0,0x1c,0x20,0x00,0x0c,0x0b,0x30,0x00,0x00,0xeb,0x02,0x10,0xc0,
+0x5b,0x02,0x00,0xdd,0x01,0xf0,0x0d,0x04,0xbb,0xbf,0x00,0xb1,0x00,0x02,0xd0,0x0a,
+0x15,0x99,0xd7,0x8a,0xe1,0x00,0x4d,0x01,0x2b,0x10,0x6c,0x10,0x00,0xa1,0x78,0x00,
+0x00,0x0a,0x10,0x86,0x03,0x42,0x00,0x93,0x00,0x07,0x5e,0x01,0x10,0xa3,0x33,0x00,
+0xf0,0x18,0xcc,0xcc,0xb2,0x19,0xaa,0xa1,0x09,0x20,0x11,0x1c,0x00,0xa2,0x17,0x77,
+0xa0,0x0a,0x21,0x55,0xe2,0x5b,0xe2,0x00,0xa5,0x00,0x0a,0x22,0xb4,0x00,0x00,0xa2,
+0x11,0x00,0x00,0x03,0x00,0x09,0xcc,0xcc,0xe0,0x67,0x00,0x90,0x10,0x0b,0xdc,0xcc,
+0xc0,0x00,0xd1,0x00,0x00,0x12,0x00,0xf0,0x4b,0xc3,0x38,0x99,0x90,0x09,0x11,0x22,
+0x2e,0x00,0xa2,0x13,0x34,0xc0,0x0a,0x26,0x99,0xe5,0x9c,0xe2,0x00,0x7a,0x00,0x0a,
+0x21,0xa9,0x00,0x00,0xa2,0x63,0x00,0x00,0x05,0x00,0x06,0xaa,0xab,0xb0,0x00,0xb4,
+0x11,0x1b,0x20,0x0b,0x20,0x00,0xa2,0x00,0xb2,0x00,0x0a,0x20,0x06,0xbb,0xbb,0xa0,
+0x00,0x12,0x20,0x00,0x70,0x08,0x99,0xb8,0x00,0xc0,0x01,0x22,0xa4,0x00,0xc0,0x07,
+0x8a,0xc0,0xbc,0xc0,0x00,0x1c,0x20,0x00,0xc0,0x02,0xc3,0x00,0x00,0xc0,0x1a,0x10,
+0x01,0x00,0xc0,0xfc,0x01,0x40,0x90,0x00,0x00,0x0f,0xae,0x00,0xd3,0xa9,0xc1,0x00,
+0x00,0x09,0x90,0x3c,0x20,0x00,0x86,0x00,0x02,0xa0,0x56,0x01,0xf0,0x18,0x00,0x80,
+0xb0,0x4b,0xbc,0xa0,0xa1,0xc0,0x00,0x05,0x80,0xb1,0xc0,0x00,0x08,0x50,0xb1,0xc0,
+0x6b,0xbe,0x59,0xd1,0xc0,0x00,0x49,0x13,0xb1,0xc0,0x00,0xc2,0x00,0xb1,0xc0,0x08,
+0x70,0x00,0xa1,0xc0,0x4a,0x71,0x04,0x19,0x30,0x7b,0x04,0x17,0x80,0x55,0x01,0x10,
+0x2b,0x55,0x01,0xf1,0x01,0x7b,0xcc,0x0a,0xbb,0xe0,0x00,0xc0,0x00,0x77,0x00,0x0c,
+0x00,0x2c,0x06,0xcc,0xc0,0x55,0x01,0x1c,0x20,0x55,0x01,0xf2,0x09,0x02,0x33,0x30,
+0x07,0x14,0x88,0x8f,0x10,0xa2,0x00,0x02,0xc7,0xce,0x26,0xaa,0xe6,0x00,0xa2,0x00,
+0x7a,0x0b,0xce,0x21,0x99,0xe9,0x00,0x2f,0x07,0x10,0xe9,0x00,0x04,0x12,0x00,0xc1,
+0x03,0x21,0xcd,0x00,0x3f,0x02,0x40,0x01,0xaa,0xaa,0xae,0xa4,0x06,0x10,0x1d,0x6f,
+0x03,0xb2,0x0d,0x00,0x00,0x03,0xa0,0x0a,0x00,0x00,0x04,0x90,0x00,0x05,0x00,0x02,
+0x02,0x04,0x31,0xac,0xcc,0xcb,0x2d,0x00,0x00,0x37,0x00,0x10,0xbe,0x0d,0x04,0x10,
+0x0c,0x0d,0x04,0x11,0x02,0x1e,0x00,0x12,0xc7,0xfc,0x00,0x23,0xcd,0xdc,0x22,0x03,
+0x75,0x01,0xed,0xdd,0xdc,0x10,0x01,0xc0,0xe4,0x03,0x03,0x40,0x03,0x13,0xdc,0x41,
+0x00,0x01,0x73,0x00,0x35,0xcc,0xcc,0xcd,0x94,0x02,0x11,0x1b,0xb7,0x05,0xd5,0x00,
+0x12,0x22,0x22,0x22,0x21,0x7a,0xaa,0xaa,0xaa,0xa7,0x00,0x9c,0x6e,0x00,0x35,0xac,
+0xcc,0xcf,0x28,0x00,0x32,0x03,0x00,0x7b,0x52,0x04,0x0a,0x90,0x03,0x36,0xec,0xcc,
+0xcb,0x52,0x04,0x35,0x50,0x00,0xbc,0x3c,0x00,0x35,0xbb,0xbb,0xce,0x3c,0x00,0x13,
+0x05,0xc8,0x00,0x01,0x01,0x00,0xf0,0x00,0x99,0x99,0xa9,0x00,0x02,0xc2,0x22,0x2b,
+0x20,0x02,0xc0,0x00,0x0a,0x20,0x01,0x05,0x00,0x5d,0x00,0xbc,0xbb,0xba,0x00,0xd9,
+0x02,0xa4,0x0d,0x0a,0xbb,0xf1,0x00,0xd0,0x00,0x78,0x00,0x0d,0xd9,0x02,0x1e,0x0d,
+0xd9,0x02,0xf0,0x0d,0x01,0x11,0x10,0x08,0x11,0xaa,0xae,0x20,0xa2,0x00,0x00,0xd0,
+0x0a,0x32,0xbb,0xe8,0x00,0xa2,0x00,0x4c,0x00,0x0a,0x20,0x6b,0x00,0x00,0xb2,0x26,
+0xd8,0x00,0x05,0xa3,0x02,0x45,0x0c,0xdc,0xcc,0xb0,0xa3,0x02,0x00,0x07,0x00,0x81,
+0x00,0x00,0xec,0xcc,0x40,0xc0,0x00,0x0d,0xae,0x00,0x10,0xd0,0x4f,0x00,0x61,0x0f,
+0xcc,0xb4,0x0c,0xcc,0x20,0x0b,0x00,0x11,0x0d,0x64,0x00,0x82,0xd0,0x00,0x20,0xc0,
+0x00,0x0b,0xcb,0x96,0xbd,0x03,0x07,0xc8,0x03,0xf2,0x13,0x70,0x00,0x0a,0xbb,0xb4,
+0x09,0x00,0x00,0xd1,0x10,0x00,0xb1,0x00,0x0d,0x11,0x10,0x0b,0x10,0x00,0xfb,0xba,
+0x40,0xbc,0xb1,0x0c,0x00,0x00,0x0b,0x10,0x00,0xcc,0xbb,0xb0,0xb1,0x56,0x01,0x00,
+0x6d,0x00,0x00,0x37,0x00,0x00,0x16,0x00,0x31,0x09,0xcc,0xdd,0x5b,0x00,0x06,0x83,
+0x00,0x20,0x00,0x01,0x7d,0x06,0x53,0x40,0xd0,0x00,0x0d,0x11,0x84,0x00,0x81,0xd0,
+0x00,0x0f,0xcc,0xc5,0x0d,0xdc,0x10,0x0b,0x00,0x94,0x0e,0xaa,0xbd,0x1d,0x00,0x00,
+0x01,0x12,0x10,0x60,0x08,0x20,0x0c,0xdc,0xcc,0x00,0x00,0x42,0x05,0x02,0x4c,0x05,
+0x42,0x00,0xac,0xcb,0xba,0x1a,0x00,0xa0,0x02,0x33,0x20,0x90,0x91,0xe8,0x87,0x0c,
+0x0a,0x2d,0x28,0x04,0xd1,0xd0,0x00,0x0c,0x0a,0x2e,0xcc,0xa0,0xc9,0xd2,0xd0,0x00,
+0x0c,0x2b,0x12,0x00,0x70,0xd2,0x35,0x1c,0x0a,0x27,0x98,0x71,0x43,0x04,0x32,0x0c,
+0x0a,0x20,0x4c,0x04,0xd2,0x04,0x05,0x10,0x56,0x65,0x08,0x09,0x1d,0x55,0x40,0xd0,
+0xa2,0xc0,0x32,0x00,0x20,0xcc,0xe2,0x3b,0x00,0xf4,0x03,0x2d,0x45,0x72,0xd0,0xa2,
+0x56,0x64,0x09,0x0a,0x10,0x03,0x33,0x44,0x30,0x02,0x88,0x88,0x8e,0x7b,0x09,0x01,
+0x40,0x02,0xf0,0x16,0xa0,0x89,0x99,0x08,0x08,0x3d,0x22,0x10,0xd0,0x94,0xc0,0x00,
+0x0d,0x08,0x4e,0xcc,0xa0,0xdc,0xe4,0xd0,0x00,0x0d,0x08,0x4d,0xab,0xc3,0xd0,0x94,
+0x01,0x00,0x05,0x04,0x10,0x04,0x00,0x00,0x30,0x3b,0x09,0x51,0x10,0x0e,0xcc,0xcc,
+0xe1,0x09,0x00,0xf1,0x00,0x0b,0xbb,0xbb,0xc0,0x12,0x22,0x10,0x09,0xda,0xaa,0x50,
+0x0b,0xd0,0x00,0x00,0x04,0x00,0x80,0xdb,0xba,0x29,0xab,0xd1,0x10,0x02,0x2c,0xb7,
+0x09,0x70,0xd1,0x11,0x31,0x0c,0x7b,0xaa,0x81,0x5c,0x01,0x04,0x04,0x00,0xc0,0x06,
+0x04,0x55,0x52,0x00,0xa0,0x0e,0x66,0x62,0x00,0xd0,0x0d,0x7c,0x01,0x42,0x0f,0xcc,
+0xb2,0xac,0x0a,0x00,0xa2,0x0d,0x44,0x57,0x20,0xc0,0x06,0x77,0x65,0x00,0xc0,0x95,
+0x01,0x10,0x29,0x8f,0x01,0x10,0x3a,0x0c,0x00,0x01,0x05,0x00,0xc1,0x1c,0xcc,0xcc,
+0xb0,0x0a,0xbb,0xb4,0x00,0xc0,0x0d,0x11,0x00,0x3c,0x00,0x62,0x11,0xd0,0x0f,0xcc,
+0xb2,0xaa,0x3c,0x00,0x41,0x0c,0xcb,0xee,0x20,0x37,0x00,0x62,0x40,0x00,0x4c,0xcc,
+0xcc,0xa0,0xd8,0x00,0x60,0x5c,0xcc,0xdc,0xa0,0x00,0x76,0x0c,0x00,0x40,0x4d,0xcc,
+0xcc,0xc1,0x3c,0x00,0xe1,0xa0,0xd1,0x10,0x00,0x0d,0x0d,0x00,0x00,0x44,0xd0,0xfc,
+0xcb,0x27,0x8d,0x3a,0x00,0xf0,0x07,0xdb,0xbd,0xe2,0x0c,0x00,0x00,0x10,0x00,0x80,
+0x03,0xaa,0xab,0xb8,0x00,0x77,0x11,0x11,0xd0,0x07,0x60,0x00,0x0d,0x37,0x00,0xf0,
+0x00,0xd0,0x03,0xbb,0xbb,0xb7,0x01,0x22,0x10,0x80,0x19,0x0e,0x99,0x60,0xc0,0x2a,
+0x9a,0x01,0x00,0x05,0x00,0xa3,0xb0,0x2a,0x0f,0xbb,0x5a,0xe0,0x2a,0x0d,0x00,0x01,
+0x0f,0x00,0xb0,0x0d,0x01,0x30,0xb0,0x2a,0x09,0xba,0x81,0xc0,0x2a,0x00,0xd1,0x04,
+0x04,0x05,0x00,0x41,0x40,0x06,0x56,0x64,0x86,0x01,0xb3,0xc0,0xa2,0xc0,0x00,0x1c,
+0x0a,0x2e,0xcc,0x8a,0xe0,0xa2,0x86,0x01,0x1f,0xc0,0x86,0x01,0x09,0xf1,0x02,0x00,
+0x00,0x07,0x08,0x0d,0xbb,0x80,0xc0,0xc0,0xd0,0x00,0x0c,0x0c,0x0e,0xcc,0x8c,0xf0,
+0x09,0x00,0x91,0x0d,0x00,0x20,0xc0,0xc0,0xab,0xba,0x2c,0x0c,0x13,0x0a,0x60,0x02,
+0x60,0x07,0x0a,0x00,0x48,0x8a,0x02,0x00,0x43,0x02,0xf1,0x05,0x2c,0xcc,0xcc,0xb0,
+0x89,0x97,0x09,0x0a,0x1d,0x22,0x10,0xd0,0xb2,0xd0,0x00,0x2d,0x0a,0x2e,0xcc,0x79,
+0x6c,0x00,0x60,0x0b,0x2d,0xbb,0xb3,0xc0,0xb2,0x12,0x02,0x22,0x00,0x0b,0xb0,0x02,
+0x11,0x0d,0x09,0x00,0x00,0xd8,0x03,0x00,0x09,0x00,0x80,0xc2,0x89,0x97,0x06,0x09,
+0x1d,0x22,0x10,0x5a,0x02,0x35,0x1c,0x0a,0x3e,0xa2,0x00,0xa0,0x12,0x41,0xc0,0xa2,
+0x8a,0x97,0x1b,0x0a,0x20,0x00,0x1a,0x01,0x32,0xec,0xcc,0xce,0x5b,0x0b,0x73,0xe0,
+0x00,0x0d,0x00,0x09,0xbb,0xbb,0xec,0x06,0x33,0xeb,0xbb,0xb9,0xf6,0x02,0x33,0xfc,
+0xcc,0xc8,0x0a,0x00,0xb0,0xd1,0x11,0x24,0x10,0x00,0x9b,0xbb,0xa9,0x10,0x00,0x00,
+0x04,0x09,0x00,0x46,0x01,0x11,0x9c,0x69,0x08,0x33,0x9b,0xbb,0xb8,0xe5,0x0b,0x33,
+0xec,0xcc,0xc8,0x0a,0x00,0x41,0xcb,0xbb,0xbb,0x00,0x45,0x09,0xc5,0x7a,0xaa,0xcd,
+0xaa,0xa6,0x11,0x11,0x11,0x22,0x20,0x00,0x60,0x0d,0x0c,0x04,0x0e,0x09,0x55,0x40,
+0x00,0xbc,0xcc,0xc7,0x3c,0x00,0x04,0x0a,0x00,0x20,0xac,0xdd,0x8f,0x04,0x10,0x67,
+0x48,0x05,0x42,0xcd,0xcc,0xc6,0x00,0x30,0x0a,0x20,0xbb,0xc5,0xc3,0x08,0x11,0x0d,
+0x05,0x00,0x50,0x10,0x00,0x3b,0xbb,0xb5,0x7e,0x00,0x13,0xca,0x32,0x00,0x83,0xd1,
+0x11,0x11,0x00,0x00,0xea,0xba,0xa8,0x0f,0x00,0x41,0x9c,0xcc,0xbb,0x10,0x36,0x00,
+0x52,0x5c,0xcc,0xcc,0xcc,0xcb,0x8b,0x09,0x07,0x05,0x00,0x34,0x16,0x00,0x00,0xe6,
+0x00,0x21,0xb8,0x00,0x75,0x05,0x10,0x01,0xe6,0x00,0x02,0x0a,0x00,0x30,0xc1,0x11,
+0x12,0xe0,0x03,0x00,0xe6,0x00,0x04,0x01,0x00,0x02,0xb1,0x05,0x33,0x9c,0xcc,0xc9,
+0x5f,0x00,0x15,0xdc,0x0a,0x00,0x43,0x9b,0xbb,0xcb,0x10,0x35,0x0a,0x04,0x2a,0x05,
+0x00,0xd7,0x00,0x01,0xec,0x08,0x14,0x40,0x05,0x00,0x40,0x06,0x20,0x00,0xab,0x22,
+0x01,0x15,0xe0,0x4f,0x01,0x01,0x0a,0x00,0x11,0xdb,0x22,0x01,0x03,0x3c,0x00,0x02,
+0x10,0x06,0x02,0x22,0x01,0x15,0xe0,0x05,0x00,0x01,0x22,0x01,0x10,0x8c,0x32,0x00,
+0x11,0xc2,0xac,0x05,0x00,0x78,0x00,0xe4,0xb6,0x55,0x55,0x00,0x00,0x25,0x55,0x54,
+0x00,0x6b,0xbb,0xbb,0xbb,0xb8,0x73,0x00,0x20,0xcb,0x20,0xa1,0x04,0x10,0x30,0xa1,
+0x06,0x25,0x20,0x00,0x6c,0x0a,0x0d,0xbe,0x03,0x71,0xbb,0x60,0x0b,0xd1,0x10,0x00,
+0x0c,0xbe,0x03,0x69,0x12,0x31,0x0c,0x7a,0xa9,0x82,0xbe,0x03,0x00,0x46,0x03,0x13,
+0xb0,0x46,0x03,0x52,0x00,0xd0,0xfc,0xcc,0x50,0x09,0x00,0x30,0xdb,0xbc,0xe4,0x92,
+0x03,0x02,0x06,0x02,0x54,0x00,0x6c,0xbb,0xbb,0xc0,0xd0,0x02,0x15,0xd0,0x5c,0x05,
+0x00,0xed,0x00,0xf0,0x0b,0x00,0x06,0xcc,0xcb,0x80,0xc0,0x00,0x05,0x10,0x80,0x0c,
+0x00,0x00,0x93,0x0c,0x00,0xc1,0x00,0x09,0x30,0xc0,0x0c,0xcc,0x20,0x93,0x0c,0xcf,
+0x0c,0x60,0x30,0xc0,0x0c,0x00,0x00,0x83,0x0b,0x00,0x47,0x8c,0xbb,0xba,0x2c,0x9c,
+0x05,0x01,0x42,0x01,0xa1,0x80,0x00,0x59,0x99,0xa7,0x0b,0x00,0x00,0x32,0x23,0x2b,
+0x05,0x20,0xc0,0x0d,0xf8,0x03,0xd2,0x00,0xdc,0xc0,0x0c,0x00,0xb0,0x0d,0x00,0x07,
+0xeb,0xbd,0xb0,0xd0,0x93,0x06,0x20,0x00,0x09,0x2c,0x00,0x20,0x01,0xc0,0x77,0x00,
+0x10,0x1f,0x26,0x06,0x02,0x0b,0x00,0x42,0x0c,0xbb,0xbb,0xb0,0x86,0x00,0xf1,0x03,
+0x12,0x22,0x20,0x90,0xb0,0x79,0x99,0x80,0xc0,0xc0,0x07,0x07,0x00,0xc0,0xc0,0x0b,
+0x0b,0x10,0x05,0x00,0xfd,0x05,0xda,0xe0,0x0b,0x0b,0x10,0xc1,0xc0,0x0b,0x0b,0x00,
+0xc0,0xc0,0x2c,0x5d,0x51,0xc0,0xc0,0x47,0x77,0x61,0x88,0x0d,0x70,0x2b,0xbb,0xcb,
+0x00,0xb0,0x00,0x20,0xbf,0x08,0xf2,0x04,0x90,0xb0,0x00,0xd0,0x02,0x90,0xb1,0xbb,
+0xe0,0x02,0x90,0xc0,0x00,0xc0,0x2c,0xcb,0xcb,0x30,0xc0,0xa1,0x01,0x13,0x2c,0x1c,
+0x06,0x61,0xd0,0x00,0x3d,0xcc,0xcc,0x90,0xa8,0x03,0xe1,0x00,0x2d,0xcc,0xcc,0xc0,
+0x29,0x99,0x9a,0x00,0xb0,0x24,0x25,0x10,0x0d,0x3b,0x00,0xd1,0x29,0x0b,0x1c,0xce,
+0x02,0xa0,0xc0,0x00,0xc2,0xbe,0xbe,0xb3,0x0c,0xe0,0x00,0x10,0x01,0x82,0x04,0xfe,
+0x06,0x39,0x11,0x11,0xd0,0x03,0x90,0x00,0x0d,0x00,0x39,0x00,0x00,0xd0,0x01,0xbb,
+0xbb,0xb7,0x12,0x22,0x20,0x80,0xae,0x00,0xa0,0x2a,0xe0,0xc0,0x0b,0x0b,0x02,0xc0,
+0xc0,0x0b,0x0c,0xae,0x00,0x7c,0x4d,0x40,0xc0,0xc0,0x58,0x87,0x70,0xae,0x00,0xf6,
+0x1f,0x70,0x46,0x66,0x60,0x80,0x91,0x47,0x67,0x40,0xd0,0xb2,0x0b,0x1a,0x11,0xd0,
+0xa2,0x0b,0x1b,0x4a,0xe0,0xa2,0x0b,0x1b,0x00,0xc0,0xa2,0x6d,0x9e,0xa2,0xc0,0xb1,
+0x23,0x22,0x10,0x90,0xa1,0x00,0x14,0x44,0x55,0x30,0x00,0x37,0x77,0x77,0xe0,0x7b,
+0x03,0x50,0x00,0x00,0x00,0x00,0xa0,0xf0,0x20,0x06,0x66,0x66,0x10,0xb0,0x05,0x66,
+0x75,0x00,0xd0,0x02,0x90,0xb0,0x7c,0xe0,0x02,0x90,0xc0,0x00,0xc0,0x02,0x90,0xc0,
+0x7b,0xe0,0x05,0xb4,0xd5,0x20,0xc0,0x08,0x88,0x87,0x10,0xc0,0x00,0x00,0x00,0x00,
+0xc0,0x00,0x0a,0x00,0x00,0x60,0x00,0x1b,0x0c,0x00,0x11,0x0b,0x05,0x00,0xf0,0x0f,
+0xcc,0xcc,0xb1,0x03,0x33,0x33,0x00,0x82,0x9a,0x88,0x70,0x0d,0x02,0x90,0xa0,0x7c,
+0xe0,0x29,0x0b,0x00,0x0d,0x02,0x90,0xc0,0x6a,0xe0,0xbe,0xbe,0xb3,0x0d,0x23,0x00,
+0xf5,0x09,0xa0,0x00,0x07,0xba,0x60,0x00,0x0b,0x50,0x17,0x90,0x00,0xc0,0x00,0x0d,
+0x00,0x0c,0x10,0x03,0xc0,0x00,0x3b,0xbb,0xb2,0x00,0x01,0x00,0xe0,0x03,0xcc,0xcc,
+0xcb,0x30,0x00,0x09,0x00,0xa0,0x00,0x00,0x1c,0x00,0xb0,0x05,0x00,0xa0,0xb1,0x00,
+0x05,0xbe,0xbb,0xec,0x60,0x00,0x00,0x11,0x20,0x00,0x10,0x66,0x05,0x00,0x80,0x76,
+0x00,0x00,0x8c,0xcc,0xcc,0xcc,0xc8,0x2d,0x00,0x90,0x00,0x00,0x00,0x70,0x06,0x00,
+0x00,0x00,0x0e,0x33,0x00,0x60,0x2c,0xdb,0xdd,0xb3,0x00,0x00,0x93,0x00,0x62,0x03,
+0xbb,0xbb,0xdb,0xbb,0xb0,0x54,0x00,0x41,0x2c,0xcc,0xcc,0xe1,0xa0,0x00,0x90,0x10,
+0x00,0x0d,0xcc,0xcc,0xb0,0x00,0x00,0xe0,0x0e,0x00,0x4a,0x0c,0xcc,0xcc,0xc4,0x74,
+0x00,0x12,0x90,0x6f,0x00,0x25,0x00,0x0c,0x74,0x00,0x64,0x03,0x00,0x20,0x00,0x00,
+0x0d,0x14,0x00,0x10,0x7c,0x74,0x00,0x90,0x04,0xbb,0xbb,0xbb,0x20,0x00,0x05,0x00,
+0x60,0x19,0x00,0x12,0xc0,0x05,0x00,0x56,0x04,0xbf,0xbb,0xfc,0x50,0xc4,0x00,0xa3,
+0x7c,0xcc,0xdd,0xcc,0xb7,0x00,0x00,0x57,0x00,0x00,0x05,0x00,0x10,0x56,0x05,0x00,
+0x13,0x45,0x1e,0x00,0x70,0x05,0xcc,0xcc,0xcb,0x20,0x00,0x29,0x3c,0x00,0x14,0x3a,
+0x05,0x00,0x6a,0x07,0xce,0xcb,0xeb,0x50,0x00,0x01,0x00,0x10,0x9c,0x6e,0x00,0x90,
+0x01,0xcc,0xcc,0xcb,0x10,0x00,0x06,0x00,0x70,0x82,0x00,0x71,0xc0,0x00,0x02,0xcd,
+0xbb,0xdb,0x40,0x1e,0x00,0x52,0x5b,0xbb,0xbb,0xbb,0xb8,0x29,0x00,0x30,0xbc,0xcc,
+0xce,0x14,0x00,0x72,0x08,0x50,0x00,0xec,0xcc,0xcc,0x20,0xdd,0x00,0x40,0xcc,0xcc,
+0xcc,0x70,0x8b,0x01,0xf4,0x02,0xa2,0x99,0x98,0x82,0x0c,0x01,0x70,0x81,0x00,0xc0,
+0x29,0x0b,0x10,0x0c,0x02,0x90,0xb1,0x09,0x00,0xc0,0xb0,0x00,0xc0,0x3a,0x1c,0x21,
+0x0c,0x1a,0xaa,0xa9,0x40,0xc0,0x0d,0x01,0x02,0xd1,0x01,0x75,0x00,0x00,0x07,0x06,
+0x66,0x66,0x00,0xfd,0x01,0x24,0x00,0xd0,0xfd,0x01,0x24,0x00,0xc0,0xfd,0x01,0x16,
+0x20,0xfd,0x01,0x1b,0x70,0xfd,0x01,0x82,0x2b,0xbb,0xcb,0x00,0xb0,0x00,0x20,0x20,
+0x3c,0x00,0x12,0xc0,0x05,0x00,0x00,0x3c,0x00,0x41,0x2c,0xcb,0xcb,0x40,0x37,0x00,
+0x10,0x10,0x8d,0x01,0x01,0x0a,0x00,0x80,0xd0,0x00,0x3d,0xcc,0xcc,0x90,0x00,0x48,
+0x0c,0x00,0x13,0x2d,0x14,0x00,0xa1,0x02,0x99,0x99,0xa0,0x0c,0x02,0x42,0x41,0x00,
+0xd0,0x39,0x02,0x00,0x80,0x00,0xb0,0x29,0x0c,0x00,0x0d,0x0b,0xeb,0xeb,0x50,0xd0,
+0x00,0x00,0x72,0x00,0x90,0x7b,0xa6,0x00,0x00,0xb5,0x01,0x79,0x00,0x0c,0x41,0x00,
+0x30,0xc1,0x00,0x3c,0xe8,0x01,0x10,0x20,0x3b,0x00,0xf0,0x15,0x04,0x98,0x60,0x0b,
+0x00,0x00,0x01,0x32,0x00,0xd0,0x00,0x8b,0xbb,0xbb,0x1d,0x00,0x00,0x03,0x61,0x00,
+0xc0,0x00,0x06,0xa5,0xc1,0x0c,0x00,0x00,0xc0,0x06,0x60,0xcc,0xc2,0x0c,0x00,0x47,
+0x0b,0x00,0x94,0x08,0x50,0xc0,0x00,0x04,0xcb,0xa0,0x0c,0x00,0xf1,0x00,0x12,0x00,
+0x0b,0x00,0xf0,0x16,0x40,0x00,0x01,0x31,0x00,0x01,0x00,0x00,0x28,0x95,0x00,0xc0,
+0x00,0x7b,0xbb,0xb9,0x0c,0x10,0x00,0x04,0x50,0x00,0xb1,0x00,0x0a,0xa9,0xc0,0x0b,
+0x10,0x00,0xc0,0x0a,0x10,0xbc,0xc1,0x0c,0x00,0x0b,0x00,0x41,0x4b,0xb5,0x00,0xb0,
+0x35,0x02,0x01,0x58,0x02,0x30,0xd0,0x00,0x00,0x03,0x02,0x02,0xd1,0x00,0x02,0xa3,
+0x00,0x02,0x01,0x00,0xf0,0x14,0x4b,0xa5,0x00,0xc0,0x00,0x35,0x54,0x43,0x0d,0x00,
+0x04,0x66,0x66,0x50,0xd0,0x00,0x06,0xcc,0x60,0x0d,0x00,0x00,0xc0,0x0c,0x00,0xda,
+0xa1,0x0b,0x00,0xb0,0x0d,0x21,0x00,0xb5,0x5b,0x32,0x00,0x10,0x66,0x3d,0x00,0x11,
+0x06,0x8a,0x00,0x10,0xd0,0x7f,0x00,0x14,0x0d,0xfb,0x01,0x10,0x10,0x90,0x00,0x11,
+0x00,0x90,0x00,0x50,0xb0,0x00,0x7b,0xbb,0xb8,0x27,0x00,0xf2,0x0f,0x61,0x00,0xd0,
+0x00,0x0c,0x55,0xc0,0x0d,0xdc,0x01,0xb0,0x0a,0x10,0xd0,0x00,0x0c,0x33,0xc0,0x0d,
+0x00,0x00,0x18,0x82,0x00,0x70,0x00,0x01,0xbc,0xcc,0xb9,0x85,0x00,0x00,0x0b,0x00,
+0x40,0xcd,0x00,0x00,0x2c,0x0d,0x00,0x56,0x01,0xdb,0xbb,0xcc,0x20,0x48,0x00,0x10,
+0xd0,0xd8,0x00,0xe2,0x0d,0x00,0x00,0x05,0x60,0x00,0xd0,0x00,0x0b,0x66,0xc0,0x0d,
+0xdc,0x10,0x48,0x00,0x10,0x00,0x48,0x00,0x22,0x4b,0xb5,0x0f,0x01,0x00,0x4b,0x03,
+0x40,0xdc,0xcc,0xe0,0x00,0x6c,0x00,0x00,0x90,0x00,0x00,0x16,0x00,0x46,0xbc,0xcb,
+0xba,0x00,0x20,0x01,0x04,0x48,0x00,0x20,0x06,0x71,0x48,0x00,0x16,0x43,0x90,0x00,
+0x03,0x48,0x00,0x00,0x20,0x01,0x30,0x20,0x00,0x03,0x5a,0x01,0x00,0x0b,0x00,0x30,
+0xed,0xcc,0xcf,0x0b,0x00,0x00,0x48,0x00,0x43,0xab,0xbb,0xba,0x00,0x90,0x00,0x12,
+0x27,0x48,0x00,0x00,0xd8,0x00,0x80,0x03,0x30,0x00,0xd0,0x00,0x0a,0x55,0xa0,0x90,
+0x00,0x10,0x0b,0x77,0x00,0x10,0x22,0x48,0x00,0x20,0x29,0x92,0x32,0x00,0xf3,0x0a,
+0x04,0x88,0x51,0x00,0x00,0x07,0xa3,0x27,0xb0,0x00,0x00,0xc1,0x00,0x0c,0x10,0x00,
+0x0b,0x40,0x01,0xd0,0x00,0x00,0x2b,0xbb,0xb4,0xab,0x00,0xf0,0x1e,0x06,0xa9,0x20,
+0x80,0xa1,0x00,0x12,0x00,0xa0,0xb1,0x7b,0xbb,0xb5,0xa0,0xb1,0x00,0x65,0x00,0xa0,
+0xb1,0x0a,0x67,0x80,0xa0,0xb1,0x0c,0x00,0xc0,0xbb,0xe1,0x0b,0x00,0xc0,0xa0,0xb1,
+0x0c,0x01,0xc0,0xa0,0xb1,0x05,0xbc,0x40,0xa0,0xb1,0x80,0x04,0x00,0x05,0x00,0x10,
+0xb0,0x05,0x00,0x31,0x30,0x60,0x00,0x24,0x01,0xf0,0x1d,0xab,0x50,0x81,0x64,0x28,
+0x88,0x85,0xb2,0x75,0x02,0x56,0x31,0xb2,0x75,0x07,0x96,0xc0,0xbc,0xd5,0x0c,0x00,
+0xa2,0xb2,0x65,0x09,0x53,0xc0,0xb2,0x75,0x00,0x67,0x10,0x50,0x54,0x00,0x00,0x5a,
+0xa7,0x10,0x00,0x07,0xa2,0x15,0xc0,0x82,0x00,0xb7,0xb2,0x00,0x0a,0x50,0x01,0xd0,
+0x00,0x01,0xab,0xbb,0x40,0xad,0x03,0xff,0x14,0x3a,0xa5,0x00,0x80,0x00,0x45,0x55,
+0x54,0x0d,0x00,0x04,0x69,0x96,0x50,0xdb,0xb0,0x0a,0x54,0xa0,0x0d,0x00,0x00,0xb0,
+0x0b,0x00,0xcb,0xa0,0x0c,0x22,0xc0,0x0c,0x00,0x00,0x28,0x82,0xcf,0x00,0x0c,0xf2,
+0x1c,0x02,0xa8,0x70,0x00,0xa0,0x01,0x23,0x00,0x0b,0x7b,0xbb,0xbb,0x20,0xb0,0x02,
+0x62,0x00,0x0b,0x04,0xb5,0xb3,0x00,0xb0,0xb1,0x02,0xa6,0x8b,0x0c,0x00,0x0c,0x24,
+0xb0,0xb1,0x02,0xa0,0x0b,0x04,0xb7,0xc3,0x00,0xb0,0x01,0x41,0x71,0x03,0x10,0xb0,
+0x4c,0x04,0xf1,0x20,0x00,0x42,0x10,0x00,0x00,0x07,0x87,0x00,0x0c,0x4b,0xbb,0xba,
+0x00,0xd0,0x01,0x30,0x00,0x0d,0x05,0xb8,0xc0,0x00,0xd0,0xb0,0x07,0x4b,0xcd,0x0b,
+0x00,0x74,0x00,0xc0,0x4b,0x7b,0x00,0x0c,0x00,0x13,0x00,0x00,0x40,0x06,0xdc,0xcc,
+0xca,0x00,0x85,0x01,0x03,0x72,0x00,0x0c,0x00,0x4b,0xbb,0xbb,0x70,0x3b,0x00,0xf0,
+0x0d,0x88,0x00,0x0a,0x4b,0xbb,0xbb,0x10,0xd0,0x01,0x31,0x00,0x0d,0x06,0xa6,0xb2,
+0x00,0xc0,0xb0,0x05,0x7a,0xcd,0x09,0x40,0x85,0x00,0xd0,0x08,0xa6,0xb6,0x01,0x90,
+0x69,0x95,0x00,0x00,0xb7,0x22,0x88,0x00,0x1c,0x11,0x02,0x62,0xd1,0x00,0x3c,0x00,
+0x04,0xcb,0x71,0x03,0x11,0x00,0x06,0x00,0xf0,0x13,0x67,0x20,0x36,0x73,0x2b,0xbb,
+0xb7,0x46,0x84,0x00,0x67,0x20,0x47,0x84,0x08,0x52,0xc7,0xd7,0x84,0x0b,0x00,0xb1,
+0x47,0x84,0x07,0x97,0xb0,0x47,0x84,0x00,0x34,0x00,0x24,0x52,0x19,0x04,0x10,0xa0,
+0x2b,0x00,0x30,0xa2,0x00,0x0b,0x88,0x05,0x19,0x0d,0x7c,0x05,0xf0,0x1b,0x01,0xbb,
+0x80,0x00,0xb0,0x14,0x55,0x44,0x00,0xd0,0x26,0x66,0x66,0x00,0xd0,0x01,0xbb,0xb0,
+0x9c,0xd0,0x09,0x30,0x86,0x00,0xc0,0x0b,0x00,0x57,0x22,0xc0,0x07,0x60,0xa4,0x79,
+0xc0,0x00,0x8a,0x60,0x00,0xc0,0x00,0x01,0x41,0x02,0x10,0x58,0x76,0x00,0x10,0x58,
+0x38,0x00,0xf1,0x18,0x3c,0xcb,0xbc,0xb0,0x00,0x10,0x00,0x00,0x00,0x1a,0xb9,0x00,
+0x08,0x28,0x88,0x88,0x00,0xd0,0x24,0x63,0x20,0x0d,0x04,0xc8,0xc1,0x9c,0xd0,0xa1,
+0x05,0x70,0x0d,0x0a,0x20,0x66,0x9c,0xd0,0x3c,0x9c,0x10,0xfc,0x00,0xf0,0x1f,0x90,
+0x00,0x5b,0xbb,0xb2,0x00,0x2c,0x00,0x03,0xb0,0x02,0xc0,0x00,0x4b,0x00,0x06,0xcb,
+0xba,0x10,0x00,0x0a,0xbb,0x60,0x00,0x02,0x44,0x44,0x44,0x10,0x04,0x76,0x66,0x67,
+0x30,0x00,0x19,0xbb,0x80,0x00,0x00,0xb3,0x00,0x67,0x00,0x00,0xc1,0xb2,0x05,0x20,
+0x3b,0xbb,0xb2,0x00,0x10,0x21,0x69,0x00,0x92,0x75,0x00,0x00,0x8c,0xbb,0xdd,0xcc,
+0xc7,0x00,0xaf,0x00,0x01,0x74,0x02,0xf0,0x02,0xab,0x90,0x00,0x01,0xbb,0xbb,0xbb,
+0x40,0x00,0x05,0x99,0x60,0x00,0x00,0x4a,0x10,0x96,0x05,0x00,0xf1,0x10,0x77,0x00,
+0x00,0x05,0xbc,0x60,0x00,0x6a,0xa9,0xbc,0x9a,0xa7,0x00,0x11,0x11,0x13,0x10,0x00,
+0xbc,0xcc,0xbe,0x40,0x00,0x66,0x77,0x7c,0x40,0x00,0xe4,0x44,0x43,0x93,0x05,0x17,
+0x60,0x41,0x00,0x30,0xaa,0xaa,0xaa,0x41,0x00,0x50,0x50,0x00,0x00,0x4b,0x11,0x41,
+0x00,0x13,0x00,0x41,0x00,0xf0,0x09,0x36,0x65,0x9a,0x56,0x64,0x25,0x56,0x65,0x55,
+0x53,0x00,0x19,0xbb,0xa3,0x00,0x00,0xc4,0x00,0x2d,0x00,0x00,0xc2,0x00,0x0d,0x96,
+0x00,0x13,0xb5,0x6e,0x02,0xf0,0x14,0x2b,0xb9,0x00,0xb0,0x00,0x36,0x66,0x65,0x0c,
+0x00,0x02,0x66,0x66,0x50,0xc0,0x00,0x03,0xbb,0xb1,0x0c,0x00,0x00,0xb1,0x05,0x70,
+0xc3,0x30,0x0c,0x10,0x56,0x0c,0x88,0x00,0x3b,0xba,0x6e,0x02,0x10,0x03,0xc1,0x01,
+0x96,0x01,0xb0,0x00,0xc0,0x00,0x9b,0xcd,0xbb,0x8c,0xf2,0x04,0x14,0x06,0xbe,0x01,
+0xf6,0x26,0x09,0xa8,0x00,0x90,0x00,0x49,0x99,0x99,0x1c,0x00,0x00,0x18,0xa6,0x00,
+0xc1,0x00,0x0b,0x30,0x85,0x0c,0x86,0x00,0xc0,0x07,0x60,0xc7,0x50,0x03,0xbd,0x90,
+0x0c,0x10,0x02,0x45,0xd5,0x76,0xc1,0x00,0x36,0x65,0x43,0x17,0x00,0x00,0x0a,0xab,
+0xbb,0x90,0x00,0x00,0x11,0x11,0x1d,0xed,0x04,0x10,0x07,0x07,0x05,0x11,0x21,0x52,
+0x00,0xd0,0x98,0x00,0xc0,0x00,0x05,0xbb,0xbb,0xb1,0xc0,0x00,0x00,0x05,0x84,0x66,
+0x00,0xf0,0x01,0x97,0x28,0x50,0xc0,0x00,0x00,0xd1,0x03,0x80,0xcc,0xb0,0x00,0x4c,
+0x9b,0x20,0xc1,0x7c,0x00,0xb1,0x11,0xc1,0x00,0x0a,0xbb,0xcb,0x94,0xc1,0x00,0x00,
+0x02,0xbf,0x02,0x41,0x0b,0x20,0x00,0x10,0x06,0x00,0x00,0xbe,0x06,0x33,0xcc,0xcc,
+0xc1,0x96,0x00,0xf0,0x1b,0x08,0xa8,0x00,0xa0,0x00,0x5a,0xaa,0xa9,0x1d,0x00,0x00,
+0x18,0x96,0x00,0xc0,0x00,0x0b,0x20,0x86,0x0c,0x76,0x00,0xb2,0x08,0x50,0xc8,0x60,
+0x02,0x9e,0x60,0x0c,0x10,0x06,0x78,0xd9,0xa5,0xc0,0x00,0x23,0x32,0x10,0x04,0x76,
+0x06,0xd1,0xbb,0xe1,0x00,0x00,0x56,0x66,0x6d,0x10,0x00,0x0e,0x44,0x44,0x30,0x66,
+0x01,0x11,0x40,0x60,0x00,0x00,0x49,0x00,0xd0,0xa9,0x00,0x90,0x00,0x04,0x99,0x99,
+0x91,0xc0,0x00,0x00,0x18,0xa7,0xc6,0x07,0x41,0xb3,0x07,0x60,0xb1,0x10,0x06,0xf0,
+0x14,0xbd,0xc0,0x00,0x3a,0xd9,0x00,0xb1,0x00,0x02,0x33,0xc4,0x55,0xb1,0x00,0x08,
+0x88,0x76,0x52,0xa1,0x00,0x00,0x00,0x8b,0xba,0x30,0x00,0x00,0x09,0x70,0x02,0xd0,
+0x00,0x00,0x0a,0x40,0xe4,0x00,0x45,0x02,0xbb,0xbb,0x50,0x73,0x01,0xf2,0x1b,0x19,
+0x36,0x66,0x65,0x01,0xa2,0x66,0x66,0x50,0x1b,0x03,0xbb,0xb1,0x01,0xb0,0xc1,0x05,
+0x70,0x1b,0x0c,0x10,0x56,0x01,0xb0,0x3b,0xba,0x00,0x1b,0x00,0x03,0x00,0x01,0xb0,
+0x01,0xb0,0x02,0x1b,0x4b,0xbd,0xbb,0x81,0xb0,0x83,0x08,0x00,0x1d,0x09,0x21,0x0a,
+0xba,0x68,0x02,0x68,0x43,0x10,0x04,0x77,0x77,0x77,0x68,0x02,0x11,0xc0,0x68,0x02,
+0x00,0x53,0x01,0x10,0x25,0x4b,0x08,0x94,0x58,0x00,0xc0,0x00,0x8c,0xde,0xcc,0xec,
+0xc7,0x9a,0x01,0x81,0xab,0x10,0x00,0x00,0x57,0x77,0x77,0x71,0xa6,0x02,0x51,0x00,
+0x00,0x04,0xbb,0xb8,0x76,0x01,0xf0,0x0d,0x84,0x00,0x00,0x0c,0x30,0x1b,0x20,0x00,
+0x00,0x28,0xa9,0x40,0x00,0x01,0x11,0x11,0x11,0x22,0x10,0x8a,0xaa,0xdb,0xa9,0x94,
+0x00,0x00,0x09,0x30,0x38,0x00,0x11,0x93,0xf8,0x00,0x00,0x43,0x00,0xf0,0x16,0x6b,
+0xa2,0x00,0x10,0x05,0x55,0x55,0x20,0xc0,0x16,0x66,0x66,0x30,0xd0,0x02,0xba,0xa6,
+0x00,0xc0,0x07,0x70,0x1b,0x00,0xd0,0x00,0x8a,0x92,0x00,0xd0,0x49,0x9a,0xbb,0xa0,
+0xd0,0x01,0x2c,0x00,0xbc,0x08,0x00,0x72,0x00,0x10,0x4c,0x17,0x09,0xb0,0x15,0x55,
+0x66,0xc0,0x00,0x6a,0x55,0x55,0x30,0x00,0x4d,0x8d,0x01,0x14,0x02,0x88,0x00,0x52,
+0x05,0x77,0x77,0x77,0x10,0x87,0x00,0x33,0x4b,0xbb,0x80,0x86,0x00,0x32,0xc3,0x01,
+0xb2,0x85,0x00,0xc0,0x12,0x21,0x11,0x22,0x21,0x8a,0xbd,0xaa,0xe9,0x93,0x00,0x48,
+0x33,0x01,0x01,0x05,0x00,0x32,0x37,0x00,0xa0,0xb0,0x09,0xf0,0x0a,0x05,0xaa,0x10,
+0x0b,0x19,0x99,0x99,0x40,0xd0,0x06,0xa8,0x10,0x0c,0x06,0x80,0x3b,0x00,0xc0,0x75,
+0x00,0xb0,0x0c,0x01,0xba,0xb4,0x24,0x02,0x80,0x23,0x0d,0x4b,0xbb,0xa9,0x50,0xd0,
+0x02,0x1f,0x06,0x61,0xa3,0x00,0x00,0x10,0x0a,0x30,0x3d,0x09,0x31,0xcc,0x90,0x03,
+0x0c,0x05,0x13,0x32,0x0c,0x05,0xf8,0x0e,0x03,0x61,0x00,0x0b,0x05,0xb5,0xc2,0x00,
+0xb0,0xb0,0x04,0x70,0x0b,0x0c,0x00,0x29,0x00,0xb0,0xc0,0x05,0x70,0x0b,0x05,0xb7,
+0xc1,0x00,0xb0,0x02,0x40,0x0c,0x05,0x11,0x00,0x62,0x08,0x00,0x05,0x00,0xe0,0x16,
+0xaf,0xf0,0x00,0x00,0x03,0x7c,0xff,0xff,0xf0,0x00,0x06,0xef,0xff,0x07,0x00,0x50,
+0x0b,0xff,0xff,0xfe,0xac,0x07,0x00,0x90,0xd8,0x30,0x09,0xf0,0x00,0x0b,0xf1,0x00,
+0x00,0x07,0x00,0x1b,0xe0,0x07,0x00,0xf0,0x05,0x3d,0xff,0xf0,0x03,0x6c,0xe0,0x00,
+0xcf,0xff,0xf0,0xaf,0xff,0xe0,0x00,0x5f,0xff,0x80,0xdf,0xff,0xd0,0x09,0x04,0x21,
+0x2a,0xda,0x96,0x01,0x20,0x80,0x9c,0x5f,0x02,0xf0,0x36,0x8f,0xdf,0xb7,0x77,0x77,
+0xfe,0xdf,0xd0,0xc7,0x00,0x00,0x0d,0x50,0xde,0x8e,0x70,0x00,0x00,0xdb,0x8e,0xe5,
+0xdb,0x77,0x77,0x7f,0x95,0xed,0x1c,0xeb,0xbb,0xbb,0xf6,0x1d,0xfc,0xf7,0x00,0x00,
+0x0d,0xdc,0xfd,0x0c,0x70,0x00,0x00,0xd5,0x0d,0xfa,0xe9,0x33,0x33,0x3e,0xca,0xfc,
+0x3d,0xff,0xff,0xff,0xf8,0x3c,0x35,0x52,0x05,0x55,0x55,0x55,0x3f,0xff,0xc6,0xff,
+0x01,0x00,0x20,0xfc,0x6f,0x05,0x00,0xcf,0xee,0x94,0xee,0xee,0xee,0xec,0x34,0x42,
+0x04,0x44,0x44,0x44,0x1a,0x00,0x14,0x30,0xfd,0xff,0xa4,0x06,0x00,0x01,0xf0,0x00,
+0x11,0x29,0xf1,0x00,0x21,0x2e,0xfc,0x06,0x00,0x31,0xff,0x90,0x50,0x06,0x00,0x20,
+0xaf,0xc0,0x06,0x00,0xb0,0x0c,0xff,0xc0,0x2e,0xff,0x90,0x00,0x1c,0xff,0xce,0xff,
+0xdb,0x0a,0x40,0xff,0xff,0x90,0x00,0x07,0x00,0x11,0x90,0xaf,0x09,0x13,0x90,0x4c,
+0x04,0xf0,0x19,0x09,0xf5,0x00,0x06,0xf8,0xdf,0xf5,0x06,0xff,0xc2,0xef,0xf9,0xff,
+0xd1,0x02,0xef,0xff,0xd1,0x00,0x08,0xff,0xf7,0x00,0x06,0xff,0xff,0xf5,0x06,0xff,
+0xe4,0xef,0xf5,0xef,0xe1,0x02,0xef,0xd4,0xa1,0x00,0x02,0xa3,0x06,0x11,0x50,0xf8,
+0x05,0xf0,0x3b,0xbf,0x40,0x30,0x00,0x01,0xcf,0x1b,0xf4,0x7f,0x80,0x00,0xbf,0xd0,
+0xbf,0x45,0xff,0x40,0x4f,0xe1,0x0b,0xf4,0x07,0xfd,0x09,0xf8,0x00,0xbf,0x40,0x0e,
+0xf2,0xcf,0x40,0x0b,0xf4,0x00,0xbf,0x4b,0xf4,0x00,0x9e,0x30,0x0b,0xf4,0x9f,0x80,
+0x00,0x00,0x00,0xff,0x23,0xff,0x20,0x00,0x00,0x8f,0xc0,0x0a,0xfe,0x40,0x01,0x8f,
+0xf4,0x00,0x0c,0xff,0xed,0xff,0xf6,0x00,0x00,0x07,0xef,0xff,0xc3,0x4f,0x00,0x11,
+0x12,0xc0,0x00,0x02,0x6d,0x05,0x30,0x00,0xff,0xf3,0xc2,0x01,0xc1,0x3f,0xff,0x70,
 0x11,0x00,0x7f,0xbf,0xff,0xff,0xce,0xb0,0x1f,0xf5,0x00,0xf1,0x14,0x53,0xff,0xff,
 0x82,0x5f,0xff,0xf7,0x03,0xff,0xc0,0x00,0x7f,0xf8,0x00,0x3f,0xfa,0x00,0x06,0xff,
 0x70,0x2c,0xff,0xf4,0x01,0xdf,0xfe,0x42,0xff,0xff,0xfe,0xff,0xff,0xf6,0x0a,0xff,
 0x10,0x01,0xa1,0x05,0x07,0xff,0xfa,0x13,0x20,0x00,0x00,0x0f,0xff,0x9c,0x07,0x12,
-0x46,0xbc,0x03,0x40,0x25,0x00,0x36,0x20,0x48,0x71,0x30,0xfc,0x1a,0xf6,0x0d,0x6d,
-0xf0,0x15,0xe9,0xfe,0xcf,0x60,0x00,0x00,0xaf,0xc3,0x64,0xff,0xf6,0x00,0x01,0xcf,
-0xa3,0xef,0xa3,0xdf,0x90,0x03,0xef,0x75,0xff,0xff,0xc3,0xcf,0xb0,0xdf,0x48,0xff,
-0xff,0xff,0xe3,0x9f,0x72,0x27,0x4f,0x00,0xe0,0xf2,0x50,0x00,0x9f,0xff,0xcb,0xef,
-0xff,0x30,0x00,0x09,0xff,0xf1,0x07,0x9a,0x00,0xb1,0x9f,0xff,0x10,0x7f,0xff,0x30,
-0x00,0x07,0xff,0xe0,0x06,0xf7,0x6c,0x12,0x04,0x01,0x65,0x21,0x1f,0xff,0xc3,0x00,
-0x3d,0x2f,0xff,0x20,0x07,0x00,0x50,0x47,0x8f,0xff,0x87,0x40,0x39,0x00,0x01,0x7c,
-0x01,0x40,0x0a,0xff,0xff,0xfa,0x1c,0x00,0x10,0xaf,0x99,0x6f,0xf2,0x03,0x46,0x66,
-0x3a,0xfa,0x36,0x66,0x50,0xff,0xff,0xf4,0x54,0xff,0xff,0xf2,0xff,0xff,0xff,0xcf,
-0x07,0x00,0x40,0xff,0xf3,0xb8,0xf2,0x83,0x37,0x00,0x57,0x16,0x81,0x08,0xaa,0xaa,
-0xaa,0xa4,0x00,0x00,0x08,0x8f,0x00,0x30,0x00,0x03,0xfb,0x58,0x00,0x40,0xd0,0x00,
-0xdf,0x10,0x49,0x71,0x21,0x80,0x8f,0xc1,0x08,0xf1,0x03,0xbf,0x3f,0xfe,0xee,0x40,
-0x00,0x9e,0xee,0xf9,0xff,0xff,0xfc,0x44,0x5f,0xff,0xff,0xaf,0xff,0x01,0x00,0x22,
-0xfa,0xff,0x01,0x00,0x12,0x9a,0x07,0x00,0x11,0xf5,0x19,0x03,0xf0,0x0f,0x07,0x90,
-0x00,0x6d,0xff,0xfb,0x40,0xcf,0x00,0xbf,0xfd,0xbd,0xff,0xac,0xf0,0xbf,0xd3,0x00,
-0x03,0xcf,0xff,0x4f,0xd1,0x00,0x07,0xaa,0xff,0xf9,0xf5,0x00,0x16,0x6f,0x11,0x01,
-0x47,0x58,0x03,0xde,0x10,0x01,0xae,0x00,0xf3,0x0e,0x4f,0x9f,0xff,0xab,0x70,0x00,
-0x0d,0xf4,0xff,0xfb,0x20,0x00,0x3c,0xfb,0x0f,0xcb,0xff,0xca,0xcf,0xfc,0x10,0xfc,
-0x05,0xcf,0xff,0xd7,0x00,0x09,0x70,0xbd,0x01,0xe4,0x05,0x20,0x00,0x06,0xf7,0x01,
-0x16,0xff,0x8f,0xff,0xff,0xf8,0xff,0xff,0x07,0x00,0xb2,0x8a,0xcc,0xef,0xf8,0x00,
-0x02,0xef,0x80,0x00,0x02,0xe7,0x39,0x07,0x20,0x04,0x20,0xb8,0x00,0x60,0x70,0x00,
-0x01,0x16,0xff,0x80,0x7e,0x79,0x70,0x82,0xb1,0xff,0xff,0xff,0x80,0xc9,0x05,0x00,
-0xa0,0x9b,0xff,0xff,0xff,0x82,0xf3,0xbd,0xdf,0xff,0x80,0xcf,0x7c,0x10,0x80,0xfe,
-0x3a,0x15,0x70,0x77,0x33,0x05,0x01,0x00,0x22,0x04,0xc2,0x6d,0x00,0xa0,0x0b,0xe1,
-0x00,0x00,0x06,0xf7,0x00,0xb7,0x0c,0xb0,0x4b,0x00,0xb0,0x05,0xf5,0x2f,0x3f,0xff,
-0xff,0xf8,0x2c,0x17,0xd0,0xb8,0x4b,0x00,0xb1,0xba,0x2f,0x18,0xbf,0xff,0xff,0xf8,
-0x09,0xb1,0xf2,0x7b,0x55,0x00,0x30,0x5e,0x0a,0x9a,0x89,0x00,0x30,0x2e,0x80,0xe4,
-0x8d,0x00,0x40,0x0c,0xa0,0x8d,0x00,0x91,0x00,0x31,0x10,0x7f,0x30,0x5f,0x00,0x24,
-0x4f,0x40,0x36,0x04,0x11,0x9f,0x29,0x01,0x40,0x9f,0xf9,0xbf,0xff,0xaa,0x03,0x30,
-0x00,0xdf,0xff,0x4d,0x00,0x90,0x0d,0xff,0xf8,0xaf,0xff,0xff,0x9b,0xff,0xf8,0x1d,
-0x01,0x80,0x6d,0xf8,0x00,0x00,0xcf,0xff,0x40,0x17,0xc9,0x01,0x11,0xa0,0xc8,0x01,
-0x72,0xfd,0xaa,0xaa,0xaa,0xaa,0xad,0xfa,0x72,0x01,0x02,0x7a,0x29,0x00,0xe1,0x72,
-0x50,0x0c,0xfb,0x00,0x00,0x03,0x31,0x02,0xf0,0x1c,0xdf,0xff,0xc0,0x00,0x8f,0xff,
-0xff,0x70,0x2f,0xff,0xff,0xff,0x2a,0xff,0xff,0xff,0xf9,0xef,0xef,0xff,0xff,0xdf,
-0xb7,0xff,0xff,0xfe,0xce,0x2d,0xff,0xff,0xb5,0xfc,0x36,0xff,0xf3,0x07,0xff,0xff,
-0xf6,0x00,0x02,0x89,0x72,0x9d,0x1c,0xf0,0x0a,0x02,0x42,0xfa,0x00,0x03,0xef,0x2f,
-0xa0,0x04,0xff,0xf2,0xfa,0x05,0xff,0xff,0x2f,0xa6,0xff,0xff,0xf2,0xfe,0xff,0xff,
-0xff,0x2f,0xff,0x01,0xf1,0x04,0xfc,0xdf,0xff,0xff,0x2f,0xa1,0xdf,0xff,0xf2,0xfa,
-0x01,0xcf,0xff,0x2f,0xa0,0x00,0xbf,0xf2,0xf9,0xe2,0x77,0x01,0xb1,0x29,0x00,0x01,
-0x00,0x22,0xef,0xc3,0xb5,0x01,0x11,0x91,0x06,0x00,0x21,0xff,0x70,0x06,0x00,0x31,
-0xfd,0x40,0x00,0x9d,0x00,0x21,0x10,0xff,0x44,0x02,0x11,0xff,0x61,0x02,0x00,0x05,
-0x00,0x21,0xfe,0x50,0xe1,0x00,0x00,0x1e,0x00,0x10,0xb2,0x2a,0x00,0x10,0xd4,0x36,
-0x00,0x11,0xf7,0x4e,0x4c,0x01,0xd4,0x01,0xff,0x03,0x26,0x66,0x10,0x16,0x66,0x30,
-0xef,0xff,0xc0,0xaf,0xff,0xf1,0xff,0xff,0xe0,0xbf,0xff,0xf2,0x06,0x00,0x19,0xb0,
-0xd0,0xbf,0xff,0xf2,0xaf,0xff,0x80,0x6e,0xff,0xc0,0x26,0x66,0x71,0x30,0x50,0xef,
-0xff,0x72,0x71,0x01,0x7e,0x00,0x1f,0xf6,0x06,0x00,0x1c,0x11,0xf5,0xd2,0x02,0xf3,
-0x09,0xd1,0x05,0x00,0x00,0x06,0x45,0xfb,0x00,0x01,0xfc,0x6f,0xfc,0x10,0x1f,0xc6,
-0xff,0xfd,0x11,0xfc,0x6f,0xff,0xfd,0x3f,0xc6,0x12,0x05,0x00,0x1d,0x05,0xf4,0x05,
+0x46,0xbc,0x03,0x30,0x25,0x00,0x36,0xbe,0x01,0xf0,0x1d,0x4f,0xfc,0x1a,0xf6,0x00,
+0x00,0x00,0x7f,0xe9,0xfe,0xcf,0x60,0x00,0x00,0xaf,0xc3,0x64,0xff,0xf6,0x00,0x01,
+0xcf,0xa3,0xef,0xa3,0xdf,0x90,0x03,0xef,0x75,0xff,0xff,0xc3,0xcf,0xb0,0xdf,0x48,
+0xff,0xff,0xff,0xe3,0x9f,0x72,0x27,0x4f,0x00,0xe0,0xf2,0x50,0x00,0x9f,0xff,0xcb,
+0xef,0xff,0x30,0x00,0x09,0xff,0xf1,0x07,0x9a,0x00,0xd0,0x9f,0xff,0x10,0x7f,0xff,
+0x30,0x00,0x07,0xff,0xe0,0x06,0xff,0xf2,0x74,0x0a,0x11,0x54,0x60,0x00,0x21,0x1f,
+0xff,0xc3,0x00,0x3d,0x2f,0xff,0x20,0x07,0x00,0x50,0x47,0x8f,0xff,0x87,0x40,0x39,
+0x00,0x01,0x7c,0x01,0x40,0x0a,0xff,0xff,0xfa,0x1c,0x00,0xf2,0x08,0xaf,0xff,0xa0,
+0x00,0x00,0x46,0x66,0x3a,0xfa,0x36,0x66,0x50,0xff,0xff,0xf4,0x54,0xff,0xff,0xf2,
+0xff,0xff,0xff,0xcf,0x07,0x00,0x60,0xff,0xf3,0xb8,0xf2,0x9b,0xbb,0x01,0x00,0xa1,
+0xa0,0x00,0x08,0xaa,0xaa,0xaa,0xa4,0x00,0x00,0x08,0x8f,0x00,0x30,0x00,0x03,0xfb,
+0x58,0x00,0x30,0xd0,0x00,0xdf,0x6f,0x00,0x31,0x6f,0x80,0x8f,0xc1,0x08,0xf1,0x03,
+0xbf,0x3f,0xfe,0xee,0x40,0x00,0x9e,0xee,0xf9,0xff,0xff,0xfc,0x44,0x5f,0xff,0xff,
+0xaf,0xff,0x01,0x00,0x22,0xfa,0xff,0x01,0x00,0x12,0x9a,0x07,0x00,0x11,0xf5,0x19,
+0x03,0xf0,0x0e,0x07,0x90,0x00,0x6d,0xff,0xfb,0x40,0xcf,0x00,0xbf,0xfd,0xbd,0xff,
+0xac,0xf0,0xbf,0xd3,0x00,0x03,0xcf,0xff,0x4f,0xd1,0x00,0x07,0xaa,0xff,0xf9,0xf5,
+0x97,0x00,0x30,0xff,0x01,0x00,0xe3,0x05,0x12,0x10,0x1a,0x02,0x01,0xae,0x00,0xf3,
+0x0e,0x4f,0x9f,0xff,0xab,0x70,0x00,0x0d,0xf4,0xff,0xfb,0x20,0x00,0x3c,0xfb,0x0f,
+0xcb,0xff,0xca,0xcf,0xfc,0x10,0xfc,0x05,0xcf,0xff,0xd7,0x00,0x09,0x70,0xbd,0x01,
+0xe4,0x05,0x20,0x00,0x06,0xf7,0x01,0x16,0xff,0x8f,0xff,0xff,0xf8,0xff,0xff,0x07,
+0x00,0xb2,0x8a,0xcc,0xef,0xf8,0x00,0x02,0xef,0x80,0x00,0x02,0xe7,0x39,0x07,0x20,
+0x04,0x20,0xb8,0x00,0xf0,0x02,0x70,0x00,0x01,0x16,0xff,0x80,0x00,0xef,0xff,0xff,
+0x82,0xb1,0xff,0xff,0xff,0x80,0xc9,0x05,0x00,0xe0,0x9b,0xff,0xff,0xff,0x82,0xf3,
+0xbd,0xdf,0xff,0x80,0x10,0x00,0x03,0xef,0x35,0x02,0x24,0x3e,0x70,0x6f,0x07,0x06,
+0x01,0x00,0x22,0x04,0xc2,0x6d,0x00,0xa0,0x0b,0xe1,0x00,0x00,0x06,0xf7,0x00,0xb7,
+0x0c,0xb0,0x4b,0x00,0xb0,0x05,0xf5,0x2f,0x3f,0xff,0xff,0xf8,0x2c,0x17,0xd0,0xb8,
+0x4b,0x00,0xb1,0xba,0x2f,0x18,0xbf,0xff,0xff,0xf8,0x09,0xb1,0xf2,0x7b,0x55,0x00,
+0x30,0x5e,0x0a,0x9a,0x89,0x00,0x30,0x2e,0x80,0xe4,0x8d,0x00,0x40,0x0c,0xa0,0x8d,
+0x00,0x91,0x00,0x31,0x10,0x7f,0x30,0x5f,0x00,0x24,0x4f,0x40,0x36,0x04,0x11,0x9f,
+0x29,0x01,0x40,0x9f,0xf9,0xbf,0xff,0xaa,0x03,0x30,0x00,0xdf,0xff,0x4d,0x00,0x90,
+0x0d,0xff,0xf8,0xaf,0xff,0xff,0x9b,0xff,0xf8,0x1d,0x01,0x80,0x6d,0xf8,0x00,0x00,
+0xcf,0xff,0x40,0x17,0xc9,0x01,0x11,0xa0,0xc8,0x01,0x61,0xfd,0xaa,0xaa,0xaa,0xaa,
+0xad,0x6c,0x01,0x00,0x2c,0x01,0x10,0x40,0xe0,0x00,0x80,0x50,0x00,0x00,0x0c,0xfb,
+0x00,0x00,0x03,0x31,0x02,0xf0,0x39,0xdf,0xff,0xc0,0x00,0x8f,0xff,0xff,0x70,0x2f,
+0xff,0xff,0xff,0x2a,0xff,0xff,0xff,0xf9,0xef,0xef,0xff,0xff,0xdf,0xb7,0xff,0xff,
+0xfe,0xce,0x2d,0xff,0xff,0xb5,0xfc,0x36,0xff,0xf3,0x07,0xff,0xff,0xf6,0x00,0x02,
+0x89,0x72,0x00,0x06,0x40,0x00,0x02,0x42,0xfa,0x00,0x03,0xef,0x2f,0xa0,0x04,0xff,
+0xf2,0xfa,0x05,0xff,0xff,0x2f,0xa6,0xff,0xff,0xf2,0xfe,0xff,0xff,0xff,0x2f,0xff,
+0x01,0xf0,0x0c,0xfc,0xdf,0xff,0xff,0x2f,0xa1,0xdf,0xff,0xf2,0xfa,0x01,0xcf,0xff,
+0x2f,0xa0,0x00,0xbf,0xf2,0xf9,0x00,0x00,0x9c,0x00,0x00,0x00,0x00,0x00,0x20,0x24,
+0x00,0x01,0x00,0x20,0xef,0xc3,0x06,0x00,0x31,0xff,0xff,0x91,0x06,0x00,0x21,0xff,
+0x70,0x06,0x00,0x20,0xfd,0x40,0x06,0x00,0x40,0xff,0xfa,0x10,0xff,0x01,0x00,0x11,
+0xf2,0x06,0x00,0x10,0xf3,0x05,0x00,0x20,0xfe,0x50,0x06,0x00,0x10,0x80,0x1e,0x00,
+0x10,0xb2,0x2a,0x00,0x10,0xd4,0x36,0x00,0x10,0xf7,0x42,0x00,0x20,0x48,0x10,0x06,
+0x00,0xff,0x03,0x26,0x66,0x10,0x16,0x66,0x30,0xef,0xff,0xc0,0xaf,0xff,0xf1,0xff,
+0xff,0xe0,0xbf,0xff,0xf2,0x06,0x00,0x19,0xf0,0x02,0xd0,0xbf,0xff,0xf2,0xaf,0xff,
+0x80,0x6e,0xff,0xc0,0x26,0x66,0x66,0x66,0x66,0x50,0xef,0x6d,0x00,0x11,0xf4,0x7e,
+0x00,0x1f,0xf6,0x06,0x00,0x1c,0x20,0xf5,0xaf,0x06,0x00,0xf3,0x29,0xd1,0x05,0x00,
+0x00,0x06,0x45,0xfb,0x00,0x01,0xfc,0x6f,0xfc,0x10,0x1f,0xc6,0xff,0xfd,0x11,0xfc,
+0x6f,0xff,0xfd,0x3f,0xc6,0xff,0xff,0xff,0xfc,0x6f,0xff,0xff,0xff,0xc6,0xff,0xff,
 0xfa,0xfc,0x6f,0xff,0xf7,0x1f,0xc6,0xff,0xf6,0x01,0xfc,0x6f,0xf5,0x00,0x1f,0xc3,
-0xe4,0x00,0x00,0xfb,0x3a,0x02,0x21,0x52,0x00,0xb0,0x01,0x30,0xe2,0x00,0x00,0x8d,
-0x03,0x01,0x17,0x1e,0x10,0xff,0x07,0x00,0x00,0x3b,0x00,0x30,0xc0,0x00,0x5f,0x62,
-0x00,0x21,0xb0,0x0e,0x6f,0x00,0xa0,0x40,0x8e,0xee,0xee,0xee,0xee,0xc1,0x02,0x44,
-0x44,0xf1,0x06,0x02,0x82,0x00,0x11,0x0f,0x07,0x00,0x30,0x60,0xcf,0xff,0x1e,0x04,
-0x02,0x63,0x06,0xd1,0x0b,0xf2,0x00,0x00,0xbf,0xf2,0x00,0x0b,0xff,0x30,0x00,0xbf,
-0xf3,0x07,0x00,0xb4,0x2f,0xf9,0x00,0x00,0x06,0xff,0x80,0x00,0x00,0x6f,0xf8,0x09,
-0x00,0x50,0xf4,0x00,0x00,0x05,0xb0,0xc4,0x02,0xb2,0x1e,0xc0,0x00,0x00,0x1e,0xfc,
-0x00,0x00,0x02,0xef,0xc0,0xab,0x05,0x01,0x09,0x00,0x20,0x7f,0xf4,0xc8,0x04,0x31,
-0x00,0x6f,0xf7,0x07,0x00,0x23,0x2f,0xf7,0x8d,0x4f,0x21,0x00,0x17,0x94,0x02,0x2f,
-0x8f,0xe0,0x06,0x00,0x01,0x15,0xdf,0xc1,0x01,0x8f,0xff,0xf5,0x36,0x66,0xbf,0xf6,
-0x66,0x50,0x2a,0x00,0x01,0x23,0x4d,0x90,0xdb,0x2c,0x09,0x30,0x00,0x30,0x35,0x55,
-0x55,0x12,0x3f,0x50,0x00,0x5a,0xcd,0xc8,0x20,0x57,0x74,0xf0,0x29,0xd7,0x69,0xff,
-0x90,0x00,0x04,0xff,0xa0,0x01,0x02,0xef,0xc1,0x02,0xff,0xf1,0x02,0xfc,0x16,0xff,
-0xb0,0xcf,0xfb,0x05,0xaf,0xf9,0x1f,0xff,0x6d,0xff,0xb1,0xff,0xff,0xb1,0xff,0xf7,
-0x4f,0xfe,0x0b,0xff,0xf5,0x5f,0xfc,0x00,0x6f,0xf9,0x08,0xa5,0x1d,0xfd,0x20,0x00,
-0x5e,0xfb,0x53,0x6e,0xfb,0x37,0x0c,0x64,0xce,0xfe,0xa4,0x00,0x00,0x32,0x30,0x0e,
-0x13,0xf5,0x09,0x00,0x60,0x3e,0xf9,0x05,0xac,0xdb,0x71,0xfe,0x08,0x60,0xff,0xfd,
-0x76,0xaf,0xf7,0x00,0xbb,0x04,0xf0,0x1f,0x31,0x30,0x4f,0xfa,0x00,0x00,0x32,0x04,
-0xef,0xbf,0xc0,0x9f,0xf8,0x00,0x0e,0xf5,0x02,0xcf,0xff,0x64,0xff,0xf3,0x01,0xff,
-0xf6,0x00,0x9f,0xf8,0x4f,0xff,0x40,0x06,0xff,0xc0,0x00,0x6f,0xeb,0xff,0xa0,0x00,
-0x09,0xff,0x60,0x00,0x3e,0xff,0x75,0x7e,0x50,0xff,0xa4,0x30,0x1b,0xfb,0x4a,0x1e,
-0x63,0x8d,0xff,0x80,0x08,0xfe,0x30,0xfc,0x03,0x23,0xef,0x20,0x18,0x19,0x14,0x70,
-0x0f,0x77,0x00,0x7a,0x0f,0x12,0xf8,0x08,0x00,0x12,0x7f,0x75,0x05,0x21,0x01,0xff,
-0x99,0x03,0x00,0x69,0x05,0x20,0xf4,0x00,0x2f,0x7e,0x21,0xf5,0x1a,0x25,0x07,0xf0,
+0xe4,0x00,0x00,0xfb,0x00,0x01,0x00,0x11,0x52,0x06,0x00,0x20,0xaf,0xe2,0x06,0x00,
+0x80,0x9f,0xff,0xd1,0x00,0x00,0x00,0x8f,0xff,0x07,0x00,0x00,0x3b,0x00,0x30,0xc0,
+0x00,0x5f,0x62,0x00,0x21,0xb0,0x0e,0x6f,0x00,0x90,0x40,0x8e,0xee,0xee,0xee,0xee,
+0xc1,0x02,0x44,0x01,0x00,0x12,0x00,0x82,0x00,0x11,0x0f,0x07,0x00,0x20,0x60,0xcf,
+0x06,0x00,0xf1,0x05,0xe3,0x00,0x00,0x00,0x10,0x00,0x00,0x0b,0xf2,0x00,0x00,0xbf,
+0xf2,0x00,0x0b,0xff,0x30,0x00,0xbf,0xf3,0x07,0x00,0xb4,0x2f,0xf9,0x00,0x00,0x06,
+0xff,0x80,0x00,0x00,0x6f,0xf8,0x09,0x00,0xf4,0x08,0xf4,0x00,0x00,0x05,0xb0,0x01,
+0x00,0x00,0x00,0x1e,0xc0,0x00,0x00,0x1e,0xfc,0x00,0x00,0x02,0xef,0xc0,0x00,0x00,
+0x2e,0x09,0x00,0x91,0x7f,0xf4,0x00,0x06,0xff,0x70,0x00,0x6f,0xf7,0x07,0x00,0x60,
+0x2f,0xf7,0x00,0x00,0x0a,0x70,0xa1,0x00,0x30,0x17,0x40,0x00,0xa1,0x00,0x1f,0xe0,
+0x06,0x00,0x01,0x15,0xdf,0xc1,0x01,0x8f,0xff,0xf5,0x36,0x66,0xbf,0xf6,0x66,0x50,
+0x2a,0x00,0x01,0x99,0x4d,0x90,0x00,0x00,0x01,0x11,0x11,0x11,0x11,0x30,0x00,0xf3,
+0x43,0x35,0x55,0x55,0x55,0x55,0x40,0x00,0x00,0x5a,0xcd,0xc8,0x20,0x00,0x00,0x02,
+0xdf,0xd7,0x69,0xff,0x90,0x00,0x04,0xff,0xa0,0x01,0x02,0xef,0xc1,0x02,0xff,0xf1,
+0x02,0xfc,0x16,0xff,0xb0,0xcf,0xfb,0x05,0xaf,0xf9,0x1f,0xff,0x6d,0xff,0xb1,0xff,
+0xff,0xb1,0xff,0xf7,0x4f,0xfe,0x0b,0xff,0xf5,0x5f,0xfc,0x00,0x6f,0xf9,0x08,0xa5,
+0x1d,0xfd,0x20,0x00,0x5e,0xfb,0x53,0x6e,0xfb,0x10,0x00,0x00,0x07,0xce,0xfe,0xa4,
+0x00,0x00,0x32,0x5e,0x01,0x23,0x0e,0xf5,0x09,0x00,0xe0,0x3e,0xf9,0x05,0xac,0xdb,
+0x71,0x00,0x00,0x00,0x1b,0xff,0xfd,0x76,0xaf,0x4e,0x02,0xf0,0x29,0x08,0xff,0x31,
+0x30,0x4f,0xfa,0x00,0x00,0x32,0x04,0xef,0xbf,0xc0,0x9f,0xf8,0x00,0x0e,0xf5,0x02,
+0xcf,0xff,0x64,0xff,0xf3,0x01,0xff,0xf6,0x00,0x9f,0xf8,0x4f,0xff,0x40,0x06,0xff,
+0xc0,0x00,0x6f,0xeb,0xff,0xa0,0x00,0x09,0xff,0x60,0x00,0x3e,0xff,0xc0,0x00,0x00,
+0x07,0xff,0xa4,0x30,0x1b,0x65,0x00,0x72,0x02,0x8d,0xff,0x80,0x08,0xfe,0x30,0x5b,
+0x00,0x32,0x04,0xef,0x20,0x09,0x00,0x10,0x02,0x24,0x01,0x22,0x01,0x40,0x0d,0x00,
+0x22,0x0d,0xf8,0x08,0x00,0x21,0x7f,0xff,0x1e,0x00,0x40,0x01,0xff,0xff,0xa0,0x08,
+0x00,0x40,0x0a,0xff,0xff,0xf4,0x08,0x00,0x40,0x3f,0xf5,0x1a,0xfd,0x08,0x00,0xf0,
 0x06,0xcf,0xf4,0x0a,0xff,0x60,0x00,0x00,0x05,0xff,0xf5,0x0a,0xff,0xe1,0x00,0x00,
-0x0e,0xff,0xf6,0x0b,0xff,0xf9,0x04,0x02,0xf2,0x07,0xfd,0x8f,0xff,0xff,0x20,0x02,
-0xff,0xff,0xf3,0x09,0xff,0xff,0xb0,0x0a,0xff,0xff,0xf7,0x1c,0xff,0xff,0xf4,0x0e,
-0x34,0x05,0x40,0xf8,0x04,0x9a,0xaa,0x01,0x00,0x16,0x91,0x22,0x6d,0x70,0x00,0x3f,
-0xa0,0xef,0xfa,0x00,0x05,0x66,0x05,0xf0,0x02,0xf9,0x04,0xff,0xff,0xfb,0x11,0x3f,
-0xa4,0xff,0x84,0xfc,0x00,0x00,0x33,0xff,0x90,0x19,0xd5,0x01,0xd0,0xa2,0x01,0x70,
-0x00,0x02,0xef,0xa4,0xf6,0x3f,0xa0,0xef,0xff,0xb0,0x8d,0x05,0x00,0xdd,0x00,0x20,
-0xff,0xfb,0x51,0x05,0x34,0x14,0xfc,0x00,0x24,0x24,0x02,0xd6,0x04,0x20,0x5f,0xa0,
-0xcd,0x04,0x01,0x11,0x06,0xf0,0x09,0x5f,0xfa,0xff,0xa0,0x00,0x05,0xff,0x90,0x3f,
-0xfa,0x00,0x4f,0xf9,0x00,0x03,0xff,0xa0,0xbf,0x90,0x00,0x00,0x3f,0xf1,0x15,0x5f,
-0x0b,0x02,0xcc,0x25,0xf0,0x09,0x10,0x9f,0x50,0x00,0x00,0x1d,0xe1,0x8f,0xf5,0x00,
-0x01,0xdf,0xd0,0x08,0xff,0x50,0x1d,0xfd,0x10,0x00,0x8f,0xf6,0xdf,0xd1,0x61,0x01,
-0x20,0xfd,0x10,0xf8,0x01,0x02,0xb5,0x74,0x10,0x10,0x0d,0x7d,0x13,0x10,0x14,0x01,
-0x20,0xfd,0x18,0xe2,0x03,0x00,0xe5,0x78,0xf0,0x02,0x4a,0xaa,0xaa,0xfb,0x00,0x0c,
-0xda,0xf7,0xf4,0x00,0x00,0x0e,0xb0,0x00,0x00,0x9f,0x11,0xdf,0x16,0x53,0x00,0x00,
-0x09,0xf1,0x00,0x11,0x00,0xc0,0x10,0x00,0x02,0xe6,0xeb,0x9d,0x00,0x09,0xf9,0x99,
-0x99,0x4d,0x44,0x01,0x63,0x7f,0xff,0xff,0xfb,0x1d,0xff,0xd8,0x1c,0x17,0x1d,0x5b,
-0x5d,0x11,0x6b,0x0a,0x0d,0x62,0x0f,0xff,0xff,0xf8,0x22,0x22,0x54,0x04,0x00,0xb8,
-0x06,0x0f,0x01,0x00,0x11,0x05,0x26,0x05,0x22,0x00,0x30,0x9d,0x0b,0x02,0xbb,0x01,
-0x10,0x8f,0x2a,0x03,0x00,0xe2,0x06,0x11,0xf8,0xc7,0x01,0x01,0xb8,0x04,0x5f,0x69,
-0x9f,0xff,0x99,0x60,0x52,0x07,0x03,0x50,0x46,0x66,0x2f,0xff,0x26,0x36,0x07,0x30,
-0x46,0x76,0x4f,0x69,0x04,0x2e,0xfc,0xbc,0x36,0x07,0x14,0x00,0x2e,0x77,0x22,0x00,
-0x01,0x70,0x07,0x31,0x07,0xff,0xff,0xa7,0x02,0x02,0x32,0x09,0x12,0x0c,0x15,0x00,
-0x32,0x00,0xbf,0xf6,0x07,0x00,0x00,0x05,0x01,0x00,0xb1,0x03,0x00,0xe6,0x3f,0xf0,
-0x01,0x4f,0xfd,0x00,0x03,0xaf,0xf8,0x07,0xff,0xf2,0x00,0x0e,0xff,0xff,0xef,0xfe,
-0x30,0x37,0x0a,0x21,0xff,0xc2,0xa0,0x00,0x01,0xc6,0x77,0x22,0x98,0x62,0x53,0x35,
-0x00,0xc5,0x01,0xf1,0x05,0x8f,0xff,0x60,0x00,0xaf,0xf3,0xec,0x2e,0xc0,0x1c,0xff,
-0xa0,0xde,0x9f,0xd1,0xdf,0xfa,0x00,0x3e,0xff,0x80,0x02,0x11,0x2d,0x61,0x00,0x10,
-0x1c,0x4e,0x05,0x10,0x2d,0x38,0x04,0xf0,0x0a,0x00,0xcf,0xaf,0xd2,0xef,0xf6,0x00,
-0xfb,0x0d,0xd0,0x2e,0xff,0x60,0xbf,0xef,0x80,0x02,0xef,0xf3,0x19,0xc8,0x00,0x00,
-0x16,0x40,0xbe,0x0d,0x20,0x12,0x00,0x64,0x00,0xf1,0x01,0x3f,0x40,0x00,0x0c,0xff,
-0xff,0x3f,0xf2,0xdf,0x6c,0xff,0xff,0x53,0x31,0xff,0x7c,0xfe,0x04,0x0f,0x06,0x00,
-0x0b,0x10,0x7b,0xd3,0x03,0x71,0xff,0xc2,0x33,0x33,0x33,0x20,0xff,0x39,0x76,0x10,
-0x8a,0x67,0x68,0x00,0xce,0x0d,0x32,0x99,0x60,0x00,0xc4,0x06,0x10,0xfa,0x02,0x01,
-0x20,0x80,0xfa,0x1c,0x06,0x11,0xf3,0x06,0x00,0x72,0xf5,0xfe,0xaa,0xaa,0xaa,0xff,
-0xf5,0x0f,0x04,0x40,0xff,0xff,0x80,0x4f,0x06,0x00,0x20,0x10,0x0c,0x06,0x00,0x20,
-0x50,0x1e,0x06,0x00,0x51,0xfb,0xef,0xff,0xf5,0x9f,0x70,0x05,0x61,0xcd,0xdd,0xdd,
-0xdd,0xdd,0xd4,0xb8,0x05,0x04,0xde,0x03,0x04,0xc1,0x18,0x4f,0xcc,0xcc,0xc3,0xff,
-0x18,0x00,0x10,0x20,0x6b,0xcc,0x60,0x19,0x12,0x6f,0xfe,0x01,0x02,0x5e,0x07,0x11,
-0x95,0x0e,0x00,0x70,0x65,0xf9,0x3d,0xff,0xff,0xfd,0x39,0x03,0x00,0x20,0xf9,0x3d,
-0x10,0x00,0x11,0xa4,0x17,0x00,0x2c,0xb7,0xbf,0x2b,0x02,0x80,0x55,0x55,0x20,0x00,
-0x03,0xff,0xff,0x90,0x72,0x03,0x10,0x40,0x84,0x01,0x00,0xda,0x03,0x40,0xfc,0x44,
-0x40,0x0c,0xd2,0x0b,0x12,0x0e,0xa0,0x07,0x20,0xff,0xfe,0x45,0x02,0x10,0xf6,0xc9,
-0x01,0x10,0xc0,0xc3,0x06,0x50,0x30,0x00,0x00,0x03,0xfa,0xf4,0x01,0x10,0xf1,0x3e,
-0x03,0x05,0x54,0x15,0xb0,0x35,0x6e,0xf7,0x54,0x00,0x00,0xff,0xf9,0x8f,0xff,0x10,
-0x1d,0x01,0x00,0x06,0x00,0xb0,0xfa,0x24,0x44,0x01,0x00,0xff,0xf4,0xef,0xff,0x3e,
-0x20,0x9b,0x06,0x20,0x3f,0xe2,0x06,0x00,0x21,0x43,0x31,0xa7,0x06,0x18,0xf6,0x06,
-0x00,0x40,0x23,0x30,0xff,0xff,0xb2,0x0a,0x01,0x06,0x00,0x00,0xa0,0x59,0x13,0xa2,
-0x2d,0x53,0x40,0x00,0x1f,0x70,0x00,0xc9,0x0a,0x21,0xfa,0x10,0x50,0x06,0x40,0xd0,
-0x00,0x01,0xff,0x76,0x80,0x10,0x04,0x84,0x78,0x21,0x00,0x07,0x92,0x0a,0x01,0x5f,
-0x78,0x20,0x00,0x0d,0x06,0x00,0x20,0x30,0x7f,0x06,0x00,0x12,0xd0,0x0b,0x07,0x20,
-0x13,0x33,0xb9,0x01,0x41,0x00,0x00,0xcf,0xf2,0xc4,0x0b,0x51,0x50,0x00,0x00,0x5a,
-0xaa,0x01,0x00,0x12,0x2f,0x03,0x01,0xf0,0x1a,0xf9,0xfa,0x0d,0x01,0xb0,0xd0,0xa2,
-0x0f,0xaf,0xeb,0xfb,0xcf,0xbf,0xbe,0xcb,0xfa,0xff,0xe1,0x98,0x1c,0x1c,0x15,0xff,
-0xaf,0xfd,0x08,0x70,0xb0,0xb0,0x3f,0xfa,0xff,0xdf,0xdd,0xdd,0xdd,0xfd,0xdf,0xaf,
-0xa0,0xd0,0xb9,0x2d,0x87,0xfa,0xfe,0xaf,0xaa,0xaa,0xaa,0xeb,0xaf,0xed,0x09,0x00,
-0x8d,0x49,0x02,0xb7,0x37,0x20,0xef,0xd0,0x09,0x03,0x11,0x8f,0xc1,0x7b,0x70,0x29,
-0xff,0xff,0xff,0x50,0x00,0x03,0x69,0x01,0x41,0xe0,0x00,0x3c,0xff,0xae,0x00,0x00,
-0xdd,0x06,0x00,0x45,0x01,0x12,0x9e,0x10,0x08,0x00,0x8f,0x04,0x00,0x4b,0x80,0x00,
-0x9c,0x04,0x12,0xf9,0xa9,0x04,0x02,0x7f,0x03,0x13,0x05,0x0f,0x04,0x26,0x4f,0xf3,
-0x70,0x42,0x30,0x34,0x44,0x43,0x4f,0x01,0x20,0xfb,0x8a,0x05,0x00,0xc1,0x8f,0xa0,
-0xff,0xff,0xfb,0x7f,0xf8,0xff,0xff,0xfc,0x11,0x11,0xaa,0x0c,0x0f,0x05,0x00,0x10,
-0x50,0xbd,0xdd,0xdd,0xdd,0xd8,0x9f,0x01,0x21,0x54,0x10,0x3e,0x1a,0xf0,0x02,0xff,
-0xff,0xff,0xd8,0x10,0x00,0x04,0xef,0xff,0xdb,0xbc,0xff,0xff,0x70,0x08,0xff,0xd6,
-0x0a,0x3d,0xf0,0x0b,0xff,0xb0,0xbf,0x70,0x00,0x13,0x32,0x00,0x05,0xed,0x10,0x30,
-0x06,0xdf,0xff,0xfe,0x80,0x01,0x10,0x00,0x0b,0xff,0xfc,0xce,0xff,0xd2,0xac,0x54,
-0x51,0x60,0x00,0x04,0xde,0x10,0x68,0x33,0x12,0x40,0xfc,0x0d,0x23,0x04,0xff,0x5d,
-0x1f,0x23,0x6f,0xfa,0xb5,0x11,0x10,0xac,0x72,0x04,0x03,0x19,0x0b,0x31,0xd2,0x0f,
-0xea,0x68,0x01,0xc1,0xcf,0x90,0xfa,0x48,0x88,0x88,0x88,0x88,0x65,0xff,0x1f,0xa9,
-0x3d,0x0c,0x32,0x1a,0xf1,0xfa,0xfa,0x02,0xc0,0xaf,0x1f,0xa5,0x99,0x99,0x99,0x99,
-0x98,0x5f,0xf1,0xfd,0x99,0x01,0x00,0x33,0x9b,0xfa,0x0b,0x98,0x02,0x06,0x48,0x43,
-0x0f,0x4d,0x00,0x03,0x22,0x30,0x05,0x4d,0x00,0x23,0xf7,0x00,0x4d,0x00,0x22,0x70,
-0x01,0x4d,0x00,0x2f,0x94,0x00,0x4d,0x00,0x1e,0x22,0x00,0x00,0x4d,0x00,0x23,0xf0,
-0x00,0x4d,0x00,0x22,0x00,0x00,0x4d,0x00,0x2f,0x90,0x00,0x4d,0x00,0x1d,0x23,0x85,
-0x00,0x4d,0x00,0x22,0xa0,0x00,0x4d,0x00,0x23,0xfa,0x00,0x4d,0x00,0x2f,0x60,0x00,
-0x4d,0x00,0x1d,0x22,0x00,0x00,0x4d,0x00,0x01,0x0c,0x02,0x00,0x4d,0x00,0x02,0x62,
-0x01,0x13,0xaf,0x11,0x00,0x0f,0x4d,0x00,0x09,0x01,0x73,0x1d,0x13,0x50,0x95,0x02,
-0x12,0xfc,0x79,0x19,0x11,0xd0,0x11,0x00,0x31,0x64,0x00,0xa5,0x56,0x09,0xf0,0x06,
-0xbf,0xf6,0x4e,0x21,0x11,0x11,0x17,0xd3,0x0f,0xff,0xec,0xce,0xec,0xcc,0xcc,0xef,
-0xe1,0x7f,0xe3,0x00,0x2d,0x22,0x32,0x00,0xd9,0x01,0x42,0x97,0x0a,0xa6,0x00,0x18,
-0x3b,0x04,0x98,0x06,0x29,0x2f,0xfa,0x5c,0x00,0x20,0x01,0x10,0x89,0x00,0xf0,0x38,
+0x0e,0xff,0xf6,0x0b,0xff,0xf9,0x04,0x02,0xf2,0x06,0xfd,0x8f,0xff,0xff,0x20,0x02,
+0xff,0xff,0xf3,0x09,0xff,0xff,0xb0,0x0a,0xff,0xff,0xf7,0x1c,0xff,0xff,0xf4,0x09,
+0x02,0x50,0xff,0xf8,0x04,0x9a,0xaa,0x01,0x00,0x11,0x91,0x5a,0x00,0x21,0x70,0x00,
+0x51,0x00,0xf0,0x0b,0xa0,0xef,0xfa,0x00,0x05,0xff,0xff,0xaf,0xff,0xf9,0x04,0xff,
+0xff,0xfb,0x11,0x3f,0xa4,0xff,0x84,0xfc,0x00,0x00,0x33,0xff,0x90,0x19,0xd5,0x01,
+0xe0,0xa2,0x01,0x70,0x00,0x02,0xef,0xa4,0xf6,0x3f,0xa0,0xef,0xff,0xb0,0x5f,0x27,
+0x00,0xb1,0xc0,0x00,0x6f,0xff,0xfb,0x11,0x10,0x00,0x00,0x14,0xfc,0x41,0x00,0x10,
+0x19,0x4c,0x00,0x01,0x0a,0x00,0x30,0x5f,0xa0,0x00,0x92,0x00,0x10,0xfa,0x0b,0x00,
+0xf1,0x0d,0xfa,0xff,0xa0,0x00,0x05,0xff,0x90,0x3f,0xfa,0x00,0x4f,0xf9,0x00,0x03,
+0xff,0xa0,0xbf,0x90,0x00,0x00,0x3f,0xf1,0x15,0x00,0x00,0x00,0x03,0x30,0x2e,0x00,
+0xf0,0x09,0x10,0x9f,0x50,0x00,0x00,0x1d,0xe1,0x8f,0xf5,0x00,0x01,0xdf,0xd0,0x08,
+0xff,0x50,0x1d,0xfd,0x10,0x00,0x8f,0xf6,0xdf,0xd1,0x61,0x01,0x20,0xfd,0x10,0xf8,
+0x01,0x20,0xd1,0x00,0x4f,0x00,0x00,0x0b,0x00,0x23,0x7d,0x10,0x14,0x01,0x21,0xfd,
+0x18,0xe2,0x03,0xf3,0x0e,0x6f,0xff,0xfd,0x4a,0xaa,0xaa,0xfb,0x00,0x0c,0xda,0xf7,
+0xf4,0x00,0x00,0x0e,0xb0,0x00,0x00,0x9f,0x11,0x00,0x00,0x00,0xeb,0x00,0x00,0x09,
+0xf1,0x00,0x11,0x00,0xc0,0x10,0x00,0x02,0xe6,0xeb,0x9d,0x00,0x09,0xf9,0x99,0x99,
+0x4d,0x44,0x01,0x72,0x7f,0xff,0xff,0xfb,0x1d,0xff,0xa0,0x49,0x00,0x35,0x1d,0xa0,
+0x00,0x01,0x00,0xd2,0x6b,0xcc,0xc7,0x00,0x00,0x00,0x0f,0xff,0xff,0xf8,0x22,0x22,
+0x10,0x28,0x01,0x2f,0xcf,0xff,0x01,0x00,0x12,0x11,0xfa,0x06,0x00,0x00,0xef,0x00,
+0x02,0xd2,0x01,0x12,0x08,0xbb,0x01,0x31,0x8f,0xff,0x80,0x27,0x02,0x21,0xff,0xf8,
+0xc7,0x01,0x01,0xb8,0x04,0x92,0x69,0x9f,0xff,0x99,0x60,0x00,0x00,0x00,0x2f,0xd6,
+0x01,0x08,0x07,0x00,0xc0,0x46,0x66,0x2f,0xff,0x26,0x66,0x50,0xff,0xff,0x46,0x76,
+0x4f,0x69,0x04,0x23,0xfc,0xbc,0xd6,0x04,0x50,0xf3,0xb8,0xf2,0x9b,0xbb,0x01,0x00,
+0x02,0xad,0x00,0x21,0x33,0x00,0x10,0x02,0x00,0x70,0x00,0x00,0x52,0x02,0x11,0xff,
+0xa7,0x02,0x11,0xff,0x0d,0x02,0x12,0x0c,0x15,0x00,0x32,0x00,0xbf,0xf6,0x07,0x00,
+0x00,0x05,0x01,0x01,0xb1,0x03,0xf1,0x0a,0x01,0x50,0x00,0x4f,0xfd,0x00,0x03,0xaf,
+0xf8,0x07,0xff,0xf2,0x00,0x0e,0xff,0xff,0xef,0xfe,0x30,0x00,0x0b,0xff,0xff,0xff,
+0xc2,0xa0,0x00,0x10,0xd5,0x7c,0x02,0x21,0x98,0x62,0x67,0x01,0x10,0x84,0xc5,0x01,
+0xf1,0x05,0x8f,0xff,0x60,0x00,0xaf,0xf3,0xec,0x2e,0xc0,0x1c,0xff,0xa0,0xde,0x9f,
+0xd1,0xdf,0xfa,0x00,0x3e,0xff,0x80,0x02,0x11,0x2d,0x61,0x00,0x10,0x1c,0x4e,0x05,
+0x10,0x2d,0x38,0x04,0xf0,0x10,0x00,0xcf,0xaf,0xd2,0xef,0xf6,0x00,0xfb,0x0d,0xd0,
+0x2e,0xff,0x60,0xbf,0xef,0x80,0x02,0xef,0xf3,0x19,0xc8,0x00,0x00,0x16,0x40,0x00,
+0x02,0x66,0x66,0x12,0x00,0x64,0x00,0xf1,0x01,0x3f,0x40,0x00,0x0c,0xff,0xff,0x3f,
+0xf2,0xdf,0x6c,0xff,0xff,0x53,0x31,0xff,0x7c,0xfe,0x04,0x0f,0x06,0x00,0x0b,0x10,
+0x7b,0xd3,0x03,0x60,0xff,0xc2,0x33,0x33,0x33,0x20,0x00,0x01,0xe1,0x20,0x00,0x8a,
+0xaa,0xaa,0xa9,0x00,0x00,0x49,0x99,0x99,0x99,0x60,0x00,0xc0,0x02,0x20,0x00,0xfa,
+0x02,0x01,0x20,0x80,0xfa,0x1c,0x06,0x11,0xf3,0x06,0x00,0x72,0xf5,0xfe,0xaa,0xaa,
+0xaa,0xff,0xf5,0x0f,0x04,0x40,0xff,0xff,0x80,0x4f,0x06,0x00,0x20,0x10,0x0c,0x06,
+0x00,0x20,0x50,0x1e,0x06,0x00,0x51,0xfb,0xef,0xff,0xf5,0x9f,0x70,0x05,0x71,0xcd,
+0xdd,0xdd,0xdd,0xdd,0xd4,0xef,0x2a,0x00,0x17,0x00,0x01,0x00,0x7f,0xbc,0xcc,0xcc,
+0xcc,0xcc,0xc3,0xff,0x18,0x00,0x10,0x10,0x6b,0x12,0x00,0x22,0xcb,0x6f,0xfe,0x01,
+0x11,0x9f,0x06,0x00,0x11,0x95,0x0e,0x00,0x70,0x65,0xf9,0x3d,0xff,0xff,0xfd,0x39,
+0x03,0x00,0x20,0xf9,0x3d,0x10,0x00,0x11,0xa4,0x17,0x00,0x2c,0xb7,0xbf,0x2b,0x02,
+0x80,0x55,0x55,0x20,0x00,0x03,0xff,0xff,0x90,0x72,0x03,0x10,0x40,0x84,0x01,0x00,
+0xda,0x03,0x90,0xfc,0x44,0x40,0x0c,0xff,0xff,0xff,0xf0,0x0e,0xdd,0x02,0x40,0x0d,
+0xff,0xff,0xfe,0x45,0x02,0x10,0xf6,0xc9,0x01,0x10,0xc0,0xc3,0x06,0x50,0x30,0x00,
+0x00,0x03,0xfa,0xf4,0x01,0x10,0xf1,0x3e,0x03,0x14,0x50,0x9f,0x00,0xb0,0x35,0x6e,
+0xf7,0x54,0x00,0x00,0xff,0xf9,0x8f,0xff,0x10,0x1d,0x01,0x00,0x06,0x00,0xb0,0xfa,
+0x24,0x44,0x01,0x00,0xff,0xf4,0xef,0xff,0x3e,0x20,0x9b,0x06,0x20,0x3f,0xe2,0x06,
+0x00,0x21,0x43,0x31,0xa7,0x06,0x18,0xf6,0x06,0x00,0x20,0x23,0x30,0x06,0x00,0x22,
+0x00,0x00,0x06,0x00,0x71,0x7a,0xaa,0xaa,0xa2,0x00,0x00,0x03,0x56,0x00,0x20,0x1f,
+0x70,0x6a,0x00,0x31,0xef,0xfa,0x10,0x50,0x06,0x10,0xd0,0x80,0x04,0xa0,0xff,0xf7,
+0x00,0x04,0xff,0xff,0xff,0xfb,0x00,0x07,0x7e,0x07,0x20,0x00,0x09,0x6d,0x00,0x20,
+0x00,0x0d,0x06,0x00,0x20,0x30,0x7f,0x06,0x00,0x12,0xd0,0x0b,0x07,0x20,0x13,0x33,
+0xb9,0x01,0x40,0x00,0x00,0xcf,0xf2,0x48,0x00,0x61,0x29,0x50,0x00,0x00,0x5a,0xaa,
+0x01,0x00,0x12,0x2f,0x03,0x01,0xf8,0x28,0xf9,0xfa,0x0d,0x01,0xb0,0xd0,0xa2,0x0f,
+0xaf,0xeb,0xfb,0xcf,0xbf,0xbe,0xcb,0xfa,0xff,0xe1,0x98,0x1c,0x1c,0x15,0xff,0xaf,
+0xfd,0x08,0x70,0xb0,0xb0,0x3f,0xfa,0xff,0xdf,0xdd,0xdd,0xdd,0xfd,0xdf,0xaf,0xa0,
+0xd0,0x00,0x00,0x0a,0x20,0xfa,0xfe,0xaf,0xaa,0xaa,0xaa,0xeb,0xaf,0x9a,0xff,0x80,
+0x01,0x31,0x41,0x00,0x00,0x9e,0x00,0x10,0xd0,0x09,0x03,0x30,0x8f,0xff,0xfc,0x68,
+0x00,0x60,0xff,0xff,0xff,0x50,0x00,0x03,0x69,0x01,0x41,0xe0,0x00,0x3c,0xff,0xae,
+0x00,0x00,0xdd,0x06,0x00,0x45,0x01,0x12,0x9e,0x10,0x08,0x00,0x8f,0x04,0x31,0xff,
+0xf1,0x00,0x9c,0x04,0x12,0xf9,0xa9,0x04,0x02,0x7f,0x03,0x13,0x05,0x0f,0x04,0x22,
+0x4f,0xf3,0x5f,0x00,0x70,0x76,0x00,0x00,0x00,0x34,0x44,0x43,0x4f,0x01,0x20,0xfb,
+0x8a,0x05,0x00,0xd0,0x8f,0xa0,0xff,0xff,0xfb,0x7f,0xf8,0xff,0xff,0xfc,0x11,0x11,
+0xff,0x98,0x07,0x0f,0x05,0x00,0x10,0x50,0xbd,0xdd,0xdd,0xdd,0xd8,0x9f,0x01,0x11,
+0x54,0xb5,0x04,0xf0,0x2a,0x6c,0xff,0xff,0xff,0xd8,0x10,0x00,0x04,0xef,0xff,0xdb,
+0xbc,0xff,0xff,0x70,0x08,0xff,0xd6,0x10,0x00,0x00,0x4b,0xff,0xb0,0xbf,0x70,0x00,
+0x13,0x32,0x00,0x05,0xed,0x10,0x30,0x06,0xdf,0xff,0xfe,0x80,0x01,0x10,0x00,0x0b,
+0xff,0xfc,0xce,0xff,0xd2,0x00,0x00,0x00,0xbe,0x60,0x00,0x04,0xde,0x10,0x23,0x05,
+0x41,0x03,0x40,0x00,0x10,0x2a,0x06,0x22,0xff,0x80,0xa2,0x00,0x32,0x6f,0xfa,0x00,
+0x06,0x04,0x20,0xac,0x30,0xfd,0x07,0x02,0x1d,0x01,0x31,0xd2,0x0f,0xea,0x68,0x01,
+0xd0,0xcf,0x90,0xfa,0x48,0x88,0x88,0x88,0x88,0x65,0xff,0x1f,0xa9,0xff,0xab,0x01,
+0x32,0x1a,0xf1,0xfa,0xfa,0x02,0xc0,0xaf,0x1f,0xa5,0x99,0x99,0x99,0x99,0x98,0x5f,
+0xf1,0xfd,0x99,0x01,0x00,0x33,0x9b,0xfa,0x0b,0x98,0x02,0x03,0x8b,0x06,0x0f,0x4d,
+0x00,0x06,0x22,0x30,0x05,0x4d,0x00,0x23,0xf7,0x00,0x4d,0x00,0x22,0x70,0x01,0x4d,
+0x00,0x2f,0x94,0x00,0x4d,0x00,0x1e,0x22,0x00,0x00,0x4d,0x00,0x23,0xf0,0x00,0x4d,
+0x00,0x22,0x00,0x00,0x4d,0x00,0x2f,0x90,0x00,0x4d,0x00,0x1d,0x23,0x85,0x00,0x4d,
+0x00,0x22,0xa0,0x00,0x4d,0x00,0x23,0xfa,0x00,0x4d,0x00,0x2f,0x60,0x00,0x4d,0x00,
+0x1d,0x22,0x00,0x00,0x4d,0x00,0x01,0x0c,0x02,0x00,0x4d,0x00,0x02,0x62,0x01,0x13,
+0xaf,0x11,0x00,0x0f,0x4d,0x00,0x09,0x00,0x01,0x00,0x23,0x5c,0x50,0x95,0x02,0x02,
+0x0e,0x07,0x21,0x03,0xd0,0x11,0x00,0x31,0x64,0x00,0xa5,0x56,0x09,0xf0,0x0a,0xbf,
+0xf6,0x4e,0x21,0x11,0x11,0x17,0xd3,0x0f,0xff,0xec,0xce,0xec,0xcc,0xcc,0xef,0xe1,
+0x7f,0xe3,0x00,0x2d,0x00,0x00,0x06,0x80,0xd9,0x01,0x32,0x97,0x0a,0xa6,0x44,0x00,
+0x14,0xcc,0x98,0x06,0x29,0x2f,0xfa,0x5c,0x00,0x20,0x01,0x10,0x89,0x00,0xf2,0x42,
 0xff,0xe8,0x00,0x00,0xdf,0xf8,0xcf,0xf8,0x00,0x7f,0xff,0x81,0xdf,0xf1,0x0c,0xfa,
 0xf8,0x52,0xdf,0x60,0xff,0x64,0x78,0x3a,0xf8,0x0f,0xff,0x50,0x08,0xff,0xa1,0xff,
 0xff,0x12,0xff,0xfa,0x0f,0xff,0x41,0x15,0xff,0xa0,0xef,0x46,0x88,0x48,0xf8,0x0b,
 0xfc,0xf8,0x42,0xef,0x50,0x5f,0xff,0x82,0xef,0xf1,0x00,0xaf,0xfa,0xef,0xf6,0x00,
-0x00,0x5a,0xdc,0xa4,0x00,0x00,0x01,0x37,0x7d,0x62,0x78,0x8b,0xff,0xfe,0x88,0x82,
-0x53,0x03,0x00,0x4c,0x23,0x31,0x22,0x20,0x3f,0x2d,0x7c,0xbf,0x3f,0xfc,0xfc,0xfe,
-0xdf,0x90,0x3f,0xd5,0xf4,0xeb,0x7f,0x06,0x00,0x07,0x61,0xe6,0xf5,0xec,0x8f,0x90,
-0x2f,0x54,0x03,0x43,0x07,0x9a,0xaa,0xaa,0x32,0x1e,0x12,0x14,0xf7,0x00,0x22,0xef,
-0xa0,0x89,0x06,0x10,0xf9,0x0d,0x00,0x30,0xc3,0xdf,0xff,0x3b,0x09,0x30,0xfd,0x3d,
-0xf5,0x1a,0x00,0x40,0xff,0xd3,0x50,0x00,0x49,0x06,0x02,0x0d,0x00,0x21,0xff,0x60,
-0x0d,0x00,0x15,0xf6,0x0d,0x00,0x11,0x0b,0x0d,0x00,0x00,0x51,0x04,0x11,0x60,0x88,
-0x07,0x11,0xf6,0x4b,0x07,0x23,0x86,0x30,0x5a,0x30,0x00,0x73,0x05,0x14,0xb6,0xb8,
-0x01,0xf0,0x0d,0xf2,0x00,0xbf,0xff,0xf8,0xbf,0xf6,0xef,0xff,0x40,0xbf,0xff,0xff,
-0x10,0xa4,0x09,0xff,0xf4,0xaf,0xff,0xff,0xfd,0x10,0x07,0xff,0xff,0x4d,0xff,0x21,
-0x09,0xf3,0x07,0xbf,0xff,0xf4,0x1d,0xff,0xff,0xf4,0x06,0x10,0xbf,0xff,0x40,0x1d,
-0xff,0xff,0x47,0xfd,0x2b,0xff,0xf4,0x00,0x1d,0xb7,0x01,0x00,0x2f,0x10,0x01,0xcf,
-0x06,0x50,0x08,0x99,0x99,0x70,0x00,0x52,0x0d,0x60,0x0a,0xd0,0xd0,0xd0,0xeb,0x9f,
-0x05,0x00,0x60,0xff,0xd1,0xd1,0xd1,0xeb,0xff,0xe6,0x04,0x0f,0x05,0x00,0x0b,0x10,
-0xef,0xc6,0x05,0x54,0x5c,0xdd,0xdd,0xdd,0xb2,0xdb,0x37,0x10,0x03,0x7a,0x10,0x10,
-0xf0,0x70,0x08,0xa2,0x00,0x0f,0xf0,0x0a,0xff,0x21,0x11,0x11,0x1f,0xf0,0xad,0x00,
-0x12,0xf0,0x22,0x06,0x21,0xd0,0x08,0x4d,0x0f,0x00,0x14,0x80,0x06,0x71,0x15,0x0a,
-0x01,0x00,0x02,0x3b,0x02,0x0e,0x01,0x00,0x04,0x8f,0x06,0x17,0xf4,0x14,0x00,0x7e,
-0xfb,0xfa,0x00,0xfe,0xfa,0x00,0xf8,0x49,0x00,0x02,0x4b,0x0a,0x3e,0x02,0x00,0x02,
-0x16,0x00,0x2f,0xef,0x00,0x01,0x00,0x15,0x1f,0xe9,0x1e,0x00,0x0a,0x03,0x88,0x00,
-0xa2,0xfa,0x00,0xff,0x00,0x00,0xf3,0xfe,0xf7,0xf9,0x00,0x70,0x08,0x00,0x0f,0x00,
-0x4d,0xfe,0xff,0xfb,0xfd,0x92,0x00,0x5a,0xfd,0x00,0xfe,0x00,0x00,0xd3,0x02,0x05,
-0x1a,0x00,0x0b,0x0a,0x00,0x19,0xff,0x1f,0x00,0x12,0xfe,0x07,0x00,0x13,0xf6,0x0b,
-0x00,0x00,0x48,0x00,0x3f,0xfe,0xfc,0xfe,0x9c,0x00,0x0a,0x15,0x02,0x3c,0x00,0x11,
-0xfe,0x34,0x00,0x26,0xfe,0xfd,0x30,0x00,0x11,0xe8,0x04,0x01,0x15,0xe5,0x24,0x00,
-0x20,0xfd,0xfe,0x20,0x00,0x01,0x2b,0x00,0x0d,0x44,0x00,0x10,0xfd,0x08,0x00,0x1f,
-0xfd,0x68,0x00,0x07,0x1f,0xfe,0x43,0x01,0x0d,0x19,0xfa,0xdf,0x00,0x01,0xbd,0x00,
-0x10,0xfd,0x38,0x00,0x12,0xfc,0x09,0x01,0x14,0xde,0x6c,0x00,0x97,0xf9,0x00,0x00,
-0xe4,0xfb,0xee,0xf1,0x00,0xe8,0x08,0x02,0x25,0xf2,0xf7,0x0c,0x00,0x10,0xdf,0x93,
-0x82,0x23,0x00,0xec,0x43,0x00,0x41,0xfd,0x00,0xff,0xff,0x25,0x01,0x00,0x6a,0x56,
-0x0e,0x40,0x02,0x00,0xd2,0x00,0x1f,0xfc,0x97,0x00,0x0b,0x37,0xf8,0x00,0xfe,0x3e,
-0x0e,0x0a,0x7b,0x02,0x93,0xea,0xe8,0x00,0x00,0xf8,0xfd,0xe8,0xfe,0x02,0x40,0x02,
-0xd3,0xf5,0xf6,0x00,0xf5,0xf6,0xf8,0xf4,0x00,0xf6,0xf9,0xfa,0xf8,0xfa,0x1a,0x01,
-0x66,0xe9,0xfc,0x00,0x00,0xf8,0xff,0x2b,0x01,0xa4,0xfb,0xfc,0x00,0x00,0xfb,0xfd,
-0x00,0x00,0xfd,0xff,0x7d,0x01,0x42,0x02,0x00,0xf4,0xfa,0x51,0x00,0x13,0x01,0xbf,
-0x04,0x23,0xfd,0xfd,0x6c,0x01,0x08,0xf8,0x02,0x14,0xfb,0x20,0x01,0x15,0x01,0x01,
-0x02,0x02,0xb0,0x01,0x04,0x30,0x01,0xf0,0x0a,0x02,0xfb,0xeb,0xfb,0x00,0x00,0xf6,
-0xfd,0xf6,0xfe,0x02,0xf6,0x02,0x02,0x01,0x02,0x00,0x02,0xf9,0xf9,0xfe,0xfc,0xf9,
-0xfc,0xfa,0x03,0x02,0x46,0xfe,0xfd,0x02,0xfb,0x20,0x05,0x1a,0xfd,0x99,0x01,0x02,
-0x48,0x00,0x1e,0xfd,0xb2,0x01,0x0f,0xb5,0x01,0x04,0x1e,0xf9,0x31,0x01,0x0d,0xe9,
-0x01,0x1f,0xfd,0x24,0x00,0x09,0x12,0xff,0x43,0x02,0x1f,0xff,0x5a,0x03,0x10,0x1f,
-0xff,0x1d,0x00,0x10,0x1e,0x02,0xdd,0x01,0x19,0x02,0xbc,0x00,0x16,0x02,0x14,0x04,
-0x0f,0x01,0x00,0x1e,0x0b,0x04,0x01,0x1f,0xf2,0x2c,0x00,0x0b,0x23,0xfe,0xfe,0xd7,
-0x01,0x1c,0xf4,0x31,0x02,0x11,0xfe,0x93,0x00,0x10,0x05,0x2b,0x02,0x0f,0x6f,0x00,
-0x15,0x2e,0x02,0x00,0xb8,0x00,0x3d,0xfe,0xff,0x01,0x97,0x01,0x1f,0xf3,0xd8,0x00,
-0x24,0x1f,0xfe,0x24,0x00,0x26,0x0f,0x3d,0x00,0x07,0x13,0x01,0xd5,0x02,0x11,0x03,
-0x23,0x29,0x2d,0x04,0x05,0x21,0x00,0x60,0x06,0x07,0x08,0x09,0x0a,0x0b,0xce,0x26,
-0xf2,0x02,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,
-0x17,0x18,0x19,0x4a,0x08,0x70,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x8d,0x18,0xff,
-0x01,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,
-0x00,0x01,0x00,0xff,0xfe,0x0a,0x75,0x02,0x20,0x03,0x02,0x70,0x02,0x4b,0x06,0x07,
-0x06,0x08,0x1f,0x00,0x31,0x09,0x00,0x0a,0x1d,0x1a,0x04,0xdc,0x5d,0x10,0x0b,0x11,
-0x50,0x72,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x32,0x6f,0x72,0x16,0x00,0x17,0x17,
-0x17,0x18,0x17,0x99,0x11,0xd3,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,
-0x21,0x1f,0x22,0xaf,0x42,0x0d,0x01,0x00,0x1f,0x24,0x6f,0x02,0xff,0xe9,0x50,0x00,
-0x00,0x00,0x00,0x00,
+0x00,0x5a,0xdc,0xa4,0x00,0x00,0x01,0x56,0x63,0x00,0x00,0x78,0x8b,0xff,0xfe,0x88,
+0x82,0x53,0x03,0x70,0x12,0x22,0x22,0x22,0x22,0x20,0x3f,0x0c,0x00,0xcf,0x90,0x3f,
+0xfc,0xfc,0xfe,0xdf,0x90,0x3f,0xd5,0xf4,0xeb,0x7f,0x06,0x00,0x07,0x61,0xe6,0xf5,
+0xec,0x8f,0x90,0x2f,0x54,0x03,0x52,0x07,0x9a,0xaa,0xaa,0xa9,0x95,0x07,0x12,0x14,
+0xf7,0x00,0x22,0xef,0xa0,0x89,0x06,0x10,0xf9,0x0d,0x00,0x30,0xc3,0xdf,0xff,0x3b,
+0x09,0x30,0xfd,0x3d,0xf5,0x1a,0x00,0x40,0xff,0xd3,0x50,0x00,0x49,0x06,0x02,0x0d,
+0x00,0x21,0xff,0x60,0x0d,0x00,0x15,0xf6,0x0d,0x00,0x11,0x0b,0x0d,0x00,0x00,0x51,
+0x04,0x11,0x60,0x88,0x07,0x11,0xf6,0x4b,0x07,0x13,0x86,0x66,0x01,0x10,0x8b,0x73,
+0x05,0x14,0xb6,0xb8,0x01,0xf0,0x0d,0xf2,0x00,0xbf,0xff,0xf8,0xbf,0xf6,0xef,0xff,
+0x40,0xbf,0xff,0xff,0x10,0xa4,0x09,0xff,0xf4,0xaf,0xff,0xff,0xfd,0x10,0x07,0xff,
+0xff,0x4d,0xff,0x21,0x09,0xf4,0x07,0xbf,0xff,0xf4,0x1d,0xff,0xff,0xf4,0x06,0x10,
+0xbf,0xff,0x40,0x1d,0xff,0xff,0x47,0xfd,0x2b,0xff,0xf4,0x00,0x1d,0xb7,0x01,0x31,
+0x1c,0xff,0xff,0xcf,0x06,0xf0,0x00,0x08,0x99,0x99,0x70,0x00,0xbf,0xff,0xff,0xf8,
+0x0a,0xd0,0xd0,0xd0,0xeb,0x9f,0x05,0x00,0x60,0xff,0xd1,0xd1,0xd1,0xeb,0xff,0xe6,
+0x04,0x0f,0x05,0x00,0x0b,0x10,0xef,0xc6,0x05,0x52,0x5c,0xdd,0xdd,0xdd,0xb2,0x9f,
+0x00,0x11,0xb0,0x37,0x05,0x20,0x0b,0xf0,0x70,0x08,0xa2,0x00,0x0f,0xf0,0x0a,0xff,
+0x21,0x11,0x11,0x1f,0xf0,0xad,0x00,0x12,0xf0,0x22,0x06,0x42,0xd0,0x08,0xff,0x10,
+0xbe,0x08,0x02,0x07,0x00,0x60,0x01,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const etxFontBlock blocks[] = {
+{ .bitmap_index = 0, .comp_offset = 0, .size = 4063, .comp_size = 3628 },
+{ .bitmap_index = 4063, .comp_offset = 3628, .size = 4061, .comp_size = 2920 },
+{ .bitmap_index = 8124, .comp_offset = 6548, .size = 4075, .comp_size = 2946 },
+{ .bitmap_index = 12199, .comp_offset = 9494, .size = 4046, .comp_size = 2870 },
+{ .bitmap_index = 16245, .comp_offset = 12364, .size = 4045, .comp_size = 3172 },
+{ .bitmap_index = 20290, .comp_offset = 15536, .size = 4054, .comp_size = 3306 },
+{ .bitmap_index = 24344, .comp_offset = 18842, .size = 4051, .comp_size = 3181 },
+{ .bitmap_index = 28395, .comp_offset = 22023, .size = 4016, .comp_size = 3351 },
+{ .bitmap_index = 32411, .comp_offset = 25374, .size = 3297, .comp_size = 2318 },
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1879,11 +2070,11 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 63475, .glyph_id_start = 115, .list_length = 514, .type = 3, .unicode_list = 5032, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[44730] __SDRAMFONTS;
+static uint8_t etxUncompBuf[9022] __SDRAMFONTS;
 
 const etxLz4Font lv_font_ko_XS = {
-.uncomp_size = 44466,
-.comp_size = 29876,
+.uncomp_size = 8758,
+.comp_size = 5008,
 .line_height = 15,
 .base_line = 3,
 .subpx = 0,
@@ -1896,12 +2087,15 @@ const etxLz4Font lv_font_ko_XS = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 6060,
-.class_pair_values = 41768,
-.left_class_mapping = 43208,
-.right_class_mapping = 43837,
+.glyph_bitmap = 0,
+.class_pair_values = 6060,
+.left_class_mapping = 7500,
+.right_class_mapping = 8129,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 44730,
+.lvglFontBufSize = 9022,
+.block_count = 9,
+.blocks = blocks,
+.compressed_bitmap = lz4BitmapData,
 };
@@ -199,96 +199,139 @@ static const uint8_t lz4FontData[] ={
 0x0c,0x07,0x00,0x00,0x3a,0x08,0x00,0x13,0x64,0x08,0x00,0x13,0x8e,0x08,0x00,0x13,
 0xb8,0x08,0x00,0x10,0xe2,0x08,0x00,0x52,0x08,0x00,0xff,0x12,0x48,0x58,0x00,0x13,
 0x3a,0x08,0x00,0x22,0x62,0x48,0xa8,0x00,0x22,0x94,0x48,0x28,0x00,0x22,0xbe,0x48,
-0x60,0x00,0x60,0xe1,0x48,0x10,0x09,0x0a,0x07,0x98,0x13,0xf4,0xff,0xff,0xff,0xff,
-0xc3,0x72,0x1f,0xb5,0x21,0x50,0xab,0x54,0xab,0x58,0xab,0x60,0xab,0x62,0xab,0x65,
-0xab,0x69,0xab,0x6c,0xab,0x81,0xab,0xc0,0xab,0xc4,0xab,0xd0,0xab,0xdc,0xab,0xf0,
-0xab,0xf8,0xab,0xf9,0xab,0x00,0xac,0x0d,0xac,0x14,0xac,0x30,0xac,0x31,0xac,0x41,
-0xac,0x45,0xac,0x4c,0xac,0x50,0xac,0xa0,0xac,0xbc,0xac,0xbd,0xac,0xc5,0xac,0xdc,
-0xac,0x10,0xad,0x2c,0xad,0x30,0xad,0x48,0xad,0x49,0xad,0x4c,0xad,0x50,0xad,0x59,
-0xad,0x80,0xad,0x88,0xad,0x91,0xad,0x9c,0xad,0x0c,0xae,0x08,0xaf,0x94,0xaf,0xa4,
-0xaf,0xad,0xaf,0xe8,0xaf,0xf0,0xaf,0xf8,0xaf,0x04,0xb0,0x58,0xb0,0x60,0xb0,0x73,
-0xb0,0x74,0xb0,0xc8,0xb0,0xe2,0xb0,0x54,0xb1,0x5c,0xb1,0xc4,0xb1,0xe0,0xb1,0xe4,
-0xb1,0xf5,0xb1,0x18,0xb2,0x28,0xb2,0x29,0xb2,0x34,0xb2,0x38,0xb2,0x45,0xb2,0x50,
-0xb2,0xa4,0xb2,0xac,0xb2,0xbe,0xb2,0xc0,0xb2,0xc1,0xb2,0xc4,0xb2,0xc8,0xb2,0x14,
-0xb3,0x15,0xb3,0x29,0xb3,0x68,0xb3,0x6c,0xb3,0x78,0xb3,0xa0,0xb3,0xa8,0xb3,0xf4,
-0xb3,0x10,0xb4,0x18,0xb4,0x2c,0xb4,0x2d,0xb4,0x30,0xb4,0x34,0xb4,0x41,0xb4,0x64,
-0xb4,0x79,0xb4,0x80,0xb4,0x9c,0xb4,0x60,0xb5,0xec,0xb5,0x40,0xb6,0xcc,0xb6,0xd0,
-0xb6,0xdc,0xb6,0xe1,0xb6,0xe8,0xb6,0xe9,0xb6,0x19,0xb7,0x3c,0xb7,0x4c,0xb7,0x4d,
-0xb7,0x58,0xb7,0x59,0xb7,0x5c,0xb7,0x74,0xb7,0x75,0xb7,0x7c,0xb7,0xac,0xb7,0xad,
-0xb7,0xb0,0xb7,0xb4,0xb7,0xbf,0xb7,0x1c,0xb8,0x38,0xb8,0x49,0xb8,0xa8,0xb8,0xb8,
-0xb8,0xc4,0xb8,0xc8,0xb8,0xcc,0xb8,0xd4,0xb8,0xfc,0xb8,0xfd,0xb8,0x00,0xb9,0x0c,
-0xb9,0x0d,0xb9,0x0f,0xb9,0x11,0xb9,0x18,0xb9,0x19,0xb9,0x1c,0xb9,0x1e,0xb9,0x20,
-0xb9,0x2e,0xb9,0x34,0xb9,0x45,0xb9,0x47,0xb9,0x88,0xb9,0x8c,0xb9,0x90,0xb9,0xa4,
-0xb9,0xc4,0xb9,0xd5,0xb9,0xf8,0xb9,0xf9,0xb9,0x0b,0xba,0x84,0xba,0x88,0xba,0xfc,
-0xba,0x48,0xbb,0x49,0xbb,0x50,0xbb,0x5b,0xbb,0x5d,0xbb,0x5f,0xbb,0x64,0xbb,0x65,
-0xbb,0x68,0xbb,0x6c,0xbb,0x6d,0xbb,0x79,0xbb,0x80,0xbb,0x81,0xbb,0xd4,0xbb,0xd8,
-0xbb,0xdc,0xbb,0xe4,0xbb,0xe5,0xbb,0xf0,0xbb,0xf8,0xbb,0x10,0xbc,0x14,0xbc,0x44,
-0xbc,0x45,0xbc,0x48,0xbc,0x4c,0xbc,0x57,0xbc,0xd0,0xbc,0xd4,0xbc,0xd8,0xbc,0xe9,
-0xbc,0x40,0xbd,0x5c,0xbd,0x64,0xbd,0x94,0xbd,0x98,0xbd,0x9c,0xbd,0xb0,0xbd,0xb8,
-0xbd,0xe0,0xbf,0xfc,0xbf,0xfd,0xbf,0x00,0xc0,0x0d,0xc0,0x11,0xc0,0x18,0xc0,0x19,
-0xc0,0x28,0xc0,0x2d,0xc0,0x47,0xc0,0x6c,0xc0,0x6d,0xc0,0x70,0xc0,0x74,0xc0,0x81,
-0xc0,0x88,0xc0,0x89,0xc0,0x8c,0xc0,0x90,0xc0,0x9b,0xc0,0xa8,0xc0,0xdc,0xc0,0xdd,
-0xc0,0xe0,0xc0,0xf1,0xc0,0x30,0xc1,0x68,0xc1,0x6c,0xc1,0x7b,0xc1,0xf4,0xc1,0xfc,
-0xc1,0x05,0xc2,0x09,0xc2,0x2c,0xc2,0x2d,0xc2,0x30,0xc2,0x34,0xc2,0x3c,0xc2,0x41,
-0xc2,0x48,0xc2,0x40,0xc4,0x94,0xc4,0x95,0xc4,0x98,0xc4,0x9a,0xc4,0x9c,0xc4,0xa4,
-0xc4,0xa5,0xc4,0xa9,0xc4,0xae,0xc4,0xc0,0xc4,0xcc,0xc4,0xe1,0xc4,0x04,0xc5,0x08,
-0xc5,0x0c,0xc5,0x15,0xc5,0x16,0xc5,0x18,0xc5,0x20,0xc5,0x28,0xc5,0x3c,0xc5,0x3d,
-0xc5,0x40,0xc5,0x44,0xc5,0x51,0xc5,0x58,0xc5,0x74,0xc5,0x78,0xc5,0x7c,0xc5,0x85,
-0xc5,0x90,0xc5,0x94,0xc5,0xc8,0xc5,0xcc,0xc5,0xe4,0xc5,0xf9,0xc5,0x00,0xc6,0x04,
-0xc6,0x08,0xc6,0x10,0xc6,0x13,0xc6,0x1c,0xc6,0x20,0xc6,0x24,0xc6,0x38,0xc6,0x54,
-0xc6,0x70,0xc6,0x78,0xc6,0x8c,0xc6,0x90,0xc6,0x94,0xc6,0x9c,0xc6,0xa1,0xc6,0xa8,
-0xc6,0xc4,0xc6,0xc5,0xc6,0xc8,0xc6,0xcc,0xc6,0xcd,0xc6,0xd4,0xc6,0xd5,0xc6,0xd8,
-0xc6,0xe0,0xc6,0xe1,0xc6,0xe4,0xc6,0xe8,0xc6,0xf5,0xc6,0xfc,0xc6,0xfd,0xc6,0x50,
-0xc7,0x51,0xc7,0x54,0xc7,0x58,0xc7,0x60,0xc7,0x61,0xc7,0x65,0xc7,0x6c,0xc7,0x7f,
-0xc7,0x88,0xc7,0xc0,0xc7,0xc1,0xc7,0xc4,0xc7,0xd5,0xc7,0xdc,0xc7,0x4c,0xc8,0x50,
-0xc8,0x61,0xc8,0xd9,0xc8,0xe0,0xc8,0xed,0xc8,0x10,0xc9,0x11,0xc9,0x14,0xc9,0x20,
-0xc9,0x21,0xc9,0x2c,0xc9,0x48,0xc9,0x49,0xc9,0x0d,0xca,0x5d,0xcb,0x78,0xcb,0x88,
-0xcb,0x8c,0xcb,0x8e,0xcb,0x94,0xcb,0xfb,0xcb,0xfd,0xcb,0x04,0xcc,0x58,0xcc,0xac,
-0xcc,0xe4,0xcc,0xe5,0xcc,0xe8,0xcc,0xec,0xcc,0xf9,0xcc,0x38,0xcd,0x71,0xcd,0xa8,
-0xcd,0xbd,0xcd,0xc4,0xcd,0xe0,0xcd,0x34,0xce,0x38,0xce,0x3c,0xce,0x44,0xce,0x47,
-0xce,0x50,0xce,0x6c,0xce,0x7c,0xce,0xa4,0xce,0xac,0xce,0xbc,0xcf,0xc4,0xcf,0xcc,
-0xcf,0xf4,0xcf,0xfc,0xcf,0x10,0xd0,0x18,0xd0,0x20,0xd0,0x2c,0xd0,0x2d,0xd0,0x3d,
-0xd0,0x80,0xd0,0x84,0xd0,0x88,0xd0,0x90,0xd0,0x9c,0xd0,0x9d,0xd0,0xa0,0xd0,0xa4,
-0xd0,0xac,0xd0,0xf0,0xd0,0xf4,0xd0,0x05,0xd1,0x7c,0xd1,0x08,0xd2,0x09,0xd2,0x0c,
-0xd2,0x10,0xd2,0x40,0xd2,0x41,0xd2,0x5c,0xd2,0x6d,0xd2,0x78,0xd2,0xd4,0xd2,0xdc,
-0xd2,0xe8,0xd2,0xe9,0xd2,0x08,0xd3,0x19,0xd3,0x3c,0xd3,0x44,0xd3,0xac,0xd3,0xc8,
-0xd3,0x54,0xd4,0x5c,0xd4,0x8c,0xd4,0x90,0xd4,0x94,0xd4,0xa1,0xd4,0xa8,0xd4,0xa9,
-0xd4,0xac,0xd4,0xb0,0xd4,0xb8,0xd4,0xb9,0xd4,0xbd,0xd4,0xc4,0xd4,0xd9,0xd4,0xf5,
-0xd4,0x18,0xd5,0x28,0xd5,0x2d,0xd5,0x3c,0xd5,0x54,0xd5,0x65,0xd5,0x88,0xd5,0x90,
-0xd5,0x9d,0xd5,0xa4,0xd5,0xa5,0xd5,0xa8,0xd5,0xac,0xd5,0xb9,0xd5,0xdc,0xd5,0xf8,
-0xd5,0x14,0xd6,0x70,0xd6,0x84,0xd6,0xc0,0xd6,0xd8,0xd6,0x51,0xef,0x58,0xef,0x5b,
-0xef,0x5c,0xef,0x5d,0xef,0x61,0xef,0x63,0xef,0x65,0xef,0x69,0xef,0x6c,0xef,0x71,
-0xef,0x76,0xef,0x77,0xef,0x78,0xef,0x8e,0xef,0x93,0xef,0x98,0xef,0x9b,0xef,0x9c,
-0xef,0x9d,0xef,0xa1,0xef,0xa2,0xef,0xa3,0xef,0xa4,0xef,0xb7,0xef,0xb8,0xef,0xbe,
-0xef,0xc0,0xef,0xc1,0xef,0xc4,0xef,0xc7,0xef,0xc8,0xef,0xc9,0xef,0xcb,0xef,0xe3,
-0xef,0xe5,0xef,0x14,0xf0,0x15,0xf0,0x17,0xf0,0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,
-0xf0,0x43,0xf0,0x6c,0xf0,0x74,0xf0,0xab,0xf0,0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,
-0xf1,0x93,0xf1,0x94,0xf1,0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,
-0xf7,0xf2,0xf7,0x49,0x39,0x38,0x38,0x26,0x00,0x28,0x66,0x66,0x55,0x11,0x10,0x00,
-0x90,0xa0,0x00,0xa0,0x90,0x1a,0xdb,0xc4,0x02,0x76,0x30,0x4c,0xbd,0xa0,0x08,0x1a,
-0x00,0x0a,0x0a,0x00,0x00,0x70,0x00,0x6e,0x70,0x2b,0x09,0x53,0xb0,0x23,0x08,0xc5,
-0x00,0x01,0xb5,0x65,0x04,0x81,0xc9,0xc2,0x00,0xa0,0x00,0x2a,0x80,0x00,0x07,0x19,
-0x0a,0x00,0x72,0x96,0x50,0x01,0x87,0xa0,0x00,0x00,0x83,0x98,0x00,0x28,0x63,0x72,
-0x02,0x02,0xaa,0x00,0x08,0xb9,0x00,0x0d,0x0b,0x00,0x0c,0x6b,0x00,0x09,0xe0,0x00,
-0x59,0x68,0x91,0x75,0x0a,0xc0,0x1a,0x9b,0xc3,0x81,0x80,0x10,0x00,0x20,0x38,0x0b,
-0x02,0x90,0x57,0x06,0x60,0x57,0x01,0xb0,0x0a,0x10,0x19,0x00,0x00,0x20,0x07,0x40,
-0x0c,0x00,0x93,0x06,0x60,0x57,0x06,0x50,0xa2,0x1a,0x08,0x20,0x00,0x00,0x06,0x40,
-0x8b,0xa7,0x0b,0xa0,0x34,0x61,0x00,0xa0,0x00,0x0d,0x00,0x8c,0xfc,0x90,0x0d,0x00,
-0x00,0xd0,0x00,0x75,0x92,0x10,0x9a,0x30,0x37,0x00,0x74,0x00,0xb0,0x03,0x70,0x09,
-0x10,0x0a,0x00,0x55,0x00,0xa0,0x00,0x0a,0xba,0x04,0x80,0x75,0x75,0x04,0x88,0x50,
-0x48,0x75,0x04,0x74,0x80,0x75,0x0a,0xba,0x00,0x05,0xc3,0x27,0xa3,0x00,0x93,0x02,
-0x00,0xf1,0x5c,0x1a,0xbb,0x07,0x50,0x85,0x10,0x08,0x40,0x02,0xb0,0x00,0xc2,0x00,
-0xb3,0x00,0x6e,0xbb,0x70,0x0b,0xba,0x06,0x50,0x84,0x00,0x09,0x30,0x3c,0xa0,0x00,
-0x08,0x56,0x40,0x76,0x1b,0xaa,0x00,0x00,0x2f,0x00,0x0a,0xe0,0x03,0x8d,0x00,0xb1,
-0xd0,0x57,0x0d,0x09,0xbb,0xf9,0x00,0x0d,0x00,0x0c,0xcc,0x60,0xc0,0x00,0x0e,0xba,
-0x10,0x30,0x68,0x00,0x02,0xa3,0x90,0x48,0x09,0xbb,0x10,0x03,0xb8,0x00,0xb1,0x00,
-0x4c,0xa9,0x05,0xa0,0x76,0x66,0x03,0x93,0xa0,0x67,0x08,0xbb,0x00,0x7b,0xbc,0x90,
-0x00,0x83,0x00,0x0c,0x00,0x06,0x60,0x00,0xc1,0x00,0x39,0x00,0x0a,0x30,0x8c,0x00,
-0xf1,0x2a,0x85,0x39,0x09,0x30,0xbc,0xb0,0x58,0x07,0x66,0x60,0x57,0x0b,0xbb,0x10,
-0x0a,0xb9,0x06,0x60,0xa3,0x84,0x06,0x65,0x80,0x97,0x09,0xab,0x50,0x00,0xb1,0x07,
-0xb4,0x00,0x47,0x00,0x00,0x00,0x47,0x65,0x00,0x00,0x00,0x66,0x92,0x10,0x00,0x4a,
-0x4b,0x81,0x6b,0x50,0x00,0x7b,0x00,0x00,0x3b,0xbb,0x30,0x05,0x00,0x90,0x59,0x10,
-0x00,0x3a,0x91,0x02,0x8b,0x25,0xb3,0x91,0x05,0xf1,0x43,0x3c,0xc5,0x62,0x0d,0x00,
+0x60,0x00,0x60,0xe1,0x48,0x10,0x09,0x0a,0x07,0x98,0x13,0xf8,0xff,0xff,0xff,0xf7,
+0x72,0x1f,0xb5,0x21,0x50,0xab,0x54,0xab,0x58,0xab,0x60,0xab,0x62,0xab,0x65,0xab,
+0x69,0xab,0x6c,0xab,0x81,0xab,0xc0,0xab,0xc4,0xab,0xd0,0xab,0xdc,0xab,0xf0,0xab,
+0xf8,0xab,0xf9,0xab,0x00,0xac,0x0d,0xac,0x14,0xac,0x30,0xac,0x31,0xac,0x41,0xac,
+0x45,0xac,0x4c,0xac,0x50,0xac,0xa0,0xac,0xbc,0xac,0xbd,0xac,0xc5,0xac,0xdc,0xac,
+0x10,0xad,0x2c,0xad,0x30,0xad,0x48,0xad,0x49,0xad,0x4c,0xad,0x50,0xad,0x59,0xad,
+0x80,0xad,0x88,0xad,0x91,0xad,0x9c,0xad,0x0c,0xae,0x08,0xaf,0x94,0xaf,0xa4,0xaf,
+0xad,0xaf,0xe8,0xaf,0xf0,0xaf,0xf8,0xaf,0x04,0xb0,0x58,0xb0,0x60,0xb0,0x73,0xb0,
+0x74,0xb0,0xc8,0xb0,0xe2,0xb0,0x54,0xb1,0x5c,0xb1,0xc4,0xb1,0xe0,0xb1,0xe4,0xb1,
+0xf5,0xb1,0x18,0xb2,0x28,0xb2,0x29,0xb2,0x34,0xb2,0x38,0xb2,0x45,0xb2,0x50,0xb2,
+0xa4,0xb2,0xac,0xb2,0xbe,0xb2,0xc0,0xb2,0xc1,0xb2,0xc4,0xb2,0xc8,0xb2,0x14,0xb3,
+0x15,0xb3,0x29,0xb3,0x68,0xb3,0x6c,0xb3,0x78,0xb3,0xa0,0xb3,0xa8,0xb3,0xf4,0xb3,
+0x10,0xb4,0x18,0xb4,0x2c,0xb4,0x2d,0xb4,0x30,0xb4,0x34,0xb4,0x41,0xb4,0x64,0xb4,
+0x79,0xb4,0x80,0xb4,0x9c,0xb4,0x60,0xb5,0xec,0xb5,0x40,0xb6,0xcc,0xb6,0xd0,0xb6,
+0xdc,0xb6,0xe1,0xb6,0xe8,0xb6,0xe9,0xb6,0x19,0xb7,0x3c,0xb7,0x4c,0xb7,0x4d,0xb7,
+0x58,0xb7,0x59,0xb7,0x5c,0xb7,0x74,0xb7,0x75,0xb7,0x7c,0xb7,0xac,0xb7,0xad,0xb7,
+0xb0,0xb7,0xb4,0xb7,0xbf,0xb7,0x1c,0xb8,0x38,0xb8,0x49,0xb8,0xa8,0xb8,0xb8,0xb8,
+0xc4,0xb8,0xc8,0xb8,0xcc,0xb8,0xd4,0xb8,0xfc,0xb8,0xfd,0xb8,0x00,0xb9,0x0c,0xb9,
+0x0d,0xb9,0x0f,0xb9,0x11,0xb9,0x18,0xb9,0x19,0xb9,0x1c,0xb9,0x1e,0xb9,0x20,0xb9,
+0x2e,0xb9,0x34,0xb9,0x45,0xb9,0x47,0xb9,0x88,0xb9,0x8c,0xb9,0x90,0xb9,0xa4,0xb9,
+0xc4,0xb9,0xd5,0xb9,0xf8,0xb9,0xf9,0xb9,0x0b,0xba,0x84,0xba,0x88,0xba,0xfc,0xba,
+0x48,0xbb,0x49,0xbb,0x50,0xbb,0x5b,0xbb,0x5d,0xbb,0x5f,0xbb,0x64,0xbb,0x65,0xbb,
+0x68,0xbb,0x6c,0xbb,0x6d,0xbb,0x79,0xbb,0x80,0xbb,0x81,0xbb,0xd4,0xbb,0xd8,0xbb,
+0xdc,0xbb,0xe4,0xbb,0xe5,0xbb,0xf0,0xbb,0xf8,0xbb,0x10,0xbc,0x14,0xbc,0x44,0xbc,
+0x45,0xbc,0x48,0xbc,0x4c,0xbc,0x57,0xbc,0xd0,0xbc,0xd4,0xbc,0xd8,0xbc,0xe9,0xbc,
+0x40,0xbd,0x5c,0xbd,0x64,0xbd,0x94,0xbd,0x98,0xbd,0x9c,0xbd,0xb0,0xbd,0xb8,0xbd,
+0xe0,0xbf,0xfc,0xbf,0xfd,0xbf,0x00,0xc0,0x0d,0xc0,0x11,0xc0,0x18,0xc0,0x19,0xc0,
+0x28,0xc0,0x2d,0xc0,0x47,0xc0,0x6c,0xc0,0x6d,0xc0,0x70,0xc0,0x74,0xc0,0x81,0xc0,
+0x88,0xc0,0x89,0xc0,0x8c,0xc0,0x90,0xc0,0x9b,0xc0,0xa8,0xc0,0xdc,0xc0,0xdd,0xc0,
+0xe0,0xc0,0xf1,0xc0,0x30,0xc1,0x68,0xc1,0x6c,0xc1,0x7b,0xc1,0xf4,0xc1,0xfc,0xc1,
+0x05,0xc2,0x09,0xc2,0x2c,0xc2,0x2d,0xc2,0x30,0xc2,0x34,0xc2,0x3c,0xc2,0x41,0xc2,
+0x48,0xc2,0x40,0xc4,0x94,0xc4,0x95,0xc4,0x98,0xc4,0x9a,0xc4,0x9c,0xc4,0xa4,0xc4,
+0xa5,0xc4,0xa9,0xc4,0xae,0xc4,0xc0,0xc4,0xcc,0xc4,0xe1,0xc4,0x04,0xc5,0x08,0xc5,
+0x0c,0xc5,0x15,0xc5,0x16,0xc5,0x18,0xc5,0x20,0xc5,0x28,0xc5,0x3c,0xc5,0x3d,0xc5,
+0x40,0xc5,0x44,0xc5,0x51,0xc5,0x58,0xc5,0x74,0xc5,0x78,0xc5,0x7c,0xc5,0x85,0xc5,
+0x90,0xc5,0x94,0xc5,0xc8,0xc5,0xcc,0xc5,0xe4,0xc5,0xf9,0xc5,0x00,0xc6,0x04,0xc6,
+0x08,0xc6,0x10,0xc6,0x13,0xc6,0x1c,0xc6,0x20,0xc6,0x24,0xc6,0x38,0xc6,0x54,0xc6,
+0x70,0xc6,0x78,0xc6,0x8c,0xc6,0x90,0xc6,0x94,0xc6,0x9c,0xc6,0xa1,0xc6,0xa8,0xc6,
+0xc4,0xc6,0xc5,0xc6,0xc8,0xc6,0xcc,0xc6,0xcd,0xc6,0xd4,0xc6,0xd5,0xc6,0xd8,0xc6,
+0xe0,0xc6,0xe1,0xc6,0xe4,0xc6,0xe8,0xc6,0xf5,0xc6,0xfc,0xc6,0xfd,0xc6,0x50,0xc7,
+0x51,0xc7,0x54,0xc7,0x58,0xc7,0x60,0xc7,0x61,0xc7,0x65,0xc7,0x6c,0xc7,0x7f,0xc7,
+0x88,0xc7,0xc0,0xc7,0xc1,0xc7,0xc4,0xc7,0xd5,0xc7,0xdc,0xc7,0x4c,0xc8,0x50,0xc8,
+0x61,0xc8,0xd9,0xc8,0xe0,0xc8,0xed,0xc8,0x10,0xc9,0x11,0xc9,0x14,0xc9,0x20,0xc9,
+0x21,0xc9,0x2c,0xc9,0x48,0xc9,0x49,0xc9,0x0d,0xca,0x5d,0xcb,0x78,0xcb,0x88,0xcb,
+0x8c,0xcb,0x8e,0xcb,0x94,0xcb,0xfb,0xcb,0xfd,0xcb,0x04,0xcc,0x58,0xcc,0xac,0xcc,
+0xe4,0xcc,0xe5,0xcc,0xe8,0xcc,0xec,0xcc,0xf9,0xcc,0x38,0xcd,0x71,0xcd,0xa8,0xcd,
+0xbd,0xcd,0xc4,0xcd,0xe0,0xcd,0x34,0xce,0x38,0xce,0x3c,0xce,0x44,0xce,0x47,0xce,
+0x50,0xce,0x6c,0xce,0x7c,0xce,0xa4,0xce,0xac,0xce,0xbc,0xcf,0xc4,0xcf,0xcc,0xcf,
+0xf4,0xcf,0xfc,0xcf,0x10,0xd0,0x18,0xd0,0x20,0xd0,0x2c,0xd0,0x2d,0xd0,0x3d,0xd0,
+0x80,0xd0,0x84,0xd0,0x88,0xd0,0x90,0xd0,0x9c,0xd0,0x9d,0xd0,0xa0,0xd0,0xa4,0xd0,
+0xac,0xd0,0xf0,0xd0,0xf4,0xd0,0x05,0xd1,0x7c,0xd1,0x08,0xd2,0x09,0xd2,0x0c,0xd2,
+0x10,0xd2,0x40,0xd2,0x41,0xd2,0x5c,0xd2,0x6d,0xd2,0x78,0xd2,0xd4,0xd2,0xdc,0xd2,
+0xe8,0xd2,0xe9,0xd2,0x08,0xd3,0x19,0xd3,0x3c,0xd3,0x44,0xd3,0xac,0xd3,0xc8,0xd3,
+0x54,0xd4,0x5c,0xd4,0x8c,0xd4,0x90,0xd4,0x94,0xd4,0xa1,0xd4,0xa8,0xd4,0xa9,0xd4,
+0xac,0xd4,0xb0,0xd4,0xb8,0xd4,0xb9,0xd4,0xbd,0xd4,0xc4,0xd4,0xd9,0xd4,0xf5,0xd4,
+0x18,0xd5,0x28,0xd5,0x2d,0xd5,0x3c,0xd5,0x54,0xd5,0x65,0xd5,0x88,0xd5,0x90,0xd5,
+0x9d,0xd5,0xa4,0xd5,0xa5,0xd5,0xa8,0xd5,0xac,0xd5,0xb9,0xd5,0xdc,0xd5,0xf8,0xd5,
+0x14,0xd6,0x70,0xd6,0x84,0xd6,0xc0,0xd6,0xd8,0xd6,0x51,0xef,0x58,0xef,0x5b,0xef,
+0x5c,0xef,0x5d,0xef,0x61,0xef,0x63,0xef,0x65,0xef,0x69,0xef,0x6c,0xef,0x71,0xef,
+0x76,0xef,0x77,0xef,0x78,0xef,0x8e,0xef,0x93,0xef,0x98,0xef,0x9b,0xef,0x9c,0xef,
+0x9d,0xef,0xa1,0xef,0xa2,0xef,0xa3,0xef,0xa4,0xef,0xb7,0xef,0xb8,0xef,0xbe,0xef,
+0xc0,0xef,0xc1,0xef,0xc4,0xef,0xc7,0xef,0xc8,0xef,0xc9,0xef,0xcb,0xef,0xe3,0xef,
+0xe5,0xef,0x14,0xf0,0x15,0xf0,0x17,0xf0,0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,
+0x43,0xf0,0x6c,0xf0,0x74,0xf0,0xab,0xf0,0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,
+0x93,0xf1,0x94,0xf1,0xd7,0xf1,0xe3,0xf1,0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,
+0xf2,0xf7,0x00,0x01,0x00,0x2f,0xfd,0x00,0x01,0x00,0x03,0x1b,0xf8,0x08,0x00,0x00,
+0x01,0x00,0xce,0xfc,0xfc,0x00,0xff,0xfc,0x00,0xfa,0x00,0x00,0x00,0x01,0x00,0x01,
+0x00,0x4e,0x01,0x01,0x00,0x02,0x16,0x00,0x2f,0xf4,0x00,0x01,0x00,0x15,0x1e,0xf0,
+0x1e,0x00,0x0e,0x90,0x00,0xb1,0xfc,0x00,0xff,0x00,0x00,0xf7,0xff,0xfa,0xfb,0x00,
+0xf9,0x11,0x00,0x00,0x0f,0x00,0x4d,0xff,0xff,0xfc,0xfe,0x92,0x00,0x30,0xfe,0x00,
+0xfe,0x2e,0x00,0x1e,0x00,0x01,0x00,0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x03,
+0x0e,0x00,0x13,0xf9,0x0b,0x00,0x10,0xfe,0x02,0x00,0x2f,0xfd,0xfe,0x9c,0x00,0x0a,
+0x15,0x01,0x3c,0x00,0x11,0xff,0x34,0x00,0x39,0xff,0xfe,0xfe,0xd6,0x00,0x35,0xf4,
+0x00,0xed,0x24,0x00,0x20,0xfe,0xff,0x20,0x00,0x4e,0x00,0x00,0xfe,0xfe,0x44,0x00,
+0x10,0xfe,0x08,0x00,0x0f,0x6b,0x00,0x08,0x1f,0xfe,0x43,0x01,0x0d,0x1b,0xfc,0x25,
+0x00,0x12,0xfe,0x67,0x00,0x22,0xfe,0xfd,0x09,0x01,0x14,0xe8,0x6c,0x00,0x97,0xfb,
+0x00,0x00,0xed,0xfc,0xf4,0xf6,0x00,0xef,0x08,0x02,0x25,0xf7,0xfa,0x0c,0x00,0x75,
+0xe9,0x00,0x00,0x00,0xf6,0x00,0xf2,0x48,0x01,0x21,0xff,0xff,0x0c,0x01,0x1f,0x01,
+0xf7,0x01,0x01,0x10,0xfd,0xd2,0x00,0x0f,0x99,0x00,0x0c,0x3e,0xfa,0x00,0xff,0x69,
+0x02,0x03,0x12,0x00,0xb1,0xf1,0xf0,0x00,0x00,0xfa,0xfe,0xef,0xff,0x01,0x00,0x01,
+0x60,0x00,0xd3,0xf8,0xf9,0x00,0xf8,0xf9,0xfb,0xf8,0x00,0xf9,0xfb,0xfc,0xfb,0xfc,
+0x1a,0x01,0x66,0xf0,0xfd,0x00,0x00,0xfb,0xff,0x2b,0x01,0x62,0xfd,0xfd,0x00,0x00,
+0xfd,0xfe,0x4c,0x01,0x22,0x00,0x01,0x24,0x00,0x22,0xf7,0xfc,0x51,0x00,0x13,0x01,
+0x24,0x00,0x23,0xfe,0xfe,0x6c,0x01,0x08,0xa1,0x01,0x14,0xfd,0x20,0x01,0x15,0x01,
+0x51,0x01,0x02,0xb0,0x01,0x04,0x30,0x01,0xe0,0x01,0xfd,0xf1,0xfc,0x00,0x00,0xf9,
+0xfe,0xf9,0xff,0x01,0xf9,0x01,0x01,0x92,0x00,0xe6,0xfb,0xfb,0xfe,0xfd,0xfb,0xfd,
+0xfc,0xfe,0xfd,0xff,0x00,0xfe,0xfe,0x01,0xc5,0x00,0x2a,0x01,0xfe,0x34,0x02,0x0c,
+0xf8,0x01,0x09,0x19,0x00,0x1e,0x00,0x01,0x00,0x1f,0xfb,0x31,0x01,0x09,0x1f,0xff,
+0xf0,0x01,0x10,0x11,0xff,0x97,0x01,0x0e,0x5f,0x00,0x0f,0x4f,0x00,0x07,0x0f,0x1d,
+0x00,0x0a,0x1e,0x01,0xdd,0x01,0x19,0x01,0x81,0x00,0x12,0x01,0x14,0x03,0x0f,0x01,
+0x00,0x22,0x0b,0x81,0x00,0x1f,0xf6,0xd8,0x00,0x10,0x00,0x8e,0x00,0x1c,0xf7,0x31,
+0x02,0x20,0xff,0x01,0x4b,0x00,0x10,0x04,0x2b,0x02,0x0f,0x6f,0x00,0x15,0x1b,0x01,
+0xc4,0x04,0x02,0xa7,0x03,0x1d,0x01,0x14,0x01,0x1f,0xf7,0xd8,0x00,0x24,0x1f,0xff,
+0x24,0x00,0x26,0x0f,0x3d,0x00,0x07,0x03,0x49,0x05,0x30,0x02,0x03,0x00,0xed,0x00,
+0x2d,0x04,0x05,0x21,0x00,0xf1,0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,
+0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,
+0x18,0x19,0x20,0x00,0xff,0x0d,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,
+0x20,0x00,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,
+0x28,0x00,0x01,0x00,0xff,0xfe,0x0a,0x75,0x02,0x20,0x03,0x02,0x70,0x02,0x4b,0x06,
+0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,
+0x0c,0x00,0x08,0x00,0xf1,0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,
+0x00,0x00,0x15,0x00,0x00,0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,
+0x02,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,
+0x00,0x23,0x73,0x00,0x02,0x1f,0x24,0x6f,0x02,0xff,0xe9,0x50,0x00,0x00,0x00,0x00,
+0x00,
+};
+
+static const uint8_t lz4BitmapData[] ={
+0xf4,0xbd,0x49,0x39,0x38,0x38,0x26,0x00,0x28,0x66,0x66,0x55,0x11,0x10,0x00,0x90,
+0xa0,0x00,0xa0,0x90,0x1a,0xdb,0xc4,0x02,0x76,0x30,0x4c,0xbd,0xa0,0x08,0x1a,0x00,
+0x0a,0x0a,0x00,0x00,0x70,0x00,0x6e,0x70,0x2b,0x09,0x53,0xb0,0x23,0x08,0xc5,0x00,
+0x01,0xb5,0x65,0x04,0x81,0xc9,0xc2,0x00,0xa0,0x00,0x2a,0x80,0x00,0x07,0x19,0x0a,
+0x00,0x72,0x96,0x50,0x01,0x87,0xa0,0x00,0x00,0x83,0x98,0x00,0x28,0x63,0x72,0x02,
+0x02,0xaa,0x00,0x08,0xb9,0x00,0x0d,0x0b,0x00,0x0c,0x6b,0x00,0x09,0xe0,0x00,0x59,
+0x68,0x91,0x75,0x0a,0xc0,0x1a,0x9b,0xc3,0x81,0x80,0x10,0x00,0x20,0x38,0x0b,0x02,
+0x90,0x57,0x06,0x60,0x57,0x01,0xb0,0x0a,0x10,0x19,0x00,0x00,0x20,0x07,0x40,0x0c,
+0x00,0x93,0x06,0x60,0x57,0x06,0x50,0xa2,0x1a,0x08,0x20,0x00,0x00,0x06,0x40,0x8b,
+0xa7,0x0b,0xa0,0x34,0x61,0x00,0xa0,0x00,0x0d,0x00,0x8c,0xfc,0x90,0x0d,0x00,0x00,
+0xd0,0x00,0x75,0x92,0x10,0x9a,0x30,0x37,0x00,0x74,0x00,0xb0,0x03,0x70,0x09,0x10,
+0x0a,0x00,0x55,0x00,0xa0,0x00,0x0a,0xba,0x04,0x80,0x75,0x75,0x04,0x88,0x50,0x48,
+0x75,0x04,0x74,0x80,0x75,0x0a,0xba,0x00,0x05,0xc3,0x27,0xa3,0x00,0x93,0x02,0x00,
+0xf1,0x5c,0x1a,0xbb,0x07,0x50,0x85,0x10,0x08,0x40,0x02,0xb0,0x00,0xc2,0x00,0xb3,
+0x00,0x6e,0xbb,0x70,0x0b,0xba,0x06,0x50,0x84,0x00,0x09,0x30,0x3c,0xa0,0x00,0x08,
+0x56,0x40,0x76,0x1b,0xaa,0x00,0x00,0x2f,0x00,0x0a,0xe0,0x03,0x8d,0x00,0xb1,0xd0,
+0x57,0x0d,0x09,0xbb,0xf9,0x00,0x0d,0x00,0x0c,0xcc,0x60,0xc0,0x00,0x0e,0xba,0x10,
+0x30,0x68,0x00,0x02,0xa3,0x90,0x48,0x09,0xbb,0x10,0x03,0xb8,0x00,0xb1,0x00,0x4c,
+0xa9,0x05,0xa0,0x76,0x66,0x03,0x93,0xa0,0x67,0x08,0xbb,0x00,0x7b,0xbc,0x90,0x00,
+0x83,0x00,0x0c,0x00,0x06,0x60,0x00,0xc1,0x00,0x39,0x00,0x0a,0x30,0x8c,0x00,0xf1,
+0x2a,0x85,0x39,0x09,0x30,0xbc,0xb0,0x58,0x07,0x66,0x60,0x57,0x0b,0xbb,0x10,0x0a,
+0xb9,0x06,0x60,0xa3,0x84,0x06,0x65,0x80,0x97,0x09,0xab,0x50,0x00,0xb1,0x07,0xb4,
+0x00,0x47,0x00,0x00,0x00,0x47,0x65,0x00,0x00,0x00,0x66,0x92,0x10,0x00,0x4a,0x4b,
+0x81,0x6b,0x50,0x00,0x7b,0x00,0x00,0x3b,0xbb,0x30,0x05,0x00,0xf1,0x50,0x59,0x10,
+0x00,0x3a,0x91,0x02,0x8b,0x25,0xb3,0x00,0x00,0x00,0x00,0x3c,0xc5,0x62,0x0d,0x00,
 0x2b,0x00,0xc2,0x05,0x70,0x00,0x00,0x05,0x50,0x00,0x79,0x99,0x20,0x07,0x40,0x00,
 0x90,0x19,0x06,0x94,0x26,0x54,0x28,0x28,0x09,0x72,0x73,0x37,0x08,0x63,0x82,0x56,
 0x17,0x36,0x3a,0x7a,0x91,0x0a,0x10,0x00,0x00,0x01,0x99,0x94,0x00,0x00,0x97,0x00,
@@ -314,9 +357,9 @@ static const uint8_t lz4FontData[] ={
 0x85,0x00,0x00,0x00,0x4e,0xbc,0x60,0x43,0x01,0xfb,0x16,0xd0,0x4e,0xbe,0x30,0x49,
 0x0a,0x40,0x49,0x02,0xb0,0x49,0x00,0xb2,0x0a,0xbc,0x35,0x80,0x1d,0x4b,0x10,0x00,
 0x5d,0xb2,0x00,0x04,0xc8,0x60,0x0d,0x0a,0xbc,0x50,0x8b,0xeb,0xb1,0x00,0xb1,0x00,
-0x03,0x00,0x37,0x67,0x00,0x94,0x03,0x00,0xf0,0x09,0x93,0x3a,0x00,0xc1,0x08,0xbc,
+0x03,0x00,0x37,0x67,0x00,0x94,0x03,0x00,0xf3,0x4c,0x93,0x3a,0x00,0xc1,0x08,0xbc,
 0x60,0xb3,0x00,0x77,0x58,0x00,0xc1,0x0d,0x02,0xc0,0x0b,0x37,0x60,0x05,0x8d,0x10,
-0x00,0xeb,0xa9,0x1a,0xf3,0x30,0xa3,0x07,0x80,0x2a,0x66,0x0b,0xb0,0x57,0x2a,0x0b,
+0x00,0xeb,0x00,0x00,0xa6,0x00,0xa3,0x07,0x80,0x2a,0x66,0x0b,0xb0,0x57,0x2a,0x0b,
 0xa0,0x93,0x0c,0x38,0x64,0xc0,0x0b,0x83,0x28,0xc0,0x08,0xd0,0x0d,0x90,0x04,0xb0,
 0x0a,0x50,0x69,0x00,0xd1,0x0c,0x38,0x70,0x03,0xdd,0x00,0x00,0xd7,0x00,0x04,0xbd,
 0x00,0x0d,0x27,0x80,0x78,0x00,0xd2,0xb4,0x00,0xd1,0x3c,0x06,0x90,0x0a,0x4d,0x10,
@@ -350,855 +393,891 @@ static const uint8_t lz4FontData[] ={
 0xc0,0x07,0x90,0xc0,0x0c,0x02,0xb0,0x92,0x00,0x0a,0xa2,0x36,0x44,0x1a,0xb1,0x00,
 0x00,0x03,0x23,0x04,0xf0,0x0a,0xf4,0x00,0x09,0xaa,0xab,0xb3,0x00,0xb1,0x11,0x01,
 0xc2,0x0b,0x00,0x00,0x0a,0x40,0xdc,0xcc,0x88,0x60,0x00,0x00,0x1f,0x70,0x00,0xab,
-0x05,0x10,0x00,0x71,0x1d,0xf5,0x20,0x9b,0x00,0x00,0x07,0x7e,0xaa,0xa6,0x69,0x01,
-0x11,0x2b,0x95,0x00,0x00,0x1b,0x0a,0x3c,0xcc,0xc9,0x00,0xbb,0x00,0x00,0x00,0x16,
-0x00,0x00,0x00,0x04,0x10,0x00,0x00,0x78,0xa2,0x00,0x09,0x60,0x0a,0x30,0x8e,0x70,
-0x1b,0xf2,0x00,0xc0,0x29,0x00,0x04,0x00,0x78,0xec,0xc8,0x00,0x00,0xab,0xb6,0x00,
-0x14,0x00,0xc0,0x7c,0xb0,0x1e,0xb2,0x1b,0x30,0x08,0x70,0x00,0xb5,0xa6,0x00,0xbc,
-0x03,0x02,0x01,0x00,0x10,0x08,0x49,0x00,0xf5,0x26,0xf4,0x00,0x00,0x00,0xd7,0xd0,
-0x00,0x00,0x5b,0x0b,0x50,0x00,0x0d,0x20,0x2d,0x00,0x06,0xa0,0x00,0xa6,0x00,0xef,
-0xff,0xff,0xe0,0x00,0x00,0x59,0x20,0x07,0x6b,0x4c,0x1d,0x67,0xd7,0xba,0x40,0xaf,
-0xb6,0xc0,0x0c,0x60,0xcc,0x10,0x20,0x1c,0x4b,0x00,0x0b,0x40,0x5d,0xcd,0x50,0x1a,
-0x1e,0xf3,0x38,0x03,0xdf,0xd4,0x10,0x05,0xa2,0xe2,0xa7,0x00,0xb1,0x01,0x01,0xb1,
-0x2b,0x00,0x00,0x0a,0x20,0xd1,0x00,0x00,0xc2,0x06,0xa1,0x01,0x89,0x00,0x06,0xaa,
-0xb8,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x8d,0xcc,0xc6,0x00,
-0x2d,0x0a,0x70,0x97,0x00,0xdb,0x5b,0x00,0xc1,0x0c,0x4a,0x00,0x09,0x30,0xc0,0x00,
-0x00,0xc1,0x04,0xa0,0x00,0x88,0x00,0x05,0xcc,0xd7,0x4e,0x00,0xf2,0x0b,0x33,0x33,
-0x20,0x3f,0xbb,0xd8,0x09,0x80,0x0b,0x10,0xa5,0x07,0x80,0x3c,0x98,0x60,0x0b,0x47,
-0xaa,0x00,0xa4,0x04,0x90,0x02,0xcc,0xb1,0x20,0x00,0xf3,0x0b,0x46,0x40,0x02,0x4c,
-0xfd,0x52,0x83,0x33,0x22,0x88,0x0c,0xcb,0x08,0x80,0x22,0x20,0x88,0x09,0x98,0x08,
-0x88,0x88,0x87,0x70,0x0b,0xfb,0x41,0x00,0xf2,0x6f,0x12,0x04,0x02,0xbf,0xeb,0xb8,
-0xe7,0x00,0x08,0x07,0x70,0x00,0x80,0x09,0x30,0x08,0x2b,0x10,0x00,0xb7,0xd7,0x00,
-0x03,0x02,0xbf,0xeb,0x00,0x00,0x12,0x00,0x13,0x33,0x33,0x18,0x8f,0x44,0x68,0x81,
-0x53,0xef,0xa8,0x5f,0x05,0xa9,0x81,0x60,0x00,0x78,0x4e,0x00,0x07,0x83,0xb0,0x00,
-0x78,0xaf,0x87,0x78,0x00,0x17,0x97,0x00,0x00,0x3e,0x7e,0x7c,0x10,0x0d,0x30,0xd2,
-0x3b,0x02,0xb0,0x0c,0x10,0xc0,0x39,0x1a,0x3b,0x5b,0x00,0xda,0x83,0x79,0xd0,0x06,
-0xe3,0x00,0xb4,0x00,0x05,0xcc,0xb4,0x00,0x08,0x80,0x00,0x00,0x94,0x4a,0x00,0x00,
-0xb0,0x0b,0x4b,0x80,0xa3,0x3a,0xef,0xf4,0x1e,0xfa,0xef,0xf2,0x85,0x8f,0xff,0xb0,
-0xb3,0xff,0xff,0xf2,0xed,0xee,0xee,0xe4,0x84,0x00,0x10,0x2a,0x05,0x00,0xf0,0x05,
-0x3a,0x00,0x00,0xcc,0xcc,0xec,0x10,0x07,0x99,0x99,0x97,0x00,0x1d,0xec,0xdd,0xd0,
-0x00,0x1b,0x30,0x00,0x1e,0x01,0x03,0xa8,0x00,0xf2,0x26,0x01,0x86,0x10,0x00,0x00,
-0x17,0x68,0x70,0x00,0x00,0x36,0x94,0x00,0x00,0x17,0xa2,0x00,0x01,0x95,0x69,0x10,
-0x00,0xd5,0x98,0x7b,0x00,0x0c,0x68,0x77,0xa0,0x00,0x1a,0x77,0x90,0x00,0x0a,0xaa,
-0x91,0x02,0xa2,0x28,0xc1,0x29,0x00,0xc9,0xa2,0x90,0x00,0x0b,0x29,0x00,0x00,0xb2,
-0x07,0x00,0xf2,0x19,0xb1,0xeb,0xbb,0xbb,0x00,0x37,0x30,0x00,0x00,0x37,0x17,0x85,
-0x00,0x08,0x00,0x02,0x45,0x01,0x90,0x26,0xb2,0x80,0x62,0xaa,0x82,0x09,0x06,0x10,
-0x5e,0x00,0x71,0x27,0x07,0x93,0x07,0x00,0x58,0x88,0x88,0x60,0x24,0x02,0xf2,0x0e,
-0x00,0xb3,0x80,0x00,0x32,0x3e,0x88,0x00,0x6a,0x8b,0x2b,0x20,0x0b,0x00,0x7b,0xc0,
-0x00,0xa0,0x00,0xb3,0x00,0x37,0x00,0x0b,0x30,0x04,0x60,0x00,0xb3,0x8c,0x00,0xf1,
-0x05,0x19,0x56,0x39,0x19,0x50,0x3e,0x33,0xe3,0x66,0x10,0x00,0x49,0x91,0x16,0xa7,
-0x05,0x40,0x00,0x6a,0xaa,0x19,0x00,0xf3,0x08,0x37,0x75,0x08,0x00,0x00,0x09,0x09,
-0x00,0x00,0x54,0x09,0x00,0x00,0x90,0x0c,0x80,0x08,0x20,0x08,0x00,0x63,0x00,0x08,
-0x39,0x02,0x11,0x09,0x24,0x00,0xf1,0x08,0x26,0x63,0x07,0x00,0x01,0x28,0x08,0x00,
-0x00,0x72,0x0a,0x30,0x04,0x70,0x0b,0x50,0x55,0x00,0x08,0x00,0x05,0x00,0x08,0x1e,
-0x00,0x60,0x08,0x88,0x85,0x00,0x26,0x74,0x20,0x00,0xf1,0x06,0x09,0x00,0x00,0x92,
-0x0c,0x80,0x19,0x30,0x09,0x00,0x32,0x22,0x23,0x00,0x04,0x77,0x69,0x00,0x06,0x99,
-0x97,0x24,0x00,0x72,0x04,0x88,0x85,0x00,0x27,0x85,0x07,0x68,0x00,0xf1,0x07,0x73,
-0x0c,0x80,0x06,0x60,0x08,0x00,0x32,0x00,0x04,0x00,0x07,0x88,0x87,0x00,0x09,0x00,
-0x09,0x00,0x08,0x77,0x78,0x68,0x00,0x50,0x27,0x85,0x06,0x00,0x00,0x05,0x1d,0xf0,
-0x0e,0x64,0x0a,0x80,0x06,0x70,0x07,0x00,0x32,0x00,0x03,0x00,0x06,0x05,0x06,0x00,
-0x0a,0x89,0x2a,0x00,0x08,0x08,0x77,0x10,0x05,0x74,0x30,0x10,0x37,0x84,0x7d,0x1f,
-0xf2,0x0e,0x09,0x00,0x00,0x81,0x0c,0x80,0x06,0x50,0x09,0x00,0x53,0x00,0x07,0x00,
-0x01,0x88,0x81,0x00,0x08,0x10,0x08,0x00,0x06,0x40,0x47,0x00,0x00,0x57,0x50,0x6c,
-0x00,0x10,0x18,0x90,0x00,0xf2,0x02,0x0d,0x80,0x08,0x40,0x09,0x00,0x42,0x00,0x04,
-0x00,0x08,0x88,0x84,0x00,0x09,0x88,0x84,0x0f,0x03,0xf1,0x10,0x88,0x75,0x00,0x13,
-0x41,0x50,0x71,0x48,0x48,0x08,0x00,0x81,0x80,0x80,0x09,0x0a,0x88,0x05,0x40,0x80,
-0x82,0x80,0x08,0x08,0x30,0x00,0x80,0x80,0x00,0x08,0x08,0x8c,0x00,0xf2,0x25,0x83,
-0x50,0x60,0x05,0x48,0x08,0x00,0xa0,0xa8,0x80,0x83,0x08,0x08,0x42,0x00,0x60,0x80,
-0x01,0x88,0x70,0x00,0x90,0x04,0x60,0x09,0x20,0x64,0x00,0x06,0x73,0x00,0x14,0x43,
-0x07,0x13,0x3a,0x08,0x00,0x27,0x08,0x00,0x92,0x8b,0x05,0x40,0x08,0x46,0x00,0x08,
-0x10,0x00,0x08,0x35,0x01,0xf1,0x00,0x07,0x86,0x08,0x00,0x00,0x90,0x80,0x00,0x46,
-0x8c,0x00,0x29,0x00,0x80,0x17,0x2d,0x01,0x90,0x70,0x00,0x90,0x00,0x00,0x0c,0x88,
-0x80,0x00,0x20,0x00,0x60,0x87,0x07,0x00,0x00,0xa0,0x90,0x20,0x00,0xf0,0x02,0x48,
-0x00,0x90,0x24,0x00,0x06,0x00,0x09,0x88,0x90,0x00,0x90,0x09,0x00,0x0b,0x77,0xb0,
-0x20,0x00,0xf4,0x0d,0x13,0x40,0x51,0x51,0x49,0x38,0x26,0x00,0x80,0x81,0x60,0x09,
-0x7b,0x16,0x06,0x30,0x81,0x62,0x80,0x08,0x16,0x30,0x00,0x81,0x60,0x00,0x08,0x16,
-0x93,0x03,0xf0,0x07,0x07,0x85,0x43,0x80,0x00,0x28,0x53,0x90,0x00,0x87,0xa4,0x90,
-0x06,0x50,0x44,0x80,0x24,0x00,0x32,0x60,0x00,0x16,0x38,0x17,0xf7,0x0b,0x0c,0x00,
-0x00,0x86,0xb3,0x90,0x01,0x00,0x20,0x00,0x14,0x43,0x06,0x13,0x3a,0x18,0x00,0x27,
-0x7b,0x00,0x90,0x08,0x06,0x43,0x8b,0x56,0xa3,0x00,0xf0,0x03,0x25,0x64,0x07,0x02,
-0x29,0x8c,0x00,0x63,0x09,0x05,0x72,0x8c,0x44,0x00,0x08,0x02,0x88,0x87,0xec,0x01,
-0x00,0x03,0x00,0xf0,0x0e,0x02,0x36,0x73,0x07,0x01,0x55,0x8a,0x00,0xa0,0x09,0x29,
-0x12,0x8a,0x41,0x22,0x24,0x04,0x77,0x69,0x05,0x99,0x97,0x09,0x00,0x00,0x03,0x88,
-0x86,0x05,0x36,0x00,0xf4,0x23,0x7c,0x00,0x45,0x09,0x02,0x81,0x8c,0x27,0x00,0x08,
-0x00,0x58,0x85,0x00,0xa0,0x09,0x00,0xa1,0x1a,0x00,0x17,0x61,0x13,0x40,0x62,0x51,
-0x48,0x38,0x26,0x00,0x85,0xc2,0x60,0x09,0x08,0x26,0x06,0x48,0xc2,0x62,0x80,0x08,
-0x26,0x30,0x00,0x82,0x60,0x00,0x08,0x26,0xb4,0x00,0xf0,0x08,0x68,0x89,0x60,0x00,
-0x00,0x26,0x00,0x02,0x13,0x50,0x00,0x63,0x44,0x00,0x06,0x30,0x00,0x68,0xa9,0x88,
-0x60,0x05,0x88,0xc1,0x07,0xf2,0x00,0x80,0x00,0x33,0x07,0x01,0x15,0x51,0x21,0x67,
-0x77,0x77,0x50,0x58,0x88,0x50,0x79,0x02,0x10,0x90,0x22,0x05,0x05,0x20,0x00,0xf5,
-0x07,0x08,0x00,0x04,0x50,0x10,0x68,0x88,0x88,0x50,0x50,0x00,0x40,0x09,0x88,0x89,
-0x00,0x90,0x00,0x80,0x04,0x88,0x83,0x20,0x00,0xf6,0x07,0x44,0x07,0x02,0x47,0x74,
-0x52,0x34,0x44,0x44,0x20,0x08,0x88,0x10,0x07,0x20,0x18,0x00,0x55,0x05,0x60,0x00,
-0x57,0x05,0x05,0x31,0x48,0x8a,0x08,0x5c,0x02,0xf5,0x00,0x06,0x08,0x0b,0x80,0x09,
-0x08,0x09,0x00,0x08,0x01,0x09,0x00,0x78,0x87,0x39,0xe4,0x02,0x41,0x03,0x88,0x50,
-0x70,0xb6,0x01,0xf0,0x00,0x40,0x90,0x90,0x00,0x80,0x20,0xc7,0x07,0xa8,0x83,0x90,
-0x00,0x30,0x00,0x80,0x86,0x00,0x48,0x00,0x88,0x88,0x50,0xc1,0x00,0xf2,0x01,0x33,
-0x50,0x03,0x68,0x43,0x00,0x36,0x80,0x00,0x69,0xaa,0x88,0x50,0x05,0x88,0x84,0xac,
-0x00,0x10,0x08,0x3c,0x23,0x20,0x68,0x88,0x26,0x02,0x05,0xc0,0x00,0x25,0x01,0x00,
-0xa1,0x00,0x60,0x00,0x07,0x06,0x88,0x88,0x86,0x19,0x00,0x2a,0x58,0xc8,0xe1,0x00,
-0x12,0x86,0x0b,0x00,0xf0,0x00,0x06,0x04,0x88,0x88,0x85,0x01,0x15,0x11,0x00,0x67,
-0x96,0xb0,0x08,0x85,0x08,0xe1,0x00,0x31,0x06,0x86,0x04,0x9d,0x00,0x40,0x28,0x86,
-0x08,0x00,0x9b,0x02,0xd0,0x07,0x08,0x07,0x88,0x84,0x80,0x03,0x53,0x8a,0x00,0x11,
-0x00,0x80,0x70,0x00,0xf0,0x07,0x89,0x88,0x70,0x08,0x88,0x18,0x00,0x00,0x53,0x80,
-0x00,0x05,0x28,0x00,0x00,0x41,0x80,0x47,0x78,0x78,0x00,0x09,0xb6,0x00,0x41,0x08,
-0x00,0x08,0x00,0x6e,0x02,0x00,0x25,0x01,0x01,0x80,0x00,0x10,0x17,0xe4,0x23,0x00,
-0x35,0x04,0x10,0x09,0xea,0x03,0xa4,0x90,0x00,0x08,0x09,0x00,0x00,0x10,0x10,0x00,
-0x05,0x20,0x00,0x10,0x08,0xc5,0x05,0x81,0x68,0xaa,0xc9,0x50,0x64,0x37,0x10,0x09,
-0xf5,0x00,0x10,0x70,0x40,0x00,0xa0,0x58,0x89,0x50,0x00,0x00,0x35,0x00,0x00,0x05,
-0x30,0xf5,0x23,0x00,0x06,0x01,0x13,0x88,0xf5,0x00,0x51,0x02,0x70,0x00,0x00,0x25,
-0xd5,0x00,0x00,0x27,0x00,0x29,0x88,0x60,0xd5,0x00,0x12,0x83,0x20,0x00,0x11,0x26,
-0x55,0x00,0x11,0x88,0x5d,0x01,0x03,0xb1,0x00,0x15,0x04,0xf1,0x00,0xf0,0x01,0x05,
-0x88,0x88,0x87,0x00,0x11,0x11,0x00,0x47,0x77,0xa0,0x06,0x88,0x88,0x00,0xa0,0xad,
-0x00,0x21,0x87,0x00,0x5c,0x00,0x54,0x01,0x70,0x00,0x00,0x15,0x5c,0x00,0x08,0xf2,
-0x01,0x80,0x84,0x00,0x04,0x44,0x07,0x03,0x3b,0x08,0xa7,0x03,0x66,0x82,0x08,0x03,
-0x70,0x08,0x28,0xd7,0x02,0x00,0xf9,0x03,0x00,0xf8,0x03,0x88,0x92,0x09,0x29,0x30,
-0x09,0x11,0x22,0x23,0xbc,0x02,0xf1,0x0c,0x48,0x83,0x06,0x00,0x45,0x09,0x00,0xa0,
-0x09,0x19,0x20,0x08,0x40,0x00,0x06,0x06,0x00,0x05,0x08,0x98,0x89,0x08,0x00,0x08,
-0x03,0x78,0x84,0xbf,0x00,0x61,0x58,0x18,0x00,0x08,0x17,0x29,0x5c,0x12,0xe6,0x08,
-0x0a,0x0a,0x82,0x71,0x36,0x08,0x00,0x30,0x90,0x08,0x00,0x00,0x10,0x07,0x05,0xf3,
-0x05,0x34,0x24,0x06,0x29,0x3a,0x18,0x09,0x09,0x09,0x08,0x09,0x6c,0x52,0x45,0x08,
-0x50,0x90,0x08,0x00,0x20,0x79,0x00,0x61,0x08,0x84,0x85,0x00,0x07,0x20,0xc5,0x03,
-0x30,0x07,0x00,0x60,0xf0,0x00,0x0a,0x05,0x02,0x00,0x01,0x00,0x50,0x8b,0x48,0xa0,
-0x00,0x90,0xef,0x04,0x43,0x90,0x02,0x70,0x08,0x49,0x01,0xf0,0x03,0x60,0x08,0x94,
-0x86,0x00,0x07,0x10,0x90,0x00,0x90,0x08,0x05,0x78,0x77,0x85,0x00,0x01,0x11,0x65,
-0x02,0x00,0x25,0x00,0x31,0x97,0x77,0x80,0xb9,0x02,0xf0,0x0a,0x94,0x87,0x00,0x08,
-0x10,0x90,0x00,0x80,0x08,0x05,0x87,0x77,0x85,0x00,0x11,0x10,0x00,0x97,0x77,0x40,
-0x09,0x88,0x85,0x00,0x80,0x5a,0x02,0x52,0x75,0x00,0x03,0x00,0x07,0x43,0x05,0x01,
-0x04,0x00,0x20,0x0a,0x82,0x08,0x00,0x24,0x0b,0x88,0xd7,0x02,0x12,0x09,0xd9,0x25,
-0x41,0x00,0x07,0x00,0x80,0x16,0x02,0xf3,0x06,0x0c,0x80,0x79,0x88,0x08,0x00,0x01,
-0x22,0x24,0x00,0x05,0x77,0x69,0x00,0x07,0x89,0x87,0x00,0x0a,0x00,0x00,0x82,0x02,
-0x00,0x67,0x01,0x10,0x08,0x28,0x00,0x71,0x20,0x80,0x00,0x0b,0x60,0x88,0x88,0x29,
-0x05,0xa3,0x00,0x09,0x88,0x86,0x00,0x0a,0x00,0x09,0x00,0x0a,0xa3,0x05,0x50,0x03,
-0x00,0x60,0x70,0x90,0x29,0x25,0x50,0x80,0x80,0x90,0x09,0x89,0x07,0x00,0x45,0xb7,
-0x78,0x08,0x00,0x37,0x05,0xf1,0x01,0x10,0x04,0x00,0x07,0x09,0x00,0x09,0x09,0x03,
-0x5a,0x09,0x02,0x3a,0x09,0x00,0x09,0x8b,0x00,0x12,0x09,0x89,0x00,0x70,0x05,0x00,
-0x07,0x00,0x90,0x68,0xc1,0xa8,0x00,0x30,0xc8,0x84,0x80,0x4b,0x00,0x60,0x18,0x88,
-0xc0,0x01,0x98,0x8b,0x5d,0x02,0x50,0x01,0x88,0x77,0x10,0x06,0x09,0x01,0x01,0x20,
-0x00,0xf2,0x06,0x10,0xb8,0x84,0x80,0x00,0x27,0x64,0x00,0x37,0x89,0x72,0x00,0x37,
-0x72,0x00,0x0a,0x01,0xa0,0x00,0x48,0x72,0x7b,0x00,0x81,0x09,0x08,0x09,0x02,0xa0,
-0x80,0x91,0x5b,0x82,0x00,0x19,0xb8,0x7b,0x00,0x16,0x03,0xc7,0x02,0x51,0x88,0x88,
-0x40,0x00,0x04,0x7d,0x01,0x53,0x68,0x8b,0x88,0x60,0x06,0xa0,0x03,0x20,0x89,0x84,
-0x12,0x00,0x00,0x9d,0x01,0x30,0x68,0x88,0x50,0x38,0x00,0x31,0x6c,0x8c,0x60,0x22,
-0x03,0x02,0x20,0x00,0x11,0x09,0xc6,0x02,0x00,0x32,0x04,0x46,0x06,0x88,0xc8,0x85,
-0xcc,0x02,0x22,0x00,0x06,0x59,0x00,0xd4,0x04,0x88,0x84,0x05,0x87,0x87,0x85,0x00,
-0x19,0x11,0x00,0x57,0x76,0xb1,0x02,0x00,0x3c,0x01,0x0e,0x40,0x00,0xd1,0x9b,0x8c,
-0x85,0x01,0x70,0x90,0x00,0x17,0x09,0x00,0x00,0x20,0x20,0x20,0x00,0x07,0x99,0x00,
-0x25,0x00,0x00,0x46,0x03,0x94,0x10,0x00,0x00,0x81,0x00,0x00,0x08,0x98,0x84,0x12,
-0x00,0x03,0x19,0x04,0x51,0x98,0x88,0x60,0x05,0x00,0x1c,0x00,0xf0,0x06,0x07,0x88,
-0x84,0x01,0x11,0x12,0x21,0x56,0x66,0x66,0x40,0x07,0x87,0x00,0x06,0x40,0x28,0x00,
-0x65,0x04,0x70,0xe4,0x06,0x12,0x03,0x69,0x01,0x03,0x03,0x00,0x54,0x08,0x0b,0x88,
-0x38,0x00,0x06,0x03,0x00,0x01,0x00,0x51,0x60,0x00,0x80,0x09,0x00,0x44,0x04,0x30,
-0x0c,0x88,0x48,0xdc,0x01,0xb4,0x01,0x98,0x89,0x00,0x26,0x00,0x90,0x02,0xa7,0x7b,
-0x00,0x8c,0x01,0x20,0x00,0x81,0x6c,0x01,0x01,0x8c,0x01,0xf1,0x00,0x04,0x00,0x14,
-0x00,0x50,0x03,0xb8,0x8c,0x00,0x26,0x00,0x80,0x01,0x78,0x87,0x43,0x00,0x50,0x48,
-0x84,0x08,0x00,0x90,0x44,0x00,0x00,0xb3,0x02,0x30,0x00,0x0c,0x80,0x0c,0x00,0x39,
-0x88,0x88,0x18,0x1a,0x08,0x25,0x48,0x84,0x20,0x00,0x81,0x70,0x90,0x01,0x09,0x10,
-0x48,0x76,0x09,0x5c,0x00,0x10,0x0a,0x08,0x09,0x22,0x88,0x85,0x24,0x00,0x16,0x83,
-0x44,0x00,0x22,0x88,0x89,0x57,0x02,0x71,0x06,0x00,0x05,0x00,0x0b,0x88,0x88,0xb5,
-0x02,0x00,0x2c,0x04,0xf1,0x0a,0x24,0x50,0x67,0x09,0x33,0x09,0x80,0x90,0x00,0x88,
-0x09,0x00,0x0c,0xc0,0x90,0x00,0x88,0x08,0x88,0x28,0x80,0x00,0x00,0x88,0x00,0x8f,
-0x09,0x71,0x01,0x00,0x04,0x55,0x07,0x0a,0x32,0xeb,0x00,0x24,0x04,0x7c,0x57,0x02,
-0x03,0xee,0x00,0xf0,0x07,0x67,0x50,0x70,0x91,0x00,0x90,0x90,0x38,0xc0,0xb8,0x92,
-0x90,0x01,0x22,0x40,0x06,0x66,0xb0,0x09,0x88,0xa0,0x17,0x99,0x08,0xf0,0x0a,0x81,
-0x77,0x60,0x33,0x90,0x00,0x44,0x90,0x48,0xa4,0xa3,0x51,0x44,0x34,0x20,0x22,0x19,
-0x88,0x92,0x07,0x00,0x80,0x2b,0x88,0xc4,0x01,0x07,0xc0,0x40,0x67,0x08,0x33,0x08,
-0x80,0x80,0x00,0x88,0x08,0x04,0x79,0x07,0x00,0x35,0x07,0x88,0x38,0x71,0x00,0x00,
-0xc3,0x01,0xf1,0x09,0x62,0x61,0x60,0x91,0x09,0x17,0x08,0x08,0xc1,0x70,0x91,0x28,
-0x17,0x05,0x63,0x61,0x60,0x07,0x88,0x82,0x00,0x00,0x03,0x60,0x0c,0x05,0x20,0x00,
-0x10,0x24,0x00,0xf0,0x06,0x78,0x28,0x17,0x09,0x00,0x91,0x70,0x80,0x8c,0x17,0x08,
-0x00,0x91,0x70,0x88,0x69,0x17,0x00,0x40,0x61,0x60,0x93,0x00,0x30,0xa8,0x88,0x30,
-0xa3,0x07,0xd0,0x82,0x71,0x60,0x90,0x2a,0x18,0x08,0x05,0xb1,0x70,0xb8,0x68,0x17,
-0x0a,0x02,0x81,0x06,0x88,0x96,0x00,0x78,0x89,0x40,0x08,0xed,0x01,0x40,0x40,0x04,
-0x88,0x82,0x17,0x02,0x02,0x6b,0x05,0x17,0x30,0xb0,0x02,0x00,0x11,0x01,0x01,0xfb,
-0x01,0x14,0x85,0xb0,0x02,0x08,0x13,0x07,0x11,0x01,0x31,0x01,0x16,0x80,0x20,0x00,
-0x30,0x89,0x88,0x50,0x1b,0x02,0x42,0x30,0x18,0x00,0x55,0x1b,0x02,0x80,0x07,0x77,
-0x17,0x01,0x80,0x00,0x80,0x18,0x69,0x03,0x41,0x83,0x80,0x00,0x20,0x0b,0x06,0x32,
-0x48,0xa7,0x68,0x87,0x02,0x02,0x01,0x00,0x21,0x88,0x81,0x20,0x02,0x20,0xc7,0x72,
-0xb4,0x04,0x70,0x05,0x8c,0x85,0x90,0x00,0x10,0x08,0xda,0x00,0xf1,0x10,0x03,0xb8,
-0x87,0x00,0x08,0x88,0x16,0x00,0x90,0x00,0x71,0x0c,0x78,0x27,0x10,0x08,0x00,0x71,
-0x48,0x87,0x57,0x00,0x28,0x88,0x80,0x05,0x40,0x09,0x00,0x4a,0x88,0xa0,0x08,0x00,
-0x80,0x00,0x13,0xa0,0xf0,0x02,0x3e,0x87,0x30,0x00,0x30,0x03,0x01,0xa0,0x00,0x00,
-0xf9,0x06,0x4e,0x05,0x77,0x77,0x85,0x30,0x03,0x52,0x08,0x88,0x17,0x00,0x90,0xa0,
-0x02,0x6b,0x88,0x83,0x80,0x58,0x88,0x68,0xb2,0x06,0x08,0x60,0x00,0x24,0x88,0x50,
-0x50,0x03,0x15,0x80,0x50,0x03,0x07,0x60,0x00,0x6c,0x78,0x78,0x75,0x00,0x91,0x91,
-0x90,0x03,0x24,0x88,0x81,0x90,0x03,0x56,0x97,0x78,0x30,0x00,0x11,0x70,0x03,0x07,
-0x59,0x01,0x3b,0x00,0x00,0x57,0x6c,0x08,0x02,0x59,0x01,0x12,0x90,0xd3,0x0a,0x03,
-0x9f,0x05,0x14,0x30,0x90,0x03,0x13,0x70,0x3c,0x00,0x11,0x04,0xd5,0x00,0x10,0x75,
-0x89,0x05,0x10,0x57,0xb6,0x06,0x12,0x87,0xb6,0x06,0x2a,0x76,0x00,0x5c,0x00,0x00,
-0x6e,0x00,0x10,0x06,0xb0,0x03,0x04,0x95,0x01,0x00,0xc2,0x02,0x54,0x00,0xa2,0x20,
-0x90,0x08,0xec,0x00,0x45,0x09,0x00,0xb8,0x84,0x23,0x06,0x00,0x4d,0x02,0x30,0x60,
-0x70,0x90,0x96,0x07,0xf1,0x04,0x90,0xa3,0x42,0x90,0x34,0x30,0x80,0x04,0x88,0x40,
-0x09,0x00,0x90,0x0a,0x01,0xa0,0x02,0x76,0x10,0x45,0x03,0x63,0x58,0x38,0x00,0x90,
-0x80,0x09,0x04,0x00,0x40,0x0a,0x81,0x90,0x80,0x8d,0x03,0x19,0x38,0x8d,0x03,0xf8,
-0x04,0x24,0x33,0x60,0x78,0x29,0x18,0x08,0x80,0x80,0x80,0x88,0x08,0x08,0x88,0x80,
-0x80,0x80,0x87,0x79,0x21,0x05,0xf8,0x00,0x00,0x07,0x73,0x86,0x00,0x80,0x63,0x00,
-0x18,0x06,0x20,0x00,0xc8,0x79,0x70,0x21,0x05,0xde,0x84,0x86,0x00,0x90,0x53,0x00,
-0x09,0x05,0x30,0x00,0x78,0x58,0x70,0xd1,0x01,0xf0,0x03,0x48,0x48,0x37,0x80,0x62,
-0x08,0x80,0x62,0x08,0x48,0x48,0x58,0x67,0x78,0x68,0x00,0x90,0x08,0x03,0x00,0x14,
-0x80,0x6c,0x04,0x22,0x29,0x84,0x43,0x0c,0x00,0x04,0x00,0x22,0x89,0x95,0x29,0x04,
-0x33,0x87,0x89,0x28,0x98,0x00,0x12,0x08,0xc2,0x08,0x12,0x84,0xff,0x0b,0xd0,0x68,
-0x87,0x0b,0x40,0x90,0x00,0x0a,0x40,0x58,0x88,0x08,0x00,0x03,0xb2,0x06,0x03,0x29,
-0x04,0x40,0x38,0x84,0x07,0x00,0x92,0x08,0xb1,0x78,0x85,0x0d,0x80,0x90,0x01,0x09,
-0x00,0x38,0x75,0x07,0x09,0x08,0x10,0x0a,0xde,0x06,0x21,0x88,0x88,0x44,0x00,0x06,
-0x24,0x00,0xf1,0x06,0x0c,0x80,0x91,0x13,0x09,0x00,0x37,0x65,0x07,0x00,0x00,0x78,
-0x81,0x00,0x07,0x30,0x18,0x00,0x06,0x50,0x37,0xfb,0x0b,0xf5,0x08,0x35,0x50,0x50,
-0x71,0x3a,0x08,0x08,0x00,0x90,0x80,0x87,0x89,0x0b,0x88,0x90,0x00,0x80,0x89,0x56,
-0x38,0x08,0x02,0x10,0x04,0x01,0xf7,0x06,0x47,0x70,0x66,0x10,0x09,0x09,0x71,0x68,
-0xa0,0xcc,0x18,0x00,0x09,0x71,0x38,0x72,0x66,0x10,0x28,0x88,0x80,0xb9,0x08,0x01,
-0x64,0x00,0xf1,0x00,0x80,0xc7,0x78,0x85,0x08,0x09,0x11,0x30,0xc7,0x36,0x64,0x08,
-0x00,0x07,0x88,0x61,0x00,0x03,0x77,0x05,0xf4,0x04,0x15,0x52,0x06,0x13,0x38,0x08,
-0x00,0x08,0x18,0x79,0x95,0x6a,0x80,0x00,0x08,0x86,0x67,0x18,0x02,0x04,0x08,0xf5,
-0x09,0x58,0x80,0x07,0x00,0x80,0x09,0x68,0x90,0x7b,0x82,0x13,0x08,0x26,0x63,0x07,
-0x05,0x88,0x87,0x08,0x00,0x09,0x07,0x77,0x79,0x1b,0x00,0xa0,0x78,0x80,0x7b,0x80,
-0x01,0x08,0x38,0x74,0x06,0x05,0x7d,0x08,0x12,0x8a,0x7d,0x08,0x33,0x35,0x40,0x60,
-0xb1,0x00,0x41,0x88,0x98,0x6a,0x08,0xb1,0x00,0x18,0x28,0xb1,0x00,0xf0,0x04,0x37,
-0x60,0x67,0x00,0x09,0x09,0x90,0x68,0x96,0xb9,0x08,0x00,0x18,0x90,0x38,0x72,0x67,
-0x00,0x28,0x98,0x09,0x12,0x09,0xcd,0x03,0x11,0x02,0x94,0x07,0x90,0x86,0x08,0x80,
-0x00,0x80,0x98,0x04,0x8a,0x6b,0xc9,0x04,0xd0,0x05,0x87,0x28,0x80,0x01,0x10,0x88,
-0x00,0x45,0x00,0x00,0x03,0xa7,0x39,0x01,0x00,0xb4,0x00,0xcd,0x03,0x38,0x39,0x00,
-0x08,0x59,0x79,0x94,0x08,0x80,0x00,0x8a,0xb4,0x00,0xa1,0x7b,0x68,0xa0,0x09,0x80,
-0x00,0x6a,0x48,0x74,0x08,0x9b,0x09,0x03,0x08,0x0c,0x02,0x1b,0x00,0x50,0x88,0x70,
-0x7a,0x78,0x76,0x0f,0x00,0x41,0x04,0x98,0x89,0x04,0xbe,0x05,0x60,0x03,0x88,0x87,
-0x04,0x88,0x72,0xde,0x09,0x52,0x06,0x88,0x95,0x00,0x90,0xde,0x0d,0x20,0x00,0x80,
-0x49,0x02,0x90,0x50,0x03,0x87,0x76,0x00,0x48,0x88,0x80,0x09,0xad,0x01,0x61,0xc8,
-0x50,0x68,0x8c,0x88,0x50,0xcf,0x03,0x12,0x8a,0x5e,0x01,0xf0,0x01,0x04,0x00,0x03,
-0x77,0x65,0x00,0x38,0x88,0x80,0x08,0x21,0x11,0x00,0x27,0xc7,0x40,0x20,0x00,0x15,
-0x20,0xf1,0x06,0x30,0x03,0x88,0x86,0x3c,0x00,0x90,0x08,0x65,0x54,0x00,0x02,0xa2,
-0x10,0x57,0x78,0x9d,0x03,0x42,0x90,0x05,0x88,0x89,0x61,0x03,0x42,0x86,0x00,0x03,
-0x77,0x5c,0x00,0x52,0x10,0x00,0x00,0x37,0xc7,0x5c,0x00,0xc2,0x40,0x00,0x00,0x3d,
-0x20,0x00,0x59,0x18,0x50,0x03,0x00,0x02,0xe8,0x0a,0x23,0x02,0x60,0x95,0x00,0xc2,
-0x05,0x87,0x85,0x00,0x07,0x07,0x00,0x68,0xb8,0xb8,0x50,0x03,0x81,0x0b,0x30,0x09,
-0x88,0x84,0x67,0x00,0x01,0xde,0x02,0x27,0xb8,0x87,0x9c,0x09,0x00,0xb5,0x00,0x00,
-0x95,0x00,0xf6,0x00,0x10,0x00,0x00,0x38,0x88,0x50,0x68,0x8a,0x88,0x50,0x20,0x90,
-0x10,0x09,0x89,0x70,0x0a,0x02,0x59,0x00,0x52,0x09,0x88,0x83,0x00,0x98,0x8f,0x04,
-0x24,0x8b,0x8b,0xdf,0x07,0x00,0x0a,0x06,0x00,0xb9,0x00,0xf0,0x02,0x26,0x66,0x80,
-0x08,0x32,0x21,0x00,0x38,0x87,0x50,0x57,0xa7,0xa7,0x50,0x5c,0x8c,0x50,0x94,0x09,
-0x32,0x98,0x88,0x90,0x81,0x0b,0x10,0x71,0x40,0x00,0x13,0x05,0x99,0x00,0x06,0x21,
-0x04,0x91,0x03,0x77,0x74,0x00,0x47,0x78,0x70,0x09,0x11,0x3e,0x0b,0x00,0x12,0x00,
-0x13,0x20,0x25,0x0b,0x00,0x0e,0x01,0xf2,0x02,0x87,0x00,0x48,0x88,0x70,0x08,0x43,
-0x33,0x00,0x14,0x54,0x30,0x47,0x77,0x78,0x60,0x49,0x0e,0x01,0x12,0x90,0x25,0x0b,
-0x00,0x75,0x01,0xc0,0x36,0x67,0x70,0x09,0x22,0x20,0x00,0x48,0x88,0x50,0x57,0x88,
-0x2e,0x01,0x17,0x40,0x38,0x0a,0xf2,0x0d,0x15,0x53,0x05,0x10,0x32,0x90,0x71,0x00,
-0x09,0x07,0x17,0x99,0x50,0x71,0x80,0x00,0x07,0x18,0x66,0x71,0x71,0x02,0x10,0x07,
-0x10,0x00,0x00,0x61,0x4c,0x03,0x00,0xc0,0x2c,0x91,0x68,0x85,0x09,0x80,0x01,0x09,
-0x38,0x75,0x07,0xc4,0x01,0x03,0xf9,0x01,0x00,0xab,0x03,0x30,0x08,0x09,0x58,0x55,
-0x02,0xd0,0x08,0x48,0x88,0x18,0x02,0x10,0x08,0x07,0x30,0x00,0x06,0xa8,0x86,0x1b,
-0x03,0x01,0x33,0x00,0xf1,0x00,0x81,0x13,0x09,0x27,0x65,0x06,0x05,0x88,0x87,0x07,
-0x20,0x09,0x07,0x87,0x79,0x4e,0x00,0x00,0x46,0x2d,0xf1,0x06,0x78,0x85,0x09,0x80,
-0x02,0x08,0x38,0x73,0x06,0x04,0x20,0x06,0x06,0xa8,0x89,0x06,0x30,0x08,0x02,0x78,
-0x84,0x51,0x03,0xa0,0x90,0x90,0x68,0x85,0x09,0x08,0x00,0x10,0x90,0x38,0x4c,0x02,
-0xa2,0x70,0x40,0x00,0x1c,0x50,0x00,0x2a,0x15,0x70,0x02,0x71,0x03,0x00,0x56,0x00,
-0x11,0x86,0x89,0x00,0xe1,0x76,0x08,0x00,0x68,0x82,0x03,0x70,0x09,0x02,0x90,0x29,
-0x00,0x37,0x60,0xb0,0x03,0x10,0x83,0x69,0x04,0x13,0x09,0x04,0x00,0x84,0x0c,0x81,
-0x80,0x09,0x08,0x00,0x78,0x88,0x9f,0x10,0x13,0x08,0x85,0x08,0xf0,0x02,0x07,0x00,
-0x90,0x09,0x09,0x00,0x90,0x09,0x0c,0x80,0x80,0x08,0x08,0x00,0x38,0x83,0x08,0x38,
-0x09,0x07,0x04,0x0b,0x02,0x67,0x00,0x02,0x44,0x00,0x82,0x0a,0x40,0x80,0x08,0x0a,
-0x30,0x37,0x72,0xc3,0x10,0x04,0x80,0x04,0x0d,0x44,0x00,0xf2,0x03,0x84,0x35,0x00,
-0x06,0x05,0xa9,0x10,0x09,0x01,0x85,0x00,0x0b,0x67,0x38,0x00,0x01,0x10,0x63,0xed,
-0x08,0x02,0x88,0x00,0x41,0x80,0x78,0x86,0x09,0x0e,0x0b,0x6a,0x05,0x88,0x78,0x00,
-0x06,0x88,0x48,0x0b,0x01,0x28,0x00,0x11,0x09,0x28,0x00,0x41,0x70,0x87,0x78,0x09,
-0xf1,0x08,0xf3,0x06,0x05,0x88,0x94,0x00,0x00,0x05,0x90,0x00,0x04,0x96,0xa4,0x00,
-0x03,0x00,0x03,0x00,0x25,0x40,0x56,0x08,0x39,0xab,0x05,0x88,0x0c,0xc0,0x80,0x80,
-0x88,0x07,0x7a,0x08,0xf1,0x08,0xe0,0x38,0x80,0x63,0x18,0x06,0x29,0x41,0x80,0x62,
-0xb8,0x18,0x7b,0x19,0x11,0x5e,0x13,0x61,0x06,0x00,0x30,0x00,0xc8,0x8b,0x24,0x07,
-0xd0,0x78,0x86,0x00,0x38,0x80,0x67,0x08,0x08,0x09,0x80,0x80,0x80,0xbc,0x07,0x00,
-0xf4,0x15,0x38,0x70,0x78,0x00,0x00,0x33,0x20,0x00,0x0a,0x80,0x00,0x08,0x54,0x80,
-0x02,0x20,0x02,0x20,0x25,0x52,0x06,0x82,0x18,0x08,0x80,0x08,0x08,0x80,0x0a,0x7a,
-0x80,0x08,0x09,0x77,0x78,0x08,0x31,0x09,0x00,0x0b,0x01,0xf0,0x06,0x80,0x08,0x09,
-0x80,0x09,0x8b,0x80,0x08,0x08,0x37,0x72,0x08,0x02,0x30,0x08,0x04,0x60,0x00,0x04,
-0xb8,0x87,0x6d,0x04,0x81,0x83,0x07,0x81,0x18,0x09,0x80,0x08,0x7b,0xdf,0x00,0xd0,
-0x03,0x03,0x88,0x8a,0x03,0x98,0x88,0x06,0x30,0x00,0x02,0x88,0x76,0x31,0x09,0xa0,
-0x39,0x08,0x90,0x80,0x80,0x89,0x08,0x08,0x8a,0x80,0xb1,0x00,0x17,0x7b,0xb1,0x00,
-0x02,0x3b,0x00,0x20,0x19,0x8b,0x71,0x00,0x62,0x09,0x8a,0x48,0x83,0x08,0x03,0x36,
-0x02,0x11,0x97,0x56,0x00,0xd9,0x84,0x07,0x80,0x0a,0x8b,0x80,0x09,0x09,0x83,0x29,
-0x8b,0x25,0x52,0xe3,0x01,0x61,0x05,0x77,0x73,0x00,0x90,0x01,0x0b,0x08,0x57,0x97,
-0x78,0x70,0x00,0x02,0x04,0x09,0x50,0x86,0x00,0x80,0x00,0x80,0x5b,0x01,0x00,0x5c,
-0x04,0x0d,0x04,0x09,0x40,0x06,0x88,0x86,0x00,0x16,0x0d,0x20,0x88,0x88,0x20,0x00,
-0x00,0xb5,0x03,0x22,0x00,0x60,0x0e,0x04,0x11,0x08,0x0e,0x04,0x00,0x3c,0x06,0x12,
-0x90,0x6f,0x0d,0x00,0xed,0x0b,0x01,0xd3,0x06,0x17,0x86,0xd3,0x06,0x01,0x20,0x00,
-0x41,0x01,0x70,0x08,0x87,0xec,0x0a,0x00,0x72,0x00,0x51,0x40,0x90,0x00,0x08,0x03,
-0xa1,0x0e,0x00,0x75,0x00,0x01,0xfc,0x03,0x0f,0x60,0x08,0x04,0x60,0x25,0x52,0x06,
-0x08,0x21,0x80,0x27,0x02,0xa3,0x08,0x00,0x80,0x80,0x80,0x09,0x08,0x07,0x77,0x80,
-0xe0,0x0b,0x13,0x80,0x5c,0x03,0x30,0x80,0x09,0x09,0x03,0x00,0x49,0x08,0x09,0x38,
-0x83,0x55,0x05,0x03,0x7c,0x01,0x2e,0x08,0x09,0x61,0x01,0x80,0x38,0x84,0x05,0x08,
-0x00,0x90,0x90,0x80,0x06,0x30,0x20,0x80,0x90,0xc4,0x02,0xd1,0x00,0x50,0x50,0x00,
-0x0c,0x30,0x00,0x0a,0x27,0x50,0x03,0x10,0x04,0xb7,0x01,0x00,0x56,0x00,0x4b,0x08,
-0x83,0x28,0x09,0x46,0x01,0x30,0x48,0x84,0x07,0x34,0x00,0xf2,0x0c,0x80,0x08,0x09,
-0x05,0x88,0x50,0x90,0x00,0x22,0x13,0x00,0x03,0x65,0x00,0x03,0x87,0xc9,0x00,0x05,
-0xac,0x10,0x05,0x30,0x16,0x10,0x20,0x02,0xfd,0x02,0x80,0x83,0x38,0x09,0x00,0x84,
-0x48,0x0b,0x81,0xe1,0x02,0x2a,0x78,0x77,0x45,0x03,0xc0,0x40,0x04,0x06,0x00,0x82,
-0x28,0x09,0x00,0x85,0x58,0x0c,0x80,0x2c,0x00,0x3d,0x38,0x73,0x07,0x45,0x03,0x22,
-0x40,0x04,0x48,0x00,0x20,0x88,0x88,0x45,0x03,0x57,0x0b,0x40,0x58,0x85,0x09,0xc5,
-0x07,0x12,0x84,0x79,0x0c,0x20,0x06,0x08,0x20,0x00,0x60,0x20,0x80,0x08,0x0b,0x70,
-0x77,0x64,0x00,0x00,0xc4,0x13,0x63,0x98,0x88,0x00,0x07,0x99,0x97,0x25,0x03,0x12,
-0x75,0x28,0x00,0xe0,0x34,0x08,0x00,0x88,0xa6,0x0a,0x10,0x80,0x55,0x0c,0x70,0x77,
-0xa4,0x08,0xf7,0x12,0xf1,0x09,0x00,0x27,0xc2,0x78,0x00,0x18,0xb0,0x08,0x00,0x46,
-0x00,0x08,0x00,0x18,0x82,0x01,0x00,0x50,0x05,0x07,0x00,0x82,0x28,0x08,0x94,0x00,
-0x00,0x08,0x00,0xf1,0x00,0x25,0x51,0x07,0x00,0x00,0x77,0x70,0x00,0x08,0x30,0x27,
-0x00,0x07,0x40,0x46,0xf1,0x07,0xd1,0x20,0x30,0x50,0x79,0x08,0x08,0x08,0x93,0xa0,
-0x80,0x88,0x4a,0x0a,0xf5,0x08,0x28,0x8b,0x08,0xf5,0x08,0xfc,0x01,0x40,0x40,0x66,
-0x18,0x08,0x09,0x71,0x87,0xb0,0xbc,0x18,0x19,0x09,0x71,0x26,0x50,0xf1,0x07,0xf6,
-0x02,0x20,0x02,0x06,0x80,0x08,0x08,0x83,0x38,0x08,0x84,0x48,0x7c,0x80,0x08,0x08,
-0x78,0x77,0x29,0x03,0x20,0x40,0x04,0xad,0x01,0x20,0x87,0x7a,0xd6,0x02,0x41,0x47,
-0x73,0x08,0x01,0x29,0x03,0x11,0x03,0x29,0x03,0xb0,0x60,0x05,0x07,0x85,0x58,0x09,
-0x83,0x38,0x7b,0x77,0x77,0xd7,0x01,0x03,0xc8,0x01,0x10,0x40,0xc8,0x01,0xf2,0x09,
-0x50,0x05,0x07,0x82,0x28,0x09,0x85,0x58,0x7a,0x82,0x28,0x08,0x25,0x51,0x05,0x04,
-0x98,0x87,0x06,0x40,0x09,0x05,0x97,0x79,0x36,0x00,0x61,0x84,0x38,0x09,0x85,0x49,
-0x8b,0x66,0x00,0xf2,0x0a,0x03,0x04,0x30,0x06,0x05,0xa8,0x8a,0x05,0x40,0x08,0x02,
-0x78,0x85,0x20,0x30,0x67,0x09,0x08,0x08,0x90,0x93,0xa0,0x89,0x08,0x4a,0x5f,0x03,
-0x19,0x8b,0x5f,0x03,0xf1,0x09,0x60,0x11,0x66,0x18,0x03,0x49,0x71,0x88,0xa9,0xb7,
-0x17,0x89,0x29,0x71,0x00,0x00,0x22,0x00,0x07,0x87,0xc0,0x00,0x88,0x8b,0xc9,0x00,
-0x30,0x78,0x88,0x10,0xac,0x00,0x40,0x09,0x8b,0x88,0x88,0x7f,0x03,0x2a,0x58,0x84,
-0xac,0x00,0xe8,0x06,0x07,0x88,0x88,0x6b,0x80,0x08,0x4a,0x77,0x77,0x3a,0x00,0x00,
-0x04,0xac,0x00,0x50,0x03,0x00,0x12,0x00,0x90,0xdb,0x06,0x50,0x96,0x00,0x80,0x03,
-0x60,0x91,0x0c,0x02,0xc9,0x07,0x21,0x60,0x00,0xa1,0x18,0xf2,0x00,0x80,0x07,0x88,
-0x88,0x00,0x78,0x88,0x70,0x00,0x08,0x00,0x06,0x88,0x88,0x85,0xbb,0x06,0x03,0xb5,
-0x0a,0x80,0x10,0x06,0x00,0x06,0x00,0x88,0x88,0x80,0xb6,0x0b,0x30,0x38,0xc8,0x30,
-0x90,0x07,0x15,0x30,0xe3,0x11,0x02,0x3f,0x00,0x10,0x70,0x3f,0x00,0x62,0x47,0xa7,
-0x50,0x57,0x7c,0x77,0x08,0x08,0x60,0x89,0x00,0x68,0x88,0x80,0x0a,0x22,0x05,0x02,
-0x62,0x00,0x12,0x71,0xc1,0x03,0x00,0x62,0x00,0x10,0x09,0x96,0x07,0x10,0x85,0x6b,
-0x0f,0xf2,0x01,0x02,0xd3,0x00,0x04,0x90,0x85,0x00,0x30,0x00,0x20,0x07,0x00,0x07,
-0x00,0x98,0x88,0x28,0x0c,0x01,0x54,0x00,0x17,0x07,0xc4,0x03,0x10,0x01,0xc5,0x0e,
-0xc0,0x05,0x00,0x78,0x88,0x80,0x07,0x21,0x18,0x00,0x26,0x66,0x20,0x08,0x0d,0x82,
-0x20,0x80,0x00,0x07,0x14,0x00,0x00,0x79,0x68,0x15,0x12,0x70,0x5f,0x00,0x60,0x57,
-0x77,0x50,0x58,0x77,0x78,0x91,0x11,0x25,0x06,0x89,0x82,0x00,0x14,0x58,0x82,0x00,
-0x01,0xa5,0x00,0x15,0x58,0x23,0x00,0x30,0x08,0x99,0x95,0xe6,0x07,0x12,0x09,0xa5,
-0x00,0x50,0x07,0x00,0x15,0x00,0x98,0x90,0x11,0x50,0x26,0x00,0x78,0x89,0x50,0x82,
-0x00,0x83,0x9b,0x8c,0x84,0x02,0x60,0x90,0x00,0x26,0xfb,0x07,0x04,0x40,0x01,0x51,
-0x95,0x00,0x80,0x03,0x50,0x40,0x01,0x00,0x8e,0x01,0x04,0x40,0x01,0x18,0x70,0x7f,
-0x00,0x09,0x01,0x01,0x00,0x7f,0x00,0x20,0x01,0x06,0x2e,0x05,0x50,0x08,0x09,0x88,
-0x89,0x08,0x79,0x02,0x1d,0x88,0x79,0x02,0x20,0x78,0x08,0x79,0x02,0x10,0x74,0x4c,
-0x05,0x55,0x06,0x30,0x00,0x05,0xa8,0xcd,0x01,0x00,0x41,0x04,0x02,0x79,0x02,0x70,
-0x04,0x88,0x89,0x05,0x88,0x88,0x08,0x85,0x08,0xf9,0x09,0x76,0x22,0x20,0x17,0x00,
-0x87,0x82,0x59,0x00,0x99,0x85,0x59,0x00,0x99,0x86,0x5a,0x80,0x87,0x82,0x58,0x00,
-0x9a,0x79,0x48,0x23,0x0c,0xf2,0x00,0x41,0x32,0x27,0x00,0x86,0x94,0x49,0x00,0x8b,
-0x9a,0x4b,0x80,0x7b,0x7a,0x39,0xc3,0x06,0x63,0x98,0x89,0x00,0x05,0x99,0x98,0x1a,
-0x17,0xf8,0x07,0x76,0x00,0x21,0x22,0x26,0x08,0x46,0x77,0x80,0x87,0x69,0x78,0x08,
-0x75,0xa7,0x80,0x84,0x58,0x78,0x08,0x94,0xb7,0xdf,0x04,0x40,0x00,0x30,0x07,0x00,
-0xbe,0x0d,0xea,0x02,0x80,0x09,0x00,0x06,0xb0,0x0b,0x81,0x09,0x45,0x09,0x00,0x63,
-0x09,0x32,0x18,0xfb,0x06,0x00,0x50,0x07,0x00,0x01,0x70,0x09,0x00,0x07,0x90,0x0c,
-0x80,0x38,0x46,0x08,0x00,0x60,0x03,0x07,0x00,0x06,0x4e,0x04,0x02,0x28,0x00,0x20,
-0x08,0x00,0x0e,0x13,0xd0,0x06,0x70,0x08,0x00,0x19,0x83,0x0c,0x80,0x81,0x06,0x08,
-0x00,0x06,0xd3,0x12,0x00,0x26,0x00,0x00,0x6f,0x02,0x20,0x40,0x07,0x7b,0x09,0xc1,
-0x00,0x08,0x90,0x0c,0x80,0x47,0x37,0x08,0x00,0x50,0x02,0x05,0x3c,0x10,0x00,0x0f,
-0x14,0x00,0x18,0x02,0x30,0x04,0x78,0x83,0x5e,0x07,0x50,0x70,0x00,0x03,0x60,0x08,
-0x2e,0x03,0x50,0xc8,0x00,0x47,0x55,0x08,0x2b,0x07,0x11,0x80,0x1a,0x0c,0x42,0x00,
-0x72,0x02,0x80,0x16,0x18,0x20,0x05,0x74,0xb9,0x00,0xf8,0x03,0x50,0x70,0x08,0x08,
-0x08,0x02,0x70,0x80,0x80,0x6a,0x09,0x89,0x09,0x62,0x80,0x86,0x30,0x88,0x41,0x12,
-0x00,0xbf,0x0f,0xf2,0x02,0x18,0x09,0x18,0x06,0x90,0x98,0x81,0x95,0x58,0x18,0x51,
-0x04,0x60,0x60,0x08,0x88,0x83,0xf4,0x0f,0x14,0x36,0xf4,0x0f,0xf0,0x06,0x04,0x06,
+0x05,0xf5,0x25,0x00,0x02,0x00,0x00,0x00,0x9b,0x00,0x00,0x07,0x7e,0xaa,0xa6,0x69,
+0x01,0x11,0x2b,0x95,0x00,0x00,0x1b,0x0a,0x3c,0xcc,0xc9,0x00,0xbb,0x00,0x00,0x00,
+0x16,0x00,0x00,0x00,0x04,0x10,0x00,0x00,0x78,0xa2,0x00,0x09,0x60,0x0a,0x30,0x8e,
+0x70,0x1b,0xf2,0x00,0xc0,0x29,0x00,0x04,0x00,0x78,0xec,0xc8,0x00,0x00,0xab,0xb6,
+0x00,0x14,0x00,0xc0,0x7c,0xb0,0x1e,0xb2,0x1b,0x30,0x08,0x70,0x00,0xb5,0xa6,0x00,
+0xbc,0x03,0x02,0x01,0x00,0x10,0x08,0x49,0x00,0xf4,0x27,0xf4,0x00,0x00,0x00,0xd7,
+0xd0,0x00,0x00,0x5b,0x0b,0x50,0x00,0x0d,0x20,0x2d,0x00,0x06,0xa0,0x00,0xa6,0x00,
+0xef,0xff,0xff,0xe0,0x00,0x00,0x59,0x20,0x07,0x6b,0x4c,0x1d,0x67,0xd7,0xba,0x40,
+0xaf,0xb6,0xc0,0x0c,0x60,0xcc,0x10,0x20,0x1c,0x4b,0x00,0x0b,0x40,0x5d,0xcd,0x50,
+0x00,0x01,0x00,0xf3,0x38,0x03,0xdf,0xd4,0x10,0x05,0xa2,0xe2,0xa7,0x00,0xb1,0x01,
+0x01,0xb1,0x2b,0x00,0x00,0x0a,0x20,0xd1,0x00,0x00,0xc2,0x06,0xa1,0x01,0x89,0x00,
+0x06,0xaa,0xb8,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x8d,0xcc,
+0xc6,0x00,0x2d,0x0a,0x70,0x97,0x00,0xdb,0x5b,0x00,0xc1,0x0c,0x4a,0x00,0x09,0x30,
+0xc0,0x00,0x00,0xc1,0x04,0xa0,0x00,0x88,0x00,0x05,0xcc,0xd7,0x4e,0x00,0xf2,0x0b,
+0x33,0x33,0x20,0x3f,0xbb,0xd8,0x09,0x80,0x0b,0x10,0xa5,0x07,0x80,0x3c,0x98,0x60,
+0x0b,0x47,0xaa,0x00,0xa4,0x04,0x90,0x02,0xcc,0xb1,0x20,0x00,0xf3,0x0b,0x46,0x40,
+0x02,0x4c,0xfd,0x52,0x83,0x33,0x22,0x88,0x0c,0xcb,0x08,0x80,0x22,0x20,0x88,0x09,
+0x98,0x08,0x88,0x88,0x87,0x70,0x0b,0xfb,0x41,0x00,0xf2,0x6f,0x12,0x04,0x02,0xbf,
+0xeb,0xb8,0xe7,0x00,0x08,0x07,0x70,0x00,0x80,0x09,0x30,0x08,0x2b,0x10,0x00,0xb7,
+0xd7,0x00,0x03,0x02,0xbf,0xeb,0x00,0x00,0x12,0x00,0x13,0x33,0x33,0x18,0x8f,0x44,
+0x68,0x81,0x53,0xef,0xa8,0x5f,0x05,0xa9,0x81,0x60,0x00,0x78,0x4e,0x00,0x07,0x83,
+0xb0,0x00,0x78,0xaf,0x87,0x78,0x00,0x17,0x97,0x00,0x00,0x3e,0x7e,0x7c,0x10,0x0d,
+0x30,0xd2,0x3b,0x02,0xb0,0x0c,0x10,0xc0,0x39,0x1a,0x3b,0x5b,0x00,0xda,0x83,0x79,
+0xd0,0x06,0xe3,0x00,0xb4,0x00,0x05,0xcc,0xb4,0x00,0x08,0x80,0x00,0x00,0x94,0x4a,
+0x00,0x00,0xb0,0x0b,0x4b,0x80,0xa3,0x3a,0xef,0xf4,0x1e,0xfa,0xef,0xf2,0x85,0x8f,
+0xff,0xb0,0xb3,0xff,0xff,0xf2,0xed,0xee,0xee,0xe4,0x84,0x00,0x10,0x2a,0x05,0x00,
+0xf0,0x05,0x3a,0x00,0x00,0xcc,0xcc,0xec,0x10,0x07,0x99,0x99,0x97,0x00,0x1d,0xec,
+0xdd,0xd0,0x00,0x1b,0x30,0x00,0x1e,0x01,0x03,0xa8,0x00,0xf2,0x26,0x01,0x86,0x10,
+0x00,0x00,0x17,0x68,0x70,0x00,0x00,0x36,0x94,0x00,0x00,0x17,0xa2,0x00,0x01,0x95,
+0x69,0x10,0x00,0xd5,0x98,0x7b,0x00,0x0c,0x68,0x77,0xa0,0x00,0x1a,0x77,0x90,0x00,
+0x0a,0xaa,0x91,0x02,0xa2,0x28,0xc1,0x29,0x00,0xc9,0xa2,0x90,0x00,0x0b,0x29,0x00,
+0x00,0xb2,0x07,0x00,0xf2,0x19,0xb1,0xeb,0xbb,0xbb,0x00,0x37,0x30,0x00,0x00,0x37,
+0x17,0x85,0x00,0x08,0x00,0x02,0x45,0x01,0x90,0x26,0xb2,0x80,0x62,0xaa,0x82,0x09,
+0x06,0x10,0x5e,0x00,0x71,0x27,0x07,0x93,0x07,0x00,0x58,0x88,0x88,0x60,0x24,0x02,
+0xf2,0x0e,0x00,0xb3,0x80,0x00,0x32,0x3e,0x88,0x00,0x6a,0x8b,0x2b,0x20,0x0b,0x00,
+0x7b,0xc0,0x00,0xa0,0x00,0xb3,0x00,0x37,0x00,0x0b,0x30,0x04,0x60,0x00,0xb3,0x8c,
+0x00,0xf1,0x05,0x19,0x56,0x39,0x19,0x50,0x3e,0x33,0xe3,0x66,0x10,0x00,0x49,0x91,
+0x16,0xa7,0x05,0x40,0x00,0x6a,0xaa,0x19,0x00,0xf3,0x08,0x37,0x75,0x08,0x00,0x00,
+0x09,0x09,0x00,0x00,0x54,0x09,0x00,0x00,0x90,0x0c,0x80,0x08,0x20,0x08,0x00,0x63,
+0x00,0x08,0x39,0x02,0x11,0x09,0x24,0x00,0xf1,0x08,0x26,0x63,0x07,0x00,0x01,0x28,
+0x08,0x00,0x00,0x72,0x0a,0x30,0x04,0x70,0x0b,0x50,0x55,0x00,0x08,0x00,0x05,0x00,
+0x08,0x1e,0x00,0x60,0x08,0x88,0x85,0x00,0x26,0x74,0x20,0x00,0xf1,0x06,0x09,0x00,
+0x00,0x92,0x0c,0x80,0x19,0x30,0x09,0x00,0x32,0x22,0x23,0x00,0x04,0x77,0x69,0x00,
+0x06,0x99,0x97,0x24,0x00,0x72,0x04,0x88,0x85,0x00,0x27,0x85,0x07,0x68,0x00,0xf1,
+0x07,0x73,0x0c,0x80,0x06,0x60,0x08,0x00,0x32,0x00,0x04,0x00,0x07,0x88,0x87,0x00,
+0x09,0x00,0x09,0x00,0x08,0x77,0x78,0x68,0x00,0xf2,0x38,0x27,0x85,0x06,0x00,0x00,
+0x09,0x08,0x00,0x00,0x64,0x0a,0x80,0x06,0x70,0x07,0x00,0x32,0x00,0x03,0x00,0x06,
+0x05,0x06,0x00,0x0a,0x89,0x2a,0x00,0x08,0x08,0x77,0x10,0x05,0x74,0x30,0x10,0x37,
+0x84,0x07,0x00,0x00,0x27,0x09,0x00,0x00,0x81,0x0c,0x80,0x06,0x50,0x09,0x00,0x53,
+0x00,0x07,0x00,0x01,0x88,0x81,0x00,0x08,0x10,0x08,0x00,0x06,0x40,0x47,0x00,0x00,
+0x57,0x50,0x6c,0x00,0x10,0x18,0x90,0x00,0xf2,0x02,0x0d,0x80,0x08,0x40,0x09,0x00,
+0x42,0x00,0x04,0x00,0x08,0x88,0x84,0x00,0x09,0x88,0x84,0x0f,0x03,0xf1,0x10,0x88,
+0x75,0x00,0x13,0x41,0x50,0x71,0x48,0x48,0x08,0x00,0x81,0x80,0x80,0x09,0x0a,0x88,
+0x05,0x40,0x80,0x82,0x80,0x08,0x08,0x30,0x00,0x80,0x80,0x00,0x08,0x08,0x8c,0x00,
+0xf2,0x25,0x83,0x50,0x60,0x05,0x48,0x08,0x00,0xa0,0xa8,0x80,0x83,0x08,0x08,0x42,
+0x00,0x60,0x80,0x01,0x88,0x70,0x00,0x90,0x04,0x60,0x09,0x20,0x64,0x00,0x06,0x73,
+0x00,0x14,0x43,0x07,0x13,0x3a,0x08,0x00,0x27,0x08,0x00,0x92,0x8b,0x05,0x40,0x08,
+0x46,0x00,0x08,0x10,0x00,0x08,0x35,0x01,0xf1,0x00,0x07,0x86,0x08,0x00,0x00,0x90,
+0x80,0x00,0x46,0x8c,0x00,0x29,0x00,0x80,0x17,0x2d,0x01,0x90,0x70,0x00,0x90,0x00,
+0x00,0x0c,0x88,0x80,0x00,0x20,0x00,0x60,0x87,0x07,0x00,0x00,0xa0,0x90,0x20,0x00,
+0xf0,0x02,0x48,0x00,0x90,0x24,0x00,0x06,0x00,0x09,0x88,0x90,0x00,0x90,0x09,0x00,
+0x0b,0x77,0xb0,0x20,0x00,0xf4,0x0d,0x13,0x40,0x51,0x51,0x49,0x38,0x26,0x00,0x80,
+0x81,0x60,0x09,0x7b,0x16,0x06,0x30,0x81,0x62,0x80,0x08,0x16,0x30,0x00,0x81,0x60,
+0x00,0x08,0x16,0x93,0x03,0xf7,0x25,0x07,0x85,0x43,0x80,0x00,0x28,0x53,0x90,0x00,
+0x87,0xa4,0x90,0x06,0x50,0x44,0x80,0x24,0x00,0x32,0x60,0x00,0x16,0x07,0x00,0x00,
+0x59,0x0c,0x00,0x00,0x86,0xb3,0x90,0x01,0x00,0x20,0x00,0x14,0x43,0x06,0x13,0x3a,
+0x18,0x00,0x27,0x7b,0x00,0x90,0x08,0x06,0x43,0x8b,0x56,0xa3,0x00,0xf0,0x03,0x25,
+0x64,0x07,0x02,0x29,0x8c,0x00,0x63,0x09,0x05,0x72,0x8c,0x44,0x00,0x08,0x02,0x88,
+0x87,0xec,0x01,0x00,0x03,0x00,0xf0,0x0e,0x02,0x36,0x73,0x07,0x01,0x55,0x8a,0x00,
+0xa0,0x09,0x29,0x12,0x8a,0x41,0x22,0x24,0x04,0x77,0x69,0x05,0x99,0x97,0x09,0x00,
+0x00,0x03,0x88,0x86,0x05,0x36,0x00,0xf4,0x23,0x7c,0x00,0x45,0x09,0x02,0x81,0x8c,
+0x27,0x00,0x08,0x00,0x58,0x85,0x00,0xa0,0x09,0x00,0xa1,0x1a,0x00,0x17,0x61,0x13,
+0x40,0x62,0x51,0x48,0x38,0x26,0x00,0x85,0xc2,0x60,0x09,0x08,0x26,0x06,0x48,0xc2,
+0x62,0x80,0x08,0x26,0x30,0x00,0x82,0x60,0x00,0x08,0x26,0xb4,0x00,0xf0,0x08,0x68,
+0x89,0x60,0x00,0x00,0x26,0x00,0x02,0x13,0x50,0x00,0x63,0x44,0x00,0x06,0x30,0x00,
+0x68,0xa9,0x88,0x60,0x05,0x88,0xc1,0x07,0xf2,0x00,0x80,0x00,0x33,0x07,0x01,0x15,
+0x51,0x21,0x67,0x77,0x77,0x50,0x58,0x88,0x50,0x79,0x02,0x10,0x90,0x22,0x05,0x05,
+0x20,0x00,0xf5,0x07,0x08,0x00,0x04,0x50,0x10,0x68,0x88,0x88,0x50,0x50,0x00,0x40,
+0x09,0x88,0x89,0x00,0x90,0x00,0x80,0x04,0x88,0x83,0x20,0x00,0xf6,0x07,0x44,0x07,
+0x02,0x47,0x74,0x52,0x34,0x44,0x44,0x20,0x08,0x88,0x10,0x07,0x20,0x18,0x00,0x55,
+0x05,0x60,0x00,0x57,0x05,0x05,0x31,0x48,0x8a,0x08,0x5c,0x02,0xf5,0x00,0x06,0x08,
+0x0b,0x80,0x09,0x08,0x09,0x00,0x08,0x01,0x09,0x00,0x78,0x87,0x39,0xe4,0x02,0x41,
+0x03,0x88,0x50,0x70,0xb6,0x01,0xf0,0x00,0x40,0x90,0x90,0x00,0x80,0x20,0xc7,0x07,
+0xa8,0x83,0x90,0x00,0x30,0x00,0x80,0x86,0x00,0x48,0x00,0x88,0x88,0x50,0xc1,0x00,
+0xf2,0x01,0x33,0x50,0x03,0x68,0x43,0x00,0x36,0x80,0x00,0x69,0xaa,0x88,0x50,0x05,
+0x88,0x84,0xac,0x00,0x00,0x58,0x01,0x30,0x50,0x68,0x88,0x26,0x02,0x05,0xc0,0x00,
+0x25,0x01,0x00,0xa1,0x00,0x60,0x00,0x07,0x06,0x88,0x88,0x86,0x19,0x00,0x2a,0x58,
+0xc8,0xe1,0x00,0x12,0x86,0x0b,0x00,0xf0,0x00,0x06,0x04,0x88,0x88,0x85,0x01,0x15,
+0x11,0x00,0x67,0x96,0xb0,0x08,0x85,0x08,0xe1,0x00,0x31,0x06,0x86,0x04,0x9d,0x00,
+0x40,0x28,0x86,0x08,0x00,0x9b,0x02,0xd0,0x07,0x08,0x07,0x88,0x84,0x80,0x03,0x53,
+0x8a,0x00,0x11,0x00,0x80,0x70,0x00,0xf0,0x07,0x89,0x88,0x70,0x08,0x88,0x18,0x00,
+0x00,0x53,0x80,0x00,0x05,0x28,0x00,0x00,0x41,0x80,0x47,0x78,0x78,0x00,0x09,0xb6,
+0x00,0x41,0x08,0x00,0x08,0x00,0x6e,0x02,0x00,0x25,0x01,0x01,0x80,0x00,0x50,0x17,
+0x00,0x00,0x00,0x40,0x35,0x04,0x10,0x09,0xea,0x03,0xa4,0x90,0x00,0x08,0x09,0x00,
+0x00,0x10,0x10,0x00,0x05,0x20,0x00,0x10,0x08,0xc5,0x05,0x81,0x68,0xaa,0xc9,0x50,
+0x64,0x37,0x10,0x09,0xf5,0x00,0x10,0x70,0x40,0x00,0xd1,0x58,0x89,0x50,0x00,0x00,
+0x35,0x00,0x00,0x05,0x30,0x00,0x00,0x51,0x06,0x01,0x13,0x88,0xf5,0x00,0x51,0x02,
+0x70,0x00,0x00,0x25,0xd5,0x00,0x00,0x27,0x00,0x29,0x88,0x60,0xd5,0x00,0x12,0x83,
+0x20,0x00,0x11,0x26,0x55,0x00,0x11,0x88,0x5d,0x01,0x03,0xb1,0x00,0x15,0x04,0xf1,
+0x00,0xf0,0x01,0x05,0x88,0x88,0x87,0x00,0x11,0x11,0x00,0x47,0x77,0xa0,0x06,0x88,
+0x88,0x00,0xa0,0xad,0x00,0x21,0x87,0x00,0x5c,0x00,0x54,0x01,0x70,0x00,0x00,0x15,
+0x5c,0x00,0x08,0xf2,0x01,0x80,0x84,0x00,0x04,0x44,0x07,0x03,0x3b,0x08,0xa7,0x03,
+0x66,0x82,0x08,0x03,0x70,0x08,0x28,0xd7,0x02,0x00,0xf9,0x03,0x00,0xf8,0x03,0x88,
+0x92,0x09,0x29,0x30,0x09,0x11,0x22,0x23,0xbc,0x02,0xf1,0x0c,0x48,0x83,0x06,0x00,
+0x45,0x09,0x00,0xa0,0x09,0x19,0x20,0x08,0x40,0x00,0x06,0x06,0x00,0x05,0x08,0x98,
+0x89,0x08,0x00,0x08,0x03,0x78,0x84,0xbf,0x00,0xf6,0x0a,0x58,0x18,0x00,0x08,0x17,
+0x29,0x00,0x09,0x09,0x09,0x00,0x08,0x0a,0x0a,0x82,0x71,0x36,0x08,0x00,0x30,0x90,
+0x08,0x00,0x00,0x10,0x07,0x05,0xf3,0x05,0x34,0x24,0x06,0x29,0x3a,0x18,0x09,0x09,
+0x09,0x08,0x09,0x6c,0x52,0x45,0x08,0x50,0x90,0x08,0x00,0x20,0x79,0x00,0x61,0x08,
+0x84,0x85,0x00,0x07,0x20,0xc5,0x03,0x30,0x07,0x00,0x60,0xf0,0x00,0x0a,0x05,0x02,
+0x00,0x01,0x00,0x50,0x8b,0x48,0xa0,0x00,0x90,0xef,0x04,0x43,0x90,0x02,0x70,0x08,
+0x49,0x01,0xf0,0x03,0x60,0x08,0x94,0x86,0x00,0x07,0x10,0x90,0x00,0x90,0x08,0x05,
+0x78,0x77,0x85,0x00,0x01,0x11,0x65,0x02,0x00,0x25,0x00,0x31,0x97,0x77,0x80,0xb9,
+0x02,0xf0,0x0a,0x94,0x87,0x00,0x08,0x10,0x90,0x00,0x80,0x08,0x05,0x87,0x77,0x85,
+0x00,0x11,0x10,0x00,0x97,0x77,0x40,0x09,0x88,0x85,0x00,0x80,0x5a,0x02,0x52,0x75,
+0x00,0x03,0x00,0x07,0x43,0x05,0x01,0x04,0x00,0x20,0x0a,0x82,0x08,0x00,0x24,0x0b,
+0x88,0xd7,0x02,0x02,0xb8,0x00,0x51,0x40,0x00,0x07,0x00,0x80,0x16,0x02,0xf3,0x06,
+0x0c,0x80,0x79,0x88,0x08,0x00,0x01,0x22,0x24,0x00,0x05,0x77,0x69,0x00,0x07,0x89,
+0x87,0x00,0x0a,0x00,0x00,0x82,0x02,0x00,0x67,0x01,0x10,0x08,0x28,0x00,0x71,0x20,
+0x80,0x00,0x0b,0x60,0x88,0x88,0x29,0x05,0xa3,0x00,0x09,0x88,0x86,0x00,0x0a,0x00,
+0x09,0x00,0x0a,0xa3,0x05,0xe0,0x03,0x00,0x60,0x70,0x90,0x08,0x08,0x09,0x00,0x80,
+0x80,0x90,0x09,0x89,0x07,0x00,0x45,0xb7,0x78,0x08,0x00,0x37,0x05,0xf1,0x01,0x10,
+0x04,0x00,0x07,0x09,0x00,0x09,0x09,0x03,0x5a,0x09,0x02,0x3a,0x09,0x00,0x09,0x8b,
+0x00,0x12,0x09,0x89,0x00,0x70,0x05,0x00,0x07,0x00,0x90,0x68,0xc1,0xa8,0x00,0x30,
+0xc8,0x84,0x80,0x4b,0x00,0x60,0x18,0x88,0xc0,0x01,0x98,0x8b,0x5d,0x02,0x50,0x01,
+0x88,0x77,0x10,0x06,0x09,0x01,0x01,0x20,0x00,0xf2,0x06,0x10,0xb8,0x84,0x80,0x00,
+0x27,0x64,0x00,0x37,0x89,0x72,0x00,0x37,0x72,0x00,0x0a,0x01,0xa0,0x00,0x48,0x72,
+0x7b,0x00,0x81,0x09,0x08,0x09,0x02,0xa0,0x80,0x91,0x5b,0x82,0x00,0x19,0xb8,0x7b,
+0x00,0x16,0x03,0xc7,0x02,0x51,0x88,0x88,0x40,0x00,0x04,0x7d,0x01,0x53,0x68,0x8b,
+0x88,0x60,0x06,0xa0,0x03,0x20,0x89,0x84,0x12,0x00,0x00,0x9d,0x01,0x30,0x68,0x88,
+0x50,0x38,0x00,0x31,0x6c,0x8c,0x60,0x22,0x03,0x02,0x20,0x00,0x11,0x09,0xc6,0x02,
+0x00,0x32,0x04,0x46,0x06,0x88,0xc8,0x85,0xcc,0x02,0x22,0x00,0x06,0x59,0x00,0xd4,
+0x04,0x88,0x84,0x05,0x87,0x87,0x85,0x00,0x19,0x11,0x00,0x57,0x76,0xb1,0x02,0x00,
+0x3c,0x01,0x0e,0x40,0x00,0xd1,0x9b,0x8c,0x85,0x01,0x70,0x90,0x00,0x17,0x09,0x00,
+0x00,0x20,0x20,0x20,0x00,0x07,0x99,0x00,0x25,0x00,0x00,0x46,0x03,0x81,0x10,0x00,
+0x00,0x81,0x00,0x00,0x08,0x98,0x83,0x02,0x02,0xdc,0x04,0x80,0x00,0x09,0x00,0x00,
+0x00,0x98,0x88,0x60,0xf4,0x17,0x05,0x00,0x00,0x00,0x81,0x00,0x00,0x07,0x88,0x84,
+0x01,0x11,0x12,0x21,0x56,0x66,0x66,0x40,0x07,0x87,0x00,0x06,0x40,0x28,0x00,0x65,
+0x04,0x70,0x00,0x57,0x50,0x00,0x03,0x00,0x07,0x09,0x00,0x09,0x03,0x00,0x71,0x08,
+0x0b,0x88,0x38,0x00,0x00,0x08,0x03,0x00,0x01,0x01,0x00,0xf0,0x0c,0x60,0x00,0x80,
+0x09,0x00,0x08,0x00,0x90,0x00,0x80,0x0c,0x88,0x48,0x00,0x00,0x00,0x50,0x01,0x98,
+0x89,0x00,0x26,0x00,0x90,0x02,0xa7,0x7b,0x1f,0x00,0xf1,0x10,0x05,0x00,0x07,0x00,
+0x90,0x00,0x81,0x09,0x00,0x08,0x10,0xc8,0x84,0x80,0x00,0x00,0x04,0x00,0x14,0x00,
+0x50,0x03,0xb8,0x8c,0x00,0x26,0x00,0x80,0x01,0x78,0x87,0x43,0x00,0x20,0x48,0x84,
+0x40,0x00,0x00,0x04,0x00,0x60,0x09,0x00,0x90,0x00,0x0c,0x80,0x0c,0x00,0x42,0x88,
+0x88,0x18,0x00,0x65,0x00,0x17,0x09,0x24,0x00,0x01,0x20,0x00,0x81,0x70,0x90,0x01,
+0x09,0x10,0x48,0x76,0x09,0x5c,0x00,0x72,0x0a,0x00,0x00,0x00,0x0a,0x88,0x85,0x24,
+0x00,0x16,0x83,0x44,0x00,0x40,0x88,0x89,0x08,0x00,0x6e,0x00,0x80,0x06,0x00,0x05,
+0x00,0x0b,0x88,0x88,0x00,0xa4,0x00,0xf1,0x1a,0x05,0x88,0x83,0x00,0x24,0x50,0x67,
+0x09,0x33,0x09,0x80,0x90,0x00,0x88,0x09,0x00,0x0c,0xc0,0x90,0x00,0x88,0x08,0x88,
+0x28,0x80,0x00,0x00,0x88,0x00,0x00,0x08,0x80,0x00,0x00,0x01,0x00,0x04,0x55,0x07,
+0x0a,0x32,0xeb,0x00,0x85,0x04,0x7c,0x09,0x00,0x09,0x0b,0x88,0x39,0xee,0x00,0xf0,
+0x34,0x67,0x50,0x70,0x91,0x00,0x90,0x90,0x38,0xc0,0xb8,0x92,0x90,0x01,0x22,0x40,
+0x06,0x66,0xb0,0x09,0x88,0xa0,0x17,0x00,0x00,0x08,0x88,0x81,0x77,0x60,0x33,0x90,
+0x00,0x44,0x90,0x48,0xa4,0xa3,0x51,0x44,0x34,0x20,0x22,0x19,0x88,0x92,0x07,0x00,
+0x80,0x2b,0x88,0xc4,0x00,0x00,0x00,0x25,0x40,0x67,0x08,0x33,0x08,0x80,0x80,0x00,
+0x88,0x08,0x04,0x79,0x07,0x00,0x36,0x07,0x88,0x38,0x71,0x00,0xf0,0x13,0x00,0x00,
+0x06,0x62,0x61,0x60,0x91,0x09,0x17,0x08,0x08,0xc1,0x70,0x91,0x28,0x17,0x05,0x63,
+0x61,0x60,0x07,0x88,0x82,0x00,0x00,0x03,0x60,0x00,0x00,0x35,0x00,0x00,0x00,0x10,
+0x24,0x00,0xf0,0x06,0x78,0x28,0x17,0x09,0x00,0x91,0x70,0x80,0x8c,0x17,0x08,0x00,
+0x91,0x70,0x88,0x69,0x17,0x00,0x40,0x61,0x60,0x93,0x00,0xf0,0x10,0xa8,0x88,0x30,
+0x00,0x00,0x00,0x07,0x82,0x71,0x60,0x90,0x2a,0x18,0x08,0x05,0xb1,0x70,0xb8,0x68,
+0x17,0x00,0x00,0x20,0x20,0x06,0x88,0x96,0x00,0x78,0x89,0x40,0x23,0x00,0x82,0x68,
+0x88,0x40,0x04,0x88,0x82,0x00,0x80,0x49,0x01,0xe0,0x88,0x88,0x30,0x00,0x04,0x00,
+0x00,0x00,0x90,0x00,0x68,0x8b,0x88,0x60,0x11,0x01,0x01,0xfb,0x01,0x11,0x85,0x12,
+0x00,0x62,0x88,0x88,0x50,0x58,0x88,0x50,0x29,0x00,0x10,0x90,0x0d,0x01,0x00,0x20,
+0x00,0x16,0x80,0x20,0x00,0x30,0x89,0x88,0x50,0x1b,0x02,0x42,0x30,0x18,0x00,0x55,
+0x1b,0x02,0xf0,0x0b,0x07,0x77,0x17,0x01,0x80,0x00,0x80,0x18,0x00,0x08,0x00,0xc8,
+0x83,0x80,0x00,0x20,0x08,0x00,0x08,0x00,0x80,0x48,0xa7,0x68,0x00,0x00,0x37,0x00,
+0x02,0x01,0x00,0x21,0x88,0x81,0x20,0x02,0xd0,0xc7,0x72,0x90,0x00,0x90,0x09,0x05,
+0x8c,0x85,0x90,0x00,0x10,0x08,0xda,0x00,0xf0,0x11,0x03,0xb8,0x87,0x00,0x08,0x88,
+0x16,0x00,0x90,0x00,0x71,0x0c,0x78,0x27,0x10,0x08,0x00,0x71,0x48,0x87,0x57,0x00,
+0x28,0x88,0x80,0x05,0x40,0x09,0x00,0x4a,0x88,0xb0,0x3d,0x02,0x00,0x80,0x00,0x12,
+0xa0,0x90,0x00,0x30,0x58,0x87,0x30,0x2d,0x01,0x34,0x88,0xc8,0x85,0x9f,0x00,0x10,
+0x02,0x0f,0x00,0x01,0xa0,0x00,0xf0,0x04,0x05,0x88,0x85,0x05,0x77,0x77,0x85,0x00,
+0x19,0x11,0x00,0x57,0x76,0xa0,0x06,0x88,0x88,0x00,0xa0,0x15,0x00,0x72,0x86,0x00,
+0x08,0x88,0x17,0x00,0x90,0xa0,0x02,0xc1,0x88,0x83,0x80,0x58,0x88,0x68,0x00,0x09,
+0x00,0x80,0x00,0x90,0xa7,0x00,0x0c,0x60,0x00,0x20,0x88,0x50,0x60,0x00,0x90,0x9b,
+0x8c,0x85,0x01,0x80,0x90,0x00,0x17,0x09,0x46,0x01,0x08,0x60,0x00,0x6b,0x78,0x78,
+0x75,0x00,0x91,0x91,0x60,0x00,0x52,0x04,0x88,0x81,0x00,0x90,0x40,0x00,0x51,0x97,
+0x78,0x30,0x00,0x11,0xf1,0x00,0x00,0x47,0x01,0x08,0x59,0x01,0x6e,0x00,0x00,0x57,
+0x77,0x77,0x50,0x59,0x01,0x10,0x90,0x3a,0x02,0x13,0x85,0x32,0x00,0x22,0x60,0x30,
+0x1e,0x00,0x33,0x98,0x88,0x70,0x3c,0x00,0x11,0x04,0xd5,0x00,0xd0,0x75,0x00,0x11,
+0x10,0x00,0x57,0x77,0xa0,0x06,0x88,0x87,0x00,0xa0,0x15,0x00,0x2a,0x76,0x00,0x5c,
+0x00,0x00,0x6e,0x00,0x10,0x06,0xb0,0x03,0x04,0x95,0x01,0x00,0xc2,0x02,0x54,0x00,
+0xa2,0x20,0x90,0x08,0xec,0x00,0x54,0x09,0x00,0xb8,0x84,0x90,0x7c,0x00,0x00,0x4d,
+0x02,0xf1,0x0b,0x60,0x70,0x90,0x00,0x90,0x90,0x00,0x90,0xa3,0x42,0x90,0x34,0x30,
+0x80,0x04,0x88,0x40,0x09,0x00,0x90,0x0a,0x01,0xa0,0x02,0x76,0x10,0x45,0x03,0x63,
+0x58,0x38,0x00,0x90,0x80,0x09,0x04,0x00,0x40,0x0a,0x81,0x90,0x80,0x8d,0x03,0x19,
+0x38,0x8d,0x03,0xf1,0x0c,0x24,0x33,0x60,0x78,0x29,0x18,0x08,0x80,0x80,0x80,0x88,
+0x08,0x08,0x88,0x80,0x80,0x80,0x87,0x79,0x78,0x08,0x00,0x00,0x80,0x80,0x00,0x08,
+0x17,0x04,0xe7,0x07,0x73,0x86,0x00,0x80,0x63,0x00,0x18,0x06,0x20,0x00,0xc8,0x79,
+0x70,0x71,0x02,0xee,0x06,0x84,0x86,0x00,0x90,0x53,0x00,0x09,0x05,0x30,0x00,0x78,
+0x58,0x70,0xd1,0x01,0xf0,0x03,0x48,0x48,0x37,0x80,0x62,0x08,0x80,0x62,0x08,0x48,
+0x48,0x58,0x67,0x78,0x68,0x00,0x90,0x08,0x03,0x00,0x14,0x80,0x6c,0x04,0x40,0x29,
+0x84,0x08,0x00,0x85,0x04,0x00,0x04,0x00,0x22,0x89,0x95,0x29,0x04,0x33,0x87,0x89,
+0x28,0x98,0x00,0x02,0x26,0x00,0x31,0x28,0x84,0x07,0x20,0x00,0xf5,0x00,0x68,0x87,
+0x0b,0x40,0x90,0x00,0x0a,0x40,0x58,0x88,0x08,0x00,0x03,0x00,0x08,0x29,0x04,0x10,
+0x38,0x20,0x00,0xf1,0x0b,0x08,0x09,0x00,0x78,0x85,0x0d,0x80,0x90,0x01,0x09,0x00,
+0x38,0x75,0x07,0x00,0x05,0x88,0x84,0x00,0x0a,0x00,0x09,0x00,0x09,0x88,0x88,0x44,
+0x00,0x06,0x24,0x00,0xf0,0x07,0x0c,0x80,0x91,0x13,0x09,0x00,0x37,0x65,0x07,0x00,
+0x00,0x78,0x81,0x00,0x07,0x30,0x18,0x00,0x06,0x50,0x37,0x00,0x67,0x01,0xf5,0x08,
+0x35,0x50,0x50,0x71,0x3a,0x08,0x08,0x00,0x90,0x80,0x87,0x89,0x0b,0x88,0x90,0x00,
+0x80,0x89,0x56,0x38,0x08,0x02,0x10,0x04,0x01,0xf6,0x07,0x47,0x70,0x66,0x10,0x09,
+0x09,0x71,0x68,0xa0,0xcc,0x18,0x00,0x09,0x71,0x38,0x72,0x66,0x10,0x28,0x88,0x80,
+0x00,0xec,0x00,0x01,0x64,0x00,0xf1,0x00,0x80,0xc7,0x78,0x85,0x08,0x09,0x11,0x30,
+0xc7,0x36,0x64,0x08,0x00,0x07,0x88,0x61,0x00,0x03,0x77,0x05,0xf3,0x05,0x15,0x52,
+0x06,0x13,0x38,0x08,0x00,0x08,0x18,0x79,0x95,0x6a,0x80,0x00,0x08,0x86,0x67,0x18,
+0x02,0x20,0x89,0x04,0xf5,0x09,0x58,0x80,0x07,0x00,0x80,0x09,0x68,0x90,0x7b,0x82,
+0x13,0x08,0x26,0x63,0x07,0x05,0x88,0x87,0x08,0x00,0x09,0x07,0x77,0x79,0x1b,0x00,
+0xf3,0x09,0x78,0x80,0x7b,0x80,0x01,0x08,0x38,0x74,0x06,0x05,0x00,0x05,0x08,0x98,
+0x8a,0x08,0x00,0x08,0x03,0x78,0x84,0x35,0x40,0x60,0xb1,0x00,0x41,0x88,0x98,0x6a,
+0x08,0xb1,0x00,0x18,0x28,0xb1,0x00,0xf2,0x06,0x37,0x60,0x67,0x00,0x09,0x09,0x90,
+0x68,0x96,0xb9,0x08,0x00,0x18,0x90,0x38,0x72,0x67,0x00,0x28,0x88,0x70,0xb1,0x00,
+0x11,0x80,0x9d,0x01,0xc0,0x00,0x00,0x03,0x86,0x08,0x80,0x00,0x80,0x98,0x04,0x8a,
+0x6b,0xc9,0x04,0xd0,0x05,0x87,0x28,0x80,0x01,0x10,0x88,0x00,0x45,0x00,0x00,0x03,
+0xa7,0x39,0x01,0x00,0xb4,0x00,0xcd,0x03,0x38,0x39,0x00,0x08,0x59,0x79,0x94,0x08,
+0x80,0x00,0x8a,0xb4,0x00,0xd0,0x7b,0x68,0xa0,0x09,0x80,0x00,0x6a,0x48,0x74,0x08,
+0x04,0x88,0x86,0x5b,0x00,0x00,0x03,0x00,0x12,0x02,0x1b,0x00,0x50,0x88,0x70,0x7a,
+0x78,0x76,0x0f,0x00,0x41,0x04,0x98,0x89,0x04,0xbe,0x05,0xd0,0x03,0x88,0x87,0x04,
+0x88,0x72,0x00,0x00,0x02,0x70,0x06,0x88,0x95,0x35,0x01,0x10,0x04,0xf3,0x02,0x10,
+0x80,0x49,0x02,0x90,0x50,0x03,0x87,0x76,0x00,0x48,0x88,0x80,0x09,0xad,0x01,0x61,
+0xc8,0x50,0x68,0x8c,0x88,0x50,0xcf,0x03,0x12,0x8a,0x5e,0x01,0xf0,0x01,0x04,0x00,
+0x03,0x77,0x65,0x00,0x38,0x88,0x80,0x08,0x21,0x11,0x00,0x27,0xc7,0x40,0x20,0x00,
+0x14,0x20,0x61,0x03,0x40,0x60,0x03,0x88,0x86,0x3c,0x00,0x90,0x08,0x65,0x54,0x00,
+0x02,0xa2,0x10,0x57,0x78,0x9d,0x03,0x42,0x90,0x05,0x88,0x89,0x61,0x03,0x42,0x86,
+0x00,0x03,0x77,0x5c,0x00,0x52,0x10,0x00,0x00,0x37,0xc7,0x5c,0x00,0xf3,0x05,0x40,
+0x00,0x00,0x3d,0x20,0x00,0x59,0x18,0x50,0x03,0x00,0x02,0x00,0x04,0x88,0x83,0x00,
+0x00,0x02,0x60,0x95,0x00,0xc1,0x05,0x87,0x85,0x00,0x07,0x07,0x00,0x68,0xb8,0xb8,
+0x50,0x03,0x93,0x03,0x40,0x80,0x09,0x88,0x84,0x67,0x00,0x01,0xde,0x02,0x26,0xb8,
+0x87,0xf5,0x03,0x10,0x00,0xb5,0x00,0x00,0x95,0x00,0xf0,0x01,0x10,0x00,0x00,0x38,
+0x88,0x50,0x68,0x8a,0x88,0x50,0x20,0x90,0x10,0x09,0x89,0x89,0xa4,0x04,0x34,0x04,
+0x88,0x84,0x59,0x00,0x52,0x09,0x88,0x83,0x00,0x98,0x8f,0x04,0x51,0x8b,0x8b,0x85,
+0x01,0x70,0x8f,0x04,0x00,0x0a,0x06,0x00,0xb9,0x00,0xf1,0x08,0x26,0x66,0x80,0x08,
+0x32,0x21,0x00,0x38,0x87,0x50,0x57,0xa7,0xa7,0x50,0x5c,0x8c,0x50,0x09,0x00,0x09,
+0x00,0x98,0x88,0xda,0x03,0x30,0x04,0x88,0x71,0x40,0x00,0x13,0x05,0x99,0x00,0x06,
+0x21,0x04,0x90,0x03,0x77,0x74,0x00,0x47,0x78,0x70,0x09,0x11,0xe8,0x04,0x10,0x60,
+0x12,0x00,0x12,0x20,0x96,0x01,0x10,0x89,0x0e,0x01,0xf2,0x02,0x87,0x00,0x48,0x88,
+0x70,0x08,0x43,0x33,0x00,0x14,0x54,0x30,0x47,0x77,0x78,0x60,0x49,0x0e,0x01,0x01,
+0x71,0x01,0x11,0x87,0x75,0x01,0xc0,0x36,0x67,0x70,0x09,0x22,0x20,0x00,0x48,0x88,
+0x50,0x57,0x88,0x2e,0x01,0x10,0x40,0x75,0x00,0x31,0x97,0x77,0x80,0xf4,0x01,0xf2,
+0x0c,0x53,0x05,0x10,0x32,0x90,0x71,0x00,0x09,0x07,0x17,0x99,0x50,0x71,0x80,0x00,
+0x07,0x18,0x66,0x71,0x71,0x02,0x10,0x07,0x10,0x00,0x00,0x61,0x4c,0x03,0xd1,0x06,
+0x00,0x09,0x09,0x68,0x85,0x09,0x80,0x01,0x09,0x38,0x75,0x07,0xc4,0x01,0x03,0xf9,
+0x01,0x00,0xab,0x03,0x30,0x08,0x09,0x58,0x55,0x02,0xd0,0x08,0x48,0x88,0x18,0x02,
+0x10,0x08,0x07,0x30,0x00,0x06,0xa8,0x86,0x1b,0x03,0x01,0x33,0x00,0xf1,0x00,0x81,
+0x13,0x09,0x27,0x65,0x06,0x05,0x88,0x87,0x07,0x20,0x09,0x07,0x87,0x79,0x4e,0x00,
+0xf1,0x0a,0x05,0x00,0x09,0x09,0x78,0x85,0x09,0x80,0x02,0x08,0x38,0x73,0x06,0x04,
+0x20,0x06,0x06,0xa8,0x89,0x06,0x30,0x08,0x02,0x78,0x84,0x51,0x03,0xa0,0x90,0x90,
+0x68,0x85,0x09,0x08,0x00,0x10,0x90,0x38,0x4c,0x02,0xa2,0x70,0x40,0x00,0x1c,0x50,
+0x00,0x2a,0x15,0x70,0x02,0x71,0x03,0x00,0x56,0x00,0x11,0x86,0x89,0x00,0xe1,0x76,
+0x08,0x00,0x68,0x82,0x03,0x70,0x09,0x02,0x90,0x29,0x00,0x37,0x60,0xb0,0x03,0x10,
+0x83,0x69,0x04,0x13,0x09,0x04,0x00,0x93,0x0c,0x81,0x80,0x09,0x08,0x00,0x78,0x88,
+0x08,0x58,0x04,0x13,0x08,0x85,0x08,0xf0,0x02,0x07,0x00,0x90,0x09,0x09,0x00,0x90,
+0x09,0x0c,0x80,0x80,0x08,0x08,0x00,0x38,0x83,0x08,0x38,0x09,0x03,0x80,0x04,0x24,
+0x09,0x00,0xd8,0x03,0x02,0x44,0x00,0xb7,0x0a,0x40,0x80,0x08,0x0a,0x30,0x37,0x72,
+0x08,0x00,0x05,0x80,0x04,0x0d,0x44,0x00,0xf2,0x03,0x84,0x35,0x00,0x06,0x05,0xa9,
+0x10,0x09,0x01,0x85,0x00,0x0b,0x67,0x38,0x00,0x01,0x10,0x63,0xed,0x08,0x02,0x88,
+0x00,0x40,0x80,0x78,0x86,0x09,0x7a,0x03,0x50,0x00,0x05,0x88,0x78,0x00,0x06,0x06,
+0x22,0x0a,0x00,0x7c,0x06,0x05,0x15,0x09,0x11,0x09,0x28,0x00,0x41,0x70,0x87,0x78,
+0x09,0xf1,0x08,0xf3,0x06,0x05,0x88,0x94,0x00,0x00,0x05,0x90,0x00,0x04,0x96,0xa4,
+0x00,0x03,0x00,0x03,0x00,0x25,0x40,0x56,0x08,0x39,0xab,0x05,0x88,0x0c,0xc0,0x80,
+0x80,0x88,0x07,0x7a,0x08,0xf1,0x08,0xf1,0x09,0x38,0x80,0x63,0x18,0x06,0x29,0x41,
+0x80,0x62,0xb8,0x18,0x7b,0x19,0x11,0x00,0x00,0x20,0x00,0x06,0x00,0x30,0x00,0xc8,
+0x8b,0x24,0x07,0xd0,0x78,0x86,0x00,0x38,0x80,0x67,0x08,0x08,0x09,0x80,0x80,0x80,
+0xbc,0x07,0x00,0xf4,0x15,0x38,0x70,0x78,0x00,0x00,0x33,0x20,0x00,0x0a,0x80,0x00,
+0x08,0x54,0x80,0x02,0x20,0x02,0x20,0x25,0x52,0x06,0x82,0x18,0x08,0x80,0x08,0x08,
+0x80,0x0a,0x7a,0x80,0x08,0x09,0x77,0x78,0x08,0x31,0x09,0x00,0x0b,0x01,0xf0,0x06,
+0x80,0x08,0x09,0x80,0x09,0x8b,0x80,0x08,0x08,0x37,0x72,0x08,0x02,0x30,0x08,0x04,
+0x60,0x00,0x04,0xb8,0x87,0x6d,0x04,0x81,0x83,0x07,0x81,0x18,0x09,0x80,0x08,0x7b,
+0xdf,0x00,0xd0,0x03,0x03,0x88,0x8a,0x03,0x98,0x88,0x06,0x30,0x00,0x02,0x88,0x76,
+0x31,0x09,0xa0,0x39,0x08,0x90,0x80,0x80,0x89,0x08,0x08,0x8a,0x80,0xb1,0x00,0x17,
+0x7b,0xb1,0x00,0x02,0x3b,0x00,0x20,0x19,0x8b,0x71,0x00,0x62,0x09,0x8a,0x48,0x83,
+0x08,0x03,0x36,0x02,0x11,0x97,0x56,0x00,0xd9,0x84,0x07,0x80,0x0a,0x8b,0x80,0x09,
+0x09,0x83,0x29,0x8b,0x25,0x52,0xe3,0x01,0x61,0x05,0x77,0x73,0x00,0x90,0x01,0x0b,
+0x08,0x57,0x97,0x78,0x70,0x00,0x02,0x04,0x09,0x50,0x86,0x00,0x80,0x00,0x80,0x5b,
+0x01,0x00,0x5c,0x04,0x0d,0x04,0x09,0x30,0x06,0x88,0x86,0xa0,0x03,0x30,0x08,0x88,
+0x88,0x20,0x00,0x00,0xb5,0x03,0x22,0x00,0x60,0x0e,0x04,0x11,0x08,0x0e,0x04,0x00,
+0x3c,0x06,0x30,0x90,0x00,0x90,0x12,0x03,0x32,0x68,0x88,0x50,0xd3,0x06,0x17,0x86,
+0xd3,0x06,0x01,0x20,0x00,0x41,0x01,0x70,0x08,0x87,0xec,0x0a,0x00,0x72,0x00,0x50,
+0x40,0x90,0x00,0x08,0x03,0x7c,0x03,0x10,0x70,0x75,0x00,0x01,0xfc,0x03,0x0f,0x60,
+0x08,0x04,0x60,0x25,0x52,0x06,0x08,0x21,0x80,0x27,0x02,0xb2,0x08,0x00,0x80,0x80,
+0x80,0x09,0x08,0x07,0x77,0x80,0x80,0x5c,0x01,0x13,0x80,0x5c,0x03,0x30,0x80,0x09,
+0x09,0x03,0x00,0x49,0x08,0x09,0x38,0x83,0x55,0x05,0x03,0x7c,0x01,0x2e,0x08,0x09,
+0x61,0x01,0xe0,0x38,0x84,0x05,0x08,0x00,0x90,0x90,0x80,0x09,0x09,0x08,0x00,0x80,
+0x90,0xc4,0x02,0xd1,0x00,0x50,0x50,0x00,0x0c,0x30,0x00,0x0a,0x27,0x50,0x03,0x10,
+0x04,0xb7,0x01,0x00,0x56,0x00,0x4b,0x08,0x83,0x28,0x09,0x46,0x01,0x30,0x48,0x84,
+0x07,0x34,0x00,0xf2,0x0c,0x80,0x08,0x09,0x05,0x88,0x50,0x90,0x00,0x22,0x13,0x00,
+0x03,0x65,0x00,0x03,0x87,0xc9,0x00,0x05,0xac,0x10,0x05,0x30,0x16,0x10,0x20,0x02,
+0xfd,0x02,0x80,0x83,0x38,0x09,0x00,0x84,0x48,0x0b,0x81,0xe1,0x02,0x2a,0x78,0x77,
+0x45,0x03,0xc0,0x40,0x04,0x06,0x00,0x82,0x28,0x09,0x00,0x85,0x58,0x0c,0x80,0x2c,
+0x00,0x3d,0x38,0x73,0x07,0x45,0x03,0x22,0x40,0x04,0x48,0x00,0x20,0x88,0x88,0x45,
+0x03,0x57,0x0b,0x40,0x58,0x85,0x09,0xc5,0x07,0x12,0x84,0x79,0x0c,0x20,0x06,0x08,
+0x20,0x00,0x81,0x20,0x80,0x08,0x0b,0x70,0x77,0x77,0x08,0x25,0x03,0x73,0x06,0x98,
+0x88,0x00,0x07,0x99,0x97,0x25,0x03,0x12,0x75,0x28,0x00,0xd0,0x34,0x08,0x00,0x88,
+0xa6,0x0a,0x10,0x80,0x55,0x0c,0x70,0x77,0xa4,0x28,0x00,0xf1,0x0a,0x13,0x00,0x27,
+0xc2,0x78,0x00,0x18,0xb0,0x08,0x00,0x46,0x00,0x08,0x00,0x18,0x82,0x01,0x00,0x50,
+0x05,0x07,0x00,0x82,0x28,0x08,0x94,0x00,0x00,0x08,0x00,0xf1,0x00,0x25,0x51,0x07,
+0x00,0x00,0x77,0x70,0x00,0x08,0x30,0x27,0x00,0x07,0x40,0x46,0xf1,0x07,0xd1,0x20,
+0x30,0x50,0x79,0x08,0x08,0x08,0x93,0xa0,0x80,0x88,0x4a,0x0a,0xf5,0x08,0x28,0x8b,
+0x08,0xf5,0x08,0xfc,0x01,0x40,0x40,0x66,0x18,0x08,0x09,0x71,0x87,0xb0,0xbc,0x18,
+0x19,0x09,0x71,0x26,0x50,0xf1,0x07,0xf6,0x02,0x20,0x02,0x06,0x80,0x08,0x08,0x83,
+0x38,0x08,0x84,0x48,0x7c,0x80,0x08,0x08,0x78,0x77,0x29,0x03,0x20,0x40,0x04,0xad,
+0x01,0x20,0x87,0x7a,0xd6,0x02,0x41,0x47,0x73,0x08,0x01,0x29,0x03,0x11,0x03,0x29,
+0x03,0xb0,0x60,0x05,0x07,0x85,0x58,0x09,0x83,0x38,0x7b,0x77,0x77,0xd7,0x01,0x03,
+0xc8,0x01,0x10,0x40,0xc8,0x01,0xf2,0x09,0x50,0x05,0x07,0x82,0x28,0x09,0x85,0x58,
+0x7a,0x82,0x28,0x08,0x25,0x51,0x05,0x04,0x98,0x87,0x06,0x40,0x09,0x05,0x97,0x79,
+0x36,0x00,0x61,0x84,0x38,0x09,0x85,0x49,0x8b,0x66,0x00,0xf2,0x0a,0x03,0x04,0x30,
+0x06,0x05,0xa8,0x8a,0x05,0x40,0x08,0x02,0x78,0x85,0x20,0x30,0x67,0x09,0x08,0x08,
+0x90,0x93,0xa0,0x89,0x08,0x4a,0x5f,0x03,0x19,0x8b,0x5f,0x03,0xf1,0x09,0x60,0x11,
+0x66,0x18,0x03,0x49,0x71,0x88,0xa9,0xb7,0x17,0x89,0x29,0x71,0x00,0x00,0x22,0x00,
+0x07,0x87,0xc0,0x00,0x88,0x8b,0xc9,0x00,0x30,0x78,0x88,0x10,0xac,0x00,0x40,0x09,
+0x8b,0x88,0x88,0x7f,0x03,0x2a,0x58,0x84,0xac,0x00,0xe8,0x06,0x07,0x88,0x88,0x6b,
+0x80,0x08,0x4a,0x77,0x77,0x3a,0x00,0x00,0x04,0xac,0x00,0x50,0x03,0x00,0x12,0x00,
+0x90,0xdb,0x06,0x50,0x96,0x00,0x80,0x03,0x60,0x91,0x0c,0x02,0xc9,0x07,0x01,0x7b,
+0x05,0xf2,0x02,0x70,0x00,0x80,0x07,0x88,0x88,0x00,0x78,0x88,0x70,0x00,0x08,0x00,
+0x06,0x88,0x88,0x85,0xbb,0x06,0x03,0xb5,0x0a,0x80,0x10,0x06,0x00,0x06,0x00,0x88,
+0x88,0x80,0xb6,0x0b,0x30,0x38,0xc8,0x30,0x90,0x07,0x14,0x30,0xbe,0x06,0x12,0x70,
+0x3f,0x00,0x10,0x70,0x3f,0x00,0x62,0x47,0xa7,0x50,0x57,0x7c,0x77,0x08,0x08,0x60,
+0x89,0x00,0x68,0x88,0x80,0x0a,0x22,0x05,0x02,0x62,0x00,0x12,0x71,0xc1,0x03,0x00,
+0x62,0x00,0x10,0x09,0x96,0x07,0xf2,0x06,0x85,0x00,0x06,0x00,0x00,0x02,0xd3,0x00,
+0x04,0x90,0x85,0x00,0x30,0x00,0x20,0x07,0x00,0x07,0x00,0x98,0x88,0x28,0x0c,0x01,
+0x54,0x00,0x17,0x07,0xc4,0x03,0x10,0x01,0xc5,0x0e,0xc0,0x05,0x00,0x78,0x88,0x80,
+0x07,0x21,0x18,0x00,0x26,0x66,0x20,0x08,0x0d,0xa3,0x20,0x80,0x00,0x07,0x14,0x00,
+0x00,0x79,0x88,0x80,0xc1,0x00,0x00,0x5f,0x00,0xc5,0x57,0x77,0x50,0x58,0x77,0x78,
+0x50,0x00,0x90,0x00,0x06,0x89,0x82,0x00,0x14,0x58,0x82,0x00,0x01,0xa5,0x00,0x15,
+0x58,0x23,0x00,0x30,0x08,0x99,0x95,0xe6,0x07,0x12,0x09,0xa5,0x00,0xe0,0x07,0x00,
+0x15,0x00,0x98,0x89,0x60,0x09,0x00,0x26,0x00,0x78,0x89,0x50,0x82,0x00,0x83,0x9b,
+0x8c,0x84,0x02,0x60,0x90,0x00,0x26,0xfb,0x07,0x04,0x40,0x01,0x51,0x95,0x00,0x80,
+0x03,0x50,0x40,0x01,0x00,0x8e,0x01,0x04,0x40,0x01,0x18,0x70,0x7f,0x00,0x09,0x01,
+0x01,0x00,0x7f,0x00,0x20,0x01,0x06,0x2e,0x05,0x40,0x08,0x09,0x88,0x89,0xa8,0x05,
+0x01,0xd5,0x06,0x70,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0xf0,0x47,0x40,0x04,0x07,
+0x80,0x08,0x09,0x87,0x78,0x08,0x80,0x08,0x08,0x47,0x74,0x08,0x03,0x10,0x08,0x06,
+0x30,0x00,0x05,0xa8,0x87,0x00,0x00,0x00,0x60,0x06,0x07,0x88,0x88,0x09,0x80,0x08,
+0x09,0x77,0x77,0x09,0x00,0x00,0x02,0x04,0x88,0x89,0x05,0x88,0x88,0x08,0x10,0x00,
+0x03,0x88,0x76,0x22,0x20,0x17,0x00,0x87,0x82,0x59,0x00,0x99,0x85,0x59,0x00,0x99,
+0x86,0x5a,0x80,0x87,0x82,0x58,0x00,0x9a,0x79,0x48,0x00,0x00,0x00,0x08,0x00,0x00,
+0x00,0x09,0x00,0x01,0x00,0xf1,0x0c,0x41,0x32,0x27,0x00,0x86,0x94,0x49,0x00,0x8b,
+0x9a,0x4b,0x80,0x7b,0x7a,0x39,0x00,0x00,0x00,0x03,0x00,0x05,0x98,0x89,0x00,0x05,
+0x99,0x98,0x26,0x00,0xf2,0x0a,0x04,0x88,0x76,0x00,0x21,0x22,0x26,0x08,0x46,0x77,
+0x80,0x87,0x69,0x78,0x08,0x75,0xa7,0x80,0x84,0x58,0x78,0x08,0x94,0xb7,0x80,0x45,
+0x00,0x11,0x80,0x45,0x00,0xf9,0x07,0x30,0x07,0x00,0x00,0x80,0x09,0x00,0x02,0x80,
+0x09,0x00,0x06,0xb0,0x0b,0x81,0x09,0x45,0x09,0x00,0x63,0x09,0x08,0x68,0x00,0xf3,
+0x08,0x00,0x50,0x07,0x00,0x01,0x70,0x09,0x00,0x07,0x90,0x0c,0x80,0x38,0x46,0x08,
+0x00,0x60,0x03,0x07,0x00,0x06,0x88,0x84,0x20,0x00,0x00,0x04,0x00,0x13,0x02,0x28,
+0x00,0xf2,0x06,0x08,0x00,0x02,0x70,0x08,0x00,0x06,0x70,0x08,0x00,0x19,0x83,0x0c,
+0x80,0x81,0x06,0x08,0x00,0x06,0x00,0x07,0x26,0x00,0xf0,0x28,0x88,0x85,0x00,0x00,
+0x40,0x07,0x00,0x02,0x60,0x09,0x00,0x08,0x90,0x0c,0x80,0x47,0x37,0x08,0x00,0x50,
+0x02,0x05,0x00,0x06,0x00,0x05,0x00,0x09,0x88,0x89,0x00,0x09,0x00,0x08,0x00,0x04,
+0x78,0x83,0x00,0x00,0x04,0x00,0x70,0x00,0x03,0x60,0x08,0x00,0x00,0x88,0x00,0xc8,
+0x00,0x47,0x55,0x42,0x00,0xf0,0x04,0x30,0x80,0x00,0x00,0x78,0x81,0x00,0x00,0x72,
+0x02,0x80,0x00,0x06,0x40,0x47,0x00,0x00,0x05,0x74,0xb9,0x00,0xf0,0x0a,0x50,0x70,
+0x08,0x08,0x08,0x02,0x70,0x80,0x80,0x6a,0x09,0x89,0x09,0x62,0x80,0x86,0x30,0x88,
+0x08,0x00,0x00,0x80,0x80,0x00,0x08,0xba,0x00,0xf1,0x0e,0x10,0x00,0x40,0x61,0x60,
+0x18,0x09,0x18,0x06,0x90,0x98,0x81,0x95,0x58,0x18,0x51,0x04,0x60,0x60,0x08,0x88,
+0x83,0x00,0x00,0x03,0x60,0x00,0x00,0x36,0x20,0x00,0x00,0x21,0x01,0xf1,0x0d,0x06,
 0x17,0x01,0x80,0x91,0x80,0x59,0x09,0x88,0x19,0x55,0x81,0x85,0x10,0x45,0x05,0x00,
-0x88,0x89,0x40,0x20,0x02,0x41,0xa7,0x79,0x50,0x00,0x63,0x00,0xf1,0x07,0x60,0x18,
-0x09,0x09,0x05,0x90,0xa8,0x91,0x96,0x49,0x09,0x51,0x04,0x60,0x80,0x01,0x78,0x60,
-0x00,0x91,0x05,0x50,0x36,0x18,0x11,0x74,0xd0,0x00,0xe0,0x01,0x70,0x0c,0x80,0x07,
-0xa0,0x09,0x00,0x38,0x28,0x0c,0x70,0x50,0x02,0x19,0x06,0xb0,0x05,0x00,0x00,0x5c,
-0x30,0x00,0x05,0x80,0x84,0x00,0x02,0x18,0x01,0xe1,0x30,0x06,0x00,0x90,0x08,0x02,
-0x80,0x29,0x06,0xb2,0x6b,0x09,0x45,0x09,0x5b,0x01,0x04,0xda,0x11,0x10,0x50,0xa6,
-0x08,0xa7,0x03,0xc1,0x8b,0x09,0x28,0x08,0x51,0x02,0x17,0x03,0xb7,0x17,0x30,0x00,
-0x50,0x07,0xac,0x11,0xe7,0x01,0xd2,0x8c,0x00,0x92,0x90,0x90,0x43,0x02,0x39,0x00,
-0x05,0x00,0x80,0x75,0x18,0x00,0x20,0x00,0xb0,0x09,0x02,0xa0,0x04,0xb4,0x5b,0x02,
-0x90,0x81,0x80,0x20,0x12,0x19,0x71,0x89,0xc0,0x00,0x99,0x9b,0x00,0x18,0x80,0x10,
-0x00,0x9a,0x00,0x00,0xa4,0x11,0x21,0x01,0xd1,0x40,0x00,0xf0,0x02,0x33,0x01,0x28,
-0x00,0x03,0x88,0x40,0x00,0xa0,0x0a,0x00,0x0a,0x11,0xa0,0x00,0x17,0x61,0x96,0x00,
-0xf2,0x06,0x70,0x00,0x90,0x08,0x90,0x00,0x90,0x18,0x90,0x00,0xd4,0x69,0x80,0x05,
-0x58,0x08,0x80,0x08,0x07,0x18,0x80,0xa1,0x04,0x02,0xa5,0x04,0x02,0x41,0x01,0xb6,
-0x17,0x05,0xa5,0xc1,0x71,0x95,0x58,0x17,0x51,0x04,0x61,0x41,0x01,0x02,0x35,0x11,
-0x23,0x50,0x71,0x20,0x00,0xb2,0x70,0xa6,0x48,0x17,0x52,0x05,0x81,0x70,0x06,0x06,
-0x16,0xa4,0x00,0x12,0x83,0xa4,0x00,0x10,0x60,0x20,0x00,0xe2,0x06,0xa5,0xc0,0x71,
-0x93,0x68,0x07,0x50,0x02,0x41,0x40,0x07,0x88,0x96,0x61,0x01,0x01,0x32,0x11,0x01,
-0x60,0x11,0x02,0x40,0x00,0x11,0xa5,0x60,0x00,0xf0,0x02,0x70,0x00,0x17,0x01,0x00,
-0x08,0xa1,0x00,0x08,0x61,0x92,0x00,0x20,0x00,0x10,0x00,0x60,0x17,0x16,0xbb,0xc0,
-0x02,0xd0,0x09,0x00,0x92,0x98,0xc0,0x52,0x02,0x29,0x04,0x01,0x00,0x94,0x1d,0x00,
-0xc5,0x07,0x60,0x6b,0x40,0x00,0x48,0x08,0x50,0x07,0x3a,0x03,0x6e,0x08,0x00,0x42,
-0x01,0x61,0x06,0xb3,0x00,0x08,0x62,0x76,0x01,0x05,0x1c,0x89,0x6e,0x08,0x00,0x7d,
-0x01,0xc8,0x04,0xd2,0x00,0x05,0x81,0x94,0x00,0x30,0x80,0x20,0x68,0x8c,0x19,0x10,
-0x01,0x3c,0x00,0x12,0xb4,0x3c,0x00,0x11,0x90,0x35,0x10,0x37,0x07,0x88,0x10,0x8e,
-0x11,0x02,0x59,0x01,0xb1,0x80,0x01,0xd3,0x08,0x00,0x91,0x91,0x80,0x31,0x50,0x28,
-0x8e,0x11,0x16,0xa8,0x8e,0x11,0x00,0x88,0x0f,0x9e,0xc0,0x00,0x00,0x87,0x80,0x00,
-0x84,0x03,0x80,0x7d,0x0f,0x22,0x00,0x00,0x0b,0x00,0x90,0x5c,0x20,0x00,0x77,0x08,
-0x50,0x01,0x00,0x01,0x29,0x05,0x10,0x05,0xc3,0x17,0x30,0x30,0x00,0x09,0x01,0x02,
-0x12,0x01,0xd5,0x00,0x52,0x98,0x60,0x00,0x83,0x04,0x7b,0x16,0x11,0x80,0xb4,0x14,
-0x68,0x05,0xb5,0x00,0x07,0x60,0x57,0xf8,0x00,0x60,0x4c,0x20,0x00,0x29,0x09,0x20,
-0x40,0x03,0x03,0x82,0x0c,0x22,0x00,0x00,0x19,0x00,0x11,0x89,0x3c,0x00,0x23,0x57,
-0x77,0xa8,0x05,0x32,0x79,0x00,0x58,0xc5,0x0d,0x00,0xa8,0x05,0x12,0x08,0x1b,0x01,
-0x20,0x60,0x76,0x01,0x03,0x1b,0x58,0x80,0x19,0x11,0x84,0x1b,0x01,0xd0,0x07,0xb3,
-0x00,0x08,0x50,0x75,0x00,0x10,0x00,0x10,0x67,0x88,0x87,0x8d,0x12,0x62,0x07,0x20,
-0x27,0x00,0x74,0x04,0x80,0x19,0x20,0x30,0x07,0x2d,0x10,0xb1,0xa0,0x08,0x04,0xc1,
-0x08,0x09,0x28,0x09,0x45,0x07,0x19,0x3a,0x01,0x07,0xce,0x02,0x89,0xc0,0x09,0x19,
-0x28,0x09,0x51,0x02,0x18,0xce,0x02,0x00,0x08,0x01,0x02,0xc1,0x09,0xc2,0x0d,0x10,
-0x90,0x08,0x39,0x09,0x04,0x40,0x23,0x90,0x00,0x50,0x19,0x04,0x23,0xc8,0x88,0xd1,
-0x02,0xf2,0x04,0x02,0x70,0x09,0x08,0xa0,0x09,0x65,0x18,0x09,0x30,0x00,0x04,0x04,
-0x98,0x99,0x05,0x99,0x98,0x09,0x2c,0x0e,0x02,0xcc,0x02,0xe0,0x00,0xd1,0x08,0x00,
-0x92,0x90,0x80,0x33,0x01,0x26,0x00,0x09,0x88,0xa0,0x86,0x00,0x03,0x61,0x1b,0x23,
-0x00,0x50,0xec,0x02,0x10,0x09,0xec,0x02,0x14,0x42,0xec,0x02,0x11,0x09,0xec,0x02,
-0x70,0x16,0x61,0x00,0x03,0x03,0x07,0x00,0xe4,0x16,0xf9,0x00,0x0a,0x0a,0x09,0x00,
-0x1d,0x1d,0x0b,0x81,0x5a,0x79,0x28,0x00,0x92,0xb1,0x68,0x30,0x09,0xf4,0x02,0x00,
-0x30,0x30,0x00,0x09,0x0a,0x00,0x05,0xb0,0xd3,0x00,0x95,0xa4,0x80,0x21,0x04,0x02,
-0x33,0x12,0x00,0x3b,0x3d,0x62,0x48,0x92,0x09,0x00,0x80,0x17,0x2a,0x0c,0x6a,0x80,
-0x26,0x09,0x00,0x28,0x80,0x1f,0x05,0x62,0x06,0x60,0x07,0x00,0x64,0x36,0x20,0x00,
-0x40,0x64,0x26,0x08,0x00,0x11,0x1d,0x0c,0x1f,0x05,0x06,0x24,0x00,0xb7,0x0a,0x20,
-0x63,0x17,0x0b,0x50,0x07,0x70,0x08,0x00,0x04,0x1b,0x05,0x00,0x21,0x1d,0x23,0x63,
-0x27,0x44,0x00,0x10,0x36,0x44,0x00,0xb3,0x45,0x00,0x06,0x05,0x99,0x10,0x09,0x02,
-0x86,0x00,0x0a,0xb2,0x0c,0x80,0x07,0x81,0x08,0x00,0x72,0x18,0x09,0x10,0x8a,0x0c,
-0x22,0x29,0x93,0x58,0x00,0x00,0x86,0x06,0x11,0x06,0x7b,0x15,0x02,0x2c,0x01,0x53,
-0x07,0x70,0x07,0x00,0x72,0xac,0x00,0x71,0x56,0x46,0x08,0x00,0x04,0x40,0x06,0x5e,
-0x0b,0x10,0x09,0x02,0x00,0x2b,0x77,0x78,0xb0,0x00,0x13,0x0d,0xb0,0x00,0x02,0x87,
-0x05,0x22,0x0a,0x98,0xc3,0x15,0x00,0x23,0x0f,0x0a,0x48,0x00,0x40,0x09,0x00,0x04,
-0x40,0xad,0x09,0x20,0x81,0x00,0x8c,0x1b,0x04,0x99,0x1d,0x02,0x24,0x00,0x17,0x08,
-0x6c,0x00,0x52,0x05,0x00,0x06,0x98,0x94,0xdc,0x1a,0x25,0xc8,0xc6,0x71,0x20,0xf1,
-0x05,0x75,0x06,0x61,0x62,0x63,0x96,0x28,0x03,0x5a,0xb2,0x54,0x72,0x96,0x20,0x53,
-0x05,0x41,0x00,0x98,0x8a,0x39,0x13,0x11,0xb7,0xbe,0x16,0x06,0x63,0x01,0x02,0xac,
-0x0a,0x4c,0x80,0x26,0x0c,0x80,0x63,0x01,0x02,0x6b,0x00,0x02,0x20,0x00,0x50,0x56,
-0x46,0x0c,0x70,0x04,0x77,0x15,0xa0,0x78,0x71,0x00,0x05,0x40,0x18,0x00,0x05,0x50,
-0x28,0x8f,0x00,0x00,0xd9,0x00,0x40,0x29,0x83,0x08,0x71,0x86,0x07,0x65,0x7b,0x62,
-0x08,0x08,0x08,0x81,0x6a,0x05,0x00,0x3f,0x00,0xa1,0x06,0x32,0x70,0x90,0x80,0x08,
-0x8b,0x06,0x42,0x60,0xb1,0x1e,0x83,0x12,0x00,0x80,0x04,0x50,0x00,0x00,0x3b,0xc4,
-0x1d,0x40,0x81,0x07,0x07,0x21,0x73,0x0b,0x50,0x5b,0x02,0x99,0x30,0x90,0x62,0x03,
-0xd0,0x38,0x88,0xa0,0x03,0x98,0x89,0x00,0x63,0x00,0x00,0x02,0x88,0x77,0x7a,0x01,
-0x61,0x72,0x18,0x19,0x80,0x08,0x4a,0x77,0x01,0x71,0x05,0x04,0x20,0x05,0x06,0xa8,
-0x8a,0x12,0x0f,0xb1,0x85,0x07,0x81,0x08,0x07,0x21,0x81,0xa0,0x80,0x08,0x4c,0x3b,
-0x00,0x00,0x1d,0x1e,0xf1,0x0b,0x60,0x60,0x08,0x9c,0x2a,0x00,0x80,0x88,0x65,0x03,
-0x76,0x30,0x10,0x19,0x92,0x07,0x07,0x10,0xa0,0x90,0x81,0x0a,0x7a,0x02,0x99,0x40,
-0x28,0x19,0x01,0x28,0x3c,0x53,0xa4,0x00,0x82,0xb3,0x72,0x35,0x07,0xf0,0x0a,0x62,
-0x99,0x28,0x17,0x71,0x17,0x81,0x78,0x00,0xcc,0x17,0x62,0x25,0x81,0x70,0x88,0x08,
-0x17,0x00,0x00,0x81,0x70,0x00,0x07,0x18,0x66,0x05,0xf2,0x0a,0x18,0x80,0x62,0x47,
-0x13,0x59,0x25,0x80,0x2a,0xc2,0x53,0x99,0x18,0x25,0x00,0x00,0x11,0x10,0x07,0x88,
-0xa4,0x00,0x88,0x8a,0x30,0x2b,0x0a,0x11,0x30,0xf6,0x00,0xb7,0x18,0x70,0x09,0x7a,
-0x80,0x08,0x08,0x71,0x18,0x8b,0x18,0xf6,0x00,0xf8,0x00,0x05,0x60,0x07,0x55,0x36,
-0x6b,0x80,0x08,0x09,0x55,0x36,0x8b,0x05,0x60,0x08,0x92,0x03,0xe0,0x06,0x60,0x07,
-0x06,0x43,0x67,0xc0,0x80,0x08,0x09,0x06,0x32,0x78,0xb0,0x8d,0x02,0x30,0x21,0x00,
-0x80,0x14,0x1c,0x26,0x59,0x78,0x11,0x01,0x9d,0x87,0xb0,0x80,0x08,0x29,0x02,0x99,
-0x35,0xa0,0x11,0x01,0x00,0x51,0x01,0xf5,0x02,0x63,0x27,0x7b,0x80,0x08,0x09,0x46,
-0x56,0x8b,0x03,0x30,0x06,0x00,0x78,0x83,0x03,0x60,0xe8,0x0f,0x02,0xd1,0x00,0xc0,
-0x1b,0xa1,0x78,0x00,0x88,0x17,0x62,0x2b,0xb1,0x70,0x89,0x08,0x63,0x08,0x14,0x70,
-0x98,0x07,0x90,0x47,0x40,0x00,0x47,0x06,0x40,0x07,0x20,0x17,0x07,0x00,0x35,0x00,
-0x48,0x40,0xb7,0x05,0x93,0x88,0x70,0x00,0x72,0x03,0x50,0x03,0x98,0x92,0x12,0x00,
-0x00,0x83,0x0a,0x20,0x07,0x20,0x01,0x0a,0xe1,0x70,0x02,0x87,0x82,0x00,0x72,0x01,
-0x80,0x01,0x89,0x81,0x05,0x77,0xc7,0xb0,0x15,0x64,0x48,0x87,0xa0,0x06,0x88,0x89,
-0x66,0x1c,0x31,0x01,0x87,0x80,0x3c,0x00,0x24,0x97,0x92,0x45,0x17,0x37,0x40,0x00,
-0x30,0xd8,0x04,0x22,0x02,0x72,0x19,0x3e,0x30,0x08,0x08,0x08,0x08,0x00,0x50,0x62,
-0x02,0x81,0x08,0x31,0xf3,0x14,0x35,0x48,0x98,0x58,0x04,0x04,0x10,0x04,0xbc,0x10,
-0x00,0x28,0x04,0xf1,0x0b,0x2a,0x09,0x00,0x03,0xc3,0x09,0x82,0x48,0xb8,0x59,0x00,
-0x01,0x10,0x08,0x00,0x04,0x30,0x00,0x00,0x04,0xa8,0x88,0x00,0x02,0x72,0x07,0xd2,
-0x0d,0x92,0x08,0x08,0x00,0xa0,0x90,0x80,0x02,0x82,0x08,0xfb,0x05,0x14,0x78,0xfb,
-0x05,0x10,0x04,0x75,0x10,0xf0,0x01,0x80,0x90,0x09,0x29,0x08,0x00,0x1a,0x10,0x80,
-0x58,0xb8,0x58,0x00,0x11,0x00,0x70,0x3d,0x00,0x30,0x4a,0x88,0x70,0xf5,0x00,0x13,
-0x46,0xf5,0x00,0x50,0x07,0x30,0x00,0x57,0x50,0x06,0x02,0x44,0x68,0xc8,0xc8,0x60,
-0xb9,0x00,0x20,0xb8,0xb2,0x0c,0x15,0xfe,0x11,0x68,0x98,0x98,0x60,0x05,0x75,0x00,
-0x07,0x40,0x56,0x00,0x73,0x04,0x60,0x00,0x67,0x50,0x00,0x00,0x78,0x70,0x00,0x72,
-0x02,0x60,0x07,0x10,0x17,0x00,0x18,0x88,0x10,0xfa,0x0e,0x00,0x35,0x01,0x91,0x63,
-0x04,0x50,0x04,0x73,0x83,0x00,0x02,0x42,0x35,0x01,0x51,0x50,0x90,0x00,0x09,0x03,
-0xf0,0x1d,0x13,0x01,0x35,0x01,0xe6,0x87,0x82,0x05,0x77,0x77,0x76,0x00,0x19,0x10,
-0x00,0x58,0x77,0xb0,0x06,0x76,0x12,0xe0,0x00,0x77,0x71,0x00,0x63,0x01,0x70,0x04,
-0x85,0x85,0x00,0x01,0x31,0x00,0x08,0x07,0x32,0x58,0xc8,0x60,0xeb,0x12,0x11,0xa0,
-0xf2,0x22,0x90,0x87,0x81,0x00,0x62,0x02,0x60,0x02,0x87,0x82,0x30,0x0c,0x00,0x26,
-0x01,0x00,0x96,0x0f,0x66,0x5b,0x50,0x00,0x76,0x05,0x70,0xf1,0x00,0x20,0x80,0x08,
-0xcb,0x00,0xc2,0x60,0x80,0x24,0x45,0x68,0x02,0x4a,0x31,0x80,0x00,0x81,0x8c,0xfa,
-0x17,0x51,0x01,0x00,0x03,0x83,0x06,0x31,0x01,0xf0,0x08,0x19,0x08,0x00,0x27,0x21,
-0x80,0x58,0xb7,0x48,0x00,0x06,0x18,0xc0,0x04,0x40,0x03,0x00,0x3a,0x88,0x80,0x06,
-0x86,0x07,0xe4,0x0e,0x61,0x05,0x85,0x08,0x06,0x8a,0x85,0x35,0x00,0xf2,0x19,0x18,
-0x88,0x90,0x00,0x55,0x5b,0x00,0x38,0x44,0x30,0x01,0x88,0x88,0x10,0x06,0x81,0x50,
-0x73,0x50,0x88,0x18,0x43,0x08,0x81,0x80,0x88,0x27,0x18,0x35,0x67,0x81,0x81,0x47,
-0x18,0x18,0x02,0x65,0xb1,0x80,0x25,0x17,0x03,0x21,0x03,0x84,0x8d,0x01,0x10,0x08,
-0xfc,0x0e,0x90,0x70,0x80,0x00,0x01,0x28,0x04,0x8c,0x74,0x80,0xd2,0x01,0x03,0x7c,
-0x00,0x00,0x59,0x0e,0xa7,0x72,0x04,0x50,0x07,0x10,0x36,0x00,0x18,0x88,0x00,0x76,
-0x18,0x20,0x18,0x08,0x76,0x18,0x00,0xdc,0x00,0x00,0x78,0x01,0x31,0x01,0x87,0x81,
-0x01,0x18,0x60,0x91,0x90,0x00,0x58,0x77,0x90,0x49,0x05,0x13,0x90,0xfa,0x11,0x60,
-0x57,0x30,0x00,0x55,0x08,0x20,0x46,0x19,0x65,0x55,0x07,0x20,0x00,0x58,0x30,0x11,
-0x06,0xc0,0x88,0x80,0x00,0x73,0x02,0x70,0x04,0x83,0x75,0x00,0x02,0x42,0x42,0x07,
-0x25,0x70,0x40,0x3d,0x08,0x06,0x71,0x01,0x40,0x04,0x87,0x77,0x86,0xa6,0x02,0x33,
-0x37,0x77,0xa0,0x71,0x01,0x16,0x05,0xa6,0x02,0x73,0x02,0x97,0x92,0x00,0x11,0x11,
-0x10,0x07,0x11,0x07,0x5c,0x14,0x07,0xc6,0x02,0x30,0x11,0x11,0x11,0xc1,0x07,0x00,
-0x7e,0x07,0x40,0x30,0x27,0x00,0x65,0x7e,0x07,0x14,0x50,0x82,0x02,0x00,0xf5,0x00,
-0x50,0x91,0x90,0x80,0x02,0x72,0x61,0x40,0x46,0x80,0x48,0x77,0x48,0x0b,0x1a,0xa0,
-0x07,0x19,0x84,0x08,0x71,0x09,0x08,0x80,0x09,0x08,0x02,0x05,0x16,0x92,0x0c,0x04,
-0x50,0x06,0x60,0x06,0x64,0x37,0x6a,0x0c,0x59,0x64,0x27,0x09,0x06,0x60,0xc6,0x10,
-0x01,0xcc,0x03,0xf2,0x00,0x09,0x80,0x08,0x08,0x64,0x26,0x08,0x06,0x60,0x08,0x02,
-0x20,0x08,0x05,0x40,0xa0,0x0c,0x00,0x07,0x04,0x11,0x72,0x78,0x12,0x32,0x29,0x93,
-0x08,0x6d,0x0e,0x41,0x04,0x88,0x88,0x07,0xa0,0x0c,0x00,0x13,0x05,0x01,0x17,0x11,
-0x30,0x29,0x95,0x08,0xd8,0x41,0xa0,0x78,0x7a,0x06,0x87,0x08,0x09,0x00,0x09,0x05,
-0x86,0x51,0x00,0x20,0x72,0x17,0x6c,0x00,0xd1,0x56,0x46,0x08,0x04,0x40,0x06,0x04,
-0x88,0x87,0x07,0x10,0x09,0x06,0x5b,0x14,0x01,0x51,0x00,0x14,0x09,0x51,0x00,0xa2,
-0x05,0x05,0x10,0x05,0x07,0x98,0x8a,0x07,0x10,0x09,0xb8,0x1f,0xe0,0x01,0x88,0x10,
-0x90,0x71,0x07,0x09,0x08,0x10,0x70,0x90,0x29,0x82,0x09,0x96,0x07,0x00,0x44,0x19,
-0x73,0x1d,0x2c,0x30,0x09,0x1b,0x18,0x10,0x4d,0x06,0x01,0x4b,0x11,0x01,0xde,0x24,
-0xf6,0x01,0x09,0x00,0x01,0xb0,0x0c,0x80,0x08,0x83,0x08,0x00,0x36,0x09,0x08,0x00,
-0x20,0x01,0x2e,0x06,0x20,0x37,0x73,0xbb,0x43,0x02,0x20,0x00,0x6e,0x0a,0x65,0x09,
-0x00,0x62,0x05,0x91,0x07,0x05,0x4c,0x00,0xe1,0x64,0x08,0x00,0x00,0xb0,0x08,0x00,
-0x09,0x92,0x0c,0x80,0x72,0x08,0x08,0xf0,0x1c,0x04,0x0a,0x25,0x01,0x9e,0x24,0xf7,
-0x05,0x82,0x09,0x00,0x04,0xc0,0x0c,0x81,0x47,0x28,0x09,0x00,0x20,0x02,0x04,0x00,
-0x04,0x88,0x89,0x00,0x05,0x71,0x07,0x20,0x58,0x82,0x1f,0x43,0xd1,0x09,0x00,0x03,
-0xa0,0x0c,0x80,0x19,0x83,0x08,0x00,0x70,0x04,0x08,0x59,0x03,0x00,0x29,0x07,0x22,
-0x07,0x40,0x9a,0x06,0x70,0x03,0x40,0x60,0x71,0x4a,0x18,0x08,0x2d,0x03,0xc5,0x29,
-0x0a,0x88,0x09,0x90,0x80,0x83,0x63,0x68,0x08,0x20,0x02,0xab,0x0c,0xf1,0x00,0x25,
-0x61,0x61,0x60,0x1a,0x19,0x17,0x03,0xa0,0x99,0x71,0xa6,0x48,0x17,0x61,0x6a,0x0b,
-0x00,0x9f,0x1c,0x13,0x50,0x6a,0x0b,0xf0,0x05,0x14,0x52,0x05,0x13,0x57,0x08,0x00,
-0x72,0x08,0x00,0xc2,0x8b,0x06,0x84,0x08,0x18,0x09,0x08,0x20,0x02,0xa9,0x09,0x00,
-0x24,0x21,0xf6,0x02,0x74,0x07,0x00,0x46,0x09,0x00,0xb0,0x8c,0x08,0x76,0x09,0x52,
-0x06,0x08,0x03,0x78,0x86,0xe4,0x05,0xf9,0x03,0x65,0x07,0x00,0x12,0x80,0x80,0x00,
-0x91,0x6c,0x00,0x68,0x70,0x80,0x46,0x06,0x18,0x00,0x04,0x40,0x0b,0xf3,0x04,0x47,
-0x83,0x07,0x00,0x82,0x09,0x03,0xc1,0x8a,0x39,0x47,0x09,0x40,0x14,0x15,0x04,0x77,
-0x7a,0x06,0x73,0x09,0x12,0x76,0xc3,0x1a,0xf3,0x07,0x80,0x00,0x17,0x08,0x00,0x0b,
-0x17,0xc0,0x08,0x59,0x08,0x03,0x40,0x32,0x60,0x00,0x98,0x89,0x00,0x18,0x00,0x90,
-0xb6,0x07,0x00,0x83,0x15,0xc7,0x64,0x08,0x02,0xd0,0x8a,0x2a,0x47,0x08,0x50,0x03,
-0x06,0x05,0x82,0x21,0x20,0x07,0x86,0x17,0x0d,0xb4,0x80,0x00,0xa1,0x7c,0x00,0x66,
-0x90,0x80,0x34,0x03,0x18,0x7d,0x0c,0x00,0xfb,0x1f,0xf1,0x10,0x27,0x72,0x00,0x04,
-0x40,0x51,0x51,0x4a,0x08,0x16,0x00,0x90,0x81,0x60,0x29,0x6c,0x16,0x09,0x90,0x81,
-0x63,0x72,0x68,0x16,0x20,0x02,0x81,0x60,0x00,0x07,0x16,0xbf,0x01,0x71,0x81,0x71,
-0x60,0x09,0x08,0x27,0x04,0x79,0x0c,0x50,0x27,0x50,0x04,0x62,0x70,0x40,0x29,0x00,
-0x19,0x0c,0x11,0x51,0x19,0x0c,0x31,0x14,0x52,0x06,0x0f,0x01,0x74,0x8b,0x00,0xc0,
-0x08,0x06,0x85,0x8b,0x0f,0x01,0x01,0x9e,0x12,0xe6,0x77,0x71,0x00,0x00,0x1b,0x00,
-0x00,0x1d,0x40,0x00,0x5a,0x29,0x50,0x03,0x14,0x0c,0xa3,0x04,0x77,0x91,0x00,0x01,
-0xa6,0x00,0x08,0x85,0x95,0xd8,0x0b,0x11,0x40,0xdd,0x1f,0x05,0x14,0x0c,0xe3,0x03,
-0x87,0x82,0x00,0x00,0x79,0x00,0x05,0x95,0x95,0x00,0x20,0x80,0x10,0x7d,0x06,0x03,
-0xd7,0x03,0xa7,0x03,0x77,0x92,0x00,0x01,0x98,0x00,0x07,0x95,0x96,0xa2,0x1d,0x01,
-0x15,0x0b,0x02,0x95,0x24,0x80,0x17,0x75,0x07,0x00,0x00,0x47,0x08,0x00,0xa2,0x0a,
-0x80,0x1a,0x39,0x0b,0x81,0x31,0x42,0x18,0x00,0xa0,0x0a,0x26,0x68,0xa8,0x5d,0x06,
-0x00,0xc6,0x1c,0x9e,0x00,0x39,0x00,0x00,0x5c,0x60,0x00,0x84,0x04,0x95,0x1b,0x09,
-0x80,0x00,0x21,0x00,0x10,0xc8,0x05,0x11,0x80,0xc8,0x05,0x00,0x80,0x00,0x20,0x87,
-0x92,0x0e,0x0f,0x30,0x06,0x95,0x95,0x95,0x0b,0x00,0x9c,0x11,0x92,0x05,0xc6,0x00,
-0x06,0x61,0x47,0x00,0x55,0x03,0x8d,0x1c,0x03,0xdc,0x00,0x20,0x83,0x95,0x57,0x04,
-0x3b,0x57,0x77,0x77,0xdc,0x00,0xa1,0x04,0x88,0xb4,0x00,0x04,0xb8,0x00,0x18,0x40,
-0x57,0xc8,0x05,0x01,0xb1,0x10,0x17,0x90,0x02,0x15,0x01,0x60,0x00,0x53,0x98,0x00,
-0x07,0x93,0x96,0x40,0x00,0x0b,0xf5,0x0b,0x00,0x70,0x01,0xf3,0x01,0x56,0x09,0x00,
-0x71,0x09,0x00,0xc0,0x09,0x07,0x84,0x09,0x27,0x09,0x09,0x20,0x01,0xf5,0x0b,0x00,
-0x7f,0x02,0x10,0x55,0x18,0x00,0x70,0x0a,0x57,0x09,0x51,0x04,0x08,0x03,0x4c,0x1d,
-0x0b,0x7f,0x02,0x40,0xa2,0x08,0x00,0x76,0x06,0x02,0x16,0x28,0x7f,0x02,0x13,0x81,
-0xcc,0x03,0x30,0x48,0x82,0x08,0x82,0x02,0xf1,0x02,0xb0,0x09,0x39,0x55,0x09,0x50,
-0x03,0x07,0x05,0x88,0x86,0x08,0x00,0x09,0x08,0x87,0x78,0x1b,0x00,0x12,0x06,0x1b,
-0x00,0x50,0x2a,0x64,0x09,0x60,0x04,0xe1,0x23,0x13,0x09,0x5f,0x02,0x11,0x83,0xc1,
-0x00,0x61,0x48,0x19,0x00,0x08,0x07,0x19,0xe1,0x23,0xf7,0x00,0x0b,0x0b,0x0a,0x81,
-0x4c,0x5c,0x28,0x00,0x92,0xd2,0x78,0x00,0x20,0x20,0x28,0x41,0x1d,0xf0,0x0b,0x52,
-0x41,0xa2,0x88,0x25,0x09,0x07,0x82,0x50,0xa3,0x78,0x95,0x4c,0x79,0x82,0x58,0x4a,
-0x79,0x25,0x20,0x20,0x92,0x50,0x00,0x08,0x25,0x20,0x00,0xf0,0x04,0x36,0x53,0x62,
-0x41,0x93,0x78,0x35,0x0a,0x56,0x89,0x54,0xa9,0x88,0x35,0x51,0x43,0x72,0x40,0x08,
-0x9a,0x00,0x50,0x05,0x40,0x00,0x00,0x53,0x37,0x01,0xa4,0x07,0xa4,0x85,0x00,0x1b,
-0x0a,0x10,0x09,0x6a,0x58,0x0b,0x0e,0x0a,0x47,0x0e,0x21,0x37,0x47,0x8e,0x05,0xba,
-0x0d,0x1d,0x08,0x05,0x7b,0x64,0x80,0x40,0x40,0x27,0x00,0x8c,0x14,0x00,0xb4,0x0a,
-0x40,0x48,0x84,0x09,0x00,0x21,0x01,0xea,0x00,0xb0,0x0c,0x80,0x06,0xb1,0x08,0x00,
-0x37,0x19,0x08,0x00,0x20,0x02,0xd8,0x0a,0xf1,0x00,0x38,0x95,0x09,0x00,0x00,0xa1,
-0x0c,0x80,0x09,0x85,0x08,0x00,0x52,0x04,0x06,0x54,0x1a,0x08,0x48,0x29,0x01,0x24,
-0x00,0x00,0x65,0x05,0x12,0xa0,0x24,0x00,0xf0,0x1d,0x62,0x04,0x06,0x00,0x00,0x70,
-0x70,0x00,0x02,0xb0,0xc1,0x00,0x09,0x4b,0x49,0x10,0x01,0x01,0x00,0x00,0x17,0x60,
-0x16,0x00,0x58,0xa3,0x17,0x00,0x01,0xa0,0x1c,0x80,0x1a,0x93,0x17,0x00,0x61,0x04,
-0x14,0x00,0x05,0x88,0xa2,0x00,0x94,0x2e,0x31,0x04,0x96,0x93,0xa5,0x18,0xa0,0x07,
-0x60,0x60,0x72,0x88,0x18,0x08,0x00,0x81,0x90,0x24,0x29,0x95,0x06,0xb0,0x80,0x82,
-0x83,0x58,0x08,0x30,0x03,0x86,0x04,0x50,0x07,0x70,0x07,0x03,0x88,0xb1,0x01,0xf0,
-0x05,0x8c,0x00,0x97,0x70,0x80,0x52,0x04,0x09,0x00,0x00,0x61,0x30,0x00,0x1b,0x70,
-0x00,0x2a,0x14,0x90,0x01,0xa5,0x17,0xde,0x71,0x07,0x01,0x88,0x90,0x80,0x00,0x74,
-0x7c,0x00,0x68,0x80,0x80,0xd7,0x03,0xf4,0x09,0x07,0x50,0x52,0x42,0x88,0x18,0x35,
-0x00,0x81,0x83,0x50,0x0a,0x6b,0x35,0x07,0xb0,0x83,0x52,0x83,0x58,0x35,0x30,0x03,
-0x83,0x70,0x01,0x70,0x00,0x77,0x30,0x00,0x48,0x88,0x00,0x5b,0x30,0x65,0x06,0xc6,
-0x00,0x08,0x32,0x46,0x1e,0x18,0x03,0x59,0x00,0xb9,0x75,0x08,0x00,0x68,0x90,0x80,
-0x25,0x33,0x38,0x00,0x09,0x54,0x0f,0x00,0xab,0x0e,0xc1,0x04,0x62,0x00,0x04,0x88,
-0xe1,0x00,0x01,0xb6,0x00,0x08,0x72,0x98,0x19,0x01,0x33,0x1c,0x04,0xbe,0x14,0x02,
-0x37,0x0f,0xf0,0x0b,0x05,0x72,0x00,0x00,0x57,0x9e,0x10,0x00,0x28,0xb7,0x00,0x01,
-0x61,0x03,0x50,0x07,0x87,0xc8,0x83,0x00,0x58,0xc8,0x40,0x00,0x00,0x01,0x13,0x08,
-0x05,0x4b,0x00,0xf7,0x03,0x03,0x73,0x00,0x04,0x88,0xe3,0x00,0x05,0xc7,0x00,0x07,
-0x30,0x47,0x06,0x88,0x98,0x85,0x02,0x7f,0x0f,0x02,0x20,0x00,0xf1,0x09,0x03,0x79,
-0xe3,0x00,0x38,0xa9,0x30,0x15,0x11,0x14,0x14,0x66,0xb6,0x53,0x05,0x8a,0x87,0x00,
-0x36,0x66,0x90,0x0a,0x22,0x31,0xea,0x13,0x03,0x23,0x00,0x91,0x78,0xe3,0x00,0x16,
-0xb9,0x00,0x07,0x20,0x26,0x92,0x09,0x91,0x5c,0x50,0x00,0x64,0x04,0x70,0x06,0x40,
-0x56,0x9c,0x12,0x00,0xc5,0x04,0xf2,0x03,0x30,0x70,0x07,0x7b,0x08,0x00,0x19,0x90,
-0x80,0x17,0x14,0x38,0x05,0x88,0x98,0x80,0x00,0x91,0x2e,0x20,0x10,0x60,0x9f,0x3f,
-0x01,0xad,0x00,0x30,0x05,0x79,0xe1,0xac,0x00,0x81,0x16,0x10,0x35,0x05,0x77,0x77,
-0x73,0x06,0x29,0x27,0x03,0xda,0x27,0x91,0x00,0x06,0x72,0x06,0x27,0x86,0x08,0x00,
-0x19,0x17,0x27,0x83,0xc4,0x08,0x19,0x09,0x08,0x30,0x01,0x18,0xd7,0x0b,0x00,0x2f,
-0x01,0x23,0xa0,0x90,0x2f,0x01,0x00,0x59,0x03,0x0a,0x88,0x01,0x01,0x7e,0x00,0x12,
-0x76,0xc1,0x1f,0x00,0xb8,0x03,0x80,0x35,0xc1,0x0b,0x81,0x04,0x60,0x08,0x00,0xab,
-0x10,0x17,0x20,0x54,0x0d,0xf6,0x07,0x14,0x42,0x50,0x71,0x46,0x68,0x08,0x01,0x63,
-0x80,0x83,0x6c,0x0a,0x88,0x04,0x50,0x80,0x81,0x90,0x08,0x08,0x40,0x6c,0x17,0xf4,
-0x04,0x14,0x44,0x07,0x03,0x3a,0x08,0x13,0x38,0x08,0x25,0xb3,0x8c,0x02,0x80,0x09,
-0x19,0x00,0x09,0x20,0xec,0x0f,0x00,0xac,0x07,0x00,0x77,0x09,0xd9,0x0a,0x08,0x02,
-0x8a,0x88,0xc0,0x01,0xa0,0x08,0x02,0x81,0x00,0x80,0xd1,0x0f,0x00,0x20,0x06,0x90,
-0x02,0x55,0x09,0x26,0xc1,0x8a,0x19,0x20,0x08,0xd1,0x0f,0x01,0xdb,0x14,0x11,0x09,
-0x3b,0x08,0x21,0x17,0x76,0x45,0x1c,0x21,0x37,0xb6,0x32,0x2b,0x1d,0x34,0x32,0x2b,
-0x30,0x28,0x85,0x07,0xbc,0x29,0x80,0x38,0xc3,0x8c,0x00,0x37,0x00,0x80,0x46,0x72,
-0x00,0x21,0x81,0x40,0x89,0x02,0x20,0x15,0x80,0x53,0x13,0xf0,0x08,0x14,0x41,0x62,
-0x42,0x48,0x48,0x35,0x01,0x81,0x83,0x54,0x6b,0x6c,0x35,0x06,0x40,0x83,0x52,0x80,
-0x08,0x35,0x40,0x00,0x69,0x02,0x17,0x35,0xb9,0x00,0xc4,0x39,0x7c,0x25,0xb3,0x09,
-0x02,0x82,0x8c,0x19,0x00,0x08,0x20,0x07,0x09,0x01,0x7b,0x00,0xcb,0xa7,0xc0,0x38,
-0xb5,0x09,0x00,0x48,0x08,0xc0,0x34,0x00,0x07,0x7b,0x00,0x02,0x23,0x29,0x10,0x70,
-0xe1,0x07,0x00,0xb5,0x28,0x24,0x52,0x25,0xd9,0x2a,0x11,0x04,0xc2,0x1d,0xf0,0x00,
-0x80,0x00,0x13,0x06,0x06,0x89,0xb8,0x85,0x01,0x11,0x21,0x00,0x47,0x76,0x90,0x06,
-0x19,0x15,0x90,0x31,0x07,0x02,0x51,0x2a,0x42,0x17,0x00,0x58,0x89,0x22,0x13,0x10,
-0x01,0xe2,0x09,0x01,0x39,0x00,0x50,0x47,0x78,0x90,0x00,0x00,0xf3,0x27,0x11,0x75,
-0x20,0x29,0x18,0x76,0x20,0x29,0x11,0x04,0x98,0x08,0x40,0x80,0x05,0x88,0x97,0xf0,
-0x08,0x00,0x14,0x0a,0x19,0x78,0x33,0x28,0x07,0x86,0x01,0x1b,0x09,0x86,0x01,0xf2,
-0x06,0x26,0x73,0x07,0x01,0x46,0x09,0x38,0xd1,0x09,0x08,0x30,0x09,0x32,0x22,0x24,
-0x03,0x76,0x69,0x05,0x98,0x87,0x63,0x01,0x09,0xaa,0x25,0x00,0x61,0x0a,0x13,0x84,
-0xf2,0x25,0x25,0x89,0x18,0xc9,0x21,0x04,0xee,0x25,0x73,0x98,0x83,0x0c,0x70,0x88,
-0x89,0x09,0x3e,0x16,0x15,0x98,0xde,0x08,0x10,0x05,0xc3,0x1f,0x23,0x83,0x07,0x40,
-0x00,0x06,0xc9,0x21,0x10,0x06,0x7c,0x2d,0x00,0x45,0x28,0x03,0xc9,0x21,0xf0,0x00,
-0x05,0x53,0x50,0x70,0x93,0x18,0x08,0x18,0x00,0x80,0x81,0xc8,0x48,0x89,0x18,0x45,
-0x28,0x19,0x68,0xa9,0x22,0xf2,0x05,0x74,0x60,0x70,0x80,0x08,0x09,0x1c,0x84,0x88,
-0x91,0x80,0x18,0x09,0x08,0x85,0x60,0x70,0x07,0x88,0x83,0x14,0x2a,0x20,0x17,0x00,
-0x93,0x29,0x32,0x85,0x60,0x60,0x20,0x00,0x80,0x90,0x80,0x18,0x09,0x07,0x75,0x60,
-0x70,0xae,0x04,0xf1,0x02,0x98,0x89,0x70,0x08,0x00,0x17,0x00,0x48,0x88,0x20,0x04,
-0x55,0x06,0x00,0xa3,0x20,0x80,0x6a,0x28,0x20,0x58,0xc0,0x07,0x00,0x32,0xb6,0x72,
-0x80,0xca,0x29,0x02,0xac,0x1c,0x80,0x74,0x07,0x81,0x00,0x09,0x89,0x83,0x8b,0x8f,
-0x21,0x13,0x87,0xc0,0x0a,0x32,0x04,0xa8,0x87,0x4c,0x1e,0x00,0x8a,0x00,0x61,0x88,
-0x82,0x6a,0x07,0x88,0x92,0x61,0x21,0x62,0x39,0x88,0xa0,0x03,0x88,0x99,0xc7,0x0e,
-0x10,0x87,0x20,0x00,0xc0,0x80,0x00,0x09,0x88,0x82,0x6a,0x83,0x34,0x18,0x25,0x53,
-0x07,0xde,0x19,0x13,0x30,0xde,0x19,0xf4,0x07,0x25,0x50,0x60,0x69,0x32,0x08,0x17,
-0x90,0x00,0x81,0x79,0x85,0x6a,0x07,0x90,0x00,0x80,0x78,0x67,0x28,0x07,0x01,0xc7,
-0x0e,0x00,0xd6,0x00,0xf1,0x01,0x62,0x50,0x80,0x08,0x26,0x1c,0x86,0xc2,0x61,0x80,
-0x18,0x26,0x08,0x85,0x62,0x50,0xb4,0x09,0x50,0x04,0x40,0x00,0x00,0x44,0xfc,0x01,
-0x01,0x97,0x25,0xf0,0x05,0x48,0x26,0x08,0x00,0x82,0x61,0xc8,0x6c,0x26,0x18,0x00,
-0x82,0x60,0xa8,0x78,0x26,0x00,0x20,0x82,0x50,0x3e,0x00,0x31,0xb7,0x78,0x30,0x67,
-0x2a,0xc2,0x62,0x51,0x80,0x09,0x26,0x1c,0x85,0xb2,0x60,0xb7,0x78,0x26,0x53,0x26,
-0x43,0xa4,0x00,0x78,0x8a,0x53,0x26,0x11,0x30,0x43,0x00,0x33,0x46,0x26,0x18,0x43,
-0x00,0xf3,0x02,0x01,0x82,0x60,0x77,0x56,0x25,0x00,0x68,0x88,0x20,0x08,0x00,0x44,
-0x00,0x97,0x7a,0x30,0x0f,0x2c,0x20,0x90,0x00,0xc3,0x00,0x08,0xbc,0x21,0x20,0x8c,
-0x88,0xe0,0x26,0x00,0x88,0x26,0x00,0xc7,0x20,0x37,0x26,0xc6,0x30,0x9c,0x21,0xa1,
-0x88,0x88,0x60,0x06,0x88,0x82,0x00,0x96,0x66,0x20,0x6e,0x20,0xe2,0xc8,0x30,0x68,
-0x8b,0x77,0x40,0x05,0x75,0x00,0x06,0x50,0x47,0x00,0x64,0x50,0x08,0x32,0x05,0x88,
-0x82,0x55,0x00,0x13,0x81,0xe2,0x28,0x01,0xcd,0x19,0x06,0x3f,0x15,0x03,0x75,0x00,
-0x3b,0x0a,0x88,0x82,0x03,0x21,0x00,0xcb,0x25,0xa2,0x89,0x88,0x30,0x08,0x42,0x21,
-0x00,0x25,0x65,0x20,0x3f,0x13,0x06,0x31,0x22,0x20,0x03,0x00,0x95,0x00,0x50,0x98,
-0x88,0x20,0x08,0x21,0x19,0x0d,0x1a,0x30,0x23,0x21,0x00,0x95,0x00,0x00,0x3c,0x00,
-0xe2,0x55,0x53,0x00,0x13,0x43,0x10,0x57,0x77,0x78,0x50,0x69,0x88,0x80,0x05,0x91,
-0x0d,0x00,0x68,0x0b,0xb0,0x45,0x50,0x60,0xa3,0x20,0x80,0x90,0x00,0x80,0xc8,0x80,
-0x06,0x00,0x40,0xb7,0x84,0x80,0x01,0xff,0x01,0x11,0x80,0xe6,0x01,0x20,0x06,0x80,
-0x10,0x2a,0x11,0x08,0x90,0x23,0x09,0xdc,0x0c,0x11,0x00,0xf7,0x14,0x20,0x18,0x00,
-0x25,0x4e,0x20,0x08,0x08,0x04,0x00,0x20,0x0b,0x81,0x3f,0x0d,0x3a,0x5c,0x8b,0x38,
-0xe2,0x18,0x01,0xfe,0x26,0xd2,0x09,0x00,0x06,0x06,0x09,0x10,0x08,0x08,0x0b,0x70,
-0x4c,0x8b,0x38,0xda,0x28,0x70,0x10,0x05,0x00,0x08,0x98,0x89,0x00,0x0a,0x0e,0x00,
-0xa4,0x0c,0xf0,0x04,0x25,0x53,0x61,0x51,0x55,0x28,0x26,0x08,0x62,0x82,0x60,0x86,
-0x29,0x96,0x08,0x61,0x82,0x64,0xbb,0xba,0x01,0x05,0x19,0x2f,0x40,0x38,0x88,0x17,
-0x00,0xee,0x02,0x50,0x08,0x7c,0x03,0xc8,0xc3,0x8a,0x29,0x00,0x16,0x2b,0x51,0x02,
-0x98,0x8a,0x00,0x36,0x16,0x2b,0x01,0x20,0x00,0x20,0x40,0x50,0x20,0x00,0xf2,0x01,
-0x00,0x92,0x91,0x80,0x36,0x65,0x27,0x00,0x29,0x88,0x90,0x03,0x70,0x09,0x00,0x2b,
-0x80,0x04,0xd0,0x35,0x53,0x62,0x51,0x55,0x28,0x36,0x08,0x71,0x83,0x60,0x87,0x5c,
-0x07,0x00,0x29,0x65,0xcb,0x60,0x00,0xf3,0x02,0x58,0x84,0x63,0x40,0x65,0x09,0x35,
-0x08,0x75,0xc3,0x51,0x99,0x28,0x35,0x45,0x53,0x63,0xb4,0x08,0x13,0x30,0xb4,0x08,
-0x71,0x38,0x88,0x07,0x00,0x50,0x56,0xc0,0xcc,0x1e,0x50,0x86,0xc0,0x48,0x77,0x38,
-0x75,0x09,0x16,0x01,0xf4,0x0b,0x00,0x80,0x00,0x01,0x20,0x00,0xa2,0x09,0x01,0x92,
-0xa8,0xc0,0x25,0x54,0x18,0x00,0x04,0x2c,0x15,0xd4,0x0b,0x11,0xa0,0x00,0x27,0x61,
-0x00,0x06,0x77,0x76,0x00,0x01,0x01,0xbd,0x03,0x35,0x07,0x88,0x77,0x55,0x26,0x20,
-0x88,0x84,0x12,0x00,0x34,0x06,0x9a,0x95,0x81,0x11,0x0a,0x30,0x0f,0x0b,0x39,0x00,
-0x20,0xa8,0xa6,0xe1,0x10,0x00,0xb0,0x23,0x10,0x07,0x1d,0x00,0x11,0x06,0x8c,0x2f,
-0x25,0x79,0x89,0xf9,0x0a,0x15,0x08,0xf1,0x24,0x64,0x07,0x77,0x75,0x00,0x02,0x02,
-0x39,0x00,0x34,0x08,0x88,0x76,0x69,0x0f,0x03,0x72,0x00,0x32,0x07,0x98,0x95,0x2c,
-0x2d,0x0c,0x78,0x28,0x91,0x35,0x56,0x17,0x15,0x25,0x08,0x08,0x08,0x09,0x03,0x00,
-0x63,0x08,0x4b,0x7b,0x48,0x01,0x10,0xe6,0x05,0x10,0x28,0xe6,0x00,0x14,0x50,0xd2,
-0x1f,0x1e,0x38,0x06,0x01,0x04,0xa6,0x01,0x4f,0x08,0x03,0xc8,0xc4,0xa6,0x01,0x09,
-0x8b,0x08,0x01,0x92,0xa2,0x80,0x25,0x54,0x28,0x26,0x01,0x80,0x07,0x72,0x08,0x00,
-0x67,0x77,0x19,0x00,0xb9,0x01,0xf8,0x00,0x17,0x18,0x0b,0x81,0x43,0x08,0x09,0x00,
-0x27,0x18,0x09,0x00,0x04,0x71,0x09,0x52,0x02,0x00,0x32,0x09,0xf4,0x00,0x00,0x58,
-0x96,0x08,0x00,0x28,0x55,0x0c,0x80,0x53,0x17,0x08,0x00,0x07,0x71,0x38,0x1b,0x04,
-0xde,0x14,0x11,0x02,0x24,0x00,0xa0,0x67,0x77,0x09,0x00,0x17,0x62,0x09,0x00,0x53,
-0x07,0x44,0x0e,0x40,0x09,0x00,0x02,0x00,0xcb,0x2b,0x55,0x03,0x00,0x07,0x98,0x85,
-0x48,0x00,0xf1,0x00,0x69,0x97,0x09,0x00,0x29,0x75,0x0d,0x80,0x53,0x18,0x09,0x00,
-0x07,0x71,0x05,0x50,0x10,0x00,0x1f,0x03,0x02,0x86,0x1f,0x06,0x28,0x00,0xf1,0x00,
-0x68,0x87,0x09,0x00,0x2a,0x84,0x0d,0x80,0x53,0x08,0x09,0x00,0x07,0x72,0x07,0x14,
-0x04,0x01,0x51,0x2e,0x03,0xae,0x05,0x08,0x28,0x00,0x31,0x19,0x84,0x0c,0x28,0x00,
-0x40,0x18,0x82,0x07,0x00,0x01,0x1e,0x01,0xea,0x02,0x29,0x77,0x78,0x28,0x00,0x62,
-0x67,0x77,0x08,0x00,0x2a,0x83,0xc0,0x00,0x22,0x08,0x82,0xdc,0x0e,0x20,0x06,0x40,
-0xa3,0x27,0x13,0x38,0x05,0x16,0xf5,0x06,0x60,0x65,0x77,0x58,0x08,0x04,0x50,0x80,
-0x82,0x75,0x48,0x58,0x43,0x17,0x82,0x82,0x86,0x48,0x08,0x02,0x30,0xfe,0x05,0x01,
-0x9c,0x29,0xf0,0x03,0x16,0x07,0x47,0x87,0x91,0x80,0xa8,0x49,0x9a,0x26,0x08,0x91,
-0x80,0x77,0x16,0x08,0x00,0x18,0xb3,0x25,0x86,0x27,0x00,0x92,0x05,0x60,0x00,0x67,
-0x40,0x6b,0x00,0xaf,0x0c,0x80,0x2a,0x83,0x09,0x00,0x53,0x17,0x0c,0x70,0x6b,0x00,
-0x01,0xf6,0x05,0x06,0x73,0x06,0x57,0x76,0x28,0x03,0x62,0x08,0x09,0x19,0x19,0x26,
-0x08,0x4b,0x08,0x09,0x08,0x03,0x72,0x25,0x2d,0xf4,0x09,0x05,0x72,0x07,0x47,0x77,
-0x19,0x09,0x75,0x09,0x26,0x08,0x6c,0x07,0x64,0x08,0x01,0x88,0x87,0x04,0x50,0x09,
-0x03,0xa7,0x7b,0x84,0x00,0xf1,0x04,0x10,0x50,0x57,0x77,0x19,0x00,0xb9,0x50,0x80,
-0x26,0x08,0x7c,0x00,0x77,0x40,0x80,0x00,0x48,0x83,0x1d,0x07,0x61,0xa0,0x1a,0x00,
-0x02,0x77,0x20,0x11,0x0f,0xf0,0x03,0x03,0x27,0x48,0x96,0x54,0x80,0xa6,0x7a,0x48,
-0x19,0x17,0x54,0x90,0x57,0x03,0x26,0x00,0x68,0xbb,0x22,0x13,0x88,0x9f,0x2a,0x01,
-0x46,0x00,0xf8,0x0c,0x20,0x80,0x48,0x88,0x19,0x00,0x68,0x36,0xc0,0x17,0x09,0x08,
-0x00,0x91,0x87,0xc0,0x03,0x71,0x08,0x00,0x27,0x00,0x20,0x02,0xb7,0x78,0x10,0x87,
-0x00,0xf0,0x06,0x08,0x55,0x5c,0x16,0x08,0x6c,0x08,0x94,0x08,0x00,0x27,0x74,0x00,
-0x90,0x1a,0x01,0x90,0x1a,0x00,0x27,0x61,0xeb,0x00,0xd0,0x78,0x87,0x60,0x00,0x87,
-0x70,0x00,0x72,0x05,0x30,0x03,0x87,0x80,0xa5,0x2f,0x03,0x57,0x27,0x10,0x00,0x9d,
-0x08,0xc0,0xa7,0x10,0x03,0x8b,0x83,0x00,0x27,0x08,0x10,0x00,0x98,0x80,0x67,0x03,
-0x00,0x75,0x00,0x64,0x35,0x55,0x90,0x0a,0x44,0x42,0xe2,0x1e,0x01,0x23,0x00,0xf0,
-0x0a,0x73,0x00,0x37,0x09,0x10,0x01,0x97,0x90,0x05,0x66,0xb6,0x74,0x00,0x68,0x50,
-0x00,0x74,0x05,0x50,0x07,0x30,0x46,0x00,0x06,0x75,0x7d,0x00,0x50,0x00,0x57,0x77,
-0x18,0x00,0x71,0x32,0x40,0x35,0x08,0x0a,0x81,0x2f,0x0c,0x20,0x00,0x40,0x89,0x03,
+0x88,0x89,0x40,0x09,0x00,0x26,0x00,0xa7,0x79,0x50,0x00,0x63,0x00,0xf1,0x0d,0x60,
+0x18,0x09,0x09,0x05,0x90,0xa8,0x91,0x96,0x49,0x09,0x51,0x04,0x60,0x80,0x01,0x78,
+0x60,0x00,0x91,0x05,0x50,0x09,0x20,0x64,0x00,0x06,0x74,0xd0,0x00,0xf0,0x0e,0x01,
+0x70,0x0c,0x80,0x07,0xa0,0x09,0x00,0x38,0x28,0x0c,0x70,0x50,0x02,0x09,0x00,0x00,
+0x09,0x05,0x00,0x00,0x5c,0x30,0x00,0x05,0x80,0x84,0x00,0x02,0x18,0x01,0xe1,0x30,
+0x06,0x00,0x90,0x08,0x02,0x80,0x29,0x06,0xb2,0x6b,0x09,0x45,0x09,0x5b,0x01,0x02,
+0x03,0x00,0x01,0x57,0x01,0xe1,0x90,0x09,0x03,0xc1,0x8b,0x09,0x28,0x08,0x51,0x02,
+0x17,0x03,0x88,0x87,0x4d,0x01,0x00,0x0a,0x02,0x00,0x1b,0x00,0xf4,0x09,0x08,0x00,
+0x90,0x01,0xd2,0x8c,0x00,0x92,0x90,0x90,0x43,0x02,0x39,0x00,0x05,0x00,0x80,0x00,
+0x90,0x00,0x00,0x0c,0x88,0x80,0x92,0x01,0xf1,0x0c,0x09,0x02,0xa0,0x04,0xb4,0x5b,
+0x02,0x90,0x81,0x80,0x20,0x00,0x04,0x00,0x08,0x89,0xc0,0x00,0x99,0x9b,0x00,0x18,
+0x00,0x00,0x00,0x88,0x88,0x9a,0x00,0x51,0x09,0x00,0x90,0x01,0xd1,0x40,0x00,0xf0,
+0x02,0x33,0x01,0x28,0x00,0x03,0x88,0x40,0x00,0xa0,0x0a,0x00,0x0a,0x11,0xa0,0x00,
+0x17,0x61,0x96,0x00,0xf0,0x05,0x70,0x00,0x90,0x08,0x90,0x00,0x90,0x18,0x90,0x00,
+0xd4,0x69,0x80,0x05,0x58,0x08,0x80,0x08,0x07,0x18,0x19,0x02,0x03,0x04,0x00,0x22,
+0x00,0x00,0x41,0x01,0xb6,0x17,0x05,0xa5,0xc1,0x71,0x95,0x58,0x17,0x51,0x04,0x61,
+0x41,0x01,0x11,0x35,0x41,0x01,0x23,0x50,0x71,0x20,0x00,0xb2,0x70,0xa6,0x48,0x17,
+0x52,0x05,0x81,0x70,0x06,0x06,0x16,0xa4,0x00,0x12,0x83,0xa4,0x00,0x10,0x60,0x20,
+0x00,0xe2,0x06,0xa5,0xc0,0x71,0x93,0x68,0x07,0x50,0x02,0x41,0x40,0x07,0x88,0x96,
+0x61,0x01,0x50,0x00,0x00,0x68,0x88,0x40,0x60,0x00,0x12,0x08,0x40,0x00,0x11,0xa5,
+0x60,0x00,0xfc,0x11,0x70,0x00,0x17,0x01,0x00,0x08,0xa1,0x00,0x08,0x61,0x92,0x00,
+0x20,0x00,0x10,0x00,0x60,0x08,0x00,0x08,0x08,0xc0,0x02,0xd0,0x09,0x00,0x92,0x98,
+0xc0,0x52,0x02,0x29,0x04,0x01,0xf0,0x09,0x03,0x00,0x00,0x00,0xa0,0x00,0x00,0x6b,
+0x40,0x00,0x48,0x08,0x50,0x04,0x05,0x03,0x00,0x00,0x90,0x00,0x68,0x8b,0x88,0x60,
+0x42,0x01,0x60,0x06,0xb3,0x00,0x08,0x62,0x76,0xe4,0x02,0x71,0x68,0x89,0x88,0x50,
+0x58,0x88,0x50,0xa8,0x02,0x00,0x3e,0x00,0x11,0x01,0x7d,0x01,0xf2,0x00,0x04,0xd2,
+0x00,0x05,0x81,0x94,0x00,0x30,0x80,0x20,0x68,0x8c,0x88,0x60,0x30,0x1e,0x00,0x31,
+0x98,0x88,0x70,0x3c,0x00,0x11,0xb4,0x3c,0x00,0x00,0x4e,0x00,0xf3,0x01,0x88,0x88,
+0x60,0x07,0x88,0x10,0x06,0x30,0x18,0x00,0x55,0x04,0x70,0x00,0x57,0x50,0x59,0x01,
+0xf5,0x03,0x80,0x01,0xd3,0x08,0x00,0x91,0x91,0x80,0x31,0x50,0x28,0x00,0x08,0x00,
+0x80,0x48,0xa8,0x68,0x4f,0x03,0xc0,0x04,0x00,0x00,0x00,0xc0,0x00,0x00,0x87,0x80,
+0x00,0x84,0x03,0x12,0x00,0x44,0x06,0x88,0xc8,0x85,0x7b,0x00,0x03,0x26,0x03,0x00,
+0x0b,0x00,0xf0,0x06,0x5c,0x20,0x00,0x77,0x08,0x50,0x01,0x00,0x01,0x06,0x88,0xb8,
+0x85,0x05,0x09,0x00,0x00,0x90,0x30,0x00,0x09,0x01,0x02,0x12,0x01,0xd5,0x00,0xa0,
+0x98,0x60,0x00,0x83,0x04,0x60,0x68,0x88,0x88,0x50,0x58,0x00,0x98,0x06,0x00,0x00,
+0x05,0xb5,0x00,0x07,0x60,0x57,0xf8,0x00,0x60,0x4c,0x20,0x00,0x29,0x09,0x20,0x40,
+0x03,0x01,0x50,0x01,0x00,0xe3,0x00,0x02,0x19,0x00,0x11,0x89,0x3c,0x00,0x30,0x57,
+0x77,0x77,0x12,0x00,0x70,0x05,0x88,0x79,0x00,0x58,0x88,0x80,0x82,0x00,0x52,0x48,
+0x88,0x60,0x00,0x08,0x1b,0x01,0x20,0x60,0x76,0x01,0x03,0x70,0x58,0x88,0x88,0x50,
+0x50,0x00,0x40,0x7f,0x03,0x61,0x90,0x00,0x80,0x04,0x88,0x84,0x1b,0x01,0xf1,0x0c,
+0x07,0xb3,0x00,0x08,0x50,0x75,0x00,0x10,0x00,0x10,0x67,0x88,0x87,0x50,0x07,0x87,
+0x00,0x07,0x20,0x27,0x00,0x74,0x04,0x60,0x00,0x57,0x40,0x2e,0x04,0xe1,0x90,0x08,
+0x00,0xa0,0x08,0x04,0xc1,0x08,0x09,0x28,0x09,0x45,0x07,0x19,0x3a,0x01,0x07,0xce,
+0x02,0x89,0xc0,0x09,0x19,0x28,0x09,0x51,0x02,0x18,0xce,0x02,0x10,0x00,0xc3,0x00,
+0xf2,0x02,0x90,0x00,0x90,0x09,0x00,0x0d,0x10,0x90,0x08,0x39,0x09,0x04,0x40,0x23,
+0x90,0x00,0x50,0x19,0x04,0x23,0xc8,0x88,0xd1,0x02,0xf0,0x04,0x02,0x70,0x09,0x08,
+0xa0,0x09,0x65,0x18,0x09,0x30,0x00,0x04,0x04,0x98,0x99,0x05,0x99,0x98,0x09,0xc3,
+0x04,0x13,0x86,0xcc,0x02,0xe0,0x00,0xd1,0x08,0x00,0x92,0x90,0x80,0x33,0x01,0x26,
+0x00,0x09,0x88,0xa0,0x86,0x00,0x35,0x0b,0x77,0xb0,0x0c,0x03,0x00,0xec,0x02,0x10,
+0x09,0xec,0x02,0x14,0x42,0xec,0x02,0x11,0x09,0xec,0x02,0xf0,0x0a,0x16,0x61,0x00,
+0x03,0x03,0x07,0x00,0x08,0x08,0x09,0x00,0x0a,0x0a,0x09,0x00,0x1d,0x1d,0x0b,0x81,
+0x5a,0x79,0x28,0x00,0x92,0xb1,0xb2,0x01,0x04,0xe6,0x04,0x00,0xea,0x03,0xe1,0x30,
+0x00,0x09,0x0a,0x00,0x05,0xb0,0xd3,0x00,0x95,0xa4,0x80,0x21,0x04,0xb3,0x00,0x00,
+0xfe,0x01,0xfa,0x07,0x00,0x00,0x07,0x00,0x48,0x92,0x09,0x00,0x80,0x17,0x09,0x00,
+0x80,0x08,0x0c,0x80,0x80,0x26,0x09,0x00,0x28,0x80,0x1f,0x05,0x62,0x06,0x60,0x07,
+0x00,0x64,0x36,0x20,0x00,0x7d,0x64,0x26,0x08,0x00,0x06,0x60,0x08,0x1f,0x05,0x06,
+0x24,0x00,0xb7,0x0a,0x20,0x63,0x17,0x0b,0x50,0x07,0x70,0x08,0x00,0x04,0x1b,0x05,
+0x63,0x06,0x70,0x07,0x00,0x63,0x27,0x44,0x00,0x10,0x36,0x44,0x00,0xf2,0x11,0x45,
+0x00,0x06,0x05,0x99,0x10,0x09,0x02,0x86,0x00,0x0a,0x67,0x38,0x00,0x01,0x10,0x63,
+0x00,0x07,0x81,0x08,0x00,0x72,0x18,0x09,0x10,0x80,0x08,0x0c,0x70,0x29,0x93,0x58,
+0x00,0x71,0x05,0x88,0x89,0x00,0x06,0x88,0x88,0x48,0x00,0x00,0x2c,0x01,0x53,0x07,
+0x70,0x07,0x00,0x72,0xac,0x00,0xd0,0x56,0x46,0x08,0x00,0x04,0x40,0x06,0x00,0x06,
+0x88,0x86,0x00,0x09,0x02,0x00,0x2b,0x77,0x78,0xb0,0x00,0x13,0x0d,0xb0,0x00,0x02,
+0x87,0x05,0x32,0x0a,0x98,0x88,0x87,0x05,0x2b,0x88,0x83,0x48,0x00,0xd2,0x09,0x00,
+0x04,0x40,0x07,0x00,0x00,0x77,0x81,0x00,0x07,0x20,0x18,0x83,0x05,0x23,0x57,0x50,
+0x24,0x00,0x17,0x08,0x6c,0x00,0x51,0x05,0x00,0x06,0x98,0x94,0x84,0x05,0x44,0x07,
+0xc8,0xc6,0x00,0x01,0x00,0xf0,0x05,0x75,0x06,0x61,0x62,0x63,0x96,0x28,0x03,0x5a,
+0xb2,0x54,0x72,0x96,0x20,0x53,0x05,0x41,0x00,0x98,0x8a,0x45,0x03,0x32,0x00,0xb7,
+0x7b,0x21,0x00,0x04,0x63,0x01,0xac,0x0c,0x80,0x80,0x08,0x09,0x00,0x80,0x26,0x0c,
+0x80,0x63,0x01,0x02,0x6b,0x00,0x02,0x20,0x00,0xf0,0x04,0x56,0x46,0x0c,0x70,0x04,
+0x40,0x08,0x00,0x00,0x78,0x71,0x00,0x05,0x40,0x18,0x00,0x05,0x50,0x28,0x8f,0x00,
+0x00,0xd9,0x00,0xe5,0x29,0x83,0x08,0x71,0x08,0x08,0x80,0x08,0x7b,0x62,0x08,0x08,
+0x08,0x81,0x6a,0x05,0x00,0x3f,0x00,0xb0,0x06,0x32,0x70,0x90,0x80,0x08,0x8b,0x06,
+0x42,0x60,0x80,0xa0,0x01,0x82,0x12,0x00,0x80,0x04,0x50,0x00,0x00,0x3b,0x4b,0x04,
+0xe0,0x07,0x81,0x07,0x07,0x21,0x80,0x90,0x80,0x08,0x5b,0x02,0x99,0x30,0x90,0x62,
+0x03,0xd0,0x38,0x88,0xa0,0x03,0x98,0x89,0x00,0x63,0x00,0x00,0x02,0x88,0x77,0x7a,
+0x01,0x61,0x72,0x18,0x19,0x80,0x08,0x4a,0x77,0x01,0xf2,0x08,0x05,0x04,0x20,0x05,
+0x06,0xa8,0x8a,0x06,0x30,0x08,0x02,0x78,0x85,0x07,0x81,0x08,0x07,0x21,0x81,0xa0,
+0x80,0x08,0x4c,0x3b,0x00,0xf0,0x0f,0x05,0x00,0x70,0x60,0x60,0x08,0x9c,0x2a,0x00,
+0x80,0x88,0x65,0x03,0x76,0x30,0x10,0x19,0x92,0x07,0x07,0x10,0xa0,0x90,0x81,0x0a,
+0x7a,0x02,0x99,0x40,0x80,0x5b,0x00,0x00,0x02,0x06,0x63,0xd2,0xa4,0x00,0x82,0xb3,
+0x72,0x35,0x07,0xf0,0x0a,0x62,0x99,0x28,0x17,0x71,0x17,0x81,0x78,0x00,0xcc,0x17,
+0x62,0x25,0x81,0x70,0x88,0x08,0x17,0x00,0x00,0x81,0x70,0x00,0x07,0x18,0x66,0x05,
+0xf0,0x0a,0x18,0x80,0x62,0x47,0x13,0x59,0x25,0x80,0x2a,0xc2,0x53,0x99,0x18,0x25,
+0x00,0x00,0x11,0x10,0x07,0x88,0xa4,0x00,0x88,0x8a,0x30,0x19,0x01,0x31,0x78,0x88,
+0x30,0xf6,0x00,0xb7,0x18,0x70,0x09,0x7a,0x80,0x08,0x08,0x71,0x18,0x8b,0x18,0xf6,
+0x00,0xf8,0x00,0x05,0x60,0x07,0x55,0x36,0x6b,0x80,0x08,0x09,0x55,0x36,0x8b,0x05,
+0x60,0x08,0x92,0x03,0xe0,0x06,0x60,0x07,0x06,0x43,0x67,0xc0,0x80,0x08,0x09,0x06,
+0x32,0x78,0xb0,0x8d,0x02,0x96,0x21,0x00,0x80,0x05,0x30,0x00,0x00,0x59,0x78,0x11,
+0x01,0x9d,0x87,0xb0,0x80,0x08,0x29,0x02,0x99,0x35,0xa0,0x11,0x01,0x00,0x51,0x01,
+0xf4,0x09,0x63,0x27,0x7b,0x80,0x08,0x09,0x46,0x56,0x8b,0x03,0x30,0x06,0x00,0x78,
+0x83,0x03,0x60,0x09,0x02,0x90,0x29,0x00,0x37,0x60,0xd1,0x00,0xc0,0x1b,0xa1,0x78,
+0x00,0x88,0x17,0x62,0x2b,0xb1,0x70,0x89,0x08,0x63,0x08,0x14,0x70,0x98,0x07,0x90,
+0x47,0x40,0x00,0x47,0x06,0x40,0x07,0x20,0x17,0x07,0x00,0x35,0x00,0x48,0x40,0xb7,
+0x05,0x93,0x88,0x70,0x00,0x72,0x03,0x50,0x03,0x98,0x92,0x12,0x00,0xf0,0x16,0x50,
+0x30,0x00,0x00,0x07,0x20,0x00,0x00,0x79,0x88,0x70,0x02,0x87,0x82,0x00,0x72,0x01,
+0x80,0x01,0x89,0x81,0x05,0x77,0xc7,0x75,0x00,0x11,0x10,0x00,0x48,0x87,0xa0,0x06,
+0x88,0x89,0x00,0xa0,0xf7,0x02,0x51,0x87,0x00,0x01,0x87,0x80,0x3c,0x00,0x11,0x97,
+0x3c,0x00,0x00,0xf3,0x05,0x37,0x40,0x00,0x30,0xd8,0x04,0x60,0x02,0x72,0x05,0x00,
+0x09,0x09,0x50,0x06,0x10,0x08,0x08,0x00,0xc5,0x62,0x02,0x81,0x08,0x31,0x00,0x80,
+0x08,0x00,0x48,0x98,0x58,0x04,0x04,0x50,0x04,0x84,0x07,0x00,0x09,0x28,0x04,0xf2,
+0x19,0x2a,0x09,0x00,0x03,0xc3,0x09,0x82,0x48,0xb8,0x59,0x00,0x01,0x10,0x08,0x00,
+0x04,0x30,0x00,0x00,0x04,0xa8,0x88,0x00,0x02,0x72,0x07,0x00,0x90,0x90,0x80,0x09,
+0x08,0x08,0x00,0xa0,0x90,0x80,0x02,0x82,0x08,0xfb,0x05,0x14,0x78,0xfb,0x05,0x00,
+0x40,0x00,0xf0,0x02,0x90,0x80,0x90,0x09,0x29,0x08,0x00,0x1a,0x10,0x80,0x58,0xb8,
+0x58,0x00,0x11,0x00,0x70,0x3d,0x00,0x30,0x4a,0x88,0x70,0xf5,0x00,0x13,0x46,0xf5,
+0x00,0x50,0x07,0x30,0x00,0x57,0x50,0x06,0x02,0x44,0x68,0xc8,0xc8,0x60,0xb9,0x00,
+0xf2,0x17,0xb8,0xb2,0x00,0x08,0x09,0x00,0x68,0x98,0x98,0x60,0x05,0x75,0x00,0x07,
+0x40,0x56,0x00,0x73,0x04,0x60,0x00,0x67,0x50,0x00,0x00,0x78,0x70,0x00,0x72,0x02,
+0x60,0x07,0x10,0x17,0x00,0x18,0x88,0x10,0x50,0x06,0x17,0x86,0x50,0x06,0x00,0x35,
+0x01,0x91,0x63,0x04,0x50,0x04,0x73,0x83,0x00,0x02,0x42,0x35,0x01,0x50,0x50,0x90,
+0x00,0x09,0x03,0x05,0x08,0x23,0x70,0x01,0x35,0x01,0xe1,0x87,0x82,0x05,0x77,0x77,
+0x76,0x00,0x19,0x10,0x00,0x58,0x77,0xb0,0x06,0x15,0x01,0x01,0x35,0x01,0xe0,0x00,
+0x77,0x71,0x00,0x63,0x01,0x70,0x04,0x85,0x85,0x00,0x01,0x31,0x00,0x08,0x07,0x30,
+0x58,0xc8,0x60,0x29,0x04,0x30,0x98,0x88,0xa0,0xd1,0x00,0xe1,0x01,0x87,0x81,0x00,
+0x62,0x02,0x60,0x02,0x87,0x82,0x06,0x88,0x88,0x85,0x26,0x01,0x96,0x60,0x00,0x00,
+0x5b,0x50,0x00,0x76,0x05,0x70,0xf1,0x00,0x20,0x80,0x08,0xcb,0x00,0xc0,0x60,0x80,
+0x24,0x45,0x68,0x02,0x4a,0x31,0x80,0x00,0x81,0x8c,0x18,0x01,0x00,0xc9,0x06,0x31,
+0x03,0x83,0x06,0x31,0x01,0xf1,0x12,0x19,0x08,0x00,0x27,0x21,0x80,0x58,0xb7,0x48,
+0x00,0x06,0x18,0xc0,0x04,0x40,0x03,0x00,0x3a,0x88,0x80,0x06,0x86,0x07,0x00,0x80,
+0x90,0x80,0x05,0x85,0x08,0x06,0x8a,0x85,0x35,0x00,0xf2,0x19,0x18,0x88,0x90,0x00,
+0x55,0x5b,0x00,0x38,0x44,0x30,0x01,0x88,0x88,0x10,0x06,0x81,0x50,0x73,0x50,0x88,
+0x18,0x43,0x08,0x81,0x80,0x88,0x27,0x18,0x35,0x67,0x81,0x81,0x47,0x18,0x18,0x02,
+0x65,0xb1,0x80,0x25,0x17,0x03,0x21,0x03,0x84,0x8d,0x01,0x00,0xd0,0x01,0xa0,0x78,
+0x70,0x80,0x00,0x01,0x28,0x04,0x8c,0x74,0x80,0xd2,0x01,0x03,0x7c,0x00,0xd1,0x00,
+0x77,0x70,0x00,0x72,0x04,0x50,0x07,0x10,0x36,0x00,0x18,0x88,0xf5,0x04,0xd0,0x9b,
+0x8c,0x85,0x01,0x80,0x90,0x00,0x18,0x08,0x00,0x00,0x20,0x20,0xdc,0x00,0x00,0x78,
+0x01,0xe0,0x01,0x87,0x81,0x05,0x77,0x77,0x75,0x00,0x91,0x90,0x00,0x58,0x77,0x90,
+0x49,0x05,0x10,0x90,0x33,0x07,0xf5,0x04,0x86,0x00,0x00,0x57,0x30,0x00,0x55,0x08,
+0x20,0x08,0x00,0x35,0x00,0x55,0x07,0x20,0x00,0x58,0x30,0x11,0x06,0xc0,0x88,0x80,
+0x00,0x73,0x02,0x70,0x04,0x83,0x75,0x00,0x02,0x42,0x42,0x07,0x25,0x70,0x40,0x3d,
+0x08,0x06,0x71,0x01,0x40,0x04,0x87,0x77,0x86,0xa6,0x02,0x33,0x37,0x77,0xa0,0x71,
+0x01,0x16,0x05,0xa6,0x02,0x91,0x02,0x97,0x92,0x00,0x11,0x11,0x10,0x68,0x88,0x99,
+0x08,0x02,0x71,0x01,0x12,0x90,0x71,0x01,0x05,0xc6,0x02,0x30,0x11,0x11,0x11,0xc1,
+0x07,0x00,0x7e,0x07,0x40,0x30,0x27,0x00,0x65,0x7e,0x07,0x14,0x50,0x82,0x02,0x00,
+0xf5,0x00,0xd5,0x91,0x90,0x80,0x02,0x72,0x08,0x00,0x00,0x12,0x80,0x48,0x77,0x48,
+0x7d,0x08,0xb0,0x00,0x07,0x19,0x84,0x08,0x71,0x09,0x08,0x80,0x09,0x08,0x02,0x05,
+0x16,0x92,0x0c,0x04,0x50,0x06,0x60,0x06,0x64,0x37,0x6a,0x0c,0x60,0x64,0x27,0x09,
+0x06,0x60,0x08,0x2b,0x06,0x04,0x0c,0x04,0x01,0xcc,0x03,0xf2,0x00,0x09,0x80,0x08,
+0x08,0x64,0x26,0x08,0x06,0x60,0x08,0x02,0x20,0x08,0x05,0x40,0xa0,0x0c,0x00,0x07,
+0x04,0x20,0x72,0x18,0xb8,0x0c,0x20,0x29,0x93,0x34,0x09,0x71,0x03,0x88,0x8a,0x04,
+0x88,0x88,0x07,0xa0,0x0c,0x00,0x13,0x05,0xf0,0x07,0x09,0x09,0x80,0x09,0x09,0x29,
+0x95,0x08,0x00,0x00,0x13,0x05,0x78,0x7a,0x06,0x87,0x08,0x09,0x00,0x09,0x05,0x86,
+0x51,0x00,0x20,0x72,0x17,0x6c,0x00,0xf4,0x00,0x56,0x46,0x08,0x04,0x40,0x06,0x04,
+0x88,0x87,0x07,0x10,0x09,0x06,0x87,0x79,0x51,0x00,0x14,0x09,0x51,0x00,0xd0,0x05,
+0x05,0x10,0x05,0x07,0x98,0x8a,0x07,0x10,0x09,0x03,0x78,0x84,0x00,0x01,0xd0,0x88,
+0x10,0x90,0x71,0x07,0x09,0x08,0x10,0x70,0x90,0x29,0x82,0x09,0x96,0x07,0xb3,0x00,
+0x90,0x90,0x00,0x1d,0x2c,0x30,0x09,0x1b,0x18,0x10,0x4d,0x06,0x80,0x38,0x83,0x08,
+0x00,0x00,0x54,0x09,0x00,0x4d,0x08,0xe6,0x01,0xb0,0x0c,0x80,0x08,0x83,0x08,0x00,
+0x36,0x09,0x08,0x00,0x20,0x01,0x2e,0x06,0x62,0x37,0x73,0x07,0x00,0x00,0x63,0x20,
+0x00,0x6e,0x0a,0x65,0x09,0x00,0x62,0x05,0x91,0x07,0x05,0x4c,0x00,0xf3,0x01,0x64,
+0x08,0x00,0x00,0xb0,0x08,0x00,0x09,0x92,0x0c,0x80,0x72,0x08,0x08,0x00,0x05,0x95,
+0x07,0xf7,0x0e,0x08,0x88,0x85,0x00,0x37,0x84,0x07,0x00,0x00,0x82,0x09,0x00,0x04,
+0xc0,0x0c,0x81,0x47,0x28,0x09,0x00,0x20,0x02,0x04,0x00,0x04,0x88,0x89,0x00,0x05,
+0x71,0x07,0xf1,0x04,0x58,0x82,0x07,0x00,0x00,0x91,0x09,0x00,0x03,0xa0,0x0c,0x80,
+0x19,0x83,0x08,0x00,0x70,0x04,0x08,0x59,0x03,0x00,0x29,0x07,0x22,0x07,0x40,0x9a,
+0x06,0x70,0x03,0x40,0x60,0x71,0x4a,0x18,0x08,0x2d,0x03,0xc5,0x29,0x0a,0x88,0x09,
+0x90,0x80,0x83,0x63,0x68,0x08,0x20,0x02,0xab,0x0c,0xf1,0x00,0x25,0x61,0x61,0x60,
+0x1a,0x19,0x17,0x03,0xa0,0x99,0x71,0xa6,0x48,0x17,0x61,0x6a,0x0b,0x53,0x82,0x00,
+0x00,0x03,0x50,0x6a,0x0b,0xf0,0x06,0x14,0x52,0x05,0x13,0x57,0x08,0x00,0x72,0x08,
+0x00,0xc2,0x8b,0x06,0x84,0x08,0x18,0x09,0x08,0x20,0x02,0x08,0x37,0x07,0xf6,0x05,
+0x00,0x00,0x27,0x74,0x07,0x00,0x46,0x09,0x00,0xb0,0x8c,0x08,0x76,0x09,0x52,0x06,
+0x08,0x03,0x78,0x86,0xe4,0x05,0xf9,0x03,0x65,0x07,0x00,0x12,0x80,0x80,0x00,0x91,
+0x6c,0x00,0x68,0x70,0x80,0x46,0x06,0x18,0x00,0x04,0x40,0x0b,0xf3,0x04,0x47,0x83,
+0x07,0x00,0x82,0x09,0x03,0xc1,0x8a,0x39,0x47,0x09,0x40,0x14,0x15,0x04,0x77,0x7a,
+0x06,0x73,0x09,0x20,0x76,0x00,0x5c,0x06,0xf3,0x08,0x60,0x80,0x00,0x17,0x08,0x00,
+0x0b,0x17,0xc0,0x08,0x59,0x08,0x03,0x40,0x32,0x60,0x00,0x98,0x89,0x00,0x18,0x00,
+0x90,0xb6,0x07,0xf0,0x0e,0x38,0x84,0x07,0x00,0x64,0x08,0x02,0xd0,0x8a,0x2a,0x47,
+0x08,0x50,0x03,0x06,0x05,0x00,0x05,0x08,0x98,0x89,0x08,0x00,0x08,0x03,0x78,0x84,
+0x07,0x86,0x17,0x0d,0xb5,0x80,0x00,0xa1,0x7c,0x00,0x66,0x90,0x80,0x34,0x03,0x18,
+0x7d,0x0c,0xf1,0x13,0x01,0xa0,0x00,0x27,0x72,0x00,0x04,0x40,0x51,0x51,0x4a,0x08,
+0x16,0x00,0x90,0x81,0x60,0x29,0x6c,0x16,0x09,0x90,0x81,0x63,0x72,0x68,0x16,0x20,
+0x02,0x81,0x60,0x00,0x07,0x16,0xbf,0x01,0x71,0x81,0x71,0x60,0x09,0x08,0x27,0x04,
+0x79,0x0c,0x81,0x27,0x50,0x04,0x62,0x70,0x00,0x16,0x00,0x19,0x0c,0x11,0x51,0x19,
+0x0c,0x31,0x14,0x52,0x06,0x0f,0x01,0x74,0x8b,0x00,0xc0,0x08,0x06,0x85,0x8b,0x0f,
+0x01,0x10,0x08,0x1b,0x0b,0xe6,0x77,0x71,0x00,0x00,0x1b,0x00,0x00,0x1d,0x40,0x00,
+0x5a,0x29,0x50,0x03,0x14,0x0c,0xa3,0x04,0x77,0x91,0x00,0x01,0xa6,0x00,0x08,0x85,
+0x95,0xd8,0x0b,0x47,0x40,0x58,0x88,0x40,0x14,0x0c,0xe3,0x03,0x87,0x82,0x00,0x00,
+0x79,0x00,0x05,0x95,0x95,0x00,0x20,0x80,0x10,0x7d,0x06,0x03,0xd7,0x03,0xa4,0x03,
+0x77,0x92,0x00,0x01,0x98,0x00,0x07,0x95,0x96,0x5d,0x06,0x04,0x15,0x0b,0x60,0x05,
+0x60,0x00,0x57,0x40,0x00,0xf0,0x11,0x17,0x75,0x07,0x00,0x00,0x47,0x08,0x00,0x00,
+0xd1,0x08,0x00,0x1a,0x39,0x0b,0x81,0x31,0x42,0x18,0x00,0x00,0x90,0x08,0x00,0x68,
+0xa8,0x58,0x00,0x00,0x00,0x08,0x00,0x01,0x00,0xf4,0x63,0x04,0x88,0x81,0x00,0x00,
+0x39,0x00,0x00,0x5c,0x60,0x00,0x84,0x04,0x70,0x00,0x00,0x00,0x06,0x88,0xc8,0x85,
+0x00,0x09,0x00,0x00,0x00,0x90,0x00,0x00,0x02,0x00,0x00,0x03,0x87,0x82,0x00,0x00,
+0x79,0x00,0x05,0x95,0x95,0x00,0x20,0x00,0x10,0x68,0x8b,0x88,0x50,0x50,0x80,0x00,
+0x09,0x03,0x00,0x00,0x98,0x88,0x70,0x03,0x87,0x92,0x00,0x00,0x88,0x00,0x06,0x95,
+0x95,0x00,0x10,0x00,0x10,0x68,0x8c,0x88,0x50,0x05,0xc6,0x00,0x06,0x61,0x47,0x00,
+0x55,0x03,0x70,0x00,0x57,0x50,0x00,0x04,0x77,0x91,0x00,0x01,0xa6,0x00,0x08,0x83,
+0x95,0x00,0x11,0x11,0x10,0x57,0x77,0x77,0x40,0x58,0x88,0x40,0x00,0x5d,0x00,0xf0,
+0x01,0x01,0x00,0x04,0x88,0xb4,0x00,0x04,0xb8,0x00,0x18,0x40,0x57,0x06,0x88,0x88,
+0x85,0x8e,0x00,0xe1,0x58,0x88,0x90,0x06,0x88,0x88,0x00,0xa0,0x00,0x00,0x05,0x88,
+0x86,0x00,0x60,0x00,0x53,0x98,0x00,0x07,0x93,0x96,0x40,0x00,0xf2,0x15,0x50,0x07,
+0x87,0x00,0x07,0x20,0x27,0x00,0x74,0x04,0x60,0x00,0x57,0x40,0x00,0x14,0x52,0x06,
+0x13,0x56,0x09,0x00,0x71,0x09,0x00,0xc0,0x09,0x07,0x84,0x09,0x27,0x09,0x09,0x20,
+0x01,0x09,0xd9,0x00,0x50,0x27,0x74,0x07,0x00,0x55,0x18,0x00,0xc1,0x0a,0x57,0x09,
+0x51,0x04,0x08,0x03,0x77,0x75,0x00,0x11,0x09,0x7b,0x00,0xf0,0x07,0x02,0x06,0x65,
+0x07,0x00,0x12,0x80,0x80,0x00,0xa2,0x08,0x00,0x76,0x90,0x80,0x34,0x03,0x28,0x00,
+0x04,0x00,0x80,0x91,0x00,0x10,0x0c,0x0b,0x01,0x01,0x01,0x00,0xf1,0x09,0x48,0x82,
+0x08,0x00,0x82,0x09,0x03,0xb0,0x09,0x39,0x55,0x09,0x50,0x03,0x07,0x05,0x88,0x86,
+0x08,0x00,0x09,0x08,0x87,0x78,0x1b,0x00,0x12,0x06,0x1b,0x00,0xf1,0x03,0x2a,0x64,
+0x09,0x60,0x04,0x06,0x06,0x00,0x05,0x09,0x98,0x89,0x08,0x00,0x08,0x03,0x78,0x83,
+0xc1,0x00,0xf2,0x0c,0x48,0x19,0x00,0x08,0x07,0x19,0x00,0x09,0x09,0x09,0x00,0x0b,
+0x0b,0x0a,0x81,0x4c,0x5c,0x28,0x00,0x92,0xd2,0x78,0x00,0x20,0x20,0x28,0x00,0xfa,
+0x00,0xf0,0x0f,0x00,0x00,0x24,0x33,0x52,0x41,0xa2,0x88,0x25,0x09,0x07,0x82,0x50,
+0xa3,0x78,0x95,0x4c,0x79,0x82,0x58,0x4a,0x79,0x25,0x20,0x20,0x92,0x50,0x00,0x08,
+0x25,0x20,0x00,0xf0,0x04,0x36,0x53,0x62,0x41,0x93,0x78,0x35,0x0a,0x56,0x89,0x54,
+0xa9,0x88,0x35,0x51,0x43,0x72,0x40,0x08,0x9a,0x00,0x50,0x05,0x40,0x00,0x00,0x53,
+0x37,0x01,0xa0,0x07,0xa4,0x85,0x00,0x1b,0x0a,0x10,0x09,0x6a,0x58,0x48,0x01,0x77,
+0x68,0x88,0x88,0x60,0x58,0x88,0x50,0x57,0x01,0xf6,0x07,0x37,0x47,0x07,0x00,0x90,
+0x90,0x80,0x0d,0x1d,0x08,0x05,0x7b,0x64,0x80,0x40,0x40,0x27,0x00,0x28,0x88,0x80,
+0x00,0xd4,0x01,0x80,0x07,0x70,0x07,0x00,0x48,0x84,0x09,0x00,0x21,0x01,0xf5,0x00,
+0x00,0xb0,0x0c,0x80,0x06,0xb1,0x08,0x00,0x37,0x19,0x08,0x00,0x20,0x02,0x08,0xa4,
+0x00,0x00,0x24,0x00,0xf0,0x03,0x38,0x95,0x09,0x00,0x00,0xa1,0x0c,0x80,0x09,0x85,
+0x08,0x00,0x52,0x04,0x06,0x00,0x05,0x88,0x19,0x02,0x57,0x09,0x00,0x08,0x77,0x78,
+0x24,0x00,0x42,0x08,0x00,0x00,0xa0,0x24,0x00,0xf0,0x1c,0x62,0x04,0x06,0x00,0x00,
+0x70,0x70,0x00,0x02,0xb0,0xc1,0x00,0x09,0x4b,0x49,0x10,0x01,0x01,0x00,0x00,0x17,
+0x60,0x16,0x00,0x58,0xa3,0x17,0x00,0x01,0xa0,0x1c,0x80,0x1a,0x93,0x17,0x00,0x61,
+0x04,0x14,0x00,0x05,0x88,0xa2,0x3d,0x00,0xf0,0x15,0x00,0x04,0x96,0x93,0x00,0x03,
+0x00,0x03,0x00,0x07,0x60,0x60,0x72,0x88,0x18,0x08,0x00,0x81,0x90,0x80,0x09,0x0a,
+0x88,0x06,0xb0,0x80,0x82,0x83,0x58,0x08,0x30,0x03,0x80,0x80,0x00,0x08,0x91,0x00,
+0x60,0x10,0x07,0x70,0x07,0x03,0x88,0xb1,0x01,0xf4,0x40,0x8c,0x00,0x97,0x70,0x80,
+0x52,0x04,0x09,0x00,0x00,0x61,0x30,0x00,0x1b,0x70,0x00,0x2a,0x14,0x90,0x01,0x00,
+0x01,0x00,0x06,0x71,0x07,0x01,0x88,0x90,0x80,0x00,0x74,0x7c,0x00,0x68,0x80,0x80,
+0x34,0x03,0x18,0x00,0x03,0x88,0x40,0x00,0xa0,0x0a,0x00,0x0a,0x01,0xa0,0x00,0x27,
+0x72,0x00,0x07,0x50,0x52,0x42,0x88,0x18,0x35,0x00,0x81,0x83,0x50,0x0a,0x6b,0x35,
+0x07,0xb0,0x83,0x52,0x83,0x58,0x35,0x30,0x03,0x83,0x70,0x01,0xf1,0x02,0x00,0x77,
+0x30,0x00,0x48,0x88,0x00,0x00,0x04,0x90,0x00,0x06,0xc6,0x00,0x08,0x32,0x46,0x57,
+0x01,0x43,0x8b,0x88,0x60,0x05,0x59,0x00,0xf1,0x05,0x75,0x08,0x00,0x68,0x90,0x80,
+0x25,0x33,0x38,0x00,0x09,0x00,0x80,0x48,0xa8,0x68,0x00,0x00,0x00,0x80,0x39,0x00,
+0xf0,0x01,0x10,0x00,0x00,0x04,0x62,0x00,0x04,0x88,0xe1,0x00,0x01,0xb6,0x00,0x08,
+0x72,0x86,0x14,0x00,0x00,0x07,0x03,0x22,0x00,0x90,0x48,0x01,0x10,0x10,0x8f,0x01,
+0xf2,0x0e,0x00,0x00,0x05,0x72,0x00,0x00,0x57,0x9e,0x10,0x00,0x28,0xb7,0x00,0x01,
+0x61,0x03,0x50,0x07,0x87,0xc8,0x83,0x00,0x58,0xc8,0x40,0x00,0x00,0x01,0x80,0x04,
+0x00,0x02,0x2b,0x00,0xf4,0x0c,0x03,0x73,0x00,0x04,0x88,0xe3,0x00,0x05,0xc7,0x00,
+0x07,0x30,0x47,0x06,0x88,0x98,0x85,0x02,0x09,0x00,0x00,0x90,0x30,0x00,0x09,0x88,
+0x87,0x20,0x00,0xf4,0x0d,0x03,0x79,0xe3,0x00,0x38,0xa9,0x30,0x15,0x11,0x14,0x14,
+0x66,0xb6,0x53,0x05,0x8a,0x87,0x00,0x36,0x66,0x90,0x0a,0x22,0x31,0x00,0x58,0x88,
+0x60,0x23,0x00,0xf1,0x0b,0x78,0xe3,0x00,0x16,0xb9,0x00,0x07,0x20,0x26,0x06,0x88,
+0xc8,0x86,0x00,0x5c,0x50,0x00,0x64,0x04,0x70,0x06,0x40,0x56,0x00,0x05,0x74,0x69,
+0x00,0xf0,0x05,0x37,0x30,0x70,0x07,0x7b,0x08,0x00,0x19,0x90,0x80,0x17,0x14,0x38,
+0x05,0x88,0x98,0x80,0x00,0x91,0x08,0xd8,0x00,0x30,0x00,0x60,0x07,0x66,0x00,0x00,
+0xad,0x00,0x30,0x05,0x79,0xe1,0xac,0x00,0xa2,0x16,0x10,0x35,0x05,0x77,0x77,0x73,
+0x06,0x88,0x84,0xa6,0x00,0x20,0x17,0x00,0x1f,0x04,0xf2,0x05,0x72,0x06,0x27,0x86,
+0x08,0x00,0x19,0x08,0x00,0x82,0x08,0x03,0xc4,0x08,0x19,0x09,0x08,0x30,0x01,0x18,
+0x74,0x03,0x01,0x2f,0x01,0x23,0xa0,0x90,0x2f,0x01,0x00,0x59,0x03,0x0a,0x88,0x01,
+0x01,0x7e,0x00,0x10,0x76,0x86,0x03,0x20,0x09,0x00,0xb8,0x03,0xe6,0x35,0xc1,0x0b,
+0x81,0x04,0x60,0x08,0x00,0x28,0x00,0x08,0x00,0x20,0x00,0x7c,0x02,0xf4,0x08,0x14,
+0x42,0x50,0x71,0x46,0x68,0x08,0x01,0x63,0x80,0x83,0x6c,0x0a,0x88,0x04,0x50,0x80,
+0x81,0x90,0x08,0x08,0x40,0x00,0x10,0x02,0xf4,0x07,0x00,0x14,0x44,0x07,0x03,0x3a,
+0x08,0x13,0x38,0x08,0x25,0xb3,0x8c,0x02,0x80,0x09,0x19,0x00,0x09,0x20,0x00,0x09,
+0xd0,0x04,0xf1,0x07,0x00,0x01,0x78,0x70,0x80,0x00,0x0a,0x08,0x02,0x8a,0x88,0xc0,
+0x01,0xa0,0x08,0x02,0x81,0x00,0x80,0x00,0x50,0x07,0x5a,0x00,0x20,0xc8,0x88,0x20,
+0x00,0xf0,0x28,0x38,0x84,0x07,0x02,0x55,0x09,0x26,0xc1,0x8a,0x19,0x20,0x08,0x30,
+0x00,0x04,0x04,0x88,0x89,0x05,0x88,0x88,0x09,0x10,0x00,0x03,0x88,0x76,0x17,0x76,
+0x07,0x00,0x00,0x90,0x90,0x37,0xb6,0x8c,0x00,0x48,0x00,0x90,0x34,0x00,0x06,0x00,
+0x09,0x88,0x90,0x00,0x90,0x09,0x00,0x0b,0x77,0xb0,0x3b,0x00,0x20,0x28,0x85,0x20,
+0x00,0x90,0x80,0x38,0xc3,0x8c,0x00,0x37,0x00,0x80,0x46,0x72,0x00,0x21,0x81,0x40,
+0x89,0x02,0xf0,0x0e,0x15,0x80,0x02,0x00,0x02,0x00,0x14,0x41,0x62,0x42,0x48,0x48,
+0x35,0x01,0x81,0x83,0x54,0x6b,0x6c,0x35,0x06,0x40,0x83,0x52,0x80,0x08,0x35,0x40,
+0x00,0x69,0x02,0x17,0x35,0xb9,0x00,0xb1,0x39,0x7c,0x25,0xb3,0x09,0x02,0x82,0x8c,
+0x19,0x00,0x08,0xf7,0x00,0x00,0xb9,0x00,0x01,0x7b,0x00,0xcb,0xa7,0xc0,0x38,0xb5,
+0x09,0x00,0x48,0x08,0xc0,0x34,0x00,0x07,0x7b,0x00,0x01,0x5c,0x04,0xf0,0x1f,0x89,
+0x70,0x05,0x88,0x88,0x00,0x00,0x01,0x70,0x00,0x52,0x25,0x00,0x06,0x30,0x00,0x68,
+0xa9,0x88,0x60,0x04,0x88,0x87,0x00,0x48,0x88,0x80,0x00,0x13,0x06,0x06,0x89,0xb8,
+0x85,0x01,0x11,0x21,0x00,0x47,0x76,0x90,0x07,0x99,0x97,0x00,0x90,0xdc,0x05,0x21,
+0x76,0x00,0x93,0x02,0x20,0x89,0x60,0xbe,0x01,0x10,0x58,0x07,0x00,0x72,0x35,0x00,
+0x00,0x01,0x10,0x68,0x88,0x39,0x00,0x80,0x47,0x78,0x90,0x00,0x00,0x08,0x05,0x87,
+0x1e,0x05,0x53,0x11,0x00,0x47,0x76,0xa0,0x7d,0x05,0x00,0x1c,0x00,0x30,0x04,0x88,
+0x84,0xe8,0x02,0xe0,0x05,0x88,0x97,0x00,0x00,0x00,0x30,0x68,0x88,0x88,0x50,0x78,
+0x89,0x60,0xff,0x03,0x3b,0x97,0x77,0x80,0x86,0x01,0x1b,0x09,0x86,0x01,0xf2,0x06,
+0x26,0x73,0x07,0x01,0x46,0x09,0x38,0xd1,0x09,0x08,0x30,0x09,0x32,0x22,0x24,0x03,
+0x76,0x69,0x05,0x98,0x87,0x63,0x01,0x01,0x5e,0x05,0x61,0x83,0x08,0x00,0x90,0x00,
+0x09,0x04,0x00,0xb3,0x98,0x84,0x0c,0x80,0x90,0x00,0x08,0x00,0x88,0x89,0x18,0x00,
+0x02,0x52,0x08,0x00,0x48,0x84,0x08,0x1c,0x00,0x50,0x83,0x0c,0x70,0x88,0x89,0x14,
+0x00,0x60,0x03,0x00,0x05,0x98,0x98,0x00,0xfd,0x00,0x22,0x09,0x00,0x1b,0x06,0x33,
+0x48,0x83,0x07,0x40,0x00,0xa0,0x0d,0x80,0x90,0x01,0x09,0x00,0x38,0x75,0x07,0x00,
+0xa9,0x02,0x00,0xa1,0x00,0x10,0x0a,0x25,0x01,0x00,0x28,0x00,0xf6,0x06,0x53,0x50,
+0x70,0x93,0x18,0x08,0x18,0x00,0x80,0x81,0xc8,0x48,0x89,0x18,0x00,0x80,0x80,0xb7,
+0x68,0x08,0x00,0x48,0x02,0xf1,0x06,0x07,0x74,0x60,0x70,0x80,0x08,0x09,0x1c,0x84,
+0x88,0x91,0x80,0x18,0x09,0x08,0x85,0x60,0x70,0x07,0x88,0x83,0x5f,0x01,0x01,0xeb,
+0x02,0x52,0x10,0x08,0x85,0x60,0x60,0x20,0x00,0x80,0x90,0x80,0x18,0x09,0x07,0x75,
+0x60,0x70,0xae,0x04,0xf0,0x09,0x98,0x89,0x70,0x08,0x00,0x17,0x00,0x48,0x88,0x20,
+0x04,0x55,0x06,0x00,0xa3,0x20,0x80,0x09,0x00,0x08,0x00,0xc8,0x58,0xc0,0x07,0x00,
+0x64,0xb6,0x72,0x80,0x00,0x10,0x08,0x1f,0x04,0xf0,0x09,0x37,0x74,0x07,0x81,0x00,
+0x09,0x89,0x83,0x8b,0x80,0x01,0x08,0x38,0x87,0x08,0x02,0x20,0x08,0x05,0x40,0x00,
+0x04,0xa8,0x87,0x03,0x01,0x20,0x84,0x07,0x8a,0x00,0x70,0x88,0x82,0x6a,0x07,0x88,
+0x92,0x80,0x95,0x05,0xd0,0x39,0x88,0xa0,0x03,0x88,0x99,0x00,0x63,0x00,0x00,0x02,
+0x88,0x87,0x20,0x00,0xf5,0x22,0x80,0x00,0x09,0x88,0x82,0x6a,0x83,0x34,0x18,0x25,
+0x53,0x07,0x04,0x98,0x87,0x06,0x30,0x09,0x05,0x97,0x79,0x00,0x00,0x00,0x25,0x50,
+0x60,0x69,0x32,0x08,0x17,0x90,0x00,0x81,0x79,0x85,0x6a,0x07,0x90,0x00,0x80,0x78,
+0x67,0x28,0x07,0x01,0x00,0x80,0x70,0xd6,0x00,0xf0,0x0b,0x62,0x50,0x80,0x08,0x26,
+0x1c,0x86,0xc2,0x61,0x80,0x18,0x26,0x08,0x85,0x62,0x50,0x08,0x88,0x82,0x00,0x00,
+0x04,0x40,0x00,0x00,0x44,0xfc,0x01,0x00,0x24,0x00,0xf0,0x06,0x88,0x48,0x26,0x08,
+0x00,0x82,0x61,0xc8,0x6c,0x26,0x18,0x00,0x82,0x60,0xa8,0x78,0x26,0x00,0x20,0x82,
+0x50,0x3e,0x00,0x30,0xb7,0x78,0x30,0x83,0x01,0xf0,0x0a,0x84,0x62,0x51,0x80,0x09,
+0x26,0x1c,0x85,0xb2,0x60,0xb7,0x78,0x26,0x00,0x00,0x20,0x20,0x06,0x88,0xa4,0x00,
+0x78,0x8a,0x40,0x08,0x4d,0x02,0x21,0x88,0x30,0x43,0x00,0x33,0x46,0x26,0x18,0x43,
+0x00,0xf1,0x02,0x01,0x82,0x60,0x77,0x56,0x25,0x00,0x68,0x88,0x20,0x08,0x00,0x44,
+0x00,0x97,0x7a,0x30,0x57,0x08,0x11,0x83,0x05,0x05,0x21,0x88,0x82,0x89,0x02,0x00,
+0xde,0x07,0x10,0x80,0x1b,0x05,0xf0,0x00,0x60,0x07,0x88,0x82,0x00,0x88,0x88,0x30,
+0x08,0x32,0x21,0x00,0x26,0xc6,0x30,0x2d,0x05,0x12,0x20,0xf8,0x01,0xf2,0x0e,0x88,
+0x88,0x60,0x06,0x88,0x82,0x00,0x96,0x66,0x20,0x09,0x22,0x20,0x00,0x48,0xc8,0x30,
+0x68,0x8b,0x77,0x40,0x05,0x75,0x00,0x06,0x50,0x47,0x00,0x64,0x50,0x08,0x32,0x05,
+0x88,0x82,0x55,0x00,0x51,0x81,0x00,0x88,0x88,0x40,0xac,0x08,0x26,0xb8,0x85,0xf8,
+0x06,0x04,0x75,0x00,0x12,0x0a,0x27,0x00,0x12,0x05,0x53,0x08,0x00,0xba,0x02,0xe0,
+0x06,0x88,0x83,0x00,0x89,0x88,0x30,0x08,0x42,0x21,0x00,0x25,0x65,0x20,0xfe,0x02,
+0x01,0x47,0x02,0x12,0x8a,0x3a,0x00,0x20,0x03,0x00,0x95,0x00,0x91,0x98,0x88,0x20,
+0x08,0x21,0x10,0x00,0x37,0x77,0xec,0x02,0x12,0x20,0xca,0x02,0x12,0x89,0x95,0x00,
+0x00,0x3c,0x00,0xd0,0x55,0x53,0x00,0x13,0x43,0x10,0x57,0x77,0x78,0x50,0x69,0x88,
+0x80,0x8b,0x02,0x01,0xd8,0x00,0xd0,0x86,0x00,0x45,0x50,0x60,0xa3,0x20,0x80,0x90,
+0x00,0x80,0xc8,0x80,0x06,0x00,0x40,0xb7,0x84,0x80,0x01,0xff,0x01,0x11,0x80,0xe6,
+0x01,0x70,0x06,0x80,0x00,0x08,0x89,0x84,0x08,0x01,0x02,0x20,0x74,0x08,0x2e,0x00,
+0x13,0x00,0x85,0x08,0x01,0x08,0x03,0x90,0x88,0x18,0x00,0x03,0x03,0x09,0x00,0x08,
+0x08,0x04,0x00,0xb7,0x0b,0x81,0x08,0x08,0x08,0x00,0x5c,0x8b,0x38,0x00,0x00,0x0c,
+0x05,0x01,0xf8,0x03,0xc1,0x87,0x09,0x00,0x06,0x06,0x09,0x10,0x08,0x08,0x0b,0x70,
+0x4c,0x20,0x00,0xf0,0x16,0x04,0x00,0x06,0x10,0x05,0x00,0x08,0x98,0x89,0x00,0x08,
+0x20,0x08,0x00,0x03,0x78,0x84,0x00,0x25,0x53,0x61,0x51,0x55,0x28,0x26,0x08,0x62,
+0x82,0x60,0x86,0x29,0x96,0x08,0x61,0x82,0x64,0xbb,0xba,0x01,0x51,0x82,0x60,0x00,
+0x08,0x26,0xf6,0x04,0x30,0x88,0x17,0x00,0xee,0x02,0x60,0x08,0x7c,0x03,0xc8,0xc3,
+0x80,0x42,0x00,0xd1,0x18,0x88,0xc0,0x02,0x98,0x8a,0x00,0x36,0x00,0x00,0x01,0x88,
+0x77,0x20,0x00,0x20,0x40,0x50,0x20,0x00,0xf2,0x01,0x00,0x92,0x91,0x80,0x36,0x65,
+0x27,0x00,0x29,0x88,0x90,0x03,0x70,0x09,0x00,0x2b,0x80,0x04,0xd0,0x35,0x53,0x62,
+0x51,0x55,0x28,0x36,0x08,0x71,0x83,0x60,0x87,0x5c,0x07,0x00,0x29,0x65,0xcb,0x60,
+0x00,0xf3,0x02,0x58,0x84,0x63,0x40,0x65,0x09,0x35,0x08,0x75,0xc3,0x51,0x99,0x28,
+0x35,0x45,0x53,0x63,0xb4,0x08,0x13,0x30,0xb4,0x08,0x70,0x38,0x88,0x07,0x00,0x50,
+0x56,0xc0,0xe3,0x00,0x60,0x80,0x86,0xc0,0x48,0x77,0x38,0x75,0x09,0x11,0x01,0x75,
+0x09,0x14,0x80,0xa0,0x00,0x01,0x20,0x00,0xa0,0x09,0x01,0x92,0xa8,0xc0,0x25,0x54,
+0x18,0x00,0x04,0x3c,0x06,0xd0,0x09,0x00,0x0b,0x11,0xa0,0x00,0x27,0x61,0x00,0x06,
+0x77,0x76,0x00,0x50,0x08,0x02,0xbd,0x03,0x34,0x07,0x88,0x77,0xa4,0x07,0x30,0x06,
+0x88,0x84,0x12,0x00,0xd1,0x06,0x9a,0x95,0x05,0x77,0xc7,0x75,0x00,0x11,0x10,0x00,
+0x58,0x77,0x44,0x0a,0x12,0x90,0x29,0x04,0x0b,0x39,0x00,0xb0,0xa8,0xa6,0x00,0x09,
+0x08,0x00,0x68,0xb8,0xb8,0x50,0x07,0x1d,0x00,0x10,0x06,0xd0,0x05,0x35,0x00,0x79,
+0x89,0xf9,0x0a,0x02,0xbd,0x03,0x00,0xa0,0x01,0x64,0x07,0x77,0x75,0x00,0x02,0x02,
+0x39,0x00,0x33,0x08,0x88,0x76,0x4d,0x02,0x04,0x72,0x00,0x70,0x07,0x98,0x95,0x05,
+0x87,0x77,0x85,0x39,0x05,0x37,0x57,0x76,0xa0,0xb6,0x0a,0x91,0x35,0x56,0x17,0x15,
+0x25,0x08,0x08,0x08,0x09,0x03,0x00,0x63,0x08,0x4b,0x7b,0x48,0x01,0x10,0xe6,0x05,
+0x10,0x28,0xe6,0x00,0x21,0x50,0x80,0x06,0x01,0x3e,0x80,0x80,0x38,0x06,0x01,0x04,
+0xa6,0x01,0x4f,0x08,0x03,0xc8,0xc4,0xa6,0x01,0x09,0x8b,0x08,0x01,0x92,0xa2,0x80,
+0x25,0x54,0x28,0x26,0x01,0x80,0x07,0x72,0x08,0x00,0x67,0x77,0x19,0x00,0xb9,0x01,
+0xf8,0x00,0x17,0x18,0x0b,0x81,0x43,0x08,0x09,0x00,0x27,0x18,0x09,0x00,0x04,0x71,
+0x09,0x52,0x02,0x00,0x32,0x09,0xf2,0x00,0x00,0x58,0x96,0x08,0x00,0x28,0x55,0x0c,
+0x80,0x53,0x17,0x08,0x00,0x07,0x71,0x3e,0x05,0x02,0xa6,0x00,0x00,0x04,0x00,0x11,
+0x02,0x24,0x00,0xf0,0x02,0x67,0x77,0x09,0x00,0x17,0x62,0x09,0x00,0x53,0x07,0x0c,
+0x80,0x19,0x83,0x09,0x00,0x02,0xfe,0x09,0x65,0x10,0x03,0x00,0x07,0x98,0x85,0x48,
+0x00,0xf1,0x04,0x69,0x97,0x09,0x00,0x29,0x75,0x0d,0x80,0x53,0x18,0x09,0x00,0x07,
+0x71,0x05,0x00,0x05,0x88,0x87,0xaa,0x05,0x11,0x0a,0x63,0x03,0x06,0x28,0x00,0xf1,
+0x00,0x68,0x87,0x09,0x00,0x2a,0x84,0x0d,0x80,0x53,0x08,0x09,0x00,0x07,0x72,0x07,
+0x14,0x04,0x00,0x34,0x05,0x13,0x09,0xae,0x05,0x08,0x28,0x00,0x31,0x19,0x84,0x0c,
+0x28,0x00,0x72,0x18,0x82,0x07,0x00,0x06,0x00,0x06,0xea,0x02,0x29,0x77,0x78,0x28,
+0x00,0x62,0x67,0x77,0x08,0x00,0x2a,0x83,0xc0,0x00,0xf0,0x01,0x08,0x82,0x08,0x00,
+0x00,0x77,0x71,0x00,0x06,0x40,0x18,0x00,0x06,0x50,0x38,0x00,0x2d,0x04,0xf5,0x08,
+0x07,0x70,0x60,0x65,0x77,0x58,0x08,0x04,0x50,0x80,0x82,0x75,0x48,0x58,0x43,0x17,
+0x82,0x82,0x86,0x48,0x08,0x02,0x30,0xfe,0x05,0x00,0x01,0x00,0xf6,0x10,0x57,0x16,
+0x07,0x47,0x87,0x91,0x80,0xa8,0x49,0x9a,0x26,0x08,0x91,0x80,0x77,0x16,0x08,0x00,
+0x18,0x87,0x00,0x09,0x00,0x27,0x00,0x92,0x05,0x60,0x00,0x67,0x40,0x6b,0x00,0xaf,
+0x0c,0x80,0x2a,0x83,0x09,0x00,0x53,0x17,0x0c,0x70,0x6b,0x00,0x01,0xf3,0x05,0x06,
+0x73,0x06,0x57,0x76,0x28,0x03,0x62,0x08,0x09,0x19,0x19,0x26,0x08,0x4b,0x08,0x09,
+0x08,0x03,0x72,0xf2,0x01,0x01,0xfe,0x09,0xf4,0x07,0x07,0x47,0x77,0x19,0x09,0x75,
+0x09,0x26,0x08,0x6c,0x07,0x64,0x08,0x01,0x88,0x87,0x04,0x50,0x09,0x03,0xa7,0x7b,
+0x84,0x00,0xf1,0x04,0x10,0x50,0x57,0x77,0x19,0x00,0xb9,0x50,0x80,0x26,0x08,0x7c,
+0x00,0x77,0x40,0x80,0x00,0x48,0x83,0x1d,0x07,0x60,0xa0,0x1a,0x00,0x02,0x77,0x20,
+0x23,0x00,0xf0,0x06,0x47,0x03,0x27,0x48,0x96,0x54,0x80,0xa6,0x7a,0x48,0x19,0x17,
+0x54,0x90,0x57,0x03,0x26,0x00,0x68,0x88,0x60,0x64,0x01,0x15,0x80,0x63,0x01,0xf8,
+0x0d,0x57,0x20,0x80,0x48,0x88,0x19,0x00,0x68,0x36,0xc0,0x17,0x09,0x08,0x00,0x91,
+0x87,0xc0,0x03,0x71,0x08,0x00,0x27,0x00,0x20,0x02,0xb7,0x78,0x10,0x87,0x00,0xf0,
+0x06,0x08,0x55,0x5c,0x16,0x08,0x6c,0x08,0x94,0x08,0x00,0x27,0x74,0x00,0x90,0x1a,
+0x01,0x90,0x1a,0x00,0x27,0x61,0xeb,0x00,0xf2,0x01,0x78,0x87,0x60,0x00,0x87,0x70,
+0x00,0x72,0x05,0x30,0x03,0x87,0x80,0x00,0x00,0x50,0xc8,0x0a,0x02,0x01,0x00,0xd0,
+0x17,0xa7,0x10,0x03,0x8b,0x83,0x00,0x27,0x08,0x10,0x00,0x98,0x80,0x67,0x03,0x00,
+0x75,0x00,0x61,0x35,0x55,0x90,0x0a,0x44,0x42,0x79,0x0a,0x04,0x23,0x00,0xf0,0x0a,
+0x73,0x00,0x37,0x09,0x10,0x01,0x97,0x90,0x05,0x66,0xb6,0x74,0x00,0x68,0x50,0x00,
+0x74,0x05,0x50,0x07,0x30,0x46,0x00,0x06,0x75,0x7d,0x00,0xd0,0x00,0x57,0x77,0x18,
+0x00,0x08,0x85,0x08,0x00,0x35,0x08,0x0a,0x81,0x2f,0x0c,0x20,0x00,0x40,0x89,0x03,
 0x06,0x8a,0x0e,0x01,0x8e,0x0e,0xf3,0x07,0x72,0x07,0x00,0x69,0x98,0x19,0x00,0x18,
 0x76,0x0a,0x30,0x28,0x77,0x09,0x20,0x34,0xa5,0x49,0x00,0x24,0x32,0x03,0xac,0x05,
-0x06,0x21,0x11,0xf5,0x10,0x03,0x83,0x07,0x00,0x58,0xa7,0x18,0x00,0x1a,0x57,0x08,
-0x00,0x29,0x28,0x0b,0x80,0x02,0xa2,0x19,0x00,0x58,0x76,0x28,0x00,0x06,0x20,0x01,
-0x00,0x06,0x98,0x86,0x50,0x00,0xf1,0x04,0x16,0x94,0x08,0x00,0x38,0xa5,0x08,0x00,
-0x36,0x08,0x0b,0x80,0x18,0x95,0x08,0x00,0x67,0xb7,0x38,0xa4,0x03,0x71,0x02,0x44,
-0x4a,0x00,0x0a,0x44,0x43,0xc1,0x05,0x01,0x78,0x00,0x00,0xc9,0x02,0x10,0x99,0x78,
-0x00,0xf1,0x02,0x09,0x00,0x28,0x77,0x0b,0x60,0x23,0x94,0x39,0x00,0x66,0x64,0x16,
-0x00,0x03,0x97,0x84,0x2d,0x11,0x00,0xf2,0x14,0xc0,0x06,0x72,0x07,0x57,0x77,0x18,
-0x08,0x85,0x08,0x35,0x08,0x08,0xc0,0x00,0x52,0x40,0x08,0x68,0xb8,0x68,0xbd,0x00,
-0x00,0x41,0x01,0x30,0x77,0x77,0x60,0xdc,0x13,0x10,0x71,0x41,0x01,0x91,0x90,0x00,
-0x16,0x06,0x00,0x69,0xb8,0xc8,0x50,0x22,0x0c,0x11,0x73,0x4c,0x04,0x91,0x29,0x88,
-0x00,0x06,0x20,0x62,0x00,0x07,0x75,0xa9,0x0f,0x06,0x22,0x0c,0xff,0x14,0x02,0x75,
-0x00,0x01,0x88,0x85,0x53,0x03,0x76,0x05,0x30,0x80,0x82,0x53,0x02,0x75,0x25,0x36,
-0x8c,0x74,0x53,0x02,0xb8,0x87,0x10,0x05,0x55,0x93,0x04,0x95,0x55,0x00,0x18,0x88,
-0x82,0x46,0x00,0x03,0x33,0x98,0x98,0x50,0x63,0x33,0x22,0x01,0x01,0xfd,0x2a,0xf0,
-0x1b,0x40,0x42,0x18,0x88,0x55,0x30,0x67,0x90,0x53,0x07,0x1a,0x15,0x30,0x16,0x32,
-0x53,0x58,0x87,0x45,0x30,0x63,0x00,0x00,0x05,0xa8,0x88,0x10,0x06,0x83,0x07,0x57,
-0x76,0x28,0x02,0x62,0x08,0x09,0x18,0x08,0x25,0x08,0x08,0x62,0x04,0x16,0x71,0xa3,
-0x02,0xf0,0x06,0x15,0xaa,0x00,0x02,0x7c,0xff,0xfe,0x00,0x0e,0xff,0xfe,0xbe,0x00,
-0x0e,0xd8,0x30,0x3e,0x00,0x0e,0x30,0x00,0x05,0x00,0xf3,0x00,0x01,0x6e,0x00,0x1e,
-0x30,0x4f,0xfe,0x0d,0xff,0x30,0x2d,0xf8,0x0d,0xfd,0x10,0x9f,0x1e,0xf0,0x31,0x75,
-0xcc,0xcc,0xc6,0x7c,0x8a,0x11,0x18,0xab,0xca,0x90,0x00,0x7b,0xc9,0x4f,0xcc,0xce,
-0x79,0xdb,0xa0,0x00,0x7c,0xda,0x59,0x00,0x07,0x7a,0xb9,0xfd,0xdd,0xea,0xb0,0x34,
-0x23,0x44,0x44,0x3f,0xf9,0xcf,0xff,0xff,0xef,0x8b,0xff,0xff,0xe7,0x84,0x68,0x88,
-0x87,0xff,0xad,0xff,0xff,0xf8,0x94,0x69,0x99,0x98,0xde,0x8a,0xee,0xee,0xdf,0x1b,
-0x00,0x50,0x45,0x23,0x55,0x55,0x40,0xaf,0x08,0xf0,0x0b,0x50,0x00,0x00,0x07,0xfd,
-0x23,0x00,0x07,0xfe,0x2d,0xf4,0x07,0xfe,0x20,0x5f,0xfa,0xfe,0x20,0x00,0x5f,0xfe,
-0x20,0x00,0x00,0x4d,0x20,0x0e,0x58,0xf5,0x58,0x02,0x0e,0xe2,0x0c,0xf1,0x5f,0xec,
-0xf8,0x00,0x6f,0xf9,0x00,0x0c,0xff,0xe2,0x0c,0xf8,0x5f,0xe0,0x98,0x00,0x5b,0x00,
-0x00,0x02,0xd2,0x00,0x00,0x7b,0x3f,0x3b,0x70,0x4f,0x73,0xf3,0x8f,0x4a,0xc0,0x3f,
-0x30,0xca,0xd9,0x03,0xf3,0x09,0xdb,0xb0,0x02,0x00,0xbc,0x6f,0x40,0x00,0x4f,0x60,
-0xbf,0xa7,0xaf,0xb0,0x00,0x7d,0xfd,0x70,0x00,0x00,0x06,0xb6,0x00,0x00,0x31,0xcf,
-0xc1,0x30,0x4f,0xff,0xff,0xff,0x47,0xff,0xb4,0xbf,0xf7,0x0d,0xf2,0x02,0xfd,0x04,
-0xff,0x70,0x7f,0xf4,0x6f,0xff,0xff,0xff,0x60,0x75,0xef,0xe5,0x70,0x00,0x08,0xf8,
-0x31,0x02,0x00,0x4a,0x01,0xf0,0x1a,0x2d,0xe3,0xd9,0x00,0x00,0x4e,0x97,0xff,0x90,
-0x00,0x6f,0x7b,0xc6,0xfb,0x00,0x9e,0x6d,0xff,0xe6,0xdb,0x07,0x4e,0xff,0xff,0xf5,
-0x80,0x05,0xff,0xa9,0xff,0x70,0x00,0x5f,0xf3,0x1f,0xf7,0x00,0x03,0xcc,0x20,0xcc,
-0x20,0x03,0x10,0x9c,0xc5,0x00,0x23,0xdf,0x60,0x05,0x00,0xf0,0x47,0x58,0xef,0xb7,
-0x10,0x00,0x4f,0xff,0xfc,0x00,0x00,0x04,0xff,0xc0,0x00,0x19,0xa9,0x7c,0x6a,0xa6,
-0x3f,0xff,0xfc,0xfe,0xec,0x2f,0xff,0xff,0xfc,0xbb,0x01,0xdf,0xff,0xfe,0x20,0x00,
-0xba,0x22,0x22,0x8c,0x00,0x5f,0x10,0x00,0x00,0xe7,0x0e,0xb6,0x30,0x02,0x6a,0xf0,
-0xff,0xfe,0x44,0xdf,0xff,0x2f,0xff,0xff,0xff,0xff,0xf2,0xcf,0xff,0xff,0xff,0xfe,
-0x00,0x00,0x5b,0xda,0x43,0xd0,0x9f,0xa7,0xaf,0xbf,0x5f,0x40,0x04,0x7f,0xf9,0x90,
-0x00,0xde,0xee,0x99,0x00,0xf1,0x02,0x0f,0xff,0xe0,0x00,0x9a,0xff,0x74,0x00,0x3f,
-0x5f,0xdf,0x85,0x8f,0xa0,0xf3,0x6c,0xfd,0x0e,0x40,0xf1,0x01,0x15,0xf8,0xff,0xff,
-0x8f,0xff,0xf8,0xff,0xff,0x84,0x59,0xf8,0x00,0x09,0x70,0x00,0x22,0x40,0xf2,0x02,
-0x05,0xf8,0x00,0xff,0xff,0x86,0x3f,0xff,0xf8,0x3a,0xff,0xff,0x88,0x64,0x5a,0xf8,
-0x00,0x1a,0x00,0x01,0xce,0x04,0xf1,0x18,0x10,0x00,0x00,0x55,0x01,0x4d,0x10,0x01,
-0x5f,0x80,0x89,0x59,0x0f,0xff,0xf8,0x73,0xb3,0xd0,0xff,0xff,0x83,0xa7,0x6c,0x1f,
-0xff,0xf8,0x86,0x94,0xd0,0x45,0x9f,0x80,0x5c,0x4b,0x00,0x00,0x97,0x03,0x2d,0x06,
-0x0a,0xf0,0x0e,0x40,0x00,0xbf,0xff,0xff,0xff,0xbf,0x45,0xff,0xff,0xff,0xf1,0x2f,
-0xfd,0x9f,0xff,0xec,0xfd,0x10,0x8f,0xfa,0x07,0x10,0x02,0xff,0x32,0x22,0x22,0x3f,
-0xac,0x00,0xf3,0x11,0xc0,0x00,0x58,0x00,0x00,0x0d,0xf1,0x00,0x05,0xff,0x80,0x01,
-0xef,0xff,0x20,0x9f,0xff,0xfc,0x0e,0xef,0xff,0xf1,0xe6,0xff,0xff,0x19,0xc6,0xdf,
-0xc0,0x09,0xff,0xb1,0xd8,0x0e,0xf3,0x2b,0xe5,0x00,0xaa,0xe5,0x0b,0xfb,0xe6,0xcf,
+0x23,0x09,0x00,0x3a,0x05,0xf5,0x11,0x00,0x03,0x83,0x07,0x00,0x58,0xa7,0x18,0x00,
+0x1a,0x57,0x08,0x00,0x29,0x28,0x0b,0x80,0x02,0xa2,0x19,0x00,0x58,0x76,0x28,0x00,
+0x06,0x20,0x01,0x00,0x06,0x98,0x86,0x50,0x00,0xf1,0x04,0x16,0x94,0x08,0x00,0x38,
+0xa5,0x08,0x00,0x36,0x08,0x0b,0x80,0x18,0x95,0x08,0x00,0x67,0xb7,0x38,0xa4,0x03,
+0x71,0x02,0x44,0x4a,0x00,0x0a,0x44,0x43,0xc1,0x05,0x01,0x78,0x00,0x00,0xc9,0x02,
+0x10,0x99,0x78,0x00,0xf0,0x17,0x09,0x00,0x28,0x77,0x0b,0x60,0x23,0x94,0x39,0x00,
+0x66,0x64,0x16,0x00,0x03,0x97,0x84,0x00,0x07,0x40,0x28,0x00,0x00,0x67,0x50,0x00,
+0x06,0x72,0x07,0x57,0x77,0x18,0x08,0x85,0x08,0x35,0x08,0x08,0xc0,0x00,0x52,0x40,
+0x08,0x68,0xb8,0x68,0xbd,0x00,0x00,0x41,0x01,0x80,0x77,0x77,0x60,0x00,0x77,0x70,
+0x00,0x71,0x41,0x01,0x91,0x90,0x00,0x16,0x06,0x00,0x69,0xb8,0xc8,0x50,0x22,0x0c,
+0x11,0x73,0x4c,0x04,0xc8,0x29,0x88,0x00,0x06,0x20,0x62,0x00,0x07,0x75,0x00,0x68,
+0x89,0x22,0x0c,0xff,0x14,0x02,0x75,0x00,0x01,0x88,0x85,0x53,0x03,0x76,0x05,0x30,
+0x80,0x82,0x53,0x02,0x75,0x25,0x36,0x8c,0x74,0x53,0x02,0xb8,0x87,0x10,0x05,0x55,
+0x93,0x04,0x95,0x55,0x00,0x18,0x88,0x82,0x46,0x00,0x03,0xd0,0x98,0x98,0x50,0x09,
+0x09,0x00,0x00,0x90,0x90,0x00,0x01,0x01,0x00,0xf0,0x1f,0x00,0x00,0x00,0x00,0x28,
+0x40,0x42,0x18,0x88,0x55,0x30,0x67,0x90,0x53,0x07,0x1a,0x15,0x30,0x16,0x32,0x53,
+0x58,0x87,0x45,0x30,0x63,0x00,0x00,0x05,0xa8,0x88,0x10,0x06,0x83,0x07,0x57,0x76,
+0x28,0x02,0x62,0x08,0x09,0x18,0x08,0x25,0x08,0x01,0x00,0x71,0x03,0x71,0x08,0x00,
+0x00,0x08,0x00,0x01,0x00,0xf0,0x06,0x15,0xaa,0x00,0x02,0x7c,0xff,0xfe,0x00,0x0e,
+0xff,0xfe,0xbe,0x00,0x0e,0xd8,0x30,0x3e,0x00,0x0e,0x30,0x00,0x05,0x00,0xf0,0x03,
+0x01,0x6e,0x00,0x1e,0x30,0x4f,0xfe,0x0d,0xff,0x30,0x2d,0xf8,0x0d,0xfd,0x10,0x00,
+0x00,0x00,0x04,0x00,0xf0,0x31,0x75,0xcc,0xcc,0xc6,0x7c,0x8a,0x11,0x18,0xab,0xca,
+0x90,0x00,0x7b,0xc9,0x4f,0xcc,0xce,0x79,0xdb,0xa0,0x00,0x7c,0xda,0x59,0x00,0x07,
+0x7a,0xb9,0xfd,0xdd,0xea,0xb0,0x34,0x23,0x44,0x44,0x3f,0xf9,0xcf,0xff,0xff,0xef,
+0x8b,0xff,0xff,0xe7,0x84,0x68,0x88,0x87,0xff,0xad,0xff,0xff,0xf8,0x94,0x69,0x99,
+0x98,0xde,0x8a,0xee,0xee,0xdf,0x1b,0x00,0xf4,0x80,0x45,0x23,0x55,0x55,0x40,0x00,
+0x00,0x00,0x07,0x50,0x00,0x00,0x07,0xfd,0x23,0x00,0x07,0xfe,0x2d,0xf4,0x07,0xfe,
+0x20,0x5f,0xfa,0xfe,0x20,0x00,0x5f,0xfe,0x20,0x00,0x00,0x4d,0x20,0x00,0x00,0x21,
+0x00,0x02,0x0e,0xe2,0x0c,0xf1,0x5f,0xec,0xf8,0x00,0x6f,0xf9,0x00,0x0c,0xff,0xe2,
+0x0c,0xf8,0x5f,0xe0,0x98,0x00,0x5b,0x00,0x00,0x02,0xd2,0x00,0x00,0x7b,0x3f,0x3b,
+0x70,0x4f,0x73,0xf3,0x8f,0x4a,0xc0,0x3f,0x30,0xca,0xd9,0x03,0xf3,0x09,0xdb,0xb0,
+0x02,0x00,0xbc,0x6f,0x40,0x00,0x4f,0x60,0xbf,0xa7,0xaf,0xb0,0x00,0x7d,0xfd,0x70,
+0x00,0x00,0x06,0xb6,0x00,0x00,0x31,0xcf,0xc1,0x30,0x4f,0xff,0xff,0xff,0x47,0xff,
+0xb4,0xbf,0xf7,0x0d,0xf2,0x02,0xfd,0x04,0xff,0x70,0x7f,0xf4,0x6f,0xff,0xff,0xff,
+0x60,0x75,0xef,0xe5,0x70,0x00,0x08,0xf8,0x00,0x01,0x00,0xf0,0x23,0x01,0x00,0x00,
+0x00,0x2d,0xe3,0xd9,0x00,0x00,0x4e,0x97,0xff,0x90,0x00,0x6f,0x7b,0xc6,0xfb,0x00,
+0x9e,0x6d,0xff,0xe6,0xdb,0x07,0x4e,0xff,0xff,0xf5,0x80,0x05,0xff,0xa9,0xff,0x70,
+0x00,0x5f,0xf3,0x1f,0xf7,0x00,0x03,0xcc,0x20,0xcc,0x50,0x00,0x00,0x00,0x9c,0xc5,
+0x00,0x23,0xdf,0x60,0x05,0x00,0xf0,0x47,0x58,0xef,0xb7,0x10,0x00,0x4f,0xff,0xfc,
+0x00,0x00,0x04,0xff,0xc0,0x00,0x19,0xa9,0x7c,0x6a,0xa6,0x3f,0xff,0xfc,0xfe,0xec,
+0x2f,0xff,0xff,0xfc,0xbb,0x01,0xdf,0xff,0xfe,0x20,0x00,0xba,0x22,0x22,0x8c,0x00,
+0x5f,0x10,0x00,0x00,0xe7,0x0e,0xb6,0x30,0x02,0x6a,0xf0,0xff,0xfe,0x44,0xdf,0xff,
+0x2f,0xff,0xff,0xff,0xff,0xf2,0xcf,0xff,0xff,0xff,0xfe,0x00,0x00,0x5b,0xda,0x43,
+0xd0,0x9f,0xa7,0xaf,0xbf,0x5f,0x40,0x04,0x7f,0xf9,0x90,0x00,0xde,0xee,0x99,0x00,
+0xf0,0x01,0x0f,0xff,0xe0,0x00,0x9a,0xff,0x74,0x00,0x3f,0x5f,0xdf,0x85,0x8f,0xa0,
+0xf3,0x6c,0xdc,0x00,0xf0,0x03,0x05,0x50,0x15,0xf8,0xff,0xff,0x8f,0xff,0xf8,0xff,
+0xff,0x84,0x59,0xf8,0x00,0x09,0x70,0x00,0x14,0x00,0xf2,0x03,0x00,0x05,0xf8,0x00,
+0xff,0xff,0x86,0x3f,0xff,0xf8,0x3a,0xff,0xff,0x88,0x64,0x5a,0xf8,0x00,0x1a,0x00,
+0x00,0x01,0x00,0xf0,0x3b,0x06,0x10,0x00,0x00,0x55,0x01,0x4d,0x10,0x01,0x5f,0x80,
+0x89,0x59,0x0f,0xff,0xf8,0x73,0xb3,0xd0,0xff,0xff,0x83,0xa7,0x6c,0x1f,0xff,0xf8,
+0x86,0x94,0xd0,0x45,0x9f,0x80,0x5c,0x4b,0x00,0x00,0x97,0x03,0x2d,0x30,0x00,0x00,
+0x00,0x08,0x40,0x00,0xbf,0xff,0xff,0xff,0xbf,0x45,0xff,0xff,0xff,0xf1,0x2f,0xfd,
+0x9f,0xff,0xec,0xfd,0x10,0x8f,0xfa,0x07,0x10,0x02,0xff,0x32,0x22,0x22,0x3f,0xac,
+0x00,0xf2,0x12,0xc0,0x00,0x58,0x00,0x00,0x0d,0xf1,0x00,0x05,0xff,0x80,0x01,0xef,
+0xff,0x20,0x9f,0xff,0xfc,0x0e,0xef,0xff,0xf1,0xe6,0xff,0xff,0x19,0xc6,0xdf,0xc0,
+0x09,0xff,0xb1,0x00,0x30,0x02,0xf3,0x2b,0xe5,0x00,0xaa,0xe5,0x0b,0xfb,0xe6,0xcf,
 0xfb,0xef,0xff,0xfb,0xed,0xff,0xfb,0xe5,0x8f,0xfb,0xe5,0x07,0xfb,0xb3,0x00,0x67,
 0xb9,0x10,0x00,0x00,0xff,0xe6,0x00,0x00,0xff,0xff,0xd3,0x00,0xff,0xff,0xff,0xa1,
 0xff,0xff,0xff,0xfc,0xff,0xff,0xff,0xd4,0xff,0xff,0xf8,0x00,0xff,0xfa,0x20,0x00,
 0xed,0x40,0x94,0x01,0xbd,0x10,0x01,0x10,0xdf,0xf4,0x5f,0xfc,0xff,0xf6,0x7f,0xfe,
 0x04,0x00,0xf0,0x00,0xf5,0x7f,0xfe,0x8c,0xb1,0x2b,0xc7,0x01,0x11,0x11,0x10,0xdf,
-0xff,0xff,0xfb,0x42,0x01,0x1e,0xff,0x04,0x00,0xf0,0x0f,0xfd,0x9c,0xcc,0xcc,0xc7,
+0xff,0xff,0xfb,0x42,0x01,0x1e,0xff,0x04,0x00,0xf0,0x14,0xfd,0x9c,0xcc,0xcc,0xc7,
 0x00,0x00,0x01,0xab,0x00,0x5e,0xbf,0xc0,0x5e,0xbf,0xfc,0x6e,0xbf,0xff,0xfe,0xbf,
-0xff,0xde,0xbf,0xf8,0x5e,0xbf,0x70,0x5e,0x76,0x26,0x3f,0x10,0x54,0x3c,0x01,0xe0,
-0xff,0x40,0x00,0x00,0x4f,0xff,0xf3,0x00,0x03,0xff,0xff,0xfe,0x20,0x0e,0xe2,0x00,
-0xf1,0x05,0x05,0x88,0x88,0x88,0x40,0x0d,0xee,0xee,0xee,0xb0,0x0f,0xff,0xff,0xff,
-0xd0,0x04,0x55,0x55,0x55,0x30,0x66,0x0b,0xf0,0x06,0xe0,0x00,0x7f,0x70,0x07,0xf7,
-0x00,0x5f,0x90,0x00,0x1c,0xe3,0x00,0x01,0xce,0x30,0x00,0x1c,0xe0,0x00,0x01,0x11,
-0x02,0x24,0x5e,0x20,0x12,0x00,0x14,0x1e,0x24,0x00,0x33,0x70,0x00,0x15,0x5b,0x02,
-0x60,0x0d,0xb0,0x00,0x00,0x0e,0xc0,0x04,0x00,0x00,0x17,0x3d,0x54,0xfc,0x8a,0xaf,
-0xea,0xa7,0x10,0x00,0x04,0xa5,0x01,0x01,0x18,0x00,0xf2,0x1c,0xaa,0xaa,0xa7,0x00,
-0x29,0xcc,0x93,0x00,0x00,0x7f,0x92,0x28,0xf8,0x00,0x6f,0xc0,0x4f,0x4a,0xf8,0x0e,
-0xf9,0x6e,0xfb,0x7f,0xf1,0x7f,0xb5,0xff,0x69,0xf9,0x00,0x9f,0x72,0x35,0xfb,0x00,
-0x00,0x5b,0xed,0xc5,0x00,0x00,0x0c,0xa5,0x05,0x40,0x5f,0x86,0xbc,0xb6,0xbb,0x02,
-0xf2,0x15,0xf6,0x13,0xdd,0x20,0x00,0x05,0x1b,0xde,0xb3,0xfe,0x10,0x06,0xf9,0x07,
-0xff,0x3f,0xf8,0x00,0x1e,0xf3,0x04,0xea,0xff,0x20,0x00,0x3e,0xd1,0x02,0xcf,0x60,
-0x00,0x00,0x18,0xdd,0x60,0x9e,0x57,0x01,0x24,0x6e,0x10,0xf4,0x02,0x11,0x09,0xe2,
-0x09,0x30,0x4f,0xf6,0x00,0xc5,0x02,0x10,0xfe,0x26,0x02,0xf0,0x0e,0xf6,0x4f,0x80,
-0x00,0x00,0x0e,0xf5,0x3f,0xf2,0x00,0x00,0x8f,0xf6,0x4f,0xfa,0x00,0x02,0xff,0xfa,
-0x9f,0xff,0x30,0x0b,0xff,0xf7,0x5f,0xff,0xc0,0x0e,0xab,0x02,0x70,0xf0,0x00,0x22,
-0x22,0x22,0x22,0x10,0x90,0x05,0xf0,0x13,0x02,0x31,0x00,0x16,0xf3,0xff,0xd1,0x2e,
-0xff,0xd3,0x4e,0x5d,0xd6,0xf3,0x00,0x1d,0xe1,0x03,0x00,0x0c,0xe5,0xa3,0xd1,0xff,
-0xf3,0x4f,0xff,0xd6,0x73,0x00,0x39,0xf6,0x00,0x00,0xfe,0x00,0xf0,0x14,0x06,0x50,
-0x00,0x00,0x6f,0xf5,0x00,0x06,0xf8,0xaf,0x50,0x6f,0x80,0x0a,0xf4,0x98,0x00,0x00,
-0xa8,0x65,0x00,0x00,0x65,0x9f,0x50,0x06,0xf7,0x0a,0xf5,0x6f,0x80,0x00,0xaf,0xf8,
-0x00,0x57,0x2a,0x03,0xab,0x06,0xf2,0x05,0xd2,0x02,0x22,0x21,0x00,0x4f,0xfe,0x3e,
-0xff,0xfe,0x00,0xa9,0xea,0x60,0x00,0x3e,0x00,0x03,0xe0,0x00,0x06,0x00,0x90,0x0a,
-0x9e,0xa5,0x03,0xfe,0xee,0xa5,0xff,0xe1,0xe0,0x3d,0x13,0x6e,0x03,0x3d,0xad,0x8c,
-0xcb,0x10,0x00,0x0f,0xff,0xfd,0xaa,0xa6,0xff,0x01,0x00,0x02,0xa7,0x02,0xf2,0x08,
-0x01,0xa1,0x00,0x00,0x00,0x1d,0xfd,0x10,0x00,0x01,0xdf,0xff,0xd1,0x00,0x03,0x9d,
-0xfd,0x93,0x00,0x00,0x0a,0xfa,0x00,0x05,0x00,0xf0,0x00,0x89,0x88,0xf8,0x89,0x91,
-0xff,0xfc,0xbc,0xee,0xf2,0xff,0xff,0xff,0xac,0xf2,0x11,0x01,0xb0,0xb7,0x00,0x00,
-0x00,0x2f,0xff,0x00,0x00,0x00,0x6f,0xfd,0x0f,0x00,0xf3,0x09,0xf9,0x00,0x00,0x00,
-0x0c,0xf3,0x00,0x14,0x00,0x9f,0x90,0x09,0xff,0x6b,0xfc,0x00,0x0d,0xff,0xff,0xa0,
-0x00,0x0a,0xff,0xa3,0x0f,0x05,0xf8,0x25,0x03,0x10,0x00,0x00,0xaf,0xe1,0x05,0xe9,
-0xf5,0xe4,0x6f,0xe2,0x7f,0xfd,0xfe,0x20,0x00,0xcf,0xf3,0x00,0x4d,0xff,0xf9,0x00,
-0xe7,0xe5,0xaf,0x90,0xe8,0xe3,0x0b,0xf8,0x3b,0x70,0x00,0x63,0x00,0xaf,0xfa,0x91,
-0x22,0xcf,0xfa,0x89,0xfb,0xcf,0xfe,0xa9,0xfb,0xcf,0xff,0xfe,0x04,0x00,0xf0,0x00,
-0xfd,0x57,0x77,0x75,0xff,0xff,0xfa,0x00,0x12,0x22,0x20,0x00,0x02,0x22,0x22,0x02,
-0x02,0x82,0x90,0xf2,0x00,0x05,0xf8,0xf2,0x00,0x05,0xc0,0x02,0xf0,0x00,0xf5,0x6f,
-0xfe,0xff,0xd0,0x0f,0xfe,0xff,0xf8,0x9f,0xfe,0x9c,0xcc,0xcc,0xc8,0x22,0x02,0x40,
-0x45,0x55,0x55,0x54,0xfb,0x00,0x00,0xdc,0x02,0x80,0x34,0x44,0x44,0x43,0x23,0x33,
-0x33,0x32,0x0c,0x00,0x90,0x11,0x11,0x11,0x10,0x8c,0xcc,0xcc,0xcc,0x8e,0x39,0x00,
-0xd1,0x5c,0xff,0xff,0xfc,0x5f,0x88,0xff,0xf8,0x8f,0xff,0xc5,0xa6,0xcf,0x1d,0x03,
-0x01,0x0f,0x01,0xf0,0x0c,0x06,0xff,0xc0,0x00,0x9f,0xf9,0x00,0x0b,0xff,0x62,0x00,
-0xdf,0xff,0xf7,0x0f,0xff,0xfe,0x10,0x11,0xaf,0x60,0x00,0x0d,0xd0,0x00,0x01,0xf4,
-0x6d,0x3e,0x00,0x01,0x00,0xf0,0x13,0x45,0xb9,0x52,0x00,0xff,0x8d,0xfa,0x00,0xff,
-0xd9,0x96,0x00,0xff,0x6e,0xe9,0x91,0xff,0x7f,0xfb,0x77,0xff,0x7f,0xff,0xed,0xff,
-0x7f,0xff,0xfe,0x45,0x4f,0xff,0xfe,0x00,0x2f,0xa9,0x04,0x03,0xbf,0x05,0xa0,0x8f,
-0xe7,0x00,0x08,0xff,0xff,0x60,0x0d,0xff,0xff,0x25,0x03,0xf1,0x01,0xd0,0x2f,0xff,
-0xff,0xf1,0xcf,0xff,0xff,0xfa,0x57,0x77,0x77,0x74,0x00,0x1e,0xd0,0x27,0x00,0x10,
-0xbf,0x9c,0x00,0xf4,0x0c,0x0f,0x4b,0x3a,0xa3,0xa3,0xf2,0xfa,0xd9,0xdd,0x9d,0x9f,
-0x2f,0xf0,0xa3,0x3a,0x0d,0xf2,0xfc,0xcb,0x9a,0xbc,0xcf,0x2f,0x4a,0x22,0x22,0xa2,
-0xfb,0x04,0x04,0x01,0x00,0x10,0x3a,0x85,0x10,0x90,0xbf,0xfd,0x00,0x00,0x5d,0xff,
-0xff,0x60,0x06,0x42,0x40,0x00,0x16,0x01,0x60,0xf7,0x00,0x01,0x33,0x3f,0xff,0x4b,
-0x03,0x10,0xff,0x2b,0x02,0x20,0x1f,0xf1,0x2b,0x00,0x14,0xe9,0x34,0x00,0xb2,0xde,
-0xed,0x63,0x0f,0xff,0xf8,0xf3,0xff,0xff,0x47,0x5f,0x49,0x04,0x19,0xcf,0x07,0x00,
-0xf0,0x0f,0xb1,0x22,0x22,0x20,0x00,0x00,0x24,0x31,0x00,0x00,0x02,0xaf,0xff,0xff,
-0xb4,0x00,0x7f,0xd7,0x31,0x25,0xbf,0xa0,0x98,0x01,0x57,0x62,0x05,0xc1,0x00,0x7f,
-0xd2,0x01,0x50,0x00,0xa9,0x10,0x07,0xc1,0x71,0x45,0x01,0x53,0x03,0x11,0x6f,0x6b,
-0x1c,0x00,0x3c,0x37,0x32,0x12,0x22,0x22,0x96,0x01,0xa0,0xff,0xff,0x90,0xf4,0x88,
-0x88,0x88,0x77,0xf2,0xf7,0x03,0x03,0xfc,0x03,0xe3,0xf5,0xaa,0xaa,0xaa,0x97,0xf3,
-0xee,0xee,0xee,0xee,0xef,0xb0,0x13,0x33,0x33,0x33,0x33,0x2a,0x00,0x20,0x82,0x07,
-0x2a,0x00,0x20,0xf4,0x00,0x2a,0x00,0x2f,0xa2,0x07,0x2a,0x00,0x08,0x20,0x84,0x00,
-0x2a,0x00,0x20,0xf9,0x00,0x2a,0x00,0x2f,0xa6,0x00,0x2a,0x00,0x08,0x20,0x87,0x00,
-0x2a,0x00,0x20,0xfe,0x00,0x2a,0x00,0x2f,0xa9,0x00,0x2a,0x00,0x08,0x20,0xf2,0x00,
-0x2a,0x00,0x20,0xf2,0x00,0x2a,0x00,0x02,0x0c,0x00,0x01,0x2a,0x00,0x11,0xa0,0x2a,
-0x00,0x00,0xf1,0x08,0x01,0xb1,0x3f,0x60,0xa8,0xf5,0x00,0x00,0x48,0x05,0xe6,0x37,
-0xb0,0xff,0xcd,0xaa,0xaa,0xad,0xd1,0x8c,0x20,0x37,0x00,0x06,0x60,0x18,0x11,0x4d,
-0xfd,0x00,0x24,0x7f,0xc0,0x5c,0x01,0xf0,0x14,0x7b,0xca,0x20,0x08,0xfe,0x6f,0xd0,
-0x0f,0xde,0x27,0xf4,0x2f,0x96,0x45,0xf6,0x3f,0xf7,0x1f,0xf7,0x3f,0xd3,0x28,0xf7,
-0x1f,0x8d,0x54,0xf5,0x0b,0xff,0x2e,0xf1,0x01,0xcf,0xee,0x50,0x0c,0x03,0xf6,0x04,
-0x56,0x9e,0xd8,0x64,0x9a,0xaa,0xaa,0xa8,0x5d,0xdd,0xdd,0xd4,0x7f,0xac,0xda,0xf5,
-0x7f,0x7a,0xc7,0x04,0x00,0x82,0x8a,0xc7,0xf5,0x4f,0xff,0xff,0xf3,0x01,0x38,0x04,
-0x20,0x08,0xa0,0x74,0x04,0xf2,0x05,0xfb,0x00,0x00,0x09,0xc7,0xfc,0x00,0x00,0x9f,
-0xfc,0x61,0x00,0x09,0xff,0xfc,0x10,0x00,0x9f,0xff,0xc1,0x09,0x00,0x84,0x0d,0xff,
-0xc1,0x00,0x00,0x0f,0xfc,0x10,0xd8,0x3a,0xfc,0x25,0x2b,0xcc,0xcc,0xcc,0xa0,0x03,
-0xef,0xfd,0xfe,0xef,0xf3,0x3e,0xff,0xe0,0x82,0x7f,0xf4,0xef,0xff,0xfb,0x03,0xff,
-0xf4,0x6f,0xff,0xf2,0x40,0x9f,0xf4,0x06,0xff,0xf9,0xfc,0xbf,0xf3,0x00,0x5f,0xff,
-0xff,0xff,0xe1,0x03,0xef,0xff,0x63,0xe5,0x7a,0x7b,0xff,0x36,0x96,0xcf,0x07,0x02,
-0x85,0xfb,0xcf,0xff,0xff,0x80,0x12,0x22,0x10,0xed,0x07,0xb0,0xc0,0x04,0xc0,0x00,
-0x05,0xf0,0x5f,0xe7,0x77,0x7a,0xf0,0x81,0x02,0x32,0xe0,0x0c,0xd0,0xa1,0x3a,0x0b,
-0x01,0x00,0x2f,0xfd,0x00,0x01,0x00,0x03,0x1b,0xf8,0x08,0x00,0x00,0x01,0x00,0x73,
-0xfc,0xfc,0x00,0xff,0xfc,0x00,0xfa,0xf0,0x05,0x0b,0x01,0x00,0x00,0xaa,0x09,0x1e,
-0x02,0x16,0x00,0x2f,0xf4,0x00,0x01,0x00,0x15,0x1e,0xf0,0x1e,0x00,0x0e,0x90,0x00,
-0xb2,0xfc,0x00,0xff,0x00,0x00,0xf7,0xff,0xfa,0xfb,0x00,0xf9,0x11,0x00,0x10,0xff,
-0x28,0x04,0x2d,0xfc,0xfe,0x92,0x00,0x30,0xfe,0x00,0xfe,0x2e,0x00,0x1e,0x00,0x01,
-0x00,0x1c,0xfe,0x0a,0x00,0x19,0xff,0x1f,0x00,0x03,0x0e,0x00,0x13,0xf9,0x0b,0x00,
-0x10,0xfe,0x02,0x00,0x2f,0xfd,0xfe,0x9c,0x00,0x0a,0x15,0x01,0x3c,0x00,0x11,0xff,
-0x34,0x00,0x39,0xff,0xfe,0xfe,0xd6,0x00,0x35,0xf4,0x00,0xed,0x24,0x00,0x40,0xfe,
-0xff,0x00,0x00,0x0e,0x04,0x2e,0xfe,0xfe,0x44,0x00,0x10,0xfe,0x08,0x00,0x0f,0x6b,
-0x00,0x08,0x1f,0xfe,0x43,0x01,0x0d,0x1b,0xfc,0x25,0x00,0x12,0xfe,0x67,0x00,0x22,
-0xfe,0xfd,0x09,0x01,0x14,0xe8,0x6c,0x00,0x97,0xfb,0x00,0x00,0xed,0xfc,0xf4,0xf6,
-0x00,0xef,0x08,0x02,0x25,0xf7,0xfa,0x0c,0x00,0x00,0x77,0x04,0x35,0xf6,0x00,0xf2,
-0x48,0x01,0x21,0xff,0xff,0x0c,0x01,0x1f,0x01,0xf7,0x01,0x01,0x10,0xfd,0xd2,0x00,
-0x0f,0x99,0x00,0x0c,0x3e,0xfa,0x00,0xff,0x69,0x02,0x03,0x12,0x00,0xb1,0xf1,0xf0,
-0x00,0x00,0xfa,0xfe,0xef,0xff,0x01,0x00,0x01,0x60,0x00,0xd3,0xf8,0xf9,0x00,0xf8,
-0xf9,0xfb,0xf8,0x00,0xf9,0xfb,0xfc,0xfb,0xfc,0x1a,0x01,0x66,0xf0,0xfd,0x00,0x00,
-0xfb,0xff,0x2b,0x01,0x50,0xfd,0xfd,0x00,0x00,0xfd,0x44,0x01,0x01,0x30,0x05,0x02,
-0x24,0x00,0x22,0xf7,0xfc,0x51,0x00,0x13,0x01,0x24,0x00,0x23,0xfe,0xfe,0x6c,0x01,
-0x08,0xa1,0x01,0x14,0xfd,0x20,0x01,0x15,0x01,0x51,0x01,0x02,0xb0,0x01,0x04,0x30,
-0x01,0xe0,0x01,0xfd,0xf1,0xfc,0x00,0x00,0xf9,0xfe,0xf9,0xff,0x01,0xf9,0x01,0x01,
-0x92,0x00,0xe6,0xfb,0xfb,0xfe,0xfd,0xfb,0xfd,0xfc,0xfe,0xfd,0xff,0x00,0xfe,0xfe,
-0x01,0xc5,0x00,0x2a,0x01,0xfe,0x34,0x02,0x0c,0xf8,0x01,0x09,0x19,0x00,0x1e,0x00,
-0x01,0x00,0x1f,0xfb,0x31,0x01,0x09,0x1f,0xff,0xf0,0x01,0x10,0x11,0xff,0x97,0x01,
-0x0e,0x5f,0x00,0x0f,0x4f,0x00,0x07,0x0f,0x1d,0x00,0x0a,0x1e,0x01,0xdd,0x01,0x19,
-0x01,0x81,0x00,0x12,0x01,0x14,0x03,0x0f,0x01,0x00,0x22,0x0b,0x81,0x00,0x1f,0xf6,
-0xd8,0x00,0x10,0x00,0x8e,0x00,0x1c,0xf7,0x31,0x02,0x20,0xff,0x01,0x4b,0x00,0x14,
-0x04,0x15,0x0e,0x0f,0x6f,0x00,0x11,0x1b,0x01,0xc4,0x04,0x02,0xa7,0x03,0x1d,0x01,
-0x14,0x01,0x1f,0xf7,0xd8,0x00,0x24,0x1f,0xff,0x24,0x00,0x26,0x0f,0x3d,0x00,0x07,
-0x03,0x49,0x05,0x21,0x02,0x03,0x0f,0x15,0x2d,0x04,0x05,0x21,0x00,0xf1,0x0c,0x06,
-0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,
-0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0x80,0x1a,0x1b,0x1c,
-0x00,0x1d,0x1e,0x00,0x1f,0xf5,0x34,0xe0,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,
-0x00,0x24,0x25,0x26,0x24,0x27,0xaa,0x1d,0x0f,0x01,0x00,0xff,0xfe,0x08,0x75,0x02,
-0x20,0x03,0x02,0x70,0x02,0x4a,0x06,0x07,0x06,0x08,0x1f,0x00,0x00,0x7b,0x1a,0x40,
-0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xa0,0x0b,0x00,0x0d,0x0e,
-0x0f,0x10,0x11,0x12,0x13,0x14,0x06,0x0d,0x00,0x6f,0x4b,0x52,0x17,0x17,0x17,0x18,
-0x17,0x2c,0x49,0xff,0x01,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,
-0x1f,0x22,0x00,0x00,0x23,0x73,0x00,0x02,0x1f,0x24,0x6f,0x02,0xff,0xe9,0x50,0x00,
-0x00,0x00,0x00,0x00,
+0xff,0xde,0xbf,0xf8,0x5e,0xbf,0x70,0x5e,0x76,0x00,0x3b,0x00,0x00,0x54,0x3c,0x01,
+0xe0,0xff,0x40,0x00,0x00,0x4f,0xff,0xf3,0x00,0x03,0xff,0xff,0xfe,0x20,0x0e,0xe2,
+0x00,0xf0,0x06,0x05,0x88,0x88,0x88,0x40,0x0d,0xee,0xee,0xee,0xb0,0x0f,0xff,0xff,
+0xff,0xd0,0x04,0x55,0x55,0x55,0x30,0x00,0xb7,0x02,0xf0,0x06,0xe0,0x00,0x7f,0x70,
+0x07,0xf7,0x00,0x5f,0x90,0x00,0x1c,0xe3,0x00,0x01,0xce,0x30,0x00,0x1c,0xe0,0x00,
+0x01,0x11,0x02,0x24,0x5e,0x20,0x12,0x00,0x14,0x1e,0x24,0x00,0x33,0x70,0x00,0x15,
+0x5b,0x02,0x61,0x0d,0xb0,0x00,0x00,0x0e,0xc0,0x04,0x00,0x84,0xef,0xff,0xff,0xfc,
+0x8a,0xaf,0xea,0xa7,0x10,0x00,0x04,0xa5,0x01,0x01,0x18,0x00,0xf1,0x1d,0xaa,0xaa,
+0xa7,0x00,0x29,0xcc,0x93,0x00,0x00,0x7f,0x92,0x28,0xf8,0x00,0x6f,0xc0,0x4f,0x4a,
+0xf8,0x0e,0xf9,0x6e,0xfb,0x7f,0xf1,0x7f,0xb5,0xff,0x69,0xf9,0x00,0x9f,0x72,0x35,
+0xfb,0x00,0x00,0x5b,0xed,0xc5,0x00,0x00,0x0c,0x50,0x36,0x00,0x40,0x5f,0x86,0xbc,
+0xb6,0xbb,0x02,0xf2,0x15,0xf6,0x13,0xdd,0x20,0x00,0x05,0x1b,0xde,0xb3,0xfe,0x10,
+0x06,0xf9,0x07,0xff,0x3f,0xf8,0x00,0x1e,0xf3,0x04,0xea,0xff,0x20,0x00,0x3e,0xd1,
+0x02,0xcf,0x60,0x00,0x00,0x18,0xdd,0x60,0x9e,0x57,0x01,0x24,0x6e,0x10,0xf4,0x02,
+0x20,0x09,0xb0,0x06,0x00,0x30,0x4f,0xf6,0x00,0xc5,0x02,0x10,0xfe,0x26,0x02,0xf0,
+0x0e,0xf6,0x4f,0x80,0x00,0x00,0x0e,0xf5,0x3f,0xf2,0x00,0x00,0x8f,0xf6,0x4f,0xfa,
+0x00,0x02,0xff,0xfa,0x9f,0xff,0x30,0x0b,0xff,0xf7,0x5f,0xff,0xc0,0x0e,0xab,0x02,
+0x60,0xf0,0x00,0x22,0x22,0x22,0x22,0x42,0x00,0xf0,0x14,0x02,0x02,0x31,0x00,0x16,
+0xf3,0xff,0xd1,0x2e,0xff,0xd3,0x4e,0x5d,0xd6,0xf3,0x00,0x1d,0xe1,0x03,0x00,0x0c,
+0xe5,0xa3,0xd1,0xff,0xf3,0x4f,0xff,0xd6,0x73,0x00,0x39,0xf6,0x00,0x00,0xfe,0x00,
+0xf3,0x17,0x06,0x50,0x00,0x00,0x6f,0xf5,0x00,0x06,0xf8,0xaf,0x50,0x6f,0x80,0x0a,
+0xf4,0x98,0x00,0x00,0xa8,0x65,0x00,0x00,0x65,0x9f,0x50,0x06,0xf7,0x0a,0xf5,0x6f,
+0x80,0x00,0xaf,0xf8,0x00,0x00,0x0a,0x80,0x91,0x00,0xf2,0x06,0x05,0xd2,0x02,0x22,
+0x21,0x00,0x4f,0xfe,0x3e,0xff,0xfe,0x00,0xa9,0xea,0x60,0x00,0x3e,0x00,0x03,0xe0,
+0x00,0x06,0x00,0xf2,0x00,0x0a,0x9e,0xa5,0x03,0xfe,0xee,0xa5,0xff,0xe1,0x00,0x33,
+0x33,0x20,0x6e,0x20,0x30,0x00,0xad,0x8c,0xcb,0x10,0x00,0x0f,0xff,0xfd,0xaa,0xa6,
+0xff,0x01,0x00,0x02,0xa7,0x02,0xf2,0x08,0x01,0xa1,0x00,0x00,0x00,0x1d,0xfd,0x10,
+0x00,0x01,0xdf,0xff,0xd1,0x00,0x03,0x9d,0xfd,0x93,0x00,0x00,0x0a,0xfa,0x00,0x05,
+0x00,0xf0,0x00,0x89,0x88,0xf8,0x89,0x91,0xff,0xfc,0xbc,0xee,0xf2,0xff,0xff,0xff,
+0xac,0xf2,0x11,0x01,0xb0,0xb7,0x00,0x00,0x00,0x2f,0xff,0x00,0x00,0x00,0x6f,0xfd,
+0x0f,0x00,0xf3,0x09,0xf9,0x00,0x00,0x00,0x0c,0xf3,0x00,0x14,0x00,0x9f,0x90,0x09,
+0xff,0x6b,0xfc,0x00,0x0d,0xff,0xff,0xa0,0x00,0x0a,0xff,0xa3,0x0f,0x05,0xf8,0x25,
+0x03,0x10,0x00,0x00,0xaf,0xe1,0x05,0xe9,0xf5,0xe4,0x6f,0xe2,0x7f,0xfd,0xfe,0x20,
+0x00,0xcf,0xf3,0x00,0x4d,0xff,0xf9,0x00,0xe7,0xe5,0xaf,0x90,0xe8,0xe3,0x0b,0xf8,
+0x3b,0x70,0x00,0x63,0x00,0xaf,0xfa,0x91,0x22,0xcf,0xfa,0x89,0xfb,0xcf,0xfe,0xa9,
+0xfb,0xcf,0xff,0xfe,0x04,0x00,0xf0,0x00,0xfd,0x57,0x77,0x75,0xff,0xff,0xfa,0x00,
+0x12,0x22,0x20,0x00,0x02,0x22,0x22,0x02,0x02,0x82,0x90,0xf2,0x00,0x05,0xf8,0xf2,
+0x00,0x05,0xc0,0x02,0xf0,0x00,0xf5,0x6f,0xfe,0xff,0xd0,0x0f,0xfe,0xff,0xf8,0x9f,
+0xfe,0x9c,0xcc,0xcc,0xc8,0x22,0x02,0x40,0x45,0x55,0x55,0x54,0xfb,0x00,0x00,0xdc,
+0x02,0x80,0x34,0x44,0x44,0x43,0x23,0x33,0x33,0x32,0x0c,0x00,0x90,0x11,0x11,0x11,
+0x10,0x8c,0xcc,0xcc,0xcc,0x8e,0x39,0x00,0xd1,0x5c,0xff,0xff,0xfc,0x5f,0x88,0xff,
+0xf8,0x8f,0xff,0xc5,0xa6,0xcf,0x1d,0x03,0x01,0x0f,0x01,0xf1,0x0f,0x06,0xff,0xc0,
+0x00,0x9f,0xf9,0x00,0x0b,0xff,0x62,0x00,0xdf,0xff,0xf7,0x0f,0xff,0xfe,0x10,0x11,
+0xaf,0x60,0x00,0x0d,0xd0,0x00,0x01,0xf4,0x00,0x00,0x3a,0x52,0x01,0xf0,0x13,0x45,
+0xb9,0x52,0x00,0xff,0x8d,0xfa,0x00,0xff,0xd9,0x96,0x00,0xff,0x6e,0xe9,0x91,0xff,
+0x7f,0xfb,0x77,0xff,0x7f,0xff,0xed,0xff,0x7f,0xff,0xfe,0x45,0x4f,0xff,0xfe,0x00,
+0x2f,0xa9,0x04,0x03,0xbf,0x05,0xa0,0x8f,0xe7,0x00,0x08,0xff,0xff,0x60,0x0d,0xff,
+0xff,0x25,0x03,0xf1,0x01,0xd0,0x2f,0xff,0xff,0xf1,0xcf,0xff,0xff,0xfa,0x57,0x77,
+0x77,0x74,0x00,0x1e,0xd0,0x27,0x00,0x10,0xbf,0x9c,0x00,0xf4,0x0c,0x0f,0x4b,0x3a,
+0xa3,0xa3,0xf2,0xfa,0xd9,0xdd,0x9d,0x9f,0x2f,0xf0,0xa3,0x3a,0x0d,0xf2,0xfc,0xcb,
+0x9a,0xbc,0xcf,0x2f,0x4a,0x22,0x22,0xa2,0xfb,0x04,0x04,0x01,0x00,0xf0,0x03,0x3a,
+0xa0,0x00,0x00,0x04,0xbf,0xfd,0x00,0x00,0x5d,0xff,0xff,0x60,0x06,0xef,0xff,0xff,
+0xe0,0x16,0x01,0x60,0xf7,0x00,0x01,0x33,0x3f,0xff,0x4b,0x03,0x10,0xff,0x2b,0x02,
+0x20,0x1f,0xf1,0x2b,0x00,0x14,0xe9,0x34,0x00,0xb2,0xde,0xed,0x63,0x0f,0xff,0xf8,
+0xf3,0xff,0xff,0x47,0x5f,0x49,0x04,0x19,0xcf,0x07,0x00,0xf0,0x0f,0xb1,0x22,0x22,
+0x20,0x00,0x00,0x24,0x31,0x00,0x00,0x02,0xaf,0xff,0xff,0xb4,0x00,0x7f,0xd7,0x31,
+0x25,0xbf,0xa0,0x98,0x01,0x57,0x62,0x05,0xc1,0x00,0x7f,0xd2,0x01,0x91,0x00,0xa9,
+0x10,0x07,0xc1,0x00,0x00,0x00,0x3c,0x53,0x03,0x21,0x6f,0xa0,0x8b,0x02,0x62,0x10,
+0x00,0x00,0x12,0x22,0x22,0x96,0x01,0xa0,0xff,0xff,0x90,0xf4,0x88,0x88,0x88,0x77,
+0xf2,0xf7,0x03,0x03,0xfc,0x03,0xe3,0xf5,0xaa,0xaa,0xaa,0x97,0xf3,0xee,0xee,0xee,
+0xee,0xef,0xb0,0x13,0x33,0x33,0x33,0x33,0x2a,0x00,0x20,0x82,0x07,0x2a,0x00,0x20,
+0xf4,0x00,0x2a,0x00,0x2f,0xa2,0x07,0x2a,0x00,0x08,0x20,0x84,0x00,0x2a,0x00,0x20,
+0xf9,0x00,0x2a,0x00,0x2f,0xa6,0x00,0x2a,0x00,0x08,0x20,0x87,0x00,0x2a,0x00,0x20,
+0xfe,0x00,0x2a,0x00,0x2f,0xa9,0x00,0x2a,0x00,0x08,0x20,0xf2,0x00,0x2a,0x00,0x20,
+0xf2,0x00,0x2a,0x00,0x02,0x0c,0x00,0x01,0x2a,0x00,0x12,0xa0,0x2a,0x00,0x40,0x00,
+0x00,0x04,0xb3,0x1b,0x00,0xf1,0x0b,0xa8,0xf5,0x00,0x00,0x48,0x05,0x50,0x00,0x03,
+0x00,0xff,0xcd,0xaa,0xaa,0xad,0xd1,0x8c,0x20,0x37,0x00,0x06,0x30,0x00,0x00,0x09,
+0x4d,0xfd,0x00,0x24,0x7f,0xc0,0x5c,0x01,0xf0,0x14,0x7b,0xca,0x20,0x08,0xfe,0x6f,
+0xd0,0x0f,0xde,0x27,0xf4,0x2f,0x96,0x45,0xf6,0x3f,0xf7,0x1f,0xf7,0x3f,0xd3,0x28,
+0xf7,0x1f,0x8d,0x54,0xf5,0x0b,0xff,0x2e,0xf1,0x01,0xcf,0xee,0x50,0x0c,0x03,0xf6,
+0x04,0x56,0x9e,0xd8,0x64,0x9a,0xaa,0xaa,0xa8,0x5d,0xdd,0xdd,0xd4,0x7f,0xac,0xda,
+0xf5,0x7f,0x7a,0xc7,0x04,0x00,0x82,0x8a,0xc7,0xf5,0x4f,0xff,0xff,0xf3,0x01,0x38,
+0x04,0x20,0x08,0xa0,0x74,0x04,0xf2,0x05,0xfb,0x00,0x00,0x09,0xc7,0xfc,0x00,0x00,
+0x9f,0xfc,0x61,0x00,0x09,0xff,0xfc,0x10,0x00,0x9f,0xff,0xc1,0x09,0x00,0x82,0x0d,
+0xff,0xc1,0x00,0x00,0x0f,0xfc,0x10,0x38,0x05,0xfc,0x27,0x00,0x00,0x2b,0xcc,0xcc,
+0xcc,0xa0,0x03,0xef,0xfd,0xfe,0xef,0xf3,0x3e,0xff,0xe0,0x82,0x7f,0xf4,0xef,0xff,
+0xfb,0x03,0xff,0xf4,0x6f,0xff,0xf2,0x40,0x9f,0xf4,0x06,0xff,0xf9,0xfc,0xbf,0xf3,
+0x00,0x5f,0xff,0xff,0xff,0xe1,0x03,0xef,0xff,0x63,0xe5,0x7a,0x7b,0xff,0x36,0x96,
+0xcf,0x07,0x02,0x85,0xfb,0xcf,0xff,0xff,0x80,0x12,0x22,0x10,0xed,0x07,0xb0,0xc0,
+0x04,0xc0,0x00,0x05,0xf0,0x5f,0xe7,0x77,0x7a,0xf0,0x81,0x02,0xb0,0xe0,0x0c,0xd0,
+0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,
+};
+
+static const etxFontBlock blocks[] = {
+{ .bitmap_index = 0, .comp_offset = 0, .size = 4076, .comp_size = 3556 },
+{ .bitmap_index = 4076, .comp_offset = 3556, .size = 4092, .comp_size = 3127 },
+{ .bitmap_index = 8168, .comp_offset = 6683, .size = 4065, .comp_size = 3290 },
+{ .bitmap_index = 12233, .comp_offset = 9973, .size = 4075, .comp_size = 3364 },
+{ .bitmap_index = 16308, .comp_offset = 13337, .size = 2384, .comp_size = 2063 },
 };
 
 static const etxFontCmap cmaps[] = {
@@ -1208,11 +1287,11 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 63475, .glyph_id_start = 115, .list_length = 514, .type = 3, .unicode_list = 5032, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[27714] __SDRAMFONTS;
+static uint8_t etxUncompBuf[9022] __SDRAMFONTS;
 
 const etxLz4Font lv_font_ko_XXS = {
-.uncomp_size = 27450,
-.comp_size = 19140,
+.uncomp_size = 8758,
+.comp_size = 4817,
 .line_height = 12,
 .base_line = 3,
 .subpx = 0,
@@ -1225,12 +1304,15 @@ const etxLz4Font lv_font_ko_XXS = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 6060,
-.class_pair_values = 24752,
-.left_class_mapping = 26192,
-.right_class_mapping = 26821,
+.glyph_bitmap = 0,
+.class_pair_values = 6060,
+.left_class_mapping = 7500,
+.right_class_mapping = 8129,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 27714,
+.lvglFontBufSize = 9022,
+.block_count = 5,
+.blocks = blocks,
+.compressed_bitmap = lz4BitmapData,
 };
@@ -210,7 +210,7 @@ static const uint8_t lz4FontData[] ={
 0x08,0x00,0x13,0x81,0x08,0x00,0x13,0xe5,0x08,0x00,0x22,0x49,0xd3,0x08,0x00,0xf2,
 0x03,0xad,0xd3,0x00,0x14,0x15,0x0e,0x00,0xff,0x40,0xd4,0x00,0x0e,0x0c,0x10,0x01,
 0xfe,0xa0,0xd4,0x60,0x00,0x21,0x10,0xd5,0xa8,0x00,0xb2,0xfd,0xa1,0xd5,0x00,0x14,
-0x14,0x0c,0x00,0x00,0x19,0xd6,0x60,0x00,0xf0,0xff,0xff,0xff,0xff,0xcd,0x79,0xd6,
+0x14,0x0c,0x00,0x00,0x19,0xd6,0x60,0x00,0xf8,0xff,0xff,0xff,0xff,0x02,0x79,0xd6,
 0x20,0x10,0x11,0x0b,0x00,0x01,0x00,0x00,0x72,0x1f,0xb5,0x21,0x50,0xab,0x54,0xab,
 0x58,0xab,0x60,0xab,0x62,0xab,0x65,0xab,0x69,0xab,0x6c,0xab,0x81,0xab,0xc0,0xab,
 0xc4,0xab,0xd0,0xab,0xdc,0xab,0xf0,0xab,0xf8,0xab,0xf9,0xab,0x00,0xac,0x0d,0xac,
@@ -275,558 +275,616 @@ static const uint8_t lz4FontData[] ={
 0xc8,0xef,0xc9,0xef,0xcb,0xef,0xe3,0xef,0xe5,0xef,0x14,0xf0,0x15,0xf0,0x17,0xf0,
 0x19,0xf0,0x30,0xf0,0x37,0xf0,0x3a,0xf0,0x43,0xf0,0x6c,0xf0,0x74,0xf0,0xab,0xf0,
 0x3b,0xf1,0x90,0xf1,0x91,0xf1,0x92,0xf1,0x93,0xf1,0x94,0xf1,0xd7,0xf1,0xe3,0xf1,
-0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x0f,0xf6,0x0e,0xf6,0x0e,0xf5,
-0x0d,0xf5,0x0d,0xf4,0x0c,0xf4,0x0c,0xf3,0x0b,0xf3,0x02,0x30,0x03,0x60,0x0f,0xf6,
-0x0b,0xe3,0x8f,0x1f,0xa8,0xf0,0xf9,0x8f,0x0f,0x78,0xd0,0xf6,0x36,0x07,0x20,0x00,
-0x06,0xf0,0x7f,0x00,0x00,0x09,0xd0,0xac,0x00,0x00,0x0c,0xa0,0xd9,0x00,0x0e,0xff,
-0xff,0xff,0xf3,0x06,0x8f,0x98,0xf8,0x61,0x00,0x4f,0x25,0xf1,0x00,0x01,0x7f,0x28,
-0xf1,0x10,0x8f,0xff,0xff,0xff,0xa0,0x24,0xdc,0x4e,0xb4,0x20,0x00,0xe8,0x0f,0x70,
-0x00,0x00,0xf5,0x1f,0x40,0x00,0x03,0xf3,0x4f,0x20,0x00,0x00,0x00,0x74,0x00,0x00,
-0x00,0x0c,0x70,0x00,0x00,0x3a,0xfe,0x70,0x00,0x3f,0xff,0xff,0xa0,0x0a,0xfb,0x05,
-0xff,0x20,0xcf,0x70,0x0d,0xf5,0x0a,0xfc,0x10,0x00,0x00,0x3f,0xff,0x91,0x00,0x00,
-0x3c,0xff,0xf4,0x00,0x00,0x03,0xcf,0xf1,0x18,0x70,0x00,0xef,0x52,0xff,0x30,0x0e,
-0xf5,0x0c,0xfe,0x8b,0xff,0x20,0x2d,0xff,0xff,0x60,0x00,0x03,0xf8,0x10,0x00,0x00,
-0x0e,0x50,0x00,0x05,0xdf,0xa0,0x00,0x00,0x00,0x1f,0xb7,0xf7,0x01,0x80,0x00,0x3f,
-0x40,0xda,0x0a,0xc0,0x00,0x2f,0x82,0xf9,0x3f,0x30,0x00,0x09,0xff,0xe2,0xd9,0x00,
-0x00,0x00,0x23,0x07,0xe1,0x00,0x20,0x00,0x10,0x60,0x06,0x00,0xf1,0x56,0xac,0x2c,
-0xfe,0x50,0x00,0x04,0xf3,0xae,0x5b,0xf0,0x00,0x0d,0x90,0xcb,0x06,0xf1,0x00,0x2c,
-0x10,0xae,0x6c,0xf0,0x00,0x00,0x00,0x1b,0xfd,0x40,0x00,0x3c,0xfd,0x50,0x00,0x00,
-0x1e,0xff,0xff,0x30,0x00,0x05,0xfb,0x08,0xf7,0x00,0x00,0x6f,0xa0,0x8f,0x60,0x00,
-0x02,0xff,0xaf,0xd0,0x00,0x00,0x09,0xff,0xb1,0x00,0x00,0x05,0xff,0xfc,0x04,0xd8,
-0x02,0xff,0x6e,0xf9,0x7f,0x80,0x6f,0xe0,0x3f,0xff,0xf4,0x05,0xff,0x10,0x6f,0xfd,
-0x00,0x0d,0xfe,0xcf,0xff,0xe2,0x00,0x19,0xef,0xd8,0xaf,0xd0,0x8f,0x28,0xf2,0x8f,
-0x18,0xf0,0x47,0xd9,0x18,0xf1,0x07,0x03,0xe1,0x00,0x1e,0xd1,0x00,0xaf,0x20,0x02,
-0xfa,0x00,0x08,0xf5,0x00,0x0b,0xf2,0x00,0x0e,0xf0,0x00,0x0f,0xe0,0x03,0x00,0xf0,
-0x36,0xf0,0x00,0x0d,0xf0,0x00,0x0a,0xf3,0x00,0x05,0xf7,0x00,0x00,0xee,0x00,0x00,
-0x6f,0x70,0x00,0x09,0xf2,0x00,0x00,0x70,0x00,0x00,0x07,0xb0,0x00,0x4f,0xa0,0x00,
-0x8f,0x50,0x01,0xfd,0x00,0x0c,0xf3,0x00,0x8f,0x70,0x06,0xfa,0x00,0x5f,0xb0,0x04,
-0xfc,0x00,0x5f,0xa0,0x06,0xf8,0x00,0x9f,0x50,0x0d,0xf0,0x04,0xf9,0x00,0xcf,0x10,
-0x8f,0x40,0x04,0x30,0x00,0x00,0x4b,0x01,0xf1,0x08,0x0f,0x60,0x00,0x8d,0x6e,0x89,
-0xd0,0x5b,0xff,0xfe,0x90,0x00,0xaf,0xe1,0x00,0x07,0xf4,0xeb,0x00,0x09,0x90,0x6d,
-0x10,0x80,0x00,0xf0,0x02,0x07,0xa4,0x00,0x00,0x00,0xbf,0x60,0x00,0x00,0x0b,0xf6,
-0x00,0x01,0x22,0xcf,0x72,0x20,0x88,0x01,0x50,0x48,0xff,0xff,0xff,0xf4,0x12,0x00,
-0x05,0x1b,0x00,0xf9,0x1a,0x00,0x0e,0xf0,0xef,0x0f,0xd4,0xf8,0x5c,0x00,0x2e,0xee,
-0xe3,0x2f,0xff,0xf4,0x03,0x70,0x0f,0xf7,0x0a,0xf4,0x00,0x00,0x1f,0x90,0x00,0x06,
-0xf4,0x00,0x00,0xbe,0x00,0x00,0x0f,0xa0,0x00,0x05,0xf5,0x00,0x00,0xaf,0x0a,0x00,
-0xff,0x41,0xb0,0x00,0x04,0xf6,0x00,0x00,0xaf,0x10,0x00,0x0e,0xb0,0x00,0x00,0x00,
-0x6d,0xfe,0x80,0x00,0x6f,0xff,0xff,0x90,0x0e,0xf8,0x05,0xff,0x12,0xff,0x10,0x0e,
-0xf4,0x3f,0xf0,0x00,0xdf,0x64,0xff,0x00,0x0d,0xf7,0x4f,0xf0,0x00,0xdf,0x73,0xff,
-0x00,0x0d,0xf6,0x2f,0xf1,0x00,0xef,0x40,0xef,0x80,0x5f,0xf1,0x06,0xff,0xff,0xf9,
-0x00,0x06,0xdf,0xe8,0x00,0x00,0x16,0xc4,0x3a,0xff,0xf4,0xbf,0xff,0xf4,0x65,0x0f,
-0xf4,0x00,0x03,0x00,0x05,0xf1,0x35,0x7d,0xfd,0x80,0x00,0xaf,0xff,0xff,0xa0,0x2f,
-0xf4,0x06,0xff,0x05,0xec,0x00,0x1f,0xf2,0x00,0x00,0x04,0xff,0x00,0x00,0x00,0xdf,
-0x80,0x00,0x00,0xbf,0xd0,0x00,0x00,0xaf,0xe2,0x00,0x00,0x8f,0xf3,0x00,0x00,0x6f,
-0xf4,0x00,0x00,0x2f,0xff,0xee,0xee,0x83,0xff,0xff,0xff,0xf9,0x01,0x9e,0xfd,0x70,
-0x00,0xcf,0xfe,0xff,0xa0,0x3f,0xf3,0x05,0xff,0x11,0x33,0x36,0x00,0xf0,0x37,0x08,
-0xfe,0x00,0x00,0xef,0xfd,0x20,0x00,0x0c,0xef,0xf7,0x00,0x00,0x00,0x3f,0xf2,0x25,
-0x40,0x00,0xef,0x56,0xff,0x20,0x4f,0xf4,0x0d,0xff,0xef,0xfc,0x00,0x19,0xdf,0xd8,
-0x00,0x00,0x00,0x2f,0xf7,0x00,0x00,0x0c,0xff,0x70,0x00,0x06,0xff,0xf7,0x00,0x01,
-0xee,0xdf,0x70,0x00,0xaf,0x5c,0xf7,0x00,0x4f,0xb0,0xcf,0x70,0x0d,0xf1,0x0c,0xf7,
-0x07,0xff,0xee,0xff,0xfa,0x43,0x01,0xa0,0xc0,0x00,0x00,0xcf,0x70,0x00,0x00,0x0c,
-0xf7,0x00,0x09,0x00,0xf0,0x11,0x04,0xff,0xff,0xff,0x20,0x6f,0xff,0xff,0xf2,0x08,
-0xf9,0x00,0x00,0x00,0x9f,0x70,0x00,0x00,0x0b,0xfc,0xef,0xb1,0x00,0xdf,0xfd,0xff,
-0xd0,0x01,0x51,0x03,0xff,0x40,0x29,0x00,0xf0,0x31,0x17,0x70,0x00,0xcf,0x70,0xff,
-0x70,0x3f,0xf4,0x07,0xff,0xff,0xfc,0x00,0x06,0xdf,0xe9,0x00,0x00,0x02,0x9d,0xe0,
-0x00,0x05,0xff,0xfe,0x00,0x02,0xff,0x92,0x00,0x00,0xaf,0xa0,0x00,0x00,0x0f,0xf8,
-0xdf,0xc3,0x02,0xff,0xff,0xff,0xe0,0x3f,0xf7,0x02,0xff,0x63,0xff,0x00,0x0b,0xf8,
-0x1f,0xf2,0x00,0xbf,0x90,0xdf,0x90,0x2f,0xf5,0x04,0x36,0x00,0x31,0x04,0xcf,0xe9,
-0x49,0x03,0xf0,0x07,0x87,0xee,0xee,0xef,0xf6,0x00,0x00,0x02,0xff,0x10,0x00,0x00,
-0x8f,0x90,0x00,0x00,0x0f,0xf3,0x00,0x00,0x06,0xfc,0x12,0x01,0x90,0x60,0x00,0x00,
-0x4f,0xe0,0x00,0x00,0x0b,0xf8,0x1e,0x00,0x90,0x20,0x00,0x00,0x9f,0xb0,0x00,0x00,
-0x1f,0xf5,0x9e,0x01,0xf0,0x13,0xfd,0x80,0x00,0x7f,0xff,0xff,0xa0,0x0d,0xf8,0x05,
-0xff,0x00,0xff,0x40,0x1f,0xf2,0x0c,0xf9,0x07,0xfe,0x00,0x2d,0xff,0xfe,0x30,0x04,
-0xff,0xff,0xf6,0x00,0xef,0x60,0x3f,0xf2,0xb0,0x01,0xf0,0x03,0x62,0xff,0x50,0x3f,
-0xf5,0x0b,0xff,0xef,0xfd,0x00,0x08,0xdf,0xe9,0x10,0x00,0x6d,0xfd,0x50,0x36,0x00,
-0xf0,0x00,0x50,0x0f,0xf7,0x07,0xfe,0x04,0xff,0x00,0x0f,0xf3,0x4f,0xf0,0x00,0xef,
-0x51,0x24,0x00,0xf2,0x12,0x0a,0xff,0xdf,0xff,0x40,0x0a,0xfe,0x8f,0xf2,0x00,0x00,
-0x05,0xfe,0x00,0x00,0x15,0xef,0x70,0x00,0x9f,0xff,0xb0,0x00,0x09,0xfc,0x60,0x00,
-0x0a,0xe3,0x0f,0xf7,0x03,0x70,0xd9,0x1b,0x01,0x4a,0x02,0x74,0xe3,0x0c,0xe2,0x1f,
-0xf5,0x04,0x60,0xf4,0x1b,0xa5,0x0b,0xf2,0x0b,0xf2,0x0d,0xf0,0x2f,0xa0,0x3d,0x20,
-0x06,0x1c,0xf0,0x16,0xb2,0x00,0x06,0xdf,0xf2,0x18,0xef,0xfe,0x80,0x9f,0xfa,0x40,
-0x00,0x9f,0xfc,0x60,0x00,0x06,0xdf,0xff,0xa1,0x00,0x04,0xbf,0xf2,0x00,0x00,0x02,
-0x92,0xff,0xff,0xff,0xf0,0xde,0xee,0xee,0xe0,0x2a,0x00,0x00,0x08,0x00,0x00,0x10,
-0x00,0xf0,0x3f,0x0c,0x50,0x00,0x00,0x1f,0xfd,0x70,0x00,0x07,0xdf,0xff,0x92,0x00,
-0x03,0x9e,0xfc,0x00,0x05,0xbf,0xfb,0x09,0xef,0xfe,0x71,0x1f,0xfc,0x50,0x00,0x0a,
-0x30,0x00,0x00,0x03,0xbf,0xeb,0x20,0x2f,0xff,0xff,0xe0,0x8f,0xd0,0x2f,0xf4,0x24,
-0x20,0x0f,0xf5,0x00,0x00,0x6f,0xf1,0x00,0x05,0xff,0x50,0x00,0x0f,0xf6,0x00,0x00,
-0x3f,0xd0,0x00,0x00,0x14,0x30,0x00,0x00,0x06,0x30,0x00,0x00,0x7f,0xf0,0x00,0x00,
-0x3e,0xbf,0x02,0xf2,0x45,0x3a,0xdf,0xeb,0x40,0x00,0x00,0x08,0xfc,0x75,0x6b,0xf9,
-0x00,0x00,0x8f,0x60,0x01,0x00,0x4f,0x70,0x03,0xf8,0x01,0xcf,0xfa,0x07,0xf1,0x0a,
-0xe0,0x0c,0xf6,0xbf,0x01,0xf5,0x0f,0x90,0x5f,0x60,0x9f,0x00,0xd8,0x2f,0x50,0xaf,
-0x10,0xae,0x00,0xb9,0x4f,0x30,0xde,0x00,0xbd,0x00,0xca,0x4f,0x30,0xed,0x00,0xcc,
-0x00,0xd7,0x3f,0x50,0xde,0x00,0xfb,0x02,0xf4,0x0f,0x80,0x9f,0x8b,0xfe,0x6d,0xc0,
-0x0b,0xe1,0x1c,0xfa,0x2d,0xfb,0x10,0x02,0xfc,0x84,0x03,0xb0,0x5f,0xfa,0x77,0x99,
-0x00,0x00,0x00,0x02,0x8d,0xff,0xc6,0x0f,0x00,0x30,0xef,0xa0,0x00,0xd6,0x04,0x10,
-0x00,0x4f,0x04,0x10,0xf5,0x10,0x00,0xf0,0x71,0xdf,0xb0,0x00,0x00,0x4f,0xf4,0xff,
-0x10,0x00,0x0a,0xfb,0x0e,0xf6,0x00,0x00,0xff,0x60,0xaf,0xc0,0x00,0x5f,0xf1,0x05,
-0xff,0x20,0x0b,0xff,0xff,0xff,0xf7,0x01,0xff,0xff,0xff,0xff,0xd0,0x6f,0xf2,0x00,
-0x05,0xff,0x2c,0xfb,0x00,0x00,0x0e,0xf8,0xff,0xff,0xfd,0x80,0x0f,0xff,0xff,0xff,
-0xb0,0xff,0x50,0x08,0xff,0x1f,0xf5,0x00,0x2f,0xf2,0xff,0x50,0x08,0xfe,0x0f,0xff,
-0xff,0xfe,0x30,0xff,0xdc,0xcf,0xfa,0x0f,0xf5,0x00,0x2f,0xf4,0xff,0x50,0x00,0xef,
-0x7f,0xf5,0x00,0x5f,0xf5,0xff,0xff,0xff,0xfd,0x0f,0xff,0xff,0xd9,0x10,0x00,0x19,
-0xef,0xe9,0x10,0x01,0xdf,0xff,0xff,0xd1,0x0a,0xfe,0x30,0x3e,0xf8,0x0f,0xf6,0x00,
-0x08,0xfd,0x3f,0xf2,0x00,0x00,0x21,0x4f,0xf0,0xa3,0x00,0x00,0x05,0x00,0x00,0x0f,
-0x00,0xf1,0x01,0x11,0x0f,0xf5,0x00,0x08,0xfd,0x0a,0xfd,0x30,0x3e,0xf9,0x01,0xef,
-0xff,0xff,0xd1,0x37,0x00,0x00,0x40,0x00,0x02,0x60,0x00,0x30,0x50,0x3c,0xfd,0x60,
-0x00,0xf0,0x1a,0xf5,0xff,0x50,0x00,0xcf,0x9f,0xf5,0x00,0x0a,0xfb,0xff,0x50,0x00,
-0xaf,0xbf,0xf5,0x00,0x0c,0xf9,0xff,0x50,0x02,0xff,0x5f,0xf5,0x03,0xcf,0xd0,0xff,
-0xff,0xff,0xe3,0x0f,0xff,0xfe,0x92,0x00,0xff,0xff,0xff,0xfa,0x89,0x03,0x44,0xff,
-0x50,0x00,0x00,0x04,0x00,0x00,0xcb,0x00,0x4b,0xff,0xfe,0xee,0xc0,0x14,0x00,0x13,
-0xf9,0x2c,0x00,0x11,0xf6,0x04,0x00,0x0c,0x30,0x00,0x00,0x04,0x00,0x08,0x14,0x00,
-0x03,0x04,0x00,0xf0,0x09,0x00,0x18,0xdf,0xea,0x20,0x00,0x1d,0xff,0xff,0xfe,0x10,
-0x09,0xff,0x40,0x2e,0xf9,0x00,0xef,0x70,0x00,0x6f,0xe0,0x2f,0xf3,0x76,0x02,0x10,
-0xff,0x5b,0x02,0xf0,0x09,0x4f,0xf2,0x07,0xff,0xff,0x02,0xff,0x30,0x5d,0xdf,0xf0,
-0x0e,0xf8,0x00,0x05,0xff,0x00,0x8f,0xf5,0x00,0x8f,0xf0,0x00,0xdf,0x4a,0x03,0x40,
-0x00,0x8d,0xfe,0xc6,0x46,0x00,0x2f,0x1f,0xf4,0x05,0x00,0x02,0x00,0x21,0x05,0x02,
-0x05,0x00,0x0f,0x23,0x00,0x05,0x3b,0xdf,0x8d,0xf8,0x03,0x00,0x4f,0x00,0x00,0x06,
-0xff,0x04,0x00,0x09,0xf0,0x01,0x6a,0x70,0x06,0xfe,0x8f,0xe1,0x1c,0xfb,0x1f,0xff,
-0xff,0xf3,0x02,0xbe,0xfc,0x40,0x32,0x01,0xf0,0x09,0xc0,0xff,0x50,0x0c,0xfe,0x10,
-0xff,0x50,0x8f,0xf4,0x00,0xff,0x54,0xff,0x80,0x00,0xff,0x7e,0xfc,0x00,0x00,0xff,
-0xef,0xf5,0xfa,0x00,0xf0,0x08,0xfd,0x00,0x00,0xff,0xf8,0xff,0x70,0x00,0xff,0x80,
-0xaf,0xf2,0x00,0xff,0x50,0x1e,0xfb,0x00,0xff,0x50,0x06,0xff,0x50,0x7b,0x01,0x1e,
-0xe1,0x10,0x01,0x0e,0x04,0x00,0x03,0x40,0x01,0x11,0xf5,0x04,0x00,0x40,0xf3,0x00,
-0x00,0x4f,0x74,0x05,0x40,0x00,0x9f,0xff,0xff,0x05,0x05,0xf0,0x1a,0xff,0xff,0xdf,
-0x40,0x04,0xfd,0xff,0xff,0x9f,0x90,0x09,0xf9,0xff,0xff,0x4f,0xe0,0x0e,0xf4,0xff,
-0xff,0x4b,0xf4,0x4f,0xb4,0xff,0xff,0x45,0xf9,0x9f,0x54,0xff,0xff,0x50,0xfe,0xef,
-0x05,0xff,0xff,0x50,0xaf,0xfa,0x06,0x00,0x30,0x5f,0xf5,0x05,0x04,0x04,0x50,0xf0,
-0x05,0xff,0xff,0xa0,0x00,0x01,0x10,0xf3,0x05,0x00,0x11,0xfc,0x28,0x01,0xf0,0x0d,
-0x60,0x1f,0xf4,0xff,0xcf,0xe0,0x1f,0xf4,0xff,0x5d,0xf8,0x1f,0xf4,0xff,0x54,0xff,
-0x3f,0xf4,0xff,0x50,0xaf,0xcf,0xf4,0xff,0x50,0x2f,0xff,0xf4,0xa0,0x02,0x01,0x8a,
-0x02,0x00,0x05,0x00,0xf0,0x21,0x5f,0xf4,0x00,0x08,0xdf,0xd8,0x10,0x00,0x0d,0xff,
-0xff,0xfd,0x10,0x09,0xff,0x51,0x4e,0xf9,0x00,0xff,0x70,0x00,0x7f,0xf0,0x3f,0xf2,
-0x00,0x02,0xff,0x34,0xff,0x10,0x00,0x0f,0xf5,0x4f,0xf1,0x00,0x00,0xff,0x53,0xff,
-0x20,0x00,0x2f,0xf3,0x0f,0xf7,0x35,0x01,0x70,0x9f,0xf5,0x04,0xef,0x90,0x00,0xdf,
-0x87,0x02,0x53,0x00,0x8d,0xfd,0x81,0x00,0xfa,0x02,0x00,0x0f,0x02,0xf0,0x01,0x05,
-0xff,0x6f,0xf5,0x00,0x0b,0xfa,0xff,0x50,0x00,0xbf,0xbf,0xf5,0x00,0x4f,0xf7,0xe8,
-0x02,0x50,0x1f,0xff,0xff,0xe9,0x10,0xf6,0x00,0x10,0x0f,0x57,0x03,0x05,0x09,0x00,
-0x20,0x00,0x08,0xd8,0x05,0x13,0x1d,0x78,0x00,0x18,0x5f,0x78,0x00,0x20,0x35,0xff,
-0x24,0x00,0x28,0x5f,0xf0,0x78,0x00,0x57,0x07,0xff,0x00,0x9f,0xf4,0x78,0x00,0x20,
-0xff,0xfd,0x4c,0x02,0x20,0x2d,0xfe,0xcc,0x03,0x90,0x0a,0x50,0xff,0xff,0xfd,0x70,
-0x0f,0xff,0xff,0xb9,0x01,0x60,0x07,0xff,0x4f,0xf5,0x00,0x0f,0xaf,0x02,0x00,0x8c,
-0x00,0x20,0x8f,0xf2,0xad,0x03,0x10,0x0f,0x64,0x01,0xc0,0xff,0x50,0x7f,0xf1,0x0f,
-0xf5,0x00,0xef,0x80,0xff,0x50,0x06,0xa1,0x03,0xf0,0x11,0x0e,0xf9,0x00,0x5c,0xff,
-0xc6,0x00,0x07,0xff,0xff,0xff,0x80,0x0f,0xf9,0x00,0x8f,0xf1,0x1f,0xf5,0x00,0x1a,
-0xa2,0x0c,0xfe,0x60,0x00,0x00,0x02,0xdf,0xff,0xa2,0x00,0xc5,0x04,0x10,0x40,0xdf,
-0x08,0xc0,0xe0,0x5d,0xc0,0x00,0x2f,0xf3,0x2f,0xf7,0x00,0x6f,0xf2,0x09,0xe1,0x03,
-0x60,0x00,0x5c,0xff,0xd7,0x00,0xbf,0x20,0x03,0x20,0xaf,0xff,0x59,0x00,0x10,0x04,
-0xf0,0x05,0x0f,0x05,0x00,0x19,0x5f,0x1f,0xf4,0x00,0x0b,0xfa,0x05,0x00,0x0f,0xc1,
-0xf9,0x0f,0xf5,0x00,0x0d,0xf8,0x0c,0xfc,0x20,0x5f,0xf5,0x03,0x78,0x00,0xf2,0x00,
-0x3b,0xff,0xd8,0x00,0xcf,0xc0,0x00,0x05,0xff,0x37,0xff,0x10,0x00,0xaf,0xe0,0xc4,
-0x00,0xf0,0x0f,0xcf,0xa0,0x03,0xff,0x40,0x07,0xfe,0x00,0x8f,0xe0,0x00,0x2f,0xf3,
-0x0c,0xf9,0x00,0x00,0xcf,0x81,0xff,0x40,0x00,0x07,0xfc,0x5f,0xe0,0x00,0x00,0x2f,
-0xfc,0xf9,0x06,0x01,0xc7,0x00,0x30,0x07,0xff,0xe0,0x46,0x07,0x10,0xf9,0x7c,0x06,
-0xf0,0x31,0x01,0xff,0x10,0x0b,0xfa,0x6f,0xe0,0x04,0xff,0x50,0x0d,0xf6,0x3f,0xf1,
-0x08,0xff,0x90,0x0f,0xf3,0x0f,0xf3,0x0b,0xff,0xc0,0x3f,0xf0,0x0c,0xf6,0x0f,0xed,
-0xf0,0x6f,0xc0,0x09,0xf9,0x2f,0xaa,0xf3,0x9f,0x90,0x05,0xfc,0x6f,0x66,0xf7,0xcf,
-0x60,0x02,0xff,0xaf,0x32,0xfa,0xff,0x20,0x00,0xef,0xff,0x00,0xff,0xff,0x00,0x00,
-0xbf,0xfb,0x03,0x00,0x60,0x00,0x8f,0xf8,0x00,0x7f,0xf8,0x22,0x05,0xf0,0x08,0x00,
-0x4f,0xf5,0x00,0x7f,0xf3,0x00,0x1f,0xfa,0x0d,0xfb,0x00,0x8f,0xf1,0x05,0xff,0x41,
-0xff,0x80,0x00,0xcf,0xc9,0xfe,0x4d,0x05,0xb0,0xf6,0x00,0x00,0x0a,0xff,0xd0,0x00,
-0x00,0x0b,0xff,0xe0,0xe9,0x02,0xf0,0x1f,0xf7,0x00,0x00,0xdf,0xb8,0xff,0x10,0x06,
-0xff,0x31,0xff,0x90,0x0e,0xfa,0x00,0x8f,0xf2,0x8f,0xf2,0x00,0x0e,0xfb,0xbf,0xc0,
-0x00,0x0e,0xfa,0x4f,0xf3,0x00,0x5f,0xf2,0x0c,0xfa,0x00,0xcf,0xa0,0x04,0xff,0x23,
-0xff,0x20,0x00,0xcf,0x8a,0xfa,0x32,0x00,0x10,0xf3,0xf5,0x07,0x10,0xb0,0xdd,0x09,
-0x10,0x30,0x3b,0x01,0x1b,0x20,0x05,0x00,0x00,0xd9,0x08,0x30,0xff,0xf1,0x6f,0x7a,
-0x06,0x00,0x59,0x07,0xa0,0x60,0x00,0x00,0x0c,0xfb,0x00,0x00,0x00,0x7f,0xf2,0x0e,
-0x00,0x00,0x08,0x08,0x00,0x7d,0x07,0x60,0x6f,0xf2,0x00,0x00,0x01,0xff,0xfd,0x07,
-0x10,0xfd,0x53,0x05,0x00,0x05,0x0b,0x10,0x6f,0x05,0x00,0xaf,0x0d,0xdd,0x41,0xff,
-0xf5,0x1f,0xf3,0x01,0xff,0x30,0x05,0x00,0x0a,0xf2,0x03,0xd4,0x1f,0xff,0x50,0xdf,
-0x70,0x00,0x00,0x7f,0xd0,0x00,0x00,0x1f,0xf3,0x00,0x00,0x0b,0xf9,0x5b,0x07,0x01,
-0xca,0x02,0x00,0x1e,0x08,0x00,0x20,0x03,0x20,0x0e,0xf6,0xa4,0x06,0x03,0xdd,0x07,
-0xbf,0xcf,0x80,0x00,0x00,0x6f,0xd0,0xbd,0xd6,0xef,0xf7,0x0c,0x02,0x00,0x06,0xf0,
-0x25,0xbf,0xf7,0xef,0xf7,0x00,0x8f,0x80,0x00,0x0e,0xfe,0x00,0x04,0xfc,0xf4,0x00,
-0xaf,0x2f,0xa0,0x1f,0xa0,0xaf,0x17,0xf5,0x04,0xf7,0xdd,0xdd,0xdd,0xd1,0xff,0xff,
-0xff,0xf2,0x38,0x80,0x00,0xbf,0x80,0x00,0xdf,0x20,0x01,0x9e,0xfc,0x50,0x00,0xcf,
-0xed,0xff,0x40,0x3f,0xf1,0x7a,0x00,0xf3,0x0d,0x01,0x9f,0xb0,0x04,0xcf,0xff,0xfb,
-0x02,0xff,0x74,0xaf,0xb0,0x6f,0xd0,0x0a,0xfb,0x03,0xff,0xee,0xff,0xb0,0x05,0xdf,
-0xb7,0xfe,0x00,0x2f,0xf2,0x7f,0x00,0x02,0x09,0x00,0xf0,0x08,0x7d,0xfb,0x10,0x2f,
-0xff,0xff,0xfc,0x02,0xff,0x60,0x4f,0xf3,0x2f,0xf2,0x00,0xdf,0x52,0xff,0x20,0x0c,
-0xf7,0x2f,0xf2,0x4b,0x08,0x32,0x60,0x3f,0xf3,0x1b,0x00,0xf0,0x06,0x6e,0xfb,0x10,
-0x00,0x8e,0xfd,0x50,0x0a,0xff,0xff,0xf5,0x2f,0xf4,0x08,0xfc,0x6f,0xd0,0x01,0x65,
-0x7f,0xc0,0xbc,0x00,0xe9,0x00,0x22,0x2f,0xf4,0x07,0xfc,0x0a,0xff,0xef,0xf6,0x00,
-0x8e,0xfd,0x60,0x58,0x00,0x50,0x20,0x1a,0xfd,0x7f,0xf2,0x02,0x07,0xf0,0x0b,0x22,
-0xff,0x50,0x7f,0xf2,0x5f,0xe0,0x02,0xff,0x27,0xfc,0x00,0x2f,0xf2,0x5f,0xd0,0x02,
-0xff,0x22,0xff,0x30,0x5f,0xf2,0x0b,0xff,0xdf,0x24,0x00,0xf0,0x05,0x6f,0xf2,0x00,
-0x6d,0xfd,0x70,0x00,0x8f,0xff,0xff,0x70,0x1f,0xf5,0x04,0xff,0x05,0xff,0x99,0x9f,
-0xf2,0x76,0x01,0x20,0x35,0xff,0xee,0x0b,0x30,0xf9,0x00,0x85,0x1b,0x00,0xfe,0x09,
-0xd0,0x00,0x6d,0xfe,0xa1,0x00,0x00,0x6d,0xfa,0x04,0xff,0xfa,0x07,0xfd,0x00,0xcf,
-0xff,0xf7,0x8d,0xfe,0xb5,0x08,0xfc,0x00,0x03,0x00,0xf2,0x06,0x00,0xaf,0xe7,0xdf,
-0x40,0xaf,0xff,0xff,0xf4,0x2f,0xf6,0x04,0xff,0x45,0xfe,0x00,0x0f,0xf4,0x6f,0xd0,
-0x00,0x09,0x00,0x00,0x12,0x00,0x01,0x1b,0x00,0xf0,0x05,0x00,0x9f,0xe7,0xff,0x30,
-0x15,0x00,0x6f,0xf1,0x0b,0xff,0xef,0xf9,0x00,0x1a,0xef,0xd7,0x00,0x3f,0xf1,0x74,
-0x06,0x23,0x10,0x00,0x09,0x00,0xf0,0x06,0x5d,0xfb,0x20,0x3f,0xff,0xff,0xfb,0x03,
-0xff,0x50,0x6f,0xf0,0x3f,0xf1,0x02,0xff,0x13,0xff,0x10,0x2f,0xf2,0x09,0x00,0x19,
-0x23,0x09,0x00,0x8c,0x0c,0xe2,0x1f,0xf4,0x04,0x50,0x0f,0xf4,0x02,0x00,0x70,0x00,
-0xde,0x20,0x1f,0xf4,0x00,0x45,0xfa,0x0a,0x2d,0xff,0x40,0x05,0x00,0x7c,0x02,0xff,
-0x3b,0xff,0xe0,0xaf,0xc3,0x87,0x01,0xf0,0x02,0x20,0xaf,0xe1,0x2f,0xf2,0x7f,0xf3,
-0x02,0xff,0x6f,0xf6,0x00,0x2f,0xff,0xfa,0x00,0x02,0xf6,0x00,0xfe,0x03,0x2f,0xfc,
-0xef,0x70,0x02,0xff,0x26,0xff,0x20,0x2f,0xf2,0x0c,0xfc,0x02,0xff,0x20,0x3f,0xf6,
-0x6e,0x00,0x02,0x02,0x00,0xff,0x12,0x2f,0xf4,0xdf,0xc2,0x6e,0xfb,0x12,0xff,0xff,
-0xff,0xef,0xff,0xfa,0x2f,0xf6,0x06,0xff,0x50,0x8f,0xe2,0xff,0x20,0x3f,0xf0,0x04,
-0xff,0x2f,0xf2,0x03,0xff,0x00,0x4f,0xf2,0x0d,0x00,0x06,0x10,0xf0,0x3b,0x00,0x10,
-0x02,0x13,0x05,0x00,0x37,0x00,0xa0,0x02,0xff,0x10,0x2f,0xf1,0x2f,0xf1,0x02,0xff,
-0x22,0xe2,0x00,0x09,0x09,0x00,0x50,0x20,0x00,0x7d,0xfd,0x70,0x80,0x06,0xf0,0x0a,
-0x90,0x2f,0xf6,0x05,0xff,0x26,0xfe,0x00,0x0d,0xf6,0x7f,0xc0,0x00,0xcf,0x86,0xfe,
-0x00,0x0d,0xf7,0x2f,0xf5,0x05,0xff,0x30,0x9f,0x5f,0x06,0xf0,0x10,0x7d,0xfe,0x80,
-0x00,0x2f,0xf7,0xdf,0xb1,0x02,0xff,0xfd,0xff,0xb0,0x2f,0xf4,0x03,0xff,0x32,0xff,
-0x20,0x0d,0xf5,0x2f,0xf2,0x00,0xcf,0x72,0xff,0x20,0x0e,0xf5,0x3b,0x00,0x10,0x22,
-0xa4,0x04,0x48,0x2f,0xf7,0xdf,0xa1,0xff,0x00,0xf0,0x01,0x00,0x00,0x01,0xaf,0xe6,
-0xef,0x20,0xbf,0xff,0xff,0xf2,0x3f,0xf5,0x06,0xff,0x25,0xa8,0x02,0x32,0x7f,0xc0,
-0x02,0x09,0x00,0x41,0x2f,0xf5,0x06,0xff,0x1b,0x00,0x39,0x01,0xaf,0xd7,0x34,0x00,
-0x21,0x2f,0xf2,0xf2,0x0b,0xab,0xea,0x2f,0xff,0xfa,0x2f,0xfa,0x31,0x2f,0xf2,0x00,
-0x03,0x00,0xf0,0x17,0x02,0xae,0xfc,0x40,0x0d,0xfd,0xcf,0xf3,0x3f,0xf0,0x0a,0xd7,
-0x1f,0xfa,0x51,0x00,0x05,0xef,0xff,0x90,0x00,0x04,0x8f,0xf7,0x7f,0xb0,0x0a,0xf9,
-0x2f,0xfc,0xbf,0xf4,0x03,0xbf,0xfc,0x50,0x0b,0xf9,0xab,0x03,0x62,0xef,0xff,0xf0,
-0xae,0xfe,0xb0,0x0c,0x00,0x02,0x03,0x00,0x9e,0x0a,0xfa,0x00,0x07,0xff,0xf1,0x01,
-0xbf,0xe1,0xfa,0x01,0x14,0x3f,0x18,0x01,0xf0,0x01,0x1f,0xf4,0x06,0xff,0x20,0xdf,
-0xff,0xff,0xf2,0x02,0xcf,0xd6,0xff,0x20,0xbf,0x90,0x1c,0x03,0xf0,0x36,0x0c,0xf7,
-0x1f,0xf1,0x1f,0xf2,0x0c,0xf6,0x5f,0xd0,0x07,0xfa,0x9f,0x80,0x02,0xfe,0xdf,0x30,
-0x00,0xdf,0xfe,0x00,0x00,0x8f,0xf9,0x00,0x00,0x3f,0xf4,0x00,0xaf,0x70,0x1f,0xd0,
-0x0c,0xf6,0x6f,0xb0,0x5f,0xf1,0x0f,0xf2,0x2f,0xe0,0xaf,0xf5,0x2f,0xe0,0x0e,0xf1,
-0xee,0xfa,0x5f,0xa0,0x0b,0xf6,0xf8,0xce,0x8f,0x60,0x07,0xfe,0xf3,0x8f,0xef,0x30,
-0x03,0xff,0xf0,0x60,0x0a,0x40,0xff,0xa0,0x0f,0xfb,0xe2,0x0d,0xf0,0x3e,0x0a,0xf7,
-0x00,0x7f,0xe0,0x0c,0xfa,0x00,0xef,0x74,0xff,0x20,0x05,0xff,0xdf,0x80,0x00,0x0d,
-0xff,0xe1,0x00,0x00,0x7f,0xfa,0x00,0x00,0x0e,0xff,0xf2,0x00,0x07,0xfe,0xbf,0xa0,
-0x01,0xff,0x63,0xff,0x30,0x8f,0xd0,0x0a,0xfc,0x00,0xcf,0x90,0x08,0xfd,0x07,0xfe,
-0x00,0xdf,0x70,0x1f,0xf2,0x1f,0xf2,0x00,0xcf,0x76,0xfc,0x00,0x06,0xfb,0xaf,0x70,
-0x00,0x1f,0xff,0xf2,0x00,0x00,0xbf,0xfc,0x00,0x00,0x06,0xfc,0x04,0xf1,0x00,0x1f,
-0xf1,0x00,0x00,0x08,0xfb,0x00,0x00,0x1f,0xff,0x50,0x00,0x01,0xee,0x70,0x5b,0x08,
-0x30,0xf7,0x4e,0xee,0xce,0x0a,0x60,0xdf,0xb0,0x00,0x08,0xfe,0x10,0xad,0x05,0x60,
-0x01,0xef,0x90,0x00,0x0a,0xfd,0x1c,0x00,0x30,0xee,0xe8,0x6f,0xbe,0x06,0xd0,0x05,
-0x80,0x00,0x7f,0xc0,0x00,0xff,0x10,0x02,0xfd,0x00,0x03,0xfc,0x03,0x00,0x20,0x06,
-0xfa,0xcf,0x05,0x83,0xaf,0xc0,0x00,0x09,0xf8,0x00,0x04,0xfc,0x15,0x00,0xd9,0x01,
-0xff,0x00,0x00,0xaf,0x90,0x00,0x0a,0xc0,0x00,0x00,0x00,0xab,0x01,0x00,0xf0,0x03,
-0x01,0x57,0x00,0x07,0xfb,0x00,0x0c,0xf4,0x00,0x8f,0x70,0x08,0xf8,0x00,0x8f,0x80,
-0x05,0xfb,0x85,0x05,0x50,0x8f,0xe0,0x4f,0xd1,0x07,0x0f,0x00,0x90,0x08,0xf7,0x00,
-0xaf,0x50,0x4f,0xe0,0x08,0xc2,0xf3,0x07,0xf0,0x05,0x01,0xae,0xa0,0x01,0x94,0x0a,
-0xff,0xfc,0x27,0xf6,0x0f,0xd1,0x8f,0xff,0xf1,0x1a,0x50,0x07,0xed,0x40,0x68,0x0c,
-0x02,0x72,0x0c,0x22,0x0e,0xe2,0x07,0x00,0xf1,0x03,0xfe,0x30,0x00,0x16,0x77,0x77,
-0x7f,0x7c,0xe3,0x00,0x6f,0xee,0xee,0xee,0x40,0xbf,0x30,0x7e,0x9f,0x0c,0x21,0xf4,
-0x7e,0x43,0x00,0x11,0xfc,0x07,0x00,0x20,0x1c,0xe2,0x4e,0x04,0x92,0x41,0xce,0x20,
-0x05,0x55,0x55,0x5f,0x8d,0xe2,0x38,0x00,0x11,0x20,0x07,0x00,0x12,0xd1,0xe2,0x0c,
-0x01,0xe5,0x0b,0x21,0x05,0xb0,0x0d,0x00,0x21,0x4f,0xf0,0xcf,0x0c,0x11,0xfc,0x07,
+0x3d,0xf2,0x54,0xf2,0xaa,0xf4,0x12,0xf7,0xf2,0xf7,0x00,0x01,0x00,0x2f,0xf9,0x00,
+0x01,0x00,0x03,0x13,0xfb,0x08,0x00,0x17,0xf1,0x14,0x00,0x90,0xfa,0xf9,0x00,0xfe,
+0xf5,0x00,0xf5,0x00,0x00,0x48,0x04,0x0d,0x01,0x00,0x4e,0x03,0x05,0x00,0x03,0x16,
+0x00,0x2f,0xdc,0x00,0x01,0x00,0x15,0x1f,0xe1,0x1e,0x00,0x0a,0x03,0x88,0x00,0xb2,
+0xf6,0x00,0xfd,0x00,0x00,0xf1,0xfe,0xf6,0xfb,0x00,0xed,0x93,0x00,0x9b,0xff,0x00,
+0x00,0xfe,0xff,0xfa,0xfc,0x00,0x02,0x30,0x00,0x3f,0xfd,0x00,0xfd,0xdd,0x00,0x04,
+0x15,0xfd,0x0a,0x00,0x12,0xfc,0x07,0x00,0x19,0xff,0x1f,0x00,0x16,0xfe,0x70,0x00,
+0x00,0x2a,0x00,0x10,0xf5,0x4a,0x00,0x2f,0xfb,0xfd,0x9c,0x00,0x0a,0x15,0x03,0x3c,
+0x00,0x11,0xfe,0x3f,0x00,0x26,0xfe,0xfd,0x30,0x00,0x75,0xde,0x00,0x00,0x00,0xe8,
+0x00,0xe6,0x24,0x00,0x53,0xfc,0xfd,0x00,0x00,0xfd,0x04,0x00,0x08,0x01,0x00,0x13,
+0x02,0x90,0x00,0x1f,0x02,0x6b,0x00,0x08,0x1f,0xfd,0x43,0x01,0x0d,0x16,0xec,0xd5,
+0x00,0x04,0x31,0x00,0x10,0xfd,0x07,0x00,0x29,0xfb,0xf8,0x8c,0x01,0xa7,0x02,0xf8,
+0x00,0x00,0xe6,0xfd,0xe6,0xf4,0x00,0xdd,0xf7,0x00,0x25,0xf1,0xfa,0x0c,0x00,0x72,
+0xce,0x00,0x00,0x00,0xea,0x00,0xe9,0x61,0x01,0x51,0x00,0xfc,0x00,0xff,0xfe,0x17,
+0x01,0x1d,0x02,0x65,0x01,0x01,0x6f,0x00,0x4f,0xfd,0xfe,0x00,0xfc,0x97,0x00,0x0b,
+0x10,0xfa,0x3e,0x00,0x06,0x5f,0x00,0x09,0x7b,0x02,0xb1,0xe0,0xde,0x00,0x00,0xf1,
+0xfd,0xe5,0xfe,0x02,0x00,0x02,0x60,0x00,0xd3,0xeb,0xf5,0x00,0xf5,0xe6,0xf8,0xf7,
+0x00,0xf8,0xf6,0xfa,0xf6,0xf9,0x5e,0x01,0x66,0xe5,0xec,0x00,0x00,0xf7,0xfe,0x2b,
+0x01,0xa2,0xfa,0xfb,0x00,0x00,0xfa,0xfc,0x00,0x00,0xfd,0xff,0x39,0x01,0x00,0x05,
+0x00,0x22,0xee,0xf9,0xb4,0x02,0x13,0x02,0x24,0x00,0x22,0xfc,0xfc,0x6c,0x01,0x01,
+0x37,0x00,0x04,0xb8,0x00,0x14,0xed,0x45,0x01,0x1a,0x02,0x20,0x01,0x14,0xfc,0xcd,
+0x00,0xe0,0x03,0xfa,0xe3,0xed,0x00,0x00,0xed,0xfc,0xf4,0xfe,0x02,0xf4,0x02,0x02,
+0x92,0x00,0xe6,0xf8,0xf8,0xfd,0xfb,0xf8,0xfb,0xf9,0xfd,0xfb,0xfe,0x00,0xfd,0xfc,
+0x02,0xc5,0x00,0x2e,0x02,0xfd,0x68,0x01,0x08,0xf8,0x01,0x05,0x4d,0x02,0x1f,0xfe,
+0x14,0x01,0x03,0x0e,0x17,0x00,0x0e,0x1d,0x00,0x0f,0x57,0x01,0x0a,0x10,0xff,0x6e,
+0x02,0x0c,0xbd,0x02,0x0f,0x6c,0x00,0x27,0x1e,0x02,0xbd,0x03,0x19,0x02,0x71,0x02,
+0x10,0x02,0x7d,0x03,0x0f,0x01,0x00,0x24,0x0b,0x81,0x00,0x1f,0xf5,0x2c,0x00,0x0b,
+0x23,0xfd,0xfe,0xa2,0x01,0x1c,0xea,0x6c,0x02,0x20,0xfe,0x03,0x14,0x01,0x3e,0x06,
+0x00,0x02,0x89,0x02,0x0a,0x94,0x02,0x0a,0x58,0x03,0x1c,0xeb,0x63,0x00,0x2d,0xfe,
+0x02,0x14,0x01,0x1f,0xf1,0xd8,0x00,0x24,0x1f,0xfb,0x24,0x00,0x10,0x1f,0xfe,0x19,
+0x00,0x1b,0x23,0x00,0x01,0xd5,0x02,0x11,0x03,0x4e,0x1d,0x2d,0x04,0x05,0x21,0x00,
+0xf1,0x0c,0x06,0x07,0x08,0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,
+0x09,0x10,0x11,0x12,0x00,0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0x20,0x00,0xff,
+0x0d,0x1a,0x1b,0x1c,0x00,0x1d,0x1e,0x00,0x1f,0x00,0x00,0x20,0x00,0x1f,0x1f,0x21,
+0x1b,0x00,0x22,0x00,0x23,0x00,0x24,0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,0xff,
+0xfe,0x0a,0x75,0x02,0x20,0x03,0x02,0x70,0x02,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,
+0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xf1,
+0x08,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x00,0x00,0x15,0x00,0x00,
+0x00,0x16,0x00,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,0xff,0x02,0x19,0x19,0x1a,0x19,
+0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x00,0x00,0x23,0x73,0x00,0x02,
+0x1f,0x24,0x6f,0x02,0xff,0xe9,0x50,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const uint8_t lz4BitmapData[] ={
+0xf0,0xbd,0x0f,0xf6,0x0e,0xf6,0x0e,0xf5,0x0d,0xf5,0x0d,0xf4,0x0c,0xf4,0x0c,0xf3,
+0x0b,0xf3,0x02,0x30,0x03,0x60,0x0f,0xf6,0x0b,0xe3,0x8f,0x1f,0xa8,0xf0,0xf9,0x8f,
+0x0f,0x78,0xd0,0xf6,0x36,0x07,0x20,0x00,0x06,0xf0,0x7f,0x00,0x00,0x09,0xd0,0xac,
+0x00,0x00,0x0c,0xa0,0xd9,0x00,0x0e,0xff,0xff,0xff,0xf3,0x06,0x8f,0x98,0xf8,0x61,
+0x00,0x4f,0x25,0xf1,0x00,0x01,0x7f,0x28,0xf1,0x10,0x8f,0xff,0xff,0xff,0xa0,0x24,
+0xdc,0x4e,0xb4,0x20,0x00,0xe8,0x0f,0x70,0x00,0x00,0xf5,0x1f,0x40,0x00,0x03,0xf3,
+0x4f,0x20,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x0c,0x70,0x00,0x00,0x3a,0xfe,0x70,
+0x00,0x3f,0xff,0xff,0xa0,0x0a,0xfb,0x05,0xff,0x20,0xcf,0x70,0x0d,0xf5,0x0a,0xfc,
+0x10,0x00,0x00,0x3f,0xff,0x91,0x00,0x00,0x3c,0xff,0xf4,0x00,0x00,0x03,0xcf,0xf1,
+0x18,0x70,0x00,0xef,0x52,0xff,0x30,0x0e,0xf5,0x0c,0xfe,0x8b,0xff,0x20,0x2d,0xff,
+0xff,0x60,0x00,0x03,0xf8,0x10,0x00,0x00,0x0e,0x50,0x00,0x05,0xdf,0xa0,0x00,0x00,
+0x00,0x1f,0xb7,0xf7,0x01,0x80,0x00,0x3f,0x40,0xda,0x0a,0xc0,0x00,0x2f,0x82,0xf9,
+0x3f,0x30,0x00,0x09,0xff,0xe2,0xd9,0x00,0x00,0x00,0x23,0x07,0xe1,0x00,0x20,0x00,
+0x10,0x60,0x06,0x00,0xf0,0x57,0xac,0x2c,0xfe,0x50,0x00,0x04,0xf3,0xae,0x5b,0xf0,
+0x00,0x0d,0x90,0xcb,0x06,0xf1,0x00,0x2c,0x10,0xae,0x6c,0xf0,0x00,0x00,0x00,0x1b,
+0xfd,0x40,0x00,0x3c,0xfd,0x50,0x00,0x00,0x1e,0xff,0xff,0x30,0x00,0x05,0xfb,0x08,
+0xf7,0x00,0x00,0x6f,0xa0,0x8f,0x60,0x00,0x02,0xff,0xaf,0xd0,0x00,0x00,0x09,0xff,
+0xb1,0x00,0x00,0x05,0xff,0xfc,0x04,0xd8,0x02,0xff,0x6e,0xf9,0x7f,0x80,0x6f,0xe0,
+0x3f,0xff,0xf4,0x05,0xff,0x10,0x6f,0xfd,0x00,0x0d,0xfe,0xcf,0xff,0xe2,0x00,0x19,
+0xef,0xd8,0xaf,0xd0,0x8f,0x28,0xf2,0x8f,0x18,0xf0,0x47,0x00,0x01,0x00,0xf1,0x07,
+0x03,0xe1,0x00,0x1e,0xd1,0x00,0xaf,0x20,0x02,0xfa,0x00,0x08,0xf5,0x00,0x0b,0xf2,
+0x00,0x0e,0xf0,0x00,0x0f,0xe0,0x03,0x00,0xf0,0x36,0xf0,0x00,0x0d,0xf0,0x00,0x0a,
+0xf3,0x00,0x05,0xf7,0x00,0x00,0xee,0x00,0x00,0x6f,0x70,0x00,0x09,0xf2,0x00,0x00,
+0x70,0x00,0x00,0x07,0xb0,0x00,0x4f,0xa0,0x00,0x8f,0x50,0x01,0xfd,0x00,0x0c,0xf3,
+0x00,0x8f,0x70,0x06,0xfa,0x00,0x5f,0xb0,0x04,0xfc,0x00,0x5f,0xa0,0x06,0xf8,0x00,
+0x9f,0x50,0x0d,0xf0,0x04,0xf9,0x00,0xcf,0x10,0x8f,0x40,0x04,0x30,0x00,0x00,0x4b,
+0x01,0xf1,0x08,0x0f,0x60,0x00,0x8d,0x6e,0x89,0xd0,0x5b,0xff,0xfe,0x90,0x00,0xaf,
+0xe1,0x00,0x07,0xf4,0xeb,0x00,0x09,0x90,0x6d,0x10,0x80,0x00,0xf0,0x02,0x07,0xa4,
+0x00,0x00,0x00,0xbf,0x60,0x00,0x00,0x0b,0xf6,0x00,0x01,0x22,0xcf,0x72,0x20,0x88,
+0x01,0x50,0x48,0xff,0xff,0xff,0xf4,0x12,0x00,0x05,0x1b,0x00,0xf9,0x1a,0x00,0x0e,
+0xf0,0xef,0x0f,0xd4,0xf8,0x5c,0x00,0x2e,0xee,0xe3,0x2f,0xff,0xf4,0x03,0x70,0x0f,
+0xf7,0x0a,0xf4,0x00,0x00,0x1f,0x90,0x00,0x06,0xf4,0x00,0x00,0xbe,0x00,0x00,0x0f,
+0xa0,0x00,0x05,0xf5,0x00,0x00,0xaf,0x0a,0x00,0xff,0x41,0xb0,0x00,0x04,0xf6,0x00,
+0x00,0xaf,0x10,0x00,0x0e,0xb0,0x00,0x00,0x00,0x6d,0xfe,0x80,0x00,0x6f,0xff,0xff,
+0x90,0x0e,0xf8,0x05,0xff,0x12,0xff,0x10,0x0e,0xf4,0x3f,0xf0,0x00,0xdf,0x64,0xff,
+0x00,0x0d,0xf7,0x4f,0xf0,0x00,0xdf,0x73,0xff,0x00,0x0d,0xf6,0x2f,0xf1,0x00,0xef,
+0x40,0xef,0x80,0x5f,0xf1,0x06,0xff,0xff,0xf9,0x00,0x06,0xdf,0xe8,0x00,0x00,0x16,
+0xc4,0x3a,0xff,0xf4,0xbf,0xff,0xf4,0x65,0x0f,0xf4,0x00,0x03,0x00,0x05,0xf1,0x35,
+0x7d,0xfd,0x80,0x00,0xaf,0xff,0xff,0xa0,0x2f,0xf4,0x06,0xff,0x05,0xec,0x00,0x1f,
+0xf2,0x00,0x00,0x04,0xff,0x00,0x00,0x00,0xdf,0x80,0x00,0x00,0xbf,0xd0,0x00,0x00,
+0xaf,0xe2,0x00,0x00,0x8f,0xf3,0x00,0x00,0x6f,0xf4,0x00,0x00,0x2f,0xff,0xee,0xee,
+0x83,0xff,0xff,0xff,0xf9,0x01,0x9e,0xfd,0x70,0x00,0xcf,0xfe,0xff,0xa0,0x3f,0xf3,
+0x05,0xff,0x11,0x33,0x36,0x00,0xf0,0x37,0x08,0xfe,0x00,0x00,0xef,0xfd,0x20,0x00,
+0x0c,0xef,0xf7,0x00,0x00,0x00,0x3f,0xf2,0x25,0x40,0x00,0xef,0x56,0xff,0x20,0x4f,
+0xf4,0x0d,0xff,0xef,0xfc,0x00,0x19,0xdf,0xd8,0x00,0x00,0x00,0x2f,0xf7,0x00,0x00,
+0x0c,0xff,0x70,0x00,0x06,0xff,0xf7,0x00,0x01,0xee,0xdf,0x70,0x00,0xaf,0x5c,0xf7,
+0x00,0x4f,0xb0,0xcf,0x70,0x0d,0xf1,0x0c,0xf7,0x07,0xff,0xee,0xff,0xfa,0x43,0x01,
+0xa0,0xc0,0x00,0x00,0xcf,0x70,0x00,0x00,0x0c,0xf7,0x00,0x09,0x00,0xf0,0x11,0x04,
+0xff,0xff,0xff,0x20,0x6f,0xff,0xff,0xf2,0x08,0xf9,0x00,0x00,0x00,0x9f,0x70,0x00,
+0x00,0x0b,0xfc,0xef,0xb1,0x00,0xdf,0xfd,0xff,0xd0,0x01,0x51,0x03,0xff,0x40,0x29,
+0x00,0xf0,0x31,0x17,0x70,0x00,0xcf,0x70,0xff,0x70,0x3f,0xf4,0x07,0xff,0xff,0xfc,
+0x00,0x06,0xdf,0xe9,0x00,0x00,0x02,0x9d,0xe0,0x00,0x05,0xff,0xfe,0x00,0x02,0xff,
+0x92,0x00,0x00,0xaf,0xa0,0x00,0x00,0x0f,0xf8,0xdf,0xc3,0x02,0xff,0xff,0xff,0xe0,
+0x3f,0xf7,0x02,0xff,0x63,0xff,0x00,0x0b,0xf8,0x1f,0xf2,0x00,0xbf,0x90,0xdf,0x90,
+0x2f,0xf5,0x04,0x36,0x00,0x31,0x04,0xcf,0xe9,0x49,0x03,0xf0,0x07,0x87,0xee,0xee,
+0xef,0xf6,0x00,0x00,0x02,0xff,0x10,0x00,0x00,0x8f,0x90,0x00,0x00,0x0f,0xf3,0x00,
+0x00,0x06,0xfc,0x12,0x01,0x90,0x60,0x00,0x00,0x4f,0xe0,0x00,0x00,0x0b,0xf8,0x1e,
+0x00,0x90,0x20,0x00,0x00,0x9f,0xb0,0x00,0x00,0x1f,0xf5,0x9e,0x01,0xf0,0x13,0xfd,
+0x80,0x00,0x7f,0xff,0xff,0xa0,0x0d,0xf8,0x05,0xff,0x00,0xff,0x40,0x1f,0xf2,0x0c,
+0xf9,0x07,0xfe,0x00,0x2d,0xff,0xfe,0x30,0x04,0xff,0xff,0xf6,0x00,0xef,0x60,0x3f,
+0xf2,0xb0,0x01,0xf0,0x03,0x62,0xff,0x50,0x3f,0xf5,0x0b,0xff,0xef,0xfd,0x00,0x08,
+0xdf,0xe9,0x10,0x00,0x6d,0xfd,0x50,0x36,0x00,0xf0,0x00,0x50,0x0f,0xf7,0x07,0xfe,
+0x04,0xff,0x00,0x0f,0xf3,0x4f,0xf0,0x00,0xef,0x51,0x24,0x00,0xf2,0x13,0x0a,0xff,
+0xdf,0xff,0x40,0x0a,0xfe,0x8f,0xf2,0x00,0x00,0x05,0xfe,0x00,0x00,0x15,0xef,0x70,
+0x00,0x9f,0xff,0xb0,0x00,0x09,0xfc,0x60,0x00,0x0a,0xe3,0x0f,0xf7,0x03,0x70,0x00,
+0x00,0x03,0x00,0x4a,0x02,0x83,0xe3,0x0c,0xe2,0x1f,0xf5,0x04,0x60,0x00,0x01,0x00,
+0xa4,0x0b,0xf2,0x0b,0xf2,0x0d,0xf0,0x2f,0xa0,0x3d,0x20,0x12,0x00,0xf0,0x17,0x04,
+0xb2,0x00,0x06,0xdf,0xf2,0x18,0xef,0xfe,0x80,0x9f,0xfa,0x40,0x00,0x9f,0xfc,0x60,
+0x00,0x06,0xdf,0xff,0xa1,0x00,0x04,0xbf,0xf2,0x00,0x00,0x02,0x92,0xff,0xff,0xff,
+0xf0,0xde,0xee,0xee,0xe0,0x2a,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0xf0,0x3f,0x0c,
+0x50,0x00,0x00,0x1f,0xfd,0x70,0x00,0x07,0xdf,0xff,0x92,0x00,0x03,0x9e,0xfc,0x00,
+0x05,0xbf,0xfb,0x09,0xef,0xfe,0x71,0x1f,0xfc,0x50,0x00,0x0a,0x30,0x00,0x00,0x03,
+0xbf,0xeb,0x20,0x2f,0xff,0xff,0xe0,0x8f,0xd0,0x2f,0xf4,0x24,0x20,0x0f,0xf5,0x00,
+0x00,0x6f,0xf1,0x00,0x05,0xff,0x50,0x00,0x0f,0xf6,0x00,0x00,0x3f,0xd0,0x00,0x00,
+0x14,0x30,0x00,0x00,0x06,0x30,0x00,0x00,0x7f,0xf0,0x00,0x00,0x3e,0xbf,0x02,0xf2,
+0x45,0x3a,0xdf,0xeb,0x40,0x00,0x00,0x08,0xfc,0x75,0x6b,0xf9,0x00,0x00,0x8f,0x60,
+0x01,0x00,0x4f,0x70,0x03,0xf8,0x01,0xcf,0xfa,0x07,0xf1,0x0a,0xe0,0x0c,0xf6,0xbf,
+0x01,0xf5,0x0f,0x90,0x5f,0x60,0x9f,0x00,0xd8,0x2f,0x50,0xaf,0x10,0xae,0x00,0xb9,
+0x4f,0x30,0xde,0x00,0xbd,0x00,0xca,0x4f,0x30,0xed,0x00,0xcc,0x00,0xd7,0x3f,0x50,
+0xde,0x00,0xfb,0x02,0xf4,0x0f,0x80,0x9f,0x8b,0xfe,0x6d,0xc0,0x0b,0xe1,0x1c,0xfa,
+0x2d,0xfb,0x10,0x02,0xfc,0x84,0x03,0xb0,0x5f,0xfa,0x77,0x99,0x00,0x00,0x00,0x02,
+0x8d,0xff,0xc6,0x0f,0x00,0x30,0xef,0xa0,0x00,0xd6,0x04,0x10,0x00,0x4f,0x04,0x10,
+0xf5,0x10,0x00,0xf0,0x71,0xdf,0xb0,0x00,0x00,0x4f,0xf4,0xff,0x10,0x00,0x0a,0xfb,
+0x0e,0xf6,0x00,0x00,0xff,0x60,0xaf,0xc0,0x00,0x5f,0xf1,0x05,0xff,0x20,0x0b,0xff,
+0xff,0xff,0xf7,0x01,0xff,0xff,0xff,0xff,0xd0,0x6f,0xf2,0x00,0x05,0xff,0x2c,0xfb,
+0x00,0x00,0x0e,0xf8,0xff,0xff,0xfd,0x80,0x0f,0xff,0xff,0xff,0xb0,0xff,0x50,0x08,
+0xff,0x1f,0xf5,0x00,0x2f,0xf2,0xff,0x50,0x08,0xfe,0x0f,0xff,0xff,0xfe,0x30,0xff,
+0xdc,0xcf,0xfa,0x0f,0xf5,0x00,0x2f,0xf4,0xff,0x50,0x00,0xef,0x7f,0xf5,0x00,0x5f,
+0xf5,0xff,0xff,0xff,0xfd,0x0f,0xff,0xff,0xd9,0x10,0x00,0x19,0xef,0xe9,0x10,0x01,
+0xdf,0xff,0xff,0xd1,0x0a,0xfe,0x30,0x3e,0xf8,0x0f,0xf6,0x00,0x08,0xfd,0x3f,0xf2,
+0x00,0x00,0x21,0x4f,0xf0,0xa3,0x00,0x00,0x05,0x00,0x00,0x0f,0x00,0xf1,0x01,0x11,
+0x0f,0xf5,0x00,0x08,0xfd,0x0a,0xfd,0x30,0x3e,0xf9,0x01,0xef,0xff,0xff,0xd1,0x37,
+0x00,0x00,0x40,0x00,0x02,0x60,0x00,0x30,0x50,0x3c,0xfd,0x60,0x00,0xf0,0x1a,0xf5,
+0xff,0x50,0x00,0xcf,0x9f,0xf5,0x00,0x0a,0xfb,0xff,0x50,0x00,0xaf,0xbf,0xf5,0x00,
+0x0c,0xf9,0xff,0x50,0x02,0xff,0x5f,0xf5,0x03,0xcf,0xd0,0xff,0xff,0xff,0xe3,0x0f,
+0xff,0xfe,0x92,0x00,0xff,0xff,0xff,0xfa,0x89,0x03,0x44,0xff,0x50,0x00,0x00,0x04,
+0x00,0x00,0xcb,0x00,0x4b,0xff,0xfe,0xee,0xc0,0x14,0x00,0x13,0xf9,0x2c,0x00,0x11,
+0xf6,0x04,0x00,0x0c,0x30,0x00,0x00,0x04,0x00,0x08,0x14,0x00,0x03,0x04,0x00,0xf0,
+0x09,0x00,0x18,0xdf,0xea,0x20,0x00,0x1d,0xff,0xff,0xfe,0x10,0x09,0xff,0x40,0x2e,
+0xf9,0x00,0xef,0x70,0x00,0x6f,0xe0,0x2f,0xf3,0x76,0x02,0x10,0xff,0x5b,0x02,0xf0,
+0x09,0x4f,0xf2,0x07,0xff,0xff,0x02,0xff,0x30,0x5d,0xdf,0xf0,0x0e,0xf8,0x00,0x05,
+0xff,0x00,0x8f,0xf5,0x00,0x8f,0xf0,0x00,0xdf,0x4a,0x03,0x40,0x00,0x8d,0xfe,0xc6,
+0x46,0x00,0x2f,0x1f,0xf4,0x05,0x00,0x02,0x00,0x21,0x05,0x02,0x05,0x00,0x0f,0x23,
+0x00,0x05,0x3b,0xdf,0x8d,0xf8,0x03,0x00,0x4f,0x00,0x00,0x06,0xff,0x04,0x00,0x09,
+0xf0,0x01,0x6a,0x70,0x06,0xfe,0x8f,0xe1,0x1c,0xfb,0x1f,0xff,0xff,0xf3,0x02,0xbe,
+0xfc,0x40,0x32,0x01,0xf0,0x09,0xc0,0xff,0x50,0x0c,0xfe,0x10,0xff,0x50,0x8f,0xf4,
+0x00,0xff,0x54,0xff,0x80,0x00,0xff,0x7e,0xfc,0x00,0x00,0xff,0xef,0xf5,0xfa,0x00,
+0xf0,0x08,0xfd,0x00,0x00,0xff,0xf8,0xff,0x70,0x00,0xff,0x80,0xaf,0xf2,0x00,0xff,
+0x50,0x1e,0xfb,0x00,0xff,0x50,0x06,0xff,0x50,0x7b,0x01,0x1e,0xe1,0x10,0x01,0x0e,
+0x04,0x00,0x03,0x40,0x01,0x11,0xf5,0x04,0x00,0x40,0xf3,0x00,0x00,0x4f,0x74,0x05,
+0x40,0x00,0x9f,0xff,0xff,0x05,0x05,0xf0,0x1a,0xff,0xff,0xdf,0x40,0x04,0xfd,0xff,
+0xff,0x9f,0x90,0x09,0xf9,0xff,0xff,0x4f,0xe0,0x0e,0xf4,0xff,0xff,0x4b,0xf4,0x4f,
+0xb4,0xff,0xff,0x45,0xf9,0x9f,0x54,0xff,0xff,0x50,0xfe,0xef,0x05,0xff,0xff,0x50,
+0xaf,0xfa,0x06,0x00,0x30,0x5f,0xf5,0x05,0x04,0x04,0x50,0xf0,0x05,0xff,0xff,0xa0,
+0x00,0x01,0x10,0xf3,0x05,0x00,0x11,0xfc,0x28,0x01,0xf0,0x0d,0x60,0x1f,0xf4,0xff,
+0xcf,0xe0,0x1f,0xf4,0xff,0x5d,0xf8,0x1f,0xf4,0xff,0x54,0xff,0x3f,0xf4,0xff,0x50,
+0xaf,0xcf,0xf4,0xff,0x50,0x2f,0xff,0xf4,0xa0,0x02,0x01,0x8a,0x02,0x00,0x05,0x00,
+0xf0,0x21,0x5f,0xf4,0x00,0x08,0xdf,0xd8,0x10,0x00,0x0d,0xff,0xff,0xfd,0x10,0x09,
+0xff,0x51,0x4e,0xf9,0x00,0xff,0x70,0x00,0x7f,0xf0,0x3f,0xf2,0x00,0x02,0xff,0x34,
+0xff,0x10,0x00,0x0f,0xf5,0x4f,0xf1,0x00,0x00,0xff,0x53,0xff,0x20,0x00,0x2f,0xf3,
+0x0f,0xf7,0x35,0x01,0x70,0x9f,0xf5,0x04,0xef,0x90,0x00,0xdf,0x87,0x02,0x53,0x00,
+0x8d,0xfd,0x81,0x00,0xfa,0x02,0x00,0x0f,0x02,0xf0,0x01,0x05,0xff,0x6f,0xf5,0x00,
+0x0b,0xfa,0xff,0x50,0x00,0xbf,0xbf,0xf5,0x00,0x4f,0xf7,0xe8,0x02,0x50,0x1f,0xff,
+0xff,0xe9,0x10,0xf6,0x00,0x10,0x0f,0x57,0x03,0x05,0x09,0x00,0x20,0x00,0x08,0xd8,
+0x05,0x13,0x1d,0x78,0x00,0x18,0x5f,0x78,0x00,0x20,0x35,0xff,0x24,0x00,0x28,0x5f,
+0xf0,0x78,0x00,0x57,0x07,0xff,0x00,0x9f,0xf4,0x78,0x00,0x20,0xff,0xfd,0x4c,0x02,
+0x20,0x2d,0xfe,0xcc,0x03,0x90,0x0a,0x50,0xff,0xff,0xfd,0x70,0x0f,0xff,0xff,0xb9,
+0x01,0x60,0x07,0xff,0x4f,0xf5,0x00,0x0f,0xaf,0x02,0x00,0x8c,0x00,0x20,0x8f,0xf2,
+0xad,0x03,0x10,0x0f,0x64,0x01,0xc0,0xff,0x50,0x7f,0xf1,0x0f,0xf5,0x00,0xef,0x80,
+0xff,0x50,0x06,0xa1,0x03,0xf0,0x11,0x0e,0xf9,0x00,0x5c,0xff,0xc6,0x00,0x07,0xff,
+0xff,0xff,0x80,0x0f,0xf9,0x00,0x8f,0xf1,0x1f,0xf5,0x00,0x1a,0xa2,0x0c,0xfe,0x60,
+0x00,0x00,0x02,0xdf,0xff,0xa2,0x00,0xc5,0x04,0x10,0x40,0xdf,0x08,0xc0,0xe0,0x5d,
+0xc0,0x00,0x2f,0xf3,0x2f,0xf7,0x00,0x6f,0xf2,0x09,0xe1,0x03,0x60,0x00,0x5c,0xff,
+0xd7,0x00,0xbf,0x20,0x03,0x20,0xaf,0xff,0x59,0x00,0x10,0x04,0xf0,0x05,0x0f,0x05,
+0x00,0x19,0x5f,0x1f,0xf4,0x00,0x0b,0xfa,0x05,0x00,0x0f,0xc1,0xf9,0x0f,0xf5,0x00,
+0x0d,0xf8,0x0c,0xfc,0x20,0x5f,0xf5,0x03,0x78,0x00,0xf2,0x00,0x3b,0xff,0xd8,0x00,
+0xcf,0xc0,0x00,0x05,0xff,0x37,0xff,0x10,0x00,0xaf,0xe0,0xc4,0x00,0xf0,0x0f,0xcf,
+0xa0,0x03,0xff,0x40,0x07,0xfe,0x00,0x8f,0xe0,0x00,0x2f,0xf3,0x0c,0xf9,0x00,0x00,
+0xcf,0x81,0xff,0x40,0x00,0x07,0xfc,0x5f,0xe0,0x00,0x00,0x2f,0xfc,0xf9,0x06,0x01,
+0xc7,0x00,0x30,0x07,0xff,0xe0,0x46,0x07,0x10,0xf9,0x7c,0x06,0xf0,0x31,0x01,0xff,
+0x10,0x0b,0xfa,0x6f,0xe0,0x04,0xff,0x50,0x0d,0xf6,0x3f,0xf1,0x08,0xff,0x90,0x0f,
+0xf3,0x0f,0xf3,0x0b,0xff,0xc0,0x3f,0xf0,0x0c,0xf6,0x0f,0xed,0xf0,0x6f,0xc0,0x09,
+0xf9,0x2f,0xaa,0xf3,0x9f,0x90,0x05,0xfc,0x6f,0x66,0xf7,0xcf,0x60,0x02,0xff,0xaf,
+0x32,0xfa,0xff,0x20,0x00,0xef,0xff,0x00,0xff,0xff,0x00,0x00,0xbf,0xfb,0x03,0x00,
+0x60,0x00,0x8f,0xf8,0x00,0x7f,0xf8,0x22,0x05,0xf0,0x08,0x00,0x4f,0xf5,0x00,0x7f,
+0xf3,0x00,0x1f,0xfa,0x0d,0xfb,0x00,0x8f,0xf1,0x05,0xff,0x41,0xff,0x80,0x00,0xcf,
+0xc9,0xfe,0x4d,0x05,0xb0,0xf6,0x00,0x00,0x0a,0xff,0xd0,0x00,0x00,0x0b,0xff,0xe0,
+0xe9,0x02,0xf0,0x1f,0xf7,0x00,0x00,0xdf,0xb8,0xff,0x10,0x06,0xff,0x31,0xff,0x90,
+0x0e,0xfa,0x00,0x8f,0xf2,0x8f,0xf2,0x00,0x0e,0xfb,0xbf,0xc0,0x00,0x0e,0xfa,0x4f,
+0xf3,0x00,0x5f,0xf2,0x0c,0xfa,0x00,0xcf,0xa0,0x04,0xff,0x23,0xff,0x20,0x00,0xcf,
+0x8a,0xfa,0x32,0x00,0x10,0xf3,0xf5,0x07,0x10,0xb0,0xdd,0x09,0x10,0x30,0x3b,0x01,
+0x1b,0x20,0x05,0x00,0x00,0xd9,0x08,0x30,0xff,0xf1,0x6f,0x7a,0x06,0x00,0x59,0x07,
+0xa0,0x60,0x00,0x00,0x0c,0xfb,0x00,0x00,0x00,0x7f,0xf2,0x0e,0x00,0x00,0x08,0x08,
+0x00,0x7d,0x07,0x60,0x6f,0xf2,0x00,0x00,0x01,0xff,0xfd,0x07,0x10,0xfd,0x53,0x05,
+0x00,0x05,0x0b,0x10,0x6f,0x05,0x00,0xaf,0x0d,0xdd,0x41,0xff,0xf5,0x1f,0xf3,0x01,
+0xff,0x30,0x05,0x00,0x0a,0xf2,0x03,0xd4,0x1f,0xff,0x50,0xdf,0x70,0x00,0x00,0x7f,
+0xd0,0x00,0x00,0x1f,0xf3,0x00,0x00,0x0b,0xf9,0x5b,0x07,0x01,0xca,0x02,0x00,0x1e,
+0x08,0x00,0x20,0x03,0x20,0x0e,0xf6,0xa4,0x06,0x03,0xdd,0x07,0xbf,0xcf,0x80,0x00,
+0x00,0x6f,0xd0,0xbd,0xd6,0xef,0xf7,0x0c,0x02,0x00,0x06,0xf0,0x25,0xbf,0xf7,0xef,
+0xf7,0x00,0x8f,0x80,0x00,0x0e,0xfe,0x00,0x04,0xfc,0xf4,0x00,0xaf,0x2f,0xa0,0x1f,
+0xa0,0xaf,0x17,0xf5,0x04,0xf7,0xdd,0xdd,0xdd,0xd1,0xff,0xff,0xff,0xf2,0x38,0x80,
+0x00,0xbf,0x80,0x00,0xdf,0x20,0x01,0x9e,0xfc,0x50,0x00,0xcf,0xed,0xff,0x40,0x3f,
+0xf1,0x7a,0x00,0xf3,0x0d,0x01,0x9f,0xb0,0x04,0xcf,0xff,0xfb,0x02,0xff,0x74,0xaf,
+0xb0,0x6f,0xd0,0x0a,0xfb,0x03,0xff,0xee,0xff,0xb0,0x05,0xdf,0xb7,0xfe,0x00,0x2f,
+0xf2,0x7f,0x00,0x02,0x09,0x00,0xf0,0x08,0x7d,0xfb,0x10,0x2f,0xff,0xff,0xfc,0x02,
+0xff,0x60,0x4f,0xf3,0x2f,0xf2,0x00,0xdf,0x52,0xff,0x20,0x0c,0xf7,0x2f,0xf2,0x4b,
+0x08,0x32,0x60,0x3f,0xf3,0x1b,0x00,0xf0,0x06,0x6e,0xfb,0x10,0x00,0x8e,0xfd,0x50,
+0x0a,0xff,0xff,0xf5,0x2f,0xf4,0x08,0xfc,0x6f,0xd0,0x01,0x65,0x7f,0xc0,0xbc,0x00,
+0xe9,0x00,0x22,0x2f,0xf4,0x07,0xfc,0x0a,0xff,0xef,0xf6,0x00,0x8e,0xfd,0x60,0x58,
+0x00,0x50,0x20,0x1a,0xfd,0x7f,0xf2,0x02,0x07,0xf0,0x0b,0x22,0xff,0x50,0x7f,0xf2,
+0x5f,0xe0,0x02,0xff,0x27,0xfc,0x00,0x2f,0xf2,0x5f,0xd0,0x02,0xff,0x22,0xff,0x30,
+0x5f,0xf2,0x0b,0xff,0xdf,0x24,0x00,0xf0,0x05,0x6f,0xf2,0x00,0x6d,0xfd,0x70,0x00,
+0x8f,0xff,0xff,0x70,0x1f,0xf5,0x04,0xff,0x05,0xff,0x99,0x9f,0xf2,0x76,0x01,0x20,
+0x35,0xff,0xee,0x0b,0x30,0xf9,0x00,0x85,0x1b,0x00,0xfe,0x09,0xd0,0x00,0x6d,0xfe,
+0xa1,0x00,0x00,0x6d,0xfa,0x04,0xff,0xfa,0x07,0xfd,0x00,0xcf,0xff,0xf7,0x8d,0xfe,
+0xb5,0x08,0xfc,0x00,0x03,0x00,0xf2,0x06,0x00,0xaf,0xe7,0xdf,0x40,0xaf,0xff,0xff,
+0xf4,0x2f,0xf6,0x04,0xff,0x45,0xfe,0x00,0x0f,0xf4,0x6f,0xd0,0x00,0x09,0x00,0x00,
+0x12,0x00,0x01,0x1b,0x00,0xf0,0x05,0x00,0x9f,0xe7,0xff,0x30,0x15,0x00,0x6f,0xf1,
+0x0b,0xff,0xef,0xf9,0x00,0x1a,0xef,0xd7,0x00,0x3f,0xf1,0x74,0x06,0x23,0x10,0x00,
+0x09,0x00,0xf0,0x06,0x5d,0xfb,0x20,0x3f,0xff,0xff,0xfb,0x03,0xff,0x50,0x6f,0xf0,
+0x3f,0xf1,0x02,0xff,0x13,0xff,0x10,0x2f,0xf2,0x09,0x00,0x19,0x23,0x09,0x00,0x8c,
+0x0c,0xe2,0x1f,0xf4,0x04,0x50,0x0f,0xf4,0x02,0x00,0x70,0x00,0xde,0x20,0x1f,0xf4,
+0x00,0x45,0xfa,0x0a,0x2d,0xff,0x40,0x05,0x00,0x7c,0x02,0xff,0x3b,0xff,0xe0,0xaf,
+0xc3,0x87,0x01,0xf0,0x02,0x20,0xaf,0xe1,0x2f,0xf2,0x7f,0xf3,0x02,0xff,0x6f,0xf6,
+0x00,0x2f,0xff,0xfa,0x00,0x02,0xf6,0x00,0xfe,0x03,0x2f,0xfc,0xef,0x70,0x02,0xff,
+0x26,0xff,0x20,0x2f,0xf2,0x0c,0xfc,0x02,0xff,0x20,0x3f,0xf6,0x6e,0x00,0x02,0x02,
+0x00,0xff,0x12,0x2f,0xf4,0xdf,0xc2,0x6e,0xfb,0x12,0xff,0xff,0xff,0xef,0xff,0xfa,
+0x2f,0xf6,0x06,0xff,0x50,0x8f,0xe2,0xff,0x20,0x3f,0xf0,0x04,0xff,0x2f,0xf2,0x03,
+0xff,0x00,0x4f,0xf2,0x0d,0x00,0x06,0x10,0xf0,0x3b,0x00,0x10,0x02,0x13,0x05,0x00,
+0x37,0x00,0xa0,0x02,0xff,0x10,0x2f,0xf1,0x2f,0xf1,0x02,0xff,0x22,0xe2,0x00,0x09,
+0x09,0x00,0x50,0x20,0x00,0x7d,0xfd,0x70,0x80,0x06,0xf0,0x0a,0x90,0x2f,0xf6,0x05,
+0xff,0x26,0xfe,0x00,0x0d,0xf6,0x7f,0xc0,0x00,0xcf,0x86,0xfe,0x00,0x0d,0xf7,0x2f,
+0xf5,0x05,0xff,0x30,0x9f,0x5f,0x06,0xf0,0x10,0x7d,0xfe,0x80,0x00,0x2f,0xf7,0xdf,
+0xb1,0x02,0xff,0xfd,0xff,0xb0,0x2f,0xf4,0x03,0xff,0x32,0xff,0x20,0x0d,0xf5,0x2f,
+0xf2,0x00,0xcf,0x72,0xff,0x20,0x0e,0xf5,0x3b,0x00,0x10,0x22,0xa4,0x04,0x48,0x2f,
+0xf7,0xdf,0xa1,0xff,0x00,0xf0,0x01,0x00,0x00,0x01,0xaf,0xe6,0xef,0x20,0xbf,0xff,
+0xff,0xf2,0x3f,0xf5,0x06,0xff,0x25,0xa8,0x02,0x32,0x7f,0xc0,0x02,0x09,0x00,0x41,
+0x2f,0xf5,0x06,0xff,0x1b,0x00,0x39,0x01,0xaf,0xd7,0x34,0x00,0x21,0x2f,0xf2,0xf2,
+0x0b,0xab,0xea,0x2f,0xff,0xfa,0x2f,0xfa,0x31,0x2f,0xf2,0x00,0x03,0x00,0xf0,0x17,
+0x02,0xae,0xfc,0x40,0x0d,0xfd,0xcf,0xf3,0x3f,0xf0,0x0a,0xd7,0x1f,0xfa,0x51,0x00,
+0x05,0xef,0xff,0x90,0x00,0x04,0x8f,0xf7,0x7f,0xb0,0x0a,0xf9,0x2f,0xfc,0xbf,0xf4,
+0x03,0xbf,0xfc,0x50,0x0b,0xf9,0xab,0x03,0x62,0xef,0xff,0xf0,0xae,0xfe,0xb0,0x0c,
+0x00,0x02,0x03,0x00,0x9e,0x0a,0xfa,0x00,0x07,0xff,0xf1,0x01,0xbf,0xe1,0xfa,0x01,
+0x14,0x3f,0x18,0x01,0xf0,0x01,0x1f,0xf4,0x06,0xff,0x20,0xdf,0xff,0xff,0xf2,0x02,
+0xcf,0xd6,0xff,0x20,0xbf,0x90,0x1c,0x03,0xf0,0x36,0x0c,0xf7,0x1f,0xf1,0x1f,0xf2,
+0x0c,0xf6,0x5f,0xd0,0x07,0xfa,0x9f,0x80,0x02,0xfe,0xdf,0x30,0x00,0xdf,0xfe,0x00,
+0x00,0x8f,0xf9,0x00,0x00,0x3f,0xf4,0x00,0xaf,0x70,0x1f,0xd0,0x0c,0xf6,0x6f,0xb0,
+0x5f,0xf1,0x0f,0xf2,0x2f,0xe0,0xaf,0xf5,0x2f,0xe0,0x0e,0xf1,0xee,0xfa,0x5f,0xa0,
+0x0b,0xf6,0xf8,0xce,0x8f,0x60,0x07,0xfe,0xf3,0x8f,0xef,0x30,0x03,0xff,0xf0,0x60,
+0x0a,0x40,0xff,0xa0,0x0f,0xfb,0xe2,0x0d,0xf0,0x1d,0x0a,0xf7,0x00,0x7f,0xe0,0x0c,
+0xfa,0x00,0xef,0x74,0xff,0x20,0x05,0xff,0xdf,0x80,0x00,0x0d,0xff,0xe1,0x00,0x00,
+0x7f,0xfa,0x00,0x00,0x0e,0xff,0xf2,0x00,0x07,0xfe,0xbf,0xa0,0x01,0xff,0x63,0xff,
+0x30,0x8f,0xd0,0x0a,0xfc,0x00,0xf0,0x41,0xcf,0x90,0x08,0xfd,0x07,0xfe,0x00,0xdf,
+0x70,0x1f,0xf2,0x1f,0xf2,0x00,0xcf,0x76,0xfc,0x00,0x06,0xfb,0xaf,0x70,0x00,0x1f,
+0xff,0xf2,0x00,0x00,0xbf,0xfc,0x00,0x00,0x06,0xff,0x60,0x00,0x00,0x1f,0xf1,0x00,
+0x00,0x08,0xfb,0x00,0x00,0x1f,0xff,0x50,0x00,0x01,0xee,0x70,0x00,0x00,0x4f,0xff,
+0xff,0xf7,0x4e,0xee,0xff,0xf5,0x00,0x00,0xdf,0xb0,0x00,0x08,0xfe,0x10,0x00,0x4f,
+0xf4,0x00,0x01,0xef,0x90,0x00,0x0a,0xfd,0x1c,0x00,0xf0,0x05,0xee,0xe8,0x6f,0xff,
+0xff,0xf9,0x00,0x05,0x80,0x00,0x7f,0xc0,0x00,0xff,0x10,0x02,0xfd,0x00,0x03,0xfc,
+0x03,0x00,0xe3,0x06,0xfa,0x00,0x7f,0xf3,0x00,0xaf,0xc0,0x00,0x09,0xf8,0x00,0x04,
+0xfc,0x15,0x00,0xd9,0x01,0xff,0x00,0x00,0xaf,0x90,0x00,0x0a,0xc0,0x00,0x00,0x00,
+0xab,0x01,0x00,0xf0,0x0c,0x01,0x57,0x00,0x07,0xfb,0x00,0x0c,0xf4,0x00,0x8f,0x70,
+0x08,0xf8,0x00,0x8f,0x80,0x05,0xfb,0x00,0x0c,0xfb,0x00,0x8f,0xe0,0x4f,0xd1,0x07,
+0x0f,0x00,0xf0,0x18,0x08,0xf7,0x00,0xaf,0x50,0x4f,0xe0,0x08,0xc2,0x00,0x00,0x00,
+0x00,0x01,0xae,0xa0,0x01,0x94,0x0a,0xff,0xfc,0x27,0xf6,0x0f,0xd1,0x8f,0xff,0xf1,
+0x1a,0x50,0x07,0xed,0x40,0x00,0x00,0x00,0x04,0x20,0x00,0x01,0x00,0x22,0x0e,0xe2,
+0x07,0x00,0xf0,0x03,0xfe,0x30,0x00,0x16,0x77,0x77,0x7f,0x7c,0xe3,0x00,0x6f,0xee,
+0xee,0xee,0x40,0xbf,0x30,0x7e,0x17,0x00,0x31,0x0b,0xf4,0x7e,0x43,0x00,0x11,0xfc,
+0x07,0x00,0xf2,0x00,0x1c,0xe2,0x6f,0xff,0xff,0xff,0x41,0xce,0x20,0x05,0x55,0x55,
+0x5f,0x8d,0xe2,0x38,0x00,0x11,0x20,0x07,0x00,0x11,0xd1,0x46,0x00,0x20,0x03,0x10,
+0x06,0x00,0x21,0x05,0xb0,0x0d,0x00,0x30,0x4f,0xf0,0x00,0x67,0x00,0x11,0xfc,0x07,
 0x00,0xe1,0x3f,0x95,0xfe,0xee,0xee,0xea,0x02,0xea,0x00,0x67,0x77,0x77,0xae,0x1e,
-0x21,0x00,0x31,0x7e,0x4f,0x60,0x07,0x00,0x21,0x08,0xf4,0x07,0x00,0x40,0x00,0x9f,
-0x33,0xff,0xe9,0x09,0xa2,0x0a,0xe8,0xf5,0x55,0x55,0x52,0x00,0x00,0xaf,0xf0,0x21,
-0x0d,0x12,0xf0,0x17,0x0d,0x21,0x30,0x00,0x89,0x00,0x01,0x6e,0x00,0x20,0x3e,0xe3,
-0x6c,0x00,0x30,0xeb,0xbe,0x30,0xaf,0x0c,0x40,0x0b,0xf3,0x00,0x03,0xdb,0x01,0xff,
-0x0a,0x30,0x3f,0xb0,0x00,0x00,0x0b,0xf3,0xef,0xff,0x30,0x03,0xff,0xfe,0x35,0x5f,
-0x50,0x05,0xf5,0x53,0x00,0x0f,0x50,0x05,0xf0,0x00,0x06,0x00,0x01,0x70,0x85,0x58,
-0xf0,0x00,0x00,0x0d,0xff,0x27,0x07,0x30,0x03,0x55,0x55,0x3c,0x10,0x2e,0xff,0xff,
-0x2a,0x00,0x0a,0x06,0x00,0xc0,0xce,0xef,0x50,0x05,0xfe,0xec,0xaf,0xb6,0x00,0x00,
-0x6b,0xfa,0x11,0x10,0x70,0x4f,0xb0,0x00,0xbf,0x40,0x04,0xfb,0x75,0x00,0x00,0x7b,
-0x00,0x00,0xa0,0x07,0x00,0xb0,0x00,0x17,0xb0,0xd2,0x29,0x12,0x11,0x07,0x00,0x12,
-0x88,0xbc,0x00,0x00,0x15,0x05,0x00,0xe9,0x0c,0x20,0x90,0x00,0x69,0x03,0x20,0xcc,
-0xf2,0x07,0x00,0x30,0xaf,0x44,0xfa,0x0f,0x0d,0x40,0xfb,0x00,0xbf,0x20,0x49,0x00,
-0x10,0x00,0x4a,0x00,0x20,0x3f,0xa0,0x0b,0x11,0x30,0x00,0xbf,0x20,0x18,0x00,0x11,
-0x04,0x46,0x0f,0xb0,0x40,0x0c,0xfe,0xdd,0xdd,0xdd,0xef,0xc0,0x5f,0xff,0xff,0xc3,
-0x0a,0x01,0x4f,0x00,0x02,0x51,0x0d,0x10,0x9f,0x59,0x0d,0xf0,0x3c,0x02,0x26,0xf7,
-0x4d,0xb0,0x00,0x04,0xdf,0xbb,0xd0,0x07,0xf0,0x00,0x6f,0xc4,0x0d,0xf5,0x2c,0xd0,
-0x02,0xfa,0x00,0x0f,0xff,0xfe,0x30,0x0a,0xe0,0x00,0x3f,0xff,0xc6,0x60,0x0e,0x80,
-0x00,0x6f,0xf8,0x08,0xe0,0x0f,0x60,0x00,0x9e,0x40,0x06,0xf0,0x0e,0x80,0x00,0x71,
-0x00,0x08,0xe0,0x0a,0xd0,0x00,0x00,0x00,0x0d,0xa0,0x03,0xf8,0x00,0x00,0x00,0x8f,
-0x30,0x00,0x7f,0xa3,0x00,0x3a,0xf7,0x00,0xd7,0x03,0x20,0xfe,0x50,0xb9,0x01,0x20,
-0x66,0x40,0x66,0x00,0xf0,0x14,0x66,0x66,0x63,0x00,0x00,0x00,0x20,0xcf,0xff,0xf2,
-0x50,0x00,0x03,0xf8,0x1e,0xff,0x65,0xf9,0x00,0x16,0xb8,0x03,0xfb,0x02,0xa7,0x70,
-0x6f,0xa0,0x00,0x51,0x00,0x3f,0xb0,0x49,0x30,0x5b,0x11,0x30,0x93,0xef,0x20,0x5e,
-0x0a,0x30,0xf6,0x49,0x10,0x0e,0x00,0x31,0x71,0xaf,0x60,0x3d,0x02,0xf0,0x0b,0x36,
-0xa1,0x00,0x00,0x00,0x6b,0x30,0x0a,0xf8,0x20,0x00,0x06,0x8f,0x50,0x01,0x4c,0xe7,
-0x68,0x8f,0xb1,0x00,0x00,0x0a,0x6e,0xac,0xc6,0x62,0x00,0x36,0x06,0x44,0x40,0x2b,
-0x01,0xf0,0x1c,0x8e,0x34,0x78,0x61,0x00,0x00,0x07,0xfd,0xff,0xfe,0xff,0x91,0x00,
-0x6f,0x70,0xbf,0x40,0x06,0xed,0x10,0x8f,0x50,0x0a,0xf5,0x00,0x2e,0xb0,0x0d,0xf6,
-0x00,0xed,0x00,0x03,0xf4,0x1f,0xcf,0x7a,0xf4,0x00,0x00,0xd9,0x3f,0x37,0x5a,0x09,
-0x40,0xab,0x3f,0x20,0x53,0x16,0x03,0x20,0x1f,0x50,0x3d,0x00,0x30,0xd8,0x0b,0xc0,
-0xb2,0x00,0x20,0xf3,0x02,0xcb,0x00,0xf0,0x00,0x2e,0xa0,0x00,0x6f,0xb4,0x00,0x17,
-0xfc,0x10,0x00,0x03,0xcf,0xff,0xff,0x80,0x5f,0x01,0x21,0x56,0x40,0x8e,0x01,0x10,
-0x10,0xf0,0x00,0x00,0x5f,0x0d,0xf0,0x00,0x00,0x2f,0xe9,0x99,0x9b,0xf4,0x00,0x7f,
-0x70,0x00,0x09,0xd0,0x00,0xcf,0x10,0x3a,0x12,0xf0,0x1f,0xfc,0x00,0x00,0x9f,0x10,
-0x00,0x9f,0x10,0x1c,0xd3,0x00,0x06,0xff,0x70,0xe9,0x00,0x00,0x3f,0x8c,0x75,0xf9,
-0x00,0x00,0xbc,0x0e,0x2c,0xaf,0x00,0x00,0xd9,0x2d,0x1a,0x3f,0x20,0x00,0xbc,0x01,
-0x00,0x6f,0x00,0x00,0x4f,0x80,0x04,0xe9,0x00,0xc1,0x0a,0x00,0xe9,0x01,0x31,0x27,
-0x74,0x00,0xc6,0x01,0x21,0xff,0xa0,0x06,0x00,0x90,0xb1,0x10,0x1f,0xee,0xed,0xdd,
-0xdd,0xf2,0x1d,0x15,0x00,0xd1,0xb2,0x1d,0x01,0x77,0x77,0x60,0xb2,0x1d,0x03,0xff,
-0xff,0xe0,0xb3,0x12,0x00,0x11,0xb3,0x12,0x00,0x12,0xb3,0x12,0x00,0x11,0x1e,0x12,
-0x00,0xc4,0x0e,0x11,0x11,0x11,0x11,0xb3,0x0d,0xdd,0xff,0xff,0xec,0xc2,0x48,0x00,
-0x31,0x7b,0xbb,0x70,0x47,0x03,0x40,0xbd,0xdb,0x50,0x07,0x16,0x0b,0xd0,0xff,0xf0,
-0x0f,0xd3,0x2f,0xfa,0x30,0x03,0x20,0x0e,0x4d,0xef,0x80,0x6d,0x03,0x31,0x00,0x8f,
-0x40,0x07,0x00,0x21,0x03,0xd9,0x07,0x00,0x30,0x00,0x1e,0x90,0x07,0x00,0x21,0x02,
-0xd7,0x0e,0x00,0x11,0x5d,0x1c,0x00,0x20,0x08,0xfd,0x43,0x00,0x50,0x0f,0xca,0xaf,
-0xa0,0x00,0x15,0x13,0x60,0x0d,0xfd,0x63,0x37,0x60,0x03,0x61,0x00,0x01,0x92,0x0a,
-0xf1,0x1a,0x02,0x7a,0xa7,0x10,0xbd,0xef,0xfd,0xdd,0xdd,0xf1,0xc2,0x6f,0xe0,0x00,
-0x11,0xc2,0xc2,0x39,0x80,0x1a,0xff,0xf2,0xc2,0x16,0x52,0xef,0xff,0xf2,0xc2,0x6f,
-0xf0,0x19,0xff,0xf2,0xc2,0x5f,0xe0,0x00,0x11,0xb2,0xc2,0xc8,0x00,0x30,0xc2,0x5f,
-0xe0,0x06,0x00,0x20,0x6f,0xf0,0x06,0x00,0x20,0x15,0x40,0x06,0x00,0x21,0x4f,0xe0,
-0x18,0x00,0x00,0x12,0x00,0x70,0xcc,0xdf,0xfc,0xcc,0xcc,0xf1,0x01,0xc8,0x00,0x00,
-0x60,0x01,0x11,0x22,0x08,0x04,0xf0,0x36,0xbf,0xff,0xfa,0x20,0x00,0x00,0x7f,0xea,
-0xce,0x8d,0xf5,0x00,0x06,0xf9,0x03,0xbd,0x10,0xaf,0x30,0x1f,0xa0,0x04,0xbd,0x10,
-0x0c,0xd0,0x7f,0x10,0x04,0xce,0x10,0x03,0xf3,0xab,0x00,0x02,0xcc,0x00,0x00,0xe7,
-0xba,0x00,0x36,0x00,0xb9,0x00,0xc8,0xab,0x05,0xeb,0x76,0xc8,0xd3,0xe7,0x7f,0x8e,
-0x5c,0x61,0xbb,0x5d,0xf4,0x1f,0xd4,0xd5,0x00,0x05,0xdc,0xd0,0x06,0x7f,0x0a,0x81,
-0x9f,0x30,0x00,0x7f,0xc6,0x33,0x6d,0xf4,0x54,0x00,0x11,0xf9,0xfe,0x03,0x16,0x22,
-0x09,0x04,0x40,0x01,0xaf,0xfe,0x60,0x31,0x15,0x30,0xd4,0x28,0xf5,0x64,0x04,0xf0,
-0x16,0x20,0x00,0x9c,0x00,0x32,0x00,0x5f,0x00,0x00,0x6e,0x3e,0xff,0x90,0x3f,0x30,
-0x00,0xac,0xdf,0xff,0xf4,0x0c,0xe5,0x28,0xf5,0xff,0xff,0xf8,0x00,0xaf,0xff,0xd3,
-0xdf,0xff,0xf5,0x00,0xce,0xa9,0x31,0x07,0x40,0x0a,0xd1,0x1d,0xff,0x25,0x09,0x20,
-0x40,0xbf,0xcb,0x0a,0x21,0x5e,0x05,0x55,0x03,0x30,0x7c,0x1b,0xff,0xb7,0x0c,0xa9,
-0x6f,0xff,0xdd,0xdd,0xdd,0xdd,0xd6,0x02,0x22,0x00,0x01,0x00,0x22,0x06,0x90,0xc5,
-0x03,0x12,0xda,0x0f,0x00,0x22,0x1c,0xb0,0x0f,0x00,0x90,0xcc,0x00,0x00,0x3c,0xbb,
-0xbb,0xba,0xbf,0xc1,0xe4,0x0a,0x00,0x57,0x0d,0x20,0x14,0x44,0x01,0x00,0x10,0x30,
-0x3c,0x0c,0x00,0x1f,0x09,0x92,0x3e,0xfd,0xde,0xee,0xef,0xf4,0x00,0x02,0xea,0x37,
-0x00,0x22,0x1d,0xa0,0x37,0x00,0x13,0xdb,0x46,0x00,0x05,0x08,0x12,0x07,0x69,0x00,
-0x22,0xee,0xb6,0x09,0x00,0x21,0x49,0xe8,0x0e,0x00,0x30,0xa4,0x19,0xd2,0x32,0x00,
-0x30,0x5b,0xd3,0x30,0xd8,0x12,0x21,0x60,0x45,0x55,0x05,0x10,0xbc,0xf3,0x0f,0x30,
-0xa8,0x9c,0x71,0x07,0x05,0xf0,0x10,0x00,0x01,0xcd,0x10,0x00,0x1e,0xf2,0x5f,0xd0,
-0x3f,0xc0,0x00,0x5f,0xf0,0xbf,0xf3,0x1f,0xf1,0x00,0x0d,0xf3,0x4e,0xb0,0x4f,0xa0,
-0x00,0x02,0xdd,0x10,0x02,0xdc,0x90,0x03,0x91,0xcb,0xab,0x60,0x00,0x00,0x01,0x33,
-0x33,0x32,0xe9,0x04,0xf0,0x0d,0xff,0x70,0x00,0x1f,0x63,0x33,0xc8,0xf7,0x00,0x1f,
-0x40,0x00,0xe0,0x6f,0x70,0x1f,0x40,0x00,0xed,0xd7,0xf1,0x1f,0x40,0x00,0x01,0x13,
-0xf1,0x1f,0x7c,0x0d,0x0f,0x06,0x00,0x0d,0x72,0x74,0x44,0x44,0x47,0xf1,0x0e,0xff,
-0x01,0x0c,0x02,0xf8,0x05,0x20,0xbd,0xb4,0x07,0x00,0xf0,0x38,0x4d,0x41,0x3c,0x61,
-0x00,0x00,0x00,0xe2,0x00,0x01,0xed,0xe9,0x00,0x03,0xc0,0x00,0x00,0x10,0x0a,0x70,
-0x05,0xc0,0x00,0x00,0x01,0x01,0xe0,0x1e,0x30,0x02,0x69,0xdf,0x40,0xe0,0x88,0x09,
-0xef,0xfb,0x84,0x02,0xd0,0xc2,0x08,0x73,0x65,0x00,0x02,0xe2,0xc2,0x00,0x01,0xee,
-0x10,0x00,0x5a,0x95,0x00,0x0a,0xff,0x90,0x00,0x2c,0x3d,0x00,0x17,0x88,0x70,0x00,
-0x4a,0x08,0xd3,0xa1,0x02,0x87,0xd3,0x00,0x4c,0xed,0xde,0xee,0xed,0x40,0x19,0x01,
-0x22,0x02,0x10,0x57,0x06,0x13,0x60,0x07,0x00,0x11,0xb4,0x07,0x00,0xf0,0x15,0x64,
-0xf2,0x00,0x02,0x64,0x04,0xff,0xf6,0x80,0x00,0x6f,0xef,0x7e,0xa2,0x9e,0x00,0x01,
-0xf8,0x01,0x3f,0x50,0x4f,0x10,0x06,0xe0,0x00,0x0c,0xd7,0xdd,0x00,0x0b,0x90,0x00,
-0x01,0xcf,0xc2,0x13,0x17,0x00,0x38,0x00,0x21,0x1f,0x20,0x07,0x00,0x12,0x3f,0x46,
-0x00,0x12,0x4f,0x07,0x00,0x16,0x6d,0x54,0x00,0x00,0xca,0x00,0xb1,0xde,0x60,0x0e,
-0x85,0xf1,0x0e,0x52,0xf1,0x06,0xff,0x90,0xbf,0x05,0x80,0x6f,0xe4,0xef,0xfb,0xdf,
-0xfb,0x5e,0xd3,0x1d,0x00,0x50,0x1e,0x82,0x00,0x00,0x0f,0xb9,0x12,0xf1,0x02,0x5a,
-0xef,0xf8,0x00,0x01,0x7e,0xfc,0x07,0xcf,0xfe,0x92,0x1f,0xfb,0x50,0x00,0x08,0x20,
-0x58,0x01,0x51,0xfb,0x0c,0xcc,0xcc,0xc8,0xaa,0x00,0x80,0x00,0x00,0x22,0x23,0x32,
-0x05,0xf0,0x00,0x76,0x13,0x10,0x5f,0xb7,0x00,0x30,0xbc,0x05,0xf1,0x83,0x0b,0x80,
-0x70,0x4f,0x10,0x00,0x00,0x07,0xf1,0x04,0xfb,0x05,0xf0,0x0f,0xe9,0x00,0x4f,0xee,
-0x90,0x00,0x9f,0x10,0x04,0xf6,0x52,0x00,0x5f,0x50,0x00,0x4f,0x10,0x00,0x3f,0x80,
-0x00,0x04,0xf1,0x00,0x2f,0x90,0x00,0x00,0x4f,0x10,0x22,0x14,0x22,0x04,0xf2,0xea,
-0x00,0x01,0xeb,0x02,0x03,0x0d,0x00,0x24,0x2d,0x10,0xaa,0x00,0x50,0x23,0x34,0x41,
-0x05,0xf0,0x5f,0x18,0x20,0xc0,0x6f,0x0f,0x00,0x21,0xda,0x05,0xb7,0x12,0x20,0x50,
-0x5f,0x10,0x03,0x40,0xc0,0x05,0xf6,0x62,0x42,0x17,0xf0,0x03,0x5f,0xee,0x60,0x0a,
-0xf3,0x00,0x06,0xf0,0x00,0x2e,0xc2,0x00,0x00,0x6f,0x00,0x02,0x60,0x00,0x0d,0x00,
-0x30,0x00,0x38,0x00,0xc9,0x04,0x91,0x08,0xf0,0x00,0x02,0x70,0x00,0x00,0x8f,0x00,
-0x18,0x10,0x50,0xf1,0x11,0x11,0x20,0x00,0xdb,0x0d,0x00,0x5e,0x05,0x35,0x23,0x33,
-0x32,0x90,0x14,0xc1,0x24,0x45,0x53,0x04,0xf1,0x00,0x0d,0xff,0xef,0xd0,0x5f,0x20,
-0x68,0x00,0x10,0xf2,0xd1,0x0d,0xd0,0x40,0x4f,0xff,0x80,0x00,0x3f,0x90,0x04,0xf6,
-0x51,0x00,0x4e,0xc0,0xa3,0x00,0x20,0x9f,0xa0,0xbd,0x00,0x10,0x2a,0x6f,0x14,0xf0,
-0x05,0x00,0x00,0x07,0xef,0xff,0xff,0xf1,0x00,0x00,0x26,0x66,0x55,0x8f,0x20,0x00,
-0x01,0x44,0x44,0x48,0xf2,0x6d,0x11,0x00,0xc6,0x11,0x22,0x0a,0xe0,0xb6,0x06,0x20,
-0xee,0xff,0x3d,0x09,0x31,0x55,0x55,0x55,0xe2,0x01,0x00,0x5f,0x1d,0x70,0x14,0x45,
-0x53,0x03,0xf2,0x00,0x0c,0xf1,0x15,0x10,0x30,0x32,0x01,0x20,0x03,0xf3,0x32,0x01,
-0xf0,0x10,0x80,0x3f,0xfe,0x90,0x00,0x0a,0xf1,0x03,0xf8,0x62,0x00,0x09,0xf6,0x00,
-0x3f,0x30,0x00,0x3c,0xf6,0x00,0x04,0xf3,0x00,0x0f,0xa2,0x00,0x00,0x2e,0x10,0x00,
-0x01,0x6b,0x03,0x01,0x5b,0x00,0x51,0xff,0x10,0x00,0x09,0xe0,0x25,0x01,0x11,0x9e,
-0x32,0x01,0x03,0x0d,0x00,0x11,0x8f,0x1a,0x00,0x63,0x00,0x34,0x44,0x33,0x10,0x00,
-0x9a,0x01,0x93,0x35,0x55,0x63,0x06,0xf0,0x00,0x0c,0xee,0xdf,0x38,0x01,0x12,0x06,
-0x38,0x01,0xc0,0x6f,0x88,0x30,0x00,0x0d,0xd0,0x06,0xfc,0xc5,0x00,0x1b,0xf3,0x1e,
-0x01,0x21,0x5e,0xe3,0x38,0x01,0xf4,0x23,0x80,0x00,0x00,0x4d,0x00,0x00,0x09,0x10,
-0x72,0x07,0x40,0x00,0x01,0xf4,0x0e,0x60,0xd8,0x00,0x00,0x1f,0x85,0xf6,0x0f,0x70,
-0x00,0x01,0xff,0xff,0x63,0xfd,0x00,0x00,0x1f,0x40,0xf6,0xad,0xf7,0x00,0x01,0xfe,
-0xef,0x9f,0x36,0xf1,0x00,0x03,0x44,0x33,0x40,0x05,0x68,0x00,0x41,0x24,0x55,0x52,
-0x05,0x38,0x01,0x11,0xc0,0x38,0x01,0x11,0xdb,0x02,0x02,0xf0,0x15,0x2f,0x60,0x5f,
-0x65,0x20,0x00,0x0c,0xd0,0x05,0xff,0xf8,0x00,0x09,0xf3,0x00,0x5f,0x20,0x00,0x0a,
-0xf5,0x00,0x05,0xf2,0x00,0x1e,0xd3,0x00,0x00,0x5f,0x10,0x01,0x60,0x00,0x45,0x31,
-0x60,0x83,0x07,0xf0,0x0d,0xef,0xe3,0x00,0x00,0x02,0xfa,0x00,0x1b,0xe0,0x00,0x00,
-0x6f,0x20,0x00,0x4f,0x30,0x00,0x05,0xf4,0x00,0x07,0xf2,0x00,0x00,0x0d,0xe7,0x69,
-0xfb,0xfb,0x03,0x37,0xcd,0xb6,0x00,0xa0,0x01,0x01,0x38,0x01,0x30,0xef,0xe0,0x4f,
-0x38,0x01,0x30,0xcb,0x04,0xf3,0x34,0x02,0xd0,0x50,0x4f,0xff,0x90,0x00,0x1e,0xb0,
-0x03,0xf7,0x52,0x00,0x2d,0xd1,0x38,0x01,0x81,0x6f,0xc1,0x00,0x03,0xf3,0x00,0x1d,
-0x60,0x43,0x02,0x80,0x01,0x55,0x55,0x55,0x50,0x00,0x00,0x7f,0xc8,0x14,0x64,0x00,
-0x07,0xf2,0x22,0x22,0x10,0x2b,0x01,0x12,0x08,0xa0,0x01,0xb2,0x8f,0xee,0xee,0xef,
-0x70,0x00,0x01,0x45,0x55,0x54,0x41,0x9f,0x01,0xf1,0x07,0x41,0x01,0x22,0x33,0x0e,
-0x60,0xe7,0x1f,0xff,0xff,0x0f,0x70,0xf7,0x00,0x10,0x8f,0x0f,0x70,0xe7,0x00,0x00,
-0xbc,0x06,0x00,0xf0,0x0f,0xf8,0x0f,0x71,0xe7,0x00,0x05,0xf3,0x0f,0xff,0xf7,0x00,
-0x0c,0xc0,0x0e,0x82,0xe7,0x00,0x5f,0x40,0x0e,0x70,0xe7,0x01,0xdb,0x00,0x0e,0x70,
-0xe7,0x0b,0xe1,0x06,0x00,0x30,0x4f,0x30,0x00,0x12,0x00,0x10,0x00,0x06,0x00,0x14,
-0x00,0x06,0x00,0x31,0x0c,0x50,0xe7,0x6b,0x00,0x13,0x20,0xde,0x03,0xf1,0x20,0x44,
-0x55,0x05,0xc0,0xd7,0x0c,0xfe,0xef,0x66,0xf0,0xe8,0x00,0x00,0x4f,0x46,0xf0,0xd8,
-0x00,0x00,0xbd,0x06,0xfe,0xf8,0x00,0x05,0xf4,0x06,0xf6,0xe8,0x00,0x3f,0x90,0x06,
-0xe0,0xd8,0x04,0xfa,0x00,0x06,0xe0,0xd8,0x1f,0x70,0x00,0x05,0xd0,0xd7,0x02,0x09,
-0xf0,0x07,0x52,0x00,0x00,0x2b,0xff,0xfc,0x30,0x00,0x00,0xdd,0x42,0x4c,0xe1,0x00,
-0x04,0xf4,0x00,0x02,0xf5,0x00,0x03,0xf5,0x09,0x00,0xb1,0x00,0xcf,0x86,0x8e,0xd0,
-0x00,0x00,0x07,0xbd,0xb7,0x10,0x3e,0x03,0xf0,0x02,0x10,0x23,0x33,0x32,0x00,0xe7,
-0x3f,0xff,0xff,0xe0,0x0e,0x70,0x00,0x00,0xcc,0x00,0xe7,0x8e,0x03,0xf0,0x14,0x0e,
-0x70,0x00,0x08,0xf1,0x00,0xe7,0x00,0x01,0xf8,0xad,0xdf,0x70,0x00,0xae,0x15,0x77,
-0xf7,0x00,0x6f,0x40,0x00,0x0e,0x70,0x4f,0x70,0x00,0x00,0xe7,0x3f,0x80,0x00,0x00,
-0x0e,0x74,0x19,0x04,0x01,0xa8,0x00,0x00,0x37,0x00,0x03,0x0b,0x00,0x26,0x0d,0x60,
-0x94,0x04,0xa0,0x00,0x24,0x45,0x52,0x00,0xe7,0x0e,0xff,0xef,0xc0,0x21,0x00,0x11,
-0xca,0x58,0x00,0xf1,0x0b,0x60,0x0e,0x70,0x00,0x0a,0xe7,0xff,0xf7,0x00,0x06,0xf5,
-0x03,0x3e,0x70,0x08,0xf6,0x00,0x00,0xe7,0x0c,0xe5,0x00,0x00,0x0e,0x71,0x81,0x42,
-0x00,0x20,0x0a,0x40,0x4d,0x00,0x61,0xf7,0x00,0x00,0x41,0x00,0x0f,0x55,0x00,0x41,
-0xf8,0x11,0x11,0x21,0x28,0x1c,0x31,0xd0,0x00,0x02,0x8b,0x01,0x00,0x9d,0x0b,0x51,
-0x34,0x45,0x52,0x00,0xe8,0x58,0x00,0xf0,0x0f,0x80,0x00,0x00,0xea,0x00,0xd8,0x00,
-0x00,0x4f,0x8e,0xef,0x80,0x00,0x0d,0xc0,0x56,0xe8,0x00,0x0a,0xe2,0x00,0x0e,0x80,
-0x2c,0xe2,0x00,0x00,0xe8,0x2f,0x91,0x8f,0x00,0x52,0x20,0x34,0x44,0x44,0x40,0xda,
-0x05,0xb0,0x01,0xf7,0x00,0x00,0xe8,0x00,0x1f,0x70,0x00,0x0e,0x80,0x0b,0x00,0x11,
-0xe7,0x16,0x00,0x51,0x60,0x00,0x13,0x44,0x43,0x68,0x01,0xf0,0x02,0x10,0x41,0x02,
-0x34,0x43,0x05,0xf0,0xe6,0x0f,0xff,0xfd,0x05,0xf0,0xe7,0x00,0x10,0xcb,0x06,0x00,
-0x20,0x00,0xe9,0x06,0x00,0xf0,0x01,0x02,0xf5,0x16,0xf0,0xe7,0x00,0x07,0xf8,0xff,
-0xf0,0xe7,0x00,0x0d,0xb0,0x37,0xf0,0xc8,0x01,0xb0,0x05,0xf0,0xe7,0x01,0xeb,0x00,
-0x05,0xf0,0xe7,0x0b,0xe1,0x06,0x00,0x31,0x3f,0x30,0x00,0x30,0x00,0x09,0x06,0x00,
-0x37,0x03,0xb0,0xd6,0xa5,0x05,0xe0,0x20,0x00,0x46,0x67,0x70,0x3f,0x0e,0x70,0x0c,
-0xdc,0xdf,0x44,0xf1,0xe7,0xed,0x04,0xf0,0x13,0x3f,0x2d,0x70,0x00,0x00,0xdc,0x57,
-0xf2,0xd8,0x00,0x00,0x7f,0x5e,0xef,0x2d,0x70,0x00,0x5f,0x70,0x03,0xf2,0xd7,0x00,
-0x6f,0x90,0x00,0x3f,0x2e,0x70,0x3f,0x60,0x00,0x02,0xf1,0x40,0x00,0x31,0x40,0x00,
-0x41,0xeb,0x04,0x20,0x3f,0x30,0x99,0x04,0x20,0x07,0xf1,0x0c,0x18,0x11,0x70,0x02,
-0x12,0xff,0x02,0x9f,0xaf,0x9f,0x60,0x00,0x3f,0x60,0x9f,0x70,0x7f,0x30,0x01,0x50,
+0x21,0x00,0x31,0x7e,0x4f,0x60,0x07,0x00,0x21,0x08,0xf4,0x07,0x00,0xf1,0x04,0x00,
+0x9f,0x33,0xff,0xff,0xff,0xfd,0x00,0x0a,0xe8,0xf5,0x55,0x55,0x52,0x00,0x00,0xaf,
+0xf0,0x00,0x82,0x00,0x02,0x07,0x00,0x31,0x00,0x30,0x00,0x89,0x00,0x01,0x6e,0x00,
+0x20,0x3e,0xe3,0x6c,0x00,0xff,0x19,0xeb,0xbe,0x30,0x00,0x00,0x3e,0xb0,0x0b,0xf3,
+0x00,0x03,0xfb,0x00,0x00,0xbf,0x30,0x3f,0xb0,0x00,0x00,0x0b,0xf3,0xef,0xff,0x30,
+0x03,0xff,0xfe,0x35,0x5f,0x50,0x05,0xf5,0x53,0x00,0x0f,0x50,0x05,0xf0,0x00,0x06,
+0x00,0x01,0xfe,0x05,0x85,0x58,0xf0,0x00,0x00,0x0d,0xff,0xff,0xd0,0x00,0x00,0x03,
+0x55,0x55,0x30,0x00,0x00,0x0f,0xff,0xff,0x2a,0x00,0x0a,0x06,0x00,0xf0,0x08,0xce,
+0xef,0x50,0x05,0xfe,0xec,0xaf,0xb6,0x00,0x00,0x6b,0xfa,0x0a,0xf4,0x00,0x00,0x4f,
+0xb0,0x00,0xbf,0x40,0x04,0xfb,0x75,0x00,0x10,0x3f,0xd1,0x00,0x21,0xbf,0xfb,0xb0,
+0x00,0x26,0xb0,0x00,0x01,0x00,0x12,0x11,0x07,0x00,0x12,0x88,0xbc,0x00,0x11,0xff,
+0x1e,0x01,0x30,0x09,0xff,0x90,0x07,0x00,0x30,0x2f,0xcc,0xf2,0x07,0x00,0xb0,0xaf,
+0x44,0xfa,0x00,0x00,0x00,0x02,0xfb,0x00,0xbf,0x20,0x49,0x00,0x10,0x00,0x4a,0x00,
+0x90,0x3f,0xa0,0x00,0x0a,0xf3,0x00,0x00,0xbf,0x20,0x18,0x00,0xf0,0x01,0x04,0xf9,
+0x00,0x00,0x00,0x9f,0x40,0x0c,0xfe,0xdd,0xdd,0xdd,0xef,0xc0,0x5f,0xff,0x01,0x00,
+0x11,0xf5,0x4f,0x00,0x11,0x10,0x56,0x00,0xf0,0x47,0x9f,0xfc,0x10,0x00,0x00,0x02,
+0x26,0xf7,0x4d,0xb0,0x00,0x04,0xdf,0xbb,0xd0,0x07,0xf0,0x00,0x6f,0xc4,0x0d,0xf5,
+0x2c,0xd0,0x02,0xfa,0x00,0x0f,0xff,0xfe,0x30,0x0a,0xe0,0x00,0x3f,0xff,0xc6,0x60,
+0x0e,0x80,0x00,0x6f,0xf8,0x08,0xe0,0x0f,0x60,0x00,0x9e,0x40,0x06,0xf0,0x0e,0x80,
+0x00,0x71,0x00,0x08,0xe0,0x0a,0xd0,0x00,0x00,0x00,0x0d,0xa0,0x03,0xf8,0x00,0x00,
+0x00,0x8f,0x30,0x00,0x7f,0xa3,0x00,0x3a,0xf7,0x00,0x00,0x05,0xef,0xff,0xfe,0x50,
+0xb9,0x01,0x20,0x66,0x40,0x66,0x00,0xf0,0x13,0x66,0x66,0x63,0x00,0x00,0x00,0x20,
+0xcf,0xff,0xf2,0x50,0x00,0x03,0xf8,0x1e,0xff,0x65,0xf9,0x00,0x16,0xb8,0x03,0xfb,
+0x02,0xa7,0x70,0x6f,0xa0,0x00,0x51,0x00,0x3f,0xb0,0x49,0x9a,0x01,0x30,0x07,0x93,
+0xef,0x9a,0x01,0x40,0x08,0xf6,0x49,0x10,0x0e,0x00,0x31,0x71,0xaf,0x60,0x3d,0x02,
+0xf0,0x0b,0x36,0xa1,0x00,0x00,0x00,0x6b,0x30,0x0a,0xf8,0x20,0x00,0x06,0x8f,0x50,
+0x01,0x4c,0xe7,0x68,0x8f,0xb1,0x00,0x00,0x0a,0x6e,0xac,0xc6,0x62,0x00,0x36,0x06,
+0x44,0x40,0x2b,0x01,0xf0,0x24,0x8e,0x34,0x78,0x61,0x00,0x00,0x07,0xfd,0xff,0xfe,
+0xff,0x91,0x00,0x6f,0x70,0xbf,0x40,0x06,0xed,0x10,0x8f,0x50,0x0a,0xf5,0x00,0x2e,
+0xb0,0x0d,0xf6,0x00,0xed,0x00,0x03,0xf4,0x1f,0xcf,0x7a,0xf4,0x00,0x00,0xd9,0x3f,
+0x37,0xff,0x40,0x00,0x00,0xab,0x3f,0x20,0x53,0x16,0x03,0x20,0x1f,0x50,0x3d,0x00,
+0x30,0xd8,0x0b,0xc0,0xb2,0x00,0x20,0xf3,0x02,0xcb,0x00,0xf0,0x00,0x2e,0xa0,0x00,
+0x6f,0xb4,0x00,0x17,0xfc,0x10,0x00,0x03,0xcf,0xff,0xff,0x80,0x5f,0x01,0x21,0x56,
+0x40,0x8e,0x01,0x21,0x10,0x00,0xf5,0x01,0xf0,0x38,0xff,0xfa,0x00,0x2f,0xe9,0x99,
+0x9b,0xf4,0x00,0x7f,0x70,0x00,0x09,0xd0,0x00,0xcf,0x10,0x00,0x0f,0x70,0x00,0xfc,
+0x00,0x00,0x9f,0x10,0x00,0x9f,0x10,0x1c,0xd3,0x00,0x06,0xff,0x70,0xe9,0x00,0x00,
+0x3f,0x8c,0x75,0xf9,0x00,0x00,0xbc,0x0e,0x2c,0xaf,0x00,0x00,0xd9,0x2d,0x1a,0x3f,
+0x20,0x00,0xbc,0x01,0x00,0x6f,0x00,0x00,0x4f,0x80,0x04,0xe9,0x00,0x00,0x07,0xff,
+0xff,0xe9,0x01,0x31,0x27,0x74,0x00,0xc6,0x01,0x21,0xff,0xa0,0x06,0x00,0x90,0xb1,
+0x10,0x1f,0xee,0xed,0xdd,0xdd,0xf2,0x1d,0x15,0x00,0xd1,0xb2,0x1d,0x01,0x77,0x77,
+0x60,0xb2,0x1d,0x03,0xff,0xff,0xe0,0xb3,0x12,0x00,0x11,0xb3,0x12,0x00,0x12,0xb3,
+0x12,0x00,0x11,0x1e,0x12,0x00,0xc4,0x0e,0x11,0x11,0x11,0x11,0xb3,0x0d,0xdd,0xff,
+0xff,0xec,0xc2,0x48,0x00,0x31,0x7b,0xbb,0x70,0x47,0x03,0xf0,0x06,0xbd,0xdb,0x50,
+0x07,0x00,0x02,0xdf,0xff,0xff,0xf0,0x0f,0xd3,0x2f,0xfa,0x30,0x03,0x20,0x0e,0x4d,
+0xef,0x80,0x6d,0x03,0x31,0x00,0x8f,0x40,0x07,0x00,0x21,0x03,0xd9,0x07,0x00,0x30,
+0x00,0x1e,0x90,0x07,0x00,0x21,0x02,0xd7,0x0e,0x00,0x11,0x5d,0x1c,0x00,0x20,0x08,
+0xfd,0x43,0x00,0x40,0x0f,0xca,0xaf,0xa0,0x07,0x00,0x70,0x60,0x0d,0xfd,0x63,0x37,
+0x60,0x03,0x61,0x00,0x20,0xff,0xe0,0x11,0x01,0xf1,0x19,0x7a,0xa7,0x10,0xbd,0xef,
+0xfd,0xdd,0xdd,0xf1,0xc2,0x6f,0xe0,0x00,0x11,0xc2,0xc2,0x39,0x80,0x1a,0xff,0xf2,
+0xc2,0x16,0x52,0xef,0xff,0xf2,0xc2,0x6f,0xf0,0x19,0xff,0xf2,0xc2,0x5f,0xe0,0x00,
+0x11,0xb2,0xc2,0xc8,0x00,0x30,0xc2,0x5f,0xe0,0x06,0x00,0x20,0x6f,0xf0,0x06,0x00,
+0x20,0x15,0x40,0x06,0x00,0x21,0x4f,0xe0,0x18,0x00,0x00,0x12,0x00,0x70,0xcc,0xdf,
+0xfc,0xcc,0xcc,0xf1,0x01,0xc8,0x00,0x00,0x60,0x01,0x11,0x22,0x08,0x04,0xf1,0x42,
+0xbf,0xff,0xfa,0x20,0x00,0x00,0x7f,0xea,0xce,0x8d,0xf5,0x00,0x06,0xf9,0x03,0xbd,
+0x10,0xaf,0x30,0x1f,0xa0,0x04,0xbd,0x10,0x0c,0xd0,0x7f,0x10,0x04,0xce,0x10,0x03,
+0xf3,0xab,0x00,0x02,0xcc,0x00,0x00,0xe7,0xba,0x00,0x36,0x00,0xb9,0x00,0xc8,0xab,
+0x05,0xeb,0x76,0xc8,0xd3,0xe7,0x7f,0x8e,0x5c,0x61,0xbb,0x5d,0xf4,0x1f,0xd4,0xd5,
+0x00,0x05,0xdc,0xd0,0x06,0xff,0x30,0x00,0x00,0x9f,0x30,0x00,0x7f,0xc6,0x33,0x6d,
+0xf4,0x54,0x00,0x11,0xf9,0xfe,0x03,0x16,0x22,0x09,0x04,0x30,0x01,0xaf,0xfe,0x69,
+0x02,0x40,0x0c,0xd4,0x28,0xf5,0x64,0x04,0xf1,0x2a,0x20,0x00,0x9c,0x00,0x32,0x00,
+0x5f,0x00,0x00,0x6e,0x3e,0xff,0x90,0x3f,0x30,0x00,0xac,0xdf,0xff,0xf4,0x0c,0xe5,
+0x28,0xf5,0xff,0xff,0xf8,0x00,0xaf,0xff,0xd3,0xdf,0xff,0xf5,0x00,0xce,0xa9,0xff,
+0xff,0xff,0xb0,0x0a,0xd1,0x1d,0xff,0xff,0xff,0x70,0x1f,0x40,0xbf,0xff,0xff,0xff,
+0xf1,0x5e,0x05,0x55,0x03,0x20,0x7c,0x1b,0x07,0x00,0xb9,0xf7,0x6f,0xff,0xdd,0xdd,
+0xdd,0xdd,0xd6,0x02,0x22,0x00,0x01,0x00,0x22,0x06,0x90,0xc5,0x03,0x12,0xda,0x0f,
+0x00,0x22,0x1c,0xb0,0x0f,0x00,0xa1,0xcc,0x00,0x00,0x3c,0xbb,0xbb,0xba,0xbf,0xc1,
+0x00,0x9b,0x03,0x40,0xfd,0x10,0x14,0x44,0x01,0x00,0x21,0x30,0x03,0xa9,0x03,0xb2,
+0xf4,0x00,0x3e,0xfd,0xde,0xee,0xef,0xf4,0x00,0x02,0xea,0x37,0x00,0x22,0x1d,0xa0,
+0x37,0x00,0x13,0xdb,0x46,0x00,0x01,0x02,0x05,0x0b,0x69,0x00,0x22,0xee,0xb6,0x09,
+0x00,0x21,0x49,0xe8,0x0e,0x00,0x30,0xa4,0x19,0xd2,0x32,0x00,0x91,0x5b,0xd3,0x30,
+0x00,0x00,0x06,0xfc,0x60,0x45,0x55,0x05,0x80,0xbc,0x00,0x00,0x00,0x18,0xa8,0x9c,
+0x71,0x07,0x05,0xf0,0x10,0x00,0x01,0xcd,0x10,0x00,0x1e,0xf2,0x5f,0xd0,0x3f,0xc0,
+0x00,0x5f,0xf0,0xbf,0xf3,0x1f,0xf1,0x00,0x0d,0xf3,0x4e,0xb0,0x4f,0xa0,0x00,0x02,
+0xdd,0x10,0x02,0xdc,0x90,0x03,0x91,0xcb,0xab,0x60,0x00,0x00,0x01,0x33,0x33,0x32,
+0xe9,0x04,0xf0,0x0b,0xff,0x70,0x00,0x1f,0x63,0x33,0xc8,0xf7,0x00,0x1f,0x40,0x00,
+0xe0,0x6f,0x70,0x1f,0x40,0x00,0xed,0xd7,0xf1,0x1f,0x40,0x00,0x01,0x13,0x06,0x00,
+0x2f,0x00,0x03,0x06,0x00,0x0d,0x81,0x74,0x44,0x44,0x47,0xf1,0x0e,0xff,0xff,0x33,
+0x05,0x02,0xf8,0x05,0x20,0xbd,0xb4,0x07,0x00,0xf0,0x38,0x4d,0x41,0x3c,0x61,0x00,
+0x00,0x00,0xe2,0x00,0x01,0xed,0xe9,0x00,0x03,0xc0,0x00,0x00,0x10,0x0a,0x70,0x05,
+0xc0,0x00,0x00,0x01,0x01,0xe0,0x1e,0x30,0x02,0x69,0xdf,0x40,0xe0,0x88,0x09,0xef,
+0xfb,0x84,0x02,0xd0,0xc2,0x08,0x73,0x65,0x00,0x02,0xe2,0xc2,0x00,0x01,0xee,0x10,
+0x00,0x5a,0x95,0x00,0x0a,0xff,0x90,0x00,0x2c,0x3d,0x00,0x17,0x88,0x70,0x00,0x4a,
+0x08,0xd3,0xa1,0x02,0x87,0xd3,0x00,0x4c,0xed,0xde,0xee,0xed,0x40,0x19,0x01,0x22,
+0x02,0x10,0x57,0x06,0x13,0x60,0x07,0x00,0x11,0xb4,0x07,0x00,0xf1,0x18,0x64,0xf2,
+0x00,0x02,0x64,0x04,0xff,0xf6,0x80,0x00,0x6f,0xef,0x7e,0xa2,0x9e,0x00,0x01,0xf8,
+0x01,0x3f,0x50,0x4f,0x10,0x06,0xe0,0x00,0x0c,0xd7,0xdd,0x00,0x0b,0x90,0x00,0x01,
+0xcf,0xc2,0x00,0x0e,0x50,0x38,0x00,0x21,0x1f,0x20,0x07,0x00,0x12,0x3f,0x46,0x00,
+0x12,0x4f,0x07,0x00,0x16,0x6d,0x54,0x00,0x00,0xca,0x00,0xb1,0xde,0x60,0x0e,0x85,
+0xf1,0x0e,0x52,0xf1,0x06,0xff,0x90,0xbf,0x05,0x80,0x6f,0xe4,0xef,0xfb,0xdf,0xfb,
+0x5e,0xd3,0x1d,0x00,0x20,0x1e,0x82,0x40,0x01,0xf1,0x05,0xc6,0x00,0x00,0x5a,0xef,
+0xf8,0x00,0x01,0x7e,0xfc,0x07,0xcf,0xfe,0x92,0x1f,0xfb,0x50,0x00,0x08,0x20,0x58,
+0x01,0x51,0xfb,0x0c,0xcc,0xcc,0xc8,0xaa,0x00,0xd0,0x00,0x00,0x22,0x23,0x32,0x05,
+0xf0,0x00,0x2f,0xff,0xff,0xe0,0x5f,0xb7,0x00,0xf0,0x00,0xbc,0x05,0xf1,0x00,0x00,
+0x00,0x1f,0x70,0x4f,0x10,0x00,0x00,0x07,0xf1,0x04,0xfb,0x05,0xf2,0x15,0xe9,0x00,
+0x4f,0xee,0x90,0x00,0x9f,0x10,0x04,0xf6,0x52,0x00,0x5f,0x50,0x00,0x4f,0x10,0x00,
+0x3f,0x80,0x00,0x04,0xf1,0x00,0x2f,0x90,0x00,0x00,0x4f,0x10,0x04,0x60,0x00,0x00,
+0x04,0xf2,0xea,0x00,0x01,0xeb,0x02,0x03,0x0d,0x00,0x24,0x2d,0x10,0xaa,0x00,0xb0,
+0x23,0x34,0x41,0x05,0xf0,0x00,0x0e,0xff,0xff,0xc0,0x6f,0x0f,0x00,0x30,0xda,0x05,
+0xf0,0x03,0x03,0x20,0x50,0x5f,0x10,0x03,0xf0,0x0b,0xc0,0x05,0xf6,0x62,0x00,0x09,
+0xf2,0x00,0x5f,0xee,0x60,0x0a,0xf3,0x00,0x06,0xf0,0x00,0x2e,0xc2,0x00,0x00,0x6f,
+0x00,0x02,0x60,0x00,0x0d,0x00,0x30,0x00,0x38,0x00,0xc9,0x04,0x81,0x08,0xf0,0x00,
+0x02,0x70,0x00,0x00,0x8f,0x4e,0x00,0xa0,0x08,0xf1,0x11,0x11,0x20,0x00,0x00,0x6f,
+0xff,0xff,0x5e,0x05,0x44,0x23,0x33,0x32,0x20,0x68,0x00,0xc1,0x24,0x45,0x53,0x04,
+0xf1,0x00,0x0d,0xff,0xef,0xd0,0x5f,0x20,0x68,0x00,0x00,0x89,0x00,0xe0,0x5f,0x40,
+0x4f,0xff,0x80,0x00,0x3f,0x90,0x04,0xf6,0x51,0x00,0x4e,0xc0,0xa3,0x00,0x20,0x9f,
+0xa0,0xbd,0x00,0xf0,0x0d,0x2a,0x30,0x00,0x00,0x03,0x00,0x00,0x07,0xef,0xff,0xff,
+0xf1,0x00,0x00,0x26,0x66,0x55,0x8f,0x20,0x00,0x01,0x44,0x44,0x48,0xf2,0x00,0x00,
+0x9f,0xdd,0x07,0x32,0x00,0x0a,0xe0,0xb6,0x06,0x20,0xee,0xff,0x3d,0x09,0x42,0x55,
+0x55,0x55,0x40,0x11,0x03,0xe0,0x00,0x00,0x14,0x45,0x53,0x03,0xf2,0x00,0x0c,0xff,
+0xff,0xe0,0x3f,0x30,0x32,0x01,0x20,0x03,0xf3,0x32,0x01,0xf0,0x10,0x80,0x3f,0xfe,
+0x90,0x00,0x0a,0xf1,0x03,0xf8,0x62,0x00,0x09,0xf6,0x00,0x3f,0x30,0x00,0x3c,0xf6,
+0x00,0x04,0xf3,0x00,0x0f,0xa2,0x00,0x00,0x2e,0x10,0x00,0x01,0x6b,0x03,0x01,0x5b,
+0x00,0x51,0xff,0x10,0x00,0x09,0xe0,0x25,0x01,0x11,0x9e,0x32,0x01,0x03,0x0d,0x00,
+0x11,0x8f,0x1a,0x00,0x63,0x00,0x34,0x44,0x33,0x10,0x00,0x9a,0x01,0x93,0x35,0x55,
+0x63,0x06,0xf0,0x00,0x0c,0xee,0xdf,0x38,0x01,0x12,0x06,0x38,0x01,0xc0,0x6f,0x88,
+0x30,0x00,0x0d,0xd0,0x06,0xfc,0xc5,0x00,0x1b,0xf3,0x1e,0x01,0x21,0x5e,0xe3,0x38,
+0x01,0xf4,0x23,0x80,0x00,0x00,0x4d,0x00,0x00,0x09,0x10,0x72,0x07,0x40,0x00,0x01,
+0xf4,0x0e,0x60,0xd8,0x00,0x00,0x1f,0x85,0xf6,0x0f,0x70,0x00,0x01,0xff,0xff,0x63,
+0xfd,0x00,0x00,0x1f,0x40,0xf6,0xad,0xf7,0x00,0x01,0xfe,0xef,0x9f,0x36,0xf1,0x00,
+0x03,0x44,0x33,0x40,0x05,0x68,0x00,0x41,0x24,0x55,0x52,0x05,0x38,0x01,0x11,0xc0,
+0x38,0x01,0x11,0xdb,0x02,0x02,0xf0,0x15,0x2f,0x60,0x5f,0x65,0x20,0x00,0x0c,0xd0,
+0x05,0xff,0xf8,0x00,0x09,0xf3,0x00,0x5f,0x20,0x00,0x0a,0xf5,0x00,0x05,0xf2,0x00,
+0x1e,0xd3,0x00,0x00,0x5f,0x10,0x01,0x60,0x00,0x45,0x31,0x60,0x83,0x07,0xf0,0x0d,
+0xef,0xe3,0x00,0x00,0x02,0xfa,0x00,0x1b,0xe0,0x00,0x00,0x6f,0x20,0x00,0x4f,0x30,
+0x00,0x05,0xf4,0x00,0x07,0xf2,0x00,0x00,0x0d,0xe7,0x69,0xfb,0xfb,0x03,0x37,0xcd,
+0xb6,0x00,0xa0,0x01,0x01,0x38,0x01,0x30,0xef,0xe0,0x4f,0x38,0x01,0x30,0xcb,0x04,
+0xf3,0x34,0x02,0xd0,0x50,0x4f,0xff,0x90,0x00,0x1e,0xb0,0x03,0xf7,0x52,0x00,0x2d,
+0xd1,0x38,0x01,0x81,0x6f,0xc1,0x00,0x03,0xf3,0x00,0x1d,0x60,0x43,0x02,0xf4,0x03,
+0x01,0x55,0x55,0x55,0x50,0x00,0x00,0x7f,0xff,0xff,0xfe,0x30,0x00,0x07,0xf2,0x22,
+0x22,0x10,0x2b,0x01,0x12,0x08,0xa0,0x01,0xb2,0x8f,0xee,0xee,0xef,0x70,0x00,0x01,
+0x45,0x55,0x54,0x41,0x9f,0x01,0xf1,0x07,0x41,0x01,0x22,0x33,0x0e,0x60,0xe7,0x1f,
+0xff,0xff,0x0f,0x70,0xf7,0x00,0x10,0x8f,0x0f,0x70,0xe7,0x00,0x00,0xbc,0x06,0x00,
+0xf0,0x0f,0xf8,0x0f,0x71,0xe7,0x00,0x05,0xf3,0x0f,0xff,0xf7,0x00,0x0c,0xc0,0x0e,
+0x82,0xe7,0x00,0x5f,0x40,0x0e,0x70,0xe7,0x01,0xdb,0x00,0x0e,0x70,0xe7,0x0b,0xe1,
+0x06,0x00,0x30,0x4f,0x30,0x00,0x12,0x00,0x10,0x00,0x06,0x00,0x14,0x00,0x06,0x00,
+0x31,0x0c,0x50,0xe7,0x6b,0x00,0x13,0x20,0xde,0x03,0xf1,0x20,0x44,0x55,0x05,0xc0,
+0xd7,0x0c,0xfe,0xef,0x66,0xf0,0xe8,0x00,0x00,0x4f,0x46,0xf0,0xd8,0x00,0x00,0xbd,
+0x06,0xfe,0xf8,0x00,0x05,0xf4,0x06,0xf6,0xe8,0x00,0x3f,0x90,0x06,0xe0,0xd8,0x04,
+0xfa,0x00,0x06,0xe0,0xd8,0x1f,0x70,0x00,0x05,0xd0,0xd7,0x02,0x09,0xf0,0x07,0x52,
+0x00,0x00,0x2b,0xff,0xfc,0x30,0x00,0x00,0xdd,0x42,0x4c,0xe1,0x00,0x04,0xf4,0x00,
+0x02,0xf5,0x00,0x03,0xf5,0x09,0x00,0xb1,0x00,0xcf,0x86,0x8e,0xd0,0x00,0x00,0x07,
+0xbd,0xb7,0x10,0x3e,0x03,0xf0,0x02,0x10,0x23,0x33,0x32,0x00,0xe7,0x3f,0xff,0xff,
+0xe0,0x0e,0x70,0x00,0x00,0xcc,0x00,0xe7,0x8e,0x03,0xf0,0x14,0x0e,0x70,0x00,0x08,
+0xf1,0x00,0xe7,0x00,0x01,0xf8,0xad,0xdf,0x70,0x00,0xae,0x15,0x77,0xf7,0x00,0x6f,
+0x40,0x00,0x0e,0x70,0x4f,0x70,0x00,0x00,0xe7,0x3f,0x80,0x00,0x00,0x0e,0x74,0x19,
+0x04,0x01,0xa8,0x00,0x00,0x37,0x00,0x03,0x0b,0x00,0x26,0x0d,0x60,0x94,0x04,0xa0,
+0x00,0x24,0x45,0x52,0x00,0xe7,0x0e,0xff,0xef,0xc0,0x21,0x00,0x11,0xca,0x58,0x00,
+0xf1,0x0b,0x60,0x0e,0x70,0x00,0x0a,0xe7,0xff,0xf7,0x00,0x06,0xf5,0x03,0x3e,0x70,
+0x08,0xf6,0x00,0x00,0xe7,0x0c,0xe5,0x00,0x00,0x0e,0x71,0x81,0x42,0x00,0x20,0x0a,
+0x40,0x4d,0x00,0x61,0xf7,0x00,0x00,0x41,0x00,0x0f,0x55,0x00,0x70,0xf8,0x11,0x11,
+0x21,0x00,0x0e,0xff,0x8e,0x0a,0x11,0x02,0x8b,0x01,0x00,0x9d,0x0b,0x51,0x34,0x45,
+0x52,0x00,0xe8,0x58,0x00,0xf0,0x0f,0x80,0x00,0x00,0xea,0x00,0xd8,0x00,0x00,0x4f,
+0x8e,0xef,0x80,0x00,0x0d,0xc0,0x56,0xe8,0x00,0x0a,0xe2,0x00,0x0e,0x80,0x2c,0xe2,
+0x00,0x00,0xe8,0x2f,0x91,0x8f,0x00,0x52,0x20,0x34,0x44,0x44,0x40,0xda,0x05,0xb0,
+0x01,0xf7,0x00,0x00,0xe8,0x00,0x1f,0x70,0x00,0x0e,0x80,0x0b,0x00,0x11,0xe7,0x16,
+0x00,0x51,0x60,0x00,0x13,0x44,0x43,0x68,0x01,0xf0,0x02,0x10,0x41,0x02,0x34,0x43,
+0x05,0xf0,0xe6,0x0f,0xff,0xfd,0x05,0xf0,0xe7,0x00,0x10,0xcb,0x06,0x00,0x20,0x00,
+0xe9,0x06,0x00,0xf0,0x01,0x02,0xf5,0x16,0xf0,0xe7,0x00,0x07,0xf8,0xff,0xf0,0xe7,
+0x00,0x0d,0xb0,0x37,0xf0,0xc8,0x01,0xb0,0x05,0xf0,0xe7,0x01,0xeb,0x00,0x05,0xf0,
+0xe7,0x0b,0xe1,0x06,0x00,0x31,0x3f,0x30,0x00,0x30,0x00,0x09,0x06,0x00,0x37,0x03,
+0xb0,0xd6,0xa5,0x05,0xe0,0x20,0x00,0x46,0x67,0x70,0x3f,0x0e,0x70,0x0c,0xdc,0xdf,
+0x44,0xf1,0xe7,0xed,0x04,0xf0,0x13,0x3f,0x2d,0x70,0x00,0x00,0xdc,0x57,0xf2,0xd8,
+0x00,0x00,0x7f,0x5e,0xef,0x2d,0x70,0x00,0x5f,0x70,0x03,0xf2,0xd7,0x00,0x6f,0x90,
+0x00,0x3f,0x2e,0x70,0x3f,0x60,0x00,0x02,0xf1,0x40,0x00,0x31,0x40,0x00,0x41,0xeb,
+0x04,0x20,0x3f,0x30,0x99,0x04,0x10,0x07,0x2c,0x03,0xff,0x09,0xef,0x70,0xdf,0x70,
+0x00,0x00,0x7f,0x9f,0xaf,0x9f,0x60,0x00,0x3f,0x60,0x9f,0x70,0x7f,0x30,0x01,0x50,
 0x01,0x50,0x00,0x30,0xd0,0x01,0x06,0x20,0x9d,0xef,0xd0,0x01,0x50,0x56,0xf7,0x00,
 0x01,0xf8,0x62,0x01,0xef,0xae,0x10,0x00,0xe7,0x00,0x6f,0x40,0xcf,0xff,0x70,0x4f,
-0x70,0x02,0x33,0xd0,0x01,0x15,0xe0,0x46,0x66,0x73,0x00,0xe7,0x0c,0xdd,0xcf,0xc1,
-0x1e,0x70,0x00,0x00,0xe9,0x1c,0x1b,0xf4,0x07,0x5f,0x41,0x2e,0x70,0x00,0x1e,0xb0,
-0x11,0xe7,0x00,0x1c,0xd1,0x9f,0xff,0x70,0x4d,0xd1,0x01,0x33,0xe7,0x2f,0x80,0x42,
-0x00,0x31,0x41,0x00,0x1e,0x52,0x07,0x41,0x55,0x55,0x54,0xe9,0x4d,0x00,0x01,0x28,
-0x08,0x16,0xd9,0x0b,0x00,0x11,0x42,0x58,0x00,0xc0,0x20,0x06,0x99,0x9a,0x50,0x0c,
-0xa0,0x08,0xba,0xaf,0x94,0x5d,0x87,0x1a,0x60,0x4d,0xef,0xb0,0x00,0x00,0xad,0x2e,
-0x0c,0xd0,0x07,0xf3,0x25,0x5d,0xb0,0x00,0x9f,0x60,0x6f,0xff,0xb0,0x0d,0xd4,0x34,
-0x1e,0x10,0x05,0x55,0x01,0x31,0x20,0x00,0x2e,0xb9,0x01,0xb1,0x06,0x66,0x66,0x5f,
-0x80,0x00,0x03,0x44,0x44,0x5f,0x80,0xcb,0x01,0x10,0x40,0xdc,0x01,0x00,0xd3,0x09,
-0x10,0xfe,0xca,0x09,0x56,0x02,0x55,0x55,0x54,0x30,0xb8,0x00,0xf0,0x31,0xe8,0x0c,
-0xdd,0xdf,0xc0,0x0e,0x90,0x00,0x00,0xea,0xcf,0xf9,0x00,0x00,0x4f,0x53,0x5e,0x90,
-0x00,0x0d,0xc0,0x11,0xd9,0x00,0x0a,0xf2,0x9f,0xff,0x90,0x1b,0xf3,0x00,0x22,0xe9,
-0x3e,0xc2,0x00,0x00,0x0d,0x91,0x50,0x00,0x35,0x41,0x74,0x00,0x01,0xcf,0xef,0xf8,
-0x00,0x00,0xbe,0x20,0x07,0xf5,0x00,0x0f,0x80,0x00,0x0e,0x90,0x00,0xfa,0x39,0x01,
-0x96,0x07,0xfa,0x67,0xde,0x20,0x00,0x05,0xbd,0xc9,0x30,0x02,0x80,0x03,0xf1,0xe7,
-0x0f,0xff,0xfd,0x04,0xf1,0x30,0x02,0x10,0x04,0xd5,0x01,0xa0,0xea,0xff,0xf1,0xe8,
-0x00,0x02,0xf5,0x37,0xf1,0xe8,0xcd,0x06,0xf0,0x0d,0xf1,0xe8,0x00,0x0d,0xb1,0x25,
-0xf1,0xe8,0x00,0x5f,0x4d,0xff,0xf1,0xe8,0x01,0xeb,0x00,0x15,0xf1,0xe8,0x0b,0xe1,
-0x00,0x03,0xf1,0xe8,0x3f,0x30,0x06,0x00,0x00,0xaf,0x01,0x07,0x06,0x00,0x15,0x02,
-0x30,0x02,0x20,0xce,0xee,0x85,0x17,0x51,0x04,0x55,0x54,0x4c,0xc0,0x10,0x00,0x25,
-0xbc,0x00,0x41,0x0d,0x30,0x59,0x00,0xca,0x2b,0x0d,0x11,0xe0,0x43,0x01,0x31,0x9e,
-0x00,0xe7,0x0d,0x00,0x20,0x04,0x10,0x0d,0x00,0x00,0x7b,0x16,0xc1,0xee,0xef,0xfe,
-0xee,0xee,0xd0,0x46,0x66,0x66,0x66,0x66,0x65,0xff,0x05,0x20,0xfc,0x00,0x0c,0x01,
-0x12,0x5a,0x90,0x08,0x10,0x7f,0x05,0x00,0x11,0x50,0xca,0x04,0x30,0x5f,0x10,0x8d,
-0xa9,0x02,0xc0,0xf1,0x01,0x20,0x00,0x36,0x66,0x9f,0x66,0x66,0x65,0x0a,0xee,0x01,
-0x00,0x13,0xd0,0x7e,0x1b,0x00,0x53,0x13,0x10,0xe1,0x13,0x06,0x37,0x55,0x8f,0x30,
-0x65,0x07,0x09,0x72,0x07,0x24,0x1a,0x00,0x62,0x00,0x45,0x25,0x55,0x55,0xaf,0x61,
-0x00,0x31,0x3c,0x00,0x7f,0x60,0x00,0x11,0x7d,0x06,0x00,0xf1,0x13,0x00,0x00,0x8e,
-0xee,0xff,0xee,0xee,0xed,0x36,0x65,0x55,0x55,0x56,0x64,0x00,0x33,0x00,0x00,0x06,
-0x00,0x00,0xba,0x00,0x00,0x3f,0x10,0x00,0xbc,0x55,0x55,0x8f,0x10,0x00,0xbf,0x5e,
-0x05,0x20,0xbb,0x00,0xe8,0x07,0x20,0xaf,0xff,0xd2,0x15,0x44,0x14,0x44,0x44,0x42,
-0x16,0x07,0x09,0x5a,0x00,0x13,0x3e,0x5a,0x00,0x11,0x8d,0x06,0x00,0x31,0x12,0x00,
-0x9e,0x59,0x0a,0xa0,0x25,0x55,0x55,0x55,0x55,0x53,0x00,0x00,0x14,0x42,0xae,0x07,
-0x30,0xff,0xef,0xd2,0x26,0x1f,0x51,0x02,0xdd,0x00,0x00,0x9f,0x36,0x00,0x90,0x6f,
-0x50,0x01,0xce,0x00,0x00,0x0a,0xfe,0xdf,0x96,0x0f,0x23,0x25,0x53,0x4b,0x1c,0x70,
-0x10,0x00,0x01,0x12,0x23,0x10,0x0f,0xb4,0x10,0xb1,0xff,0xf1,0x0e,0x80,0x00,0x02,
-0x22,0x27,0xf2,0x0e,0x80,0x12,0x01,0x30,0x0d,0x80,0x00,0x0d,0x08,0x00,0x07,0x00,
-0xf0,0x02,0x7d,0x06,0xf0,0x0d,0xa4,0x30,0x00,0x7e,0x08,0xe0,0x0d,0xff,0xf0,0x00,
-0x7f,0x09,0xc0,0x15,0x00,0x40,0x7f,0x03,0x40,0x0e,0x07,0x00,0x31,0x01,0x25,0x1e,
-0x71,0x1e,0xa2,0xfe,0x5e,0x80,0x00,0x24,0x44,0x32,0x10,0x0e,0x80,0x30,0x10,0x02,
-0x07,0x00,0x24,0x0d,0x70,0xbf,0x07,0x03,0x01,0x00,0xc0,0x36,0x66,0x76,0x00,0xe5,
-0x00,0x08,0xdd,0xde,0xf3,0x0f,0x60,0xf0,0x06,0xf0,0x0e,0x40,0xf7,0x00,0x00,0x03,
-0x02,0xf4,0x0f,0x70,0x00,0x03,0xf2,0x2f,0x30,0xf7,0x00,0x00,0x3f,0x31,0xd1,0x0f,
-0xff,0xb0,0x02,0xf4,0x13,0x51,0xf9,0x31,0x80,0x19,0x60,0x4f,0x70,0x01,0x34,0x33,
-0x20,0x0f,0x05,0x11,0x06,0xc2,0x1f,0x00,0xf7,0x07,0x20,0x62,0x00,0xb2,0x06,0x00,
-0x07,0x03,0x40,0xf6,0x22,0x22,0x30,0xc8,0x1e,0x01,0xc8,0x0d,0x03,0x62,0x0c,0x01,
-0x01,0x00,0x30,0x0c,0xee,0xee,0x81,0x0d,0x14,0x45,0x39,0x01,0x03,0xb8,0x06,0x11,
-0x9e,0x06,0x00,0x00,0x31,0x11,0xa0,0x0d,0x50,0xe4,0xbb,0x00,0x00,0x00,0xf7,0x1f,
-0x5c,0x14,0x1e,0x30,0x71,0xf5,0x10,0x0d,0x00,0x00,0x2e,0x0e,0xd0,0x25,0x5f,0xa7,
-0xf9,0x66,0x64,0x09,0xff,0xee,0xee,0xee,0xef,0xd0,0x7a,0x01,0x10,0x63,0x30,0x17,
-0x27,0xff,0xef,0x3c,0x02,0x22,0x00,0x07,0x0d,0x00,0x12,0x7e,0x5b,0x00,0x02,0x2e,
-0x02,0x30,0x35,0x00,0x0a,0x19,0x0c,0x81,0xee,0xe0,0x46,0x77,0x7f,0xc6,0x66,0x64,
-0xc2,0x09,0x01,0x0a,0x01,0x02,0x19,0x0c,0x18,0xe8,0x17,0x01,0x07,0x12,0x05,0x00,
-0xe6,0x02,0x11,0xfd,0x66,0x10,0x19,0x5a,0x62,0x00,0x02,0xb0,0x00,0x40,0x7c,0x00,
-0x01,0x33,0x01,0x00,0x40,0x20,0xaf,0xff,0xff,0x8d,0x1a,0x54,0x11,0x11,0x8f,0x11,
-0x11,0xcf,0x00,0xa3,0x0b,0xee,0xff,0xef,0xe1,0x00,0x00,0x46,0x66,0x65,0x9e,0x02,
-0x12,0xf3,0x9e,0x02,0x08,0xab,0x02,0x11,0x05,0x62,0x00,0x21,0xef,0xfc,0xc5,0x02,
-0x06,0x44,0x02,0x04,0xbc,0x00,0x30,0x37,0x00,0x8d,0xb5,0x00,0x72,0xdc,0x36,0x66,
-0x7a,0xf7,0x66,0x64,0xfe,0x09,0xf0,0x00,0x01,0xef,0xff,0xce,0xee,0x50,0x00,0x45,
-0x9f,0x04,0x5f,0x80,0x00,0x23,0x8f,0x2a,0x06,0x20,0xff,0xfd,0x06,0x00,0x20,0xf4,
-0x00,0x06,0x00,0xa2,0xfe,0xee,0x80,0x0e,0x70,0x00,0x45,0x54,0x10,0x02,0x11,0x0b,
-0xf2,0x01,0x50,0x01,0x45,0x55,0x50,0x0a,0xd0,0x07,0xff,0xff,0xf4,0x09,0xd0,0x00,
-0x00,0x02,0x06,0x00,0x11,0xf3,0x06,0x00,0xf0,0x0b,0xe1,0x09,0xd0,0x59,0x99,0x9a,
-0xbd,0x69,0xd0,0x59,0x9d,0xe8,0x74,0x09,0xd0,0x00,0x0b,0xc0,0x7e,0xef,0xd0,0x00,
-0x09,0xa0,0x15,0x5b,0x34,0x01,0x00,0x5d,0x0f,0x00,0xda,0x22,0x41,0x50,0x00,0x2f,
-0x50,0xf3,0x10,0x10,0x61,0xc1,0x01,0x11,0x1f,0x38,0x0c,0x23,0x01,0x33,0xea,0x06,
-0xc1,0x00,0x10,0x00,0x45,0x55,0x52,0x05,0xf0,0x04,0xff,0xfe,0xfc,0x8b,0x09,0x11,
-0xad,0xc9,0x0a,0x11,0xac,0x2f,0x09,0x11,0xbb,0x06,0x00,0x11,0xc9,0x06,0x00,0xf0,
-0x00,0x63,0x05,0xf0,0x03,0x44,0x45,0x68,0x85,0xf0,0x1e,0xff,0xff,0xdb,0x85,0xf0,
-0x72,0x01,0x1e,0x05,0x06,0x00,0x10,0xf1,0xd4,0x05,0x00,0x30,0x00,0x00,0x03,0x04,
-0x00,0x1f,0x02,0x20,0x62,0x00,0x5b,0x07,0x12,0xef,0x78,0x0d,0x12,0xcb,0x3c,0x02,
-0x02,0x0d,0x00,0x12,0xc9,0xc2,0x02,0x02,0xb2,0x01,0x31,0x62,0x00,0x08,0xde,0x01,
-0x70,0xd0,0x36,0x7f,0xb6,0x6b,0xf6,0x64,0x4c,0x00,0x11,0x8e,0xd0,0x01,0x01,0x8a,
-0x01,0x02,0x0d,0x00,0x12,0x0f,0x0d,0x00,0x36,0xd5,0x00,0x6c,0xde,0x01,0x40,0x9d,
-0xdd,0xde,0xec,0x2c,0x11,0x28,0x66,0x6b,0xde,0x01,0x03,0x8e,0x02,0x14,0x8d,0xb4,
-0x12,0x02,0xde,0x01,0x81,0x02,0x55,0x58,0xf7,0x8f,0x65,0x40,0x00,0x09,0x24,0x40,
-0x00,0x07,0x94,0xf2,0x38,0x04,0x42,0xac,0x17,0x01,0x70,0xb2,0x02,0x00,0xfc,0x00,
-0x31,0x21,0x11,0x22,0x8e,0x02,0x10,0xff,0xb4,0x20,0x46,0x33,0x33,0x22,0x00,0xf0,
-0x02,0x30,0xef,0xff,0x70,0xf0,0x02,0x36,0x54,0xea,0x00,0x5c,0x06,0x00,0x17,0x08,
-0x00,0x99,0x00,0x02,0x86,0x03,0x21,0xf5,0x00,0xd6,0x23,0x02,0x2a,0x13,0x05,0x2a,
-0x03,0x03,0x7c,0x00,0x02,0x97,0x0e,0x51,0x00,0x9e,0xee,0xff,0xfa,0x2c,0x05,0x12,
-0x5c,0xd6,0x02,0x14,0xac,0x31,0x03,0x00,0x01,0x00,0x12,0xa9,0xb2,0x12,0x12,0x11,
-0x34,0x00,0x13,0xff,0x9b,0x02,0x51,0x00,0x01,0x11,0x12,0x22,0x39,0x11,0x00,0xf9,
-0x14,0x4f,0x12,0x22,0x22,0x6f,0x8e,0x02,0x06,0x11,0x07,0x90,0x0a,0x02,0x52,0x03,
-0x3e,0xee,0xef,0xc0,0x62,0x00,0x21,0xbb,0x00,0x18,0x02,0x21,0x80,0x00,0xcf,0x04,
-0x10,0x54,0xda,0x1b,0x00,0xf7,0x08,0x18,0x01,0x36,0x01,0x12,0x9f,0x24,0x00,0x03,
-0xd1,0x03,0x01,0x12,0x01,0x13,0x08,0x12,0x01,0x30,0x22,0x22,0x22,0x9d,0x0a,0x04,
-0x8e,0x05,0x12,0xae,0x3a,0x12,0x07,0x06,0x00,0x30,0x47,0x00,0x36,0x59,0x00,0x73,
-0x64,0x8e,0xee,0xee,0xee,0xed,0xdb,0x02,0x01,0x10,0xcf,0x92,0x22,0x00,0x20,0x03,
-0xa0,0x6f,0x40,0x00,0x24,0x44,0x44,0x6f,0x40,0x00,0xdf,0x29,0x1f,0x22,0x00,0xda,
-0x1e,0x00,0x01,0x8b,0x0c,0x50,0x15,0x55,0x55,0x54,0x00,0x1e,0x01,0x11,0xfb,0x1e,
-0x01,0x22,0x5b,0xd0,0xde,0x01,0x08,0xbc,0x00,0x1f,0x9a,0x1e,0x01,0x03,0x10,0x44,
-0xf7,0x00,0x00,0xb6,0x06,0x33,0x03,0xf1,0x00,0xed,0x05,0x21,0x0b,0xff,0xff,0x0c,
-0x02,0xee,0x05,0x12,0x0a,0x28,0x0f,0x02,0xef,0x05,0x04,0xbc,0x08,0x40,0x43,0x00,
-0xe7,0x0f,0x93,0x05,0x13,0x70,0xde,0x06,0x70,0x0e,0xa0,0x0e,0x70,0x00,0x05,0xf3,
-0x0b,0x00,0x10,0xdb,0x59,0x08,0xfa,0x07,0x7f,0x20,0x00,0xe7,0x00,0x3f,0x60,0x00,
-0x0e,0x70,0x2e,0xa0,0x00,0x00,0xe7,0x1e,0xa0,0x00,0x00,0x0e,0x72,0x80,0xbc,0x08,
-0x11,0xe6,0x0b,0x00,0x17,0x50,0x6b,0x04,0x90,0x24,0x44,0x53,0x00,0xa8,0x0e,0xfe,
-0xef,0xe0,0xe2,0x02,0x10,0xda,0x43,0x07,0x40,0x6f,0x40,0x0c,0xa0,0x41,0x25,0x10,
-0xca,0x1b,0x23,0x81,0x0b,0xa1,0xed,0x50,0x00,0x00,0xb9,0x04,0x60,0x08,0x20,0x02,
-0xef,0xeb,0x22,0xc0,0x05,0x66,0x65,0x5f,0x80,0x00,0x34,0x44,0x44,0xf8,0x00,0x3f,
-0x5e,0x08,0x21,0x03,0xf4,0xa9,0x03,0x40,0xfe,0xff,0xff,0xc0,0x31,0x01,0x03,0xb2,
-0x00,0x00,0x8c,0x0a,0x10,0xb9,0x8c,0x0a,0x00,0x58,0x00,0x10,0xe9,0x58,0x00,0x10,
-0x5f,0x58,0x00,0xf0,0x01,0x1e,0xb0,0x00,0xca,0x00,0x1c,0xd1,0x00,0x0c,0xa0,0x5e,
-0xd1,0x00,0x00,0xca,0x2f,0xc8,0x02,0x30,0x70,0x00,0x91,0xc5,0x26,0xa0,0x2f,0x40,
-0x00,0x0d,0x80,0x02,0xf8,0x55,0x55,0xe8,0xbd,0x05,0x40,0xef,0x80,0x02,0xf4,0xac,
-0x02,0x11,0x1f,0x2a,0x09,0x11,0x34,0xb4,0x0d,0x01,0x28,0x0e,0xd0,0x03,0x32,0x13,
-0x30,0x0f,0x70,0x00,0x7f,0xfe,0xbf,0xf7,0x0f,0x70,0x10,0x09,0x10,0xf7,0x41,0x05,
-0x30,0xc9,0x02,0xf5,0x07,0x00,0x20,0xf6,0x05,0xac,0x06,0xf0,0x02,0x04,0xf2,0x08,
-0xf0,0x0e,0xff,0xe0,0x09,0xd0,0x0c,0xb0,0x0e,0xa4,0x20,0x1f,0x60,0x1f,0xcc,0x14,
-0x30,0x9e,0x00,0x7f,0x89,0x06,0x31,0x94,0x01,0xf8,0x72,0x05,0x24,0x05,0xd0,0x79,
-0x05,0x0f,0x9e,0x06,0x09,0xf0,0x03,0x01,0x40,0x34,0x21,0x44,0x00,0x7f,0x7f,0xfe,
-0xaf,0xf8,0x07,0xf0,0x0a,0xc0,0x0f,0x70,0x7f,0x6a,0x00,0xf0,0x14,0x07,0xf0,0x0f,
-0x60,0x5f,0x34,0x9f,0x04,0xf2,0x09,0xe7,0xff,0xf0,0x9d,0x00,0xe9,0x00,0x7f,0x1f,
-0x60,0x4f,0x30,0x07,0xf9,0xe0,0x0c,0xc0,0x00,0x7f,0x94,0x05,0xf3,0x00,0x07,0xe0,
-0x18,0x03,0x11,0x6e,0x9b,0x11,0x15,0xe0,0x5a,0x05,0x13,0x06,0x43,0x08,0xb1,0x55,
-0x53,0x15,0x66,0x00,0x00,0x5e,0xef,0xe5,0xde,0xf5,0xec,0x02,0x20,0x1f,0x40,0x9c,
-0x03,0x61,0x02,0xf3,0x00,0x00,0x01,0xf5,0x48,0x08,0x50,0x5f,0x10,0x05,0xf0,0x00,
-0xf0,0x17,0x32,0x39,0x00,0x07,0x40,0x06,0x41,0x36,0x77,0x7b,0xf6,0x40,0x06,0x03,
-0x7a,0x0f,0x17,0xf0,0xc0,0x02,0x14,0x08,0x17,0x06,0x09,0x01,0x00,0x10,0x10,0x99,
-0x0f,0xa1,0xb9,0xff,0xf3,0x00,0x01,0x44,0xcb,0x13,0x5f,0x50,0x62,0x00,0x11,0xf4,
-0x62,0x00,0x20,0x3f,0x30,0x62,0x00,0x00,0xf0,0x04,0x40,0x09,0xc0,0x00,0x6f,0xe3,
-0x06,0x01,0x5a,0x06,0x44,0x08,0x00,0x00,0x36,0x3d,0x00,0x20,0xad,0xee,0x0c,0x03,
-0x20,0x04,0x66,0x01,0x00,0x04,0x2d,0x02,0xc0,0x6f,0xff,0xd5,0xff,0xf2,0x00,0x01,
-0x54,0xbd,0x04,0x7f,0x30,0x10,0x05,0x20,0x04,0xf2,0xd9,0x05,0x01,0xc8,0x08,0x14,
-0x8d,0x9b,0x06,0x32,0x12,0x00,0x09,0x2c,0x09,0x11,0x25,0x52,0x03,0x01,0xfa,0x03,
-0x12,0x10,0x4f,0x04,0x70,0x10,0x00,0x0b,0xd2,0x22,0x26,0xf3,0xb2,0x09,0x00,0xe4,
-0x00,0x21,0x0b,0xc0,0x00,0x04,0x30,0xaf,0xee,0xef,0x6c,0x0f,0x44,0x44,0x44,0x44,
-0x20,0xcb,0x12,0xe0,0xff,0xfa,0x8f,0xfe,0x00,0x01,0x54,0xda,0x14,0x8f,0x10,0x00,
-0x00,0xf6,0xa1,0x00,0x41,0x06,0xf1,0x00,0x8e,0x01,0x04,0x30,0x79,0x00,0x24,0x92,
-0x04,0x20,0x53,0xbf,0x4c,0x03,0x13,0xea,0x31,0x00,0x11,0xbf,0x91,0x21,0x11,0xeb,
-0xe9,0x08,0x02,0x06,0x00,0x11,0xef,0x20,0x09,0x21,0xf8,0x00,0x2d,0x24,0x40,0xee,
-0xee,0xef,0x20,0xf8,0x03,0x13,0x43,0x6b,0x0c,0x11,0x63,0x9d,0x07,0x11,0xe9,0x37,
-0x01,0x0c,0x06,0x00,0x21,0xf4,0x41,0xa6,0x15,0x21,0xf7,0xe8,0xce,0x07,0x02,0x06,
-0x00,0xe3,0xe9,0x12,0x35,0x27,0xf0,0x00,0xcf,0xff,0xfe,0x57,0xf0,0x00,0x02,0x21,
-0xe6,0x07,0x08,0x06,0x00,0x26,0x06,0xe0,0x3c,0x05,0x41,0x01,0x60,0x00,0xc7,0x31,
-0x07,0x10,0xe9,0xb6,0x00,0x00,0x06,0x00,0x40,0x05,0xf5,0x41,0xe8,0x16,0x1f,0xf2,
-0x02,0xf7,0xf8,0x00,0x01,0x05,0xf1,0x00,0xee,0xdd,0xef,0xa5,0xf1,0x00,0x37,0x77,
-0x53,0x05,0xc2,0x01,0x11,0x40,0xf7,0x10,0x71,0xf0,0x00,0x02,0x66,0x65,0x58,0xf2,
-0xf6,0x10,0x31,0xf1,0x00,0x09,0xdf,0x04,0x02,0xf5,0x10,0x57,0x09,0xfe,0xef,0xff,
-0xf6,0xf4,0x10,0x35,0x30,0x00,0x74,0x60,0x00,0x04,0x06,0x00,0x20,0xe8,0x00,0x6c,
-0x27,0x00,0x06,0x00,0x60,0xf4,0x40,0xfa,0x33,0x57,0x56,0xae,0x00,0xb1,0xfd,0x66,
-0xf0,0x00,0x01,0x11,0x00,0x04,0xe0,0x00,0x00,0x71,0x04,0x11,0x09,0x51,0x04,0x80,
-0x0a,0xd1,0x11,0x16,0xf1,0x00,0x0a,0xd0,0x36,0x00,0x02,0x06,0x00,0x01,0x18,0x00,
-0x00,0x80,0x01,0x21,0x43,0x10,0xc5,0x00,0xf4,0x04,0x04,0x16,0x40,0x00,0x0e,0x60,
-0xe7,0xd9,0x00,0x00,0xf7,0x0f,0x7e,0x80,0x00,0x0f,0x70,0xf7,0xe8,0x0b,0x00,0x30,
-0x82,0xf7,0xe8,0x10,0x23,0x02,0x0b,0x00,0x10,0xf8,0x16,0x00,0xe0,0x7f,0x91,0x35,
-0x1f,0x70,0xf7,0xdf,0xff,0xe5,0xf7,0x0f,0x70,0x32,0x10,0xe4,0x0f,0x21,0x00,0x00,
-0x94,0x03,0x02,0x0b,0x00,0x36,0xb4,0x0d,0x70,0xe3,0x0d,0xb7,0x26,0x00,0x00,0x01,
-0xf4,0x8f,0x00,0x00,0x02,0xf5,0x8e,0x05,0x00,0x90,0x8d,0xdd,0xf5,0x8e,0x00,0x37,
-0x78,0xf5,0x8e,0x99,0x02,0x11,0x9e,0x05,0x00,0xd0,0x01,0x25,0x31,0xf5,0x6f,0xff,
-0xff,0x91,0xf5,0x02,0x22,0x10,0x01,0x20,0x03,0x07,0x05,0x00,0x16,0xf4,0xa5,0x06,
-0x10,0x4a,0x7b,0x06,0x00,0x0d,0x03,0xb0,0xca,0x8e,0x00,0x15,0x66,0xda,0x8e,0x00,
-0x4d,0xee,0xfa,0xc9,0x09,0xb1,0xba,0x9f,0x66,0x78,0xa0,0xca,0x4e,0xee,0xca,0x70,
-0xc9,0x49,0x0d,0x02,0xb3,0x04,0x41,0x56,0x66,0x55,0xf8,0xb2,0x04,0x10,0x02,0x61,
-0x15,0x21,0x02,0xf5,0x5a,0x19,0x36,0xef,0xff,0xfc,0xb0,0x04,0x70,0x06,0xc0,0x00,
+0x70,0x02,0x33,0xd0,0x01,0x15,0xf4,0x19,0x46,0x66,0x73,0x00,0xe7,0x0c,0xdd,0xcf,
+0xc1,0x1e,0x70,0x00,0x00,0xe9,0xef,0xf7,0x00,0x00,0x5f,0x41,0x2e,0x70,0x00,0x1e,
+0xb0,0x11,0xe7,0x00,0x1c,0xd1,0x9f,0xff,0x70,0x4d,0xd1,0x01,0x33,0xe7,0x2f,0x80,
+0x42,0x00,0x31,0x41,0x00,0x1e,0x52,0x07,0x41,0x55,0x55,0x54,0xe9,0x4d,0x00,0x01,
+0x28,0x08,0x16,0xd9,0x0b,0x00,0x11,0x42,0x58,0x00,0xf0,0x07,0x20,0x06,0x99,0x9a,
+0x50,0x0c,0xa0,0x08,0xba,0xaf,0x94,0x5d,0xb0,0x00,0x00,0x1f,0x4d,0xef,0xb0,0x00,
+0x00,0xad,0x2e,0x0c,0xf0,0x03,0x07,0xf3,0x25,0x5d,0xb0,0x00,0x9f,0x60,0x6f,0xff,
+0xb0,0x0d,0xd4,0x00,0x00,0x0c,0xa0,0x05,0x55,0x01,0x31,0x20,0x00,0x2e,0xb9,0x01,
+0xb1,0x06,0x66,0x66,0x5f,0x80,0x00,0x03,0x44,0x44,0x5f,0x80,0xcb,0x01,0x10,0x40,
+0xdc,0x01,0x00,0xd3,0x09,0x10,0xfe,0xca,0x09,0x56,0x02,0x55,0x55,0x54,0x30,0xb8,
+0x00,0xf0,0x31,0xe8,0x0c,0xdd,0xdf,0xc0,0x0e,0x90,0x00,0x00,0xea,0xcf,0xf9,0x00,
+0x00,0x4f,0x53,0x5e,0x90,0x00,0x0d,0xc0,0x11,0xd9,0x00,0x0a,0xf2,0x9f,0xff,0x90,
+0x1b,0xf3,0x00,0x22,0xe9,0x3e,0xc2,0x00,0x00,0x0d,0x91,0x50,0x00,0x35,0x41,0x74,
+0x00,0x01,0xcf,0xef,0xf8,0x00,0x00,0xbe,0x20,0x07,0xf5,0x00,0x0f,0x80,0x00,0x0e,
+0x90,0x00,0xfa,0x39,0x01,0x96,0x07,0xfa,0x67,0xde,0x20,0x00,0x05,0xbd,0xc9,0x30,
+0x02,0x80,0x03,0xf1,0xe7,0x0f,0xff,0xfd,0x04,0xf1,0x30,0x02,0x10,0x04,0xd5,0x01,
+0xa0,0xea,0xff,0xf1,0xe8,0x00,0x02,0xf5,0x37,0xf1,0xe8,0xcd,0x06,0xf0,0x0d,0xf1,
+0xe8,0x00,0x0d,0xb1,0x25,0xf1,0xe8,0x00,0x5f,0x4d,0xff,0xf1,0xe8,0x01,0xeb,0x00,
+0x15,0xf1,0xe8,0x0b,0xe1,0x00,0x03,0xf1,0xe8,0x3f,0x30,0x06,0x00,0x00,0xaf,0x01,
+0x07,0x06,0x00,0x15,0x02,0x30,0x02,0xb1,0xce,0xee,0xff,0xf9,0x00,0x00,0x04,0x55,
+0x54,0x4c,0xc0,0x10,0x00,0x25,0xbc,0x00,0x41,0x0d,0x30,0x59,0x00,0xca,0x2b,0x0d,
+0x11,0xe0,0x43,0x01,0x31,0x9e,0x00,0xe7,0x0d,0x00,0x31,0x04,0x10,0x00,0xdf,0x05,
+0xf0,0x00,0x00,0x0a,0xee,0xef,0xfe,0xee,0xee,0xd0,0x46,0x66,0x66,0x66,0x66,0x65,
+0x00,0xd0,0x00,0x9f,0xff,0xff,0xfc,0x00,0x00,0x02,0x55,0x55,0x5a,0xf0,0x00,0x01,
+0x00,0x10,0x7f,0x05,0x00,0xf0,0x0a,0x50,0x08,0xe0,0x00,0x00,0x00,0x5f,0x10,0x8d,
+0x00,0x00,0x00,0x05,0xf1,0x01,0x20,0x00,0x36,0x66,0x9f,0x66,0x66,0x65,0x0a,0xee,
+0x01,0x00,0x22,0xd0,0x00,0x01,0x00,0xc0,0x0b,0xff,0xff,0xff,0xe1,0x00,0x00,0x35,
+0x55,0x55,0x8f,0x30,0x10,0x00,0x21,0x04,0xf2,0x17,0x00,0x27,0x4f,0x20,0x0d,0x00,
+0x33,0x1a,0x00,0x00,0x62,0x00,0x45,0x25,0x55,0x55,0xaf,0x61,0x00,0x31,0x3c,0x00,
+0x7f,0x60,0x00,0x11,0x7d,0x06,0x00,0xf1,0x28,0x00,0x00,0x8e,0xee,0xff,0xee,0xee,
+0xed,0x36,0x65,0x55,0x55,0x56,0x64,0x00,0x33,0x00,0x00,0x06,0x00,0x00,0xba,0x00,
+0x00,0x3f,0x10,0x00,0xbc,0x55,0x55,0x8f,0x10,0x00,0xbf,0xff,0xff,0xff,0x10,0x00,
+0xbb,0x00,0x00,0x4f,0x10,0x00,0xaf,0xff,0xff,0xff,0x00,0x00,0x14,0x44,0x44,0x42,
+0x5a,0x00,0x1b,0xfd,0x5a,0x00,0x13,0x3e,0x5a,0x00,0x11,0x8d,0x06,0x00,0xf1,0x13,
+0x12,0x00,0x9e,0xff,0xff,0xff,0xff,0xfd,0x25,0x55,0x55,0x55,0x55,0x53,0x00,0x00,
+0x14,0x42,0x00,0x00,0x00,0x08,0xff,0xef,0xd2,0x00,0x00,0x6f,0x70,0x02,0xdd,0x00,
+0x00,0x9f,0x36,0x00,0xf2,0x00,0x6f,0x50,0x01,0xce,0x00,0x00,0x0a,0xfe,0xdf,0xe2,
+0x00,0x00,0x00,0x25,0x53,0xdf,0x00,0xf1,0x08,0x04,0x10,0x00,0x01,0x12,0x23,0x10,
+0x0f,0x70,0x00,0x1f,0xff,0xff,0xf1,0x0e,0x80,0x00,0x02,0x22,0x27,0xf2,0x0e,0x80,
+0x12,0x01,0x10,0x0d,0x07,0x00,0x20,0x06,0xf0,0x07,0x00,0xf0,0x02,0x7d,0x06,0xf0,
+0x0d,0xa4,0x30,0x00,0x7e,0x08,0xe0,0x0d,0xff,0xf0,0x00,0x7f,0x09,0xc0,0x15,0x00,
+0x40,0x7f,0x03,0x40,0x0e,0x07,0x00,0x40,0x01,0x25,0x1e,0x80,0xb2,0x00,0xa1,0xfe,
+0x5e,0x80,0x00,0x24,0x44,0x32,0x10,0x0e,0x80,0x5b,0x00,0x03,0x07,0x00,0x21,0x0d,
+0x70,0x07,0x00,0x24,0x01,0x00,0x01,0x00,0xf1,0x2a,0x36,0x66,0x76,0x00,0xe5,0x00,
+0x08,0xdd,0xde,0xf3,0x0f,0x60,0x00,0x00,0x00,0x2f,0x40,0xf7,0x00,0x00,0x03,0x02,
+0xf4,0x0f,0x70,0x00,0x03,0xf2,0x2f,0x30,0xf7,0x00,0x00,0x3f,0x31,0xd1,0x0f,0xff,
+0xb0,0x02,0xf4,0x13,0x51,0xf9,0x31,0x9f,0xff,0xff,0xfe,0x4f,0x70,0x01,0x34,0x33,
+0x20,0x00,0xf7,0x32,0x01,0x00,0x27,0x00,0x71,0xf3,0x00,0x00,0x62,0x00,0x00,0x3f,
+0x90,0x01,0xf4,0x03,0x03,0xf6,0x22,0x22,0x30,0x00,0x00,0x2f,0xff,0xff,0xff,0x80,
+0x00,0x00,0x11,0x11,0x11,0x10,0x68,0x00,0x84,0x0c,0xee,0xee,0xff,0xb0,0x00,0x00,
+0x45,0x39,0x01,0x21,0x08,0xe0,0x07,0x00,0x11,0x9e,0x06,0x00,0xf1,0x06,0x0a,0xc0,
+0x00,0x00,0x0d,0x50,0xe4,0xbb,0x00,0x00,0x00,0xf7,0x1f,0x5c,0x90,0x00,0x00,0x0f,
+0x71,0xf5,0x10,0x0d,0x00,0xf0,0x01,0x50,0x00,0x00,0x25,0x5f,0xa7,0xf9,0x66,0x64,
+0x09,0xff,0xee,0xee,0xee,0xef,0xd0,0x7a,0x01,0x77,0x63,0x00,0x00,0x0a,0xff,0xff,
+0xef,0x3c,0x02,0x22,0x00,0x07,0x0d,0x00,0x12,0x7e,0x5b,0x00,0x02,0x2e,0x02,0xf2,
+0x04,0x35,0x00,0x0a,0xdd,0xdd,0xdd,0xdd,0xee,0xe0,0x46,0x77,0x7f,0xc6,0x66,0x64,
+0x00,0x00,0x00,0xe9,0x0a,0x01,0x11,0x90,0x07,0x00,0x18,0xe8,0x17,0x01,0x26,0xd6,
+0x00,0x01,0x00,0x20,0xce,0xee,0xe2,0x01,0x1a,0x03,0x9e,0x02,0x22,0x00,0x07,0xb0,
+0x00,0x40,0x7c,0x00,0x01,0x33,0x01,0x00,0x20,0x20,0xaf,0xe5,0x01,0x74,0xfe,0x00,
+0x11,0x11,0x8f,0x11,0x11,0xcf,0x00,0xa3,0x0b,0xee,0xff,0xef,0xe1,0x00,0x00,0x46,
+0x66,0x65,0x9e,0x02,0x12,0xf3,0x9e,0x02,0x08,0xab,0x02,0x11,0x05,0x62,0x00,0x21,
+0xef,0xfc,0xc5,0x02,0x06,0x44,0x02,0x04,0xbc,0x00,0x30,0x37,0x00,0x8d,0xb5,0x00,
+0x70,0xdc,0x36,0x66,0x7a,0xf7,0x66,0x64,0xf1,0x01,0xf0,0x08,0x00,0x00,0x01,0xef,
+0xff,0xce,0xee,0x50,0x00,0x45,0x9f,0x04,0x5f,0x80,0x00,0x23,0x8f,0x00,0x0e,0x80,
+0x01,0xff,0xfd,0x06,0x00,0x20,0xf4,0x00,0x06,0x00,0xb1,0xfe,0xee,0x80,0x0e,0x70,
+0x00,0x45,0x54,0x10,0x02,0x00,0x83,0x01,0xf2,0x01,0x50,0x01,0x45,0x55,0x50,0x0a,
+0xd0,0x07,0xff,0xff,0xf4,0x09,0xd0,0x00,0x00,0x02,0x06,0x00,0x11,0xf3,0x06,0x00,
+0xf1,0x0b,0xe1,0x09,0xd0,0x59,0x99,0x9a,0xbd,0x69,0xd0,0x59,0x9d,0xe8,0x74,0x09,
+0xd0,0x00,0x0b,0xc0,0x7e,0xef,0xd0,0x00,0x09,0xa0,0x15,0x5b,0x34,0x01,0xc0,0x09,
+0xd0,0x00,0x1f,0x40,0x00,0x03,0x50,0x00,0x2f,0x50,0x00,0x0d,0x02,0x40,0x61,0x11,
+0x11,0x10,0x8b,0x02,0x72,0xff,0xf0,0x00,0x01,0x33,0x22,0x22,0xcd,0x01,0xc0,0x10,
+0x00,0x45,0x55,0x52,0x05,0xf0,0x04,0xff,0xfe,0xfc,0x06,0x22,0x01,0x20,0xad,0x05,
+0x06,0x00,0x71,0xac,0x05,0xf1,0x00,0x00,0x00,0xbb,0x06,0x00,0x11,0xc9,0x06,0x00,
+0xf0,0x00,0x63,0x05,0xf0,0x03,0x44,0x45,0x68,0x85,0xf0,0x1e,0xff,0xff,0xdb,0x85,
+0xf0,0x72,0x01,0x1d,0x05,0x06,0x00,0x00,0x2a,0x00,0x11,0xe7,0x06,0x00,0x00,0x03,
+0x04,0x00,0x1f,0x02,0x81,0x62,0x00,0x00,0x0e,0xff,0xff,0xef,0xa0,0x12,0x00,0x12,
+0xcb,0x3c,0x02,0x02,0x0d,0x00,0x12,0xc9,0xc2,0x02,0x02,0xb2,0x01,0x31,0x62,0x00,
+0x08,0xde,0x01,0x70,0xd0,0x36,0x7f,0xb6,0x6b,0xf6,0x64,0x4c,0x00,0x11,0x8e,0xd0,
+0x01,0x01,0x8a,0x01,0x02,0x0d,0x00,0x12,0x0f,0x0d,0x00,0x36,0xd5,0x00,0x6c,0xde,
+0x01,0xa8,0x9d,0xdd,0xde,0xec,0x00,0x00,0x04,0x66,0x66,0x6b,0xde,0x01,0x03,0x8e,
+0x02,0x12,0x8d,0x1d,0x03,0x22,0x20,0x00,0xde,0x01,0xf0,0x02,0x02,0x55,0x58,0xf7,
+0x8f,0x65,0x40,0x00,0x00,0x4f,0x25,0xf1,0x00,0x00,0x07,0x94,0xf2,0x38,0x04,0x42,
+0xac,0x17,0x01,0x70,0xb2,0x02,0x00,0xfc,0x00,0x31,0x21,0x11,0x22,0x8e,0x02,0x96,
+0xff,0xf8,0x00,0x00,0x02,0x33,0x33,0x22,0x00,0xf0,0x02,0x30,0xef,0xff,0x70,0xf0,
+0x02,0x22,0x54,0xea,0xb7,0x00,0x02,0x76,0x02,0x11,0xd8,0x06,0x00,0x12,0x0f,0x86,
+0x03,0x11,0xf5,0x06,0x00,0x23,0x1f,0x30,0x57,0x01,0x03,0x01,0x00,0x03,0x7c,0x00,
+0x10,0x44,0x01,0x00,0x61,0x30,0x00,0x9e,0xee,0xff,0xfa,0x2c,0x05,0x12,0x5c,0xd6,
+0x02,0x14,0xac,0x31,0x03,0x00,0x01,0x00,0x30,0xa9,0x00,0x00,0x7d,0x02,0x12,0x11,
+0x34,0x00,0x13,0xff,0x9b,0x02,0xff,0x03,0x00,0x01,0x11,0x12,0x22,0x00,0x00,0x0d,
+0xff,0xff,0xff,0xf2,0x00,0x00,0x12,0x22,0x22,0x6f,0x8e,0x02,0x06,0x62,0x07,0x00,
+0x00,0x00,0x24,0x45,0x52,0x03,0x3e,0xee,0xef,0xc0,0x62,0x00,0x21,0xbb,0x00,0x18,
+0x02,0x21,0x80,0x00,0xcf,0x04,0x21,0x54,0x09,0x68,0x00,0x38,0xd0,0x00,0x01,0x36,
+0x01,0x12,0x9f,0x24,0x00,0x03,0xd1,0x03,0x01,0x12,0x01,0x13,0x08,0x12,0x01,0x20,
+0x22,0x22,0x12,0x01,0x14,0x8f,0x8e,0x05,0x11,0xae,0x23,0x00,0x17,0x8e,0x06,0x00,
+0x30,0x47,0x00,0x36,0x59,0x00,0x73,0x64,0x8e,0xee,0xee,0xee,0xed,0xdb,0x02,0x01,
+0x50,0xcf,0xff,0xff,0xff,0x20,0x20,0x03,0xf2,0x01,0x6f,0x40,0x00,0x24,0x44,0x44,
+0x6f,0x40,0x00,0xdf,0xff,0xff,0xfe,0x10,0x00,0xda,0x1e,0x00,0xa0,0xee,0xff,0xff,
+0x60,0x00,0x15,0x55,0x55,0x54,0x00,0x1e,0x01,0x11,0xfb,0x1e,0x01,0x22,0x5b,0xd0,
+0xde,0x01,0x08,0xbc,0x00,0x1f,0x9a,0x1e,0x01,0x03,0x11,0x44,0xf7,0x00,0x63,0x0b,
+0xb0,0x00,0x03,0xf1,0x00,0xed,0x05,0x00,0x57,0x06,0x23,0xf1,0x00,0xee,0x05,0x11,
+0x0a,0xf0,0x02,0x03,0xef,0x05,0x02,0x96,0x05,0x60,0x23,0x33,0x43,0x00,0xe7,0x0f,
+0x93,0x05,0x10,0x70,0xb3,0x04,0xa0,0xe7,0x00,0x00,0x0e,0xa0,0x0e,0x70,0x00,0x05,
+0xf3,0x0b,0x00,0xf0,0x0b,0xdb,0x00,0x0e,0x70,0x00,0x7f,0x20,0x00,0xe7,0x00,0x3f,
+0x60,0x00,0x0e,0x70,0x2e,0xa0,0x00,0x00,0xe7,0x1e,0xa0,0x00,0x00,0x0e,0x72,0xaa,
+0x02,0x11,0xe7,0x66,0x04,0x01,0xf0,0x01,0x11,0xe6,0x0b,0x00,0x17,0x50,0x6b,0x04,
+0x90,0x24,0x44,0x53,0x00,0xa8,0x0e,0xfe,0xef,0xe0,0xe2,0x02,0xf0,0x0b,0xda,0x00,
+0xca,0x00,0x00,0x6f,0x40,0x0c,0xa0,0x00,0x4f,0xa0,0x00,0xca,0x00,0x8f,0x90,0x00,
+0x0b,0xa1,0xed,0x50,0x00,0x00,0xb9,0x04,0xd6,0x03,0xf1,0x0a,0x20,0x02,0xef,0xff,
+0xff,0xf6,0x00,0x05,0x66,0x65,0x5f,0x80,0x00,0x34,0x44,0x44,0xf8,0x00,0x3f,0xff,
+0xff,0xff,0x40,0x03,0xf4,0xa9,0x03,0x40,0xfe,0xff,0xff,0xc0,0x31,0x01,0x03,0xb2,
+0x00,0x90,0x34,0x45,0x52,0x00,0xb9,0x0e,0xff,0xef,0xc0,0x58,0x00,0x10,0xe9,0x58,
+0x00,0x10,0x5f,0x58,0x00,0xf0,0x01,0x1e,0xb0,0x00,0xca,0x00,0x1c,0xd1,0x00,0x0c,
+0xa0,0x5e,0xd1,0x00,0x00,0xca,0x2f,0xc8,0x02,0xf0,0x02,0x70,0x00,0x91,0x00,0x00,
+0x74,0x00,0x2f,0x40,0x00,0x0d,0x80,0x02,0xf8,0x55,0x55,0xe8,0xbd,0x05,0x40,0xef,
+0x80,0x02,0xf4,0xac,0x02,0x00,0xfb,0x03,0x10,0x70,0x6e,0x00,0x02,0xdd,0x05,0xd0,
+0x00,0x00,0x03,0x32,0x13,0x30,0x0f,0x70,0x00,0x7f,0xfe,0xbf,0xf7,0xc4,0x02,0x30,
+0xad,0x00,0xf7,0x41,0x05,0x30,0xc9,0x02,0xf5,0x07,0x00,0x20,0xf6,0x05,0xac,0x06,
+0xf0,0x09,0x04,0xf2,0x08,0xf0,0x0e,0xff,0xe0,0x09,0xd0,0x0c,0xb0,0x0e,0xa4,0x20,
+0x1f,0x60,0x1f,0x60,0x0e,0x80,0x00,0x9e,0x00,0x7f,0x89,0x06,0x31,0x94,0x01,0xf8,
+0x72,0x05,0x24,0x05,0xd0,0x79,0x05,0x0f,0x9e,0x06,0x09,0xf0,0x03,0x01,0x40,0x34,
+0x21,0x44,0x00,0x7f,0x7f,0xfe,0xaf,0xf8,0x07,0xf0,0x0a,0xc0,0x0f,0x70,0x7f,0x6a,
+0x00,0xf0,0x14,0x07,0xf0,0x0f,0x60,0x5f,0x34,0x9f,0x04,0xf2,0x09,0xe7,0xff,0xf0,
+0x9d,0x00,0xe9,0x00,0x7f,0x1f,0x60,0x4f,0x30,0x07,0xf9,0xe0,0x0c,0xc0,0x00,0x7f,
+0x94,0x05,0xf3,0x00,0x07,0xe0,0x18,0x03,0x20,0x6e,0x00,0x2f,0x07,0x15,0xe0,0x5a,
+0x05,0x13,0x06,0x43,0x08,0xb1,0x55,0x53,0x15,0x66,0x00,0x00,0x5e,0xef,0xe5,0xde,
+0xf5,0xec,0x02,0x20,0x1f,0x40,0x9c,0x03,0x61,0x02,0xf3,0x00,0x00,0x01,0xf5,0x48,
+0x08,0x20,0x5f,0x10,0x9a,0x04,0x62,0x05,0x80,0x00,0x39,0x00,0x07,0x40,0x06,0x41,
+0x36,0x77,0x7b,0xf6,0x40,0x06,0x12,0x8f,0xf6,0x02,0x17,0xf0,0xc0,0x02,0x14,0x08,
+0x17,0x06,0x08,0x01,0x00,0x00,0xcc,0x03,0xc1,0x6f,0xff,0xb9,0xff,0xf3,0x00,0x01,
+0x44,0xcb,0x13,0x5f,0x50,0x62,0x00,0x11,0xf4,0x62,0x00,0x20,0x3f,0x30,0x62,0x00,
+0x00,0xf0,0x04,0x40,0x09,0xc0,0x00,0x6f,0xe3,0x06,0x01,0x5a,0x06,0x44,0x08,0x00,
+0x00,0x36,0x3d,0x00,0x20,0xad,0xee,0x0c,0x03,0x20,0x04,0x66,0x01,0x00,0x04,0x2d,
+0x02,0xc0,0x6f,0xff,0xd5,0xff,0xf2,0x00,0x01,0x54,0xbd,0x04,0x7f,0x30,0x10,0x05,
+0x20,0x04,0xf2,0xd9,0x05,0x01,0xc8,0x08,0x14,0x8d,0x9b,0x06,0x32,0x12,0x00,0x09,
+0x2c,0x09,0x11,0x25,0x52,0x03,0x01,0xfa,0x03,0x12,0x10,0x4f,0x04,0xa1,0x10,0x00,
+0x0b,0xd2,0x22,0x26,0xf3,0x00,0x00,0xbc,0x2c,0x09,0x21,0x0b,0xc0,0x00,0x04,0xb3,
+0xaf,0xee,0xef,0xff,0x10,0x00,0x00,0x44,0x44,0x44,0x20,0x67,0x00,0xf0,0x00,0x06,
+0xff,0xfa,0x8f,0xfe,0x00,0x01,0x54,0xda,0x14,0x8f,0x10,0x00,0x00,0xf6,0xa1,0x00,
+0x41,0x06,0xf1,0x00,0x8e,0x01,0x04,0x30,0x79,0x00,0x24,0x92,0x04,0x20,0x53,0xbf,
+0x4c,0x03,0x13,0xea,0x31,0x00,0x10,0xbf,0x04,0x07,0x21,0x00,0xeb,0xe9,0x08,0x02,
+0x06,0x00,0x11,0xef,0x20,0x09,0x11,0xf8,0x1e,0x00,0x50,0xef,0xee,0xee,0xef,0x20,
+0xf8,0x03,0x11,0x43,0x0f,0x00,0x31,0x20,0x00,0x63,0x9d,0x07,0x11,0xe9,0x37,0x01,
+0x0c,0x06,0x00,0x91,0xf4,0x41,0xe9,0x00,0x00,0x07,0xff,0xf7,0xe8,0xce,0x07,0x02,
+0x06,0x00,0xe3,0xe9,0x12,0x35,0x27,0xf0,0x00,0xcf,0xff,0xfe,0x57,0xf0,0x00,0x02,
+0x21,0xe6,0x07,0x08,0x06,0x00,0x26,0x06,0xe0,0x3c,0x05,0x41,0x01,0x60,0x00,0xc7,
+0x31,0x07,0x10,0xe9,0xb6,0x00,0x00,0x06,0x00,0xf2,0x0a,0x05,0xf5,0x41,0xe8,0x00,
+0x00,0x05,0xff,0xf7,0xf8,0x00,0x01,0x05,0xf1,0x00,0xee,0xdd,0xef,0xa5,0xf1,0x00,
+0x37,0x77,0x53,0x05,0xc2,0x01,0x40,0x40,0x00,0x07,0xef,0xeb,0x03,0xd1,0x02,0x66,
+0x65,0x58,0xf2,0x00,0x01,0x44,0x44,0x48,0xf1,0x00,0x09,0xdf,0x04,0x21,0x0a,0xe0,
+0xd2,0x04,0xa1,0xfe,0xef,0xff,0xf6,0x00,0x00,0x55,0x55,0x55,0x40,0x30,0x00,0x35,
+0x30,0x00,0x74,0x60,0x00,0x04,0x06,0x00,0x10,0xe8,0x35,0x01,0x10,0xf7,0x06,0x00,
+0x60,0xf4,0x40,0xfa,0x33,0x57,0x56,0xae,0x00,0xb1,0xfd,0x66,0xf0,0x00,0x01,0x11,
+0x00,0x04,0xe0,0x00,0x00,0x71,0x04,0x11,0x09,0x51,0x04,0x80,0x0a,0xd1,0x11,0x16,
+0xf1,0x00,0x0a,0xd0,0x36,0x00,0x02,0x06,0x00,0x01,0x18,0x00,0x00,0x80,0x01,0x21,
+0x43,0x10,0xc5,0x00,0xf4,0x04,0x04,0x16,0x40,0x00,0x0e,0x60,0xe7,0xd9,0x00,0x00,
+0xf7,0x0f,0x7e,0x80,0x00,0x0f,0x70,0xf7,0xe8,0x0b,0x00,0x10,0x82,0x0b,0x00,0x22,
+0xff,0xff,0x0b,0x00,0x10,0xf8,0x16,0x00,0xf0,0x02,0x7f,0x91,0x35,0x1f,0x70,0xf7,
+0xdf,0xff,0xe5,0xf7,0x0f,0x70,0x32,0x10,0x0f,0x70,0xf7,0x4c,0x02,0x00,0x94,0x03,
+0x02,0x0b,0x00,0x13,0xb4,0x4b,0x03,0x01,0x78,0x01,0xb7,0x26,0x00,0x00,0x01,0xf4,
+0x8f,0x00,0x00,0x02,0xf5,0x8e,0x05,0x00,0x90,0x8d,0xdd,0xf5,0x8e,0x00,0x37,0x78,
+0xf5,0x8e,0x99,0x02,0x11,0x9e,0x05,0x00,0xd0,0x01,0x25,0x31,0xf5,0x6f,0xff,0xff,
+0x91,0xf5,0x02,0x22,0x10,0x01,0x20,0x03,0x07,0x05,0x00,0x16,0xf4,0xa5,0x06,0x10,
+0x4a,0x7b,0x06,0x00,0x0d,0x03,0xb0,0xca,0x8e,0x00,0x15,0x66,0xda,0x8e,0x00,0x4d,
+0xee,0xfa,0xc9,0x09,0xa1,0xba,0x9f,0x66,0x78,0xa0,0xca,0x4e,0xee,0xca,0x70,0xab,
+0x07,0x12,0x42,0xb3,0x04,0x41,0x56,0x66,0x55,0xf8,0xb2,0x04,0x61,0x02,0xff,0xff,
+0xff,0xf4,0x02,0x4d,0x00,0x46,0xff,0xef,0xff,0xfc,0xb0,0x04,0x70,0x06,0xc0,0x00,
 0x00,0x09,0xa0,0x8f,0x6f,0x06,0x60,0x08,0xe0,0x01,0x56,0x6c,0xb0,0x52,0x00,0xf1,
 0x2e,0xfb,0x09,0xe0,0x00,0x02,0x0a,0xb0,0x8f,0xde,0xef,0xf0,0xbb,0x01,0x66,0x65,
 0x20,0x0b,0xb0,0x00,0x04,0x75,0x53,0x66,0x00,0x00,0x6c,0xde,0xc0,0x00,0x05,0x99,
@@ -836,1768 +894,2081 @@ static const uint8_t lz4FontData[] ={
 0x06,0xe0,0xf6,0xe8,0x00,0x00,0x6e,0x0f,0x6e,0x80,0x1a,0xad,0xe0,0xf6,0xe8,0x01,
 0x9a,0xce,0x0f,0x7e,0x16,0x00,0x00,0x50,0x01,0x10,0x6e,0x50,0x01,0x20,0x16,0xe0,
 0x50,0x01,0x10,0x6e,0x50,0x01,0x30,0x07,0xe0,0xf7,0x39,0x04,0x00,0x50,0x01,0x02,
-0x0b,0x00,0x14,0x4a,0x74,0x0e,0x18,0x13,0xf7,0x03,0x19,0x8e,0xfa,0x06,0x02,0x0d,
-0x00,0x11,0xe2,0x76,0x03,0x00,0xaa,0x11,0x00,0xfb,0x16,0x21,0x44,0x21,0xb7,0x0c,
-0x15,0xa0,0x4d,0x07,0xa2,0x35,0x55,0x6d,0xc6,0x66,0x65,0x0b,0xff,0xee,0xee,0xda,
-0x17,0x07,0xc6,0x02,0x18,0x8f,0x5b,0x00,0x40,0x8f,0x44,0x44,0x54,0x5c,0x02,0x01,
-0xf3,0x1a,0x00,0x15,0x00,0x00,0xe6,0x06,0x50,0xbe,0x54,0x45,0x30,0x9f,0x1e,0x08,
-0x18,0xed,0x2d,0x08,0x70,0x40,0x00,0x02,0x56,0x44,0x56,0x30,0x48,0x00,0x01,0x4a,
-0x00,0x11,0x6f,0xd5,0x08,0x10,0xef,0x0d,0x23,0x00,0x89,0x0e,0x21,0x43,0x31,0x41,
-0x14,0x0f,0xba,0x04,0x04,0x41,0x9e,0x22,0x22,0x33,0x1e,0x19,0x00,0x01,0x07,0x04,
-0xce,0x10,0x01,0x81,0x00,0x02,0x35,0x07,0x6e,0x44,0x44,0xaf,0x44,0x33,0x20,0x3c,
-0x00,0x06,0x0d,0x00,0x02,0x11,0x12,0x17,0x02,0x4e,0x09,0x17,0x8f,0x06,0x00,0x50,
-0x7f,0xfe,0xef,0xfe,0x00,0xb7,0x06,0x15,0x53,0xea,0x07,0x43,0xef,0xfe,0xed,0xdb,
-0x51,0x0b,0x10,0xcf,0x9d,0x04,0x00,0x22,0x04,0x20,0x8f,0x20,0x5f,0x04,0x21,0x8f,
-0x20,0xea,0x07,0x1e,0x00,0xea,0x07,0x0f,0xc2,0x00,0x29,0x81,0xdc,0x43,0x7f,0x43,
-0x20,0x00,0x0c,0xb0,0x09,0x15,0x10,0xcb,0xc4,0x13,0x00,0xb5,0x0f,0x00,0x73,0x0a,
-0x10,0xb9,0xf0,0x07,0x00,0x99,0x1b,0x16,0x20,0xda,0x01,0x1f,0xf0,0xda,0x01,0x08,
-0x21,0x23,0x40,0xda,0x01,0x10,0xff,0xda,0x01,0x2b,0x22,0x21,0x08,0x18,0x02,0xf7,
-0x0d,0x34,0x03,0x55,0x55,0x31,0x04,0x00,0xee,0x0b,0x18,0xe0,0x65,0x0a,0x12,0xf0,
-0x97,0x00,0x00,0x3e,0x12,0x00,0xda,0x01,0x00,0x00,0x02,0x71,0x03,0x33,0x33,0x31,
-0x00,0x00,0x21,0x8d,0x19,0x02,0xa7,0x08,0x22,0x00,0x23,0xa7,0x08,0x18,0x69,0x82,
-0x00,0x03,0xd8,0x08,0x11,0xe2,0x5e,0x0d,0x10,0x8f,0x96,0x07,0x00,0x82,0x00,0x6e,
-0x22,0x20,0x00,0x00,0x5b,0x00,0x18,0x01,0x41,0xf4,0x44,0x45,0x40,0x1b,0x16,0x15,
-0xfd,0xad,0x1b,0x64,0xed,0xdd,0xdd,0xde,0xed,0x03,0x54,0x06,0x02,0x8b,0x1c,0xa1,
-0x5d,0xff,0xfa,0x10,0x00,0x00,0x4f,0xa3,0x15,0xed,0x41,0x00,0x21,0x06,0xf1,0x96,
-0x0e,0x10,0xbe,0x56,0x02,0x30,0xed,0xfe,0x40,0x97,0x0e,0x23,0x54,0x00,0xcc,0x1d,
-0x60,0x26,0x00,0x00,0x00,0xf6,0x8f,0x63,0x04,0x10,0x8e,0x00,0x13,0x0e,0x05,0x00,
-0x02,0x19,0x00,0x60,0xf7,0x9e,0x11,0x24,0x50,0xf7,0xaa,0x2b,0x50,0xf7,0x02,0x32,
-0x10,0x00,0x39,0x03,0x07,0x05,0x00,0x16,0xd6,0x67,0x1d,0x10,0x38,0xcf,0x0b,0x10,
-0x8f,0x78,0x11,0x10,0x8e,0x0a,0x00,0x01,0x05,0x00,0x12,0x9e,0x05,0x00,0x30,0x12,
-0x40,0xc9,0xf5,0x22,0x60,0xd9,0x04,0x44,0x31,0x00,0xc7,0x0d,0x01,0x20,0x30,0x02,
-0xe6,0x19,0x50,0x02,0xf6,0x11,0x11,0xf8,0x3d,0x04,0x80,0xe8,0x03,0xf5,0x00,0x00,
-0xe7,0x01,0xff,0x5b,0x04,0x13,0x23,0x26,0x13,0x20,0x22,0x38,0x7e,0x04,0x03,0x92,
-0x04,0x04,0x05,0x00,0x11,0x9e,0x05,0x00,0xe1,0x22,0x35,0x60,0xca,0x7f,0xff,0xff,
-0xb0,0xca,0x02,0x22,0x10,0x00,0x64,0xed,0x08,0x01,0xdc,0x08,0x01,0xec,0x08,0x51,
-0x02,0xff,0xff,0xfe,0xf8,0x0f,0x00,0x10,0x01,0x64,0x00,0x05,0xea,0x08,0x01,0x76,
-0x16,0x30,0x52,0x06,0xf0,0x92,0x1d,0x31,0x90,0x6f,0x00,0xed,0x0e,0x11,0xf0,0xb6,
-0x0b,0x03,0x0d,0x00,0x21,0xf1,0x10,0x0d,0x00,0x30,0xff,0xa0,0xf6,0xfa,0x05,0x33,
-0x31,0x0f,0x60,0x1a,0x00,0x40,0x13,0x26,0xf0,0x00,0x47,0x27,0x61,0x6f,0x00,0x00,
-0x14,0x43,0x20,0x1f,0x0d,0x01,0x1a,0x00,0x01,0xbb,0x0f,0x02,0x50,0x2b,0x05,0x22,
-0x08,0x09,0x68,0x00,0x39,0xfe,0xed,0x70,0x68,0x00,0x40,0x5f,0x11,0x00,0xf6,0xbb,
-0x06,0x10,0xf8,0x5b,0x00,0xd1,0x5f,0x44,0x00,0xf9,0x55,0x68,0x35,0xf0,0x00,0x0b,
-0xff,0xec,0xa2,0x9f,0x18,0x01,0x3e,0x0d,0x11,0x47,0x4e,0x00,0x00,0x15,0x1e,0x10,
-0x40,0x8b,0x09,0x01,0x22,0x02,0x33,0xd1,0x11,0x11,0x1b,0x16,0x13,0x20,0x7e,0x06,
-0x03,0xa9,0x48,0xc1,0x68,0x88,0x83,0x05,0xf1,0x00,0x0f,0xdc,0xbb,0x50,0x5f,0x10,
-0x5b,0x00,0x21,0xf1,0x00,0x5b,0x00,0x20,0x99,0x40,0x0d,0x00,0xf1,0x0f,0xfc,0xb5,
-0x0f,0x81,0x23,0x52,0x5f,0x10,0x00,0xef,0xff,0xfe,0x45,0xf1,0x00,0x00,0x22,0x10,
-0x00,0x2c,0x00,0x00,0x04,0x60,0x00,0x01,0x90,0x00,0x00,0x9c,0x68,0x00,0x52,0x09,
-0xd5,0x55,0x58,0xf0,0xbb,0x17,0x01,0xbd,0x08,0x15,0x05,0x0d,0x00,0x14,0x01,0x42,
-0x08,0xe0,0x10,0x03,0x13,0x55,0x65,0x0e,0x60,0xf6,0xef,0xee,0xd2,0xf7,0x0f,0x6f,
-0xc2,0x06,0x50,0xf6,0xf8,0x00,0x00,0xe7,0x0b,0x00,0x40,0x0e,0x92,0xf6,0xf8,0x94,
-0x04,0x00,0x0b,0x00,0x13,0x81,0x16,0x00,0xf0,0x01,0x92,0x35,0x3e,0x70,0xf6,0xdf,
-0xff,0xe6,0xe7,0x0f,0x60,0x11,0x00,0x0e,0x70,0xf6,0x2e,0x0b,0x00,0x94,0x00,0x11,
-0x0e,0xc2,0x06,0x26,0xb5,0x0e,0xe6,0x13,0xc0,0x40,0x47,0x77,0x74,0x00,0xf5,0xef,
-0xee,0xd9,0x01,0xf5,0xe8,0x90,0x06,0x11,0xf8,0x05,0x00,0x00,0xbd,0x06,0x43,0xf8,
-0x00,0x7d,0xdd,0x0f,0x00,0x00,0x51,0x0d,0xc0,0xf9,0x23,0x46,0x40,0xf6,0xcf,0xff,
-0xfe,0x80,0xf6,0x02,0x21,0xc1,0x08,0x04,0x65,0x0d,0x01,0x05,0x00,0x17,0xf4,0x36,
-0x14,0xf0,0x02,0x55,0x55,0x40,0x07,0xe0,0x7f,0xfe,0xed,0x10,0x7f,0x08,0xe0,0x00,
-0x14,0x49,0xf0,0x8e,0x8e,0x07,0x20,0x08,0xe0,0x58,0x08,0x92,0x8f,0x44,0x56,0x70,
-0x7e,0x05,0xff,0xfe,0xd9,0x58,0x09,0x31,0x25,0x00,0x0a,0x33,0x2f,0xa0,0x36,0x66,
-0x55,0xbe,0x00,0x02,0x44,0x44,0x4a,0xe0,0x5b,0x05,0x10,0xfa,0x4b,0x30,0x01,0xe3,
-0x08,0x26,0xff,0xfe,0xd6,0x13,0x10,0x11,0x58,0x00,0x20,0x0a,0xb0,0x58,0x00,0x10,
-0xab,0x4d,0x00,0xf0,0x13,0x0a,0xb0,0x8e,0x00,0x0e,0xff,0xfb,0x08,0xe0,0x00,0x34,
-0x4c,0xb0,0x8e,0x00,0x12,0x20,0xab,0x07,0xff,0xff,0xfa,0x0b,0xb0,0x03,0x43,0x20,
-0x00,0x77,0x00,0x04,0x44,0x44,0x45,0x78,0x1c,0x00,0xc3,0x0c,0x30,0x73,0x00,0x83,
-0xf9,0x00,0x10,0x0e,0xc9,0x16,0x00,0x11,0x0f,0x00,0x0a,0x04,0x30,0x30,0x14,0x44,
-0x7b,0x05,0x00,0xca,0x06,0xf0,0x01,0x13,0x66,0x66,0x06,0xe0,0xe7,0xee,0xdd,0xb0,
-0x7f,0x0f,0x7f,0x80,0x00,0x07,0xf0,0xb4,0x06,0x00,0x0b,0x00,0xa0,0x05,0x6a,0xf0,
-0xf6,0xf8,0x02,0xcd,0xef,0x0f,0x6f,0x16,0x00,0x11,0xf6,0x16,0x00,0xf0,0x02,0x6f,
-0x82,0x35,0x27,0xe0,0xf6,0xdf,0xff,0xf6,0x7e,0x0e,0x60,0x22,0x10,0x07,0xe0,0xe6,
-0xca,0x06,0x11,0x0e,0xca,0x06,0x00,0x8d,0x0c,0x16,0x5a,0x3e,0x15,0xf2,0x20,0x01,
-0x01,0x20,0x44,0x44,0x02,0xf2,0x9c,0x7f,0xff,0xe1,0x2f,0x39,0xc8,0xe0,0x00,0x02,
-0xf3,0x9c,0x8e,0x00,0xae,0xef,0x49,0xc8,0xe0,0x03,0x56,0xf4,0x9c,0x8e,0x00,0x00,
-0x1f,0x49,0xc7,0xfd,0xef,0xa1,0xf4,0x9c,0x05,0x65,0x30,0x0d,0x28,0xb0,0x9b,0x0b,
-0x10,0x7f,0x7e,0x04,0x61,0x02,0x55,0x54,0x44,0xea,0x00,0x8e,0x20,0x01,0x94,0x19,
-0x06,0xe2,0x0e,0x01,0xca,0x12,0x06,0x58,0x00,0x12,0x3f,0x58,0x00,0xb0,0x9d,0x8e,
-0x00,0x25,0x6f,0x39,0xd8,0xe0,0x0b,0xff,0xf3,0x58,0x00,0xe0,0x2f,0x39,0xc8,0xf4,
-0x57,0x52,0xf3,0x9c,0x4f,0xfe,0xc6,0x2f,0x39,0xc0,0x9e,0x10,0x70,0xac,0x00,0x2a,
-0x00,0x2f,0x2a,0xc0,0xa3,0x05,0x11,0x22,0xa2,0x05,0x00,0x65,0x19,0x41,0x11,0x21,
-0x00,0x4f,0xc6,0x06,0x06,0xdf,0x1a,0x00,0x58,0x00,0x10,0xa9,0xb0,0x00,0xf0,0x0e,
-0x3a,0xa8,0xe0,0x00,0x13,0xf3,0xaa,0x8e,0x00,0xcf,0xff,0x3a,0xa8,0xe0,0x01,0x34,
-0xf4,0xaa,0x8e,0x44,0x74,0x1f,0x4a,0xa5,0xff,0xec,0x61,0xf3,0xa9,0xf3,0x02,0xf2,
-0x03,0x03,0x20,0x03,0xde,0xee,0xee,0xf5,0x00,0x16,0x76,0x66,0x5e,0x70,0x00,0x33,
-0x33,0x34,0xe7,0x32,0x0d,0x21,0x04,0xf4,0xdf,0x22,0x10,0xfe,0x58,0x00,0x10,0x45,
-0x82,0x08,0x11,0x13,0x83,0x05,0x12,0x0a,0x55,0x05,0x03,0xd3,0x14,0x09,0xe0,0x14,
-0x11,0xc1,0xe2,0x11,0x12,0x8f,0x4f,0x05,0x31,0x23,0x33,0x21,0x98,0x05,0x15,0xb0,
-0x2c,0x0f,0x7a,0x35,0x55,0x5c,0xd5,0x55,0x65,0x0a,0xd2,0x07,0x11,0xff,0x6f,0x20,
-0x45,0x9f,0x44,0x55,0x42,0xc4,0x05,0x42,0x9f,0x33,0x34,0x44,0x1a,0x00,0x12,0xd2,
-0x6b,0x11,0x00,0x39,0x03,0x43,0xbe,0x44,0x44,0x30,0x4b,0x12,0x03,0x01,0x00,0xbe,
-0xae,0xee,0xee,0xed,0x10,0x00,0x04,0x66,0x55,0x58,0xf3,0xdc,0x14,0x27,0x3f,0x10,
-0x5c,0x23,0x0f,0x68,0x00,0x13,0x1f,0xe0,0x68,0x00,0x04,0xb1,0x03,0xbe,0xfd,0x90,
-0x00,0x00,0x03,0xfc,0x54,0x7e,0xc0,0xac,0x07,0x51,0x6f,0x10,0x00,0x06,0xf5,0xbe,
-0x23,0x50,0x0b,0xfe,0xdf,0xf5,0x00,0x70,0x08,0x05,0xcd,0x1d,0xc1,0x13,0x33,0x34,
-0x00,0x7d,0x0d,0xff,0xff,0xf4,0x07,0xe0,0xe9,0x4e,0x02,0x10,0x90,0x4e,0x02,0x11,
-0xf9,0x0b,0x00,0xa0,0xb3,0x34,0x52,0x07,0xe0,0xbf,0xff,0xfe,0x80,0x7e,0xd6,0x04,
-0x20,0x07,0xf0,0xa4,0x00,0xf5,0x03,0x7f,0x00,0x03,0xf2,0x00,0x07,0xf1,0x54,0x7f,
-0x77,0x96,0x7f,0x4e,0xee,0xed,0xb9,0x47,0xf0,0x06,0x07,0x02,0xb8,0x0b,0x12,0x03,
-0x05,0x05,0xc0,0x28,0x88,0x89,0x40,0x7d,0x07,0xfb,0xbb,0xb5,0x07,0xe0,0x7f,0x21,
-0x00,0x20,0x07,0xf0,0x21,0x00,0xb0,0x7f,0xaa,0xab,0x80,0x7f,0x01,0x8a,0xfa,0x74,
-0x07,0xf0,0x30,0x0d,0xe0,0x7f,0x3a,0xab,0xfd,0xdf,0x87,0xf2,0x88,0x88,0x75,0x30,
-0x7f,0x00,0x02,0x21,0x00,0x00,0x8c,0x0a,0x12,0x4a,0xa4,0x12,0x20,0x02,0xf6,0x89,
-0x07,0x10,0x1f,0xa2,0x03,0x00,0xf0,0x0c,0x02,0x65,0x20,0x00,0x36,0x02,0x90,0x80,
-0xc9,0x07,0xf5,0x55,0x51,0x0c,0xa0,0x7f,0x06,0x06,0xf0,0x06,0x07,0xf0,0x00,0x10,
-0x0c,0xa0,0x6f,0xff,0xff,0xc0,0xca,0x00,0x25,0xf6,0x20,0x0c,0xa0,0x22,0x4f,0x75,
-0x73,0x17,0x06,0x30,0xec,0x4c,0xa0,0x30,0x05,0x10,0x65,0xb7,0x17,0xd0,0x66,0x10,
-0x03,0xfe,0xee,0xdd,0xf7,0x00,0x3f,0x40,0x00,0x0e,0x80,0x58,0x0f,0x72,0xe8,0x00,
-0x2f,0xfe,0xef,0xff,0x60,0x16,0x06,0x30,0x6e,0xee,0xee,0x27,0x07,0x4b,0xf5,0x65,
-0x55,0x30,0x80,0x08,0x42,0x8f,0x21,0x12,0x33,0x70,0x01,0x00,0xe3,0x0d,0x25,0x22,
-0x21,0x80,0x08,0x11,0x7f,0xd0,0x07,0x50,0x10,0x44,0x44,0x7f,0x43,0xc7,0x03,0x12,
-0x05,0xc3,0x01,0x01,0xdd,0x02,0x04,0xf2,0x12,0x26,0x5f,0x10,0x42,0x09,0x14,0x01,
-0xbb,0x05,0x10,0xfc,0xd4,0x08,0x00,0xcb,0x00,0x13,0xae,0x7b,0x1d,0x50,0xee,0xff,
-0x20,0x00,0x04,0x46,0x0d,0x11,0x25,0x82,0x0d,0x01,0x02,0x0a,0x13,0xec,0x80,0x00,
-0x0f,0x42,0x09,0x0f,0x11,0x70,0x42,0x09,0x11,0x10,0xf8,0x04,0x60,0x70,0x4e,0xee,
-0xef,0x70,0x7e,0x1a,0x01,0x30,0x07,0xf0,0x8f,0x9b,0x06,0x30,0x08,0xf0,0x00,0x00,
-0x37,0x82,0x45,0x56,0x50,0x6f,0x04,0xef,0xfe,0xea,0xa5,0x06,0xf1,0x00,0x6f,0x04,
-0x44,0x45,0x79,0x57,0xf5,0xff,0xff,0xec,0xa4,0x7f,0x00,0x03,0xf4,0xd5,0x01,0x25,
-0x40,0x00,0x0b,0x00,0x12,0x30,0xe0,0x01,0x02,0x2c,0x00,0x1f,0x14,0x1a,0x01,0x29,
-0x81,0xcd,0x43,0x6f,0x63,0x20,0x00,0x0a,0xc0,0x3b,0x1e,0x11,0xac,0x1d,0x0f,0x03,
-0x0d,0x00,0x10,0xab,0x1d,0x22,0x04,0x9a,0x09,0x02,0x1a,0x01,0x02,0xd4,0x17,0x11,
-0xad,0x1a,0x01,0x12,0xbd,0xfd,0x0a,0x01,0x1a,0x01,0x10,0x14,0x1a,0x01,0x01,0x9c,
-0x0e,0x11,0x43,0xe2,0x02,0x40,0xeb,0x00,0x09,0xe0,0x81,0x00,0x14,0xdf,0x46,0x12,
-0x20,0x7f,0x30,0x1f,0x00,0x41,0x7f,0x30,0x00,0xef,0x46,0x12,0x02,0xbc,0x0e,0x50,
-0xdf,0xee,0xff,0xff,0x50,0x38,0x01,0x11,0x54,0xeb,0x11,0x21,0x41,0x00,0x8f,0x0d,
-0x14,0x70,0xff,0x12,0x1b,0x09,0x0c,0x13,0x03,0x81,0x00,0x11,0xfd,0x83,0x04,0x1b,
-0x32,0xfa,0x09,0x71,0x9f,0xfe,0xee,0xee,0xef,0xfe,0x02,0xde,0x18,0x1f,0x30,0x9a,
-0x03,0x16,0x01,0x91,0x01,0x02,0x2e,0x0a,0x10,0x9e,0xb8,0x0f,0x1f,0xfd,0x02,0x04,
-0x12,0x12,0x4f,0x2c,0x02,0x20,0xa0,0x00,0x78,0x01,0x85,0xeb,0x00,0x00,0x09,0xf5,
-0x55,0x55,0x20,0xa3,0x0a,0x05,0x0d,0x1e,0x00,0xff,0x07,0x13,0x45,0x96,0x06,0x01,
-0xcb,0x0e,0x00,0x62,0x00,0x22,0xe0,0x25,0x81,0x19,0x27,0x01,0x30,0x55,0x0a,0x22,
-0x09,0xd0,0x75,0x00,0x32,0x22,0x22,0x23,0xb8,0x13,0x15,0xf7,0xb8,0x13,0x02,0x78,
-0x01,0x11,0x7f,0x78,0x01,0x35,0x8f,0x22,0x22,0x67,0x00,0x00,0x0b,0x05,0x62,0x30,
-0x00,0x04,0x45,0x54,0x44,0x92,0x02,0x11,0x43,0x14,0x10,0x16,0xfc,0xbe,0x13,0x10,
-0xfe,0x05,0x17,0x93,0x66,0xaf,0x10,0x00,0x24,0x44,0x45,0x9f,0x10,0x14,0x10,0x03,
-0x78,0x01,0x01,0x26,0x1b,0x5f,0x25,0x55,0x54,0x44,0x00,0x2a,0x01,0x21,0x11,0x9f,
-0x65,0x0b,0x0f,0xc4,0x04,0x1f,0xc0,0x20,0x25,0x44,0x52,0x02,0xf4,0xdf,0xff,0xe9,
-0x02,0xf4,0xe7,0x3b,0x11,0x1f,0xf7,0x05,0x00,0x05,0xd0,0xf8,0x22,0x35,0x32,0xf4,
-0xcf,0xff,0xfe,0x82,0xf4,0x01,0x11,0x00,0x1b,0x0a,0x07,0x05,0x00,0x25,0x01,0xf2,
-0xbb,0x09,0xb0,0x02,0x05,0x55,0x54,0x00,0x7e,0x7f,0xfe,0xed,0x00,0x7f,0xf3,0x02,
-0x09,0x05,0x00,0xb0,0x01,0x20,0x7f,0x7f,0xee,0xff,0xd0,0x7e,0x04,0x54,0x42,0x7c,
-0x12,0x50,0x14,0x31,0x25,0x00,0x09,0xe3,0x00,0x60,0x7f,0x50,0x04,0xea,0x00,0xcc,
-0xa9,0x00,0x10,0xbd,0x97,0x38,0x93,0x4f,0xc6,0x6b,0xf7,0x00,0x03,0xad,0xca,0x40,
-0x89,0x29,0xf4,0x0e,0x55,0x40,0x45,0x40,0xe7,0x00,0x3f,0xfd,0x5f,0xed,0x0e,0x80,
-0x04,0xf3,0x06,0xf1,0x00,0xe8,0x00,0x4f,0x20,0x6f,0x00,0x0e,0x80,0x04,0xf2,0x06,
-0xf0,0x0d,0x00,0x20,0xfd,0x94,0x0d,0x00,0x20,0xdb,0x63,0x0d,0x00,0x12,0x0d,0x1a,
-0x00,0xe8,0xd8,0x00,0x3f,0xfe,0x6f,0xff,0x5d,0x80,0x00,0x23,0x20,0x33,0x20,0xd8,
-0x6d,0x16,0x18,0xd9,0x31,0x17,0x13,0x10,0x48,0x01,0xf2,0x07,0x04,0x52,0x25,0x41,
-0xf2,0x7e,0x0f,0xe9,0xef,0xd2,0xf4,0x7e,0x1f,0x50,0xe7,0x02,0xf4,0x6e,0x1f,0x50,
-0xe7,0x01,0x06,0x00,0x80,0xf7,0x9e,0x1f,0x40,0xf7,0x01,0xff,0xfe,0x06,0x00,0x27,
-0xf4,0x6e,0x06,0x00,0xb1,0x7e,0x0f,0xfb,0xdf,0xf4,0xf4,0x7e,0x01,0x31,0x13,0x21,
-0x61,0x2a,0x13,0x01,0x06,0x00,0x01,0xd3,0x05,0x23,0xe3,0x6e,0x55,0x09,0x40,0x33,
-0x31,0x13,0x33,0x16,0x0b,0x30,0xab,0xff,0xf5,0x1e,0x04,0x11,0xcb,0xf4,0x05,0x21,
-0x0c,0xa0,0xf5,0x05,0x10,0xca,0x0d,0x00,0x40,0x11,0x0c,0xb1,0x10,0x83,0x3a,0x96,
-0x9f,0xff,0x90,0x00,0x02,0x32,0x12,0x33,0x20,0x6a,0x03,0x14,0xad,0x4a,0x07,0x20,
-0x55,0x0b,0xea,0x19,0xe0,0xff,0xe0,0x00,0xdf,0xfc,0x7e,0xee,0x50,0x00,0x0f,0x95,
-0x29,0xe4,0x41,0xcb,0x09,0x11,0x9d,0x18,0x27,0x01,0xae,0x02,0x40,0xf7,0x11,0x9e,
-0x11,0x26,0x18,0x30,0xe7,0xff,0xf9,0xaa,0x1d,0x2a,0x02,0x21,0x3b,0x17,0x60,0x01,
-0x44,0x44,0x9f,0x33,0x33,0xb9,0x23,0x0f,0x23,0x1a,0x06,0x04,0xc5,0x20,0x00,0xb4,
-0x0a,0xf0,0x03,0x65,0x04,0x55,0x05,0xf0,0x0e,0xfe,0x4f,0xee,0x46,0xf0,0x0e,0x80,
-0x1f,0x50,0x05,0xf0,0x0f,0x06,0x00,0xd2,0xf1,0x0e,0xb6,0x3f,0xa6,0x25,0xf1,0x09,
-0xdd,0x5b,0xdd,0x55,0xf0,0x72,0x0b,0xc0,0x05,0x55,0x56,0x79,0x95,0xf0,0x3d,0xee,
-0xfe,0xca,0x65,0xf0,0xac,0x0b,0x00,0x02,0x0b,0x1a,0xf6,0x06,0x00,0x10,0xf1,0x6b,
-0x0a,0x21,0x05,0xf1,0x6e,0x01,0x13,0x50,0xe2,0x0b,0x50,0x45,0x55,0x50,0x06,0xf0,
-0x7c,0x08,0x21,0x30,0x6f,0x49,0x02,0x21,0x06,0xf1,0x68,0x1b,0x50,0x6f,0x10,0x00,
-0x22,0x25,0x0d,0x00,0x10,0x2f,0x1a,0x00,0x80,0xff,0x94,0xf5,0x22,0x10,0x06,0xf4,
-0x41,0x9e,0x17,0x10,0x6f,0xab,0x17,0x10,0x03,0x34,0x00,0x9a,0xee,0xff,0xf5,0x6f,
-0x00,0x00,0x75,0x54,0x31,0x4a,0x0c,0x1e,0xf1,0x4a,0x0c,0x10,0x00,0x68,0x00,0x91,
-0x92,0x05,0xe0,0x00,0x1d,0xff,0xef,0x70,0x6f,0x3c,0x1b,0xf0,0x0c,0x05,0xf1,0x00,
-0x07,0x88,0x8f,0x70,0x5f,0x00,0x02,0xfb,0xa9,0x93,0x05,0xff,0xf7,0x2f,0x40,0x00,
-0x00,0x5f,0x66,0x12,0xf7,0x44,0x69,0x35,0xe7,0x22,0x44,0xed,0xb3,0x5f,0x10,0x8a,
-0x06,0x14,0x35,0x4a,0x0c,0x25,0x02,0x90,0xf6,0x08,0x14,0xd1,0x75,0x05,0x0b,0x4a,
-0x0c,0xc9,0x01,0xee,0xef,0xf5,0x05,0xf1,0x00,0x05,0x66,0x6f,0x70,0x5f,0x68,0x00,
-0xf5,0x0b,0x76,0x32,0xfd,0xbb,0xb3,0x05,0xfe,0xe8,0x2f,0x40,0x00,0x21,0x5f,0x10,
-0x01,0xfe,0xee,0xff,0x65,0xf1,0x00,0x04,0x65,0x43,0x10,0x3d,0x29,0x05,0xb1,0x7e,
-0xee,0xef,0xfe,0x10,0x00,0x0a,0xe6,0x65,0x59,0xf2,0xf2,0x01,0x20,0x4f,0x20,0x75,
-0x00,0x24,0x05,0xf2,0x12,0x24,0x15,0x01,0x8c,0x14,0x1f,0x15,0x68,0x00,0x20,0x11,
-0x4f,0xcf,0x28,0xf1,0x00,0x10,0x10,0x00,0x00,0x06,0xef,0xff,0xc2,0x00,0x00,0x04,
-0xf9,0x21,0x3d,0xd0,0x18,0x04,0x14,0x5f,0x18,0x04,0x00,0x71,0x1d,0x11,0xe4,0x18,
-0x04,0x13,0x30,0x3e,0x01,0xf5,0x01,0x14,0x06,0x77,0x75,0x06,0xe0,0x7e,0x0c,0xdd,
-0xee,0x07,0xe0,0x7e,0x00,0x00,0x8e,0x06,0x00,0xf0,0x02,0x02,0x44,0xae,0x07,0xe3,
-0x9e,0x0f,0xff,0xfd,0x07,0xff,0xfe,0x0f,0x81,0x00,0x07,0xe0,0x0e,0x12,0x02,0x06,
-0x00,0xf1,0x00,0x06,0xe0,0x7e,0x0f,0xed,0xef,0x96,0xe0,0x7e,0x04,0x66,0x53,0x06,
-0xe0,0x7e,0xdd,0x0d,0x11,0x7e,0x63,0x02,0x10,0x7e,0x23,0x01,0x26,0xb0,0x6e,0xc6,
-0x16,0xa0,0x02,0x0b,0xee,0xfc,0x0e,0x60,0xf6,0x46,0x6b,0xe0,0xdb,0x0c,0xe0,0x8e,
-0x0e,0x70,0xf6,0x35,0x6b,0xe0,0xeb,0x8f,0x6e,0xfe,0xeb,0x0d,0xec,0x8f,0x12,0xe0,
-0xd8,0x0f,0x6e,0xb6,0x7a,0x6d,0x80,0xf6,0x8d,0xdc,0xa3,0xd7,0x0f,0x60,0x08,0x04,
-0x11,0x30,0xc6,0x02,0x52,0x20,0x02,0x55,0x54,0x46,0xdc,0x17,0x14,0x40,0x7f,0x04,
-0x02,0x0b,0x00,0x26,0x00,0x70,0x20,0x01,0x21,0x06,0xf0,0x20,0x01,0x30,0x6f,0x65,
-0x10,0x20,0x01,0x50,0xfd,0xc4,0x1e,0xff,0xff,0xf0,0x01,0x61,0xf8,0x44,0x40,0x05,
-0xf2,0x10,0x20,0x01,0x20,0xff,0x61,0x20,0x01,0x20,0xf3,0x20,0x20,0x01,0x11,0x5f,
-0x2b,0x0f,0x2f,0x11,0x60,0x20,0x01,0x19,0xf0,0x03,0x00,0x20,0x35,0x55,0x51,0x00,
-0x6e,0x0d,0xff,0xef,0x50,0x07,0xe0,0x00,0x01,0xf6,0x00,0x7e,0x30,0x23,0xf0,0x05,
-0x07,0xe0,0x12,0x23,0xf6,0x47,0xbe,0x0d,0xff,0xff,0x58,0xce,0xe0,0xe9,0x22,0x10,
-0x00,0x7e,0x0e,0x80,0x7f,0x12,0x10,0xe8,0xa4,0x02,0xb6,0x0e,0xdb,0xbc,0xe9,0x06,
-0xf0,0x48,0x88,0x75,0x10,0x6f,0xf8,0x0e,0x18,0x6e,0x84,0x17,0x01,0x1c,0x28,0x90,
-0xbf,0xff,0xf4,0x00,0xc9,0x03,0x55,0x5f,0x60,0xad,0x04,0xe0,0xf6,0x12,0xd9,0x0b,
-0xee,0xef,0x6d,0xff,0x90,0xeb,0x65,0x50,0x02,0xd9,0x4d,0x00,0xd0,0x0c,0x90,0xeb,
-0x66,0x8a,0x70,0xd9,0x08,0xdd,0xcb,0x94,0x0d,0x90,0xa4,0x0b,0x12,0x83,0x0a,0x29,
-0x00,0x7d,0x23,0x40,0xf8,0x00,0x0f,0x70,0x33,0x18,0x01,0x30,0x23,0x19,0x0e,0x30,
-0x23,0x20,0x03,0x40,0x58,0x00,0x10,0xbb,0x58,0x00,0x00,0x98,0x20,0xf0,0x15,0xf6,
-0x23,0xbb,0x0b,0xff,0xff,0x6d,0xff,0xb0,0xeb,0x55,0x40,0x01,0xbb,0x0e,0x80,0x00,
-0x21,0x0b,0xb0,0xdf,0xef,0xff,0xa0,0xbb,0x02,0x55,0x43,0x10,0x07,0x70,0x00,0x92,
-0x00,0x00,0x64,0x08,0x0f,0x70,0x0c,0x90,0x00,0xf9,0x55,0x55,0xd9,0x63,0x00,0x20,
-0xef,0x90,0x38,0x0e,0x11,0xc9,0x6e,0x00,0x10,0x80,0x39,0x08,0x12,0x30,0x58,0x21,
-0xb0,0x05,0x55,0x51,0x05,0xf0,0xe7,0x1e,0xfe,0xf7,0x06,0xf0,0x78,0x00,0x14,0x05,
+0x0b,0x00,0x32,0x4a,0x0d,0x60,0x4d,0x01,0x18,0x13,0xf7,0x03,0x19,0x8e,0xfa,0x06,
+0x02,0x0d,0x00,0x11,0xe2,0x76,0x03,0x11,0x7f,0x19,0x03,0x41,0x00,0x22,0x44,0x21,
+0xb7,0x0c,0x15,0xa0,0x4d,0x07,0xc2,0x35,0x55,0x6d,0xc6,0x66,0x65,0x0b,0xff,0xee,
+0xee,0xff,0xff,0x38,0x00,0x05,0xc6,0x02,0x18,0x8f,0x5b,0x00,0x40,0x8f,0x44,0x44,
+0x54,0x5c,0x02,0x00,0x8f,0x02,0x01,0x15,0x00,0x00,0xe6,0x06,0x50,0xbe,0x54,0x45,
+0x30,0x9f,0x1e,0x08,0x18,0xed,0x2d,0x08,0x70,0x40,0x00,0x02,0x56,0x44,0x56,0x30,
+0x48,0x00,0x01,0x4a,0x00,0x10,0x6f,0xd5,0x08,0x00,0x89,0x03,0xbf,0xff,0xb0,0x00,
+0x03,0x44,0x44,0x43,0x31,0x00,0x00,0x38,0xba,0x04,0x06,0x40,0x9e,0x22,0x22,0x33,
+0x78,0x03,0x01,0x01,0x07,0x14,0x02,0xe4,0x09,0x02,0xb5,0x07,0x00,0x35,0x07,0x6e,
+0x44,0x44,0xaf,0x44,0x33,0x20,0x3c,0x00,0x06,0x0d,0x00,0x11,0x00,0x3e,0x04,0x17,
+0x02,0x4e,0x09,0x17,0x8f,0x06,0x00,0x50,0x7f,0xfe,0xef,0xfe,0x00,0xb7,0x06,0x15,
+0x53,0xea,0x07,0x43,0xef,0xfe,0xed,0xdb,0x51,0x0b,0x10,0xcf,0x9d,0x04,0x00,0x22,
+0x04,0x20,0x8f,0x20,0x5f,0x04,0x21,0x8f,0x20,0xea,0x07,0x1e,0x00,0xea,0x07,0x0f,
+0xc2,0x00,0x29,0xa1,0xdc,0x43,0x7f,0x43,0x20,0x00,0x0c,0xb0,0x05,0xf2,0x52,0x0a,
+0x20,0x5f,0x20,0x42,0x05,0x01,0x73,0x0a,0x10,0xb9,0xf0,0x07,0x31,0x00,0x01,0x10,
+0xc3,0x00,0x1e,0x13,0x62,0x00,0x0c,0xda,0x01,0x21,0x23,0x40,0xda,0x01,0x10,0xff,
+0xda,0x01,0x2a,0x22,0x21,0xf4,0x05,0x03,0xf7,0x0d,0x34,0x03,0x55,0x55,0x31,0x04,
+0x00,0xee,0x0b,0x18,0xe0,0x65,0x0a,0x12,0xf0,0x97,0x00,0x31,0x11,0x11,0x21,0xda,
+0x01,0x00,0x00,0x02,0x80,0x03,0x33,0x33,0x31,0x00,0x00,0x21,0x11,0x2b,0x0d,0x02,
+0xa7,0x08,0x22,0x00,0x23,0xa7,0x08,0x18,0x69,0x82,0x00,0x03,0xd8,0x08,0x11,0xe2,
+0x5e,0x0d,0x10,0x8f,0x96,0x07,0x00,0x82,0x00,0x6e,0x22,0x20,0x00,0x00,0x5b,0x00,
+0x18,0x01,0x40,0xf4,0x44,0x45,0x40,0x34,0x06,0x24,0xff,0xfd,0x9c,0x00,0x74,0x8e,
+0xed,0xdd,0xdd,0xde,0xed,0x03,0x54,0x06,0x11,0x01,0x24,0x01,0xa1,0x5d,0xff,0xfa,
+0x10,0x00,0x00,0x4f,0xa3,0x15,0xed,0x41,0x00,0x21,0x06,0xf1,0x96,0x0e,0x10,0xbe,
+0x56,0x02,0x30,0xed,0xfe,0x40,0x97,0x0e,0x13,0x54,0x3f,0x00,0x70,0x30,0x26,0x00,
+0x00,0x00,0xf6,0x8f,0x63,0x04,0x00,0x63,0x00,0x1e,0xf8,0x05,0x00,0x02,0x19,0x00,
+0xe0,0xf7,0x9e,0x11,0x24,0x50,0xf7,0x7f,0xff,0xff,0xa0,0xf7,0x02,0x32,0x10,0x24,
+0x0e,0x17,0x00,0x05,0x00,0x60,0xd6,0x00,0x00,0x00,0x00,0x00,0xf0,0x01,0x00,0x00,
+0x00,0x00,0x11,0x38,0x00,0x00,0x00,0xc9,0x8f,0x00,0x00,0x00,0xd9,0x8e,0x0a,0x00,
+0x01,0x05,0x00,0x12,0x9e,0x05,0x00,0xf0,0x21,0x12,0x40,0xc9,0x8f,0xff,0xff,0xd0,
+0xd9,0x04,0x44,0x31,0x00,0xc7,0x00,0x23,0x33,0x33,0x30,0x02,0xff,0xff,0xff,0xf7,
+0x02,0xf6,0x11,0x11,0xf8,0x02,0xf5,0x00,0x00,0xe8,0x03,0xf5,0x00,0x00,0xe7,0x01,
+0xff,0xff,0xff,0xf6,0x00,0x23,0x44,0x43,0x20,0x50,0x00,0x10,0x22,0x50,0x00,0x10,
+0xba,0x50,0x00,0x25,0xca,0x8e,0x05,0x00,0x11,0x9e,0x05,0x00,0xf1,0x13,0x22,0x35,
+0x60,0xca,0x7f,0xff,0xff,0xb0,0xca,0x02,0x22,0x10,0x00,0x64,0x00,0x91,0x00,0x00,
+0x74,0x02,0xf4,0x00,0x00,0xd8,0x02,0xf8,0x55,0x55,0xe8,0x02,0xff,0xff,0xfe,0xf8,
+0x0f,0x00,0x10,0x01,0x64,0x00,0x50,0x00,0x34,0x44,0x44,0x30,0x50,0x00,0xf0,0x04,
+0x02,0x00,0x00,0x35,0x55,0x52,0x06,0xf0,0x00,0x0f,0xff,0xfe,0x90,0x6f,0x00,0x00,
+0xf7,0x00,0x00,0x0d,0x00,0x33,0x70,0x00,0x00,0x0d,0x00,0x21,0xf1,0x10,0x0d,0x00,
+0xa3,0xff,0xa0,0xf6,0x00,0x00,0x06,0xf4,0x31,0x0f,0x60,0x1a,0x00,0x20,0x13,0x26,
+0x34,0x00,0xb0,0xff,0xf9,0x6f,0x00,0x00,0x14,0x43,0x20,0x06,0xf0,0x00,0x01,0x00,
+0x11,0x6f,0x06,0x00,0x03,0x0d,0x00,0x21,0x5f,0x00,0x01,0x00,0x2a,0x10,0x00,0x68,
+0x00,0x39,0xfe,0xed,0x70,0x68,0x00,0x90,0x5f,0x11,0x00,0xf6,0x00,0x00,0x05,0xff,
+0xf8,0x5b,0x00,0xe1,0x5f,0x44,0x00,0xf9,0x55,0x68,0x35,0xf0,0x00,0x0b,0xff,0xec,
+0xa2,0x5f,0x3b,0x00,0x51,0x05,0xf0,0x00,0x00,0x47,0x4e,0x00,0x81,0x0a,0xd0,0x00,
+0x00,0x40,0x00,0x00,0xad,0x51,0x00,0xf1,0x03,0x0a,0xd1,0x11,0x11,0x10,0x00,0x00,
+0x8f,0xff,0xff,0xff,0x20,0x00,0x00,0x33,0x33,0x33,0x20,0x17,0x00,0xf1,0x00,0x04,
+0x00,0x00,0x68,0x88,0x83,0x05,0xf1,0x00,0x0f,0xdc,0xbb,0x50,0x5f,0x10,0x5b,0x00,
+0x21,0xf1,0x00,0x5b,0x00,0x20,0x99,0x40,0x0d,0x00,0xf1,0x0f,0xfc,0xb5,0x0f,0x81,
+0x23,0x52,0x5f,0x10,0x00,0xef,0xff,0xfe,0x45,0xf1,0x00,0x00,0x22,0x10,0x00,0x2c,
+0x00,0x00,0x04,0x60,0x00,0x01,0x90,0x00,0x00,0x9c,0x68,0x00,0xf5,0x02,0x09,0xd5,
+0x55,0x58,0xf0,0x00,0x00,0x9f,0xff,0xff,0xff,0x00,0x00,0x09,0xc0,0x00,0x05,0x0d,
+0x00,0x51,0x01,0x44,0x44,0x44,0x20,0xd5,0x00,0xf0,0x07,0x03,0x13,0x55,0x65,0x0e,
+0x60,0xf6,0xef,0xee,0xd2,0xf7,0x0f,0x6f,0x80,0x00,0x0f,0x70,0xf6,0xf8,0x00,0x00,
+0xe7,0x0b,0x00,0x20,0x0e,0x92,0x0b,0x00,0x20,0xef,0xff,0x0b,0x00,0x13,0x81,0x16,
+0x00,0xf0,0x05,0x92,0x35,0x3e,0x70,0xf6,0xdf,0xff,0xe6,0xe7,0x0f,0x60,0x11,0x00,
+0x0e,0x70,0xf6,0x00,0x00,0x00,0xe7,0x94,0x00,0xa4,0x0e,0x70,0xf7,0x00,0x00,0x00,
+0xb5,0x0e,0x60,0x00,0x01,0x00,0xf2,0x02,0x40,0x47,0x77,0x74,0x00,0xf5,0xef,0xee,
+0xd9,0x01,0xf5,0xe8,0x00,0x00,0x01,0xf5,0xf8,0x05,0x00,0x74,0x37,0x78,0xf5,0xf8,
+0x00,0x7d,0xdd,0x0f,0x00,0xf0,0x04,0x00,0x00,0xf5,0xf9,0x23,0x46,0x40,0xf6,0xcf,
+0xff,0xfe,0x80,0xf6,0x02,0x21,0x00,0x00,0xf6,0x00,0x14,0x00,0x05,0x05,0x00,0x15,
+0xf4,0x50,0x00,0xf0,0x19,0x02,0x00,0x55,0x55,0x40,0x07,0xe0,0x7f,0xfe,0xed,0x10,
+0x7f,0x08,0xe0,0x00,0x14,0x49,0xf0,0x8e,0x00,0x09,0xff,0xff,0x08,0xe0,0x00,0x00,
+0x07,0xf0,0x8f,0x44,0x56,0x70,0x7e,0x05,0xff,0xfe,0xd9,0x07,0xe0,0x2c,0x00,0xf0,
+0x0b,0x25,0x00,0x0a,0xff,0xff,0xff,0xc0,0x00,0x36,0x66,0x55,0xbe,0x00,0x02,0x44,
+0x44,0x4a,0xe0,0x00,0xef,0xff,0xff,0xfa,0x00,0x0f,0xa0,0x1e,0x00,0xa1,0xef,0xee,
+0xff,0xfe,0x00,0x02,0x55,0x55,0x54,0x30,0xd8,0x02,0x00,0x58,0x00,0x20,0x0a,0xb0,
+0x58,0x00,0x10,0xab,0x4d,0x00,0xf0,0x1e,0x0a,0xb0,0x8e,0x00,0x0e,0xff,0xfb,0x08,
+0xe0,0x00,0x34,0x4c,0xb0,0x8e,0x00,0x12,0x20,0xab,0x07,0xff,0xff,0xfa,0x0b,0xb0,
+0x03,0x43,0x20,0x00,0x77,0x00,0x04,0x44,0x44,0x45,0x30,0x03,0xff,0xff,0xff,0xfb,
+0x00,0x00,0x73,0x00,0x83,0xf9,0x00,0xf1,0x02,0x0e,0x70,0x00,0x00,0xe7,0x00,0xe7,
+0x00,0x05,0xff,0xff,0xff,0xff,0x30,0x14,0x44,0x44,0xc1,0x01,0xf0,0x07,0x01,0x04,
+0x13,0x66,0x66,0x06,0xe0,0xe7,0xee,0xdd,0xb0,0x7f,0x0f,0x7f,0x80,0x00,0x07,0xf0,
+0xf7,0xf8,0x00,0x00,0x0b,0x00,0xa0,0x05,0x6a,0xf0,0xf6,0xf8,0x02,0xcd,0xef,0x0f,
+0x6f,0x16,0x00,0x11,0xf6,0x16,0x00,0xf0,0x06,0x6f,0x82,0x35,0x27,0xe0,0xf6,0xdf,
+0xff,0xf6,0x7e,0x0e,0x60,0x22,0x10,0x07,0xe0,0xe6,0x00,0x00,0x00,0x7e,0x59,0x00,
+0x85,0x07,0xe0,0xe7,0x00,0x00,0x00,0x5a,0x0d,0x58,0x01,0xf1,0x20,0x01,0x01,0x20,
+0x44,0x44,0x02,0xf2,0x9c,0x7f,0xff,0xe1,0x2f,0x39,0xc8,0xe0,0x00,0x02,0xf3,0x9c,
+0x8e,0x00,0xae,0xef,0x49,0xc8,0xe0,0x03,0x56,0xf4,0x9c,0x8e,0x00,0x00,0x1f,0x49,
+0xc7,0xfd,0xef,0xa1,0xf4,0x9c,0x05,0x65,0x30,0x0d,0x28,0xb0,0x33,0x00,0xb0,0x00,
+0x7f,0xff,0xff,0xff,0x70,0x02,0x55,0x54,0x44,0xea,0x10,0x00,0x11,0x0d,0x06,0x01,
+0x11,0xda,0x0b,0x00,0x10,0x90,0x06,0x00,0x11,0x53,0x26,0x00,0x05,0x58,0x00,0x12,
+0x3f,0x58,0x00,0xb0,0x9d,0x8e,0x00,0x25,0x6f,0x39,0xd8,0xe0,0x0b,0xff,0xf3,0x58,
+0x00,0xf0,0x12,0x2f,0x39,0xc8,0xf4,0x57,0x52,0xf3,0x9c,0x4f,0xfe,0xc6,0x2f,0x39,
+0xc0,0x00,0x00,0x02,0xf3,0xac,0x00,0x2a,0x00,0x2f,0x2a,0xc0,0x05,0xf2,0x00,0x00,
+0x22,0x00,0x5f,0x20,0xe2,0x02,0xe2,0xf2,0x00,0x11,0x21,0x00,0x4f,0xff,0xff,0xff,
+0xb0,0x00,0x23,0x33,0x32,0xc9,0x02,0x10,0x00,0x58,0x00,0x10,0xa9,0xb0,0x00,0xf0,
+0x0e,0x3a,0xa8,0xe0,0x00,0x13,0xf3,0xaa,0x8e,0x00,0xcf,0xff,0x3a,0xa8,0xe0,0x01,
+0x34,0xf4,0xaa,0x8e,0x44,0x74,0x1f,0x4a,0xa5,0xff,0xec,0x61,0xf3,0xa9,0xf3,0x02,
+0xf1,0x0a,0x03,0x20,0x03,0xde,0xee,0xee,0xf5,0x00,0x16,0x76,0x66,0x5e,0x70,0x00,
+0x33,0x33,0x34,0xe7,0x00,0x3f,0xff,0xff,0xff,0x40,0x04,0x07,0x02,0x20,0x3f,0xfe,
+0x58,0x00,0xa1,0x45,0x55,0x55,0x42,0x00,0x13,0x33,0x33,0x31,0x00,0xe5,0x01,0x41,
+0x70,0x00,0x00,0xbc,0x66,0x00,0x21,0x0b,0xc0,0x07,0x00,0x03,0x0d,0x00,0x41,0xc1,
+0x11,0x11,0x00,0x54,0x03,0x70,0xfd,0x00,0x00,0x00,0x23,0x33,0x21,0x15,0x00,0x21,
+0x09,0xb0,0x1c,0x00,0x20,0xac,0x00,0xc2,0x03,0xb3,0x5c,0xd5,0x55,0x65,0x0a,0xff,
+0xee,0xee,0xff,0xff,0xe0,0x5a,0x01,0x11,0x06,0xb7,0x00,0x82,0x00,0x9f,0x44,0x55,
+0x42,0x00,0x00,0x09,0x16,0x00,0x42,0x9f,0x33,0x34,0x44,0x1a,0x00,0x10,0xd2,0x41,
+0x00,0x11,0xd0,0x39,0x03,0x50,0xbe,0x44,0x44,0x30,0xaf,0xed,0x01,0x14,0xfe,0x95,
+0x01,0xb1,0xae,0xee,0xee,0xed,0x10,0x00,0x04,0x66,0x55,0x58,0xf3,0x10,0x00,0x21,
+0x4f,0x20,0xc2,0x03,0x21,0xf2,0x00,0xb7,0x00,0x02,0x38,0x04,0x2f,0x30,0x00,0x68,
+0x00,0x17,0x1f,0xe0,0x68,0x00,0x04,0xf0,0x0f,0x03,0xbe,0xfd,0x90,0x00,0x00,0x03,
+0xfc,0x54,0x7e,0xc0,0x00,0x00,0x8f,0x00,0x00,0x6f,0x10,0x00,0x06,0xf5,0x00,0x0b,
+0xf0,0x00,0x00,0x0b,0xfe,0xdf,0xf5,0x25,0x03,0x24,0x55,0x40,0x2c,0x00,0xc1,0x13,
+0x33,0x34,0x00,0x7d,0x0d,0xff,0xff,0xf4,0x07,0xe0,0xe9,0x4e,0x02,0x10,0x90,0x4e,
+0x02,0x11,0xf9,0x0b,0x00,0xa0,0xb3,0x34,0x52,0x07,0xe0,0xbf,0xff,0xfe,0x80,0x7e,
+0xd6,0x04,0x20,0x07,0xf0,0xa4,0x00,0xf1,0x02,0x7f,0x00,0x03,0xf2,0x00,0x07,0xf1,
+0x54,0x7f,0x77,0x96,0x7f,0x4e,0xee,0xed,0xb9,0x47,0xfc,0x04,0x30,0x7f,0x00,0x00,
+0x60,0x03,0x01,0x7d,0x00,0x02,0x05,0x05,0xc0,0x28,0x88,0x89,0x40,0x7d,0x07,0xfb,
+0xbb,0xb5,0x07,0xe0,0x7f,0x21,0x00,0x20,0x07,0xf0,0x21,0x00,0x90,0x7f,0xaa,0xab,
+0x80,0x7f,0x01,0x8a,0xfa,0x74,0x4d,0x00,0xe0,0x30,0x00,0x7f,0x3a,0xab,0xfd,0xdf,
+0x87,0xf2,0x88,0x88,0x75,0x30,0x7f,0x32,0x05,0xa0,0x07,0xf0,0x01,0xf4,0x00,0x00,
+0x4a,0x00,0x2f,0x50,0xa5,0x00,0x61,0xf6,0x22,0x22,0x21,0x00,0x1f,0xa2,0x03,0x41,
+0x12,0x22,0x22,0x20,0xa4,0x02,0x00,0x36,0x02,0x90,0x80,0xc9,0x07,0xf5,0x55,0x51,
+0x0c,0xa0,0x7f,0x06,0x06,0xf0,0x06,0x07,0xf0,0x00,0x10,0x0c,0xa0,0x6f,0xff,0xff,
+0xc0,0xca,0x00,0x25,0xf6,0x20,0x0c,0xa0,0x22,0x4f,0x75,0x73,0x17,0x06,0x30,0xec,
+0x4c,0xa0,0x30,0x05,0xf2,0x0e,0x65,0x00,0x06,0x66,0x66,0x66,0x10,0x03,0xfe,0xee,
+0xdd,0xf7,0x00,0x3f,0x40,0x00,0x0e,0x80,0x03,0xf4,0x00,0x00,0xe8,0x00,0x2f,0xfe,
+0xef,0xff,0x60,0x16,0x06,0xe1,0x6e,0xee,0xee,0xed,0x00,0x00,0x08,0xf5,0x65,0x55,
+0x30,0x00,0x00,0x8e,0xbf,0x00,0x12,0x08,0x70,0x01,0x42,0x8f,0x21,0x12,0x33,0x70,
+0x01,0x74,0xf4,0x00,0x00,0x01,0x22,0x21,0x10,0x36,0x01,0x20,0x7f,0xff,0x01,0x00,
+0x50,0x10,0x44,0x44,0x7f,0x43,0xc7,0x03,0x12,0x05,0xc3,0x01,0x01,0xdd,0x02,0x00,
+0x7f,0x05,0x01,0x0d,0x00,0x02,0x2d,0x00,0x02,0xb7,0x00,0x04,0xbb,0x05,0x41,0xfc,
+0x00,0x00,0x9e,0xcb,0x00,0x12,0xae,0xd0,0x01,0xf0,0x02,0xee,0xee,0xff,0x20,0x00,
+0x04,0x55,0x55,0x43,0x00,0x25,0x44,0x44,0x44,0x44,0x53,0x9f,0xc7,0x01,0x13,0xec,
+0x80,0x00,0x10,0xcf,0x63,0x00,0xe1,0x00,0x25,0x55,0x55,0x8f,0x20,0x00,0x24,0x44,
+0x44,0x8f,0x20,0x00,0xdf,0xe5,0x01,0x11,0xda,0x3c,0x00,0x20,0xcf,0xee,0xd6,0x02,
+0x51,0x15,0x55,0x55,0x54,0x10,0xf8,0x04,0x60,0x70,0x4e,0xee,0xef,0x70,0x7e,0x1a,
+0x01,0x30,0x07,0xf0,0x8f,0x9b,0x06,0x20,0x08,0xf0,0x73,0x06,0x92,0x7f,0x45,0x56,
+0x50,0x6f,0x04,0xef,0xfe,0xea,0xa5,0x06,0xf1,0x00,0x6f,0x04,0x44,0x45,0x79,0x57,
+0xf5,0xff,0xff,0xec,0xa4,0x7f,0x00,0x03,0xf4,0xd5,0x01,0x25,0x40,0x00,0x0b,0x00,
+0x12,0x30,0xe0,0x01,0x02,0x2c,0x00,0x1f,0x14,0x1a,0x01,0x29,0xa0,0xcd,0x43,0x6f,
+0x63,0x20,0x00,0x0a,0xc0,0x03,0xf3,0x4c,0x03,0x00,0x5a,0x00,0x04,0x0d,0x00,0xa5,
+0xab,0x00,0x3f,0x20,0x00,0x00,0x01,0x10,0x00,0x20,0x1a,0x01,0x11,0x9f,0x1a,0x01,
+0x11,0xad,0x1a,0x01,0x11,0xbd,0x47,0x00,0x11,0xaf,0x1a,0x01,0x10,0x14,0x1a,0x01,
+0x10,0x24,0x1a,0x01,0x11,0x43,0xe2,0x02,0x40,0xeb,0x00,0x09,0xe0,0x81,0x00,0x11,
+0xdf,0x05,0x07,0x50,0x35,0x55,0x55,0x7f,0x30,0x1f,0x00,0x20,0x7f,0x30,0xb8,0x05,
+0x41,0xfe,0x10,0x00,0xea,0x3c,0x00,0x50,0xdf,0xee,0xff,0xff,0x50,0x38,0x01,0xa2,
+0x54,0x00,0x00,0x14,0x44,0x44,0x41,0x00,0x00,0x09,0x02,0x04,0x00,0xd3,0x03,0x01,
+0xe1,0x06,0x04,0xe0,0x03,0x00,0x94,0x00,0x13,0x00,0x81,0x00,0x11,0xfd,0x83,0x04,
+0x2a,0x32,0x00,0x01,0x00,0xdf,0x9f,0xfe,0xee,0xee,0xef,0xfe,0x02,0x66,0x66,0x66,
+0x66,0x65,0x30,0x9a,0x03,0x16,0x11,0x00,0x64,0x03,0x00,0x01,0x00,0x7f,0x40,0x9e,
+0xee,0xee,0xee,0xee,0xfd,0x02,0x04,0x12,0x12,0x4f,0x2c,0x02,0x20,0xa0,0x00,0x78,
+0x01,0xb2,0xeb,0x00,0x00,0x09,0xf5,0x55,0x55,0x20,0x00,0x00,0x9e,0xb6,0x00,0x03,
+0x78,0x01,0x01,0x18,0x01,0x23,0x00,0x45,0x96,0x06,0x00,0x19,0x00,0x10,0xfe,0x62,
+0x00,0x21,0xe0,0x25,0xa3,0x00,0x22,0x00,0x01,0x17,0x00,0x12,0x9d,0x1b,0x00,0x12,
+0xd0,0x75,0x00,0x61,0x22,0x22,0x23,0x00,0x00,0x08,0x07,0x09,0x55,0x00,0x02,0x22,
+0x22,0x22,0x78,0x01,0x11,0x7f,0x78,0x01,0x35,0x8f,0x22,0x22,0x67,0x00,0x00,0x0b,
+0x05,0x62,0x30,0x00,0x04,0x45,0x54,0x44,0x92,0x02,0x41,0x43,0xbf,0xff,0xff,0x25,
+0x00,0x02,0x74,0x02,0x01,0x80,0x02,0xa0,0x46,0x66,0x66,0xaf,0x10,0x00,0x24,0x44,
+0x45,0x9f,0x55,0x08,0x00,0x39,0x01,0x02,0x78,0x01,0x00,0x96,0x01,0x7f,0x60,0x00,
+0x25,0x55,0x54,0x44,0x00,0x2a,0x01,0x21,0x10,0x9f,0x6a,0x00,0x1f,0xfd,0xc4,0x04,
+0x1f,0xff,0x02,0x20,0x25,0x44,0x52,0x02,0xf4,0xdf,0xff,0xe9,0x02,0xf4,0xe7,0x00,
+0x00,0x02,0xf4,0xf7,0x05,0x00,0x05,0xd0,0xf8,0x22,0x35,0x32,0xf4,0xcf,0xff,0xfe,
+0x82,0xf4,0x01,0x11,0x00,0x1b,0x0a,0x07,0x05,0x00,0x25,0x01,0xf2,0xbb,0x09,0xb0,
+0x02,0x05,0x55,0x54,0x00,0x7e,0x7f,0xfe,0xed,0x00,0x7f,0xf3,0x02,0x09,0x05,0x00,
+0xf0,0x05,0x01,0x20,0x7f,0x7f,0xee,0xff,0xd0,0x7e,0x04,0x54,0x42,0x00,0x7e,0x00,
+0x00,0x14,0x31,0x25,0x00,0x09,0xe3,0x00,0x90,0x7f,0x50,0x04,0xea,0x00,0xcc,0x00,
+0x00,0x8f,0xbf,0x02,0xb1,0xbe,0x00,0x4f,0xc6,0x6b,0xf7,0x00,0x03,0xad,0xca,0x40,
+0xca,0x00,0xf4,0x10,0x10,0x00,0x55,0x40,0x45,0x40,0xe7,0x00,0x3f,0xfd,0x5f,0xed,
+0x0e,0x80,0x04,0xf3,0x06,0xf1,0x00,0xe8,0x00,0x4f,0x20,0x6f,0x00,0x0e,0x80,0x04,
+0xf2,0x06,0xf0,0x0d,0x00,0x20,0xfd,0x94,0x0d,0x00,0x20,0xdb,0x63,0x0d,0x00,0x12,
+0x0d,0x1a,0x00,0xf6,0x00,0xd8,0x00,0x3f,0xfe,0x6f,0xff,0x5d,0x80,0x00,0x23,0x20,
+0x33,0x20,0xd8,0x00,0x8b,0x07,0x22,0x00,0xd9,0x0d,0x00,0x17,0x80,0x72,0x0a,0xf2,
+0x09,0x00,0x02,0x04,0x52,0x25,0x41,0xf2,0x7e,0x0f,0xe9,0xef,0xd2,0xf4,0x7e,0x1f,
+0x50,0xe7,0x02,0xf4,0x6e,0x1f,0x50,0xe7,0x01,0x06,0x00,0x80,0xf7,0x9e,0x1f,0x40,
+0xf7,0x01,0xff,0xfe,0x06,0x00,0x27,0xf4,0x6e,0x06,0x00,0xd0,0x7e,0x0f,0xfb,0xdf,
+0xf4,0xf4,0x7e,0x01,0x31,0x13,0x21,0xf4,0x7e,0x0a,0x01,0x03,0x06,0x00,0x01,0xd3,
+0x05,0x23,0xe3,0x6e,0x55,0x09,0x40,0x33,0x31,0x13,0x33,0x16,0x0b,0x30,0xab,0xff,
+0xf5,0x1e,0x04,0x11,0xcb,0xf4,0x05,0x21,0x0c,0xa0,0xf5,0x05,0x10,0xca,0x0d,0x00,
+0xf6,0x02,0x11,0x0c,0xb1,0x10,0x00,0x05,0xff,0xfc,0x9f,0xff,0x90,0x00,0x02,0x32,
+0x12,0x33,0x20,0x6a,0x03,0x14,0xad,0x4a,0x07,0xf0,0x05,0x55,0x0b,0xff,0xee,0xee,
+0xee,0xff,0xe0,0x00,0xdf,0xfc,0x7e,0xee,0x50,0x00,0x0f,0x95,0x29,0xe4,0x41,0xcb,
+0x09,0x00,0xae,0x02,0x21,0x0f,0x60,0xae,0x02,0xf4,0x02,0xf7,0x11,0x9e,0x11,0x00,
+0x00,0x0e,0xff,0xe7,0xff,0xf9,0x00,0x00,0x02,0x20,0x02,0x21,0x10,0x02,0x02,0xe2,
+0x06,0x74,0x01,0x44,0x44,0x9f,0x33,0x33,0x10,0x6c,0x06,0x02,0x78,0x06,0x04,0x0d,
+0x00,0x26,0x7e,0x00,0x72,0x05,0x02,0xb4,0x0a,0xf0,0x03,0x65,0x04,0x55,0x05,0xf0,
+0x0e,0xfe,0x4f,0xee,0x46,0xf0,0x0e,0x80,0x1f,0x50,0x05,0xf0,0x0f,0x06,0x00,0xd2,
+0xf1,0x0e,0xb6,0x3f,0xa6,0x25,0xf1,0x09,0xdd,0x5b,0xdd,0x55,0xf0,0x72,0x0b,0xc0,
+0x05,0x55,0x56,0x79,0x95,0xf0,0x3d,0xee,0xfe,0xca,0x65,0xf0,0xac,0x0b,0x00,0x02,
+0x0b,0x1a,0xf6,0x06,0x00,0x10,0xf1,0x6b,0x0a,0x21,0x05,0xf1,0x6e,0x01,0x13,0x50,
+0xe2,0x0b,0x50,0x45,0x55,0x50,0x06,0xf0,0x7c,0x08,0x21,0x30,0x6f,0x49,0x02,0x10,
+0x06,0xfb,0x05,0x70,0x2f,0x40,0x6f,0x10,0x00,0x22,0x25,0x0d,0x00,0x10,0x2f,0x1a,
+0x00,0xa0,0xff,0x94,0xf5,0x22,0x10,0x06,0xf4,0x41,0x4f,0x30,0x30,0x0c,0x40,0x04,
+0xf3,0x00,0x03,0x34,0x00,0x9a,0xee,0xff,0xf5,0x6f,0x00,0x00,0x75,0x54,0x31,0x4a,
+0x0c,0x1e,0xf1,0x4a,0x0c,0x10,0x00,0x68,0x00,0xa0,0x92,0x05,0xe0,0x00,0x1d,0xff,
+0xef,0x70,0x6f,0x10,0x25,0x01,0xf4,0x14,0x05,0xf1,0x00,0x07,0x88,0x8f,0x70,0x5f,
+0x00,0x02,0xfb,0xa9,0x93,0x05,0xff,0xf7,0x2f,0x40,0x00,0x00,0x5f,0x66,0x12,0xf7,
+0x44,0x69,0x35,0xf1,0x00,0x0d,0xff,0xed,0xb3,0x5f,0x10,0x8a,0x06,0x14,0x35,0x4a,
+0x0c,0x25,0x02,0x90,0xf6,0x08,0x14,0xd1,0x75,0x05,0x0b,0x4a,0x0c,0xc9,0x01,0xee,
+0xef,0xf5,0x05,0xf1,0x00,0x05,0x66,0x6f,0x70,0x5f,0x68,0x00,0xf5,0x0b,0x76,0x32,
+0xfd,0xbb,0xb3,0x05,0xfe,0xe8,0x2f,0x40,0x00,0x21,0x5f,0x10,0x01,0xfe,0xee,0xff,
+0x65,0xf1,0x00,0x04,0x65,0x43,0x10,0x3d,0x29,0x05,0xb1,0x7e,0xee,0xef,0xfe,0x10,
+0x00,0x0a,0xe6,0x65,0x59,0xf2,0xf2,0x01,0x20,0x4f,0x20,0x75,0x00,0x22,0x05,0xf2,
+0x68,0x00,0x16,0x10,0x4a,0x0c,0x2f,0x00,0x15,0x68,0x00,0x20,0x30,0x4f,0x10,0x00,
+0xba,0x0c,0xe1,0x10,0x00,0x00,0x06,0xef,0xff,0xc2,0x00,0x00,0x04,0xf9,0x21,0x3d,
+0xd0,0x18,0x04,0x15,0x5f,0x18,0x04,0x41,0x0a,0xfe,0xdf,0xe4,0x18,0x04,0x13,0x30,
+0x3e,0x01,0xf5,0x01,0x14,0x06,0x77,0x75,0x06,0xe0,0x7e,0x0c,0xdd,0xee,0x07,0xe0,
+0x7e,0x00,0x00,0x8e,0x06,0x00,0xf3,0x05,0x02,0x44,0xae,0x07,0xe3,0x9e,0x0f,0xff,
+0xfd,0x07,0xff,0xfe,0x0f,0x81,0x00,0x07,0xe0,0x7e,0x0f,0x70,0x06,0x00,0xf1,0x00,
+0x06,0xe0,0x7e,0x0f,0xed,0xef,0x96,0xe0,0x7e,0x04,0x66,0x53,0x06,0xe0,0x7e,0xdd,
+0x0d,0x11,0x7e,0x63,0x02,0x10,0x7e,0x23,0x01,0x22,0xb0,0x6e,0x5e,0x0b,0x01,0x00,
+0x02,0x90,0x0b,0xee,0xfc,0x0e,0x60,0xf6,0x46,0x6b,0xe0,0xdb,0x0c,0xf0,0x11,0x8e,
+0x0e,0x70,0xf6,0x35,0x6b,0xe0,0xeb,0x8f,0x6e,0xfe,0xeb,0x0d,0xec,0xf6,0xe8,0x00,
+0x00,0xd8,0x0f,0x6e,0xb6,0x7a,0x6d,0x80,0xf6,0x8d,0xdc,0xa3,0xd7,0x0f,0x60,0x08,
+0x04,0x11,0x30,0xc6,0x02,0x71,0x20,0x02,0x55,0x54,0x46,0xf4,0x00,0x2a,0x02,0x04,
+0x7f,0x04,0x02,0x0b,0x00,0x26,0x00,0x70,0x20,0x01,0x21,0x06,0xf0,0x20,0x01,0x30,
+0x6f,0x65,0x10,0x20,0x01,0x50,0xfd,0xc4,0x1e,0xff,0xff,0xf0,0x01,0x61,0xf8,0x44,
+0x40,0x05,0xf2,0x10,0x20,0x01,0x20,0xff,0x61,0x20,0x01,0x20,0xf3,0x20,0x20,0x01,
+0x11,0x5f,0x2b,0x0f,0x2f,0x11,0x60,0x20,0x01,0x10,0x50,0x02,0x55,0x30,0x00,0x00,
+0x10,0x00,0x01,0x00,0xf0,0x2e,0x20,0x35,0x55,0x51,0x00,0x6e,0x0d,0xff,0xef,0x50,
+0x07,0xe0,0x00,0x01,0xf6,0x00,0x7e,0x00,0x00,0x1f,0x60,0x07,0xe0,0x12,0x23,0xf6,
+0x47,0xbe,0x0d,0xff,0xff,0x58,0xce,0xe0,0xe9,0x22,0x10,0x00,0x7e,0x0e,0x80,0x00,
+0x00,0x06,0xe0,0xe8,0x00,0x00,0x00,0x6f,0x0e,0xdb,0xbc,0xe9,0x06,0xf0,0x48,0x88,
+0x75,0x10,0x6f,0x41,0x00,0x20,0x06,0xf0,0x06,0x00,0x11,0x6e,0x0b,0x00,0x24,0xd0,
+0x00,0x01,0x00,0xf0,0x0e,0x02,0x10,0xbf,0xff,0xf4,0x00,0xc9,0x03,0x55,0x5f,0x60,
+0x0d,0x90,0x00,0x00,0xf6,0x12,0xd9,0x0b,0xee,0xef,0x6d,0xff,0x90,0xeb,0x65,0x50,
+0x02,0xd9,0x4d,0x00,0xf0,0x24,0x0c,0x90,0xeb,0x66,0x8a,0x70,0xd9,0x08,0xdd,0xcb,
+0x94,0x0d,0x90,0x00,0x13,0x33,0x33,0x83,0x00,0x0f,0xff,0xff,0xff,0x70,0x00,0xf8,
+0x11,0x11,0xf8,0x00,0x0f,0x70,0x00,0x0e,0x80,0x00,0xf7,0x00,0x00,0xe7,0x00,0x0e,
+0xff,0xff,0xff,0x60,0x00,0x13,0x44,0x43,0x20,0x58,0x00,0x20,0x03,0x40,0x58,0x00,
+0x10,0xbb,0x58,0x00,0xf0,0x24,0x0b,0xb0,0x00,0x00,0xf6,0x23,0xbb,0x0b,0xff,0xff,
+0x6d,0xff,0xb0,0xeb,0x55,0x40,0x01,0xbb,0x0e,0x80,0x00,0x21,0x0b,0xb0,0xdf,0xef,
+0xff,0xa0,0xbb,0x02,0x55,0x43,0x10,0x07,0x70,0x00,0x92,0x00,0x00,0x64,0x00,0x0f,
+0x60,0x00,0x0c,0x90,0x00,0xf9,0x55,0x55,0xd9,0x63,0x00,0x71,0xef,0x90,0x00,0xf6,
+0x00,0x00,0xc9,0x6e,0x00,0x60,0x80,0x00,0x24,0x44,0x44,0x30,0x58,0x00,0xd0,0x10,
+0x41,0x05,0x55,0x51,0x05,0xf0,0xe7,0x1e,0xfe,0xf7,0x06,0xf0,0x78,0x00,0x14,0x05,
 0x06,0x00,0xf4,0x07,0x01,0x23,0xe7,0x27,0xf0,0xf7,0x1f,0xff,0xf9,0xff,0xf0,0xe7,
-0x2f,0x61,0x10,0x16,0xf0,0xe7,0x2f,0x50,0x00,0x05,0x06,0x00,0x92,0x1f,0xdc,0xdf,
-0x65,0xf0,0xe7,0x05,0x77,0x53,0x7c,0x23,0x17,0x06,0x06,0x00,0x36,0x04,0xb0,0xd7,
-0x43,0x08,0xd0,0x03,0x0a,0xdd,0xe5,0x05,0xe0,0xf6,0x57,0x7f,0x70,0x6f,0x0f,0x60,
-0x58,0x00,0xb0,0xf6,0x35,0x6f,0x88,0xbf,0x0f,0x6e,0xfe,0xd5,0xac,0xf0,0x28,0x02,
-0x10,0x5f,0x28,0x02,0x20,0x65,0xf0,0x28,0x02,0x30,0x4f,0x0f,0x50,0x2c,0x1d,0x3f,
-0x30,0x00,0x9f,0x28,0x02,0x0f,0xa2,0x01,0x03,0x05,0x77,0x82,0x06,0xf0,0xf5,0xad,
-0xdf,0x58,0x00,0xc4,0x06,0xf0,0xf6,0x24,0x4f,0x76,0xaf,0x0f,0x6e,0xff,0xf6,0xce,
-0x58,0x00,0xf2,0x0c,0x80,0x14,0x15,0xf0,0xf5,0xdf,0xff,0xf5,0x5f,0x0f,0x51,0x33,
-0x20,0x06,0xf0,0xf5,0x00,0x33,0x00,0x6f,0x0f,0x50,0x0c,0xb0,0x00,0x20,0x61,0x80,
-0x1d,0x51,0x0c,0xb0,0x00,0x12,0x20,0x11,0x21,0x10,0x40,0x93,0x2a,0x02,0x00,0x07,
-0x80,0x25,0x55,0x61,0x00,0x6e,0xbf,0xff,0xf7,0x11,0x02,0xf1,0x0d,0xf7,0x36,0xae,
-0x00,0x00,0xf7,0xbf,0xfe,0x02,0x22,0xf7,0x00,0x7e,0xdf,0xff,0xf6,0x00,0x6e,0xea,
-0x32,0x20,0x24,0x9e,0xe8,0x00,0x00,0xcf,0xfe,0x13,0x02,0x64,0xed,0xbb,0xce,0xa0,
-0x6f,0x58,0x12,0x02,0x15,0x6f,0x11,0x02,0x25,0x6d,0x00,0x8b,0x0e,0x01,0xb8,0x01,
-0x60,0x6f,0x03,0x55,0x5f,0x65,0x8b,0x4b,0x05,0xf2,0x0f,0xac,0xef,0x0a,0xdd,0xdf,
-0x60,0x06,0xf0,0xeb,0x77,0x61,0x79,0xcf,0x0e,0x80,0x00,0x0a,0xde,0xf0,0xeb,0x56,
-0x79,0x50,0x6f,0x08,0xee,0xdc,0xa3,0x06,0xf0,0x98,0x0f,0x11,0x0d,0xf6,0x0b,0x46,
-0x45,0x44,0x44,0xaf,0x03,0x13,0x16,0x8f,0x7f,0x0a,0x11,0x14,0x58,0x00,0xc0,0x50,
-0x0b,0xff,0xff,0x40,0x07,0xf0,0x03,0x55,0x5f,0x6a,0xde,0x19,0x30,0xf0,0x12,0x67,
-0xac,0xf0,0x0b,0xff,0xff,0x61,0x28,0xf0,0x0e,0xb5,0x54,0x0d,0xff,0xf0,0x0e,0x81,
-0x12,0x54,0x17,0xf0,0x0c,0xff,0xff,0xf8,0x07,0xf0,0x00,0x32,0x21,0x00,0x02,0x60,
-0x6a,0x08,0x20,0x56,0x40,0x13,0x1c,0x20,0xef,0xe0,0xc3,0x20,0x10,0x19,0xb4,0x29,
-0x00,0x69,0x00,0x40,0x0f,0x91,0x11,0x10,0x40,0x31,0x33,0xef,0xff,0xf1,0xf2,0x0f,
-0x10,0x24,0xf2,0x18,0x00,0x34,0x09,0x15,0xef,0x0e,0x0e,0x51,0x02,0x45,0x55,0x5c,
-0xc0,0x18,0x19,0x15,0xe9,0xf7,0x15,0x41,0xbc,0x44,0x44,0x56,0x27,0x00,0x31,0xfe,
-0xd2,0x00,0x5a,0x1a,0x04,0x6b,0x1e,0x54,0x25,0x55,0x5b,0xe5,0x45,0x54,0x1d,0x00,
-0x86,0x0a,0x12,0x53,0xf4,0x08,0x05,0xb7,0x06,0x30,0x05,0xdd,0xde,0xe7,0x20,0x41,
-0x8f,0x65,0x55,0x54,0xd7,0x13,0x51,0x44,0x71,0x00,0x00,0x5e,0x04,0x28,0x02,0xd6,
-0x06,0x61,0x9e,0xed,0xde,0xfd,0xde,0xed,0x1b,0x09,0x20,0x66,0x40,0x25,0x03,0x10,
-0x33,0x0a,0x38,0x01,0xf7,0x1d,0x49,0x01,0x11,0x10,0x5f,0xf7,0x1d,0x12,0x20,0xac,
-0x5a,0x05,0x76,0x09,0x30,0xfe,0xee,0xff,0x4a,0x3e,0x62,0x55,0x54,0x9f,0x00,0x00,
-0x01,0xed,0x20,0x01,0xe3,0x0e,0x00,0x49,0x01,0x12,0x01,0xf7,0x09,0x00,0xbc,0x37,
-0x30,0x23,0x8f,0x32,0x5f,0x0c,0x3b,0x49,0xf5,0x44,0xfd,0x1d,0x18,0x0a,0x22,0x0b,
-0x00,0x2e,0x06,0x12,0x20,0xc6,0x05,0x14,0x80,0x8e,0x2a,0x02,0x3e,0x0a,0x02,0x86,
-0x14,0x44,0x03,0x33,0x32,0x9f,0x15,0x17,0x40,0x8f,0x43,0x33,0x31,0x18,0x16,0xf0,
-0x06,0xee,0xff,0x40,0x00,0x04,0x5a,0xf5,0x44,0x00,0x35,0x55,0x5a,0xf5,0x55,0x64,
-0x9d,0xde,0xee,0xed,0xdd,0xda,0xb0,0x0b,0x21,0x55,0x00,0x6d,0x02,0x10,0x30,0x42,
-0x00,0x41,0x5f,0x30,0x00,0xdf,0x1b,0x06,0x11,0xea,0x4e,0x00,0x12,0xef,0x3e,0x0a,
-0x10,0x65,0x52,0x1a,0x0d,0x30,0x01,0x00,0x7d,0x2d,0x20,0xee,0xff,0xc8,0x00,0x02,
-0x98,0x01,0xa4,0xf5,0x55,0x55,0x82,0x00,0x00,0x4d,0xef,0xff,0xed,0x30,0x01,0x02,
-0x3e,0x0a,0x50,0x02,0x55,0x55,0x44,0x45,0x1b,0x0b,0x03,0x08,0x1a,0x21,0xbf,0x20,
-0x3a,0x02,0x20,0xde,0x30,0xa0,0x2e,0x70,0x60,0xaf,0x70,0x00,0x00,0xed,0x30,0x6b,
-0x30,0x12,0x03,0x11,0x32,0x02,0xe6,0x01,0x43,0x8f,0xff,0xfe,0xfb,0xf1,0x00,0x00,
-0x12,0x00,0x14,0xcc,0xe4,0x01,0x16,0xba,0xe3,0x01,0x00,0x40,0x01,0x70,0xed,0x20,
-0x00,0x01,0x80,0x05,0x40,0xe4,0x03,0xd8,0x0c,0xa0,0x00,0x25,0x5a,0xf6,0x6d,0xc6,
-0x64,0x9f,0xfe,0xee,0xef,0x1e,0x0b,0x10,0xf6,0xea,0x08,0x30,0x54,0xf7,0x00,0x5d,
-0x04,0x11,0xf7,0xd4,0x00,0x14,0xf6,0x8f,0x22,0x40,0xeb,0x44,0x55,0x66,0xa7,0x00,
-0x14,0xee,0x0b,0x1f,0x10,0x25,0xdb,0x01,0x00,0x34,0x17,0x34,0xfd,0xdd,0xd9,0xd9,
-0x02,0x26,0x08,0xf0,0xe5,0x02,0x02,0x06,0x00,0x3f,0x02,0x40,0x00,0x10,0x01,0x04,
-0x10,0xef,0x0d,0x00,0x11,0x8e,0x82,0x1b,0x00,0x10,0x01,0xe4,0x61,0x00,0x00,0x4d,
-0xee,0xee,0xec,0x30,0x00,0x22,0x11,0x11,0x11,0x22,0x72,0x16,0x30,0x22,0x22,0x7f,
-0x37,0x17,0xa0,0x88,0x05,0xf0,0x2d,0x10,0x00,0x0b,0xd6,0x68,0x68,0x30,0x35,0x01,
-0xbc,0x1b,0x00,0x75,0x19,0x14,0xf1,0x44,0x1c,0x06,0x9e,0x07,0x00,0x52,0x16,0x00,
-0xe1,0x1f,0x00,0xc8,0x0b,0x11,0xd9,0xc8,0x00,0x11,0xd9,0xc8,0x00,0x1d,0xf7,0xc8,
-0x00,0x15,0xdc,0xea,0x1e,0x30,0x44,0x44,0x55,0x3c,0x1c,0x33,0xef,0xfe,0xea,0xa5,
-0x21,0x09,0x06,0x00,0x30,0x70,0x08,0xe0,0x69,0x1f,0x2f,0x02,0x40,0xc8,0x00,0x03,
-0x02,0x0d,0x00,0x42,0x8e,0x54,0x44,0x43,0x08,0x03,0x41,0x51,0x00,0x00,0x4e,0x08,
-0x03,0x10,0x11,0xc0,0x17,0x04,0xf8,0x09,0xb2,0x33,0x7f,0x43,0xbd,0x33,0x10,0x00,
-0x28,0xf6,0x5c,0xd4,0xd1,0x11,0x12,0xf2,0xf2,0x1c,0x11,0x30,0xf2,0x1c,0x14,0xf3,
-0xf2,0x1c,0x02,0xc8,0x00,0x00,0x68,0x00,0x10,0x52,0xb4,0x01,0x15,0xee,0xd8,0x01,
-0x17,0x14,0xd8,0x01,0x02,0xf9,0x20,0x41,0xbd,0x33,0x34,0x55,0xb8,0x02,0x28,0xfd,
-0x20,0xf1,0x0d,0x61,0x37,0x66,0x66,0x66,0x77,0x75,0xaa,0x23,0x04,0xa9,0x01,0x20,
-0x08,0xfe,0xe0,0x24,0x00,0x50,0x03,0x10,0xbd,0x06,0x04,0x31,0x44,0x4b,0xd0,0x4a,
-0x00,0x15,0xfb,0x4d,0x12,0x12,0xaf,0xaa,0x2d,0x01,0xd5,0x21,0x5e,0x25,0x55,0x44,
-0x44,0x44,0x4d,0x21,0x07,0x6c,0x18,0x11,0xe1,0x50,0x03,0x11,0x8f,0xef,0x02,0x02,
-0x50,0x03,0x00,0xdf,0x03,0x11,0x40,0xc3,0x02,0x00,0xa8,0x0c,0x30,0x21,0x11,0xe8,
-0x53,0x00,0x00,0x0c,0x00,0x11,0xbc,0xe7,0x1d,0x00,0x0c,0x0f,0x30,0x30,0x00,0x14,
-0xd0,0x0e,0x11,0x35,0x68,0x19,0x1a,0xad,0x50,0x03,0x30,0xfe,0xff,0x20,0x50,0x03,
-0x21,0x9f,0x20,0x50,0x03,0x1e,0x00,0x50,0x03,0x00,0xa3,0x01,0x12,0x52,0x02,0x0e,
-0x13,0xc0,0x1f,0x0e,0x00,0x17,0x26,0x00,0x15,0x22,0x11,0xbd,0x02,0x03,0x20,0x0b,
-0xd4,0xb5,0x2a,0x01,0xc5,0x03,0x14,0x10,0xf3,0x18,0x01,0xab,0x1e,0x02,0x9b,0x0d,
-0x10,0x30,0x6b,0x00,0x11,0x65,0xbd,0x23,0x00,0x78,0x01,0x11,0xe9,0x73,0x04,0x21,
-0x0e,0x90,0xb8,0x0e,0x12,0xdf,0x40,0x02,0x43,0x55,0x54,0x43,0x20,0x2b,0x0c,0x30,
-0x35,0x55,0x51,0x86,0x2b,0x20,0xff,0x80,0x99,0x14,0x11,0xe8,0x52,0x21,0xf0,0x06,
-0x80,0x0e,0x70,0x12,0x22,0xe8,0x00,0xe7,0x0d,0xff,0xff,0x70,0x0e,0x80,0xea,0x22,
-0x20,0x00,0xe8,0x0e,0x80,0x18,0x00,0x10,0xe8,0xd1,0x23,0xb6,0x0e,0xeb,0xbc,0xdd,
-0x0e,0x80,0x48,0x88,0x76,0x20,0xe8,0x31,0x20,0x1b,0xe8,0x0e,0x2a,0xb0,0x32,0xbf,
-0xff,0xf6,0x00,0xd9,0x35,0x55,0xf8,0x00,0xc9,0x1d,0x00,0xc0,0xc9,0xbe,0xee,0xf8,
-0x00,0xc9,0xeb,0x65,0x51,0x00,0xc9,0xe8,0x5d,0x18,0x01,0x52,0x08,0x51,0x8d,0xdc,
-0xb9,0x40,0xd9,0x9f,0x1c,0x10,0x04,0x44,0x18,0x20,0x01,0x55,0x4c,0x21,0x04,0x4c,
-0x00,0x06,0x05,0x00,0x12,0x41,0x52,0x00,0xb0,0x67,0x77,0x82,0x00,0xe6,0x0b,0xcc,
-0xbf,0x70,0x0e,0x80,0x6d,0x08,0xe0,0xe8,0x02,0x44,0x5f,0x70,0x0e,0x80,0xef,0xee,
-0xe5,0x00,0xe7,0x0e,0x70,0xb8,0x02,0x40,0xe8,0x00,0x13,0x30,0xb3,0x00,0x41,0xfb,
-0x0e,0x70,0x03,0xf3,0x18,0x01,0x16,0x27,0x00,0x35,0x03,0x10,0x82,0x5d,0x1a,0x00,
-0x80,0x05,0x00,0x6a,0x01,0x13,0x3f,0xc8,0x14,0x20,0x33,0x31,0x56,0x00,0x10,0x21,
-0xa8,0x00,0x10,0xd8,0xa8,0x00,0x10,0xd9,0x6f,0x00,0xf6,0x0b,0xd9,0xbf,0xff,0xf8,
-0x00,0xd9,0xeb,0x55,0x51,0x00,0xd8,0xe8,0x00,0x01,0x10,0xd8,0xde,0xdd,0xff,0xa0,
-0xd8,0x26,0x65,0x42,0x00,0xc6,0x00,0x19,0x50,0x03,0xf5,0x11,0x11,0xf8,0x1b,0x11,
-0x10,0xe8,0x05,0x00,0x29,0xe7,0x02,0x00,0x19,0x10,0x52,0x50,0x00,0x10,0xf7,0x50,
-0x00,0x10,0xe8,0x50,0x00,0x10,0xe8,0x50,0x00,0x20,0xe8,0xeb,0x63,0x01,0x00,0x50,
-0x00,0x60,0xe7,0xde,0xde,0xff,0xa0,0xe7,0x50,0x00,0x80,0xa3,0x00,0x90,0x00,0x00,
-0x83,0x01,0xf2,0x41,0x19,0x30,0xf7,0x55,0x55,0x9f,0x43,0x20,0xfe,0xf7,0xfc,0x20,
-0x12,0xf6,0x50,0x19,0x04,0x00,0x19,0x72,0x52,0x0b,0xff,0xff,0x60,0x0f,0x70,0x51,
-0x00,0x00,0x9a,0x01,0x10,0x80,0x4a,0x01,0x80,0xe8,0x0e,0xb6,0x65,0x10,0x0e,0x70,
-0xe8,0xa8,0x17,0x60,0x0e,0xb6,0x68,0xa7,0x0e,0x70,0x4c,0x01,0x10,0xe7,0x30,0x00,
-0x20,0x0e,0x70,0x9f,0x2d,0x10,0x61,0x51,0x36,0x01,0xc2,0x42,0x10,0xf5,0x96,0x0f,
-0xa0,0x1a,0xf7,0x00,0x04,0xfb,0x00,0x07,0xf9,0x00,0x45,0x4b,0x45,0x05,0xa8,0x00,
-0x16,0xe8,0xa8,0x00,0x01,0x56,0x00,0x51,0xeb,0x66,0x51,0x00,0xe8,0xe4,0x01,0x00,
-0xa0,0x01,0x13,0xe7,0x54,0x00,0x50,0x03,0x20,0x62,0x00,0x09,0x4e,0x06,0x60,0x8f,
-0x40,0x17,0xf6,0x00,0xd9,0xd1,0x12,0x10,0xda,0x44,0x10,0x93,0x5f,0xa6,0x7c,0xf3,
-0x00,0x04,0xbd,0xc9,0x30,0xd8,0x18,0xf0,0x03,0x06,0x77,0x78,0x10,0x3f,0x30,0x00,
-0x1f,0xdc,0xcf,0x60,0x3f,0x40,0x00,0x2f,0x50,0x0e,0x70,0x07,0x00,0x43,0x40,0x0e,
-0x70,0x2f,0x07,0x00,0xb2,0x74,0x20,0x2f,0x30,0x0e,0x70,0x2f,0xff,0xd0,0x2f,0x30,
-0x15,0x00,0x03,0x07,0x00,0x50,0x41,0x1e,0x70,0x2f,0x40,0x3a,0x14,0x73,0x60,0x2f,
-0x40,0x00,0x01,0x22,0x11,0x36,0x09,0x05,0x07,0x00,0x12,0x50,0x9d,0x25,0x05,0xef,
-0x30,0x05,0x66,0x0d,0x90,0x61,0x04,0xf0,0x00,0x1f,0xfe,0xef,0x60,0x5f,0x23,0x1f,
-0x00,0x96,0x0c,0x70,0x1f,0x50,0x0f,0x70,0x5f,0x77,0x31,0x0d,0x00,0x50,0xfe,0xe7,
-0x0f,0x50,0x0e,0xb0,0x0c,0x40,0xff,0xff,0xf7,0x05,0x60,0x30,0x35,0x43,0x00,0x4f,
-0x71,0x0e,0x10,0xcf,0x0b,0x07,0x00,0xc9,0x13,0x1e,0x59,0x18,0x1a,0x03,0x0d,0x00,
-0x24,0x01,0x60,0x25,0x28,0x50,0x45,0x56,0x61,0x04,0xf1,0x68,0x00,0xf1,0x01,0x70,
-0x4f,0x20,0x01,0xf4,0x00,0xf7,0x04,0xf2,0x00,0x1f,0x40,0x0f,0x70,0x4f,0x10,0x0d,
-0x00,0xf5,0x05,0xfe,0xe8,0x0f,0x40,0x0e,0x70,0x4f,0x87,0x20,0xf9,0x55,0xe8,0x04,
-0xf2,0x00,0x0d,0xff,0xfe,0x50,0x4f,0xce,0x0d,0x15,0x57,0x18,0x1a,0x13,0x30,0x18,
-0x1a,0x00,0xff,0x21,0x13,0x22,0x50,0x04,0x11,0x30,0x3a,0x1c,0x18,0x10,0xd0,0x00,
-0x17,0xf1,0xd0,0x00,0x12,0x04,0xd0,0x00,0x30,0x4f,0xff,0x81,0x0d,0x00,0x50,0xf7,
-0x52,0x1f,0x50,0x0e,0x05,0x33,0xb0,0xfe,0xee,0xf8,0x04,0xf1,0x00,0x05,0x77,0x66,
-0x24,0x34,0x0e,0x01,0xf0,0x01,0x02,0xbd,0xd1,0x00,0x00,0xf6,0x02,0xbb,0xbb,0xb2,
-0x00,0x0f,0x70,0x05,0x68,0x65,0xfd,0x0e,0xff,0x07,0x4f,0xff,0x30,0x00,0x0f,0x60,
-0x0b,0xa0,0xc9,0x00,0x00,0xff,0xfd,0x9c,0x3d,0x70,0x00,0x03,0x54,0x21,0xad,0x90,
-0x38,0x01,0x0d,0x01,0x68,0x00,0x60,0x05,0xf5,0x41,0x0f,0x84,0x4f,0x38,0x01,0x54,
-0xdf,0xff,0xe5,0x05,0xf0,0xb4,0x1a,0x20,0x08,0xee,0xa4,0x08,0x00,0x96,0x32,0x23,
-0x9f,0x10,0xa0,0x21,0x21,0x00,0xaf,0x45,0x01,0x25,0x0b,0xd0,0x54,0x05,0x10,0x50,
-0xbe,0x08,0x02,0x99,0x38,0x00,0xb2,0x07,0xaa,0x79,0x99,0x92,0x05,0xf0,0x00,0x1f,
-0xcb,0xbf,0x70,0x68,0x00,0x20,0xaa,0x51,0x0d,0x00,0x2b,0xfb,0xa5,0xa0,0x01,0x32,
-0x33,0x00,0x2b,0xe9,0x12,0x02,0xd7,0x12,0x20,0xfb,0x00,0x0a,0x34,0x11,0xdf,0x6f,
-0x3b,0x10,0xee,0x63,0x02,0xf2,0x02,0x2b,0xfe,0xf9,0x10,0x00,0x00,0xbf,0xb3,0x05,
-0xdf,0x60,0x00,0x06,0x20,0x00,0x00,0x55,0x34,0x10,0xf1,0x19,0x03,0x55,0x63,0x0e,
-0x60,0xf5,0xef,0xef,0xe0,0xf7,0x0f,0x5e,0x80,0x7e,0x0f,0x70,0xf5,0xe8,0x07,0xe0,
-0xe7,0x0f,0x5e,0x70,0x7e,0x0e,0x93,0xf5,0xe7,0x07,0xe0,0xef,0xff,0x5f,0x60,0x7e,
-0x0e,0x81,0xf5,0xf6,0x16,0x00,0xb0,0x83,0x8e,0x0e,0x70,0xf5,0xcf,0xff,0xc0,0xe7,
-0x0f,0x50,0x32,0x04,0x00,0x98,0x12,0x03,0x0b,0x00,0x10,0xf6,0xe8,0x1a,0x01,0xcf,
-0x0b,0x04,0x9d,0x11,0xf0,0x1f,0x77,0x77,0x05,0xb0,0xd8,0xee,0xcd,0xf2,0x7e,0x0d,
+0x2f,0x61,0x10,0x16,0xf0,0xe7,0x2f,0x50,0x00,0x05,0x06,0x00,0xc1,0x1f,0xdc,0xdf,
+0x65,0xf0,0xe7,0x05,0x77,0x53,0x05,0xf0,0xe7,0x0d,0x01,0x06,0x06,0x00,0x45,0x04,
+0xb0,0xd7,0x00,0x01,0x00,0xd0,0x03,0x0a,0xdd,0xe5,0x05,0xe0,0xf6,0x57,0x7f,0x70,
+0x6f,0x0f,0x60,0x58,0x00,0xf0,0x1e,0xf6,0x35,0x6f,0x88,0xbf,0x0f,0x6e,0xfe,0xd5,
+0xac,0xf0,0xf6,0xe8,0x00,0x00,0x5f,0x0f,0x6e,0xb6,0x7a,0x65,0xf0,0xf6,0x8d,0xdc,
+0xa3,0x4f,0x0f,0x50,0x00,0x00,0x00,0x50,0x30,0x00,0x9f,0xff,0xff,0xff,0x20,0x02,
+0x55,0x54,0x46,0xf4,0x42,0x00,0x20,0x2f,0x40,0x57,0x01,0x06,0x0b,0x00,0xf2,0x00,
+0x00,0x70,0x00,0x00,0x00,0x01,0x03,0x05,0x77,0x82,0x06,0xf0,0xf5,0xad,0xdf,0x58,
+0x00,0xc4,0x06,0xf0,0xf6,0x24,0x4f,0x76,0xaf,0x0f,0x6e,0xff,0xf6,0xce,0x58,0x00,
+0xf0,0x0e,0x80,0x14,0x15,0xf0,0xf5,0xdf,0xff,0xf5,0x5f,0x0f,0x51,0x33,0x20,0x06,
+0xf0,0xf5,0x00,0x33,0x00,0x6f,0x0f,0x50,0x0c,0xb0,0x00,0x20,0x61,0x00,0xcb,0x49,
+0x00,0xf1,0x01,0x0c,0xb0,0x00,0x12,0x20,0x00,0xbf,0xff,0xff,0xff,0x40,0x01,0x33,
+0x33,0x32,0x10,0xc0,0x01,0x80,0x25,0x55,0x61,0x00,0x6e,0xbf,0xff,0xf7,0x11,0x02,
+0xf1,0x0d,0xf7,0x36,0xae,0x00,0x00,0xf7,0xbf,0xfe,0x02,0x22,0xf7,0x00,0x7e,0xdf,
+0xff,0xf6,0x00,0x6e,0xea,0x32,0x20,0x24,0x9e,0xe8,0x00,0x00,0xcf,0xfe,0x13,0x02,
+0x64,0xed,0xbb,0xce,0xa0,0x6f,0x58,0x12,0x02,0x15,0x6f,0x11,0x02,0x15,0x6d,0x00,
+0x01,0x11,0x01,0xb8,0x01,0xf2,0x17,0x6f,0x03,0x55,0x5f,0x65,0x8b,0xf0,0x00,0x00,
+0xf6,0xac,0xef,0x0a,0xdd,0xdf,0x60,0x06,0xf0,0xeb,0x77,0x61,0x79,0xcf,0x0e,0x80,
+0x00,0x0a,0xde,0xf0,0xeb,0x56,0x79,0x50,0x6f,0x08,0xee,0xdc,0xa3,0x52,0x02,0xc0,
+0x25,0x00,0x0d,0xff,0xff,0xff,0xc0,0x00,0x45,0x44,0x44,0xaf,0x10,0x00,0x11,0x08,
+0x16,0x00,0x11,0x8f,0x0b,0x00,0x10,0xe0,0x06,0x00,0x11,0x14,0x58,0x00,0xf1,0x36,
+0x50,0x0b,0xff,0xff,0x40,0x07,0xf0,0x03,0x55,0x5f,0x6a,0xde,0xf0,0x00,0x00,0x0f,
+0x67,0xac,0xf0,0x0b,0xff,0xff,0x61,0x28,0xf0,0x0e,0xb5,0x54,0x0d,0xff,0xf0,0x0e,
+0x81,0x12,0x54,0x17,0xf0,0x0c,0xff,0xff,0xf8,0x07,0xf0,0x00,0x32,0x21,0x00,0x02,
+0x60,0x00,0x02,0x55,0x55,0x56,0x40,0x00,0x0b,0xff,0xff,0xef,0xe0,0x00,0x00,0x11,
+0x11,0x19,0xf0,0x00,0x0e,0x69,0x00,0xb0,0x0f,0x91,0x11,0x10,0x00,0x00,0x0e,0xfe,
+0xef,0xff,0xf1,0x24,0x00,0xe1,0x54,0x30,0x00,0x24,0x55,0x55,0x53,0x00,0x00,0x08,
+0xff,0xff,0xef,0xb0,0xc5,0x00,0x90,0xac,0x00,0x00,0x02,0x45,0x55,0x5c,0xc0,0x00,
+0x2d,0x01,0x51,0xe9,0x00,0x00,0x0b,0xa0,0x17,0x00,0x41,0xbc,0x44,0x44,0x56,0x27,
+0x00,0x71,0xfe,0xd2,0x00,0x00,0x00,0x05,0x80,0x15,0x00,0x10,0x8d,0xc3,0x00,0x70,
+0x55,0x5b,0xe5,0x45,0x54,0x09,0xff,0x01,0x00,0xd1,0xd0,0x00,0x14,0x44,0x44,0x53,
+0x00,0x00,0x06,0xff,0xff,0xff,0xf0,0x22,0x00,0xf2,0x0d,0x7f,0x00,0x00,0x05,0xdd,
+0xde,0xef,0xf0,0x00,0x00,0x8f,0x65,0x55,0x54,0x00,0x00,0x08,0xf4,0x44,0x44,0x71,
+0x00,0x00,0x5e,0xff,0xff,0xfe,0x30,0x1f,0x00,0xe0,0x00,0x9e,0xed,0xde,0xfd,0xde,
+0xed,0x02,0x55,0x55,0x55,0x55,0x66,0x40,0x25,0x03,0xe1,0x33,0x00,0x00,0x0c,0xff,
+0xff,0xff,0xf2,0x00,0x00,0x01,0x11,0x10,0x5f,0xba,0x02,0x21,0x04,0xf3,0x4e,0x00,
+0x21,0x4f,0x20,0x07,0x00,0x14,0x60,0x71,0x01,0xf0,0x02,0x06,0xfe,0xee,0xff,0xd0,
+0x00,0x00,0x14,0x55,0x54,0x9f,0x00,0x00,0x01,0x55,0x55,0x5a,0x68,0x00,0x31,0xff,
+0xff,0xfd,0x49,0x01,0xf5,0x06,0x01,0x10,0x00,0x00,0x7f,0xff,0xff,0xff,0x50,0x00,
+0x00,0x23,0x8f,0x32,0x10,0x00,0x25,0x55,0x49,0xf5,0x44,0xa9,0x00,0x11,0x01,0x41,
+0x00,0x23,0x0a,0xc0,0xf4,0x00,0x00,0x01,0x00,0x81,0x0b,0xd1,0x11,0x11,0x20,0x00,
+0x00,0x9f,0x34,0x03,0x50,0x00,0x23,0x33,0x32,0x20,0x82,0x00,0x00,0x30,0x01,0x11,
+0x6f,0x54,0x00,0x41,0x03,0x33,0x32,0x9f,0x53,0x00,0xf1,0x17,0xfe,0x00,0x00,0x8f,
+0x43,0x33,0x31,0x00,0x00,0x7f,0xfe,0xee,0xff,0x40,0x00,0x04,0x5a,0xf5,0x44,0x00,
+0x35,0x55,0x5a,0xf5,0x55,0x64,0x9d,0xde,0xee,0xed,0xdd,0xda,0x00,0x35,0x55,0x55,
+0x55,0x00,0x6d,0x02,0x10,0x30,0x42,0x00,0xa1,0x5f,0x30,0x00,0xdf,0xff,0xff,0xff,
+0x10,0x00,0xea,0x4e,0x00,0x11,0xef,0xed,0x03,0x5f,0x25,0x65,0x55,0x43,0x00,0x30,
+0x01,0x01,0x40,0x06,0xee,0xee,0xff,0xc8,0x00,0x02,0x98,0x01,0xa4,0xf5,0x55,0x55,
+0x82,0x00,0x00,0x4d,0xef,0xff,0xed,0x30,0x01,0x10,0x9f,0xc1,0x00,0xb2,0xfd,0x02,
+0x55,0x55,0x44,0x45,0x54,0x30,0x00,0x00,0x05,0x39,0x00,0x21,0xbf,0x20,0x3a,0x02,
+0xf3,0x08,0xde,0x30,0x00,0x00,0x01,0xaf,0x60,0xaf,0x70,0x00,0x00,0xed,0x30,0x00,
+0x7f,0x70,0x00,0x03,0x00,0x00,0x00,0x11,0x00,0xe6,0x01,0x43,0x8f,0xff,0xfe,0xfb,
+0xf1,0x00,0x00,0x12,0x00,0x14,0xcc,0xe4,0x01,0x16,0xba,0xe3,0x01,0x00,0x40,0x01,
+0x70,0xed,0x20,0x00,0x01,0x80,0x05,0x40,0xe4,0x03,0xf3,0x00,0x0c,0xa0,0x00,0x25,
+0x5a,0xf6,0x6d,0xc6,0x64,0x9f,0xfe,0xee,0xef,0xff,0xfc,0x78,0x01,0xb0,0xcf,0xff,
+0xff,0xf6,0x00,0x00,0x35,0x55,0x54,0xf7,0x00,0x5d,0x04,0x10,0xf7,0xd4,0x00,0x00,
+0x12,0x00,0x11,0xe8,0x1e,0x00,0x40,0xeb,0x44,0x55,0x66,0xa7,0x00,0x23,0xee,0xdb,
+0x2f,0x00,0x10,0x25,0xdb,0x01,0x74,0x64,0x8e,0xee,0xef,0xfd,0xdd,0xd9,0xd9,0x02,
+0x26,0x08,0xf0,0xe5,0x02,0x02,0x06,0x00,0x3f,0x02,0x40,0x00,0x10,0x01,0x04,0x10,
+0xef,0x0d,0x00,0x42,0x8e,0x55,0x55,0x43,0x10,0x01,0xf1,0x01,0x61,0x00,0x00,0x4d,
+0xee,0xee,0xec,0x30,0x00,0x22,0x11,0x11,0x11,0x22,0x10,0xaf,0xd2,0x01,0xf1,0x14,
+0x00,0x22,0x22,0x7f,0x22,0x22,0x10,0x00,0x88,0x05,0xf0,0x2d,0x10,0x00,0x0b,0xd6,
+0x68,0x68,0xf2,0x00,0x00,0xbf,0xee,0xee,0xef,0x20,0x00,0x0b,0xb0,0x00,0x04,0xf1,
+0x00,0x00,0xaf,0x83,0x01,0x54,0x01,0x44,0x44,0x44,0x20,0x40,0x02,0x40,0x8e,0xff,
+0xff,0xf8,0x9f,0x00,0x21,0x54,0xd9,0xc8,0x00,0x11,0xd9,0xc8,0x00,0x1d,0xf7,0xc8,
+0x00,0x12,0xdc,0x2f,0x00,0x00,0x23,0x00,0xc0,0x44,0x55,0x53,0xbf,0xff,0xff,0xef,
+0xfe,0xea,0x00,0x0e,0x80,0xb7,0x00,0x09,0x06,0x00,0x10,0x70,0x06,0x00,0x4f,0x04,
+0x10,0x02,0x40,0xc8,0x00,0x03,0x02,0x0d,0x00,0x42,0x8e,0x54,0x44,0x43,0x08,0x03,
+0x41,0x51,0x00,0x00,0x4e,0x08,0x03,0x00,0x15,0x02,0x21,0x01,0x00,0xc8,0x00,0xf2,
+0x01,0xfe,0x01,0x33,0x7f,0x43,0xbd,0x33,0x10,0x00,0x28,0xf6,0x5c,0xd4,0x00,0x00,
+0x0a,0x08,0x03,0x81,0xbc,0x00,0x00,0x4f,0x30,0x00,0x0b,0xc0,0x08,0x03,0x35,0xaf,
+0xee,0xef,0xc8,0x00,0x00,0x68,0x00,0x10,0x52,0xb4,0x01,0x15,0xee,0xd8,0x01,0x17,
+0x14,0xd8,0x01,0x11,0xbb,0x15,0x00,0x41,0xbd,0x33,0x34,0x55,0xb8,0x02,0x37,0xfd,
+0x20,0x00,0x01,0x00,0xb4,0x37,0x66,0x66,0x66,0x77,0x75,0x8d,0xdd,0xdd,0xdd,0xdd,
+0xa9,0x01,0x51,0x08,0xfe,0xee,0xff,0xb0,0x50,0x03,0x10,0xbd,0x06,0x04,0x31,0x44,
+0x4b,0xd0,0x4a,0x00,0x42,0xfb,0x00,0x00,0x0b,0x29,0x03,0x10,0xaf,0x40,0x05,0x30,
+0x00,0x00,0x44,0x51,0x06,0x4c,0x25,0x55,0x44,0x44,0x50,0x03,0x02,0xca,0x01,0x21,
+0x00,0x9e,0x06,0x00,0x21,0x09,0xe1,0x50,0x03,0x11,0x8f,0xef,0x02,0x02,0x50,0x03,
+0x00,0xdf,0x03,0x10,0x40,0xc3,0x02,0x00,0x66,0x01,0x40,0x02,0x21,0x11,0xe8,0x53,
+0x00,0x00,0x0c,0x00,0x40,0xbc,0x22,0x22,0x10,0xdb,0x00,0x30,0xee,0xff,0x30,0xc2,
+0x00,0x11,0x54,0x43,0x03,0x3a,0x55,0x64,0xad,0x50,0x03,0x30,0xfe,0xff,0x20,0x50,
+0x03,0x21,0x9f,0x20,0x50,0x03,0x1e,0x00,0x50,0x03,0x00,0xa3,0x01,0x11,0x52,0xa7,
+0x04,0x12,0xff,0xb1,0x00,0xb1,0x9d,0x00,0x00,0x08,0xdd,0xde,0xef,0xc0,0x00,0x00,
+0xbd,0x02,0x03,0x52,0x0b,0xd4,0x44,0x44,0x40,0xc5,0x03,0x13,0x10,0xf5,0x00,0x52,
+0x9e,0xee,0xee,0xee,0xee,0x80,0x04,0x20,0x55,0x30,0x6b,0x00,0x42,0x65,0x00,0x00,
+0x0e,0x78,0x01,0x11,0xe9,0x73,0x04,0x63,0x0e,0x90,0x00,0x04,0xf2,0x00,0xc3,0x03,
+0x52,0x01,0x55,0x54,0x43,0x20,0xfe,0x07,0x10,0x00,0x56,0x08,0x70,0xe7,0x0e,0xff,
+0xff,0x80,0x0e,0x70,0x34,0x02,0x10,0xe7,0x09,0x02,0xf0,0x05,0x0e,0x70,0x12,0x22,
+0xe8,0x00,0xe7,0x0d,0xff,0xff,0x70,0x0e,0x80,0xea,0x22,0x20,0x00,0xe8,0x0e,0x80,
+0x18,0x00,0x00,0x53,0x02,0xb1,0xe8,0x0e,0xeb,0xbc,0xdd,0x0e,0x80,0x48,0x88,0x76,
+0x20,0x62,0x02,0x00,0x1a,0x00,0x03,0x6d,0x02,0x25,0x0d,0x60,0x98,0x01,0xb0,0x32,
+0xbf,0xff,0xf6,0x00,0xd9,0x35,0x55,0xf8,0x00,0xc9,0x1d,0x00,0xb0,0xc9,0xbe,0xee,
+0xf8,0x00,0xc9,0xeb,0x65,0x51,0x00,0xc9,0x2a,0x00,0x11,0xc9,0x52,0x08,0x50,0x8d,
+0xdc,0xb9,0x40,0xd9,0x2d,0x00,0xb5,0x42,0x04,0xff,0xff,0xff,0xf6,0x01,0x55,0x44,
+0x44,0xf8,0x4c,0x00,0x06,0x05,0x00,0x12,0x41,0x52,0x00,0xb0,0x67,0x77,0x82,0x00,
+0xe6,0x0b,0xcc,0xbf,0x70,0x0e,0x80,0x6d,0x08,0xe0,0xe8,0x02,0x44,0x5f,0x70,0x0e,
+0x80,0xef,0xee,0xe5,0x00,0xe7,0x0e,0x70,0xb8,0x02,0x40,0xe8,0x00,0x13,0x30,0xb3,
+0x00,0xe0,0xfb,0x0e,0x70,0x03,0x32,0x10,0x00,0xf7,0x00,0x06,0x00,0x00,0x0f,0x70,
+0x35,0x03,0x41,0x82,0x00,0x4f,0x10,0x80,0x05,0x00,0x6a,0x01,0xa0,0x3f,0xff,0xff,
+0xff,0xb0,0x00,0x23,0x33,0x33,0x31,0x56,0x00,0x10,0x21,0xa8,0x00,0x10,0xd8,0xa8,
+0x00,0x10,0xd9,0x6f,0x00,0xf0,0x0b,0xd9,0xbf,0xff,0xf8,0x00,0xd9,0xeb,0x55,0x51,
+0x00,0xd8,0xe8,0x00,0x01,0x10,0xd8,0xde,0xdd,0xff,0xa0,0xd8,0x26,0x65,0x42,0x00,
+0xc6,0x32,0x00,0xf0,0x01,0x30,0x02,0xff,0xff,0xff,0xf7,0x03,0xf5,0x11,0x11,0xf8,
+0x03,0xf3,0x00,0x00,0xe8,0x05,0x00,0x30,0xe7,0x02,0xff,0x36,0x04,0x13,0x23,0xf6,
+0x08,0x10,0x52,0x50,0x00,0x10,0xf7,0x50,0x00,0x10,0xe8,0x50,0x00,0x10,0xe8,0x50,
+0x00,0x20,0xe8,0xeb,0x63,0x01,0x00,0x50,0x00,0x60,0xe7,0xde,0xde,0xff,0xa0,0xe7,
+0x50,0x00,0xf1,0x0c,0xa3,0x00,0x90,0x00,0x00,0x83,0x01,0xf2,0x00,0x00,0xe7,0x01,
+0xf7,0x55,0x55,0xf7,0x01,0xff,0xff,0xfe,0xf7,0x02,0xf3,0x00,0x00,0xf6,0x01,0x50,
+0x00,0x13,0x34,0xee,0x08,0x72,0x52,0x0b,0xff,0xff,0x60,0x0f,0x70,0x51,0x00,0x00,
+0x9a,0x01,0x10,0x80,0x4a,0x01,0x70,0xe8,0x0e,0xb6,0x65,0x10,0x0e,0x70,0x1f,0x01,
+0x70,0xe7,0x0e,0xb6,0x68,0xa7,0x0e,0x70,0x4c,0x01,0x10,0xe7,0x30,0x00,0x00,0x0c,
+0x01,0x70,0x1f,0x70,0x61,0x00,0x00,0x08,0xf6,0xcd,0x08,0xf5,0x05,0xff,0xf5,0x00,
+0x00,0x03,0xfc,0x1a,0xf7,0x00,0x04,0xfb,0x00,0x07,0xf9,0x00,0x45,0x00,0x00,0x03,
+0x70,0xa8,0x00,0x16,0xe8,0xa8,0x00,0x01,0x56,0x00,0x51,0xeb,0x66,0x51,0x00,0xe8,
+0xe4,0x01,0x00,0xa0,0x01,0x13,0xe7,0x54,0x00,0x50,0x03,0x20,0x62,0x00,0x09,0x4e,
+0x06,0x40,0x8f,0x40,0x17,0xf6,0x27,0x01,0xf2,0x00,0xda,0x00,0xda,0x00,0x00,0xea,
+0x00,0x5f,0xa6,0x7c,0xf3,0x00,0x04,0xbd,0xc9,0xdc,0x06,0xf0,0x05,0x00,0x00,0x06,
+0x77,0x78,0x10,0x3f,0x30,0x00,0x1f,0xdc,0xcf,0x60,0x3f,0x40,0x00,0x2f,0x50,0x0e,
+0x70,0x07,0x00,0x43,0x40,0x0e,0x70,0x2f,0x07,0x00,0xb2,0x74,0x20,0x2f,0x30,0x0e,
+0x70,0x2f,0xff,0xd0,0x2f,0x30,0x15,0x00,0x03,0x07,0x00,0x20,0x41,0x1e,0x07,0x00,
+0xa3,0x1f,0xff,0xff,0x60,0x2f,0x40,0x00,0x01,0x22,0x11,0x36,0x09,0x05,0x07,0x00,
+0x11,0x50,0x07,0x00,0x22,0x1f,0x40,0x9f,0x08,0x05,0x63,0x02,0xf0,0x0b,0x45,0x55,
+0x61,0x04,0xf0,0x00,0x1f,0xfe,0xef,0x60,0x5f,0x10,0x01,0xf5,0x00,0xf7,0x05,0xf1,
+0x00,0x1f,0x50,0x0f,0x70,0x5f,0x77,0x31,0x0d,0x00,0xb0,0xfe,0xe7,0x0f,0x50,0x0e,
+0x70,0x5f,0x10,0x00,0xff,0xff,0x1a,0x00,0x62,0x03,0x44,0x43,0x00,0x4f,0x00,0x48,
+0x0b,0x00,0xfb,0x05,0x00,0x0b,0x07,0x42,0x04,0x55,0x55,0x59,0xd9,0x04,0x12,0x6f,
+0x89,0x07,0x08,0x0d,0x00,0x12,0x01,0xcc,0x02,0x80,0x05,0x00,0x00,0x45,0x56,0x61,
+0x04,0xf1,0x68,0x00,0xf1,0x01,0x70,0x4f,0x20,0x01,0xf4,0x00,0xf7,0x04,0xf2,0x00,
+0x1f,0x40,0x0f,0x70,0x4f,0x10,0x0d,0x00,0xf1,0x06,0xfe,0xe8,0x0f,0x40,0x0e,0x70,
+0x4f,0x87,0x20,0xf9,0x55,0xe8,0x04,0xf2,0x00,0x0d,0xff,0xfe,0x50,0x4f,0x10,0x3a,
+0x00,0xf2,0x02,0xf1,0x00,0x00,0x57,0x00,0x00,0x5f,0x00,0x00,0x0a,0xd0,0x00,0x00,
+0x30,0x00,0x00,0xad,0xa0,0x07,0x33,0xd2,0x22,0x22,0x50,0x04,0x41,0x30,0x00,0x00,
+0x22,0x32,0x04,0x06,0xd0,0x00,0x17,0xf1,0xd0,0x00,0x12,0x04,0xd0,0x00,0x30,0x4f,
+0xff,0x81,0x0d,0x00,0xf0,0x05,0xf7,0x52,0x1f,0x50,0x0e,0x70,0x4f,0x10,0x00,0xfe,
+0xee,0xf8,0x04,0xf1,0x00,0x05,0x77,0x66,0x24,0x34,0x0e,0x01,0xff,0x1b,0x02,0xbd,
+0xd1,0x00,0x00,0xf6,0x02,0xbb,0xbb,0xb2,0x00,0x0f,0x70,0x05,0x68,0x65,0x00,0x00,
+0xf6,0x00,0x4f,0xff,0x30,0x00,0x0f,0x60,0x0b,0xa0,0xc9,0x00,0x00,0xff,0xfd,0x9c,
+0x3d,0x70,0x00,0x03,0x54,0x21,0xad,0x90,0x38,0x01,0x0d,0x01,0x68,0x00,0x60,0x05,
+0xf5,0x41,0x0f,0x84,0x4f,0x38,0x01,0x32,0xdf,0xff,0xe5,0x96,0x07,0x00,0xdc,0x01,
+0x21,0x08,0xee,0xa4,0x08,0x41,0x26,0x66,0x55,0x9f,0xb6,0x05,0x11,0x48,0x8b,0x06,
+0x00,0x45,0x01,0x25,0x0b,0xd0,0x54,0x05,0x10,0x50,0xbe,0x08,0x11,0x44,0xa7,0x01,
+0x00,0xb2,0x07,0xaa,0x79,0x99,0x92,0x05,0xf0,0x00,0x1f,0xcb,0xbf,0x70,0x68,0x00,
+0x20,0xaa,0x51,0x0d,0x00,0x2b,0xfb,0xa5,0xa0,0x01,0x41,0x33,0x00,0x2b,0x00,0xab,
+0x08,0x11,0x00,0x1e,0x01,0x00,0x0b,0x06,0x40,0x22,0x23,0xdf,0x40,0x80,0x00,0x10,
+0xee,0x63,0x02,0xf1,0x02,0x2b,0xfe,0xf9,0x10,0x00,0x00,0xbf,0xb3,0x05,0xdf,0x60,
+0x00,0x06,0x20,0x00,0x00,0x55,0x0d,0x0c,0xf1,0x1a,0x03,0x03,0x55,0x63,0x0e,0x60,
+0xf5,0xef,0xef,0xe0,0xf7,0x0f,0x5e,0x80,0x7e,0x0f,0x70,0xf5,0xe8,0x07,0xe0,0xe7,
+0x0f,0x5e,0x70,0x7e,0x0e,0x93,0xf5,0xe7,0x07,0xe0,0xef,0xff,0x5f,0x60,0x7e,0x0e,
+0x81,0xf5,0xf6,0x16,0x00,0xb0,0x83,0x8e,0x0e,0x70,0xf5,0xcf,0xff,0xc0,0xe7,0x0f,
+0x50,0x32,0x04,0x10,0xf5,0x40,0x03,0x02,0x0b,0x00,0x00,0x2d,0x03,0x36,0xb5,0x0f,
+0x50,0x16,0x0d,0xf0,0x1e,0x04,0x77,0x77,0x05,0xb0,0xd8,0xee,0xcd,0xf2,0x7e,0x0d,
 0x8e,0x70,0x4f,0x26,0xf0,0xd9,0xe7,0x05,0xf2,0x6f,0xbf,0x9e,0x70,0x5f,0x26,0xf8,
 0xe9,0xe8,0x05,0xf2,0x6f,0x0d,0x8d,0xff,0xff,0x16,0xf0,0xd8,0x13,0x32,0x10,0x28,
-0x09,0x50,0x00,0x90,0x38,0x1a,0x10,0x2f,0xac,0x31,0x51,0x02,0xf7,0x55,0x55,0xe7,
-0xba,0x25,0x20,0x70,0x02,0x1f,0x04,0x01,0x82,0x2b,0x16,0x60,0xd0,0x1c,0xf0,0x0d,
-0x06,0x99,0x99,0x06,0xd0,0xe7,0xed,0xbc,0xf1,0x7e,0x0e,0x7e,0x70,0x4f,0x17,0xf0,
-0xe7,0xe7,0x05,0xf1,0x6f,0xbf,0x7e,0x70,0x5f,0x16,0xf8,0xf7,0x0b,0x00,0xb0,0x0e,
-0x7d,0xfe,0xff,0x16,0xf0,0xe7,0x35,0x54,0x30,0x4c,0xcb,0x03,0x52,0x06,0x10,0xc5,
-0x00,0x00,0x5b,0x26,0x01,0x19,0x3a,0x20,0x6f,0xdf,0xee,0x1c,0x30,0x90,0x8f,0x90,
-0x17,0x09,0x20,0x5f,0xa0,0xbc,0x4b,0x12,0x14,0xb6,0x12,0x90,0x68,0x88,0x82,0x00,
-0xe7,0x0f,0xdc,0xcf,0x60,0xcd,0x00,0x10,0xe7,0xc0,0x1b,0x20,0x0e,0x70,0xe3,0x00,
-0xa0,0xe8,0x77,0xf7,0x0f,0x50,0x0e,0x9d,0xdf,0x81,0xf5,0x36,0x05,0xc1,0x1f,0x40,
-0x0e,0x70,0x0e,0x80,0xf5,0x11,0xe7,0x00,0xe8,0x0f,0xde,0x05,0x4f,0x23,0x32,0x20,
-0x00,0xc8,0x05,0x07,0x00,0x7e,0x2b,0xf0,0x0b,0x66,0x10,0x07,0xd0,0xff,0xee,0xf7,
-0x00,0x8f,0x0f,0x60,0x0f,0x70,0x07,0xf0,0xf6,0x00,0xf7,0x25,0xaf,0x0f,0x60,0x0f,
-0x7a,0xef,0xf0,0x20,0x1b,0xc2,0x7e,0x0e,0xa5,0x5e,0x80,0x08,0xe0,0xbf,0xff,0xe5,
-0x00,0x8e,0x3d,0x07,0x00,0x9a,0x01,0x10,0x8d,0xab,0x0c,0x23,0x02,0x50,0xb6,0x0c,
-0x33,0xb1,0x11,0x11,0xa1,0x24,0x00,0xbf,0x10,0x02,0xb6,0x0c,0xd0,0x03,0x55,0x56,
-0x10,0x06,0xe0,0xef,0xee,0xf7,0x00,0x7f,0x0f,0x70,0x58,0x00,0xff,0x05,0xf7,0x00,
-0xf7,0xcf,0xff,0x0f,0x70,0x0e,0x71,0x39,0xf0,0xea,0x44,0xe8,0x00,0x7e,0x0b,0xff,
-0xfe,0x50,0xf8,0x1b,0x06,0x01,0x8a,0x3a,0x02,0xbc,0x29,0x54,0xff,0xef,0xff,0xff,
-0x10,0xf8,0x1b,0xf0,0x1b,0x02,0x04,0x14,0x66,0x64,0x06,0xe0,0xf6,0xee,0xde,0xe0,
-0x7f,0x0f,0x6e,0x80,0x6e,0x06,0xf0,0xf6,0xe8,0x06,0xe0,0x6f,0x0f,0x6e,0x70,0x6f,
-0x6a,0xf0,0xf5,0xe7,0x06,0xfd,0xef,0x0f,0x5f,0x60,0x6e,0x06,0xf0,0xf5,0xf6,0x16,
-0x00,0x40,0x5e,0x71,0x7f,0x06,0x71,0x0d,0x91,0xe0,0x6f,0x0f,0x50,0x11,0x10,0x06,
-0xe0,0xf5,0x6a,0x22,0x10,0x60,0x52,0x19,0x10,0xf6,0x6a,0x22,0x07,0x22,0x28,0xf0,
-0x05,0x20,0x69,0x99,0x92,0x00,0xe8,0xfd,0xbb,0xf7,0x01,0xe8,0xf6,0x00,0xf7,0xef,
-0xf8,0xf6,0x00,0xf7,0x12,0x0a,0x00,0xc0,0x00,0xe8,0xe7,0x00,0xe7,0x68,0xf8,0xea,
-0x55,0xe8,0xbd,0xf8,0x04,0x01,0x12,0xe7,0x1b,0x31,0x40,0x72,0x00,0x00,0xe7,0x15,
-0x0f,0x33,0x52,0x00,0xf7,0xa7,0x32,0x01,0x7c,0x15,0x12,0xfc,0xe3,0x1a,0x00,0x23,
-0x26,0xf0,0x01,0x69,0x99,0xa3,0x00,0x8e,0xfd,0xaa,0xf7,0x34,0xae,0xf7,0x00,0xe8,
-0xcf,0xfe,0xf7,0x29,0x2b,0x60,0xf7,0x00,0xe8,0x24,0xae,0xe7,0x0f,0x00,0x80,0xdf,
-0xff,0xf7,0x00,0x8e,0x24,0x44,0x30,0x54,0x01,0x21,0x13,0x31,0x01,0x01,0x80,0xb1,
-0x00,0xae,0x30,0x04,0xea,0x00,0xe8,0x99,0x08,0x10,0xcd,0x9d,0x38,0x93,0x2d,0xfe,
-0xef,0xd3,0x00,0x00,0x35,0x53,0x00,0x55,0x00,0x12,0x0c,0xc8,0x20,0x41,0xda,0x11,
-0x10,0x8e,0x78,0x14,0x21,0x08,0xe0,0x78,0x14,0x11,0x8e,0x1b,0x1c,0x24,0x19,0xe0,
-0xf6,0x04,0x22,0x00,0x22,0x38,0x1b,0x18,0x08,0xee,0x13,0x2c,0x6c,0xe6,0x0a,0x23,
-0x12,0x05,0x4e,0x00,0x41,0x7f,0x55,0x44,0x8f,0x4c,0x1a,0x00,0xcf,0x04,0x51,0x7f,
-0x33,0x34,0x8f,0x10,0x1a,0x00,0x12,0xd0,0xc7,0x13,0x00,0x7e,0x0d,0x59,0xaf,0x55,
-0x55,0x40,0xaf,0x0c,0x16,0x0f,0x38,0x1b,0x1a,0x0f,0x68,0x00,0x03,0x1f,0x33,0x68,
-0x00,0x0c,0x02,0x06,0x06,0x04,0x36,0x0c,0x11,0x10,0xb7,0x05,0x01,0x27,0x4b,0x20,
-0x7f,0x82,0x3d,0x0c,0xf0,0x01,0xcf,0x60,0x00,0xaf,0x50,0x00,0x06,0x10,0x00,0x00,
-0x43,0x00,0x00,0xbe,0xee,0xee,0xf1,0x4a,0x41,0xb6,0x65,0x5a,0xe0,0xe0,0x02,0x11,
-0x8e,0xec,0x02,0x15,0x08,0x0d,0x00,0x12,0x0d,0x68,0x00,0x14,0x13,0x59,0x13,0x10,
-0x00,0x73,0x0b,0x00,0x8f,0x09,0x41,0x03,0x55,0x55,0xaf,0xa0,0x0a,0x04,0x2f,0x22,
-0x0e,0x72,0x23,0x06,0xbe,0x14,0x01,0xf8,0x22,0x00,0x84,0x3c,0x41,0xae,0x65,0x55,
-0xbd,0xf4,0x05,0x20,0x08,0xd0,0x5e,0x01,0x25,0x01,0x9d,0xca,0x09,0x10,0x02,0x3d,
-0x0a,0x03,0xfc,0x2a,0x12,0xbf,0xf0,0x0b,0x81,0x11,0x11,0x3f,0x51,0x11,0x00,0x00,
-0x58,0x2e,0x10,0x41,0x0a,0xe0,0x2f,0x40,0x92,0x01,0x13,0x71,0x62,0x22,0x03,0xc8,
-0x0d,0x14,0x60,0x62,0x22,0x11,0x02,0xeb,0x22,0x01,0x7b,0x49,0x00,0x7e,0x19,0x11,
-0x7f,0xbe,0x01,0x10,0x6f,0x98,0x1a,0x21,0xef,0xfe,0xf1,0x0a,0x1f,0x42,0x7e,0x19,
-0x05,0x11,0x10,0x7e,0x19,0x11,0x20,0x7e,0x19,0x11,0x20,0x7e,0x19,0x1e,0x00,0x7e,
-0x19,0x01,0xd0,0x00,0x50,0x46,0x66,0x61,0x00,0xe6,0x7d,0x1b,0x20,0xe7,0xe8,0x46,
-0x04,0x1a,0xe7,0x05,0x00,0x11,0xf7,0x05,0x00,0x00,0x27,0x0a,0x10,0xe7,0x05,0x00,
-0x84,0xef,0xff,0xf7,0x00,0xe7,0x23,0x33,0x30,0xf7,0x02,0x04,0x05,0x00,0x06,0x60,
-0x22,0x60,0x21,0x35,0x55,0x61,0x00,0xc9,0xe7,0x03,0x66,0xc9,0xf7,0x00,0xf7,0x00,
-0xca,0x05,0x00,0x00,0x50,0x00,0x60,0xc9,0xdf,0xff,0xf8,0x00,0xc9,0xe8,0x02,0x12,
-0xc8,0x78,0x27,0x11,0xef,0x08,0x0a,0x2b,0x55,0x54,0x08,0x0a,0x15,0xe7,0x08,0x0a,
-0x02,0x38,0x04,0x10,0xf0,0x51,0x00,0x10,0x6f,0x38,0x04,0x00,0x03,0x12,0x01,0x0b,
-0x00,0x31,0x0e,0x70,0x06,0x38,0x04,0x10,0x6f,0x38,0x04,0x13,0x06,0x77,0x10,0x0f,
-0x38,0x04,0x16,0x20,0x00,0x31,0x58,0x00,0x20,0x0e,0x70,0x58,0x00,0x10,0xe7,0x58,
-0x00,0x30,0x0e,0x80,0xf7,0xdd,0x03,0x02,0x0b,0x00,0x01,0xfb,0x00,0x11,0x0d,0x23,
-0x0b,0x22,0x24,0x44,0xed,0x00,0x30,0x84,0x0e,0x70,0x93,0x38,0x00,0x27,0x1b,0x20,
-0xf8,0x00,0xb7,0x21,0x00,0xb8,0x4b,0xb0,0xf9,0x07,0xfa,0x00,0x06,0xf8,0x00,0x04,
-0xec,0x00,0x23,0x48,0x11,0x01,0x88,0x20,0x00,0x00,0x01,0x10,0x9c,0x57,0x00,0x10,
-0xac,0x51,0x00,0x16,0x9c,0x05,0x00,0x00,0x55,0x00,0x10,0x9c,0x00,0x01,0x10,0xac,
-0x54,0x00,0x10,0x9c,0x9e,0x18,0x10,0x23,0xb1,0x00,0x80,0x90,0x00,0x9f,0x40,0x05,
-0xf7,0x00,0xda,0x31,0x0d,0x10,0xdb,0xd4,0x2c,0x45,0x5f,0xb6,0x7c,0xf4,0x68,0x09,
-0x97,0x13,0x0c,0xff,0xff,0x50,0x07,0xe0,0xfa,0x55,0x38,0x05,0x41,0xe7,0x00,0x7f,
-0x0e,0x00,0x01,0x00,0x36,0x04,0x40,0x7f,0x02,0x44,0x43,0xd2,0x25,0xa2,0x03,0x75,
-0x44,0x13,0x00,0x00,0x4c,0xee,0xe3,0x00,0xec,0x0a,0x00,0x0d,0x0c,0x10,0x90,0x90,
-0x47,0xf3,0x03,0xa0,0x00,0x00,0x29,0xff,0xd3,0x00,0x05,0xdf,0xb5,0x6c,0xfd,0x50,
-0x45,0x10,0x00,0x01,0x64,0xe4,0x07,0xdc,0x04,0x00,0x05,0x10,0x1f,0x40,0x00,0x3f,
-0x30,0x0e,0x70,0x1f,0x50,0x07,0x00,0xd0,0xcb,0xbf,0x70,0x1f,0x72,0x10,0x3f,0xa8,
-0x8f,0x70,0x1f,0xff,0xf0,0x15,0x00,0x00,0x0e,0x00,0x20,0x30,0x0f,0x1c,0x00,0x60,
-0x2f,0x41,0x0f,0x70,0x0f,0x50,0xc0,0x09,0x10,0x50,0x41,0x07,0x33,0x22,0x21,0x00,
-0x48,0x07,0x29,0x0f,0x60,0x07,0x00,0x18,0x50,0xc0,0x09,0x10,0x04,0x05,0x22,0x10,
-0xc6,0xfb,0x22,0x80,0x50,0x0e,0x80,0x5f,0x20,0x00,0xfa,0x77,0x58,0x09,0x70,0x0f,
-0xdc,0xcf,0x70,0x4f,0xee,0x70,0x20,0x08,0x52,0xf7,0x52,0x0f,0x50,0x0f,0x20,0x08,
-0x00,0x7d,0x16,0x00,0xd6,0x00,0x15,0x3e,0x56,0x02,0x0f,0xc0,0x09,0x11,0x05,0x6f,
-0x00,0x40,0xb3,0x00,0x94,0x04,0x68,0x00,0x10,0x0d,0x68,0x00,0x60,0xf5,0x00,0xe7,
-0x05,0xf2,0x00,0xfb,0x06,0xa0,0x4f,0x20,0x00,0xf8,0x44,0xf7,0x04,0xfc,0xb5,0x0f,
-0x65,0x09,0x52,0xa9,0x30,0xf7,0x44,0xf6,0xc0,0x09,0x12,0x30,0xc0,0x09,0x00,0x39,
-0x0c,0x10,0x23,0x87,0x2e,0x00,0x98,0x1b,0x26,0x02,0xb0,0xd8,0x23,0x1e,0x00,0xd8,
-0x23,0x01,0x68,0x00,0x42,0xe5,0x00,0xb6,0x04,0xd0,0x00,0x51,0x4f,0x20,0x00,0xfb,
-0x89,0xd0,0x00,0x60,0xdb,0xbf,0x70,0x4f,0xff,0x80,0xc0,0x09,0x70,0xf6,0x41,0x0f,
-0x72,0x2f,0x60,0x4f,0x7d,0x03,0x31,0xf4,0x04,0xf1,0x52,0x41,0x42,0x2a,0x00,0x00,
-0x02,0x06,0x26,0x50,0x9e,0xfe,0xee,0xff,0x00,0xe3,0x12,0x25,0x17,0xf0,0x58,0x09,
-0x01,0xec,0x20,0x00,0x28,0x0f,0x00,0x7f,0x11,0x16,0x56,0xee,0x3b,0x00,0x68,0x00,
-0x1f,0x03,0x68,0x00,0x19,0x00,0x58,0x09,0xf1,0x07,0x16,0x66,0x42,0x66,0x60,0x00,
+0x09,0x50,0xcd,0x03,0xf0,0x03,0x73,0x00,0x2f,0x30,0x00,0x0e,0x70,0x02,0xf7,0x55,
+0x55,0xe7,0x00,0x2f,0xff,0xff,0xef,0x70,0xcf,0x03,0x01,0x0b,0x00,0x25,0xff,0x60,
+0xd0,0x03,0xf0,0x0e,0x02,0x06,0x99,0x99,0x06,0xd0,0xe7,0xed,0xbc,0xf1,0x7e,0x0e,
+0x7e,0x70,0x4f,0x17,0xf0,0xe7,0xe7,0x05,0xf1,0x6f,0xbf,0x7e,0x70,0x5f,0x16,0xf8,
+0xf7,0x0b,0x00,0xb0,0x0e,0x7d,0xfe,0xff,0x16,0xf0,0xe7,0x35,0x54,0x30,0x4c,0xcb,
+0x03,0x71,0x06,0x10,0xc5,0x00,0x00,0x03,0xf4,0x63,0x01,0x10,0x60,0x9d,0x02,0x80,
+0xdf,0x70,0x00,0x00,0x6f,0x90,0x8f,0x90,0x17,0x09,0x43,0x5f,0xa0,0x04,0x30,0x5e,
+0x0b,0xb0,0x03,0x10,0x68,0x88,0x82,0x00,0xe7,0x0f,0xdc,0xcf,0x60,0xcd,0x00,0x70,
+0xe7,0x00,0xe7,0x0f,0x60,0x0e,0x70,0xe3,0x00,0xa0,0xe8,0x77,0xf7,0x0f,0x50,0x0e,
+0x9d,0xdf,0x81,0xf5,0x36,0x05,0xc1,0x1f,0x40,0x0e,0x70,0x0e,0x80,0xf5,0x11,0xe7,
+0x00,0xe8,0x0f,0xde,0x05,0x4e,0x23,0x32,0x20,0x00,0xc8,0x05,0x07,0x0f,0x0d,0xf2,
+0x1c,0x55,0x66,0x10,0x07,0xd0,0xff,0xee,0xf7,0x00,0x8f,0x0f,0x60,0x0f,0x70,0x07,
+0xf0,0xf6,0x00,0xf7,0x25,0xaf,0x0f,0x60,0x0f,0x7a,0xef,0xf0,0xe7,0x00,0xe7,0x00,
+0x7e,0x0e,0xa5,0x5e,0x80,0x08,0xe0,0xbf,0xff,0xe5,0x00,0x8e,0x3d,0x07,0x00,0x9a,
+0x01,0x10,0x8d,0xab,0x0c,0x23,0x02,0x50,0xb6,0x0c,0x10,0xb1,0xd5,0x01,0x11,0xbf,
+0x73,0x0a,0x32,0x33,0x33,0x33,0xb6,0x0c,0xd0,0x03,0x55,0x56,0x10,0x06,0xe0,0xef,
+0xee,0xf7,0x00,0x7f,0x0f,0x70,0x58,0x00,0xf0,0x04,0xf7,0x00,0xf7,0xcf,0xff,0x0f,
+0x70,0x0e,0x71,0x39,0xf0,0xea,0x44,0xe8,0x00,0x7e,0x0b,0xff,0xfe,0xe9,0x0e,0x01,
+0x60,0x0c,0x11,0x0a,0x0b,0x07,0xf1,0x02,0x36,0x66,0x55,0xbe,0x00,0x02,0x44,0x44,
+0x4a,0xe0,0x00,0xff,0xff,0xff,0xfa,0x00,0x0f,0xca,0x04,0x52,0xff,0xef,0xff,0xff,
+0x10,0x06,0x0c,0x00,0xb7,0x01,0xf0,0x19,0x14,0x66,0x64,0x06,0xe0,0xf6,0xee,0xde,
+0xe0,0x7f,0x0f,0x6e,0x80,0x6e,0x06,0xf0,0xf6,0xe8,0x06,0xe0,0x6f,0x0f,0x6e,0x70,
+0x6f,0x6a,0xf0,0xf5,0xe7,0x06,0xfd,0xef,0x0f,0x5f,0x60,0x6e,0x06,0xf0,0xf5,0xf6,
+0x16,0x00,0x40,0x5e,0x71,0x7f,0x06,0x71,0x0d,0x80,0xe0,0x6f,0x0f,0x50,0x11,0x10,
+0x06,0xe0,0x10,0x02,0x70,0x7e,0x0f,0x60,0x00,0x00,0x07,0xe0,0x10,0x02,0x26,0x4a,
+0x0e,0x10,0x02,0xf0,0x05,0x20,0x69,0x99,0x92,0x00,0xe8,0xfd,0xbb,0xf7,0x01,0xe8,
+0xf6,0x00,0xf7,0xef,0xf8,0xf6,0x00,0xf7,0x12,0x0a,0x00,0xc0,0x00,0xe8,0xe7,0x00,
+0xe7,0x68,0xf8,0xea,0x55,0xe8,0xbd,0xf8,0x04,0x01,0x30,0xe7,0x00,0x00,0xf5,0x01,
+0x40,0x72,0x00,0x00,0xe7,0x15,0x0f,0x30,0x52,0x00,0xf7,0x11,0x00,0x10,0xf8,0x79,
+0x06,0x90,0xef,0xff,0xff,0xfc,0x00,0x13,0x33,0x33,0x31,0xf0,0x10,0x00,0x00,0x00,
+0x00,0x12,0x69,0x99,0xa3,0x00,0x8e,0xfd,0xaa,0xf7,0x34,0xae,0xf7,0x00,0xe8,0xcf,
+0xfe,0xf7,0x00,0xe8,0x00,0x8e,0xf7,0x00,0xe8,0x24,0xae,0xe7,0x0f,0x00,0xf0,0x3c,
+0xdf,0xff,0xf7,0x00,0x8e,0x24,0x44,0x30,0x00,0x8e,0x00,0x00,0x13,0x31,0x25,0x00,
+0x0a,0xff,0xff,0xb1,0x00,0xae,0x30,0x04,0xea,0x00,0xe8,0x00,0x00,0x9e,0x00,0xcd,
+0x10,0x02,0xdc,0x00,0x2d,0xfe,0xef,0xd3,0x00,0x00,0x35,0x53,0x00,0x00,0x13,0x33,
+0x33,0x31,0x00,0x00,0x0c,0xff,0xff,0xff,0xe0,0x00,0x00,0xda,0x11,0x10,0x8e,0x00,
+0x00,0x0d,0x90,0x00,0x08,0xe0,0x00,0x00,0xd9,0x00,0x00,0x0d,0x00,0xf0,0x01,0xa0,
+0x00,0x19,0xe0,0x00,0x00,0xcf,0xff,0xff,0xfd,0x00,0x00,0x00,0x22,0x33,0x21,0x82,
+0x00,0x30,0x08,0xc0,0x00,0x01,0x00,0xe1,0xad,0x00,0x00,0x00,0x35,0x55,0x6c,0xe6,
+0x66,0x65,0x0b,0xff,0xee,0xee,0x42,0x00,0x01,0x01,0x00,0x12,0x05,0x4e,0x00,0xf1,
+0x03,0x7f,0x55,0x44,0x8f,0x10,0x00,0x07,0xf0,0x00,0x05,0xf1,0x00,0x00,0x7f,0x33,
+0x34,0x8f,0x10,0x1a,0x00,0x30,0xd0,0x00,0x00,0x15,0x00,0xb2,0x00,0x02,0x55,0x55,
+0xaf,0x55,0x55,0x40,0xaf,0xff,0xff,0x5c,0x00,0x01,0x01,0x00,0xb1,0xae,0xee,0xee,
+0xed,0x10,0x00,0x04,0x66,0x55,0x58,0xf3,0x10,0x00,0x20,0x4f,0x20,0x06,0x00,0x21,
+0x04,0xf2,0x0d,0x00,0x21,0x3f,0x10,0x07,0x00,0x2f,0x30,0x00,0x68,0x00,0x0a,0x1f,
+0x33,0x68,0x00,0x0c,0x12,0x01,0x3c,0x00,0x11,0xf0,0x07,0x00,0x11,0xbf,0x53,0x00,
+0x20,0x6f,0xfc,0x07,0x00,0xf1,0x12,0x7f,0x82,0xde,0x30,0x00,0x00,0xcf,0x60,0x00,
+0xaf,0x50,0x00,0x06,0x10,0x00,0x00,0x43,0x00,0x00,0xbe,0xee,0xee,0xfb,0x00,0x00,
+0x0e,0xb6,0x65,0x5a,0xe0,0x00,0x00,0xe8,0x11,0x01,0x45,0x0e,0x80,0x00,0x08,0x0d,
+0x00,0x11,0x0d,0x68,0x00,0x00,0x45,0x01,0x14,0x20,0x95,0x00,0xf2,0x01,0xbf,0xee,
+0xef,0xff,0xff,0xff,0x03,0x55,0x55,0xaf,0x44,0x44,0x20,0x00,0x00,0x08,0x68,0x00,
+0x21,0x8f,0x00,0x38,0x01,0x02,0x22,0x01,0x12,0x8e,0x2a,0x00,0x04,0x33,0x00,0x00,
+0xa8,0x00,0xf0,0x02,0xff,0xff,0xff,0xa0,0x00,0x00,0xae,0x65,0x55,0xbd,0x00,0x00,
+0x0a,0xd0,0x00,0x08,0xd0,0x5e,0x01,0xf0,0x03,0x01,0x9d,0x00,0x00,0x08,0xff,0xff,
+0xff,0xc0,0x00,0x00,0x02,0x33,0x32,0x20,0x00,0x01,0x33,0x01,0x00,0x30,0x20,0xbf,
+0xff,0x01,0x00,0xf1,0x03,0x00,0x11,0x11,0x3f,0x51,0x11,0x00,0x00,0x58,0x02,0xf4,
+0x00,0x00,0x00,0x0a,0xe0,0x2f,0x40,0x92,0x01,0x10,0x71,0x0d,0x00,0xe1,0xe2,0x22,
+0x22,0x20,0x00,0x00,0x9f,0xff,0xff,0xff,0x60,0x00,0x00,0x22,0x0d,0x00,0x41,0x02,
+0x22,0x22,0x21,0x13,0x00,0x71,0xfe,0x00,0x00,0xad,0x22,0x22,0x7f,0xbe,0x01,0xf1,
+0x05,0x6f,0x00,0x00,0x9f,0xee,0xef,0xfe,0x00,0x00,0x14,0x55,0x54,0x42,0x00,0x24,
+0x44,0x44,0x44,0x44,0x43,0x28,0x01,0x40,0xeb,0x00,0x09,0xe0,0xad,0x00,0xb0,0xdf,
+0xff,0xff,0xff,0x10,0x00,0x35,0x55,0x55,0x7f,0x20,0x1f,0x00,0x41,0x7f,0x20,0x00,
+0xef,0x42,0x00,0x11,0xea,0xb6,0x00,0xa2,0xdf,0xee,0xff,0xff,0x50,0x00,0x25,0x55,
+0x55,0x54,0xd0,0x00,0xfa,0x01,0x46,0x66,0x61,0x00,0xe6,0xee,0xdd,0xf7,0x00,0xe7,
+0xe8,0x00,0xe7,0x00,0xe7,0xe7,0x05,0x00,0x12,0xf7,0x05,0x00,0x40,0xe8,0x00,0xe7,
+0xe7,0x05,0x00,0xa0,0xef,0xff,0xf7,0x00,0xe7,0x23,0x33,0x30,0x00,0xe7,0x3c,0x00,
+0x06,0x05,0x00,0x15,0xd6,0x15,0x01,0xf6,0x01,0x21,0x35,0x55,0x61,0x00,0xc9,0xef,
+0xee,0xf7,0x00,0xc9,0xf7,0x00,0xf7,0x00,0xca,0x05,0x00,0x00,0x50,0x00,0x60,0xc9,
+0xdf,0xff,0xf8,0x00,0xc9,0xe8,0x02,0x10,0xc8,0x2d,0x00,0xb0,0x10,0x04,0xef,0xff,
+0xff,0xf6,0x01,0x55,0x55,0x54,0xf8,0x0f,0x00,0x15,0xe8,0x05,0x00,0x01,0x55,0x00,
+0x10,0x41,0x05,0x00,0x70,0x02,0x03,0x55,0x56,0x10,0x06,0xf0,0x51,0x00,0x91,0x6f,
+0x0f,0x70,0x0f,0x70,0x06,0xf0,0xf7,0x00,0x0b,0x00,0xe1,0x0e,0x70,0x06,0xf0,0xea,
+0x44,0xe8,0x00,0x6f,0x0b,0xff,0xfe,0x50,0x06,0xa4,0x01,0x31,0x14,0x00,0x0a,0x79,
+0x01,0xf0,0x03,0x36,0x66,0x55,0xbe,0x00,0x02,0x44,0x44,0x4a,0xe0,0x00,0xff,0xff,
+0xff,0xfa,0x00,0x0f,0x70,0x1e,0x00,0x91,0xff,0xef,0xff,0xff,0x10,0x02,0x55,0x55,
+0x54,0x8b,0x02,0x10,0x31,0x58,0x00,0x20,0x0e,0x70,0x58,0x00,0x10,0xe7,0x58,0x00,
+0x20,0x0e,0x80,0x58,0x00,0x12,0xe8,0x0b,0x00,0x01,0xfb,0x00,0x82,0x0d,0xff,0xff,
+0x80,0x0e,0x70,0x24,0x44,0xed,0x00,0xc0,0x84,0x0e,0x70,0x00,0x00,0x2f,0x60,0x30,
+0x00,0x00,0x0a,0xf8,0x8a,0x02,0xf0,0x05,0xfc,0xf8,0x00,0x00,0x06,0xf9,0x07,0xfa,
+0x00,0x06,0xf8,0x00,0x04,0xec,0x00,0x23,0x00,0x00,0x01,0x40,0x58,0x00,0x10,0x11,
+0x00,0x01,0x10,0x9c,0x57,0x00,0x10,0xac,0x51,0x00,0x16,0x9c,0x05,0x00,0x00,0x55,
+0x00,0x10,0x9c,0x00,0x01,0x10,0xac,0x54,0x00,0x60,0x9c,0x00,0x00,0x14,0x31,0x23,
+0xb1,0x00,0xf1,0x0a,0x90,0x00,0x9f,0x40,0x05,0xf7,0x00,0xda,0x00,0x00,0xbc,0x00,
+0xdb,0x00,0x00,0xdb,0x00,0x5f,0xb6,0x7c,0xf4,0x00,0x04,0xbd,0xc9,0xa8,0x00,0xc0,
+0x13,0x0c,0xff,0xff,0x50,0x07,0xe0,0xfa,0x55,0xf7,0x00,0x7f,0x9d,0x00,0x20,0x07,
+0xf0,0x93,0x01,0x21,0x7f,0x0e,0x00,0x01,0x00,0x36,0x04,0xf0,0x05,0x7f,0x02,0x44,
+0x43,0x00,0x07,0xe0,0x00,0x03,0x75,0x44,0x13,0x00,0x00,0x4c,0xee,0xe3,0x00,0x00,
+0x23,0x1f,0x04,0x20,0x0e,0xff,0x5b,0x00,0xf1,0x06,0x00,0x01,0x9f,0xa0,0x00,0x00,
+0x29,0xff,0xd3,0x00,0x05,0xdf,0xb5,0x6c,0xfd,0x50,0x45,0x10,0x00,0x01,0x64,0x9e,
+0x03,0x00,0x03,0x00,0xbc,0x05,0x10,0x1f,0x40,0x00,0x3f,0x30,0x0e,0x70,0x1f,0x50,
+0x07,0x00,0xd0,0xcb,0xbf,0x70,0x1f,0x72,0x10,0x3f,0xa8,0x8f,0x70,0x1f,0xff,0xf0,
+0x15,0x00,0x00,0x0e,0x00,0x20,0x30,0x0f,0x1c,0x00,0xf1,0x05,0x2f,0x41,0x0f,0x70,
+0x0f,0x50,0x00,0x1f,0xff,0xff,0x50,0x0f,0x50,0x00,0x00,0x22,0x21,0x00,0x0f,0x50,
+0xfc,0x01,0x29,0x0f,0x60,0x07,0x00,0x02,0x15,0x00,0x02,0xba,0x03,0x00,0x70,0x00,
+0xf0,0x1e,0xf4,0x00,0xc6,0x05,0xf1,0x00,0x0f,0x50,0x0e,0x80,0x5f,0x20,0x00,0xfa,
+0x77,0xf7,0x04,0xf2,0x00,0x0f,0xdc,0xcf,0x70,0x4f,0xee,0x70,0xf5,0x00,0xf7,0x05,
+0xf7,0x52,0x0f,0x50,0x0f,0x70,0x5f,0x10,0x00,0xff,0xff,0xf5,0x05,0xf1,0x00,0xd6,
+0x00,0x15,0x3e,0x56,0x02,0x02,0xca,0x04,0x42,0x04,0x55,0x55,0x59,0x9a,0x03,0x11,
+0x6f,0x06,0x00,0x18,0x06,0x0d,0x00,0x15,0x01,0x6f,0x00,0x40,0xb3,0x00,0x94,0x04,
+0x68,0x00,0x10,0x0d,0x68,0x00,0xf0,0x04,0xf5,0x00,0xe7,0x05,0xf2,0x00,0x0f,0xff,
+0xff,0x70,0x4f,0x20,0x00,0xf8,0x44,0xf7,0x04,0xfc,0xb5,0x68,0x00,0xe1,0x4f,0xa9,
+0x30,0xf7,0x44,0xf6,0x04,0xf2,0x00,0x0d,0xff,0xfe,0x30,0x4f,0x50,0x04,0x30,0x04,
+0xf1,0x00,0xc7,0x01,0x81,0x4f,0x10,0x00,0x09,0xd0,0x00,0x02,0xb0,0x2a,0x05,0x00,
+0x98,0x03,0xd0,0xd1,0x00,0x11,0x10,0x00,0x00,0x8f,0xff,0xff,0xff,0x20,0x00,0x00,
+0xcb,0x03,0x04,0x68,0x00,0x42,0xe5,0x00,0xb6,0x04,0xd0,0x00,0x51,0x4f,0x20,0x00,
+0xfb,0x89,0xd0,0x00,0xf0,0x02,0xdb,0xbf,0x70,0x4f,0xff,0x80,0xf5,0x00,0xf7,0x04,
+0xf6,0x41,0x0f,0x72,0x2f,0x60,0x4f,0x7d,0x03,0x40,0xf4,0x04,0xf1,0x00,0x45,0x00,
+0xe0,0x2a,0x00,0x00,0x02,0x66,0x66,0x66,0x50,0x00,0x00,0x9e,0xfe,0xee,0xff,0x2d,
+0x02,0x61,0x11,0x17,0xf0,0x00,0x00,0xaf,0xdd,0x00,0xf7,0x03,0x0b,0xc1,0x11,0x11,
+0x00,0x00,0x00,0xaf,0xee,0xef,0xff,0x30,0x00,0x01,0x56,0x55,0x55,0x40,0x68,0x00,
+0x1f,0x03,0x68,0x00,0x1a,0xf0,0x11,0x2b,0x00,0x00,0x16,0x66,0x42,0x66,0x60,0x00,
 0x04,0xdd,0xee,0x5c,0xdf,0x30,0x00,0x03,0x39,0xf0,0x03,0xf3,0x00,0x05,0xff,0xfd,
-0xdd,0x3a,0x20,0x10,0x00,0x0d,0x00,0x40,0xfe,0xef,0x80,0x3f,0xdb,0x1e,0x34,0x41,
-0x00,0x40,0xa0,0x01,0x12,0xf5,0xa0,0x01,0x11,0x60,0x38,0x01,0x43,0xf6,0x11,0xe7,
-0x04,0x38,0x01,0x90,0x86,0x20,0xf7,0x33,0xf7,0x04,0xfe,0xd7,0x0f,0x05,0x0b,0x10,
-0x20,0xa0,0x01,0x12,0x04,0xa0,0x01,0x23,0x4f,0x10,0x3c,0x32,0x00,0x3e,0x42,0x10,
-0xa1,0x9b,0x43,0x70,0x32,0x5e,0xd0,0x00,0x00,0x7f,0x10,0x89,0x3b,0x21,0x07,0xf2,
-0x86,0x3b,0x30,0x1e,0xd7,0x68,0xda,0x09,0x33,0x29,0xcd,0xb7,0xf8,0x22,0xf3,0x01,
-0x43,0x10,0x06,0x06,0xd0,0x7e,0xf7,0x04,0xf1,0x7e,0x07,0xef,0x70,0x4f,0x17,0xe0,
-0x0b,0x00,0xa0,0xdb,0xcf,0x17,0xe2,0x8e,0xfb,0x8a,0xf1,0x7f,0xff,0x16,0x00,0xf2,
-0x06,0xe1,0x8e,0xf7,0x05,0xf0,0x7e,0x07,0xee,0x81,0x6f,0x06,0xe0,0x7e,0xdf,0xff,
-0xe0,0x6e,0x07,0xe0,0x11,0x10,0xf0,0x17,0x20,0x6e,0x07,0x2b,0x24,0x01,0x0b,0x00,
-0x36,0x4b,0x06,0xe0,0xc0,0x09,0xf6,0x1e,0x1d,0x60,0x3e,0x07,0xd0,0xe7,0xe7,0x05,
-0xf0,0x7e,0x0e,0x8f,0xa5,0x8f,0x07,0xe0,0xd8,0xff,0xef,0xf0,0x6f,0xef,0x8e,0x60,
-0x6f,0x06,0xf5,0xe8,0xe6,0x06,0xf0,0x6f,0x0d,0x8e,0xfe,0xee,0x06,0xf0,0xe8,0x25,
-0x55,0x20,0x4c,0x0c,0x60,0xa6,0x28,0x65,0x30,0x02,0x55,0x54,0x45,0xf6,0xe3,0x55,
-0x12,0x01,0x0b,0x00,0x01,0x4c,0x02,0x12,0x61,0x01,0x25,0x30,0x04,0x00,0x01,0x9a,
-0x1a,0x70,0x50,0x07,0xe0,0x06,0xf0,0x1f,0x60,0x06,0x00,0xf4,0x04,0x0f,0x60,0x07,
-0xf0,0x06,0xf0,0x0f,0xdb,0xbd,0xe2,0x59,0xf0,0x0f,0xb8,0x8c,0xe7,0xff,0xf0,0x0f,
-0x18,0x00,0x00,0x06,0x00,0x50,0x70,0x08,0xe0,0x06,0xf1,0x6d,0x3e,0x53,0x05,0xf1,
-0x00,0x23,0x32,0x70,0x20,0x12,0x05,0x35,0x2d,0x03,0xd0,0x1a,0x07,0xaa,0x3f,0xf0,
-0x0d,0x0a,0x50,0x09,0x40,0x08,0xe0,0xe7,0x00,0xd8,0x00,0x8f,0x0f,0x70,0x0d,0x80,
-0x07,0xf0,0xff,0xff,0xf8,0x13,0x9f,0x0f,0x94,0x4f,0x7b,0xff,0xe0,0x53,0x08,0x50,
-0x8e,0x0e,0x94,0x4f,0x70,0xe7,0x21,0x1f,0xe4,0x70,0x09,0x1a,0x70,0x20,0x0c,0x60,
-0x0a,0x50,0x0d,0x80,0x58,0x00,0xf2,0x0c,0xd8,0x0f,0xc9,0x9f,0x80,0x0d,0x80,0xfc,
-0xa9,0xf7,0xdf,0xf8,0x0e,0x70,0x0e,0x72,0x3d,0x80,0xe9,0x33,0xf7,0x00,0xd8,0x0b,
-0xff,0xfe,0x30,0xa1,0x1c,0x13,0x42,0x41,0x39,0x00,0x2f,0x2c,0x00,0x38,0x05,0x31,
-0x4f,0x80,0x00,0x39,0x20,0x21,0x0f,0x80,0x38,0x05,0x18,0xee,0x38,0x05,0x60,0x32,
-0xd6,0x00,0xc7,0x00,0xc9,0x57,0x00,0xf0,0x01,0xc9,0xfa,0x56,0xe8,0x00,0xc9,0xfe,
-0xed,0xf7,0xaf,0xf9,0xe7,0x00,0xe7,0x25,0xd9,0xad,0x00,0x10,0xc9,0x38,0x42,0x60,
-0xd9,0x14,0x44,0x30,0x00,0xa6,0x60,0x07,0x21,0x30,0x00,0x8a,0x52,0x50,0xf7,0x11,
-0x11,0xf8,0x01,0x69,0x13,0x20,0x01,0xf6,0xdb,0x05,0x01,0xf0,0x0e,0x04,0x36,0x18,
-0x60,0x11,0xc5,0x00,0xc5,0x00,0xab,0x1c,0x05,0xf0,0x0d,0xab,0xfa,0x67,0xf7,0x00,
-0xab,0xfe,0xdc,0xf7,0xbf,0xfb,0xe7,0x00,0xf6,0x13,0xbb,0xe8,0x22,0xf6,0x00,0xab,
-0xcf,0xff,0xf3,0x00,0xbb,0x01,0x11,0xfe,0x0b,0x10,0x91,0x31,0x18,0x10,0xf5,0x20,
-0x18,0x10,0xf8,0x30,0x18,0x42,0xff,0xff,0xfe,0xf9,0x0f,0x00,0x01,0xf1,0x32,0x02,
-0x70,0x0b,0x00,0xb0,0x25,0xf0,0x22,0x10,0x06,0x06,0xe0,0xe7,0xf7,0x04,0xf1,0x7f,
-0x0f,0x7f,0x70,0x4f,0x16,0xf0,0xf7,0xf7,0x04,0xf1,0x6f,0x0f,0x7f,0xdb,0xcf,0x69,
-0xf0,0xf6,0xfb,0x8a,0xfe,0xff,0x0f,0x6f,0x70,0x4f,0x06,0xf0,0xf6,0xf7,0x05,0xf0,
-0x6f,0x0f,0x6e,0x81,0x6f,0x06,0xf0,0xf6,0x10,0x0a,0x20,0x0e,0x60,0x60,0x02,0x0b,
-0xb0,0x25,0x26,0x4a,0x0d,0xec,0x40,0x60,0x05,0x1a,0x50,0x2b,0x05,0xf0,0x60,0x02,
-0x80,0x5f,0x0e,0x7f,0x94,0x8f,0x04,0xf1,0xe7,0x73,0x07,0xf1,0x02,0x1e,0x7e,0x60,
-0x6f,0x47,0xf1,0xe7,0xe8,0x38,0xf0,0x4f,0x1e,0x7c,0xff,0xfc,0x04,0xf1,0xec,0x3b,
-0xf1,0x03,0x05,0x20,0x06,0xde,0xee,0xee,0xe3,0x00,0x26,0x76,0x66,0x7f,0x50,0x00,
-0x33,0x33,0x35,0xf5,0xd3,0x15,0x22,0x20,0x08,0x8c,0x23,0x40,0xee,0xff,0xff,0xa0,
-0xdb,0x2e,0x11,0x41,0xa8,0x01,0x00,0x00,0x02,0x10,0x0e,0xa8,0x01,0xf1,0x01,0x01,
-0xe8,0x0f,0x70,0x0d,0x8e,0xff,0x80,0xff,0xff,0xf8,0x12,0xe8,0x0f,0x94,0x4f,0x88,
-0x06,0x90,0xf7,0x79,0xf8,0x0e,0x94,0x4f,0x79,0xbf,0x80,0x00,0x02,0x04,0xd1,0x32,
-0x40,0x64,0x00,0x00,0xe7,0xe4,0x09,0x23,0x05,0x20,0xff,0x25,0x33,0xa1,0x11,0x11,
-0xfd,0x1f,0x14,0x01,0x00,0x02,0x10,0x00,0x00,0x02,0x10,0x0c,0x58,0x00,0xf0,0x03,
-0x24,0xe8,0x0f,0xa6,0x6e,0x8d,0xff,0x80,0xfe,0xdd,0xf7,0x00,0xd8,0x0e,0x70,0x0e,
-0x76,0x8e,0x00,0x02,0x26,0x8a,0xf8,0x00,0x02,0x1f,0x52,0x00,0x02,0x15,0x11,0x12,
-0x52,0x44,0x00,0xbd,0x36,0x11,0xa0,0x1f,0x05,0x12,0xbb,0xec,0x13,0x00,0x2c,0x05,
-0x31,0x44,0x44,0xcb,0x99,0x16,0x01,0x1a,0x00,0x31,0x55,0x54,0xca,0xea,0x1a,0x01,
-0x72,0x44,0x28,0x04,0x60,0x66,0x1e,0x10,0xe5,0xb0,0x25,0x11,0xfe,0x50,0x38,0x11,
-0x14,0xf9,0x2b,0x21,0x07,0xf0,0x85,0x2d,0x11,0x7f,0xa3,0x34,0x50,0x07,0xfe,0xee,
-0xef,0xe0,0xae,0x1e,0x22,0x10,0x7e,0x60,0x09,0x00,0x3a,0x37,0x30,0x3a,0xe3,0x31,
-0x83,0x0e,0x51,0xae,0x44,0x44,0x30,0xae,0xf6,0x12,0x0f,0xb0,0x25,0x23,0x30,0xd0,
-0x00,0x05,0x9d,0x04,0x32,0x44,0x44,0x9e,0x5b,0x00,0x11,0xe0,0x92,0x1e,0x00,0x68,
-0x00,0x40,0xf6,0x55,0x5a,0xe0,0xae,0x16,0x24,0xfe,0xe9,0x07,0x14,0x20,0x36,0x66,
-0x21,0x0b,0x10,0x08,0xa1,0x46,0x20,0xdd,0xc0,0xf7,0x00,0x0d,0x92,0x2c,0x15,0xe1,
-0xee,0x29,0x13,0x90,0x26,0x14,0x00,0x47,0x32,0x11,0x27,0x35,0x0a,0x10,0x6e,0x19,
-0x00,0x00,0x8d,0x03,0x10,0x8e,0x6d,0x00,0x00,0x04,0x16,0x10,0x9e,0xf8,0x32,0x23,
-0xff,0xea,0x4e,0x0a,0x00,0xd1,0x09,0x30,0xff,0xfd,0x14,0xb9,0x09,0x18,0x32,0x76,
-0x17,0x00,0x33,0x03,0x14,0x6f,0x76,0x17,0x3b,0xdb,0x11,0x11,0x88,0x2d,0x02,0x30,
-0x01,0x11,0x7f,0x60,0x00,0x02,0xc7,0x00,0x02,0xd6,0x17,0x02,0xc6,0x00,0x12,0x7f,
-0x23,0x07,0x20,0x4b,0xd5,0xd9,0x2f,0x23,0x19,0xd1,0xd4,0x2c,0x74,0xfe,0x14,0x33,
-0x33,0x53,0x33,0x42,0xf6,0x24,0x21,0x0b,0xf1,0x31,0x07,0x10,0xfd,0xa2,0x1f,0x32,
-0xf8,0x2d,0xe3,0x39,0x0b,0x10,0x60,0xea,0x04,0x20,0x04,0x30,0xe8,0x2d,0x11,0x38,
-0xfc,0x0a,0x21,0x07,0xe0,0xc9,0x17,0x12,0x9f,0xc9,0x0a,0x00,0xfe,0x15,0x01,0x62,
-0x00,0x20,0x08,0xe5,0x52,0x09,0x00,0xc9,0x00,0x15,0xfb,0xd3,0x37,0x00,0xa6,0x33,
-0x8e,0xee,0x13,0x66,0x66,0xbf,0x66,0x55,0x40,0xc2,0x2d,0x0e,0xa0,0x33,0x03,0x74,
-0x2f,0x01,0x8a,0x01,0x31,0x11,0x11,0x7f,0x8a,0x01,0x00,0x62,0x00,0xb1,0x7f,0x22,
-0x22,0x8f,0x00,0x00,0x07,0xf5,0x55,0x49,0xf0,0x60,0x16,0x15,0xfa,0xe1,0x23,0x04,
-0x38,0x18,0x81,0x5f,0x95,0x55,0x30,0x00,0x13,0x01,0xf6,0x44,0x01,0x21,0x1f,0x50,
-0x8a,0x01,0x11,0x71,0x1c,0x2e,0x05,0xb0,0x15,0x14,0xa0,0x8a,0x01,0x4f,0x37,0x00,
-0x00,0x28,0x8a,0x01,0x0c,0x72,0x13,0x32,0x22,0x22,0x33,0x32,0xbf,0x60,0x0c,0xb0,
-0x11,0x18,0xe1,0x10,0x00,0x00,0xbd,0xde,0xfe,0xee,0x10,0x3e,0x23,0x41,0x8f,0x30,
-0x00,0x14,0xb6,0x24,0x0c,0xfc,0x36,0x04,0xd0,0x25,0x11,0x46,0x60,0x00,0x11,0xad,
-0x60,0x00,0x12,0xaf,0x9e,0x0b,0x01,0x60,0x00,0x11,0xad,0x60,0x00,0x10,0x7e,0x69,
-0x17,0x11,0x23,0x60,0x00,0x21,0xcf,0xff,0x64,0x2a,0x02,0x60,0x00,0x53,0x35,0x4a,
-0xf5,0x54,0x00,0x8c,0x0b,0x11,0xe9,0xda,0x0b,0x02,0x0c,0x00,0x15,0xe8,0xb2,0x33,
-0x10,0x30,0x98,0x0b,0x11,0x44,0x87,0x01,0x11,0x47,0x4e,0x01,0x21,0x08,0xd0,0x8a,
-0x01,0x12,0xae,0x8a,0x01,0x11,0xe0,0x5b,0x01,0x12,0x8d,0x8a,0x01,0x11,0xd0,0xc9,
-0x00,0x15,0xfa,0x15,0x18,0xc4,0xdd,0xdd,0xde,0xef,0xfe,0x02,0x56,0xdc,0x55,0x9f,
-0x54,0x30,0x65,0x2f,0x11,0xca,0xe6,0x26,0x12,0x0d,0x0d,0x00,0x36,0xb7,0x00,0x4e,
-0x84,0x01,0x05,0xca,0x03,0x12,0x0a,0xca,0x03,0x1e,0xab,0xca,0x03,0x2c,0x0a,0xb0,
-0xca,0x03,0x17,0x00,0x83,0x4a,0x25,0xee,0xee,0xd6,0x2e,0x13,0x40,0xfa,0x02,0x11,
-0x8e,0x10,0x01,0x02,0xae,0x0c,0x11,0x9e,0x10,0x01,0x11,0x9e,0x10,0x01,0x10,0x6e,
-0x10,0x01,0x72,0x12,0x21,0x11,0x11,0x12,0x21,0xcf,0xce,0x01,0x11,0x22,0xdf,0x0c,
-0xb0,0x47,0x66,0x66,0x77,0x00,0x00,0xae,0xfe,0xee,0xef,0x20,0xfa,0x02,0x02,0x26,
-0x26,0x02,0x70,0x1a,0x1e,0x00,0xae,0x24,0xa5,0x31,0x00,0x25,0x00,0x7d,0xf7,0x00,
+0x00,0x3f,0x30,0x00,0x6f,0x10,0x00,0x0d,0x00,0xb4,0xfe,0xef,0x80,0x3f,0x20,0x00,
+0x04,0x55,0x41,0x00,0x40,0xa0,0x01,0x12,0xf5,0xa0,0x01,0x11,0x60,0x38,0x01,0x43,
+0xf6,0x11,0xe7,0x04,0x38,0x01,0xe0,0x86,0x20,0xf7,0x33,0xf7,0x04,0xfe,0xd7,0x0f,
+0x40,0x0f,0x70,0x4f,0x20,0xa0,0x01,0x12,0x04,0xa0,0x01,0x12,0x4f,0xdb,0x05,0xf0,
+0x09,0x50,0x00,0x00,0x03,0xcf,0xff,0xa1,0x00,0x00,0x02,0xfb,0x32,0x5e,0xd0,0x00,
+0x00,0x7f,0x10,0x00,0x6f,0x20,0x00,0x07,0xf2,0x03,0x00,0xb2,0x00,0x1e,0xd7,0x68,
+0xfb,0x00,0x00,0x00,0x29,0xcd,0xb7,0xcf,0x00,0xf3,0x02,0x01,0x43,0x10,0x06,0x06,
+0xd0,0x7e,0xf7,0x04,0xf1,0x7e,0x07,0xef,0x70,0x4f,0x17,0xe0,0x0b,0x00,0xa0,0xdb,
+0xcf,0x17,0xe2,0x8e,0xfb,0x8a,0xf1,0x7f,0xff,0x16,0x00,0xf1,0x12,0xe1,0x8e,0xf7,
+0x05,0xf0,0x7e,0x07,0xee,0x81,0x6f,0x06,0xe0,0x7e,0xdf,0xff,0xe0,0x6e,0x07,0xe0,
+0x11,0x10,0x06,0xe0,0x7e,0x00,0x00,0x00,0x6e,0x07,0xe0,0x00,0x00,0x07,0x0b,0x00,
+0x35,0x4b,0x06,0xe0,0x22,0x02,0xf2,0x1e,0x02,0x1d,0x60,0x3e,0x07,0xd0,0xe7,0xe7,
+0x05,0xf0,0x7e,0x0e,0x8f,0xa5,0x8f,0x07,0xe0,0xd8,0xff,0xef,0xf0,0x6f,0xef,0x8e,
+0x60,0x6f,0x06,0xf5,0xe8,0xe6,0x06,0xf0,0x6f,0x0d,0x8e,0xfe,0xee,0x06,0xf0,0xe8,
+0x25,0x55,0x20,0x4c,0x0c,0xa1,0x02,0x01,0xd4,0x01,0x60,0x30,0x02,0x55,0x54,0x45,
+0xf6,0x0e,0x00,0x20,0x1f,0x60,0xa0,0x00,0x02,0x0b,0x00,0x01,0x4c,0x02,0x11,0x61,
+0x25,0x00,0xf0,0x00,0x40,0x04,0x00,0x01,0x50,0x05,0xf0,0x0f,0x50,0x07,0xe0,0x06,
+0xf0,0x1f,0x60,0x06,0x00,0xf4,0x04,0x0f,0x60,0x07,0xf0,0x06,0xf0,0x0f,0xdb,0xbd,
+0xe2,0x59,0xf0,0x0f,0xb8,0x8c,0xe7,0xff,0xf0,0x0f,0x18,0x00,0x00,0x06,0x00,0xe1,
+0x70,0x08,0xe0,0x06,0xf1,0x0e,0xff,0xff,0xc0,0x05,0xf1,0x00,0x23,0x32,0xe1,0x06,
+0x04,0xbb,0x06,0x27,0x06,0xf0,0xc7,0x06,0x02,0xb8,0x00,0xf3,0x1d,0x0a,0x50,0x09,
+0x40,0x08,0xe0,0xe7,0x00,0xd8,0x00,0x8f,0x0f,0x70,0x0d,0x80,0x07,0xf0,0xff,0xff,
+0xf8,0x13,0x9f,0x0f,0x94,0x4f,0x7b,0xff,0xe0,0xe7,0x00,0xf7,0x00,0x8e,0x0e,0x94,
+0x4f,0x70,0x07,0xe0,0xbf,0xff,0xe4,0x00,0x8e,0x8f,0x06,0xc0,0x55,0x00,0x00,0x8d,
+0x00,0x0c,0xb0,0x00,0x02,0x50,0x00,0xcb,0x13,0x00,0x20,0x0c,0xb1,0x3b,0x02,0x10,
+0xbf,0xe5,0x05,0x00,0xa1,0x02,0x11,0x10,0xd8,0x05,0x60,0x0c,0x60,0x0a,0x50,0x0d,
+0x80,0x58,0x00,0xf0,0x0e,0xd8,0x0f,0xc9,0x9f,0x80,0x0d,0x80,0xfc,0xa9,0xf7,0xdf,
+0xf8,0x0e,0x70,0x0e,0x72,0x3d,0x80,0xe9,0x33,0xf7,0x00,0xd8,0x0b,0xff,0xfe,0x30,
+0x0d,0x80,0x2c,0x00,0x31,0x42,0x00,0x2e,0x76,0x06,0x40,0x56,0x66,0x55,0xf8,0x38,
+0x05,0x20,0x4f,0x80,0x38,0x05,0x41,0xf4,0x00,0x0f,0x80,0x38,0x05,0x18,0xee,0x38,
+0x05,0x60,0x32,0xd6,0x00,0xc7,0x00,0xc9,0x57,0x00,0xf0,0x04,0xc9,0xfa,0x56,0xe8,
+0x00,0xc9,0xfe,0xed,0xf7,0xaf,0xf9,0xe7,0x00,0xe7,0x25,0xd9,0xe7,0x00,0xf7,0xe0,
+0x05,0x80,0xf5,0x00,0xd9,0x14,0x44,0x30,0x00,0xa6,0x60,0x07,0x10,0x30,0x48,0x00,
+0x60,0xf7,0x01,0xf7,0x11,0x11,0xf8,0x59,0x01,0x10,0xe8,0x05,0x00,0x10,0xe7,0x14,
+0x00,0x61,0xf6,0x00,0x13,0x44,0x43,0x20,0x30,0x05,0x50,0xc5,0x00,0xc5,0x00,0xab,
+0x1c,0x05,0xf1,0x24,0xab,0xfa,0x67,0xf7,0x00,0xab,0xfe,0xdc,0xf7,0xbf,0xfb,0xe7,
+0x00,0xf6,0x13,0xbb,0xe8,0x22,0xf6,0x00,0xab,0xcf,0xff,0xf3,0x00,0xbb,0x01,0x11,
+0x00,0x00,0x55,0x00,0x91,0x00,0x00,0x64,0x00,0xf5,0x00,0x00,0xc9,0x00,0xf8,0x55,
+0x55,0xd9,0x00,0xff,0xff,0xfe,0xf9,0x0f,0x00,0x00,0x50,0x00,0x60,0xf8,0x00,0x34,
+0x44,0x44,0x30,0xc0,0x01,0xf0,0x2a,0x04,0x13,0x10,0x06,0x06,0xe0,0xe7,0xf7,0x04,
+0xf1,0x7f,0x0f,0x7f,0x70,0x4f,0x16,0xf0,0xf7,0xf7,0x04,0xf1,0x6f,0x0f,0x7f,0xdb,
+0xcf,0x69,0xf0,0xf6,0xfb,0x8a,0xfe,0xff,0x0f,0x6f,0x70,0x4f,0x06,0xf0,0xf6,0xf7,
+0x05,0xf0,0x6f,0x0f,0x6e,0x81,0x6f,0x06,0xf0,0xf6,0xdf,0xff,0xe0,0x6f,0x0e,0x60,
+0x60,0x02,0x70,0xe6,0x00,0x00,0x00,0x7e,0x0e,0x70,0x60,0x02,0x00,0xf4,0x05,0x34,
+0x4a,0x0d,0x60,0xa7,0x01,0x70,0x03,0x05,0x1a,0x50,0x2b,0x05,0xf0,0x60,0x02,0x80,
+0x5f,0x0e,0x7f,0x94,0x8f,0x04,0xf1,0xe7,0x73,0x07,0xf0,0x03,0x1e,0x7e,0x60,0x6f,
+0x47,0xf1,0xe7,0xe8,0x38,0xf0,0x4f,0x1e,0x7c,0xff,0xfc,0x04,0xf1,0xe7,0xdf,0x01,
+0xf0,0x05,0x05,0x20,0x06,0xde,0xee,0xee,0xe3,0x00,0x26,0x76,0x66,0x7f,0x50,0x00,
+0x33,0x33,0x35,0xf5,0x00,0x7f,0x3f,0x04,0x02,0x57,0x08,0x20,0x7f,0xee,0x37,0x08,
+0x41,0x55,0x55,0x55,0x41,0xa8,0x01,0x00,0x00,0x02,0x10,0x0e,0xa8,0x01,0xf1,0x01,
+0x01,0xe8,0x0f,0x70,0x0d,0x8e,0xff,0x80,0xff,0xff,0xf8,0x12,0xe8,0x0f,0x94,0x4f,
+0x88,0x06,0x90,0xf7,0x79,0xf8,0x0e,0x94,0x4f,0x79,0xbf,0x80,0x00,0x02,0x01,0x16,
+0x07,0x70,0x0e,0x70,0x00,0x64,0x00,0x00,0xe7,0xe4,0x09,0x40,0x05,0x20,0x00,0xda,
+0x13,0x00,0x41,0x0d,0xa1,0x11,0x11,0x24,0x05,0x11,0xfe,0x6e,0x08,0x02,0x96,0x03,
+0x00,0x00,0x02,0x10,0x0c,0x58,0x00,0xf0,0x03,0x24,0xe8,0x0f,0xa6,0x6e,0x8d,0xff,
+0x80,0xfe,0xdd,0xf7,0x00,0xd8,0x0e,0x70,0x0e,0x76,0x8e,0x00,0x02,0x26,0x8a,0xf8,
+0x00,0x02,0x1f,0x52,0x00,0x02,0x15,0x50,0x12,0x00,0x00,0x22,0x00,0x1f,0x05,0x21,
+0x0b,0xa0,0x1f,0x05,0x21,0xbb,0x00,0x72,0x07,0x00,0x2c,0x05,0x72,0x44,0x44,0xcb,
+0x00,0x00,0x0a,0xc0,0x1a,0x00,0xa0,0x55,0x54,0xca,0x00,0x00,0x06,0xef,0xff,0xfe,
+0x60,0x5a,0x04,0x17,0x60,0x78,0x0a,0xf1,0x01,0x5c,0xe5,0x55,0x65,0x0a,0xff,0xfe,
+0xee,0xee,0xef,0xd0,0x00,0x14,0x00,0x00,0x13,0xee,0x09,0x11,0x06,0x10,0x0a,0x80,
+0x55,0xae,0x00,0x00,0x07,0xfe,0xee,0xef,0x0d,0x00,0x31,0x11,0x10,0x7e,0x60,0x09,
+0x00,0xa8,0x09,0xff,0x03,0x02,0x3a,0xe3,0x31,0x00,0x01,0x44,0x44,0xae,0x44,0x44,
+0x30,0xae,0xee,0xee,0xee,0xee,0xed,0x78,0x0a,0x22,0x40,0x06,0xd0,0x00,0x05,0x9d,
+0x04,0x31,0x44,0x44,0x9e,0x5b,0x00,0x00,0x85,0x0a,0x11,0x7e,0x03,0x00,0x30,0x07,
+0xf6,0x55,0x2a,0x0a,0x60,0x4d,0xef,0xfe,0xe9,0x00,0x00,0x6e,0x0b,0x40,0x00,0x00,
+0x36,0x66,0x21,0x0b,0x91,0x08,0xee,0xed,0xdd,0xdd,0xdd,0xc0,0x00,0x12,0x41,0x00,
+0x12,0x09,0x6d,0x04,0x12,0x9e,0x0d,0x00,0x23,0xe1,0x11,0x16,0x06,0x00,0x65,0x07,
+0x10,0x23,0xe9,0x09,0x51,0x00,0x36,0x00,0x00,0x27,0x35,0x0a,0x10,0x6e,0x19,0x00,
+0x00,0x8d,0x03,0x11,0x8e,0x6d,0x00,0xa3,0x8e,0x55,0x55,0x9e,0x00,0x00,0x5e,0xef,
+0xff,0xea,0x4e,0x0a,0x00,0xd1,0x09,0x30,0xff,0xfd,0x14,0xb9,0x09,0x10,0x32,0xa8,
+0x09,0x11,0x55,0xbd,0x03,0x20,0xff,0x30,0x33,0x03,0x23,0x6f,0x30,0xc0,0x09,0x11,
+0xdb,0x0f,0x06,0x20,0xcf,0xee,0x99,0x01,0x11,0x15,0xae,0x09,0x02,0x30,0x01,0x11,
+0x7f,0x60,0x00,0x02,0xc7,0x00,0x11,0x7f,0x66,0x00,0x02,0xc6,0x00,0x12,0x7f,0x23,
+0x07,0xa1,0x4b,0xd5,0x42,0x00,0x00,0x00,0x19,0xd1,0x11,0x10,0x14,0x0a,0x83,0xfe,
+0x14,0x33,0x33,0x53,0x33,0x42,0x00,0x86,0x04,0x21,0x0b,0xf1,0x31,0x07,0x82,0xfd,
+0x10,0x00,0x00,0x07,0xf8,0x2d,0xe3,0x39,0x0b,0x10,0x60,0xea,0x04,0x71,0x04,0x30,
+0x00,0x38,0x00,0x00,0x38,0xfc,0x0a,0x00,0x62,0x05,0x42,0x8f,0x55,0x55,0x9f,0xc9,
+0x0a,0x10,0xf0,0xfc,0x0a,0x00,0x62,0x00,0x20,0x08,0xe5,0x52,0x09,0x00,0xc9,0x00,
+0x14,0xfb,0x55,0x01,0xd5,0x9d,0xdd,0xdd,0xdd,0xee,0xee,0x13,0x66,0x66,0xbf,0x66,
+0x55,0x40,0x38,0x0b,0x18,0x8e,0x30,0x01,0x2c,0x7c,0x00,0x01,0x00,0x22,0x06,0xe0,
+0x8a,0x01,0x31,0x11,0x11,0x7f,0x8a,0x01,0x00,0x62,0x00,0xe0,0x7f,0x22,0x22,0x8f,
+0x00,0x00,0x07,0xf5,0x55,0x49,0xf0,0x00,0x00,0x4e,0xb5,0x09,0x03,0x01,0x00,0x11,
+0x9f,0x02,0x0c,0xb1,0x02,0x55,0x55,0x5f,0x95,0x55,0x30,0x00,0x13,0x01,0xf6,0x44,
+0x01,0x01,0xa1,0x05,0x11,0x9e,0x38,0x0b,0x52,0x09,0xe2,0x11,0x11,0x20,0x8a,0x01,
+0x14,0xa0,0x8a,0x01,0x4f,0x37,0x00,0x00,0x28,0x8a,0x01,0x0c,0x72,0x13,0x32,0x22,
+0x22,0x33,0x32,0xbf,0x60,0x0c,0xf1,0x07,0x11,0x18,0xe1,0x10,0x00,0x00,0xbd,0xde,
+0xfe,0xee,0x10,0x00,0x46,0x66,0x66,0x8f,0x30,0x00,0x14,0x44,0x44,0x7f,0x8a,0x01,
+0x22,0xfe,0x10,0x64,0x03,0x01,0x8a,0x01,0x11,0x70,0x8a,0x01,0x31,0x10,0x00,0x46,
+0x60,0x00,0x11,0xad,0x60,0x00,0x12,0xaf,0x9e,0x0b,0x01,0x60,0x00,0x11,0xad,0x60,
+0x00,0x61,0x7e,0xef,0xfe,0xea,0x00,0x23,0x60,0x00,0x10,0xcf,0x60,0x00,0x13,0xfb,
+0x60,0x00,0x53,0x35,0x4a,0xf5,0x54,0x00,0x8c,0x0b,0x11,0xe9,0xda,0x0b,0x02,0x0c,
+0x00,0x11,0xe8,0x60,0x00,0x50,0xef,0xee,0xee,0xef,0x30,0x98,0x0b,0x11,0x44,0x87,
+0x01,0x11,0x47,0x4e,0x01,0x21,0x08,0xd0,0x8a,0x01,0x12,0xae,0x8a,0x01,0x11,0xe0,
+0x5b,0x01,0x12,0x8d,0x8a,0x01,0x11,0xd0,0xc9,0x00,0x05,0x28,0x01,0xf1,0x01,0x8e,
+0xdd,0xdd,0xde,0xef,0xfe,0x02,0x56,0xdc,0x55,0x9f,0x54,0x30,0x00,0x0c,0xa0,0xf0,
+0x01,0x40,0xca,0x00,0x5f,0x10,0x0e,0x0e,0x01,0x0d,0x00,0x36,0xb7,0x00,0x4e,0x84,
+0x01,0x05,0xca,0x03,0x12,0x0a,0xca,0x03,0x1e,0xab,0xca,0x03,0x2c,0x0a,0xb0,0xca,
+0x03,0x07,0x01,0x00,0x80,0x8e,0xee,0xee,0xdd,0xde,0xed,0x03,0x66,0x01,0x00,0x13,
+0x40,0xfa,0x02,0x11,0x8e,0x10,0x01,0x02,0xae,0x0c,0x11,0x9e,0x10,0x01,0x11,0x9e,
+0x10,0x01,0x10,0x6e,0x10,0x01,0x72,0x12,0x21,0x11,0x11,0x12,0x21,0xcf,0xce,0x01,
+0x11,0x22,0xdf,0x0c,0xb0,0x47,0x66,0x66,0x77,0x00,0x00,0xae,0xfe,0xee,0xef,0x20,
+0xfa,0x02,0x41,0x7f,0x30,0x00,0xef,0xfa,0x02,0x11,0xea,0xfa,0x02,0x11,0xdf,0x93,
+0x04,0x42,0x25,0x55,0x54,0x44,0x72,0x00,0xa5,0x31,0x00,0x25,0x00,0x7d,0xf7,0x00,
 0x7f,0x00,0x7e,0x05,0x00,0xe2,0x7f,0xff,0xee,0xff,0x00,0x7f,0xfa,0x55,0xaf,0x00,
 0x7f,0xe8,0x00,0x7e,0x05,0x00,0x11,0x7e,0x05,0x00,0x82,0xdf,0xff,0xfc,0x00,0x7e,
 0x12,0x23,0x20,0x8b,0x02,0x06,0x05,0x00,0x11,0x5c,0x73,0x05,0x50,0xa5,0x00,0x95,
-0x00,0xe8,0xc3,0x06,0x20,0xe8,0xf7,0x05,0x00,0x10,0xff,0xb3,0x15,0x31,0xf9,0x44,
-0xf8,0xdb,0x0f,0x75,0x00,0xe8,0xe9,0x44,0xf7,0x00,0xe7,0x6f,0x05,0x10,0xf7,0xdb,
-0x0f,0x10,0xf7,0xd6,0x0f,0x13,0x51,0x50,0x2f,0x03,0xdb,0x0f,0x12,0xfa,0xe1,0x06,
-0x00,0xf3,0x0c,0x06,0x6b,0x07,0xc0,0xd9,0x0f,0xa6,0x6e,0x80,0x0d,0x90,0xfe,0xdd,
-0xf8,0x00,0xd9,0xa3,0x0b,0x2f,0x0d,0x90,0x6b,0x07,0x09,0x10,0x03,0x6b,0x05,0x11,
-0x03,0x6b,0x05,0x11,0x3f,0x43,0x1e,0x40,0xff,0xef,0xff,0xfe,0xff,0x3c,0x23,0x54,
-0x20,0x6c,0x0e,0xf5,0x04,0x01,0x03,0x02,0x03,0x05,0xe0,0x00,0x6d,0x3f,0x3f,0x0e,
-0x55,0xe0,0x00,0x6e,0x3f,0x4f,0x0f,0x65,0x07,0x00,0xf1,0x08,0x6f,0xef,0x3f,0xef,
-0x65,0xf3,0x20,0x6f,0x8f,0x3f,0x6f,0x55,0xff,0xe0,0x6f,0x3f,0x3f,0x1f,0x55,0xe0,
-0x00,0x6f,0x4f,0x07,0x00,0x30,0x5f,0x4f,0x2f,0x07,0x00,0xd8,0x4f,0xff,0x1f,0xff,
-0x45,0xe0,0x00,0x03,0x43,0x03,0x44,0x05,0xe0,0x42,0x0f,0x04,0xe9,0x13,0x18,0xf0,
-0xd5,0x0e,0xf4,0x20,0x05,0x10,0x02,0xc1,0xb2,0xb1,0xd0,0xe6,0x00,0x4f,0x2f,0x6f,
-0x2f,0x1d,0x70,0x04,0xf6,0xf6,0xf6,0xf1,0xd7,0x00,0x3f,0xff,0x6f,0xff,0x1d,0xff,
-0x93,0xf3,0xf5,0xf3,0xf1,0xd9,0x41,0x3f,0x6f,0x5f,0x6f,0x1d,0x70,0x01,0xdf,0xd2,
-0xdf,0xd0,0xd7,0xc6,0x4e,0x03,0x65,0x28,0x50,0x16,0x66,0x65,0x6f,0x60,0x65,0x19,
-0x24,0x45,0xf6,0xee,0x14,0x03,0x0f,0x04,0x02,0xf1,0x06,0x05,0xf2,0x06,0xf0,0x04,
-0x00,0x01,0x41,0x30,0x60,0x40,0x60,0x5f,0x6e,0x3f,0x3f,0x0f,0x45,0xf6,0xe3,0xf4,
+0x00,0xe8,0xc3,0x06,0x20,0xe8,0xf7,0x05,0x00,0x00,0x3f,0x06,0x60,0xe8,0xf9,0x44,
+0xf8,0x00,0xe8,0x87,0x06,0x65,0xe8,0xe9,0x44,0xf7,0x00,0xe7,0x6f,0x05,0x50,0xf7,
+0x00,0x72,0x00,0x00,0xc0,0x0b,0x41,0x00,0x51,0x00,0xf7,0x11,0x00,0x00,0xf9,0x03,
+0x90,0xef,0xff,0xff,0xfa,0x00,0x13,0x33,0x33,0x30,0xf0,0x1d,0x00,0x00,0x00,0x00,
+0x21,0x0c,0x60,0x0a,0x50,0x0d,0x80,0xe7,0x00,0xd8,0x00,0xd9,0x0f,0xa6,0x6e,0x80,
+0x0d,0x90,0xfe,0xdd,0xf8,0x00,0xd9,0x0e,0x70,0x0e,0x70,0x0d,0x90,0xe9,0x33,0xf7,
+0x00,0xd8,0x0b,0xff,0xfe,0x30,0x0d,0x80,0x2c,0x00,0xf0,0x1a,0x42,0x00,0x2e,0xff,
+0xff,0xff,0x60,0x00,0x56,0x66,0x55,0xf8,0x00,0x03,0x44,0x44,0x4f,0x80,0x03,0xff,
+0xff,0xff,0xf4,0x00,0x3f,0x40,0x00,0x00,0x00,0x02,0xff,0xef,0xff,0xfe,0x00,0x03,
+0x55,0x55,0x54,0x20,0x00,0x01,0x00,0xf5,0x06,0x20,0x00,0x01,0x03,0x02,0x03,0x05,
+0xe0,0x00,0x6d,0x3f,0x3f,0x0e,0x55,0xe0,0x00,0x6e,0x3f,0x4f,0x0f,0x65,0x07,0x00,
+0xf1,0x08,0x6f,0xef,0x3f,0xef,0x65,0xf3,0x20,0x6f,0x8f,0x3f,0x6f,0x55,0xff,0xe0,
+0x6f,0x3f,0x3f,0x1f,0x55,0xe0,0x00,0x6f,0x4f,0x07,0x00,0x30,0x5f,0x4f,0x2f,0x07,
+0x00,0xd1,0x4f,0xff,0x1f,0xff,0x45,0xe0,0x00,0x03,0x43,0x03,0x44,0x05,0xe0,0x53,
+0x00,0x28,0x05,0xf0,0x07,0x00,0x33,0x04,0xf0,0x00,0x69,0x00,0x01,0x15,0x00,0xf1,
+0x1f,0x10,0x02,0xc1,0xb2,0xb1,0xd0,0xe6,0x00,0x4f,0x2f,0x6f,0x2f,0x1d,0x70,0x04,
+0xf6,0xf6,0xf6,0xf1,0xd7,0x00,0x3f,0xff,0x6f,0xff,0x1d,0xff,0x93,0xf3,0xf5,0xf3,
+0xf1,0xd9,0x41,0x3f,0x6f,0x5f,0x6f,0x1d,0x70,0x01,0xdf,0xd2,0xdf,0xd0,0xd7,0x34,
+0x00,0x41,0x03,0x10,0x00,0x06,0xc1,0x00,0xf2,0x06,0x00,0x16,0x66,0x65,0x6f,0x60,
+0x00,0x00,0x44,0x44,0x45,0xf6,0x00,0x00,0x8f,0xff,0xff,0xff,0x30,0x00,0x08,0x5f,
+0x00,0xb1,0x7f,0xee,0xff,0xff,0xa0,0x00,0x00,0x55,0x55,0x55,0x41,0x10,0x00,0xf0,
+0x03,0x01,0x41,0x30,0x60,0x40,0x60,0x5f,0x6e,0x3f,0x3f,0x0f,0x45,0xf6,0xe3,0xf4,
 0xf0,0xf4,0x5f,0xd2,0x00,0xf0,0x03,0x45,0xf6,0xfc,0xf3,0xfb,0xf4,0x5f,0x6f,0xaf,
 0x3f,0x9f,0x45,0xf6,0xf3,0xf3,0xf1,0xf4,0x5f,0xd3,0x00,0xf6,0x03,0x45,0xf5,0xf4,
 0xf2,0xf2,0xf3,0x5f,0x5f,0xef,0x1f,0xef,0x35,0xf0,0x45,0x30,0x35,0x40,0x4f,0xb8,
-0x00,0x11,0x5e,0x0b,0x00,0x06,0xd9,0x20,0x51,0x25,0x00,0x00,0x00,0xb6,0x3e,0x10,
-0x21,0x0d,0x90,0x74,0x1c,0x11,0xe8,0x0d,0x00,0x20,0x0f,0x70,0x22,0x0c,0x21,0x04,
-0xfb,0x7d,0x09,0xf0,0x02,0x9f,0xf1,0x00,0x6f,0xff,0x80,0x0e,0x9e,0x90,0x06,0xf5,
-0x51,0x07,0xf1,0x7f,0x10,0x6f,0xc8,0x41,0x00,0x7c,0x29,0x50,0x9d,0x00,0x05,0xf1,
-0x6f,0xcf,0x00,0x1f,0x02,0x3b,0x30,0x01,0x03,0x3a,0x03,0x00,0x97,0x1c,0x11,0x8a,
-0x3d,0x01,0x21,0x0a,0xc0,0x5b,0x03,0x10,0xda,0x58,0x05,0x00,0x85,0x4e,0x40,0x5f,
-0x65,0x20,0x0b,0x5e,0x58,0xd0,0xf8,0x05,0xf7,0xbf,0x30,0x5f,0x10,0x04,0xfa,0x00,
-0xbe,0x15,0xf1,0x3a,0x04,0x25,0x83,0x4f,0x94,0x4f,0x0f,0x85,0x16,0x17,0x00,0x34,
-0x0d,0x11,0x58,0x25,0x3b,0x21,0x09,0xd0,0x9b,0x29,0x40,0xcb,0x00,0x03,0xf2,0x57,
-0x5f,0x00,0x9b,0x29,0xf0,0x0a,0x07,0xff,0x30,0x03,0xf9,0x84,0x02,0xf8,0xcd,0x10,
-0x3f,0xdd,0x71,0xdc,0x01,0xdc,0x03,0xf2,0x00,0xbd,0x10,0x01,0xb4,0x3f,0x20,0x9e,
-0x00,0x00,0x27,0x00,0x10,0x5a,0xdf,0x4b,0x00,0x69,0x06,0x25,0x01,0x80,0x8c,0x05,
-0x14,0xe1,0x50,0x28,0x27,0xff,0x30,0xb3,0x48,0x11,0x01,0x52,0x36,0x21,0x03,0xf2,
-0x97,0x06,0x00,0x68,0x00,0x11,0xbc,0x54,0x40,0xf0,0x09,0x1f,0xd0,0x00,0x3f,0x97,
-0x40,0x08,0xff,0x80,0x03,0xfe,0xe9,0x04,0xf8,0x6f,0x50,0x3f,0x30,0x03,0xfb,0x00,
-0x7f,0x43,0xf3,0xdd,0x39,0x91,0x53,0x1c,0x10,0x00,0x03,0x80,0x00,0x00,0x90,0x13,
-0x06,0x20,0x2f,0x30,0xb4,0x05,0x32,0x57,0xf2,0x00,0xe1,0x08,0x01,0x88,0x0e,0x03,
-0x0d,0x00,0x08,0xdf,0x38,0x00,0xa2,0x34,0x11,0x57,0x61,0x0d,0x21,0x0a,0xc0,0x36,
-0x0c,0x11,0xda,0x0d,0x00,0xf0,0x09,0x2f,0xa0,0x00,0x4f,0x76,0x30,0x0a,0xff,0x40,
-0x04,0xff,0xf9,0x05,0xf6,0xbf,0x20,0x4f,0x10,0x03,0xfa,0x00,0xbe,0x14,0xf1,0xc6,
-0x12,0x11,0x83,0x5d,0x0c,0x20,0x23,0x11,0xb3,0x3a,0x01,0x33,0x23,0x40,0x03,0xfa,
-0x31,0x4d,0x98,0x06,0x01,0xe7,0x07,0x50,0x06,0xf6,0x00,0x1b,0xf1,0x33,0x23,0x26,
-0xef,0xf5,0xb4,0x4e,0x00,0x7b,0x47,0x60,0x00,0x0a,0x30,0x0d,0x60,0xe6,0x2d,0x0d,
-0x50,0x60,0xe6,0x00,0x1f,0x40,0x06,0x00,0xf1,0x20,0x2f,0x20,0x0f,0x60,0xe6,0x00,
-0x6f,0x50,0x0f,0x83,0xf6,0x00,0x9f,0xa0,0x0e,0xff,0xf6,0x00,0xfc,0xf1,0x0e,0x60,
-0xe6,0x07,0xe1,0xe7,0x0e,0x60,0xe6,0x1f,0x70,0x6e,0x0e,0x60,0xe6,0xac,0x00,0x0d,
-0x7e,0x60,0xe6,0x41,0x00,0x01,0x2e,0x60,0xe6,0x63,0x09,0x06,0x06,0x00,0x37,0x0a,
-0x40,0xd5,0xf7,0x04,0xf0,0x04,0x21,0x00,0x07,0x60,0x06,0xd0,0xd8,0x00,0x0c,0xa0,
-0x07,0xe0,0xd8,0x00,0x0f,0x90,0x06,0xf0,0xd9,0x6f,0x47,0xf3,0x0b,0xfe,0xf9,0x00,
-0xaf,0xf3,0x06,0xf5,0xd9,0x04,0xf4,0xad,0x16,0xf0,0xd8,0x2e,0x90,0x0c,0xa6,0xf0,
-0xd8,0x69,0x00,0x00,0x44,0xc0,0xc7,0x28,0x26,0x11,0x08,0x24,0x03,0x00,0x6b,0x0c,
-0x11,0xf7,0x12,0x00,0x1d,0xf6,0x06,0x00,0x13,0x61,0x89,0x03,0x08,0x60,0x00,0x1f,
-0x0e,0x60,0x00,0x0c,0x42,0x42,0x80,0xa6,0x00,0x7b,0x2d,0x11,0x03,0x54,0x0b,0x51,
-0x04,0xf5,0x22,0x22,0xf7,0x6e,0x1d,0x02,0x06,0x00,0x32,0xf6,0x00,0x03,0x02,0x51,
-0x04,0xad,0x1a,0xf0,0x02,0x20,0x51,0x00,0x09,0x80,0x06,0xe0,0xf7,0x00,0x0c,0xa0,
-0x06,0xe0,0xe7,0x00,0x0f,0x80,0x0f,0x23,0xf1,0x0e,0x3f,0x80,0x06,0xfe,0xf7,0x00,
-0xaf,0xf2,0x06,0xf6,0xe7,0x04,0xf4,0xbd,0x06,0xe0,0xe7,0x2e,0x90,0x0d,0x96,0xe0,
-0xe7,0x68,0x00,0x01,0x46,0xd0,0xe7,0xbf,0x00,0xd0,0x72,0x00,0x00,0x19,0xef,0xd9,
-0x10,0x00,0x01,0xde,0x64,0x7e,0xd0,0x7b,0x3d,0x23,0x04,0xf3,0x06,0x00,0xa7,0x00,
+0x00,0x11,0x5e,0x0b,0x00,0x24,0xd0,0x00,0x01,0x00,0xf1,0x03,0x25,0x00,0x00,0x00,
+0xb6,0x00,0x07,0xf0,0x00,0x00,0x0d,0x90,0x00,0x7f,0x00,0x00,0x00,0xe8,0x0d,0x00,
+0xf0,0x1c,0x0f,0x70,0x00,0x6f,0x00,0x00,0x04,0xfb,0x00,0x06,0xf0,0x00,0x00,0x9f,
+0xf1,0x00,0x6f,0xff,0x80,0x0e,0x9e,0x90,0x06,0xf5,0x51,0x07,0xf1,0x7f,0x10,0x6f,
+0x00,0x01,0xf8,0x00,0xea,0x06,0xf0,0x00,0x9d,0x00,0x05,0xf1,0x6f,0xcf,0x00,0x22,
+0x02,0x06,0xb6,0x00,0x11,0x6f,0x06,0x00,0x03,0x0d,0x00,0x22,0x4e,0x00,0xee,0x00,
+0x41,0x00,0x00,0x00,0x8a,0x3d,0x01,0xf2,0x1c,0x0a,0xc0,0x00,0x5f,0x10,0x00,0x00,
+0xda,0x00,0x05,0xf1,0x00,0x00,0x3f,0xa0,0x00,0x5f,0x65,0x20,0x0b,0xff,0x50,0x05,
+0xff,0xf8,0x05,0xf7,0xbf,0x30,0x5f,0x10,0x04,0xfa,0x00,0xbe,0x15,0xf1,0x00,0xda,
+0x00,0x00,0x83,0x4f,0x3b,0x00,0xde,0x30,0x00,0x00,0xcf,0xff,0xff,0xfd,0x00,0x00,
+0x04,0x55,0x55,0x59,0x62,0x00,0x03,0x0d,0x00,0x22,0x01,0x60,0x07,0x00,0xf0,0x26,
+0x00,0x00,0x00,0x58,0x00,0x03,0xf1,0x00,0x00,0x09,0xd0,0x00,0x3f,0x30,0x00,0x00,
+0xcb,0x00,0x03,0xf2,0x00,0x00,0x1f,0x90,0x00,0x3f,0x20,0x00,0x07,0xff,0x30,0x03,
+0xf9,0x84,0x02,0xf8,0xcd,0x10,0x3f,0xdd,0x71,0xdc,0x01,0xdc,0x03,0xf2,0x00,0xbd,
+0x10,0x01,0xb4,0x3f,0x20,0x9e,0x00,0x00,0x27,0x00,0x20,0x5a,0x00,0x27,0x00,0x81,
+0x08,0xe0,0x00,0x01,0x80,0x00,0x00,0x8e,0x51,0x00,0x81,0x09,0xe1,0x11,0x11,0x10,
+0x00,0x00,0x7f,0x97,0x01,0x55,0x00,0x23,0x33,0x32,0x20,0x68,0x00,0x11,0x4a,0x34,
+0x00,0x21,0x08,0xe0,0x68,0x00,0xf2,0x29,0xbc,0x00,0x03,0xf3,0x00,0x00,0x1f,0xd0,
+0x00,0x3f,0x97,0x40,0x08,0xff,0x80,0x03,0xfe,0xe9,0x04,0xf8,0x6f,0x50,0x3f,0x30,
+0x03,0xfb,0x00,0x7f,0x43,0xf3,0x00,0xa9,0x00,0x00,0x53,0x1c,0x10,0x00,0x03,0x80,
+0x00,0x00,0x90,0x00,0x00,0x7e,0x00,0x00,0x2f,0x30,0x00,0x07,0xf5,0x55,0x57,0xf2,
+0x5b,0x00,0x63,0x20,0x00,0x07,0xe0,0x00,0x03,0x0d,0x00,0x10,0x10,0x0c,0x02,0x12,
+0x44,0x68,0x00,0x81,0x02,0x00,0x00,0x00,0x57,0x00,0x04,0xf1,0x38,0x01,0x11,0x4f,
+0x38,0x01,0x00,0x0d,0x00,0xf0,0x0e,0x2f,0xa0,0x00,0x4f,0x76,0x30,0x0a,0xff,0x40,
+0x04,0xff,0xf9,0x05,0xf6,0xbf,0x20,0x4f,0x10,0x03,0xfa,0x00,0xbe,0x14,0xf1,0x00,
+0xd9,0x00,0x00,0x83,0x27,0x00,0xf0,0x0e,0x00,0x23,0x11,0x80,0x00,0x00,0x05,0xef,
+0xff,0xc2,0x00,0x00,0x03,0xfa,0x31,0x4d,0xe0,0x00,0x00,0x8f,0x00,0x00,0x4f,0x20,
+0x00,0x06,0xf6,0x00,0x1b,0x4e,0x00,0x30,0xfe,0xef,0xf5,0x5f,0x00,0x23,0x56,0x40,
+0xcf,0x00,0xf0,0x01,0x41,0x00,0x0a,0x30,0x0d,0x60,0xe6,0x00,0x0f,0x50,0x0e,0x60,
+0xe6,0x00,0x1f,0x40,0x06,0x00,0xf6,0x25,0x2f,0x20,0x0f,0x60,0xe6,0x00,0x6f,0x50,
+0x0f,0x83,0xf6,0x00,0x9f,0xa0,0x0e,0xff,0xf6,0x00,0xfc,0xf1,0x0e,0x60,0xe6,0x07,
+0xe1,0xe7,0x0e,0x60,0xe6,0x1f,0x70,0x6e,0x0e,0x60,0xe6,0xac,0x00,0x0d,0x7e,0x60,
+0xe6,0x41,0x00,0x01,0x2e,0x60,0xe6,0x00,0x00,0x00,0x0e,0x70,0x06,0x00,0x46,0x0a,
+0x40,0xd5,0x00,0x01,0x00,0xf1,0x22,0x21,0x00,0x07,0x60,0x06,0xd0,0xd8,0x00,0x0c,
+0xa0,0x07,0xe0,0xd8,0x00,0x0f,0x90,0x06,0xf0,0xd9,0x00,0x3f,0x90,0x06,0xfe,0xf9,
+0x00,0xaf,0xf3,0x06,0xf5,0xd9,0x04,0xf4,0xad,0x16,0xf0,0xd8,0x2e,0x90,0x0c,0xa6,
+0xf0,0xd8,0x69,0x00,0x00,0x44,0xc0,0xc7,0x36,0x00,0x31,0x10,0x00,0x08,0x24,0x03,
+0x51,0x02,0x55,0x54,0x45,0xf7,0x12,0x00,0x1d,0xf6,0x06,0x00,0x13,0x61,0x89,0x03,
+0x08,0x60,0x00,0x1f,0x0e,0x60,0x00,0x0c,0xa0,0x42,0x80,0xa6,0x00,0x00,0x12,0x22,
+0x22,0x20,0x00,0x45,0x04,0xc2,0xf6,0x00,0x04,0xf5,0x22,0x22,0xf7,0x00,0x04,0xf3,
+0x00,0x00,0x06,0x00,0x11,0xf6,0x18,0x00,0x71,0xf5,0x00,0x00,0x23,0x44,0x43,0x20,
+0x5f,0x00,0xf1,0x22,0x51,0x00,0x09,0x80,0x06,0xe0,0xf7,0x00,0x0c,0xa0,0x06,0xe0,
+0xe7,0x00,0x0f,0x80,0x06,0xf0,0xe7,0x00,0x3f,0x80,0x06,0xfe,0xf7,0x00,0xaf,0xf2,
+0x06,0xf6,0xe7,0x04,0xf4,0xbd,0x06,0xe0,0xe7,0x2e,0x90,0x0d,0x96,0xe0,0xe7,0x68,
+0x00,0x01,0x46,0xd0,0xe7,0xbf,0x00,0xf0,0x01,0x72,0x00,0x00,0x19,0xef,0xd9,0x10,
+0x00,0x01,0xde,0x64,0x7e,0xd0,0x00,0x05,0xf3,0x5d,0x00,0x02,0x06,0x00,0xa7,0x00,
 0xde,0x76,0x8e,0xc0,0x00,0x00,0x18,0xcc,0xb6,0xb8,0x02,0x21,0x05,0xf0,0xb8,0x02,
-0x20,0x5f,0x10,0x6d,0x46,0xf1,0x12,0x05,0xfd,0xc5,0x00,0x1f,0xc0,0x00,0x5f,0x87,
+0x00,0x20,0x03,0xf0,0x15,0xcc,0x00,0x05,0xfd,0xc5,0x00,0x1f,0xc0,0x00,0x5f,0x87,
 0x20,0x09,0xff,0x70,0x05,0xf1,0x00,0x04,0xf7,0x8f,0x40,0x5f,0x65,0x13,0xfa,0x00,
-0x9f,0x35,0xfe,0xe5,0xba,0x00,0x00,0x63,0x62,0x26,0x31,0x14,0x05,0xf1,0x5e,0x1f,
-0x10,0x2a,0x46,0x00,0x16,0xee,0xad,0x51,0x50,0x00,0x8f,0x73,0xed,0x20,0x0a,0x17,
-0x31,0x01,0xcf,0x30,0x3b,0x4c,0x14,0x63,0x50,0x02,0x10,0x46,0x04,0x0b,0x20,0x09,
-0xd0,0x0f,0x0b,0x10,0xad,0x0b,0x00,0x20,0x0c,0xb0,0x0b,0x00,0xfb,0x16,0xed,0x07,
-0x88,0xf7,0x00,0x3f,0xf3,0xbc,0xcf,0x70,0x09,0xed,0xa0,0x00,0xe8,0x01,0xf7,0x5f,
-0x20,0x0e,0x80,0xae,0x00,0xdb,0x00,0xe8,0x3f,0x40,0x03,0xf3,0x0e,0x83,0x60,0x00,
-0x05,0x10,0xe8,0xd3,0x46,0x02,0xed,0x32,0x13,0x10,0x37,0x4d,0x70,0x3d,0x10,0x00,
-0xc9,0x00,0x05,0xf2,0x43,0x04,0x10,0x8f,0x4f,0x15,0xf2,0x0c,0x0d,0xf1,0x3f,0xff,
-0x90,0x05,0xff,0xa0,0x44,0xd9,0x01,0xeb,0x4f,0x70,0x0c,0x91,0xdd,0x10,0x6f,0x50,
-0xd9,0x7c,0x10,0x00,0x56,0x0c,0x80,0xb1,0x01,0x10,0x4e,0xd0,0x05,0x05,0xc3,0x12,
-0x07,0x55,0x17,0x27,0x0e,0x70,0xcd,0x1c,0x00,0xd4,0x33,0x40,0xd7,0x00,0x05,0xf1,
-0x21,0x00,0x10,0x7f,0x21,0x00,0xf1,0x0d,0x0b,0xe0,0x3b,0xbf,0x80,0x02,0xff,0x72,
-0x99,0xf8,0x00,0xcd,0x9f,0x20,0x0e,0x80,0x8f,0x30,0xcd,0x10,0xe8,0x6f,0x50,0x01,
-0xc9,0x0e,0x82,0x20,0x42,0x00,0x23,0x0e,0x60,0xfb,0x48,0x16,0x52,0xfb,0x48,0x31,
-0x10,0x00,0x0f,0xe7,0x08,0x16,0x13,0x74,0x4c,0x21,0x02,0xb1,0xda,0x0a,0x10,0xf2,
-0x7b,0x03,0xf0,0x0f,0x08,0xf0,0x04,0x5a,0xf0,0x00,0x0e,0xf5,0x0e,0xff,0xf0,0x00,
-0x8e,0xaf,0x20,0x07,0xf0,0x04,0xf5,0x0b,0xe1,0x07,0xe0,0x3f,0x80,0x00,0xba,0x07,
-0xe0,0x46,0x1d,0x0d,0x32,0xa0,0x00,0x03,0x63,0x23,0x32,0xee,0xee,0xdf,0x63,0x23,
-0x21,0xe0,0x00,0x97,0x5c,0x04,0x2b,0x47,0x01,0x66,0x08,0x00,0x63,0x32,0x13,0x20,
-0xde,0x05,0x12,0x3d,0x2b,0x42,0x00,0xb8,0x00,0xf0,0x00,0x8f,0x00,0x01,0xe8,0x00,
-0x0d,0xe0,0x3f,0xff,0x80,0x05,0xff,0xa0,0x34,0xe8,0x10,0x01,0x20,0x0e,0x81,0x10,
-0x01,0x50,0xe8,0x8c,0x10,0x00,0x55,0xfa,0x00,0xd4,0x13,0x20,0x73,0x00,0x01,0xaf,
-0xff,0xe7,0x00,0x00,0xbe,0x51,0x28,0x2b,0x47,0x80,0xec,0x10,0x05,0xf7,0x00,0x03,
-0xef,0xef,0x35,0x0a,0x22,0x46,0x52,0xe7,0x02,0x40,0x52,0x00,0x1c,0x10,0x64,0x0d,
-0x20,0x3f,0x30,0x7a,0x17,0x80,0x3f,0x20,0x06,0xf0,0xf6,0x00,0x6f,0x10,0x06,0x00,
-0xf2,0x17,0x8f,0x25,0xac,0xf0,0xf6,0x00,0xdf,0x76,0xac,0xf0,0xf6,0x02,0xfd,0xd0,
-0x06,0xf0,0xe6,0x09,0xe2,0xf4,0x06,0xf0,0xe6,0x2f,0x60,0xbb,0x06,0xf0,0xe6,0x9c,
-0x00,0x2f,0x26,0xe0,0xe6,0x42,0x00,0x03,0x5b,0x33,0x02,0xa6,0x0d,0x21,0x08,0xe0,
-0x75,0x0d,0x1a,0xa0,0x5b,0x49,0x40,0x07,0x60,0x05,0xe0,0x16,0x02,0x00,0xe2,0x02,
-0x20,0x0e,0x90,0x03,0x26,0x20,0x2f,0x83,0xc1,0x18,0xf4,0x08,0x9f,0xf2,0x48,0xf1,
-0xe7,0x02,0xf6,0xcc,0x04,0xf1,0xe7,0x1d,0xb0,0x1e,0x94,0xf1,0xe7,0x7b,0x00,0x02,
-0x63,0xf0,0xd6,0x36,0x00,0x00,0x78,0x5b,0x01,0xa8,0x03,0x02,0x38,0x54,0x0d,0x06,
-0x00,0x21,0x00,0x71,0x2d,0x02,0x10,0x21,0x60,0x00,0x20,0xf0,0xd8,0x48,0x03,0x14,
-0xf0,0xa8,0x03,0xf0,0x0d,0x2f,0x72,0xef,0xf0,0xd9,0x00,0x8f,0xe1,0x48,0xf0,0xd8,
-0x01,0xf8,0xdb,0x05,0xf0,0xd8,0x0c,0xc0,0x2f,0x75,0xf0,0xd8,0x7d,0x10,0x03,0x95,
-0xf0,0x1c,0x2c,0x00,0x2a,0x00,0x51,0x06,0xb0,0x05,0xe0,0xe8,0x1a,0x0b,0x13,0x31,
-0x20,0x0b,0x20,0x09,0xe0,0xf5,0x42,0x03,0xfd,0x2d,0x13,0x33,0xd8,0x01,0x50,0x30,
-0x52,0x00,0x0a,0xb0,0xb4,0x00,0x31,0x0b,0xb0,0x05,0xc0,0x00,0xf2,0x13,0x37,0xf1,
-0xe7,0x00,0x3f,0xc3,0xff,0xf1,0xe7,0x00,0xbe,0xf7,0x04,0xf1,0xe7,0x05,0xf5,0x7f,
-0x44,0xf1,0xe7,0x3f,0x90,0x08,0xe4,0xf1,0xe7,0x57,0x00,0x00,0x11,0x70,0x51,0x00,
-0x72,0x0e,0x62,0x02,0x67,0x66,0x66,0xf5,0x00,0x73,0x0e,0x00,0x98,0x07,0x00,0x0b,
-0x32,0x02,0x73,0x24,0x01,0xb5,0x0b,0x01,0x75,0x33,0x02,0xea,0x00,0x2e,0x06,0x60,
-0x20,0x01,0x10,0xff,0x20,0x01,0x66,0xe2,0x37,0xf1,0xe7,0x02,0xf7,0x20,0x01,0x61,
-0x7c,0x00,0x02,0x73,0xd0,0xe7,0x1a,0x1d,0x15,0xc5,0x44,0x31,0x30,0xcf,0x40,0x00,
-0x81,0x54,0x10,0xf5,0xde,0x07,0x30,0x80,0x9f,0x70,0x70,0x4e,0x20,0x06,0xf8,0x90,
-0x0e,0x23,0x00,0x23,0x82,0x01,0x10,0x4b,0xf0,0x02,0x20,0x07,0xf0,0x38,0x02,0xf1,
-0x12,0x9d,0x04,0xff,0xf8,0x00,0x0d,0xc0,0x04,0x5e,0x80,0x04,0xff,0x40,0x33,0xe8,
-0x00,0xdc,0xae,0x6f,0xff,0x80,0xae,0x21,0xdc,0x00,0xe8,0x8e,0x30,0x02,0xd7,0x0e,
-0x83,0x10,0xf0,0x02,0x20,0x0c,0x70,0xf0,0x02,0x10,0xe9,0xf0,0x02,0x02,0x45,0x03,
-0x10,0xe9,0xf0,0x02,0x18,0x0d,0xf0,0x02,0x17,0x70,0xe6,0x0d,0x11,0x09,0x37,0x07,
-0x00,0x45,0x5d,0x00,0xd6,0x45,0x20,0x9f,0x50,0x3b,0x13,0xe1,0x40,0x9f,0x60,0x00,
-0x00,0xce,0x40,0x00,0x7f,0x80,0x00,0x29,0x10,0x39,0xd7,0x3f,0x15,0x07,0xca,0x17,
-0x00,0xf3,0x25,0x31,0xf5,0x55,0x55,0xcd,0x46,0x23,0xee,0xe2,0xb9,0x23,0x04,0x45,
-0x25,0x31,0x1f,0xe1,0x00,0x45,0x46,0x10,0xc1,0xaa,0x03,0xf0,0x01,0xe3,0x2d,0xd3,
-0x00,0x00,0x3f,0xb1,0x67,0x09,0xf4,0x00,0x01,0x20,0x0a,0xc0,0x01,0x8d,0x18,0x85,
-0xcd,0x55,0x55,0x30,0x9f,0xff,0xee,0xef,0xf5,0x18,0x00,0x66,0x18,0x79,0xee,0x10,
-0x00,0x04,0x67,0x76,0x69,0xdd,0x43,0x12,0xf3,0x7d,0x0e,0x04,0xc1,0x09,0x05,0x68,
-0x00,0x12,0xad,0x6d,0x41,0x11,0xd0,0x53,0x14,0x01,0x10,0x55,0xf1,0x01,0x1b,0xf4,
-0x3e,0xc1,0x00,0x00,0x3e,0xc2,0x46,0x1b,0xf3,0x00,0x01,0x40,0x0a,0xc0,0x11,0x58,
-0x17,0xac,0xf3,0x0c,0x10,0x44,0xa5,0x36,0x28,0x00,0x13,0x2b,0x30,0x1c,0x9d,0xa3,
-0x22,0x05,0xf3,0x25,0x04,0x5a,0x30,0x12,0x9c,0x68,0x00,0x11,0xe0,0x68,0x00,0x21,
-0xfe,0xc0,0x68,0x00,0xfd,0x00,0x2e,0xd2,0x00,0x00,0x3f,0xc2,0x46,0x1a,0xf3,0x00,
-0x01,0x30,0x0a,0xc0,0x02,0xd0,0x00,0x11,0x01,0xfe,0x09,0x10,0xdf,0xc3,0x13,0x54,
-0x04,0xfa,0x31,0x5d,0xd0,0xd1,0x2f,0x00,0x66,0x07,0x02,0x99,0x2a,0x1a,0xf4,0x95,
-0x34,0x00,0x02,0x65,0x11,0x7d,0x60,0x09,0x10,0xe0,0x37,0x13,0x31,0x7e,0x00,0x05,
-0x4c,0x41,0xf0,0x06,0xdf,0xf2,0x00,0x7e,0x00,0x8f,0x3d,0xd1,0x07,0xe0,0x7f,0x40,
-0x1d,0xc0,0x7e,0x0d,0x40,0x81,0x19,0x07,0xf0,0x4d,0x13,0x10,0x7f,0x3e,0x03,0xde,
-0x07,0xf0,0x54,0x5f,0x97,0x88,0x7f,0x2d,0xee,0xed,0xca,0x67,0xf0,0x95,0x34,0x13,
-0x05,0x0d,0x31,0x02,0x90,0x01,0x11,0xf3,0x90,0x01,0x20,0xec,0xe2,0xc6,0x00,0x70,
-0xf3,0x1c,0xe3,0x00,0x00,0x2d,0xd3,0xe1,0x20,0x10,0x03,0xec,0x5d,0x18,0x30,0x73,
-0x2e,0x51,0xff,0x02,0x44,0x44,0xae,0x95,0x15,0x09,0xa8,0x19,0x09,0x56,0x46,0x27,
-0x00,0x20,0x11,0x59,0x03,0x22,0x01,0x31,0x0d,0xd0,0x00,0x1d,0x4a,0x11,0x90,0x8b,
-0x57,0xff,0x01,0x5f,0xa0,0x00,0x00,0x2c,0xe5,0x00,0x3d,0xd2,0x00,0x02,0x71,0x00,
-0x00,0x06,0x20,0xb5,0x19,0x29,0x0f,0x5a,0x02,0x03,0x11,0xd1,0x5a,0x02,0x00,0x73,
-0x0f,0x51,0x3f,0xa1,0x00,0x09,0xf4,0x94,0x00,0x22,0x01,0x00,0x88,0x24,0x74,0xe0,
-0x25,0x55,0x59,0xf5,0x55,0x54,0xd3,0x0a,0x01,0x6b,0x52,0x00,0x95,0x1a,0x16,0x00,
-0xe7,0x1a,0xa5,0x8f,0x83,0xee,0x30,0x00,0x01,0xdf,0x60,0x01,0xbf,0xe7,0x1a,0x03,
-0xd9,0x21,0x02,0x09,0x03,0x21,0x0c,0xc0,0x77,0x02,0x01,0xfb,0x10,0xf8,0x07,0xdd,
-0xcd,0x10,0x00,0x00,0x0b,0xe2,0x1d,0xc1,0x00,0x01,0xce,0x30,0x01,0xdd,0x20,0x05,
-0xa1,0x00,0x00,0x08,0x50,0xbe,0x0d,0xc4,0x7d,0xdd,0xdd,0xdd,0xde,0xeb,0x37,0x77,
-0x77,0x77,0x77,0x74,0xb0,0x00,0x25,0x0b,0xc0,0xaf,0x00,0xf0,0x02,0x01,0xdd,0xdd,
-0x20,0x00,0x00,0x5e,0xc1,0x1b,0xf6,0x00,0x05,0xe7,0x00,0x00,0x6d,0x40,0x2d,0x0f,
-0x22,0x22,0x32,0x98,0x02,0x01,0xbe,0x56,0x02,0x6e,0x12,0x01,0x65,0x1a,0x0f,0x3f,
-0x3e,0x0e,0x03,0xf3,0x3c,0x02,0x4a,0x48,0x21,0x1f,0xb0,0xda,0x00,0x11,0xf9,0x98,
-0x02,0xb0,0x5f,0xa0,0x00,0x04,0xed,0x30,0x03,0xde,0x10,0x03,0x50,0x81,0x16,0x24,
-0x35,0x54,0x63,0x35,0x05,0xe5,0x42,0x11,0xc7,0xa9,0x2a,0x11,0xea,0x68,0x2a,0x11,
-0xef,0x3d,0x25,0x11,0xe7,0x38,0x02,0x11,0xef,0xdb,0x3e,0x04,0x28,0x46,0x16,0x10,
-0x22,0x03,0x02,0x61,0x03,0x20,0x9f,0xfa,0x11,0x00,0xc0,0xf6,0x3f,0xc1,0x00,0x02,
-0xee,0x40,0x02,0xcf,0x30,0x02,0x60,0xe2,0x26,0x20,0x25,0x54,0xfb,0x25,0x10,0x7e,
-0x60,0x00,0x13,0xec,0x36,0x00,0x11,0x04,0xb8,0x16,0x44,0x3f,0xa3,0x25,0xed,0xf4,
-0x02,0x45,0x6f,0x50,0x00,0xbf,0xf3,0x02,0x04,0x86,0x3d,0x10,0x01,0x64,0x84,0x20,
-0x00,0xe6,0xb5,0x0a,0x00,0x4e,0x0c,0x00,0x2d,0x4f,0x20,0x08,0xf0,0xaf,0x04,0x20,
-0xbf,0x20,0x37,0x50,0x00,0x43,0x4f,0x70,0x06,0xfa,0xe0,0x00,0xe7,0x00,0xda,0x29,
-0x51,0xf7,0x00,0x6f,0x20,0x8e,0x10,0xe8,0x1f,0x70,0x00,0xd8,0x0e,0x81,0x70,0x00,
-0x02,0x30,0x6d,0x1f,0x0c,0x43,0x4f,0x20,0x03,0x10,0x61,0x55,0x10,0xd9,0x57,0x30,
-0x05,0x70,0x08,0xf2,0x0b,0xe1,0x00,0x0d,0x90,0x05,0xfe,0xb0,0x00,0xd9,0x01,0xea,
-0x3f,0x80,0x0d,0x91,0xdc,0x00,0x4f,0x60,0xd9,0x69,0x00,0x00,0x34,0x0c,0x80,0xeb,
-0x00,0x10,0x5e,0x79,0x21,0x05,0x3b,0x25,0x0e,0x70,0x08,0x03,0xb0,0x00,0x16,0x2d,
-0xb0,0x00,0x10,0x7f,0x79,0x00,0x50,0x0b,0xe0,0x00,0x0e,0x70,0x66,0x62,0xf1,0x05,
-0xe7,0x00,0xad,0x8f,0x30,0x0e,0x70,0x7f,0x30,0xae,0x10,0xe7,0x5f,0x50,0x00,0xaa,
-0x0e,0x72,0x20,0x00,0x21,0x00,0x04,0x6b,0x51,0x13,0x51,0xc1,0x19,0x16,0xf7,0x6b,
-0x51,0x16,0x12,0xb6,0x22,0x71,0x02,0xc1,0x00,0x0b,0x70,0x00,0x04,0x21,0x09,0x20,
-0x07,0xf0,0xbe,0x2d,0x20,0x0c,0xf3,0x06,0x00,0xf0,0x08,0x5f,0xcd,0x10,0x0c,0x90,
-0x02,0xe9,0x1d,0xc0,0x0d,0x90,0x2e,0xb0,0x02,0xe9,0x0d,0x90,0x47,0x00,0x00,0x13,
-0x0b,0x60,0xef,0x0c,0x71,0x56,0x10,0x00,0x2e,0xee,0xee,0xdf,0x96,0x4c,0x23,0x1e,
-0x80,0x66,0x51,0x0e,0x70,0x08,0x02,0xd8,0x09,0x13,0x3c,0x95,0x4a,0x01,0x70,0x08,
-0x10,0x00,0x70,0x08,0x00,0x87,0x33,0xf0,0x06,0xff,0x90,0x00,0xe8,0x00,0xdb,0x4f,
-0x60,0x0e,0x81,0xcd,0x10,0x6f,0x40,0xe8,0x7b,0x10,0x00,0x55,0x0d,0x60,0x1f,0x1d,
-0x13,0x20,0x2d,0x2e,0x40,0xf9,0x22,0x22,0xd9,0xec,0x00,0x20,0x0d,0x90,0xc3,0x00,
-0x12,0xd9,0x16,0x00,0x00,0x65,0x16,0x02,0x3f,0x47,0x01,0x54,0x3d,0x18,0xe8,0x80,
-0x09,0x1a,0x0c,0x58,0x00,0x11,0x80,0x58,0x00,0x17,0x7c,0xc8,0x08,0x11,0x00,0xc8,
-0x08,0x20,0xaf,0x52,0xc8,0x08,0x10,0x90,0xc8,0x08,0x1d,0xdd,0xc8,0x08,0x00,0x8a,
-0x03,0xa1,0x0b,0x10,0x77,0x01,0xf4,0x00,0x03,0xf3,0x0b,0xb0,0x3d,0x1b,0x20,0xba,
-0x01,0xa4,0x54,0xf8,0x22,0x0c,0xa0,0x1f,0x50,0x00,0x6f,0x50,0xeb,0x01,0xf6,0x00,
-0x09,0xf8,0x1f,0xf0,0x1f,0xfe,0x90,0xcf,0xc4,0xff,0x31,0xf9,0x52,0x1f,0x9f,0x9d,
-0xd8,0x1f,0x50,0x07,0xe0,0xef,0x78,0xd0,0xf5,0x00,0xd8,0x09,0xe0,0x2f,0x2f,0x50,
-0x04,0x00,0x12,0x00,0x20,0xf5,0x38,0x1b,0x12,0xf6,0xc2,0x05,0x10,0x40,0x3a,0x15,
-0x21,0x02,0x80,0x6b,0x04,0x11,0x7f,0x0b,0x2e,0x01,0x31,0x08,0x30,0xfe,0x00,0xcf,
-0x7c,0x56,0xf4,0x06,0xf5,0x3f,0xfa,0x00,0x00,0x1e,0x89,0xdb,0xd4,0xf4,0x00,0x0a,
-0xd0,0x1e,0xf3,0x09,0xe0,0x00,0x61,0x00,0x23,0x16,0x87,0x08,0x3c,0x13,0x27,0xee,
-0xed,0x17,0x41,0x14,0x03,0x72,0x0e,0x30,0x03,0xce,0xc2,0x95,0x05,0xb0,0xec,0x5c,
-0xe0,0x06,0xf0,0x00,0x6f,0x10,0x2f,0x40,0x6f,0x40,0x03,0xb0,0xf6,0x06,0xf1,0x00,
-0xac,0x00,0x0e,0x70,0x6f,0xff,0x99,0x0d,0x00,0x40,0xf4,0x41,0x6f,0x00,0x1a,0x00,
-0x40,0x01,0xf9,0x4c,0xe0,0xef,0x30,0x2e,0xef,0xd3,0xb3,0x0e,0x0c,0x13,0x33,0x05,
-0x1f,0x1f,0x20,0x09,0xdd,0x08,0x5e,0x50,0x0a,0xe6,0x9f,0x40,0x6f,0x55,0x19,0xf0,
-0x07,0xd9,0x06,0xf0,0x00,0x2f,0x40,0x0a,0xb0,0x6f,0x66,0x11,0xf4,0x00,0xaa,0x06,
-0xff,0xf6,0x0e,0xa0,0x1e,0x70,0x6f,0xee,0x64,0x10,0xc0,0x4e,0x00,0x27,0x25,0x40,
-0x41,0x00,0x12,0xdf,0x28,0x0f,0x3f,0x54,0x44,0x4a,0x87,0x1f,0x06,0x15,0x01,0x1d,
-0x1b,0x30,0x05,0xa9,0x30,0xf1,0x3a,0xf0,0x14,0xfa,0xdf,0x20,0x4f,0x30,0x00,0xf8,
-0x00,0xe8,0x04,0xf3,0x00,0x2f,0x40,0x0b,0xb0,0x4f,0x30,0x02,0xf4,0x00,0xab,0x03,
-0xfa,0x84,0x1f,0x60,0x0c,0x90,0x3f,0xcb,0x50,0xae,0x68,0xf4,0xda,0x0e,0x24,0xae,
-0xd6,0x2e,0x4f,0x11,0xf2,0xb0,0x15,0x00,0xfe,0x56,0x11,0xf0,0x28,0x0f,0x03,0x4a,
-0x4b,0x15,0xf1,0xd7,0x15,0x00,0x28,0x0f,0x03,0xd6,0x3a,0x00,0x38,0x01,0x20,0x06,
-0xaa,0x68,0x00,0xc1,0x09,0xf9,0xbf,0x30,0x3f,0x30,0x00,0xf7,0x00,0xd9,0x03,0xf3,
-0xd0,0x00,0xf0,0x04,0x3f,0xff,0xb2,0xf5,0x00,0xab,0x03,0xf6,0x41,0x0e,0xb0,0x1e,
-0x70,0x3f,0x20,0x00,0x5f,0xef,0xd0,0x5b,0x00,0x40,0x26,0x40,0x04,0x35,0x9f,0x00,
-0xf0,0x01,0x01,0xcd,0xe2,0x00,0x00,0xd7,0x01,0xaa,0xaa,0xa2,0x00,0x0e,0x80,0x05,
-0x68,0x66,0x3a,0x04,0x90,0x4f,0xfe,0x30,0x00,0x0f,0x70,0x0b,0xb0,0xb9,0xc7,0x04,
-0x28,0x9c,0x3e,0xad,0x25,0x01,0xd0,0x00,0xb2,0x20,0x02,0xf2,0x00,0x09,0xfa,0xcf,
-0x20,0x3f,0x30,0x01,0x68,0x00,0x70,0x3f,0x30,0x0a,0xb0,0x3f,0xee,0x92,0x5c,0x31,
-0xc3,0xf7,0x53,0x0d,0xc4,0x5f,0x70,0x3f,0x30,0x00,0x3d,0xff,0x90,0xe8,0x16,0x11,
-0x2b,0x44,0x2e,0x50,0x56,0x60,0x00,0x00,0x7e,0x42,0x14,0x00,0x65,0x03,0x24,0x15,
-0xf3,0xa3,0x56,0x04,0x96,0x38,0x01,0x73,0x03,0x36,0x01,0x45,0x54,0x46,0x5e,0xa1,
-0x07,0xbb,0x40,0x05,0xe0,0x00,0x0a,0xf8,0xbf,0x30,0xfd,0x40,0x05,0xa0,0x01,0x31,
-0x55,0x11,0xf5,0xa0,0x01,0x21,0x0d,0xb0,0xa0,0x01,0x12,0x4f,0xa0,0x01,0x21,0x15,
-0x30,0xa0,0x01,0x02,0x56,0x50,0x02,0x7b,0x40,0x54,0x0a,0xe3,0x33,0x28,0xf0,0x91,
-0x20,0x02,0x56,0x47,0x03,0xfc,0x13,0x14,0x01,0x57,0x47,0x21,0x00,0x03,0x68,0x00,
-0x00,0x76,0x47,0x0d,0x68,0x00,0x20,0xbb,0x41,0x68,0x00,0x2d,0xfa,0xa3,0x68,0x00,
-0x10,0x3b,0x48,0x4f,0x01,0x09,0x11,0x12,0xac,0x4d,0x27,0x30,0xfe,0xee,0xef,0x68,
-0x00,0x31,0x66,0x65,0x9f,0x3f,0x10,0x0e,0xfd,0x40,0x01,0x1a,0x17,0x20,0x09,0xdd,
-0xeb,0x35,0x0e,0x70,0x02,0x20,0xff,0x71,0x70,0x02,0x2d,0xf6,0x51,0x70,0x02,0x11,
-0x6f,0x07,0x15,0x21,0x01,0x50,0x60,0x10,0x45,0xb2,0x00,0x00,0x03,0x93,0x33,0x18,
-0x6f,0x93,0x33,0x18,0xe5,0x93,0x33,0xe0,0x16,0x00,0x00,0x07,0xbc,0x60,0x05,0xf1,
-0x00,0x0a,0xf8,0xaf,0x50,0x5f,0x73,0x2a,0x10,0xbb,0x86,0x5a,0xf0,0x00,0x40,0x09,
-0xd0,0x4f,0xff,0x61,0xf5,0x00,0x9c,0x04,0xf6,0x51,0x0d,0xc1,0x2e,0xa7,0x1d,0x52,
-0x3e,0xff,0xc0,0x04,0xf2,0x9c,0x54,0x00,0xb0,0x57,0x01,0xbf,0x2b,0x12,0xdf,0x3f,
-0x30,0x31,0x49,0x00,0x4a,0xbc,0x0c,0x00,0xec,0x24,0x00,0xac,0x14,0x03,0x31,0x46,
-0x14,0xa0,0x31,0x46,0x00,0x05,0x03,0xf0,0x19,0x41,0x00,0x9c,0xa2,0x05,0xf0,0xe7,
-0x0a,0xe7,0xdd,0x05,0xf1,0xe7,0x0f,0x70,0x3f,0x35,0xf1,0xe7,0x2f,0x40,0x1f,0x45,
-0xff,0xf7,0x1f,0x50,0x1f,0x44,0xf6,0xf7,0x0d,0xa0,0x6f,0x14,0xf1,0xe7,0x04,0xfe,
-0xf7,0x71,0x1a,0x53,0x25,0x20,0x02,0xc0,0xc5,0x9c,0x01,0x12,0x01,0x68,0x10,0x40,
-0xf6,0x22,0x23,0xf5,0x91,0x32,0x10,0x01,0xe3,0x57,0x00,0x06,0x00,0x12,0x02,0xa4,
-0x13,0x14,0x34,0xab,0x33,0x1e,0x00,0x08,0x04,0x21,0xf5,0x51,0x08,0x04,0x20,0xff,
-0x69,0xfb,0x03,0x12,0xf0,0x08,0x04,0x22,0x00,0x09,0x0d,0x00,0x01,0x08,0x04,0x20,
-0xbb,0x51,0x08,0x04,0x2f,0xf9,0x93,0x08,0x04,0x18,0x10,0x03,0x98,0x01,0xf0,0x03,
-0x70,0x03,0xf2,0x00,0x0b,0xe6,0x9f,0x40,0x3f,0x64,0x11,0xf6,0x00,0xda,0x03,0xff,
-0xf7,0x3f,0x38,0x03,0x02,0xa0,0x03,0x20,0xf4,0x10,0x98,0x01,0xc3,0x3f,0xff,0x70,
-0x5f,0xff,0xd1,0x03,0xf4,0x20,0x00,0x26,0x50,0x66,0x3b,0x00,0x93,0x03,0xe0,0x02,
-0xaf,0xff,0xb3,0x00,0x00,0x01,0xed,0x53,0x4b,0xf1,0x00,0x00,0x4f,0x62,0x2a,0x31,
-0x00,0x02,0xf8,0x59,0x72,0x50,0x08,0xfe,0xde,0xf9,0x00,0xf8,0x02,0x15,0x41,0xf0,
-0x0d,0x01,0xd8,0x32,0xe0,0x6d,0xd8,0x00,0x07,0xe0,0x5f,0x76,0xf7,0x00,0x6e,0x0c,
-0xa0,0x09,0xd0,0xe9,0x10,0xe1,0x6f,0x01,0x7e,0x0f,0x60,0x05,0xf8,0xff,0xf0,0xf7,
-0x00,0x6f,0x02,0x8f,0x16,0x00,0xa3,0xf0,0x7f,0x55,0xf7,0x00,0x6f,0x00,0x9f,0xf9,
-0x00,0x73,0x3d,0x06,0x08,0x48,0x11,0x6e,0x09,0x0b,0x18,0xd0,0x44,0x05,0xf2,0x1d,
-0x49,0x92,0x00,0x06,0xe0,0x05,0xfb,0xdf,0x20,0x07,0xf0,0x0d,0x90,0x0e,0x80,0x07,
-0xf0,0x0f,0x50,0x0b,0xb2,0x5a,0xf0,0x0f,0x50,0x0a,0xb8,0xef,0xf0,0x0e,0x70,0x0c,
-0x90,0x07,0xf0,0x09,0xe6,0x8f,0x40,0x07,0xe0,0x00,0x9e,0xd6,0x0f,0x4c,0x00,0x06,
-0x00,0x20,0x05,0x40,0x06,0x00,0x20,0x0c,0xb0,0xa4,0x09,0x02,0xf9,0x08,0x42,0x0d,
-0xb1,0x11,0x12,0xee,0x4e,0x17,0xf0,0xc2,0x46,0xf0,0x14,0x20,0x00,0x7c,0xc5,0x00,
-0x06,0xf0,0x09,0xf7,0x8f,0x40,0x06,0xf0,0x0f,0x80,0x0b,0xa0,0x37,0xf0,0x1f,0x50,
-0x09,0xc9,0xff,0xf0,0x0f,0x70,0x0a,0xb0,0x17,0xf0,0x0a,0xe6,0x7f,0x60,0x9c,0x14,
-0x12,0xd7,0xab,0x00,0x00,0x79,0x13,0xa4,0x03,0x66,0x66,0x67,0x50,0x00,0x0b,0xee,
-0xed,0xde,0xc0,0x0f,0x11,0x0e,0xb8,0x17,0x24,0x0f,0x80,0x50,0x07,0x16,0xf0,0x50,
-0x07,0x02,0x60,0x00,0xf2,0x14,0x04,0xf1,0x09,0xf7,0x9f,0x40,0x04,0xf1,0x0f,0x80,
-0x0c,0xb1,0x47,0xf1,0x1f,0x50,0x09,0xd7,0xff,0xf1,0x0f,0x70,0x0a,0xc0,0x04,0xf1,
-0x0a,0xe4,0x5f,0x70,0x04,0xf1,0x01,0xbf,0xfa,0x1f,0x1a,0x00,0xf6,0x20,0x20,0x05,
-0x20,0x57,0x1e,0x20,0x0e,0x80,0x12,0x01,0x40,0x0e,0xb6,0x66,0x6a,0x60,0x00,0x20,
-0xfe,0xef,0x3d,0x08,0x00,0xd2,0x00,0x02,0x7a,0x59,0x00,0xd0,0x02,0x04,0x3e,0x3f,
-0x20,0x08,0xcc,0x00,0x0c,0x60,0x09,0xf7,0x8f,0x50,0x07,0xe0,0x10,0x03,0x31,0x14,
-0x9e,0x00,0x62,0x00,0x00,0x0d,0x00,0xa0,0xab,0x00,0x7e,0x00,0x0a,0xf7,0x8f,0x60,
-0x07,0xe0,0x07,0x02,0x02,0xbb,0x05,0x00,0x12,0x01,0xf0,0x03,0x04,0xa0,0x0b,0x10,
-0xb3,0x00,0x00,0x7e,0x01,0xf3,0x1f,0x40,0x00,0x07,0xf5,0x6f,0x33,0xf5,0x33,0x14,
-0xf7,0x08,0xf3,0x7f,0xb0,0x00,0x07,0xe0,0x2f,0x3e,0xbf,0x40,0x00,0x7f,0xee,0xf9,
-0xe1,0x9d,0x00,0x00,0x34,0x43,0x42,0x00,0x40,0x28,0x01,0x10,0xe0,0xc8,0x00,0x81,
-0x07,0xf0,0x0f,0x80,0x0c,0xb0,0x28,0xf0,0x66,0x00,0x10,0xf0,0xc8,0x00,0x80,0x17,
-0xf0,0x0b,0xe4,0x5f,0x70,0x07,0xe0,0xc8,0x00,0x24,0x07,0xe0,0x56,0x65,0x10,0x53,
-0x6e,0x50,0x00,0xe2,0x2d,0x10,0x00,0xe3,0x15,0x10,0xfa,0x6a,0x1a,0x10,0x46,0x82,
-0x6f,0xe6,0x8a,0xee,0x99,0xf2,0x00,0xcc,0x00,0xdd,0x00,0xac,0x00,0x51,0x00,0x41,
-0x5f,0x2c,0xf0,0x2b,0x02,0xd0,0xd6,0x07,0xdb,0x20,0x3f,0x2e,0x74,0xf9,0xce,0x03,
-0xf2,0xf7,0xab,0x02,0xf3,0x3f,0x2f,0x7d,0x80,0x0f,0x75,0xf2,0xf7,0xe7,0x00,0xef,
-0xff,0x2f,0x7d,0x70,0x0f,0x75,0xf2,0xe7,0xba,0x01,0xf4,0x3f,0x2e,0x76,0xf3,0x8f,
-0x02,0xf2,0xe7,0x0b,0xff,0x50,0x2f,0x2e,0x70,0x01,0x00,0x02,0xf2,0xe7,0xb3,0x2c,
-0x20,0x2e,0x70,0x54,0x06,0x01,0x0b,0x00,0x12,0x1e,0x70,0x2d,0x01,0xc8,0x0f,0xa0,
-0x20,0x00,0x69,0x71,0x05,0xf0,0xe7,0x09,0xe7,0xcc,0xc8,0x03,0x13,0x60,0xc8,0x03,
-0xf0,0x06,0xff,0xf1,0xe8,0x1f,0x50,0x2f,0x77,0xf1,0xe8,0x0c,0xc3,0x9f,0x04,0xf2,
-0xe7,0x02,0xdf,0xe5,0x03,0xf1,0xe7,0x8a,0x00,0x80,0x40,0x72,0x00,0x05,0xee,0xff,
-0xff,0xf1,0xd2,0x05,0x20,0x57,0xf3,0xb0,0x03,0x23,0x46,0xf3,0x5f,0x49,0x02,0x7b,
-0x4d,0x00,0x20,0x1d,0x41,0xfa,0x00,0x00,0x56,0xf6,0x65,0x06,0xf8,0x02,0xf0,0x0d,
-0x7d,0xd8,0x00,0x07,0xf0,0x6f,0x86,0xf6,0x13,0x9f,0x0c,0xa0,0x0a,0xc9,0xff,0xf0,
-0xf6,0x00,0x7f,0x01,0x7f,0x0f,0x60,0x06,0xf0,0x06,0xf0,0xf6,0x28,0x19,0x20,0x0d,
-0x90,0x16,0x00,0x89,0x8f,0x56,0xf7,0x13,0x8f,0x00,0x9f,0xe9,0xf8,0x02,0x06,0x0b,
-0x00,0x09,0xf8,0x02,0xf0,0x01,0x08,0xdd,0x70,0x00,0x6e,0x08,0xf7,0x8f,0x62,0x5a,
-0xf0,0xe8,0x00,0xbb,0x9f,0xff,0xff,0x3b,0x00,0x0b,0x2a,0x70,0x9c,0x13,0x8f,0x0c,
-0xc0,0x0d,0x9b,0x29,0x68,0x63,0xd1,0x00,0x7f,0x00,0x15,0x50,0x3a,0x03,0x1c,0x01,
-0x13,0x36,0x01,0x16,0x00,0x04,0xb1,0x20,0x04,0xe3,0x49,0x00,0xe2,0x64,0xf0,0x07,
-0xb4,0x00,0x07,0xe0,0x08,0xfa,0xcf,0x20,0x19,0xf0,0x0f,0x80,0x0e,0x89,0xff,0xf0,
-0x1f,0x50,0x0a,0xb0,0x38,0xf0,0xac,0x05,0xf4,0x04,0x07,0xf0,0x0f,0x70,0x0d,0x93,
-0x7b,0xf0,0x09,0xf8,0xaf,0x38,0xde,0xf0,0x00,0x9d,0xc5,0x00,0x07,0x69,0x33,0x20,
-0x0b,0x30,0x06,0x00,0x20,0x1f,0x70,0x02,0x03,0x02,0x8b,0x77,0x53,0x1f,0x82,0x22,
-0x34,0x30,0x40,0x0a,0x15,0x01,0x50,0x03,0x60,0x10,0x00,0x7c,0xc6,0x00,0x05,0x50,
-0x03,0x70,0x52,0x49,0xf0,0x0f,0x80,0x0a,0xca,0x60,0x00,0x20,0x08,0xd0,0x95,0x21,
-0xdf,0x09,0xc1,0x48,0xf0,0x0a,0xf7,0x8f,0x7b,0xff,0xf0,0x00,0x8c,0xc7,0x50,0x03,
-0x26,0xf1,0x05,0x08,0xcd,0x70,0x00,0x7e,0x09,0xf7,0x8f,0x53,0x6b,0xf0,0xf8,0x00,
-0xbb,0x9d,0xef,0x1f,0x50,0x09,0xc0,0x18,0x01,0xd0,0x23,0x9f,0x0c,0xc1,0x1e,0x8b,
-0xff,0xf0,0x3e,0xff,0xc1,0x00,0x7f,0x26,0x74,0x20,0x07,0xe0,0x2c,0x32,0x10,0x26,
-0x7d,0x07,0xa0,0xfb,0x10,0x00,0x7f,0x60,0x04,0xea,0x00,0x0b,0xc0,0x91,0x07,0xa2,
-0x9f,0x30,0x02,0xdc,0x00,0x01,0xcf,0xee,0xfd,0x30,0xcd,0x29,0x04,0x87,0x37,0x51,
-0xd0,0xd7,0x07,0xcb,0x30,0x80,0x02,0x10,0x25,0x80,0x02,0x20,0xff,0xff,0x80,0x02,
-0x10,0x64,0x80,0x02,0x20,0xe6,0x2f,0x80,0x02,0x10,0x73,0x80,0x02,0x20,0xff,0xff,
-0x80,0x02,0x10,0x35,0x80,0x02,0x1f,0x60,0x80,0x02,0x09,0x00,0x08,0x0c,0x30,0x5a,
-0xca,0x30,0x26,0x0f,0x30,0xa8,0xdf,0x40,0xb5,0x5f,0x21,0x00,0xdb,0xa4,0x05,0x21,
-0x09,0xe0,0xc4,0x11,0x00,0x75,0x4e,0x40,0xf9,0x00,0x3e,0x90,0xe1,0x33,0x01,0x7d,
-0x54,0x22,0x02,0x66,0xc0,0x10,0x15,0x90,0x66,0x09,0x71,0x02,0x22,0x2a,0xe2,0x22,
-0x21,0x0b,0xa2,0x0e,0x30,0xf1,0x12,0x22,0x01,0x00,0x05,0x78,0x75,0x20,0xbf,0xfd,
-0x31,0x76,0x30,0xa5,0x48,0xf8,0xb1,0x0f,0x00,0x04,0x08,0xa0,0x8f,0x20,0x01,0xdc,
-0x00,0x00,0x1d,0xfd,0xdf,0xe3,0xf0,0x59,0x14,0xd4,0xa6,0x36,0x11,0x9f,0x9e,0x40,
-0x00,0x79,0x0d,0x42,0x45,0x53,0x00,0x26,0x2e,0x06,0x16,0x10,0x19,0x3e,0x42,0x7f,
-0x21,0x11,0x12,0x49,0x61,0x14,0x70,0xf9,0x40,0x21,0x14,0x42,0x6c,0x5a,0x20,0xef,
-0xc1,0xca,0x67,0x20,0x01,0xe9,0x70,0x42,0x00,0x49,0x34,0x30,0x6f,0xa6,0x69,0x70,
-0x67,0xb3,0xbe,0xfc,0x70,0x00,0x02,0x21,0x18,0xe1,0x12,0x21,0x8f,0x8d,0x0e,0xf1,
-0x03,0x22,0x21,0x11,0x10,0x00,0xce,0xdd,0xde,0xee,0x00,0x00,0x47,0x76,0x66,0x9f,
-0x10,0x00,0x13,0x4c,0x2a,0x0a,0xf2,0x28,0x75,0xee,0xff,0x60,0x00,0x36,0x66,0x65,
-0x8d,0x0e,0x20,0x06,0xef,0xf8,0x0f,0x40,0x6f,0x72,0x15,0xe9,0xbd,0x00,0x00,0x56,
-0x11,0x41,0x8f,0x40,0x03,0xeb,0xe4,0x5a,0x10,0xc1,0x9a,0x0e,0x40,0xd1,0x00,0x00,
-0x25,0x11,0x3f,0x19,0x53,0xf4,0x40,0x10,0xaa,0x08,0x1a,0x00,0x70,0x36,0x26,0x8f,
-0x00,0xa4,0x5a,0x1a,0x5f,0xa4,0x5a,0x03,0xed,0x18,0x11,0x04,0x45,0x0d,0xd0,0x02,
-0xef,0xef,0x50,0x0f,0x70,0x00,0x0b,0xd1,0x09,0xe0,0x0f,0x70,0x2b,0x2e,0x25,0xf2,
-0x0e,0x07,0x00,0xe0,0x0b,0xd1,0x0a,0xe0,0x0e,0xc8,0x60,0x02,0xdf,0xfe,0x40,0x0e,
-0xdb,0x80,0xd5,0x10,0x10,0x0e,0xf3,0x06,0x11,0xc0,0x07,0x00,0x20,0x04,0xf2,0x07,
-0x00,0xce,0x24,0x48,0xf7,0x79,0x4e,0x80,0x00,0x9e,0xfe,0xed,0xb9,0x2e,0xb3,0x53,
-0x01,0xb3,0x5a,0x03,0x35,0x0a,0x30,0x04,0xbd,0xa2,0x85,0x0c,0xf0,0x22,0xf9,0x6c,
-0xd0,0x1f,0x50,0x00,0x8d,0x00,0x2f,0x21,0xf6,0x00,0x09,0xe0,0x03,0xf3,0x1f,0x60,
-0x00,0x5f,0xca,0xee,0x01,0xfa,0x63,0x00,0x6d,0xfb,0x20,0x1f,0xed,0x80,0x00,0x5f,
-0x00,0x21,0xf6,0x00,0x8e,0xef,0xff,0xff,0x4f,0x60,0x02,0x55,0x54,0x42,0x01,0x0c,
-0x78,0x01,0xa9,0x27,0x00,0x0f,0x03,0x15,0x40,0xaf,0x3f,0x11,0xf3,0xf8,0x0a,0x12,
-0x5f,0x95,0x43,0x17,0x12,0x4a,0x5a,0xf0,0x04,0x25,0x30,0x00,0x6d,0x00,0x9f,0xef,
-0xb0,0x07,0xe0,0x3f,0x50,0x4f,0x50,0x7e,0x07,0xe0,0x00,0xe8,0x8a,0x25,0xf1,0x02,
-0x0e,0x80,0x7e,0x03,0xf5,0x05,0xf4,0x07,0xe0,0x08,0xff,0xf9,0x00,0x7e,0x00,0x01,
-0x31,0xfd,0x06,0x31,0x20,0x00,0x7e,0xf7,0x11,0xc5,0xe0,0x33,0x4f,0x86,0x85,0x7e,
-0x0f,0xff,0xfe,0xdb,0x47,0xe0,0xfb,0x01,0x04,0xc2,0x44,0x01,0x30,0x01,0xf0,0x0f,
-0x03,0xbd,0xb3,0x00,0xe8,0x02,0xfa,0x6b,0xe1,0x0e,0x80,0x7f,0x00,0x0f,0x40,0xe8,
-0x06,0xf0,0x01,0xf5,0x0e,0x80,0x1e,0xda,0xde,0x00,0xe8,0x00,0x19,0xf8,0xbe,0x54,
-0xa0,0x3f,0x30,0x20,0xe8,0x8e,0xee,0xff,0xff,0x6e,0x82,0x50,0x37,0x30,0xe8,0x00,
-0x03,0x5c,0x41,0x00,0xd1,0x0b,0x12,0x31,0x78,0x13,0x20,0x04,0xf5,0xb3,0x00,0x11,
-0x3f,0xe7,0x0a,0x11,0x02,0xb1,0x00,0x21,0x03,0x41,0x23,0x1c,0x01,0x21,0x1f,0x41,
-0x1f,0xa0,0x04,0xf7,0x02,0x21,0x10,0x0b,0x3d,0x70,0x01,0xf3,0x01,0x21,0x04,0xf4,
-0x40,0x49,0x40,0x0c,0xe7,0x6c,0xf2,0x62,0x04,0x20,0xcc,0x92,0xfd,0x0b,0x21,0x90,
-0x07,0x3e,0x6c,0x00,0x36,0x12,0x62,0x13,0x3c,0xc3,0x39,0xe3,0x32,0xfd,0x02,0x06,
-0x65,0x26,0x0f,0x3d,0x02,0x0a,0x11,0x0c,0x20,0x5d,0x40,0x09,0xd3,0x39,0xd0,0xb3,
-0x22,0x33,0x3a,0xe3,0x32,0x1b,0x37,0x01,0xee,0x67,0x00,0x30,0x43,0x71,0x80,0x00,
-0x00,0x2f,0xc5,0x47,0xfa,0x21,0x27,0x10,0x7f,0x06,0x00,0x00,0x6d,0x0a,0x30,0x2e,
-0xd7,0x69,0x65,0x58,0x26,0x9c,0xcb,0x86,0x18,0x30,0x4c,0xff,0xf7,0xc8,0x03,0x31,
-0xa3,0x26,0xf5,0x04,0x20,0x00,0x4d,0x3d,0x11,0x8f,0x68,0x00,0x20,0x04,0xf6,0xb1,
-0x69,0x00,0x1d,0x53,0x18,0xc1,0x29,0x3e,0x00,0x40,0x45,0x10,0xfe,0x6f,0x38,0x6e,
-0x25,0x55,0x5a,0xe4,0x44,0x42,0x2b,0x50,0x07,0x9a,0x5b,0x17,0x01,0xe4,0x05,0x44,
-0x4b,0xff,0xd6,0x00,0xc6,0x03,0x21,0x0a,0xe0,0xb6,0x32,0x41,0x8f,0x30,0x01,0xdc,
-0xbf,0x11,0x23,0xfd,0x20,0x1c,0x5d,0x01,0x0a,0x13,0x16,0x34,0xc1,0x48,0x01,0x9d,
-0x33,0x11,0x58,0x4b,0x52,0x12,0x09,0x0a,0x13,0x32,0x9e,0x00,0x40,0x87,0x21,0x13,
-0x12,0x0a,0x13,0x05,0x21,0x4f,0x02,0xcd,0x03,0x12,0x1b,0xcd,0x03,0x10,0x30,0xd8,
-0x67,0x11,0xbd,0x58,0x5a,0xa1,0x6f,0xb7,0x7a,0xf7,0x00,0x00,0x04,0xac,0xca,0x50,
-0x39,0x3b,0x24,0x33,0x32,0xe7,0x2d,0x20,0x18,0xe0,0xcd,0x15,0x2f,0xde,0xfe,0xcd,
-0x03,0x1a,0xa0,0x08,0xef,0xfe,0x80,0x00,0x00,0x8f,0x61,0x26,0xf7,0x3d,0x2b,0x00,
-0x94,0x03,0x20,0xae,0x30,0x0a,0x6c,0x10,0x1c,0x43,0x2f,0x00,0x4e,0x2f,0x31,0x00,
-0x00,0x47,0x6b,0x5e,0x63,0xae,0xee,0xff,0xff,0xee,0xeb,0x18,0x01,0x05,0x3f,0x55,
-0x11,0x9f,0x31,0x37,0x14,0x6f,0x06,0x00,0x02,0x66,0x12,0x12,0x25,0xcd,0x63,0x02,
-0xba,0x12,0x10,0x6e,0xec,0x42,0x03,0xf1,0x01,0x21,0x0a,0xd0,0x69,0x12,0x41,0x7f,
-0x51,0x14,0xeb,0x61,0x0f,0x23,0xfa,0x10,0x27,0x00,0x01,0x58,0x16,0x00,0xca,0x13,
-0x45,0x6a,0xf6,0x55,0x54,0x60,0x3d,0x27,0x03,0x90,0xca,0x13,0x11,0x7f,0xca,0x13,
-0xb1,0x9f,0x83,0xee,0x40,0x00,0x01,0xee,0x50,0x01,0xaf,0x60,0x92,0x5c,0x13,0x32,
-0x0a,0x0a,0xf0,0x07,0x01,0xad,0xc3,0x00,0x7e,0x00,0xdc,0x6a,0xf1,0x07,0xe0,0x3f,
-0x20,0x0f,0x60,0x7f,0x05,0xf0,0x00,0xd8,0x07,0xf0,0x0b,0x00,0xf0,0x08,0x6f,0x00,
-0xdc,0x6a,0xe1,0x06,0xf0,0x01,0xac,0xa2,0x00,0x6f,0x03,0x33,0x34,0x68,0x76,0xf0,
-0xff,0xff,0xfd,0xb6,0x6f,0xab,0x1d,0x00,0xaa,0x42,0x91,0x31,0xff,0xff,0x00,0x03,
-0xf3,0x02,0x38,0xf0,0xde,0x29,0x33,0x00,0x01,0xb1,0xfb,0x50,0x02,0x05,0x41,0xc0,
-0x50,0x00,0x6e,0xfe,0x50,0x08,0xe0,0x03,0xf7,0x39,0xf2,0x08,0x73,0x0c,0xf0,0x10,
-0xf5,0x07,0xe0,0x05,0xf3,0x04,0xf3,0x07,0xf0,0x00,0xaf,0xef,0x90,0x07,0xf0,0x00,
-0x02,0x42,0x01,0x07,0xf0,0x5c,0xcc,0xdd,0xff,0x88,0xf0,0x26,0x6c,0xd5,0x31,0x70,
-0x02,0xc1,0xc0,0x4f,0xff,0xf0,0x00,0x05,0x60,0x04,0x4a,0xf0,0x00,0x0b,0xd3,0x1d,
-0x20,0x2f,0x50,0x9a,0x02,0x20,0x2f,0x62,0xd5,0x01,0x11,0x1f,0x56,0x18,0x10,0x01,
-0xc8,0x34,0x00,0x51,0x15,0xf0,0x21,0x03,0x20,0x0a,0xff,0xf9,0x00,0xba,0x06,0xf3,
+0x9f,0x35,0xfe,0xe5,0xba,0x00,0x00,0x63,0x5f,0xe8,0x01,0x10,0x14,0x47,0x03,0x40,
+0x00,0x08,0xf0,0x2a,0x46,0x00,0x11,0xee,0x4c,0x00,0x20,0x9f,0xfc,0x19,0x00,0xf4,
+0x02,0x8f,0x73,0xed,0x20,0x00,0x00,0xaf,0x60,0x01,0xcf,0x30,0x00,0x08,0x20,0x00,
+0x00,0x63,0x50,0x02,0x40,0x46,0x00,0x00,0xe7,0x66,0x00,0x40,0x0e,0x70,0x00,0xad,
+0x0b,0x00,0x20,0x0c,0xb0,0x0b,0x00,0xf1,0x17,0xed,0x07,0x88,0xf7,0x00,0x3f,0xf3,
+0xbc,0xcf,0x70,0x09,0xed,0xa0,0x00,0xe8,0x01,0xf7,0x5f,0x20,0x0e,0x80,0xae,0x00,
+0xdb,0x00,0xe8,0x3f,0x40,0x03,0xf3,0x0e,0x83,0x60,0x00,0x05,0x10,0xe8,0x00,0xdd,
+0x01,0x00,0x06,0x00,0x11,0xe7,0x0b,0x00,0x12,0x60,0xa4,0x01,0x00,0x58,0x00,0xc0,
+0x10,0x00,0x3d,0x10,0x00,0xc9,0x00,0x05,0xf2,0x00,0x0d,0x90,0x6b,0x02,0xf2,0x0e,
+0xd9,0x00,0x0d,0xf1,0x3f,0xff,0x90,0x05,0xff,0xa0,0x44,0xd9,0x01,0xeb,0x4f,0x70,
+0x0c,0x91,0xdd,0x10,0x6f,0x50,0xd9,0x7c,0x10,0x00,0x56,0x0c,0x80,0xb1,0x01,0x10,
+0x4e,0xd0,0x05,0x51,0x01,0x55,0x55,0x54,0xf8,0x4d,0x00,0x01,0x16,0x00,0x07,0x63,
+0x00,0x13,0x41,0x3a,0x02,0x70,0x2c,0x00,0x00,0xd7,0x00,0x05,0xf1,0x21,0x00,0x10,
+0x7f,0x21,0x00,0xf1,0x0d,0x0b,0xe0,0x3b,0xbf,0x80,0x02,0xff,0x72,0x99,0xf8,0x00,
+0xcd,0x9f,0x20,0x0e,0x80,0x8f,0x30,0xcd,0x10,0xe8,0x6f,0x50,0x01,0xc9,0x0e,0x82,
+0x20,0x42,0x00,0x20,0x0e,0x60,0x42,0x00,0x61,0xf7,0x00,0x00,0x52,0x00,0x0f,0x4a,
+0x00,0x10,0xf8,0xc3,0x03,0x20,0x0f,0xff,0x4c,0x05,0x13,0x13,0xc1,0x03,0x00,0xb3,
+0x00,0x70,0xb1,0x00,0x06,0xd0,0x00,0x05,0xf2,0x7b,0x03,0xf0,0x14,0x08,0xf0,0x04,
+0x5a,0xf0,0x00,0x0e,0xf5,0x0e,0xff,0xf0,0x00,0x8e,0xaf,0x20,0x07,0xf0,0x04,0xf5,
+0x0b,0xe1,0x07,0xe0,0x3f,0x80,0x00,0xba,0x07,0xe0,0x46,0x00,0x00,0x01,0x04,0xa0,
+0x5e,0x06,0xe1,0x56,0x40,0x00,0x0b,0xee,0xee,0xdf,0xe0,0x00,0x00,0x11,0x11,0x19,
+0xe0,0x53,0x00,0x31,0xc0,0x00,0x1f,0x64,0x00,0x00,0x0c,0x00,0x10,0xe0,0xa8,0x02,
+0x23,0x44,0x20,0xde,0x05,0x10,0x3d,0x8c,0x00,0x02,0xb8,0x00,0xf0,0x00,0x8f,0x00,
+0x01,0xe8,0x00,0x0d,0xe0,0x3f,0xff,0x80,0x05,0xff,0xa0,0x34,0xe8,0x10,0x01,0x20,
+0x0e,0x81,0x10,0x01,0x50,0xe8,0x8c,0x10,0x00,0x55,0xfa,0x00,0xf2,0x14,0x13,0x20,
+0x73,0x00,0x01,0xaf,0xff,0xe7,0x00,0x00,0xbe,0x51,0x28,0xf5,0x00,0x0f,0x80,0x00,
+0x0e,0x90,0x00,0xec,0x10,0x05,0xf7,0x00,0x03,0xef,0xef,0xfb,0x00,0x00,0x00,0x46,
+0x52,0xe7,0x02,0xf0,0x07,0x52,0x00,0x1c,0x10,0x07,0xe0,0xe7,0x00,0x3f,0x30,0x07,
+0xe0,0xf6,0x00,0x3f,0x20,0x06,0xf0,0xf6,0x00,0x6f,0x10,0x06,0x00,0xf0,0x19,0x8f,
+0x25,0xac,0xf0,0xf6,0x00,0xdf,0x76,0xac,0xf0,0xf6,0x02,0xfd,0xd0,0x06,0xf0,0xe6,
+0x09,0xe2,0xf4,0x06,0xf0,0xe6,0x2f,0x60,0xbb,0x06,0xf0,0xe6,0x9c,0x00,0x2f,0x26,
+0xe0,0xe6,0x42,0x00,0x03,0x07,0xe0,0x9c,0x03,0x00,0x42,0x00,0x00,0xbb,0x04,0x10,
+0xe7,0xbd,0x06,0x27,0xa0,0xd6,0xa8,0x03,0x00,0x48,0x03,0x20,0x05,0xe0,0x16,0x02,
+0x00,0xe2,0x02,0xf4,0x14,0x0e,0x90,0x05,0xf0,0xe7,0x00,0x2f,0x83,0xef,0xf0,0xe7,
+0x00,0x9f,0xf2,0x48,0xf1,0xe7,0x02,0xf6,0xcc,0x04,0xf1,0xe7,0x1d,0xb0,0x1e,0x94,
+0xf1,0xe7,0x7b,0x00,0x02,0x63,0xf0,0xd6,0x36,0x00,0x41,0xff,0xff,0xff,0xf3,0xa8,
+0x03,0x11,0xf5,0xd0,0x02,0x0d,0x06,0x00,0x21,0x00,0x71,0x2d,0x02,0x10,0x21,0x60,
+0x00,0x20,0xf0,0xd8,0x48,0x03,0x14,0xf0,0xa8,0x03,0xf1,0x0e,0x2f,0x72,0xef,0xf0,
+0xd9,0x00,0x8f,0xe1,0x48,0xf0,0xd8,0x01,0xf8,0xdb,0x05,0xf0,0xd8,0x0c,0xc0,0x2f,
+0x75,0xf0,0xd8,0x7d,0x10,0x03,0x95,0xf0,0xd8,0xe9,0x05,0xd1,0xd8,0x00,0x06,0xb0,
+0x05,0xe0,0xe8,0x00,0x09,0xe0,0x00,0x00,0x31,0x06,0x00,0x10,0x00,0x06,0x00,0x21,
+0x01,0x20,0x20,0x04,0x43,0xf7,0x00,0x00,0x33,0xd8,0x01,0x50,0x30,0x52,0x00,0x0a,
+0xb0,0xb4,0x00,0x31,0x0b,0xb0,0x05,0xc0,0x00,0xf0,0x1e,0x37,0xf1,0xe7,0x00,0x3f,
+0xc3,0xff,0xf1,0xe7,0x00,0xbe,0xf7,0x04,0xf1,0xe7,0x05,0xf5,0x7f,0x44,0xf1,0xe7,
+0x3f,0x90,0x08,0xe4,0xf1,0xe7,0x57,0x00,0x00,0x11,0x70,0x51,0x00,0x06,0xde,0xee,
+0xee,0xe3,0x00,0x02,0x67,0x66,0x66,0xf5,0x48,0x00,0x21,0x35,0xf5,0x98,0x07,0x41,
+0xf2,0x00,0x07,0xf1,0x65,0x06,0xa3,0xfe,0xef,0xff,0xfb,0x00,0x00,0x45,0x55,0x55,
+0x42,0xea,0x00,0x2e,0x06,0x60,0x20,0x01,0x10,0xff,0x20,0x01,0x66,0xe2,0x37,0xf1,
+0xe7,0x02,0xf7,0x20,0x01,0x51,0x7c,0x00,0x02,0x73,0xd0,0x62,0x01,0x61,0x00,0xc5,
+0x00,0x00,0x00,0x5f,0xa1,0x00,0x20,0xcf,0x40,0x7f,0x01,0x20,0xfd,0xf5,0xde,0x07,
+0xf3,0x00,0x80,0x9f,0x70,0x00,0x09,0xf6,0x00,0x06,0xf8,0x00,0x05,0x20,0x00,0x00,
+0x23,0x82,0x01,0x10,0x4b,0xf0,0x02,0x20,0x07,0xf0,0x38,0x02,0xf1,0x12,0x9d,0x04,
+0xff,0xf8,0x00,0x0d,0xc0,0x04,0x5e,0x80,0x04,0xff,0x40,0x33,0xe8,0x00,0xdc,0xae,
+0x6f,0xff,0x80,0xae,0x21,0xdc,0x00,0xe8,0x8e,0x30,0x02,0xd7,0x0e,0x83,0x10,0xf0,
+0x02,0x20,0x0c,0x70,0xf0,0x02,0x10,0xe9,0xf0,0x02,0x02,0x45,0x03,0x10,0xe9,0xf0,
+0x02,0x18,0x0d,0xf0,0x02,0x01,0xa3,0x02,0x00,0xff,0x05,0x00,0x38,0x01,0x21,0xf0,
+0x00,0x32,0x09,0x01,0x14,0x00,0xf0,0x08,0xce,0x9f,0x50,0x00,0x00,0x00,0xaf,0x40,
+0x9f,0x60,0x00,0x00,0xce,0x40,0x00,0x7f,0x80,0x00,0x29,0x10,0x39,0x00,0x36,0xa4,
+0x00,0x02,0x5e,0x07,0x10,0x8f,0x1f,0x08,0xf2,0x00,0x55,0x5b,0xf5,0x55,0x55,0x09,
+0xff,0xee,0xee,0xee,0xee,0xe2,0x00,0x00,0x02,0x34,0x06,0x11,0xac,0x06,0x00,0x20,
+0x1f,0xe1,0x06,0x00,0x30,0x0b,0xee,0xc1,0xaa,0x03,0xf4,0x0f,0xe3,0x2d,0xd3,0x00,
+0x00,0x3f,0xb1,0x67,0x09,0xf4,0x00,0x01,0x20,0x0a,0xc0,0x01,0x00,0x02,0x55,0x55,
+0xcd,0x55,0x55,0x30,0x9f,0xff,0xee,0xef,0xff,0xfd,0x63,0x02,0xb2,0xbe,0xee,0xee,
+0xee,0x10,0x00,0x04,0x67,0x76,0x69,0xf3,0x97,0x00,0x11,0x30,0x8f,0x08,0x02,0x0d,
+0x00,0x14,0x3f,0xc1,0x09,0x05,0x68,0x00,0x21,0xad,0x00,0x14,0x04,0x01,0xae,0x08,
+0xf3,0x09,0x0a,0xff,0xb0,0x00,0x00,0x00,0x1b,0xf4,0x3e,0xc1,0x00,0x00,0x3e,0xc2,
+0x46,0x1b,0xf3,0x00,0x01,0x40,0x0a,0xc0,0x03,0x10,0x8f,0x00,0xf2,0x00,0x9f,0xff,
+0xff,0xff,0xff,0xfd,0x02,0x55,0x44,0x44,0x44,0x45,0x30,0x00,0x13,0xc1,0x07,0x02,
+0xe7,0x08,0x15,0x9d,0xce,0x07,0x12,0x20,0x65,0x09,0x15,0x80,0xce,0x07,0x21,0x01,
+0x30,0x1c,0x00,0x12,0x9c,0x68,0x00,0x11,0xe0,0x68,0x00,0x21,0xfe,0xc0,0x68,0x00,
+0xfd,0x00,0x2e,0xd2,0x00,0x00,0x3f,0xc2,0x46,0x1a,0xf3,0x00,0x01,0x30,0x0a,0xc0,
+0x02,0xd0,0x00,0x11,0x01,0xfe,0x09,0xa1,0xdf,0xff,0xa1,0x00,0x00,0x04,0xfa,0x31,
+0x5d,0xd0,0x30,0x01,0x21,0x6f,0x10,0x66,0x07,0x10,0xf0,0x47,0x00,0x20,0xdf,0xf4,
+0xc9,0x00,0x25,0x55,0x40,0x60,0x03,0x41,0x06,0x30,0x00,0x7d,0x60,0x09,0x90,0xe0,
+0x00,0x1f,0x60,0x00,0x7e,0x00,0x05,0xf7,0x0b,0x00,0xf0,0x0b,0xdf,0xf2,0x00,0x7e,
+0x00,0x8f,0x3d,0xd1,0x07,0xe0,0x7f,0x40,0x1d,0xc0,0x7e,0x0d,0x40,0x81,0x19,0x07,
+0xf0,0x00,0x1f,0x50,0x00,0x7f,0x3e,0x03,0xd1,0x07,0xf0,0x54,0x5f,0x97,0x88,0x7f,
+0x2d,0xee,0xed,0xca,0x67,0xf0,0x18,0x0a,0x14,0x00,0xa1,0x01,0x00,0x59,0x09,0x12,
+0x05,0xe2,0x00,0x12,0xae,0x90,0x01,0x11,0xf3,0x90,0x01,0x20,0xec,0xe2,0xc6,0x00,
+0xf3,0x02,0xf3,0x1c,0xe3,0x00,0x00,0x2d,0xd3,0x00,0x08,0xf6,0x00,0x03,0x60,0x00,
+0x00,0x02,0x30,0x85,0x00,0x20,0xaf,0xff,0x01,0x00,0x71,0x02,0x44,0x44,0xae,0x33,
+0x33,0x20,0xc3,0x08,0x24,0x00,0x00,0xf1,0x08,0x03,0x0d,0x00,0x18,0x8d,0xe0,0x0a,
+0x27,0x01,0x20,0x22,0x01,0x21,0x0d,0xd0,0x27,0x00,0x20,0xff,0x90,0x06,0x00,0xf0,
+0x04,0xf6,0x5f,0xa0,0x00,0x00,0x2c,0xe5,0x00,0x3d,0xd2,0x00,0x02,0x71,0x00,0x00,
+0x06,0x20,0x01,0x33,0x01,0x00,0x21,0x20,0xbf,0x62,0x00,0xb0,0x00,0x11,0x11,0x3f,
+0x51,0x11,0x00,0x00,0x58,0x02,0xf4,0x8f,0x00,0x31,0xe0,0x2f,0x40,0xd0,0x01,0x10,
+0x71,0x0d,0x00,0x10,0xe2,0x7e,0x07,0x21,0x00,0x9f,0xd4,0x0b,0x21,0x00,0x22,0x0d,
+0x00,0x0f,0x5a,0x02,0x03,0x12,0xd1,0x5a,0x02,0x81,0xe3,0x00,0x00,0x3f,0xa1,0x00,
+0x09,0xf4,0x94,0x00,0x31,0x01,0x00,0x09,0x61,0x00,0x74,0xe0,0x25,0x55,0x59,0xf5,
+0x55,0x54,0xd3,0x0a,0x22,0x00,0x02,0xe9,0x02,0x12,0xbf,0x19,0x0a,0x02,0x08,0x07,
+0xf0,0x01,0x83,0xee,0x30,0x00,0x01,0xdf,0x60,0x01,0xbf,0x50,0x00,0x06,0x10,0x00,
+0x00,0x43,0x35,0x01,0x16,0x70,0x09,0x03,0x21,0x0c,0xc0,0x77,0x02,0x10,0xf2,0x06,
+0x00,0xf7,0x08,0xdd,0xcd,0x10,0x00,0x00,0x0b,0xe2,0x1d,0xc1,0x00,0x01,0xce,0x30,
+0x01,0xdd,0x20,0x05,0xa1,0x00,0x00,0x08,0x50,0x00,0x01,0x00,0xc4,0x7d,0xdd,0xdd,
+0xdd,0xde,0xeb,0x37,0x77,0x77,0x77,0x77,0x74,0xb0,0x00,0x25,0x0b,0xc0,0xaf,0x00,
+0xf2,0x08,0x01,0xdd,0xdd,0x20,0x00,0x00,0x5e,0xc1,0x1b,0xf6,0x00,0x05,0xe7,0x00,
+0x00,0x6d,0x40,0x13,0x32,0x22,0x22,0x22,0x32,0x98,0x02,0x51,0x01,0x11,0x11,0x11,
+0x11,0xcd,0x0a,0xf0,0x04,0xfe,0x10,0x00,0x35,0x55,0x55,0x8f,0x20,0x00,0x24,0x44,
+0x44,0x8f,0x20,0x00,0xdf,0xff,0xff,0xfe,0xda,0x09,0x01,0x20,0x04,0x10,0xee,0x11,
+0x01,0x21,0x15,0x55,0xd5,0x00,0x21,0x01,0x10,0xa2,0x00,0x11,0xa0,0x60,0x00,0x11,
+0xb0,0xda,0x00,0x11,0xf9,0x98,0x02,0xf1,0x06,0x5f,0xa0,0x00,0x04,0xed,0x30,0x03,
+0xde,0x10,0x03,0x50,0x00,0x00,0x04,0x00,0x35,0x54,0x44,0x44,0x44,0x53,0x66,0x00,
+0x13,0xea,0xa9,0x00,0xd0,0xc7,0x00,0x00,0x6d,0x00,0x00,0xea,0x44,0x44,0xaf,0x00,
+0x00,0xef,0x8b,0x01,0x21,0x00,0xe7,0x38,0x02,0xa5,0xef,0xfe,0xef,0xfe,0x00,0x00,
+0x14,0x44,0x44,0x42,0xbc,0x07,0x26,0x09,0xd0,0x61,0x03,0x20,0x9f,0xfa,0x11,0x00,
+0xf0,0x02,0xf6,0x3f,0xc1,0x00,0x02,0xee,0x40,0x02,0xcf,0x30,0x02,0x60,0x00,0x00,
+0x04,0x10,0x25,0x60,0x00,0x20,0x54,0x7e,0x60,0x00,0x13,0xec,0x36,0x00,0x20,0x04,
+0xcf,0xf5,0x02,0x44,0x3f,0xa3,0x25,0xed,0xf4,0x02,0x45,0x6f,0x50,0x00,0xbf,0xf3,
+0x02,0x34,0x25,0x54,0x00,0xd8,0x08,0x40,0x18,0x00,0x00,0xe6,0xb5,0x0a,0x20,0x0f,
+0x70,0x26,0x00,0x40,0xe7,0x00,0x08,0xf0,0xaf,0x04,0xf6,0x16,0xbf,0x20,0x00,0xe7,
+0x00,0x0f,0xf8,0x00,0x0e,0x70,0x06,0xfa,0xe0,0x00,0xe7,0x00,0xda,0x1f,0x70,0x0e,
+0x70,0x6f,0x20,0x8e,0x10,0xe8,0x1f,0x70,0x00,0xd8,0x0e,0x81,0x70,0x00,0x02,0x30,
+0xe8,0x18,0x08,0x11,0xe7,0x7a,0x02,0x02,0xe4,0x0b,0x03,0x60,0x07,0x10,0x3f,0x65,
+0x08,0x26,0x06,0xf1,0x70,0x08,0xf2,0x0b,0xe1,0x00,0x0d,0x90,0x05,0xfe,0xb0,0x00,
+0xd9,0x01,0xea,0x3f,0x80,0x0d,0x91,0xdc,0x00,0x4f,0x60,0xd9,0x69,0x00,0x00,0x34,
+0x0c,0x80,0xeb,0x00,0x9f,0x5e,0xff,0xff,0xff,0x50,0x01,0x55,0x44,0x44,0x70,0x08,
+0x07,0x00,0xb0,0x00,0x16,0x2d,0xb0,0x00,0x10,0x7f,0x79,0x00,0xf1,0x0e,0x0b,0xe0,
+0x00,0x0e,0x70,0x01,0xff,0x70,0x00,0xe7,0x00,0xad,0x8f,0x30,0x0e,0x70,0x7f,0x30,
+0xae,0x10,0xe7,0x5f,0x50,0x00,0xaa,0x0e,0x72,0x20,0x00,0x21,0x00,0x13,0x40,0x70,
+0x08,0x31,0x51,0x00,0x0f,0xa2,0x00,0xa0,0xf7,0x11,0x11,0x21,0x00,0x0e,0xff,0xff,
+0xff,0xd0,0x64,0x0a,0x14,0x10,0x70,0x08,0x60,0xc1,0x00,0x0b,0x70,0x00,0x04,0x21,
+0x09,0x00,0xbc,0x03,0x50,0x0c,0x90,0x00,0x0c,0xf3,0x06,0x00,0xf0,0x08,0x5f,0xcd,
+0x10,0x0c,0x90,0x02,0xe9,0x1d,0xc0,0x0d,0x90,0x2e,0xb0,0x02,0xe9,0x0d,0x90,0x47,
+0x00,0x00,0x13,0x0b,0x60,0xef,0x0c,0x80,0x56,0x10,0x00,0x2e,0xee,0xee,0xdf,0x80,
+0x70,0x08,0x21,0x1e,0x80,0x64,0x08,0x1e,0x60,0x70,0x08,0x03,0xd8,0x09,0x10,0x3c,
+0x8c,0x00,0x04,0x70,0x08,0x10,0x00,0x70,0x08,0xf0,0x0c,0x00,0x0e,0x80,0x04,0xff,
+0x90,0x00,0xe8,0x00,0xdb,0x4f,0x60,0x0e,0x81,0xcd,0x10,0x6f,0x40,0xe8,0x7b,0x10,
+0x00,0x55,0x0d,0x60,0x00,0x02,0x70,0x03,0x11,0x0f,0x06,0x05,0x40,0xf9,0x22,0x22,
+0xd9,0xec,0x00,0x20,0x0d,0x90,0xc3,0x00,0x13,0xd9,0x16,0x00,0x43,0x13,0x44,0x43,
+0x30,0x68,0x01,0x16,0x2c,0xc8,0x08,0x11,0x7f,0x6f,0x06,0x0a,0x58,0x00,0x11,0x80,
+0x58,0x00,0x17,0x7c,0xc8,0x08,0x11,0x00,0xc8,0x08,0x20,0xaf,0x52,0xc8,0x08,0x10,
+0x90,0xc8,0x08,0x15,0xdd,0xc8,0x08,0x50,0x00,0x00,0x46,0x52,0x00,0xf0,0x3f,0x00,
+0x00,0x00,0x00,0x06,0x10,0x00,0x0b,0x10,0x77,0x01,0xf4,0x00,0x03,0xf3,0x0b,0xb0,
+0x1f,0x50,0x00,0x3f,0x30,0xba,0x01,0xf5,0x00,0x05,0xf2,0x0c,0xa0,0x1f,0x50,0x00,
+0x6f,0x50,0xeb,0x01,0xf6,0x00,0x09,0xf8,0x1f,0xf0,0x1f,0xfe,0x90,0xcf,0xc4,0xff,
+0x31,0xf9,0x52,0x1f,0x9f,0x9d,0xd8,0x1f,0x50,0x07,0xe0,0xef,0x78,0xd0,0xf5,0x00,
+0xd8,0x09,0xe0,0x2f,0x2f,0x50,0x04,0x00,0x12,0x00,0x20,0xf5,0x00,0x01,0x00,0x21,
+0x0f,0x60,0x07,0x00,0x11,0xf6,0x06,0x00,0xf9,0x28,0x0e,0x40,0x00,0x00,0x04,0x60,
+0x02,0x80,0x00,0x00,0x00,0xad,0x00,0x7f,0x00,0x00,0x00,0x0c,0xb0,0x09,0xe0,0x00,
+0x00,0x00,0xfe,0x00,0xcf,0x20,0x00,0x00,0x6f,0xf5,0x3f,0xfa,0x00,0x00,0x1e,0x89,
+0xdb,0xd4,0xf4,0x00,0x0a,0xd0,0x1e,0xf3,0x09,0xe0,0x00,0x61,0x00,0x23,0x00,0x04,
+0x00,0x01,0x00,0x80,0x9f,0xff,0xff,0xff,0xee,0xed,0x03,0x55,0x01,0x00,0x10,0x40,
+0x11,0x00,0x21,0x03,0x00,0xb6,0x00,0xf0,0x14,0xf0,0x00,0x03,0xce,0xc2,0x00,0x7f,
+0x00,0x01,0xec,0x5c,0xe0,0x06,0xf0,0x00,0x6f,0x10,0x2f,0x40,0x6f,0x00,0x09,0xd0,
+0x00,0xf6,0x06,0xf1,0x00,0xac,0x00,0x0e,0x70,0x6f,0xff,0x99,0x0d,0x00,0x40,0xf4,
+0x41,0x6f,0x00,0x1a,0x00,0x30,0x01,0xf9,0x4c,0x27,0x00,0x54,0x05,0xef,0xd3,0x00,
+0x6f,0x41,0x00,0x00,0x01,0x00,0x03,0x0d,0x00,0x11,0xf1,0x07,0x00,0x12,0x5f,0x73,
+0x00,0x14,0x20,0x7c,0x00,0x90,0x09,0xdd,0x50,0x05,0xf0,0x00,0x0a,0xe6,0x9f,0x41,
+0x00,0xf0,0x0e,0xf6,0x00,0xd9,0x06,0xf0,0x00,0x2f,0x40,0x0a,0xb0,0x6f,0x66,0x11,
+0xf4,0x00,0xaa,0x06,0xff,0xf6,0x0e,0xa0,0x1e,0x70,0x6f,0x00,0x00,0x5f,0xff,0xc0,
+0x4e,0x00,0x27,0x25,0x40,0x41,0x00,0xa2,0xdf,0xff,0xff,0xfd,0x00,0x00,0x04,0x54,
+0x44,0x4a,0x68,0x00,0x11,0x8f,0x06,0x00,0x21,0x08,0xe0,0x07,0x00,0x11,0x8e,0x06,
+0x00,0x22,0x01,0x40,0x07,0x00,0xf1,0x26,0x00,0x00,0x05,0xa9,0x30,0x03,0xf2,0x00,
+0x07,0xfa,0xdf,0x20,0x4f,0x30,0x00,0xf8,0x00,0xe8,0x04,0xf3,0x00,0x2f,0x40,0x0b,
+0xb0,0x4f,0x30,0x02,0xf4,0x00,0xab,0x03,0xfa,0x84,0x1f,0x60,0x0c,0x90,0x3f,0xcb,
+0x50,0xae,0x68,0xf4,0x03,0xf3,0x00,0x00,0xae,0xd6,0x00,0x3f,0x30,0x0a,0x01,0xf2,
+0x02,0xf2,0x00,0x00,0x36,0x00,0x00,0x4f,0x20,0x00,0x09,0xf0,0x00,0x01,0x80,0x00,
+0x00,0x9f,0xb6,0x00,0xf3,0x03,0xf1,0x11,0x11,0x10,0x00,0x00,0x8f,0xff,0xff,0xff,
+0x30,0x00,0x00,0x23,0x22,0x22,0x20,0x00,0x38,0x01,0x20,0x06,0xaa,0x68,0x00,0xc1,
+0x09,0xf9,0xbf,0x30,0x3f,0x30,0x00,0xf7,0x00,0xd9,0x03,0xf3,0xd0,0x00,0xf0,0x04,
+0x3f,0xff,0xb2,0xf5,0x00,0xab,0x03,0xf6,0x41,0x0e,0xb0,0x1e,0x70,0x3f,0x20,0x00,
+0x5f,0xef,0xd0,0x5b,0x00,0x40,0x26,0x40,0x04,0x35,0x9f,0x00,0xf6,0x1b,0x01,0xcd,
+0xe2,0x00,0x00,0xd7,0x01,0xaa,0xaa,0xa2,0x00,0x0e,0x80,0x05,0x68,0x66,0x10,0x00,
+0xe7,0x00,0x4f,0xfe,0x30,0x00,0x0f,0x70,0x0b,0xb0,0xb9,0x00,0x00,0xef,0xfe,0x9c,
+0x3e,0x70,0x00,0x03,0x54,0x21,0xad,0x90,0xd0,0x00,0xb2,0x20,0x02,0xf2,0x00,0x09,
+0xfa,0xcf,0x20,0x3f,0x30,0x01,0x68,0x00,0xf1,0x0a,0x3f,0x30,0x0a,0xb0,0x3f,0xee,
+0x92,0xf4,0x00,0xbb,0x03,0xf7,0x53,0x0d,0xc4,0x5f,0x70,0x3f,0x30,0x00,0x3d,0xff,
+0x90,0x04,0xf2,0x34,0x00,0xf2,0x06,0x2b,0x00,0x00,0x01,0x55,0x55,0x56,0x60,0x00,
+0x00,0x7e,0xee,0xee,0xef,0x30,0x00,0x00,0x11,0x11,0x15,0xf3,0xc3,0x00,0x21,0x10,
+0x00,0x33,0x02,0x02,0x0d,0x00,0x74,0x60,0x00,0x01,0x45,0x54,0x44,0x40,0xa0,0x01,
+0xe6,0x07,0xbb,0x40,0x05,0xe0,0x00,0x0a,0xf8,0xbf,0x30,0x6f,0x00,0x00,0xf7,0xa0,
+0x01,0x31,0x55,0x11,0xf5,0xa0,0x01,0x21,0x0d,0xb0,0xa0,0x01,0x12,0x4f,0xa0,0x01,
+0x21,0x15,0x30,0xa0,0x01,0x11,0x11,0x1e,0x01,0x00,0x57,0x02,0x70,0x00,0x00,0x0a,
+0xe3,0x33,0x28,0xf0,0x9d,0x02,0x00,0x08,0x02,0x20,0x0a,0xd0,0x15,0x02,0x00,0x1a,
+0x00,0x83,0xfe,0x00,0x00,0x01,0x44,0x44,0x43,0x10,0x38,0x01,0x00,0x68,0x00,0x3e,
+0x06,0xf0,0x00,0x68,0x00,0x20,0xbb,0x41,0x68,0x00,0x2d,0xfa,0xa3,0x68,0x00,0xb1,
+0x3b,0x00,0x00,0x03,0x50,0x00,0x01,0x60,0x00,0x00,0xac,0x56,0x02,0x40,0x0a,0xfe,
+0xee,0xef,0x68,0x00,0xa3,0x66,0x65,0x9f,0x00,0x00,0x0a,0xc0,0x00,0x05,0xf0,0x82,
+0x00,0x00,0x68,0x00,0x12,0x44,0xa0,0x01,0x11,0x14,0x70,0x02,0x1f,0x06,0x70,0x02,
+0x01,0x20,0xff,0x71,0x70,0x02,0x2d,0xf6,0x51,0x70,0x02,0x01,0xbe,0x02,0xf1,0x01,
+0x12,0x01,0x50,0x00,0x00,0x05,0xef,0xff,0xb2,0x00,0x00,0x03,0xf9,0x21,0x3d,0xd0,
+0x6d,0x02,0x80,0x6f,0x10,0x00,0x06,0xf5,0x00,0x0b,0xf0,0x7c,0x00,0x82,0xdf,0xe5,
+0x00,0x00,0x00,0x02,0x55,0x30,0x35,0x01,0xf0,0x1e,0x16,0x00,0x00,0x07,0xbc,0x60,
+0x05,0xf1,0x00,0x0a,0xf8,0xaf,0x50,0x5f,0x10,0x00,0xf7,0x00,0xbb,0x04,0xf1,0x00,
+0x2f,0x40,0x09,0xd0,0x4f,0xff,0x61,0xf5,0x00,0x9c,0x04,0xf6,0x51,0x0d,0xc1,0x2e,
+0x80,0x4f,0x20,0x00,0x3e,0xff,0xc0,0xa0,0x01,0xb1,0x03,0x20,0x00,0x2e,0x00,0x00,
+0x02,0x44,0x44,0x44,0x40,0xd8,0x02,0x70,0xfe,0x30,0x00,0x00,0x49,0x00,0x4a,0x80,
+0x01,0x20,0xe0,0x07,0x9c,0x01,0xf2,0x02,0x7e,0x00,0x7e,0x00,0x00,0x00,0xef,0xff,
+0xff,0xff,0xa0,0x00,0x03,0x44,0x44,0x43,0x31,0x05,0x03,0xf3,0x22,0x41,0x00,0x9c,
+0xa2,0x05,0xf0,0xe7,0x0a,0xe7,0xdd,0x05,0xf1,0xe7,0x0f,0x70,0x3f,0x35,0xf1,0xe7,
+0x2f,0x40,0x1f,0x45,0xff,0xf7,0x1f,0x50,0x1f,0x44,0xf6,0xf7,0x0d,0xa0,0x6f,0x14,
+0xf1,0xe7,0x04,0xfe,0xf7,0x04,0xf1,0xe7,0x00,0x25,0x20,0x02,0xc0,0xc5,0x9c,0x01,
+0xf0,0x05,0x01,0xff,0xff,0xff,0xf4,0x00,0x02,0xf6,0x22,0x23,0xf5,0x00,0x02,0xf4,
+0x00,0x01,0xf5,0x00,0x03,0xf5,0x06,0x00,0x11,0x02,0x18,0x00,0x5f,0x00,0x34,0x44,
+0x43,0x20,0x08,0x04,0x05,0x21,0xf5,0x51,0x08,0x04,0x20,0xff,0x69,0xfb,0x03,0x12,
+0xf0,0x08,0x04,0x22,0x00,0x09,0x0d,0x00,0x01,0x08,0x04,0x20,0xbb,0x51,0x08,0x04,
+0x2f,0xf9,0x93,0x08,0x04,0x18,0x10,0x03,0x98,0x01,0xf0,0x03,0x70,0x03,0xf2,0x00,
+0x0b,0xe6,0x9f,0x40,0x3f,0x64,0x11,0xf6,0x00,0xda,0x03,0xff,0xf7,0x3f,0x38,0x03,
+0x02,0xa0,0x03,0x20,0xf4,0x10,0x98,0x01,0xe1,0x3f,0xff,0x70,0x5f,0xff,0xd1,0x03,
+0xf4,0x20,0x00,0x26,0x50,0x00,0x4f,0x3b,0x00,0x00,0x93,0x03,0xf0,0x10,0x02,0xaf,
+0xff,0xb3,0x00,0x00,0x01,0xed,0x53,0x4b,0xf1,0x00,0x00,0x4f,0x40,0x00,0x2f,0x50,
+0x00,0x02,0xf8,0x00,0x06,0xf4,0x00,0x00,0x08,0xfe,0xde,0xf9,0x00,0xf8,0x02,0x27,
+0x41,0x00,0x6f,0x00,0xf1,0x13,0x6e,0x00,0x6d,0xd8,0x00,0x07,0xe0,0x5f,0x76,0xf7,
+0x00,0x6e,0x0c,0xa0,0x09,0xd0,0x06,0xe0,0xf7,0x00,0x6f,0x01,0x7e,0x0f,0x60,0x05,
+0xf8,0xff,0xf0,0xf7,0x00,0x6f,0x02,0x8f,0x16,0x00,0x93,0xf0,0x7f,0x55,0xf7,0x00,
+0x6f,0x00,0x9f,0xf9,0xc0,0x00,0x11,0x6f,0xbe,0x00,0x11,0xe0,0x42,0x00,0x00,0x05,
+0x00,0x28,0x05,0xd0,0x44,0x05,0xf1,0x1e,0x49,0x92,0x00,0x06,0xe0,0x05,0xfb,0xdf,
+0x20,0x07,0xf0,0x0d,0x90,0x0e,0x80,0x07,0xf0,0x0f,0x50,0x0b,0xb2,0x5a,0xf0,0x0f,
+0x50,0x0a,0xb8,0xef,0xf0,0x0e,0x70,0x0c,0x90,0x07,0xf0,0x09,0xe6,0x8f,0x40,0x07,
+0xe0,0x00,0x9e,0xd6,0x00,0xd3,0x01,0x00,0x06,0x00,0x20,0x05,0x40,0x06,0x00,0x80,
+0x0c,0xb0,0x00,0x03,0x70,0x00,0x0c,0xa0,0x15,0x00,0xf4,0x01,0x0d,0xb1,0x11,0x12,
+0x10,0x00,0x0b,0xff,0xff,0xff,0xf0,0x00,0x00,0x22,0x22,0x21,0xb8,0x00,0xf3,0x17,
+0x7c,0xc5,0x00,0x06,0xf0,0x09,0xf7,0x8f,0x40,0x06,0xf0,0x0f,0x80,0x0b,0xa0,0x37,
+0xf0,0x1f,0x50,0x09,0xc9,0xff,0xf0,0x0f,0x70,0x0a,0xb0,0x17,0xf0,0x0a,0xe6,0x7f,
+0x60,0x06,0xf0,0x00,0x9d,0xd7,0xab,0x00,0xe0,0x03,0x80,0x00,0x03,0x66,0x66,0x67,
+0x50,0x00,0x0b,0xee,0xed,0xde,0xe0,0xf4,0x01,0xb1,0x19,0xe0,0x00,0x0e,0xff,0xff,
+0xff,0xb0,0x00,0x0f,0x80,0x43,0x06,0x01,0x60,0x00,0x56,0x02,0x55,0x54,0x44,0x20,
+0x60,0x00,0xf1,0x16,0x04,0xf1,0x09,0xf7,0x9f,0x40,0x04,0xf1,0x0f,0x80,0x0c,0xb1,
+0x47,0xf1,0x1f,0x50,0x09,0xd7,0xff,0xf1,0x0f,0x70,0x0a,0xc0,0x04,0xf1,0x0a,0xe4,
+0x5f,0x70,0x04,0xf1,0x01,0xbf,0xfa,0x00,0x05,0xbe,0x01,0xb0,0x02,0xb0,0x00,0x05,
+0x20,0x00,0x02,0x50,0x00,0x0e,0x80,0x12,0x01,0x40,0x0e,0xb6,0x66,0x6a,0x60,0x00,
+0x82,0xfe,0xef,0xe0,0x00,0x0e,0x70,0x00,0x07,0x6c,0x00,0x11,0xd0,0xd0,0x02,0x13,
+0x10,0x60,0x00,0xc0,0x08,0xcc,0x60,0x00,0x7e,0x00,0x09,0xf7,0x8f,0x50,0x07,0xe0,
+0x10,0x03,0x31,0x14,0x9e,0x00,0x62,0x00,0x00,0x0d,0x00,0xa0,0xab,0x00,0x7e,0x00,
+0x0a,0xf7,0x8f,0x60,0x07,0xe0,0x07,0x02,0x02,0xbb,0x05,0x00,0x12,0x01,0xf7,0x1e,
+0x04,0xa0,0x0b,0x10,0xb3,0x00,0x00,0x7e,0x01,0xf3,0x1f,0x40,0x00,0x07,0xf5,0x6f,
+0x33,0xf5,0x00,0x00,0x7f,0xff,0xf3,0x7f,0xb0,0x00,0x07,0xe0,0x2f,0x3e,0xbf,0x40,
+0x00,0x7f,0xee,0xf9,0xe1,0x9d,0x00,0x00,0x34,0x43,0x42,0x00,0x40,0x28,0x01,0x10,
+0xe0,0xc8,0x00,0x81,0x07,0xf0,0x0f,0x80,0x0c,0xb0,0x28,0xf0,0x66,0x00,0x10,0xf0,
+0xc8,0x00,0x80,0x17,0xf0,0x0b,0xe4,0x5f,0x70,0x07,0xe0,0xc8,0x00,0x02,0x82,0x01,
+0xf4,0x1d,0x05,0xb0,0x00,0x00,0x53,0x00,0x44,0x00,0x00,0x00,0xe8,0x00,0xd9,0x00,
+0x00,0x01,0xf8,0x00,0xfa,0x00,0x00,0x07,0xff,0x46,0xff,0x50,0x00,0x1f,0x8a,0xee,
+0x99,0xf2,0x00,0xcc,0x00,0xdd,0x00,0xac,0x00,0x51,0x00,0x41,0x00,0x01,0xe9,0x01,
+0xf0,0x31,0x02,0xd0,0xd6,0x07,0xdb,0x20,0x3f,0x2e,0x74,0xf9,0xce,0x03,0xf2,0xf7,
+0xab,0x02,0xf3,0x3f,0x2f,0x7d,0x80,0x0f,0x75,0xf2,0xf7,0xe7,0x00,0xef,0xff,0x2f,
+0x7d,0x70,0x0f,0x75,0xf2,0xe7,0xba,0x01,0xf4,0x3f,0x2e,0x76,0xf3,0x8f,0x02,0xf2,
+0xe7,0x0b,0xff,0x50,0x2f,0x2e,0x70,0x01,0x00,0x02,0xf2,0xe7,0x00,0x00,0x00,0x2f,
+0x2e,0x70,0x54,0x06,0x01,0x0b,0x00,0x20,0x1e,0x70,0x4f,0x00,0x10,0x52,0x05,0x00,
+0xb0,0x30,0x20,0x00,0x69,0x71,0x05,0xf0,0xe7,0x09,0xe7,0xcc,0xc8,0x03,0x13,0x60,
+0xc8,0x03,0xf0,0x06,0xff,0xf1,0xe8,0x1f,0x50,0x2f,0x77,0xf1,0xe8,0x0c,0xc3,0x9f,
+0x04,0xf2,0xe7,0x02,0xdf,0xe5,0x03,0xf1,0xe7,0x8a,0x00,0x80,0x40,0x72,0x00,0x05,
+0xee,0xff,0xff,0xf1,0xd2,0x05,0x20,0x57,0xf3,0xb0,0x03,0x50,0x46,0xf3,0x00,0x07,
+0xff,0x12,0x00,0x21,0x07,0xf0,0x5b,0x02,0xa8,0xfe,0xee,0xef,0xfa,0x00,0x00,0x56,
+0x55,0x55,0x52,0xf8,0x02,0xf0,0x0b,0x7d,0xd8,0x00,0x07,0xf0,0x6f,0x86,0xf6,0x13,
+0x9f,0x0c,0xa0,0x0a,0xc9,0xff,0xf0,0xf6,0x00,0x7f,0x01,0x7f,0x0f,0x60,0x06,0xf0,
+0x06,0x0b,0x00,0x40,0x00,0x7f,0x0d,0x90,0x16,0x00,0x89,0x8f,0x56,0xf7,0x13,0x8f,
+0x00,0x9f,0xe9,0xf8,0x02,0x06,0x0b,0x00,0x09,0xf8,0x02,0xf3,0x1a,0x08,0xdd,0x70,
+0x00,0x6e,0x08,0xf7,0x8f,0x62,0x5a,0xf0,0xe8,0x00,0xbb,0x9f,0xff,0x0f,0x60,0x09,
+0xd0,0x07,0xf0,0xf6,0x00,0x9c,0x13,0x8f,0x0c,0xc0,0x0d,0x9b,0xff,0xf0,0x3f,0xff,
+0xd1,0x00,0x7f,0x00,0x15,0x50,0x3a,0x03,0xc6,0x01,0x00,0x0d,0xff,0xff,0xff,0xc0,
+0x00,0x45,0x44,0x44,0xaf,0xae,0x07,0x16,0x8e,0x0b,0x00,0x13,0x13,0x59,0x00,0xf0,
+0x08,0x6b,0xb4,0x00,0x07,0xe0,0x08,0xfa,0xcf,0x20,0x19,0xf0,0x0f,0x80,0x0e,0x89,
+0xff,0xf0,0x1f,0x50,0x0a,0xb0,0x38,0xf0,0xac,0x05,0xf2,0x02,0x07,0xf0,0x0f,0x70,
+0x0d,0x93,0x7b,0xf0,0x09,0xf8,0xaf,0x38,0xde,0xf0,0x00,0x9d,0xc5,0xce,0x01,0x00,
+0x41,0x00,0x20,0x0b,0x30,0x06,0x00,0x20,0x1f,0x70,0x02,0x03,0x11,0x1f,0x27,0x09,
+0x51,0x1f,0x82,0x22,0x34,0x30,0xf0,0x02,0x35,0xe0,0x00,0x01,0x50,0x03,0x60,0x10,
+0x00,0x7c,0xc6,0x00,0x05,0x50,0x03,0x70,0x52,0x49,0xf0,0x0f,0x80,0x0a,0xca,0x60,
+0x00,0xff,0x04,0x08,0xd0,0x06,0xf0,0x0f,0x70,0x09,0xc1,0x48,0xf0,0x0a,0xf7,0x8f,
+0x7b,0xff,0xf0,0x00,0x8c,0xc7,0x50,0x03,0x26,0xf1,0x05,0x08,0xcd,0x70,0x00,0x7e,
+0x09,0xf7,0x8f,0x53,0x6b,0xf0,0xf8,0x00,0xbb,0x9d,0xef,0x1f,0x50,0x09,0xc0,0x18,
+0x01,0xf1,0x01,0x23,0x9f,0x0c,0xc1,0x1e,0x8b,0xff,0xf0,0x3e,0xff,0xc1,0x00,0x7f,
+0x00,0x14,0x30,0xbc,0x00,0x30,0x02,0x21,0x26,0x7d,0x07,0xa0,0xfb,0x10,0x00,0x7f,
+0x60,0x04,0xea,0x00,0x0b,0xc0,0x91,0x07,0xe5,0x9f,0x30,0x02,0xdc,0x00,0x01,0xcf,
+0xee,0xfd,0x30,0x00,0x00,0x35,0x53,0x72,0x01,0x61,0x01,0xd0,0xd7,0x07,0xcb,0x30,
+0x80,0x02,0x10,0x25,0x80,0x02,0x20,0xff,0xff,0x80,0x02,0x10,0x64,0x80,0x02,0x20,
+0xe6,0x2f,0x80,0x02,0x10,0x73,0x80,0x02,0x20,0xff,0xff,0x80,0x02,0x10,0x35,0x80,
+0x02,0x1f,0x60,0x80,0x02,0x0a,0x50,0x41,0x00,0x00,0x5a,0xca,0xb7,0x06,0xa1,0xaf,
+0xa8,0xdf,0x40,0x00,0x00,0x3f,0x50,0x00,0xdb,0xa4,0x05,0x00,0x12,0x08,0xf0,0x02,
+0x5f,0x20,0x00,0x9e,0x00,0x00,0x01,0xf9,0x00,0x3e,0x90,0x00,0x00,0x06,0xff,0xef,
+0xc0,0xff,0x02,0x11,0x66,0xe4,0x06,0x25,0x04,0x90,0x66,0x09,0x90,0x02,0x22,0x2a,
+0xe2,0x22,0x21,0x0b,0xff,0xff,0x80,0x02,0x20,0x12,0x22,0x01,0x00,0x04,0xac,0x00,
+0xd1,0x04,0xbf,0xfd,0x60,0x00,0x00,0x4f,0xa5,0x48,0xf8,0x00,0x00,0xae,0x04,0x08,
+0xf1,0x02,0x8f,0x20,0x01,0xdc,0x00,0x00,0x1d,0xfd,0xdf,0xe3,0x00,0x00,0x00,0x3c,
+0xd4,0x00,0x00,0xac,0x07,0x01,0xa9,0x07,0xa2,0xff,0xfc,0x25,0x54,0x44,0x44,0x45,
+0x53,0x00,0x26,0x2e,0x06,0x01,0x3a,0x04,0x21,0x7f,0x00,0x06,0x00,0xc2,0x21,0x11,
+0x12,0x00,0x00,0x6f,0xff,0xff,0xff,0x70,0x00,0x02,0x60,0x00,0xf0,0x1a,0x14,0x42,
+0x00,0x00,0x00,0x0b,0xff,0xef,0xc1,0x00,0x00,0x9f,0x40,0x01,0xe9,0x00,0x00,0xbd,
+0x00,0x00,0xbc,0x00,0x00,0x6f,0xa6,0x69,0xf7,0x00,0x00,0x05,0xbe,0xfc,0x70,0x00,
+0x02,0x21,0x18,0xe1,0x12,0x21,0x8f,0x5a,0x00,0xf1,0x0c,0xfd,0x01,0x11,0x22,0x21,
+0x11,0x10,0x00,0xce,0xdd,0xde,0xee,0x00,0x00,0x47,0x76,0x66,0x9f,0x10,0x00,0x13,
+0x33,0x33,0x8f,0x10,0x00,0xef,0x8a,0x08,0x11,0xea,0x66,0x00,0xa0,0xdf,0xee,0xee,
+0xff,0x60,0x00,0x36,0x66,0x65,0x54,0x67,0x01,0x10,0x10,0xf6,0x02,0x91,0xef,0xff,
+0x90,0x00,0x00,0x6f,0x72,0x15,0xe9,0xbd,0x00,0x80,0x9d,0x00,0x00,0x8f,0x40,0x03,
+0xeb,0x00,0x9f,0x05,0xe1,0xc1,0x00,0x00,0x00,0x1b,0xd1,0x00,0x00,0x25,0x55,0x5c,
+0xd5,0x55,0x53,0xc0,0x00,0x13,0xfd,0xf6,0x00,0xd1,0xaa,0x00,0x00,0x4e,0x00,0x00,
+0xbc,0x44,0x44,0x8f,0x00,0x00,0xbf,0x5f,0x09,0x71,0xbb,0x00,0x00,0x5f,0x10,0x00,
+0xaf,0x8e,0x08,0x42,0x14,0x44,0x44,0x42,0x49,0x04,0x00,0x21,0x01,0x10,0x51,0xce,
+0x0b,0xf5,0x04,0x02,0xef,0xef,0x50,0x0f,0x70,0x00,0x0b,0xd1,0x09,0xe0,0x0f,0x70,
+0x00,0x0e,0x70,0x02,0xf2,0x0e,0x07,0x00,0xf0,0x04,0x0b,0xd1,0x0a,0xe0,0x0e,0xc8,
+0x60,0x02,0xdf,0xfe,0x40,0x0e,0xdb,0x80,0x00,0x02,0x30,0x00,0x0e,0xf3,0x06,0x11,
+0xc0,0x07,0x00,0x20,0x04,0xf2,0x07,0x00,0xd2,0x24,0x48,0xf7,0x79,0x4e,0x80,0x00,
+0x9e,0xfe,0xed,0xb9,0x2e,0x80,0x15,0x0c,0x09,0x07,0x00,0x24,0x04,0x10,0x35,0x0a,
+0x30,0x04,0xbd,0xa2,0x85,0x0c,0xf1,0x23,0xf9,0x6c,0xd0,0x1f,0x50,0x00,0x8d,0x00,
+0x2f,0x21,0xf6,0x00,0x09,0xe0,0x03,0xf3,0x1f,0x60,0x00,0x5f,0xca,0xee,0x01,0xfa,
+0x63,0x00,0x6d,0xfb,0x20,0x1f,0xed,0x80,0x00,0x5f,0x00,0x21,0xf6,0x00,0x8e,0xef,
+0xff,0xff,0x4f,0x60,0x02,0x55,0x54,0x42,0x01,0xf6,0xae,0x00,0x21,0x0f,0x50,0x0f,
+0x03,0x14,0x40,0x96,0x01,0x21,0x07,0xf3,0xf8,0x0a,0x11,0x5f,0x97,0x01,0x21,0x00,
+0x12,0xf4,0x09,0x02,0x01,0x00,0xf1,0x19,0x25,0x30,0x00,0x6d,0x00,0x9f,0xef,0xb0,
+0x07,0xe0,0x3f,0x50,0x4f,0x50,0x7e,0x07,0xe0,0x00,0xe8,0x07,0xe0,0x7e,0x00,0x0e,
+0x80,0x7e,0x03,0xf5,0x05,0xf4,0x07,0xe0,0x08,0xff,0xf9,0x00,0x7e,0x00,0x01,0x31,
+0xfd,0x06,0x30,0x20,0x00,0x7e,0x7b,0x08,0xd5,0x07,0xe0,0x33,0x4f,0x86,0x85,0x7e,
+0x0f,0xff,0xfe,0xdb,0x47,0xe0,0xfb,0x01,0x02,0x80,0x03,0x12,0x14,0x30,0x01,0xf0,
+0x22,0x03,0xbd,0xb3,0x00,0xe8,0x02,0xfa,0x6b,0xe1,0x0e,0x80,0x7f,0x00,0x0f,0x40,
+0xe8,0x06,0xf0,0x01,0xf5,0x0e,0x80,0x1e,0xda,0xde,0x00,0xe8,0x00,0x19,0xf8,0x10,
+0x0e,0x80,0x00,0x3f,0x30,0x20,0xe8,0x8e,0xee,0xff,0xff,0x6e,0x82,0x55,0x55,0x43,
+0x00,0xe8,0x59,0x08,0x20,0x0d,0x80,0xd1,0x0b,0x40,0x31,0x00,0x4f,0x30,0x0b,0x01,
+0x10,0xf5,0xb3,0x00,0x11,0x3f,0xe7,0x0a,0x11,0x02,0xb1,0x00,0x11,0x03,0x1b,0x08,
+0x30,0x5e,0xff,0xfa,0x2c,0x04,0x20,0xa0,0x04,0x3d,0x02,0x10,0xf1,0x81,0x03,0x21,
+0x00,0x6f,0xf3,0x01,0xb0,0x04,0xf4,0x00,0x0d,0xa0,0x00,0x00,0x0c,0xe7,0x6c,0xf2,
+0x62,0x04,0x20,0xcc,0x92,0xfd,0x0b,0x20,0x90,0x07,0x0a,0x03,0xb2,0xab,0x00,0x8d,
+0x00,0x00,0x13,0x3c,0xc3,0x39,0xe3,0x32,0xfd,0x02,0x16,0xe0,0xa4,0x03,0x0f,0x3d,
+0x02,0x09,0xf0,0x03,0x0c,0xff,0xff,0xe1,0x00,0x00,0x09,0xd3,0x39,0xd0,0x00,0x02,
+0x3a,0xe3,0x3a,0xe3,0x32,0xaf,0x3d,0x00,0x31,0xfe,0x01,0x11,0x9a,0x09,0xe0,0x03,
+0xbe,0xfd,0x80,0x00,0x00,0x2f,0xc5,0x47,0xfa,0x00,0x00,0x7f,0x10,0x05,0x01,0x20,
+0x7f,0x10,0x6d,0x0a,0x91,0x2e,0xd7,0x69,0xfa,0x00,0x00,0x02,0x9c,0xcb,0xd6,0x04,
+0x01,0x6a,0x01,0x30,0x4c,0xff,0xf7,0xc8,0x03,0xa0,0xa3,0x26,0xf5,0x00,0x00,0x08,
+0xf0,0x00,0x0b,0xb0,0x96,0x0a,0x00,0x68,0x00,0xb7,0x04,0xf6,0x00,0x2e,0xa0,0x00,
+0x00,0x09,0xfe,0xef,0xc1,0x96,0x0a,0x00,0xba,0x00,0xa1,0xff,0xfe,0xee,0xef,0xff,
+0xf0,0x25,0x55,0x5a,0xe4,0x85,0x02,0x1e,0x8e,0x32,0x0d,0x24,0x08,0xd0,0x2d,0x02,
+0x05,0x01,0x00,0x44,0x4b,0xff,0xd6,0x00,0xc6,0x03,0x40,0x0a,0xe0,0x00,0x0a,0xfe,
+0x0a,0x10,0x30,0xc7,0x03,0x50,0x00,0xcf,0xee,0xfd,0x20,0xef,0x01,0xa2,0x53,0x00,
+0x00,0x01,0x33,0x33,0x33,0x33,0x34,0x30,0xcc,0x00,0x20,0x00,0x00,0x85,0x09,0x50,
+0x00,0x00,0x58,0x02,0xf5,0x76,0x00,0x20,0xe0,0x2f,0x9e,0x07,0x11,0x9e,0xa4,0x07,
+0x52,0x09,0xe2,0x11,0x12,0x20,0xf1,0x03,0x10,0x70,0xe1,0x08,0x24,0x22,0x20,0xcd,
+0x03,0x12,0x1b,0xcd,0x03,0x31,0x30,0x02,0xea,0xcd,0x03,0xd0,0xcb,0x00,0x00,0x6f,
+0xb7,0x7a,0xf7,0x00,0x00,0x04,0xac,0xca,0x50,0xae,0x03,0x43,0x33,0x33,0x32,0xaf,
+0x67,0x03,0x10,0x18,0xb2,0x00,0x3f,0xce,0xde,0xfe,0xcd,0x03,0x1a,0xe0,0x08,0xef,
+0xfe,0x80,0x00,0x00,0x8f,0x61,0x26,0xf7,0x00,0x00,0xdb,0x00,0x94,0x03,0xa0,0xae,
+0x30,0x04,0xf9,0x00,0x00,0x1c,0xff,0xff,0xb1,0x79,0x06,0xf3,0x00,0x31,0x00,0x00,
+0x47,0x65,0x55,0x55,0x56,0x64,0xae,0xee,0xff,0xff,0xee,0xeb,0x18,0x01,0x11,0xbf,
+0x54,0x00,0x71,0xeb,0x55,0x55,0x9f,0x00,0x00,0xe9,0x16,0x02,0x01,0x06,0x00,0x01,
+0x8b,0x0b,0x70,0x00,0x00,0x25,0x55,0x54,0x41,0x00,0xf2,0x18,0x00,0x00,0x01,0x10,
+0x00,0x00,0x00,0x00,0x6e,0xff,0xf9,0x00,0x00,0x00,0x6f,0x72,0x15,0xe9,0x00,0x00,
+0x0a,0xd0,0x00,0x09,0xd0,0x00,0x00,0x7f,0x51,0x14,0xeb,0x00,0x00,0x00,0x9f,0xff,
+0xfa,0x10,0x00,0x27,0x00,0xf0,0x03,0x09,0xff,0xee,0xee,0xee,0xff,0xe0,0x25,0x55,
+0x6a,0xf6,0x55,0x54,0x00,0x00,0x00,0x6d,0x00,0x01,0x00,0x21,0x03,0x90,0x07,0x00,
+0x11,0xbf,0x06,0x00,0x30,0x7f,0xfc,0x10,0x34,0x00,0xf1,0x02,0x83,0xee,0x40,0x00,
+0x01,0xee,0x50,0x01,0xaf,0x60,0x00,0x05,0x00,0x00,0x00,0x32,0x00,0x01,0x00,0xf0,
+0x08,0x20,0x01,0xad,0xc3,0x00,0x7e,0x00,0xdc,0x6a,0xf1,0x07,0xe0,0x3f,0x20,0x0f,
+0x60,0x7f,0x05,0xf0,0x00,0xd8,0x07,0xf0,0x0b,0x00,0xf0,0x25,0x6f,0x00,0xdc,0x6a,
+0xe1,0x06,0xf0,0x01,0xac,0xa2,0x00,0x6f,0x03,0x33,0x34,0x68,0x76,0xf0,0xff,0xff,
+0xfd,0xb6,0x6f,0x00,0x03,0xf3,0x00,0x06,0xf0,0x00,0x3f,0x31,0xff,0xff,0x00,0x03,
+0xf3,0x02,0x38,0xf0,0x00,0x3f,0x30,0x00,0x6f,0x00,0x01,0xb1,0x00,0x05,0xe0,0x00,
+0x96,0x00,0x00,0x05,0x00,0xf2,0xa5,0x02,0x50,0x00,0x6e,0xfe,0x50,0x08,0xe0,0x03,
+0xf7,0x39,0xf2,0x08,0xe0,0x07,0xe0,0x00,0xf5,0x07,0xe0,0x05,0xf3,0x04,0xf3,0x07,
+0xf0,0x00,0xaf,0xef,0x90,0x07,0xf0,0x00,0x02,0x42,0x01,0x07,0xf0,0x5c,0xcc,0xdd,
+0xff,0x88,0xf0,0x26,0x6c,0xd5,0x31,0x08,0xf0,0x00,0x0b,0xc0,0x4f,0xff,0xf0,0x00,
+0x05,0x60,0x04,0x4a,0xf0,0x00,0x0b,0x20,0x00,0x07,0xe0,0x00,0x2f,0x50,0x00,0x00,
+0x10,0x00,0x2f,0x62,0x22,0x22,0x20,0x00,0x1f,0xff,0xff,0xff,0xf2,0x00,0x01,0x22,
+0x22,0x22,0x10,0x00,0x01,0x20,0x00,0x03,0x20,0x0a,0xff,0xf9,0x00,0xba,0x06,0xf3,
 0x05,0xf4,0x0b,0xb0,0x7f,0x10,0x1f,0x50,0xbb,0x01,0xdf,0xdf,0xc0,0x0b,0xb0,0x00,
 0x34,0x21,0x31,0xbb,0x9e,0xee,0xef,0xff,0x5b,0xb2,0x55,0xcd,0x33,0x44,0xdb,0x00,
-0x0a,0xb0,0x6e,0xef,0xb0,0x00,0x23,0xc9,0x27,0x11,0x3e,0xc3,0x01,0x60,0x45,0x54,
-0x44,0xf8,0x00,0x3e,0x55,0x23,0x20,0x05,0xf6,0xbc,0x27,0x50,0x4f,0xfe,0xef,0xff,
-0xd0,0x39,0x47,0x04,0xa2,0x18,0xf0,0x2a,0x8c,0xc7,0x01,0xf2,0xe7,0x09,0xf7,0x7f,
-0x52,0xf3,0xe7,0x0e,0x80,0x0b,0xa2,0xf3,0xe7,0x0f,0x70,0x0a,0xb2,0xf3,0xe7,0x0c,
-0xb0,0x0d,0x82,0xf3,0xe7,0x03,0xee,0xfd,0x12,0xf3,0xe7,0x00,0x14,0x30,0x02,0xf3,
-0xe7,0x16,0x66,0x78,0xa5,0xf3,0xe7,0x4d,0xdf,0xeb,0x84,0xf3,0xe7,0x00,0x0e,0x80,
-0x02,0x06,0x00,0x21,0x85,0xff,0x0c,0x00,0x15,0x25,0x12,0x00,0x47,0x09,0x40,0x01,
-0xc1,0xf5,0x3f,0x54,0x01,0x30,0x01,0xad,0xc4,0x70,0x01,0x90,0x4f,0x30,0x0e,0x70,
-0x7e,0x05,0xf1,0x00,0xd8,0x0b,0x00,0xc1,0x0f,0x60,0x6e,0x00,0xec,0x6b,0xe1,0x06,
-0xf0,0x02,0xad,0xb2,0x19,0x09,0x30,0x13,0x26,0xf2,0xef,0x21,0x63,0x6f,0x04,0x57,
-0xf6,0x20,0x06,0x65,0x01,0x03,0x7b,0x01,0x10,0x30,0xe3,0x04,0x14,0xa1,0x6b,0x52,
-0x06,0xc0,0x03,0x11,0xe7,0xc0,0x03,0x22,0x27,0xf6,0xc0,0x03,0x01,0x56,0x0e,0x00,
-0x2b,0x04,0x40,0x03,0xf7,0x00,0x3f,0xbf,0x4b,0x02,0xb5,0x3e,0x34,0x01,0x45,0x20,
-0x36,0x00,0x21,0x0a,0xff,0x22,0x6a,0x60,0x24,0x4c,0xd4,0x48,0xf4,0x32,0xf9,0x0e,
-0x00,0x15,0x1d,0x10,0x0a,0x40,0x2a,0x05,0x0d,0x00,0x11,0xb0,0xb3,0x21,0x12,0x11,
-0xd6,0x01,0x08,0x25,0x07,0x31,0x30,0x01,0xda,0x58,0x03,0x15,0xac,0x25,0x07,0x94,
-0xbd,0xdb,0x60,0x00,0x24,0x43,0x33,0x33,0x34,0x17,0x30,0x20,0x06,0xf1,0x8a,0x21,
-0xb1,0x5a,0xf7,0x6b,0xf7,0x00,0x00,0xbe,0xed,0xdd,0xdf,0x10,0x69,0x26,0x14,0x10,
-0x6f,0x23,0x0e,0x58,0x03,0x21,0x26,0x64,0x60,0x17,0x11,0xdd,0xac,0x76,0x20,0x50,
-0x03,0xda,0x7e,0x02,0x10,0x24,0x12,0xcb,0x9c,0x3a,0x11,0xf1,0x3d,0x05,0x50,0x1e,
-0xe8,0x7d,0xe1,0x00,0xfd,0x1d,0x1c,0x92,0x8f,0x53,0x00,0xa6,0x27,0x00,0x1d,0x24,
-0x4b,0x55,0x56,0x66,0x50,0x6e,0x04,0x1e,0xb5,0x6e,0x04,0x16,0xbf,0x6e,0x04,0x21,
-0x00,0x21,0xb9,0x02,0x04,0x36,0x5c,0x20,0x34,0x44,0xbf,0x4b,0x02,0x38,0x08,0x0a,
-0x94,0x31,0x11,0xf2,0x02,0x19,0x03,0x29,0x3f,0x08,0x6e,0x04,0x23,0x0b,0xfe,0x6e,
-0x04,0x01,0x3b,0x08,0x00,0x0e,0x04,0x30,0x6f,0x95,0x59,0xdd,0x51,0x00,0x16,0x01,
-0x72,0x12,0x22,0x11,0x12,0x22,0x32,0xbf,0x98,0x05,0x00,0xd1,0x08,0x01,0x3b,0x08,
-0x1f,0xed,0x3b,0x08,0x31,0x12,0x0a,0x3b,0x08,0x00,0x6e,0x04,0x02,0xb0,0x5d,0x27,
-0x9f,0xff,0x7b,0x3e,0x11,0x9e,0x2e,0x17,0x11,0xcd,0x2e,0x17,0x11,0xcb,0x77,0x12,
-0x02,0x06,0x00,0x02,0x47,0x08,0x12,0x15,0xf5,0x02,0x0f,0x60,0x00,0x1c,0x00,0x65,
-0x01,0x04,0x60,0x00,0x0f,0x5e,0x06,0x13,0x00,0xa0,0x02,0x20,0x35,0x40,0xa4,0x19,
-0xd0,0xdf,0xa0,0x07,0xe0,0x2f,0x60,0x3f,0x30,0x7e,0x06,0xf0,0x00,0xe7,0xc3,0x07,
-0xf5,0x04,0x0d,0x80,0x7e,0x05,0xf1,0x01,0xf5,0x07,0xe0,0x0e,0xc6,0xce,0x00,0x7e,
-0x00,0x2a,0xcb,0x20,0x07,0xc1,0x5b,0x30,0x13,0x47,0xe2,0xc6,0x09,0x47,0x7e,0x03,
-0x44,0x43,0x16,0x00,0x05,0xf9,0x0b,0x01,0x3a,0x24,0x01,0xde,0x16,0x00,0xa9,0x0e,
-0xf0,0x07,0x0e,0x70,0xae,0x68,0xf5,0x00,0xe7,0x1f,0x60,0x0b,0xb0,0x0e,0x73,0xf2,
-0x00,0x8e,0x00,0xe7,0x4f,0x20,0x08,0xe0,0x0b,0x00,0x10,0x9d,0x16,0x00,0xc9,0x0c,
-0xa0,0x0e,0x70,0xbe,0x58,0xf5,0x00,0xe7,0x01,0xae,0xd7,0x85,0x1f,0x07,0x63,0x66,
-0x16,0x70,0x20,0x17,0x10,0x20,0x88,0x0c,0xf0,0x13,0xd9,0x08,0xf7,0x8f,0x60,0x0d,
-0x90,0xe8,0x00,0xac,0x00,0xd9,0x0f,0x60,0x08,0xe0,0x0d,0x90,0xf6,0x00,0x8d,0x00,
-0xd9,0x0c,0xc0,0x0d,0xa0,0x0d,0x90,0x3f,0xff,0xe2,0x00,0xd8,0x88,0x0c,0x02,0x60,
-0x25,0x02,0xb7,0x50,0x1f,0x60,0x20,0x17,0x0b,0x00,0x31,0x08,0x40,0x99,0x20,0x00,
-0xe7,0xd7,0x0f,0x30,0x0e,0x80,0xda,0x0f,0x3b,0xb0,0x0f,0x50,0x0b,0xb0,0x0e,0x80,
-0xf5,0x00,0xab,0x00,0xe8,0xd5,0x0f,0x70,0x0e,0x80,0x9e,0x68,0xf4,0x00,0xe8,0xd4,
-0x0f,0x04,0x9a,0x00,0x10,0x07,0xed,0x37,0x00,0x5e,0x5b,0x13,0x62,0x1c,0x0c,0x14,
-0xf9,0x20,0x17,0x18,0xc0,0x20,0x17,0xf0,0x02,0x8d,0xe8,0x00,0x0d,0x70,0x09,0xf7,
-0x8f,0x70,0x0e,0x80,0x0f,0x80,0x09,0xd0,0x0e,0x80,0x15,0x2e,0x04,0x0c,0x00,0x93,
-0x09,0xf8,0x8f,0x80,0x0e,0x80,0x00,0x8c,0xc8,0x56,0x00,0xc2,0x07,0x20,0x00,0x05,
-0x66,0x66,0x67,0x20,0x00,0x3e,0xee,0xdd,0x20,0x17,0x12,0x2e,0x20,0x17,0x13,0x50,
-0xe6,0x0c,0x02,0xe0,0x0c,0x15,0x03,0x80,0x0c,0xf0,0x00,0x00,0x08,0xde,0x90,0x00,
-0x7d,0x09,0xf7,0x8f,0xa0,0x08,0xe0,0xf8,0x00,0xaf,0xbd,0x36,0x32,0x08,0xf1,0x07,
-0x0b,0x00,0x92,0x09,0xf8,0x9f,0xb0,0x08,0xe0,0x08,0xcd,0x91,0xf2,0x07,0xe0,0x03,
-0x60,0x03,0x55,0x61,0x35,0x53,0x00,0xbe,0xef,0x7a,0xef,0xe0,0x00,0xb9,0x37,0x51,
-0x00,0xbf,0xff,0x60,0x07,0xf0,0x5e,0xa2,0x7e,0x00,0xcf,0xee,0xe1,0x07,0xe0,0x02,
-0x55,0x53,0x98,0x0d,0x11,0x02,0xf0,0x0d,0x10,0xe7,0xc6,0x0f,0x00,0xf4,0x3d,0x70,
-0xbb,0x00,0xe8,0x0f,0x60,0x09,0xc0,0x0d,0x54,0xf0,0x02,0x9b,0x00,0xe7,0x0c,0xc0,
-0x1e,0x80,0x0e,0x70,0x3e,0xff,0xd1,0x00,0xe7,0x00,0x14,0x40,0xbf,0x18,0x10,0x01,
-0x7d,0x03,0x11,0x0e,0xea,0x07,0x31,0xf9,0x33,0x22,0x13,0x46,0x11,0x0f,0x3b,0x18,
-0x13,0xf7,0xdd,0x17,0x33,0x24,0x44,0x43,0x5a,0x61,0x10,0x07,0x1f,0x10,0x40,0x08,
-0xf8,0x8f,0x50,0xa5,0x00,0x30,0xbb,0x00,0x7e,0x48,0x0e,0x00,0xd7,0x59,0x41,0x9c,
-0x00,0x7e,0x0a,0xb5,0x0f,0x53,0x1b,0xff,0xa0,0x00,0x7e,0xb4,0x0f,0x10,0x62,0xc4,
-0x25,0x11,0x0f,0x69,0x10,0x70,0xfa,0x66,0x66,0xae,0x00,0x0f,0xff,0x0e,0x2c,0x10,
-0xf7,0xb0,0x00,0x02,0x79,0x10,0x11,0x24,0x2e,0x4e,0x00,0xb5,0x0a,0x00,0x10,0x10,
-0x20,0x0e,0x80,0x10,0x10,0x80,0x0e,0x80,0x0f,0x70,0x0c,0xa0,0x0e,0x80,0x8a,0x0d,
-0x20,0x0e,0x80,0x38,0x11,0xb3,0x0e,0x80,0x0b,0xe4,0x6f,0x70,0x0e,0x80,0x01,0xcf,
-0xf9,0x00,0x02,0x20,0x0b,0x60,0xb7,0x01,0x11,0x52,0x5d,0x17,0x10,0xf6,0x48,0x09,
-0x20,0x03,0xf7,0xdd,0x13,0xf2,0x04,0x29,0xff,0x20,0x00,0x3f,0x6c,0xdf,0x6c,0xd1,
-0x00,0xe9,0x00,0xfa,0x01,0xd8,0x00,0x60,0x00,0x50,0xd0,0x02,0x10,0x01,0x2b,0x1f,
-0x30,0x60,0x06,0xe0,0xb0,0x68,0x21,0x40,0x7f,0xa6,0x1c,0x01,0xb1,0x0a,0x31,0xcc,
-0x00,0x6f,0x99,0x6c,0x10,0x06,0x7c,0x24,0xf0,0x0e,0xf2,0x00,0x6f,0xff,0x90,0x03,
-0xff,0x90,0x06,0xf4,0x41,0x00,0xcd,0x7f,0x20,0x6f,0x00,0x00,0x6f,0x30,0xdb,0x06,
-0xf0,0x00,0x1f,0x70,0x04,0xf3,0x6f,0xc1,0x14,0x2f,0x04,0x16,0x28,0x17,0x10,0xc0,
-0x34,0x55,0x50,0x03,0xf1,0x00,0x1e,0xee,0xef,0x40,0x4f,0x20,0x19,0x05,0x22,0x04,
-0xf2,0x28,0x06,0xf3,0x0a,0x76,0x20,0x01,0xdf,0x50,0x03,0xff,0xf9,0x00,0xce,0xbe,
-0x20,0x3f,0x20,0x01,0xce,0x30,0xcd,0x03,0xf2,0x00,0x5b,0x10,0x01,0xc3,0x5b,0x1e,
-0x14,0x40,0xc3,0x08,0x48,0x03,0x55,0x44,0x48,0xd2,0x50,0x27,0x06,0xf1,0x75,0x00,
-0x15,0x00,0x28,0x17,0x20,0x56,0x77,0x88,0x13,0x60,0x1d,0xdd,0xef,0x30,0x4f,0x30,
-0xc5,0x3b,0x21,0x04,0xf3,0x50,0x0a,0x00,0x0d,0x00,0xf0,0x0d,0xdf,0x40,0x03,0xfb,
-0xa4,0x00,0x9f,0xde,0x10,0x3f,0xca,0x40,0x6f,0x62,0xea,0x03,0xf3,0x00,0x5f,0x70,
-0x04,0xf3,0x3f,0x30,0x02,0x40,0x00,0x01,0xcd,0x16,0x11,0x49,0xab,0x04,0x12,0x08,
-0x28,0x17,0x18,0x8f,0x28,0x17,0x1a,0x7f,0x28,0x17,0x00,0x68,0x00,0xb0,0x89,0x9a,
-0x91,0x02,0xf2,0x00,0x1a,0xba,0xcf,0x40,0x3f,0x2f,0x5f,0x01,0x53,0x50,0xf0,0x02,
-0x08,0xf3,0x00,0x3f,0xdc,0x80,0x05,0xff,0x60,0x03,0xf9,0x74,0x05,0xf9,0x9f,0x40,
-0x3f,0xa0,0x09,0x30,0x9f,0x24,0xf2,0x82,0x17,0x2e,0x51,0x2b,0xc0,0x16,0x24,0x14,
-0xf3,0x43,0x26,0x07,0x56,0x4f,0x11,0x60,0x8a,0x6d,0x17,0x40,0x38,0x01,0x21,0x05,
-0xe0,0x38,0x01,0x20,0x6f,0x00,0x97,0x09,0x21,0x06,0xf0,0x37,0x3b,0xe0,0x6f,0xee,
-0x60,0x01,0xdf,0xa0,0x06,0xf7,0x62,0x00,0xcc,0x6f,0x60,0x6f,0xef,0x71,0x82,0x8f,
-0x26,0xf0,0x00,0x5b,0x10,0x00,0x52,0xf0,0x15,0x2b,0x02,0x80,0xf0,0x15,0x11,0x7f,
-0x92,0x0e,0x1e,0x05,0xf0,0x15,0x02,0xa7,0x01,0xb0,0x02,0x55,0x64,0x05,0xe0,0xe7,
-0x0a,0xff,0xff,0x06,0xe0,0xc5,0x6d,0x01,0x72,0x22,0x10,0xf8,0x06,0x00,0x30,0x06,
-0xf2,0x07,0x40,0x21,0xff,0x12,0xf0,0x07,0xfe,0xf7,0x00,0x4f,0xf5,0x07,0xf5,0xf7,
-0x00,0xcc,0xbb,0x07,0xe0,0xe7,0x05,0xf3,0x3f,0x36,0xe0,0xe7,0x0e,0x90,0x0b,0xa6,
-0xe0,0xe7,0x19,0x00,0x01,0x66,0xe0,0x7b,0x48,0x05,0x02,0x78,0x5e,0x60,0x31,0x03,
-0x45,0x54,0x07,0xf0,0x2b,0x6e,0x20,0x07,0xf0,0x2d,0x6a,0xf3,0x12,0x07,0xf0,0xe8,
-0x00,0x07,0xf2,0x06,0xff,0xf8,0x00,0x3f,0xf4,0x06,0xf5,0xf8,0x01,0xdc,0xbe,0x16,
-0xf0,0xe7,0x0c,0xe1,0x0d,0xb6,0xf0,0xf7,0x4d,0x20,0x01,0x85,0xe0,0xe6,0x3d,0x02,
-0x10,0x09,0x14,0x12,0x00,0x98,0x10,0x24,0x47,0xf2,0xce,0x18,0x05,0x06,0x00,0x17,
-0xf1,0xf9,0x01,0xa0,0x20,0x66,0x77,0x82,0x00,0x6e,0x1c,0xdd,0xcf,0x70,0x43,0x4a,
-0x11,0xf4,0x28,0x2e,0x00,0x5f,0x03,0x80,0x0d,0xa0,0x12,0x8e,0x00,0x05,0xf8,0x0f,
-0xec,0x4d,0xf6,0x0a,0xe0,0x12,0x8e,0x00,0x7f,0x5f,0x60,0x07,0xe0,0x2f,0x80,0x9e,
-0x00,0x7e,0x0c,0xc0,0x01,0xe6,0x07,0xe0,0x61,0x00,0x03,0x20,0x7e,0x7c,0x67,0x07,
-0xc7,0x61,0x14,0x01,0x7f,0x01,0x90,0x61,0x00,0xb8,0x0d,0xee,0xef,0x70,0x0d,0xa0,
-0x63,0x22,0xf2,0x0e,0xca,0x00,0x01,0xf8,0x2d,0xdf,0xa0,0x00,0xcf,0xc0,0x67,0xea,
-0x00,0xbe,0x5f,0x90,0x0c,0xa0,0xce,0x20,0x5f,0x50,0xca,0x3b,0x10,0x00,0x44,0x0c,
-0x90,0x98,0x05,0x02,0x9d,0x0d,0x1f,0x44,0x98,0x05,0x05,0x01,0xf9,0x16,0x00,0xbc,
-0x50,0x10,0x71,0x53,0x6c,0x20,0xdf,0x50,0xb2,0x39,0x00,0x88,0x4f,0xf2,0x0f,0x01,
-0xe9,0x03,0x3e,0x80,0x00,0x9f,0x74,0xff,0xf8,0x00,0x4f,0xdf,0x20,0x1e,0x80,0x3f,
-0xa0,0xdc,0x00,0xe8,0x1f,0xb0,0x02,0xe5,0x0e,0x71,0x60,0x00,0x01,0x98,0x05,0x11,
-0x0f,0x98,0x05,0x15,0x83,0x98,0x05,0x14,0x12,0x98,0x05,0x04,0x28,0x25,0xc0,0x01,
-0x40,0x0b,0xee,0xff,0x60,0x07,0xf0,0x04,0x55,0x7f,0x60,0x49,0x13,0xf0,0x0e,0xae,
-0x01,0x17,0xf0,0x00,0x04,0xf8,0x2f,0xff,0xf0,0x00,0x2e,0xfe,0x22,0x38,0xf0,0x02,
-0xdd,0x2c,0xe1,0x07,0xf0,0x1e,0xc1,0x01,0xca,0x07,0xe0,0x06,0xa5,0x34,0x20,0x30,
-0x00,0xfd,0x6a,0x10,0xb0,0xad,0x66,0x21,0x5b,0xe0,0xb3,0x66,0x79,0xe0,0x00,0x0f,
-0xed,0xdd,0xdd,0x90,0xb8,0x1c,0x07,0x98,0x05,0x91,0x24,0x55,0x61,0x00,0xd6,0x0c,
-0xee,0xef,0x50,0x3a,0x15,0x00,0xb8,0x00,0xf2,0x09,0xe7,0x4d,0xdf,0x80,0x00,0xbf,
-0xb1,0x67,0xf8,0x00,0x9e,0x5f,0x80,0x0e,0x80,0xae,0x30,0x6f,0x40,0xe8,0x2c,0x20,
-0x00,0x53,0xef,0x00,0x12,0x30,0x2a,0x05,0x70,0x01,0xf8,0x33,0x33,0xf7,0x00,0x1f,
-0x40,0x05,0x19,0x01,0x40,0x05,0x22,0x44,0x30,0x70,0x0e,0x01,0x4e,0x39,0x60,0x0d,
-0xee,0xef,0x80,0x0c,0x90,0x4f,0x35,0xf0,0x00,0xc9,0x00,0x03,0xf8,0x2d,0xef,0x90,
-0x01,0xdf,0xa0,0x66,0xd9,0x01,0xce,0x7f,0x90,0x26,0xc0,0x20,0x6f,0x50,0xc9,0x3a,
-0x10,0x00,0x53,0x0a,0x70,0x00,0x60,0xdf,0x06,0x20,0x2f,0x40,0x63,0x10,0x40,0xf8,
-0x66,0x66,0xf7,0xd4,0x88,0x40,0xef,0x70,0x02,0xf4,0x0a,0x1e,0x11,0x1f,0x55,0x06,
-0x01,0xfc,0x6e,0x02,0xa2,0x69,0x00,0xb0,0x00,0x00,0x58,0x00,0x20,0x0f,0x80,0xfd,
-0x72,0xf0,0x0f,0xe8,0x00,0x02,0xf9,0x16,0x6f,0x80,0x00,0xbf,0x64,0xdd,0xf8,0x00,
-0x7f,0xcf,0x20,0x0e,0x80,0x6f,0x70,0xdd,0x00,0xe8,0x4f,0x70,0x01,0xc4,0x0e,0x81,
-0x40,0x2b,0x3f,0x00,0xd8,0x25,0xa0,0xc4,0x00,0x00,0xce,0x52,0x3a,0xf3,0x00,0x1f,
-0x60,0x73,0x01,0x90,0xfa,0x00,0x05,0xf6,0x00,0x05,0xff,0xde,0xfb,0xc1,0x03,0x22,
-0x52,0x00,0xd0,0x02,0x30,0x05,0x77,0x85,0x03,0x6f,0x22,0xdd,0xfc,0x2d,0x6f,0x00,
-0xae,0x39,0x20,0x03,0xf4,0x06,0x00,0xe0,0x09,0xe2,0x59,0xf0,0xf7,0x00,0x0f,0xd5,
-0xde,0xf0,0xf7,0x00,0x7f,0xf3,0x2d,0x6f,0x20,0xe8,0xca,0x1a,0x15,0x30,0xe0,0x5f,
-0x25,0xb1,0x4b,0x8d,0x0c,0x85,0xf0,0xe7,0x16,0x00,0x02,0x35,0x33,0x6f,0x38,0x02,
-0x80,0xd7,0xde,0x63,0xf1,0x21,0x04,0x56,0x64,0x02,0xf1,0xe7,0x1e,0xee,0xff,0x03,
-0xf2,0xe8,0x00,0x00,0xea,0x03,0xf3,0xe8,0x00,0x07,0xf4,0xac,0xf3,0xe8,0x00,0x2f,
-0xf2,0x8a,0xf3,0xe8,0x00,0xdd,0xdc,0x03,0xf3,0xe7,0x0b,0xe2,0x2e,0x83,0xf3,0xe7,
-0x4e,0x30,0x03,0x82,0xf2,0xe7,0x9d,0x08,0x10,0xd7,0x1d,0x05,0x30,0x30,0x10,0x00,
-0xfa,0x7a,0x01,0xb8,0x24,0x10,0xf4,0x54,0x04,0x91,0x70,0xaf,0x60,0x00,0x0a,0xe5,
-0x00,0x07,0xf7,0x49,0x11,0x16,0x22,0x30,0x03,0x15,0x7e,0x30,0x03,0x00,0x4a,0x07,
-0x30,0x7f,0x0d,0xff,0x30,0x03,0x24,0x23,0x9e,0xe5,0x22,0xff,0x0a,0xe0,0x46,0xae,
-0x00,0x6f,0x6f,0x5b,0xee,0xe0,0x1e,0x90,0xad,0x00,0x6e,0x0b,0xd0,0x01,0xf5,0x06,
-0xe0,0x82,0x00,0x05,0x30,0x6e,0x30,0x03,0x04,0x11,0x02,0x27,0x2e,0x00,0xdd,0x3c,
-0x01,0xff,0x5d,0x21,0x1e,0xd0,0x0e,0x21,0x11,0xe2,0xd4,0x76,0x11,0xfa,0xa3,0x7b,
-0x20,0xd9,0xfa,0x56,0x1b,0xaa,0xa0,0x03,0xde,0x30,0x00,0x4b,0x30,0x36,0x00,0x75,
-0xbc,0x0f,0x42,0x35,0x55,0x6b,0xf6,0x8d,0x6d,0x00,0x74,0x02,0x21,0x3e,0xff,0x8e,
-0x0e,0x21,0x44,0x48,0x8a,0x4a,0x30,0x19,0xff,0x30,0x6f,0x00,0xf9,0x09,0xe9,0xfe,
-0x60,0x00,0x01,0xee,0x72,0x41,0x8e,0xb0,0x00,0x02,0x00,0x8e,0x00,0x01,0x00,0x14,
-0x44,0x4a,0xf4,0x44,0x43,0x06,0xbf,0x10,0x50,0x07,0xee,0xee,0xee,0xe4,0xd3,0x41,
-0x01,0xa8,0x2d,0x04,0xeb,0x36,0x03,0x69,0x08,0x25,0x00,0xf5,0xe1,0x2c,0x40,0x15,
-0x55,0x66,0x62,0x00,0x4b,0x40,0xdd,0xff,0x60,0x00,0xda,0x37,0x10,0x60,0xbd,0x0b,
-0x20,0xfe,0xe7,0x75,0x84,0xa3,0xa3,0x26,0xef,0x40,0x00,0x16,0x10,0x9d,0x00,0x42,
-0x71,0x21,0x03,0x48,0x47,0x21,0x25,0x44,0xe1,0x13,0x03,0x83,0x39,0x18,0x6f,0xf5,
-0x51,0x02,0xe3,0x13,0x19,0x06,0xdd,0x54,0x11,0x6e,0x0d,0x00,0x31,0x01,0x44,0x49,
-0xf8,0x0b,0x20,0x1a,0xfd,0x49,0x48,0xa0,0x8f,0xdb,0xfb,0x30,0x00,0x03,0xfc,0x63,
-0x52,0xaf,0xd7,0x03,0x10,0x9e,0x10,0x0c,0x68,0x44,0x4b,0xe4,0x44,0x43,0x09,0xa5,
-0x3e,0x00,0x5c,0x0d,0x10,0xe9,0x46,0x0c,0x31,0xa4,0x36,0xeb,0xfa,0x22,0x10,0x07,
-0x3b,0x32,0x30,0x40,0x00,0xbe,0xdb,0x01,0x02,0x39,0x5f,0x35,0x35,0x54,0x00,0xd1,
-0x6d,0x50,0x03,0x33,0x31,0x00,0xf6,0x3a,0x0b,0x10,0xc0,0x85,0x74,0x11,0x14,0xc6,
-0x2f,0x21,0x01,0xdd,0x71,0x04,0x30,0xbf,0xb0,0x00,0xde,0x1f,0xf1,0x00,0x8f,0x70,
-0x0e,0xca,0x70,0xbf,0x40,0x7f,0x40,0xed,0xa7,0x2b,0x23,0x90,0x66,0xc6,0x6d,0x12,
-0x00,0x02,0x65,0x00,0xb1,0x1d,0xc7,0x99,0xcf,0xab,0xd5,0xe8,0x00,0x6a,0xaa,0x98,
-0x64,0x0e,0x80,0xba,0x6c,0x06,0xa2,0x0a,0x20,0x8d,0xdd,0x53,0x01,0x31,0x36,0x65,
-0x6f,0x37,0x23,0x20,0xdf,0x30,0xce,0x01,0x10,0xfb,0xfd,0x00,0xc0,0xfb,0x8f,0xd3,
-0x00,0x02,0xee,0x60,0x02,0xbf,0x50,0x01,0x50,0x80,0x20,0x00,0x06,0x12,0x31,0x12,
-0x22,0xcf,0x7a,0x0c,0x64,0x13,0x33,0x3b,0xd2,0x22,0x20,0xc7,0x4b,0x09,0x06,0x00,
-0x15,0xb0,0x66,0x12,0x0a,0x86,0x01,0x40,0x02,0xbf,0x70,0x00,0xc7,0x3b,0x10,0xe5,
-0x28,0x4b,0xb1,0xd5,0x19,0xfd,0x30,0x00,0x28,0x30,0x00,0x01,0x73,0x00,0x97,0x15,
-0x03,0xa7,0x12,0xb1,0xf0,0x01,0x11,0x13,0xf5,0x11,0x10,0x00,0x05,0x80,0x2f,0x1e,
-0x33,0x22,0x02,0xf4,0x0a,0x70,0x06,0x1b,0x6a,0x19,0x09,0x86,0x01,0x12,0x3e,0x66,
-0x33,0x08,0x4a,0x02,0xc5,0x02,0x8f,0xd7,0xef,0x81,0x00,0x01,0xfc,0x60,0x00,0x6d,
-0xc0,0xff,0x66,0x00,0x80,0x01,0x41,0x21,0x55,0x55,0x9f,0x7d,0x07,0x11,0x06,0x64,
-0x06,0x11,0x3d,0x49,0x74,0x51,0x1e,0xc2,0x03,0xce,0x00,0x31,0x53,0x10,0xf3,0x46,
-0x75,0x10,0x00,0xf5,0x4c,0x30,0xce,0x76,0x8f,0xc5,0x78,0x35,0x8c,0xdb,0x70,0xe8,
-0x01,0x40,0x14,0x44,0xaf,0xd2,0xe7,0x01,0x00,0xbb,0x48,0xd3,0x29,0xfe,0x9f,0xd5,
-0x00,0x04,0xfc,0x60,0x01,0x9f,0x90,0x00,0x20,0x04,0x6f,0x40,0x66,0x66,0x65,0x8e,
-0xcf,0x49,0x16,0xeb,0xd6,0x35,0x26,0xee,0x10,0xca,0x6d,0x02,0x58,0x27,0x12,0x5f,
-0x0c,0x00,0x06,0xbe,0x1c,0x03,0xa7,0x1f,0x01,0xcf,0x00,0x21,0xaf,0xb1,0xa9,0x8c,
-0x00,0x5a,0x70,0xbe,0xf9,0x7d,0xf9,0x10,0x03,0xb6,0x10,0x00,0x49,0x30,0x12,0xec,
-0x0d,0x1f,0xbe,0xec,0x0d,0x16,0x04,0xba,0x00,0x24,0x9f,0xe2,0xba,0x00,0xd0,0x18,
-0xfe,0xaf,0xd4,0x00,0x03,0xfd,0x70,0x02,0xaf,0x80,0x00,0x30,0xa4,0x01,0x0f,0x86,
-0x0d,0x27,0x00,0x09,0x75,0x10,0x51,0x60,0x3e,0x10,0xef,0xdb,0x48,0x22,0x03,0xf4,
-0xd4,0x24,0x20,0x0e,0x70,0x55,0x0f,0x40,0xe7,0x00,0x04,0xf7,0x0b,0x00,0x20,0xcf,
-0xd0,0x91,0x73,0xfc,0x04,0x6f,0x60,0x0e,0x70,0x2f,0x80,0x9e,0x10,0xe7,0x0c,0xc0,
-0x01,0xe8,0x0e,0x70,0x91,0x00,0x02,0x40,0x2e,0x0d,0x09,0x3e,0x07,0x10,0x34,0xd6,
-0x05,0x21,0x1e,0xee,0x58,0x00,0x21,0x07,0xf2,0x3e,0x07,0x00,0x6a,0x07,0xf2,0x06,
-0xcf,0x30,0x00,0xe8,0x00,0xaf,0xdd,0x00,0x0e,0x80,0xaf,0x42,0xea,0x00,0xe8,0x7e,
-0x30,0x03,0xe3,0x0e,0x80,0x37,0x00,0x11,0x4e,0x5b,0x50,0x46,0x55,0x44,0x45,0xf7,
-0x82,0x22,0x16,0xf6,0xbe,0x3d,0x14,0x20,0x38,0x77,0x11,0x51,0xb9,0x75,0x10,0x80,
-0xde,0x06,0x01,0x58,0x00,0x10,0xea,0x58,0x00,0x10,0xaf,0x58,0x00,0xf0,0x06,0x6f,
-0xfa,0x00,0x0e,0x80,0x4f,0x95,0xf6,0x00,0xe8,0x4f,0x90,0x08,0xf1,0x0e,0x74,0x70,
-0x00,0x05,0x10,0xe7,0xac,0x2d,0x20,0x0f,0x70,0x62,0x04,0x13,0x83,0x58,0x3b,0x10,
-0xf7,0x96,0x07,0x01,0x7f,0x8c,0x07,0xbe,0x2c,0x00,0x8b,0x4a,0x54,0xd6,0x1d,0xee,
-0xef,0x80,0xb0,0x00,0x11,0x02,0xb2,0x0b,0xc0,0xdf,0x40,0x00,0xe8,0x00,0xbe,0xce,
-0x10,0x0e,0x80,0xbf,0x30,0x26,0x2a,0x34,0x20,0x02,0xc3,0x36,0x07,0x01,0x5d,0x45,
-0x20,0x03,0xf6,0x36,0x07,0x10,0x3f,0x91,0x0d,0x17,0x03,0x73,0x45,0x05,0x76,0x0c,
-0x01,0xde,0x06,0x54,0xc7,0x1e,0xee,0xef,0x60,0x46,0x08,0x20,0x03,0xf8,0xaf,0x6f,
-0xe0,0xdf,0x50,0x00,0xe8,0x00,0xce,0xbf,0x30,0x0e,0x81,0xde,0x20,0xbe,0x20,0xee,
-0x23,0x30,0x93,0x0c,0x70,0xbf,0x3c,0x10,0x40,0x5a,0x02,0x40,0x0f,0x50,0x04,0xf7,
-0x3e,0x2b,0x61,0x5f,0xff,0xee,0xef,0x50,0x04,0x4f,0x56,0x11,0x4f,0x39,0x4c,0x02,
-0x39,0x79,0x01,0xcf,0x21,0xa0,0x45,0x32,0x55,0x10,0xe6,0x00,0x6f,0xfe,0x9f,0xf6,
-0xd8,0x17,0x30,0xc0,0x1f,0x40,0x77,0x4d,0x10,0x04,0x7c,0x6b,0xf9,0x1c,0x2f,0x40,
-0x8e,0x00,0xe8,0x00,0x06,0xf6,0x0c,0xf0,0x0e,0xfe,0xb0,0xbf,0xc1,0xff,0x40,0xea,
-0x53,0x1f,0x9f,0x8e,0xba,0x0e,0x80,0x06,0xe0,0xcf,0x95,0xf1,0xe8,0x00,0xc8,0x05,
-0xf2,0x0d,0x6e,0x80,0x04,0x00,0x03,0x00,0x21,0xff,0x70,0x13,0xe8,0xad,0x39,0x03,
-0x85,0x1c,0xf1,0x32,0x06,0x73,0x46,0x50,0xd6,0x6d,0x2d,0xfb,0xbe,0xf0,0xf7,0x7e,
-0x00,0xba,0x07,0xd0,0xf6,0x7e,0x00,0xd8,0x0a,0xb0,0xf6,0x7e,0x00,0xf5,0x0d,0x80,
-0xf7,0x7e,0x03,0xf7,0x0f,0x80,0xff,0xfe,0x07,0xfc,0x4f,0xd0,0xf8,0x8e,0x0b,0xcf,
-0xae,0xf2,0xe6,0x7e,0x1f,0x4d,0xf7,0xd7,0xe6,0x7e,0x6e,0x08,0xf1,0x7c,0xe6,0x7e,
-0x34,0x02,0x60,0x04,0xe6,0x7b,0x06,0x02,0x06,0x00,0x11,0xe7,0x06,0x00,0x26,0xa4,
-0x6d,0xf9,0x15,0xf3,0x23,0x10,0x22,0x04,0x53,0x35,0x30,0xf4,0xba,0x2e,0xfb,0xcf,
-0xe0,0xf5,0xba,0x00,0xc9,0x09,0xb0,0xf5,0xaa,0x00,0xf6,0x0e,0x80,0xff,0xfa,0x05,
-0xfa,0x3f,0xc0,0xf8,0xba,0x0c,0xdf,0xbc,0xf3,0xf5,0xaa,0x4f,0x2d,0xf3,0xa9,0xf5,
-0xaa,0x57,0x04,0x80,0x13,0xf4,0xaa,0x9b,0x81,0x11,0x09,0x60,0x30,0x00,0x08,0x1b,
-0x02,0xc0,0x30,0x08,0x06,0x00,0x28,0xf6,0x00,0xe8,0x2e,0x30,0x3f,0xff,0xab,0xfb,
-0x42,0x40,0x26,0xf5,0x15,0xf6,0x54,0x03,0x20,0x00,0xcd,0x7e,0x04,0xc0,0xeb,0xae,
-0xf8,0x00,0x00,0x7e,0x32,0xef,0x34,0xf6,0x00,0x02,0x52,0x2b,0x8a,0x10,0x02,0x44,
-0x44,0xcd,0x44,0x44,0x30,0x53,0x5a,0x41,0xce,0xee,0xee,0xee,0x20,0x70,0x13,0x5a,
-0xc3,0x0c,0x0e,0xd0,0x0c,0x05,0xcf,0x39,0xf0,0x05,0x05,0x54,0x25,0x51,0x05,0xf0,
-0x3d,0xef,0x7d,0xf8,0x06,0xf0,0x00,0x9c,0x01,0xf4,0x06,0xf0,0x00,0xea,0xa5,0x0d,
-0xf4,0x08,0x04,0xff,0x0d,0xf3,0x06,0xf0,0x0c,0xbf,0xbf,0xda,0x06,0xf0,0x4f,0x38,
-0xf9,0x5f,0x16,0xf0,0x68,0x01,0xb1,0x08,0x15,0x76,0x6a,0x10,0x0c,0x17,0x0a,0x00,
-0x69,0x21,0x1d,0x4a,0xc9,0x4f,0x23,0x07,0xe0,0x18,0x14,0x20,0x85,0x41,0x62,0x04,
-0x20,0x1b,0xee,0x4a,0x4c,0x00,0xfc,0x00,0xd5,0x4f,0x20,0x02,0xff,0xff,0xf8,0x04,
-0xf2,0x00,0x02,0x33,0x6f,0x50,0xa5,0x0d,0x00,0x8b,0x20,0xc0,0x4f,0x75,0x30,0x00,
-0xbf,0x60,0x04,0xff,0xfa,0x00,0x6f,0xce,0x42,0x02,0x20,0x2f,0x91,0x12,0x4a,0xbe,
-0x1e,0xb0,0x05,0xf2,0x4f,0x20,0x03,0xa0,0x00,0x07,0x34,0x23,0x75,0x04,0x1a,0x2c,
-0x43,0x30,0x00,0x01,0x75,0x68,0x00,0x10,0x80,0x16,0x31,0x61,0x55,0x56,0x10,0x5f,
-0x10,0x01,0x1b,0x49,0x00,0x9c,0x08,0x10,0x10,0xfb,0x7a,0x80,0x4f,0x70,0x05,0xff,
-0xf7,0x00,0x3f,0xfd,0xd9,0x0d,0xb2,0x5f,0xa2,0xec,0x05,0xf1,0x00,0x3f,0x80,0x02,
-0xc3,0x4f,0x99,0x5d,0x02,0x81,0x7c,0x20,0xfe,0x10,0x94,0x4f,0x21,0x48,0xf1,0x2a,
-0x08,0x11,0x5f,0x93,0x7a,0x22,0x05,0xf1,0xf0,0x23,0x03,0x88,0x23,0x00,0x68,0x00,
-0x00,0x30,0x0f,0x51,0x2c,0xee,0x70,0x06,0xf0,0x68,0x00,0x50,0x6f,0x00,0x02,0xee,
-0xee,0xc0,0x56,0x00,0x21,0x13,0xc0,0x6f,0xaa,0x40,0x00,0x8f,0x50,0x06,0xfa,0x93,
-0x00,0x7f,0xed,0x23,0x54,0xb1,0x8f,0x71,0xdc,0x06,0xf0,0x00,0x5e,0x50,0x01,0xa2,
-0x5e,0x15,0x40,0x11,0x04,0xb9,0x0c,0x01,0x0a,0x01,0x11,0x9e,0xfc,0x0d,0x21,0x0f,
-0xf5,0x4b,0x8a,0x30,0xea,0xfa,0xf9,0x3c,0x7a,0xe0,0x0a,0xf6,0x08,0xf1,0x00,0x24,
-0x00,0x15,0x00,0x03,0x00,0x02,0x85,0x51,0x68,0x00,0x30,0x2a,0xdd,0x60,0xa1,0x5e,
-0x91,0x77,0x77,0x20,0x4f,0x20,0x01,0xab,0xbc,0xf6,0xf7,0x00,0xf4,0x0f,0xdd,0x00,
-0x3f,0xff,0x90,0x00,0xbf,0x60,0x03,0xf7,0x52,0x01,0xbf,0xcf,0x30,0x3f,0x20,0x02,
-0xdd,0x20,0xaf,0x23,0xf2,0x00,0x48,0x00,0x00,0x50,0x2f,0x10,0xb0,0x52,0x14,0x4f,
-0xdf,0x67,0x25,0xaf,0x70,0x79,0x08,0x30,0x29,0xfc,0xfd,0x98,0x1a,0x70,0xc4,0x02,
-0xaf,0xb0,0x00,0x03,0x30,0x7d,0x57,0x30,0x00,0x65,0x30,0x2e,0x17,0x70,0xce,0xf3,
-0x04,0xe0,0xe7,0x00,0x11,0x46,0x30,0x98,0x0c,0xff,0xfe,0x07,0xe0,0xe7,0x02,0x33,
-0xcd,0x9e,0x0d,0x00,0x98,0x0d,0x20,0x0e,0xf3,0x98,0x0d,0xfe,0x06,0x8f,0xea,0x07,
-0xe0,0xe7,0x03,0xf7,0x5f,0x26,0xe0,0xe7,0x0d,0xb0,0x0c,0xa6,0xe0,0xe7,0x1a,0x10,
-0x02,0x66,0x98,0x0d,0x13,0xc0,0x98,0x0d,0x02,0x30,0x01,0x60,0x2b,0xee,0x70,0x00,
-0xe7,0x04,0x23,0x44,0x50,0x72,0xde,0xde,0xf6,0x00,0xd2,0x30,0xf0,0x04,0x15,0x5f,
-0x70,0x00,0x7f,0x62,0xef,0xf7,0x00,0x6f,0xee,0x10,0x0e,0x70,0x8f,0x71,0xdd,0x10,
-0xe7,0x28,0x01,0x20,0x0f,0x70,0x31,0x2c,0x10,0xe7,0xe3,0x04,0x20,0x07,0x20,0x02,
-0x92,0x00,0xf2,0x01,0xfc,0x04,0xef,0x50,0x00,0x00,0x5f,0xb0,0xaf,0x80,0x00,0x6f,
-0xa0,0x00,0x6f,0xa0,0x03,0x40,0x00,0x00,0x25,0x58,0x00,0x41,0x80,0xde,0xde,0xf7,
-0xdd,0x47,0xb0,0x15,0x5f,0x80,0x00,0x5f,0x72,0xef,0xf8,0x00,0x5f,0xee,0x78,0x0b,
-0x82,0x90,0xce,0x10,0xe8,0x3f,0x60,0x00,0x93,0x20,0x04,0x10,0xb5,0x65,0x18,0xa0,
-0xc5,0x00,0x00,0xaf,0x62,0x3a,0xf3,0x00,0x0f,0x90,0x78,0x0b,0x10,0xdc,0x78,0x0b,
-0x11,0x04,0x78,0x0b,0x32,0x00,0x45,0x52,0x10,0x01,0x15,0x21,0x10,0x01,0x20,0x06,
-0xf0,0x10,0x01,0x61,0x06,0xf0,0xf7,0x02,0x33,0xcd,0x2f,0x57,0x10,0xf8,0x06,0x00,
-0x30,0x06,0xf3,0xcd,0xe8,0x2f,0xc0,0xf4,0x6a,0xf0,0xe7,0x00,0x8f,0xda,0x05,0xf0,
-0xe7,0x03,0xf6,0x78,0x0b,0xad,0x0e,0xa0,0x0c,0xa5,0xf0,0xe7,0x19,0x00,0x02,0x65,
-0x78,0x0b,0x24,0x04,0xd0,0xa8,0x0e,0x32,0x02,0x53,0x21,0x39,0x60,0x15,0xf1,0xb9,
-0x0e,0x10,0x09,0x4b,0x45,0x00,0xa2,0x09,0x21,0x6f,0xb0,0x69,0x7f,0x11,0xd1,0x24,
-0x37,0x20,0xfa,0x00,0x6f,0x44,0xe1,0xa8,0xfd,0x30,0x00,0x06,0xfc,0x40,0x12,0xbf,
-0x50,0x00,0x23,0x00,0x8d,0xd1,0x15,0x21,0x09,0xd0,0x04,0x25,0x59,0xbe,0x55,0x55,
-0x40,0xbf,0x09,0x63,0x21,0x34,0x22,0x84,0x2d,0xf0,0x03,0xf1,0x00,0x6d,0x00,0x22,
-0x43,0x10,0x08,0xe0,0x7f,0xff,0xfe,0x00,0x7e,0x00,0x11,0x3f,0x90,0xa3,0x0e,0xf8,
-0x09,0xf1,0x00,0x7e,0x00,0x0b,0xff,0x70,0x07,0xe0,0x0b,0xf3,0x7f,0x40,0x7e,0x0c,
-0xe3,0x10,0x8e,0x07,0xe0,0x41,0x0f,0x40,0x10,0x56,0x1c,0x15,0x1f,0x56,0x1c,0x07,
-0xae,0x0e,0x14,0x14,0x5f,0x00,0x31,0x5f,0xed,0xc0,0xbe,0x06,0x11,0x53,0xd4,0x0f,
-0x30,0x56,0x66,0x10,0x27,0x3b,0x31,0xdf,0xf3,0x00,0x1d,0x2c,0x01,0x1f,0x1c,0x10,
-0xfc,0xb2,0x5a,0xb4,0xdf,0x85,0xde,0x70,0x00,0x08,0xd7,0x10,0x00,0x6c,0x60,0x0f,
-0x48,0x00,0x6d,0x0b,0x8b,0xfe,0x03,0x55,0x55,0xbe,0x55,0x44,0x30,0x7d,0x2f,0x27,
-0x0a,0xd0,0x46,0x2e,0x27,0x01,0x10,0x39,0x4b,0x21,0xfe,0xc9,0x7c,0x06,0x12,0x64,
-0x7a,0x29,0x10,0xf3,0xd7,0x51,0x20,0xcf,0xb0,0xeb,0x81,0x10,0xfc,0x9f,0x08,0xb0,
-0xfb,0x9f,0xd5,0x00,0x06,0xd8,0x20,0x01,0x9e,0x30,0x14,0xf4,0x1a,0x23,0x42,0x9f,
-0xb9,0x5f,0x20,0x1a,0xc1,0xf4,0x08,0x22,0xef,0xfe,0x9a,0x08,0x12,0xaf,0xdb,0x48,
-0x07,0x06,0x00,0x26,0x5f,0x10,0xe4,0x6b,0x01,0xb0,0x0b,0x21,0xdc,0xa0,0x39,0x09,
-0x13,0x76,0xd3,0x0b,0x10,0x50,0x2c,0x0a,0x21,0xaf,0xd1,0x25,0x0a,0x10,0xe1,0xab,
-0x0b,0x30,0xfd,0x9f,0xd6,0x22,0x0b,0x33,0x00,0x18,0xe5,0x32,0x00,0x14,0x0a,0x65,
-0x2e,0x71,0x56,0xf8,0x55,0x43,0x00,0x04,0x40,0xb6,0x1b,0x31,0xbc,0x02,0xf3,0xf5,
-0x2d,0x11,0x02,0x44,0x55,0x05,0x4c,0x75,0x06,0x1f,0x0a,0x03,0x91,0x06,0x21,0xfe,
-0xcb,0xf9,0x1d,0x12,0x65,0x78,0x54,0x10,0xf7,0x37,0x49,0xf0,0x02,0x9f,0xb1,0x00,
-0x00,0x04,0x9f,0xfe,0x50,0x00,0x05,0xef,0xb4,0x29,0xee,0x50,0x02,0x41,0xe1,0x0a,
-0x10,0xaf,0x28,0x0a,0x20,0xfd,0x25,0x50,0x56,0x65,0x53,0x00,0x34,0x4a,0xf4,0x44,
-0x7b,0x52,0x43,0x11,0x01,0x6f,0x10,0xfa,0x52,0x11,0xeb,0x89,0x62,0x09,0x55,0x17,
-0x0f,0x3b,0x01,0x13,0x10,0xc4,0x3b,0x01,0x41,0x02,0x9e,0x20,0x24,0x3b,0x01,0x18,
-0xbf,0x3b,0x01,0x30,0x03,0x9e,0xfa,0x6d,0x03,0x30,0xc8,0x7b,0xf7,0xf1,0x17,0x00,
-0xa5,0x01,0x20,0xae,0x10,0xeb,0x5f,0x12,0x2e,0x8c,0x20,0x11,0x45,0xd0,0x18,0xf0,
-0x03,0x43,0x00,0x00,0x20,0x04,0xce,0xe4,0x00,0x7e,0x00,0x34,0x44,0x40,0x07,0xe0,
-0x5f,0xfe,0xff,0xdf,0x10,0x40,0x4f,0x90,0x07,0xe0,0x24,0x90,0xf9,0x03,0x6e,0x02,
-0xcf,0x65,0xf9,0x06,0xf0,0x9a,0x20,0x03,0xa0,0x6f,0x03,0x33,0x45,0x68,0x66,0xf2,
-0x61,0x1b,0x0c,0xf1,0x19,0x18,0xb1,0xfb,0x16,0x00,0x08,0x00,0x07,0x24,0x01,0x11,
-0x7f,0x70,0x37,0x21,0x14,0x44,0x91,0x01,0x10,0x3c,0x93,0x0a,0xb8,0x5c,0xfc,0x9f,
-0xd6,0x00,0x04,0xe9,0x30,0x01,0x8e,0x40,0xd2,0x3e,0x02,0x50,0x64,0x09,0x24,0x54,
-0x05,0xed,0x0a,0x17,0x4f,0xed,0x0a,0x12,0x18,0xdd,0x09,0x80,0x20,0x0e,0xff,0xb0,
-0x00,0x6e,0x00,0x02,0x5b,0x1f,0xb0,0xab,0xbc,0xc5,0x00,0x7e,0x07,0x88,0x9f,0x60,
-0x07,0xe0,0x7c,0x11,0x10,0x7e,0xc1,0x0a,0x00,0xc9,0x00,0xf5,0x0b,0x60,0x00,0x7f,
-0x00,0x2f,0xed,0x00,0x07,0xf0,0x0d,0xc2,0xf7,0x00,0x7f,0x0a,0xe2,0x07,0xf1,0x07,
-0xf4,0xf3,0x00,0x0b,0x60,0x7f,0x01,0x8f,0x0d,0x18,0x7f,0xe9,0x23,0x30,0x64,0x31,
-0x00,0x26,0x1d,0xc0,0x90,0x00,0xba,0x03,0x44,0x45,0x10,0x0c,0xb0,0xef,0xff,0xf8,
-0x97,0x18,0x10,0x8f,0xf0,0x6f,0xf0,0x06,0x4f,0x90,0x00,0xbb,0x00,0x4f,0xef,0x30,
-0x0b,0xb0,0x5f,0xa0,0xaf,0x30,0xbb,0x2f,0x70,0x00,0x96,0x0b,0xb0,0x8a,0x02,0x40,
-0x97,0x00,0x00,0x9e,0xca,0x19,0x70,0xaf,0x63,0x38,0xf6,0x00,0x0f,0x90,0xb4,0x0a,
-0x40,0xdc,0x00,0x03,0xf9,0x91,0x04,0x00,0xee,0x00,0x24,0x45,0x53,0x48,0x0e,0x50,
-0x22,0x33,0x42,0x02,0xf3,0x78,0x10,0x12,0xf0,0x30,0x31,0x21,0x02,0xf4,0x17,0x78,
-0xf0,0x0a,0x2f,0x40,0x03,0xde,0xee,0xf3,0x02,0xf4,0x00,0x04,0x45,0xfc,0x00,0x2f,
-0xfe,0xb0,0x00,0x8f,0x40,0x02,0xf8,0x53,0x00,0x3f,0xa0,0xb9,0x10,0x20,0x1d,0xd0,
-0xb6,0x28,0x20,0x0c,0xe2,0x0b,0x52,0x24,0x03,0xc1,0x54,0x5b,0x03,0x18,0x52,0x28,
-0x02,0xf4,0x17,0x52,0x03,0x11,0x79,0x00,0x6c,0x81,0x20,0x06,0xe0,0x21,0x76,0x70,
-0x57,0xe0,0xf7,0x00,0x11,0x3f,0x47,0xd9,0x05,0xf0,0x0a,0x6f,0x17,0xe0,0xe7,0x26,
-0x77,0xcd,0x07,0xe1,0xe7,0x5c,0xdd,0xf6,0x07,0xff,0xf7,0x00,0x09,0xf1,0x07,0xe2,
-0xe7,0x00,0x2f,0x70,0x1b,0x06,0x10,0xcd,0x37,0x36,0x20,0x09,0xf3,0x06,0x00,0x30,
-0x3f,0x40,0x00,0x1b,0x06,0x04,0x49,0x36,0x12,0x07,0xff,0x04,0x17,0xc0,0x6c,0x81,
-0x30,0x04,0x10,0x13,0x80,0x76,0x40,0x0c,0xff,0xff,0xf2,0x82,0x0a,0x10,0x9f,0x09,
-0x06,0xf0,0x0c,0x0d,0xb0,0x0e,0x71,0xbc,0xcc,0xf6,0x12,0xe7,0x06,0x77,0xee,0x8f,
-0xff,0x70,0x00,0x4f,0x70,0x22,0xe7,0x00,0x0d,0xc0,0x00,0x0e,0x70,0x0a,0xde,0x53,
-0x20,0x08,0xf4,0xbf,0x80,0x1f,0xd4,0x0c,0x81,0x1a,0xc1,0xcb,0x00,0xe7,0x19,0x99,
-0x9f,0x60,0x0e,0x71,0x9a,0xae,0xe8,0x0c,0x81,0x40,0x13,0x3e,0x70,0x09,0x6c,0x6d,
-0x20,0x1d,0xe4,0x4d,0x00,0x02,0xcd,0x76,0x2f,0x09,0x30,0x0c,0x81,0x01,0x12,0x0f,
-0xa1,0x2f,0x04,0xe9,0x12,0xf0,0x0d,0x10,0x35,0x56,0x64,0x00,0xba,0x0b,0xed,0xdf,
-0xe0,0x0c,0xa0,0x12,0x22,0xdb,0x00,0xca,0x0f,0xff,0xff,0x7d,0xef,0xa0,0x00,0x5f,
-0x80,0x66,0xda,0x8d,0x06,0x30,0x0c,0xa0,0xbf,0x7c,0x81,0x20,0x08,0x10,0xf2,0x41,
-0x0f,0xd8,0x76,0x04,0x1e,0xf5,0xd8,0x76,0xf0,0x1b,0x04,0x20,0x24,0x55,0x53,0x00,
+0x0a,0xb0,0x6e,0xef,0xb0,0x00,0x23,0x00,0x00,0x55,0x00,0x3e,0xee,0xee,0xff,0x60,
+0x00,0x45,0x54,0x44,0xf8,0x00,0x3e,0xee,0xff,0xff,0x70,0x05,0xf6,0x44,0x44,0x30,
+0x00,0x4f,0xfe,0xef,0xff,0xd0,0x00,0x45,0x55,0x54,0x42,0x10,0x01,0xf0,0x2b,0x00,
+0x8c,0xc7,0x01,0xf2,0xe7,0x09,0xf7,0x7f,0x52,0xf3,0xe7,0x0e,0x80,0x0b,0xa2,0xf3,
+0xe7,0x0f,0x70,0x0a,0xb2,0xf3,0xe7,0x0c,0xb0,0x0d,0x82,0xf3,0xe7,0x03,0xee,0xfd,
+0x12,0xf3,0xe7,0x00,0x14,0x30,0x02,0xf3,0xe7,0x16,0x66,0x78,0xa5,0xf3,0xe7,0x4d,
+0xdf,0xeb,0x84,0xf3,0xe7,0x00,0x0e,0x80,0x02,0x06,0x00,0x21,0x85,0xff,0x0c,0x00,
+0x15,0x25,0x12,0x00,0x65,0x09,0x40,0x01,0xc1,0xd7,0x00,0x01,0x00,0x54,0x01,0x30,
+0x01,0xad,0xc4,0x70,0x01,0x90,0x4f,0x30,0x0e,0x70,0x7e,0x05,0xf1,0x00,0xd8,0x0b,
+0x00,0xf3,0x0f,0x0f,0x60,0x6e,0x00,0xec,0x6b,0xe1,0x06,0xf0,0x02,0xad,0xb2,0x00,
+0x6f,0x00,0x00,0x00,0x13,0x26,0xf2,0xef,0xff,0xff,0xfa,0x6f,0x04,0x57,0xf6,0x20,
+0x06,0x65,0x01,0x03,0x7b,0x01,0x63,0x30,0x00,0x7e,0x00,0x01,0xa1,0x70,0x01,0x00,
+0x01,0x00,0x01,0x30,0x02,0xc0,0x4c,0xff,0xe7,0x00,0x00,0x00,0x2f,0xa3,0x27,0xf6,
+0x00,0x00,0x50,0x01,0xf0,0x05,0xd0,0x00,0x00,0x8f,0x00,0x00,0xad,0x00,0x00,0x03,
+0xf7,0x00,0x3f,0x90,0x00,0x00,0x07,0xff,0xef,0xb0,0x83,0x00,0x24,0x45,0x20,0x36,
+0x00,0x20,0x0a,0xff,0x01,0x00,0xf5,0x05,0xf0,0x24,0x4c,0xd4,0x48,0xf4,0x32,0x00,
+0x00,0xac,0x00,0x5f,0x10,0x00,0x00,0x0a,0xc0,0x05,0xf1,0x00,0x0d,0x00,0x72,0xb0,
+0x05,0xf0,0x00,0x00,0x00,0x11,0xd6,0x01,0x10,0x14,0x24,0x01,0xd0,0x0b,0xff,0xef,
+0xc1,0x00,0x00,0x9f,0x30,0x01,0xda,0x00,0x00,0xbd,0x28,0x00,0xf0,0x04,0x00,0x6f,
+0xa6,0x69,0xf7,0x00,0x00,0x05,0xbd,0xdb,0x60,0x00,0x24,0x43,0x33,0x33,0x34,0x43,
+0xaf,0x57,0x00,0xf1,0x12,0xeb,0x00,0x06,0xf1,0x08,0xf0,0x00,0x00,0x5a,0xf7,0x6b,
+0xf7,0x00,0x00,0xbe,0xed,0xdd,0xdf,0x10,0x00,0x13,0x33,0x33,0x6f,0x10,0x00,0xef,
+0xff,0xff,0xff,0x10,0x00,0xea,0x84,0x00,0x11,0xdf,0x95,0x01,0x30,0x36,0x66,0x65,
+0xbd,0x02,0x20,0x26,0x64,0x13,0x00,0x30,0xaf,0xdd,0xfb,0xb6,0x02,0xfa,0x15,0x50,
+0x03,0xf7,0x00,0x00,0x0c,0xc0,0x00,0x0a,0xb0,0x00,0x00,0xcb,0x00,0x00,0x9d,0x00,
+0x00,0x08,0xf1,0x00,0x0d,0xa0,0x00,0x00,0x1e,0xe8,0x7d,0xe1,0x00,0x00,0x00,0x18,
+0xcc,0x92,0x00,0x01,0x00,0xd4,0x9e,0xee,0xee,0xee,0xee,0xed,0x03,0x66,0x66,0x55,
+0x56,0x66,0x50,0x15,0x00,0xe0,0x4b,0xff,0xd6,0x00,0x00,0x00,0x4f,0xb5,0x48,0xf8,
+0x00,0x00,0x0a,0xe0,0x49,0x03,0x50,0x00,0x8f,0x30,0x01,0xdc,0x1e,0x03,0x20,0xee,
+0xfd,0x0a,0x01,0x61,0x25,0x53,0x00,0x00,0x00,0x21,0xb9,0x02,0x11,0xaf,0x10,0x01,
+0x91,0x01,0x33,0x34,0x44,0x43,0x33,0x20,0x00,0x26,0x40,0x00,0x21,0x08,0xf0,0x07,
+0x00,0x12,0x8f,0x0d,0x00,0xe0,0xf2,0x11,0x11,0x20,0x00,0x00,0x7f,0xff,0xff,0xff,
+0x50,0x00,0x00,0x22,0x99,0x02,0x04,0x16,0x01,0x12,0xfe,0x16,0x01,0x21,0x02,0xe9,
+0x16,0x01,0xa0,0xbb,0x00,0x00,0x6f,0x95,0x59,0xf7,0x00,0x00,0x06,0x16,0x01,0x70,
+0x12,0x22,0x11,0x12,0x22,0x32,0xbf,0x5d,0x00,0x31,0xfe,0x01,0x22,0xc4,0x02,0xa1,
+0xce,0xdd,0xde,0xed,0x00,0x00,0x47,0x76,0x66,0x9f,0x16,0x01,0x11,0x8f,0x16,0x01,
+0x2e,0xfe,0x00,0x16,0x01,0x03,0x0e,0x04,0x44,0x06,0xef,0xff,0x90,0x0d,0x04,0x11,
+0xad,0x0e,0x01,0xa0,0x8f,0x40,0x03,0xeb,0x00,0x00,0x0a,0xff,0xff,0xc1,0x2d,0x02,
+0xf4,0x00,0x31,0x00,0x00,0x25,0x55,0x55,0x55,0x55,0x54,0x9f,0xff,0xee,0xef,0xff,
+0xfc,0x12,0x01,0xa0,0xff,0xff,0xfe,0x10,0x00,0xcd,0x55,0x55,0x8f,0x20,0x44,0x01,
+0x14,0x4f,0x06,0x00,0x11,0xbf,0x82,0x01,0x12,0x15,0xf5,0x02,0x0f,0x60,0x00,0x1c,
+0x00,0x65,0x01,0x04,0x60,0x00,0xf0,0x01,0x03,0xbe,0xfd,0x80,0x00,0x00,0x2f,0xc5,
+0x47,0xfa,0x00,0x00,0x7f,0x10,0x00,0x7f,0x06,0x00,0x00,0x2b,0x01,0xa4,0x2e,0xd7,
+0x69,0xfa,0x00,0x00,0x02,0x9c,0xcb,0x60,0xa0,0x02,0xf1,0x1b,0x35,0x40,0x00,0x7e,
+0x00,0x8f,0xdf,0xa0,0x07,0xe0,0x2f,0x60,0x3f,0x30,0x7e,0x06,0xf0,0x00,0xe7,0x07,
+0xe0,0x7e,0x00,0x0d,0x80,0x7e,0x05,0xf1,0x01,0xf5,0x07,0xe0,0x0e,0xc6,0xce,0x00,
+0x7e,0x00,0x2a,0xcb,0x20,0x07,0xd5,0x02,0x10,0x7e,0x74,0x00,0xa7,0x47,0xe2,0xff,
+0xff,0xff,0xfc,0x7e,0x03,0x44,0x43,0x16,0x00,0x26,0x00,0x06,0x66,0x04,0x11,0x05,
+0xf8,0x02,0xf0,0x0c,0xe7,0x00,0x9d,0xd7,0x00,0x0e,0x70,0xae,0x68,0xf5,0x00,0xe7,
+0x1f,0x60,0x0b,0xb0,0x0e,0x73,0xf2,0x00,0x8e,0x00,0xe7,0x4f,0x20,0x08,0xe0,0x0b,
+0x00,0x10,0x9d,0x16,0x00,0xb0,0x0c,0xa0,0x0e,0x70,0xbe,0x58,0xf5,0x00,0xe7,0x01,
+0xae,0x2c,0x00,0x02,0x37,0x00,0x28,0x00,0x00,0x0b,0x00,0x25,0x0d,0x70,0x49,0x02,
+0xf1,0x20,0x03,0x20,0x08,0xdd,0x70,0x00,0xd9,0x08,0xf7,0x8f,0x60,0x0d,0x90,0xe8,
+0x00,0xac,0x00,0xd9,0x0f,0x60,0x08,0xe0,0x0d,0x90,0xf6,0x00,0x8d,0x00,0xd9,0x0c,
+0xc0,0x0d,0xa0,0x0d,0x90,0x3f,0xff,0xe2,0x00,0xd8,0x00,0x15,0x50,0x00,0x0d,0x80,
+0x00,0x40,0x02,0xa1,0x4f,0xff,0xff,0xff,0x60,0x01,0x55,0x44,0x44,0xf8,0x58,0x00,
+0x01,0x16,0x00,0x16,0xe8,0x63,0x00,0x12,0x41,0x5a,0x00,0xf5,0x1a,0x04,0x99,0x20,
+0x00,0xe7,0x05,0xfb,0xdf,0x20,0x0e,0x80,0xda,0x00,0xe8,0x00,0xe8,0x0f,0x50,0x0b,
+0xb0,0x0e,0x80,0xf5,0x00,0xab,0x00,0xe8,0x0e,0x70,0x0c,0x90,0x0e,0x80,0x9e,0x68,
+0xf4,0x00,0xe8,0x00,0x9e,0xd6,0x9a,0x00,0x20,0x07,0x30,0x0b,0x00,0x61,0xf8,0x00,
+0x00,0x62,0x00,0x0f,0x55,0x00,0xc0,0xf9,0x11,0x11,0x21,0x00,0x0e,0xff,0xff,0xff,
+0xc0,0x00,0x12,0x4a,0x02,0x02,0x01,0x00,0xf4,0x06,0x8d,0xe8,0x00,0x0d,0x70,0x09,
+0xf7,0x8f,0x70,0x0e,0x80,0x0f,0x80,0x09,0xd0,0x0e,0x80,0x0f,0x60,0x07,0xe0,0x0c,
+0x00,0x93,0x09,0xf8,0x8f,0x80,0x0e,0x80,0x00,0x8c,0xc8,0x56,0x00,0xf1,0x07,0x07,
+0x20,0x00,0x05,0x66,0x66,0x67,0x20,0x00,0x3e,0xee,0xdd,0xdf,0x80,0x00,0x00,0x11,
+0x11,0x2e,0x80,0x00,0x0f,0xd5,0x02,0x11,0x1f,0xb2,0x01,0x00,0x0c,0x00,0x63,0xe0,
+0x00,0x03,0x55,0x54,0x44,0x2c,0x04,0xf2,0x06,0x08,0xde,0x90,0x00,0x7d,0x09,0xf7,
+0x8f,0xa0,0x08,0xe0,0xf8,0x00,0xaf,0x00,0x7e,0x0f,0x60,0x08,0xf1,0x07,0x0b,0x00,
+0xb1,0x09,0xf8,0x9f,0xb0,0x08,0xe0,0x08,0xcd,0x91,0x00,0x8e,0x3c,0x01,0xc0,0x60,
+0x03,0x55,0x61,0x35,0x53,0x00,0xbe,0xef,0x7a,0xef,0xe0,0xc1,0x00,0x90,0x7e,0x00,
+0xbf,0xff,0x60,0x07,0xe0,0x0c,0xa0,0xc0,0x01,0xa1,0xcf,0xee,0xe1,0x07,0xe0,0x02,
+0x55,0x53,0x00,0x13,0x26,0x06,0x10,0x00,0x68,0x01,0xf0,0x1b,0xe7,0x09,0xf7,0x8f,
+0x50,0x0e,0x80,0xe8,0x00,0xbb,0x00,0xe8,0x0f,0x60,0x09,0xc0,0x0e,0x70,0xf7,0x00,
+0x9b,0x00,0xe7,0x0c,0xc0,0x1e,0x80,0x0e,0x70,0x3e,0xff,0xd1,0x00,0xe7,0x00,0x14,
+0x40,0x00,0x0d,0x60,0x00,0x01,0x7d,0x03,0x00,0xfa,0x00,0x90,0x70,0x00,0xf9,0x33,
+0x22,0xf8,0x00,0x0f,0x70,0x03,0x00,0x41,0xf7,0x00,0x00,0xf7,0xb1,0x00,0x62,0x60,
+0x00,0x24,0x44,0x43,0x30,0x70,0x02,0x90,0x07,0xcc,0x60,0x00,0x7e,0x08,0xf8,0x8f,
+0x50,0xa5,0x00,0x10,0xbb,0xb0,0x00,0xf2,0x03,0x09,0xd0,0x07,0xe0,0xf7,0x00,0x9c,
+0x00,0x7e,0x0a,0xe4,0x5f,0x70,0x07,0xe0,0x1b,0xff,0xa0,0x4f,0x02,0xa0,0x05,0xb0,
+0x00,0x62,0x00,0x00,0x25,0x00,0x0f,0x70,0x73,0x06,0xa0,0xfa,0x66,0x66,0xae,0x00,
+0x0f,0xff,0xee,0xef,0xe0,0x58,0x00,0x11,0x7e,0x6e,0x00,0x62,0xd0,0x00,0x24,0x44,
+0x44,0x41,0xb0,0x00,0xf0,0x07,0x00,0x7c,0xc5,0x00,0x0e,0x80,0x09,0xf7,0x9f,0x40,
+0x0e,0x80,0x0f,0x70,0x0c,0xa0,0x0e,0x80,0x1f,0x50,0x09,0xc0,0x0c,0x00,0xd3,0x0a,
+0xb0,0x0e,0x80,0x0b,0xe4,0x6f,0x70,0x0e,0x80,0x01,0xcf,0xf9,0x00,0x02,0x20,0x0b,
+0x60,0xb7,0x01,0xb0,0x52,0x00,0x00,0x00,0xf6,0x00,0xf6,0x00,0x00,0x04,0xf6,0xd3,
+0x04,0xf3,0x08,0x0a,0xfe,0x29,0xff,0x20,0x00,0x3f,0x6c,0xdf,0x6c,0xd1,0x00,0xe9,
+0x00,0xfa,0x01,0xd8,0x00,0x60,0x00,0x50,0x00,0x01,0xd5,0x02,0xb0,0x45,0x55,0x60,
+0x06,0xe0,0x00,0x1e,0xff,0xff,0x40,0x7f,0xa9,0x01,0x20,0xf0,0x06,0x7f,0x04,0x11,
+0xcc,0x11,0x06,0xf2,0x1b,0x2f,0x60,0x06,0xf1,0x00,0x00,0x0a,0xf2,0x00,0x6f,0xff,
+0x90,0x03,0xff,0x90,0x06,0xf4,0x41,0x00,0xcd,0x7f,0x20,0x6f,0x00,0x00,0x6f,0x30,
+0xdb,0x06,0xf0,0x00,0x1f,0x70,0x04,0xf3,0x6f,0x00,0x01,0x60,0x00,0x04,0x16,0xb3,
+0x04,0x21,0x6f,0x00,0x2f,0x03,0x11,0xf1,0x07,0x00,0x13,0x5f,0xef,0x07,0x04,0xe3,
+0x02,0xc0,0x34,0x55,0x50,0x03,0xf1,0x00,0x1e,0xee,0xef,0x40,0x4f,0x20,0x19,0x05,
+0x22,0x04,0xf2,0x28,0x06,0xf2,0x0b,0x76,0x20,0x01,0xdf,0x50,0x03,0xff,0xf9,0x00,
+0xce,0xbe,0x20,0x3f,0x20,0x01,0xce,0x30,0xcd,0x03,0xf2,0x00,0x5b,0x10,0x01,0xc3,
+0x3f,0x3b,0x00,0x41,0x40,0x00,0x00,0xbf,0xa9,0x04,0x43,0x03,0x55,0x44,0x48,0x5b,
+0x00,0x17,0x10,0x68,0x00,0x24,0x6f,0x00,0x27,0x00,0x02,0xd0,0x00,0xf0,0x03,0x56,
+0x77,0x70,0x03,0xf2,0x00,0x1d,0xdd,0xef,0x30,0x4f,0x30,0x00,0x00,0x0b,0xd0,0x04,
+0xf3,0x08,0x01,0x10,0x00,0x0d,0x00,0xf0,0x12,0xdf,0x40,0x03,0xfb,0xa4,0x00,0x9f,
+0xde,0x10,0x3f,0xca,0x40,0x6f,0x62,0xea,0x03,0xf3,0x00,0x5f,0x70,0x04,0xf3,0x3f,
+0x30,0x02,0x40,0x00,0x01,0x03,0xf2,0x00,0x00,0x49,0xab,0x04,0x00,0x80,0x05,0x24,
+0x01,0x80,0x80,0x05,0x52,0x09,0xf1,0x11,0x11,0x10,0x80,0x05,0x42,0x30,0x00,0x00,
+0x23,0x80,0x05,0x01,0x68,0x00,0xc0,0x89,0x9a,0x91,0x02,0xf2,0x00,0x1a,0xba,0xcf,
+0x40,0x3f,0x30,0x37,0x06,0xf0,0x21,0x03,0xf3,0x00,0x00,0x08,0xf3,0x00,0x3f,0xdc,
+0x80,0x05,0xff,0x60,0x03,0xf9,0x74,0x05,0xf9,0x9f,0x40,0x3f,0x30,0x04,0xf9,0x00,
+0x9f,0x24,0xf2,0x00,0x36,0x00,0x00,0x51,0x2b,0x00,0x00,0x01,0x55,0x55,0x56,0x60,
+0x00,0x00,0x7e,0xee,0xee,0xef,0x30,0x05,0x03,0x22,0x14,0xf3,0x5b,0x00,0x42,0x10,
+0x00,0x09,0xe0,0xf5,0x05,0x00,0x87,0x05,0x00,0x27,0x00,0x27,0x55,0x40,0x38,0x01,
+0x21,0x05,0xe0,0x38,0x01,0x20,0x6f,0x00,0x97,0x09,0x00,0xa0,0x01,0xf1,0x0e,0x03,
+0xf4,0x00,0x6f,0xee,0x60,0x01,0xdf,0xa0,0x06,0xf7,0x62,0x00,0xcc,0x6f,0x60,0x6f,
+0x00,0x01,0xcd,0x10,0x8f,0x26,0xf0,0x00,0x5b,0x10,0x00,0x52,0x11,0x01,0xf0,0x02,
+0x12,0x02,0x80,0x00,0x00,0x05,0xef,0xff,0xb2,0x00,0x00,0x03,0xf9,0x21,0x3d,0xd0,
+0x00,0x2b,0x05,0x80,0x6f,0x10,0x00,0x05,0xf5,0x00,0x0b,0xf0,0x13,0x02,0x20,0xdf,
+0xe5,0x5f,0x02,0x33,0x55,0x30,0x00,0xa7,0x01,0xf0,0x01,0x02,0x55,0x64,0x05,0xe0,
+0xe7,0x0a,0xff,0xff,0x06,0xe0,0xe7,0x00,0x00,0xbc,0x07,0x06,0x00,0x10,0xf8,0x06,
+0x00,0x20,0x06,0xf2,0x06,0x00,0xf0,0x14,0x0c,0xf0,0x07,0xfe,0xf7,0x00,0x4f,0xf5,
+0x07,0xf5,0xf7,0x00,0xcc,0xbb,0x07,0xe0,0xe7,0x05,0xf3,0x3f,0x36,0xe0,0xe7,0x0e,
+0x90,0x0b,0xa6,0xe0,0xe7,0x19,0x00,0x01,0x66,0xe0,0xe7,0x93,0x01,0x16,0xf0,0x06,
+0x00,0x36,0x04,0xb0,0xd7,0x2a,0x08,0xc0,0x10,0x31,0x03,0x45,0x54,0x07,0xf0,0xe7,
+0x1f,0xff,0xff,0x07,0x1e,0x00,0xf3,0x13,0xea,0x07,0xf0,0xe8,0x00,0x07,0xf2,0x06,
+0xff,0xf8,0x00,0x3f,0xf4,0x06,0xf5,0xf8,0x01,0xdc,0xbe,0x16,0xf0,0xe7,0x0c,0xe1,
+0x0d,0xb6,0xf0,0xf7,0x4d,0x20,0x01,0x85,0xe0,0xe6,0x3d,0x02,0xb1,0x09,0xff,0xff,
+0xff,0xf1,0x00,0x02,0x55,0x54,0x47,0xf2,0xec,0x03,0x08,0x06,0x00,0x17,0xf1,0xf9,
+0x01,0xf0,0x00,0x20,0x66,0x77,0x82,0x00,0x6e,0x1c,0xdd,0xcf,0x70,0x07,0xe0,0x00,
+0x01,0xf4,0x6a,0x03,0x10,0x7f,0x5f,0x03,0xf1,0x15,0x0d,0xa0,0x12,0x8e,0x00,0x05,
+0xf8,0x0f,0xff,0xe0,0x00,0xdf,0xe0,0x12,0x8e,0x00,0x7f,0x5f,0x60,0x07,0xe0,0x2f,
+0x80,0x9e,0x00,0x7e,0x0c,0xc0,0x01,0xe6,0x07,0xe0,0x61,0x00,0x03,0x20,0x96,0x03,
+0x08,0xf0,0x05,0x15,0xd0,0xf0,0x05,0x00,0x7f,0x01,0xf2,0x1b,0x61,0x00,0xb8,0x0d,
+0xee,0xef,0x70,0x0d,0xa0,0x00,0x07,0xf1,0x00,0xca,0x00,0x01,0xf8,0x2d,0xdf,0xa0,
+0x00,0xcf,0xc0,0x67,0xea,0x00,0xbe,0x5f,0x90,0x0c,0xa0,0xce,0x20,0x5f,0x50,0xca,
+0x3b,0x10,0x00,0x44,0x0c,0x90,0x98,0x05,0x11,0x3f,0x1a,0x04,0x1f,0x44,0x98,0x05,
+0x05,0x12,0x31,0x58,0x00,0xb0,0x46,0x66,0x71,0x00,0xe7,0x0c,0xdd,0xdf,0x50,0x0e,
+0x80,0x67,0x08,0xf2,0x11,0xe8,0x00,0x01,0xe9,0x03,0x3e,0x80,0x00,0x9f,0x74,0xff,
+0xf8,0x00,0x4f,0xdf,0x20,0x1e,0x80,0x3f,0xa0,0xdc,0x00,0xe8,0x1f,0xb0,0x02,0xe5,
+0x0e,0x71,0x60,0x00,0x01,0x98,0x05,0x11,0x0f,0x98,0x05,0x15,0x83,0x98,0x05,0x14,
+0x12,0x98,0x05,0x41,0x13,0x33,0x32,0x20,0xb5,0x00,0xf0,0x2e,0x40,0x0b,0xee,0xff,
+0x60,0x07,0xf0,0x04,0x55,0x7f,0x60,0x07,0xf0,0x00,0x00,0xae,0x01,0x17,0xf0,0x00,
+0x04,0xf8,0x2f,0xff,0xf0,0x00,0x2e,0xfe,0x22,0x38,0xf0,0x02,0xdd,0x2c,0xe1,0x07,
+0xf0,0x1e,0xc1,0x01,0xca,0x07,0xe0,0x06,0x00,0x00,0x01,0x01,0x30,0x00,0x0a,0xee,
+0xee,0xee,0xb0,0x00,0x04,0x66,0x66,0x5b,0xe0,0x06,0x00,0xbf,0x6b,0xe0,0x00,0x0f,
+0xed,0xdd,0xdd,0x90,0x00,0x1f,0x70,0x98,0x05,0x02,0x80,0x24,0x55,0x61,0x00,0xd6,
+0x0c,0xee,0xef,0xb8,0x00,0x20,0x06,0xe0,0xb8,0x00,0xf2,0x09,0xe7,0x4d,0xdf,0x80,
+0x00,0xbf,0xb1,0x67,0xf8,0x00,0x9e,0x5f,0x80,0x0e,0x80,0xae,0x30,0x6f,0x40,0xe8,
+0x2c,0x20,0x00,0x53,0xef,0x00,0x12,0x30,0x2a,0x05,0x70,0x01,0xf8,0x33,0x33,0xf7,
+0x00,0x1f,0x40,0x05,0x18,0x01,0x40,0x05,0x00,0x11,0x0b,0x01,0x12,0x08,0xf0,0x1f,
+0x35,0x55,0x61,0x00,0xc9,0x0d,0xee,0xef,0x80,0x0c,0x90,0x00,0x07,0xf2,0x00,0xc9,
+0x00,0x03,0xf8,0x2d,0xef,0x90,0x01,0xdf,0xa0,0x66,0xd9,0x01,0xce,0x7f,0x70,0x0c,
+0x91,0xdd,0x20,0x6f,0x50,0xc9,0x3a,0x10,0x00,0x53,0x0a,0x70,0x00,0x60,0xdf,0x06,
+0xf1,0x08,0x2f,0x40,0x00,0x0e,0x70,0x02,0xf8,0x66,0x66,0xf7,0x00,0x2f,0xff,0xee,
+0xef,0x70,0x02,0xf4,0x00,0x00,0xe6,0x00,0x1f,0x55,0x06,0x33,0x34,0x44,0x44,0x41,
+0x03,0x10,0x35,0xb0,0x00,0x00,0x58,0x00,0xf0,0x14,0x0f,0x80,0x00,0x09,0xf2,0x00,
+0xe8,0x00,0x02,0xf9,0x16,0x6f,0x80,0x00,0xbf,0x64,0xdd,0xf8,0x00,0x7f,0xcf,0x20,
+0x0e,0x80,0x6f,0x70,0xdd,0x00,0xe8,0x4f,0x70,0x01,0xc4,0x0e,0x81,0x33,0x00,0xc0,
+0xb5,0x00,0x01,0xaf,0xff,0xc4,0x00,0x00,0xce,0x52,0x3a,0xf3,0x9c,0x06,0xc0,0x0f,
+0x70,0x00,0xfa,0x00,0x05,0xf6,0x00,0x05,0xff,0xde,0xfb,0xc1,0x03,0x22,0x52,0x00,
+0xd0,0x02,0xa0,0x05,0x77,0x85,0x05,0xf0,0xe7,0x0b,0xdd,0xfc,0x05,0xd0,0x02,0x70,
+0xe9,0x06,0xf0,0xf7,0x00,0x03,0xf4,0x06,0x00,0xf1,0x18,0x09,0xe2,0x59,0xf0,0xf7,
+0x00,0x0f,0xd5,0xde,0xf0,0xf7,0x00,0x7f,0xf3,0x05,0xf0,0xe7,0x01,0xe8,0xca,0x05,
+0xf0,0xe7,0x09,0xe0,0x5f,0x25,0xf0,0xe7,0x2f,0x50,0x0c,0x85,0xf0,0xe7,0x16,0x00,
+0x02,0x35,0x24,0x03,0x17,0x05,0x06,0x00,0x37,0x02,0x80,0xd7,0x5a,0x0a,0xf1,0x22,
+0x10,0x04,0x56,0x64,0x02,0xf1,0xe7,0x1e,0xee,0xff,0x03,0xf2,0xe8,0x00,0x00,0xea,
+0x03,0xf3,0xe8,0x00,0x07,0xf4,0xac,0xf3,0xe8,0x00,0x2f,0xf2,0x8a,0xf3,0xe8,0x00,
+0xdd,0xdc,0x03,0xf3,0xe7,0x0b,0xe2,0x2e,0x83,0xf3,0xe7,0x4e,0x30,0x03,0x82,0xf2,
+0xe7,0x9d,0x08,0x10,0xd7,0x1d,0x05,0x20,0x30,0x10,0x6b,0x0a,0x10,0x30,0xd4,0x02,
+0x20,0xfd,0xf4,0x54,0x04,0xf6,0x00,0x70,0xaf,0x60,0x00,0x0a,0xe5,0x00,0x07,0xf7,
+0x00,0x04,0x10,0x00,0x00,0x22,0x30,0x03,0x15,0x7e,0x30,0x03,0x00,0x4a,0x07,0x30,
+0x7f,0x0d,0xff,0x30,0x03,0x70,0x23,0x9e,0x00,0x05,0xf7,0x00,0x07,0x30,0x03,0xff,
+0x09,0x46,0xae,0x00,0x6f,0x6f,0x5b,0xee,0xe0,0x1e,0x90,0xad,0x00,0x6e,0x0b,0xd0,
+0x01,0xf5,0x06,0xe0,0x82,0x00,0x05,0x30,0x6e,0x30,0x03,0x04,0x72,0x02,0x33,0x33,
+0x30,0x00,0x00,0x05,0xab,0x0a,0x31,0x01,0x10,0x1e,0x17,0x00,0x20,0x0c,0xe2,0x06,
+0x00,0x20,0x1c,0xfa,0x06,0x00,0x20,0x3e,0xd9,0x46,0x0e,0xb0,0x9f,0xa0,0x03,0xde,
+0x30,0x00,0x4b,0x30,0x36,0x00,0x75,0xe8,0x07,0x02,0xf9,0x04,0x11,0x8e,0xab,0x01,
+0x40,0x6b,0xf6,0x66,0x65,0x90,0x02,0x00,0x74,0x02,0x21,0x3e,0xff,0x8e,0x0e,0x30,
+0x44,0x48,0xfe,0xcb,0x00,0x30,0x19,0xff,0x30,0x6f,0x00,0xf1,0x09,0xe9,0xfe,0x60,
+0x00,0x01,0xee,0x72,0x41,0x8e,0xb0,0x00,0x02,0x00,0x8e,0x00,0x01,0x00,0x14,0x44,
+0x4a,0xf4,0x44,0x43,0x06,0x47,0x0b,0x04,0x9d,0x0c,0xc1,0x07,0xee,0xee,0xee,0xe4,
+0x00,0x00,0x26,0x66,0x65,0x6f,0x60,0x9a,0x00,0x11,0xf6,0x17,0x00,0x12,0x1f,0x1b,
+0x0a,0x12,0xf5,0x71,0x09,0xe0,0x00,0x00,0x00,0x15,0x55,0x66,0x62,0x00,0x00,0x05,
+0xdd,0xdd,0xff,0x60,0x12,0x00,0x20,0xcf,0x60,0xbd,0x0b,0xf0,0x00,0xfe,0xe7,0x00,
+0x00,0x02,0xdf,0xa3,0x26,0xef,0x40,0x00,0x16,0x10,0x9d,0x00,0xaf,0x0a,0x00,0x08,
+0x0f,0x11,0x09,0x62,0x00,0xa7,0xd0,0x25,0x44,0x44,0x44,0x45,0x53,0x00,0x01,0x50,
+0x7b,0x06,0x22,0x07,0xf0,0xf5,0x0e,0x50,0x21,0x11,0x12,0x00,0x00,0x8a,0x00,0x71,
+0xf7,0x00,0x00,0x02,0x22,0x22,0x22,0x51,0x0f,0x00,0x0d,0x00,0x31,0x01,0x44,0x49,
+0xf8,0x0b,0xf0,0x01,0x1a,0xfd,0x10,0x00,0x00,0x01,0x8f,0xdb,0xfb,0x30,0x00,0x03,
+0xfc,0x63,0x52,0xaf,0xd7,0x03,0x10,0x9e,0x10,0x0c,0x50,0x44,0x4b,0xe4,0x44,0x43,
+0x58,0x0f,0x05,0xc4,0x00,0x00,0x5c,0x0d,0x10,0xe9,0x46,0x0c,0x71,0xa4,0x36,0xeb,
+0x00,0x00,0x09,0xf0,0x65,0x00,0x40,0x7f,0x40,0x00,0xbe,0xdb,0x01,0xb0,0xed,0xfe,
+0x40,0x00,0x00,0x00,0x35,0x54,0x00,0x00,0x00,0xf0,0x43,0x00,0x00,0x00,0x00,0x04,
+0x10,0x00,0x03,0x33,0x31,0x00,0xf6,0x00,0x0a,0xff,0xff,0xc0,0x0f,0x70,0x00,0x01,
+0x14,0xf7,0x00,0xf7,0x00,0x00,0x01,0xdd,0x00,0x0e,0x70,0x00,0x00,0xbf,0xb0,0x00,
+0xe7,0x00,0x00,0xaf,0x8f,0x70,0x0e,0xca,0x70,0xbf,0x40,0x7f,0x40,0xed,0xa7,0x2b,
+0x23,0x90,0x66,0x0e,0x80,0x00,0x00,0x7f,0x00,0x00,0xe8,0x00,0x00,0x07,0xf0,0x00,
+0x0e,0x80,0x05,0x99,0xcf,0xab,0xd5,0xe8,0x00,0x6a,0xaa,0x98,0x64,0x1a,0x00,0x10,
+0x00,0x1a,0x00,0x00,0x01,0x00,0x33,0x0d,0x70,0x00,0x01,0x00,0xfb,0x32,0x8d,0xdd,
+0xee,0xe4,0x00,0x00,0x36,0x65,0x6f,0xe1,0x00,0x00,0x00,0x01,0xdf,0x30,0x00,0x00,
+0x00,0x3e,0xfb,0x00,0x00,0x00,0x07,0xfb,0x8f,0xd3,0x00,0x02,0xee,0x60,0x02,0xbf,
+0x50,0x01,0x50,0x00,0x00,0x03,0x10,0x01,0x11,0x11,0x11,0x12,0x22,0xcf,0xff,0xff,
+0xff,0xff,0xfe,0x13,0x33,0x3b,0xd2,0x22,0x20,0x00,0x00,0x0a,0xc0,0x00,0x00,0x06,
+0x00,0x20,0xb0,0x00,0x48,0x00,0xf0,0x05,0x10,0x00,0x00,0x00,0x15,0x55,0x66,0x62,
+0x00,0x00,0x05,0xdd,0xdd,0xff,0x60,0x00,0x00,0x00,0x02,0xbf,0x73,0x00,0xf0,0x0b,
+0x29,0xff,0xe5,0x00,0x00,0x01,0xaf,0xd5,0x19,0xfd,0x30,0x00,0x28,0x30,0x00,0x01,
+0x73,0x00,0x12,0x22,0x22,0x22,0x22,0x32,0x0b,0xff,0x01,0x00,0xf0,0x0a,0xf0,0x01,
+0x11,0x13,0xf5,0x11,0x10,0x00,0x05,0x80,0x2f,0x50,0x00,0x00,0x00,0x9e,0x02,0xf4,
+0x00,0x00,0x00,0x09,0xe0,0x04,0x00,0x0d,0x00,0xf0,0x01,0x21,0x11,0x22,0x00,0x00,
+0x09,0xff,0xff,0xff,0xf7,0x00,0x00,0x02,0x22,0x22,0x22,0xa9,0x00,0x90,0xff,0xff,
+0xfa,0x00,0x00,0x00,0x44,0x48,0xfe,0xb7,0x00,0xf3,0x02,0x19,0xff,0x30,0x00,0x00,
+0x02,0x8f,0xd7,0xef,0x81,0x00,0x01,0xfc,0x60,0x00,0x6d,0xc0,0xe2,0x00,0xf0,0x02,
+0x6f,0xff,0xee,0xee,0xff,0xff,0x21,0x55,0x55,0x9f,0x55,0x55,0x40,0x00,0x00,0x06,
+0xf2,0x15,0x00,0xf0,0x14,0x3d,0xff,0xfc,0x30,0x00,0x00,0x1e,0xc2,0x03,0xce,0x00,
+0x00,0x04,0xf3,0x00,0x03,0xf3,0x00,0x00,0x4f,0x50,0x00,0x5f,0x30,0x00,0x00,0xce,
+0x76,0x8f,0xc0,0x00,0x00,0x01,0x8c,0xdb,0xb0,0x00,0x11,0x6e,0x6f,0x00,0xf0,0x0a,
+0x14,0x44,0xaf,0xd2,0x00,0x00,0x00,0x1a,0xfe,0x10,0x00,0x00,0x29,0xfe,0x9f,0xd5,
+0x00,0x04,0xfc,0x60,0x01,0x9f,0x90,0x00,0x20,0x4a,0x00,0xc3,0x36,0x66,0x76,0x66,
+0x66,0x65,0x8e,0xdd,0xdd,0xdd,0xdd,0xeb,0x72,0x00,0xb0,0xae,0xee,0xee,0xee,0x10,
+0x00,0x46,0x66,0x65,0x8f,0x30,0x0f,0x00,0x11,0x4f,0x06,0x00,0x12,0x5f,0x0c,0x00,
+0x01,0x34,0x00,0x10,0x03,0x05,0x00,0x53,0x11,0x10,0x00,0x00,0x8f,0xcf,0x00,0xf1,
+0x0d,0xaf,0xb1,0x00,0x00,0x00,0x6d,0xfd,0x10,0x00,0x00,0x8e,0xf9,0x7d,0xf9,0x10,
+0x03,0xb6,0x10,0x00,0x49,0x30,0x12,0x22,0x11,0x12,0x22,0x32,0xbf,0x72,0x01,0x10,
+0x01,0x27,0x01,0xf1,0x0c,0x10,0x00,0xbe,0xdd,0xde,0xed,0x00,0x00,0x47,0x76,0x66,
+0x9f,0x10,0x00,0x13,0x33,0x33,0x8f,0x10,0x00,0xef,0xff,0xff,0xfe,0x00,0x00,0xea,
+0x78,0x00,0xa6,0xdf,0xee,0xee,0xff,0x60,0x00,0x36,0x66,0x65,0x54,0xba,0x00,0x24,
+0x9f,0xe2,0xba,0x00,0xd0,0x18,0xfe,0xaf,0xd4,0x00,0x03,0xfd,0x70,0x02,0xaf,0x80,
+0x00,0x30,0xa4,0x01,0xc3,0x25,0x55,0x55,0x55,0x55,0x54,0x9f,0xee,0xee,0xee,0xee,
+0xfc,0xba,0x00,0xf1,0x01,0x03,0xbe,0xfd,0x80,0x00,0x00,0x2f,0xc5,0x47,0xfa,0x00,
+0x00,0x7f,0x10,0x00,0x7f,0x06,0x00,0xd1,0x8f,0x00,0x00,0x2e,0xd7,0x69,0xfa,0x00,
+0x00,0x02,0x9c,0xcb,0x60,0x27,0x00,0xf0,0x01,0x02,0x00,0x24,0x45,0x51,0x00,0xe7,
+0x0d,0xff,0xef,0x70,0x0e,0x80,0x00,0x03,0xf4,0x8a,0x02,0x10,0x7f,0x96,0x02,0x70,
+0x0d,0xa0,0x00,0xe7,0x00,0x04,0xf7,0x0b,0x00,0xf0,0x0b,0xcf,0xd0,0x00,0xe7,0x00,
+0x6f,0x6f,0x60,0x0e,0x70,0x2f,0x80,0x9e,0x10,0xe7,0x0c,0xc0,0x01,0xe8,0x0e,0x70,
+0x91,0x00,0x02,0x40,0xe7,0x42,0x00,0x11,0x0e,0x81,0x02,0x07,0x0b,0x00,0x12,0x31,
+0x81,0x00,0x71,0x34,0x55,0x61,0x00,0xd6,0x1e,0xee,0x58,0x00,0xf2,0x11,0x07,0xf2,
+0x00,0xe8,0x00,0x01,0xe9,0x00,0x0e,0x80,0x00,0xcf,0x30,0x00,0xe8,0x00,0xaf,0xdd,
+0x00,0x0e,0x80,0xaf,0x42,0xea,0x00,0xe8,0x7e,0x30,0x03,0xe3,0x0e,0x80,0x37,0x00,
+0xa0,0x4e,0xff,0xff,0xff,0x40,0x01,0x55,0x44,0x45,0xf7,0x10,0x00,0x11,0x0f,0xa1,
+0x00,0x11,0xf6,0x0b,0x00,0x00,0x44,0x02,0x02,0xa4,0x01,0x12,0x00,0xb0,0x00,0x81,
+0x0e,0xff,0xef,0x80,0x0e,0x80,0x00,0x06,0x58,0x00,0x10,0xea,0x58,0x00,0x10,0xaf,
+0x58,0x00,0xf0,0x14,0x6f,0xfa,0x00,0x0e,0x80,0x4f,0x95,0xf6,0x00,0xe8,0x4f,0x90,
+0x08,0xf1,0x0e,0x74,0x70,0x00,0x05,0x10,0xe7,0x00,0x08,0x20,0x00,0x0f,0x70,0x01,
+0xf6,0x00,0x00,0x83,0x00,0x1f,0x60,0xd4,0x02,0xe3,0xf7,0x11,0x12,0x21,0x00,0x0f,
+0xff,0xff,0xff,0xb0,0x00,0x13,0x33,0x32,0x58,0x00,0x94,0x35,0x55,0x51,0x00,0xd6,
+0x1d,0xee,0xef,0x80,0xb0,0x00,0x20,0x02,0xf9,0x58,0x00,0xf2,0x04,0xdf,0x40,0x00,
+0xe8,0x00,0xbe,0xce,0x10,0x0e,0x80,0xbf,0x30,0xdc,0x00,0xe8,0x8e,0x20,0x02,0xc3,
+0xe7,0x00,0xf0,0x03,0x30,0x00,0x2f,0xff,0xff,0xff,0x60,0x03,0xf6,0x33,0x33,0xf7,
+0x00,0x3f,0x30,0x00,0x0e,0x70,0x7b,0x02,0x12,0xe7,0x16,0x00,0x54,0x00,0x24,0x44,
+0x43,0x30,0x58,0x00,0xf0,0x20,0x61,0x00,0xc7,0x1e,0xee,0xef,0x60,0x0e,0x80,0x00,
+0x08,0xf1,0x00,0xe8,0x00,0x03,0xf8,0x00,0x0e,0x80,0x01,0xdf,0x50,0x00,0xe8,0x00,
+0xce,0xbf,0x30,0x0e,0x81,0xde,0x20,0xbe,0x20,0xe8,0x7c,0x10,0x00,0x93,0x0c,0x70,
+0x00,0x50,0x00,0x00,0x40,0x5a,0x02,0xf0,0x05,0x0f,0x50,0x04,0xf7,0x66,0x66,0xf5,
+0x00,0x5f,0xff,0xee,0xef,0x50,0x04,0xf1,0x00,0x00,0xf5,0x00,0x4f,0x1e,0x01,0x51,
+0x00,0x44,0x44,0x44,0x30,0x98,0x03,0xf2,0x38,0x00,0x01,0x45,0x32,0x55,0x10,0xe6,
+0x00,0x6f,0xfe,0x9f,0xf6,0x0f,0x70,0x00,0x0b,0xc0,0x1f,0x40,0xf7,0x00,0x00,0xe8,
+0x04,0xf2,0x0e,0x80,0x00,0x2f,0x40,0x8e,0x00,0xe8,0x00,0x06,0xf6,0x0c,0xf0,0x0e,
+0xfe,0xb0,0xbf,0xc1,0xff,0x40,0xea,0x53,0x1f,0x9f,0x8e,0xba,0x0e,0x80,0x06,0xe0,
+0xcf,0x95,0xf1,0xe8,0x00,0xc8,0x05,0xf2,0x0d,0x6e,0x80,0x04,0x00,0x03,0x00,0x21,
+0x45,0x04,0x09,0x52,0x04,0x32,0x0c,0x60,0x00,0x1b,0x02,0xf0,0x33,0x06,0x73,0x46,
+0x50,0xd6,0x6d,0x2d,0xfb,0xbe,0xf0,0xf7,0x7e,0x00,0xba,0x07,0xd0,0xf6,0x7e,0x00,
+0xd8,0x0a,0xb0,0xf6,0x7e,0x00,0xf5,0x0d,0x80,0xf7,0x7e,0x03,0xf7,0x0f,0x80,0xff,
+0xfe,0x07,0xfc,0x4f,0xd0,0xf8,0x8e,0x0b,0xcf,0xae,0xf2,0xe6,0x7e,0x1f,0x4d,0xf7,
+0xd7,0xe6,0x7e,0x6e,0x08,0xf1,0x7c,0xe6,0x7e,0x34,0x02,0x60,0x04,0xe6,0x7e,0x47,
+0x00,0x02,0x06,0x00,0x11,0xe7,0x06,0x00,0x31,0xa4,0x6d,0x00,0xbd,0x00,0x00,0x05,
+0x00,0xf1,0x24,0x10,0x22,0x04,0x53,0x35,0x30,0xf4,0xba,0x2e,0xfb,0xcf,0xe0,0xf5,
+0xba,0x00,0xc9,0x09,0xb0,0xf5,0xaa,0x00,0xf6,0x0e,0x80,0xff,0xfa,0x05,0xfa,0x3f,
+0xc0,0xf8,0xba,0x0c,0xdf,0xbc,0xf3,0xf5,0xaa,0x4f,0x2d,0xf3,0xa9,0xf5,0xaa,0x57,
+0x04,0x80,0x13,0xf4,0xaa,0x00,0x6c,0x03,0x01,0x3a,0x04,0x71,0xf6,0x00,0x02,0x55,
+0x54,0x44,0xf7,0x12,0x00,0x08,0x06,0x00,0x11,0xf6,0x06,0x00,0x13,0x41,0x04,0x03,
+0xb0,0x3f,0xff,0xab,0xff,0xc0,0x00,0x00,0x26,0xf5,0x15,0xf6,0x54,0x03,0x20,0x00,
+0xcd,0x7e,0x04,0xf0,0x0a,0xeb,0xae,0xf8,0x00,0x00,0x7e,0x32,0xef,0x34,0xf6,0x00,
+0x02,0x20,0x0a,0xc0,0x01,0x10,0x02,0x44,0x44,0xcd,0x44,0x44,0x30,0x9f,0x9e,0x03,
+0x14,0xfd,0x4d,0x05,0xb2,0xce,0xee,0xee,0xee,0x00,0x00,0x04,0x66,0x66,0x5a,0xf1,
+0x7b,0x04,0x10,0x10,0x06,0x00,0x13,0x06,0x0d,0x00,0x02,0x24,0x00,0x13,0x30,0x2c,
+0x00,0xf1,0x21,0x05,0x54,0x25,0x51,0x05,0xf0,0x3d,0xef,0x7d,0xf8,0x06,0xf0,0x00,
+0x9c,0x01,0xf4,0x06,0xf0,0x00,0xea,0x07,0xf0,0x06,0xf0,0x04,0xff,0x0d,0xf3,0x06,
+0xf0,0x0c,0xbf,0xbf,0xda,0x06,0xf0,0x4f,0x38,0xf9,0x5f,0x16,0xf0,0x68,0x01,0xb1,
+0x08,0x15,0xf0,0x35,0x00,0xc1,0x40,0x00,0x0c,0xff,0xff,0xff,0xc0,0x00,0x03,0x44,
+0x44,0x4a,0x12,0x00,0x26,0x08,0xe0,0x06,0x00,0x21,0x07,0xe0,0x27,0x01,0x40,0x30,
+0x01,0x85,0x41,0x62,0x04,0x51,0x1b,0xee,0x70,0x04,0xf1,0xfc,0x00,0xe0,0x4f,0x20,
+0x02,0xff,0xff,0xf8,0x04,0xf2,0x00,0x02,0x33,0x6f,0x50,0x4f,0xb8,0x05,0xf0,0x05,
+0xe0,0x04,0xf2,0x00,0x00,0x02,0xf8,0x00,0x4f,0x75,0x30,0x00,0xbf,0x60,0x04,0xff,
+0xfa,0x00,0x6f,0xce,0x42,0x02,0xf6,0x04,0x2f,0x91,0xe8,0x04,0xf2,0x00,0x1e,0xb0,
+0x05,0xf2,0x4f,0x20,0x03,0xa0,0x00,0x07,0x34,0xf2,0x00,0xb6,0x04,0x22,0x04,0xf2,
+0x20,0x01,0x13,0x20,0xc8,0x00,0x23,0x01,0x75,0x68,0x00,0xf0,0x00,0x80,0x05,0xf1,
+0x00,0x04,0x55,0x56,0x10,0x5f,0x10,0x01,0xff,0xff,0xf7,0x05,0x75,0x00,0xf1,0x0f,
+0x8f,0x10,0x5f,0x65,0x20,0x00,0x4f,0x70,0x05,0xff,0xf7,0x00,0x3f,0xfd,0x00,0x5f,
+0x10,0x00,0x5f,0xa2,0xec,0x05,0xf1,0x00,0x3f,0x80,0x02,0xc3,0x4f,0x10,0x96,0x03,
+0x10,0x20,0x9b,0x05,0xd0,0xff,0xfe,0x10,0x00,0x08,0xf4,0x44,0x48,0xf1,0x00,0x00,
+0x8e,0x00,0x27,0x00,0x51,0x08,0xe0,0x00,0x05,0xf1,0x19,0x05,0x81,0xff,0x00,0x00,
+0x01,0x44,0x44,0x43,0x10,0x68,0x00,0x81,0x02,0x00,0x00,0x2c,0xee,0x70,0x06,0xf0,
+0x68,0x00,0x70,0x6f,0x00,0x02,0xee,0xee,0xf5,0x06,0x01,0x01,0xf0,0x0e,0xbd,0x00,
+0x6f,0xaa,0x40,0x00,0x8f,0x50,0x06,0xfa,0x93,0x00,0x7f,0xed,0x10,0x6f,0x00,0x00,
+0x8f,0x71,0xdc,0x06,0xf0,0x00,0x5e,0x50,0x01,0xa2,0x5e,0xb4,0x00,0x20,0x00,0x04,
+0x82,0x01,0x11,0xf0,0x0a,0x01,0x30,0x9e,0x00,0x8f,0x18,0x04,0xf0,0x0c,0xf5,0x0e,
+0xf6,0x00,0x00,0x08,0xea,0xfa,0xf9,0xf5,0x00,0x04,0xf4,0x0a,0xf6,0x08,0xf1,0x00,
+0x24,0x00,0x15,0x00,0x03,0x00,0x02,0x85,0x51,0x68,0x00,0xf1,0x01,0x2a,0xdd,0x60,
+0x03,0xf2,0x00,0x06,0x77,0x77,0x20,0x4f,0x20,0x01,0xab,0xbc,0xf6,0xf7,0x00,0xf0,
+0x13,0xdd,0x00,0x3f,0xff,0x90,0x00,0xbf,0x60,0x03,0xf7,0x52,0x01,0xbf,0xcf,0x30,
+0x3f,0x20,0x02,0xdd,0x20,0xaf,0x23,0xf2,0x00,0x48,0x00,0x00,0x50,0x2f,0x10,0x00,
+0x00,0x01,0x11,0xcf,0x05,0x11,0x4f,0xb6,0x00,0x50,0x00,0x22,0x22,0xaf,0x70,0x4d,
+0x05,0x20,0xcf,0x60,0xf3,0x06,0xf0,0x23,0xfc,0xfd,0x40,0x00,0x00,0x7f,0xc4,0x02,
+0xaf,0xb0,0x00,0x03,0x30,0x00,0x00,0x15,0x00,0x00,0x65,0x30,0x00,0x00,0x20,0x01,
+0xce,0xf3,0x04,0xe0,0xe7,0x00,0x11,0x10,0x07,0xe0,0xe7,0x0c,0xff,0xfe,0x07,0xe0,
+0xe7,0x02,0x33,0xcd,0x07,0xe0,0xe7,0x00,0x00,0xf8,0x06,0x00,0xf1,0x14,0x06,0xf2,
+0x07,0xfe,0xf7,0x00,0x0e,0xf3,0x07,0xf5,0xf7,0x00,0x8f,0xea,0x07,0xe0,0xe7,0x03,
+0xf7,0x5f,0x26,0xe0,0xe7,0x0d,0xb0,0x0c,0xa6,0xe0,0xe7,0x1a,0x10,0x02,0x66,0xe0,
+0xe7,0xd9,0x00,0x06,0x06,0x00,0x41,0x04,0xc0,0xd7,0x00,0x23,0x03,0x02,0x30,0x01,
+0x50,0x2b,0xee,0x70,0x00,0xe7,0x2e,0x01,0x50,0x0e,0x72,0xde,0xde,0xf6,0x6b,0x05,
+0xf0,0x05,0xbe,0x15,0x5f,0x70,0x00,0x7f,0x62,0xef,0xf7,0x00,0x6f,0xee,0x10,0x0e,
+0x70,0x8f,0x71,0xdd,0x10,0xe7,0x28,0x01,0x70,0x0f,0x70,0x00,0x00,0x06,0x20,0xe7,
+0xe3,0x04,0x60,0x07,0x20,0x00,0x00,0x8f,0x60,0xf2,0x01,0xfc,0x04,0xef,0x50,0x00,
+0x00,0x5f,0xb0,0xaf,0x80,0x00,0x6f,0xa0,0x00,0x6f,0xa0,0x03,0x40,0x00,0x00,0x25,
+0x58,0x00,0x40,0x80,0xde,0xde,0xf7,0xfe,0x03,0xf2,0x09,0x9e,0x15,0x5f,0x80,0x00,
+0x5f,0x72,0xef,0xf8,0x00,0x5f,0xee,0x20,0x0e,0x80,0x6f,0x90,0xce,0x10,0xe8,0x3f,
+0x60,0x00,0x93,0x20,0x04,0xf0,0x0c,0xb5,0x00,0x00,0x9f,0xff,0xc5,0x00,0x00,0xaf,
+0x62,0x3a,0xf3,0x00,0x0f,0x90,0x00,0x0f,0x70,0x00,0xdc,0x00,0x05,0xf6,0x00,0x04,
+0xff,0xde,0x68,0x08,0x22,0x45,0x52,0x10,0x01,0x15,0x21,0x10,0x01,0x20,0x06,0xf0,
+0x10,0x01,0xc0,0x06,0xf0,0xf7,0x02,0x33,0xcd,0x06,0xf0,0xf7,0x00,0x00,0xf8,0x06,
+0x00,0xf1,0x12,0x06,0xf3,0xcd,0xf0,0xe7,0x00,0x0e,0xf4,0x6a,0xf0,0xe7,0x00,0x8f,
+0xda,0x05,0xf0,0xe7,0x03,0xf6,0x5f,0x25,0xf0,0xe7,0x0e,0xa0,0x0c,0xa5,0xf0,0xe7,
+0x19,0x00,0x02,0x65,0x04,0x01,0x17,0x05,0x06,0x00,0x23,0x04,0xd0,0x10,0x01,0x40,
+0x00,0x02,0x53,0x21,0x09,0x00,0x32,0x7f,0xff,0xf1,0x11,0x00,0x00,0x56,0x08,0x91,
+0xef,0xff,0xff,0x10,0x00,0x00,0x25,0x44,0x6f,0xb1,0x08,0x20,0x2d,0xd1,0x06,0x00,
+0x20,0x4e,0xfa,0x40,0x03,0xf0,0x02,0x9f,0xa8,0xfd,0x30,0x00,0x06,0xfc,0x40,0x12,
+0xbf,0x50,0x00,0x23,0x00,0x8d,0x00,0x21,0x2f,0x00,0xa2,0xd0,0x00,0x00,0x02,0x44,
+0x44,0xbe,0x55,0x55,0x40,0x90,0x07,0x04,0xf2,0x03,0x20,0x34,0x22,0x7f,0x03,0xf1,
+0x31,0xff,0xf1,0x00,0x6d,0x00,0x22,0x43,0x10,0x08,0xe0,0x7f,0xff,0xfe,0x00,0x7e,
+0x00,0x11,0x3f,0x90,0x07,0xe0,0x00,0x0d,0xf1,0x00,0x7e,0x00,0x0b,0xff,0x70,0x07,
+0xe0,0x0b,0xf3,0x7f,0x40,0x7e,0x0c,0xe3,0x10,0x8e,0x07,0xe0,0x41,0x0f,0x40,0x10,
+0x7e,0x00,0x01,0xf5,0x00,0x07,0xe0,0x33,0x4f,0x86,0x85,0x7e,0x1f,0xff,0xfe,0xdb,
+0x47,0xb9,0x03,0x16,0x7e,0xc4,0x03,0x14,0x14,0x5f,0x00,0x31,0x5f,0xed,0xc0,0xbe,
+0x06,0x10,0x53,0x5a,0x05,0x30,0x55,0x56,0x66,0x21,0x08,0x40,0xdd,0xdf,0xf3,0x00,
+0x93,0x00,0x01,0xb6,0x04,0xf3,0x02,0x5e,0xfc,0x10,0x00,0x00,0x06,0xdf,0x85,0xde,
+0x70,0x00,0x08,0xd7,0x10,0x00,0x6c,0x60,0x39,0x00,0xd1,0xbf,0xee,0xee,0xee,0xff,
+0xfe,0x03,0x55,0x55,0xbe,0x55,0x44,0x30,0xc0,0x00,0x00,0x01,0x00,0x21,0x9d,0x00,
+0xa4,0x09,0x02,0x0d,0x00,0x25,0x9c,0x00,0xab,0x09,0x04,0xfe,0x07,0x21,0xfe,0xc9,
+0x7c,0x06,0x20,0x64,0x00,0xb4,0x01,0x70,0xff,0xf3,0x00,0x00,0x24,0x44,0xcf,0x20,
+0x01,0x20,0x4d,0xfc,0x9f,0x08,0xf1,0x01,0xfb,0x9f,0xd5,0x00,0x06,0xd8,0x20,0x01,
+0x9e,0x30,0x14,0x33,0x33,0x33,0x33,0x42,0xfc,0x04,0x50,0xfc,0x00,0x00,0x1a,0xc1,
+0xf4,0x08,0x22,0xef,0xfe,0x9a,0x08,0x26,0xaf,0x10,0xfa,0x04,0x02,0x06,0x00,0x22,
+0x5f,0x10,0x34,0x08,0x04,0x01,0x00,0x31,0x1f,0xdc,0xa0,0x39,0x09,0x10,0x76,0xf0,
+0x00,0x40,0xee,0xee,0xee,0x50,0x2c,0x0a,0x21,0xaf,0xd1,0x25,0x0a,0x00,0x86,0x0a,
+0xb3,0x4b,0xfd,0x9f,0xd6,0x00,0x00,0x4f,0xa4,0x00,0x18,0xe5,0x32,0x00,0x11,0x0a,
+0x1f,0x0a,0xf0,0x02,0xe0,0x25,0x55,0x56,0xf8,0x55,0x43,0x00,0x04,0x40,0x2f,0x40,
+0x00,0x00,0x00,0xbc,0x02,0x08,0x01,0x21,0x0b,0xc0,0x59,0x00,0x11,0xbc,0x1f,0x0a,
+0x19,0x0a,0x1f,0x0a,0x03,0x91,0x06,0x20,0xfe,0xcb,0x07,0x00,0x61,0x25,0x65,0x00,
+0x00,0x00,0x8e,0x1f,0x00,0xf0,0x04,0x13,0x33,0x9f,0xb1,0x00,0x00,0x04,0x9f,0xfe,
+0x50,0x00,0x05,0xef,0xb4,0x29,0xee,0x50,0x02,0x41,0xe1,0x0a,0x10,0xaf,0x28,0x0a,
+0xf0,0x01,0xfd,0x25,0x55,0x5a,0xf5,0x55,0x53,0x00,0x34,0x4a,0xf4,0x44,0x00,0x00,
+0xdf,0xff,0x26,0x02,0x71,0x01,0x11,0x01,0x6f,0x10,0x00,0xdf,0xdc,0x03,0x4a,0xeb,
+0x22,0x21,0x10,0x69,0x09,0x0f,0x3b,0x01,0x14,0x10,0xc4,0x3b,0x01,0x41,0x02,0x9e,
+0x20,0x24,0x3b,0x01,0x18,0xbf,0x3b,0x01,0x30,0x03,0x9e,0xfa,0x6d,0x03,0x30,0xc8,
+0x7b,0xf7,0xd0,0x04,0x00,0xa5,0x01,0xa0,0xae,0x10,0x00,0xcc,0x00,0x00,0x2e,0xfd,
+0xdf,0xe3,0x22,0x03,0x00,0x65,0x00,0xf0,0x09,0x26,0x43,0x00,0x00,0x20,0x04,0xce,
+0xe4,0x00,0x7e,0x00,0x34,0x44,0x40,0x07,0xe0,0x5f,0xfe,0xff,0x20,0x7e,0x00,0x00,
+0x4f,0x68,0x02,0xf0,0x0b,0x7f,0xf8,0x00,0x6e,0x02,0xcf,0x65,0xf9,0x06,0xf0,0x9a,
+0x20,0x03,0xa0,0x6f,0x03,0x33,0x45,0x68,0x66,0xf2,0xff,0xff,0xfd,0xb6,0x6f,0xd8,
+0x0a,0x20,0x06,0xf0,0x68,0x08,0x07,0x0b,0x00,0x75,0x7e,0x00,0x01,0xb1,0x00,0x06,
+0xe0,0x53,0x07,0x00,0x08,0x00,0x07,0x24,0x01,0x41,0x7f,0xff,0xff,0xf5,0xf3,0x0a,
+0x00,0x91,0x01,0x10,0x3c,0x93,0x0a,0xb2,0x5c,0xfc,0x9f,0xd6,0x00,0x04,0xe9,0x30,
+0x01,0x8e,0x40,0x2f,0x00,0x02,0xf5,0x06,0xf6,0x03,0x25,0x44,0x44,0x44,0x44,0x53,
+0x00,0x35,0x55,0x55,0x55,0x00,0x00,0xbf,0xff,0xfe,0xff,0x20,0xed,0x0a,0x17,0x4f,
+0xed,0x0a,0x12,0x18,0xdd,0x09,0xf0,0x0d,0x20,0x0e,0xff,0xb0,0x00,0x6e,0x00,0x02,
+0x31,0x00,0x07,0xe0,0xab,0xbc,0xc5,0x00,0x7e,0x07,0x88,0x9f,0x60,0x07,0xe0,0x00,
+0x07,0xf1,0x00,0x7e,0xc1,0x0a,0x00,0xc9,0x00,0xf1,0x0c,0x60,0x00,0x7f,0x00,0x2f,
+0xed,0x00,0x07,0xf0,0x0d,0xc2,0xf7,0x00,0x7f,0x0a,0xe2,0x07,0xf1,0x07,0xf4,0xf3,
+0x00,0x0b,0x60,0x7f,0x01,0x00,0xd1,0x0c,0x00,0x9f,0x00,0x01,0x3c,0x07,0x12,0xd0,
+0x89,0x00,0x10,0x64,0x59,0x00,0xf0,0x1d,0x1c,0xff,0x90,0x00,0xba,0x03,0x44,0x45,
+0x10,0x0c,0xb0,0xef,0xff,0xf8,0x00,0xcb,0x00,0x00,0x8f,0x20,0x0b,0xb0,0x00,0x4f,
+0x90,0x00,0xbb,0x00,0x4f,0xef,0x30,0x0b,0xb0,0x5f,0xa0,0xaf,0x30,0xbb,0x2f,0x70,
+0x00,0x96,0x0b,0xb0,0x8a,0x02,0xc0,0x97,0x00,0x00,0x9e,0xff,0xd6,0x00,0x00,0xaf,
+0x63,0x38,0xf6,0x91,0x04,0x70,0x0d,0xa0,0x00,0xdc,0x00,0x03,0xf9,0x91,0x04,0x00,
+0xee,0x00,0x33,0x45,0x53,0x00,0xa3,0x0b,0xa1,0x22,0x33,0x42,0x02,0xf3,0x00,0x1f,
+0xff,0xff,0xf0,0x70,0x02,0x11,0xad,0x8f,0x0c,0xf0,0x1f,0x0f,0x80,0x2f,0x40,0x03,
+0xde,0xee,0xf3,0x02,0xf4,0x00,0x04,0x45,0xfc,0x00,0x2f,0xfe,0xb0,0x00,0x8f,0x40,
+0x02,0xf8,0x53,0x00,0x3f,0xa0,0x00,0x2f,0x40,0x00,0x1d,0xd0,0x00,0x02,0xf4,0x00,
+0x0c,0xe2,0x00,0x00,0x2f,0x40,0x03,0xc1,0x00,0x0d,0x00,0x00,0x01,0x00,0x01,0x41,
+0x00,0x04,0x0d,0x00,0x24,0x1f,0x40,0x87,0x04,0x00,0x06,0x00,0xf0,0x02,0x41,0x01,
+0x22,0x33,0x06,0xe0,0xe7,0x0f,0xff,0xff,0x57,0xe0,0xf7,0x00,0x11,0x3f,0x47,0xd9,
+0x05,0xf0,0x0a,0x6f,0x17,0xe0,0xe7,0x26,0x77,0xcd,0x07,0xe1,0xe7,0x5c,0xdd,0xf6,
+0x07,0xff,0xf7,0x00,0x09,0xf1,0x07,0xe2,0xe7,0x00,0x2f,0x70,0x1b,0x06,0x70,0xcd,
+0x00,0x07,0xe0,0xe7,0x09,0xf3,0x06,0x00,0x30,0x3f,0x40,0x00,0x1b,0x06,0x10,0x00,
+0x06,0x00,0x01,0x23,0x01,0x01,0xff,0x04,0x35,0xc0,0xe7,0x00,0xfb,0x0a,0xb0,0x04,
+0x10,0x13,0x33,0x43,0x00,0xe7,0x0c,0xff,0xff,0xf2,0x82,0x0a,0x10,0x9f,0x09,0x06,
+0xfa,0x17,0x0d,0xb0,0x0e,0x71,0xbc,0xcc,0xf6,0x12,0xe7,0x06,0x77,0xee,0x8f,0xff,
+0x70,0x00,0x4f,0x70,0x22,0xe7,0x00,0x0d,0xc0,0x00,0x0e,0x70,0x0a,0xf2,0x00,0x00,
+0xe7,0x08,0xf4,0x00,0x00,0x0e,0x71,0xd4,0xa0,0x0b,0x11,0xe7,0x37,0x0e,0x04,0x5f,
+0x04,0x02,0x03,0x0c,0x11,0x52,0x53,0x0b,0x10,0xc0,0x21,0x00,0xf0,0x0c,0xcb,0x00,
+0xe7,0x19,0x99,0x9f,0x60,0x0e,0x71,0x9a,0xae,0xe8,0xff,0xf7,0x00,0x06,0xf5,0x13,
+0x3e,0x70,0x09,0xf5,0x00,0x00,0xe7,0x1d,0xe4,0x4d,0x00,0x11,0x80,0x42,0x00,0x20,
+0x09,0x30,0x4d,0x00,0x10,0xf7,0x6b,0x09,0x11,0x0f,0x55,0x00,0x32,0xf8,0x11,0x11,
+0x53,0x0b,0x33,0xd0,0x00,0x12,0x53,0x0b,0xf0,0x0e,0x01,0x10,0x35,0x56,0x64,0x00,
+0xba,0x0b,0xed,0xdf,0xe0,0x0c,0xa0,0x12,0x22,0xdb,0x00,0xca,0x0f,0xff,0xff,0x7d,
+0xef,0xa0,0x00,0x5f,0x80,0x66,0xda,0x8d,0x06,0x20,0x0c,0xa0,0x4a,0x0e,0x90,0xca,
+0x08,0x10,0x00,0x00,0x04,0x30,0x02,0xef,0xd6,0x09,0xc0,0x05,0x66,0x65,0x5f,0x80,
+0x00,0x34,0x44,0x44,0xf8,0x00,0x3f,0xf0,0x0a,0x21,0x03,0xf5,0x74,0x01,0x40,0xfe,
+0xff,0xff,0xc0,0x9f,0x02,0x11,0x42,0x08,0x01,0xf0,0x1e,0x20,0x24,0x55,0x53,0x00,
 0xe8,0x0b,0xff,0xef,0xf0,0x0e,0x80,0x01,0x11,0xcc,0x00,0xd8,0x0e,0xff,0xff,0x8e,
 0xef,0x80,0x01,0x3e,0xb0,0x56,0xe8,0x00,0x2d,0xc1,0x00,0x0e,0x80,0x7f,0xb1,0x00,
-0x00,0xe8,0x0c,0x50,0xad,0x82,0x1f,0x00,0x64,0x81,0x16,0x01,0x93,0x83,0x01,0x08,
-0x01,0x30,0xd0,0x0e,0x70,0xae,0x1b,0xc0,0xe7,0x0a,0xbb,0xbf,0x63,0x4e,0x70,0x67,
-0x7e,0xe5,0xff,0xf7,0xf6,0x83,0x40,0x0e,0x70,0x1b,0xf4,0xd5,0x77,0x10,0xd3,0x4a,
-0x01,0x40,0x50,0x00,0x1b,0x10,0x28,0x81,0x20,0xf2,0x08,0xb6,0x16,0x10,0x30,0x4c,
-0x03,0x20,0xdf,0x40,0x73,0x07,0x11,0xbf,0xff,0x4d,0x30,0x8f,0x70,0x05,0xa2,0x49,
-0x02,0x89,0x12,0x50,0x01,0x22,0x22,0x03,0xf0,0x18,0x02,0x70,0x24,0xf1,0xe7,0x01,
-0x22,0x7f,0x13,0x9a,0x45,0xd0,0x8d,0x03,0xf1,0xe7,0x27,0x88,0xe9,0x15,0xf1,0xe7,
-0x3b,0xcd,0xf7,0x4d,0x37,0xa0,0x0b,0xd0,0x26,0xf1,0xe7,0x00,0x4f,0x40,0x03,0xf1,
-0x84,0x83,0x31,0x03,0xf1,0xe7,0x8c,0x7f,0x00,0x84,0x83,0x20,0x04,0xf1,0x84,0x83,
-0x02,0xd0,0x45,0x02,0x06,0x00,0x29,0x02,0xc0,0x61,0x38,0xe0,0x01,0x22,0x21,0x00,
-0x6e,0x0c,0xff,0xff,0xf1,0x07,0xf0,0x01,0x11,0x7f,0x59,0x03,0xc0,0x0a,0xb8,0xde,
-0xf0,0x68,0x88,0xf6,0x36,0xbf,0x09,0xbb,0xee,0x6f,0x03,0x10,0x2f,0x6a,0x30,0xc0,
-0x0b,0xd0,0x8f,0xff,0xf0,0x08,0xf3,0x01,0x44,0x9f,0x06,0xf5,0x68,0x02,0x2f,0xd5,
-0x00,0x20,0x77,0x07,0x01,0x18,0x02,0x81,0x68,0x88,0x85,0x00,0xe7,0x0a,0xcb,0xbe,
-0x18,0x02,0xf0,0x0b,0xe9,0xdf,0xf7,0x1d,0xee,0xef,0x32,0x4e,0x70,0x45,0x6f,0xa0,
-0x11,0xe7,0x00,0x1d,0xd1,0x8f,0xff,0x70,0x5e,0xc1,0x00,0x33,0xe7,0x2f,0x01,0x57,
-0x01,0x65,0x52,0x16,0x50,0x68,0x01,0x0e,0x49,0x14,0x04,0x68,0x01,0x22,0x01,0x10,
-0xde,0x05,0x11,0xe0,0xf6,0x4e,0x15,0x9f,0xa0,0x11,0x12,0xaf,0x28,0x0a,0x41,0x34,
-0x43,0x3a,0xe0,0x40,0x3f,0x11,0x9c,0x50,0x34,0x21,0x0a,0xb0,0x5a,0x7a,0x14,0x54,
-0xc4,0x43,0x20,0x7d,0xee,0xdc,0x20,0x13,0x22,0xc2,0x70,0x08,0x94,0x4e,0x11,0x02,
-0xb6,0x43,0x01,0x0c,0x00,0x00,0x59,0x59,0x11,0xad,0x2a,0x3f,0x83,0x8b,0x00,0x02,
-0x22,0x7f,0x32,0x33,0x21,0xff,0x22,0x10,0x10,0x10,0x5d,0x81,0x00,0xad,0xdd,0xde,
-0xee,0x10,0x00,0x36,0x5c,0x43,0x02,0xec,0x41,0x02,0x41,0x34,0x1e,0xdb,0x2c,0x69,
-0x01,0xdb,0x0f,0x12,0x0d,0x8d,0x42,0x44,0x24,0x44,0x33,0xcc,0xf3,0x5c,0x00,0x8d,
-0x02,0x23,0xcb,0x00,0x12,0x38,0x0d,0x95,0x7c,0x1a,0xc4,0x89,0x64,0x04,0xf5,0x30,
-0x11,0x7e,0x9e,0x0f,0x11,0x26,0xf0,0x7d,0x01,0x06,0x7b,0x00,0x1a,0x5b,0x13,0xfd,
-0xc2,0x07,0x00,0x82,0x45,0x29,0x78,0x43,0xcc,0x50,0x0f,0xa8,0x00,0x17,0x02,0x5a,
-0x00,0x21,0x02,0x65,0xbf,0x5d,0x02,0x5b,0x00,0x00,0x63,0x01,0x02,0xcc,0x01,0x13,
-0x8c,0x10,0x7e,0x09,0xa7,0x59,0x13,0x40,0xb8,0x04,0x03,0xf3,0x7a,0x11,0xdc,0x36,
-0x35,0x21,0x0d,0xa0,0xb2,0x0b,0x11,0xda,0xe9,0x07,0x15,0x0c,0x00,0x7b,0x03,0xd1,
-0x0f,0x10,0x14,0x7f,0x04,0xb0,0x7f,0xbf,0xff,0xff,0x20,0x7f,0x00,0x00,0x4f,0x00,
-0x7f,0xb6,0x00,0xb0,0x7f,0x8c,0xcc,0xf7,0x00,0x7f,0x57,0x7c,0xf1,0x00,0x7f,0x12,
-0x40,0x10,0x7f,0xf0,0x06,0x20,0x7f,0x06,0x43,0x2b,0x64,0x5f,0x70,0x00,0x00,0x7e,
-0xb7,0x62,0x02,0x15,0x6e,0x61,0x02,0x07,0xec,0x5f,0x08,0x20,0x04,0x22,0x13,0x33,
-0x20,0x04,0x20,0x40,0x0c,0x20,0x04,0x2f,0x00,0xca,0x20,0x04,0x28,0x10,0x02,0xf9,
-0x7a,0x31,0x53,0x02,0xf3,0xb6,0x71,0x40,0x2f,0x30,0x00,0xf6,0x59,0x6e,0x01,0x4f,
-0x10,0x06,0x0d,0x00,0x00,0x89,0x9f,0xa1,0xff,0xd0,0xf9,0x44,0x31,0x02,0xf7,0x42,
-0x0f,0x60,0xd6,0x05,0x50,0xf6,0x00,0x02,0x11,0xf4,0xa0,0x83,0x88,0xfa,0x1f,0x40,
-0x00,0x25,0x54,0x32,0x01,0xe3,0x05,0x03,0x0d,0x00,0x12,0x0e,0xf3,0x0d,0x10,0x17,
-0x9b,0x23,0xa0,0xf8,0x05,0xf1,0x00,0x2f,0x86,0x55,0x10,0x5f,0x10,0x0d,0x06,0x11,
-0x05,0xc1,0x65,0xe1,0x80,0x5f,0xff,0x82,0xf7,0x33,0x30,0x05,0xf6,0x51,0x2f,0x51,
-0x13,0x51,0x40,0x4e,0x00,0x48,0x71,0x24,0x01,0x22,0x70,0x4d,0x20,0x67,0x60,0xaf,
-0x44,0x30,0xed,0xef,0x10,0x18,0x3b,0x23,0x38,0xf1,0xb2,0x45,0x00,0xb0,0x71,0x13,
-0x10,0x5e,0x89,0x16,0x50,0x5b,0x1a,0x00,0xf1,0x0c,0x30,0xde,0xdd,0xe7,0x5b,0x00,
-0x36,0x97,0x66,0x20,0x68,0x00,0x30,0x97,0x77,0x30,0xfe,0x64,0x22,0xcc,0xc5,0xfe,
-0x64,0x15,0x10,0xfe,0x64,0x4f,0x03,0x55,0x43,0x20,0x66,0x65,0x20,0x00,0xd8,0x50,
-0xa0,0x55,0x0d,0x60,0xe7,0xef,0xff,0xd2,0xf7,0x0f,0x7e,0xb7,0x03,0x20,0xe7,0xe7,
-0xdc,0x59,0xf2,0x02,0x7e,0x93,0x32,0x0e,0x70,0xe7,0xef,0xff,0xf1,0xef,0xff,0x7e,
-0x81,0x10,0x0e,0x94,0xf7,0x16,0x00,0xd2,0x70,0x01,0x0e,0x70,0xe7,0xee,0xde,0xf9,
-0xe7,0x0e,0x73,0x66,0x42,0x14,0x88,0x03,0x05,0x5b,0x00,0x0b,0x00,0x36,0xc5,0x0e,
-0x70,0x0d,0x76,0x30,0x03,0x44,0x44,0x20,0x57,0x60,0xfe,0xc0,0xe7,0x0f,0x6e,0x70,
-0xe9,0x56,0xf3,0x0a,0xef,0xee,0xd0,0xef,0xef,0x6f,0xa5,0x53,0x0d,0xa5,0xf6,0xf7,
-0x00,0x00,0xd7,0x0f,0x6e,0xed,0xef,0x6d,0x80,0xf6,0x36,0x65,0x30,0xff,0x56,0x12,
-0x10,0xf6,0x64,0x42,0x03,0x55,0x54,0x47,0xa0,0x6f,0x24,0x40,0x00,0x82,0x56,0x02,
-0x2c,0x33,0x12,0x70,0x76,0x69,0x84,0x88,0x87,0x0e,0x50,0xf5,0xed,0xbb,0x90,0x58,
-0x00,0xc1,0xed,0xbb,0xa0,0xed,0xbf,0x6f,0xc9,0x86,0x0d,0xc8,0xf6,0xf7,0x4e,0x65,
-0xd0,0xda,0xbd,0x5d,0x80,0xf6,0x69,0x98,0x61,0xb5,0x0e,0x40,0x00,0x20,0xe3,0x0e,
-0x10,0x6e,0xff,0x01,0x51,0x06,0xf5,0x55,0x56,0xf3,0xe4,0x29,0x10,0x30,0x6f,0x24,
-0x02,0x0b,0x00,0x14,0x20,0x20,0x57,0x00,0xe5,0x64,0x60,0x53,0x00,0xe6,0xdf,0xff,
-0xfb,0x80,0x52,0x13,0x00,0x05,0x00,0xc4,0xe9,0x22,0x21,0x67,0xf7,0xef,0xff,0xf5,
-0xdd,0xf7,0xe9,0x11,0x14,0x00,0x10,0xf8,0x05,0x00,0x8f,0xee,0xdd,0xef,0x90,0xe7,
-0x36,0x66,0x53,0x80,0x52,0x07,0x10,0x02,0xa4,0x92,0x20,0x07,0xe0,0xe3,0x47,0x30,
-0x8f,0x0e,0x80,0x37,0x22,0xa3,0xea,0x44,0x51,0x5b,0xde,0x0f,0xff,0xfe,0x54,0x8c,
-0x5a,0x78,0x9f,0x93,0x34,0x62,0x08,0xe0,0xcf,0xff,0xfd,0x50,0x50,0x4d,0x19,0xf0,
-0x19,0x13,0x0a,0xed,0xde,0xa0,0x07,0xf0,0xeb,0x76,0x63,0x00,0x7f,0x0e,0x80,0x00,
-0x01,0x5a,0xf0,0xff,0xff,0xf6,0x8f,0xff,0x0f,0xa5,0x54,0x00,0x07,0xf0,0xf8,0x11,
-0x24,0x10,0x7e,0x0d,0xff,0xff,0xf6,0x07,0xe0,0x0c,0x8f,0x12,0x26,0xc9,0x62,0x00,
-0xd7,0x09,0x13,0xfe,0x55,0x2c,0x01,0x0c,0x56,0x4c,0x0f,0x81,0x11,0x10,0x50,0x4d,
-0x60,0x21,0xbe,0xdd,0xea,0x00,0xd9,0x57,0x00,0x00,0x29,0x5d,0xa0,0x24,0xd9,0xff,
-0xff,0xf6,0xaf,0xf9,0xfa,0x55,0x40,0x3f,0x53,0x10,0x02,0x50,0x4d,0x80,0xff,0x70,
-0xd9,0x24,0x44,0x31,0x00,0xc8,0xd6,0x51,0x1f,0x40,0x50,0x4d,0x0e,0x11,0x01,0x10,
-0x57,0x00,0xb0,0x72,0x20,0x90,0x7f,0x58,0x02,0x30,0x06,0xf0,0xf7,0x11,0x09,0xc1,
-0x0f,0x7e,0xa5,0x50,0x38,0xf0,0xf7,0xef,0xed,0x4f,0xff,0x0e,0x16,0x00,0x20,0xe7,
-0xe7,0x2f,0x66,0xc0,0x7e,0x70,0x02,0x06,0xf0,0xe7,0xef,0xff,0xf4,0x6f,0x0e,0x72,
-0xea,0x68,0x1c,0xe7,0xb0,0x72,0x17,0x70,0x58,0x01,0xb0,0x44,0x43,0x06,0xe0,0xf5,
-0xef,0xfe,0xa0,0x7f,0x0f,0x6e,0x42,0x00,0xc0,0xf6,0xef,0xee,0x7f,0xff,0x0f,0x6f,
-0xa5,0x51,0x38,0xf0,0xf6,0xfa,0x87,0x00,0x58,0x02,0x20,0x65,0xf0,0x58,0x02,0x14,
-0x4d,0x58,0x02,0x04,0x26,0x65,0x0f,0x58,0x02,0x08,0x20,0x01,0x03,0x58,0x00,0x10,
-0xf0,0x58,0x00,0xf0,0x05,0x6f,0x0f,0x5e,0x80,0x00,0x06,0xf0,0xf5,0xea,0x55,0x05,
-0xaf,0x0f,0x5f,0xff,0xe4,0xde,0xf0,0xf5,0xf7,0xbb,0x00,0x90,0x5f,0x92,0x35,0x16,
-0xf0,0xf5,0xcf,0xff,0xe5,0xb5,0x57,0x93,0x00,0x06,0xf1,0xf5,0x00,0x54,0x00,0x6e,
-0x1f,0x26,0x65,0x02,0x00,0x4d,0x05,0x26,0x65,0x14,0x30,0x26,0x65,0x00,0x73,0x3b,
-0x80,0xeb,0x05,0xb0,0xf5,0xea,0x55,0x20,0x7e,0xb0,0x00,0x60,0x28,0xf0,0xf6,0xef,
-0xff,0x5f,0xb0,0x00,0x21,0x40,0x17,0xb0,0x00,0x10,0x6f,0xb0,0x00,0x11,0x66,0xb0,
-0x00,0x32,0x27,0x0b,0x30,0x82,0x1e,0x10,0x8f,0xef,0x13,0x00,0x80,0x1e,0x12,0xf4,
-0xbb,0x00,0x24,0x0a,0xe0,0x80,0x8d,0x23,0xa0,0x01,0xbe,0x46,0x23,0x01,0x04,0x08,
-0x01,0x35,0xff,0xb0,0x6f,0x08,0x01,0x1f,0x6e,0x08,0x01,0x03,0x14,0x3d,0x08,0x01,
-0x10,0x6e,0x43,0x06,0x20,0x08,0xf5,0xa7,0x4c,0x10,0x8f,0xfd,0x00,0x20,0x08,0xf0,
-0xac,0x1d,0x02,0xe2,0x1e,0x01,0x6f,0x8d,0x12,0x15,0xe6,0x5f,0x44,0xff,0xff,0xfe,
-0xa0,0xff,0x60,0x42,0x0c,0xc4,0x44,0x45,0xb9,0x5c,0x14,0xe9,0x29,0x95,0x00,0x7b,
-0x2c,0x1f,0x45,0xce,0x64,0x10,0x42,0x5f,0xee,0xee,0xe8,0x74,0x62,0x11,0x20,0x3e,
-0x4a,0x01,0x5b,0x60,0x31,0xfe,0xee,0x80,0x00,0x79,0x15,0x11,0xd3,0x61,0x40,0x02,
-0x28,0xf2,0x10,0xd3,0x13,0x35,0x9f,0x44,0x45,0xdc,0x6d,0x1e,0x10,0x87,0x82,0x20,
-0xbd,0x11,0xc1,0x19,0x19,0x09,0x68,0x83,0x02,0x3b,0x79,0x12,0x07,0xfd,0x4c,0x03,
-0x92,0x25,0x03,0x0d,0x00,0x32,0x55,0x44,0x41,0x28,0x62,0x11,0x40,0x42,0x2c,0x27,
-0xed,0x00,0x30,0x65,0x24,0xdd,0xdc,0xb0,0x60,0x20,0x02,0x9c,0x21,0x18,0x50,0x02,
-0xfd,0x76,0x8f,0xb0,0xee,0x12,0x03,0x73,0x35,0x16,0x0a,0x3e,0x6e,0x32,0x03,0x55,
-0x40,0x0c,0x9d,0x15,0xf9,0xca,0x00,0x11,0x8e,0x66,0x20,0x12,0x08,0x61,0x2a,0x11,
-0x8e,0x72,0x23,0x02,0x68,0x00,0x00,0x39,0x12,0x14,0xed,0x89,0x0f,0x10,0x26,0xb6,
-0x63,0x8f,0x66,0x08,0xee,0xee,0xef,0xdd,0xdd,0xb0,0x88,0x6c,0x03,0x17,0x7f,0x30,
-0x54,0x02,0x7a,0x01,0x11,0xbf,0x72,0x3c,0x02,0x79,0x01,0x11,0xcc,0x8c,0x61,0x17,
-0xcf,0x8a,0x62,0x02,0x77,0x01,0x02,0x62,0x64,0x0f,0x8a,0x62,0x05,0x0f,0x12,0x01,
-0x0e,0x11,0xf3,0x06,0x1c,0x17,0x5f,0xfd,0x10,0x09,0x1b,0x08,0x00,0x6d,0x08,0x12,
-0x43,0x1b,0x08,0x00,0x10,0x81,0x03,0x2e,0x03,0x05,0x01,0x0d,0x14,0x30,0x42,0x66,
-0x06,0xdc,0x01,0x1f,0x10,0xdc,0x01,0x02,0x03,0x4f,0x4d,0x01,0x8c,0x7b,0x0b,0xb8,
-0x6f,0x2e,0x10,0x00,0x5e,0x7b,0x01,0xdc,0x01,0x11,0x08,0x41,0x04,0x0a,0xdc,0x01,
-0x11,0x9f,0x7a,0x01,0x41,0xad,0x22,0x33,0x30,0x30,0x07,0x10,0xfa,0x0c,0x00,0x04,
-0x1a,0x39,0x03,0x5f,0x00,0x10,0xae,0x45,0x3e,0x64,0xea,0x35,0x56,0x66,0x65,0x55,
-0xc8,0x0e,0x13,0xcf,0xf2,0x0f,0x12,0x11,0xf2,0x0f,0x11,0xfe,0xec,0x62,0x16,0x11,
-0xcc,0x4b,0x03,0x8e,0x80,0xe0,0x02,0x01,0x54,0x45,0x50,0x06,0xf0,0x7f,0xff,0xfe,
-0x20,0x6f,0x07,0xe0,0x82,0x13,0x11,0x8e,0x11,0x73,0x01,0x0b,0x00,0x10,0x8f,0x13,
-0xa7,0x4a,0x08,0xf4,0x44,0x30,0x16,0x00,0x8d,0xbb,0xcd,0xf2,0x6f,0x01,0x88,0x88,
-0x64,0xbc,0x32,0x16,0x5e,0x92,0x01,0x10,0x52,0x4c,0x05,0x10,0xe8,0x4c,0x05,0x20,
-0xd8,0xe8,0xf1,0x85,0xf5,0x0a,0xff,0xee,0xea,0x00,0xd8,0xfa,0x65,0x52,0x00,0xd8,
-0xf7,0x00,0x01,0x00,0xd8,0xef,0xee,0xff,0x90,0xe8,0x25,0x55,0x42,0x00,0xd6,0x89,
-0x5a,0x10,0xf5,0x29,0x26,0x0b,0x2c,0x7b,0x01,0x05,0x00,0x13,0x51,0x0c,0x08,0xb0,
-0x27,0x77,0x77,0x72,0x3f,0x30,0x00,0x5d,0xdd,0xdd,0xc4,0x92,0x01,0x20,0x50,0x07,
-0xb7,0x08,0x44,0x05,0xf0,0x4f,0x10,0x07,0x00,0x21,0x63,0x20,0x07,0x00,0x21,0xff,
-0xe0,0x07,0x00,0x50,0x41,0x00,0x05,0xf0,0x5f,0x23,0x00,0x12,0x04,0x07,0x00,0xbb,
-0x7f,0xfe,0xff,0xfc,0x2f,0x40,0x00,0x15,0x55,0x44,0x31,0xe4,0x60,0x1e,0x40,0xe4,
-0x60,0x00,0x45,0x15,0xf0,0x03,0x88,0x88,0x99,0x24,0xf1,0x00,0x3b,0xbb,0xba,0x92,
-0x4f,0x20,0x00,0x1a,0x10,0xb2,0x04,0xf2,0x0d,0x8a,0xb0,0x40,0x4f,0xba,0x50,0x3f,
-0x22,0xf3,0x04,0xfb,0xa5,0x02,0x0d,0x00,0x10,0x20,0xbb,0x00,0x81,0xb4,0xf2,0x00,
-0x14,0x44,0x43,0x20,0x2c,0x52,0x35,0x00,0x2c,0x7a,0x11,0x8d,0xbc,0x56,0x55,0x08,
-0xe5,0x55,0x58,0xf1,0xa2,0x90,0x38,0xd0,0x00,0x04,0x0f,0x16,0x04,0xae,0x20,0xf9,
-0x07,0x20,0x03,0x33,0x34,0x26,0xc0,0xe6,0x4f,0xff,0xff,0xd8,0xd0,0xf6,0x01,0x60,
-0x24,0x08,0xd0,0xf6,0x04,0xf1,0x9c,0x06,0x00,0x10,0xff,0x06,0x00,0x21,0x07,0xe3,
-0x06,0x00,0x01,0x12,0x00,0xd1,0x17,0xd0,0xf6,0x5f,0xff,0xff,0xfa,0xe0,0xf6,0x03,
-0x33,0x33,0x17,0x2f,0x5d,0x13,0x07,0x06,0x00,0x11,0xf7,0xbe,0x25,0x26,0xe6,0x00,
-0x47,0x47,0xf1,0x18,0x21,0xef,0xff,0xff,0x90,0xab,0x04,0x55,0x55,0x41,0x0b,0xb0,
-0x0c,0x50,0xc6,0x12,0xbb,0x00,0xe6,0x0e,0x7b,0xff,0xb0,0x0e,0x60,0xe7,0x01,0xbb,
-0x02,0xe8,0x3f,0x98,0x1b,0xb2,0xff,0xff,0xff,0xd3,0xaa,0xf4,0x00,0x10,0x30,0x9c,
-0xa7,0x10,0xf8,0x08,0x27,0xd3,0x5d,0xa0,0x00,0x56,0x66,0x66,0xda,0x00,0x1f,0xed,
-0xdd,0xdd,0x60,0x89,0x55,0x01,0xd1,0x04,0x44,0x35,0x55,0x44,0x42,0xcb,0x60,0xd0,
-0x56,0x30,0xa9,0x1e,0xee,0xee,0xd7,0x0b,0xb0,0x0a,0x40,0xa5,0x00,0x58,0x00,0x20,
-0x79,0xdf,0x58,0x00,0xf2,0x02,0x36,0xdb,0x00,0xe6,0x0e,0x60,0x0b,0xb1,0xdf,0xed,
-0xff,0xe3,0xbb,0x06,0x66,0x65,0x43,0x01,0x6a,0x13,0x21,0x07,0x59,0x61,0xf9,0x33,
-0x33,0xca,0x00,0x0f,0x8c,0x37,0x10,0xf7,0x17,0x4f,0x11,0x0f,0x16,0x00,0x05,0x62,
-0x6c,0xf2,0x07,0x31,0x04,0x55,0x55,0x24,0xf0,0xe7,0x4f,0xff,0xff,0xa4,0xf0,0xe7,
-0x01,0x50,0x42,0x05,0xf0,0xf7,0x04,0xf0,0xc8,0x06,0x00,0x11,0x16,0x06,0x00,0x13,
-0xef,0x12,0x00,0xf2,0x08,0xe7,0x04,0xf0,0xc8,0x04,0xf0,0xe7,0x05,0xf2,0xd8,0x24,
-0xf0,0xe7,0x5f,0xff,0xff,0xf5,0xf0,0xe7,0x02,0x22,0x21,0x04,0x33,0x15,0x07,0x06,
-0x00,0x37,0x02,0x90,0xd7,0xb6,0x20,0xf7,0x22,0x21,0x05,0x55,0x56,0x33,0xf1,0xc9,
-0x3e,0xee,0xed,0x84,0xf2,0xca,0x02,0xd1,0x79,0x03,0xf2,0xca,0x04,0xf2,0xab,0x8e,
-0xf2,0xca,0x04,0xf1,0xab,0x38,0xf2,0xca,0x03,0xf1,0xaa,0x03,0xf2,0xca,0x3d,0xfd,
-0xff,0xe4,0xf2,0xca,0x15,0x55,0x54,0x22,0xf1,0xb8,0x62,0x5c,0x10,0xf6,0xbd,0x65,
-0x2d,0x44,0xf8,0x77,0x19,0x17,0xf7,0x77,0x19,0x00,0xd9,0x45,0xf4,0x18,0x20,0xe7,
-0x2e,0xee,0xed,0xd5,0x0e,0x80,0x06,0x10,0x81,0xbd,0xf8,0x00,0xf5,0x1f,0x44,0x6e,
-0x80,0x0f,0x51,0xf3,0x23,0xe8,0x00,0xf5,0x1f,0x3d,0xff,0x80,0x5f,0x86,0xf8,0x60,
-0xe8,0x2e,0xee,0xed,0xca,0x79,0x23,0x20,0x07,0x20,0x82,0x1a,0x01,0xa1,0x1b,0x04,
-0xef,0x3f,0x03,0xa1,0x1b,0x07,0x37,0x23,0xb0,0x10,0x89,0x99,0x99,0x50,0xbb,0x1a,
-0xbb,0xba,0xa5,0x1c,0x70,0x01,0x70,0xbf,0xfb,0x00,0xe6,0x0e,0x70,0x2b,0x70,0x01,
-0x70,0x7b,0xeb,0x00,0xe6,0x0e,0x64,0x6d,0x70,0x01,0x12,0xf4,0x70,0x01,0x13,0xb0,
-0xbe,0x9b,0x35,0x9e,0xff,0xd7,0x1e,0x12,0x00,0x55,0x09,0x39,0xdc,0x10,0x02,0x1e,
-0x12,0x11,0x44,0x3d,0x38,0x00,0x09,0x90,0x10,0xe5,0xe2,0x3e,0x21,0x05,0x60,0x5a,
-0x15,0x11,0xac,0x5a,0x15,0x24,0x0a,0xc0,0x0d,0x00,0x60,0x03,0xef,0xfe,0xef,0xff,
-0xb0,0x05,0x3e,0x01,0x0b,0x0d,0x25,0x07,0xa0,0x82,0x15,0x10,0x25,0x44,0x54,0x10,
-0x55,0xf4,0x79,0x00,0x1d,0x28,0x00,0xff,0x1e,0x01,0xaf,0xa6,0x10,0xfe,0xf3,0x31,
-0x20,0x13,0x20,0xad,0x15,0xd0,0x0b,0x80,0x00,0x00,0x4b,0xe4,0x4d,0xb8,0x10,0x02,
-0xef,0xff,0xfe,0x81,0x6a,0x00,0x43,0x04,0x03,0x30,0x34,0x2f,0x22,0x21,0xbd,0x42,
-0x1b,0x0f,0xae,0x00,0x21,0x40,0x04,0xc0,0x07,0x80,0x67,0x06,0x00,0x3f,0x06,0x5b,
-0x35,0x5a,0xf6,0x6d,0xd6,0x6a,0x5f,0x12,0x0d,0x4c,0x07,0x12,0x35,0xef,0x0e,0x31,
-0x5d,0x00,0x6d,0xde,0x2c,0x01,0xbc,0x16,0x10,0x8f,0x9d,0x06,0x21,0x02,0xef,0x0b,
-0x2f,0x00,0x4e,0x00,0x16,0x41,0xe3,0x68,0x40,0xee,0xef,0xff,0xf2,0x28,0x44,0x2e,
-0x44,0x43,0x1b,0x1b,0x07,0x8d,0x3b,0x01,0x4b,0x04,0x00,0xb6,0x00,0x11,0x00,0xae,
-0x0d,0x71,0xe3,0x00,0x00,0x07,0x70,0x08,0x60,0x02,0x83,0x11,0xca,0x32,0x90,0x24,
-0x0c,0xa0,0x0d,0x00,0x93,0x06,0xff,0xfe,0xef,0xff,0x80,0x00,0x14,0x54,0x07,0x03,
-0x0f,0xde,0x51,0x05,0x01,0x64,0x01,0x22,0x01,0xff,0xf2,0x0f,0x21,0x31,0x13,0x8e,
-0x2e,0x00,0x25,0x0a,0x75,0x3c,0xc4,0x4e,0xa8,0x10,0x02,0xff,0x18,0x07,0x24,0x10,
-0xbf,0xde,0x51,0x00,0x94,0x35,0x02,0x8c,0x76,0x11,0x36,0x41,0x64,0x0f,0x8c,0x76,
-0x06,0x01,0x5e,0x6d,0x01,0x6a,0x02,0xf0,0x05,0x56,0x66,0x67,0x40,0x9b,0x1d,0xee,
-0xed,0xd8,0x0a,0xc0,0x04,0x10,0x44,0x00,0xac,0x00,0xd8,0x0b,0xb0,0xd1,0x29,0x74,
-0xba,0x00,0x9c,0x00,0xe8,0x0b,0xa0,0x0b,0x00,0x30,0xd8,0x0b,0xa0,0x74,0x8f,0xe6,
-0xc9,0x00,0x9c,0x1d,0xfe,0xdf,0xff,0x49,0xc0,0x56,0x66,0x55,0x40,0x9c,0x36,0x78,
-0x26,0x9c,0x00,0x2d,0x02,0x06,0x1a,0x03,0xd0,0xba,0x1d,0xee,0xed,0xd7,0x0b,0xb0,
-0x06,0x20,0x63,0x00,0xbb,0x00,0x4d,0x30,0x60,0xb0,0x0e,0x60,0xe8,0x00,0xba,0xcd,
-0x02,0xc1,0x0b,0xa0,0x4e,0x95,0xea,0x71,0xba,0x2e,0xee,0xed,0xdb,0x2b,0x37,0x00,
-0x40,0xba,0x00,0x06,0x40,0xc5,0x56,0x10,0xe9,0x9b,0x7a,0x02,0xb0,0x8e,0x10,0xe9,
-0x1a,0x03,0x19,0x0d,0x1a,0x03,0x07,0xe2,0x04,0x10,0x0a,0xe2,0x04,0x20,0x00,0xab,
-0x90,0x0d,0x20,0x0a,0xb0,0x90,0x0d,0x4f,0xab,0x02,0xe8,0x3e,0xe2,0x04,0x2b,0x18,
-0xba,0xe2,0x04,0x02,0xb0,0x00,0x21,0x70,0xe7,0x0b,0x00,0x2f,0x71,0x0b,0x72,0x03,
-0x20,0x20,0x64,0x22,0x1a,0x69,0x35,0x2d,0xff,0xf0,0x4f,0x15,0x00,0x67,0x08,0x20,
-0xb1,0xf4,0xfb,0x02,0x70,0x42,0x1f,0x40,0x00,0x04,0xcc,0x70,0x29,0x3e,0xf0,0x0d,
-0xfb,0x9f,0x70,0x1f,0x85,0x30,0xad,0x00,0x8d,0x01,0xff,0xfc,0x0d,0x90,0x05,0xf0,
-0x1f,0x50,0x00,0xc9,0x00,0x6f,0x01,0xf5,0x00,0x08,0xe1,0x0c,0xdd,0x42,0x30,0x1d,
-0xff,0xe3,0x04,0x4b,0x23,0x05,0x51,0x1f,0x5b,0x13,0x01,0xb6,0x42,0x05,0x90,0x15,
-0x21,0x64,0x31,0xd4,0x24,0x40,0xef,0xa0,0x05,0xf0,0x1d,0x09,0xd1,0x61,0x6f,0x00,
-0x07,0xbb,0xbb,0xcc,0x36,0xf0,0x00,0x00,0x6a,0x93,0xb6,0x60,0x50,0x8b,0xf2,0x05,
-0xff,0xf7,0xba,0x5f,0x40,0x5f,0x66,0x20,0xe8,0x6a,0x71,0x40,0x00,0x07,0xfb,0xde,
-0x1c,0x73,0x30,0x04,0x76,0x10,0xb3,0x87,0x11,0x23,0x43,0x37,0x15,0x0e,0xb4,0x24,
-0x09,0xb6,0x09,0x05,0x3e,0x3c,0x50,0x00,0x53,0x20,0x00,0x03,0xd0,0x00,0x91,0xb0,
-0x06,0xf0,0x00,0x14,0x33,0x43,0x30,0x6f,0x40,0x31,0x60,0x46,0xf1,0x00,0x00,0x48,
-0x71,0x1a,0x03,0x60,0x7f,0x9c,0xe1,0x06,0xf4,0x41,0x7a,0x2d,0xc0,0x6f,0xff,0x80,
-0xe7,0x00,0xe6,0x06,0xf2,0x00,0x0a,0xd4,0x7f,0x80,0x40,0x36,0x1a,0xed,0x60,0xb4,
-0x3e,0x00,0xd3,0x42,0x1c,0xe0,0x1b,0x0a,0x23,0xff,0xff,0xbf,0x79,0x05,0x69,0x2a,
-0x30,0x2f,0xdb,0x70,0x8d,0x40,0x41,0x46,0x74,0x00,0x6f,0xa2,0x0b,0x60,0x46,0xf0,
-0x00,0x13,0x34,0x33,0x4e,0x00,0x20,0x2c,0xff,0x46,0x52,0xa0,0x0d,0xd5,0x7f,0x50,
-0x6f,0xff,0x70,0xf6,0x00,0xd8,0x2b,0x99,0x31,0xb3,0x5f,0x40,0x68,0x00,0x32,0x70,
-0x05,0xf0,0x7a,0x6d,0x02,0xa7,0x63,0x02,0x93,0x09,0x12,0x7f,0xfc,0x03,0x14,0xf0,
-0x03,0x6c,0x30,0x0d,0xfe,0xee,0x96,0x3f,0x02,0xe4,0x54,0x30,0x01,0xca,0x95,0x60,
-0x40,0x50,0x06,0x88,0x60,0x06,0xf0,0x8a,0x90,0x21,0xc3,0x6f,0xc1,0x09,0x30,0x16,
-0xf0,0x00,0x2b,0x2f,0x61,0x5f,0x44,0x10,0xbd,0x58,0xf4,0x95,0x82,0xe0,0x0e,0x80,
-0x5f,0x11,0x00,0xd9,0x01,0xf6,0x05,0xf0,0x00,0x04,0xfe,0xfc,0x51,0x2c,0x30,0x01,
-0x33,0x00,0x19,0x8f,0x10,0x26,0xe2,0x93,0x00,0x30,0x41,0x1c,0xde,0x98,0x41,0x17,
-0xaf,0x01,0x08,0x00,0xa7,0x01,0x15,0x01,0xa7,0x01,0x13,0x77,0xa7,0x01,0x14,0xbb,
-0xa7,0x01,0x40,0x21,0x00,0x9e,0x8b,0x81,0x2a,0x10,0x0f,0xc9,0x46,0x10,0x43,0xf4,
-0x61,0x18,0x06,0xa7,0x01,0x20,0x01,0x80,0x02,0x53,0x00,0x5a,0x69,0x45,0x0a,0xd4,
-0x44,0x58,0x5b,0x00,0x0a,0x98,0x41,0x10,0x45,0xc1,0x54,0x0f,0xd0,0x00,0x19,0x31,
-0x10,0x00,0xe9,0xd0,0x00,0x31,0x05,0xfd,0xed,0xd0,0x00,0x40,0x44,0x00,0x03,0xd0,
-0x31,0x23,0x10,0xdc,0x25,0x0c,0x42,0xfc,0x76,0x8e,0xb0,0x55,0x5e,0x10,0x10,0xfd,
-0x3f,0x00,0x25,0x0c,0x41,0x0c,0xfe,0xdf,0xf7,0x25,0x0c,0x04,0x20,0x05,0xf1,0x32,
-0x31,0x05,0xfe,0xd6,0x07,0xc0,0xe6,0x00,0x35,0x52,0x08,0xd0,0xe7,0x7d,0xdd,0xdd,
-0xb8,0xd0,0xe7,0x26,0x66,0x66,0x57,0xd0,0xe7,0x00,0x9e,0xc3,0x07,0xd0,0xe7,0x07,
-0xf6,0xbe,0x07,0xe5,0xf7,0x0c,0xa0,0x2f,0x47,0xfd,0xf7,0x0d,0x80,0x0f,0x57,0xd0,
-0xe7,0x0c,0x90,0x1f,0x47,0xd0,0xe7,0x08,0xe4,0x9f,0x17,0xd0,0xe7,0x00,0xbf,0xe5,
-0x07,0xe2,0x4c,0x08,0x06,0x00,0x24,0x05,0x90,0x54,0x10,0x02,0xf1,0x5f,0xf0,0x26,
-0xaf,0xfa,0x03,0xc0,0xc6,0x05,0x66,0x65,0x45,0xf0,0xd7,0x3d,0xdd,0xdd,0xc5,0xf0,
-0xd8,0x00,0x39,0x83,0x05,0xf4,0xd8,0x04,0xfa,0xbf,0x25,0xff,0xf8,0x09,0xc0,0x0d,
-0x75,0xf0,0xd7,0x08,0xd0,0x0e,0x65,0xf0,0xd7,0x02,0xee,0xed,0x04,0xf0,0xd7,0x00,
-0x04,0x30,0x01,0x40,0x84,0x57,0x25,0x10,0xfb,0x16,0x25,0x60,0x63,0x4c,0xf2,0x00,
-0x02,0xf5,0x73,0x27,0x11,0x02,0x03,0x00,0x53,0x00,0xbf,0x86,0x8e,0xe1,0x73,0x99,
-0x02,0xa0,0x1f,0xf0,0x04,0x1b,0xde,0x90,0x05,0xf0,0x00,0x59,0x98,0x88,0x82,0x6f,
-0x21,0x05,0x88,0x89,0x99,0x26,0xff,0xf6,0x02,0x3d,0x82,0x6f,0x32,0x00,0xad,0x47,
-0xf3,0x05,0xf0,0x97,0x5f,0x20,0xff,0x50,0x28,0x01,0x50,0xf5,0x40,0x05,0xfe,0xfc,
-0xde,0x01,0x21,0x01,0x43,0x3a,0x9e,0x0f,0x28,0x01,0x14,0xa0,0x43,0x11,0x00,0x00,
-0x20,0x0d,0xff,0xf3,0x00,0x6e,0xee,0x28,0x70,0x07,0xe5,0xdd,0xdd,0xdd,0xb0,0x7e,
-0xe6,0x06,0xf0,0x16,0x07,0xe0,0x01,0xac,0x80,0x00,0x7e,0x00,0xdd,0x9e,0xb0,0x07,
-0xe0,0x5f,0x10,0x4f,0x6d,0xee,0x08,0xd0,0x01,0xf6,0x6a,0xe0,0x8d,0x00,0x2f,0x30,
-0x6f,0x05,0xf3,0x08,0xf1,0x06,0xf0,0x0b,0xfd,0x33,0x41,0x2f,0x05,0x73,0x53,0x76,
-0x01,0xf0,0x01,0x77,0x65,0x00,0x02,0x10,0x05,0x9a,0x90,0x00,0xca,0x3d,0xdd,0xdd,
-0xd8,0x0c,0xa0,0xe1,0x0d,0x40,0xca,0x00,0x8f,0xfb,0xf7,0x7f,0xf0,0x08,0x54,0xea,
-0x7f,0xfa,0x09,0xc0,0x08,0xd1,0x5d,0xa0,0x7e,0x10,0xbb,0x00,0xca,0x01,0xdf,0xee,
-0x30,0x0c,0xa0,0x00,0x33,0xc0,0x4a,0x00,0x66,0x8d,0x61,0x20,0x00,0xef,0xee,0xdd,
-0xf8,0x28,0x50,0x10,0x80,0xc3,0x2b,0x13,0xe8,0x56,0x30,0x01,0x99,0x09,0xa0,0x9b,
-0x98,0x00,0x02,0x50,0x03,0x78,0x81,0x00,0x8e,0x58,0x00,0x20,0x08,0xe0,0x58,0x00,
-0xf0,0x0c,0x8e,0x00,0x8f,0xfc,0x20,0x08,0xe0,0x6f,0x42,0xcb,0x5d,0xfe,0x09,0xc0,
-0x07,0xe1,0x6b,0xe0,0x7f,0x20,0xbc,0x00,0x8e,0x01,0xdf,0xff,0x40,0xea,0x83,0x10,
-0x10,0x94,0x87,0xb1,0x4a,0xdd,0xb6,0x00,0x00,0x5f,0xa6,0x69,0xf8,0x00,0x0b,0x4f,
-0x8c,0xa2,0xae,0x20,0x00,0xcd,0x00,0x02,0xef,0xdd,0xff,0x40,0x0f,0x05,0x20,0xbd,
-0xb7,0x60,0x43,0xf0,0x17,0x26,0x73,0x03,0xf1,0xd8,0x3f,0xff,0xfe,0xd3,0xf2,0xe8,
-0x03,0x35,0x63,0x33,0xf2,0xd8,0x00,0xcf,0xfd,0x03,0xf2,0xd8,0x08,0xe1,0x1f,0xff,
-0xf2,0xd8,0x0a,0xb0,0x0d,0xa7,0xf2,0xd8,0x06,0xf6,0x7f,0x18,0x00,0x62,0x8d,0xd7,
-0x02,0xe1,0xb6,0x00,0xd4,0x18,0x12,0x07,0x50,0x53,0x43,0x12,0x22,0x23,0xf6,0x0c,
-0x00,0x20,0x08,0xf2,0xcb,0x03,0x21,0x08,0xfe,0x8b,0x59,0x01,0x25,0x10,0x20,0x44,
-0x31,0x8b,0x13,0xf4,0x25,0xae,0xff,0x00,0x08,0xe0,0x15,0x44,0x44,0x42,0x08,0xf0,
-0x4d,0xdd,0xdd,0xe8,0x08,0xf0,0x00,0x28,0x94,0x02,0x6b,0xe0,0x03,0xfb,0x9f,0x68,
-0xee,0xe0,0x09,0xd0,0x0a,0xc0,0x07,0xe0,0x09,0xc0,0x09,0xd1,0x39,0xe0,0x05,0xf6,
-0x5e,0x99,0xff,0xe0,0x00,0x6d,0xea,0x10,0x19,0x8e,0x22,0x51,0x09,0xa0,0x00,0x07,
-0xd0,0xad,0x3a,0x11,0x10,0x17,0x62,0x05,0x19,0x91,0x01,0x7e,0x62,0xf0,0x22,0x56,
-0x43,0x00,0x00,0x10,0x08,0xce,0xd1,0x00,0x8d,0x29,0x99,0x88,0x85,0x09,0xd1,0x77,
-0x77,0x88,0x50,0x9d,0x00,0x7e,0xea,0x17,0xff,0xd0,0x5f,0x64,0xda,0x15,0xbd,0x09,
-0xc0,0x07,0xe0,0x08,0xd0,0x7e,0x00,0xac,0x7f,0xfd,0x01,0xde,0xdf,0x41,0x4a,0xd0,
-0x18,0x01,0x16,0x7b,0x18,0x01,0x11,0xf7,0x18,0x01,0x10,0xd0,0x37,0x16,0x10,0xdc,
-0x18,0x01,0x13,0xfe,0x18,0x01,0x12,0x01,0xe8,0x1f,0x10,0x3d,0x43,0x70,0x00,0xf4,
-0x07,0x11,0x11,0x9a,0x3d,0x00,0xaa,0x08,0x41,0x11,0x25,0x53,0x11,0x09,0x11,0x11,
-0xfa,0xcf,0x9e,0x21,0x03,0xf6,0x20,0x29,0x00,0x03,0x08,0x50,0x3f,0xa6,0x6b,0xf3,
-0x00,0x5b,0x00,0x11,0xa3,0x12,0x02,0x06,0xa6,0x09,0x03,0xc4,0x4e,0x40,0x44,0x44,
-0x33,0x33,0x5d,0x08,0x21,0x87,0x55,0x37,0x20,0x20,0xcd,0xd4,0x5e,0x10,0xa0,0xbb,
-0xbb,0xbb,0x30,0x00,0x04,0x67,0x99,0x76,0x61,0xd1,0x40,0x01,0x6f,0x94,0x11,0xf8,
-0xf0,0x0e,0x40,0x0d,0xd7,0x6a,0xf2,0xeb,0x15,0xf1,0x02,0xdf,0x83,0x00,0x00,0x6a,
-0xa9,0x9d,0xe9,0x99,0xa9,0x03,0x67,0x77,0x77,0x77,0x76,0x50,0x6d,0x4f,0x32,0x20,
-0x00,0x03,0x16,0x41,0x11,0x9e,0x28,0x30,0x21,0x0d,0xd5,0xb3,0x15,0x20,0xcf,0xee,
-0xc4,0x08,0x26,0x01,0x55,0xb2,0x05,0x00,0xe1,0xb3,0x12,0xd3,0x94,0x2d,0x00,0x35,
-0x76,0x03,0xfa,0x44,0x31,0x45,0x54,0x43,0x10,0x3c,0x10,0xe7,0xb3,0x06,0x20,0x90,
-0x07,0xb6,0x00,0x30,0xfa,0x21,0x7f,0xa6,0xad,0x30,0xdf,0xfe,0x70,0xd0,0x38,0x44,
-0xae,0x22,0x22,0x10,0x5a,0x96,0x70,0x12,0x44,0x31,0x11,0x00,0x00,0x1b,0x03,0x7f,
-0x00,0x85,0x1a,0x21,0x2c,0xc0,0x55,0x1e,0x21,0xbd,0x00,0x47,0x02,0x14,0x50,0x56,
-0x1e,0x31,0x00,0x55,0x43,0x8c,0x4d,0x20,0x9d,0xee,0x5b,0x0c,0xb0,0x27,0x77,0x76,
-0x63,0x0f,0x70,0x00,0x3a,0xaa,0xaa,0xa7,0x9f,0x1b,0x30,0x5b,0xc9,0x10,0xa7,0x92,
-0x30,0xf8,0x6d,0xb0,0xe2,0x9c,0xf1,0x02,0xb0,0x06,0xf0,0x0e,0xec,0xa0,0x08,0xd0,
-0x09,0xd0,0x0e,0xb7,0x50,0x01,0xee,0xdf,0x50,0xe6,0x3d,0x12,0x41,0x92,0x91,0x01,
-0xf4,0x3d,0x51,0x13,0x39,0xe4,0x57,0x3e,0x3e,0x98,0x2f,0xda,0x3e,0x37,0x98,0x0b,
-0x30,0x07,0xec,0xb1,0x2e,0x56,0x50,0x15,0x76,0x00,0x1f,0x60,0xe0,0x55,0xf0,0x13,
-0xa1,0xf6,0x00,0x03,0x36,0x75,0x21,0x0f,0x60,0x00,0x2d,0xfd,0xfa,0x00,0xf6,0x00,
-0x09,0xd0,0x05,0xf1,0x0f,0xff,0x80,0x8e,0x21,0x8f,0x00,0xf9,0x52,0x00,0xaf,0xfd,
-0x40,0x1f,0x23,0x89,0x31,0x12,0x41,0xf6,0x46,0x81,0x61,0x3f,0x50,0x01,0x33,0x22,
-0x20,0xed,0x3d,0x02,0xc0,0x8c,0x47,0x54,0x44,0x45,0xf5,0x77,0x6f,0x25,0x02,0xf5,
-0x9e,0x94,0xf0,0x1f,0x7e,0xcb,0x30,0x03,0x00,0x00,0x01,0x57,0x71,0x00,0xf5,0x00,
-0x3e,0xff,0xee,0xec,0x1f,0x60,0x00,0x34,0x68,0x54,0x30,0xf6,0x00,0x01,0xdf,0xff,
-0x80,0x0f,0x60,0x00,0x8f,0x30,0x7f,0x10,0xf8,0x31,0x08,0xe1,0x07,0xf0,0x0f,0xff,
-0x90,0x1c,0x07,0x71,0x00,0xd1,0x69,0xf1,0x01,0x13,0x0f,0x60,0x08,0xee,0xff,0xff,
-0xf3,0xf6,0x00,0x25,0x55,0x43,0x10,0x0f,0x60,0x4b,0x65,0x15,0xc3,0x7d,0x83,0x15,
-0xf3,0xeb,0x23,0x10,0x90,0xd0,0x02,0x00,0x60,0x10,0x30,0x7d,0xba,0x10,0x68,0x00,
-0x40,0x68,0x81,0x00,0xf6,0xb4,0x0a,0xf2,0x24,0xfc,0x0f,0x60,0x00,0x34,0x89,0x73,
-0x20,0xf6,0x00,0x03,0xfd,0xbf,0xb0,0x0f,0x72,0x00,0x9d,0x00,0x5f,0x10,0xff,0xf9,
-0x05,0xf9,0x8d,0xd0,0x0f,0x82,0x00,0x04,0xbf,0x61,0x00,0xf6,0x00,0x6b,0xbd,0xfc,
-0xde,0x3f,0x60,0x02,0x66,0x65,0x43,0x10,0x61,0x00,0x00,0x5e,0x82,0x9f,0x43,0x66,
-0x55,0x55,0xf8,0x0d,0x00,0x00,0x96,0x58,0x20,0x65,0x51,0x7b,0x5a,0x01,0x50,0x60,
-0x4f,0x56,0x66,0x65,0x52,0x3f,0x01,0x04,0x00,0x48,0x8a,0x30,0x03,0x34,0x64,0x3f,
-0x01,0xf0,0x08,0x1c,0xff,0xf9,0x00,0xf6,0x00,0x08,0xe3,0x28,0xf1,0x0f,0xa6,0x20,
-0x8d,0x21,0x7f,0x00,0xff,0xe8,0x01,0xbf,0xfd,0x50,0x1f,0x0d,0x15,0x7f,0x3f,0x01,
-0x71,0x60,0x01,0x33,0x23,0x54,0x30,0x72,0x9c,0x0d,0x00,0x4b,0x34,0x40,0xf8,0x00,
-0x08,0xf2,0xdd,0x00,0x00,0xc1,0x02,0x51,0x01,0xed,0x76,0x7d,0xe1,0x90,0x05,0x10,
-0x81,0xcb,0x30,0xf0,0x19,0x43,0x00,0x01,0x30,0x07,0xde,0xe2,0x00,0x7e,0x17,0x77,
-0x76,0x64,0x07,0xe2,0xaa,0xaa,0xaa,0x80,0x7e,0x00,0x4b,0xda,0x20,0x07,0xe0,0x3f,
-0x96,0xcd,0x00,0x7e,0x07,0xe0,0x03,0xf2,0x07,0xe0,0x6f,0x10,0x6f,0x8f,0x35,0x10,
-0xdf,0x71,0x2e,0x10,0x35,0x33,0x3f,0x20,0x03,0xf1,0xdd,0x22,0x9e,0x7f,0x66,0x85,
-0x7e,0x5f,0xff,0xfe,0xda,0x57,0x70,0x37,0x0f,0xa8,0x03,0x22,0x11,0xa5,0xa8,0x03,
-0x31,0x6c,0xdd,0xb4,0x8a,0x4f,0x21,0x0a,0xb0,0x1d,0x5e,0x10,0xbb,0xa8,0x03,0x44,
-0xfe,0xef,0xfe,0xed,0xf2,0x96,0x03,0x01,0x00,0x31,0x4f,0xfd,0xd0,0x40,0x03,0x10,
-0x54,0xcf,0x09,0x60,0xdd,0xdd,0xdd,0xc6,0x00,0x00,0x88,0x03,0x10,0x30,0xde,0x25,
-0x10,0xa3,0x2a,0x02,0x31,0xb6,0x5a,0xf3,0x44,0x5c,0x10,0x0f,0xef,0x2a,0x30,0x94,
-0x49,0xf5,0x5a,0x5d,0x24,0xef,0xd6,0x64,0x1a,0x12,0x08,0x8f,0x2c,0x6c,0x14,0x44,
-0x4b,0xe4,0x43,0x32,0xed,0x82,0x08,0x38,0x23,0x12,0x02,0x6e,0x00,0x10,0xff,0xfe,
-0x4f,0xf0,0x20,0x56,0x88,0x54,0x07,0xd0,0x0b,0xcc,0xcc,0xcb,0x18,0xe0,0x00,0x6b,
-0xdc,0x60,0x07,0xe0,0x04,0xf6,0x46,0xf3,0x07,0xe0,0x04,0xf7,0x48,0xf3,0x07,0xe0,
-0x00,0x8e,0xfd,0x70,0x07,0xe0,0x15,0x55,0x56,0x79,0x67,0xe0,0x5e,0xef,0xfd,0xca,
-0x47,0xe0,0x2b,0x2d,0x00,0x39,0x03,0x40,0xfe,0xee,0xff,0xc0,0x02,0x62,0x41,0x5b,
-0xe0,0x00,0x1d,0xbb,0x80,0x20,0x2f,0x95,0x7d,0x08,0x10,0x1f,0x2b,0x7a,0x00,0x30,
-0x04,0x06,0xd5,0x00,0x31,0x2f,0xfd,0xd2,0x52,0x1b,0x04,0xd5,0x00,0x15,0xd6,0xd5,
-0x00,0x30,0x29,0xcd,0xa4,0xb1,0xa4,0x34,0xc6,0x59,0xf4,0x7a,0x41,0x50,0x00,0x2f,
-0xa4,0x37,0xf5,0x6e,0x2e,0x05,0xd5,0x00,0x00,0x7a,0x45,0x00,0x9a,0x45,0x70,0x14,
-0x5c,0xd4,0x47,0xf5,0x32,0x00,0x1d,0x21,0x10,0x20,0x4e,0x0d,0x21,0x04,0xf2,0x34,
-0x0c,0x16,0x3f,0xcc,0x8e,0x20,0x18,0x65,0xda,0x51,0xf0,0x29,0xac,0xd8,0x00,0xaa,
-0x07,0x99,0x99,0x88,0x1a,0xc0,0x89,0x99,0x99,0x92,0xac,0x00,0x5c,0xfe,0x70,0x0a,
-0xc0,0x2f,0x82,0x5f,0x50,0xac,0x03,0xf3,0x00,0xf7,0x0a,0xc0,0x0b,0xeb,0xed,0x10,
-0xac,0x00,0x03,0x54,0x01,0x1a,0xc4,0xde,0xee,0xff,0xf9,0xac,0x15,0x55,0x54,0x30,
-0x0a,0xc0,0x01,0xc1,0x28,0x5b,0x05,0xd2,0x40,0x11,0x31,0xc3,0x0d,0x16,0xc0,0xcd,
-0x9b,0xf0,0x1c,0x20,0x0e,0xfd,0xd5,0x00,0x7e,0x00,0x14,0x55,0x20,0x07,0xe5,0xcc,
-0xcc,0xcc,0xb0,0x7e,0x26,0x66,0x66,0x66,0x07,0xe0,0x02,0xce,0xb1,0x00,0x7f,0x00,
-0xec,0x6d,0xc0,0x07,0xf0,0x5f,0x10,0x3f,0x20,0x7f,0x08,0xd0,0x01,0xf4,0x11,0x7f,
-0x90,0x2f,0x30,0x7f,0x03,0xf4,0x09,0xe0,0x06,0xf0,0x31,0xb8,0x10,0x6f,0x13,0x41,
-0x08,0xef,0x45,0x06,0xd7,0x40,0x07,0xee,0x48,0x11,0xdc,0xe7,0x4a,0x10,0xbf,0xc7,
-0x09,0x21,0x03,0x8d,0xfd,0x52,0x01,0xd5,0x13,0x00,0x08,0x00,0x00,0x06,0x00,0x11,
-0xc7,0x08,0x00,0x30,0xfa,0x51,0x00,0x08,0x00,0x10,0x84,0x1d,0x64,0x01,0x03,0x00,
-0x0f,0x08,0x00,0x05,0x21,0x2b,0xee,0x08,0x00,0x00,0xee,0x0d,0x21,0x2b,0xee,0x08,
-0x00,0x40,0xfd,0xdf,0xff,0xff,0x89,0xa2,0x22,0xb2,0xdf,0x73,0x1d,0x00,0x0b,0x00,
-0x01,0x08,0x00,0x21,0xd0,0x0f,0x35,0x02,0x70,0x0d,0xff,0xff,0xc8,0x88,0x88,0x8c,
-0xc8,0xa9,0x01,0xbd,0x19,0x14,0x0f,0x08,0x00,0x01,0xeb,0x54,0x10,0x08,0x18,0x00,
-0x64,0xec,0xcc,0xcc,0xce,0xf0,0x0f,0x08,0x00,0x06,0x18,0x00,0x0c,0x30,0x00,0x02,
-0x48,0x00,0x04,0x58,0x00,0x31,0xdf,0xff,0x73,0x93,0x06,0x31,0xff,0xff,0xa5,0xd0,
-0x00,0x04,0x08,0x00,0x04,0x18,0x00,0x04,0x02,0x01,0x0f,0x28,0x00,0x3b,0x23,0x0a,
-0xb1,0x51,0x26,0x13,0xfc,0x44,0x9f,0x13,0xfb,0xbc,0x95,0x30,0xc0,0x1b,0xa0,0x0f,
-0x00,0x41,0xfc,0x00,0xcf,0xfb,0x0f,0x00,0x70,0x00,0xbf,0xff,0xb0,0x0b,0xff,0xfc,
-0x2e,0x0c,0x10,0xfb,0x0f,0x00,0x01,0x77,0x01,0x11,0xfb,0x09,0x18,0x02,0x3e,0xab,
-0x04,0x34,0xad,0x04,0x0d,0x18,0x01,0xed,0x5d,0xf1,0x02,0x08,0xfc,0x10,0x00,0x1c,
-0xf8,0xff,0xfc,0x10,0x1c,0xff,0xf5,0xff,0xfc,0x2c,0xff,0xf5,0xd4,0x14,0x00,0xda,
-0x14,0x10,0xf5,0xba,0xb6,0x20,0xfd,0x10,0x05,0x41,0x00,0x1e,0x00,0x40,0xf9,0xff,
-0xfc,0x1c,0x1e,0x00,0x20,0xfc,0xdf,0x1e,0x00,0x72,0xd1,0xa4,0x00,0x00,0x04,0xa1,
-0x00,0xf3,0xbb,0x00,0xf6,0x5a,0x20,0x6f,0xf1,0x7d,0x56,0xf0,0x0a,0x5f,0xd0,0x6f,
-0xf1,0x3f,0xd1,0x00,0x03,0xff,0xf1,0x6f,0xf1,0x5f,0xfd,0x00,0x0d,0xff,0x40,0x6f,
-0xf1,0x09,0xff,0x70,0x4f,0xf7,0x04,0xbb,0x40,0xcf,0xe0,0x9f,0xf0,0x08,0x00,0x40,
-0x5f,0xf3,0xbf,0xc0,0x08,0x00,0x40,0x2f,0xf5,0xbf,0xc0,0x40,0x00,0x41,0x1f,0xf6,
-0xaf,0xe0,0xc6,0x03,0x22,0xf4,0x6f,0xb5,0x72,0x40,0xf0,0x0f,0xfe,0x10,0x5d,0x15,
-0x40,0xa0,0x06,0xff,0xd3,0x65,0x06,0x82,0x20,0x00,0x9f,0xff,0xda,0xbe,0xff,0xf4,
-0x78,0x18,0x20,0xfd,0x30,0xe1,0x07,0x22,0xbd,0xca,0x2a,0x32,0x13,0x8b,0xe9,0x12,
-0x21,0xff,0xff,0x14,0x2b,0x10,0x06,0xdc,0x2d,0x30,0x00,0x04,0xfd,0x01,0x50,0x42,
-0xef,0x40,0x0d,0xff,0xd0,0x18,0x00,0x80,0xb8,0x50,0x9f,0xff,0xff,0xf4,0x08,0x4d,
-0x1a,0x00,0xef,0x01,0x02,0x8f,0xb8,0x14,0x00,0x08,0x00,0x04,0x18,0x00,0x04,0x28,
-0x00,0x04,0x38,0x00,0x20,0x04,0xfe,0x48,0x00,0x24,0xdf,0x40,0x58,0x00,0x05,0x68,
-0x00,0x06,0x78,0x00,0x52,0x03,0xdd,0x30,0x3f,0xf3,0xe6,0x30,0x31,0xf5,0x4f,0xf4,
-0x49,0x43,0x30,0x99,0xff,0xbf,0x32,0x89,0x60,0xbf,0xf6,0x22,0x6f,0xff,0xf4,0xc0,
-0xb7,0xf0,0x03,0x35,0xff,0x53,0xef,0xf4,0x00,0x04,0xff,0xc1,0x8f,0xff,0xf8,0x1c,
-0xfe,0x40,0x7f,0xfa,0x1a,0x74,0x07,0x50,0xaf,0xf7,0xcf,0x82,0xdf,0xd0,0x00,0x42,
-0x28,0xfc,0x14,0x0e,0x60,0x27,0x11,0x41,0x3e,0x13,0x02,0x1c,0xaf,0x42,0xff,0xf9,
-0x00,0x8f,0x09,0x00,0x1b,0xf8,0x09,0x00,0x00,0x80,0x5e,0x12,0x6f,0xe0,0x0e,0x28,
-0xdf,0xfd,0xfe,0x00,0x0f,0x08,0x00,0x0d,0x22,0x4f,0xff,0xca,0x08,0x01,0xed,0x31,
-0x12,0xb0,0xc2,0x42,0x02,0x46,0xaf,0x09,0x21,0x02,0x60,0xdf,0xff,0xfc,0x1b,0xb1,
-0xcf,0x98,0x02,0x4b,0xff,0xc2,0x2c,0xff,0x01,0x00,0x30,0xf0,0xe0,0xff,0xb5,0x00,
-0x01,0xa0,0x02,0x20,0x04,0xef,0xec,0x08,0x11,0x40,0xb3,0xc0,0x02,0xdb,0xa1,0x20,
-0xaf,0xb0,0x4e,0x00,0x51,0xfa,0x00,0x05,0xff,0x10,0x29,0x96,0x32,0x50,0x1e,0xf6,
-0x2c,0x0f,0x11,0xe1,0x1a,0x00,0x00,0x1c,0x00,0x01,0x9e,0x0b,0x12,0x08,0x43,0x00,
-0x02,0x3a,0x5c,0x0f,0x01,0x00,0x08,0x13,0x8f,0x08,0x00,0x10,0xf8,0x7e,0x3f,0x60,
-0xda,0x50,0x02,0xff,0x00,0x05,0x70,0x31,0xd0,0x42,0xff,0x00,0x7f,0xff,0xa7,0x7b,
-0xff,0xf9,0xff,0x05,0xff,0xc1,0x46,0x0f,0x30,0xff,0x0e,0xfc,0x1f,0x0f,0x42,0xdf,
-0xff,0x5f,0xf2,0x5a,0x37,0x22,0x8f,0xb0,0x08,0x00,0x0c,0x9e,0x04,0x02,0x5d,0x01,
-0x21,0x0b,0xf8,0x08,0x00,0x00,0xae,0xbc,0x20,0xfd,0x22,0x23,0x1b,0x40,0xe0,0xff,
-0xff,0xc2,0x48,0x00,0xd0,0x40,0xff,0x9f,0xff,0xb7,0x6a,0xff,0xf7,0x00,0xff,0x24,
-0xdf,0xff,0x99,0xaf,0x56,0xff,0x20,0x05,0xac,0xdb,0x75,0x25,0x10,0x8d,0x29,0x04,
-0x00,0x0a,0x14,0x1e,0xdf,0xad,0x00,0x01,0x14,0x00,0x02,0x57,0x02,0x26,0x09,0xff,
-0x39,0x58,0x06,0x3a,0x00,0x02,0x3c,0x00,0x00,0x3e,0x00,0x02,0x12,0x05,0x20,0x01,
-0x50,0x36,0x00,0x21,0x06,0xf7,0x1c,0x05,0x11,0xbe,0x06,0x00,0x10,0xae,0x06,0x00,
-0x30,0x05,0xf8,0xdf,0x95,0x58,0x12,0x60,0x4c,0x00,0x03,0x4e,0x00,0x04,0x36,0x68,
-0x06,0x40,0x59,0x14,0x10,0xab,0x0a,0x13,0xd2,0x60,0x00,0x31,0x03,0xee,0x10,0x63,
-0x00,0x41,0x0a,0xb1,0x2f,0xb0,0x66,0x00,0x41,0x05,0xfc,0x07,0xf4,0x4b,0x00,0x42,
-0x50,0x5f,0x60,0xf9,0x6c,0x00,0x32,0x0d,0xc0,0xbd,0x69,0x00,0x33,0x09,0xf0,0x9f,
-0x09,0x00,0x24,0xe0,0x8f,0x1b,0x00,0x14,0xad,0x2d,0x00,0x11,0xe9,0x7b,0x00,0x20,
-0x05,0xfc,0x29,0x4f,0x14,0x09,0x51,0x00,0x00,0x63,0x00,0x38,0x02,0xee,0x10,0x75,
-0x00,0x02,0x87,0x00,0x13,0x8f,0xa4,0x01,0x23,0xff,0xfc,0x09,0x01,0x00,0xff,0xbe,
-0x00,0x5f,0x29,0x00,0x79,0x04,0x12,0xee,0x10,0x00,0x40,0xfe,0x12,0xef,0xff,0x20,
-0x00,0x10,0xe1,0xbd,0x64,0x40,0xfe,0x4e,0xfe,0x10,0x50,0x50,0x31,0xe1,0x02,0xc1,
-0x93,0x01,0x1b,0x10,0xac,0x02,0x09,0xfd,0x01,0x00,0xfc,0x01,0x20,0x4e,0x40,0x3b,
-0x02,0x11,0xfb,0x53,0x02,0x00,0xb1,0x14,0x00,0x82,0x88,0x01,0x7a,0x87,0x00,0x62,
-0x00,0x11,0xfc,0x47,0x0d,0x01,0xa0,0x98,0x21,0xff,0xf2,0xd5,0x00,0x11,0x9e,0x84,
-0x0b,0x20,0xff,0x2f,0x06,0x00,0x10,0xf2,0x84,0x1f,0xc2,0x9f,0xa1,0xbf,0xff,0xff,
-0x92,0xff,0xa2,0x2f,0xff,0xf2,0x04,0xdf,0x50,0x23,0x9e,0xfe,0x72,0x42,0x00,0x2a,
-0x6f,0x50,0xcc,0xff,0x40,0x00,0x2d,0x97,0x22,0x40,0xef,0xff,0xff,0x40,0x30,0x07,
-0x10,0x44,0x41,0x00,0x1a,0x9f,0xde,0x01,0x01,0xd9,0x0b,0x20,0x45,0xff,0xf2,0x0a,
-0x24,0x4f,0xff,0x2d,0x00,0x00,0x37,0x00,0x00,0x41,0x00,0x08,0x99,0x01,0x23,0x8f,
-0x91,0xc7,0x00,0x12,0x70,0x07,0x00,0x22,0xfd,0x40,0xd5,0x00,0x00,0xa2,0x37,0x01,
-0xf3,0xae,0x03,0xe3,0x00,0x13,0xd5,0xea,0x00,0x13,0xb2,0x4f,0x03,0x09,0x07,0x00,
-0x17,0xb2,0x23,0x00,0x12,0xf7,0x3f,0x00,0x17,0x20,0x4d,0x00,0x11,0x70,0xcf,0x12,
-0x2e,0xa1,0x00,0x01,0x00,0x11,0x8f,0x26,0x04,0x00,0xe0,0x02,0x03,0x5f,0x00,0x0f,
-0x07,0x00,0x37,0x10,0x7f,0x2b,0x72,0x33,0xff,0xf7,0x8f,0xee,0x01,0x0f,0x01,0x00,
-0x40,0x03,0x5b,0x00,0x02,0x45,0x1d,0x30,0x10,0x00,0x03,0x3e,0x0d,0x10,0x04,0xf3,
-0x52,0x01,0xb6,0x01,0x10,0x04,0x1d,0x00,0x23,0x54,0xff,0xb1,0xbf,0x07,0x01,0x00,
-0x23,0xf9,0xff,0xb4,0x01,0x14,0xf3,0x2d,0x00,0x00,0x37,0x00,0x01,0x41,0x00,0x04,
-0x17,0x01,0x22,0x2d,0xd2,0x35,0x0a,0x12,0xef,0xfe,0x7e,0x11,0x1d,0x61,0xbd,0x01,
-0x87,0x03,0x26,0xfc,0x00,0x11,0x05,0x11,0xaf,0x5d,0x00,0x03,0x93,0x38,0x33,0xff,
-0x90,0x0f,0xf3,0x04,0x03,0xae,0x04,0x15,0x80,0x1e,0xa2,0x02,0x10,0x00,0x14,0xc0,
-0x20,0x00,0x04,0x08,0x00,0x04,0x18,0x00,0x00,0xf1,0x35,0x10,0x40,0xcd,0x37,0x10,
-0xf0,0x6a,0x00,0x57,0xa0,0x00,0x01,0xdf,0xfa,0x09,0x00,0x30,0x0c,0xff,0xa0,0xc5,
-0x13,0x10,0x80,0x21,0x00,0x11,0xf8,0x8c,0x00,0x0c,0x0b,0x00,0x01,0x0f,0xc6,0x11,
-0x50,0x5f,0x07,0x21,0x0f,0xfc,0x78,0x27,0x10,0xc1,0x17,0x07,0x0d,0x0b,0x00,0x10,
-0xc0,0xef,0x03,0x00,0x05,0x45,0x10,0xfd,0x1f,0x64,0x17,0xd1,0x09,0x00,0x20,0x0f,
-0xfd,0x41,0x07,0x12,0xb1,0x8f,0x24,0x22,0xff,0x40,0x7c,0x04,0x1f,0x80,0x07,0x00,
-0x04,0x7a,0x48,0x88,0x8c,0xff,0xc8,0x88,0x84,0x54,0x01,0x03,0x15,0x00,0x0f,0x38,
-0x00,0x09,0x03,0x5b,0x00,0x02,0x83,0xb1,0x32,0x41,0xef,0xff,0x76,0x03,0x02,0x01,
-0x00,0x20,0x7b,0xbb,0x01,0x00,0x71,0xb7,0x00,0x00,0x05,0xad,0xff,0xda,0xe0,0xb4,
-0x41,0xdf,0xfc,0x88,0xcf,0x89,0x31,0x50,0xfe,0x40,0x00,0x04,0xef,0xed,0xbe,0xf0,
-0x08,0xf4,0x00,0x9e,0x80,0x4f,0xff,0x70,0x4f,0xff,0xc0,0x00,0xaf,0xf8,0x0c,0xff,
-0xf4,0xdf,0xff,0x80,0x9a,0xff,0xfe,0x08,0xe1,0x09,0x21,0x80,0xef,0x09,0x00,0x50,
-0x4f,0xff,0xc0,0x8f,0xff,0x1b,0x00,0x50,0x07,0xff,0xf4,0x08,0xee,0x2d,0x00,0x03,
-0x3f,0x00,0x17,0xf8,0x51,0x00,0x04,0x63,0x00,0x25,0x8c,0x20,0x59,0x09,0x14,0xe4,
-0x0a,0x00,0x73,0x1b,0xff,0x80,0x49,0xdf,0xfd,0xa5,0x98,0x15,0x30,0xd8,0x8c,0xff,
-0x3e,0x10,0x01,0x3f,0x00,0x31,0x4e,0xff,0x70,0xbb,0x2c,0xf0,0x05,0x69,0xe8,0x04,
-0xff,0xf7,0x00,0x04,0xe3,0x00,0x9f,0xfe,0xff,0x80,0xcf,0xff,0x40,0x0d,0xff,0x70,
-0x05,0xbd,0xc3,0x71,0xff,0xd0,0x0d,0xff,0xf7,0x00,0x2d,0x0a,0x00,0x20,0x04,0xff,
-0x9e,0xbb,0xa1,0xf8,0xcf,0xff,0x30,0x00,0x7f,0xff,0x40,0x00,0x06,0x93,0x03,0x10,
-0x08,0x4a,0x07,0x11,0x3e,0x48,0x28,0x61,0x4d,0xff,0xc8,0x82,0x01,0xbf,0x4e,0x1b,
-0x65,0x5a,0xdf,0xfc,0x10,0x08,0xff,0x95,0xb6,0x25,0x4e,0xfd,0xfd,0x22,0x17,0xc8,
-0x87,0x02,0x07,0x8b,0x09,0x10,0x00,0xe0,0xc0,0x05,0xd5,0x19,0x15,0xd0,0x62,0x91,
-0x13,0xf7,0xc5,0xb6,0x42,0xd8,0x8d,0xff,0x10,0x82,0x2f,0x22,0xa0,0x0a,0xb5,0x28,
-0x10,0x3f,0xe7,0x09,0x12,0xf3,0xbe,0x02,0x42,0xc0,0x0c,0xff,0xfc,0x44,0x00,0x21,
-0xd0,0x0d,0x48,0x00,0x12,0x0e,0xc2,0x08,0x02,0xae,0x1a,0x20,0xe2,0x2e,0x4d,0x03,
-0x10,0x02,0xcb,0x02,0x00,0xd3,0x02,0x01,0xe4,0x16,0x20,0xe3,0x3e,0xb1,0x0e,0x05,
-0x77,0x07,0x04,0xdc,0x02,0x07,0xde,0x02,0x16,0x00,0xeb,0xa4,0x00,0x6c,0x04,0x10,
-0x80,0x6e,0x04,0x11,0x07,0xf1,0x03,0x11,0xf6,0x10,0x86,0xe0,0x78,0x8e,0xff,0x15,
-0xff,0xe8,0xff,0xe2,0x00,0x02,0xe5,0x4f,0xfe,0x20,0x91,0xb8,0x51,0x13,0xff,0xf3,
-0x00,0x52,0x9a,0x00,0x30,0x31,0x00,0x52,0xe2,0x10,0x90,0xf4,0x5e,0x20,0xfe,0x20,
-0x78,0x8e,0xff,0x51,0x28,0x00,0x04,0x38,0x00,0x04,0x48,0x00,0x04,0x58,0x00,0x0a,
-0x68,0x00,0x17,0x00,0x59,0x49,0x13,0xdd,0xa4,0x03,0x11,0xd1,0x12,0x3b,0x30,0xff,
-0xfd,0x10,0x0d,0x00,0xf1,0x04,0x99,0xff,0xd1,0x00,0x01,0xdf,0xf9,0x00,0x9f,0xfd,
-0x10,0x1d,0xff,0x90,0x00,0x09,0xff,0xd1,0xbf,0xac,0xb7,0x40,0xfb,0x5f,0x90,0x00,
-0x49,0x91,0x0a,0x44,0x00,0x03,0x15,0x00,0x03,0x23,0x00,0x03,0x31,0x00,0x03,0x3f,
-0x00,0x03,0x4d,0x00,0x04,0x5b,0x00,0x03,0x69,0x00,0x04,0x77,0x00,0x0c,0x01,0x00,
-0x24,0x1d,0xd1,0x97,0x00,0x41,0xdf,0xfd,0x10,0xef,0x6b,0x19,0x00,0x3e,0x04,0x11,
-0xaf,0x42,0x08,0x60,0xcf,0xcf,0xfc,0xfc,0x00,0x00,0x51,0xc9,0x42,0x6b,0x1f,0xf1,
-0xb6,0x0a,0x00,0x01,0x04,0x00,0x0f,0x0a,0x00,0x02,0x01,0x24,0x00,0x01,0x0a,0x00,
-0x01,0x38,0x00,0x10,0x0f,0x6d,0x04,0x01,0x8a,0x04,0x10,0x0d,0xe7,0x2a,0x00,0x60,
-0x00,0x0c,0x74,0x00,0x03,0x7a,0x59,0x01,0x0f,0x00,0x01,0xf0,0xb4,0x06,0x20,0x07,
-0x0f,0x81,0x05,0x2e,0x06,0x5f,0x07,0x05,0x46,0xb9,0x03,0x95,0x02,0x04,0x0f,0x0a,
-0x03,0x1f,0x0a,0x04,0x1e,0x05,0x04,0x3f,0x0a,0x0f,0x6f,0x0a,0x14,0x84,0xdf,0xff,
-0xf0,0xdf,0xfd,0x0f,0xff,0xfd,0xfc,0xc3,0x0f,0x47,0x0a,0x06,0x09,0x01,0x00,0x32,
-0x0a,0xea,0x62,0x30,0x03,0x04,0x41,0x86,0x13,0x9f,0x55,0x00,0x13,0x0f,0x1e,0x03,
-0x23,0x02,0xff,0x02,0x0d,0x11,0x03,0xa3,0xa7,0x01,0x86,0x04,0x1a,0xf2,0x54,0x03,
-0x31,0x6f,0xff,0x30,0x1a,0x10,0x10,0x4f,0xa9,0x90,0x10,0x8f,0x2f,0x28,0x10,0xd0,
-0xff,0x14,0x20,0xe4,0xbf,0x49,0x01,0x01,0xa8,0x04,0x13,0xd1,0xd3,0x32,0x11,0x90,
-0x2e,0x00,0x00,0x61,0x17,0x00,0x59,0x00,0x22,0xdb,0x72,0x2a,0x1d,0x10,0xee,0x0f,
-0x8d,0x20,0x61,0x08,0x14,0x03,0xf0,0x02,0x2d,0xff,0xd0,0xef,0x33,0xfe,0x00,0x2e,
-0xff,0xf3,0x0e,0xf3,0x3f,0xe0,0x2e,0xff,0xf3,0x8f,0x01,0x10,0x6e,0x7f,0x03,0x11,
-0x8e,0x68,0x23,0x00,0xee,0x02,0x02,0x8d,0x03,0x11,0x2e,0xc8,0x44,0x22,0x08,0xef,
-0xb7,0x6c,0x30,0xff,0xff,0xf6,0x85,0x77,0x70,0xef,0x33,0xfe,0x02,0xef,0xff,0x30,
-0x3c,0x00,0x00,0x08,0x00,0x10,0x8f,0x8f,0x03,0x40,0xdf,0xfd,0x00,0x8e,0x5c,0x22,
-0x21,0x66,0x10,0xd6,0x0e,0x12,0x0d,0x17,0x08,0x22,0x0f,0xd1,0x07,0x00,0x31,0xfd,
-0xdf,0xf0,0x41,0x1a,0x23,0xff,0xf0,0x29,0x01,0x0f,0x07,0x00,0x1e,0x11,0xdf,0x46,
-0x08,0x16,0xf9,0x4c,0x09,0x02,0x2b,0x1d,0x13,0xfd,0xc1,0x1e,0x32,0xc1,0x00,0xff,
-0x3b,0xb7,0x11,0xff,0x60,0x04,0x12,0xd1,0x6c,0x0f,0x12,0xfc,0x07,0x00,0x02,0x6c,
-0x01,0x0e,0x2c,0x02,0x41,0xfb,0x11,0xbf,0xff,0x73,0x2c,0x17,0x1f,0x07,0x00,0x03,
-0x15,0x00,0x08,0xba,0x07,0x02,0xe4,0x53,0x1a,0x21,0x3d,0x00,0x03,0x15,0x00,0x04,
-0x37,0x70,0x0f,0x23,0x00,0x2b,0x1b,0x8f,0xfe,0x02,0x22,0xcf,0xff,0x6c,0x0a,0x04,
-0xb4,0x07,0x21,0xd2,0x5f,0x5e,0xb8,0x30,0x2d,0xff,0x62,0xdc,0x07,0x90,0x26,0xff,
-0xff,0xfa,0x18,0xff,0xff,0x81,0xaf,0xfa,0x04,0x31,0x4d,0xd4,0x3e,0x24,0x00,0x2f,
-0x81,0x18,0x0e,0x03,0x09,0x01,0x56,0x10,0x11,0x01,0x18,0x08,0x11,0x03,0x87,0x05,
-0x11,0x06,0x12,0x87,0x11,0x08,0x7f,0x02,0x11,0x0a,0x17,0x0e,0x01,0xe8,0x07,0x21,
-0xa0,0x0e,0xeb,0x0a,0x13,0x0d,0x43,0x03,0x11,0x0a,0x91,0x0d,0x11,0x0e,0xcc,0x05,
-0x21,0x2f,0xfc,0x83,0x04,0x11,0xf3,0xbf,0x02,0x11,0xa0,0x92,0x06,0x01,0xda,0x03,
-0x11,0xd7,0xae,0x02,0x21,0xde,0x40,0x1d,0x03,0x11,0x99,0x66,0xc7,0x24,0xff,0x99,
-0x18,0x11,0x01,0x07,0x00,0x12,0x90,0x7f,0x01,0x10,0x0d,0x17,0x02,0x30,0xff,0xff,
-0x0f,0x17,0x02,0x02,0x07,0x00,0x11,0xfd,0x07,0x00,0x00,0x3a,0x79,0x03,0xbb,0x05,
-0x08,0x07,0x00,0x32,0xdf,0xff,0x0f,0x41,0x00,0x0a,0x07,0x00,0x13,0x0d,0x5e,0x03,
-0x13,0xcc,0x51,0x03,0x01,0xdd,0x76,0x42,0xbf,0xff,0xfc,0x20,0xb1,0x0d,0x12,0xe1,
-0x96,0x03,0x12,0xf8,0x13,0x03,0x14,0xfd,0x86,0x00,0x12,0x01,0x07,0x00,0x02,0x52,
-0xb9,0x22,0x30,0x08,0x1c,0x06,0x03,0xe1,0x0d,0x12,0xcf,0x6c,0x01,0x03,0x07,0x00,
-0x05,0xb4,0x03,0x12,0x0e,0x8d,0x0e,0x20,0x04,0xee,0x4a,0x31,0x0e,0x9f,0x04,0x30,
-0x00,0xf0,0x0f,0x03,0x00,0x07,0x09,0x00,0x05,0x01,0x00,0x77,0xf8,0x08,0x80,0x88,
-0x08,0x80,0x8f,0x09,0x00,0x07,0x36,0x00,0x00,0xf5,0x03,0x17,0x00,0x09,0x00,0x0e,
-0x15,0x0e,0x0a,0x01,0x00,0x11,0x03,0xf5,0x39,0x01,0x92,0x63,0x02,0x2a,0x79,0x12,
-0xdf,0xe7,0x2f,0x22,0x17,0xef,0x64,0x48,0x13,0x18,0xb6,0x00,0x13,0x2a,0x2d,0xba,
-0x13,0x08,0xe6,0x0f,0x04,0x85,0x0e,0x13,0x60,0x12,0x00,0x14,0xfe,0xc5,0x04,0x14,
-0xf7,0x09,0x00,0x14,0xf1,0x09,0x00,0x14,0x80,0x09,0x00,0x03,0xaa,0x05,0x05,0x3d,
-0x73,0x24,0xff,0xf2,0xae,0x05,0x09,0x48,0x07,0x00,0x4e,0xbc,0x11,0xd1,0x75,0x0e,
-0x21,0xfd,0x10,0xa3,0x03,0x11,0xd1,0x06,0x00,0x12,0xfd,0x66,0x89,0x0f,0xbe,0x05,
-0x29,0x1d,0xdf,0x3c,0x05,0x51,0x04,0x9c,0xef,0xfe,0xc9,0x55,0x69,0x11,0xef,0xc6,
-0x00,0xf2,0x00,0x70,0x00,0x04,0xdf,0xff,0xfc,0xa8,0x8a,0xcf,0xff,0xfd,0x40,0x6f,
-0xff,0xd5,0x34,0xa2,0x43,0xf6,0xcf,0xf6,0x00,0x14,0x66,0x40,0x1a,0x30,0x00,0x5a,
-0x1c,0x09,0x20,0x03,0xa1,0xc2,0x08,0x20,0xff,0xff,0x1c,0x09,0x00,0x14,0xce,0x31,
-0xa8,0x8a,0xef,0x67,0x44,0x10,0xdf,0xc5,0x2b,0x01,0x72,0x06,0x12,0x12,0x08,0x25,
-0x02,0xd2,0x08,0x05,0x5c,0x09,0x2e,0xef,0xfe,0x0a,0x00,0x02,0x1e,0x00,0x15,0x8f,
-0x54,0x08,0x06,0xf0,0x05,0x04,0x8a,0x0b,0x27,0x0f,0xfd,0xbb,0x02,0x03,0x0a,0x00,
-0x06,0xd6,0x02,0x09,0xe0,0x02,0x06,0x32,0x00,0x05,0x46,0x00,0x06,0x5a,0x00,0x0f,
-0x64,0x00,0x11,0x24,0xf0,0x00,0x64,0x00,0x00,0x67,0xc9,0x0e,0x0a,0x00,0x0f,0x64,
-0x00,0x30,0x02,0x99,0x06,0x04,0x6a,0x10,0x0e,0x0a,0x00,0x0f,0x64,0x00,0x2f,0x24,
-0xf0,0x00,0x64,0x00,0x02,0x10,0x07,0x0e,0x0a,0x00,0x0f,0x64,0x00,0x2d,0x04,0x0a,
-0x00,0x06,0x2e,0x11,0x0e,0x0a,0x00,0x0f,0x64,0x00,0x0e,0x0c,0x62,0x1a,0x04,0xcc,
-0x08,0x34,0x01,0xcf,0xff,0x9b,0x09,0x24,0xb9,0x29,0x7b,0x8c,0x12,0x3f,0xee,0xb0,
-0x52,0x03,0xdf,0x80,0x0a,0x90,0x92,0x21,0x40,0xdf,0xff,0x77,0xf7,0x6b,0x2a,0xf0,
-0x03,0x8f,0xd3,0x0f,0xff,0xfd,0xcc,0xdf,0xdc,0xcc,0xcc,0xcd,0xff,0xb0,0x8f,0xfe,
-0x10,0x00,0xaa,0x60,0x0b,0xa3,0x40,0x00,0x46,0x10,0x00,0x01,0xf2,0x02,0x33,0x10,
-0xad,0x56,0x36,0xb1,0xcf,0xf9,0x9a,0x3a,0x15,0x90,0x54,0x0b,0x15,0xf9,0x43,0x0a,
-0x21,0x22,0x00,0xa6,0xcd,0x70,0xfd,0x92,0x00,0x02,0xef,0xfb,0xef,0xd7,0x0b,0xf0,
-0x0c,0xfa,0x2e,0xff,0xe0,0x4f,0xff,0xfa,0x03,0xff,0xf5,0x9f,0xfa,0xfa,0x35,0x4f,
-0xfa,0xcf,0xc0,0x8a,0x3d,0x0b,0xfd,0xef,0xfb,0x03,0x11,0x8f,0x4e,0xa0,0x11,0x06,
-0x17,0x08,0x00,0x0e,0x92,0xf0,0x09,0xfd,0x11,0x10,0x9f,0xff,0xdf,0xd1,0x59,0x3b,
-0x0b,0xfd,0xaf,0xd6,0xfa,0x37,0x1d,0xfb,0x5f,0xff,0xfa,0x01,0xdf,0xf7,0x0d,0xac,
-0x09,0xc1,0xf1,0x03,0xef,0xfc,0xdf,0xff,0x50,0x00,0x18,0xdf,0xfe,0xa3,0xa8,0x0b,
-0x13,0xf7,0x51,0x08,0x00,0x08,0x25,0x08,0x98,0x3c,0x03,0xc8,0x13,0x04,0x07,0x00,
-0xcf,0xf9,0x9f,0x99,0xf9,0x9f,0xf0,0x0f,0xf8,0x8f,0x88,0xf8,0x8f,0x07,0x00,0x12,
-0x03,0x31,0x00,0x08,0xa4,0x0b,0x13,0x80,0x1c,0x0c,0x14,0xa0,0x24,0x0c,0x14,0xb0,
-0x36,0x0c,0x01,0x12,0x00,0x22,0x7a,0x1d,0xa2,0x01,0x51,0x7f,0xfa,0x1d,0xff,0x70,
-0x20,0x00,0x22,0xfa,0x1d,0x08,0x00,0x02,0xa5,0x04,0x01,0xfa,0xa1,0x0f,0x08,0x00,
-0x08,0x02,0x43,0x5b,0x02,0xee,0x09,0x13,0x70,0xbc,0x04,0x12,0x70,0xde,0x05,0x03,
-0x68,0x09,0x2d,0xde,0xdb,0x40,0xbf,0x12,0x1b,0xfe,0x01,0x10,0xe4,0x4c,0x0b,0x02,
-0x00,0x01,0x00,0x1d,0x0b,0x70,0xfa,0xef,0xfe,0xaf,0xff,0xff,0x01,0x7f,0x05,0x50,
-0x2e,0xe2,0x0a,0xff,0xff,0xfe,0xbf,0x42,0xe2,0x02,0x20,0x2e,0xae,0x07,0x11,0xfe,
-0x0d,0xaf,0x06,0x0a,0x00,0x06,0x1e,0x00,0x06,0x32,0x00,0x06,0x46,0x00,0x07,0x5a,
-0x00,0x06,0x6e,0x00,0x11,0x07,0x06,0x00,0x10,0x7f,0x16,0x00,0x71,0x07,0xf8,0x0f,
-0x0b,0x40,0xff,0x7f,0x06,0x00,0x12,0xff,0x06,0x00,0x0f,0x01,0x00,0x22,0x02,0x34,
-0x05,0x12,0x4e,0x60,0x00,0x19,0x00,0xce,0x02,0x22,0x03,0xe0,0x95,0x2a,0x32,0x02,
-0xef,0x10,0x87,0x57,0x51,0x7f,0xf1,0x00,0xcf,0xf1,0x5c,0x29,0x30,0x11,0xcf,0xff,
-0x02,0x6b,0x33,0xbf,0xf1,0xcf,0x47,0x00,0x23,0x17,0xff,0xda,0x14,0x14,0x07,0x35,
-0x06,0x14,0x06,0x2c,0x06,0x3e,0x05,0xa0,0x00,0x01,0x00,0x05,0xb2,0x02,0x0b,0x01,
-0x00,0x04,0x1e,0x0e,0x17,0xf1,0x14,0x00,0x7b,0xfa,0xf9,0x00,0xfe,0xf5,0x00,0xf5,
-0x83,0x59,0x06,0x5f,0x7e,0x2e,0x00,0x03,0x16,0x00,0x2f,0xdc,0x00,0x01,0x00,0x15,
-0x1f,0xe1,0x1e,0x00,0x0a,0x23,0xf1,0x00,0xa9,0x43,0x92,0xfd,0x00,0x00,0xf1,0xfe,
-0xf6,0xfb,0x00,0xed,0x93,0x00,0x9b,0xff,0x00,0x00,0xfe,0xff,0xfa,0xfc,0x00,0x02,
-0x30,0x00,0x3f,0xfd,0x00,0xfd,0xdd,0x00,0x04,0x06,0xb4,0x06,0x03,0x41,0x08,0x0a,
-0xa4,0x15,0x16,0xfe,0x70,0x00,0x10,0xfd,0x54,0x4a,0x00,0x4a,0x00,0x1b,0xfb,0x24,
-0x0c,0x0c,0xfa,0x00,0x05,0x3c,0x00,0x11,0xfe,0x3f,0x00,0x26,0xfe,0xfd,0x30,0x00,
-0x11,0xde,0xaa,0x2a,0x15,0xe6,0x24,0x00,0x53,0xfc,0xfd,0x00,0x00,0xfd,0x04,0x00,
-0x18,0x00,0xee,0xc0,0x03,0x90,0x00,0x1f,0x02,0x6b,0x00,0x08,0x1f,0xfd,0x43,0x01,
-0x0d,0x16,0xec,0xd5,0x00,0x04,0x31,0x00,0x10,0xfd,0x07,0x00,0x29,0xfb,0xf8,0x8c,
-0x01,0x00,0x37,0xc5,0x67,0xe6,0xfd,0xe6,0xf4,0x00,0xdd,0xf7,0x00,0x26,0xf1,0xfa,
-0xc3,0xb6,0x10,0x00,0xe3,0x28,0x12,0xe9,0x61,0x01,0x30,0x00,0xfc,0x00,0xfb,0x02,
-0x00,0x38,0x29,0x0d,0x65,0x01,0x01,0x6f,0x00,0x4f,0xfd,0xfe,0x00,0xfc,0x97,0x00,
-0x0b,0x10,0xfa,0x3e,0x00,0x1f,0xfa,0x7b,0x02,0x03,0xb1,0xe0,0xde,0x00,0x00,0xf1,
-0xfd,0xe5,0xfe,0x02,0x00,0x02,0x60,0x00,0xd3,0xeb,0xf5,0x00,0xf5,0xe6,0xf8,0xf7,
-0x00,0xf8,0xf6,0xfa,0xf6,0xf9,0x5e,0x01,0x66,0xe5,0xec,0x00,0x00,0xf7,0xfe,0x2b,
-0x01,0x81,0xfa,0xfb,0x00,0x00,0xfa,0xfc,0x00,0x00,0x3a,0x06,0x12,0x02,0x3e,0x01,
-0x22,0xee,0xf9,0xb4,0x02,0x13,0x02,0x24,0x00,0x22,0xfc,0xfc,0x6c,0x01,0x18,0xfe,
-0x7a,0x40,0x14,0xed,0x45,0x01,0x1a,0x02,0x20,0x01,0x14,0xfc,0xcd,0x00,0xe0,0x03,
-0xfa,0xe3,0xed,0x00,0x00,0xed,0xfc,0xf4,0xfe,0x02,0xf4,0x02,0x02,0x92,0x00,0xe6,
-0xf8,0xf8,0xfd,0xfb,0xf8,0xfb,0xf9,0xfd,0xfb,0xfe,0x00,0xfd,0xfc,0x02,0xc5,0x00,
-0x2e,0x02,0xfd,0x68,0x01,0x08,0xf8,0x01,0x05,0x4d,0x02,0x1f,0xfe,0x14,0x01,0x03,
-0x0e,0x17,0x00,0x0e,0x1d,0x00,0x0f,0x57,0x01,0x0a,0x10,0xff,0x6e,0x02,0x0c,0xbd,
-0x02,0x0f,0x6c,0x00,0x27,0x1e,0x02,0xbd,0x03,0x19,0x02,0x71,0x02,0x14,0x02,0x26,
-0x47,0x0f,0x01,0x00,0x20,0x0b,0x81,0x00,0x1f,0xf5,0x2c,0x00,0x0b,0x23,0xfd,0xfe,
-0xa2,0x01,0x1c,0xea,0x6c,0x02,0x40,0xfe,0x03,0x00,0xfc,0x39,0xba,0x1e,0x02,0x89,
-0x02,0x0a,0x94,0x02,0x0a,0x58,0x03,0x1c,0xeb,0x63,0x00,0x2d,0xfe,0x02,0x14,0x01,
-0x1f,0xf1,0xd8,0x00,0x24,0x1f,0xfb,0x24,0x00,0x10,0x1f,0xfe,0x19,0x00,0x1b,0x00,
-0x70,0x4f,0x02,0xaf,0x36,0x02,0xbf,0x46,0x1e,0x05,0x7e,0x80,0xf2,0x0b,0x07,0x08,
-0x09,0x0a,0x0b,0x00,0x0c,0x0c,0x0d,0x0e,0x0f,0x0c,0x0c,0x09,0x10,0x11,0x12,0x00,
-0x13,0x0d,0x14,0x15,0x16,0x17,0x18,0x19,0xc4,0xbc,0x70,0x1b,0x1c,0x00,0x1d,0x1e,
-0x00,0x1f,0xc5,0x25,0xff,0x01,0x1f,0x1f,0x21,0x1b,0x00,0x22,0x00,0x23,0x00,0x24,
-0x25,0x26,0x24,0x27,0x28,0x00,0x01,0x00,0xff,0xfe,0x0a,0x75,0x02,0x20,0x03,0x02,
-0x70,0x02,0x4b,0x06,0x07,0x06,0x08,0x1f,0x00,0x70,0x09,0x00,0x0a,0x00,0x0b,0x00,
-0x00,0x04,0x00,0x21,0x0c,0x00,0x08,0x00,0xa0,0x0b,0x00,0x0d,0x0e,0x0f,0x10,0x11,
-0x12,0x13,0x14,0xd3,0x48,0x00,0x59,0x6c,0x51,0x17,0x17,0x17,0x18,0x17,0x2e,0x00,
-0xe6,0x19,0x19,0x1a,0x19,0x17,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x1f,0x22,0x52,
-0x77,0x0a,0x01,0x00,0x1f,0x24,0x6f,0x02,0xff,0xe9,0x50,0x00,0x00,0x00,0x00,0x00,
+0x00,0xe8,0x0c,0x50,0x00,0x00,0x0c,0x50,0x4d,0x00,0x11,0x40,0x9a,0x00,0x30,0x70,
+0x01,0xf7,0xe3,0x0a,0x20,0x1f,0x70,0x7f,0x0b,0x10,0xf7,0xc6,0x00,0x11,0x0f,0xab,
+0x0b,0x35,0x13,0x44,0x43,0x5b,0x0c,0x11,0x53,0x08,0x01,0x10,0xd0,0x08,0x01,0xc0,
+0xbb,0x00,0xe7,0x0a,0xbb,0xbf,0x63,0x4e,0x70,0x67,0x7e,0xe5,0xb7,0x01,0xb0,0xf3,
+0x00,0x0e,0x70,0x1b,0xf4,0x00,0x00,0xe7,0x1e,0xd3,0x4a,0x01,0xd1,0x50,0x00,0x1b,
+0x10,0xe7,0x00,0x00,0x07,0xf2,0x08,0x30,0x00,0x00,0x6d,0x0f,0x30,0x9f,0xdf,0x40,
+0x73,0x07,0xd0,0xbf,0x60,0x00,0xaf,0x50,0x00,0x8f,0x70,0x05,0x20,0x00,0x00,0x33,
+0xf0,0x2f,0x00,0x00,0x00,0x00,0x10,0x31,0x01,0x22,0x22,0x03,0xf0,0xe7,0x0f,0xff,
+0xff,0x24,0xf1,0xe7,0x01,0x22,0x7f,0x13,0xf1,0xe7,0x00,0x00,0x8d,0x03,0xf1,0xe7,
+0x27,0x88,0xe9,0x15,0xf1,0xe7,0x3b,0xcd,0xf7,0xff,0xf1,0xe7,0x00,0x0b,0xd0,0x26,
+0xf1,0xe7,0x00,0x4f,0x40,0x03,0xf1,0xe7,0x01,0xdb,0x00,0x03,0xf1,0xe7,0x0b,0xe1,
+0x06,0x00,0x80,0x4f,0x30,0x00,0x04,0xf1,0xe7,0x01,0x00,0x06,0x00,0x14,0x00,0x06,
+0x00,0x46,0x02,0xc0,0xd6,0x00,0x01,0x00,0xf0,0x2e,0x20,0x01,0x22,0x21,0x00,0x6e,
+0x0c,0xff,0xff,0xf1,0x07,0xf0,0x01,0x11,0x7f,0x00,0x7f,0x00,0x00,0x0a,0xb8,0xde,
+0xf0,0x68,0x88,0xf6,0x36,0xbf,0x09,0xbb,0xee,0x00,0x07,0xf0,0x00,0x2f,0x80,0x00,
+0x7f,0x00,0x0b,0xd0,0x8f,0xff,0xf0,0x08,0xf3,0x01,0x44,0x9f,0x06,0xf5,0x00,0x00,
+0x07,0xe0,0xd5,0x00,0x00,0x00,0x6e,0x41,0x00,0x20,0x06,0xe0,0x06,0x00,0x11,0x7e,
+0x0b,0x00,0x15,0xd0,0x57,0x00,0xf3,0x34,0x02,0x00,0x68,0x88,0x85,0x00,0xe7,0x0a,
+0xcb,0xbe,0xc0,0x0e,0x70,0x00,0x00,0xe9,0xdf,0xf7,0x1d,0xee,0xef,0x32,0x4e,0x70,
+0x45,0x6f,0xa0,0x11,0xe7,0x00,0x1d,0xd1,0x8f,0xff,0x70,0x5e,0xc1,0x00,0x33,0xe7,
+0x2f,0x70,0x00,0x00,0x0e,0x60,0x00,0x34,0x44,0x44,0x50,0x00,0x0f,0xff,0xff,0xff,
+0x70,0x01,0xf7,0x00,0x00,0xf7,0x00,0x1f,0x70,0x00,0x0f,0x0b,0x00,0x00,0x16,0x00,
+0xf0,0x09,0x60,0x00,0x13,0x44,0x43,0x20,0x00,0x00,0x00,0x01,0x10,0x00,0x00,0x0a,
+0xff,0xff,0xff,0xe0,0x00,0x00,0x13,0x33,0x33,0x9f,0x6b,0x00,0x00,0xa2,0x00,0xb0,
+0x00,0xaf,0xff,0xff,0xff,0x00,0x00,0x01,0x34,0x43,0x3a,0x8e,0x00,0xf0,0x01,0x25,
+0x00,0x9c,0x00,0x00,0x00,0x09,0xf0,0x0a,0xb0,0x00,0x00,0x00,0x9f,0x00,0x54,0x0d,
+0x00,0x00,0x18,0x00,0x80,0x7d,0xee,0xff,0xee,0xee,0xee,0x22,0x66,0x01,0x00,0xd0,
+0x50,0x00,0x02,0x22,0x22,0x21,0x00,0x00,0x9f,0xff,0xff,0xfe,0x00,0x0c,0x00,0x14,
+0x8f,0x0c,0x00,0xf0,0x02,0x25,0x55,0x44,0xad,0x00,0x00,0x00,0x4e,0x00,0x8b,0x00,
+0x02,0x22,0x7f,0x32,0x33,0x21,0x5d,0x00,0xf0,0x05,0xff,0xfe,0x01,0x10,0x00,0x01,
+0x11,0x10,0x00,0xad,0xdd,0xde,0xee,0x10,0x00,0x36,0x66,0x66,0x8f,0x30,0x83,0x00,
+0xa1,0x7f,0x30,0x00,0xcf,0xff,0xff,0xfe,0x10,0x00,0xdb,0x8c,0x00,0xf1,0x0e,0xcf,
+0xee,0xff,0xff,0x70,0x00,0x15,0x55,0x55,0x54,0x10,0x00,0x00,0x00,0x11,0x10,0x00,
+0x00,0x0d,0xff,0xff,0xff,0xb0,0x00,0x00,0x24,0x44,0x33,0xcc,0x22,0x00,0x82,0x0a,
+0xc0,0x00,0x00,0x35,0x55,0x55,0xcb,0x1a,0x00,0x11,0xa0,0x14,0x00,0x11,0xc9,0x06,
+0x00,0x21,0x0d,0x80,0x07,0x00,0x14,0xc4,0x43,0x01,0x02,0x77,0x00,0x20,0x03,0x55,
+0x01,0x00,0xc0,0x40,0x00,0x7e,0xee,0xee,0xfc,0x00,0x00,0x26,0x55,0x55,0xaf,0xa2,
+0x00,0x20,0x55,0xae,0xae,0x00,0x21,0xee,0xfd,0x29,0x00,0x81,0x9c,0x00,0x14,0x44,
+0x44,0x44,0x78,0x43,0x31,0x00,0x13,0xfd,0x3e,0x00,0x0f,0xa8,0x00,0x17,0x02,0x5a,
+0x00,0x54,0x02,0x65,0x55,0x5a,0xf0,0x5b,0x00,0x00,0x63,0x01,0x02,0xcc,0x01,0x11,
+0x8c,0x06,0x00,0xa3,0x03,0x50,0x00,0x9e,0xee,0xee,0xee,0xee,0xed,0x02,0x8e,0x00,
+0x00,0x9a,0x02,0xf0,0x13,0x00,0x00,0x0b,0xff,0xff,0xff,0xf1,0x00,0x00,0xdc,0x44,
+0x44,0x8f,0x20,0x00,0x0d,0xa0,0x00,0x05,0xf1,0x00,0x00,0xda,0x00,0x00,0x5f,0x10,
+0x00,0x0c,0xff,0xff,0xff,0xf0,0x00,0x98,0x00,0x12,0x31,0x8f,0x00,0xe0,0x14,0x13,
+0x33,0x43,0x00,0x7f,0xbf,0xff,0xff,0x20,0x7f,0x00,0x00,0x4f,0x66,0x02,0xf0,0x08,
+0x9c,0x00,0x7f,0x8c,0xcc,0xf7,0x00,0x7f,0x57,0x7c,0xf1,0x00,0x7f,0x00,0x1f,0x90,
+0x00,0x7f,0x00,0xae,0x10,0x00,0x7f,0x5e,0x02,0x74,0x7f,0x5f,0x70,0x00,0x00,0x7e,
+0xb7,0x62,0x02,0x15,0x6e,0x61,0x02,0x15,0x6d,0x60,0x02,0xf0,0x2a,0x01,0x10,0x35,
+0x56,0x64,0x00,0xba,0x0b,0xed,0xdf,0xe0,0x0c,0xa0,0x13,0x33,0xdb,0x00,0xca,0x0f,
+0xff,0xff,0x40,0x0c,0xa0,0x00,0x5f,0x80,0x00,0xca,0x00,0x6f,0xa0,0x00,0x0c,0xa0,
+0xbf,0x70,0x00,0x00,0xca,0x08,0x10,0x00,0x00,0x04,0x30,0x02,0xef,0xff,0xff,0xf6,
+0x00,0x05,0x66,0x65,0x5f,0x80,0x6b,0x02,0x90,0xf8,0x00,0x3f,0xff,0xff,0xff,0x40,
+0x03,0xf5,0x4a,0x00,0x50,0x2f,0xfe,0xff,0xff,0xc0,0x93,0x01,0x12,0x42,0xb8,0x02,
+0xf0,0x02,0x00,0x34,0x45,0x53,0x02,0xf3,0x00,0x0f,0xff,0xfe,0x90,0x2f,0x30,0x00,
+0xf6,0x00,0x00,0x0d,0x00,0x36,0x60,0x00,0x00,0x0d,0x00,0xc1,0xff,0xff,0xa0,0x2f,
+0xff,0xd0,0xf9,0x44,0x31,0x02,0xf7,0x42,0x1a,0x00,0xf1,0x05,0x40,0x00,0xf6,0x00,
+0x02,0x11,0xf4,0x00,0x0f,0xfe,0xff,0xfa,0x1f,0x40,0x00,0x25,0x54,0x32,0x01,0xf4,
+0xa6,0x00,0x11,0x1f,0x2a,0x01,0x03,0x0d,0x00,0x21,0x0e,0x30,0x07,0x00,0xf0,0x04,
+0x17,0x00,0x00,0xef,0xff,0xf8,0x05,0xf1,0x00,0x2f,0x86,0x55,0x10,0x5f,0x10,0x02,
+0xf4,0x00,0x00,0x0d,0x00,0xf0,0x23,0xff,0xff,0x80,0x5f,0xff,0x82,0xf7,0x33,0x30,
+0x05,0xf6,0x51,0x2f,0x51,0x13,0x51,0x5f,0x10,0x00,0xff,0xff,0xfe,0x45,0xf1,0x00,
+0x01,0x22,0x10,0x00,0x2a,0x00,0x00,0x02,0x66,0x66,0x67,0x60,0x00,0x00,0x8e,0xee,
+0xed,0xef,0x10,0x00,0x00,0x33,0x33,0x38,0xf1,0x22,0x02,0x00,0xb0,0x02,0x40,0x0a,
+0xd1,0x11,0x10,0xe8,0x02,0x64,0xee,0xff,0xff,0x50,0x00,0x01,0x9f,0x01,0x70,0x00,
+0x04,0x00,0x00,0xde,0xdd,0xe7,0x5b,0x00,0x36,0x97,0x66,0x20,0x68,0x00,0xf5,0x0f,
+0x97,0x77,0x30,0x5f,0x76,0x32,0xfd,0xcc,0xc5,0x05,0xfe,0xe8,0x2f,0x40,0x00,0x10,
+0x5f,0x10,0x01,0xfe,0xee,0xff,0x65,0xf1,0x00,0x03,0x55,0x43,0x20,0x3d,0x60,0x01,
+0xf1,0x09,0x7e,0xee,0xef,0xfe,0x10,0x00,0x0a,0xe6,0x65,0x59,0xf2,0x00,0x00,0xad,
+0x00,0x00,0x4f,0x20,0x00,0x0a,0xd0,0x00,0x05,0xf2,0x25,0x03,0x82,0xff,0x10,0x00,
+0x01,0x44,0x44,0x44,0x20,0xea,0x03,0xc0,0x03,0x55,0x55,0x0d,0x60,0xe7,0xef,0xff,
+0xd2,0xf7,0x0f,0x7e,0xb7,0x03,0xf2,0x08,0xe7,0xe7,0x00,0x00,0xe7,0x0e,0x7e,0x93,
+0x32,0x0e,0x70,0xe7,0xef,0xff,0xf1,0xef,0xff,0x7e,0x81,0x10,0x0e,0x94,0xf7,0x16,
+0x00,0xf0,0x00,0x70,0x01,0x0e,0x70,0xe7,0xee,0xde,0xf9,0xe7,0x0e,0x73,0x66,0x42,
+0x0e,0x70,0x90,0x04,0x10,0xe7,0x21,0x04,0x02,0x0b,0x00,0x31,0xc5,0x0e,0x70,0x94,
+0x04,0x02,0x58,0x00,0xf2,0x1d,0x44,0x44,0x0e,0x60,0xf5,0xef,0xfe,0xc0,0xe7,0x0f,
+0x6e,0x70,0x00,0x0e,0x70,0xf6,0xef,0xee,0xd0,0xef,0xef,0x6f,0xa5,0x53,0x0d,0xa5,
+0xf6,0xf7,0x00,0x00,0xd7,0x0f,0x6e,0xed,0xef,0x6d,0x80,0xf6,0x36,0x65,0x30,0xb5,
+0x0f,0x50,0x92,0x02,0x00,0x02,0x03,0x51,0x20,0x03,0x55,0x54,0x47,0x72,0x01,0x20,
+0x3f,0x40,0xbb,0x02,0x02,0x0b,0x00,0x01,0x7c,0x01,0x11,0x70,0x58,0x00,0x94,0x05,
+0x88,0x87,0x0e,0x50,0xf5,0xed,0xbb,0x90,0x58,0x00,0xa0,0xed,0xbb,0xa0,0xed,0xbf,
+0x6f,0xc9,0x86,0x0d,0xc8,0x58,0x00,0xe0,0xd8,0x0f,0x6e,0xda,0xbd,0x5d,0x80,0xf6,
+0x69,0x98,0x61,0xb5,0x0e,0x40,0x8c,0x00,0x30,0x30,0x00,0x6e,0xff,0x01,0xd0,0x06,
+0xf5,0x55,0x56,0xf3,0x00,0x6f,0xff,0xff,0xff,0x30,0x07,0xf0,0x09,0x02,0x10,0x6f,
+0x6e,0x00,0x00,0x50,0x02,0x11,0x30,0xb5,0x00,0xd3,0x35,0x55,0x53,0x00,0xe6,0xdf,
+0xff,0xfb,0x00,0xe7,0xe8,0x00,0x00,0x05,0x00,0xc4,0xe9,0x22,0x21,0x67,0xf7,0xef,
+0xff,0xf5,0xdd,0xf7,0xe9,0x11,0x14,0x00,0x10,0xf8,0x05,0x00,0x90,0xee,0xdd,0xef,
+0x90,0xe7,0x36,0x66,0x53,0x00,0xf7,0x00,0x07,0x05,0x00,0x06,0x9b,0x05,0x00,0x58,
+0x01,0xf0,0x0b,0x30,0x07,0xe0,0xef,0xff,0xea,0x00,0x8f,0x0e,0x80,0x00,0x00,0x08,
+0xf0,0xea,0x44,0x51,0x5b,0xde,0x0f,0xff,0xfe,0x54,0x8c,0xe0,0xf7,0xa3,0x01,0xb0,
+0x0f,0x93,0x34,0x62,0x08,0xe0,0xcf,0xff,0xfd,0x50,0x8e,0x31,0x00,0xf0,0x00,0x08,
+0xe0,0x00,0x55,0x00,0x00,0x8d,0x00,0x0c,0xb0,0x00,0x02,0x50,0x00,0xcb,0x13,0x00,
+0x71,0x0c,0xb1,0x11,0x11,0x00,0x00,0xbf,0x27,0x02,0x40,0x33,0x33,0x33,0x10,0x14,
+0x00,0xf0,0x37,0x13,0x0a,0xed,0xde,0xa0,0x07,0xf0,0xeb,0x76,0x63,0x00,0x7f,0x0e,
+0x80,0x00,0x01,0x5a,0xf0,0xff,0xff,0xf6,0x8f,0xff,0x0f,0xa5,0x54,0x00,0x07,0xf0,
+0xf8,0x11,0x24,0x10,0x7e,0x0d,0xff,0xff,0xf6,0x07,0xe0,0x02,0x22,0x00,0x00,0x26,
+0x00,0x02,0x55,0x55,0x56,0x40,0x00,0xbf,0xff,0xfe,0xfe,0x00,0x00,0x11,0x11,0x19,
+0xe0,0x00,0xef,0xff,0xff,0xfc,0x00,0x0f,0x81,0x73,0x02,0x91,0xff,0xee,0xff,0xff,
+0x10,0x02,0x55,0x55,0x54,0x00,0x01,0x60,0x21,0xbe,0xdd,0xea,0x00,0xd9,0x57,0x00,
+0xf0,0x24,0xc9,0xe8,0x00,0x00,0x24,0xd9,0xff,0xff,0xf6,0xaf,0xf9,0xfa,0x55,0x40,
+0x00,0xc9,0xf7,0x00,0x02,0x00,0xc9,0xdf,0xff,0xff,0x70,0xd9,0x24,0x44,0x31,0x00,
+0xc8,0x00,0x23,0x33,0x33,0x40,0x00,0xff,0xff,0xff,0xf7,0x01,0xf7,0x11,0x11,0xf8,
+0x01,0xf6,0x00,0x00,0xe8,0x05,0x00,0x10,0xe7,0x14,0x00,0x15,0xf6,0xea,0x05,0xb0,
+0x04,0x14,0x66,0x64,0x06,0xe0,0xe7,0xee,0xdd,0x90,0x7f,0x58,0x02,0x20,0x06,0xf0,
+0x42,0x02,0xd1,0x6f,0x0f,0x7e,0xa5,0x50,0x38,0xf0,0xf7,0xef,0xed,0x4f,0xff,0x0e,
+0x16,0x00,0x10,0xe7,0x16,0x00,0xf0,0x03,0x0e,0x7e,0x70,0x02,0x06,0xf0,0xe7,0xef,
+0xff,0xf4,0x6f,0x0e,0x72,0x54,0x31,0x06,0xf0,0xe7,0x20,0x01,0x20,0x0e,0x70,0xa9,
+0x06,0x00,0x0b,0x00,0x37,0x5a,0x0d,0x70,0x58,0x01,0xb0,0x44,0x43,0x06,0xe0,0xf5,
+0xef,0xfe,0xa0,0x7f,0x0f,0x6e,0x42,0x00,0xb0,0xf6,0xef,0xee,0x7f,0xff,0x0f,0x6f,
+0xa5,0x51,0x38,0xf0,0x00,0x02,0x10,0x5f,0x58,0x02,0x20,0x65,0xf0,0x58,0x02,0x14,
+0x4d,0x58,0x02,0x10,0x9f,0xea,0x01,0x1f,0x02,0x58,0x02,0x0a,0x20,0x01,0x03,0x58,
+0x00,0x10,0xf0,0x58,0x00,0xf0,0x05,0x6f,0x0f,0x5e,0x80,0x00,0x06,0xf0,0xf5,0xea,
+0x55,0x05,0xaf,0x0f,0x5f,0xff,0xe4,0xde,0xf0,0xf5,0xf7,0xbb,0x00,0xf1,0x0f,0x5f,
+0x92,0x35,0x16,0xf0,0xf5,0xcf,0xff,0xe5,0x6f,0x0f,0x50,0x11,0x00,0x06,0xf1,0xf5,
+0x00,0x54,0x00,0x6e,0x1f,0x50,0x0c,0xb0,0x00,0x20,0x61,0x00,0xda,0x03,0x06,0x60,
+0xb0,0x00,0x12,0x20,0x00,0xbf,0x63,0x02,0x51,0x01,0x33,0x33,0x32,0x10,0xb1,0x00,
+0xa0,0x0b,0xee,0xeb,0x05,0xb0,0xf5,0xea,0x55,0x20,0x7e,0xb0,0x00,0x60,0x28,0xf0,
+0xf6,0xef,0xff,0x5f,0xb0,0x00,0x21,0x40,0x17,0xb0,0x00,0x10,0x6f,0xb0,0x00,0x11,
+0x66,0xb0,0x00,0xa0,0x27,0x0b,0x30,0x01,0x55,0x55,0x56,0x60,0x00,0x8f,0xdf,0x04,
+0x52,0x00,0x11,0x11,0x14,0xf4,0xbb,0x00,0x33,0x0a,0xe0,0x00,0x22,0x04,0x10,0xa0,
+0x21,0x04,0x11,0x41,0x60,0x01,0x03,0x08,0x01,0x35,0xff,0xb0,0x6f,0x08,0x01,0x1f,
+0x6e,0x08,0x01,0x03,0x14,0x3d,0x08,0x01,0x10,0x6e,0x43,0x06,0x70,0x08,0xf5,0x55,
+0x58,0xf3,0x00,0x8f,0xfd,0x00,0x71,0x08,0xf0,0x00,0x03,0xf2,0x00,0x7f,0x12,0x04,
+0x40,0x34,0x44,0x33,0x10,0x52,0x06,0x11,0x53,0x18,0x06,0x61,0xfe,0xa0,0x00,0x00,
+0xbb,0x00,0x84,0x02,0x50,0xc4,0x44,0x45,0x20,0x00,0x7e,0x06,0x51,0xe9,0x00,0x00,
+0x0b,0xb0,0x14,0x00,0xf2,0x00,0xbc,0x44,0x44,0x45,0x00,0x00,0x08,0xff,0xff,0xfe,
+0xd2,0x00,0x00,0x00,0x05,0xf9,0x06,0x20,0x8d,0x00,0x7f,0x06,0x71,0x5b,0xe5,0x45,
+0x54,0x09,0xff,0xff,0x81,0x06,0xf0,0x02,0x5f,0xee,0xee,0xe8,0x00,0x00,0x08,0xf5,
+0x55,0x55,0x20,0x00,0x00,0x8f,0x55,0x55,0x52,0x34,0x00,0x70,0xfe,0xee,0x80,0x00,
+0x00,0x8f,0x11,0xd9,0x02,0x12,0x06,0x66,0x06,0xd3,0x02,0x28,0xf2,0x10,0x00,0x02,
+0x55,0x54,0x9f,0x44,0x45,0x40,0x9f,0x04,0x07,0x02,0x3b,0x01,0x14,0xac,0x73,0x07,
+0x00,0x01,0x00,0x60,0xbd,0x11,0x11,0x12,0x00,0x00,0x5c,0x00,0x70,0xf8,0x00,0x00,
+0x02,0x33,0x33,0x22,0xc6,0x01,0xb0,0x33,0x33,0x31,0x00,0x00,0x07,0xff,0xff,0xff,
+0x90,0x00,0xd3,0x00,0x00,0x47,0x03,0x03,0x0d,0x00,0xf0,0x04,0x55,0x44,0x41,0x00,
+0x00,0x08,0xf4,0x44,0x44,0x40,0x00,0x00,0x5f,0xff,0xff,0xed,0x00,0x00,0x00,0xb7,
+0x06,0x72,0x00,0x9e,0xed,0xde,0xfd,0xdd,0xdc,0x09,0x07,0xf0,0x11,0x30,0x00,0x02,
+0x9c,0xdb,0x70,0x00,0x00,0x02,0xfd,0x76,0x8f,0xb0,0x00,0x00,0x8f,0x10,0x00,0x6f,
+0x10,0x00,0x06,0xf5,0x00,0x0a,0xf0,0x00,0x00,0x0b,0xfe,0xdf,0xf5,0x62,0x00,0x00,
+0x8f,0x05,0x00,0x41,0x00,0x15,0xf9,0xca,0x00,0x42,0x8e,0x22,0x22,0x20,0x68,0x00,
+0x11,0x70,0x0d,0x00,0x15,0x10,0x68,0x00,0x42,0x4f,0xff,0xff,0xed,0xba,0x00,0x01,
+0xeb,0x07,0xa2,0x55,0x66,0x66,0x08,0xee,0xee,0xef,0xdd,0xdd,0xb0,0xe6,0x08,0x03,
+0x82,0x00,0x0b,0x0d,0x00,0x11,0x01,0x9d,0x01,0x01,0x7a,0x01,0x00,0x3b,0x02,0x14,
+0xea,0x79,0x01,0x44,0xcc,0x44,0x44,0x52,0x78,0x01,0x16,0xbb,0x77,0x01,0x00,0x1d,
+0x02,0x37,0xed,0x20,0x00,0x01,0x00,0xcf,0x37,0x66,0x66,0x66,0x77,0x75,0x8d,0xdd,
+0xdd,0xdd,0xdd,0xdb,0x12,0x01,0x0f,0x41,0xf3,0x33,0x33,0x30,0xd1,0x00,0x14,0xfe,
+0x40,0x00,0x09,0x1b,0x08,0x00,0x6d,0x08,0x12,0x43,0x1b,0x08,0x43,0xf3,0x00,0x00,
+0x01,0x2e,0x03,0x22,0x00,0x02,0x04,0x07,0x12,0x2f,0x04,0x07,0x27,0x60,0x00,0xdc,
+0x01,0x1f,0x10,0xdc,0x01,0x02,0x13,0x07,0xdc,0x01,0x00,0x1f,0x01,0x03,0x5b,0x00,
+0x0a,0xdc,0x01,0x01,0xf4,0x04,0x01,0xd8,0x09,0x00,0x83,0x00,0x01,0xdc,0x01,0x11,
+0x08,0x41,0x04,0x0a,0xdc,0x01,0x11,0x9f,0x7a,0x01,0x41,0xad,0x22,0x33,0x30,0x30,
+0x07,0x10,0xfa,0x0c,0x00,0x00,0xbd,0x04,0x00,0x23,0x03,0x03,0x5f,0x00,0xc0,0xae,
+0xdd,0xdd,0xdd,0xde,0xea,0x35,0x56,0x66,0x65,0x55,0x53,0x09,0x08,0x11,0x55,0x36,
+0x01,0x10,0xff,0xf0,0x09,0x51,0x11,0x6f,0x10,0x00,0xdf,0xeb,0x00,0x11,0xea,0x96,
+0x00,0x10,0xdf,0x8d,0x0a,0x00,0x25,0x09,0x12,0x43,0x4c,0x04,0xf0,0x02,0x01,0x54,
+0x45,0x50,0x06,0xf0,0x7f,0xff,0xfe,0x20,0x6f,0x07,0xe0,0x00,0x00,0x06,0xf0,0x96,
+0x00,0x21,0x6f,0x08,0x0b,0x00,0x9a,0x8f,0xff,0xff,0x20,0x6f,0x08,0xf4,0x44,0x30,
+0x16,0x00,0x91,0xbb,0xcd,0xf2,0x6f,0x01,0x88,0x88,0x64,0x06,0xc4,0x01,0x11,0x6f,
+0x38,0x0b,0x01,0x0b,0x00,0x16,0x5e,0x92,0x01,0x10,0x52,0x4c,0x05,0x10,0xe8,0x4c,
+0x05,0x10,0xd8,0x33,0x06,0xf3,0x09,0xd8,0xff,0xee,0xea,0x00,0xd8,0xfa,0x65,0x52,
+0x00,0xd8,0xf7,0x00,0x01,0x00,0xd8,0xef,0xee,0xff,0x90,0xe8,0x25,0x55,0x42,0x2e,
+0x06,0xa0,0x05,0xff,0xff,0xff,0xf5,0x01,0x55,0x44,0x44,0xf7,0x0e,0x00,0x0b,0x05,
+0x00,0x13,0x51,0x0c,0x08,0xb0,0x27,0x77,0x77,0x72,0x3f,0x30,0x00,0x5d,0xdd,0xdd,
+0xc4,0x92,0x01,0x20,0x50,0x07,0xb7,0x08,0x44,0x05,0xf0,0x4f,0x10,0x07,0x00,0x21,
+0x63,0x20,0x07,0x00,0x21,0xff,0xe0,0x07,0x00,0x50,0x41,0x00,0x05,0xf0,0x5f,0x23,
+0x00,0x12,0x04,0x07,0x00,0xc2,0x7f,0xfe,0xff,0xfc,0x2f,0x40,0x00,0x15,0x55,0x44,
+0x31,0x2f,0x60,0x08,0x0a,0x07,0x00,0x02,0xea,0x08,0x00,0xf0,0x01,0x01,0x30,0x0a,
+0xf0,0x14,0x00,0x02,0x88,0x88,0x99,0x24,0xf1,0x00,0x3b,0xbb,0xba,0x92,0x4f,0x20,
+0x00,0x1a,0x10,0xb2,0x04,0xf2,0x00,0x03,0xf2,0x2f,0x40,0x4f,0xba,0x50,0x3f,0x22,
+0xf3,0x04,0xfb,0xa5,0x02,0x0d,0x00,0x10,0x20,0xbb,0x00,0xf1,0x00,0xb4,0xf2,0x00,
+0x14,0x44,0x43,0x20,0x2c,0x00,0x00,0x03,0x70,0x00,0x01,0x90,0x09,0x04,0x82,0x4f,
+0x10,0x00,0x08,0xe5,0x55,0x58,0xf1,0xa8,0x01,0x74,0x10,0x00,0x08,0xd0,0x00,0x04,
+0xf1,0xb5,0x01,0x06,0x7c,0x08,0xf9,0x08,0x00,0x20,0x03,0x33,0x34,0x26,0xc0,0xe6,
+0x4f,0xff,0xff,0xd8,0xd0,0xf6,0x01,0x60,0x24,0x08,0xd0,0xf6,0x04,0xf1,0x9c,0x06,
+0x00,0x10,0xff,0x06,0x00,0x21,0x07,0xe3,0x06,0x00,0x01,0x12,0x00,0xf0,0x00,0x17,
+0xd0,0xf6,0x5f,0xff,0xff,0xfa,0xe0,0xf6,0x03,0x33,0x33,0x17,0xe0,0xf6,0x4f,0x03,
+0x03,0x06,0x00,0x10,0xf7,0x4d,0x01,0x32,0xb0,0xe6,0x00,0xdf,0x0a,0x00,0xe0,0x01,
+0xf1,0x18,0x21,0xef,0xff,0xff,0x90,0xab,0x04,0x55,0x55,0x41,0x0b,0xb0,0x0c,0x50,
+0xc6,0x12,0xbb,0x00,0xe6,0x0e,0x7b,0xff,0xb0,0x0e,0x60,0xe7,0x01,0xbb,0x02,0xe8,
+0x3f,0x98,0x1b,0xb2,0xff,0xff,0xff,0xd3,0xaa,0xf4,0x00,0xf1,0x0a,0x30,0x00,0xde,
+0xee,0xee,0xf8,0x00,0x05,0x66,0x66,0x5d,0xa0,0x00,0x56,0x66,0x66,0xda,0x00,0x1f,
+0xed,0xdd,0xdd,0x60,0x01,0xf6,0x20,0x01,0x01,0xd1,0x04,0x42,0x35,0x55,0x44,0x42,
+0xb9,0x00,0xf0,0x00,0x45,0x55,0x56,0x30,0xa9,0x1e,0xee,0xee,0xd7,0x0b,0xb0,0x0a,
+0x40,0xa5,0x00,0x58,0x00,0x20,0x79,0xdf,0x58,0x00,0xf1,0x04,0x36,0xdb,0x00,0xe6,
+0x0e,0x60,0x0b,0xb1,0xdf,0xed,0xff,0xe3,0xbb,0x06,0x66,0x65,0x43,0x0b,0xa0,0x5e,
+0x07,0x21,0x00,0x0e,0x86,0x03,0xa0,0xf9,0x33,0x33,0xca,0x00,0x0f,0x70,0x00,0x0c,
+0xa0,0xdf,0x01,0x31,0xca,0x00,0x0f,0x16,0x00,0x13,0x24,0x84,0x08,0xf2,0x08,0x10,
+0x31,0x04,0x55,0x55,0x24,0xf0,0xe7,0x4f,0xff,0xff,0xa4,0xf0,0xe7,0x01,0x50,0x42,
+0x05,0xf0,0xf7,0x04,0xf0,0xc8,0x06,0x00,0x11,0x16,0x06,0x00,0x13,0xef,0x12,0x00,
+0xf1,0x08,0xe7,0x04,0xf0,0xc8,0x04,0xf0,0xe7,0x05,0xf2,0xd8,0x24,0xf0,0xe7,0x5f,
+0xff,0xff,0xf5,0xf0,0xe7,0x02,0x22,0x21,0x04,0x3a,0x07,0x08,0x06,0x00,0x36,0x02,
+0x90,0xd7,0x98,0x02,0xf3,0x23,0x10,0x21,0x05,0x55,0x56,0x33,0xf1,0xc9,0x3e,0xee,
+0xed,0x84,0xf2,0xca,0x02,0xd1,0x79,0x03,0xf2,0xca,0x04,0xf2,0xab,0x8e,0xf2,0xca,
+0x04,0xf1,0xab,0x38,0xf2,0xca,0x03,0xf1,0xaa,0x03,0xf2,0xca,0x3d,0xfd,0xff,0xe4,
+0xf2,0xca,0x15,0x55,0x54,0x22,0xf1,0xb8,0x39,0x00,0x11,0x07,0x9a,0x03,0x65,0x01,
+0x55,0x54,0x44,0xf8,0x00,0x9b,0x02,0x09,0x06,0x00,0x14,0x41,0x18,0x01,0xf1,0x1a,
+0x55,0x20,0xe7,0x2e,0xee,0xed,0xd5,0x0e,0x80,0x06,0x10,0x81,0xbd,0xf8,0x00,0xf5,
+0x1f,0x44,0x6e,0x80,0x0f,0x51,0xf3,0x23,0xe8,0x00,0xf5,0x1f,0x3d,0xff,0x80,0x5f,
+0x86,0xf8,0x60,0xe8,0x2e,0xee,0xed,0xca,0x0e,0x36,0x06,0x70,0xe8,0x00,0x07,0x20,
+0x00,0x0e,0x80,0x9b,0x0b,0x10,0x83,0xa7,0x0b,0x00,0x50,0x00,0x31,0x11,0x12,0x21,
+0x18,0x01,0x62,0xc0,0x00,0x13,0x33,0x32,0x20,0x2e,0x0c,0xa0,0x89,0x99,0x99,0x50,
+0xbb,0x1a,0xbb,0xba,0xa5,0x1c,0x70,0x01,0x70,0xbf,0xfb,0x00,0xe6,0x0e,0x70,0x2b,
+0x70,0x01,0x70,0x7b,0xeb,0x00,0xe6,0x0e,0x64,0x6d,0x70,0x01,0x12,0xf4,0x70,0x01,
+0x01,0xa3,0x06,0xf0,0x00,0x88,0x00,0x00,0x9e,0xff,0xd7,0x00,0x00,0xaf,0x63,0x38,
+0xf6,0x00,0x0f,0x90,0x55,0x09,0xf0,0x11,0xdc,0x10,0x02,0xf9,0x00,0x04,0xff,0xde,
+0xfd,0x10,0x00,0x00,0x45,0x53,0x00,0x00,0x44,0x44,0x44,0x44,0x10,0x00,0x1e,0xff,
+0xff,0xff,0xe5,0x00,0x00,0x04,0x60,0x05,0x7d,0x00,0x11,0x9d,0x73,0x06,0x44,0x0a,
+0xd0,0x0a,0xc0,0x0d,0x00,0x92,0x03,0xef,0xfe,0xef,0xff,0xb0,0x00,0x04,0x54,0x0b,
+0x0d,0x12,0x07,0xf2,0x0d,0x11,0x9d,0xec,0x06,0xb0,0x5c,0xe5,0x55,0x55,0x0a,0xff,
+0xee,0xee,0xee,0xef,0xe0,0xf1,0x3b,0x00,0x22,0x22,0x22,0x32,0x00,0x00,0xff,0xff,
+0xff,0xfe,0x00,0x00,0x03,0x41,0x13,0x20,0x00,0x00,0x09,0xd0,0x0b,0x80,0x00,0x00,
+0x4b,0xe4,0x4d,0xb8,0x10,0x02,0xef,0xff,0xfe,0xed,0x30,0x00,0x00,0x08,0xe0,0x00,
+0x00,0x8f,0xff,0xff,0xff,0xff,0xfd,0x01,0x22,0x21,0x11,0x11,0x00,0x00,0xcf,0xff,
+0xff,0xfe,0x10,0x00,0x35,0x55,0x55,0x8f,0x20,0x00,0x24,0x44,0x44,0x8f,0x20,0x00,
+0xdf,0x42,0x00,0x20,0xda,0x00,0x01,0x00,0xf4,0x1b,0xcf,0xee,0xff,0xff,0x60,0x00,
+0x15,0x55,0x55,0x54,0x00,0x00,0x44,0x44,0x44,0x44,0x10,0x00,0x1e,0xff,0xff,0xff,
+0xe5,0x00,0x00,0x04,0x60,0x05,0x60,0x00,0x00,0x00,0x9d,0x00,0xac,0x00,0x00,0x00,
+0x0a,0xd0,0x0a,0xc0,0x0d,0x00,0xf2,0x19,0x03,0xef,0xfe,0xef,0xff,0xb0,0x00,0x04,
+0x54,0x44,0x44,0x31,0x00,0x00,0x04,0xc0,0x07,0x80,0x00,0x00,0x00,0x7f,0x00,0xbb,
+0x00,0x00,0x35,0x5a,0xf6,0x6d,0xd6,0x65,0x0b,0xff,0xee,0xee,0xff,0xff,0xe0,0x00,
+0x01,0x00,0x60,0x0d,0xff,0xff,0xff,0xf8,0x00,0x7f,0x00,0xd0,0x54,0x10,0x00,0x00,
+0x5d,0x00,0x6d,0x00,0x00,0x00,0x08,0xf0,0x07,0x1f,0x00,0x60,0x8f,0x00,0x7f,0x00,
+0x00,0x02,0x4e,0x00,0x11,0xd0,0x4e,0x00,0x13,0x41,0x33,0x00,0xf0,0x03,0x08,0xfe,
+0xee,0xee,0xef,0xff,0xf2,0x25,0x55,0x59,0xf5,0x44,0x43,0x00,0x00,0x00,0x6f,0x10,
+0x16,0x00,0x21,0x06,0xf1,0x1d,0x00,0x21,0x6f,0x00,0x0d,0x00,0x11,0xf0,0x07,0x00,
+0x32,0x01,0x00,0x00,0xb6,0x00,0xc0,0x00,0x00,0x3f,0xff,0xff,0xff,0xe3,0x00,0x00,
+0x07,0x70,0x08,0xb6,0x00,0xa4,0xbb,0x00,0xca,0x00,0x00,0x00,0x0b,0xb0,0x0c,0xa0,
+0x0d,0x00,0xd9,0x06,0xff,0xfe,0xef,0xff,0x80,0x00,0x14,0x54,0x44,0x44,0x30,0x00,
+0x01,0x00,0x80,0x8e,0xee,0xee,0xdd,0xde,0xed,0x03,0x66,0x01,0x00,0x12,0x40,0x64,
+0x01,0x12,0x01,0x64,0x01,0xf1,0x08,0x02,0x31,0x13,0x10,0x00,0x00,0x0a,0xb0,0x0e,
+0x70,0x00,0x00,0x3c,0xc4,0x4e,0xa8,0x10,0x02,0xff,0xff,0xff,0xed,0x20,0x36,0x00,
+0x21,0x10,0xbf,0x64,0x01,0x81,0x02,0x22,0x22,0x21,0x11,0x10,0x00,0xcf,0x30,0x00,
+0xf1,0x04,0x36,0x66,0x55,0x9f,0x10,0x00,0x24,0x44,0x45,0x9f,0x10,0x00,0xef,0xff,
+0xff,0xfd,0x00,0x00,0xea,0x2c,0x00,0x20,0xdf,0xff,0x64,0x01,0x42,0x25,0x65,0x55,
+0x54,0xb6,0x00,0xf4,0x11,0x10,0x56,0x66,0x67,0x40,0x9b,0x1d,0xee,0xed,0xd8,0x0a,
+0xc0,0x04,0x10,0x44,0x00,0xac,0x00,0xd8,0x0b,0xb0,0x09,0xc0,0x0e,0x80,0xba,0x00,
+0x9c,0x00,0xe8,0x0b,0xa0,0x0b,0x00,0x10,0xd8,0x0b,0x00,0xf0,0x01,0x0d,0x80,0xc9,
+0x00,0x9c,0x1d,0xfe,0xdf,0xff,0x49,0xc0,0x56,0x66,0x55,0x40,0x9c,0x42,0x00,0x20,
+0x09,0xc0,0x06,0x00,0x01,0x0b,0x00,0x27,0x07,0xa0,0xcb,0x00,0xf1,0x1c,0x45,0x55,
+0x55,0x20,0xba,0x1d,0xee,0xed,0xd7,0x0b,0xb0,0x06,0x20,0x63,0x00,0xbb,0x00,0xe7,
+0x0e,0x80,0x0b,0xb0,0x0e,0x60,0xe8,0x00,0xba,0x00,0xe6,0x0e,0x70,0x0b,0xa0,0x4e,
+0x95,0xea,0x71,0xba,0x2e,0xee,0xed,0xdb,0x2b,0x37,0x00,0xf0,0x00,0xba,0x00,0x06,
+0x40,0x00,0x0b,0xa0,0x00,0xe9,0x00,0x00,0x65,0x00,0x0e,0x90,0x13,0x00,0x41,0xe9,
+0x11,0x12,0x21,0xb5,0x01,0x51,0xc0,0x00,0x13,0x33,0x32,0xec,0x00,0xf0,0x07,0x02,
+0x21,0xef,0xff,0xff,0x90,0xab,0x04,0x55,0x55,0x41,0x0a,0xb0,0x0c,0x50,0xc6,0x00,
+0xab,0x00,0xe7,0x0e,0x70,0x17,0x01,0xe0,0xe7,0x00,0xab,0x02,0xe8,0x3e,0x98,0x1b,
+0xb2,0xff,0xff,0xff,0xd3,0xaa,0x2c,0x00,0xf0,0x0b,0x03,0x30,0x00,0xde,0xee,0xee,
+0xf8,0x00,0x05,0x66,0x66,0x5d,0xa0,0x00,0x56,0x66,0x66,0xda,0x00,0x1f,0xed,0xdd,
+0xdd,0x60,0x01,0xf6,0x1e,0x00,0xa4,0x1f,0xff,0xff,0xff,0xd0,0x00,0x35,0x55,0x44,
+0x42,0xb0,0x00,0xc5,0x56,0x30,0xba,0x1e,0xee,0xee,0xd7,0x0b,0xb0,0x0a,0x40,0xa5,
+0xb0,0x00,0x21,0x70,0xe7,0x0b,0x00,0xe0,0x71,0x0b,0xb1,0xdf,0xed,0xff,0xf4,0xbb,
+0x06,0x66,0x65,0x43,0x0b,0xb0,0x30,0x00,0xf1,0x1f,0x88,0x00,0x00,0x9e,0xff,0xd7,
+0x00,0x00,0xaf,0x63,0x38,0xf6,0x00,0x0f,0x90,0x00,0x0c,0xb0,0x00,0xdc,0x10,0x02,
+0xf9,0x00,0x04,0xff,0xde,0xfd,0x10,0x00,0x00,0x45,0x53,0x00,0x00,0x64,0x22,0x00,
+0x06,0x00,0x00,0x2d,0xff,0xf0,0x02,0xf4,0x63,0x00,0x80,0x2f,0x40,0x0b,0xff,0xff,
+0xff,0xb1,0xf4,0xfb,0x02,0xf1,0x28,0x42,0x1f,0x40,0x00,0x04,0xcc,0x70,0x01,0xf5,
+0x00,0x03,0xfb,0x9f,0x70,0x1f,0x85,0x30,0xad,0x00,0x8d,0x01,0xff,0xfc,0x0d,0x90,
+0x05,0xf0,0x1f,0x50,0x00,0xc9,0x00,0x6f,0x01,0xf5,0x00,0x08,0xe1,0x0c,0xb0,0x1f,
+0x50,0x00,0x1d,0xff,0xe3,0x01,0xf5,0x00,0x00,0x05,0x51,0x00,0x1f,0x50,0xb4,0x01,
+0x11,0xf5,0x4e,0x00,0x22,0x0f,0x40,0xfd,0x01,0x40,0x00,0x00,0x64,0x31,0x09,0x00,
+0xf0,0x07,0x1c,0xef,0xa0,0x05,0xf0,0x00,0x37,0x66,0x66,0x61,0x6f,0x00,0x07,0xbb,
+0xbb,0xcc,0x36,0xf0,0x00,0x00,0x6a,0x93,0xa5,0x02,0xf0,0x14,0x9f,0x8b,0xf2,0x05,
+0xff,0xf7,0x0f,0x70,0x0e,0x70,0x5f,0x66,0x20,0xe8,0x00,0xe7,0x05,0xf0,0x00,0x07,
+0xfb,0xde,0x10,0x5f,0x00,0x00,0x04,0x76,0x10,0x04,0xe0,0x00,0x00,0x23,0x44,0x06,
+0x01,0x24,0x0e,0xff,0x2b,0x03,0x21,0x7f,0x00,0xcf,0x01,0x12,0xf0,0x94,0x02,0x11,
+0x00,0x4d,0x01,0x70,0x70,0x00,0x00,0x53,0x20,0x00,0x03,0xd0,0x00,0xf0,0x05,0xb0,
+0x06,0xf0,0x00,0x14,0x33,0x43,0x30,0x6f,0x10,0x0a,0xff,0xff,0xff,0x46,0xf1,0x00,
+0x00,0x48,0x71,0x1a,0x03,0xf3,0x0e,0x7f,0x9c,0xe1,0x06,0xf4,0x41,0x0e,0x80,0x0f,
+0x60,0x6f,0xff,0x80,0xe7,0x00,0xe6,0x06,0xf2,0x00,0x0a,0xd4,0x7f,0x30,0x6f,0x00,
+0x00,0x1a,0xed,0x60,0x27,0x03,0x11,0x6f,0x31,0x03,0x2b,0x05,0xe0,0x65,0x00,0x50,
+0x7f,0xff,0xff,0xff,0x20,0x85,0x01,0x24,0x54,0x40,0x41,0x02,0xf0,0x07,0x2f,0xdb,
+0x70,0x01,0x60,0x00,0x00,0x46,0x74,0x00,0x6f,0x00,0x0b,0xff,0xff,0xfe,0x46,0xf0,
+0x00,0x13,0x34,0x33,0x4e,0x00,0xf1,0x08,0x2c,0xff,0x90,0x06,0xf5,0x51,0x0d,0xd5,
+0x7f,0x50,0x6f,0xff,0x70,0xf6,0x00,0xd8,0x06,0xf0,0x00,0x0c,0xb3,0x5f,0x40,0x68,
+0x00,0x61,0x70,0x05,0xf0,0x00,0x00,0x24,0x87,0x03,0xb1,0x0c,0xff,0xff,0xff,0xf0,
+0x00,0x00,0x02,0x22,0x22,0x7f,0xfc,0x03,0x00,0x0d,0x00,0xf0,0x0d,0xea,0x11,0x11,
+0x10,0x00,0x00,0x0d,0xfe,0xee,0xff,0xf4,0x00,0x00,0x25,0x55,0x54,0x44,0x00,0x00,
+0x01,0xca,0x95,0x00,0x16,0x00,0x00,0x06,0x88,0xa3,0x00,0xf1,0x34,0x8d,0xdd,0xdd,
+0xc3,0x6f,0x00,0x02,0x55,0x55,0x55,0x16,0xf0,0x00,0x01,0xae,0xd7,0x00,0x5f,0x44,
+0x10,0xbd,0x58,0xf4,0x05,0xff,0xf8,0x0f,0x60,0x0e,0x80,0x5f,0x11,0x00,0xd9,0x01,
+0xf6,0x05,0xf0,0x00,0x04,0xfe,0xfc,0x00,0x5f,0x00,0x00,0x01,0x33,0x00,0x01,0x70,
+0x00,0x00,0x26,0x66,0x66,0x65,0x00,0x00,0x0a,0xfe,0xee,0xde,0xf0,0x00,0x00,0xad,
+0xe4,0x00,0x21,0x0a,0xd0,0x18,0x04,0xb1,0xaf,0xff,0xff,0xff,0x00,0x00,0x01,0x44,
+0x44,0x44,0x20,0xa7,0x01,0x15,0x01,0xa7,0x01,0x13,0x77,0xa7,0x01,0x14,0xbb,0xa7,
+0x01,0x80,0x21,0x00,0x9e,0x8b,0xf2,0x06,0xff,0xf8,0xa7,0x01,0x78,0x6f,0x43,0x00,
+0xe8,0x00,0xe7,0x06,0xa7,0x01,0xe5,0x01,0x80,0x00,0x00,0x8a,0x00,0x00,0x4f,0x00,
+0x00,0x0a,0xd4,0x44,0x58,0x5b,0x00,0x30,0x0a,0xc0,0x00,0xf1,0x00,0x12,0x9f,0x68,
+0x00,0x4f,0x45,0x55,0x54,0x20,0xd0,0x00,0x1a,0x31,0x10,0x00,0xe9,0xd0,0x00,0x31,
+0x05,0xfd,0xed,0xd0,0x00,0xf0,0x06,0x44,0x00,0x03,0xd0,0x00,0x00,0x02,0x9c,0xdc,
+0x70,0x00,0x00,0x02,0xfc,0x76,0x8e,0xb0,0x00,0x00,0x7f,0x10,0xdb,0x01,0xb0,0x06,
+0xf4,0x00,0x0a,0xf0,0x00,0x00,0x0c,0xfe,0xdf,0xf7,0x0d,0x02,0x14,0x55,0x20,0x05,
+0xf0,0x34,0x31,0x05,0xfe,0xd6,0x07,0xc0,0xe6,0x00,0x35,0x52,0x08,0xd0,0xe7,0x7d,
+0xdd,0xdd,0xb8,0xd0,0xe7,0x26,0x66,0x66,0x57,0xd0,0xe7,0x00,0x9e,0xc3,0x07,0xd0,
+0xe7,0x07,0xf6,0xbe,0x07,0xe5,0xf7,0x0c,0xa0,0x2f,0x47,0xfd,0xf7,0x0d,0x80,0x0f,
+0x57,0xd0,0xe7,0x0c,0x90,0x1f,0x47,0xd0,0xe7,0x08,0xe4,0x9f,0x17,0xd0,0xe7,0x00,
+0xbf,0xe5,0x07,0xd0,0xe7,0x05,0x02,0x07,0x06,0x00,0x33,0x05,0x90,0xd6,0x5c,0x00,
+0x11,0x33,0xf2,0x03,0xf1,0x3a,0xaf,0xfa,0x03,0xc0,0xc6,0x05,0x66,0x65,0x45,0xf0,
+0xd7,0x3d,0xdd,0xdd,0xc5,0xf0,0xd8,0x00,0x39,0x83,0x05,0xf4,0xd8,0x04,0xfa,0xbf,
+0x25,0xff,0xf8,0x09,0xc0,0x0d,0x75,0xf0,0xd7,0x08,0xd0,0x0e,0x65,0xf0,0xd7,0x02,
+0xee,0xed,0x04,0xf0,0xd7,0x00,0x04,0x30,0x01,0x40,0x84,0x00,0x00,0x19,0xff,0xfb,
+0x30,0x00,0x00,0xce,0x63,0x4c,0xf2,0x00,0x02,0xf5,0x00,0x01,0xf6,0x00,0x02,0x03,
+0x00,0xf0,0x2a,0x00,0xbf,0x86,0x8e,0xe1,0x00,0x00,0x07,0xbd,0xb7,0x10,0x00,0x75,
+0x41,0x00,0x02,0x00,0x00,0x1b,0xde,0x90,0x05,0xf0,0x00,0x59,0x98,0x88,0x82,0x6f,
+0x21,0x05,0x88,0x89,0x99,0x26,0xff,0xf6,0x00,0x9d,0xc5,0x00,0x6f,0x32,0x00,0xad,
+0x47,0xf3,0x05,0xf0,0x00,0x0f,0x60,0x0d,0x80,0x5f,0xff,0x50,0x28,0x01,0x50,0xf5,
+0x40,0x05,0xfe,0xfc,0xde,0x01,0x5f,0x01,0x43,0x00,0x03,0xc0,0x28,0x01,0x16,0xf0,
+0x06,0x43,0x11,0x00,0x00,0x20,0x0d,0xff,0xf3,0x00,0x6e,0x00,0x00,0x22,0x00,0x07,
+0xe5,0xdd,0xdd,0xdd,0xb0,0x7e,0xe6,0x06,0xf3,0x1c,0x07,0xe0,0x01,0xac,0x80,0x00,
+0x7e,0x00,0xdd,0x9e,0xb0,0x07,0xe0,0x5f,0x10,0x4f,0x6d,0xee,0x08,0xd0,0x01,0xf6,
+0x6a,0xe0,0x8d,0x00,0x2f,0x30,0x6f,0x05,0xf3,0x08,0xf1,0x06,0xf0,0x0b,0xfd,0xf7,
+0x00,0x6f,0x00,0x05,0x73,0x66,0x06,0x11,0x6e,0x71,0x06,0x12,0xd0,0x20,0x01,0xf1,
+0x3d,0x77,0x65,0x00,0x02,0x10,0x05,0x9a,0x90,0x00,0xca,0x3d,0xdd,0xdd,0xd8,0x0c,
+0xa0,0x55,0x55,0x55,0x30,0xca,0x00,0x8f,0xfb,0x10,0x0c,0xa0,0x6f,0x54,0xea,0x7f,
+0xfa,0x09,0xc0,0x08,0xd1,0x5d,0xa0,0x7e,0x10,0xbb,0x00,0xca,0x01,0xdf,0xee,0x30,
+0x0c,0xa0,0x00,0x33,0x00,0x00,0x43,0x00,0x04,0x66,0x66,0x66,0x20,0x00,0xef,0xee,
+0xdd,0xf8,0x00,0x0f,0x80,0x00,0x0e,0x80,0x00,0xf8,0x00,0x00,0xe8,0xfd,0x03,0x30,
+0x70,0x00,0x24,0x92,0x06,0xa0,0x9b,0x98,0x00,0x02,0x50,0x03,0x78,0x81,0x00,0x8e,
+0x58,0x00,0x20,0x08,0xe0,0x58,0x00,0xf2,0x2f,0x8e,0x00,0x8f,0xfc,0x20,0x08,0xe0,
+0x6f,0x42,0xcb,0x5d,0xfe,0x09,0xc0,0x07,0xe1,0x6b,0xe0,0x7f,0x20,0xbc,0x00,0x8e,
+0x01,0xdf,0xff,0x40,0x08,0xe0,0x00,0x34,0x10,0x00,0x5b,0x00,0x00,0x4a,0xdd,0xb6,
+0x00,0x00,0x5f,0xa6,0x69,0xf8,0x00,0x0b,0xd0,0x00,0x0a,0xe0,0x00,0xae,0x20,0x00,
+0xcd,0x00,0x02,0xef,0xdd,0xff,0x40,0x0f,0x05,0xf0,0x1d,0xbd,0xb7,0x00,0x20,0x41,
+0x00,0x26,0x73,0x03,0xf1,0xd8,0x3f,0xff,0xfe,0xd3,0xf2,0xe8,0x03,0x35,0x63,0x33,
+0xf2,0xd8,0x00,0xcf,0xfd,0x03,0xf2,0xd8,0x08,0xe1,0x1f,0xff,0xf2,0xd8,0x0a,0xb0,
+0x0d,0xa7,0xf2,0xd8,0x06,0xf6,0x7f,0x18,0x00,0xf3,0x08,0x8d,0xd7,0x02,0xe1,0xb6,
+0x00,0x00,0x34,0x44,0x44,0x40,0x00,0x07,0xff,0xff,0xff,0xf5,0x00,0x00,0x12,0x22,
+0x23,0xf6,0x0c,0x00,0x20,0x08,0xf2,0xcb,0x03,0xc0,0x08,0xfe,0xef,0xff,0xfa,0x00,
+0x00,0x55,0x55,0x55,0x41,0x00,0x03,0x08,0xf0,0x27,0x20,0x00,0xae,0xff,0x00,0x08,
+0xe0,0x15,0x44,0x44,0x42,0x08,0xf0,0x4d,0xdd,0xdd,0xe8,0x08,0xf0,0x00,0x28,0x94,
+0x02,0x6b,0xe0,0x03,0xfb,0x9f,0x68,0xee,0xe0,0x09,0xd0,0x0a,0xc0,0x07,0xe0,0x09,
+0xc0,0x09,0xd1,0x39,0xe0,0x05,0xf6,0x5e,0x99,0xff,0xe0,0x00,0x6d,0xea,0x10,0x19,
+0xf6,0x04,0x00,0xad,0x08,0x80,0x09,0xa0,0x00,0x07,0xd0,0x00,0x0b,0xc0,0x56,0x05,
+0x20,0x0b,0xc1,0x60,0x00,0x12,0x0a,0x37,0x04,0xf0,0x27,0x33,0x33,0x33,0x20,0x00,
+0x56,0x43,0x00,0x00,0x10,0x08,0xce,0xd1,0x00,0x8d,0x29,0x99,0x88,0x85,0x09,0xd1,
+0x77,0x77,0x88,0x50,0x9d,0x00,0x7e,0xea,0x17,0xff,0xd0,0x5f,0x64,0xda,0x15,0xbd,
+0x09,0xc0,0x07,0xe0,0x08,0xd0,0x7e,0x00,0xac,0x7f,0xfd,0x01,0xde,0xdf,0x41,0x4a,
+0xd0,0x18,0x01,0x16,0x7b,0x18,0x01,0x11,0xf7,0x18,0x01,0x60,0xd0,0x00,0xae,0x10,
+0x00,0xdc,0x18,0x01,0x13,0xfe,0x18,0x01,0x30,0x01,0x53,0x21,0x80,0x00,0x50,0x3d,
+0xff,0xf2,0x00,0x00,0xf4,0x07,0x42,0x11,0x00,0x00,0x6f,0xaa,0x08,0xf1,0x02,0x11,
+0x25,0x53,0x11,0x00,0x00,0x00,0x9f,0xee,0xfa,0x00,0x00,0x00,0x5f,0x40,0x03,0xf6,
+0x30,0x05,0x00,0x03,0x08,0x50,0x3f,0xa6,0x6b,0xf3,0x00,0x5b,0x00,0x11,0xa3,0x12,
+0x02,0x02,0x79,0x07,0x10,0x9d,0x2c,0x00,0x02,0x0b,0x08,0x40,0x44,0x44,0x33,0x33,
+0x5d,0x08,0x30,0x87,0x55,0x10,0xa4,0x07,0xf0,0x06,0xcd,0xd4,0x00,0x00,0x00,0xac,
+0xbb,0xbb,0xbb,0x30,0x00,0x04,0x67,0x99,0x76,0x61,0x00,0x00,0x07,0xfe,0xef,0x35,
+0x00,0x90,0xf8,0x00,0x3f,0x40,0x00,0x00,0x0d,0xd7,0x6a,0x7c,0x00,0xf0,0x1c,0x17,
+0xdf,0x83,0x00,0x00,0x6a,0xa9,0x9d,0xe9,0x99,0xa9,0x03,0x67,0x77,0x77,0x77,0x76,
+0x50,0x00,0xbe,0xee,0xee,0xee,0x20,0x00,0x03,0x55,0x55,0x57,0xf3,0x00,0x00,0x9e,
+0xee,0xee,0xef,0x30,0x00,0x0d,0xd5,0x55,0x55,0x40,0xad,0x09,0x00,0xc4,0x08,0x27,
+0x01,0x55,0xb2,0x05,0x40,0x00,0x1f,0xfd,0xd3,0x07,0x00,0x31,0x24,0x55,0x10,0x4e,
+0x06,0x00,0x64,0x05,0x30,0x34,0x45,0x54,0x38,0x09,0x30,0x5e,0xff,0xe7,0xb3,0x06,
+0x20,0x90,0x07,0xb6,0x00,0xf1,0x05,0xfa,0x21,0x7f,0x20,0x00,0x00,0x04,0xdf,0xfe,
+0x70,0x00,0x01,0x22,0x22,0xae,0x22,0x22,0x10,0xaf,0xff,0xe6,0x08,0xf0,0x04,0x11,
+0x12,0x44,0x31,0x11,0x00,0x00,0x1b,0xff,0xff,0xd2,0x00,0x00,0x09,0xf3,0x00,0x2c,
+0xc0,0x00,0x2e,0x01,0x21,0xbd,0x00,0x47,0x02,0x10,0x50,0xa6,0x07,0x01,0xb7,0x08,
+0xf0,0x16,0x55,0x43,0x00,0x06,0x10,0x00,0x00,0x9d,0xee,0x00,0x0f,0x70,0x00,0x27,
+0x77,0x76,0x63,0x0f,0x70,0x00,0x3a,0xaa,0xaa,0xa7,0x0f,0x70,0x00,0x00,0x5b,0xc9,
+0x10,0x0e,0x70,0x00,0x05,0xf8,0x6d,0x2b,0x09,0xf0,0x0a,0x0a,0xb0,0x06,0xf0,0x0e,
+0xec,0xa0,0x08,0xd0,0x09,0xd0,0x0e,0xb7,0x50,0x01,0xee,0xdf,0x50,0x0e,0x80,0x00,
+0x00,0x04,0x41,0x00,0x07,0x00,0x20,0x05,0xc0,0x07,0x00,0x60,0x13,0x39,0xe4,0x57,
+0x3e,0x80,0x4f,0x05,0x31,0xda,0x3e,0x80,0xc6,0x00,0x22,0x0e,0x80,0x2e,0x0a,0x16,
+0x70,0xd8,0x09,0x02,0xab,0x06,0xf0,0x29,0xec,0xb1,0x00,0x61,0x00,0x00,0x15,0x76,
+0x00,0x1f,0x60,0x03,0xff,0xff,0xff,0xa1,0xf6,0x00,0x03,0x36,0x75,0x21,0x0f,0x60,
+0x00,0x2d,0xfd,0xfa,0x00,0xf6,0x00,0x09,0xd0,0x05,0xf1,0x0f,0xff,0x80,0x8e,0x21,
+0x8f,0x00,0xf9,0x52,0x00,0xaf,0xfd,0x40,0x1f,0x60,0x00,0x00,0x6f,0x12,0x41,0xf6,
+0x95,0x01,0x92,0xfd,0x3f,0x50,0x01,0x33,0x22,0x20,0x00,0x40,0xec,0x06,0x72,0x40,
+0x00,0x02,0x54,0x44,0x45,0xf5,0xe9,0x06,0x11,0x50,0xda,0x08,0x12,0xf5,0x65,0x00,
+0xf1,0x43,0x00,0x00,0x00,0x7e,0xcb,0x30,0x03,0x00,0x00,0x01,0x57,0x71,0x00,0xf5,
+0x00,0x3e,0xff,0xee,0xec,0x1f,0x60,0x00,0x34,0x68,0x54,0x30,0xf6,0x00,0x01,0xdf,
+0xff,0x80,0x0f,0x60,0x00,0x8f,0x30,0x7f,0x10,0xf8,0x31,0x08,0xe1,0x07,0xf0,0x0f,
+0xff,0x90,0x1c,0xff,0xf6,0x00,0xf7,0x10,0x00,0x07,0xf0,0x13,0x0f,0x60,0x08,0xee,
+0xff,0xff,0xf3,0xf6,0x00,0x25,0x55,0x43,0x10,0x0f,0x60,0x00,0x02,0xb0,0x00,0x00,
+0xc3,0x00,0x00,0x5f,0x47,0x05,0x21,0x05,0xf3,0xfa,0x06,0x51,0x4f,0xff,0xff,0xff,
+0x90,0xd0,0x02,0x60,0x30,0x00,0x00,0x7d,0xba,0x10,0x68,0x00,0x40,0x68,0x81,0x00,
+0xf6,0xb4,0x0a,0xf4,0x2e,0xfc,0x0f,0x60,0x00,0x34,0x89,0x73,0x20,0xf6,0x00,0x03,
+0xfd,0xbf,0xb0,0x0f,0x72,0x00,0x9d,0x00,0x5f,0x10,0xff,0xf9,0x05,0xf9,0x8d,0xd0,
+0x0f,0x82,0x00,0x04,0xbf,0x61,0x00,0xf6,0x00,0x6b,0xbd,0xfc,0xde,0x3f,0x60,0x02,
+0x66,0x65,0x43,0x10,0x61,0x00,0x00,0x5e,0xee,0xee,0xef,0x70,0x00,0x01,0x66,0x55,
+0x55,0xf8,0x0d,0x00,0xff,0x03,0x07,0xf5,0x55,0x65,0x51,0x00,0x00,0x7f,0xee,0xee,
+0xef,0xe0,0x00,0x00,0x56,0x66,0x65,0x52,0x3f,0x01,0x05,0x60,0xa0,0xf6,0x00,0x03,
+0x34,0x64,0x3f,0x01,0xf5,0x0d,0x1c,0xff,0xf9,0x00,0xf6,0x00,0x08,0xe3,0x28,0xf1,
+0x0f,0xa6,0x20,0x8d,0x21,0x7f,0x00,0xff,0xe8,0x01,0xbf,0xfd,0x50,0x0f,0x60,0x00,
+0x00,0x7f,0x3f,0x01,0x80,0x60,0x01,0x33,0x23,0x54,0x30,0x72,0x00,0xff,0x03,0x80,
+0xf6,0x00,0x00,0x04,0xf8,0x00,0x08,0xf2,0xdd,0x00,0x00,0xc1,0x02,0x51,0x01,0xed,
+0x76,0x7d,0xe1,0x90,0x05,0xf1,0x3b,0x81,0x00,0x00,0x00,0x46,0x43,0x00,0x01,0x30,
+0x07,0xde,0xe2,0x00,0x7e,0x17,0x77,0x76,0x64,0x07,0xe2,0xaa,0xaa,0xaa,0x80,0x7e,
+0x00,0x4b,0xda,0x20,0x07,0xe0,0x3f,0x96,0xcd,0x00,0x7e,0x07,0xe0,0x03,0xf2,0x07,
+0xe0,0x6f,0x10,0x6f,0x00,0x7e,0x00,0xcf,0xdf,0x70,0x07,0xe0,0x00,0x35,0x20,0x00,
+0x7e,0x00,0x03,0xf1,0x00,0x07,0xe0,0x33,0x7f,0x66,0x85,0x7e,0x5f,0xff,0xfe,0xda,
+0x57,0x14,0x04,0x11,0x7e,0x5e,0x03,0x12,0xe0,0x08,0x02,0x0f,0xa8,0x03,0x22,0x11,
+0xa5,0xa8,0x03,0x90,0x6c,0xdd,0xb4,0x00,0x00,0x00,0x0c,0xa0,0x0a,0x3b,0x0a,0x30,
+0xca,0x00,0xbb,0xa8,0x03,0x50,0xfe,0xef,0xfe,0xed,0x02,0x31,0x0c,0x06,0x05,0x0c,
+0x31,0x4f,0xfd,0xd0,0x40,0x03,0x10,0x54,0xcf,0x09,0x60,0xdd,0xdd,0xdd,0xc6,0x00,
+0x00,0x88,0x03,0x41,0x30,0x00,0x00,0x2a,0xe9,0x03,0x80,0x2f,0xb6,0x5a,0xf3,0x00,
+0x00,0x05,0xf0,0xb9,0x05,0x40,0x00,0x2f,0x94,0x49,0x33,0x02,0x24,0x5c,0xef,0x30,
+0x07,0x40,0x01,0x08,0xff,0xff,0xaf,0x04,0x63,0x14,0x44,0x4b,0xe4,0x43,0x32,0x10,
+0x04,0x00,0x98,0x0d,0x14,0x00,0xa2,0x0b,0x00,0xf0,0x0b,0x01,0x6c,0x02,0x02,0x6e,
+0x00,0x00,0x52,0x03,0xf1,0x24,0x04,0x56,0x88,0x54,0x07,0xd0,0x0b,0xcc,0xcc,0xcb,
+0x18,0xe0,0x00,0x6b,0xdc,0x60,0x07,0xe0,0x04,0xf6,0x46,0xf3,0x07,0xe0,0x04,0xf7,
+0x48,0xf3,0x07,0xe0,0x00,0x8e,0xfd,0x70,0x07,0xe0,0x15,0x55,0x56,0x79,0x67,0xe0,
+0x5e,0xef,0xfd,0xca,0x47,0xe0,0x00,0x0a,0xb0,0x39,0x03,0xf0,0x04,0xfe,0xee,0xff,
+0xc0,0x00,0x04,0x66,0x55,0x5b,0xe0,0x00,0x1d,0xee,0xee,0xff,0xe0,0x00,0x2f,0x95,
+0x7d,0x08,0x50,0x1f,0xfe,0xef,0xff,0xf1,0x30,0x04,0x06,0xd5,0x00,0x30,0x2f,0xfd,
+0xd2,0x07,0x00,0x14,0x14,0xd5,0x00,0x15,0xd6,0xd5,0x00,0xe1,0x29,0xcd,0xa4,0x00,
+0x00,0x00,0x1e,0xc6,0x59,0xf4,0x00,0x00,0x04,0xf2,0x78,0x03,0x30,0x2f,0xa4,0x37,
+0xd5,0x00,0x14,0x4c,0xd5,0x00,0x00,0xa9,0x04,0x00,0xc3,0x0d,0x70,0xf1,0x14,0x5c,
+0xd4,0x47,0xf5,0x32,0x41,0x0d,0x20,0x4f,0x20,0x4e,0x0d,0x21,0x04,0xf2,0x34,0x0c,
+0x21,0x3f,0x10,0xd4,0x00,0x00,0xe3,0x02,0xf0,0x34,0x18,0x65,0x20,0x00,0x00,0x01,
+0xac,0xd8,0x00,0xaa,0x07,0x99,0x99,0x88,0x1a,0xc0,0x89,0x99,0x99,0x92,0xac,0x00,
+0x5c,0xfe,0x70,0x0a,0xc0,0x2f,0x82,0x5f,0x50,0xac,0x03,0xf3,0x00,0xf7,0x0a,0xc0,
+0x0b,0xeb,0xed,0x10,0xac,0x00,0x03,0x54,0x01,0x1a,0xc4,0xde,0xee,0xff,0xf9,0xac,
+0x15,0x55,0x54,0x30,0x0a,0xc0,0x01,0xc1,0x00,0x00,0x57,0x00,0x4f,0xb4,0x00,0x71,
+0x04,0xf5,0x22,0x22,0x31,0x00,0x3f,0x76,0x0c,0x10,0x11,0x34,0x03,0x00,0x01,0x00,
+0xf3,0x31,0x20,0x0e,0xfd,0xd5,0x00,0x7e,0x00,0x14,0x55,0x20,0x07,0xe5,0xcc,0xcc,
+0xcc,0xb0,0x7e,0x26,0x66,0x66,0x66,0x07,0xe0,0x02,0xce,0xb1,0x00,0x7f,0x00,0xec,
+0x6d,0xc0,0x07,0xf0,0x5f,0x10,0x3f,0x20,0x7f,0x08,0xd0,0x01,0xf4,0x07,0xf0,0x7e,
+0x00,0x2f,0x30,0x7f,0x03,0xf4,0x09,0xe0,0x06,0xf0,0x09,0xff,0xf5,0x00,0x6f,0x00,
+0x03,0x41,0xbf,0x07,0x01,0x31,0x0e,0x00,0xfc,0x0a,0x0d,0x01,0x00,0x20,0x49,0xdc,
+0x06,0x00,0x20,0x16,0xbf,0xc7,0x09,0x20,0x03,0x8d,0xc7,0x01,0x01,0x2d,0x0f,0x01,
+0x08,0x00,0x00,0x06,0x00,0x11,0xc7,0x08,0x00,0x30,0xfa,0x51,0x00,0x08,0x00,0x31,
+0x84,0x00,0x00,0x08,0x00,0x1f,0x00,0x08,0x00,0x06,0x21,0x2b,0xee,0x08,0x00,0x00,
+0xee,0x0d,0x21,0x2b,0xee,0x08,0x00,0x30,0xfd,0xdf,0xff,0x18,0x00,0x51,0xff,0xb2,
+0xdf,0xff,0xfd,0x72,0x00,0x80,0x2b,0xff,0xb2,0x00,0x00,0x00,0x00,0x00,0xf4,0x09,
+0xd0,0x0f,0xff,0xff,0xff,0xff,0xf0,0x0d,0xff,0xff,0xc8,0x88,0x88,0x8c,0xff,0xff,
+0xf0,0x0f,0x80,0x00,0x00,0x08,0xf0,0x0f,0x08,0x00,0x20,0xff,0xff,0x08,0x00,0x00,
+0x18,0x00,0x64,0xec,0xcc,0xcc,0xce,0xf0,0x0f,0x08,0x00,0x06,0x18,0x00,0x0c,0x30,
+0x00,0x02,0x48,0x00,0x04,0x58,0x00,0x30,0xdf,0xff,0x73,0x09,0x00,0x52,0xfd,0xff,
+0xff,0xa5,0xff,0x01,0x00,0x02,0x08,0x00,0x04,0x18,0x00,0x13,0x00,0x01,0x00,0x0f,
+0x28,0x00,0x3b,0x22,0x0a,0xb1,0x08,0x00,0x21,0xbf,0xfc,0x07,0x00,0x32,0x0b,0xff,
+0xfb,0x0f,0x00,0x40,0xff,0xc0,0x1b,0xa0,0x0f,0x00,0x41,0xfc,0x00,0xcf,0xfb,0x0f,
+0x00,0x40,0x00,0xbf,0xff,0xb0,0x0f,0x00,0x40,0x00,0x0c,0xff,0xfb,0x0f,0x00,0x42,
+0x00,0x00,0xcf,0xff,0x2d,0x00,0x42,0x0c,0xff,0xff,0xb0,0x35,0x00,0x22,0xfb,0x00,
+0x45,0x00,0x01,0x0f,0x00,0x10,0x03,0x04,0x00,0xf0,0x09,0x08,0xfc,0x10,0x00,0x1c,
+0xf8,0xff,0xfc,0x10,0x1c,0xff,0xf5,0xff,0xfc,0x2c,0xff,0xf5,0x05,0xff,0xff,0xff,
+0xf5,0x00,0x05,0x05,0x00,0x81,0x00,0x1d,0xff,0xfd,0x10,0x00,0x1c,0xff,0x1e,0x00,
+0x40,0xf9,0xff,0xfc,0x1c,0x1e,0x00,0x20,0xfc,0xdf,0x1e,0x00,0xb0,0xd1,0xa4,0x00,
+0x00,0x04,0xa1,0x00,0x00,0x00,0x4f,0xe0,0x4b,0x00,0xf0,0x1a,0x02,0x10,0x6f,0xf1,
+0x03,0x10,0x00,0x00,0x5f,0xd0,0x6f,0xf1,0x3f,0xd1,0x00,0x03,0xff,0xf1,0x6f,0xf1,
+0x5f,0xfd,0x00,0x0d,0xff,0x40,0x6f,0xf1,0x09,0xff,0x70,0x4f,0xf7,0x00,0x6f,0xf1,
+0x00,0xcf,0xe0,0x9f,0xf0,0x08,0x00,0x40,0x5f,0xf3,0xbf,0xc0,0x08,0x00,0x40,0x2f,
+0xf5,0xbf,0xc0,0x40,0x00,0x31,0x1f,0xf6,0xaf,0x45,0x00,0x40,0x4f,0xf4,0x6f,0xf4,
+0x08,0x00,0xf0,0x0d,0xaf,0xf0,0x0f,0xfe,0x10,0x00,0x00,0x05,0xff,0xa0,0x06,0xff,
+0xd3,0x00,0x00,0x7f,0xff,0x20,0x00,0x9f,0xff,0xda,0xbe,0xff,0xf4,0x00,0x00,0x06,
+0x18,0x01,0x81,0x30,0x00,0x00,0x00,0x17,0xbd,0xca,0x50,0xcb,0x00,0x22,0x8b,0xb8,
+0xd3,0x00,0x20,0xff,0xff,0x06,0x00,0xf2,0x01,0x30,0x06,0xff,0xff,0x60,0x03,0x00,
+0x04,0xfd,0xdf,0xff,0xff,0xfd,0xef,0x40,0x0d,0x57,0x01,0xe0,0xd0,0x4f,0xff,0xff,
+0xf9,0x9f,0xff,0xff,0xf4,0x08,0xff,0xff,0x20,0x02,0xef,0x01,0x74,0xff,0xf9,0x00,
+0x00,0x9f,0xff,0x00,0x08,0x00,0x04,0x18,0x00,0x04,0x28,0x00,0x04,0x38,0x00,0x20,
+0x04,0xfe,0x48,0x00,0x24,0xdf,0x40,0x58,0x00,0x05,0x68,0x00,0x06,0x78,0x00,0x50,
+0x03,0xdd,0x30,0x3f,0xf3,0x09,0x00,0x40,0x6f,0xff,0xf5,0x4f,0xbf,0x00,0xd0,0x09,
+0xff,0x99,0xff,0xbf,0xf4,0x00,0x00,0x01,0xbf,0xf6,0x22,0x6f,0xb4,0x00,0xf0,0x0e,
+0x2d,0xfe,0x35,0xff,0x53,0xef,0xf4,0x00,0x04,0xff,0xc1,0x8f,0xff,0xf8,0x1c,0xfe,
+0x40,0x7f,0xfa,0x1a,0xff,0xff,0xff,0xa1,0xaf,0xf7,0xcf,0x82,0xdf,0xd0,0x00,0x41,
+0x28,0xfc,0x14,0x0e,0x70,0x00,0x51,0xe0,0x41,0x00,0x0f,0xff,0x6c,0x02,0x72,0x00,
+0x00,0x0f,0xff,0xf9,0x00,0x8f,0x09,0x00,0x1b,0xf8,0x09,0x00,0x71,0x0e,0xff,0xf6,
+0x00,0x6f,0xff,0xe0,0x43,0x02,0x18,0xfd,0xfe,0x00,0x0f,0x08,0x00,0x0d,0x10,0x4f,
+0x5c,0x00,0x10,0xf4,0x35,0x02,0x12,0xff,0x12,0x02,0x13,0xbf,0x21,0x02,0x19,0x0b,
+0x21,0x02,0x60,0xdf,0xff,0xfc,0x1b,0xb1,0xcf,0x98,0x02,0x4b,0xff,0xc2,0x2c,0xff,
+0x01,0x00,0x30,0xf0,0xe0,0xff,0xb5,0x00,0x01,0xa0,0x02,0xa1,0x04,0xef,0xff,0xff,
+0xff,0xfe,0x40,0x00,0x00,0x1e,0x11,0x00,0x50,0xe1,0x00,0x00,0xaf,0xb0,0x4e,0x00,
+0xe1,0xfa,0x00,0x05,0xff,0x10,0x00,0x00,0x00,0x01,0xff,0x50,0x1e,0xf6,0x00,0x1d,
+0x01,0x11,0xe1,0x1a,0x00,0x00,0x1c,0x00,0x40,0xff,0xff,0xff,0x70,0x71,0x01,0x01,
+0xf1,0x00,0x03,0xf0,0x00,0x0f,0x01,0x00,0x06,0x13,0x8f,0x08,0x00,0xf1,0x1d,0xf8,
+0x00,0x00,0x06,0xbd,0xda,0x50,0x02,0xff,0x00,0x05,0xef,0xff,0xff,0xfe,0x42,0xff,
+0x00,0x7f,0xff,0xa7,0x7b,0xff,0xf9,0xff,0x05,0xff,0xc1,0x00,0x00,0x2c,0xff,0xff,
+0x0e,0xfc,0x00,0x00,0x02,0x22,0xdf,0xff,0x5f,0xf2,0x00,0x54,0x00,0x22,0x8f,0xb0,
+0x08,0x00,0x1b,0x00,0x01,0x00,0x02,0x5d,0x01,0x22,0x0b,0xf8,0x08,0x00,0xd0,0x2f,
+0xf4,0xff,0xfd,0x22,0x20,0x00,0x00,0xcf,0xe0,0xff,0xff,0xc2,0x48,0x00,0xf5,0x08,
+0x40,0xff,0x9f,0xff,0xb7,0x6a,0xff,0xf7,0x00,0xff,0x24,0xdf,0xff,0xff,0xfe,0x50,
+0x00,0xff,0x20,0x05,0xac,0xdb,0x60,0x3f,0x00,0x10,0x8d,0x29,0x04,0x5e,0x00,0x00,
+0x8f,0xff,0xdf,0xad,0x00,0x01,0x14,0x00,0x02,0x57,0x02,0x22,0x09,0xff,0x2c,0x00,
+0x28,0x00,0x00,0x3a,0x00,0x02,0x3c,0x00,0x00,0x3e,0x00,0x01,0x9b,0x03,0x30,0xff,
+0x01,0x50,0x36,0x00,0x30,0x06,0xf7,0xff,0x38,0x00,0x11,0xbe,0x06,0x00,0x10,0xae,
+0x06,0x00,0x20,0x05,0xf8,0x4a,0x00,0x22,0x02,0x60,0x4c,0x00,0x03,0x4e,0x00,0x3a,
+0x00,0x00,0x9e,0xca,0x00,0x23,0x06,0x10,0x09,0x00,0x23,0x1f,0xd2,0x60,0x00,0x31,
+0x03,0xee,0x10,0x63,0x00,0x41,0x0a,0xb1,0x2f,0xb0,0x66,0x00,0x41,0x05,0xfc,0x07,
+0xf4,0x4b,0x00,0x42,0x50,0x5f,0x60,0xf9,0x6c,0x00,0x32,0x0d,0xc0,0xbd,0x69,0x00,
+0x33,0x09,0xf0,0x9f,0x09,0x00,0x24,0xe0,0x8f,0x1b,0x00,0x14,0xad,0x2d,0x00,0x11,
+0xe9,0x7b,0x00,0x41,0x05,0xfc,0x06,0xf4,0x7e,0x00,0x02,0x51,0x00,0x00,0x63,0x00,
+0x38,0x02,0xee,0x10,0x75,0x00,0x02,0x87,0x00,0x13,0x8f,0xa4,0x01,0x23,0xff,0xfc,
+0x09,0x01,0x21,0x20,0x2f,0x07,0x00,0x10,0xfc,0x79,0x04,0x12,0xee,0x10,0x00,0x60,
+0xfe,0x12,0xef,0xff,0xff,0xfc,0x24,0x02,0xe1,0x2e,0xff,0xff,0xfe,0x4e,0xfe,0x10,
+0x00,0x02,0xff,0xff,0xe1,0x02,0xc1,0x93,0x01,0x1b,0x10,0xac,0x02,0x09,0xfd,0x01,
+0x00,0xfc,0x01,0x20,0x4e,0x40,0x3b,0x02,0x11,0xfb,0x53,0x02,0x20,0xf1,0x00,0x9d,
+0x00,0x90,0x90,0x00,0x00,0x2f,0xff,0xff,0x30,0x00,0x0c,0x67,0x00,0x10,0x07,0x26,
+0x00,0x10,0x02,0x2c,0x00,0x11,0xf2,0xd5,0x00,0x20,0x9e,0xff,0x98,0x02,0x20,0xff,
+0x2f,0x06,0x00,0xf1,0x02,0xf2,0xbf,0xff,0xff,0xfe,0x9f,0xa1,0xbf,0xff,0xff,0x92,
+0xff,0xa2,0x2f,0xff,0xf2,0x04,0x03,0x03,0x43,0x02,0x9e,0xfe,0x92,0x6e,0x00,0xf0,
+0x06,0x30,0x00,0x01,0xcc,0xff,0x40,0x00,0x2d,0xff,0xff,0x40,0x03,0xef,0xff,0xff,
+0x40,0x3f,0xff,0xff,0xff,0x44,0x41,0x00,0x1a,0x9f,0xde,0x01,0x10,0xaf,0x05,0x00,
+0x10,0x45,0x05,0x00,0x34,0x40,0x4f,0xff,0x2d,0x00,0x00,0x37,0x00,0x00,0x41,0x00,
+0x08,0x99,0x01,0x23,0x8f,0x91,0xc7,0x00,0x12,0x70,0x07,0x00,0x22,0xfd,0x40,0xd5,
+0x00,0x22,0xfa,0x10,0xdc,0x00,0x13,0xf7,0xe3,0x00,0x13,0xd5,0xea,0x00,0x13,0xb2,
+0x4f,0x03,0x09,0x07,0x00,0x17,0xb2,0x23,0x00,0x12,0xf7,0x3f,0x00,0x17,0x20,0x4d,
+0x00,0x01,0x5b,0x00,0x3e,0x8e,0xa1,0x00,0x01,0x00,0x11,0x8f,0x26,0x04,0x00,0xe0,
+0x02,0x03,0x5f,0x00,0x0f,0x07,0x00,0x37,0x83,0x7f,0xff,0xf7,0x00,0x7f,0xff,0xf7,
+0x8f,0xee,0x01,0x0f,0x01,0x00,0x40,0x03,0x5b,0x00,0x01,0xc9,0x00,0xd1,0xcc,0x10,
+0x00,0x03,0xff,0xff,0xd2,0x00,0x04,0xff,0xff,0xfe,0x30,0xb6,0x01,0x10,0x04,0x1d,
+0x00,0x20,0x54,0xff,0x0c,0x01,0x0a,0x37,0x00,0x23,0xf9,0xff,0xb4,0x01,0x14,0xf3,
+0x2d,0x00,0x00,0x37,0x00,0x01,0x41,0x00,0x04,0x17,0x01,0x12,0x2d,0xb0,0x02,0x20,
+0x01,0xef,0x5a,0x06,0x00,0xd9,0x06,0x32,0xff,0xd1,0x00,0x22,0x07,0x26,0xfc,0x00,
+0x11,0x05,0x11,0xaf,0x5d,0x00,0x22,0x00,0x09,0x57,0x00,0x23,0x90,0x0f,0xf3,0x04,
+0x03,0xae,0x04,0x14,0x80,0x4d,0x00,0x12,0x0c,0x10,0x00,0x14,0xc0,0x20,0x00,0x04,
+0x08,0x00,0x03,0x18,0x00,0x00,0x7b,0x07,0x70,0x1a,0x40,0x00,0x00,0x01,0xdf,0xf0,
+0x6a,0x00,0x57,0xa0,0x00,0x01,0xdf,0xfa,0x09,0x00,0x80,0x0c,0xff,0xa0,0x00,0x00,
+0x0d,0xff,0x80,0x21,0x00,0x11,0xf8,0x8c,0x00,0x0b,0x0b,0x00,0x00,0x37,0x00,0x31,
+0x00,0x1b,0x50,0x5f,0x07,0x80,0x0f,0xfc,0x10,0x00,0x00,0x0a,0xff,0xc1,0x17,0x07,
+0x0d,0x0b,0x00,0x10,0xc0,0xef,0x03,0xa7,0xd0,0x00,0x00,0x8f,0xfd,0x10,0x00,0x08,
+0xff,0xd1,0x09,0x00,0x20,0x0f,0xfd,0x41,0x07,0x02,0x3a,0x08,0x32,0x04,0xff,0x40,
+0x7c,0x04,0x1f,0x80,0x07,0x00,0x04,0x7a,0x48,0x88,0x8c,0xff,0xc8,0x88,0x84,0x54,
+0x01,0x03,0x15,0x00,0x0f,0x38,0x00,0x09,0x03,0x5b,0x00,0x20,0x14,0x44,0x01,0x00,
+0x32,0x41,0xef,0xff,0x76,0x03,0x02,0x01,0x00,0x20,0x7b,0xbb,0x01,0x00,0x80,0xb7,
+0x00,0x00,0x05,0xad,0xff,0xda,0x50,0x2b,0x00,0x40,0xdf,0xfc,0x88,0xcf,0xbe,0x02,
+0xf1,0x18,0x7f,0xfe,0x40,0x00,0x04,0xef,0xf7,0x00,0x07,0xff,0xf4,0x00,0x9e,0x80,
+0x4f,0xff,0x70,0x4f,0xff,0xc0,0x00,0xaf,0xf8,0x0c,0xff,0xf4,0xdf,0xff,0x80,0x9a,
+0xff,0xfe,0x08,0xff,0xfd,0xdf,0xff,0x80,0xef,0x09,0x00,0x50,0x4f,0xff,0xc0,0x8f,
+0xff,0x1b,0x00,0x50,0x07,0xff,0xf4,0x08,0xee,0x2d,0x00,0x03,0x3f,0x00,0x17,0xf8,
+0x51,0x00,0x04,0x63,0x00,0x25,0x8c,0x20,0x59,0x09,0x14,0xe4,0x0a,0x00,0x90,0x1b,
+0xff,0x80,0x49,0xdf,0xfd,0xa5,0x00,0x00,0x47,0x08,0x72,0xff,0xd8,0x8c,0xff,0xd4,
+0x00,0x00,0x3f,0x00,0x11,0x4e,0x44,0x03,0xf1,0x12,0x1c,0xff,0x69,0xe8,0x04,0xff,
+0xf7,0x00,0x04,0xe3,0x00,0x9f,0xfe,0xff,0x80,0xcf,0xff,0x40,0x0d,0xff,0x70,0x05,
+0xff,0xff,0xe0,0x8f,0xff,0xd0,0x0d,0xff,0xf7,0x00,0x2d,0x0a,0x00,0x10,0x04,0x25,
+0x02,0xb1,0xaf,0xf8,0xcf,0xff,0x30,0x00,0x7f,0xff,0x40,0x00,0x06,0x93,0x03,0x10,
+0x08,0x4a,0x07,0x10,0x3e,0xcc,0x01,0x80,0x00,0x4d,0xff,0xc8,0x82,0x01,0xbf,0xf7,
+0x66,0x00,0x74,0x5a,0xdf,0xfc,0x10,0x08,0xff,0xb0,0x80,0x00,0x15,0x4e,0xed,0x09,
+0x27,0x02,0xc8,0x87,0x02,0x07,0x8b,0x09,0x00,0x6a,0x09,0x01,0xca,0x08,0x00,0x14,
+0x02,0x00,0xcd,0x01,0x03,0xac,0x00,0x12,0xf7,0xb0,0x02,0x32,0xff,0xd8,0x8d,0x1f,
+0x05,0x41,0x0a,0xff,0xa0,0x0a,0x6d,0x00,0x20,0x00,0x3f,0xe7,0x09,0x12,0xf3,0xbe,
+0x02,0x42,0xc0,0x0c,0xff,0xfc,0x44,0x00,0x21,0xd0,0x0d,0x48,0x00,0x12,0x0e,0xc2,
+0x08,0x20,0xe0,0x00,0x96,0x05,0x20,0xe2,0x2e,0x4d,0x03,0x10,0x02,0xcb,0x02,0x00,
+0xd3,0x02,0xb5,0x10,0x0a,0xff,0xff,0xff,0xe3,0x3e,0xff,0xff,0xff,0xa0,0x77,0x07,
+0x04,0xdc,0x02,0x07,0xde,0x02,0x02,0x01,0x00,0x14,0xd8,0x31,0x07,0x10,0x80,0x6e,
+0x04,0x11,0x07,0xf1,0x03,0x00,0x77,0x08,0xf1,0x0a,0xff,0xfd,0x78,0x8e,0xff,0x15,
+0xff,0xe8,0xff,0xe2,0x00,0x02,0xe5,0x4f,0xfe,0x20,0xfe,0x20,0x00,0x00,0x13,0xff,
+0xf3,0x00,0x52,0x9a,0x00,0x10,0x31,0x08,0x00,0xb0,0x02,0xef,0xf4,0x5e,0x20,0xfe,
+0x20,0x78,0x8e,0xff,0x51,0x28,0x00,0x04,0x38,0x00,0x04,0x48,0x00,0x04,0x58,0x00,
+0x0a,0x68,0x00,0x07,0x01,0x00,0x23,0x01,0xdd,0xa4,0x03,0x20,0xd1,0x00,0x0e,0x03,
+0x30,0xff,0xfd,0x10,0x0d,0x00,0xf0,0x05,0x99,0xff,0xd1,0x00,0x01,0xdf,0xf9,0x00,
+0x9f,0xfd,0x10,0x1d,0xff,0x90,0x00,0x09,0xff,0xd1,0xbf,0xf9,0x0b,0x06,0x30,0xfb,
+0x5f,0x90,0x24,0x07,0x1a,0xf5,0x44,0x00,0x03,0x15,0x00,0x03,0x23,0x00,0x03,0x31,
+0x00,0x03,0x3f,0x00,0x03,0x4d,0x00,0x04,0x5b,0x00,0x03,0x69,0x00,0x04,0x77,0x00,
+0x0c,0x01,0x00,0x24,0x1d,0xd1,0x97,0x00,0x40,0xdf,0xfd,0x10,0xef,0x16,0x0a,0x01,
+0x3e,0x04,0x11,0xaf,0x42,0x08,0x40,0xcf,0xcf,0xfc,0xfc,0xa6,0x03,0x62,0xf0,0x00,
+0x6b,0x1f,0xf1,0xb6,0x0a,0x00,0x01,0x04,0x00,0x0f,0x0a,0x00,0x02,0x01,0x24,0x00,
+0x01,0x0a,0x00,0x01,0x38,0x00,0x10,0x0f,0x6d,0x04,0x01,0x8a,0x04,0x10,0x0d,0x3a,
+0x03,0x00,0x60,0x00,0x0c,0x74,0x00,0x02,0xd2,0x05,0x02,0xa0,0x00,0x00,0x1d,0x06,
+0x16,0x10,0x20,0x07,0x0f,0x81,0x05,0x2e,0x06,0x5f,0x07,0x03,0x10,0x0c,0x05,0x95,
+0x02,0x04,0x0f,0x0a,0x03,0x1f,0x0a,0x04,0x1e,0x05,0x04,0x3f,0x0a,0x0f,0x6f,0x0a,
+0x14,0x60,0xdf,0xff,0xf0,0xdf,0xfd,0x0f,0xf8,0x01,0x01,0x65,0x0b,0x0f,0x47,0x0a,
+0x07,0x09,0x01,0x00,0x32,0x0a,0xea,0x62,0x30,0x03,0x01,0xa1,0x09,0x01,0xec,0x07,
+0x02,0x55,0x00,0x13,0x0f,0x1e,0x03,0x23,0x02,0xff,0x02,0x0d,0x43,0x03,0xef,0xff,
+0x70,0xe1,0x04,0x1a,0xf2,0x54,0x03,0x60,0x6f,0xff,0x30,0x00,0x00,0x02,0xb1,0x00,
+0xf0,0x00,0x90,0x00,0x02,0x8f,0xf3,0x00,0x6f,0xff,0xd0,0x00,0x0a,0xff,0xff,0xe4,
+0xbf,0x49,0x01,0x01,0xa8,0x04,0x10,0xd1,0x51,0x03,0x00,0x18,0x03,0x01,0x2e,0x00,
+0x31,0xff,0xfb,0x30,0x59,0x00,0x31,0xdb,0x72,0x00,0xdd,0x04,0x70,0xee,0x80,0x00,
+0x00,0x06,0x61,0x08,0x14,0x03,0xf0,0x02,0x2d,0xff,0xd0,0xef,0x33,0xfe,0x00,0x2e,
+0xff,0xf3,0x0e,0xf3,0x3f,0xe0,0x2e,0xff,0xf3,0x8f,0x01,0x10,0x6e,0x7f,0x03,0x10,
+0x8e,0x70,0x06,0x10,0x00,0xee,0x02,0x02,0x8d,0x03,0x20,0x2e,0xff,0x76,0x00,0x10,
+0x08,0x5f,0x00,0x10,0x30,0xe0,0x0a,0xc0,0xf6,0xef,0xff,0x30,0x00,0xef,0x33,0xfe,
+0x02,0xef,0xff,0x30,0x3c,0x00,0x00,0x08,0x00,0x10,0x8f,0x8f,0x03,0xa0,0xdf,0xfd,
+0x00,0x8e,0xe8,0x00,0x00,0x00,0x66,0x10,0x24,0x01,0x22,0xff,0x0d,0x17,0x08,0x22,
+0x0f,0xd1,0x07,0x00,0x30,0xfd,0xdf,0xf0,0x32,0x09,0x33,0x00,0xff,0xf0,0x29,0x01,
+0x0f,0x07,0x00,0x1e,0x11,0xdf,0x46,0x08,0x16,0xf9,0x4c,0x09,0x01,0x67,0x00,0x00,
+0x68,0x01,0x01,0xf2,0x01,0x22,0xc1,0x00,0x77,0x01,0x21,0x10,0xff,0x60,0x04,0x21,
+0xd1,0xff,0x28,0x00,0x12,0xfc,0x07,0x00,0x02,0x6c,0x01,0x0e,0x2c,0x02,0x30,0xfb,
+0x11,0xbf,0x07,0x00,0x37,0xf1,0x00,0x1f,0x07,0x00,0x03,0x15,0x00,0x08,0xba,0x07,
+0x20,0x12,0x22,0x01,0x00,0x1a,0x21,0x3d,0x00,0x03,0x15,0x00,0x03,0xe1,0x01,0x0f,
+0x23,0x00,0x27,0x50,0x22,0x22,0x22,0x22,0x21,0x21,0x8f,0xff,0x01,0x00,0x23,0xf8,
+0xff,0x01,0x00,0x12,0xcf,0x07,0x00,0x22,0xfc,0x09,0x08,0x00,0x30,0x90,0xd2,0x5f,
+0x07,0x00,0xf1,0x09,0xf5,0x2d,0xff,0x62,0xcf,0xff,0xff,0xfc,0x26,0xff,0xff,0xfa,
+0x18,0xff,0xff,0x81,0xaf,0xff,0xff,0xff,0xe3,0x4d,0xd4,0x3e,0x24,0x00,0x3e,0x81,
+0x18,0xff,0x01,0x00,0x04,0x58,0x00,0xf0,0x10,0x00,0xdf,0xff,0xfd,0x00,0x00,0x01,
+0xff,0xff,0xfc,0x00,0x00,0x03,0xff,0xff,0xf7,0x00,0x00,0x06,0xff,0xff,0xf2,0x00,
+0x00,0x08,0xff,0xff,0xd0,0x00,0x00,0x0a,0x24,0x00,0x20,0xd0,0x0c,0x06,0x00,0x20,
+0xa0,0x0e,0x06,0x00,0x21,0x20,0x0d,0x35,0x00,0x00,0x1a,0x00,0xf0,0x03,0xe0,0x00,
+0x00,0x00,0x0e,0xff,0x50,0x00,0x00,0x00,0x2f,0xfc,0x00,0x00,0x00,0x00,0x5f,0xf3,
+0x06,0x00,0x20,0x9f,0xa0,0x06,0x00,0x20,0xdf,0x10,0x06,0x00,0x10,0xd7,0x05,0x00,
+0x30,0x04,0xde,0x40,0x11,0x00,0x20,0xff,0x99,0x68,0x00,0x50,0xff,0xff,0x99,0xff,
+0xff,0x07,0x00,0x12,0xff,0x07,0x00,0x30,0x90,0x00,0x00,0x07,0x00,0xc2,0x0d,0xff,
+0xff,0x0d,0x10,0xff,0xff,0x0f,0xff,0xff,0x0f,0xd1,0x07,0x00,0x11,0xfd,0x07,0x00,
+0x21,0x20,0x00,0x07,0x00,0x2a,0xff,0xff,0x07,0x00,0x32,0xdf,0xff,0x0f,0x41,0x00,
+0x0a,0x07,0x00,0x30,0x0d,0xff,0xff,0x64,0x00,0x30,0x00,0xcc,0x00,0x01,0x00,0xf2,
+0x06,0x02,0xff,0x30,0x00,0x00,0x00,0x01,0xbf,0xff,0xfc,0x20,0x00,0x00,0x1e,0xff,
+0xff,0xff,0xe1,0x00,0x00,0x9f,0xbd,0x00,0x12,0xef,0x29,0x00,0x02,0x86,0x00,0x12,
+0x01,0x07,0x00,0x11,0x03,0x07,0x00,0x21,0x30,0x08,0x07,0x00,0x21,0x80,0x1e,0x07,
+0x00,0x22,0xe1,0xcf,0x6c,0x01,0x03,0x07,0x00,0x14,0x00,0x01,0x00,0x31,0x0e,0xff,
+0xe0,0xda,0x00,0x6a,0xee,0x40,0x00,0x00,0x8f,0xff,0xa1,0x01,0x00,0x4c,0x00,0x20,
+0xf0,0x0f,0x03,0x00,0x07,0x09,0x00,0x05,0x01,0x00,0x77,0xf8,0x08,0x80,0x88,0x08,
+0x80,0x8f,0x09,0x00,0x07,0x36,0x00,0x57,0x00,0x00,0x00,0x0f,0x00,0x09,0x00,0x0b,
+0xab,0x01,0x01,0x77,0x01,0x08,0x01,0x00,0x41,0x03,0xaf,0x70,0x00,0x88,0x00,0x30,
+0xcf,0xff,0xf0,0x08,0x00,0x40,0x06,0xdf,0xff,0xff,0x7e,0x01,0x40,0x17,0xef,0xff,
+0xff,0xfd,0x00,0x13,0x18,0xb6,0x00,0x11,0x2a,0x3e,0x00,0x21,0xf4,0x00,0xdc,0x00,
+0x00,0xd7,0x01,0x03,0x4c,0x01,0x13,0x60,0x12,0x00,0x12,0xfe,0x4f,0x00,0x01,0xfd,
+0x01,0x02,0x09,0x00,0x14,0xf1,0x09,0x00,0x14,0x80,0x09,0x00,0x13,0x10,0x09,0x00,
+0x23,0xfa,0x00,0x09,0x00,0x13,0xf2,0x09,0x00,0x28,0x8f,0x80,0x93,0x00,0x50,0xdf,
+0xff,0xff,0xf0,0xd1,0xbb,0x00,0x30,0xf0,0xfd,0x10,0x06,0x00,0x21,0xff,0xd1,0x06,
+0x00,0x21,0xfd,0xff,0x54,0x02,0x1f,0xff,0x01,0x00,0x28,0x23,0xdf,0xff,0xde,0x01,
+0x05,0x01,0x00,0x50,0x04,0x9c,0xef,0xfe,0xc9,0x5c,0x02,0x21,0x07,0xef,0xc6,0x00,
+0xf0,0x00,0x70,0x00,0x04,0xdf,0xff,0xfc,0xa8,0x8a,0xcf,0xff,0xfd,0x40,0x6f,0xff,
+0xd5,0x23,0x00,0x52,0x5d,0xff,0xf6,0xcf,0xf6,0x2e,0x00,0xf0,0x00,0x6f,0xfc,0x1a,
+0x30,0x00,0x5a,0xdf,0xfd,0xa5,0x00,0x03,0xa1,0x00,0x00,0x4d,0x32,0x00,0xa0,0xd4,
+0x00,0x00,0x00,0x05,0xff,0xfe,0xa8,0x8a,0xef,0xc6,0x02,0x70,0x01,0xdf,0x70,0x00,
+0x00,0x07,0xfd,0xe9,0x00,0x10,0x12,0x31,0x00,0x12,0x21,0x38,0x00,0x24,0x4e,0xe4,
+0x70,0x00,0x2e,0xef,0xfe,0x0a,0x00,0x02,0x1e,0x00,0x05,0xc7,0x01,0x15,0x80,0xaf,
+0x00,0x23,0xf0,0xff,0x22,0x00,0x27,0x0f,0xfd,0xbb,0x02,0x03,0x0a,0x00,0x06,0xd6,
+0x02,0x09,0xe0,0x02,0x06,0x32,0x00,0x05,0x46,0x00,0x06,0x5a,0x00,0x0f,0x64,0x00,
+0x11,0x24,0xf0,0x00,0x64,0x00,0x10,0xf0,0x6d,0x01,0x0d,0x0a,0x00,0x0f,0x64,0x00,
+0x30,0x24,0x00,0x00,0x64,0x00,0x02,0x18,0x02,0x0d,0x0a,0x00,0x0f,0x64,0x00,0x2e,
+0x24,0xf0,0x00,0x64,0x00,0x13,0xf0,0x7c,0x02,0x0d,0x0a,0x00,0x0f,0x64,0x00,0x2c,
+0x04,0x0a,0x00,0x05,0x46,0x00,0x1e,0x00,0x0a,0x00,0x0f,0x64,0x00,0x0e,0x01,0x1b,
+0x00,0x15,0x01,0x8d,0x02,0x02,0x39,0x02,0x00,0x13,0x00,0x33,0xcf,0xff,0xf5,0x14,
+0x00,0x33,0xb9,0x29,0xfe,0x15,0x00,0x31,0x3f,0x10,0x02,0xb1,0x03,0x40,0xdf,0x80,
+0x0a,0x90,0x08,0x00,0xf3,0x1a,0x70,0x00,0xdf,0xff,0x77,0xf7,0x55,0x55,0x55,0x55,
+0x8f,0xd3,0x0f,0xff,0xfd,0xcc,0xdf,0xdc,0xcc,0xcc,0xcd,0xff,0xb0,0x8f,0xfe,0x10,
+0x00,0xaa,0x00,0x00,0x00,0x4d,0x40,0x00,0x46,0x10,0x00,0x01,0xf2,0x02,0x33,0x40,
+0x00,0x43,0x09,0xb1,0xcf,0xf9,0x55,0x00,0x13,0x0a,0x35,0x05,0x00,0x01,0x00,0x24,
+0xbf,0xf9,0x0a,0x00,0x20,0x01,0x22,0x06,0x00,0xf0,0x1e,0x18,0xdf,0xfd,0x92,0x00,
+0x02,0xef,0xfb,0xef,0xff,0x40,0x0d,0xff,0xfa,0x2e,0xff,0xe0,0x4f,0xff,0xfa,0x03,
+0xff,0xf5,0x9f,0xfa,0xfa,0x35,0x4f,0xfa,0xcf,0xc0,0x8a,0x3d,0x0b,0xfd,0xef,0xfb,
+0x03,0x11,0x8f,0xfe,0xff,0xff,0xb0,0x06,0xc6,0x00,0xf0,0x22,0xd1,0x08,0xff,0xff,
+0xef,0xfd,0x11,0x10,0x9f,0xff,0xdf,0xd1,0x59,0x3b,0x0b,0xfd,0xaf,0xd6,0xfa,0x37,
+0x1d,0xfb,0x5f,0xff,0xfa,0x01,0xdf,0xf7,0x0d,0xff,0xfa,0x1d,0xff,0xf1,0x03,0xef,
+0xfc,0xdf,0xff,0x50,0x00,0x18,0xdf,0xfe,0xa3,0x00,0x00,0x00,0x7f,0x23,0x04,0x12,
+0xef,0x35,0x04,0x18,0xef,0x3c,0x04,0x03,0x53,0x04,0x14,0xf0,0x07,0x00,0xcf,0xf9,
+0x9f,0x99,0xf9,0x9f,0xf0,0x0f,0xf8,0x8f,0x88,0xf8,0x8f,0x07,0x00,0x12,0x03,0x31,
+0x00,0x02,0x3f,0x00,0x17,0x08,0x63,0x01,0x33,0x00,0x7f,0xa0,0x08,0x00,0x21,0xff,
+0xb0,0x08,0x00,0x12,0x0d,0xe5,0x04,0x32,0x00,0x7a,0x1d,0xa2,0x01,0x51,0x7f,0xfa,
+0x1d,0xff,0x70,0x20,0x00,0x22,0xfa,0x1d,0x08,0x00,0x01,0xa5,0x04,0x00,0x08,0x00,
+0x2f,0xff,0x70,0x08,0x00,0x08,0x13,0x6f,0x08,0x00,0x13,0x0b,0x08,0x00,0x23,0x00,
+0xdf,0x08,0x00,0x13,0x0e,0x08,0x00,0x5b,0x00,0xde,0xdb,0x60,0x00,0x01,0x00,0x12,
+0x1b,0xfe,0x01,0x53,0xe4,0x00,0x01,0xdf,0xff,0x00,0x01,0xa0,0x1d,0xff,0xff,0xfa,
+0xef,0xfe,0xaf,0xff,0xff,0x01,0x7f,0x05,0xd2,0x2e,0xe2,0x0a,0xff,0xff,0x1d,0xff,
+0xff,0xff,0xe2,0x02,0x20,0x2e,0xae,0x07,0x48,0xfe,0x20,0x02,0xef,0x0a,0x00,0x06,
+0x1e,0x00,0x06,0x32,0x00,0x06,0x46,0x00,0x07,0x5a,0x00,0x06,0x6e,0x00,0x11,0x07,
+0x06,0x00,0x10,0x7f,0x16,0x00,0x71,0x07,0xf8,0x0f,0x0b,0x40,0xff,0x7f,0x06,0x00,
+0x12,0xff,0x06,0x00,0x0f,0x01,0x00,0x22,0x02,0x34,0x05,0x12,0x4e,0x60,0x00,0x19,
+0x00,0xce,0x02,0x50,0x03,0xe0,0x00,0x00,0x10,0x42,0x07,0x41,0xef,0x10,0x00,0xbf,
+0x4b,0x01,0x40,0xf1,0x00,0xcf,0xf1,0xe5,0x02,0xb3,0xff,0x11,0xcf,0xff,0x77,0x77,
+0x77,0x77,0xbf,0xf1,0xcf,0x47,0x00,0x13,0x17,0x08,0x00,0x24,0xe0,0x07,0x35,0x06,
+0x14,0x06,0x2c,0x06,0x80,0x05,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const etxFontBlock blocks[] = {
+{ .bitmap_index = 0, .comp_offset = 0, .size = 4079, .comp_size = 3398 },
+{ .bitmap_index = 4079, .comp_offset = 3398, .size = 4007, .comp_size = 3371 },
+{ .bitmap_index = 8086, .comp_offset = 6769, .size = 4094, .comp_size = 2875 },
+{ .bitmap_index = 12180, .comp_offset = 9644, .size = 4010, .comp_size = 2900 },
+{ .bitmap_index = 16190, .comp_offset = 12544, .size = 4046, .comp_size = 3211 },
+{ .bitmap_index = 20236, .comp_offset = 15755, .size = 4059, .comp_size = 3087 },
+{ .bitmap_index = 24295, .comp_offset = 18842, .size = 4090, .comp_size = 3235 },
+{ .bitmap_index = 28385, .comp_offset = 22077, .size = 4066, .comp_size = 3197 },
+{ .bitmap_index = 32451, .comp_offset = 25274, .size = 4026, .comp_size = 3327 },
+{ .bitmap_index = 36477, .comp_offset = 28601, .size = 4093, .comp_size = 3447 },
+{ .bitmap_index = 40570, .comp_offset = 32048, .size = 4076, .comp_size = 3205 },
+{ .bitmap_index = 44646, .comp_offset = 35253, .size = 4042, .comp_size = 3401 },
+{ .bitmap_index = 48688, .comp_offset = 38654, .size = 4069, .comp_size = 2315 },
+{ .bitmap_index = 52757, .comp_offset = 40969, .size = 2242, .comp_size = 1156 },
 };
 
 static const etxFontCmap cmaps[] = {
@@ -2607,11 +2978,11 @@ static const etxFontCmap cmaps[] = {
 { .range_start = 176, .range_length = 63475, .glyph_id_start = 115, .list_length = 514, .type = 3, .unicode_list = 5032, .glyph_id_ofs_list = 0 },
 };
 
-static uint8_t etxUncompBuf[64021] __SDRAMFONTS;
+static uint8_t etxUncompBuf[9022] __SDRAMFONTS;
 
 const etxLz4Font lv_font_ko_bold_STD = {
-.uncomp_size = 63757,
-.comp_size = 41536,
+.uncomp_size = 8758,
+.comp_size = 5020,
 .line_height = 19,
 .base_line = 4,
 .subpx = 0,
@@ -2624,12 +2995,15 @@ const etxLz4Font lv_font_ko_bold_STD = {
 .bitmap_format = 0,
 .left_class_cnt = 40,
 .right_class_cnt = 36,
-.glyph_bitmap = 6060,
-.class_pair_values = 61059,
-.left_class_mapping = 62499,
-.right_class_mapping = 63128,
+.glyph_bitmap = 0,
+.class_pair_values = 6060,
+.left_class_mapping = 7500,
+.right_class_mapping = 8129,
 .cmaps = cmaps,
 .compressed = lz4FontData,
 .lvglFontBuf = etxUncompBuf,
-.lvglFontBufSize = 64021,
+.lvglFontBufSize = 9022,
+.block_count = 14,
+.blocks = blocks,
+.compressed_bitmap = lz4BitmapData,
 };
@@ -41,55 +41,13 @@
 #include "gps.h"
 #include "gps_nmea.h"
 #include "gps_ubx.h"
-#include <ctype.h>
 
 gpsdata_t gpsData;
 static int gpsProtocol = -1;
 const etx_serial_driver_t* gpsSerialDrv = nullptr;
 void* gpsSerialCtx = nullptr;
 
-#define DIGIT_TO_VAL(_x)    (_x - '0')
-
-uint32_t GPS_coord_to_degrees(const char * coordinateString)
-{
-  const char * fieldSeparator, * remainingString;
-  uint8_t degrees = 0, minutes = 0;
-  uint16_t fractionalMinutes = 0;
-  uint8_t digitIndex;
-
-  // scan for decimal point or end of field
-  for (fieldSeparator = coordinateString; isdigit((unsigned char) *fieldSeparator); fieldSeparator++) {
-    if (fieldSeparator >= coordinateString + 15)
-      return 0; // stop potential fail
-  }
-  remainingString = coordinateString;
-
-  // convert degrees
-  while ((fieldSeparator - remainingString) > 2) {
-    if (degrees)
-      degrees *= 10;
-    degrees += DIGIT_TO_VAL(*remainingString++);
-  }
-  // convert minutes
-  while (fieldSeparator > remainingString) {
-    if (minutes)
-      minutes *= 10;
-    minutes += DIGIT_TO_VAL(*remainingString++);
-  }
-  // convert fractional minutes
-  // expect up to four digits, result is in
-  // ten-thousandths of a minute
-  if (*fieldSeparator == '.') {
-    remainingString = fieldSeparator + 1;
-    for (digitIndex = 0; digitIndex < 4; digitIndex++) {
-      fractionalMinutes *= 10;
-      if (isdigit((unsigned char) *remainingString))
-        fractionalMinutes += *remainingString++ - '0';
-    }
-  }
-  // TODO return degrees * 10000000UL + (minutes * 1000000UL + fractionalMinutes * 100UL) / 6;
-  return degrees * 1000000UL + (minutes * 100000UL + fractionalMinutes * 10UL) / 6;
-}
+#define GPS_RX_CHUNK_SIZE   64
 
 static void changeBaudrate()
 {
@@ -102,41 +60,41 @@ static void changeBaudrate()
   setBaudrate(gpsSerialCtx, baudrates[++current_rate % baudrates_count]);
 }
 
-static void autodetectProtocol(uint8_t c)
+static void autodetectProtocol(const uint8_t* data, uint32_t len)
 {
   static tmr10ms_t time;
-  static uint8_t state = 0;
+  static bool waiting = false;
   static tmr10ms_t firstPacketNMEA = 0;
 
-  switch (state)  {
-    case 0: // Init
-      time = get_tmr10ms();
-      state = 1;
-    case 1: // Wait for a valid packet
-      if (gpsNewFrameNMEA(c)) {
-        if (!firstPacketNMEA) {
-          firstPacketNMEA = time;
-        } else if (time - firstPacketNMEA > 200) {
-          // continuous stream of NMEA packets for 2 seconds, but no UBX packets
-          gpsProtocol = GPS_PROTOCOL_NMEA;
-        }
-        state = 0;
-        return;
-      }
-
-      if (gpsNewFrameUBX(c, true)) {
-        gpsProtocol = GPS_PROTOCOL_UBX;
-        state = 0;
-        return;
-      }
-
-      uint32_t new_time = get_tmr10ms();
-      if (new_time - time > 50) {
-        // No message received
-        firstPacketNMEA = 0;
-        changeBaudrate();
-        time = new_time;
-      }
+  if (!waiting) {
+    time = get_tmr10ms();
+    waiting = true;
+  }
+
+  // Wait for a valid packet
+  if (gpsProcessUBX(data, len, true)) {
+    gpsProtocol = GPS_PROTOCOL_UBX;
+    waiting = false;
+    return;
+  }
+
+  if (gpsProcessNMEA(data, len)) {
+    if (!firstPacketNMEA) {
+      firstPacketNMEA = time;
+    } else if (time - firstPacketNMEA > 200) {
+      // continuous stream of NMEA packets for 2 seconds, but no UBX packets
+      gpsProtocol = GPS_PROTOCOL_NMEA;
+    }
+    waiting = false;
+    return;
+  }
+
+  tmr10ms_t new_time = get_tmr10ms();
+  if (new_time - time > 50) {
+    // No message received
+    firstPacketNMEA = 0;
+    changeBaudrate();
+    time = new_time;
   }
 }
 
@@ -153,21 +111,37 @@ static void detectDisconnected(bool has_frame)
 }
 
 
-void gpsNewData(uint8_t c)
+void gpsProcessBytes(const uint8_t* data, uint32_t len)
 {
   switch (gpsProtocol) {
     case GPS_PROTOCOL_NMEA:
-      detectDisconnected(gpsNewFrameNMEA(c));
+      detectDisconnected(gpsProcessNMEA(data, len) > 0);
       break;
     case GPS_PROTOCOL_UBX:
-      detectDisconnected(gpsNewFrameUBX(c, false));
+      detectDisconnected(gpsProcessUBX(data, len, false) > 0);
       break;
     case GPS_PROTOCOL_AUTO:
-      autodetectProtocol(c);
+      autodetectProtocol(data, len);
       break;
   }
 }
 
+// Pulls the received bytes by chunks: copied from the RX DMA buffer when
+// the driver supports it
+static int gpsReadBytes(uint8_t* buf, uint32_t len)
+{
+  auto drv = gpsSerialDrv;
+  if (drv->copyRxBuffer) {
+    int count = drv->copyRxBuffer(gpsSerialCtx, buf, len);
+    if (count >= 0) return count;
+  }
+
+  uint32_t count = 0;
+  if (drv->getByte) {
+    while (count < len && drv->getByte(gpsSerialCtx, &buf[count])) count++;
+  }
+  return count;
+}
 
 #if defined(DEBUG)
 uint8_t gpsTraceEnabled = false;
@@ -183,19 +157,18 @@ void gpsSetSerialDriver(void* ctx, const etx_serial_driver_t* drv, int protocol)
 void gpsWakeup()
 {
   if (!gpsSerialDrv) return;
-
-  auto _getByte = gpsSerialDrv->getByte;
-  if (!_getByte) return;
+  if (!gpsSerialDrv->getByte && !gpsSerialDrv->copyRxBuffer) return;
 
   static tmr10ms_t time = get_tmr10ms();
-  uint8_t byte;
-  while (_getByte(gpsSerialCtx, &byte)) {
+  uint8_t buffer[GPS_RX_CHUNK_SIZE];
+  int len;
+  while ((len = gpsReadBytes(buffer, sizeof(buffer))) > 0) {
 #if defined(DEBUG)
     if (gpsTraceEnabled) {
-      dbgSerialPutc(byte);
+      for (int i = 0; i < len; i++) dbgSerialPutc(buffer[i]);
     }
 #endif
-    gpsNewData(byte);
+    gpsProcessBytes(buffer, len);
     time = get_tmr10ms();
   }
 
@@ -58,4 +58,8 @@ void gpsWakeup();
 // Send a 0-terminated frame
 void gpsSendFrame(const char* frame);
 
-uint32_t GPS_coord_to_degrees(const char* coordinateString);
+// NMEA [d]ddmm.mmmmmm coordinate to degrees * 1.000.000
+uint32_t GPS_coord_to_degrees(const char* str, uint8_t len);
+
+// Parse the bytes received from the GPS
+void gpsProcessBytes(const uint8_t* data, uint32_t len);
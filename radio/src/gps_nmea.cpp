@@ -56,9 +56,8 @@
      - GPS speed (for OSD displaying)
 */
 
-#define NO_FRAME   0
-#define FRAME_GGA  1
-#define FRAME_RMC  2
+// NMEA 0183 sentences are limited to 82 characters
+#define NMEA_SENTENCE_MAX   96
 
 #define DIGIT_TO_VAL(_x)    (_x - '0')
 
@@ -95,26 +94,39 @@ void gpsSendFrameNMEA(const char * frame)
   TRACE("*%02x", parity);
 }
 
-// helper functions
-uint32_t grab_fields(char * src, uint8_t mult)
+// Fixed-point decimal field: value * 10^decimals, extra decimals are
+// truncated, 0 for an empty field
+static int32_t parseDecimal(const char* str, uint8_t len, uint8_t decimals)
 {
-  uint32_t i;
-  uint32_t tmp = 0;
-  for (i = 0; src[i] != 0; i++) {
-    if (src[i] == '.') {
-      i++;
-      if (mult == 0)
-        break;
-      else
-        src[i + mult] = 0;
-    }
-    tmp *= 10;
-    if (src[i] >= '0' && src[i] <= '9')
-      tmp += src[i] - '0';
-    if (i >= 15)
-      return 0; // out of bounds
+  const char* end = str + len;
+  bool negative = (str < end && *str == '-');
+  if (negative) str++;
+
+  int32_t value = 0;
+  while (str < end && *str != '.') {
+    value = value * 10 + DIGIT_TO_VAL(*str++);
+  }
+  if (str < end) str++;  // '.'
+  while (decimals--) {
+    value *= 10;
+    if (str < end) value += DIGIT_TO_VAL(*str++);
   }
-  return tmp;
+
+  return negative ? -value : value;
+}
+
+uint32_t GPS_coord_to_degrees(const char* str, uint8_t len)
+{
+  // [d]ddmm.mmmmmm: degrees, minutes with up to 6 decimals
+  uint8_t digits = 0;
+  while (digits < len && str[digits] != '.') digits++;
+  if (digits < 3 || digits > 5) return 0;
+
+  uint32_t degrees = parseDecimal(str, digits - 2, 0);
+  uint32_t minutes = parseDecimal(str + digits - 2, len - digits + 2, 6);
+
+  // result in degrees * 1.000.000
+  return degrees * 1000000UL + (minutes + 30) / 60;
 }
 
 typedef struct gpsDataNmea_s
@@ -123,7 +135,7 @@ typedef struct gpsDataNmea_s
   int32_t latitude;
   int32_t longitude;
   uint8_t numSat;
-  uint16_t altitude;
+  int32_t altitude;
   uint16_t speed;
   uint16_t groundCourse;
   uint16_t hdop;
@@ -131,170 +143,246 @@ typedef struct gpsDataNmea_s
   uint32_t time;
 } gpsDataNmea_t;
 
-bool gpsNewFrameNMEA(char c)
+static gpsDataNmea_t gps_Msg;
+
+enum NmeaFieldType {
+  NMEA_TIME,
+  NMEA_STATUS,
+  NMEA_LATITUDE,
+  NMEA_NORTH_SOUTH,
+  NMEA_LONGITUDE,
+  NMEA_EAST_WEST,
+  NMEA_QUALITY,
+  NMEA_SATELLITES,
+  NMEA_HDOP,
+  NMEA_ALTITUDE,
+  NMEA_SPEED,
+  NMEA_COURSE,
+  NMEA_DATE,
+};
+
+struct NmeaField {
+  uint8_t index;
+  uint8_t type;
+};
+
+// Fields used in each sentence, by increasing index
+static const NmeaField ggaFields[] = {
+  {2, NMEA_LATITUDE},  {3, NMEA_NORTH_SOUTH}, {4, NMEA_LONGITUDE},
+  {5, NMEA_EAST_WEST}, {6, NMEA_QUALITY},     {7, NMEA_SATELLITES},
+  {8, NMEA_HDOP},      {9, NMEA_ALTITUDE},
+};
+
+static const NmeaField rmcFields[] = {
+  {1, NMEA_TIME},  {2, NMEA_STATUS}, {7, NMEA_SPEED},
+  {8, NMEA_COURSE}, {9, NMEA_DATE},
+};
+
+static void parseField(uint8_t type, const char* str, uint8_t len)
 {
-  static gpsDataNmea_t gps_Msg;
-
-  uint8_t frameOK = 0;
-  static uint8_t param = 0, offset = 0, parity = 0;
-  static char string[15];
-  static uint8_t checksum_param, gps_frame = NO_FRAME;
-
-  switch (c) {
-    case '$':
-      param = 0;
-      offset = 0;
-      parity = 0;
+  switch (type) {
+    case NMEA_TIME:
+      gps_Msg.time = parseDecimal(str, len, 0);
+      break;
+    case NMEA_STATUS:
+      gps_Msg.fix = (len > 0 && str[0] == 'A');
+      break;
+    case NMEA_LATITUDE:
+      gps_Msg.latitude = GPS_coord_to_degrees(str, len);
+      break;
+    case NMEA_NORTH_SOUTH:
+      if (len > 0 && str[0] == 'S') gps_Msg.latitude = -gps_Msg.latitude;
+      break;
+    case NMEA_LONGITUDE:
+      gps_Msg.longitude = GPS_coord_to_degrees(str, len);
       break;
-    case ',':
-    case '*':
-      string[offset] = 0;
-      if (param == 0) {
-        // Frame identification (accept all GPS talkers (GP: GPS, GL:Glonass, GN:combination, etc...))
-        gps_frame = NO_FRAME;
-        if (string[0] == 'G' && string[2] == 'G' && string[3] == 'G' && string[4] == 'A') {
-          gps_frame = FRAME_GGA;
-        }
-        else if (string[0] == 'G' && string[2] == 'R' && string[3] == 'M' && string[4] == 'C') {
-          gps_frame = FRAME_RMC;
-        }
-        else {
-          // turn off this frame (do this only once a second)
-          static gtime_t lastGpsCmdSent = 0;
-          if (string[0] == 'G' && g_rtcTime != lastGpsCmdSent) {
-            lastGpsCmdSent = g_rtcTime;
-            char cmd[] = "$PUBX,40,GSV,0,0,0,0";
-            cmd[9]  = string[2];
-            cmd[10] = string[3];
-            cmd[11] = string[4];
-            gpsSendFrameNMEA(cmd);
-          }
-        }
-      }
-
-      switch (gps_frame) {
-        case FRAME_GGA:        //************* GPGGA FRAME parsing
-          switch (param) {
-            case 2:
-              gps_Msg.latitude = GPS_coord_to_degrees(string);
-              break;
-            case 3:
-              if (string[0] == 'S')
-                gps_Msg.latitude *= -1;
-              break;
-            case 4:
-              gps_Msg.longitude = GPS_coord_to_degrees(string);
-              break;
-            case 5:
-              if (string[0] == 'W')
-                gps_Msg.longitude *= -1;
-              break;
-            case 6:
-              if (string[0] > '0') {
-                gps_Msg.fix = 1;
-              }
-              else {
-                gps_Msg.fix = 0;
-              }
-              break;
-            case 7:
-              gps_Msg.numSat = grab_fields(string, 0);
-              break;
-            case 8:
-              gps_Msg.hdop = grab_fields(string, 1) * 10;
-              break;
-            case 9:
-              gps_Msg.altitude = grab_fields(string, 0);     // altitude in meters added by Mis
-              break;
-          }
-          break;
-        case FRAME_RMC:        //************* GPRMC FRAME parsing
-          switch (param) {
-            case 1:
-              gps_Msg.time = grab_fields(string, 0);
-              break;
-            case 2:
-              if (string[0] == 'A') {
-                gps_Msg.fix = 1;
-              }
-              else {
-                gps_Msg.fix = 0;
-              }
-              break;
-            case 7:
-              gps_Msg.speed = ((grab_fields(string, 1) * 5144L) / 1000L);    // speed in cm/s added by Mis
-              break;
-            case 8:
-              gps_Msg.groundCourse = (grab_fields(string, 1));      // ground course deg * 10
-              break;
-            case 9:
-              gps_Msg.date = grab_fields(string, 0);
-              break;
-          }
-          break;
-
-      }
-
-      param++;
-      offset = 0;
-      if (c == '*')
-        checksum_param = 1;
-      else
-        parity ^= c;
+    case NMEA_EAST_WEST:
+      if (len > 0 && str[0] == 'W') gps_Msg.longitude = -gps_Msg.longitude;
       break;
-    case '\r':
-    case '\n':
-      if (checksum_param) {   //parity checksum
-        uint8_t checksum = 16 * ((string[0] >= 'A') ? string[0] - 'A' + 10 : string[0] - '0') +
-                           ((string[1] >= 'A') ? string[1] - 'A' + 10 : string[1] - '0');
-        if (checksum == parity) {
-          gpsData.packetCount++;
-          switch (gps_frame) {
-            case FRAME_GGA:
-              frameOK = 1;
-              gpsData.fix = gps_Msg.fix;
-              gpsData.numSat = gps_Msg.numSat;
-              gpsData.hdop = gps_Msg.hdop;
-              if (gps_Msg.fix) {
-                __disable_irq();    // do the atomic update of lat/lon
-                gpsData.latitude = gps_Msg.latitude;
-                gpsData.longitude = gps_Msg.longitude;
-                gpsData.altitude = gps_Msg.altitude;
-                __enable_irq();
-              }
-              break;
-            case FRAME_RMC:
-              gpsData.speed = gps_Msg.speed;
-              gpsData.groundCourse = gps_Msg.groundCourse;
+    case NMEA_QUALITY:
+      gps_Msg.fix = (len > 0 && str[0] > '0');
+      break;
+    case NMEA_SATELLITES:
+      gps_Msg.numSat = parseDecimal(str, len, 0);
+      break;
+    case NMEA_HDOP:
+      gps_Msg.hdop = parseDecimal(str, len, 2);
+      break;
+    case NMEA_ALTITUDE:
+      gps_Msg.altitude = parseDecimal(str, len, 0);  // altitude in meters
+      break;
+    case NMEA_SPEED:
+      // knots * 10 to cm/s
+      gps_Msg.speed = (parseDecimal(str, len, 1) * 5144L) / 1000L;
+      break;
+    case NMEA_COURSE:
+      gps_Msg.groundCourse = parseDecimal(str, len, 1);  // degrees * 10
+      break;
+    case NMEA_DATE:
+      gps_Msg.date = parseDecimal(str, len, 0);
+      break;
+  }
+}
+
+// Split the sentence fields, and parse those listed in the table
+static void parseFields(const char* str, uint8_t len, const NmeaField* fields,
+                        uint8_t count)
+{
+  const char* end = str + len;
+  uint8_t index = 0;
+
+  while (count > 0) {
+    auto sep = (const char*)memchr(str, ',', end - str);
+    const char* fieldEnd = sep ? sep : end;
+    if (index == fields->index) {
+      parseField(fields->type, str, fieldEnd - str);
+      fields++;
+      count--;
+    }
+    if (!sep) break;
+    str = sep + 1;
+    index++;
+  }
+}
+
+static int8_t hexValue(char c)
+{
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+static void disableSentence(const char* id)
+{
+  // turn off this frame (do this only once a second)
+  static gtime_t lastGpsCmdSent = 0;
+  if (id[0] == 'G' && g_rtcTime != lastGpsCmdSent) {
+    lastGpsCmdSent = g_rtcTime;
+    char cmd[] = "$PUBX,40,GSV,0,0,0,0";
+    cmd[9]  = id[2];
+    cmd[10] = id[3];
+    cmd[11] = id[4];
+    gpsSendFrameNMEA(cmd);
+  }
+}
+
+static void commitGGA()
+{
+  gpsData.fix = gps_Msg.fix;
+  gpsData.numSat = gps_Msg.numSat;
+  gpsData.hdop = gps_Msg.hdop;
+  if (gps_Msg.fix) {
+    __disable_irq();    // do the atomic update of lat/lon
+    gpsData.latitude = gps_Msg.latitude;
+    gpsData.longitude = gps_Msg.longitude;
+    gpsData.altitude = gps_Msg.altitude;
+    __enable_irq();
+  }
+}
+
+static void commitRMC()
+{
+  gpsData.speed = gps_Msg.speed;
+  gpsData.groundCourse = gps_Msg.groundCourse;
 #if defined(RTCLOCK)
-              // set RTC clock if needed
-              if (g_eeGeneral.adjustRTC && gps_Msg.fix) {
-                div_t qr = div(gps_Msg.date, 100);
-                uint8_t year = qr.rem;
-                qr = div(qr.quot, 100);
-                uint8_t mon = qr.rem;
-                uint8_t day = qr.quot;
-                qr = div(gps_Msg.time, 100);
-                uint8_t sec = qr.rem;
-                qr = div(qr.quot, 100);
-                uint8_t min = qr.rem;
-                uint8_t hour = qr.quot;
-                rtcAdjust(year+2000, mon, day, hour, min, sec);
-              }
+  // set RTC clock if needed
+  if (g_eeGeneral.adjustRTC && gps_Msg.fix) {
+    div_t qr = div(gps_Msg.date, 100);
+    uint8_t year = qr.rem;
+    qr = div(qr.quot, 100);
+    uint8_t mon = qr.rem;
+    uint8_t day = qr.quot;
+    qr = div(gps_Msg.time, 100);
+    uint8_t sec = qr.rem;
+    qr = div(qr.quot, 100);
+    uint8_t min = qr.rem;
+    uint8_t hour = qr.quot;
+    rtcAdjust(year+2000, mon, day, hour, min, sec);
+  }
 #endif
-          } // end switch
-        }
-        else {
-          gpsData.errorCount++;
-        }
-      }
-      checksum_param = 0;
-      break;
-    default:
-      if (offset < 15)
-        string[offset++] = c;
-      if (!checksum_param)
-        parity ^= c;
+}
+
+// Sentence without '$' and line end: "GPGGA,...*hh"
+// Returns true for a valid GGA sentence
+static bool processSentence(const char* str, uint8_t len)
+{
+  // checksum
+  if (len < 9 || str[len - 3] != '*') return false;
+
+  int8_t hi = hexValue(str[len - 2]);
+  int8_t lo = hexValue(str[len - 1]);
+  len -= 3;
+
+  uint8_t parity = 0;
+  for (uint8_t i = 0; i < len; i++) parity ^= str[i];
+  if (hi < 0 || lo < 0 || parity != ((hi << 4) | lo)) {
+    gpsData.errorCount++;
+    return false;
   }
-  return frameOK;
+
+  gpsData.packetCount++;
+
+  // Frame identification (accept all GPS talkers (GP: GPS, GL:Glonass,
+  // GN:combination, etc...))
+  if (str[5] != ',') return false;
+  if (str[0] == 'G' && str[2] == 'G' && str[3] == 'G' && str[4] == 'A') {
+    parseFields(str, len, ggaFields, DIM(ggaFields));
+    commitGGA();
+    return true;
+  }
+  if (str[0] == 'G' && str[2] == 'R' && str[3] == 'M' && str[4] == 'C') {
+    parseFields(str, len, rmcFields, DIM(rmcFields));
+    commitRMC();
+    return false;
+  }
+
+  disableSentence(str);
+  return false;
+}
+
+static struct {
+  char buf[NMEA_SENTENCE_MAX];
+  uint8_t len;
+  bool active;
+} nmea;
+
+uint32_t gpsProcessNMEA(const uint8_t* data, uint32_t len)
+{
+  uint32_t frames = 0;
+  const char* str = (const char*)data;
+  const char* end = str + len;
+
+  while (str < end) {
+    if (!nmea.active) {
+      str = (const char*)memchr(str, '$', end - str);
+      if (!str) break;
+      str++;
+      nmea.active = true;
+      nmea.len = 0;
+    }
+
+    // copy up to the end of the sentence (or of the data)
+    const char* start = str;
+    while (str < end && *str != '\r' && *str != '\n' && *str != '$') str++;
+
+    uint32_t count = str - start;
+    if (nmea.len + count > sizeof(nmea.buf)) {
+      // too long: not a sentence
+      nmea.active = false;
+      continue;
+    }
+    memcpy(&nmea.buf[nmea.len], start, count);
+    nmea.len += count;
+
+    if (str < end) {
+      nmea.active = false;
+      // a new sentence starting before the line end drops this one
+      if (*str == '$') continue;
+      str++;
+      if (processSentence(nmea.buf, nmea.len)) frames++;
+    }
+  }
+
+  return frames;
 }
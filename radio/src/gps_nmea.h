@@ -23,6 +23,8 @@
 
 #include <inttypes.h>
 
-bool gpsNewFrameNMEA(char c);
+// Parse the received bytes, returns the number of valid GGA (position)
+// sentences
+uint32_t gpsProcessNMEA(const uint8_t* data, uint32_t len);
 
 void gpsSendFrameNMEA(const char* frame);
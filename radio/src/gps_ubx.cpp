@@ -41,52 +41,32 @@ extern const etx_serial_driver_t* gpsSerialDrv;
 extern void* gpsSerialCtx;
 
 // https://docs.ros.org/en/noetic/api/ublox_msgs/html/msg/NavPVT.html
-typedef struct ubxNavPvt_s {
-  uint32_t time;         // GPS Millisecond time of week [ms]
-  uint16_t year;         // Year (UTC)
-  uint8_t month;         // Month, range 1..12 (UTC)
-  uint8_t day;           // Day of month, range 1..31 (UTC)
-  uint8_t hour;          // Hour of day, range 0..23 (UTC)
-  uint8_t min;           // Minute of hour, range 0..59 (UTC)
-  uint8_t sec;           // Seconds of minute, range 0..60 (UTC)
-  uint8_t valid;         // Validity flags
-  uint32_t tAcc;         // time accuracy estimate [ns] (UTC)
-  int32_t nano;          // fraction of a second [ns], range -1e9 .. 1e9 (UTC)
-  uint8_t fixType;       // GNSS fix Type
-  uint8_t flags;         // Fix Status Flags
-  uint8_t flags2;        // Additional Flags
-  uint8_t numSV;         // Number of SVs used in Nav Solution
-  int32_t lon;           // Longitude [deg / 1e-7]
-  int32_t lat;           // Latitude [deg / 1e-7]
-  int32_t height;        // Height above Ellipsoid [mm]
-  int32_t hMSL;          // Height above mean sea level [mm]
-  uint32_t hAcc;         // Horizontal Accuracy Estimate [mm]
-  uint32_t vAcc;         // Vertical Accuracy Estimate [mm]
-  int32_t velN;          // NED north velocity [mm/s]
-  int32_t velE;          // NED east velocity [mm/s]
-  int32_t velD;          // NED down velocity [mm/s]
-  int32_t gSpeed;        // Ground Speed (2-D) [mm/s]
-  int32_t headMot;       // Heading of motion 2-D [deg / 1e-5]
-  uint32_t sAcc;         // Speed Accuracy Estimate [mm/s]
-  uint32_t headAcc;      // Heading Accuracy Estimate (both motion & vehicle)
-  uint16_t pDOP;         // Position DOP [1 / 0.01]
-  uint8_t flags3;        // Additional Flags
-  uint8_t reserved0[5];  // Reserved
-  int32_t headVeh;       // Heading of vehicle (2-D) [deg / 1e-5]
-  int16_t magDec;        // # Magnetic declination [deg / 1e-2]
-  uint16_t magAcc;       // Magnetic declination accuracy [deg / 1e-2]
-} ubxNavPvt_t;
-
-typedef struct ubxNavDop_s {
-  uint32_t itow;  // GPS Millisecond Time of Week
-  uint16_t gdop;  // Geometric DOP
-  uint16_t pdop;  // Position DOP
-  uint16_t tdop;  // Time DOP
-  uint16_t vdop;  // Vertical DOP
-  uint16_t hdop;  // Horizontal DOP
-  uint16_t ndop;  // Northing DOP
-  uint16_t edop;  // Easting DOP
-} ubxNavDop_t;
+#define UBX_NAV_PVT             0x0107
+#define UBX_NAV_PVT_YEAR        4   // Year (UTC)
+#define UBX_NAV_PVT_MONTH       6   // Month, range 1..12 (UTC)
+#define UBX_NAV_PVT_DAY         7   // Day of month, range 1..31 (UTC)
+#define UBX_NAV_PVT_HOUR        8   // Hour of day, range 0..23 (UTC)
+#define UBX_NAV_PVT_MIN         9   // Minute of hour, range 0..59 (UTC)
+#define UBX_NAV_PVT_SEC         10  // Seconds of minute, range 0..60 (UTC)
+#define UBX_NAV_PVT_VALID       11  // Validity flags
+#define UBX_NAV_PVT_FLAGS       21  // Fix Status Flags
+#define UBX_NAV_PVT_NUMSV       23  // Number of SVs used in Nav Solution
+#define UBX_NAV_PVT_LON         24  // Longitude [deg / 1e-7]
+#define UBX_NAV_PVT_LAT         28  // Latitude [deg / 1e-7]
+#define UBX_NAV_PVT_HMSL        36  // Height above mean sea level [mm]
+#define UBX_NAV_PVT_GSPEED      60  // Ground Speed (2-D) [mm/s]
+#define UBX_NAV_PVT_HEADMOT     64  // Heading of motion 2-D [deg / 1e-5]
+#define UBX_NAV_PVT_MIN_LEN     68
+
+#define UBX_NAV_DOP             0x0104
+#define UBX_NAV_DOP_HDOP        12  // Horizontal DOP
+#define UBX_NAV_DOP_MIN_LEN     14
+
+#define UBX_SYNC1               0xb5
+#define UBX_SYNC2               0x62
+#define UBX_HEADER_LEN          6   // sync, class, id, length
+#define UBX_FRAME_OVERHEAD      8   // header + checksum
+#define UBX_BUFFER_SIZE         100
 
 typedef struct ubxCfgMsg_s {
   uint8_t msgClass;
@@ -129,6 +109,7 @@ static void configureGps(bool detect)
 {
   static int state = 0;
 
+  if (!gpsSerialDrv) return;
   if (detect) state = 0;
 
   auto txCompleted = gpsSerialDrv->txCompleted;
@@ -148,146 +129,204 @@ static void configureGps(bool detect)
   }
 }
 
+// Payloads are read with little-endian accessors, so they can be decoded
+// in place whatever their alignment
+static inline uint16_t ubxGet16(const uint8_t* p, uint8_t offset)
+{
+  return p[offset] | (p[offset + 1] << 8);
+}
+
+static inline int32_t ubxGet32(const uint8_t* p, uint8_t offset)
+{
+  return (int32_t)(ubxGet16(p, offset) | ((uint32_t)ubxGet16(p, offset + 2) << 16));
+}
+
 static void gpsProcessMessage(uint16_t msg_type, uint16_t msg_len,
-                              uint8_t* payload)
+                              const uint8_t* payload)
 {
-  if (msg_type == 0x0107) {
-    auto pvt = (ubxNavPvt_t*)payload;
-    gpsData.fix = pvt->flags & 0x01;
-    gpsData.numSat = pvt->numSV;
-    gpsData.speed = pvt->gSpeed / 100;            // speed in 0.1m/s
-    gpsData.groundCourse = pvt->headMot / 10000;  // degrees * 10
+  if (msg_type == UBX_NAV_PVT && msg_len >= UBX_NAV_PVT_MIN_LEN) {
+    gpsData.fix = payload[UBX_NAV_PVT_FLAGS] & 0x01;
+    gpsData.numSat = payload[UBX_NAV_PVT_NUMSV];
+    // speed in 0.1m/s
+    gpsData.speed = ubxGet32(payload, UBX_NAV_PVT_GSPEED) / 100;
+    // degrees * 10
+    gpsData.groundCourse = ubxGet32(payload, UBX_NAV_PVT_HEADMOT) / 10000;
     if (gpsData.fix) {
-      __disable_irq();                     // do the atomic update of lat/lon
-      gpsData.longitude = pvt->lon / 10;   // degrees * 1.000.000
-      gpsData.latitude = pvt->lat / 10;    // degrees * 1.000.000
-      gpsData.altitude = pvt->hMSL / 100;  // altitude in 0.1m
+      __disable_irq();  // do the atomic update of lat/lon
+      // degrees * 1.000.000
+      gpsData.longitude = ubxGet32(payload, UBX_NAV_PVT_LON) / 10;
+      gpsData.latitude = ubxGet32(payload, UBX_NAV_PVT_LAT) / 10;
+      // altitude in 0.1m
+      gpsData.altitude = ubxGet32(payload, UBX_NAV_PVT_HMSL) / 100;
       __enable_irq();
     }
 
 #if defined(RTCLOCK)
     // set RTC clock if needed
-    if (g_eeGeneral.adjustRTC && (pvt->valid & 0x03) == 0x03) {
-      rtcAdjust(pvt->year, pvt->month, pvt->day, pvt->hour, pvt->min, pvt->sec);
+    if (g_eeGeneral.adjustRTC &&
+        (payload[UBX_NAV_PVT_VALID] & 0x03) == 0x03) {
+      rtcAdjust(ubxGet16(payload, UBX_NAV_PVT_YEAR),
+                payload[UBX_NAV_PVT_MONTH], payload[UBX_NAV_PVT_DAY],
+                payload[UBX_NAV_PVT_HOUR], payload[UBX_NAV_PVT_MIN],
+                payload[UBX_NAV_PVT_SEC]);
     }
 #endif
   }
 
-  if (msg_type == 0x0104) {
-    auto dop = (ubxNavDop_t*)payload;
-    gpsData.hdop = dop->hdop;
+  if (msg_type == UBX_NAV_DOP && msg_len >= UBX_NAV_DOP_MIN_LEN) {
+    gpsData.hdop = ubxGet16(payload, UBX_NAV_DOP_HDOP);
+  }
+}
+
+static bool isMessageDecoded(uint16_t msg_type)
+{
+  return msg_type == UBX_NAV_PVT || msg_type == UBX_NAV_DOP;
+}
+
+static void ubxChecksum(const uint8_t* data, uint32_t len, uint8_t& ck_a,
+                        uint8_t& ck_b)
+{
+  while (len--) {
+    ck_b += (ck_a += *data++);
+  }
+}
+
+// Frame entirely contained in the span: checked and decoded in place.
+// Returns the number of bytes used, 0 if the frame is not complete.
+static uint32_t gpsFrameInPlace(const uint8_t* data, uint32_t len)
+{
+  if (len < UBX_FRAME_OVERHEAD || data[1] != UBX_SYNC2) return 0;
+
+  uint16_t msg_len = ubxGet16(data, 4);
+  uint32_t frame_len = msg_len + UBX_FRAME_OVERHEAD;
+  if (len < frame_len) return 0;
+
+  uint8_t ck_a = 0, ck_b = 0;
+  ubxChecksum(&data[2], msg_len + 4, ck_a, ck_b);
+  if (data[frame_len - 2] != ck_a || data[frame_len - 1] != ck_b) {
+    // resync on the next byte
+    gpsData.errorCount++;
+    return 1;
   }
+
+  gpsProcessMessage((data[2] << 8) | data[3], msg_len, &data[UBX_HEADER_LEN]);
+  gpsData.packetCount++;
+  return frame_len;
 }
 
-bool gpsNewFrameUBX(uint8_t c, bool detect)
+enum UbxState {
+  UBX_STATE_SYNC1,
+  UBX_STATE_SYNC2,
+  UBX_STATE_CLASS,
+  UBX_STATE_ID,
+  UBX_STATE_LENGTH1,
+  UBX_STATE_LENGTH2,
+  UBX_STATE_PAYLOAD,
+  UBX_STATE_CK_A,
+  UBX_STATE_CK_B,
+};
+
+static struct {
+  uint8_t state;
+  bool discard;
+  uint16_t msg_type;
+  uint16_t msg_len;
+  uint16_t msg_pos;
+  uint8_t ck_a;
+  uint8_t ck_b;
+  uint8_t buf[UBX_BUFFER_SIZE];
+} ubx;
+
+uint32_t gpsProcessUBX(const uint8_t* data, uint32_t len, bool detect)
 {
   configureGps(detect);
 
-  const auto BUFFER_SIZE = 100u;
-  static int state = 0;
-  static uint16_t msg_type;
-  static uint16_t msg_len;
-  static uint16_t msg_pos;
-  static uint8_t buf[BUFFER_SIZE];
-  static uint8_t ck_a;
-  static uint8_t ck_b;
+  uint32_t frames = 0;
 
-  bool result = false;
+  while (len > 0) {
+    if (ubx.state == UBX_STATE_SYNC1) {
+      auto sync = (const uint8_t*)memchr(data, UBX_SYNC1, len);
+      if (!sync) break;
+      len -= sync - data;
+      data = sync;
 
-  switch (state) {
-    case 0:  // Search Sync Char 1
-      if (c == 0xb5) {
-        state = 1;
+      uint32_t used = gpsFrameInPlace(data, len);
+      if (used > 1) frames++;
+      if (used > 0) {
+        data += used;
+        len -= used;
+        continue;
       }
-      break;
-    case 1:  // Search Sync Char 2
-      if (c == 0x62) {
-        state = 2;
-      } else {
-        state = 0;
-      }
-      break;
-    case 2:  // Get message class
-      ck_b = ck_a = c;
-      msg_type = c << 8;
-      state = 3;
-      break;
-    case 3:  // Get message id
-      ck_b += (ck_a += c);
-      msg_type |= c;
-      state = 4;
-      break;
-    case 4:  // Get length 1
-      ck_b += (ck_a += c);
-      msg_len = c;
-      state = 5;
-      break;
-    case 5:  // Get length 2
-      ck_b += (ck_a += c);
-      msg_len |= c << 8;
-      msg_pos = 0;
-      if (msg_len == 0) {
-        state = 7;
+    }
+
+    if (ubx.state == UBX_STATE_PAYLOAD) {
+      // copy (or skip) as much of the payload as available
+      uint32_t count = min<uint32_t>(len, ubx.msg_len - ubx.msg_pos);
+      ubxChecksum(data, count, ubx.ck_a, ubx.ck_b);
+      if (!ubx.discard) memcpy(&ubx.buf[ubx.msg_pos], data, count);
+      ubx.msg_pos += count;
+      if (ubx.msg_pos >= ubx.msg_len) ubx.state = UBX_STATE_CK_A;
+      data += count;
+      len -= count;
+      continue;
+    }
+
+    uint8_t c = *data++;
+    len--;
+
+    switch (ubx.state) {
+      case UBX_STATE_SYNC1:
+        ubx.state = UBX_STATE_SYNC2;
         break;
-      }
-      if ((msg_type != 0x0107 && msg_type != 0x0104) || msg_len > BUFFER_SIZE) {
-        state = 9;
+      case UBX_STATE_SYNC2:
+        ubx.state = c == UBX_SYNC2 ? UBX_STATE_CLASS : UBX_STATE_SYNC1;
         break;
-      }
-      state = 6;
-      break;
-    case 6:  // Get payload
-      ck_b += (ck_a += c);
-      buf[msg_pos++] = c;
-      if (msg_pos >= msg_len) {
-        state = 7;
-      }
-      break;
-    case 7:  // Get checksum 1
-      if (c == ck_a) {
-        state = 8;
-      } else {
-        gpsData.errorCount++;
-        state = 0;
-      }
-      break;
-    case 8:  // Get checksum 2, end of frame
-      if (c == ck_b) {
-        gpsProcessMessage(msg_type, msg_len, buf);
-        gpsData.packetCount++;
-        result = true;
-      } else {
-        gpsData.errorCount++;
-      }
-      state = 0;
-      break;
-    case 9:  // Discard message
-      ck_b += (ck_a += c);
-      msg_pos++;
-      if (msg_pos >= msg_len) {
-        state = 10;
-        result = true;
-      }
-      break;
-    case 10:  // Get checksum 1 of discarded message
-      if (c == ck_a) {
-        state = 11;
-      } else {
-        gpsData.errorCount++;
-        state = 0;
-      }
-      break;
-    case 11:  // Get checksum 2 of discarded message
-      if (c == ck_b) {
-        // We have a valid UBX message
-        gpsData.packetCount++;
-        result = true;
-      } else {
-        gpsData.errorCount++;
-      }
-      state = 0;
-      break;
+      case UBX_STATE_CLASS:
+        ubx.ck_b = ubx.ck_a = c;
+        ubx.msg_type = c << 8;
+        ubx.state = UBX_STATE_ID;
+        break;
+      case UBX_STATE_ID:
+        ubx.ck_b += (ubx.ck_a += c);
+        ubx.msg_type |= c;
+        ubx.state = UBX_STATE_LENGTH1;
+        break;
+      case UBX_STATE_LENGTH1:
+        ubx.ck_b += (ubx.ck_a += c);
+        ubx.msg_len = c;
+        ubx.state = UBX_STATE_LENGTH2;
+        break;
+      case UBX_STATE_LENGTH2:
+        ubx.ck_b += (ubx.ck_a += c);
+        ubx.msg_len |= c << 8;
+        ubx.msg_pos = 0;
+        // other messages only count as valid frames
+        ubx.discard = !isMessageDecoded(ubx.msg_type) ||
+                      ubx.msg_len > UBX_BUFFER_SIZE;
+        ubx.state = ubx.msg_len ? UBX_STATE_PAYLOAD : UBX_STATE_CK_A;
+        break;
+      case UBX_STATE_CK_A:
+        if (c == ubx.ck_a) {
+          ubx.state = UBX_STATE_CK_B;
+        } else {
+          gpsData.errorCount++;
+          ubx.state = UBX_STATE_SYNC1;
+        }
+        break;
+      case UBX_STATE_CK_B:
+        if (c == ubx.ck_b) {
+          if (!ubx.discard) {
+            gpsProcessMessage(ubx.msg_type, ubx.msg_len, ubx.buf);
+          }
+          gpsData.packetCount++;
+          frames++;
+        } else {
+          gpsData.errorCount++;
+        }
+        ubx.state = UBX_STATE_SYNC1;
+        break;
+    }
   }
 
-  return result;
+  return frames;
 }
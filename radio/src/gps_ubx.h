@@ -17,4 +17,5 @@
 
 #include <inttypes.h>
 
-bool gpsNewFrameUBX(uint8_t c, bool detect);
+// Parse the received bytes, returns the number of valid frames
+uint32_t gpsProcessUBX(const uint8_t* data, uint32_t len, bool detect);
@@ -42,15 +42,91 @@
 
 pixel_t displayBuf[DISPLAY_BUFFER_SIZE] __DMA;
 
+// Pages written by the drawing functions since the last refresh
+static uint32_t lcdDirtyPages;
+
+static inline void lcdSetDirty(const uint8_t * p)
+{
+  lcdDirtyPages |= 1u << ((p - displayBuf) / LCD_W);
+}
+
+// Hash of each row as last sent, so that a redrawn screen (lcdClear() then
+// the same drawing) only sends what actually changed. Everything is sent
+// every LCD_FULL_REFRESH_PERIOD refreshes anyway, in case the LCD RAM got
+// corrupted.
+#define LCD_FULL_REFRESH_PERIOD  64
+
+static uint32_t lcdRowHash[LCD_REFRESH_ROWS];
+static bool lcdRefreshAll = true;
+static uint8_t lcdRefreshCount;
+uint32_t lcdRefreshBytes;
+
+static uint32_t lcdHashRow(const uint8_t * p)
+{
+  uint32_t hash = 2166136261u;
+  for (unsigned i = 0; i < LCD_REFRESH_ROW_SIZE; i++) {
+    hash = (hash ^ p[i]) * 16777619u;
+  }
+  return hash;
+}
+
+void lcdInvalidate()
+{
+  lcdRefreshAll = true;
+}
+
+uint32_t lcdGetRefreshRows()
+{
+  uint32_t dirty = lcdDirtyPages;
+  lcdDirtyPages = 0;
+
+  if (++lcdRefreshCount >= LCD_FULL_REFRESH_PERIOD) {
+    lcdRefreshAll = true;
+  }
+  if (lcdRefreshAll) {
+    lcdRefreshCount = 0;
+  }
+
+  uint32_t rows = 0;
+  for (unsigned i = 0; i < LCD_REFRESH_ROWS; i++) {
+    if (lcdRefreshAll || (dirty & (1u << i))) {
+      uint32_t hash = lcdHashRow(&displayBuf[i * LCD_REFRESH_ROW_SIZE]);
+      if (lcdRefreshAll || hash != lcdRowHash[i]) {
+        lcdRowHash[i] = hash;
+        rows |= 1u << i;
+      }
+    }
+  }
+
+  lcdRefreshAll = false;
+  return rows;
+}
+
 void lcdClear()
 {
   memset(displayBuf, 0, DISPLAY_BUFFER_SIZE);
+  lcdDirtyPages = (1u << LCD_REFRESH_ROWS) - 1;
 }
 
 coord_t lcdLastRightPos;
 coord_t lcdNextPos;
 coord_t lcdLastLeftPos;
 
+// Writes the rows of one column selected by 'mask', starting at the top of
+// 'page' (up to 8 pages)
+static void lcdPutColumn(coord_t x, uint8_t page, uint64_t mask, uint64_t value)
+{
+  for (unsigned i = page * LCD_W + x; mask && i < DISPLAY_BUFFER_SIZE; i += LCD_W) {
+    uint8_t m = mask;
+    if (m) {
+      displayBuf[i] = (displayBuf[i] & ~m) | (value & m);
+      lcdSetDirty(&displayBuf[i]);
+    }
+    mask >>= 8;
+    value >>= 8;
+  }
+}
+
 void lcdPutPattern(coord_t x, coord_t y, const uint8_t * pattern, uint8_t width, uint8_t height, LcdFlags flags)
 {
   bool blink = false;
@@ -71,9 +147,31 @@ void lcdPutPattern(coord_t x, coord_t y, const uint8_t * pattern, uint8_t width,
   uint8_t lines = (height+7)/8;
   assert(lines <= 5);
 
+  // The rows written are the same in every column: glyph rows, the blank row
+  // below (not for big fonts) and the blank row above when INVERS. Columns
+  // are then written a whole byte at a time, only VERTICAL text and text
+  // partly above the screen go pixel by pixel.
+  bool blit = !(flags & VERTICAL) && y >= 0;
+  uint8_t page = 0;
+  uint8_t shift = 0;
+  uint64_t rows = 0;
+  uint64_t glyphRows = 0;
+  if (blit) {
+    page = (y > 0 ? y - 1 : 0) / 8;
+    shift = y - page * 8;
+    glyphRows = bfBitmask<uint64_t>(FONTSIZE(flags) == SMLSIZE ? height + 1 : height);
+    rows = glyphRows;
+    if (height < 12 && FONTSIZE(flags) != SMLSIZE)
+      rows |= bfBit<uint64_t>(height);
+    glyphRows <<= shift;
+    rows <<= shift;
+    if (height < 12 && inv && y > 0)
+      rows |= bfBit<uint64_t>(shift - 1);
+  }
+
   for (int8_t i=0; i<width+2; i++) {
     if (x >= 0 && x < LCD_W) {
-      uint8_t b[5] = { 0 };
+      uint64_t glyph = 0;
       if (i==0) {
         if (x==0 || !inv) {
           lcdNextPos++;
@@ -87,16 +185,15 @@ void lcdPutPattern(coord_t x, coord_t y, const uint8_t * pattern, uint8_t width,
       else if (i<=width) {
         uint8_t skip = true;
         for (uint8_t j=0; j<lines; j++) {
-          b[j] = *(pattern++); /*top byte*/
-          if (b[j] != 0xff) {
+          uint8_t b = *(pattern++); /*top byte*/
+          glyph |= uint64_t(b) << (8 * j);
+          if (b != 0xff) {
             skip = false;
           }
         }
         if (skip) {
           if (flags & FIXEDWIDTH) {
-            for (uint8_t j=0; j<lines; j++) {
-              b[j] = 0;
-            }
+            glyph = 0;
           }
           else {
             continue;
@@ -108,21 +205,27 @@ void lcdPutPattern(coord_t x, coord_t y, const uint8_t * pattern, uint8_t width,
         }
       }
 
-      for (int8_t j=-1; j<=height; j++) {
-        bool plot;
-        if (j < 0 || ((j == height) && !(FONTSIZE(flags) == SMLSIZE))) {
-          plot = false;
-          if (height >= 12) continue;
-          if (j<0 && !inv) continue;
-          if (y+j < 0) continue;
-        }
-        else {
-          uint8_t line = (j / 8);
-          uint8_t pixel = (j % 8);
-          plot = b[line] & (1 << pixel);
-        }
-        if (inv) plot = !plot;
-        if (!blink) {
+      if (blink) {
+        // nothing drawn
+      }
+      else if (blit) {
+        uint64_t value = (glyph << shift) & glyphRows;
+        if (inv) value ^= rows;
+        lcdPutColumn(x, page, rows, value);
+      }
+      else {
+        for (int8_t j=-1; j<=height; j++) {
+          bool plot;
+          if (j < 0 || ((j == height) && !(FONTSIZE(flags) == SMLSIZE))) {
+            plot = false;
+            if (height >= 12) continue;
+            if (j<0 && !inv) continue;
+            if (y+j < 0) continue;
+          }
+          else {
+            plot = (glyph >> j) & 1;
+          }
+          if (inv) plot = !plot;
           if (flags & VERTICAL)
             lcdDrawPoint(y+j, LCD_H-x, plot ? FORCE : ERASE);
           else
@@ -872,6 +975,7 @@ void lcdDraw1bitBitmap(coord_t x, coord_t y, const uint8_t * img, uint8_t idx, L
       uint8_t b = inv ? ~(*q++) : *q++;
       
       if (p < DISPLAY_END) {
+        lcdSetDirty(p);
 
         if (!yShift) {
           *p = b;
@@ -880,6 +984,7 @@ void lcdDraw1bitBitmap(coord_t x, coord_t y, const uint8_t * img, uint8_t idx, L
           *p = (*p & ((1 << yShift) - 1)) | (b << yShift);
 
           if (p + LCD_W < DISPLAY_END) {
+            lcdSetDirty(p + LCD_W);
             p[LCD_W] = (p[LCD_W] & (0xFF >> yShift)) | (b >> (8 - yShift));
           }
         }
@@ -907,6 +1012,7 @@ void lcdSetContrast(bool useDefault)
 void lcdMaskPoint(uint8_t * p, uint8_t mask, LcdFlags att)
 {
   ASSERT_IN_DISPLAY(p);
+  lcdSetDirty(p);
 
   if (att & FORCE)
     *p |= mask;
@@ -930,6 +1036,7 @@ void lcdInvertLine(int8_t line)
   if (line >= LCD_LINES) return;
 
   uint8_t *p  = &displayBuf[line * LCD_W];
+  lcdSetDirty(p);
   for (coord_t x=0; x<LCD_W; x++) {
     ASSERT_IN_DISPLAY(p);
     *p++ ^= 0xff;
@@ -41,6 +41,59 @@
 
 pixel_t displayBuf[DISPLAY_BUFFER_SIZE] __DMA;
 
+// Hash of each row as last sent, so that a redrawn screen (lcdClear() then
+// the same drawing) only sends what actually changed. Everything is sent
+// every LCD_FULL_REFRESH_PERIOD refreshes anyway, in case the LCD RAM got
+// corrupted.
+#define LCD_FULL_REFRESH_PERIOD  64
+
+static uint32_t lcdRowHash[LCD_REFRESH_ROWS];
+static bool lcdRefreshAll = true;
+static uint8_t lcdRefreshCount;
+uint32_t lcdRefreshBytes;
+
+static uint32_t lcdHashRow(const uint8_t * p)
+{
+  uint32_t hash = 2166136261u;
+  for (unsigned i = 0; i < LCD_REFRESH_ROW_SIZE; i++) {
+    hash = (hash ^ p[i]) * 16777619u;
+  }
+  return hash;
+}
+
+void lcdInvalidate()
+{
+  lcdRefreshAll = true;
+}
+
+uint32_t lcdGetRefreshRows()
+{
+  // the drawing functions don't track the rows they write to: all rows are
+  // compared
+  uint32_t dirty = UINT32_MAX;
+
+  if (++lcdRefreshCount >= LCD_FULL_REFRESH_PERIOD) {
+    lcdRefreshAll = true;
+  }
+  if (lcdRefreshAll) {
+    lcdRefreshCount = 0;
+  }
+
+  uint32_t rows = 0;
+  for (unsigned i = 0; i < LCD_REFRESH_ROWS; i++) {
+    if (lcdRefreshAll || (dirty & (1u << i))) {
+      uint32_t hash = lcdHashRow(&displayBuf[i * LCD_REFRESH_ROW_SIZE]);
+      if (lcdRefreshAll || hash != lcdRowHash[i]) {
+        lcdRowHash[i] = hash;
+        rows |= 1u << i;
+      }
+    }
+  }
+
+  lcdRefreshAll = false;
+  return rows;
+}
+
 inline bool lcdIsPointOutside(coord_t x, coord_t y)
 {
   return (x<0 || x>=LCD_W || y<0 || y>=LCD_H);
@@ -96,6 +96,19 @@ extern coord_t lcdNextPos;
 #define DISPLAY_END                    (displayBuf + DISPLAY_BUFFER_SIZE)
 #define ASSERT_IN_DISPLAY(p)           assert((p) >= displayBuf && (p) < DISPLAY_END)
 
+// Display refresh: the drivers only send the rows of LCD_REFRESH_ROW_SIZE
+// bytes of displayBuf (2 pixel lines) which changed since the
+// previous refresh
+#define LCD_REFRESH_ROWS               (LCD_H / 2)
+#define LCD_REFRESH_ROW_SIZE           LCD_W
+
+// Rows to send (1 bit per row), to be called once per refresh
+uint32_t lcdGetRefreshRows();
+// Next refresh sends all rows (e.g. LCD reset)
+void lcdInvalidate();
+// Bytes sent to the LCD
+extern uint32_t lcdRefreshBytes;
+
 void lcdDrawChar(coord_t x, coord_t y, uint8_t c);
 void lcdDrawChar(coord_t x, coord_t y, uint8_t c, LcdFlags mode);
 void lcdDrawCenteredText(coord_t y, const char * s, LcdFlags flags = 0);
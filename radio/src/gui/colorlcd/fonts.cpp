@@ -22,6 +22,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "definitions.h"
 #include "fonts.h"
 #include "lz4/lz4.h"
 #include "libopenui_defines.h"
@@ -79,8 +80,100 @@ FONT_TABLE(en);
 
 } // extern "C"
 
+/*
+  Glyph blocks cache, shared by all the fonts using the block format.
+*/
+
+#if defined(TRANSLATIONS_CN) || defined(TRANSLATIONS_TW) || \
+    defined(TRANSLATIONS_JP) || defined(TRANSLATIONS_KO)
+  #define FONT_BLOCK_CACHE_SLOTS 32
+#else
+  // no font in block format in the font table
+  #define FONT_BLOCK_CACHE_SLOTS 2
+#endif
+
+struct FontBlockCacheSlot {
+  const etxLz4Font* font;
+  uint32_t block;
+  uint32_t lastUse;
+};
+
+static FontBlockCacheSlot fontBlockCache[FONT_BLOCK_CACHE_SLOTS];
+static uint8_t fontBlockCacheData[FONT_BLOCK_CACHE_SLOTS][ETX_FONT_BLOCK_SIZE] __SDRAMFONTS;
+static uint32_t fontBlockCacheClock = 0;
+
+static const uint8_t* getFontBlock(const etxLz4Font* etxFont, uint32_t block)
+{
+  fontBlockCacheClock += 1;
+
+  int lru = 0;
+  for (int i = 0; i < FONT_BLOCK_CACHE_SLOTS; i += 1) {
+    FontBlockCacheSlot& slot = fontBlockCache[i];
+    if (slot.font == etxFont && slot.block == block) {
+      slot.lastUse = fontBlockCacheClock;
+      return fontBlockCacheData[i];
+    }
+    if (slot.lastUse < fontBlockCache[lru].lastUse) lru = i;
+  }
+
+  // Miss: decompress the block into the least recently used slot
+  FontBlockCacheSlot& slot = fontBlockCache[lru];
+  const etxFontBlock& blk = etxFont->blocks[block];
+  int size = LZ4_decompress_safe(
+      (const char*)&etxFont->compressed_bitmap[blk.comp_offset],
+      (char*)fontBlockCacheData[lru], blk.comp_size, ETX_FONT_BLOCK_SIZE);
+  if (size != blk.size) {
+    slot.font = nullptr;
+    slot.lastUse = 0;
+    return nullptr;
+  }
+
+  slot.font = etxFont;
+  slot.block = block;
+  slot.lastUse = fontBlockCacheClock;
+  return fontBlockCacheData[lru];
+}
+
+// 'get_glyph_bitmap' callback for fonts using the block format
+static const uint8_t* getFontBlockGlyphBitmap(const lv_font_t* font,
+                                              uint32_t letter)
+{
+  auto fdsc = (const lv_font_fmt_txt_dsc_t*)font->dsc;
+
+  // The glyph descriptor is always requested first, so the glyph id is
+  // usually found in the font cache
+  if (letter == '\t') letter = ' ';
+  if (fdsc->cache->last_letter != letter) {
+    lv_font_glyph_dsc_t dsc;
+    if (!lv_font_get_glyph_dsc_fmt_txt(font, &dsc, letter, 0)) return nullptr;
+  }
+
+  uint32_t gid = fdsc->cache->last_glyph_id;
+  if (!gid) return nullptr;
+
+  auto etxFont = (const etxLz4Font*)font->user_data;
+  uint32_t index = fdsc->glyph_dsc[gid].bitmap_index;
+
+  // Find the last block starting before the glyph
+  uint32_t lo = 0, hi = etxFont->block_count;
+  while (hi - lo > 1) {
+    uint32_t mid = (lo + hi) / 2;
+    if (etxFont->blocks[mid].bitmap_index <= index)
+      lo = mid;
+    else
+      hi = mid;
+  }
+
+  const uint8_t* data = getFontBlock(etxFont, lo);
+  if (!data) return nullptr;
+
+  return data + (index - etxFont->blocks[lo].bitmap_index);
+}
+
 /*
   Decompress an LZ4 font and build LVGL font structures.
+  For fonts in block format, only the glyph descriptors, cmaps and kerning
+  data are decompressed here, glyph bitmaps are decompressed when drawn.
 */
 void decompressFont(int idx)
 {
@@ -138,6 +231,10 @@ void decompressFont(int idx)
   lvglFont->get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
   lvglFont->get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
   lvglFont->dsc = lvglFontDsc;
+  if (etxFont->block_count) {
+    lvglFont->get_glyph_bitmap = getFontBlockGlyphBitmap;
+    lvglFont->user_data = (void*)etxFont;
+  }
   // Fill in other properties
   lvglFont->line_height = etxFont->line_height;
   lvglFont->base_line = etxFont->base_line;
@@ -147,7 +244,8 @@ void decompressFont(int idx)
 
   // Rebuild the lv_font_fmt_txt_dsc_t structure
   // Relocate pointers
-  lvglFontDsc->glyph_bitmap = &next[etxFont->glyph_bitmap];
+  lvglFontDsc->glyph_bitmap =
+      etxFont->block_count ? nullptr : &next[etxFont->glyph_bitmap];
   lvglFontDsc->glyph_dsc = (lv_font_fmt_txt_glyph_dsc_t*)&next[0];
   lvglFontDsc->cmaps = lvglCmaps;
   lvglFontDsc->kern_dsc = lvglKernClasses;
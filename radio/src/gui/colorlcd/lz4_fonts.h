@@ -30,8 +30,22 @@
 
     Note: this is dependant on the LVGL font structure formats. If
           the LVGL version changes, re-check the LVGL font structures.
+
+    Large fonts (CJK) use the 'block' format: glyph bitmaps are not part of
+    the compressed data, they are LZ4 compressed in independent blocks of at
+    most ETX_FONT_BLOCK_SIZE bytes (a glyph never spans two blocks), which are
+    decompressed on demand into a small LRU cache when a glyph is drawn.
 */
 
+#define ETX_FONT_BLOCK_SIZE  4096
+
+typedef struct {
+    uint32_t bitmap_index;              // offset of the first glyph in the uncompressed bitmap
+    uint32_t comp_offset;               // offset of the block in the compressed bitmap data
+    uint16_t size;                      // uncompressed size
+    uint16_t comp_size;                 // compressed size
+} etxFontBlock;
+
 typedef struct {
     // Properties used to reconstitute the LVGL 'cmaps' array
     uint16_t range_start;               // lv_font_fmt_txt_cmap_t.range_start
@@ -79,4 +93,9 @@ typedef struct {
     const uint8_t* compressed;
     uint8_t* lvglFontBuf;
     uint32_t lvglFontBufSize;
+
+    // Block format only (glyph_bitmap is then unused)
+    uint32_t block_count;
+    const etxFontBlock* blocks;
+    const uint8_t* compressed_bitmap;
 } etxLz4Font;
@@ -27,6 +27,7 @@
 #include "tasks/mixer_task.h"
 #include "mixer_scheduler.h"
 #include "lua/lua_states.h"
+#include "lua/lua_widget.h"
 
 class StatisticsViewPage : public PageTab
 {
@@ -314,6 +315,51 @@ void DebugViewPage::build(Window* window)
   new DebugInfoNumber<uint32_t>(
       line, rect_t{0, 0, DBG_B_WIDTH, DBG_B_HEIGHT},
       [] { return luaExtraMemoryUsage; }, STR_MEM_USED_EXTRA);
+
+  // Lua widgets refresh data
+  if (LuaWidget::getInstancesCount() > 0) {
+    line = window->newLine(grid);
+    line->padAll(PAD_TINY);
+    new StaticText(line, rect_t{}, STR_LUA_WIDGETS_LABEL);
+  }
+
+  for (uint8_t i = 0; i < LuaWidget::getInstancesCount(); i++) {
+    line = window->newLine(grid);
+    line->padAll(PAD_ZERO);
+    line->padLeft(PAD_LARGE);
+
+    new DynamicText(line, rect_t{0, 0, DBG_B_WIDTH, DBG_B_HEIGHT}, [=] {
+      auto widget = LuaWidget::getInstance(i);
+      return std::string(widget ? widget->getFactory()->getDisplayName() : "");
+    });
+
+#if PORTRAIT
+    line = window->newLine(grid);
+    line->padAll(PAD_ZERO);
+    line->padLeft(PAD_LARGE);
+#endif
+
+    // average refresh() duration
+    new DebugInfoNumber<uint32_t>(
+        line, rect_t{0, 0, DBG_B_WIDTH, DBG_B_HEIGHT},
+        [=] {
+          auto widget = LuaWidget::getInstance(i);
+          if (!widget) return (uint32_t)0;
+          auto& stats = widget->getRefreshStats();
+          return stats.calls ? stats.totalTime / stats.calls : 0;
+        },
+        STR_REFRESH_US);
+    new DebugInfoNumber<uint32_t>(
+        line, rect_t{0, 0, DBG_B_WIDTH, DBG_B_HEIGHT},
+        [=] {
+          auto widget = LuaWidget::getInstance(i);
+          if (!widget) return (uint32_t)0;
+          auto& stats = widget->getRefreshStats();
+          uint32_t total = stats.calls + stats.skipped;
+          return total ? stats.skipped * 100 / total : 0;
+        },
+        STR_SKIPPED_PERCENT);
+  }
 #endif
 
   line = window->newLine(grid);
@@ -386,6 +432,8 @@ void DebugViewPage::build(Window* window)
 #if defined(LUA)
                               maxLuaInterval = 0;
                               maxLuaDuration = 0;
+                              for (uint8_t i = 0; i < LuaWidget::getInstancesCount(); i++)
+                                LuaWidget::getInstance(i)->resetRefreshStats();
 #endif
                               return 0;
                             });
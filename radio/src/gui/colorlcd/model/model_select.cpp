@@ -333,6 +333,9 @@ class ModelsPageBody : public Window
     if (g_eeGeneral.modelQuickSelect ||
         focusedModel != modelslist.getCurrentModel()) {
       menu->addLine(STR_SELECT_MODEL, [=]() { selectModel(focusedModel); });
+      // parse the model while the user decides
+      if (focusedModel != modelslist.getCurrentModel())
+        modelPreloadStart(focusedModel->modelFilename);
     }
     menu->addLine(STR_DUPLICATE_MODEL, [=]() { duplicateModel(focusedModel); });
     menu->addLine(STR_LABEL_MODEL, [=]() { editLabels(focusedModel); });
@@ -347,6 +350,8 @@ class ModelsPageBody : public Window
     // Don't need to check connection to receiver if re-selecting the active
     // model
     if (model != modelslist.getCurrentModel()) {
+      modelPreloadStart(model->modelFilename);
+
       bool modelConnected =
           TELEMETRY_STREAMING() && !g_eeGeneral.disableRssiPoweroffAlarm;
       if (modelConnected) {
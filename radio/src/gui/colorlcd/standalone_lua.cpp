@@ -25,6 +25,7 @@
 #include "view_main.h"
 #include "dma2d.h"
 #include "lua/lua_event.h"
+#include "lua/custom_allocator.h"
 
 #if defined(_WIN32) || defined(_WIN64)
 #define strcasecmp _stricmp
@@ -55,7 +56,7 @@ static void luaStandaloneHook(lua_State * L, lua_Debug *ar)
 static void luaStandaloneInit()
 {
 #if defined(USE_CUSTOM_ALLOCATOR)
-  lsStandalone = lua_newstate(custom_l_alloc, nullptr);   //we use our own allocator!
+  lsStandalone = lua_newstate(custom_l_alloc, custom_l_arena(LUA_ARENA_SCRIPTS));   //we use our own allocator!
 #elif defined(LUA_ALLOCATOR_TRACER)
   memclear(&lsStandaloneTrace, sizeof(lsStandaloneTrace));
   lsStandaloneTrace.script = "lua_newstate(scripts)";
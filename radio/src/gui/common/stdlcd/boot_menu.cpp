@@ -132,6 +132,9 @@ void bootloaderDrawScreen(BootloaderState st, int opt, const char *str)
   else if (st == ST_FLASH_DONE) {
     lcdDrawCenteredText(4 * FH, TR_BL_WRITING_COMPL);
   }
+  else if (st == ST_FLASH_FAILED) {
+    lcdDrawCenteredText(4 * FH, TR_BL_WRITING_FAILED);
+  }
 }
 
 uint32_t bootloaderGetMenuItemCount(int baseCount)
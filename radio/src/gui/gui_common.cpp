@@ -549,9 +549,11 @@ bool isSerialModeAvailable(uint8_t port_nr, int mode)
 #if !defined(CLI)
   if (mode == UART_MODE_CLI) return false;
 #else
+#if !defined(SIMU)
   // CLI is only supported on VCP
   if (port_nr != SP_VCP && mode == UART_MODE_CLI) return false;
 #endif
+#endif
 
 #if !defined(INTERNAL_GPS)
   if (mode == UART_MODE_GPS)
@@ -22,22 +22,29 @@
 #include "edgetx.h"
 #include "hal.h"
 #include "debug.h"
-#define _USE_MATH_DEFINES
-#include <math.h>
-
-#define ACC_LSB_VALUE	0.000488  // 0.488 mg/LSB
-
-#define ALPHA 0.98
-#define DT    0.01
-#define SCALE_FACT_ACC  0.005
-#define SCALE_FACT_GYRO 0.0078 // 250deg/s / 32000
 
 Gyro gyro;
 
-static float deg2RESX(float deg)
+// Q15 coefficient of a first order filter with a 'tau' ms time constant
+static uint16_t filterAlpha(uint32_t tau, uint32_t rate)
 {
-  // [-90 : 90] -> [-RESX : RESX]
-  return (deg * float(RESX)) / 90.0;
+  return (32768 * tau * rate) / (tau * rate + 1000);
+}
+
+void Gyro::init()
+{
+  gyroInit();
+
+  const ImuSensorInfo& info = gyroSensorInfo();
+  ImuFusionConfig config = {
+      info.sampleRate,
+      info.gyroRange,
+      info.accelOneG,
+      filterAlpha(IMU_FUSION_TAU, info.sampleRate),
+      filterAlpha(IMU_LPF_TAU, info.sampleRate),
+      IMU_FUSION_MODE,
+  };
+  fusion.init(config);
 }
 
 void Gyro::wakeup()
@@ -50,8 +57,9 @@ void Gyro::wakeup()
 
   gyroWakeupTime = now + 1; /* 10ms default */
 
-  int16_t values[IMU_VALUES_COUNT];
-  if (gyroRead((uint8_t*)values) < 0) {
+  int16_t samples[IMU_FIFO_SAMPLES][IMU_VALUES_COUNT];
+  int count = gyroReadSamples(samples, IMU_FIFO_SAMPLES);
+  if (count < 0) {
     ++errors;
     return;
   }
@@ -61,42 +69,30 @@ void Gyro::wakeup()
   // stopping the sensor forever
   errors = 0;
 
+  if (count == 0) return;
+
+  for (int i = 0; i < count; i++) {
+#if !defined(IMU_ICM4207C)
+    // LSM6DS mounting: roll integrates -gyro x, pitch comes from +accel x
+    samples[i][0] = -samples[i][0];
+    samples[i][3] = -samples[i][3];
+#endif
+    fusion.update(&samples[i][0], &samples[i][3]);
+  }
+
 #if defined(IMU_ICM4207C)
-  raw_ax = values[3];
-  raw_ay = values[4];
+  raw_ax = fusion.accel(0);
+  raw_ay = fusion.accel(1);
   int16_t ax = raw_ax - offset_x;
   int16_t ay = raw_ay - offset_y;
 
   // Use only ACC value, they are really reliable
-  outputs[0] = (ax * float(RESX)) / range_x;
-  outputs[1] = (ay * float(RESX)) / range_y;
+  outputs[0] = ((int32_t)ax * RESX) / range_x;
+  outputs[1] = ((int32_t)ay * RESX) / range_y;
 #else
-  int16_t ax = values[3];
-  int16_t ay = values[4];
-  int16_t az = values[5];
-
-  int16_t gx = values[0];
-  int16_t gy = values[1];
-  int16_t gz = values[2];
-
-  // integrate gyro
-  roll  -= gx * SCALE_FACT_GYRO * DT;
-  pitch += gy * SCALE_FACT_GYRO * DT;
-
-  int32_t magn = abs(ax) + abs(ay) + abs(az);
-  if (magn > 8192 && magn < 32768) {
-
-    if (az < 0) az = -az;
-        
-    float rollAcc  = atan2f((float)ay,(float)az) * 57.3 /* 180/PI */;
-    float pitchAcc = atan2f((float)ax,(float)az) * 57.3 /* 180/PI */;
-
-    roll  = roll  * ALPHA + rollAcc  * (1.0-ALPHA);
-    pitch = pitch * ALPHA + pitchAcc * (1.0-ALPHA);
-  }
-
-  outputs[0] = deg2RESX(roll);
-  outputs[1] = deg2RESX(pitch);
+  // [-90 : 90] -> [-RESX : RESX]
+  outputs[0] = fusion.roll() / (IMU_ANGLE_90 / RESX);
+  outputs[1] = fusion.pitch() / (IMU_ANGLE_90 / RESX);
 #endif
 }
 
@@ -21,6 +21,7 @@
 
 #include <inttypes.h>
 #include "myeeprom.h"
+#include "imu_fusion.h"
 
 #define IMU_VALUES_COUNT      6
 #define IMU_BUFFER_LENGTH     (IMU_VALUES_COUNT * sizeof(int16_t))
@@ -33,12 +34,27 @@
 #define IMU_SAMPLES_EXPONENT  3
 #define IMU_SAMPLES_COUNT     (2 ^ IMU_SAMPLES_EXPONENT)
 
+// Sensor FIFO rate (closest supported one), in Hz
+#if !defined(IMU_SAMPLE_RATE)
+  #define IMU_SAMPLE_RATE     200
+#endif
+
+// Samples processed per wakeup, at most
+#define IMU_FIFO_SAMPLES      16
+
+// Filter time constants (ms): they do not depend on the sample rate
+#define IMU_FUSION_TAU        490
+#define IMU_LPF_TAU           95
+
+#if !defined(IMU_FUSION_MODE)
+  #define IMU_FUSION_MODE     IMU_FUSION_EULER
+#endif
+
 class Gyro
 {
  protected:
   uint8_t errors = 0;
-  float roll = 0.0;
-  float pitch = 0.0;
+  ImuFusion fusion;
   int16_t offset_x = 0;
   int16_t offset_y = 0;
   int16_t range_x = 8192;
@@ -49,6 +65,7 @@ class Gyro
  public:
   int16_t outputs[2];
 
+  void init();
   void wakeup();
   void setIMU_X(int16_t, int16_t);
   void setIMU_Y(int16_t, int16_t);
@@ -60,5 +77,15 @@ class Gyro
 extern Gyro gyro;
 
 // Gyro driver
+struct ImuSensorInfo {
+  uint16_t sampleRate;  // Hz
+  uint16_t gyroRange;   // dps at full scale
+  uint16_t accelOneG;   // LSB / g
+};
+
 int gyroInit();
-int gyroRead(uint8_t buffer[IMU_BUFFER_LENGTH]);
+const ImuSensorInfo& gyroSensorInfo();
+
+// Reads at most 'count' samples buffered by the sensor FIFO, oldest first
+// (gyro x/y/z, accel x/y/z). Returns the number of samples read, -1 on error
+int gyroReadSamples(int16_t samples[][IMU_VALUES_COUNT], uint8_t count);
@@ -32,10 +32,14 @@ const etx_hal_adc_inputs_t* _hal_adc_inputs = nullptr;
 
 static uint16_t adcValues[MAX_ANALOG_INPUTS] __DMA_NO_CACHE;
 
+static void initFilterDefaults();
+
 bool adcInit(const etx_hal_adc_driver_t* driver)
 {
   // Init buffer, provides non random values before mixer task starts
   memset(adcValues, 0, sizeof(adcValues));
+  initFilterDefaults();
+  adcPipelineInvalidate();
 
   // If there is an init function, it MUST succeed
   if (driver && (!driver->init || driver->init())) {
@@ -126,6 +130,8 @@ static void writeAnalogCalib(uint8_t input, int16_t low, int16_t mid, int16_t hi
 
   v = high - mid;
   calib.spanPos = v - v / STICK_TOLERANCE;
+
+  adcPipelineInvalidate();
 }
 
 static void writeXPotCalib(uint8_t input, int16_t* steps, uint8_t n_steps)
@@ -138,6 +144,8 @@ static void writeXPotCalib(uint8_t input, int16_t* steps, uint8_t n_steps)
   for (int i = 0; i < calib->count; i++) {
     calib->steps[i] = (steps[i + 1] + steps[i]) >> XPOT_CALIB_SHIFT;
   }
+
+  adcPipelineInvalidate();
 }
 
 void adcCalibSetMinMax()
@@ -291,6 +299,7 @@ void anaSetFiltered(uint8_t chan, uint16_t val)
 void anaResetFiltered()
 {
   memset(s_anaFilt, 0, sizeof(s_anaFilt));
+  adcPipelineInvalidate();
 }
 
 #if defined(JITTER_MEASURE)
@@ -299,8 +308,139 @@ JitterMeter<uint16_t> avgJitter[MAX_ANALOG_INPUTS];
 tmr10ms_t jitterResetTime = 0;
 #endif
 
-static uint32_t apply_low_pass_filter(uint32_t v, uint32_t v_prev,
-                                      bool is_main_input)
+// Input pipeline
+//
+// Everything getADC() needs to know about an input (calibration, inversion,
+// filter, multipos) is resolved once in buildPipeline(), so that each stage
+// runs as a simple loop over all inputs, without looking up the settings
+// again for each input on every mixer cycle.
+
+#define ALPHA_MULT  (JITTER_ALPHA * ANALOG_MULTIPLIER)
+
+// 1€ filter (fixed point, per sample at ~500Hz):
+//  - value and speed in Q8, alpha in Q10
+//  - min cutoff and speed cutoff ~1Hz: alpha = 1 / (1 + 1 / (2*pi*fc*Te))
+//  - beta: a full travel in ~0.2s removes any filtering
+#define ONE_EURO_SHIFT      8
+#define ONE_EURO_ALPHA_ONE  1024
+#define ONE_EURO_ALPHA_MIN  13
+#define ONE_EURO_ALPHA_D    13
+#define ONE_EURO_BETA       25
+
+struct OneEuroState {
+  int32_t value;  // Q8
+  int32_t speed;  // Q8 per sample
+};
+
+struct AdcPipeline {
+  uint8_t count;
+  bool calib[MAX_ANALOG_INPUTS];
+  int16_t mid2[MAX_ANALOG_INPUTS];
+  uint32_t recipNeg[MAX_ANALOG_INPUTS];
+  uint32_t recipPos[MAX_ANALOG_INPUTS];
+  int16_t invOffset[MAX_ANALOG_INPUTS];  // v = invOffset + invSign * v
+  int8_t invSign[MAX_ANALOG_INPUTS];
+  uint8_t filter[MAX_ANALOG_INPUTS];
+  const StepsCalibData* multipos[MAX_ANALOG_INPUTS];
+};
+
+static AdcPipeline pipeline;
+static bool pipelineDirty = true;
+static uint8_t adcFilters[MAX_ANALOG_INPUTS];
+static uint16_t medianHistory[MAX_ANALOG_INPUTS][2];
+static OneEuroState oneEuroState[MAX_ANALOG_INPUTS];
+
+void adcPipelineInvalidate()
+{
+  pipelineDirty = true;
+}
+
+void adcSetInputFilter(uint8_t index, uint8_t filter)
+{
+  if (index >= MAX_ANALOG_INPUTS || filter >= ADC_FILTER_COUNT) return;
+  adcFilters[index] = filter;
+  adcPipelineInvalidate();
+}
+
+uint8_t adcGetInputFilter(uint8_t index)
+{
+  if (index >= MAX_ANALOG_INPUTS) return ADC_FILTER_NONE;
+  return adcFilters[index];
+}
+
+static void initFilterDefaults()
+{
+  for (uint8_t x = 0; x < MAX_ANALOG_INPUTS; x++) {
+    adcFilters[x] = ADC_FILTER_DEFAULT;
+  }
+}
+
+static bool isJitterFilterEnabled()
+{
+  // Combine ADC jitter filter setting form radio and model.
+  // Model can override (on or off) or use setting from radio setup.
+  // Model setting is active when 1, radio setting is active when 0
+  // Please note: these settings only apply to main controls.
+  if (g_model.jitterFilter == OVERRIDE_GLOBAL) {
+    // Use radio setting - which is inverted
+    return !g_eeGeneral.noJitterFilter;
+  }
+  // Enable if value is "On", disable if "Off"
+  return g_model.jitterFilter == OVERRIDE_ON;
+}
+
+static void buildPipeline()
+{
+  // cleared first: an invalidation while building triggers another build
+  pipelineDirty = false;
+
+  auto max_analogs = adcGetMaxInputs(ADC_INPUT_ALL);
+  auto max_mains = adcGetMaxInputs(ADC_INPUT_MAIN);
+  auto max_pots = adcGetMaxInputs(ADC_INPUT_FLEX);
+  auto pot_offset = adcGetInputOffset(ADC_INPUT_FLEX);
+  auto max_calib_analogs = adcGetMaxCalibratedInputs();
+  bool mainFilter = isJitterFilterEnabled();
+
+  pipeline.count = max_analogs;
+
+  for (uint8_t x = 0; x < max_analogs; x++) {
+    bool is_flex_input = (x >= pot_offset) && (x < pot_offset + max_pots);
+    bool is_multipos = is_flex_input && IS_POT_MULTIPOS(x - pot_offset);
+
+    const auto& calib = g_eeGeneral.calib[x];
+#if defined(SIMU)
+    // Simu uses normed inputs
+    pipeline.calib[x] = false;
+#else
+    pipeline.calib[x] = x < max_calib_analogs && !is_multipos;
+#endif
+    pipeline.mid2[x] = 2 * calib.mid;
+    pipeline.recipNeg[x] = adcCalibRecip(max((int16_t)100, calib.spanNeg));
+    pipeline.recipPos[x] = adcCalibRecip(max((int16_t)100, calib.spanPos));
+
+    bool inverted =
+        (x < pot_offset && getStickInversion(inputMappingConvertMode(x))) ||
+        (is_flex_input && getPotInversion(x - pot_offset));
+    pipeline.invOffset[x] = inverted ? 4 * RESX : 0;
+    pipeline.invSign[x] = inverted ? -1 : 1;
+
+    uint8_t filter = adcFilters[x];
+    if (x < max_mains && !mainFilter) filter = ADC_FILTER_NONE;
+    pipeline.filter[x] = filter;
+
+    // filter states start from the current output (no step on rebuild)
+    uint16_t v = s_anaFilt[x] / JITTER_ALPHA;
+    medianHistory[x][0] = medianHistory[x][1] = v;
+    oneEuroState[x].value = (int32_t)v << ONE_EURO_SHIFT;
+    oneEuroState[x].speed = 0;
+
+    const auto* steps = (const StepsCalibData*)&calib;
+    pipeline.multipos[x] =
+        is_multipos && IS_MULTIPOS_CALIBRATED(steps) ? steps : nullptr;
+  }
+}
+
+static uint32_t apply_low_pass_filter(uint32_t v, uint32_t v_prev)
 {
   // Jitter filter:
   //    * pass trough any big change directly
@@ -337,61 +477,49 @@ static uint32_t apply_low_pass_filter(uint32_t v, uint32_t v_prev,
   uint32_t previous = v_prev / JITTER_ALPHA;
   uint32_t diff = (v > previous) ? (v - previous) : (previous - v);
 
-  // Combine ADC jitter filter setting form radio and model.
-  // Model can override (on or off) or use setting from radio setup.
-  // Model setting is active when 1, radio setting is active when 0
-  // Please note: these settings only apply to main controls.
-  bool useJitterFilter = true;
-  if (is_main_input) {
-    if (g_model.jitterFilter == OVERRIDE_GLOBAL) {
-      // Use radio setting - which is inverted
-      useJitterFilter = !g_eeGeneral.noJitterFilter;
-    } else {
-      // Enable if value is "On", disable if "Off"
-      useJitterFilter = (g_model.jitterFilter == OVERRIDE_ON);
-    }
-  }
-
-  uint32_t out;
-  if (useJitterFilter && diff < (10 * ANALOG_MULTIPLIER)) {
+  if (diff < (10 * ANALOG_MULTIPLIER)) {
     // apply jitter filter
-    out = (v_prev - previous) + v;
-  } else {
-    // use unfiltered value
-    out = v * JITTER_ALPHA;
+    return (v_prev - previous) + v;
   }
 
-  return out;
+  // use unfiltered value
+  return v * JITTER_ALPHA;
+}
+
+static uint32_t apply_median3(uint16_t* history, uint32_t v)
+{
+  uint32_t a = history[0], b = history[1];
+  history[1] = a;
+  history[0] = v;
+
+  uint32_t lo = min(a, b), hi = max(a, b);
+  return (v < lo ? lo : (v > hi ? hi : v)) * JITTER_ALPHA;
 }
 
-static uint32_t apply_calibration(const CalibData* calib, uint32_t v)
+static uint32_t apply_one_euro(OneEuroState* state, uint32_t v)
 {
-  // Simu uses normed inputs
-#if !defined(SIMU)
-  // Apply calibration relative to mid-point
-  int32_t s = v - 2 * calib->mid;
-  s = s * (int32_t)RESX /
-      (max((int16_t)100, (s > 0 ? calib->spanPos : calib->spanNeg)));
+  int32_t in = (int32_t)v << ONE_EURO_SHIFT;
+  constexpr int32_t round = ONE_EURO_ALPHA_ONE / 2;
 
-  // Translate back in range
-  s += 2 * RESX;
+  // low-passed speed raises the cutoff: slow moves are smoothed,
+  // fast moves follow the input without lag
+  int32_t speed = in - state->value;
+  state->speed +=
+      ((speed - state->speed) * ONE_EURO_ALPHA_D + round) / ONE_EURO_ALPHA_ONE;
 
-  // Limit values to supported range
-  if (s < 0) {
-    s = 0;
-  } else if (s > 4 * RESX) {
-    s = 4 * RESX;
-  }
+  int32_t alpha = ONE_EURO_ALPHA_MIN +
+                  ((abs(state->speed) * ONE_EURO_BETA) >> ONE_EURO_SHIFT);
+  if (alpha > ONE_EURO_ALPHA_ONE) alpha = ONE_EURO_ALPHA_ONE;
 
-  v = s;
-#endif
+  state->value += ((in - state->value) * alpha + round) / ONE_EURO_ALPHA_ONE;
 
-  return v;
+  // Q8 -> ALPHA units
+  constexpr int32_t shift = ONE_EURO_SHIFT - JITTER_FILTER_STRENGTH;
+  return (state->value + (1 << (shift - 1))) >> shift;
 }
 
 static uint32_t apply_multipos(const StepsCalibData* calib, uint32_t v)
 {
-  constexpr uint32_t ALPHA_MULT = JITTER_ALPHA * ANALOG_MULTIPLIER;
   constexpr uint32_t ANAFILT_MAX = 2 * RESX * ALPHA_MULT;
 
   // TODO: consider adding another low pass filter to eliminate multipos
@@ -409,16 +537,10 @@ static uint32_t apply_multipos(const StepsCalibData* calib, uint32_t v)
 
 void getADC()
 {
-  auto max_analogs = adcGetMaxInputs(ADC_INPUT_ALL);
-  auto max_mains = adcGetMaxInputs(ADC_INPUT_MAIN);
-  auto max_pots = adcGetMaxInputs(ADC_INPUT_FLEX);
-  auto pot_offset = adcGetInputOffset(ADC_INPUT_FLEX);
-  auto max_calib_analogs = adcGetMaxCalibratedInputs();
-
 #if defined(JITTER_MEASURE)
   if (JITTER_MEASURE_ACTIVE() && jitterResetTime < get_tmr10ms()) {
     // reset jitter measurement every second
-    for (uint32_t x = 0; x < max_analogs; x++) {
+    for (uint32_t x = 0; x < adcGetMaxInputs(ADC_INPUT_ALL); x++) {
       rawJitter[x].reset();
       avgJitter[x].reset();
     }
@@ -430,43 +552,62 @@ void getADC()
   if (!adcRead()) { TRACE("adcRead failed"); }
   DEBUG_TIMER_STOP(debugTimerAdcRead);
 
-  for (uint8_t x = 0; x < max_analogs; x++) {
+  if (pipelineDirty) buildPipeline();
 
-    bool is_flex_input = (x >= pot_offset) && (x < pot_offset + max_pots);
-    bool is_multipos = is_flex_input && IS_POT_MULTIPOS(x - pot_offset);
+  const uint8_t count = pipeline.count;
+  int32_t values[MAX_ANALOG_INPUTS];
 
-    // 1st: apply calibration
-    uint32_t v = getAnalogValue(x);
+  for (uint8_t x = 0; x < count; x++) {
+    values[x] = getAnalogValue(x);
+  }
 
-    if (x < max_calib_analogs && !is_multipos) {
-      v = apply_calibration(&g_eeGeneral.calib[x], v);
-    }
+  // 1st: apply calibration (relative to mid-point, then translated back
+  // in range and limited to the supported range)
+  for (uint8_t x = 0; x < count; x++) {
+    int32_t s = values[x] - pipeline.mid2[x];
+    uint32_t recip = s > 0 ? pipeline.recipPos[x] : pipeline.recipNeg[x];
+    s = adcCalibDivide(s * RESX, recip) + 2 * RESX;
+    s = s < 0 ? 0 : (s > 4 * RESX ? 4 * RESX : s);
+    values[x] = pipeline.calib[x] ? s : values[x];
+  }
 
-    // 2nd: apply inversion
-    if (x < pot_offset && getStickInversion(inputMappingConvertMode(x))) {
-      v = 4 * RESX - v;
-    }
+  // 2nd: apply inversion
+  for (uint8_t x = 0; x < count; x++) {
+    values[x] = pipeline.invOffset[x] + pipeline.invSign[x] * values[x];
+  }
 
-    if (is_flex_input && getPotInversion(x - pot_offset)) {
-      v = 4 * RESX - v;
+  // 3rd: apply filtering
+  for (uint8_t x = 0; x < count; x++) {
+    uint32_t v = values[x];
+    switch (pipeline.filter[x]) {
+      case ADC_FILTER_MMA:
+        s_anaFilt[x] = apply_low_pass_filter(v, s_anaFilt[x]);
+        break;
+      case ADC_FILTER_ONE_EURO:
+        s_anaFilt[x] = apply_one_euro(&oneEuroState[x], v);
+        break;
+      case ADC_FILTER_MEDIAN3:
+        s_anaFilt[x] = apply_median3(medianHistory[x], v);
+        break;
+      default:
+        s_anaFilt[x] = v * JITTER_ALPHA;
+        break;
     }
+  }
 
-    // 3rd: apply filtering
-    s_anaFilt[x] = apply_low_pass_filter(v, s_anaFilt[x], x < max_mains);
-
-    if (is_multipos) {
-      const auto* calib = (const StepsCalibData*)&g_eeGeneral.calib[x];
-      if (IS_MULTIPOS_CALIBRATED(calib)) {
-        s_anaFilt[x] = apply_multipos(calib, s_anaFilt[x]);
-      }
+  for (uint8_t x = 0; x < count; x++) {
+    if (pipeline.multipos[x]) {
+      s_anaFilt[x] = apply_multipos(pipeline.multipos[x], s_anaFilt[x]);
     }
+  }
 
 #if defined(JITTER_MEASURE)
-    if (JITTER_MEASURE_ACTIVE()) {
+  if (JITTER_MEASURE_ACTIVE()) {
+    for (uint8_t x = 0; x < count; x++) {
       avgJitter[x].measure(ANA_FILT(x));
     }
-#endif
   }
+#endif
 }
 
 potconfig_t adcGetDefaultPotsConfig()
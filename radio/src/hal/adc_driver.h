@@ -115,6 +115,46 @@ void getADC();
 uint16_t anaIn(uint8_t chan);
 uint32_t anaIn_diag(uint8_t chan);
 
+// Filter applied to each input after calibration and inversion
+// (the jitter filter setting of the radio / model disables it on the
+// main inputs).
+enum AdcFilterType {
+  ADC_FILTER_NONE = 0,
+  ADC_FILTER_MMA,       // jitter filter: modified moving average
+  ADC_FILTER_ONE_EURO,  // 1€ filter: cutoff raised with the input speed
+  ADC_FILTER_MEDIAN3,   // median of the last 3 samples (spike removal)
+  ADC_FILTER_COUNT
+};
+
+#if !defined(ADC_FILTER_DEFAULT)
+  #define ADC_FILTER_DEFAULT ADC_FILTER_MMA
+#endif
+
+void adcSetInputFilter(uint8_t index, uint8_t filter);
+uint8_t adcGetInputFilter(uint8_t index);
+
+// getADC() runs a per-input pipeline built from the calibration, the
+// hardware settings and the model: it must be rebuilt whenever one of
+// these changes (done on next getADC() call)
+void adcPipelineInvalidate();
+
+// Calibration divides by the span using a reciprocal:
+//   n / span == (n * adcCalibRecip(span)) >> ADC_CALIB_RECIP_SHIFT
+// exact for n < 2^22 and span < 2^14 (12-bit ADC values scaled by RESX)
+#define ADC_CALIB_RECIP_SHIFT 36
+
+inline uint32_t adcCalibRecip(uint16_t span)
+{
+  return (uint32_t)(((1ULL << ADC_CALIB_RECIP_SHIFT) + span - 1) / span);
+}
+
+inline int32_t adcCalibDivide(int32_t n, uint32_t recip)
+{
+  uint32_t q = ((uint64_t)(uint32_t)(n < 0 ? -n : n) * recip) >>
+               ADC_CALIB_RECIP_SHIFT;
+  return n < 0 ? -(int32_t)q : (int32_t)q;
+}
+
 // Warning:
 //   STM32 uses a voltage divider bridge to measure the battery voltage
 //   Measuring VBAT puts considerable drain (22 µA) on the battery instead of
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+
+#include "flash_writer.h"
+
+#include <string.h>
+
+void FlashWriter::begin(uint32_t address, uint32_t total, ProgressCb progress,
+                        bool erase)
+{
+  this->start = address;
+  this->next = address;
+  this->total = total;
+  this->progress = progress;
+  this->erase = erase;
+
+  stagedStart = stagedEnd = 0;
+  erasedStart = erasedEnd = address;
+  written = erases = programs = 0;
+}
+
+int FlashWriter::eraseSectors(const etx_flash_driver_t* drv, uint32_t address,
+                              uint32_t end)
+{
+  // only a contiguous range of erased sectors is remembered
+  if (address < erasedStart || address > erasedEnd) {
+    erasedStart = erasedEnd = address;
+  }
+  else if (address < erasedEnd) {
+    address = erasedEnd;
+  }
+
+  while (address < end) {
+    uint32_t size = drv->get_sector_size(drv->get_sector(address));
+    uint32_t sectorStart = address & ~(size - 1);
+    if (sectorStart >= start) {
+      if (drv->erase_sector(sectorStart) < 0) return -1;
+      erases++;
+    }
+    if (erasedStart > sectorStart) erasedStart = sectorStart;
+    erasedEnd = sectorStart + size;
+    address = erasedEnd;
+  }
+
+  return 0;
+}
+
+int FlashWriter::flush()
+{
+  if (stagedEnd == stagedStart) return 0;
+
+  uint32_t from = stagedStart & ~(FLASH_WRITER_ALIGN - 1);
+  uint32_t to = (stagedEnd + FLASH_WRITER_ALIGN - 1) & ~(FLASH_WRITER_ALIGN - 1);
+  memset(&buffer[from], 0xFF, stagedStart - from);
+  memset(&buffer[stagedEnd], 0xFF, to - stagedEnd);
+
+  uint32_t address = blockAddress + from;
+  stagedStart = stagedEnd = 0;
+
+  auto drv = flashFindDriver(address);
+  if (!drv) return -1;
+
+  if (erase && eraseSectors(drv, address, address + to - from) < 0) return -1;
+  if (drv->program(address, &buffer[from], to - from) < 0) return -1;
+  programs++;
+
+  if (progress) progress(written, total);
+  return 0;
+}
+
+int FlashWriter::write(uint32_t address, const void* data, uint32_t len)
+{
+  auto src = (const uint8_t*)data;
+
+  while (len > 0) {
+    uint32_t block = address & ~(FLASH_WRITER_BLOCK_SIZE - 1);
+    if (stagedEnd != stagedStart &&
+        (block != blockAddress || address != next)) {
+      if (flush() < 0) return -1;
+    }
+    if (stagedEnd == stagedStart) {
+      blockAddress = block;
+      stagedStart = stagedEnd = address - block;
+    }
+
+    uint32_t count = FLASH_WRITER_BLOCK_SIZE - stagedEnd;
+    if (count > len) count = len;
+    memcpy(&buffer[stagedEnd], src, count);
+    stagedEnd += count;
+    written += count;
+    address += count;
+    next = address;
+    src += count;
+    len -= count;
+
+    if (stagedEnd == FLASH_WRITER_BLOCK_SIZE && flush() < 0) return -1;
+  }
+
+  return 0;
+}
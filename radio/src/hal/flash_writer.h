@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+
+#pragma once
+
+#include <stdint.h>
+#include "flash_driver.h"
+
+// Sequential flash programming on top of the registered flash drivers.
+//
+// Written data is staged in RAM and programmed a whole aligned block at a
+// time (a single driver call, i.e. a burst of words / flash words). Each
+// sector is erased the first time data is written into it, unless it
+// starts before the first address written (e.g. shared with the
+// bootloader). Addresses are expected to grow: a gap or a jump back
+// programs the staged data first. Start addresses should be aligned on
+// FLASH_WRITER_ALIGN, the end of a partial program unit is padded with 0xFF.
+
+#define FLASH_WRITER_BLOCK_SIZE  2048
+#define FLASH_WRITER_ALIGN       32    // largest program unit (STM32H7)
+
+class FlashWriter
+{
+ public:
+  typedef void (*ProgressCb)(uint32_t written, uint32_t total);
+
+  // 'total' is only passed to the progress callback. Without 'erase', the
+  // caller takes care of erasing
+  void begin(uint32_t address, uint32_t total = 0,
+             ProgressCb progress = nullptr, bool erase = true);
+
+  int write(uint32_t address, const void* data, uint32_t len);
+  int write(const void* data, uint32_t len) { return write(next, data, len); }
+
+  // Programs the staged data, to be called at the end
+  int flush();
+
+  uint32_t getWritten() const { return written; }
+  uint32_t getErases() const { return erases; }
+  uint32_t getPrograms() const { return programs; }
+
+ protected:
+  uint8_t buffer[FLASH_WRITER_BLOCK_SIZE];
+  uint32_t blockAddress = 0;  // flash address of buffer[0]
+  uint16_t stagedStart = 0;   // staged bytes in buffer
+  uint16_t stagedEnd = 0;
+  uint32_t next = 0;          // address following the last byte written
+
+  uint32_t start = 0;
+  uint32_t erasedStart = 0;   // sectors already erased
+  uint32_t erasedEnd = 0;
+  bool erase = true;
+
+  uint32_t total = 0;
+  uint32_t written = 0;
+  uint32_t erases = 0;
+  uint32_t programs = 0;
+  ProgressCb progress = nullptr;
+
+  int eraseSectors(const etx_flash_driver_t* drv, uint32_t address,
+                   uint32_t end);
+};
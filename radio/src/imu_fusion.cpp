@@ -0,0 +1,360 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "imu_fusion.h"
+
+#define CORDIC_STEPS  24
+#define CORDIC_GAIN   652032874  // 1 / 1.6468, Q30
+#define PI_Q29        1686629713
+
+// atan(2^-i), binary angles
+static const int32_t cordicAngles[CORDIC_STEPS] = {
+    536870912, 316933406, 167458907, 85004756, 42667331, 21354465,
+    10679838,  5340245,   2670163,   1335087,  667544,   333772,
+    166886,    83443,     41722,     20861,    10430,    5215,
+    2608,      1304,      652,       326,      163,      81,
+};
+
+static inline int32_t angleAdd(int32_t a, int32_t b)
+{
+  return (int32_t)((uint32_t)a + (uint32_t)b);
+}
+
+static inline int32_t angleDiff(int32_t a, int32_t b)
+{
+  return (int32_t)((uint32_t)a - (uint32_t)b);
+}
+
+static inline int32_t mulQ30(int32_t a, int32_t b)
+{
+  return ((int64_t)a * b) >> 30;
+}
+
+int32_t imuAtan2(int32_t y, int32_t x)
+{
+  if (x == 0 && y == 0) return 0;
+
+  // scale to 29 bits: keeps room for the CORDIC gain
+  int64_t vx = x, vy = y;
+  uint64_t m = (vx < 0 ? -vx : vx) | (vy < 0 ? -vy : vy);
+  int shift = 63 - __builtin_clzll(m) - 28;
+  if (shift > 0) {
+    vx >>= shift;
+    vy >>= shift;
+  } else {
+    vx *= (int64_t)1 << -shift;
+    vy *= (int64_t)1 << -shift;
+  }
+
+  // rotate into the right half plane
+  int32_t angle = 0;
+  if (vx < 0) {
+    int64_t t = vx;
+    if (vy >= 0) {
+      vx = vy;
+      vy = -t;
+      angle = IMU_ANGLE_90;
+    } else {
+      vx = -vy;
+      vy = t;
+      angle = -IMU_ANGLE_90;
+    }
+  }
+
+  int32_t cx = vx, cy = vy;
+  for (uint8_t i = 0; i < CORDIC_STEPS; i++) {
+    int32_t dx = cx >> i;
+    int32_t dy = cy >> i;
+    if (cy > 0) {
+      cx += dy;
+      cy -= dx;
+      angle = angleAdd(angle, cordicAngles[i]);
+    } else {
+      cx -= dy;
+      cy += dx;
+      angle = angleDiff(angle, cordicAngles[i]);
+    }
+  }
+
+  return angle;
+}
+
+void imuSinCos(int32_t angle, int32_t& sin, int32_t& cos)
+{
+  // reduce to [-90°, 90°]
+  bool negate = false;
+  if (angle > IMU_ANGLE_90 || angle < -IMU_ANGLE_90) {
+    angle = angleAdd(angle, INT32_MIN);
+    negate = true;
+  }
+
+  int32_t x = CORDIC_GAIN, y = 0;
+  for (uint8_t i = 0; i < CORDIC_STEPS; i++) {
+    int32_t dx = x >> i;
+    int32_t dy = y >> i;
+    if (angle >= 0) {
+      x -= dy;
+      y += dx;
+      angle -= cordicAngles[i];
+    } else {
+      x += dy;
+      y -= dx;
+      angle += cordicAngles[i];
+    }
+  }
+
+  sin = negate ? -y : y;
+  cos = negate ? -x : x;
+}
+
+template <typename T>
+static uint32_t isqrt(T value)
+{
+  T result = 0;
+  T bit = (T)1 << (sizeof(T) * 8 - 2);
+
+  while (bit > value) bit >>= 2;
+
+  while (bit) {
+    if (value >= result + bit) {
+      value -= result + bit;
+      result = (result >> 1) + bit;
+    } else {
+      result >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return result;
+}
+
+uint32_t imuSqrt(uint64_t value)
+{
+  // 32-bit arithmetic whenever possible (accelerometer norms)
+  if (value >> 32) return isqrt<uint64_t>(value);
+  return isqrt<uint32_t>(value);
+}
+
+void ImuFusion::init(const ImuFusionConfig& config)
+{
+  this->config = config;
+
+  uint32_t div = 180 * (uint32_t)config.sampleRate;
+  if (!div) div = 1;
+
+  // binary angle (180° = 2^31) per LSB (full scale = 2^15), Q8
+  gyroStep = (((uint64_t)config.gyroRange << 24) + div / 2) / div;
+
+  // half angle in radians per LSB, Q38
+  gyroHalfStep = (((uint64_t)config.gyroRange * PI_Q29 / div) + 64) >> 7;
+
+  reset();
+}
+
+void ImuFusion::reset()
+{
+  initialized = false;
+
+  for (uint8_t i = 0; i < 3; i++) {
+    angles[i] = 0;
+    accelFilter[i] = 0;
+    gyroFilter[i] = 0;
+  }
+
+  q[0] = IMU_QUAT_ONE;
+  q[1] = q[2] = q[3] = 0;
+}
+
+bool ImuFusion::accelValid(const int16_t accel[3]) const
+{
+  int64_t ax = accel[0], ay = accel[1], az = accel[2];
+  uint64_t norm2 = ax * ax + ay * ay + az * az;
+  if (!norm2) return false;
+
+  // ignore the accelerometer while accelerating (less than 0.5g or more
+  // than 2g)
+  if (config.accelOneG) {
+    uint64_t oneG2 = (uint64_t)config.accelOneG * config.accelOneG;
+    return norm2 > oneG2 / 4 && norm2 < oneG2 * 4;
+  }
+
+  return true;
+}
+
+void ImuFusion::update(const int16_t gyro[3], const int16_t accel[3])
+{
+  // sensors low pass
+  int32_t k = 32768 - config.lpfAlpha;
+  for (uint8_t i = 0; i < 3; i++) {
+    accelFilter[i] +=
+        ((int64_t)accel[i] * 65536 - accelFilter[i]) * k >> 15;
+    gyroFilter[i] +=
+        ((int64_t)gyro[i] * 65536 - gyroFilter[i]) * k >> 15;
+  }
+
+  bool valid = accelValid(accel);
+
+  if (config.mode == IMU_FUSION_QUATERNION)
+    updateQuaternion(gyro, accel, valid);
+  else
+    updateEuler(gyro, accel, valid);
+}
+
+static void accelAngles(const int16_t accel[3], int32_t& roll, int32_t& pitch)
+{
+  int64_t ax = accel[0], ay = accel[1], az = accel[2];
+
+  roll = imuAtan2(ay, imuSqrt(ax * ax + az * az));
+  pitch = imuAtan2(-ax, imuSqrt(ay * ay + az * az));
+}
+
+void ImuFusion::updateEuler(const int16_t gyro[3], const int16_t accel[3],
+                            bool valid)
+{
+  int32_t accRoll = 0, accPitch = 0;
+  if (valid) accelAngles(accel, accRoll, accPitch);
+
+  if (!initialized) {
+    if (!valid) return;
+    angles[0] = accRoll;
+    angles[1] = accPitch;
+    angles[2] = 0;
+    initialized = true;
+    return;
+  }
+
+  // integrate gyro
+  for (uint8_t i = 0; i < 3; i++) {
+    angles[i] = angleAdd(angles[i], ((int64_t)gyro[i] * gyroStep + 128) >> 8);
+  }
+
+  // pull roll and pitch towards the accelerometer angles
+  if (valid) {
+    int32_t k = 32768 - config.alpha;
+    angles[0] = angleAdd(
+        angles[0], ((int64_t)angleDiff(accRoll, angles[0]) * k) >> 15);
+    angles[1] = angleAdd(
+        angles[1], ((int64_t)angleDiff(accPitch, angles[1]) * k) >> 15);
+  }
+}
+
+void ImuFusion::updateQuaternion(const int16_t gyro[3],
+                                 const int16_t accel[3], bool valid)
+{
+  if (!initialized) {
+    if (!valid) return;
+
+    // accelerometer attitude, yaw = 0
+    int32_t roll, pitch, sr, cr, sp, cp;
+    accelAngles(accel, roll, pitch);
+    imuSinCos(roll / 2, sr, cr);
+    imuSinCos(pitch / 2, sp, cp);
+    q[0] = mulQ30(cr, cp);
+    q[1] = mulQ30(sr, cp);
+    q[2] = mulQ30(cr, sp);
+    q[3] = -mulQ30(sr, sp);
+    initialized = true;
+    return;
+  }
+
+  // half rotation during the sample period
+  int32_t h[3];
+  for (uint8_t i = 0; i < 3; i++) {
+    h[i] = ((int64_t)gyro[i] * gyroHalfStep + 128) >> 8;
+  }
+
+  if (valid) {
+    // measured gravity direction
+    int64_t ax = accel[0], ay = accel[1], az = accel[2];
+    int64_t norm = imuSqrt(ax * ax + ay * ay + az * az);
+    int32_t a[3] = {
+        (int32_t)(ax * IMU_QUAT_ONE / norm),
+        (int32_t)(ay * IMU_QUAT_ONE / norm),
+        (int32_t)(az * IMU_QUAT_ONE / norm),
+    };
+
+    // estimated gravity direction
+    int32_t v[3] = {
+        (int32_t)(((int64_t)q[1] * q[3] - (int64_t)q[0] * q[2]) >> 29),
+        (int32_t)(((int64_t)q[0] * q[1] + (int64_t)q[2] * q[3]) >> 29),
+        (int32_t)(((int64_t)q[0] * q[0] - (int64_t)q[1] * q[1] -
+                   (int64_t)q[2] * q[2] + (int64_t)q[3] * q[3]) >>
+                  30),
+    };
+
+    // error = a x v, corrected by (1 - alpha) per sample
+    int32_t k = 32768 - config.alpha;
+    int32_t e[3] = {
+        mulQ30(a[1], v[2]) - mulQ30(a[2], v[1]),
+        mulQ30(a[2], v[0]) - mulQ30(a[0], v[2]),
+        mulQ30(a[0], v[1]) - mulQ30(a[1], v[0]),
+    };
+    for (uint8_t i = 0; i < 3; i++) {
+      h[i] += ((int64_t)e[i] * k) >> 16;
+    }
+  }
+
+  // q += q * (0, h)
+  int64_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+  q[0] += (-q1 * h[0] - q2 * h[1] - q3 * h[2]) >> 30;
+  q[1] += (q0 * h[0] + q2 * h[2] - q3 * h[1]) >> 30;
+  q[2] += (q0 * h[1] - q1 * h[2] + q3 * h[0]) >> 30;
+  q[3] += (q0 * h[2] + q1 * h[1] - q2 * h[0]) >> 30;
+
+  // renormalize: |q| stays close to 1, 1 / sqrt(n) ~ (3 - n) / 2
+  int64_t n = ((int64_t)q[0] * q[0] + (int64_t)q[1] * q[1] +
+               (int64_t)q[2] * q[2] + (int64_t)q[3] * q[3]) >>
+              30;
+  int32_t scale = ((int64_t)3 * IMU_QUAT_ONE - n) / 2;
+  for (uint8_t i = 0; i < 4; i++) {
+    q[i] = mulQ30(q[i], scale);
+  }
+}
+
+int32_t ImuFusion::roll() const
+{
+  if (config.mode != IMU_FUSION_QUATERNION) return angles[0];
+
+  int64_t y = ((int64_t)q[0] * q[1] + (int64_t)q[2] * q[3]) >> 29;
+  int64_t x = IMU_QUAT_ONE -
+              (((int64_t)q[1] * q[1] + (int64_t)q[2] * q[2]) >> 29);
+  return imuAtan2(y, x);
+}
+
+int32_t ImuFusion::pitch() const
+{
+  if (config.mode != IMU_FUSION_QUATERNION) return angles[1];
+
+  int64_t s = ((int64_t)q[0] * q[2] - (int64_t)q[1] * q[3]) >> 29;
+  if (s > IMU_QUAT_ONE) s = IMU_QUAT_ONE;
+  if (s < -IMU_QUAT_ONE) s = -IMU_QUAT_ONE;
+  return imuAtan2(s, imuSqrt(((int64_t)1 << 60) - s * s));
+}
+
+int32_t ImuFusion::yaw() const
+{
+  if (config.mode != IMU_FUSION_QUATERNION) return angles[2];
+
+  int64_t y = ((int64_t)q[0] * q[3] + (int64_t)q[1] * q[2]) >> 29;
+  int64_t x = IMU_QUAT_ONE -
+              (((int64_t)q[2] * q[2] + (int64_t)q[3] * q[3]) >> 29);
+  return imuAtan2(y, x);
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Fixed-point attitude estimation from 16-bit gyro / accelerometer samples,
+// for targets without FPU (or to keep FPU context saves out of the mixer
+// task).
+//
+// Angles are binary angles: the full int32_t range is one turn (the
+// angle wraps around like yaw does), IMU_ANGLE_90 is 90°.
+
+#define IMU_ANGLE_90          (1 << 30)
+#define IMU_ANGLE_BITS        32
+
+// Q15 coefficients
+#define IMU_Q15(x)            ((uint16_t)((x) * 32768 + 0.5))
+
+// Quaternion components are Q30
+#define IMU_QUAT_ONE          (1 << 30)
+
+enum ImuFusionMode {
+  IMU_FUSION_EULER,       // complementary filter on roll / pitch / yaw
+  IMU_FUSION_QUATERNION,  // quaternion (no gimbal lock, for head tracking)
+};
+
+struct ImuFusionConfig {
+  uint16_t sampleRate;  // Hz
+  uint16_t gyroRange;   // dps at full scale (32768)
+  uint16_t accelOneG;   // LSB / g, 0 to always trust the accelerometer
+  uint16_t alpha;       // Q15, gyro weight of the complementary filter
+  uint16_t lpfAlpha;    // Q15, previous value weight of the sensors low pass
+  uint8_t mode;         // ImuFusionMode
+};
+
+class ImuFusion
+{
+ public:
+  void init(const ImuFusionConfig& config);
+  void reset();
+
+  // gyro x/y/z, accel x/y/z
+  void update(const int16_t gyro[3], const int16_t accel[3]);
+
+  int32_t roll() const;
+  int32_t pitch() const;
+  int32_t yaw() const;
+
+  // low pass filtered sensor values
+  int16_t accel(uint8_t axis) const { return filterValue(accelFilter[axis]); }
+  int16_t gyro(uint8_t axis) const { return filterValue(gyroFilter[axis]); }
+
+  // w, x, y, z (IMU_FUSION_QUATERNION only)
+  const int32_t* quaternion() const { return q; }
+
+ protected:
+  ImuFusionConfig config = {};
+  bool initialized = false;
+
+  // binary angle per gyro LSB and sample, Q8
+  int32_t gyroStep = 0;
+  // half angle per gyro LSB and sample, in radians Q38
+  int32_t gyroHalfStep = 0;
+
+  int32_t angles[3] = {};  // roll, pitch, yaw
+  int32_t q[4] = {IMU_QUAT_ONE, 0, 0, 0};
+
+  // Q16
+  int32_t accelFilter[3] = {};
+  int32_t gyroFilter[3] = {};
+
+  static int16_t filterValue(int32_t value)
+  {
+    return (value + (1 << 15)) >> 16;
+  }
+
+  bool accelValid(const int16_t accel[3]) const;
+  void updateEuler(const int16_t gyro[3], const int16_t accel[3], bool valid);
+  void updateQuaternion(const int16_t gyro[3], const int16_t accel[3],
+                        bool valid);
+};
+
+// Fixed-point helpers (binary angles)
+int32_t imuAtan2(int32_t y, int32_t x);
+void imuSinCos(int32_t angle, int32_t& sin, int32_t& cos);  // Q30
+uint32_t imuSqrt(uint64_t value);
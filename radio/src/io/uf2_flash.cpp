@@ -30,11 +30,21 @@
 
 #include "hal/watchdog_driver.h"
 #include "hal/flash_driver.h"
+#include "hal/flash_writer.h"
 
 #include "pulses/pulses.h"
 
 #define UF2_BLOCK_SIZE 512
 
+#if !defined(SIMU)
+static ProgressHandler _progressHandler;
+
+static void onFlashProgress(uint32_t written, uint32_t total)
+{
+  _progressHandler("Firmware", "Writing...", written, total);
+}
+#endif
+
 void UF2FirmwareUpdate::flashFirmware(const char* filename,
                                       ProgressHandler progressHandler)
 {
@@ -50,65 +60,38 @@ void UF2FirmwareUpdate::flashFirmware(const char* filename,
     return;
   }
 
+  // sectors are erased as the blocks are written
   size_t total_len = f_size(&file);
-  size_t erased_len = 0;
-  uint32_t last_erased = 0;
+  size_t read_len = 0;
+  _progressHandler = progressHandler;
+
+  static FlashWriter writer;
+  writer.begin(0, total_len / UF2_BLOCK_SIZE * 256, onFlashProgress);
 
   UINT bytes_read;
   while (f_read(&file, &block, sizeof(block), &bytes_read) == FR_OK &&
          bytes_read > 0) {
 
-    uint32_t addr = block.targetAddr;
-    if ((block.flags & UF2_FLAG_NOFLASH) == 0 && addr > last_erased) {
-      auto drv = flashFindDriver(addr);
-      if (drv) {
-        uint32_t sector = drv->get_sector(addr);
-        uint32_t sect_len = drv->get_sector_size(sector);
-        if (drv->erase_sector(addr) < 0) break;
-        last_erased = block.targetAddr + sect_len - 1;
-        TRACE("[UF2] erased %dKB @ 0x%08X", sect_len / 1024, addr);
+    if ((block.flags & UF2_FLAG_NOFLASH) == 0) {
+      uint32_t addr = block.targetAddr;
+      if (flashFindDriver(addr)) {
+        uint32_t len = block.payloadSize;
+        uint8_t* data = (uint8_t*)block.data;
+        if (writer.write(addr, data, len) < 0) break;
+        TRACE("[UF2] written %d bytes @ 0x%08X (%d of %d)", len, addr,
+              block.blockNo + 1, block.numBlocks);
       }
     }
 
-    erased_len += bytes_read;
-    progressHandler("Firmware", "Erasing...", erased_len, total_len);
-
-    if (erased_len >= total_len) {
-      success = true;
+    read_len += bytes_read;
+    if (read_len >= total_len) {
+      success = writer.flush() >= 0;
+      TRACE("[UF2] %d sectors erased, %d bursts", writer.getErases(),
+            writer.getPrograms());
       break;
     }
   }
 
-  if (success) {
-    success = false;
-    size_t written_len = 0;
-    f_rewind(&file);
-
-    while (f_read(&file, &block, sizeof(block), &bytes_read) == FR_OK &&
-           bytes_read > 0) {
-
-      if ((block.flags & UF2_FLAG_NOFLASH) == 0) {
-        uint32_t addr = block.targetAddr;
-        auto drv = flashFindDriver(addr);
-        if (drv) {
-          uint32_t len = block.payloadSize;
-          uint8_t* data = (uint8_t*)block.data;
-          if (drv->program(addr, data, len) < 0) break;
-          TRACE("[UF2] written %d bytes @ 0x%08X (%d of %d)", len, addr,
-                block.blockNo + 1, block.numBlocks);
-        }
-      }
-
-      written_len += bytes_read;
-      progressHandler("Firmware", "Writing...", written_len, total_len);
-
-      if (written_len >= total_len) {
-        success = true;
-        break;
-      }
-    }
-  }
-
   if(success)
     POPUP_INFORMATION(STR_FIRMWARE_UPDATE_SUCCESS);
   else
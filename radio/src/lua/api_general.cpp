@@ -102,7 +102,7 @@ void luaFreeRxFifo()
 void luaReceiveData(uint8_t* buf, uint32_t len)
 {
   if (luaRxFifo) {
-    while(len--) luaRxFifo->push(*buf++);
+    luaRxFifo->push(buf, len);
   }
 }
 
@@ -199,6 +199,7 @@ overflows will not happen.
 */
 static int luaGetTime(lua_State * L)
 {
+  luaTrackVolatile();
   lua_pushinteger(L, get_tmr10ms());
   return 1;
 }
@@ -247,6 +248,7 @@ Return current system date and time that is kept by the RTC unit
 */
 static int luaGetDateTime(lua_State * L)
 {
+  luaTrackVolatile();
   struct gtm utm;
   gettime(&utm);
   luaPushDateTime(L, utm.tm_year + TM_YEAR_BASE, utm.tm_mon + 1, utm.tm_mday, utm.tm_hour, utm.tm_min, utm.tm_sec);
@@ -267,6 +269,7 @@ in 2038.
 #if defined(RTCLOCK)
 static int luaGetRtcTime(lua_State * L)
 {
+  luaTrackVolatile();
   lua_pushinteger(L, g_rtcTime);
   return 1;
 }
@@ -306,8 +309,75 @@ static void luaPushCells(lua_State* L, TelemetrySensor & telemetrySensor, Teleme
   }
 }
 
+#if defined(COLORLCD)
+static int shmVar[16] = {0};
+
+static int32_t getTelemetryFingerprint(int src)
+{
+  int idx = (src - MIXSRC_FIRST_TELEM) / 3;
+  TelemetryItem & telemetryItem = telemetryItems[idx];
+
+  uint32_t fingerprint = getValue(src);
+  switch (g_model.telemetrySensors[idx].unit) {
+    case UNIT_GPS:
+      fingerprint ^= hash(&telemetryItem.gps, sizeof(telemetryItem.gps));
+      break;
+    case UNIT_DATETIME:
+      fingerprint ^= hash(&telemetryItem.datetime, sizeof(telemetryItem.datetime));
+      break;
+    case UNIT_TEXT:
+      fingerprint ^= hash(telemetryItem.text, sizeof(telemetryItem.text));
+      break;
+    case UNIT_CELLS:
+      fingerprint ^= hash(&telemetryItem.cells, sizeof(telemetryItem.cells));
+      break;
+  }
+
+  // getSourceValue() also returns the state of the sensor
+  uint32_t flags = (TELEMETRY_STREAMING() ? 1 : 0) |
+                   (telemetryItem.isAvailable() ? 2 : 0) |
+                   (telemetryItem.isOld() ? 4 : 0) |
+                   (telemetryItem.isFresh() ? 8 : 0);
+
+  return fingerprint ^ (flags << 28);
+}
+
+int32_t luaGetDependencyValue(uint32_t dependency)
+{
+  uint16_t idx = dependency & 0xFFFF;
+
+  switch (dependency >> 16) {
+    case LUA_DEP_SOURCE:
+      if (idx >= MIXSRC_FIRST_TELEM && idx <= MIXSRC_LAST_TELEM)
+        return getTelemetryFingerprint(idx);
+      return getValue(idx);
+
+    case LUA_DEP_SWITCH:
+      return getSwitch((int16_t)idx);
+
+    case LUA_DEP_OUTPUT:
+      return idx < MAX_OUTPUT_CHANNELS ? channelOutputs[idx] : 0;
+
+    case LUA_DEP_SHMVAR:
+      return idx < DIM(shmVar) ? shmVar[idx] : 0;
+
+#if defined(GVARS)
+    case LUA_DEP_GVAR:
+      return getGVarValue(idx % MAX_GVARS, idx / MAX_GVARS);
+#endif
+
+    case LUA_DEP_SETTINGS:
+      return storageGetChangeCount();
+  }
+
+  return 0;
+}
+#endif
+
 void luaGetValueAndPush(lua_State* L, int src)
 {
+  luaTrackDependency(LUA_DEPENDENCY(LUA_DEP_SOURCE, src));
+
   getvalue_t value = getValue(src); // ignored for GPS, DATETIME, and CELLS
 
   if (src >= MIXSRC_FIRST_TELEM && src <= MIXSRC_LAST_TELEM) {
@@ -629,6 +699,7 @@ The list of valid sources is available:
 */
 static int luaGetFieldInfo(lua_State * L)
 {
+  luaTrackSettings();
   bool found;
   LuaField field;
 
@@ -787,6 +858,8 @@ static int luaGetSourceValue(lua_State * L)
     }
   }
 
+  luaTrackDependency(LUA_DEPENDENCY(LUA_DEP_SOURCE, src));
+
   // Get source value. Ignored for GPS, DATETIME, and CELLS
   bool valid = true;
   getvalue_t value = getValue(src, &valid);
@@ -863,6 +936,7 @@ Return rotary encoder current speed
 */
 static int luaGetRotEncSpeed(lua_State * L)
 {
+  luaTrackVolatile();
   lua_pushinteger(L, max(rotaryEncoderGetAccel(), (int8_t)1));
   return 1;
 }
@@ -879,6 +953,7 @@ Return rotary encoder mode
 */
 static int luaGetRotEncMode(lua_State * L)
 {
+  luaTrackSettings();
 #if defined(ROTARY_ENCODER_NAVIGATION) && !defined(USE_HATS_AS_KEYS)
   lua_pushinteger(L, g_eeGeneral.rotEncMode);
 #else
@@ -890,6 +965,8 @@ static int luaGetRotEncMode(lua_State * L)
 static TelemetryQueue* getTelemetryQueue()
 {
 #if defined(COLORLCD)
+  // telemetry frames are consumed, the widget must be refreshed each time
+  luaTrackVolatile();
   if (luaScriptManager) {
     luaScriptManager->createTelemetryQueue();
     return luaScriptManager->telemetryQueue();
@@ -929,9 +1006,7 @@ static int luaSportTelemetryPop(lua_State * L)
   if (queue) {
     if (queue->size() >= sizeof(SportTelemetryPacket)) {
       SportTelemetryPacket packet;
-      for (uint8_t i=0; i<sizeof(packet); i++) {
-        queue->pop(packet.raw[i]);
-      }
+      queue->pop(packet.raw, sizeof(packet));
       lua_pushinteger(L, packet.physicalId);
       lua_pushinteger(L, packet.primId);
       lua_pushinteger(L, packet.dataId);
@@ -985,6 +1060,7 @@ static bool _supports_sport(uint8_t module)
 
 static int luaSportTelemetryPush(lua_State * L)
 {
+  luaTrackVolatile();
   bool extmod = _supports_sport(EXTERNAL_MODULE);
   bool intmod = _supports_sport(INTERNAL_MODULE);
   
@@ -1098,6 +1174,7 @@ bool getDefaultAccessDestination(uint8_t & destination)
 
 static int luaAccessTelemetryPush(lua_State * L)
 {
+  luaTrackVolatile();
   if (lua_gettop(L) == 0) {
     lua_pushboolean(L, outputTelemetryBuffer.isAvailable());
     return 1;
@@ -1190,6 +1267,7 @@ When called without parameters, it will only return the status of the output buf
 */
 static int luaCrossfireTelemetryPush(lua_State* L)
 {
+  luaTrackVolatile();
   bool external =
       (moduleState[EXTERNAL_MODULE].protocol == PROTOCOL_CHANNELS_CROSSFIRE);
   bool internal =
@@ -1311,6 +1389,7 @@ When called without parameters, it will only return the status of the output buf
 */
 static int luaGhostTelemetryPush(lua_State * L)
 {
+  luaTrackVolatile();
   bool extmod = (moduleState[EXTERNAL_MODULE].protocol == PROTOCOL_CHANNELS_GHOST);
   if (!extmod) {
     lua_pushnil(L);
@@ -1372,6 +1451,7 @@ This is just a hardware pass/fail measure and does not represent the quality of
 */
 static int luaGetRAS(lua_State * L)
 {
+  luaTrackVolatile();
   if (isRasValueValid()) {
     lua_pushinteger(L, telemetryData.swrInternal.value());
   }
@@ -1400,6 +1480,7 @@ Return the internal GPS position or nil if no valid hardware found
 */
 static int luaGetTxGPS(lua_State * L)
 {
+  luaTrackVolatile();
 #if defined(INTERNAL_GPS)
   lua_createtable(L, 0, 8);
   lua_pushtablenumber(L, "lat", gpsData.latitude * 0.000001);
@@ -1436,6 +1517,7 @@ is not specified (or contains invalid value), then the current flight mode data
 */
 static int luaGetFlightMode(lua_State * L)
 {
+  luaTrackVolatile();
   int mode = luaL_optinteger(L, 1, -1);
   if (mode < 0 || mode >= MAX_FLIGHT_MODES) {
     mode = mixerCurrentFlightMode;
@@ -1753,6 +1835,7 @@ Returns (some of) the general radio settings
 */
 static int luaGetGeneralSettings(lua_State * L)
 {
+  luaTrackVolatile();
   lua_newtable(L);
   lua_pushtablenumber(L, "battWarn", (g_eeGeneral.vBatWarn) * 0.1f);
   lua_pushtablenumber(L, "battMin", (90+g_eeGeneral.vBatMin) * 0.1f);
@@ -1780,6 +1863,7 @@ Returns radio timers
 */
 static int luaGetGlobalTimer(lua_State * L)
 {
+  luaTrackVolatile();
   lua_newtable(L);
   lua_pushtableinteger(L, "total", g_eeGeneral.globalTimer + sessionTimer);
   lua_pushtableinteger(L, "session", sessionTimer);
@@ -2091,6 +2175,7 @@ Get RSSI value as well as low and critical RSSI alarm levels (in dB)
 */
 static int luaGetRSSI(lua_State * L)
 {
+  luaTrackVolatile();
   if (TELEMETRY_STREAMING())
     lua_pushinteger(L, min((uint8_t)99, TELEMETRY_RSSI()));
   else
@@ -2190,6 +2275,7 @@ Get percent of already used Lua instructions in current script execution cycle.
 */
 static int luaGetUsage(lua_State * L)
 {
+  luaTrackVolatile();
 #if defined(COLORLCD)
   if (luaScriptManager && luaScriptManager->useLvglLayout()) {
     lua_pushinteger(L, luaScriptManager->refreshInstructionsPercent);
@@ -2211,6 +2297,7 @@ Get available memory remaining in the Heap for Lua.
 */
 static int luaGetAvailableMemory(lua_State * L)
 {
+  luaTrackVolatile();
   lua_pushinteger(L, availableMemory());
   return 1;
 }
@@ -2271,6 +2358,7 @@ uint8_t * Multi_Buffer = nullptr;
 
 static int luaMultiBuffer(lua_State * L)
 {
+  luaTrackVolatile();
   uint8_t address = luaL_checkinteger(L, 1);
   if (!Multi_Buffer)
     Multi_Buffer = (uint8_t *) malloc(MULTI_BUFFER_SIZE);
@@ -2350,6 +2438,7 @@ Reads characters from the serial port. The string is allowed to contain any char
 */
 static int luaSerialRead(lua_State * L)
 {
+  luaTrackVolatile();
   int num = luaL_optinteger(L, 1, 0);
 
   uint8_t str[LUA_FIFO_SIZE];
@@ -2399,6 +2488,7 @@ static int luaSerialRead(lua_State * L)
 */
 static int luaSerialGetPower(lua_State* L)
 {
+  luaTrackVolatile();
   uint8_t port_nr = luaL_checkinteger(L, 1) & 0x3;
 
   #if defined(AUX_SERIAL)
@@ -2465,8 +2555,6 @@ static int luaSerialSetPower(lua_State* L)
 #endif
 
 #if defined(COLORLCD)
-static int shmVar[16] = {0};
-
 /*luadoc
 @function setShmVar(id, value)
 
@@ -2510,8 +2598,10 @@ static int luaGetShmVar(lua_State * L)
 {
   int id = luaL_checkinteger(L, 1);
 
-  if (1 <= id && id <= 16)
+  if (1 <= id && id <= 16) {
+    luaTrackDependency(LUA_DEPENDENCY(LUA_DEP_SHMVAR, id - 1));
     lua_pushinteger(L, shmVar[id - 1]);
+  }
   else
     lua_pushnil(L);
 
@@ -2568,8 +2658,10 @@ static int luaGetLogicalSwitchValue(lua_State * L)
 {
   int id = luaL_checkinteger(L, 1);
 
-  if (id >= 0 && id < MAX_LOGICAL_SWITCHES)
+  if (id >= 0 && id < MAX_LOGICAL_SWITCHES) {
+    luaTrackDependency(LUA_DEPENDENCY(LUA_DEP_SWITCH, SWSRC_FIRST_LOGICAL_SWITCH + id));
     lua_pushboolean(L, getSwitch(SWSRC_FIRST_LOGICAL_SWITCH + id));
+  }
   else
     lua_pushnil(L);
   return 1;
@@ -2613,6 +2705,7 @@ static int luaGetSwitchIndex(lua_State * L)
 
 static int luaGetSwitchName(lua_State * L)
 {
+  luaTrackSettings();
   swsrc_t idx = luaL_checkinteger(L, 1);
   if (idx > -SWSRC_COUNT && idx < SWSRC_COUNT && isSwitchAvailable(idx, ModelCustomFunctionsContext)) {
     char* name = getSwitchPositionName(idx);
@@ -2637,8 +2730,10 @@ static int luaGetSwitchName(lua_State * L)
 static int luaGetSwitchValue(lua_State * L)
 {
   swsrc_t idx = luaL_checkinteger(L, 1);
-  if (idx > -SWSRC_COUNT && idx < SWSRC_COUNT && isSwitchAvailable(idx, ModelCustomFunctionsContext))
+  if (idx > -SWSRC_COUNT && idx < SWSRC_COUNT && isSwitchAvailable(idx, ModelCustomFunctionsContext)) {
+    luaTrackDependency(LUA_DEPENDENCY(LUA_DEP_SWITCH, idx));
     lua_pushboolean(L, getSwitch(idx));
+  }
   else
     lua_pushnil(L);
   return 1;
@@ -2738,6 +2833,7 @@ static int luaGetSourceIndex(lua_State* const L)
 
 static int luaGetSourceName(lua_State * L)
 {
+  luaTrackSettings();
   mixsrc_t idx = luaL_checkinteger(L, 1);
   if (idx <= MIXSRC_LAST_TELEM && isSourceAvailable(idx)) {
     char srcName[maxSourceNameLength];
@@ -2817,6 +2913,7 @@ static int luaGetOutputValue(lua_State * L)
 {
   mixsrc_t idx = luaL_checkinteger(L, 1);
   if (idx < MAX_OUTPUT_CHANNELS) {           // mixsrc_t is unsigned, no need to check for <0
+    luaTrackDependency(LUA_DEPENDENCY(LUA_DEP_OUTPUT, idx));
     lua_pushinteger(L, channelOutputs[idx]);
   } else {
     lua_pushinteger(L, 0);
@@ -2837,6 +2934,7 @@ static int luaGetOutputValue(lua_State * L)
 */
 static int luaGetTrainerStatus(lua_State * L)
 {
+  luaTrackVolatile();
   extern uint8_t trainerStatus;
   lua_pushinteger(L, trainerStatus);
   return 1;
@@ -2985,6 +3083,7 @@ static int luaApplyRGBLedColors(lua_State * L)
 
 static int luaGetStickMode(lua_State* const L)
 {
+  luaTrackSettings();
   lua_pushinteger(L,  g_eeGeneral.stickMode + 1);
   return 1;
 }
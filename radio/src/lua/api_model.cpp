@@ -54,6 +54,7 @@ Get current Model information
 */
 static int luaModelGetInfo(lua_State *L)
 {
+  luaTrackSettings();
   lua_newtable(L);
   lua_pushtablenstring(L, "name", g_model.header.name);
   lua_pushtableboolean(L, "extendedLimits", g_model.extendedLimits);
@@ -164,6 +165,7 @@ Get RF module parameters
 */
 static int luaModelGetModule(lua_State *L)
 {
+  luaTrackSettings();
   unsigned int idx = luaL_checkinteger(L, 1);
   if (idx < NUM_MODULES) {
     ModuleData & module = g_model.moduleData[idx];
@@ -287,6 +289,7 @@ static int luaModelGetTimer(lua_State *L)
 {
   unsigned int idx = luaL_checkinteger(L, 1);
   if (idx < MAX_TIMERS) {
+    luaTrackDependency(LUA_DEPENDENCY(LUA_DEP_SOURCE, MIXSRC_FIRST_TIMER + idx));
     TimerData & timer = g_model.timers[idx];
     lua_newtable(L);
     lua_pushtableinteger(L, "mode", timer.mode);
@@ -429,6 +432,7 @@ Return number of lines for given input
 */
 static int luaModelGetInputsCount(lua_State *L)
 {
+  luaTrackSettings();
   unsigned int chn = luaL_checkinteger(L, 1);
   int count = getInputsCount(chn);
   lua_pushinteger(L, count);
@@ -473,6 +477,7 @@ Return input data for given input and line number
 */
 static int luaModelGetFlightMode(lua_State * L)
 {
+  luaTrackSettings();
   unsigned int idx = luaL_checkinteger(L, 1);
   if (idx < MAX_FLIGHT_MODES) {
     FlightModeData * fm = flightModeAddress(idx);
@@ -602,6 +607,7 @@ Return input data for given input and line number
 */
 static int luaModelGetInput(lua_State *L)
 {
+  luaTrackSettings();
   unsigned int chn = luaL_checkinteger(L, 1);
   unsigned int idx = luaL_checkinteger(L, 2);
   unsigned int first = getFirstInput(chn);
@@ -799,6 +805,7 @@ Get the number of Mixer lines that the specified Channel has
 */
 static int luaModelGetMixesCount(lua_State *L)
 {
+  luaTrackSettings();
   unsigned int chn = luaL_checkinteger(L, 1);
   unsigned int count = getMixesCount(chn);
   lua_pushinteger(L, count);
@@ -839,6 +846,7 @@ Get configuration for specified Mix
 */
 static int luaModelGetMix(lua_State *L)
 {
+  luaTrackSettings();
   unsigned int chn = luaL_checkinteger(L, 1);
   unsigned int idx = luaL_checkinteger(L, 2);
   unsigned int first = getFirstMix(chn);
@@ -1032,6 +1040,7 @@ Get Logical Switch parameters
 */
 static int luaModelGetLogicalSwitch(lua_State *L)
 {
+  luaTrackSettings();
   unsigned int idx = luaL_checkinteger(L, 1);
   if (idx < MAX_LOGICAL_SWITCHES) {
     LogicalSwitchData * sw = lswAddress(idx);
@@ -1141,6 +1150,7 @@ Get Curve parameters
 */
 static int luaModelGetCurve(lua_State *L)
 {
+  luaTrackSettings();
   unsigned int idx = luaL_checkinteger(L, 1);
   if (idx < MAX_CURVES) {
     CurveHeader & CurveHeader = g_model.curves[idx];
@@ -1398,6 +1408,7 @@ Get Custom Function parameters
 */
 static int luaModelGetCustomFunction(lua_State *L)
 {
+  luaTrackSettings();
   unsigned int idx = luaL_checkinteger(L, 1);
   if (idx < MAX_SPECIAL_FUNCTIONS) {
     CustomFunctionData * cfn = &g_model.customFn[idx];
@@ -1502,6 +1513,7 @@ Get servo parameters
 */
 static int luaModelGetOutput(lua_State *L)
 {
+  luaTrackSettings();
   unsigned int idx = luaL_checkinteger(L, 1);
   if (idx < MAX_OUTPUT_CHANNELS) {
     LimitData * limit = limitAddress(idx);
@@ -1605,8 +1617,10 @@ static int luaModelGetGlobalVariable(lua_State *L)
 {
   unsigned int idx = luaL_checkinteger(L, 1);
   unsigned int phase = luaL_checkinteger(L, 2);
-  if (phase < MAX_FLIGHT_MODES && idx < MAX_GVARS)
+  if (phase < MAX_FLIGHT_MODES && idx < MAX_GVARS) {
+    luaTrackDependency(LUA_DEPENDENCY(LUA_DEP_GVAR, phase * MAX_GVARS + idx));
     lua_pushinteger(L, getGVarValue(idx, phase));
+  }
   else
     lua_pushnil(L);
   return 1;
@@ -1654,6 +1668,7 @@ static int luaModelSetGlobalVariable(lua_State *L)
 */
 static int luaModelGetGlobalVariableDetails(lua_State *L)
 {
+  luaTrackSettings();
   unsigned int idx = luaL_checkunsigned(L, 1);
   if (idx < MAX_GVARS) {
     lua_newtable(L);
@@ -1738,6 +1753,7 @@ Get Telemetry Sensor parameters
 */
 static int luaModelGetSensor(lua_State *L)
 {
+  luaTrackSettings();
   unsigned int idx = luaL_checkinteger(L, 1);
   if (idx < MAX_TELEMETRY_SENSORS) {
     TelemetrySensor & sensor = g_model.telemetrySensors[idx];
@@ -1802,6 +1818,7 @@ Get heli swash parameters
 */
 static int luaModelGetSwashRing(lua_State *L)
 {
+  luaTrackSettings();
   lua_newtable(L);
   lua_pushtableinteger(L, "type", g_model.swashR.type);
   lua_pushtableinteger(L, "value", g_model.swashR.value);
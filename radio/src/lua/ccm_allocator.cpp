@@ -23,7 +23,8 @@
 #include "edgetx.h"
 
 /*
-  Custom memory allocator for Lua that adds all available CCM RAM to the memory pool
+  Heap allocator for Lua that adds all available CCM RAM to the memory pool
+  (used for blocks not served by the slab allocator)
   - maintains a free list of available CCM RAM, order by address
   - allocates from the smallest available free block
   - coalesces adjacent blocks on free
@@ -66,7 +67,7 @@ static void init()
 }
 
 // Return free memory available
-uint32_t custom_avail()
+static uint32_t ccm_avail()
 {
   uint32_t free = 0;
   for (memblk* b = ccm_list; b; b = b->next) {
@@ -182,7 +183,7 @@ static void* ccm_realloc(void* ptr, size_t osize, size_t nsize)
   }
 }
 
-void* custom_l_alloc(void *ud, void *ptr, size_t osize, size_t nsize)
+static void* ccm_l_alloc(void *ud, void *ptr, size_t osize, size_t nsize)
 {
   (void)ud; /* not used */
 
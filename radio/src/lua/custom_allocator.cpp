@@ -21,6 +21,5 @@
 
 #if defined(STM32F4)
 #include "ccm_allocator.cpp"
-#else
-#include "bin_allocator.cpp"
 #endif
+#include "slab_allocator.cpp"
@@ -21,8 +21,36 @@
 
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+
+struct LuaMemStats {
+  uint32_t slabBytes;     // bytes held by the slabs of the state
+  uint32_t slabUsed;      // bytes of slab slots in use
+  uint32_t heapBytes;     // bytes allocated from the heap
+  uint32_t peakBytes;     // peak of slab slots in use + heap bytes
+  uint16_t freeSlabs;     // slabs left in the common pool
+  uint8_t fragmentation;  // percentage of slab bytes not in use
+};
+
 #if defined(USE_CUSTOM_ALLOCATOR)
+enum LuaArena {
+  LUA_ARENA_SCRIPTS,
+  LUA_ARENA_WIDGETS,
+  LUA_ARENA_COUNT
+};
+
 // wrapper for our custom allocator for Lua
 void *custom_l_alloc(void *ud, void *ptr, size_t osize, size_t nsize);
+// user data to pass to lua_newstate() along with custom_l_alloc
+void *custom_l_arena(uint8_t idx);
 int custom_avail();
+
+void custom_l_stats(void *ud, LuaMemStats &stats);
+uint8_t custom_l_classes();
+void custom_l_class_stats(void *ud, uint8_t cls, uint16_t &size,
+                          uint16_t &slabs, uint16_t &used);
+#if defined(DEBUG)
+uint8_t custom_l_histogram(void *ud, const uint16_t **histogram);
+#endif
 #endif
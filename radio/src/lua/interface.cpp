@@ -30,16 +30,22 @@
 
 #include "lua_api.h"
 #include "lua_event.h"
+#include "lua_gc.h"
 
 #include "sdcard.h"
 #include "api_filesystem.h"
 #include "switches.h"
 #include "lib_file.h"
+#include "os/time.h"
 
 #if defined(COLORLCD)
   #include "standalone_lua.h"
 #endif
 
+#if defined(LUA_COMPILER)
+  #include "lua_cache.h"
+#endif
+
 extern "C" {
   #include <lundump.h>
 }
@@ -314,16 +320,21 @@ void luaDoGc(lua_State * L, bool full)
 #endif
     }
     else {
-      // we disable Lua for the rest of the session
-      if (L == lsScripts) luaDisable();
-#if defined(COLORLCD)
-      if (L == lsWidgets) lsWidgets = 0;
-#endif
+      luaGcError(L);
     }
     UNPROTECT_LUA();
   }
 }
 
+void luaGcError(lua_State * L)
+{
+  // we disable Lua for the rest of the session
+  if (L == lsScripts) luaDisable();
+#if defined(COLORLCD)
+  if (L == lsWidgets) lsWidgets = 0;
+#endif
+}
+
 void luaFree(lua_State * L, ScriptInternalData & sid)
 {
   PROTECT_LUA() {
@@ -388,8 +399,9 @@ static int luaDumpWriter(lua_State * L, const void* p, size_t size, void* u)
   @param stripDebug This is passed directly to luaU_dump()
     1 = remove debug info from bytecode (smaller but errors are less informative)
     0 = keep debug info
+  @retval true if the file was written successfully
 */
-static void luaDumpState(lua_State * L, const char * filename, const FILINFO * finfo, int stripDebug)
+static bool luaDumpState(lua_State * L, const char * filename, const FILINFO * finfo, int stripDebug)
 {
   FIL D;
   if (f_open(&D, filename, FA_WRITE | FA_CREATE_ALWAYS) == FR_OK) {
@@ -412,9 +424,51 @@ static void luaDumpState(lua_State * L, const char * filename, const FILINFO * f
       if (finfo != nullptr)
         f_utime(filename, finfo);  // set the file mod time
       TRACE("luaDumpState(%s): Saved bytecode to file.", filename);
+      return true;
     }
   } else
     TRACE_ERROR("luaDumpState(%s): Error: Could not open output file\n", filename);
+  return false;
+}
+
+/*
+  @fn luaCompileScriptFile(const char * path, uint16_t len, const FILINFO * src)
+  Compile a script source to its .luac version without running it.
+   Used by the bytecode cache to build scripts ahead of their first use.
+  @param path Full path and name of the script, without extension.
+  @param len Length of path.
+  @param src File info of the .lua source, used to timestamp the .luac file.
+  @retval true if the bytecode was saved
+*/
+bool luaCompileScriptFile(const char * path, uint16_t len, const FILINFO * src)
+{
+  char filename[LEN_FILE_PATH_MAX + FF_MAX_LFN + 1];
+  if (!mainState || luaState == INTERPRETER_PANIC ||
+      len + sizeof(SCRIPT_BIN_EXT) > sizeof(filename)) {
+    return false;
+  }
+
+  memcpy(filename, path, len);
+  strcpy(filename + len, SCRIPT_EXT);
+
+  // the main thread is not used to run scripts, it only holds the
+  // lsScripts coroutine: the compiled chunk is dropped right after dump
+  bool ret = false;
+  int t = lua_gettop(mainState);
+  PROTECT_LUA() {
+    if (luaL_loadfilex(mainState, filename, "t") == LUA_OK) {
+      strcpy(filename + len, SCRIPT_BIN_EXT);
+      ret = luaDumpState(mainState, filename, src,
+                         strchr(LUA_SCRIPT_LOAD_MODE, 'd') ? 0 : 1);
+    } else {
+      TRACE_ERROR("luaCompileScriptFile(%s): %s\n", filename,
+                  lua_tostring(mainState, -1));
+    }
+    lua_settop(mainState, t);
+  }
+  UNPROTECT_LUA();
+
+  return ret;
 }
 #endif  // LUA_COMPILER
 
@@ -467,6 +521,7 @@ int luaLoadScriptFileToState(lua_State * L, const char * filename, const char *
   FRESULT frLuaS, frLuaC;
 
   bool scriptNeedsCompile = false;
+  bool cacheHit = false;
   uint8_t loadFileType = 0;  // 1=text, 2=binary
 
   memclear(&fnoLuaS, sizeof(FILINFO));
@@ -482,16 +537,27 @@ int luaLoadScriptFileToState(lua_State * L, const char * filename, const char *
   }
   strncat(filenameFull, filename, fnamelen);
 
-  // check if binary version exists
-  strcpy(filenameFull + fnamelen, SCRIPT_BIN_EXT);
-  frLuaC = f_stat(filenameFull, &fnoLuaC);
+  if (strchr(lmode, 'b') && !strchr(lmode, 'c') && luaCacheIsFresh(filenameFull, fnamelen)) {
+    // binary version is known to be built from the current text version
+    frLuaS = frLuaC = FR_OK;
+    cacheHit = true;
+    loadFileType = 2;
+  }
+  else {
+    // check if binary version exists
+    strcpy(filenameFull + fnamelen, SCRIPT_BIN_EXT);
+    frLuaC = f_stat(filenameFull, &fnoLuaC);
 
-  // check if text version exists
-  strcpy(filenameFull + fnamelen, SCRIPT_EXT);
-  frLuaS = f_stat(filenameFull, &fnoLuaS);
+    // check if text version exists
+    strcpy(filenameFull + fnamelen, SCRIPT_EXT);
+    frLuaS = f_stat(filenameFull, &fnoLuaS);
+  }
 
   // decide which version to load, text or binary
-  if (frLuaC != FR_OK && frLuaS == FR_OK) {
+  if (cacheHit) {
+    // already decided
+  }
+  else if (frLuaC != FR_OK && frLuaS == FR_OK) {
     // only text version exists
     loadFileType = 1;
     scriptNeedsCompile = true;
@@ -512,6 +578,7 @@ int luaLoadScriptFileToState(lua_State * L, const char * filename, const char *
     } else {
       // use binary file
       loadFileType = 2;
+      luaCacheUpdate(filenameFull, fnamelen, &fnoLuaS);
     }
   }
   // else both versions are missing
@@ -550,8 +617,17 @@ int luaLoadScriptFileToState(lua_State * L, const char * filename, const char *
 
   // we don't pass <mode> on to loadfilex() because we want lua to load whatever file we specify, regardless of content
   int t = lua_gettop(L);
+#if defined(LUA_COMPILER)
+  uint32_t loadStart = time_get_ms();
+#endif
   lstatus = luaL_loadfilex(L, filenameFull, nullptr);
 #if defined(LUA_COMPILER)
+  if (cacheHit && lstatus != LUA_OK) {
+    // cached binary is gone or unusable, retry with the timestamps check
+    lua_settop(L, t);
+    luaCacheRemove(filenameFull, fnamelen);
+    return luaLoadScriptFileToState(L, filename, mode);
+  }
   // Check for bytecode encoding problem, eg. compiled for x64. Unfortunately Lua doesn't provide a unique error code for this. See Lua/src/lundump.c.
   if (lstatus == LUA_ERRSYNTAX && loadFileType == 2 && frLuaS == FR_OK && strstr(lua_tostring(L, -1), "precompiled")) {
     lua_settop(L, t); // reset stack to prevent phantom error
@@ -564,8 +640,11 @@ int luaLoadScriptFileToState(lua_State * L, const char * filename, const char *
   if (lstatus == LUA_OK) {
     if (scriptNeedsCompile && loadFileType == 1) {
       strcpy(filenameFull + fnamelen, SCRIPT_BIN_EXT);
-      luaDumpState(L, filenameFull, &fnoLuaS, (strchr(lmode, 'd') ? 0 : 1));
+      if (luaDumpState(L, filenameFull, &fnoLuaS, (strchr(lmode, 'd') ? 0 : 1))) {
+        luaCacheUpdate(filenameFull, fnamelen, &fnoLuaS);
+      }
     }
+    luaCacheRecordLoad(filenameFull, fnamelen, time_get_ms() - loadStart);
     ret = SCRIPT_OK;
   }
 #else
@@ -1042,7 +1121,7 @@ static bool resumeLua(bool init, bool allowLcdUsage)
   if (init) idx = 0;
 
   bool scriptWasRun = false;
-  bool fullGC = !allowLcdUsage;
+  bool gcStep = true;
 #if !defined(COLORLCD)
   static uint8_t luaDisplayStatistics = false;
 #endif
@@ -1164,9 +1243,11 @@ static bool resumeLua(bool init, bool allowLcdUsage)
       }
     }
     
-    // Full garbage collection at the start of every cycle
-    luaDoGc(lsScripts, fullGC);
-    fullGC = false;
+    // Incremental garbage collection at the start of every cycle
+    if (gcStep) {
+      luaGcStep(lsScripts);
+      gcStep = false;
+    }
 
     // Resume running the coroutine
     luaStatus = lua_resume(lsScripts, nullptr, inputsCount);
@@ -1330,8 +1411,17 @@ void checkLuaMemoryUsage()
 #endif
 }
 
-uint32_t luaGetMemUsed(lua_State * L)
+uint32_t luaGetMemUsed(lua_State * L, LuaMemStats * stats)
 {
+  if (stats) {
+    memclear(stats, sizeof(LuaMemStats));
+#if defined(USE_CUSTOM_ALLOCATOR)
+    void * ud;
+    if (L && lua_getallocf(L, &ud) == custom_l_alloc) {
+      custom_l_stats(ud, *stats);
+    }
+#endif
+  }
   return L ? (lua_gc(L, LUA_GCCOUNT, 0) << 10) + lua_gc(L, LUA_GCCOUNTB, 0) : 0;
 }
 
@@ -1340,7 +1430,7 @@ void luaInitMainState()
   if (mainState != nullptr) return;
 
 #if defined(USE_CUSTOM_ALLOCATOR)
-  mainState = lua_newstate(custom_l_alloc, nullptr);   //we use our own allocator!
+  mainState = lua_newstate(custom_l_alloc, custom_l_arena(LUA_ARENA_SCRIPTS));   //we use our own allocator!
 #elif defined(LUA_ALLOCATOR_TRACER)
   memclear(&lsScriptsTrace, sizeof(lsScriptsTrace));
   lsScriptsTrace.script = "lua_newstate(scripts)";
@@ -63,8 +63,33 @@ extern BitmapBuffer* luaLcdBuffer;
 
 extern uint32_t luaExtraMemoryUsage;
 void luaInitThemesAndWidgets();
+
+// Values read by widgets during refresh(), used to skip the next
+// refresh() when none of them changed
+enum LuaDependencyKind {
+  LUA_DEP_SOURCE,
+  LUA_DEP_SWITCH,
+  LUA_DEP_OUTPUT,
+  LUA_DEP_SHMVAR,
+  LUA_DEP_GVAR,      // flight mode * MAX_GVARS + gvar
+  LUA_DEP_SETTINGS,  // radio and model settings, see storageGetChangeCount()
+};
+
+#define LUA_DEPENDENCY(kind, idx)  (((uint32_t)(kind) << 16) | (uint16_t)(idx))
+
+// Returns a fingerprint of the current value of the dependency
+int32_t luaGetDependencyValue(uint32_t dependency);
+// Called by the API functions reading a value / a time-varying value
+void luaTrackDependency(uint32_t dependency);
+void luaTrackVolatile();
+#else
+#define luaTrackDependency(dependency)
+#define luaTrackVolatile()
 #endif
 
+// Called by the API functions reading the radio or model settings
+#define luaTrackSettings()  luaTrackDependency(LUA_DEPENDENCY(LUA_DEP_SETTINGS, 0))
+
 void luaInitMainState();
 void luaInit();
 void luaClose();
@@ -0,0 +1,393 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "edgetx.h"
+#include "sdcard.h"
+#include "lib_file.h"
+#include "os/time.h"
+
+#include "lua_api.h"
+#include "lua_states.h"
+#include "lua_cache.h"
+
+#define LUA_CACHE_MAGIC     0x4341554C  // "LUAC"
+#define LUA_CACHE_VERSION   1
+
+// minimum time between two background scan steps
+#define LUA_CACHE_COMPILE_INTERVAL_MS  100
+// maximum number of directory entries examined per scan step
+#define LUA_CACHE_SCAN_ENTRIES         16
+
+PACK(struct LuaCacheHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;
+});
+
+PACK(struct LuaCacheRecord {
+  uint32_t pathHash;
+  uint32_t srcHash;
+  char name[LUA_CACHE_NAME_LEN];
+});
+
+static LuaCacheEntry entries[LUA_CACHE_MAX_ENTRIES];
+// entries whose source fingerprint has been confirmed during this session
+static uint64_t verified = 0;
+static uint8_t entriesCount = 0;
+static bool manifestLoaded = false;
+static bool manifestDirty = false;
+
+static_assert(LUA_CACHE_MAX_ENTRIES <= 64, "verified bitmap too small");
+
+static uint32_t sourceFingerprint(const FILINFO * fno)
+{
+  uint32_t data[3] = {fno->fdate, fno->ftime, (uint32_t)fno->fsize};
+  return hash(data, sizeof(data));
+}
+
+static void loadManifest()
+{
+  FIL file;
+  LuaCacheHeader header;
+  UINT read;
+
+  manifestLoaded = true;
+  manifestDirty = false;
+  entriesCount = 0;
+  verified = 0;
+
+  if (f_open(&file, LUA_CACHE_MANIFEST, FA_READ) != FR_OK)
+    return;
+
+  if (f_read(&file, &header, sizeof(header), &read) == FR_OK &&
+      read == sizeof(header) && header.magic == LUA_CACHE_MAGIC &&
+      header.version == LUA_CACHE_VERSION) {
+    uint16_t count = min<uint16_t>(header.count, LUA_CACHE_MAX_ENTRIES);
+    while (entriesCount < count) {
+      LuaCacheRecord record;
+      if (f_read(&file, &record, sizeof(record), &read) != FR_OK ||
+          read != sizeof(record))
+        break;
+      LuaCacheEntry & entry = entries[entriesCount++];
+      memclear(&entry, sizeof(entry));
+      entry.pathHash = record.pathHash;
+      entry.srcHash = record.srcHash;
+      memcpy(entry.name, record.name, LUA_CACHE_NAME_LEN);
+      entry.name[LUA_CACHE_NAME_LEN - 1] = '\0';
+    }
+  }
+
+  f_close(&file);
+  TRACE("luaCache: %u entries loaded", entriesCount);
+}
+
+static void saveManifest()
+{
+  FIL file;
+  UINT written;
+
+  if (f_open(&file, LUA_CACHE_MANIFEST, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK) {
+    TRACE_ERROR("luaCache: could not write manifest\n");
+    return;
+  }
+
+  LuaCacheHeader header = {LUA_CACHE_MAGIC, LUA_CACHE_VERSION, 0};
+  for (uint8_t i = 0; i < entriesCount; i++) {
+    if (entries[i].srcHash) header.count++;
+  }
+
+  FRESULT result = f_write(&file, &header, sizeof(header), &written);
+  for (uint8_t i = 0; result == FR_OK && i < entriesCount; i++) {
+    const LuaCacheEntry & entry = entries[i];
+    if (!entry.srcHash) continue;
+    LuaCacheRecord record;
+    record.pathHash = entry.pathHash;
+    record.srcHash = entry.srcHash;
+    memcpy(record.name, entry.name, LUA_CACHE_NAME_LEN);
+    result = f_write(&file, &record, sizeof(record), &written);
+  }
+
+  f_close(&file);
+  if (result != FR_OK) {
+    f_unlink(LUA_CACHE_MANIFEST);
+  }
+  manifestDirty = false;
+}
+
+static int findEntry(uint32_t pathHash)
+{
+  if (!manifestLoaded) loadManifest();
+
+  for (uint8_t i = 0; i < entriesCount; i++) {
+    if (entries[i].pathHash == pathHash) return i;
+  }
+  return -1;
+}
+
+static int findOrCreateEntry(const char * path, uint16_t len)
+{
+  uint32_t pathHash = hash(path, len);
+  int idx = findEntry(pathHash);
+  if (idx >= 0 || entriesCount >= LUA_CACHE_MAX_ENTRIES) return idx;
+
+  idx = entriesCount++;
+  LuaCacheEntry & entry = entries[idx];
+  memclear(&entry, sizeof(entry));
+  entry.pathHash = pathHash;
+  // keep the end of the path, that is the most meaningful part
+  uint16_t skip = len > LUA_CACHE_NAME_LEN - 1 ? len - (LUA_CACHE_NAME_LEN - 1) : 0;
+  memcpy(entry.name, path + skip, len - skip);
+  return idx;
+}
+
+bool luaCacheIsFresh(const char * path, uint16_t len)
+{
+  int idx = findEntry(hash(path, len));
+  if (idx < 0 || !entries[idx].srcHash) return false;
+
+  if (!(verified & (1ull << idx))) {
+    // entry read from the manifest: the source may have been modified
+    // since, check it once (the bytecode file itself needs no check)
+    char filename[LEN_FILE_PATH_MAX + FF_MAX_LFN + 1];
+    FILINFO fno;
+    if (len + sizeof(SCRIPT_EXT) > sizeof(filename)) return false;
+    memcpy(filename, path, len);
+    strcpy(filename + len, SCRIPT_EXT);
+    if (f_stat(filename, &fno) != FR_OK ||
+        sourceFingerprint(&fno) != entries[idx].srcHash) {
+      return false;
+    }
+    verified |= (1ull << idx);
+  }
+
+  return true;
+}
+
+void luaCacheUpdate(const char * path, uint16_t len, const FILINFO * src)
+{
+  int idx = findOrCreateEntry(path, len);
+  if (idx < 0) return;
+
+  uint32_t srcHash = sourceFingerprint(src);
+  if (entries[idx].srcHash != srcHash) {
+    entries[idx].srcHash = srcHash;
+    manifestDirty = true;
+  }
+  verified |= (1ull << idx);
+}
+
+void luaCacheRemove(const char * path, uint16_t len)
+{
+  int idx = findEntry(hash(path, len));
+  if (idx < 0) return;
+
+  entries[idx].srcHash = 0;
+  verified &= ~(1ull << idx);
+  manifestDirty = true;
+}
+
+void luaCacheRecordLoad(const char * path, uint16_t len, uint32_t ms)
+{
+  int idx = findOrCreateEntry(path, len);
+  if (idx < 0) return;
+
+  LuaCacheEntry & entry = entries[idx];
+  entry.lastLoadMs = min<uint32_t>(ms, UINT16_MAX);
+  entry.maxLoadMs = max(entry.maxLoadMs, entry.lastLoadMs);
+  if (entry.loads < UINT16_MAX) entry.loads++;
+}
+
+uint8_t luaCacheGetEntriesCount()
+{
+  return entriesCount;
+}
+
+const LuaCacheEntry * luaCacheGetEntry(uint8_t idx)
+{
+  return idx < entriesCount ? &entries[idx] : nullptr;
+}
+
+// Background scan
+
+static const char * const scanRoots[] = {
+  SCRIPTS_MIXES_PATH,
+  SCRIPTS_FUNCS_PATH,
+  SCRIPTS_TELEM_PATH,
+  SCRIPTS_TOOLS_PATH,
+  SCRIPTS_RGB_PATH,
+  WIDGETS_PATH,  // scanned one level deep
+};
+
+enum LuaCacheScanState {
+  SCAN_START,
+  SCAN_RUNNING,
+  SCAN_DONE,
+};
+
+static struct {
+  uint8_t state;
+  uint8_t root;
+  uint8_t depth;  // number of open directories
+  DIR dirs[2];
+  uint16_t pathlen[2];
+  char path[LEN_FILE_PATH_MAX + 2 * FF_MAX_LFN + 1];
+  uint32_t lastCompile;
+} scan;
+
+static void closeScanDirs()
+{
+  while (scan.depth > 0) {
+    f_closedir(&scan.dirs[--scan.depth]);
+  }
+}
+
+void luaCacheInvalidate()
+{
+  closeScanDirs();
+  manifestLoaded = false;
+  entriesCount = 0;
+  verified = 0;
+  scan.state = SCAN_START;
+}
+
+static bool openScanDir(const char * name)
+{
+  uint16_t len = scan.depth > 0 ? scan.pathlen[scan.depth - 1] : 0;
+  uint16_t namelen = strlen(name);
+  if (len + namelen + 2 > sizeof(scan.path)) return false;
+
+  if (len > 0) scan.path[len++] = '/';
+  memcpy(scan.path + len, name, namelen + 1);
+  len += namelen;
+
+  if (f_opendir(&scan.dirs[scan.depth], scan.path) != FR_OK) return false;
+  scan.pathlen[scan.depth++] = len;
+  return true;
+}
+
+// returns true if a compilation was performed
+static bool checkScript(const FILINFO * fno)
+{
+  uint16_t dirlen = scan.pathlen[scan.depth - 1];
+  uint8_t fnlen = 0, extlen = 0;
+  getFileExtension(fno->fname, 0, 0, &fnlen, &extlen);
+  uint16_t len = dirlen + 1 + fnlen - extlen;
+  if (len + sizeof(SCRIPT_BIN_EXT) > sizeof(scan.path)) return false;
+
+  scan.path[dirlen] = '/';
+  memcpy(scan.path + dirlen + 1, fno->fname, fnlen - extlen);
+  scan.path[len] = '\0';
+
+  uint32_t srcHash = sourceFingerprint(fno);
+  int idx = findEntry(hash(scan.path, len));
+  if (idx >= 0 && entries[idx].srcHash == srcHash) {
+    // confirmed by the directory listing, no stat needed
+    verified |= (1ull << idx);
+    scan.path[dirlen] = '\0';
+    return false;
+  }
+
+  bool compiled = false;
+  FILINFO bin;
+  strcpy(scan.path + len, SCRIPT_BIN_EXT);
+  if (f_stat(scan.path, &bin) == FR_OK &&
+      (uint32_t)((bin.fdate << 16) + bin.ftime) >=
+          (uint32_t)((fno->fdate << 16) + fno->ftime)) {
+    // bytecode already up to date
+    luaCacheUpdate(scan.path, len, fno);
+  }
+  else {
+    scan.path[len] = '\0';
+    if (luaCompileScriptFile(scan.path, len, fno)) {
+      luaCacheUpdate(scan.path, len, fno);
+    }
+    compiled = true;
+  }
+
+  scan.path[dirlen] = '\0';
+  return compiled;
+}
+
+static void scanStep()
+{
+  FILINFO fno;
+
+  for (uint8_t n = 0; n < LUA_CACHE_SCAN_ENTRIES; n++) {
+    if (scan.depth == 0) {
+      if (scan.root >= DIM(scanRoots)) {
+        scan.state = SCAN_DONE;
+        TRACE("luaCache: scan done (%u entries)", entriesCount);
+        return;
+      }
+      openScanDir(scanRoots[scan.root++]);
+      continue;
+    }
+
+    FRESULT res = f_readdir(&scan.dirs[scan.depth - 1], &fno);
+    if (res != FR_OK || fno.fname[0] == '\0') {
+      f_closedir(&scan.dirs[--scan.depth]);
+      continue;
+    }
+
+    if (fno.fname[0] == '.') continue;
+
+    if (fno.fattrib & AM_DIR) {
+      // widgets are stored in one directory each
+      if (scan.depth == 1 && scan.root == DIM(scanRoots)) {
+        openScanDir(fno.fname);
+      }
+      continue;
+    }
+
+    const char * ext = getFileExtension(fno.fname);
+    if (ext && !strcasecmp(ext, SCRIPT_EXT) && checkScript(&fno)) {
+      // one compilation per step
+      return;
+    }
+  }
+}
+
+void luaCacheWakeup()
+{
+  if (!sdMounted() || luaState != INTERPRETER_RUNNING ||
+      scriptInternalData[0].reference == SCRIPT_STANDALONE)
+    return;
+
+  switch (scan.state) {
+    case SCAN_START:
+      if (!manifestLoaded) loadManifest();
+      scan.root = 0;
+      scan.depth = 0;
+      scan.state = SCAN_RUNNING;
+      break;
+
+    case SCAN_RUNNING:
+      if (time_get_ms() - scan.lastCompile >= LUA_CACHE_COMPILE_INTERVAL_MS) {
+        scanStep();
+        scan.lastCompile = time_get_ms();
+      }
+      break;
+
+    case SCAN_DONE:
+      if (manifestDirty) saveManifest();
+      break;
+  }
+}
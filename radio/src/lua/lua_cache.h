@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "ff.h"
+
+// Bytecode cache manifest
+//
+// Keeps track of which .luac files are known to be compiled from the
+// current version of their .lua source, so that loading a script does
+// not need to stat both files. The manifest is persisted on the SD card
+// and refreshed by a background scan of /SCRIPTS and /WIDGETS, which also
+// compiles any script whose bytecode is missing or outdated.
+
+#define LUA_CACHE_MANIFEST   SCRIPTS_PATH PATH_SEPARATOR "luac.idx"
+
+#if defined(COLORLCD)
+  #define LUA_CACHE_MAX_ENTRIES  64
+#else
+  #define LUA_CACHE_MAX_ENTRIES  24
+#endif
+
+#define LUA_CACHE_NAME_LEN     20
+
+struct LuaCacheEntry {
+  uint32_t pathHash;    // hash of the script path without extension
+  uint32_t srcHash;     // fingerprint of the source (timestamp + size)
+  char name[LUA_CACHE_NAME_LEN];  // path tail, for reporting only
+  // not persisted
+  uint16_t lastLoadMs;
+  uint16_t maxLoadMs;
+  uint16_t loads;
+};
+
+// Returns true if the .luac matching <path> (length <len>, no extension)
+// is known to be up to date with its source.
+bool luaCacheIsFresh(const char * path, uint16_t len);
+
+// Records that the .luac for <path> has been built from <src>
+void luaCacheUpdate(const char * path, uint16_t len, const FILINFO * src);
+
+// Drops the entry for <path>, e.g. when the cached bytecode failed to load
+void luaCacheRemove(const char * path, uint16_t len);
+
+// Records the time spent loading <path>
+void luaCacheRecordLoad(const char * path, uint16_t len, uint32_t ms);
+
+// Drops the in-memory manifest and restarts the background scan,
+// must be called whenever the SD card content may have changed
+void luaCacheInvalidate();
+
+// Background scan & compilation step, processes at most one script
+void luaCacheWakeup();
+
+uint8_t luaCacheGetEntriesCount();
+const LuaCacheEntry * luaCacheGetEntry(uint8_t idx);
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "edgetx.h"
+#include "tasks.h"
+
+#include "lua_api.h"
+#include "lua_states.h"
+#include "lua_gc.h"
+
+#define LUA_GC_FRAME_US       (MENU_TASK_PERIOD * 1000)
+// share of the UI frame the GC may use when it is late
+#define LUA_GC_MAX_BUDGET_US  (LUA_GC_FRAME_US / 4)
+// a small step is always done so that memory stays bounded
+#define LUA_GC_MIN_BUDGET_US  500
+#define LUA_GC_MAX_STEP_KB    64
+// granularity of the steps, to check the time budget in between
+#define LUA_GC_CHUNK_KB       4
+
+static const uint16_t pauseBucketLimits[LUA_GC_PAUSE_BUCKETS - 1] = {
+  100, 250, 500, 1000, 2000, 5000, 10000
+};
+
+struct LuaGcPacer {
+  uint32_t lastMem;
+  LuaGcStats stats;
+};
+
+#if defined(COLORLCD)
+static LuaGcPacer pacers[2];
+#else
+static LuaGcPacer pacers[1];
+#endif
+
+static uint32_t frameStart = 0;
+
+static LuaGcPacer & getPacer(lua_State * L)
+{
+#if defined(COLORLCD)
+  if (L == lsWidgets) return pacers[1];
+#endif
+  return pacers[0];
+}
+
+void luaGcFrameStart()
+{
+  frameStart = timersGetUsTick();
+}
+
+uint16_t luaGcPauseBucketLimit(uint8_t bucket)
+{
+  return bucket < DIM(pauseBucketLimits) ? pauseBucketLimits[bucket] : 0;
+}
+
+const LuaGcStats * luaGcGetStats(lua_State * L)
+{
+  return &getPacer(L).stats;
+}
+
+static uint32_t getBudget()
+{
+  uint32_t elapsed = timersGetUsTick() - frameStart;
+  uint32_t budget = elapsed < LUA_GC_FRAME_US ? LUA_GC_FRAME_US - elapsed : 0;
+  return limit<uint32_t>(LUA_GC_MIN_BUDGET_US, budget, LUA_GC_MAX_BUDGET_US);
+}
+
+static uint16_t getStepKB(const LuaGcStats & stats, uint32_t memUsed,
+                          uint32_t budget)
+{
+  // collect at least what has been allocated since the last step
+  uint32_t kb = stats.allocRate / 1024 + 1;
+
+#if (LUA_MEM_MAX > 0)
+  // catch up faster when getting close to the limit
+  if (memUsed > LUA_MEM_MAX / 4 * 3) kb *= 2;
+#else
+  (void)memUsed;
+#endif
+
+  if (stats.usPerKB > 0) {
+    kb = min<uint32_t>(kb, budget / stats.usPerKB);
+  }
+
+  return limit<uint32_t>(1, kb, LUA_GC_MAX_STEP_KB);
+}
+
+void luaGcStep(lua_State * L)
+{
+  if (!L) return;
+
+  LuaGcPacer & pacer = getPacer(L);
+  LuaGcStats & stats = pacer.stats;
+
+  uint32_t mem = luaGetMemUsed(L);
+  uint32_t allocated = mem > pacer.lastMem ? mem - pacer.lastMem : 0;
+  stats.allocRate = (stats.allocRate * 3 + allocated) / 4;
+
+  uint32_t budget = getBudget();
+  uint16_t stepKB = getStepKB(stats, mem, budget);
+  uint16_t doneKB = 0;
+
+  bool failed = false;
+  uint32_t start = timersGetUsTick();
+  PROTECT_LUA() {
+    while (doneKB < stepKB) {
+      uint16_t chunk = min<uint16_t>(stepKB - doneKB, LUA_GC_CHUNK_KB);
+      bool cycleDone = lua_gc(L, LUA_GCSTEP, chunk);
+      doneKB += chunk;
+      if (cycleDone) {
+        stats.cycles++;
+        break;
+      }
+      if (timersGetUsTick() - start >= budget) break;
+    }
+  }
+  else {
+    failed = true;
+  }
+  UNPROTECT_LUA();
+
+  if (failed) {
+    luaGcError(L);
+    return;
+  }
+
+  uint32_t pause = timersGetUsTick() - start;
+
+  stats.steps++;
+  stats.maxPause = max<uint32_t>(stats.maxPause, min<uint32_t>(pause, UINT16_MAX));
+  uint8_t bucket = 0;
+  while (bucket < DIM(pauseBucketLimits) && pause >= pauseBucketLimits[bucket])
+    bucket++;
+  stats.pauses[bucket]++;
+
+  if (doneKB > 0) {
+    uint32_t usPerKB = pause / doneKB;
+    stats.usPerKB = stats.usPerKB ? (stats.usPerKB * 3 + usPerKB) / 4 : usPerKB;
+  }
+
+  pacer.lastMem = luaGetMemUsed(L);
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+struct lua_State;
+typedef struct lua_State lua_State;
+
+// Incremental GC pacing for the UI path
+//
+// Instead of a full collection (or a fixed step) every frame, each Lua
+// state gets an incremental step sized from its allocation rate over the
+// previous frame, bounded by the time left in the current UI frame.
+
+#define LUA_GC_PAUSE_BUCKETS  8
+
+struct LuaGcStats {
+  uint32_t allocRate;      // bytes allocated per frame (smoothed)
+  uint16_t usPerKB;        // measured cost of collecting 1 KB (smoothed)
+  uint16_t maxPause;       // longest pause in us
+  uint32_t steps;
+  uint32_t cycles;         // completed GC cycles
+  // pause duration histogram, see luaGcPauseBucketLimit()
+  uint32_t pauses[LUA_GC_PAUSE_BUCKETS];
+};
+
+// To be called at the beginning of each UI frame
+void luaGcFrameStart();
+
+// Runs an incremental GC step on L fitting in the current frame budget
+void luaGcStep(lua_State * L);
+
+const LuaGcStats * luaGcGetStats(lua_State * L);
+
+// Upper limit (in us) of a pause histogram bucket, 0 for the last one
+uint16_t luaGcPauseBucketLimit(uint8_t bucket);
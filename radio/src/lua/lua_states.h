@@ -22,6 +22,7 @@
 #pragma once
 
 #include "definitions.h"
+#include "ff.h"
 
 EXTERN_C_START
   #include "lua.h"
@@ -74,7 +75,14 @@ extern lua_State* lsWidgets;
 
 void luaSetInstructionsLimit(lua_State* L, int count);
 int luaLoadScriptFileToState(lua_State * L, const char * filename, const char * mode);
+#if defined(LUA_COMPILER)
+bool luaCompileScriptFile(const char * path, uint16_t len, const FILINFO * src);
+#endif
 void luaRegisterLibraries(lua_State * L);
 void luaClose(lua_State ** L);
 void luaDoGc(lua_State * L, bool full);
-uint32_t luaGetMemUsed(lua_State * L);
+void luaGcError(lua_State * L);
+#if defined(__cplusplus)
+struct LuaMemStats;
+uint32_t luaGetMemUsed(lua_State * L, LuaMemStats * stats = nullptr);
+#endif
@@ -21,6 +21,8 @@
 
 #include "lua_widget.h"
 
+#include <algorithm>
+
 #include "lua_api.h"
 #include "lua_event.h"
 #include "lua_widget_factory.h"
@@ -29,11 +31,24 @@
 #include "touch.h"
 #include "view_main.h"
 #include "os/time.h"
+#include "timers_driver.h"
 
 #define MAX_INSTRUCTIONS (20000 / 100)
 
 LuaScriptManager *luaScriptManager = nullptr;
 
+std::vector<LuaWidget*> LuaWidget::instances;
+
+void luaTrackDependency(uint32_t dependency)
+{
+  if (luaScriptManager) luaScriptManager->trackDependency(dependency);
+}
+
+void luaTrackVolatile()
+{
+  if (luaScriptManager) luaScriptManager->trackVolatile();
+}
+
 #if defined(HARDWARE_TOUCH)
 uint32_t LuaEventHandler::downTime = 0;
 uint32_t LuaEventHandler::tapTime = 0;
@@ -223,7 +238,9 @@ void LuaWidget::redraw_cb(lv_event_t* e)
 
     auto save = luaScriptManager;
     luaScriptManager = widget;
+    widget->startRefresh();
     widget->refresh(&buf);
+    widget->endRefresh();
     luaScriptManager = save;
   }
 }
@@ -236,6 +253,8 @@ LuaWidget::LuaWidget(const WidgetFactory* factory, Window* parent,
     zoneRectDataRef(zoneRectDataRef), optionsDataRef(optionsDataRef),
     errorMessage(nullptr)
 {
+  instances.push_back(this);
+
   // Push create function
   lua_rawgeti(lsWidgets, LUA_REGISTRYINDEX, createFunctionRef);
   // Push stored zone for 'create' call
@@ -267,6 +286,8 @@ LuaWidget::LuaWidget(const WidgetFactory* factory, Window* parent,
 
 LuaWidget::~LuaWidget()
 {
+  instances.erase(std::remove(instances.begin(), instances.end(), this),
+                  instances.end());
   luaL_unref(lsWidgets, LUA_REGISTRYINDEX, luaScriptContextRef);
   luaL_unref(lsWidgets, LUA_REGISTRYINDEX, zoneRectDataRef);
   free(errorMessage);
@@ -313,23 +334,31 @@ void LuaWidget::checkEvents()
       lv_obj_get_coords(lvobj, &a);
       // Check widget is at least partially visible
       if (a.x2 >= 0 && a.x1 < LCD_W) {
-        auto save = luaScriptManager;
-        PROTECT_LUA() {
-          luaScriptManager = this;
-          refresh(nullptr);
-          if (!errorMessage) {
-            if (!callRefs(lsWidgets)) {
-              setErrorMessage("function");
+        if (!needsRefresh()) {
+          skipRefresh();
+        } else {
+          auto save = luaScriptManager;
+          PROTECT_LUA() {
+            luaScriptManager = this;
+            startRefresh();
+            refresh(nullptr);
+            if (!errorMessage) {
+              if (!callRefs(lsWidgets)) {
+                setErrorMessage("function");
+              }
             }
+            refreshInstructionsPercent = instructionsPercent;
+          } else {
+            setErrorMessage("function");
           }
-          refreshInstructionsPercent = instructionsPercent;
-        } else {
-          setErrorMessage("function");
+          endRefresh();
+          luaScriptManager = save;
+          UNPROTECT_LUA();
         }
-        luaScriptManager = save;
-        UNPROTECT_LUA();
       }
     }
+  } else if (lv_obj_is_visible(lvobj) && !needsRefresh()) {
+    skipRefresh();
   } else {
     // Force call to redraw_cb()
     invalidate();
@@ -381,6 +410,8 @@ void LuaWidget::update()
   if (lua_pcall(lsWidgets, 2, 0, 0) != 0)
     setErrorMessage("update()");
 
+  refreshPending = true;
+
   if (useLvglLayout()) {
     if (!lv_obj_has_flag(lvobj, LV_OBJ_FLAG_HIDDEN)) {
       lv_area_t a;
@@ -443,13 +474,17 @@ void LuaWidget::updateZoneRect(rect_t rect, bool updateUI)
 
     lua_pop(lsWidgets, 1);
 
-    if (changed && updateUI)
-      update();
+    if (changed) {
+      refreshPending = true;
+      if (updateUI) update();
+    }
   }
 }
 
 void LuaWidget::onFullscreen(bool enable)
 {
+  refreshPending = true;
+
   if (enable) {
     setupHandler(this);
   } else {
@@ -468,6 +503,7 @@ void LuaWidget::setErrorMessage(const char* funcName)
   TRACE("Widget disabled");
 
   errorMessage = (char*)malloc(err_len + 1);
+  refreshPending = true;
 
   if (errorMessage) {
     snprintf(errorMessage, err_len, "ERROR in %s: %s", funcName, lua_err);
@@ -579,6 +615,77 @@ void LuaWidget::clear()
 
 bool LuaWidget::useLvglLayout() const { return luaFactory()->useLvglLayout(); }
 
+// Returns false if refresh() may be skipped this frame: the maximum refresh
+// rate of the widget has been reached, or none of the values read by the
+// last refresh() has changed since.
+bool LuaWidget::needsRefresh()
+{
+  // fullscreen widgets get all the events
+  if (fullscreen || refreshPending) return true;
+
+  uint32_t elapsed = time_get_ms() - lastRefresh;
+  if (elapsed < luaFactory()->getRefreshPeriod()) return false;
+
+  if (untracked || elapsed >= LUA_WIDGET_MAX_SKIP_TIME) return true;
+
+  for (uint8_t i = 0; i < dependenciesCount; i++) {
+    const Dependency& dep = dependencies[i];
+    if (luaGetDependencyValue(dep.key) != dep.value) return true;
+  }
+
+  return false;
+}
+
+void LuaWidget::skipRefresh()
+{
+  refreshStats.skipped += 1;
+  // widget is still visible, background() must not be called
+  refreshed = true;
+}
+
+void LuaWidget::startRefresh()
+{
+  dependenciesCount = 0;
+  untracked = false;
+  tracking = true;
+  refreshPending = false;
+  refreshStart = timersGetUsTick();
+}
+
+void LuaWidget::endRefresh()
+{
+  uint32_t duration = timersGetUsTick() - refreshStart;
+
+  tracking = false;
+  lastRefresh = time_get_ms();
+
+  refreshStats.calls += 1;
+  refreshStats.totalTime += duration;
+  if (duration > refreshStats.maxTime)
+    refreshStats.maxTime = min<uint32_t>(duration, UINT16_MAX);
+}
+
+void LuaWidget::trackDependency(uint32_t dependency)
+{
+  if (!tracking) return;
+
+  for (uint8_t i = 0; i < dependenciesCount; i++) {
+    if (dependencies[i].key == dependency) return;
+  }
+
+  if (dependenciesCount < LUA_WIDGET_MAX_DEPENDENCIES) {
+    dependencies[dependenciesCount++] = {dependency,
+                                         luaGetDependencyValue(dependency)};
+  } else {
+    untracked = true;
+  }
+}
+
+void LuaWidget::trackVolatile()
+{
+  if (tracking) untracked = true;
+}
+
 bool LuaWidget::isAppMode() const
 {
   return ((WidgetsContainer*)parent)->isAppMode();
@@ -34,6 +34,12 @@
 
 #define LUA_TAP_TIME 250 // 250 ms
 
+// Values a widget may read during refresh() and still be skipped
+#define LUA_WIDGET_MAX_DEPENDENCIES  16
+// refresh() is called at least this often (ms), as widgets may also depend
+// on values not tracked (files, random numbers, ...)
+#define LUA_WIDGET_MAX_SKIP_TIME     1000
+
 class LuaWidgetFactory;
 
 class LuaEventHandler
@@ -88,6 +94,10 @@ class LuaScriptManager : public LuaEventHandler
 
   virtual void luaShowError() = 0;
 
+  // Values read by refresh(), see luaTrackDependency()
+  virtual void trackDependency(uint32_t dependency) {}
+  virtual void trackVolatile() {}
+
   uint8_t refreshInstructionsPercent;
 
   void createTelemetryQueue();
@@ -102,6 +112,13 @@ class LuaScriptManager : public LuaEventHandler
 #endif
 };
 
+struct LuaWidgetRefreshStats {
+  uint32_t calls;      // refresh() calls
+  uint32_t skipped;    // refresh() calls saved by the scheduler
+  uint32_t totalTime;  // us
+  uint16_t maxTime;    // us
+};
+
 class LuaWidget : public Widget, public LuaScriptManager
 {
   friend class LuaWidgetFactory;
@@ -142,6 +159,18 @@ class LuaWidget : public Widget, public LuaScriptManager
 
   void pushOptionsTable();
 
+  void trackDependency(uint32_t dependency) override;
+  void trackVolatile() override;
+
+  const LuaWidgetRefreshStats& getRefreshStats() const { return refreshStats; }
+  void resetRefreshStats() { refreshStats = {}; }
+
+  static uint8_t getInstancesCount() { return instances.size(); }
+  static LuaWidget* getInstance(uint8_t idx)
+  {
+    return idx < instances.size() ? instances[idx] : nullptr;
+  }
+
  protected:
   bool inSettings = false;
   lv_obj_t* errorLabel = nullptr;
@@ -150,6 +179,27 @@ class LuaWidget : public Widget, public LuaScriptManager
   char* errorMessage;
   bool refreshed = false;
 
+  // Refresh scheduling
+  struct Dependency {
+    uint32_t key;
+    int32_t value;
+  };
+  Dependency dependencies[LUA_WIDGET_MAX_DEPENDENCIES];
+  uint8_t dependenciesCount = 0;
+  bool tracking = false;
+  bool untracked = false;  // last refresh() read values not tracked
+  bool refreshPending = true;
+  uint32_t lastRefresh = 0;
+  uint32_t refreshStart = 0;
+  LuaWidgetRefreshStats refreshStats = {};
+
+  static std::vector<LuaWidget*> instances;
+
+  bool needsRefresh();
+  void skipRefresh();
+  void startRefresh();
+  void endRefresh();
+
   // Window interface
   void onClicked() override;
   void onCancel() override;
@@ -31,7 +31,7 @@
 LuaWidgetFactory::LuaWidgetFactory(const char* name, ZoneOption* widgetOptions, int optionDefinitionsReference,
                                    int createFunction, int updateFunction, int refreshFunction,
                                    int backgroundFunction, int translateFunction, bool lvglLayout,
-                                   const char* filename) :
+                                   uint16_t refreshPeriod, const char* filename) :
     WidgetFactory(name, widgetOptions),
     optionDefinitionsReference(optionDefinitionsReference),
     createFunction(createFunction),
@@ -40,6 +40,7 @@ LuaWidgetFactory::LuaWidgetFactory(const char* name, ZoneOption* widgetOptions,
     backgroundFunction(backgroundFunction),
     translateFunction(translateFunction),
     lvglLayout(lvglLayout),
+    refreshPeriod(refreshPeriod),
     path(filename)
 {
   path = path.substr(0, path.rfind("/") + 1);
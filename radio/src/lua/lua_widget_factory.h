@@ -31,7 +31,7 @@ class LuaWidgetFactory : public WidgetFactory
   LuaWidgetFactory(const char* name, ZoneOption* widgetOptions, int optionDefinitionsReference,
                    int createFunction, int updateFunction, int refreshFunction,
                    int backgroundFunction, int translateFunction, bool lvgllayout,
-                   const char* filename);
+                   uint16_t refreshPeriod, const char* filename);
   ~LuaWidgetFactory();
 
   Widget* create(Window* parent, const rect_t& rect,
@@ -41,6 +41,8 @@ class LuaWidgetFactory : public WidgetFactory
   bool isLuaWidgetFactory() const override { return true; }
 
   bool useLvglLayout() const { return lvglLayout; }
+  // Minimum time between two refresh() calls in ms (0 = every frame)
+  uint16_t getRefreshPeriod() const { return refreshPeriod; }
 
   static ZoneOption* parseOptionDefinitions(int reference);
   const void parseOptionDefaults() const override;
@@ -55,5 +57,6 @@ class LuaWidgetFactory : public WidgetFactory
   int backgroundFunction;
   int translateFunction;
   bool lvglLayout;
+  uint16_t refreshPeriod;
   std::string path;
 };
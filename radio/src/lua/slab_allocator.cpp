@@ -0,0 +1,373 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include "edgetx.h"
+#include "custom_allocator.h"
+
+/*
+  Slab allocator for Lua states
+  - small blocks are served from size classes; each class is backed by
+    slabs of SLAB_SIZE bytes taken from a common pool
+  - each Lua state allocates from its own arena, so that short lived
+    widget objects do not pin slabs holding long lived script objects
+  - a slab goes back to the pool as soon as it is empty (one empty slab
+    is kept per class to avoid thrashing)
+  - bigger blocks and blocks not fitting in the pool go to the heap
+*/
+
+// Size classes, covering the most frequent Lua 5.2 objects on 32-bit
+// targets: short strings (16 bytes header), upvalues, closures, tables
+// (32 bytes) and small node / array parts. They can be re-tuned with the
+// allocation histogram recorded in DEBUG builds ("meminfo" CLI command).
+static const uint16_t slabClassSize[] = { 16, 24, 32, 48, 64, 96, 128 };
+#define SLAB_CLASSES      DIM(slabClassSize)
+#define SLAB_MAX_BLOCK    128
+
+#if defined(SIMU)
+  #define SLAB_SIZE       1024
+  #define SLAB_POOL_SIZE  (64 * 1024)
+#elif defined(STM32F4)
+  // carved from CCM RAM, the rest of CCM RAM remains available for
+  // bigger blocks
+  #define SLAB_SIZE       512
+  #define SLAB_POOL_SIZE  (24 * 1024)
+#else
+  #define SLAB_SIZE       256
+  #define SLAB_POOL_SIZE  (10 * 1024)
+#endif
+
+union SlabSlot {
+  union SlabSlot * next;
+  uint8_t data[8];
+};
+
+struct Slab {
+  Slab * next;          // next slab in the arena class list / pool free list
+  SlabSlot * freeList;  // free slots of this slab
+  uint16_t used;        // slots in use
+  uint8_t cls;
+  uint8_t arena;
+};
+
+#define SLAB_COUNT        (SLAB_POOL_SIZE / SLAB_SIZE)
+#define SLAB_HEADER_SIZE  ((sizeof(Slab) + 7) & ~7)  // keeps slots 8 bytes aligned
+
+struct SlabArena {
+  Slab * partial[SLAB_CLASSES];  // slabs with at least one free slot
+  uint16_t slabs[SLAB_CLASSES];  // slabs owned per class
+  uint16_t used[SLAB_CLASSES];   // slots in use per class
+  uint32_t heapBytes;
+  uint32_t peakBytes;
+#if defined(DEBUG)
+  // requests per 8 bytes bucket, last bucket is for bigger blocks
+  uint16_t histogram[SLAB_MAX_BLOCK / 8 + 1];
+#endif
+};
+
+static SlabArena arenas[LUA_ARENA_COUNT];
+static uint8_t * pool = nullptr;
+static Slab * freeSlabs = nullptr;
+static uint16_t freeSlabsCount = 0;
+
+#if defined(STM32F4)
+  #define heap_l_alloc ccm_l_alloc
+#else
+static void * heap_l_alloc(void * ud, void * ptr, size_t osize, size_t nsize)
+{
+  (void)ud; (void)osize;
+
+  if (nsize == 0) {
+    free(ptr);
+    return nullptr;
+  }
+  return realloc(ptr, nsize);
+}
+#endif
+
+#if !defined(STM32F4)
+static uint8_t slabPool[SLAB_POOL_SIZE] __attribute__((aligned(8)));
+#endif
+
+static void slab_init()
+{
+  if (pool) return;
+
+#if defined(STM32F4)
+  pool = (uint8_t *)ccm_l_alloc(nullptr, nullptr, 0, SLAB_POOL_SIZE);
+  if (!pool) return;
+#else
+  pool = slabPool;
+#endif
+
+  for (int i = SLAB_COUNT - 1; i >= 0; i--) {
+    Slab * slab = (Slab *)(pool + i * SLAB_SIZE);
+    slab->next = freeSlabs;
+    freeSlabs = slab;
+  }
+  freeSlabsCount = SLAB_COUNT;
+}
+
+static inline bool isSlabMember(void * ptr)
+{
+  return pool && ptr >= pool && ptr < pool + SLAB_POOL_SIZE;
+}
+
+static inline Slab * getSlab(void * ptr)
+{
+  return (Slab *)(pool + ((uint8_t *)ptr - pool) / SLAB_SIZE * SLAB_SIZE);
+}
+
+static int getClass(size_t size)
+{
+  for (unsigned cls = 0; cls < SLAB_CLASSES; cls++) {
+    if (size <= slabClassSize[cls]) return cls;
+  }
+  return -1;
+}
+
+static Slab * newSlab(uint8_t arenaIdx, uint8_t cls)
+{
+  Slab * slab = freeSlabs;
+  if (!slab) return nullptr;
+
+  freeSlabs = slab->next;
+  freeSlabsCount -= 1;
+
+  slab->cls = cls;
+  slab->arena = arenaIdx;
+  slab->used = 0;
+  slab->freeList = nullptr;
+
+  // build the free list so that slots are handed out in address order
+  uint16_t size = slabClassSize[cls];
+  uint8_t * first = (uint8_t *)slab + SLAB_HEADER_SIZE;
+  uint16_t count = (SLAB_SIZE - SLAB_HEADER_SIZE) / size;
+  for (int i = count - 1; i >= 0; i--) {
+    SlabSlot * slot = (SlabSlot *)(first + i * size);
+    slot->next = slab->freeList;
+    slab->freeList = slot;
+  }
+
+  SlabArena & arena = arenas[arenaIdx];
+  slab->next = arena.partial[cls];
+  arena.partial[cls] = slab;
+  arena.slabs[cls] += 1;
+  return slab;
+}
+
+static void releaseSlab(SlabArena & arena, Slab * slab)
+{
+  Slab ** prev = &arena.partial[slab->cls];
+  while (*prev && *prev != slab) prev = &(*prev)->next;
+  if (!*prev) return;
+
+  // keep the last slab of a class, it will probably be needed soon
+  if (prev == &arena.partial[slab->cls] && !slab->next) return;
+
+  *prev = slab->next;
+  arena.slabs[slab->cls] -= 1;
+  slab->next = freeSlabs;
+  freeSlabs = slab;
+  freeSlabsCount += 1;
+}
+
+static uint32_t usedBytes(const SlabArena & arena)
+{
+  uint32_t bytes = arena.heapBytes;
+  for (unsigned cls = 0; cls < SLAB_CLASSES; cls++) {
+    bytes += arena.used[cls] * slabClassSize[cls];
+  }
+  return bytes;
+}
+
+static void * slab_malloc(uint8_t arenaIdx, size_t size)
+{
+  int cls = getClass(size);
+  if (cls < 0) return nullptr;
+
+  SlabArena & arena = arenas[arenaIdx];
+  Slab * slab = arena.partial[cls];
+  if (!slab) {
+    slab = newSlab(arenaIdx, cls);
+    if (!slab) return nullptr;
+  }
+
+  SlabSlot * slot = slab->freeList;
+  slab->freeList = slot->next;
+  slab->used += 1;
+  arena.used[cls] += 1;
+
+  if (!slab->freeList) {
+    // slab is full, it is the head of the partial list
+    arena.partial[cls] = slab->next;
+  }
+
+  return slot;
+}
+
+static void slab_free(void * ptr)
+{
+  Slab * slab = getSlab(ptr);
+  SlabArena & arena = arenas[slab->arena];
+
+  if (!slab->freeList) {
+    // slab was full, make it available again
+    slab->next = arena.partial[slab->cls];
+    arena.partial[slab->cls] = slab;
+  }
+
+  SlabSlot * slot = (SlabSlot *)ptr;
+  slot->next = slab->freeList;
+  slab->freeList = slot;
+  slab->used -= 1;
+  arena.used[slab->cls] -= 1;
+
+  if (slab->used == 0) {
+    releaseSlab(arena, slab);
+  }
+}
+
+void * custom_l_arena(uint8_t idx)
+{
+  return &arenas[idx < LUA_ARENA_COUNT ? idx : LUA_ARENA_SCRIPTS];
+}
+
+static uint8_t getArenaIndex(void * ud)
+{
+  return ud ? (uint8_t)((SlabArena *)ud - arenas) : LUA_ARENA_SCRIPTS;
+}
+
+void * custom_l_alloc(void * ud, void * ptr, size_t osize, size_t nsize)
+{
+  slab_init();
+
+  uint8_t arenaIdx = getArenaIndex(ud);
+  SlabArena & arena = arenas[arenaIdx];
+
+  if (nsize == 0) {
+    if (isSlabMember(ptr)) {
+      slab_free(ptr);
+    }
+    else if (ptr) {
+      arena.heapBytes -= osize;
+      heap_l_alloc(ud, ptr, osize, 0);
+    }
+    return nullptr;
+  }
+
+#if defined(DEBUG)
+  arena.histogram[nsize > SLAB_MAX_BLOCK ? SLAB_MAX_BLOCK / 8 : (nsize - 1) / 8] += 1;
+#endif
+
+  void * res = nullptr;
+
+  if (isSlabMember(ptr)) {
+    uint16_t slotSize = slabClassSize[getSlab(ptr)->cls];
+    if (nsize <= slotSize) {
+      // fits in current slot (shrinking must not fail)
+      return ptr;
+    }
+    res = slab_malloc(arenaIdx, nsize);
+    if (!res) {
+      res = heap_l_alloc(ud, nullptr, 0, nsize);
+      if (!res) return nullptr;
+      arena.heapBytes += nsize;
+    }
+    memcpy(res, ptr, min<size_t>(osize, slotSize));
+    slab_free(ptr);
+  }
+  else if (ptr) {
+    // already in the heap, let the heap resize it
+    res = heap_l_alloc(ud, ptr, osize, nsize);
+    if (res) arena.heapBytes += nsize - osize;
+  }
+  else {
+    res = slab_malloc(arenaIdx, nsize);
+    if (!res) {
+      res = heap_l_alloc(ud, nullptr, 0, nsize);
+      if (res) arena.heapBytes += nsize;
+    }
+  }
+
+  if (res) {
+    uint32_t used = usedBytes(arena);
+    if (used > arena.peakBytes) arena.peakBytes = used;
+  }
+
+  return res;
+}
+
+int custom_avail()
+{
+  uint32_t avail = freeSlabsCount * SLAB_SIZE;
+  for (uint8_t i = 0; i < LUA_ARENA_COUNT; i++) {
+    const SlabArena & arena = arenas[i];
+    for (unsigned cls = 0; cls < SLAB_CLASSES; cls++) {
+      uint16_t slots = (SLAB_SIZE - SLAB_HEADER_SIZE) / slabClassSize[cls];
+      avail += (arena.slabs[cls] * slots - arena.used[cls]) * slabClassSize[cls];
+    }
+  }
+#if defined(STM32F4)
+  avail += ccm_avail();
+#endif
+  return avail;
+}
+
+void custom_l_stats(void * ud, LuaMemStats & stats)
+{
+  const SlabArena & arena = arenas[getArenaIndex(ud)];
+
+  memclear(&stats, sizeof(stats));
+  for (unsigned cls = 0; cls < SLAB_CLASSES; cls++) {
+    stats.slabBytes += arena.slabs[cls] * SLAB_SIZE;
+    stats.slabUsed += arena.used[cls] * slabClassSize[cls];
+  }
+  stats.heapBytes = arena.heapBytes;
+  stats.peakBytes = arena.peakBytes;
+  stats.freeSlabs = freeSlabsCount;
+  if (stats.slabBytes > 0) {
+    stats.fragmentation = 100 - stats.slabUsed * 100 / stats.slabBytes;
+  }
+}
+
+uint8_t custom_l_classes()
+{
+  return SLAB_CLASSES;
+}
+
+void custom_l_class_stats(void * ud, uint8_t cls, uint16_t & size,
+                          uint16_t & slabs, uint16_t & used)
+{
+  const SlabArena & arena = arenas[getArenaIndex(ud)];
+  size = slabClassSize[cls];
+  slabs = arena.slabs[cls];
+  used = arena.used[cls];
+}
+
+#if defined(DEBUG)
+uint8_t custom_l_histogram(void * ud, const uint16_t ** histogram)
+{
+  *histogram = arenas[getArenaIndex(ud)].histogram;
+  return DIM(arenas[0].histogram);
+}
+#endif
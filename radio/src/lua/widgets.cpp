@@ -33,6 +33,7 @@
 #include "lua_widget_factory.h"
 
 #include "lua_states.h"
+#include "custom_allocator.h"
 
 #define MAX_INSTRUCTIONS       (20000/100)
 #define LUA_WARNING_INFO_LEN    64
@@ -106,6 +107,7 @@ void luaLoadWidgetCallback(const char* filename)
   int optionDefinitionsReference = LUA_REFNIL, createFunction = 0, updateFunction = 0,
       refreshFunction = 0, backgroundFunction = 0, translateFunction = 0;
   bool lvglLayout = false;
+  uint16_t refreshPeriod = 0;
 
   luaL_checktype(lsWidgets, -1, LUA_TTABLE);
 
@@ -141,6 +143,12 @@ void luaLoadWidgetCallback(const char* filename)
     else if (!strcasecmp(key, "useLvgl")) {
       lvglLayout = lua_toboolean(lsWidgets, -1);
     }
+    else if (!strcmp(key, "refreshRate")) {
+      // maximum number of refresh() calls per second
+      lua_Number rate = luaL_checknumber(lsWidgets, -1);
+      if (rate > 0)
+        refreshPeriod = limit<lua_Number>(1, 1000 / rate, 60000);
+    }
   }
 
   if (name && createFunction) {
@@ -148,7 +156,7 @@ void luaLoadWidgetCallback(const char* filename)
     if (options) {
       new LuaWidgetFactory(strdup(name), options, optionDefinitionsReference,
               createFunction, updateFunction, refreshFunction, backgroundFunction,
-              translateFunction, lvglLayout, filename);
+              translateFunction, lvglLayout, refreshPeriod, filename);
       TRACE("Loaded Lua widget %s", name);
     }
   }
@@ -226,7 +234,7 @@ void luaInitThemesAndWidgets()
   TRACE("luaInitThemesAndWidgets");
 
 #if defined(USE_CUSTOM_ALLOCATOR)
-  lsWidgets = lua_newstate(custom_l_alloc, NULL);   //we use our own allocator!
+  lsWidgets = lua_newstate(custom_l_alloc, custom_l_arena(LUA_ARENA_WIDGETS));   //we use our own allocator!
 #elif defined(LUA_ALLOCATOR_TRACER)
   memclear(&lsWidgetsTrace, sizeof(lsWidgetsTrace));
   lsWidgetsTrace.script = "lua_newstate(widgets)";
@@ -42,6 +42,11 @@
 
 #if defined(LUA)
 #include "lua/lua_event.h"
+#include "lua/lua_gc.h"
+#endif
+
+#if defined(LUA_COMPILER)
+#include "lua/lua_cache.h"
 #endif
 
 #if defined(AUDIO)
@@ -327,7 +332,7 @@ void guiMain(event_t evt)
     maxLuaInterval = interval;
   }
 
-  luaDoGc(lsWidgets, true);
+  luaGcStep(lsWidgets);
 
   DEBUG_TIMER_START(debugTimerLua);
   luaTask(false);
@@ -471,10 +476,15 @@ void perMain()
 {
   DEBUG_TIMER_START(debugTimerPerMain1);
 
+#if defined(LUA)
+  luaGcFrameStart();
+#endif
+
   checkSpeakerVolume();
 
   if (!usbPlugged() || (getSelectedUsbMode() == USB_UNSELECTED_MODE)) {
     checkStorageUpdate();
+    modelPreloadRun();
     initLoggingTimer();  // initialize software timer for logging
   }
 
@@ -589,4 +599,8 @@ void perMain()
 #if defined(INTERNAL_GPS)
   gpsWakeup();
 #endif
+
+#if defined(LUA_COMPILER)
+  luaCacheWakeup();
+#endif
 }
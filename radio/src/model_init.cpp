@@ -101,19 +101,19 @@ void setVendorSpecificModelDefaults(uint8_t id)
 }
 
 #if defined(FUNCTION_SWITCHES)
-void initCustomSwitches()
+void initCustomSwitches(ModelData* model)
 {
   for (int i = 0; i < switchGetMaxSwitches(); i += 1) {
     if (switchIsCustomSwitch(i)) {
       uint8_t idx = switchGetCustomSwitchIdx(i);
-      g_model.customSwitches[idx].type = SWITCH_GLOBAL;
-      g_model.customSwitches[idx].group = 0;
-      g_model.customSwitches[idx].start = FS_START_PREVIOUS;
-      g_model.customSwitches[idx].state = 0;
-      g_model.customSwitches[idx].name[0] = 0;
+      model->customSwitches[idx].type = SWITCH_GLOBAL;
+      model->customSwitches[idx].group = 0;
+      model->customSwitches[idx].start = FS_START_PREVIOUS;
+      model->customSwitches[idx].state = 0;
+      model->customSwitches[idx].name[0] = 0;
 #if defined(FUNCTION_SWITCHES_RGB_LEDS)
-      g_model.customSwitches[idx].offColor.setColor(0);
-      g_model.customSwitches[idx].onColor.setColor(0xFFFFFF);
+      model->customSwitches[idx].offColor.setColor(0);
+      model->customSwitches[idx].onColor.setColor(0xFFFFFF);
 #endif
     }
   }
@@ -130,7 +130,7 @@ void applyDefaultTemplate()
   setDefaultModelRegistrationID();
 
 #if defined(FUNCTION_SWITCHES)
-  initCustomSwitches();
+  initCustomSwitches(&g_model);
 #endif
 
 #if defined(COLORLCD)
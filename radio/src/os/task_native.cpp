@@ -38,6 +38,11 @@ static bool _stop_tasks = false;
 
 void task_sleep_ms(uint32_t ms)
 {
+  if (time_is_virtual()) {
+    time_virtual_sleep_until(time_point_now() + std::chrono::milliseconds(ms));
+    return;
+  }
+
   std::unique_lock<std::mutex> lk(_stop_m);
   _stop_cv.wait_for(lk, std::chrono::milliseconds(ms));
 }
@@ -46,6 +51,11 @@ void task_sleep_until(time_point_t* tp, uint32_t inc)
 {
   *tp += std::chrono::duration<uint32_t, std::milli>{inc};
 
+  if (time_is_virtual()) {
+    time_virtual_sleep_until(*tp);
+    return;
+  }
+
   std::unique_lock<std::mutex> lk(_stop_m);
   _stop_cv.wait_until(lk, *tp);
 }
@@ -74,6 +84,7 @@ void task_shutdown_all()
 {
   stop_tasks();
   _stop_cv.notify_all();
+  time_virtual_interrupt(true);
 
   task_handle_t* task = nullptr;
   while (next_task_to_stop(task)) {
@@ -82,6 +93,7 @@ void task_shutdown_all()
   }
 
   timer_queue::destroy();
+  time_virtual_interrupt(false);
   _stop_tasks = false;
 }
 
@@ -96,7 +108,9 @@ static void* _task_stub(run_context* p)
   auto name = ctx->name.c_str();
 
   TRACE("<%s> started", name);
+  time_virtual_enter();
   ctx->func();
+  time_virtual_leave();
   TRACE("<%s> stopped", name);
 
   return nullptr;
@@ -110,6 +124,7 @@ void task_create(task_handle_t* h, task_func_t func, const char* name,
 
   h->_stack_size = stack_size;
   run_context* ctx = new run_context{func, name};
+  if (time_is_virtual()) time_virtual_attach();
   h->_thread_handle = std::make_unique<std::thread>([=]() { _task_stub(ctx); });
   if (h->_thread_handle) _tasks.emplace_back(h);
 }
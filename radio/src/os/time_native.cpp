@@ -21,10 +21,39 @@
 
 #include "time.h"
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <list>
+#include <mutex>
 
 extern uint64_t simuTimerMicros(void);
 
+// Real time the clock driver waits for the tasks to go back to sleep.
+// Only a task blocked on something else than the clock can take that
+// long: the clock then advances anyway, and the stall is counted, as
+// the run is not deterministic anymore.
+#define VIRTUAL_STALL_TIMEOUT std::chrono::seconds(10)
+
+struct virtual_sleeper_t {
+  uint64_t wake_us;
+  bool participant;
+  bool woken;
+};
+
+static std::atomic<bool> _virtual{false};
+static std::atomic<uint64_t> _virtual_us{0};
+
+static std::mutex _vclock_m;
+static std::condition_variable _sleepers_cv;
+static std::condition_variable _idle_cv;
+static std::list<virtual_sleeper_t*> _sleepers;
+static unsigned _running = 0;  // attached threads not sleeping on the clock
+static bool _interrupted = false;
+static unsigned _stalls = 0;
+
+static thread_local bool _participant = false;
+
 uint32_t time_get_ms()
 {
   return simuTimerMicros() / 1000;
@@ -32,5 +61,101 @@ uint32_t time_get_ms()
 
 time_point_t time_point_now()
 {
+  if (_virtual) {
+    return time_point_t{std::chrono::microseconds(_virtual_us)};
+  }
   return std::chrono::steady_clock::now();
 }
+
+void time_virtual_enable() { _virtual = true; }
+
+bool time_is_virtual() { return _virtual; }
+
+uint64_t time_virtual_us() { return _virtual_us; }
+
+static bool is_idle() { return _running == 0 || _interrupted; }
+
+static void wait_idle(std::unique_lock<std::mutex>& lk)
+{
+  if (!_idle_cv.wait_for(lk, VIRTUAL_STALL_TIMEOUT, is_idle)) {
+    _stalls++;
+  }
+}
+
+unsigned time_virtual_stalls()
+{
+  std::lock_guard lk(_vclock_m);
+  return _stalls;
+}
+
+void time_virtual_advance(uint32_t ms)
+{
+  std::unique_lock lk(_vclock_m);
+  wait_idle(lk);
+
+  while (ms-- > 0) {
+    _virtual_us += 1000;
+
+    for (auto s : _sleepers) {
+      if (!s->woken && s->wake_us <= _virtual_us) {
+        s->woken = true;
+        if (s->participant) _running++;
+      }
+    }
+    _sleepers_cv.notify_all();
+
+    wait_idle(lk);
+  }
+}
+
+void time_virtual_attach()
+{
+  std::lock_guard lk(_vclock_m);
+  _running++;
+}
+
+void time_virtual_enter() { _participant = true; }
+
+void time_virtual_leave()
+{
+  if (!_participant) return;
+  _participant = false;
+  {
+    std::lock_guard lk(_vclock_m);
+    _running--;
+  }
+  _idle_cv.notify_all();
+}
+
+void time_virtual_sleep_until(const time_point_t& tp)
+{
+  using namespace std::chrono;
+  uint64_t wake_us = duration_cast<microseconds>(tp.time_since_epoch()).count();
+
+  std::unique_lock lk(_vclock_m);
+  if (_interrupted || wake_us <= _virtual_us) return;
+
+  virtual_sleeper_t sleeper{wake_us, _participant, false};
+  _sleepers.push_back(&sleeper);
+
+  if (sleeper.participant) {
+    _running--;
+    _idle_cv.notify_all();
+  }
+
+  _sleepers_cv.wait(lk, [&]() { return sleeper.woken || _interrupted; });
+  _sleepers.remove(&sleeper);
+
+  // woken up by the clock driver: already accounted as running
+  if (sleeper.participant && !sleeper.woken) _running++;
+}
+
+void time_virtual_interrupt(bool interrupt)
+{
+  {
+    std::lock_guard lk(_vclock_m);
+    _interrupted = interrupt;
+  }
+  _sleepers_cv.notify_all();
+  _idle_cv.notify_all();
+}
@@ -25,3 +25,31 @@
 
 typedef std::chrono::time_point<std::chrono::steady_clock> time_point_t;
 
+// Virtual clock (headless simulator)
+//
+// Once enabled, time only moves forward when time_virtual_advance() is
+// called, and native tasks / timers sleep on the virtual clock. Each
+// millisecond step returns once every task is sleeping again, so that a
+// run is deterministic and goes as fast as the CPU allows.
+//
+// A task blocked on something else than the clock (e.g. a mutex held by
+// a sleeping task) would stall the run: after 10s of real time, the
+// clock advances anyway and time_virtual_stalls() is incremented. A run
+// is only deterministic if it reports no stall.
+//
+// Must be enabled before any task or timer is created.
+void time_virtual_enable();
+bool time_is_virtual();
+uint64_t time_virtual_us();
+unsigned time_virtual_stalls();
+
+// Advances the virtual clock by 'ms' milliseconds, one step at a time
+void time_virtual_advance(uint32_t ms);
+
+// Native tasks / timer thread bookkeeping
+void time_virtual_attach();
+void time_virtual_enter();
+void time_virtual_leave();
+void time_virtual_sleep_until(const time_point_t& tp);
+void time_virtual_interrupt(bool interrupt);
+
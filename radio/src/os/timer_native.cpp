@@ -18,7 +18,7 @@ timer_queue::timer_queue() {
 }
 
 void timer_queue::update_current_time() {
-  _current_time = std::chrono::steady_clock::now();
+  _current_time = time_point_now();
 }
 
 void timer_queue::sort_timers() {
@@ -49,6 +49,7 @@ void timer_queue::start()
   std::lock_guard<std::mutex> lock(_cmds_mutex);
   if (!_running) {
     _running = true;
+    if (time_is_virtual()) time_virtual_attach();
     _thread = std::make_unique<std::thread>([&]() { main_loop(); });
   }
 }
@@ -100,6 +101,7 @@ void timer_queue::pend_function(timer_async_func_t func, void *param1,
 void timer_queue::main_loop() {
 
   TRACE("<timer_queue> started");
+  time_virtual_enter();
   while (true) {
     {
       std::unique_lock lock(_cmds_mutex);
@@ -115,13 +117,21 @@ void timer_queue::main_loop() {
         until = _current_time + std::chrono::milliseconds(1000);
       }
 
-      std::cv_status result = _cmds_condition.wait_until(lock, until);
+      if (time_is_virtual()) {
+        // pending commands are picked up on the next virtual millisecond
+        lock.unlock();
+        time_virtual_sleep_until(std::min(until, _current_time + 1ms));
+        lock.lock();
+      } else {
+        _cmds_condition.wait_until(lock, until);
+      }
       if (!_running) break;
     }
 
     async_calls();
     trigger_timers();
   }
+  time_virtual_leave();
 }
 
 void timer_queue::process_cmds()
@@ -22,12 +22,18 @@
 #include "edgetx.h"
 #include "io/frsky_firmware_update.h"
 #include "os/sleep.h"
+#include "os/time.h"
 #include "tasks/mixer_task.h"
 #include "lib_file.h"
 
 #include "pxx2_ota.h"
 #include "pxx2_transport.h"
 
+OtaTransferStats otaTransferStats;
+
+static uint8_t otaPrefetch[OTA_PREFETCH_SIZE];
+static uint8_t otaFrames[2][OTA_FRAME_MAX_SIZE];
+
 bool Pxx2OtaUpdate::waitStep(uint8_t step, uint8_t timeout)
 {
   OtaUpdateInformation * destination = moduleState[module].otaUpdateInformation;
@@ -46,6 +52,31 @@ bool Pxx2OtaUpdate::waitStep(uint8_t step, uint8_t timeout)
   return true;
 }
 
+uint32_t Pxx2OtaUpdate::prepareFrame(uint8_t * frame, const char * rxName,
+                                     uint32_t address, const uint8_t * buffer)
+{
+  Pxx2Pulses pxx2(frame);
+  pxx2.sendOtaUpdate(module, rxName, address, (const char *) buffer);
+  return pxx2.getSize();
+}
+
+void Pxx2OtaUpdate::sendFrame(const uint8_t * frame, uint32_t size)
+{
+  // the module buffer is the one the serial driver can send from
+  uint8_t* module_buffer = pulsesGetModuleBuffer(module);
+  memcpy(module_buffer, frame, size);
+
+  // send the frame immediately
+  auto mod = pulsesGetModuleDriver(module);
+  auto mod_st = (etx_module_state_t*)mod->ctx;
+
+  auto drv = modulePortGetSerialDrv(mod_st->tx);
+  auto ctx = modulePortGetCtx(mod_st->tx);
+  drv->sendBuffer(ctx, module_buffer, size);
+
+  otaTransferStats.frames++;
+}
+
 const char* Pxx2OtaUpdate::nextStep(uint8_t step, const char* rxName,
                                     uint32_t address, const uint8_t* buffer)
 {
@@ -54,25 +85,107 @@ const char* Pxx2OtaUpdate::nextStep(uint8_t step, const char* rxName,
   destination->step = step;
   destination->address = address;
 
-  for (uint8_t retry = 0;; retry++) {
-    uint8_t* module_buffer = pulsesGetModuleBuffer(module);
-    Pxx2Pulses pxx2(module_buffer);
-    pxx2.sendOtaUpdate(module, rxName, address, (const char *) buffer);
-
-    // send the frame immediately
-    auto mod = pulsesGetModuleDriver(module);
-    auto mod_st = (etx_module_state_t*)mod->ctx;
+  uint8_t * frame = otaFrames[0];
+  uint32_t size = prepareFrame(frame, rxName, address, buffer);
 
-    auto drv = modulePortGetSerialDrv(mod_st->tx);
-    auto ctx = modulePortGetCtx(mod_st->tx);
-    drv->sendBuffer(ctx, module_buffer, pxx2.getSize());
+  for (uint8_t retry = 0;; retry++) {
+    sendFrame(frame, size);
 
     if (waitStep(step + 1, 20)) {
       return nullptr;
     }
-    else if (retry == 100) {
+    else if (retry == OTA_CHUNK_RETRIES) {
       return "Transfer failed";
     }
+    otaTransferStats.retries++;
+  }
+}
+
+// Copies the chunk at 'offset' of the firmware, padded with 0xFF.
+// Returns its size (< OTA_CHUNK_SIZE at the end of the file), -1 on error
+int Pxx2OtaUpdate::readChunk(FIL * file, uint32_t offset, uint8_t * chunk)
+{
+  bool eof = prefetchCount < OTA_PREFETCH_SIZE;
+  if (!prefetchValid || offset < prefetchOffset ||
+      (!eof && offset + OTA_CHUNK_SIZE > prefetchOffset + prefetchCount)) {
+    UINT count;
+    prefetchValid = false;
+    if (f_lseek(file, dataStart + offset) != FR_OK ||
+        f_read(file, otaPrefetch, OTA_PREFETCH_SIZE, &count) != FR_OK) {
+      return -1;
+    }
+    prefetchOffset = offset;
+    prefetchCount = count;
+    prefetchValid = true;
+  }
+
+  uint32_t end = prefetchOffset + prefetchCount;
+  uint32_t size = offset < end ? min<uint32_t>(OTA_CHUNK_SIZE, end - offset) : 0;
+  memcpy(chunk, &otaPrefetch[offset - prefetchOffset], size);
+  memset(chunk + size, 0xFF, OTA_CHUNK_SIZE - size);
+  return size;
+}
+
+// Sends the firmware from 'done' on. 'done' is the offset of the last chunk
+// acknowledged (the EOF address) on success, the first chunk not
+// acknowledged on failure
+const char * Pxx2OtaUpdate::transfer(FIL * file, ProgressHandler progressHandler,
+                                     const char * filename, uint32_t & done)
+{
+  OtaUpdateInformation * destination = moduleState[module].otaUpdateInformation;
+  uint8_t chunk[OTA_CHUNK_SIZE];
+
+  int count = readChunk(file, done, chunk);
+  if (count < 0) {
+    return "Read file failed";
+  }
+
+  uint8_t current = 0;
+  uint32_t sizes[2];
+  sizes[current] = prepareFrame(otaFrames[current], nullptr, done, chunk);
+
+  while (1) {
+    if (done % OTA_PREFETCH_SIZE == 0) {
+      progressHandler(getBasename(filename), STR_OTA_UPDATE, done,
+                      otaTransferStats.size);
+    }
+
+    destination->step = OTA_UPDATE_TRANSFER;
+    destination->address = done;
+    sendFrame(otaFrames[current], sizes[current]);
+
+    // prepare the next frame while the receiver writes this chunk
+    bool last = count < OTA_CHUNK_SIZE;
+    int nextCount = 0;
+    uint8_t next = current ^ 1;
+    if (!last) {
+      nextCount = readChunk(file, done + OTA_CHUNK_SIZE, chunk);
+      if (nextCount >= 0) {
+        sizes[next] = prepareFrame(otaFrames[next], nullptr,
+                                   done + OTA_CHUNK_SIZE, chunk);
+      }
+    }
+
+    for (uint8_t retry = 0; !waitStep(OTA_UPDATE_TRANSFER_ACK, 20); retry++) {
+      if (retry == OTA_CHUNK_RETRIES) {
+        return "Transfer failed";
+      }
+      otaTransferStats.retries++;
+      sendFrame(otaFrames[current], sizes[current]);
+    }
+
+    otaTransferStats.acked = done + count;
+    if (last) {
+      return nullptr;
+    }
+    if (nextCount < 0) {
+      done += OTA_CHUNK_SIZE;
+      return "Read file failed";
+    }
+
+    done += OTA_CHUNK_SIZE;
+    count = nextCount;
+    current = next;
   }
 }
 
@@ -80,10 +193,14 @@ const char* Pxx2OtaUpdate::doFlashFirmware(const char* filename,
                                            ProgressHandler progressHandler)
 {
   FIL file;
-  uint8_t buffer[32];
+  uint8_t buffer[sizeof(FrSkyFirmwareInformation)];
   UINT count;
   const char * result;
 
+  memclear(&otaTransferStats, sizeof(otaTransferStats));
+  otaTransferStats.startTime = time_get_ms();
+  otaTransferStats.running = true;
+
   result = nextStep(OTA_UPDATE_START, rxName, 0, nullptr);
   if (result) {
     return result;
@@ -94,6 +211,8 @@ const char* Pxx2OtaUpdate::doFlashFirmware(const char* filename,
   }
 
   uint32_t size;
+  dataStart = 0;
+  prefetchValid = false;
   const char * ext = getFileExtension(filename);
   if (ext && !strcasecmp(ext, FRSKY_FIRMWARE_EXT)) {
     FrSkyFirmwareInformation * information = (FrSkyFirmwareInformation *) buffer;
@@ -103,30 +222,30 @@ const char* Pxx2OtaUpdate::doFlashFirmware(const char* filename,
       return "Format error";
     }
     size = information->size;
+    dataStart = sizeof(FrSkyFirmwareInformation);
   }
   else {
     size = f_size(&file);
   }
+  otaTransferStats.size = size;
 
+  // on failure, give the link some time and resume from the first chunk
+  // not acknowledged
   uint32_t done = 0;
   while (1) {
-    progressHandler(getBasename(filename), STR_OTA_UPDATE, done, size);
-    if (f_read(&file, buffer, sizeof(buffer), &count) != FR_OK) {
-      f_close(&file);
-      return "Read file failed";
-    }
-
-    result = nextStep(OTA_UPDATE_TRANSFER, nullptr, done, buffer);
-    if (result) {
-      return result;
-    }
-
-    if (count < sizeof(buffer)) {
-      f_close(&file);
+    result = transfer(&file, progressHandler, filename, done);
+    if (!result || otaTransferStats.resumes == OTA_RESUME_ATTEMPTS) {
       break;
     }
+    otaTransferStats.resumes++;
+    prefetchValid = false;
+    watchdogSuspend(100 /*1s*/);
+    sleep_ms(OTA_RESUME_DELAY);
+  }
 
-    done += count;
+  f_close(&file);
+  if (result) {
+    return result;
   }
 
   return nextStep(OTA_UPDATE_EOF, nullptr, done, nullptr);
@@ -143,6 +262,9 @@ void Pxx2OtaUpdate::flashFirmware(const char * filename, ProgressHandler progres
   const char * result = doFlashFirmware(filename, progressHandler);
   moduleState[module].mode = MODULE_MODE_NORMAL;
 
+  otaTransferStats.elapsed = time_get_ms() - otaTransferStats.startTime;
+  otaTransferStats.running = false;
+
   AUDIO_PLAY(AU_SPECIAL_SOUND_BEEP1 );
   BACKLIGHT_ENABLE();
 
@@ -23,7 +23,7 @@
 
 #include "pxx2.h"
 #include "popups.h"
-#include "ffconf.h"
+#include "ff.h"
 
 class OtaUpdateInformation: public BindInformation {
   public:
@@ -32,6 +32,29 @@ class OtaUpdateInformation: public BindInformation {
     uint32_t module;
 };
 
+// The receiver acknowledges each OTA_CHUNK_SIZE bytes frame. The firmware
+// is read ahead from the SD card and the next frame is prepared while the
+// receiver writes the current one.
+#define OTA_CHUNK_SIZE          32
+#define OTA_PREFETCH_SIZE       512
+#define OTA_FRAME_MAX_SIZE      64
+#define OTA_CHUNK_RETRIES       100   // frames sent before a chunk fails
+#define OTA_RESUME_ATTEMPTS     3     // restarts from the last acknowledged chunk
+#define OTA_RESUME_DELAY        500   // ms
+
+struct OtaTransferStats {
+  uint32_t size;        // firmware size
+  uint32_t acked;       // bytes acknowledged by the receiver
+  uint32_t frames;      // frames sent, retries included
+  uint32_t retries;
+  uint32_t startTime;   // ms
+  uint32_t elapsed;     // ms
+  uint8_t resumes;
+  bool running;
+};
+
+extern OtaTransferStats otaTransferStats;
+
 class Pxx2OtaUpdate {
   public:
     Pxx2OtaUpdate(uint8_t module, const char * rxName):
@@ -46,9 +69,18 @@ class Pxx2OtaUpdate {
     uint8_t module;
     const char * rxName;
 
+    // read ahead buffer, OTA_PREFETCH_SIZE bytes from prefetchOffset
+    uint32_t dataStart = 0;
+    uint32_t prefetchOffset = 0;
+    uint32_t prefetchCount = 0;
+    bool prefetchValid = false;
+
     const char * doFlashFirmware(const char * filename, ProgressHandler progressHandler);
+    const char * transfer(FIL * file, ProgressHandler progressHandler, const char * filename, uint32_t & done);
+    int readChunk(FIL * file, uint32_t offset, uint8_t * chunk);
+    uint32_t prepareFrame(uint8_t * frame, const char * rxName, uint32_t address, const uint8_t * buffer);
+    void sendFrame(const uint8_t * frame, uint32_t size);
     bool waitStep(uint8_t step, uint8_t timeout);
     const char* nextStep(uint8_t step, const char* rxName, uint32_t address,
                          const uint8_t* buffer);
 };
-
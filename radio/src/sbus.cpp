@@ -31,6 +31,10 @@
 #define SBUS_FRAMELOST_BIT 2
 #define SBUS_FAILSAFE_BIT 3
 
+// SBUS2 receivers end frames with 0x04, 0x14, 0x24 or 0x34
+#define SBUS_IS_END_BYTE(b) \
+  ((b) == SBUS_END_BYTE || ((b) & 0xCF) == 0x04)
+
 #define SBUS_CH_BITS 11
 #define SBUS_CH_MASK ((1 << SBUS_CH_BITS) - 1)
 
@@ -40,12 +44,27 @@ static const etx_serial_driver_t* _sbus_drv = nullptr;
 static void* _sbus_ctx = nullptr;
 static bool _sbus_aux_enabled = false;
 
-static void sbusProcessFrame(int16_t* pulses, uint8_t* sbus, uint32_t size);
+// Streaming decoder: received bytes go through a ring holding the last
+// SBUS_FRAME_SIZE bytes, and a frame is decoded as soon as the ring starts
+// with a start byte and ends with an end byte. Frames split over several
+// idle interrupts or merged into one are not lost, and garbage between
+// frames only costs the frames it overlaps.
+struct SbusDecoder {
+  uint8_t ring[SBUS_FRAME_SIZE];
+  uint8_t pos;      // next write, i.e. oldest byte when full
+  uint8_t count;
+  bool synced;
+};
+
+static SbusDecoder _sbus_decoder;
+
+static void sbusProcessFrame(const uint8_t* sbus, uint32_t timestamp);
 
 void sbusSetReceiveCtx(void* ctx, const etx_serial_driver_t* drv)
 {
   _sbus_ctx = ctx;
   _sbus_drv = drv;
+  sbusResetDecoder();
 }
 
 void sbusAuxFrameReceived(void*)
@@ -58,36 +77,64 @@ void sbusAuxSetEnabled(bool enabled) { _sbus_aux_enabled = enabled; }
 
 void sbusFrameReceived(void*)
 {
-  if (!_sbus_drv || !_sbus_ctx || !_sbus_drv->copyRxBuffer ||
-      !_sbus_drv->getBufferedBytes)
-    return;
-
-  if (_sbus_drv->getBufferedBytes(_sbus_ctx) != SBUS_FRAME_SIZE) {
-    _sbus_drv->clearRxBuffer(_sbus_ctx);
-    return;
+  if (!_sbus_drv || !_sbus_ctx || !_sbus_drv->copyRxBuffer) return;
+
+  uint32_t now = timersGetMsTick();
+  uint8_t buffer[SBUS_FRAME_SIZE];
+  int received;
+  while ((received = _sbus_drv->copyRxBuffer(_sbus_ctx, buffer,
+                                             sizeof(buffer))) > 0) {
+    sbusProcessBytes(buffer, received, now);
   }
+}
+
+void sbusResetDecoder()
+{
+  memclear(&_sbus_decoder, sizeof(_sbus_decoder));
+}
 
-  uint8_t frame[SBUS_FRAME_SIZE];
-  int received = _sbus_drv->copyRxBuffer(_sbus_ctx, frame, SBUS_FRAME_SIZE);
-  if (received < 0) return;
+void sbusProcessBytes(const uint8_t* data, uint32_t len, uint32_t timestamp)
+{
+  auto& dec = _sbus_decoder;
+
+  while (len--) {
+    uint8_t byte = *data++;
+    dec.ring[dec.pos] = byte;
+    dec.pos = dec.pos + 1 < SBUS_FRAME_SIZE ? dec.pos + 1 : 0;
+    if (dec.count < SBUS_FRAME_SIZE) {
+      dec.count++;
+      if (dec.count < SBUS_FRAME_SIZE) continue;
+    }
 
-  sbusProcessFrame(trainerInput, frame, received);
+    if (dec.ring[dec.pos] == SBUS_START_BYTE && SBUS_IS_END_BYTE(byte)) {
+      uint8_t frame[SBUS_FRAME_SIZE];
+      uint8_t head = SBUS_FRAME_SIZE - dec.pos;
+      memcpy(frame, &dec.ring[dec.pos], head);
+      memcpy(&frame[head], dec.ring, dec.pos);
+      dec.count = 0;
+      dec.synced = true;
+      sbusProcessFrame(frame, timestamp);
+    }
+    else if (dec.synced) {
+      // sliding: the frame in progress is lost
+      dec.synced = false;
+      trainerFrameLost(TRAINER_SOURCE_SBUS);
+    }
+  }
 }
 
 // Range for pulses (ppm input) is [-512:+512]
-static void sbusProcessFrame(int16_t* pulses, uint8_t* sbus, uint32_t size)
+static void sbusProcessFrame(const uint8_t* sbus, uint32_t timestamp)
 {
-  if (size != SBUS_FRAME_SIZE || sbus[0] != SBUS_START_BYTE ||
-      sbus[SBUS_FRAME_SIZE - 1] != SBUS_END_BYTE) {
-    return;  // not a valid SBUS frame
-  }
   if ((sbus[SBUS_FLAGS_IDX] & (1 << SBUS_FAILSAFE_BIT)) ||
       (sbus[SBUS_FLAGS_IDX] & (1 << SBUS_FRAMELOST_BIT))) {
+    trainerFrameLost(TRAINER_SOURCE_SBUS);
     return;  // SBUS invalid frame or failsafe mode
   }
 
   sbus++;  // skip start byte
 
+  int16_t pulses[MAX_TRAINER_CHANNELS];
   uint32_t inputbitsavailable = 0;
   uint32_t inputbits = 0;
   for (uint32_t i = 0; i < MAX_TRAINER_CHANNELS; i++) {
@@ -95,10 +142,11 @@ static void sbusProcessFrame(int16_t* pulses, uint8_t* sbus, uint32_t size)
       inputbits |= *sbus++ << inputbitsavailable;
       inputbitsavailable += 8;
     }
-    *pulses++ = ((int32_t)(inputbits & SBUS_CH_MASK) - SBUS_CH_CENTER) * 5 / 8;
+    pulses[i] = ((int32_t)(inputbits & SBUS_CH_MASK) - SBUS_CH_CENTER) * 5 / 8;
     inputbitsavailable -= SBUS_CH_BITS;
     inputbits >>= SBUS_CH_BITS;
   }
 
-  trainerResetTimer();
+  trainerPushChannels(TRAINER_SOURCE_SBUS, 0, pulses, MAX_TRAINER_CHANNELS,
+                      timestamp);
 }
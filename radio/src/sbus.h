@@ -35,3 +35,7 @@ void sbusAuxFrameReceived(void* param);
 void sbusAuxSetEnabled(bool enabled);
 
 void sbusFrameReceived(void* param);
+
+// Streaming decoder, fed with the received bytes ('timestamp' in ms)
+void sbusProcessBytes(const uint8_t* data, uint32_t len, uint32_t timestamp);
+void sbusResetDecoder();
@@ -28,6 +28,10 @@
 #include "edgetx.h"
 #include "lib_file.h"
 
+#if defined(LUA_COMPILER)
+#include "lua/lua_cache.h"
+#endif
+
 #if FF_MAX_SS != FF_MIN_SS
 #error "Variable sector size is not supported"
 #endif
@@ -518,6 +522,11 @@ void sdMount()
     _g_FATFS_init = true;
     sdGetFreeSectors();
 
+#if defined(LUA_COMPILER)
+    // SD content may have changed while unmounted
+    luaCacheInvalidate();
+#endif
+
 #if defined(LOG_TELEMETRY)
     f_open(&g_telemetryFile, LOGS_PATH "/telemetry.log", FA_OPEN_ALWAYS | FA_WRITE);
     if (f_size(&g_telemetryFile) > 0) {
@@ -95,6 +95,7 @@ const char YAMLFILE_CHECKSUM_TAG_NAME[] = "checksum";
 #define MULTI_FIRMWARE_EXT  ".bin"
 #define ELRS_FIRMWARE_EXT   ".elrs"
 #define YAML_EXT            ".yml"
+#define YAMLFILE_TMP_EXT    ".tmp"
 
 #if defined(COLORLCD)
 #define BITMAPS_EXT         BMP_EXT JPG_EXT PNG_EXT
@@ -38,6 +38,7 @@
 #if !defined(BOOT)
   #include "edgetx.h"
   #include "lua/lua_api.h"
+  #include "serial_stream.h"
 #else
   #include "dataconstants.h"
 #endif
@@ -240,6 +241,11 @@ static void serialSetCallBacks(int mode, void* ctx, const etx_serial_port_t* por
   case UART_MODE_CLI:
     cliSetSerialDriver(ctx, drv);
     break;
+#elif defined(CLI)
+  // no text CLI in the simulator: the port only carries the binary stream
+  case UART_MODE_CLI:
+    serialStreamStart(ctx, drv);
+    break;
 #endif
 
 #if defined(INTERNAL_GPS)
@@ -0,0 +1,351 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "serial_stream.h"
+#include "edgetx.h"
+#include "crc.h"
+#include "fifo.h"
+#include "timers_driver.h"
+
+#if defined(SIMU)
+  #include "os/time.h"
+  #include "os/timer.h"
+#endif
+
+#define STREAM_RX_FIFO_SIZE   128
+#define STREAM_CMD_MAX_LEN    8
+
+// telemetry entries: index (u8) + value (i32)
+#define STREAM_SENSOR_SIZE    5
+
+enum StreamRxState {
+  STREAM_RX_SYNC,
+  STREAM_RX_LENGTH,
+  STREAM_RX_TYPE,
+  STREAM_RX_PAYLOAD,
+  STREAM_RX_CRC_LO,
+  STREAM_RX_CRC_HI,
+};
+
+struct StreamSubscription {
+  uint16_t period;
+  uint32_t next;
+};
+
+static const etx_serial_driver_t* streamDrv = nullptr;
+static void* streamCtx = nullptr;
+
+static Fifo<uint8_t, STREAM_RX_FIFO_SIZE> streamRxFifo;
+
+#if defined(SIMU)
+// no CLI task in the simulator: the port is served from a timer
+#define STREAM_TIMER_PERIOD   1 // ms
+static timer_handle_t streamTimer = TIMER_INITIALIZER;
+#endif
+
+static StreamSubscription streamSubscriptions[STREAM_COUNT];
+static uint16_t streamSequence;
+static uint16_t streamRejected;
+static uint32_t streamNow;
+
+static struct {
+  uint8_t state;
+  uint8_t length;
+  uint8_t type;
+  uint8_t pos;
+  uint16_t crc;
+  uint8_t payload[STREAM_CMD_MAX_LEN];
+} streamRx;
+
+static struct {
+  uint8_t data[STREAM_MAX_PAYLOAD + STREAM_FRAME_OVERHEAD];
+  uint16_t len;
+} streamTx;
+
+static void frameBegin(uint8_t type)
+{
+  streamTx.data[0] = STREAM_SYNC;
+  streamTx.data[2] = type;
+  streamTx.len = 3;
+}
+
+static uint8_t frameSpace()
+{
+  return STREAM_MAX_PAYLOAD + 3 - streamTx.len;
+}
+
+static void framePut8(uint8_t value)
+{
+  streamTx.data[streamTx.len++] = value;
+}
+
+static void framePut16(uint16_t value)
+{
+  framePut8(value);
+  framePut8(value >> 8);
+}
+
+static void framePut32(uint32_t value)
+{
+  framePut16(value);
+  framePut16(value >> 16);
+}
+
+static void frameSend()
+{
+  auto drv = streamDrv;
+  auto ctx = streamCtx;
+  if (!drv) return;
+
+  streamTx.data[1] = streamTx.len - 3;
+  uint16_t crc = crc16(CRC_1021, &streamTx.data[1], streamTx.len - 1);
+  framePut16(crc);
+
+  // a frame must go out in one piece to keep the stream in sync:
+  // the buffer drivers copy it as a whole or drop it
+  if (drv->sendBuffer) {
+    drv->sendBuffer(ctx, streamTx.data, streamTx.len);
+  } else if (drv->sendByte) {
+    for (uint16_t i = 0; i < streamTx.len; i++) {
+      drv->sendByte(ctx, streamTx.data[i]);
+    }
+  }
+}
+
+static void recordBegin(uint8_t stream)
+{
+  frameBegin(STREAM_RECORD | stream);
+  framePut16(streamSequence++);
+  framePut32(timersGetUsTick());
+}
+
+static void sendTelemetryRecords()
+{
+  recordBegin(STREAM_TELEMETRY);
+  for (uint8_t i = 0; i < MAX_TELEMETRY_SENSORS; i++) {
+    if (!telemetryItems[i].isAvailable()) continue;
+    if (frameSpace() < STREAM_SENSOR_SIZE) {
+      frameSend();
+      recordBegin(STREAM_TELEMETRY);
+    }
+    framePut8(i);
+    framePut32(telemetryItems[i].value);
+  }
+  frameSend();
+}
+
+static void sendRecords(uint8_t stream)
+{
+  switch (stream) {
+    case STREAM_CHANNELS:
+      recordBegin(stream);
+      for (uint8_t i = 0; i < MAX_OUTPUT_CHANNELS; i++) {
+        framePut16(channelOutputs[i]);
+      }
+      frameSend();
+      break;
+
+    case STREAM_INPUTS:
+      recordBegin(stream);
+      for (uint8_t i = 0; i < MAX_INPUTS; i++) {
+        framePut16(anas[i]);
+      }
+      frameSend();
+      break;
+
+    case STREAM_LOGICAL_SWITCHES: {
+      recordBegin(stream);
+      uint8_t bits = 0;
+      for (uint8_t i = 0; i < MAX_LOGICAL_SWITCHES; i++) {
+        if (getSwitch(SWSRC_FIRST_LOGICAL_SWITCH + i)) bits |= 1 << (i % 8);
+        if (i % 8 == 7 || i == MAX_LOGICAL_SWITCHES - 1) {
+          framePut8(bits);
+          bits = 0;
+        }
+      }
+      frameSend();
+      break;
+    }
+
+    case STREAM_TELEMETRY:
+      sendTelemetryRecords();
+      break;
+  }
+}
+
+static void processCommand(uint8_t type, const uint8_t* payload, uint8_t len)
+{
+  switch (type) {
+    case STREAM_CMD_PING:
+      frameBegin(STREAM_PONG);
+      framePut8(STREAM_VERSION);
+      framePut16(streamRejected);
+      frameSend();
+      break;
+
+    case STREAM_CMD_SUBSCRIBE:
+      if (len >= 3 && payload[0] < STREAM_COUNT) {
+        auto& sub = streamSubscriptions[payload[0]];
+        sub.period = payload[1] | (payload[2] << 8);
+        sub.next = streamNow;
+      } else {
+        streamRejected++;
+      }
+      break;
+
+    case STREAM_CMD_STOP:
+      serialStreamStop();
+      break;
+
+    default:
+      streamRejected++;
+      break;
+  }
+}
+
+static void processByte(uint8_t c)
+{
+  auto& rx = streamRx;
+
+  switch (rx.state) {
+    case STREAM_RX_SYNC:
+      if (c == STREAM_SYNC) rx.state = STREAM_RX_LENGTH;
+      return;
+
+    case STREAM_RX_LENGTH:
+      rx.length = c;
+      rx.pos = 0;
+      rx.crc = crc16(CRC_1021, &c, 1);
+      rx.state = STREAM_RX_TYPE;
+      return;
+
+    case STREAM_RX_TYPE:
+      rx.type = c;
+      rx.crc = crc16(CRC_1021, &c, 1, rx.crc);
+      rx.state = rx.length ? STREAM_RX_PAYLOAD : STREAM_RX_CRC_LO;
+      return;
+
+    case STREAM_RX_PAYLOAD:
+      // commands are short: the rest of a longer payload is only
+      // used for the CRC
+      if (rx.pos < STREAM_CMD_MAX_LEN) rx.payload[rx.pos] = c;
+      rx.crc = crc16(CRC_1021, &c, 1, rx.crc);
+      if (++rx.pos == rx.length) rx.state = STREAM_RX_CRC_LO;
+      return;
+
+    case STREAM_RX_CRC_LO:
+      rx.crc ^= c;
+      rx.state = STREAM_RX_CRC_HI;
+      return;
+
+    case STREAM_RX_CRC_HI:
+      rx.state = STREAM_RX_SYNC;
+      if ((rx.crc ^ (c << 8)) == 0) {
+        processCommand(rx.type, rx.payload, min<uint8_t>(rx.length, STREAM_CMD_MAX_LEN));
+      } else {
+        streamRejected++;
+      }
+      return;
+  }
+}
+
+#if defined(SIMU)
+static void streamTimerCb(timer_handle_t* timer)
+{
+  (void)timer;
+  serialStreamWakeup(time_get_ms());
+}
+#endif
+
+void serialStreamReceiveData(uint8_t* buf, uint32_t len)
+{
+  streamRxFifo.push(buf, len);
+}
+
+void serialStreamStart(void* ctx, const etx_serial_driver_t* drv)
+{
+  serialStreamStop();
+
+  memclear(&streamRx, sizeof(streamRx));
+  memclear(streamSubscriptions, sizeof(streamSubscriptions));
+  streamRxFifo.clear();
+  streamSequence = 0;
+  streamRejected = 0;
+
+  streamCtx = ctx;
+  streamDrv = drv;
+  if (!drv) return;
+
+  // drivers without RX callback are polled in serialStreamWakeup()
+  if (drv->setReceiveCb) drv->setReceiveCb(ctx, serialStreamReceiveData);
+
+#if defined(SIMU)
+  if (!timer_is_created(&streamTimer)) {
+    timer_create(&streamTimer, streamTimerCb, "stream", STREAM_TIMER_PERIOD,
+                 true);
+  }
+  if (timer_start(&streamTimer) < 0) {
+    TRACE("stream: cannot start timer");
+    serialStreamStop();
+  }
+#endif
+}
+
+void serialStreamStop()
+{
+  auto drv = streamDrv;
+  streamDrv = nullptr;
+
+#if defined(SIMU)
+  if (timer_is_created(&streamTimer)) timer_stop(&streamTimer);
+#endif
+  if (drv && drv->setReceiveCb) drv->setReceiveCb(streamCtx, nullptr);
+}
+
+bool serialStreamActive()
+{
+  return streamDrv != nullptr;
+}
+
+void serialStreamWakeup(uint32_t now)
+{
+  auto drv = streamDrv;
+  if (!drv) return;
+
+  streamNow = now;
+
+  uint8_t c;
+  if (!drv->setReceiveCb && drv->getByte) {
+    while (drv->getByte(streamCtx, &c) > 0) processByte(c);
+  }
+  while (streamRxFifo.pop(c)) processByte(c);
+
+  for (uint8_t i = 0; i < STREAM_COUNT && streamDrv; i++) {
+    auto& sub = streamSubscriptions[i];
+    if (!sub.period || (int32_t)(now - sub.next) < 0) continue;
+
+    // keep the requested rate, but do not try to catch up after a stall
+    sub.next += sub.period;
+    if ((int32_t)(now - sub.next) >= 0) sub.next = now + sub.period;
+
+    sendRecords(i);
+  }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#pragma once
+
+#include "hal/serial_driver.h"
+
+// Binary streaming service
+//
+// Every message, in both directions, is framed as:
+//
+//   SYNC | length | type | payload[length] | CRC16 (LE)
+//
+// The CRC (CRC-16/XMODEM, crc16(CRC_1021)) covers length, type and payload.
+//
+// Host commands:
+//   PING -> PONG: version (u8), rejected frames (u16)
+//   SUBSCRIBE: stream (u8), period in ms (u16), 0 to unsubscribe
+//   STOP: leave the streaming mode
+//
+// Records (type = STREAM_RECORD | stream):
+//   sequence (u16), timestamp in us (u32), then
+//   - CHANNELS: channel outputs (i16[MAX_OUTPUT_CHANNELS])
+//   - INPUTS: mixer inputs (i16[MAX_INPUTS])
+//   - LOGICAL_SWITCHES: bit field (u8[MAX_LOGICAL_SWITCHES / 8])
+//   - TELEMETRY: index (u8), value (i32) of each available sensor,
+//     split over several records if needed
+//
+// The sequence is shared by all records: a gap means frames were
+// dropped because the TX buffer was full.
+//
+// All values are little-endian.
+
+#define STREAM_SYNC                 0xA5
+#define STREAM_VERSION              1
+#define STREAM_MAX_PAYLOAD          255
+#define STREAM_FRAME_OVERHEAD       5
+#define STREAM_RECORD_HEADER        6
+
+enum StreamCommands {
+  STREAM_CMD_PING = 0x01,
+  STREAM_CMD_SUBSCRIBE = 0x02,
+  STREAM_CMD_STOP = 0x03,
+  STREAM_PONG = 0x41,
+  STREAM_RECORD = 0x80,
+};
+
+enum StreamIds {
+  STREAM_CHANNELS,
+  STREAM_INPUTS,
+  STREAM_LOGICAL_SWITCHES,
+  STREAM_TELEMETRY,
+  STREAM_COUNT
+};
+
+// Start streaming on the given port (sends records with
+// 'sendBuffer' when available, byte by byte otherwise)
+void serialStreamStart(void* ctx, const etx_serial_driver_t* drv);
+void serialStreamStop();
+bool serialStreamActive();
+
+// Called from the receive ISR
+void serialStreamReceiveData(uint8_t* buf, uint32_t len);
+
+// Parse the received commands and send the records due ('now' in ms).
+// Called every millisecond by the task owning the port while streaming
+// is active (see cliStream()).
+void serialStreamWakeup(uint32_t now);
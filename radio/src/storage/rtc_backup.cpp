@@ -34,7 +34,13 @@ PACK(struct RamBackupUncompressed {
 
 #include "datacopy.inc"
 
-Backup::RamBackupUncompressed ramBackupUncompressed __DMA;
+// Last image written to the backup
+Backup::RamBackupUncompressed ramBackupUncompressed __DMA __attribute__((aligned(4)));
+#if defined(RTC_BACKUP_DELTA)
+// Image being written (also used as scratch buffer for the delta records)
+static Backup::RamBackupUncompressed ramBackupNext __DMA __attribute__((aligned(4)));
+#endif
+static bool ramBackupValid = false;
 
 #if defined(SIMU)
 RamBackup _ramBackup;
@@ -48,27 +54,199 @@ RamBackup * ramBackup = &_ramBackup;
 RamBackup * ramBackup = (RamBackup *)BKPSRAM_BASE;
 #endif
 
+static void rambackupWriteFull()
+{
+  // invalidate the backup while rewriting it
+  ramBackup->size = 0;
+  ramBackup->deltaSize = 0;
+  uint16_t size = compress(ramBackup->data, sizeof(ramBackup->data),
+                           (const uint8_t *)&ramBackupUncompressed,
+                           sizeof(ramBackupUncompressed));
+  ramBackup->size = size;
+  ramBackupValid = (size > 0);
+}
+
+#if defined(RTC_BACKUP_DELTA)
+/*
+  Incremental backup (targets with enough RAM for a second image)
+  - the new image is compared with the previous one 32 bits at a time
+  - each changed span is stored as a delta record: the RLC of the XOR
+    between the new and the previous data, appended after the full image
+  - the records written during a cycle are committed at once by updating
+    ramBackup->deltaSize, an interrupted write leaves the previous
+    backup untouched
+  - the full image is rewritten when the records do not fit anymore
+*/
+
+PACK(struct RamBackupDelta {
+  uint16_t offset;
+  uint16_t length;  // uncompressed length
+  uint16_t size;    // RLC size
+});
+
+// unchanged bytes between two changes, below which both changes are
+// stored in the same record (cheaper than a new record header)
+#define RAMBACKUP_SPAN_GAP  (2 * sizeof(RamBackupDelta))
+
+static unsigned findChange(const uint8_t * a, const uint8_t * b,
+                           unsigned i, unsigned len)
+{
+  while (i < len && (i & 3)) {
+    if (a[i] != b[i]) return i;
+    i++;
+  }
+  while (i + 4 <= len && *(const uint32_t *)(a + i) == *(const uint32_t *)(b + i)) {
+    i += 4;
+  }
+  while (i < len && a[i] == b[i]) {
+    i++;
+  }
+  return i;
+}
+
+// Appends the delta record for [start, end) at 'pos' in the backup data
+// and updates the previous image. Returns the record size, 0 if it does
+// not fit.
+static unsigned rambackupWriteDelta(unsigned pos, unsigned start, unsigned end)
+{
+  uint8_t * image = (uint8_t *)&ramBackupUncompressed + start;
+  uint8_t * next = (uint8_t *)&ramBackupNext + start;
+  unsigned length = end - start;
+
+  for (unsigned i = 0; i < length; i++) {
+    uint8_t value = next[i];
+    next[i] ^= image[i];
+    image[i] = value;
+  }
+
+  if (pos + sizeof(RamBackupDelta) >= sizeof(ramBackup->data))
+    return 0;
+
+  RamBackupDelta delta;
+  delta.offset = start;
+  delta.length = length;
+  delta.size = compress(ramBackup->data + pos + sizeof(delta),
+                        sizeof(ramBackup->data) - pos - sizeof(delta), next,
+                        length);
+  if (delta.size == 0)
+    return 0;
+
+  memcpy(ramBackup->data + pos, &delta, sizeof(delta));
+  return sizeof(delta) + delta.size;
+}
+
+#endif
+
 void rambackupWrite()
 {
+#if !defined(RTC_BACKUP_DELTA)
   copyRadioData(&ramBackupUncompressed.radio, &g_eeGeneral);
   copyModelData(&ramBackupUncompressed.model, &g_model);
-  ramBackup->size = compress(ramBackup->data, sizeof(ramBackup->data),
-                             (const uint8_t *)&ramBackupUncompressed,
-                             sizeof(ramBackupUncompressed));
-
+  rambackupWriteFull();
   TRACE("RamBackupWrite sdsize=%d backupsize=%d rlcsize=%d",
         sizeof(ModelData) + sizeof(RadioData),
         sizeof(Backup::RamBackupUncompressed), ramBackup->size);
+#else
+  copyRadioData(&ramBackupNext.radio, &g_eeGeneral);
+  copyModelData(&ramBackupNext.model, &g_model);
+
+  if (!ramBackupValid) {
+    memcpy(&ramBackupUncompressed, &ramBackupNext, sizeof(ramBackupUncompressed));
+    rambackupWriteFull();
+    TRACE("RamBackupWrite sdsize=%d backupsize=%d rlcsize=%d",
+          sizeof(ModelData) + sizeof(RadioData),
+          sizeof(Backup::RamBackupUncompressed), ramBackup->size);
+    return;
+  }
+
+  uint8_t * image = (uint8_t *)&ramBackupUncompressed;
+  const uint8_t * next = (const uint8_t *)&ramBackupNext;
+  const unsigned len = sizeof(ramBackupUncompressed);
+  unsigned pos = ramBackup->size + ramBackup->deltaSize;
+  unsigned records = 0;
+  bool overflow = false;
+
+  unsigned start = findChange(image, next, 0, len);
+  while (start < len) {
+    unsigned last = start;
+    for (unsigned i = start + 1; i < len && i - last <= RAMBACKUP_SPAN_GAP; i++) {
+      if (image[i] != next[i]) last = i;
+    }
+
+    if (overflow) {
+      memcpy(image + start, next + start, last + 1 - start);
+    }
+    else {
+      unsigned size = rambackupWriteDelta(pos, start, last + 1);
+      if (size > 0) {
+        pos += size;
+        records++;
+      }
+      else {
+        overflow = true;
+      }
+    }
+
+    start = findChange(image, next, last + 1, len);
+  }
+
+  if (overflow) {
+    rambackupWriteFull();
+    TRACE("RamBackupWrite rlcsize=%d (full)", ramBackup->size);
+  }
+  else if (records > 0) {
+    ramBackup->deltaSize = pos - ramBackup->size;
+    TRACE("RamBackupWrite rlcsize=%d deltasize=%d (%d records)",
+          ramBackup->size, ramBackup->deltaSize, records);
+  }
+#endif
 }
 
 bool rambackupRestore()
 {
+  ramBackupValid = false;
+
   if (ramBackup->size == 0)
     return false;
 
+  unsigned end = ramBackup->size + ramBackup->deltaSize;
+  if (end > sizeof(ramBackup->data))
+    return false;
+
   if (uncompress((uint8_t *)&ramBackupUncompressed, sizeof(ramBackupUncompressed), ramBackup->data, ramBackup->size) != sizeof(ramBackupUncompressed))
     return false;
 
+#if !defined(RTC_BACKUP_DELTA)
+  if (ramBackup->deltaSize != 0)
+    return false;
+#else
+  uint8_t * image = (uint8_t *)&ramBackupUncompressed;
+  uint8_t * next = (uint8_t *)&ramBackupNext;
+  unsigned pos = ramBackup->size;
+  while (pos < end) {
+    RamBackupDelta delta;
+    if (pos + sizeof(delta) > end)
+      return false;
+    memcpy(&delta, ramBackup->data + pos, sizeof(delta));
+    pos += sizeof(delta);
+
+    if (delta.length == 0 ||
+        delta.offset + delta.length > sizeof(ramBackupUncompressed) ||
+        pos + delta.size > end)
+      return false;
+
+    if (uncompress(next, delta.length, ramBackup->data + pos, delta.size) != delta.length)
+      return false;
+
+    for (unsigned i = 0; i < delta.length; i++) {
+      image[delta.offset + i] ^= next[i];
+    }
+    pos += delta.size;
+  }
+#endif
+
+  ramBackupValid = true;
+
   memset(&g_eeGeneral, 0, sizeof(g_eeGeneral));
   memset(&g_model, 0, sizeof(g_model));
   copyRadioData(&g_eeGeneral, &ramBackupUncompressed.radio);
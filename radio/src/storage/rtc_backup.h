@@ -23,9 +23,13 @@
 
 #include "definitions.h"
 
+// The backup holds a full RLC image of the radio and model data, followed
+// by delta records with RTC_BACKUP_DELTA (see rtc_backup.cpp). 'size' and 'deltaSize' are only
+// updated once the data they cover has been written.
 PACK(struct RamBackup {
-  uint16_t size;
-  uint8_t data[4094];
+  uint16_t size;       // full image
+  uint16_t deltaSize;  // delta records following the full image
+  uint8_t data[4092];
 });
 
 extern RamBackup * ramBackup;
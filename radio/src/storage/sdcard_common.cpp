@@ -26,6 +26,10 @@
 #include "model_init.h"
 
 #include "hal/abnormal_reboot.h"
+#include "sdcard_yaml.h"
+#include "yaml/yaml_tree_walker.h"
+
+#include <new>
 
 #if defined(COLORLCD)
   #include "theme_manager.h"
@@ -176,11 +180,151 @@ const char * createModel()
 }
 #endif
 
+/*
+  Model switching
+
+  The model file is parsed into a separate ModelData, either in slices from
+  the UI loop (modelPreloadStart() and modelPreloadRun()) or by loadModel()
+  itself, while the current model keeps running. The parsed model is then
+  swapped in by swapModel().
+*/
+
+// read buffers parsed by each modelPreloadRun()
+#define MODEL_PRELOAD_SLICE  32
+
+enum ModelPreloadState {
+  MODEL_PRELOAD_NONE,
+  MODEL_PRELOAD_RUNNING,
+  MODEL_PRELOAD_DONE,
+};
+
+struct ModelPreload {
+  ModelData model;
+  YamlTreeWalker tree;
+  YamlFileReader reader;
+};
+
+static ModelPreload* preload = nullptr;
+static char preloadFilename[LEN_MODEL_FILENAME + 1];
+static const char* preloadError = nullptr;
+static uint8_t preloadState = MODEL_PRELOAD_NONE;
+
+static bool modelPreloadAlloc()
+{
+  if (!preload) {
+    preload = new (std::nothrow) ModelPreload;
+  }
+  return preload != nullptr;
+}
+
+static void modelPreloadFree()
+{
+  delete preload;
+  preload = nullptr;
+}
+
+static void modelPreloadClose()
+{
+  const char* error = preload->reader.close(nullptr);
+  if (!preloadError) preloadError = error;
+  preloadState = MODEL_PRELOAD_DONE;
+}
+
+static void modelPreloadAbort()
+{
+  if (preloadState == MODEL_PRELOAD_RUNNING) {
+    preload->reader.close(nullptr);
+  }
+  preloadState = MODEL_PRELOAD_NONE;
+}
+
+bool modelPreloadStart(const char* filename)
+{
+  if (preloadState != MODEL_PRELOAD_NONE &&
+      !strncmp(preloadFilename, filename, LEN_MODEL_FILENAME))
+    return true;
+
+  if (strlen(filename) > LEN_MODEL_FILENAME)
+    return false;
+
+  const char* ext = strrchr(filename, '.');
+  if (!ext || strcmp(ext, YAML_EXT) != 0)
+    return false;
+
+  modelPreloadAbort();
+  if (!modelPreloadAlloc())
+    return false;
+
+  strncpy(preloadFilename, filename, LEN_MODEL_FILENAME);
+  preloadFilename[LEN_MODEL_FILENAME] = '\0';
+  preloadError = readModelYamlStart(&preload->reader, &preload->tree, filename,
+                                    (uint8_t*)&preload->model, sizeof(ModelData));
+  preloadState = preloadError ? MODEL_PRELOAD_DONE : MODEL_PRELOAD_RUNNING;
+  return true;
+}
+
+void modelPreloadRun()
+{
+  if (preloadState == MODEL_PRELOAD_RUNNING &&
+      preload->reader.read(MODEL_PRELOAD_SLICE)) {
+    modelPreloadClose();
+  }
+}
+
+void modelPreloadInvalidate(const char* path)
+{
+  if (preloadState == MODEL_PRELOAD_NONE)
+    return;
+
+  char preloadPath[sizeof(MODELS_PATH) + LEN_MODEL_FILENAME + 1];
+  getModelPath(preloadPath, preloadFilename);
+  if (!strcmp(path, preloadPath)) {
+    modelPreloadAbort();
+  }
+}
+
+// Returns the parsed model, nullptr if there is not enough memory
+static ModelData* modelPreloadTake(const char* filename, const char** error)
+{
+  if (preloadState != MODEL_PRELOAD_NONE &&
+      !strncmp(preloadFilename, filename, LEN_MODEL_FILENAME)) {
+    // finish the parsing at once, the model is needed now
+    if (preloadState == MODEL_PRELOAD_RUNNING) {
+      preload->reader.read(UINT_MAX);
+      modelPreloadClose();
+    }
+    TRACE("loadModel: %s preloaded", filename);
+  }
+  else {
+    modelPreloadAbort();
+    if (!modelPreloadAlloc()) return nullptr;
+    preloadError = readModel(filename, (uint8_t*)&preload->model, sizeof(ModelData));
+  }
+
+  *error = preloadError;
+  preloadState = MODEL_PRELOAD_NONE;
+  return &preload->model;
+}
+
 const char* loadModel(char* filename, bool alarms)
 {
+  const char* error = nullptr;
+  ModelData* model = modelPreloadTake(filename, &error);
+
+  if (model && !error) {
+    swapModel(model, alarms);
+    modelPreloadFree();
+    return nullptr;
+  }
+  modelPreloadFree();
+
   preModelLoad();
 
-  const char* error = readModel(filename, (uint8_t*)&g_model, sizeof(g_model));
+  if (!model) {
+    // not enough memory for a separate model, load it in place
+    error = readModel(filename, (uint8_t*)&g_model, sizeof(g_model));
+  }
+
   if (error) {
     TRACE("loadModel error=%s", error);
 
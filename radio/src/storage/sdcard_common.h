@@ -29,14 +29,33 @@
 #define DEFAULT_MODEL_FILENAME   MODEL_FILENAME_PREFIX "1" MODEL_FILENAME_SUFFIX
 #define MODEL_FILENAME_PATTERN   MODEL_FILENAME_PREFIX MODEL_FILENAME_SUFFIX
 
-// writes a complete YAML file
+// writes a complete YAML file: the file is first written to 'tmpPath'
+// (defaults to path + YAMLFILE_TMP_EXT) and then renamed
 struct YamlNode;
-const char* writeFileYaml(const char* path, const YamlNode* root_node, uint8_t* data, uint16_t checksum);
+const char* writeFileYaml(const char* path, const YamlNode* root_node, uint8_t* data,
+                          bool checksum = false, const char* tmpPath = nullptr);
+
+struct YamlWriteStats {
+  uint32_t files;        // files written since boot
+  uint32_t writeCalls;   // f_write() calls for the last file
+  uint32_t bytes;        // size of the last file
+  uint32_t duration;     // last file save time (ms)
+  uint32_t maxDuration;  // ms
+};
+
+const YamlWriteStats& getYamlWriteStats();
 
 void getModelPath(char * path, const char * filename, const char* pathName = STR_MODELS_PATH);
 
 const char * readModel(const char * filename, uint8_t * buffer, uint32_t size, const char* pathName = STR_MODELS_PATH);
 const char * loadModel(char * filename, bool alarms=true);
+// Parses a model in the background, so that a following loadModel()
+// of the same file only has to swap it in
+bool modelPreloadStart(const char* filename);
+// Parses the next slice of the preloaded model (from the UI loop)
+void modelPreloadRun();
+// To be called when a model file is written
+void modelPreloadInvalidate(const char* path);
 const char * loadModelTemplate(const char* fileName, const char* filePath);
 const char * createModel();
 const char * writeModel();
@@ -27,34 +27,57 @@
 #include "sdcard_common.h"
 #include "sdcard_yaml.h"
 #include "modelslist.h"
+#include "os/time.h"
 
 #include "yaml/yaml_tree_walker.h"
 #include "yaml/yaml_parser.h"
 #include "yaml/yaml_datastructs.h"
 #include "yaml/yaml_bits.h"
 
-const char * readYamlFile(const char* fullpath, const YamlParserCalls* calls, void* parser_ctx, ChecksumResult* checksum_result)
+const char* YamlFileReader::open(const char* fullpath, const YamlParserCalls* calls, void* parser_ctx,
+                                 bool checksum)
 {
-    FIL  file;
-    UINT bytes_read;
-    UINT total_bytes = 0;
-
     FRESULT result = f_open(&file, fullpath, FA_OPEN_EXISTING | FA_READ);
+    if (result == FR_NO_FILE) {
+        // writeFileYaml() was interrupted between removing the old file
+        // and renaming the new one
+        char tmpPath[256];
+        if (strlen(fullpath) + sizeof(YAMLFILE_TMP_EXT) <= sizeof(tmpPath)) {
+            strAppend(strAppend(tmpPath, fullpath), YAMLFILE_TMP_EXT);
+            if (f_rename(tmpPath, fullpath) == FR_OK) {
+                TRACE("recovered %s", fullpath);
+                result = f_open(&file, fullpath, FA_OPEN_EXISTING | FA_READ);
+            }
+        }
+    }
     if (result != FR_OK) {
         return SDCARD_ERROR(result);
     }
 
-    YamlParser yp; //TODO: move to re-usable buffer
-    yp.init(calls, parser_ctx);
+    parser.init(calls, parser_ctx);
 
-    uint16_t calculated_checksum = 0xFFFF;
-    uint16_t file_checksum = 0;
+    error = NULL;
+    opened = true;
+    done = false;
+    first_block = true;
+    this->checksum = checksum;
+    total_bytes = 0;
+    calculated_checksum = 0xFFFF;
+    file_checksum = 0;
+    return NULL;
+}
 
-    bool first_block = true;
+bool YamlFileReader::read(unsigned blocks)
+{
+    UINT bytes_read;
     char buffer[32];
-    while (f_read(&file, buffer, sizeof(buffer)-1, &bytes_read) == FR_OK) {
-      if (bytes_read == 0)  // EOF
+
+    while (!done && blocks-- > 0) {
+      if (f_read(&file, buffer, sizeof(buffer)-1, &bytes_read) != FR_OK || bytes_read == 0) {
+        // EOF
+        done = true;
         break;
+      }
       total_bytes += bytes_read;
 
       uint16_t skip = 0;
@@ -70,7 +93,9 @@ const char * readYamlFile(const char* fullpath, const YamlParserCalls* calls, vo
           // Advance through the value
           while((*endPos != '\r') && (*endPos != '\n')) {
             if (endPos > buffer + bytes_read) {
-              return SDCARD_ERROR(	FR_INT_ERR );
+              error = SDCARD_ERROR(	FR_INT_ERR );
+              done = true;
+              return true;
             }
             endPos++;
           }
@@ -85,18 +110,28 @@ const char * readYamlFile(const char* fullpath, const YamlParserCalls* calls, vo
         }
       }
 
-      // Calculate checksum on read block only if we are called with a pointer to write the resulting checksum
-      if (checksum_result != NULL) {
+      // Calculate checksum on read block only if it is going to be verified
+      if (checksum) {
         calculated_checksum = crc16(0, (const uint8_t *)buffer + skip, bytes_read - skip, calculated_checksum);
       }
 
-      if (f_eof(&file)) yp.set_eof();
-      if (yp.parse(buffer + skip, bytes_read - skip) != YamlParser::CONTINUE_PARSING)
-        break;
+      if (f_eof(&file)) parser.set_eof();
+      if (parser.parse(buffer + skip, bytes_read - skip) != YamlParser::CONTINUE_PARSING)
+        done = true;
     }
+
+    return done;
+}
+
+const char* YamlFileReader::close(ChecksumResult* checksum_result)
+{
+    if (!opened)
+      return error;
+
     f_close(&file);
+    opened = false;
 
-    if (checksum_result != NULL) {
+    if (checksum_result != NULL && checksum && error == NULL) {
       // Special case to handle "old" files with no checksum field
       // 25 was arbitrarily chosen as the minimum realistic file size
       // - The issue is to allow old files to pass, while still detecting garbled files
@@ -112,7 +147,18 @@ const char * readYamlFile(const char* fullpath, const YamlParserCalls* calls, vo
       }
     }
 
-    return NULL;
+    return error;
+}
+
+const char * readYamlFile(const char* fullpath, const YamlParserCalls* calls, void* parser_ctx, ChecksumResult* checksum_result)
+{
+    YamlFileReader reader; //TODO: move to re-usable buffer
+
+    const char* error = reader.open(fullpath, calls, parser_ctx, checksum_result != NULL);
+    if (error) return error;
+
+    reader.read(UINT_MAX);
+    return reader.close(checksum_result);
 }
 
 //
@@ -231,25 +277,100 @@ bool YamlFileChecksum(const YamlNode* root_node, uint8_t* data, uint16_t* checks
 }
 
 
+// Files are generated into a sector sized staging buffer, so that the
+// many small tokens emitted by the tree walker end up in a few f_write()
+// calls. The checksum is computed on the fly and back-patched into a
+// fixed width header once the whole file has been generated.
+#define YAML_WRITER_BUFFER_SIZE     512
+#define YAML_CHECKSUM_DIGITS        5
+#define YAML_CHECKSUM_VALUE_OFFSET  (sizeof(YAMLFILE_CHECKSUM_TAG_NAME) - 1 + 2)
+
+static uint8_t yamlWriterBuffer[YAML_WRITER_BUFFER_SIZE];
+static YamlWriteStats yamlWriteStats;
+
 struct yaml_writer_ctx {
-    FIL*    file;
-    FRESULT result;
+    FIL*     file;
+    FRESULT  result;
+    uint16_t checksum;
+    uint16_t pos;
+    bool     flushed;
+    uint32_t write_calls;
+    uint32_t bytes;
 };
 
-static bool yaml_writer(void* opaque, const char* str, size_t len)
+static bool yaml_writer_flush(yaml_writer_ctx* ctx)
 {
+    if (ctx->pos == 0)
+        return true;
+
     UINT bytes_written;
+    ctx->result = f_write(ctx->file, yamlWriterBuffer, ctx->pos, &bytes_written);
+    ctx->write_calls++;
+    ctx->bytes += bytes_written;
+    if (ctx->result == FR_OK && bytes_written != ctx->pos) {
+        // disk full
+        ctx->result = FR_DENIED;
+    }
+    ctx->pos = 0;
+    ctx->flushed = true;
+    return ctx->result == FR_OK;
+}
+
+static bool yaml_writer_append(yaml_writer_ctx* ctx, const char* str, size_t len)
+{
+    while (len > 0) {
+        size_t n = min<size_t>(len, YAML_WRITER_BUFFER_SIZE - ctx->pos);
+        memcpy(yamlWriterBuffer + ctx->pos, str, n);
+        ctx->pos += n;
+        str += n;
+        len -= n;
+        if (ctx->pos == YAML_WRITER_BUFFER_SIZE && !yaml_writer_flush(ctx))
+            return false;
+    }
+    return true;
+}
+
+static bool yaml_writer(void* opaque, const char* str, size_t len)
+{
     yaml_writer_ctx* ctx = (yaml_writer_ctx*)opaque;
 
 #if defined(DEBUG_YAML)
     TRACE_NOCRLF("%.*s",len,str);
 #endif
 
-    ctx->result = f_write(ctx->file, str, len, &bytes_written);
-    return (ctx->result == FR_OK) && (bytes_written == len);
+    ctx->checksum = crc16(0, (const uint8_t *)str, len, ctx->checksum);
+    return yaml_writer_append(ctx, str, len);
 }
 
-const char* writeFileYaml(const char* path, const YamlNode* root_node, uint8_t* data, uint16_t checksum)
+static bool yaml_writer_checksum(yaml_writer_ctx* ctx)
+{
+    // zero padded, so that the header size does not depend on the value
+    char value[YAML_CHECKSUM_DIGITS];
+    uint16_t checksum = ctx->checksum;
+    for (int i = YAML_CHECKSUM_DIGITS - 1; i >= 0; i--) {
+        value[i] = '0' + checksum % 10;
+        checksum /= 10;
+    }
+
+    if (!ctx->flushed) {
+        // header still in the staging buffer
+        memcpy(yamlWriterBuffer + YAML_CHECKSUM_VALUE_OFFSET, value, sizeof(value));
+        return yaml_writer_flush(ctx);
+    }
+
+    if (!yaml_writer_flush(ctx))
+        return false;
+
+    UINT bytes_written;
+    ctx->result = f_lseek(ctx->file, YAML_CHECKSUM_VALUE_OFFSET);
+    if (ctx->result == FR_OK) {
+        ctx->result = f_write(ctx->file, value, sizeof(value), &bytes_written);
+        ctx->write_calls++;
+    }
+    return ctx->result == FR_OK;
+}
+
+static const char* writeFileYamlTmp(const char* path, const YamlNode* root_node, uint8_t* data, bool checksum)
 {
     FIL file;
 
@@ -263,55 +384,94 @@ const char* writeFileYaml(const char* path, const YamlNode* root_node, uint8_t*
     yaml_writer_ctx ctx;
     ctx.file = &file;
     ctx.result = FR_OK;
-
-    // Try to add CRC
-    if (checksum != 0) {
-      if (!yaml_writer(&ctx, YAMLFILE_CHECKSUM_TAG_NAME, strlen(YAMLFILE_CHECKSUM_TAG_NAME))) return NULL;
-      if (!yaml_writer(&ctx, ": ", 2)) return SDCARD_ERROR(FR_INVALID_PARAMETER);
-      const char* p_out = NULL;
-      p_out = yaml_unsigned2str((int)checksum);
-      if (p_out && !yaml_writer(&ctx, p_out, strlen(p_out))) return SDCARD_ERROR(FR_INVALID_PARAMETER);
-      yaml_writer(&ctx, "\r\n", 2);
+    ctx.checksum = 0xFFFF;
+    ctx.pos = 0;
+    ctx.flushed = false;
+    ctx.write_calls = 0;
+    ctx.bytes = 0;
+
+    if (checksum) {
+      // placeholder, the checksum covers what follows the header
+      yaml_writer_append(&ctx, YAMLFILE_CHECKSUM_TAG_NAME, sizeof(YAMLFILE_CHECKSUM_TAG_NAME) - 1);
+      yaml_writer_append(&ctx, ": 00000\r\n", 2 + YAML_CHECKSUM_DIGITS + 2);
     }
 
+    bool success = tree.generate(yaml_writer, &ctx) || ctx.result == FR_OK;
+    if (success) {
+      success = checksum ? yaml_writer_checksum(&ctx) : yaml_writer_flush(&ctx);
+    }
 
-    if (!tree.generate(yaml_writer, &ctx)) {
-        if (ctx.result != FR_OK) {
-            f_close(&file);
-            return SDCARD_ERROR(ctx.result);
-        }
+    result = f_close(&file);
+    if (!success) {
+        return SDCARD_ERROR(ctx.result);
+    }
+    if (result != FR_OK) {
+        return SDCARD_ERROR(result);
     }
 
-    f_close(&file);
+    yamlWriteStats.writeCalls = ctx.write_calls;
+    yamlWriteStats.bytes = ctx.bytes;
+    if (checksum) {
+      TRACE("%s written with checksum %u", path, ctx.checksum);
+    }
     return NULL;
 }
 
-const char * writeGeneralSettings()
+const char* writeFileYaml(const char* path, const YamlNode* root_node, uint8_t* data, bool checksum, const char* tmpPath)
 {
-    TRACE("YAML radio settings writer");
-    uint16_t file_checksum = 0;
+    char defaultTmpPath[256];
+    if (!tmpPath) {
+      if (strlen(path) + sizeof(YAMLFILE_TMP_EXT) > sizeof(defaultTmpPath)) {
+        return SDCARD_ERROR(FR_INVALID_NAME);
+      }
+      strAppend(strAppend(defaultTmpPath, path), YAMLFILE_TMP_EXT);
+      tmpPath = defaultTmpPath;
+    }
 
-    YamlFileChecksum(get_radiodata_nodes(), (uint8_t*)&g_eeGeneral, &file_checksum);
-    g_eeGeneral.manuallyEdited = false;
+    uint32_t start = time_get_ms();
 
-    const char *p = writeFileYaml(RADIO_SETTINGS_TMPFILE_YAML_PATH, get_radiodata_nodes(),
-                         (uint8_t*)&g_eeGeneral, file_checksum);
-    TRACE("generalSettings written with checksum %u", file_checksum);
+    modelPreloadInvalidate(path);
 
-    if (p != NULL) {
-        return p;
+    // the previous file is only replaced once the new one is complete
+    const char* error = writeFileYamlTmp(tmpPath, root_node, data, checksum);
+    if (error) {
+      f_unlink(tmpPath);
+      return error;
     }
-    f_unlink(RADIO_SETTINGS_YAML_PATH);
 
-    FRESULT result = f_rename(RADIO_SETTINGS_TMPFILE_YAML_PATH, RADIO_SETTINGS_YAML_PATH);
-    if(result != FR_OK)
-        return SDCARD_ERROR(result);
+    f_unlink(path);
+    FRESULT result = f_rename(tmpPath, path);
+    if (result != FR_OK) {
+      return SDCARD_ERROR(result);
+    }
 
-    return nullptr;
+    yamlWriteStats.duration = time_get_ms() - start;
+    if (yamlWriteStats.duration > yamlWriteStats.maxDuration) {
+      yamlWriteStats.maxDuration = yamlWriteStats.duration;
+    }
+    yamlWriteStats.files++;
+    return NULL;
 }
 
+const YamlWriteStats& getYamlWriteStats()
+{
+    return yamlWriteStats;
+}
 
-const char * readModelYaml(const char * filename, uint8_t * buffer, uint32_t size, const char* pathName)
+const char * writeGeneralSettings()
+{
+    TRACE("YAML radio settings writer");
+    g_eeGeneral.manuallyEdited = false;
+
+    // the loader falls back to the temporary file if the rename did not happen
+    return writeFileYaml(RADIO_SETTINGS_YAML_PATH, get_radiodata_nodes(),
+                         (uint8_t*)&g_eeGeneral, true,
+                         RADIO_SETTINGS_TMPFILE_YAML_PATH);
+}
+
+
+const char * readModelYamlStart(YamlFileReader* reader, YamlTreeWalker* tree,
+                                const char * filename, uint8_t * buffer, uint32_t size, const char* pathName)
 {
     // YAML reader
     TRACE("YAML model reader");
@@ -333,18 +493,17 @@ const char * readModelYaml(const char * filename, uint8_t * buffer, uint32_t siz
     char path[256];
     getModelPath(path, filename, pathName);
 
-    YamlTreeWalker tree;
-    tree.reset(data_nodes, buffer);
+    tree->reset(data_nodes, buffer);
 
     // wipe memory before reading YAML
     memset(buffer,0,size);
 
     if (init_model) {
+      auto md = reinterpret_cast<ModelData*>(buffer);
 #if defined(FUNCTION_SWITCHES)
-      extern void initCustomSwitches();
-      initCustomSwitches();
+      extern void initCustomSwitches(ModelData* model);
+      initCustomSwitches(md);
 #endif
-      auto md = reinterpret_cast<ModelData*>(buffer);
 #if defined(FLIGHT_MODES) && defined(GVARS)
       // reset GVars to default values
       // Note: taken from edgetx.cpp::modelDefault()
@@ -364,7 +523,19 @@ const char * readModelYaml(const char * filename, uint8_t * buffer, uint32_t siz
       md->rfAlarms.critical = 42;
     }
 
-    return readYamlFile(path, YamlTreeWalker::get_parser_calls(), &tree, NULL);
+    return reader->open(path, YamlTreeWalker::get_parser_calls(), tree);
+}
+
+const char * readModelYaml(const char * filename, uint8_t * buffer, uint32_t size, const char* pathName)
+{
+    YamlFileReader reader;
+    YamlTreeWalker tree;
+
+    const char* error = readModelYamlStart(&reader, &tree, filename, buffer, size, pathName);
+    if (error) return error;
+
+    reader.read(UINT_MAX);
+    return reader.close(NULL);
 }
 
 static const char _wrongExtentionError[] = "wrong file extension";
@@ -384,7 +555,7 @@ const char * writeModelYaml(const char* filename)
     TRACE("YAML model writer");
     char path[256];
     getModelPath(path, filename);
-    return writeFileYaml(path, get_modeldata_nodes(), (uint8_t*)&g_model,0 );
+    return writeFileYaml(path, get_modeldata_nodes(), (uint8_t*)&g_model);
 }
 
 #if !defined(STORAGE_MODELSLIST)
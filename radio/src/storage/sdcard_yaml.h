@@ -21,15 +21,48 @@
 
 #pragma once
 
+#include "ff.h"
+#include "yaml/yaml_parser.h"
+
 enum class ChecksumResult {Success, Failed, None};
 
-struct YamlParserCalls;
+class YamlTreeWalker;
+
+// Reads a YAML file in slices of 'blocks' read buffers, so that a long
+// parse can be spread over several runs of the UI loop
+class YamlFileReader
+{
+  public:
+    // 'checksum' enables the checksum verification reported by close()
+    const char* open(const char* fullpath, const YamlParserCalls* calls, void* parser_ctx,
+                     bool checksum = false);
+    // returns true once the whole file has been parsed
+    bool read(unsigned blocks);
+    const char* close(ChecksumResult* checksum_result);
+    bool isOpen() const { return opened; }
+
+  private:
+    FIL file;
+    YamlParser parser;
+    const char* error = nullptr;
+    bool opened = false;
+    bool done = false;
+    bool first_block = true;
+    bool checksum = false;
+    UINT total_bytes = 0;
+    uint16_t calculated_checksum = 0xFFFF;
+    uint16_t file_checksum = 0;
+};
 
 constexpr uint8_t MODELIDX_STRLEN = sizeof(MODEL_FILENAME_PREFIX "00");
 
 const char * loadRadioSettingsYaml(bool checks);
 const char * writeModelYaml(const char* filename);
 const char * readModelYaml(const char * filename, uint8_t * buffer, uint32_t size, const char* pathName = STR_MODELS_PATH);
+// Opens a model file for a sliced read into 'buffer' through 'reader'
+const char * readModelYamlStart(YamlFileReader* reader, YamlTreeWalker* tree,
+                                const char * filename, uint8_t * buffer, uint32_t size,
+                                const char* pathName = STR_MODELS_PATH);
 bool YamlFileChecksum(const YamlNode* root_node, uint8_t* data, uint16_t* checksum);
 
 void getModelNumberStr(uint8_t idx, char* model_idx);
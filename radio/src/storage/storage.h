@@ -56,10 +56,15 @@ void storageCheck(bool immediately);
 // Generic storage functions (implemented in storage_common.cpp)
 //
 void storageDirty(uint8_t msk);
+// Incremented by each storageDirty() call, to detect settings changes
+uint32_t storageGetChangeCount();
 void storageFlushCurrentModel();
 void postRadioSettingsLoad();
 void preModelLoad();
 void postModelLoad(bool alarms);
+// Replaces the current model, restarting only the modules whose
+// RF configuration changed
+void swapModel(const ModelData* model, bool alarms);
 
 #if !defined(STORAGE_MODELSLIST)
 extern ModelHeader modelHeaders[MAX_MODELS];
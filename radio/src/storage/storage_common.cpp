@@ -22,6 +22,7 @@
 #include "edgetx.h"
 #include "os/sleep.h"
 #include "timers_driver.h"
+#include "hal/adc_driver.h"
 #include "tasks/mixer_task.h"
 #include "mixes.h"
 #include "switches.h"
@@ -43,16 +44,26 @@
 
 uint8_t   storageDirtyMsk;
 tmr10ms_t storageDirtyTime10ms;
+static uint32_t storageChangeCount;
 
 #if defined(RTC_BACKUP_RAM)
 uint8_t   rambackupDirtyMsk = EE_GENERAL | EE_MODEL;
 tmr10ms_t rambackupDirtyTime10ms;
 #endif
 
+uint32_t storageGetChangeCount()
+{
+  return storageChangeCount;
+}
+
 void storageDirty(uint8_t msk)
 {
   storageDirtyMsk |= msk;
   storageDirtyTime10ms = get_tmr10ms();
+  storageChangeCount += 1;
+
+  // calibration, hardware or model settings may have changed
+  adcPipelineInvalidate();
 
 #if defined(RTC_BACKUP_RAM)
   rambackupDirtyMsk = storageDirtyMsk;
@@ -84,6 +95,8 @@ void preModelLoad()
 
 void postRadioSettingsLoad()
 {
+  adcPipelineInvalidate();
+
 #if LCD_W == 128
   // Prevent GVARS to be off when imported or manually modified yaml
   // Since there is no way to have those back
@@ -158,7 +171,8 @@ static void sanitizeMixerLines()
   if (dirty) storageDirty(EE_MODEL);
 }
 
-void postModelLoad(bool alarms)
+// Fixes the model data loaded from a file
+static void sanitizeModel()
 {
 #if defined(COLORLCD)
   if (g_model.topbarWidgetWidth[0] == 0) {
@@ -243,7 +257,12 @@ if(g_model.rssiSource) {
   if (changed)
     storageDirty(EE_MODEL);
 #endif
+}
 
+// Resets the runtime state depending on the model (mixer, timers,
+// telemetry, ...)
+static void resetModelState()
+{
 #if defined(MULTIMODULE) && defined(MULTI_PROTOLIST)
   MultiRfProtocols::removeInstance(EXTERNAL_MODULE);
 #endif
@@ -251,6 +270,8 @@ if(g_model.rssiSource) {
   AUDIO_FLUSH();
   flightReset(false);
 
+  adcPipelineInvalidate();
+
   customFunctionsReset();
 
   logicalSwitchesInit(false);
@@ -270,6 +291,29 @@ if(g_model.rssiSource) {
 
   loadCurves();
   sanitizeMixerLines();
+}
+
+// Loads what is displayed / run along with the model
+static void loadModelResources()
+{
+  referenceModelAudioFiles();
+
+#if defined(COLORLCD)
+  LayoutFactory::loadCustomScreens();
+  ViewMain::instance()->show(true);
+#else
+  LOAD_MODEL_BITMAP();
+#endif
+
+  LUA_LOAD_MODEL_SCRIPTS();
+
+  SEND_FAILSAFE_1S();
+}
+
+void postModelLoad(bool alarms)
+{
+  sanitizeModel();
+  resetModelState();
 
 #if defined(GUI)
   if (alarms) {
@@ -285,18 +329,96 @@ if(g_model.rssiSource) {
     pulsesStart();
   }
 
-  referenceModelAudioFiles();
+  loadModelResources();
+}
+
+static bool isModuleRfConfigChanged(uint8_t module, const ModuleData& moduleData,
+                                    uint8_t modelId)
+{
+  return memcmp(&moduleData, &g_model.moduleData[module], sizeof(ModuleData)) ||
+         modelId != g_model.header.modelId[module];
+}
+
+void swapModel(const ModelData* model, bool alarms)
+{
+  if (!mixerTaskStarted()) {
+    // nothing to keep running
+    preModelLoad();
+    memcpy(&g_model, model, sizeof(g_model));
+    postModelLoad(alarms);
+    return;
+  }
+
+  watchdogSuspend(500/*5s*/);
+
+  logsClose();
 
 #if defined(COLORLCD)
-  LayoutFactory::loadCustomScreens();
-  ViewMain::instance()->show(true);
-#else
-  LOAD_MODEL_BITMAP();
+  LayoutFactory::deleteCustomScreens(true);
 #endif
 
-  LUA_LOAD_MODEL_SCRIPTS();
+  ModuleData moduleData[NUM_MODULES];
+  uint8_t modelId[NUM_MODULES];
+  memcpy(moduleData, g_model.moduleData, sizeof(moduleData));
+  memcpy(modelId, g_model.header.modelId, sizeof(modelId));
+#if defined(PXX2)
+  char registrationID[PXX2_LEN_REGISTRATION_ID];
+  memcpy(registrationID, g_model.modelRegistrationID, sizeof(registrationID));
+#endif
 
-  SEND_FAILSAFE_1S();
+  // the mixer runs either on the old or on the new model, never on a mix
+  // of both; the trainer mode is updated by the mixer if needed
+  mixerTaskLock();
+
+  memcpy(&g_model, model, sizeof(g_model));
+  sanitizeModel();
+  resetModelState();
+
+  uint8_t restartModules = 0;
+  for (uint8_t module = 0; module < NUM_MODULES; module++) {
+    bool changed = isModuleRfConfigChanged(module, moduleData[module], modelId[module]);
+#if defined(PXX2)
+    if (isModulePXX2(module) &&
+        memcmp(registrationID, g_model.modelRegistrationID, sizeof(registrationID)))
+      changed = true;
+#endif
+    if (changed) restartModules |= (1 << module);
+  }
+
+  bool warnings = false;
+#if defined(GUI)
+  if (alarms) {
+    uint16_t badPots;
+    warnings = (g_eeGeneral.chkSum == evalChkSum() && isThrottleWarningAlertNeeded()) ||
+               isSwitchWarningRequired(badPots);
+  }
+#endif
+
+  mixerTaskUnlock();
+
+  if (warnings) {
+    // the checks must pass before the new model outputs anything
+    pulsesStop();
+    checkAll();
+    PLAY_MODEL_NAME();
+    pulsesStart();
+  }
+  else {
+    for (uint8_t module = 0; module < NUM_MODULES; module++) {
+      if (restartModules & (1 << module)) {
+        TRACE("swapModel: restart module %d", module);
+        restartModuleAsync(module, 50);  // ~500ms
+      }
+    }
+#if defined(GUI)
+    if (alarms) {
+      checkAll();
+      PLAY_MODEL_NAME();
+    }
+#endif
+  }
+
+  loadModelResources();
 }
 
 void storageFlushCurrentModel()
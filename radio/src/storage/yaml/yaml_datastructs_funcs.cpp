@@ -2346,11 +2346,18 @@ static uint16_t getIdx(void *user)
   return tw->getElmts(1);
 }
 
+// model being read, which is not always g_model (see loadModel())
+static ModelData* getModel(void *user)
+{
+  auto tw = reinterpret_cast<YamlTreeWalker*>(user);
+  return reinterpret_cast<ModelData*>(tw->getData());
+}
+
 static void r_cfs_name(void* user, uint8_t* data, uint32_t bitoffs,
                          const char* val, uint8_t val_len)
 {
   uint16_t idx = getIdx(user);
-  strAppend(g_model.customSwitches[idx].name, val, LEN_SWITCH_NAME);
+  strAppend(getModel(user)->customSwitches[idx].name, val, LEN_SWITCH_NAME);
 }
 
 static const struct YamlNode struct_cfsNameConfig[] = {
@@ -2364,21 +2371,21 @@ static void r_cfs_on_color_r(void* user, uint8_t* data, uint32_t bitoffs,
                              const char* val, uint8_t val_len)
 {
   uint16_t idx = getIdx(user);
-  g_model.customSwitches[idx].onColor.r = yaml_str2uint(val, val_len);
+  getModel(user)->customSwitches[idx].onColor.r = yaml_str2uint(val, val_len);
 }
 
 static void r_cfs_on_color_g(void* user, uint8_t* data, uint32_t bitoffs,
                              const char* val, uint8_t val_len)
 {
   uint16_t idx = getIdx(user);
-  g_model.customSwitches[idx].onColor.g = yaml_str2uint(val, val_len);
+  getModel(user)->customSwitches[idx].onColor.g = yaml_str2uint(val, val_len);
 }
 
 static void r_cfs_on_color_b(void* user, uint8_t* data, uint32_t bitoffs,
                              const char* val, uint8_t val_len)
 {
   uint16_t idx = getIdx(user);
-  g_model.customSwitches[idx].onColor.b = yaml_str2uint(val, val_len);
+  getModel(user)->customSwitches[idx].onColor.b = yaml_str2uint(val, val_len);
 }
 
 static const struct YamlNode struct_cfsOnColorConfig[] = {
@@ -2393,21 +2400,21 @@ static void r_cfs_off_color_r(void* user, uint8_t* data, uint32_t bitoffs,
                              const char* val, uint8_t val_len)
 {
   uint16_t idx = getIdx(user);
-  g_model.customSwitches[idx].offColor.r = yaml_str2uint(val, val_len);
+  getModel(user)->customSwitches[idx].offColor.r = yaml_str2uint(val, val_len);
 }
 
 static void r_cfs_off_color_g(void* user, uint8_t* data, uint32_t bitoffs,
                              const char* val, uint8_t val_len)
 {
   uint16_t idx = getIdx(user);
-  g_model.customSwitches[idx].offColor.g = yaml_str2uint(val, val_len);
+  getModel(user)->customSwitches[idx].offColor.g = yaml_str2uint(val, val_len);
 }
 
 static void r_cfs_off_color_b(void* user, uint8_t* data, uint32_t bitoffs,
                              const char* val, uint8_t val_len)
 {
   uint16_t idx = getIdx(user);
-  g_model.customSwitches[idx].offColor.b = yaml_str2uint(val, val_len);
+  getModel(user)->customSwitches[idx].offColor.b = yaml_str2uint(val, val_len);
 }
 
 static const struct YamlNode struct_cfsOffColorConfig[] = {
@@ -2442,41 +2449,45 @@ static const struct YamlNode struct_cfsGroupOn[] {
 static void r_functionSwitchConfig(void* user, uint8_t* data, uint32_t bitoffs,
                         const char* val, uint8_t val_len)
 {
+  auto md = getModel(user);
   uint32_t v = yaml_str2uint(val, val_len);
   for (int i = 0; i < 6; i += 1) {
-    g_model.customSwitches[i].type = (SwitchConfig)bfGet<uint16_t>(v, 2 * i, 2);
+    md->customSwitches[i].type = (SwitchConfig)bfGet<uint16_t>(v, 2 * i, 2);
   }
 }
 
 static void r_functionSwitchStartConfig(void* user, uint8_t* data, uint32_t bitoffs,
                         const char* val, uint8_t val_len)
 {
+  auto md = getModel(user);
   uint32_t v = yaml_str2uint(val, val_len);
   for (int i = 0; i < 6; i += 1) {
     uint8_t b = bfGet<uint16_t>(v, 2 * i, 2);
     if (b < 2) b ^= 1;  // Swap On & Off
-    g_model.customSwitches[i].start = (fsStartPositionType)b;
+    md->customSwitches[i].start = (fsStartPositionType)b;
   }
 }
 
 static void r_functionSwitchGroup(void* user, uint8_t* data, uint32_t bitoffs,
                         const char* val, uint8_t val_len)
 {
+  auto md = getModel(user);
   uint32_t v = yaml_str2uint(val, val_len);
   for (int i = 0; i < 6; i += 1) {
-    g_model.customSwitches[i].group = bfGet<uint16_t>(v, 2 * i, 2);
+    md->customSwitches[i].group = bfGet<uint16_t>(v, 2 * i, 2);
   }
   for (int i = 0; i <= 3; i += 1) {
-    g_model.cfsSetGroupAlwaysOn(i, bfGet<uint16_t>(v, 2 * 6 + i, 1));
+    md->cfsSetGroupAlwaysOn(i, bfGet<uint16_t>(v, 2 * 6 + i, 1));
   }
 }
 
 static void r_functionSwitchLogicalState(void* user, uint8_t* data, uint32_t bitoffs,
                         const char* val, uint8_t val_len)
 {
+  auto md = getModel(user);
   uint32_t v = yaml_str2uint(val, val_len);
   for (int i = 0; i < 6; i += 1) {
-    g_model.customSwitches[i].state = bfGet<uint16_t>(v, 1 * i, 1);
+    md->customSwitches[i].state = bfGet<uint16_t>(v, 1 * i, 1);
   }
 }
 
@@ -115,6 +115,9 @@ public:
 
     void reset(const YamlNode* node, uint8_t* data);
 
+    // data passed to reset()
+    uint8_t* getData() { return data; }
+
     int getLevel() {
         return NODE_STACK_DEPTH - stack_level
             + virt_level - anon_union;
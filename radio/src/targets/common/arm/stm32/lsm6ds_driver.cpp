@@ -195,13 +195,38 @@
 #define LSM6DSLTR_ID                            0x6A
 #define LSM6DS33TR_ID                           0x69
 
+#define LSM6DS_FIFO_STATUS_SIZE                 4
+#define LSM6DS_FIFO_PATTERN_MASK                0x03ff
+#define LSM6DS_FIFO_NO_DECIMATION               0x09
+
+// FIFO rates (ODR_FIFO = index + 1)
+static constexpr uint16_t fifoRates[] = {13, 26, 52, 104, 208, 416, 833, 1666};
+
+static constexpr uint8_t fifoRateIndex(uint8_t i = 0)
+{
+  return (i == DIM(fifoRates) - 1 || fifoRates[i] >= IMU_SAMPLE_RATE)
+             ? i
+             : fifoRateIndex(i + 1);
+}
+
 static const char configure[][2] = {
   // ODR = 1000 (1.66 kHz (high performance)); FS_XL = 00 (+/-2 g full scale)
   {LSM6DS_ACCEL_ODR_ADDR, 0x80},
   // ODR = 1000 (1.66 kHz (high performance)); FS_XL = 00 (245 dps)
   {LSM6DS_GYRO_ODR_ADDR, 0x80},
   // IF_INC = 1 (automatically increment register address)
-  {LSM6DS_BDU_ADDR, 0x04}
+  {LSM6DS_BDU_ADDR, 0x04},
+  // gyro and accel in the FIFO (in this order), no decimation
+  {LSM6DS_FIFO_CTRL3_ADDR, LSM6DS_FIFO_NO_DECIMATION},
+  // FIFO continuous mode, at the rate closest to IMU_SAMPLE_RATE
+  {LSM6DS_FIFO_MODE_ADDR,
+   ((fifoRateIndex() + 1) << 3) | LSM6DS_FIFO_MODE_CONTINUOS},
+};
+
+static const ImuSensorInfo sensorInfo = {
+  fifoRates[fifoRateIndex()],
+  287,    // 245 dps setting: 8.75 mdps / LSB
+  16384,  // +/-2 g
 };
 
 #define I2C_TIMEOUT_MAX      10000
@@ -262,14 +287,52 @@ int gyroInit()
   return 0;
 }
 
-int gyroRead(uint8_t buffer[IMU_BUFFER_LENGTH])
+const ImuSensorInfo& gyroSensorInfo() { return sensorInfo; }
+
+int gyroReadSamples(int16_t samples[][IMU_VALUES_COUNT], uint8_t count)
 {
-  return I2C_LSM6DS_ReadRegister(LSM6DS_GYRO_OUT_X_L_ADDR, buffer, IMU_BUFFER_LENGTH);
+  uint8_t status[LSM6DS_FIFO_STATUS_SIZE];
+  if (I2C_LSM6DS_ReadRegister(LSM6DS_FIFO_DIFF_L, status, sizeof(status)) < 0)
+    return -1;
+
+  // unread 16-bit words, and position of the next one in the sample
+  uint16_t words = (status[0] | (status[1] << 8)) & LSM6DS_FIFO_DIFF_MASK;
+  uint16_t pattern = (status[2] | (status[3] << 8)) & LSM6DS_FIFO_PATTERN_MASK;
+
+  // FIFO_DATA_OUT reads roll over from _H to _L: the whole burst comes
+  // from the FIFO
+  if (pattern > 0 && pattern < IMU_VALUES_COUNT) {
+    // drop the end of an incomplete sample (FIFO overrun)
+    uint8_t skip = IMU_VALUES_COUNT - pattern;
+    if (words < skip) return 0;
+    int16_t dummy[IMU_VALUES_COUNT];
+    if (I2C_LSM6DS_ReadRegister(LSM6DS_FIFO_DATA_OUT_L, (uint8_t*)dummy,
+                                skip * sizeof(int16_t)) < 0)
+      return -1;
+    words -= skip;
+  }
+
+  uint16_t available = words / IMU_VALUES_COUNT;
+  if (available < count) count = available;
+  if (count > 255 / IMU_BUFFER_LENGTH) count = 255 / IMU_BUFFER_LENGTH;
+  if (count == 0) return 0;
+
+  if (I2C_LSM6DS_ReadRegister(LSM6DS_FIFO_DATA_OUT_L, (uint8_t*)samples,
+                              count * IMU_BUFFER_LENGTH) < 0)
+    return -1;
+
+  return count;
 }
 
 #else
 
+static const ImuSensorInfo sensorInfo = {IMU_SAMPLE_RATE, 2000, 4096};
+
 int gyroInit() { return -1; }
-int gyroRead(uint8_t buffer[IMU_BUFFER_LENGTH]) { return -1; }
+const ImuSensorInfo& gyroSensorInfo() { return sensorInfo; }
+int gyroReadSamples(int16_t samples[][IMU_VALUES_COUNT], uint8_t count)
+{
+  return -1;
+}
 
 #endif
@@ -20,28 +20,22 @@
  */
 
 #include "stm32_serial_driver.h"
+#include "fifo.h"
 #include <string.h>
 
-#define MIN(a, b) ((a) < (b) ? (a) : (b))
-
-// Serial buffer state
-struct stm32_buffer_state {
-  volatile uint32_t ridx;
-  volatile uint32_t widx;
-};
-
 struct stm32_send_buffer {
   volatile const uint8_t* buf;
   volatile uint32_t len;
 };
 
+// RX: filled by the USART IRQ, or by the DMA (in which case the write
+// index is synced from the DMA counter before reading).
+// TX: filled by the task, emptied by the USART IRQ.
 struct stm32_serial_state {
   const stm32_serial_port* sp;
-  stm32_buffer_state rx_buf;
-  union {
-    stm32_buffer_state tx_fifo;
-    stm32_send_buffer  tx_buf;
-  } u;
+  SpscRing<uint8_t> rx_fifo;
+  SpscRing<uint8_t> tx_fifo;
+  stm32_send_buffer tx_buf;
   etx_serial_callbacks_t callbacks;
 };
 
@@ -87,9 +81,13 @@ enum _STM32_USART {
 // allocated as needed: index does not correspond
 static stm32_serial_state _serial_states[STM32_MAX_UART_PORTS];
 
+static void stm32_serial_free_state(stm32_serial_state* st);
+
 void stm32_serial_init_driver()
 {
-  memset(_serial_states, 0, sizeof(_serial_states));
+  for (auto& st : _serial_states) {
+    stm32_serial_free_state(&st);
+  }
 }
 
 // Serial context to be used in callbacks
@@ -98,25 +96,13 @@ static volatile stm32_serial_state* _isr_state;
 
 static uint8_t _on_send_fifo(uint8_t* data)
 {
-  auto st = _isr_state;
-  auto& buf_st = st->u.tx_fifo;
-
-  if (buf_st.ridx == buf_st.widx)
-    return 0;
-
-  const auto& tx_buf = st->sp->tx_buffer;
-  auto buf = tx_buf.buffer;
-  *data = buf[buf_st.ridx];
-
-  auto buf_len = tx_buf.length;
-  buf_st.ridx = (buf_st.ridx + 1) & (buf_len - 1);
-
-  return 1;  
+  auto st = (stm32_serial_state*)_isr_state;
+  return st->tx_fifo.pop(*data) ? 1 : 0;
 }
 
 static uint8_t _on_send_single_buffer(uint8_t* data)
 {
-  auto sb = &_isr_state->u.tx_buf;
+  auto sb = &_isr_state->tx_buf;
   if (!sb->len) return 0;
 
   *data = *(sb->buf++);
@@ -211,7 +197,12 @@ static stm32_serial_state* stm32_serial_find_state(const stm32_usart_t* usart)
 
 static void stm32_serial_free_state(stm32_serial_state* st)
 {
-  memset(st, 0, sizeof(stm32_serial_state));
+  st->sp = nullptr;
+  st->rx_fifo.init(nullptr, 0);
+  st->tx_fifo.init(nullptr, 0);
+  st->tx_buf.buf = nullptr;
+  st->tx_buf.len = 0;
+  memset(&st->callbacks, 0, sizeof(st->callbacks));
 }
 
 static inline uint32_t _dma_get_data_length(DMA_TypeDef* DMAx, uint32_t stream)
@@ -223,39 +214,37 @@ static inline uint32_t _dma_get_data_length(DMA_TypeDef* DMAx, uint32_t stream)
 #endif
 }
 
-static inline void _dma_clear(stm32_buffer_state* buf_st, uint32_t length,
-                              DMA_TypeDef* DMAx, uint32_t stream)
+static inline uint32_t _dma_get_widx(const stm32_usart_t* usart,
+                                     uint32_t length)
 {
-  buf_st->ridx = length - _dma_get_data_length(DMAx, stream);
+  return length - _dma_get_data_length(usart->rxDMA, usart->rxDMA_Stream);
 }
 
-static inline void _fifo_clear(stm32_buffer_state* buf_st)
+static inline void _dma_clear(SpscRing<uint8_t>* fifo, uint32_t length,
+                              const stm32_usart_t* usart)
 {
-  buf_st->widx = buf_st->ridx = 0;
+  fifo->clear();
+  uint32_t widx = _dma_get_widx(usart, length);
+  fifo->setWriteIndex(widx);
+  fifo->commitRead(widx);
 }
 
-static inline bool _fifo_full(stm32_buffer_state* buf_st, uint32_t length)
+// When RX is done by DMA, publish the DMA write index
+// as if the DMA was the producer of the ring
+static inline void _rx_sync(stm32_serial_state* st)
 {
-  return ((buf_st->widx + 1) & (length - 1)) == buf_st->ridx;
-}
+  auto sp = st->sp;
+  auto usart = sp->usart;
+  if (!LL_USART_IsEnabledDMAReq_RX(usart->USARTx)) return;
 
-static inline void _fifo_push(uint8_t c, stm32_buffer_state* buf_st,
-                              uint32_t length, uint8_t* buf)
-{
-  buf[buf_st->widx] = c;
-  buf_st->widx = (buf_st->widx + 1) & (length - 1);
+  auto buf_len = sp->rx_buffer.length;
+  st->rx_fifo.setWriteIndex(_dma_get_widx(usart, buf_len));
 }
 
 static void _on_rx_fifo(uint8_t data)
 {
-  auto st = _isr_state;
-  stm32_buffer_state* buf_st = (stm32_buffer_state*)&st->rx_buf;
-
-  auto buf_len = st->sp->rx_buffer.length;
-  if (_fifo_full(buf_st, buf_len)) return;
-
-  auto buf = st->sp->rx_buffer.buffer;
-  _fifo_push(data, buf_st, buf_len, buf);
+  auto st = (stm32_serial_state*)_isr_state;
+  st->rx_fifo.push(data);
 }
 
 static void* stm32_serial_init(void* hw_def, const etx_serial_init* params)
@@ -279,6 +268,7 @@ static void* stm32_serial_init(void* hw_def, const etx_serial_init* params)
   if (params->direction & ETX_Dir_TX) {
     // prepare for send_byte()
     if (sp->tx_buffer.length > 0) {
+      st->tx_fifo.init(sp->tx_buffer.buffer, sp->tx_buffer.length);
       st->callbacks.on_send = _on_send_fifo;
     }
   }
@@ -287,13 +277,11 @@ static void* stm32_serial_init(void* hw_def, const etx_serial_init* params)
 
     auto rx_buf = sp->rx_buffer.buffer;
     auto buf_len = sp->rx_buffer.length;
+    st->rx_fifo.init(rx_buf, buf_len);
 
     if (usart->rxDMA) {
       stm32_usart_init_rx_dma(usart, rx_buf, buf_len);
-
-      auto dma = usart->rxDMA;
-      auto stream = usart->rxDMA_Stream;
-      _dma_clear(&st->rx_buf, buf_len, dma, stream);
+      _dma_clear(&st->rx_fifo, buf_len, usart);
     } else {
       st->callbacks.on_receive = _on_rx_fifo;
     }
@@ -321,15 +309,8 @@ static void stm32_serial_send_byte(void* ctx, uint8_t c)
   if (!st) return;
 
   auto sp = st->sp;
-  auto buf_len = sp->tx_buffer.length;
-  if (buf_len > 0) {
-  
-    auto buf_st = &st->u.tx_fifo;
-    auto buf = sp->tx_buffer.buffer;
-
-    if (_fifo_full(buf_st, buf_len)) return;
-    _fifo_push(c, buf_st, buf_len, buf);
-
+  if (sp->tx_buffer.length > 0) {
+    if (!st->tx_fifo.push(c)) return;
     stm32_usart_enable_tx_irq(sp->usart);
   } else {
     // No TX FIFO -> fall back to sync send
@@ -369,17 +350,16 @@ static void stm32_serial_send_buffer(void* ctx, const uint8_t* data, uint32_t si
 
   // no internal buffer: send one buffer at a time
   if (!sp->tx_buffer.length) {
-    st->u.tx_buf.buf = data;
-    st->u.tx_buf.len = size;
+    st->tx_buf.buf = data;
+    st->tx_buf.len = size;
     st->callbacks.on_send = _on_send_single_buffer;
     stm32_usart_enable_tx_irq(usart);
     return;
   }
 
-  // else stack single bytes into our internal buffer
-  while(size > 0) {
-    stm32_serial_send_byte(ctx, *data++);
-    size--;
+  // else copy into our internal buffer (what does not fit is dropped)
+  if (st->tx_fifo.push(data, size) > 0) {
+    stm32_usart_enable_tx_irq(usart);
   }
 }
 
@@ -411,32 +391,10 @@ static int stm32_serial_get_byte(void* ctx, uint8_t* data)
 {
   auto st = (stm32_serial_state*)ctx;
   if (!st) return -1;
+  if (!st->sp->rx_buffer.length) return -1;
 
-  auto sp = st->sp;
-  const auto& rx_buf = sp->rx_buffer;
-  auto buf_len = rx_buf.length;
-  if (!buf_len) return -1;
-  
-  auto buf = rx_buf.buffer;
-  auto& buf_st = st->rx_buf;
-
-  uint32_t widx;
-  auto usart = sp->usart;
-  if (LL_USART_IsEnabledDMAReq_RX(usart->USARTx)) {
-    auto dma = usart->rxDMA;
-    auto stream = usart->rxDMA_Stream;
-    widx = buf_len - _dma_get_data_length(dma, stream);
-  } else {
-    widx = buf_st.widx;
-  }
-
-  if (buf_st.ridx == widx)
-    return 0;
-
-  *data = buf[buf_st.ridx];
-  buf_st.ridx = (buf_st.ridx + 1) & (buf_len - 1);
-
-  return 1;
+  _rx_sync(st);
+  return st->rx_fifo.pop(*data) ? 1 : 0;
 }
 
 static int stm32_serial_get_last_byte(void* ctx, uint32_t idx, uint8_t* data)
@@ -448,25 +406,16 @@ static int stm32_serial_get_last_byte(void* ctx, uint32_t idx, uint8_t* data)
   const auto& rx_buf = sp->rx_buffer;
   auto buf_len = rx_buf.length;
   if (!buf_len) return -1;
-  
-  auto buf = rx_buf.buffer;
-  auto& buf_st = st->rx_buf;
 
-  uint32_t widx;
-  auto usart = sp->usart;
-  if (LL_USART_IsEnabledDMAReq_RX(usart->USARTx)) {
-    auto dma = usart->rxDMA;
-    auto stream = usart->rxDMA_Stream;
-    widx = buf_len - _dma_get_data_length(dma, stream);
-  } else {
-    widx = buf_st.widx;
-  }
+  _rx_sync(st);
+
+  uint32_t widx = st->rx_fifo.writeIndex();
 
   // Please note that we do not check the read cursor
   // so that this function might return data that
   // has already been read
   uint32_t ridx = (buf_len + widx - idx) & (buf_len - 1);
-  *data = buf[ridx];
+  *data = rx_buf.buffer[ridx];
 
   return 1;
 }
@@ -475,76 +424,20 @@ static int stm32_serial_get_buffered_bytes(void* ctx)
 {
   auto st = (stm32_serial_state*)ctx;
   if (!st) return -1;
+  if (!st->sp->rx_buffer.length) return -1;
 
-  auto sp = st->sp;
-  const auto& rx_buf = sp->rx_buffer;
-  auto buf_len = rx_buf.length;
-  if (!buf_len) return -1;
-
-  uint32_t widx;
-  auto usart = sp->usart;
-  const auto& buf_st = st->rx_buf;
-
-  if (LL_USART_IsEnabledDMAReq_RX(usart->USARTx)) {
-    auto dma = usart->rxDMA;
-    auto stream = usart->rxDMA_Stream;
-    widx = buf_len - _dma_get_data_length(dma, stream);
-  } else {
-    widx = buf_st.widx;
-  }
-
-  return (widx - buf_st.ridx) & (buf_len - 1);
-}
-
-static inline void _copy_buffer_chunk(const stm32_serial_buffer& rx_buf,
-                                      stm32_buffer_state& buf_st,
-                                      uint8_t* buf, uint32_t len)
-{
-  memcpy(buf, rx_buf.buffer + buf_st.ridx, len);
-  buf_st.ridx = (buf_st.ridx + len) & (rx_buf.length - 1);
+  _rx_sync(st);
+  return st->rx_fifo.size();
 }
 
 static int stm32_serial_copy_rx_buffer(void* ctx, uint8_t* buf, uint32_t len)
 {
   auto st = (stm32_serial_state*)ctx;
   if (!st) return -1;
+  if (!st->sp->rx_buffer.length) return -1;
 
-  auto sp = st->sp;
-  const auto& rx_buf = sp->rx_buffer;
-  auto buf_len = rx_buf.length;
-  if (!buf_len) return -1;
-
-  uint32_t widx;
-  auto usart = sp->usart;
-  auto& buf_st = st->rx_buf;
-
-  if (LL_USART_IsEnabledDMAReq_RX(usart->USARTx)) {
-    auto dma = usart->rxDMA;
-    auto stream = usart->rxDMA_Stream;
-    widx = buf_len - _dma_get_data_length(dma, stream);
-  } else {
-    widx = buf_st.widx;
-  }
-
-  if (buf_st.ridx == widx) return 0;
-
-  int res = 0;
-  if (buf_st.ridx > widx) {
-    auto cp_len = MIN(len, buf_len - buf_st.ridx);
-    _copy_buffer_chunk(rx_buf, buf_st, buf, cp_len);
-    buf += cp_len;
-    len -= cp_len;
-    res += cp_len;
-  }
-
-  if (buf_st.ridx < widx) {
-    auto cp_len = MIN(len, widx - buf_st.ridx);
-    _copy_buffer_chunk(rx_buf, buf_st, buf, cp_len);
-    len -= cp_len;
-    res += cp_len;
-  }
-
-  return res;
+  _rx_sync(st);
+  return st->rx_fifo.pop(buf, len);
 }
 
 static void stm32_serial_clear_rx_buffer(void* ctx)
@@ -553,15 +446,11 @@ static void stm32_serial_clear_rx_buffer(void* ctx)
   if (!st) return;
 
   auto sp = st->sp;
-  auto buf_st = &st->rx_buf;
   auto usart = sp->usart;
   if (usart->rxDMA) {
-    auto buf_len = sp->rx_buffer.length;
-    auto dma = usart->rxDMA;
-    auto stream = usart->rxDMA_Stream;
-    _dma_clear(buf_st, buf_len, dma, stream);
+    _dma_clear(&st->rx_fifo, sp->rx_buffer.length, usart);
   } else {
-    _fifo_clear(buf_st);
+    st->rx_fifo.clear();
   }
 }
 
@@ -24,6 +24,7 @@
 #include "stm32_timer.h"
 #include "stm32_gpio.h"
 #include "hal/gpio.h"
+#include "fifo.h"
 
 #include <string.h>
 
@@ -36,10 +37,7 @@ static uint8_t rxBitCount;
 static uint8_t rxByte;
 
 // RX FIFO
-static volatile uint8_t rxRidx;
-static volatile uint8_t rxWidx;
-static uint8_t *rxBuffer;
-static uint32_t rxBufLen;
+static SpscRing<uint8_t> rxFifo;
 
 static const stm32_softserial_rx_port* _softserialPort;
 
@@ -63,12 +61,6 @@ static void _softserial_exti()
   }
 }
 
-static inline void _rx_fifo_clear()
-{
-  rxWidx = 0;
-  rxRidx = 0;
-}
-
 static bool _softserial_init_rx(const stm32_softserial_rx_port* port,
                                 const etx_serial_init* params)
 {
@@ -76,9 +68,7 @@ static bool _softserial_init_rx(const stm32_softserial_rx_port* port,
   if(gpio_get_mode(port->GPIO) != GPIO_IN) return false;
 
   rxBitCount = 0;
-  rxBuffer = port->buffer.buffer;
-  rxBufLen = port->buffer.length;
-  _rx_fifo_clear();
+  rxFifo.init(port->buffer.buffer, port->buffer.length);
   
   // configure bit sample timer
   LL_TIM_InitTypeDef timInit;
@@ -161,25 +151,9 @@ static void stm32_softserial_rx_deinit(void* ctx)
   _softserialPort = nullptr;
 }
 
-static inline bool _rx_fifo_full()
-{
-  return ((rxWidx + 1) & (rxBufLen - 1)) == rxRidx;
-}
-
-static inline void _rx_fifo_push(uint8_t c)
-{
-  rxBuffer[rxWidx] = c;
-  rxWidx = (rxWidx + 1) & (rxBufLen - 1);
-}
-
 static int stm32_softserial_rx_get_byte(void* ctx, uint8_t* data)
 {
-  if (rxWidx == rxRidx) return 0;
-
-  *data = rxBuffer[rxRidx];
-  rxRidx = (rxRidx + 1) & (rxBufLen - 1);
-  
-  return 1;
+  return rxFifo.pop(*data) ? 1 : 0;
 }
 
 void stm32_softserial_rx_timer_isr(const stm32_softserial_rx_port* port)
@@ -203,7 +177,7 @@ void stm32_softserial_rx_timer_isr(const stm32_softserial_rx_port* port)
   }
   else if (rxBitCount == 8) {
 
-    if (!_rx_fifo_full()) _rx_fifo_push(rxByte);
+    rxFifo.push(rxByte);
     rxBitCount = 0;
 
     // disable timer
@@ -216,8 +190,7 @@ void stm32_softserial_rx_timer_isr(const stm32_softserial_rx_port* port)
 
 static void stm32_softserial_rx_clear_rx_buffer(void* ctx)
 {
-  rxWidx = 0;
-  rxRidx = 0;
+  rxFifo.clear();
 }
 
 const etx_serial_driver_t STM32SoftSerialRxDriver = {
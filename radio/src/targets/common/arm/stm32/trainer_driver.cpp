@@ -29,6 +29,7 @@
 
 #include "edgetx.h"
 #include "trainer.h"
+#include "timers_driver.h"
 
 static void (*_trainer_timer_isr)();
 static const stm32_pulse_timer_t* _trainer_timer;
@@ -77,32 +78,44 @@ static inline bool trainer_check_isr_flag(const stm32_pulse_timer_t* tim)
 static inline void capture_pulse(uint16_t capture)
 {
   static uint16_t lastCapt = 0;
-  static uint8_t channel = MAX_TRAINER_CHANNELS;
+  static uint8_t channel = 0;
+  static bool valid = false;
+  static int16_t channels[MAX_TRAINER_CHANNELS];
 
   uint16_t val = (uint16_t)(capture - lastCapt) / 2;
   lastCapt = capture;
 
   if (val > 4000 && val < 19000) {
-    // blanking period in [4..19] milliseconds
+    // blanking period in [4..19] milliseconds: previous frame complete
+    // (its channels are already published, only the frame is accounted)
+    if (valid && channel > 0) {
+      trainerPushChannels(TRAINER_SOURCE_PPM, 0, channels, channel,
+                          timersGetMsTick());
+    }
     channel = 0;
+    valid = true;
     return;
   }
 
-  if (channel >= MAX_TRAINER_CHANNELS) {
+  if (!valid || channel >= MAX_TRAINER_CHANNELS) {
     return;
   }
 
   if (val < 800 || val > 2200) {
-    // invalid pulse width
-    channel = MAX_TRAINER_CHANNELS;
+    // invalid pulse width: drop the rest of the frame
+    valid = false;
+    trainerFrameLost(TRAINER_SOURCE_PPM);
     return;
   }
-  
-  trainerInput[channel++] =
-    // +-500 != 512, but close enough.
-    (int16_t)(val - 1500) * (g_eeGeneral.PPM_Multiplier + 10) / 10;
 
-  trainerResetTimer();
+  // +-500 != 512, but close enough.
+  channels[channel] =
+      (int16_t)(val - 1500) * (g_eeGeneral.PPM_Multiplier + 10) / 10;
+
+  // published at once: waiting for the sync gap would add a frame of latency
+  trainerPushChannel(TRAINER_SOURCE_PPM, channel, channels[channel],
+                     timersGetMsTick());
+  channel++;
 }
 
 static void trainer_in_isr()
@@ -287,8 +287,21 @@ void usbJoystickUpdate()
    }
    USBD_HID_SendReport(&hUsbDevice, HID_Buffer, HID_IN_PACKET);
 #else
+  static bool configured = false;
   usbReport_t ret = usbReport();
-  USBD_HID_SendReport(&hUsbDevice, ret.ptr, ret.size);
+
+  if (hUsbDevice.dev_state != USBD_STATE_CONFIGURED) {
+    configured = false;
+    return;
+  }
+
+  // unchanged reports are not sent again: the host keeps the last state
+  // (until the device is configured again)
+  if ((usbReportPending() || !configured) &&
+      USBD_HID_SendReport(&hUsbDevice, ret.ptr, ret.size) == USBD_OK) {
+    usbReportSent();
+    configured = true;
+  }
 #endif
 }
 #endif
@@ -25,6 +25,8 @@ extern "C" {
 #include "usb_conf.h"
 #include "usbd_cdc.h"
 
+#include <string.h>
+
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
@@ -338,6 +340,27 @@ void usbSerialPutc(void*, uint8_t c)
   if (!prim) __enable_irq();
 }
 
+// Copies the whole buffer into the TX ring, or drops it if it does not fit,
+// so that framed protocols never see a truncated frame
+static void usbSerialSendBuffer(void*, const uint8_t* data, uint32_t size)
+{
+  if (!cdcConnected) return;
+
+  uint32_t prim = __get_PRIMASK();
+  __disable_irq();
+
+  if (size <= usbSerialFreeSpace()) {
+    uint32_t idx = APP_Tx_ptr_in;
+    uint32_t len = APP_TX_DATA_SIZE - idx;
+    if (len > size) len = size;
+    memcpy(&UserTxBufferFS[idx], data, len);
+    memcpy(UserTxBufferFS, data + len, size - len);
+    APP_Tx_ptr_in = (idx + size) % APP_TX_DATA_SIZE;
+  }
+
+  if (!prim) __enable_irq();
+}
+
 /**
   * @brief  Data received over USB OUT endpoint are sent over CDC interface
   *         through this function.
@@ -401,7 +424,7 @@ static const etx_serial_driver_t usbSerialDriver = {
   .init = usbSerialInit,
   .deinit = nullptr,
   .sendByte = usbSerialPutc,
-  .sendBuffer = nullptr,
+  .sendBuffer = usbSerialSendBuffer,
   .waitForTxCompleted = nullptr,
   .getByte = nullptr,
   .clearRxBuffer = nullptr,
@@ -21,5 +21,8 @@
 
 #include "gyro.h"
 
+static const ImuSensorInfo sensorInfo = {IMU_SAMPLE_RATE, 2000, 4096};
+
 int gyroInit() { return -1; }
-int gyroRead(uint8_t*) { return -1; }
+const ImuSensorInfo& gyroSensorInfo() { return sensorInfo; }
+int gyroReadSamples(int16_t[][IMU_VALUES_COUNT], uint8_t) { return -1; }
@@ -0,0 +1,320 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+/*
+  Headless simulator
+
+  Runs the firmware on the virtual clock (see os/time_native.h): the
+  mixer, 10ms and telemetry timers advance deterministically, as fast as
+  the CPU allows. Inputs are played from a trace file, channel outputs and
+  firmware traces are dumped to files, so that runs can be diffed.
+
+  Trace file, one event per line ('#' starts a comment):
+
+    <time ms> ana <index> <value>          analog input, -1024..1024
+    <time ms> sw <index> <state>           switch, -1 / 0 / 1
+    <time ms> key <index> <0|1>
+    <time ms> trim <index> <0|1>           trim switch
+    <time ms> telem <module> <proto> <hex bytes...>
+                                           proto: sport, crsf, hub
+    <time ms> model <filename>             loads a model
+
+  Events are applied between two clock steps, while every task sleeps
+  (model loads are deferred to the timer task).
+*/
+
+#include "simpgmspace.h"
+#include "simuaudio.h"
+
+#include "hal/adc_driver.h"
+#include "os/async.h"
+#include "os/time.h"
+#include "telemetry/crossfire.h"
+#include "telemetry/frsky.h"
+
+#include "edgetx.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct TraceEvent {
+  uint32_t time;
+  std::string cmd;
+  std::vector<std::string> args;
+};
+
+static int16_t analogs[MAX_ANALOG_INPUTS];
+static FILE* logFile = nullptr;
+static char modelFilename[LEN_MODEL_FILENAME + 1];
+
+uint16_t simu_get_analog(uint8_t idx)
+{
+  return idx < DIM(analogs) ? analogs[idx] * 2 + 2048 : 0;
+}
+
+static void traceToFile(const char* text)
+{
+  if (logFile) fputs(text, logFile);
+}
+
+static bool loadTrace(const char* path, std::vector<TraceEvent>& events)
+{
+  std::ifstream file(path);
+  if (!file) {
+    fprintf(stderr, "Cannot open trace %s\n", path);
+    return false;
+  }
+
+  std::string line;
+  unsigned lineno = 0;
+  while (std::getline(file, line)) {
+    lineno++;
+    auto comment = line.find('#');
+    if (comment != std::string::npos) line.erase(comment);
+
+    std::istringstream fields(line);
+    TraceEvent event;
+    if (!(fields >> event.time)) {
+      if (fields.eof()) continue;  // blank line
+      fprintf(stderr, "%s:%u: invalid time\n", path, lineno);
+      return false;
+    }
+    if (!(fields >> event.cmd)) {
+      fprintf(stderr, "%s:%u: missing command\n", path, lineno);
+      return false;
+    }
+    std::string arg;
+    while (fields >> arg) event.args.push_back(arg);
+    events.push_back(event);
+  }
+
+  // stable: events at the same time keep the file order
+  std::stable_sort(events.begin(), events.end(),
+                   [](const TraceEvent& a, const TraceEvent& b) {
+                     return a.time < b.time;
+                   });
+  return true;
+}
+
+static bool sendTelemetry(const TraceEvent& event)
+{
+  if (event.args.size() < 3) return false;
+
+  uint8_t module = atoi(event.args[0].c_str());
+  const std::string& protocol = event.args[1];
+
+  uint8_t data[TELEMETRY_RX_PACKET_SIZE];
+  uint8_t len = 0;
+  for (size_t i = 2; i < event.args.size() && len < sizeof(data); i++) {
+    data[len++] = strtoul(event.args[i].c_str(), nullptr, 16);
+  }
+
+  if (protocol == "sport") {
+    sportProcessTelemetryPacket(module, data, len);
+  } else if (protocol == "crsf") {
+    processCrossfireTelemetryFrame(module, data, len);
+  } else if (protocol == "hub") {
+    frskyDProcessPacket(module, data, len);
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// Loading a model sleeps: it cannot run on the thread driving the clock
+static void loadModelAsync(void*, uint32_t)
+{
+  if (loadModel(modelFilename, false) != nullptr) {
+    fprintf(stderr, "Cannot load model %s\n", modelFilename);
+  }
+}
+
+static bool playEvent(const TraceEvent& event)
+{
+  auto arg = [&](unsigned i) { return atoi(event.args[i].c_str()); };
+
+  if (event.cmd == "telem") return sendTelemetry(event);
+
+  if (event.cmd == "model" && event.args.size() == 1) {
+    strncpy(modelFilename, event.args[0].c_str(), LEN_MODEL_FILENAME);
+    modelFilename[LEN_MODEL_FILENAME] = '\0';
+    return async_call(loadModelAsync, nullptr, nullptr, 0);
+  }
+
+  if (event.args.size() != 2) return false;
+
+  if (event.cmd == "ana") {
+    if ((unsigned)arg(0) >= DIM(analogs)) return false;
+    analogs[arg(0)] = limit(-1024, arg(1), 1024);
+  } else if (event.cmd == "sw") {
+    simuSetSwitch(arg(0), arg(1));
+  } else if (event.cmd == "key") {
+    if ((unsigned)arg(0) >= MAX_KEYS) return false;
+    simuSetKey(arg(0), arg(1));
+  } else if (event.cmd == "trim") {
+    if ((unsigned)arg(0) >= MAX_TRIMS * 2) return false;
+    simuSetTrim(arg(0), arg(1));
+  } else {
+    return false;
+  }
+  return true;
+}
+
+static void dumpChannels(FILE* f, uint32_t time)
+{
+  fprintf(f, "%u", time);
+  for (int i = 0; i < MAX_OUTPUT_CHANNELS; i++) {
+    fprintf(f, ",%d", channelOutputs[i]);
+  }
+  fputc('\n', f);
+}
+
+static void printUsage(const char* progname)
+{
+  printf("usage: %s [options]\n\n", progname);
+  printf("  --storage path      SD card path\n");
+  printf("  --settings path     settings path (RADIO & MODELS)\n");
+  printf("  --trace file        input trace to play\n");
+  printf("  --duration ms       virtual time to run (default: end of trace + 1s)\n");
+  printf("  --model file        model to load on start\n");
+  printf("  --channels file     channel outputs dump (CSV)\n");
+  printf("  --period ms         channel outputs dump period (default: 10)\n");
+  printf("  --log file          firmware traces dump\n");
+  printf("  -h, --help          show this help message\n");
+}
+
+int main(int argc, char* argv[])
+{
+  const char* storagePath = "";
+  const char* settingsPath = "";
+  const char* tracePath = nullptr;
+  const char* channelsPath = nullptr;
+  const char* logPath = nullptr;
+  const char* model = nullptr;
+  long duration = -1;
+  long period = 10;
+
+  for (int i = 1; i < argc; i++) {
+    std::string opt = argv[i];
+    if (opt == "-h" || opt == "--help") {
+      printUsage(argv[0]);
+      return 0;
+    }
+    if (i + 1 >= argc) {
+      printUsage(argv[0]);
+      return 1;
+    }
+    const char* value = argv[++i];
+    if (opt == "--storage") storagePath = value;
+    else if (opt == "--settings") settingsPath = value;
+    else if (opt == "--trace") tracePath = value;
+    else if (opt == "--channels") channelsPath = value;
+    else if (opt == "--log") logPath = value;
+    else if (opt == "--model") model = value;
+    else if (opt == "--duration") duration = strtol(value, nullptr, 10);
+    else if (opt == "--period") period = strtol(value, nullptr, 10);
+    else {
+      printf("Unknown option: %s\n", opt.c_str());
+      printUsage(argv[0]);
+      return 1;
+    }
+  }
+
+  if (period <= 0) {
+    printf("--period requires a positive integer\n");
+    return 1;
+  }
+
+  std::vector<TraceEvent> events;
+  if (model) events.push_back(TraceEvent{0, "model", {model}});
+  if (tracePath && !loadTrace(tracePath, events)) return 1;
+
+  if (duration < 0) {
+    duration = (events.empty() ? 0 : events.back().time) + 1000;
+  }
+
+  FILE* channelsFile = nullptr;
+  if (channelsPath) {
+    channelsFile = fopen(channelsPath, "w");
+    if (!channelsFile) {
+      fprintf(stderr, "Cannot create %s\n", channelsPath);
+      return 1;
+    }
+    fprintf(channelsFile, "time");
+    for (int i = 0; i < MAX_OUTPUT_CHANNELS; i++) {
+      fprintf(channelsFile, ",CH%d", i + 1);
+    }
+    fputc('\n', channelsFile);
+  }
+
+  if (logPath) {
+    logFile = fopen(logPath, "w");
+    if (!logFile) {
+      fprintf(stderr, "Cannot create %s\n", logPath);
+      return 1;
+    }
+    traceCallback = traceToFile;
+  }
+
+  // must be enabled before any task or timer is created
+  time_virtual_enable();
+
+  simuInit();
+  simuStart(false, storagePath, settingsPath);
+
+  int result = 0;
+  auto next = events.begin();
+  for (uint32_t now = 0; now <= (uint32_t)duration; now++) {
+    if (now > 0) time_virtual_advance(1);
+    else time_virtual_advance(0);
+
+    for (; next != events.end() && next->time <= now; ++next) {
+      if (!playEvent(*next)) {
+        fprintf(stderr, "%u ms: invalid event '%s'\n", next->time,
+                next->cmd.c_str());
+        result = 1;
+      }
+    }
+
+    if (channelsFile && now % period == 0) {
+      dumpChannels(channelsFile, now);
+    }
+  }
+
+  simuStop();
+
+  if (time_virtual_stalls() > 0) {
+    fprintf(stderr, "Virtual clock stalled %u times, the run is not deterministic\n",
+            time_virtual_stalls());
+    result = 1;
+  }
+
+  traceCallback = nullptr;
+  if (logFile) fclose(logFile);
+  if (channelsFile) fclose(channelsFile);
+
+  return result;
+}
@@ -27,6 +27,8 @@
 #include "serial.h"
 #include "myeeprom.h"
 
+#include "simu_outputs.h"
+
 #include "hal/adc_driver.h"
 #include "hal/rotary_encoder.h"
 #include "os/time.h"
@@ -39,8 +41,6 @@
   #define MAX_LOGICAL_SWITCHES    NUM_CSW
 #endif
 
-#define GET_SWITCH_BOOL(sw__)    getSwitch((sw__), 0);
-
 #define ETXS_DBG    qDebug() << "(" << simuTimerMicros() << "us)"
 
 int16_t g_anas[MAX_ANALOG_INPUTS];
@@ -188,6 +188,17 @@ OpenTxSimulator::OpenTxSimulator() :
   tracebackDevices.clear();
   traceCallback = firmwareTraceCb;
 
+  // Outputs snapshot, shared with external tools (read-only for them).
+  // Falls back to the internal snapshot if another simulator of the same
+  // flavour already owns the segment.
+  m_outputsShm.setNativeKey(QString("edgetx-%1-outputs").arg(SIMULATOR_FLAVOUR));
+  if (m_outputsShm.create(sizeof(SimuOutputsSnapshot))) {
+    simuOutputsSetStorage(m_outputsShm.data());
+  }
+  else {
+    ETXS_DBG << "outputs snapshot not shared:" << m_outputsShm.errorString();
+  }
+
   // When we create the simulator, we change the UART driver
   for (int i = 0; i < MAX_AUX_SERIAL; i++) {
     etx_serial_port_t * port = serialPorts[i];
@@ -222,6 +233,9 @@ OpenTxSimulator::~OpenTxSimulator()
     while (isRunning() && !tmout.hasExpired(1000))
       ;
   }
+
+  simuOutputsSetStorage(nullptr);
+  m_outputsShm.detach();
   //qDebug() << "Deleting OpenTxSimulator";
 }
 
@@ -798,78 +812,86 @@ void OpenTxSimulator::checkFuncSwitchChanged()
 #endif
 }
 
-void OpenTxSimulator::checkOutputsChanged()
+bool OpenTxSimulator::getOutputs(TxOutputs & outputs, quint32 & serial)
 {
-  static TxOutputs lastOutputs;
-  static size_t chansDim = DIM(channelOutputs);
   const static int16_t limit = 512 * 2;
-  qint32 tmpVal;
-  uint8_t i, idx;
-  const uint8_t phase = getFlightMode();  // edgetx.cpp
-
-  for (i=0; i < chansDim; i++) {
-    if (lastOutputs.chans[i] != channelOutputs[i] || m_resetOutputsData) {
-      emit channelOutValueChange(i, channelOutputs[i], (g_model.extendedLimits ? limit * LIMIT_EXT_PERCENT / 100 : limit));
-      emit outputValueChange(OUTPUT_SRC_CHAN_OUT, i, channelOutputs[i]);
-      lastOutputs.chans[i] = channelOutputs[i];
-    }
-    if (lastOutputs.ex_chans[i] != ex_chans[i] || m_resetOutputsData) {
-      emit channelMixValueChange(i, ex_chans[i], limit * 2);
-      emit outputValueChange(OUTPUT_SRC_CHAN_MIX, i, ex_chans[i]);
-      lastOutputs.ex_chans[i] = ex_chans[i];
-    }
-  }
+  SimuOutputs local;
 
-  for (i=0; i < MAX_LOGICAL_SWITCHES; i++) {
-    tmpVal = (qint32)GET_SWITCH_BOOL(SWSRC_FIRST_LOGICAL_SWITCH+i);
-    if (lastOutputs.vsw[i] != (bool)tmpVal || m_resetOutputsData) {
-      emit virtualSwValueChange(i, tmpVal);
-      emit outputValueChange(OUTPUT_SRC_VIRTUAL_SW, i, tmpVal);
-      lastOutputs.vsw[i] = tmpVal;
-    }
-  }
+  uint32_t count;
+  if (!simuOutputsRead(local, count))
+    return false;
+  serial = count;
 
-  for (i=0; i < Board::TRIM_AXIS_COUNT; i++) {
-    idx = inputMappingConvertMode(i);
-    tmpVal = getTrimValue(getTrimFlightMode(phase, idx), idx);
-    if (lastOutputs.trims[i] != tmpVal || m_resetOutputsData) {
-      emit trimValueChange(i, tmpVal);
-      emit outputValueChange(OUTPUT_SRC_TRIM_VALUE, i, tmpVal);
-      lastOutputs.trims[i] = tmpVal;
-    }
+  outputs.clear();
+
+  const unsigned chans = qMin<unsigned>(CPN_MAX_CHNOUT, MAX_OUTPUT_CHANNELS);
+  for (unsigned i = 0; i < chans; i++) {
+    outputs.chans[i] = local.chans[i];
+    outputs.ex_chans[i] = local.ex_chans[i];
   }
+  outputs.chansLimit = local.extendedLimits ? limit * LIMIT_EXT_PERCENT / 100 : limit;
+  outputs.mixesLimit = limit * 2;
 
-  tmpVal = g_model.extendedTrims ? TRIM_EXTENDED_MAX : TRIM_MAX;
-  if (lastOutputs.trimRange != tmpVal || m_resetOutputsData) {
-    emit trimRangeChange(Board::TRIM_AXIS_COUNT, -tmpVal, tmpVal);
-    emit outputValueChange(OUTPUT_SRC_TRIM_RANGE, Board::TRIM_AXIS_COUNT, tmpVal);
-    lastOutputs.trimRange = tmpVal;
+  const unsigned lsw = qMin<unsigned>(CPN_MAX_LOGICAL_SWITCHES, MAX_LOGICAL_SWITCHES);
+  for (unsigned i = 0; i < lsw; i++) {
+    outputs.vsw[i] = simuOutputsLsw(local, i);
   }
 
-  if (lastOutputs.phase != phase || m_resetOutputsData) {
-    emit phaseChanged(phase, getCurrentPhaseName());
-    emit outputValueChange(OUTPUT_SRC_PHASE, 0, qint16(phase));
-    lastOutputs.phase = phase;
+  for (unsigned i = 0; i < Board::TRIM_AXIS_COUNT && i < MAX_TRIMS; i++) {
+    outputs.trims[i] = local.trims[inputMappingConvertMode(i)];
   }
+  outputs.trimRange = local.extendedTrims ? TRIM_EXTENDED_MAX : TRIM_MAX;
+  outputs.phase = local.phase;
 
 #if defined(GVAR_VALUE) && defined(GVARS)
   gVarMode_t gvar;
-  for (uint8_t gv=0; gv < MAX_GVARS; gv++) {
-    gvar.prec = g_model.gvars[gv].prec;
-    gvar.unit = g_model.gvars[gv].unit;
-    for (uint8_t fm=0; fm < MAX_FLIGHT_MODES; fm++) {
+  for (uint8_t gv = 0; gv < MAX_GVARS && gv < CPN_MAX_GVARS; gv++) {
+    gvar.prec = local.gvarsPrec[gv];
+    gvar.unit = local.gvarsUnit[gv];
+    for (uint8_t fm = 0; fm < MAX_FLIGHT_MODES && fm < CPN_MAX_FLIGHT_MODES; fm++) {
       gvar.mode = fm;
-      gvar.value = (int16_t)GVAR_VALUE(gv, getGVarFlightMode(fm, gv));
-      tmpVal = gvar;
-      if (lastOutputs.gvars[fm][gv] != tmpVal || m_resetOutputsData) {
-        lastOutputs.gvars[fm][gv] = tmpVal;
-        emit gVarValueChange(gv, tmpVal);
-        emit outputValueChange(OUTPUT_SRC_GVAR, gv, tmpVal);
-      }
+      gvar.value = local.gvars[fm][gv];
+      outputs.gvars[fm][gv] = gvar;
     }
   }
 #endif
 
+  return true;
+}
+
+// Channels, logical switches and GVARs are read from the snapshot by the
+// outputs widget, only the values displayed by the radio widgets (trims,
+// flight mode) are still signalled
+void OpenTxSimulator::checkOutputsChanged()
+{
+  static TxOutputs lastOutputs;
+  static quint32 lastSerial = 0;
+  TxOutputs outputs;
+  quint32 serial;
+
+  if (!getOutputs(outputs, serial))
+    return;
+  if (serial == lastSerial && !m_resetOutputsData)
+    return;
+  lastSerial = serial;
+
+  for (uint8_t i = 0; i < Board::TRIM_AXIS_COUNT; i++) {
+    if (lastOutputs.trims[i] != outputs.trims[i] || m_resetOutputsData) {
+      emit trimValueChange(i, outputs.trims[i]);
+      lastOutputs.trims[i] = outputs.trims[i];
+    }
+  }
+
+  if (lastOutputs.trimRange != outputs.trimRange || m_resetOutputsData) {
+    emit trimRangeChange(Board::TRIM_AXIS_COUNT, -outputs.trimRange, outputs.trimRange);
+    lastOutputs.trimRange = outputs.trimRange;
+  }
+
+  if (lastOutputs.phase != outputs.phase || m_resetOutputsData) {
+    emit phaseChanged(outputs.phase, getCurrentPhaseName());
+    lastOutputs.phase = outputs.phase;
+  }
+
   m_resetOutputsData = false;
 }
 
@@ -26,6 +26,7 @@
 
 #include <QMutex>
 #include <QObject>
+#include <QSharedMemory>
 #include <QTimer>
 
 #if defined __GNUC__
@@ -56,6 +57,7 @@ class DLLEXPORT OpenTxSimulator : public SimulatorInterface
     virtual uint8_t getSensorInstance(uint16_t id, uint8_t defaultValue = 0);
     virtual uint16_t getSensorRatio(uint16_t id);
     virtual const int getCapability(Capability cap);
+    virtual bool getOutputs(TxOutputs & outputs, quint32 & serial);
 
     static QVector<QIODevice *> tracebackDevices;
 
@@ -116,6 +118,7 @@ class DLLEXPORT OpenTxSimulator : public SimulatorInterface
     QMutex m_mtxRadioData;
     QMutex m_mtxSettings;
     QMutex m_mtxTbDevices;
+    QSharedMemory m_outputsShm;
     int volumeGain;
     bool m_resetOutputsData;
     bool m_stopRequested;
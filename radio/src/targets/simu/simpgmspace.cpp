@@ -32,6 +32,7 @@
 
 #include "os/sleep.h"
 #include "os/task.h"
+#include "os/time.h"
 #include "os/timer_native_impl.h"
 
 #include <errno.h>
@@ -69,6 +70,8 @@ void lcdCopy(void * dest, void * src);
 
 uint64_t simuTimerMicros(void)
 {
+  if (time_is_virtual()) return time_virtual_us();
+
   auto now = std::chrono::steady_clock::now();
   return (uint64_t) std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
 }
@@ -31,6 +31,7 @@
 
 #define __disable_irq()
 #define __enable_irq()
+#define __get_PRIMASK()   0
 
 extern char * main_thread_error;
 
@@ -45,6 +46,8 @@ void simuInit();
 void simuStart(bool tests = true, const char * sdPath = nullptr, const char * settingsPath = nullptr);
 void simuStop();
 bool simuIsRunning();
+// see simu_outputs.h
+void simuOutputsUpdate();
 void startEepromThread(const char * filename = "eeprom.bin");
 void stopEepromThread();
 #endif
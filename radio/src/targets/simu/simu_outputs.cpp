@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "simu_outputs.h"
+#include "edgetx.h"
+
+#include <new>
+
+#define SIMU_OUTPUTS_READ_RETRIES  8
+
+static SimuOutputsSnapshot localSnapshot;
+static SimuOutputsSnapshot* snapshot = nullptr;
+
+static SimuOutputsSnapshot* initSnapshot(void* mem)
+{
+  auto s = new (mem) SimuOutputsSnapshot();
+  s->magic = SIMU_OUTPUTS_MAGIC;
+  s->version = SIMU_OUTPUTS_VERSION;
+  s->size = sizeof(SimuOutputs);
+  s->count = 0;
+  s->buffers[0].seq = 0;
+  s->buffers[1].seq = 0;
+  return s;
+}
+
+static SimuOutputsSnapshot* getSnapshot()
+{
+  if (!snapshot) snapshot = initSnapshot(&localSnapshot);
+  return snapshot;
+}
+
+void simuOutputsSetStorage(void* mem)
+{
+  snapshot = initSnapshot(mem ? mem : &localSnapshot);
+}
+
+static void collectOutputs(SimuOutputs& outputs)
+{
+  memclear(&outputs, sizeof(outputs));
+
+  memcpy(outputs.chans, channelOutputs, sizeof(outputs.chans));
+  memcpy(outputs.ex_chans, ex_chans, sizeof(outputs.ex_chans));
+
+  uint8_t phase = getFlightMode();
+  outputs.phase = phase;
+  outputs.extendedLimits = g_model.extendedLimits;
+  outputs.extendedTrims = g_model.extendedTrims;
+
+  for (uint8_t i = 0; i < keysGetMaxTrims(); i++) {
+    outputs.trims[i] = getTrimValue(getTrimFlightMode(phase, i), i);
+  }
+
+  for (uint8_t i = 0; i < MAX_LOGICAL_SWITCHES; i++) {
+    if (getSwitch(SWSRC_FIRST_LOGICAL_SWITCH + i)) {
+      outputs.lsw[i / 8] |= 1 << (i % 8);
+    }
+  }
+
+#if defined(GVARS)
+  for (uint8_t gv = 0; gv < MAX_GVARS; gv++) {
+    outputs.gvarsPrec[gv] = g_model.gvars[gv].prec;
+    outputs.gvarsUnit[gv] = g_model.gvars[gv].unit;
+    for (uint8_t fm = 0; fm < MAX_FLIGHT_MODES; fm++) {
+      outputs.gvars[fm][gv] = GVAR_VALUE(gv, getGVarFlightMode(fm, gv));
+    }
+  }
+#endif
+}
+
+void simuOutputsUpdate()
+{
+  SimuOutputs outputs;
+  collectOutputs(outputs);
+
+  auto s = getSnapshot();
+  uint32_t count = s->count.load(std::memory_order_relaxed);
+  SimuOutputsBuffer& buffer = s->buffers[(count + 1) & 1];
+
+  uint32_t seq = buffer.seq.load(std::memory_order_relaxed);
+  buffer.seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  memcpy(&buffer.data, &outputs, sizeof(outputs));
+  buffer.seq.store(seq + 2, std::memory_order_release);
+
+  s->count.store(count + 1, std::memory_order_release);
+}
+
+bool simuOutputsRead(SimuOutputs& dest, uint32_t& count)
+{
+  auto s = getSnapshot();
+
+  for (int retry = 0; retry < SIMU_OUTPUTS_READ_RETRIES; retry++) {
+    uint32_t c = s->count.load(std::memory_order_acquire);
+    const SimuOutputsBuffer& buffer = s->buffers[c & 1];
+
+    uint32_t seq = buffer.seq.load(std::memory_order_acquire);
+    if (seq & 1) continue;
+
+    memcpy(&dest, &buffer.data, sizeof(dest));
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (buffer.seq.load(std::memory_order_relaxed) == seq) {
+      count = c;
+      return true;
+    }
+  }
+
+  return false;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#pragma once
+
+#include "dataconstants.h"
+#include "gvars.h"
+
+#include <atomic>
+#include <stdint.h>
+
+// Outputs snapshot
+//
+// Written by the mixer task at the end of each mixer cycle, read
+// lock-free by the simulator UI (or any other process when the snapshot
+// lives in shared memory). Each of the 2 buffers is protected by a
+// sequence counter (odd while being written); the writer alternates
+// buffers, so that a reader copying the latest one is very unlikely to
+// have to retry.
+
+#define SIMU_OUTPUTS_MAGIC    0x54554F53  // "SOUT"
+#define SIMU_OUTPUTS_VERSION  1
+
+struct SimuOutputs {
+  int16_t chans[MAX_OUTPUT_CHANNELS];     // final channel outputs
+  int16_t ex_chans[MAX_OUTPUT_CHANNELS];  // raw mix outputs
+  int16_t trims[MAX_TRIMS];               // current flight mode
+  int16_t gvars[MAX_FLIGHT_MODES][MAX_GVARS];
+  uint8_t gvarsPrec[MAX_GVARS];
+  uint8_t gvarsUnit[MAX_GVARS];
+  uint8_t lsw[(MAX_LOGICAL_SWITCHES + 7) / 8];
+  uint8_t phase;
+  uint8_t extendedLimits;
+  uint8_t extendedTrims;
+};
+
+struct SimuOutputsBuffer {
+  std::atomic<uint32_t> seq;
+  SimuOutputs data;
+};
+
+struct SimuOutputsSnapshot {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;                 // sizeof(SimuOutputs)
+  std::atomic<uint32_t> count;   // snapshots written, latest in buffers[count & 1]
+  SimuOutputsBuffer buffers[2];
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free,
+              "snapshot counters must be usable from another process");
+
+inline bool simuOutputsLsw(const SimuOutputs& outputs, uint8_t idx)
+{
+  return outputs.lsw[idx / 8] & (1 << (idx % 8));
+}
+
+// Mixer task, end of each mixer cycle
+void simuOutputsUpdate();
+
+// Returns false if no consistent snapshot could be read. 'count' is the
+// number of the snapshot read (unchanged count: same outputs)
+bool simuOutputsRead(SimuOutputs& dest, uint32_t& count);
+
+// Moves the snapshot to 'mem' (sizeof(SimuOutputsSnapshot) bytes, e.g. a
+// shared memory segment), nullptr to go back to the internal one.
+// Only while the simulator is stopped.
+void simuOutputsSetStorage(void* mem);
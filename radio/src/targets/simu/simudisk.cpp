@@ -32,6 +32,13 @@ static FILE* disk_image = nullptr;
 
 // create FS with: mkdosfs -n SDCARD -S 512 -C sdcard.img 524288
 static const char* image_path = "sdcard.img";
+static bool disk_trace = true;
+
+void simuDiskSetImage(const char* path, bool trace)
+{
+  image_path = path;
+  disk_trace = trace;
+}
 
 static int _seek(DWORD sector)
 {
@@ -60,21 +67,30 @@ static DSTATUS simu_disk_initialize(BYTE lun)
   return RES_OK;
 }
 
+static DSTATUS simu_disk_deinit(BYTE lun)
+{
+  if (disk_image) {
+    fclose(disk_image);
+    disk_image = nullptr;
+  }
+  return RES_OK;
+}
+
 static DSTATUS simu_disk_status(BYTE lun) { return RES_OK; }
 
 static DRESULT simu_disk_read(BYTE lun, BYTE* buff, DWORD sector, UINT count)
 {
   if (_seek(sector) != 0) return RES_ERROR;
-  fprintf(stderr, "# R %d/%d\n", sector, count);
-  fread(buff, 512, count, disk_image);
+  if (disk_trace) fprintf(stderr, "# R %d/%d\n", sector, count);
+  if (fread(buff, 512, count, disk_image) != count) return RES_ERROR;
   return RES_OK;
 }
 
 static DRESULT simu_disk_write(BYTE lun, const BYTE* buff, DWORD sector, UINT count)
 {
   if (_seek(sector) != 0) return RES_ERROR;
-  fprintf(stderr, "# W %d/%d\n", sector, count);
-  fwrite(buff, 512, count, disk_image);
+  if (disk_trace) fprintf(stderr, "# W %d/%d\n", sector, count);
+  if (fwrite(buff, 512, count, disk_image) != count) return RES_ERROR;
   return RES_OK;
 }
 
@@ -87,7 +103,7 @@ static DRESULT simu_disk_ioctl(BYTE lun, BYTE cmd, void* buff)
     case GET_SECTOR_COUNT:
       if (fseek(disk_image, 0, SEEK_END) == 0) {
         long sectors = ftell(disk_image) / 512L;
-        fprintf(stderr, "# S %ld\n", sectors);
+        if (disk_trace) fprintf(stderr, "# S %ld\n", sectors);
         *((DWORD*)buff) = (DWORD)(sectors);
       } else {
         fprintf(stderr, "fseek failed: %s\n", strerror(errno));
@@ -100,7 +116,11 @@ static DRESULT simu_disk_ioctl(BYTE lun, BYTE cmd, void* buff)
       break;
 
     case GET_BLOCK_SIZE:
-      *(WORD*)buff = 512 * 4;
+      *(DWORD*)buff = 512 * 4;
+      break;
+
+    case CTRL_SYNC:
+      if (fflush(disk_image) != 0) res = RES_ERROR;
       break;
 
     default:
@@ -112,6 +132,7 @@ static DRESULT simu_disk_ioctl(BYTE lun, BYTE cmd, void* buff)
 
 const diskio_driver_t simu_diskio_driver = {
   .initialize = simu_disk_initialize,
+  .deinit = simu_disk_deinit,
   .status = simu_disk_status,
   .read = simu_disk_read,
   .write = simu_disk_write,
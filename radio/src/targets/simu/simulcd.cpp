@@ -41,10 +41,19 @@ void lcdInit() {}
 
 void lcdRefresh()
 {
-  // Mark screen dirty for async refresh
-  simuLcdRefresh = true;
+  // Only the changed rows are copied, like the radio drivers do
+  uint32_t rows = lcdGetRefreshRows();
+  for (unsigned i = 0; i < LCD_REFRESH_ROWS; i++) {
+    if (rows & (1u << i)) {
+      memcpy(&simuLcdBuf[i * LCD_REFRESH_ROW_SIZE],
+             &displayBuf[i * LCD_REFRESH_ROW_SIZE],
+             LCD_REFRESH_ROW_SIZE * sizeof(pixel_t));
+      lcdRefreshBytes += LCD_REFRESH_ROW_SIZE;
+    }
+  }
 
-  memcpy(simuLcdBuf, displayBuf, DISPLAY_BUFFER_SIZE * sizeof(pixel_t));
+  // Mark screen dirty for async refresh
+  if (rows) simuLcdRefresh = true;
 }
 
 #else
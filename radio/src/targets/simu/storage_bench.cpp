@@ -0,0 +1,1234 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+/*
+  Storage benchmark
+
+  Runs FatFs and the storage drivers (hal/fatfs_diskio.cpp, disk_cache.cpp,
+  drivers/frftl.cpp, simudisk.cpp) natively, on a virtual clock: each media
+  access advances the clock by the time given by a latency model, so that
+  runs are deterministic and do not depend on the host.
+
+  Backends:
+    sd          RAM disk with a SD card latency model
+    sd-cache    same, through the disk cache
+    flash       FrFTL on an emulated NOR flash
+    image       disk image file (simudisk.cpp), SD card latency model
+
+  Workloads, replaying what the firmware does:
+    save-storm  bursts of model saves (temporary file, then rename)
+    logging     10 Hz telemetry log lines appended to an open file
+    lua         script loads (256 bytes reads) and widget state files
+    audio       WAV streaming, one audio buffer every 10 ms
+
+  A scenario runs one or several workloads at the same time: their
+  operations are interleaved on the virtual clock, the same way the
+  firmware tasks contend for the FatFs volume lock. An operation latency
+  counts from the time it is due, so the time spent waiting for another
+  workload is included.
+
+  After each run, the volume is unmounted and the driver torn down (FTL
+  included), then everything written is read back and checked.
+
+  Latency specs: preset[,key=value...]
+    presets: ideal, fast-sd, sd, slow-sd, nor
+    keys (us): cmd, read and write (per 512 bytes), erase (4 KB),
+               block-erase (32 KB), stall=<sectors>:<us> (internal
+               garbage collection of SD cards, every n written sectors)
+*/
+
+#include "debug.h"
+#include "disk_cache.h"
+#include "drivers/frftl.h"
+#include "hal/fatfs_diskio.h"
+#include "rtc.h"
+#include "ff.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+extern const diskio_driver_t simu_diskio_driver;
+void simuDiskSetImage(const char* path, bool trace);
+
+#define SECTOR_SIZE           512
+#define NOR_SECTOR_SIZE       4096
+#define NOR_BLOCK_SIZE        32768
+
+struct LatencyModel {
+  uint32_t commandUs;
+  uint32_t readUs;          // per 512 bytes
+  uint32_t writeUs;         // per 512 bytes
+  uint32_t eraseUs;
+  uint32_t blockEraseUs;
+  uint32_t stallSectors;
+  uint32_t stallUs;
+};
+
+struct LatencyPreset {
+  const char* name;
+  LatencyModel model;
+};
+
+static const LatencyPreset latencyPresets[] = {
+  {"ideal", {0, 0, 0, 0, 0, 0, 0}},
+  {"fast-sd", {50, 20, 30, 0, 0, 0, 0}},
+  {"sd", {150, 40, 90, 0, 0, 256, 5000}},
+  {"slow-sd", {400, 100, 400, 0, 0, 64, 40000}},
+  {"nor", {10, 70, 1400, 45000, 150000, 0, 0}},
+};
+
+struct MediaStats {
+  uint64_t bytesRead;
+  uint64_t bytesWritten;
+  uint32_t commands;
+  uint32_t erases;
+  uint32_t programErrors;   // bits programmed from 0 to 1
+  uint64_t busyUs;
+};
+
+static uint64_t benchClock;  // us
+static MediaStats media;
+
+static LatencyModel sdLatency;
+static LatencyModel norLatency;
+static uint32_t sdSizeMB = 64;
+static uint16_t flashSizeMB = 8;
+static const char* imagePath = "storage-bench.img";
+
+static void mediaBusy(uint64_t us)
+{
+  media.busyUs += us;
+  benchClock += us;
+}
+
+//
+// RAM disk
+//
+
+static std::vector<uint8_t> ramDisk;
+
+static DSTATUS ram_initialize(BYTE lun)
+{
+  return ramDisk.empty() ? STA_NODISK : 0;
+}
+
+static DSTATUS ram_status(BYTE lun)
+{
+  return ramDisk.empty() ? STA_NODISK : 0;
+}
+
+static DRESULT ram_read(BYTE lun, BYTE* buff, DWORD sector, UINT count)
+{
+  if ((sector + count) * SECTOR_SIZE > ramDisk.size()) return RES_PARERR;
+  memcpy(buff, &ramDisk[sector * SECTOR_SIZE], count * SECTOR_SIZE);
+  return RES_OK;
+}
+
+static DRESULT ram_write(BYTE lun, const BYTE* buff, DWORD sector, UINT count)
+{
+  if ((sector + count) * SECTOR_SIZE > ramDisk.size()) return RES_PARERR;
+  memcpy(&ramDisk[sector * SECTOR_SIZE], buff, count * SECTOR_SIZE);
+  return RES_OK;
+}
+
+static DRESULT ram_ioctl(BYTE lun, BYTE cmd, void* buff)
+{
+  switch (cmd) {
+    case GET_SECTOR_COUNT:
+      *(DWORD*)buff = ramDisk.size() / SECTOR_SIZE;
+      break;
+    case GET_SECTOR_SIZE:
+      *(WORD*)buff = SECTOR_SIZE;
+      break;
+    case GET_BLOCK_SIZE:
+      *(DWORD*)buff = 4 * 1024 * 1024 / SECTOR_SIZE;
+      break;
+  }
+  return RES_OK;
+}
+
+static const diskio_driver_t ram_driver = {
+  .initialize = ram_initialize,
+  .deinit = nullptr,
+  .status = ram_status,
+  .read = ram_read,
+  .write = ram_write,
+  .ioctl = ram_ioctl,
+};
+
+//
+// SD card timings, on top of the RAM disk or the disk image
+//
+
+static const diskio_driver_t* sdMedia;
+static uint32_t sdStallCount;
+
+static DSTATUS sd_initialize(BYTE lun)
+{
+  sdStallCount = 0;
+  return sdMedia->initialize(lun);
+}
+
+static DSTATUS sd_deinit(BYTE lun)
+{
+  return sdMedia->deinit ? sdMedia->deinit(lun) : 0;
+}
+
+static DSTATUS sd_status(BYTE lun) { return sdMedia->status(lun); }
+
+static DRESULT sd_read(BYTE lun, BYTE* buff, DWORD sector, UINT count)
+{
+  media.commands++;
+  media.bytesRead += count * SECTOR_SIZE;
+  mediaBusy(sdLatency.commandUs + count * sdLatency.readUs);
+  return sdMedia->read(lun, buff, sector, count);
+}
+
+static DRESULT sd_write(BYTE lun, const BYTE* buff, DWORD sector, UINT count)
+{
+  media.commands++;
+  media.bytesWritten += count * SECTOR_SIZE;
+  uint64_t busy = sdLatency.commandUs + count * sdLatency.writeUs;
+  if (sdLatency.stallSectors) {
+    sdStallCount += count;
+    while (sdStallCount >= sdLatency.stallSectors) {
+      sdStallCount -= sdLatency.stallSectors;
+      busy += sdLatency.stallUs;
+    }
+  }
+  mediaBusy(busy);
+  return sdMedia->write(lun, buff, sector, count);
+}
+
+static DRESULT sd_ioctl(BYTE lun, BYTE cmd, void* buff)
+{
+  return sdMedia->ioctl(lun, cmd, buff);
+}
+
+static const diskio_driver_t sd_driver = {
+  .initialize = sd_initialize,
+  .deinit = sd_deinit,
+  .status = sd_status,
+  .read = sd_read,
+  .write = sd_write,
+  .ioctl = sd_ioctl,
+};
+
+// same as the shim in hal/storage.cpp
+static const diskio_driver_t sd_cache_driver = {
+  .initialize = sd_initialize,
+  .deinit = sd_deinit,
+  .status = sd_status,
+  .read = disk_cache_read,
+  .write = disk_cache_write,
+  .ioctl = sd_ioctl,
+};
+
+//
+// NOR flash and FTL
+//
+
+static std::vector<uint8_t> norFlash;
+static FrFTL ftl;
+
+static bool norRead(uint32_t addr, uint8_t* buf, uint32_t len)
+{
+  if (addr + len > norFlash.size()) return false;
+  memcpy(buf, &norFlash[addr], len);
+  media.commands++;
+  media.bytesRead += len;
+  mediaBusy(norLatency.commandUs + (uint64_t)len * norLatency.readUs / 512);
+  return true;
+}
+
+static bool norProgram(uint32_t addr, const uint8_t* buf, uint32_t len)
+{
+  if (addr + len > norFlash.size()) return false;
+  for (uint32_t i = 0; i < len; i++) {
+    uint8_t& byte = norFlash[addr + i];
+    if (buf[i] & ~byte) media.programErrors++;
+    byte &= buf[i];
+  }
+  media.commands++;
+  media.bytesWritten += len;
+  mediaBusy(norLatency.commandUs + (uint64_t)len * norLatency.writeUs / 512);
+  return true;
+}
+
+static bool norErase(uint32_t addr)
+{
+  if (addr % NOR_SECTOR_SIZE || addr >= norFlash.size()) return false;
+  memset(&norFlash[addr], 0xFF, NOR_SECTOR_SIZE);
+  media.commands++;
+  media.erases++;
+  mediaBusy(norLatency.eraseUs);
+  return true;
+}
+
+static bool norBlockErase(uint32_t addr)
+{
+  if (addr % NOR_BLOCK_SIZE || addr >= norFlash.size()) return false;
+  memset(&norFlash[addr], 0xFF, NOR_BLOCK_SIZE);
+  media.commands++;
+  media.erases += NOR_BLOCK_SIZE / NOR_SECTOR_SIZE;
+  mediaBusy(norLatency.blockEraseUs);
+  return true;
+}
+
+static bool norIsErased(uint32_t addr)
+{
+  if (addr % NOR_SECTOR_SIZE || addr >= norFlash.size()) return false;
+  media.commands++;
+  media.bytesRead += NOR_SECTOR_SIZE;
+  mediaBusy(norLatency.commandUs +
+            (uint64_t)NOR_SECTOR_SIZE * norLatency.readUs / 512);
+  const uint8_t* p = &norFlash[addr];
+  return std::all_of(p, p + NOR_SECTOR_SIZE,
+                     [](uint8_t b) { return b == 0xFF; });
+}
+
+static const FrFTLOps norOps = {
+  .flashRead = norRead,
+  .flashProgram = norProgram,
+  .flashErase = norErase,
+  .flashBlockErase = norBlockErase,
+  .isFlashErased = norIsErased,
+};
+
+// same as targets/common/arm/stm32/diskio_spi_flash.cpp, with a deinit
+// so that the FTL is reloaded from the flash when remounting
+static DSTATUS flash_initialize(BYTE lun)
+{
+  return ftlInit(&ftl, &norOps, flashSizeMB) ? 0 : STA_NOINIT;
+}
+
+static DSTATUS flash_deinit(BYTE lun)
+{
+  ftlDeInit(&ftl);
+  return 0;
+}
+
+static DSTATUS flash_status(BYTE lun) { return 0; }
+
+static DRESULT flash_read(BYTE lun, BYTE* buff, DWORD sector, UINT count)
+{
+  while (count--) {
+    if (!ftlRead(&ftl, sector++, buff)) return RES_ERROR;
+    buff += SECTOR_SIZE;
+  }
+  return RES_OK;
+}
+
+static DRESULT flash_write(BYTE lun, const BYTE* buff, DWORD sector, UINT count)
+{
+  return ftlWrite(&ftl, sector, count, buff) ? RES_OK : RES_ERROR;
+}
+
+static DRESULT flash_ioctl(BYTE lun, BYTE cmd, void* buff)
+{
+  switch (cmd) {
+    case GET_SECTOR_COUNT:
+      *(DWORD*)buff = ftl.usableSectorCount;
+      break;
+    case GET_SECTOR_SIZE:
+      *(WORD*)buff = SECTOR_SIZE;
+      break;
+    case GET_BLOCK_SIZE:
+      *(DWORD*)buff = NOR_SECTOR_SIZE / SECTOR_SIZE;
+      break;
+    case CTRL_SYNC:
+      return ftlSync(&ftl) ? RES_OK : RES_ERROR;
+  }
+  return RES_OK;
+}
+
+static const diskio_driver_t flash_driver = {
+  .initialize = flash_initialize,
+  .deinit = flash_deinit,
+  .status = flash_status,
+  .read = flash_read,
+  .write = flash_write,
+  .ioctl = flash_ioctl,
+};
+
+//
+// Backends
+//
+
+struct Backend {
+  const char* name;
+  const diskio_driver_t* driver;
+  bool (*create)();
+  void (*destroy)();
+  bool cache;
+};
+
+static bool createRamDisk()
+{
+  ramDisk.assign((size_t)sdSizeMB << 20, 0);
+  sdMedia = &ram_driver;
+  return true;
+}
+
+static void destroyRamDisk() { std::vector<uint8_t>().swap(ramDisk); }
+
+static bool createCachedRamDisk()
+{
+  createRamDisk();
+  diskCache.initialize(&sd_driver);
+  return true;
+}
+
+static bool createFlash()
+{
+  norFlash.assign((size_t)flashSizeMB << 20, 0xFF);
+  return true;
+}
+
+static void destroyFlash() { std::vector<uint8_t>().swap(norFlash); }
+
+static bool createImage()
+{
+  FILE* f = fopen(imagePath, "wb");
+  if (!f) {
+    fprintf(stderr, "Cannot create %s\n", imagePath);
+    return false;
+  }
+  bool ok = fseek(f, ((long)sdSizeMB << 20) - 1, SEEK_SET) == 0 &&
+            fputc(0, f) != EOF;
+  fclose(f);
+  simuDiskSetImage(imagePath, false);
+  sdMedia = &simu_diskio_driver;
+  return ok;
+}
+
+static void destroyImage() { remove(imagePath); }
+
+static const Backend backends[] = {
+  {"sd", &sd_driver, createRamDisk, destroyRamDisk, false},
+  {"sd-cache", &sd_cache_driver, createCachedRamDisk, destroyRamDisk, true},
+  {"flash", &flash_driver, createFlash, destroyFlash, false},
+  {"image", &sd_driver, createImage, destroyImage, false},
+};
+
+//
+// File contents
+//
+
+static uint8_t patternByte(uint32_t seed, uint32_t offset)
+{
+  uint32_t x = seed * 0x9E3779B1 + offset * 0x85EBCA6B;
+  x ^= x >> 15;
+  x *= 0x2C1B3C6D;
+  return x >> 24;
+}
+
+static void fillPattern(uint8_t* buf, uint32_t len, uint32_t seed,
+                        uint32_t offset)
+{
+  for (uint32_t i = 0; i < len; i++) buf[i] = patternByte(seed, offset + i);
+}
+
+static bool checkPattern(const uint8_t* buf, uint32_t len, uint32_t seed,
+                         uint32_t offset)
+{
+  for (uint32_t i = 0; i < len; i++) {
+    if (buf[i] != patternByte(seed, offset + i)) return false;
+  }
+  return true;
+}
+
+static bool fail(const char* what, const char* path, FRESULT res = FR_OK)
+{
+  fprintf(stderr, "%s %s failed (%d)\n", what, path, res);
+  return false;
+}
+
+struct OpStats {
+  uint64_t bytesRead;
+  uint64_t bytesWritten;
+  uint32_t missed;
+  std::vector<uint32_t> latencies;
+};
+
+static bool writeFile(const char* path, uint32_t size, uint32_t seed,
+                      uint32_t chunk, OpStats* stats = nullptr)
+{
+  FIL file;
+  FRESULT res = f_open(&file, path, FA_CREATE_ALWAYS | FA_WRITE);
+  if (res != FR_OK) return fail("open", path, res);
+
+  std::vector<uint8_t> buf(chunk);
+  for (uint32_t pos = 0; pos < size; pos += chunk) {
+    uint32_t len = std::min(chunk, size - pos);
+    fillPattern(buf.data(), len, seed, pos);
+    UINT written;
+    res = f_write(&file, buf.data(), len, &written);
+    if (res != FR_OK || written != len) {
+      f_close(&file);
+      return fail("write", path, res);
+    }
+  }
+
+  res = f_close(&file);
+  if (res != FR_OK) return fail("close", path, res);
+  if (stats) stats->bytesWritten += size;
+  return true;
+}
+
+static bool checkFile(const char* path, uint32_t size, uint32_t seed,
+                      uint32_t chunk, OpStats* stats = nullptr)
+{
+  FIL file;
+  FRESULT res = f_open(&file, path, FA_OPEN_EXISTING | FA_READ);
+  if (res != FR_OK) return fail("open", path, res);
+  if (f_size(&file) != size) {
+    f_close(&file);
+    return fail("size of", path);
+  }
+
+  std::vector<uint8_t> buf(chunk);
+  for (uint32_t pos = 0; pos < size; pos += chunk) {
+    uint32_t len = std::min(chunk, size - pos);
+    UINT read;
+    res = f_read(&file, buf.data(), len, &read);
+    if (res != FR_OK || read != len || !checkPattern(buf.data(), len, seed, pos)) {
+      f_close(&file);
+      return fail("check", path, res);
+    }
+  }
+
+  f_close(&file);
+  if (stats) stats->bytesRead += size;
+  return true;
+}
+
+static bool makeDir(const char* path)
+{
+  FRESULT res = f_mkdir(path);
+  return res == FR_OK || res == FR_EXIST || fail("mkdir", path, res);
+}
+
+//
+// Workloads
+//
+
+class Workload
+{
+ public:
+  Workload(const char* name, uint32_t period, uint32_t deadline) :
+      name(name), period(period), deadline(deadline)
+  {
+  }
+  virtual ~Workload() = default;
+
+  // create the files used, not measured
+  virtual bool setup() = 0;
+  // one operation
+  virtual bool step() = 0;
+  // close what is still open
+  virtual bool finish() { return true; }
+  // check the files after remounting
+  virtual bool verify() = 0;
+
+  virtual uint64_t next(uint64_t due, uint64_t now) { return due + period; }
+
+  const char* name;
+  uint32_t period;      // us
+  uint32_t deadline;    // us, 0 if none
+  uint64_t due = 0;
+  OpStats stats = {};
+};
+
+// Model settings saved as in writeFileYaml(): written through a 512 bytes
+// buffer to a temporary file, which then replaces the previous one
+class SaveStorm : public Workload
+{
+  static constexpr uint32_t MODELS = 16;
+  static constexpr uint32_t YAML_BUFFER = 512;
+
+ public:
+  SaveStorm() : Workload("save-storm", 2000000, 0) {}
+
+  bool setup() override
+  {
+    if (!makeDir("/MODELS")) return false;
+    for (uint32_t i = 0; i < MODELS; i++) {
+      if (!save(i, nullptr)) return false;
+    }
+    return true;
+  }
+
+  bool step() override
+  {
+    if (count % MODELS == 0) stormStart = due;
+    uint32_t idx = count++ % MODELS;
+    versions[idx]++;
+    return save(idx, &stats);
+  }
+
+  // all models are saved back to back, then nothing until the next storm
+  uint64_t next(uint64_t due, uint64_t now) override
+  {
+    if (count % MODELS) return now;
+    return std::max(stormStart + period, now);
+  }
+
+  bool verify() override
+  {
+    for (uint32_t i = 0; i < MODELS; i++) {
+      char path[32];
+      modelPath(path, i, "");
+      if (!checkFile(path, modelSize(i), seed(i), YAML_BUFFER)) return false;
+      modelPath(path, i, ".tmp");
+      FILINFO info;
+      if (f_stat(path, &info) != FR_NO_FILE) return fail("leftover", path);
+    }
+    return true;
+  }
+
+ private:
+  uint32_t versions[MODELS] = {};
+  uint32_t count = 0;
+  uint64_t stormStart = 0;
+
+  static void modelPath(char* path, uint32_t idx, const char* ext)
+  {
+    snprintf(path, 32, "/MODELS/model%02u.yml%s", (unsigned)idx, ext);
+  }
+
+  uint32_t modelSize(uint32_t idx) const
+  {
+    return 1500 + (idx * 977 + versions[idx] * 331) % 4500;
+  }
+
+  uint32_t seed(uint32_t idx) const { return idx << 16 | versions[idx]; }
+
+  bool save(uint32_t idx, OpStats* stats)
+  {
+    char path[32], tmpPath[32];
+    modelPath(path, idx, "");
+    modelPath(tmpPath, idx, ".tmp");
+    if (!writeFile(tmpPath, modelSize(idx), seed(idx), YAML_BUFFER, stats))
+      return false;
+    f_unlink(path);
+    FRESULT res = f_rename(tmpPath, path);
+    return res == FR_OK || fail("rename", tmpPath, res);
+  }
+};
+
+// Telemetry log: a line every 100 ms, appended to a file kept open
+class Logging : public Workload
+{
+  static constexpr const char* PATH = "/LOGS/bench.csv";
+
+ public:
+  Logging() : Workload("logging", 100000, 100000) {}
+
+  bool setup() override
+  {
+    if (!makeDir("/LOGS")) return false;
+    FRESULT res =
+        f_open(&file, PATH, FA_OPEN_ALWAYS | FA_WRITE | FA_OPEN_APPEND);
+    if (res != FR_OK) return fail("open", PATH, res);
+    opened = true;
+    // header
+    return append(300);
+  }
+
+  bool step() override
+  {
+    if (!append(180 + count++ % 40)) return false;
+    stats.bytesWritten += lineSize;
+    return true;
+  }
+
+  bool finish() override
+  {
+    if (!opened) return true;
+    opened = false;
+    FRESULT res = f_close(&file);
+    return res == FR_OK || fail("close", PATH, res);
+  }
+
+  bool verify() override { return checkFile(PATH, size, 7, 512); }
+
+ private:
+  FIL file;
+  bool opened = false;
+  uint32_t size = 0;
+  uint32_t count = 0;
+  uint32_t lineSize = 0;
+
+  bool append(uint32_t len)
+  {
+    uint8_t line[512];
+    fillPattern(line, len, 7, size);
+    UINT written;
+    FRESULT res = f_write(&file, line, len, &written);
+    if (res != FR_OK || written != len) return fail("write", PATH, res);
+    size += len;
+    lineSize = len;
+    return true;
+  }
+};
+
+// Lua: scripts loaded through the 256 bytes reader of lauxlib.c, and a
+// widget saving its state
+class LuaFiles : public Workload
+{
+  static constexpr uint32_t SCRIPTS = 4;
+  static constexpr uint32_t LUA_BUFFER = 256;
+  static constexpr const char* STATE_PATH = "/SCRIPTS/TELEMETRY/state.dat";
+
+ public:
+  LuaFiles() : Workload("lua", 500000, 0) {}
+
+  bool setup() override
+  {
+    if (!makeDir("/SCRIPTS") || !makeDir("/SCRIPTS/TELEMETRY")) return false;
+    for (uint32_t i = 0; i < SCRIPTS; i++) {
+      char path[40];
+      scriptPath(path, i);
+      if (!writeFile(path, scriptSize(i), 100 + i, 4096)) return false;
+    }
+    return writeFile(STATE_PATH, 1024, 200, 1024);
+  }
+
+  bool step() override
+  {
+    uint32_t n = count++;
+    if (n & 1) {
+      state++;
+      return writeFile(STATE_PATH, 1024, 200 + state, 1024, &stats);
+    }
+    uint32_t idx = (n / 2) % SCRIPTS;
+    char path[40];
+    scriptPath(path, idx);
+    return checkFile(path, scriptSize(idx), 100 + idx, LUA_BUFFER, &stats);
+  }
+
+  bool verify() override
+  {
+    for (uint32_t i = 0; i < SCRIPTS; i++) {
+      char path[40];
+      scriptPath(path, i);
+      if (!checkFile(path, scriptSize(i), 100 + i, 4096)) return false;
+    }
+    return checkFile(STATE_PATH, 1024, 200 + state, 1024);
+  }
+
+ private:
+  uint32_t count = 0;
+  uint32_t state = 0;
+
+  static void scriptPath(char* path, uint32_t idx)
+  {
+    snprintf(path, 40, "/SCRIPTS/TELEMETRY/script%u.lua", (unsigned)idx);
+  }
+
+  static uint32_t scriptSize(uint32_t idx) { return 6144 << (idx % 3); }
+};
+
+// WAV streaming: one 10 ms buffer of 16 bits samples at 32 kHz, the
+// mixer has to get it before the 2 buffers queued are played
+class AudioStream : public Workload
+{
+  static constexpr const char* PATH = "/SOUNDS/en/bench.wav";
+  static constexpr uint32_t HEADER = 44;
+  static constexpr uint32_t SIZE = 256 * 1024;
+  static constexpr uint32_t BUFFER = 32000 * 10 / 1000 * 2;
+
+ public:
+  AudioStream() : Workload("audio", 10000, 20000) {}
+
+  bool setup() override
+  {
+    return makeDir("/SOUNDS") && makeDir("/SOUNDS/en") &&
+           writeFile(PATH, SIZE, 300, 4096);
+  }
+
+  bool step() override
+  {
+    FRESULT res;
+    if (!opened) {
+      res = f_open(&file, PATH, FA_OPEN_EXISTING | FA_READ);
+      if (res != FR_OK) return fail("open", PATH, res);
+      opened = true;
+      pos = SIZE;
+    }
+    if (pos + BUFFER > SIZE) {
+      res = f_lseek(&file, HEADER);
+      if (res != FR_OK) return fail("seek", PATH, res);
+      pos = HEADER;
+    }
+
+    uint8_t buf[BUFFER];
+    UINT read;
+    res = f_read(&file, buf, BUFFER, &read);
+    if (res != FR_OK || read != BUFFER || !checkPattern(buf, BUFFER, 300, pos))
+      return fail("read", PATH, res);
+    pos += BUFFER;
+    stats.bytesRead += BUFFER;
+    return true;
+  }
+
+  bool finish() override
+  {
+    if (opened) f_close(&file);
+    opened = false;
+    return true;
+  }
+
+  bool verify() override { return checkFile(PATH, SIZE, 300, 4096); }
+
+ private:
+  FIL file;
+  bool opened = false;
+  uint32_t pos = 0;
+};
+
+enum WorkloadMask {
+  WORKLOAD_SAVE_STORM = 1 << 0,
+  WORKLOAD_LOGGING = 1 << 1,
+  WORKLOAD_LUA = 1 << 2,
+  WORKLOAD_AUDIO = 1 << 3,
+};
+
+struct Scenario {
+  const char* name;
+  uint8_t workloads;
+};
+
+static const Scenario scenarios[] = {
+  {"save-storm", WORKLOAD_SAVE_STORM},
+  {"logging", WORKLOAD_LOGGING},
+  {"lua", WORKLOAD_LUA},
+  {"audio", WORKLOAD_AUDIO},
+  // in flight: telemetry log, voice prompts and Lua widgets
+  {"flight", WORKLOAD_LOGGING | WORKLOAD_AUDIO | WORKLOAD_LUA},
+  {"all",
+   WORKLOAD_SAVE_STORM | WORKLOAD_LOGGING | WORKLOAD_LUA | WORKLOAD_AUDIO},
+};
+
+static std::vector<std::unique_ptr<Workload>> createWorkloads(uint8_t mask)
+{
+  std::vector<std::unique_ptr<Workload>> workloads;
+  if (mask & WORKLOAD_SAVE_STORM) workloads.emplace_back(new SaveStorm());
+  if (mask & WORKLOAD_LOGGING) workloads.emplace_back(new Logging());
+  if (mask & WORKLOAD_LUA) workloads.emplace_back(new LuaFiles());
+  if (mask & WORKLOAD_AUDIO) workloads.emplace_back(new AudioStream());
+  return workloads;
+}
+
+//
+// Runs
+//
+
+// The simulator normally provides these to the native OS layer (the FatFs
+// volume lock), here they run on the virtual clock
+volatile uint32_t g_tmr10ms;
+
+uint64_t simuTimerMicros() { return benchClock; }
+
+void debugPrintf(const char* format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  vfprintf(stderr, format, args);
+  va_end(args);
+}
+
+// FatFs timestamps
+void gettime(struct gtm* tm)
+{
+  uint32_t secs = benchClock / 1000000;
+  memset(tm, 0, sizeof(*tm));
+  tm->tm_year = 125;
+  tm->tm_mday = 1 + secs / SECS_PER_DAY;
+  tm->tm_hour = secs / SECS_PER_HOUR % 24;
+  tm->tm_min = secs / 60 % 60;
+  tm->tm_sec = secs % 60;
+}
+
+struct RunResult {
+  uint64_t elapsedUs;
+  uint64_t hostUs;
+  MediaStats media;
+  uint32_t cacheHits;
+  uint32_t cacheMisses;
+};
+
+static uint32_t percentile(std::vector<uint32_t> values, uint32_t pct)
+{
+  if (values.empty()) return 0;
+  std::sort(values.begin(), values.end());
+  return values[(values.size() - 1) * pct / 100];
+}
+
+static bool mount(const Backend& backend, FATFS* fs, bool format)
+{
+  if (!fatfsRegisterDriver(backend.driver, 0)) {
+    fprintf(stderr, "fatfsRegisterDriver failed\n");
+    return false;
+  }
+  if (backend.cache) diskCache.clear();
+
+  FRESULT res;
+  if (format) {
+    static BYTE work[FF_MAX_SS * 8];
+    MKFS_PARM opt = {FM_ANY, 0, 0, 0, 0};
+    res = f_mkfs("", &opt, work, sizeof(work));
+    if (res != FR_OK) return fail("mkfs", backend.name, res);
+  }
+
+  res = f_mount(fs, "", 1);
+  return res == FR_OK || fail("mount", backend.name, res);
+}
+
+static void unmount()
+{
+  f_unmount("");
+  // syncs and tears down the driver
+  fatfsUnregisterDrivers();
+}
+
+static bool runBench(const Scenario& scenario, const Backend& backend,
+                     uint64_t duration, RunResult& result,
+                     std::vector<std::unique_ptr<Workload>>& workloads)
+{
+  benchClock = 0;
+  media = {};
+  if (!backend.create()) return false;
+
+  FATFS fs;
+  workloads = createWorkloads(scenario.workloads);
+  bool ok = mount(backend, &fs, true);
+  for (auto& w : workloads) {
+    ok = ok && w->setup();
+  }
+
+  // the setup is not measured, the cache stays warm
+  media = {};
+  DiskCacheStats cacheStart = diskCache.getStats();
+  uint64_t start = benchClock;
+  for (auto& w : workloads) {
+    w->due = start;
+  }
+
+  auto hostStart = std::chrono::steady_clock::now();
+  while (ok) {
+    auto w = std::min_element(workloads.begin(), workloads.end(),
+                              [](const std::unique_ptr<Workload>& a,
+                                 const std::unique_ptr<Workload>& b) {
+                                return a->due < b->due;
+                              })->get();
+    if (w->due >= start + duration) break;
+
+    benchClock = std::max(benchClock, w->due);
+    if (!w->step()) {
+      fprintf(stderr, "%s: %s failed at %.3f s\n", scenario.name, w->name,
+              (benchClock - start) / 1e6);
+      ok = false;
+      break;
+    }
+
+    uint32_t latency = benchClock - w->due;
+    w->stats.latencies.push_back(latency);
+    if (w->deadline && latency > w->deadline) w->stats.missed++;
+    w->due = w->next(w->due, benchClock);
+  }
+
+  for (auto& w : workloads) {
+    ok = w->finish() && ok;
+  }
+  unmount();
+  auto hostEnd = std::chrono::steady_clock::now();
+
+  result.elapsedUs = std::max(benchClock, start + duration) - start;
+  result.hostUs = std::chrono::duration_cast<std::chrono::microseconds>(
+                      hostEnd - hostStart).count();
+  result.media = media;
+  result.cacheHits = diskCache.getStats().noHits - cacheStart.noHits;
+  result.cacheMisses = diskCache.getStats().noMisses - cacheStart.noMisses;
+
+  // read back everything after a remount
+  if (ok) {
+    ok = mount(backend, &fs, false);
+    for (auto& w : workloads) {
+      if (ok && !w->verify()) {
+        fprintf(stderr, "%s: %s files corrupted on %s\n", scenario.name,
+                w->name, backend.name);
+        ok = false;
+      }
+    }
+    unmount();
+  }
+
+  if (media.programErrors) {
+    fprintf(stderr, "%s: %u bytes programmed without erase\n", backend.name,
+            media.programErrors);
+    ok = false;
+  }
+
+  backend.destroy();
+  return ok;
+}
+
+static void printResult(const Scenario& scenario, const Backend& backend,
+                        const RunResult& result,
+                        const std::vector<std::unique_ptr<Workload>>& workloads,
+                        FILE* csv)
+{
+  uint64_t appRead = 0, appWritten = 0;
+  for (auto& w : workloads) {
+    appRead += w->stats.bytesRead;
+    appWritten += w->stats.bytesWritten;
+  }
+
+  const MediaStats& m = result.media;
+  double busy = 100.0 * m.busyUs / result.elapsedUs;
+  double throughput =
+      m.busyUs ? (appRead + appWritten) * 1e6 / 1024 / m.busyUs : 0;
+  double amplification = appWritten ? (double)m.bytesWritten / appWritten : 0;
+
+  printf("%s / %s: %.1f s, busy %.1f %%, %.0f KB/s, %u commands, "
+         "write amplification %.2f, %u erases",
+         scenario.name, backend.name, result.elapsedUs / 1e6, busy, throughput,
+         m.commands, amplification, m.erases);
+  if (backend.cache) {
+    uint32_t lookups = result.cacheHits + result.cacheMisses;
+    printf(", cache hits %.1f %%",
+           lookups ? 100.0 * result.cacheHits / lookups : 0);
+  }
+  printf(", host %.1f ms\n", result.hostUs / 1e3);
+
+  printf("  %-12s %7s %10s %10s %8s %8s %8s %7s\n", "workload", "ops",
+         "read KB", "written KB", "p50 ms", "p99 ms", "max ms", "missed");
+  for (auto& w : workloads) {
+    const OpStats& s = w->stats;
+    uint32_t p50 = percentile(s.latencies, 50);
+    uint32_t p99 = percentile(s.latencies, 99);
+    uint32_t max = percentile(s.latencies, 100);
+    printf("  %-12s %7u %10.1f %10.1f %8.2f %8.2f %8.2f ", w->name,
+           (unsigned)s.latencies.size(), s.bytesRead / 1024.0,
+           s.bytesWritten / 1024.0, p50 / 1e3, p99 / 1e3, max / 1e3);
+    if (w->deadline) printf("%7u\n", s.missed);
+    else printf("%7s\n", "-");
+
+    if (csv) {
+      fprintf(csv,
+              "%s,%s,%s,%u,%llu,%llu,%u,%u,%u,%u,%u,%llu,%llu,%u,%llu,%llu,"
+              "%.3f,%llu\n",
+              scenario.name, backend.name, w->name,
+              (unsigned)s.latencies.size(), (unsigned long long)s.bytesRead,
+              (unsigned long long)s.bytesWritten, p50, p99, max, s.missed,
+              m.commands, (unsigned long long)m.bytesRead,
+              (unsigned long long)m.bytesWritten, m.erases,
+              (unsigned long long)m.busyUs,
+              (unsigned long long)result.elapsedUs, amplification,
+              (unsigned long long)result.hostUs);
+    }
+  }
+  printf("\n");
+}
+
+//
+// Command line
+//
+
+static bool parseLatency(const char* spec, LatencyModel& model)
+{
+  std::string str = spec;
+  size_t end = str.find(',');
+  std::string name = str.substr(0, end);
+  auto preset = std::find_if(
+      std::begin(latencyPresets), std::end(latencyPresets),
+      [&](const LatencyPreset& p) { return name == p.name; });
+  if (preset == std::end(latencyPresets)) {
+    printf("Unknown latency preset: %s\n", name.c_str());
+    return false;
+  }
+  model = preset->model;
+
+  while (end != std::string::npos) {
+    size_t start = end + 1;
+    end = str.find(',', start);
+    std::string item = str.substr(start, end - start);
+    size_t eq = item.find('=');
+    std::string key = item.substr(0, eq);
+    const char* value = eq == std::string::npos ? "" : item.c_str() + eq + 1;
+    char* last;
+    unsigned long n = strtoul(value, &last, 10);
+    if (key == "stall" && *last == ':') {
+      model.stallSectors = n;
+      n = strtoul(last + 1, &last, 10);
+      model.stallUs = n;
+    } else if (key == "cmd") model.commandUs = n;
+    else if (key == "read") model.readUs = n;
+    else if (key == "write") model.writeUs = n;
+    else if (key == "erase") model.eraseUs = n;
+    else if (key == "block-erase") model.blockEraseUs = n;
+    else last = (char*)value;
+
+    if (last == value || *last != '\0') {
+      printf("Invalid latency parameter: %s\n", item.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+// comma separated names, all of them if empty
+template <class T, size_t N>
+static bool parseList(const char* what, const char* list, const T (&items)[N],
+                      std::vector<const T*>& selected)
+{
+  std::string str = list;
+  if (str.empty()) {
+    for (auto& item : items) selected.push_back(&item);
+    return true;
+  }
+
+  size_t start = 0;
+  while (start <= str.size()) {
+    size_t end = str.find(',', start);
+    if (end == std::string::npos) end = str.size();
+    std::string name = str.substr(start, end - start);
+    auto item = std::find_if(std::begin(items), std::end(items),
+                             [&](const T& i) { return name == i.name; });
+    if (item == std::end(items)) {
+      printf("Unknown %s: %s\n", what, name.c_str());
+      return false;
+    }
+    selected.push_back(item);
+    start = end + 1;
+  }
+  return true;
+}
+
+static void printUsage(const char* name)
+{
+  printf("Usage: %s [options]\n", name);
+  printf("  --scenario list     save-storm, logging, lua, audio, flight, all\n");
+  printf("                      (default: every scenario)\n");
+  printf("  --backend list      sd, sd-cache, flash, image (default: all)\n");
+  printf("  --duration s        virtual time of each run (default: 30)\n");
+  printf("  --sd-latency spec   SD card latency model (default: sd)\n");
+  printf("  --flash-latency spec\n");
+  printf("                      NOR flash latency model (default: nor)\n");
+  printf("  --sd-size MB        SD card size (default: 64)\n");
+  printf("  --flash-size MB     NOR flash size (default: 8)\n");
+  printf("  --image file        disk image used by 'image'\n");
+  printf("                      (default: storage-bench.img, removed after)\n");
+  printf("  --csv file          results dump (CSV)\n");
+  printf("  -h, --help          show this help message\n");
+}
+
+int main(int argc, char* argv[])
+{
+  const char* scenarioList = "";
+  const char* backendList = "";
+  const char* sdSpec = "sd";
+  const char* flashSpec = "nor";
+  const char* csvPath = nullptr;
+  long duration = 30;
+
+  for (int i = 1; i < argc; i++) {
+    std::string opt = argv[i];
+    if (opt == "-h" || opt == "--help") {
+      printUsage(argv[0]);
+      return 0;
+    }
+    if (i + 1 >= argc) {
+      printUsage(argv[0]);
+      return 1;
+    }
+    const char* value = argv[++i];
+    if (opt == "--scenario") scenarioList = value;
+    else if (opt == "--backend") backendList = value;
+    else if (opt == "--duration") duration = strtol(value, nullptr, 10);
+    else if (opt == "--sd-latency") sdSpec = value;
+    else if (opt == "--flash-latency") flashSpec = value;
+    else if (opt == "--sd-size") sdSizeMB = strtoul(value, nullptr, 10);
+    else if (opt == "--flash-size") flashSizeMB = strtoul(value, nullptr, 10);
+    else if (opt == "--image") imagePath = value;
+    else if (opt == "--csv") csvPath = value;
+    else {
+      printf("Unknown option: %s\n", opt.c_str());
+      printUsage(argv[0]);
+      return 1;
+    }
+  }
+
+  if (duration <= 0 || sdSizeMB == 0) {
+    printf("--duration and --sd-size require a positive integer\n");
+    return 1;
+  }
+
+  std::vector<const Scenario*> selectedScenarios;
+  std::vector<const Backend*> selectedBackends;
+  if (!parseList("scenario", scenarioList, scenarios, selectedScenarios) ||
+      !parseList("backend", backendList, backends, selectedBackends) ||
+      !parseLatency(sdSpec, sdLatency) ||
+      !parseLatency(flashSpec, norLatency)) {
+    return 1;
+  }
+
+  FILE* csv = nullptr;
+  if (csvPath) {
+    csv = fopen(csvPath, "w");
+    if (!csv) {
+      fprintf(stderr, "Cannot create %s\n", csvPath);
+      return 1;
+    }
+    fprintf(csv,
+            "scenario,backend,workload,ops,read,written,p50_us,p99_us,max_us,"
+            "missed,media_commands,media_read,media_written,erases,busy_us,"
+            "elapsed_us,"
+            "write_amplification,host_us\n");
+  }
+
+  int result = 0;
+  for (auto scenario : selectedScenarios) {
+    for (auto backend : selectedBackends) {
+      RunResult run = {};
+      std::vector<std::unique_ptr<Workload>> workloads;
+      if (!runBench(*scenario, *backend, duration * 1000000ULL, run,
+                    workloads)) {
+        printf("%s / %s: FAILED\n\n", scenario->name, backend->name);
+        result = 1;
+        continue;
+      }
+      printResult(*scenario, *backend, run, workloads, csv);
+    }
+  }
+
+  if (csv) fclose(csv);
+  return result;
+}
@@ -21,6 +21,15 @@
 
 #include "timers_driver.h"
 
+#include <chrono>
+
 void watchdogSuspend(unsigned int) {}
-uint32_t timersGetUsTick() { return 0; }
+
+uint32_t timersGetUsTick()
+{
+  static auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
 
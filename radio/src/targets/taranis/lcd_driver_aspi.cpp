@@ -174,7 +174,10 @@ void lcdRefresh()
     lcdInitFinish();
   }
 
+  uint32_t rows = lcdGetRefreshRows();
+
   for (uint8_t y=0; y<LCD_H; y++) {
+    if (!(rows & (1u << (y / 2)))) continue;
     uint8_t * p = &displayBuf[y/2 * LCD_W];
 
     lcdWriteAddress(0, y);
@@ -198,6 +201,7 @@ void lcdRefresh()
     LCD_A0_HIGH();
 
     lcdWriteData(0);
+    lcdRefreshBytes += LCD_W / 2;
   }
 }
 
@@ -283,6 +287,9 @@ void lcdInitFinish()
   lcdStart();
   lcdWriteCommand(0xAF); // dc2=1, IC into exit SLEEP MODE, dc3=1 gray=ON, dc4=1 Green Enhanc mode disabled
   delay_ms(20); // Needed for internal DC-DC converter startup
+
+  // LCD RAM content is unknown
+  lcdInvalidate();
 }
 
 void lcdSetRefVolt(uint8_t val)
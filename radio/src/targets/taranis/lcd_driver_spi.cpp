@@ -96,12 +96,6 @@ void lcdHardwareInit()
   LCD_DMA->HIFCR = LCD_DMA_FLAGS; // Write ones to clear bits
   LCD_DMA_Stream->CR =  DMA_SxCR_PL_0 | DMA_SxCR_MINC | DMA_SxCR_DIR_0;
   LCD_DMA_Stream->PAR = (uint32_t)&LCD_SPI->DR;
-#if LCD_W == 128
-  LCD_DMA_Stream->NDTR = LCD_W;
-#else
-  LCD_DMA_Stream->M0AR = (uint32_t)displayBuf;
-  LCD_DMA_Stream->NDTR = LCD_W*LCD_H/8*4;
-#endif
   LCD_DMA_Stream->FCR = 0x05; // DMA_SxFCR_DMDIS | DMA_SxFCR_FTH_0;
 
   NVIC_SetPriority(LCD_DMA_Stream_IRQn, 7);
@@ -272,64 +266,88 @@ void lcdWriteAddress(uint8_t x, uint8_t y)
 
 volatile bool lcd_busy;
 
+// Rows still to be sent by the DMA interrupt
+static volatile uint32_t lcdPendingRows;
+
 void lcdRefreshWait()
 {
   WAIT_FOR_DMA_END();
 }
 
-void lcdRefresh(bool wait)
+static void lcdStartDma(const uint8_t * p, uint16_t count)
 {
-  if (!lcdInitFinished) {
-    lcdInitFinish();
-  }
+  LCD_NCS_LOW();
+  LCD_A0_HIGH();
+
+  LCD_DMA_Stream->CR &= ~DMA_SxCR_EN; // Disable DMA
+  LCD_DMA->HIFCR = LCD_DMA_FLAGS; // Write ones to clear bits
+  LCD_DMA_Stream->M0AR = (uint32_t)p;
+  LCD_DMA_Stream->NDTR = count;
+  LCD_DMA_Stream->CR |= DMA_SxCR_EN | DMA_SxCR_TCIE; // Enable DMA & TC interrupts
+  LCD_SPI->CR2 |= SPI_CR2_TXDMAEN;
+
+  lcdRefreshBytes += count;
+}
+
+// Sends the next pending row, or the next run of consecutive rows when the
+// LCD address wraps from one row to the next. Called from lcdRefresh() and
+// then from the DMA interrupt, until all rows have been sent.
+static void lcdSendPendingRows()
+{
+  uint32_t rows = lcdPendingRows;
+  uint8_t y = __builtin_ctz(rows);
 
 #if LCD_W == 128
-  uint8_t * p = displayBuf;
-#if defined(LCD_W_OFFSET)
-  lcdWriteCommand(LCD_W_OFFSET);
-#endif
-  for (uint8_t y=0; y < 8; y++, p+=LCD_W) {
+  rows &= ~(1u << y);
 #if defined(SSD1309_LCD)
-    lcdPageSet(y);
-    lcdColumnSet(0);
+  lcdPageSet(y);
+  lcdColumnSet(0);
 #else
-    lcdWriteCommand(0x10); // Column addr 0
-    lcdWriteCommand(0xB0 | y); // Page addr y
+  lcdWriteCommand(0x10); // Column addr 0
+  lcdWriteCommand(0xB0 | y); // Page addr y
 #if !defined(LCD_VERTICAL_INVERT)
-    lcdWriteCommand(0x04);
+  lcdWriteCommand(0x04);
 #endif
+#endif
+  uint8_t count = 1;
+#else
+  uint8_t count = 0;
+  while (y + count < LCD_REFRESH_ROWS && (rows & (1u << (y + count)))) {
+    rows &= ~(1u << (y + count));
+    count++;
+  }
+  lcdWriteAddress(0, y);
 #endif
 
-    LCD_NCS_LOW();
-    LCD_A0_HIGH();
-
-    lcd_busy = true;
-    LCD_DMA_Stream->CR &= ~DMA_SxCR_EN; // Disable DMA
-    LCD_DMA->HIFCR = LCD_DMA_FLAGS; // Write ones to clear bits
-    LCD_DMA_Stream->M0AR = (uint32_t)p;
-    LCD_DMA_Stream->CR |= DMA_SxCR_EN | DMA_SxCR_TCIE; // Enable DMA & TC interrupts
-    LCD_SPI->CR2 |= SPI_CR2_TXDMAEN;
-
-    WAIT_FOR_DMA_END();
+  lcdPendingRows = rows;
+  lcdStartDma(&displayBuf[y * LCD_REFRESH_ROW_SIZE], count * LCD_REFRESH_ROW_SIZE);
+}
 
-    LCD_NCS_HIGH();
-    LCD_A0_HIGH();
+void lcdRefresh(bool wait)
+{
+  if (!lcdInitFinished) {
+    lcdInitFinish();
   }
-#else
+
   // Wait if previous DMA transfer still active
   WAIT_FOR_DMA_END();
-  lcd_busy = true;
 
-  lcdWriteAddress(0, 0);
+  uint32_t rows = lcdGetRefreshRows();
+  if (!rows) return;
 
-  LCD_NCS_LOW();
-  LCD_A0_HIGH();
+#if defined(LCD_W_OFFSET)
+  lcdWriteCommand(LCD_W_OFFSET);
+#endif
 
-  LCD_DMA_Stream->CR &= ~DMA_SxCR_EN; // Disable DMA
-  LCD_DMA->HIFCR = LCD_DMA_FLAGS; // Write ones to clear bits
+  lcd_busy = true;
+  lcdPendingRows = rows;
+  lcdSendPendingRows();
 
-  LCD_DMA_Stream->CR |= DMA_SxCR_EN | DMA_SxCR_TCIE; // Enable DMA & TC interrupts
-  LCD_SPI->CR2 |= SPI_CR2_TXDMAEN;
+#if LCD_W == 128
+  // displayBuf may be drawn again as soon as we return
+  if (wait) {
+    WAIT_FOR_DMA_END();
+  }
 #endif
 }
 
@@ -349,7 +367,13 @@ extern "C" void LCD_DMA_Stream_IRQHandler()
     */
   }
   LCD_NCS_HIGH();
-  lcd_busy = false;
+
+  if (lcdPendingRows) {
+    lcdSendPendingRows();
+  }
+  else {
+    lcd_busy = false;
+  }
 }
 
 /*
@@ -441,6 +465,9 @@ void lcdInitFinish()
   lcdStart();
   lcdWriteCommand(0xAF); // dc2=1, IC into exit SLEEP MODE, dc3=1 gray=ON, dc4=1 Green Enhanc mode disabled
   delay_ms(20); // needed for internal DC-DC converter startup
+
+  // LCD RAM content is unknown
+  lcdInvalidate();
 }
 
 void lcdSetRefVolt(uint8_t val)
@@ -449,9 +476,7 @@ void lcdSetRefVolt(uint8_t val)
     lcdInitFinish();
   }
 
-#if LCD_W != 128
   WAIT_FOR_DMA_END();
-#endif
 
 #if defined(RADIO_V12) || defined(RADIO_V14)
   lcdWriteCommand(0x81);                      // Set Vop
@@ -465,6 +490,7 @@ void lcdSetRefVolt(uint8_t val)
 #if LCD_W == 128
 void lcdSetInvert(bool invert)
 {
+   WAIT_FOR_DMA_END();
    lcdWriteCommand(invert ? 0xA7 : 0xA6);
 }
 #endif
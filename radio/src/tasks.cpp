@@ -47,8 +47,6 @@ TASK_DEFINE_STACK(audioStack, AUDIO_STACK_SIZE);
 
 mutex_handle_t audioMutex;
 
-#define MENU_TASK_PERIOD (50)  // 50ms
-
 #if defined(COLORLCD) && defined(CLI)
 bool perMainEnabled = true;
 #endif
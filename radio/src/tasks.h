@@ -40,6 +40,8 @@
 
 #define CLI_STACK_SIZE         1024  // only consumed with CLI build option
 
+#define MENU_TASK_PERIOD       (50)  // 50ms
+
 #if defined(FREE_RTOS)
 #define MIXER_TASK_PRIO        (tskIDLE_PRIORITY + 4)
 #define AUDIO_TASK_PRIO        (tskIDLE_PRIORITY + 3) // Note: FreeRTOSConfig.h defines software timers as priority 2
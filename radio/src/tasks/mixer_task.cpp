@@ -139,7 +139,7 @@ void execMixerFrequentActions()
 void mixerTask()
 {
 #if defined(IMU)
-  gyroInit();
+  gyro.init();
 #endif
 
   while (task_running()) {
@@ -188,6 +188,10 @@ void mixerTask()
       pulsesSendChannels();
       doMixerPeriodicUpdates();
 
+#if defined(SIMU)
+      simuOutputsUpdate();
+#endif
+
       // TODO: what are these for???
       DEBUG_TIMER_START(debugTimerMixerCalcToUsage);
       DEBUG_TIMER_SAMPLE(debugTimerMixerIterval);
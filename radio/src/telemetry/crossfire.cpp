@@ -294,9 +294,11 @@ void processCrossfireTelemetryFrame(uint8_t module, uint8_t* rxBuffer,
         uint8_t inputbitsavailable = 0;
         uint32_t inputbits = 0;
         uint8_t  byteIdx = 3;
-        int16_t *pulses = trainerInput;
+        int16_t channels[MAX_TRAINER_CHANNELS];
+        int16_t *pulses = channels;
+        const uint8_t count = min(CROSSFIRE_CHANNELS_COUNT, MAX_TRAINER_CHANNELS);
 
-        for (int i = 0; i < min(CROSSFIRE_CHANNELS_COUNT, MAX_TRAINER_CHANNELS); i++) {
+        for (int i = 0; i < count; i++) {
           while (inputbitsavailable < CROSSFIRE_CH_BITS) {
             inputbits |= (uint32_t)(rxBuffer[byteIdx++]) << inputbitsavailable;
             inputbitsavailable += 8;
@@ -306,7 +308,8 @@ void processCrossfireTelemetryFrame(uint8_t module, uint8_t* rxBuffer,
           inputbits >>= CROSSFIRE_CH_BITS;
         }
 
-        trainerResetTimer();
+        trainerPushChannels(TRAINER_SOURCE_MODULE, 0, channels, count,
+                            timersGetMsTick());
       }
       break;
 
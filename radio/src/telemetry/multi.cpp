@@ -284,6 +284,8 @@ static void processMultiRxChannels(const uint8_t * data, uint8_t len)
   //uint8_t rssi = data[1];
   int ch    = max(data[2], (uint8_t)0);
   int maxCh = min(ch + data[3], MAX_TRAINER_CHANNELS);
+  const int first = ch;
+  int16_t channels[MAX_TRAINER_CHANNELS];
 
   uint32_t bits = 0;
   uint8_t  bitsavailable = 0;
@@ -299,14 +301,17 @@ static void processMultiRxChannels(const uint8_t * data, uint8_t len)
     bitsavailable -= MULTI_CHAN_BITS;
     bits >>= MULTI_CHAN_BITS;
 
-    trainerInput[ch] = (value - 1024) * 500 / 800;
+    channels[ch - first] = (value - 1024) * 500 / 800;
     ch++;
 
     if (byteIdx >= len)
       break;
   }
 
-  if (ch == maxCh) { trainerResetTimer(); }
+  if (ch == maxCh) {
+    trainerPushChannels(TRAINER_SOURCE_MODULE, first, channels, ch - first,
+                        timersGetMsTick());
+  }
 }
 #endif
 
@@ -464,11 +464,8 @@ void deregisterTelemetryQueue(TelemetryQueue* queue)
 
 static void pushDataToQueue(TelemetryQueue* queue, uint8_t* data, int length)
 {
-  if (queue && queue->hasSpace(length)) {
-    for (uint8_t i = 0; i < length; i += 1) {
-      queue->push(data[i]);
-    }
-  }
+  // whole packets only: Lua pops them by length
+  if (queue) queue->pushAll(data, length);
 }
 
 void pushTelemetryDataToQueues(uint8_t* data, int length)
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "gtests.h"
+#include "hal/adc_driver.h"
+
+#include <chrono>
+
+class AdcTest : public EdgeTxTest
+{
+ protected:
+  void TearDown() override
+  {
+    memclear(simuAnalogs, sizeof(simuAnalogs));
+    for (uint8_t i = 0; i < MAX_ANALOG_INPUTS; i++) {
+      adcSetInputFilter(i, ADC_FILTER_DEFAULT);
+    }
+    anaResetFiltered();
+  }
+
+  // simu inputs are not calibrated: raw 0..4096 gives anaIn() 0..2048
+  static uint16_t run(uint8_t input, uint16_t raw, int cycles = 1)
+  {
+    simuAnalogs[input] = raw;
+    for (int i = 0; i < cycles; i++) getADC();
+    return anaIn(input);
+  }
+};
+
+TEST(Adc, CalibReciprocal)
+{
+  // 12-bit values around the mid-point, scaled by RESX
+  for (int span = 100; span < 2048; span++) {
+    uint32_t recip = adcCalibRecip(span);
+    for (int s = -4095; s <= 4095; s++) {
+      ASSERT_EQ(s * RESX / span, adcCalibDivide(s * RESX, recip))
+          << "s=" << s << " span=" << span;
+    }
+  }
+}
+
+TEST_F(AdcTest, JitterFilter)
+{
+  EXPECT_EQ(1024, run(0, 2048, 10));
+
+  // small changes are smoothed
+  EXPECT_EQ(1024, run(0, 2056));
+  EXPECT_EQ(1028, run(0, 2056, 100));
+
+  // big changes pass through
+  EXPECT_EQ(1500, run(0, 3000));
+
+  // unless disabled by the model
+  g_model.jitterFilter = OVERRIDE_OFF;
+  adcPipelineInvalidate();
+  EXPECT_EQ(1504, run(0, 3008));
+  EXPECT_EQ(1500, run(0, 3000));
+}
+
+TEST_F(AdcTest, Inversion)
+{
+  EXPECT_EQ(512, run(0, 1024, 2));
+
+  setStickInversion(inputMappingConvertMode(0), true);
+  // pipeline still uses the previous settings
+  EXPECT_EQ(512, run(0, 1024));
+
+  adcPipelineInvalidate();
+  EXPECT_EQ(1536, run(0, 1024));
+}
+
+TEST_F(AdcTest, Median3)
+{
+  adcSetInputFilter(0, ADC_FILTER_MEDIAN3);
+  EXPECT_EQ(1024, run(0, 2048, 3));
+
+  // single spikes are removed
+  EXPECT_EQ(1024, run(0, 4000));
+  EXPECT_EQ(1024, run(0, 2048));
+  EXPECT_EQ(1024, run(0, 0));
+  EXPECT_EQ(1024, run(0, 2048));
+
+  // steps are delayed by 1 sample
+  EXPECT_EQ(1024, run(0, 3000));
+  EXPECT_EQ(1500, run(0, 3000));
+}
+
+TEST_F(AdcTest, OneEuro)
+{
+  adcSetInputFilter(0, ADC_FILTER_ONE_EURO);
+  EXPECT_EQ(1024, run(0, 2048, 1000));
+
+  // noise around a still position is filtered out
+  uint16_t lo = 1024, hi = 1024;
+  for (int i = 0; i < 500; i++) {
+    uint16_t v = run(0, i & 1 ? 2056 : 2040);
+    lo = min(lo, v);
+    hi = max(hi, v);
+  }
+  EXPECT_GE(lo, 1023);
+  EXPECT_LE(hi, 1025);
+
+  // a fast move is followed with little lag
+  uint16_t v = 0;
+  for (int raw = 2048; raw <= 4000; raw += 40) v = run(0, raw);
+  EXPECT_GT(v, 1850);
+
+  // and the output settles on the input
+  EXPECT_EQ(2000, run(0, 4000, 500));
+}
+
+// Timing only, run with --gtest_also_run_disabled_tests
+TEST_F(AdcTest, DISABLED_Benchmark)
+{
+  for (uint8_t i = 0; i < MAX_ANALOG_INPUTS; i++) {
+    simuAnalogs[i] = 1024 + 64 * i;
+  }
+
+  const int cycles = 100000;
+  for (uint8_t filter = ADC_FILTER_NONE; filter < ADC_FILTER_COUNT; filter++) {
+    for (uint8_t i = 0; i < MAX_ANALOG_INPUTS; i++) {
+      adcSetInputFilter(i, filter);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < cycles; i++) {
+      simuAnalogs[0] = 1024 + (i & 63);
+      getADC();
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    printf("getADC() filter %u: %.3f us\n", filter,
+           duration.count() / 1000.0 / cycles);
+  }
+}
@@ -0,0 +1,395 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "gtests.h"
+#include "audio.h"
+
+#include <math.h>
+#include <vector>
+
+static void generateSine(int16_t * data, uint32_t count, uint32_t freq,
+                         uint32_t rate, float & phase)
+{
+  for (uint32_t i = 0; i < count; i++) {
+    data[i] = 16000 * sinf(phase);
+    phase += 2 * float(M_PI) * freq / rate;
+  }
+}
+
+// feeds the resampler like the audio task does, returns the peak of the
+// output after the filter delay
+static int resampleSine(uint32_t rate, uint32_t freq, uint32_t buffers)
+{
+  AudioResampler resampler;
+  int16_t in[AUDIO_BUFFER_SIZE * 2 + 1];
+  int16_t out[AUDIO_BUFFER_SIZE];
+  float phase = 0;
+  int peak = 0;
+
+  EXPECT_TRUE(resampler.init(rate));
+  for (uint32_t b = 0; b < buffers; b++) {
+    uint32_t count = resampler.inputNeeded(AUDIO_BUFFER_SIZE);
+    EXPECT_LE(count, DIM(in));
+    generateSine(in, count, freq, rate, phase);
+    EXPECT_EQ(AUDIO_BUFFER_SIZE,
+              resampler.process(in, count, out, AUDIO_BUFFER_SIZE));
+    if (b > 0) {
+      for (int i = 0; i < AUDIO_BUFFER_SIZE; i++) {
+        peak = max<int>(peak, abs(out[i]));
+      }
+    }
+  }
+  return peak;
+}
+
+TEST(Audio, ResamplerRates)
+{
+  AudioResampler resampler;
+  EXPECT_FALSE(resampler.init(500));
+  EXPECT_FALSE(resampler.init(96000));
+  EXPECT_TRUE(resampler.init(AUDIO_SAMPLE_RATE));
+  EXPECT_TRUE(resampler.isBypassed());
+  EXPECT_TRUE(resampler.init(16000));
+  EXPECT_FALSE(resampler.isBypassed());
+  EXPECT_EQ(AUDIO_BUFFER_SIZE / 2, resampler.inputNeeded(AUDIO_BUFFER_SIZE));
+}
+
+TEST(Audio, ResamplerBypass)
+{
+  AudioResampler resampler;
+  int16_t in[AUDIO_BUFFER_SIZE];
+  int16_t out[AUDIO_BUFFER_SIZE];
+  float phase = 0;
+
+  resampler.init(AUDIO_SAMPLE_RATE);
+  generateSine(in, DIM(in), 1000, AUDIO_SAMPLE_RATE, phase);
+  EXPECT_EQ(AUDIO_BUFFER_SIZE, resampler.process(in, DIM(in), out, DIM(out)));
+  EXPECT_EQ(0, memcmp(in, out, sizeof(in)));
+}
+
+TEST(Audio, ResamplerGain)
+{
+  // pass band: unity gain, whatever the ratio
+  EXPECT_NEAR(16000, resampleSine(8000, 500, 20), 300);
+  EXPECT_NEAR(16000, resampleSine(16000, 1000, 20), 300);
+  EXPECT_NEAR(16000, resampleSine(22050, 1000, 20), 300);
+  EXPECT_NEAR(16000, resampleSine(44100, 1000, 20), 300);
+  EXPECT_NEAR(16000, resampleSine(48000, 3000, 20), 300);
+
+  // above the output Nyquist frequency: attenuated
+  EXPECT_LT(resampleSine(48000, 20000, 20), 4000);
+}
+
+TEST(Audio, ResamplerLength)
+{
+  // 1 second at 44.1kHz gives 1 second at the output rate
+  AudioResampler resampler;
+  int16_t in[AUDIO_BUFFER_SIZE * 2 + 1] = {0};
+  int16_t out[AUDIO_BUFFER_SIZE];
+  uint32_t consumed = 0;
+
+  resampler.init(44100);
+  for (int b = 0; b < AUDIO_SAMPLE_RATE / AUDIO_BUFFER_SIZE; b++) {
+    uint32_t count = resampler.inputNeeded(AUDIO_BUFFER_SIZE);
+    resampler.process(in, count, out, AUDIO_BUFFER_SIZE);
+    consumed += count;
+  }
+  EXPECT_NEAR(44100, consumed, 2);
+}
+
+TEST(Audio, ResamplerContinuity)
+{
+  // the output does not depend on how the input is split into buffers
+  const uint32_t buffers = 8;
+  AudioResampler resampler;
+  std::vector<int16_t> in(AUDIO_BUFFER_SIZE * buffers);
+  std::vector<int16_t> ref(AUDIO_BUFFER_SIZE * buffers);
+  std::vector<int16_t> out(AUDIO_BUFFER_SIZE * buffers);
+  float phase = 0;
+
+  generateSine(in.data(), in.size(), 1000, 22050, phase);
+
+  resampler.init(22050);
+  uint32_t total = resampler.inputNeeded(ref.size());
+  EXPECT_EQ(int(ref.size()),
+            resampler.process(in.data(), total, ref.data(), ref.size()));
+
+  resampler.init(22050);
+  uint32_t consumed = 0;
+  for (uint32_t b = 0; b < buffers; b++) {
+    uint32_t count = resampler.inputNeeded(AUDIO_BUFFER_SIZE);
+    EXPECT_EQ(AUDIO_BUFFER_SIZE,
+              resampler.process(&in[consumed], count,
+                                &out[b * AUDIO_BUFFER_SIZE], AUDIO_BUFFER_SIZE));
+    consumed += count;
+  }
+  EXPECT_EQ(total, consumed);
+
+  for (uint32_t i = 0; i < out.size(); i++) {
+    ASSERT_EQ(ref[i], out[i]) << "at sample " << i;
+  }
+}
+
+TEST(Audio, GainRamp)
+{
+  AudioGain gain;
+  int16_t samples[AUDIO_BUFFER_SIZE];
+  int32_t accu[AUDIO_BUFFER_SIZE] = {0};
+
+  for (auto & s : samples) s = 10000;
+
+  // starts from 0 and reaches the target after the ramp
+  gain.reset();
+  gain.mix(accu, samples, AUDIO_BUFFER_SIZE, AUDIO_GAIN_ONE);
+  EXPECT_LT(accu[0], 1000);
+  for (int i = 1; i < AUDIO_GAIN_RAMP; i++) {
+    EXPECT_GE(accu[i], accu[i - 1]);
+  }
+  EXPECT_EQ(10000, accu[AUDIO_GAIN_RAMP]);
+  EXPECT_EQ(10000, accu[AUDIO_BUFFER_SIZE - 1]);
+
+  // mixes into the accumulator
+  gain.mix(accu, samples, AUDIO_BUFFER_SIZE, AUDIO_GAIN_ONE / 2);
+  EXPECT_EQ(15000, accu[AUDIO_BUFFER_SIZE - 1]);
+}
+
+// Reference IMA-ADPCM encoder (same as radio/util/wav2adpcm.py)
+class AdpcmEncoder
+{
+ public:
+  std::vector<uint8_t> encode(const int16_t * samples, uint32_t count,
+                              uint32_t blockSize)
+  {
+    std::vector<uint8_t> data;
+    uint32_t samplesPerBlock = (blockSize - 4) * 2 + 1;
+    for (uint32_t i = 0; i < count; i += samplesPerBlock) {
+      uint32_t n = min(samplesPerBlock, count - i);
+      predictor = samples[i];
+      data.push_back(predictor & 0xFF);
+      data.push_back(predictor >> 8);
+      data.push_back(index);
+      data.push_back(0);
+      for (uint32_t j = 1; j < n; j += 2) {
+        uint8_t code = encodeSample(samples[i + j]);
+        if (j + 1 < n) code |= encodeSample(samples[i + j + 1]) << 4;
+        data.push_back(code);
+      }
+    }
+    return data;
+  }
+
+ private:
+  int predictor = 0;
+  int index = 0;
+
+  uint8_t encodeSample(int sample)
+  {
+    static const int steps[] = {
+      7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37,
+      41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173,
+      190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+      724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+      2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484,
+      7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818,
+      18500, 20350, 22385, 24623, 27086, 29794, 32767};
+    static const int indexes[] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+    int step = steps[index];
+    int diff = sample - predictor;
+    uint8_t code = 0;
+    if (diff < 0) {
+      code = 8;
+      diff = -diff;
+    }
+    int delta = step >> 3;
+    if (diff >= step) {
+      code |= 4;
+      diff -= step;
+      delta += step;
+    }
+    if (diff >= step >> 1) {
+      code |= 2;
+      diff -= step >> 1;
+      delta += step >> 1;
+    }
+    if (diff >= step >> 2) {
+      code |= 1;
+      delta += step >> 2;
+    }
+    predictor = limit(-32768, predictor + (code & 8 ? -delta : delta), 32767);
+    index = limit(0, index + indexes[code & 7], (int)DIM(steps) - 1);
+    return code;
+  }
+};
+
+TEST(Audio, AdpcmDecoder)
+{
+  AdpcmDecoder decoder;
+  EXPECT_FALSE(decoder.init(16, 25));
+  EXPECT_FALSE(decoder.init(256, 500));
+  EXPECT_TRUE(decoder.init(256, 505));
+
+  // a few blocks of a sweep, the last one incomplete
+  const uint32_t count = 505 * 4 + 123;
+  std::vector<int16_t> pcm(count);
+  float phase = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    pcm[i] = 12000 * sinf(phase);
+    phase += 2 * float(M_PI) * (200 + i) / 16000;
+  }
+  AdpcmEncoder encoder;
+  auto adpcm = encoder.encode(pcm.data(), count, 256);
+  EXPECT_EQ(256U * 4 + 4 + 61, adpcm.size());
+
+  // decoded the way the audio task reads it: odd counts, across blocks
+  std::vector<int16_t> decoded(count);
+  uint32_t offset = 0, done = 0;
+  for (uint32_t chunk = 1; done < count; chunk = chunk * 3 % 641 + 1) {
+    uint32_t n = min(chunk, count - done);
+    uint32_t bytes = decoder.bytesNeeded(n);
+    ASSERT_LE(offset + bytes, adpcm.size());
+    EXPECT_EQ(n, decoder.decode(&adpcm[offset], bytes, &decoded[done], n));
+    offset += bytes;
+    done += n;
+  }
+  EXPECT_EQ(adpcm.size(), offset);
+
+  // the input end stops the decoder
+  int16_t out[4];
+  EXPECT_EQ(0U, decoder.decode(nullptr, 0, out, DIM(out)));
+
+  double error = 0, signal = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    error += (pcm[i] - decoded[i]) * (pcm[i] - decoded[i]);
+    signal += pcm[i] * pcm[i];
+  }
+  // more than 20dB SNR
+  EXPECT_GT(10 * log10(signal / error), 20);
+}
+
+TEST(Audio, PromptCache)
+{
+  static PromptCache cache;
+  cache.invalidate();
+
+  uint32_t key = PromptCache::getKey("/SOUNDS/en/0001.wav");
+  EXPECT_EQ(key, PromptCache::getKey("/sounds/EN/0001.WAV"));
+  EXPECT_NE(key, PromptCache::getKey("/SOUNDS/en/0002.wav"));
+
+  PromptStamp stamp = {1044, 0x5A21, 0x6000};
+  PromptInfo info = {};
+  info.dataOffset = 44;
+  info.dataSize = 1000;
+  info.freq = 16000;
+  EXPECT_EQ(nullptr, cache.find(key, stamp));
+  cache.add(key, stamp, info);
+
+  // no head on first play
+  bool fill;
+  EXPECT_EQ(PROMPT_CACHE_NO_HEAD, cache.getHead(key, fill));
+  EXPECT_FALSE(fill);
+
+  // second play: header from the cache, head to be filled
+  const PromptInfo * cached = cache.find(key, stamp);
+  ASSERT_NE(nullptr, cached);
+  EXPECT_EQ(1000U, cached->dataSize);
+  uint8_t head = cache.getHead(key, fill);
+  EXPECT_NE(PROMPT_CACHE_NO_HEAD, head);
+  EXPECT_TRUE(fill);
+  uint16_t size;
+  uint8_t * data = cache.getHeadData(head, key, size);
+  ASSERT_NE(nullptr, data);
+  cache.setHeadSize(head, PROMPT_CACHE_HEAD_SIZE);
+
+  // third play: head ready
+  cache.find(key, stamp);
+  EXPECT_EQ(head, cache.getHead(key, fill));
+  EXPECT_FALSE(fill);
+
+  // other hot prompts take the least recently used heads
+  char path[32];
+  for (int i = 0; i < PROMPT_CACHE_HEADS; i++) {
+    snprintf(path, sizeof(path), "/SOUNDS/en/%04d.wav", 100 + i);
+    uint32_t other = PromptCache::getKey(path);
+    cache.add(other, stamp, info);
+    cache.find(other, stamp);
+    cache.getHead(other, fill);
+    EXPECT_TRUE(fill);
+  }
+  EXPECT_EQ(nullptr, cache.getHeadData(head, key, size));
+
+  // least recently used entries are replaced
+  EXPECT_NE(nullptr, cache.find(key, stamp));
+  for (int i = 0; i < PROMPT_CACHE_ENTRIES; i++) {
+    snprintf(path, sizeof(path), "/SOUNDS/en/%04d.wav", 200 + i);
+    cache.add(PromptCache::getKey(path), stamp, info);
+  }
+  EXPECT_EQ(nullptr, cache.find(key, stamp));
+
+  cache.add(key, stamp, info);
+  cache.invalidate();
+  EXPECT_EQ(nullptr, cache.find(key, stamp));
+}
+
+TEST(Audio, PromptCacheReplacedFile)
+{
+  static PromptCache cache;
+  cache.invalidate();
+
+  uint32_t key = PromptCache::getKey("/SOUNDS/en/0001.wav");
+  PromptStamp stamp = {1044, 0x5A21, 0x6000};
+  PromptInfo info = {};
+  info.dataOffset = 44;
+  info.dataSize = 1000;
+  info.freq = 16000;
+  cache.add(key, stamp, info);
+  ASSERT_NE(nullptr, cache.find(key, stamp));
+
+  bool fill;
+  uint8_t head = cache.getHead(key, fill);
+  ASSERT_NE(PROMPT_CACHE_NO_HEAD, head);
+  cache.setHeadSize(head, PROMPT_CACHE_HEAD_SIZE);
+
+  // same name, other size: the entry and its head are dropped
+  PromptStamp other = stamp;
+  other.size = 2088;
+  EXPECT_EQ(nullptr, cache.find(key, other));
+  uint16_t size;
+  EXPECT_EQ(nullptr, cache.getHeadData(head, key, size));
+  EXPECT_EQ(nullptr, cache.find(key, stamp));
+
+  // same size, other date or time
+  cache.add(key, stamp, info);
+  other = stamp;
+  other.time++;
+  EXPECT_EQ(nullptr, cache.find(key, other));
+  cache.add(key, stamp, info);
+  other = stamp;
+  other.date++;
+  EXPECT_EQ(nullptr, cache.find(key, other));
+
+  // added again once parsed: a single entry
+  info.dataSize = 2044;
+  cache.add(key, other, info);
+  const PromptInfo * cached = cache.find(key, other);
+  ASSERT_NE(nullptr, cached);
+  EXPECT_EQ(2044U, cached->dataSize);
+}
@@ -42,4 +42,73 @@ TEST(Storage, BackupAndRestore)
   if (memcmp(&ramBackupUncompressed, &ramBackupRestored, sizeof(ramBackupUncompressed)) != 0)
     TRACE("ERROR restore");
 }
+
+#if defined(RTC_BACKUP_DELTA)
+static void checkBackupRestore()
+{
+  Backup::RamBackupUncompressed * expected = (Backup::RamBackupUncompressed *)malloc(sizeof(ramBackupUncompressed));
+  memcpy(expected, &ramBackupUncompressed, sizeof(ramBackupUncompressed));
+  memset(&ramBackupUncompressed, 0xA5, sizeof(ramBackupUncompressed));
+
+  EXPECT_TRUE(rambackupRestore());
+  EXPECT_EQ(0, memcmp(expected, &ramBackupUncompressed, sizeof(ramBackupUncompressed)));
+  free(expected);
+}
+
+class StorageTest : public EdgeTxTest {};
+
+TEST_F(StorageTest, BackupDeltaRandomMutation)
+{
+  RadioData * radioSaved = (RadioData *)malloc(sizeof(RadioData));
+  memcpy(radioSaved, &g_eeGeneral, sizeof(RadioData));
+
+  // first write after boot is a full image
+  memset(ramBackup, 0, sizeof(RamBackup));
+  rambackupRestore();
+  rambackupWrite();
+  EXPECT_NE(0, (int)ramBackup->size);
+  EXPECT_EQ(0, (int)ramBackup->deltaSize);
+  checkBackupRestore();
+
+  // small change: a single delta record
+  g_model.header.name[0] ^= 1;
+  rambackupWrite();
+  EXPECT_NE(0, (int)ramBackup->deltaSize);
+  EXPECT_LT((int)ramBackup->deltaSize, 16);
+  checkBackupRestore();
+
+  // nothing changed: nothing written
+  uint16_t deltaSize = ramBackup->deltaSize;
+  rambackupWrite();
+  EXPECT_EQ(deltaSize, (uint16_t)ramBackup->deltaSize);
+
+  // mutations are kept in a window of the model, so that the full image
+  // still fits in the backup
+  srand(42);
+  uint8_t * model = (uint8_t *)&g_model;
+  const unsigned window = min<unsigned>(512, sizeof(g_model));
+  uint8_t * radio = (uint8_t *)&g_eeGeneral;
+  for (int i = 0; i < 500; i++) {
+    int count = (i % 50 == 0) ? 500 : rand() % 8;
+    for (int j = 0; j < count; j++) {
+      model[rand() % window] = (rand() & 3) ? rand() : 0;
+    }
+    if (rand() % 4 == 0) {
+      radio[rand() % sizeof(g_eeGeneral)] ^= 1 << (rand() % 8);
+    }
+    rambackupWrite();
+
+    // an interrupted write must not corrupt the backup
+    unsigned end = ramBackup->size + ramBackup->deltaSize;
+    for (unsigned j = end; j < end + 16 && j < sizeof(ramBackup->data); j++) {
+      ramBackup->data[j] = rand();
+    }
+
+    checkBackupRestore();
+  }
+
+  memcpy(&g_eeGeneral, radioSaved, sizeof(RadioData));
+  free(radioSaved);
+}
+#endif
 #endif
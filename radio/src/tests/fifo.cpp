@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "gtests.h"
+#include "fifo.h"
+
+#include <thread>
+
+TEST(Fifo, PushPop)
+{
+  Fifo<uint8_t, 8> fifo;
+  uint8_t value;
+
+  EXPECT_TRUE(fifo.isEmpty());
+  EXPECT_FALSE(fifo.pop(value));
+  EXPECT_EQ(7U, fifo.capacity());
+
+  for (uint8_t i = 0; i < 7; i++) {
+    EXPECT_TRUE(fifo.push(i));
+  }
+  EXPECT_TRUE(fifo.isFull());
+  EXPECT_FALSE(fifo.hasSpace(1));
+
+  // full: dropped and counted
+  EXPECT_FALSE(fifo.push(7));
+  EXPECT_EQ(1U, fifo.overflows());
+
+  EXPECT_TRUE(fifo.probe(value));
+  EXPECT_EQ(0, value);
+  for (uint8_t i = 0; i < 7; i++) {
+    EXPECT_TRUE(fifo.pop(value));
+    EXPECT_EQ(i, value);
+  }
+  EXPECT_TRUE(fifo.isEmpty());
+}
+
+TEST(Fifo, Bulk)
+{
+  Fifo<uint8_t, 8> fifo;
+  const uint8_t data[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  uint8_t out[sizeof(data)];
+
+  // move the indexes close to the end of the buffer
+  EXPECT_EQ(5U, fifo.push(data, 5));
+  EXPECT_EQ(5U, fifo.pop(out, sizeof(out)));
+
+  // wraps around
+  EXPECT_EQ(6U, fifo.push(data, 6));
+  EXPECT_EQ(6U, fifo.size());
+  EXPECT_EQ(6U, fifo.pop(out, sizeof(out)));
+  EXPECT_EQ(0, memcmp(data, out, 6));
+
+  // partial push
+  EXPECT_EQ(7U, fifo.push(data, sizeof(data)));
+  EXPECT_EQ(2U, fifo.overflows());
+  fifo.clear();
+
+  // all or nothing
+  EXPECT_TRUE(fifo.pushAll(data, 4));
+  EXPECT_FALSE(fifo.pushAll(data, 4));
+  EXPECT_EQ(4U, fifo.size());
+  EXPECT_EQ(6U, fifo.overflows());
+}
+
+TEST(Fifo, Spans)
+{
+  Fifo<uint8_t, 8> fifo;
+  uint8_t* wspan;
+  const uint8_t* rspan;
+
+  EXPECT_EQ(7U, fifo.writeSpan(wspan));
+  EXPECT_EQ(0U, fifo.readSpan(rspan));
+
+  for (int i = 0; i < 6; i++) wspan[i] = i;
+  fifo.commitWrite(6);
+
+  EXPECT_EQ(6U, fifo.readSpan(rspan));
+  EXPECT_EQ(0, rspan[0]);
+  fifo.commitRead(4);
+
+  // free space is split: only up to the end of the buffer
+  EXPECT_EQ(2U, fifo.writeSpan(wspan));
+  wspan[0] = 6;
+  wspan[1] = 7;
+  fifo.commitWrite(2);
+
+  // then from the start
+  EXPECT_EQ(3U, fifo.writeSpan(wspan));
+  EXPECT_EQ(fifo.buffer(), wspan);
+  wspan[0] = 8;
+  fifo.commitWrite(1);
+
+  EXPECT_EQ(4U, fifo.readSpan(rspan));
+  EXPECT_EQ(4, rspan[0]);
+  fifo.commitRead(4);
+  EXPECT_EQ(1U, fifo.readSpan(rspan));
+  EXPECT_EQ(8, rspan[0]);
+}
+
+TEST(Fifo, ThreadStress)
+{
+  // one producer and one consumer thread, mixing single elements, bulk
+  // operations and spans: the consumer must see the sequence in order
+  static Fifo<uint32_t, 64> fifo;
+  const uint32_t count = 1000000;
+  fifo.clear();
+
+  std::thread producer([&]() {
+    uint32_t next = 0;
+    uint32_t chunk[7];
+    while (next < count) {
+      if (!fifo.hasSpace(DIM(chunk))) std::this_thread::yield();
+      switch (next % 3) {
+        case 0:
+          if (fifo.push(next)) next++;
+          break;
+        case 1: {
+          uint32_t len = std::min<uint32_t>(DIM(chunk), count - next);
+          for (uint32_t i = 0; i < len; i++) chunk[i] = next + i;
+          if (fifo.pushAll(chunk, len)) next += len;
+          break;
+        }
+        default: {
+          uint32_t* span;
+          uint32_t len = std::min(fifo.writeSpan(span), count - next);
+          for (uint32_t i = 0; i < len; i++) span[i] = next + i;
+          fifo.commitWrite(len);
+          next += len;
+          break;
+        }
+      }
+    }
+  });
+
+  uint32_t expected = 0;
+  uint32_t errors = 0;
+  uint32_t chunk[5];
+  while (expected < count) {
+    if (fifo.isEmpty()) std::this_thread::yield();
+    if (expected & 1) {
+      const uint32_t* span;
+      uint32_t len = fifo.readSpan(span);
+      for (uint32_t i = 0; i < len; i++) {
+        if (span[i] != expected++) errors++;
+      }
+      fifo.commitRead(len);
+    } else if (expected & 2) {
+      uint32_t value;
+      if (fifo.pop(value) && value != expected++) errors++;
+    } else {
+      uint32_t len = fifo.pop(chunk, DIM(chunk));
+      for (uint32_t i = 0; i < len; i++) {
+        if (chunk[i] != expected++) errors++;
+      }
+    }
+  }
+
+  producer.join();
+  EXPECT_EQ(0U, errors);
+  EXPECT_EQ(count, expected);
+  EXPECT_TRUE(fifo.isEmpty());
+}
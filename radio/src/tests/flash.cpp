@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "gtests.h"
+#include "hal/flash_writer.h"
+
+#include <chrono>
+#include <vector>
+
+// Simulated 1MB internal flash, STM32F4 sector layout. Programming is done
+// by 32 bytes flash words (like STM32H7) that must be erased first.
+#define SIMU_FLASH_BASE   0x08000000
+#define SIMU_FLASH_SIZE   (1024 * 1024)
+#define SIMU_FLASH_WORD   32
+
+static uint8_t simuFlash[SIMU_FLASH_SIZE];
+static uint32_t simuFlashErases;
+static uint32_t simuFlashPrograms;
+static uint32_t simuFlashErrors;
+
+static uint32_t simuFlashGetSizeKb() { return SIMU_FLASH_SIZE / 1024; }
+
+static uint32_t simuFlashGetSector(uint32_t address)
+{
+  address -= SIMU_FLASH_BASE;
+  if (address < 0x10000) return address / 0x4000;
+  if (address < 0x20000) return 4;
+  return 4 + address / 0x20000;
+}
+
+static uint32_t simuFlashGetSectorSize(uint32_t sector)
+{
+  if (sector < 4) return 16 * 1024;
+  if (sector == 4) return 64 * 1024;
+  return 128 * 1024;
+}
+
+static int simuFlashEraseSector(uint32_t address)
+{
+  uint32_t size = simuFlashGetSectorSize(simuFlashGetSector(address));
+  uint32_t offset = (address - SIMU_FLASH_BASE) & ~(size - 1);
+  memset(&simuFlash[offset], 0xFF, size);
+  simuFlashErases++;
+  return 0;
+}
+
+static int simuFlashProgram(uint32_t address, void* data, uint32_t len)
+{
+  uint32_t offset = address - SIMU_FLASH_BASE;
+  if ((offset | len) & (SIMU_FLASH_WORD - 1) || offset + len > SIMU_FLASH_SIZE) {
+    simuFlashErrors++;
+    return -1;
+  }
+  for (uint32_t i = 0; i < len; i++) {
+    // a flash word can be programmed only once after an erase
+    if (simuFlash[offset + i] != 0xFF) simuFlashErrors++;
+  }
+  memcpy(&simuFlash[offset], data, len);
+  simuFlashPrograms++;
+  return 0;
+}
+
+static int simuFlashRead(uint32_t address, void* data, uint32_t len)
+{
+  memcpy(data, &simuFlash[address - SIMU_FLASH_BASE], len);
+  return 0;
+}
+
+static const etx_flash_driver_t simuFlashDriver = {
+  .get_size_kb = simuFlashGetSizeKb,
+  .get_sector = simuFlashGetSector,
+  .get_sector_size = simuFlashGetSectorSize,
+  .erase_sector = simuFlashEraseSector,
+  .program = simuFlashProgram,
+  .read = simuFlashRead,
+};
+
+class FlashWriterTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    if (!flashFindDriver(SIMU_FLASH_BASE)) {
+      flashRegisterDriver(SIMU_FLASH_BASE, SIMU_FLASH_SIZE, &simuFlashDriver);
+    }
+    // random content, as if programmed before
+    for (uint32_t i = 0; i < SIMU_FLASH_SIZE; i++) simuFlash[i] = i * 7 + 3;
+    simuFlashErases = simuFlashPrograms = simuFlashErrors = 0;
+  }
+
+  static std::vector<uint8_t> image(uint32_t size)
+  {
+    std::vector<uint8_t> data(size);
+    for (uint32_t i = 0; i < size; i++) data[i] = (i * 2654435761u) >> 24;
+    return data;
+  }
+};
+
+TEST_F(FlashWriterTest, Sequential)
+{
+  // firmware after a 32KB bootloader, written in odd sized chunks
+  const uint32_t start = SIMU_FLASH_BASE + 0x8000;
+  auto data = image(300 * 1024 + 100);
+  std::vector<uint8_t> bootloader(simuFlash, simuFlash + 0x8000);
+
+  FlashWriter writer;
+  writer.begin(start, data.size());
+  for (uint32_t pos = 0; pos < data.size(); pos += 1000) {
+    uint32_t len = std::min<uint32_t>(1000, data.size() - pos);
+    EXPECT_EQ(0, writer.write(&data[pos], len));
+  }
+  EXPECT_EQ(0, writer.flush());
+
+  EXPECT_EQ(0U, simuFlashErrors);
+  EXPECT_EQ(0, memcmp(data.data(), &simuFlash[0x8000], data.size()));
+  EXPECT_EQ(0, memcmp(bootloader.data(), simuFlash, bootloader.size()));
+
+  // padding up to the next flash word is left erased
+  EXPECT_EQ(0xFF, simuFlash[0x8000 + data.size()]);
+
+  // sectors 2..6 erased once each, one burst per 2KB block
+  EXPECT_EQ(5U, simuFlashErases);
+  EXPECT_EQ((data.size() + FLASH_WRITER_BLOCK_SIZE - 1) / FLASH_WRITER_BLOCK_SIZE,
+            simuFlashPrograms);
+}
+
+TEST_F(FlashWriterTest, Blocks)
+{
+  // UF2 like: 256 bytes payloads, out of order, erased by the caller
+  const uint32_t start = SIMU_FLASH_BASE + 0x20000;
+  auto data = image(64 * 1024);
+  simuFlashEraseSector(start);
+
+  FlashWriter writer;
+  writer.begin(start, 0, nullptr, false);
+  for (uint32_t block = 0; block < 256; block++) {
+    uint32_t pos = ((block * 37) % 256) * 256;
+    EXPECT_EQ(0, writer.write(start + pos, &data[pos], 256));
+  }
+  EXPECT_EQ(0, writer.flush());
+
+  EXPECT_EQ(0U, simuFlashErrors);
+  EXPECT_EQ(1U, simuFlashErases);
+  EXPECT_EQ(writer.getWritten(), 256U * 256U);
+}
+
+// Timing only, run with --gtest_also_run_disabled_tests
+TEST_F(FlashWriterTest, DISABLED_Benchmark)
+{
+  const uint32_t start = SIMU_FLASH_BASE + 0x20000;
+  auto data = image(SIMU_FLASH_SIZE - 0x20000);
+
+  for (uint32_t chunk: {256, 4096}) {
+    SetUp();
+    auto begin = std::chrono::steady_clock::now();
+
+    FlashWriter writer;
+    writer.begin(start, data.size());
+    for (uint32_t pos = 0; pos < data.size(); pos += chunk) {
+      writer.write(&data[pos], chunk);
+    }
+    writer.flush();
+
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin);
+    EXPECT_EQ(0U, simuFlashErrors);
+    EXPECT_EQ(0, memcmp(data.data(), &simuFlash[0x20000], data.size()));
+
+    printf("FlashWriter %u bytes chunks: %u erases, %u programs, %.1f MB/s\n",
+           chunk, simuFlashErases, simuFlashPrograms,
+           data.size() / std::max<double>(1, duration.count()));
+  }
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "gtests.h"
+
+#if defined(INTERNAL_GPS)
+
+#include "gps.h"
+
+// Captured from a GlobalSat module (GP talker), then from a multi-GNSS
+// module with more decimals (GN talker)
+static const char nmeaCapture[] =
+    "$GPRMC,092750.000,A,5321.6802,N,00630.3372,W,0.02,31.66,280511,,,A*43\r\n"
+    "$GPGGA,092750.000,5321.6802,N,00630.3372,W,1,8,1.03,61.7,M,55.2,M,,*76\r\n"
+    "$GPGSA,A,3,10,07,05,02,29,04,08,13,,,,,1.72,1.03,1.38*0A\r\n"
+    "$GPGSV,3,1,11,10,63,137,17,07,61,098,15,05,59,290,20,08,54,157,30*70\r\n"
+    "$GNRMC,092751.000,A,5321.680215,N,00630.337203,W,12.5,245.3,280511,,,A*5D\r\n"
+    "$GNGGA,092751.000,5321.680215,N,00630.337203,W,2,12,0.8,-12.4,M,55.2,M,,*46\r\n";
+
+// UBX-NAV-PVT, UBX-ACK-ACK, UBX-NAV-DOP
+static const uint8_t ubxCapture[] = {
+  0xB5, 0x62, 0x01, 0x07, 0x5C, 0x00, 0x20, 0x83, 0x00, 0x02, 0xDB, 0x07,
+  0x05, 0x1C, 0x09, 0x1B, 0x33, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x01, 0x00, 0x0E, 0x38, 0x52, 0x1F, 0xFC, 0x3A, 0x4B,
+  0xCE, 0x1F, 0x08, 0xC9, 0x01, 0x00, 0x04, 0xF1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x0C, 0x00, 0x00, 0x50, 0x4C,
+  0x76, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x38, 0x4B, 0xB5, 0x62, 0x05, 0x01, 0x02, 0x00, 0x06, 0x01,
+  0x0F, 0x38, 0xB5, 0x62, 0x01, 0x04, 0x12, 0x00, 0x20, 0x83, 0x00, 0x02,
+  0xB4, 0x00, 0x96, 0x00, 0x5A, 0x00, 0x78, 0x00, 0x67, 0x00, 0x50, 0x00,
+  0x46, 0x00, 0xD5, 0x3D,
+};
+
+class GpsTest : public EdgeTxTest
+{
+ protected:
+  void SetUp() override
+  {
+    EdgeTxTest::SetUp();
+    memclear(&gpsData, sizeof(gpsData));
+  }
+
+  void TearDown() override
+  {
+    gpsSetSerialDriver(nullptr, nullptr, GPS_PROTOCOL_AUTO);
+  }
+
+  static void feed(const uint8_t* data, uint32_t len, uint32_t chunk)
+  {
+    while (len > 0) {
+      uint32_t count = min(len, chunk);
+      gpsProcessBytes(data, count);
+      data += count;
+      len -= count;
+    }
+  }
+};
+
+TEST_F(GpsTest, Coordinates)
+{
+  EXPECT_EQ(48117300U, GPS_coord_to_degrees("4807.038", 8));
+  EXPECT_EQ(11516667U, GPS_coord_to_degrees("01131.000", 9));
+  EXPECT_EQ(53361337U, GPS_coord_to_degrees("5321.680215", 11));
+  EXPECT_EQ(12000000U, GPS_coord_to_degrees("1200", 4));
+  EXPECT_EQ(0U, GPS_coord_to_degrees("", 0));
+  EXPECT_EQ(0U, GPS_coord_to_degrees("123456.7", 8));
+}
+
+TEST_F(GpsTest, NMEA)
+{
+  // the result does not depend on how the data is received
+  for (uint32_t chunk : {1U, 7U, 64U, (uint32_t)sizeof(nmeaCapture)}) {
+    memclear(&gpsData, sizeof(gpsData));
+    gpsSetSerialDriver(nullptr, nullptr, GPS_PROTOCOL_NMEA);
+    feed((const uint8_t*)nmeaCapture, strlen(nmeaCapture), chunk);
+
+    EXPECT_EQ(6U, gpsData.packetCount) << "chunk=" << chunk;
+    EXPECT_EQ(0U, gpsData.errorCount);
+    EXPECT_EQ(1, gpsData.fix);
+    EXPECT_EQ(12, gpsData.numSat);
+    EXPECT_EQ(53361337, gpsData.latitude);
+    EXPECT_EQ(-6505620, gpsData.longitude);
+    EXPECT_EQ(-12, gpsData.altitude);
+    EXPECT_EQ(80, gpsData.hdop);
+    EXPECT_EQ(125 * 5144 / 1000, gpsData.speed);
+    EXPECT_EQ(2453, gpsData.groundCourse);
+  }
+}
+
+TEST_F(GpsTest, NMEAErrors)
+{
+  gpsSetSerialDriver(nullptr, nullptr, GPS_PROTOCOL_NMEA);
+
+  // bad checksum
+  std::string data(nmeaCapture);
+  data[data.find("61.7")] = '7';
+  feed((const uint8_t*)data.data(), data.size(), 64);
+  EXPECT_EQ(1U, gpsData.errorCount);
+  EXPECT_EQ(5U, gpsData.packetCount);
+
+  // truncated sentence, followed by a complete one
+  const char* truncated = "$GPGGA,092750.000,5321.6802,N,006";
+  feed((const uint8_t*)truncated, strlen(truncated), 64);
+  const char* gga = strstr(nmeaCapture, "$GPGGA");
+  feed((const uint8_t*)gga, strchr(gga, '\n') + 1 - gga, 64);
+  EXPECT_EQ(1U, gpsData.errorCount);
+  EXPECT_EQ(6U, gpsData.packetCount);
+  EXPECT_EQ(61, gpsData.altitude);
+  EXPECT_EQ(103, gpsData.hdop);
+  EXPECT_EQ(8, gpsData.numSat);
+}
+
+TEST_F(GpsTest, UBX)
+{
+  // whole frames are decoded in place, split ones through the buffer
+  for (uint32_t chunk : {1U, 7U, 64U, (uint32_t)sizeof(ubxCapture)}) {
+    memclear(&gpsData, sizeof(gpsData));
+    gpsSetSerialDriver(nullptr, nullptr, GPS_PROTOCOL_UBX);
+    feed(ubxCapture, sizeof(ubxCapture), chunk);
+
+    EXPECT_EQ(3U, gpsData.packetCount) << "chunk=" << chunk;
+    EXPECT_EQ(0U, gpsData.errorCount);
+    EXPECT_EQ(1, gpsData.fix);
+    EXPECT_EQ(14, gpsData.numSat);
+    EXPECT_EQ(53361337, gpsData.latitude);
+    EXPECT_EQ(-6505620, gpsData.longitude);
+    EXPECT_EQ(617, gpsData.altitude);
+    EXPECT_EQ(32, gpsData.speed);
+    EXPECT_EQ(2453, gpsData.groundCourse);
+    EXPECT_EQ(103, gpsData.hdop);
+  }
+
+  // corrupted payload
+  memclear(&gpsData, sizeof(gpsData));
+  uint8_t data[sizeof(ubxCapture)];
+  memcpy(data, ubxCapture, sizeof(data));
+  data[30] ^= 0x01;
+  feed(data, sizeof(data), sizeof(data));
+  EXPECT_EQ(1U, gpsData.errorCount);
+  EXPECT_EQ(2U, gpsData.packetCount);
+  EXPECT_EQ(0, gpsData.latitude);
+}
+
+#endif
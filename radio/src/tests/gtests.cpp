@@ -122,9 +122,11 @@ class TersePrinter : public EmptyTestEventListener  {
 
 int32_t lastAct = 0;
 
+uint16_t simuAnalogs[MAX_ANALOG_INPUTS];
+
 uint16_t simu_get_analog(uint8_t idx)
 {
-  return 0;
+  return idx < MAX_ANALOG_INPUTS ? simuAnalogs[idx] : 0;
 }
 
 void simuQueueAudio(const uint8_t*, uint32_t) {}
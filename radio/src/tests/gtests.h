@@ -37,6 +37,9 @@ extern int32_t lastAct;
 extern void anaResetFiltered();
 extern void anaSetFiltered(uint8_t chan, uint16_t val);
 
+// raw analog values returned by the simu ADC driver
+extern uint16_t simuAnalogs[MAX_ANALOG_INPUTS];
+
 void doMixerCalculations();
 
 extern const char * zchar2string(const char * zstring, int size);
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "gtests.h"
+#include "imu_fusion.h"
+#include "drivers/imu_filter.h"
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#define TRACE_RATE        200     // Hz, as the float reference
+#define TRACE_GYRO_RANGE  2000    // dps
+#define TRACE_ACCEL_1G    8192    // +/-4g
+
+struct ImuSample {
+  int16_t gyro[3];
+  int16_t accel[3];
+  double roll, pitch, yaw;  // degrees
+};
+
+static double binaryToDeg(int32_t angle)
+{
+  return angle * 90.0 / IMU_ANGLE_90;
+}
+
+static double angleError(double a, double b)
+{
+  return std::abs(std::remainder(a - b, 360.0));
+}
+
+// Head tracking like motion, with sensor noise
+static std::vector<ImuSample> imuTrace(double seconds)
+{
+  std::mt19937 rng(42);
+  std::normal_distribution<double> gyroNoise(0, 3), accelNoise(0, 20);
+  std::vector<ImuSample> trace;
+
+  const double d2r = M_PI / 180;
+  const double gyroScale = 32768.0 / TRACE_GYRO_RANGE / d2r;  // LSB / rad/s
+
+  for (int i = 0; i < seconds * TRACE_RATE; i++) {
+    double t = double(i) / TRACE_RATE;
+    double w1 = 2 * M_PI * 0.2, w2 = 2 * M_PI * 0.13, w3 = 2 * M_PI * 0.05;
+
+    double r = 40 * d2r * sin(w1 * t), dr = 40 * d2r * w1 * cos(w1 * t);
+    double p = 25 * d2r * sin(w2 * t + 1), dp = 25 * d2r * w2 * cos(w2 * t + 1);
+    double y = 90 * d2r * sin(w3 * t), dy = 90 * d2r * w3 * cos(w3 * t);
+
+    // ZYX Euler rates to body rates
+    double wx = dr - dy * sin(p);
+    double wy = dp * cos(r) + dy * cos(p) * sin(r);
+    double wz = -dp * sin(r) + dy * cos(p) * cos(r);
+
+    ImuSample s;
+    s.gyro[0] = lround(wx * gyroScale + gyroNoise(rng));
+    s.gyro[1] = lround(wy * gyroScale + gyroNoise(rng));
+    s.gyro[2] = lround(wz * gyroScale + gyroNoise(rng));
+    s.accel[0] = lround(-sin(p) * TRACE_ACCEL_1G + accelNoise(rng));
+    s.accel[1] = lround(sin(r) * cos(p) * TRACE_ACCEL_1G + accelNoise(rng));
+    s.accel[2] = lround(cos(r) * cos(p) * TRACE_ACCEL_1G + accelNoise(rng));
+    s.roll = r / d2r;
+    s.pitch = p / d2r;
+    s.yaw = y / d2r;
+    trace.push_back(s);
+  }
+
+  return trace;
+}
+
+static ImuFusionConfig traceConfig(uint8_t mode)
+{
+  // same coefficients as the float reference
+  return {TRACE_RATE, TRACE_GYRO_RANGE, 0, IMU_Q15(0.92), IMU_Q15(0.9), mode};
+}
+
+static void referenceUpdate(const ImuSample& s)
+{
+  const double radps = TRACE_GYRO_RANGE / 32768.0 * M_PI / 180;
+  IMU_RawData_t raw = {};
+  raw.gyro_x = s.gyro[0] * radps;
+  raw.gyro_y = s.gyro[1] * radps;
+  raw.gyro_z = s.gyro[2] * radps;
+  raw.accel_x = s.accel[0];
+  raw.accel_y = s.accel[1];
+  raw.accel_z = s.accel[2];
+  process_imu_data(&raw);
+}
+
+TEST(ImuFusion, Trigonometry)
+{
+  double maxError = 0;
+  for (int deg10 = -1800; deg10 < 1800; deg10 += 7) {
+    double a = deg10 / 10.0 * M_PI / 180;
+    for (double m : {1.0, 100.0, 46341.0, 1e9}) {
+      int32_t angle = imuAtan2(lround(m * sin(a)), lround(m * cos(a)));
+      double expected = atan2(lround(m * sin(a)), lround(m * cos(a)));
+      maxError = std::max(maxError,
+                          angleError(binaryToDeg(angle), expected * 180 / M_PI));
+    }
+
+    int32_t s, c;
+    imuSinCos(deg10 * (IMU_ANGLE_90 / 900.0), s, c);
+    EXPECT_NEAR(sin(a), s / double(IMU_QUAT_ONE), 1e-6);
+    EXPECT_NEAR(cos(a), c / double(IMU_QUAT_ONE), 1e-6);
+  }
+  EXPECT_LT(maxError, 0.001);
+
+  EXPECT_EQ(0U, imuSqrt(0));
+  EXPECT_EQ(46340U, imuSqrt(2147483647));
+  EXPECT_EQ(1U << 30, imuSqrt((uint64_t)1 << 60));
+}
+
+TEST(ImuFusion, EulerVsFloat)
+{
+  auto trace = imuTrace(60);
+
+  ImuFusion fusion;
+  fusion.init(traceConfig(IMU_FUSION_EULER));
+  reset_imu_filter();
+
+  double maxAngle = 0, maxAccel = 0, maxGyro = 0;
+  for (auto& s : trace) {
+    fusion.update(s.gyro, s.accel);
+    referenceUpdate(s);
+
+    auto ref = get_filtered_imu_data();
+    maxAngle = std::max(
+        {maxAngle,
+         angleError(binaryToDeg(fusion.roll()), ref->roll * 180 / M_PI),
+         angleError(binaryToDeg(fusion.pitch()), ref->pitch * 180 / M_PI),
+         angleError(binaryToDeg(fusion.yaw()), ref->yaw * 180 / M_PI)});
+    for (uint8_t i = 0; i < 3; i++) {
+      double accel = (&ref->accel_x)[i];
+      maxAccel = std::max(maxAccel, std::abs(fusion.accel(i) - accel));
+    }
+    maxGyro = std::max(maxGyro, std::abs(fusion.gyro(0) * TRACE_GYRO_RANGE /
+                                             32768.0 * M_PI / 180 -
+                                         ref->gyro_x));
+  }
+
+  EXPECT_LT(maxAngle, 0.05);
+  EXPECT_LE(maxAccel, 1.0);
+  EXPECT_LT(maxGyro, 0.002);
+}
+
+TEST(ImuFusion, Quaternion)
+{
+  auto trace = imuTrace(60);
+
+  ImuFusion fusion;
+  fusion.init(traceConfig(IMU_FUSION_QUATERNION));
+
+  double maxRoll = 0, maxPitch = 0, maxNorm = 0;
+  for (size_t i = 0; i < trace.size(); i++) {
+    auto& s = trace[i];
+    fusion.update(s.gyro, s.accel);
+
+    const int32_t* q = fusion.quaternion();
+    double norm = 0;
+    for (int j = 0; j < 4; j++) norm += pow(q[j] / double(IMU_QUAT_ONE), 2);
+    maxNorm = std::max(maxNorm, std::abs(norm - 1));
+
+    // after settling
+    if (i > TRACE_RATE) {
+      maxRoll = std::max(maxRoll, angleError(binaryToDeg(fusion.roll()), s.roll));
+      maxPitch =
+          std::max(maxPitch, angleError(binaryToDeg(fusion.pitch()), s.pitch));
+    }
+  }
+
+  EXPECT_LT(maxRoll, 2.0);
+  EXPECT_LT(maxPitch, 2.0);
+  EXPECT_LT(maxNorm, 1e-5);
+}
+
+// Timing only, run with --gtest_also_run_disabled_tests
+TEST(ImuFusion, DISABLED_Benchmark)
+{
+  auto trace = imuTrace(10);
+
+  for (int mode = -1; mode <= IMU_FUSION_QUATERNION; mode++) {
+    ImuFusion fusion;
+    if (mode >= 0) fusion.init(traceConfig(mode));
+    reset_imu_filter();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int loop = 0; loop < 10; loop++) {
+      for (auto& s : trace) {
+        if (mode < 0)
+          referenceUpdate(s);
+        else
+          fusion.update(s.gyro, s.accel);
+      }
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    printf("%s: %.3f us / sample\n",
+           mode < 0 ? "float" : mode == IMU_FUSION_EULER ? "euler" : "quaternion",
+           duration.count() / 1000.0 / (10 * trace.size()));
+  }
+}
@@ -23,6 +23,7 @@
 #include <math.h>
 #include <assert.h>
 #include <gtest/gtest.h>
+#include <chrono>
 
 #if !defined(COLORLCD)
 #include "simpgmspace.h"
@@ -541,4 +542,90 @@ TEST(Lcd, lcdDrawLine)
   EXPECT_TRUE(checkScreenshot("lcdDrawLine"));
 }
 #endif
+
+TEST(Lcd, RefreshChangedRows)
+{
+  lcdInvalidate();
+  lcdClear();
+  lcdDrawText(0, 0, "Static");
+  lcdRefresh();
+
+  // same screen drawn again: nothing sent
+  uint32_t bytes = lcdRefreshBytes;
+  lcdClear();
+  lcdDrawText(0, 0, "Static");
+  lcdRefresh();
+  EXPECT_EQ(bytes, lcdRefreshBytes);
+
+  // one line of text changed
+  lcdClear();
+  lcdDrawText(0, 0, "Static");
+  lcdDrawNumber(0, 3 * FH, 1234);
+  lcdRefresh();
+  EXPECT_GT(lcdRefreshBytes, bytes);
+  EXPECT_LE(lcdRefreshBytes - bytes, 2U * LCD_REFRESH_ROW_SIZE);
+
+  // the result is the same as a full refresh
+  EXPECT_EQ(0, memcmp(simuLcdBuf, displayBuf, sizeof(displayBuf)));
+
+  lcdInvalidate();
+  bytes = lcdRefreshBytes;
+  lcdRefresh();
+  EXPECT_EQ(bytes + LCD_REFRESH_ROWS * LCD_REFRESH_ROW_SIZE, lcdRefreshBytes);
+}
+#if LCD_W < 212
+static uint64_t lcdColumn(coord_t x)
+{
+  uint64_t column = 0;
+  for (unsigned page = 0; page < LCD_H / 8; page++) {
+    column |= uint64_t(displayBuf[page * LCD_W + x]) << (8 * page);
+  }
+  return column;
+}
+
+TEST(Lcd, PatternAllOffsets)
+{
+  // whole columns are written a byte at a time: the text must look the
+  // same at any vertical offset
+  const LcdFlags fonts[] = { 0, SMLSIZE, MIDSIZE, DBLSIZE };
+  for (auto font: fonts) {
+    for (auto flags: { font, font | INVERS, font | FIXEDWIDTH, font | CONDENSED }) {
+      uint64_t ref[LCD_W];
+      for (coord_t y = 1; y < LCD_H - 2 * FH; y++) {
+        lcdClear();
+        lcdDrawText(3, y, "Tg1:", flags);
+        for (coord_t x = 0; x < LCD_W; x++) {
+          if (y == 1)
+            ref[x] = lcdColumn(x);
+          else
+            ASSERT_EQ(ref[x] << (y - 1), lcdColumn(x))
+                << "flags=" << flags << " x=" << x << " y=" << y;
+        }
+      }
+    }
+  }
+}
+#endif
+
+// Timing only, run with --gtest_also_run_disabled_tests
+TEST(Lcd, DISABLED_PatternBenchmark)
+{
+  const char * text = "Telemetry 12.3V";
+  const unsigned chars = strlen(text);
+  const unsigned count = 20000;
+
+  const LcdFlags flags[] = { 0, INVERS, SMLSIZE, MIDSIZE, DBLSIZE };
+  for (auto f: flags) {
+    lcdClear();
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < count; i++) {
+      lcdDrawText(0, (i % 6) * FH + 1, text, f);
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    printf("lcdDrawText() flags 0x%04x: %.0f chars/ms\n", (unsigned)f,
+           count * chars * 1000.0 / std::max<int64_t>(1, duration.count()));
+  }
+}
 #endif
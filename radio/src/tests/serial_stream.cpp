@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "gtests.h"
+#include "crc.h"
+#include "serial_stream.h"
+#include "telemetry/telemetry.h"
+
+#include <vector>
+
+static std::vector<uint8_t> streamOutput;
+static std::vector<uint8_t> streamInput;
+
+static void testSendBuffer(void*, const uint8_t* data, uint32_t size)
+{
+  streamOutput.insert(streamOutput.end(), data, data + size);
+}
+
+// polled driver, as the simulator host serial port
+static int testGetByte(void*, uint8_t* data)
+{
+  if (streamInput.empty()) return 0;
+  *data = streamInput.front();
+  streamInput.erase(streamInput.begin());
+  return 1;
+}
+
+static const etx_serial_driver_t testDriver = {
+  .init = nullptr,
+  .deinit = nullptr,
+  .sendByte = nullptr,
+  .sendBuffer = testSendBuffer,
+  .txCompleted = nullptr,
+  .waitForTxCompleted = nullptr,
+  .enableRx = nullptr,
+  .getByte = testGetByte,
+  .getLastByte = nullptr,
+  .getBufferedBytes = nullptr,
+  .copyRxBuffer = nullptr,
+  .clearRxBuffer = nullptr,
+  .getBaudrate = nullptr,
+  .setBaudrate = nullptr,
+  .setPolarity = nullptr,
+  .setHWOption = nullptr,
+  .setReceiveCb = nullptr,
+  .setIdleCb = nullptr,
+  .setBaudrateCb = nullptr,
+};
+
+struct StreamFrame {
+  uint8_t type;
+  std::vector<uint8_t> payload;
+
+  uint16_t get16(int idx) const
+  {
+    return payload[idx] | (payload[idx + 1] << 8);
+  }
+
+  uint32_t get32(int idx) const
+  {
+    return get16(idx) | (get16(idx + 2) << 16);
+  }
+};
+
+class SerialStreamTest : public EdgeTxTest
+{
+ protected:
+  void SetUp() override
+  {
+    EdgeTxTest::SetUp();
+    telemetryReset();
+    streamOutput.clear();
+    streamInput.clear();
+    serialStreamStart(nullptr, &testDriver);
+  }
+
+  void TearDown() override { serialStreamStop(); }
+
+  static std::vector<uint8_t> frame(uint8_t type,
+                                    const std::vector<uint8_t>& payload)
+  {
+    std::vector<uint8_t> data = {STREAM_SYNC, (uint8_t)payload.size(), type};
+    data.insert(data.end(), payload.begin(), payload.end());
+    uint16_t crc = crc16(CRC_1021, &data[1], data.size() - 1);
+    data.push_back(crc);
+    data.push_back(crc >> 8);
+    return data;
+  }
+
+  static void subscribe(uint8_t stream, uint16_t period)
+  {
+    auto data = frame(STREAM_CMD_SUBSCRIBE,
+                      {stream, (uint8_t)period, (uint8_t)(period >> 8)});
+    serialStreamReceiveData(data.data(), data.size());
+  }
+
+  // Decodes (and checks) all the frames sent since the last call
+  static std::vector<StreamFrame> frames()
+  {
+    std::vector<StreamFrame> result;
+    size_t pos = 0;
+    while (pos < streamOutput.size()) {
+      EXPECT_EQ(STREAM_SYNC, streamOutput[pos]);
+      uint8_t len = streamOutput[pos + 1];
+      EXPECT_LE(pos + len + STREAM_FRAME_OVERHEAD, streamOutput.size());
+      uint16_t crc = crc16(CRC_1021, &streamOutput[pos + 1], len + 2);
+      EXPECT_EQ(crc & 0xFF, streamOutput[pos + len + 3]);
+      EXPECT_EQ(crc >> 8, streamOutput[pos + len + 4]);
+      auto begin = streamOutput.begin() + pos + 3;
+      result.push_back({streamOutput[pos + 2],
+                        std::vector<uint8_t>(begin, begin + len)});
+      pos += len + STREAM_FRAME_OVERHEAD;
+    }
+    streamOutput.clear();
+    return result;
+  }
+};
+
+TEST_F(SerialStreamTest, Commands)
+{
+  // noise, then a ping split over 2 reads
+  auto ping = frame(STREAM_CMD_PING, {});
+  std::vector<uint8_t> data = {0x00, 0x12};
+  data.insert(data.end(), ping.begin(), ping.begin() + 2);
+  serialStreamReceiveData(data.data(), data.size());
+  serialStreamWakeup(0);
+  EXPECT_TRUE(frames().empty());
+
+  serialStreamReceiveData(&ping[2], ping.size() - 2);
+  serialStreamWakeup(1);
+  auto result = frames();
+  ASSERT_EQ(1U, result.size());
+  EXPECT_EQ(STREAM_PONG, result[0].type);
+  EXPECT_EQ(STREAM_VERSION, result[0].payload[0]);
+  EXPECT_EQ(0, result[0].get16(1));
+
+  // corrupted frame, unknown stream
+  auto bad = frame(STREAM_CMD_PING, {});
+  bad[3] ^= 1;
+  serialStreamReceiveData(bad.data(), bad.size());
+  subscribe(STREAM_COUNT, 10);
+  serialStreamWakeup(2);
+  EXPECT_TRUE(frames().empty());
+
+  // polled driver
+  streamInput = ping;
+  serialStreamWakeup(3);
+  result = frames();
+  ASSERT_EQ(1U, result.size());
+  EXPECT_EQ(2, result[0].get16(1));
+
+  auto stop = frame(STREAM_CMD_STOP, {});
+  serialStreamReceiveData(stop.data(), stop.size());
+  serialStreamWakeup(4);
+  EXPECT_FALSE(serialStreamActive());
+}
+
+TEST_F(SerialStreamTest, Records)
+{
+  for (int i = 0; i < MAX_OUTPUT_CHANNELS; i++) {
+    channelOutputs[i] = i * 10 - 100;
+  }
+
+  subscribe(STREAM_CHANNELS, 10);
+  subscribe(STREAM_LOGICAL_SWITCHES, 20);
+  serialStreamWakeup(100);
+
+  auto result = frames();
+  ASSERT_EQ(2U, result.size());
+  EXPECT_EQ(STREAM_RECORD | STREAM_CHANNELS, result[0].type);
+  EXPECT_EQ(STREAM_RECORD_HEADER + 2 * MAX_OUTPUT_CHANNELS,
+            (int)result[0].payload.size());
+  EXPECT_EQ(0, result[0].get16(0));
+  for (int i = 0; i < MAX_OUTPUT_CHANNELS; i++) {
+    EXPECT_EQ(i * 10 - 100,
+              (int16_t)result[0].get16(STREAM_RECORD_HEADER + 2 * i));
+  }
+  EXPECT_EQ(STREAM_RECORD | STREAM_LOGICAL_SWITCHES, result[1].type);
+  EXPECT_EQ(STREAM_RECORD_HEADER + MAX_LOGICAL_SWITCHES / 8,
+            (int)result[1].payload.size());
+  EXPECT_EQ(1, result[1].get16(0));
+
+  // rates
+  serialStreamWakeup(105);
+  EXPECT_TRUE(frames().empty());
+  serialStreamWakeup(110);
+  result = frames();
+  ASSERT_EQ(1U, result.size());
+  EXPECT_EQ(STREAM_RECORD | STREAM_CHANNELS, result[0].type);
+  serialStreamWakeup(120);
+  EXPECT_EQ(2U, frames().size());
+
+  // no burst after a stall
+  serialStreamWakeup(200);
+  EXPECT_EQ(2U, frames().size());
+  serialStreamWakeup(205);
+  EXPECT_TRUE(frames().empty());
+
+  // unsubscribe
+  subscribe(STREAM_CHANNELS, 0);
+  serialStreamWakeup(220);
+  result = frames();
+  ASSERT_EQ(1U, result.size());
+  EXPECT_EQ(STREAM_RECORD | STREAM_LOGICAL_SWITCHES, result[0].type);
+}
+
+TEST_F(SerialStreamTest, Telemetry)
+{
+  // all sensors but the first one
+  for (int i = 1; i < MAX_TELEMETRY_SENSORS; i++) {
+    telemetryItems[i].value = -i;
+    telemetryItems[i].setFresh();
+  }
+
+  subscribe(STREAM_TELEMETRY, 50);
+  serialStreamWakeup(0);
+
+  // only the available sensors, over as many records as needed
+  auto result = frames();
+  const int perRecord = (STREAM_MAX_PAYLOAD - STREAM_RECORD_HEADER) / 5;
+  EXPECT_EQ((MAX_TELEMETRY_SENSORS - 2) / perRecord + 1, (int)result.size());
+  int count = 0;
+  for (auto& f : result) {
+    EXPECT_EQ(STREAM_RECORD | STREAM_TELEMETRY, f.type);
+    EXPECT_LE(f.payload.size(), STREAM_MAX_PAYLOAD);
+    for (size_t pos = STREAM_RECORD_HEADER; pos < f.payload.size(); pos += 5) {
+      uint8_t idx = f.payload[pos];
+      EXPECT_EQ(count + 1, idx);
+      EXPECT_EQ(-idx, (int32_t)f.get32(pos + 1));
+      count++;
+    }
+  }
+  EXPECT_EQ(MAX_TELEMETRY_SENSORS - 1, count);
+}
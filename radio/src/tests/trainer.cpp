@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "gtests.h"
+#include "sbus.h"
+#include "trainer.h"
+
+#include <vector>
+
+class TrainerTest : public EdgeTxTest
+{
+ protected:
+  void SetUp() override
+  {
+    EdgeTxTest::SetUp();
+    trainerResetSources();
+    sbusResetDecoder();
+    memclear(trainerInput, sizeof(trainerInput));
+  }
+
+  // SBUS frame with channel i at 'value + i' (raw 11 bits)
+  static std::vector<uint8_t> sbusFrame(uint16_t value, uint8_t flags = 0)
+  {
+    std::vector<uint8_t> frame(25, 0);
+    frame[0] = 0x0F;
+    uint32_t bits = 0;
+    uint8_t available = 0;
+    uint8_t idx = 1;
+    for (uint8_t i = 0; i < 16; i++) {
+      bits |= uint32_t(value + i) << available;
+      available += 11;
+      while (available >= 8) {
+        frame[idx++] = bits;
+        bits >>= 8;
+        available -= 8;
+      }
+    }
+    frame[23] = flags;
+    return frame;
+  }
+
+  static void feed(const std::vector<uint8_t>& data, uint32_t timestamp = 0)
+  {
+    sbusProcessBytes(data.data(), data.size(), timestamp);
+  }
+};
+
+TEST_F(TrainerTest, SbusFrames)
+{
+  // 0x3E0 is the center
+  feed(sbusFrame(0x3E0));
+  EXPECT_EQ(0, trainerInput[0]);
+  EXPECT_EQ(9, trainerInput[15]);  // 15 * 5 / 8
+  EXPECT_EQ(1U, trainerGetSourceStats(TRAINER_SOURCE_SBUS).frames);
+
+  // frame split over several reads
+  auto frame = sbusFrame(0x3E0 + 160);
+  feed(std::vector<uint8_t>(frame.begin(), frame.begin() + 10), 14);
+  EXPECT_EQ(0, trainerInput[0]);
+  feed(std::vector<uint8_t>(frame.begin() + 10, frame.end()), 14);
+  EXPECT_EQ(100, trainerInput[0]);
+
+  // 2 frames in the same read, SBUS2 end byte
+  auto frames = sbusFrame(0x3E0 - 160);
+  frames.back() = 0x14;
+  auto next = sbusFrame(0x3E0 + 320);
+  frames.insert(frames.end(), next.begin(), next.end());
+  feed(frames, 28);
+  EXPECT_EQ(200, trainerInput[0]);
+
+  auto& stats = trainerGetSourceStats(TRAINER_SOURCE_SBUS);
+  EXPECT_EQ(4U, stats.frames);
+  EXPECT_EQ(0U, stats.lost);
+  EXPECT_EQ(14, stats.maxInterval);
+}
+
+TEST_F(TrainerTest, SbusResync)
+{
+  feed(sbusFrame(0x3E0));
+
+  // truncated frame followed by a complete one
+  auto frame = sbusFrame(0x3E0 + 160);
+  std::vector<uint8_t> data(frame.begin(), frame.begin() + 12);
+  data.insert(data.end(), frame.begin(), frame.end());
+  feed(data);
+  EXPECT_EQ(100, trainerInput[0]);
+  EXPECT_EQ(2U, trainerGetSourceStats(TRAINER_SOURCE_SBUS).frames);
+  EXPECT_EQ(1U, trainerGetSourceStats(TRAINER_SOURCE_SBUS).lost);
+
+  // failsafe frames are not used
+  feed(sbusFrame(0x3E0 + 320, 1 << 3));
+  EXPECT_EQ(100, trainerInput[0]);
+  EXPECT_EQ(2U, trainerGetSourceStats(TRAINER_SOURCE_SBUS).lost);
+
+  // and do not break the sync
+  feed(sbusFrame(0x3E0 + 320));
+  EXPECT_EQ(200, trainerInput[0]);
+  EXPECT_EQ(2U, trainerGetSourceStats(TRAINER_SOURCE_SBUS).lost);
+}
+
+TEST_F(TrainerTest, Fusion)
+{
+  int16_t buddy[8] = {10, 11, 12, 13, 14, 15, 16, 17};
+  int16_t tracker[3] = {-50, -51, -52};
+
+  // channels 0..7 from the trainer jack
+  trainerPushChannels(TRAINER_SOURCE_PPM, 0, buddy, 8, 1000);
+  EXPECT_TRUE(isTrainerValid());
+
+  // head tracker on channels 8..10
+  trainerPushChannels(TRAINER_SOURCE_BLUETOOTH, 8, tracker, 3, 1010);
+  EXPECT_EQ(17, trainerInput[7]);
+  EXPECT_EQ(-50, trainerInput[8]);
+
+  // the jack has priority on the channels both send
+  trainerPushChannels(TRAINER_SOURCE_BLUETOOTH, 6, tracker, 3, 1020);
+  EXPECT_EQ(16, trainerInput[6]);
+  EXPECT_EQ(-52, trainerInput[8]);
+
+  // until it times out
+  trainerPushChannels(TRAINER_SOURCE_BLUETOOTH, 6, tracker, 3,
+                      1001 + TRAINER_SOURCE_TIMEOUT);
+  EXPECT_EQ(-50, trainerInput[6]);
+  EXPECT_EQ(10, trainerInput[0]);  // not sent by the head tracker
+
+  auto& stats = trainerGetSourceStats(TRAINER_SOURCE_BLUETOOTH);
+  EXPECT_EQ(3U, stats.frames);
+  EXPECT_EQ(81, stats.maxInterval);
+  EXPECT_EQ(10 + (81 - 10) / 8, stats.interval);
+}
+
+TEST_F(TrainerTest, SingleChannel)
+{
+  int16_t buddy[4] = {10, 11, 12, 13};
+  int16_t tracker[2] = {-50, -51};
+
+  trainerPushChannels(TRAINER_SOURCE_PPM, 0, buddy, 4, 1000);
+  trainerPushChannels(TRAINER_SOURCE_BLUETOOTH, 2, tracker, 2, 1000);
+
+  // published before the end of the frame, without counting a frame
+  trainerPushChannel(TRAINER_SOURCE_PPM, 1, 20, 1010);
+  EXPECT_EQ(20, trainerInput[1]);
+  EXPECT_EQ(1U, trainerGetSourceStats(TRAINER_SOURCE_PPM).frames);
+
+  // priorities still apply
+  trainerPushChannel(TRAINER_SOURCE_BLUETOOTH, 3, -60, 1010);
+  EXPECT_EQ(13, trainerInput[3]);
+}
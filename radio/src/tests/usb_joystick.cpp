@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "gtests.h"
+
+#if defined(USBJ_EX)
+
+#include "usb_joystick.h"
+
+#include <chrono>
+
+class UsbJoystickTest : public EdgeTxTest
+{
+ protected:
+  void SetUp() override
+  {
+    EdgeTxTest::SetUp();
+    memclear(channelOutputs, sizeof(channelOutputs));
+    g_model.usbJoystickExtMode = 1;
+  }
+
+  static void setButton(uint8_t ch, uint8_t mode, uint8_t btn, uint8_t npos = 0)
+  {
+    g_model.usbJoystickCh[ch].mode = USBJOYS_CH_BUTTON;
+    g_model.usbJoystickCh[ch].param = mode;
+    g_model.usbJoystickCh[ch].btn_num = btn;
+    g_model.usbJoystickCh[ch].switch_npos = npos;
+  }
+
+  static void setAxis(uint8_t ch, uint8_t axis)
+  {
+    g_model.usbJoystickCh[ch].mode = USBJOYS_CH_AXIS;
+    g_model.usbJoystickCh[ch].param = axis;
+  }
+
+  // returns true if a new report would be sent
+  static bool update(usbReport_t& report)
+  {
+    report = usbReport();
+    bool pending = usbReportPending();
+    usbReportSent();
+    return pending;
+  }
+
+  static uint16_t axis(const usbReport_t& report, uint8_t idx)
+  {
+    return report.ptr[idx * 2] | (report.ptr[idx * 2 + 1] << 8);
+  }
+};
+
+TEST_F(UsbJoystickTest, ChangedReports)
+{
+  setAxis(0, USBJOYS_AXIS_X);
+  setButton(1, USBJOYS_BTN_MODE_NORMAL, 0);
+  setButton(2, USBJOYS_BTN_MODE_NORMAL, 3, 2);
+  setupUSBJoystick();
+
+  // 1 axis, 32 buttons, battery
+  usbReport_t report;
+  EXPECT_TRUE(update(report));
+  EXPECT_EQ(7, report.size);
+  EXPECT_EQ(1024, axis(report, 0));
+  EXPECT_EQ(0x10, report.ptr[2]);  // 3 positions switch in the middle
+
+  // nothing changed
+  EXPECT_FALSE(update(report));
+
+  // channel not used by the report
+  channelOutputs[5] = 500;
+  EXPECT_FALSE(update(report));
+
+  channelOutputs[0] = 1024;
+  EXPECT_TRUE(update(report));
+  EXPECT_EQ(2048, axis(report, 0));
+
+  channelOutputs[1] = 100;
+  channelOutputs[2] = -1024;
+  EXPECT_TRUE(update(report));
+  EXPECT_EQ(0x09, report.ptr[2]);
+
+  // output changed, but the report is the same
+  channelOutputs[1] = 200;
+  EXPECT_FALSE(update(report));
+
+  // report not sent yet: still pending
+  channelOutputs[2] = 1024;
+  usbReport();
+  EXPECT_TRUE(update(report));
+  EXPECT_EQ(0x21, report.ptr[2]);
+
+  // new settings: report sent again
+  setupUSBJoystick();
+  EXPECT_TRUE(update(report));
+}
+
+TEST_F(UsbJoystickTest, ButtonPulse)
+{
+  setButton(0, USBJOYS_BTN_MODE_ON_PULSE, 4);
+  setupUSBJoystick();
+
+  usbReport_t report;
+  EXPECT_TRUE(update(report));
+  EXPECT_EQ(0, report.ptr[0]);
+
+  channelOutputs[0] = 1024;
+  EXPECT_TRUE(update(report));
+  EXPECT_EQ(0x10, report.ptr[0]);
+
+  // released after 200ms, with no change of the output
+  g_tmr10ms += 19;
+  EXPECT_FALSE(update(report));
+  g_tmr10ms += 1;
+  EXPECT_TRUE(update(report));
+  EXPECT_EQ(0, report.ptr[0]);
+  EXPECT_FALSE(update(report));
+}
+
+// Timing only, run with --gtest_also_run_disabled_tests
+TEST_F(UsbJoystickTest, DISABLED_Benchmark)
+{
+  for (uint8_t i = 0; i < 8; i++) setAxis(i, i);
+  for (uint8_t i = 0; i < 16; i++) {
+    setButton(i + 8, USBJOYS_BTN_MODE_NORMAL, i * 2, 1);
+  }
+  setupUSBJoystick();
+
+  const int cycles = 100000;
+  for (int changing = 0; changing < 2; changing++) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < cycles; i++) {
+      if (changing) channelOutputs[i % 24] = (i & 1023) - 512;
+      usbReport();
+      usbReportSent();
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    printf("usbReport() %s outputs: %.3f us\n",
+           changing ? "changing" : "still", duration.count() / 1000.0 / cycles);
+  }
+}
+
+#endif
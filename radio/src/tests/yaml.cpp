@@ -24,6 +24,10 @@
 #include <storage/yaml/yaml_node.h>
 #include <storage/yaml/yaml_parser.h>
 #include <storage/yaml/yaml_tree_walker.h>
+#include <storage/yaml/yaml_datastructs.h>
+#include <storage/sdcard_yaml.h>
+
+#include <filesystem>
 
 struct TestStruct {
   uint8_t foo;
@@ -68,3 +72,68 @@ TEST(Yaml, SkipBlankLines)
   EXPECT_EQ(YamlParser::CONTINUE_PARSING, yp.parse(chunk_3, sizeof(chunk_3) - 1));
   EXPECT_EQ(45, t.foo);
 }
+
+static bool yaml_count_tokens(void* opaque, const char* str, size_t len)
+{
+  *(uint32_t*)opaque += 1;
+  return true;
+}
+
+TEST(Yaml, BufferedWriterChecksum)
+{
+  TestStruct t;
+  t.foo = 12;
+  t.bar = 34;
+
+  const char path[] = "/yaml-writer-test.yml";
+  EXPECT_EQ(nullptr, writeFileYaml(path, &_root_node, (uint8_t*)&t, true));
+
+  // small file: a single write
+  EXPECT_EQ(1U, getYamlWriteStats().writeCalls);
+
+  TestStruct r;
+  YamlTreeWalker tree;
+  tree.reset(&_root_node, (uint8_t*)&r);
+  ChecksumResult checksum = ChecksumResult::None;
+  EXPECT_EQ(nullptr, readYamlFile(path, YamlTreeWalker::get_parser_calls(), &tree, &checksum));
+  EXPECT_EQ(ChecksumResult::Success, checksum);
+  EXPECT_EQ(12, r.foo);
+  EXPECT_EQ(34, r.bar);
+
+  // no temporary file left behind
+  EXPECT_FALSE(std::filesystem::exists(simuFatfsGetRealPath("yaml-writer-test.yml.tmp")));
+  std::filesystem::remove(simuFatfsGetRealPath("yaml-writer-test.yml"));
+}
+
+TEST(Yaml, BufferedWriterModel)
+{
+  MODEL_RESET();
+  setModelDefaults();
+
+  // the previous writer issued one f_write() per token
+  uint32_t tokens = 0;
+  YamlTreeWalker tree;
+  tree.reset(get_modeldata_nodes(), (uint8_t*)&g_model);
+  tree.generate(yaml_count_tokens, &tokens);
+
+  const char path[] = "/yaml-writer-model.yml";
+  EXPECT_EQ(nullptr, writeFileYaml(path, get_modeldata_nodes(), (uint8_t*)&g_model, true));
+
+  const YamlWriteStats& stats = getYamlWriteStats();
+
+  // one write per sector, plus the checksum update when the header has
+  // already been flushed
+  EXPECT_LE(stats.writeCalls, stats.bytes / 512 + 2);
+  EXPECT_LT(stats.writeCalls, tokens);
+
+  ModelData * model = (ModelData *)malloc(sizeof(ModelData));
+  tree.reset(get_modeldata_nodes(), (uint8_t*)model);
+  memset(model, 0, sizeof(ModelData));
+  ChecksumResult checksum = ChecksumResult::None;
+  EXPECT_EQ(nullptr, readYamlFile(path, YamlTreeWalker::get_parser_calls(), &tree, &checksum));
+  EXPECT_EQ(ChecksumResult::Success, checksum);
+  EXPECT_EQ(0, memcmp(model->header.name, g_model.header.name, sizeof(g_model.header.name)));
+  free(model);
+
+  std::filesystem::remove(simuFatfsGetRealPath("yaml-writer-model.yml"));
+}
@@ -50,6 +50,118 @@ void trainerSetTimer(uint16_t t)
   trainerInputValidityTimer = t;
 }
 
+struct TrainerSourceState {
+  int16_t channels[MAX_TRAINER_CHANNELS];
+  uint8_t count;    // channels [0..count) received at least once
+  uint32_t received[(MAX_TRAINER_CHANNELS + 31) / 32];
+  TrainerSourceStats stats;
+};
+
+static TrainerSourceState trainerSources[TRAINER_SOURCE_COUNT];
+
+// The sources are pushed from ISRs (PPM capture, SBUS) and from tasks
+// (Bluetooth, CRSF, Multi): the state is only changed with IRQs masked
+class TrainerSourcesLock
+{
+ public:
+  TrainerSourcesLock() : primask(__get_PRIMASK()) { __disable_irq(); }
+  ~TrainerSourcesLock() { if (!primask) __enable_irq(); }
+
+ private:
+  uint32_t primask;
+};
+
+static bool trainerSourceAlive(const TrainerSourceState& src, uint8_t ch,
+                               uint32_t now)
+{
+  return src.stats.frames && (src.received[ch / 32] & (1u << (ch % 32))) &&
+         now - src.stats.lastFrame <= TRAINER_SOURCE_TIMEOUT;
+}
+
+static void trainerSetSourceChannel(TrainerSourceState& src, uint8_t ch,
+                                    int16_t value)
+{
+  src.channels[ch] = value;
+  src.received[ch / 32] |= 1u << (ch % 32);
+  if (ch >= src.count) src.count = ch + 1;
+}
+
+static void trainerMergeChannel(uint8_t ch, uint32_t now)
+{
+  for (const auto& s: trainerSources) {
+    if (trainerSourceAlive(s, ch, now)) {
+      trainerInput[ch] = s.channels[ch];
+      break;
+    }
+  }
+}
+
+void trainerPushChannels(uint8_t source, uint8_t first, const int16_t* channels,
+                         uint8_t count, uint32_t timestamp)
+{
+  if (source >= TRAINER_SOURCE_COUNT || first >= MAX_TRAINER_CHANNELS) return;
+  if (count > MAX_TRAINER_CHANNELS - first) count = MAX_TRAINER_CHANNELS - first;
+
+  TrainerSourcesLock lock;
+  auto& src = trainerSources[source];
+  auto& stats = src.stats;
+  if (stats.frames) {
+    uint32_t delta = timestamp - stats.lastFrame;
+    if (delta > UINT16_MAX) delta = UINT16_MAX;
+    stats.interval = stats.frames == 1
+                         ? delta
+                         : stats.interval + ((int32_t)delta - stats.interval) / 8;
+    if (delta > stats.maxInterval) stats.maxInterval = delta;
+  }
+  stats.frames++;
+  stats.lastFrame = timestamp;
+
+  for (uint8_t i = 0; i < count; i++) {
+    trainerSetSourceChannel(src, first + i, channels[i]);
+  }
+
+  // merge the channels of all live sources
+  uint8_t maxCount = 0;
+  for (const auto& s: trainerSources) {
+    if (s.count > maxCount) maxCount = s.count;
+  }
+  for (uint8_t ch = 0; ch < maxCount; ch++) {
+    trainerMergeChannel(ch, timestamp);
+  }
+
+  trainerResetTimer();
+}
+
+void trainerPushChannel(uint8_t source, uint8_t ch, int16_t value,
+                        uint32_t timestamp)
+{
+  if (source >= TRAINER_SOURCE_COUNT || ch >= MAX_TRAINER_CHANNELS) return;
+
+  TrainerSourcesLock lock;
+  trainerSetSourceChannel(trainerSources[source], ch, value);
+  trainerMergeChannel(ch, timestamp);
+  trainerResetTimer();
+}
+
+void trainerFrameLost(uint8_t source)
+{
+  if (source >= TRAINER_SOURCE_COUNT) return;
+
+  TrainerSourcesLock lock;
+  trainerSources[source].stats.lost++;
+}
+
+const TrainerSourceStats& trainerGetSourceStats(uint8_t source)
+{
+  return trainerSources[source].stats;
+}
+
+void trainerResetSources()
+{
+  TrainerSourcesLock lock;
+  memclear(trainerSources, sizeof(trainerSources));
+}
+
 enum {
   TRAINER_NOT_CONNECTED = 0,
   TRAINER_CONNECTED,
@@ -118,6 +230,7 @@ void stopTrainer()
     _on_change_cb(currentTrainerMode, 0xFF);
   }
   currentTrainerMode = 0xFF;
+  trainerResetSources();
 }
 
 void checkTrainerSettings()
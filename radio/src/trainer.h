@@ -26,6 +26,40 @@
 // Trainer input channels
 extern int16_t trainerInput[MAX_TRAINER_CHANNELS];
 
+// Trainer input sources. Each channel of trainerInput comes from the first
+// source in this order that sent it within TRAINER_SOURCE_TIMEOUT, so that
+// e.g. a head tracker on Bluetooth can complete a buddy box on the jack.
+enum TrainerSource {
+  TRAINER_SOURCE_PPM,        // trainer jack or external module CPPM
+  TRAINER_SOURCE_SBUS,       // serial AUX or external module SBUS
+  TRAINER_SOURCE_MODULE,     // CRSF or Multi trainer channels
+  TRAINER_SOURCE_BLUETOOTH,
+  TRAINER_SOURCE_COUNT
+};
+
+#define TRAINER_SOURCE_TIMEOUT  100 // ms
+
+struct TrainerSourceStats {
+  uint32_t frames;        // frames received
+  uint32_t lost;          // decoder resynchronisations and failsafe frames
+  uint32_t lastFrame;     // time of the last frame (ms)
+  uint16_t interval;      // average time between frames (ms)
+  uint16_t maxInterval;   // longest time between frames (ms)
+};
+
+// Called by the decoders for each complete frame: 'count' channels
+// starting at 'first', [-512:+512]. 'timestamp' in ms (timersGetMsTick())
+void trainerPushChannels(uint8_t source, uint8_t first, const int16_t* channels,
+                         uint8_t count, uint32_t timestamp);
+// Publishes a channel before its frame is complete (PPM pulses), the
+// frame itself must still be pushed with trainerPushChannels()
+void trainerPushChannel(uint8_t source, uint8_t ch, int16_t value,
+                        uint32_t timestamp);
+void trainerFrameLost(uint8_t source);
+
+const TrainerSourceStats& trainerGetSourceStats(uint8_t source);
+void trainerResetSources();
+
 extern uint8_t currentTrainerMode;
 
 bool isTrainerConnected();
@@ -310,6 +310,9 @@ const char STR_INTERVAL_MS[] = TR_INTERVAL_MS;
 const char STR_MEM_USED_SCRIPT[] = TR_MEM_USED_SCRIPT;
 const char STR_MEM_USED_WIDGET[] = TR_MEM_USED_WIDGET;
 const char STR_MEM_USED_EXTRA[] = TR_MEM_USED_EXTRA;
+const char STR_LUA_WIDGETS_LABEL[] = TR_LUA_WIDGETS_LABEL;
+const char STR_REFRESH_US[] = TR_REFRESH_US;
+const char STR_SKIPPED_PERCENT[] = TR_SKIPPED_PERCENT;
 const char STR_STACK_MIX[] = TR_STACK_MIX;
 const char STR_STACK_AUDIO[] = TR_STACK_AUDIO;
 const char STR_GPS_FIX_YES[] = TR_GPS_FIX_YES;
@@ -488,6 +488,9 @@ extern const char STR_INTERVAL_MS[];
 extern const char STR_MEM_USED_SCRIPT[];
 extern const char STR_MEM_USED_WIDGET[];
 extern const char STR_MEM_USED_EXTRA[];
+extern const char STR_LUA_WIDGETS_LABEL[];
+extern const char STR_REFRESH_US[];
+extern const char STR_SKIPPED_PERCENT[];
 extern const char STR_STACK_MIX[];
 extern const char STR_STACK_AUDIO[];
 extern const char STR_GPS_FIX_YES[];
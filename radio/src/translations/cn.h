@@ -453,6 +453,9 @@
 #define TR_MEM_USED_SCRIPT             "脚本(B): "
 #define TR_MEM_USED_WIDGET             "小部件(B): "
 #define TR_MEM_USED_EXTRA              "附加(B): "
+#define TR_LUA_WIDGETS_LABEL           "Lua widgets"
+#define TR_REFRESH_US                  TR("[R]","Refresh(us): ")
+#define TR_SKIPPED_PERCENT             TR("[S]","Skipped(%): ")
 #define TR_STACK_MIX                   "混控: "
 #define TR_STACK_AUDIO                 "音频: "
 #define TR_GPS_FIX_YES                 "修正: 是"
@@ -473,6 +473,9 @@
 #define TR_MEM_USED_SCRIPT            "스크립트(B): "
 #define TR_MEM_USED_WIDGET            "위젯(B): "
 #define TR_MEM_USED_EXTRA             "추가(B): "
+#define TR_LUA_WIDGETS_LABEL          "Lua widgets"
+#define TR_REFRESH_US                 TR("[R]","Refresh(us): ")
+#define TR_SKIPPED_PERCENT            TR("[S]","Skipped(%): ")
 #define TR_STACK_MIX                  "믹스: "
 #define TR_STACK_AUDIO                "오디오: "
 #define TR_GPS_FIX_YES                "위치 고정: 예"
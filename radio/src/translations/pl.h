@@ -453,6 +453,9 @@
 #define TR_MEM_USED_SCRIPT            "Skrypt(B): "
 #define TR_MEM_USED_WIDGET            "Widget(B): "
 #define TR_MEM_USED_EXTRA             "Ekstra(B): "
+#define TR_LUA_WIDGETS_LABEL          "Lua widgets"
+#define TR_REFRESH_US                 TR("[R]","Refresh(us): ")
+#define TR_SKIPPED_PERCENT            TR("[S]","Skipped(%): ")
 #define TR_STACK_MIX                  "Mix: "
 #define TR_STACK_AUDIO                "Audio: "
 #define TR_GPS_FIX_YES                "Fix: Tak"
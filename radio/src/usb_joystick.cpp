@@ -36,17 +36,58 @@ uint8_t _hidReportDescSize = 0;
 uint8_t* _hidReport = nullptr;
 uint8_t _hidReportSize = 0;
 
+#define USBJ_MAX_SWITCH_POS 8
+
+// Button quantisation
+enum {
+  USBJ_QUANT_STEPS,   // position = number of thresholds reached
+  USBJ_QUANT_DELTA,   // 32 steps, for delta detection
+  USBJ_QUANT_CENTER,  // 0 = center, 1 = below, 2 = above
+};
+
+// Report plan, compiled from the model settings by setupUSBJoystick()
+struct _usbJSButton {
+  uint8_t channel;
+  uint8_t mode;       // USBJoystickBtnMode
+  uint8_t quant;
+  uint8_t inversion;
+  uint8_t swpos;      // number of switch positions
+  uint8_t oneHot;     // position encoded as 1 << position
+  uint8_t btnNum;     // first bit in the button field
+  uint8_t steps;      // number of thresholds
+  uint32_t mask;      // bits of the button field
+  uint16_t thresholds[USBJ_MAX_SWITCH_POS - 1];
+};
+
+struct _usbJSAxis {
+  uint8_t channel;
+  uint8_t pair;       // circular cutout partner, 0xff if none
+  uint8_t inversion;
+};
+
 struct _usbJSData {
   uint16_t _usbLastChannelOutput[USBJ_MAX_JOYSTICK_CHANNELS];
   uint8_t _usbChannelTimerActive[USBJ_MAX_JOYSTICK_CHANNELS];
   uint8_t _usbChannelTimer[USBJ_MAX_JOYSTICK_CHANNELS];
-  uint8_t _usbJoystickButtonChannels[USBJ_MAX_JOYSTICK_CHANNELS];
-  uint8_t _usbJoystickAxisChannels[USBJ_MAX_JOYSTICK_CHANNELS];
+  struct _usbJSButton _usbJoystickButtons[USBJ_MAX_JOYSTICK_CHANNELS];
+  struct _usbJSAxis _usbJoystickAxes[USBJ_MAX_JOYSTICK_CHANNELS];
+
+  // change detection: channel outputs used by the last report
+  uint8_t _usbMappedChannels[USBJ_MAX_JOYSTICK_CHANNELS];
+  int16_t _usbMappedOutputs[USBJ_MAX_JOYSTICK_CHANNELS];
+  uint8_t _usbMappedCount;
+  uint8_t _usbTimersActive;
+  uint8_t _usbLastVbat;
 };
 
 static struct _usbJSData* _usbJS = nullptr;
 
-static uint8_t _buttonState[(USBJ_BUTTON_SIZE + 7) >> 3] = {};
+static uint32_t _buttonState = 0;
+
+// report needs to be rebuilt (settings changed)
+static bool _hidReportRebuild = true;
+// report changed since it was last sent
+static bool _hidReportPending = true;
 
 static uint8_t _usbJoystickIfMode = 0;
 static uint8_t _usbJoystickCircularCut = 0;
@@ -181,6 +222,72 @@ int usbJoystickSettingsChanged()
   return oldChecksum != settingsChecksum;
 }
 
+static uint8_t axisPair(uint8_t chix)
+{
+  if (chix == _usbJoystickAxisPairs[0][0]) return _usbJoystickAxisPairs[0][1];
+  if (chix == _usbJoystickAxisPairs[0][1]) return _usbJoystickAxisPairs[0][0];
+  if (chix == _usbJoystickAxisPairs[1][0]) return _usbJoystickAxisPairs[1][1];
+  if (chix == _usbJoystickAxisPairs[1][1]) return _usbJoystickAxisPairs[1][0];
+  return 0xff;
+}
+
+static void compileButton(struct _usbJSButton& btn, uint8_t channelIx)
+{
+  const USBJoystickChData& ch = g_model.usbJoystickCh[channelIx];
+  uint8_t bits;
+
+  btn.channel = channelIx;
+  btn.mode = ch.param;
+  btn.inversion = ch.inversion;
+  btn.swpos = ch.switch_npos + 1;
+  btn.btnNum = ch.btn_num;
+  btn.quant = USBJ_QUANT_STEPS;
+  btn.oneHot = false;
+  btn.steps = 0;
+
+  // on / off: a single threshold at the center
+  btn.thresholds[0] = 1025;
+
+  switch (btn.mode) {
+    case USBJOYS_BTN_MODE_NORMAL:
+    case USBJOYS_BTN_MODE_ON_PULSE:
+      btn.oneHot = btn.swpos > 1;
+      bits = btn.swpos;
+      break;
+    case USBJOYS_BTN_MODE_SW_EMU:
+      bits = 1;
+      break;
+    case USBJOYS_BTN_MODE_DELTA:
+      btn.quant = USBJ_QUANT_DELTA;
+      bits = 2;
+      break;
+    case USBJOYS_BTN_MODE_COMPANION:
+      if (btn.swpos == 3) {
+        btn.quant = USBJ_QUANT_CENTER;
+        bits = 2;
+      } else {
+        btn.oneHot = btn.swpos > 2;
+        bits = btn.oneHot ? btn.swpos : 1;
+      }
+      break;
+    default:
+      bits = 0;
+      break;
+  }
+
+  if (btn.oneHot) {
+    // same as value / (2048 / swpos), limited to the last position
+    uint16_t step = 2048 / btn.swpos;
+    for (uint8_t i = 1; i < btn.swpos; i++) {
+      btn.thresholds[btn.steps++] = i * step;
+    }
+  } else if (btn.quant == USBJ_QUANT_STEPS) {
+    btn.steps = 1;
+  }
+
+  btn.mask = (uint32_t)((((uint64_t)1 << bits) - 1) << btn.btnNum);
+}
+
 int setupUSBJoystick()
 {
   static const uint8_t axisTypeCodes[USBJOYS_AXIS_LAST + 1] = {
@@ -222,7 +329,7 @@ int setupUSBJoystick()
       if (_usbJS == nullptr) return false;
     }
 
-    memset(_buttonState, 0, ((USBJ_BUTTON_SIZE + 7) >> 3));
+    _buttonState = 0;
     memset(_usbJS, 0, sizeof(struct _usbJSData));
     memset(_usbJS->_usbLastChannelOutput, 0xff,
            sizeof(_usbJS->_usbLastChannelOutput));
@@ -356,8 +463,8 @@ int setupUSBJoystick()
         if (id > buttonMaxId) {
           buttonMaxId = id;
         }
-        _usbJS->_usbJoystickButtonChannels[_usbJoystickButtonCount++] =
-            channelIx;
+        compileButton(_usbJS->_usbJoystickButtons[_usbJoystickButtonCount++],
+                      channelIx);
       } else if (mode == USBJOYS_CH_AXIS && typeIx <= USBJOYS_AXIS_LAST) {
         usage = axisTypeCodes[typeIx];
         pageTarget = 0x01;  // Generic Desktop Page (0x01)
@@ -393,7 +500,16 @@ int setupUSBJoystick()
         _hidReportDesc[_hidReportDescSize++] = 0x09;
         _hidReportDesc[_hidReportDescSize++] = usage;
 
-        _usbJS->_usbJoystickAxisChannels[_usbJoystickAxisCount++] = channelIx;
+        struct _usbJSAxis& axis =
+            _usbJS->_usbJoystickAxes[_usbJoystickAxisCount++];
+        axis.channel = channelIx;
+        axis.pair = axisPair(channelIx);
+        axis.inversion = g_model.usbJoystickCh[channelIx].inversion;
+      }
+
+      if (mode == USBJOYS_CH_BUTTON || pageTarget ||
+          channelIx == _usbJoystickDpadChannel) {
+        _usbJS->_usbMappedChannels[_usbJS->_usbMappedCount++] = channelIx;
       }
     }
 
@@ -477,6 +593,9 @@ int setupUSBJoystick()
     // end of report desc
   }
 
+  _hidReportRebuild = true;
+  _hidReportPending = true;
+
   // compare with the old description
   if (_hidReportDescSize != oldHIDReportDescSize) return true;
   uint32_t newChecksum = hash(_hidReportDesc, _hidReportDescSize);
@@ -489,7 +608,7 @@ extern "C" struct usbReport_t usbReportDesc()
   return res;
 }
 
-static void setBatteryBits(int hid_pos)
+static void setBatteryBits(uint8_t* report, int hid_pos)
 {
   // vBatMin / vBatMax are encoded with offsets 90 / 120
   uint8_t percent = limit<uint8_t>(
@@ -498,10 +617,10 @@ static void setBatteryBits(int hid_pos)
                       g_eeGeneral.vBatMax - g_eeGeneral.vBatMin + 30),
       100);
 
-  _hidReport[hid_pos] = percent;
+  report[hid_pos] = percent;
 }
 
-static void setDpadBits(int hid_pos, int channelIx)
+static void setDpadBits(uint8_t* report, int hid_pos, int channelIx)
 {
   // Android's POV encoding:
   //  0 = North
@@ -514,7 +633,7 @@ static void setDpadBits(int hid_pos, int channelIx)
   //  7 = North-West
   //  8-15 = no direction
 
-  int16_t value = channelOutputs[channelIx] + 1024;
+  int16_t value = limit<int16_t>(0, channelOutputs[channelIx] + 1024, 2048);
 
   // a span of 120 results in overflow at the top range
   // a span of 121 results in a too small top range
@@ -547,84 +666,76 @@ static void setDpadBits(int hid_pos, int channelIx)
   };
   // clang-format on
 
-  _hidReport[hid_pos] = key_lookup[value & 0x0F];
+  report[hid_pos] = key_lookup[value & 0x0F];
+}
+
+// Replaces the report if the new one is different
+static void commitReport(const uint8_t* report)
+{
+  if (memcmp(_hidReport, report, _hidReportSize) != 0) {
+    memcpy(_hidReport, report, _hidReportSize);
+    _hidReportPending = true;
+  }
 }
 
 void usbClassicStateUpdate()
 {
   if (_hidReport == nullptr) return;
 
-  memset(_hidReport, 0, MAX_HID_REPORT);
+  uint8_t report[MAX_HID_REPORT];
 
   // buttons
-  _hidReport[0] = 0;
-  _hidReport[1] = 0;
-  _hidReport[2] = 0;
+  report[0] = 0;
+  report[1] = 0;
+  report[2] = 0;
   for (int i = 0; i < 8; ++i) {
     if (channelOutputs[i + 8] > 0) {
-      _hidReport[0] |= (1 << i);
+      report[0] |= (1 << i);
     }
     if (channelOutputs[i + 16] > 0) {
-      _hidReport[1] |= (1 << i);
+      report[1] |= (1 << i);
     }
     if (channelOutputs[i + 24] > 0) {
-      _hidReport[2] |= (1 << i);
+      report[2] |= (1 << i);
     }
   }
 
   // analog values
-  // uint8_t * p = HID_Buffer + 1;
   for (int i = 0; i < 8; ++i) {
     int16_t value = limit<int16_t>(0, channelOutputs[i] + 1024, 2048);
 
-    _hidReport[i * 2 + 3] = static_cast<uint8_t>(value & 0xFF);
-    _hidReport[i * 2 + 4] = static_cast<uint8_t>(value >> 8);
+    report[i * 2 + 3] = static_cast<uint8_t>(value & 0xFF);
+    report[i * 2 + 4] = static_cast<uint8_t>(value >> 8);
   }
 
   // battery values
-  setBatteryBits(8 * 2 + 3);
+  setBatteryBits(report, 8 * 2 + 3);
+
+  commitReport(report);
 }
 
-static void setBtnBits(uint8_t ix, uint8_t value, uint8_t size)
+static void setBtnBits(const struct _usbJSButton& btn, uint32_t value)
 {
-  for (uint8_t i = 0; i < size; i++) {
-    uint8_t bitix = ix + i;
-    if (bitix >= USBJ_BUTTON_SIZE) break;
-
-    if (value & (1 << i)) {
-      _buttonState[(bitix / 8)] |= 1 << (bitix % 8);
-    } else {
-      _buttonState[(bitix / 8)] &= ~(1 << (bitix % 8));
-    }
-  }
+  _buttonState = (_buttonState & ~btn.mask) |
+                 ((uint32_t)((uint64_t)value << btn.btnNum) & btn.mask);
 }
 
 static void toggleBtnBit(uint8_t bitix)
 {
   if (bitix >= USBJ_BUTTON_SIZE) return;
-  _buttonState[(bitix / 8)] ^= 1 << (bitix % 8);
+  _buttonState ^= 1UL << bitix;
 }
 
 #define g_usbTmr10ms (*(uint8_t*)&g_tmr10ms)
 #define BTNPUSH_TIME 20 /* x10ms */
 
-static int16_t circularCutoutValue(uint8_t chix)
+static int16_t circularCutoutValue(const struct _usbJSAxis& axis)
 {
-  int32_t value = channelOutputs[chix];
-  uint8_t chpair = 0xff;
+  int32_t value = channelOutputs[axis.channel];
   const int32_t limit = 1048576; /* 1024^2 */
 
-  if (chix == _usbJoystickAxisPairs[0][0])
-    chpair = _usbJoystickAxisPairs[0][1];
-  else if (chix == _usbJoystickAxisPairs[0][1])
-    chpair = _usbJoystickAxisPairs[0][0];
-  else if (chix == _usbJoystickAxisPairs[1][0])
-    chpair = _usbJoystickAxisPairs[1][1];
-  else if (chix == _usbJoystickAxisPairs[1][1])
-    chpair = _usbJoystickAxisPairs[1][0];
-
-  if (chpair != 0xff) {
-    int32_t pval = channelOutputs[chpair];
+  if (axis.pair != 0xff) {
+    int32_t pval = channelOutputs[axis.pair];
     int32_t sum = ((value * value) + (pval * pval));
     if (sum > limit) {
       double ratio = sqrt((double)limit / (double)sum);
@@ -635,140 +746,142 @@ static int16_t circularCutoutValue(uint8_t chix)
   return value;
 }
 
-void usbStateUpdate()
+static uint8_t quantizeButton(const struct _usbJSButton& btn, int16_t value)
 {
-  if (_hidReport == nullptr) return;
+  switch (btn.quant) {
+    case USBJ_QUANT_DELTA:
+      return value >> 6;
+    case USBJ_QUANT_CENTER:
+      return (value < 1024) ? 1 : (value > 1024) ? 2 : 0;
+    default: {
+      uint8_t pos = 0;
+      while (pos < btn.steps && value >= btn.thresholds[pos]) pos++;
+      return pos;
+    }
+  }
+}
 
-  const uint8_t button_ix = _usbJoystickAxisCount * 2;
-  const uint8_t axis_ix = 0;
-  const uint8_t battery_ix = button_ix + ((USBJ_BUTTON_SIZE + 7) >> 3);
+static void startBtnTimer(uint8_t chix)
+{
+  if (!_usbJS->_usbChannelTimerActive[chix]) {
+    _usbJS->_usbChannelTimerActive[chix] = 1;
+    _usbJS->_usbTimersActive++;
+  }
+  _usbJS->_usbChannelTimer[chix] = g_usbTmr10ms;
+}
 
-  memset(_hidReport, 0, MAX_HID_REPORT);
+static void updateButton(const struct _usbJSButton& btn)
+{
+  uint8_t chix = btn.channel;
 
-  uint8_t chix = 0;
+  int16_t value = limit<int16_t>(0, channelOutputs[chix] + 1024, 2047);
+  if (btn.inversion) value = 2047 - value;
 
-  int16_t value = 0;
+  uint8_t btnval = quantizeButton(btn, value);
+  uint16_t last = _usbJS->_usbLastChannelOutput[chix];
 
-  uint8_t swpos = 0;
-  uint8_t btnval = 0;
+  // Channel Output value changed
+  if (last == 0xffff || last != btnval) {
+    switch (btn.mode) {
+      case USBJOYS_BTN_MODE_NORMAL:
+      case USBJOYS_BTN_MODE_ON_PULSE:
+        setBtnBits(btn, btn.oneHot ? 1 << btnval : btnval);
+        if (btn.mode == USBJOYS_BTN_MODE_ON_PULSE) startBtnTimer(chix);
+        break;
 
-  for (uint8_t i = 0; i < _usbJoystickButtonCount; i++) {
-    chix = _usbJS->_usbJoystickButtonChannels[i];
+      case USBJOYS_BTN_MODE_SW_EMU:
+        if (last != 0xffff && last < btnval) toggleBtnBit(btn.btnNum);
+        break;
 
-    value = channelOutputs[chix] + 1024;
-    if (value > 2047)
-      value = 2047;
-    else if (value < 0)
-      value = 0;
+      case USBJOYS_BTN_MODE_DELTA:
+        if (last != 0xffff) {
+          setBtnBits(btn, last < btnval ? 2 : 1);
+          startBtnTimer(chix);
+        }
+        break;
 
-    if (g_model.usbJoystickCh[chix].inversion) value = 2047 - value;
+      case USBJOYS_BTN_MODE_COMPANION:
+        setBtnBits(btn, btn.oneHot ? 1 << btnval : btnval);
+        break;
+    }
 
-    swpos = g_model.usbJoystickCh[chix].switch_npos + 1;
+    _usbJS->_usbLastChannelOutput[chix] = btnval;
+  }
 
-    // Quantization of the values
-    if ((g_model.usbJoystickCh[chix].param == USBJOYS_BTN_MODE_NORMAL) ||
-        (g_model.usbJoystickCh[chix].param == USBJOYS_BTN_MODE_ON_PULSE)) {
-      if (swpos == 1) {
-        btnval = (value > 1024);
-      } else {
-        btnval = static_cast<uint16_t>(value) / (2048 / swpos);
-        if (btnval >= swpos) btnval = swpos - 1;
-      }
-    } else if (g_model.usbJoystickCh[chix].param == USBJOYS_BTN_MODE_SW_EMU) {
-      btnval = (value > 1024);
-    } else if (g_model.usbJoystickCh[chix].param == USBJOYS_BTN_MODE_DELTA) {
-      btnval = (value >> 6);
-    } else if (g_model.usbJoystickCh[chix].param ==
-               USBJOYS_BTN_MODE_COMPANION) {
-      if (swpos == 1 || swpos == 2) {
-        btnval = (value > 1024);
-      } else if (swpos == 3) {
-        btnval = (value < 1024) ? 1 : (value > 1024) ? 2 : 0;
-      } else {
-        btnval = static_cast<uint16_t>(value) / (2048 / swpos);
-        if (btnval >= swpos) btnval = swpos - 1;
-      }
+  // Timer check
+  if (_usbJS->_usbChannelTimerActive[chix] &&
+      ((uint8_t)(g_usbTmr10ms - _usbJS->_usbChannelTimer[chix]) >=
+       BTNPUSH_TIME)) {
+    _usbJS->_usbChannelTimerActive[chix] = 0;
+    _usbJS->_usbTimersActive--;
+    setBtnBits(btn, 0);
+  }
+}
+
+// Returns true if one of the channels used by the report changed
+static bool usbInputsChanged()
+{
+  bool changed = false;
+
+  for (uint8_t i = 0; i < _usbJS->_usbMappedCount; i++) {
+    uint8_t chix = _usbJS->_usbMappedChannels[i];
+    if (_usbJS->_usbMappedOutputs[i] != channelOutputs[chix]) {
+      _usbJS->_usbMappedOutputs[i] = channelOutputs[chix];
+      changed = true;
     }
+  }
 
-    // Channel Output value changed
-    if ((_usbJS->_usbLastChannelOutput[chix] == 0xffff) ||
-        (_usbJS->_usbLastChannelOutput[chix] != btnval)) {
-      if ((g_model.usbJoystickCh[chix].param == USBJOYS_BTN_MODE_NORMAL) ||
-          (g_model.usbJoystickCh[chix].param == USBJOYS_BTN_MODE_ON_PULSE)) {
-        if (swpos == 1) {
-          setBtnBits(g_model.usbJoystickCh[chix].btn_num, btnval, 1);
-        } else {
-          setBtnBits(g_model.usbJoystickCh[chix].btn_num, 1 << btnval, swpos);
-        }
+  if (_usbJS->_usbLastVbat != g_vbat100mV) {
+    _usbJS->_usbLastVbat = g_vbat100mV;
+    changed = true;
+  }
 
-        // Timer
-        if (g_model.usbJoystickCh[chix].param == USBJOYS_BTN_MODE_ON_PULSE) {
-          _usbJS->_usbChannelTimerActive[chix] = 1;
-          _usbJS->_usbChannelTimer[chix] = g_usbTmr10ms;
-        }
-      } else if (g_model.usbJoystickCh[chix].param == USBJOYS_BTN_MODE_SW_EMU) {
-        if ((_usbJS->_usbLastChannelOutput[chix] != 0xffff) &&
-            (_usbJS->_usbLastChannelOutput[chix] < btnval)) {
-          toggleBtnBit(g_model.usbJoystickCh[chix].btn_num);
-        }
-      } else if (g_model.usbJoystickCh[chix].param == USBJOYS_BTN_MODE_DELTA) {
-        if (_usbJS->_usbLastChannelOutput[chix] != 0xffff) {
-          if (_usbJS->_usbLastChannelOutput[chix] < btnval) {
-            setBtnBits(g_model.usbJoystickCh[chix].btn_num, 2, 2);
-          } else if (_usbJS->_usbLastChannelOutput[chix] > btnval) {
-            setBtnBits(g_model.usbJoystickCh[chix].btn_num, 1, 2);
-          }
-          _usbJS->_usbChannelTimerActive[chix] = 1;
-          _usbJS->_usbChannelTimer[chix] = g_usbTmr10ms;
-        }
-      } else if (g_model.usbJoystickCh[chix].param ==
-                 USBJOYS_BTN_MODE_COMPANION) {
-        if (swpos == 1 || swpos == 2) {
-          setBtnBits(g_model.usbJoystickCh[chix].btn_num, btnval, 1);
-        } else if (swpos == 3) {
-          setBtnBits(g_model.usbJoystickCh[chix].btn_num, btnval, 2);
-        } else {
-          setBtnBits(g_model.usbJoystickCh[chix].btn_num, 1 << btnval, swpos);
-        }
-      }
+  return changed;
+}
 
-      _usbJS->_usbLastChannelOutput[chix] = btnval;
-    }
+void usbStateUpdate()
+{
+  if (_hidReport == nullptr || _usbJS == nullptr) return;
 
-    // Timer check
-    if ((_usbJS->_usbChannelTimerActive[chix]) &&
-        (((uint8_t)(g_usbTmr10ms - _usbJS->_usbChannelTimer[chix]) >=
-          BTNPUSH_TIME))) {
-      _usbJS->_usbChannelTimerActive[chix] = 0;
+  // nothing to do unless an input changed or a button pulse is running
+  if (!usbInputsChanged() && !_usbJS->_usbTimersActive && !_hidReportRebuild)
+    return;
+  _hidReportRebuild = false;
 
-      if (g_model.usbJoystickCh[chix].param == USBJOYS_BTN_MODE_ON_PULSE) {
-        setBtnBits(g_model.usbJoystickCh[chix].btn_num, 0, swpos);
-      } else if (g_model.usbJoystickCh[chix].param == USBJOYS_BTN_MODE_DELTA) {
-        setBtnBits(g_model.usbJoystickCh[chix].btn_num, 0, 2);
-      }
-    }
+  const uint8_t button_ix = _usbJoystickAxisCount * 2;
+  const uint8_t axis_ix = 0;
+  const uint8_t battery_ix = button_ix + ((USBJ_BUTTON_SIZE + 7) >> 3);
+
+  uint8_t report[MAX_HID_REPORT];
+
+  for (uint8_t i = 0; i < _usbJoystickButtonCount; i++) {
+    updateButton(_usbJS->_usbJoystickButtons[i]);
   }
 
-  memcpy(_hidReport + button_ix, _buttonState, ((USBJ_BUTTON_SIZE + 7) >> 3));
+  for (uint8_t i = 0; i < (USBJ_BUTTON_SIZE + 7) >> 3; i++) {
+    report[button_ix + i] = _buttonState >> (i * 8);
+  }
 
   for (uint8_t i = 0; i < _usbJoystickAxisCount; i++) {
-    chix = _usbJS->_usbJoystickAxisChannels[i];
+    const struct _usbJSAxis& axis = _usbJS->_usbJoystickAxes[i];
 
-    value = limit<int16_t>(0, circularCutoutValue(chix) + 1024, 2048);
+    int16_t value = limit<int16_t>(0, circularCutoutValue(axis) + 1024, 2048);
 
-    if (g_model.usbJoystickCh[chix].inversion) value = 2048 - value;
+    if (axis.inversion) value = 2048 - value;
 
-    _hidReport[i * 2 + axis_ix] = static_cast<uint8_t>(value & 0xFF);
-    _hidReport[i * 2 + axis_ix + 1] = static_cast<uint8_t>(value >> 8);
+    report[i * 2 + axis_ix] = static_cast<uint8_t>(value & 0xFF);
+    report[i * 2 + axis_ix + 1] = static_cast<uint8_t>(value >> 8);
   }
 
   // battery values
-  setBatteryBits(battery_ix);
+  setBatteryBits(report, battery_ix);
 
   // dpad switch
   if (0 <= _usbJoystickDpadChannel) {
-    setDpadBits(battery_ix + 1, _usbJoystickDpadChannel);
+    setDpadBits(report, battery_ix + 1, _usbJoystickDpadChannel);
   }
+
+  commitReport(report);
 }
 
 uint8_t usbReportSize() { return _hidReportSize; }
@@ -786,6 +899,10 @@ struct usbReport_t usbReport()
   return res;
 }
 
+bool usbReportPending() { return _hidReportPending; }
+
+void usbReportSent() { _hidReportPending = false; }
+
 void onUSBJoystickModelChanged()
 {
   if (!usbJoystickActive()) return;
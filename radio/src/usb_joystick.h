@@ -115,8 +115,14 @@ uint8_t usbReportSize();
 }
 #endif
 
+// Current report, only rebuilt when one of the mapped channel outputs
+// changed since the previous call
 struct usbReport_t usbReport();
 
+// Report changed since it was last sent
+bool usbReportPending();
+void usbReportSent();
+
 int isUSBAxisCollision(uint8_t chIdx);
 int isUSBSimCollision(uint8_t chIdx);
 int isUSBBtnNumCollision(uint8_t chIdx);
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+    Runs the headless simulator (simu-headless target) on every model of a
+    settings directory, in parallel processes, and stores the channel
+    outputs / firmware traces of each run in an output directory.
+
+    Each run works on its own copy of the settings, so that runs cannot
+    interfere with each other. Comparing two output directories gives a
+    quick regression check:
+
+        ./simu_farm.py --simu ./simu-headless --settings path/to/settings \\
+            --trace inputs.trace --out results
+        diff -r results reference
+"""
+
+import argparse
+import multiprocessing
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+
+def run_model(params):
+    args, model = params
+    name = os.path.splitext(model)[0]
+
+    with tempfile.TemporaryDirectory() as settings:
+        for d in ("RADIO", "MODELS"):
+            src = os.path.join(args.settings, d)
+            if os.path.isdir(src):
+                shutil.copytree(src, os.path.join(settings, d))
+
+        cmd = [args.simu,
+               "--settings", settings,
+               "--model", model,
+               "--channels", os.path.join(args.out, name + ".csv"),
+               "--log", os.path.join(args.out, name + ".log")]
+        if args.storage:
+            cmd += ["--storage", args.storage]
+        if args.trace:
+            cmd += ["--trace", args.trace]
+        if args.duration:
+            cmd += ["--duration", str(args.duration)]
+
+        result = subprocess.run(cmd, stdout=subprocess.DEVNULL)
+        return model, result.returncode
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Headless simulator regression farm")
+    parser.add_argument("--simu", required=True, help="simu-headless executable")
+    parser.add_argument("--settings", required=True, help="settings directory (RADIO & MODELS)")
+    parser.add_argument("--storage", help="SD card directory")
+    parser.add_argument("--trace", help="input trace played for every model")
+    parser.add_argument("--duration", type=int, help="virtual time to run, in ms")
+    parser.add_argument("--out", required=True, help="output directory")
+    parser.add_argument("-j", "--jobs", type=int, default=multiprocessing.cpu_count())
+    args = parser.parse_args()
+
+    models_dir = os.path.join(args.settings, "MODELS")
+    models = sorted(f for f in os.listdir(models_dir)
+                    if f.endswith(".yml") and f.startswith("model"))
+    os.makedirs(args.out, exist_ok=True)
+
+    failed = 0
+    with multiprocessing.Pool(args.jobs) as pool:
+        for model, code in pool.imap(run_model, [(args, m) for m in models]):
+            print("%s: %s" % (model, "OK" if code == 0 else "FAILED (%d)" % code))
+            failed += code != 0
+
+    print("%d models, %d failed" % (len(models), failed))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+    Converts PCM WAV prompts (voice packs) to IMA-ADPCM WAV, which the radio
+    plays directly: files are about 4 times smaller, and so are the SD card
+    reads while a prompt is played.
+
+    Input files must be 16-bit PCM (stereo is mixed down to mono). The
+    sample rate is kept, the radio resamples when playing.
+
+        ./wav2adpcm.py SOUNDS/en converted/en
+        ./wav2adpcm.py --in-place SOUNDS/en
+"""
+
+import argparse
+import array
+import os
+import struct
+import sys
+import wave
+
+BLOCK_SIZE = 256
+MIN_BLOCK_SIZE = 36
+
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41,
+    45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209,
+    230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876,
+    963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749,
+    3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+    9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385,
+    24623, 27086, 29794, 32767
+]
+
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def clamp(value, low, high):
+    return max(low, min(high, value))
+
+
+class Encoder:
+    def __init__(self):
+        self.predictor = 0
+        self.index = 0
+
+    def encode_sample(self, sample):
+        step = STEP_TABLE[self.index]
+        diff = sample - self.predictor
+        code = 0
+        if diff < 0:
+            code = 8
+            diff = -diff
+        # same rounding as the decoder
+        delta = step >> 3
+        if diff >= step:
+            code |= 4
+            diff -= step
+            delta += step
+        if diff >= step >> 1:
+            code |= 2
+            diff -= step >> 1
+            delta += step >> 1
+        if diff >= step >> 2:
+            code |= 1
+            delta += step >> 2
+        self.predictor = clamp(self.predictor + (-delta if code & 8 else delta), -32768, 32767)
+        self.index = clamp(self.index + INDEX_TABLE[code & 7], 0, len(STEP_TABLE) - 1)
+        return code
+
+    def encode_block(self, samples):
+        # header: first sample as is, then the step index
+        self.predictor = samples[0]
+        data = bytearray(struct.pack("<hBB", self.predictor, self.index, 0))
+        codes = [self.encode_sample(s) for s in samples[1:]]
+        if len(codes) % 2:
+            codes.append(0)
+        for i in range(0, len(codes), 2):
+            data.append(codes[i] | (codes[i + 1] << 4))
+        return data
+
+
+def read_pcm(path):
+    with wave.open(path, "rb") as f:
+        if f.getcomptype() != "NONE" or f.getsampwidth() != 2:
+            raise ValueError("not a 16-bit PCM file")
+        channels = f.getnchannels()
+        rate = f.getframerate()
+        samples = array.array("h", f.readframes(f.getnframes()))
+    if sys.byteorder == "big":
+        samples.byteswap()
+    if channels > 1:
+        samples = [sum(samples[i:i + channels]) // channels
+                   for i in range(0, len(samples), channels)]
+    return rate, samples
+
+
+def write_adpcm(path, rate, samples, block_size):
+    samples_per_block = (block_size - 4) * 2 + 1
+    encoder = Encoder()
+    data = bytearray()
+    for i in range(0, len(samples), samples_per_block):
+        data += encoder.encode_block(samples[i:i + samples_per_block])
+
+    byte_rate = rate * block_size // samples_per_block
+    fmt = struct.pack("<HHIIHHHH", 0x11, 1, rate, byte_rate, block_size, 4, 2, samples_per_block)
+    fact = struct.pack("<I", len(samples))
+    chunks = (b"fmt " + struct.pack("<I", len(fmt)) + fmt +
+              b"fact" + struct.pack("<I", len(fact)) + fact +
+              b"data" + struct.pack("<I", len(data)) + data)
+    if len(data) % 2:
+        chunks += b"\0"
+    with open(path, "wb") as f:
+        f.write(b"RIFF" + struct.pack("<I", 4 + len(chunks)) + b"WAVE" + chunks)
+
+
+def convert(src, dst, block_size):
+    rate, samples = read_pcm(src)
+    if not samples:
+        raise ValueError("empty file")
+    write_adpcm(dst, rate, samples, block_size)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert WAV prompts to IMA-ADPCM")
+    parser.add_argument("src", help="WAV file or directory")
+    parser.add_argument("dst", nargs="?", help="output file or directory")
+    parser.add_argument("--in-place", action="store_true", help="overwrite the input files")
+    parser.add_argument("--block-size", type=int, default=BLOCK_SIZE, help="ADPCM block size in bytes")
+    args = parser.parse_args()
+
+    if args.block_size < MIN_BLOCK_SIZE:
+        parser.error("block size must be at least %d" % MIN_BLOCK_SIZE)
+    if not args.dst and not args.in_place:
+        parser.error("an output or --in-place is needed")
+    dst_root = args.src if args.in_place else args.dst
+
+    if os.path.isdir(args.src):
+        files = []
+        for root, _, names in os.walk(args.src):
+            for name in sorted(names):
+                if name.lower().endswith(".wav"):
+                    path = os.path.join(root, name)
+                    files.append((path, os.path.join(dst_root, os.path.relpath(path, args.src))))
+    else:
+        files = [(args.src, dst_root)]
+
+    failed = 0
+    src_size = dst_size = 0
+    for src, dst in files:
+        os.makedirs(os.path.dirname(dst) or ".", exist_ok=True)
+        try:
+            size = os.path.getsize(src)
+            convert(src, dst, args.block_size)
+            src_size += size
+            dst_size += os.path.getsize(dst)
+        except (ValueError, wave.Error, EOFError) as e:
+            print("%s: %s" % (src, e))
+            failed += 1
+
+    print("%d files converted, %d failed, %d -> %d bytes" % (len(files) - failed, failed, src_size, dst_size))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())